@@ -37,6 +37,8 @@ $Fonts = @(
     }
     @{
         Family = "Bookerly"
+        # Default reading family: also emit pre-rotated bitmaps for fast portrait rendering
+        Rotated = $true
         Variants = @(
             @{ Style = ""; File = "Bookerly.ttf"; Variation = $null }
             @{ Style = "Bold"; File = "Bookerly Bold.ttf"; Variation = $null }
@@ -161,6 +163,10 @@ try {
                     "--out", $outPath
                 )
                 
+                if ($fontDef.Rotated) {
+                    $args += "--rotated"
+                }
+                
                 if ($variant.Variation) {
                     $args += "--var"
                     $args += $variant.Variation
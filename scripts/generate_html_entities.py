@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""generate_html_entities.py
+
+Generate src/content/xml/HtmlEntityTable.h: the HTML5 named character
+references (from Python's html.entities.html5) as a flash-resident
+perfect-hash table for decodeHtmlEntity() in HtmlEntities.cpp.
+
+Only the ';'-terminated names are included. Values are UTF-8, except that a
+few typographic characters are folded to the ASCII the reader has always
+used for them (quotes, dashes, ellipsis, special spaces, (c)/(r)/(tm)); the
+same folds are applied to numeric references at runtime (see
+foldCodepoint() in HtmlEntities.cpp - keep both in sync).
+
+The hash is "hash and displace": FNV-1a with SEED_BUCKET picks a bucket,
+and the bucket's displacement d picks the slot mix(h2 ^ d * 0x9E3779B9) %
+SLOTS, where h2 is FNV-1a with SEED_SLOT. Displacements are searched so
+every name gets its own slot.
+
+Usage:
+  python scripts/generate_html_entities.py [output_file]
+"""
+from __future__ import annotations
+
+import html.entities
+import sys
+from pathlib import Path
+
+SEED_BUCKET = 0x811C9DC5
+SEED_SLOT = 0x01000193
+MASK32 = 0xFFFFFFFF
+
+# Codepoint -> replacement (must match foldCodepoint() in HtmlEntities.cpp)
+FOLDS = {
+    0x09: " ",
+    0x0D: "",
+    0x00AB: '"',
+    0x00BB: '"',
+    0x00A9: "(c)",
+    0x00AD: "",
+    0x00AE: "(r)",
+    0x2002: " ",
+    0x2003: " ",
+    0x2009: " ",
+    0x200A: " ",
+    0x200B: "",
+    0x200C: "",
+    0x200D: "",
+    0x2010: "-",
+    0x2011: "-",
+    0x2012: "-",
+    0x2013: "-",
+    0x2014: "-",
+    0x2018: "'",
+    0x2019: "'",
+    0x201A: ",",
+    0x201C: '"',
+    0x201D: '"',
+    0x201E: '"',
+    0x2022: "-",
+    0x2026: "...",
+    0x2028: "\n",
+    0x2029: "\n",
+    0x202F: " ",
+    0x2032: "'",
+    0x2033: '"',
+    0x2039: '"',
+    0x203A: '"',
+    0x2122: "(tm)",
+    0xFEFF: "",
+}
+
+
+def fnv(name: bytes, seed: int) -> int:
+    h = seed
+    for c in name:
+        h = ((h ^ c) * 16777619) & MASK32
+    return h
+
+
+def mix(x: int) -> int:
+    x ^= x >> 16
+    x = (x * 0x7FEB352D) & MASK32
+    x ^= x >> 15
+    x = (x * 0x846CA68B) & MASK32
+    x ^= x >> 16
+    return x
+
+
+def slot_for(h2: int, d: int, slots: int) -> int:
+    return mix(h2 ^ ((d * 0x9E3779B9) & MASK32)) % slots
+
+
+def fold(value: str) -> bytes:
+    return "".join(FOLDS.get(ord(ch), ch) for ch in value).encode("utf-8")
+
+
+def build(names: list[bytes], buckets: int, slots: int) -> list[int] | None:
+    groups: list[list[bytes]] = [[] for _ in range(buckets)]
+    for name in names:
+        groups[fnv(name, SEED_BUCKET) % buckets].append(name)
+    displacements = [0] * buckets
+    taken = [False] * slots
+    for b in sorted(range(buckets), key=lambda i: -len(groups[i])):
+        group = groups[b]
+        if not group:
+            continue
+        h2s = [fnv(name, SEED_SLOT) for name in group]
+        for d in range(1 << 16):
+            placed = [slot_for(h2, d, slots) for h2 in h2s]
+            if len(set(placed)) == len(placed) and not any(taken[s] for s in placed):
+                for s in placed:
+                    taken[s] = True
+                displacements[b] = d
+                break
+        else:
+            return None
+    return displacements
+
+
+def c_string(data: bytes) -> str:
+    out = []
+    after_hex = False
+    for byte in data:
+        ch = chr(byte)
+        if after_hex and ch in "0123456789abcdefABCDEF":
+            out.append('" "')  # Keep a hex escape from swallowing the next digit
+        after_hex = False
+        if ch == '"' or ch == "\\":
+            out.append("\\" + ch)
+        elif 0x20 <= byte < 0x7F:
+            out.append(ch)
+        else:
+            out.append("\\x%02X" % byte)
+            after_hex = True
+    return '"' + "".join(out) + '"'
+
+
+def write_table(path: Path) -> None:
+    entities = {k[:-1].encode("ascii"): fold(v) for k, v in html.entities.html5.items() if k.endswith(";")}
+    names = sorted(entities)
+    buckets = len(names) // 3
+    slots = len(names)
+    displacements = build(names, buckets, slots)
+    while displacements is None:
+        slots += 16
+        displacements = build(names, buckets, slots)
+
+    records: list[tuple[int, int, int, int] | None] = [None] * slots
+    name_pool = bytearray()
+    value_pool = bytearray()
+    value_offsets: dict[bytes, int] = {}
+    for name in names:
+        h1 = fnv(name, SEED_BUCKET)
+        s = slot_for(fnv(name, SEED_SLOT), displacements[h1 % buckets], slots)
+        value = entities[name]
+        if value not in value_offsets:
+            value_offsets[value] = len(value_pool)
+            value_pool += value
+        records[s] = (len(name_pool), len(name), value_offsets[value], len(value))
+        name_pool += name
+
+    lines = [
+        "#ifndef HTML_ENTITY_TABLE_H",
+        "#define HTML_ENTITY_TABLE_H",
+        "",
+        "// Generated by generate_html_entities.py - do not edit",
+        "// HTML5 named character references: %d names" % len(names),
+        "// clang-format off",
+        "",
+        "#include <stdint.h>",
+        "",
+        "static constexpr uint32_t HTML_ENTITY_SEED_BUCKET = 0x%08Xu;" % SEED_BUCKET,
+        "static constexpr uint32_t HTML_ENTITY_SEED_SLOT = 0x%08Xu;" % SEED_SLOT,
+        "static constexpr uint32_t HTML_ENTITY_BUCKETS = %d;" % buckets,
+        "static constexpr uint32_t HTML_ENTITY_SLOTS = %d;" % slots,
+        "static constexpr uint32_t HTML_ENTITY_MAX_NAME = %d;" % max(len(n) for n in names),
+        "",
+        "struct HtmlEntityRecord {",
+        "  uint16_t name;        // Offset into HTML_ENTITY_NAMES",
+        "  uint8_t nameLength;   // 0 = empty slot",
+        "  uint8_t valueLength;",
+        "  uint16_t value;       // Offset into HTML_ENTITY_VALUES",
+        "};",
+        "",
+        "static const uint16_t HTML_ENTITY_DISPLACEMENTS[HTML_ENTITY_BUCKETS] = {",
+    ]
+    for i in range(0, buckets, 16):
+        lines.append("    " + ", ".join(str(d) for d in displacements[i : i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const HtmlEntityRecord HTML_ENTITY_RECORDS[HTML_ENTITY_SLOTS] = {")
+    for i in range(0, slots, 6):
+        row = []
+        for r in records[i : i + 6]:
+            row.append("{%d, %d, %d, %d}" % (r[0], r[1], r[3], r[2]) if r else "{0, 0, 0, 0}")
+        lines.append("    " + ", ".join(row) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const char HTML_ENTITY_NAMES[] =")
+    for i in range(0, len(name_pool), 96):
+        lines.append("    " + c_string(bytes(name_pool[i : i + 96])))
+    lines[-1] += ";"
+    lines.append("")
+    lines.append("static const char HTML_ENTITY_VALUES[] =")
+    for i in range(0, len(value_pool), 48):
+        lines.append("    " + c_string(bytes(value_pool[i : i + 48])))
+    lines[-1] += ";"
+    lines.append("")
+    lines.append("// clang-format on")
+    lines.append("")
+    lines.append("#endif")
+    path.write_text("\n".join(lines) + "\n", encoding="ascii", newline="\n")
+    print("%s: %d names, %d buckets, %d slots, %d name bytes, %d value bytes"
+          % (path, len(names), buckets, slots, len(name_pool), len(value_pool)))
+
+
+def main() -> int:
+    root = Path(__file__).resolve().parent.parent
+    out = Path(sys.argv[1]) if len(sys.argv) > 1 else root / "src" / "content" / "xml" / "HtmlEntityTable.h"
+    write_table(out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""generate_hyphenation_trie.py
+
+Compile Liang/TeX hyphenation patterns (resources/hyphenation/*.pat.txt)
+into the packed trie headers in src/text/hyphenation/Liang/ that
+liang_hyphenate() walks, or into a dictionary file that
+DictionaryHyphenation loads from the SD card (/microreader/hyphenation/).
+
+The trie is one byte blob, so it stays in flash:
+
+  header   "HYP" + format version (1 byte)
+  nodes    depth-first, the root right after the header
+
+  node     u8 flags             bits 0-5: child count, bit 7: a pattern ends here
+           [pattern values]     u8 (index of the first nonzero value << 4 | value count),
+                                then the values as nibbles, low nibble first
+           u8 labels[count]     child bytes, ascending
+           u8 children[count][3]  little-endian blob offsets of the children
+
+Letters are UTF-8 bytes and pattern values index byte positions, exactly as
+the word is matched at runtime. '.' marks a word boundary.
+
+Dictionary file (<language tag>.hyph, little-endian):
+
+  header      "HYPD", version (1 byte), min word length, min left, min right (1 byte each),
+              trie size (u32), exceptions size (u32)
+  trie        as above
+  exceptions  words sorted by their bytes, each: u8 length, word, u8 count, u8 positions[count]
+
+Exceptions come from a hyph-utf8 style .hyp.txt file: one word per line with
+its hyphenation points marked by '-' (e.g. "ta-ble"). Positions are byte
+offsets into the word, as HyphenationStrategy::hyphenate() returns them.
+
+Usage:
+  python scripts/generate_hyphenation_trie.py                 # regenerate the built-in headers
+  python scripts/generate_hyphenation_trie.py header <patterns> <output.h> <prefix>
+  python scripts/generate_hyphenation_trie.py dictionary <patterns> <output.hyph>
+      [--exceptions <file.hyp.txt>] [--min-word N] [--left-min N] [--right-min N]
+"""
+from __future__ import annotations
+
+import argparse
+import sys
+from pathlib import Path
+
+FORMAT_MAGIC = b"HYP"
+FORMAT_VERSION = 1
+DICTIONARY_MAGIC = b"HYPD"
+DICTIONARY_VERSION = 1
+HAS_PATTERN = 0x80
+MAX_CHILDREN = 0x3F
+
+# Pattern file, header, C identifier prefix
+LANGUAGES = [
+    ("hyph-de.pat.txt", "hyph-de.h", "de"),
+    ("hyph-en-us.pat.txt", "hyph-en-us.h", "en_us"),
+]
+
+
+def parse_pattern(text: str) -> tuple[bytes, list[int]]:
+    letters = bytearray()
+    values = [0]
+    for ch in text:
+        if ch.isdigit():
+            values[-1] = int(ch)
+        else:
+            encoded = ch.encode("utf-8")
+            letters += encoded
+            values += [0] * len(encoded)
+    return bytes(letters), values
+
+
+def load_patterns(path: Path) -> dict[bytes, list[int]]:
+    patterns: dict[bytes, list[int]] = {}
+    for line in path.read_text(encoding="utf-8").splitlines():
+        line = line.split("%", 1)[0]
+        for token in line.split():
+            letters, values = parse_pattern(token)
+            if letters in patterns:
+                raise ValueError("duplicate pattern: %s" % token)
+            patterns[letters] = values
+    return patterns
+
+
+class Node:
+    def __init__(self) -> None:
+        self.children: dict[int, Node] = {}
+        self.values: list[int] | None = None
+        self.offset = 0
+
+    def encoded_values(self) -> bytes:
+        nonzero = [i for i, v in enumerate(self.values) if v]
+        if not nonzero:
+            return bytes([0])
+        first, last = nonzero[0], nonzero[-1]
+        digits = self.values[first : last + 1]
+        if first > 15 or len(digits) > 15:
+            raise ValueError("pattern too long")
+        out = bytearray([first << 4 | len(digits)])
+        for i in range(0, len(digits), 2):
+            out.append(digits[i] | ((digits[i + 1] if i + 1 < len(digits) else 0) << 4))
+        return bytes(out)
+
+    def size(self) -> int:
+        n = 1 + 4 * len(self.children)
+        if self.values is not None:
+            n += len(self.encoded_values())
+        return n
+
+
+def build_trie(patterns: dict[bytes, list[int]]) -> bytes:
+    root = Node()
+    for letters, values in patterns.items():
+        node = root
+        for byte in letters:
+            node = node.children.setdefault(byte, Node())
+        node.values = values
+
+    # Depth-first layout
+    order: list[Node] = []
+    stack = [root]
+    while stack:
+        node = stack.pop()
+        order.append(node)
+        stack.extend(node.children[b] for b in sorted(node.children, reverse=True))
+    offset = len(FORMAT_MAGIC) + 1
+    for node in order:
+        node.offset = offset
+        offset += node.size()
+    if offset >= 1 << 24:
+        raise ValueError("trie too large for 24-bit offsets")
+
+    blob = bytearray(FORMAT_MAGIC + bytes([FORMAT_VERSION]))
+    for node in order:
+        if len(node.children) > MAX_CHILDREN:
+            raise ValueError("too many children")
+        blob.append(len(node.children) | (HAS_PATTERN if node.values is not None else 0))
+        if node.values is not None:
+            blob += node.encoded_values()
+        labels = sorted(node.children)
+        blob += bytes(labels)
+        for label in labels:
+            blob += node.children[label].offset.to_bytes(3, "little")
+    assert len(blob) == offset
+    return bytes(blob)
+
+
+def write_header(patterns_path: Path, out: Path, prefix: str) -> None:
+    patterns = load_patterns(patterns_path)
+    blob = build_trie(patterns)
+    guard = out.name.upper().replace("-", "_").replace(".", "_")
+    lines = [
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        '#include "liang_hyphenation_patterns.h"',
+        "",
+        "// Generated by generate_hyphenation_trie.py from %s - do not edit" % patterns_path.name,
+        "// %d patterns, packed trie of %d bytes" % (len(patterns), len(blob)),
+        "// clang-format off",
+        "",
+        "static const std::uint8_t %s_trie[] = {" % prefix,
+    ]
+    for i in range(0, len(blob), 24):
+        lines.append("    " + ",".join(str(b) for b in blob[i : i + 24]) + ",")
+    lines += [
+        "};",
+        "",
+        "// clang-format on",
+        "",
+        "static const HyphenationPatterns %s_patterns = {%s_trie, sizeof(%s_trie)};" % (prefix, prefix, prefix),
+        "",
+        "#endif  // %s" % guard,
+    ]
+    out.write_text("\n".join(lines) + "\n", encoding="ascii", newline="\n")
+    print("%s: %d patterns, %d bytes" % (out, len(patterns), len(blob)))
+
+
+def load_exceptions(path: Path) -> dict[bytes, list[int]]:
+    exceptions: dict[bytes, list[int]] = {}
+    for line in path.read_text(encoding="utf-8").splitlines():
+        line = line.split("%", 1)[0]
+        for token in line.split():
+            word = bytearray()
+            positions = []
+            for ch in token:
+                if ch == "-":
+                    positions.append(len(word))
+                else:
+                    word += ch.encode("utf-8")
+            if len(word) > 255 or len(positions) > 255:
+                raise ValueError("exception too long: %s" % token)
+            exceptions[bytes(word)] = positions
+    return exceptions
+
+
+def write_dictionary(patterns_path: Path, out: Path, exceptions_path: Path | None, min_word: int, left_min: int,
+                     right_min: int) -> None:
+    patterns = load_patterns(patterns_path)
+    blob = build_trie(patterns)
+    exceptions = load_exceptions(exceptions_path) if exceptions_path else {}
+    table = bytearray()
+    for word in sorted(exceptions):
+        positions = exceptions[word]
+        table += bytes([len(word)]) + word + bytes([len(positions)] + positions)
+
+    header = bytearray(DICTIONARY_MAGIC)
+    header += bytes([DICTIONARY_VERSION, min_word, left_min, right_min])
+    header += len(blob).to_bytes(4, "little") + len(table).to_bytes(4, "little")
+    out.write_bytes(bytes(header) + blob + bytes(table))
+    print("%s: %d patterns, %d exceptions, %d bytes" % (out, len(patterns), len(exceptions),
+                                                        len(header) + len(blob) + len(table)))
+
+
+def main() -> int:
+    root = Path(__file__).resolve().parent.parent
+    if len(sys.argv) == 1:
+        for patterns, header, prefix in LANGUAGES:
+            write_header(root / "resources" / "hyphenation" / patterns,
+                         root / "src" / "text" / "hyphenation" / "Liang" / header, prefix)
+        return 0
+
+    parser = argparse.ArgumentParser(description="Compile Liang hyphenation patterns")
+    commands = parser.add_subparsers(dest="command", required=True)
+    header = commands.add_parser("header", help="built-in trie header")
+    header.add_argument("patterns", type=Path)
+    header.add_argument("output", type=Path)
+    header.add_argument("prefix")
+    dictionary = commands.add_parser("dictionary", help="SD card dictionary file")
+    dictionary.add_argument("patterns", type=Path)
+    dictionary.add_argument("output", type=Path)
+    dictionary.add_argument("--exceptions", type=Path)
+    dictionary.add_argument("--min-word", type=int, default=0)
+    dictionary.add_argument("--left-min", type=int, default=0)
+    dictionary.add_argument("--right-min", type=int, default=0)
+    args = parser.parse_args()
+
+    if args.command == "header":
+        write_header(args.patterns, args.output, args.prefix)
+    else:
+        write_dictionary(args.patterns, args.output, args.exceptions, args.min_word, args.left_min, args.right_min)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -109,6 +109,19 @@ def main(argv=None):
         default=True,
         help="Disable grayscale output: do not generate the Bitmaps_lsb/Bitmaps_msb arrays (default: enabled)",
     )
+    p.add_argument(
+        "--no-glyph-index",
+        dest="glyph_index",
+        action="store_false",
+        default=True,
+        help="Do not generate the Latin-1 index and range tables used for O(1) glyph lookup (default: enabled)",
+    )
+    p.add_argument(
+        "--rotated",
+        action="store_true",
+        default=False,
+        help="Also emit column-major (pre-rotated) bitmaps used for portrait rendering (default: disabled)",
+    )
 
     args = p.parse_args(argv)
 
@@ -324,6 +337,8 @@ def main(argv=None):
             bitmap_msb_all,
             yadvance,
             grayscale=args.grayscale,
+            glyph_index=args.glyph_index,
+            rotated=args.rotated,
         )
         # optional preview: render a combined image showing BW and grayscale side-by-side
         if args.preview_output:
@@ -442,6 +457,8 @@ def main(argv=None):
             bitmap_msb_all,
             yadvance,
             grayscale=args.grayscale,
+            glyph_index=args.glyph_index,
+            rotated=args.rotated,
         )
 
         if args.preview_output:
@@ -473,6 +490,8 @@ def main(argv=None):
         args.yoffset,
         args.fill,
         grayscale=args.grayscale,
+        glyph_index=args.glyph_index,
+        rotated=args.rotated,
     )
 
     # optional preview image showing the same characters (use generated bytes)
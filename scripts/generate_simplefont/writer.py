@@ -10,6 +10,157 @@ from .bitmap_utils import (
 )
 
 
+# Marker for "no glyph" entries in the dense Latin-1 lookup table
+NO_GLYPH = 0xFFFF
+# Runs of consecutive codepoints above U+00FF shorter than this are left to
+# the binary-search fallback in findGlyphIndex instead of getting a range entry
+MIN_RANGE_RUN = 4
+
+
+def build_glyph_ranges(chars: List[int]) -> List[Tuple[int, int, int]]:
+    """Return (first codepoint, count, glyph index) runs for codepoints above U+00FF.
+
+    `chars` must be sorted (the glyph array is sorted by codepoint), so a run
+    of consecutive codepoints maps to consecutive glyph indices.
+    """
+    ranges = []
+    i = 0
+    while i < len(chars):
+        if chars[i] < 0x100:
+            i += 1
+            continue
+        start = i
+        while i + 1 < len(chars) and chars[i + 1] == chars[i] + 1 and i + 1 - start < 0xFFFF:
+            i += 1
+        count = i - start + 1
+        if count >= MIN_RANGE_RUN:
+            ranges.append((chars[start], count, start))
+        i += 1
+    return ranges
+
+
+def format_glyph_lookup_tables(font_name: str, chars: List[int]) -> Tuple[str, int]:
+    """Emit the dense Latin-1 index table and the range table for a font.
+
+    Returns the C source and the number of range entries (0 means the range
+    table was omitted and the font struct should use nullptr).
+    """
+    index = [NO_GLYPH] * 256
+    for glyph_idx, ch in enumerate(chars):
+        if ch < 0x100:
+            index[ch] = glyph_idx
+    src = (
+        f"\nconst uint16_t {font_name}GlyphIndexLatin1[256] PROGMEM = {{\n"
+        f"{format_c_code_list(index)}\n}};\n\n"
+    )
+
+    ranges = build_glyph_ranges(chars)
+    if ranges:
+        range_lines = [f"    {{0x{first:X}, {count}, {glyph_idx}}}" for first, count, glyph_idx in ranges]
+        range_c = ",\n".join(range_lines)
+        src += f"\nconst SimpleGFXrange {font_name}GlyphRanges[] PROGMEM = {{\n{range_c}\n}};\n\n"
+    return src, len(ranges)
+
+
+def rotate_glyph_bitmap(row_major: List[int], width: int, height: int) -> List[int]:
+    """Transpose one glyph bitmap from row-major to column-major order.
+
+    Each glyph column becomes ceil(height / 8) bytes, MSB first from the top
+    row. Padding bits are white (1), like the row-major padding.
+    """
+    row_stride = bytes_per_row(width)
+    col_stride = bytes_per_row(height)
+    out = []
+    for x in range(width):
+        for j in range(col_stride):
+            byte_val = 0
+            for i in range(8):
+                y = j * 8 + i
+                bit = 1
+                if y < height:
+                    bit = (row_major[y * row_stride + x // 8] >> (7 - (x % 8))) & 1
+                byte_val |= bit << (7 - i)
+            out.append(byte_val)
+    return out
+
+
+def format_rotated_bitmaps(
+    font_name: str,
+    chars: List[int],
+    glyphs: List[dict],
+    bitmap_all: List[int],
+    bitmap_lsb_all: List[int],
+    bitmap_msb_all: List[int],
+    grayscale: bool,
+) -> str:
+    """Emit column-major (pre-rotated) copies of the glyph bitmaps plus per-glyph offsets.
+
+    TextRenderer uses them in the portrait orientations, where a glyph column
+    maps to a framebuffer row and can be copied in whole bytes.
+    """
+    planes = [("BitmapsCol", bitmap_all)]
+    if grayscale:
+        planes += [("BitmapsCol_lsb", bitmap_lsb_all), ("BitmapsCol_msb", bitmap_msb_all)]
+
+    offsets = []
+    plane_lines = {suffix: [] for suffix, _ in planes}
+    offset = 0
+    for idx, ch in enumerate(chars):
+        g = glyphs[idx]
+        per_glyph_bytes = bytes_per_row(g["width"]) * g["height"]
+        start = g["bitmapOffset"]
+        offsets.append(offset)
+        comment = f"// 0x{ch:X} '{chr(ch)}'"
+        for suffix, data in planes:
+            rotated = rotate_glyph_bitmap(data[start : start + per_glyph_bytes], g["width"], g["height"])
+            chunk_c = format_c_byte_list(rotated)
+            plane_lines[suffix].append(f"    {comment}\n{chunk_c}" if chunk_c else f"    {comment}")
+        offset += bytes_per_row(g["height"]) * g["width"]
+
+    src = ""
+    for suffix, _ in planes:
+        # Zero-size glyphs (e.g. space) produce comment-only entries; drop their separators
+        body = "\n".join(
+            line + ("," if i + 1 < len(plane_lines[suffix]) and "0x" in line else "")
+            for i, line in enumerate(plane_lines[suffix])
+        )
+        src += f"\nconst uint8_t {font_name}{suffix}[] PROGMEM = {{\n{body}\n}};\n\n"
+    offsets_c = format_c_code_list(offsets)
+    src += f"\nconst uint32_t {font_name}ColOffsets[] PROGMEM = {{\n{offsets_c}\n}};\n\n"
+    return src
+
+
+def format_font_struct(
+    font_name: str,
+    count: int,
+    yadvance: int,
+    grayscale: bool,
+    glyph_index: bool,
+    range_count: int,
+    rotated: bool = False,
+) -> str:
+    """Emit the final SimpleGFXfont initializer."""
+    if grayscale:
+        planes = f"{font_name}Bitmaps, {font_name}Bitmaps_lsb, {font_name}Bitmaps_msb"
+    else:
+        planes = f"{font_name}Bitmaps, nullptr, nullptr"
+    tail = f"{count}, {yadvance}"
+    if glyph_index or rotated:
+        if glyph_index:
+            ranges = f"{font_name}GlyphRanges" if range_count else "nullptr"
+            lookup = f"{font_name}GlyphIndexLatin1, {ranges}, {range_count}"
+        else:
+            lookup = "nullptr, nullptr, 0"
+        tail += f",\n    nullptr, 0, FontStyle::REGULAR, {lookup}"
+    if rotated:
+        if grayscale:
+            col_planes = f"{font_name}BitmapsCol, {font_name}BitmapsCol_lsb, {font_name}BitmapsCol_msb"
+        else:
+            col_planes = f"{font_name}BitmapsCol, nullptr, nullptr"
+        tail += f",\n    {col_planes}, {font_name}ColOffsets"
+    return f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{planes}, {font_name}Glyphs,\n    {tail}}};\n"
+
+
 def generate_header(
     font_name: str,
     out_path: str,
@@ -22,6 +173,8 @@ def generate_header(
     yoffset: int,
     fill: int,
     grayscale: bool = True,
+    glyph_index: bool = True,
+    rotated: bool = False,
 ):
     bitmap_all = []
     bitmap_lsb_all = []
@@ -129,14 +282,20 @@ const uint8_t {font_name}Bitmaps[] PROGMEM = {{
         f"\nconst SimpleGFXglyph {font_name}Glyphs[] PROGMEM = {{\n{glyphs_c}\n}};\n\n"
     )
 
-    # Final font struct initializer: pick pointers or nullptr based on grayscale
-    if grayscale:
-        header += f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, {font_name}Bitmaps_lsb, {font_name}Bitmaps_msb, {font_name}Glyphs,\n    {count}, {yadvance}}};\n"
-    else:
-        header += (
-            f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, nullptr, nullptr, {font_name}Glyphs,\n"
-            f"    {count}, {yadvance}}};\n"
+    # Optional O(1) glyph lookup tables used by findGlyphIndex
+    range_count = 0
+    if glyph_index:
+        tables_c, range_count = format_glyph_lookup_tables(font_name, chars)
+        header += tables_c
+
+    # Optional column-major bitmaps for the portrait orientations
+    if rotated:
+        header += format_rotated_bitmaps(
+            font_name, chars, glyphs, bitmap_all, bitmap_lsb_all, bitmap_msb_all, grayscale
         )
+
+    # Final font struct initializer: pick pointers or nullptr based on grayscale
+    header += format_font_struct(font_name, count, yadvance, grayscale, glyph_index, range_count, rotated)
     os.makedirs(os.path.dirname(out_path), exist_ok=True)
     with open(out_path, "w", encoding="utf-8", newline="\n") as f:
         f.write(header)
@@ -154,6 +313,8 @@ def write_header_from_data(
     bitmap_msb_all: List[int],
     yadvance: int,
     grayscale: bool = True,
+    glyph_index: bool = True,
+    rotated: bool = False,
 ):
     bmp_lines = []
     bmp_lsb_lines = []
@@ -210,14 +371,18 @@ const uint8_t {font_name}Bitmaps[] PROGMEM = {{
         f"\nconst SimpleGFXglyph {font_name}Glyphs[] PROGMEM = {{\n{glyphs_c}\n}};\n\n"
     )
 
-    if grayscale:
-        header += f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, {font_name}Bitmaps_lsb, {font_name}Bitmaps_msb, {font_name}Glyphs,\n    {count}, {yadvance}}};\n"
-    else:
-        header += (
-            f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, nullptr, nullptr, {font_name}Glyphs,\n"
-            f"    {count}, {yadvance}}};\n"
+    range_count = 0
+    if glyph_index:
+        tables_c, range_count = format_glyph_lookup_tables(font_name, chars)
+        header += tables_c
+
+    if rotated:
+        header += format_rotated_bitmaps(
+            font_name, chars, glyphs, bitmap_all, bitmap_lsb_all, bitmap_msb_all, grayscale
         )
 
+    header += format_font_struct(font_name, count, yadvance, grayscale, glyph_index, range_count, rotated)
+
     os.makedirs(os.path.dirname(out_path), exist_ok=True)
     with open(out_path, "w", encoding="utf-8", newline="\n") as f:
         f.write(header)
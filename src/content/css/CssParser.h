@@ -66,6 +66,20 @@ class CssParser {
     return styleMap_.size();
   }
 
+  /**
+   * All loaded class styles, keyed by class name
+   */
+  const std::map<String, CssStyle>& getStyles() const {
+    return styleMap_;
+  }
+
+  /**
+   * Add or replace the style for a class (used when restoring a saved style table)
+   */
+  void setStyleForClass(const String& className, const CssStyle& style) {
+    styleMap_[className] = style;
+  }
+
   /**
    * Clear all loaded styles
    */
@@ -0,0 +1,280 @@
+#include "BookContainer.h"
+
+#include <cstring>
+
+static const char BOOK_CONTAINER_MAGIC[4] = {'E', 'B', 'K', 'C'};
+static constexpr uint8_t BOOK_CONTAINER_VERSION = 1;
+static constexpr uint32_t BOOK_CONTAINER_HEADER_SIZE = 24;
+static constexpr uint32_t BOOK_CONTAINER_CHAPTER_ENTRY_SIZE = 12;
+static constexpr size_t BOOK_CONTAINER_COPY_CHUNK = 1024;
+// Paragraph offsets are buffered and written in blocks of this many bytes
+static constexpr size_t BOOK_CONTAINER_PARAGRAPH_FLUSH = 1024;
+
+static void containerPutU32(std::vector<uint8_t>& out, uint32_t v) {
+  out.push_back((uint8_t)(v & 0xFF));
+  out.push_back((uint8_t)((v >> 8) & 0xFF));
+  out.push_back((uint8_t)((v >> 16) & 0xFF));
+  out.push_back((uint8_t)((v >> 24) & 0xFF));
+}
+
+static uint32_t containerGetU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Append `len` bytes of `src` (from its current position) to `dst`
+static bool containerCopy(File& src, File& dst, uint32_t len) {
+  uint8_t buf[BOOK_CONTAINER_COPY_CHUNK];
+  while (len > 0) {
+    const size_t want = len < sizeof(buf) ? len : sizeof(buf);
+    const size_t got = src.read(buf, want);
+    if (got != want || dst.write(buf, got) != got) {
+      return false;
+    }
+    len -= (uint32_t)got;
+  }
+  return true;
+}
+
+BookContainer::~BookContainer() {
+  close();
+}
+
+bool BookContainer::open(const char* path, uint32_t sourceSize) {
+  close();
+  if (!SD.exists(path)) {
+    return false;
+  }
+  file_ = SD.open(path);
+  if (!file_) {
+    return false;
+  }
+
+  const size_t fileSize = file_.size();
+  uint8_t header[BOOK_CONTAINER_HEADER_SIZE];
+  if (fileSize < BOOK_CONTAINER_HEADER_SIZE || file_.read(header, sizeof(header)) != sizeof(header) ||
+      memcmp(header, BOOK_CONTAINER_MAGIC, 4) != 0 || header[4] != BOOK_CONTAINER_VERSION) {
+    Serial.printf("  Book container %s: bad header, ignoring\n", path);
+    close();
+    return false;
+  }
+  if (containerGetU32(header + 8) != sourceSize) {
+    Serial.printf("  Book container %s: built for another source, ignoring\n", path);
+    close();
+    return false;
+  }
+  const uint32_t chapterCount = containerGetU32(header + 12);
+  paragraphCount_ = containerGetU32(header + 16);
+  textSize_ = containerGetU32(header + 20);
+  paragraphTableOffset_ = BOOK_CONTAINER_HEADER_SIZE + chapterCount * BOOK_CONTAINER_CHAPTER_ENTRY_SIZE;
+  textFileOffset_ = paragraphTableOffset_ + paragraphCount_ * 4;
+  if ((uint64_t)textFileOffset_ + textSize_ != fileSize) {
+    Serial.printf("  Book container %s: size mismatch, ignoring\n", path);
+    close();
+    return false;
+  }
+
+  std::vector<uint8_t> table(chapterCount * BOOK_CONTAINER_CHAPTER_ENTRY_SIZE);
+  if (!table.empty() && file_.read(table.data(), table.size()) != table.size()) {
+    close();
+    return false;
+  }
+  chapters_.resize(chapterCount);
+  for (uint32_t i = 0; i < chapterCount; i++) {
+    const uint8_t* p = table.data() + i * BOOK_CONTAINER_CHAPTER_ENTRY_SIZE;
+    chapters_[i].offset = containerGetU32(p);
+    chapters_[i].length = containerGetU32(p + 4);
+    chapters_[i].firstParagraph = containerGetU32(p + 8);
+    if ((uint64_t)chapters_[i].offset + chapters_[i].length > textSize_ ||
+        chapters_[i].firstParagraph > paragraphCount_) {
+      Serial.printf("  Book container %s: bad chapter table, ignoring\n", path);
+      close();
+      return false;
+    }
+  }
+  path_ = String(path);
+  return true;
+}
+
+void BookContainer::close() {
+  if (file_) {
+    file_.close();
+  }
+  chapters_.clear();
+  path_ = String("");
+  paragraphCount_ = 0;
+  textSize_ = 0;
+  paragraphTableOffset_ = 0;
+  textFileOffset_ = 0;
+}
+
+uint32_t BookContainer::getChapterOffset(int chapter) const {
+  if (chapter < 0 || chapter >= (int)chapters_.size()) {
+    return 0;
+  }
+  return chapters_[chapter].offset;
+}
+
+uint32_t BookContainer::getChapterLength(int chapter) const {
+  if (chapter < 0 || chapter >= (int)chapters_.size()) {
+    return 0;
+  }
+  return chapters_[chapter].length;
+}
+
+bool BookContainer::readChapterParagraphs(int chapter, std::vector<uint32_t>& outStarts) {
+  outStarts.clear();
+  if (!file_ || chapter < 0 || chapter >= (int)chapters_.size()) {
+    return false;
+  }
+  const uint32_t first = chapters_[chapter].firstParagraph;
+  const uint32_t end =
+      chapter + 1 < (int)chapters_.size() ? chapters_[chapter + 1].firstParagraph : paragraphCount_;
+  if (end <= first) {
+    return true;
+  }
+  std::vector<uint8_t> raw((end - first) * 4);
+  if (!file_.seek(paragraphTableOffset_ + first * 4) || file_.read(raw.data(), raw.size()) != raw.size()) {
+    return false;
+  }
+  outStarts.reserve(end - first);
+  const uint32_t base = chapters_[chapter].offset;
+  for (uint32_t i = 0; i < end - first; i++) {
+    outStarts.push_back(containerGetU32(raw.data() + i * 4) - base);
+  }
+  return true;
+}
+
+BookContainer::Writer::Writer(const char* path, uint32_t sourceSize) : path_(path), sourceSize_(sourceSize) {
+  const String textPath = path_ + ".text.part";
+  const String paraPath = path_ + ".para.part";
+  if (SD.exists(textPath.c_str()))
+    SD.remove(textPath.c_str());
+  if (SD.exists(paraPath.c_str()))
+    SD.remove(paraPath.c_str());
+  text_ = SD.open(textPath.c_str(), FILE_WRITE);
+  paragraphs_ = SD.open(paraPath.c_str(), FILE_WRITE);
+  ok_ = text_ && paragraphs_;
+  if (!ok_) {
+    Serial.printf("ERROR: Failed to create book container temp files for %s\n", path);
+  }
+}
+
+BookContainer::Writer::~Writer() {
+  if (text_ || paragraphs_) {
+    discard();
+  }
+}
+
+bool BookContainer::Writer::appendChapterFile(const char* txtPath) {
+  if (!ok_) {
+    return false;
+  }
+  ChapterEntry entry = {textSize_, 0, paragraphCount_};
+
+  File in = SD.open(txtPath);
+  if (in) {
+    uint8_t buf[BOOK_CONTAINER_COPY_CHUNK];
+    size_t got;
+    while ((got = in.read(buf, sizeof(buf))) > 0) {
+      // A paragraph starts at the chapter's first byte and after every newline
+      if (textSize_ == entry.offset) {
+        containerPutU32(paragraphBuf_, textSize_);
+        paragraphCount_++;
+      }
+      for (size_t i = 0; i < got; i++) {
+        if (buf[i] == '\n') {
+          containerPutU32(paragraphBuf_, textSize_ + (uint32_t)i + 1);
+          paragraphCount_++;
+        }
+      }
+      if (text_.write(buf, got) != got) {
+        ok_ = false;
+        break;
+      }
+      textSize_ += (uint32_t)got;
+      if (paragraphBuf_.size() >= BOOK_CONTAINER_PARAGRAPH_FLUSH && !flushParagraphs()) {
+        break;
+      }
+    }
+    in.close();
+  }
+  entry.length = textSize_ - entry.offset;
+  chapters_.push_back(entry);
+  return ok_;
+}
+
+bool BookContainer::Writer::flushParagraphs() {
+  if (!paragraphBuf_.empty() && paragraphs_.write(paragraphBuf_.data(), paragraphBuf_.size()) != paragraphBuf_.size()) {
+    ok_ = false;
+  }
+  paragraphBuf_.clear();
+  return ok_;
+}
+
+bool BookContainer::Writer::finish() {
+  if (!ok_ || !flushParagraphs()) {
+    discard();
+    return false;
+  }
+  const String textPath = path_ + ".text.part";
+  const String paraPath = path_ + ".para.part";
+  const String partPath = path_ + ".part";
+  text_.close();
+  paragraphs_.close();
+
+  std::vector<uint8_t> head;
+  head.insert(head.end(), BOOK_CONTAINER_MAGIC, BOOK_CONTAINER_MAGIC + 4);
+  head.push_back(BOOK_CONTAINER_VERSION);
+  head.push_back(0);
+  head.push_back(0);
+  head.push_back(0);
+  containerPutU32(head, sourceSize_);
+  containerPutU32(head, (uint32_t)chapters_.size());
+  containerPutU32(head, paragraphCount_);
+  containerPutU32(head, textSize_);
+  for (const ChapterEntry& c : chapters_) {
+    containerPutU32(head, c.offset);
+    containerPutU32(head, c.length);
+    containerPutU32(head, c.firstParagraph);
+  }
+
+  if (SD.exists(partPath.c_str()))
+    SD.remove(partPath.c_str());
+  File out = SD.open(partPath.c_str(), FILE_WRITE);
+  File para = SD.open(paraPath.c_str());
+  File text = SD.open(textPath.c_str());
+  bool ok = out && para && text && out.write(head.data(), head.size()) == head.size() &&
+            containerCopy(para, out, paragraphCount_ * 4) && containerCopy(text, out, textSize_);
+  if (text)
+    text.close();
+  if (para)
+    para.close();
+  if (out)
+    out.close();
+  SD.remove(textPath.c_str());
+  SD.remove(paraPath.c_str());
+
+  if (ok) {
+    if (SD.exists(path_.c_str()))
+      SD.remove(path_.c_str());
+    ok = SD.rename(partPath.c_str(), path_.c_str());
+  }
+  if (!ok) {
+    Serial.printf("ERROR: Failed to write book container %s\n", path_.c_str());
+    SD.remove(partPath.c_str());
+    return false;
+  }
+  Serial.printf("  Book container %s: %u chapters, %u paragraphs, %u text bytes\n", path_.c_str(),
+                (unsigned)chapters_.size(), (unsigned)paragraphCount_, (unsigned)textSize_);
+  return true;
+}
+
+void BookContainer::Writer::discard() {
+  if (text_)
+    text_.close();
+  if (paragraphs_)
+    paragraphs_.close();
+  SD.remove((path_ + ".text.part").c_str());
+  SD.remove((path_ + ".para.part").c_str());
+  ok_ = false;
+}
@@ -0,0 +1,104 @@
+#ifndef BOOK_CONTAINER_H
+#define BOOK_CONTAINER_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * BookContainer - Whole-book text cache in a single file
+ *
+ * Holds the converted text of every spine item back to back, so switching
+ * chapters is a seek inside one open file instead of opening a separate TXT
+ * per chapter. Layout (little endian):
+ *
+ *   header:          magic "EBKC", u8 version, u8[3] reserved, u32 source (EPUB) size,
+ *                    u32 chapter count, u32 paragraph count, u32 text size
+ *   chapter table:   per chapter u32 text offset, u32 text length, u32 first paragraph
+ *   paragraph table: per paragraph u32 text offset of its first byte
+ *   text:            chapter texts in spine order (same ESC format as the chapter TXT files)
+ *
+ * Text offsets are relative to the start of the text section, so they are
+ * exact book-wide positions of the converted text.
+ */
+class BookContainer {
+  struct ChapterEntry {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t firstParagraph;
+  };
+
+ public:
+  BookContainer() = default;
+  ~BookContainer();
+
+  // Open an existing container; fails if it was built for a different source size
+  bool open(const char* path, uint32_t sourceSize);
+  void close();
+  bool isOpen() const {
+    return file_;
+  }
+
+  const String& getPath() const {
+    return path_;
+  }
+  int getChapterCount() const {
+    return (int)chapters_.size();
+  }
+  uint32_t getTextSize() const {
+    return textSize_;
+  }
+  // File offset of the text section
+  uint32_t getTextFileOffset() const {
+    return textFileOffset_;
+  }
+  uint32_t getChapterOffset(int chapter) const;
+  uint32_t getChapterLength(int chapter) const;
+
+  // Paragraph starts of a chapter, relative to the chapter's first byte
+  bool readChapterParagraphs(int chapter, std::vector<uint32_t>& outStarts);
+
+  /**
+   * Writer - Builds a container from chapter TXT files
+   *
+   * Text and paragraph offsets are streamed to two temporary files while
+   * chapters are appended; finish() writes the header and tables and copies
+   * both into the final file, which is renamed into place when complete.
+   */
+  class Writer {
+   public:
+    Writer(const char* path, uint32_t sourceSize);
+    ~Writer();
+
+    // Append the next chapter. A missing or empty file adds an empty chapter.
+    bool appendChapterFile(const char* txtPath);
+    bool finish();
+
+   private:
+    bool flushParagraphs();
+    void discard();
+
+    String path_;
+    uint32_t sourceSize_;
+    File text_;
+    File paragraphs_;
+    std::vector<ChapterEntry> chapters_;
+    std::vector<uint8_t> paragraphBuf_;
+    uint32_t textSize_ = 0;
+    uint32_t paragraphCount_ = 0;
+    bool ok_ = true;
+  };
+
+ private:
+  File file_;
+  String path_;
+  std::vector<ChapterEntry> chapters_;
+  uint32_t paragraphCount_ = 0;
+  uint32_t textSize_ = 0;
+  uint32_t paragraphTableOffset_ = 0;
+  uint32_t textFileOffset_ = 0;
+};
+
+#endif
@@ -6,6 +6,7 @@
 #include <filesystem>
 #endif
 
+#include "../xml/HtmlEntities.h"
 #include "../xml/SimpleXmlParser.h"
 
 // Helper function for case-insensitive string comparison
@@ -43,93 +44,15 @@ String EpubReader::getCoverImagePath() {
 }
 
 static String decodeHtmlEntityForToc(const String& entity) {
-  if (entity == "&nbsp;")
-    return "\xC2\xA0";
-  if (entity == "&amp;")
-    return "&";
-  if (entity == "&lt;")
-    return "<";
-  if (entity == "&gt;")
-    return ">";
-  if (entity == "&quot;")
-    return "\"";
-  if (entity == "&apos;")
-    return "'";
-  if (entity == "&rsquo;" || entity == "&lsquo;")
-    return "'";
-  if (entity == "&rdquo;" || entity == "&ldquo;")
-    return "\"";
-  if (entity == "&ndash;" || entity == "&mdash;")
-    return "-";
-  if (entity == "&hellip;")
-    return "...";
-  if (entity == "&shy;")
-    return "";
-
-  if (entity.startsWith("&#") && entity.endsWith(";")) {
-    String num = entity.substring(2, entity.length() - 1);
-    num.trim();
-
-    int base = 10;
-    if (num.startsWith("x") || num.startsWith("X")) {
-      base = 16;
-      num = num.substring(1);
-    }
-
-    long code = 0;
-    bool ok = (num.length() > 0);
-    for (int i = 0; ok && i < num.length(); ++i) {
-      char c = num.charAt(i);
-      int v = -1;
-      if (c >= '0' && c <= '9') {
-        v = c - '0';
-      } else if (base == 16 && c >= 'a' && c <= 'f') {
-        v = 10 + (c - 'a');
-      } else if (base == 16 && c >= 'A' && c <= 'F') {
-        v = 10 + (c - 'A');
-      }
-      if (v < 0 || v >= base) {
-        ok = false;
-        break;
-      }
-      code = code * base + v;
-      if (code > 0x10FFFF) {
-        ok = false;
-        break;
-      }
-    }
-
-    if (ok) {
-      if (code == 13)
-        return "";
-      if (code == 10)
-        return "\n";
-      if (code == 160)
-        return "\xC2\xA0";
-      if (code == 173)
-        return "";
-      if (code == 65279)
-        return "";
-      if (code == 8203 || code == 8204 || code == 8205)
-        return "";
-      if (code == 8216 || code == 8217)
-        return "'";
-      if (code == 8220 || code == 8221)
-        return "\"";
-      if (code == 8230)
-        return "...";
-      if (code == 8208 || code == 8209 || code == 8210 || code == 8211 || code == 8212)
-        return "-";
-      if (code >= 32 && code <= 126) {
-        char out[2];
-        out[0] = (char)code;
-        out[1] = '\0';
-        return String(out);
-      }
-    }
+  char scratch[HTML_ENTITY_SCRATCH_SIZE];
+  size_t length = 0;
+  const char* decoded = decodeHtmlEntity(entity.c_str(), entity.length(), scratch, length);
+  if (!decoded) {
+    return entity;
   }
-
-  return entity;
+  String out;
+  out.concat(decoded, length);
+  return out;
 }
 
 static String decodeHtmlEntitiesInTextForToc(const String& input) {
@@ -190,6 +113,17 @@ static File g_extract_file;
 static const char* EXTRACT_META_FILENAME = "epub_meta.txt";
 static const char* CURRENT_EXTRACT_VERSION = "7";
 
+// Binary book metadata cache (little endian):
+//   magic "EBMC", u8 version, u8[3] reserved, u32 EPUB file size, u32 payload size,
+//   payload: strings are u16 length + bytes + NUL, counts and sizes are u32
+static const char* BOOK_CACHE_FILENAME = "book_meta.bin";
+static const char BOOK_CACHE_MAGIC[4] = {'E', 'B', 'M', 'C'};
+static constexpr uint8_t BOOK_CACHE_VERSION = 1;
+static constexpr size_t BOOK_CACHE_HEADER_SIZE = 16;
+
+// Inflate checkpoints for a compressed entry live next to its extracted path
+static const char* INFLATE_CHECKPOINT_SUFFIX = ".icp";
+
 // Callback to write extracted data to SD card file
 static int extract_to_file_callback(const void* data, size_t size, void* user_data) {
   if (!g_extract_file) {
@@ -279,6 +213,16 @@ EpubReader::EpubReader(const char* epubPath, bool cleanCacheOnStart)
     Serial.println("WARNING: Failed to check/update extract metadata");
   }
 
+  // A book opened before restores its structure from the metadata cache and
+  // skips all XML and CSS parsing
+  if (loadBookCache()) {
+    valid_ = true;
+    unsigned long initMs = millis() - startTime;
+    Serial.printf("  EpubReader init (from cache) took  %lu ms\n", initMs);
+    Serial.println("EpubReader initialized successfully");
+    return;
+  }
+
   // // Extract entire EPUB into extractDir_ and close the zip afterwards
   // Serial.println("  Extracting entire EPUB to cache (this may take a while)...");
   // if (!extractAll()) {
@@ -322,6 +266,7 @@ EpubReader::EpubReader(const char* epubPath, bool cleanCacheOnStart)
   }
 
   valid_ = true;
+  saveBookCache();
   unsigned long initMs = millis() - startTime;
   Serial.printf("  EpubReader init took  %lu ms\n", initMs);
   Serial.println("EpubReader initialized successfully");
@@ -492,6 +437,255 @@ bool EpubReader::checkAndUpdateExtractMeta() {
   return true;
 }
 
+static void cachePutU8(std::vector<uint8_t>& out, uint8_t v) {
+  out.push_back(v);
+}
+
+static void cachePutU16(std::vector<uint8_t>& out, uint16_t v) {
+  out.push_back((uint8_t)(v & 0xFF));
+  out.push_back((uint8_t)(v >> 8));
+}
+
+static void cachePutU32(std::vector<uint8_t>& out, uint32_t v) {
+  cachePutU16(out, (uint16_t)(v & 0xFFFF));
+  cachePutU16(out, (uint16_t)(v >> 16));
+}
+
+static void cachePutString(std::vector<uint8_t>& out, const String& str) {
+  const size_t len = str.length() < 0xFFFF ? str.length() : 0xFFFF;
+  cachePutU16(out, (uint16_t)len);
+  out.insert(out.end(), str.c_str(), str.c_str() + len);
+  out.push_back(0);
+}
+
+// Bounds-checked reader over the cache payload; any overrun marks it failed
+struct BookCacheCursor {
+  const uint8_t* p;
+  const uint8_t* end;
+  bool ok = true;
+
+  bool need(size_t n) {
+    if (!ok || (size_t)(end - p) < n) {
+      ok = false;
+    }
+    return ok;
+  }
+  uint8_t u8() {
+    return need(1) ? *p++ : 0;
+  }
+  uint16_t u16() {
+    if (!need(2))
+      return 0;
+    uint16_t v = (uint16_t)(p[0] | (p[1] << 8));
+    p += 2;
+    return v;
+  }
+  uint32_t u32() {
+    uint32_t lo = u16();
+    uint32_t hi = u16();
+    return lo | (hi << 16);
+  }
+  String str() {
+    uint16_t len = u16();
+    if (!need((size_t)len + 1) || p[len] != 0) {
+      ok = false;
+      return String("");
+    }
+    String v((const char*)p);
+    p += len + 1;
+    return v;
+  }
+};
+
+void EpubReader::saveBookCache() {
+  std::vector<uint8_t> payload;
+  cachePutString(payload, contentOpfPath_);
+  cachePutString(payload, tocNcxPath_);
+  cachePutString(payload, language_);
+  cachePutString(payload, coverHref_);
+
+  cachePutU32(payload, (uint32_t)totalBookSize_);
+  cachePutU32(payload, (uint32_t)spineCount_);
+  for (int i = 0; i < spineCount_; i++) {
+    cachePutString(payload, spine_[i].idref);
+    cachePutString(payload, spine_[i].href);
+    cachePutU32(payload, (uint32_t)spineSizes_[i]);
+    cachePutU32(payload, (uint32_t)spineOffsets_[i]);
+  }
+
+  cachePutU32(payload, (uint32_t)toc_.size());
+  for (const TocItem& item : toc_) {
+    cachePutString(payload, item.title);
+    cachePutString(payload, item.href);
+    cachePutString(payload, item.anchor);
+  }
+
+  cachePutU32(payload, (uint32_t)cssFiles_.size());
+  for (const String& css : cssFiles_) {
+    cachePutString(payload, css);
+  }
+  const size_t ruleCount = cssParser_ ? cssParser_->getStyleCount() : 0;
+  cachePutU32(payload, (uint32_t)ruleCount);
+  if (cssParser_) {
+    for (const auto& rule : cssParser_->getStyles()) {
+      const CssStyle& style = rule.second;
+      cachePutString(payload, rule.first);
+      cachePutU8(payload, (uint8_t)((style.hasTextAlign ? 0x01 : 0) | (style.hasFontStyle ? 0x02 : 0) |
+                                    (style.hasFontWeight ? 0x04 : 0) | (style.hasTextIndent ? 0x08 : 0)));
+      cachePutU8(payload, (uint8_t)style.textAlign);
+      cachePutU8(payload, (uint8_t)style.fontStyle);
+      cachePutU8(payload, (uint8_t)style.fontWeight);
+      cachePutU16(payload, (uint16_t)style.textIndent);
+    }
+  }
+
+  std::vector<uint8_t> header;
+  header.insert(header.end(), BOOK_CACHE_MAGIC, BOOK_CACHE_MAGIC + 4);
+  cachePutU8(header, BOOK_CACHE_VERSION);
+  cachePutU8(header, 0);
+  cachePutU16(header, 0);
+  cachePutU32(header, (uint32_t)epubFileSize_);
+  cachePutU32(header, (uint32_t)payload.size());
+
+  String path = getExtractedPath(BOOK_CACHE_FILENAME);
+  if (SD.exists(path.c_str())) {
+    SD.remove(path.c_str());
+  }
+  File f = SD.open(path.c_str(), FILE_WRITE);
+  if (!f) {
+    Serial.printf("WARNING: Failed to write book cache %s\n", path.c_str());
+    return;
+  }
+  bool ok = f.write(header.data(), header.size()) == header.size() &&
+            f.write(payload.data(), payload.size()) == payload.size();
+  f.close();
+  if (!ok) {
+    Serial.printf("WARNING: Short write on book cache %s\n", path.c_str());
+    SD.remove(path.c_str());
+    return;
+  }
+  Serial.printf("  Wrote book cache: %s (%u bytes)\n", path.c_str(), (unsigned)(header.size() + payload.size()));
+}
+
+bool EpubReader::loadBookCache() {
+  unsigned long startTime = millis();
+  String path = getExtractedPath(BOOK_CACHE_FILENAME);
+  if (!SD.exists(path.c_str())) {
+    return false;
+  }
+  File f = SD.open(path.c_str());
+  if (!f) {
+    return false;
+  }
+  const size_t size = f.size();
+  if (size < BOOK_CACHE_HEADER_SIZE) {
+    f.close();
+    return false;
+  }
+  uint8_t* raw = (uint8_t*)malloc(size);
+  if (!raw) {
+    f.close();
+    return false;
+  }
+  const bool readOk = f.read(raw, size) == size;
+  f.close();
+
+  BookCacheCursor in{raw, raw + size};
+  if (!readOk || memcmp(raw, BOOK_CACHE_MAGIC, 4) != 0 || raw[4] != BOOK_CACHE_VERSION) {
+    free(raw);
+    return false;
+  }
+  in.p += 8;
+  const uint32_t fileSize = in.u32();
+  const uint32_t payloadSize = in.u32();
+  if (fileSize != (uint32_t)epubFileSize_ || payloadSize != size - BOOK_CACHE_HEADER_SIZE) {
+    Serial.println("  Book cache is stale - reparsing");
+    free(raw);
+    return false;
+  }
+
+  // Decode into locals first so a truncated cache leaves the reader untouched
+  String contentOpfPath = in.str();
+  String tocNcxPath = in.str();
+  String language = in.str();
+  String coverHref = in.str();
+  const uint32_t totalBookSize = in.u32();
+  const uint32_t spineCount = in.u32();
+  std::vector<SpineItem> spine;
+  std::vector<size_t> sizes;
+  std::vector<size_t> offsets;
+  for (uint32_t i = 0; in.ok && i < spineCount; i++) {
+    SpineItem item;
+    item.idref = in.str();
+    item.href = in.str();
+    spine.push_back(item);
+    sizes.push_back(in.u32());
+    offsets.push_back(in.u32());
+  }
+  const uint32_t tocCount = in.u32();
+  std::vector<TocItem> toc;
+  for (uint32_t i = 0; in.ok && i < tocCount; i++) {
+    TocItem item;
+    item.title = in.str();
+    item.href = in.str();
+    item.anchor = in.str();
+    toc.push_back(item);
+  }
+  const uint32_t cssFileCount = in.u32();
+  std::vector<String> cssFiles;
+  for (uint32_t i = 0; in.ok && i < cssFileCount; i++) {
+    cssFiles.push_back(in.str());
+  }
+  const uint32_t ruleCount = in.u32();
+  CssParser* cssParser = cssFileCount > 0 ? new CssParser() : nullptr;
+  for (uint32_t i = 0; in.ok && i < ruleCount; i++) {
+    String className = in.str();
+    const uint8_t flags = in.u8();
+    CssStyle style;
+    style.textAlign = (TextAlign)in.u8();
+    style.fontStyle = (CssFontStyle)in.u8();
+    style.fontWeight = (CssFontWeight)in.u8();
+    style.textIndent = (int16_t)in.u16();
+    style.hasTextAlign = (flags & 0x01) != 0;
+    style.hasFontStyle = (flags & 0x02) != 0;
+    style.hasFontWeight = (flags & 0x04) != 0;
+    style.hasTextIndent = (flags & 0x08) != 0;
+    if (cssParser) {
+      cssParser->setStyleForClass(className, style);
+    }
+  }
+  const bool ok = in.ok && in.p == in.end && !contentOpfPath.isEmpty();
+  free(raw);
+  if (!ok) {
+    Serial.println("WARNING: Book cache is corrupt - reparsing");
+    delete cssParser;
+    return false;
+  }
+
+  contentOpfPath_ = contentOpfPath;
+  tocNcxPath_ = tocNcxPath;
+  language_ = language;
+  coverHref_ = coverHref;
+  spineCount_ = (int)spine.size();
+  spine_ = new SpineItem[spineCount_];
+  spineSizes_ = new size_t[spineCount_];
+  spineOffsets_ = new size_t[spineCount_];
+  for (int i = 0; i < spineCount_; i++) {
+    spine_[i] = spine[i];
+    spineSizes_[i] = sizes[i];
+    spineOffsets_[i] = offsets[i];
+  }
+  totalBookSize_ = totalBookSize;
+  toc_.swap(toc);
+  cssFiles_.swap(cssFiles);
+  cssParser_ = cssParser;
+  loadedFromCache_ = true;
+
+  Serial.printf("  Loaded book cache: %d spine items, %u TOC entries, %u CSS rules in %lu ms\n", spineCount_,
+                (unsigned)toc_.size(), (unsigned)ruleCount, millis() - startTime);
+  return true;
+}
+
 // Recursively remove a directory using SD/File API on embedded target
 static void removeDirRecursive(const String& path) {
   File dir = SD.open(path.c_str());
@@ -668,7 +862,7 @@ String EpubReader::getFile(const char* filename) {
   return getExtractedPath(filename);
 }
 
-epub_stream_context* EpubReader::startStreaming(const char* filename, size_t chunk_size) {
+epub_stream_context* EpubReader::startStreaming(const char* filename, size_t chunk_size, bool checkpoints) {
   // Open EPUB if not already open
   if (!openEpub()) {
     return nullptr;
@@ -682,7 +876,29 @@ epub_stream_context* EpubReader::startStreaming(const char* filename, size_t chu
   }
 
   // Start pull-based streaming
-  return epub_start_streaming(reader_, fileIndex, chunk_size);
+  epub_stream_context* ctx = epub_start_streaming(reader_, fileIndex, chunk_size);
+  if (ctx && checkpoints) {
+    epub_file_info info;
+    if (epub_get_file_info(reader_, fileIndex, &info) == EPUB_OK && info.compression == 8) {
+      const String cpPath = getExtractedPath(filename) + INFLATE_CHECKPOINT_SUFFIX;
+      if (epub_stream_set_checkpoints(ctx, cpPath.c_str(), 0) != EPUB_OK) {
+        Serial.printf("  Inflate checkpoints unavailable for %s\n", filename);
+      }
+    }
+  }
+  return ctx;
+}
+
+bool EpubReader::getStoredEntryRange(const char* filename, uint32_t& offset, uint32_t& size) {
+  if (!openEpub()) {
+    return false;
+  }
+
+  uint32_t fileIndex;
+  if (epub_locate_file(reader_, filename, &fileIndex) != EPUB_OK) {
+    return false;
+  }
+  return epub_get_stored_range(reader_, fileIndex, &offset, &size) == EPUB_OK;
 }
 
 String EpubReader::getChapterNameForSpine(int spineIndex) const {
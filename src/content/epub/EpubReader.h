@@ -76,8 +76,17 @@ class EpubReader {
    * Start pull-based streaming extraction of a file
    * Returns streaming context or nullptr on error
    * chunk_size: internal buffer size (0 for default 8KB)
+   * checkpoints: record inflate checkpoints next to the extracted file on the
+   * first pass and resume from them in epub_seek_stream() afterwards
    */
-  epub_stream_context* startStreaming(const char* filename, size_t chunk_size = 0);
+  epub_stream_context* startStreaming(const char* filename, size_t chunk_size = 0, bool checkpoints = false);
+
+  /**
+   * Locate a stored (uncompressed) file's bytes inside the EPUB
+   * Returns false if the file is missing or compressed
+   * offset: absolute offset of the file data in the EPUB, size: its length
+   */
+  bool getStoredEntryRange(const char* filename, uint32_t& offset, uint32_t& size);
 
   /**
    * Get the extract directory path (for building output paths)
@@ -139,6 +148,21 @@ class EpubReader {
   // extracted SD path for that cover image. Returns empty string if not found.
   String getCoverImagePath();
 
+  /**
+   * True if the book structure was restored from the binary metadata cache
+   * instead of being parsed from the EPUB's XML and CSS files
+   */
+  bool isLoadedFromCache() const {
+    return loadedFromCache_;
+  }
+
+  /**
+   * Size of the EPUB file, used to validate caches derived from it
+   */
+  size_t getEpubFileSize() const {
+    return epubFileSize_;
+  }
+
   /**
    * Get the underlying epub_reader handle (for debugging/testing)
    */
@@ -161,6 +185,10 @@ class EpubReader {
   bool parseCssFiles();
   bool cleanExtractDir();
   bool extractAll();
+  // Binary snapshot of everything the parse* steps produce (spine, TOC,
+  // language, cover, CSS class table), stored in the extract directory
+  bool loadBookCache();
+  void saveBookCache();
 
   struct ManifestItem {
     String id;
@@ -192,6 +220,8 @@ class EpubReader {
 
   // Cover image href (relative to content.opf directory)
   String coverHref_;
+
+  bool loadedFromCache_ = false;
 };
 
 #endif
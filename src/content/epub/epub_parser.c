@@ -22,6 +22,8 @@ extern void arduino_file_close(void* handle);
 extern int arduino_file_seek(void* handle, long offset, int whence);
 extern long arduino_file_tell(void* handle);
 extern size_t arduino_file_read(void* ptr, size_t size, size_t count, void* handle);
+extern void* arduino_file_open_write(const char* path);
+extern size_t arduino_file_write(const void* ptr, size_t size, size_t count, void* handle);
 extern int arduino_get_free_heap(void);
 extern void arduino_log_memory(const char* msg);
 #endif
@@ -29,6 +31,14 @@ extern void arduino_log_memory(const char* msg);
 /* Default chunk size: 8KB */
 #define DEFAULT_CHUNK_SIZE (8 * 1024)
 
+/* Inflate checkpoints: one every 64KB of output by default */
+#define DEFAULT_CHECKPOINT_INTERVAL (64 * 1024)
+#define CHECKPOINT_MAGIC "EICP"
+#define CHECKPOINT_VERSION 1
+#define CHECKPOINT_HEADER_SIZE 32
+#define CHECKPOINT_COUNT_OFFSET 28
+#define CHECKPOINT_RECORD_SIZE (16 + sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE)
+
 /* ZIP local file header signature */
 #define ZIP_LOCAL_HEADER_SIG 0x04034b50
 #define ZIP_CENTRAL_HEADER_SIG 0x02014b50
@@ -46,12 +56,22 @@ extern void arduino_log_memory(const char* msg);
 #define EPUB_STATIC_TOTAL_SIZE (sizeof(tinfl_decompressor) + EPUB_STATIC_CHUNK_SIZE + TINFL_LZ_DICT_SIZE)
 static uint8_t* g_decomp_buffer = NULL;
 static size_t g_decomp_buffer_size = 0;
+// Claimed atomically: a background chapter conversion may stream one entry
+// while the foreground extracts another.
 static int g_decomp_buffer_in_use = 0;
+
+static int claim_shared_decomp_buffer(void) {
+  return __atomic_exchange_n(&g_decomp_buffer_in_use, 1, __ATOMIC_ACQUIRE) == 0;
+}
+
+static void release_shared_decomp_buffer(void) {
+  __atomic_store_n(&g_decomp_buffer_in_use, 0, __ATOMIC_RELEASE);
+}
 #endif
 
 #ifdef USE_ARDUINO_FILE
 void epub_release_shared_buffers(void) {
-  if (g_decomp_buffer_in_use) {
+  if (!claim_shared_decomp_buffer()) {
     return;
   }
   if (g_decomp_buffer) {
@@ -59,12 +79,55 @@ void epub_release_shared_buffers(void) {
     g_decomp_buffer = NULL;
     g_decomp_buffer_size = 0;
   }
+  release_shared_decomp_buffer();
 }
 #else
 void epub_release_shared_buffers(void) {
 }
 #endif
 
+/* Get a DEFLATE work block of total_size bytes. On device this is the shared
+ * static block when it is free; a second concurrent user gets a private heap
+ * block instead. *shared tells release_decomp_block() which one it was. */
+static uint8_t* acquire_decomp_block(size_t total_size, int* shared) {
+  *shared = 0;
+#ifdef USE_ARDUINO_FILE
+  if (total_size > EPUB_STATIC_TOTAL_SIZE) {
+    return NULL;
+  }
+  if (claim_shared_decomp_buffer()) {
+    if (!g_decomp_buffer || g_decomp_buffer_size < total_size) {
+      if (g_decomp_buffer) {
+        free(g_decomp_buffer);
+        g_decomp_buffer = NULL;
+        g_decomp_buffer_size = 0;
+      }
+      g_decomp_buffer = (uint8_t*)malloc(total_size);
+      if (!g_decomp_buffer) {
+        release_shared_decomp_buffer();
+        return NULL;
+      }
+      g_decomp_buffer_size = total_size;
+    }
+    *shared = 1;
+    return g_decomp_buffer;
+  }
+#endif
+  return (uint8_t*)malloc(total_size);
+}
+
+static void release_decomp_block(uint8_t* block, int shared) {
+#ifdef USE_ARDUINO_FILE
+  if (shared) {
+    release_shared_decomp_buffer();
+    return;
+  }
+#else
+  (void)shared;
+#endif
+  free(block);
+}
+
 /* File operation wrappers for Arduino compatibility */
 #ifdef USE_ARDUINO_FILE
 
@@ -74,6 +137,8 @@ void epub_release_shared_buffers(void) {
 #define file_seek_impl(handle, offset, whence) arduino_file_seek(handle, offset, whence)
 #define file_tell_impl(handle) arduino_file_tell(handle)
 #define file_read_impl(ptr, size, count, handle) arduino_file_read(ptr, size, count, handle)
+#define file_open_write_impl(path) arduino_file_open_write(path)
+#define file_write_impl(ptr, size, count, handle) arduino_file_write(ptr, size, count, handle)
 
 #else
 
@@ -83,6 +148,8 @@ void epub_release_shared_buffers(void) {
 #define file_seek_impl(handle, offset, whence) fseek(handle, offset, whence)
 #define file_tell_impl(handle) ftell(handle)
 #define file_read_impl(ptr, size, count, handle) fread(ptr, size, count, handle)
+#define file_open_write_impl(path) fopen(path, "wb")
+#define file_write_impl(ptr, size, count, handle) fwrite(ptr, size, count, handle)
 
 #endif
 
@@ -122,13 +189,17 @@ typedef struct {
 
 /* Minimal file entry in memory */
 typedef struct {
-  char* filename;
+  uint32_t name_offset; /* Offset of the NUL-terminated filename in reader->name_pool */
+  uint16_t name_len;
+  uint16_t compression;
   uint64_t compressed_size;
   uint64_t uncompressed_size;
   uint32_t local_header_offset;
-  uint16_t compression;
 } file_entry;
 
+/* Empty slot in the filename hash index (ZIP32 archives hold at most 65535 entries) */
+#define NAME_INDEX_EMPTY 0xFFFF
+
 /* EPUB reader structure */
 struct epub_reader {
 #ifdef USE_ARDUINO_FILE
@@ -138,6 +209,9 @@ struct epub_reader {
 #endif
   file_entry* files;
   uint32_t file_count;
+  char* name_pool;       /* All filenames, back to back, NUL-terminated */
+  uint16_t* name_index;  /* Open-addressing hash table of entry indices */
+  uint32_t name_index_mask;
   epub_error last_error;
 };
 
@@ -164,6 +238,18 @@ struct epub_stream_context {
   int done;                      /* 1 if decompression complete */
   int error;                     /* 1 if error occurred */
   int uses_shared_decomp_buffer; /* 1 if memory_block points to global g_decomp_buffer */
+
+  uint32_t data_offset; /* Archive offset of the entry's first data byte */
+  size_t out_pos;       /* Uncompressed bytes returned to the caller */
+  size_t out_produced;  /* Uncompressed bytes produced by the inflator */
+
+  /* Inflate checkpoints (DEFLATE only) */
+  char* cp_path;          /* Complete checkpoint file to resume from, or NULL */
+  uint32_t cp_count;      /* Checkpoints in cp_path */
+  FILE_HANDLE cp_writer;  /* Checkpoint file being recorded, or NULL */
+  uint32_t cp_interval;   /* Output bytes between checkpoints */
+  uint32_t cp_recorded;   /* Checkpoints written to cp_writer */
+  size_t cp_next;         /* Output offset of the next checkpoint to record */
 };
 
 /* Find end of central directory record */
@@ -191,101 +277,145 @@ static int find_end_central_dir(FILE_HANDLE fp, zip_end_central_dir* eocd) {
   return 0;
 }
 
-/* Read central directory and build file list */
+static const char* entry_name(const epub_reader* reader, const file_entry* entry) {
+  return reader->name_pool + entry->name_offset;
+}
+
+/* FNV-1a over a filename of known length */
+static uint32_t hash_name(const char* name, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t)name[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static void free_central_directory(epub_reader* reader) {
+  free(reader->files);
+  free(reader->name_pool);
+  free(reader->name_index);
+  reader->files = NULL;
+  reader->name_pool = NULL;
+  reader->name_index = NULL;
+  reader->file_count = 0;
+}
+
+/* Build the filename hash index (load factor <= 0.5). When a name occurs more
+ * than once the first entry wins, as with the old linear search. */
+static epub_error build_name_index(epub_reader* reader) {
+  uint32_t slots = 16;
+  while (slots < reader->file_count * 2) {
+    slots <<= 1;
+  }
+  reader->name_index = (uint16_t*)malloc(slots * sizeof(uint16_t));
+  if (!reader->name_index) {
+    return EPUB_ERROR_OUT_OF_MEMORY;
+  }
+  memset(reader->name_index, 0xFF, slots * sizeof(uint16_t));
+  reader->name_index_mask = slots - 1;
+
+  for (uint32_t i = 0; i < reader->file_count; i++) {
+    const file_entry* entry = &reader->files[i];
+    const char* name = entry_name(reader, entry);
+    uint32_t slot = hash_name(name, entry->name_len) & reader->name_index_mask;
+    while (reader->name_index[slot] != NAME_INDEX_EMPTY) {
+      const file_entry* other = &reader->files[reader->name_index[slot]];
+      if (other->name_len == entry->name_len && memcmp(entry_name(reader, other), name, entry->name_len) == 0) {
+        break;
+      }
+      slot = (slot + 1) & reader->name_index_mask;
+    }
+    if (reader->name_index[slot] == NAME_INDEX_EMPTY) {
+      reader->name_index[slot] = (uint16_t)i;
+    }
+  }
+  return EPUB_OK;
+}
+
+/* Read central directory and build file list. All filenames go into one
+ * string pool instead of a heap block each, which keeps thousands of small
+ * allocations (and the fragmentation they cause) off the device heap. */
 static epub_error read_central_directory(epub_reader* reader, zip_end_central_dir* eocd) {
-  reader->file_count = eocd->total_entries;
-  reader->files = (file_entry*)calloc(reader->file_count, sizeof(file_entry));
-  if (!reader->files) {
+#ifdef USE_ARDUINO_FILE
+  FILE_HANDLE fp = reader->file_handle;
+#else
+  FILE_HANDLE fp = reader->fp;
+#endif
+  const uint32_t count = eocd->total_entries;
+  const size_t header_size = sizeof(zip_central_dir_entry);
+  if ((uint64_t)count * header_size > eocd->central_dir_size) {
+    return EPUB_ERROR_CORRUPTED;
+  }
+  /* Upper bound for the names: the directory minus the fixed headers, plus a NUL per name */
+  const size_t pool_capacity = eocd->central_dir_size - count * header_size + count;
+
+  reader->file_count = count;
+  reader->files = (file_entry*)calloc(count ? count : 1, sizeof(file_entry));
+  reader->name_pool = (char*)malloc(pool_capacity ? pool_capacity : 1);
+  if (!reader->files || !reader->name_pool) {
+    free_central_directory(reader);
     return EPUB_ERROR_OUT_OF_MEMORY;
   }
 #ifdef USE_ARDUINO_FILE
   {
     char msg[128];
-    snprintf(msg, sizeof(msg), "  [MEM] read_central_directory: allocated files[%u], Free=%d",
-             (unsigned)reader->file_count, arduino_get_free_heap());
+    snprintf(msg, sizeof(msg), "  [MEM] read_central_directory: allocated files[%u] + %u byte name pool, Free=%d",
+             (unsigned)count, (unsigned)pool_capacity, arduino_get_free_heap());
     arduino_log_memory(msg);
   }
 #else
-  printf("  [MEM] read_central_directory: allocated files[%u]\n", (unsigned)reader->file_count);
+  printf("  [MEM] read_central_directory: allocated files[%u] + %u byte name pool\n", (unsigned)count,
+         (unsigned)pool_capacity);
 #endif
 
   /* Seek to central directory */
-#ifdef USE_ARDUINO_FILE
-  file_seek_impl(reader->file_handle, eocd->central_dir_offset, SEEK_SET);
-#else
-  file_seek_impl(reader->fp, eocd->central_dir_offset, SEEK_SET);
-#endif
+  file_seek_impl(fp, eocd->central_dir_offset, SEEK_SET);
 
   /* Read each entry */
-  const unsigned LOG_INTERVAL = 50;
-  size_t last_logged_free = 0;
-  for (uint32_t i = 0; i < reader->file_count; i++) {
+  size_t pool_used = 0;
+  for (uint32_t i = 0; i < count; i++) {
     zip_central_dir_entry entry;
-#ifdef USE_ARDUINO_FILE
-    if (file_read_impl(&entry, sizeof(zip_central_dir_entry), 1, reader->file_handle) != 1)
-#else
-    if (file_read_impl(&entry, sizeof(zip_central_dir_entry), 1, reader->fp) != 1)
-#endif
-    {
-      return EPUB_ERROR_CORRUPTED;
-    }
-
-    if (entry.signature != ZIP_CENTRAL_HEADER_SIG) {
+    if (file_read_impl(&entry, header_size, 1, fp) != 1 || entry.signature != ZIP_CENTRAL_HEADER_SIG ||
+        pool_used + entry.filename_len + 1 > pool_capacity) {
+      free_central_directory(reader);
       return EPUB_ERROR_CORRUPTED;
     }
 
-    /* Read filename */
-    char* filename = (char*)malloc(entry.filename_len + 1);
-    if (!filename) {
-      return EPUB_ERROR_OUT_OF_MEMORY;
-    }
-#ifdef USE_ARDUINO_FILE
-    {
-      int freeNow = arduino_get_free_heap();
-      if ((i % LOG_INTERVAL) == 0 || last_logged_free == 0 ||
-          (last_logged_free > freeNow && (last_logged_free - freeNow) > 4096)) {
-        char msg[128];
-        snprintf(msg, sizeof(msg),
-                 "  [MEM] read_central_directory: allocated filename buffer %u bytes for entry %u, Free=%d\n",
-                 (unsigned)(entry.filename_len + 1), (unsigned)i, freeNow);
-        arduino_log_memory(msg);
-        last_logged_free = freeNow;
-      }
-    }
-#else
-    if ((i % LOG_INTERVAL) == 0) {
-      printf("  [MEM] read_central_directory: allocated filename buffer %u bytes for entry %u\n",
-             (unsigned)(entry.filename_len + 1), (unsigned)i);
-    }
-#endif
-
-#ifdef USE_ARDUINO_FILE
-    if (file_read_impl(filename, 1, entry.filename_len, reader->file_handle) != entry.filename_len)
-#else
-    if (file_read_impl(filename, 1, entry.filename_len, reader->fp) != entry.filename_len)
-#endif
-    {
-      free(filename);
+    /* Read filename into the pool */
+    char* filename = reader->name_pool + pool_used;
+    if (file_read_impl(filename, 1, entry.filename_len, fp) != entry.filename_len) {
+      free_central_directory(reader);
       return EPUB_ERROR_CORRUPTED;
     }
     filename[entry.filename_len] = '\0';
 
     /* Skip extra field and comment */
-#ifdef USE_ARDUINO_FILE
-    file_seek_impl(reader->file_handle, entry.extra_len + entry.comment_len, SEEK_CUR);
-#else
-    file_seek_impl(reader->fp, entry.extra_len + entry.comment_len, SEEK_CUR);
-#endif
+    file_seek_impl(fp, entry.extra_len + entry.comment_len, SEEK_CUR);
 
     /* Store file info */
-    reader->files[i].filename = filename;
+    reader->files[i].name_offset = (uint32_t)pool_used;
+    reader->files[i].name_len = entry.filename_len;
     reader->files[i].compressed_size = entry.compressed_size;
     reader->files[i].uncompressed_size = entry.uncompressed_size;
     reader->files[i].local_header_offset = entry.local_header_offset;
     reader->files[i].compression = entry.compression;
+    pool_used += entry.filename_len + 1;
   }
 
-  return EPUB_OK;
+  /* Give back the space reserved for extra fields and comments */
+  if (pool_used > 0 && pool_used < pool_capacity) {
+    char* shrunk = (char*)realloc(reader->name_pool, pool_used);
+    if (shrunk) {
+      reader->name_pool = shrunk;
+    }
+  }
+
+  epub_error err = build_name_index(reader);
+  if (err != EPUB_OK) {
+    free_central_directory(reader);
+  }
+  return err;
 }
 
 /* -------------------- Public API -------------------- */
@@ -352,12 +482,7 @@ epub_error epub_open(const char* filepath, epub_reader** out_reader) {
 
 void epub_close(epub_reader* reader) {
   if (reader) {
-    if (reader->files) {
-      for (uint32_t i = 0; i < reader->file_count; i++) {
-        free(reader->files[i].filename);
-      }
-      free(reader->files);
-    }
+    free_central_directory(reader);
 #ifdef USE_ARDUINO_FILE
     if (reader->file_handle) {
       file_close_impl(reader->file_handle);
@@ -381,7 +506,7 @@ epub_error epub_get_file_info(epub_reader* reader, uint32_t index, epub_file_inf
   }
 
   file_entry* entry = &reader->files[index];
-  strncpy(info->filename, entry->filename, sizeof(info->filename) - 1);
+  strncpy(info->filename, entry_name(reader, entry), sizeof(info->filename) - 1);
   info->filename[sizeof(info->filename) - 1] = '\0';
   info->compressed_size = entry->compressed_size;
   info->uncompressed_size = entry->uncompressed_size;
@@ -396,11 +521,20 @@ epub_error epub_locate_file(epub_reader* reader, const char* filename, uint32_t*
     return EPUB_ERROR_INVALID_PARAM;
   }
 
-  for (uint32_t i = 0; i < reader->file_count; i++) {
-    if (strcmp(reader->files[i].filename, filename) == 0) {
+  if (!reader->name_index) {
+    return EPUB_ERROR_FILE_NOT_IN_ARCHIVE;
+  }
+
+  const size_t len = strlen(filename);
+  uint32_t slot = hash_name(filename, len) & reader->name_index_mask;
+  while (reader->name_index[slot] != NAME_INDEX_EMPTY) {
+    const uint32_t i = reader->name_index[slot];
+    const file_entry* entry = &reader->files[i];
+    if (entry->name_len == len && memcmp(entry_name(reader, entry), filename, len) == 0) {
       *out_index = i;
       return EPUB_OK;
     }
+    slot = (slot + 1) & reader->name_index_mask;
   }
 
   return EPUB_ERROR_FILE_NOT_IN_ARCHIVE;
@@ -507,29 +641,12 @@ epub_error epub_extract_streaming(epub_reader* reader, uint32_t file_index, epub
     size_t total_size = sizeof(tinfl_decompressor) + chunk_size + TINFL_LZ_DICT_SIZE;
     printf("  [MEM] epub_start_streaming: attempting alloc total_size=%u\n", (unsigned)total_size);
 #endif
-    uint8_t* memory_block = NULL;
-#ifdef USE_ARDUINO_FILE
-    if (total_size > EPUB_STATIC_TOTAL_SIZE) {
-      return EPUB_ERROR_OUT_OF_MEMORY;
-    }
-    if (!g_decomp_buffer || g_decomp_buffer_size < total_size) {
-      if (g_decomp_buffer) {
-        free(g_decomp_buffer);
-        g_decomp_buffer = NULL;
-        g_decomp_buffer_size = 0;
-      }
-      g_decomp_buffer = (uint8_t*)malloc(total_size);
-      if (!g_decomp_buffer) {
-        return EPUB_ERROR_OUT_OF_MEMORY;
-      }
-      g_decomp_buffer_size = total_size;
-    }
-    memory_block = g_decomp_buffer;
-#else
-    memory_block = (uint8_t*)malloc(total_size);
+    int shared_block = 0;
+    uint8_t* memory_block = acquire_decomp_block(total_size, &shared_block);
     if (!memory_block) {
       return EPUB_ERROR_OUT_OF_MEMORY;
     }
+#ifndef USE_ARDUINO_FILE
     printf("  [MEM] epub_extract_streaming: allocated memory_block total_size=%u\n", (unsigned)total_size);
 #endif
 
@@ -555,9 +672,7 @@ epub_error epub_extract_streaming(epub_reader* reader, uint32_t file_index, epub
         size_t to_read = (in_remaining < chunk_size) ? in_remaining : chunk_size;
         in_buf_size = file_read_impl(in_buf, 1, to_read, fp);
         if (in_buf_size == 0) {
-#ifndef USE_ARDUINO_FILE
-          free(memory_block);
-#endif
+          release_decomp_block(memory_block, shared_block);
           return EPUB_ERROR_EXTRACTION_FAILED;
         }
         in_remaining -= in_buf_size;
@@ -582,27 +697,19 @@ epub_error epub_extract_streaming(epub_reader* reader, uint32_t file_index, epub
       if (out_bytes > 0) {
         int cb_result = callback(dict + dict_ofs, out_bytes, user_data);
         if (cb_result == 0) {
-#ifndef USE_ARDUINO_FILE
-          free(memory_block);
-#endif
+          release_decomp_block(memory_block, shared_block);
           return EPUB_ERROR_EXTRACTION_FAILED;
         }
         dict_ofs = (dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
       }
 
       if (status < TINFL_STATUS_DONE) {
-#ifndef USE_ARDUINO_FILE
-        free(memory_block);
-#endif
+        release_decomp_block(memory_block, shared_block);
         return EPUB_ERROR_EXTRACTION_FAILED;
       }
     }
 
-#ifdef USE_ARDUINO_FILE
-    /* Static buffer - nothing to free */
-#else
-    free(memory_block);
-#endif
+    release_decomp_block(memory_block, shared_block);
     return EPUB_OK;
   }
   return EPUB_ERROR_EXTRACTION_FAILED;
@@ -610,6 +717,42 @@ epub_error epub_extract_streaming(epub_reader* reader, uint32_t file_index, epub
 
 /* -------------------- Pull-based Streaming API -------------------- */
 
+epub_error epub_get_stored_range(epub_reader* reader, uint32_t file_index, uint32_t* data_offset, uint32_t* size) {
+  if (!reader || !data_offset || !size || file_index >= reader->file_count) {
+    return EPUB_ERROR_INVALID_PARAM;
+  }
+
+  file_entry* entry = &reader->files[file_index];
+  if (entry->compression != 0 || entry->uncompressed_size != entry->compressed_size ||
+      entry->uncompressed_size > 0xFFFFFFFFu) {
+    return EPUB_ERROR_INVALID_PARAM;
+  }
+
+#ifdef USE_ARDUINO_FILE
+  FILE_HANDLE fp = reader->file_handle;
+#else
+  FILE_HANDLE fp = reader->fp;
+#endif
+
+  /* The data starts after the local header, whose name/extra lengths can differ from the central directory */
+  uint8_t header[30];
+  file_seek_impl(fp, entry->local_header_offset, SEEK_SET);
+  if (file_read_impl(header, 1, sizeof(header), fp) != sizeof(header)) {
+    return EPUB_ERROR_CORRUPTED;
+  }
+  const uint32_t sig = (uint32_t)header[0] | ((uint32_t)header[1] << 8) | ((uint32_t)header[2] << 16) |
+                       ((uint32_t)header[3] << 24);
+  if (sig != ZIP_LOCAL_HEADER_SIG) {
+    return EPUB_ERROR_CORRUPTED;
+  }
+  const uint16_t filename_len = (uint16_t)(header[26] | (header[27] << 8));
+  const uint16_t extra_len = (uint16_t)(header[28] | (header[29] << 8));
+
+  *data_offset = entry->local_header_offset + (uint32_t)sizeof(header) + filename_len + extra_len;
+  *size = (uint32_t)entry->uncompressed_size;
+  return EPUB_OK;
+}
+
 epub_stream_context* epub_start_streaming(epub_reader* reader, uint32_t file_index, size_t chunk_size) {
   if (!reader || file_index >= reader->file_count) {
     return NULL;
@@ -683,45 +826,18 @@ epub_stream_context* epub_start_streaming(epub_reader* reader, uint32_t file_ind
   file_read_impl(&extra_len, 2, 1, fp);
 
   file_seek_impl(fp, filename_len + extra_len, SEEK_CUR);
+  ctx->data_offset = entry->local_header_offset + 30 + filename_len + extra_len;
 
   /* Now at compressed data */
 
   if (entry->compression == 8) {
     /* DEFLATE - allocate decompression buffers */
     size_t total_size = sizeof(tinfl_decompressor) + chunk_size + TINFL_LZ_DICT_SIZE;
-#ifdef USE_ARDUINO_FILE
-    if (total_size > EPUB_STATIC_TOTAL_SIZE) {
-      free(ctx);
-      return NULL;
-    }
-    if (g_decomp_buffer_in_use) {
-      free(ctx);
-      return NULL;
-    }
-    if (!g_decomp_buffer || g_decomp_buffer_size < total_size) {
-      if (g_decomp_buffer) {
-        free(g_decomp_buffer);
-        g_decomp_buffer = NULL;
-        g_decomp_buffer_size = 0;
-      }
-      g_decomp_buffer = (uint8_t*)malloc(total_size);
-      if (!g_decomp_buffer) {
-        free(ctx);
-        return NULL;
-      }
-      g_decomp_buffer_size = total_size;
-    }
-    ctx->memory_block = g_decomp_buffer;
-    ctx->uses_shared_decomp_buffer = 1;
-    g_decomp_buffer_in_use = 1;
-#else
-    ctx->memory_block = (uint8_t*)malloc(total_size);
+    ctx->memory_block = acquire_decomp_block(total_size, &ctx->uses_shared_decomp_buffer);
     if (!ctx->memory_block) {
       free(ctx);
       return NULL;
     }
-    ctx->uses_shared_decomp_buffer = 0;
-#endif
 
     /* Partition the block */
     ctx->inflator = (tinfl_decompressor*)ctx->memory_block;
@@ -753,7 +869,37 @@ epub_stream_context* epub_start_streaming(epub_reader* reader, uint32_t file_ind
   return ctx;
 }
 
-int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size) {
+/* Append a checkpoint for the inflator state right after it produced
+ * ctx->out_produced bytes; dict_ofs is the dictionary write offset at that point.
+ * The tinfl_decompressor struct holds the whole coroutine state, including the
+ * bit buffer and Huffman tables, so it is saved verbatim next to the window. */
+static void record_checkpoint(epub_stream_context* ctx, size_t dict_ofs) {
+  const uint32_t fields[4] = {
+      (uint32_t)ctx->out_produced,
+      (uint32_t)(ctx->entry->compressed_size - ctx->in_remaining - (ctx->in_buf_size - ctx->in_buf_ofs)),
+      (uint32_t)dict_ofs, (uint32_t)ctx->status};
+  if (file_write_impl(fields, sizeof(fields), 1, ctx->cp_writer) != 1 ||
+      file_write_impl(ctx->inflator, sizeof(tinfl_decompressor), 1, ctx->cp_writer) != 1 ||
+      file_write_impl(ctx->dict, TINFL_LZ_DICT_SIZE, 1, ctx->cp_writer) != 1) {
+    /* Leave the file incomplete so it is never used */
+    file_close_impl(ctx->cp_writer);
+    ctx->cp_writer = NULL;
+    return;
+  }
+  ctx->cp_recorded++;
+  ctx->cp_next = ctx->out_produced + ctx->cp_interval;
+}
+
+/* Mark the checkpoint file complete by writing its count */
+static void finish_checkpoints(epub_stream_context* ctx) {
+  if (file_seek_impl(ctx->cp_writer, CHECKPOINT_COUNT_OFFSET, SEEK_SET) == 0) {
+    file_write_impl(&ctx->cp_recorded, 4, 1, ctx->cp_writer);
+  }
+  file_close_impl(ctx->cp_writer);
+  ctx->cp_writer = NULL;
+}
+
+static int read_chunk_impl(epub_stream_context* ctx, void* buffer, size_t max_size) {
   if (!ctx || ctx->error) {
     return -1;
   }
@@ -853,6 +999,12 @@ int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size) {
                                          ctx->dict + ctx->dict_ofs, &out_bytes, flags);
 
       ctx->in_buf_ofs += in_bytes;
+      ctx->out_produced += out_bytes;
+
+      if (ctx->cp_writer && ctx->out_produced >= ctx->cp_next &&
+          (ctx->status == TINFL_STATUS_NEEDS_MORE_INPUT || ctx->status == TINFL_STATUS_HAS_MORE_OUTPUT)) {
+        record_checkpoint(ctx, (ctx->dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1));
+      }
 
       if (out_bytes > 0) {
         /* Copy decompressed data to output buffer */
@@ -886,6 +1038,11 @@ int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size) {
       }
     }
 
+    /* The inflator can finish on a call whose output did not all fit */
+    if (ctx->cp_writer && ctx->status == TINFL_STATUS_DONE) {
+      finish_checkpoints(ctx);
+    }
+
     return (int)output_ofs;
   }
 
@@ -893,19 +1050,200 @@ int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size) {
   return -1;
 }
 
+int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size) {
+  const int n = read_chunk_impl(ctx, buffer, max_size);
+  if (n > 0) {
+    ctx->out_pos += (size_t)n;
+  }
+  return n;
+}
+
+epub_error epub_stream_set_checkpoints(epub_stream_context* ctx, const char* path, size_t interval) {
+  if (!ctx || !path || ctx->entry->compression != 8 || ctx->cp_path || ctx->cp_writer) {
+    return EPUB_ERROR_INVALID_PARAM;
+  }
+
+  const uint32_t expected[7] = {CHECKPOINT_VERSION,
+                                ctx->entry->local_header_offset,
+                                (uint32_t)ctx->entry->compressed_size,
+                                (uint32_t)ctx->entry->uncompressed_size,
+                                (uint32_t)sizeof(tinfl_decompressor),
+                                0,
+                                0};
+
+  /* Use an existing complete file built for this entry */
+  FILE_HANDLE in = file_open_impl(path);
+  if (in) {
+    char magic[4];
+    uint32_t fields[7];
+    const int ok = file_read_impl(magic, 4, 1, in) == 1 && file_read_impl(fields, sizeof(fields), 1, in) == 1 &&
+                   memcmp(magic, CHECKPOINT_MAGIC, 4) == 0 && memcmp(fields, expected, 5 * sizeof(uint32_t)) == 0 &&
+                   fields[6] != 0xFFFFFFFFu;
+    file_close_impl(in);
+    if (ok) {
+      const size_t len = strlen(path);
+      ctx->cp_path = (char*)malloc(len + 1);
+      if (!ctx->cp_path) {
+        return EPUB_ERROR_OUT_OF_MEMORY;
+      }
+      memcpy(ctx->cp_path, path, len + 1);
+      ctx->cp_count = fields[6];
+      return EPUB_OK;
+    }
+  }
+
+  /* Otherwise record one, which is only possible from the start of the stream.
+   * Entries no longer than one interval have nothing to checkpoint. */
+  if (ctx->out_produced != 0) {
+    return EPUB_ERROR_INVALID_PARAM;
+  }
+  if (interval == 0) {
+    interval = DEFAULT_CHECKPOINT_INTERVAL;
+  }
+  if (ctx->entry->uncompressed_size <= interval) {
+    return EPUB_OK;
+  }
+  ctx->cp_writer = file_open_write_impl(path);
+  if (!ctx->cp_writer) {
+    return EPUB_ERROR_FILE_NOT_FOUND;
+  }
+  uint32_t header[7];
+  memcpy(header, expected, sizeof(header));
+  header[5] = (uint32_t)interval;
+  header[6] = 0xFFFFFFFFu; /* Incomplete until the stream ends */
+  if (file_write_impl(CHECKPOINT_MAGIC, 4, 1, ctx->cp_writer) != 1 ||
+      file_write_impl(header, sizeof(header), 1, ctx->cp_writer) != 1) {
+    file_close_impl(ctx->cp_writer);
+    ctx->cp_writer = NULL;
+    return EPUB_ERROR_EXTRACTION_FAILED;
+  }
+  ctx->cp_interval = header[5];
+  ctx->cp_recorded = 0;
+  ctx->cp_next = ctx->cp_interval;
+  return EPUB_OK;
+}
+
+/* Restore the inflator to checkpoint `index` of ctx->cp_path */
+static int restore_checkpoint(epub_stream_context* ctx, FILE_HANDLE in, uint32_t index) {
+  uint32_t fields[4];
+  if (file_seek_impl(in, (long)(CHECKPOINT_HEADER_SIZE + (size_t)index * CHECKPOINT_RECORD_SIZE), SEEK_SET) != 0 ||
+      file_read_impl(fields, sizeof(fields), 1, in) != 1 ||
+      file_read_impl(ctx->inflator, sizeof(tinfl_decompressor), 1, in) != 1 ||
+      file_read_impl(ctx->dict, TINFL_LZ_DICT_SIZE, 1, in) != 1 || fields[1] > ctx->entry->compressed_size) {
+    return 0;
+  }
+  ctx->out_pos = fields[0];
+  ctx->out_produced = fields[0];
+  ctx->in_remaining = ctx->entry->compressed_size - fields[1];
+  ctx->dict_ofs = fields[2] & (TINFL_LZ_DICT_SIZE - 1);
+  ctx->status = (tinfl_status)(int32_t)fields[3];
+  return 1;
+}
+
+int epub_seek_stream(epub_stream_context* ctx, size_t uncompressed_offset) {
+  if (!ctx || uncompressed_offset > ctx->entry->uncompressed_size) {
+    return -1;
+  }
+
+#ifdef USE_ARDUINO_FILE
+  FILE_HANDLE fp = ctx->reader->file_handle;
+#else
+  FILE_HANDLE fp = ctx->reader->fp;
+#endif
+
+  if (ctx->entry->compression == 0) {
+    if (file_seek_impl(fp, (long)(ctx->data_offset + uncompressed_offset), SEEK_SET) != 0) {
+      return -1;
+    }
+    ctx->in_remaining = ctx->entry->uncompressed_size - uncompressed_offset;
+    ctx->out_pos = uncompressed_offset;
+    ctx->done = ctx->in_remaining == 0;
+    ctx->error = 0;
+    return 0;
+  }
+
+  if (ctx->error || uncompressed_offset < ctx->out_pos) {
+    /* Going backwards abandons a recording: its checkpoints would repeat */
+    if (ctx->cp_writer) {
+      file_close_impl(ctx->cp_writer);
+      ctx->cp_writer = NULL;
+    }
+  }
+
+  /* Nearest checkpoint at or before the target */
+  FILE_HANDLE in = NULL;
+  uint32_t best = 0xFFFFFFFFu;
+  uint32_t best_offset = 0;
+  if (ctx->cp_path && ctx->cp_count > 0) {
+    in = file_open_impl(ctx->cp_path);
+    for (uint32_t i = 0; in && i < ctx->cp_count; i++) {
+      uint32_t out_offset;
+      if (file_seek_impl(in, (long)(CHECKPOINT_HEADER_SIZE + (size_t)i * CHECKPOINT_RECORD_SIZE), SEEK_SET) != 0 ||
+          file_read_impl(&out_offset, 4, 1, in) != 1 || out_offset > uncompressed_offset) {
+        break;
+      }
+      best = i;
+      best_offset = out_offset;
+    }
+  }
+
+  const int behind = ctx->error || uncompressed_offset < ctx->out_pos;
+  if (behind || (best != 0xFFFFFFFFu && best_offset > ctx->out_pos)) {
+    int restored = best != 0xFFFFFFFFu && restore_checkpoint(ctx, in, best);
+    if (!restored) {
+      /* Restart from the beginning of the entry */
+      tinfl_init(ctx->inflator);
+      ctx->out_pos = 0;
+      ctx->out_produced = 0;
+      ctx->in_remaining = ctx->entry->compressed_size;
+      ctx->dict_ofs = 0;
+      ctx->status = TINFL_STATUS_NEEDS_MORE_INPUT;
+    }
+    ctx->in_buf_size = 0;
+    ctx->in_buf_ofs = 0;
+    ctx->dict_read_ofs = ctx->dict_ofs;
+    ctx->dict_avail = 0;
+    ctx->done = 0;
+    ctx->error = 0;
+    if (file_seek_impl(fp, (long)(ctx->data_offset + ctx->entry->compressed_size - ctx->in_remaining), SEEK_SET) !=
+        0) {
+      ctx->error = 1;
+    }
+  }
+  if (in) {
+    file_close_impl(in);
+  }
+  if (ctx->error) {
+    return -1;
+  }
+
+  /* Inflate and discard up to the target */
+  uint8_t scratch[256];
+  while (ctx->out_pos < uncompressed_offset) {
+    const size_t remaining = uncompressed_offset - ctx->out_pos;
+    if (epub_read_chunk(ctx, scratch, remaining < sizeof(scratch) ? remaining : sizeof(scratch)) <= 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+size_t epub_stream_tell(epub_stream_context* ctx) {
+  return ctx ? ctx->out_pos : 0;
+}
+
 void epub_end_streaming(epub_stream_context* ctx) {
   if (!ctx) {
     return;
   }
-#ifdef USE_ARDUINO_FILE
-  if (ctx->uses_shared_decomp_buffer) {
-    g_decomp_buffer_in_use = 0;
-  }
-#else
   if (ctx->memory_block) {
-    free(ctx->memory_block);
+    release_decomp_block(ctx->memory_block, ctx->uses_shared_decomp_buffer);
   }
-#endif
+  if (ctx->cp_writer) {
+    /* Stopped before the end: the recording stays incomplete and unused */
+    file_close_impl(ctx->cp_writer);
+  }
+  free(ctx->cp_path);
   free(ctx);
 }
 
@@ -64,6 +64,12 @@ epub_error epub_locate_file(epub_reader* reader, const char* filename, uint32_t*
 epub_error epub_extract_streaming(epub_reader* reader, uint32_t file_index, epub_data_callback callback,
                                   void* user_data, size_t chunk_size);
 
+/* Locate the raw data of a stored (uncompressed) file inside the archive
+ * On success, data_offset is the absolute offset of the first byte of file data
+ * and size its length; fails with EPUB_ERROR_INVALID_PARAM for compressed files
+ */
+epub_error epub_get_stored_range(epub_reader* reader, uint32_t file_index, uint32_t* data_offset, uint32_t* size);
+
 /* -------------------- Pull-based Streaming API -------------------- */
 
 /* Opaque streaming context for pull-based extraction */
@@ -82,6 +88,27 @@ epub_stream_context* epub_start_streaming(epub_reader* reader, uint32_t file_ind
  */
 int epub_read_chunk(epub_stream_context* ctx, void* buffer, size_t max_size);
 
+/* Use or record inflate checkpoints for a DEFLATE stream
+ * If `path` holds complete checkpoints for this entry, epub_seek_stream()
+ * resumes from the nearest one. Otherwise, before the first read, checkpoints
+ * are recorded to `path` every `interval` bytes of output (0 for 64KB) while
+ * streaming; the file becomes usable once the stream reaches its end. Entries
+ * no longer than one interval record nothing and seek from their start.
+ * Each checkpoint stores the inflator state (including its bit buffer) and the
+ * 32KB window, so the file is only valid for the firmware that wrote it.
+ */
+epub_error epub_stream_set_checkpoints(epub_stream_context* ctx, const char* path, size_t interval);
+
+/* Move the stream to an uncompressed offset; the next read starts there
+ * DEFLATE streams resume from the nearest checkpoint at or before the offset
+ * (or the start of the entry) and inflate forward from there.
+ * Returns 0 on success, -1 on error
+ */
+int epub_seek_stream(epub_stream_context* ctx, size_t uncompressed_offset);
+
+/* Uncompressed offset of the next byte epub_read_chunk() returns */
+size_t epub_stream_tell(epub_stream_context* ctx);
+
 /* End streaming and free context */
 void epub_end_streaming(epub_stream_context* ctx);
 
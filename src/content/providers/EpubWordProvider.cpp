@@ -5,10 +5,34 @@
 #include <ctype.h>
 
 #include <cstdint>
+#include <cstring>
+#include <utility>
 #include <vector>
 
+#include "../xml/HtmlEntities.h"
+
 // #define EPUB_DEBUG_CLEAN_CACHE
 
+// Chapter prefetch tuning: the worker yields after this many parser nodes and
+// skips prefetching when the heap is too low to hold a second parser.
+static constexpr int PREFETCH_YIELD_EVERY_NODES = 32;
+static constexpr uint32_t PREFETCH_MIN_FREE_HEAP = 64 * 1024;
+
+// Whole-book container file in the EPUB's extract directory
+static const char* BOOK_CONTAINER_FILENAME = "book.bin";
+
+// Style-run mode output: plain text next to its run table
+static const char* PLAIN_TXT_EXTENSION = ".plain.txt";
+static const char* STYLE_RUNS_SUFFIX = ".runs";
+
+// Conversion statistics: free heap is sampled every this many parser nodes
+static constexpr int HEAP_SAMPLE_EVERY_NODES = 64;
+
+// Input bytes per second for a conversion that took `ms` milliseconds
+static uint32_t conversionRate(size_t bytes, unsigned long ms) {
+  return (uint32_t)((uint64_t)bytes * 1000 / (ms > 0 ? ms : 1));
+}
+
 // Helper function to map language string to Language enum
 static Language stringToLanguage(const String& langStr) {
   String lang = langStr;
@@ -36,6 +60,10 @@ String EpubWordProvider::getChapterName(int chapterIndex) {
 
 EpubWordProvider::EpubWordProvider(const char* path, size_t bufSize)
     : bufSize_(bufSize), fileSize_(0), currentChapter_(0) {
+#ifdef ARDUINO
+  conversionLock_ = xSemaphoreCreateMutex();
+  prefetchExited_ = xSemaphoreCreateBinary();
+#endif
   epubPath_ = String(path);
   valid_ = false;
   isEpub_ = false;
@@ -107,6 +135,8 @@ EpubWordProvider::EpubWordProvider(const char* path, size_t bufSize)
 }
 
 EpubWordProvider::~EpubWordProvider() {
+  cancelPrefetch(-1);
+  waitForPrefetchWorker();
   if (parser_) {
     parser_->close();
     delete parser_;
@@ -118,6 +148,16 @@ EpubWordProvider::~EpubWordProvider() {
     delete fileProvider_;
     fileProvider_ = nullptr;
   }
+#ifdef ARDUINO
+  if (conversionLock_) {
+    vSemaphoreDelete(conversionLock_);
+    conversionLock_ = nullptr;
+  }
+  if (prefetchExited_) {
+    vSemaphoreDelete(prefetchExited_);
+    prefetchExited_ = nullptr;
+  }
+#endif
 }
 
 bool EpubWordProvider::createDirRecursive(const String& path) {
@@ -132,46 +172,65 @@ bool EpubWordProvider::createDirRecursive(const String& path) {
   return SD.mkdir(path.c_str());
 }
 
-bool EpubWordProvider::isBlockElement(const String& name) {
-  // List of elements we want to treat as paragraph/line-break boundaries.
-  // Narrowed to elements that actually cause visual line breaks in typical HTML.
-  if (name == "p" || name == "div" || name == "h1" || name == "h2" || name == "h3" || name == "h4" || name == "h5" ||
-      name == "h6" || name == "blockquote" || name == "li" || name == "section" || name == "article" ||
-      name == "header" || name == "footer" || name == "nav") {
-    return true;
-  }
-  return false;
+// Header elements that should have newlines after them
+static constexpr uint32_t HEADER_TAGS = xmlTagBit(XmlTag::H1) | xmlTagBit(XmlTag::H2) | xmlTagBit(XmlTag::H3) |
+                                        xmlTagBit(XmlTag::H4) | xmlTagBit(XmlTag::H5) | xmlTagBit(XmlTag::H6);
+// Elements we want to treat as paragraph/line-break boundaries.
+// Narrowed to elements that actually cause visual line breaks in typical HTML.
+static constexpr uint32_t BLOCK_TAGS = xmlTagBit(XmlTag::P) | xmlTagBit(XmlTag::Div) | HEADER_TAGS |
+                                       xmlTagBit(XmlTag::Blockquote) | xmlTagBit(XmlTag::Li) |
+                                       xmlTagBit(XmlTag::Section) | xmlTagBit(XmlTag::Article) |
+                                       xmlTagBit(XmlTag::Header) | xmlTagBit(XmlTag::Footer) | xmlTagBit(XmlTag::Nav);
+// Elements whose content should be skipped entirely
+static constexpr uint32_t SKIPPED_TAGS =
+    xmlTagBit(XmlTag::Head) | xmlTagBit(XmlTag::Title) | xmlTagBit(XmlTag::Style) | xmlTagBit(XmlTag::Script);
+// Inline elements that can apply bold/italic styling to text
+static constexpr uint32_t INLINE_STYLE_TAGS = xmlTagBit(XmlTag::B) | xmlTagBit(XmlTag::Strong) |
+                                              xmlTagBit(XmlTag::I) | xmlTagBit(XmlTag::Em) | xmlTagBit(XmlTag::Span);
+
+bool EpubWordProvider::isBlockElement(XmlTag tag) {
+  return (BLOCK_TAGS & xmlTagBit(tag)) != 0;
 }
 
-bool EpubWordProvider::isSkippedElement(const String& name) {
-  // Elements whose content should be skipped entirely
-  return name == "head" || name == "title" || name == "style" || name == "script";
+bool EpubWordProvider::isSkippedElement(XmlTag tag) {
+  return (SKIPPED_TAGS & xmlTagBit(tag)) != 0;
 }
 
-bool EpubWordProvider::isHeaderElement(const String& name) {
-  // Header elements that should have newlines after them
-  return name == "h1" || name == "h2" || name == "h3" || name == "h4" || name == "h5" || name == "h6";
+bool EpubWordProvider::isHeaderElement(XmlTag tag) {
+  return (HEADER_TAGS & xmlTagBit(tag)) != 0;
 }
 
-bool EpubWordProvider::isInlineStyleElement(const String& name) {
-  // Inline elements that can apply bold/italic styling to text
-  return name == "b" || name == "strong" || name == "i" || name == "em" || name == "span";
+bool EpubWordProvider::isInlineStyleElement(XmlTag tag) {
+  return (INLINE_STYLE_TAGS & xmlTagBit(tag)) != 0;
 }
 
-bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPath, ConversionTimings* timings) {
-  if (srcPath.isEmpty())
-    return false;
+// Copy an attribute of the current element into a String that is reused
+// between elements, so it keeps its capacity instead of reallocating
+static void assignAttribute(const SimpleXmlParser& parser, const char* name, String& out) {
+  const char* value = parser.findAttribute(name);
+  out = value ? value : "";
+}
 
-  // Create output path by replacing extension with .txt
-  String dest = srcPath;
+String EpubWordProvider::getConvertedTxtPath(const String& xhtmlPath) const {
+  String dest = xhtmlPath;
   int lastDot = dest.lastIndexOf('.');
   if (lastDot >= 0) {
     dest = dest.substring(0, lastDot);
   }
-  dest += ".txt";
+  dest += useStyleRuns_ ? PLAIN_TXT_EXTENSION : ".txt";
+  return dest;
+}
+
+bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPath, ConversionTimings* timings) {
+  if (srcPath.isEmpty())
+    return false;
+
+  // Create output path by replacing extension with .txt
+  String dest = getConvertedTxtPath(srcPath);
+  const String runsPath = dest + STYLE_RUNS_SUFFIX;
 
   // If the TXT file already exists and is non-empty, reuse it and skip conversion
-  if (SD.exists(dest.c_str())) {
+  if (SD.exists(dest.c_str()) && (!useStyleRuns_ || SD.exists(runsPath.c_str()))) {
     File chk = SD.open(dest.c_str());
     if (chk) {
       size_t sz = chk.size();
@@ -185,6 +244,8 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
           timings->parserClose = 0;
           timings->closeOut = 0;
           timings->bytes = sz;
+          timings->bytesPerSecond = 0;
+          timings->peakHeap = 0;
         }
         Serial.printf("  Reusing existing TXT: %s  —  %u bytes\n", dest.c_str(), (unsigned)sz);
         outTxtPath = dest;
@@ -200,6 +261,8 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
   }
 
   // Open input and output files
+  const uint32_t heapAtStart = ESP.getFreeHeap();
+  uint32_t minFreeHeap = heapAtStart;
   SimpleXmlParser parser;
   unsigned long totalStartMs = millis();
   unsigned long t0 = millis();
@@ -220,13 +283,31 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
   if (timings)
     timings->outOpen = outOpenMs;
 
-  // Perform the conversion using common logic
+  // Perform the conversion using common logic. Runs are appended to their
+  // file as they are produced.
   t0 = millis();
   size_t bytesWritten = 0;
-  performXhtmlToTxtConversion(parser, out, &bytesWritten);
+  File runsOut;
+  if (useStyleRuns_) {
+    runsOut = SD.open(runsPath.c_str(), FILE_WRITE);
+    if (!runsOut) {
+      Serial.printf("ERROR: Failed to open style runs '%s' for writing\n", runsPath.c_str());
+      out.close();
+      parser.close();
+      SD.remove(dest.c_str());
+      return false;
+    }
+  }
+  StyleRunEncoder styleRuns(runsOut);
+  performXhtmlToTxtConversion(parser, out, &bytesWritten, useStyleRuns_ ? &styleRuns : nullptr, &minFreeHeap);
   unsigned long conversionMs = millis() - t0;
-  if (timings)
+  const uint32_t bytesPerSecond = conversionRate(parser.getFileSize(), conversionMs);
+  const uint32_t peakHeap = heapAtStart - minFreeHeap;
+  if (timings) {
     timings->conversion = conversionMs;
+    timings->bytesPerSecond = bytesPerSecond;
+    timings->peakHeap = peakHeap;
+  }
 
   // Cleanup and close (timed)
   t0 = millis();
@@ -236,6 +317,16 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
     timings->parserClose = parserCloseMs;
   t0 = millis();
   out.close();
+  if (useStyleRuns_) {
+    const bool runsOk = styleRuns.finish();
+    runsOut.close();
+    if (!runsOk) {
+      Serial.printf("ERROR: Failed to write style runs '%s'\n", runsPath.c_str());
+      SD.remove(runsPath.c_str());
+      SD.remove(dest.c_str());
+      return false;
+    }
+  }
   unsigned long closeOutMs = millis() - t0;
   if (timings)
     timings->closeOut = closeOutMs;
@@ -247,13 +338,15 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
   Serial.printf(
       "Converted XHTML to TXT: %s  —  total = %lu ms  ( parserOpen = %lu, outOpen = %lu, conversion = %lu, parserClose "
       "= %lu, "
-      "closeOut = %lu )\n",
-      dest.c_str(), totalMs, parserOpenMs, outOpenMs, conversionMs, parserCloseMs, closeOutMs);
+      "closeOut = %lu )  —  %u bytes/s, peak heap %u bytes\n",
+      dest.c_str(), totalMs, parserOpenMs, outOpenMs, conversionMs, parserCloseMs, closeOutMs, (unsigned)bytesPerSecond,
+      (unsigned)peakHeap);
   outTxtPath = dest;
   return true;
 }
 
-void EpubWordProvider::writeParagraphStyleToken(String& writeBuffer, const String& pendingParagraphClasses,
+void EpubWordProvider::writeParagraphStyleToken(TxtOutputBuffer& writeBuffer,
+                                                const String& pendingParagraphClasses,
                                                 const String& pendingInlineStyle, bool& paragraphClassesWritten,
                                                 std::vector<char>& paragraphStyleEmitted) {
   // If this is the beginning of a paragraph and styles haven't been written yet,
@@ -342,13 +435,21 @@ void EpubWordProvider::writeParagraphStyleToken(String& writeBuffer, const Strin
   }
 }
 
-void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes) {
-  const size_t FLUSH_THRESHOLD = 2048;
+bool EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes,
+                                                   StyleRunEncoder* styleRuns, uint32_t* minFreeHeap) {
   if (outBytes)
     *outBytes = 0;
 
-  String buffer;                     // Output buffer
-  std::vector<String> elementStack;  // Track nested elements
+  TxtOutputBuffer buffer(out, styleRuns);  // Output ring, written to `out` a sector at a time
+  if (!buffer.isValid()) {
+    return false;
+  }
+  // Open elements as a stack of tag sets: each level holds the tags of that
+  // element and all of its ancestors, so "inside <head>/<style>/..." is one test
+  std::vector<uint32_t> openTags;
+  openTags.reserve(32);
+  String inlineClassAttr;  // Attributes of the current inline element
+  String inlineStyleAttr;
   // Track inline style element stack (store per-element flags in object state)
   std::vector<char> paragraphStyleEmitted;  // Track paragraph style tokens emitted (uppercase)
   String pendingParagraphClasses;           // CSS classes for current block
@@ -356,45 +457,71 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
   bool paragraphClassesWritten = false;     // Have we written style token?
   bool lineHasContent = false;              // Does current line have visible content?
   bool lineHasNbsp = false;                 // Does current line have &nbsp;?
+  bool cancelled = false;
+  int nodesSinceYield = 0;
+  int nodesSinceHeapSample = 0;
+  if (minFreeHeap && ESP.getFreeHeap() < *minFreeHeap)
+    *minFreeHeap = ESP.getFreeHeap();
 
   while (parser.read()) {
+    if (minFreeHeap && ++nodesSinceHeapSample >= HEAP_SAMPLE_EVERY_NODES) {
+      nodesSinceHeapSample = 0;
+      const uint32_t freeHeap = ESP.getFreeHeap();
+      if (freeHeap < *minFreeHeap)
+        *minFreeHeap = freeHeap;
+    }
+
+    // Background conversions give the CPU back to the UI regularly and stop
+    // as soon as the foreground needs the converter for another chapter
+    if (backgroundConversion_ && ++nodesSinceYield >= PREFETCH_YIELD_EVERY_NODES) {
+      nodesSinceYield = 0;
+      if (isPrefetchCancelled(backgroundChapter_, backgroundGeneration_)) {
+        cancelled = true;
+        break;
+      }
+#ifdef ARDUINO
+      vTaskDelay(1);
+#else
+      std::this_thread::yield();
+#endif
+    }
     SimpleXmlParser::NodeType nodeType = parser.getNodeType();
 
     // ========== START ELEMENT ==========
     if (nodeType == SimpleXmlParser::Element) {
-      String name = parser.getName();
+      const XmlTag tag = parser.getTag();
 
       // Track non-self-closing elements
       if (!parser.isEmptyElement()) {
-        elementStack.push_back(name);
+        openTags.push_back((openTags.empty() ? 0u : openTags.back()) | xmlTagBit(tag));
       }
 
       // Block elements: add newline before if current line has content
       // This ensures blockquotes, nested divs, etc. start on a new line
-      if (isBlockElement(name) && lineHasContent) {
+      if (isBlockElement(tag) && lineHasContent) {
         buffer += "\n";
         lineHasContent = false;
         lineHasNbsp = false;
       }
 
       // Capture CSS classes and inline styles for block elements
-      if (isBlockElement(name)) {
-        pendingParagraphClasses = parser.getAttribute("class");
-        pendingInlineStyle = parser.getAttribute("style");
+      if (isBlockElement(tag)) {
+        assignAttribute(parser, "class", pendingParagraphClasses);
+        assignAttribute(parser, "style", pendingInlineStyle);
         paragraphClassesWritten = false;
       }
 
       // Handle inline style elements (b, strong, i, em, span)
-      if (isInlineStyleElement(name) && !parser.isEmptyElement()) {
-        String classAttr = parser.getAttribute("class");
-        String styleAttr = parser.getAttribute("style");
+      if (isInlineStyleElement(tag) && !parser.isEmptyElement()) {
+        assignAttribute(parser, "class", inlineClassAttr);
+        assignAttribute(parser, "style", inlineStyleAttr);
         // writeInlineStyleToken will push state into inlineStyleStack_ and
         // emit a combined token if necessary (supports bold+italic stacking)
-        (void)writeInlineStyleToken(buffer, name, classAttr, styleAttr);
+        (void)writeInlineStyleToken(buffer, tag, inlineClassAttr, inlineStyleAttr);
       }
 
       // Handle <br/> - only add newline if line has content
-      if (parser.isEmptyElement() && (name == "br" || name == "hr")) {
+      if (parser.isEmptyElement() && (tag == XmlTag::Br || tag == XmlTag::Hr)) {
         if (lineHasContent) {
           // Close alignment token before newline if one was opened
           if (paragraphClassesWritten && !paragraphStyleEmitted.empty()) {
@@ -425,15 +552,15 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
 
     // ========== END ELEMENT ==========
     else if (nodeType == SimpleXmlParser::EndElement) {
-      String name = parser.getName();
+      const XmlTag tag = parser.getTag();
 
       // Handle end of inline style elements
-      if (isInlineStyleElement(name) && !inlineStyleStack_.empty()) {
+      if (isInlineStyleElement(tag) && !inlineStyleStack_.empty()) {
         closeInlineStyleElement(buffer);
       }
 
       // Block elements: add newline if line had content OR had &nbsp;
-      if (isBlockElement(name) || isHeaderElement(name)) {
+      if (isBlockElement(tag) || isHeaderElement(tag)) {
         if (lineHasContent || lineHasNbsp) {
           // If a paragraph-level style was emitted at the start, write corresponding end tokens now
           if (paragraphClassesWritten && !paragraphStyleEmitted.empty()) {
@@ -468,65 +595,35 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
       }
 
       // Pop from element stack
-      if (!elementStack.empty()) {
-        elementStack.pop_back();
+      if (!openTags.empty()) {
+        openTags.pop_back();
       }
     }
 
     // ========== TEXT NODE ==========
     else if (nodeType == SimpleXmlParser::Text) {
       // Skip if inside <head>, <style>, <script>
-      if (isInsideSkippedElement(elementStack)) {
-        continue;
-      }
-
-      // Read and process text
-      String text = readAndDecodeText(parser);
-      if (text.isEmpty()) {
+      if (!openTags.empty() && (openTags.back() & SKIPPED_TAGS) != 0) {
         continue;
       }
 
-      if (text.indexOf("\xC2\xA0") >= 0) {
+      // Before the node's first byte: the style token at the start of the
+      // paragraph (remembering the emitted raw tokens), then the inline style
+      // tokens (open/close) for the visible text
+      auto writeStyleTokens = [&]() {
+        writeParagraphStyleToken(buffer, pendingParagraphClasses, pendingInlineStyle, paragraphClassesWritten,
+                                 paragraphStyleEmitted);
+        ensureInlineStyleEmitted(buffer);
+      };
+
+      // Decode and normalize the text into the buffer; leading space is trimmed at line start
+      bool wroteText = false;
+      if (decodeTextNode(parser, !lineHasContent, buffer, writeStyleTokens, wroteText)) {
         lineHasNbsp = true;
       }
-
-      // Normalize: collapse whitespace, convert nbsp to space
-      text = normalizeWhitespace(text);
-      if (text.isEmpty()) {
-        continue;
-      }
-
-      // Trim leading space if at line start
-      if (!lineHasContent) {
-        text = trimLeadingSpaces(text);
-        if (text.isEmpty()) {
-          continue;
-        }
-      }
-
-      // Write style token at start of paragraph and remember the emitted raw tokens
-      writeParagraphStyleToken(buffer, pendingParagraphClasses, pendingInlineStyle, paragraphClassesWritten,
-                               paragraphStyleEmitted);
-
-      // Ensure inline style tokens (open/close) are emitted right before we write visible text
-      ensureInlineStyleEmitted(buffer);
-
-      // Append text
-      buffer += text;
-      lineHasContent = true;
-    }
-
-    // Periodic flush to avoid excessive memory use and ensure data hits SD
-    if (buffer.length() > FLUSH_THRESHOLD) {
-      size_t toWrite = buffer.length();
-      size_t written = out.write((const uint8_t*)buffer.c_str(), toWrite);
-      if (outBytes)
-        *outBytes += written;
-      if (written != toWrite) {
-        Serial.printf("WARNING: partial write during conversion: attempted=%u wrote=%u\n", (unsigned)toWrite,
-                      (unsigned)written);
+      if (wroteText) {
+        lineHasContent = true;
       }
-      buffer = "";
     }
   }
 
@@ -555,229 +652,172 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
   currentInlineCombined_ = '\0';
   inlineStyleStack_.clear();
 
-  // Periodic flush and final flush using write() to verify bytes written
+  // Final flush of the partial last sector
+  buffer.flush();
   if (outBytes)
-    *outBytes = 0;
+    *outBytes = buffer.bytesWritten();
+  return !cancelled;
+}
 
-  if (buffer.length() > 0) {
-    size_t toWrite = buffer.length();
-    size_t written = out.write((const uint8_t*)buffer.c_str(), toWrite);
-    if (outBytes)
-      *outBytes += written;
-    if (written != toWrite) {
-      Serial.printf("WARNING: partial write: attempted=%u wrote=%u\n", (unsigned)toWrite, (unsigned)written);
+// Collapses whitespace and converts nbsp (0xC2 0xA0) to a space in decoded
+// text that arrives in pieces, appending it straight to the output buffer;
+// the lead byte of a possible nbsp is held back until the next byte shows
+// whether it is one. Nothing is written (not even `beforeText`) until the
+// node produces its first byte.
+template <typename BeforeText>
+struct TextNormalizer {
+  TxtOutputBuffer& out;
+  BeforeText& beforeText;
+  bool lastWasSpace;
+  bool heldLead = false;
+  bool sawNbsp = false;
+  bool wroteText = false;
+
+  TextNormalizer(TxtOutputBuffer& output, BeforeText& before, bool trimLeading)
+      : out(output), beforeText(before), lastWasSpace(trimLeading) {}
+
+  void beginText() {
+    if (!wroteText) {
+      wroteText = true;
+      beforeText();
     }
-    buffer = "";
   }
-}
 
-bool EpubWordProvider::isInsideSkippedElement(const std::vector<String>& elementStack) {
-  for (const String& elem : elementStack) {
-    if (isSkippedElement(elem)) {
-      return true;
+  void putSpace() {
+    if (!lastWasSpace) {
+      beginText();
+      out += ' ';
+      lastWasSpace = true;
     }
   }
-  return false;
-}
-
-String EpubWordProvider::readAndDecodeText(SimpleXmlParser& parser) {
-  String result;
 
-  while (parser.hasMoreTextChars()) {
-    char c = parser.readTextNodeCharForward();
-
-    // Skip carriage returns
-    if (c == '\r') {
-      continue;
+  void releaseLead() {
+    if (heldLead) {
+      heldLead = false;
+      beginText();
+      out += '\xC2';
+      lastWasSpace = false;
     }
+  }
 
-    // Convert tabs to spaces
-    if (c == '\t') {
-      c = ' ';
+  void put(char c) {
+    if (heldLead && c == '\xA0') {
+      heldLead = false;
+      sawNbsp = true;
+      putSpace();
+      return;
     }
-
-    // Decode HTML entities
-    if (c == '&') {
-      String entity = "&";
-      while (parser.hasMoreTextChars()) {
-        char next = parser.peekTextNodeChar();
-        entity += next;
-        parser.readTextNodeCharForward();
-        if (next == ';' || entity.length() > 32) {
-          break;
-        }
-      }
-      result += decodeHtmlEntity(entity);
+    releaseLead();
+    if (c == '\xC2') {
+      heldLead = true;
+    } else if (c == ' ' || c == '\n') {
+      putSpace();
     } else {
-      result += c;
+      beginText();
+      out += c;
+      lastWasSpace = false;
     }
   }
 
-  return result;
-}
-
-String EpubWordProvider::decodeHtmlEntity(const String& entity) {
-  if (entity == "&nbsp;")
-    return "\xC2\xA0";  // Non-breaking space
-  if (entity == "&amp;")
-    return "&";
-  if (entity == "&lt;")
-    return "<";
-  if (entity == "&gt;")
-    return ">";
-  if (entity == "&quot;")
-    return "\"";
-  if (entity == "&apos;")
-    return "'";
-  if (entity == "&rsquo;" || entity == "&lsquo;")
-    return "'";
-  if (entity == "&rdquo;" || entity == "&ldquo;")
-    return "\"";
-  if (entity == "&ndash;" || entity == "&mdash;")
-    return "-";
-  if (entity == "&hellip;")
-    return "...";
-  if (entity == "&lsaquo;" || entity == "&rsaquo;")
-    return "\"";
-  if (entity == "&laquo;" || entity == "&raquo;")
-    return "\"";
-  if (entity == "&shy;")
-    return "";
-  if (entity == "&thinsp;" || entity == "&ensp;" || entity == "&emsp;" || entity == "&nbsp;")
-    return " ";
-  if (entity == "&copy;")
-    return "(c)";
-  if (entity == "&reg;")
-    return "(r)";
-  if (entity == "&trade;")
-    return "(tm)";
-  if (entity.startsWith("&#") && entity.endsWith(";")) {
-    String num = entity.substring(2, entity.length() - 1);
-    num.trim();
-
-    int base = 10;
-    if (num.startsWith("x") || num.startsWith("X")) {
-      base = 16;
-      num = num.substring(1);
-    }
-
-    long code = 0;
-    bool ok = (num.length() > 0);
-    for (int i = 0; ok && i < num.length(); ++i) {
-      char c = num.charAt(i);
-      int v = -1;
-      if (c >= '0' && c <= '9') {
-        v = c - '0';
-      } else if (base == 16 && c >= 'a' && c <= 'f') {
-        v = 10 + (c - 'a');
-      } else if (base == 16 && c >= 'A' && c <= 'F') {
-        v = 10 + (c - 'A');
-      }
-      if (v < 0 || v >= base) {
-        ok = false;
-        break;
-      }
-      code = code * base + v;
-      if (code > 0x10FFFF) {
-        ok = false;
-        break;
+  void putPlain(const char* run, size_t length) {
+    if (heldLead) {
+      put(*run++);
+      if (--length == 0) {
+        return;
       }
     }
+    beginText();
+    out.append(run, length);
+    lastWasSpace = false;
+  }
 
-    if (ok) {
-      if (code == 13) {
-        return "";
-      }
-      if (code == 10) {
-        return "\n";
-      }
-      if (code == 160) {
-        return "\xC2\xA0";
-      }
-      if (code == 173) {
-        return "";
-      }
-      if (code == 65279) {
-        return "";
-      }
-      if (code == 8203 || code == 8204 || code == 8205) {
-        return "";
-      }
-      if (code == 8216 || code == 8217) {
-        return "'";
-      }
-      if (code == 8218) {
-        return ",";
-      }
-      if (code == 8220 || code == 8221) {
-        return "\"";
-      }
-      if (code == 8222) {
-        return "\"";
-      }
-      if (code == 8230) {
-        return "...";
-      }
-      if (code == 8208 || code == 8209 || code == 8210 || code == 8211 || code == 8212) {
-        return "-";
-      }
-      if (code == 8242) {
-        return "'";
-      }
-      if (code == 8243) {
-        return "\"";
-      }
-      if (code == 8249 || code == 8250) {
-        return "\"";
-      }
-      if (code == 8226) {
-        return "-";
-      }
-      if (code == 8239 || code == 8194 || code == 8195 || code == 8201 || code == 8202) {
-        return " ";
-      }
-      if (code == 8232 || code == 8233) {
-        return "\n";
-      }
-      if (code >= 32 && code <= 126) {
-        char out[2];
-        out[0] = (char)code;
-        out[1] = '\0';
-        return String(out);
-      }
+  // Decoded character reference, or its raw text if it is not one
+  void putEntity(const char* entity, size_t length) {
+    char scratch[HTML_ENTITY_SCRATCH_SIZE];
+    size_t decodedLength = 0;
+    const char* decoded = decodeHtmlEntity(entity, length, scratch, decodedLength);
+    if (!decoded) {
+      decoded = entity;
+      decodedLength = length;
+    }
+    for (size_t i = 0; i < decodedLength; i++) {
+      put(decoded[i]);
     }
   }
-  // Unknown entity - return as-is
-  return entity;
-}
-
-String EpubWordProvider::normalizeWhitespace(const String& text) {
-  String result;
-  bool lastWasSpace = false;
+};
 
-  for (int i = 0; i < text.length(); i++) {
-    char c = text.charAt(i);
+// Bytes that need no decoding or normalization
+static inline bool isPlainTextByte(char c) {
+  return c != '&' && c != ' ' && c != '\n' && c != '\r' && c != '\t' && c != '\xC2';
+}
 
-    // Convert non-breaking space to regular space
-    if (c == '\xC2' && i + 1 < text.length() && text.charAt(i + 1) == '\xA0') {
-      c = ' ';
-      i++;  // skip the second byte (0xA0)
-    }
+template <typename BeforeText>
+bool EpubWordProvider::decodeTextNode(SimpleXmlParser& parser, bool atLineStart, TxtOutputBuffer& out,
+                                      BeforeText& beforeText, bool& wroteText) {
+  static constexpr size_t MAX_ENTITY_LENGTH = 33;  // Longer '&...' runs are kept as text
+
+  TextNormalizer<BeforeText> normalizer(out, beforeText, atLineStart);
+  char entity[MAX_ENTITY_LENGTH];
+  size_t entityLength = 0;  // > 0 while collecting an entity (may span text spans)
+
+  size_t length = 0;
+  while (const char* span = parser.readTextSpan(length)) {
+    const char* p = span;
+    const char* end = span + length;
+    while (p < end) {
+      if (entityLength > 0) {
+        const char c = *p++;
+        entity[entityLength++] = c;
+        if (c == ';' || entityLength >= MAX_ENTITY_LENGTH) {
+          normalizer.putEntity(entity, entityLength);
+          entityLength = 0;
+        }
+        continue;
+      }
 
-    bool isSpace = (c == ' ' || c == '\n');
+      const char* run = p;
+      while (p < end && isPlainTextByte(*p)) {
+        p++;
+      }
+      if (p > run) {
+        normalizer.putPlain(run, p - run);
+        continue;
+      }
 
-    if (isSpace) {
-      if (!lastWasSpace) {
-        result += ' ';
-        lastWasSpace = true;
+      const char c = *p++;
+      if (c == '\r') {
+        // Skip carriage returns
+      } else if (c == '&') {
+        // Decode in place when the whole reference is in this span, else
+        // collect it across spans
+        const char* amp = p - 1;
+        const size_t available = end - p;
+        const size_t window = available < MAX_ENTITY_LENGTH - 1 ? available : MAX_ENTITY_LENGTH - 1;
+        const char* semicolon = (const char*)memchr(p, ';', window);
+        if (semicolon) {
+          p = semicolon + 1;
+          normalizer.putEntity(amp, p - amp);
+        } else if (available >= MAX_ENTITY_LENGTH - 1) {
+          p = amp + MAX_ENTITY_LENGTH;
+          normalizer.putEntity(amp, MAX_ENTITY_LENGTH);
+        } else {
+          memcpy(entity, amp, available + 1);
+          entityLength = available + 1;
+          p = end;
+        }
+      } else {
+        normalizer.put(c == '\t' ? ' ' : c);
       }
-    } else {
-      result += c;
-      lastWasSpace = false;
     }
   }
 
-  return result;
+  // Entity cut off by the end of the text node
+  if (entityLength > 0) {
+    normalizer.putEntity(entity, entityLength);
+  }
+  normalizer.releaseLead();
+  wroteText = normalizer.wroteText;
+  return normalizer.sawNbsp;
 }
 
 void EpubWordProvider::trimTrailingSpaces(String& buffer) {
@@ -791,22 +831,15 @@ void EpubWordProvider::trimTrailingSpaces(String& buffer) {
   }
 }
 
-String EpubWordProvider::trimLeadingSpaces(const String& text) {
-  int start = 0;
-  while (start < text.length() && (text.charAt(start) == ' ' || text.charAt(start) == '\n')) {
-    start++;
-  }
-  return text.substring(start);
-}
-char EpubWordProvider::writeInlineStyleToken(String& writeBuffer, const String& elementName, const String& classAttr,
+char EpubWordProvider::writeInlineStyleToken(TxtOutputBuffer& writeBuffer, XmlTag tag, const String& classAttr,
                                              const String& styleAttr) {
   // Determine style flags for this element (from tag name, classes, inline styles)
   InlineStyleState state;
   // Tag name - these are explicit declarations
-  if (elementName == "b" || elementName == "strong") {
+  if (tag == XmlTag::B || tag == XmlTag::Strong) {
     state.bold = true;
     state.hasBold = true;
-  } else if (elementName == "i" || elementName == "em") {
+  } else if (tag == XmlTag::I || tag == XmlTag::Em) {
     state.italic = true;
     state.hasItalic = true;
   }
@@ -841,7 +874,7 @@ char EpubWordProvider::writeInlineStyleToken(String& writeBuffer, const String&
   return currentInlineCombined_;
 }
 
-void EpubWordProvider::closeInlineStyleElement(String& writeBuffer) {
+void EpubWordProvider::closeInlineStyleElement(TxtOutputBuffer& writeBuffer) {
   if (inlineStyleStack_.empty())
     return;
 
@@ -852,7 +885,7 @@ void EpubWordProvider::closeInlineStyleElement(String& writeBuffer) {
   updateEffectiveInlineCombined();
 }
 
-void EpubWordProvider::writeStyleResetToken(String& writeBuffer, char startCmd) {
+void EpubWordProvider::writeStyleResetToken(TxtOutputBuffer& writeBuffer, char startCmd) {
   // Emit a token to reset back to normal style
   // Map startCmd (uppercase) to corresponding lowercase end token
   if (startCmd == '\0')
@@ -865,7 +898,7 @@ void EpubWordProvider::writeStyleResetToken(String& writeBuffer, char startCmd)
   writeBuffer += endCmd;      // Reset token corresponding to startCmd
 }
 
-void EpubWordProvider::ensureInlineStyleEmitted(String& writeBuffer) {
+void EpubWordProvider::ensureInlineStyleEmitted(TxtOutputBuffer& writeBuffer) {
   // If the written style already matches current, nothing to do
   if (writtenInlineCombined_ == currentInlineCombined_)
     return;
@@ -946,12 +979,8 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   }
 
   // Compute output path
-  String dest = epubReader_->getExtractedPath(epubFilename);
-  int lastDot = dest.lastIndexOf('.');
-  if (lastDot >= 0) {
-    dest = dest.substring(0, lastDot);
-  }
-  dest += ".txt";
+  String dest = getConvertedTxtPath(epubReader_->getExtractedPath(epubFilename));
+  const String runsPath = dest + STYLE_RUNS_SUFFIX;
 
   // Create directories if needed
   int lastSlash = dest.lastIndexOf('/');
@@ -964,7 +993,7 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   unsigned long totalStartMs = millis();
   unsigned long t0 = millis();
   // If the TXT file already exists and is non-empty, reuse it and skip conversion
-  if (SD.exists(dest.c_str())) {
+  if (SD.exists(dest.c_str()) && (!useStyleRuns_ || SD.exists(runsPath.c_str()))) {
     File chk = SD.open(dest.c_str());
     if (chk) {
       size_t sz = chk.size();
@@ -980,6 +1009,8 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
           timings->endStream = 0;
           timings->closeOut = 0;
           timings->bytes = sz;
+          timings->bytesPerSecond = 0;
+          timings->peakHeap = 0;
         }
         Serial.printf("  Reusing existing streamed TXT: %s  —  %u bytes\n", dest.c_str(), (unsigned)sz);
         outTxtPath = dest;
@@ -988,20 +1019,31 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
     }
   }
 
-  epub_stream_context* epubStream = epubReader_->startStreaming(epubFilename, 4096);
+  // Stored (uncompressed) entries are parsed in place from the EPUB file: the
+  // parser's own buffer is the only copy and it can seek backwards. Compressed
+  // entries are inflated through a pull stream.
+  const uint32_t heapAtStart = ESP.getFreeHeap();
+  uint32_t minFreeHeap = heapAtStart;
+  uint32_t storedOffset = 0;
+  uint32_t storedSize = 0;
+  const bool stored = epubReader_->getStoredEntryRange(epubFilename, storedOffset, storedSize);
+  epub_stream_context* epubStream = nullptr;
+  if (!stored) {
+    epubStream = epubReader_->startStreaming(epubFilename, 4096, recordInflateCheckpoints_);
+    if (!epubStream) {
+      Serial.printf("ERROR: Failed to start EPUB streaming for file: %s\n", epubFilename);
+      return false;
+    }
+  }
   unsigned long startStreamingMs = millis() - t0;
   if (timings)
     timings->startStream = startStreamingMs;
-  if (!epubStream) {
-    Serial.printf("ERROR: Failed to start EPUB streaming for file: %s\n", epubFilename);
-    return false;
-  }
 
   // Set up context for parser callback
   TrueStreamingContext streamCtx;
   streamCtx.epubStream = epubStream;
 
-  // Open parser in streaming mode
+  // Open parser in streaming mode, or directly on the stored entry's bytes
   SimpleXmlParser parser;
   t0 = millis();
   // Memory debug: before opening parser from stream
@@ -1009,7 +1051,9 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   Serial.printf("  [MEM] before parser.openFromStream: Free=%u, Total=%u, MinFree=%u\n", heapBeforeParserOpen,
                 ESP.getHeapSize(), ESP.getMinFreeHeap());
 
-  if (!parser.openFromStream(parser_stream_callback, &streamCtx)) {
+  const bool parserOpened = stored ? parser.openRange(epubPath_.c_str(), storedOffset, storedSize)
+                                   : parser.openFromStream(parser_stream_callback, &streamCtx);
+  if (!parserOpened) {
     // Log memory on failure
     uint32_t heapFail = ESP.getFreeHeap();
     int32_t failDelta = (int32_t)heapFail - (int32_t)heapBeforeParserOpen;
@@ -1026,15 +1070,17 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   if (timings)
     timings->parserOpen = parserOpenMs;
 
-  // Remove existing file to ensure clean write (timed)
+  // Write to a temporary file and rename it into place once complete, so the
+  // reuse check above never picks up a half-written chapter (timed)
+  String partPath = dest + ".part";
   t0 = millis();
-  if (SD.exists(dest.c_str())) {
-    SD.remove(dest.c_str());
+  if (SD.exists(partPath.c_str())) {
+    SD.remove(partPath.c_str());
   }
-  File out = SD.open(dest.c_str(), FILE_WRITE);
+  File out = SD.open(partPath.c_str(), FILE_WRITE);
   unsigned long outOpenMs = millis() - t0;
   if (!out) {
-    Serial.printf("ERROR: Failed to open output TXT file '%s' for writing\n", dest.c_str());
+    Serial.printf("ERROR: Failed to open output TXT file '%s' for writing\n", partPath.c_str());
     parser.close();
     epub_end_streaming(epubStream);
     return false;
@@ -1043,13 +1089,33 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   if (timings)
     timings->outOpen = outOpenMs;
 
-  // Perform the conversion using common logic (timed)
+  // Perform the conversion using common logic (timed). Runs are appended to
+  // their file as they are produced.
   t0 = millis();
   size_t bytesWritten = 0;
-  performXhtmlToTxtConversion(parser, out, &bytesWritten);
+  File runsOut;
+  if (useStyleRuns_) {
+    runsOut = SD.open(runsPath.c_str(), FILE_WRITE);
+    if (!runsOut) {
+      Serial.printf("ERROR: Failed to open style runs '%s' for writing\n", runsPath.c_str());
+      out.close();
+      SD.remove(partPath.c_str());
+      parser.close();
+      epub_end_streaming(epubStream);
+      return false;
+    }
+  }
+  StyleRunEncoder styleRuns(runsOut);
+  const bool completed =
+      performXhtmlToTxtConversion(parser, out, &bytesWritten, useStyleRuns_ ? &styleRuns : nullptr, &minFreeHeap);
   unsigned long conversionMs = millis() - t0;
-  if (timings)
+  const uint32_t bytesPerSecond = conversionRate(stored ? storedSize : streamCtx.bytesPulled, conversionMs);
+  const uint32_t peakHeap = heapAtStart - minFreeHeap;
+  if (timings) {
     timings->conversion = conversionMs;
+    timings->bytesPerSecond = bytesPerSecond;
+    timings->peakHeap = peakHeap;
+  }
 
   // Close parser and streaming in separate timed steps
   t0 = millis();
@@ -1066,10 +1132,39 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
 
   t0 = millis();
   out.close();
+  // The run table is finished first: the text only appears once both are complete
+  const bool runsOk = !useStyleRuns_ || !completed || styleRuns.finish();
+  if (useStyleRuns_) {
+    runsOut.close();
+    if (!completed || !runsOk) {
+      SD.remove(runsPath.c_str());
+    }
+  }
+  if (completed) {
+    if (SD.exists(dest.c_str())) {
+      SD.remove(dest.c_str());
+    }
+    if (!runsOk) {
+      Serial.printf("ERROR: Failed to write style runs '%s'\n", runsPath.c_str());
+      SD.remove(partPath.c_str());
+      return false;
+    }
+    if (!SD.rename(partPath.c_str(), dest.c_str())) {
+      Serial.printf("ERROR: Failed to rename '%s' to '%s'\n", partPath.c_str(), dest.c_str());
+      SD.remove(partPath.c_str());
+      return false;
+    }
+  }
   unsigned long closeOutMs = millis() - t0;
   if (timings)
     timings->closeOut = closeOutMs;
 
+  if (!completed) {
+    SD.remove(partPath.c_str());
+    Serial.printf("  Conversion of %s cancelled after %lu ms\n", dest.c_str(), millis() - totalStartMs);
+    return false;
+  }
+
   // Re-open the output file to get final size (some SD implementations report size=0 until closed)
   File check = SD.open(dest.c_str());
   size_t checkSize = 0;
@@ -1077,8 +1172,8 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
     checkSize = check.size();
     check.close();
   }
-  Serial.printf("  [STREAM] bytesPulled=%u, bytesWrittenReported=%u\n", (unsigned)streamCtx.bytesPulled,
-                (unsigned)checkSize);
+  Serial.printf("  [STREAM] %s bytesPulled=%u, bytesWrittenReported=%u\n", stored ? "stored" : "inflated",
+                (unsigned)(stored ? storedSize : streamCtx.bytesPulled), (unsigned)checkSize);
   bytesWritten = checkSize;
 
   unsigned long totalMs = millis() - totalStartMs;
@@ -1089,9 +1184,10 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   Serial.printf(
       "Converted XHTML to TXT (streamed): %s  —  total = %lu ms  ( startStream = %lu, parserOpen = %lu, outOpen = %lu, "
       "conversion = "
-      "%lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes\n",
+      "%lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes, %u bytes/s, peak heap %u bytes\n",
       dest.c_str(), totalMs, startStreamingMs, parserOpenMs, (timings ? timings->outOpen : 0), conversionMs,
-      parserCloseMs, endStreamMs, closeOutMs, (unsigned int)bytesWritten);
+      parserCloseMs, endStreamMs, closeOutMs, (unsigned int)bytesWritten, (unsigned)bytesPerSecond,
+      (unsigned)peakHeap);
   outTxtPath = dest;
   return true;
 }
@@ -1107,20 +1203,15 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
     return false;
   }
 
-  const SpineItem* spineItem = epubReader_->getSpineItem(chapterIndex);
-  if (!spineItem) {
-    Serial.printf("ERROR: Failed to get spine item for chapter index %d\n", chapterIndex);
-    return false;
+  if (useBookContainer_ && (bookContainer_.isOpen() || openBookContainer())) {
+    return openChapterFromContainer(chapterIndex);
   }
 
-  // Build full path: content.opf is at OEBPS/content.opf, so hrefs are relative to OEBPS/
-  String contentOpfPath = epubReader_->getContentOpfPath();
-  String baseDir = "";
-  int lastSlash = contentOpfPath.lastIndexOf('/');
-  if (lastSlash >= 0) {
-    baseDir = contentOpfPath.substring(0, lastSlash + 1);
+  String fullHref;
+  if (!getChapterHref(chapterIndex, fullHref)) {
+    Serial.printf("ERROR: Failed to get spine item for chapter index %d\n", chapterIndex);
+    return false;
   }
-  String fullHref = baseDir + spineItem->href;
 
   // Close existing parser if any
   if (parser_) {
@@ -1129,37 +1220,42 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
     parser_ = nullptr;
   }
 
-  // Convert XHTML to text file using selected method
+  // Convert XHTML to text file using selected method. A prefetch of this
+  // chapter is left to finish (we then reuse its output); any other prefetch
+  // is cancelled so it doesn't delay the page the user asked for.
   String txtPath;
   unsigned long convStart = millis();
+  cancelPrefetch(chapterIndex);
+  lockConversion();
+  bool converted = false;
   if (useStreamingConversion_) {
     // Stream XHTML from EPUB directly to memory and convert (no intermediate XHTML file)
     ConversionTimings t;
-    if (!convertXhtmlStreamToTxt(fullHref.c_str(), txtPath, &t)) {
-      return false;
-    }
+    converted = convertXhtmlStreamToTxt(fullHref.c_str(), txtPath, &t);
     // Print detailed breakdown for chapter-level conversion
-    Serial.printf(
+    if (converted)
+      Serial.printf(
         "    Converted XHTML to TXT (streamed): %s  —  total = %lu ms  ( startStream = %lu, parserOpen = %lu, outOpen "
-        "= %lu, conversion = %lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes\n",
+        "= %lu, conversion = %lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes, %u bytes/s, "
+        "peak heap %u bytes\n",
         txtPath.c_str(), t.total, t.startStream, t.parserOpen, t.outOpen, t.conversion, t.parserClose, t.endStream,
-        t.closeOut, (unsigned int)t.bytes);
+        t.closeOut, (unsigned int)t.bytes, (unsigned)t.bytesPerSecond, (unsigned)t.peakHeap);
   } else {
     // Extract XHTML file first, then convert from file
     String xhtmlPath = epubReader_->getFile(fullHref.c_str());
-    if (xhtmlPath.isEmpty()) {
-      return false;
-    }
     ConversionTimings t;
-    if (!convertXhtmlToTxt(xhtmlPath, txtPath, &t)) {
-      return false;
-    }
+    converted = !xhtmlPath.isEmpty() && convertXhtmlToTxt(xhtmlPath, txtPath, &t);
     // Print detailed breakdown for chapter-level conversion when using file-based conversion
-    Serial.printf(
-        "    Converted XHTML to TXT: %s  —  total = %lu ms  ( parserOpen = %lu, outOpen = %lu, conversion = %lu, "
-        "parserClose = %lu, closeOut = %lu )  —  %u bytes\n",
-        txtPath.c_str(), t.total, t.parserOpen, t.outOpen, t.conversion, t.parserClose, t.closeOut,
-        (unsigned int)t.bytes);
+    if (converted)
+      Serial.printf(
+          "    Converted XHTML to TXT: %s  —  total = %lu ms  ( parserOpen = %lu, outOpen = %lu, conversion = %lu, "
+          "parserClose = %lu, closeOut = %lu )  —  %u bytes, %u bytes/s, peak heap %u bytes\n",
+          txtPath.c_str(), t.total, t.parserOpen, t.outOpen, t.conversion, t.parserClose, t.closeOut,
+          (unsigned int)t.bytes, (unsigned)t.bytesPerSecond, (unsigned)t.peakHeap);
+  }
+  unlockConversion();
+  if (!converted) {
+    return false;
   }
   unsigned long conversionAndExtractMs = millis() - convStart;
   Serial.printf("  Chapter conversion + extract took  %lu ms\n", conversionAndExtractMs);
@@ -1182,6 +1278,9 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
     }
     return false;
   }
+  if (useStyleRuns_ && !fileProvider_->loadStyleRuns((txtPath + STYLE_RUNS_SUFFIX).c_str())) {
+    Serial.printf("WARNING: No usable style runs for %s, reading without styles\n", txtPath.c_str());
+  }
 
   xhtmlPath_ = newXhtmlPath;
   currentChapter_ = chapterIndex;
@@ -1200,9 +1299,274 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
 
   Serial.printf("Opened chapter %d: %s\n", chapterIndex, currentChapterName_.c_str());
 
+  schedulePrefetch(chapterIndex);
+
+  return true;
+}
+
+bool EpubWordProvider::openBookContainer() {
+  const String path = epubReader_->getExtractedPath(BOOK_CONTAINER_FILENAME);
+  const uint32_t sourceSize = (uint32_t)epubReader_->getEpubFileSize();
+  if (bookContainer_.open(path.c_str(), sourceSize) &&
+      bookContainer_.getChapterCount() == epubReader_->getSpineCount()) {
+    return true;
+  }
+  bookContainer_.close();
+  if (!buildBookContainer(path)) {
+    Serial.println("WARNING: Book container unavailable, using per-chapter TXT files");
+    return false;
+  }
+  if (!bookContainer_.open(path.c_str(), sourceSize) ||
+      bookContainer_.getChapterCount() != epubReader_->getSpineCount()) {
+    bookContainer_.close();
+    return false;
+  }
   return true;
 }
 
+bool EpubWordProvider::buildBookContainer(const String& path) {
+  unsigned long startMs = millis();
+  const int spineCount = epubReader_->getSpineCount();
+
+  // Every chapter is converted here, so background prefetches have nothing left to do
+  cancelPrefetch(-1);
+  waitForPrefetchWorker();
+  lockConversion();
+  // The container stores the token format
+  const bool styleRuns = useStyleRuns_;
+  useStyleRuns_ = false;
+
+  BookContainer::Writer writer(path.c_str(), (uint32_t)epubReader_->getEpubFileSize());
+  std::vector<String> chapterFiles;
+  bool ok = true;
+  for (int i = 0; i < spineCount && ok; i++) {
+    String fullHref;
+    String txtPath;
+    if (!getChapterHref(i, fullHref)) {
+      ok = false;
+      break;
+    }
+    if (useStreamingConversion_) {
+      ok = convertXhtmlStreamToTxt(fullHref.c_str(), txtPath);
+    } else {
+      String xhtmlPath = epubReader_->getFile(fullHref.c_str());
+      ok = !xhtmlPath.isEmpty() && convertXhtmlToTxt(xhtmlPath, txtPath);
+    }
+    if (!ok) {
+      Serial.printf("ERROR: Failed to convert chapter %d for the book container\n", i);
+      break;
+    }
+    ok = writer.appendChapterFile(txtPath.c_str());
+    chapterFiles.push_back(txtPath);
+  }
+  useStyleRuns_ = styleRuns;
+  unlockConversion();
+  if (!ok || !writer.finish()) {
+    return false;
+  }
+
+  // The container now holds every chapter's text
+  for (const String& txtPath : chapterFiles) {
+    SD.remove(txtPath.c_str());
+  }
+  Serial.printf("  Built book container for %d chapters in %lu ms\n", spineCount, millis() - startMs);
+  return true;
+}
+
+bool EpubWordProvider::openChapterFromContainer(int chapterIndex) {
+  unsigned long startMs = millis();
+  if (parser_) {
+    parser_->close();
+    delete parser_;
+    parser_ = nullptr;
+  }
+
+  // One provider stays open on the container; a chapter switch only moves its range
+  if (fileProvider_ && fileProvider_->getChapterFilePath() != bookContainer_.getPath()) {
+    delete fileProvider_;
+    fileProvider_ = nullptr;
+  }
+  if (!fileProvider_) {
+    fileProvider_ = new FileWordProvider(bookContainer_.getPath().c_str(), bufSize_);
+    if (!fileProvider_->isValid()) {
+      delete fileProvider_;
+      fileProvider_ = nullptr;
+      return false;
+    }
+  }
+  const size_t start = bookContainer_.getTextFileOffset() + bookContainer_.getChapterOffset(chapterIndex);
+  const size_t length = bookContainer_.getChapterLength(chapterIndex);
+  if (!fileProvider_->setRange(start, length)) {
+    return false;
+  }
+  std::vector<uint32_t> paragraphStarts;
+  if (bookContainer_.readChapterParagraphs(chapterIndex, paragraphStarts)) {
+    fileProvider_->setParagraphStarts(std::move(paragraphStarts));
+  }
+
+  getChapterHref(chapterIndex, xhtmlPath_);
+  currentChapter_ = chapterIndex;
+  fileSize_ = length;
+  currentChapterName_ = epubReader_->getChapterNameForSpine(chapterIndex);
+  currentIndex_ = 0;
+
+  Serial.printf("Opened chapter %d from book container: %s  —  %lu ms\n", chapterIndex,
+                currentChapterName_.c_str(), millis() - startMs);
+  return true;
+}
+
+bool EpubWordProvider::getChapterHref(int chapterIndex, String& outHref) {
+  const SpineItem* spineItem = epubReader_->getSpineItem(chapterIndex);
+  if (!spineItem) {
+    return false;
+  }
+
+  // Build full path: content.opf is at OEBPS/content.opf, so hrefs are relative to OEBPS/
+  String contentOpfPath = epubReader_->getContentOpfPath();
+  String baseDir = "";
+  int lastSlash = contentOpfPath.lastIndexOf('/');
+  if (lastSlash >= 0) {
+    baseDir = contentOpfPath.substring(0, lastSlash + 1);
+  }
+  outHref = baseDir + spineItem->href;
+  return true;
+}
+
+void EpubWordProvider::lockConversion() {
+#ifdef ARDUINO
+  if (conversionLock_) {
+    xSemaphoreTake(conversionLock_, portMAX_DELAY);
+  }
+#else
+  conversionLock_.lock();
+#endif
+}
+
+void EpubWordProvider::unlockConversion() {
+#ifdef ARDUINO
+  if (conversionLock_) {
+    xSemaphoreGive(conversionLock_);
+  }
+#else
+  conversionLock_.unlock();
+#endif
+}
+
+void EpubWordProvider::schedulePrefetch(int chapterIndex) {
+  if (!prefetchEnabled_ || !useStreamingConversion_ || !epubReader_) {
+    return;
+  }
+  const int spineCount = epubReader_->getSpineCount();
+  const int next = chapterIndex + 1 < spineCount ? chapterIndex + 1 : -1;
+  const int prev = prefetchPrevious_ && chapterIndex > 0 ? chapterIndex - 1 : -1;
+  if (next < 0 && prev < 0) {
+    return;
+  }
+  prefetchNext_ = next;
+  prefetchPrev_ = prev;
+
+  // A worker that is still running picks up the new queue by itself
+  bool expected = false;
+  if (!prefetchRunning_.compare_exchange_strong(expected, true)) {
+    return;
+  }
+#ifdef ARDUINO
+  // The previous worker has cleared the running flag; let it finish exiting
+  waitForPrefetchWorker();
+  // Idle priority: the worker only runs while the UI loop is waiting. The
+  // conversion lock's priority inheritance covers the foreground blocking on it.
+  if (!prefetchExited_ || xTaskCreate(&EpubWordProvider::prefetchTaskTrampoline, "ChapPrefetch", 8192, this,
+                                      tskIDLE_PRIORITY, nullptr) != pdPASS) {
+    Serial.println("WARNING: Failed to start chapter prefetch task");
+    prefetchRunning_ = false;
+    return;
+  }
+  prefetchTaskStarted_ = true;
+#else
+  if (prefetchThread_.joinable()) {
+    prefetchThread_.join();
+  }
+  prefetchThread_ = std::thread(&EpubWordProvider::prefetchTaskTrampoline, this);
+#endif
+}
+
+void EpubWordProvider::prefetchTaskTrampoline(void* param) {
+  EpubWordProvider* self = static_cast<EpubWordProvider*>(param);
+  self->runPrefetchWorker();
+#ifdef ARDUINO
+  // Last access to the provider: once given, it may be destroyed
+  xSemaphoreGive(self->prefetchExited_);
+  vTaskDelete(nullptr);
+#endif
+}
+
+void EpubWordProvider::runPrefetchWorker() {
+  while (true) {
+    // Read before dequeuing, so a cancel racing with the dequeue is seen
+    const uint32_t generation = prefetchCancelGeneration_;
+    int chapter = prefetchNext_.exchange(-1);
+    if (chapter < 0) {
+      chapter = prefetchPrev_.exchange(-1);
+    }
+    if (chapter < 0) {
+      prefetchRunning_ = false;
+      // Catch a request queued between the check above and clearing the flag
+      // (the provider outlives this: its destructor joins the worker)
+      bool expected = false;
+      if ((prefetchNext_ >= 0 || prefetchPrev_ >= 0) && prefetchRunning_.compare_exchange_strong(expected, true)) {
+        continue;
+      }
+      return;
+    }
+
+    String fullHref;
+    if (!getChapterHref(chapter, fullHref)) {
+      continue;
+    }
+    if (ESP.getFreeHeap() < PREFETCH_MIN_FREE_HEAP) {
+      Serial.printf("  Prefetch of chapter %d skipped: low memory (%u bytes free)\n", chapter,
+                    (unsigned)ESP.getFreeHeap());
+      continue;
+    }
+
+    lockConversion();
+    if (!isPrefetchCancelled(chapter, generation)) {
+      backgroundConversion_ = true;
+      backgroundChapter_ = chapter;
+      backgroundGeneration_ = generation;
+      String txtPath;
+      ConversionTimings t;
+      if (convertXhtmlStreamToTxt(fullHref.c_str(), txtPath, &t)) {
+        Serial.printf("  Prefetched chapter %d: %s  —  %lu ms, %u bytes\n", chapter, txtPath.c_str(), t.total,
+                      (unsigned int)t.bytes);
+      }
+      backgroundConversion_ = false;
+    }
+    unlockConversion();
+  }
+}
+
+void EpubWordProvider::cancelPrefetch(int keepChapter) {
+  prefetchNext_ = -1;
+  prefetchPrev_ = -1;
+  prefetchKeep_ = keepChapter;
+  prefetchCancelGeneration_++;
+}
+
+void EpubWordProvider::waitForPrefetchWorker() {
+#ifdef ARDUINO
+  if (prefetchTaskStarted_) {
+    xSemaphoreTake(prefetchExited_, portMAX_DELAY);
+    prefetchTaskStarted_ = false;
+  }
+#else
+  if (prefetchThread_.joinable()) {
+    prefetchThread_.join();
+  }
+  prefetchRunning_ = false;
+#endif
+}
+
 int EpubWordProvider::getChapterCount() {
   if (!epubReader_) {
     return 1;  // Single XHTML file = 1 chapter
@@ -1256,6 +1620,12 @@ StyledWord EpubWordProvider::getPrevWord() {
 uint32_t EpubWordProvider::getPercentage() {
   if (!fileProvider_)
     return 10000;
+  // The book container knows exact text offsets
+  if (bookContainer_.isOpen() && bookContainer_.getTextSize() > 0) {
+    size_t absolutePosition =
+        bookContainer_.getChapterOffset(currentChapter_) + static_cast<size_t>(fileProvider_->getCurrentIndex());
+    return (uint32_t)((uint64_t)absolutePosition * 10000 / bookContainer_.getTextSize());
+  }
   // For EPUBs, calculate book-wide percentage using chapter offset
   if (isEpub_ && epubReader_) {
     size_t totalSize = epubReader_->getTotalBookSize();
@@ -1273,6 +1643,10 @@ uint32_t EpubWordProvider::getPercentage() {
 uint32_t EpubWordProvider::getPercentage(int index) {
   if (!fileProvider_)
     return 10000;
+  if (bookContainer_.isOpen() && bookContainer_.getTextSize() > 0) {
+    size_t absolutePosition = bookContainer_.getChapterOffset(currentChapter_) + static_cast<size_t>(index);
+    return (uint32_t)((uint64_t)absolutePosition * 10000 / bookContainer_.getTextSize());
+  }
   if (isEpub_ && epubReader_) {
     size_t totalSize = epubReader_->getTotalBookSize();
     if (totalSize == 0)
@@ -1345,6 +1719,13 @@ Language EpubWordProvider::getLanguage() const {
   return stringToLanguage(langStr);
 }
 
+String EpubWordProvider::getLanguageTag() const {
+  if (!isEpub_ || !epubReader_) {
+    return String("");
+  }
+  return epubReader_->getLanguage();
+}
+
 String EpubWordProvider::getCoverImagePath() const {
   if (!isEpub_ || !epubReader_) {
     return String("");
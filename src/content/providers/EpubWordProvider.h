@@ -3,14 +3,27 @@
 
 #include <SD.h>
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#else
+#include <mutex>
+#include <thread>
+#endif
+
 #include "../../text/hyphenation/HyphenationStrategy.h"
+#include "../epub/BookContainer.h"
 #include "../epub/EpubReader.h"
 #include "../xml/SimpleXmlParser.h"
 #include "FileWordProvider.h"
 #include "StringWordProvider.h"
+#include "StyleRuns.h"
+#include "TxtOutputBuffer.h"
 #include "WordProvider.h"
 
 class EpubWordProvider : public WordProvider {
@@ -51,9 +64,19 @@ class EpubWordProvider : public WordProvider {
     return currentChapterName_;
   }
   String getChapterName(int chapterIndex) override;
+  String getChapterFilePath() override {
+    // Chapters share the container file, so give each one its own key
+    if (bookContainer_.isOpen())
+      return bookContainer_.getPath() + "#" + String((unsigned long)currentChapter_, 10);
+    if (fileProvider_)
+      return fileProvider_->getChapterFilePath();
+    return String("");
+  }
 
   // Get the language of the EPUB for hyphenation
   Language getLanguage() const;
+  // The EPUB's language tag as written (e.g. "en-GB"), empty if unknown
+  String getLanguageTag() const;
 
   String getCoverImagePath() const;
 
@@ -76,6 +99,44 @@ class EpubWordProvider : public WordProvider {
     return useStreamingConversion_;
   }
 
+  // Background pre-conversion of the chapters around the one being read.
+  // After a chapter opens, chapter N+1 (and N-1 if enabled) is converted to
+  // its .txt cache on a low-priority worker, so crossing into it takes the
+  // "reuse existing TXT" path instead of a full conversion.
+  void setPrefetchEnabled(bool enabled) {
+    prefetchEnabled_ = enabled;
+  }
+  void setPrefetchPrevious(bool enabled) {
+    prefetchPrevious_ = enabled;
+  }
+
+  // Whole-book container mode. On the first chapter open every chapter is
+  // converted once and stitched into one indexed file in the extract
+  // directory; chapter switches then seek inside that open file and the book
+  // percentage uses exact text offsets. Falls back to per-chapter TXT files
+  // if the container can't be built.
+  void setUseBookContainer(bool enabled) {
+    useBookContainer_ = enabled;
+  }
+  bool isUsingBookContainer() const {
+    return bookContainer_.isOpen();
+  }
+
+  // Style-run mode (set before opening chapters): chapters are converted to
+  // plain text plus a sidecar run table instead of text with inline ESC
+  // tokens, and read in FileWordProvider's style-run mode. The book container
+  // keeps the token format.
+  void setUseStyleRuns(bool enabled) {
+    useStyleRuns_ = enabled;
+  }
+
+  // Record inflate checkpoints (every 64 KB of output) while converting
+  // compressed chapters, so later readers of the same entry can use
+  // epub_seek_stream() instead of inflating from the start.
+  void setRecordInflateCheckpoints(bool enabled) {
+    recordInflateCheckpoints_ = enabled;
+  }
+
  private:
   struct ConversionTimings {
     unsigned long startStream = 0;
@@ -87,21 +148,47 @@ class EpubWordProvider : public WordProvider {
     unsigned long closeOut = 0;
     unsigned long total = 0;
     size_t bytes = 0;
+    uint32_t bytesPerSecond = 0;  // XHTML input bytes per second of `conversion`
+    uint32_t peakHeap = 0;        // Most heap in use by the conversion (parser, stream and output buffers)
   };
   // Opens a specific chapter (spine item) for reading
   bool openChapter(int chapterIndex);
 
+  // Book container: open (building it first if needed) and read chapters from it
+  bool openBookContainer();
+  bool buildBookContainer(const String& path);
+  bool openChapterFromContainer(int chapterIndex);
+
+  // Path of a spine item inside the EPUB (hrefs are relative to content.opf)
+  bool getChapterHref(int chapterIndex, String& outHref);
+
+  // Queue background conversion of the neighbours of `chapterIndex`
+  void schedulePrefetch(int chapterIndex);
+  // Worker body: converts queued chapters until the queue is empty
+  void runPrefetchWorker();
+  static void prefetchTaskTrampoline(void* param);
+  // Cancel queued and in-flight prefetches that are not `keepChapter` (-1 = all)
+  void cancelPrefetch(int keepChapter);
+  // Worker side: whether a cancelPrefetch() since `generation` was read covers `chapter`
+  bool isPrefetchCancelled(int chapter, uint32_t generation) const {
+    return prefetchCancelGeneration_ != generation && prefetchKeep_ != chapter;
+  }
+  // Block until the worker has exited
+  void waitForPrefetchWorker();
+  void lockConversion();
+  void unlockConversion();
+
   // Helper to check if an element is a block-level element
-  bool isBlockElement(const String& name);
+  bool isBlockElement(XmlTag tag);
 
   // Helper to check if an element's content should be skipped (head, title, style, script)
-  bool isSkippedElement(const String& name);
+  bool isSkippedElement(XmlTag tag);
 
   // Helper to check if an element is a header element (h1-h6)
-  bool isHeaderElement(const String& name);
+  bool isHeaderElement(XmlTag tag);
 
   // Helper to check if an element is an inline style element (b, strong, i, em, span)
-  bool isInlineStyleElement(const String& name);
+  bool isInlineStyleElement(XmlTag tag);
 
   // Convert an XHTML file to a plain-text file suitable for FileWordProvider.
   bool convertXhtmlToTxt(const String& srcPath, String& outTxtPath, ConversionTimings* timings = nullptr);
@@ -111,20 +198,27 @@ class EpubWordProvider : public WordProvider {
 
   // Common conversion logic used by both convertXhtmlToTxt and convertXhtmlStreamToTxt
   // If outBytes is provided, it will be set to the number of bytes written to `out`.
-  void performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes = nullptr);
+  // Returns false if a background conversion was cancelled part way (or the output buffer can't be allocated).
+  // With `styleRuns`, tokens are stripped from the output and recorded as runs instead.
+  // If minFreeHeap is provided, it is lowered to the least free heap seen during the conversion.
+  bool performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes = nullptr,
+                                   StyleRunEncoder* styleRuns = nullptr, uint32_t* minFreeHeap = nullptr);
+
+  // Output TXT path for an XHTML path (extension replaced for the current format)
+  String getConvertedTxtPath(const String& xhtmlPath) const;
 
   // Emit style properties for a paragraph's classes and inline styles as an escaped token written to buffer
-  void writeParagraphStyleToken(String& writeBuffer, const String& pendingParagraphClasses,
+  void writeParagraphStyleToken(TxtOutputBuffer& writeBuffer, const String& pendingParagraphClasses,
                                 const String& pendingInlineStyle, bool& paragraphClassesWritten,
                                 std::vector<char>& paragraphStyleEmitted);
 
   // Emit inline style token (for bold/italic elements like <b>, <i>, <em>, <strong>, <span>)
   // Returns the uppercase command char emitted (e.g. 'B','I','X') or '\0' if none
-  char writeInlineStyleToken(String& writeBuffer, const String& elementName, const String& classAttr,
+  char writeInlineStyleToken(TxtOutputBuffer& writeBuffer, XmlTag tag, const String& classAttr,
                              const String& styleAttr);
 
   // Close an inline style element (called when an inline element ends)
-  void closeInlineStyleElement(String& writeBuffer);
+  void closeInlineStyleElement(TxtOutputBuffer& writeBuffer);
 
   // Track active inline style stack for correct combined styling (bold+italic = 'X')
   struct InlineStyleState {
@@ -151,23 +245,27 @@ class EpubWordProvider : public WordProvider {
   void updateEffectiveInlineCombined();
 
   // Emit style reset token (to return to normal after inline style element closes)
-  void writeStyleResetToken(String& writeBuffer, char startCmd);
+  void writeStyleResetToken(TxtOutputBuffer& writeBuffer, char startCmd);
 
   // Ensure that the currently-emitted inline style in the output buffer matches
   // the effective inline style state (`currentInlineCombined_`). This will emit
   // the necessary reset/open tokens just before writing visible text.
-  void ensureInlineStyleEmitted(String& writeBuffer);
+  void ensureInlineStyleEmitted(TxtOutputBuffer& writeBuffer);
 
   // Helper to create directories recursively for a given path
   bool createDirRecursive(const String& path);
 
   // Text processing helpers
-  bool isInsideSkippedElement(const std::vector<String>& elementStack);
-  String readAndDecodeText(SimpleXmlParser& parser);
-  String decodeHtmlEntity(const String& entity);
-  String normalizeWhitespace(const String& text);
+  // Decode the current text node straight into `out` in one pass over the
+  // parser's text spans: entities decoded, CR dropped, whitespace and nbsp
+  // collapsed into single spaces (leading spaces dropped when `atLineStart`).
+  // `beforeText` runs once, right before the node's first byte, so style
+  // tokens are only written for nodes that have text; `wroteText` tells
+  // whether it ran. Returns true if the text contained a non-breaking space.
+  template <typename BeforeText>
+  bool decodeTextNode(SimpleXmlParser& parser, bool atLineStart, TxtOutputBuffer& out, BeforeText& beforeText,
+                      bool& wroteText);
   void trimTrailingSpaces(String& buffer);
-  String trimLeadingSpaces(const String& text);
 
   bool valid_ = false;
   bool isEpub_ = false;                 // True if source is EPUB, false if direct XHTML
@@ -184,8 +282,39 @@ class EpubWordProvider : public WordProvider {
   // Underlying provider that reads the converted plain-text chapter files
   FileWordProvider* fileProvider_ = nullptr;
 
+  bool useStyleRuns_ = false;
+  bool recordInflateCheckpoints_ = false;
+  bool useBookContainer_ = false;
+  BookContainer bookContainer_;
+
   size_t fileSize_;          // Total file size for percentage calculation
   size_t currentIndex_ = 0;  // Current index/offset (seeking disabled; tracked locally)
+
+  // Chapter prefetch. Every conversion (foreground or background) holds the
+  // conversion lock: the converter state above and the EpubReader's file
+  // handle are not safe to share between two conversions.
+#ifdef ARDUINO
+  SemaphoreHandle_t conversionLock_ = nullptr;
+  // Given by the worker task as its last access to the provider; taken (like
+  // a thread join) before starting another worker and before destruction
+  SemaphoreHandle_t prefetchExited_ = nullptr;
+  bool prefetchTaskStarted_ = false;  // A worker task was started and not yet joined
+#else
+  std::mutex conversionLock_;
+  std::thread prefetchThread_;
+#endif
+  bool prefetchEnabled_ = true;
+  bool prefetchPrevious_ = false;
+  std::atomic<int> prefetchNext_{-1};      // Queued chapters (-1 = none)
+  std::atomic<int> prefetchPrev_{-1};
+  std::atomic<bool> prefetchRunning_{false};
+  // Every cancelPrefetch() stores the chapter it keeps, then bumps the
+  // generation; the worker reads the generation before it dequeues a chapter
+  std::atomic<int> prefetchKeep_{-1};
+  std::atomic<uint32_t> prefetchCancelGeneration_{0};
+  bool backgroundConversion_ = false;  // Set while the worker owns the conversion lock
+  int backgroundChapter_ = -1;         // Chapter and generation of the worker's conversion
+  uint32_t backgroundGeneration_ = 0;
 };
 
 #endif
@@ -2,6 +2,9 @@
 
 #include <Arduino.h>
 
+#include <algorithm>
+#include <utility>
+
 #include "WString.h"
 
 // ESC-based format constants:
@@ -137,7 +140,7 @@ static bool isEscCommandChar(char cmd) {
   return tryGetAlignmentStart(cmd, nullptr) || tryGetAlignmentEnd(cmd, nullptr) || tryGetStyleForward(cmd, nullptr);
 }
 
-FileWordProvider::FileWordProvider(const char* path, size_t bufSize) : bufSize_(bufSize) {
+FileWordProvider::FileWordProvider(const char* path, size_t bufSize) : path_(path), bufSize_(bufSize) {
   file_ = SD.open(path);
   if (!file_) {
     fileSize_ = 0;
@@ -163,6 +166,50 @@ FileWordProvider::~FileWordProvider() {
     free(buf_);
 }
 
+bool FileWordProvider::setRange(size_t start, size_t length) {
+  if (!file_)
+    return false;
+  const size_t total = file_.size();
+  if (start > total)
+    return false;
+  rangeStart_ = start;
+  fileSize_ = std::min(length, total - start);
+  paragraphStarts_.clear();
+  styleRuns_.close();
+  bufStart_ = 0;
+  bufLen_ = 0;
+  index_ = 0;
+  prevIndex_ = 0;
+  currentInlineStyle_ = FontStyle::REGULAR;
+  skipUtf8BomIfPresent();
+  computeParagraphAlignmentForPosition(index_);
+  return true;
+}
+
+void FileWordProvider::setParagraphStarts(std::vector<uint32_t> starts) {
+  paragraphStarts_ = std::move(starts);
+}
+
+bool FileWordProvider::loadStyleRuns(const char* runsPath) {
+  styleRuns_.close();
+  // Run offsets cover the whole file
+  if (!file_ || rangeStart_ != 0 || fileSize_ != file_.size() ||
+      !styleRuns_.open(runsPath, (uint32_t)fileSize_)) {
+    return false;
+  }
+  restoreStyleContext();
+  computeParagraphAlignmentForPosition(index_);
+  return true;
+}
+
+size_t FileWordProvider::runAt(size_t pos) {
+  return styleRuns_.find((uint32_t)pos);
+}
+
+size_t FileWordProvider::runEnd(size_t run) {
+  return styleRuns_.end(run);
+}
+
 bool FileWordProvider::hasNextWord() {
   return index_ < fileSize_;
 }
@@ -194,9 +241,9 @@ bool FileWordProvider::ensureBufferForPos(size_t pos) {
       start = 0;
   }
 
-  if (!file_.seek(start))
+  if (!file_.seek(rangeStart_ + start))
     return false;
-  size_t r = file_.read(buf_, bufSize_);
+  size_t r = file_.read(buf_, std::min(bufSize_, fileSize_ - start));
   if (r == 0)
     return false;
   bufStart_ = start;
@@ -208,7 +255,8 @@ bool FileWordProvider::ensureBufferForPos(size_t pos) {
 // Returns 2 if valid ESC token, 0 otherwise
 // If processStyle is false, only checks validity without modifying state.
 size_t FileWordProvider::parseEscTokenAtPos(size_t pos, TextAlign* outAlignment, bool processStyle) {
-  if (pos + 1 >= fileSize_)
+  // Style-run text has no tokens
+  if (pos + 1 >= fileSize_ || styleRuns_.isOpen())
     return 0;
   char c = charAt(pos);
   if (c != ESC_CHAR)
@@ -300,6 +348,8 @@ bool FileWordProvider::isAtEscTokenEnd(size_t pos, size_t& tokenStart) {
 }
 
 StyledWord FileWordProvider::getNextWord() {
+  if (styleRuns_.isOpen())
+    return getNextWordFromRuns();
   prevIndex_ = index_;
 
   if (index_ >= fileSize_) {
@@ -386,6 +436,8 @@ StyledWord FileWordProvider::getNextWord() {
 }
 
 StyledWord FileWordProvider::getPrevWord() {
+  if (styleRuns_.isOpen())
+    return getPrevWordFromRuns();
   prevIndex_ = index_;
 
   if (index_ == 0) {
@@ -525,6 +577,96 @@ StyledWord FileWordProvider::getPrevWord() {
   return StyledWord(token, styleForWord);
 }
 
+// Style-run mode: words end at whitespace and at run boundaries (where the
+// token format had a token); style and alignment come from the word's run
+StyledWord FileWordProvider::getNextWordFromRuns() {
+  prevIndex_ = index_;
+
+  while (index_ < fileSize_ && charAt(index_) == '\r') {
+    index_++;
+  }
+  if (index_ >= fileSize_) {
+    return StyledWord();
+  }
+
+  const size_t run = runAt(index_);
+  const size_t end = runEnd(run);
+  const StyleRun styleRun = styleRuns_.at(run);
+  currentInlineStyle_ = styleRun.getStyle();
+  currentParagraphAlignment_ = styleRun.getAlign();
+
+  char c = charAt(index_);
+  String token;
+  if (c == ' ' || c == '\n' || c == '\t') {
+    token += c;
+    index_++;
+    if (c == '\n') {
+      currentParagraphAlignment_ = TextAlign::None;
+    }
+  } else {
+    while (index_ < end) {
+      char cc = charAt(index_);
+      if (cc == '\r') {
+        index_++;
+        continue;
+      }
+      if (cc == ' ' || cc == '\n' || cc == '\t') {
+        break;
+      }
+      token += cc;
+      index_++;
+    }
+  }
+  return StyledWord(token, currentInlineStyle_);
+}
+
+StyledWord FileWordProvider::getPrevWordFromRuns() {
+  prevIndex_ = index_;
+
+  if (index_ == 0) {
+    return StyledWord();
+  }
+  index_--;
+  while (index_ > 0 && charAt(index_) == '\r') {
+    index_--;
+  }
+
+  const size_t run = runAt(index_);
+  const StyleRun styleRun = styleRuns_.at(run);
+  const size_t runStart = styleRun.offset;
+  currentInlineStyle_ = styleRun.getStyle();
+  currentParagraphAlignment_ = styleRun.getAlign();
+
+  char c = charAt(index_);
+  String token;
+  if (c == ' ' || c == '\n' || c == '\t') {
+    token += c;
+    if (c == '\n') {
+      currentParagraphAlignment_ = TextAlign::None;
+    }
+  } else {
+    size_t tokenStart = index_;
+    while (tokenStart > runStart) {
+      char prevChar = charAt(tokenStart - 1);
+      if (prevChar == ' ' || prevChar == '\n' || prevChar == '\t' || prevChar == '\r') {
+        break;
+      }
+      tokenStart--;
+    }
+    if (tokenStart == 0 && hasUtf8BomAtStart()) {
+      tokenStart = 3;
+    }
+    for (size_t i = tokenStart; i <= index_; i++) {
+      char cc = charAt(i);
+      if (cc != '\r') {
+        token += cc;
+      }
+    }
+    index_ = tokenStart;
+  }
+  return StyledWord(token, currentInlineStyle_);
+}
+
 StyledWord FileWordProvider::scanWord(int direction) {
   // Legacy function - redirect to new implementations
   if (direction == 1) {
@@ -642,16 +784,8 @@ TextAlign FileWordProvider::getParagraphAlignment() {
 
 void FileWordProvider::findParagraphBoundaries(size_t pos, size_t& outStart, size_t& outEnd) {
   // Paragraphs are delimited by newlines
-  // Find start: scan backwards to find newline or beginning of file
-  outStart = 0;
-  if (pos > 0) {
-    for (size_t i = pos; i > 0; --i) {
-      if (charAt(i - 1) == '\n') {
-        outStart = i;
-        break;
-      }
-    }
-  }
+  // Find start: previous newline or beginning of file
+  outStart = findParagraphStart(pos);
 
   // Find end: scan forwards to find newline or end of file
   outEnd = fileSize_;
@@ -663,12 +797,37 @@ void FileWordProvider::findParagraphBoundaries(size_t pos, size_t& outStart, siz
   }
 }
 
+size_t FileWordProvider::findParagraphStart(size_t pos) {
+  if (!paragraphStarts_.empty()) {
+    // Last known start at or before pos
+    auto it = std::upper_bound(paragraphStarts_.begin(), paragraphStarts_.end(), (uint32_t)pos);
+    return it == paragraphStarts_.begin() ? 0 : *(it - 1);
+  }
+  for (size_t i = pos; i > 0; --i) {
+    if (charAt(i - 1) == '\n') {
+      return i;
+    }
+  }
+  return 0;
+}
+
 void FileWordProvider::computeParagraphAlignmentForPosition(size_t pos) {
   // Default to None (no alignment)
   currentParagraphAlignment_ = TextAlign::None;
   if (fileSize_ == 0)
     return;
 
+  if (styleRuns_.isOpen()) {
+    // Like the token scan below: None at a paragraph start, otherwise the
+    // alignment of the text just before pos
+    if (pos > fileSize_)
+      pos = fileSize_;
+    if (pos > 0 && charAt(pos - 1) != '\n') {
+      currentParagraphAlignment_ = styleRuns_.at(runAt(pos - 1)).getAlign();
+    }
+    return;
+  }
+
   // If pos is beyond size, clamp
   if (pos >= fileSize_)
     pos = fileSize_ - 1;
@@ -729,17 +888,17 @@ void FileWordProvider::restoreStyleContext() {
   // Reset style to default first
   currentInlineStyle_ = FontStyle::REGULAR;
 
+  if (styleRuns_.isOpen()) {
+    if (index_ < fileSize_)
+      currentInlineStyle_ = styleRuns_.at(runAt(index_)).getStyle();
+    return;
+  }
+
   if (index_ == 0 || fileSize_ == 0)
     return;
 
   // Find paragraph start (newline boundary)
-  size_t paraStart = 0;
-  for (size_t i = index_; i > 0; --i) {
-    if (charAt(i - 1) == '\n') {
-      paraStart = i;
-      break;
-    }
-  }
+  size_t paraStart = findParagraphStart(index_);
 
   // Scan forward from paragraph start to current position, processing style tokens
   size_t scanPos = paraStart;
@@ -4,7 +4,9 @@
 #include <SD.h>
 
 #include <cstdint>
+#include <vector>
 
+#include "StyleRuns.h"
 #include "WordProvider.h"
 
 class FileWordProvider : public WordProvider {
@@ -35,14 +37,47 @@ class FileWordProvider : public WordProvider {
   // Paragraph alignment support
   TextAlign getParagraphAlignment() override;
 
+  String getChapterFilePath() override {
+    return path_;
+  }
+
+  // Restrict reading to `length` bytes starting at file offset `start`; all
+  // indices become relative to `start`. Used to read one chapter out of a
+  // whole-book container while keeping the file open. Resets the position.
+  bool setRange(size_t start, size_t length);
+
+  // Known paragraph start offsets (sorted, relative to the range). When set,
+  // paragraph boundaries are found by binary search instead of scanning back
+  // for the previous newline. Cleared by setRange().
+  void setParagraphStarts(std::vector<uint32_t> starts);
+
+  // Style-run mode: the file holds plain text and styling comes from a
+  // sidecar run table (see StyleRuns.h), read from SD through a small window.
+  // Style and alignment at any offset are found by binary search, so seeks
+  // and backward reads don't scan for or parse ESC tokens. Fails (leaving token mode) if the table doesn't match.
+  bool loadStyleRuns(const char* runsPath);
+  bool hasStyleRuns() const {
+    return styleRuns_.isOpen();
+  }
+
  private:
   StyledWord scanWord(int direction);
 
+  // Style-run mode word readers and run lookup
+  StyledWord getNextWordFromRuns();
+  StyledWord getPrevWordFromRuns();
+  size_t runAt(size_t pos);
+  size_t runEnd(size_t run);
+
   bool ensureBufferForPos(size_t pos);
   char charAt(size_t pos);
 
   File file_;
-  size_t fileSize_ = 0;
+  String path_;
+  size_t rangeStart_ = 0;  // file offset of index 0
+  size_t fileSize_ = 0;    // readable bytes from rangeStart_
+  std::vector<uint32_t> paragraphStarts_;
+  StyleRunReader styleRuns_;
   size_t index_ = 0;
   size_t prevIndex_ = 0;
 
@@ -57,6 +92,8 @@ class FileWordProvider : public WordProvider {
   // Current inline font style (updated when parsing [style=...] tokens)
   FontStyle currentInlineStyle_ = FontStyle::REGULAR;
 
+  // Start of the paragraph containing `pos` (position after the previous newline)
+  size_t findParagraphStart(size_t pos);
   // Find paragraph boundaries containing the given position
   void findParagraphBoundaries(size_t pos, size_t& outStart, size_t& outEnd);
   // Update the paragraph alignment cache for current position
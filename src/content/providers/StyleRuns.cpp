@@ -0,0 +1,334 @@
+#include "StyleRuns.h"
+
+#include <algorithm>
+#include <cstring>
+
+static constexpr char ESC_CHAR = '\x1B';
+static const char STYLE_RUNS_MAGIC[4] = {'E', 'S', 'R', 'N'};
+static constexpr uint8_t STYLE_RUNS_VERSION = 2;
+static constexpr size_t STYLE_RUNS_HEADER_SIZE = 8;
+static constexpr size_t STYLE_RUNS_RECORD_SIZE = 8;
+static constexpr size_t STYLE_RUNS_TRAILER_SIZE = 8;
+static constexpr uint32_t MAX_INDENT = 255;
+
+static void runsPutU32(uint8_t* p, uint32_t v) {
+  p[0] = (uint8_t)(v & 0xFF);
+  p[1] = (uint8_t)((v >> 8) & 0xFF);
+  p[2] = (uint8_t)((v >> 16) & 0xFF);
+  p[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t runsGetU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Returns false if the record holds an unknown style or alignment
+static bool decodeRun(const uint8_t* p, StyleRun& run) {
+  run = {runsGetU32(p), p[4], p[5], p[6], 0};
+  return p[4] <= (uint8_t)FontStyle::HIDDEN && p[5] <= (uint8_t)TextAlign::Justify;
+}
+
+StyleRunEncoder::StyleRunEncoder() {
+  runs_.push_back({0, (uint8_t)FontStyle::REGULAR, (uint8_t)TextAlign::None, 0, 0});
+}
+
+StyleRunEncoder::StyleRunEncoder(File& out) : StyleRunEncoder() {
+  out_ = &out;
+}
+
+void StyleRunEncoder::startRun() {
+  // Consecutive tokens at the same offset collapse into one run
+  if (runs_.back().offset == textSize_) {
+    runs_.back().style = (uint8_t)style_;
+    runs_.back().align = (uint8_t)align_;
+    runs_.back().indent = 0;
+  } else {
+    runs_.push_back({textSize_, (uint8_t)style_, (uint8_t)align_, 0, 0});
+  }
+  if (out_ && runs_.size() > WRITE_BATCH_RUNS) {
+    writeRuns(false);
+  }
+}
+
+void StyleRunEncoder::writeRuns(bool all) {
+  // The last run may still collapse with the next token, and an open hidden
+  // run still gets its indent length (which stops growing at MAX_INDENT)
+  size_t count = all ? runs_.size() : runs_.size() - 1;
+  if (!all && hiddenRun_ < runs_.size()) {
+    if (textSize_ - runs_[hiddenRun_].offset >= MAX_INDENT) {
+      runs_[hiddenRun_].indent = (uint8_t)MAX_INDENT;
+      hiddenRun_ = SIZE_MAX;
+    } else {
+      count = std::min(count, hiddenRun_);
+    }
+  }
+
+  if (!headerWritten_) {
+    uint8_t header[STYLE_RUNS_HEADER_SIZE] = {0};
+    memcpy(header, STYLE_RUNS_MAGIC, 4);
+    header[4] = STYLE_RUNS_VERSION;
+    writeFailed_ |= out_->write(header, sizeof(header)) != sizeof(header);
+    headerWritten_ = true;
+  }
+  uint8_t data[WRITE_BATCH_RUNS * STYLE_RUNS_RECORD_SIZE];
+  for (size_t i = 0; i < count;) {
+    const size_t n = std::min(count - i, WRITE_BATCH_RUNS);
+    uint8_t* p = data;
+    for (size_t k = 0; k < n; k++, p += STYLE_RUNS_RECORD_SIZE) {
+      const StyleRun& run = runs_[i + k];
+      runsPutU32(p, run.offset);
+      p[4] = run.style;
+      p[5] = run.align;
+      p[6] = run.indent;
+      p[7] = 0;
+    }
+    const size_t bytes = n * STYLE_RUNS_RECORD_SIZE;
+    writeFailed_ |= out_->write(data, bytes) != bytes;
+    i += n;
+  }
+  runsWritten_ += (uint32_t)count;
+  runs_.erase(runs_.begin(), runs_.begin() + count);
+  if (hiddenRun_ != SIZE_MAX) {
+    hiddenRun_ = hiddenRun_ < count ? SIZE_MAX : hiddenRun_ - count;
+  }
+}
+
+bool StyleRunEncoder::finish() {
+  if (!out_) {
+    return true;
+  }
+  writeRuns(true);
+  uint8_t trailer[STYLE_RUNS_TRAILER_SIZE];
+  runsPutU32(trailer, runsWritten_);
+  runsPutU32(trailer + 4, textSize_);
+  writeFailed_ |= out_->write(trailer, sizeof(trailer)) != sizeof(trailer);
+  return !writeFailed_;
+}
+
+void StyleRunEncoder::feed(const char* data, size_t len, std::vector<char>& outText) {
+  outText.reserve(outText.size() + len);
+  for (size_t i = 0; i < len; i++) {
+    const char c = data[i];
+    if (!pendingEsc_) {
+      if (c == ESC_CHAR) {
+        pendingEsc_ = true;
+      } else {
+        outText.push_back(c);
+        textSize_++;
+      }
+      continue;
+    }
+    pendingEsc_ = false;
+
+    // Same command set as the token reader in FileWordProvider
+    bool known = true;
+    switch (c) {
+      case 'L':
+        align_ = TextAlign::Left;
+        break;
+      case 'R':
+        align_ = TextAlign::Right;
+        break;
+      case 'C':
+        align_ = TextAlign::Center;
+        break;
+      case 'J':
+        align_ = TextAlign::Justify;
+        break;
+      case 'l':
+      case 'r':
+      case 'c':
+      case 'j':
+        align_ = TextAlign::None;
+        break;
+      case 'B':
+        style_ = FontStyle::BOLD;
+        break;
+      case 'I':
+        style_ = FontStyle::ITALIC;
+        break;
+      case 'X':
+        style_ = FontStyle::BOLD_ITALIC;
+        break;
+      case 'H':
+        style_ = FontStyle::HIDDEN;
+        break;
+      case 'b':
+      case 'i':
+      case 'x':
+      case 'h':
+        style_ = FontStyle::REGULAR;
+        break;
+      default:
+        known = false;
+        break;
+    }
+    if (!known) {
+      // Not a token: both bytes are text
+      outText.push_back(ESC_CHAR);
+      outText.push_back(c);
+      textSize_ += 2;
+      continue;
+    }
+
+    if (c == 'h' && hiddenRun_ < runs_.size()) {
+      // Record the indent length on the hidden run it closes
+      const uint32_t length = textSize_ - runs_[hiddenRun_].offset;
+      runs_[hiddenRun_].indent = (uint8_t)(length > 255 ? 255 : length);
+      hiddenRun_ = SIZE_MAX;
+    }
+    startRun();
+    if (c == 'H') {
+      hiddenRun_ = runs_.size() - 1;
+    }
+  }
+}
+
+bool StyleRunReader::open(const char* path, uint32_t textSize) {
+  close();
+  if (!SD.exists(path)) {
+    return false;
+  }
+  File f = SD.open(path);
+  if (!f) {
+    return false;
+  }
+  uint8_t header[STYLE_RUNS_HEADER_SIZE];
+  uint8_t trailer[STYLE_RUNS_TRAILER_SIZE];
+  const size_t fileSize = f.size();
+  bool ok = fileSize >= STYLE_RUNS_HEADER_SIZE + STYLE_RUNS_TRAILER_SIZE &&
+            f.read(header, sizeof(header)) == sizeof(header) && memcmp(header, STYLE_RUNS_MAGIC, 4) == 0 &&
+            header[4] == STYLE_RUNS_VERSION && f.seek(fileSize - STYLE_RUNS_TRAILER_SIZE) &&
+            f.read(trailer, sizeof(trailer)) == sizeof(trailer) && runsGetU32(trailer + 4) == textSize;
+  const uint32_t count = ok ? runsGetU32(trailer) : 0;
+  ok = ok && count > 0 &&
+       fileSize == STYLE_RUNS_HEADER_SIZE + (size_t)count * STYLE_RUNS_RECORD_SIZE + STYLE_RUNS_TRAILER_SIZE &&
+       f.seek(STYLE_RUNS_HEADER_SIZE);
+
+  // Runs must start at 0, be strictly increasing and stay inside the text
+  uint8_t data[WINDOW_RUNS * STYLE_RUNS_RECORD_SIZE];
+  uint32_t previous = 0;
+  for (uint32_t i = 0; ok && i < count;) {
+    const size_t n = std::min((size_t)(count - i), WINDOW_RUNS);
+    ok = f.read(data, n * STYLE_RUNS_RECORD_SIZE) == n * STYLE_RUNS_RECORD_SIZE;
+    for (size_t k = 0; ok && k < n; k++, i++) {
+      StyleRun run;
+      ok = decodeRun(data + k * STYLE_RUNS_RECORD_SIZE, run) && (i == 0 ? run.offset == 0 : run.offset > previous) &&
+           run.offset <= textSize;
+      previous = run.offset;
+    }
+  }
+  f.close();
+  if (!ok) {
+    return false;
+  }
+
+  path_ = path;
+  count_ = count;
+  textSize_ = textSize;
+  if (!loadWindow(0, nullptr)) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void StyleRunReader::close() {
+  path_ = String("");
+  count_ = 0;
+  textSize_ = 0;
+  windowStart_ = 0;
+  windowCount_ = 0;
+}
+
+bool StyleRunReader::loadWindow(size_t index, File* file) {
+  // Centered on the run, so reading on in either direction stays inside it
+  size_t first = index > WINDOW_RUNS / 2 ? index - WINDOW_RUNS / 2 : 0;
+  if (first + WINDOW_RUNS > count_) {
+    first = count_ > WINDOW_RUNS ? count_ - WINDOW_RUNS : 0;
+  }
+  const size_t n = std::min(WINDOW_RUNS, count_ - first);
+
+  File opened;
+  if (!file) {
+    opened = SD.open(path_.c_str());
+    if (!opened) {
+      return false;
+    }
+    file = &opened;
+  }
+  uint8_t data[WINDOW_RUNS * STYLE_RUNS_RECORD_SIZE];
+  const bool ok = file->seek(STYLE_RUNS_HEADER_SIZE + first * STYLE_RUNS_RECORD_SIZE) &&
+                  file->read(data, n * STYLE_RUNS_RECORD_SIZE) == n * STYLE_RUNS_RECORD_SIZE;
+  if (opened) {
+    opened.close();
+  }
+  if (!ok) {
+    return false;
+  }
+  for (size_t k = 0; k < n; k++) {
+    decodeRun(data + k * STYLE_RUNS_RECORD_SIZE, window_[k]);
+  }
+  windowStart_ = first;
+  windowCount_ = n;
+  return true;
+}
+
+StyleRun StyleRunReader::at(size_t index) {
+  if (!inWindow(index) && !loadWindow(index, nullptr)) {
+    return {0, (uint8_t)FontStyle::REGULAR, (uint8_t)TextAlign::None, 0, 0};
+  }
+  return window_[index - windowStart_];
+}
+
+uint32_t StyleRunReader::end(size_t index) {
+  return index + 1 < count_ ? at(index + 1).offset : textSize_;
+}
+
+size_t StyleRunReader::find(uint32_t offset) {
+  // Last run starting at or before offset. The window's last run only
+  // qualifies when it is the table's last run (its end is not loaded).
+  size_t lo = 0;
+  size_t hi = count_;
+  if (windowCount_ > 0) {
+    const bool tableEnd = windowStart_ + windowCount_ == count_;
+    if (offset < window_[0].offset) {
+      hi = windowStart_;
+    } else if (!tableEnd && offset >= window_[windowCount_ - 1].offset) {
+      lo = windowStart_ + windowCount_ - 1;
+    } else {
+      size_t wlo = 0;
+      size_t whi = tableEnd ? windowCount_ : windowCount_ - 1;
+      while (whi - wlo > 1) {
+        const size_t mid = (wlo + whi) / 2;
+        if (window_[mid].offset <= offset) {
+          wlo = mid;
+        } else {
+          whi = mid;
+        }
+      }
+      return windowStart_ + wlo;
+    }
+  }
+
+  // On SD, one offset per step, then the window around the result
+  File f = SD.open(path_.c_str());
+  if (!f) {
+    return lo;
+  }
+  uint8_t p[4];
+  while (hi - lo > 1) {
+    const size_t mid = (lo + hi) / 2;
+    if (!f.seek(STYLE_RUNS_HEADER_SIZE + mid * STYLE_RUNS_RECORD_SIZE) || f.read(p, sizeof(p)) != sizeof(p)) {
+      break;
+    }
+    if (runsGetU32(p) <= offset) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  loadWindow(lo, &f);
+  f.close();
+  return lo;
+}
@@ -0,0 +1,137 @@
+#ifndef STYLE_RUNS_H
+#define STYLE_RUNS_H
+
+#include <SD.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../css/CssStyle.h"
+#include "rendering/SimpleFont.h"
+
+/**
+ * Style runs - out-of-band styling for converted chapter text
+ *
+ * Instead of interleaving 2-byte ESC tokens with the text, the converter can
+ * write plain text plus a sidecar table of runs. Each run starts at a text
+ * offset and lasts until the next run; runs are sorted by offset and the
+ * first one starts at 0. A run starts wherever the token format had a token,
+ * so word boundaries are the same in both formats.
+ *
+ * Sidecar file (little endian): magic "ESRN", u8 version, u8[3] reserved,
+ * then per run u32 offset, u8 style, u8 alignment, u8 indent, u8 reserved,
+ * then u32 run count and u32 text size. The counts come last so the table
+ * can be appended while the chapter is converted; a file cut short fails to
+ * load.
+ */
+
+// One run, laid out like its record in the file
+struct StyleRun {
+  uint32_t offset;
+  uint8_t style;   // FontStyle
+  uint8_t align;   // TextAlign
+  uint8_t indent;  // Length of a hidden paragraph indent starting here (0 = none)
+  uint8_t reserved;
+
+  FontStyle getStyle() const {
+    return (FontStyle)style;
+  }
+  TextAlign getAlign() const {
+    return (TextAlign)align;
+  }
+};
+static_assert(sizeof(StyleRun) == 8, "A run is as large as its record");
+
+/**
+ * StyleRunEncoder - Splits ESC-token text into plain text and style runs
+ *
+ * Text can be fed in chunks of any size. Built with a file, finished runs are
+ * appended to it as they are produced, so only the few runs that may still
+ * change are held in memory; otherwise all runs are kept (see getRuns()).
+ */
+class StyleRunEncoder {
+ public:
+  StyleRunEncoder();
+  explicit StyleRunEncoder(File& out);
+
+  // Strip the tokens from `data`, appending the plain text to `outText` and
+  // recording a run at every token position
+  void feed(const char* data, size_t len, std::vector<char>& outText);
+
+  // Writes the runs still held and the file's counts. False if any write failed.
+  bool finish();
+
+  // All runs (without a file)
+  const std::vector<StyleRun>& getRuns() const {
+    return runs_;
+  }
+  uint32_t getTextSize() const {
+    return textSize_;
+  }
+
+ private:
+  // Runs written to the file in one go
+  static constexpr size_t WRITE_BATCH_RUNS = 32;
+
+  void startRun();
+  // Write the runs that can no longer change (all of them when finishing)
+  void writeRuns(bool all);
+
+  File* out_ = nullptr;
+  bool headerWritten_ = false;
+  bool writeFailed_ = false;
+  uint32_t runsWritten_ = 0;
+  std::vector<StyleRun> runs_;  // With a file: the runs not written yet
+  uint32_t textSize_ = 0;
+  FontStyle style_ = FontStyle::REGULAR;
+  TextAlign align_ = TextAlign::None;
+  size_t hiddenRun_ = SIZE_MAX;  // Run opened by the last hidden-on token (index in runs_)
+  bool pendingEsc_ = false;
+};
+
+/**
+ * StyleRunReader - Looks up runs in a sidecar file on SD
+ *
+ * Holds a small window of runs; lookups outside it binary-search the file
+ * (reading one offset per step) and load the window around the result, so
+ * memory use does not depend on the chapter's run count.
+ */
+class StyleRunReader {
+ public:
+  // Checks the table (one sequential read) against a text of `textSize` bytes
+  bool open(const char* path, uint32_t textSize);
+  void close();
+
+  bool isOpen() const {
+    return count_ > 0;
+  }
+  size_t size() const {
+    return count_;
+  }
+
+  // Run `index` (< size())
+  StyleRun at(size_t index);
+  // Where run `index` ends: the next run's offset, or the text size
+  uint32_t end(size_t index);
+  // Index of the run containing `offset`
+  size_t find(uint32_t offset);
+
+ private:
+  static constexpr size_t WINDOW_RUNS = 32;
+
+  // Load the window around run `index`, reading from `file` if it is open
+  bool loadWindow(size_t index, File* file);
+  bool inWindow(size_t index) const {
+    return index >= windowStart_ && index < windowStart_ + windowCount_;
+  }
+
+  String path_;
+  uint32_t count_ = 0;
+  uint32_t textSize_ = 0;
+  StyleRun window_[WINDOW_RUNS];
+  size_t windowStart_ = 0;
+  size_t windowCount_ = 0;
+};
+
+#endif
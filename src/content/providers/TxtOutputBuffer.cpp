@@ -0,0 +1,90 @@
+#include "TxtOutputBuffer.h"
+
+#include <cstring>
+
+#include "StyleRuns.h"
+
+static_assert(TxtOutputBuffer::CAPACITY % TxtOutputBuffer::SECTOR_SIZE == 0, "Ring holds whole sectors");
+
+TxtOutputBuffer::TxtOutputBuffer(File& out, StyleRunEncoder* styleRuns)
+    : out_(out), styleRuns_(styleRuns), buffer_((char*)malloc(CAPACITY)) {
+  if (!buffer_) {
+    Serial.printf("  [MEM] TxtOutputBuffer: FAILED to allocate %u bytes, Free=%u\n", (unsigned)CAPACITY,
+                  ESP.getFreeHeap());
+  }
+}
+
+TxtOutputBuffer::~TxtOutputBuffer() {
+  free(buffer_);
+}
+
+void TxtOutputBuffer::append(const char* data, size_t length) {
+  while (length > 0) {
+    if (head_ - tail_ == CAPACITY) {
+      writeSectors();
+    }
+    // Copy up to the end of the ring or the free space, whichever comes first
+    const size_t index = head_ % CAPACITY;
+    size_t n = CAPACITY - (head_ - tail_);
+    if (n > CAPACITY - index) {
+      n = CAPACITY - index;
+    }
+    if (n > length) {
+      n = length;
+    }
+    memcpy(buffer_ + index, data, n);
+    head_ += n;
+    data += n;
+    length -= n;
+  }
+}
+
+TxtOutputBuffer& TxtOutputBuffer::operator+=(const char* str) {
+  if (str) {
+    append(str, strlen(str));
+  }
+  return *this;
+}
+
+void TxtOutputBuffer::writeSectors() {
+  // tail_ is always sector aligned here, so sectors never straddle the wrap
+  size_t length = ((head_ - tail_) / SECTOR_SIZE) * SECTOR_SIZE;
+  while (length > 0) {
+    const size_t index = tail_ % CAPACITY;
+    const size_t n = (length < CAPACITY - index) ? length : CAPACITY - index;
+    writeRange(index, n);
+    tail_ += n;
+    length -= n;
+  }
+}
+
+void TxtOutputBuffer::flush() {
+  if (!buffer_) {
+    return;
+  }
+  writeSectors();
+  if (head_ > tail_) {
+    const size_t n = head_ - tail_;
+    writeRange(tail_ % CAPACITY, n);
+    tail_ += n;
+  }
+}
+
+void TxtOutputBuffer::writeRange(size_t start, size_t length) {
+  const char* data = buffer_ + start;
+  if (styleRuns_) {
+    plain_.clear();
+    styleRuns_->feed(data, length, plain_);
+    data = plain_.data();
+    length = plain_.size();
+    if (length == 0) {
+      return;
+    }
+  }
+  const size_t written = out_.write((const uint8_t*)data, length);
+  bytesWritten_ += written;
+  if (written != length) {
+    Serial.printf("WARNING: partial write during conversion: attempted=%u wrote=%u\n", (unsigned)length,
+                  (unsigned)written);
+  }
+}
@@ -0,0 +1,78 @@
+#ifndef TXT_OUTPUT_BUFFER_H
+#define TXT_OUTPUT_BUFFER_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class StyleRunEncoder;
+
+/**
+ * TxtOutputBuffer - Fixed ring buffer for converted chapter text
+ *
+ * The converter appends text and ESC tokens in place. The buffer is
+ * allocated once per conversion and never grows: when it is full, every
+ * complete 512-byte sector is written to the output file, so the SD card
+ * only sees sector-sized writes at sector-aligned file offsets until the
+ * final flush() writes the remainder.
+ *
+ * With a StyleRunEncoder the written text goes through the encoder first and
+ * the token-free text is written instead (not sector-sized in that mode).
+ */
+class TxtOutputBuffer {
+ public:
+  static constexpr size_t SECTOR_SIZE = 512;
+  static constexpr size_t CAPACITY = 8 * SECTOR_SIZE;
+
+  explicit TxtOutputBuffer(File& out, StyleRunEncoder* styleRuns = nullptr);
+  ~TxtOutputBuffer();
+
+  // False if the ring could not be allocated
+  bool isValid() const {
+    return buffer_ != nullptr;
+  }
+
+  void append(const char* data, size_t length);
+  TxtOutputBuffer& operator+=(char c) {
+    if (head_ - tail_ == CAPACITY) {
+      writeSectors();
+    }
+    buffer_[head_ % CAPACITY] = c;
+    head_++;
+    return *this;
+  }
+  TxtOutputBuffer& operator+=(const char* str);
+  TxtOutputBuffer& operator+=(const String& str) {
+    append(str.c_str(), str.length());
+    return *this;
+  }
+
+  // Write everything still buffered (including a partial last sector)
+  void flush();
+
+  // Bytes appended so far
+  size_t size() const {
+    return head_;
+  }
+  // Bytes written to the file (after token stripping in style-run mode)
+  size_t bytesWritten() const {
+    return bytesWritten_;
+  }
+
+ private:
+  void writeSectors();                          // Write all complete buffered sectors
+  void writeRange(size_t start, size_t length);  // Write [start, start+length) of the ring (no wrap)
+
+  File& out_;
+  StyleRunEncoder* styleRuns_;
+  std::vector<char> plain_;  // Token-free text in style-run mode
+  char* buffer_;
+  size_t head_ = 0;  // Total bytes appended
+  size_t tail_ = 0;  // Total bytes taken out of the ring
+  size_t bytesWritten_ = 0;
+};
+
+#endif
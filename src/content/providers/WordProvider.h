@@ -113,6 +113,13 @@ class WordProvider {
     return String("");
   }
 
+  // SD path of the plain-text file backing the current chapter, or an empty
+  // string when the text is held in memory. Per-chapter caches (such as the
+  // page index) are stored next to this file.
+  virtual String getChapterFilePath() {
+    return String("");
+  }
+
   // Style support - returns the currently active style for styling words
   // The default implementation returns a default style (left-aligned)
   virtual CssStyle getCurrentStyle() {
@@ -0,0 +1,183 @@
+#include "HtmlEntities.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "HtmlEntityTable.h"
+
+// Must match mix() in scripts/generate_html_entities.py
+static inline uint32_t htmlEntityMix(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7FEB352Du;
+  x ^= x >> 15;
+  x *= 0x846CA68Bu;
+  x ^= x >> 16;
+  return x;
+}
+
+static const char* lookupNamedEntity(const char* name, size_t length, size_t& outLength) {
+  if (length == 0 || length > HTML_ENTITY_MAX_NAME) {
+    return nullptr;
+  }
+  uint32_t bucketHash = HTML_ENTITY_SEED_BUCKET;
+  uint32_t slotHash = HTML_ENTITY_SEED_SLOT;
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t c = (uint8_t)name[i];
+    bucketHash = (bucketHash ^ c) * 16777619u;
+    slotHash = (slotHash ^ c) * 16777619u;
+  }
+  const uint32_t displacement = HTML_ENTITY_DISPLACEMENTS[bucketHash % HTML_ENTITY_BUCKETS];
+  const HtmlEntityRecord& record =
+      HTML_ENTITY_RECORDS[htmlEntityMix(slotHash ^ (displacement * 0x9E3779B9u)) % HTML_ENTITY_SLOTS];
+  if (record.nameLength != length || memcmp(HTML_ENTITY_NAMES + record.name, name, length) != 0) {
+    return nullptr;
+  }
+  outLength = record.valueLength;
+  return HTML_ENTITY_VALUES + record.value;
+}
+
+// ASCII replacement for a codepoint, or nullptr to keep it. Must match FOLDS
+// in scripts/generate_html_entities.py.
+static const char* foldCodepoint(uint32_t code) {
+  switch (code) {
+    case 0x09:
+    case 0x2002:
+    case 0x2003:
+    case 0x2009:
+    case 0x200A:
+    case 0x202F:
+      return " ";
+    case 0x0D:
+    case 0x00AD:
+    case 0x200B:
+    case 0x200C:
+    case 0x200D:
+    case 0xFEFF:
+      return "";
+    case 0x00AB:
+    case 0x00BB:
+    case 0x201C:
+    case 0x201D:
+    case 0x201E:
+    case 0x2033:
+    case 0x2039:
+    case 0x203A:
+      return "\"";
+    case 0x2018:
+    case 0x2019:
+    case 0x2032:
+      return "'";
+    case 0x201A:
+      return ",";
+    case 0x2010:
+    case 0x2011:
+    case 0x2012:
+    case 0x2013:
+    case 0x2014:
+    case 0x2022:
+      return "-";
+    case 0x2026:
+      return "...";
+    case 0x2028:
+    case 0x2029:
+      return "\n";
+    case 0x00A9:
+      return "(c)";
+    case 0x00AE:
+      return "(r)";
+    case 0x2122:
+      return "(tm)";
+    default:
+      return nullptr;
+  }
+}
+
+static size_t encodeUtf8(uint32_t code, char* out) {
+  if (code < 0x80) {
+    out[0] = (char)code;
+    return 1;
+  }
+  if (code < 0x800) {
+    out[0] = (char)(0xC0 | (code >> 6));
+    out[1] = (char)(0x80 | (code & 0x3F));
+    return 2;
+  }
+  if (code < 0x10000) {
+    out[0] = (char)(0xE0 | (code >> 12));
+    out[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+    out[2] = (char)(0x80 | (code & 0x3F));
+    return 3;
+  }
+  out[0] = (char)(0xF0 | (code >> 18));
+  out[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+  out[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+  out[3] = (char)(0x80 | (code & 0x3F));
+  return 4;
+}
+
+static inline bool isEntitySpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// Digits of a numeric reference (between "&#" and ";")
+static const char* decodeNumericEntity(const char* digits, size_t length, char* scratch, size_t& outLength) {
+  while (length > 0 && isEntitySpace(digits[0])) {
+    digits++;
+    length--;
+  }
+  while (length > 0 && isEntitySpace(digits[length - 1])) {
+    length--;
+  }
+  uint32_t base = 10;
+  if (length > 0 && (digits[0] == 'x' || digits[0] == 'X')) {
+    base = 16;
+    digits++;
+    length--;
+  }
+  if (length == 0) {
+    return nullptr;
+  }
+
+  uint32_t code = 0;
+  for (size_t i = 0; i < length; i++) {
+    const char c = digits[i];
+    uint32_t v;
+    if (c >= '0' && c <= '9') {
+      v = c - '0';
+    } else if (base == 16 && c >= 'a' && c <= 'f') {
+      v = 10 + (c - 'a');
+    } else if (base == 16 && c >= 'A' && c <= 'F') {
+      v = 10 + (c - 'A');
+    } else {
+      return nullptr;
+    }
+    code = code * base + v;
+    if (code > 0x10FFFF) {
+      return nullptr;
+    }
+  }
+  if (code == 0 || (code >= 0xD800 && code <= 0xDFFF)) {
+    return nullptr;
+  }
+
+  if (const char* folded = foldCodepoint(code)) {
+    outLength = strlen(folded);
+    return folded;
+  }
+  if ((code < 0x20 && code != '\n') || (code >= 0x7F && code < 0xA0)) {
+    outLength = 0;  // Control characters carry no text
+    return "";
+  }
+  outLength = encodeUtf8(code, scratch);
+  return scratch;
+}
+
+const char* decodeHtmlEntity(const char* entity, size_t length, char* scratch, size_t& outLength) {
+  if (length < 3 || entity[0] != '&' || entity[length - 1] != ';') {
+    return nullptr;
+  }
+  if (entity[1] == '#') {
+    return decodeNumericEntity(entity + 2, length - 3, scratch, outLength);
+  }
+  return lookupNamedEntity(entity + 1, length - 2, outLength);
+}
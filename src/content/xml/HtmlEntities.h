@@ -0,0 +1,27 @@
+#ifndef HTML_ENTITIES_H
+#define HTML_ENTITIES_H
+
+#include <stddef.h>
+
+// Scratch space decodeHtmlEntity() needs for a numeric reference (one UTF-8
+// encoded codepoint)
+static constexpr size_t HTML_ENTITY_SCRATCH_SIZE = 4;
+
+/**
+ * Decode one character reference from a view of its text: "&name;",
+ * "&#233;" or "&#xE9;" (not NUL-terminated, no allocation).
+ *
+ * Named references use the full HTML5 set in a generated perfect-hash table
+ * (HtmlEntityTable.h, see scripts/generate_html_entities.py). Values are
+ * UTF-8, except that typographic quotes, dashes, ellipsis, special spaces and
+ * (c)/(r)/(tm) fold to ASCII, and soft hyphens and zero-width characters
+ * decode to nothing. Numeric references get the same folds; control
+ * characters other than LF are dropped.
+ *
+ * Returns the decoded bytes and sets `outLength` (the result points into the
+ * flash-resident table or into `scratch`), or nullptr if the text is not a
+ * valid reference and should be kept as-is.
+ */
+const char* decodeHtmlEntity(const char* entity, size_t length, char* scratch, size_t& outLength);
+
+#endif
@@ -0,0 +1,671 @@
+#ifndef HTML_ENTITY_TABLE_H
+#define HTML_ENTITY_TABLE_H
+
+// Generated by generate_html_entities.py - do not edit
+// HTML5 named character references: 2125 names
+// clang-format off
+
+#include <stdint.h>
+
+static constexpr uint32_t HTML_ENTITY_SEED_BUCKET = 0x811C9DC5u;
+static constexpr uint32_t HTML_ENTITY_SEED_SLOT = 0x01000193u;
+static constexpr uint32_t HTML_ENTITY_BUCKETS = 708;
+static constexpr uint32_t HTML_ENTITY_SLOTS = 2125;
+static constexpr uint32_t HTML_ENTITY_MAX_NAME = 31;
+
+struct HtmlEntityRecord {
+  uint16_t name;        // Offset into HTML_ENTITY_NAMES
+  uint8_t nameLength;   // 0 = empty slot
+  uint8_t valueLength;
+  uint16_t value;       // Offset into HTML_ENTITY_VALUES
+};
+
+static const uint16_t HTML_ENTITY_DISPLACEMENTS[HTML_ENTITY_BUCKETS] = {
+    61, 29, 22, 42, 7, 2, 5, 7, 8, 0, 3, 6, 7, 0, 0, 3,
+    7, 0, 8, 11, 8, 8, 2, 11, 0, 22, 4, 10, 1, 0, 1, 18,
+    7, 2, 1, 0, 38, 33, 11, 0, 17, 47, 10, 1, 3, 4, 1, 62,
+    7, 18, 0, 8, 2, 14, 3, 8, 5, 3, 78, 0, 3, 3, 27, 22,
+    0, 45, 0, 0, 0, 23, 26, 12, 9, 17, 5, 4, 0, 5, 43, 62,
+    29, 14, 1, 9, 37, 17, 0, 16, 1, 39, 3, 0, 2, 2, 30, 0,
+    122, 5, 0, 0, 3, 9, 19, 23, 92, 9, 3, 1, 9, 7, 11, 38,
+    11, 0, 4, 0, 28, 8, 0, 62, 5, 4, 0, 4, 132, 11, 3, 26,
+    6, 50, 0, 0, 17, 7, 0, 5, 28, 45, 56, 2, 25, 25, 62, 10,
+    0, 57, 0, 3, 0, 7, 5, 0, 6, 19, 3, 1, 14, 62, 0, 1,
+    5, 52, 1, 0, 13, 6, 15, 9, 3, 20, 97, 0, 0, 14, 15, 9,
+    0, 33, 3, 40, 1, 6, 2, 60, 6, 5, 18, 38, 1, 15, 0, 3,
+    35, 18, 8, 60, 12, 24, 1, 2, 9, 2, 9, 51, 70, 15, 25, 4,
+    6, 2, 18, 0, 36, 5, 0, 52, 78, 12, 2, 87, 90, 9, 3, 5,
+    35, 61, 1, 3, 73, 92, 1, 1, 4, 0, 7, 50, 98, 32, 30, 2,
+    49, 1, 0, 37, 2, 6, 5, 2, 0, 56, 35, 9, 11, 0, 24, 18,
+    9, 8, 25, 14, 0, 31, 3, 0, 5, 1, 0, 1, 4, 25, 0, 0,
+    2, 67, 0, 5, 11, 1, 83, 12, 44, 0, 0, 9, 0, 0, 7, 9,
+    11, 0, 2, 17, 14, 15, 3, 74, 41, 0, 0, 50, 3, 0, 11, 0,
+    3, 0, 10, 51, 50, 35, 22, 9, 0, 31, 5, 22, 143, 0, 31, 12,
+    0, 0, 1, 3, 108, 12, 34, 1, 4, 21, 9, 42, 178, 15, 32, 109,
+    0, 1, 5, 1, 0, 6, 42, 3, 93, 4, 149, 2, 0, 1, 76, 10,
+    106, 0, 0, 0, 16, 0, 115, 12, 35, 69, 1, 47, 51, 8, 2, 5,
+    70, 11, 30, 83, 0, 0, 126, 8, 0, 0, 5, 6, 23, 19, 155, 21,
+    0, 35, 1, 46, 6, 8, 21, 0, 6, 21, 53, 0, 19, 24, 2, 9,
+    0, 59, 0, 76, 78, 105, 5, 6, 32, 1, 8, 3, 0, 79, 35, 50,
+    44, 17, 22, 3, 151, 77, 0, 21, 30, 74, 32, 0, 0, 21, 27, 1,
+    244, 3, 2, 47, 324, 0, 23, 0, 7, 20, 4, 3, 9, 2, 18, 0,
+    15, 15, 41, 114, 0, 54, 20, 119, 126, 18, 3, 2, 6, 1, 28, 131,
+    64, 111, 207, 0, 85, 9, 5, 62, 0, 42, 215, 73, 13, 45, 17, 152,
+    124, 1, 95, 264, 21, 3, 1, 66, 248, 20, 55, 53, 23, 80, 38, 27,
+    12, 27, 0, 1, 6, 15, 14, 11, 122, 179, 51, 11, 20, 0, 0, 14,
+    17, 115, 137, 96, 8, 28, 45, 0, 103, 3, 174, 96, 76, 1, 0, 2,
+    80, 44, 2, 592, 4, 0, 62, 16, 0, 354, 212, 0, 380, 7, 8, 31,
+    6, 50, 23, 4, 6, 0, 56, 9, 3, 41, 166, 147, 176, 114, 184, 0,
+    12, 72, 96, 0, 161, 13, 13, 88, 139, 141, 91, 73, 28, 181, 78, 14,
+    0, 59, 253, 0, 196, 1, 0, 230, 1, 97, 0, 19, 0, 25, 53, 82,
+    1, 4, 18, 0, 763, 0, 43, 1, 180, 46, 18, 24, 0, 0, 1, 173,
+    4, 81, 452, 103, 21, 5, 3, 6, 235, 7, 104, 109, 0, 67, 4, 0,
+    227, 19, 4, 29, 0, 55, 5, 167, 210, 34, 14, 6, 214, 0, 34, 602,
+    202, 0, 8, 10, 1, 33, 23, 320, 2, 20, 186, 323, 144, 140, 126, 1,
+    667, 162, 31, 422, 1, 232, 350, 127, 6, 6, 49, 638, 77, 70, 135, 163,
+    17, 680, 69, 8, 90, 187, 51, 0, 10, 200, 419, 1308, 10, 279, 400, 84,
+    249, 306, 17, 28, 311, 1078, 212, 213, 5, 167, 0, 41, 4, 225, 111, 4,
+    0, 0, 211, 931,
+};
+
+static const HtmlEntityRecord HTML_ENTITY_RECORDS[HTML_ENTITY_SLOTS] = {
+    {9642, 2, 2, 3099}, {2878, 7, 3, 836}, {11775, 5, 3, 3713}, {11622, 16, 3, 282}, {3472, 6, 2, 999}, {13923, 3, 4, 4262},
+    {1385, 16, 3, 420}, {3382, 6, 2, 968}, {10622, 5, 2, 3383}, {6577, 4, 4, 2089}, {9663, 4, 5, 799}, {10544, 4, 6, 3341},
+    {10939, 2, 2, 3511}, {9361, 6, 2, 3013}, {3719, 6, 2, 1093}, {663, 9, 2, 215}, {11054, 3, 3, 3546}, {7666, 6, 3, 2459},
+    {1293, 10, 3, 383}, {4617, 10, 3, 1334}, {3510, 11, 3, 1014}, {12861, 5, 2, 4015}, {12439, 4, 3, 3905}, {2414, 9, 3, 730},
+    {4150, 4, 3, 1188}, {13946, 6, 2, 4280}, {10203, 5, 3, 3266}, {7472, 3, 2, 2380}, {9695, 3, 6, 3126}, {8479, 3, 2, 2772},
+    {166, 4, 3, 80}, {10046, 5, 3, 855}, {4767, 5, 2, 1392}, {5526, 9, 3, 1706}, {11960, 5, 3, 3778}, {6446, 6, 3, 2058},
+    {8030, 7, 3, 2595}, {12017, 7, 3, 704}, {3683, 4, 3, 1069}, {6225, 6, 3, 1978}, {6080, 4, 3, 1923}, {11853, 4, 1, 3657},
+    {1287, 6, 3, 380}, {3257, 16, 5, 929}, {9523, 6, 3, 3062}, {13700, 5, 3, 1152}, {7469, 3, 2, 2378}, {5933, 5, 3, 1842},
+    {4391, 4, 4, 1256}, {2217, 9, 3, 673}, {9719, 6, 3, 3138}, {10413, 4, 3, 804}, {8867, 19, 3, 2598}, {12962, 6, 3, 4029},
+    {8239, 5, 2, 2683}, {11835, 5, 3, 3699}, {4479, 3, 3, 1281}, {1495, 4, 3, 455}, {3432, 20, 1, 126}, {8363, 5, 3, 2707},
+    {4895, 4, 2, 1422}, {8651, 5, 6, 2844}, {3547, 3, 4, 1025}, {7821, 2, 3, 439}, {10627, 3, 2, 3385}, {6013, 4, 3, 458},
+    {13958, 3, 2, 4284}, {2885, 12, 3, 839}, {11400, 7, 3, 3638}, {12523, 10, 3, 3917}, {12161, 7, 3, 3840}, {2292, 13, 3, 232},
+    {6892, 3, 4, 2202}, {1535, 9, 3, 463}, {8939, 8, 3, 2903}, {12420, 11, 2, 3506}, {6273, 5, 3, 2002}, {9979, 3, 5, 3213},
+    {9122, 5, 3, 2947}, {10921, 3, 2, 3504}, {2813, 12, 5, 820}, {1242, 3, 4, 366}, {8821, 14, 3, 616}, {8405, 5, 3, 320},
+    {5440, 5, 2, 1678}, {1262, 21, 3, 373}, {5068, 2, 2, 1502}, {9428, 8, 3, 3036}, {6947, 3, 2, 2214}, {9835, 5, 1, 1960},
+    {2951, 23, 5, 858}, {8516, 6, 3, 2792}, {3273, 11, 6, 934}, {9847, 6, 3, 3184}, {5967, 5, 3, 1863}, {12443, 6, 3, 3908},
+    {10403, 10, 5, 3294}, {10041, 5, 3, 836}, {31, 6, 2, 15}, {10984, 5, 3, 1905}, {4380, 11, 3, 1253}, {8835, 15, 3, 595},
+    {12257, 9, 3, 3880}, {13681, 5, 6, 909}, {12472, 5, 3, 3920}, {1830, 12, 3, 592}, {12787, 7, 3, 701}, {5078, 4, 2, 1512},
+    {5796, 17, 3, 1774}, {4215, 14, 3, 256}, {12545, 6, 3, 3935}, {7235, 4, 2, 2292}, {11479, 6, 2, 3667}, {10859, 4, 2, 3482},
+    {8135, 4, 4, 2637}, {13185, 4, 3, 247}, {7257, 3, 3, 2306}, {9652, 5, 3, 3101}, {6547, 4, 4, 2076}, {875, 9, 3, 256},
+    {5836, 5, 3, 1783}, {12069, 6, 2, 3814}, {11203, 6, 3, 3570}, {8457, 5, 2, 2764}, {9743, 4, 5, 3149}, {342, 15, 1, 127},
+    {13386, 6, 3, 4128}, {6836, 5, 2, 200}, {11979, 5, 3, 1278}, {5779, 17, 3, 1771}, {7595, 4, 3, 2426}, {234, 7, 2, 105},
+    {11073, 10, 3, 3549}, {2495, 17, 0, 749}, {2458, 19, 0, 749}, {9300, 5, 3, 1105}, {12180, 13, 3, 46}, {6679, 6, 3, 2150},
+    {13771, 4, 4, 4227}, {7217, 4, 3, 2282}, {7528, 3, 2, 2388}, {6534, 7, 3, 2073}, {10037, 4, 5, 850}, {7696, 6, 3, 2474},
+    {8721, 4, 3, 2873}, {4493, 13, 3, 1290}, {8730, 6, 1, 126}, {357, 5, 3, 128}, {10076, 5, 3, 774}, {5242, 5, 3, 1594},
+    {6722, 10, 3, 2159}, {13113, 7, 3, 4063}, {8399, 6, 3, 2735}, {10668, 4, 2, 3404}, {4522, 5, 2, 1299}, {2577, 7, 3, 754},
+    {10351, 10, 5, 3286}, {12551, 4, 3, 1269}, {7554, 3, 4, 2402}, {3127, 20, 3, 898}, {7251, 6, 2, 2304}, {5737, 6, 3, 1762},
+    {3039, 17, 3, 879}, {8751, 4, 3, 2882}, {13532, 6, 2, 3697}, {6599, 5, 3, 2105}, {2341, 14, 3, 701}, {13136, 5, 2, 4075},
+    {11225, 4, 3, 2669}, {4154, 3, 3, 1191}, {9418, 5, 3, 637}, {10095, 7, 3, 774}, {9788, 5, 5, 815}, {9582, 5, 3, 3079},
+    {10715, 3, 3, 3420}, {13673, 3, 4, 4197}, {4668, 5, 2, 1358}, {8641, 6, 3, 2838}, {6190, 6, 3, 463}, {13669, 4, 1, 1459},
+    {11111, 8, 3, 3555}, {3734, 2, 3, 1099}, {1077, 3, 2, 300}, {10886, 3, 2, 3490}, {4972, 12, 1, 1459}, {8149, 6, 3, 2601},
+    {6017, 5, 3, 1890}, {1039, 7, 3, 288}, {9423, 5, 3, 1774}, {1173, 7, 2, 337}, {5851, 5, 3, 1792}, {4399, 3, 3, 1263},
+    {8743, 8, 3, 2879}, {7835, 2, 3, 426}, {5482, 5, 3, 1689}, {10548, 4, 4, 3347}, {12846, 6, 3, 1316}, {4395, 4, 3, 1260},
+    {3736, 14, 3, 1102}, {5870, 4, 4, 1808}, {8601, 6, 3, 2820}, {10689, 4, 3, 140}, {12449, 4, 3, 1266}, {13020, 12, 3, 3033},
+    {7567, 4, 3, 2411}, {6604, 7, 3, 2108}, {5250, 3, 3, 1597}, {10803, 7, 3, 3461}, {11353, 6, 3, 3623}, {218, 5, 2, 98},
+    {10166, 7, 3, 3263}, {7853, 8, 3, 2547}, {13460, 4, 3, 4153}, {12032, 6, 3, 3801}, {6703, 11, 3, 2117}, {4347, 14, 3, 1247},
+    {1872, 17, 3, 601}, {5877, 6, 3, 1410}, {2658, 8, 3, 777}, {3821, 13, 3, 1119}, {3416, 5, 2, 984}, {9147, 13, 3, 688},
+    {7654, 6, 3, 2454}, {11164, 8, 3, 3561}, {7712, 4, 4, 2483}, {4937, 5, 3, 1444}, {12275, 6, 6, 3883}, {7479, 4, 3, 2384},
+    {2155, 16, 3, 658}, {7548, 6, 3, 2399}, {8418, 5, 2, 2740}, {10019, 4, 3, 839}, {1513, 4, 3, 452}, {8886, 14, 3, 2891},
+    {6166, 4, 1, 1960}, {12281, 5, 3, 1253}, {11233, 6, 3, 3590}, {6979, 6, 3, 2221}, {8292, 8, 3, 2698}, {8967, 7, 3, 2915},
+    {8690, 7, 3, 2864}, {297, 24, 3, 123}, {5086, 4, 2, 1516}, {5605, 6, 3, 60}, {7340, 4, 4, 2342}, {2698, 15, 3, 791},
+    {7017, 8, 3, 2235}, {8585, 4, 3, 589}, {3112, 15, 5, 893}, {3901, 15, 3, 1134}, {4294, 6, 3, 1235}, {4603, 14, 3, 1331},
+    {11229, 4, 4, 3586}, {11286, 6, 3, 3601}, {2798, 15, 5, 815}, {3583, 8, 3, 1041}, {11548, 5, 3, 1179}, {9587, 6, 3, 1902},
+    {3992, 16, 3, 1155}, {1415, 11, 3, 426}, {7707, 5, 3, 2480}, {1311, 2, 1, 388}, {7612, 6, 2, 2435}, {12228, 6, 2, 3867},
+    {11222, 3, 4, 3582}, {3351, 14, 3, 955}, {1631, 14, 3, 499}, {9188, 14, 3, 694}, {5938, 5, 3, 1845}, {3377, 5, 2, 966},
+    {12237, 4, 3, 3870}, {9960, 3, 3, 3205}, {1790, 6, 2, 580}, {4549, 3, 2, 1310}, {13101, 7, 3, 4057}, {4517, 5, 4, 1295},
+    {8368, 6, 2, 2720}, {9054, 5, 3, 2888}, {6664, 6, 3, 2138}, {10373, 4, 3, 3291}, {10527, 4, 4, 3331}, {547, 22, 2, 200},
+    {2383, 2, 3, 712}, {5104, 3, 4, 1524}, {10924, 4, 2, 3506}, {12931, 6, 3, 1908}, {11460, 5, 3, 3658}, {3195, 14, 3, 915},
+    {230, 4, 2, 103}, {8435, 3, 4, 2748}, {9730, 6, 2, 3141}, {8443, 4, 4, 2754}, {7702, 5, 3, 2477}, {11094, 6, 3, 1044},
+    {9927, 4, 5, 807}, {4906, 5, 2, 1426}, {1426, 17, 3, 429}, {8374, 4, 4, 2722}, {6991, 6, 1, 2227}, {2713, 19, 5, 794},
+    {8089, 8, 3, 2622}, {9084, 6, 3, 2944}, {1523, 12, 3, 75}, {6511, 10, 3, 2070}, {7117, 6, 3, 2244}, {9499, 10, 3, 625},
+    {11145, 4, 3, 3555}, {7414, 6, 1, 2359}, {10799, 4, 3, 3458}, {97, 9, 3, 46}, {4579, 9, 1, 1303}, {8066, 6, 3, 2609},
+    {6070, 5, 3, 1917}, {1805, 16, 3, 586}, {10087, 8, 5, 3235}, {7354, 5, 3, 2352}, {10065, 4, 3, 955}, {12818, 6, 2, 4002},
+    {2278, 14, 3, 694}, {12910, 6, 3, 1325}, {9127, 5, 3, 2956}, {11529, 4, 3, 1099}, {3393, 3, 2, 972}, {7129, 4, 4, 2250},
+    {4204, 5, 2, 1212}, {13926, 4, 2, 4266}, {8081, 8, 3, 2619}, {9281, 6, 3, 2991}, {5923, 5, 3, 1836}, {8529, 3, 3, 2798},
+    {1058, 9, 3, 223}, {11149, 5, 3, 3552}, {6394, 8, 3, 2043}, {13298, 3, 2, 215}, {8571, 6, 3, 586}, {8725, 5, 1, 126},
+    {4157, 11, 3, 1194}, {6886, 6, 3, 2199}, {8020, 6, 2, 2593}, {6790, 6, 3, 2167}, {5232, 5, 2, 1590}, {5535, 6, 3, 1709},
+    {4286, 4, 4, 1228}, {9142, 5, 3, 601}, {6658, 6, 3, 2135}, {5928, 5, 3, 1839}, {11608, 14, 3, 3641}, {10918, 3, 4, 3500},
+    {8527, 2, 3, 661}, {8309, 6, 3, 2701}, {11540, 8, 3, 1099}, {10245, 6, 3, 926}, {1185, 10, 3, 342}, {9725, 5, 3, 187},
+    {7955, 9, 3, 417}, {5547, 8, 3, 1712}, {4627, 4, 4, 1337}, {9234, 4, 4, 2974}, {6158, 8, 3, 1957}, {2433, 4, 2, 739},
+    {7543, 5, 3, 2396}, {5196, 5, 2, 196}, {8331, 8, 3, 2704}, {1699, 3, 4, 526}, {13930, 4, 4, 4268}, {5572, 3, 2, 1718},
+    {1645, 14, 3, 502}, {13435, 5, 3, 1768}, {1351, 2, 3, 407}, {12460, 7, 3, 3914}, {4275, 11, 3, 1225}, {8906, 4, 3, 661},
+    {814, 14, 3, 244}, {7849, 4, 3, 2547}, {7752, 3, 2, 2501}, {13866, 5, 3, 694}, {7882, 5, 1, 202}, {13657, 6, 3, 4194},
+    {5220, 7, 3, 1587}, {3405, 6, 2, 980}, {4650, 6, 2, 1350}, {9137, 5, 3, 2962}, {9876, 6, 3, 3192}, {9473, 7, 3, 3056},
+    {5395, 5, 2, 1660}, {8265, 5, 2, 2685}, {7779, 3, 3, 429}, {6202, 3, 3, 1966}, {5160, 3, 3, 1550}, {11715, 15, 3, 3702},
+    {1754, 4, 2, 564}, {4984, 17, 3, 1460}, {12593, 8, 3, 3775}, {5282, 5, 3, 1612}, {3018, 21, 3, 876}, {8607, 6, 3, 2631},
+    {7557, 5, 3, 2406}, {10686, 3, 2, 984}, {106, 4, 3, 49}, {7636, 6, 3, 2445}, {10121, 7, 3, 879}, {4948, 3, 3, 1450},
+    {6335, 3, 2, 2024}, {7840, 3, 3, 2538}, {5237, 5, 2, 1592}, {841, 17, 3, 250}, {5426, 6, 3, 1334}, {3501, 9, 3, 1011},
+    {14000, 4, 0, 749}, {12477, 7, 3, 3923}, {6714, 8, 3, 2156}, {6997, 4, 4, 2228}, {12811, 3, 2, 4000}, {12974, 4, 4, 4035},
+    {4715, 10, 3, 1377}, {11418, 6, 3, 3647}, {1729, 5, 2, 546}, {8462, 5, 2, 2766}, {2600, 4, 3, 759}, {4026, 17, 3, 1161},
+    {3699, 6, 2, 1082}, {10770, 3, 3, 3445}, {10565, 7, 6, 3360}, {2094, 15, 3, 649}, {5948, 5, 3, 1851}, {4427, 13, 3, 1272},
+    {11057, 4, 3, 3549}, {10577, 5, 3, 3372}, {7718, 3, 3, 2487}, {6670, 5, 3, 2141}, {5333, 8, 3, 1636}, {7431, 7, 3, 2363},
+    {7531, 6, 3, 2390}, {7793, 7, 3, 2511}, {13498, 10, 3, 2329}, {2939, 12, 3, 855}, {1283, 4, 4, 376}, {7438, 8, 3, 2366},
+    {3555, 9, 2, 1033}, {7678, 6, 3, 2465}, {126, 10, 3, 60}, {3687, 4, 4, 1072}, {514, 3, 4, 192}, {7171, 7, 3, 2267},
+    {10678, 3, 3, 3408}, {10286, 5, 3, 946}, {10833, 6, 3, 120}, {9277, 4, 1, 2990}, {10069, 4, 4, 3224}, {7900, 5, 3, 2566},
+    {1611, 8, 3, 493}, {11503, 4, 3, 3673}, {12292, 5, 3, 1241}, {5357, 5, 3, 1645}, {6412, 11, 3, 2049}, {4951, 6, 3, 1453},
+    {13282, 6, 3, 4109}, {2323, 14, 3, 238}, {8010, 4, 2, 2435}, {11100, 11, 3, 3552}, {3421, 7, 2, 986}, {8078, 3, 4, 2615},
+    {8037, 5, 3, 2598}, {6800, 4, 3, 2170}, {12219, 4, 3, 3858}, {3581, 2, 3, 1038}, {8000, 4, 3, 229}, {11069, 4, 3, 1041},
+    {12824, 6, 2, 4004}, {9263, 3, 3, 2987}, {13480, 10, 2, 2357}, {1517, 6, 2, 461}, {1796, 6, 2, 582}, {3300, 8, 3, 943},
+    {9383, 6, 3, 2891}, {13887, 5, 3, 1756}, {8387, 7, 3, 2729}, {8355, 4, 4, 2714}, {5899, 5, 3, 1821}, {6294, 7, 3, 2010},
+    {13705, 4, 4, 4205}, {9378, 5, 3, 2915}, {5034, 4, 4, 1474}, {10950, 3, 2, 3513}, {7921, 6, 3, 2578}, {503, 3, 2, 185},
+    {5723, 6, 3, 1450}, {11846, 4, 4, 3742}, {10681, 5, 3, 3411}, {4099, 14, 3, 1176}, {13727, 6, 6, 4174}, {5404, 2, 3, 1334},
+    {1946, 14, 3, 616}, {9037, 6, 3, 2928}, {11756, 3, 3, 3707}, {9067, 6, 3, 2936}, {12311, 10, 3, 1244}, {10242, 3, 3, 918},
+    {2171, 13, 3, 661}, {8014, 6, 3, 452}, {10417, 6, 2, 3299}, {13416, 4, 4, 4139}, {11139, 6, 3, 1035}, {9630, 2, 3, 730},
+    {13425, 6, 2, 4146}, {11344, 5, 1, 126}, {3428, 4, 4, 988}, {7981, 6, 3, 432}, {3186, 9, 6, 909}, {5918, 5, 3, 1833},
+    {2423, 4, 4, 733}, {13214, 5, 2, 4088}, {12303, 8, 3, 1241}, {7025, 7, 3, 2238}, {5487, 4, 3, 1692}, {4656, 4, 3, 1352},
+    {2553, 14, 3, 712}, {1341, 3, 2, 399}, {10109, 7, 3, 3243}, {4758, 9, 3, 1389}, {5957, 5, 3, 1857}, {6572, 5, 3, 2086},
+    {5982, 5, 3, 1872}, {9469, 4, 3, 3056}, {10600, 6, 3, 3378}, {12156, 5, 3, 3837}, {11862, 6, 1, 127}, {7818, 3, 4, 2526},
+    {11553, 4, 3, 3682}, {11359, 5, 3, 1119}, {11700, 15, 3, 3644}, {1591, 10, 3, 487}, {9853, 5, 3, 1419}, {1758, 2, 1, 566},
+    {13762, 6, 3, 4220}, {10953, 6, 3, 2601}, {13431, 4, 3, 4045}, {11443, 5, 3, 3653}, {4776, 7, 3, 1220}, {4192, 6, 2, 1208},
+    {9987, 4, 3, 3221}, {13695, 5, 3, 1056}, {12216, 3, 3, 3855}, {9509, 8, 3, 1413}, {5993, 5, 3, 1878}, {5054, 3, 4, 1486},
+    {11371, 5, 3, 3629}, {1702, 4, 4, 530}, {11047, 5, 2, 3544}, {5586, 7, 3, 57}, {7738, 3, 3, 2494}, {9606, 4, 3, 3085},
+    {13709, 6, 6, 4168}, {5349, 8, 3, 1642}, {11889, 5, 3, 1777}, {6231, 6, 3, 1981}, {6149, 4, 1, 1953}, {241, 9, 2, 107},
+    {8678, 5, 3, 2858}, {7388, 5, 3, 342}, {6732, 6, 2, 2162}, {6796, 4, 3, 223}, {12968, 6, 3, 4032}, {9636, 6, 3, 1564},
+    {3544, 3, 2, 1023}, {8638, 3, 3, 2835}, {6852, 7, 3, 174}, {8201, 3, 4, 2663}, {10753, 5, 3, 3439}, {9073, 5, 3, 2939},
+    {497, 6, 2, 183}, {8270, 4, 3, 2687}, {398, 4, 3, 143}, {7375, 6, 3, 2282}, {9024, 3, 3, 2925}, {11790, 5, 3, 1128},
+    {6464, 8, 3, 2064}, {6065, 5, 3, 1914}, {3147, 17, 5, 901}, {1110, 6, 2, 318}, {13802, 5, 3, 1753}, {8274, 5, 2, 2690},
+    {10051, 3, 3, 836}, {1348, 3, 4, 403}, {1548, 5, 2, 468}, {13836, 4, 3, 4241}, {6521, 9, 3, 143}, {12601, 8, 3, 3781},
+    {7109, 8, 3, 1076}, {13440, 5, 3, 4125}, {11525, 4, 3, 3679}, {1324, 6, 2, 393}, {6567, 5, 3, 2083}, {8423, 4, 2, 2742},
+    {1303, 4, 3, 383}, {12539, 6, 3, 3932}, {11429, 9, 3, 1069}, {7293, 5, 3, 2329}, {9963, 4, 3, 3208}, {11594, 4, 2, 3697},
+    {9698, 4, 5, 845}, {5663, 9, 3, 1744}, {8926, 6, 3, 2897}, {13449, 7, 3, 4150}, {13089, 4, 3, 4048}, {4930, 4, 3, 1439},
+    {5142, 14, 0, 749}, {4361, 19, 3, 1250}, {6841, 6, 2, 2182}, {8281, 6, 3, 2692}, {5138, 4, 2, 1546}, {7001, 3, 2, 198},
+    {11598, 10, 3, 1116}, {12978, 7, 3, 4039}, {8507, 5, 3, 683}, {8323, 8, 3, 2701}, {4855, 11, 3, 250}, {3680, 3, 4, 1065},
+    {13643, 3, 3, 3442}, {11292, 5, 3, 2179}, {11730, 4, 2, 3705}, {9610, 4, 3, 2609}, {6317, 4, 2, 2019}, {7370, 5, 2, 2357},
+    {6402, 10, 3, 2046}, {13469, 5, 3, 244}, {6644, 8, 3, 2129}, {10655, 5, 2, 3395}, {4290, 4, 3, 1232}, {8491, 4, 2, 2780},
+    {3979, 13, 3, 1152}, {6495, 6, 1, 2069}, {1975, 7, 3, 622}, {13798, 4, 3, 1386}, {8300, 6, 2, 2685}, {10789, 4, 2, 3453},
+    {7891, 4, 3, 432}, {11305, 6, 2, 3612}, {11751, 5, 3, 345}, {13238, 6, 3, 4094}, {12945, 6, 3, 4026}, {1557, 6, 2, 472},
+    {13733, 7, 3, 4209}, {9456, 5, 3, 3048}, {11243, 11, 3, 455}, {1575, 3, 3, 480}, {912, 9, 2, 265}, {3484, 6, 3, 1003},
+    {7004, 5, 3, 220}, {5, 3, 1, 2}, {12759, 6, 3, 3983}, {6052, 8, 3, 1908}, {12400, 5, 3, 1750}, {8427, 5, 2, 2744},
+    {7147, 5, 3, 2261}, {13464, 5, 3, 4156}, {4531, 3, 1, 1303}, {5672, 8, 3, 1747}, {13861, 5, 3, 238}, {7492, 11, 3, 348},
+    {10817, 6, 2, 3467}, {3452, 14, 1, 127}, {13108, 5, 3, 4060}, {11066, 3, 3, 1044}, {7837, 3, 3, 2535}, {6935, 7, 2, 2209},
+    {7759, 2, 3, 414}, {3056, 16, 3, 882}, {10268, 14, 3, 771}, {7868, 5, 3, 2544}, {9452, 4, 6, 3042}, {12369, 5, 3, 1116},
+    {3521, 15, 3, 1017}, {4838, 10, 3, 1413}, {10895, 6, 1, 3493}, {7618, 6, 3, 2437}, {6557, 4, 3, 80}, {12133, 5, 3, 1328},
+    {4809, 11, 3, 1404}, {11188, 4, 3, 1056}, {4820, 13, 3, 1407}, {5619, 7, 3, 1728}, {9757, 7, 3, 952}, {7974, 7, 3, 426},
+    {5648, 7, 3, 1738}, {10255, 4, 4, 3279}, {10073, 3, 2, 3228}, {2648, 10, 3, 774}, {9948, 5, 3, 3199}, {12609, 7, 3, 1278},
+    {8145, 4, 4, 2644}, {8198, 3, 3, 229}, {11996, 5, 3, 3792}, {7276, 3, 3, 2318}, {9013, 6, 3, 613}, {11500, 3, 2, 3671},
+    {7771, 8, 3, 429}, {12350, 3, 3, 1235}, {601, 7, 3, 205}, {2007, 12, 3, 631}, {8057, 9, 3, 2606}, {6386, 8, 3, 1079},
+    {11734, 12, 3, 2369}, {10763, 2, 3, 3442}, {4899, 7, 2, 1424}, {3577, 4, 3, 1035}, {13420, 5, 3, 4143}, {4408, 11, 3, 1266},
+    {13310, 7, 3, 1220}, {8951, 6, 3, 2912}, {4243, 15, 3, 1116}, {11192, 6, 3, 1056}, {6370, 16, 3, 2040}, {10282, 4, 3, 943},
+    {2260, 18, 3, 691}, {7451, 5, 3, 2372}, {6237, 4, 6, 1984}, {0, 5, 2, 0}, {1195, 11, 3, 345}, {12079, 8, 3, 1456},
+    {12001, 5, 3, 3795}, {4318, 12, 3, 1241}, {2082, 12, 3, 646}, {492, 5, 3, 180}, {7152, 4, 3, 2264}, {5177, 6, 2, 1562},
+    {10672, 6, 2, 3406}, {5866, 4, 3, 1805}, {9747, 5, 5, 3154}, {10186, 5, 3, 868}, {5119, 4, 2, 1538}, {12514, 9, 3, 3920},
+    {7465, 4, 3, 342}, {8766, 13, 3, 2832}, {9103, 4, 3, 2950}, {8900, 3, 3, 658}, {12353, 6, 3, 1235}, {10813, 4, 3, 3448},
+    {10231, 5, 3, 882}, {5096, 5, 2, 1520}, {7241, 5, 3, 2294}, {6452, 7, 3, 2061}, {12937, 8, 3, 4023}, {4113, 10, 3, 241},
+    {1563, 5, 2, 474}, {7690, 6, 3, 2471}, {11507, 7, 3, 3676}, {13193, 6, 2, 4082}, {2226, 3, 4, 676}, {9784, 4, 2, 757},
+    {9257, 6, 1, 1376}, {12638, 4, 3, 3947}, {4783, 10, 3, 1398}, {7195, 4, 3, 2232}, {206, 6, 2, 94}, {6278, 7, 3, 2005},
+    {6089, 5, 3, 1929}, {170, 6, 2, 83}, {3321, 17, 3, 949}, {5301, 8, 3, 1624}, {4043, 16, 3, 1164}, {13691, 4, 4, 4201},
+    {10297, 5, 3, 955}, {11566, 6, 3, 1140}, {10538, 6, 3, 3338}, {921, 19, 3, 267}, {1842, 19, 3, 595}, {2455, 3, 2, 747},
+    {11324, 4, 3, 1113}, {9292, 8, 3, 2244}, {3725, 6, 2, 1095}, {13008, 12, 3, 2264}, {3811, 10, 3, 1116}, {10028, 9, 5, 850},
+    {7460, 5, 3, 220}, {7571, 5, 3, 2414}, {8473, 6, 2, 2770}, {3369, 6, 2, 962}, {9027, 5, 3, 273}, {5278, 4, 3, 1615},
+    {8697, 6, 2, 2867}, {10941, 9, 3, 2426}, {10496, 5, 3, 3307}, {4911, 4, 4, 1428}, {7268, 8, 3, 2315}, {8974, 9, 3, 658},
+    {11424, 5, 3, 3650}, {11465, 7, 3, 3661}, {7878, 4, 4, 2556}, {1578, 6, 2, 483}, {3768, 20, 3, 1108}, {8218, 5, 3, 2672},
+    {7642, 6, 3, 2448}, {2574, 3, 4, 750}, {5409, 6, 3, 1669}, {12142, 5, 3, 3828}, {10839, 8, 3, 3474}, {4848, 7, 3, 247},
+    {5449, 3, 1, 1684}, {9336, 5, 3, 3007}, {5846, 5, 3, 1789}, {12985, 4, 3, 3801}, {10871, 6, 3, 3484}, {12123, 6, 3, 3822},
+    {250, 3, 3, 91}, {1483, 12, 3, 452}, {8910, 8, 3, 670}, {10966, 6, 3, 2601}, {10851, 5, 3, 3479}, {5464, 6, 2, 1685},
+    {10251, 4, 5, 921}, {2132, 9, 3, 226}, {1353, 4, 4, 410}, {9620, 6, 3, 3088}, {9355, 6, 1, 2068}, {7755, 4, 2, 2503},
+    {7943, 6, 3, 2584}, {12630, 4, 2, 3943}, {6256, 6, 2, 1996}, {1095, 5, 2, 308}, {4833, 5, 3, 1410}, {13141, 6, 2, 4077},
+    {8632, 6, 3, 2832}, {12028, 4, 1, 3800}, {11239, 4, 4, 3593}, {10698, 5, 3, 3414}, {9266, 7, 3, 2987}, {11338, 6, 3, 1113},
+    {10863, 8, 3, 253}, {9842, 5, 3, 3181}, {13288, 5, 3, 4112}, {8594, 7, 3, 2817}, {9078, 6, 2, 2942}, {828, 13, 3, 247},
+    {11013, 6, 2, 1033}, {6032, 5, 3, 1899}, {12533, 6, 3, 3929}, {6824, 5, 3, 622}, {10959, 7, 3, 3515}, {11019, 7, 3, 3531},
+    {12805, 6, 3, 3997}, {5101, 3, 2, 1522}, {9273, 4, 3, 1765}, {10507, 6, 3, 3313}, {7907, 4, 3, 2569}, {37, 5, 2, 17},
+    {6045, 7, 3, 1905}, {8234, 5, 2, 2681}, {6956, 13, 3, 2216}, {10423, 4, 3, 842}, {6611, 7, 3, 2111}, {12340, 10, 3, 1250},
+    {13263, 5, 3, 4103}, {4123, 4, 3, 1179}, {13686, 5, 6, 934}, {110, 6, 3, 52}, {13740, 5, 2, 4212}, {6551, 6, 3, 146},
+    {6196, 6, 2, 1964}, {7895, 5, 3, 2563}, {12743, 10, 3, 3971}, {9832, 3, 2, 3179}, {8714, 4, 1, 2856}, {1937, 9, 3, 613},
+    {9287, 5, 3, 595}, {7764, 3, 3, 414}, {1601, 7, 3, 241}, {362, 6, 3, 131}, {7246, 3, 4, 2297}, {13369, 7, 2, 4123},
+    {11575, 5, 3, 282}, {10330, 5, 3, 915}, {11216, 6, 3, 3579}, {5209, 2, 3, 30}, {1472, 3, 1, 446}, {6581, 4, 3, 2093},
+    {2391, 11, 3, 720}, {482, 6, 3, 174}, {9115, 3, 3, 2953}, {7328, 3, 2, 2338}, {7123, 6, 3, 2247}, {9939, 4, 3, 788},
+    {1608, 3, 3, 490}, {5519, 7, 3, 1703}, {1021, 18, 3, 285}, {10314, 7, 3, 906}, {12497, 8, 3, 1266}, {5642, 6, 3, 1386},
+    {13978, 4, 2, 4294}, {8580, 5, 1, 126}, {1746, 4, 4, 556}, {13892, 4, 3, 1450}, {13777, 2, 3, 1463}, {12114, 6, 2, 3820},
+    {4270, 5, 2, 1223}, {12326, 6, 3, 1250}, {3691, 5, 3, 1076}, {5635, 7, 3, 1735}, {9713, 6, 3, 3135}, {9311, 3, 3, 2997},
+    {9132, 5, 3, 2959}, {11297, 4, 3, 3604}, {10877, 5, 3, 3487}, {10198, 5, 3, 3132}, {2628, 20, 3, 771}, {12223, 5, 6, 3861},
+    {1443, 12, 3, 432}, {13411, 5, 3, 4136}, {5341, 8, 3, 1639}, {12151, 5, 3, 3834}, {9900, 3, 4, 3195}, {13392, 8, 3, 4128},
+    {9803, 6, 2, 3167}, {2443, 6, 2, 743}, {5111, 4, 4, 1532}, {8779, 15, 3, 273}, {6084, 5, 3, 1926}, {10427, 13, 3, 825},
+    {12100, 3, 0, 749}, {10161, 5, 5, 3258}, {8108, 13, 3, 2631}, {12921, 5, 2, 203}, {7624, 6, 2, 2440}, {9776, 8, 3, 759},
+    {13293, 5, 2, 4115}, {8, 6, 2, 3}, {9059, 8, 3, 2221}, {8709, 5, 3, 598}, {8042, 4, 3, 2601}, {6434, 4, 3, 2034},
+    {4543, 6, 2, 1308}, {12959, 3, 3, 288}, {12046, 5, 3, 46}, {6268, 5, 2, 2000}, {10606, 2, 3, 2043}, {9626, 4, 4, 3091},
+    {8212, 6, 3, 2669}, {7032, 9, 3, 2241}, {5743, 12, 3, 1765}, {2477, 18, 0, 749}, {4564, 5, 2, 1319}, {4696, 6, 2, 1372},
+    {6820, 4, 1, 1960}, {11519, 6, 1, 126}, {3236, 21, 3, 926}, {13638, 5, 3, 1143}, {6634, 7, 3, 2123}, {13779, 6, 3, 1463},
+    {4866, 14, 3, 1416}, {6752, 15, 3, 2150}, {1906, 14, 3, 607}, {6176, 4, 3, 75}, {11301, 4, 5, 3607}, {1344, 4, 2, 401},
+    {13068, 15, 3, 1158}, {7581, 4, 2, 2420}, {4925, 5, 3, 1436}, {4640, 4, 4, 1344}, {6810, 6, 3, 2176}, {11759, 6, 3, 3710},
+    {7161, 5, 3, 262}, {9100, 3, 3, 2947}, {12491, 6, 3, 3902}, {12555, 10, 3, 3766}, {6037, 8, 3, 1902}, {11172, 8, 3, 3564},
+    {7648, 6, 3, 2451}, {11991, 5, 3, 2241}, {7741, 6, 2, 2497}, {988, 18, 3, 279}, {7182, 8, 3, 2272}, {13975, 3, 4, 4290},
+    {10645, 4, 3, 111}, {12175, 5, 3, 589}, {1772, 4, 3, 571}, {7226, 6, 3, 2287}, {735, 19, 3, 232}, {12765, 6, 3, 3986},
+    {72, 5, 2, 33}, {9251, 6, 3, 2984}, {7721, 6, 2, 2490}, {1180, 5, 3, 339}, {6285, 4, 2, 2008}, {6205, 6, 3, 1969},
+    {7843, 3, 3, 2541}, {8189, 4, 2, 2659}, {2431, 2, 2, 737}, {1089, 6, 2, 306}, {1571, 4, 2, 478}, {11496, 4, 1, 3656},
+    {13189, 4, 3, 4079}, {2337, 4, 4, 697}, {10810, 3, 3, 3464}, {4059, 13, 3, 1167}, {13227, 6, 2, 4092}, {13849, 6, 3, 1741},
+    {12771, 5, 3, 3989}, {13881, 6, 3, 1759}, {5070, 4, 4, 1504}, {8004, 6, 1, 1303}, {8619, 6, 3, 2826}, {7316, 6, 3, 2332},
+    {1467, 5, 2, 444}, {2119, 13, 3, 655}, {585, 16, 2, 203}, {4702, 5, 2, 1374}, {9517, 6, 3, 3059}, {7537, 6, 3, 2393},
+    {11840, 6, 1, 126}, {13855, 6, 3, 1744}, {7905, 2, 1, 388}, {7964, 10, 3, 2487}, {13635, 3, 2, 4186}, {3673, 3, 2, 1063},
+    {3494, 7, 3, 1008}, {6341, 4, 3, 2029}, {13756, 6, 3, 4217}, {13571, 12, 6, 4174}, {8577, 3, 3, 2814}, {8512, 4, 3, 226},
+    {7009, 8, 3, 2232}, {9043, 5, 3, 2931}, {10523, 4, 6, 3325}, {4300, 18, 3, 1238}, {7093, 16, 3, 1134}, {13519, 9, 3, 1056},
+    {11154, 6, 3, 3558}, {5107, 4, 4, 1528}, {3072, 19, 5, 885}, {9570, 6, 3, 3076}, {143, 4, 4, 69}, {3396, 6, 2, 974},
+    {13875, 6, 3, 1747}, {9553, 3, 3, 3071}, {8204, 6, 2, 2667}, {13128, 4, 4, 4069}, {11514, 5, 1, 126}, {3308, 13, 3, 946},
+    {8957, 10, 3, 2814}, {3468, 4, 4, 995}, {6738, 14, 3, 2120}, {3834, 19, 3, 1122}, {11213, 3, 2, 3577}, {5123, 6, 2, 1540},
+    {253, 3, 2, 109}, {4127, 12, 3, 1182}, {5859, 7, 6, 1799}, {12207, 4, 3, 1456}, {8467, 6, 2, 2768}, {9483, 6, 3, 1146},
+    {4209, 3, 2, 1214}, {9414, 4, 3, 3033}, {411, 31, 3, 149}, {6501, 4, 3, 2070}, {7312, 4, 1, 1303}, {6905, 4, 3, 205},
+    {8249, 8, 3, 513}, {11454, 6, 1, 3657}, {11333, 5, 3, 3620}, {4088, 11, 3, 1173}, {5474, 8, 3, 149}, {8447, 4, 4, 2758},
+    {628, 6, 3, 217}, {5702, 13, 3, 1756}, {6338, 3, 3, 2026}, {5309, 8, 3, 1627}, {10023, 5, 5, 3213}, {12436, 3, 3, 3902},
+    {11043, 4, 4, 3540}, {13902, 6, 2, 4252}, {2370, 4, 3, 574}, {7864, 4, 3, 2550}, {2305, 18, 3, 235}, {7322, 6, 3, 2335},
+    {12055, 3, 4, 3807}, {6185, 5, 3, 463}, {9480, 3, 3, 1146}, {3965, 14, 3, 1149}, {7672, 6, 3, 2462}, {12680, 7, 3, 3965},
+    {2019, 15, 3, 634}, {12852, 9, 3, 1316}, {2840, 18, 5, 828}, {8378, 4, 3, 320}, {4471, 8, 3, 1102}, {1750, 4, 4, 560},
+    {9702, 11, 3, 3132}, {5369, 8, 3, 1651}, {8807, 14, 3, 2888}, {9202, 13, 3, 2823}, {12648, 7, 3, 3953}, {12453, 7, 3, 3911},
+    {12234, 3, 1, 3869}, {6289, 5, 2, 105}, {8051, 6, 3, 2606}, {4593, 10, 3, 1328}, {6628, 6, 3, 2120}, {9537, 13, 3, 1618},
+    {7141, 6, 2, 2259}, {13775, 2, 3, 4220}, {11557, 3, 3, 1079}, {11472, 7, 3, 3664}, {10608, 6, 2, 3381}, {5044, 5, 2, 1481},
+    {12776, 6, 3, 2622}, {11927, 4, 3, 3766}, {1568, 3, 2, 476}, {1687, 4, 2, 520}, {13971, 4, 2, 4288}, {8542, 8, 3, 2806},
+    {11407, 6, 3, 3641}, {10739, 6, 3, 114}, {5611, 4, 2, 1723}, {13934, 4, 4, 4272}, {7787, 6, 3, 2508}, {5163, 4, 3, 1553},
+    {9346, 4, 1, 2857}, {13840, 5, 3, 1738}, {9593, 6, 3, 2235}, {3365, 4, 4, 958}, {6075, 5, 3, 1920}, {6219, 6, 3, 1975},
+    {13815, 5, 3, 691}, {9828, 4, 3, 3176}, {13745, 6, 3, 4214}, {13000, 8, 3, 4045}, {10220, 11, 3, 3266}, {13120, 8, 3, 4066},
+    {11485, 6, 2, 3669}, {1544, 4, 2, 466}, {10485, 2, 2, 3301}, {5156, 4, 2, 1548}, {13604, 15, 3, 631}, {7585, 4, 4, 2422},
+    {147, 5, 2, 73}, {2374, 3, 3, 707}, {4440, 18, 3, 1275}, {11795, 5, 3, 3722}, {11827, 8, 3, 3739}, {7211, 6, 2, 2280},
+    {7782, 5, 3, 2505}, {11209, 4, 4, 3573}, {9958, 2, 3, 1102}, {11349, 4, 3, 1116}, {5432, 8, 3, 1672}, {13253, 5, 3, 646},
+    {13132, 4, 2, 4073}, {7916, 5, 3, 2575}, {10728, 7, 2, 3427}, {10259, 9, 3, 955}, {9632, 4, 4, 3095}, {11328, 5, 3, 3617},
+    {10907, 4, 3, 1410}, {6423, 11, 3, 2052}, {7747, 5, 2, 2499}, {377, 6, 3, 137}, {10649, 6, 3, 3392}, {10635, 6, 2, 3387},
+    {12431, 5, 2, 3051}, {5491, 8, 3, 1695}, {8947, 4, 6, 2906}, {6618, 5, 3, 2114}, {6135, 5, 3, 1950}, {176, 3, 3, 85},
+    {8757, 9, 3, 589}, {1210, 4, 3, 351}, {12038, 8, 3, 46}, {1682, 5, 2, 518}, {1123, 5, 2, 323}, {10660, 5, 3, 3397},
+    {12699, 5, 3, 3974}, {13896, 6, 3, 1483}, {8382, 5, 3, 2726}, {6008, 5, 3, 1887}, {2411, 3, 4, 726}, {6170, 6, 1, 1960},
+    {9305, 6, 3, 2994}, {7949, 6, 3, 2575}, {6094, 5, 3, 1932}, {5655, 8, 3, 1741}, {152, 4, 3, 60}, {7055, 9, 3, 256},
+    {12251, 6, 3, 3880}, {8485, 6, 2, 2778}, {1206, 4, 3, 348}, {7767, 4, 3, 420}, {9815, 5, 3, 949}, {6530, 4, 3, 1331},
+    {12995, 5, 4, 1295}, {5271, 4, 3, 1609}, {11924, 3, 3, 3763}, {8223, 6, 3, 2675}, {13376, 10, 3, 4125}, {2732, 17, 5, 799},
+    {8613, 6, 3, 2823}, {5001, 13, 3, 1463}, {11266, 7, 3, 2360}, {6932, 3, 2, 215}, {6692, 11, 3, 2114}, {12989, 6, 3, 4042},
+    {5687, 15, 3, 1753}, {5510, 9, 3, 1700}, {5913, 5, 3, 1830}, {687, 15, 3, 226}, {10394, 9, 3, 940}, {9692, 3, 5, 3121},
+    {8026, 4, 3, 616}, {7306, 6, 3, 2329}, {140, 3, 4, 65}, {5247, 3, 1, 2}, {4660, 8, 3, 1355}, {7927, 7, 3, 2581},
+    {9319, 6, 1, 126}, {6652, 6, 3, 2132}, {9389, 6, 3, 3021}, {5293, 8, 3, 1621}, {1006, 15, 3, 282}, {4212, 3, 4, 1216},
+    {11273, 4, 1, 126}, {13961, 4, 2, 4286}, {12297, 6, 3, 1244}, {470, 4, 2, 168}, {10718, 5, 2, 3423}, {4915, 6, 2, 1432},
+    {11261, 5, 1, 3600}, {13208, 6, 2, 4086}, {8850, 17, 3, 1105}, {14, 6, 2, 5}, {5038, 6, 3, 1478}, {13663, 6, 1, 1459},
+    {11937, 5, 3, 1275}, {7800, 8, 3, 2514}, {509, 5, 2, 190}, {12129, 4, 3, 1328}, {10176, 6, 3, 876}, {9740, 3, 3, 952},
+    {2388, 3, 2, 718}, {884, 12, 3, 259}, {3466, 2, 3, 992}, {5185, 3, 5, 1567}, {4527, 4, 2, 1301}, {7812, 6, 3, 2523},
+    {10377, 5, 5, 3294}, {9991, 3, 3, 839}, {506, 3, 3, 187}, {11850, 3, 3, 1191}, {1691, 5, 2, 522}, {1499, 14, 3, 458},
+    {13715, 6, 6, 4162}, {12147, 4, 3, 3831}, {6675, 4, 6, 2144}, {4921, 4, 2, 1434}, {6561, 6, 3, 2080}, {6685, 7, 3, 2153},
+    {447, 4, 4, 155}, {2974, 17, 5, 863}, {5889, 5, 3, 1815}, {7846, 3, 3, 2544}, {4537, 6, 2, 1306}, {12782, 5, 3, 701},
+    {896, 16, 3, 262}, {7987, 9, 6, 2587}, {10758, 5, 3, 117}, {12673, 7, 3, 3962}, {9953, 5, 3, 3202}, {5555, 4, 3, 1380},
+    {7887, 4, 3, 2560}, {9943, 5, 3, 3118}, {9918, 9, 5, 807}, {4402, 6, 3, 1263}, {11765, 10, 3, 3710}, {1994, 13, 3, 628},
+    {3591, 13, 3, 1044}, {13328, 13, 3, 646}, {6623, 5, 3, 2117}, {3164, 22, 3, 906}, {12390, 6, 3, 1260}, {6804, 6, 3, 2173},
+    {7716, 2, 3, 420}, {10765, 5, 3, 2040}, {5287, 6, 3, 1618}, {10735, 4, 3, 3429}, {6895, 5, 3, 607}, {12899, 6, 1, 1303},
+    {9820, 8, 5, 3171}, {11134, 5, 1, 127}, {4534, 3, 2, 1304}, {3944, 8, 3, 1143}, {9736, 4, 6, 3143}, {6879, 7, 3, 2196},
+    {5383, 5, 2, 33}, {1116, 7, 3, 320}, {12108, 6, 2, 3820}, {5362, 7, 3, 1648}, {1103, 4, 2, 312}, {2858, 20, 3, 833},
+    {11780, 5, 3, 3716}, {8339, 7, 3, 2707}, {12955, 4, 3, 3192}, {6060, 5, 3, 1911}, {6909, 7, 3, 205}, {1584, 2, 3, 480},
+    {12874, 6, 2, 4017}, {13247, 6, 2, 4101}, {4184, 6, 2, 1203}, {4588, 5, 3, 1325}, {9436, 7, 3, 3039}, {10785, 4, 2, 3451},
+    {8718, 3, 2, 2871}, {6438, 8, 3, 2055}, {9840, 2, 3, 777}, {12951, 4, 3, 2672}, {3604, 18, 3, 1047}, {8495, 4, 2, 2782},
+    {9329, 3, 3, 707}, {12405, 15, 2, 2357}, {12332, 8, 3, 1247}, {13258, 5, 3, 1167}, {4190, 2, 3, 1205}, {5680, 7, 3, 1750},
+    {8522, 5, 3, 2795}, {634, 8, 3, 220}, {13827, 5, 3, 688}, {1313, 5, 2, 389}, {8097, 5, 3, 2625}, {12616, 3, 3, 1281},
+    {10901, 6, 3, 3494}, {7487, 5, 3, 358}, {5418, 4, 3, 1675}, {4258, 12, 3, 1220}, {10911, 7, 3, 3497}, {81, 6, 3, 39},
+    {6321, 5, 3, 2021}, {13820, 2, 2, 4239}, {10116, 5, 3, 879}, {8736, 7, 3, 2876}, {10823, 4, 3, 3469}, {8210, 2, 3, 487},
+    {9564, 6, 1, 1684}, {8102, 6, 3, 2628}, {12734, 9, 3, 3974}, {6864, 7, 3, 2189}, {8350, 5, 2, 2712}, {11008, 5, 3, 3528},
+    {11438, 5, 3, 1762}, {11394, 6, 3, 3635}, {8229, 5, 3, 2678}, {1318, 6, 2, 391}, {12247, 4, 4, 3876}, {12378, 6, 3, 46},
+    {9178, 10, 3, 2965}, {12064, 5, 3, 3811}, {13490, 8, 2, 2768}, {5904, 5, 3, 1824}, {1734, 6, 2, 548}, {13832, 4, 3, 2965},
+    {55, 4, 4, 26}, {5325, 8, 3, 1633}, {2449, 6, 2, 745}, {9982, 5, 3, 3218}, {451, 3, 3, 159}, {9657, 3, 5, 3104},
+    {11821, 6, 3, 3736}, {6314, 3, 4, 2015}, {8794, 13, 3, 652}, {9660, 3, 6, 3109}, {11785, 5, 3, 3719}, {8438, 5, 2, 2752},
+    {7199, 6, 2, 2275}, {119, 7, 3, 57}, {10989, 7, 3, 3522}, {8186, 3, 2, 2657}, {2402, 9, 3, 723}, {6785, 5, 3, 2164},
+    {10778, 7, 3, 3448}, {12270, 5, 3, 1238}, {7133, 4, 2, 2254}, {3490, 4, 2, 1006}, {10723, 5, 2, 3425}, {13646, 6, 3, 4188},
+    {6927, 5, 3, 2206}, {7727, 5, 2, 2492}, {9809, 6, 2, 3169}, {11874, 6, 3, 3746}, {9936, 3, 3, 788}, {5977, 5, 3, 1869},
+    {8346, 4, 2, 2710}, {12655, 4, 3, 1290}, {2666, 13, 5, 780}, {5987, 6, 3, 1875}, {1336, 5, 2, 397}, {8556, 6, 2, 2809},
+    {11033, 2, 2, 1033}, {9048, 4, 2, 2934}, {6326, 9, 3, 2021}, {2825, 15, 3, 825}, {1164, 5, 2, 331}, {9967, 3, 3, 1102},
+    {5204, 5, 2, 1579}, {3622, 13, 3, 1050}, {12051, 4, 3, 3804}, {2247, 13, 3, 688}, {460, 2, 3, 88}, {7260, 6, 3, 2309},
+    {25, 3, 2, 9}, {2141, 14, 3, 229}, {3411, 5, 2, 982}, {7166, 5, 3, 1108}, {1766, 6, 2, 569}, {858, 17, 3, 253},
+    {9341, 5, 3, 3010}, {13528, 4, 3, 1404}, {10934, 5, 3, 3508}, {9369, 4, 3, 3015}, {9395, 6, 3, 3024}, {5259, 4, 3, 1603},
+    {1100, 3, 2, 310}, {8666, 6, 1, 2856}, {11127, 7, 3, 1050}, {4631, 9, 3, 1341}, {7393, 10, 3, 2306}, {7446, 5, 3, 2369},
+    {4458, 13, 3, 1278}, {6850, 2, 3, 208}, {5415, 3, 3, 1672}, {5600, 5, 2, 1698}, {1227, 12, 3, 361}, {2567, 7, 1, 749},
+    {2604, 3, 3, 762}, {2749, 14, 3, 804}, {722, 13, 3, 180}, {5729, 8, 3, 1483}, {13360, 4, 2, 4123}, {642, 21, 3, 137},
+    {2763, 20, 5, 807}, {7239, 2, 3, 361}, {1676, 6, 2, 516}, {6477, 6, 3, 39}, {11119, 8, 3, 3558}, {8179, 2, 3, 499},
+    {7761, 3, 3, 417}, {11909, 2, 3, 3758}, {1480, 3, 3, 449}, {13456, 4, 3, 250}, {10745, 4, 4, 3432}, {9677, 15, 3, 3118},
+    {12505, 9, 3, 3905}, {1080, 3, 2, 302}, {10387, 7, 6, 934}, {8315, 8, 3, 1553}, {6305, 9, 2, 107}, {2991, 11, 3, 868},
+    {6345, 4, 2, 2032}, {7823, 3, 3, 407}, {11951, 5, 2, 3773}, {7363, 7, 2, 2355}, {5874, 3, 3, 1410}, {6459, 5, 3, 2064},
+    {1307, 4, 2, 386}, {4644, 6, 2, 1348}, {8359, 4, 2, 2718}, {12794, 6, 3, 3992}, {383, 15, 3, 140}, {2679, 9, 3, 785},
+    {6120, 5, 2, 73}, {5082, 4, 2, 1514}, {6125, 6, 2, 1944}, {10614, 4, 3, 2046}, {11572, 3, 4, 3688}, {940, 17, 3, 270},
+    {6153, 5, 3, 1954}, {1239, 3, 2, 364}, {4506, 6, 3, 1284}, {13938, 4, 2, 4276}, {10572, 5, 6, 3366}, {12619, 4, 3, 3938},
+    {7190, 5, 3, 2189}, {2051, 16, 3, 640}, {9032, 5, 3, 652}, {12843, 3, 4, 4011}, {5541, 6, 3, 1712}, {1740, 3, 2, 550},
+    {10882, 4, 3, 1020}, {11061, 5, 3, 1047}, {5115, 4, 2, 1536}, {2512, 21, 0, 749}, {8244, 5, 3, 480}, {10142, 4, 3, 771},
+    {4552, 3, 4, 1312}, {7137, 4, 3, 2256}, {11376, 6, 3, 3632}, {12365, 4, 3, 373}, {1330, 6, 2, 395}, {8499, 4, 4, 2784},
+    {5883, 6, 3, 1812}, {3640, 7, 3, 1053}, {5377, 6, 3, 1654}, {1743, 3, 4, 552}, {4961, 11, 3, 1456}, {7589, 6, 3, 380},
+    {478, 4, 2, 172}, {11448, 6, 1, 3656}, {11810, 7, 3, 3732}, {1369, 16, 3, 417}, {442, 5, 3, 152}, {2385, 3, 3, 715},
+    {11857, 5, 1, 127}, {9367, 2, 1, 566}, {12642, 6, 3, 3950}, {6871, 3, 2, 2192}, {11945, 6, 2, 3771}, {8918, 3, 3, 670},
+    {4419, 8, 3, 1269}, {5593, 7, 3, 1720}, {8983, 10, 3, 2798}, {12087, 13, 3, 253}, {12830, 3, 2, 4006}, {8661, 5, 3, 2853},
+    {7381, 7, 3, 2287}, {12866, 8, 2, 4017}, {10773, 5, 3, 3448}, {9238, 6, 3, 2978}, {9314, 5, 3, 3000}, {8072, 6, 3, 2612},
+    {10703, 7, 3, 3417}, {1696, 3, 2, 524}, {5253, 6, 3, 1600}, {10693, 5, 3, 2037}, {6847, 3, 2, 2184}, {1706, 4, 4, 534},
+    {5615, 4, 3, 1725}, {11917, 5, 1, 2068}, {10972, 4, 1, 3518}, {9090, 10, 3, 2944}, {12565, 11, 3, 1275}, {10665, 3, 4, 3400},
+    {10366, 7, 5, 921}, {13032, 14, 3, 637}, {4330, 17, 3, 1244}, {9769, 7, 3, 3161}, {3696, 3, 3, 1079}, {13364, 5, 2, 1422},
+    {12286, 6, 6, 3889}, {12211, 5, 3, 3852}, {7934, 9, 3, 2494}, {7282, 6, 3, 2324}, {1786, 4, 3, 577}, {9614, 6, 3, 730},
+    {1776, 10, 3, 574}, {3794, 17, 3, 1113}, {13093, 8, 3, 4054}, {10976, 8, 3, 3519}, {3550, 3, 2, 1029}, {7732, 6, 2, 2209},
+    {4957, 4, 3, 1453}, {5027, 3, 4, 1466}, {1067, 4, 4, 294}, {9576, 6, 2, 107}, {12623, 3, 3, 1287}, {9556, 5, 2, 3074},
+    {5452, 5, 3, 1334}, {13514, 5, 2, 3513}, {87, 6, 2, 42}, {8257, 8, 3, 480}, {13676, 5, 3, 631}, {2109, 10, 3, 652},
+    {10440, 15, 3, 833}, {4174, 4, 2, 1199}, {10847, 4, 2, 3477}, {3402, 3, 4, 976}, {1245, 17, 3, 370}, {13222, 5, 3, 1401},
+    {8703, 6, 2, 2869}, {13301, 5, 2, 4117}, {9160, 18, 3, 691}, {4008, 18, 3, 1158}, {199, 7, 3, 91}, {8683, 7, 3, 2861},
+    {6104, 5, 3, 1938}, {13341, 14, 3, 1167}, {3002, 16, 5, 871}, {3536, 8, 3, 1020}, {8279, 2, 3, 320}, {5755, 11, 3, 373},
+    {1821, 9, 3, 589}, {1668, 4, 2, 511}, {1861, 11, 3, 598}, {8755, 2, 3, 2885}, {5953, 4, 3, 1854}, {5856, 3, 4, 1795},
+    {7873, 5, 3, 2553}, {5227, 5, 3, 1587}, {11971, 8, 3, 3784}, {5065, 3, 4, 1498}, {1721, 4, 2, 542}, {5909, 4, 3, 1827},
+    {13306, 4, 4, 4119}, {608, 13, 3, 208}, {3865, 18, 3, 1128}, {7359, 4, 2, 2355}, {8287, 5, 3, 2695}, {5183, 2, 3, 1564},
+    {1672, 4, 3, 513}, {9052, 2, 3, 712}, {13355, 5, 3, 1389}, {7078, 15, 3, 607}, {7808, 4, 6, 2517}, {13751, 5, 3, 1597},
+    {7630, 6, 3, 2442}, {7279, 3, 3, 2321}, {7562, 5, 2, 2409}, {12168, 7, 3, 3843}, {7064, 14, 3, 2186}, {10490, 6, 3, 3304},
+    {11198, 5, 3, 1050}, {2184, 11, 3, 664}, {8173, 6, 2, 2653}, {8647, 4, 3, 2841}, {5135, 3, 2, 1544}, {13822, 5, 3, 232},
+    {4555, 9, 3, 1316}, {1960, 15, 3, 619}, {5171, 6, 2, 1560}, {11965, 6, 3, 3781}, {1071, 6, 2, 298}, {13152, 16, 3, 577},
+    {13793, 5, 3, 1735}, {6472, 5, 1, 2067}, {9882, 5, 5, 780}, {11591, 3, 2, 3695}, {9887, 6, 3, 785}, {9913, 5, 5, 794},
+    {533, 14, 2, 198}, {12396, 4, 3, 3899}, {12833, 4, 3, 1341}, {1982, 12, 3, 625}, {13583, 13, 6, 4180}, {1401, 14, 3, 423},
+    {5129, 6, 2, 1542}, {4737, 16, 3, 1383}, {5841, 5, 3, 1786}, {8432, 3, 2, 2746}, {9408, 6, 3, 3030}, {3934, 10, 3, 1140},
+    {8625, 7, 3, 2829}, {9561, 3, 3, 1456}, {3669, 4, 4, 1059}, {9903, 3, 5, 794}, {488, 4, 3, 177}, {9215, 14, 3, 2968},
+    {7205, 6, 3, 2277}, {6829, 7, 3, 2179}, {6900, 5, 3, 1134}, {10146, 9, 3, 771}, {625, 3, 2, 215}, {8121, 14, 3, 2634},
+    {4673, 6, 2, 1360}, {12717, 8, 3, 1290}, {6099, 5, 3, 1935}, {462, 8, 3, 165}, {5057, 4, 4, 1490}, {12199, 8, 3, 3849},
+    {4072, 16, 3, 1170}, {11491, 5, 3, 1125}, {223, 7, 3, 100}, {11956, 4, 3, 3775}, {276, 10, 3, 117}, {6180, 5, 3, 1961},
+    {6355, 15, 3, 2037}, {7335, 5, 2, 2340}, {9000, 7, 3, 673}, {11684, 16, 3, 3699}, {3647, 10, 3, 128}, {2231, 10, 3, 683},
+    {3564, 13, 3, 449}, {12384, 6, 3, 3852}, {13721, 6, 6, 4180}, {10182, 4, 5, 871}, {11667, 17, 3, 345}, {12926, 5, 2, 4021},
+    {5188, 3, 3, 1572}, {4139, 11, 3, 1185}, {4178, 6, 2, 1201}, {971, 17, 3, 276}, {10335, 7, 6, 909}, {11922, 2, 3, 1269},
+    {11052, 2, 3, 1041}, {10128, 7, 3, 3246}, {265, 11, 3, 114}, {2922, 17, 5, 850}, {13789, 4, 3, 496}, {5388, 7, 3, 1657},
+    {13558, 13, 6, 4168}, {5943, 5, 3, 1848}, {5499, 11, 2, 1698}, {13268, 6, 3, 4106}, {13474, 6, 3, 4159}, {5894, 5, 3, 1818},
+    {11585, 6, 3, 3692}, {1357, 12, 3, 414}, {1214, 3, 2, 354}, {9799, 4, 3, 3164}, {10513, 4, 6, 3316}, {8306, 3, 3, 493},
+    {11035, 8, 3, 3537}, {9906, 3, 3, 791}, {2377, 6, 2, 710}, {2584, 16, 2, 757}, {93, 4, 2, 44}, {3952, 13, 3, 1146},
+    {11277, 5, 3, 1185}, {179, 20, 3, 88}, {2427, 4, 3, 723}, {6003, 5, 3, 1884}, {5626, 3, 4, 1731}, {1619, 12, 3, 496},
+    {3220, 16, 5, 921}, {9019, 3, 4, 2921}, {4482, 3, 3, 1284}, {4772, 4, 4, 1394}, {8921, 5, 3, 2894}, {12704, 7, 3, 3977},
+    {4753, 5, 3, 1386}, {12193, 6, 3, 3846}, {10059, 6, 3, 833}, {9443, 9, 6, 3042}, {10710, 5, 3, 1008}, {10469, 16, 3, 890},
+    {10996, 6, 3, 2238}, {5406, 3, 3, 1666}, {8046, 5, 2, 2604}, {9107, 8, 3, 2950}, {13810, 5, 3, 235}, {10004, 15, 3, 3199},
+    {1459, 2, 3, 439}, {1664, 4, 4, 507}, {13233, 5, 3, 1407}, {1455, 4, 4, 435}, {12120, 3, 3, 1325}, {13912, 5, 2, 4256},
+    {11894, 8, 3, 3752}, {7684, 6, 3, 2468}, {2437, 6, 2, 741}, {11880, 4, 3, 3749}, {9865, 5, 5, 3187}, {12694, 5, 3, 3971},
+    {6859, 5, 3, 2186}, {621, 4, 4, 211}, {11311, 5, 3, 1232}, {9752, 5, 2, 3159}, {11282, 4, 3, 241}, {2241, 6, 2, 686},
+    {13942, 4, 2, 4278}, {2195, 8, 3, 667}, {9007, 6, 3, 2918}, {13199, 4, 3, 1220}, {5422, 4, 1, 127}, {957, 14, 3, 273},
+    {7156, 5, 3, 1771}, {5766, 13, 3, 1768}, {11180, 8, 3, 3567}, {6109, 5, 3, 1941}, {6585, 5, 3, 2096}, {13219, 3, 2, 4090},
+    {4168, 6, 2, 1197}, {7266, 2, 3, 2312}, {7344, 4, 3, 2346}, {10455, 14, 3, 882}, {402, 9, 3, 146}, {10827, 6, 2, 3472},
+    {1169, 4, 4, 333}, {5457, 7, 3, 162}, {8562, 4, 3, 586}, {9022, 2, 3, 664}, {9970, 4, 2, 3211}, {20, 5, 2, 7},
+    {7576, 5, 3, 2417}, {7599, 5, 3, 2429}, {5567, 5, 3, 1695}, {11002, 6, 3, 3525}, {7178, 4, 2, 2270}, {162, 4, 2, 78},
+    {7420, 6, 3, 2360}, {12687, 7, 3, 3968}, {9461, 4, 2, 3051}, {9931, 5, 3, 812}, {11931, 6, 2, 3769}, {5211, 3, 4, 1581},
+    {11254, 7, 3, 3597}, {13807, 3, 4, 4235}, {136, 4, 2, 63}, {2607, 12, 3, 765}, {12880, 11, 3, 1334}, {454, 6, 3, 162},
+    {10559, 6, 3, 3357}, {3338, 13, 3, 952}, {9644, 8, 3, 3101}, {9893, 7, 3, 785}, {5813, 18, 3, 1777}, {212, 6, 2, 96},
+    {11160, 4, 3, 1053}, {13400, 6, 3, 4131}, {4880, 15, 3, 1419}, {1889, 17, 3, 604}, {1221, 6, 3, 358}, {3388, 5, 2, 970},
+    {10487, 3, 1, 3303}, {9118, 4, 3, 2953}, {672, 15, 3, 223}, {8482, 3, 4, 2774}, {13965, 6, 3, 1550}, {2229, 2, 3, 680},
+    {10588, 5, 3, 1416}, {59, 13, 3, 30}, {10208, 6, 5, 3269}, {1802, 3, 2, 584}, {8503, 4, 4, 2788}, {5214, 6, 2, 1585},
+    {9667, 10, 3, 3115}, {1217, 4, 2, 356}, {8566, 5, 3, 2811}, {13538, 8, 2, 3820}, {8193, 5, 2, 2661}, {12359, 6, 3, 373},
+    {8412, 6, 2, 2738}, {4707, 8, 1, 1376}, {11638, 14, 3, 1173}, {1128, 16, 3, 325}, {12138, 4, 3, 3825}, {2034, 17, 3, 637},
+    {3788, 3, 3, 1099}, {569, 16, 1, 202}, {11316, 8, 3, 3614}, {6490, 5, 1, 2068}, {13546, 12, 6, 4162}, {8656, 5, 3, 2850},
+    {10793, 6, 3, 3455}, {12075, 4, 2, 3816}, {6942, 5, 3, 2211}, {8532, 4, 3, 2801}, {13406, 5, 2, 4134}, {12582, 11, 3, 3778},
+    {4934, 3, 2, 1442}, {2897, 14, 3, 842}, {5191, 5, 2, 1575}, {10102, 7, 3, 3240}, {1710, 6, 2, 538}, {8903, 3, 3, 2885},
+    {7475, 4, 2, 2382}, {9325, 4, 4, 3003}, {12012, 5, 3, 704}, {10749, 4, 3, 3436}, {12905, 5, 3, 1334}, {2783, 15, 3, 812},
+    {798, 16, 3, 241}, {9974, 5, 3, 3115}, {6975, 4, 2, 2219}, {2619, 9, 3, 768}, {4569, 10, 4, 1321}, {10291, 6, 3, 946},
+    {13046, 9, 3, 4048}, {7232, 3, 2, 2290}, {8451, 6, 2, 2762}, {4693, 3, 4, 1368}, {6594, 5, 3, 2102}, {13168, 17, 3, 1087},
+    {3853, 12, 3, 1125}, {13652, 5, 3, 4191}, {9244, 7, 3, 2981}, {13317, 11, 3, 1404}, {1659, 5, 2, 505}, {11413, 5, 3, 3644},
+    {12006, 6, 3, 2619}, {5559, 8, 3, 1715}, {8139, 6, 3, 2641}, {2355, 15, 3, 704}, {12266, 4, 3, 253}, {4512, 5, 2, 1293},
+    {11884, 5, 3, 1158}, {5629, 6, 3, 496}, {12484, 7, 3, 3926}, {6641, 3, 3, 2126}, {7604, 8, 3, 2432}, {13952, 6, 2, 4282},
+    {5090, 6, 2, 1518}, {9764, 5, 3, 3161}, {10173, 3, 3, 868}, {11388, 6, 3, 2968}, {5575, 5, 1, 126}, {5715, 8, 3, 1759},
+    {10382, 5, 3, 940}, {8672, 6, 1, 2857}, {12103, 5, 2, 3818}, {7288, 5, 2, 2327}, {3731, 3, 2, 1097}, {6246, 5, 2, 444},
+    {4942, 6, 3, 1447}, {13982, 7, 3, 4296}, {5014, 13, 1, 1303}, {13997, 3, 0, 749}, {10501, 6, 3, 3310}, {11364, 7, 3, 3626},
+    {9793, 6, 5, 820}, {8167, 6, 1, 1960}, {13274, 8, 3, 4106}, {11817, 4, 1, 3735}, {6874, 5, 2, 2194}, {9599, 7, 3, 3082},
+    {5167, 4, 4, 1556}, {10618, 4, 3, 2049}, {5030, 4, 4, 1470}, {6767, 5, 3, 2156}, {6262, 6, 2, 1998}, {10054, 5, 3, 825},
+    {3705, 4, 3, 1084}, {6483, 7, 3, 39}, {8550, 6, 3, 574}, {7041, 14, 3, 52}, {5074, 4, 4, 1508}, {5317, 8, 3, 1630},
+    {7826, 5, 3, 2530}, {6349, 6, 3, 2034}, {1083, 6, 2, 304}, {10856, 3, 3, 253}, {3375, 2, 2, 964}, {7911, 5, 3, 2572},
+    {10214, 6, 5, 3274}, {13993, 4, 4, 4303}, {6985, 6, 3, 2224}, {4198, 6, 2, 1210}, {8993, 7, 3, 664}, {3209, 11, 3, 918},
+    {6241, 5, 3, 1990}, {10307, 7, 3, 898}, {7996, 4, 6, 2587}, {6916, 11, 3, 2206}, {10641, 4, 3, 3389}, {7331, 4, 1, 1303},
+    {8589, 5, 3, 592}, {13055, 13, 3, 3749}, {5049, 5, 3, 1483}, {50, 5, 2, 24}, {7426, 5, 3, 134}, {10889, 6, 1, 3492},
+    {13445, 4, 2, 4148}, {7515, 13, 3, 2294}, {754, 24, 3, 235}, {9870, 6, 3, 765}, {11580, 5, 3, 1173}, {6251, 5, 3, 1993},
+    {4229, 14, 3, 589}, {13917, 3, 2, 4258}, {5061, 4, 4, 1494}, {8536, 6, 2, 2804}, {5962, 5, 3, 1860}, {10342, 9, 3, 915},
+    {8410, 2, 3, 502}, {12374, 4, 4, 3895}, {11083, 11, 3, 1047}, {12321, 5, 3, 1247}, {11652, 15, 3, 1122}, {5972, 5, 3, 1866},
+    {286, 11, 3, 120}, {8181, 5, 2, 2655}, {13596, 8, 2, 4017}, {1920, 17, 3, 610}, {13785, 4, 4, 4231}, {9350, 5, 1, 127},
+    {6950, 6, 2, 2214}, {1760, 6, 2, 567}, {1461, 6, 2, 442}, {11533, 7, 3, 1188}, {2688, 10, 3, 788}, {1046, 12, 3, 291},
+    {12725, 9, 3, 3947}, {11868, 6, 3, 3702}, {2067, 15, 3, 643}, {9332, 4, 3, 673}, {10531, 7, 3, 3335}, {10302, 5, 3, 771},
+    {13203, 5, 2, 4084}, {1144, 20, 3, 328}, {13244, 3, 4, 4097}, {13619, 16, 3, 1152}, {6505, 6, 3, 1225}, {13845, 4, 4, 4244},
+    {3883, 18, 3, 1131}, {4725, 12, 3, 1380}, {474, 4, 2, 170}, {4687, 6, 2, 1366}, {3284, 16, 3, 940}, {7503, 12, 3, 361},
+    {1553, 4, 2, 470}, {11800, 4, 4, 3725}, {7456, 4, 3, 2375}, {6969, 6, 3, 2216}, {5201, 3, 2, 1577}, {8932, 7, 3, 2900},
+    {156, 6, 3, 75}, {9994, 10, 3, 3218}, {11902, 7, 3, 3755}, {11560, 6, 3, 3685}, {321, 21, 1, 126}, {12241, 6, 3, 3873},
+    {6027, 5, 3, 1896}, {256, 9, 3, 111}, {12666, 7, 3, 3959}, {4684, 3, 2, 1364}, {6144, 5, 3, 1706}, {12711, 6, 3, 1287},
+    {9373, 5, 3, 3018}, {3791, 3, 2, 1111}, {42, 5, 2, 19}, {11804, 6, 3, 3729}, {3657, 12, 3, 1056}, {9550, 3, 4, 3067},
+    {10552, 7, 6, 3351}, {13871, 4, 4, 4248}, {13083, 6, 3, 4051}, {517, 16, 2, 196}, {5263, 8, 3, 1606}, {13989, 4, 4, 4299},
+    {9532, 5, 1, 1960}, {13908, 4, 2, 4254}, {12837, 6, 3, 4008}, {9909, 4, 3, 791}, {6140, 4, 3, 1703}, {12753, 6, 3, 3980},
+    {9229, 5, 3, 2971}, {8394, 5, 3, 2732}, {3635, 5, 1, 126}, {778, 20, 3, 238}, {8155, 6, 2, 2648}, {12024, 4, 2, 3798},
+    {12800, 5, 2, 3995}, {7831, 4, 2, 2533}, {28, 3, 4, 11}, {3553, 2, 2, 1031}, {7483, 4, 1, 2387}, {1586, 5, 2, 485},
+    {5400, 4, 4, 1662}, {8161, 6, 3, 2650}, {12058, 6, 3, 2480}, {1107, 3, 4, 314}, {1716, 5, 2, 540}, {6772, 5, 3, 2159},
+    {3478, 6, 2, 1001}, {6816, 4, 3, 256}, {5445, 4, 4, 1680}, {4679, 5, 2, 1362}, {9858, 7, 3, 1419}, {6590, 4, 3, 2099},
+    {7403, 11, 3, 2321}, {6131, 4, 4, 1946}, {3709, 4, 3, 1087}, {10517, 6, 3, 3322}, {7660, 6, 2, 2457}, {47, 3, 3, 21},
+    {5580, 6, 3, 57}, {2203, 14, 3, 670}, {10236, 6, 3, 890}, {10155, 6, 6, 3252}, {6114, 6, 3, 1700}, {7298, 8, 3, 2329},
+    {7348, 6, 3, 2349}, {2533, 20, 3, 439}, {7221, 5, 2, 2285}, {10321, 4, 3, 3283}, {1475, 5, 2, 447}, {368, 9, 3, 134},
+    {9529, 3, 2, 3065}, {10191, 7, 5, 871}, {9401, 7, 3, 3027}, {3713, 6, 3, 1090}, {702, 20, 3, 229}, {11746, 5, 3, 1122},
+    {12916, 5, 2, 4019}, {77, 4, 4, 35}, {13768, 3, 4, 4223}, {10928, 6, 3, 723}, {9489, 10, 3, 291}, {4485, 8, 3, 1287},
+    {10361, 5, 3, 918}, {13920, 3, 2, 4260}, {6022, 5, 3, 1893}, {11382, 6, 3, 2634}, {12814, 4, 3, 1014}, {6211, 8, 3, 1972},
+    {3091, 21, 3, 890}, {12626, 4, 2, 3941}, {6301, 4, 2, 2013}, {12891, 8, 3, 1325}, {6541, 6, 3, 140}, {3916, 18, 3, 1137},
+    {7249, 2, 3, 2301}, {116, 3, 2, 55}, {6777, 8, 3, 123}, {3676, 4, 1, 126}, {13508, 6, 2, 3506}, {10630, 5, 3, 2052},
+    {3750, 18, 3, 1105}, {12467, 5, 3, 3917}, {10325, 5, 5, 3286}, {11911, 6, 2, 3761}, {11987, 4, 3, 3789}, {10081, 6, 5, 3230},
+    {11026, 7, 3, 3534}, {11942, 3, 3, 1272}, {5831, 5, 3, 1780}, {5998, 5, 3, 1881}, {7861, 3, 3, 2550}, {5275, 3, 3, 1612},
+    {12576, 6, 3, 1272}, {10135, 7, 3, 3249}, {5470, 4, 2, 1687}, {13147, 5, 3, 1728}, {10593, 7, 3, 1416}, {1725, 4, 2, 544},
+    {9465, 4, 3, 3053}, {12659, 7, 3, 3956}, {12634, 4, 2, 3945}, {11984, 3, 2, 3787}, {2911, 11, 5, 845}, {4793, 16, 3, 1401},
+    {10582, 6, 3, 3375},
+};
+
+static const char HTML_ENTITY_NAMES[] =
+    "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAscrAssignAtildeAum"
+    "lBackslashBarvBarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDiffer"
+    "entialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinusCirclePlusCi"
+    "rcleTimesClockwiseContourIntegralCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintC"
+    "ontourIntegralCopfCoproductCounterClockwiseContourIntegralCrossCscrCupCupCapDDDDotrahdDJcyDScyDZ"
+    "cyDaggerDarrDashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacrit"
+    "icalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqualDoubleContourIntegralDoubleDot"
+    "DoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTeeDoubleLongLeftArrowDoubleLongLeft"
+    "RightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoubleUpArrowDoubleUpDownArrowDouble"
+    "VerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreveDownLeftRightVectorDownLeftTeeVectorDow"
+    "nLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDownRightVectorBarDownTeeDownTeeArr"
+    "owDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquareEmptyVer"
+    "ySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEtaEumlExistsExponentialEFcyFfrFil"
+    "ledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcy"
+    "GdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqualGreaterGreaterGreaterLessGreaterSlantEq"
+    "ualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopfHorizontalLineHscrHstrokHumpDownHumpH"
+    "umpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacrImaginaryIImpliesIntIntegralIntersectionI"
+    "nvisibleCommaInvisibleTimesIogonIopfIotaIscrItildeIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJc"
+    "yKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarrLcaronLcedilLcyLeftAngleBracketLef"
+    "tArrowLeftArrowBarLeftArrowRightArrowLeftCeilingLeftDoubleBracketLeftDownTeeVectorLeftDownVector"
+    "LeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLeftTeeArrowLeftTeeVectorLeftTrian"
+    "gleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVectorLeftUpVectorLeftUpVectorBarLef"
+    "tVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessFullEqualLessGreaterLessLessLessS"
+    "lantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarro"
+    "wLongleftrightarrowLongrightarrowLopfLowerLeftArrowLowerRightArrowLscrLshLstrokLtMapMcyMediumSpa"
+    "ceMellintrfMfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpaceN"
+    "egativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedLessLessNewLineNfrNoBreakNonBreak"
+    "ingSpaceNopfNotNotCongruentNotCupCapNotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExists"
+    "NotGreaterNotGreaterEqualNotGreaterFullEqualNotGreaterGreaterNotGreaterLessNotGreaterSlantEqualN"
+    "otGreaterTildeNotHumpDownHumpNotHumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNo"
+    "tLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLessTildeNotNestedGreaterGreaterNo"
+    "tNestedLessLessNotPrecedesNotPrecedesEqualNotPrecedesSlantEqualNotReverseElementNotRightTriangle"
+    "NotRightTriangleBarNotRightTriangleEqualNotSquareSubsetNotSquareSubsetEqualNotSquareSupersetNotS"
+    "quareSupersetEqualNotSubsetNotSubsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucc"
+    "eedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTildeFullEqualNotTildeTildeNotVertic"
+    "alBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfrOgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpen"
+    "CurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracketOverParenthesisPartialDPcyPfrPh"
+    "iPiPlusMinusPoincareplanePopfPrPrecedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductP"
+    "roportionProportionalPscrPsiQUOTQfrQopfQscrRBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseE"
+    "lementReverseEquilibriumReverseUpEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightA"
+    "rrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVectorRightDownVectorRightDownVectorBarRi"
+    "ghtFloorRightTeeRightTeeArrowRightTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightU"
+    "pDownVectorRightUpTeeVectorRightUpVectorRightUpVectorBarRightVectorRightVectorBarRightarrowRopfR"
+    "oundImpliesRrightarrowRscrRshRuleDelayedSHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDown"
+    "ArrowShortLeftArrowShortRightArrowShortUpArrowSigmaSmallCircleSopfSqrtSquareSquareIntersectionSq"
+    "uareSubsetSquareSubsetEqualSquareSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEq"
+    "ualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatSumSupSupersetSupersetEqualSupset"
+    "THORNTRADETSHcyTScyTabTauTcaronTcedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTilde"
+    "FullEqualTildeTildeTopfTripleDotTscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUm"
+    "acrUnderBarUnderBraceUnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrow"
+    "DownArrowUpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowU"
+    "psiUpsilonUringUscrUtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVertical"
+    "SeparatorVerticalTildeVeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYU"
+    "cyYacuteYcircYcyYfrYopfYscrYumlZHcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabrevea"
+    "cacEacdacircacuteacyaeligafafragravealefsymalephalphaamacramalgampandandandanddandslopeandvangan"
+    "geangleangmsdangmsdaaangmsdabangmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvb"
+    "dangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeqaringascrastasympasympeqatildeau"
+    "mlawconintawintbNotbackcongbackepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkb"
+    "congbcybdquobecausbecausebemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplusb"
+    "igotimesbigsqcupbigstarbigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblack"
+    "squareblacktriangleblacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34block"
+    "bnebnequivbnotbopfbotbottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxU"
+    "rboxVboxVHboxVLboxVRboxVhboxVlboxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusbox"
+    "plusboxtimesboxuLboxuRboxulboxurboxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsim"
+    "bsimebsolbsolbbsolhsubbullbulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdotcap"
+    "scaretcaronccapsccaronccedilccircccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkc"
+    "hicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircledScircledastcircledcirccircledda"
+    "shcirecirfnintcirmidcirscirclubsclubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplex"
+    "escongcongdotconintcopfcoprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprc"
+    "uesccularrcularrpcupcupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyv"
+    "eecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArrdHardaggerdaleth"
+    "darrdashdashvdbkarowdblacdcarondcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdia"
+    "monddiamondsuitdiamsdiedigammadisindivdividedivideontimesdivonxdjcydlcorndlcropdollardopfdotdote"
+    "qdoteqdotdotminusdotplusdotsquaredoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoon"
+    "rightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdotdtridtrifduarrduhardwangledzcydzigrarreDDoteDote"
+    "acuteeasterecaronecirecircecolonecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremp"
+    "tyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcoloneqsi"
+    "meqslantgtreqslantlessequalsequestequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexcle"
+    "xistexpectationexponentialefallingdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfno"
+    "ffopfforallforkforkvfpartintfrac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38fr"
+    "ac45frac56frac58frac78fraslfrownfscrgEgElgacutegammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqsl"
+    "antgesgesccgesdotgesdotogesdotolgeslgeslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneq"
+    "qgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdotgtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtre"
+    "qqlessgtrlessgtrsimgvertneqqgvnEhArrhairsphalfhamilthardcyharrharrcirharrwhbarhcircheartsheartsu"
+    "ithellipherconhfrhksearowhkswarowhoarrhomththookleftarrowhookrightarrowhopfhorbarhscrhslashhstro"
+    "khybullhypheniacuteicicircicyiecyiexcliffifrigraveiiiiiintiiintiinfiniiotaijligimacrimageimaglin"
+    "eimagpartimathimofimpedinincareinfininfintieinodotintintcalintegersintercalintlarhkintprodiocyio"
+    "goniopfiotaiprodiquestiscrisinisinEisindotisinsisinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfj"
+    "scrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcykopfkscrlAarrlArrlAtaillBarrlElEglHarlacutela"
+    "emptyvlagranlambdalanglangdlanglelaplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtlla"
+    "tlataillatelateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronlcedillceillcublcyldcaldquoldquor"
+    "ldrdharldrusharldshleleftarrowleftarrowtailleftharpoondownleftharpoonupleftleftarrowsleftrightar"
+    "rowleftrightarrowsleftrightharpoonsleftrightsquigarrowleftthreetimeslegleqleqqleqslantleslesccle"
+    "sdotlesdotolesdotorlesglesgeslessapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlg"
+    "lgElhardlharulharullhblkljcyllllarrllcornerllhardlltrilmidotlmoustlmoustachelnElnaplnapproxlneln"
+    "eqlneqqlnsimloangloarrlobrklongleftarrowlongleftrightarrowlongmapstolongrightarrowlooparrowleftl"
+    "ooparrowrightloparlopflopluslotimeslowastlowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhardl"
+    "rmlrtrilsaquolscrlshlsimlsimelsimglsqblsquolsquorlstrokltltccltcirltdotlthreeltimesltlarrltquest"
+    "ltrParltriltrieltriflurdsharluruharlvertneqqlvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapst"
+    "oleftmapstoupmarkermcommamcymdashmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbminusdm"
+    "inusdumlcpmldrmnplusmodelsmopfmpmscrmstposmumultimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLln"
+    "LtnLtvnRightarrownVDashnVdashnablanacutenangnapnapEnapidnaposnapproxnaturnaturalnaturalsnbspnbum"
+    "pnbumpencapncaronncedilncongncongdotncupncyndashneneArrnearhknearrnearrownedotnequivnesearnesimn"
+    "existnexistsnfrngEngengeqngeqqngeqslantngesngsimngtngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnl"
+    "arrnldrnlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnlsimnltnltrinltrienmidnopfnotnoti"
+    "nnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivbnotnivcnparnparallelnparslnpartnpolintnpr"
+    "nprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrownrtrinrtrienscnsccuenscenscrnshortmidnsho"
+    "rtparallelnsimnsimensimeqnsmidnsparnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccns"
+    "ucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntriangleleftntrianglelefteqntriangle"
+    "rightntrianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvltnvltrien"
+    "vrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastocirocircocyodashodblacodivodotodsoldo"
+    "eligofcirofrogonograveogtohbarohmointolarrolcirolcrossolineoltomacromegaomicronomidominusoopfopa"
+    "roperpoplusororarrordorderorderofordfordmorigoforororslopeorvoscroslashosolotildeotimesotimesaso"
+    "umlovbarparparaparallelparsimparslpartpcypercntperiodpermilperppertenkpfrphiphivphmmatphonepipit"
+    "chforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmnplussimplustwopmpoint"
+    "intpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsimpr"
+    "imeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsipuncspqfrqintqop"
+    "fqprimeqscrquaternionsquatintquestquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrang"
+    "rangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtlrarrwratail"
+    "ratiorationalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardldharrdquor"
+    "dquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrharurharulrhorhovrightarrowrightarr"
+    "owtailrightharpoondownrightharpoonuprightleftarrowsrightleftharpoonsrightrightarrowsrightsquigar"
+    "rowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustachernmidroangroarrrobrkroparropfropl"
+    "usrotimesrparrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimesrtrirtriertrifrtriltriru"
+    "luharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpolintscsimscysdotsdotbsdot"
+    "eseArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrownsharpshchcyshcyshortmidshortpara"
+    "llelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimnesimplussimrarrslarrsmallsetminu"
+    "ssmashpsmeparslsmidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsq"
+    "cupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarrsscrssetmn"
+    "ssmilesstarfstarstarfstraightepsilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesub"
+    "plussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsubsubsupsuccsuccapproxsucccurlyeq"
+    "succeqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupesupedotsuphso"
+    "lsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsupsetneqsupsetneqqsupsimsupsubsup"
+    "supswArrswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrectfrthere4thereforethe"
+    "tathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesbtimesbartimesdtinttoeat"
+    "optopbottopcirtopftopforktosatprimetradetriangletriangledowntrianglelefttrianglelefteqtriangleqt"
+    "rianglerighttrianglerighteqtridottrietriminustriplustrisbtritimetrpeziumtscrtscytshcytstroktwixt"
+    "twoheadleftarrowtwoheadrightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufru"
+    "graveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrowupharpoonleftuph"
+    "arpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtriuscrutdotutildeutriutrif"
+    "uuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnothingvarphivarpivarproptovarrvarr"
+    "hovarsigmavarsubsetneqvarsubsetneqqvarsupsetneqvarsupsetneqqvarthetavartriangleleftvartriangleri"
+    "ghtvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnEvsubnevsupnEv"
+    "supnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArrxharrxixl"
+    "ArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixveexwedgeyacuteyacyycircycy"
+    "yenyfryicyyopfyscryucyyumlzacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+static const char HTML_ENTITY_VALUES[] =
+    "\xC3\x86&\xC3\x81\xC4\x82\xC3\x82\xD0\x90\xF0\x9D\x94\x84\xC3\x80\xCE\x91\xC4\x80\xE2\xA9\x93\xC4\x84\xF0\x9D\x94\xB8\xE2\x81\xA1\xC3\x85\xF0\x9D\x92\x9C\xE2\x89\x94\xC3\x83\xC3\x84\xE2\x88"
+    "\x96\xE2\xAB\xA7\xE2\x8C\x86\xD0\x91\xE2\x88\xB5\xE2\x84\xAC\xCE\x92\xF0\x9D\x94\x85\xF0\x9D\x94\xB9\xCB\x98\xE2\x89\x8E\xD0\xA7(c)\xC4\x86\xE2\x8B\x92\xE2\x85\x85\xE2\x84\xAD\xC4\x8C"
+    "\xC3\x87\xC4\x88\xE2\x88\xB0\xC4\x8A\xC2\xB8\xC2\xB7\xCE\xA7\xE2\x8A\x99\xE2\x8A\x96\xE2\x8A\x95\xE2\x8A\x97\xE2\x88\xB2\"'\xE2\x88\xB7\xE2\xA9\xB4\xE2\x89\xA1\xE2\x88\xAF\xE2\x88\xAE\xE2"
+    "\x84\x82\xE2\x88\x90\xE2\x88\xB3\xE2\xA8\xAF\xF0\x9D\x92\x9E\xE2\x8B\x93\xE2\x89\x8D\xE2\xA4\x91\xD0\x82\xD0\x85\xD0\x8F\xE2\x80\xA1\xE2\x86\xA1\xE2\xAB\xA4\xC4\x8E\xD0\x94\xE2\x88\x87\xCE\x94"
+    "\xF0\x9D\x94\x87\xC2\xB4\xCB\x99\xCB\x9D`\xCB\x9C\xE2\x8B\x84\xE2\x85\x86\xF0\x9D\x94\xBB\xC2\xA8\xE2\x83\x9C\xE2\x89\x90\xE2\x87\x93\xE2\x87\x90\xE2\x87\x94\xE2\x9F\xB8\xE2\x9F\xBA\xE2\x9F"
+    "\xB9\xE2\x87\x92\xE2\x8A\xA8\xE2\x87\x91\xE2\x87\x95\xE2\x88\xA5\xE2\x86\x93\xE2\xA4\x93\xE2\x87\xB5\xCC\x91\xE2\xA5\x90\xE2\xA5\x9E\xE2\x86\xBD\xE2\xA5\x96\xE2\xA5\x9F\xE2\x87\x81\xE2\xA5\x97"
+    "\xE2\x8A\xA4\xE2\x86\xA7\xF0\x9D\x92\x9F\xC4\x90\xC5\x8A\xC3\x90\xC3\x89\xC4\x9A\xC3\x8A\xD0\xAD\xC4\x96\xF0\x9D\x94\x88\xC3\x88\xE2\x88\x88\xC4\x92\xE2\x97\xBB\xE2\x96\xAB\xC4\x98\xF0\x9D\x94"
+    "\xBC\xCE\x95\xE2\xA9\xB5\xE2\x89\x82\xE2\x87\x8C\xE2\x84\xB0\xE2\xA9\xB3\xCE\x97\xC3\x8B\xE2\x88\x83\xE2\x85\x87\xD0\xA4\xF0\x9D\x94\x89\xE2\x97\xBC\xE2\x96\xAA\xF0\x9D\x94\xBD\xE2\x88\x80\xE2"
+    "\x84\xB1\xD0\x83>\xCE\x93\xCF\x9C\xC4\x9E\xC4\xA2\xC4\x9C\xD0\x93\xC4\xA0\xF0\x9D\x94\x8A\xE2\x8B\x99\xF0\x9D\x94\xBE\xE2\x89\xA5\xE2\x8B\x9B\xE2\x89\xA7\xE2\xAA\xA2\xE2\x89\xB7\xE2\xA9\xBE"
+    "\xE2\x89\xB3\xF0\x9D\x92\xA2\xE2\x89\xAB\xD0\xAA\xCB\x87^\xC4\xA4\xE2\x84\x8C\xE2\x84\x8B\xE2\x84\x8D\xE2\x94\x80\xC4\xA6\xE2\x89\x8F\xD0\x95\xC4\xB2\xD0\x81\xC3\x8D\xC3\x8E\xD0\x98\xC4\xB0"
+    "\xE2\x84\x91\xC3\x8C\xC4\xAA\xE2\x85\x88\xE2\x88\xAC\xE2\x88\xAB\xE2\x8B\x82\xE2\x81\xA3\xE2\x81\xA2\xC4\xAE\xF0\x9D\x95\x80\xCE\x99\xE2\x84\x90\xC4\xA8\xD0\x86\xC3\x8F\xC4\xB4\xD0\x99\xF0\x9D"
+    "\x94\x8D\xF0\x9D\x95\x81\xF0\x9D\x92\xA5\xD0\x88\xD0\x84\xD0\xA5\xD0\x8C\xCE\x9A\xC4\xB6\xD0\x9A\xF0\x9D\x94\x8E\xF0\x9D\x95\x82\xF0\x9D\x92\xA6\xD0\x89<\xC4\xB9\xCE\x9B\xE2\x9F\xAA\xE2\x84"
+    "\x92\xE2\x86\x9E\xC4\xBD\xC4\xBB\xD0\x9B\xE2\x9F\xA8\xE2\x86\x90\xE2\x87\xA4\xE2\x87\x86\xE2\x8C\x88\xE2\x9F\xA6\xE2\xA5\xA1\xE2\x87\x83\xE2\xA5\x99\xE2\x8C\x8A\xE2\x86\x94\xE2\xA5\x8E\xE2\x8A"
+    "\xA3\xE2\x86\xA4\xE2\xA5\x9A\xE2\x8A\xB2\xE2\xA7\x8F\xE2\x8A\xB4\xE2\xA5\x91\xE2\xA5\xA0\xE2\x86\xBF\xE2\xA5\x98\xE2\x86\xBC\xE2\xA5\x92\xE2\x8B\x9A\xE2\x89\xA6\xE2\x89\xB6\xE2\xAA\xA1\xE2\xA9"
+    "\xBD\xE2\x89\xB2\xF0\x9D\x94\x8F\xE2\x8B\x98\xE2\x87\x9A\xC4\xBF\xE2\x9F\xB5\xE2\x9F\xB7\xE2\x9F\xB6\xF0\x9D\x95\x83\xE2\x86\x99\xE2\x86\x98\xE2\x86\xB0\xC5\x81\xE2\x89\xAA\xE2\xA4\x85\xD0\x9C"
+    "\xE2\x81\x9F\xE2\x84\xB3\xF0\x9D\x94\x90\xE2\x88\x93\xF0\x9D\x95\x84\xCE\x9C\xD0\x8A\xC5\x83\xC5\x87\xC5\x85\xD0\x9D\x0A\xF0\x9D\x94\x91\xE2\x81\xA0\xC2\xA0\xE2\x84\x95\xE2\xAB\xAC\xE2\x89\xA2"
+    "\xE2\x89\xAD\xE2\x88\xA6\xE2\x88\x89\xE2\x89\xA0\xE2\x89\x82\xCC\xB8\xE2\x88\x84\xE2\x89\xAF\xE2\x89\xB1\xE2\x89\xA7\xCC\xB8\xE2\x89\xAB\xCC\xB8\xE2\x89\xB9\xE2\xA9\xBE\xCC\xB8\xE2\x89\xB5\xE2"
+    "\x89\x8E\xCC\xB8\xE2\x89\x8F\xCC\xB8\xE2\x8B\xAA\xE2\xA7\x8F\xCC\xB8\xE2\x8B\xAC\xE2\x89\xAE\xE2\x89\xB0\xE2\x89\xB8\xE2\x89\xAA\xCC\xB8\xE2\xA9\xBD\xCC\xB8\xE2\x89\xB4\xE2\xAA\xA2\xCC\xB8\xE2"
+    "\xAA\xA1\xCC\xB8\xE2\x8A\x80\xE2\xAA\xAF\xCC\xB8\xE2\x8B\xA0\xE2\x88\x8C\xE2\x8B\xAB\xE2\xA7\x90\xCC\xB8\xE2\x8B\xAD\xE2\x8A\x8F\xCC\xB8\xE2\x8B\xA2\xE2\x8A\x90\xCC\xB8\xE2\x8B\xA3\xE2\x8A\x82"
+    "\xE2\x83\x92\xE2\x8A\x88\xE2\x8A\x81\xE2\xAA\xB0\xCC\xB8\xE2\x8B\xA1\xE2\x89\xBF\xCC\xB8\xE2\x8A\x83\xE2\x83\x92\xE2\x8A\x89\xE2\x89\x81\xE2\x89\x84\xE2\x89\x87\xE2\x89\x89\xE2\x88\xA4\xF0\x9D"
+    "\x92\xA9\xC3\x91\xCE\x9D\xC5\x92\xC3\x93\xC3\x94\xD0\x9E\xC5\x90\xF0\x9D\x94\x92\xC3\x92\xC5\x8C\xCE\xA9\xCE\x9F\xF0\x9D\x95\x86\xE2\xA9\x94\xF0\x9D\x92\xAA\xC3\x98\xC3\x95\xE2\xA8\xB7\xC3\x96"
+    "\xE2\x80\xBE\xE2\x8F\x9E\xE2\x8E\xB4\xE2\x8F\x9C\xE2\x88\x82\xD0\x9F\xF0\x9D\x94\x93\xCE\xA6\xCE\xA0\xC2\xB1\xE2\x84\x99\xE2\xAA\xBB\xE2\x89\xBA\xE2\xAA\xAF\xE2\x89\xBC\xE2\x89\xBE\xE2\x88\x8F"
+    "\xE2\x88\x9D\xF0\x9D\x92\xAB\xCE\xA8\xF0\x9D\x94\x94\xE2\x84\x9A\xF0\x9D\x92\xAC\xE2\xA4\x90(r)\xC5\x94\xE2\x9F\xAB\xE2\x86\xA0\xE2\xA4\x96\xC5\x98\xC5\x96\xD0\xA0\xE2\x84\x9C\xE2\x88"
+    "\x8B\xE2\x87\x8B\xE2\xA5\xAF\xCE\xA1\xE2\x9F\xA9\xE2\x86\x92\xE2\x87\xA5\xE2\x87\x84\xE2\x8C\x89\xE2\x9F\xA7\xE2\xA5\x9D\xE2\x87\x82\xE2\xA5\x95\xE2\x8C\x8B\xE2\x8A\xA2\xE2\x86\xA6\xE2\xA5\x9B"
+    "\xE2\x8A\xB3\xE2\xA7\x90\xE2\x8A\xB5\xE2\xA5\x8F\xE2\xA5\x9C\xE2\x86\xBE\xE2\xA5\x94\xE2\x87\x80\xE2\xA5\x93\xE2\x84\x9D\xE2\xA5\xB0\xE2\x87\x9B\xE2\x84\x9B\xE2\x86\xB1\xE2\xA7\xB4\xD0\xA9\xD0"
+    "\xA8\xD0\xAC\xC5\x9A\xE2\xAA\xBC\xC5\xA0\xC5\x9E\xC5\x9C\xD0\xA1\xF0\x9D\x94\x96\xE2\x86\x91\xCE\xA3\xE2\x88\x98\xF0\x9D\x95\x8A\xE2\x88\x9A\xE2\x96\xA1\xE2\x8A\x93\xE2\x8A\x8F\xE2\x8A\x91\xE2"
+    "\x8A\x90\xE2\x8A\x92\xE2\x8A\x94\xF0\x9D\x92\xAE\xE2\x8B\x86\xE2\x8B\x90\xE2\x8A\x86\xE2\x89\xBB\xE2\xAA\xB0\xE2\x89\xBD\xE2\x89\xBF\xE2\x88\x91\xE2\x8B\x91\xE2\x8A\x83\xE2\x8A\x87\xC3\x9E("
+    "tm)\xD0\x8B\xD0\xA6 \xCE\xA4\xC5\xA4\xC5\xA2\xD0\xA2\xF0\x9D\x94\x97\xE2\x88\xB4\xCE\x98\xE2\x81\x9F \xE2\x88\xBC\xE2\x89\x83\xE2\x89\x85\xE2\x89\x88\xF0\x9D\x95\x8B\xE2\x83\x9B"
+    "\xF0\x9D\x92\xAF\xC5\xA6\xC3\x9A\xE2\x86\x9F\xE2\xA5\x89\xD0\x8E\xC5\xAC\xC3\x9B\xD0\xA3\xC5\xB0\xF0\x9D\x94\x98\xC3\x99\xC5\xAA_\xE2\x8F\x9F\xE2\x8E\xB5\xE2\x8F\x9D\xE2\x8B\x83\xE2\x8A\x8E"
+    "\xC5\xB2\xF0\x9D\x95\x8C\xE2\xA4\x92\xE2\x87\x85\xE2\x86\x95\xE2\xA5\xAE\xE2\x8A\xA5\xE2\x86\xA5\xE2\x86\x96\xE2\x86\x97\xCF\x92\xCE\xA5\xC5\xAE\xF0\x9D\x92\xB0\xC5\xA8\xC3\x9C\xE2\x8A\xAB\xE2"
+    "\xAB\xAB\xD0\x92\xE2\x8A\xA9\xE2\xAB\xA6\xE2\x8B\x81\xE2\x80\x96\xE2\x88\xA3|\xE2\x9D\x98\xE2\x89\x80\xF0\x9D\x94\x99\xF0\x9D\x95\x8D\xF0\x9D\x92\xB1\xE2\x8A\xAA\xC5\xB4\xE2\x8B\x80\xF0\x9D"
+    "\x94\x9A\xF0\x9D\x95\x8E\xF0\x9D\x92\xB2\xF0\x9D\x94\x9B\xCE\x9E\xF0\x9D\x95\x8F\xF0\x9D\x92\xB3\xD0\xAF\xD0\x87\xD0\xAE\xC3\x9D\xC5\xB6\xD0\xAB\xF0\x9D\x94\x9C\xF0\x9D\x95\x90\xF0\x9D\x92\xB4"
+    "\xC5\xB8\xD0\x96\xC5\xB9\xC5\xBD\xD0\x97\xC5\xBB\xCE\x96\xE2\x84\xA8\xE2\x84\xA4\xF0\x9D\x92\xB5\xC3\xA1\xC4\x83\xE2\x88\xBE\xE2\x88\xBE\xCC\xB3\xE2\x88\xBF\xC3\xA2\xD0\xB0\xC3\xA6\xF0\x9D\x94"
+    "\x9E\xC3\xA0\xE2\x84\xB5\xCE\xB1\xC4\x81\xE2\xA8\xBF\xE2\x88\xA7\xE2\xA9\x95\xE2\xA9\x9C\xE2\xA9\x98\xE2\xA9\x9A\xE2\x88\xA0\xE2\xA6\xA4\xE2\x88\xA1\xE2\xA6\xA8\xE2\xA6\xA9\xE2\xA6\xAA\xE2\xA6"
+    "\xAB\xE2\xA6\xAC\xE2\xA6\xAD\xE2\xA6\xAE\xE2\xA6\xAF\xE2\x88\x9F\xE2\x8A\xBE\xE2\xA6\x9D\xE2\x88\xA2\xE2\x8D\xBC\xC4\x85\xF0\x9D\x95\x92\xE2\xA9\xB0\xE2\xA9\xAF\xE2\x89\x8A\xE2\x89\x8B\xC3\xA5"
+    "\xF0\x9D\x92\xB6*\xC3\xA3\xC3\xA4\xE2\xA8\x91\xE2\xAB\xAD\xE2\x89\x8C\xCF\xB6\xE2\x80\xB5\xE2\x88\xBD\xE2\x8B\x8D\xE2\x8A\xBD\xE2\x8C\x85\xE2\x8E\xB6\xD0\xB1\xE2\xA6\xB0\xCE\xB2\xE2\x84\xB6"
+    "\xE2\x89\xAC\xF0\x9D\x94\x9F\xE2\x97\xAF\xE2\xA8\x80\xE2\xA8\x81\xE2\xA8\x82\xE2\xA8\x86\xE2\x98\x85\xE2\x96\xBD\xE2\x96\xB3\xE2\xA8\x84\xE2\xA4\x8D\xE2\xA7\xAB\xE2\x96\xB4\xE2\x96\xBE\xE2\x97"
+    "\x82\xE2\x96\xB8\xE2\x90\xA3\xE2\x96\x92\xE2\x96\x91\xE2\x96\x93\xE2\x96\x88=\xE2\x83\xA5\xE2\x89\xA1\xE2\x83\xA5\xE2\x8C\x90\xF0\x9D\x95\x93\xE2\x8B\x88\xE2\x95\x97\xE2\x95\x94\xE2\x95\x96"
+    "\xE2\x95\x93\xE2\x95\x90\xE2\x95\xA6\xE2\x95\xA9\xE2\x95\xA4\xE2\x95\xA7\xE2\x95\x9D\xE2\x95\x9A\xE2\x95\x9C\xE2\x95\x99\xE2\x95\x91\xE2\x95\xAC\xE2\x95\xA3\xE2\x95\xA0\xE2\x95\xAB\xE2\x95\xA2"
+    "\xE2\x95\x9F\xE2\xA7\x89\xE2\x95\x95\xE2\x95\x92\xE2\x94\x90\xE2\x94\x8C\xE2\x95\xA5\xE2\x95\xA8\xE2\x94\xAC\xE2\x94\xB4\xE2\x8A\x9F\xE2\x8A\x9E\xE2\x8A\xA0\xE2\x95\x9B\xE2\x95\x98\xE2\x94\x98"
+    "\xE2\x94\x94\xE2\x94\x82\xE2\x95\xAA\xE2\x95\xA1\xE2\x95\x9E\xE2\x94\xBC\xE2\x94\xA4\xE2\x94\x9C\xC2\xA6\xF0\x9D\x92\xB7\xE2\x81\x8F\\\xE2\xA7\x85\xE2\x9F\x88-\xE2\xAA\xAE\xC4\x87\xE2\x88"
+    "\xA9\xE2\xA9\x84\xE2\xA9\x89\xE2\xA9\x8B\xE2\xA9\x87\xE2\xA9\x80\xE2\x88\xA9\xEF\xB8\x80\xE2\x81\x81\xE2\xA9\x8D\xC4\x8D\xC3\xA7\xC4\x89\xE2\xA9\x8C\xE2\xA9\x90\xC4\x8B\xE2\xA6\xB2\xC2\xA2\xF0"
+    "\x9D\x94\xA0\xD1\x87\xE2\x9C\x93\xCF\x87\xE2\x97\x8B\xE2\xA7\x83\xCB\x86\xE2\x89\x97\xE2\x86\xBA\xE2\x86\xBB\xE2\x93\x88\xE2\x8A\x9B\xE2\x8A\x9A\xE2\x8A\x9D\xE2\xA8\x90\xE2\xAB\xAF\xE2\xA7\x82"
+    "\xE2\x99\xA3:,@\xE2\x88\x81\xE2\xA9\xAD\xF0\x9D\x95\x94\xE2\x84\x97\xE2\x86\xB5\xE2\x9C\x97\xF0\x9D\x92\xB8\xE2\xAB\x8F\xE2\xAB\x91\xE2\xAB\x90\xE2\xAB\x92\xE2\x8B\xAF\xE2\xA4\xB8\xE2"
+    "\xA4\xB5\xE2\x8B\x9E\xE2\x8B\x9F\xE2\x86\xB6\xE2\xA4\xBD\xE2\x88\xAA\xE2\xA9\x88\xE2\xA9\x86\xE2\xA9\x8A\xE2\x8A\x8D\xE2\xA9\x85\xE2\x88\xAA\xEF\xB8\x80\xE2\x86\xB7\xE2\xA4\xBC\xE2\x8B\x8E\xE2"
+    "\x8B\x8F\xC2\xA4\xE2\x88\xB1\xE2\x8C\xAD\xE2\xA5\xA5\xE2\x80\xA0\xE2\x84\xB8\xE2\xA4\x8F\xC4\x8F\xD0\xB4\xE2\x87\x8A\xE2\xA9\xB7\xC2\xB0\xCE\xB4\xE2\xA6\xB1\xE2\xA5\xBF\xF0\x9D\x94\xA1\xE2\x99"
+    "\xA6\xCF\x9D\xE2\x8B\xB2\xC3\xB7\xE2\x8B\x87\xD1\x92\xE2\x8C\x9E\xE2\x8C\x8D$\xF0\x9D\x95\x95\xE2\x89\x91\xE2\x88\xB8\xE2\x88\x94\xE2\x8A\xA1\xE2\x8C\x9F\xE2\x8C\x8C\xF0\x9D\x92\xB9\xD1\x95"
+    "\xE2\xA7\xB6\xC4\x91\xE2\x8B\xB1\xE2\x96\xBF\xE2\xA6\xA6\xD1\x9F\xE2\x9F\xBF\xC3\xA9\xE2\xA9\xAE\xC4\x9B\xE2\x89\x96\xC3\xAA\xE2\x89\x95\xD1\x8D\xC4\x97\xE2\x89\x92\xF0\x9D\x94\xA2\xE2\xAA\x9A"
+    "\xC3\xA8\xE2\xAA\x96\xE2\xAA\x98\xE2\xAA\x99\xE2\x8F\xA7\xE2\x84\x93\xE2\xAA\x95\xE2\xAA\x97\xC4\x93\xE2\x88\x85\xE2\x80\x84\xE2\x80\x85\xC5\x8B\xC4\x99\xF0\x9D\x95\x96\xE2\x8B\x95\xE2\xA7\xA3"
+    "\xE2\xA9\xB1\xCE\xB5\xCF\xB5=\xE2\x89\x9F\xE2\xA9\xB8\xE2\xA7\xA5\xE2\x89\x93\xE2\xA5\xB1\xE2\x84\xAF\xCE\xB7\xC3\xB0\xC3\xAB\xE2\x82\xAC!\xD1\x84\xE2\x99\x80\xEF\xAC\x83\xEF\xAC\x80\xEF"
+    "\xAC\x84\xF0\x9D\x94\xA3\xEF\xAC\x81" "fj\xE2\x99\xAD\xEF\xAC\x82\xE2\x96\xB1\xC6\x92\xF0\x9D\x95\x97\xE2\x8B\x94\xE2\xAB\x99\xE2\xA8\x8D\xC2\xBD\xE2\x85\x93\xC2\xBC\xE2\x85\x95\xE2\x85\x99"
+    "\xE2\x85\x9B\xE2\x85\x94\xE2\x85\x96\xC2\xBE\xE2\x85\x97\xE2\x85\x9C\xE2\x85\x98\xE2\x85\x9A\xE2\x85\x9D\xE2\x85\x9E\xE2\x81\x84\xE2\x8C\xA2\xF0\x9D\x92\xBB\xE2\xAA\x8C\xC7\xB5\xCE\xB3\xE2\xAA"
+    "\x86\xC4\x9F\xC4\x9D\xD0\xB3\xC4\xA1\xE2\xAA\xA9\xE2\xAA\x80\xE2\xAA\x82\xE2\xAA\x84\xE2\x8B\x9B\xEF\xB8\x80\xE2\xAA\x94\xF0\x9D\x94\xA4\xE2\x84\xB7\xD1\x93\xE2\xAA\x92\xE2\xAA\xA5\xE2\xAA\xA4"
+    "\xE2\x89\xA9\xE2\xAA\x8A\xE2\xAA\x88\xE2\x8B\xA7\xF0\x9D\x95\x98\xE2\x84\x8A\xE2\xAA\x8E\xE2\xAA\x90\xE2\xAA\xA7\xE2\xA9\xBA\xE2\x8B\x97\xE2\xA6\x95\xE2\xA9\xBC\xE2\xA5\xB8\xE2\x89\xA9\xEF\xB8"
+    "\x80\xD1\x8A\xE2\xA5\x88\xE2\x86\xAD\xE2\x84\x8F\xC4\xA5\xE2\x99\xA5...\xE2\x8A\xB9\xF0\x9D\x94\xA5\xE2\xA4\xA5\xE2\xA4\xA6\xE2\x87\xBF\xE2\x88\xBB\xE2\x86\xA9\xE2\x86\xAA\xF0\x9D\x95"
+    "\x99\xE2\x80\x95\xF0\x9D\x92\xBD\xC4\xA7\xE2\x81\x83\xC3\xAD\xC3\xAE\xD0\xB8\xD0\xB5\xC2\xA1\xF0\x9D\x94\xA6\xC3\xAC\xE2\xA8\x8C\xE2\x88\xAD\xE2\xA7\x9C\xE2\x84\xA9\xC4\xB3\xC4\xAB\xC4\xB1\xE2"
+    "\x8A\xB7\xC6\xB5\xE2\x84\x85\xE2\x88\x9E\xE2\xA7\x9D\xE2\x8A\xBA\xE2\xA8\x97\xE2\xA8\xBC\xD1\x91\xC4\xAF\xF0\x9D\x95\x9A\xCE\xB9\xC2\xBF\xF0\x9D\x92\xBE\xE2\x8B\xB9\xE2\x8B\xB5\xE2\x8B\xB4\xE2"
+    "\x8B\xB3\xC4\xA9\xD1\x96\xC3\xAF\xC4\xB5\xD0\xB9\xF0\x9D\x94\xA7\xC8\xB7\xF0\x9D\x95\x9B\xF0\x9D\x92\xBF\xD1\x98\xD1\x94\xCE\xBA\xCF\xB0\xC4\xB7\xD0\xBA\xF0\x9D\x94\xA8\xC4\xB8\xD1\x85\xD1\x9C"
+    "\xF0\x9D\x95\x9C\xF0\x9D\x93\x80\xE2\xA4\x9B\xE2\xA4\x8E\xE2\xAA\x8B\xE2\xA5\xA2\xC4\xBA\xE2\xA6\xB4\xCE\xBB\xE2\xA6\x91\xE2\xAA\x85\xE2\xA4\x9F\xE2\xA4\x9D\xE2\x86\xAB\xE2\xA4\xB9\xE2\xA5\xB3"
+    "\xE2\x86\xA2\xE2\xAA\xAB\xE2\xA4\x99\xE2\xAA\xAD\xE2\xAA\xAD\xEF\xB8\x80\xE2\xA4\x8C\xE2\x9D\xB2{[\xE2\xA6\x8B\xE2\xA6\x8F\xE2\xA6\x8D\xC4\xBE\xC4\xBC\xD0\xBB\xE2\xA4\xB6\xE2\xA5\xA7\xE2"
+    "\xA5\x8B\xE2\x86\xB2\xE2\x89\xA4\xE2\x87\x87\xE2\x8B\x8B\xE2\xAA\xA8\xE2\xA9\xBF\xE2\xAA\x81\xE2\xAA\x83\xE2\x8B\x9A\xEF\xB8\x80\xE2\xAA\x93\xE2\x8B\x96\xE2\xA5\xBC\xF0\x9D\x94\xA9\xE2\xAA\x91"
+    "\xE2\xA5\xAA\xE2\x96\x84\xD1\x99\xE2\xA5\xAB\xE2\x97\xBA\xC5\x80\xE2\x8E\xB0\xE2\x89\xA8\xE2\xAA\x89\xE2\xAA\x87\xE2\x8B\xA6\xE2\x9F\xAC\xE2\x87\xBD\xE2\x9F\xBC\xE2\x86\xAC\xE2\xA6\x85\xF0\x9D"
+    "\x95\x9D\xE2\xA8\xAD\xE2\xA8\xB4\xE2\x88\x97\xE2\x97\x8A(\xE2\xA6\x93\xE2\xA5\xAD\xE2\x80\x8E\xE2\x8A\xBF\xF0\x9D\x93\x81\xE2\xAA\x8D\xE2\xAA\x8F\xC5\x82\xE2\xAA\xA6\xE2\xA9\xB9\xE2\x8B\x89"
+    "\xE2\xA5\xB6\xE2\xA9\xBB\xE2\xA6\x96\xE2\x97\x83\xE2\xA5\x8A\xE2\xA5\xA6\xE2\x89\xA8\xEF\xB8\x80\xE2\x88\xBA\xC2\xAF\xE2\x99\x82\xE2\x9C\xA0\xE2\x96\xAE\xE2\xA8\xA9\xD0\xBC\xF0\x9D\x94\xAA\xE2"
+    "\x84\xA7\xC2\xB5\xE2\xAB\xB0\xE2\x88\x92\xE2\xA8\xAA\xE2\xAB\x9B\xE2\x8A\xA7\xF0\x9D\x95\x9E\xF0\x9D\x93\x82\xCE\xBC\xE2\x8A\xB8\xE2\x8B\x99\xCC\xB8\xE2\x89\xAB\xE2\x83\x92\xE2\x87\x8D\xE2\x87"
+    "\x8E\xE2\x8B\x98\xCC\xB8\xE2\x89\xAA\xE2\x83\x92\xE2\x87\x8F\xE2\x8A\xAF\xE2\x8A\xAE\xC5\x84\xE2\x88\xA0\xE2\x83\x92\xE2\xA9\xB0\xCC\xB8\xE2\x89\x8B\xCC\xB8\xC5\x89\xE2\x99\xAE\xE2\xA9\x83\xC5"
+    "\x88\xC5\x86\xE2\xA9\xAD\xCC\xB8\xE2\xA9\x82\xD0\xBD\xE2\x87\x97\xE2\xA4\xA4\xE2\x89\x90\xCC\xB8\xE2\xA4\xA8\xF0\x9D\x94\xAB\xE2\x86\xAE\xE2\xAB\xB2\xE2\x8B\xBC\xE2\x8B\xBA\xD1\x9A\xE2\x89\xA6"
+    "\xCC\xB8\xE2\x86\x9A\xE2\x80\xA5\xF0\x9D\x95\x9F\xC2\xAC\xE2\x8B\xB9\xCC\xB8\xE2\x8B\xB5\xCC\xB8\xE2\x8B\xB7\xE2\x8B\xB6\xE2\x8B\xBE\xE2\x8B\xBD\xE2\xAB\xBD\xE2\x83\xA5\xE2\x88\x82\xCC\xB8\xE2"
+    "\xA8\x94\xE2\x86\x9B\xE2\xA4\xB3\xCC\xB8\xE2\x86\x9D\xCC\xB8\xF0\x9D\x93\x83\xE2\x8A\x84\xE2\xAB\x85\xCC\xB8\xE2\x8A\x85\xE2\xAB\x86\xCC\xB8\xC3\xB1\xCE\xBD#\xE2\x84\x96\xE2\x80\x87\xE2\x8A"
+    "\xAD\xE2\xA4\x84\xE2\x89\x8D\xE2\x83\x92\xE2\x8A\xAC\xE2\x89\xA5\xE2\x83\x92>\xE2\x83\x92\xE2\xA7\x9E\xE2\xA4\x82\xE2\x89\xA4\xE2\x83\x92<\xE2\x83\x92\xE2\x8A\xB4\xE2\x83\x92\xE2\xA4\x83"
+    "\xE2\x8A\xB5\xE2\x83\x92\xE2\x88\xBC\xE2\x83\x92\xE2\x87\x96\xE2\xA4\xA3\xE2\xA4\xA7\xC3\xB3\xC3\xB4\xD0\xBE\xC5\x91\xE2\xA8\xB8\xE2\xA6\xBC\xC5\x93\xE2\xA6\xBF\xF0\x9D\x94\xAC\xCB\x9B\xC3\xB2"
+    "\xE2\xA7\x81\xE2\xA6\xB5\xE2\xA6\xBE\xE2\xA6\xBB\xE2\xA7\x80\xC5\x8D\xCF\x89\xCE\xBF\xE2\xA6\xB6\xF0\x9D\x95\xA0\xE2\xA6\xB7\xE2\xA6\xB9\xE2\x88\xA8\xE2\xA9\x9D\xE2\x84\xB4\xC2\xAA\xC2\xBA\xE2"
+    "\x8A\xB6\xE2\xA9\x96\xE2\xA9\x97\xE2\xA9\x9B\xC3\xB8\xE2\x8A\x98\xC3\xB5\xE2\xA8\xB6\xC3\xB6\xE2\x8C\xBD\xC2\xB6\xE2\xAB\xB3\xE2\xAB\xBD\xD0\xBF%.\xE2\x80\xB0\xE2\x80\xB1\xF0\x9D\x94\xAD"
+    "\xCF\x86\xCF\x95\xE2\x98\x8E\xCF\x80\xCF\x96\xE2\x84\x8E+\xE2\xA8\xA3\xE2\xA8\xA2\xE2\xA8\xA5\xE2\xA9\xB2\xE2\xA8\xA6\xE2\xA8\xA7\xE2\xA8\x95\xF0\x9D\x95\xA1\xC2\xA3\xE2\xAA\xB3\xE2\xAA\xB7"
+    "\xE2\xAA\xB9\xE2\xAA\xB5\xE2\x8B\xA8\xE2\x8C\xAE\xE2\x8C\x92\xE2\x8C\x93\xE2\x8A\xB0\xF0\x9D\x93\x85\xCF\x88\xE2\x80\x88\xF0\x9D\x94\xAE\xF0\x9D\x95\xA2\xE2\x81\x97\xF0\x9D\x93\x86\xE2\xA8\x96"
+    "?\xE2\xA4\x9C\xE2\xA5\xA4\xE2\x88\xBD\xCC\xB1\xC5\x95\xE2\xA6\xB3\xE2\xA6\x92\xE2\xA6\xA5\xE2\xA5\xB5\xE2\xA4\xA0\xE2\xA4\xB3\xE2\xA4\x9E\xE2\xA5\x85\xE2\xA5\xB4\xE2\x86\xA3\xE2\x86\x9D\xE2"
+    "\xA4\x9A\xE2\x88\xB6\xE2\x9D\xB3}]\xE2\xA6\x8C\xE2\xA6\x8E\xE2\xA6\x90\xC5\x99\xC5\x97\xD1\x80\xE2\xA4\xB7\xE2\xA5\xA9\xE2\x86\xB3\xE2\x96\xAD\xE2\xA5\xBD\xF0\x9D\x94\xAF\xE2\xA5\xAC\xCF"
+    "\x81\xCF\xB1\xE2\x87\x89\xE2\x8B\x8C\xCB\x9A\xE2\x80\x8F\xE2\x8E\xB1\xE2\xAB\xAE\xE2\x9F\xAD\xE2\x87\xBE\xE2\xA6\x86\xF0\x9D\x95\xA3\xE2\xA8\xAE\xE2\xA8\xB5)\xE2\xA6\x94\xE2\xA8\x92\xF0\x9D"
+    "\x93\x87\xE2\x8B\x8A\xE2\x96\xB9\xE2\xA7\x8E\xE2\xA5\xA8\xE2\x84\x9E\xC5\x9B\xE2\xAA\xB4\xE2\xAA\xB8\xC5\xA1\xC5\x9F\xC5\x9D\xE2\xAA\xB6\xE2\xAA\xBA\xE2\x8B\xA9\xE2\xA8\x93\xD1\x81\xE2\x8B\x85"
+    "\xE2\xA9\xA6\xE2\x87\x98\xC2\xA7;\xE2\xA4\xA9\xE2\x9C\xB6\xF0\x9D\x94\xB0\xE2\x99\xAF\xD1\x89\xD1\x88\xCF\x83\xCF\x82\xE2\xA9\xAA\xE2\xAA\x9E\xE2\xAA\xA0\xE2\xAA\x9D\xE2\xAA\x9F\xE2\x89\x86"
+    "\xE2\xA8\xA4\xE2\xA5\xB2\xE2\xA8\xB3\xE2\xA7\xA4\xE2\x8C\xA3\xE2\xAA\xAA\xE2\xAA\xAC\xE2\xAA\xAC\xEF\xB8\x80\xD1\x8C/\xE2\xA7\x84\xE2\x8C\xBF\xF0\x9D\x95\xA4\xE2\x99\xA0\xE2\x8A\x93\xEF\xB8"
+    "\x80\xE2\x8A\x94\xEF\xB8\x80\xF0\x9D\x93\x88\xE2\x98\x86\xE2\x8A\x82\xE2\xAB\x85\xE2\xAA\xBD\xE2\xAB\x83\xE2\xAB\x81\xE2\xAB\x8B\xE2\x8A\x8A\xE2\xAA\xBF\xE2\xA5\xB9\xE2\xAB\x87\xE2\xAB\x95\xE2"
+    "\xAB\x93\xE2\x99\xAA\xC2\xB9\xC2\xB2\xC2\xB3\xE2\xAB\x86\xE2\xAA\xBE\xE2\xAB\x98\xE2\xAB\x84\xE2\x9F\x89\xE2\xAB\x97\xE2\xA5\xBB\xE2\xAB\x82\xE2\xAB\x8C\xE2\x8A\x8B\xE2\xAB\x80\xE2\xAB\x88\xE2"
+    "\xAB\x94\xE2\xAB\x96\xE2\x87\x99\xE2\xA4\xAA\xC3\x9F\xE2\x8C\x96\xCF\x84\xC5\xA5\xC5\xA3\xD1\x82\xE2\x8C\x95\xF0\x9D\x94\xB1\xCE\xB8\xCF\x91\xC3\xBE\xC3\x97\xE2\xA8\xB1\xE2\xA8\xB0\xE2\x8C\xB6"
+    "\xE2\xAB\xB1\xF0\x9D\x95\xA5\xE2\xAB\x9A\xE2\x80\xB4\xE2\x96\xB5\xE2\x89\x9C\xE2\x97\xAC\xE2\xA8\xBA\xE2\xA8\xB9\xE2\xA7\x8D\xE2\xA8\xBB\xE2\x8F\xA2\xF0\x9D\x93\x89\xD1\x86\xD1\x9B\xC5\xA7\xE2"
+    "\xA5\xA3\xC3\xBA\xD1\x9E\xC5\xAD\xC3\xBB\xD1\x83\xC5\xB1\xE2\xA5\xBE\xF0\x9D\x94\xB2\xC3\xB9\xE2\x96\x80\xE2\x8C\x9C\xE2\x8C\x8F\xE2\x97\xB8\xC5\xAB\xC5\xB3\xF0\x9D\x95\xA6\xCF\x85\xE2\x87\x88"
+    "\xE2\x8C\x9D\xE2\x8C\x8E\xC5\xAF\xE2\x97\xB9\xF0\x9D\x93\x8A\xE2\x8B\xB0\xC5\xA9\xC3\xBC\xE2\xA6\xA7\xE2\xAB\xA8\xE2\xAB\xA9\xE2\xA6\x9C\xE2\x8A\x8A\xEF\xB8\x80\xE2\xAB\x8B\xEF\xB8\x80\xE2\x8A"
+    "\x8B\xEF\xB8\x80\xE2\xAB\x8C\xEF\xB8\x80\xD0\xB2\xE2\x8A\xBB\xE2\x89\x9A\xE2\x8B\xAE\xF0\x9D\x94\xB3\xF0\x9D\x95\xA7\xF0\x9D\x93\x8B\xE2\xA6\x9A\xC5\xB5\xE2\xA9\x9F\xE2\x89\x99\xE2\x84\x98\xF0"
+    "\x9D\x94\xB4\xF0\x9D\x95\xA8\xF0\x9D\x93\x8C\xF0\x9D\x94\xB5\xCE\xBE\xE2\x8B\xBB\xF0\x9D\x95\xA9\xF0\x9D\x93\x8D\xC3\xBD\xD1\x8F\xC5\xB7\xD1\x8B\xC2\xA5\xF0\x9D\x94\xB6\xD1\x97\xF0\x9D\x95\xAA"
+    "\xF0\x9D\x93\x8E\xD1\x8E\xC3\xBF\xC5\xBA\xC5\xBE\xD0\xB7\xC5\xBC\xCE\xB6\xF0\x9D\x94\xB7\xD0\xB6\xE2\x87\x9D\xF0\x9D\x95\xAB\xF0\x9D\x93\x8F";
+
+// clang-format on
+
+#endif
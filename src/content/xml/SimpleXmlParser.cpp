@@ -3,7 +3,9 @@
 #include <Arduino.h>
 
 SimpleXmlParser::SimpleXmlParser()
-    : buffer_(nullptr),
+    : rangeStart_(0),
+      rangeLength_(0),
+      buffer_(nullptr),
       memoryData_(nullptr),
       memorySize_(0),
       usingMemory_(false),
@@ -17,6 +19,8 @@ SimpleXmlParser::SimpleXmlParser()
       filePos_(0),
       streamCurrentBuffer_(-1),
       currentNodeType_(None),
+      currentTag_(XmlTag::Unknown),
+      nameLength_(0),
       isEmptyElement_(false),
       textNodeStartPos_(0),
       textNodeEndPos_(0),
@@ -35,6 +39,8 @@ SimpleXmlParser::SimpleXmlParser()
     Serial.printf("  [MEM] SimpleXmlParser ctor: FAILED to allocate primary buffer, Free=%u\n", ESP.getFreeHeap());
   }
 
+  nodeText_.reserve(256);
+
   // Initialize streaming buffers to null
   for (size_t i = 0; i < NUM_STREAM_BUFFERS; i++) {
     streamBuffers_[i] = nullptr;
@@ -65,6 +71,8 @@ bool SimpleXmlParser::open(const char* filepath) {
     return false;
   }
 
+  rangeStart_ = 0;
+  rangeLength_ = file_.size();
   usingMemory_ = false;
   bufferStartPos_ = 0;
   bufferLen_ = 0;
@@ -81,6 +89,19 @@ bool SimpleXmlParser::open(const char* filepath) {
   return true;
 }
 
+bool SimpleXmlParser::openRange(const char* filepath, size_t offset, size_t length) {
+  if (!open(filepath)) {
+    return false;
+  }
+  if (offset > rangeLength_ || length > rangeLength_ - offset) {
+    close();
+    return false;
+  }
+  rangeStart_ = offset;
+  rangeLength_ = length;
+  return true;
+}
+
 bool SimpleXmlParser::openFromMemory(const char* data, size_t dataSize) {
   close();
 
@@ -160,6 +181,8 @@ void SimpleXmlParser::close() {
   if (file_) {
     file_.close();
   }
+  rangeStart_ = 0;
+  rangeLength_ = 0;
   memoryData_ = nullptr;
   memorySize_ = 0;
   usingMemory_ = false;
@@ -186,6 +209,10 @@ void SimpleXmlParser::close() {
   bufferLen_ = 0;
   filePos_ = 0;
   currentNodeType_ = None;
+  currentTag_ = XmlTag::Unknown;
+  nodeText_.clear();
+  nameLength_ = 0;
+  attributes_.clear();
   textNodeStartPos_ = 0;
   textNodeEndPos_ = 0;
   textNodeCurrentPos_ = 0;
@@ -196,7 +223,7 @@ void SimpleXmlParser::close() {
 }
 
 // Load buffer centered around the given position
-bool SimpleXmlParser::loadBufferAround(size_t pos) {
+bool SimpleXmlParser::loadBufferAround(size_t pos, size_t lookBehind) {
   if (usingStream_) {
     // Check if position is already in one of our sliding window buffers
     for (size_t i = 0; i < NUM_STREAM_BUFFERS; i++) {
@@ -279,25 +306,26 @@ bool SimpleXmlParser::loadBufferAround(size_t pos) {
     return false;
   }
 
-  size_t fileSize = file_.size();
+  size_t fileSize = rangeLength_;
   if (fileSize == 0) {
     return false;
   }
 
-  // Try to position buffer so pos is in the middle
-  size_t idealStart = (pos >= BUFFER_SIZE / 2) ? (pos - BUFFER_SIZE / 2) : 0;
+  // Try to position buffer so pos is in the middle (or at the start for forward scans)
+  size_t idealStart = (pos >= lookBehind) ? (pos - lookBehind) : 0;
 
   // Adjust if we'd go past end of file
   if (idealStart + BUFFER_SIZE > fileSize) {
     idealStart = (fileSize > BUFFER_SIZE) ? (fileSize - BUFFER_SIZE) : 0;
   }
 
-  if (!file_.seek(idealStart)) {
+  if (!file_.seek(rangeStart_ + idealStart)) {
     return false;
   }
 
+  // Never read past the range (the next ZIP entry follows a stored entry)
   bufferStartPos_ = idealStart;
-  bufferLen_ = file_.read(buffer_, BUFFER_SIZE);
+  bufferLen_ = file_.read(buffer_, (fileSize - idealStart > BUFFER_SIZE) ? BUFFER_SIZE : (fileSize - idealStart));
 
   return bufferLen_ > 0;
 }
@@ -362,6 +390,31 @@ char SimpleXmlParser::getByteAt(size_t pos) {
   return '\0';
 }
 
+// Bytes that can be read without another load, starting at pos. Memory mode
+// points straight into the caller's data; file mode loads forward from pos.
+size_t SimpleXmlParser::contiguousBytesAt(size_t pos, const char** data) {
+  if (usingMemory_) {
+    if (pos >= memorySize_) {
+      return 0;
+    }
+    *data = memoryData_ + pos;
+    return memorySize_ - pos;
+  }
+  if (bufferLen_ == 0 || pos < bufferStartPos_ || pos >= bufferStartPos_ + bufferLen_) {
+    if (usingStream_ && pos < bufferStartPos_) {
+      return 0;  // Can't seek backward
+    }
+    if ((!usingStream_ && !file_) || !loadBufferAround(pos, 0)) {
+      return 0;
+    }
+    if (pos < bufferStartPos_ || pos >= bufferStartPos_ + bufferLen_) {
+      return 0;
+    }
+  }
+  *data = (const char*)buffer_ + (pos - bufferStartPos_);
+  return bufferStartPos_ + bufferLen_ - pos;
+}
+
 char SimpleXmlParser::peekChar() {
   return getByteAt(filePos_);
 }
@@ -417,7 +470,9 @@ bool SimpleXmlParser::read() {
   }
 
   // Clear previous state
-  currentName_ = "";
+  currentTag_ = XmlTag::Unknown;
+  nodeText_.clear();
+  nameLength_ = 0;
   currentValue_ = "";
   isEmptyElement_ = false;
   attributes_.clear();
@@ -469,7 +524,7 @@ bool SimpleXmlParser::read() {
 bool SimpleXmlParser::readElement() {
   elementStartPos_ = filePos_ - 1;  // -1 because we already consumed '<'
   currentNodeType_ = Element;
-  currentName_ = readElementName();
+  readNodeName();
   parseAttributes();
 
   skipWhitespace();
@@ -493,7 +548,7 @@ bool SimpleXmlParser::readEndElement() {
   elementStartPos_ = filePos_ - 1;  // -1 because we already consumed '<'
   currentNodeType_ = EndElement;
   readChar();  // consume '/'
-  currentName_ = readElementName();
+  readNodeName();
 
   while (true) {
     char c = readChar();
@@ -517,7 +572,8 @@ bool SimpleXmlParser::readText() {
 
   // For streaming mode, we can't scan backward - parent name will be empty
   // The caller should track element stack if needed
-  currentName_ = "";
+  nodeText_.clear();
+  nameLength_ = 0;
 
   if (!usingStream_) {
     // Find parent element name by scanning backward for the opening tag
@@ -545,8 +601,10 @@ bool SimpleXmlParser::readText() {
               nameEnd++;
             }
             for (size_t i = nameStart; i < nameEnd; i++) {
-              currentName_ += (char)getByteAt(i);
+              nodeText_.push_back(getByteAt(i));
             }
+            nodeText_.push_back('\0');
+            nameLength_ = nameEnd - nameStart;
           }
         }
         break;
@@ -554,23 +612,28 @@ bool SimpleXmlParser::readText() {
     }
   }
 
-  // Scan forward to find end of text and buffer content (for streaming mode)
+  // Scan forward a buffer at a time to find end of text and buffer content (for streaming mode)
   size_t scanPos = filePos_;
   bool hasNonWhitespace = false;
 
   while (true) {
-    char c = getByteAt(scanPos);
-    if (c == '\0' || c == '<') {
-      break;
-    }
-    if (!hasNonWhitespace && c != ' ' && c != '\t' && c != '\n' && c != '\r') {
-      hasNonWhitespace = true;
+    const char* run = nullptr;
+    const size_t available = contiguousBytesAt(scanPos, &run);
+    size_t n = 0;
+    while (n < available && run[n] != '<' && run[n] != '\0') {
+      if (!hasNonWhitespace && run[n] != ' ' && run[n] != '\t' && run[n] != '\n' && run[n] != '\r') {
+        hasNonWhitespace = true;
+      }
+      n++;
     }
     // In streaming mode, buffer the text as we scan
-    if (usingStream_) {
-      streamTextBuffer_ += c;
+    if (usingStream_ && n > 0) {
+      streamTextBuffer_.concat(run, n);
+    }
+    scanPos += n;
+    if (n < available || available == 0) {
+      break;
     }
-    scanPos++;
   }
 
   textNodeEndPos_ = scanPos;
@@ -653,7 +716,7 @@ bool SimpleXmlParser::readProcessingInstruction() {
   currentNodeType_ = ProcessingInstruction;
   readChar();  // consume '?'
 
-  currentName_ = readElementName();
+  readNodeName();
   currentValue_ = "";
 
   while (true) {
@@ -673,18 +736,27 @@ bool SimpleXmlParser::readProcessingInstruction() {
   return true;
 }
 
-String SimpleXmlParser::readElementName() {
-  String name;
+size_t SimpleXmlParser::appendElementName() {
+  size_t length = 0;
 
   while (true) {
     char c = peekChar();
     if (c == '\0' || c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '>' || c == '/' || c == '=')
       break;
 
-    name += readChar();
+    nodeText_.push_back(readChar());
+    length++;
   }
+  nodeText_.push_back('\0');
+
+  return length;
+}
 
-  return name;
+void SimpleXmlParser::readNodeName() {
+  nodeText_.clear();
+  attributes_.clear();
+  nameLength_ = appendElementName();
+  currentTag_ = lookupXmlTag(nodeText_.data(), nameLength_);
 }
 
 void SimpleXmlParser::parseAttributes() {
@@ -697,8 +769,10 @@ void SimpleXmlParser::parseAttributes() {
     if (c == '>' || c == '/' || c == '\0')
       break;
 
-    String attrName = readElementName();
-    if (attrName.isEmpty())
+    AttributeSpan attr;
+    attr.name = nodeText_.size();
+    attr.nameLength = appendElementName();
+    if (attr.nameLength == 0)
       break;
 
     skipWhitespace();
@@ -714,17 +788,16 @@ void SimpleXmlParser::parseAttributes() {
       break;
     readChar();
 
-    String attrValue;
+    attr.value = nodeText_.size();
     while (true) {
       char c = readChar();
       if (c == '\0' || c == quote)
         break;
-      attrValue += c;
+      nodeText_.push_back(c);
     }
+    attr.valueLength = nodeText_.size() - attr.value;
+    nodeText_.push_back('\0');
 
-    Attribute attr;
-    attr.name = attrName;
-    attr.value = attrValue;
     attributes_.push_back(attr);
   }
 }
@@ -738,16 +811,21 @@ void SimpleXmlParser::skipToEndOfTag() {
 }
 
 String SimpleXmlParser::getAttribute(const char* name) const {
+  const char* value = findAttribute(name);
+  return String(value ? value : "");
+}
+
+const char* SimpleXmlParser::findAttribute(const char* name, size_t* outLength) const {
   size_t nameLen = strlen(name);
 
   for (size_t i = 0; i < attributes_.size(); i++) {
-    const String& attrName = attributes_[i].name;
-    if (attrName.length() != nameLen)
+    const char* attrName = nodeText_.data() + attributes_[i].name;
+    if (attributes_[i].nameLength != nameLen)
       continue;
 
     bool match = true;
     for (size_t j = 0; j < nameLen; j++) {
-      char c1 = attrName.charAt(j);
+      char c1 = attrName[j];
       char c2 = name[j];
       if (c1 >= 'A' && c1 <= 'Z')
         c1 += 32;
@@ -760,10 +838,13 @@ String SimpleXmlParser::getAttribute(const char* name) const {
     }
 
     if (match) {
-      return attributes_[i].value;
+      if (outLength) {
+        *outLength = attributes_[i].valueLength;
+      }
+      return nodeText_.data() + attributes_[i].value;
     }
   }
-  return String("");
+  return nullptr;
 }
 
 // ========== Text Node Character Reading ==========
@@ -801,6 +882,43 @@ char SimpleXmlParser::readTextNodeCharForward() {
   return c;
 }
 
+const char* SimpleXmlParser::readTextSpan(size_t& length) {
+  length = 0;
+  if (currentNodeType_ != Text) {
+    return nullptr;
+  }
+
+  hasPeekedTextNodeChar_ = false;
+
+  // In streaming mode the whole node is already buffered
+  if (usingStream_) {
+    if (streamTextBufferPos_ >= (size_t)streamTextBuffer_.length()) {
+      return nullptr;
+    }
+    const char* span = streamTextBuffer_.c_str() + streamTextBufferPos_;
+    length = streamTextBuffer_.length() - streamTextBufferPos_;
+    streamTextBufferPos_ = streamTextBuffer_.length();
+    return span;
+  }
+
+  // readText() found the end of the node, so the run contains no '<'
+  if (textNodeCurrentPos_ >= textNodeEndPos_) {
+    return nullptr;
+  }
+  const char* span = nullptr;
+  const size_t available = contiguousBytesAt(textNodeCurrentPos_, &span);
+  if (available == 0) {
+    return nullptr;
+  }
+  length = textNodeEndPos_ - textNodeCurrentPos_;
+  if (length > available) {
+    length = available;
+  }
+  textNodeCurrentPos_ += length;
+  filePos_ = textNodeCurrentPos_;
+  return span;
+}
+
 char SimpleXmlParser::peekTextNodeChar() {
   if (currentNodeType_ != Text) {
     return '\0';
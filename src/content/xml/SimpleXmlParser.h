@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "XmlTags.h"
+
 /**
  * SimpleXmlParser - A buffered XML parser for reading attributes
  *
@@ -28,6 +30,13 @@ class SimpleXmlParser {
    */
   bool open(const char* filepath);
 
+  /**
+   * Open a byte range of a file for parsing, e.g. a stored entry inside a ZIP
+   * Positions reported by the parser are relative to `offset`
+   * Returns true if successful
+   */
+  bool openRange(const char* filepath, size_t offset, size_t length);
+
   /**
    * Open XML from memory buffer for parsing
    * Returns true if successful
@@ -77,7 +86,15 @@ class SimpleXmlParser {
    * Returns empty string for other node types
    */
   String getName() const {
-    return currentName_;
+    return String(nameChars());
+  }
+
+  /**
+   * Interned ID of the current element's name (for Element/EndElement nodes)
+   * Returns XmlTag::Unknown for names outside the XmlTag set
+   */
+  XmlTag getTag() const {
+    return currentTag_;
   }
 
   /**
@@ -95,6 +112,13 @@ class SimpleXmlParser {
    */
   String getAttribute(const char* name) const;
 
+  /**
+   * Find an attribute of the current element without copying it
+   * Returns a NUL-terminated view into the parser's node storage (valid until
+   * the next read()) and its length, or nullptr if the attribute is absent
+   */
+  const char* findAttribute(const char* name, size_t* outLength = nullptr) const;
+
   /**
    * Peek at next character in current text node without advancing
    * Only valid when on a Text node
@@ -111,6 +135,14 @@ class SimpleXmlParser {
   // Text node reading helpers
   char readTextNodeCharForward();
 
+  /**
+   * Read the next contiguous run of the current text node in one go
+   * Returns a view of the bytes already in the parser's buffer (valid until
+   * the next call into the parser) and advances past them, or nullptr once
+   * the text node is exhausted. Only valid when on a Text node
+   */
+  const char* readTextSpan(size_t& length);
+
   /**
    * Get current file position (the cursor)
    */
@@ -148,7 +180,7 @@ class SimpleXmlParser {
     if (!file_) {
       return 0;
     }
-    return file_.size();
+    return rangeLength_;
   }
 
   size_t textNodeStartPos_;  // File position where text node content starts
@@ -156,6 +188,8 @@ class SimpleXmlParser {
 
  private:
   File file_;
+  size_t rangeStart_;   // File offset of position 0 (file mode)
+  size_t rangeLength_;  // Bytes readable from rangeStart_ (file mode)
   const char* memoryData_;  // Pointer to memory buffer (if parsing from memory)
   size_t memorySize_;       // Size of memory buffer
   bool usingMemory_;        // True if parsing from memory instead of file
@@ -183,24 +217,32 @@ class SimpleXmlParser {
   int streamCurrentBuffer_;                         // Index of most recently filled buffer
 
   // Helper functions
-  char getByteAt(size_t pos);         // Get byte at any position, loading buffer if needed
-  bool loadBufferAround(size_t pos);  // Load buffer centered around position
+  char getByteAt(size_t pos);  // Get byte at any position, loading buffer if needed
+  // Load buffer around position, starting up to lookBehind bytes before it (file mode)
+  bool loadBufferAround(size_t pos, size_t lookBehind = BUFFER_SIZE / 2);
+  size_t contiguousBytesAt(size_t pos, const char** data);  // Bytes readable in one run at position
   bool skipWhitespace();
   bool matchString(const char* str);
   char readChar();
   char peekChar();
 
-  // Node state
-  struct Attribute {
-    String name;
-    String value;
+  // Node state. The node's name and attribute names/values are stored
+  // NUL-terminated back to back in nodeText_ (name first); it keeps its
+  // capacity between nodes, so element parsing does not allocate once warm.
+  struct AttributeSpan {
+    size_t name;  // Offsets into nodeText_
+    size_t nameLength;
+    size_t value;
+    size_t valueLength;
   };
 
   NodeType currentNodeType_;
-  String currentName_;
+  XmlTag currentTag_;
+  std::vector<char> nodeText_;
+  size_t nameLength_;
   String currentValue_;  // Only used for Comment, CDATA, ProcessingInstruction nodes
   bool isEmptyElement_;
-  std::vector<Attribute> attributes_;
+  std::vector<AttributeSpan> attributes_;
 
   // Text node reading state
   size_t textNodeCurrentPos_;   // Current position within text node
@@ -223,7 +265,11 @@ class SimpleXmlParser {
   bool readCDATA();
   bool readProcessingInstruction();
   void parseAttributes();
-  String readElementName();
+  size_t appendElementName();  // Append the name at the cursor to nodeText_ (NUL-terminated), return its length
+  void readNodeName();         // Read the node's name into the start of nodeText_ and resolve its tag
+  const char* nameChars() const {
+    return nodeText_.empty() ? "" : nodeText_.data();
+  }
   void skipToEndOfTag();
 };
 
@@ -0,0 +1,59 @@
+#include "XmlTags.h"
+
+#include <string.h>
+
+static_assert((uint8_t)XmlTag::Count <= 32, "Tag sets are uint32_t bitmasks");
+
+// Indexed by XmlTag
+static const char* const XML_TAG_NAMES[] = {
+    "",
+    "p", "div", "h1", "h2", "h3", "h4", "h5", "h6", "blockquote", "li", "section", "article", "header", "footer", "nav",
+    "head", "title", "style", "script",
+    "b", "strong", "i", "em", "span",
+    "br", "hr",
+};
+static_assert(sizeof(XML_TAG_NAMES) / sizeof(XML_TAG_NAMES[0]) == (size_t)XmlTag::Count, "One name per tag");
+
+// FNV-1a style hash with a seed chosen so every tag name above lands in its
+// own slot of XML_TAG_SLOTS. Regenerate the seed and slots when adding tags.
+static constexpr uint32_t XML_TAG_HASH_SEED = 578;
+static constexpr uint32_t XML_TAG_SLOT_MASK = 63;
+
+// Hash slot -> XmlTag (0 = empty)
+static const uint8_t XML_TAG_SLOTS[XML_TAG_SLOT_MASK + 1] = {
+    0,  11, 6,  0, 0,  0,  24, 0, 0, 18, 0, 5, 23, 0,  0, 0,   // 0-15
+    0,  0,  0,  0, 0,  25, 0,  0, 4, 26, 0, 0, 0,  0,  2, 10,  // 16-31
+    3,  0,  0,  20, 8, 0,  0,  0, 12, 0, 0, 15, 13, 7, 0, 0,   // 32-47
+    16, 0,  22, 0, 0,  1,  0,  9, 14, 17, 21, 0, 0, 19, 0, 0,  // 48-63
+};
+
+static uint32_t xmlTagHash(const char* name, size_t length) {
+  uint32_t h = XML_TAG_HASH_SEED;
+  for (size_t i = 0; i < length; i++) {
+    h = (h ^ (uint8_t)name[i]) * 16777619u;
+  }
+  h ^= h >> 16;
+  return h & XML_TAG_SLOT_MASK;
+}
+
+XmlTag lookupXmlTag(const char* name, size_t length) {
+  if (length == 0 || length > 10) {
+    return XmlTag::Unknown;
+  }
+  const uint8_t id = XML_TAG_SLOTS[xmlTagHash(name, length)];
+  if (id == 0) {
+    return XmlTag::Unknown;
+  }
+  const char* candidate = XML_TAG_NAMES[id];
+  if (strlen(candidate) != length || memcmp(candidate, name, length) != 0) {
+    return XmlTag::Unknown;
+  }
+  return (XmlTag)id;
+}
+
+const char* xmlTagName(XmlTag tag) {
+  if ((uint8_t)tag >= (uint8_t)XmlTag::Count) {
+    return "";
+  }
+  return XML_TAG_NAMES[(uint8_t)tag];
+}
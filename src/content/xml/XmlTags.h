@@ -0,0 +1,58 @@
+#ifndef XML_TAGS_H
+#define XML_TAGS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Interned XHTML tag names
+ *
+ * SimpleXmlParser resolves each element name to one of these IDs when it
+ * reads the tag, so callers can switch on an integer instead of comparing
+ * strings. Names are matched case-sensitively; anything else is Unknown.
+ * There are at most 31 tags so a set of them fits in a uint32_t (see
+ * xmlTagBit).
+ */
+enum class XmlTag : uint8_t {
+  Unknown = 0,
+  P,
+  Div,
+  H1,
+  H2,
+  H3,
+  H4,
+  H5,
+  H6,
+  Blockquote,
+  Li,
+  Section,
+  Article,
+  Header,
+  Footer,
+  Nav,
+  Head,
+  Title,
+  Style,
+  Script,
+  B,
+  Strong,
+  I,
+  Em,
+  Span,
+  Br,
+  Hr,
+  Count
+};
+
+// Perfect-hash lookup of an element name (not NUL-terminated)
+XmlTag lookupXmlTag(const char* name, size_t length);
+
+// Tag name for an ID ("" for Unknown)
+const char* xmlTagName(XmlTag tag);
+
+// Bit for a tag in a uint32_t tag set (Unknown has no bit)
+inline constexpr uint32_t xmlTagBit(XmlTag tag) {
+  return tag == XmlTag::Unknown ? 0u : (1u << (uint8_t)tag);
+}
+
+#endif
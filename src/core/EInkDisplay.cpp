@@ -1,5 +1,6 @@
 #include "EInkDisplay.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -132,10 +133,14 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
   // bb_epaper uses the global SPI object; SD can reconfigure it.
   // Force a known-good transaction state when talking to the panel.
   bbepSpiSettings = SPISettings(12000000, MSBFIRST, SPI_MODE0);
+  // Windowed RAM writes go through sendCommand/sendData at the same speed
+  spiSettings = bbepSpiSettings;
 #endif
+  clearDirty();
 }
 
 EInkDisplay::~EInkDisplay() {
+  releaseGrayscalePlanes();
 #ifdef ARDUINO
   if (bbep) {
     delete bbep;
@@ -182,6 +187,10 @@ void EInkDisplay::begin() {
   int rcRefresh = bbep->refresh(REFRESH_FULL, true);
   bbepEndTransaction();
   Serial.printf("[%lu]   bb_epaper: writePlane rc=%d, refresh rc=%d\n", millis(), rcPlane, rcRefresh);
+  // Both buffers are white and so is the panel now
+  activeFrameValid = (rcPlane == BBEP_SUCCESS && rcRefresh == BBEP_SUCCESS);
+  ramSynced = activeFrameValid;
+  partialRefreshCount = 0;
   Serial.printf("[%lu]   bb_epaper display driver initialized\n", millis());
 #endif
 }
@@ -347,6 +356,7 @@ void EInkDisplay::setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
 
 void EInkDisplay::clearScreen(uint8_t color) {
   memset(frameBuffer, color, BUFFER_SIZE);
+  markAllDirty();
 }
 
 void EInkDisplay::drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
@@ -356,6 +366,8 @@ void EInkDisplay::drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, ui
     return;
   }
 
+  markDirty(x, y, w, h);
+
   // Calculate bytes per line for the image
   uint16_t imageWidthBytes = w / 8;
 
@@ -397,6 +409,7 @@ void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_
 
 void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) {
   memcpy(frameBuffer, bwBuffer, BUFFER_SIZE);
+  markAllDirty();
 }
 
 void EInkDisplay::swapBuffers() {
@@ -417,6 +430,7 @@ void EInkDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) {
     return;
   }
 #endif
+  ramSynced = false;
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
 }
@@ -428,6 +442,7 @@ void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
     return;
   }
 #endif
+  ramSynced = false;
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
 }
@@ -440,17 +455,165 @@ void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t*
     return;
   }
 #endif
+  ramSynced = false;
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
 }
 
+bool EInkDisplay::prepareGrayscalePlanes() {
+  if (!grayLsbPlane) {
+    grayLsbPlane = (uint8_t*)malloc(BUFFER_SIZE);
+  }
+  if (!grayMsbPlane) {
+    grayMsbPlane = (uint8_t*)malloc(BUFFER_SIZE);
+  }
+  if (!grayLsbPlane || !grayMsbPlane) {
+    Serial.printf("[%lu]   Failed to allocate grayscale planes (2 x %lu bytes)\n", millis(), BUFFER_SIZE);
+    releaseGrayscalePlanes();
+    return false;
+  }
+  memset(grayLsbPlane, 0xFF, BUFFER_SIZE);
+  memset(grayMsbPlane, 0xFF, BUFFER_SIZE);
+  return true;
+}
+
+void EInkDisplay::releaseGrayscalePlanes() {
+  free(grayLsbPlane);
+  free(grayMsbPlane);
+  grayLsbPlane = nullptr;
+  grayMsbPlane = nullptr;
+}
+
+void EInkDisplay::copyGrayscalePlanes() {
+  if (!grayLsbPlane || !grayMsbPlane) {
+    return;
+  }
+  copyGrayscaleBuffers(grayLsbPlane, grayMsbPlane);
+}
+
+void EInkDisplay::setPartialRefreshBudget(uint16_t updates) {
+  partialRefreshBudget = updates;
+}
+
+EInkDisplay::RefreshMode EInkDisplay::resolveRefreshMode(RefreshMode mode) const {
+  if (mode != PARTIAL_REFRESH) {
+    return mode;
+  }
+  if (partialRefreshBudget > 0 && partialRefreshCount >= partialRefreshBudget) {
+    // Ghosting budget used up; clean the panel with a full waveform
+    return FULL_REFRESH;
+  }
+  if (!activeFrameValid) {
+    // The panel doesn't show frameBufferActive, so a diff against it would be wrong
+    return FAST_REFRESH;
+  }
+  return mode;
+}
+
+bool EInkDisplay::computeUpdateWindow(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h) const {
+  if (!frameBuffer || !frameBufferActive) {
+    return false;
+  }
+
+  // The back buffer can only differ from the displayed frame where it was
+  // touched since the last update or where the last update changed the panel
+  int x0 = dirtyX0 < lastWindowX0 ? dirtyX0 : lastWindowX0;
+  int y0 = dirtyY0 < lastWindowY0 ? dirtyY0 : lastWindowY0;
+  int x1 = dirtyX1 > lastWindowX1 ? dirtyX1 : lastWindowX1;
+  int y1 = dirtyY1 > lastWindowY1 ? dirtyY1 : lastWindowY1;
+  x0 = x0 < 0 ? 0 : x0;
+  y0 = y0 < 0 ? 0 : y0;
+  x1 = x1 > DISPLAY_WIDTH ? DISPLAY_WIDTH : x1;
+  y1 = y1 > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y1;
+  if (x0 >= x1 || y0 >= y1) {
+    return false;
+  }
+
+  // Narrow to the rows and byte columns that actually differ
+  const int bx0 = x0 / 8;
+  const int bx1 = (x1 + 7) / 8;
+  int minRow = DISPLAY_HEIGHT, maxRow = -1;
+  int minCol = DISPLAY_WIDTH_BYTES, maxCol = -1;
+  for (int row = y0; row < y1; ++row) {
+    const uint8_t* a = frameBuffer + row * DISPLAY_WIDTH_BYTES;
+    const uint8_t* b = frameBufferActive + row * DISPLAY_WIDTH_BYTES;
+    if (memcmp(a + bx0, b + bx0, bx1 - bx0) == 0) {
+      continue;
+    }
+    if (row < minRow) {
+      minRow = row;
+    }
+    maxRow = row;
+    int c = bx0;
+    while (c < minCol && a[c] == b[c]) {
+      ++c;
+    }
+    if (c < minCol) {
+      minCol = c;
+    }
+    c = bx1 - 1;
+    while (c > maxCol && a[c] == b[c]) {
+      --c;
+    }
+    if (c > maxCol) {
+      maxCol = c;
+    }
+  }
+  if (maxRow < 0) {
+    return false;
+  }
+
+  x = (uint16_t)(minCol * 8);
+  y = (uint16_t)minRow;
+  w = (uint16_t)((maxCol - minCol + 1) * 8);
+  h = (uint16_t)(maxRow - minRow + 1);
+  return true;
+}
+
+void EInkDisplay::markAllDirty() {
+  dirtyX0 = 0;
+  dirtyY0 = 0;
+  dirtyX1 = DISPLAY_WIDTH;
+  dirtyY1 = DISPLAY_HEIGHT;
+}
+
+void EInkDisplay::clearDirty() {
+  dirtyX0 = DISPLAY_WIDTH;
+  dirtyY0 = DISPLAY_HEIGHT;
+  dirtyX1 = 0;
+  dirtyY1 = 0;
+}
+
+void EInkDisplay::writeRamWindow(uint8_t ramBuffer, const uint8_t* data, uint16_t x, uint16_t y, uint16_t w,
+                                 uint16_t h) {
+  // x and w are byte aligned; rows go out top to bottom (see setRamArea)
+  setRamArea(x, y, w, h);
+  sendCommand(ramBuffer);
+  const uint16_t rowBytes = w / 8;
+  for (uint16_t row = 0; row < h; ++row) {
+    sendData(data + (uint32_t)(y + row) * DISPLAY_WIDTH_BYTES + x / 8, rowBytes);
+  }
+}
+
 void EInkDisplay::displayBuffer(RefreshMode mode) {
+  mode = resolveRefreshMode(mode);
+
+  uint16_t wx = 0, wy = 0, ww = DISPLAY_WIDTH, wh = DISPLAY_HEIGHT;
+  const bool changed = computeUpdateWindow(wx, wy, ww, wh);
 #ifdef ARDUINO
   if (!bbep) {
     return;
   }
 
+  if (!changed && mode == PARTIAL_REFRESH) {
+    // Nothing differs from what the panel shows
+    lastWindowX0 = lastWindowX1 = 0;
+    lastWindowY0 = lastWindowY1 = 0;
+    clearDirty();
+    return;
+  }
+
   if (!isScreenOn) {
     bbepBeginTransaction();
     bbep->wake();
@@ -458,26 +621,88 @@ void EInkDisplay::displayBuffer(RefreshMode mode) {
     isScreenOn = true;
   }
 
-  bbep->setBuffer(frameBuffer);
-  bbepBeginTransaction();
-  int rcPlane = bbep->writePlane(PLANE_DUPLICATE);
-  bbepEndTransaction();
-  if (rcPlane != BBEP_SUCCESS) {
-    Serial.printf("[%lu]   bb_epaper: writePlane failed rc=%d\n", millis(), rcPlane);
+  if (mode == PARTIAL_REFRESH && !bbep->hasPartialRefresh()) {
+    mode = FAST_REFRESH;
+  }
+
+  // Small changes are written as a RAM window; this needs both controller
+  // planes to already hold the displayed frame outside of it
+  const uint32_t windowBytes = (uint32_t)(ww / 8) * wh;
+  const bool windowed =
+      changed && ramSynced && mode != FULL_REFRESH && windowBytes <= BUFFER_SIZE / kWindowedWriteMaxFraction;
+
+  int rcPlane = BBEP_SUCCESS;
+  if (windowed) {
+    Serial.printf("[%lu]   Windowed update x=%u y=%u w=%u h=%u (%lu bytes)\n", millis(), wx, wy, ww, wh,
+                  windowBytes);
+    // Partial: plane 1 already holds the displayed frame, only the new frame is written
+    writeRamWindow(CMD_WRITE_RAM_BW, frameBuffer, wx, wy, ww, wh);
+    if (mode != PARTIAL_REFRESH) {
+      writeRamWindow(CMD_WRITE_RAM_RED, frameBuffer, wx, wy, ww, wh);
+    }
+  } else {
+    bbepBeginTransaction();
+    if (mode == PARTIAL_REFRESH) {
+      // Previous frame into the "old" plane and the new frame into the "new"
+      // plane, so the controller only drives the pixels that changed.
+      if (!ramSynced) {
+        bbep->setBuffer(frameBufferActive);
+        rcPlane = bbep->writePlane(PLANE_1);
+      }
+      bbep->setBuffer(frameBuffer);
+      if (rcPlane == BBEP_SUCCESS) {
+        rcPlane = bbep->writePlane(PLANE_0);
+      }
+    } else {
+      bbep->setBuffer(frameBuffer);
+      rcPlane = bbep->writePlane(PLANE_DUPLICATE);
+    }
+    bbepEndTransaction();
+    if (rcPlane != BBEP_SUCCESS) {
+      Serial.printf("[%lu]   bb_epaper: writePlane failed rc=%d\n", millis(), rcPlane);
+    }
   }
   refreshDisplay(mode, false);
 
+  if (mode == PARTIAL_REFRESH) {
+    // Bring the "old" plane up to date so the next update can be windowed
+    if (windowed) {
+      writeRamWindow(CMD_WRITE_RAM_RED, frameBuffer, wx, wy, ww, wh);
+    } else {
+      bbepBeginTransaction();
+      rcPlane = bbep->writePlane(PLANE_1);
+      bbepEndTransaction();
+    }
+  }
+  ramSynced = (rcPlane == BBEP_SUCCESS);
+
+  // Remember what changed on the panel; the next back buffer may still differ there
+  if (changed) {
+    lastWindowX0 = wx;
+    lastWindowY0 = wy;
+    lastWindowX1 = wx + ww;
+    lastWindowY1 = wy + wh;
+  } else {
+    lastWindowX0 = lastWindowX1 = 0;
+    lastWindowY0 = lastWindowY1 = 0;
+  }
+  clearDirty();
+
   // Keep the existing double-buffer behavior so the next render happens into
-  // a fresh buffer.
+  // a fresh buffer. frameBufferActive now holds what the panel shows.
   swapBuffers();
+  activeFrameValid = true;
 #else
   (void)mode;
+  (void)changed;
 #endif
 }
 
 void EInkDisplay::displayGrayBuffer(bool turnOffScreen) {
   // bb_epaper integration is BW-only for now.
   (void)turnOffScreen;
+  // Once a grayscale overlay is shown the panel no longer matches the BW frame
+  activeFrameValid = false;
 }
 
 void EInkDisplay::refreshDisplay(RefreshMode mode, bool turnOffScreen) {
@@ -489,14 +714,11 @@ void EInkDisplay::refreshDisplay(RefreshMode mode, bool turnOffScreen) {
   int refreshMode = REFRESH_FULL;
   if (mode == FULL_REFRESH) {
     refreshMode = REFRESH_FULL;
-  } else if (mode == HALF_REFRESH) {
-    refreshMode = bbep->hasFastRefresh() ? REFRESH_FAST : REFRESH_FULL;
+  } else if (mode == PARTIAL_REFRESH) {
+    // Only valid after displayBuffer() wrote distinct old/new planes; with
+    // PLANE_DUPLICATE the diff is empty and nothing would change on screen.
+    refreshMode = REFRESH_PARTIAL;
   } else {
-    // We currently write the same image to both controller planes (PLANE_DUPLICATE).
-    // Partial refresh relies on plane differences; duplicating makes the diff empty
-    // and can result in *no visible update* on some controllers.
-    // Use FAST refresh as a reliable baseline until we implement true old/new plane
-    // tracking for partial updates.
     refreshMode = bbep->hasFastRefresh() ? REFRESH_FAST : REFRESH_FULL;
   }
 
@@ -506,12 +728,19 @@ void EInkDisplay::refreshDisplay(RefreshMode mode, bool turnOffScreen) {
   if (rc != BBEP_SUCCESS) {
     Serial.printf("[%lu]   bb_epaper: refresh failed mode=%d rc=%d\n", millis(), refreshMode, rc);
   }
+  if (mode == FULL_REFRESH) {
+    partialRefreshCount = 0;
+  } else if (mode == PARTIAL_REFRESH) {
+    partialRefreshCount++;
+  }
 
   if (turnOffScreen) {
     bbepBeginTransaction();
     bbep->sleep(DEEP_SLEEP);
     bbepEndTransaction();
     isScreenOn = false;
+    // Controller RAM is not retained in deep sleep
+    ramSynced = false;
   }
 #else
   (void)mode;
@@ -533,6 +762,7 @@ void EInkDisplay::deepSleep() {
     bbep->sleep(DEEP_SLEEP);
     bbepEndTransaction();
     isScreenOn = false;
+    ramSynced = false;
   }
 #endif
 }
@@ -20,9 +20,10 @@ class EInkDisplay {
 
   // Refresh modes (guarded to avoid redefinition in test builds)
   enum RefreshMode {
-    FULL_REFRESH,  // Full refresh with complete waveform
-    HALF_REFRESH,  // Half refresh (1720ms) - balanced quality and speed
-    FAST_REFRESH   // Fast refresh using custom LUT
+    FULL_REFRESH,    // Full refresh with complete waveform
+    HALF_REFRESH,    // Half refresh (1720ms) - balanced quality and speed
+    FAST_REFRESH,    // Fast refresh using custom LUT
+    PARTIAL_REFRESH  // Differential refresh against the previously displayed frame
   };
 
   // Initialize the display hardware and driver
@@ -45,11 +46,35 @@ class EInkDisplay {
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
 
+  // Grayscale LSB/MSB planes for single-pass rendering (see
+  // TextRenderer::setGrayscalePlanes). Allocated on first use and cleared to
+  // white; returns false if they could not be allocated.
+  bool prepareGrayscalePlanes();
+  void releaseGrayscalePlanes();
+  uint8_t* getGrayscaleLsbPlane() {
+    return grayLsbPlane;
+  }
+  uint8_t* getGrayscaleMsbPlane() {
+    return grayMsbPlane;
+  }
+  // Write both prepared planes to the controller RAM
+  void copyGrayscalePlanes();
+
   void displayBuffer(RefreshMode mode = FAST_REFRESH);
   void displayGrayBuffer(bool turnOffScreen = false);
 
   void refreshDisplay(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
 
+  // Ghosting budget: after this many PARTIAL_REFRESH updates the next one is
+  // promoted to a FULL_REFRESH (0 = never promote).
+  void setPartialRefreshBudget(uint16_t updates);
+  uint16_t getPartialRefreshBudget() const {
+    return partialRefreshBudget;
+  }
+  // The mode displayBuffer() will use for `mode`, taking the ghosting budget
+  // and the state of the previous frame into account.
+  RefreshMode resolveRefreshMode(RefreshMode mode) const;
+
   bool supportsGrayscale() const;
 
   // debug function
@@ -66,6 +91,30 @@ class EInkDisplay {
     return frameBuffer;
   }
 
+  // Dirty-region tracking in panel coordinates. Code writing the back buffer
+  // marks what it touched (clearScreen/drawImage/setFramebuffer do so
+  // themselves); displayBuffer() narrows that to what differs from the
+  // displayed frame and writes only that window to the controller.
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (x < dirtyX0) {
+      dirtyX0 = x;
+    }
+    if (y < dirtyY0) {
+      dirtyY0 = y;
+    }
+    if (x + w > dirtyX1) {
+      dirtyX1 = x + w;
+    }
+    if (y + h > dirtyY1) {
+      dirtyY1 = y + h;
+    }
+  }
+  void markAllDirty();
+
+  // Byte-aligned window (x and w multiples of 8) of the back buffer that
+  // differs from the displayed frame. Returns false if nothing changed.
+  bool computeUpdateWindow(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h) const;
+
   BBEPAPER* getBBEPAPER() {
     return bbep;
   }
@@ -84,6 +133,10 @@ class EInkDisplay {
   uint8_t* frameBuffer;
   uint8_t* frameBufferActive;
 
+  // Grayscale planes (heap allocated, only while grayscale rendering is used)
+  uint8_t* grayLsbPlane = nullptr;
+  uint8_t* grayMsbPlane = nullptr;
+
   // SPI settings
   SPISettings spiSettings;
 
@@ -97,6 +150,21 @@ class EInkDisplay {
   bool inGrayscaleMode;
   bool drawGrayscale;
 
+  // Partial refresh state: frameBufferActive matches the panel, and the number
+  // of partial updates since the last full refresh
+  bool activeFrameValid = false;
+  uint16_t partialRefreshBudget = 8;
+  uint16_t partialRefreshCount = 0;
+
+  // Area of the back buffer touched since the last update (empty when x0 >= x1)
+  int16_t dirtyX0, dirtyY0, dirtyX1, dirtyY1;
+  // Window changed by the last update
+  int16_t lastWindowX0 = 0, lastWindowY0 = 0, lastWindowX1 = DISPLAY_WIDTH, lastWindowY1 = DISPLAY_HEIGHT;
+  // Both controller RAM planes hold the displayed frame, so writes can be windowed
+  bool ramSynced = false;
+  // Windows larger than 1/N of the panel are written with a full plane write
+  static constexpr uint32_t kWindowedWriteMaxFraction = 2;
+
   // Low-level display control
   void resetDisplay();
   void sendCommand(uint8_t command);
@@ -108,6 +176,8 @@ class EInkDisplay {
   // Low-level display operations
   void setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size);
+  void writeRamWindow(uint8_t ramBuffer, const uint8_t* data, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void clearDirty();
 
   void bbepBeginTransaction();
   void bbepEndTransaction();
@@ -13,6 +13,16 @@ void* arduino_file_open(const char* path) {
   return f;
 }
 
+void* arduino_file_open_write(const char* path) {
+  File* f = new File();
+  *f = SD.open(path, FILE_WRITE);
+  if (!*f) {
+    delete f;
+    return nullptr;
+  }
+  return f;
+}
+
 extern "C" {
 int arduino_get_free_heap(void) {
   return (int)ESP.getFreeHeap();
@@ -64,4 +74,12 @@ size_t arduino_file_read(void* ptr, size_t size, size_t count, void* handle) {
   return bytes_read / size;  // Return number of elements read
 }
 
+size_t arduino_file_write(const void* ptr, size_t size, size_t count, void* handle) {
+  if (!handle || !ptr)
+    return 0;
+  File* f = static_cast<File*>(handle);
+  size_t bytes_written = f->write(static_cast<const uint8_t*>(ptr), size * count);
+  return bytes_written / size;  // Return number of elements written
+}
+
 }  // extern "C"
@@ -1,12 +1,36 @@
 #include "SimpleFont.h"
 
-// Helper to find a glyph index by codepoint using binary search
+// Helper to find a glyph index by codepoint
 // The glyph array must be sorted by codepoint
 int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint) {
   if (!font || !font->glyph || font->glyphCount == 0) {
     return -1;
   }
 
+  // ASCII / Latin-1: direct table lookup
+  if (codepoint < 256 && font->latin1Index) {
+    uint16_t idx = font->latin1Index[codepoint];
+    return (idx == SIMPLE_GFX_NO_GLYPH) ? -1 : idx;
+  }
+
+  // Dense Unicode blocks: search the (short) range table
+  if (font->ranges && font->rangeCount > 0) {
+    int low = 0;
+    int high = font->rangeCount - 1;
+    while (low <= high) {
+      int mid = low + (high - low) / 2;
+      const SimpleGFXrange& r = font->ranges[mid];
+      if (codepoint < r.first) {
+        high = mid - 1;
+      } else if (codepoint >= r.first + r.count) {
+        low = mid + 1;
+      } else {
+        return r.glyphIndex + (int)(codepoint - r.first);
+      }
+    }
+  }
+
+  // Sparse codepoints: binary search over all glyphs
   int low = 0;
   int high = font->glyphCount - 1;
 
@@ -16,6 +16,16 @@ typedef struct {
   int8_t yOffset;    ///< Y dist from cursor pos to UL corner
 } SimpleGFXglyph;
 
+// Run of consecutive codepoints mapping to consecutive glyph indices
+typedef struct {
+  uint32_t first;       ///< First codepoint of the run
+  uint16_t count;       ///< Number of codepoints in the run
+  uint16_t glyphIndex;  ///< Glyph index of `first`
+} SimpleGFXrange;
+
+// Marker for codepoints without a glyph in `latin1Index`
+static constexpr uint16_t SIMPLE_GFX_NO_GLYPH = 0xFFFF;
+
 typedef struct {
   const uint8_t* bitmap;           ///< Glyph bitmaps, concatenated
   const uint8_t* bitmap_gray_lsb;  ///< Glyph bitmaps, concatenated
@@ -27,6 +37,16 @@ typedef struct {
   const char* name;  ///< Font name (e.g., "NotoSans")
   uint8_t size;      ///< Font size in points (for reference)
   FontStyle style;   ///< Style of this font variant
+  // Optional lookup tables emitted by the font generator (nullptr if absent)
+  const uint16_t* latin1Index;   ///< Glyph index for U+0000..U+00FF (SIMPLE_GFX_NO_GLYPH if missing)
+  const SimpleGFXrange* ranges;  ///< Runs of consecutive codepoints above U+00FF (sorted)
+  uint16_t rangeCount;           ///< Number of entries in `ranges`
+  // Optional column-major (pre-rotated) copies of the bitmaps for portrait
+  // rendering: each glyph column is ceil(height / 8) bytes, MSB = top row
+  const uint8_t* bitmapColumns;     ///< Column-major BW bitmaps (nullptr if not generated)
+  const uint8_t* bitmapColumnsLsb;  ///< Column-major grayscale LSB plane
+  const uint8_t* bitmapColumnsMsb;  ///< Column-major grayscale MSB plane
+  const uint32_t* columnOffsets;    ///< Per-glyph offset into the column-major bitmaps
 } SimpleGFXfont;
 
 // New: Font family struct to group style variants
@@ -38,7 +58,8 @@ typedef struct {
   const SimpleGFXfont* boldItalic;  ///< Bold-italic variant (optional)
 } FontFamily;
 
-// Helper to find a glyph index by codepoint using binary search
+// Helper to find a glyph index by codepoint. Uses the font's direct lookup
+// tables when present and falls back to binary search.
 // Returns -1 if the glyph is not found
 int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint);
 
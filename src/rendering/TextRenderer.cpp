@@ -113,6 +113,10 @@ void TextRenderer::drawPixel(int16_t x, int16_t y, bool state) {
     return;
   }
 
+  if (frameBuffer == display.getFrameBuffer()) {
+    display.markDirty(rotatedX, rotatedY, 1, 1);
+  }
+
   // Calculate byte position and bit position
   uint16_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
   uint8_t bitPosition = 7 - (rotatedX % 8);  // MSB first
@@ -204,22 +208,7 @@ void TextRenderer::getTextBounds(const char* str, int16_t x, int16_t y, int16_t*
 
   if (currentFont) {
     const SimpleGFXfont* f = currentFont;
-    uint16_t totalWidth = 0;
-    const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
-
-    while (*p) {
-      uint32_t codepoint = decodeUtf8Codepoint(p);
-      int glyphIndex = findGlyphIndex(f, codepoint);
-
-      if (glyphIndex >= 0) {
-        const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
-        totalWidth += glyph->xAdvance + GLYPH_PADDING;
-      } else {
-        totalWidth += FALLBACK_GLYPH_WIDTH;
-      }
-    }
-
-    width = totalWidth;
+    width = measureWidth(f, str);
     height = (f->yAdvance > 0) ? f->yAdvance : 10;
   }
 
@@ -233,6 +222,369 @@ void TextRenderer::getTextBounds(const char* str, int16_t x, int16_t y, int16_t*
     *h = height;
 }
 
+const uint8_t* TextRenderer::getAdvanceTable(const SimpleGFXfont* f) {
+  for (int i = 0; i < kAdvanceTableSlots; ++i) {
+    if (advanceTables[i].font == f) {
+      return advanceTables[i].advance;
+    }
+  }
+
+  AdvanceTable& t = advanceTables[nextAdvanceTable];
+  nextAdvanceTable = (nextAdvanceTable + 1) % kAdvanceTableSlots;
+  t.font = f;
+  for (uint32_t cp = 0; cp < 256; ++cp) {
+    int glyphIndex = findGlyphIndex(f, cp);
+    t.advance[cp] = (glyphIndex >= 0) ? (uint8_t)(f->glyph[glyphIndex].xAdvance + GLYPH_PADDING)
+                                      : (uint8_t)FALLBACK_GLYPH_WIDTH;
+  }
+  return t.advance;
+}
+
+uint16_t TextRenderer::measureWidth(const SimpleGFXfont* f, const char* str) {
+  // Hash the token bytes and font pointer (FNV-1a) while finding its length
+  uint32_t hash = 2166136261u;
+  const uintptr_t fontBits = reinterpret_cast<uintptr_t>(f);
+  for (size_t i = 0; i < sizeof(fontBits); ++i) {
+    hash ^= (uint8_t)(fontBits >> (i * 8));
+    hash *= 16777619u;
+  }
+  size_t len = 0;
+  while (str[len] && len <= (size_t)kWidthCacheMaxBytes) {
+    hash ^= (uint8_t)str[len];
+    hash *= 16777619u;
+    ++len;
+  }
+
+  WidthCacheEntry* entry = nullptr;
+  if (len <= (size_t)kWidthCacheMaxBytes) {
+    entry = &widthCache[hash & (kWidthCacheSize - 1)];
+    if (entry->font == f && entry->len == len && memcmp(entry->bytes, str, len) == 0) {
+      widthCacheHits++;
+      return entry->width;
+    }
+  }
+  widthCacheMisses++;
+
+  const uint8_t* advance = getAdvanceTable(f);
+  uint16_t totalWidth = 0;
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
+  while (*p) {
+    if (*p < 0x80) {
+      totalWidth += advance[*p++];
+      continue;
+    }
+    uint32_t codepoint = decodeUtf8Codepoint(p);
+    if (codepoint < 256) {
+      totalWidth += advance[codepoint];
+      continue;
+    }
+    int glyphIndex = findGlyphIndex(f, codepoint);
+    if (glyphIndex >= 0) {
+      totalWidth += f->glyph[glyphIndex].xAdvance + GLYPH_PADDING;
+    } else {
+      totalWidth += FALLBACK_GLYPH_WIDTH;
+    }
+  }
+
+  if (entry) {
+    entry->font = f;
+    entry->width = totalWidth;
+    entry->len = (uint8_t)len;
+    memcpy(entry->bytes, str, len);
+  }
+  return totalWidth;
+}
+
+// ---- Byte-oriented glyph blitting ----
+//
+// A glyph is written as a series of runs, one per physical framebuffer row.
+// Each run is assembled MSB-first in physical pixel order into a small
+// source/mask byte buffer and then merged into the row a byte at a time:
+//   fb = (fb & ~mask) | (src & mask)
+// which matches what drawPixel() produces for every glyph pixel it touches.
+
+// Glyph dimensions are uint8_t, so a run never exceeds 255 pixels
+static constexpr int MAX_RUN_BYTES = 32;
+
+static inline uint8_t reverseBits_tr(uint8_t b) {
+  b = (uint8_t)(((b & 0xF0) >> 4) | ((b & 0x0F) << 4));
+  b = (uint8_t)(((b & 0xCC) >> 2) | ((b & 0x33) << 2));
+  b = (uint8_t)(((b & 0xAA) >> 1) | ((b & 0x55) << 1));
+  return b;
+}
+
+// Copy `n` bits of a glyph row starting at bit `start` into `out`, left-aligned
+static void extractRowBits_tr(const uint8_t* row, int start, int n, uint8_t* out) {
+  const int nbytes = (n + 7) / 8;
+  const int end = start + n;
+  for (int k = 0; k < nbytes; ++k) {
+    const int bitPos = start + k * 8;
+    const int b = bitPos >> 3;
+    const int sh = bitPos & 7;
+    uint8_t v = (uint8_t)(row[b] << sh);
+    if (sh && (b + 1) * 8 < end) {
+      v |= (uint8_t)(row[b + 1] >> (8 - sh));
+    }
+    out[k] = v;
+  }
+}
+
+// Reverse the order of the first `n` bits of a left-aligned run
+static void reverseRunBits_tr(uint8_t* buf, int n) {
+  const int nbytes = (n + 7) / 8;
+  uint8_t tmp[MAX_RUN_BYTES + 1];
+  for (int k = 0; k < nbytes; ++k) {
+    tmp[k] = reverseBits_tr(buf[nbytes - 1 - k]);
+  }
+  tmp[nbytes] = 0;
+  const int pad = nbytes * 8 - n;
+  for (int k = 0; k < nbytes; ++k) {
+    buf[k] = pad ? (uint8_t)((tmp[k] << pad) | (tmp[k + 1] >> (8 - pad))) : tmp[k];
+  }
+}
+
+// Gather `n` bits of glyph column `xx` starting at row `yStart`, stepping rows by `step`
+static void gatherColumnBits_tr(const uint8_t* plane, uint8_t rowStride, int xx, int yStart, int step, int n,
+                                uint8_t* out) {
+  const uint8_t* p = plane + (xx >> 3) + yStart * rowStride;
+  const uint8_t bitMask = (uint8_t)(0x80 >> (xx & 7));
+  const int rowStep = step * rowStride;
+  const int nbytes = (n + 7) / 8;
+  for (int k = 0; k < nbytes; ++k) {
+    uint8_t v = 0;
+    const int bits = (n - k * 8) < 8 ? (n - k * 8) : 8;
+    for (int i = 0; i < bits; ++i) {
+      v = (uint8_t)(v << 1);
+      if (*p & bitMask) {
+        v |= 1;
+      }
+      p += rowStep;
+    }
+    out[k] = (uint8_t)(v << (8 - bits));
+  }
+}
+
+// Mask of pixels the glyph writes: set (0) pixels in BW, any non-white level in grayscale
+static void buildRunMask_tr(const uint8_t* src, const uint8_t* lsb, const uint8_t* msb, int n, uint8_t* mask) {
+  const int nbytes = (n + 7) / 8;
+  for (int k = 0; k < nbytes; ++k) {
+    mask[k] = lsb ? (uint8_t)~(lsb[k] & msb[k]) : (uint8_t)~src[k];
+  }
+  if (n & 7) {
+    mask[nbytes - 1] &= (uint8_t)(0xFF << (8 - (n & 7)));
+  }
+}
+
+// Merge a run into a framebuffer row starting at physical column `x`
+static void applyRun_tr(uint8_t* row, int x, int n, const uint8_t* src, const uint8_t* mask) {
+  uint8_t* p = row + (x >> 3);
+  const int sh = x & 7;
+  const int nbytes = (n + 7) / 8;
+  for (int k = 0; k < nbytes; ++k) {
+    const uint8_t m = mask[k];
+    if (!m) {
+      continue;
+    }
+    const uint8_t v = src[k] & m;
+    p[k] = (uint8_t)((p[k] & ~(m >> sh)) | (v >> sh));
+    if (sh) {
+      const uint8_t m2 = (uint8_t)(m << (8 - sh));
+      if (m2) {
+        p[k + 1] = (uint8_t)((p[k + 1] & ~m2) | (uint8_t)(v << (8 - sh)));
+      }
+    }
+  }
+}
+
+void TextRenderer::drawGlyphPixels(const SimpleGFXglyph* glyph, const uint8_t* bitmap, const uint8_t* bitmap_lsb,
+                                   const uint8_t* bitmap_msb, bool isGrayscale) {
+  uint16_t bitmapOffset = glyph->bitmapOffset;
+  uint8_t w = glyph->width;
+  uint8_t h = glyph->height;
+  int8_t xOffset = glyph->xOffset;
+  int8_t yOffset = glyph->yOffset;
+
+  // Calculate row stride in bytes (width rounded up to byte boundary)
+  uint8_t rowStride = (w + 7) / 8;
+
+  // Render each pixel in the glyph
+  for (uint8_t yy = 0; yy < h; yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      int16_t px = cursorX + xOffset + xx;
+      int16_t py = cursorY + yOffset + yy;
+
+      // Calculate bitmap byte and bit positions for current pixel
+      uint16_t byteIndex = bitmapOffset + (yy * rowStride) + (xx / 8);
+      uint8_t bitMask = 1 << (7 - (xx % 8));
+
+      if (isGrayscale) {
+        // skip writing over black/white pixels
+        if ((bitmap_lsb[byteIndex] & bitMask) == 0 || (bitmap_msb[byteIndex] & bitMask) == 0) {
+          drawPixel(px, py, (bitmap[byteIndex] & bitMask) == 0);
+        }
+      } else {
+        // Check if pixel is set (0 = pixel on in our bitmap format)
+        if ((bitmap[byteIndex] & bitMask) == 0) {
+          drawPixel(px, py, true);
+        }
+      }
+    }
+  }
+}
+
+void TextRenderer::blitGlyph(const SimpleGFXfont* f, int glyphIndex, uint8_t* bwTarget, uint8_t* lsbTarget,
+                             uint8_t* msbTarget) {
+  const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
+  const bool needBw = bwTarget && f->bitmap;
+  const bool needGray = (lsbTarget || msbTarget) && f->bitmap_gray_lsb && f->bitmap_gray_msb;
+  if (!needBw && !needGray) {
+    return;
+  }
+
+  int16_t logicalW = EInkDisplay::DISPLAY_HEIGHT;  // 480
+  int16_t logicalH = EInkDisplay::DISPLAY_WIDTH;   // 800
+  if (orientation == LandscapeClockwise || orientation == LandscapeCounterClockwise) {
+    logicalW = EInkDisplay::DISPLAY_WIDTH;   // 800
+    logicalH = EInkDisplay::DISPLAY_HEIGHT;  // 480
+  }
+
+  const int w = glyph->width;
+  const int h = glyph->height;
+  const int x0 = cursorX + glyph->xOffset;
+  const int y0 = cursorY + glyph->yOffset;
+
+  // Clip the glyph once against the logical page
+  const int cx0 = x0 < 0 ? -x0 : 0;
+  const int cx1 = (x0 + w > logicalW) ? logicalW - x0 : w;
+  const int cy0 = y0 < 0 ? -y0 : 0;
+  const int cy1 = (y0 + h > logicalH) ? logicalH - y0 : h;
+  if (cx0 >= cx1 || cy0 >= cy1) {
+    return;
+  }
+
+  const uint8_t rowStride = (uint8_t)((w + 7) / 8);
+  const uint8_t* bw = needBw ? f->bitmap + glyph->bitmapOffset : nullptr;
+  const uint8_t* lsb = needGray ? f->bitmap_gray_lsb + glyph->bitmapOffset : nullptr;
+  const uint8_t* msb = needGray ? f->bitmap_gray_msb + glyph->bitmapOffset : nullptr;
+  const int rowBytes = EInkDisplay::DISPLAY_WIDTH_BYTES;
+
+  uint8_t runBw[MAX_RUN_BYTES];
+  uint8_t runLsb[MAX_RUN_BYTES];
+  uint8_t runMsb[MAX_RUN_BYTES];
+  uint8_t runMask[MAX_RUN_BYTES];
+
+  // Merge the extracted runs into every requested target row. The BW plane
+  // writes the glyph's set pixels; the grayscale planes write their own bit
+  // wherever the pixel is not white in both planes.
+  const bool trackDirty = bw && bwTarget == display.getFrameBuffer();
+  auto applyRuns = [&](int physY, int physX, int n) {
+    const int rowOffset = physY * rowBytes;
+    if (bw) {
+      buildRunMask_tr(runBw, nullptr, nullptr, n, runMask);
+      applyRun_tr(bwTarget + rowOffset, physX, n, runBw, runMask);
+      if (trackDirty) {
+        display.markDirty((int16_t)physX, (int16_t)physY, (int16_t)n, 1);
+      }
+    }
+    if (lsb) {
+      buildRunMask_tr(nullptr, runLsb, runMsb, n, runMask);
+      if (lsbTarget) {
+        applyRun_tr(lsbTarget + rowOffset, physX, n, runLsb, runMask);
+      }
+      if (msbTarget) {
+        applyRun_tr(msbTarget + rowOffset, physX, n, runMsb, runMask);
+      }
+    }
+  };
+
+  switch (orientation) {
+    case LandscapeCounterClockwise:
+    case LandscapeClockwise: {
+      // Glyph rows map to panel rows (reversed in the clockwise case)
+      const bool reversed = (orientation == LandscapeClockwise);
+      const int n = cx1 - cx0;
+      for (int yy = cy0; yy < cy1; ++yy) {
+        const int rowOff = yy * rowStride;
+        if (bw) {
+          extractRowBits_tr(bw + rowOff, cx0, n, runBw);
+        }
+        if (lsb) {
+          extractRowBits_tr(lsb + rowOff, cx0, n, runLsb);
+          extractRowBits_tr(msb + rowOff, cx0, n, runMsb);
+        }
+        if (reversed) {
+          if (bw) {
+            reverseRunBits_tr(runBw, n);
+          }
+          if (lsb) {
+            reverseRunBits_tr(runLsb, n);
+            reverseRunBits_tr(runMsb, n);
+          }
+        }
+
+        int physY, physX;
+        if (reversed) {
+          physY = EInkDisplay::DISPLAY_HEIGHT - 1 - (y0 + yy);
+          physX = EInkDisplay::DISPLAY_WIDTH - 1 - (x0 + cx1 - 1);
+        } else {
+          physY = y0 + yy;
+          physX = x0 + cx0;
+        }
+        applyRuns(physY, physX, n);
+      }
+      break;
+    }
+    case Portrait:
+    case PortraitInverted: {
+      // Glyph columns map to panel rows (bottom-up in the inverted case)
+      const bool inverted = (orientation == PortraitInverted);
+      const int n = cy1 - cy0;
+      const int yStart = inverted ? cy1 - 1 : cy0;
+      const int step = inverted ? -1 : 1;
+      // Pre-rotated bitmaps (see SimpleGFXfont) already hold each glyph column as contiguous bytes
+      const uint32_t colOffset = f->columnOffsets ? f->columnOffsets[glyphIndex] : 0;
+      const uint8_t* bwCol = (bw && f->columnOffsets && f->bitmapColumns) ? f->bitmapColumns + colOffset : nullptr;
+      const bool grayCols = lsb && f->columnOffsets && f->bitmapColumnsLsb && f->bitmapColumnsMsb;
+      const uint8_t* lsbCol = grayCols ? f->bitmapColumnsLsb + colOffset : nullptr;
+      const uint8_t* msbCol = grayCols ? f->bitmapColumnsMsb + colOffset : nullptr;
+      const int colStride = (h + 7) / 8;
+      for (int xx = cx0; xx < cx1; ++xx) {
+        const int colOff = xx * colStride;
+        if (bwCol) {
+          extractRowBits_tr(bwCol + colOff, cy0, n, runBw);
+          if (inverted) {
+            reverseRunBits_tr(runBw, n);
+          }
+        } else if (bw) {
+          gatherColumnBits_tr(bw, rowStride, xx, yStart, step, n, runBw);
+        }
+        if (lsbCol) {
+          extractRowBits_tr(lsbCol + colOff, cy0, n, runLsb);
+          extractRowBits_tr(msbCol + colOff, cy0, n, runMsb);
+          if (inverted) {
+            reverseRunBits_tr(runLsb, n);
+            reverseRunBits_tr(runMsb, n);
+          }
+        } else if (lsb) {
+          gatherColumnBits_tr(lsb, rowStride, xx, yStart, step, n, runLsb);
+          gatherColumnBits_tr(msb, rowStride, xx, yStart, step, n, runMsb);
+        }
+
+        int physY, physX;
+        if (inverted) {
+          physY = x0 + xx;
+          physX = EInkDisplay::DISPLAY_WIDTH - 1 - (y0 + cy1 - 1);
+        } else {
+          physY = EInkDisplay::DISPLAY_HEIGHT - 1 - (x0 + xx);
+          physX = y0 + cy0;
+        }
+        applyRuns(physY, physX, n);
+      }
+      break;
+    }
+  }
+}
+
 void TextRenderer::drawChar(uint32_t codepoint) {
   if (!currentFont) {
     return;
@@ -262,6 +614,27 @@ void TextRenderer::drawChar(uint32_t codepoint) {
 
   const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
 
+  if (grayLsbBuffer && grayMsbBuffer) {
+    // Three-plane mode: BW, LSB and MSB are written from one glyph lookup
+    if (fastBlit) {
+      blitGlyph(f, glyphIndex, frameBuffer, grayLsbBuffer, grayMsbBuffer);
+    } else {
+      uint8_t* bwBuffer = frameBuffer;
+      if (f->bitmap) {
+        drawGlyphPixels(glyph, f->bitmap, f->bitmap_gray_lsb, f->bitmap_gray_msb, false);
+      }
+      if (f->bitmap_gray_lsb && f->bitmap_gray_msb) {
+        frameBuffer = grayLsbBuffer;
+        drawGlyphPixels(glyph, f->bitmap_gray_lsb, f->bitmap_gray_lsb, f->bitmap_gray_msb, true);
+        frameBuffer = grayMsbBuffer;
+        drawGlyphPixels(glyph, f->bitmap_gray_msb, f->bitmap_gray_lsb, f->bitmap_gray_msb, true);
+      }
+      frameBuffer = bwBuffer;
+    }
+    cursorX += glyph->xAdvance + GLYPH_PADDING;
+    return;
+  }
+
   // Select the appropriate bitmap based on bitmapType
   const uint8_t* bitmap = nullptr;
   switch (bitmapType) {
@@ -282,42 +655,15 @@ void TextRenderer::drawChar(uint32_t codepoint) {
     return;
   }
 
-  uint16_t bitmapOffset = glyph->bitmapOffset;
-  uint8_t w = glyph->width;
-  uint8_t h = glyph->height;
-  int8_t xOffset = glyph->xOffset;
-  int8_t yOffset = glyph->yOffset;
-
-  // Calculate row stride in bytes (width rounded up to byte boundary)
-  uint8_t rowStride = (w + 7) / 8;
-
-  // Cache the grayscale bitmap pointers outside the loop for better performance
-  const uint8_t* bitmap_lsb = f->bitmap_gray_lsb;
-  const uint8_t* bitmap_msb = f->bitmap_gray_msb;
   bool isGrayscale = (bitmapType != BITMAP_BW);
-
-  // Render each pixel in the glyph
-  for (uint8_t yy = 0; yy < h; yy++) {
-    for (uint8_t xx = 0; xx < w; xx++) {
-      int16_t px = cursorX + xOffset + xx;
-      int16_t py = cursorY + yOffset + yy;
-
-      // Calculate bitmap byte and bit positions for current pixel
-      uint16_t byteIndex = bitmapOffset + (yy * rowStride) + (xx / 8);
-      uint8_t bitMask = 1 << (7 - (xx % 8));
-
-      if (isGrayscale) {
-        // skip writing over black/white pixels
-        if ((bitmap_lsb[byteIndex] & bitMask) == 0 || (bitmap_msb[byteIndex] & bitMask) == 0) {
-          drawPixel(px, py, (bitmap[byteIndex] & bitMask) == 0);
-        }
-      } else {
-        // Check if pixel is set (0 = pixel on in our bitmap format)
-        if ((bitmap[byteIndex] & bitMask) == 0) {
-          drawPixel(px, py, true);
-        }
-      }
+  if (fastBlit) {
+    if (frameBuffer) {
+      blitGlyph(f, glyphIndex, bitmapType == BITMAP_BW ? frameBuffer : nullptr,
+                bitmapType == BITMAP_GRAY_LSB ? frameBuffer : nullptr,
+                bitmapType == BITMAP_GRAY_MSB ? frameBuffer : nullptr);
     }
+  } else {
+    drawGlyphPixels(glyph, bitmap, f->bitmap_gray_lsb, f->bitmap_gray_msb, isGrayscale);
   }
 
   // Advance cursor by xAdvance
@@ -46,9 +46,26 @@ class TextRenderer {
   // Set which framebuffer to write to
   void setFrameBuffer(uint8_t* buffer);
 
+  // Glyphs are blitted a byte at a time per orientation by default. The
+  // per-pixel drawPixel path is kept as a reference implementation.
+  void setFastBlit(bool enabled) {
+    fastBlit = enabled;
+  }
+  bool getFastBlit() const {
+    return fastBlit;
+  }
+
   // Select which bitmap data to use from the font
   void setBitmapType(BitmapType type);
 
+  // Three-plane grayscale mode: while both buffers are set, text is written to
+  // the framebuffer (BW plane) and to the LSB/MSB planes in a single pass and
+  // the bitmap type is ignored. Pass nullptr to return to single-plane mode.
+  void setGrayscalePlanes(uint8_t* lsbBuffer, uint8_t* msbBuffer) {
+    grayLsbBuffer = lsbBuffer;
+    grayMsbBuffer = msbBuffer;
+  }
+
   // Minimal API used by the rest of the project
   void setFont(const SimpleGFXfont* f = nullptr);
   void setFontFamily(FontFamily* family);
@@ -58,9 +75,26 @@ class TextRenderer {
   size_t print(const char* s);
   size_t print(const String& s);
 
+  // Font text is measured and drawn with (the current style's variant of the family)
+  const SimpleGFXfont* getFont() const {
+    return currentFont;
+  }
+
   // Measure text bounds for layout
   void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
 
+  // Word width cache statistics (getTextBounds calls answered from the cache vs measured)
+  uint32_t getWidthCacheHits() const {
+    return widthCacheHits;
+  }
+  uint32_t getWidthCacheMisses() const {
+    return widthCacheMisses;
+  }
+  void resetWidthCacheStats() {
+    widthCacheHits = 0;
+    widthCacheMisses = 0;
+  }
+
   // Color constants (0 = black, 1 = white for 1-bit display)
   static const uint16_t COLOR_BLACK = 0;
   static const uint16_t COLOR_WHITE = 1;
@@ -71,15 +105,55 @@ class TextRenderer {
   FontFamily* currentFamily = nullptr;
   FontStyle currentStyle = FontStyle::REGULAR;
   uint8_t* frameBuffer = nullptr;
+  uint8_t* grayLsbBuffer = nullptr;
+  uint8_t* grayMsbBuffer = nullptr;
   BitmapType bitmapType = BITMAP_BW;
   Orientation orientation = Portrait;
   int16_t cursorX = 0;
   int16_t cursorY = 0;
   uint16_t textColor = COLOR_BLACK;
+  bool fastBlit = true;
+
+  // Width cache for measured tokens. Keyed by font variant pointer (which
+  // already identifies the style) and the token bytes; direct-mapped so a
+  // lookup is one hash and one compare. Longer tokens bypass the cache.
+  static constexpr int kWidthCacheSize = 256;
+  static constexpr int kWidthCacheMaxBytes = 23;
+  struct WidthCacheEntry {
+    const SimpleGFXfont* font;
+    uint16_t width;
+    uint8_t len;
+    char bytes[kWidthCacheMaxBytes];
+  };
+  WidthCacheEntry widthCache[kWidthCacheSize] = {};
+  uint32_t widthCacheHits = 0;
+  uint32_t widthCacheMisses = 0;
+
+  // Advance (including padding/fallback) for codepoints 0-255, built lazily
+  // for the few font variants in use at a time.
+  static constexpr int kAdvanceTableSlots = 4;
+  struct AdvanceTable {
+    const SimpleGFXfont* font;
+    uint8_t advance[256];
+  };
+  AdvanceTable advanceTables[kAdvanceTableSlots] = {};
+  int nextAdvanceTable = 0;
+
+  const uint8_t* getAdvanceTable(const SimpleGFXfont* f);
+  uint16_t measureWidth(const SimpleGFXfont* f, const char* str);
 
   // Draw a single Unicode codepoint. Accepts a full Unicode codepoint
   // (decoded from UTF-8) so the renderer can support multi-byte UTF-8 input.
   void drawChar(uint32_t codepoint);
+
+  // Glyph rasterization: reference per-pixel path and byte-oriented blitter.
+  // `bitmap` is the selected plane; lsb/msb are only read in grayscale mode.
+  void drawGlyphPixels(const SimpleGFXglyph* glyph, const uint8_t* bitmap, const uint8_t* bitmapLsb,
+                       const uint8_t* bitmapMsb, bool isGrayscale);
+  // Blits glyph `glyphIndex` of `f` into each non-null target plane in one pass,
+  // using the font's pre-rotated bitmaps in the portrait orientations when present.
+  void blitGlyph(const SimpleGFXfont* f, int glyphIndex, uint8_t* bwTarget, uint8_t* lsbTarget,
+                 uint8_t* msbTarget);
 };
 
 #endif
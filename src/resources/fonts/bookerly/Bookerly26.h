@@ -5112,5 +5112,4548 @@ const SimpleGFXglyph Bookerly26Glyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly26GlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly26GlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly26BitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF,
+    // 0x21 '!'
+    0x80, 0x07, 0xCF, 0x80, 0x01, 0x8F, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xCF,
+    // 0x22 '"'
+    0x80, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xC0, 0xFF,
+    0xF3, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0xCF, 0xFF, 0x03, 0xCF, 0xFF,
+    0xF3, 0xCC, 0xFF, 0xF3, 0xC0, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x4F, 0xFF,
+    0x03, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x3E, 0x0F, 0xFF, 0xF8, 0x0F, 0x07, 0xFF,
+    0xF8, 0x0F, 0xC7, 0xFF, 0xF3, 0xC7, 0xE7, 0xFF, 0xF3, 0xE0, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0xE3, 0xE7, 0xFF, 0xF3, 0xF1, 0xE7, 0xFF,
+    0xF1, 0xF0, 0x0F, 0xFF, 0xF8, 0x78, 0x0F, 0xFF, 0xFC, 0xFC, 0x3F, 0xFF,
+    // 0x25 '%'
+    0xFC, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x8F, 0x8F, 0xFF,
+    0x9F, 0xCF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0x8F, 0x8F, 0xC0, 0x1E, 0x1F,
+    0xC0, 0x3C, 0x7F, 0xF9, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xE0, 0x3F, 0xC7, 0x80, 0x1F,
+    0x0F, 0x9F, 0x9F, 0xBF, 0x3F, 0x9F, 0xFF, 0x3F, 0xDF, 0xFF, 0x1F, 0x9F,
+    0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF1, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x3F, 0xF1, 0x8F, 0x1F,
+    0xC0, 0x3F, 0x9F, 0x80, 0x1F, 0x9F, 0x1F, 0x07, 0x9F, 0x3F, 0xC3, 0x9F,
+    0x3E, 0xE1, 0x9F, 0x1C, 0xF0, 0x9F, 0x81, 0xF8, 0x9F, 0x83, 0x9C, 0x1F,
+    0xFF, 0x9E, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x9F, 0x1F,
+    0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0x80, 0xFF, 0x00, 0xFF, 0x01, 0xFF,
+    // 0x28 '('
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
+    0xE0, 0xFF, 0x81, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0x8F, 0xFF, 0xF8, 0x7F,
+    0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x8F, 0xFF, 0xFC, 0x7F,
+    0x87, 0xFF, 0xF8, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0xF0, 0x3E, 0x03, 0xFF,
+    0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0x99, 0xFF, 0x89, 0xFF, 0xC3, 0xFF, 0xC1, 0xFF, 0x00, 0x7F,
+    0x26, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x80, 0x0F,
+    0x80, 0x0F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFD, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFE, 0x7F, 0xB0, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0xCF, 0xFF,
+    // 0x2D '-'
+    0x3F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xBF,
+    // 0x2E '.'
+    0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xC1, 0xFC, 0x1F,
+    0xCF, 0xFF, 0x1F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x1F, 0xC3, 0xFC, 0x3F, 0xC0, 0x00, 0x3F,
+    0xE0, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F, 0xC7, 0xFF, 0x9F, 0xC7, 0xFF, 0x9F,
+    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x32 '2'
+    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x1F, 0xC1, 0xFE, 0x1F, 0xC3, 0xFC, 0x1F,
+    0x8F, 0xF8, 0x1F, 0x9F, 0xF1, 0x1F, 0x9F, 0xE3, 0x1F, 0x9F, 0xC3, 0x1F,
+    0x8F, 0x87, 0x1F, 0x80, 0x1F, 0x1F, 0xC0, 0x3F, 0x1F, 0xE0, 0x7F, 0x1F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0x9F, 0xC7, 0xFF, 0x9F, 0x8F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x8E, 0x1E, 0x1F,
+    0x80, 0x00, 0x3F, 0xC0, 0xC0, 0x7F, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFF, 0x19, 0xFF, 0xFC, 0x39, 0xFF, 0xF8, 0x79, 0xFF, 0xE1, 0xF9, 0xFF,
+    0xC3, 0xF9, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x80, 0x7F, 0x3F, 0x00, 0x7F, 0x3F,
+    0x04, 0x7F, 0x3F, 0x1C, 0x7F, 0x3F, 0x1C, 0x7E, 0x3F, 0x1E, 0x3C, 0x7F,
+    0x1E, 0x00, 0x7F, 0x1F, 0x00, 0xFF, 0x1F, 0x81, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F,
+    0xF0, 0x3E, 0x1F, 0xE3, 0x3F, 0x1F, 0xC7, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F,
+    0x8F, 0x3F, 0x9F, 0x9F, 0x1F, 0x1F, 0x9F, 0x80, 0x1F, 0x9F, 0x80, 0x3F,
+    0x9F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFC, 0x3F,
+    0x1F, 0xF0, 0x3F, 0x1F, 0xC0, 0x3F, 0x1F, 0x03, 0xFF, 0x1C, 0x1F, 0xFF,
+    0x10, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xF8, 0x7F, 0xE0, 0xE0, 0x3F, 0xC0, 0x60, 0x1F, 0xC0, 0x0F, 0x1F,
+    0x8E, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x0F, 0x9F,
+    0x8E, 0x07, 0x1F, 0xC0, 0x40, 0x1F, 0xC0, 0xE0, 0x3F, 0xF3, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xDF, 0xC0, 0x1F, 0x9F, 0xC0, 0x0F, 0x9F,
+    0x8F, 0x8F, 0x9F, 0x9F, 0xCF, 0x1F, 0x9F, 0xC7, 0x1F, 0x9F, 0xC6, 0x3F,
+    0x8F, 0xCC, 0x3F, 0x87, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF,
+    0xF8, 0x0F, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0x1F, 0xC7, 0x0F, 0xC7, 0x1F, 0xC7, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x9F, 0xD8, 0x3F, 0x0F, 0xC0, 0x7F,
+    0x0F, 0xC1, 0xFF, 0x9F, 0xE7, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xE6, 0x7F,
+    0xC6, 0x3F, 0xCF, 0x3F, 0x8F, 0x1F, 0x9F, 0x9F, 0x9F, 0x8F, 0xFF, 0xFF,
+    // 0x3D '='
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x9F, 0x8F, 0x8F, 0x9F, 0xCF, 0x1F, 0xC7, 0x3F,
+    0xE6, 0x3F, 0xE2, 0x7F, 0xF0, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0x87, 0xBF, 0x1F, 0x83, 0x1F,
+    0x1F, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x8F, 0x1F, 0xFF, 0xC6, 0x3F, 0xFF,
+    0xE0, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF,
+    // 0x40 '@'
+    0xFF, 0x81, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0xFF, 0x0F,
+    0xE3, 0xFF, 0xC7, 0xC7, 0xFF, 0xE3, 0xCF, 0xFF, 0xF3, 0x9F, 0x70, 0xF3,
+    0x9E, 0x30, 0x71, 0x9C, 0xE4, 0x79, 0x3D, 0xEE, 0x79, 0x3D, 0xEE, 0x79,
+    0x3C, 0xEE, 0xF9, 0x3C, 0x00, 0xF9, 0x3C, 0x00, 0x79, 0x9F, 0xFC, 0x73,
+    0x9F, 0xFE, 0x73, 0x8F, 0xFE, 0x73, 0xC7, 0xFC, 0x67, 0xC3, 0xF8, 0xFF,
+    0xE0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x1F, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xE0, 0x1F, 0xFF, 0x81, 0x9F, 0xFC, 0x07, 0xDF, 0xF0, 0x27, 0xFF,
+    0xC1, 0xE7, 0xFF, 0x87, 0xE7, 0xFF, 0x81, 0xE7, 0xFF, 0xC0, 0x27, 0xDF,
+    0xF0, 0x07, 0x9F, 0xFE, 0x00, 0x9F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x42 'B'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x8F, 0x1F, 0x9F, 0x80, 0x1F, 0x1F, 0xC0, 0x00, 0x3F,
+    0xE0, 0xC0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE1, 0xF8, 0x3F,
+    0xC7, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F,
+    0x81, 0xFF, 0x9F, 0x83, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F,
+    // 0x44 'D'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x3F,
+    0xC7, 0xFE, 0x3F, 0xC3, 0xFC, 0x7F, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF,
+    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x83, 0xFE, 0x1F, 0x87, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x46 'F'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x83, 0x9F, 0xFF,
+    0x87, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE1, 0xF8, 0x3F,
+    0xC7, 0xFE, 0x1F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xEF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x9F,
+    0x9F, 0xC7, 0x9F, 0x83, 0xC0, 0x1F, 0x83, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xEF, 0xFF,
+    // 0x48 'H'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xBF, 0x9F, 0xDF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF,
+    0x9F, 0x9F, 0xDF, 0x9F, 0x9F, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0xDF,
+    // 0x49 'I'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0xDF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0x9F, 0xFF, 0xFC, 0xFF, 0x9F, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x0F, 0x9F, 0xBE, 0x07, 0xDF,
+    0xFC, 0x43, 0xFF, 0xF8, 0xE1, 0xFF, 0xB1, 0xF0, 0xFF, 0x83, 0xF8, 0x7F,
+    0x87, 0xFC, 0x3F, 0x87, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF,
+    // 0x4C 'L'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9E, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x7F, 0x9F, 0x83, 0xFF, 0x9F, 0x80, 0x7F, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF,
+    0x83, 0xFF, 0xDF, 0x80, 0x3F, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0xFC, 0x1F, 0xBF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x4E 'N'
+    0xBF, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xC3, 0xFF, 0x9F, 0xE0, 0xFF, 0x9F, 0xF0, 0x7F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC1, 0xFF,
+    0xBF, 0xF0, 0xFF, 0x9F, 0xF8, 0x3F, 0x9F, 0xFC, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFE, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0xF0, 0x3F,
+    0xC7, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x8F, 0xFF, 0x1F, 0x87, 0xFE, 0x3F, 0xC1, 0xF8, 0x3F, 0xE0, 0x00, 0x7F,
+    0xF0, 0x00, 0xFF, 0xFC, 0x07, 0xFF,
+    // 0x50 'P'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x9F,
+    0x9F, 0xCF, 0xFF, 0x9F, 0x8F, 0xFF, 0x8F, 0x1F, 0xFF, 0x80, 0x1F, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+    0xE0, 0xF0, 0x3F, 0xFF, 0xC7, 0xFE, 0x3F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF,
+    0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF,
+    0x9F, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0x83, 0xFF, 0x9F, 0xFF, 0x91, 0xFF,
+    0x8F, 0xFF, 0x11, 0xFF, 0x87, 0xFE, 0x39, 0xFF, 0xC1, 0xF8, 0x38, 0xFF,
+    0xE0, 0x00, 0x78, 0xFF, 0xF0, 0x01, 0xFC, 0xFF, 0xFC, 0x07, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x52 'R'
+    0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0x87, 0xDF,
+    0x9F, 0x83, 0xFF, 0x9F, 0x81, 0xFF, 0x86, 0x30, 0x7F, 0xC0, 0x3C, 0x3F,
+    0xC0, 0x7E, 0x1F, 0xF1, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xDF,
+    // 0x53 'S'
+    0xFF, 0xFC, 0x3F, 0xE0, 0xF8, 0x1F, 0xC0, 0x7E, 0x1F, 0x80, 0x3F, 0x9F,
+    0x9E, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F, 0x9F, 0x0F, 0x8F, 0x9F, 0x8F, 0x9F,
+    0x9F, 0x87, 0x1F, 0x83, 0xC0, 0x1F, 0x83, 0xE0, 0x3F, 0xC7, 0xF0, 0xFF,
+    // 0x54 'T'
+    0x83, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x1F, 0xBF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFC, 0x3F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x9C, 0x03, 0xFF, 0xBF, 0x80, 0x7F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x7F,
+    0x9E, 0x03, 0xFF, 0x90, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x98, 0x01, 0xFF, 0x9F, 0x80, 0x3F,
+    0xBF, 0xF8, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF,
+    0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+    0xF0, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xBF, 0xC0, 0x3F, 0x9C, 0x01, 0xFF, 0x80, 0x0F, 0xFF,
+    0x80, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x1F,
+    0x87, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x80, 0xE1, 0x9F, 0x90, 0x43, 0xFF,
+    0xBC, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x41, 0xDF,
+    0x90, 0xE0, 0x9F, 0x83, 0xF8, 0x1F, 0x87, 0xFC, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF,
+    // 0x59 'Y'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x80, 0xFF, 0xDF, 0x98, 0x3F, 0x9F, 0xBE, 0x0F, 0x9F,
+    0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 0xBC, 0x3F, 0x9F,
+    0x90, 0xFF, 0x9F, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x1F, 0x83, 0xFE, 0x1F, 0x87, 0xF8, 0x1F,
+    0x9F, 0xF0, 0x1F, 0x9F, 0xE1, 0x9F, 0x9F, 0x83, 0x9F, 0x9F, 0x0F, 0x9F,
+    0x9C, 0x1F, 0x9F, 0x98, 0x7F, 0x9F, 0x80, 0xFF, 0x9F, 0x81, 0xFF, 0x9F,
+    0x87, 0xFE, 0x1F, 0x8F, 0xF8, 0x1F, 0xFF, 0xFC, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x3F, 0xFF, 0xFE, 0x7F, 0x3F, 0xFF, 0xFE, 0x7F, 0xBF, 0xFF, 0xFF, 0x7F,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xEF,
+    // 0x5D ']'
+    0xBF, 0xFF, 0xFF, 0x7F, 0x3F, 0xFF, 0xFE, 0x7F, 0x3F, 0xFF, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xEF, 0xFF, 0x8F, 0xFC, 0x0F, 0xF0, 0x3F, 0x81, 0xFF, 0x07, 0xFF,
+    0x0F, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x0F, 0xFF, 0xEF,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0xFF, 0x8F, 0x87, 0xC7, 0xE3, 0xF3, 0xFF,
+    // 0x61 'a'
+    0xFF, 0x8F, 0xC7, 0x03, 0x86, 0x03, 0x9E, 0x73, 0x3E, 0x73, 0x3E, 0x73,
+    0x3C, 0xF3, 0x1C, 0xE7, 0x80, 0x07, 0x80, 0x03, 0xF0, 0x03, 0xFF, 0xF3,
+    0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x9F, 0xE7, 0xFF, 0x3F, 0xE7,
+    0xFE, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x3F, 0xC7,
+    0xFF, 0x07, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xFB, 0xFF,
+    // 0x63 'c'
+    0xF8, 0x1F, 0xE0, 0x07, 0xC0, 0x07, 0x8F, 0xC3, 0x9F, 0xE3, 0x3F, 0xF3,
+    0x3F, 0xF3, 0x1F, 0xF3, 0x0F, 0xF3, 0x87, 0xF3, 0xC7, 0xF3, 0xFF, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x1F, 0x87,
+    0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x7F, 0xE7, 0xDE, 0x7F, 0xE7,
+    0x9E, 0x3F, 0xE7, 0x8E, 0x3F, 0xCF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xF0, 0x1F, 0xE0, 0x07, 0x80, 0x03, 0x8C, 0xE3, 0x1C, 0xE3, 0x3C, 0xF3,
+    0x3C, 0xF3, 0x1C, 0xF3, 0x8C, 0xF3, 0x80, 0xF3, 0xC0, 0xF7, 0xFB, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xE7, 0xF8, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x8F, 0x3F, 0xE7, 0x9F, 0x3F, 0xE7,
+    0x9F, 0x3F, 0xF7, 0x9F, 0x3F, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xC1, 0x80, 0x1F, 0x80, 0x01, 0x8F,
+    0x80, 0x23, 0xCF, 0x1E, 0x73, 0xCF, 0x3E, 0x73, 0xCF, 0x3E, 0x33, 0xCF,
+    0x3E, 0x73, 0xCF, 0x9E, 0x73, 0xCF, 0x80, 0x73, 0x9F, 0x00, 0xF1, 0x1F,
+    0x33, 0xF0, 0x3F, 0x1F, 0xF8, 0x7F, 0xBF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xE7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x3F, 0xE7, 0xFF, 0x3F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xF7, 0xFE, 0x1F, 0xE7,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xF7,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xEF, 0x9E, 0x7F, 0xCF, 0x0E, 0x00, 0x0F,
+    0x0C, 0x00, 0x0F, 0x1C, 0x00, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0x3F,
+    0xFE, 0x7F, 0xFE, 0x3F, 0x1E, 0x7F, 0xF8, 0x7F, 0x0C, 0x00, 0x00, 0x7F,
+    0x0C, 0x00, 0x01, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xE7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x01, 0xE7, 0xFF, 0xF1, 0xE7, 0xFF, 0xF0, 0xFF,
+    0xFF, 0x60, 0x3F, 0xFF, 0x4E, 0x1F, 0xFF, 0x0F, 0x0F, 0xFF, 0x1F, 0x87,
+    0xFF, 0x3F, 0xC7, 0xFF, 0x3F, 0xE7, 0xFF, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xDF, 0xFF, 0xF7, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xE7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xFB, 0x9F, 0xF3, 0x80, 0x03, 0x00, 0x03, 0xC0, 0x03,
+    0x8F, 0xF3, 0x9F, 0xFB, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFB, 0x0F, 0xF3,
+    0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x9F, 0xF3, 0x9F, 0xFF, 0x1F, 0xFF,
+    0x1F, 0xFF, 0x1F, 0xFB, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x03, 0xFF, 0xF3,
+    0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xFB, 0x9F, 0xF3, 0x80, 0x03, 0x00, 0x03, 0xC0, 0x03,
+    0x8F, 0xF3, 0x9F, 0xFB, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFB, 0x0F, 0xF3,
+    0x80, 0x03, 0x80, 0x03, 0xE0, 0x03, 0xFF, 0xF3, 0xFF, 0xF3,
+    // 0x6F 'o'
+    0xF8, 0x1F, 0xE0, 0x07, 0xC0, 0x07, 0x8F, 0xC3, 0x9F, 0xF3, 0x3F, 0xF1,
+    0x3F, 0xF1, 0x3F, 0xF3, 0x1F, 0xF3, 0x8F, 0xE3, 0x83, 0x87, 0xC0, 0x0F,
+    0xE0, 0x1F, 0xFF, 0xFF,
+    // 0x70 'p'
+    0x9F, 0xFF, 0xEF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0xCF, 0xF3, 0xCF, 0x9F, 0xF3, 0xCF, 0x9F, 0xF3, 0xCF,
+    0x1F, 0xF3, 0xFF, 0x1F, 0xF3, 0xFF, 0x1F, 0xE3, 0xFF, 0x0F, 0xC7, 0xFF,
+    0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+    // 0x71 'q'
+    0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xC3, 0xFF,
+    0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xCF,
+    0x1F, 0xE7, 0xCF, 0x1F, 0xC7, 0xCF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xFF, 0xFF, 0x9F, 0xFB, 0x9F, 0xF3, 0x80, 0x03, 0x00, 0x03, 0xC0, 0x03,
+    0xCF, 0xF3, 0x9F, 0xF3, 0x1F, 0xF3, 0x1F, 0xFF, 0x1F, 0xFF, 0xBF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xEF, 0xC3, 0x83, 0x81, 0xE3, 0x90, 0xF3, 0x38, 0xF3, 0x3C, 0x73,
+    0x3C, 0x73, 0x1E, 0x23, 0x86, 0x07, 0x8F, 0x0F, 0xFF, 0xFF,
+    // 0x74 't'
+    0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0xF3, 0xFC, 0x7F, 0xF3, 0xFE, 0x7F, 0xF3, 0xFE, 0x7F,
+    0xF3, 0xFE, 0x7F, 0xF7, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xBF, 0xFF, 0x9F, 0xFF, 0x80, 0x1F, 0x00, 0x07, 0x00, 0x03, 0xFF, 0xE3,
+    0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xF3, 0xBF, 0xF3, 0x9F, 0xE7, 0x80, 0x07,
+    0x00, 0x03, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFB,
+    // 0x76 'v'
+    0xBF, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0xB0, 0x1F,
+    0xBE, 0x03, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0x07, 0xB8, 0x1F, 0x80, 0x7F,
+    0x83, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF,
+    // 0x77 'w'
+    0xBF, 0xFF, 0xBF, 0xFF, 0x8F, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0xB8, 0x07,
+    0xBF, 0x03, 0xFF, 0xE3, 0xFF, 0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x83, 0xFF,
+    0x80, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x83, 0xFF, 0xC3, 0xBE, 0x07,
+    0x90, 0x3F, 0x80, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFB, 0xBF, 0xF3, 0x9F, 0xF3, 0x8F, 0xE3, 0x87, 0xC3, 0x83, 0x83,
+    0xB0, 0x3B, 0xF8, 0x7F, 0xF8, 0x3F, 0xB0, 0x1B, 0x83, 0x83, 0x87, 0xC3,
+    0x9F, 0xE3, 0x9F, 0xF3, 0xBF, 0xF3, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xBF, 0xFF, 0xDF, 0x9F, 0xFF, 0xCF, 0x8F, 0xFF, 0xCF, 0x81, 0xFF, 0x8F,
+    0x80, 0x7F, 0x8F, 0xB0, 0x1F, 0x1F, 0xBE, 0x00, 0x3F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xB8, 0x1F, 0xFF, 0x80, 0x7F, 0xFF,
+    0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0x87, 0xF3, 0x87, 0xC3, 0x9F, 0x83, 0x9F, 0x03, 0x9C, 0x33,
+    0x98, 0x73, 0x90, 0xF3, 0x81, 0xF3, 0x87, 0xF3, 0x8F, 0xC3, 0x9F, 0x83,
+    0xFF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x08, 0x00, 0x7F, 0x1F, 0xBE, 0xFE, 0x7F,
+    0x3F, 0xFF, 0xFE, 0x7F, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0x3F, 0xFF, 0xFE, 0x7F,
+    0x1F, 0xBE, 0xFE, 0x7F, 0x80, 0x08, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF,
+    0xE1, 0xE1, 0xC1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xCF, 0x8F, 0x1F, 0x3F, 0x1F, 0x9F, 0x8F, 0xCF, 0xCF, 0xCF, 0x0F, 0x1F,
+    // 0xA1 '¡'
+    0x9F, 0xFF, 0xFF, 0x0E, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x9E, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFC, 0x3C, 0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xF9, 0xFF, 0x9F, 0xFF,
+    0xF9, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x19, 0xFF, 0x9F, 0xFF,
+    0xF9, 0xFF, 0x9F, 0xFF, 0xF8, 0x7F, 0x9F, 0xFF, 0xFC, 0x7F, 0x1F, 0xFF,
+    0xFE, 0xFF, 0x3F, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x0F, 0xFF, 0x80, 0x1F,
+    0xF8, 0x00, 0x1F, 0xE0, 0x01, 0x9F, 0xC0, 0x1F, 0x9F, 0x8F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x8F, 0xFF, 0x9F,
+    0xC3, 0xFF, 0x9F, 0xC3, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xBF, 0xFF, 0x1F, 0xCF, 0x90, 0x1F, 0xC0, 0x3F, 0xC7, 0x1F, 0x8F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xCF, 0x1F, 0xC0, 0x3F, 0x80, 0x1F,
+    0x1F, 0xCF, 0xBF, 0xCF,
+    // 0xA5 '¥'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0x7F, 0xFF,
+    0x03, 0x67, 0xFF, 0x00, 0x67, 0xBF, 0x30, 0x27, 0x3F, 0xFC, 0x07, 0x3F,
+    0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x07, 0x3F, 0xF8, 0x27, 0x3F,
+    0x30, 0x67, 0x3F, 0x03, 0x67, 0xFF, 0x0F, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xF8, 0x3F, 0x9F, 0xE0, 0x1F, 0x0F, 0xC1, 0x8F, 0x0F, 0x80, 0xC7, 0xCF,
+    0x3C, 0xE3, 0xCF, 0x3C, 0x63, 0xEF, 0x3E, 0x31, 0xCF, 0x1E, 0x38, 0x8F,
+    0x0F, 0x1C, 0x1F, 0x8F, 0x80, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0x8F, 0x3F, 0x9E, 0x03, 0x9F, 0x9C, 0x61, 0x9F,
+    0xB9, 0xF9, 0xDF, 0xBB, 0xF9, 0xDF, 0xBB, 0xF9, 0xCF, 0xB9, 0xF9, 0xDF,
+    0x98, 0xF9, 0xDF, 0x9F, 0xFB, 0x9F, 0xDF, 0xFF, 0x9F, 0xCF, 0xFF, 0x3F,
+    0xE7, 0xFE, 0x7F, 0xF0, 0xF0, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x0F, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xFF, 0xC8, 0x67, 0x88, 0x27, 0xBB, 0x27, 0xB3, 0x67, 0x80, 0x67,
+    0x80, 0x67, 0xE0, 0x27, 0xFF, 0x6F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xCC, 0x7F, 0x9F, 0x3F,
+    0xBF, 0xBF, 0xFB, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC4, 0x7F, 0x8E, 0x3F,
+    0x9F, 0x3F, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE3, 0x8F, 0xCF, 0xE7, 0xDF, 0xF3, 0x90, 0x1B,
+    0xB0, 0x1B, 0xB6, 0xD9, 0xB0, 0x3B, 0x99, 0x9B, 0x9F, 0xD3, 0xCF, 0xF7,
+    0xE3, 0xC7, 0xF0, 0x1F, 0xFF, 0xFF,
+    // 0xB0 '°'
+    0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F,
+    0x9E, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0x80, 0x0C,
+    0x80, 0x0C, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xFD, 0xFC,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xC7, 0xCF, 0x87, 0x8F, 0x9F, 0x0F, 0xBE, 0x0F, 0x9C, 0x4F,
+    0x80, 0xCF, 0x81, 0xCF, 0xC7, 0xCF, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xFF, 0xCF, 0xE7, 0x9D, 0xE7, 0x9D, 0xE7, 0xB9, 0xC7, 0x99, 0xCF,
+    0x80, 0x0F, 0x84, 0x1F, 0xFF, 0x3F,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x02, 0x1F,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFC, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF,
+    0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03,
+    0x9F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xFF, 0x1F, 0x0F, 0x1F, 0xFF,
+    // 0xB9 '¹'
+    0xDF, 0xFF, 0xDF, 0xEF, 0x9F, 0xEF, 0x80, 0x0F, 0x80, 0x0F, 0xFF, 0xCF,
+    0xFF, 0xEF, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xC0, 0xF7, 0x80, 0x67, 0x9E, 0x27, 0xBF, 0x27, 0xBF, 0x27,
+    0x9E, 0x67, 0x80, 0x67, 0xC0, 0xEF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xBF, 0x9F, 0x3F, 0x8E, 0x7F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF,
+    0xFB, 0xFF, 0xBF, 0xBF, 0x9E, 0x3F, 0xCC, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF,
+    0xF3, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xEF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFC, 0xFF,
+    0x87, 0xF8, 0x7F, 0x1F, 0xF0, 0x7F, 0xBF, 0xC6, 0x7F, 0xFF, 0x8E, 0x7F,
+    0xFF, 0x1E, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFE, 0x7F,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+    0x0F, 0x9F, 0x9F, 0x9F, 0x0F, 0x1F, 0xFF, 0x3E, 0x1F, 0xFE, 0x7C, 0x1F,
+    0xFE, 0x78, 0x9F, 0xFE, 0x31, 0x9F, 0xFF, 0x03, 0x9F, 0xFF, 0x07, 0x9F,
+    0xFF, 0xFF, 0x9F,
+    // 0xBE '¾'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0x8D, 0xE7, 0xFF, 0x9C, 0xE7, 0xFF,
+    0x9C, 0xE7, 0xFF, 0x98, 0xC7, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0x1F, 0xEF,
+    0xFF, 0x3F, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xE1, 0xFE, 0xFF, 0x87, 0xF8, 0x7F, 0x1F, 0xF0, 0x7F, 0xBF, 0xE2, 0x7F,
+    0xFF, 0x86, 0x7F, 0xFF, 0x1E, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x1F,
+    0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F,
+    // 0xBF '¿'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x8E, 0x1F,
+    0x9F, 0x8F, 0x1F, 0x0F, 0x1F, 0x9F, 0x0C, 0x1F, 0x8F, 0x9C, 0x1F, 0x1F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x06, 0x7F,
+    0x1F, 0xF0, 0x1F, 0x7F, 0x8F, 0xC0, 0x9F, 0xFF, 0xCF, 0x07, 0x9F, 0xFF,
+    0xC6, 0x1F, 0x9F, 0xFF, 0xE6, 0x07, 0x9F, 0xFF, 0xF7, 0x00, 0x9F, 0x7F,
+    0xFF, 0xC0, 0x1E, 0x7F, 0xFF, 0xF8, 0x02, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x06, 0x7F,
+    0xFF, 0xF0, 0x1F, 0x7F, 0xE7, 0xC0, 0x9F, 0xFF, 0xE7, 0x07, 0x9F, 0xFF,
+    0xCE, 0x1F, 0x9F, 0xFF, 0x8E, 0x07, 0x9F, 0xFF, 0x8F, 0x00, 0x9F, 0x7F,
+    0x1F, 0xC0, 0x1E, 0x7F, 0xFF, 0xF8, 0x02, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xF7, 0xFE, 0x06, 0x7F,
+    0xE7, 0xF0, 0x1F, 0x7F, 0xC7, 0xC0, 0x9F, 0xFF, 0x8F, 0x07, 0x9F, 0xFF,
+    0x1E, 0x1F, 0x9F, 0xFF, 0x9E, 0x07, 0x9F, 0xFF, 0x8F, 0x00, 0x9F, 0x7F,
+    0xC7, 0xC0, 0x1E, 0x7F, 0xF7, 0xF8, 0x02, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xCF, 0xFE, 0x06, 0x7F,
+    0x8F, 0xF0, 0x1F, 0x7F, 0x9F, 0xC0, 0x9F, 0xFF, 0x9F, 0x07, 0x9F, 0xFF,
+    0x8E, 0x1F, 0x9F, 0xFF, 0xCE, 0x07, 0x9F, 0xFF, 0xC7, 0x00, 0x9F, 0x7F,
+    0x8F, 0xC0, 0x1E, 0x7F, 0xDF, 0xF8, 0x02, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0x00, 0x9F, 0xFC, 0x0C, 0x0F, 0xE0, 0x3E, 0x1F, 0x81, 0x3F,
+    0xFE, 0x0F, 0x3F, 0xFC, 0x3F, 0x3F, 0x9C, 0x0F, 0x3F, 0x1E, 0x01, 0x3E,
+    0x0F, 0x80, 0x3C, 0x9F, 0xF0, 0x04, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0x3F,
+    0xC7, 0xF8, 0x0F, 0xBF, 0x83, 0xE0, 0x4F, 0xFF, 0x39, 0x83, 0xCF, 0xFF,
+    0x39, 0x0F, 0xCF, 0xFF, 0x91, 0x03, 0xCF, 0xFF, 0x83, 0x80, 0x4F, 0xBF,
+    0xEF, 0xE0, 0x0F, 0x3F, 0xFF, 0xFC, 0x01, 0x3F, 0xFF, 0xFF, 0x80, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE1, 0x9F, 0xFF, 0x87, 0xDF,
+    0xFE, 0x07, 0xFF, 0xBC, 0x27, 0xFF, 0x90, 0xE7, 0xFF, 0x83, 0xE7, 0xDF,
+    0x8F, 0xE7, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x8F, 0x9F, 0x9F, 0x83, 0xFC, 0x1F, 0x87, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+    0xE1, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF,
+    0x9F, 0xFF, 0x1B, 0xFF, 0x9F, 0xFF, 0x93, 0x3F, 0x9F, 0xFF, 0x90, 0x3F,
+    0x9F, 0xFF, 0x90, 0x7F, 0x9F, 0xFF, 0x98, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF,
+    0x81, 0xFF, 0x9F, 0xFF, 0x83, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+    // 0xC8 'È'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xBE, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x7F, 0x8E, 0x7E, 0x7E, 0x7F,
+    0xCE, 0x7E, 0x7E, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F, 0xE6, 0x7E, 0x7E, 0x7F,
+    0xFE, 0x7E, 0x7E, 0x7F, 0xFE, 0x7E, 0x7E, 0x7F, 0xFE, 0x7E, 0x7E, 0x7F,
+    0xFE, 0x0F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xE6, 0x7E, 0x7E, 0x7F,
+    0xE6, 0x7E, 0x7E, 0x7F, 0xCE, 0x7E, 0x7E, 0x7F, 0x8E, 0x7E, 0x7E, 0x7F,
+    0x8E, 0x7E, 0x7E, 0x7F, 0x9E, 0x7E, 0x7E, 0x7F, 0xFE, 0x7E, 0x7E, 0x7F,
+    0xFE, 0x0F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xF6, 0x00, 0x00, 0x7F, 0xE6, 0x00, 0x00, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F,
+    0x8E, 0x7E, 0x7E, 0x7F, 0x1E, 0x7E, 0x7E, 0x7F, 0x8E, 0x7E, 0x7E, 0x7F,
+    0xCE, 0x7E, 0x7E, 0x7F, 0xE6, 0x7E, 0x7E, 0x7F, 0xF6, 0x7E, 0x7E, 0x7F,
+    0xFE, 0x0F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFC, 0xFF, 0xFE, 0xFC, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x9C, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0x9C, 0xFC, 0xFC, 0x1C, 0xFC, 0xFC, 0x1C, 0xFC, 0xFC, 0x9C, 0xFC, 0xFC,
+    0xFC, 0x1F, 0xF0, 0xFC, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0x9E, 0x7F, 0xFF, 0x7F, 0x0E, 0x7F, 0xFE, 0x7F, 0x8E, 0x00, 0x00, 0x7F,
+    0xCE, 0x00, 0x00, 0x7F, 0xC6, 0x00, 0x00, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFF, 0x7F,
+    // 0xCD 'Í'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xE6, 0x00, 0x00, 0x7F,
+    0xC6, 0x00, 0x00, 0x7F, 0xCE, 0x00, 0x00, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F,
+    0x0E, 0x7F, 0xFE, 0x7F, 0x9E, 0xFF, 0xFF, 0x7F,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x7F, 0xFF, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F, 0xE6, 0xFF, 0xFF, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0x9F, 0xFF, 0xFF, 0x1C, 0xFF, 0xFE, 0x1C, 0xFF, 0xFC, 0x9C, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x9C, 0xFF, 0xFC, 0x0C, 0xFF, 0xFC,
+    0x1D, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xDF, 0x9F, 0x9F, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x8F, 0xFF, 0x3F, 0xC7, 0xFE, 0x3F, 0xC3, 0xFC, 0x7F, 0xE0, 0x00, 0x7F,
+    0xF0, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFE, 0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0x8F, 0x0F, 0xFE, 0x7F,
+    0x8F, 0x83, 0xFE, 0x7F, 0x9F, 0xC1, 0xFF, 0xFF, 0x9F, 0xF0, 0xFF, 0xFF,
+    0x8F, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x1F, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
+    0x8E, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0xE0, 0xFF, 0xFE, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0xF8, 0x7F, 0x9E, 0x3F, 0xFC, 0x7F,
+    0x0E, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F, 0xCE, 0x7F, 0xFE, 0x3F,
+    0xC4, 0x7F, 0xFE, 0x3F, 0xE6, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x3F, 0xFC, 0x7F, 0xFE, 0x1F, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0xF8, 0x7F, 0xFE, 0x3F, 0xFC, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x3F,
+    0xCC, 0x7F, 0xFE, 0x3F, 0x8E, 0x7F, 0xFE, 0x7F, 0x0E, 0x7F, 0xFE, 0x7F,
+    0x9E, 0x3F, 0xFC, 0x7F, 0xFE, 0x1F, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0xF8, 0x7F, 0xF6, 0x3F, 0xFC, 0x7F,
+    0xE6, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFE, 0x3F,
+    0x1C, 0x7F, 0xFE, 0x3F, 0x8E, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F,
+    0xE6, 0x3F, 0xFC, 0x7F, 0xF6, 0x1F, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0xF8, 0x7F, 0x8E, 0x3F, 0xFC, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFE, 0x3F,
+    0xCC, 0x7F, 0xFE, 0x3F, 0xC6, 0x7F, 0xFE, 0x7F, 0x86, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x3F, 0xFC, 0x7F, 0xFE, 0x1F, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFE, 0x07, 0x81, 0xFF, 0xFE, 0x3F, 0xF0, 0xFF, 0x1C, 0x7F, 0xF8, 0xFF,
+    0x0C, 0xFF, 0xFC, 0xFF, 0x9C, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F,
+    0xF8, 0xFF, 0xFC, 0x7F, 0x9C, 0xFF, 0xFC, 0xFF, 0x0C, 0xFF, 0xFC, 0xFF,
+    0x1C, 0x7F, 0xF8, 0xFF, 0x9C, 0x3F, 0xF1, 0xFF, 0xFE, 0x0F, 0xC1, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+    // 0xD7 '×'
+    0xBF, 0xFF, 0x1E, 0x3F, 0x8C, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF,
+    0xC0, 0xFF, 0x8C, 0x7F, 0x1E, 0x3F, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0x9F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
+    0xC0, 0xF0, 0x3F, 0xC7, 0xF8, 0x1F, 0x8F, 0xF1, 0x1F, 0x9F, 0xE3, 0x9F,
+    0x9F, 0xC7, 0x9F, 0x9F, 0x8F, 0x8F, 0x1F, 0x1F, 0x8F, 0x9E, 0x3F, 0x9F,
+    0x9C, 0x7F, 0x9F, 0x88, 0xFF, 0x1F, 0x81, 0xFE, 0x3F, 0xC1, 0xF8, 0x3F,
+    0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x9C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xBE, 0x7F, 0xFC, 0x7F, 0x1E, 0xFF, 0xFC, 0x7F, 0x8F, 0xFF, 0xFE, 0x7F,
+    0xCF, 0xFF, 0xFE, 0x7F, 0xC7, 0xFF, 0xFE, 0x7F, 0xE7, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x7F, 0xFE, 0x7F, 0xF0, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x7F, 0xFC, 0x7F, 0xFE, 0xFF, 0xFC, 0x7F, 0xE7, 0xFF, 0xFE, 0x7F,
+    0xE7, 0xFF, 0xFE, 0x7F, 0xCF, 0xFF, 0xFE, 0x7F, 0x8F, 0xFF, 0xFE, 0x7F,
+    0x8F, 0xFF, 0xFE, 0x7F, 0x9E, 0x7F, 0xFC, 0x7F, 0xFE, 0x7F, 0xF0, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xF6, 0x7F, 0xFC, 0x7F, 0xE6, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xFE, 0x7F,
+    0x8F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x8F, 0xFF, 0xFE, 0x7F,
+    0xCF, 0xFF, 0xFE, 0x7F, 0xC6, 0x7F, 0xFC, 0x7F, 0xF6, 0x7F, 0xF0, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0x1C, 0xFF, 0xF8, 0xFF, 0x0D, 0xFF, 0xF8, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x0C, 0xFF, 0xF8, 0xFF, 0x9C, 0xFF, 0xE1, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xBF, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x93, 0xFC, 0x9F, 0xB3, 0xFD, 0x9F, 0xB3, 0xFD, 0xDF,
+    0xF3, 0xF9, 0xFF, 0xF9, 0xF9, 0xFF, 0xF8, 0xF1, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xF8, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF,
+    0x9F, 0xDF, 0xC7, 0x9F, 0x07, 0xE7, 0x9E, 0x03, 0xE7, 0x8C, 0x61, 0xF7,
+    0x80, 0xF0, 0xE7, 0xC1, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x1F,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xC7, 0x03, 0x8F, 0x86, 0x03, 0x87, 0x9E, 0x73,
+    0xC7, 0x3E, 0x73, 0xE3, 0x3E, 0x73, 0xF3, 0x3C, 0xF3, 0xFF, 0x1C, 0xE7,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xC7, 0x03, 0xFF, 0x86, 0x03, 0xFF, 0x9E, 0x73,
+    0xFB, 0x3E, 0x73, 0xF3, 0x3E, 0x73, 0xC3, 0x3C, 0xF3, 0x87, 0x1C, 0xE7,
+    0x8F, 0x80, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0x1F, 0xFF, 0x8E, 0x07, 0xF3, 0x0C, 0x07, 0xC7, 0x3C, 0xE7,
+    0x8E, 0x7C, 0xE7, 0x1E, 0x7C, 0xE7, 0x1E, 0x79, 0xE7, 0x86, 0x39, 0xCF,
+    0xC3, 0x00, 0x0F, 0xF7, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFE, 0x3F, 0xDF, 0x1C, 0x0F, 0x0E, 0x18, 0x0F, 0x1E, 0x79, 0xCF,
+    0x3C, 0xF9, 0xCF, 0x9C, 0xF9, 0xCF, 0x8C, 0xF3, 0xCF, 0xCC, 0x73, 0x9F,
+    0x0E, 0x00, 0x1F, 0x9E, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFE, 0x3F, 0x9F, 0x1C, 0x0F, 0x8E, 0x18, 0x0F, 0x8E, 0x79, 0xCF,
+    0xDC, 0xF9, 0xCF, 0xFC, 0xF9, 0xCF, 0xFC, 0xF3, 0xCF, 0x8C, 0x73, 0x9F,
+    0x8E, 0x00, 0x1F, 0x9E, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xC7, 0x03, 0xE7, 0x86, 0x03, 0x81, 0x9E, 0x73,
+    0x99, 0x3E, 0x73, 0xB9, 0x3E, 0x73, 0x99, 0x3C, 0xF3, 0x81, 0x1C, 0xE7,
+    0xC3, 0x80, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0x8F, 0xC7, 0x03, 0x86, 0x03, 0x9E, 0x73, 0x3E, 0x73, 0x3C, 0xF3,
+    0x3C, 0xF3, 0x1C, 0xF3, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x8C, 0xE3,
+    0x1C, 0xF3, 0x3C, 0xF3, 0x3D, 0xF3, 0x19, 0xF3, 0x81, 0xF3, 0x81, 0xF3,
+    0xC1, 0xF7, 0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xC3, 0xFF,
+    0x9F, 0xE3, 0x7F, 0x3F, 0xF2, 0x67, 0x3F, 0xF2, 0x07, 0x1F, 0xF2, 0x0F,
+    0x0F, 0xF3, 0x1F, 0x87, 0xF3, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xDF, 0x80, 0x03, 0x8F, 0x8C, 0xE3,
+    0x87, 0x1C, 0xE3, 0xC3, 0x3C, 0xF3, 0xF3, 0x3C, 0xF3, 0xFB, 0x1C, 0xF3,
+    0xFF, 0x8C, 0xF3, 0xFF, 0x80, 0xF3, 0xFF, 0xC0, 0xF7, 0xFF, 0xFB, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x8C, 0xE3,
+    0xFF, 0x1C, 0xE3, 0xF3, 0x3C, 0xF3, 0xE3, 0x3C, 0xF3, 0x87, 0x1C, 0xF3,
+    0x8F, 0x8C, 0xF3, 0xDF, 0x80, 0xF3, 0xFF, 0xC0, 0xF7, 0xFF, 0xFB, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xF3, 0x00, 0x07, 0xE3, 0x19, 0xC7,
+    0x86, 0x39, 0xC7, 0x0E, 0x79, 0xE7, 0x1E, 0x79, 0xE7, 0x8E, 0x39, 0xE7,
+    0xC7, 0x19, 0xE7, 0xE3, 0x01, 0xE7, 0xFF, 0x81, 0xEF, 0xFF, 0xF7, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x1F, 0x8E, 0x00, 0x0F, 0x8E, 0x33, 0x8F,
+    0x9C, 0x73, 0x8F, 0xFC, 0xF3, 0xCF, 0xFC, 0xF3, 0xCF, 0x9C, 0x73, 0xCF,
+    0x8E, 0x33, 0xCF, 0x8E, 0x03, 0xCF, 0x9F, 0x03, 0xDF, 0xFF, 0xEF, 0xFF,
+    // 0xEC 'ì'
+    0xDF, 0xFF, 0xFF, 0x8F, 0x9F, 0xFB, 0x87, 0x9F, 0xF3, 0xC3, 0x80, 0x03,
+    0xF3, 0x00, 0x03, 0xFB, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFB, 0xFF, 0x9F, 0xF3, 0xF3, 0x80, 0x03,
+    0xE3, 0x00, 0x03, 0x87, 0x00, 0x03, 0x8F, 0xFF, 0xF3, 0xDF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFB, 0xFF, 0xFF, 0xE3, 0x3F, 0xF7, 0x87, 0x3F, 0xE7, 0x0F, 0x00, 0x07,
+    0x1E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0xC7, 0xFF, 0xE7, 0xE3, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8E, 0x7F, 0xEF, 0x9E, 0x7F, 0xCF,
+    0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x9C, 0x00, 0x0F, 0x8F, 0xFF, 0xCF,
+    0x8F, 0xFF, 0xCF, 0x9F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xBB, 0x1F, 0x87,
+    0x13, 0x3F, 0xE7, 0x86, 0x3F, 0xE3, 0xCE, 0x3F, 0xE3, 0xC6, 0x3F, 0xE7,
+    0x83, 0x3F, 0xE7, 0x30, 0x1F, 0xC7, 0xFC, 0x07, 0x0F, 0xFE, 0x00, 0x1F,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xEF, 0xFE, 0x7F, 0xCF, 0xFE, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0x8F, 0x00, 0x0F, 0x1E, 0x3F, 0xCF, 0x3E, 0x7F, 0xEF,
+    0x1C, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0xCC, 0x7F, 0xEF, 0x0C, 0x3F, 0xCF,
+    0x1E, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF,
+    // 0xF2 'ò'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0x8F, 0x8F, 0xC3,
+    0x8F, 0x9F, 0xF3, 0xC7, 0x3F, 0xF1, 0xE3, 0x3F, 0xF1, 0xF3, 0x3F, 0xF3,
+    0xFF, 0x1F, 0xF3, 0xFF, 0x8F, 0xE3, 0xFF, 0x83, 0x87, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xC3,
+    0xFF, 0x9F, 0xF3, 0xFB, 0x3F, 0xF1, 0xF3, 0x3F, 0xF1, 0xC3, 0x3F, 0xF3,
+    0x87, 0x1F, 0xF3, 0x8F, 0x8F, 0xE3, 0xFF, 0x83, 0x87, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xF3, 0x1F, 0x87,
+    0xC7, 0x3F, 0xE7, 0x8E, 0x7F, 0xE3, 0x1E, 0x7F, 0xE3, 0x1E, 0x7F, 0xE7,
+    0x86, 0x3F, 0xE7, 0xC3, 0x1F, 0xC7, 0xF7, 0x07, 0x0F, 0xFF, 0x80, 0x1F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 0x0E, 0x3F, 0x0F,
+    0x1E, 0x7F, 0xCF, 0x3C, 0xFF, 0xC7, 0x9C, 0xFF, 0xC7, 0x8C, 0xFF, 0xCF,
+    0xCC, 0x7F, 0xCF, 0x0E, 0x3F, 0x8F, 0x9E, 0x0E, 0x1F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x1F, 0x9F, 0x00, 0x1F, 0x8E, 0x3F, 0x0F,
+    0x8E, 0x7F, 0xCF, 0x9C, 0xFF, 0xC7, 0xFC, 0xFF, 0xC7, 0xFC, 0xFF, 0xCF,
+    0x8C, 0x7F, 0xCF, 0x8E, 0x3F, 0x8F, 0x8E, 0x0E, 0x1F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0xDF, 0x19, 0x8F,
+    0x19, 0x8F, 0x99, 0xDF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFD, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xF8, 0x13, 0xE0, 0x03, 0xC0, 0x07, 0x8F, 0x83, 0x9F, 0x13,
+    0x3E, 0x31, 0x3C, 0x71, 0x38, 0xF3, 0x11, 0xF3, 0x83, 0xE3, 0x83, 0x87,
+    0x80, 0x0F, 0x00, 0x1F, 0xBF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x07,
+    0xDF, 0x00, 0x03, 0x8F, 0xFF, 0xE3, 0x87, 0xFF, 0xF3, 0xE3, 0xFF, 0xF3,
+    0xF3, 0xFF, 0xF3, 0xFB, 0xBF, 0xF3, 0xFF, 0x9F, 0xE7, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0xFA 'ú'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3,
+    0xE3, 0xFF, 0xF3, 0x87, 0xBF, 0xF3, 0x8F, 0x9F, 0xE7, 0xDF, 0x80, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0xFB 'û'
+    0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x0F,
+    0xF2, 0x00, 0x07, 0xE3, 0xFF, 0xC7, 0x87, 0xFF, 0xE7, 0x0F, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xE7, 0x8F, 0x7F, 0xE7, 0xC7, 0x3F, 0xCF, 0xE3, 0x00, 0x0F,
+    0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xF7,
+    // 0xFC 'ü'
+    0xFE, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x1F,
+    0x8C, 0x00, 0x0F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0x9E, 0xFF, 0xCF, 0x8E, 0x7F, 0x9F, 0x8E, 0x00, 0x1F,
+    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xEF,
+    // 0xFE 'þ'
+    0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0x9F,
+    0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0xFF, 0x3F, 0xE7, 0x9F, 0xFF, 0x3F, 0xE7, 0x9F, 0xFE, 0x3F, 0xE7, 0xFF,
+    0xFE, 0x3F, 0xE7, 0xFF, 0xFE, 0x3F, 0xE7, 0xFF, 0xFE, 0x1F, 0xC7, 0xFF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFE, 0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFF, 0x3F, 0xFE, 0x3F, 0xFF, 0x3F,
+    0x9E, 0x07, 0xFE, 0x3F, 0x8E, 0x01, 0xFE, 0x3F, 0x8E, 0xC0, 0x7C, 0x7F,
+    0xFE, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
+    0x8F, 0xFC, 0x1F, 0xFF, 0x8E, 0xE0, 0x7F, 0xFF, 0x9E, 0x01, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x81, 0x9F, 0xFF,
+    0xFC, 0x07, 0xDF, 0xFF, 0xF0, 0x27, 0xFF, 0xFF, 0xC1, 0xE7, 0xFF, 0xFF,
+    0x87, 0xE7, 0xFF, 0xFF, 0x81, 0xE7, 0xFF, 0xFF, 0xC0, 0x27, 0xDF, 0xFF,
+    0xF0, 0x07, 0x99, 0xFF, 0xFE, 0x00, 0x90, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF8, 0x0C, 0x7F, 0xFF, 0xFE, 0x1C, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0x8F, 0xFF, 0xC7, 0x03, 0xFF, 0x86, 0x03, 0xFF, 0x9E, 0x73, 0xFF,
+    0x3E, 0x73, 0xFF, 0x3E, 0x73, 0xFF, 0x3C, 0xF3, 0xFF, 0x1C, 0xE7, 0xFF,
+    0x80, 0x06, 0x1F, 0x80, 0x00, 0x1F, 0xF0, 0x01, 0x9F, 0xFF, 0xF3, 0xCF,
+    0xFF, 0xF3, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x87, 0xE0, 0xFF, 0xFF, 0x1F, 0xF8, 0x7F, 0xFE, 0x3F, 0xFC, 0x7F,
+    0xF6, 0x7F, 0xFC, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F, 0x1E, 0x3F, 0xFE, 0x7F,
+    0xFE, 0x07, 0xFE, 0x7F, 0xFE, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xC3,
+    0xFF, 0x9F, 0xE3, 0xF3, 0x3F, 0xF3, 0xE3, 0x3F, 0xF3, 0x87, 0x1F, 0xF3,
+    0x8F, 0x0F, 0xF3, 0xDF, 0x87, 0xF3, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x87, 0xE0, 0xFF, 0x3F, 0x1F, 0xF8, 0x7F, 0x1E, 0x3F, 0xFC, 0x7F,
+    0x8E, 0x7F, 0xFC, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F,
+    0xC6, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F, 0x1E, 0x3F, 0xFE, 0x7F,
+    0x3E, 0x07, 0xFE, 0x7F, 0xFE, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0x9F, 0xC0, 0x07, 0x8F, 0x8F, 0xC3,
+    0xC3, 0x9F, 0xE3, 0xE3, 0x3F, 0xF3, 0xF3, 0x3F, 0xF3, 0xC3, 0x1F, 0xF3,
+    0x8F, 0x0F, 0xF3, 0x9F, 0x87, 0xF3, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0x3E, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F,
+    0xC6, 0x7F, 0xFE, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0x1E, 0x7F, 0xFE, 0x7F, 0x3E, 0x3F, 0xFC, 0xFF,
+    0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF1, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x1F, 0x87,
+    0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x7F, 0xE7, 0xDE, 0x7F, 0xE7,
+    0x9E, 0x3F, 0xE7, 0x8E, 0x3F, 0xCF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xF9, 0xFF, 0xE7, 0x81, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0x9F, 0xFF, 0xDF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x9F, 0x9F, 0x9F, 0xFF,
+    0x9F, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0x90, 0xFF,
+    0x9F, 0x9F, 0x80, 0xFF, 0x9F, 0x9F, 0x84, 0xFF, 0x9F, 0x9F, 0x8C, 0x7F,
+    0x83, 0xFE, 0x1C, 0xFF, 0x87, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x8C, 0xE3, 0xFF,
+    0x1C, 0xE3, 0xFF, 0x3C, 0xF3, 0xFF, 0x3C, 0xF0, 0x1F, 0x1C, 0xF0, 0x1F,
+    0x8C, 0xF1, 0x9F, 0x80, 0xF3, 0xCF, 0xC0, 0xF7, 0xDF, 0xFB, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0x1E, 0x00, 0x00, 0x7F, 0x8E, 0x00, 0x00, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F,
+    0xC6, 0x7E, 0x7E, 0x7F, 0xE6, 0x7E, 0x7E, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F,
+    0x9E, 0x7E, 0x7E, 0x7F, 0x3E, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F,
+    0xFE, 0x0F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0x9F, 0x80, 0x03, 0x87, 0x8C, 0xE3,
+    0xC3, 0x1C, 0xE3, 0xF3, 0x3C, 0xF3, 0xF3, 0x3C, 0xF3, 0xC3, 0x1C, 0xF3,
+    0x8F, 0x8C, 0xF3, 0x9F, 0x80, 0xF3, 0xFF, 0xC0, 0xF7, 0xFF, 0xFB, 0xFF,
+    // 0x139 'Ĺ'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xE6, 0x00, 0x00, 0x7F,
+    0xC6, 0x00, 0x00, 0x7F, 0xCE, 0x00, 0x00, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F,
+    0x1E, 0x7F, 0xFE, 0x7F, 0x9E, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xF6, 0x7F, 0xFF, 0xDF, 0xE6, 0x7F, 0xFF, 0x9F,
+    0xC6, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xE7, 0xFF, 0xF7, 0xE7, 0xFF, 0xE7, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xEF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0x81, 0xFF, 0xE7, 0x87, 0xFF, 0xE7,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xDF, 0xFF, 0xF7, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xE7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F, 0xE7, 0xDF, 0x9F, 0xCF, 0x9F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0x3F, 0x9F,
+    0x9F, 0x3F, 0x9F, 0xBE, 0x7F, 0x9F, 0xFE, 0x7F, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xF9, 0xF7, 0x9F, 0xF3, 0xF7, 0x9F, 0xE3, 0xE7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x1F, 0xE7,
+    0xFF, 0x3F, 0xE7, 0xFF, 0x7F, 0xFF,
+    // 0x143 'Ń'
+    0xFE, 0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFE, 0x7F,
+    0xFF, 0x83, 0xFE, 0x7F, 0xE7, 0xC1, 0xFF, 0xFF, 0xE7, 0xF0, 0xFF, 0xFF,
+    0xCF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x07, 0xFF,
+    0x9E, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0xE0, 0xFF, 0xFE, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFB, 0xFF, 0x9F, 0xF3, 0xFF, 0x80, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x8F, 0xF3, 0xFF, 0x9F, 0xFB,
+    0xF3, 0x1F, 0xFF, 0xC3, 0x1F, 0xFF, 0x87, 0x1F, 0xFB, 0x8F, 0x0F, 0xF3,
+    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0x147 'Ň'
+    0xFE, 0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0x1F, 0x0F, 0xFE, 0x7F,
+    0x8F, 0x83, 0xFE, 0x7F, 0xC7, 0xC1, 0xFF, 0xFF, 0xC7, 0xF0, 0xFF, 0xFF,
+    0xE7, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x07, 0xFF,
+    0x3E, 0xFF, 0xC3, 0xFF, 0x7E, 0x7F, 0xE0, 0xFF, 0xFE, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFB, 0xFF, 0x9F, 0xF3, 0xFF, 0x80, 0x03,
+    0xFF, 0x00, 0x03, 0x8F, 0xC0, 0x03, 0xC7, 0x8F, 0xF3, 0xE3, 0x9F, 0xFB,
+    0xF3, 0x1F, 0xFF, 0xE3, 0x1F, 0xFF, 0xC7, 0x1F, 0xFB, 0x8F, 0x0F, 0xF3,
+    0xBF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0x152 'Œ'
+    0xFF, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0xF0, 0x3F,
+    0xC7, 0xFE, 0x3F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x8F, 0x9F, 0x9F, 0x83, 0xFC, 0x1F, 0x87, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x8F, 0xC3, 0x1F, 0xF3, 0x3F, 0xF1,
+    0x3F, 0xF1, 0x1F, 0xF3, 0x1F, 0xF3, 0x8F, 0xE3, 0x80, 0x07, 0xC0, 0x0F,
+    0xC0, 0x07, 0x8C, 0xC3, 0x1C, 0xE3, 0x3C, 0xF3, 0x3C, 0xF3, 0x1C, 0xF3,
+    0x0C, 0xF3, 0x80, 0xF3, 0xC0, 0xF3, 0xF3, 0xFF,
+    // 0x158 'Ř'
+    0xFE, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x3E, 0x00, 0x00, 0x7F,
+    0x1E, 0x00, 0x00, 0x7F, 0x8E, 0x00, 0x00, 0x7F, 0xC6, 0x7F, 0x3E, 0x7F,
+    0xE6, 0x7F, 0x3E, 0x7F, 0xC6, 0x7E, 0x1F, 0x7F, 0x8E, 0x7E, 0x0F, 0xFF,
+    0x1E, 0x7E, 0x07, 0xFF, 0x3E, 0x18, 0xC1, 0xFF, 0xFF, 0x00, 0xF0, 0xFF,
+    0xFF, 0x01, 0xF8, 0x7F, 0xFF, 0xC7, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFB, 0x8F, 0x9F, 0xF3, 0x87, 0x80, 0x03,
+    0xE3, 0x00, 0x03, 0xF3, 0xC0, 0x03, 0xE3, 0xCF, 0xF3, 0xC7, 0x9F, 0xF3,
+    0x8F, 0x1F, 0xF3, 0x9F, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xE0, 0x7F, 0xFF, 0x01, 0xF8, 0x7F,
+    0xFE, 0x00, 0xFE, 0x7F, 0xE6, 0x78, 0x7E, 0x3F, 0xE6, 0x7C, 0x7E, 0x3F,
+    0xCE, 0x7C, 0x3E, 0x3F, 0x8E, 0x7E, 0x3E, 0x7F, 0x8E, 0x7E, 0x1C, 0x7F,
+    0x1E, 0x0F, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0xFF, 0xFF, 0x1F, 0xC3, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xC3, 0x83, 0xFF, 0x81, 0xE3, 0xFF, 0x90, 0xF3,
+    0xFB, 0x38, 0xF3, 0xE3, 0x3C, 0x73, 0xC7, 0x3C, 0x73, 0x8F, 0x1E, 0x23,
+    0xDF, 0x86, 0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xE0, 0x7F, 0x1F, 0x01, 0xF8, 0x7F,
+    0x8E, 0x00, 0xFE, 0x7F, 0xCE, 0x78, 0x7E, 0x3F, 0xC6, 0x7C, 0x7E, 0x3F,
+    0xE6, 0x7C, 0x3E, 0x3F, 0xC6, 0x7E, 0x3E, 0x7F, 0x8E, 0x7E, 0x1C, 0x7F,
+    0x1E, 0x0F, 0x00, 0x7F, 0x3E, 0x0F, 0x80, 0xFF, 0xFF, 0x1F, 0xC3, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xEF, 0x9F, 0xC3, 0x83, 0x8F, 0x81, 0xE3, 0xC7, 0x90, 0xF3,
+    0xE3, 0x38, 0xF3, 0xF3, 0x3C, 0x73, 0xC3, 0x3C, 0x73, 0x8F, 0x1E, 0x23,
+    0x9F, 0x86, 0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0x3E, 0x7F, 0xFF, 0x7F, 0x1E, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F,
+    0xC6, 0x00, 0x00, 0x7F, 0xE6, 0x00, 0x00, 0x7F, 0xC6, 0x00, 0x00, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0x1E, 0x7F, 0xFE, 0x7F, 0x3E, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x07,
+    0xF0, 0x00, 0x07, 0xFF, 0x3F, 0xC7, 0xFF, 0x3F, 0xE7, 0x03, 0x3F, 0xE7,
+    0x07, 0x3F, 0xE7, 0xFF, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x3F, 0xFE, 0x3F, 0xC3, 0x7F, 0xFE, 0x3F, 0x83, 0xFF, 0xFF, 0x3F,
+    0x39, 0xFF, 0xFF, 0x3F, 0x39, 0xFF, 0xFF, 0x3F, 0x91, 0xFF, 0xFF, 0x3F,
+    0x83, 0xFF, 0xFF, 0x3F, 0xEF, 0x3F, 0xFE, 0x3F, 0xFF, 0x3F, 0xF8, 0x7F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xC3, 0xFF, 0xE3, 0x81, 0xFF, 0xF3, 0xB9, 0xFF, 0xF3,
+    0xB9, 0xFF, 0xF3, 0x81, 0xBF, 0xF3, 0x83, 0x9F, 0xE7, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0x170 'Ű'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF3, 0x3F, 0xFE, 0x3F, 0xE3, 0x7F, 0xFE, 0x3F, 0xE7, 0xFF, 0xFF, 0x3F,
+    0xC7, 0xFF, 0xFF, 0x3F, 0x8F, 0xFF, 0xFF, 0x3F, 0xDF, 0xFF, 0xFF, 0x3F,
+    0xF3, 0xFF, 0xFF, 0x3F, 0xE3, 0x3F, 0xFE, 0x3F, 0xC7, 0x3F, 0xF8, 0x7F,
+    0x87, 0x00, 0x00, 0x7F, 0x8F, 0x00, 0x01, 0xFF, 0xDF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xF1, 0xFF, 0xE3, 0xC3, 0xFF, 0xF3, 0x87, 0xFF, 0xF3,
+    0xCF, 0xFF, 0xF3, 0xFB, 0xBF, 0xF3, 0xE1, 0x9F, 0xE7, 0x83, 0x80, 0x07,
+    0x8F, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0x178 'Ÿ'
+    0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
+    0x9C, 0x0F, 0xFF, 0x0C, 0x07, 0xFE, 0x1C, 0xC1, 0xFC, 0x9D, 0xF0, 0x7C,
+    0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x9F, 0xF8, 0x00, 0x0D, 0xE1, 0xFC,
+    0x1C, 0x87, 0xFC, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0x7F, 0xFE, 0x0F, 0xF8, 0x7F,
+    0xFE, 0x1F, 0xE0, 0x7F, 0xFE, 0x7F, 0xC0, 0x7F, 0xF6, 0x7F, 0x86, 0x7F,
+    0xE6, 0x7E, 0x0E, 0x7F, 0xC6, 0x7C, 0x3E, 0x7F, 0xCE, 0x70, 0x7E, 0x7F,
+    0x8E, 0x61, 0xFE, 0x7F, 0x1E, 0x03, 0xFE, 0x7F, 0xFE, 0x07, 0xFE, 0x7F,
+    0xFE, 0x1F, 0xF8, 0x7F, 0xFE, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF3, 0xFF, 0x87, 0xC3, 0xFF, 0x9F, 0x83,
+    0xFF, 0x9F, 0x03, 0xFB, 0x9C, 0x33, 0xF3, 0x98, 0x73, 0xC3, 0x90, 0xF3,
+    0x87, 0x81, 0xF3, 0x8F, 0x87, 0xF3, 0xFF, 0x8F, 0xC3, 0xFF, 0x9F, 0x83,
+    0xFF, 0xFF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0x7F, 0xFE, 0x0F, 0xF8, 0x7F,
+    0xFE, 0x1F, 0xE0, 0x7F, 0xFE, 0x7F, 0xC0, 0x7F, 0xFE, 0x7F, 0x86, 0x7F,
+    0x8E, 0x7E, 0x0E, 0x7F, 0x8E, 0x7C, 0x3E, 0x7F, 0x8E, 0x70, 0x7E, 0x7F,
+    0xDE, 0x61, 0xFE, 0x7F, 0xFE, 0x03, 0xFE, 0x7F, 0xFE, 0x07, 0xFE, 0x7F,
+    0xFE, 0x1F, 0xF8, 0x7F, 0xFE, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xCF, 0xFE, 0x1F, 0x0F, 0xFE, 0x7E, 0x0F,
+    0xFE, 0x7C, 0x0F, 0x8E, 0x70, 0xCF, 0x0E, 0x61, 0xCF, 0x0E, 0x43, 0xCF,
+    0xFE, 0x07, 0xCF, 0xFE, 0x1F, 0xCF, 0xFE, 0x3F, 0x0F, 0xFE, 0x7E, 0x0F,
+    0xFF, 0xFF, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0x7F, 0xFE, 0x0F, 0xF8, 0x7F,
+    0x3E, 0x1F, 0xE0, 0x7F, 0x1E, 0x7F, 0xC0, 0x7F, 0x8E, 0x7F, 0x86, 0x7F,
+    0xC6, 0x7E, 0x0E, 0x7F, 0xE6, 0x7C, 0x3E, 0x7F, 0xC6, 0x70, 0x7E, 0x7F,
+    0x8E, 0x61, 0xFE, 0x7F, 0x1E, 0x03, 0xFE, 0x7F, 0x3E, 0x07, 0xFE, 0x7F,
+    0xFE, 0x1F, 0xF8, 0x7F, 0xFE, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF3, 0xFF, 0x87, 0xC3, 0x8F, 0x9F, 0x83,
+    0xC7, 0x9F, 0x03, 0xE3, 0x9C, 0x33, 0xF3, 0x98, 0x73, 0xE3, 0x90, 0xF3,
+    0xC7, 0x81, 0xF3, 0x8F, 0x87, 0xF3, 0xBF, 0x8F, 0xC3, 0xFF, 0x9F, 0x83,
+    0xFF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0x9F, 0xFB, 0x9E, 0x03, 0x80, 0x03,
+    0x80, 0x0F, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x9E, 0x1F, 0x80, 0x03,
+    0x80, 0x03, 0x9F, 0xE3, 0x1F, 0xF3, 0x1F, 0xF3, 0xFF, 0xF7,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFC, 0x1F, 0x9F, 0xFC, 0x1F, 0x9F, 0x3F, 0x1F, 0x9C, 0x1F, 0x9F,
+    0x90, 0x1F, 0x8F, 0x81, 0x9F, 0x8F, 0x87, 0x8F, 0x9F, 0xCF, 0xC7, 0x1F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0xFF,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0xF0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x9E, 0xFF, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201B '‛'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xF0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x9E, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xE0, 0xFF, 0x80, 0x7F, 0x9E, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0x80, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x7F, 0x80, 0xFF, 0x80, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x201F '‟'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF,
+    0x81, 0xFF, 0x80, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0xFD, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF,
+    0xFD, 0xFD, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xFD, 0xFD, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xC7, 0x83, 0x83, 0x83, 0x83, 0xEF,
+    // 0x2026 '…'
+    0xDF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xDF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xCC, 0x7F, 0x9F, 0x3F,
+    0xBF, 0xBF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xBF, 0x9F, 0x3F, 0x8E, 0x7F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF,
+    0xFB, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x0F, 0x87, 0x8F, 0x9F, 0xC7, 0x9F, 0xE7,
+    0x9F, 0xE7, 0x9F, 0xCF, 0x80, 0x0F, 0xC0, 0x1F, 0xF0, 0x7F,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xC7, 0x3F,
+    0x87, 0x3F, 0x80, 0x07, 0x80, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0xE7, 0x81, 0xE7, 0x99, 0xC7, 0x99, 0xCF,
+    0x98, 0x0F, 0x9C, 0x1F, 0xFF, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x0F, 0xC1, 0xC7, 0x89, 0xE7, 0x99, 0xE7,
+    0x99, 0xC7, 0xB8, 0x0F, 0xBC, 0x1F, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0x87, 0xFF, 0x8F, 0xFF, 0x9F, 0x87, 0x9E, 0x07, 0x98, 0x3F, 0x81, 0xFF,
+    0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xFF, 0xC6, 0x0F, 0x82, 0x0F, 0x90, 0xE7, 0xB9, 0xE7, 0xB8, 0xE7,
+    0x90, 0x4F, 0x82, 0x0F, 0xC6, 0x1F, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xC1, 0xEF, 0x80, 0xE7, 0x9C, 0xE7, 0x9C, 0xCF, 0x9E, 0x0F,
+    0x8C, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x0F, 0x87, 0x8F, 0x9F, 0xC7, 0x9F, 0xE7,
+    0x9F, 0xE7, 0x9F, 0xCF, 0x80, 0x0F, 0xC0, 0x1F, 0xF0, 0x7F,
+    // 0x2081 '₁'
+    0xDF, 0xFF, 0xDF, 0xEF, 0x9F, 0xEF, 0x80, 0x0F, 0x80, 0x0F, 0xFF, 0xCF,
+    0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xC7, 0xCF, 0x87, 0x8F, 0x9F, 0x0F, 0x9E, 0x0F, 0x9C, 0x4F,
+    0x80, 0xCF, 0x81, 0xCF, 0xC7, 0xCF, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xFF, 0xCF, 0xE7, 0x8D, 0xE7, 0x9C, 0xE7, 0xB9, 0xE7, 0x98, 0xCF,
+    0x80, 0x0F, 0x84, 0x1F, 0xFF, 0x3F,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xC7, 0x3F,
+    0x87, 0x1F, 0x80, 0x07, 0x80, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x81, 0xE7, 0x81, 0xE7, 0x99, 0xE7, 0x99, 0xCF,
+    0x98, 0x0F, 0x9C, 0x1F, 0xFF, 0xFF,
+    // 0x2086 '₆'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x0F, 0xC1, 0xC7, 0x89, 0xE7, 0x99, 0xE7,
+    0x98, 0xC7, 0xBC, 0x0F, 0xBC, 0x1F, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0x87, 0xFF, 0x87, 0xFF, 0x9F, 0x87, 0x9E, 0x07, 0x98, 0x3F, 0x81, 0xFF,
+    0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0xFF, 0xC7, 0x0F, 0x82, 0x0F, 0x90, 0xE7, 0xB8, 0xE7, 0xB8, 0xE7,
+    0x90, 0x47, 0x82, 0x0F, 0xC7, 0x1F, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xC1, 0xE7, 0x80, 0xE7, 0x9C, 0xE7, 0x9C, 0x47, 0x9E, 0x0F,
+    0x8E, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AC '€'
+    0xFF, 0xEF, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x27, 0xFF, 0xFE, 0x01, 0xFF,
+    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE3, 0x26, 0x1F, 0xC7, 0x27, 0x1F,
+    0x8F, 0x27, 0x9F, 0x9F, 0x27, 0x9F, 0x9F, 0x2F, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x83, 0xFF, 0x9F, 0x83, 0xFF, 0x3F, 0xDF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2122 '™'
+    0x8F, 0xFF, 0x9F, 0xFF, 0xBF, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xBF, 0x3F,
+    0x9F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xBF, 0x3F, 0x80, 0x3F, 0x87, 0x3F,
+    0xC3, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xC3, 0xFF, 0x83, 0x3F, 0x80, 0x3F,
+    0xBF, 0x3F, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+    0x0F, 0xBF, 0xDF, 0x9F, 0x1F, 0xDF, 0xFE, 0x33, 0x9F, 0xFE, 0x73, 0x9F,
+    0xFE, 0x73, 0x9F, 0xFE, 0x01, 0x1F, 0xFF, 0x08, 0x3F, 0xFF, 0x9C, 0x7F,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xC7, 0x87, 0xFF, 0x9F, 0x07, 0xFF,
+    0x9F, 0x27, 0xFF, 0x9C, 0x67, 0xFF, 0x80, 0xE7, 0xFF, 0xC1, 0xE7, 0xEF,
+    0xE3, 0xE7, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xFF, 0x87, 0xBF, 0xDF, 0x1F, 0x1F, 0xDF, 0xFE, 0x33, 0x9F,
+    0xFE, 0x73, 0x9F, 0xFE, 0x73, 0x9F, 0xFE, 0x01, 0x1F, 0xFF, 0x08, 0x3F,
+    0xFF, 0x9C, 0x7F,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xEF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0x87, 0xDE, 0x3F, 0x1F, 0x04, 0x1F, 0xFF, 0x01, 0x9F, 0xFE, 0x73, 0xDF,
+    0xFE, 0x73, 0xDF, 0xFE, 0x61, 0x9F, 0xFF, 0x00, 0x1F, 0xFF, 0x0C, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0x8D, 0xE7, 0xFF, 0x9C, 0xE7, 0xFF,
+    0x9C, 0xE7, 0xFF, 0x98, 0xC7, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0x1F, 0xCF,
+    0xFF, 0x3F, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x0F, 0xDE, 0x3F, 0xBF, 0x04, 0x1F, 0xFF, 0x01, 0x9F,
+    0xFE, 0x73, 0xDF, 0xFE, 0x73, 0xDF, 0xFE, 0x61, 0x9F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x0C, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x81, 0xE7, 0xFF, 0x81, 0xE7, 0xFF,
+    0x99, 0xE7, 0xFF, 0x98, 0xC7, 0xFF, 0x9C, 0x0F, 0xEF, 0x9C, 0x1F, 0x8F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x0F, 0xDE, 0x3F, 0xBF, 0x04, 0x1F, 0xFF, 0x01, 0x9F,
+    0xFE, 0x73, 0xDF, 0xFE, 0x73, 0xDF, 0xFE, 0x61, 0x9F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x0C, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x215E '⅞'
+    0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0x9E, 0x07, 0xFF,
+    0x98, 0x3F, 0xEF, 0x90, 0xFF, 0x8F, 0x83, 0xFF, 0x0F, 0x8F, 0xFC, 0x3F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xBF, 0xDE, 0x3F, 0xFF, 0x04, 0x1F, 0xFF, 0x01, 0x9F, 0xFE, 0x73, 0xDF,
+    0xFE, 0x73, 0xDF, 0xFE, 0x61, 0x9F, 0xFF, 0x00, 0x1F, 0xFF, 0x0C, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0x2190 '←'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xC0, 0x7F, 0x89, 0x1F, 0x99, 0x9F,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x9F, 0x89, 0x1F,
+    0xC0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x89, 0x1F, 0xD9, 0xBF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xD9, 0x9F, 0x89, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xE3, 0xF1, 0xFF, 0xC7, 0xF8, 0xFF,
+    0xCF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xFC, 0xFF,
+    0xC7, 0xF8, 0xFF, 0xE3, 0xF1, 0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE6, 0x7F, 0xC6, 0x1F, 0x86, 0x1F,
+    0xA6, 0x5F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xE0, 0x01, 0xC0, 0x01, 0x9F, 0xFF,
+    0x9F, 0xFF, 0xC0, 0x01, 0xE0, 0x01, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x5F, 0x86, 0x1F, 0xC6, 0x1F,
+    0xE6, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x80, 0x07, 0x80, 0x03, 0xFF, 0xF9,
+    0xFF, 0xF9, 0x80, 0x03, 0x80, 0x07, 0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x86, 0x1F, 0x86, 0x1F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0x86, 0x1F, 0x86, 0x1F,
+    0xC6, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xEF, 0xC0, 0x07, 0xCF, 0x8F, 0xE7,
+    0x9F, 0x1F, 0xE7, 0x9F, 0x3F, 0xE7, 0x9F, 0x3F, 0xE7, 0x9F, 0x3F, 0xCF,
+    0x8F, 0x3F, 0x1F, 0xC3, 0x10, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0x81, 0x9F, 0xFC, 0x0F, 0x9F, 0xF0, 0x3F, 0x9F, 0xC1, 0xFF, 0x9F,
+    0x87, 0xFF, 0x9F, 0x81, 0xFF, 0x9F, 0xC0, 0x3F, 0x9F, 0xF0, 0x07, 0x9F,
+    0xFE, 0x00, 0x9F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0x220F '∏'
+    0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9, 0xBF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF1, 0x87, 0xFF, 0xE1, 0x83, 0xFF, 0x81,
+    0x81, 0xFF, 0x09, 0x90, 0x7C, 0x39, 0x98, 0x38, 0x79, 0x9E, 0x10, 0xF9,
+    0x9F, 0x03, 0xF9, 0x9F, 0x87, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF1,
+    0x9F, 0xFF, 0xF1, 0x83, 0xFF, 0xE1, 0x83, 0xFF, 0x81, 0xFF, 0xFF, 0xCF,
+    // 0x221A '√'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF,
+    0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF3, 0xFF, 0xC0, 0xFF, 0x8C, 0x7F, 0x9E, 0x7F, 0x3E, 0x7F, 0x9E, 0x7F,
+    0x8C, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0xC8, 0xFF, 0x9C, 0x7F, 0x9E, 0x7F,
+    0x1E, 0x7F, 0x9C, 0x7F, 0x80, 0xFF, 0xC1, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xE6, 0x1F, 0xE6, 0x1F, 0xE6, 0x3F, 0xE4, 0x7F,
+    0xE0, 0x7F, 0xE2, 0x7F, 0x86, 0x7F, 0x86, 0x7F, 0xE6, 0x7F, 0xE7, 0x7F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xF9, 0xFC, 0xF8, 0xFC, 0xF0, 0xFC, 0xF2, 0x7C, 0xE6, 0x3C,
+    0xE7, 0x3C, 0xCF, 0x1C, 0xCF, 0x9C, 0x9F, 0x8C, 0x9F, 0xCC, 0xFF, 0xFC,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0x9F, 0xCC, 0x8F, 0x8C, 0xCF, 0x9C, 0xC7, 0x9C, 0xE7, 0x3C,
+    0xE3, 0x3C, 0xF2, 0x7C, 0xF0, 0x7C, 0xF8, 0xFC, 0xF8, 0xFC, 0xFD, 0xFC,
+    // 0x2500 '─'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2502 '│'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x250C '┌'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2514 '└'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x251C '├'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x252C '┬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x253C '┼'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2550 '═'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2551 '║'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255A '╚'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255D '╝'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x256C '╬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F
+};
+
+
+const uint8_t Bookerly26BitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0xE6, 0x77, 0x80, 0x02, 0x0F, 0x06, 0x02, 0x0F, 0x00, 0x00, 0x67,
+    // 0x22 '"'
+    0x38, 0x7F, 0x00, 0x7F, 0x61, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x7F,
+    0x01, 0x7F, 0x00, 0x7F,
+    // 0x23 '#'
+    0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x21, 0x7F, 0x00, 0x24, 0x7F,
+    0x01, 0x42, 0x7F, 0x18, 0x08, 0x7F, 0x82, 0xA0, 0x7F, 0x20, 0x20, 0x7F,
+    0x00, 0x26, 0x7F, 0x00, 0x40, 0x7F, 0x02, 0x0C, 0x7F, 0x20, 0xE0, 0x7F,
+    0x08, 0x20, 0x7F, 0xC0, 0x20, 0x7F, 0x00, 0x30, 0x7F, 0x08, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0xC0, 0x3F, 0x03, 0x60, 0x00, 0x3F, 0x00, 0x11, 0x00, 0x3F,
+    0x08, 0x48, 0x00, 0x3F, 0x0A, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x20, 0x3F,
+    0x00, 0x00, 0x03, 0xBF, 0x61, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x28, 0x3F,
+    0x0B, 0x01, 0x48, 0x3F, 0x08, 0x04, 0x00, 0x3F, 0x04, 0x80, 0x60, 0x3F,
+    // 0x25 '%'
+    0x04, 0x80, 0x07, 0x10, 0x00, 0x07, 0x03, 0x10, 0x07, 0x40, 0x00, 0x07,
+    0x20, 0x20, 0x07, 0x20, 0x20, 0x37, 0x10, 0x10, 0x47, 0x47, 0x00, 0x27,
+    0x00, 0x44, 0x47, 0x09, 0x08, 0x07, 0x00, 0x00, 0x07, 0x00, 0x90, 0x07,
+    0x01, 0x20, 0x07, 0x00, 0x07, 0x07, 0x02, 0x20, 0x07, 0x44, 0x00, 0x27,
+    0x00, 0x90, 0x87, 0x40, 0x00, 0x17, 0x00, 0x80, 0x57, 0x00, 0x00, 0x07,
+    0x00, 0x0B, 0x07, 0x00, 0x40, 0x07, 0x00, 0x15, 0x07,
+    // 0x26 '&'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x1D, 0x81, 0x2F,
+    0x40, 0x20, 0x8F, 0x0C, 0x10, 0x1F, 0x01, 0x80, 0x1F, 0x80, 0x24, 0x1F,
+    0x01, 0x10, 0x1F, 0x85, 0x00, 0x4F, 0x80, 0x04, 0x8F, 0x00, 0x82, 0x0F,
+    0x00, 0xA2, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x80, 0x1F, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x27 '''
+    0x38, 0x7F, 0x00, 0x7F, 0x61, 0x7F,
+    // 0x28 '('
+    0x00, 0x5F, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x3F, 0x04, 0x1E, 0x04, 0x3F,
+    0x01, 0x80, 0x22, 0x3F, 0x20, 0x00, 0x19, 0x3F, 0x40, 0x00, 0x00, 0xBF,
+    0x20, 0x00, 0x02, 0x7F, 0x40, 0x00, 0x00, 0x3F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x04, 0x3F, 0x03, 0x00, 0x32, 0x3F, 0x10, 0x3E, 0x80, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x80, 0x80, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    // 0x2A '*'
+    0x00, 0x7F, 0x14, 0x7F, 0x51, 0x7F, 0x0A, 0x7F, 0x45, 0x7F, 0x94, 0x7F,
+    0x23, 0x7F, 0x04, 0x7F, 0x00, 0x7F,
+    // 0x2B '+'
+    0x06, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x80, 0x1F,
+    0x80, 0x1F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    // 0x2C ','
+    0x00, 0x7F, 0x01, 0xFF, 0x34, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x60, 0x7F,
+    // 0x2D '-'
+    0x3F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xDF,
+    // 0x2E '.'
+    0x27, 0x47, 0x0F, 0x07, 0x27,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x18, 0xC7, 0x00, 0x42, 0x07, 0x00, 0x00, 0x07, 0x0C, 0x60, 0x07,
+    0x31, 0x80, 0x07, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x30 '0'
+    0x02, 0xDA, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x4F, 0x21, 0x04, 0x0F,
+    0x48, 0x00, 0x8F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    0x10, 0x00, 0x0F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x2F, 0x20, 0x40, 0x0F,
+    0x00, 0x00, 0x8F, 0x02, 0x0A, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x31 '1'
+    0x18, 0x00, 0x3F, 0x08, 0x00, 0x1F, 0x08, 0x00, 0x5F, 0x28, 0x00, 0x1F,
+    0x07, 0xFF, 0x9F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F,
+    // 0x32 '2'
+    0x00, 0x00, 0x1F, 0x10, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x0A, 0x02, 0x1F,
+    0x10, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x12, 0x1F, 0x00, 0x20, 0x1F,
+    0x10, 0x80, 0x1F, 0x41, 0x10, 0x1F, 0x40, 0x20, 0x1F, 0x20, 0x00, 0x1F,
+    0x0E, 0x00, 0x3F, 0x00, 0x00, 0x1F,
+    // 0x33 '3'
+    0x00, 0x00, 0x6F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x00, 0x20, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x10, 0x0F,
+    0x40, 0x42, 0x0F, 0x00, 0x40, 0x4F, 0x04, 0x01, 0x0F, 0x00, 0x0C, 0x0F,
+    // 0x34 '4'
+    0x00, 0x00, 0x0F, 0x00, 0x12, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x42, 0x0F,
+    0x01, 0x1A, 0x0F, 0x02, 0x4A, 0x0F, 0x08, 0x0A, 0x0F, 0x01, 0x0A, 0x0F,
+    0x24, 0x0A, 0x0F, 0x07, 0xF1, 0xFF, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x00, 0x0A, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x0A, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x80, 0xBF,
+    0xA4, 0x80, 0x3F, 0x80, 0x01, 0x1F, 0x80, 0x41, 0x5F, 0x82, 0x00, 0x5F,
+    0x80, 0x18, 0x9F, 0x81, 0x00, 0x1F, 0x80, 0x80, 0x1F, 0x80, 0x10, 0x1F,
+    // 0x36 '6'
+    0x00, 0x00, 0x0F, 0x00, 0x42, 0x0F, 0x02, 0x00, 0x4F, 0x08, 0x10, 0x2F,
+    0x11, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x20, 0x00, 0x1F, 0x48, 0x00, 0x5F,
+    0x50, 0x20, 0x1F, 0x10, 0x90, 0x0F, 0x00, 0x8E, 0x0F, 0x20, 0x00, 0x4F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x37 '7'
+    0x38, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0xA0, 0x01, 0xDF,
+    0xA0, 0x18, 0x3F, 0xA0, 0x40, 0x7F, 0xA1, 0x02, 0x1F, 0xA2, 0x30, 0x1F,
+    0xA0, 0xC0, 0x1F, 0xA1, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x08, 0x8F, 0x01, 0x00, 0x0F, 0x20, 0x22, 0x2F, 0x4A, 0x48, 0x8F,
+    0x41, 0x10, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x10, 0x1F,
+    0x50, 0x40, 0x0F, 0x40, 0x85, 0x0F, 0x21, 0x00, 0x4F, 0x1E, 0x08, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x18, 0x40, 0x4F, 0x00, 0x00, 0x1F, 0x05, 0x10, 0x5F,
+    0x50, 0x40, 0x1F, 0x10, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x01, 0x0F,
+    0x50, 0x08, 0x0F, 0x04, 0x28, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x06, 0x0F,
+    0x0C, 0x20, 0x0F,
+    // 0x3A ':'
+    0x40, 0x13, 0x10, 0x23, 0x00, 0x07, 0x90, 0x03, 0x60, 0x13,
+    // 0x3B ';'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0x1A, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x02, 0x3F, 0xC0, 0x30, 0x3F,
+    // 0x3C '<'
+    0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x8F, 0x00, 0x4F,
+    0x00, 0x4F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x1F, 0xA0, 0x1F, 0x00, 0x2F,
+    // 0x3D '='
+    0xC5, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x09,
+    // 0x3E '>'
+    0x00, 0x0F, 0xA0, 0x0F, 0x10, 0x4F, 0x10, 0x0F, 0x08, 0x0F, 0x08, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x02, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x04, 0x0F,
+    // 0x3F '?'
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x80, 0x70, 0x2F, 0x00, 0x84, 0x9F,
+    0x80, 0x14, 0x1F, 0x00, 0x80, 0x2F, 0x10, 0x20, 0x0F, 0x4D, 0x20, 0x0F,
+    0x20, 0x40, 0x0F, 0x05, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x1D, 0x01, 0x02, 0x00, 0x41, 0x04, 0x3C, 0x11, 0x01, 0x80, 0x09,
+    0x00, 0x00, 0x01, 0x28, 0x00, 0x01, 0x40, 0x00, 0x11, 0x51, 0x81, 0x03,
+    0x02, 0x10, 0x81, 0x82, 0x84, 0x0B, 0x21, 0x09, 0x03, 0xA5, 0x21, 0x03,
+    0x85, 0x22, 0x83, 0xA0, 0x01, 0x03, 0x20, 0x00, 0x09, 0x80, 0xFE, 0x03,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x95, 0x40, 0x00, 0x09, 0x06, 0x04, 0x01,
+    0x00, 0xE0, 0x01, 0x08, 0x04, 0x01, 0x01, 0x10, 0x01,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x30, 0x9F, 0x00, 0xC0, 0x5F, 0x00, 0x04, 0x7F, 0x18, 0x04, 0x1F,
+    0x40, 0x04, 0x1F, 0x00, 0x04, 0x1F, 0x81, 0x04, 0x1F, 0x60, 0x04, 0x1F,
+    0x04, 0x04, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x60, 0x1F, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x40, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xA0, 0x20, 0x0F, 0x80, 0x80, 0x0F, 0x80, 0x80, 0x0F,
+    0xA0, 0xA0, 0x0F, 0x00, 0x80, 0x8F, 0x48, 0x10, 0x2F, 0x00, 0xC8, 0x2F,
+    0x30, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x0F,
+    // 0x43 'C'
+    0x01, 0x78, 0x0F, 0x04, 0x01, 0x0F, 0x10, 0x00, 0x4F, 0x23, 0x0C, 0x0F,
+    0x08, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x9F,
+    0xA0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x18, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x3C, 0x00, 0xAF, 0x00, 0x00, 0x4F,
+    // 0x44 'D'
+    0x40, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0xAF, 0x40, 0x00, 0x2F,
+    0x40, 0x01, 0x0F, 0x06, 0x06, 0x4F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x10, 0xA0, 0x1F,
+    0x00, 0x42, 0x1F, 0x7C, 0x00, 0x1F, 0x00, 0x03, 0x9F,
+    // 0x46 'F'
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0xDF, 0x9F, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x60, 0x1F,
+    0x04, 0x00, 0x1F,
+    // 0x47 'G'
+    0x01, 0x78, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x4F, 0x03, 0x0C, 0x0F,
+    0x04, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0xA0, 0x20, 0x1F, 0xA0, 0x08, 0x1F, 0x80, 0x08, 0x1F,
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x38, 0x07, 0xEF,
+    0x00, 0x20, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x00, 0x20, 0x5F, 0x00, 0x20, 0x5F,
+    0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x40, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x5F,
+    // 0x49 'I'
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x7F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x21, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x1F, 0xFF, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0xBF, 0x8F, 0x00, 0x10, 0x4F, 0x40, 0x00, 0x4F,
+    0x02, 0xA0, 0x0F, 0x04, 0x10, 0x0F, 0x40, 0x08, 0x0F, 0x02, 0x04, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x8F,
+    0x20, 0x00, 0x1F, 0x40, 0x00, 0x2F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0x9F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0x00, 0x01, 0x9F, 0x06, 0x60, 0x1F,
+    0x00, 0x00, 0x9F, 0x0C, 0x60, 0x5F, 0x02, 0x00, 0x1F, 0x00, 0x40, 0x1F,
+    0x18, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x40, 0x9F, 0x00, 0x04, 0x1F,
+    0x00, 0x20, 0x1F, 0x00, 0x06, 0x1F, 0x00, 0x30, 0x1F, 0x01, 0x80, 0x3F,
+    0x08, 0x00, 0x5F, 0x06, 0x30, 0x5F, 0x00, 0x00, 0x1F, 0x06, 0x00, 0x1F,
+    0x00, 0x0C, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x20, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x07, 0xFF, 0x8F, 0x40, 0x00, 0x4F, 0x10, 0x00, 0x4F, 0x00, 0x80, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x20, 0x0F,
+    0x20, 0x10, 0x0F, 0x20, 0x04, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x00, 0xFC, 0x0F, 0x0C, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xF4, 0x0F,
+    0x04, 0x02, 0x0F, 0x40, 0x00, 0x0F, 0x10, 0x00, 0x9F, 0x80, 0x00, 0x1F,
+    0xA0, 0x00, 0x4F, 0x20, 0x00, 0x4F, 0xA0, 0x00, 0x5F, 0x80, 0x00, 0x0F,
+    0x10, 0x00, 0xAF, 0x48, 0x01, 0x2F, 0x01, 0x08, 0x4F, 0x20, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x04, 0x0C, 0x0F,
+    // 0x50 'P'
+    0x40, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xBF, 0xCF, 0x9F, 0x80, 0x00, 0x5F, 0xA0, 0x00, 0x1F,
+    0xA0, 0x50, 0x1F, 0x00, 0x40, 0x1F, 0x08, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x1E, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x00, 0xFC, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x20, 0xF0, 0x40, 0x7F, 0x04, 0x02, 0x20, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x10, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x48, 0x7F,
+    0xA0, 0x00, 0x40, 0x7F, 0x80, 0x00, 0x14, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x08, 0x01, 0x01, 0x7F, 0x03, 0x08, 0x05, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x08, 0x01, 0x04, 0x7F, 0x04, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x52 'R'
+    0x40, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0xA0, 0x40, 0x0F, 0x80, 0x40, 0x4F, 0xA0, 0x00, 0x6F,
+    0x80, 0x44, 0x0F, 0x10, 0xB1, 0x0F, 0x40, 0x20, 0x0F, 0x40, 0x44, 0x4F,
+    0x00, 0x82, 0x0F, 0x05, 0x01, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x00, 0x07, 0xCF, 0x11, 0x04, 0x2F, 0x00, 0x03, 0x0F, 0x08, 0x00, 0x9F,
+    0x10, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0xA0, 0x80, 0x4F, 0xA0, 0x00, 0x1F,
+    0x00, 0x08, 0x8F, 0x08, 0x00, 0x0F, 0x42, 0x20, 0x4F, 0x44, 0x19, 0x8F,
+    // 0x54 'T'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x74, 0x00, 0x1F,
+    // 0x55 'U'
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    0x00, 0x00, 0x4F, 0x1F, 0xFC, 0x0F, 0x00, 0x01, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0xAF, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x8F, 0x1F, 0xFC, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x56 'V'
+    0x60, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x10, 0x00, 0x0F, 0x24, 0x06, 0x0F, 0x20, 0x80, 0xCF,
+    0x00, 0x04, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x00, 0x06, 0x0F, 0x24, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x06, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x57 'W'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x01, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x0A, 0x01, 0x0F, 0x00, 0x80, 0x6F,
+    0x00, 0x0C, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0xC0, 0x0F,
+    0x02, 0x10, 0x0F, 0x00, 0x80, 0x0F, 0x41, 0x00, 0x0F, 0x40, 0x60, 0x0F,
+    0x04, 0x0C, 0x0F, 0x01, 0x81, 0x8F, 0x00, 0x20, 0x2F, 0x00, 0x01, 0x0F,
+    0x00, 0x04, 0x0F, 0x20, 0x50, 0x2F, 0x01, 0x00, 0x0F, 0x10, 0x20, 0x0F,
+    0x01, 0x80, 0x0F, 0x0C, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x5F, 0x11, 0x00, 0x1F, 0x00, 0x60, 0x3F,
+    0x40, 0x08, 0x1F, 0x00, 0x10, 0x1F, 0x02, 0x04, 0x1F, 0x40, 0xA2, 0x5F,
+    0x08, 0x00, 0xDF, 0x02, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    // 0x59 'Y'
+    0x60, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x3F, 0x10, 0x80, 0x5F, 0x28, 0x40, 0x5F, 0x22, 0x0F, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x01, 0x10, 0x1F, 0x24, 0x60, 0x5F,
+    0x38, 0x80, 0x5F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x64, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x08, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0x3F,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x98, 0x00, 0x07, 0xC6, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x8C, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x17, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x07,
+    // 0x5D ']'
+    0xC0, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0xC7, 0x00, 0x17, 0x18, 0x07, 0x03, 0x07, 0x00, 0x07,
+    0x18, 0x07, 0x40, 0x07, 0x00, 0xC7, 0x06, 0x07, 0x00, 0x07, 0x00, 0x37,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x60 '`'
+    0x01, 0x01, 0x01, 0x41, 0x11, 0x0B, 0x01,
+    // 0x61 'a'
+    0x10, 0x39, 0x08, 0x01, 0x40, 0x01, 0x10, 0x13, 0x20, 0x8B, 0x82, 0x0B,
+    0x80, 0x81, 0xB0, 0x85, 0x80, 0x05, 0x40, 0x01, 0x10, 0x13, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x1F, 0xFF, 0xEB,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xA0, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x40, 0x17, 0x01, 0x00, 0x17, 0x01, 0x40, 0x03, 0x00, 0x20, 0x2B,
+    0x01, 0x07, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x43, 0x00, 0x1B, 0x03,
+    // 0x63 'c'
+    0x0C, 0x01, 0x00, 0x01, 0x03, 0x05, 0x10, 0x21, 0xA0, 0x11, 0x20, 0x03,
+    0xA0, 0x03, 0x80, 0x03, 0x08, 0x03, 0x00, 0x01, 0x40, 0x11, 0x00, 0x09,
+    // 0x64 'd'
+    0x00, 0x18, 0x23, 0x00, 0x40, 0x13, 0x00, 0x82, 0x03, 0x00, 0x10, 0x03,
+    0x01, 0x00, 0x27, 0x00, 0x00, 0x07, 0x01, 0x40, 0x17, 0x21, 0x40, 0x03,
+    0x01, 0x00, 0x2B, 0x0F, 0x3F, 0xC3, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07,
+    0x7F, 0xFF, 0xE3, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x65 'e'
+    0x04, 0x11, 0x20, 0x01, 0x00, 0x81, 0x00, 0x21, 0x00, 0x01, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x84, 0x01, 0x00, 0x01, 0x20, 0x15, 0x0A, 0x01,
+    // 0x66 'f'
+    0x00, 0xC0, 0x0F, 0x00, 0x40, 0x17, 0x00, 0x40, 0x17, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x3F, 0xE7, 0x51, 0x40, 0x17, 0x01, 0x40, 0x17,
+    0xA1, 0x40, 0x1F, 0x81, 0x40, 0x07, 0x10, 0x80, 0x07, 0x40, 0x00, 0x07,
+    0x20, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0x87, 0x00, 0x02, 0x27, 0x01, 0x00, 0x17, 0x00, 0x01, 0x97,
+    0x10, 0x70, 0x07, 0x00, 0x50, 0x07, 0x80, 0x40, 0x07, 0x80, 0x00, 0x07,
+    0xA0, 0x40, 0x07, 0x82, 0x00, 0x57, 0x80, 0x80, 0x57, 0x00, 0x02, 0x07,
+    0xB2, 0x08, 0x07, 0x80, 0x00, 0x47, 0xE0, 0x02, 0x07,
+    // 0x68 'h'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x50, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x17, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x40, 0x17, 0x00, 0x30, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x30, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x17,
+    // 0x69 'i'
+    0x01, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x02, 0x80, 0x2F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x11, 0xFF, 0xCF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x80, 0x01, 0x5F, 0x12, 0x7F, 0xF8, 0x5F, 0x10, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x81, 0xFF, 0xF8, 0x1F,
+    // 0x6B 'k'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x50, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0xE3, 0x00, 0x02, 0x03, 0x00, 0x10, 0x8B,
+    0x00, 0xA0, 0x03, 0x01, 0x4A, 0x03, 0x01, 0x00, 0x03, 0x01, 0x20, 0x03,
+    0x01, 0x00, 0x03, 0x01, 0x00, 0x27, 0x01, 0x00, 0x07, 0x00, 0x00, 0x0B,
+    // 0x6C 'l'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x6D 'm'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x03, 0x4F, 0xF3,
+    0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x18, 0x0B,
+    0x00, 0x03, 0x40, 0x03, 0x00, 0x03, 0x50, 0x0B, 0x20, 0x07, 0x00, 0x03,
+    0x80, 0x03, 0x80, 0x0B, 0x08, 0x03, 0x00, 0x03, 0x20, 0x03, 0x00, 0x03,
+    0x00, 0x0B, 0x00, 0x07,
+    // 0x6E 'n'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x03, 0x4F, 0xF3,
+    0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x03, 0xA0, 0x07, 0x80, 0x03,
+    0x80, 0x03, 0x00, 0x03, 0x0F, 0xF3, 0x00, 0x0B, 0x00, 0x03,
+    // 0x6F 'o'
+    0x0C, 0x41, 0x20, 0x01, 0x43, 0x05, 0x10, 0x01, 0xA0, 0x13, 0x20, 0x09,
+    0xA0, 0x01, 0xA0, 0x03, 0xA0, 0x01, 0x80, 0x01, 0x03, 0x85, 0x40, 0x09,
+    0x10, 0x31, 0x07, 0x81,
+    // 0x70 'p'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x0F, 0xF3, 0xCF, 0x40, 0x00, 0x0F, 0xA0, 0x08, 0x1F,
+    0x80, 0x08, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x04, 0x0F, 0x08, 0x04, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x18, 0x80, 0x0F,
+    // 0x71 'q'
+    0x0C, 0x40, 0x0F, 0x20, 0x00, 0x0F, 0x41, 0x04, 0x0F, 0x08, 0x00, 0x0F,
+    0x80, 0x10, 0x0F, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0x80, 0x14, 0x2F, 0x1F, 0xEF, 0xCF, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x7F, 0xFF, 0xCF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x00, 0x07, 0x20, 0x0B, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x03, 0x47, 0xF3,
+    0x08, 0x0B, 0x10, 0x0B, 0x00, 0x03, 0x80, 0x03, 0x90, 0x03, 0x20, 0x03,
+    // 0x73 's'
+    0x00, 0x29, 0x22, 0x01, 0x41, 0x31, 0xA0, 0x03, 0x84, 0x83, 0x84, 0x83,
+    0x80, 0x0B, 0x22, 0x21, 0x81, 0x05, 0x70, 0x89, 0x00, 0x01,
+    // 0x74 't'
+    0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x20, 0x02, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x14, 0x00, 0x7F, 0x14, 0x00, 0x7F, 0x14, 0x01, 0x7F,
+    0x14, 0x00, 0x3F, 0x0C, 0x00, 0xBF, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x20, 0x01, 0x20, 0x01, 0x80, 0x11, 0x00, 0x01, 0x00, 0x01, 0x40, 0x33,
+    0x00, 0x03, 0x00, 0x0B, 0x00, 0x09, 0x60, 0x01, 0x00, 0x15, 0x9F, 0xE9,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09,
+    // 0x76 'v'
+    0x00, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x80, 0x81, 0xA4, 0x31,
+    0x80, 0x01, 0x00, 0x61, 0x00, 0x01, 0x41, 0x8D, 0x80, 0x01, 0xB0, 0x01,
+    0x86, 0x01, 0x98, 0x01, 0xA0, 0x01, 0x00, 0x01,
+    // 0x77 'w'
+    0x00, 0x01, 0xA0, 0x01, 0x98, 0x01, 0x83, 0x01, 0x80, 0x21, 0xAC, 0x01,
+    0x81, 0x01, 0x00, 0x21, 0x00, 0x05, 0x02, 0x31, 0x10, 0x01, 0x82, 0x01,
+    0x41, 0x81, 0x08, 0x31, 0x01, 0x01, 0x00, 0x21, 0x00, 0x41, 0x82, 0x0D,
+    0x98, 0x61, 0x80, 0x01, 0x84, 0x01, 0x80, 0x01, 0x40, 0x01,
+    // 0x78 'x'
+    0x40, 0x03, 0xA0, 0x03, 0xA0, 0x03, 0x90, 0x03, 0x80, 0x43, 0xA2, 0x83,
+    0x89, 0x23, 0x00, 0x03, 0x00, 0x47, 0x4A, 0x1B, 0x84, 0x83, 0x80, 0x03,
+    0x90, 0x13, 0x80, 0x0B, 0x80, 0x03, 0x00, 0x03,
+    // 0x79 'y'
+    0x00, 0x00, 0x37, 0x80, 0x00, 0x07, 0x98, 0x00, 0x47, 0x80, 0x00, 0x47,
+    0x80, 0x00, 0x97, 0xA4, 0x31, 0x07, 0x80, 0x02, 0x27, 0x00, 0x60, 0x87,
+    0x00, 0x03, 0x07, 0x41, 0x88, 0x07, 0x80, 0x00, 0x07, 0xB0, 0x00, 0x07,
+    0x86, 0x00, 0x07, 0x98, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x01, 0x18, 0x11, 0x88, 0x21, 0xA0, 0x41, 0x81, 0x01, 0x80, 0x21,
+    0x84, 0x01, 0x81, 0x01, 0xA0, 0x01, 0x84, 0x01, 0x90, 0x01, 0x00, 0x45,
+    0x00, 0x21,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x3D, 0x10, 0x6C, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x0C, 0x00, 0x0C, 0x3F, 0x00, 0xA0, 0xC0, 0x3F,
+    0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x7D '}'
+    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0xA0, 0xC1, 0x3F, 0x0C, 0x08, 0x0C, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x3D, 0x10, 0x4C, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x27, 0x07, 0xA7, 0x27, 0x87, 0x87, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x07, 0x02, 0x03, 0x87, 0x80, 0x00, 0x07, 0xA2, 0x60, 0x17,
+    0x00, 0x00, 0x07,
+    // 0xA2 '¢'
+    0x00, 0x0C, 0x00, 0x7F, 0x00, 0xC0, 0x00, 0x7F, 0x01, 0x00, 0x40, 0x7F,
+    0x02, 0x3E, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x80, 0x7F,
+    0x79, 0xC1, 0x80, 0x7F, 0x80, 0x00, 0x1F, 0x7F, 0x18, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x04, 0xC0, 0x80, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x02, 0x80, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x2F,
+    0x02, 0x00, 0xAF, 0x00, 0x04, 0x0F, 0x22, 0x40, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x50, 0x60, 0x1F,
+    0x40, 0x00, 0x8F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x37, 0x00, 0x07, 0x55, 0x07, 0x00, 0x27, 0x05, 0x07, 0x00, 0x07,
+    0x40, 0x47, 0x40, 0x47, 0x10, 0x07, 0x49, 0x87, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x47, 0xC0, 0x07,
+    // 0xA5 '¥'
+    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0x89, 0x00, 0x3F,
+    0x85, 0x40, 0x3F, 0x81, 0x40, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x3F, 0x00, 0x40, 0x3F, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0xBF,
+    0xD1, 0x40, 0x3F, 0x85, 0x40, 0x3F, 0x89, 0x90, 0x3F, 0x80, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x0C, 0x80, 0xC7, 0x00, 0x10, 0x07, 0x40, 0x40, 0x07, 0x00, 0x20, 0x0F,
+    0x04, 0x80, 0x0F, 0x82, 0x00, 0x2F, 0x00, 0x02, 0x27, 0x80, 0x01, 0x87,
+    0x00, 0x84, 0x07, 0x50, 0x4C, 0x47, 0x00, 0x01, 0x87, 0x00, 0x00, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x01, 0x08, 0x0F, 0x14, 0x00, 0x8F,
+    0x00, 0x01, 0x4F, 0x00, 0x80, 0x2F, 0x42, 0x04, 0x2F, 0x04, 0x60, 0x0F,
+    0x20, 0x00, 0x1F, 0x82, 0x04, 0x1F, 0x82, 0x00, 0x0F, 0xA1, 0x00, 0x1F,
+    0x00, 0x06, 0x4F, 0x40, 0x00, 0x4F, 0x50, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    // 0xAA 'ª'
+    0x01, 0x0F, 0x10, 0x0F, 0x50, 0x0F, 0x28, 0x0F, 0x84, 0x4F, 0x19, 0x8F,
+    0x40, 0x4F, 0x21, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x9F, 0x48, 0x1F, 0x01, 0x1F,
+    0x40, 0x5F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x04, 0x9F, 0x51, 0x1F,
+    0x80, 0x1F, 0x40, 0x5F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x02, 0x09, 0x30, 0x05, 0x48, 0x2D, 0x47, 0xC1,
+    0x00, 0x03, 0x00, 0xA5, 0x06, 0x47, 0x09, 0xA1, 0x00, 0x41, 0x10, 0x15,
+    0x00, 0x61, 0x00, 0x31, 0x03, 0x81,
+    // 0xB0 '°'
+    0x0C, 0x3F, 0x21, 0x3F, 0x4C, 0xBF, 0x40, 0x3F, 0x20, 0x3F, 0x20, 0x3F,
+    0x50, 0x3F, 0x40, 0xBF, 0x21, 0x3F, 0x00, 0x3F,
+    // 0xB1 '±'
+    0x02, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00,
+    // 0xB2 '²'
+    0x00, 0x07, 0x28, 0x0F, 0x48, 0x0F, 0x20, 0x8F, 0xA1, 0x2F, 0x82, 0xAF,
+    0x81, 0x2F, 0x42, 0x2F, 0x1C, 0x2F, 0x00, 0x37,
+    // 0xB3 '³'
+    0x00, 0x07, 0x50, 0x07, 0x12, 0x0F, 0x85, 0x0F, 0xA5, 0x07, 0x89, 0x0F,
+    0x00, 0x97, 0x00, 0x07, 0x11, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x0F, 0x02, 0xFF,
+    0x00, 0x20, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x0A, 0x0F,
+    0x00, 0x10, 0x0F, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x0C, 0x0F,
+    0x60, 0xC0, 0x0F, 0x00, 0x12, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x08, 0x0F,
+    // 0xB6 '¶'
+    0x04, 0x80, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x1F, 0xFF, 0xF1, 0x20, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xB7 '·'
+    0x4F, 0x1F, 0x0F, 0x9F, 0x6F,
+    // 0xB9 '¹'
+    0x20, 0x17, 0x10, 0x0F, 0x10, 0x2F, 0x00, 0x0F, 0x80, 0x0F, 0x7F, 0xCF,
+    0x00, 0x0F, 0x00, 0x17,
+    // 0xBA 'º'
+    0x0E, 0x07, 0x00, 0x97, 0x0C, 0x0F, 0x20, 0x0F, 0xA0, 0x0F, 0xA0, 0x0F,
+    0x10, 0x4F, 0x40, 0x87, 0x21, 0x07, 0x0C, 0x07,
+    // 0xBB '»'
+    0x40, 0x1F, 0x80, 0x1F, 0x52, 0x5F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F,
+    0x08, 0x1F, 0x80, 0x9F, 0x00, 0x5F, 0x4A, 0x1F, 0x00, 0x9F, 0x01, 0x1F,
+    0x0A, 0x1F,
+    // 0xBC '¼'
+    0x30, 0x08, 0x07, 0x30, 0x08, 0x07, 0x10, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x7F, 0xE8, 0x07, 0x00, 0x18, 0x07, 0x00, 0x18, 0x0F,
+    0x00, 0x01, 0x17, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x90, 0x07, 0x03, 0x20, 0x07, 0x04, 0x00, 0x07, 0x10, 0x01, 0x87,
+    0x08, 0x04, 0x87, 0x90, 0x12, 0x87, 0x00, 0x04, 0x87, 0x00, 0x40, 0x87,
+    0x00, 0x1E, 0xE7, 0x00, 0x00, 0x17, 0x00, 0xFE, 0x77, 0x00, 0x00, 0x87,
+    0x00, 0x01, 0x07,
+    // 0xBD '½'
+    0x30, 0x08, 0x07, 0x30, 0x08, 0x07, 0x10, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x7F, 0xE8, 0x07, 0x00, 0x18, 0x07, 0x00, 0x18, 0x0F,
+    0x00, 0x02, 0x07, 0x00, 0x04, 0x07, 0x00, 0x02, 0x07, 0x00, 0x48, 0x07,
+    0x01, 0xB0, 0x07, 0x02, 0x40, 0x07, 0x08, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x08, 0x20, 0x27, 0x80, 0x80, 0x07, 0x01, 0x61, 0x07, 0x00, 0x02, 0x07,
+    0x01, 0x05, 0x07, 0x00, 0x5A, 0x07, 0x01, 0x04, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x47,
+    // 0xBE '¾'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x11, 0x10, 0x07, 0x01, 0x10, 0x07,
+    0x25, 0x00, 0x07, 0x21, 0x00, 0x07, 0x40, 0xC0, 0x07, 0x02, 0x10, 0x07,
+    0x10, 0x00, 0x0F, 0x00, 0x01, 0x17, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x90, 0x07, 0x03, 0x20, 0x07, 0x04, 0x00, 0x07,
+    0x10, 0x02, 0x07, 0x08, 0x00, 0x87, 0x90, 0x08, 0x87, 0x00, 0x24, 0x87,
+    0x00, 0x00, 0x87, 0x00, 0x90, 0x87, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x87,
+    // 0xBF '¿'
+    0x00, 0x12, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x0A, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x8F, 0x80, 0x90, 0x9F, 0x80, 0x00, 0x8F, 0xE0, 0x00, 0x1F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC2, 0x7F, 0x60, 0x03, 0x01, 0x7F,
+    0x90, 0x00, 0x11, 0xFF, 0x10, 0x60, 0x10, 0x7F, 0x41, 0x00, 0x10, 0x7F,
+    0x20, 0x00, 0x10, 0x7F, 0x0A, 0x04, 0x10, 0x7F, 0x11, 0x80, 0x10, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC2, 0x7F, 0x00, 0x03, 0x01, 0x7F,
+    0x00, 0x00, 0x11, 0xFF, 0x08, 0x60, 0x10, 0x7F, 0x29, 0x00, 0x10, 0x7F,
+    0x08, 0x00, 0x10, 0x7F, 0x42, 0x04, 0x10, 0x7F, 0x91, 0x80, 0x10, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC2, 0x7F, 0x08, 0x03, 0x01, 0x7F,
+    0x00, 0x00, 0x11, 0xFF, 0x40, 0x60, 0x10, 0x7F, 0x81, 0x00, 0x10, 0x7F,
+    0x20, 0x00, 0x10, 0x7F, 0x92, 0x04, 0x10, 0x7F, 0x09, 0x80, 0x10, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x18, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC2, 0x7F, 0x70, 0x03, 0x01, 0x7F,
+    0x08, 0x00, 0x11, 0xFF, 0x80, 0x60, 0x10, 0x7F, 0x01, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x2A, 0x04, 0x10, 0x7F, 0x41, 0x80, 0x10, 0x7F,
+    0x80, 0x10, 0x10, 0x7F, 0x40, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x84, 0x90, 0x06, 0x02, 0x80, 0x00, 0x23, 0x00, 0xC0, 0x20,
+    0x02, 0x00, 0x20, 0x00, 0x00, 0x20, 0x04, 0x08, 0x20, 0x13, 0x00, 0x20,
+    0x80, 0x20, 0x20, 0xE0, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x00, 0x01, 0x80, 0xBF,
+    0x24, 0x00, 0x08, 0xFF, 0x02, 0x30, 0x08, 0x3F, 0x2A, 0x80, 0x08, 0x3F,
+    0x02, 0x00, 0x08, 0x3F, 0xB1, 0x02, 0x08, 0x3F, 0x04, 0xC0, 0x08, 0x3F,
+    0x28, 0x08, 0x08, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x23, 0x5F, 0x00, 0x44, 0x5F,
+    0x00, 0x14, 0x1F, 0x04, 0x04, 0x1F, 0x18, 0x04, 0x3F, 0x04, 0x04, 0x5F,
+    0x18, 0x04, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x1F, 0x08, 0xA0, 0x9F, 0x04, 0x01, 0x1F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x01, 0x78, 0x00, 0x3F, 0x04, 0x01, 0x00, 0x3F, 0x10, 0x00, 0x40, 0x3F,
+    0x23, 0x0C, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x98, 0x7F, 0xA0, 0x00, 0x18, 0x3F,
+    0x80, 0x00, 0x10, 0xBF, 0x80, 0x00, 0x12, 0x3F, 0x18, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x3C, 0x00, 0xA0, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x7E, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x42, 0x80, 0x7F,
+    0x00, 0x01, 0x08, 0x7F, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0E, 0x7F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x7E, 0x7E, 0x7F,
+    0x28, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x00, 0x7F, 0x00, 0x42, 0x80, 0x7F,
+    0x00, 0x01, 0x08, 0x7F, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0E, 0x7F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x40, 0x7E, 0x7E, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x48, 0x00, 0x00, 0x7F, 0x20, 0x02, 0x00, 0x7F, 0x10, 0x42, 0x80, 0x7F,
+    0x00, 0x01, 0x08, 0x7F, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0E, 0x7F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x04, 0x00, 0x40, 0x85, 0x00,
+    0x00, 0x02, 0x10, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1C,
+    // 0xCC 'Ì'
+    0xE0, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x10, 0x7F, 0xFE, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x01, 0x00, 0x01, 0xFF,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x01, 0x7F, 0x08, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x48, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x01, 0x00, 0x01, 0xFF,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x48, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x7F, 0xFE, 0x7F, 0x08, 0x00, 0x01, 0x7F, 0x01, 0x00, 0x01, 0xFF,
+    0x08, 0x00, 0x00, 0x7F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x91, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFC, 0x80, 0x00, 0x02,
+    0x12, 0x00, 0x03, 0x60, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x60, 0x0F, 0x40, 0x20, 0x4F, 0x20, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x20, 0x0F,
+    0xA0, 0x20, 0x0F, 0x80, 0x20, 0x0F, 0x00, 0x60, 0x0F, 0x10, 0x00, 0xAF,
+    0x40, 0x00, 0x2F, 0x40, 0x01, 0x0F, 0x06, 0x06, 0x4F, 0x00, 0xF0, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x80, 0x01, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFE, 0x3F, 0x11, 0x00, 0x01, 0x3F,
+    0x08, 0x40, 0x01, 0x3F, 0x80, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x20, 0x02, 0x10, 0x3F, 0x40, 0x00, 0x80, 0x3F,
+    0x00, 0x80, 0x40, 0x3F, 0x60, 0x80, 0x10, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x30, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x7F, 0x02, 0x00, 0x00, 0x7F, 0x4A, 0x80, 0x01, 0x3F,
+    0x00, 0x80, 0x01, 0x3F, 0x02, 0x80, 0x01, 0x7F, 0x0A, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0xBF, 0x00, 0x04, 0x21, 0x3F,
+    0x00, 0x80, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x30, 0x3F,
+    // 0xD3 'Ó'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x30, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x7F, 0x12, 0x00, 0x00, 0x7F, 0x0A, 0x80, 0x01, 0x3F,
+    0x08, 0x80, 0x01, 0x3F, 0x42, 0x80, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x3F,
+    0xE0, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0xBF, 0x00, 0x04, 0x21, 0x3F,
+    0x00, 0x80, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x30, 0x3F,
+    // 0xD4 'Ô'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x30, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x11, 0x00, 0x00, 0x3F,
+    0x20, 0x40, 0x02, 0x7F, 0x0A, 0x00, 0x00, 0x7F, 0x92, 0x80, 0x01, 0x3F,
+    0x20, 0x80, 0x01, 0x3F, 0x02, 0x80, 0x01, 0x7F, 0x42, 0x00, 0x00, 0x3F,
+    0x20, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0xBF, 0x00, 0x04, 0x21, 0x3F,
+    0x00, 0x80, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x30, 0x3F,
+    // 0xD5 'Õ'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x30, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    0x98, 0x40, 0x02, 0x7F, 0x82, 0x00, 0x00, 0x7F, 0x12, 0x80, 0x01, 0x3F,
+    0x40, 0x80, 0x01, 0x3F, 0x22, 0x80, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0xBF, 0x21, 0x20, 0x04, 0xBF, 0x00, 0x04, 0x21, 0x3F,
+    0x00, 0x80, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x30, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x07, 0xE0, 0x7F, 0x00, 0x60, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x07, 0xA0, 0x7F, 0x60, 0x20, 0x10, 0x7F, 0x12, 0x00, 0x00, 0x7F,
+    0x80, 0x80, 0x04, 0xFF, 0x84, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x02, 0x7F,
+    0x01, 0x00, 0x02, 0x7F, 0x65, 0x00, 0x02, 0xFF, 0x84, 0x00, 0x00, 0x7F,
+    0x90, 0x80, 0x05, 0x7F, 0x02, 0x40, 0x09, 0x7F, 0x00, 0x08, 0x42, 0x7F,
+    0x01, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x60, 0x7F,
+    // 0xD7 '×'
+    0x40, 0xDF, 0xA0, 0x1F, 0x50, 0x1F, 0x28, 0x1F, 0x10, 0x1F, 0x00, 0x1F,
+    0x04, 0x1F, 0x02, 0x1F, 0x00, 0x1F, 0x80, 0x1F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x00, 0xF8, 0x0F, 0x0C, 0x01, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0xF0, 0x0F, 0x04, 0x00, 0x0F, 0x40, 0x02, 0x0F, 0x10, 0x04, 0x1F,
+    0x80, 0x08, 0x5F, 0xA0, 0x10, 0x4F, 0x20, 0x20, 0x4F, 0xA0, 0x40, 0x5F,
+    0x80, 0x80, 0x0F, 0x11, 0x00, 0xAF, 0x42, 0x01, 0x2F, 0x03, 0x08, 0x4F,
+    0x20, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0xA6, 0x0C, 0x0F, 0x40, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x20, 0x00, 0x04, 0x3F, 0x90, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x09, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x10, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xDA 'Ú'
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x28, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x81, 0x00, 0x00, 0x3F, 0x80, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x10, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xDB 'Û'
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x49, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x02, 0xBF, 0x10, 0x00, 0x10, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x00, 0x7F, 0xF0, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xDC 'Ü'
+    0x01, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x40, 0xFF, 0xE0, 0x7F,
+    0x10, 0x00, 0x08, 0x7F, 0x81, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x12, 0x00, 0x00, 0x7F, 0x81, 0x00, 0x05, 0x7F, 0x60, 0x00, 0x21, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0xFF, 0xE0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x02, 0x04, 0x5F, 0x20, 0x05, 0x1F, 0x02, 0x05, 0x1F,
+    0x02, 0x01, 0x1F, 0x0A, 0x00, 0x1F, 0x00, 0x0A, 0x1F, 0x04, 0x40, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x10, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x0C, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x4B,
+    0x20, 0x10, 0x43, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x18, 0x92, 0x17,
+    0x00, 0x01, 0x13, 0x20, 0x00, 0x4B, 0x0C, 0x04, 0x03, 0x00, 0x00, 0xC3,
+    // 0xE0 'à'
+    0x00, 0x10, 0x39, 0x00, 0x08, 0x01, 0x00, 0x40, 0x01, 0x00, 0x10, 0x13,
+    0x04, 0x20, 0x8B, 0x10, 0x82, 0x0B, 0x02, 0x80, 0x81, 0x00, 0xB0, 0x85,
+    0x00, 0x80, 0x05, 0x00, 0x40, 0x01, 0x00, 0x10, 0x13, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE1 'á'
+    0x00, 0x10, 0x39, 0x00, 0x08, 0x01, 0x00, 0x40, 0x01, 0x00, 0x10, 0x13,
+    0x00, 0x20, 0x8B, 0x12, 0x82, 0x0B, 0x20, 0x80, 0x81, 0x08, 0xB0, 0x85,
+    0x40, 0x80, 0x05, 0x00, 0x40, 0x01, 0x00, 0x10, 0x13, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE2 'â'
+    0x00, 0x20, 0x73, 0x00, 0x10, 0x03, 0x14, 0x80, 0x03, 0x24, 0x20, 0x27,
+    0x88, 0x41, 0x17, 0x81, 0x04, 0x17, 0x91, 0x01, 0x03, 0x41, 0x61, 0x0B,
+    0x01, 0x00, 0x0B, 0x0C, 0x80, 0x03, 0x00, 0x20, 0x27, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xE3 'ã'
+    0x00, 0x40, 0xE7, 0x40, 0x20, 0x07, 0x11, 0x00, 0x07, 0x00, 0x40, 0x4F,
+    0x20, 0x82, 0x2F, 0x82, 0x08, 0x2F, 0x12, 0x02, 0x07, 0x42, 0xC2, 0x17,
+    0x92, 0x00, 0x17, 0xC1, 0x00, 0x07, 0x00, 0x40, 0x4F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xE4 'ä'
+    0x00, 0x40, 0xE7, 0x30, 0x20, 0x07, 0x91, 0x00, 0x07, 0x10, 0x40, 0x4F,
+    0x40, 0x82, 0x2F, 0x02, 0x08, 0x2F, 0x02, 0x02, 0x07, 0x02, 0xC2, 0x17,
+    0x92, 0x00, 0x17, 0x11, 0x00, 0x07, 0x00, 0x40, 0x4F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xE5 'å'
+    0x00, 0x10, 0x39, 0x00, 0x08, 0x01, 0x24, 0x40, 0x01, 0x00, 0x10, 0x13,
+    0x38, 0x20, 0x8B, 0x80, 0x82, 0x0B, 0x84, 0x80, 0x81, 0x00, 0xB0, 0x85,
+    0x28, 0x80, 0x05, 0x00, 0x40, 0x01, 0x00, 0x10, 0x13, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE6 'æ'
+    0x10, 0x39, 0x08, 0x01, 0x40, 0x01, 0x10, 0x13, 0x22, 0x0B, 0x80, 0x8B,
+    0x82, 0x01, 0x32, 0x11, 0x00, 0x21, 0x00, 0x09, 0x44, 0x41, 0x01, 0x01,
+    0x00, 0x13, 0x84, 0x03, 0xA5, 0x03, 0xA1, 0x03, 0x84, 0x01, 0x40, 0x05,
+    0x00, 0x19, 0x00, 0x01,
+    // 0xE7 'ç'
+    0x0C, 0x00, 0x07, 0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x10, 0x20, 0x07,
+    0xA0, 0x10, 0x0F, 0x20, 0x03, 0x1F, 0xA0, 0x03, 0x47, 0x80, 0x02, 0x17,
+    0x08, 0x02, 0x47, 0x00, 0x00, 0x07, 0x40, 0x10, 0x07, 0x00, 0x08, 0x07,
+    // 0xE8 'è'
+    0x00, 0x04, 0x11, 0x00, 0x20, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x21,
+    0x48, 0x00, 0x01, 0x00, 0x80, 0x03, 0x12, 0x80, 0x03, 0x04, 0x80, 0x03,
+    0x00, 0x84, 0x01, 0x00, 0x00, 0x01, 0x00, 0x20, 0x15, 0x00, 0x0A, 0x01,
+    // 0xE9 'é'
+    0x00, 0x04, 0x11, 0x00, 0x20, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x01, 0x02, 0x80, 0x03, 0x20, 0x80, 0x03, 0x00, 0x80, 0x03,
+    0x08, 0x84, 0x01, 0x60, 0x00, 0x01, 0x00, 0x20, 0x15, 0x00, 0x0A, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x08, 0x23, 0x00, 0x40, 0x03, 0x00, 0x01, 0x03, 0x14, 0x00, 0x43,
+    0x08, 0x00, 0x03, 0x01, 0x00, 0x07, 0x81, 0x00, 0x07, 0x91, 0x00, 0x07,
+    0x45, 0x08, 0x03, 0x10, 0x00, 0x03, 0x00, 0x40, 0x2B, 0x00, 0x14, 0x03,
+    // 0xEB 'ë'
+    0x00, 0x10, 0x47, 0x20, 0x80, 0x07, 0x00, 0x02, 0x07, 0x90, 0x00, 0x87,
+    0x10, 0x00, 0x07, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x22, 0x00, 0x0F,
+    0x92, 0x10, 0x07, 0x90, 0x00, 0x07, 0x00, 0x80, 0x57, 0x00, 0x28, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x0B, 0x48, 0xA0, 0x0B, 0x00, 0x80, 0x03,
+    0x10, 0x00, 0x03, 0x04, 0x7F, 0xF3, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x0B, 0x00, 0xA0, 0x0B, 0x02, 0x80, 0x03,
+    0x10, 0x00, 0x03, 0x04, 0x7F, 0xF3, 0x08, 0x00, 0x0B, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xEE 'î'
+    0x08, 0x80, 0x0F, 0x14, 0x00, 0x17, 0x01, 0x40, 0x17, 0x11, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x10, 0xFF, 0xE7, 0x40, 0x00, 0x17, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x0F, 0x01, 0x00, 0x1F, 0x90, 0x00, 0x2F, 0x12, 0x80, 0x2F,
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x21, 0xFF, 0xCF, 0x90, 0x00, 0x2F,
+    0x90, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    // 0xF0 'ð'
+    0x00, 0x18, 0x83, 0x00, 0x40, 0x03, 0x00, 0x86, 0x0B, 0x0C, 0x10, 0x03,
+    0x05, 0x00, 0x27, 0x00, 0x00, 0x13, 0x48, 0x00, 0x03, 0x04, 0x00, 0x07,
+    0x02, 0x00, 0x03, 0x01, 0x00, 0x0B, 0xC4, 0x07, 0x0B, 0x01, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x2F, 0x02, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x91, 0x3F, 0xCF, 0x30, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x52, 0x00, 0x0F, 0x42, 0x80, 0x1F, 0x12, 0x00, 0x0F,
+    0x22, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xCF, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0xF2 'ò'
+    0x00, 0x0C, 0x41, 0x00, 0x20, 0x01, 0x00, 0x43, 0x05, 0x00, 0x10, 0x01,
+    0x08, 0xA0, 0x13, 0x40, 0x20, 0x09, 0x10, 0xA0, 0x01, 0x0A, 0xA0, 0x03,
+    0x00, 0xA0, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x85, 0x00, 0x40, 0x09,
+    0x00, 0x10, 0x31, 0x00, 0x07, 0x81,
+    // 0xF3 'ó'
+    0x00, 0x0C, 0x41, 0x00, 0x20, 0x01, 0x00, 0x43, 0x05, 0x00, 0x10, 0x01,
+    0x00, 0xA0, 0x13, 0x00, 0x20, 0x09, 0x12, 0xA0, 0x01, 0x20, 0xA0, 0x03,
+    0x08, 0xA0, 0x01, 0x50, 0x80, 0x01, 0x00, 0x03, 0x85, 0x00, 0x40, 0x09,
+    0x00, 0x10, 0x31, 0x00, 0x07, 0x81,
+    // 0xF4 'ô'
+    0x00, 0x18, 0x83, 0x00, 0x40, 0x03, 0x00, 0x86, 0x0B, 0x14, 0x20, 0x03,
+    0x05, 0x40, 0x27, 0x88, 0x40, 0x13, 0x81, 0x40, 0x03, 0x91, 0x40, 0x07,
+    0x41, 0x40, 0x03, 0x01, 0x00, 0x03, 0x1C, 0x07, 0x0B, 0x00, 0x80, 0x13,
+    0x00, 0x20, 0x63, 0x00, 0x0F, 0x03,
+    // 0xF5 'õ'
+    0x00, 0x31, 0x07, 0x00, 0x80, 0x07, 0x61, 0x0C, 0x17, 0x10, 0x40, 0x07,
+    0x22, 0x80, 0x4F, 0x20, 0x80, 0x27, 0x82, 0x80, 0x07, 0x12, 0x80, 0x0F,
+    0x42, 0x80, 0x07, 0x92, 0x00, 0x07, 0xA0, 0x0E, 0x17, 0x01, 0x00, 0x27,
+    0x00, 0x40, 0xC7, 0x00, 0x1E, 0x07,
+    // 0xF6 'ö'
+    0x00, 0x31, 0x07, 0x00, 0x80, 0x07, 0x31, 0x0C, 0x17, 0x90, 0x40, 0x07,
+    0x92, 0x80, 0x4F, 0x00, 0x80, 0x27, 0x02, 0x80, 0x07, 0x02, 0x80, 0x0F,
+    0x02, 0x80, 0x07, 0x92, 0x00, 0x07, 0x00, 0x0E, 0x17, 0x01, 0x00, 0x27,
+    0x00, 0x40, 0xC7, 0x00, 0x1E, 0x07,
+    // 0xF7 '÷'
+    0x06, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x14, 0x07,
+    0x14, 0x07, 0x44, 0x77, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x01, 0x0C, 0x4B, 0x20, 0x05, 0x43, 0x85, 0x10, 0x01, 0xA0, 0x33,
+    0x20, 0x49, 0x80, 0x81, 0xA1, 0x03, 0xA2, 0x09, 0x94, 0x01, 0x03, 0xA5,
+    0x00, 0x09, 0x30, 0x31, 0x47, 0x81,
+    // 0xF9 'ù'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x00, 0x01,
+    0x70, 0x00, 0x01, 0x00, 0x40, 0x33, 0x00, 0x00, 0x03, 0x24, 0x00, 0x0B,
+    0x02, 0x00, 0x09, 0x00, 0x60, 0x01, 0x00, 0x00, 0x15, 0x00, 0x9F, 0xE9,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x09,
+    // 0xFA 'ú'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x40, 0x33, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x0B,
+    0x20, 0x00, 0x09, 0x40, 0x60, 0x01, 0x00, 0x00, 0x15, 0x00, 0x9F, 0xE9,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x09,
+    // 0xFB 'û'
+    0x00, 0x40, 0x03, 0x00, 0x40, 0x03, 0x01, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x03, 0x20, 0x80, 0x67, 0x48, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x80, 0x00, 0x13, 0x80, 0xC0, 0x03, 0x04, 0x00, 0x2B, 0x01, 0x3F, 0xD3,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x13,
+    // 0xFC 'ü'
+    0x00, 0x80, 0x07, 0x00, 0x80, 0x07, 0x02, 0x00, 0x47, 0x60, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x91, 0x00, 0xCF, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x27, 0x51, 0x80, 0x07, 0x90, 0x00, 0x57, 0x12, 0x7F, 0xA7,
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x27,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0xA0, 0x00, 0x1F, 0x01, 0x40, 0x10, 0x5F, 0x00, 0x00, 0x10, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x40, 0x1F,
+    0x00, 0x07, 0x10, 0x1F, 0x00, 0x80, 0x20, 0x1F, 0x00, 0x00, 0xC0, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0xDF, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x60, 0x01, 0x1F,
+    0x52, 0x00, 0x01, 0x1F, 0x92, 0x00, 0x02, 0x5F, 0x02, 0x90, 0xC4, 0x1F,
+    0x22, 0x00, 0x08, 0x9F, 0x00, 0x01, 0x82, 0x1F, 0x20, 0x00, 0x0C, 0x1F,
+    0x11, 0x06, 0x20, 0x1F, 0x92, 0x00, 0x00, 0x1F, 0x52, 0xC0, 0x00, 0x1F,
+    0x02, 0x18, 0x00, 0x1F, 0x02, 0x60, 0x00, 0x1F, 0x02, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x30, 0x80, 0x7F, 0x00, 0xC0, 0x40, 0x7F,
+    0x00, 0x04, 0x60, 0x7F, 0x18, 0x04, 0x00, 0x7F, 0x40, 0x04, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x81, 0x04, 0x00, 0x7F, 0x60, 0x04, 0x00, 0x7F,
+    0x04, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x50, 0x7F, 0x00, 0x60, 0x00, 0xFF,
+    0x00, 0x0C, 0x02, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x105 'ą'
+    0x10, 0x38, 0x0F, 0x08, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x10, 0x12, 0x0F,
+    0x20, 0x8A, 0x0F, 0x82, 0x08, 0x0F, 0x80, 0x80, 0x0F, 0xB0, 0x84, 0x0F,
+    0x80, 0x05, 0x0F, 0x40, 0x00, 0x0F, 0x10, 0x11, 0x5F, 0x00, 0x02, 0x4F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x05, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x01, 0x3F,
+    0x00, 0x8C, 0x30, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x10, 0x40, 0x00, 0x3F, 0x08, 0x00, 0x02, 0x7F, 0x22, 0x80, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x12, 0x00, 0x00, 0x7F, 0x10, 0x60, 0x00, 0x3F,
+    0x60, 0x00, 0x02, 0x3F, 0x00, 0xF0, 0x02, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    // 0x107 'ć'
+    0x00, 0x0C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x05, 0x00, 0x10, 0x21,
+    0x00, 0xA0, 0x11, 0x02, 0x20, 0x03, 0x10, 0xA0, 0x03, 0x04, 0x80, 0x03,
+    0x08, 0x08, 0x03, 0x70, 0x00, 0x01, 0x00, 0x40, 0x11, 0x00, 0x00, 0x09,
+    // 0x10C 'Č'
+    0x00, 0x05, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x01, 0x3F,
+    0x00, 0x8C, 0x30, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x10, 0x40, 0x00, 0x3F,
+    0x40, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x02, 0x7F, 0x02, 0x80, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x12, 0x00, 0x00, 0x7F, 0xA0, 0x60, 0x00, 0x3F,
+    0xC0, 0x00, 0x02, 0x3F, 0x00, 0xF0, 0x02, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    // 0x10D 'č'
+    0x00, 0x0C, 0x01, 0x00, 0x00, 0x01, 0x60, 0x03, 0x05, 0x48, 0x10, 0x21,
+    0x00, 0xA0, 0x11, 0x02, 0x20, 0x03, 0x12, 0xA0, 0x03, 0x04, 0x80, 0x03,
+    0x08, 0x08, 0x03, 0x20, 0x00, 0x01, 0x40, 0x40, 0x11, 0x00, 0x00, 0x09,
+    // 0x10E 'Ď'
+    0x01, 0x00, 0x01, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x42, 0x80, 0x00, 0x3F,
+    0x22, 0x80, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x20, 0x40, 0x02, 0xBF, 0xC1, 0x00, 0x00, 0xBF,
+    0x01, 0x00, 0x04, 0x3F, 0x00, 0x18, 0x19, 0x3F, 0x00, 0x03, 0xC0, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    // 0x10F 'ď'
+    0x00, 0x18, 0x23, 0x00, 0x40, 0x13, 0x00, 0x82, 0x03, 0x00, 0x10, 0x03,
+    0x01, 0x00, 0x27, 0x00, 0x00, 0x07, 0x01, 0x40, 0x17, 0x21, 0x40, 0x03,
+    0x01, 0x00, 0x2B, 0x0F, 0x3F, 0xC3, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07,
+    0x7F, 0xFF, 0xE3, 0x00, 0x00, 0x13, 0x18, 0x00, 0x03, 0x02, 0x00, 0x03,
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x40, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0x9F, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x04, 0xFF, 0x10, 0xA0, 0x00, 0x7F,
+    0x00, 0x42, 0x00, 0xFF, 0x7C, 0x00, 0x03, 0x7F, 0x00, 0x03, 0x80, 0x7F,
+    // 0x119 'ę'
+    0x04, 0x10, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x02, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x84, 0x01, 0x5F, 0x00, 0x00, 0x4F, 0x20, 0x14, 0x4F, 0x0A, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x7E, 0x7E, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x90, 0x00, 0x00, 0x7F, 0xA0, 0x02, 0x00, 0x7F, 0x40, 0x42, 0x80, 0x7F,
+    0x00, 0x01, 0x08, 0x7F, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0E, 0x7F,
+    // 0x11B 'ě'
+    0x00, 0x04, 0x11, 0x00, 0x20, 0x01, 0x50, 0x00, 0x81, 0x40, 0x00, 0x21,
+    0x00, 0x00, 0x01, 0x12, 0x80, 0x03, 0x12, 0x80, 0x03, 0x20, 0x80, 0x03,
+    0x48, 0x84, 0x01, 0x20, 0x00, 0x01, 0x40, 0x20, 0x15, 0x00, 0x0A, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x01, 0x7F, 0x08, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x48, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0x7F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x5F,
+    0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x17, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x07, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x27,
+    0x20, 0x00, 0x47, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xE7,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x04, 0x00, 0x07, 0x20, 0x00, 0x07,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x20, 0x5F, 0x20, 0x20, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x3F, 0x9F,
+    0x01, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0x9F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x0A, 0x17, 0x40, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    // 0x143 'Ń'
+    0x00, 0x80, 0x01, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFE, 0x3F, 0x01, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x01, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x28, 0x00, 0x80, 0x3F,
+    0x08, 0x00, 0x40, 0x3F, 0x40, 0x02, 0x10, 0x3F, 0x80, 0x00, 0x80, 0x3F,
+    0x80, 0x80, 0x40, 0x3F, 0x00, 0x80, 0x10, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x4F, 0xF3, 0x00, 0x00, 0x0B, 0x04, 0x00, 0x0B,
+    0x02, 0x00, 0x03, 0x04, 0x80, 0x03, 0x08, 0xA0, 0x07, 0x50, 0x80, 0x03,
+    0x20, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03,
+    // 0x147 'Ň'
+    0x00, 0x80, 0x01, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xFE, 0x3F, 0x81, 0x00, 0x01, 0x3F,
+    0x80, 0x40, 0x01, 0x3F, 0x40, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x20, 0x00, 0x40, 0x3F, 0x40, 0x02, 0x10, 0x3F, 0x80, 0x00, 0x80, 0x3F,
+    0xA0, 0x80, 0x40, 0x3F, 0x40, 0x80, 0x10, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x03,
+    0x40, 0x00, 0x03, 0x00, 0x4F, 0xF3, 0x48, 0x00, 0x0B, 0x00, 0x00, 0x0B,
+    0x02, 0x00, 0x03, 0x12, 0x80, 0x03, 0x04, 0xA0, 0x07, 0x10, 0x80, 0x03,
+    0x60, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03,
+    // 0x152 'Œ'
+    0x01, 0xF4, 0x0F, 0x04, 0x01, 0x0F, 0x10, 0x00, 0x0F, 0x02, 0x94, 0x0F,
+    0x24, 0x02, 0x0F, 0x48, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x9F, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x08, 0xA0, 0x8F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x04, 0x41, 0x20, 0x01, 0x43, 0x01, 0x10, 0x01, 0x20, 0x13, 0xA0, 0x09,
+    0xA0, 0x01, 0x80, 0x0B, 0x00, 0x01, 0x08, 0x21, 0x03, 0x81, 0x00, 0x09,
+    0x40, 0x05, 0x1C, 0x21, 0x24, 0x11, 0xA4, 0x03, 0x84, 0x03, 0x84, 0x03,
+    0x04, 0x01, 0x00, 0x01, 0x00, 0x11, 0x12, 0x01,
+    // 0x158 'Ř'
+    0x01, 0x00, 0x01, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x22, 0x81, 0x00, 0x3F,
+    0x02, 0x01, 0x01, 0x3F, 0x02, 0x80, 0x01, 0xBF, 0x42, 0x01, 0x10, 0x3F,
+    0x20, 0x42, 0xC4, 0x3F, 0xC1, 0x00, 0x80, 0x3F, 0x01, 0x01, 0x11, 0x3F,
+    0x00, 0x02, 0x08, 0x3F, 0x00, 0x14, 0x04, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF,
+    // 0x159 'ř'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x0B, 0x00, 0x00, 0x0B, 0x08, 0x80, 0x03,
+    0x24, 0x00, 0x03, 0x02, 0x47, 0xF3, 0x02, 0x08, 0x0B, 0x04, 0x10, 0x0B,
+    0x50, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x90, 0x03, 0x00, 0x20, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x44, 0x10, 0xBF, 0x00, 0x00, 0x0C, 0x3F,
+    0x00, 0x20, 0x02, 0x7F, 0x08, 0x40, 0x01, 0x3F, 0x28, 0x00, 0x00, 0x3F,
+    0x0A, 0x82, 0x01, 0x3F, 0x42, 0x80, 0x00, 0x7F, 0x90, 0x00, 0x22, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x01, 0x08, 0x81, 0x3F, 0x01, 0x10, 0x66, 0x3F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x29, 0x00, 0x22, 0x01, 0x00, 0x41, 0x31, 0x00, 0xA0, 0x03,
+    0x0A, 0x84, 0x83, 0x10, 0x84, 0x83, 0x44, 0x80, 0x0B, 0x08, 0x22, 0x21,
+    0x70, 0x81, 0x05, 0x00, 0x70, 0x89, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x44, 0x10, 0xBF, 0x80, 0x00, 0x0C, 0x3F,
+    0x80, 0x20, 0x02, 0x7F, 0x48, 0x40, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x22, 0x82, 0x01, 0x3F, 0x4A, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x22, 0x3F,
+    0x80, 0x20, 0x00, 0x3F, 0x81, 0x08, 0x81, 0x3F, 0x01, 0x10, 0x66, 0x3F,
+    // 0x161 'š'
+    0x00, 0x00, 0x29, 0x60, 0x22, 0x01, 0x48, 0x41, 0x31, 0x24, 0xA0, 0x03,
+    0x02, 0x84, 0x83, 0x12, 0x84, 0x83, 0x04, 0x80, 0x0B, 0x08, 0x22, 0x21,
+    0x00, 0x81, 0x05, 0x40, 0x70, 0x89, 0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x7F,
+    0x00, 0x7F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x01, 0xD0, 0x00, 0x7F,
+    // 0x165 'ť'
+    0x00, 0x40, 0x03, 0x00, 0x40, 0x03, 0x02, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x40, 0x07, 0x01, 0x40, 0x07, 0x01, 0x40, 0x17,
+    0x01, 0x40, 0x03, 0x40, 0xC0, 0x0B, 0x00, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x3F, 0xF8, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x20, 0x40, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x3F,
+    0x44, 0x80, 0x00, 0x1F, 0x28, 0x40, 0x01, 0x5F, 0x00, 0x00, 0x08, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F, 0x00, 0x3F, 0xF8, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x42, 0x40, 0x33, 0x18, 0x00, 0x03, 0xA4, 0x00, 0x0B,
+    0xA0, 0x00, 0x09, 0x1A, 0x60, 0x01, 0x04, 0x00, 0x15, 0x10, 0x9F, 0xE9,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x09,
+    // 0x170 'Ű'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x3F, 0xF8, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x04, 0x40, 0x00, 0x1F, 0x24, 0x00, 0x00, 0x3F,
+    0x48, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    0x08, 0x80, 0x00, 0x1F, 0x14, 0x40, 0x01, 0x5F, 0x00, 0x00, 0x08, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x03, 0x1F, 0x00, 0x3F, 0xF8, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x40, 0x33, 0x00, 0x00, 0x03, 0x08, 0x00, 0x0B,
+    0x40, 0x00, 0x09, 0x06, 0x60, 0x01, 0x10, 0x00, 0x15, 0x00, 0x9F, 0xE9,
+    0x48, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x09,
+    // 0x178 'Ÿ'
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00,
+    0x60, 0x00, 0x01, 0x80, 0x84, 0x02, 0x91, 0x42, 0x02, 0x01, 0x10, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x08, 0x80, 0x81, 0x23, 0x02,
+    0x11, 0xC4, 0x02, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x90, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x10, 0x00, 0x80, 0x3F,
+    0x08, 0x01, 0x00, 0x3F, 0x20, 0x04, 0x20, 0x3F, 0x40, 0x00, 0x80, 0x3F,
+    0x10, 0x01, 0x00, 0x3F, 0x90, 0x04, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x01, 0x00, 0x18, 0x11, 0x00, 0x88, 0x21, 0x00, 0xA0, 0x41,
+    0x00, 0x81, 0x01, 0x00, 0x80, 0x21, 0x12, 0x84, 0x01, 0x20, 0x81, 0x01,
+    0x08, 0xA0, 0x01, 0x40, 0x84, 0x01, 0x00, 0x90, 0x01, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x21,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x90, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x40, 0x01, 0x00, 0x3F, 0x88, 0x04, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x50, 0x01, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x07, 0x00, 0x60, 0x47, 0x02, 0x20, 0x87, 0x02, 0x81, 0x07,
+    0x02, 0x04, 0x07, 0x82, 0x00, 0x87, 0x12, 0x10, 0x07, 0x02, 0x04, 0x07,
+    0x62, 0x80, 0x07, 0x02, 0x10, 0x07, 0x02, 0x40, 0x07, 0x00, 0x01, 0x17,
+    0x00, 0x00, 0x87,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x90, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x40, 0x00, 0x80, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x04, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x40, 0x01, 0x00, 0x3F, 0x20, 0x04, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x01, 0x00, 0x18, 0x11, 0x60, 0x88, 0x21, 0x10, 0xA0, 0x41,
+    0x00, 0x81, 0x01, 0x10, 0x80, 0x21, 0x02, 0x84, 0x01, 0x02, 0x81, 0x01,
+    0x48, 0xA0, 0x01, 0x00, 0x84, 0x01, 0x60, 0x90, 0x01, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x21,
+    // 0x3C0 'π'
+    0x00, 0x01, 0x48, 0x01, 0x80, 0x01, 0x80, 0x09, 0x86, 0xC1, 0x80, 0x01,
+    0x81, 0xC9, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x8E, 0x11, 0x80, 0x01,
+    0x8F, 0x81, 0x80, 0x01, 0x00, 0x01, 0x00, 0x05, 0xC0, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x03, 0xFF, 0xEF, 0x48, 0x00, 0x0F, 0x10, 0x03, 0xCF,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x80, 0x1F, 0x80, 0x00, 0x5F,
+    0x00, 0x00, 0x0F, 0x02, 0x10, 0x4F, 0x44, 0x40, 0x1F, 0x40, 0x47, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x10, 0x0F, 0x00, 0x08, 0x0F,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x06, 0x7F, 0x00, 0xFF, 0x40, 0x7F, 0x01, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x03, 0x7F, 0x18, 0x7F, 0x00, 0x7F, 0x4C, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x23, 0x7F, 0x18, 0xFF, 0x01, 0x7F, 0x4C, 0x7F,
+    // 0x201B '‛'
+    0x70, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x201C '“'
+    0x06, 0x7F, 0x00, 0xFF, 0x40, 0x7F, 0x01, 0x7F, 0x00, 0x7F, 0x09, 0x7F,
+    0x30, 0xFF, 0x00, 0x7F, 0x32, 0x7F, 0x40, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x03, 0x7F, 0x18, 0x7F, 0x00, 0x7F, 0x4C, 0x7F, 0x00, 0x7F,
+    0x40, 0xFF, 0x04, 0xFF, 0x01, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x23, 0x7F, 0x18, 0xFF, 0x01, 0x7F, 0x4C, 0x7F, 0x00, 0x7F,
+    0x40, 0x7F, 0x04, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x201F '‟'
+    0x70, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x20, 0x7F, 0x00, 0x7F, 0x08, 0x7F,
+    0x00, 0x7F, 0x01, 0x7F, 0x46, 0x7F, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x05, 0x00, 0x3F, 0x18, 0x0F, 0x3F, 0x80, 0x00, 0x3F, 0x30, 0x07, 0x3F,
+    0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x07, 0x04, 0x01, 0x07, 0x05, 0x05, 0x07, 0x00, 0x00, 0x07,
+    0x05, 0x05, 0x07, 0x19, 0xDC, 0xC7, 0x80, 0x00, 0x0F, 0x11, 0x5C, 0xC7,
+    0x05, 0x05, 0x07, 0x00, 0x00, 0x07, 0x05, 0x05, 0x07, 0x04, 0x01, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2022 '•'
+    0x13, 0x07, 0x03, 0x03, 0x43, 0x2B,
+    // 0x2026 '…'
+    0x17, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x17, 0x0F, 0x0F,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x0F, 0x07, 0x57,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x9F, 0x48, 0x1F, 0x01, 0x1F,
+    0x40, 0x5F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x40, 0x1F, 0x80, 0x1F, 0x52, 0x5F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F,
+    0x08, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x07, 0x08, 0x67, 0x00, 0x17, 0x47, 0xCF, 0x00, 0x07, 0x80, 0x0F,
+    0x80, 0x27, 0x80, 0x0F, 0x05, 0x17, 0x00, 0x27, 0x17, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x07, 0x10, 0x87, 0x04, 0x87,
+    0x47, 0x3F, 0x00, 0x0F, 0xFF, 0x37, 0x00, 0x87, 0x00, 0x47,
+    // 0x2075 '⁵'
+    0x00, 0x17, 0x00, 0x07, 0x42, 0x0F, 0x00, 0x2F, 0x2A, 0x07, 0x20, 0x07,
+    0x24, 0x97, 0x20, 0x27, 0x01, 0x87,
+    // 0x2076 '⁶'
+    0x03, 0xC7, 0x00, 0x17, 0x00, 0x07, 0x02, 0x07, 0x10, 0x2F, 0x02, 0x0F,
+    0x81, 0x27, 0x80, 0x07, 0x40, 0x17, 0x00, 0xC7,
+    // 0x2077 '⁷'
+    0x70, 0x07, 0x18, 0x07, 0x20, 0xC7, 0x22, 0x07, 0x24, 0x07, 0x23, 0x07,
+    0x04, 0x07, 0x10, 0x07, 0x60, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x67, 0x08, 0x17, 0x42, 0x4F, 0x20, 0x27, 0xA1, 0x0F, 0xA5, 0x07,
+    0x18, 0x0F, 0x46, 0x07, 0x10, 0x27, 0x00, 0x07,
+    // 0x2079 '⁹'
+    0x08, 0x07, 0x22, 0x1F, 0x41, 0x0F, 0x20, 0x2F, 0x80, 0xAF, 0x82, 0x07,
+    0x00, 0x17, 0x00, 0x27, 0x00, 0x07, 0x00, 0x07,
+    // 0x2080 '₀'
+    0x00, 0x07, 0x18, 0x07, 0x20, 0x17, 0x47, 0xCF, 0x00, 0x0F, 0x80, 0x0F,
+    0xA0, 0x2F, 0x10, 0x0F, 0x45, 0x87, 0x20, 0x27, 0x17, 0x07,
+    // 0x2081 '₁'
+    0x20, 0x17, 0x10, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x7F, 0xCF,
+    0x00, 0x0F, 0x00, 0x17,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x28, 0x0F, 0x08, 0x0F, 0x00, 0x8F, 0x01, 0x0F, 0x82, 0x8F,
+    0x11, 0x0F, 0x42, 0x0F, 0x1C, 0x0F, 0x00, 0x17,
+    // 0x2083 '₃'
+    0x00, 0x07, 0x40, 0x07, 0x03, 0x0F, 0x04, 0x0F, 0xA5, 0x27, 0x88, 0x2F,
+    0x00, 0x87, 0x04, 0x07, 0x11, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x47, 0x00, 0x07, 0x04, 0x07, 0x10, 0x87, 0x04, 0x87,
+    0x47, 0x1F, 0x00, 0x0F, 0x7F, 0x37, 0x00, 0x87, 0x00, 0x47,
+    // 0x2085 '₅'
+    0x00, 0x17, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x0A, 0x27, 0x00, 0x0F,
+    0x04, 0x97, 0x00, 0x27, 0x01, 0xC7,
+    // 0x2086 '₆'
+    0x03, 0xC7, 0x00, 0x17, 0x10, 0x07, 0x22, 0x27, 0x02, 0x0F, 0x00, 0x0F,
+    0x00, 0x27, 0x84, 0x07, 0x40, 0x17, 0x00, 0xC7,
+    // 0x2087 '₇'
+    0x30, 0x07, 0x10, 0x07, 0x00, 0xC7, 0x02, 0x07, 0x04, 0x07, 0x03, 0x07,
+    0x04, 0x07, 0x10, 0x07, 0x60, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x67, 0x0D, 0x17, 0x02, 0x4F, 0x30, 0x0F, 0xA4, 0x0F, 0xA5, 0x0F,
+    0x10, 0x07, 0x46, 0x07, 0x11, 0x27, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x08, 0x07, 0x22, 0x17, 0x41, 0x0F, 0x00, 0x8F, 0x80, 0x27, 0xA2, 0x07,
+    0x02, 0x17, 0x00, 0x27, 0x20, 0x07, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x03, 0x03, 0x0F,
+    0x08, 0x00, 0x8F, 0x00, 0x48, 0x4F, 0x22, 0x02, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x10, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F,
+    0x00, 0x00, 0x0F, 0x4C, 0x00, 0x0F, 0x04, 0x00, 0x2F, 0x10, 0x00, 0x8F,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x00, 0x3F, 0x20, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x20, 0xBF,
+    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x41, 0xBF, 0x00, 0x3F, 0x06, 0xBF,
+    0x66, 0x3F, 0x0C, 0x3F, 0x0D, 0x3F, 0x00, 0x3F, 0x03, 0xBF, 0x00, 0x3F,
+    0x41, 0xBF, 0x00, 0xBF,
+    // 0x2153 '⅓'
+    0x30, 0x08, 0x07, 0x30, 0x08, 0x07, 0x10, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x7F, 0xE8, 0x07, 0x00, 0x18, 0x07, 0x00, 0x18, 0x0F,
+    0x00, 0x02, 0x07, 0x00, 0x04, 0x07, 0x00, 0x02, 0x07, 0x00, 0x48, 0x07,
+    0x01, 0xB0, 0x07, 0x02, 0x40, 0x07, 0x08, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x08, 0xE0, 0x67, 0x80, 0x00, 0x57, 0x00, 0x00, 0x17, 0x01, 0x00, 0x17,
+    0x01, 0x10, 0x07, 0x00, 0x41, 0xA7, 0x00, 0x08, 0x07, 0x00, 0x04, 0x87,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x07, 0x40, 0x08, 0x07, 0x50, 0x08, 0x07,
+    0x21, 0x28, 0x07, 0x00, 0x28, 0x07, 0x14, 0x28, 0x07, 0x40, 0x28, 0x37,
+    0x38, 0x20, 0x4F, 0x00, 0x10, 0x37, 0x00, 0x04, 0x47, 0x00, 0x09, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x08, 0x80, 0x07,
+    0x20, 0x00, 0x07, 0xC0, 0xE0, 0x67, 0x20, 0x00, 0x57, 0x40, 0x00, 0x17,
+    0x01, 0x00, 0x17, 0x01, 0x10, 0x07, 0x00, 0x41, 0xA7, 0x00, 0x08, 0x07,
+    0x00, 0x04, 0x87,
+    // 0x215B '⅛'
+    0x30, 0x08, 0x07, 0x30, 0x08, 0x07, 0x10, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x7F, 0xE8, 0x07, 0x00, 0x18, 0x27, 0x00, 0x18, 0x4F,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0xC7, 0x00, 0x11, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x01, 0x80, 0x07, 0x22, 0x00, 0x07,
+    0x80, 0x52, 0x47, 0x20, 0x84, 0x27, 0x41, 0x40, 0x47, 0x00, 0x10, 0x57,
+    0x01, 0x02, 0x57, 0x00, 0x40, 0x07, 0x01, 0x08, 0xA7, 0x00, 0x10, 0x07,
+    0x00, 0x01, 0x87,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x11, 0x10, 0x07, 0x01, 0x10, 0x07,
+    0x25, 0x00, 0x07, 0x21, 0x00, 0x07, 0x40, 0xC0, 0x17, 0x02, 0x10, 0x4F,
+    0x10, 0x00, 0x97, 0x00, 0x00, 0x47, 0x00, 0x09, 0x87, 0x00, 0x12, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07, 0x01, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x80, 0x52, 0x47, 0x40, 0x84, 0x27, 0x01, 0x40, 0x47,
+    0x00, 0x10, 0x57, 0x01, 0x02, 0x57, 0x00, 0x40, 0x07, 0x01, 0x08, 0xA7,
+    0x00, 0x10, 0x07, 0x00, 0x01, 0x87,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x02, 0x10, 0x07, 0x40, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x44, 0x20, 0x07, 0x44, 0x80, 0x07, 0x42, 0x10, 0x0F,
+    0x00, 0xC1, 0x07, 0x00, 0x02, 0x07, 0x00, 0x01, 0x07, 0x00, 0x24, 0x07,
+    0x00, 0xC8, 0x07, 0x01, 0x20, 0x07, 0x04, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x80, 0x52, 0x47, 0x00, 0x84, 0x27, 0x01, 0x40, 0x47,
+    0x00, 0x10, 0x57, 0x01, 0x02, 0x57, 0x00, 0x40, 0x07, 0x01, 0x08, 0xA7,
+    0x00, 0x10, 0x07, 0x00, 0x01, 0x87,
+    // 0x215E '⅞'
+    0x38, 0x00, 0x07, 0x40, 0x00, 0x07, 0x40, 0x00, 0x07, 0x41, 0x08, 0x07,
+    0x40, 0x20, 0x07, 0x50, 0x00, 0x0F, 0x40, 0x01, 0x07, 0x48, 0x02, 0x07,
+    0x20, 0x01, 0x07, 0x00, 0x26, 0x07, 0x00, 0xC8, 0x07, 0x01, 0x20, 0x07,
+    0x04, 0x00, 0x07, 0x02, 0x00, 0x07, 0x04, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x52, 0x47, 0x00, 0x84, 0x27, 0x01, 0x40, 0x47, 0x00, 0x10, 0x57,
+    0x01, 0x02, 0x57, 0x00, 0x40, 0x07, 0x01, 0x08, 0xA7, 0x00, 0x10, 0x07,
+    0x00, 0x01, 0x87,
+    // 0x2190 '←'
+    0x06, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x09, 0x4F, 0x12, 0x8F, 0x40, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x12, 0x8F,
+    0x09, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x00, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x40, 0x2F, 0x60, 0x6F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x60, 0x4F, 0x50, 0xAF,
+    0x20, 0x4F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x08, 0x3F, 0x08, 0x04, 0x3F,
+    0x50, 0x02, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x50, 0x02, 0xBF,
+    0x08, 0x04, 0x3F, 0x04, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x06, 0x0F, 0x09, 0x0F, 0x16, 0x8F, 0x20, 0x4F, 0x40, 0x0F, 0xA0, 0xDF,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x19, 0x8F,
+    // 0x21D1 '⇑'
+    0x04, 0x00, 0x08, 0x00, 0x14, 0x00, 0x27, 0xFF, 0x40, 0x01, 0xA0, 0x00,
+    0xA0, 0x00, 0x40, 0x01, 0x27, 0xFF, 0x14, 0x00, 0x08, 0x00, 0x04, 0x00,
+    // 0x21D2 '⇒'
+    0x19, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0xB0, 0xDF, 0x40, 0x0F,
+    0x20, 0x4F, 0x16, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x21D3 '⇓'
+    0x00, 0x20, 0x00, 0x10, 0x00, 0x28, 0xFF, 0xE4, 0x80, 0x02, 0x00, 0x05,
+    0x00, 0x05, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x28, 0x00, 0x10, 0x00, 0x20,
+    // 0x21D4 '⇔'
+    0x00, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x50, 0xAF, 0x80, 0x1F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x1F, 0x50, 0xAF,
+    0x20, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x33, 0x00, 0x10, 0x0B, 0x20, 0x42, 0x43, 0x00, 0x10, 0x03,
+    0x40, 0x80, 0x13, 0x20, 0x00, 0x13, 0x21, 0x00, 0x2B, 0x01, 0x00, 0x4B,
+    0x10, 0x41, 0x93, 0x47, 0x14, 0x23, 0x00, 0x00, 0x03, 0x08, 0x06, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x9F, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0xC0, 0x1F, 0x00, 0x18, 0x1F, 0x18, 0x00, 0x1F, 0x41, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x60, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x0C, 0x1F, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x3F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x40,
+    0x01, 0x00, 0x08, 0x10, 0x00, 0x28, 0x04, 0x44, 0x08, 0x02, 0x10, 0x08,
+    0x00, 0x82, 0x08, 0x00, 0x00, 0x08, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x42, 0x00, 0x00, 0x48,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x08, 0x18, 0x00, 0x02, 0x02, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x81, 0x00, 0x06, 0x0C, 0x00, 0x10, 0x60, 0x02, 0x01, 0x00,
+    0x18, 0x20, 0x00, 0x41, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x12, 0x7F, 0x01, 0x7F, 0x1C, 0xFF, 0xA0, 0x7F, 0x20, 0x7F, 0xA2, 0x7F,
+    0x54, 0x7F, 0x22, 0x7F, 0x02, 0x7F, 0x0D, 0x7F, 0x00, 0x7F, 0x80, 0x7F,
+    0x00, 0x7F, 0x90, 0xFF, 0x40, 0x7F, 0x14, 0x7F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x49, 0xFF, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    // 0x2260 '≠'
+    0x18, 0x8F, 0x00, 0x4F, 0x00, 0x2F, 0x00, 0x1F, 0x01, 0x0F, 0x04, 0x4F,
+    0x02, 0x4F, 0x20, 0x4F, 0x40, 0x4F, 0x40, 0x4F, 0x00, 0x4F, 0x01, 0x0F,
+    // 0x2264 '≤'
+    0x02, 0x03, 0x01, 0x00, 0x08, 0x00, 0x00, 0x80, 0x16, 0x00, 0x00, 0x00,
+    0x29, 0x00, 0x08, 0x80, 0x50, 0x80, 0x10, 0x40, 0x00, 0x40, 0x00, 0x20,
+    // 0x2265 '≥'
+    0x00, 0x03, 0x00, 0x10, 0x00, 0x10, 0x40, 0x10, 0x00, 0xA0, 0x20, 0x20,
+    0x11, 0x40, 0x11, 0x40, 0x0A, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint8_t Bookerly26BitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x40, 0xF8, 0x37, 0x00, 0x02, 0x07, 0x87, 0xFC, 0x07, 0x00, 0x00, 0x37,
+    // 0x22 '"'
+    0x7F, 0x7F, 0x80, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    0x81, 0x7F, 0x00, 0x7F,
+    // 0x23 '#'
+    0x00, 0x10, 0x7F, 0x00, 0x20, 0x7F, 0x08, 0x20, 0x7F, 0x08, 0x2C, 0x7F,
+    0x08, 0xC3, 0x7F, 0x08, 0x00, 0x7F, 0x03, 0x20, 0x7F, 0xB8, 0x20, 0x7F,
+    0x08, 0x22, 0x7F, 0x08, 0x00, 0x7F, 0x0A, 0x08, 0x7F, 0x60, 0xA0, 0x7F,
+    0x88, 0x20, 0x7F, 0x08, 0x20, 0x7F, 0x08, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x60, 0x3F, 0x01, 0x41, 0x00, 0x3F, 0x04, 0x10, 0x88, 0x3F,
+    0x01, 0xC0, 0x20, 0x3F, 0x08, 0x20, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x3F,
+    0x80, 0x00, 0x03, 0xFF, 0xF2, 0x10, 0x00, 0x3F, 0x00, 0x02, 0x08, 0x3F,
+    0x0A, 0x09, 0xC0, 0x3F, 0x00, 0x04, 0x10, 0x3F, 0x00, 0x02, 0x40, 0x3F,
+    // 0x25 '%'
+    0x03, 0x00, 0x07, 0x10, 0x20, 0x07, 0x03, 0x00, 0x07, 0x50, 0x40, 0x07,
+    0x20, 0x20, 0x07, 0x20, 0x20, 0x07, 0x00, 0x50, 0x47, 0x07, 0x01, 0x27,
+    0x20, 0x40, 0x07, 0x06, 0x09, 0x07, 0x00, 0x24, 0x07, 0x00, 0x10, 0x07,
+    0x01, 0x00, 0x07, 0x04, 0x80, 0x07, 0x12, 0x00, 0x47, 0x00, 0x40, 0x27,
+    0x90, 0x00, 0x07, 0x40, 0x80, 0x47, 0x00, 0x80, 0x07, 0x00, 0xA0, 0x07,
+    0x00, 0x0F, 0x27, 0x00, 0x00, 0x47, 0x00, 0x0E, 0x07,
+    // 0x26 '&'
+    0x00, 0x0F, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x40, 0x0F, 0x0E, 0x10, 0x2F,
+    0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0xA0, 0x88, 0x4F, 0x80, 0x24, 0x4F,
+    0x01, 0x12, 0x4F, 0xA1, 0x09, 0x4F, 0x00, 0x04, 0x0F, 0x44, 0x22, 0x2F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x2F, 0x00, 0x20, 0x8F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x27 '''
+    0x7F, 0x7F, 0x80, 0x7F, 0xFE, 0x7F,
+    // 0x28 '('
+    0x00, 0x3F, 0x80, 0x3F, 0x01, 0x00, 0x10, 0x3F, 0x04, 0x1E, 0x00, 0x3F,
+    0x11, 0x00, 0x62, 0x3F, 0x24, 0x00, 0x09, 0x3F, 0x40, 0x00, 0x04, 0xBF,
+    0xA0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x02, 0x3F,
+    0x48, 0x00, 0x04, 0x3F, 0x22, 0x00, 0x12, 0x3F, 0x00, 0x41, 0x84, 0x3F,
+    0x04, 0x00, 0x10, 0x3F, 0x01, 0x80, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2A '*'
+    0x00, 0x7F, 0x44, 0x7F, 0x50, 0x7F, 0x28, 0x7F, 0x26, 0x7F, 0x94, 0xFF,
+    0x91, 0x7F, 0x10, 0x7F, 0x14, 0x7F,
+    // 0x2B '+'
+    0x00, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x00, 0x1F,
+    0x00, 0x1F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x02, 0x0F,
+    // 0x2C ','
+    0x00, 0x7F, 0x01, 0xFF, 0x4C, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x30, 0x7F,
+    // 0x2D '-'
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x5F,
+    // 0x2E '.'
+    0x07, 0x47, 0x07, 0x07, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x87, 0x00, 0x02, 0x17,
+    0x00, 0x08, 0x87, 0x00, 0x02, 0x07, 0x01, 0x08, 0x07, 0x04, 0x40, 0x07,
+    0x11, 0x00, 0x07, 0x04, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    // 0x30 '0'
+    0x01, 0xDC, 0x0F, 0x08, 0x00, 0x8F, 0x10, 0x00, 0x4F, 0x22, 0x02, 0x2F,
+    0x00, 0x00, 0x8F, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x8F, 0x04, 0x02, 0x0F, 0x20, 0x40, 0x4F,
+    0x10, 0x00, 0x0F, 0x06, 0x0C, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x31 '1'
+    0x10, 0x00, 0x1F, 0x08, 0x00, 0x5F, 0x28, 0x00, 0x5F, 0x28, 0x00, 0x1F,
+    0x07, 0xFF, 0x9F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F,
+    // 0x32 '2'
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0xBF, 0x20, 0x01, 0x1F, 0x0C, 0x02, 0x1F,
+    0x50, 0x04, 0x9F, 0x00, 0x08, 0x9F, 0x00, 0x10, 0x9F, 0x00, 0x24, 0x9F,
+    0x10, 0x08, 0x9F, 0x47, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x80, 0x9F,
+    0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F,
+    // 0x33 '3'
+    0x18, 0x00, 0x0F, 0x24, 0x00, 0x4F, 0x08, 0x00, 0x4F, 0x50, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0xA0, 0x0F, 0x00, 0x00, 0x8F, 0x10, 0x01, 0x2F,
+    0x40, 0x4E, 0x0F, 0x00, 0x00, 0x0F, 0x16, 0x21, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x22, 0x0F, 0x00, 0x42, 0x0F,
+    0x00, 0x02, 0x0F, 0x02, 0x42, 0x0F, 0x00, 0x82, 0x0F, 0x10, 0x02, 0x0F,
+    0x24, 0x02, 0x0F, 0x47, 0xF1, 0xEF, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x02, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x02, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0xDF, 0x00, 0x00, 0x9F, 0x60, 0x80, 0x9F, 0x80, 0x80, 0x9F,
+    0xB8, 0x80, 0x1F, 0xA0, 0x00, 0x1F, 0xA2, 0x01, 0x5F, 0xA0, 0x02, 0x1F,
+    0xA0, 0x18, 0x9F, 0xA0, 0x00, 0x1F, 0xA0, 0x02, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x36 '6'
+    0x00, 0x00, 0x0F, 0x00, 0xC3, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x01, 0x01, 0x0F, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x50, 0x00, 0x0F, 0x00, 0x80, 0x8F, 0x00, 0x0E, 0x2F, 0x20, 0x40, 0x4F,
+    0x60, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0x1F, 0x84, 0x00, 0x1F, 0x98, 0x00, 0x1F, 0xA0, 0x03, 0xDF,
+    0xA0, 0x08, 0x1F, 0xA0, 0x00, 0x5F, 0xA0, 0x04, 0x1F, 0xA2, 0x20, 0x1F,
+    0xA8, 0x80, 0x1F, 0xA0, 0x00, 0x1F, 0x84, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x60, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x00, 0x8F, 0x11, 0x10, 0x0F, 0x20, 0x02, 0x2F, 0x0E, 0x40, 0x8F,
+    0x51, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x80, 0x4F, 0x00, 0x10, 0x0F,
+    0x50, 0x48, 0x8F, 0x00, 0x87, 0x2F, 0x21, 0x00, 0x4F, 0x0C, 0x08, 0x8F,
+    0x00, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x08, 0x40, 0x0F, 0x20, 0x00, 0x4F, 0x07, 0x10, 0x4F,
+    0x50, 0x40, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x28, 0x2F, 0x00, 0x29, 0x0F,
+    0x50, 0x20, 0x4F, 0x40, 0x28, 0x8F, 0x00, 0x01, 0x0F, 0x10, 0x04, 0x0F,
+    0x04, 0x30, 0x0F,
+    // 0x3A ':'
+    0x00, 0x03, 0x80, 0x23, 0x10, 0x03, 0x80, 0x03, 0x00, 0x03,
+    // 0x3B ';'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x26, 0x7F, 0x10, 0x00, 0xBF,
+    0x10, 0x02, 0x3F, 0x60, 0x18, 0x3F,
+    // 0x3C '<'
+    0x00, 0x0F, 0x00, 0x0F, 0x09, 0x0F, 0x00, 0x0F, 0x16, 0x8F, 0x00, 0x0F,
+    0x29, 0x4F, 0x00, 0x0F, 0x50, 0xAF, 0x00, 0x0F, 0x20, 0x5F, 0x00, 0x0F,
+    // 0x3D '='
+    0x01, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0xC5,
+    // 0x3E '>'
+    0x00, 0x0F, 0x20, 0x1F, 0x00, 0x5F, 0x50, 0x0F, 0x00, 0xAF, 0x28, 0x0F,
+    0x01, 0x4F, 0x14, 0x0F, 0x02, 0x8F, 0x00, 0x0F, 0x01, 0x0F, 0x02, 0x0F,
+    // 0x3F '?'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x78, 0x4F, 0x00, 0x04, 0x8F,
+    0x80, 0x98, 0x0F, 0x80, 0x80, 0xAF, 0x10, 0x20, 0x0F, 0x09, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x0D, 0x80, 0x0F,
+    // 0x40 '@'
+    0x00, 0x7E, 0x01, 0x00, 0x00, 0x41, 0x04, 0x3C, 0x01, 0x01, 0x00, 0x81,
+    0x00, 0x00, 0x01, 0x28, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x89, 0x01,
+    0x00, 0x40, 0x8B, 0x22, 0x02, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+    0x81, 0x00, 0x03, 0x80, 0x01, 0x03, 0x82, 0x00, 0x83, 0x20, 0x02, 0x09,
+    0x00, 0x00, 0x01, 0x50, 0x00, 0x85, 0x08, 0x02, 0x99, 0x24, 0x04, 0x01,
+    0x10, 0xE0, 0x01, 0x00, 0x04, 0x01, 0x00, 0xE0, 0x01,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x04, 0x1F,
+    0x00, 0x10, 0x9F, 0x00, 0x42, 0x5F, 0x02, 0x00, 0x3F, 0x08, 0x50, 0x1F,
+    0x02, 0x10, 0x1F, 0x08, 0x10, 0x1F, 0x02, 0x10, 0x1F, 0x20, 0x50, 0x3F,
+    0x0C, 0x00, 0x5F, 0x01, 0x01, 0x5F, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x60, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x1F, 0xFF, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0xA0, 0x0F, 0x20, 0x20, 0x0F, 0x20, 0x20, 0x0F,
+    0x20, 0x20, 0x0F, 0x10, 0x80, 0x0F, 0x4E, 0x00, 0x2F, 0x00, 0xCE, 0x0F,
+    0x11, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    // 0x43 'C'
+    0x00, 0xFC, 0x0F, 0x04, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F,
+    0x08, 0x00, 0x2F, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x7C, 0x00, 0x8F, 0x00, 0x00, 0x8F,
+    // 0x44 'D'
+    0x60, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x1F, 0xFF, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
+    0x08, 0x01, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x8F, 0x00, 0x01, 0x0F,
+    0x04, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x45 'E'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x04, 0x01, 0x1F, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x46 'F'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x60, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0xFC, 0x0F, 0x04, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x10, 0x0F, 0x20, 0x20, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x28, 0x0F, 0x04, 0x20, 0x0F, 0x40, 0x20, 0x2F, 0x00, 0x27, 0xCF,
+    0x00, 0x10, 0x0F,
+    // 0x48 'H'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x5F, 0x40, 0x20, 0x3F,
+    0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x60, 0x20, 0x1F, 0x20, 0x20, 0x5F, 0x1F, 0x9F, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x40, 0x00, 0x3F,
+    // 0x49 'I'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x40, 0x00, 0x3F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xE0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x18, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x1F, 0xFF, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x20, 0x10, 0x4F, 0x40, 0x00, 0x2F,
+    0x02, 0xA0, 0x0F, 0x04, 0x10, 0x0F, 0x48, 0x08, 0x0F, 0x30, 0x04, 0x0F,
+    0x00, 0x02, 0x0F, 0x08, 0x01, 0x2F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x2F,
+    // 0x4C 'L'
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x03, 0x1F, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x1F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x01, 0xE0, 0x1F,
+    0x00, 0x00, 0x9F, 0x0F, 0x80, 0x5F, 0x04, 0x00, 0x5F, 0x00, 0x80, 0x1F,
+    0x08, 0x10, 0x1F, 0x01, 0x02, 0x1F, 0x00, 0x20, 0x9F, 0x00, 0x04, 0x5F,
+    0x00, 0x10, 0x9F, 0x00, 0x84, 0x1F, 0x04, 0x20, 0x1F, 0x21, 0x00, 0x1F,
+    0x0C, 0x00, 0x1F, 0x07, 0xC0, 0x5F, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x1F,
+    0x20, 0x03, 0x9F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x5F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x1F, 0xFF, 0x8F, 0x00, 0x00, 0x0F,
+    0x07, 0xFF, 0x8F, 0x00, 0x00, 0x4F, 0x11, 0x00, 0x4F, 0x08, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x10, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x22, 0x0F,
+    0x40, 0x00, 0x0F, 0x20, 0x04, 0x4F, 0x00, 0x02, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x01, 0xF8, 0x0F, 0x04, 0x01, 0x0F, 0x10, 0x00, 0x0F, 0x21, 0x0C, 0x0F,
+    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x5F, 0xA0, 0x00, 0x5F, 0x20, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0xAF, 0x48, 0x01, 0x0F, 0x02, 0x04, 0x4F, 0x00, 0x00, 0x8F,
+    0x00, 0x01, 0x0F, 0x02, 0x08, 0x0F,
+    // 0x50 'P'
+    0x60, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x20, 0x00, 0x5F,
+    0x20, 0x10, 0x1F, 0x00, 0x50, 0x1F, 0x00, 0x80, 0x1F, 0x40, 0x20, 0x1F,
+    0x20, 0x40, 0x1F, 0x0F, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x01, 0xF8, 0x00, 0x7F, 0x04, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0x08, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x20, 0x00, 0x40, 0x7F,
+    0x20, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x14, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0xA8, 0x7F, 0x48, 0x01, 0x00, 0x7F, 0x02, 0x04, 0x45, 0x7F,
+    0x00, 0x00, 0x84, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x02, 0x08, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0x52 'R'
+    0x60, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x1F, 0xFF, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x10, 0x0F, 0x20, 0x10, 0x4F, 0x20, 0x48, 0x2F,
+    0x00, 0x44, 0x0F, 0x00, 0x30, 0x0F, 0x49, 0x08, 0x8F, 0x00, 0x40, 0x4F,
+    0x20, 0x80, 0x2F, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x00, 0x03, 0xCF, 0x11, 0x04, 0x2F, 0x00, 0x01, 0x0F, 0x4C, 0x00, 0x0F,
+    0x00, 0x20, 0x5F, 0x00, 0x00, 0x5F, 0x20, 0x90, 0x5F, 0x20, 0x00, 0x0F,
+    0x00, 0x48, 0x8F, 0x0C, 0x00, 0x2F, 0x40, 0x00, 0x4F, 0x38, 0x09, 0x0F,
+    // 0x54 'T'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x1F,
+    // 0x55 'U'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x4F, 0x1F, 0xFC, 0x2F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0xAF, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x56 'V'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    0x00, 0x80, 0x0F, 0x10, 0x10, 0x0F, 0x22, 0x04, 0x0F, 0x00, 0x40, 0x8F,
+    0x00, 0x0C, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x20, 0x8F,
+    0x21, 0x04, 0x0F, 0x2C, 0x10, 0x0F, 0x00, 0x80, 0x0F, 0x04, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x57 'W'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F,
+    0x01, 0x80, 0x0F, 0x00, 0x10, 0x0F, 0x06, 0x02, 0x0F, 0x20, 0x40, 0x4F,
+    0x40, 0x04, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x08, 0x2F, 0x00, 0x41, 0x0F,
+    0x06, 0x18, 0x0F, 0x20, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x0C, 0x08, 0x0F, 0x00, 0x81, 0x0F, 0x00, 0x10, 0x2F, 0x00, 0x03, 0x0F,
+    0x00, 0x02, 0x0F, 0x00, 0x30, 0x4F, 0x23, 0x02, 0x0F, 0x10, 0x30, 0x0F,
+    0x01, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x3F, 0x20, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x02, 0x1F, 0x02, 0x00, 0xDF, 0x11, 0x10, 0x5F, 0x28, 0x24, 0x1F,
+    0x40, 0x00, 0x1F, 0x01, 0x10, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0xA2, 0x1F,
+    0x29, 0x10, 0x5F, 0x00, 0x00, 0x1F, 0x08, 0x02, 0x1F, 0x10, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x3F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x02, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x20, 0x40, 0x5F, 0x00, 0x10, 0x1F,
+    0x00, 0x80, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x1F, 0x9F, 0x00, 0x40, 0x5F,
+    0x28, 0x00, 0x5F, 0x02, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x18, 0x00, 0xAF, 0x00, 0x00, 0x0F, 0x08, 0x04, 0x0F,
+    0x00, 0x08, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x44, 0x0F, 0x00, 0x00, 0x0F,
+    0x02, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x11, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x01, 0x0F, 0x10, 0x04, 0x0F, 0x00, 0x03, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x01, 0x3F, 0x40, 0x00, 0x00, 0xBF,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x90, 0x00, 0x07, 0x44, 0x00, 0x07,
+    0x10, 0x80, 0x07, 0x04, 0x20, 0x07, 0x00, 0x88, 0x07, 0x00, 0x21, 0x07,
+    0x00, 0x08, 0x47, 0x00, 0x01, 0x17, 0x00, 0x00, 0x47, 0x00, 0x00, 0x17,
+    // 0x5D ']'
+    0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x01, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x17, 0x00, 0x47, 0x02, 0x17, 0x08, 0x47, 0x42, 0x07, 0x88, 0x07,
+    0x90, 0x07, 0x42, 0x07, 0x10, 0x87, 0x02, 0x17, 0x00, 0x87, 0x00, 0x17,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x60 '`'
+    0x01, 0x51, 0x09, 0x01, 0x11, 0x09, 0x01,
+    // 0x61 'a'
+    0x00, 0x71, 0x08, 0x05, 0x41, 0x01, 0x00, 0x01, 0x80, 0x89, 0x80, 0x89,
+    0x82, 0x01, 0xA2, 0x11, 0x00, 0x01, 0x40, 0x01, 0x0F, 0xF1, 0x00, 0x01,
+    0x00, 0x05, 0x00, 0x01,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x1F, 0xFF, 0xEB,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x13,
+    0x01, 0x40, 0x13, 0x01, 0x40, 0x13, 0x01, 0x40, 0x03, 0x01, 0x00, 0x2B,
+    0x00, 0x08, 0x83, 0x00, 0x80, 0x03, 0x00, 0x40, 0x43, 0x00, 0x04, 0x03,
+    // 0x63 'c'
+    0x04, 0x21, 0x00, 0x09, 0x03, 0x01, 0x10, 0x21, 0x20, 0x11, 0x80, 0x01,
+    0x80, 0x01, 0xA0, 0x01, 0x90, 0x01, 0x00, 0x01, 0x08, 0x05, 0x00, 0x01,
+    // 0x64 'd'
+    0x00, 0x08, 0x43, 0x00, 0x00, 0x13, 0x00, 0x02, 0x0B, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x03, 0x01, 0x40, 0x03, 0x01, 0x00, 0x13, 0x21, 0x00, 0x03,
+    0x41, 0x40, 0x0B, 0x11, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0x65 'e'
+    0x0C, 0x21, 0x00, 0x09, 0x40, 0x85, 0x11, 0x01, 0xA1, 0x11, 0x81, 0x01,
+    0x81, 0x01, 0xA1, 0x01, 0x11, 0x01, 0x01, 0x01, 0x21, 0x01, 0x04, 0x01,
+    // 0x66 'f'
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x17, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x3F, 0xE7, 0x50, 0x40, 0x17, 0x00, 0x40, 0x17,
+    0x20, 0x40, 0x0F, 0x00, 0x40, 0x07, 0x10, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x20, 0x44, 0x07, 0x40, 0x00, 0x17,
+    0x1C, 0x50, 0x07, 0xA0, 0x00, 0x07, 0x81, 0x00, 0x07, 0x81, 0x40, 0x07,
+    0x81, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x80, 0x47, 0x80, 0x02, 0x87,
+    0x8C, 0x08, 0x07, 0xA0, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x68 'h'
+    0x20, 0x00, 0x07, 0x40, 0x00, 0x07, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x7F, 0x9F, 0xE7, 0x00, 0x80, 0x17, 0x00, 0x40, 0x07,
+    0x01, 0x40, 0x07, 0x01, 0x40, 0x07, 0x01, 0x40, 0x07, 0x01, 0x20, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x0F, 0xE7, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x0F,
+    // 0x69 'i'
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x60, 0x80, 0x2F, 0x10, 0x00, 0x0F,
+    0x12, 0x00, 0x0F, 0x83, 0xFF, 0xCF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x01, 0x5F, 0x80, 0x00, 0x04, 0x1F, 0x12, 0x00, 0x00, 0x9F,
+    0x12, 0x00, 0x02, 0x1F, 0x60, 0x00, 0x00, 0x1F,
+    // 0x6B 'k'
+    0x20, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x7F, 0xFA, 0x03, 0x00, 0x0A, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x84, 0x43, 0x00, 0x00, 0x23, 0x00, 0x10, 0x13, 0x00, 0x20, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x20, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x7F, 0xFF, 0xE7, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07,
+    // 0x6D 'm'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x03, 0x0F, 0xF3,
+    0x50, 0x0B, 0x00, 0x07, 0xA0, 0x03, 0xA0, 0x03, 0x80, 0x03, 0x90, 0x0B,
+    0x00, 0x03, 0x00, 0x03, 0x0F, 0xF3, 0x40, 0x0B, 0x20, 0x03, 0xA0, 0x03,
+    0xA0, 0x03, 0x80, 0x03, 0x8F, 0xF3, 0x00, 0x03, 0x20, 0x03, 0x00, 0x03,
+    0x00, 0x0B, 0x00, 0x03,
+    // 0x6E 'n'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x03, 0x0F, 0xF3,
+    0x50, 0x0B, 0x00, 0x07, 0xA0, 0x03, 0xA0, 0x03, 0xA0, 0x07, 0x90, 0x0B,
+    0x00, 0x03, 0x40, 0x03, 0x1F, 0xF3, 0x00, 0x0B, 0x00, 0x0B,
+    // 0x6F 'o'
+    0x04, 0x61, 0x00, 0x09, 0x03, 0x01, 0x10, 0x21, 0x20, 0x01, 0x80, 0x0B,
+    0x80, 0x0B, 0x80, 0x09, 0xA0, 0x01, 0x10, 0x11, 0x04, 0x41, 0x00, 0x01,
+    0x10, 0x21, 0x00, 0x01,
+    // 0x70 'p'
+    0x60, 0x00, 0x1F, 0x20, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x20, 0x08, 0x3F,
+    0xA0, 0x08, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x14, 0x0F, 0x80, 0x20, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F, 0x08, 0xC0, 0x0F,
+    // 0x71 'q'
+    0x04, 0x60, 0x0F, 0x00, 0x08, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F,
+    0xA0, 0x10, 0x2F, 0x80, 0x28, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x03, 0x27, 0xF3,
+    0x00, 0x0B, 0x00, 0x0B, 0x80, 0x0B, 0x80, 0x03, 0x80, 0x03, 0x40, 0x03,
+    // 0x73 's'
+    0x00, 0x11, 0x20, 0x41, 0x40, 0x11, 0x28, 0x01, 0x84, 0x09, 0x80, 0x89,
+    0x80, 0x09, 0xA0, 0x11, 0x09, 0x01, 0x70, 0x81, 0x00, 0x01,
+    // 0x74 't'
+    0x0C, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x13, 0xFC, 0x3F, 0x80, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x01, 0x3F,
+    0x04, 0x00, 0x3F, 0x08, 0x00, 0xBF, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x40, 0x01, 0x20, 0x01, 0x1F, 0xE1, 0x80, 0x01, 0x80, 0x01, 0x00, 0x11,
+    0x00, 0x01, 0x00, 0x09, 0x00, 0x09, 0x40, 0x01, 0x20, 0x11, 0x1F, 0xE9,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x09, 0x00, 0x09, 0x00, 0x05,
+    // 0x76 'v'
+    0x40, 0x01, 0x20, 0x01, 0x10, 0x01, 0x02, 0x01, 0x00, 0x81, 0x0C, 0x21,
+    0x01, 0x05, 0x00, 0x21, 0x00, 0x21, 0x00, 0x89, 0x04, 0x21, 0x30, 0x81,
+    0x04, 0x01, 0x10, 0x01, 0x00, 0x01, 0x40, 0x01,
+    // 0x77 'w'
+    0x40, 0x01, 0x00, 0x01, 0x10, 0x01, 0x02, 0x01, 0x00, 0x41, 0x04, 0x09,
+    0x00, 0x81, 0x00, 0x01, 0x00, 0x85, 0x06, 0x21, 0x30, 0x81, 0x00, 0x01,
+    0x41, 0x01, 0x18, 0x21, 0x03, 0x05, 0x00, 0x61, 0x00, 0x21, 0x01, 0x09,
+    0x28, 0x41, 0x01, 0x01, 0x08, 0x01, 0x20, 0x01, 0x40, 0x01,
+    // 0x78 'x'
+    0x00, 0x07, 0x00, 0x0B, 0x20, 0x03, 0x10, 0x03, 0x00, 0x03, 0x20, 0x1B,
+    0x09, 0x07, 0x04, 0x03, 0x04, 0x43, 0x4B, 0x03, 0x24, 0x03, 0x08, 0x03,
+    0x00, 0x13, 0x20, 0x0B, 0x00, 0x0B, 0x00, 0x03,
+    // 0x79 'y'
+    0x40, 0x00, 0x27, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07, 0x02, 0x00, 0x47,
+    0x00, 0x80, 0x17, 0x0C, 0x20, 0x07, 0x01, 0x06, 0x07, 0x00, 0x20, 0x87,
+    0x00, 0x22, 0x07, 0x00, 0x88, 0x07, 0x04, 0x20, 0x07, 0x30, 0x80, 0x07,
+    0x04, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x01, 0x78, 0x01, 0x08, 0x21, 0x20, 0x41, 0x20, 0x11, 0x22, 0x01,
+    0x24, 0x01, 0x21, 0x01, 0x22, 0x01, 0x00, 0x01, 0x10, 0x21, 0x20, 0x45,
+    0x00, 0x01,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x1E, 0x12, 0x1E, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x0C, 0x04, 0x0C, 0x3F, 0xA0, 0x41, 0x00, 0x3F,
+    0x80, 0x00, 0x01, 0x3F, 0xC0, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x3F,
+    0xA0, 0x41, 0x01, 0x3F, 0x0C, 0x04, 0x0C, 0xBF, 0x40, 0x00, 0x00, 0x3F,
+    0x1E, 0x12, 0x3E, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x37, 0x07, 0xA7, 0x07, 0xA7, 0x07, 0x57, 0x07, 0x07, 0x07, 0x97, 0xA7,
+    // 0xA1 '¡'
+    0x60, 0x00, 0x07, 0x91, 0xFF, 0x87, 0x90, 0x00, 0x07, 0x21, 0xE0, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x7F, 0x01, 0x00, 0x40, 0x7F,
+    0x02, 0x42, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x00, 0x3F, 0x80, 0x7F, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x04, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xA0, 0x7F,
+    0x01, 0x00, 0xC0, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x6F, 0x00, 0x40, 0x1F, 0x00, 0x40, 0x9F, 0x00, 0x5C, 0x2F,
+    0x06, 0x00, 0xAF, 0x10, 0x06, 0x0F, 0x23, 0xC0, 0x0F, 0x40, 0x40, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x50, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x24, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x40, 0x07, 0xA0, 0x07, 0x4D, 0x87, 0x00, 0x07, 0x08, 0x27, 0x50, 0x07,
+    0x40, 0x47, 0x40, 0x47, 0x40, 0x07, 0x00, 0xA7, 0x00, 0x07, 0x50, 0x87,
+    0xA0, 0x07, 0x40, 0x37,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0x80, 0x80, 0x3F,
+    0x84, 0x08, 0x3F, 0xA1, 0x08, 0x3F, 0xC8, 0x48, 0xBF, 0x02, 0x08, 0x3F,
+    0x00, 0x80, 0x3F, 0x00, 0x40, 0x3F, 0x01, 0x08, 0x3F, 0x04, 0x48, 0xBF,
+    0xC1, 0x08, 0xBF, 0x84, 0x08, 0x3F, 0x80, 0x80, 0x3F, 0xA0, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x04, 0xC0, 0x67, 0x00, 0x00, 0x17, 0x02, 0x40, 0x87, 0x19, 0x20, 0x07,
+    0x80, 0x04, 0x27, 0x82, 0x10, 0x07, 0x00, 0x42, 0x27, 0xA1, 0x01, 0x57,
+    0x80, 0x80, 0x07, 0x50, 0x4C, 0x47, 0x00, 0x21, 0x07, 0x00, 0x00, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F, 0x09, 0xF9, 0x0F, 0x14, 0x02, 0x8F,
+    0x28, 0x00, 0x4F, 0x10, 0x70, 0x8F, 0x40, 0x04, 0x2F, 0x20, 0x92, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x04, 0x1F, 0x02, 0x04, 0x0F,
+    0x20, 0x06, 0x0F, 0x40, 0x04, 0x4F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x0C, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x0F,
+    // 0xAA 'ª'
+    0x00, 0x07, 0x14, 0x0F, 0x50, 0x4F, 0x00, 0x4F, 0x0C, 0x0F, 0x1B, 0x8F,
+    0x40, 0x0F, 0x1F, 0x4F, 0x00, 0x17, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x0A, 0x1F, 0x11, 0x1F, 0x20, 0x1F, 0x02, 0x1F, 0x00, 0x1F,
+    0x40, 0x5F, 0x04, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x51, 0x5F,
+    0x20, 0x9F, 0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x04, 0x41, 0x30, 0x11, 0x00, 0x0D, 0x67, 0xC1,
+    0x00, 0x01, 0x00, 0x27, 0x06, 0x45, 0x20, 0x21, 0x40, 0x09, 0x10, 0x01,
+    0x04, 0x29, 0x08, 0x21, 0x00, 0x01,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x01, 0x3F, 0x0C, 0xBF, 0x40, 0x3F, 0x21, 0x3F, 0x21, 0x3F,
+    0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x03,
+    // 0xB2 '²'
+    0x00, 0x07, 0x28, 0x07, 0x48, 0x07, 0x20, 0x87, 0x01, 0x67, 0x22, 0xA7,
+    0x19, 0x27, 0x42, 0x27, 0x38, 0x27, 0x00, 0x07,
+    // 0xB3 '³'
+    0x00, 0x07, 0x10, 0x0F, 0x02, 0x0F, 0x20, 0x0F, 0x04, 0x2F, 0x20, 0x07,
+    0x00, 0x97, 0x42, 0x07, 0x00, 0xC7,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x8F, 0x05, 0xEF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x24, 0x0F, 0x00, 0x08, 0x0F, 0x80, 0x08, 0x0F,
+    0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0xB6 '¶'
+    0x03, 0x00, 0x01, 0x10, 0x00, 0x01, 0x20, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x1F, 0xFF, 0xF1, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xB7 '·'
+    0x0F, 0x8F, 0x1F, 0x8F, 0x0F,
+    // 0xB9 '¹'
+    0x20, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x27,
+    0x00, 0x07, 0x00, 0x07,
+    // 0xBA 'º'
+    0x00, 0x07, 0x20, 0x0F, 0x4C, 0x0F, 0x21, 0x4F, 0x00, 0x4F, 0x00, 0x4F,
+    0x01, 0x0F, 0x40, 0x8F, 0x21, 0x17, 0x00, 0x07,
+    // 0xBB '»'
+    0x00, 0x5F, 0x20, 0x1F, 0x50, 0x1F, 0x04, 0x9F, 0x01, 0x1F, 0x00, 0x1F,
+    0x04, 0x1F, 0x00, 0x1F, 0x01, 0x5F, 0x02, 0x1F, 0x20, 0x1F, 0x10, 0x1F,
+    0x08, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x07, 0x30, 0x18, 0x07, 0x10, 0x08, 0x07, 0x40, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x00, 0x18, 0x17, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x47, 0x00, 0x09, 0x07, 0x00, 0x24, 0x07,
+    0x00, 0x10, 0x07, 0x01, 0x00, 0x07, 0x04, 0x80, 0x07, 0x12, 0x03, 0x07,
+    0x48, 0x04, 0x87, 0x80, 0x02, 0x87, 0x40, 0x20, 0x87, 0x00, 0x40, 0x87,
+    0x00, 0x00, 0x87, 0x01, 0x00, 0x07, 0x01, 0xFE, 0x67, 0x00, 0x00, 0x87,
+    0x00, 0x01, 0x87,
+    // 0xBD '½'
+    0x00, 0x00, 0x07, 0x30, 0x18, 0x07, 0x10, 0x08, 0x07, 0x40, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x00, 0x18, 0x27, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x27, 0x00, 0x04, 0x87, 0x00, 0x12, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0xA0, 0x07, 0x02, 0x00, 0x07, 0x09, 0x00, 0x07, 0x24, 0x00, 0x07,
+    0x80, 0x60, 0x27, 0x20, 0x90, 0x07, 0x00, 0x41, 0x07, 0x01, 0x02, 0x87,
+    0x01, 0x05, 0x07, 0x01, 0x4A, 0x07, 0x00, 0x04, 0x07, 0x00, 0x88, 0x07,
+    0x00, 0x00, 0x67,
+    // 0xBE '¾'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x52, 0x10, 0x07, 0x01, 0x10, 0x07,
+    0x21, 0x00, 0x07, 0x21, 0x28, 0x07, 0x40, 0xC0, 0x07, 0x04, 0x00, 0x17,
+    0x00, 0xC0, 0x47, 0x00, 0x00, 0x07, 0x00, 0x02, 0x47, 0x00, 0x09, 0x07,
+    0x00, 0x24, 0x07, 0x00, 0x10, 0x07, 0x01, 0x00, 0x07, 0x04, 0x80, 0x07,
+    0x12, 0x01, 0x07, 0x48, 0x04, 0x87, 0x80, 0x08, 0x87, 0x40, 0x04, 0x87,
+    0x00, 0x48, 0x87, 0x00, 0x80, 0x87, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x87,
+    // 0xBF '¿'
+    0x00, 0x0C, 0x0F, 0x00, 0x20, 0x8F, 0x00, 0x4E, 0x4F, 0x00, 0x01, 0x2F,
+    0x60, 0x10, 0x8F, 0x90, 0x80, 0x0F, 0x90, 0x00, 0x1F, 0x62, 0x20, 0x8F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x42, 0x7F, 0x00, 0x01, 0x09, 0x7F,
+    0x80, 0x08, 0x00, 0xFF, 0x10, 0x21, 0x40, 0x7F, 0x00, 0x08, 0x40, 0x7F,
+    0x28, 0x20, 0x40, 0x7F, 0x08, 0x08, 0x40, 0x7F, 0x08, 0x81, 0x40, 0xFF,
+    0x00, 0x30, 0x01, 0x7F, 0x00, 0x04, 0x05, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x42, 0x7F, 0x00, 0x01, 0x09, 0x7F,
+    0x00, 0x08, 0x00, 0xFF, 0x18, 0x21, 0x40, 0x7F, 0x08, 0x08, 0x40, 0x7F,
+    0x00, 0x20, 0x40, 0x7F, 0x40, 0x08, 0x40, 0x7F, 0x10, 0x81, 0x40, 0xFF,
+    0x80, 0x30, 0x01, 0x7F, 0x00, 0x04, 0x05, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x42, 0x7F, 0x08, 0x01, 0x09, 0x7F,
+    0x00, 0x08, 0x00, 0xFF, 0x08, 0x21, 0x40, 0x7F, 0x10, 0x08, 0x40, 0x7F,
+    0xA0, 0x20, 0x40, 0x7F, 0x00, 0x08, 0x40, 0x7F, 0x40, 0x81, 0x40, 0xFF,
+    0x20, 0x30, 0x01, 0x7F, 0x08, 0x04, 0x05, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x42, 0x7F, 0x30, 0x01, 0x09, 0x7F,
+    0x00, 0x08, 0x00, 0xFF, 0x00, 0x21, 0x40, 0x7F, 0x00, 0x08, 0x40, 0x7F,
+    0x40, 0x20, 0x40, 0x7F, 0x20, 0x08, 0x40, 0x7F, 0x08, 0x81, 0x40, 0xFF,
+    0x00, 0x30, 0x01, 0x7F, 0x20, 0x04, 0x05, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x84, 0x00, 0x02, 0x12, 0x90, 0x10, 0x01, 0x80, 0x42, 0x80,
+    0x00, 0x10, 0x80, 0x00, 0x40, 0x80, 0x60, 0x10, 0x80, 0x81, 0x02, 0x81,
+    0x90, 0x60, 0x02, 0x60, 0x08, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x21, 0x3F, 0x00, 0x00, 0x84, 0xBF,
+    0x20, 0x04, 0x00, 0x7F, 0x00, 0x10, 0xA0, 0x3F, 0x82, 0x04, 0x20, 0x3F,
+    0x82, 0x10, 0x20, 0x3F, 0x2A, 0x04, 0x20, 0x3F, 0x04, 0x40, 0xA0, 0x7F,
+    0x10, 0x18, 0x00, 0xBF, 0x00, 0x02, 0x02, 0xBF, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F,
+    0x00, 0x02, 0x1F, 0x00, 0x08, 0x9F, 0x00, 0x02, 0x5F, 0x00, 0x40, 0x3F,
+    0x01, 0x10, 0x1F, 0x40, 0x50, 0x1F, 0x29, 0x10, 0x1F, 0x04, 0x10, 0x1F,
+    0x10, 0x10, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x10, 0x20, 0x1F, 0x04, 0x03, 0x1F, 0x78, 0x00, 0x3F,
+    0x00, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x00, 0xFC, 0x00, 0x3F, 0x04, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x02, 0x04, 0x00, 0x3F, 0x08, 0x00, 0x20, 0x3F, 0x50, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x84, 0x3F, 0x00, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x08, 0xBF, 0x00, 0x00, 0x07, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x28, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x10, 0x04, 0x7F, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC9 'É'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x10, 0x04, 0x7F, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xCA 'Ê'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x80, 0x7F,
+    0x00, 0x10, 0x04, 0x7F, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xCB 'Ë'
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xFC, 0x80, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x01, 0x00,
+    0x00, 0x20, 0x08, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    // 0xCC 'Ì'
+    0x60, 0x80, 0x00, 0x7F, 0x90, 0x80, 0x01, 0x7F, 0x40, 0x7F, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x28, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x01, 0x7F, 0x01, 0x00, 0x00, 0xFF,
+    // 0xCD 'Í'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x28, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x90, 0x80, 0x01, 0x7F, 0x61, 0x00, 0x00, 0xFF,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x80, 0x00, 0x7F, 0x20, 0x80, 0x01, 0x7F,
+    0x40, 0x7F, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x08, 0x80, 0x01, 0x7F, 0x01, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xCF 'Ï'
+    0x60, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x02, 0x60, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x02,
+    0x82, 0x00, 0x01, 0x00, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x0F, 0x60, 0x20, 0x0F, 0x20, 0x20, 0x4F, 0x1F, 0x9F, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x20, 0x0F,
+    0x20, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x40, 0x00, 0x0F, 0x08, 0x01, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x8F,
+    0x00, 0x01, 0x0F, 0x04, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F, 0x00, 0x7F, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFE, 0x3F, 0x50, 0x00, 0x01, 0x3F,
+    0x00, 0x44, 0x01, 0x3F, 0x00, 0x22, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x04, 0x40, 0x3F, 0x28, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x88, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x11, 0x3F, 0x00, 0x00, 0x08, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x07, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x84, 0x30, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x61, 0x00, 0x00, 0x3F,
+    0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x7F,
+    0x2A, 0x80, 0x01, 0x7F, 0x00, 0x80, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0x3F, 0x00, 0x08, 0x11, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x20, 0x3F,
+    // 0xD3 'Ó'
+    0x00, 0x07, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x84, 0x30, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x28, 0x80, 0x01, 0x7F,
+    0x02, 0x80, 0x01, 0x7F, 0x40, 0x80, 0x01, 0x3F, 0x90, 0x00, 0x00, 0x3F,
+    0x60, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0x3F, 0x00, 0x08, 0x11, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x20, 0x3F,
+    // 0xD4 'Ô'
+    0x00, 0x07, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x84, 0x30, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x7F,
+    0xA2, 0x80, 0x01, 0x7F, 0x10, 0x80, 0x01, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0xBF, 0x09, 0x20, 0x04, 0x3F, 0x00, 0x08, 0x11, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x20, 0x3F,
+    // 0xD5 'Õ'
+    0x00, 0x07, 0xE0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x84, 0x30, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x41, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x7F,
+    0x02, 0x80, 0x01, 0x7F, 0x28, 0x80, 0x01, 0x3F, 0x48, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0xBF, 0x01, 0x20, 0x04, 0x3F, 0x00, 0x08, 0x11, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x20, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x20, 0x08, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x01, 0x08, 0x60, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x82, 0x00, 0x00, 0x7F,
+    0x90, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x02, 0xFF,
+    0x05, 0x00, 0x02, 0xFF, 0x61, 0x00, 0x02, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x80, 0x80, 0x05, 0x7F, 0x62, 0x40, 0x08, 0x7F, 0x00, 0x10, 0x22, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x40, 0x7F,
+    // 0xD7 '×'
+    0x40, 0x1F, 0xA1, 0x1F, 0x52, 0x1F, 0x2C, 0x1F, 0x10, 0x1F, 0x10, 0x1F,
+    0x24, 0x1F, 0x42, 0x1F, 0x81, 0x1F, 0x00, 0xDF, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x01, 0xFC, 0x4F, 0x04, 0x01, 0xAF, 0x10, 0x00, 0x4F,
+    0x21, 0x08, 0x0F, 0x00, 0x04, 0x2F, 0x40, 0x0A, 0x0F, 0x00, 0x14, 0x0F,
+    0x00, 0x28, 0x4F, 0x20, 0x50, 0x5F, 0xA0, 0xA0, 0x5F, 0x21, 0x40, 0x4F,
+    0x02, 0x80, 0x0F, 0x15, 0x00, 0xAF, 0x42, 0x01, 0x0F, 0x02, 0x04, 0x4F,
+    0x20, 0x00, 0x8F, 0x50, 0x01, 0x0F, 0x22, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0xBF,
+    0x40, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x28, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0xDA 'Ú'
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0xBF,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0xDB 'Û'
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x7F, 0xF0, 0xBF,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x80, 0x02, 0xBF, 0x08, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0xDC 'Ü'
+    0x02, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0xFF, 0xE1, 0x7F,
+    0x81, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x91, 0x00, 0x05, 0x7F, 0x60, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x1F, 0x20, 0x00, 0x5F, 0x1F, 0xFF, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x28, 0x01, 0x5F, 0x08, 0x00, 0x5F, 0x48, 0x00, 0x3F,
+    0x08, 0x04, 0x1F, 0x02, 0x00, 0x1F, 0x01, 0x0A, 0x1F, 0x04, 0x40, 0x1F,
+    0x00, 0x00, 0x1F, 0x01, 0x10, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x03, 0xFF, 0xFB, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x20, 0x03, 0x20, 0x80, 0x03, 0x01, 0x00, 0x13, 0x12, 0x92, 0x03,
+    0x40, 0x01, 0x13, 0x20, 0x00, 0x4B, 0x00, 0x00, 0x03, 0x00, 0x01, 0xE3,
+    // 0xE0 'à'
+    0x00, 0x00, 0x71, 0x00, 0x08, 0x05, 0x50, 0x41, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x80, 0x89, 0x10, 0x80, 0x89, 0x08, 0x82, 0x01, 0x00, 0xA2, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0xE1 'á'
+    0x00, 0x00, 0x71, 0x00, 0x08, 0x05, 0x00, 0x41, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x80, 0x89, 0x00, 0x80, 0x89, 0x24, 0x82, 0x01, 0x08, 0xA2, 0x11,
+    0x50, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0xE2 'â'
+    0x00, 0x00, 0xE3, 0x00, 0x10, 0x0B, 0x04, 0x82, 0x03, 0x20, 0x00, 0x03,
+    0x01, 0x01, 0x13, 0x81, 0x01, 0x13, 0x81, 0x04, 0x03, 0x49, 0x44, 0x23,
+    0x24, 0x00, 0x03, 0x08, 0x80, 0x03, 0x00, 0x1F, 0xE3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0xE3 'ã'
+    0x00, 0x01, 0xC7, 0x20, 0x20, 0x17, 0x91, 0x04, 0x07, 0x20, 0x00, 0x07,
+    0x02, 0x02, 0x27, 0x02, 0x02, 0x27, 0x52, 0x08, 0x07, 0x02, 0x88, 0x47,
+    0x90, 0x00, 0x07, 0x61, 0x00, 0x07, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0xE4 'ä'
+    0x00, 0x01, 0xC7, 0x60, 0x20, 0x17, 0x11, 0x04, 0x07, 0x10, 0x00, 0x07,
+    0x22, 0x02, 0x27, 0x02, 0x02, 0x27, 0x02, 0x08, 0x07, 0x12, 0x88, 0x47,
+    0x10, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0xE5 'å'
+    0x00, 0x00, 0x71, 0x00, 0x08, 0x05, 0x18, 0x41, 0x01, 0x42, 0x00, 0x01,
+    0x20, 0x80, 0x89, 0x04, 0x80, 0x89, 0x24, 0x82, 0x01, 0x02, 0xA2, 0x11,
+    0x2C, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0xE6 'æ'
+    0x00, 0x71, 0x08, 0x05, 0x41, 0x01, 0x00, 0x01, 0x80, 0x89, 0x82, 0x09,
+    0x82, 0x01, 0xA2, 0x05, 0x00, 0x21, 0x00, 0x09, 0x04, 0xC5, 0x11, 0x01,
+    0xA1, 0x01, 0x81, 0x01, 0x80, 0x01, 0xA4, 0x01, 0x0C, 0x01, 0x40, 0x05,
+    0x20, 0x09, 0x00, 0x01,
+    // 0xE7 'ç'
+    0x04, 0x20, 0x07, 0x00, 0x08, 0x07, 0x03, 0x00, 0x07, 0x10, 0x20, 0x07,
+    0x20, 0x10, 0x87, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x4F, 0xA0, 0x01, 0x17,
+    0x90, 0x00, 0xE7, 0x00, 0x00, 0x07, 0x08, 0x04, 0x07, 0x00, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x0C, 0x21, 0x00, 0x00, 0x09, 0x20, 0x40, 0x85, 0x00, 0x11, 0x01,
+    0x48, 0xA1, 0x11, 0x24, 0x81, 0x01, 0x00, 0x81, 0x01, 0x04, 0xA1, 0x01,
+    0x00, 0x11, 0x01, 0x00, 0x01, 0x01, 0x00, 0x21, 0x01, 0x00, 0x04, 0x01,
+    // 0xE9 'é'
+    0x00, 0x0C, 0x21, 0x00, 0x00, 0x09, 0x00, 0x40, 0x85, 0x00, 0x11, 0x01,
+    0x00, 0xA1, 0x11, 0x08, 0x81, 0x01, 0x00, 0x81, 0x01, 0x40, 0xA1, 0x01,
+    0x00, 0x11, 0x01, 0x20, 0x01, 0x01, 0x00, 0x21, 0x01, 0x00, 0x04, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x18, 0x43, 0x00, 0x00, 0x13, 0x0C, 0x81, 0x0B, 0x14, 0x22, 0x03,
+    0x49, 0x42, 0x23, 0x91, 0x02, 0x03, 0x81, 0x02, 0x03, 0x11, 0x42, 0x03,
+    0x00, 0x22, 0x03, 0x14, 0x02, 0x03, 0x00, 0x42, 0x03, 0x00, 0x08, 0x03,
+    // 0xEB 'ë'
+    0x00, 0x30, 0x87, 0x00, 0x00, 0x27, 0x11, 0x02, 0x17, 0x10, 0x44, 0x07,
+    0x02, 0x84, 0x47, 0x02, 0x04, 0x07, 0x02, 0x04, 0x07, 0x62, 0x84, 0x07,
+    0x10, 0x44, 0x07, 0x10, 0x04, 0x07, 0x60, 0x84, 0x07, 0x00, 0x10, 0x07,
+    // 0xEC 'ì'
+    0x20, 0x00, 0x03, 0x00, 0x20, 0x03, 0x48, 0x20, 0x0B, 0x24, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x04, 0xFF, 0xF3, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x20, 0x0B, 0x08, 0x00, 0x03,
+    0x10, 0x80, 0x03, 0x40, 0xFF, 0xF3, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x0B,
+    0x00, 0x00, 0x03,
+    // 0xEE 'î'
+    0x04, 0x00, 0x07, 0x14, 0x40, 0x07, 0x40, 0x40, 0x17, 0x90, 0x00, 0x07,
+    0x81, 0x00, 0x07, 0x91, 0xFF, 0xE7, 0x00, 0x00, 0x17, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x07,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x80, 0x0F, 0x00, 0x80, 0x2F,
+    0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x63, 0xFF, 0xCF, 0x10, 0x00, 0x2F,
+    0x10, 0x00, 0x2F, 0x60, 0x00, 0x0F,
+    // 0xF0 'ð'
+    0x00, 0x08, 0xC3, 0x00, 0x00, 0x13, 0x00, 0x06, 0x03, 0x44, 0x00, 0x43,
+    0xA4, 0x00, 0x03, 0x01, 0x40, 0x17, 0x01, 0x40, 0x17, 0x01, 0x40, 0x13,
+    0x10, 0x00, 0x03, 0x89, 0xA0, 0x2B, 0x00, 0x08, 0x83, 0x01, 0x00, 0x03,
+    0x00, 0x40, 0x43, 0x00, 0x00, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x10, 0x3F, 0xCF, 0x21, 0x40, 0x2F, 0x00, 0x00, 0x1F,
+    0x82, 0x80, 0x0F, 0x52, 0x80, 0x0F, 0x02, 0x80, 0x1F, 0x92, 0x40, 0x2F,
+    0xA0, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x7F, 0xCF, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F,
+    // 0xF2 'ò'
+    0x00, 0x04, 0x61, 0x00, 0x00, 0x09, 0x00, 0x03, 0x01, 0x50, 0x10, 0x21,
+    0x00, 0x20, 0x01, 0x00, 0x80, 0x0B, 0x10, 0x80, 0x0B, 0x08, 0x80, 0x09,
+    0x00, 0xA0, 0x01, 0x00, 0x10, 0x11, 0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x21, 0x00, 0x00, 0x01,
+    // 0xF3 'ó'
+    0x00, 0x04, 0x61, 0x00, 0x00, 0x09, 0x00, 0x03, 0x01, 0x00, 0x10, 0x21,
+    0x00, 0x20, 0x01, 0x04, 0x80, 0x0B, 0x00, 0x80, 0x0B, 0x24, 0x80, 0x09,
+    0x08, 0xA0, 0x01, 0x50, 0x10, 0x11, 0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x21, 0x00, 0x00, 0x01,
+    // 0xF4 'ô'
+    0x00, 0x08, 0xC3, 0x00, 0x00, 0x13, 0x00, 0x06, 0x03, 0x04, 0x20, 0x43,
+    0x20, 0x40, 0x03, 0x01, 0x00, 0x17, 0x81, 0x00, 0x17, 0x81, 0x00, 0x13,
+    0x49, 0x40, 0x03, 0x24, 0x20, 0x23, 0x08, 0x08, 0x83, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x43, 0x00, 0x00, 0x03,
+    // 0xF5 'õ'
+    0x00, 0x11, 0x87, 0x00, 0x00, 0x27, 0x00, 0x0C, 0x07, 0x90, 0x40, 0x87,
+    0x20, 0x80, 0x07, 0x02, 0x00, 0x2F, 0x02, 0x00, 0x2F, 0x52, 0x00, 0x27,
+    0x02, 0x80, 0x07, 0x90, 0x40, 0x47, 0x20, 0x11, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x87, 0x00, 0x00, 0x07,
+    // 0xF6 'ö'
+    0x00, 0x11, 0x87, 0x00, 0x00, 0x27, 0x60, 0x0C, 0x07, 0x10, 0x40, 0x87,
+    0x10, 0x80, 0x07, 0x62, 0x00, 0x2F, 0x02, 0x00, 0x2F, 0x02, 0x00, 0x27,
+    0x12, 0x80, 0x07, 0x10, 0x40, 0x47, 0x10, 0x11, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x87, 0x00, 0x00, 0x07,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x64, 0x27, 0x84, 0x07,
+    0x84, 0x07, 0x64, 0x27, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x02, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x01, 0x04, 0x69, 0x00, 0x05, 0x03, 0x81, 0x10, 0x41, 0x20, 0xA1,
+    0x81, 0x4B, 0x82, 0x8B, 0x85, 0x09, 0xAA, 0x09, 0x14, 0x11, 0x04, 0x61,
+    0x40, 0x01, 0xB0, 0x21, 0x40, 0x01,
+    // 0xF9 'ù'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0xE1, 0x00, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x00, 0x00, 0x11, 0x40, 0x00, 0x01, 0x04, 0x00, 0x09,
+    0x00, 0x00, 0x09, 0x04, 0x40, 0x01, 0x00, 0x20, 0x11, 0x00, 0x1F, 0xE9,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x05,
+    // 0xFA 'ú'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0xE1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x08, 0x00, 0x09,
+    0x00, 0x00, 0x09, 0x40, 0x40, 0x01, 0x00, 0x20, 0x11, 0x20, 0x1F, 0xE9,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x05,
+    // 0xFB 'û'
+    0x00, 0x80, 0x03, 0x00, 0x40, 0x03, 0x00, 0x3F, 0xC3, 0x01, 0x00, 0x03,
+    0x0D, 0x00, 0x03, 0x04, 0x00, 0x23, 0x48, 0x00, 0x03, 0x90, 0x00, 0x13,
+    0x80, 0x00, 0x13, 0x00, 0x80, 0x03, 0x00, 0x40, 0x23, 0x14, 0x3F, 0xD3,
+    0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x0B,
+    // 0xFC 'ü'
+    0x01, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x7F, 0x87, 0x02, 0x00, 0x07,
+    0x12, 0x00, 0x07, 0x10, 0x00, 0x47, 0x40, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x41, 0x00, 0x07, 0x10, 0x80, 0x47, 0x10, 0x7F, 0xA7,
+    0x02, 0x00, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x17,
+    // 0xFE 'þ'
+    0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0x9F, 0xE7, 0x9F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x10, 0x5F, 0x01, 0x40, 0x10, 0x1F,
+    0x01, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x20, 0x08, 0x1F,
+    0x00, 0x07, 0x10, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x80, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x01, 0x00, 0x00, 0x9F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x40, 0x08, 0x01, 0x1F, 0x10, 0x02, 0x00, 0x5F, 0x10, 0x30, 0x80, 0x1F,
+    0x00, 0x04, 0x18, 0x1F, 0x00, 0x00, 0x82, 0x1F, 0x00, 0x00, 0x88, 0x1F,
+    0x10, 0x02, 0x20, 0x1F, 0x10, 0x10, 0x80, 0x1F, 0x40, 0xC2, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x10, 0x80, 0x7F, 0x00, 0x42, 0x40, 0x7F,
+    0x02, 0x00, 0x20, 0x7F, 0x08, 0x50, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F,
+    0x08, 0x10, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F, 0x20, 0x50, 0x20, 0x7F,
+    0x0C, 0x00, 0x46, 0x7F, 0x01, 0x01, 0x40, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x02, 0x7F, 0x00, 0x00, 0x42, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x105 'ą'
+    0x00, 0x70, 0x0F, 0x08, 0x04, 0x0F, 0x41, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x80, 0x88, 0x0F, 0x80, 0x88, 0x0F, 0x82, 0x00, 0x0F, 0xA2, 0x10, 0x0F,
+    0x00, 0x01, 0x2F, 0x40, 0x00, 0x0F, 0x0F, 0xF0, 0x4F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x10, 0x3F, 0x00, 0x20, 0x00, 0xBF, 0x01, 0x40, 0x00, 0x3F,
+    0x08, 0x00, 0x02, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x28, 0x80, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x80, 0x40, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x01, 0xF0, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x107 'ć'
+    0x00, 0x04, 0x21, 0x00, 0x00, 0x09, 0x00, 0x03, 0x01, 0x00, 0x10, 0x21,
+    0x00, 0x20, 0x11, 0x08, 0x80, 0x01, 0x10, 0x80, 0x01, 0x40, 0xA0, 0x01,
+    0x00, 0x90, 0x01, 0x20, 0x00, 0x01, 0x00, 0x08, 0x05, 0x00, 0x00, 0x01,
+    // 0x10C 'Č'
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x10, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x10, 0x3F, 0x80, 0x20, 0x00, 0xBF, 0x81, 0x40, 0x00, 0x3F,
+    0x40, 0x00, 0x02, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0xA0, 0x40, 0x00, 0x3F,
+    0xC0, 0x08, 0x00, 0x3F, 0x01, 0xF0, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x10D 'č'
+    0x00, 0x04, 0x21, 0x00, 0x00, 0x09, 0x60, 0x03, 0x01, 0x40, 0x10, 0x21,
+    0x24, 0x20, 0x11, 0x10, 0x80, 0x01, 0x00, 0x80, 0x01, 0x24, 0xA0, 0x01,
+    0x40, 0x90, 0x01, 0x20, 0x00, 0x01, 0x00, 0x08, 0x05, 0x00, 0x00, 0x01,
+    // 0x10E 'Ď'
+    0x01, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F, 0x00, 0x7F, 0xFE, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x80, 0x00, 0x3F,
+    0x20, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0xBF, 0xC1, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x04, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x00, 0x03, 0xC2, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x10, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x10F 'ď'
+    0x00, 0x08, 0x43, 0x00, 0x00, 0x13, 0x00, 0x02, 0x0B, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x03, 0x01, 0x40, 0x03, 0x01, 0x00, 0x13, 0x21, 0x00, 0x03,
+    0x41, 0x40, 0x0B, 0x11, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x06, 0x00, 0x13, 0x02, 0x00, 0x03,
+    0x48, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x40, 0x7F, 0x1F, 0xFF, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x09, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x20, 0x12, 0xFF,
+    0x04, 0x01, 0x02, 0x7F, 0x78, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x119 'ę'
+    0x0C, 0x20, 0x0F, 0x00, 0x08, 0x0F, 0x40, 0x84, 0x0F, 0x11, 0x00, 0x0F,
+    0xA1, 0x10, 0x0F, 0x81, 0x00, 0x0F, 0x81, 0x02, 0x2F, 0xA1, 0x00, 0x0F,
+    0x11, 0x00, 0x4F, 0x01, 0x00, 0x1F, 0x21, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0xA0, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x80, 0x7F,
+    0x00, 0x10, 0x04, 0x7F, 0x01, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x11B 'ě'
+    0x00, 0x0C, 0x21, 0x00, 0x00, 0x09, 0x40, 0x40, 0x85, 0x48, 0x11, 0x01,
+    0x24, 0xA1, 0x11, 0x00, 0x81, 0x01, 0x00, 0x81, 0x01, 0x24, 0xA1, 0x01,
+    0x40, 0x11, 0x01, 0x20, 0x01, 0x01, 0x00, 0x21, 0x01, 0x00, 0x04, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x01, 0x7F, 0x00, 0x7F, 0xFE, 0x7F,
+    0x28, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x80, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    // 0x13A 'ĺ'
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x5F,
+    0x28, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x41, 0xFF, 0xFF, 0x9F,
+    0x10, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x13D 'Ľ'
+    0x08, 0x00, 0x07, 0x08, 0x00, 0x17, 0x07, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0xC7, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x07,
+    // 0x13E 'ľ'
+    0x20, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x7F, 0xFF, 0xE7, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x18, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x20, 0x5F,
+    0x1F, 0xCF, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x20, 0x40, 0x1F, 0x01, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x1F, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x1F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x07, 0x20, 0x02, 0x0F, 0x40, 0x08, 0x07, 0x40, 0x14, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F, 0x9F, 0xE7, 0x00, 0xA0, 0x17,
+    0x00, 0x40, 0x17, 0x00, 0x80, 0x07,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F, 0x00, 0x7F, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x44, 0x01, 0x3F, 0x10, 0x22, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x88, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x11, 0x3F, 0x00, 0x00, 0x08, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x0F, 0xF3, 0x00, 0x50, 0x0B, 0x00, 0x00, 0x07,
+    0x00, 0xA0, 0x03, 0x24, 0xA0, 0x03, 0x08, 0xA0, 0x07, 0x50, 0x90, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x0B,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F, 0x00, 0x7F, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFE, 0x3F, 0xA0, 0x00, 0x01, 0x3F,
+    0x10, 0x44, 0x01, 0x3F, 0x08, 0x22, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x40, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x88, 0x3F,
+    0x81, 0x00, 0x00, 0x3F, 0x80, 0x80, 0x11, 0x3F, 0x00, 0x00, 0x08, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x10, 0x0F, 0xF3, 0x08, 0x50, 0x0B, 0x00, 0x00, 0x07,
+    0x00, 0xA0, 0x03, 0x10, 0xA0, 0x03, 0x00, 0xA0, 0x07, 0x10, 0x90, 0x0B,
+    0x40, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x0B,
+    // 0x152 'Œ'
+    0x00, 0xF8, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x03, 0x0C, 0x4F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x50, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x1F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x20, 0x0F, 0x04, 0x02, 0x0F, 0x78, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x0C, 0x61, 0x00, 0x09, 0x03, 0x05, 0x10, 0x21, 0xA0, 0x01, 0x80, 0x0B,
+    0x80, 0x0B, 0xA0, 0x09, 0x80, 0x01, 0x00, 0x05, 0x43, 0x81, 0x20, 0x01,
+    0x00, 0x01, 0x11, 0x21, 0xA1, 0x11, 0x81, 0x01, 0x81, 0x01, 0xA1, 0x01,
+    0x91, 0x01, 0x01, 0x01, 0x01, 0x05, 0x0C, 0x01,
+    // 0x158 'Ř'
+    0x01, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F, 0xC0, 0x7F, 0xFE, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x20, 0x80, 0x40, 0x3F,
+    0x00, 0x80, 0x41, 0x3F, 0x00, 0x81, 0x20, 0xBF, 0x40, 0x01, 0x10, 0x3F,
+    0xA0, 0x00, 0xC0, 0x3F, 0xC1, 0x24, 0x22, 0x3F, 0x00, 0x01, 0x01, 0x3F,
+    0x00, 0x82, 0x00, 0xBF, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    // 0x159 'ř'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x10, 0x00, 0x0B, 0x48, 0x00, 0x03,
+    0x04, 0x80, 0x03, 0x00, 0x27, 0xF3, 0x10, 0x00, 0x0B, 0x00, 0x00, 0x0B,
+    0x50, 0x80, 0x0B, 0x20, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x40, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x0F, 0x3F, 0x00, 0x44, 0x10, 0xBF, 0x00, 0x00, 0x04, 0x3F,
+    0x01, 0x30, 0x00, 0x3F, 0x18, 0x00, 0x81, 0x7F, 0x08, 0x00, 0x01, 0x7F,
+    0x00, 0x82, 0x41, 0x7F, 0x40, 0x80, 0x00, 0x3F, 0x10, 0x01, 0x22, 0x3F,
+    0x80, 0x30, 0x00, 0xBF, 0x01, 0x00, 0x01, 0x3F, 0x00, 0xE0, 0x24, 0x3F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x11, 0x00, 0x20, 0x41, 0x00, 0x40, 0x11, 0x00, 0x28, 0x01,
+    0x00, 0x84, 0x09, 0x10, 0x80, 0x89, 0x00, 0x80, 0x09, 0x00, 0xA0, 0x11,
+    0x20, 0x09, 0x01, 0x00, 0x70, 0x81, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x00, 0x0F, 0x3F, 0x00, 0x44, 0x10, 0xBF, 0xA0, 0x00, 0x04, 0x3F,
+    0x11, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x81, 0x7F, 0x20, 0x00, 0x01, 0x7F,
+    0x00, 0x82, 0x41, 0x7F, 0x08, 0x80, 0x00, 0x3F, 0x10, 0x01, 0x22, 0x3F,
+    0xA0, 0x30, 0x00, 0xBF, 0xC1, 0x00, 0x01, 0x3F, 0x00, 0xE0, 0x24, 0x3F,
+    // 0x161 'š'
+    0x00, 0x00, 0x11, 0x60, 0x20, 0x41, 0x40, 0x40, 0x11, 0x20, 0x28, 0x01,
+    0x10, 0x84, 0x09, 0x00, 0x80, 0x89, 0x24, 0x80, 0x09, 0x40, 0xA0, 0x11,
+    0x00, 0x09, 0x01, 0x00, 0x70, 0x81, 0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x01, 0x7F,
+    0x00, 0x7F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x70, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0xE0, 0x00, 0x7F,
+    // 0x165 'ť'
+    0x00, 0xC0, 0x03, 0x00, 0x40, 0x03, 0x01, 0x3F, 0xC3, 0x08, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x23, 0x00, 0x40, 0x03, 0x80, 0x40, 0x13,
+    0x88, 0x40, 0x03, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x40, 0x00, 0x1F, 0x24, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x82, 0x00, 0x00, 0x1F, 0x82, 0x00, 0x00, 0x1F, 0x2A, 0x00, 0x00, 0x1F,
+    0x44, 0x00, 0x00, 0x1F, 0x10, 0x40, 0x01, 0x5F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0xE1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x11, 0x18, 0x00, 0x01, 0x04, 0x00, 0x09,
+    0x04, 0x00, 0x09, 0x1A, 0x40, 0x01, 0x44, 0x20, 0x11, 0x00, 0x1F, 0xE9,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x05,
+    // 0x170 'Ű'
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x08, 0x40, 0x00, 0x1F, 0x14, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x14, 0x40, 0x01, 0x5F, 0x20, 0x00, 0x04, 0x1F,
+    0x48, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x02, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0xE1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x0A, 0x00, 0x11, 0x20, 0x00, 0x01, 0x08, 0x00, 0x09,
+    0x10, 0x00, 0x09, 0x04, 0x40, 0x01, 0x12, 0x20, 0x11, 0x44, 0x1F, 0xE9,
+    0x40, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x05,
+    // 0x178 'Ÿ'
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x60, 0x10, 0x00, 0x90, 0x80, 0x00, 0x81, 0x02, 0x02, 0x60, 0x00, 0x80,
+    0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x90, 0x02, 0x02,
+    0x81, 0x40, 0x02, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x60, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x10, 0x3F, 0x00, 0x00, 0x22, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x08, 0x01, 0x10, 0x3F, 0x28, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x80, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x80, 0x44, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x10, 0x3F, 0x00, 0x00, 0x0C, 0x3F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x01, 0x00, 0x78, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x41,
+    0x00, 0x20, 0x11, 0x04, 0x22, 0x01, 0x00, 0x24, 0x01, 0x24, 0x21, 0x01,
+    0x08, 0x22, 0x01, 0x50, 0x00, 0x01, 0x00, 0x10, 0x21, 0x00, 0x20, 0x45,
+    0x00, 0x00, 0x01,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x60, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x10, 0x3F, 0x00, 0x00, 0x22, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x01, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x80, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x44, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x10, 0x3F, 0x00, 0x00, 0x0C, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x07, 0x01, 0xE0, 0x07, 0x00, 0x20, 0x87, 0x00, 0x81, 0x07,
+    0x00, 0x80, 0x47, 0x10, 0x88, 0x07, 0x90, 0x90, 0x07, 0x90, 0x84, 0x07,
+    0x00, 0x88, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x87, 0x00, 0x81, 0x17,
+    0x00, 0x00, 0x07,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x60, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x20, 0x10, 0x3F, 0x80, 0x00, 0x22, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x20, 0x01, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x80, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0xA0, 0x44, 0x00, 0x3F, 0xC0, 0x08, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x10, 0x3F, 0x00, 0x00, 0x0C, 0x3F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x01, 0x00, 0x78, 0x01, 0x00, 0x08, 0x21, 0x10, 0x20, 0x41,
+    0x00, 0x20, 0x11, 0x10, 0x22, 0x01, 0x00, 0x24, 0x01, 0x00, 0x21, 0x01,
+    0x08, 0x22, 0x01, 0x10, 0x00, 0x01, 0x40, 0x10, 0x21, 0x00, 0x20, 0x45,
+    0x00, 0x00, 0x01,
+    // 0x3C0 'π'
+    0x00, 0x01, 0x48, 0x01, 0x10, 0x01, 0x00, 0x05, 0x01, 0xC1, 0x00, 0x01,
+    0x01, 0xF1, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0xE1, 0x00, 0x05,
+    0x0F, 0x81, 0x00, 0x11, 0x80, 0x01, 0x80, 0x05, 0x00, 0x09,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x03, 0xFF, 0xEF, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x20, 0x02, 0x0F, 0x00, 0x80, 0x8F, 0x02, 0x20, 0x4F,
+    0x08, 0x00, 0x5F, 0x02, 0x00, 0x5F, 0x40, 0x40, 0x0F, 0x10, 0x00, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x10, 0x4F, 0x00, 0x07, 0x0F,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x2018 '‘'
+    0x0F, 0x7F, 0x20, 0x7F, 0x40, 0xFF, 0x21, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x41, 0xFF, 0x18, 0x7F, 0x00, 0x7F, 0x08, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x41, 0xFF, 0x18, 0x7F, 0x00, 0x7F, 0x08, 0x7F,
+    // 0x201B '‛'
+    0x38, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x42, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x0F, 0x7F, 0x20, 0x7F, 0x40, 0xFF, 0x21, 0x7F, 0x00, 0x7F, 0x06, 0x7F,
+    0x10, 0x7F, 0x40, 0xFF, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x41, 0xFF, 0x18, 0x7F, 0x00, 0x7F, 0x08, 0x7F, 0x00, 0x7F,
+    0x01, 0x7F, 0x1C, 0x7F, 0x00, 0x7F, 0x44, 0x7F, 0x00, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x41, 0xFF, 0x18, 0x7F, 0x00, 0x7F, 0x08, 0x7F, 0x00, 0x7F,
+    0x01, 0xFF, 0x1C, 0x7F, 0x01, 0x7F, 0x44, 0x7F, 0x00, 0x7F,
+    // 0x201F '‟'
+    0x38, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x42, 0xFF, 0x00, 0x7F, 0x30, 0x7F,
+    0x02, 0x7F, 0x01, 0x7F, 0x62, 0xFF, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x05, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x1D, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0x3D, 0xFF, 0x3F,
+    0x00, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x07, 0x04, 0x01, 0x07, 0x05, 0x05, 0x07, 0x05, 0x05, 0x07,
+    0x00, 0x00, 0x07, 0x1D, 0xDD, 0xC7, 0x00, 0x00, 0x07, 0x1D, 0xDD, 0xC7,
+    0x00, 0x00, 0x07, 0x05, 0x05, 0x07, 0x05, 0x05, 0x07, 0x04, 0x01, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2022 '•'
+    0x3B, 0x07, 0x03, 0x03, 0x47, 0x13,
+    // 0x2026 '…'
+    0x27, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x57, 0x07, 0x07,
+    0x57, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x07, 0x07, 0x27,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x0A, 0x1F, 0x11, 0x1F, 0x20, 0x1F, 0x02, 0x1F, 0x00, 0x1F,
+    0x40, 0x5F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x5F, 0x20, 0x1F, 0x50, 0x1F, 0x04, 0x9F, 0x01, 0x1F, 0x00, 0x1F,
+    0x04, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x07, 0x18, 0x47, 0x00, 0x17, 0x48, 0x47, 0x00, 0x2F, 0x20, 0x0F,
+    0x20, 0x0F, 0x00, 0x07, 0x07, 0x17, 0x00, 0x27, 0x0F, 0x87,
+    // 0x2074 '⁴'
+    0x00, 0x07, 0x00, 0x47, 0x02, 0x07, 0x01, 0x07, 0x02, 0x87, 0x20, 0x87,
+    0x48, 0x07, 0x00, 0x0F, 0x7F, 0x3F, 0x00, 0x87, 0x00, 0xC7,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x0F, 0x40, 0x0F, 0x02, 0x0F, 0x22, 0x2F, 0x20, 0x07,
+    0x24, 0x97, 0x20, 0x27, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x07, 0x08, 0x07, 0x00, 0x07, 0x02, 0x0F, 0x52, 0x0F, 0x02, 0x0F,
+    0x20, 0x2F, 0x04, 0x07, 0x42, 0x07, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x78, 0x07, 0x10, 0x07, 0x20, 0x4F, 0x20, 0x0F, 0x24, 0x47, 0x32, 0x07,
+    0x00, 0x07, 0x10, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x07, 0x29, 0x17, 0x40, 0x47, 0x28, 0x0F, 0x00, 0x0F, 0x05, 0x0F,
+    0x08, 0xA7, 0x44, 0x07, 0x39, 0x27, 0x00, 0x07,
+    // 0x2079 '⁹'
+    0x00, 0x07, 0x22, 0x17, 0x41, 0x0F, 0x20, 0x0F, 0x22, 0x27, 0x20, 0xC7,
+    0x12, 0x07, 0x40, 0x07, 0x20, 0x87, 0x00, 0x07,
+    // 0x2080 '₀'
+    0x00, 0x07, 0x08, 0x27, 0x20, 0x17, 0x48, 0x47, 0x00, 0x2F, 0x20, 0x0F,
+    0x20, 0x0F, 0x00, 0x07, 0x47, 0x87, 0x20, 0x27, 0x0F, 0x87,
+    // 0x2081 '₁'
+    0x20, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x27,
+    0x00, 0x07, 0x00, 0x07,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x28, 0x07, 0x48, 0x07, 0x00, 0x87, 0x21, 0x67, 0x22, 0xA7,
+    0x19, 0x27, 0x42, 0x27, 0x38, 0x27, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x07, 0x00, 0x0F, 0x12, 0x0F, 0x21, 0x0F, 0x04, 0x0F, 0x21, 0x27,
+    0x00, 0x87, 0x42, 0x07, 0x00, 0xC7,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x00, 0x47, 0x02, 0x07, 0x04, 0x07, 0x02, 0x87, 0x20, 0x87,
+    0x48, 0x27, 0x00, 0x0F, 0x7F, 0x3F, 0x00, 0x87, 0x00, 0xC7,
+    // 0x2085 '₅'
+    0x00, 0x07, 0x00, 0x0F, 0x42, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x00, 0x07,
+    0x04, 0x97, 0x00, 0x27, 0x00, 0x07,
+    // 0x2086 '₆'
+    0x00, 0x07, 0x08, 0x07, 0x10, 0x07, 0x22, 0x2F, 0x42, 0x0F, 0x00, 0x0F,
+    0x21, 0x2F, 0x00, 0x07, 0x42, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x78, 0x07, 0x18, 0x07, 0x00, 0x4F, 0x00, 0x0F, 0x04, 0x47, 0x12, 0x07,
+    0x00, 0x07, 0x10, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x07, 0x28, 0x17, 0x40, 0x47, 0x28, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    0x08, 0xAF, 0x44, 0x07, 0x38, 0x27, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x22, 0x1F, 0x41, 0x0F, 0x00, 0x0F, 0x22, 0xAF, 0x20, 0xC7,
+    0x10, 0x07, 0x40, 0x07, 0x00, 0x87, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x10, 0x0F, 0x00, 0x48, 0x0F, 0x00, 0x48, 0x0F, 0x01, 0x02, 0x0F,
+    0x00, 0x00, 0x8F, 0x10, 0x68, 0x4F, 0x00, 0x48, 0x2F, 0x08, 0x48, 0x0F,
+    0x40, 0x48, 0x0F, 0x00, 0x48, 0x0F, 0x00, 0x50, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x4C, 0x00, 0x0F, 0x44, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x10, 0x3F, 0x20, 0x3F, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF,
+    0x20, 0x3F, 0x10, 0x3F, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x08, 0xFF,
+    0x24, 0x3F, 0x04, 0x3F, 0x05, 0x3F, 0x24, 0x3F, 0x0C, 0xFF, 0x00, 0x7F,
+    0x40, 0xFF, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x07, 0x30, 0x18, 0x07, 0x10, 0x08, 0x07, 0x40, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x00, 0x18, 0x27, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x27, 0x00, 0x04, 0x87, 0x00, 0x12, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0xA0, 0x07, 0x02, 0x00, 0x07, 0x09, 0x00, 0x07, 0x24, 0x00, 0x07,
+    0x80, 0x40, 0x27, 0x20, 0x20, 0x07, 0x01, 0x48, 0x47, 0x01, 0x00, 0x47,
+    0x01, 0x00, 0x07, 0x01, 0x62, 0xA7, 0x00, 0x00, 0x07, 0x00, 0x60, 0x87,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x07, 0x20, 0x28, 0x07, 0x00, 0x48, 0x07, 0x40, 0x88, 0x07,
+    0x20, 0x08, 0x07, 0x02, 0x08, 0x07, 0x1C, 0x08, 0x07, 0x00, 0x08, 0x17,
+    0x1C, 0x08, 0x47, 0x00, 0x01, 0x27, 0x00, 0x00, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x24, 0x07, 0x00, 0x90, 0x07, 0x02, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x48, 0x40, 0x27, 0xA0, 0x20, 0x07, 0x01, 0x48, 0x47,
+    0x01, 0x00, 0x47, 0x01, 0x00, 0x07, 0x01, 0x62, 0xA7, 0x00, 0x00, 0x07,
+    0x00, 0x60, 0x87,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x07, 0x30, 0x18, 0x07, 0x10, 0x08, 0x07, 0x40, 0x08, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x00, 0x18, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x01, 0x27, 0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x00, 0x24, 0x07,
+    0x00, 0x90, 0x07, 0x02, 0x40, 0x07, 0x09, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x20, 0x47, 0xA0, 0x88, 0x27, 0x00, 0x60, 0x47, 0x01, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x01, 0x10, 0x47, 0x00, 0x08, 0xA7, 0x00, 0x90, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x52, 0x10, 0x07, 0x01, 0x10, 0x07,
+    0x21, 0x00, 0x07, 0x21, 0x28, 0x07, 0x40, 0xC0, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0xC0, 0x97, 0x00, 0x02, 0x47, 0x00, 0x01, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x48, 0x07, 0x01, 0x20, 0x07, 0x04, 0x80, 0x07, 0x10, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x90, 0x20, 0x47, 0x40, 0x88, 0x27, 0x00, 0x60, 0x47,
+    0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x10, 0x47, 0x00, 0x08, 0xA7,
+    0x00, 0x90, 0x07, 0x00, 0x00, 0x07,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x42, 0x10, 0x07, 0x40, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x45, 0x28, 0x07, 0x40, 0x80, 0x17, 0x42, 0x00, 0x47,
+    0x00, 0x00, 0x17, 0x00, 0x02, 0x47, 0x00, 0x09, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x07, 0x01, 0x00, 0x07, 0x04, 0x80, 0x07, 0x12, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x90, 0x20, 0x47, 0x40, 0x88, 0x27, 0x00, 0x60, 0x47,
+    0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x10, 0x47, 0x00, 0x08, 0xA7,
+    0x00, 0x90, 0x07, 0x00, 0x00, 0x07,
+    // 0x215E '⅞'
+    0x78, 0x00, 0x07, 0x48, 0x00, 0x07, 0x40, 0x40, 0x07, 0x41, 0x08, 0x07,
+    0x44, 0x40, 0x17, 0x41, 0x00, 0x47, 0x44, 0x00, 0x17, 0x40, 0x02, 0x47,
+    0x00, 0x09, 0x07, 0x00, 0x04, 0x07, 0x00, 0x40, 0x07, 0x01, 0x00, 0x07,
+    0x04, 0x80, 0x07, 0x12, 0x00, 0x07, 0x40, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x40, 0x20, 0x47, 0x00, 0x88, 0x27, 0x00, 0x60, 0x47, 0x01, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x01, 0x10, 0x47, 0x00, 0x08, 0xA7, 0x00, 0x90, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x29, 0x0F, 0x52, 0xAF, 0x40, 0x2F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F, 0x52, 0xAF,
+    0x29, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x06, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x29, 0x4F, 0x50, 0xAF, 0x20, 0x4F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x20, 0x6F, 0x50, 0xAF,
+    0x29, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x0C, 0x0C, 0x3F, 0x14, 0x0A, 0x3F, 0x28, 0x05, 0x3F,
+    0x10, 0x02, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x02, 0x3F,
+    0x28, 0x05, 0x3F, 0x14, 0x0A, 0x3F, 0x0C, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F, 0x00, 0x0F, 0x00, 0x2F, 0x30, 0xCF,
+    0x50, 0xAF, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x00, 0x0F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0x21D2 '⇒'
+    0x00, 0x0F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x50, 0xAF, 0x30, 0xCF, 0x00, 0x2F,
+    0x00, 0x0F, 0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00,
+    // 0x21D4 '⇔'
+    0x06, 0x0F, 0x09, 0x0F, 0x16, 0x8F, 0x20, 0x4F, 0x50, 0xAF, 0x30, 0xCF,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x30, 0xCF, 0x50, 0xAF,
+    0x20, 0x4F, 0x16, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2202 '∂'
+    0x00, 0x04, 0x23, 0x00, 0x10, 0x03, 0x10, 0x03, 0xC3, 0x10, 0x10, 0x03,
+    0x40, 0xA0, 0x13, 0x20, 0x00, 0x13, 0x20, 0x40, 0x0B, 0x00, 0x40, 0x03,
+    0x10, 0x40, 0x83, 0x04, 0x2C, 0x03, 0x20, 0x00, 0x83, 0x08, 0x04, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x02, 0x1F, 0x00, 0x10, 0x9F,
+    0x00, 0x42, 0x1F, 0x02, 0x10, 0x1F, 0x08, 0x40, 0x1F, 0x02, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x20, 0x40, 0x1F, 0x0C, 0x08, 0x1F,
+    0x01, 0x01, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x20, 0x00, 0x00, 0x20, 0x00, 0x04, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF8, 0x20, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x40,
+    0x00, 0x00, 0x10, 0x00, 0x82, 0x00, 0x04, 0x44, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x04, 0x00, 0x10, 0x00, 0x00, 0x42, 0x00, 0x00, 0x30,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x18, 0x10, 0x00, 0x01, 0x03, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x41, 0x00, 0x02, 0x08, 0x00, 0x30, 0x40, 0x01, 0x02, 0x00,
+    0x08, 0x30, 0x00, 0xC1, 0x80, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x0C, 0x7F, 0x01, 0x7F, 0x10, 0xFF, 0x20, 0x7F, 0x80, 0x7F, 0x20, 0xFF,
+    0x50, 0x7F, 0x22, 0x7F, 0x02, 0x7F, 0x05, 0x7F, 0x02, 0xFF, 0x20, 0x7F,
+    0xA0, 0x7F, 0x02, 0xFF, 0x40, 0x7F, 0x36, 0x7F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x3F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x4E, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    // 0x2260 '≠'
+    0x00, 0x0F, 0x01, 0x0F, 0x01, 0x6F, 0x01, 0x0F, 0x01, 0x0F, 0x00, 0x0F,
+    0x03, 0x0F, 0x05, 0x0F, 0x41, 0x0F, 0x61, 0x0F, 0x01, 0x0F, 0x18, 0x8F,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40,
+    0x08, 0x00, 0x00, 0xA0, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x50, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00,
+    0x14, 0x40, 0x01, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x05, 0x00, 0x02, 0x03,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly26ColOffsets[] PROGMEM = {
+    0x0, 0x1A, 0x26, 0x36, 0x66, 0x96, 0xDB, 0x117, 0x11D, 0x13D, 0x161, 0x173,
+    0x18B, 0x197, 0x19F, 0x1A4, 0x1C8, 0x1F5, 0x213, 0x23D, 0x261, 0x28E, 0x2B2, 0x2DC,
+    0x303, 0x32A, 0x351, 0x35B, 0x36D, 0x385, 0x391, 0x3A9, 0x3C7, 0x40C, 0x448, 0x475,
+    0x4A2, 0x4D8, 0x505, 0x52C, 0x55F, 0x59B, 0x5B3, 0x5DF, 0x615, 0x642, 0x687, 0x6C3,
+    0x6F9, 0x723, 0x773, 0x7A6, 0x7CA, 0x7FA, 0x836, 0x86F, 0x8C6, 0x8FF, 0x935, 0x962,
+    0x97A, 0x99E, 0x9B6, 0x9CE, 0x9DB, 0x9E2, 0x9FE, 0xA2E, 0xA46, 0xA76, 0xA8E, 0xAB5,
+    0xAE2, 0xB15, 0xB30, 0xB50, 0xB80, 0xB9B, 0xBCF, 0xBF1, 0xC0D, 0xC3A, 0xC67, 0xC7F,
+    0xC95, 0xCB6, 0xCD8, 0xCF8, 0xD26, 0xD46, 0xD76, 0xD90, 0xDB4, 0xDBD, 0xDE1, 0xDED,
+    0xDFC, 0xE30, 0xE5D, 0xE79, 0xEAF, 0xED3, 0xF0F, 0xF23, 0xF3F, 0xF5D, 0xF71, 0xF89,
+    0xF9D, 0xFAF, 0xFE2, 0x100C, 0x1011, 0x1021, 0x1035, 0x104F, 0x109A, 0x10E5, 0x1133, 0x1151,
+    0x11A1, 0x11F1, 0x1241, 0x1291, 0x12CD, 0x131D, 0x1368, 0x13A4, 0x13E0, 0x141C, 0x1458, 0x1485,
+    0x14A5, 0x14C5, 0x14ED, 0x150B, 0x1544, 0x1594, 0x15DC, 0x1624, 0x166C, 0x16B4, 0x16FC, 0x1712,
+    0x174E, 0x179E, 0x17EE, 0x183E, 0x188E, 0x18B8, 0x18E8, 0x1912, 0x193C, 0x1966, 0x1990, 0x19BA,
+    0x19E4, 0x1A0C, 0x1A30, 0x1A54, 0x1A78, 0x1A9C, 0x1AC0, 0x1ADB, 0x1AF6, 0x1B11, 0x1B2F, 0x1B59,
+    0x1B8C, 0x1BB6, 0x1BE0, 0x1C0A, 0x1C34, 0x1C5E, 0x1C76, 0x1C94, 0x1CC7, 0x1CFA, 0x1D2D, 0x1D60,
+    0x1DA0, 0x1DE0, 0x1E30, 0x1E5A, 0x1E96, 0x1EBA, 0x1EF6, 0x1F1A, 0x1F62, 0x1F98, 0x1FD4, 0x1FF8,
+    0x2034, 0x2058, 0x2094, 0x20B8, 0x20E5, 0x2106, 0x2139, 0x2157, 0x21A7, 0x21DA, 0x222A, 0x225D,
+    0x22A5, 0x22D1, 0x2315, 0x2339, 0x2369, 0x238A, 0x23BA, 0x23DB, 0x241B, 0x243C, 0x248C, 0x24BF,
+    0x250F, 0x2542, 0x2578, 0x25B4, 0x25DB, 0x2617, 0x263E, 0x267A, 0x26A1, 0x26C3, 0x26FC, 0x2709,
+    0x2723, 0x272D, 0x2737, 0x2741, 0x274B, 0x275F, 0x2775, 0x278B, 0x279F, 0x27C6, 0x27ED, 0x27F3,
+    0x2809, 0x2819, 0x2827, 0x283D, 0x2853, 0x2865, 0x2879, 0x288B, 0x289F, 0x28B3, 0x28C9, 0x28D9,
+    0x28ED, 0x28FF, 0x2915, 0x2927, 0x293B, 0x294D, 0x2961, 0x2975, 0x2996, 0x29B7, 0x29E7, 0x2A08,
+    0x2A29, 0x2A4A, 0x2A72, 0x2ABA, 0x2B05, 0x2B50, 0x2B9E, 0x2BEC, 0x2C37, 0x2C57, 0x2C7B, 0x2C9B,
+    0x2CBF, 0x2CDF, 0x2D03, 0x2D23, 0x2D3B, 0x2D5B, 0x2D73, 0x2D93, 0x2DBA, 0x2DED, 0x2E29, 0x2E59,
+    0x2E8C, 0x2EAC, 0x2EE4, 0x2EFC, 0x2F14, 0x2F2C, 0x2F4D, 0x2F6E, 0x2F8F, 0x2FB0, 0x2FD1, 0x2FF2,
+    0x3013, 0x3034, 0x3055, 0x3076, 0x3097, 0x30B8, 0x30D9, 0x30FA, 0x311B, 0x313C, 0x315D, 0x317E,
+    0x319F, 0x31C0, 0x31E1
+};
+
+
 const SimpleGFXfont Bookerly26 PROGMEM = {Bookerly26Bitmaps, Bookerly26Bitmaps_lsb, Bookerly26Bitmaps_msb, Bookerly26Glyphs,
-    315, 28};
+    315, 28,
+    nullptr, 0, FontStyle::REGULAR, Bookerly26GlyphIndexLatin1, Bookerly26GlyphRanges, 13,
+    Bookerly26BitmapsCol, Bookerly26BitmapsCol_lsb, Bookerly26BitmapsCol_msb, Bookerly26ColOffsets};
@@ -5292,5 +5292,4761 @@ const SimpleGFXglyph Bookerly26BoldGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly26BoldGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly26BoldGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly26BoldBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0x8F, 0x80, 0x01, 0x8F, 0x00, 0x01, 0x0F,
+    0x01, 0xFF, 0x8F, 0xFF, 0xFF, 0xDF,
+    // 0x22 '"'
+    0x80, 0xFF, 0x00, 0x7F, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0x00, 0x7F, 0x00, 0xFF, 0x07, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xCF, 0xFF, 0xFB, 0xCF, 0xFF, 0xF3, 0xC8, 0xFF, 0xF3, 0x80, 0xFF,
+    0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x4F, 0xFF, 0x03, 0xCF, 0xFF,
+    0xF3, 0xC0, 0xFF, 0xF1, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
+    0x00, 0xCF, 0xFF, 0x03, 0xCF, 0xFF, 0xF3, 0xDF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x0E, 0x0F, 0xFF,
+    0xF8, 0x0E, 0x07, 0xFF, 0xF0, 0x07, 0xC7, 0xFF, 0xF1, 0xC3, 0xE7, 0xBF,
+    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x21, 0xE7, 0xFF,
+    0xF1, 0xE1, 0xC7, 0xFF, 0xF0, 0xF0, 0x07, 0xFF, 0xF0, 0x70, 0x0F, 0xFF,
+    0xF8, 0x78, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xF8, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC7, 0xC7, 0xFF,
+    0xCF, 0xE7, 0xFF, 0xCF, 0xC7, 0xEF, 0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x07,
+    0xE0, 0x1C, 0x1F, 0xF8, 0x70, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xE0, 0x1F, 0x81, 0xC0, 0x0F,
+    0x87, 0xC0, 0x0F, 0xDF, 0x8F, 0xCF, 0xFF, 0x8F, 0xCF, 0xFF, 0x8F, 0x8F,
+    0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x1F,
+    0xE0, 0x04, 0x1F, 0x80, 0x1F, 0x1F, 0x80, 0x0F, 0x1F, 0x0C, 0x07, 0x9F,
+    0x1F, 0x83, 0x9F, 0x1C, 0xC1, 0x9F, 0x18, 0xF0, 0x1F, 0x01, 0xF8, 0x1F,
+    0x81, 0x98, 0x1F, 0xC7, 0x9C, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F,
+    0xFF, 0x81, 0x1F, 0xFF, 0x9F, 0x1F, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0x80, 0xFF, 0x00, 0x7F, 0x00, 0xFF, 0x03, 0xFF,
+    // 0x28 '('
+    0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0xFF, 0x87, 0xFF, 0xF0, 0x7F,
+    0x0F, 0xFF, 0xFC, 0x7F, 0x9F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x7F, 0x0F, 0xFF, 0xFC, 0x7F,
+    0x83, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xC4, 0xFF, 0xC4, 0x7F, 0xE0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F,
+    0x82, 0x3F, 0xD1, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF,
+    // 0x2B '+'
+    0xF9, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x00, 0x0F,
+    0x00, 0x0F, 0x80, 0x0F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFC, 0x7F, 0x90, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x2D '-'
+    0xFF, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2E '.'
+    0xDF, 0x8F, 0x07, 0x0F, 0x8F, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF,
+    0xC0, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x00, 0x1F, 0x81, 0xFC, 0x1F, 0x87, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x83, 0xFC, 0x1F, 0x80, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x9F, 0xE3, 0xFF, 0x9F, 0xC3, 0xFF, 0x1F,
+    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF,
+    // 0x32 '2'
+    0xFB, 0xFF, 0x7F, 0xE1, 0xFE, 0x1F, 0xC0, 0xFC, 0x1F, 0xC0, 0xF8, 0x1F,
+    0x87, 0xF0, 0x1F, 0x8F, 0xE0, 0x1F, 0x8F, 0xC1, 0x1F, 0x8F, 0x83, 0x1F,
+    0x86, 0x07, 0x1F, 0x80, 0x0F, 0x1F, 0xC0, 0x1F, 0x1F, 0xC0, 0x3F, 0x1F,
+    0xE0, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x9F, 0xC3, 0xFF, 0x9F, 0xC3, 0x9F, 0x9F,
+    0x87, 0x8F, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1E, 0x1F,
+    0x84, 0x0E, 0x1F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0xC0, 0x7F,
+    0xF3, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFC, 0x11, 0xFF, 0xF0, 0x71, 0xFF, 0xE0, 0xF1, 0xFF,
+    0xC1, 0xF1, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC0, 0x7F, 0x3F, 0x00, 0x7F, 0x3F,
+    0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F, 0x1C, 0x3E, 0x3F, 0x1C, 0x3C, 0x3F,
+    0x1C, 0x00, 0x3F, 0x1E, 0x00, 0x7F, 0x1E, 0x00, 0xFF, 0x1F, 0x01, 0xFF,
+    0x1F, 0xC3, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x3E, 0x1F, 0xC3, 0x3F, 0x1F, 0x87, 0x3F, 0x1F,
+    0x87, 0x1F, 0x1F, 0x8F, 0x00, 0x1F, 0x8F, 0x00, 0x1F, 0x8F, 0x80, 0x3F,
+    0x9F, 0xC0, 0x7F, 0xFF, 0xF1, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFC, 0x3F,
+    0x1F, 0xF0, 0x3F, 0x1F, 0xC0, 0x3F, 0x1F, 0x00, 0x3F, 0x1C, 0x01, 0xFF,
+    0x18, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFC, 0xFF, 0xF1, 0xF0, 0x3F, 0xE0, 0x60, 0x3F, 0xC0, 0x00, 0x1F,
+    0x80, 0x02, 0x1F, 0x8E, 0x0F, 0x1F, 0x8F, 0x1F, 0x9F, 0x8F, 0x0F, 0x9F,
+    0x8E, 0x0F, 0x1F, 0x80, 0x02, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x40, 0x3F,
+    0xE1, 0xE0, 0x7F, 0xFF, 0xF8, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x9F, 0xC0, 0x1F, 0x9F, 0xC0, 0x0F, 0x1F,
+    0x80, 0x0F, 0x1F, 0x8F, 0x87, 0x1F, 0x8F, 0xC6, 0x1F, 0x8F, 0xC4, 0x1F,
+    0x87, 0xC0, 0x3F, 0x81, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+    0xF0, 0x03, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x3A ':'
+    0xDF, 0xF7, 0x8F, 0xE3, 0x07, 0xC1, 0x07, 0xC3, 0x8F, 0xE3, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x8F, 0xE4, 0x1F, 0x07, 0xC0, 0x3F,
+    0x07, 0xC0, 0x7F, 0x8F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xE0, 0x7F, 0xE6, 0x3F,
+    0xC6, 0x3F, 0xCF, 0x1F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0xFF, 0xDF,
+    // 0x3D '='
+    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0xC7, 0x1F, 0xC7, 0x3F,
+    0xE2, 0x3F, 0xE2, 0x7F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0x87, 0x1F, 0x0F, 0x83, 0x1F,
+    0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x1F, 0x8F, 0x1F, 0x3F, 0x86, 0x1F, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+    0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0x83, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF,
+    0xE3, 0xFF, 0xF1, 0xFF, 0xC7, 0xFC, 0xF0, 0xFF, 0xC7, 0x18, 0x38, 0xFF,
+    0x8E, 0x10, 0x38, 0xFF, 0x8E, 0x70, 0x38, 0xFF, 0x8E, 0x73, 0x38, 0xFF,
+    0x8C, 0x66, 0x38, 0xFF, 0x8E, 0x00, 0x78, 0xFF, 0x8E, 0x00, 0x78, 0xFF,
+    0x8F, 0x00, 0x38, 0xFF, 0x8F, 0xFE, 0x38, 0xFF, 0xC7, 0xFF, 0x31, 0xFF,
+    0xC3, 0xFE, 0x31, 0xFF, 0xE1, 0xFC, 0x33, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x03, 0x9F, 0xF0, 0x03, 0x9F,
+    0xC0, 0x63, 0xFF, 0x83, 0xE3, 0xFF, 0x80, 0xE3, 0xFF, 0x00, 0x03, 0x9F,
+    0xC0, 0x03, 0x9F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0x1F, 0x1F,
+    0x9F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x80, 0x0E, 0x1F,
+    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE1, 0xC0, 0x7F, 0xFF, 0xE0, 0xFF,
+    // 0x43 'C'
+    0xFE, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F,
+    0xC0, 0x00, 0x1F, 0x87, 0xFC, 0x1F, 0x8F, 0xFE, 0x1F, 0x8F, 0xFE, 0x1F,
+    0x1F, 0xFF, 0x1F, 0x1F, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F, 0x07, 0xFF, 0x1F,
+    0x81, 0xFF, 0x1F, 0x81, 0xFF, 0x1F, 0xC7, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x87, 0xFE, 0x1F, 0x83, 0xFC, 0x3F, 0xC0, 0xF0, 0x3F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x8F, 0x9F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F,
+    0x8F, 0x1F, 0x1F, 0x83, 0x9C, 0x1F, 0x83, 0xF8, 0x1F, 0x87, 0xFC, 0x3F,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x8F, 0x8F, 0x9F, 0x8F, 0x8F, 0x9F, 0x8F, 0x8F, 0xFF, 0x8F, 0x8F, 0xFF,
+    0x83, 0x8F, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFE, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x60, 0x1F, 0x83, 0xFC, 0x1F, 0x87, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x0F, 0xFF, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0xC7, 0x1F, 0x1F, 0xC7, 0x1F,
+    0x0F, 0xC0, 0x1F, 0x81, 0xC0, 0x1F, 0x81, 0xC0, 0x1F, 0x83, 0xC0, 0x3F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xDF, 0x1F, 0xDF, 0x9F, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0xFF, 0x1F,
+    0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0x9F, 0xFF, 0xF8, 0xFF, 0x9F, 0xFF, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0x1F, 0x1F,
+    0x9F, 0x0F, 0x9F, 0xBE, 0x07, 0x9F, 0xFC, 0x01, 0xFF, 0xF8, 0xC0, 0xFF,
+    0x90, 0xE0, 0x7F, 0x81, 0xF0, 0x3F, 0x83, 0xF8, 0x1F, 0x87, 0xFC, 0x1F,
+    0x8F, 0xFE, 0x0F, 0x9F, 0xFF, 0x0F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x9F, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x3F, 0x9F, 0x80, 0xFF, 0x9F,
+    0x80, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFF,
+    0x80, 0xFF, 0x9F, 0x80, 0x7F, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0x80, 0x1F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xFF, 0x1F, 0xC0, 0x7F, 0x9F,
+    0xE0, 0x3F, 0x9F, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x01, 0xFF,
+    0xFF, 0x80, 0xFF, 0x9F, 0xC0, 0x3F, 0x9F, 0xF0, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFE, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x3F,
+    0xC0, 0x00, 0x1F, 0x87, 0xFC, 0x1F, 0x8F, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x1F, 0xFF, 0x0F, 0x1F, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x87, 0xFE, 0x1F, 0x80, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0x87, 0x1F,
+    0x9F, 0xCF, 0x9F, 0x8F, 0x8F, 0x9F, 0x8F, 0x8F, 0xFF, 0x80, 0x0F, 0xFF,
+    0x80, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x87, 0xFC, 0x1F, 0xFF,
+    0x8F, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x07, 0xFF,
+    0x1F, 0xFF, 0x03, 0xFF, 0x0F, 0xFF, 0x01, 0xFF, 0x0F, 0xFF, 0x11, 0xFF,
+    0x87, 0xFE, 0x10, 0xFF, 0x80, 0xF0, 0x38, 0xFF, 0xC0, 0x00, 0x38, 0xFF,
+    0xC0, 0x00, 0x78, 0x7F, 0xE0, 0x00, 0xF8, 0x7F, 0xF8, 0x03, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0x8F, 0x1F,
+    0x9F, 0x87, 0x9F, 0x8F, 0x83, 0x9F, 0x8F, 0x01, 0xFF, 0x82, 0x00, 0x7F,
+    0x80, 0x10, 0x3F, 0xC0, 0x38, 0x1F, 0xC0, 0x7C, 0x1F, 0xF0, 0xFE, 0x1F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF,
+    // 0x53 'S'
+    0xFF, 0xFC, 0x3F, 0xE0, 0x78, 0x1F, 0xC0, 0x38, 0x1F, 0x80, 0x1E, 0x1F,
+    0x80, 0x1F, 0x1F, 0x8E, 0x0F, 0x8F, 0x1E, 0x0F, 0x8F, 0x1F, 0x07, 0x1F,
+    0x1F, 0x07, 0x1F, 0x87, 0x80, 0x1F, 0x81, 0x80, 0x3F, 0x83, 0xC0, 0x3F,
+    0xFF, 0xE0, 0xFF,
+    // 0x54 'T'
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xDF, 0x8F, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x8F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    // 0x55 'U'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0xFE, 0x1F,
+    0x9F, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xFF, 0x1F, 0x9F, 0xFE, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0x98, 0x00, 0x7F,
+    0x9F, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x1F,
+    0x9F, 0x00, 0x7F, 0x98, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+    0x80, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0x88, 0x00, 0x1F,
+    0x9F, 0x80, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x3F,
+    0xE0, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF,
+    0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xF0, 0x1F, 0x9F, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x3F, 0xFF, 0x81, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x8F, 0xFE, 0x1F,
+    0x83, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x80, 0xE0, 0x1F, 0x80, 0x01, 0x9F,
+    0x90, 0x03, 0x9F, 0x9C, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x01, 0x9F,
+    0x90, 0x40, 0x1F, 0x80, 0xE0, 0x1F, 0x81, 0xF0, 0x1F, 0x87, 0xFC, 0x1F,
+    0x8F, 0xFE, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x59 'Y'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x80, 0x7F, 0x9F, 0x80, 0x1F, 0x9F, 0x98, 0x00, 0x1F,
+    0x9E, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1F, 0x9C, 0x00, 0x1F,
+    0x90, 0x3F, 0x9F, 0x80, 0x7F, 0x9F, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0x83, 0xFE, 0x1F, 0x81, 0xFC, 0x1F, 0x83, 0xF0, 0x1F,
+    0x8F, 0xE0, 0x1F, 0x8F, 0xC0, 0x1F, 0x8F, 0x01, 0x1F, 0x8E, 0x03, 0x1F,
+    0x88, 0x0F, 0x1F, 0x80, 0x1F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0xFF, 0x1F,
+    0x83, 0xFC, 0x1F, 0x87, 0xF8, 0x1F, 0xCF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F,
+    0x9F, 0xFF, 0xFE, 0x7F,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xEF,
+    // 0x5D ']'
+    0x9F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x0F, 0xF8, 0x0F, 0xE0, 0x1F, 0x80, 0xFF,
+    0x07, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0x1F, 0xF8, 0x0F, 0xFE, 0x0F,
+    0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x60 '`'
+    0xFF, 0x8F, 0x0F, 0x87, 0xC3, 0xF3, 0xFF,
+    // 0x61 'a'
+    0xFF, 0x87, 0xC7, 0x03, 0x86, 0x03, 0x86, 0x03, 0x1C, 0x63, 0x1C, 0x73,
+    0x1C, 0x63, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0xF0, 0x03,
+    0xFF, 0xF3, 0xFF, 0xF7,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x1F, 0xC7,
+    0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x3F, 0xC7, 0xFE, 0x0F, 0x87,
+    0xFE, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x0F, 0x83,
+    0x1F, 0xE3, 0x1F, 0xE3, 0x1F, 0xE3, 0x07, 0xE3, 0x03, 0xE3, 0x87, 0xE3,
+    0xEF, 0xE7,
+    // 0x64 'd'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x07, 0xFE, 0x0F, 0x87, 0xFE, 0x3F, 0xC7, 0xDE, 0x3F, 0xC7,
+    0xCE, 0x3F, 0xC7, 0x8E, 0x3F, 0x8F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x07, 0x80, 0x03, 0x80, 0x03, 0x0C, 0xC3,
+    0x1C, 0xE3, 0x1C, 0xE3, 0x1C, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x80, 0xE3,
+    0xC0, 0xE7, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xF0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x8E, 0x3F, 0xE7,
+    0x8E, 0x3F, 0xE7, 0x8E, 0x3F, 0xE7, 0x8F, 0x3F, 0xFF, 0x87, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x1F, 0xC0, 0xC0, 0x1F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x21, 0x8F, 0x1E, 0x21, 0x8F, 0x1E, 0x21, 0x8F,
+    0x1E, 0x21, 0x8F, 0x00, 0x61, 0x8F, 0x00, 0x61, 0x0F, 0x00, 0xE0, 0x1F,
+    0x01, 0xF0, 0x1F, 0x1F, 0xF0, 0x3F, 0x1F, 0xF8, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xE7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x1F, 0xE7,
+    0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xF7, 0xFE, 0x1F, 0xE7, 0xFE, 0x00, 0x07,
+    0xFE, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE7, 0xCE, 0x3F, 0xE7, 0x86, 0x00, 0x07,
+    0x86, 0x00, 0x07, 0x86, 0x00, 0x07, 0x8E, 0x00, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x1F,
+    0xFF, 0x3F, 0xFE, 0x1F, 0xCE, 0x00, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x3F,
+    0x86, 0x00, 0x00, 0x7F, 0x86, 0x00, 0x00, 0xFF, 0xCF, 0x00, 0x0F, 0xFF,
+    // 0x6B 'k'
+    0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xE7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x01, 0xC7, 0xFF, 0xF1, 0xE7,
+    0xFF, 0x60, 0x7F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFE, 0x0E, 0x07,
+    0xFE, 0x1F, 0x07, 0xFE, 0x3F, 0x87, 0xFE, 0x7F, 0xC7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xDF, 0xFF, 0xF7, 0x8F, 0xFF, 0xE7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xF7,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xF3, 0x1F, 0xF3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x80, 0x03, 0x8F, 0xF3, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xF3, 0x00, 0x03,
+    0x00, 0x03, 0x80, 0x03, 0xC0, 0x03, 0x8F, 0xF3, 0x9F, 0xFF, 0x1F, 0xFF,
+    0x1F, 0xF3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03, 0xF0, 0x03,
+    0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xF3, 0x1F, 0xF3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x80, 0x03, 0x8F, 0xF3, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xF3, 0x00, 0x03,
+    0x00, 0x03, 0x80, 0x03, 0xC0, 0x03, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x6F 'o'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x07, 0x80, 0x03, 0x80, 0x03, 0x07, 0x83,
+    0x1F, 0xE3, 0x1F, 0xF3, 0x1F, 0xF3, 0x0F, 0xE3, 0x00, 0x03, 0x80, 0x07,
+    0x80, 0x07, 0xC0, 0x0F, 0xF0, 0x7F,
+    // 0x70 'p'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x9F, 0xF3, 0xCF,
+    0x1F, 0xF3, 0xCF, 0x1F, 0xE3, 0xFF, 0x0F, 0xC3, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0xFF,
+    0x80, 0x03, 0xFF, 0x07, 0x83, 0xFF, 0x1F, 0xE3, 0xFF, 0x1F, 0xE3, 0xEF,
+    0x1F, 0xE3, 0xCF, 0x1F, 0xC7, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xBF, 0xFF, 0x9F, 0xF3, 0x1F, 0xF3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0xC0, 0x03, 0x8F, 0xF3, 0x0F, 0xF3, 0x0F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF,
+    // 0x73 's'
+    0xFF, 0xC7, 0xC1, 0x83, 0x80, 0x83, 0x00, 0xE3, 0x10, 0x73, 0x38, 0x73,
+    0x38, 0x33, 0x1C, 0x03, 0x04, 0x03, 0x86, 0x07, 0x8F, 0x0F, 0xFF, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xE3, 0xFC, 0x7F,
+    0xE3, 0xFC, 0x7F, 0xE3, 0xFC, 0x7F, 0xE3, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF,
+    // 0x75 'u'
+    0x9F, 0xFF, 0x9F, 0xFF, 0x80, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03,
+    0xBF, 0xC3, 0xFF, 0xE3, 0xFF, 0xE3, 0x9F, 0xE3, 0x80, 0x07, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x76 'v'
+    0xBF, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x1F,
+    0x00, 0x07, 0x38, 0x03, 0xFF, 0x83, 0xFF, 0x83, 0xBC, 0x03, 0x10, 0x0F,
+    0x00, 0x7F, 0x01, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0xBF, 0xFF,
+    // 0x77 'w'
+    0xFF, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x07,
+    0x10, 0x03, 0x3F, 0x03, 0xFF, 0x83, 0xFC, 0x03, 0xE0, 0x1F, 0x81, 0xFF,
+    0x80, 0x7F, 0x80, 0x0F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x83, 0x3C, 0x03,
+    0x00, 0x0F, 0x00, 0x7F, 0x01, 0xFF, 0x0F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFB, 0x3F, 0xF3, 0x1F, 0xE3, 0x0F, 0xC3, 0x07, 0x83, 0x03, 0x03,
+    0x00, 0x13, 0x30, 0x3F, 0xF8, 0x3B, 0xF0, 0x13, 0x00, 0x03, 0x07, 0x83,
+    0x0F, 0xC3, 0x1F, 0xE3, 0x3F, 0xF3, 0xBF, 0xF3,
+    // 0x79 'y'
+    0xBF, 0xFF, 0x9F, 0x1F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x03, 0xFF, 0x8F,
+    0x00, 0x7F, 0x8F, 0x00, 0x1F, 0x0F, 0x00, 0x06, 0x1F, 0x38, 0x00, 0x3F,
+    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0xFF, 0xBC, 0x03, 0xFF, 0x10, 0x0F, 0xFF,
+    0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0x87, 0xE3, 0x07, 0x83, 0x0F, 0x03, 0x1E, 0x03, 0x1C, 0x03,
+    0x10, 0x23, 0x00, 0x63, 0x00, 0xE3, 0x03, 0xE3, 0x07, 0xC3, 0x0F, 0x83,
+    0x9F, 0x87,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE0, 0xE1, 0x81, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x0C, 0x00, 0x7F,
+    0x1F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x9F, 0xFF, 0xFE, 0x7F,
+    // 0x7C '|'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F,
+    0x1F, 0x1C, 0x3C, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xFF, 0xC7, 0xC3, 0x87, 0x8F, 0x8F, 0x87, 0xC7, 0xE3, 0xE3, 0xC3, 0x87,
+    0x8F, 0xFF,
+    // 0xA1 '¡'
+    0xCF, 0xFF, 0xE7, 0x86, 0x00, 0x07, 0x86, 0x00, 0x07, 0x84, 0x00, 0x07,
+    0xCF, 0xE0, 0x0F,
+    // 0xA2 '¢'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3C, 0x1F, 0xFF, 0xF8, 0xFF, 0x1F, 0xFF,
+    0xF8, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0xFF, 0x1F, 0xFF, 0xF8, 0x7F, 0x1F, 0xFF, 0xF8, 0x3F, 0x1F, 0xFF,
+    0xFC, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x1F, 0xFF, 0x9F, 0x0F, 0xFF, 0x9E, 0x0F,
+    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0x1F,
+    0x83, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F,
+    0x83, 0x9F, 0x1F, 0x83, 0xFF, 0x1F, 0xC3, 0xFF, 0x1F, 0xF7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xBF, 0xDF, 0x1F, 0x8F, 0x80, 0x0F, 0xC0, 0x1F, 0xC0, 0x1F, 0x8F, 0x1F,
+    0x8F, 0x9F, 0x8F, 0x9F, 0x8F, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x1F,
+    0x1F, 0x8F, 0xBF, 0xDF, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0x2F, 0xFF,
+    0x01, 0x27, 0xBF, 0x00, 0x27, 0x3F, 0x00, 0x27, 0x3F, 0x30, 0x00, 0x3F,
+    0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x38, 0x06, 0x3F,
+    0x00, 0x27, 0x3F, 0x01, 0x27, 0x3F, 0x07, 0x27, 0xFF, 0x1F, 0x7F, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x1F, 0xE0, 0x0E, 0x0F, 0xC1, 0x8E, 0x0F,
+    0x80, 0xC7, 0x8F, 0x18, 0x63, 0xCF, 0x3C, 0x63, 0xCF, 0x1E, 0x31, 0xCF,
+    0x1E, 0x30, 0x8F, 0x07, 0x18, 0x1F, 0x87, 0x80, 0x3F, 0xCF, 0xC0, 0x7F,
+    0xFF, 0xFB, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0x07, 0x3F, 0x9C, 0x03, 0x9F, 0x98, 0x01, 0x9F,
+    0xB8, 0xF1, 0xDF, 0xB9, 0xF9, 0xDF, 0xB9, 0xF9, 0xCF, 0xB8, 0xF9, 0xDF,
+    0x98, 0xF9, 0xDF, 0x9D, 0xFB, 0x9F, 0xDF, 0xFF, 0x9F, 0xCF, 0xFF, 0x3F,
+    0xE7, 0xFE, 0x7F, 0xF0, 0xF0, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x0F, 0xFF,
+    // 0xAA 'ª'
+    0xFC, 0xF7, 0x88, 0x67, 0x88, 0x27, 0x33, 0x27, 0x33, 0x67, 0x00, 0x67,
+    0x80, 0x67, 0xC0, 0x27, 0xFE, 0x6F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x8E, 0x3F,
+    0x1F, 0x3F, 0xF3, 0xFF, 0xE1, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x84, 0x3F,
+    0x1E, 0x3F, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE3, 0x8F, 0xCF, 0xE7, 0xD7, 0xD3, 0x90, 0x1B,
+    0xB0, 0x1B, 0xB6, 0x59, 0xB0, 0x3B, 0x91, 0x9B, 0x9F, 0xD3, 0xCF, 0xF7,
+    0xE3, 0xC7, 0xF0, 0x1F, 0xFF, 0xFF,
+    // 0xB0 '°'
+    0xF0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0x8E, 0x3F, 0x8E, 0x3F, 0x8E, 0x3F,
+    0x8E, 0x3F, 0x80, 0x7F, 0xC0, 0x7F, 0xF1, 0xFF,
+    // 0xB1 '±'
+    0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF,
+    0xF8, 0xFC, 0xFF, 0x80, 0x0C, 0xFF, 0x80, 0x0C, 0xFF, 0x80, 0x0C, 0xFF,
+    0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF,
+    // 0xB2 '²'
+    0xEF, 0xCF, 0xC7, 0x8F, 0x87, 0x0F, 0x8F, 0x0F, 0x9E, 0x0F, 0x98, 0x4F,
+    0x80, 0xCF, 0x81, 0xCF, 0xC3, 0xCF, 0xFF, 0xCF,
+    // 0xB3 '³'
+    0xFF, 0xEF, 0x8F, 0xC7, 0x8D, 0xC7, 0x9C, 0xC7, 0x98, 0xC7, 0x90, 0x8F,
+    0x80, 0x0F, 0x80, 0x1F, 0xC6, 0x3F, 0xFF, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0x8F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x03, 0x1F, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xC3, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x03, 0xFF, 0x7F, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xF7, 0xFF,
+    // 0xB6 '¶'
+    0xFC, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x07, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xCF, 0x87, 0x87, 0x87, 0x8F, 0xFF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xCF, 0xEF, 0xCF, 0xCF, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x0F, 0xFF, 0xCF, 0xFF, 0xEF,
+    // 0xBA 'º'
+    0xE1, 0xFF, 0xC0, 0x67, 0x80, 0x67, 0x9E, 0x27, 0x3F, 0x27, 0x1F, 0x27,
+    0x8C, 0x67, 0x80, 0x67, 0xC0, 0xEF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xBF, 0xBF, 0x1F, 0x3F, 0x8C, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF,
+    0xF1, 0xFF, 0x9F, 0x3F, 0x0E, 0x3F, 0x84, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF,
+    0xF1, 0xFF, 0xFB, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3, 0xF7,
+    0xFF, 0xF3, 0xC7, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xE0, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xF0, 0x7E, 0x7F, 0xC1, 0xFC, 0x3F, 0x83, 0xF8, 0x3F, 0xCF, 0xE1, 0x3F,
+    0xFF, 0xC3, 0x3F, 0xFF, 0x87, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3, 0xC7,
+    0xFF, 0xF3, 0x83, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xC0, 0xFF, 0xFF, 0x83, 0xC7, 0x8F, 0xCF, 0x87, 0x0F, 0xFF, 0x87, 0x0F,
+    0xFF, 0x1E, 0x0F, 0xFF, 0x1C, 0x0F, 0xFF, 0x00, 0x8F, 0xFF, 0x81, 0x8F,
+    0xFF, 0x83, 0x8F, 0xFF, 0xEF, 0x8F,
+    // 0xBE '¾'
+    0xF7, 0xF7, 0xFF, 0xE3, 0xF3, 0xFF, 0xC6, 0x73, 0xFF, 0xCE, 0x73, 0xFF,
+    0xCC, 0x63, 0xFF, 0xC0, 0x63, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xE7,
+    0xE3, 0x0F, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xE0, 0x7E, 0x7F, 0x81, 0xFC, 0x3F, 0x87, 0xF8, 0x3F, 0xDF, 0xE1, 0x3F,
+    0xFF, 0xC3, 0x3F, 0xFF, 0x87, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x87, 0x1F,
+    0xCF, 0x87, 0x0F, 0x87, 0x0F, 0x8F, 0x86, 0x0F, 0x8F, 0x84, 0x0F, 0x8F,
+    0xCF, 0x9F, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F,
+    0x8F, 0xF8, 0x07, 0x3F, 0x87, 0xE0, 0x07, 0x3F, 0xC7, 0x80, 0xC7, 0xFF,
+    0xE3, 0x07, 0xC7, 0xFF, 0xE3, 0x01, 0xC7, 0xFF, 0xF2, 0x00, 0x07, 0x3F,
+    0xFF, 0x80, 0x07, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xF8, 0x07, 0x3F, 0xF3, 0xE0, 0x07, 0x3F, 0xE3, 0x80, 0xC7, 0xFF,
+    0xE3, 0x07, 0xC7, 0xFF, 0xC7, 0x01, 0xC7, 0xFF, 0x86, 0x00, 0x07, 0x3F,
+    0x87, 0x80, 0x07, 0x3F, 0xCF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFE, 0x00, 0x3F,
+    0xF3, 0xF8, 0x07, 0x3F, 0xC3, 0xE0, 0x07, 0x3F, 0x87, 0x80, 0xC7, 0xFF,
+    0x8F, 0x07, 0xC7, 0xFF, 0x8F, 0x01, 0xC7, 0xFF, 0x86, 0x00, 0x07, 0x3F,
+    0xC3, 0x80, 0x07, 0x3F, 0xE3, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xCF, 0xFC, 0x00, 0x7F,
+    0x87, 0xF0, 0x0E, 0x7F, 0x0F, 0xC0, 0x0E, 0x7F, 0x9F, 0x01, 0x8F, 0xFF,
+    0x8E, 0x0F, 0x8F, 0xFF, 0xC6, 0x03, 0x8F, 0xFF, 0xC4, 0x00, 0x0E, 0x7F,
+    0x8F, 0x00, 0x0E, 0x7F, 0x8F, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F,
+    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xE0, 0x1C, 0x0F, 0x80, 0x1C,
+    0x9E, 0x03, 0x1F, 0xFC, 0x1F, 0x1F, 0x9C, 0x07, 0x1F, 0x08, 0x00, 0x1C,
+    0x0E, 0x00, 0x1C, 0x0F, 0x80, 0x00, 0x9F, 0xF0, 0x00, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xC7, 0xF8, 0x07, 0x3F, 0x83, 0xE0, 0x07, 0x3F, 0x91, 0x80, 0xC7, 0xFF,
+    0x39, 0x07, 0xC7, 0xFF, 0x19, 0x01, 0xC7, 0xFF, 0x82, 0x00, 0x07, 0x3F,
+    0xC7, 0x80, 0x07, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x03, 0x9F,
+    0x9E, 0x03, 0xFF, 0x98, 0x03, 0xFF, 0x80, 0x63, 0xFF, 0x81, 0xE3, 0x9F,
+    0x87, 0xE3, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F, 0x1F, 0x1F,
+    0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x83, 0x1E, 0x1F, 0x83, 0xF8, 0x1F,
+    0x83, 0xF8, 0x1F, 0xFF, 0xFE, 0xFF,
+    // 0xC7 'Ç'
+    0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x87, 0xFC, 0x1F, 0xFF,
+    0x8F, 0xFE, 0x1B, 0xBF, 0x8F, 0xFE, 0x13, 0x3F, 0x1F, 0xFF, 0x10, 0x3F,
+    0x1F, 0xFF, 0x10, 0x7F, 0x0F, 0xFF, 0x18, 0xFF, 0x07, 0xFF, 0x1F, 0xFF,
+    0x81, 0xFF, 0x1F, 0xFF, 0x81, 0xFF, 0x1F, 0xFF, 0xC7, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xCF, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F,
+    0x87, 0x00, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xE3, 0x1E, 0x3E, 0x3F, 0xF3, 0x1E, 0x3E, 0x3F, 0xFF, 0x1E, 0x3E, 0x3F,
+    0xFF, 0x1E, 0x3E, 0x3F, 0xFF, 0x07, 0x38, 0x3F, 0xFF, 0x07, 0xF0, 0x3F,
+    0xFF, 0x0F, 0xF8, 0x7F,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xC7, 0x1E, 0x3E, 0x3F, 0x87, 0x1E, 0x3E, 0x3F, 0x87, 0x1E, 0x3E, 0x3F,
+    0xFF, 0x1E, 0x3E, 0x3F, 0xFF, 0x07, 0x38, 0x3F, 0xFF, 0x07, 0xF0, 0x3F,
+    0xFF, 0x0F, 0xF8, 0x7F,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F,
+    0xC3, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F, 0x8F, 0x1F, 0x3E, 0x3F,
+    0x8F, 0x1E, 0x3E, 0x3F, 0xC7, 0x1E, 0x3E, 0x3F, 0xC3, 0x1E, 0x3E, 0x3F,
+    0xF3, 0x1E, 0x3E, 0x3F, 0xFF, 0x07, 0x38, 0x3F, 0xFF, 0x07, 0xF0, 0x3F,
+    0xFF, 0x0F, 0xF8, 0x7F,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0xFC, 0x7C, 0xF8, 0x9C, 0x78, 0xF8, 0x0C, 0x78, 0xF8, 0x0C, 0x78, 0xF8,
+    0x1C, 0x78, 0xF8, 0xFC, 0x1C, 0xE0, 0xFC, 0x1F, 0xC0, 0xFC, 0x3F, 0xE1,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0x3F, 0x87, 0x3F, 0xFF, 0x3F,
+    0x87, 0x00, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F,
+    0xE3, 0x00, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x3F, 0xFF, 0x3F,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F,
+    0xC7, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F, 0x87, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x3F, 0xFF, 0x3F,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x3F, 0xFF, 0x3F, 0xE3, 0x3F, 0xFF, 0x3F,
+    0xC3, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F,
+    0x8F, 0x00, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x3F, 0xC3, 0x3F, 0xFF, 0x3F,
+    0xF3, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0x0C, 0xFF, 0xFC, 0x0C, 0xFF, 0xFC, 0x0C, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x0C, 0xFF, 0xFC, 0x1C, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x87, 0xFE, 0x1F, 0x83, 0xFC, 0x3F, 0xC0, 0xF0, 0x3F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFE, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0x8E, 0x03, 0xFC, 0x7F, 0x8F, 0x01, 0xFE, 0x7F, 0x1F, 0x80, 0xFE, 0x7F,
+    0x8F, 0xE0, 0x3F, 0xFF, 0x8F, 0xF0, 0x1F, 0xFF, 0xC7, 0xF8, 0x07, 0xFF,
+    0x87, 0xFE, 0x03, 0xFF, 0x8E, 0x7F, 0x00, 0xFF, 0xDE, 0x7F, 0xC0, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0x0F, 0xF8, 0x3F,
+    0x87, 0x1F, 0xFC, 0x3F, 0xC7, 0x1F, 0xFE, 0x3F, 0xC6, 0x3F, 0xFE, 0x1F,
+    0xE2, 0x3F, 0xFE, 0x3F, 0xF2, 0x1F, 0xFE, 0x3F, 0xFF, 0x1F, 0xFE, 0x3F,
+    0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0x01, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x0F, 0xF8, 0x3F,
+    0xFF, 0x1F, 0xFC, 0x3F, 0xF3, 0x1F, 0xFE, 0x3F, 0xE2, 0x3F, 0xFE, 0x1F,
+    0xC2, 0x3F, 0xFE, 0x3F, 0xC6, 0x1F, 0xFE, 0x3F, 0x87, 0x1F, 0xFE, 0x3F,
+    0x8F, 0x0F, 0xFC, 0x3F, 0xFF, 0x01, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xF3, 0x0F, 0xF8, 0x3F,
+    0xE3, 0x1F, 0xFC, 0x3F, 0xC7, 0x1F, 0xFE, 0x3F, 0x8E, 0x3F, 0xFE, 0x1F,
+    0x8E, 0x3F, 0xFE, 0x3F, 0x8E, 0x1F, 0xFE, 0x3F, 0xC7, 0x1F, 0xFE, 0x3F,
+    0xE3, 0x0F, 0xFC, 0x3F, 0xF3, 0x01, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x8E, 0x1F, 0xF0, 0x7F,
+    0x8E, 0x3F, 0xF8, 0x7F, 0x1E, 0x3F, 0xFC, 0x7F, 0x8C, 0x7F, 0xFC, 0x3F,
+    0x8C, 0x7F, 0xFC, 0x7F, 0xC4, 0x3F, 0xFC, 0x7F, 0x86, 0x3F, 0xFC, 0x7F,
+    0x8E, 0x1F, 0xF8, 0x7F, 0xDE, 0x03, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0x9E, 0x00, 0x00, 0xFF, 0x0C, 0x3F, 0xE0, 0xFF,
+    0x0C, 0x7F, 0xF0, 0xFF, 0x1C, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F,
+    0xF8, 0xFF, 0xF8, 0xFF, 0x18, 0x7F, 0xF8, 0xFF, 0x0C, 0x7F, 0xF8, 0xFF,
+    0x0C, 0x3F, 0xF0, 0xFF, 0x1C, 0x07, 0xC1, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0xCF, 0x9F, 0x87, 0x1F, 0x82, 0x1F, 0xC0, 0x3F, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC2, 0x1F, 0x87, 0x1F, 0xCF, 0x9F, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0x9F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x87, 0xF0, 0x1F, 0x8F, 0xE2, 0x1F,
+    0x8F, 0xC7, 0x0F, 0x1F, 0x8F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0E, 0x3F, 0x1F,
+    0x0C, 0x7F, 0x1F, 0x80, 0xFE, 0x1F, 0x80, 0xF8, 0x3F, 0xC0, 0x00, 0x3F,
+    0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x98, 0x03, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xCF, 0x00, 0x00, 0x3F, 0x87, 0x3F, 0xFC, 0x3F, 0x87, 0x3F, 0xFE, 0x3F,
+    0xC7, 0xFF, 0xFE, 0x1F, 0xE3, 0xFF, 0xFE, 0x1F, 0xE3, 0xFF, 0xFE, 0x1F,
+    0xF3, 0x3F, 0xFE, 0x3F, 0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFC, 0x3F, 0xF3, 0x3F, 0xFE, 0x3F,
+    0xE3, 0xFF, 0xFE, 0x1F, 0xE3, 0xFF, 0xFE, 0x1F, 0xC7, 0xFF, 0xFE, 0x1F,
+    0x87, 0x3F, 0xFE, 0x3F, 0x87, 0x3F, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x3F, 0xFC, 0x3F, 0xC3, 0x3F, 0xFE, 0x3F,
+    0x87, 0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xFE, 0x1F,
+    0xC7, 0x3F, 0xFE, 0x3F, 0xC3, 0x3F, 0xFC, 0x3F, 0xF3, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0x0C, 0x00, 0x00, 0xFF, 0x0C, 0xFF, 0xF0, 0xFF, 0x0C, 0xFF, 0xF8, 0xFF,
+    0x9F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0x9F, 0xFF, 0xF8, 0x7F,
+    0x0C, 0xFF, 0xF8, 0xFF, 0x0C, 0xFF, 0xF0, 0xFF, 0x1C, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x91, 0xF8, 0x9F,
+    0x91, 0xF8, 0x9F, 0xB1, 0xF9, 0x9F, 0xF1, 0xF9, 0xFF, 0xF8, 0xE1, 0xFF,
+    0xF8, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x81, 0xFF, 0xFF, 0x8F, 0xFF, 0xCF,
+    0x9F, 0x87, 0x87, 0x9F, 0x03, 0x87, 0x8E, 0x01, 0xE7, 0x80, 0x00, 0xE7,
+    0x80, 0x60, 0x47, 0x80, 0xF0, 0x07, 0xC1, 0xF8, 0x0F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0x7F,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0x87, 0xFF, 0xC7, 0x03, 0xDF, 0x86, 0x03, 0x8F, 0x86, 0x03,
+    0x87, 0x1C, 0x63, 0xC3, 0x1C, 0x73, 0xE3, 0x1C, 0x63, 0xF7, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0x87, 0xFF, 0xC7, 0x03, 0xFF, 0x86, 0x03, 0xFF, 0x86, 0x03,
+    0xFF, 0x1C, 0x63, 0xE3, 0x1C, 0x73, 0x83, 0x1C, 0x63, 0x07, 0x00, 0x07,
+    0x8F, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0x87, 0xFF, 0xC7, 0x03, 0xFB, 0x86, 0x03, 0xE3, 0x86, 0x03,
+    0xC3, 0x1C, 0x63, 0x87, 0x1C, 0x73, 0x8F, 0x1C, 0x63, 0x87, 0x00, 0x07,
+    0xC3, 0x00, 0x03, 0xF3, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0x0F, 0xFF, 0x8E, 0x07, 0x8F, 0x0C, 0x07, 0x8F, 0x0C, 0x07,
+    0x9E, 0x38, 0xC7, 0x8E, 0x38, 0xE7, 0xCE, 0x38, 0xC7, 0xC6, 0x00, 0x0F,
+    0x86, 0x00, 0x07, 0x8F, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x07,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF,
+    // 0xE4 'ä'
+    0xFF, 0xFE, 0x1F, 0x9F, 0x1C, 0x0F, 0x0E, 0x18, 0x0F, 0x0E, 0x18, 0x0F,
+    0x1C, 0x71, 0x8F, 0xFC, 0x71, 0xCF, 0xFC, 0x71, 0x8F, 0x9C, 0x00, 0x1F,
+    0x0C, 0x00, 0x0F, 0x0E, 0x00, 0x0F, 0x9E, 0x00, 0x0F, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0x87, 0xFF, 0xC7, 0x03, 0xFF, 0x86, 0x03, 0x83, 0x86, 0x03,
+    0x81, 0x1C, 0x63, 0x39, 0x1C, 0x73, 0x39, 0x1C, 0x63, 0x01, 0x00, 0x07,
+    0x83, 0x00, 0x03, 0xEF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7,
+    // 0xE6 'æ'
+    0xFF, 0x87, 0xC7, 0x03, 0x86, 0x03, 0x86, 0x03, 0x1C, 0x63, 0x1C, 0x73,
+    0x1C, 0xE3, 0x00, 0x63, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0x8C, 0x83,
+    0x1C, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x08, 0xE3, 0x00, 0xE3, 0x81, 0xE3,
+    0xC1, 0xE7, 0xE1, 0xFF,
+    // 0xE7 'ç'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF,
+    0x80, 0x03, 0xFF, 0x0F, 0x83, 0x77, 0x1F, 0xE2, 0x67, 0x1F, 0xE2, 0x07,
+    0x1F, 0xE2, 0x0F, 0x07, 0xE3, 0x1F, 0x03, 0xE3, 0xFF, 0x87, 0xE3, 0xFF,
+    0xEF, 0xE7, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03,
+    0x8F, 0x80, 0x03, 0x07, 0x0C, 0xC3, 0x87, 0x1C, 0xE3, 0xE3, 0x1C, 0xE3,
+    0xF3, 0x1C, 0xE3, 0xFF, 0x00, 0xE3, 0xFF, 0x00, 0xE3, 0xFF, 0x80, 0xE3,
+    0xFF, 0xC0, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x0C, 0xC3, 0xF3, 0x1C, 0xE3, 0xC3, 0x1C, 0xE3,
+    0x07, 0x1C, 0xE3, 0x8F, 0x00, 0xE3, 0xDF, 0x00, 0xE3, 0xFF, 0x80, 0xE3,
+    0xFF, 0xC0, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFB, 0x80, 0x03,
+    0xF3, 0x80, 0x03, 0xC3, 0x0C, 0xC3, 0x87, 0x1C, 0xE3, 0x8F, 0x1C, 0xE3,
+    0x8F, 0x1C, 0xE3, 0xC3, 0x00, 0xE3, 0xE3, 0x00, 0xE3, 0xF3, 0x80, 0xE3,
+    0xFF, 0xC0, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0x0E, 0x00, 0x0F,
+    0x0E, 0x00, 0x0F, 0x0C, 0x33, 0x0F, 0x9C, 0x73, 0x8F, 0xFC, 0x73, 0x8F,
+    0x9C, 0x73, 0x8F, 0x0C, 0x03, 0x8F, 0x0C, 0x03, 0x8F, 0x1E, 0x03, 0x8F,
+    0xFF, 0x03, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xF3, 0x0F, 0x1F, 0xF3, 0x87, 0x00, 0x03,
+    0xC3, 0x00, 0x03, 0xF3, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0xF3, 0x00, 0x03,
+    0xC3, 0x00, 0x03, 0x87, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x9F, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x1F, 0xF3, 0x87, 0x00, 0x03,
+    0x8F, 0x00, 0x03, 0x8F, 0x00, 0x03, 0x87, 0x00, 0x03, 0xE3, 0xFF, 0xF3,
+    0xF3, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0x9F, 0xFF, 0xFF, 0x0E, 0x7F, 0xCF, 0x0C, 0x7F, 0xCF, 0x9C, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0x9C, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x0F, 0xFF, 0xCF,
+    0x0F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F,
+    0xF3, 0x00, 0x07, 0x82, 0x0F, 0x07, 0x06, 0x3F, 0xC7, 0x86, 0x3F, 0xE7,
+    0x82, 0x3F, 0xE7, 0x80, 0x1F, 0xC7, 0x30, 0x00, 0x07, 0xB8, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xE7, 0xFE, 0x00, 0x07,
+    0xFE, 0x00, 0x07, 0x8E, 0x00, 0x07, 0x8F, 0x00, 0x07, 0x9F, 0x1F, 0xE7,
+    0x8E, 0x3F, 0xFF, 0xCE, 0x3F, 0xFF, 0xC6, 0x1F, 0xE7, 0x86, 0x00, 0x07,
+    0x8E, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03,
+    0x9F, 0x80, 0x03, 0x0F, 0x07, 0x83, 0x87, 0x1F, 0xE3, 0xC3, 0x1F, 0xF3,
+    0xE3, 0x1F, 0xF3, 0xFF, 0x0F, 0xE3, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x7F,
+    // 0xF3 'ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x07, 0x83, 0xF7, 0x1F, 0xE3, 0xE3, 0x1F, 0xF3,
+    0x83, 0x1F, 0xF3, 0x07, 0x0F, 0xE3, 0x9F, 0x00, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x7F,
+    // 0xF4 'ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03,
+    0xF3, 0x80, 0x03, 0xE3, 0x07, 0x83, 0x83, 0x1F, 0xE3, 0x8F, 0x1F, 0xF3,
+    0x8F, 0x1F, 0xF3, 0x87, 0x0F, 0xE3, 0xC3, 0x00, 0x03, 0xF3, 0x80, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x7F,
+    // 0xF5 'õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0x8F, 0x00, 0x07, 0x8E, 0x0F, 0x07, 0x9E, 0x3F, 0xC7, 0x8E, 0x3F, 0xE7,
+    0xC6, 0x3F, 0xE7, 0xC6, 0x1F, 0xC7, 0x86, 0x00, 0x07, 0x8F, 0x00, 0x0F,
+    0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0x9E, 0x00, 0x0F,
+    0x0E, 0x00, 0x0F, 0x0C, 0x1E, 0x0F, 0x1C, 0x7F, 0x8F, 0xFC, 0x7F, 0xCF,
+    0xFC, 0x7F, 0xCF, 0x0C, 0x3F, 0x8F, 0x0C, 0x00, 0x0F, 0x0E, 0x00, 0x1F,
+    0x9E, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0xC1, 0xFF,
+    // 0xF7 '÷'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x8F, 0x09, 0x8F,
+    0x09, 0x8F, 0x99, 0x8F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xF0, 0x13, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x03, 0x0F, 0x03,
+    0x1E, 0x23, 0x1C, 0x73, 0x18, 0xF3, 0x11, 0xE3, 0x01, 0x83, 0x80, 0x07,
+    0x80, 0x07, 0x00, 0x0F, 0xB0, 0x7F, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0x8F, 0x00, 0x03, 0x07, 0xBF, 0xC3, 0x87, 0xFF, 0xE3,
+    0xE3, 0xFF, 0xE3, 0xF3, 0x9F, 0xE3, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xBF, 0xC3, 0xE3, 0xFF, 0xE3,
+    0xC3, 0xFF, 0xE3, 0x07, 0x9F, 0xE3, 0x8F, 0x80, 0x07, 0xDF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFB, 0x00, 0x03, 0xF3, 0x00, 0x03, 0xC3, 0xBF, 0xC3, 0x87, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x87, 0x9F, 0xE3, 0xC3, 0x80, 0x07, 0xE3, 0x00, 0x03,
+    0xFB, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
+    0x0C, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x0E, 0xFF, 0x0F, 0x9F, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x8F, 0x9E, 0x7F, 0x8F, 0x0E, 0x00, 0x1F, 0x0C, 0x00, 0x0F,
+    0x1C, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xCF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0x80, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0xFF, 0x3F, 0xE7, 0x9F, 0xFE, 0x3F, 0xE7, 0x9F,
+    0xFE, 0x3F, 0xC7, 0xFF, 0xFE, 0x1F, 0x87, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFE, 0xFF, 0xFE, 0x7F, 0xFC, 0x7F, 0xFE, 0x3F, 0xFC, 0x3F, 0xFE, 0x3F,
+    0x9C, 0x0F, 0xFE, 0x3F, 0x0C, 0x01, 0xFE, 0x3F, 0x0C, 0x00, 0x7C, 0x3F,
+    0x1C, 0x00, 0x18, 0x7F, 0xFC, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
+    0x9F, 0xFE, 0x03, 0xFF, 0x0E, 0xF0, 0x0F, 0xFF, 0x0C, 0x40, 0x3F, 0xFF,
+    0x9C, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+    0xFC, 0x03, 0x9F, 0xFF, 0xF0, 0x03, 0x9F, 0xFF, 0xC0, 0x63, 0xFF, 0xFF,
+    0x83, 0xE3, 0xFF, 0xFF, 0x80, 0xE3, 0xFF, 0xFF, 0x00, 0x03, 0x9F, 0xFF,
+    0xC0, 0x03, 0x99, 0xFF, 0xF0, 0x00, 0x10, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x0C, 0x7F, 0xFF, 0xFE, 0x1C, 0xFF,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0x87, 0xFF, 0xC7, 0x03, 0xFF, 0x86, 0x03, 0xFF, 0x86, 0x03, 0xFF,
+    0x1C, 0x63, 0xFF, 0x1C, 0x73, 0xFF, 0x1C, 0x63, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x02, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF0, 0x01, 0x8F,
+    0xFF, 0xF3, 0x9F, 0xFF, 0xF7, 0xDF,
+    // 0x106 'Ć'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x0F, 0xF8, 0x3F,
+    0xFF, 0x1F, 0xFC, 0x3F, 0xF3, 0x1F, 0xFC, 0x3F, 0xE2, 0x3F, 0xFE, 0x3F,
+    0xC6, 0x3F, 0xFE, 0x3F, 0xC6, 0x1F, 0xFE, 0x3F, 0x86, 0x0F, 0xFE, 0x3F,
+    0xCF, 0x03, 0xFE, 0x3F, 0xFF, 0x03, 0xFE, 0x3F, 0xFF, 0x8F, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07,
+    0xFF, 0x80, 0x03, 0xFF, 0x0F, 0x83, 0xE3, 0x1F, 0xE3, 0xC3, 0x1F, 0xE3,
+    0x07, 0x1F, 0xE3, 0x8F, 0x07, 0xE3, 0xDF, 0x03, 0xE3, 0xFF, 0x87, 0xE3,
+    0xFF, 0xEF, 0xE7,
+    // 0x10C 'Č'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0x9F, 0x80, 0x00, 0x3F, 0x8F, 0x0F, 0xF8, 0x3F,
+    0xC7, 0x1F, 0xFC, 0x3F, 0xE3, 0x1F, 0xFC, 0x3F, 0xF2, 0x3F, 0xFE, 0x3F,
+    0xE2, 0x3F, 0xFE, 0x3F, 0xC6, 0x1F, 0xFE, 0x3F, 0x8E, 0x0F, 0xFE, 0x3F,
+    0x9F, 0x03, 0xFE, 0x3F, 0xFF, 0x03, 0xFE, 0x3F, 0xFF, 0x8F, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0x9F, 0xC0, 0x07,
+    0x8F, 0x80, 0x03, 0x87, 0x0F, 0x83, 0xE3, 0x1F, 0xE3, 0xE3, 0x1F, 0xE3,
+    0xC3, 0x1F, 0xE3, 0x87, 0x07, 0xE3, 0x9F, 0x03, 0xE3, 0xBF, 0x87, 0xE3,
+    0xFF, 0xEF, 0xE7,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xDF, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F,
+    0xC7, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F, 0xE3, 0x3F, 0xFE, 0x3F,
+    0xE3, 0x3F, 0xFE, 0x3F, 0xC3, 0x1F, 0xFE, 0x3F, 0x8F, 0x1F, 0xFE, 0x3F,
+    0x9F, 0x0F, 0xFC, 0x3F, 0xBF, 0x07, 0xF8, 0x7F, 0xFF, 0x81, 0xE0, 0x7F,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x07, 0xFE, 0x0F, 0x87, 0xFE, 0x3F, 0xC7, 0xDE, 0x3F, 0xC7,
+    0xCE, 0x3F, 0xC7, 0x8E, 0x3F, 0x8F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF,
+    0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x8F, 0x9F, 0x1F, 0xFF,
+    0x8F, 0x1F, 0x10, 0xFF, 0x8F, 0x1F, 0x00, 0xFF, 0x8F, 0x1F, 0x00, 0x7F,
+    0x8F, 0x1F, 0x0C, 0x7F, 0x83, 0x9C, 0x1C, 0x7F, 0x83, 0xF8, 0x1C, 0xFF,
+    0x87, 0xFC, 0x3F, 0xFF,
+    // 0x119 'ę'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0xFF,
+    0x80, 0x03, 0xFF, 0x0C, 0xC3, 0xFF, 0x1C, 0xE3, 0xFF, 0x1C, 0xE3, 0x3F,
+    0x1C, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0xE1, 0x8F, 0x80, 0xE3, 0x8F,
+    0xC0, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F,
+    0xC3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xE3, 0x1E, 0x3E, 0x3F, 0xC7, 0x1E, 0x3E, 0x3F, 0x8F, 0x1E, 0x3E, 0x3F,
+    0x9F, 0x1E, 0x3E, 0x3F, 0xFF, 0x07, 0x38, 0x3F, 0xFF, 0x07, 0xF0, 0x3F,
+    0xFF, 0x0F, 0xF8, 0x7F,
+    // 0x11B 'ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0x9F, 0x80, 0x03,
+    0x8F, 0x80, 0x03, 0x87, 0x0C, 0xC3, 0xE3, 0x1C, 0xE3, 0xE3, 0x1C, 0xE3,
+    0xC3, 0x1C, 0xE3, 0x87, 0x00, 0xE3, 0x9F, 0x00, 0xE3, 0xBF, 0x80, 0xE3,
+    0xFF, 0xC0, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F,
+    0xC7, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F, 0x8F, 0x3F, 0xFE, 0x3F,
+    0xFF, 0x3F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x7F,
+    // 0x13A 'ĺ'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xF6, 0x3F, 0xFF, 0x9F, 0xE6, 0x00, 0x00, 0x1F,
+    0xC6, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F,
+    0x8E, 0x00, 0x00, 0x1F, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xE0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+    0xE7, 0xFF, 0xC7, 0xE7, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xF1, 0xFF, 0xC7,
+    0x81, 0xFF, 0xC7, 0x87, 0xFE, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x0F,
+    // 0x13E 'ľ'
+    0xDF, 0xFF, 0xF7, 0x8F, 0xFF, 0xE7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7,
+    0xE1, 0xFF, 0xF7, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F, 0xE7, 0x9F, 0x9F, 0xCF, 0x9F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9E, 0x3F, 0x1F, 0x9E, 0x7F, 0x1F, 0xFE, 0x7F, 0x1F,
+    0xFE, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF8, 0x3F,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xF7, 0x8F, 0xF3, 0xE7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xFF, 0x3F, 0xE7, 0xFF, 0x3F, 0xF7, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x01, 0xFE, 0x3F, 0xFF, 0x80, 0xFF, 0x3F, 0xF3, 0xC0, 0x7F, 0x3F,
+    0xE3, 0xF0, 0x1F, 0xFF, 0xC3, 0xF8, 0x0F, 0xFF, 0xC7, 0xFC, 0x03, 0xFF,
+    0x87, 0xFF, 0x01, 0xFF, 0x8F, 0x3F, 0x80, 0x7F, 0xFF, 0x3F, 0xE0, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x8F, 0xF3,
+    0xE3, 0x1F, 0xFF, 0x83, 0x1F, 0xFF, 0x07, 0x0F, 0xF3, 0x8F, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xDF, 0x00, 0x00, 0x3F,
+    0x8F, 0x01, 0xFE, 0x3F, 0x87, 0x80, 0xFF, 0x3F, 0xC3, 0xC0, 0x7F, 0x3F,
+    0xE3, 0xF0, 0x1F, 0xFF, 0xE3, 0xF8, 0x0F, 0xFF, 0xC3, 0xFC, 0x03, 0xFF,
+    0x87, 0xFF, 0x01, 0xFF, 0x9F, 0x3F, 0x80, 0x7F, 0xBF, 0x3F, 0xE0, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0x8F, 0x00, 0x03, 0x87, 0x80, 0x03, 0xC3, 0x8F, 0xF3,
+    0xE3, 0x1F, 0xFF, 0xE3, 0x1F, 0xFF, 0x87, 0x0F, 0xF3, 0x8F, 0x00, 0x03,
+    0x9F, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFE, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC0, 0xF0, 0x3F, 0xC3, 0xFC, 0x1F, 0x87, 0xFE, 0x1F, 0x8F, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x9F, 0x8F, 0xFF, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x8F, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F,
+    0x8F, 0x1F, 0x1F, 0x83, 0x1C, 0x1F, 0x83, 0xF8, 0x1F, 0x87, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x07, 0x83,
+    0x1F, 0xE3, 0x1F, 0xF3, 0x1F, 0xF3, 0x0F, 0xE3, 0x00, 0x03, 0x80, 0x07,
+    0xC0, 0x07, 0x80, 0x03, 0x80, 0x83, 0x1C, 0xE3, 0x1C, 0xE3, 0x1C, 0xE3,
+    0x0C, 0xE3, 0x00, 0xE3, 0x80, 0xE3, 0xC0, 0xE3, 0xE0, 0xEF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xDF, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F,
+    0xC3, 0x00, 0x00, 0x3F, 0xE3, 0x1F, 0x1E, 0x3F, 0xE3, 0x3F, 0x0F, 0x3F,
+    0xC3, 0x1F, 0x07, 0x3F, 0x87, 0x1E, 0x03, 0xFF, 0x9F, 0x04, 0x00, 0xFF,
+    0xBF, 0x00, 0x20, 0x7F, 0xFF, 0x80, 0x70, 0x3F, 0xFF, 0x80, 0xF8, 0x3F,
+    0xFF, 0xE1, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x159 'ř'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0x8F, 0x00, 0x03,
+    0x87, 0x00, 0x03, 0xC3, 0x00, 0x03, 0xE3, 0xC0, 0x03, 0xE3, 0x8F, 0xF3,
+    0x87, 0x0F, 0xF3, 0x8F, 0x0F, 0xFF, 0x9F, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0x80, 0x70, 0x3F,
+    0xFF, 0x00, 0x3C, 0x3F, 0xF7, 0x00, 0x3E, 0x3F, 0xF3, 0x1C, 0x1F, 0x1F,
+    0xE2, 0x3C, 0x1F, 0x1F, 0xC6, 0x3E, 0x0E, 0x3F, 0x86, 0x3E, 0x0E, 0x3F,
+    0x87, 0x0F, 0x00, 0x3F, 0xCF, 0x03, 0x00, 0x7F, 0xFF, 0x07, 0x80, 0x7F,
+    0xFF, 0xFF, 0xC1, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xC1, 0x83, 0xFF, 0x80, 0x83, 0xFF, 0x00, 0xE3,
+    0xF3, 0x10, 0x73, 0xC3, 0x38, 0x73, 0x87, 0x38, 0x33, 0x0F, 0x1C, 0x03,
+    0x9F, 0x04, 0x03, 0xFF, 0x86, 0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xC0, 0xF0, 0x3F, 0x9F, 0x80, 0x70, 0x3F,
+    0x8F, 0x00, 0x3C, 0x3F, 0xC7, 0x00, 0x3E, 0x3F, 0xE3, 0x1C, 0x1F, 0x1F,
+    0xF2, 0x3C, 0x1F, 0x1F, 0xE2, 0x3E, 0x0E, 0x3F, 0xC6, 0x3E, 0x0E, 0x3F,
+    0x8F, 0x0F, 0x00, 0x3F, 0x9F, 0x03, 0x00, 0x7F, 0xFF, 0x07, 0x80, 0x7F,
+    0xFF, 0xFF, 0xC1, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xC7, 0x9F, 0xC1, 0x83, 0x8F, 0x80, 0x83, 0x87, 0x00, 0xE3,
+    0xC3, 0x10, 0x73, 0xE3, 0x38, 0x73, 0xC3, 0x38, 0x33, 0x87, 0x1C, 0x03,
+    0x8F, 0x04, 0x03, 0xBF, 0x86, 0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xBF, 0x8F, 0x1F, 0xFF, 0x3F,
+    0x87, 0x1F, 0xFF, 0x3F, 0xC3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x3F,
+    0xE3, 0x00, 0x00, 0x3F, 0xC3, 0x00, 0x00, 0x3F, 0x87, 0x1F, 0xFE, 0x3F,
+    0x8F, 0x1F, 0xFF, 0x3F, 0x9F, 0x1F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0x0F,
+    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFE, 0x3F, 0xC7,
+    0xFE, 0x3F, 0xC7, 0x02, 0x3F, 0xC7, 0x06, 0x3F, 0xC7, 0x9F, 0xFF, 0xCF,
+    // 0x16E 'Ů'
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xC7, 0x3F, 0xFC, 0x3F, 0x83, 0x3F, 0xFE, 0x3F,
+    0x91, 0xFF, 0xFE, 0x1F, 0x39, 0xFF, 0xFE, 0x1F, 0x11, 0xFF, 0xFE, 0x1F,
+    0x83, 0x3F, 0xFE, 0x3F, 0xC7, 0x3F, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xC3, 0x00, 0x03, 0x81, 0xBF, 0xC3, 0x39, 0xFF, 0xE3,
+    0x39, 0xFF, 0xE3, 0x11, 0x9F, 0xE3, 0x83, 0x80, 0x07, 0xC7, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xE3, 0x3F, 0xFC, 0x3F, 0xC3, 0x3F, 0xFE, 0x3F,
+    0x87, 0xFF, 0xFE, 0x1F, 0x0F, 0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xFE, 0x1F,
+    0xF3, 0x3F, 0xFE, 0x3F, 0xE3, 0x3F, 0xFC, 0x3F, 0xC7, 0x00, 0x00, 0x3F,
+    0x87, 0x00, 0x00, 0x7F, 0x0F, 0x00, 0x00, 0xFF, 0x9F, 0x00, 0x01, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x03, 0xF3, 0x00, 0x03, 0xC3, 0xBF, 0xC3, 0x07, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0xFF, 0x9F, 0xE3, 0xE3, 0x80, 0x07, 0x83, 0x00, 0x03,
+    0x07, 0x00, 0x03, 0x9F, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF,
+    0x9C, 0x0F, 0xFF, 0x0C, 0x03, 0xFC, 0x0C, 0x00, 0xFC, 0x1C, 0xC0, 0x00,
+    0xFC, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x9F, 0xF8, 0x00, 0x0C, 0xE0, 0x00,
+    0x0C, 0x81, 0xFC, 0x1C, 0x03, 0xFC, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x3F, 0xFF, 0x03, 0xF8, 0x3F,
+    0xFF, 0x07, 0xE0, 0x3F, 0xFF, 0x1F, 0xC0, 0x3F, 0xFF, 0x1F, 0x80, 0x3F,
+    0xF3, 0x1E, 0x02, 0x3F, 0xE3, 0x1C, 0x06, 0x3F, 0xC7, 0x10, 0x1E, 0x3F,
+    0xC7, 0x00, 0x3E, 0x3F, 0x87, 0x00, 0xFE, 0x3F, 0xCF, 0x01, 0xFE, 0x3F,
+    0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0x0F, 0xF0, 0x3F, 0xFF, 0x9F, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xE3, 0xFF, 0x07, 0x83, 0xFF, 0x0F, 0x03,
+    0xFF, 0x1E, 0x03, 0xF3, 0x1C, 0x03, 0xC3, 0x10, 0x23, 0x87, 0x00, 0x63,
+    0x8F, 0x00, 0xE3, 0x9F, 0x03, 0xE3, 0xFF, 0x07, 0xC3, 0xFF, 0x0F, 0x83,
+    0xFF, 0x9F, 0x87,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xF8, 0x7F, 0xFE, 0x07, 0xF0, 0x7F,
+    0xFE, 0x0F, 0xC0, 0x7F, 0xFE, 0x3F, 0x80, 0x7F, 0xFE, 0x3F, 0x00, 0x7F,
+    0x8E, 0x3C, 0x04, 0x7F, 0x06, 0x38, 0x0C, 0x7F, 0x06, 0x20, 0x3C, 0x7F,
+    0x8E, 0x00, 0x7C, 0x7F, 0xFE, 0x01, 0xFC, 0x7F, 0xFE, 0x03, 0xFC, 0x7F,
+    0xFE, 0x0F, 0xF0, 0x7F, 0xFE, 0x1F, 0xE0, 0x7F, 0xFF, 0x3F, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC7, 0xFE, 0x0F, 0x07, 0xFE, 0x1E, 0x07,
+    0xDE, 0x3C, 0x07, 0x86, 0x38, 0x07, 0x86, 0x20, 0x47, 0x86, 0x00, 0xC7,
+    0x8E, 0x01, 0xC7, 0xFE, 0x07, 0xC7, 0xFE, 0x0F, 0x87, 0xFE, 0x1F, 0x07,
+    0xFF, 0x3F, 0x0F,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x3F, 0xFF, 0x03, 0xF8, 0x3F,
+    0x9F, 0x07, 0xE0, 0x3F, 0x8F, 0x1F, 0xC0, 0x3F, 0xC7, 0x1F, 0x80, 0x3F,
+    0xE3, 0x1E, 0x02, 0x3F, 0xF3, 0x1C, 0x06, 0x3F, 0xE3, 0x10, 0x1E, 0x3F,
+    0xC7, 0x00, 0x3E, 0x3F, 0x8F, 0x00, 0xFE, 0x3F, 0x9F, 0x01, 0xFE, 0x3F,
+    0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0x0F, 0xF0, 0x3F, 0xFF, 0x9F, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xE3, 0x9F, 0x07, 0x83, 0x8F, 0x0F, 0x03,
+    0x87, 0x1E, 0x03, 0xE3, 0x1C, 0x03, 0xE3, 0x10, 0x23, 0xC3, 0x00, 0x63,
+    0x87, 0x00, 0xE3, 0x9F, 0x03, 0xE3, 0xBF, 0x07, 0xC3, 0xFF, 0x0F, 0x83,
+    0xFF, 0x9F, 0x87,
+    // 0x3C0 'π'
+    0xE7, 0xFF, 0x83, 0xFF, 0x07, 0xFF, 0x0F, 0xE3, 0x0E, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x0F, 0x0F, 0xFF, 0x0F, 0xFF, 0x0C, 0x0F, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x0F, 0xE3, 0x1F, 0xE3, 0x1F, 0xE7, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xFF, 0xFF,
+    0x8F, 0xFC, 0x3F, 0x1F, 0xF8, 0x1F, 0x1E, 0x1C, 0x1F, 0x1C, 0x1F, 0x1F,
+    0x80, 0x1F, 0x8F, 0x80, 0x0F, 0x8F, 0x81, 0x87, 0x1F, 0xC7, 0x80, 0x1F,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2018 '‘'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x8C, 0xFF, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xDE, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xEF, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0x9E, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0xEF, 0xFF,
+    // 0x201B '‛'
+    0xFF, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x8C, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x8C, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0xBF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xDE, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xEF, 0xFF,
+    0xFE, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0x9E, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0xEF, 0xFF,
+    0xFE, 0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201F '‟'
+    0xFF, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x8C, 0x7F, 0xFF, 0xFF,
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xFE, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xB8, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF,
+    0xF8, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0x87, 0x83, 0x03, 0x03, 0x83, 0xC7,
+    // 0x2026 '…'
+    0x8F, 0x0F, 0x07, 0x0F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0F, 0x0F,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x0F, 0x07, 0x0F, 0x8F,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x8E, 0x3F,
+    0x1F, 0x3F, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xBF, 0xBF, 0x1F, 0x3F, 0x8C, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF,
+    0xF1, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x8F, 0xC7, 0x9F, 0xC7,
+    0x9F, 0xC7, 0x8F, 0x8F, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF0, 0x3F, 0xE1, 0x3F, 0xC7, 0x3F,
+    0x80, 0x0F, 0x80, 0x07, 0x80, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xC7, 0x81, 0xC7, 0x81, 0xC7, 0x81, 0xC7, 0x98, 0x8F,
+    0x98, 0x0F, 0x9C, 0x1F, 0x9E, 0x3F,
+    // 0x2076 '⁶'
+    0xFC, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xC1, 0x87, 0x81, 0xC7, 0x89, 0xC7,
+    0x98, 0x07, 0x98, 0x0F, 0x9C, 0x1F, 0xFE, 0x3F,
+    // 0x2077 '⁷'
+    0xFF, 0xFF, 0x87, 0xFF, 0x87, 0xCF, 0x9F, 0x07, 0x9C, 0x07, 0x90, 0x1F,
+    0x80, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0x1F, 0xC2, 0x0F, 0x80, 0x0F, 0x80, 0xC7, 0x98, 0xE7, 0x98, 0xE7,
+    0x80, 0x07, 0x80, 0x0F, 0xC6, 0x1F, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xE3, 0xEF, 0xC1, 0xE7, 0x80, 0xC7, 0x88, 0xC7, 0x9C, 0x8F, 0x9C, 0x0F,
+    0x80, 0x1F, 0x80, 0x1F, 0xC0, 0x7F, 0xFB, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x8F, 0xC7, 0x9F, 0xC7,
+    0x9F, 0xC7, 0x8F, 0x87, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xCF, 0xEF, 0xCF, 0xCF, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x0F, 0xFF, 0xCF, 0xFF, 0xEF,
+    // 0x2082 '₂'
+    0xEF, 0xCF, 0xC7, 0x8F, 0x87, 0x8F, 0x8F, 0x0F, 0x9E, 0x0F, 0x98, 0x4F,
+    0x80, 0xCF, 0x81, 0xCF, 0xC3, 0xCF, 0xFF, 0xCF,
+    // 0x2083 '₃'
+    0xFF, 0xEF, 0xCF, 0xC7, 0x8D, 0xC7, 0x9C, 0xC7, 0x98, 0xC7, 0x90, 0x87,
+    0x80, 0x0F, 0x80, 0x0F, 0xC6, 0x1F, 0xFF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xE1, 0x3F, 0xC7, 0x3F,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xC7, 0x81, 0xC7, 0x81, 0xC7, 0x81, 0xC7, 0x98, 0x87,
+    0x98, 0x0F, 0x9C, 0x1F, 0x9E, 0x3F,
+    // 0x2086 '₆'
+    0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC1, 0x87, 0x81, 0xC7, 0x89, 0xC7,
+    0x98, 0x07, 0x98, 0x0F, 0x9C, 0x0F, 0xFE, 0x3F,
+    // 0x2087 '₇'
+    0xFF, 0xFF, 0x87, 0xFF, 0x87, 0xCF, 0x9F, 0x07, 0x9C, 0x07, 0x90, 0x1F,
+    0x80, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x1F, 0xC2, 0x0F, 0x80, 0x07, 0x80, 0xC7, 0x98, 0xE7, 0x98, 0xE7,
+    0x80, 0x07, 0x80, 0x0F, 0xC6, 0x1F, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xE3, 0xEF, 0xC0, 0xE7, 0x80, 0xC7, 0x88, 0xC7, 0x9C, 0x07, 0x9C, 0x0F,
+    0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x7F, 0xFB, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AC '€'
+    0xFF, 0xE7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x00, 0xFF,
+    0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x20, 0x1F, 0xC3, 0x26, 0x1F,
+    0x87, 0x27, 0x1F, 0x8F, 0x27, 0x1F, 0x8F, 0x27, 0x1F, 0x8F, 0x7F, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x81, 0xFF, 0x1F, 0x81, 0xFF, 0x1F, 0xC7, 0xFF, 0x3F,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2122 '™'
+    0xFF, 0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0x9F, 0x3F, 0x80, 0x3F, 0x80, 0x3F,
+    0x9F, 0x3F, 0x9F, 0x7F, 0x8F, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0x90, 0x3F,
+    0x80, 0x3F, 0x87, 0x3F, 0x81, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF, 0x87, 0x7F,
+    0x80, 0x3F, 0x80, 0x3F, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3, 0xC7,
+    0xFF, 0xF3, 0x83, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xC0, 0xFF, 0xFF, 0x83, 0x8F, 0xCF, 0xCF, 0x8F, 0xCF, 0xFF, 0x19, 0xCF,
+    0xFF, 0x39, 0xCF, 0xFF, 0x11, 0x8F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F,
+    0xFF, 0x84, 0x1F, 0xFF, 0xFF, 0x7F,
+    // 0x2154 '⅔'
+    0xF3, 0xF7, 0xFF, 0xE3, 0xE3, 0xFF, 0xC1, 0xC3, 0xFF, 0xC7, 0x83, 0xFF,
+    0xCF, 0x03, 0xFF, 0xC6, 0x23, 0xFF, 0xC0, 0x23, 0xFF, 0xE0, 0x63, 0xE7,
+    0xE1, 0xE3, 0x83, 0xFF, 0xE7, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0x81, 0x8F, 0xCF, 0x87, 0x8F, 0xCF, 0xDF, 0x19, 0xCF,
+    0xFF, 0x39, 0xCF, 0xFF, 0x11, 0x8F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F,
+    0xFF, 0x84, 0x1F, 0xFF, 0xFF, 0x7F,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF3, 0xE7,
+    0xFF, 0xF3, 0x83, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xC1, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xE0, 0xFF, 0xBF, 0x83, 0xC6, 0x1F, 0x87, 0x80, 0x0F, 0xDF, 0x80, 0x0F,
+    0xFF, 0x31, 0xCF, 0xFF, 0x38, 0xCF, 0xFF, 0x10, 0xCF, 0xFF, 0x80, 0x0F,
+    0xFF, 0x86, 0x1F, 0xFF, 0xEF, 0x3F,
+    // 0x215C '⅜'
+    0xF7, 0xF7, 0xFF, 0xE3, 0xF3, 0xFF, 0xC6, 0x73, 0xFF, 0xCE, 0x73, 0xFF,
+    0xCC, 0x63, 0xFF, 0xC0, 0x63, 0xFF, 0xC0, 0x07, 0xF7, 0xC0, 0x07, 0xC7,
+    0xE3, 0x0F, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF,
+    0xC1, 0xFF, 0xBF, 0x83, 0xC6, 0x1F, 0xCF, 0x80, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x31, 0xCF, 0xFF, 0x38, 0xCF, 0xFF, 0x10, 0xCF, 0xFF, 0x80, 0x0F,
+    0xFF, 0x86, 0x1F, 0xFF, 0xEF, 0x3F,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFE, 0xF3, 0xFF, 0xC0, 0xF3, 0xFF, 0xC0, 0xF3, 0xFF,
+    0xC4, 0x63, 0xFF, 0xC4, 0x63, 0xFF, 0xC4, 0x07, 0xF7, 0xC6, 0x07, 0xC7,
+    0xCF, 0x0F, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF,
+    0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF,
+    0x81, 0xFF, 0xBF, 0x87, 0xC6, 0x1F, 0xCF, 0x80, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x31, 0xCF, 0xFF, 0x38, 0xCF, 0xFF, 0x10, 0xCF, 0xFF, 0x80, 0x0F,
+    0xFF, 0x86, 0x1F, 0xFF, 0xEF, 0x3F,
+    // 0x215E '⅞'
+    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC3, 0xE7, 0xFF, 0xC7, 0x83, 0xFF,
+    0xC6, 0x03, 0xFF, 0xC4, 0x0F, 0xF7, 0xC0, 0x7F, 0xC7, 0xC1, 0xFF, 0x03,
+    0xC3, 0xFE, 0x0F, 0xEF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF,
+    0x87, 0xFF, 0xBF, 0xCF, 0xC6, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x31, 0xCF, 0xFF, 0x38, 0xCF, 0xFF, 0x10, 0xCF, 0xFF, 0x80, 0x0F,
+    0xFF, 0x86, 0x1F, 0xFF, 0xEF, 0x3F,
+    // 0x2190 '←'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x99, 0x9F,
+    0xD9, 0xBF, 0xF9, 0xFF, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    // 0x2191 '↑'
+    0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xC7, 0x80, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC7, 0xC0, 0x7F,
+    0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF1, 0xFF, 0xF9, 0xFF, 0xD9, 0xBF, 0x99, 0x9F, 0x80, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF,
+    0x80, 0x78, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xF8, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF7, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x89, 0x1F,
+    0x99, 0x9F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x9F,
+    0x89, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xE1, 0xE1, 0xFF, 0xC3, 0xF0, 0xFF,
+    0x87, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x87, 0xF8, 0x7F,
+    0xC3, 0xF0, 0xFF, 0xE1, 0xE1, 0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF1, 0x8F, 0xE1, 0x87,
+    0xC1, 0x83, 0x89, 0x91, 0xD9, 0x9B, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F,
+    0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F,
+    0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xD9, 0x9B, 0x89, 0x91, 0xC1, 0x83,
+    0xE1, 0x87, 0xF1, 0x8F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xE3, 0x1F, 0x83, 0x07,
+    0x83, 0x07, 0xD3, 0x2F, 0xF3, 0x3F, 0xF3, 0x3F, 0xD3, 0x2F, 0x83, 0x07,
+    0xC3, 0x0F, 0xE3, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x07, 0xCF, 0x80, 0x07,
+    0x8F, 0x03, 0xC7, 0x9F, 0x1F, 0xC7, 0x9F, 0x3F, 0xC7, 0x9E, 0x3F, 0xC7,
+    0x8E, 0x3F, 0x0F, 0x83, 0x10, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x01, 0xFF, 0xFE, 0x3F, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0x00, 0x1F, 0xF8, 0x07, 0x9F, 0xE0, 0x3F, 0x9F, 0x80, 0xFF, 0x9F,
+    0x83, 0xFF, 0x9F, 0x00, 0xFF, 0x9F, 0x00, 0x1F, 0x9F, 0xC0, 0x03, 0x9F,
+    0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x220F '∏'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF1, 0x87, 0xFF, 0xC1, 0x81, 0xFF, 0x81,
+    0x80, 0xFF, 0x01, 0x80, 0x3C, 0x11, 0x80, 0x18, 0x31, 0x8C, 0x00, 0x71,
+    0x8E, 0x00, 0xF1, 0x8F, 0x83, 0xF1, 0x8F, 0xC7, 0xF1, 0x8F, 0xFF, 0xF1,
+    0x8F, 0xFF, 0xF1, 0x83, 0xFF, 0xC1, 0x81, 0xFF, 0x81, 0x83, 0xFF, 0x81,
+    0xFF, 0xFF, 0x8F,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x3F,
+    0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xE1, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0x1C, 0x7F, 0x1E, 0x7F, 0x1C, 0x7F,
+    0x80, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0x80, 0xFF, 0x8C, 0x7F, 0x1E, 0x7F,
+    0x1E, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC1, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xE7, 0x3F, 0xE6, 0x3F, 0xE6, 0x0F, 0xE6, 0x0F, 0xE6, 0x1F, 0xE0, 0x3F,
+    0xE0, 0x3F, 0xC2, 0x3F, 0x06, 0x3F, 0x86, 0x3F, 0xE6, 0x3F, 0xE6, 0x3F,
+    // 0x2264 '≤'
+    0xF9, 0xFC, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xE0, 0x78, 0xE2, 0x38,
+    0xC6, 0x38, 0xC7, 0x18, 0x8F, 0x18, 0x8F, 0x88, 0x9F, 0x88, 0xDF, 0xD8,
+    // 0x2265 '≥'
+    0xFF, 0xFC, 0x1F, 0x88, 0x0F, 0x88, 0x8F, 0x18, 0xC7, 0x18, 0xC6, 0x38,
+    0xE6, 0x38, 0xE2, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8,
+    // 0x2500 '─'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2502 '│'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x250C '┌'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2514 '└'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x251C '├'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x252C '┬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x253C '┼'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2550 '═'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2551 '║'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255A '╚'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255D '╝'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x256C '╬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F
+};
+
+
+const uint8_t Bookerly26BoldBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x07, 0x40, 0x1A, 0x57, 0x80, 0x00, 0x8F, 0x00, 0x02, 0x0F,
+    0x19, 0xFE, 0x87, 0x00, 0x00, 0x57,
+    // 0x22 '"'
+    0x4E, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x73, 0x7F, 0x00, 0x7F, 0x46, 0xFF,
+    0x00, 0x7F, 0x80, 0xFF, 0x67, 0x7F,
+    // 0x23 '#'
+    0x00, 0x10, 0x7F, 0x02, 0x00, 0x7F, 0x02, 0x0A, 0x7F, 0x02, 0x80, 0x7F,
+    0x00, 0x00, 0x7F, 0x80, 0x04, 0x7F, 0x81, 0x40, 0x7F, 0x92, 0x01, 0x7F,
+    0xC2, 0x08, 0x7F, 0x01, 0x00, 0x7F, 0x10, 0x02, 0x7F, 0x00, 0x08, 0x7F,
+    0x82, 0x80, 0x7F, 0xA2, 0x00, 0x7F, 0x02, 0x30, 0x7F, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0xC1, 0x10, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x08, 0x88, 0x3F, 0x09, 0x80, 0x00, 0x3F, 0x00, 0x40, 0x27, 0xBF,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xA2, 0x22, 0x20, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x04, 0x00, 0x20, 0x3F, 0x02, 0x01, 0x80, 0x3F,
+    // 0x25 '%'
+    0x0C, 0x60, 0x03, 0x10, 0x10, 0x03, 0x20, 0x08, 0x03, 0x0C, 0x48, 0x03,
+    0x40, 0x28, 0x03, 0x40, 0x08, 0x13, 0x00, 0x40, 0x0B, 0x20, 0x01, 0x0B,
+    0x10, 0x22, 0x13, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x03, 0x10, 0x03, 0x04, 0x67, 0x83, 0x10, 0x80, 0x03, 0x00, 0x20, 0x13,
+    0x48, 0x47, 0x83, 0x10, 0x10, 0x0B, 0x00, 0x40, 0x2B, 0x00, 0x08, 0x0B,
+    0x00, 0x40, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x26 '&'
+    0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x40, 0x4F, 0x00, 0x00, 0x0F,
+    0x20, 0x04, 0x0F, 0x00, 0x20, 0x0F, 0x80, 0x10, 0x1F, 0x8D, 0x04, 0x1F,
+    0x00, 0x42, 0x1F, 0x00, 0x01, 0x1F, 0x1C, 0x10, 0x0F, 0x01, 0x08, 0x0F,
+    0x00, 0xA0, 0x2F, 0x10, 0x80, 0x2F, 0x00, 0x80, 0x2F, 0x00, 0x80, 0x0F,
+    0x00, 0x9C, 0x1F, 0x00, 0x80, 0x9F, 0x00, 0xA0, 0x9F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x4F,
+    // 0x27 '''
+    0x4E, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x73, 0x7F,
+    // 0x28 '('
+    0x00, 0xA1, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x61, 0x02, 0x3F, 0x43, 0x00, 0x00, 0x3F, 0x84, 0x00, 0x00, 0xBF,
+    0x10, 0x00, 0x04, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x08, 0xBF, 0x00, 0x80, 0x61, 0x3F, 0x10, 0x1E, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x00, 0xBE, 0x80, 0x3F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x20, 0xBF, 0x00, 0xBF, 0x05, 0x3F, 0x23, 0xFF, 0x00, 0x7F,
+    0x1A, 0x3F, 0x48, 0xBF, 0x02, 0x3F, 0x0A, 0x3F,
+    // 0x2B '+'
+    0x07, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x78, 0xF7, 0x00, 0x07,
+    0x00, 0x07, 0x81, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x01, 0x07,
+    // 0x2C ','
+    0x00, 0x7F, 0x00, 0xFF, 0x50, 0x7F, 0x01, 0x7F, 0x80, 0x7F, 0x8C, 0x7F,
+    0x20, 0x7F,
+    // 0x2D '-'
+    0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2E '.'
+    0x57, 0x8F, 0x87, 0x8F, 0x97, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x06, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x03, 0x03, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x01, 0x80, 0x07, 0x84, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x40, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x00, 0x0F, 0x04, 0x03, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x04, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x08, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0xE0, 0x2F,
+    0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x01, 0xF0, 0x0F,
+    // 0x31 '1'
+    0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x9F, 0x04, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x30, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F,
+    // 0x32 '2'
+    0x0A, 0x00, 0x5F, 0x11, 0x01, 0x3F, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x44, 0x00, 0x1F, 0x00, 0x01, 0x1F, 0x10, 0x01, 0x1F, 0x00, 0x45, 0x1F,
+    0x0E, 0x01, 0x1F, 0x40, 0x01, 0x1F, 0x40, 0x01, 0x1F, 0x20, 0x41, 0x1F,
+    0x09, 0x81, 0x1F, 0x00, 0x00, 0xFF,
+    // 0x33 '3'
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x8F, 0x02, 0x00, 0x8F, 0x40, 0x40, 0x9F,
+    0x40, 0x00, 0x1F, 0x00, 0x90, 0x9F, 0x10, 0x80, 0x1F, 0x01, 0x10, 0x0F,
+    0x04, 0x12, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0xC0, 0x4F, 0x21, 0x40, 0x8F,
+    0x12, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x0C, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x01, 0x10, 0x0F, 0x04, 0x08, 0x0F, 0x00, 0x48, 0x0F, 0x11, 0x08, 0x0F,
+    0x43, 0xF1, 0xEF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x7F, 0xF1, 0xFF, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x06, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x9F, 0x00, 0x01, 0x5F, 0xCC, 0x01, 0x3F, 0x80, 0x01, 0x3F,
+    0x80, 0x00, 0x3F, 0x80, 0x41, 0x3F, 0x90, 0x00, 0x1F, 0x92, 0x02, 0x1F,
+    0x90, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x91, 0x00, 0x9F, 0x90, 0x81, 0x1F,
+    0x60, 0x78, 0x1F,
+    // 0x36 '6'
+    0x00, 0x62, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x08, 0x00, 0x0F,
+    0x10, 0x24, 0x0F, 0x01, 0x20, 0x1F, 0x03, 0x00, 0x9F, 0x05, 0x20, 0x1F,
+    0x48, 0x00, 0x1F, 0x00, 0x01, 0x0F, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x40, 0x8F, 0x20, 0x11, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x82, 0x00, 0x1F, 0x8C, 0x05, 0x9F,
+    0x90, 0x10, 0x3F, 0x90, 0x40, 0x3F, 0x90, 0x80, 0x3F, 0x90, 0x03, 0x1F,
+    0x94, 0x18, 0x1F, 0x90, 0x00, 0x1F, 0x81, 0x00, 0x1F, 0x82, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x04, 0x0F, 0x07, 0x00, 0x0F, 0x20, 0x80, 0x2F, 0x00, 0x20, 0x0F,
+    0x00, 0x0B, 0x0F, 0x48, 0x10, 0x9F, 0x01, 0x00, 0x9F, 0x00, 0x10, 0x9F,
+    0x00, 0x08, 0x9F, 0x44, 0x03, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x20, 0x0F,
+    0x11, 0x10, 0x4F, 0x00, 0x0E, 0x0F,
+    // 0x39 '9'
+    0x07, 0x80, 0x4F, 0x10, 0x20, 0x2F, 0x00, 0x10, 0x9F, 0x00, 0x00, 0x1F,
+    0x05, 0x08, 0x1F, 0x08, 0x41, 0x0F, 0x00, 0x09, 0x0F, 0x00, 0x0A, 0x0F,
+    0x08, 0x0C, 0x0F, 0x01, 0xC0, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x05, 0xD0, 0x0F,
+    // 0x3A ':'
+    0x50, 0x15, 0x88, 0x23, 0x00, 0x21, 0x00, 0x23, 0x00, 0x25, 0x00, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0x1F, 0x20, 0x00, 0x3F, 0x08, 0x06, 0x1F, 0x00, 0x00, 0x5F,
+    0x00, 0x20, 0x1F, 0x88, 0x22, 0x1F, 0x20, 0x00, 0x1F,
+    // 0x3C '<'
+    0x00, 0x07, 0x09, 0x07, 0x08, 0x07, 0x10, 0x07, 0x16, 0x07, 0x06, 0x07,
+    0x21, 0x07, 0x09, 0x07, 0x40, 0x87, 0x00, 0x87, 0x00, 0x07, 0x60, 0x47,
+    // 0x3D '='
+    0xE2, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x81,
+    // 0x3E '>'
+    0x20, 0x27, 0x80, 0x17, 0x90, 0x17, 0x40, 0x87, 0x48, 0x27, 0x21, 0x27,
+    0x01, 0x47, 0x12, 0x47, 0x00, 0x87, 0x00, 0x87, 0x01, 0x07, 0x01, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x50, 0x2F, 0x10, 0x81, 0x1F,
+    0x00, 0x84, 0x0F, 0x90, 0x01, 0x0F, 0x81, 0x00, 0x6F, 0x45, 0x20, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x05, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x0E, 0x00, 0x7F, 0x01, 0x80, 0x20, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x1B, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x02, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x7F, 0x48, 0x08, 0x01, 0x7F,
+    0x09, 0x20, 0x04, 0x7F, 0x40, 0x40, 0x00, 0x7F, 0x02, 0x11, 0x00, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x12, 0x26, 0x80, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x01, 0x00, 0x05, 0x7F, 0x48, 0x3E, 0x00, 0x7F, 0x48, 0x01, 0x00, 0x7F,
+    0x00, 0x01, 0x40, 0x7F, 0x22, 0x00, 0x00, 0x7F, 0x10, 0x58, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x06, 0x00, 0x00, 0x7F, 0x00, 0x88, 0x00, 0x7F,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x30, 0x1F, 0x00, 0x00, 0x9F, 0x02, 0x02, 0x1F, 0x18, 0x30, 0x1F,
+    0x40, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x80, 0x80, 0x1F, 0x00, 0x10, 0x3F,
+    0x60, 0x02, 0x1F, 0x00, 0x00, 0x9F, 0x02, 0x00, 0x1F, 0x00, 0x60, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x9F, 0x9F, 0x8F,
+    0x90, 0x80, 0x0F, 0x80, 0x80, 0x8F, 0x00, 0x10, 0x0F, 0x00, 0x0B, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0xC0, 0x0F, 0x0B, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    // 0x43 'C'
+    0x02, 0x86, 0x0F, 0x08, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x41, 0x08, 0x0F, 0x44, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+    0x10, 0x01, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x0F,
+    0x82, 0x01, 0x0F, 0x00, 0x01, 0x0F, 0x54, 0x01, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x8F,
+    0x90, 0x00, 0x0F, 0x90, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0xF0, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x02, 0x0C, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x90, 0x1F,
+    0x10, 0x90, 0x9F, 0x10, 0x10, 0x9F, 0x10, 0x10, 0x9F, 0x10, 0x10, 0x9F,
+    0x00, 0x10, 0x1F, 0x02, 0xC6, 0x1F, 0x02, 0x04, 0x1F, 0x14, 0x07, 0xBF,
+    // 0x46 'F'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x9F,
+    0x10, 0x10, 0x9F, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x1F, 0x00, 0x10, 0x1F,
+    0x02, 0x10, 0x1F, 0x02, 0x60, 0x1F, 0x04, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0x86, 0x0F, 0x04, 0x00, 0x8F, 0x10, 0x00, 0x4F, 0x20, 0x00, 0x0F,
+    0x01, 0x68, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x10, 0x10, 0x9F, 0x10, 0x20, 0x9F, 0x10, 0x28, 0x1F,
+    0x10, 0x20, 0x0F, 0x82, 0x20, 0x0F, 0x02, 0x20, 0x0F, 0x44, 0x20, 0x2F,
+    0x00, 0x28, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x80, 0x9F,
+    0x00, 0x10, 0x9F, 0x00, 0x10, 0x7F, 0x00, 0x10, 0x1F, 0x00, 0x10, 0x1F,
+    0x40, 0x10, 0x5F, 0x00, 0x10, 0x1F, 0x00, 0x10, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x40, 0x00, 0x7F,
+    // 0x49 'I'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x9F,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0x7F, 0x60, 0x00, 0x04, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x18, 0x7F,
+    0x0F, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x9F, 0x8F,
+    0x01, 0x00, 0x8F, 0x22, 0x04, 0x4F, 0x04, 0x00, 0x0F, 0x68, 0xC1, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x04, 0x2F, 0x08, 0x02, 0x0F,
+    0x10, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0xBF,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x01, 0x30, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x06, 0x30, 0x1F, 0x02, 0x00, 0x1F,
+    0x00, 0x10, 0x1F, 0x20, 0x00, 0x1F, 0x08, 0x01, 0x9F, 0x00, 0x40, 0x1F,
+    0x00, 0x10, 0x5F, 0x01, 0x00, 0x1F, 0x0C, 0x00, 0x1F, 0x20, 0x40, 0x1F,
+    0x02, 0x00, 0x1F, 0x04, 0x60, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x11, 0x98, 0x1F, 0x60, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x40, 0x80, 0x0F,
+    0x10, 0x20, 0x0F, 0x08, 0x10, 0x0F, 0x02, 0x04, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x0F, 0x1F, 0xF8, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x02, 0x8A, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x01, 0x18, 0x2F, 0x44, 0x02, 0x0F, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x1F,
+    0x10, 0x00, 0x0F, 0x10, 0x00, 0x1F, 0x10, 0x00, 0x9F, 0x80, 0x00, 0x0F,
+    0x04, 0x01, 0x2F, 0x02, 0xFC, 0x2F, 0x40, 0x00, 0x4F, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x8F, 0x8F, 0x9F,
+    0x90, 0x48, 0x9F, 0x80, 0x08, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x10, 0x1F,
+    0x00, 0x10, 0x1F, 0x40, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x06, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x02, 0x8A, 0x00, 0x7F, 0x08, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x01, 0x10, 0x00, 0x7F, 0x44, 0x02, 0x00, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x90, 0x00, 0x08, 0x7F, 0x10, 0x00, 0x80, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x29, 0x7F, 0x02, 0xF4, 0x28, 0x7F, 0x40, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x84, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x8F, 0xCF, 0x0F,
+    0x90, 0x40, 0x8F, 0x80, 0x04, 0x0F, 0x80, 0x01, 0x0F, 0x03, 0x00, 0x0F,
+    0x00, 0x28, 0x0F, 0x40, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x1E, 0x00, 0x1F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x06, 0x07, 0xAF, 0x10, 0x80, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x21, 0x1F,
+    0x04, 0x00, 0x9F, 0x90, 0x10, 0x8F, 0x10, 0x00, 0x8F, 0x10, 0x08, 0x1F,
+    0x10, 0x05, 0x0F, 0x84, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x02, 0x20, 0x0F,
+    0x78, 0x01, 0x0F,
+    // 0x54 'T'
+    0x18, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0A, 0x00, 0x1F,
+    0x10, 0x00, 0x5F, 0x10, 0x00, 0x1F, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x1F,
+    0x10, 0x00, 0x9F, 0x10, 0x00, 0x3F, 0x0E, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x38, 0x00, 0x1F,
+    // 0x55 'U'
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x02, 0x0F,
+    0x00, 0x00, 0x1F, 0x40, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x10, 0x01, 0x0F, 0x1F, 0xFC, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x56 'V'
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0xCF,
+    0x01, 0x00, 0x0F, 0x40, 0x20, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    0x60, 0x00, 0xCF, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x60, 0x0F,
+    0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x57 'W'
+    0x60, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x18, 0x00, 0x0F, 0x03, 0x00, 0x0F,
+    0x00, 0x60, 0x0F, 0x00, 0x0C, 0x0F, 0x00, 0x01, 0x0F, 0x08, 0x00, 0x2F,
+    0x00, 0x80, 0x0F, 0x40, 0x08, 0x0F, 0x00, 0x28, 0x0F, 0x00, 0x80, 0x8F,
+    0x08, 0x06, 0x0F, 0x40, 0x10, 0x0F, 0x40, 0xC0, 0x0F, 0x40, 0x18, 0x0F,
+    0x60, 0x03, 0x0F, 0x08, 0x00, 0x6F, 0x00, 0x40, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x40, 0x0F, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x08, 0x01, 0x1F,
+    0x00, 0x00, 0x1F, 0x02, 0x08, 0x1F, 0x00, 0x80, 0x9F, 0x00, 0x20, 0x1F,
+    0x00, 0x00, 0x1F, 0x04, 0x08, 0x1F, 0x00, 0x04, 0x3F, 0x44, 0x02, 0x1F,
+    0x00, 0x40, 0x1F, 0x01, 0x10, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x04, 0x1F,
+    0x00, 0x01, 0x1F, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x3F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x9F, 0x08, 0x0F, 0x9F,
+    0x02, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x10, 0x9F,
+    0x10, 0x20, 0x9F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x8F, 0x3C, 0x01, 0x2F, 0x00, 0x04, 0x0F, 0x04, 0x00, 0x0F,
+    0x10, 0x10, 0x0F, 0x10, 0x40, 0x0F, 0x10, 0x80, 0x8F, 0x02, 0x00, 0x8F,
+    0x00, 0x08, 0x8F, 0x10, 0x00, 0x8F, 0x00, 0x40, 0x8F, 0x01, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x60, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x5B '['
+    0x7F, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0xC0, 0x00, 0x01, 0x3F,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x98, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xC0, 0x80, 0x07, 0x10, 0x30, 0x07, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x60, 0x67, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x07,
+    // 0x5D ']'
+    0xA0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x0F, 0x01, 0x8F, 0x00, 0x0F, 0x30, 0x37, 0xC1, 0x87,
+    0x0C, 0x07, 0x0C, 0x07, 0x80, 0x87, 0x30, 0x07, 0x04, 0x0F, 0x00, 0x0F,
+    0x00, 0x6F, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0x01, 0x41, 0x09, 0x41, 0x05, 0x11, 0x01,
+    // 0x61 'a'
+    0x10, 0xC1, 0x41, 0x05, 0x00, 0x01, 0x82, 0x03, 0x90, 0x53, 0x22, 0x91,
+    0x22, 0x05, 0x10, 0x81, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x10, 0x11,
+    0x00, 0x15, 0x00, 0x09,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x4F, 0xFF, 0xEB,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x7F, 0x1F, 0xE7,
+    0x01, 0x20, 0x27, 0x01, 0x00, 0x27, 0x00, 0x20, 0x27, 0x00, 0x00, 0xC3,
+    0x01, 0x00, 0x0B, 0x01, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x60, 0xC3,
+    0x00, 0x00, 0x03,
+    // 0x63 'c'
+    0x00, 0x01, 0x00, 0x31, 0x20, 0x01, 0x40, 0x05, 0x00, 0x01, 0x08, 0x81,
+    0x80, 0x23, 0x20, 0x03, 0x10, 0x13, 0x84, 0x13, 0x00, 0x11, 0x00, 0x01,
+    0x20, 0x01,
+    // 0x64 'd'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x87, 0x00, 0x00, 0x07, 0x10, 0x00, 0x23,
+    0x50, 0x40, 0x23, 0x4E, 0x3F, 0x8B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13,
+    // 0x65 'e'
+    0x00, 0x01, 0x00, 0x31, 0x00, 0x09, 0x00, 0x01, 0x00, 0x01, 0x04, 0x21,
+    0x24, 0x03, 0x24, 0x13, 0x04, 0x03, 0x8C, 0x03, 0x00, 0x11, 0x40, 0x05,
+    0x00, 0x09, 0x04, 0x01,
+    // 0x66 'f'
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x04, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x81, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x30, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x01, 0x47, 0x00, 0x00, 0x27, 0x00, 0x40, 0x17, 0x40, 0x80, 0x17,
+    0x80, 0x00, 0x87, 0x90, 0x50, 0x47, 0x20, 0x02, 0x07, 0x00, 0x02, 0x07,
+    0x20, 0x02, 0x47, 0x90, 0x42, 0x17, 0x00, 0x02, 0x87, 0x80, 0x80, 0x07,
+    0x91, 0x10, 0x07, 0x20, 0x08, 0x47, 0x00, 0x02, 0x87, 0x80, 0x00, 0x07,
+    // 0x68 'h'
+    0x20, 0x00, 0x0F, 0x10, 0x00, 0x17, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x01, 0x20, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x1F,
+    // 0x69 'i'
+    0x00, 0xC0, 0x0F, 0x01, 0x40, 0x17, 0x00, 0x3F, 0xE7, 0x40, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x1F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x80, 0x00, 0x8F,
+    0x01, 0x00, 0x01, 0x0F, 0x48, 0x00, 0x0C, 0x2F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x0F, 0x71, 0x00, 0x08, 0x0F,
+    // 0x6B 'k'
+    0x20, 0x00, 0x0B, 0x10, 0x00, 0x13, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0xC3, 0x00, 0x09, 0x13,
+    0x01, 0x00, 0x83, 0x00, 0x00, 0x23, 0x00, 0x0C, 0x03, 0x00, 0x12, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x40, 0x47, 0x00, 0x40, 0x07, 0x00, 0x80, 0x13,
+    0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x30, 0x00, 0x17, 0x10, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x17,
+    // 0x6D 'm'
+    0x60, 0x03, 0x00, 0x0B, 0x1F, 0xF3, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x10, 0x03, 0x10, 0x03, 0x80, 0x07, 0x10, 0x0B, 0x00, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x40, 0x03, 0x08, 0x03, 0x10, 0x0F, 0x00, 0x03,
+    0x10, 0x03, 0x08, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x10, 0x03,
+    0x00, 0x03, 0x00, 0x0F,
+    // 0x6E 'n'
+    0x60, 0x03, 0x00, 0x0B, 0x1F, 0xF3, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x10, 0x03, 0x10, 0x03, 0x80, 0x03, 0x00, 0x0B, 0x07, 0xF3,
+    0x80, 0x03, 0x80, 0x03, 0x40, 0x03, 0x0F, 0xF3, 0x00, 0x03, 0x00, 0x03,
+    // 0x6F 'o'
+    0x00, 0x01, 0x00, 0x31, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x81,
+    0x80, 0x13, 0x20, 0x13, 0x00, 0x13, 0x00, 0x11, 0x84, 0x41, 0x80, 0x05,
+    0x40, 0x01, 0x20, 0x01, 0x17, 0xC1,
+    // 0x70 'p'
+    0x40, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x12, 0x4F, 0x90, 0x12, 0x0F,
+    0x80, 0x12, 0x0F, 0x10, 0x02, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x07, 0x00, 0x0F,
+    // 0x71 'q'
+    0x00, 0x00, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x0F, 0x04, 0x82, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x10, 0x2F,
+    0x20, 0x04, 0x0F, 0x1F, 0xC5, 0xCF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F,
+    // 0x72 'r'
+    0x20, 0x07, 0x00, 0x0B, 0x1F, 0xF3, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x20, 0x03, 0x48, 0x13, 0x10, 0x03, 0x10, 0x0F, 0x00, 0x03, 0x30, 0x03,
+    // 0x73 's'
+    0x1C, 0x7D, 0x02, 0x41, 0x01, 0x01, 0x00, 0x93, 0xA8, 0x83, 0x20, 0x03,
+    0x24, 0x03, 0x24, 0x31, 0x92, 0x05, 0x8A, 0x01, 0x79, 0x11, 0x00, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x40, 0x02, 0x3F,
+    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x10, 0x04, 0x7F,
+    0x00, 0x02, 0x7F, 0x00, 0x02, 0x3F, 0x00, 0x00, 0xBF, 0x08, 0x02, 0x3F,
+    // 0x75 'u'
+    0x00, 0x01, 0x00, 0x01, 0x9F, 0xE1, 0x00, 0x05, 0x00, 0x01, 0x80, 0x03,
+    0xBF, 0xE3, 0x00, 0x13, 0x40, 0x11, 0x20, 0x15, 0x80, 0x01, 0x00, 0x05,
+    0x00, 0x03, 0x00, 0x03, 0x7F, 0xF1, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x76 'v'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x0D, 0x22, 0x01, 0xC0, 0xC1, 0x00, 0xC1, 0x00, 0x01, 0x18, 0x01,
+    0x00, 0xC1, 0x03, 0x01, 0x00, 0x01, 0x20, 0x01, 0xC0, 0x01,
+    // 0x77 'w'
+    0x40, 0x01, 0x00, 0x01, 0x18, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x30, 0x01, 0x01, 0x81, 0x00, 0x81, 0x06, 0x01, 0x30, 0x41, 0x83, 0x01,
+    0x81, 0x01, 0x80, 0x21, 0x28, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x20, 0x09, 0x00, 0xC1, 0x00, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01,
+    // 0x78 'x'
+    0x00, 0x07, 0x20, 0x03, 0x00, 0x03, 0x00, 0x23, 0x04, 0x43, 0x02, 0x83,
+    0x20, 0x2B, 0x50, 0x03, 0x08, 0x43, 0x50, 0x1B, 0x00, 0x03, 0x04, 0x83,
+    0x08, 0x43, 0x00, 0x03, 0x20, 0x03, 0x80, 0x0F,
+    // 0x79 'y'
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x08, 0x07, 0x22, 0x00, 0x27,
+    0xC0, 0xC0, 0x47, 0x00, 0xC0, 0x07, 0x80, 0x00, 0x07, 0x18, 0x00, 0x07,
+    0x00, 0xC0, 0x07, 0x03, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0xC0, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x01, 0xB8, 0x25, 0x04, 0x01, 0x18, 0x81, 0x00, 0x01, 0x04, 0x11,
+    0x00, 0x01, 0x10, 0x81, 0x00, 0x01, 0x02, 0x01, 0x00, 0x61, 0x10, 0x81,
+    0x00, 0x71,
+    // 0x7B '{'
+    0x00, 0x0C, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x36, 0xE3, 0x92, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x00, 0x3F, 0x11, 0x14, 0x20, 0x3F,
+    0x80, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xBF,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
+    // 0x7D '}'
+    0x60, 0x00, 0x01, 0xBF, 0x20, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0x91, 0x10, 0x22, 0x7F, 0x80, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0xE1, 0x80, 0x3F, 0x0C, 0x02, 0x0C, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    // 0x7E '~'
+    0x03, 0x03, 0x43, 0x03, 0x13, 0x03, 0x03, 0x03, 0x23, 0x07, 0x03, 0x03,
+    0x4B, 0x23,
+    // 0xA1 '¡'
+    0x48, 0x00, 0x27, 0x00, 0x70, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x67, 0xE7,
+    // 0xA2 '¢'
+    0x00, 0x16, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x20, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x10, 0x7F,
+    0x00, 0x7C, 0x8C, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xE0, 0x9F, 0xFF,
+    0xC0, 0x00, 0x10, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x41, 0x20, 0x7F, 0x01, 0x80, 0x80, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x0F, 0x00, 0x50, 0xAF, 0x00, 0x50, 0x8F, 0x00, 0x53, 0x0F,
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x20, 0x01, 0x8F, 0x00, 0x04, 0x8F,
+    0x42, 0x50, 0x8F, 0x10, 0x50, 0x8F, 0x10, 0x50, 0x9F, 0x10, 0x10, 0x9F,
+    0x46, 0x40, 0x1F, 0x02, 0x00, 0x1F, 0x20, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x07, 0x00, 0x07, 0x98, 0x87, 0x40, 0x27, 0x00, 0x27, 0x48, 0x07,
+    0x10, 0x87, 0x10, 0x97, 0x48, 0x87, 0x46, 0x27, 0x00, 0x07, 0x00, 0x17,
+    0x86, 0x47, 0x60, 0x27, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x40, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x81, 0x58, 0x3F,
+    0x80, 0x40, 0x3F, 0x80, 0x40, 0x3F, 0x80, 0x01, 0x3F, 0x80, 0x01, 0x3F,
+    0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x3F, 0x88, 0x00, 0x3F,
+    0xA0, 0x41, 0x3F, 0x83, 0x40, 0xFF, 0x89, 0x48, 0x3F, 0x90, 0xC0, 0x3F,
+    0xA0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x27, 0x20, 0x01, 0x17, 0x42, 0x88, 0x07,
+    0x19, 0x00, 0x4F, 0x00, 0x24, 0x0F, 0xA0, 0x02, 0x0F, 0x02, 0x50, 0x07,
+    0x91, 0x21, 0xD7, 0x08, 0x04, 0x07, 0x00, 0x88, 0x07, 0x60, 0x40, 0x07,
+    0x00, 0x1A, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x01, 0x08, 0x0F, 0x14, 0x00, 0x8F,
+    0x00, 0x01, 0x4F, 0x00, 0x70, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x02, 0x0F,
+    0x20, 0x08, 0x1F, 0x8A, 0x01, 0x1F, 0x88, 0x01, 0x0F, 0xA8, 0x00, 0x1F,
+    0x00, 0x80, 0x4F, 0x45, 0x06, 0x4F, 0x50, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    // 0xAA 'ª'
+    0x21, 0x97, 0x40, 0x47, 0x08, 0x07, 0x20, 0x07, 0x25, 0x47, 0x00, 0x87,
+    0x00, 0x47, 0x1E, 0x07, 0x00, 0x1F, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x92, 0x1F,
+    0x20, 0x1F, 0x46, 0x5F, 0x01, 0x1F, 0x20, 0x1F, 0x40, 0x1F, 0x02, 0x5F,
+    0x11, 0x1F, 0xA0, 0x1F, 0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x02, 0x09, 0x30, 0x05, 0x48, 0x0D, 0x40, 0x01,
+    0x00, 0x03, 0x00, 0xA5, 0x06, 0x27, 0x01, 0x81, 0x00, 0x01, 0x10, 0x15,
+    0x00, 0x61, 0x00, 0x31, 0x03, 0x81,
+    // 0xB0 '°'
+    0x1E, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x40, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x0A, 0x5F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0xB1 '±'
+    0x02, 0x07, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F,
+    0x79, 0xF4, 0x7F, 0x80, 0x0C, 0x7F, 0x80, 0x0C, 0x7F, 0x00, 0x04, 0x7F,
+    0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x04, 0x04, 0x7F,
+    // 0xB2 '²'
+    0x28, 0x07, 0x40, 0x4F, 0x00, 0x0F, 0x09, 0x0F, 0x82, 0x4F, 0x90, 0x0F,
+    0x00, 0x0F, 0x40, 0x0F, 0x04, 0x0F, 0x00, 0x27,
+    // 0xB3 '³'
+    0x30, 0x27, 0x08, 0x07, 0x13, 0x0F, 0x84, 0x2F, 0xA0, 0x07, 0x99, 0x0F,
+    0x00, 0x07, 0x42, 0x17, 0x30, 0x27, 0x00, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x1F, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x01, 0x6F, 0x00, 0x22, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x80, 0x04, 0x0F,
+    0x00, 0x02, 0x0F, 0x60, 0x22, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x14, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0xB6 '¶'
+    0x04, 0x40, 0x01, 0x10, 0x10, 0x01, 0x20, 0x00, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01,
+    // 0xB7 '·'
+    0x07, 0x0F, 0x87, 0x0F, 0x4F, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x07, 0x10, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x0F,
+    0x7F, 0xCF, 0x00, 0x2F, 0x00, 0x37,
+    // 0xBA 'º'
+    0x03, 0x07, 0x40, 0x97, 0x08, 0x47, 0xA1, 0x07, 0x21, 0x07, 0x01, 0x07,
+    0x9C, 0x47, 0x00, 0x8F, 0x20, 0x07, 0x0C, 0x07,
+    // 0xBB '»'
+    0x40, 0xDF, 0x01, 0x1F, 0x08, 0x5F, 0x00, 0x1F, 0x20, 0x9F, 0x11, 0x1F,
+    0x08, 0x1F, 0x80, 0x9F, 0x10, 0x1F, 0x0C, 0x1F, 0x00, 0x9F, 0x20, 0x1F,
+    0x10, 0x1F, 0x08, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x03, 0x04, 0x0C, 0x03, 0x14, 0x04, 0x03, 0x04, 0x14, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x3F, 0xF4, 0x03, 0x00, 0x14, 0x13,
+    0x00, 0x08, 0x27, 0x00, 0x00, 0x03, 0x00, 0x02, 0x1B, 0x00, 0x04, 0x23,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x20, 0x03,
+    0x10, 0x80, 0x43, 0x41, 0x02, 0x03, 0x00, 0x08, 0x03, 0x50, 0x02, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x07, 0x33, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x0B,
+    0x00, 0xFE, 0x33, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC3,
+    // 0xBD '½'
+    0x00, 0x00, 0x03, 0x04, 0x0C, 0x03, 0x14, 0x04, 0x03, 0x04, 0x14, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x3F, 0xF4, 0x0B, 0x00, 0x14, 0x03,
+    0x00, 0x08, 0x83, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x62, 0x03, 0x01, 0x8C, 0x03, 0x02, 0x10, 0x03, 0x08, 0x00, 0x03,
+    0x20, 0x10, 0x23, 0x04, 0x40, 0x43, 0x48, 0x08, 0x03, 0x20, 0x91, 0x03,
+    0x00, 0x22, 0x03, 0x00, 0xA4, 0x03, 0x00, 0x10, 0x03, 0x00, 0x81, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x28, 0x03,
+    // 0xBE '¾'
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x10, 0x03, 0x08, 0x10, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x24, 0x03, 0x20, 0x04, 0x03, 0x00, 0x08, 0x0B,
+    0x0C, 0x90, 0x47, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x21, 0x03, 0x00, 0xC4, 0x03, 0x01, 0x18, 0x03, 0x04, 0x20, 0x03,
+    0x10, 0x00, 0x43, 0x02, 0x02, 0x03, 0x4C, 0x08, 0x03, 0x10, 0x02, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x07, 0x33, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x0B,
+    0x00, 0xFE, 0x33, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC3,
+    // 0xBF '¿'
+    0x00, 0x06, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x17,
+    0x48, 0x00, 0x07, 0x09, 0x08, 0x8F, 0x02, 0x00, 0x0F, 0x08, 0x10, 0x8F,
+    0x00, 0xA0, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x20, 0x00, 0x01, 0x3F,
+    0x48, 0x04, 0x04, 0x3F, 0x40, 0x30, 0x60, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x20, 0x08, 0x00, 0x3F, 0x15, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0xC0, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x04, 0x04, 0x3F, 0x00, 0x30, 0x60, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x05, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0xC0, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x0C, 0x00, 0x01, 0x3F,
+    0x10, 0x04, 0x04, 0x3F, 0x04, 0x30, 0x60, 0x3F, 0x48, 0x80, 0x00, 0x3F,
+    0x10, 0x08, 0x00, 0x3F, 0x11, 0x01, 0x00, 0x3F, 0x08, 0x00, 0x20, 0x7F,
+    0x24, 0xC0, 0x04, 0x3F, 0x04, 0x00, 0x01, 0x3F, 0x08, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC0, 0x7F, 0x60, 0x00, 0x02, 0x7F,
+    0x00, 0x08, 0x08, 0x7F, 0x00, 0x60, 0xC0, 0x7F, 0x81, 0x00, 0x00, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x02, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x40, 0xFF,
+    0x89, 0x80, 0x08, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x01, 0x80, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x10, 0x00, 0x04, 0x10, 0x10, 0x10, 0x00, 0xC1, 0x80,
+    0xA2, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x04, 0x00, 0x80, 0x00, 0x81,
+    0x13, 0x00, 0x10, 0x80, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x18, 0x04, 0x04, 0x3F, 0x40, 0x30, 0x60, 0x3F, 0xB8, 0x80, 0x00, 0x3F,
+    0x02, 0x08, 0x00, 0x3F, 0x09, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x7F,
+    0x44, 0xC0, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x18, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x02, 0x1F,
+    0x42, 0x00, 0x7F, 0x0C, 0x10, 0x1F, 0x10, 0x80, 0x1F, 0x03, 0x00, 0x5F,
+    0x04, 0x00, 0x1F, 0x0F, 0xE3, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x10, 0x80, 0x9F, 0x10, 0x90, 0x9F, 0x10, 0x10, 0x9F,
+    0x10, 0x10, 0x9F, 0x10, 0x10, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x68, 0x00, 0x1F, 0x00, 0x02, 0x9F,
+    // 0xC7 'Ç'
+    0x02, 0x86, 0x00, 0x3F, 0x08, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x41, 0x08, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1A, 0xBF, 0x10, 0x01, 0x18, 0x7F,
+    0x10, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x10, 0xBF, 0x04, 0x00, 0x00, 0x3F,
+    0x82, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x54, 0x01, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x04, 0x21, 0x20, 0x3F, 0x20, 0x21, 0x21, 0x3F,
+    0x04, 0x20, 0x21, 0x3F, 0x0C, 0x20, 0x21, 0x3F, 0x00, 0x20, 0x21, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x05, 0x8C, 0x3F, 0x00, 0x04, 0x08, 0x3F,
+    0x00, 0x28, 0x0F, 0x7F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0x14, 0x21, 0x20, 0x3F, 0x20, 0x21, 0x21, 0x3F,
+    0x04, 0x20, 0x21, 0x3F, 0x40, 0x20, 0x21, 0x3F, 0x40, 0x20, 0x21, 0x3F,
+    0x30, 0x00, 0x20, 0x3F, 0x00, 0x05, 0x8C, 0x3F, 0x00, 0x04, 0x08, 0x3F,
+    0x00, 0x28, 0x0F, 0x7F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x40, 0x21, 0x20, 0x3F, 0x00, 0x21, 0x21, 0x3F,
+    0x00, 0x20, 0x21, 0x3F, 0x40, 0x20, 0x21, 0x3F, 0x00, 0x20, 0x21, 0x3F,
+    0x14, 0x00, 0x20, 0x3F, 0x00, 0x05, 0x8C, 0x3F, 0x00, 0x04, 0x08, 0x3F,
+    0x00, 0x28, 0x0F, 0x7F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x60, 0x7F, 0xF8,
+    0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x80,
+    0x00, 0x84, 0x84, 0xE0, 0x80, 0x84, 0x00, 0x80, 0x84, 0x10, 0x80, 0x84,
+    0x90, 0x00, 0x80, 0x60, 0x16, 0x30, 0x00, 0x10, 0x20, 0x00, 0xA0, 0x3D,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x1F, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x0C, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x0C, 0x1F, 0xFF, 0x3F, 0x14, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x01, 0x3F, 0x40, 0x00, 0x01, 0x3F,
+    0x30, 0x00, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x20, 0x1F, 0xFF, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x14, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x60, 0x00, 0x00, 0x80, 0x00, 0x02, 0x10, 0x80, 0x00, 0x00, 0x7F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0x10, 0x00, 0x04, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x60, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x0F, 0x9F, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x8F,
+    0x90, 0x00, 0x0F, 0x90, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0xF0, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x02, 0x0C, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x48, 0x04, 0x00, 0x3F, 0x89, 0x02, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x3F,
+    0x80, 0x20, 0x40, 0x3F, 0x48, 0x08, 0x10, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x40, 0x00, 0x02, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F,
+    0x00, 0x7F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x05, 0x14, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x30, 0x5F, 0x70, 0x88, 0x04, 0x1F,
+    0x08, 0x00, 0x00, 0x3F, 0x41, 0x20, 0x00, 0x3F, 0x24, 0x20, 0x00, 0x1F,
+    0x04, 0x20, 0x00, 0x3F, 0x10, 0x20, 0x01, 0x3F, 0x0D, 0x00, 0x00, 0x1F,
+    0x00, 0x08, 0x02, 0x5F, 0x00, 0x05, 0xF8, 0x5F, 0x00, 0x80, 0x00, 0x9F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x80, 0x1F,
+    // 0xD3 'Ó'
+    0x00, 0x05, 0x14, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x30, 0x5F, 0x00, 0x88, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x20, 0x00, 0x3F, 0x04, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x3F, 0x40, 0x20, 0x01, 0x3F, 0x01, 0x00, 0x00, 0x1F,
+    0x08, 0x08, 0x02, 0x5F, 0x00, 0x05, 0xF8, 0x5F, 0x00, 0x80, 0x00, 0x9F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x80, 0x1F,
+    // 0xD4 'Ô'
+    0x00, 0x05, 0x14, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x02, 0x30, 0x5F, 0x08, 0x88, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x05, 0x20, 0x00, 0x3F, 0x08, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x3F, 0x08, 0x20, 0x01, 0x3F, 0x05, 0x00, 0x00, 0x1F,
+    0x00, 0x08, 0x02, 0x5F, 0x08, 0x05, 0xF8, 0x5F, 0x00, 0x80, 0x00, 0x9F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x80, 0x1F,
+    // 0xD5 'Õ'
+    0x00, 0x0A, 0x28, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x60, 0xBF, 0x49, 0x10, 0x08, 0x3F,
+    0x88, 0x00, 0x00, 0x7F, 0x02, 0x40, 0x00, 0x7F, 0x80, 0x40, 0x00, 0x3F,
+    0x08, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x42, 0x00, 0x00, 0x3F,
+    0x80, 0x10, 0x04, 0xBF, 0x40, 0x0B, 0xF0, 0xBF, 0x01, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x14, 0x50, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x08, 0xC1, 0x7F, 0x02, 0x20, 0x10, 0x7F,
+    0x10, 0x00, 0x00, 0xFF, 0x94, 0x80, 0x00, 0xFF, 0x60, 0x80, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0xFF, 0x10, 0x80, 0x04, 0xFF, 0x14, 0x00, 0x00, 0x7F,
+    0x10, 0x20, 0x09, 0x7F, 0x00, 0x17, 0xE1, 0x7F, 0x02, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x02, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x02, 0x2F, 0x00, 0x4F, 0x10, 0x8F,
+    0x10, 0x0F, 0x20, 0x0F, 0x46, 0x2F, 0x09, 0x1F, 0x50, 0xAF, 0x20, 0x4F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x2F, 0x02, 0x8A, 0x5F, 0x08, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x10, 0x2F, 0x44, 0x08, 0x0F, 0x00, 0x10, 0x1F,
+    0x90, 0x20, 0x8F, 0x10, 0x40, 0x0F, 0x10, 0x80, 0x0F, 0x11, 0x00, 0x1F,
+    0x02, 0x00, 0x0F, 0x04, 0x01, 0x2F, 0x01, 0xFC, 0x2F, 0x40, 0x00, 0x4F,
+    0x00, 0x00, 0x8F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x04, 0x80, 0x01, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x0C, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x02, 0x1F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x0C, 0x00, 0x00, 0x3F,
+    0x14, 0x80, 0x01, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x02, 0x1F, 0x30, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x20, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x02, 0x1F, 0x14, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x10, 0x80, 0x10, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x42, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x10, 0x80, 0x08, 0x7F, 0x90, 0xFF, 0xE1, 0x7F,
+    0x60, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1B, 0xFD, 0x9F,
+    0x28, 0x04, 0x1F, 0x62, 0x01, 0x3F, 0x00, 0x09, 0x1F, 0x08, 0xA0, 0x1F,
+    0x00, 0x02, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x01, 0x10, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0xFF, 0xE3, 0x08, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x45, 0xFF, 0xF3, 0x00, 0x00, 0x73,
+    0x90, 0x20, 0x03, 0x90, 0x04, 0x07, 0x91, 0x02, 0x07, 0x0A, 0x60, 0x07,
+    0x00, 0x10, 0x63, 0x01, 0x00, 0x03, 0x02, 0x00, 0x0B, 0x00, 0x00, 0x13,
+    0x00, 0x01, 0x43,
+    // 0xE0 'à'
+    0x00, 0x10, 0xC1, 0x00, 0x41, 0x05, 0x40, 0x00, 0x01, 0x80, 0x82, 0x03,
+    0x88, 0x90, 0x53, 0x00, 0x22, 0x91, 0x10, 0x22, 0x05, 0x04, 0x10, 0x81,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x11,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x09,
+    // 0xE1 'á'
+    0x00, 0x10, 0xC1, 0x00, 0x41, 0x05, 0x00, 0x00, 0x01, 0x00, 0x82, 0x03,
+    0x08, 0x90, 0x53, 0x10, 0x22, 0x91, 0x04, 0x22, 0x05, 0x08, 0x10, 0x81,
+    0x10, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x11,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x09,
+    // 0xE2 'â'
+    0x00, 0x10, 0xC1, 0x00, 0x41, 0x05, 0x08, 0x00, 0x01, 0x02, 0x82, 0x03,
+    0x44, 0x90, 0x53, 0x00, 0x22, 0x91, 0x10, 0x22, 0x05, 0x48, 0x10, 0x81,
+    0x20, 0x80, 0x01, 0x10, 0x80, 0x03, 0x04, 0x00, 0x03, 0x00, 0x10, 0x11,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x09,
+    // 0xE3 'ã'
+    0x00, 0x21, 0x83, 0x00, 0x82, 0x0B, 0x48, 0x00, 0x03, 0x89, 0x04, 0x07,
+    0x81, 0x20, 0xA7, 0x00, 0x45, 0x23, 0x48, 0x44, 0x0B, 0x08, 0x21, 0x03,
+    0x41, 0x00, 0x03, 0x01, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x20, 0x23,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x13,
+    // 0xE4 'ä'
+    0x00, 0x43, 0x07, 0x01, 0x04, 0x17, 0x80, 0x00, 0x07, 0x92, 0x08, 0x0F,
+    0x12, 0x41, 0x4F, 0x60, 0x8A, 0x47, 0x00, 0x88, 0x17, 0x90, 0x42, 0x07,
+    0x92, 0x00, 0x07, 0x82, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x00, 0x40, 0x47,
+    0x00, 0x00, 0x57, 0x00, 0x00, 0x27,
+    // 0xE5 'å'
+    0x00, 0x10, 0xC1, 0x00, 0x41, 0x05, 0x18, 0x00, 0x01, 0x00, 0x82, 0x03,
+    0x90, 0x90, 0x53, 0x80, 0x22, 0x91, 0x80, 0x22, 0x05, 0x08, 0x10, 0x81,
+    0x04, 0x80, 0x01, 0x28, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x11,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x09,
+    // 0xE6 'æ'
+    0x10, 0x41, 0x00, 0x05, 0x01, 0x01, 0x80, 0x03, 0x90, 0x53, 0x22, 0x13,
+    0x20, 0x81, 0x10, 0x45, 0x80, 0x05, 0x00, 0x01, 0x00, 0x01, 0x0C, 0x81,
+    0x85, 0x23, 0x21, 0x03, 0x20, 0x13, 0x0C, 0x03, 0x00, 0x11, 0x01, 0x01,
+    0x41, 0x05, 0x04, 0x11,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x07, 0x00, 0x30, 0x07, 0x20, 0x00, 0x07, 0x40, 0x04, 0x07,
+    0x00, 0x00, 0x07, 0x08, 0x80, 0x07, 0x80, 0x23, 0x07, 0x20, 0x03, 0x07,
+    0x10, 0x12, 0x07, 0x84, 0x12, 0xA7, 0x00, 0x10, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x04, 0x21, 0x00, 0x24, 0x03, 0x20, 0x24, 0x13,
+    0x04, 0x04, 0x03, 0x00, 0x8C, 0x03, 0x00, 0x00, 0x11, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x01,
+    // 0xE9 'é'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x21, 0x14, 0x24, 0x03, 0x20, 0x24, 0x13,
+    0x00, 0x04, 0x03, 0x80, 0x8C, 0x03, 0x40, 0x00, 0x11, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x0A, 0x00, 0x01, 0x00, 0x04, 0x21, 0x40, 0x24, 0x03, 0x10, 0x24, 0x13,
+    0x08, 0x04, 0x03, 0x00, 0x8C, 0x03, 0x12, 0x00, 0x11, 0x04, 0x40, 0x05,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x01,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x80, 0x10, 0x87, 0x40, 0x90, 0x0F, 0x00, 0x90, 0x4F,
+    0x60, 0x10, 0x0F, 0x92, 0x30, 0x0F, 0x90, 0x00, 0x47, 0x11, 0x00, 0x17,
+    0x00, 0x00, 0x27, 0x00, 0x10, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x60, 0x07, 0x10, 0xA0, 0x0B, 0x08, 0x1F, 0xF3, 0x40, 0x00, 0x03,
+    0x04, 0x80, 0x03, 0x10, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0F,
+    // 0xED 'í'
+    0x00, 0x60, 0x07, 0x00, 0xA0, 0x0B, 0x00, 0x1F, 0xF3, 0x08, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x84, 0x80, 0x03, 0x08, 0x80, 0x03, 0x70, 0x00, 0x03,
+    0x00, 0x00, 0x0F,
+    // 0xEE 'î'
+    0x04, 0x60, 0x07, 0x02, 0xA0, 0x0B, 0x22, 0x1F, 0xF3, 0x04, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x04, 0x80, 0x03, 0x22, 0x00, 0x03,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x03,
+    // 0xEF 'ï'
+    0x91, 0x80, 0x1F, 0x92, 0x80, 0x2F, 0x90, 0x7F, 0xCF, 0x80, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x90, 0x00, 0x0F,
+    0x80, 0x00, 0x3F, 0x60, 0x00, 0x0F,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x63, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x20, 0x00, 0x03, 0x04, 0x09, 0x03, 0x01, 0x00, 0x27, 0x09, 0x40, 0x27,
+    0x01, 0x00, 0x27, 0x00, 0x20, 0x23, 0x30, 0x08, 0x83, 0xC8, 0x00, 0x0B,
+    0x02, 0x00, 0x03, 0x01, 0x80, 0x23, 0x00, 0x2E, 0x83,
+    // 0xF1 'ñ'
+    0x00, 0xC0, 0x07, 0x00, 0x00, 0x17, 0x00, 0x3F, 0xE7, 0x01, 0x00, 0x07,
+    0x21, 0x00, 0x07, 0x48, 0x00, 0x07, 0x88, 0x00, 0x07, 0x80, 0x20, 0x07,
+    0x00, 0x20, 0x07, 0x49, 0x00, 0x07, 0x08, 0x00, 0x17, 0x40, 0x0F, 0xE7,
+    0x01, 0x00, 0x07, 0x21, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x1F, 0xE7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x30, 0x00, 0x01, 0x00, 0x04, 0x81, 0x00, 0x80, 0x13, 0x20, 0x20, 0x13,
+    0x00, 0x00, 0x13, 0x08, 0x00, 0x11, 0x00, 0x84, 0x41, 0x00, 0x80, 0x05,
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x17, 0xC1,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x81, 0x04, 0x80, 0x13, 0x20, 0x20, 0x13,
+    0xC0, 0x00, 0x13, 0x00, 0x00, 0x11, 0x50, 0x84, 0x41, 0x00, 0x80, 0x05,
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x17, 0xC1,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x12, 0x04, 0x81, 0x00, 0x80, 0x13, 0x08, 0x20, 0x13,
+    0x00, 0x00, 0x13, 0x04, 0x00, 0x11, 0x02, 0x84, 0x41, 0x18, 0x80, 0x05,
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0x17, 0xC1,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x63, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03,
+    0x08, 0x00, 0x03, 0x98, 0x09, 0x03, 0x81, 0x00, 0x27, 0x10, 0x40, 0x27,
+    0x40, 0x00, 0x27, 0x08, 0x00, 0x23, 0x81, 0x08, 0x83, 0x11, 0x00, 0x0B,
+    0x00, 0x80, 0x03, 0x00, 0x40, 0x03, 0x00, 0x2F, 0x83,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x07, 0x60, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x90, 0x12, 0x07, 0x12, 0x00, 0x4F, 0x00, 0x80, 0x4F,
+    0x60, 0x00, 0x4F, 0x00, 0x00, 0x47, 0x92, 0x11, 0x07, 0x82, 0x00, 0x17,
+    0x01, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x5F, 0x07,
+    // 0xF7 '÷'
+    0x07, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x71, 0x27, 0x01, 0x07,
+    0x81, 0x87, 0x91, 0x47, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x01, 0x00, 0x2B, 0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0x18, 0x81,
+    0x80, 0x13, 0x00, 0x03, 0x20, 0x03, 0x10, 0x01, 0x81, 0x81, 0x80, 0x05,
+    0x00, 0x01, 0x00, 0x01, 0x87, 0xC1, 0x00, 0x01,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x05,
+    0x20, 0x00, 0x01, 0x10, 0x80, 0x03, 0x00, 0xBF, 0xE3, 0x04, 0x00, 0x13,
+    0x20, 0x40, 0x11, 0x0C, 0x20, 0x15, 0x00, 0x80, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0xBF, 0xE3, 0x04, 0x00, 0x13,
+    0x40, 0x40, 0x11, 0x00, 0x20, 0x15, 0x80, 0x80, 0x01, 0x40, 0x00, 0x05,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFB 'û'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x02, 0x80, 0x03, 0x00, 0xBF, 0xE3, 0x48, 0x00, 0x13,
+    0x10, 0x40, 0x11, 0x00, 0x20, 0x15, 0x04, 0x80, 0x01, 0x12, 0x00, 0x05,
+    0x0C, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x7F, 0x87, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x92, 0x00, 0x0F, 0x82, 0xFF, 0x8F, 0x00, 0x00, 0x4F,
+    0x01, 0x00, 0x47, 0x60, 0x80, 0x57, 0x92, 0x00, 0x07, 0x90, 0x00, 0x17,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x24, 0x9F, 0x01, 0x20, 0x24, 0x1F, 0x01, 0x00, 0x24, 0x1F,
+    0x00, 0x20, 0x04, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x0E, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x02, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x18, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x1F, 0x90, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x20, 0x1F, 0x40, 0x88, 0x00, 0x9F, 0x03, 0x03, 0x01, 0x1F,
+    0x90, 0x03, 0x00, 0x1F, 0x92, 0x00, 0x00, 0x1F, 0x80, 0x60, 0x00, 0x1F,
+    0xE0, 0x03, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x03, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x02, 0x02, 0x00, 0x7F, 0x18, 0x30, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x00, 0x7F, 0x80, 0x80, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x7F,
+    0x60, 0x02, 0x07, 0x7F, 0x00, 0x00, 0x90, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x60, 0x08, 0xFF, 0x00, 0x04, 0x12, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x83, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    // 0x105 'ą'
+    0x10, 0xC0, 0x0F, 0x41, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x82, 0x02, 0x0F,
+    0x90, 0x52, 0x0F, 0x22, 0x90, 0x0F, 0x22, 0x04, 0x0F, 0x10, 0x80, 0x0F,
+    0x80, 0x01, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x4F,
+    0x00, 0x14, 0x1F, 0x00, 0x08, 0x4F,
+    // 0x106 'Ć'
+    0x00, 0x05, 0x0C, 0x1F, 0x00, 0x10, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x82, 0x10, 0x1F, 0x00, 0x88, 0x00, 0x1F,
+    0x0C, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x02, 0x3F,
+    0x24, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x08, 0x08, 0x00, 0x1F,
+    0x71, 0x04, 0x02, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0xA8, 0x02, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x107 'ć'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x20, 0x01, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x81, 0x04, 0x80, 0x23, 0x40, 0x20, 0x03,
+    0x00, 0x10, 0x13, 0x80, 0x84, 0x13, 0x40, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x20, 0x01,
+    // 0x10C 'Č'
+    0x00, 0x05, 0x0C, 0x1F, 0x00, 0x10, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x82, 0x10, 0x1F, 0x08, 0x88, 0x00, 0x1F,
+    0x44, 0x00, 0x00, 0x1F, 0x21, 0x00, 0x00, 0x3F, 0x10, 0x20, 0x02, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x1F,
+    0x01, 0x04, 0x02, 0x1F, 0x40, 0x00, 0x02, 0x1F, 0x00, 0xA8, 0x02, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x20, 0x01, 0x60, 0x40, 0x05,
+    0x88, 0x00, 0x01, 0x04, 0x08, 0x81, 0x20, 0x80, 0x23, 0x10, 0x20, 0x03,
+    0x04, 0x10, 0x13, 0x00, 0x84, 0x13, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x20, 0x01,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x1F, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x41, 0x00, 0x00, 0x1F, 0x25, 0x00, 0x01, 0x1F, 0x01, 0x20, 0x00, 0x1F,
+    0x11, 0x20, 0x01, 0x1F, 0x21, 0x00, 0x01, 0x1F, 0x48, 0x00, 0x00, 0x5F,
+    0x10, 0x00, 0x00, 0x1F, 0x20, 0x80, 0x00, 0x1F, 0x00, 0x81, 0xE0, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x04, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x87, 0x00, 0x00, 0x07, 0x10, 0x00, 0x23,
+    0x50, 0x40, 0x23, 0x4E, 0x3F, 0x8B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x50, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x0F, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x90, 0x00, 0x7F, 0x10, 0x90, 0x80, 0x7F,
+    0x10, 0x10, 0x89, 0x7F, 0x10, 0x10, 0x80, 0xFF, 0x10, 0x10, 0x80, 0x7F,
+    0x00, 0x10, 0x00, 0xFF, 0x02, 0xC6, 0x10, 0x7F, 0x02, 0x04, 0x01, 0x7F,
+    0x14, 0x07, 0xA0, 0x7F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x04, 0x20, 0x0F, 0x24, 0x02, 0x0F, 0x24, 0x13, 0xEF,
+    0x04, 0x02, 0x0F, 0x8C, 0x00, 0x0F, 0x00, 0x12, 0x4F, 0x40, 0x04, 0x0F,
+    0x00, 0x08, 0x6F, 0x04, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x48, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x10, 0x21, 0x20, 0x3F, 0x00, 0x21, 0x21, 0x3F,
+    0x20, 0x20, 0x21, 0x3F, 0x48, 0x20, 0x21, 0x3F, 0x10, 0x20, 0x21, 0x3F,
+    0x20, 0x00, 0x20, 0x3F, 0x00, 0x05, 0x8C, 0x3F, 0x00, 0x04, 0x08, 0x3F,
+    0x00, 0x28, 0x0F, 0x7F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x09, 0x60, 0x00, 0x01,
+    0x88, 0x00, 0x01, 0x04, 0x04, 0x21, 0x20, 0x24, 0x03, 0x10, 0x24, 0x13,
+    0x20, 0x04, 0x03, 0x00, 0x8C, 0x03, 0x90, 0x00, 0x11, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x04, 0x1F, 0xFE, 0x3F, 0x14, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x00, 0x3F, 0x48, 0x00, 0x01, 0x3F,
+    0x30, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x09, 0x7F,
+    // 0x13A 'ĺ'
+    0x00, 0xC0, 0x00, 0x5F, 0x10, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x48, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x04, 0x00, 0x07, 0x03, 0xFF, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x30, 0x00, 0x27,
+    0x00, 0x00, 0x47, 0x0C, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x01, 0x2F,
+    // 0x13E 'ľ'
+    0x30, 0x00, 0x17, 0x10, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x60, 0x00, 0x17, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x20, 0x00, 0x07,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x28, 0x5F, 0x10, 0x08, 0x1F,
+    0x0F, 0xCF, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x02, 0x80, 0x9F,
+    0x01, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0xBF,
+    // 0x142 'ł'
+    0x00, 0x00, 0x07, 0x30, 0x0C, 0x17, 0x10, 0x02, 0x07, 0x40, 0x10, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x81, 0x00, 0x1F, 0x00, 0x20, 0x40, 0x1F,
+    0x14, 0x10, 0x20, 0x1F, 0x00, 0x04, 0x08, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x20, 0x1F,
+    0x00, 0x3F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x144 'ń'
+    0x00, 0x60, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x1F, 0xF3, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x10, 0x03,
+    0x20, 0x10, 0x03, 0x40, 0x80, 0x03, 0x08, 0x00, 0x0B, 0x00, 0x07, 0xF3,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x40, 0x03, 0x00, 0x0F, 0xF3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x81, 0x00, 0x1F, 0x04, 0x20, 0x40, 0x1F,
+    0x00, 0x10, 0x20, 0x1F, 0x00, 0x04, 0x08, 0x1F, 0x24, 0x00, 0x04, 0x1F,
+    0x40, 0x00, 0x01, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x60, 0x20, 0x20, 0x1F,
+    0x00, 0x3F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x60, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x1F, 0xF3, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x03, 0x24, 0x10, 0x03,
+    0x10, 0x10, 0x03, 0x20, 0x80, 0x03, 0x04, 0x00, 0x0B, 0x90, 0x07, 0xF3,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x40, 0x03, 0x00, 0x0F, 0xF3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x152 'Œ'
+    0x02, 0x88, 0x0F, 0x04, 0x00, 0x0F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x4F,
+    0x21, 0xF0, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x1F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x90, 0x8F, 0x10, 0x90, 0x8F, 0x10, 0x10, 0x8F, 0x10, 0x10, 0x8F,
+    0x00, 0x10, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x00, 0x01, 0x00, 0x31, 0x20, 0x01, 0x40, 0x01, 0x00, 0x01, 0x04, 0x81,
+    0x80, 0x13, 0x20, 0x13, 0x00, 0x13, 0x00, 0x11, 0x04, 0x45, 0x00, 0x01,
+    0x40, 0x09, 0x40, 0x01, 0x80, 0x81, 0x84, 0x23, 0x24, 0x13, 0x24, 0x03,
+    0x04, 0x03, 0x80, 0x11, 0x00, 0x11, 0x40, 0x01, 0x0E, 0x09,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x40, 0x1F, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x05, 0x00, 0x00, 0x1F, 0x01, 0x1F, 0x9E, 0x1F, 0x11, 0x20, 0x81, 0x1F,
+    0x25, 0x00, 0x08, 0x1F, 0x41, 0x00, 0x02, 0x1F, 0x10, 0x06, 0x00, 0x1F,
+    0x60, 0x00, 0x50, 0x1F, 0x00, 0x80, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x3C, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x5F,
+    // 0x159 'ř'
+    0x00, 0x20, 0x07, 0x00, 0x00, 0x0B, 0x40, 0x1F, 0xF3, 0x00, 0x80, 0x03,
+    0x08, 0x00, 0x03, 0x24, 0x00, 0x03, 0x10, 0x20, 0x03, 0x20, 0x48, 0x13,
+    0x04, 0x10, 0x03, 0x90, 0x10, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x30, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x0C, 0x0F, 0x5F, 0x00, 0x21, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x42, 0x3F, 0x04, 0x08, 0x01, 0x3F, 0x11, 0x20, 0x21, 0x1F,
+    0x00, 0x20, 0x01, 0x1F, 0x24, 0x20, 0x10, 0x3F, 0x00, 0x20, 0x0A, 0x1F,
+    0x09, 0x08, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x5F, 0x00, 0x04, 0x40, 0x1F,
+    0x00, 0xF0, 0x02, 0x1F,
+    // 0x15B 'ś'
+    0x00, 0x1C, 0x7D, 0x00, 0x02, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x93,
+    0x08, 0xA8, 0x83, 0x00, 0x20, 0x03, 0x84, 0x24, 0x03, 0x08, 0x24, 0x31,
+    0x30, 0x92, 0x05, 0x00, 0x8A, 0x01, 0x00, 0x79, 0x11, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x0C, 0x0F, 0x5F, 0x00, 0x21, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x1F,
+    0x08, 0x80, 0x42, 0x3F, 0x04, 0x08, 0x01, 0x3F, 0x01, 0x20, 0x21, 0x1F,
+    0x10, 0x20, 0x01, 0x1F, 0x00, 0x20, 0x10, 0x3F, 0x04, 0x20, 0x0A, 0x1F,
+    0x01, 0x08, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x04, 0x40, 0x1F,
+    0x00, 0xF0, 0x02, 0x1F,
+    // 0x161 'š'
+    0x00, 0x1C, 0x7D, 0x00, 0x02, 0x41, 0x10, 0x01, 0x01, 0x40, 0x00, 0x93,
+    0x00, 0xA8, 0x83, 0x00, 0x20, 0x03, 0x00, 0x24, 0x03, 0x48, 0x24, 0x31,
+    0x80, 0x92, 0x05, 0x00, 0x8A, 0x01, 0x00, 0x79, 0x11, 0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x60, 0x20, 0x00, 0xBF, 0x10, 0x20, 0x00, 0x3F,
+    0x08, 0x20, 0x01, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFE, 0x3F,
+    0x00, 0x20, 0x01, 0x3F, 0x40, 0x20, 0x00, 0x7F, 0x00, 0x1C, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x70, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x04, 0x00, 0x23,
+    0x08, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x01, 0x00, 0x47,
+    0x3C, 0x00, 0x27, 0x80, 0x00, 0x23, 0x0C, 0x00, 0x0B, 0x00, 0x80, 0x23,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x24, 0x20, 0x04, 0x1F, 0x02, 0x00, 0x00, 0x3F,
+    0x80, 0x80, 0x01, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x28, 0x20, 0x02, 0x1F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x20, 0x80, 0x03, 0x00, 0xBF, 0xE3, 0x2A, 0x00, 0x13,
+    0x80, 0x40, 0x11, 0x32, 0x20, 0x15, 0x00, 0x80, 0x01, 0x28, 0x00, 0x05,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x0C, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x20, 0x02, 0x1F, 0x24, 0x3F, 0xF8, 0x5F,
+    0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x04, 0x80, 0x03, 0x62, 0xBF, 0xE3, 0x84, 0x00, 0x13,
+    0x90, 0x40, 0x11, 0x60, 0x20, 0x15, 0x32, 0x80, 0x01, 0x84, 0x00, 0x05,
+    0x00, 0x00, 0x03, 0x60, 0x00, 0x03, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x08, 0x01, 0x80, 0x04, 0x00, 0x10, 0x00, 0x04, 0x90, 0x40, 0x7C,
+    0x60, 0x10, 0x00, 0x00, 0x04, 0x00, 0x90, 0x00, 0x00, 0x11, 0x00, 0x84,
+    0x10, 0x81, 0x04, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x78, 0x02, 0x5F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x08, 0x00, 0x1F, 0x00, 0x20, 0x20, 0x1F, 0x0C, 0x20, 0x80, 0x1F,
+    0x10, 0x21, 0x01, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x24, 0x00, 0x11, 0x1F,
+    0x40, 0x20, 0x01, 0x1F, 0x08, 0x00, 0x81, 0x1F, 0x70, 0x02, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x01, 0x00, 0xB8, 0x25, 0x00, 0x04, 0x01, 0x00, 0x18, 0x81,
+    0x00, 0x00, 0x01, 0x18, 0x04, 0x11, 0x20, 0x00, 0x01, 0x84, 0x10, 0x81,
+    0x88, 0x00, 0x01, 0x20, 0x02, 0x01, 0x00, 0x00, 0x61, 0x00, 0x10, 0x81,
+    0x00, 0x00, 0x71,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0xF0, 0x04, 0xBF, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x40, 0x40, 0x3F, 0x20, 0x41, 0x00, 0x3F,
+    0x08, 0x42, 0x02, 0x3F, 0x08, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x22, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x00, 0x01, 0x02, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x01, 0x80, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x03, 0x01, 0x70, 0x4B, 0x00, 0x08, 0x03, 0x00, 0x31, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x08, 0x23, 0x88, 0x00, 0x03, 0x00, 0x21, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x21, 0x03,
+    0x00, 0x00, 0xE3,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x78, 0x02, 0x5F, 0x00, 0x00, 0x08, 0x1F,
+    0x20, 0x08, 0x00, 0x1F, 0x08, 0x20, 0x20, 0x1F, 0x44, 0x20, 0x80, 0x1F,
+    0x20, 0x21, 0x01, 0x1F, 0x10, 0x04, 0x01, 0x1F, 0x00, 0x00, 0x11, 0x1F,
+    0x04, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x81, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    0x40, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x01, 0x00, 0xB8, 0x25, 0x00, 0x04, 0x01, 0x00, 0x18, 0x81,
+    0x40, 0x00, 0x01, 0x20, 0x04, 0x11, 0x00, 0x00, 0x01, 0x20, 0x10, 0x81,
+    0x48, 0x00, 0x01, 0x90, 0x02, 0x01, 0x40, 0x00, 0x61, 0x00, 0x10, 0x81,
+    0x00, 0x00, 0x71,
+    // 0x3C0 'π'
+    0x20, 0x01, 0x80, 0x01, 0x0C, 0x01, 0x00, 0x09, 0x02, 0x81, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0xC9, 0x00, 0x01, 0x00, 0x01, 0x0C, 0xE9, 0x00, 0x05,
+    0x00, 0x01, 0x0C, 0xC3, 0x80, 0x11, 0x90, 0x01, 0x00, 0x05, 0xC0, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0xFF, 0xEF, 0x08, 0x00, 0x0F,
+    0x90, 0x01, 0x0F, 0x00, 0x40, 0x2F, 0x00, 0x04, 0x0F, 0x14, 0x00, 0x9F,
+    0x98, 0x10, 0x0F, 0x00, 0x90, 0x0F, 0x02, 0x00, 0x9F, 0x44, 0x40, 0x0F,
+    0x30, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2018 '‘'
+    0x00, 0x7F, 0x19, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x0E, 0xFF, 0x40, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x42, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x28, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x02, 0x7F, 0x28, 0x7F,
+    // 0x201B '‛'
+    0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x4E, 0xFF, 0x01, 0xFF,
+    // 0x201C '“'
+    0x00, 0x7F, 0x19, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x0E, 0xFF, 0x40, 0x7F,
+    0x06, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0x10, 0xFF, 0x01, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x42, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x28, 0x7F,
+    0x61, 0x7F, 0x0C, 0xFF, 0x00, 0xFF, 0x02, 0x7F, 0x10, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x02, 0x7F, 0x28, 0x7F,
+    0x61, 0xFF, 0x18, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x10, 0x7F,
+    // 0x201F '‟'
+    0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x4E, 0xFF, 0x01, 0xFF,
+    0x6C, 0x7F, 0x01, 0x7F, 0x00, 0xFF, 0x50, 0xFF, 0x00, 0xFF,
+    // 0x2020 '†'
+    0x00, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x21, 0x01, 0xBF, 0x80, 0x80, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0xF0, 0x3F,
+    0x41, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x07, 0x00, 0x88, 0x07, 0x00, 0x00, 0x07, 0x04, 0x01, 0x07,
+    0x61, 0x04, 0x37, 0x80, 0x08, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x8D, 0x0F,
+    0x41, 0x04, 0x17, 0x04, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x88, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2022 '•'
+    0x0B, 0x87, 0x03, 0x03, 0x83, 0x73,
+    // 0x2026 '…'
+    0x57, 0x0F, 0x87, 0x07, 0x37, 0x07, 0x07, 0x07, 0x27, 0x87, 0x8F, 0x8F,
+    0x87, 0x27, 0x07, 0x07, 0x07, 0x37, 0x0F, 0x87, 0x0F, 0x17,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x92, 0x1F,
+    0x20, 0x1F, 0x40, 0x5F,
+    // 0x203A '›'
+    0x40, 0xDF, 0x01, 0x1F, 0x08, 0x5F, 0x00, 0x1F, 0x20, 0x9F, 0x11, 0x1F,
+    0x08, 0x1F,
+    // 0x2070 '⁰'
+    0x07, 0x87, 0x10, 0x27, 0x00, 0x17, 0x43, 0x0F, 0x10, 0x47, 0x80, 0x2F,
+    0x80, 0x07, 0x99, 0x8F, 0x00, 0x07, 0x40, 0x07, 0x10, 0x87, 0x00, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x87, 0x01, 0x07, 0x04, 0x07, 0x01, 0x07, 0x10, 0x07, 0x04, 0x07,
+    0x08, 0x2F, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x07, 0x00, 0x07,
+    // 0x2075 '⁵'
+    0x00, 0x17, 0x0E, 0x07, 0x02, 0x0F, 0x00, 0x2F, 0x00, 0x07, 0x11, 0x0F,
+    0x10, 0x07, 0x14, 0x17, 0x62, 0x67,
+    // 0x2076 '⁶'
+    0x05, 0x87, 0x10, 0x17, 0x20, 0x07, 0x01, 0xC7, 0x42, 0x2F, 0x10, 0x0F,
+    0x81, 0x07, 0xA4, 0x07, 0x00, 0x17, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x38, 0x07, 0x00, 0x07, 0x08, 0x47, 0x11, 0x0F, 0x12, 0x0F, 0x10, 0x57,
+    0x01, 0x07, 0x04, 0x07, 0x08, 0x07, 0x40, 0x07,
+    // 0x2078 '⁸'
+    0x10, 0x67, 0x20, 0x07, 0x42, 0x0F, 0x00, 0xA7, 0x81, 0x2F, 0x80, 0x2F,
+    0x90, 0x07, 0x00, 0x07, 0x41, 0x17, 0x00, 0xC7,
+    // 0x2079 '⁹'
+    0x0E, 0x07, 0x41, 0x27, 0x00, 0x0F, 0x88, 0x87, 0x80, 0x8F, 0x80, 0x87,
+    0x08, 0x17, 0x40, 0x07, 0x00, 0xC7, 0x0A, 0x07,
+    // 0x2080 '₀'
+    0x07, 0x87, 0x10, 0x27, 0x00, 0x07, 0x43, 0x07, 0x10, 0x4F, 0x80, 0x0F,
+    0x80, 0x0F, 0x09, 0xC7, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F,
+    0x7F, 0xCF, 0x00, 0x2F, 0x00, 0x3F,
+    // 0x2082 '₂'
+    0x08, 0x07, 0x40, 0x0F, 0x40, 0x8F, 0x19, 0x0F, 0x82, 0x4F, 0x90, 0x0F,
+    0x00, 0x0F, 0x41, 0x0F, 0x24, 0x0F, 0x00, 0x27,
+    // 0x2083 '₃'
+    0x30, 0x27, 0x48, 0x07, 0x13, 0x0F, 0x04, 0x2F, 0xA4, 0x0F, 0x91, 0x07,
+    0x00, 0x07, 0x46, 0x07, 0x30, 0x07, 0x00, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x87, 0x01, 0x07, 0x00, 0x27, 0x08, 0x27, 0x00, 0xA7, 0x24, 0xA7,
+    0x08, 0x27, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0xA7, 0x00, 0xA7,
+    // 0x2085 '₅'
+    0x00, 0x17, 0x0E, 0x07, 0x02, 0x0F, 0x00, 0x0F, 0x00, 0x2F, 0x11, 0x07,
+    0x14, 0x07, 0x14, 0x17, 0x63, 0x67,
+    // 0x2086 '₆'
+    0x05, 0x87, 0x08, 0x07, 0x20, 0x0F, 0x01, 0xC7, 0x0A, 0x0F, 0x10, 0x0F,
+    0x81, 0x07, 0xA4, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x38, 0x07, 0x00, 0x07, 0x08, 0x47, 0x11, 0x0F, 0x12, 0x0F, 0x10, 0x57,
+    0x01, 0x87, 0x04, 0x07, 0x08, 0x07, 0x40, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x67, 0x25, 0x07, 0x42, 0x07, 0x08, 0x8F, 0x81, 0x0F, 0x84, 0x2F,
+    0x10, 0x07, 0x40, 0x07, 0x05, 0x17, 0x00, 0xC7,
+    // 0x2089 '₉'
+    0x0E, 0x07, 0x40, 0x07, 0x00, 0x0F, 0x18, 0xAF, 0x80, 0x07, 0x80, 0x87,
+    0x0A, 0x07, 0x00, 0x07, 0x00, 0x47, 0x0A, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x08, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x04, 0x0F, 0x02, 0x01, 0x0F,
+    0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0x01, 0x44, 0x2F, 0x05, 0x40, 0x0F,
+    0x01, 0x40, 0x1F, 0x41, 0x40, 0x9F, 0x11, 0x40, 0x1F, 0x01, 0x40, 0x1F,
+    0x10, 0x00, 0x9F, 0x40, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x8F,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x00, 0x3F, 0x20, 0xFF, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x3F, 0x3F, 0x30, 0x7F, 0x00, 0x3F, 0x10, 0x3F, 0x00, 0x3F, 0x13, 0x3F,
+    0x00, 0x3F, 0x0C, 0xBF, 0x23, 0x3F, 0x00, 0x3F, 0x1B, 0x3F, 0x08, 0x7F,
+    0x01, 0x3F, 0x00, 0x3F, 0x23, 0x3F, 0x00, 0xFF,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x03, 0x04, 0x0C, 0x03, 0x14, 0x04, 0x03, 0x04, 0x14, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x3F, 0xF4, 0x0B, 0x00, 0x14, 0x03,
+    0x00, 0x08, 0x83, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x83,
+    0x00, 0x62, 0x03, 0x00, 0x8C, 0x03, 0x02, 0x10, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x04, 0x10, 0x03, 0x48, 0x12, 0x0B, 0x20, 0x21, 0x0B,
+    0x00, 0xA0, 0x0B, 0x00, 0x81, 0x03, 0x00, 0x00, 0x83, 0x00, 0x84, 0x13,
+    0x00, 0x42, 0x03, 0x00, 0x01, 0x03,
+    // 0x2154 '⅔'
+    0x00, 0x10, 0x03, 0x02, 0x24, 0x03, 0x00, 0x04, 0x03, 0x0C, 0x04, 0x03,
+    0x08, 0x04, 0x03, 0x02, 0x34, 0x03, 0x20, 0x14, 0x03, 0x20, 0x14, 0x13,
+    0x01, 0x10, 0x03, 0x00, 0x01, 0x0F, 0x00, 0x02, 0x13, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x08, 0x40, 0x03,
+    0x20, 0x80, 0x03, 0x40, 0x10, 0x03, 0x00, 0x12, 0x0B, 0x20, 0x21, 0x0B,
+    0x00, 0xA0, 0x0B, 0x00, 0x81, 0x03, 0x00, 0x00, 0x83, 0x00, 0x84, 0x13,
+    0x00, 0x42, 0x03, 0x00, 0x01, 0x03,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x03, 0x04, 0x0C, 0x03, 0x14, 0x04, 0x03, 0x04, 0x14, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x3F, 0xF4, 0x03, 0x00, 0x14, 0x13,
+    0x00, 0x08, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x04, 0x33, 0x00, 0x08, 0x43,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x40, 0x03,
+    0x21, 0x80, 0x83, 0x42, 0x29, 0x13, 0x00, 0x44, 0x03, 0x00, 0x80, 0x0B,
+    0x00, 0x21, 0x0B, 0x00, 0x80, 0x0B, 0x00, 0x38, 0xCB, 0x00, 0x80, 0x03,
+    0x00, 0x46, 0x13, 0x00, 0x21, 0xE3,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x10, 0x03, 0x08, 0x10, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x24, 0x03, 0x20, 0x04, 0x13, 0x00, 0x08, 0x27,
+    0x0C, 0x90, 0x03, 0x00, 0x02, 0x1B, 0x00, 0x04, 0x23, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x20, 0x03, 0x10, 0x80, 0x03,
+    0x41, 0x00, 0x83, 0x00, 0x29, 0x13, 0x50, 0x44, 0x03, 0x00, 0x80, 0x0B,
+    0x00, 0x21, 0x0B, 0x00, 0x80, 0x0B, 0x00, 0x38, 0xCB, 0x00, 0x80, 0x03,
+    0x00, 0x46, 0x13, 0x00, 0x21, 0xE3,
+    // 0x215D '⅝'
+    0x00, 0x08, 0x03, 0x06, 0x04, 0x03, 0x20, 0x00, 0x03, 0x20, 0x10, 0x03,
+    0x2C, 0x00, 0x03, 0x22, 0x24, 0x03, 0x20, 0x04, 0x1B, 0x20, 0x08, 0x67,
+    0x18, 0x80, 0x83, 0x00, 0x00, 0x03, 0x00, 0x08, 0x43, 0x00, 0x11, 0x83,
+    0x00, 0x42, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x83, 0x44, 0x29, 0x13, 0x00, 0x44, 0x03, 0x00, 0x80, 0x0B,
+    0x00, 0x21, 0x0B, 0x00, 0x80, 0x0B, 0x00, 0x38, 0xCB, 0x00, 0x80, 0x03,
+    0x00, 0x46, 0x13, 0x00, 0x21, 0xE3,
+    // 0x215E '⅞'
+    0x1C, 0x00, 0x03, 0x20, 0x00, 0x03, 0x22, 0x0C, 0x03, 0x28, 0x40, 0x03,
+    0x20, 0x00, 0x03, 0x24, 0x08, 0x13, 0x20, 0xC0, 0x27, 0x21, 0x00, 0x03,
+    0x20, 0x02, 0x13, 0x08, 0x0C, 0x63, 0x00, 0x10, 0x83, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x41, 0x00, 0x03,
+    0x44, 0x00, 0x83, 0x40, 0x29, 0x13, 0x00, 0x44, 0x03, 0x00, 0x80, 0x0B,
+    0x00, 0x21, 0x0B, 0x00, 0x80, 0x0B, 0x00, 0x38, 0xCB, 0x00, 0x80, 0x03,
+    0x00, 0x46, 0x13, 0x00, 0x21, 0xE3,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F, 0x80, 0x1F, 0x99, 0x9F,
+    0x49, 0x2F, 0x09, 0x0F, 0x01, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x11, 0x00, 0x3F, 0x24, 0x00, 0x3F,
+    0x47, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x47, 0xC0, 0x3F,
+    0x20, 0x00, 0x3F, 0x11, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x01, 0x0F, 0x09, 0x0F, 0x49, 0x2F, 0x99, 0x9F, 0x80, 0x1F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x22, 0x3F, 0x00, 0x09, 0x3F,
+    0x00, 0x78, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0xBF,
+    0x00, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x40, 0x2F, 0x09, 0x0F,
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x40, 0x2F, 0x20, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x0A, 0x14, 0x3F, 0x12, 0x12, 0x3F, 0x04, 0x08, 0x3F,
+    0x0F, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x0F, 0xFC, 0x3F,
+    0x04, 0x08, 0x3F, 0x10, 0x12, 0x3F, 0x0A, 0x04, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x02, 0x40, 0x04, 0x20, 0x09, 0x90, 0x10, 0x08, 0x20, 0x04,
+    0x48, 0x12, 0x50, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x00, 0x00,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x7F, 0x06, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x12, 0x00, 0x7F,
+    0x24, 0x0F, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x24, 0x07, 0x7F,
+    0x12, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x06, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0x48, 0x12,
+    0x20, 0x04, 0x10, 0x08, 0x09, 0x90, 0x04, 0x20, 0x02, 0x40, 0x00, 0x00,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x7F, 0x00, 0x60, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x48, 0x7F,
+    0xF0, 0x24, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x02, 0x7F, 0xE0, 0x24, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x03, 0x04, 0x83, 0x08, 0x43, 0x10, 0x23, 0x20, 0x13, 0x00, 0x03,
+    0x10, 0x23, 0x60, 0x1B, 0x00, 0x03, 0x00, 0x03, 0x60, 0x1B, 0x10, 0x23,
+    0x40, 0x0B, 0x20, 0x13, 0x13, 0x23, 0x08, 0x43, 0x04, 0x83, 0x00, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x03, 0x43, 0x00, 0x18, 0x03, 0x00, 0x00, 0x03, 0x28, 0x40, 0x03,
+    0x10, 0x0A, 0x47, 0x10, 0x10, 0x07, 0x01, 0x20, 0x03, 0x80, 0x00, 0x4B,
+    0x90, 0x00, 0x8B, 0x03, 0x14, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x03, 0x06, 0x30, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x01, 0x80, 0x1F, 0x00, 0x0C, 0x9F, 0x30, 0x60, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x9F, 0x01, 0x80, 0x9F, 0x00, 0x30, 0x9F, 0x60, 0x06, 0x9F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x06,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x04, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x82,
+    0x00, 0x00, 0x08,
+    // 0x221A '√'
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x30, 0x00, 0x01, 0x81, 0x00, 0x04, 0x0C, 0x00, 0xC0, 0x60,
+    0x02, 0x01, 0x00, 0x40, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x2D, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0x22, 0x7F, 0x92, 0x3F,
+    0x04, 0xBF, 0x01, 0x3F, 0x21, 0x3F, 0x08, 0xBF, 0x80, 0x3F, 0x82, 0x7F,
+    0x02, 0x7F, 0x8C, 0x3F, 0x80, 0x3F, 0x23, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x18, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x8F,
+    0x98, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x2260 '≠'
+    0x39, 0x87, 0x20, 0x07, 0x20, 0x37, 0x20, 0x07, 0x22, 0x17, 0x20, 0x07,
+    0x20, 0x07, 0x42, 0x07, 0x00, 0x07, 0x80, 0x07, 0x20, 0x07, 0x20, 0x47,
+    // 0x2264 '≤'
+    0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40,
+    0x01, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x10, 0x80, 0x40, 0x00, 0x00,
+    // 0x2265 '≥'
+    0x20, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x02, 0x00, 0x10, 0x00, 0x08, 0x00, 0x09, 0x00, 0x04, 0x00,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint8_t Bookerly26BoldBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x07, 0x40, 0x1C, 0x57, 0x00, 0x00, 0x07, 0x80, 0x02, 0x87,
+    0x9E, 0x00, 0x07, 0x00, 0x00, 0x27,
+    // 0x22 '"'
+    0x4F, 0x7F, 0x80, 0xFF, 0x80, 0x7F, 0xFC, 0x7F, 0x00, 0x7F, 0x47, 0x7F,
+    0x80, 0xFF, 0x80, 0x7F, 0xF8, 0x7F,
+    // 0x23 '#'
+    0x00, 0x30, 0x7F, 0x04, 0x00, 0x7F, 0x00, 0x06, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x7F, 0x40, 0x08, 0x7F, 0x81, 0x80, 0x7F, 0x90, 0x00, 0x7F,
+    0x00, 0x08, 0x7F, 0x02, 0x80, 0x7F, 0x00, 0x03, 0x7F, 0x80, 0x00, 0x7F,
+    0x83, 0x00, 0x7F, 0xB0, 0x00, 0x7F, 0x00, 0x20, 0x7F, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x01, 0x88, 0x3F, 0x09, 0x80, 0x00, 0x3F, 0x02, 0x04, 0x00, 0x7F,
+    0x73, 0xC2, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xA3, 0xC2, 0x00, 0x3F,
+    0x02, 0x10, 0x00, 0x3F, 0x01, 0x00, 0x08, 0x3F, 0x08, 0x08, 0x10, 0x3F,
+    0x04, 0x84, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x25 '%'
+    0x04, 0x40, 0x03, 0x10, 0x10, 0x03, 0x20, 0x00, 0x03, 0x08, 0x08, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x28, 0x13, 0x07, 0xC8, 0x4B, 0x20, 0x00, 0x0B,
+    0x10, 0x22, 0x03, 0x07, 0x88, 0x03, 0x00, 0x21, 0x03, 0x00, 0x04, 0x03,
+    0x01, 0x10, 0x03, 0x04, 0x40, 0x03, 0x10, 0x10, 0x23, 0x42, 0x20, 0x13,
+    0x48, 0x07, 0x83, 0x00, 0x50, 0x03, 0x00, 0x50, 0x23, 0x00, 0x40, 0x43,
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x10, 0x43, 0x00, 0x00, 0x03,
+    // 0x26 '&'
+    0x00, 0x00, 0x0F, 0x00, 0x10, 0x8F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x2F,
+    0x00, 0x0A, 0x0F, 0x40, 0x20, 0x0F, 0x00, 0x10, 0x8F, 0x93, 0x00, 0x0F,
+    0x20, 0x40, 0x0F, 0x22, 0x20, 0x0F, 0x04, 0x00, 0x8F, 0x80, 0x00, 0x0F,
+    0x02, 0x24, 0x2F, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x1E, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x27 '''
+    0x4F, 0x7F, 0x80, 0xFF, 0x80, 0x7F, 0xFC, 0x7F,
+    // 0x28 '('
+    0x00, 0x61, 0x80, 0x3F, 0x02, 0x00, 0x10, 0x3F, 0x08, 0x00, 0x04, 0x3F,
+    0x00, 0x7F, 0x02, 0x3F, 0x02, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x08, 0xBF,
+    0x90, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x08, 0xBF, 0x01, 0x00, 0x21, 0x3F, 0x10, 0x1E, 0x02, 0x3F,
+    0x08, 0x00, 0x08, 0x3F, 0x02, 0x00, 0x20, 0x3F, 0x00, 0x7F, 0x00, 0x3F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x28, 0x3F, 0x00, 0xBF, 0x05, 0x3F, 0x12, 0x3F, 0x00, 0x7F,
+    0x18, 0x7F, 0x2A, 0x3F, 0x02, 0x3F, 0x04, 0x3F,
+    // 0x2B '+'
+    0x06, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x79, 0xF7, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x07,
+    // 0x2C ','
+    0x00, 0x7F, 0x02, 0xFF, 0x68, 0xFF, 0x81, 0x7F, 0x82, 0x7F, 0x08, 0x7F,
+    0x00, 0x7F,
+    // 0x2D '-'
+    0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F,
+    // 0x2E '.'
+    0x27, 0x07, 0x8F, 0x87, 0x17, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x87, 0x00, 0x02, 0x07,
+    0x00, 0x10, 0x17, 0x00, 0x40, 0x07, 0x01, 0x02, 0x07, 0x00, 0x08, 0x07,
+    0x20, 0x20, 0x07, 0x81, 0x00, 0x07, 0x84, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x80, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x00, 0x0F, 0x02, 0x02, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x42, 0x02, 0x0F, 0x48, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x44, 0x02, 0x0F, 0x40, 0xE0, 0x0F,
+    0x00, 0x00, 0x4F, 0x10, 0x00, 0x8F, 0x04, 0x02, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x31 '1'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x24, 0x00, 0x9F,
+    0x23, 0xFF, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x3F, 0xFF, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x5F,
+    // 0x32 '2'
+    0x04, 0x00, 0x9F, 0x10, 0x01, 0x3F, 0x21, 0x02, 0x1F, 0x01, 0x04, 0x1F,
+    0x40, 0x08, 0x1F, 0x00, 0x11, 0x1F, 0x10, 0x22, 0x1F, 0x00, 0x44, 0x1F,
+    0x09, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x40, 0x1F,
+    0x19, 0x00, 0x1F, 0x00, 0x00, 0xDF,
+    // 0x33 '3'
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x04, 0x60, 0x0F,
+    0x48, 0x10, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x80, 0x0F, 0x00, 0x01, 0x0F,
+    0x0A, 0x10, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0xC0, 0x4F, 0x21, 0x00, 0x8F,
+    0x0C, 0x01, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x00, 0x0F, 0x00, 0x12, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x10, 0x0F, 0x00, 0x28, 0x0F, 0x08, 0x08, 0x0F, 0x11, 0x08, 0x0F,
+    0x02, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x7F, 0xF1, 0xEF, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x0E, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x3C, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x01, 0x1F, 0x80, 0x01, 0x1F, 0x80, 0x40, 0x1F, 0x82, 0x02, 0x1F,
+    0x82, 0x18, 0x5F, 0x80, 0x00, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x80, 0x1F,
+    0xE0, 0x3C, 0x1F,
+    // 0x36 '6'
+    0x00, 0x1C, 0x0F, 0x01, 0x00, 0x8F, 0x04, 0x00, 0x4F, 0x08, 0x00, 0x2F,
+    0x10, 0x3C, 0x0F, 0x21, 0x01, 0x0F, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x8F,
+    0x48, 0x00, 0x0F, 0x00, 0x0F, 0x0F, 0x10, 0x80, 0x2F, 0x10, 0x00, 0x0F,
+    0x40, 0x00, 0x8F, 0x00, 0x0E, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x88, 0x03, 0xDF,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x80, 0x1F, 0x82, 0x02, 0x1F,
+    0x84, 0x10, 0x1F, 0x90, 0x40, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x88, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x03, 0x0F, 0x0E, 0x00, 0x4F, 0x00, 0x80, 0x0F, 0x00, 0x60, 0x0F,
+    0x40, 0x0D, 0x0F, 0x40, 0x10, 0x8F, 0x10, 0x00, 0x0F, 0x10, 0x10, 0x0F,
+    0x01, 0x00, 0x8F, 0x44, 0x05, 0x0F, 0x40, 0x40, 0x2F, 0x00, 0xA0, 0x0F,
+    0x10, 0x10, 0x0F, 0x00, 0x07, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x47, 0x00, 0x0F, 0x00, 0x48, 0x0F, 0x00, 0x09, 0x0F, 0x00, 0x0A, 0x2F,
+    0x08, 0x0C, 0x0F, 0x42, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x04, 0x0F, 0x03, 0xE0, 0x0F,
+    // 0x3A ':'
+    0x20, 0x09, 0x00, 0x01, 0x88, 0x23, 0x88, 0x21, 0x00, 0x05, 0x00, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0x3F, 0x88, 0x20, 0x5F,
+    0x88, 0x20, 0x9F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x3C '<'
+    0x06, 0x07, 0x00, 0x07, 0x08, 0x07, 0x00, 0x87, 0x16, 0x07, 0x00, 0x47,
+    0x21, 0x07, 0x00, 0x27, 0x40, 0x87, 0x10, 0x17, 0x80, 0x07, 0x00, 0x27,
+    // 0x3D '='
+    0x67, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+    // 0x3E '>'
+    0x00, 0x07, 0x00, 0x57, 0x10, 0x17, 0x40, 0x07, 0x08, 0x27, 0x20, 0x07,
+    0x05, 0x47, 0x10, 0x07, 0x00, 0x87, 0x08, 0x07, 0x01, 0x07, 0x04, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x58, 0xAF, 0x10, 0x00, 0x0F,
+    0x10, 0x85, 0x1F, 0x90, 0x10, 0x0F, 0x00, 0x00, 0xCF, 0x41, 0x20, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x40, 0x0F, 0x02, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x3F, 0x80, 0x7F, 0x00, 0x80, 0x20, 0x7F, 0x02, 0x00, 0x08, 0x7F,
+    0x00, 0x1F, 0x00, 0x7F, 0x00, 0x80, 0x40, 0x7F, 0x10, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x09, 0x7F, 0x08, 0x20, 0x41, 0x7F,
+    0x41, 0x20, 0x04, 0x7F, 0x40, 0x02, 0x04, 0x7F, 0x00, 0x84, 0x04, 0x7F,
+    0x12, 0x91, 0x44, 0x7F, 0x10, 0x26, 0x84, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x05, 0x7F, 0x40, 0x00, 0x01, 0x7F, 0x08, 0x00, 0x08, 0x7F,
+    0x04, 0x01, 0x42, 0x7F, 0x02, 0x02, 0x4C, 0x7F, 0x10, 0x78, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x02, 0x02, 0x00, 0x7F, 0x00, 0x70, 0x00, 0x7F,
+    // 0x41 'A'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x10, 0x1F, 0x00, 0x80, 0x9F, 0x02, 0x00, 0x1F, 0x08, 0x30, 0x7F,
+    0x00, 0x90, 0x1F, 0x04, 0x10, 0x1F, 0x01, 0x10, 0x1F, 0x80, 0x30, 0x7F,
+    0x20, 0x00, 0x1F, 0x08, 0x00, 0x9F, 0x01, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x0C, 0x1F, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x8F,
+    0x00, 0x80, 0x8F, 0x10, 0x80, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x2F,
+    0x40, 0x00, 0x0F, 0x00, 0xC0, 0x0F, 0x1A, 0x00, 0x0F, 0x00, 0x11, 0x0F,
+    // 0x43 'C'
+    0x01, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x01, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x01, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x88, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x02, 0x00, 0x2F, 0x38, 0x01, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0x8F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x2F,
+    0x08, 0x01, 0x2F, 0x44, 0x02, 0x0F, 0x01, 0x08, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x06, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x1F,
+    0x10, 0x00, 0x9F, 0x10, 0x80, 0x9F, 0x10, 0x80, 0x9F, 0x10, 0x80, 0x9F,
+    0x00, 0x80, 0x1F, 0x00, 0x62, 0x1F, 0x00, 0x04, 0x1F, 0x78, 0x03, 0xDF,
+    // 0x46 'F'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x8F, 0x9F,
+    0x10, 0x10, 0x1F, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x1F, 0x00, 0x10, 0x1F,
+    0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x1F,
+    // 0x47 'G'
+    0x01, 0x84, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x98, 0x2F, 0x44, 0x02, 0x0F, 0x08, 0x01, 0x0F, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x0F, 0x80, 0x00, 0x8F, 0x80, 0x28, 0x8F, 0x80, 0x28, 0x0F,
+    0x90, 0x27, 0x0F, 0x02, 0x20, 0x0F, 0x02, 0x20, 0x2F, 0x44, 0x20, 0x0F,
+    0x00, 0x2F, 0xCF, 0x00, 0x00, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9F,
+    0x00, 0x80, 0x1F, 0x20, 0x80, 0x7F, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x1F,
+    0x20, 0x80, 0x3F, 0x00, 0x80, 0x1F, 0x10, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x49 'I'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F,
+    0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x80, 0x8F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x6F, 0x00, 0x02, 0x0F, 0x00, 0x01, 0x0F,
+    0x01, 0x00, 0x0F, 0x02, 0x08, 0x0F, 0x04, 0x04, 0x2F, 0x08, 0x02, 0x0F,
+    0x10, 0x01, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x1F,
+    0x00, 0x00, 0x9F, 0x20, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0xDF,
+    // 0x4D 'M'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x9F, 0x00, 0xF0, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x1F, 0x03, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x60, 0x04, 0x1F, 0x04, 0x01, 0x1F, 0x00, 0xC0, 0x5F,
+    0x00, 0x10, 0x1F, 0x00, 0x80, 0x9F, 0x04, 0x04, 0x1F, 0x60, 0x60, 0x1F,
+    0x03, 0x00, 0x5F, 0x07, 0x80, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x78, 0x1F, 0x60, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x8F, 0x00, 0x80, 0x0F,
+    0x10, 0x00, 0x6F, 0x00, 0x10, 0x0F, 0x02, 0x00, 0x0F, 0x01, 0x02, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x20, 0x4F, 0x00, 0x00, 0x0F, 0x1F, 0xF8, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xEF, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x01, 0x8C, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x01, 0xF8, 0x2F, 0x40, 0x02, 0x0F, 0x00, 0x01, 0x0F, 0x10, 0x00, 0x0F,
+    0x80, 0x00, 0x9F, 0x80, 0x00, 0x8F, 0x90, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x2F, 0x03, 0x04, 0x0F, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x8F,
+    0x10, 0x01, 0x0F, 0x04, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x48, 0x9F,
+    0x00, 0x00, 0x1F, 0x10, 0x40, 0x1F, 0x00, 0x00, 0x1F, 0x07, 0x10, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F, 0x20, 0x40, 0x1F, 0x0F, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x01, 0x8C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x01, 0xF0, 0x20, 0x7F, 0x40, 0x02, 0x00, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x80, 0x7F,
+    0x80, 0x00, 0x80, 0x7F, 0x90, 0x00, 0x82, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x29, 0x7F, 0x03, 0x0C, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x20, 0x00, 0x84, 0xFF, 0x10, 0x01, 0x04, 0xFF, 0x04, 0x04, 0x04, 0xFF,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x40, 0x8F,
+    0x00, 0x48, 0x0F, 0x10, 0x04, 0x6F, 0x00, 0x80, 0x0F, 0x05, 0x00, 0x8F,
+    0x00, 0x28, 0x4F, 0x00, 0x04, 0x2F, 0x20, 0x02, 0x0F, 0x0F, 0x01, 0x0F,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    // 0x53 'S'
+    0x00, 0x03, 0xCF, 0x10, 0x80, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x21, 0x0F,
+    0x04, 0x00, 0x8F, 0x10, 0x10, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x08, 0x8F,
+    0x80, 0x80, 0x0F, 0x08, 0x00, 0x2F, 0x02, 0x40, 0x0F, 0x00, 0x20, 0x4F,
+    0x00, 0x11, 0x0F,
+    // 0x54 'T'
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x1F,
+    0x10, 0x00, 0x3F, 0x10, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x9F,
+    0x10, 0x00, 0x1F, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x3C, 0x00, 0x1F,
+    // 0x55 'U'
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x1F, 0xFC, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0x56 'V'
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x02, 0x0F, 0x04, 0x00, 0x8F,
+    0x00, 0x80, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x60, 0x80, 0x8F, 0x06, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x40, 0x0F,
+    0x01, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    // 0x57 'W'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x01, 0x8F, 0x14, 0x00, 0x2F,
+    0x00, 0x40, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x18, 0x0F, 0x01, 0x80, 0xCF,
+    0x18, 0x04, 0x0F, 0x40, 0x20, 0x0F, 0x40, 0x80, 0x0F, 0x40, 0x10, 0x0F,
+    0x20, 0x02, 0x0F, 0x04, 0x00, 0x4F, 0x00, 0xC0, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x0C, 0x0F, 0x00, 0xC0, 0x2F, 0x1C, 0x01, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x40, 0x0F, 0x06, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x01, 0x1F,
+    0x04, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x10, 0x9F, 0x00, 0x60, 0x1F,
+    0x08, 0x04, 0x7F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F,
+    0x08, 0x00, 0x9F, 0x01, 0x10, 0x1F, 0x02, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F,
+    // 0x59 'Y'
+    0x60, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x0F, 0x9F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x22, 0x1F, 0x9F,
+    0x08, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x7C, 0x01, 0x2F, 0x02, 0x00, 0x0F, 0x04, 0x08, 0x0F,
+    0x10, 0x10, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x80, 0x8F, 0x10, 0x04, 0x8F,
+    0x14, 0x00, 0x8F, 0x10, 0x20, 0x8F, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x0F,
+    0x00, 0x02, 0x0F, 0x08, 0x00, 0x0F, 0x30, 0x00, 0x6F, 0x00, 0x00, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x60, 0x00, 0x01, 0xBF,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x90, 0x00, 0x07, 0x82, 0x00, 0x07,
+    0x40, 0x80, 0x07, 0x10, 0x20, 0x07, 0x04, 0x04, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x20, 0x47, 0x00, 0x08, 0x07, 0x00, 0x02, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x17,
+    // 0x5D ']'
+    0x20, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x87, 0x04, 0x07, 0x10, 0x27, 0x41, 0x07,
+    0x88, 0x07, 0x88, 0x07, 0x01, 0x07, 0x10, 0x27, 0x04, 0x07, 0x01, 0x07,
+    0x00, 0x27, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0x01, 0x51, 0x81, 0x41, 0x25, 0x01, 0x01,
+    // 0x61 'a'
+    0x00, 0x49, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x82, 0x11, 0x22, 0x81,
+    0x22, 0x95, 0x1C, 0xE1, 0x80, 0x05, 0x00, 0x01, 0x40, 0x01, 0x0F, 0xF1,
+    0x00, 0x05, 0x00, 0x09,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x50, 0x00, 0x03, 0x4F, 0xFF, 0xEB,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x10, 0x43,
+    0x01, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x20, 0x83,
+    0x00, 0x00, 0x03,
+    // 0x63 'c'
+    0x00, 0x01, 0x08, 0x21, 0x00, 0x09, 0x00, 0x01, 0x00, 0x01, 0x80, 0x41,
+    0x80, 0x01, 0x20, 0x01, 0x00, 0x11, 0x80, 0x11, 0x84, 0x11, 0x00, 0x05,
+    0x10, 0x19,
+    // 0x64 'd'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x63, 0x00, 0x40, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x10, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x23,
+    0x10, 0x40, 0x23, 0x40, 0x00, 0x43, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x65 'e'
+    0x00, 0x01, 0x08, 0x21, 0x20, 0x09, 0x40, 0x05, 0x00, 0x01, 0x90, 0x21,
+    0x20, 0x01, 0x20, 0x11, 0x00, 0x11, 0x8C, 0x11, 0x80, 0x11, 0x40, 0x05,
+    0x20, 0x09, 0x00, 0x01,
+    // 0x66 'f'
+    0x00, 0xC0, 0x07, 0x00, 0x00, 0x17, 0x01, 0x00, 0x07, 0x0C, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x11, 0x00, 0x07, 0x11, 0x00, 0x1F, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x48, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0x87, 0x00, 0x02, 0x27, 0x21, 0x04, 0x07, 0x40, 0x80, 0x17,
+    0x00, 0x01, 0x87, 0x9C, 0x52, 0x47, 0x20, 0x52, 0x47, 0x20, 0x52, 0x47,
+    0x20, 0x52, 0x47, 0x9C, 0x12, 0x17, 0x80, 0x12, 0x97, 0x80, 0x10, 0x07,
+    0xB0, 0x00, 0x27, 0x20, 0x08, 0x47, 0x00, 0x07, 0x07, 0x40, 0x00, 0x07,
+    // 0x68 'h'
+    0x30, 0x00, 0x07, 0x50, 0x00, 0x17, 0x4F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F, 0x9F, 0xE7, 0x00, 0x20, 0x17,
+    0x01, 0x00, 0x07, 0x01, 0x00, 0x0F, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x1F,
+    // 0x69 'i'
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x17, 0x31, 0x00, 0x07, 0x41, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x41, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x1F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x00, 0x8F,
+    0x00, 0x00, 0x01, 0x0F, 0x01, 0x3F, 0xFC, 0x2F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x01, 0x0F, 0x30, 0xFF, 0xF0, 0x0F,
+    // 0x6B 'k'
+    0x30, 0x00, 0x03, 0x50, 0x00, 0x13, 0x4F, 0xFF, 0xE3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x7F, 0xFA, 0x23, 0x00, 0x08, 0x13,
+    0x00, 0x80, 0x83, 0x01, 0x40, 0x03, 0x01, 0x0C, 0x13, 0x01, 0x10, 0x0B,
+    0x01, 0x20, 0x03, 0x01, 0x40, 0x43, 0x01, 0x00, 0x23, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x20, 0x00, 0x0F, 0x50, 0x00, 0x07, 0x4F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F,
+    // 0x6D 'm'
+    0x00, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x40, 0x03, 0x10, 0x03, 0x80, 0x03, 0x80, 0x03, 0x10, 0x0B, 0x00, 0x03,
+    0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x40, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x00, 0x0B, 0x0F, 0xF3, 0x00, 0x03, 0x80, 0x03, 0x40, 0x03, 0x0F, 0xF3,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x6E 'n'
+    0x00, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x40, 0x03, 0x10, 0x03, 0x80, 0x03, 0x80, 0x03, 0x10, 0x0B, 0x07, 0xF3,
+    0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x6F 'o'
+    0x00, 0x01, 0x08, 0x21, 0x20, 0x09, 0x40, 0x05, 0x00, 0x01, 0x88, 0x41,
+    0x80, 0x11, 0x20, 0x01, 0x00, 0x01, 0x10, 0x11, 0x87, 0xC1, 0x00, 0x01,
+    0x40, 0x09, 0x20, 0x11, 0x0F, 0x81,
+    // 0x70 'p'
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x9F, 0xFF, 0xCF, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x4F, 0xF3, 0xCF, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x3F, 0x00, 0x10, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x71 'q'
+    0x00, 0x00, 0x0F, 0x08, 0x20, 0x0F, 0x20, 0x08, 0x0F, 0x40, 0x04, 0x0F,
+    0x00, 0x00, 0x0F, 0x88, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x1F,
+    0x20, 0x04, 0x0F, 0x00, 0x20, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x40, 0x03, 0x00, 0x0B, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x20, 0x03, 0x40, 0x03, 0x90, 0x03, 0x10, 0x03, 0x00, 0x03, 0xA0, 0x03,
+    // 0x73 's'
+    0x00, 0x39, 0x02, 0x41, 0x01, 0x41, 0x80, 0x11, 0xA8, 0x81, 0x00, 0x01,
+    0x04, 0x41, 0x20, 0x31, 0x9A, 0x05, 0x08, 0x01, 0x70, 0x11, 0x00, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x03, 0x3F,
+    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x3F,
+    0x10, 0x02, 0x3F, 0x10, 0x02, 0x3F, 0x10, 0x00, 0xBF, 0x00, 0x03, 0x3F,
+    // 0x75 'u'
+    0x60, 0x01, 0x00, 0x01, 0x1F, 0xF1, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x40, 0x21, 0x00, 0x11, 0x00, 0x11, 0x20, 0x15, 0x1F, 0xE1, 0x80, 0x05,
+    0x80, 0x01, 0x80, 0x01, 0xFF, 0xF1, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x76 'v'
+    0x40, 0x01, 0xA0, 0x01, 0x90, 0x01, 0x84, 0x01, 0x80, 0x81, 0x80, 0x21,
+    0x80, 0x09, 0x86, 0x01, 0x00, 0x41, 0x00, 0x41, 0x42, 0x05, 0xA8, 0x11,
+    0x80, 0x81, 0x82, 0x01, 0x88, 0x01, 0xA0, 0x01, 0x40, 0x01,
+    // 0x77 'w'
+    0x00, 0x01, 0xA0, 0x01, 0x90, 0x01, 0x82, 0x01, 0x80, 0x41, 0x80, 0x09,
+    0xA8, 0x01, 0x80, 0x81, 0x00, 0x41, 0x02, 0x05, 0x10, 0x61, 0x02, 0x01,
+    0x01, 0x81, 0x00, 0x31, 0x18, 0x01, 0x01, 0x01, 0x00, 0x41, 0x83, 0x01,
+    0xB0, 0x11, 0x80, 0x81, 0x82, 0x01, 0x90, 0x01, 0x80, 0x01, 0x00, 0x01,
+    // 0x78 'x'
+    0x00, 0x07, 0x80, 0x03, 0x80, 0x13, 0x80, 0x23, 0x80, 0x43, 0x80, 0x83,
+    0xA0, 0x2B, 0xC0, 0x43, 0x00, 0x47, 0x00, 0x0B, 0xA3, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x40, 0x0F,
+    // 0x79 'y'
+    0x40, 0x00, 0x67, 0xA0, 0x00, 0x07, 0x90, 0x00, 0x07, 0x84, 0x00, 0x07,
+    0x80, 0x80, 0x07, 0x80, 0x20, 0x17, 0x80, 0x08, 0x07, 0x86, 0x00, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x41, 0x07, 0x42, 0x04, 0x07, 0xA8, 0x10, 0x07,
+    0x80, 0x80, 0x07, 0x82, 0x00, 0x07, 0x88, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x40, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x01, 0x78, 0x05, 0x80, 0x41, 0x90, 0x81, 0x80, 0x01, 0x80, 0x11,
+    0x88, 0x11, 0x90, 0x91, 0x81, 0x11, 0x80, 0x11, 0x80, 0x21, 0x90, 0x01,
+    0x60, 0x79,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x17, 0x02, 0x72, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x9F, 0x10, 0x3C, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x01, 0xBF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x80, 0xE3, 0xC2, 0x3F, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x20, 0xE1, 0x81, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x3F,
+    // 0x7E '~'
+    0x03, 0x23, 0x07, 0x0B, 0x13, 0x03, 0x4B, 0x03, 0x07, 0x07, 0x27, 0x03,
+    0x43, 0x03,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x1F, 0x00, 0x70, 0x07, 0x00, 0x00, 0x07, 0x0A, 0x00, 0x0F,
+    0x30, 0x1F, 0xF7,
+    // 0xA2 '¢'
+    0x00, 0x08, 0x00, 0x7F, 0x00, 0x80, 0x80, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x20, 0x7F, 0x00, 0x42, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x01, 0x03, 0x8C, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x90, 0x7F,
+    0x01, 0x00, 0x80, 0x7F, 0x00, 0x80, 0x80, 0x7F, 0x04, 0x00, 0x20, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x0F, 0x00, 0x20, 0xAF, 0x00, 0x40, 0x9F, 0x00, 0x41, 0x1F,
+    0x01, 0x80, 0x0F, 0x08, 0x00, 0x2F, 0x00, 0x01, 0x8F, 0x00, 0x08, 0x8F,
+    0x44, 0x40, 0x8F, 0x10, 0x40, 0x8F, 0x00, 0x40, 0x8F, 0x10, 0x00, 0x8F,
+    0x44, 0x60, 0x0F, 0x40, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x08, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x40, 0x27, 0x80, 0x47, 0x18, 0x97, 0x00, 0x27, 0x00, 0x27, 0x40, 0x07,
+    0x10, 0x07, 0x10, 0x07, 0x40, 0x87, 0x06, 0x27, 0x00, 0x27, 0x00, 0x07,
+    0x80, 0x47, 0x40, 0x27, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x88, 0x50, 0x3F,
+    0x82, 0x40, 0x7F, 0x80, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0x88, 0x07, 0x3F,
+    0x02, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x01, 0x00, 0x3F, 0x80, 0x21, 0x3F,
+    0xA0, 0x40, 0x3F, 0x82, 0x40, 0xFF, 0x88, 0x48, 0x3F, 0x80, 0x80, 0x3F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x07, 0x08, 0x40, 0x27, 0x00, 0x11, 0x17, 0x02, 0x01, 0x07,
+    0x19, 0x00, 0x47, 0xA4, 0x84, 0x07, 0x80, 0x00, 0x07, 0x20, 0x40, 0x07,
+    0x81, 0x09, 0x57, 0x88, 0x04, 0x07, 0x08, 0x0C, 0x07, 0x30, 0x00, 0x87,
+    0x00, 0x04, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F, 0x09, 0xF9, 0x0F, 0x14, 0x02, 0x8F,
+    0x28, 0x00, 0x4F, 0x10, 0xF8, 0x8F, 0x42, 0x00, 0x2F, 0x24, 0x02, 0x4F,
+    0x01, 0x08, 0x0F, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x1F, 0x01, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x42, 0x04, 0x4F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x0C, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x0F,
+    // 0xAA 'ª'
+    0x03, 0x0F, 0x50, 0x07, 0x10, 0x47, 0x88, 0x47, 0x8C, 0x07, 0x80, 0x87,
+    0x00, 0x07, 0x3E, 0x47, 0x01, 0x17, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x20, 0x9F, 0x44, 0x1F, 0x10, 0x1F,
+    0xA0, 0x1F, 0x0C, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0A, 0x5F,
+    0x81, 0x1F, 0x00, 0x9F, 0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x04, 0x41, 0x30, 0x11, 0x08, 0x2D, 0x60, 0x01,
+    0x00, 0x01, 0x00, 0xA7, 0x06, 0x05, 0x28, 0x01, 0x40, 0x09, 0x10, 0x01,
+    0x04, 0x29, 0x08, 0x21, 0x00, 0x01,
+    // 0xB0 '°'
+    0x0F, 0x1F, 0x20, 0x1F, 0x00, 0x5F, 0x40, 0x1F, 0x11, 0x1F, 0x11, 0x1F,
+    0x00, 0x5F, 0x40, 0x1F, 0x20, 0x9F, 0x0E, 0x1F,
+    // 0xB1 '±'
+    0x07, 0x03, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x78, 0xF0, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x05, 0x00, 0x7F,
+    // 0xB2 '²'
+    0x10, 0x37, 0x00, 0x47, 0x00, 0x87, 0x10, 0x07, 0x00, 0x47, 0x04, 0x07,
+    0x00, 0x07, 0x40, 0x07, 0x04, 0x07, 0x00, 0x37,
+    // 0xB3 '³'
+    0x00, 0x17, 0x40, 0x2F, 0x12, 0x2F, 0x01, 0x2F, 0x21, 0x0F, 0x09, 0x47,
+    0x00, 0x07, 0x46, 0x07, 0x38, 0x07, 0x00, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0xEF, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x04, 0x0F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x08, 0x0F,
+    // 0xB6 '¶'
+    0x03, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01,
+    0x40, 0x00, 0x01, 0x40, 0x08, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x1F, 0xFF, 0xF9, 0x10, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0xB7 '·'
+    0x37, 0x0F, 0x07, 0x0F, 0x47, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x07, 0x10, 0x07, 0x00, 0x27, 0x4F, 0xC7, 0x00, 0x07, 0x00, 0x07,
+    0x7F, 0xC7, 0x00, 0x27, 0x00, 0x17,
+    // 0xBA 'º'
+    0x12, 0x07, 0x00, 0x97, 0x08, 0x07, 0x21, 0x47, 0x80, 0x47, 0xA0, 0x47,
+    0x12, 0x07, 0x00, 0x8F, 0x21, 0x17, 0x00, 0x07,
+    // 0xBB '»'
+    0x40, 0x5F, 0x80, 0x1F, 0x02, 0x5F, 0x40, 0x1F, 0x20, 0x1F, 0x10, 0x1F,
+    0x0A, 0x1F, 0x20, 0x9F, 0x90, 0x1F, 0x08, 0x5F, 0x00, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x04, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x03, 0x10, 0x0C, 0x03, 0x10, 0x04, 0x03, 0x07, 0xF4, 0x03,
+    0x20, 0x04, 0x03, 0x00, 0x04, 0x03, 0x1F, 0xF4, 0x03, 0x00, 0x04, 0x0B,
+    0x00, 0x0C, 0x23, 0x00, 0x00, 0x87, 0x00, 0x00, 0x13, 0x00, 0x04, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x42, 0x03, 0x01, 0x08, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x81, 0x03, 0x00, 0x02, 0x03, 0x04, 0x00, 0x03, 0x10, 0x12, 0x03,
+    0x00, 0x24, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xBD '½'
+    0x00, 0x00, 0x03, 0x10, 0x0C, 0x03, 0x10, 0x04, 0x03, 0x07, 0xF4, 0x03,
+    0x20, 0x04, 0x03, 0x00, 0x04, 0x03, 0x1F, 0xF4, 0x03, 0x00, 0x04, 0x23,
+    0x00, 0x0C, 0x07, 0x00, 0x01, 0x0B, 0x00, 0x04, 0x23, 0x00, 0x00, 0x83,
+    0x00, 0x22, 0x03, 0x00, 0x88, 0x03, 0x02, 0x00, 0x03, 0x08, 0x40, 0x03,
+    0x21, 0x00, 0x03, 0x04, 0x08, 0x43, 0x00, 0x08, 0x83, 0x00, 0x18, 0x03,
+    0x00, 0xA0, 0x03, 0x00, 0xA0, 0x43, 0x00, 0x90, 0x43, 0x00, 0x00, 0x43,
+    0x00, 0x40, 0x43, 0x00, 0x10, 0x53,
+    // 0xBE '¾'
+    0x08, 0x08, 0x03, 0x04, 0x00, 0x03, 0x21, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x02, 0x90, 0x03, 0x0C, 0x04, 0x03, 0x20, 0x00, 0x03, 0x21, 0x08, 0x1B,
+    0x1C, 0x90, 0x03, 0x00, 0x00, 0x83, 0x00, 0x02, 0x13, 0x00, 0x00, 0x43,
+    0x00, 0x01, 0x03, 0x00, 0x44, 0x03, 0x01, 0x10, 0x03, 0x04, 0x00, 0x03,
+    0x10, 0x81, 0x03, 0x42, 0x02, 0x03, 0x48, 0x00, 0x03, 0x00, 0x12, 0x03,
+    0x00, 0x24, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xBF '¿'
+    0x00, 0x0F, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x27, 0x00, 0x40, 0x07,
+    0x00, 0x08, 0x87, 0x08, 0x80, 0x07, 0x00, 0x00, 0x07, 0x0A, 0x10, 0x07,
+    0x30, 0x60, 0x87, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x01, 0x01, 0x3F,
+    0x40, 0x04, 0x00, 0x3F, 0x40, 0x10, 0x60, 0xFF, 0x00, 0x01, 0x20, 0x3F,
+    0x04, 0x08, 0x20, 0x3F, 0x14, 0x02, 0x20, 0x3F, 0x01, 0x00, 0x60, 0xFF,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x01, 0x01, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x0C, 0x10, 0x60, 0xFF, 0x10, 0x01, 0x20, 0x3F,
+    0x04, 0x08, 0x20, 0x3F, 0x00, 0x02, 0x20, 0x3F, 0x41, 0x00, 0x60, 0xFF,
+    0x08, 0x40, 0x00, 0x3F, 0x30, 0x10, 0x01, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x04, 0x01, 0x01, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x24, 0x10, 0x60, 0xFF, 0x48, 0x01, 0x20, 0x3F,
+    0x10, 0x08, 0x20, 0x3F, 0x10, 0x02, 0x20, 0x3F, 0x49, 0x00, 0x60, 0xFF,
+    0x24, 0x40, 0x00, 0x3F, 0x14, 0x10, 0x01, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x30, 0x02, 0x02, 0x7F,
+    0x08, 0x08, 0x00, 0x7F, 0x90, 0x20, 0xC1, 0xFF, 0x00, 0x02, 0x40, 0x7F,
+    0x00, 0x10, 0x40, 0x7F, 0x08, 0x04, 0x40, 0x7F, 0x0A, 0x00, 0xC1, 0xFF,
+    0x00, 0x80, 0x00, 0x7F, 0x10, 0x20, 0x02, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x80, 0x80, 0x04, 0x04, 0x10, 0x10, 0x00, 0x10, 0x41, 0x83,
+    0x20, 0x04, 0x80, 0x00, 0x20, 0x80, 0x60, 0x08, 0x80, 0x94, 0x01, 0x83,
+    0x11, 0x00, 0x00, 0x90, 0x40, 0x04, 0x60, 0x08, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x01, 0x01, 0x3F,
+    0x38, 0x04, 0x00, 0x3F, 0x40, 0x10, 0x60, 0xFF, 0x2A, 0x01, 0x20, 0x3F,
+    0x82, 0x08, 0x20, 0x3F, 0xA2, 0x02, 0x20, 0x3F, 0x01, 0x00, 0x60, 0xFF,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x9F, 0x00, 0x80, 0x1F,
+    0x60, 0x00, 0x1F, 0x04, 0x30, 0x1F, 0x10, 0x90, 0x1F, 0x02, 0x10, 0x5F,
+    0x00, 0x10, 0x1F, 0x0F, 0xE3, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x1F, 0x9F, 0x9F, 0x10, 0x00, 0x9F, 0x10, 0x80, 0x9F,
+    0x10, 0x80, 0x9F, 0x10, 0x80, 0x1F, 0x04, 0x81, 0x1F, 0x00, 0x04, 0x1F,
+    0x6C, 0x04, 0x1F, 0x00, 0x01, 0x1F,
+    // 0xC7 'Ç'
+    0x01, 0x84, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x20, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x7F, 0x10, 0x01, 0x08, 0xBF, 0x80, 0x00, 0x08, 0x7F,
+    0x80, 0x00, 0x08, 0x3F, 0x90, 0x00, 0x00, 0x3F, 0x88, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x20, 0x3F, 0x38, 0x01, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x30, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x3E, 0x3F, 0x04, 0x20, 0x01, 0x3F,
+    0x14, 0x21, 0x01, 0x3F, 0x0C, 0x21, 0x01, 0x3F, 0x00, 0x21, 0x01, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x00, 0xC4, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0xF0, 0x07, 0xBF,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0x14, 0x3F, 0x3E, 0x3F, 0x04, 0x20, 0x01, 0x3F,
+    0x00, 0x21, 0x01, 0x3F, 0x40, 0x21, 0x01, 0x3F, 0x48, 0x21, 0x01, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x00, 0xC4, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0xF0, 0x07, 0xBF,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x24, 0x00, 0x00, 0x3F, 0x48, 0x3F, 0x3E, 0x3F, 0x10, 0x20, 0x01, 0x3F,
+    0x00, 0x21, 0x01, 0x3F, 0x00, 0x21, 0x01, 0x3F, 0x20, 0x21, 0x01, 0x3F,
+    0x04, 0x01, 0x00, 0x3F, 0x00, 0x00, 0xC4, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0xF0, 0x07, 0xBF,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
+    0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x60, 0xFC, 0xF8,
+    0x00, 0x80, 0x04, 0x60, 0x84, 0x04, 0x10, 0x84, 0x04, 0x10, 0x84, 0x04,
+    0x80, 0x04, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x20, 0x03, 0xC0, 0x1E,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0xBF, 0x08, 0x00, 0x00, 0x3F,
+    0x40, 0x1F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x14, 0x00, 0x00, 0x3F, 0x0C, 0x3F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x0C, 0x1F, 0xFF, 0x3F, 0x14, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xFF, 0x3F, 0x48, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x3F,
+    0x24, 0x1F, 0xFF, 0x3F, 0x48, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x04, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x90, 0x00, 0x02, 0x10, 0x00, 0x00, 0x10, 0x7F, 0xFC,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0xFF, 0xFC,
+    0x10, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x0F, 0x9F, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x9F, 0x8F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x2F,
+    0x08, 0x01, 0x2F, 0x44, 0x02, 0x0F, 0x01, 0x08, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x06, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x04, 0x02, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x80, 0x40, 0x01, 0xBF,
+    0x10, 0x00, 0x40, 0x3F, 0x40, 0x08, 0x00, 0x3F, 0x08, 0x04, 0x08, 0x3F,
+    0x48, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x81, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x7F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x7F, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x03, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x5F, 0x30, 0x80, 0x04, 0x1F,
+    0x08, 0x00, 0x02, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x21, 0x00, 0x01, 0x3F,
+    0x05, 0x00, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x5F, 0x00, 0x06, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x40, 0x01, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x00, 0x08, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xD3 'Ó'
+    0x00, 0x03, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x5F, 0x00, 0x80, 0x04, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x05, 0x00, 0x01, 0x3F,
+    0x25, 0x00, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x02, 0x5F, 0x00, 0x06, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x40, 0x01, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x00, 0x08, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xD4 'Ô'
+    0x00, 0x03, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x5F, 0x08, 0x80, 0x04, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x01, 0x00, 0x01, 0x3F,
+    0x11, 0x00, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x5F, 0x0C, 0x06, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x40, 0x01, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x00, 0x08, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xD5 'Õ'
+    0x00, 0x06, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0xBF, 0x41, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x80, 0x40, 0x00, 0x3F, 0x12, 0x00, 0x02, 0x7F,
+    0x42, 0x00, 0x02, 0x3F, 0x0A, 0x40, 0x02, 0x3F, 0x48, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0xBF, 0x20, 0x0C, 0x10, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x80, 0x02, 0x3F, 0x00, 0x40, 0x04, 0x3F, 0x00, 0x10, 0x10, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x0C, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x60, 0x0F, 0xC1, 0x7F, 0x12, 0x00, 0x10, 0x7F,
+    0x10, 0x00, 0x08, 0x7F, 0x80, 0x80, 0x00, 0x7F, 0x04, 0x00, 0x04, 0xFF,
+    0x04, 0x00, 0x04, 0x7F, 0x84, 0x80, 0x04, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x09, 0x7F, 0x80, 0x18, 0x20, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x01, 0x00, 0x04, 0x7F, 0x00, 0x80, 0x08, 0x7F, 0x00, 0x20, 0x20, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x00, 0x0F, 0x10, 0x2F, 0x08, 0x0F, 0x44, 0x2F, 0x20, 0x4F, 0x00, 0x8F,
+    0x00, 0x8F, 0x00, 0x4F, 0x04, 0x2F, 0x08, 0x0F, 0x10, 0x2F, 0x00, 0x0F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x01, 0x8C, 0x4F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x01, 0xF0, 0x2F, 0x40, 0x08, 0x0F, 0x00, 0x11, 0x0F,
+    0x10, 0x20, 0x9F, 0x80, 0x40, 0x9F, 0x80, 0x80, 0x9F, 0x91, 0x00, 0x8F,
+    0x82, 0x00, 0x0F, 0x04, 0x01, 0x2F, 0x01, 0x04, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x8F, 0x40, 0x01, 0x0F, 0x04, 0x04, 0x0F, 0x40, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    0x30, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x3F, 0x04, 0x00, 0x01, 0x3F, 0x14, 0x00, 0x01, 0x3F,
+    0x0C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDA 'Ú'
+    0x00, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x00, 0x1F,
+    0x14, 0x00, 0x01, 0x3F, 0x04, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x40, 0x00, 0x00, 0x1F, 0x48, 0x00, 0x02, 0x1F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDB 'Û'
+    0x00, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    0x0C, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x24, 0x00, 0x00, 0x1F,
+    0x48, 0x00, 0x01, 0x3F, 0x10, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x02, 0x1F, 0x04, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDC 'Ü'
+    0x03, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x90, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x60, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x60, 0x00, 0x04, 0xFF,
+    0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x08, 0x7F, 0x80, 0xFF, 0xE1, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0A, 0x05, 0x1F,
+    0x2A, 0x05, 0x1F, 0x4A, 0x00, 0x7F, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x1F,
+    0x00, 0x02, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x01, 0x10, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xE3, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x46, 0x00, 0x03, 0x00, 0x00, 0x33,
+    0x00, 0x68, 0x03, 0x00, 0x04, 0x43, 0x11, 0x02, 0x03, 0x0E, 0x61, 0x03,
+    0x00, 0x90, 0xA3, 0x41, 0x00, 0x03, 0x22, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x83,
+    // 0xE0 'à'
+    0x00, 0x00, 0x49, 0x00, 0x00, 0x05, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x82, 0x11, 0x04, 0x22, 0x81, 0x10, 0x22, 0x95, 0x08, 0x1C, 0xE1,
+    0x00, 0x80, 0x05, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0xE1 'á'
+    0x00, 0x00, 0x49, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x82, 0x11, 0x10, 0x22, 0x81, 0x44, 0x22, 0x95, 0x88, 0x1C, 0xE1,
+    0x10, 0x80, 0x05, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0xE2 'â'
+    0x00, 0x00, 0x49, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01,
+    0x04, 0x82, 0x11, 0x08, 0x22, 0x81, 0x10, 0x22, 0x95, 0x48, 0x1C, 0xE1,
+    0x20, 0x80, 0x05, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x93, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x04, 0x23, 0x10, 0x45, 0x03, 0x00, 0x45, 0x2B, 0x08, 0x39, 0xC3,
+    0x49, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x1F, 0xE3,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x13,
+    // 0xE4 'ä'
+    0x00, 0x01, 0x27, 0x60, 0x00, 0x17, 0x90, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x82, 0x08, 0x47, 0x00, 0x8A, 0x07, 0x00, 0x8A, 0x57, 0x00, 0x73, 0x87,
+    0x92, 0x00, 0x17, 0x90, 0x00, 0x07, 0x61, 0x00, 0x07, 0x00, 0x3F, 0xC7,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27,
+    // 0xE5 'å'
+    0x00, 0x00, 0x49, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x12, 0x82, 0x11, 0x80, 0x22, 0x81, 0x80, 0x22, 0x95, 0x9A, 0x1C, 0xE1,
+    0x04, 0x80, 0x05, 0x10, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x0F, 0xF1,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0xE6 'æ'
+    0x00, 0x49, 0x00, 0x05, 0x01, 0x01, 0x00, 0x01, 0x82, 0x11, 0x22, 0x81,
+    0x20, 0x11, 0x1C, 0x85, 0x80, 0x01, 0x00, 0x01, 0x40, 0x05, 0x00, 0x41,
+    0x81, 0x01, 0x25, 0x01, 0x25, 0x11, 0x15, 0x11, 0x81, 0x11, 0x00, 0x01,
+    0x00, 0x01, 0x1E, 0x01,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x07, 0x08, 0x20, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x40, 0x8F, 0x80, 0x01, 0x07, 0x20, 0x01, 0x0F,
+    0x00, 0x11, 0x07, 0x80, 0x10, 0xA7, 0x84, 0x10, 0x07, 0x00, 0x04, 0x07,
+    0x10, 0x18, 0x07,
+    // 0xE8 'è'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x00, 0x40, 0x05,
+    0x10, 0x00, 0x01, 0x88, 0x90, 0x21, 0x40, 0x20, 0x01, 0x00, 0x20, 0x11,
+    0x04, 0x00, 0x11, 0x00, 0x8C, 0x11, 0x00, 0x80, 0x11, 0x00, 0x40, 0x05,
+    0x00, 0x20, 0x09, 0x00, 0x00, 0x01,
+    // 0xE9 'é'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0x90, 0x21, 0x04, 0x20, 0x01, 0x20, 0x20, 0x11,
+    0x80, 0x00, 0x11, 0x00, 0x8C, 0x11, 0x20, 0x80, 0x11, 0x00, 0x40, 0x05,
+    0x00, 0x20, 0x09, 0x00, 0x00, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x04, 0x40, 0x05,
+    0x08, 0x00, 0x01, 0x20, 0x90, 0x21, 0x40, 0x20, 0x01, 0x10, 0x20, 0x11,
+    0x00, 0x00, 0x11, 0x04, 0x8C, 0x11, 0x10, 0x80, 0x11, 0x0C, 0x40, 0x05,
+    0x00, 0x20, 0x09, 0x00, 0x00, 0x01,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x87, 0x00, 0x80, 0x27, 0x91, 0x00, 0x17,
+    0x90, 0x00, 0x07, 0x92, 0x40, 0x87, 0x60, 0x80, 0x07, 0x00, 0x80, 0x47,
+    0x60, 0x00, 0x47, 0x92, 0x30, 0x47, 0x92, 0x00, 0x47, 0x81, 0x00, 0x17,
+    0x00, 0x80, 0x27, 0x00, 0x00, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x03, 0x40, 0x20, 0x0B, 0x80, 0x80, 0x03, 0x40, 0x80, 0x03,
+    0x24, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0F,
+    // 0xED 'í'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x0B, 0x00, 0x80, 0x03, 0x0C, 0x80, 0x03,
+    0x20, 0x80, 0x03, 0x00, 0x80, 0x03, 0x80, 0x80, 0x03, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x0F,
+    // 0xEE 'î'
+    0x00, 0x00, 0x03, 0x08, 0x20, 0x0B, 0x00, 0x80, 0x03, 0x40, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x40, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x03,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x0F, 0x90, 0x80, 0x2F, 0x92, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x62, 0x00, 0x0F, 0x92, 0x00, 0x0F, 0x90, 0x00, 0x0F,
+    0x90, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x43, 0x00, 0x40, 0x13, 0x00, 0x80, 0x03,
+    0x0C, 0x00, 0x03, 0x15, 0x10, 0x83, 0x81, 0x00, 0x23, 0x09, 0x40, 0x03,
+    0x41, 0x00, 0x03, 0x01, 0x20, 0x23, 0x80, 0x0F, 0x83, 0x40, 0x00, 0x03,
+    0x02, 0x00, 0x13, 0x00, 0x80, 0x03, 0x00, 0x1F, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x20, 0x07,
+    0x11, 0x00, 0x07, 0x01, 0x00, 0x07, 0x08, 0x20, 0x17, 0x48, 0x0F, 0xE7,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x00, 0x40, 0x05,
+    0x60, 0x00, 0x01, 0x80, 0x88, 0x41, 0x00, 0x80, 0x11, 0x24, 0x20, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x10, 0x11, 0x00, 0x87, 0xC1, 0x00, 0x00, 0x01,
+    0x00, 0x40, 0x09, 0x00, 0x20, 0x11, 0x00, 0x0F, 0x81,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0x88, 0x41, 0x08, 0x80, 0x11, 0x00, 0x20, 0x01,
+    0x44, 0x00, 0x01, 0x88, 0x10, 0x11, 0x40, 0x87, 0xC1, 0x00, 0x00, 0x01,
+    0x00, 0x40, 0x09, 0x00, 0x20, 0x11, 0x00, 0x0F, 0x81,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x00, 0x40, 0x05,
+    0x08, 0x00, 0x01, 0x10, 0x88, 0x41, 0x44, 0x80, 0x11, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x10, 0x11, 0x20, 0x87, 0xC1, 0x08, 0x00, 0x01,
+    0x00, 0x40, 0x09, 0x00, 0x20, 0x11, 0x00, 0x0F, 0x81,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x43, 0x00, 0x40, 0x13, 0x00, 0x80, 0x0B,
+    0x00, 0x00, 0x03, 0x11, 0x10, 0x83, 0x01, 0x00, 0x23, 0x10, 0x40, 0x03,
+    0x08, 0x00, 0x03, 0x08, 0x20, 0x23, 0x09, 0x0F, 0x83, 0x10, 0x00, 0x03,
+    0x00, 0x80, 0x13, 0x00, 0x40, 0x23, 0x00, 0x1F, 0x03,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x87, 0x00, 0x80, 0x27, 0x61, 0x00, 0x17,
+    0x90, 0x00, 0x07, 0x92, 0x21, 0x07, 0x82, 0x00, 0x47, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x07, 0x90, 0x40, 0x47, 0x92, 0x1F, 0x07, 0x90, 0x00, 0x07,
+    0x61, 0x00, 0x27, 0x00, 0x80, 0x47, 0x00, 0x3E, 0x07,
+    // 0xF7 '÷'
+    0x06, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x60, 0x77, 0x80, 0x07,
+    0x80, 0x07, 0x00, 0x57, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x01, 0x08, 0x29, 0x20, 0x01, 0x00, 0x01, 0x00, 0x01, 0x90, 0x81,
+    0x81, 0x11, 0x22, 0x01, 0x24, 0x01, 0x08, 0x11, 0x82, 0x41, 0x00, 0x01,
+    0x00, 0x09, 0x80, 0x11, 0x0F, 0x81, 0x00, 0x01,
+    // 0xF9 'ù'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x10, 0x80, 0x01, 0x88, 0x40, 0x21, 0x40, 0x00, 0x11,
+    0x00, 0x00, 0x11, 0x0C, 0x20, 0x15, 0x00, 0x1F, 0xE1, 0x00, 0x80, 0x05,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFA 'ú'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x40, 0x21, 0x14, 0x00, 0x11,
+    0x00, 0x00, 0x11, 0x80, 0x20, 0x15, 0x00, 0x1F, 0xE1, 0x20, 0x80, 0x05,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFB 'û'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x80, 0x01,
+    0x04, 0x80, 0x01, 0x00, 0x80, 0x01, 0x20, 0x40, 0x21, 0x48, 0x00, 0x11,
+    0x10, 0x00, 0x11, 0x08, 0x20, 0x15, 0x04, 0x1F, 0xE1, 0x10, 0x80, 0x05,
+    0x04, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFC 'ü'
+    0x01, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x7F, 0xC7, 0x02, 0x00, 0x07,
+    0x92, 0x00, 0x07, 0x92, 0x00, 0x07, 0x91, 0x00, 0x87, 0x60, 0x00, 0x47,
+    0x00, 0x00, 0x47, 0x60, 0x80, 0x57, 0x90, 0x7F, 0x87, 0x92, 0x00, 0x17,
+    0x82, 0x00, 0x07, 0x02, 0x00, 0x07, 0x03, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xFE 'þ'
+    0x10, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x00, 0x1F, 0x4F, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x7F, 0x9F, 0xE7, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x40, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x01, 0x00, 0x01, 0x9F, 0x02, 0x80, 0x00, 0x1F, 0x02, 0x40, 0x00, 0x1F,
+    0x62, 0x10, 0x00, 0x1F, 0x92, 0x02, 0x00, 0x1F, 0x92, 0x00, 0x80, 0x5F,
+    0x82, 0x00, 0x20, 0x1F, 0x02, 0x18, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x1F,
+    0x00, 0x01, 0x04, 0x1F, 0x91, 0x08, 0x10, 0x1F, 0x92, 0xA0, 0x40, 0x1F,
+    0x62, 0x02, 0x00, 0x1F, 0x02, 0x08, 0x00, 0x1F, 0x02, 0x20, 0x00, 0x1F,
+    0x02, 0x80, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x80, 0x80, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x08, 0x30, 0x60, 0x7F, 0x00, 0x90, 0x00, 0x7F,
+    0x04, 0x10, 0x00, 0x7F, 0x01, 0x10, 0x00, 0x7F, 0x80, 0x30, 0x60, 0x7F,
+    0x20, 0x00, 0x06, 0x7F, 0x08, 0x00, 0x80, 0x7F, 0x01, 0x00, 0x00, 0xFF,
+    0x00, 0x20, 0x0C, 0xFF, 0x00, 0x0C, 0x12, 0xFF, 0x00, 0x01, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    // 0x105 'ą'
+    0x00, 0x48, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x82, 0x10, 0x0F, 0x22, 0x80, 0x0F, 0x22, 0x94, 0x0F, 0x1C, 0xE0, 0x0F,
+    0x80, 0x05, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x0F, 0xF2, 0x5F,
+    0x00, 0x04, 0x4F, 0x00, 0x08, 0x2F,
+    // 0x106 'Ć'
+    0x00, 0x03, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x5F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x05, 0x00, 0x00, 0x1F,
+    0x21, 0x00, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F, 0x09, 0x10, 0x00, 0x1F,
+    0x30, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x5F, 0x00, 0x70, 0x02, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x107 'ć'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x41, 0x14, 0x80, 0x01, 0x00, 0x20, 0x01,
+    0x80, 0x00, 0x11, 0x00, 0x80, 0x11, 0x20, 0x84, 0x11, 0x00, 0x00, 0x05,
+    0x00, 0x10, 0x19,
+    // 0x10C 'Č'
+    0x00, 0x03, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x60, 0x03, 0xF0, 0x5F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F, 0x01, 0x10, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x5F, 0x00, 0x70, 0x02, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x00, 0x09, 0x60, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x80, 0x41, 0x00, 0x80, 0x01, 0x10, 0x20, 0x01,
+    0x04, 0x00, 0x11, 0x08, 0x80, 0x11, 0x00, 0x84, 0x11, 0x40, 0x00, 0x05,
+    0x00, 0x10, 0x19,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x1F, 0xFE, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x3F, 0xFF, 0x1F, 0x10, 0x00, 0x01, 0x1F,
+    0x10, 0x00, 0x01, 0x1F, 0x24, 0x20, 0x01, 0x1F, 0x40, 0x00, 0x00, 0x5F,
+    0x00, 0x10, 0x02, 0x5F, 0x40, 0x88, 0x04, 0x1F, 0x00, 0x02, 0x10, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x0C, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x63, 0x00, 0x40, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x10, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x23,
+    0x10, 0x40, 0x23, 0x40, 0x00, 0x43, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x0F, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0x9F, 0x00, 0x7F, 0x10, 0x00, 0x80, 0x7F,
+    0x10, 0x80, 0x89, 0x7F, 0x10, 0x80, 0x90, 0x7F, 0x10, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x00, 0xFF, 0x00, 0x62, 0x02, 0xFF, 0x00, 0x04, 0x03, 0x7F,
+    0x78, 0x03, 0xC0, 0x7F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x0F, 0x08, 0x20, 0x0F, 0x20, 0x08, 0x0F, 0x40, 0x04, 0x0F,
+    0x00, 0x00, 0x0F, 0x90, 0x20, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x10, 0xCF,
+    0x00, 0x12, 0x0F, 0x8C, 0x10, 0x1F, 0x80, 0x12, 0x5F, 0x40, 0x04, 0x5F,
+    0x20, 0x08, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x1F, 0xFE, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x48, 0x00, 0x00, 0x3F,
+    0x24, 0x00, 0x00, 0x3F, 0x10, 0x3F, 0x3E, 0x3F, 0x10, 0x20, 0x01, 0x3F,
+    0x00, 0x21, 0x01, 0x3F, 0x08, 0x21, 0x01, 0x3F, 0x10, 0x21, 0x01, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x00, 0xC4, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0xF0, 0x07, 0xBF,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x00, 0x20, 0x09, 0x60, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x40, 0x90, 0x21, 0x00, 0x20, 0x01, 0x10, 0x20, 0x11,
+    0x20, 0x00, 0x11, 0x08, 0x8C, 0x11, 0x00, 0x80, 0x11, 0x40, 0x40, 0x05,
+    0x00, 0x20, 0x09, 0x00, 0x00, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x04, 0x1F, 0xFE, 0x3F, 0x14, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xFE, 0x3F, 0x40, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x09, 0xBF,
+    // 0x13A 'ĺ'
+    0x00, 0x80, 0x00, 0x3F, 0x09, 0x40, 0x00, 0x1F, 0x01, 0x3F, 0xFF, 0x9F,
+    0x20, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x01, 0xFF, 0xFF, 0x9F, 0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x03, 0xFF, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0xFF, 0xC7,
+    0x00, 0x00, 0x27, 0x08, 0x00, 0x27, 0x00, 0x00, 0x27, 0x0E, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x08, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x37,
+    // 0x13E 'ľ'
+    0x20, 0x00, 0x0F, 0x50, 0x00, 0x07, 0x4F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x1E, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x08, 0x5F, 0x00, 0x00, 0x1F,
+    0x0F, 0xCF, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x1F, 0x3F, 0x1F, 0x01, 0x40, 0x9F, 0x20, 0x00, 0x9F, 0x00, 0x80, 0x9F,
+    0x01, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0xDF,
+    // 0x142 'ł'
+    0x00, 0x00, 0x07, 0x20, 0x04, 0x0F, 0x50, 0x00, 0x07, 0x4F, 0xF3, 0xE7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x7F, 0x9F, 0xE7,
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x07,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x01, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x20, 0x00, 0xDF,
+    0x14, 0x00, 0x20, 0x1F, 0x24, 0x04, 0x00, 0x1F, 0x00, 0x02, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x40, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x3F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x80, 0x03, 0x44, 0x80, 0x03, 0x88, 0x10, 0x0B, 0x10, 0x07, 0xF3,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x01, 0x1F, 0x40, 0x01, 0x00, 0x1F, 0x24, 0x20, 0x00, 0xDF,
+    0x10, 0x00, 0x20, 0x1F, 0x10, 0x04, 0x00, 0x1F, 0x24, 0x02, 0x04, 0x1F,
+    0x48, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x9F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x3F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x10, 0x00, 0x03, 0x08, 0x40, 0x03, 0x24, 0x10, 0x03,
+    0x10, 0x80, 0x03, 0x00, 0x80, 0x03, 0x40, 0x10, 0x0B, 0x10, 0x07, 0xF3,
+    0x20, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x152 'Œ'
+    0x01, 0x8C, 0x0F, 0x04, 0x01, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F,
+    0x21, 0x08, 0x0F, 0x04, 0x02, 0x2F, 0x48, 0x01, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x10, 0x80, 0x8F, 0x10, 0x80, 0x8F,
+    0x00, 0x80, 0x0F, 0x00, 0xA2, 0x0F, 0x00, 0x04, 0x0F, 0x78, 0x04, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x00, 0x01, 0x08, 0x21, 0x00, 0x09, 0x00, 0x05, 0x00, 0x01, 0x88, 0x41,
+    0x80, 0x11, 0x20, 0x01, 0x00, 0x01, 0x10, 0x11, 0x87, 0xC5, 0x00, 0x01,
+    0x00, 0x09, 0x40, 0x05, 0x0C, 0x41, 0x80, 0x01, 0x20, 0x11, 0x20, 0x11,
+    0x10, 0x11, 0x80, 0x11, 0x00, 0x11, 0x00, 0x05, 0x1F, 0x11,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x20, 0x1F, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x24, 0x00, 0x00, 0x1F, 0x10, 0x20, 0x81, 0x1F, 0x10, 0x00, 0x90, 0x1F,
+    0x24, 0x20, 0x08, 0xDF, 0x48, 0x01, 0x00, 0x1F, 0x00, 0x0A, 0x01, 0x1F,
+    0x40, 0x00, 0x50, 0x9F, 0x00, 0x00, 0x08, 0x5F, 0x00, 0x40, 0x04, 0x1F,
+    0x00, 0x1E, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x9F,
+    // 0x159 'ř'
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x03, 0x10, 0x80, 0x03,
+    0x08, 0x00, 0x03, 0x24, 0x00, 0x03, 0x10, 0x20, 0x03, 0x00, 0x40, 0x03,
+    0x40, 0x90, 0x03, 0x10, 0x10, 0x03, 0x20, 0x00, 0x03, 0x00, 0xA0, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x21, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x42, 0x1F, 0x08, 0x08, 0x01, 0x1F, 0x00, 0x20, 0x20, 0x3F,
+    0x05, 0x02, 0x00, 0x3F, 0x21, 0x00, 0x11, 0x1F, 0x41, 0x01, 0x00, 0x1F,
+    0x08, 0x10, 0x00, 0x5F, 0x30, 0x04, 0x80, 0x1F, 0x00, 0x00, 0x40, 0x9F,
+    0x00, 0x00, 0x22, 0x1F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x39, 0x00, 0x02, 0x41, 0x00, 0x01, 0x41, 0x00, 0x80, 0x11,
+    0x0C, 0xA8, 0x81, 0x20, 0x00, 0x01, 0x00, 0x04, 0x41, 0x80, 0x20, 0x31,
+    0x60, 0x9A, 0x05, 0x00, 0x08, 0x01, 0x00, 0x70, 0x11, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x21, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x42, 0x1F, 0x00, 0x08, 0x01, 0x1F, 0x00, 0x20, 0x20, 0x3F,
+    0x01, 0x02, 0x00, 0x3F, 0x01, 0x00, 0x11, 0x1F, 0x01, 0x01, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x04, 0x80, 0x1F, 0x00, 0x00, 0x40, 0x9F,
+    0x00, 0x00, 0x22, 0x1F,
+    // 0x161 'š'
+    0x00, 0x00, 0x39, 0x60, 0x02, 0x41, 0x10, 0x01, 0x41, 0x40, 0x80, 0x11,
+    0x20, 0xA8, 0x81, 0x10, 0x00, 0x01, 0x20, 0x04, 0x41, 0x48, 0x20, 0x31,
+    0x10, 0x9A, 0x05, 0x00, 0x08, 0x01, 0x00, 0x70, 0x11, 0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x7F, 0x10, 0x20, 0x00, 0x3F,
+    0x48, 0x20, 0x00, 0x3F, 0x24, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x24, 0x00, 0x00, 0x3F, 0x48, 0x20, 0x01, 0x3F,
+    0x10, 0x20, 0x00, 0x3F, 0x60, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x33,
+    0x08, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x01, 0x00, 0x23, 0x81, 0x00, 0x23, 0x89, 0x00, 0x0B, 0x60, 0x00, 0x33,
+    // 0x16E 'Ů'
+    0x00, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x2A, 0x00, 0x01, 0x3F, 0x82, 0x00, 0x01, 0x3F, 0xAA, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x1F, 0x28, 0x00, 0x02, 0x1F, 0x00, 0x3F, 0xF8, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x24, 0x80, 0x01, 0x02, 0x40, 0x21, 0x82, 0x00, 0x11,
+    0x80, 0x00, 0x11, 0xAA, 0x20, 0x15, 0x00, 0x1F, 0xE1, 0x28, 0x80, 0x05,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x170 'Ű'
+    0x00, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x24, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x01, 0x3F, 0x50, 0x00, 0x01, 0x3F,
+    0x0C, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x02, 0x1F, 0x20, 0x3F, 0xF8, 0x5F,
+    0x08, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x0C, 0x80, 0x01, 0x20, 0x40, 0x21, 0x80, 0x00, 0x11,
+    0x10, 0x00, 0x11, 0x00, 0x20, 0x15, 0x10, 0x1F, 0xE1, 0x04, 0x80, 0x05,
+    0x88, 0x80, 0x01, 0x60, 0x80, 0x01, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x178 'Ÿ'
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x60, 0x00, 0x00, 0x90, 0x04, 0x00, 0x10, 0x01, 0x00, 0x80, 0x00, 0x7C,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x10, 0xFC,
+    0x10, 0x40, 0x00, 0x80, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x02, 0x5F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x08, 0x10, 0x1F, 0x00, 0x20, 0x20, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x21, 0x01, 0x1F, 0x04, 0x20, 0x09, 0x1F, 0x20, 0x28, 0x01, 0x1F,
+    0x00, 0x20, 0x41, 0x1F, 0x08, 0x00, 0x01, 0x1F, 0x30, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x60, 0x00, 0xDF,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x01, 0x00, 0x78, 0x05, 0x00, 0x80, 0x41, 0x00, 0x90, 0x81,
+    0x00, 0x80, 0x01, 0x0C, 0x80, 0x11, 0x20, 0x88, 0x11, 0x00, 0x90, 0x91,
+    0x00, 0x81, 0x11, 0x60, 0x80, 0x11, 0x00, 0x80, 0x21, 0x00, 0x90, 0x01,
+    0x00, 0x60, 0x79,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x04, 0xBF, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x10, 0x20, 0x3F, 0x00, 0x40, 0x40, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x42, 0x02, 0x3F, 0x88, 0x40, 0x12, 0x3F, 0x88, 0x50, 0x02, 0x3F,
+    0x00, 0x40, 0x82, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0xC0, 0x01, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x03, 0x00, 0xF0, 0x0B, 0x01, 0x00, 0x83, 0x01, 0x21, 0x03,
+    0x21, 0x00, 0x03, 0x09, 0x00, 0x23, 0x09, 0x10, 0x23, 0x09, 0x21, 0x23,
+    0x71, 0x02, 0x23, 0x01, 0x00, 0x23, 0x01, 0x00, 0x43, 0x01, 0x20, 0x03,
+    0x00, 0xC0, 0xF3,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x02, 0x5F, 0x00, 0x04, 0x00, 0x1F,
+    0x60, 0x08, 0x10, 0x1F, 0x00, 0x20, 0x20, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x21, 0x01, 0x1F, 0x00, 0x20, 0x09, 0x1F, 0x00, 0x28, 0x01, 0x1F,
+    0x00, 0x20, 0x41, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x60, 0x00, 0xDF,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x01, 0x00, 0x78, 0x05, 0x60, 0x80, 0x41, 0x00, 0x90, 0x81,
+    0x40, 0x80, 0x01, 0x00, 0x80, 0x11, 0x10, 0x88, 0x11, 0x20, 0x90, 0x91,
+    0x48, 0x81, 0x11, 0x00, 0x80, 0x11, 0x40, 0x80, 0x21, 0x00, 0x90, 0x01,
+    0x00, 0x60, 0x79,
+    // 0x3C0 'π'
+    0x18, 0x01, 0x04, 0x01, 0x88, 0x01, 0x90, 0x19, 0x91, 0x81, 0x80, 0x01,
+    0x80, 0x01, 0x81, 0xF1, 0x90, 0x01, 0x90, 0x01, 0x93, 0xF1, 0x80, 0x05,
+    0x80, 0x01, 0x8F, 0xC1, 0x90, 0x11, 0x80, 0x11, 0x00, 0x11, 0x00, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x0C, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0xFF, 0xEF, 0x08, 0x00, 0x0F,
+    0x10, 0x03, 0xCF, 0x80, 0x04, 0x2F, 0x81, 0x20, 0x0F, 0x80, 0x00, 0x8F,
+    0x18, 0x00, 0x1F, 0x00, 0x90, 0x1F, 0x02, 0x08, 0x8F, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x20, 0x4F, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x0F,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x00, 0x7F, 0x09, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x12, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x10, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x60, 0xFF, 0x00, 0xFF, 0x01, 0x7F, 0x00, 0x7F, 0x10, 0x7F,
+    // 0x201B '‛'
+    0x00, 0x7F, 0x44, 0x7F, 0x01, 0x7F, 0x00, 0xFF, 0x52, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x00, 0x7F, 0x09, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x12, 0x7F, 0x00, 0x7F,
+    0x0F, 0x7F, 0x20, 0xFF, 0x40, 0xFF, 0x1C, 0x7F, 0x40, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x20, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x10, 0x7F,
+    0x01, 0xFF, 0x0C, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x38, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x60, 0xFF, 0x00, 0xFF, 0x01, 0x7F, 0x00, 0x7F, 0x10, 0x7F,
+    0x01, 0x7F, 0x18, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x38, 0x7F,
+    // 0x201F '‟'
+    0x00, 0x7F, 0x44, 0x7F, 0x01, 0x7F, 0x00, 0xFF, 0x52, 0xFF, 0x00, 0x7F,
+    0x28, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x5C, 0xFF, 0x01, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x45, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x3F,
+    0x05, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x01, 0x07,
+    0x05, 0x05, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0x07, 0x00, 0x8D, 0x07,
+    0x05, 0x05, 0x07, 0x04, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2022 '•'
+    0x4B, 0x07, 0x83, 0x83, 0x07, 0x3B,
+    // 0x2026 '…'
+    0x57, 0x87, 0x8F, 0x87, 0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x67, 0x87, 0x8F, 0x87, 0x17,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x20, 0x9F, 0x44, 0x1F, 0x10, 0x1F,
+    0xA0, 0x1F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x40, 0x5F, 0x80, 0x1F, 0x02, 0x5F, 0x40, 0x1F, 0x20, 0x1F, 0x10, 0x1F,
+    0x0A, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x07, 0x10, 0x27, 0x00, 0x17, 0x43, 0x07, 0x10, 0x0F, 0x00, 0x2F,
+    0x00, 0x0F, 0x10, 0x07, 0x00, 0x07, 0x00, 0x07, 0x10, 0xC7, 0x00, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x07, 0x01, 0x07, 0x00, 0x07, 0x09, 0x07, 0x12, 0x07, 0x00, 0x07,
+    0x0F, 0x37, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x2F, 0x02, 0x2F, 0x00, 0x2F, 0x18, 0x0F, 0x01, 0x47,
+    0x00, 0x07, 0x00, 0x07, 0x60, 0x47,
+    // 0x2076 '⁶'
+    0x03, 0xC7, 0x00, 0x07, 0x00, 0x07, 0x00, 0x4F, 0x4A, 0x2F, 0x10, 0x2F,
+    0x01, 0xCF, 0x24, 0x07, 0x20, 0x07, 0x01, 0xC7,
+    // 0x2077 '⁷'
+    0x00, 0x07, 0x00, 0x07, 0x08, 0x37, 0x00, 0x0F, 0x02, 0x0F, 0x08, 0x67,
+    0x01, 0x07, 0x04, 0x07, 0x00, 0x07, 0x20, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0xE7, 0x24, 0x07, 0x42, 0x07, 0x10, 0x2F, 0x21, 0x0F, 0x20, 0x0F,
+    0x10, 0x4F, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07,
+    // 0x2079 '⁹'
+    0x1C, 0x17, 0x00, 0x0F, 0x00, 0x2F, 0x14, 0x0F, 0x02, 0x47, 0x02, 0x87,
+    0x0C, 0x07, 0x40, 0x27, 0x20, 0x87, 0x04, 0x07,
+    // 0x2080 '₀'
+    0x00, 0x07, 0x10, 0x27, 0x00, 0x07, 0x43, 0x0F, 0x10, 0x0F, 0x00, 0x2F,
+    0x00, 0x0F, 0x00, 0x4F, 0x00, 0x07, 0x00, 0x07, 0x10, 0x47, 0x00, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x27, 0x4F, 0xC7, 0x40, 0x07, 0x00, 0x07,
+    0x7F, 0xC7, 0x00, 0x27, 0x00, 0x17,
+    // 0x2082 '₂'
+    0x10, 0x37, 0x00, 0x47, 0x40, 0x07, 0x10, 0x07, 0x00, 0x47, 0x04, 0x07,
+    0x00, 0x07, 0x40, 0x07, 0x24, 0x07, 0x00, 0x37,
+    // 0x2083 '₃'
+    0x00, 0x17, 0x00, 0x2F, 0x12, 0x2F, 0x01, 0x2F, 0x25, 0x0F, 0x09, 0x4F,
+    0x00, 0x07, 0x46, 0x17, 0x38, 0x27, 0x00, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x12, 0x87, 0x20, 0x87,
+    0x0F, 0x3F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x87, 0x00, 0x87,
+    // 0x2085 '₅'
+    0x00, 0x07, 0x00, 0x2F, 0x02, 0x2F, 0x00, 0x2F, 0x18, 0x2F, 0x01, 0x4F,
+    0x04, 0x07, 0x00, 0x07, 0x61, 0x47,
+    // 0x2086 '₆'
+    0x03, 0xC7, 0x08, 0x17, 0x00, 0x07, 0x00, 0x4F, 0x4A, 0x2F, 0x10, 0x2F,
+    0x01, 0xCF, 0x24, 0x07, 0x20, 0x17, 0x01, 0xC7,
+    // 0x2087 '₇'
+    0x00, 0x07, 0x00, 0x07, 0x08, 0x37, 0x00, 0x0F, 0x02, 0x0F, 0x08, 0x67,
+    0x01, 0x07, 0x04, 0x07, 0x00, 0x07, 0x20, 0x07,
+    // 0x2088 '₈'
+    0x00, 0xE7, 0x25, 0x07, 0x42, 0x0F, 0x18, 0x2F, 0x21, 0x0F, 0x24, 0x0F,
+    0x10, 0x4F, 0x42, 0x07, 0x01, 0x07, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x1C, 0x17, 0x01, 0x0F, 0x00, 0x2F, 0x14, 0x2F, 0x02, 0xCF, 0x02, 0x87,
+    0x0E, 0x17, 0x40, 0x27, 0x20, 0x07, 0x04, 0x07,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x18, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x20, 0x0F, 0x02, 0x01, 0x0F,
+    0x08, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x21, 0x44, 0x2F, 0x04, 0x40, 0x0F,
+    0x48, 0x40, 0x0F, 0x40, 0x40, 0x8F, 0x10, 0x48, 0x8F, 0x10, 0x80, 0x8F,
+    0x10, 0x00, 0x8F, 0x42, 0x00, 0x8F, 0x42, 0x00, 0x2F, 0x18, 0x00, 0xCF,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x00, 0x3F, 0x30, 0x3F, 0x20, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    0x20, 0x7F, 0x20, 0xBF, 0x00, 0x3F, 0x60, 0x3F, 0x00, 0xFF, 0x2F, 0x7F,
+    0x00, 0x7F, 0x08, 0xFF, 0x62, 0x3F, 0x08, 0x3F, 0x0A, 0x3F, 0x48, 0xBF,
+    0x01, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x03, 0x10, 0x0C, 0x03, 0x10, 0x04, 0x03, 0x07, 0xF4, 0x03,
+    0x20, 0x04, 0x03, 0x00, 0x04, 0x03, 0x1F, 0xF4, 0x03, 0x00, 0x04, 0x23,
+    0x00, 0x0C, 0x07, 0x00, 0x01, 0x0B, 0x00, 0x04, 0x23, 0x00, 0x00, 0x83,
+    0x00, 0x22, 0x03, 0x00, 0x88, 0x03, 0x02, 0x00, 0x03, 0x08, 0x40, 0x03,
+    0x21, 0x00, 0x03, 0x04, 0x50, 0x03, 0x00, 0x10, 0x03, 0x00, 0xA4, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0xA8, 0x43, 0x00, 0x80, 0x83, 0x00, 0x04, 0x03,
+    0x00, 0x4A, 0x23, 0x00, 0x00, 0x83,
+    // 0x2154 '⅔'
+    0x0C, 0x08, 0x03, 0x00, 0x04, 0x03, 0x22, 0x04, 0x03, 0x08, 0x04, 0x03,
+    0x00, 0x04, 0x03, 0x08, 0x14, 0x03, 0x20, 0x54, 0x03, 0x00, 0x94, 0x13,
+    0x10, 0x14, 0x47, 0x00, 0x18, 0x0B, 0x00, 0x02, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x21, 0x03, 0x00, 0x84, 0x03, 0x00, 0x10, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x42, 0x50, 0x03, 0x48, 0x10, 0x03, 0x20, 0xA4, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0xA8, 0x43, 0x00, 0x80, 0x83, 0x00, 0x04, 0x03,
+    0x00, 0x4A, 0x23, 0x00, 0x00, 0x83,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x03, 0x10, 0x0C, 0x03, 0x10, 0x04, 0x03, 0x07, 0xF4, 0x03,
+    0x20, 0x04, 0x03, 0x00, 0x04, 0x03, 0x1F, 0xF4, 0x03, 0x00, 0x04, 0x13,
+    0x00, 0x0C, 0x47, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x23, 0x00, 0x08, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x84, 0x03, 0x02, 0x10, 0x03, 0x00, 0x40, 0x03,
+    0x01, 0x00, 0x43, 0x40, 0x29, 0x03, 0x48, 0x46, 0x03, 0x20, 0x00, 0xC3,
+    0x00, 0x88, 0x23, 0x00, 0x81, 0x23, 0x00, 0xA8, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x10, 0xC3,
+    // 0x215C '⅜'
+    0x08, 0x08, 0x03, 0x04, 0x00, 0x03, 0x21, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x02, 0x90, 0x03, 0x0C, 0x04, 0x03, 0x20, 0x00, 0x0B, 0x21, 0x08, 0x23,
+    0x1C, 0x90, 0x87, 0x00, 0x00, 0x13, 0x00, 0x04, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x42, 0x03, 0x01, 0x08, 0x03, 0x00, 0x20, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x43, 0x04, 0x29, 0x03, 0x10, 0x46, 0x03, 0x00, 0x00, 0xC3,
+    0x00, 0x88, 0x23, 0x00, 0x81, 0x23, 0x00, 0xA8, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x10, 0xC3,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x03, 0x01, 0x04, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x28, 0x90, 0x03, 0x2A, 0x04, 0x03, 0x2A, 0x00, 0x0B, 0x28, 0x08, 0x23,
+    0x30, 0x90, 0x87, 0x00, 0x02, 0x13, 0x00, 0x00, 0x43, 0x00, 0x11, 0x03,
+    0x00, 0x40, 0x03, 0x01, 0x00, 0x03, 0x04, 0x20, 0x03, 0x10, 0x80, 0x03,
+    0x42, 0x00, 0x43, 0x40, 0x29, 0x03, 0x10, 0x46, 0x03, 0x00, 0x00, 0xC3,
+    0x00, 0x88, 0x23, 0x00, 0x81, 0x23, 0x00, 0xA8, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x10, 0xC3,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x03, 0x22, 0x00, 0x03, 0x20, 0x18, 0x03, 0x28, 0x40, 0x03,
+    0x29, 0x00, 0x03, 0x28, 0x10, 0x0B, 0x20, 0x80, 0x23, 0x20, 0x00, 0x87,
+    0x24, 0x00, 0x13, 0x10, 0x04, 0x43, 0x00, 0x10, 0x03, 0x00, 0x40, 0x03,
+    0x01, 0x08, 0x03, 0x04, 0x20, 0x03, 0x10, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x43, 0x10, 0x29, 0x03, 0x00, 0x46, 0x03, 0x00, 0x00, 0xC3,
+    0x00, 0x88, 0x23, 0x00, 0x81, 0x23, 0x00, 0xA8, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x10, 0xC3,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x09, 0x0F, 0x00, 0x0F,
+    0x20, 0x4F, 0x00, 0x0F, 0x08, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    // 0x2191 '↑'
+    0x04, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xBF,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x20, 0x4F, 0x00, 0x0F, 0x09, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x08, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F,
+    0x7F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x40, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x08, 0x04, 0x3F, 0x12, 0x12, 0x3F, 0x24, 0x09, 0x3F,
+    0x48, 0x04, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x48, 0x04, 0xBF,
+    0x24, 0x09, 0x3F, 0x10, 0x12, 0x3F, 0x08, 0x04, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x10, 0x50, 0x0A, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x02, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x50, 0x0A, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F,
+    0x00, 0x40, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x40, 0x0B,
+    0x10, 0x23, 0x20, 0x13, 0x00, 0x03, 0x00, 0x03, 0x20, 0x13, 0x10, 0x23,
+    0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x83, 0x00, 0x08, 0x13, 0x00, 0x20, 0x0B, 0x20, 0x40, 0x03,
+    0x50, 0x8C, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x01, 0x00, 0x0B,
+    0x11, 0x00, 0x83, 0x04, 0x2C, 0x13, 0x40, 0x00, 0x23, 0x00, 0x00, 0x83,
+    0x10, 0x02, 0x03, 0x01, 0xC0, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x81, 0x9F, 0x04, 0x08, 0x1F, 0x10, 0x40, 0x1F, 0x41, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x20, 0x1F, 0x20, 0x04, 0x1F,
+    0x04, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+    0x10, 0x00, 0x00, 0x10, 0x00, 0x06, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x10, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x06,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x10, 0x00, 0x00, 0x10, 0x28, 0x00, 0x10, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x04, 0x00, 0x20, 0x02, 0x00, 0x00, 0x60, 0x00, 0x02,
+    0x00, 0x00, 0x70,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x01, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x81, 0x00, 0x0C, 0x08, 0x00, 0x40, 0x40,
+    0x06, 0x02, 0x00, 0x20, 0x10, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x1E, 0x3F, 0x40, 0xBF, 0x80, 0x3F, 0x82, 0x3F, 0x20, 0x3F, 0x82, 0x3F,
+    0x0C, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x48, 0x3F, 0x10, 0x3F, 0x80, 0x3F,
+    0x00, 0x3F, 0x8C, 0x3F, 0x00, 0xBF, 0x22, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x08, 0x00, 0x00, 0x2F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x2260 '≠'
+    0x18, 0xC7, 0x01, 0x07, 0x01, 0x37, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x01, 0x07, 0x81, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x47,
+    // 0x2264 '≤'
+    0x06, 0x03, 0x01, 0x04, 0x08, 0x04, 0x00, 0x84, 0x12, 0x04, 0x04, 0x44,
+    0x21, 0x04, 0x08, 0x24, 0x40, 0x84, 0x10, 0x14, 0x00, 0x44, 0x20, 0x24,
+    // 0x2265 '≥'
+    0x00, 0x03, 0x80, 0x54, 0x90, 0x14, 0x00, 0x84, 0x08, 0x24, 0x01, 0x04,
+    0x00, 0x44, 0x00, 0x04, 0x00, 0x84, 0x08, 0x04, 0x01, 0x04, 0x04, 0x04,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly26BoldColOffsets[] PROGMEM = {
+    0x0, 0x1A, 0x2C, 0x3E, 0x71, 0xA9, 0xF1, 0x130, 0x138, 0x15C, 0x180, 0x194,
+    0x1AC, 0x1BA, 0x1C3, 0x1C9, 0x1F0, 0x220, 0x244, 0x26E, 0x298, 0x2C8, 0x2EF, 0x319,
+    0x343, 0x36D, 0x397, 0x3A3, 0x3B8, 0x3D0, 0x3DC, 0x3F4, 0x415, 0x475, 0x4B1, 0x4E1,
+    0x511, 0x54D, 0x57D, 0x5AA, 0x5E0, 0x622, 0x640, 0x670, 0x6AC, 0x6DC, 0x727, 0x766,
+    0x79F, 0x7CF, 0x81F, 0x858, 0x87F, 0x8B5, 0x8F4, 0x930, 0x987, 0x9C3, 0x9FC, 0xA2C,
+    0xA48, 0xA6F, 0xA8B, 0xAA7, 0xAB4, 0xABB, 0xAD7, 0xB0A, 0xB24, 0xB57, 0xB73, 0xB9D,
+    0xBCD, 0xC00, 0xC1B, 0xC3F, 0xC72, 0xC8D, 0xCC1, 0xCE5, 0xD03, 0xD33, 0xD63, 0xD7B,
+    0xD93, 0xDB7, 0xDDB, 0xDFD, 0xE2D, 0xE4D, 0xE80, 0xE9A, 0xEBE, 0xECA, 0xEEE, 0xEFC,
+    0xF0B, 0xF43, 0xF73, 0xF91, 0xFC7, 0xFEE, 0x102A, 0x103E, 0x105C, 0x107A, 0x108E, 0x10B2,
+    0x10C6, 0x10DA, 0x110D, 0x113A, 0x1140, 0x1152, 0x1166, 0x1182, 0x11D3, 0x1221, 0x1272, 0x1293,
+    0x12E3, 0x1333, 0x1383, 0x13D3, 0x140F, 0x145F, 0x14AD, 0x14ED, 0x152D, 0x156D, 0x15AD, 0x15DD,
+    0x1605, 0x162D, 0x1659, 0x167A, 0x16B6, 0x170A, 0x1756, 0x17A2, 0x17EE, 0x183A, 0x1886, 0x189E,
+    0x18DA, 0x192E, 0x1982, 0x19D6, 0x1A2A, 0x1A5A, 0x1A8D, 0x1AB7, 0x1AE1, 0x1B0B, 0x1B35, 0x1B5F,
+    0x1B89, 0x1BB1, 0x1BD8, 0x1C02, 0x1C2C, 0x1C56, 0x1C80, 0x1C9B, 0x1CB6, 0x1CD4, 0x1CF2, 0x1D1F,
+    0x1D55, 0x1D82, 0x1DAF, 0x1DDC, 0x1E09, 0x1E36, 0x1E4E, 0x1E6E, 0x1EA4, 0x1EDA, 0x1F10, 0x1F46,
+    0x1F86, 0x1FCA, 0x201A, 0x2044, 0x2084, 0x20AB, 0x20EB, 0x2112, 0x2162, 0x219B, 0x21DB, 0x2205,
+    0x2245, 0x226F, 0x22AF, 0x22D3, 0x2303, 0x2327, 0x235A, 0x237B, 0x23CF, 0x2405, 0x2459, 0x248F,
+    0x24DA, 0x2508, 0x2554, 0x2578, 0x25AC, 0x25D0, 0x2604, 0x2628, 0x2670, 0x2694, 0x26E8, 0x271E,
+    0x2772, 0x27A8, 0x27E1, 0x2821, 0x2848, 0x2888, 0x28AF, 0x28EF, 0x2916, 0x293A, 0x2976, 0x2983,
+    0x299D, 0x29A9, 0x29B5, 0x29C1, 0x29CD, 0x29E3, 0x29F9, 0x2A0F, 0x2A25, 0x2A4C, 0x2A73, 0x2A79,
+    0x2A8F, 0x2A9F, 0x2AAD, 0x2AC5, 0x2ADB, 0x2AED, 0x2B01, 0x2B15, 0x2B29, 0x2B3D, 0x2B55, 0x2B67,
+    0x2B7B, 0x2B8F, 0x2BA5, 0x2BB7, 0x2BCB, 0x2BDF, 0x2BF3, 0x2C07, 0x2C28, 0x2C49, 0x2C79, 0x2C9A,
+    0x2CBB, 0x2CDC, 0x2D08, 0x2D56, 0x2DA4, 0x2DF2, 0x2E40, 0x2E8E, 0x2EDC, 0x2EFC, 0x2F20, 0x2F40,
+    0x2F64, 0x2F88, 0x2FAC, 0x2FD0, 0x3000, 0x3024, 0x3054, 0x3078, 0x30A2, 0x30D8, 0x3117, 0x314A,
+    0x3180, 0x31A0, 0x31DC, 0x31F4, 0x320C, 0x3224, 0x3245, 0x3266, 0x3287, 0x32A8, 0x32C9, 0x32EA,
+    0x330B, 0x332C, 0x334D, 0x336E, 0x338F, 0x33B0, 0x33D1, 0x33F2, 0x3413, 0x3434, 0x3455, 0x3476,
+    0x3497, 0x34B8, 0x34D9
+};
+
+
 const SimpleGFXfont Bookerly26Bold PROGMEM = {Bookerly26BoldBitmaps, Bookerly26BoldBitmaps_lsb, Bookerly26BoldBitmaps_msb, Bookerly26BoldGlyphs,
-    315, 28};
+    315, 28,
+    nullptr, 0, FontStyle::REGULAR, Bookerly26BoldGlyphIndexLatin1, Bookerly26BoldGlyphRanges, 13,
+    Bookerly26BoldBitmapsCol, Bookerly26BoldBitmapsCol_lsb, Bookerly26BoldBitmapsCol_msb, Bookerly26BoldColOffsets};
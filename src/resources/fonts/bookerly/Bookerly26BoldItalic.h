@@ -5373,5 +5373,4857 @@ const SimpleGFXglyph Bookerly26BoldItalicGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly26BoldItalicGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly26BoldItalicGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly26BoldItalicBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xF9, 0x8F, 0xF8, 0x01, 0x0F, 0xC0, 0x01, 0x8F,
+    0x80, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xFE, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFF, 0x1F, 0xFF, 0xF0, 0x7F,
+    0x80, 0x7F, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xCF, 0xFF, 0xFB, 0xCF, 0xFF, 0xF3, 0xC8, 0xFF, 0xF3, 0x80, 0xFF,
+    0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x4F, 0xFF, 0x03, 0xCF, 0xFF,
+    0xF3, 0xC0, 0xFF, 0xF1, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
+    0x00, 0xCF, 0xFF, 0x03, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFC, 0x1F, 0x86, 0x3F, 0xF8, 0x0F, 0xC0, 0x3F, 0xF0, 0x06, 0x01, 0xFF,
+    0xF1, 0x80, 0x07, 0xFF, 0xF3, 0x00, 0xE7, 0xFF, 0xF0, 0x01, 0xC7, 0xFF,
+    0x80, 0xE0, 0x0F, 0xFF, 0x01, 0xF0, 0x0F, 0xFF, 0xF0, 0x78, 0x1F, 0xFF,
+    0xF8, 0x7E, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFE, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0xC7, 0xFF,
+    0xC7, 0xE7, 0xE7, 0xCF, 0xC7, 0xC7, 0xCF, 0x87, 0x07, 0xC0, 0x0E, 0x0F,
+    0xC0, 0x1C, 0x3F, 0xE0, 0x70, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFE, 0x1E, 0x3F, 0xF8, 0x30, 0x0F, 0xF0, 0xE0, 0x0F,
+    0xC1, 0xC0, 0x87, 0x83, 0xC7, 0xC7, 0x8F, 0xCF, 0xCF, 0xDF, 0x8F, 0x0F,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x1F,
+    0xFF, 0x1F, 0x1F, 0xE0, 0x1F, 0x1F, 0xC0, 0x0F, 0x9F, 0x80, 0x03, 0x9F,
+    0x8E, 0x00, 0x9F, 0x1C, 0xE0, 0x1F, 0x3C, 0xF8, 0x3F, 0x19, 0xDC, 0x3F,
+    0x01, 0x9C, 0x1F, 0x83, 0x18, 0x1F, 0xCF, 0x00, 0x0F, 0xFF, 0x03, 0x8F,
+    0xFE, 0x0F, 0x8F, 0xFE, 0x3F, 0xCF, 0xFE, 0x7F, 0xCF, 0xFC, 0x7F, 0xCF,
+    0xFC, 0xFF, 0xFF,
+    // 0x27 '''
+    0xFE, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFF, 0x1F, 0xFF,
+    // 0x28 '('
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x07, 0x80, 0x7F, 0xF0, 0x7F, 0xF8, 0x3F,
+    0xE0, 0xFF, 0xFE, 0x3F, 0xC3, 0xFF, 0xFF, 0x7F, 0x87, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0x9F, 0xFF, 0xF0, 0xFF,
+    0x0F, 0xFF, 0xE1, 0xFF, 0x83, 0xFF, 0x83, 0xFF, 0xC0, 0x38, 0x07, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xC4, 0xFF, 0xC4, 0x7F, 0xE0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F,
+    0x82, 0x3F, 0xD1, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF,
+    // 0x2B '+'
+    0xF9, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x00, 0x0F,
+    0x00, 0x0F, 0x80, 0x0F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF,
+    // 0x2C ','
+    0xFE, 0xFF, 0xFC, 0xFF, 0xB0, 0xFF, 0x81, 0xFF, 0x03, 0xFF, 0x07, 0xFF,
+    0x9F, 0xFF,
+    // 0x2D '-'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2E '.'
+    0xCF, 0x8F, 0x0F, 0x0F, 0x9F,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x1C, 0x1F, 0xE0, 0xFF, 0x1F, 0xC3, 0xFF, 0x1F, 0x87, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFE, 0x3F, 0x8F, 0xF8, 0x3F, 0x87, 0xC0, 0x7F,
+    0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x3F, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xEF, 0xFF, 0x9F,
+    0xE7, 0xFE, 0x1F, 0xC7, 0xE0, 0x1F, 0xC4, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x0F, 0x9F, 0x80, 0xFF, 0x9F, 0xDF, 0xFF, 0xFF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xF1, 0xFC, 0x1F,
+    0xE1, 0xF8, 0x1F, 0xC3, 0xF0, 0x1F, 0x87, 0xE1, 0x1F, 0x8F, 0xC3, 0x1F,
+    0x8F, 0x83, 0x1F, 0x8F, 0x07, 0x1F, 0x8E, 0x0F, 0x1F, 0x80, 0x1F, 0x1F,
+    0x80, 0x3F, 0x1F, 0xC0, 0x7F, 0x7F, 0xE0, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F,
+    0xE1, 0xDF, 0x1F, 0xC3, 0x8F, 0x1F, 0x87, 0x8F, 0x1F, 0x8F, 0x9E, 0x1F,
+    0x8F, 0x0E, 0x3F, 0x8E, 0x0C, 0x3F, 0x8C, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+    0xC0, 0x40, 0xFF, 0xC0, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFE, 0x11, 0xFF, 0xFC, 0x31, 0xFF, 0xF8, 0x71, 0xDF,
+    0xF0, 0xF0, 0x1F, 0xE1, 0x80, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0xFF,
+    0x80, 0x11, 0xFF, 0x83, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F,
+    0xF0, 0xFE, 0x3F, 0x80, 0x7E, 0x3F, 0x00, 0x7E, 0x3F, 0x00, 0x7C, 0x3F,
+    0x1C, 0x38, 0x7F, 0x1C, 0x00, 0x7F, 0x1E, 0x00, 0xFF, 0x1E, 0x01, 0xFF,
+    0x1F, 0x03, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xF0, 0x1F, 0x1F, 0xF0, 0x3F, 0x1F, 0xE0, 0x3F, 0x1F, 0xC2, 0x3F, 0x1F,
+    0xC7, 0x1E, 0x1F, 0x87, 0x00, 0x3F, 0x8F, 0x00, 0x3F, 0x8F, 0x80, 0x7F,
+    0x8F, 0xC1, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFE, 0x3F, 0x03, 0xF8, 0x3F, 0x03, 0xE0, 0x3F,
+    0x0F, 0xC0, 0x7F, 0x1F, 0x81, 0xFF, 0x1E, 0x07, 0xFF, 0x1C, 0x0F, 0xFF,
+    0x18, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x3F, 0xF9, 0xE0, 0x1F,
+    0xE0, 0x40, 0x1F, 0xC0, 0x07, 0x1F, 0xC0, 0x0F, 0x9F, 0x86, 0x1F, 0x9F,
+    0x8F, 0x0F, 0x1F, 0x8F, 0x07, 0x1F, 0x8E, 0x00, 0x3F, 0x8C, 0x00, 0x3F,
+    0x80, 0x60, 0x7F, 0xC0, 0xF0, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFE, 0x7F, 0x9F,
+    0xF0, 0x1F, 0x1F, 0xE0, 0x0F, 0x1F, 0xC0, 0x0E, 0x1F, 0x83, 0x06, 0x3F,
+    0x8F, 0xC4, 0x3F, 0x8F, 0xC0, 0x7F, 0x8F, 0xC0, 0x7F, 0x8F, 0xC0, 0xFF,
+    0x80, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xF3, 0xFF, 0xE3, 0xFF, 0xC3, 0x87, 0xC3, 0x87, 0xE7, 0x0F, 0xFF,
+    0x9F, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x3F, 0xFF, 0xEC, 0x3F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xC0, 0xFF, 0x87, 0xC1, 0xFF, 0x87, 0xE7, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xE0, 0x7F, 0xE6, 0x3F,
+    0xC6, 0x3F, 0xCF, 0x1F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0xFF, 0xDF,
+    // 0x3D '='
+    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0xC7, 0x1F, 0xC7, 0x3F,
+    0xE2, 0x3F, 0xE2, 0x7F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF,
+    // 0x3F '?'
+    0xDF, 0xE7, 0x1F, 0x8F, 0x83, 0x1F, 0x0F, 0x02, 0x1F, 0x0F, 0x03, 0x1F,
+    0x0E, 0x23, 0xFF, 0x00, 0x77, 0xFF, 0x80, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xE1, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF,
+    0xE1, 0xFF, 0xF8, 0xFF, 0xE3, 0xE0, 0x78, 0xFF, 0xC7, 0x80, 0x38, 0xFF,
+    0xC7, 0x00, 0x38, 0xFF, 0xCE, 0x0E, 0x38, 0xFF, 0x8E, 0x3E, 0x38, 0xFF,
+    0x8C, 0x7C, 0x78, 0xFF, 0x8E, 0x78, 0xF8, 0xFF, 0x8E, 0x00, 0x39, 0xFF,
+    0x8E, 0x00, 0x39, 0xFF, 0x8E, 0x0F, 0x33, 0xFF, 0x8E, 0x7E, 0x37, 0xFF,
+    0x8F, 0xFE, 0x3F, 0xFF, 0xC7, 0xFC, 0x7F, 0xFF, 0xC1, 0xF0, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x9F, 0xFF, 0x03, 0x9F,
+    0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x63, 0xFF, 0xC1, 0xE3, 0xFF,
+    0x83, 0xE3, 0x9F, 0x80, 0x03, 0x9F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xCF, 0xF8, 0x1F,
+    0x8F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x00, 0x1F, 0x9F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x8F, 0x0E, 0x1F,
+    0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x40, 0x7F, 0xE1, 0xE1, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x78, 0x1F, 0xC3, 0xFE, 0x1F, 0x87, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x0F, 0xFE, 0x3F, 0x8B, 0xFC, 0x3F, 0x81, 0xFC, 0x7F, 0x83, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xCF, 0xF8, 0x1F,
+    0x8F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x1F,
+    0x00, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F, 0x1F, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F,
+    0x8F, 0xFE, 0x3F, 0x87, 0xFC, 0x3F, 0x83, 0xF0, 0x7F, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x1F, 0x1F, 0x8F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F,
+    0x8F, 0x9E, 0x1F, 0x8F, 0x98, 0x1F, 0x83, 0xF8, 0x7F, 0x83, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x0F, 0x9F, 0x8F, 0x8F, 0xFF, 0x9F, 0x8F, 0xFF, 0x8F, 0x8F, 0xFF,
+    0x8F, 0x8F, 0xFF, 0x83, 0x9F, 0xFF, 0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
+    0xE0, 0x00, 0x3F, 0xE0, 0x78, 0x1F, 0xC3, 0xFE, 0x1F, 0x87, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xCF, 0x1F, 0x1F, 0xC7, 0x1F,
+    0x1F, 0xC4, 0x1F, 0x0F, 0xC0, 0x1F, 0x81, 0xC0, 0x3F, 0x81, 0xC0, 0x3F,
+    0x83, 0xC7, 0xFF, 0xDF, 0xCF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x1F, 0x9F, 0x8F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0x9F,
+    0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x1F, 0x9F, 0x80, 0x1F, 0x9E, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x0F, 0x9F, 0x81, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x03, 0x9F,
+    0x80, 0x7F, 0x9F, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFF,
+    0x88, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x0F, 0xBF, 0x8F, 0x03, 0xFF, 0x9E, 0x01, 0xFF, 0x9C, 0x00, 0x7F,
+    0xF8, 0x70, 0x3F, 0xB0, 0xF8, 0x1F, 0x81, 0xFC, 0x1F, 0x83, 0xFE, 0x1F,
+    0x87, 0xFF, 0x1F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x7F, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xE0, 0x1F, 0x9F, 0x00, 0x1F, 0x98, 0x01, 0x9F, 0x80, 0x1F, 0x9F,
+    0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xF8, 0x1F, 0x9F, 0xE0, 0x7F, 0x9F, 0xC1, 0xFC, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x3F, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x03, 0x9F, 0x80, 0x7F, 0x9F,
+    0x80, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x1F, 0x9F, 0xC0, 0x1F,
+    0x98, 0x00, 0x1F, 0x80, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x83, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x7C, 0x1F, 0xC3, 0xFF, 0x1F, 0x87, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x0F, 0xFF, 0x1F, 0x0F, 0xFE, 0x1F,
+    0x8F, 0xFC, 0x3F, 0x87, 0xE0, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
+    0xC0, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0xFF, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xCF, 0xF8, 0x1F,
+    0x8F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x00, 0xCF, 0x9F, 0x0F, 0xCF, 0xFF, 0x1F, 0xCF, 0xFF, 0x0F, 0x8F, 0xFF,
+    0x86, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xF0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x7C, 0x0F, 0xFF,
+    0xC3, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0x07, 0xFF, 0x8F, 0xFF, 0x03, 0xFF,
+    0x8F, 0xFF, 0x03, 0xFF, 0x0F, 0xFF, 0x11, 0xFF, 0x0F, 0xFE, 0x31, 0xFF,
+    0x8F, 0xFC, 0x30, 0xFF, 0x87, 0xF0, 0x38, 0xFF, 0x80, 0x00, 0x78, 0xFF,
+    0xC0, 0x00, 0xF8, 0x7F, 0xC0, 0x01, 0xF8, 0x7F, 0xF0, 0x07, 0xF8, 0x7F,
+    0xFE, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xCF, 0xF8, 0x1F,
+    0x8F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x8F, 0xBF, 0x1F, 0x83, 0xFF, 0x1F, 0x80, 0xFF, 0x9F, 0x00, 0x7F,
+    0x86, 0x10, 0x3F, 0x80, 0x3C, 0x1F, 0x80, 0x3E, 0x1F, 0xC0, 0x7F, 0x1F,
+    0xF1, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF,
+    // 0x53 'S'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xF0, 0xF0, 0x1F,
+    0xE0, 0x7E, 0x1F, 0xC0, 0x3F, 0x1F, 0x80, 0x1F, 0x1F, 0x8C, 0x0F, 0x1F,
+    0x9E, 0x0F, 0x1F, 0x1F, 0x02, 0x1F, 0x1F, 0x80, 0x1F, 0x8F, 0x80, 0x3F,
+    0x81, 0xC0, 0x7F, 0x83, 0xF1, 0xFF, 0x87, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x81, 0xFF, 0x9F, 0x87, 0xFF, 0x9F,
+    0x8F, 0xFC, 0x1F, 0x8F, 0xC0, 0x1F, 0x88, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x01, 0x9F, 0x80, 0x3F, 0x9F, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xDF, 0xF0, 0xFF, 0x9E, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x0C, 0x1F, 0x80, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F,
+    0xBF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x1F, 0x9F, 0xF0, 0x3F,
+    0x9E, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0xFF,
+    0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0xE0, 0x1F,
+    0x9F, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF,
+    0x9C, 0x0F, 0xFF, 0x90, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x9F, 0xF8, 0x3F,
+    0x9F, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x1F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF, 0x01, 0xFF, 0x9C, 0x07, 0xFF,
+    0x90, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFE, 0x1F, 0x9F, 0xFC, 0x1F, 0x8F, 0xF8, 0x1F, 0x83, 0xF0, 0x9F,
+    0x80, 0xE1, 0x9F, 0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x98, 0x03, 0x9F,
+    0xFE, 0x00, 0x9F, 0xFC, 0x00, 0x1F, 0xF8, 0x70, 0x1F, 0x90, 0xFC, 0x1F,
+    0x81, 0xFF, 0x1F, 0x87, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF, 0x87, 0xFF, 0x9F, 0x80, 0xFF, 0x9F,
+    0x80, 0x1C, 0x1F, 0x80, 0x00, 0x1F, 0x98, 0x00, 0x1F, 0x9F, 0x00, 0x1F,
+    0xFF, 0x01, 0x9F, 0xFE, 0x0F, 0x9F, 0xF8, 0x3F, 0xFF, 0x90, 0x7F, 0xFF,
+    0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xC3, 0xF8, 0x1F,
+    0x81, 0xF0, 0x1F, 0x83, 0xE0, 0x1F, 0x8F, 0xC1, 0x9F, 0x8F, 0x83, 0x1F,
+    0x8E, 0x07, 0x1F, 0x8C, 0x0F, 0x1F, 0x98, 0x1F, 0x1F, 0x80, 0x3F, 0x1F,
+    0x80, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x83, 0xF8, 0x3F, 0x87, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1E, 0x7F,
+    0x80, 0x03, 0xFE, 0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+    0xE0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xEF,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F,
+    0x9F, 0xC0, 0x00, 0x7F, 0x1C, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x0F, 0xF8, 0x0F, 0xE0, 0x1F, 0x80, 0xFF,
+    0x07, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0x1F, 0xF8, 0x0F, 0xFE, 0x0F,
+    0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x60 '`'
+    0xDF, 0x8F, 0x87, 0xC3, 0xE3, 0xFB,
+    // 0x61 'a'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x87, 0xE3,
+    0x0F, 0xC7, 0x1F, 0x8F, 0x1E, 0x1F, 0x18, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x01, 0xE3, 0x1F, 0xC7, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x07, 0xCF, 0xE0, 0x07, 0x8E, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x01, 0xC7, 0x80, 0xC7, 0xE7, 0x87, 0x9F, 0xC7,
+    0xFF, 0x3F, 0x87, 0xFE, 0x3E, 0x0F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x3F,
+    0xFF, 0x00, 0x7F, 0xFF, 0x83, 0xFF,
+    // 0x63 'c'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x87, 0xE3,
+    0x0F, 0xE3, 0x1F, 0xE3, 0x1F, 0xC7, 0x0F, 0xC7, 0x0F, 0xCF, 0x9F, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xC7, 0xFE, 0x1F, 0x8F, 0xFE, 0x3F, 0x1F,
+    0xFE, 0x3C, 0x3F, 0xCE, 0x30, 0x07, 0x8F, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x03, 0xC7, 0x80, 0x3F, 0x8F, 0x83, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFF, 0xFF, 0xF8, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0x82, 0x63, 0x8E, 0x63,
+    0x1C, 0x63, 0x18, 0xE3, 0x00, 0xC7, 0x01, 0xC7, 0x03, 0x8F, 0xCF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0x3F, 0xF0, 0x1F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F,
+    0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0xFF, 0x86, 0x3F, 0xFF, 0xFF, 0x9E, 0x3F, 0xFF, 0xFF,
+    0x9E, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x0F,
+    0xE1, 0xE1, 0x8F, 0xC0, 0xC3, 0xCF, 0x80, 0x03, 0xCF, 0x84, 0x03, 0xCF,
+    0x1E, 0x23, 0xCF, 0x3E, 0x71, 0x8F, 0x3C, 0x70, 0x0F, 0x00, 0x70, 0x1F,
+    0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x07, 0xCF, 0xE0, 0x07, 0x8E, 0x00, 0x07,
+    0x80, 0x00, 0x1F, 0x80, 0x01, 0xFF, 0x80, 0x47, 0xFF, 0x83, 0x8F, 0xFF,
+    0xFF, 0x1F, 0x87, 0xFE, 0x38, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07,
+    0xFE, 0x01, 0xC7, 0xFF, 0x0F, 0x8F, 0xFF, 0xFF, 0x9F,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x0F, 0xFE, 0x70, 0x0F, 0xFC, 0x00, 0x0F,
+    0x8C, 0x00, 0x0F, 0x0C, 0x03, 0x8F, 0x0C, 0x3F, 0x1F, 0x0F, 0xFF, 0xBF,
+    0xBF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x7F, 0xE0, 0x7F, 0xFE, 0x7E, 0x00, 0xFF,
+    0xFC, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x8C, 0x00, 0x3F, 0xFF,
+    0x04, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x07, 0xCF, 0xE0, 0x07, 0x8E, 0x00, 0x07,
+    0x80, 0x00, 0x3F, 0x80, 0x04, 0x7F, 0x80, 0x8C, 0x3F, 0x87, 0x9C, 0x0F,
+    0xFF, 0x39, 0x07, 0xFE, 0x31, 0x87, 0xFE, 0x03, 0xC7, 0xFE, 0x03, 0xC7,
+    0xFF, 0x0F, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xCF, 0xE0, 0x07, 0x8E, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x03, 0xC7, 0x80, 0x3F, 0x8F, 0x87, 0xFF, 0xDF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xE3, 0x9E, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F,
+    0x81, 0xFF, 0xC7, 0xFF, 0x8F, 0xE3, 0x9E, 0x03, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x3F, 0x81, 0xFF, 0xC7, 0xFF, 0x8F, 0xE7, 0x9E, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x63, 0x83, 0xE7, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xE3, 0x9E, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F,
+    0x01, 0xFF, 0xC7, 0xFF, 0xCF, 0xFF, 0x9F, 0x03, 0x10, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x81, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0x6F 'o'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x87, 0xE3,
+    0x1F, 0xF3, 0x1F, 0xE3, 0x1F, 0xC3, 0x0E, 0x07, 0x00, 0x0F, 0x80, 0x1F,
+    0xC0, 0x7F, 0xFF, 0xFF,
+    // 0x70 'p'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x0F, 0x9F, 0xE0, 0x0F,
+    0x1E, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xCF, 0x00, 0x63, 0xCF,
+    0x81, 0xF3, 0xFF, 0xC7, 0xE3, 0xFF, 0x8F, 0xE3, 0xFF, 0x1F, 0x83, 0xFF,
+    0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+    0x80, 0x43, 0xEF, 0x87, 0xE3, 0xCF, 0x0F, 0xC7, 0xCF, 0x1F, 0x8F, 0x0F,
+    0x1E, 0x10, 0x0F, 0x18, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x0F, 0xCF,
+    0x01, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xFF, 0xFF, 0x9F, 0xF3, 0x9F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F,
+    0x00, 0xFF, 0xE3, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF,
+    0x9F, 0xFF,
+    // 0x73 's'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x83, 0xE3, 0xC3, 0xC1, 0xE3, 0x80, 0xE3,
+    0x10, 0x73, 0x18, 0x03, 0x1C, 0x07, 0x1E, 0x07, 0x0F, 0x0F, 0x9F, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0x80, 0x7F, 0xF0, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x7F, 0x03, 0xFC, 0x7F,
+    0xE3, 0xF8, 0xFF, 0xE3, 0xF9, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xFF, 0xFF, 0x9F, 0x87, 0x1C, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xE3,
+    0x8F, 0xE7, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x07, 0xC0, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x07, 0xE7, 0x7F, 0xC7, 0xFF, 0xFF,
+    // 0x76 'v'
+    0xDF, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0x80, 0x03,
+    0xE0, 0x03, 0xFF, 0x87, 0xFF, 0x0F, 0x18, 0x1F, 0x00, 0x7F, 0x00, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF,
+    // 0x77 'w'
+    0xDF, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0x80, 0x03,
+    0xF0, 0x03, 0xFF, 0x87, 0xFE, 0x0F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x03,
+    0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x87, 0x3C, 0x1F, 0x00, 0x3F, 0x00, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xDF, 0xE3, 0x9F, 0xE3, 0x1F, 0xC3, 0x07, 0x87,
+    0x01, 0x0F, 0x80, 0x3F, 0xE0, 0x0F, 0xF0, 0x03, 0xC3, 0x03, 0x87, 0xC3,
+    0x0F, 0xE3, 0x1F, 0xE3, 0x1F, 0xE7, 0x1F, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F,
+    0xDF, 0xFF, 0x8F, 0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0x1F, 0x01, 0xFE, 0x3F,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x07, 0xFF, 0x18, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xC7, 0xC3, 0x83, 0x83, 0x07, 0x07, 0x1E, 0x07,
+    0x1C, 0x23, 0x88, 0x63, 0x80, 0xE3, 0x83, 0xE3, 0x87, 0x83, 0x0F, 0x83,
+    0x1F, 0xEF, 0xBF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFE, 0x00, 0x0C, 0x7F, 0xE0, 0x00, 0x7E, 0x7F, 0xC0, 0x1F, 0xFE, 0x7F,
+    0x80, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFE, 0x01, 0xFF, 0xC0, 0x01,
+    0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
+    0x1F, 0xFC, 0x00, 0xFF, 0x1F, 0x00, 0x01, 0xFF, 0x08, 0x00, 0x7F, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0x80, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xFF, 0xC7, 0xC3, 0x87, 0x8F, 0x8F, 0x87, 0xC7, 0xE3, 0xE3, 0xC3, 0x87,
+    0x8F, 0xFF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x0F,
+    0xDF, 0x00, 0x1F, 0x8C, 0x00, 0x3F, 0x0C, 0x03, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+    0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x1E, 0x10, 0x7F, 0xFC, 0x7F, 0x00, 0x7F,
+    0xF8, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x07, 0x1F, 0xFF,
+    0x00, 0x7F, 0x1F, 0xFF, 0x00, 0xFE, 0x3F, 0xFF, 0x78, 0xFE, 0x7F, 0xFF,
+    0xFC, 0x7E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0x8F, 0x1F,
+    0xFF, 0x88, 0x1F, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0x1F,
+    0xE0, 0x0F, 0x1F, 0xC0, 0x8F, 0x1F, 0x87, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F,
+    0x8F, 0x8F, 0x1F, 0x8F, 0xBF, 0x1F, 0x83, 0xFF, 0x1F, 0x83, 0xFF, 0x7F,
+    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xDF, 0xFF, 0x8F, 0x9F, 0x9F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x1F,
+    0xCF, 0x9F, 0x8F, 0x9F, 0x8F, 0x9F, 0x8F, 0x1F, 0x80, 0x1F, 0xC0, 0x1F,
+    0xC0, 0x8F, 0x8F, 0xCF, 0x1F, 0xFF, 0xBF, 0xFF,
+    // 0xA5 '¥'
+    0xBF, 0xFF, 0xFF, 0x1E, 0x67, 0x3F, 0x06, 0x67, 0x3F, 0x00, 0x67, 0x3F,
+    0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F, 0x38, 0x00, 0x3F, 0x3F, 0x00, 0x3F,
+    0xFE, 0x07, 0x3F, 0xF8, 0x27, 0x3F, 0x30, 0x27, 0xFF, 0x00, 0x27, 0xFF,
+    0x02, 0x2F, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0x3E, 0x0F, 0xE0, 0x0F, 0x0F,
+    0xC3, 0x87, 0xCF, 0x81, 0xC7, 0xCF, 0x80, 0xE3, 0xCF, 0x1C, 0x71, 0x8F,
+    0x3E, 0x30, 0x1F, 0x1E, 0x1C, 0x1F, 0x07, 0x00, 0x3F, 0x07, 0x80, 0x7F,
+    0x8F, 0xE3, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0x07, 0x3F, 0x9C, 0x03, 0x9F, 0x98, 0x01, 0x9F,
+    0xB8, 0xF1, 0xDF, 0xB9, 0xF9, 0xDF, 0xB9, 0xF9, 0xCF, 0xB8, 0xF9, 0xDF,
+    0x98, 0xF9, 0xDF, 0x9D, 0xFB, 0x9F, 0xDF, 0xFF, 0x9F, 0xCF, 0xFF, 0x3F,
+    0xE7, 0xFE, 0x7F, 0xF0, 0xF0, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x0F, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xF7, 0xF0, 0x67, 0xC0, 0x27, 0x86, 0x27, 0x9E, 0x67, 0x1C, 0xE7,
+    0x90, 0x67, 0x80, 0x27, 0x86, 0x6F, 0xBE, 0x7F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x8E, 0x3F,
+    0x1F, 0xBF, 0x9F, 0xFF, 0xF1, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x84, 0x3F,
+    0x8F, 0x3F, 0x1F, 0xFF, 0xBF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE3, 0x8F, 0xCF, 0xE7, 0xD7, 0xD3, 0x90, 0x1B,
+    0xB0, 0x1B, 0xB6, 0x59, 0xB0, 0x3B, 0x91, 0x9B, 0x9F, 0xD3, 0xCF, 0xF7,
+    0xE3, 0xC7, 0xF0, 0x1F, 0xFF, 0xFF,
+    // 0xB0 '°'
+    0xF0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0x8E, 0x3F, 0x8E, 0x3F, 0x8E, 0x3F,
+    0x8E, 0x3F, 0x80, 0x7F, 0xC0, 0x7F, 0xF1, 0xFF,
+    // 0xB1 '±'
+    0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF,
+    0xF8, 0xFC, 0xFF, 0x80, 0x0C, 0xFF, 0x80, 0x0C, 0xFF, 0x80, 0x0C, 0xFF,
+    0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xEF, 0x8F, 0xC7, 0x0F, 0x8F, 0x0F, 0x9E, 0x4F,
+    0x9C, 0x4F, 0x90, 0xCF, 0x81, 0xCF, 0x83, 0xCF, 0xEF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xCF, 0xE7, 0x8C, 0xC7, 0x98, 0xCF, 0x98, 0x8F,
+    0x90, 0x0F, 0x80, 0x1F, 0x87, 0x7F, 0xFF, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x1F,
+    0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x03, 0xE3, 0xFF, 0x3F, 0xE3, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x03, 0xFF,
+    0x00, 0x03, 0xFF, 0x00, 0xE3, 0xFF, 0x1F, 0xE3, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xEF, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFC, 0x1F, 0xF9,
+    0xF0, 0x0F, 0xF1, 0xE0, 0x07, 0xE3, 0xC0, 0x07, 0x07, 0xC0, 0x00, 0x07,
+    0x80, 0x00, 0x67, 0x80, 0x07, 0xC7, 0x80, 0xFC, 0x0F, 0x8F, 0x80, 0x3F,
+    0x80, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xFF, 0x8F, 0x87, 0x87, 0x8F, 0xFF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xCF, 0x8E, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x81, 0xCF, 0xBF, 0xEF,
+    // 0xBA 'º'
+    0xFF, 0xF7, 0xF8, 0xE7, 0xE0, 0x67, 0xC0, 0x27, 0x8F, 0x27, 0x9E, 0x27,
+    0x3C, 0x67, 0x80, 0x67, 0x80, 0xEF, 0xC3, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xBE, 0x3F, 0x1C, 0x3F, 0x80, 0x7F, 0x80, 0xFF,
+    0xC1, 0xFF, 0xE1, 0xFF, 0xFF, 0x3F, 0xBE, 0x3F, 0x0C, 0x3F, 0x80, 0x7F,
+    0xC0, 0xFF, 0xE1, 0xFF, 0xF3, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0x83, 0xFF,
+    0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xF3, 0xE7, 0xCF, 0xF7, 0xC7,
+    0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xFC, 0x3E, 0x3F, 0xF0, 0x7C, 0x3F, 0xE1, 0xF8, 0x3F, 0x83, 0xF0, 0x3F,
+    0x87, 0xE3, 0x3F, 0xDF, 0xC7, 0x0F, 0xFF, 0x88, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x00, 0x3F, 0xFF, 0x9F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0x83, 0xFF,
+    0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0xF3, 0xC7, 0xCF, 0xF7, 0x87,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF0, 0xFF, 0xCF, 0xE1, 0xFF, 0x8F, 0x83, 0xCF, 0x0F, 0x8F, 0x8F, 0x0F,
+    0xDF, 0x9E, 0x4F, 0xFF, 0x1C, 0x4F, 0xFF, 0x18, 0xCF, 0xFF, 0x01, 0xCF,
+    0xFF, 0x83, 0xCF, 0xFF, 0xC7, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xE3, 0xF3, 0xFF, 0xE6, 0x73, 0xFF,
+    0xCE, 0x63, 0xFF, 0xCC, 0x67, 0xFF, 0xC0, 0x07, 0xE7, 0xC0, 0x0F, 0xC7,
+    0xE3, 0xBF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xF8, 0x3E, 0x3F, 0xF0, 0xFC, 0x3F, 0xC1, 0xF8, 0x3F, 0x83, 0xF0, 0x3F,
+    0x8F, 0xE3, 0x3F, 0xDF, 0xC7, 0x0F, 0xFF, 0x88, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x00, 0x3F, 0xFF, 0x9F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x1F, 0xFC, 0xC3, 0x1F,
+    0xDC, 0x87, 0x0F, 0x8C, 0x0F, 0x1F, 0x0C, 0x1E, 0x1F, 0x0C, 0x3E, 0x3F,
+    0xBF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x81, 0x3F, 0xFF, 0xFE, 0x07, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0x8F, 0xC0, 0xC7, 0xFF, 0x87, 0x83, 0xC7, 0xFF,
+    0xC7, 0x07, 0xC7, 0x3F, 0xE3, 0x00, 0x07, 0x3F, 0xF2, 0x00, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x81, 0x3F, 0xFF, 0xFE, 0x07, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0xC7, 0xFF, 0xF3, 0x83, 0xC7, 0xFF,
+    0xE3, 0x07, 0xC7, 0x3F, 0xE3, 0x00, 0x07, 0x3F, 0xC6, 0x00, 0x00, 0x3F,
+    0x87, 0x80, 0x00, 0x3F, 0x8F, 0xFC, 0x00, 0x3F, 0xDF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x81, 0x3F, 0xFF, 0xFE, 0x07, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+    0xF3, 0xF0, 0x07, 0xFF, 0xF3, 0xC0, 0xC7, 0xFF, 0xE3, 0x83, 0xC7, 0xFF,
+    0xC7, 0x07, 0xC7, 0x3F, 0x8F, 0x00, 0x07, 0x3F, 0x8E, 0x00, 0x00, 0x3F,
+    0x87, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xF3, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xFF, 0x02, 0x7F, 0xFF, 0xFC, 0x0E, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xCF, 0xE0, 0x0F, 0xFF, 0x8F, 0x81, 0x8F, 0xFF, 0x1F, 0x07, 0x8F, 0xFF,
+    0x1E, 0x0F, 0x8E, 0x7F, 0x8E, 0x00, 0x0E, 0x7F, 0xC4, 0x00, 0x00, 0x7F,
+    0xC7, 0x00, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x7F, 0x9F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x04, 0xFF, 0xF8, 0x1C,
+    0xFF, 0xF0, 0x1F, 0x9F, 0xC0, 0x1F, 0x0F, 0x03, 0x1F, 0x0E, 0x0F, 0x1F,
+    0x1C, 0x1F, 0x1C, 0xFC, 0x00, 0x1C, 0x98, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x81, 0x3F, 0xFF, 0xFE, 0x07, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0xC7, 0xC0, 0xC7, 0xFF, 0x83, 0x83, 0xC7, 0xFF,
+    0x91, 0x07, 0xC7, 0x3F, 0x39, 0x00, 0x07, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x83, 0x80, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x9F, 0xFF, 0xC1, 0xFF,
+    0xFF, 0x83, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x13, 0x9F, 0xBC, 0x73, 0x9F,
+    0x90, 0xF3, 0x1F, 0x81, 0xE0, 0x1F, 0x87, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x01, 0x1F, 0x80, 0x1F, 0x1F, 0x87, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F,
+    0x9F, 0x9F, 0x1F, 0x8F, 0x9E, 0x1F, 0x8F, 0x98, 0x1F, 0x83, 0xF8, 0x3F,
+    0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x78, 0x1F, 0xBF,
+    0xC3, 0xFE, 0x1B, 0x3F, 0x87, 0xFF, 0x10, 0x3F, 0x8F, 0xFF, 0x10, 0x7F,
+    0x8F, 0xFF, 0x18, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF,
+    0x0F, 0xFE, 0x3F, 0xFF, 0x8B, 0xFC, 0x3F, 0xFF, 0x81, 0xFC, 0x7F, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0x3F, 0x8F, 0x00, 0x3E, 0x3F,
+    0x87, 0x1F, 0x3E, 0x3F, 0xC7, 0x3F, 0x3E, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xE3, 0x1F, 0x3C, 0x3F, 0xF3, 0x1F, 0x30, 0x3F, 0xFF, 0x07, 0xF0, 0xFF,
+    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0x3F, 0xFF, 0x00, 0x3E, 0x3F,
+    0xF3, 0x1F, 0x3E, 0x3F, 0xF3, 0x3F, 0x3E, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xC7, 0x1F, 0x3C, 0x3F, 0xC7, 0x1F, 0x30, 0x3F, 0x87, 0x07, 0xF0, 0xFF,
+    0x8F, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x0F, 0x3F, 0xF3, 0x00, 0x3E, 0x3F,
+    0xE3, 0x1F, 0x3E, 0x3F, 0xC7, 0x3F, 0x3E, 0x3F, 0x8F, 0x1F, 0x3E, 0x3F,
+    0x8F, 0x1F, 0x3C, 0x3F, 0x87, 0x1F, 0x30, 0x3F, 0xC3, 0x07, 0xF0, 0xFF,
+    0xE3, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0,
+    0xFC, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xDC, 0x00, 0x3C,
+    0x0C, 0x00, 0xF8, 0x0C, 0x7C, 0xF8, 0x1C, 0xFC, 0xF8, 0xFC, 0x7C, 0xF8,
+    0xDC, 0x7C, 0xF0, 0x0C, 0x7C, 0xC0, 0x0C, 0x1F, 0xC3, 0x1C, 0x1F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xDF, 0x3E, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F,
+    0x87, 0x00, 0x00, 0x3F, 0xC7, 0x00, 0x07, 0x3F, 0xE3, 0x00, 0xFF, 0x3F,
+    0xF3, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x07, 0x3F, 0xE3, 0x00, 0xFF, 0x3F,
+    0xC7, 0x1F, 0xFF, 0xFF, 0x87, 0x3F, 0xFF, 0xFF, 0x8F, 0x3F, 0xFF, 0xFF,
+    0xDF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xF3, 0x3E, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x3F,
+    0xE3, 0x00, 0x00, 0x3F, 0xC7, 0x00, 0x07, 0x3F, 0x8F, 0x00, 0xFF, 0x3F,
+    0x8F, 0x1F, 0xFF, 0xFF, 0x87, 0x3F, 0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0,
+    0x9C, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x1C,
+    0xFC, 0x03, 0xFC, 0x9C, 0x7F, 0xFF, 0x0C, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xDF, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xCF, 0x98, 0x1F,
+    0x8F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x1F,
+    0x00, 0x9F, 0x1F, 0x0F, 0x9F, 0x1F, 0x1F, 0x9F, 0x1F, 0x0F, 0x9F, 0x1F,
+    0x8F, 0xFE, 0x3F, 0x87, 0xFC, 0x3F, 0x83, 0xF0, 0x7F, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFE, 0x7C, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x0E, 0x7F, 0xFE, 0x01, 0xFE, 0x7F, 0xFE, 0x03, 0xFF, 0xFF,
+    0xCE, 0x00, 0x7F, 0xFF, 0x8F, 0x80, 0x1F, 0xFF, 0x1F, 0xE0, 0x07, 0xFF,
+    0x1F, 0xFC, 0x01, 0xFF, 0x8F, 0xFF, 0x00, 0x7F, 0xC7, 0xFF, 0xC0, 0x7F,
+    0xCE, 0x7F, 0x00, 0x7F, 0x8E, 0x60, 0x00, 0x7F, 0x9E, 0x00, 0x07, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xF8, 0x3F,
+    0xFF, 0x87, 0xFE, 0x3F, 0xFF, 0x0F, 0xFE, 0x3F, 0x8F, 0x1F, 0xFE, 0x3F,
+    0x87, 0x1F, 0xFE, 0x3F, 0xC6, 0x1F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFC, 0x3F,
+    0xE3, 0x1F, 0xF8, 0x7F, 0xF3, 0x0F, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xF8, 0x3F,
+    0xFF, 0x87, 0xFE, 0x3F, 0xFF, 0x0F, 0xFE, 0x3F, 0xFF, 0x1F, 0xFE, 0x3F,
+    0xF3, 0x1F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFC, 0x3F,
+    0xC7, 0x1F, 0xF8, 0x7F, 0xC7, 0x0F, 0xC0, 0x7F, 0x87, 0x00, 0x00, 0xFF,
+    0xCF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xF8, 0x3F,
+    0xFF, 0x87, 0xFE, 0x3F, 0xFB, 0x0F, 0xFE, 0x3F, 0xF3, 0x1F, 0xFE, 0x3F,
+    0xE3, 0x1F, 0xFE, 0x3F, 0xC6, 0x1F, 0xFE, 0x3F, 0x8E, 0x1F, 0xFC, 0x3F,
+    0x8F, 0x1F, 0xF8, 0x7F, 0x87, 0x0F, 0xC0, 0x7F, 0xC3, 0x00, 0x00, 0xFF,
+    0xE3, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x01, 0xF0, 0x7F,
+    0xFF, 0x0F, 0xFC, 0x7F, 0xCE, 0x1F, 0xFC, 0x7F, 0x8E, 0x3F, 0xFC, 0x7F,
+    0x9E, 0x3F, 0xFC, 0x7F, 0x1C, 0x3F, 0xFC, 0x7F, 0x8C, 0x3F, 0xF8, 0x7F,
+    0xC6, 0x3F, 0xF0, 0xFF, 0xC6, 0x1F, 0x80, 0xFF, 0x8E, 0x00, 0x01, 0xFF,
+    0x9F, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+    0xFF, 0xFB, 0xFF, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0xE0, 0xFF,
+    0xFE, 0x1F, 0xF8, 0xFF, 0x9C, 0x3F, 0xF8, 0xFF, 0x0C, 0x7F, 0xF8, 0xFF,
+    0x0C, 0x7F, 0xF8, 0xFF, 0x18, 0x7F, 0xF8, 0xFF, 0xF8, 0x7F, 0xF0, 0xFF,
+    0x9C, 0x7F, 0xE1, 0xFF, 0x0C, 0x3F, 0x01, 0xFF, 0x0C, 0x00, 0x03, 0xFF,
+    0x1E, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0xCF, 0x9F, 0x87, 0x1F, 0x82, 0x1F, 0xC0, 0x3F, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC2, 0x1F, 0x87, 0x1F, 0xCF, 0x9F, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x8F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
+    0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xC0, 0xF0, 0x1F, 0xC3, 0xF3, 0x1F,
+    0x87, 0xE7, 0x1F, 0x8F, 0xCF, 0x1F, 0x8F, 0x9F, 0x1F, 0x0F, 0x3F, 0x1F,
+    0x0E, 0x7E, 0x1F, 0x8C, 0x7C, 0x3F, 0x80, 0xF0, 0x3F, 0x80, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xBF, 0xE1, 0xFF, 0xFF, 0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x01, 0xFE, 0x3F,
+    0xFF, 0x1F, 0xFE, 0x3F, 0x8F, 0x3F, 0xFE, 0x3F, 0x87, 0x7F, 0xFE, 0x3F,
+    0xC7, 0xFF, 0xFC, 0x3F, 0xE3, 0xFF, 0xF8, 0x3F, 0xE3, 0x3F, 0xE0, 0x7F,
+    0xF3, 0x3C, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xBF, 0xE1, 0xFF, 0xFF, 0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x01, 0xFE, 0x3F,
+    0xFF, 0x1F, 0xFE, 0x3F, 0xFF, 0x3F, 0xFE, 0x3F, 0xF3, 0x7F, 0xFE, 0x3F,
+    0xF3, 0xFF, 0xFC, 0x3F, 0xE3, 0xFF, 0xF8, 0x3F, 0xC7, 0x3F, 0xE0, 0x7F,
+    0xC7, 0x3C, 0x00, 0xFF, 0x87, 0x00, 0x01, 0xFF, 0xCF, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xBF, 0xE1, 0xFF, 0xFF, 0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x01, 0xFE, 0x3F,
+    0xFB, 0x1F, 0xFE, 0x3F, 0xF3, 0x3F, 0xFE, 0x3F, 0xE3, 0x7F, 0xFE, 0x3F,
+    0xC7, 0xFF, 0xFC, 0x3F, 0x8F, 0xFF, 0xF8, 0x3F, 0x8F, 0x3F, 0xE0, 0x7F,
+    0x87, 0x3C, 0x00, 0xFF, 0xC3, 0x00, 0x01, 0xFF, 0xE3, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFE, 0xFF, 0x87, 0xFF, 0xFC, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x60, 0xFF, 0xFC, 0x07, 0xF8, 0xFF,
+    0x9C, 0x7F, 0xF8, 0xFF, 0x0C, 0xFF, 0xF8, 0xFF, 0x0D, 0xFF, 0xF8, 0xFF,
+    0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xDC, 0xFF, 0x81, 0xFF,
+    0x0C, 0xF0, 0x03, 0xFF, 0x0C, 0x00, 0x07, 0xFF, 0x1C, 0x00, 0x1F, 0xFF,
+    0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x9F,
+    0x80, 0x79, 0x9F, 0x81, 0xF9, 0xFF, 0x91, 0xF1, 0xFF, 0x91, 0xE1, 0xFF,
+    0xF8, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xCF, 0xFF,
+    0xC0, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x8F, 0xC7, 0xC7, 0xFF,
+    0x9F, 0x83, 0xC7, 0xFF, 0x9E, 0x01, 0xC7, 0xFF, 0x80, 0x20, 0x07, 0xFF,
+    0x80, 0x70, 0x0F, 0xFF, 0x81, 0xFC, 0x1F, 0xFF, 0xC3, 0xFE, 0x3F, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x87, 0xE3, 0x8F, 0x0F, 0xC7, 0x07, 0x1F, 0x8F,
+    0x87, 0x1E, 0x1F, 0xE3, 0x18, 0x03, 0xF3, 0x80, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x01, 0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xF1, 0xFF, 0x87, 0xE3, 0xFF, 0x8F, 0xC7,
+    0xFF, 0x8F, 0x0F, 0xF1, 0x8C, 0x01, 0xE1, 0xC0, 0x01, 0x83, 0x80, 0x01,
+    0x87, 0x80, 0xF1, 0xCF, 0x8F, 0xE3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFB, 0x87, 0xE3, 0xF3, 0x0F, 0xC7, 0xE3, 0x1F, 0x8F,
+    0x87, 0x1E, 0x1F, 0x8F, 0x18, 0x03, 0x8F, 0x80, 0x03, 0x83, 0x00, 0x03,
+    0xE3, 0x01, 0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x07, 0xCF, 0x0F, 0xC7, 0x86, 0x1F, 0x8F, 0x9E, 0x3F, 0x1F,
+    0x9E, 0x3C, 0x3F, 0x8E, 0x30, 0x07, 0xC7, 0x00, 0x07, 0xC6, 0x00, 0x07,
+    0x8E, 0x03, 0xC7, 0x9E, 0x3F, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F,
+    0xFE, 0x00, 0x0F, 0x9E, 0x1F, 0x8F, 0x0C, 0x3F, 0x1F, 0x0C, 0x7E, 0x3F,
+    0x1C, 0x78, 0x7F, 0xFC, 0x60, 0x0F, 0x9E, 0x00, 0x0F, 0x0C, 0x00, 0x0F,
+    0x0C, 0x07, 0x8F, 0x1C, 0x7F, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x87, 0xE3, 0xE7, 0x0F, 0xC7, 0x83, 0x1F, 0x8F,
+    0x91, 0x1E, 0x1F, 0x39, 0x18, 0x03, 0x39, 0x80, 0x03, 0x83, 0x00, 0x03,
+    0x87, 0x01, 0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x87, 0xE3,
+    0x0F, 0xC7, 0x1F, 0x8F, 0x1E, 0x1F, 0x18, 0x07, 0x00, 0x03, 0x80, 0x03,
+    0x82, 0x63, 0x8E, 0x63, 0x1C, 0x63, 0x18, 0xE3, 0x00, 0xC7, 0x01, 0xC7,
+    0x03, 0x8F, 0x8F, 0xFF,
+    // 0xE7 'ç'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xF7, 0xC0, 0x03, 0x67,
+    0xC0, 0x02, 0x0F, 0x87, 0xE2, 0x0F, 0x0F, 0xE3, 0x1F, 0x1F, 0xE3, 0xFF,
+    0x1F, 0xC7, 0xFF, 0x0F, 0xC7, 0xFF, 0x0F, 0xCF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x82, 0x63, 0x8F, 0x8E, 0x63, 0x07, 0x1C, 0x63, 0x87, 0x18, 0xE3,
+    0xE3, 0x00, 0xC7, 0xF3, 0x01, 0xC7, 0xFF, 0x03, 0x8F, 0xFF, 0xCF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC1, 0x31, 0xFF, 0xC7, 0x31, 0xFF, 0x8E, 0x31, 0xFF, 0x8C, 0x71,
+    0xF1, 0x80, 0x63, 0xE1, 0x80, 0xE3, 0x83, 0x81, 0xC7, 0x87, 0xE7, 0xFF,
+    0xCF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFB, 0x82, 0x63, 0xF3, 0x8E, 0x63, 0xE3, 0x1C, 0x63, 0x87, 0x18, 0xE3,
+    0x8F, 0x00, 0xC7, 0x8F, 0x01, 0xC7, 0x83, 0x03, 0x8F, 0xE3, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F,
+    0x9E, 0x09, 0x8F, 0x0E, 0x39, 0x8F, 0x0C, 0x71, 0x8F, 0x1C, 0x63, 0x8F,
+    0xFC, 0x03, 0x1F, 0x9C, 0x07, 0x1F, 0x0C, 0x0E, 0x3F, 0x0F, 0x3F, 0xFF,
+    0x1F, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0x9C, 0x03, 0x8F, 0x00, 0x03,
+    0x07, 0x00, 0x03, 0xC3, 0x00, 0xE3, 0xE3, 0x0F, 0xC7, 0xF3, 0xFF, 0xEF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xC1, 0xFF, 0xCE, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xF1, 0x87, 0xE3, 0xE1, 0xFF, 0xF7,
+    0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFB, 0x9C, 0x03, 0xF3, 0x00, 0x03,
+    0xC3, 0x00, 0x03, 0x87, 0x00, 0xE3, 0x8F, 0x0F, 0xC7, 0x87, 0xFF, 0xEF,
+    0x83, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x0F, 0x9E, 0x70, 0x0F, 0x0C, 0x00, 0x0F,
+    0x0C, 0x00, 0x0F, 0x9C, 0x03, 0x8F, 0xFC, 0x3F, 0x1F, 0x9F, 0xFF, 0xBF,
+    0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x07,
+    0xFF, 0x81, 0x07, 0xFF, 0x0F, 0xC7, 0x93, 0x1F, 0xC7, 0x02, 0x3F, 0xC7,
+    0x06, 0x3F, 0x87, 0x81, 0x1E, 0x0F, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x3F,
+    0x3C, 0x00, 0xFF, 0xFF, 0x87, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC7, 0xFF, 0x3C, 0x07, 0xFE, 0x00, 0x07,
+    0xFE, 0x00, 0x07, 0xCE, 0x00, 0x7F, 0x86, 0x03, 0xFF, 0x9F, 0x8F, 0xFF,
+    0x9F, 0x9F, 0xFF, 0x8F, 0x3E, 0x07, 0xC6, 0x20, 0x07, 0xC6, 0x00, 0x07,
+    0x8E, 0x00, 0x07, 0x9F, 0x03, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x87, 0xE3, 0x8F, 0x1F, 0xF3, 0x07, 0x1F, 0xE3,
+    0x87, 0x1F, 0xC3, 0xE3, 0x0E, 0x07, 0xF3, 0x00, 0x0F, 0xFF, 0x80, 0x1F,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xF1, 0xFF, 0x8F, 0xF9, 0xFF, 0x8F, 0xF1,
+    0xFF, 0x8F, 0xE1, 0xF1, 0x87, 0x03, 0xE1, 0x80, 0x07, 0x83, 0xC0, 0x0F,
+    0x87, 0xE0, 0x3F, 0xCF, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFB, 0x87, 0xE3, 0xF3, 0x1F, 0xF3, 0xE3, 0x1F, 0xE3,
+    0x87, 0x1F, 0xC3, 0x8F, 0x0E, 0x07, 0x8F, 0x00, 0x0F, 0x83, 0x80, 0x1F,
+    0xE3, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x07, 0xEF, 0x0F, 0xC7, 0x86, 0x3F, 0xE7, 0x8E, 0x3F, 0xC7,
+    0x9E, 0x3F, 0x87, 0x8E, 0x1C, 0x0F, 0xC6, 0x00, 0x1F, 0xC7, 0x00, 0x3F,
+    0x8F, 0x80, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x0F,
+    0xFE, 0x00, 0x0F, 0xDE, 0x1F, 0x8F, 0x0C, 0x7F, 0xCF, 0x0C, 0x7F, 0x8F,
+    0x1C, 0x7F, 0x0F, 0xFC, 0x38, 0x1F, 0x9C, 0x00, 0x3F, 0x0E, 0x00, 0x7F,
+    0x0F, 0x01, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x8F, 0x09, 0x8F,
+    0x09, 0x8F, 0x99, 0x8F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9, 0xFC, 0x03, 0xF0, 0x03, 0xE0, 0x01,
+    0xC0, 0x81, 0xC3, 0x99, 0x8F, 0x39, 0x8E, 0x71, 0x8C, 0xE1, 0x81, 0x83,
+    0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x3F, 0x8F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0x1C, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0xE3, 0x8F, 0x8F, 0xE7, 0x07, 0xFF, 0xC7,
+    0xC3, 0xFF, 0x1F, 0xE3, 0xFC, 0x07, 0xF3, 0xC0, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x07, 0xE7, 0xFF, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xC3, 0xFF, 0x8E, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xFF, 0xC7, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0x8F, 0xF1, 0xFE, 0x03, 0xE1, 0xE0, 0x01, 0x83, 0x80, 0x01,
+    0x87, 0x80, 0x01, 0xDF, 0x83, 0xF3, 0xFF, 0xBF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0x1C, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFB, 0x00, 0xE3, 0xF3, 0x8F, 0xE7, 0xC3, 0xFF, 0xC7,
+    0x87, 0xFF, 0x1F, 0x8F, 0xFC, 0x07, 0x87, 0xC0, 0x03, 0x83, 0x00, 0x03,
+    0xE3, 0x00, 0x03, 0xFF, 0x07, 0xE7, 0xFF, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x1F, 0xFC, 0x70, 0x0F, 0xFC, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0x9C, 0x03, 0x8F, 0x0E, 0x3F, 0x9F, 0x0F, 0xFF, 0x1F,
+    0x9F, 0xFC, 0x7F, 0xFF, 0xF0, 0x1F, 0x9F, 0x00, 0x0F, 0x0C, 0x00, 0x0F,
+    0x0C, 0x00, 0x0F, 0x9C, 0x1F, 0x9F, 0xFD, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x1F,
+    0x8C, 0x00, 0x01, 0x1F, 0x80, 0x00, 0x07, 0x9F, 0x80, 0x01, 0xC7, 0x9F,
+    0x80, 0xC7, 0xE7, 0xFF, 0x87, 0x9F, 0xC7, 0xFF, 0xFF, 0x3F, 0x87, 0xFF,
+    0xFE, 0x3E, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x7F, 0xFE, 0x3F, 0xFE, 0x7F, 0xFE, 0x3F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0xDC, 0x07, 0xF8, 0xFF, 0x8C, 0x00, 0x01, 0xFF,
+    0x0E, 0x00, 0x03, 0xFF, 0x1F, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xDF, 0xFC, 0x1F, 0xFF, 0x8C, 0x60, 0x3F, 0xFF, 0x0C, 0x00, 0xFF, 0xFF,
+    0x1C, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0x03, 0x9F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+    0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x63, 0xFF, 0xFF, 0xC1, 0xE3, 0xFF, 0xFF,
+    0x83, 0xE3, 0x9F, 0xFF, 0x80, 0x03, 0x90, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0C, 0x7F, 0xFF, 0xF0, 0x1C, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+    0x80, 0x03, 0xFF, 0x87, 0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x1E, 0x1F, 0xFF, 0x18, 0x03, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x8F,
+    0x01, 0xE3, 0xDF, 0x1F, 0xC7, 0xDF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xF0, 0x3F,
+    0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0x0F, 0xFE, 0x3F, 0xFF, 0x1F, 0xFE, 0x3F,
+    0xF3, 0x1F, 0xFE, 0x3F, 0xF3, 0x1F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFE, 0x3F,
+    0xC6, 0x1F, 0xFC, 0x7F, 0xC7, 0x17, 0xF8, 0x7F, 0x87, 0x03, 0xF8, 0xFF,
+    0x8F, 0x07, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0xF1, 0xFF, 0x87, 0xF1, 0xFF, 0x8F, 0xF1,
+    0xF1, 0x8F, 0xE3, 0xE1, 0x87, 0xE3, 0x83, 0x87, 0xE7, 0x87, 0xCF, 0xFF,
+    0xCF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xF0, 0x3F,
+    0xFF, 0x87, 0xFC, 0x3F, 0xDF, 0x0F, 0xFE, 0x3F, 0x8F, 0x1F, 0xFE, 0x3F,
+    0x87, 0x1F, 0xFE, 0x3F, 0xE3, 0x1F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFE, 0x3F,
+    0xE2, 0x1F, 0xFC, 0x7F, 0xC7, 0x17, 0xF8, 0x7F, 0x8F, 0x03, 0xF8, 0xFF,
+    0x9F, 0x07, 0xFF, 0xFF, 0xBF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0xC0, 0x03, 0x0F, 0x87, 0xE3, 0x03, 0x0F, 0xE3, 0xC3, 0x1F, 0xE3,
+    0xE3, 0x1F, 0xC7, 0xC7, 0x0F, 0xC7, 0x8F, 0x0F, 0xCF, 0x1F, 0x9F, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x9F, 0xF0, 0x3F, 0xFF, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0E, 0x3F, 0x9E, 0x01, 0xFE, 0x3F,
+    0x86, 0x1F, 0xFE, 0x3F, 0xC2, 0x3F, 0xFE, 0x3F, 0xE2, 0x1F, 0xFE, 0x3F,
+    0xE3, 0x1F, 0xFC, 0x7F, 0xE3, 0x0F, 0xF8, 0x7F, 0xC7, 0x07, 0xE0, 0xFF,
+    0x8F, 0x80, 0x00, 0xFF, 0x9F, 0x80, 0x01, 0xFF, 0xBF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xC7, 0xFE, 0x1F, 0x8F, 0xFE, 0x3F, 0x1F,
+    0xFE, 0x3C, 0x3F, 0xCE, 0x30, 0x07, 0x8F, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x03, 0xC7, 0x80, 0x3F, 0x8F, 0x83, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0x9F, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0x9F, 0xFF, 0x80, 0x1F, 0x1F, 0xFF,
+    0x8F, 0x9F, 0x10, 0xFF, 0x9F, 0x9F, 0x00, 0xFF, 0x8F, 0x9F, 0x00, 0x7F,
+    0x8F, 0x9E, 0x0C, 0x7F, 0x8F, 0x98, 0x1C, 0xFF, 0x83, 0xF8, 0x7F, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+    0x82, 0x63, 0x1F, 0x8E, 0x60, 0x1F, 0x1C, 0x60, 0x8F, 0x18, 0xE3, 0xDF,
+    0x00, 0xC3, 0xDF, 0x01, 0xC7, 0xFF, 0x03, 0x8F, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0x3F, 0x8F, 0x00, 0x3E, 0x3F,
+    0x87, 0x1F, 0x3E, 0x3F, 0xE3, 0x3F, 0x3E, 0x3F, 0xE3, 0x1F, 0x3E, 0x3F,
+    0xE3, 0x1F, 0x3C, 0x3F, 0xC7, 0x1F, 0x30, 0x3F, 0x8F, 0x07, 0xF0, 0xFF,
+    0x9F, 0x07, 0xFF, 0xFF, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x82, 0x63, 0x0F, 0x8E, 0x63, 0x03, 0x1C, 0x63, 0xC3, 0x18, 0xE3,
+    0xE3, 0x00, 0xC7, 0xC7, 0x01, 0xC7, 0x8F, 0x03, 0x8F, 0x1F, 0xCF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF3, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x0F, 0x3F, 0xE3, 0x00, 0xFE, 0x3F,
+    0xC7, 0x1F, 0xFE, 0x3F, 0x87, 0x3F, 0xFE, 0x3F, 0x8F, 0x3F, 0xFE, 0x3F,
+    0xDF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x3F, 0x80, 0x1F,
+    0xF6, 0x38, 0x00, 0x1F, 0xE6, 0x00, 0x00, 0x1F, 0xE6, 0x00, 0x0F, 0x1F,
+    0xC6, 0x00, 0xFE, 0x3F, 0xC6, 0x1F, 0xFF, 0x7F, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0x07,
+    0xE7, 0xC0, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x01, 0xE7,
+    0xE0, 0x1F, 0xC7, 0xE3, 0xFF, 0xC7, 0xE7, 0xFF, 0xC7, 0xE7, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0xC1, 0xFE, 0x07, 0x83, 0xFE, 0x1F, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xCF, 0xE0, 0x07, 0x8E, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x03, 0xC7, 0x80, 0x3F, 0x8F, 0x87, 0xFF, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xE7, 0x9F, 0xFF, 0xE7, 0x9F, 0xFF, 0xC0, 0x1F,
+    0x9F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x9F,
+    0x80, 0x3F, 0x1F, 0x8E, 0x7F, 0x1F, 0x9E, 0x7F, 0x1F, 0x9E, 0xFF, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF2, 0x07, 0xCF, 0xE0, 0x07,
+    0x8E, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0xC7, 0x80, 0x1F, 0x8F,
+    0x87, 0x3F, 0xDF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x07, 0x3F, 0xFF, 0x00, 0xFF, 0x3F, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xF0, 0x03, 0xFF,
+    0xE3, 0xFE, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x3F, 0xC7, 0xFF, 0xE0, 0x3F,
+    0x87, 0x3F, 0x80, 0x3F, 0x8F, 0x30, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xCF, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xE7, 0xFF, 0xF1, 0xCF, 0x81, 0xE1, 0x88, 0x01, 0x83, 0x80, 0x01,
+    0x87, 0x80, 0x01, 0xCF, 0xC0, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x07, 0x3F, 0xFF, 0x00, 0xFF, 0x3F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x8F, 0x00, 0x3F, 0xFF, 0x87, 0xC0, 0x0F, 0xFF, 0xC3, 0xF0, 0x03, 0xFF,
+    0xE3, 0xFE, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x3F, 0xC7, 0xFF, 0xE0, 0x3F,
+    0xCF, 0x3F, 0x80, 0x3F, 0x8F, 0x30, 0x00, 0x3F, 0x9F, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE3, 0xFF, 0x9E, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0x8F, 0x01, 0xFF, 0x03, 0xC7, 0xFF,
+    0xC3, 0xCF, 0xFF, 0xE3, 0x9F, 0x03, 0xC7, 0x10, 0x03, 0x8F, 0x00, 0x03,
+    0x1F, 0x00, 0x03, 0x3F, 0x81, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
+    0xE0, 0x00, 0x1F, 0xE0, 0xFC, 0x1F, 0xC3, 0xFE, 0x1F, 0x87, 0xFF, 0x1F,
+    0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F,
+    0x9F, 0xE0, 0x1F, 0x9C, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x01, 0x1F,
+    0x80, 0x1F, 0x1F, 0x83, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F,
+    0x8F, 0x9F, 0x1F, 0x8F, 0x9C, 0x1F, 0x8F, 0xB8, 0x1F, 0x83, 0xFC, 0xFF,
+    0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x87, 0xE3,
+    0x1F, 0xF3, 0x1F, 0xE3, 0x1F, 0xC7, 0x0E, 0x07, 0x00, 0x07, 0x80, 0x03,
+    0xC0, 0x03, 0xC2, 0x63, 0x8E, 0x63, 0x1C, 0x63, 0x18, 0xE3, 0x00, 0xC7,
+    0x01, 0xC7, 0x83, 0xCF, 0xCF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x9F, 0xF0, 0x3F, 0xFF, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0x8F, 0x00, 0x0F, 0x3F, 0x87, 0x01, 0x1F, 0x7F,
+    0xC2, 0x3F, 0x07, 0xFF, 0xE2, 0x3F, 0x01, 0xFF, 0xE3, 0x3E, 0x00, 0xFF,
+    0xC7, 0x0C, 0x20, 0x7F, 0x8F, 0x00, 0x78, 0x3F, 0x9F, 0x00, 0x7C, 0x3F,
+    0xBF, 0x80, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF3, 0xFF, 0x9F, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0x0F, 0x00, 0x1F, 0x03, 0x00, 0xFF, 0xC3, 0xE3, 0xFF,
+    0xE3, 0x87, 0xFF, 0xC7, 0x8F, 0xFF, 0x8F, 0x0F, 0xFF, 0x1F, 0x0F, 0xFF,
+    0x3F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xE1, 0xE0, 0x3F, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0x80, 0x7E, 0x3F,
+    0xFF, 0x00, 0x3E, 0x3F, 0xFF, 0x18, 0x1E, 0x3F, 0xF3, 0x3C, 0x1E, 0x3F,
+    0xE2, 0x3E, 0x04, 0x3F, 0xE2, 0x3F, 0x00, 0x3F, 0xC7, 0x1F, 0x00, 0x7F,
+    0x87, 0x03, 0x80, 0xFF, 0x8F, 0x07, 0xE3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC1, 0xFF, 0xF1, 0xE1,
+    0xFF, 0xE0, 0xF1, 0xFF, 0xC0, 0x71, 0xFF, 0x88, 0x39, 0xFF, 0x8C, 0x01,
+    0xF9, 0x8E, 0x03, 0xE1, 0x8F, 0x03, 0xC3, 0x87, 0x87, 0x87, 0xCF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xE1, 0xE0, 0x3F, 0xFF, 0xC0, 0xFC, 0x3F, 0xFF, 0x80, 0x7E, 0x3F,
+    0x9F, 0x00, 0x3E, 0x3F, 0x87, 0x18, 0x1E, 0x3F, 0xC3, 0x3C, 0x1E, 0x3F,
+    0xE2, 0x3E, 0x04, 0x3F, 0xE2, 0x3F, 0x00, 0x3F, 0xC7, 0x1F, 0x00, 0x7F,
+    0xC7, 0x03, 0x80, 0xFF, 0x8F, 0x07, 0xE3, 0xFF, 0x9F, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x83, 0xFF, 0xE3, 0xC3,
+    0xFF, 0xC1, 0xE3, 0x9F, 0x80, 0xE3, 0x07, 0x10, 0x73, 0x83, 0x18, 0x03,
+    0xE3, 0x1C, 0x07, 0xC3, 0x1E, 0x07, 0x87, 0x0F, 0x0F, 0x9F, 0x9F, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xBF, 0xFF, 0x03, 0xFF, 0x3F,
+    0xFF, 0x0F, 0xFF, 0x3F, 0xFF, 0x1F, 0xF8, 0x3F, 0xFF, 0x1F, 0x80, 0x3F,
+    0x8F, 0x10, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x3F, 0xC3, 0x00, 0x03, 0x3F,
+    0xE3, 0x00, 0x7F, 0x3F, 0xE3, 0x07, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFF,
+    0x8F, 0x1F, 0xFF, 0xFF, 0x9F, 0x1F, 0xFF, 0xFF, 0x9F, 0x03, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x38, 0x07, 0xFF, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC7, 0xF0, 0x3F, 0xC7,
+    0xFE, 0x3F, 0x8F, 0xE2, 0x3F, 0x9F, 0x02, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xBF, 0xE1, 0xFF, 0xFF, 0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x01, 0xFE, 0x3F,
+    0xFF, 0x1F, 0xFE, 0x3F, 0xE7, 0x3F, 0xFE, 0x3F, 0x83, 0x7F, 0xFE, 0x3F,
+    0x81, 0xFF, 0xFC, 0x3F, 0x39, 0xFF, 0xF8, 0x3F, 0x39, 0x3F, 0xE0, 0x7F,
+    0x83, 0x3C, 0x00, 0xFF, 0x87, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0x1C, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0x00, 0xE3, 0xC3, 0x8F, 0xE7, 0x81, 0xFF, 0xC7,
+    0x19, 0xFF, 0x1F, 0x39, 0xFC, 0x07, 0x11, 0xC0, 0x03, 0x83, 0x00, 0x03,
+    0xC7, 0x00, 0x03, 0xFF, 0x07, 0xE7, 0xFF, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xBF, 0xE1, 0xFF, 0xFF, 0x3C, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x01, 0xFE, 0x3F,
+    0xF3, 0x1F, 0xFE, 0x3F, 0xE3, 0x3F, 0xFE, 0x3F, 0xE3, 0x7F, 0xFE, 0x3F,
+    0xC7, 0xFF, 0xFC, 0x3F, 0x87, 0xFF, 0xF8, 0x3F, 0x8F, 0x3F, 0xE0, 0x7F,
+    0xD3, 0x3C, 0x00, 0xFF, 0xE3, 0x00, 0x01, 0xFF, 0xE7, 0x00, 0x07, 0xFF,
+    0xC7, 0x00, 0x7F, 0xFF, 0x87, 0x0F, 0xFF, 0xFF, 0x8F, 0x3F, 0xFF, 0xFF,
+    0xDF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0x1C, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFB, 0x00, 0xE3, 0xE3, 0x8F, 0xE7, 0xC3, 0xFF, 0xC7,
+    0x87, 0xFF, 0x1F, 0x8F, 0xFC, 0x07, 0xF3, 0xC0, 0x03, 0xE3, 0x00, 0x03,
+    0x87, 0x00, 0x03, 0x8F, 0x07, 0xE7, 0x9F, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xFC, 0x3F, 0xFC, 0xFC, 0x07, 0xFC,
+    0xFC, 0x00, 0xE0, 0xFC, 0x00, 0x00, 0x8C, 0xC0, 0x00, 0x0C, 0xF8, 0x00,
+    0x1F, 0xF8, 0x0C, 0xBF, 0xF0, 0x7C, 0xFF, 0xC1, 0xFF, 0x8C, 0x83, 0xFF,
+    0x0C, 0x0F, 0xFF, 0x1C, 0x1F, 0xFF, 0xBC, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0x87, 0xF0, 0x3F, 0xFF, 0x03, 0xE0, 0x3F, 0xFF, 0x07, 0xC0, 0x3F,
+    0xFF, 0x1F, 0x83, 0x3F, 0xFF, 0x1F, 0x06, 0x3F, 0xF3, 0x1C, 0x0E, 0x3F,
+    0xE3, 0x18, 0x1E, 0x3F, 0xE3, 0x30, 0x3E, 0x3F, 0xC7, 0x00, 0x7E, 0x3F,
+    0x87, 0x01, 0xF8, 0x3F, 0x8F, 0x03, 0xF0, 0x3F, 0xDF, 0x07, 0xF0, 0x7F,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xE3, 0xE1, 0xFF, 0xC1, 0xC1,
+    0xFF, 0x83, 0x83, 0xFF, 0x8F, 0x03, 0xFF, 0x8E, 0x11, 0xFF, 0xC4, 0x31,
+    0xF1, 0xC0, 0x71, 0xE1, 0xC1, 0xF1, 0x83, 0xC3, 0xC1, 0x87, 0x87, 0xC1,
+    0xCF, 0x8F, 0xF7, 0xFF, 0xDF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0x0F, 0xE0, 0x7F, 0xFE, 0x07, 0xC0, 0x7F, 0xFE, 0x0F, 0x80, 0x7F,
+    0xFE, 0x3F, 0x06, 0x7F, 0xFE, 0x3E, 0x0C, 0x7F, 0xFE, 0x38, 0x1C, 0x7F,
+    0x86, 0x30, 0x3C, 0x7F, 0x86, 0x60, 0x7C, 0x7F, 0x8E, 0x00, 0xFC, 0x7F,
+    0x9E, 0x03, 0xF0, 0x7F, 0xFE, 0x07, 0xE0, 0x7F, 0xFE, 0x0F, 0xE0, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x8F, 0x87, 0xFF, 0x07, 0x07,
+    0xFE, 0x0E, 0x0F, 0xFE, 0x3C, 0x0F, 0xFE, 0x38, 0x47, 0x87, 0x10, 0xC7,
+    0x87, 0x01, 0xC7, 0x8F, 0x07, 0xC7, 0x9F, 0x0F, 0x07, 0xFE, 0x1F, 0x07,
+    0xFE, 0x3F, 0xDF, 0xFF, 0x7F, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0x87, 0xF0, 0x3F, 0xFF, 0x03, 0xE0, 0x3F, 0xFF, 0x07, 0xC0, 0x3F,
+    0x9F, 0x1F, 0x83, 0x3F, 0x87, 0x1F, 0x06, 0x3F, 0xC3, 0x1C, 0x0E, 0x3F,
+    0xE3, 0x18, 0x1E, 0x3F, 0xE3, 0x30, 0x3E, 0x3F, 0xE3, 0x00, 0x7E, 0x3F,
+    0xC7, 0x01, 0xF8, 0x3F, 0x8F, 0x03, 0xF0, 0x3F, 0x9F, 0x07, 0xF0, 0x7F,
+    0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xC7, 0xC3, 0xFF, 0x83, 0x83,
+    0xFF, 0x07, 0x07, 0x8F, 0x1E, 0x07, 0x07, 0x1C, 0x23, 0xC3, 0x88, 0x63,
+    0xE3, 0x80, 0xE3, 0xC3, 0x83, 0xE3, 0x8F, 0x87, 0x83, 0x1F, 0x0F, 0x83,
+    0x3F, 0x1F, 0xEF, 0xFF, 0xBF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFB, 0xFF, 0xF3, 0x8F, 0xC3, 0x8F, 0x03, 0x9C, 0x07, 0x00, 0x0F,
+    0x00, 0x7F, 0x03, 0xFF, 0x1F, 0xC7, 0x1C, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x01, 0xE3, 0x0F, 0xE7, 0x1F, 0xC7, 0x1F, 0xFF, 0x3F, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF,
+    0xC0, 0x3F, 0xBF, 0x83, 0xFC, 0x1F, 0x8F, 0xFC, 0x1F, 0x9F, 0x1F, 0x1F,
+    0x1E, 0x1F, 0x9F, 0x1C, 0x0F, 0x9F, 0x88, 0x07, 0x1F, 0x80, 0x80, 0x1F,
+    0x83, 0xC0, 0x3F, 0xC7, 0xC0, 0x7F, 0xEF, 0xF0, 0xFF,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2018 '‘'
+    0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x201A '‚'
+    0xFE, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0xCF, 0xFF,
+    // 0x201B '‛'
+    0xCF, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xBC, 0x7F, 0xFF, 0x7F,
+    // 0x201C '“'
+    0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF,
+    0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x87, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xFF,
+    0xFE, 0xFF, 0xF8, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x07, 0xFF, 0x9F, 0xFF,
+    // 0x201E '„'
+    0xFE, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0xCE, 0xFF,
+    0xFC, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    // 0x201F '‟'
+    0xCF, 0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xBC, 0x7F, 0xFF, 0x7F,
+    0x83, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x9C, 0x7F, 0xFF, 0x7F,
+    // 0x2020 '†'
+    0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFE, 0x7F, 0xF8, 0xE0, 0x7F,
+    0xFC, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0x88, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFC, 0xF8, 0xFF, 0xF8, 0xF8, 0xEF,
+    0xF8, 0xF8, 0x0F, 0xF8, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xFF,
+    0x80, 0x18, 0xFF, 0x88, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF9, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xFF, 0xC7, 0x83, 0x03, 0x03, 0x87, 0x8F,
+    // 0x2026 '…'
+    0x8F, 0x8F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0F, 0x0F,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x8F, 0x0F, 0x0F, 0x9F,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x8E, 0x3F,
+    0x1F, 0xBF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xBE, 0x3F, 0x1C, 0x3F, 0x80, 0x7F, 0x80, 0xFF,
+    0xC1, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xF8, 0x1F, 0xE0, 0x0F, 0xC0, 0x07, 0x87, 0xC7, 0x9F, 0xC7,
+    0x9F, 0x8F, 0x9E, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x07, 0x80, 0x07, 0x80, 0x1F, 0x83, 0x3F, 0xFF, 0x3F,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xE7, 0xE3, 0xC7, 0x83, 0xC7, 0x81, 0xCF,
+    0x98, 0x0F, 0x98, 0x1F, 0x9C, 0x3F, 0x9F, 0xFF, 0x9F, 0xFF,
+    // 0x2076 '⁶'
+    0xFC, 0x1F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC1, 0xC7, 0xC1, 0xE7, 0x89, 0xC7,
+    0x98, 0x0F, 0x98, 0x0F, 0x9C, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xE7, 0xEF, 0x87, 0x87, 0x8F, 0x07, 0x9C, 0x1F, 0x98, 0x7F, 0x90, 0xFF,
+    0x83, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xE6, 0x0F, 0xC0, 0x07, 0x80, 0xE7, 0x99, 0xE7,
+    0xB8, 0xCF, 0x90, 0x0F, 0x82, 0x1F, 0x87, 0x3F, 0xCF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xE1, 0xE7, 0xC0, 0xC7, 0x80, 0xCF, 0x9C, 0x8F,
+    0x9C, 0x1F, 0x9C, 0x1F, 0x80, 0x3F, 0xC0, 0xFF, 0xE3, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0x87, 0xC7, 0x9F, 0xC7,
+    0x9F, 0xCF, 0x9E, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xCF, 0xCF, 0xCE, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x81, 0xCF, 0x9F, 0xEF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xEF, 0x8F, 0xC7, 0x0F, 0x8F, 0x0F, 0x9E, 0x4F,
+    0x9C, 0x4F, 0x90, 0xCF, 0x81, 0xCF, 0x83, 0xCF, 0xEF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xCF, 0xE7, 0x8C, 0xC7, 0x9C, 0xC7, 0x98, 0x8F,
+    0x80, 0x0F, 0x80, 0x1F, 0xC7, 0x7F, 0xFF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x07, 0x80, 0x07, 0x80, 0x1F, 0x83, 0x3F, 0xFF, 0x3F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xE3, 0xE7, 0x81, 0xC7, 0x81, 0xCF,
+    0x98, 0x0F, 0x98, 0x1F, 0x9C, 0x3F, 0x9F, 0xFF, 0x9F, 0xFF,
+    // 0x2086 '₆'
+    0xFC, 0x1F, 0xF8, 0x0F, 0xE0, 0x07, 0xC1, 0xC7, 0xC1, 0xE7, 0x89, 0xC7,
+    0x98, 0x0F, 0x98, 0x0F, 0x9C, 0x1F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xE7, 0xEF, 0x87, 0x87, 0x8F, 0x07, 0x9C, 0x0F, 0x98, 0x7F, 0x90, 0xFF,
+    0x83, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xF6, 0x0F, 0xC0, 0x07, 0x80, 0xE7, 0x99, 0xE7,
+    0x98, 0xC7, 0x90, 0x0F, 0x82, 0x0F, 0x83, 0x3F, 0xCF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xE1, 0xE7, 0xC0, 0xC7, 0x80, 0xCF, 0x9C, 0x0F,
+    0x9E, 0x0F, 0x9C, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE3, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x27, 0xFF,
+    0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x20, 0x1F,
+    0xC0, 0x26, 0x1F, 0xC6, 0x27, 0x1F, 0x86, 0x27, 0x1F, 0x8E, 0x27, 0x1F,
+    0x8E, 0x2F, 0x1F, 0x8E, 0x7F, 0x1F, 0x8F, 0xFF, 0x3F, 0x83, 0xFE, 0x3F,
+    0x83, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2122 '™'
+    0xFF, 0xFF, 0x8F, 0xBF, 0x9F, 0x3F, 0x90, 0x3F, 0x80, 0x3F, 0x83, 0x3F,
+    0x9F, 0xFF, 0x8F, 0xFF, 0x8F, 0x3F, 0xFE, 0x3F, 0xB0, 0x3F, 0x83, 0xFF,
+    0x81, 0xFF, 0x80, 0xFF, 0xF9, 0xFF, 0xE7, 0x3F, 0x80, 0x3F, 0x80, 0x3F,
+    0x9F, 0x3F, 0xBF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0x83, 0xFF,
+    0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xF3, 0xC7, 0xCF, 0xF7, 0x87,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF0, 0x7F, 0xEF, 0xE1, 0xFF, 0xCF, 0xC3, 0xCF, 0xCF, 0x87, 0x8D, 0xCF,
+    0xCF, 0x99, 0xCF, 0xFF, 0x19, 0x8F, 0xFF, 0x10, 0x1F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x86, 0x3F, 0xFF, 0xCF, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xF3, 0xC3, 0xFF, 0xE3, 0xC3, 0xFF,
+    0xC7, 0x83, 0xFF, 0xCF, 0x03, 0xFF, 0xCE, 0x23, 0xFF, 0xC4, 0x63, 0xE7,
+    0xC0, 0xE3, 0x87, 0xE1, 0xF7, 0x07, 0xF3, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xEF, 0xF0, 0xFF, 0xCF, 0xC1, 0xCF, 0xCF,
+    0x87, 0x8D, 0xCF, 0xCF, 0x99, 0xCF, 0xFF, 0x19, 0x8F, 0xFF, 0x10, 0x1F,
+    0xFF, 0x00, 0x1F, 0xFF, 0x86, 0x3F, 0xFF, 0xCF, 0xFF,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0x83, 0xFF,
+    0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xF3, 0xC7, 0xCF, 0xF7, 0x87,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF8, 0x7F, 0x1F, 0xE0, 0xFE, 0x0F, 0xC3, 0xC4, 0x0F, 0x87, 0x80, 0xCF,
+    0xCF, 0x81, 0xCF, 0xFF, 0x39, 0xCF, 0xFF, 0x30, 0x0F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x86, 0x1F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xE3, 0xF3, 0xFF, 0xE6, 0x73, 0xFF,
+    0xCE, 0x63, 0xFF, 0xCC, 0x67, 0xE7, 0xC0, 0x07, 0xC7, 0xC0, 0x0F, 0x07,
+    0xE3, 0xBE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xF0, 0xFF, 0x1F, 0xE1, 0xFE, 0x0F, 0x83, 0xC4, 0x0F, 0x8F, 0x80, 0xCF,
+    0xDF, 0x81, 0xCF, 0xFF, 0x39, 0xCF, 0xFF, 0x30, 0x0F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x86, 0x1F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xF8, 0xF3, 0xFF,
+    0xC0, 0xF3, 0xFF, 0xC0, 0xE3, 0xFF, 0xCC, 0x07, 0xE7, 0xCC, 0x07, 0xC7,
+    0xCE, 0x0F, 0x07, 0xCF, 0xFE, 0x1F, 0xCF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0x1F, 0xC1, 0xFE, 0x0F, 0x83, 0xC4, 0x0F,
+    0x8F, 0x80, 0xCF, 0xDF, 0x81, 0xCF, 0xFF, 0x39, 0xCF, 0xFF, 0x30, 0x0F,
+    0xFF, 0x00, 0x1F, 0xFF, 0x86, 0x1F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215E '⅞'
+    0xF3, 0xFF, 0xFF, 0xC3, 0xC3, 0xFF, 0xC7, 0x83, 0xFF, 0xCE, 0x07, 0xEF,
+    0xCC, 0x1F, 0xC7, 0xC0, 0x7F, 0x87, 0xC0, 0xFE, 0x0F, 0xC3, 0xFC, 0x3F,
+    0xC7, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF, 0x1F,
+    0x83, 0xFE, 0x0F, 0x87, 0xC4, 0x0F, 0xDF, 0x80, 0xCF, 0xFF, 0x81, 0xCF,
+    0xFF, 0x39, 0xCF, 0xFF, 0x30, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x86, 0x1F,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2190 '←'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x99, 0x9F,
+    0xD9, 0xBF, 0xF9, 0xFF, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    // 0x2191 '↑'
+    0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xC7, 0x80, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC7, 0xC0, 0x7F,
+    0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF1, 0xFF, 0xF9, 0xFF, 0xD9, 0xBF, 0x99, 0x9F, 0x80, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF,
+    0x80, 0x78, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xF8, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF7, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x89, 0x1F,
+    0x99, 0x9F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x9F,
+    0x89, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xE1, 0xE1, 0xFF, 0xC3, 0xF0, 0xFF,
+    0x87, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x87, 0xF8, 0x7F,
+    0xC3, 0xF0, 0xFF, 0xE1, 0xE1, 0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF1, 0x8F, 0xE1, 0x87,
+    0xC1, 0x83, 0x89, 0x91, 0xD9, 0x9B, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F,
+    0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F,
+    0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xD9, 0x9B, 0x89, 0x91, 0xC1, 0x83,
+    0xE1, 0x87, 0xF1, 0x8F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xE3, 0x1F, 0x83, 0x07,
+    0x83, 0x07, 0xD3, 0x2F, 0xF3, 0x3F, 0xF3, 0x3F, 0xD3, 0x2F, 0x83, 0x07,
+    0xC3, 0x0F, 0xE3, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x07, 0xCF, 0x80, 0x07,
+    0x8F, 0x03, 0xC7, 0x9F, 0x1F, 0xC7, 0x9F, 0x3F, 0xC7, 0x9E, 0x3F, 0xC7,
+    0x8E, 0x3F, 0x0F, 0x83, 0x10, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x01, 0xFF, 0xFE, 0x3F, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0x00, 0x1F, 0xF8, 0x07, 0x9F, 0xE0, 0x3F, 0x9F, 0x80, 0xFF, 0x9F,
+    0x83, 0xFF, 0x9F, 0x00, 0xFF, 0x9F, 0x00, 0x1F, 0x9F, 0xC0, 0x03, 0x9F,
+    0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x220F '∏'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF1, 0x87, 0xFF, 0xC1, 0x81, 0xFF, 0x81,
+    0x80, 0xFF, 0x01, 0x80, 0x3C, 0x11, 0x80, 0x18, 0x31, 0x8C, 0x00, 0x71,
+    0x8E, 0x00, 0xF1, 0x8F, 0x83, 0xF1, 0x8F, 0xC7, 0xF1, 0x8F, 0xFF, 0xF1,
+    0x8F, 0xFF, 0xF1, 0x83, 0xFF, 0xC1, 0x81, 0xFF, 0x81, 0x83, 0xFF, 0x81,
+    0xFF, 0xFF, 0x8F,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x3F,
+    0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xE1, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0x1C, 0x7F, 0x1E, 0x7F, 0x1C, 0x7F,
+    0x80, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0x80, 0xFF, 0x8C, 0x7F, 0x1E, 0x7F,
+    0x1E, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC1, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xE7, 0x3F, 0xE6, 0x3F, 0xE6, 0x0F, 0xE6, 0x0F, 0xE6, 0x1F, 0xE0, 0x3F,
+    0xE0, 0x3F, 0xC2, 0x3F, 0x06, 0x3F, 0x86, 0x3F, 0xE6, 0x3F, 0xE6, 0x3F,
+    // 0x2264 '≤'
+    0xF9, 0xFC, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xE0, 0x78, 0xE2, 0x38,
+    0xC6, 0x38, 0xC7, 0x18, 0x8F, 0x18, 0x8F, 0x88, 0x9F, 0x88, 0xDF, 0xD8,
+    // 0x2265 '≥'
+    0xFF, 0xFC, 0x1F, 0x88, 0x0F, 0x88, 0x8F, 0x18, 0xC7, 0x18, 0xC6, 0x38,
+    0xE6, 0x38, 0xE2, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8,
+    // 0x2500 '─'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2502 '│'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x250C '┌'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2514 '└'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x251C '├'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x252C '┬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x253C '┼'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2550 '═'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2551 '║'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255A '╚'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255D '╝'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x256C '╬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F
+};
+
+
+const uint8_t Bookerly26BoldItalicBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x77, 0x00, 0x18, 0x8F, 0x0B, 0x00, 0x0F, 0x20, 0x00, 0x97,
+    0x00, 0x20, 0x07, 0x80, 0x80, 0x07, 0x10, 0x00, 0x07, 0x80, 0x00, 0x07,
+    // 0x22 '"'
+    0x06, 0x7F, 0x40, 0x7F, 0x80, 0xFF, 0x06, 0x7F, 0xC0, 0x7F, 0x16, 0xFF,
+    0x40, 0x7F, 0x01, 0x7F, 0x94, 0x7F, 0xC0, 0x7F,
+    // 0x23 '#'
+    0x00, 0x10, 0x7F, 0x02, 0x00, 0x7F, 0x02, 0x0A, 0x7F, 0x02, 0x80, 0x7F,
+    0x00, 0x00, 0x7F, 0xA0, 0x0C, 0x7F, 0x80, 0x40, 0x7F, 0x82, 0x01, 0x7F,
+    0xC2, 0x0C, 0x7F, 0x01, 0x00, 0x7F, 0x10, 0x02, 0x7F, 0x00, 0x08, 0x7F,
+    0x80, 0x80, 0x7F, 0xA2, 0x00, 0x7F, 0x02, 0x20, 0x7F, 0x0E, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0xC2, 0x00, 0x7F,
+    0x02, 0x10, 0x03, 0x3F, 0x00, 0x08, 0x20, 0x7F, 0x01, 0x00, 0x81, 0x3F,
+    0x00, 0x40, 0x20, 0x3F, 0x01, 0x40, 0x20, 0x3F, 0x10, 0x00, 0x08, 0x3F,
+    0xC1, 0x90, 0x88, 0x3F, 0x10, 0x00, 0x10, 0x3F, 0xC1, 0x00, 0x00, 0x3F,
+    0x08, 0x42, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x3F,
+    // 0x25 '%'
+    0x02, 0xC0, 0x03, 0x0C, 0x00, 0x03, 0x10, 0x08, 0x03, 0x00, 0xE0, 0x03,
+    0x24, 0x00, 0x1B, 0x00, 0x00, 0x47, 0x08, 0xC0, 0x0B, 0x00, 0x11, 0x03,
+    0x00, 0x24, 0x43, 0x00, 0xC0, 0x03, 0x00, 0x12, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x02, 0x22, 0xA3, 0x00, 0x00, 0x13, 0x00, 0x90, 0x0B,
+    0x02, 0x02, 0x83, 0x40, 0x00, 0x03, 0x08, 0x50, 0x0B, 0x00, 0x10, 0x03,
+    0x00, 0x40, 0x13, 0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03,
+    // 0x26 '&'
+    0x00, 0x0E, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x06, 0x07,
+    0x00, 0x10, 0x07, 0x00, 0x00, 0x17, 0x20, 0x08, 0x97, 0x40, 0x02, 0x07,
+    0x90, 0x40, 0x87, 0xA0, 0x80, 0x27, 0x24, 0x00, 0x27, 0x09, 0x40, 0x07,
+    0x82, 0x82, 0x07, 0x84, 0xA8, 0x17, 0x58, 0x20, 0x17, 0x01, 0x02, 0x07,
+    0x01, 0x18, 0x47, 0x00, 0x00, 0x4F, 0x02, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x03, 0x80, 0x07,
+    // 0x27 '''
+    0x06, 0x7F, 0x40, 0x7F, 0x80, 0xFF, 0x06, 0x7F, 0xC0, 0x7F,
+    // 0x28 '('
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x28, 0x20, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x00, 0x17, 0xA0, 0x1F, 0x08, 0x40, 0x08, 0x1F,
+    0x10, 0x00, 0x02, 0x1F, 0x20, 0x00, 0x00, 0x9F, 0x08, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x08, 0x1F,
+    0x10, 0x00, 0x20, 0x1F, 0x06, 0x00, 0xC0, 0x1F, 0x00, 0xBA, 0x08, 0x1F,
+    0x10, 0x00, 0x10, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x00, 0x85, 0x00, 0x1F,
+    // 0x2A '*'
+    0x12, 0x3F, 0x20, 0xBF, 0x00, 0xBF, 0x05, 0x3F, 0x23, 0xFF, 0x00, 0x7F,
+    0x1B, 0x3F, 0x08, 0xBF, 0x00, 0x3F, 0x0A, 0x3F,
+    // 0x2B '+'
+    0x07, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x78, 0xF7, 0x00, 0x07,
+    0x00, 0x07, 0x81, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x01, 0x07,
+    // 0x2C ','
+    0x03, 0x7F, 0x00, 0x7F, 0x20, 0x7F, 0x81, 0x7F, 0x82, 0x7F, 0x04, 0x7F,
+    0x10, 0x7F,
+    // 0x2D '-'
+    0x5F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x0F,
+    // 0x2E '.'
+    0x47, 0x8F, 0x8F, 0x07, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x87, 0x00, 0x00, 0x17,
+    0x00, 0x08, 0x27, 0x00, 0x10, 0x07, 0x00, 0x02, 0x07, 0x01, 0x04, 0x07,
+    0x02, 0x00, 0x07, 0x00, 0x40, 0x07, 0x20, 0x80, 0x07, 0x40, 0x00, 0x07,
+    0x88, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x21, 0x0F, 0x01, 0x80, 0x4F, 0x04, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x5C, 0x0F, 0x20, 0x00, 0x1F, 0x04, 0x00, 0x8F, 0x08, 0x00, 0x0F,
+    0x40, 0x01, 0x2F, 0x00, 0x02, 0x2F, 0x00, 0x04, 0x4F, 0x04, 0xC0, 0x0F,
+    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x20, 0x08, 0x0F, 0x07, 0xA0, 0x0F,
+    // 0x31 '1'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x9F,
+    0x28, 0x02, 0x9F, 0x08, 0x30, 0x1F, 0x0D, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x9F, 0x00, 0x28, 0x9F, 0x02, 0x80, 0x1F, 0x50, 0x00, 0x1F,
+    // 0x32 '2'
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F, 0x04, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x20, 0x04, 0x1F, 0x02, 0x09, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x02, 0x1F,
+    0x10, 0x00, 0x1F, 0x10, 0x08, 0x1F, 0x09, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x00, 0x00, 0x5F, 0x02, 0x00, 0x1F,
+    // 0x33 '3'
+    0x00, 0x00, 0xCF, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x14, 0x00, 0x1F,
+    0x22, 0x50, 0x0F, 0x04, 0x50, 0x8F, 0x08, 0x00, 0x0F, 0x40, 0x90, 0x2F,
+    0x00, 0x00, 0x2F, 0x10, 0x0C, 0x0F, 0x08, 0x00, 0x0F, 0x40, 0x40, 0x8F,
+    0x40, 0x20, 0x0F, 0x20, 0x10, 0x0F, 0x10, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x02, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x1F,
+    0x00, 0x90, 0x1F, 0x01, 0x20, 0x1F, 0x02, 0x40, 0x1F, 0x04, 0x80, 0x7F,
+    0x09, 0x00, 0x1F, 0x12, 0x80, 0x1F, 0x22, 0x00, 0x3F, 0x00, 0x00, 0x9F,
+    0x00, 0x50, 0x1F, 0x0A, 0x00, 0x1F, 0x60, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x35 '5'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x01, 0x81, 0x3F,
+    0x10, 0x81, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x82, 0x1F, 0x84, 0x00, 0x1F,
+    0x80, 0x04, 0x1F, 0x82, 0x30, 0x9F, 0x82, 0x00, 0x1F, 0x81, 0x00, 0x1F,
+    0x80, 0x04, 0x1F, 0x80, 0x20, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    // 0x36 '6'
+    0x00, 0x11, 0x8F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x2F, 0x00, 0x04, 0x0F,
+    0x00, 0x01, 0x0F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x0F,
+    0x05, 0x03, 0x2F, 0x08, 0x00, 0x2F, 0x48, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x14, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0x1F, 0x30, 0x03, 0x1F, 0x02, 0x08, 0x3F, 0x80, 0x10, 0x3F,
+    0x90, 0x00, 0xDF, 0x90, 0x83, 0x1F, 0x90, 0x04, 0x1F, 0x92, 0x00, 0x1F,
+    0x90, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x88, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x00, 0x0F, 0x00, 0x0C, 0xCF, 0x00, 0x10, 0x0F, 0x01, 0x00, 0x2F,
+    0x00, 0xA5, 0x0F, 0x00, 0x40, 0x9F, 0x00, 0x10, 0x9F, 0x01, 0x10, 0x8F,
+    0x50, 0x10, 0x8F, 0x00, 0x01, 0x2F, 0x01, 0x00, 0x2F, 0x0E, 0x40, 0x4F,
+    0x40, 0x20, 0x0F, 0x00, 0x08, 0x0F, 0x20, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x02, 0x40, 0x9F,
+    0x08, 0x20, 0x0F, 0x20, 0x10, 0x0F, 0x00, 0x08, 0x2F, 0x03, 0x00, 0x2F,
+    0x08, 0x4A, 0x0F, 0x10, 0x0C, 0x4F, 0x10, 0x00, 0x8F, 0x08, 0x00, 0x0F,
+    0x44, 0x80, 0x0F, 0x40, 0x04, 0x0F, 0x00, 0x08, 0x0F, 0x18, 0x60, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x3A ':'
+    0x00, 0x11, 0x00, 0x23, 0x30, 0x23, 0x00, 0x01, 0x80, 0x01, 0x08, 0x01,
+    0x70, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0xDF, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x5F,
+    0x30, 0x20, 0x9F, 0x40, 0x01, 0x1F, 0x80, 0x04, 0x1F, 0x08, 0x00, 0x1F,
+    0x70, 0x00, 0x1F,
+    // 0x3C '<'
+    0x00, 0x07, 0x09, 0x07, 0x08, 0x07, 0x10, 0x07, 0x16, 0x07, 0x06, 0x07,
+    0x21, 0x07, 0x09, 0x07, 0x40, 0x87, 0x00, 0x87, 0x00, 0x07, 0x60, 0x47,
+    // 0x3D '='
+    0xE2, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x81,
+    // 0x3E '>'
+    0x20, 0x27, 0x80, 0x17, 0x90, 0x17, 0x40, 0x87, 0x48, 0x27, 0x21, 0x27,
+    0x01, 0x47, 0x12, 0x47, 0x00, 0x87, 0x00, 0x87, 0x01, 0x07, 0x01, 0x07,
+    // 0x3F '?'
+    0x10, 0x38, 0x2F, 0x08, 0x05, 0x1F, 0x80, 0x00, 0x1F, 0x01, 0x01, 0x0F,
+    0x02, 0x40, 0x0F, 0x8C, 0x90, 0x0F, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x18, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x04, 0xC0, 0x7F, 0x00, 0x60, 0x10, 0x7F, 0x01, 0x80, 0x04, 0x7F,
+    0x00, 0x0D, 0x80, 0x7F, 0x04, 0x60, 0x20, 0x7F, 0x08, 0x80, 0x01, 0x7F,
+    0x02, 0x00, 0x08, 0x7F, 0x00, 0x00, 0xC0, 0x7F, 0x04, 0x40, 0x04, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x49, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x10, 0x02, 0x84, 0x7F, 0x12, 0x08, 0x05, 0x7F, 0x00, 0x60, 0x41, 0x7F,
+    0x01, 0x00, 0x08, 0x7F, 0x12, 0x09, 0x02, 0x7F, 0x42, 0x00, 0x04, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x40, 0x04, 0x00, 0x7F, 0x20, 0x18, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x07, 0x20, 0x00, 0x7F,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x02, 0x7F,
+    0x02, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x5F, 0x80, 0x50, 0x1F, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x1F,
+    0x02, 0x80, 0x1F, 0x00, 0x14, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x50, 0x0A, 0x0F,
+    0x41, 0x40, 0x0F, 0x08, 0x00, 0x0F, 0x80, 0x01, 0x8F, 0x80, 0x14, 0x8F,
+    0x02, 0x80, 0x8F, 0x10, 0x00, 0x0F, 0x00, 0x10, 0xAF, 0x80, 0x81, 0x0F,
+    0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x8F, 0x21, 0x13, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x43 'C'
+    0x00, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x06, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x48, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x01, 0x1F,
+    0x08, 0x00, 0x1F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x2F, 0x9A, 0x00, 0x4F, 0x02, 0x04, 0x8F, 0x42, 0x00, 0x0F,
+    0x68, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x50, 0x0A, 0x0F,
+    0x41, 0x40, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x14, 0x0F,
+    0x02, 0x80, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x04, 0x18, 0x4F, 0x40, 0x00, 0x0F,
+    0x20, 0x01, 0x0F, 0x10, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x14, 0x9F,
+    0x02, 0x00, 0x1F, 0x18, 0x80, 0x1F, 0x10, 0x80, 0x1F, 0x00, 0x80, 0x9F,
+    0x00, 0x82, 0x1F, 0x00, 0x80, 0x1F, 0x02, 0x00, 0xDF, 0x02, 0x00, 0x1F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x46 'F'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x9F,
+    0x01, 0x00, 0x1F, 0x18, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x10, 0x40, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x10, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0x00, 0x0F, 0x01, 0x03, 0x0F, 0x06, 0x00, 0x8F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x2F, 0x20, 0x48, 0x2F, 0x02, 0x01, 0x0F, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x9F, 0x90, 0x00, 0x9F, 0x80, 0x08, 0x8F, 0x10, 0x20, 0x8F,
+    0x10, 0x2D, 0x0F, 0x00, 0x20, 0x0F, 0x84, 0x20, 0x0F, 0x02, 0x20, 0x8F,
+    0x40, 0x2C, 0x0F, 0x50, 0x10, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x1F,
+    0x01, 0x80, 0x1F, 0x18, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x5F,
+    0x00, 0x80, 0x1F, 0x00, 0x81, 0x9F, 0x20, 0x88, 0x1F, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F, 0x00, 0x28, 0x1F, 0x05, 0x00, 0x5F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x49 'I'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x00, 0x40, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x0A, 0x1F,
+    0x01, 0x40, 0x5F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x41, 0x7F, 0x20, 0x05, 0x02, 0x7F, 0x00, 0xA0, 0x04, 0x7F,
+    0x0C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0xA0, 0x00, 0x7F, 0x14, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x20, 0x0A, 0x0F,
+    0x01, 0x40, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x14, 0x0F,
+    0x02, 0x08, 0x2F, 0x00, 0x04, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x20, 0x8F,
+    0x00, 0x10, 0x0F, 0x28, 0x04, 0x2F, 0x12, 0x00, 0x0F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x9F,
+    0x01, 0x40, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x1F,
+    0x00, 0x08, 0x1F, 0x01, 0x00, 0x1F, 0x0C, 0x04, 0x1F, 0x00, 0x30, 0x1F,
+    0x00, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x0A, 0x1F, 0x00, 0x00, 0x9F,
+    0x66, 0x00, 0x9F, 0x00, 0x41, 0x1F, 0x00, 0x46, 0x1F, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x40, 0x0C, 0x9F, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0E, 0x3C, 0x9F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x20, 0x0A, 0x0F,
+    0x01, 0x40, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x0A, 0x0F, 0x01, 0x40, 0x4F,
+    0x01, 0x80, 0x0F, 0x40, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x01, 0x00, 0xCF, 0x00, 0x60, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x60, 0x0F,
+    0x1A, 0x00, 0x2F, 0x00, 0x05, 0x0F, 0x00, 0x20, 0x0F, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x4F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x6E, 0x0F, 0x42, 0x01, 0x0F, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x9F, 0x90, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x80, 0x04, 0x0F, 0x84, 0x08, 0x4F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x02, 0xC0, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x50, 0x0A, 0x1F,
+    0x41, 0x40, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x0C, 0x9F,
+    0x02, 0x88, 0x1F, 0x00, 0x08, 0x1F, 0x10, 0x40, 0x1F, 0x10, 0x00, 0x1F,
+    0x8E, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F, 0x20, 0x40, 0x1F,
+    0x1E, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x6E, 0x10, 0x7F,
+    0x42, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x90, 0x00, 0x90, 0x7F, 0x00, 0x00, 0x32, 0x7F, 0x00, 0x01, 0x20, 0x7F,
+    0x80, 0x04, 0x08, 0x7F, 0x04, 0x18, 0x08, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x40, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x10, 0x00, 0x00, 0xFF,
+    0x02, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x50, 0x0A, 0x0F,
+    0x41, 0x40, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x80, 0x04, 0x0F,
+    0x82, 0x80, 0x2F, 0x10, 0x06, 0x0F, 0x00, 0x01, 0x0F, 0x90, 0x00, 0x4F,
+    0x87, 0x00, 0x2F, 0x00, 0x20, 0x0F, 0x00, 0x41, 0x0F, 0x20, 0x80, 0x1F,
+    0x1D, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x00, 0x00, 0x0F, 0x00, 0x06, 0x0F, 0x00, 0x08, 0x2F, 0x06, 0x00, 0x2F,
+    0x20, 0x40, 0x0F, 0x40, 0x20, 0x8F, 0x40, 0x00, 0x1F, 0x0A, 0x00, 0x1F,
+    0x91, 0x08, 0x8F, 0x00, 0x03, 0x0F, 0x10, 0x80, 0x0F, 0x80, 0x40, 0x4F,
+    0x00, 0x20, 0x8F, 0x02, 0x15, 0x0F, 0x10, 0x00, 0x0F,
+    // 0x54 'T'
+    0x04, 0x00, 0x1F, 0x22, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x50, 0x1F, 0x0A, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x05, 0x9F, 0x00, 0xA0, 0x1F, 0x0A, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x16, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x55 'U'
+    0x40, 0x17, 0x8F, 0x02, 0x80, 0x4F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x0C, 0x0F, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x02, 0x80, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x0F,
+    0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x56 'V'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x01, 0x20, 0x0F,
+    0x00, 0x05, 0x0F, 0x00, 0x00, 0x2F, 0x1C, 0x00, 0x0F, 0x00, 0x64, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x10, 0x4F, 0x00, 0x40, 0x0F, 0x01, 0x80, 0x0F,
+    0x66, 0x10, 0x0F, 0x18, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x57 'W'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x00, 0x33, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x0F, 0x00, 0x08, 0x2F,
+    0x00, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x60, 0x0F,
+    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x6F, 0x40, 0x00, 0x0F, 0x60, 0xF0, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    0x18, 0x20, 0x0F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x0C, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x10, 0x04, 0x1F, 0x00, 0x08, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x20, 0x06, 0x5F,
+    0x40, 0x01, 0x9F, 0x00, 0x40, 0x1F, 0x68, 0x98, 0x1F, 0x10, 0x06, 0x1F,
+    0x00, 0x01, 0x9F, 0x04, 0x00, 0x1F, 0x08, 0x00, 0x5F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x60, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x41, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x21, 0x00, 0x1F,
+    0x40, 0x05, 0x9F, 0x01, 0x00, 0x1F, 0x60, 0x00, 0x1F, 0x08, 0x80, 0x1F,
+    0x01, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x2F, 0x00, 0x02, 0x0F, 0x10, 0x00, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x41, 0x8F, 0x00, 0x82, 0x0F,
+    0x00, 0x00, 0x0F, 0x02, 0x10, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x8F,
+    0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x60, 0x00, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0xA0, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x40, 0x06, 0x3F, 0x14, 0x00, 0x52, 0x3F,
+    0xC0, 0x06, 0x00, 0xBF, 0x00, 0xA0, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    // 0x5C '\'
+    0x80, 0x00, 0x07, 0xB0, 0x00, 0x07, 0x82, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x30, 0x30, 0x07, 0x00, 0x06, 0x07, 0x01, 0x80, 0x07, 0x00, 0x30, 0x37,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x00, 0x37,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x28, 0x3F, 0x00, 0x03, 0x00, 0x3F,
+    0x80, 0x50, 0x01, 0x3F, 0x05, 0x00, 0x10, 0x3F, 0x00, 0x02, 0x80, 0x3F,
+    0x00, 0x28, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x0F, 0x01, 0x8F, 0x00, 0x0F, 0x30, 0x37, 0xC1, 0x87,
+    0x0C, 0x07, 0x0C, 0x07, 0x80, 0x87, 0x30, 0x07, 0x04, 0x0F, 0x00, 0x0F,
+    0x00, 0x6F, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0x01, 0x81, 0x81, 0x05, 0x03, 0x09,
+    // 0x61 'a'
+    0x00, 0x61, 0x06, 0x0D, 0x10, 0x01, 0x00, 0x03, 0x01, 0x01, 0x0C, 0x11,
+    0x80, 0x05, 0x00, 0x09, 0x20, 0x21, 0x18, 0x01, 0x40, 0x01, 0x00, 0x01,
+    0x81, 0x05, 0xB0, 0x05, 0x80, 0x09, 0x00, 0x01,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x20, 0x01, 0x03, 0x40, 0x08, 0x03, 0x42, 0x80, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x20, 0x03, 0x01, 0xC8, 0x27, 0x44, 0x90, 0x23,
+    0x00, 0x20, 0x4B, 0x01, 0x22, 0x0B, 0x00, 0x00, 0x13, 0x01, 0x00, 0x23,
+    0x01, 0x00, 0x03, 0x00, 0x3A, 0x03,
+    // 0x63 'c'
+    0x00, 0x41, 0x06, 0x01, 0x10, 0x05, 0x00, 0x01, 0x42, 0x03, 0x00, 0x03,
+    0x00, 0x01, 0x80, 0x05, 0x00, 0x05, 0x90, 0x41, 0x00, 0x01, 0x00, 0x01,
+    // 0x64 'd'
+    0x00, 0x00, 0xC3, 0x00, 0x0C, 0x1B, 0x00, 0x20, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x03, 0x00, 0x18, 0x23, 0x01, 0x00, 0x0B, 0x00, 0x00, 0x13,
+    0x00, 0x40, 0x43, 0x40, 0x30, 0x03, 0x01, 0x00, 0x03, 0x18, 0x00, 0x03,
+    0x00, 0x0A, 0x0B, 0x00, 0xA0, 0x0B, 0x4A, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0x65 'e'
+    0x00, 0x41, 0x02, 0x01, 0x10, 0x01, 0x00, 0x01, 0x03, 0x63, 0x10, 0x13,
+    0x22, 0x11, 0x80, 0x05, 0x08, 0x05, 0x82, 0x41, 0x04, 0x11, 0x78, 0x01,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x80, 0x14, 0x0F, 0x00, 0x02, 0x80, 0x4F, 0x01, 0x10, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x50, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F,
+    0x90, 0x40, 0x00, 0x0F, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x67 'g'
+    0x00, 0x03, 0x87, 0x00, 0x04, 0x27, 0x00, 0x04, 0x07, 0x00, 0x09, 0x97,
+    0x01, 0x28, 0x47, 0x00, 0xC0, 0x47, 0x00, 0x04, 0x47, 0x84, 0x00, 0x47,
+    0xA1, 0x42, 0x47, 0x00, 0x50, 0x57, 0x22, 0x01, 0x87, 0x18, 0x00, 0x07,
+    0x80, 0x00, 0x27, 0x00, 0x00, 0x47, 0x84, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x68 'h'
+    0x00, 0x00, 0x13, 0x00, 0x01, 0x03, 0x40, 0x28, 0x03, 0x42, 0x80, 0x03,
+    0x00, 0x00, 0x53, 0x00, 0x03, 0x03, 0x00, 0x48, 0x03, 0x48, 0x00, 0x03,
+    0x00, 0x00, 0xB3, 0x00, 0x0A, 0x03, 0x01, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x03, 0x0B, 0x00, 0x68, 0x03, 0x00, 0x00, 0x33,
+    // 0x69 'i'
+    0x00, 0x00, 0x07, 0x01, 0x80, 0x87, 0x02, 0x90, 0x07, 0x00, 0x40, 0x0F,
+    0x32, 0x00, 0x07, 0x08, 0x02, 0x17, 0x88, 0x60, 0x07, 0x80, 0x00, 0xC7,
+    0x20, 0x00, 0x07,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x5F, 0x01, 0x00, 0x20, 0x1F, 0x00, 0x82, 0x00, 0x9F,
+    0x00, 0xD0, 0x02, 0x1F, 0x32, 0x00, 0x0C, 0x1F, 0x0A, 0x00, 0xA0, 0x1F,
+    0x82, 0x0C, 0x00, 0x1F, 0x81, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x1F,
+    // 0x6B 'k'
+    0x00, 0x00, 0x13, 0x00, 0x01, 0x03, 0x40, 0x28, 0x03, 0x42, 0x80, 0x03,
+    0x00, 0x00, 0xA3, 0x00, 0x04, 0x03, 0x01, 0x90, 0x23, 0x44, 0xA4, 0x03,
+    0x00, 0x05, 0x83, 0x00, 0x4A, 0x43, 0x01, 0x20, 0x07, 0x01, 0x00, 0x03,
+    0x01, 0x08, 0x23, 0x00, 0x40, 0x03,
+    // 0x6C 'l'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x8B, 0x40, 0x28, 0x07, 0x43, 0x00, 0x07,
+    0x00, 0x00, 0x43, 0x00, 0x0A, 0x03, 0x00, 0x80, 0x43, 0x54, 0x00, 0x03,
+    // 0x6D 'm'
+    0x00, 0x01, 0x20, 0x29, 0xA2, 0x81, 0x10, 0x01, 0x80, 0x01, 0x80, 0xA1,
+    0xE2, 0x01, 0x04, 0x01, 0x00, 0x29, 0x02, 0x81, 0x98, 0x01, 0x00, 0x05,
+    0x80, 0xA1, 0x02, 0x01, 0x04, 0x01, 0x10, 0x21, 0x82, 0x01, 0x98, 0x03,
+    0x00, 0x01, 0x80, 0xC1, 0x48, 0x25, 0x00, 0x21, 0x00, 0x01,
+    // 0x6E 'n'
+    0x00, 0x01, 0x20, 0x29, 0xA2, 0x81, 0x10, 0x01, 0x80, 0x01, 0x00, 0x21,
+    0x23, 0x01, 0x04, 0x01, 0x40, 0x01, 0x10, 0x41, 0x14, 0x03, 0x00, 0x01,
+    0x00, 0x41, 0x85, 0x01, 0x20, 0x29, 0x00, 0x11,
+    // 0x6F 'o'
+    0x00, 0x41, 0x00, 0x09, 0x00, 0x05, 0x20, 0x01, 0x02, 0x21, 0x00, 0x03,
+    0x10, 0x11, 0xA0, 0x01, 0x00, 0x61, 0x1E, 0x81, 0x00, 0x09, 0x00, 0x01,
+    0x40, 0x41, 0x1E, 0x01,
+    // 0x70 'p'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x20, 0x02, 0x8F, 0x20, 0x28, 0x0F,
+    0x23, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x06, 0x4F, 0x80, 0x50, 0x0F,
+    0x80, 0x12, 0x2F, 0x08, 0x00, 0x0F, 0x50, 0x20, 0x0F, 0x00, 0xC0, 0x0F,
+    0x92, 0x08, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x20, 0x0F, 0x01, 0x80, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x71 'q'
+    0x00, 0x60, 0x0F, 0x06, 0x04, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x01, 0x40, 0x2F, 0x0C, 0x10, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x09, 0x4F,
+    0x20, 0x30, 0x0F, 0x18, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x2C, 0x0F,
+    0x81, 0x00, 0x2F, 0xB0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x72 'r'
+    0x00, 0x03, 0x20, 0x17, 0xA1, 0x03, 0x08, 0x03, 0x80, 0x07, 0x00, 0x13,
+    0x29, 0x83, 0x24, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x40, 0x03,
+    // 0x73 's'
+    0x00, 0x01, 0x00, 0x29, 0x00, 0x41, 0x22, 0x41, 0x40, 0x01, 0x00, 0x03,
+    0x18, 0x91, 0xA0, 0x41, 0x20, 0x05, 0x02, 0x09, 0x91, 0x81, 0x70, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x08, 0x07, 0x3F, 0x00, 0xA0, 0xBF, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x7F, 0x80, 0x10, 0x3F, 0x02, 0x80, 0x3F, 0x50, 0x04, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x09, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x20, 0x01, 0x20, 0xAD, 0x26, 0x01, 0x80, 0x03, 0x80, 0x21, 0x82, 0x11,
+    0x68, 0x25, 0x00, 0x41, 0x00, 0x11, 0x00, 0x21, 0x50, 0x01, 0x00, 0x01,
+    0x80, 0x81, 0x94, 0x25, 0x40, 0x09, 0x00, 0x31,
+    // 0x76 'v'
+    0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x85, 0x81, 0x80, 0x05, 0x00, 0x01,
+    0x2C, 0x05, 0x00, 0x01, 0x01, 0x91, 0x18, 0x21, 0x80, 0x41, 0x01, 0x01,
+    0x84, 0x01, 0x20, 0x01,
+    // 0x77 'w'
+    0x40, 0x01, 0x20, 0x01, 0x00, 0x01, 0x82, 0x01, 0x80, 0x05, 0x40, 0x01,
+    0x14, 0x05, 0x00, 0x09, 0x40, 0x01, 0xA4, 0x21, 0x00, 0x69, 0x00, 0x01,
+    0x60, 0x01, 0x06, 0x01, 0x00, 0x81, 0x64, 0x11, 0x80, 0x41, 0x00, 0x81,
+    0x06, 0x01, 0x30, 0x01,
+    // 0x78 'x'
+    0x00, 0x09, 0x00, 0x21, 0x60, 0x03, 0x00, 0x01, 0x00, 0x25, 0x80, 0x49,
+    0x81, 0x01, 0x80, 0x01, 0x30, 0x09, 0x10, 0x05, 0x03, 0x03, 0x40, 0x61,
+    0x00, 0x01, 0x00, 0x15, 0x10, 0x01, 0x20, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x87, 0x00, 0x00, 0x87, 0x85, 0x03, 0x27,
+    0x80, 0x00, 0x47, 0x00, 0x00, 0x87, 0x2C, 0x01, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x08, 0x07, 0x1A, 0x00, 0x07, 0x80, 0x40, 0x07, 0x01, 0x80, 0x07,
+    0x86, 0x00, 0x07, 0x20, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x09, 0x00, 0x01, 0x10, 0x21, 0x00, 0x45, 0x88, 0x81, 0x91, 0x25,
+    0x92, 0x05, 0x80, 0x01, 0x00, 0x01, 0x02, 0x03, 0xC4, 0x01, 0x08, 0x01,
+    0x90, 0x29, 0x20, 0x01,
+    // 0x7B '{'
+    0x00, 0x00, 0x16, 0x3F, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x06, 0x40, 0x18, 0x7F, 0x30, 0x00, 0xC0, 0x7F, 0x40, 0x10, 0x00, 0x3F,
+    0x04, 0x40, 0x01, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x80, 0x00, 0x50, 0x00,
+    0x0A, 0x00, 0x28, 0xA0, 0x02, 0x80, 0x00, 0x50, 0x00, 0x0A, 0x00, 0x00,
+    0x40, 0x00, 0x00,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x3F, 0x60, 0x01, 0x70, 0xBF,
+    0x00, 0x32, 0x01, 0x3F, 0x81, 0x84, 0x04, 0x3F, 0x88, 0x01, 0x60, 0x3F,
+    0x00, 0x32, 0x00, 0x3F, 0x00, 0x8A, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x03, 0x03, 0x43, 0x03, 0x13, 0x03, 0x03, 0x03, 0x23, 0x07, 0x03, 0x03,
+    0x4B, 0x23,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x00, 0x18, 0x07,
+    0x11, 0x00, 0x17, 0x80, 0x00, 0x07, 0x84, 0x12, 0x07, 0x90, 0x00, 0x07,
+    0x20, 0x00, 0x07,
+    // 0xA2 '¢'
+    0x00, 0x0E, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x01, 0x00, 0x20, 0xFF, 0x00, 0x33, 0x04, 0xFF, 0x00, 0x41, 0x00, 0xFF,
+    0x00, 0x94, 0x04, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x28, 0x14, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x44, 0x82, 0x40, 0x7F,
+    0x04, 0x80, 0x80, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x40, 0x1F,
+    0x00, 0x4C, 0x2F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x04, 0x8F,
+    0x00, 0x10, 0xAF, 0x02, 0x40, 0x8F, 0x08, 0x40, 0x8F, 0x50, 0x40, 0x8F,
+    0x00, 0x00, 0x0F, 0x10, 0x20, 0x0F, 0x02, 0x01, 0x0F, 0x02, 0x00, 0x4F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x37, 0x00, 0x07, 0x81, 0x97, 0x80, 0x27, 0x40, 0x27, 0x04, 0x07,
+    0x48, 0x17, 0x50, 0x17, 0x00, 0x87, 0x10, 0x27, 0x4A, 0x07, 0x40, 0x17,
+    0x41, 0xC7, 0x0C, 0x07, 0xA0, 0x07, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x80, 0x00, 0x3F, 0xA0, 0x70, 0x3F, 0x8C, 0x60, 0x3F, 0x81, 0x61, 0x3F,
+    0x80, 0x68, 0x3F, 0x80, 0x00, 0x3F, 0xA2, 0x00, 0x3F, 0x80, 0x03, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x60, 0x3F, 0x80, 0x20, 0x3F, 0xA2, 0x20, 0x3F,
+    0x84, 0x20, 0x3F, 0x89, 0x80, 0x3F, 0x90, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x0C, 0x61, 0x17, 0x10, 0x01, 0x87,
+    0x20, 0x00, 0x4F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x11, 0x07,
+    0xA2, 0x40, 0x17, 0x20, 0x24, 0x27, 0x80, 0x80, 0x47, 0x08, 0x00, 0x07,
+    0x10, 0x02, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x01, 0x08, 0x0F, 0x14, 0x00, 0x8F,
+    0x00, 0x01, 0x4F, 0x00, 0x70, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x02, 0x0F,
+    0x20, 0x08, 0x1F, 0x8A, 0x01, 0x1F, 0x88, 0x01, 0x0F, 0xA8, 0x00, 0x1F,
+    0x00, 0x80, 0x4F, 0x45, 0x06, 0x4F, 0x50, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    // 0xAA 'ª'
+    0x00, 0x07, 0x10, 0x07, 0x20, 0x07, 0x45, 0x07, 0x91, 0x07, 0x02, 0x87,
+    0xB8, 0x47, 0x00, 0x07, 0x8C, 0x6F, 0xE2, 0x87, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x04, 0x1F, 0x09, 0x1F,
+    0x10, 0xDF, 0x86, 0x1F, 0x41, 0x1F, 0x00, 0x1F, 0x20, 0x5F, 0x06, 0x1F,
+    0x81, 0x1F, 0x00, 0x5F, 0x40, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x02, 0x09, 0x30, 0x05, 0x48, 0x0D, 0x40, 0x01,
+    0x00, 0x03, 0x00, 0xA5, 0x06, 0x27, 0x01, 0x81, 0x00, 0x01, 0x10, 0x15,
+    0x00, 0x61, 0x00, 0x31, 0x03, 0x81,
+    // 0xB0 '°'
+    0x1E, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x40, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x0A, 0x5F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0xB1 '±'
+    0x02, 0x07, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F,
+    0x79, 0xF4, 0x7F, 0x80, 0x0C, 0x7F, 0x80, 0x0C, 0x7F, 0x00, 0x04, 0x7F,
+    0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x01, 0x04, 0x7F, 0x04, 0x04, 0x7F,
+    // 0xB2 '²'
+    0x00, 0x07, 0x00, 0x07, 0x38, 0x4F, 0x48, 0x0F, 0x11, 0x0F, 0x02, 0x4F,
+    0xA4, 0x0F, 0x91, 0x0F, 0x00, 0x0F, 0x04, 0x27, 0x28, 0x07,
+    // 0xB3 '³'
+    0x00, 0x2F, 0x00, 0x2F, 0x03, 0x2F, 0x51, 0x07, 0x00, 0x0F, 0xA1, 0x47,
+    0x98, 0x07, 0x02, 0x27, 0x09, 0x47, 0x00, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x47, 0x00, 0x04, 0x07, 0x00, 0xA0, 0x07, 0x28, 0x00, 0x37,
+    0x80, 0x02, 0x07, 0x80, 0x00, 0x07, 0x8A, 0x02, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x48, 0x07, 0x0A, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x82, 0xE2, 0x07, 0x30, 0x00, 0x07, 0x00, 0x24, 0x07,
+    0x00, 0x38, 0x07,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x06, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x20, 0x01, 0x45, 0x00, 0x08, 0x05,
+    0x00, 0x00, 0xC1, 0x40, 0x14, 0x49, 0x00, 0x85, 0x11, 0x09, 0xA0, 0x21,
+    0x08, 0x05, 0x01, 0x00, 0xA0, 0x01, 0x14, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xB7 '·'
+    0x07, 0x0F, 0x8F, 0x87, 0x17, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x17, 0x00, 0x2F, 0x10, 0x2F, 0x02, 0x8F, 0x40, 0x0F, 0x00, 0x0F,
+    0x85, 0x0F, 0x60, 0x07,
+    // 0xBA 'º'
+    0x00, 0x07, 0x0E, 0x07, 0x20, 0x07, 0x40, 0x07, 0x19, 0x07, 0xA0, 0x07,
+    0x20, 0x07, 0x88, 0xAF, 0x01, 0x37, 0x26, 0x07,
+    // 0xBB '»'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x5F, 0x88, 0x1F, 0x00, 0x9F,
+    0x01, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0xA0, 0x1F, 0x18, 0x1F, 0x00, 0x9F,
+    0x00, 0x1F, 0x00, 0x1F, 0x0C, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x18, 0x14, 0x03, 0x00, 0xA4, 0x03,
+    0x24, 0x04, 0x03, 0x20, 0x04, 0x03, 0x00, 0x84, 0x03, 0x08, 0x00, 0x23,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x13, 0x00, 0x02, 0x23, 0x00, 0x08, 0x83,
+    0x00, 0x01, 0x03, 0x00, 0x24, 0x03, 0x00, 0x80, 0x03, 0x01, 0x00, 0x03,
+    0x04, 0x40, 0x03, 0x00, 0x00, 0x43, 0x21, 0x00, 0x43, 0x04, 0x00, 0x43,
+    0x40, 0x01, 0x43, 0x30, 0x01, 0x23, 0x00, 0x08, 0x03, 0x00, 0x80, 0x23,
+    0x00, 0x80, 0x43, 0x00, 0xD1, 0x03, 0x00, 0x00, 0x03,
+    // 0xBD '½'
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x18, 0x14, 0x03, 0x00, 0xA4, 0x03,
+    0x24, 0x04, 0x03, 0x20, 0x04, 0x13, 0x00, 0x84, 0x07, 0x08, 0x00, 0x83,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x23, 0x00, 0x08, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x24, 0x03, 0x00, 0x08, 0x03, 0x01, 0x20, 0x03, 0x04, 0x00, 0x03,
+    0x08, 0x80, 0x23, 0x20, 0x10, 0x43, 0x44, 0x48, 0x03, 0x08, 0x11, 0x03,
+    0x20, 0x82, 0x43, 0x00, 0x80, 0x03, 0x00, 0x89, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x60, 0x03,
+    // 0xBE '¾'
+    0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x11, 0x80, 0x03, 0x25, 0x10, 0x03,
+    0x28, 0x04, 0x03, 0x00, 0x64, 0x03, 0x00, 0x00, 0x1B, 0x20, 0x00, 0x47,
+    0x02, 0xA0, 0x0B, 0x00, 0x01, 0x13, 0x00, 0x04, 0x43, 0x00, 0x00, 0x03,
+    0x00, 0x12, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03, 0x02, 0x20, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x43, 0x02, 0x00, 0x43, 0x40, 0x00, 0x43,
+    0x08, 0x01, 0x43, 0x00, 0x01, 0x23, 0x00, 0x08, 0x03, 0x00, 0x80, 0x23,
+    0x00, 0x80, 0x43, 0x00, 0xD1, 0x03, 0x00, 0x00, 0x03,
+    // 0xBF '¿'
+    0x00, 0x07, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x0F, 0x00, 0x07, 0x1F,
+    0x10, 0x00, 0x0F, 0x84, 0x80, 0x1F, 0x84, 0x20, 0x0F, 0x90, 0x01, 0x2F,
+    0x21, 0x00, 0x0F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x3F,
+    0x30, 0x08, 0x00, 0x3F, 0x08, 0x01, 0x00, 0x3F, 0x48, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x01, 0x00, 0xA0, 0x3F, 0x10, 0x00, 0x01, 0x3F,
+    0x0C, 0xA0, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x28, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x08, 0x04, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0xBF, 0x01, 0x00, 0xA0, 0x3F, 0x24, 0x00, 0x01, 0x3F,
+    0x00, 0xA0, 0x00, 0x3F, 0x08, 0x05, 0x00, 0x3F, 0x10, 0x00, 0x28, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x10, 0x01, 0x00, 0x3F, 0x24, 0x04, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0xBF, 0x01, 0x00, 0xA0, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0xA0, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x14, 0x00, 0x28, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x08, 0x00, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x08, 0x02, 0x00, 0x7F, 0x10, 0x08, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x02, 0x01, 0x40, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x01, 0x40, 0x00, 0x7F, 0x80, 0x0A, 0x00, 0x7F, 0x20, 0x00, 0x50, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x13,
+    0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x90, 0x04, 0x00, 0x00, 0x10, 0x00,
+    0x20, 0x00, 0x02, 0x04, 0x02, 0x80, 0x30, 0x00, 0x04, 0x92, 0x80, 0x00,
+    0x00, 0x14, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x1C, 0x01, 0x00, 0x3F, 0x42, 0x04, 0x00, 0x3F,
+    0xB0, 0x00, 0x00, 0xBF, 0x23, 0x00, 0xA0, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0xA0, 0x00, 0x3F, 0x68, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x28, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x02, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x84, 0x1F, 0x02, 0x34, 0x5F, 0x64, 0x54, 0x1F,
+    0x20, 0x15, 0x9F, 0x12, 0x00, 0x1F, 0x05, 0x80, 0x1F, 0x08, 0x00, 0x1F,
+    0x00, 0x05, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x80, 0x1F, 0x10, 0x80, 0x1F,
+    0x10, 0x80, 0x9F, 0x00, 0x81, 0x1F, 0x00, 0xA0, 0x1F, 0x0C, 0x00, 0x1F,
+    0x00, 0x02, 0x1F, 0x0C, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x06, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x48, 0x00, 0xFF,
+    0x02, 0x00, 0x08, 0x7F, 0x00, 0x01, 0x18, 0x3F, 0x08, 0x00, 0x18, 0xBF,
+    0x90, 0x00, 0x09, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x20, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x9A, 0x00, 0x40, 0x3F, 0x02, 0x04, 0x80, 0x3F,
+    0x42, 0x00, 0x00, 0x3F, 0x68, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x29, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x08, 0x31, 0x00, 0x3F, 0x00, 0x21, 0x00, 0x3F, 0x20, 0x01, 0x01, 0x3F,
+    0x00, 0x01, 0x04, 0x3F, 0x0C, 0x01, 0x00, 0x3F, 0x00, 0x04, 0x01, 0xBF,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x29, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x04, 0x31, 0x00, 0x3F, 0x10, 0x21, 0x00, 0x3F, 0x04, 0x01, 0x01, 0x3F,
+    0x04, 0x01, 0x04, 0x3F, 0x40, 0x01, 0x00, 0x3F, 0x00, 0x04, 0x01, 0xBF,
+    0x10, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x29, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x31, 0x00, 0x3F, 0x20, 0x21, 0x00, 0x3F, 0x48, 0x01, 0x01, 0x3F,
+    0x10, 0x01, 0x04, 0x3F, 0x08, 0x01, 0x00, 0x3F, 0x04, 0x04, 0x01, 0xBF,
+    0x10, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x50,
+    0x00, 0x0A, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xA4,
+    0x10, 0x10, 0x00, 0x00, 0xC4, 0x00, 0x80, 0x84, 0x00, 0x40, 0x04, 0x04,
+    0x40, 0x04, 0x10, 0x00, 0x04, 0x00, 0x10, 0x10, 0x06, 0x00, 0x10, 0x00,
+    0x40, 0x60, 0x00, 0x00, 0x00, 0x00,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x10, 0x00, 0x80, 0x3F, 0x08, 0x08, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x14, 0x3F, 0x00, 0x02, 0x80, 0xBF,
+    0x10, 0x30, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x14, 0x3F, 0x00, 0x02, 0x80, 0xBF,
+    0x24, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x40, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x10, 0x08, 0x00, 0x3F,
+    0x24, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x14, 0x3F, 0x00, 0x02, 0x80, 0xBF,
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x14, 0x00, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x50,
+    0x50, 0x02, 0x00, 0x90, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x0A, 0x02, 0x30, 0xC0, 0x00, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x6F, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x8F, 0x50, 0x0A, 0x0F,
+    0x41, 0x00, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x14, 0x0F,
+    0x02, 0x80, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x00, 0x41, 0x0F,
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x04, 0x18, 0x4F, 0x40, 0x00, 0x0F,
+    0x20, 0x01, 0x0F, 0x10, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x80, 0x28, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x28, 0x3F, 0x00, 0x05, 0x01, 0x3F, 0x00, 0x06, 0x00, 0x3F,
+    0x41, 0x00, 0x00, 0x3F, 0x08, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x10, 0x04, 0x03, 0x3F, 0x40, 0x01, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x48, 0x01, 0x80, 0x3F, 0x80, 0x68, 0x00, 0xBF, 0x40, 0x00, 0x14, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x28, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0xDC, 0x1F,
+    0x00, 0x84, 0x02, 0x1F, 0x20, 0x80, 0x00, 0x3F, 0x48, 0x00, 0x01, 0x3F,
+    0x49, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x5F,
+    0x01, 0x00, 0x08, 0x1F, 0x01, 0x08, 0x10, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x05, 0x80, 0x1F,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0xDC, 0x1F,
+    0x00, 0x84, 0x02, 0x1F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x09, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x25, 0x00, 0x08, 0x1F, 0x41, 0x08, 0x10, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x60, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x05, 0x80, 0x1F,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0xDC, 0x1F,
+    0x00, 0x84, 0x02, 0x1F, 0x08, 0x80, 0x00, 0x3F, 0x10, 0x00, 0x01, 0x3F,
+    0x05, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x11, 0x00, 0x08, 0x1F, 0x49, 0x08, 0x10, 0x9F, 0x20, 0x00, 0x00, 0x1F,
+    0x04, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x05, 0x80, 0x1F,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x81, 0xB8, 0x3F,
+    0x01, 0x08, 0x04, 0x3F, 0x01, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x02, 0x7F,
+    0x92, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x42, 0x00, 0x10, 0x3F, 0x02, 0x10, 0x21, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x11, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x0B, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x03, 0x70, 0x7F,
+    0x02, 0x10, 0x08, 0x7F, 0x32, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x04, 0xFF,
+    0x04, 0x80, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x24, 0x00, 0x20, 0x7F, 0x14, 0x20, 0x42, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x82, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x16, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x02, 0x2F, 0x00, 0x4F, 0x10, 0x8F,
+    0x10, 0x0F, 0x20, 0x0F, 0x46, 0x2F, 0x09, 0x1F, 0x50, 0xAF, 0x20, 0x4F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x80, 0x8F, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x21, 0x80, 0x0F, 0x40, 0x11, 0x0F,
+    0x48, 0x24, 0x1F, 0x00, 0x48, 0x9F, 0x90, 0x90, 0x0F, 0x01, 0x20, 0x0F,
+    0x00, 0x40, 0x2F, 0x80, 0x02, 0x0F, 0x08, 0x10, 0x4F, 0x01, 0x80, 0x0F,
+    0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x58, 0x00, 0x0F, 0xA3, 0xC0, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0x80, 0x2F, 0x1F, 0x00, 0x05, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x05, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x08, 0xC0, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x0C, 0x05, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x40, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDA 'Ú'
+    0x00, 0x80, 0x2F, 0x1F, 0x00, 0x05, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x05, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x04, 0xC0, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x24, 0x00, 0x20, 0x1F,
+    0x40, 0x05, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x60, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x40, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDB 'Û'
+    0x00, 0x80, 0x2F, 0x1F, 0x00, 0x05, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x05, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x04, 0xC0, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x20, 0x1F,
+    0x48, 0x05, 0x00, 0x1F, 0x20, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x40, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0xDC 'Ü'
+    0x02, 0x00, 0xBC, 0x7F, 0x00, 0x14, 0x02, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F, 0x00, 0x14, 0x00, 0xFF,
+    0x20, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x80, 0x7F,
+    0x10, 0x14, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x40, 0x05, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x10, 0x1F,
+    0x01, 0x45, 0x1F, 0x08, 0x01, 0x1F, 0x02, 0x00, 0x1F, 0x01, 0x02, 0x1F,
+    0x08, 0xC2, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x28, 0x2F, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x40, 0x01, 0x8F,
+    0x06, 0x00, 0x08, 0x0F, 0x10, 0x01, 0x40, 0x0F, 0x20, 0x10, 0x00, 0x0F,
+    0x02, 0x80, 0x08, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x28, 0x24, 0x0F,
+    0x80, 0x80, 0x00, 0x0F, 0x81, 0x01, 0x00, 0x0F, 0x90, 0x70, 0x48, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x04, 0x10, 0x0F, 0x18, 0x00, 0x80, 0x0F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x61, 0x00, 0x06, 0x0D, 0x00, 0x10, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x01, 0x00, 0x0C, 0x11, 0x50, 0x80, 0x05, 0x00, 0x00, 0x09,
+    0x04, 0x20, 0x21, 0x20, 0x18, 0x01, 0x0A, 0x40, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x81, 0x05, 0x00, 0xB0, 0x05, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0xE1 'á'
+    0x00, 0x00, 0x30, 0x00, 0x03, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x80, 0x00, 0x06, 0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x04,
+    0x00, 0x10, 0x10, 0x00, 0x0C, 0x00, 0x22, 0x20, 0x00, 0x04, 0x00, 0x00,
+    0x40, 0x40, 0x82, 0x20, 0x58, 0x02, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0xE2 'â'
+    0x00, 0x00, 0x61, 0x00, 0x06, 0x0D, 0x00, 0x10, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x01, 0x00, 0x0C, 0x11, 0x02, 0x80, 0x05, 0x24, 0x00, 0x09,
+    0x08, 0x20, 0x21, 0x10, 0x18, 0x01, 0x88, 0x40, 0x01, 0x44, 0x00, 0x01,
+    0x32, 0x81, 0x05, 0x04, 0xB0, 0x05, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0xE3 'ã'
+    0x00, 0x00, 0xC3, 0x00, 0x0C, 0x1B, 0x00, 0x20, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x03, 0x10, 0x18, 0x23, 0x41, 0x00, 0x0B, 0x90, 0x00, 0x13,
+    0x80, 0x40, 0x43, 0x08, 0x30, 0x03, 0x00, 0x80, 0x03, 0x20, 0x00, 0x03,
+    0x09, 0x02, 0x0B, 0x11, 0x60, 0x0B, 0x01, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0xE4 'ä'
+    0x00, 0x01, 0x87, 0x00, 0x18, 0x37, 0x00, 0x40, 0x07, 0x00, 0x00, 0x0F,
+    0x00, 0x04, 0x07, 0x20, 0x30, 0x47, 0x12, 0x00, 0x17, 0x80, 0x00, 0x27,
+    0x20, 0x80, 0x87, 0x00, 0x60, 0x07, 0x31, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x82, 0x04, 0x17, 0x22, 0xC0, 0x17, 0x02, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0xE5 'å'
+    0x00, 0x00, 0x61, 0x00, 0x06, 0x0D, 0x00, 0x10, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x01, 0x00, 0x0C, 0x11, 0x3C, 0x80, 0x05, 0x42, 0x00, 0x09,
+    0xB2, 0x20, 0x21, 0x80, 0x18, 0x01, 0xAA, 0x40, 0x01, 0x80, 0x00, 0x01,
+    0x08, 0x81, 0x05, 0x00, 0xB0, 0x05, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0xE6 'æ'
+    0x00, 0x61, 0x06, 0x09, 0x10, 0x01, 0x00, 0x03, 0x01, 0x01, 0x0C, 0x11,
+    0x00, 0x05, 0x80, 0x49, 0x20, 0x11, 0x80, 0x01, 0x10, 0x01, 0x00, 0x01,
+    0x07, 0x61, 0x10, 0x13, 0x22, 0x91, 0x80, 0x05, 0x08, 0x05, 0x80, 0x49,
+    0x04, 0x11, 0x38, 0x01,
+    // 0xE7 'ç'
+    0x00, 0x40, 0x07, 0x06, 0x00, 0x07, 0x10, 0x04, 0x1F, 0x00, 0x01, 0x0F,
+    0x42, 0x03, 0x0F, 0x00, 0x03, 0x17, 0x00, 0x01, 0x07, 0x80, 0x04, 0x07,
+    0x00, 0x04, 0x07, 0x90, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x00, 0x41, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x63, 0x50, 0x10, 0x13, 0x08, 0x22, 0x11, 0x04, 0x80, 0x05,
+    0x20, 0x08, 0x05, 0x0A, 0x82, 0x41, 0x00, 0x04, 0x11, 0x00, 0x78, 0x01,
+    // 0xE9 'é'
+    0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xB1, 0x00, 0x08, 0x09, 0x00, 0x11, 0x08, 0x00, 0x40, 0x02,
+    0x00, 0x04, 0x02, 0x22, 0x41, 0x20, 0x04, 0x02, 0x08, 0x48, 0x3C, 0x00,
+    0x20, 0x00, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x41, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x63, 0x12, 0x10, 0x13, 0x24, 0x22, 0x11, 0x48, 0x80, 0x05,
+    0x10, 0x08, 0x05, 0x88, 0x82, 0x41, 0x44, 0x04, 0x11, 0x30, 0x78, 0x01,
+    0x04, 0x00, 0x01,
+    // 0xEB 'ë'
+    0x00, 0x01, 0x07, 0x00, 0x08, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x30, 0x0D, 0x8F, 0x10, 0x40, 0x4F, 0x80, 0x88, 0x47, 0x22, 0x00, 0x17,
+    0x00, 0x20, 0x17, 0x32, 0x09, 0x07, 0x10, 0x10, 0x47, 0x81, 0xE0, 0x07,
+    0x20, 0x00, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x21, 0x20, 0xA4, 0x01, 0x00, 0x10, 0x03,
+    0x08, 0x80, 0x01, 0x40, 0x00, 0x85, 0x12, 0x18, 0x01, 0x04, 0x00, 0x31,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x00, 0x52, 0x00, 0x00, 0x08, 0x01,
+    0x00, 0x40, 0x00, 0x06, 0x00, 0x42, 0x08, 0x0C, 0x00, 0x20, 0x00, 0x18,
+    0x44, 0x00, 0x00, 0x48, 0x00, 0x00, 0x10, 0x00, 0x00,
+    // 0xEE 'î'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x21, 0x0A, 0xA4, 0x01, 0x12, 0x10, 0x03,
+    0x00, 0x80, 0x01, 0x40, 0x00, 0x85, 0x00, 0x18, 0x01, 0x80, 0x00, 0x31,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x07, 0x01, 0x80, 0x87, 0x52, 0x90, 0x07, 0x10, 0x40, 0x0F,
+    0x82, 0x00, 0x07, 0xC0, 0x02, 0x17, 0x00, 0x60, 0x07, 0x50, 0x00, 0xC7,
+    0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x13, 0x00, 0x20, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x85, 0x43, 0x00, 0x10, 0x27, 0x01, 0x20, 0x27, 0x90, 0x00, 0x03,
+    0x00, 0x00, 0x0B, 0x01, 0x23, 0x03, 0x40, 0x00, 0x13, 0xB0, 0x00, 0x03,
+    0x06, 0x01, 0x83, 0x00, 0x84, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x53, 0x01, 0x45, 0x03, 0x00, 0x20, 0x03,
+    0x01, 0x00, 0x03, 0x10, 0x00, 0x43, 0x40, 0x46, 0x03, 0x90, 0x08, 0x03,
+    0x80, 0x80, 0x03, 0x08, 0x20, 0x83, 0x08, 0x28, 0x07, 0x20, 0x00, 0x03,
+    0x08, 0x00, 0x83, 0x11, 0x0A, 0x03, 0x00, 0x40, 0x53, 0x00, 0x00, 0x23,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x02, 0x21, 0x00, 0x00, 0x03, 0x40, 0x10, 0x11, 0x00, 0xA0, 0x01,
+    0x44, 0x00, 0x61, 0x20, 0x1E, 0x81, 0x0A, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x40, 0x41, 0x00, 0x1E, 0x01,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+    0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x00, 0x08, 0x08, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x0F, 0x40, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x30, 0x0F, 0x00,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x02, 0x21, 0x04, 0x00, 0x03, 0x02, 0x10, 0x11, 0x20, 0xA0, 0x01,
+    0x08, 0x00, 0x61, 0x10, 0x1E, 0x81, 0x88, 0x00, 0x09, 0x44, 0x00, 0x01,
+    0x22, 0x40, 0x41, 0x0C, 0x1E, 0x01,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x00, 0x40, 0x03,
+    0x00, 0x04, 0x43, 0x20, 0x00, 0x07, 0x40, 0x20, 0x23, 0x01, 0x40, 0x03,
+    0x80, 0x00, 0xC3, 0x00, 0x3D, 0x03, 0x00, 0x00, 0x13, 0x28, 0x00, 0x03,
+    0x48, 0x80, 0x83, 0x00, 0x3C, 0x03, 0x00, 0x00, 0x03,
+    // 0xF6 'ö'
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x17, 0x00, 0x80, 0x07,
+    0x00, 0x08, 0x87, 0x40, 0x00, 0x0F, 0x10, 0x40, 0x47, 0x82, 0x80, 0x07,
+    0x20, 0x01, 0x87, 0x00, 0x7A, 0x07, 0x20, 0x00, 0x27, 0x10, 0x00, 0x07,
+    0x81, 0x01, 0x07, 0x20, 0x78, 0x07, 0x00, 0x00, 0x07,
+    // 0xF7 '÷'
+    0x07, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x71, 0x27, 0x01, 0x07,
+    0x81, 0x87, 0x91, 0x47, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x02, 0x10, 0x00,
+    0x00, 0xD0, 0x00, 0xA9, 0x09, 0x48, 0x50, 0x08, 0x10, 0x10, 0x01, 0xC0,
+    0x00, 0x04, 0x00, 0x00, 0x20, 0x20, 0x07, 0x00, 0x60, 0x00, 0x00, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0xAD, 0x00, 0x26, 0x01, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x21, 0x20, 0x82, 0x11, 0x00, 0x68, 0x25, 0x08, 0x00, 0x41,
+    0x40, 0x00, 0x11, 0x02, 0x00, 0x21, 0x04, 0x50, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x80, 0x81, 0x00, 0x94, 0x25, 0x00, 0x40, 0x09, 0x00, 0x00, 0x31,
+    // 0xFA 'ú'
+    0x00, 0x10, 0x00, 0x00, 0x10, 0x56, 0x00, 0x13, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x40, 0x10, 0x00, 0x41, 0x08, 0x00, 0x34, 0x12, 0x00, 0x00, 0x20,
+    0x06, 0x00, 0x08, 0x08, 0x00, 0x10, 0x20, 0x28, 0x00, 0x44, 0x00, 0x00,
+    0x48, 0x40, 0x40, 0x10, 0x4A, 0x12, 0x00, 0x20, 0x04, 0x00, 0x00, 0x18,
+    // 0xFB 'û'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0xAD, 0x00, 0x26, 0x01, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x21, 0x0A, 0x82, 0x11, 0x12, 0x68, 0x25, 0x04, 0x00, 0x41,
+    0x40, 0x00, 0x11, 0x00, 0x00, 0x21, 0x80, 0x50, 0x01, 0x02, 0x00, 0x01,
+    0x10, 0x80, 0x81, 0x00, 0x94, 0x25, 0x00, 0x40, 0x09, 0x00, 0x00, 0x31,
+    // 0xFC 'ü'
+    0x00, 0x80, 0x07, 0x00, 0x82, 0xB7, 0x00, 0x98, 0x07, 0x02, 0x00, 0x0F,
+    0x02, 0x00, 0x87, 0x52, 0x08, 0x47, 0x11, 0xA0, 0x97, 0x80, 0x01, 0x07,
+    0xC0, 0x00, 0x47, 0x00, 0x00, 0x87, 0x51, 0x40, 0x07, 0x90, 0x00, 0x07,
+    0x82, 0x02, 0x07, 0xC2, 0x50, 0x97, 0x01, 0x00, 0x27, 0x00, 0x00, 0xC7,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x14, 0x1F, 0x30, 0x00, 0x80, 0x1F, 0x40, 0x28, 0x00, 0x1F,
+    0x45, 0x00, 0x05, 0x1F, 0x00, 0x00, 0x48, 0x1F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0xC0, 0x24, 0x1F, 0x54, 0x90, 0x20, 0x1F, 0x00, 0x20, 0x48, 0x1F,
+    0x01, 0x23, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x01, 0x00, 0x20, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x02, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x42, 0x14, 0x0C, 0x9F, 0x92, 0x00, 0x01, 0x1F,
+    0x80, 0x00, 0x02, 0x1F, 0x80, 0xB0, 0x04, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x40, 0x00, 0x20, 0x1F, 0x90, 0x68, 0x00, 0x1F, 0x82, 0x01, 0x00, 0x1F,
+    0x80, 0x06, 0x00, 0x1F, 0x02, 0x18, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x02, 0x60, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x80, 0x50, 0x01, 0x7F, 0x00, 0x00, 0x80, 0xFF,
+    0x50, 0x00, 0x00, 0x7F, 0x02, 0x80, 0x10, 0x7F, 0x00, 0x14, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x105 'ą'
+    0x00, 0x60, 0x0F, 0x06, 0x0C, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x01, 0x00, 0x0F, 0x0C, 0x10, 0x0F, 0x80, 0x04, 0x0F, 0x00, 0x08, 0x0F,
+    0x20, 0x20, 0x0F, 0x18, 0x01, 0x2F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0xCF,
+    0x81, 0x02, 0x5F, 0xB0, 0x04, 0x6F, 0x80, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x90, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x05, 0x20, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F,
+    0x04, 0x00, 0x00, 0x5F, 0x41, 0x34, 0x00, 0x9F, 0x00, 0x04, 0x09, 0x1F,
+    0x30, 0x84, 0x00, 0x1F, 0x00, 0xD0, 0x00, 0x1F,
+    // 0x107 'ć'
+    0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02,
+    0x00, 0x00, 0x02, 0x22, 0x48, 0x20, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x20, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x90, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x40, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x05, 0x20, 0x00, 0x1F, 0x21, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F,
+    0x04, 0x00, 0x00, 0x5F, 0x01, 0x34, 0x00, 0x9F, 0x40, 0x04, 0x09, 0x1F,
+    0x00, 0x84, 0x00, 0x1F, 0x60, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x00, 0x41, 0x00, 0x06, 0x01, 0x00, 0x10, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x42, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x20, 0x80, 0x05,
+    0x00, 0x00, 0x05, 0x04, 0x90, 0x41, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0xA0, 0x14, 0x1F, 0x00, 0x82, 0x80, 0x1F, 0x00, 0x30, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x28, 0x1F, 0x50, 0x05, 0x01, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x04, 0x20, 0x00, 0x1F, 0x10, 0x00, 0x02, 0x1F,
+    0x01, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x1F, 0x40, 0x08, 0x30, 0x9F,
+    0x00, 0x80, 0x00, 0x1F, 0x20, 0x40, 0x02, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0xC3, 0x00, 0x0C, 0x1B, 0x00, 0x20, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x03, 0x00, 0x18, 0x23, 0x01, 0x00, 0x0B, 0x00, 0x00, 0x13,
+    0x00, 0x40, 0x43, 0x40, 0x30, 0x03, 0x01, 0x00, 0x03, 0x18, 0x00, 0x03,
+    0x00, 0x0A, 0x0B, 0x00, 0xA0, 0x0B, 0x4A, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x28, 0x00, 0x03, 0x02, 0x00, 0x03, 0x08, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x20, 0x0A, 0x00, 0x7F, 0x01, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x14, 0x80, 0x7F, 0x02, 0x00, 0x02, 0x7F,
+    0x18, 0x80, 0x01, 0x7F, 0x10, 0x80, 0x00, 0xFF, 0x00, 0x80, 0x88, 0x7F,
+    0x00, 0x82, 0x10, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x02, 0x00, 0xC2, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x0C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x119 'ę'
+    0x00, 0x40, 0x0F, 0x02, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x03, 0x63, 0xAF, 0x10, 0x10, 0x1F, 0x22, 0x11, 0xCF, 0x80, 0x02, 0x5F,
+    0x08, 0x00, 0x4F, 0x82, 0x48, 0x0F, 0x04, 0x10, 0x0F, 0x78, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x29, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x04, 0x31, 0x00, 0x3F, 0x20, 0x21, 0x00, 0x3F, 0x00, 0x01, 0x01, 0x3F,
+    0x00, 0x01, 0x04, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x40, 0x04, 0x01, 0xBF,
+    0x00, 0x04, 0x00, 0x3F, 0x20, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x41, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x63, 0x00, 0x10, 0x13, 0x00, 0x22, 0x11, 0x20, 0x80, 0x05,
+    0x00, 0x08, 0x05, 0x04, 0x82, 0x41, 0x08, 0x04, 0x11, 0x00, 0x78, 0x01,
+    0xC0, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x14, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x09, 0x3F, 0x00, 0x02, 0x80, 0x3F,
+    0x24, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x01, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x2F, 0x01, 0x00, 0xA0, 0x1F,
+    0x15, 0x0C, 0x00, 0x1F, 0x04, 0x00, 0x01, 0x0F, 0x20, 0x00, 0x28, 0x0F,
+    0x00, 0x02, 0x01, 0x0F, 0x41, 0x50, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x50, 0x00, 0x00, 0x0F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x08, 0x02, 0x87,
+    0x00, 0x50, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x27,
+    0x00, 0x50, 0x07, 0x06, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x06, 0x00, 0x07, 0x50, 0x00, 0x0F, 0x02, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x8B, 0x40, 0x28, 0x07, 0x43, 0x00, 0x07,
+    0x00, 0x00, 0x43, 0x00, 0x0A, 0x03, 0x00, 0x80, 0x43, 0x54, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x28, 0x9F, 0x20, 0x22, 0x1F,
+    0x01, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x9F,
+    0x01, 0x00, 0x1F, 0x19, 0x40, 0x1F, 0x00, 0x00, 0x1F, 0x01, 0x80, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x14, 0x8B, 0x40, 0x20, 0x07,
+    0x43, 0x00, 0x07, 0x00, 0x00, 0x43, 0x00, 0x0A, 0x03, 0x00, 0x80, 0x43,
+    0x54, 0x20, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x40, 0x14, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x14, 0x1F, 0x00, 0x02, 0x80, 0x9F, 0x00, 0x03, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x04, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x14, 0x02, 0x01, 0x9F, 0x20, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0xC0, 0x1F, 0x08, 0x34, 0x00, 0x5F, 0x20, 0x00, 0x0A, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x14, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x51, 0x40, 0x00, 0x08, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x80, 0x00, 0x02, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x08, 0x20, 0x22, 0x0A, 0x01, 0x04, 0x00, 0x00,
+    0x48, 0x00, 0x20, 0x20, 0x42, 0x80, 0x00, 0x10, 0x14, 0x00, 0x00, 0x08,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x40, 0x14, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x14, 0x1F, 0x00, 0x02, 0x80, 0x9F, 0x00, 0x03, 0x00, 0x1F,
+    0x40, 0x80, 0x00, 0x1F, 0x08, 0x20, 0x00, 0x1F, 0x24, 0x00, 0x04, 0x1F,
+    0x10, 0x02, 0x01, 0x9F, 0x10, 0x00, 0xC0, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x48, 0x00, 0xC0, 0x1F, 0x00, 0x34, 0x00, 0x5F, 0x00, 0x00, 0x0A, 0x1F,
+    0x40, 0x00, 0x40, 0x1F, 0x00, 0x14, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x29, 0x00, 0xA2, 0x81, 0x00, 0x10, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x21, 0x80, 0x23, 0x01, 0x00, 0x04, 0x01,
+    0x20, 0x40, 0x01, 0x00, 0x10, 0x41, 0x04, 0x14, 0x03, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x41, 0xC0, 0x85, 0x01, 0x00, 0x20, 0x29, 0x00, 0x00, 0x11,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x0F, 0x01, 0x80, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x21, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x04, 0x00, 0x1F,
+    0x08, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x8F, 0x90, 0x01, 0x0F,
+    0x90, 0x28, 0x0F, 0x15, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0x00, 0x10, 0x0F, 0x0A, 0x80, 0x0F, 0x10, 0x80, 0x0F, 0x10, 0x80, 0x0F,
+    0x00, 0x81, 0x0F, 0x00, 0x82, 0x0F, 0x1C, 0xC4, 0x0F, 0x02, 0x06, 0x8F,
+    0x00, 0x00, 0x0F, 0x48, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x00, 0x41, 0x00, 0x09, 0x00, 0x01, 0x20, 0x01, 0x02, 0x21, 0x00, 0x03,
+    0x10, 0x11, 0xA0, 0x01, 0x00, 0x65, 0x9E, 0x89, 0x00, 0x09, 0x40, 0x01,
+    0x20, 0x01, 0x41, 0x43, 0x02, 0x13, 0x22, 0x11, 0x80, 0x05, 0x08, 0x01,
+    0x82, 0x41, 0x84, 0x61, 0x68, 0x01,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0xA0, 0x14, 0x1F, 0x00, 0x82, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x1F,
+    0x60, 0x00, 0x01, 0x1F, 0x11, 0x00, 0x08, 0x1F, 0x41, 0x05, 0x00, 0x5F,
+    0x00, 0x20, 0x0C, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x01, 0x20, 0x00, 0x9F,
+    0x21, 0x0E, 0x00, 0x5F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x82, 0x1F,
+    0x20, 0x41, 0x00, 0x3F, 0x00, 0x3A, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    // 0x159 'ř'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x17, 0x00, 0xA1, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x80, 0x07, 0x00, 0x00, 0x13, 0x00, 0x29, 0x83, 0x00, 0x24, 0x03,
+    0x00, 0x00, 0x03, 0x04, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0xC0, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0x10, 0x5F,
+    0x00, 0x0C, 0x00, 0x5F, 0x00, 0x40, 0x80, 0x1F, 0x00, 0x80, 0x41, 0x1F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x3F, 0x01, 0x22, 0x11, 0x1F,
+    0x14, 0x00, 0x06, 0x1F, 0x20, 0x21, 0x00, 0x1F, 0x01, 0x00, 0x80, 0x9F,
+    0x08, 0x00, 0x41, 0x1F, 0x08, 0x04, 0x2A, 0x1F, 0x20, 0x20, 0x00, 0x1F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x20, 0x00, 0x11, 0x20,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x48, 0x00, 0x50, 0x20,
+    0x06, 0x10, 0x02, 0x00, 0x01, 0x04, 0x40, 0x48, 0xC0, 0x04, 0x38, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0x10, 0x5F,
+    0x00, 0x0C, 0x00, 0x5F, 0x00, 0x40, 0x80, 0x1F, 0x00, 0x80, 0x41, 0x1F,
+    0x50, 0x80, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x3F, 0x05, 0x22, 0x11, 0x1F,
+    0x10, 0x00, 0x06, 0x1F, 0x00, 0x21, 0x00, 0x1F, 0x05, 0x00, 0x80, 0x9F,
+    0x40, 0x00, 0x41, 0x1F, 0x00, 0x04, 0x2A, 0x1F, 0x20, 0x20, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x161 'š'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x00, 0x00, 0x41, 0x00, 0x22, 0x41,
+    0x00, 0x40, 0x01, 0xE0, 0x00, 0x03, 0x88, 0x18, 0x91, 0x00, 0xA0, 0x41,
+    0x00, 0x20, 0x05, 0x04, 0x02, 0x09, 0x00, 0x91, 0x81, 0x90, 0x70, 0x01,
+    0xA0, 0x00, 0x01, 0xC0, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x44, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0xA0, 0x3F,
+    0x10, 0x14, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x10, 0x14, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x10, 0x2C, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x73, 0x00, 0x0A, 0x0B, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x08, 0x01, 0x03, 0x00, 0x28, 0x03, 0x05, 0x00, 0x43,
+    0x00, 0x00, 0x03, 0x08, 0x00, 0x93, 0x04, 0x40, 0x03, 0x08, 0x00, 0x03,
+    0x20, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x80, 0x2F, 0x1F, 0x00, 0x05, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x05, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x22, 0x00, 0x00, 0x1F, 0x28, 0x00, 0x20, 0x1F,
+    0x90, 0x05, 0x00, 0x1F, 0x04, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x40, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0xAD, 0x00, 0x26, 0x01, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x21, 0x00, 0x82, 0x11, 0x00, 0x68, 0x25, 0x00, 0x00, 0x41,
+    0x0A, 0x00, 0x11, 0x80, 0x00, 0x21, 0x80, 0x50, 0x01, 0x80, 0x00, 0x01,
+    0x70, 0x80, 0x81, 0x00, 0x94, 0x25, 0x00, 0x40, 0x09, 0x00, 0x00, 0x31,
+    // 0x170 'Ű'
+    0x00, 0x80, 0x2F, 0x1F, 0x00, 0x05, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x05, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0xC0, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x20, 0x1F,
+    0x08, 0x05, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x24, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x40, 0x1F, 0x40, 0x08, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x20, 0x01, 0x00, 0x20, 0xAD, 0x00, 0x26, 0x01, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x21, 0x0C, 0x82, 0x11, 0x02, 0x68, 0x25, 0x00, 0x00, 0x41,
+    0x80, 0x00, 0x11, 0x00, 0x00, 0x21, 0x2A, 0x50, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x80, 0x81, 0x80, 0x94, 0x25, 0x20, 0x40, 0x09, 0x00, 0x00, 0x31,
+    // 0x178 'Ÿ'
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x08, 0x20, 0x00, 0x00, 0x80, 0x40, 0x00, 0x11, 0x08, 0x00,
+    0x12, 0x00, 0x2C, 0xA0, 0x08, 0x00, 0x03, 0x00, 0x00, 0x80, 0x44, 0x00,
+    0x10, 0x08, 0x00, 0x10, 0x20, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x83, 0x1F, 0x00, 0x01, 0x04, 0x1F, 0x08, 0x00, 0x00, 0x1F,
+    0x04, 0x04, 0x20, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x24, 0x20, 0x01, 0x1F,
+    0x00, 0x01, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x10, 0x08, 0x00, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0xC0, 0x00, 0x1F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x22,
+    0x00, 0x44, 0x40, 0x00, 0x48, 0x92, 0x00, 0x49, 0x02, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x01, 0x01, 0x00, 0x62, 0x00, 0x00, 0x04, 0x00,
+    0x30, 0x48, 0x14, 0x00, 0x10, 0x00,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0xBF, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x41, 0x06, 0x3F, 0x00, 0x02, 0x08, 0x3F, 0x30, 0x00, 0x00, 0x3F,
+    0x40, 0x08, 0x40, 0x3F, 0x80, 0x40, 0x00, 0x3F, 0x80, 0x40, 0x02, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x01, 0x80, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x20, 0x43, 0x00, 0x00, 0x8B,
+    0x01, 0x11, 0x03, 0x01, 0x22, 0x4B, 0x11, 0x24, 0x0B, 0x01, 0x00, 0x03,
+    0x08, 0x00, 0x03, 0x88, 0x04, 0x07, 0x31, 0x88, 0x03, 0x00, 0x10, 0x03,
+    0x01, 0x20, 0x53, 0x00, 0x40, 0x03,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x70, 0x20, 0x83, 0x1F, 0x00, 0x01, 0x04, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x20, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x20, 0x20, 0x01, 0x1F,
+    0x00, 0x01, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x20, 0x08, 0x00, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0xC0, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x10, 0x21, 0x00, 0x00, 0x45,
+    0x00, 0x88, 0x81, 0x80, 0x91, 0x25, 0x04, 0x92, 0x05, 0x20, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x20, 0x02, 0x03, 0x48, 0xC4, 0x01, 0x00, 0x08, 0x01,
+    0x80, 0x90, 0x29, 0x00, 0x20, 0x01,
+    // 0x3C0 'π'
+    0x00, 0x01, 0x10, 0x11, 0x08, 0x23, 0x10, 0x01, 0x96, 0x05, 0x10, 0x01,
+    0x00, 0x41, 0x0A, 0x01, 0x10, 0x41, 0x11, 0x01, 0x10, 0x03, 0x00, 0x01,
+    0x05, 0x05, 0x00, 0x05, 0x90, 0x01, 0x80, 0x01, 0x20, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x50, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x4F, 0x20, 0x02, 0x0F,
+    0x00, 0xA0, 0x8F, 0x40, 0x02, 0x2F, 0x00, 0x00, 0x0F, 0x90, 0x80, 0x8F,
+    0x01, 0x00, 0x1F, 0x00, 0x10, 0x8F, 0x88, 0x08, 0x8F, 0x00, 0x02, 0x2F,
+    0x42, 0x40, 0x0F, 0x04, 0x00, 0x4F, 0x10, 0x19, 0x0F,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2018 '‘'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0xFF, 0x46, 0xFF, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x02, 0xFF, 0x6C, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x04, 0x7F,
+    0x20, 0x7F,
+    // 0x201A '‚'
+    0x01, 0xFF, 0x00, 0x7F, 0x10, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x40, 0x7F,
+    // 0x201B '‛'
+    0x08, 0x3F, 0x02, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x20, 0x3F, 0x00, 0x3F,
+    // 0x201C '“'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0xFF, 0x46, 0xFF, 0x00, 0x7F, 0x03, 0x7F,
+    0x00, 0x7F, 0x20, 0xFF, 0x40, 0x7F, 0x01, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x02, 0x7F, 0x40, 0x7F, 0x81, 0x7F, 0x00, 0x7F, 0x80, 0x7F,
+    0x42, 0x7F, 0x00, 0x7F, 0x30, 0x7F, 0x02, 0x7F, 0x04, 0x7F, 0xF0, 0x7F,
+    // 0x201E '„'
+    0x01, 0xFF, 0x00, 0x7F, 0x10, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x40, 0xFF,
+    0x06, 0x7F, 0x28, 0x7F, 0x81, 0x7F, 0x84, 0x7F, 0x38, 0x7F,
+    // 0x201F '‟'
+    0x08, 0x3F, 0x02, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x20, 0x3F, 0x30, 0x3F,
+    0x44, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x46, 0x3F, 0x01, 0xBF,
+    // 0x2020 '†'
+    0x06, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x05, 0x03, 0x3F, 0x00, 0x20, 0x3F,
+    0x05, 0x80, 0x3F, 0x00, 0x05, 0x3F, 0x81, 0xC0, 0x3F, 0x98, 0x00, 0x3F,
+    0x41, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x03, 0x07, 0x00, 0x01, 0x07, 0x06, 0x01, 0x07, 0x04, 0x04, 0x07,
+    0x05, 0x00, 0x4F, 0x00, 0x5C, 0x0F, 0x05, 0x80, 0x07, 0x00, 0x0D, 0x07,
+    0x81, 0x00, 0x07, 0x98, 0x05, 0x07, 0x41, 0x01, 0x07, 0x04, 0x03, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07,
+    // 0x2022 '•'
+    0x03, 0x43, 0x07, 0x03, 0x07, 0x87, 0x3B,
+    // 0x2026 '…'
+    0x37, 0x8F, 0x8F, 0x17, 0x67, 0x07, 0x07, 0x07, 0x07, 0x47, 0x0F, 0x87,
+    0x97, 0x07, 0x07, 0x07, 0x07, 0x17, 0x0F, 0x0F, 0x87, 0x47,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x04, 0x1F, 0x09, 0x1F,
+    0x10, 0xDF, 0x80, 0x1F, 0x40, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x5F, 0x88, 0x1F, 0x00, 0x9F,
+    0x01, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x01, 0x87, 0x0C, 0x17, 0x00, 0x0F, 0x01, 0x87, 0x4C, 0x2F, 0x10, 0x07,
+    0xA0, 0x0F, 0x92, 0x17, 0x00, 0x07, 0x40, 0x07, 0x12, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x17,
+    0x29, 0x07, 0x08, 0x07, 0x80, 0x07, 0x8A, 0x07, 0x40, 0x87,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x2F, 0x00, 0x2F, 0x0A, 0x0F, 0x02, 0x27, 0x02, 0x4F,
+    0x08, 0x07, 0x00, 0x07, 0x04, 0x27, 0x01, 0x87, 0x40, 0x07,
+    // 0x2076 '⁶'
+    0x01, 0x47, 0x00, 0x07, 0x10, 0x0F, 0x02, 0x07, 0x42, 0x2F, 0x50, 0x27,
+    0x00, 0x87, 0xA0, 0x07, 0x80, 0x27, 0xA0, 0x07, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x30, 0x27, 0x00, 0x4F, 0x01, 0x0F, 0x02, 0x37, 0x00, 0x47, 0x10, 0x07,
+    0x02, 0x07, 0x08, 0x07, 0x00, 0x07, 0x40, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x07, 0x00, 0x97, 0x00, 0x07, 0x00, 0x47, 0x41, 0x27, 0x19, 0x27,
+    0xA4, 0xAF, 0x80, 0x07, 0x02, 0x17, 0x45, 0xE7, 0x18, 0x07,
+    // 0x2079 '⁹'
+    0x00, 0x07, 0x00, 0x27, 0x21, 0x27, 0x40, 0x27, 0x04, 0x87, 0xA0, 0x87,
+    0x80, 0x97, 0x92, 0x27, 0x00, 0x47, 0x40, 0x87, 0x02, 0x07,
+    // 0x2080 '₀'
+    0x00, 0x87, 0x0C, 0x07, 0x10, 0x0F, 0x00, 0x8F, 0x4C, 0x0F, 0x10, 0x07,
+    0x80, 0x4F, 0x92, 0x17, 0x00, 0x07, 0x00, 0x47, 0x12, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x17, 0x00, 0x2F, 0x00, 0x0F, 0x42, 0x8F, 0x40, 0x0F, 0x00, 0x0F,
+    0x85, 0x0F, 0x40, 0x07,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x0F, 0x38, 0x4F, 0x00, 0x0F, 0x51, 0x0F, 0x00, 0x6F,
+    0x80, 0x2F, 0x90, 0x2F, 0x00, 0x2F, 0x00, 0x07, 0x28, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x0F, 0x00, 0x2F, 0x0B, 0x2F, 0x51, 0x0F, 0x04, 0x07, 0xA1, 0x07,
+    0x88, 0x07, 0x02, 0x27, 0x41, 0x47, 0x00, 0x07,
+    // 0x2084 '₄'
+    0x00, 0xC7, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1F,
+    0x01, 0x07, 0x08, 0x07, 0x00, 0x17, 0x8A, 0x07, 0x40, 0x87,
+    // 0x2085 '₅'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x2F, 0x0A, 0x2F, 0x00, 0x27, 0x02, 0x4F,
+    0x08, 0x07, 0x00, 0x17, 0x04, 0x27, 0x01, 0x87, 0x40, 0x07,
+    // 0x2086 '₆'
+    0x01, 0xC7, 0x08, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x02, 0x0F, 0x50, 0x07,
+    0x10, 0x8F, 0x00, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x30, 0x07, 0x00, 0x4F, 0x01, 0x0F, 0x02, 0x07, 0x00, 0x47, 0x10, 0x07,
+    0x02, 0x07, 0x08, 0x07, 0x00, 0x07, 0x60, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x07, 0x00, 0x97, 0x11, 0x07, 0x00, 0x47, 0x41, 0x2F, 0x19, 0x07,
+    0x84, 0xA7, 0xA0, 0x07, 0x02, 0x07, 0x41, 0xE7, 0x18, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x07, 0x21, 0x2F, 0x40, 0x07, 0x00, 0x8F, 0x00, 0x07,
+    0x82, 0x87, 0x92, 0x27, 0x00, 0x47, 0x40, 0x07, 0x02, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0x80, 0x0F, 0x01, 0x24, 0x0F,
+    0x01, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x2F, 0x10, 0x62, 0x0F,
+    0x00, 0x01, 0x0F, 0x04, 0x00, 0x1F, 0x00, 0x20, 0x9F, 0x40, 0x20, 0x8F,
+    0x10, 0x20, 0x8F, 0x10, 0x00, 0x2F, 0x10, 0x01, 0x2F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x40, 0xBF, 0x30, 0x3F, 0x14, 0x3F, 0x00, 0x3F, 0x0A, 0xBF,
+    0x00, 0x3F, 0x30, 0x3F, 0x10, 0x3F, 0x42, 0x3F, 0x78, 0x3F, 0x02, 0xFF,
+    0x09, 0x3F, 0x60, 0x3F, 0x09, 0x3F, 0x14, 0x3F, 0x06, 0x3F, 0x00, 0x3F,
+    0x1C, 0xBF, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x18, 0x14, 0x03, 0x00, 0xA4, 0x03,
+    0x24, 0x04, 0x03, 0x20, 0x04, 0x1B, 0x00, 0x84, 0x23, 0x08, 0x00, 0x07,
+    0x00, 0x01, 0x13, 0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x23, 0x11, 0x00, 0x0B, 0x40, 0x20, 0x2B, 0x48, 0x15, 0x2B,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x43, 0x00, 0x88, 0x13, 0x00, 0x00, 0x23,
+    0x00, 0x02, 0x03, 0x00, 0x00, 0x03,
+    // 0x2154 '⅔'
+    0x00, 0x08, 0x03, 0x00, 0x10, 0x03, 0x08, 0x04, 0x03, 0x00, 0x44, 0x03,
+    0x04, 0x14, 0x03, 0x08, 0x24, 0x03, 0x01, 0x04, 0x03, 0x04, 0x04, 0x2B,
+    0x20, 0x80, 0x07, 0x21, 0x18, 0x83, 0x00, 0x00, 0x13, 0x00, 0x04, 0x03,
+    0x00, 0x08, 0x83, 0x00, 0x02, 0x03, 0x00, 0x04, 0x03, 0x00, 0x90, 0x03,
+    0x02, 0x00, 0x03, 0x04, 0x40, 0x23, 0x11, 0x00, 0x0B, 0x20, 0x20, 0x2B,
+    0x04, 0x15, 0x2B, 0x40, 0x80, 0x03, 0x20, 0x00, 0x43, 0x00, 0x88, 0x13,
+    0x00, 0x00, 0x23, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03,
+    // 0x215B '⅛'
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x18, 0x14, 0x03, 0x00, 0xA4, 0x03,
+    0x24, 0x04, 0x03, 0x20, 0x04, 0x1B, 0x00, 0x84, 0x03, 0x08, 0x00, 0x47,
+    0x00, 0x00, 0x0B, 0x00, 0x02, 0x23, 0x00, 0x04, 0x43, 0x00, 0x01, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x48, 0x03, 0x01, 0x00, 0x03, 0x02, 0x20, 0x03,
+    0x08, 0x80, 0x43, 0x00, 0x01, 0x03, 0x42, 0x24, 0x03, 0x00, 0x41, 0x03,
+    0x00, 0x80, 0x0B, 0x00, 0x21, 0x23, 0x00, 0x80, 0x83, 0x00, 0x00, 0x13,
+    0x00, 0x84, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    // 0x215C '⅜'
+    0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x11, 0x80, 0x03, 0x25, 0x10, 0x03,
+    0x28, 0x04, 0x03, 0x00, 0x64, 0x13, 0x00, 0x00, 0x07, 0x20, 0x00, 0x03,
+    0x02, 0xA1, 0x03, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x01, 0x20, 0x03, 0x00, 0x00, 0x03,
+    0x08, 0x80, 0x43, 0x22, 0x01, 0x03, 0x40, 0x24, 0x03, 0x08, 0x41, 0x03,
+    0x20, 0x80, 0x0B, 0x00, 0x21, 0x23, 0x00, 0x80, 0x83, 0x00, 0x00, 0x13,
+    0x00, 0x84, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x0D, 0x00, 0x03,
+    0x01, 0x10, 0x03, 0x20, 0x04, 0x03, 0x28, 0x80, 0x1B, 0x2A, 0x00, 0x47,
+    0x28, 0x00, 0x0B, 0x28, 0xC1, 0x13, 0x10, 0x04, 0x43, 0x00, 0x00, 0x03,
+    0x00, 0x12, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03, 0x02, 0x20, 0x03,
+    0x00, 0x40, 0x03, 0x10, 0x00, 0x43, 0x02, 0x01, 0x03, 0x40, 0x24, 0x03,
+    0x08, 0x41, 0x03, 0x00, 0x80, 0x0B, 0x00, 0x21, 0x23, 0x00, 0x80, 0x83,
+    0x00, 0x00, 0x13, 0x00, 0x84, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    // 0x215E '⅞'
+    0x14, 0x0C, 0x03, 0x22, 0x00, 0x03, 0x2C, 0x00, 0x03, 0x28, 0x00, 0x0B,
+    0x2A, 0x00, 0x23, 0x20, 0x80, 0x83, 0x20, 0x00, 0x13, 0x22, 0x02, 0x23,
+    0x28, 0x08, 0x83, 0x10, 0x01, 0x03, 0x00, 0x24, 0x03, 0x00, 0x80, 0x03,
+    0x01, 0x00, 0x03, 0x04, 0x40, 0x03, 0x00, 0x00, 0x03, 0x21, 0x00, 0x43,
+    0x04, 0x01, 0x03, 0x00, 0x24, 0x03, 0x10, 0x41, 0x03, 0x00, 0x80, 0x0B,
+    0x00, 0x21, 0x23, 0x00, 0x80, 0x83, 0x00, 0x00, 0x13, 0x00, 0x84, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F, 0x80, 0x1F, 0x99, 0x9F,
+    0x49, 0x2F, 0x09, 0x0F, 0x01, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x11, 0x00, 0x3F, 0x24, 0x00, 0x3F,
+    0x47, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x47, 0xC0, 0x3F,
+    0x20, 0x00, 0x3F, 0x11, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x01, 0x0F, 0x09, 0x0F, 0x49, 0x2F, 0x99, 0x9F, 0x80, 0x1F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x22, 0x3F, 0x00, 0x09, 0x3F,
+    0x00, 0x78, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0xBF,
+    0x00, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x40, 0x2F, 0x09, 0x0F,
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x40, 0x2F, 0x20, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x0A, 0x14, 0x3F, 0x12, 0x12, 0x3F, 0x04, 0x08, 0x3F,
+    0x0F, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x0F, 0xFC, 0x3F,
+    0x04, 0x08, 0x3F, 0x10, 0x12, 0x3F, 0x0A, 0x04, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x02, 0x40, 0x04, 0x20, 0x09, 0x90, 0x10, 0x08, 0x20, 0x04,
+    0x48, 0x12, 0x50, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x00, 0x00,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x7F, 0x06, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x12, 0x00, 0x7F,
+    0x24, 0x0F, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x24, 0x07, 0x7F,
+    0x12, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x06, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0x48, 0x12,
+    0x20, 0x04, 0x10, 0x08, 0x09, 0x90, 0x04, 0x20, 0x02, 0x40, 0x00, 0x00,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x7F, 0x00, 0x60, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x48, 0x7F,
+    0xF0, 0x24, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x02, 0x7F, 0xE0, 0x24, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x03, 0x04, 0x83, 0x08, 0x43, 0x10, 0x23, 0x20, 0x13, 0x00, 0x03,
+    0x10, 0x23, 0x60, 0x1B, 0x00, 0x03, 0x00, 0x03, 0x60, 0x1B, 0x10, 0x23,
+    0x40, 0x0B, 0x20, 0x13, 0x13, 0x23, 0x08, 0x43, 0x04, 0x83, 0x00, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x03, 0x43, 0x00, 0x18, 0x03, 0x00, 0x00, 0x03, 0x28, 0x40, 0x03,
+    0x10, 0x0A, 0x47, 0x10, 0x10, 0x07, 0x01, 0x20, 0x03, 0x80, 0x00, 0x4B,
+    0x90, 0x00, 0x8B, 0x03, 0x14, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x03, 0x06, 0x30, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x01, 0x80, 0x1F, 0x00, 0x0C, 0x9F, 0x30, 0x60, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x9F, 0x01, 0x80, 0x9F, 0x00, 0x30, 0x9F, 0x60, 0x06, 0x9F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x06,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x04, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x82,
+    0x00, 0x00, 0x08,
+    // 0x221A '√'
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x30, 0x00, 0x01, 0x81, 0x00, 0x04, 0x0C, 0x00, 0xC0, 0x60,
+    0x02, 0x01, 0x00, 0x40, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x2D, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0x22, 0x7F, 0x92, 0x3F,
+    0x04, 0xBF, 0x01, 0x3F, 0x21, 0x3F, 0x08, 0xBF, 0x80, 0x3F, 0x82, 0x7F,
+    0x02, 0x7F, 0x8C, 0x3F, 0x80, 0x3F, 0x23, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x18, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x8F,
+    0x98, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x2260 '≠'
+    0x39, 0x87, 0x20, 0x07, 0x20, 0x37, 0x20, 0x07, 0x22, 0x17, 0x20, 0x07,
+    0x20, 0x07, 0x42, 0x07, 0x00, 0x07, 0x80, 0x07, 0x20, 0x07, 0x20, 0x47,
+    // 0x2264 '≤'
+    0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40,
+    0x01, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x10, 0x80, 0x40, 0x00, 0x00,
+    // 0x2265 '≥'
+    0x20, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x02, 0x00, 0x10, 0x00, 0x08, 0x00, 0x09, 0x00, 0x04, 0x00,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint8_t Bookerly26BoldItalicBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x37, 0x00, 0x06, 0x07, 0x07, 0x00, 0x87, 0x20, 0x02, 0x17,
+    0x00, 0x30, 0x07, 0x01, 0x00, 0x07, 0x98, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x22 '"'
+    0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x84, 0x7F, 0xE0, 0x7F, 0x0E, 0xFF,
+    0x40, 0xFF, 0x81, 0x7F, 0x98, 0x7F, 0x00, 0x7F,
+    // 0x23 '#'
+    0x00, 0x30, 0x7F, 0x04, 0x00, 0x7F, 0x00, 0x06, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x7F, 0x60, 0x08, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x00, 0x7F,
+    0x00, 0x0C, 0x7F, 0x02, 0x80, 0x7F, 0x00, 0x03, 0x7F, 0x80, 0x00, 0x7F,
+    0x81, 0x00, 0x7F, 0xB0, 0x00, 0x7F, 0x00, 0x30, 0x7F, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x01, 0x20, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x02, 0x00, 0x41, 0x3F, 0x00, 0x00, 0x20, 0x7F, 0x09, 0x01, 0x82, 0x3F,
+    0x02, 0x40, 0x20, 0x3F, 0x00, 0xC1, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x41, 0x10, 0x80, 0x3F, 0x92, 0x00, 0x10, 0x3F, 0x01, 0x80, 0x20, 0x3F,
+    0x00, 0x01, 0x80, 0x3F, 0x02, 0x80, 0x00, 0x3F,
+    // 0x25 '%'
+    0x01, 0xE0, 0x03, 0x04, 0x00, 0x03, 0x00, 0x08, 0x03, 0x01, 0x20, 0x03,
+    0x20, 0x00, 0x1B, 0x00, 0x20, 0x03, 0x00, 0x48, 0x8B, 0x00, 0x11, 0x13,
+    0x20, 0x20, 0x43, 0x10, 0x88, 0x83, 0x00, 0x12, 0x03, 0x00, 0x04, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x21, 0xC3, 0x04, 0x48, 0x13, 0x00, 0x10, 0x03,
+    0x22, 0x23, 0x4B, 0x44, 0x08, 0x2B, 0x40, 0x10, 0x03, 0x20, 0x50, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03,
+    // 0x26 '&'
+    0x00, 0x07, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x06, 0x07,
+    0x00, 0x80, 0x07, 0x10, 0x20, 0x87, 0x20, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x10, 0x41, 0x07, 0xA2, 0x10, 0x27, 0x00, 0x00, 0x07, 0x20, 0x20, 0x07,
+    0x82, 0x02, 0x07, 0x04, 0xA0, 0x07, 0x30, 0x21, 0x97, 0x00, 0x00, 0x07,
+    0x01, 0x10, 0x47, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x03, 0x00, 0x07,
+    // 0x27 '''
+    0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x84, 0x7F, 0xE0, 0x7F,
+    // 0x28 '('
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x18, 0x30, 0x1F, 0x00, 0x80, 0x04, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x04, 0x18, 0x60, 0x9F, 0x08, 0x00, 0x00, 0x5F,
+    0x11, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x9F, 0x48, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x04, 0x9F, 0x60, 0x00, 0x08, 0x1F,
+    0x90, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x40, 0x1F, 0x00, 0xC6, 0x08, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x01, 0x86, 0x00, 0x1F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x28, 0x3F, 0x00, 0xBF, 0x05, 0x3F, 0x12, 0x3F, 0x00, 0x7F,
+    0x19, 0x7F, 0x2A, 0x3F, 0x00, 0x3F, 0x04, 0x3F,
+    // 0x2B '+'
+    0x06, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x79, 0xF7, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x07,
+    // 0x2C ','
+    0x01, 0x7F, 0x00, 0x7F, 0x48, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+    0x60, 0x7F,
+    // 0x2D '-'
+    0x5F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x0F,
+    // 0x2E '.'
+    0x37, 0x07, 0x87, 0x87, 0x67,
+    // 0x2F '/'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x02, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x87, 0x00, 0x42, 0x07, 0x00, 0x00, 0x07,
+    0x02, 0x10, 0x07, 0x08, 0x40, 0x07, 0x00, 0x00, 0x07, 0x42, 0x00, 0x07,
+    0x88, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x1E, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x62, 0x0F, 0x01, 0x00, 0x0F, 0x04, 0x00, 0x8F, 0x48, 0x00, 0x0F,
+    0x40, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x4F, 0x00, 0x20, 0x0F,
+    0x40, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x0F, 0xC0, 0x0F,
+    // 0x31 '1'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x08, 0x01, 0x9F, 0x28, 0x10, 0x1F, 0x0B, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x40, 0x01, 0x9F, 0x00, 0x30, 0x1F, 0x03, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    // 0x32 '2'
+    0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x09, 0x1F, 0x40, 0x10, 0x1F, 0x40, 0x20, 0x1F,
+    0x10, 0x44, 0x1F, 0x10, 0x88, 0x1F, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x3F, 0x00, 0x00, 0x9F, 0x13, 0x00, 0x1F,
+    // 0x33 '3'
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x8F,
+    0x02, 0x20, 0x8F, 0x04, 0x50, 0x8F, 0x48, 0x10, 0x0F, 0x40, 0x01, 0x2F,
+    0x00, 0x10, 0x0F, 0x11, 0x00, 0x0F, 0x02, 0x00, 0x4F, 0x40, 0x40, 0x8F,
+    0x00, 0xA1, 0x0F, 0x21, 0x0C, 0x0F, 0x0C, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x08, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x1F,
+    0x00, 0x90, 0x1F, 0x01, 0x20, 0x1F, 0x02, 0x40, 0x1F, 0x04, 0x80, 0x3F,
+    0x09, 0x00, 0x1F, 0x12, 0x40, 0x1F, 0x22, 0x00, 0x3F, 0x40, 0x01, 0x1F,
+    0x00, 0x60, 0x1F, 0x0C, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x35 '5'
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x5F, 0x00, 0x01, 0x1F, 0x00, 0x01, 0x1F,
+    0x08, 0x01, 0x1F, 0x40, 0x80, 0x1F, 0x80, 0x80, 0x1F, 0x84, 0x00, 0x5F,
+    0x80, 0x44, 0x1F, 0x82, 0x30, 0x9F, 0x80, 0x00, 0x1F, 0x81, 0x00, 0x1F,
+    0x80, 0x84, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x36 '6'
+    0x00, 0x31, 0x0F, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x0F, 0x04, 0x04, 0x0F,
+    0x08, 0x20, 0x0F, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x8F, 0x21, 0x00, 0x0F,
+    0x00, 0x01, 0x2F, 0x48, 0x00, 0x0F, 0x40, 0x80, 0x4F, 0x00, 0x00, 0x8F,
+    0x10, 0x36, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0x1F, 0x10, 0x01, 0x1F, 0x80, 0x00, 0x1F, 0x84, 0x10, 0x1F,
+    0x90, 0x00, 0x9F, 0x80, 0x02, 0x1F, 0x81, 0x00, 0x1F, 0x82, 0x10, 0x1F,
+    0x80, 0x00, 0x1F, 0x90, 0x80, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x88, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x8F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x2F,
+    0x10, 0xA7, 0x0F, 0x20, 0x48, 0x8F, 0x00, 0x10, 0x0F, 0x49, 0x00, 0x0F,
+    0x50, 0x10, 0x8F, 0x10, 0x08, 0x2F, 0x11, 0x00, 0x0F, 0x02, 0x40, 0x4F,
+    0x40, 0x00, 0x0F, 0x00, 0x09, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x01, 0x80, 0x0F,
+    0x08, 0x20, 0x8F, 0x00, 0x10, 0x0F, 0x00, 0x01, 0x2F, 0x44, 0x88, 0x0F,
+    0x00, 0x0A, 0x0F, 0x10, 0x0C, 0x0F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x47, 0x80, 0x0F, 0x00, 0x04, 0x0F, 0x20, 0x00, 0x0F, 0x08, 0x40, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x3A ':'
+    0x00, 0x0D, 0x00, 0x01, 0x00, 0x21, 0x08, 0x21, 0x08, 0x19, 0x80, 0x01,
+    0x60, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x12, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x48, 0x20, 0x1F, 0x08, 0x18, 0x1F, 0x80, 0x00, 0x1F,
+    0x60, 0x00, 0x1F,
+    // 0x3C '<'
+    0x06, 0x07, 0x00, 0x07, 0x08, 0x07, 0x00, 0x87, 0x16, 0x07, 0x00, 0x47,
+    0x21, 0x07, 0x00, 0x27, 0x40, 0x87, 0x10, 0x17, 0x80, 0x07, 0x00, 0x27,
+    // 0x3D '='
+    0x67, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+    // 0x3E '>'
+    0x00, 0x07, 0x00, 0x57, 0x10, 0x17, 0x40, 0x07, 0x08, 0x27, 0x20, 0x07,
+    0x05, 0x47, 0x10, 0x07, 0x00, 0x87, 0x08, 0x07, 0x01, 0x07, 0x04, 0x07,
+    // 0x3F '?'
+    0x20, 0x18, 0xAF, 0x00, 0x44, 0x0F, 0x80, 0x81, 0x0F, 0x10, 0x30, 0x2F,
+    0x10, 0x54, 0x0F, 0x8C, 0x88, 0x0F, 0x01, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x03, 0x00, 0x7F, 0x00, 0x20, 0x10, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x02, 0x0F, 0x80, 0x7F, 0x04, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x12, 0x00, 0x01, 0x7F, 0x00, 0x10, 0x80, 0x7F, 0x20, 0x40, 0x04, 0x7F,
+    0x08, 0x00, 0x04, 0x7F, 0x01, 0x11, 0x04, 0x7F, 0x40, 0x40, 0x44, 0x7F,
+    0x12, 0x02, 0x84, 0x7F, 0x10, 0x01, 0x05, 0x7F, 0x10, 0x60, 0x40, 0x7F,
+    0x11, 0x00, 0x00, 0x7F, 0x10, 0x10, 0x00, 0x7F, 0x40, 0x81, 0x08, 0x7F,
+    0x40, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x22, 0x08, 0x00, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x03, 0x30, 0x00, 0x7F,
+    // 0x41 'A'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x1F, 0x04, 0x30, 0x1F, 0x10, 0x90, 0x1F, 0x02, 0x10, 0x1F,
+    0x04, 0x10, 0x5F, 0x00, 0x70, 0x1F, 0x80, 0x00, 0x9F, 0x30, 0x00, 0x1F,
+    0x01, 0x80, 0x1F, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x06, 0x0F,
+    0x50, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x18, 0x0F,
+    0x83, 0x80, 0x0F, 0x80, 0x80, 0x8F, 0x80, 0x80, 0xAF, 0x10, 0x81, 0x2F,
+    0x0E, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x80, 0x8F, 0x00, 0x12, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x43 'C'
+    0x00, 0x00, 0x0F, 0x00, 0x81, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x2F, 0x20, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x90, 0x00, 0x2F,
+    0x90, 0x00, 0x0F, 0x14, 0x02, 0x4F, 0x02, 0x00, 0x8F, 0x40, 0x00, 0x0F,
+    0x30, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x06, 0x0F,
+    0x50, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x8F,
+    0x83, 0x00, 0x8F, 0x90, 0x00, 0x8F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x04, 0x08, 0x0F, 0x00, 0x00, 0x8F,
+    0x20, 0x01, 0x0F, 0x10, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x18, 0x1F,
+    0x03, 0x80, 0x9F, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x9F,
+    0x10, 0x00, 0x1F, 0x10, 0x24, 0x1F, 0x00, 0x04, 0x9F, 0x00, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x46 'F'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F,
+    0x01, 0x90, 0x1F, 0x10, 0x10, 0x1F, 0x00, 0x10, 0x1F, 0x10, 0x10, 0x1F,
+    0x10, 0x10, 0x1F, 0x1C, 0x60, 0x1F, 0x02, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x60, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0x00, 0x0F, 0x00, 0x82, 0x0F, 0x02, 0x00, 0x8F, 0x08, 0x00, 0x4F,
+    0x10, 0x00, 0x0F, 0x00, 0x84, 0x2F, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x10, 0x20, 0x8F, 0x80, 0x28, 0x8F,
+    0x80, 0x2B, 0x0F, 0x90, 0x20, 0x2F, 0x0E, 0x20, 0x0F, 0x02, 0x20, 0xCF,
+    0x40, 0x28, 0x0F, 0x20, 0x30, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F,
+    0x01, 0x80, 0x7F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x60, 0x18, 0x1F, 0x01, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x9F, 0x00, 0x30, 0x1F, 0x06, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x49 'I'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x1F,
+    0x01, 0x80, 0x7F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x09, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x03, 0x02, 0x7F, 0x00, 0x60, 0x04, 0x7F,
+    0x14, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0xC0, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x0F,
+    0x00, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x18, 0x0F,
+    0x03, 0x80, 0x4F, 0x10, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x60, 0x8F,
+    0x00, 0x80, 0x0F, 0x49, 0x04, 0x2F, 0x12, 0x02, 0x0F, 0x04, 0x01, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F,
+    0x01, 0x80, 0x9F, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x9F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x18, 0x1F, 0x60, 0x80, 0x1F, 0x04, 0x06, 0x1F, 0x00, 0x20, 0x7F,
+    0x01, 0x00, 0x1F, 0x03, 0x00, 0x1F, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0x9F,
+    0x1E, 0x00, 0x9F, 0x00, 0x21, 0x1F, 0x00, 0x44, 0x1F, 0x01, 0x00, 0x1F,
+    0x04, 0x20, 0x5F, 0x10, 0x80, 0x1F, 0x02, 0x03, 0x9F, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x0F,
+    0x00, 0xC0, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x0C, 0x0F, 0x01, 0x80, 0x6F,
+    0x01, 0x00, 0x0F, 0x40, 0x20, 0x0F, 0x10, 0x08, 0x0F, 0x04, 0x02, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x20, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x20, 0x0F,
+    0x06, 0x00, 0x2F, 0x00, 0x06, 0x0F, 0x00, 0x40, 0x0F, 0x0C, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x00, 0x00, 0x0F, 0x01, 0x81, 0x0F, 0x04, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x20, 0x82, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x01, 0x00, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x06, 0x1F,
+    0x50, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F,
+    0x83, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x1F,
+    0x09, 0x10, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x0F, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x7F, 0x01, 0x81, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x82, 0x10, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x40, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x84, 0x7F,
+    0x10, 0x00, 0x90, 0x7F, 0x90, 0x00, 0x22, 0x7F, 0x90, 0x01, 0x00, 0x7F,
+    0x00, 0x00, 0x09, 0x7F, 0x00, 0x08, 0x40, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x01, 0x00, 0xFF, 0x20, 0x02, 0x04, 0xFF, 0x00, 0x08, 0x04, 0xFF,
+    0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x06, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x06, 0x0F,
+    0x50, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x08, 0x0F,
+    0x03, 0x40, 0x4F, 0x80, 0x44, 0x0F, 0x80, 0x01, 0x0F, 0x00, 0x80, 0x0F,
+    0x09, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x41, 0x0F, 0x20, 0x80, 0x0F,
+    0x0E, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    // 0x53 'S'
+    0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x08, 0x2F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x02, 0x10, 0x8F,
+    0x01, 0x00, 0x8F, 0x80, 0x05, 0x0F, 0x80, 0x00, 0x2F, 0x10, 0x40, 0x4F,
+    0x02, 0x20, 0x8F, 0x00, 0x0E, 0x0F, 0x58, 0x00, 0x0F,
+    // 0x54 'T'
+    0x00, 0x00, 0x1F, 0x62, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x10, 0x03, 0x1F, 0x10, 0x30, 0x1F, 0x16, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x06, 0x1F, 0x00, 0xC0, 0x1F, 0x0C, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x55 'U'
+    0x20, 0x0F, 0x0F, 0x01, 0x80, 0x4F, 0x10, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x12, 0x0F, 0x03, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x02, 0x2F, 0x60, 0x08, 0x0F,
+    0x01, 0x80, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0xC0, 0x0F,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x56 'V'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x01, 0xC0, 0x0F,
+    0x00, 0x06, 0x0F, 0x00, 0x00, 0x2F, 0x1C, 0x00, 0x0F, 0x00, 0x1C, 0x0F,
+    0x20, 0x04, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x84, 0x0F,
+    0x62, 0x10, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x57 'W'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x3C, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x20, 0x0F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x40, 0x0F,
+    0x20, 0x80, 0x0F, 0x40, 0x00, 0x6F, 0x40, 0x00, 0x0F, 0x1F, 0xF0, 0x0F,
+    0x00, 0x08, 0x2F, 0x00, 0x20, 0x8F, 0x00, 0x82, 0x0F, 0x62, 0x08, 0x0F,
+    0x08, 0x20, 0x0F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x01, 0x1F, 0x00, 0x02, 0x1F, 0x10, 0x04, 0x1F, 0x04, 0x08, 0x1F,
+    0x01, 0x02, 0x7F, 0x00, 0x44, 0x1F, 0x10, 0x08, 0x1F, 0x24, 0x04, 0x5F,
+    0x00, 0x01, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x88, 0x1F, 0x01, 0x02, 0x1F,
+    0x02, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x1F, 0x01, 0x00, 0x1F,
+    0x00, 0x63, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x20, 0x80, 0x1F,
+    0x00, 0x86, 0x1F, 0x01, 0x10, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x80, 0x1F,
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x30, 0x04, 0x0F,
+    0x02, 0x08, 0x0F, 0x04, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x8F,
+    0x11, 0x00, 0x8F, 0x12, 0x10, 0x8F, 0x00, 0x20, 0x8F, 0x10, 0x40, 0x8F,
+    0x00, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x08, 0x00, 0x0F,
+    0x30, 0x00, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0xC0, 0x06, 0x3F, 0x0C, 0x00, 0x60, 0x3F,
+    0x40, 0x04, 0x00, 0xBF, 0x80, 0xC0, 0x00, 0x3F, 0x8C, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x84, 0x00, 0x07, 0x80, 0x80, 0x07,
+    0x10, 0x20, 0x07, 0x04, 0x04, 0x07, 0x00, 0x80, 0x87, 0x00, 0x10, 0x27,
+    0x00, 0x04, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x17,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x00, 0x30, 0x01, 0xBF, 0x83, 0x00, 0x18, 0x3F, 0x80, 0x03, 0x00, 0x3F,
+    0x80, 0x30, 0x00, 0x3F, 0x83, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x87, 0x04, 0x07, 0x10, 0x27, 0x41, 0x07,
+    0x88, 0x07, 0x88, 0x07, 0x01, 0x07, 0x10, 0x27, 0x04, 0x07, 0x01, 0x07,
+    0x00, 0x27, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0x21, 0x01, 0x01, 0x05, 0x11, 0x05,
+    // 0x61 'a'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x01, 0x20, 0x01, 0x41, 0xE1, 0x08, 0x11,
+    0x90, 0x21, 0x00, 0x41, 0x21, 0x21, 0x84, 0x05, 0x40, 0x01, 0x80, 0x01,
+    0x82, 0x05, 0xA0, 0x21, 0x00, 0x01, 0x00, 0x01,
+    // 0x62 'b'
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x83, 0x10, 0x18, 0x03, 0x51, 0x80, 0x0B,
+    0x00, 0x00, 0x43, 0x00, 0x22, 0x23, 0x01, 0x08, 0x03, 0x48, 0x00, 0x23,
+    0x00, 0x00, 0x4B, 0x01, 0x01, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x83, 0x00, 0x7C, 0x03,
+    // 0x63 'c'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x05, 0x20, 0x01, 0x03, 0xC1, 0x08, 0x01,
+    0x90, 0x01, 0x80, 0x05, 0x00, 0x21, 0x90, 0x09, 0x80, 0x31, 0x60, 0x01,
+    // 0x64 'd'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x13, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x83, 0xC3, 0x00, 0x10, 0x23, 0x01, 0x20, 0x43, 0x00, 0x00, 0x83,
+    0x00, 0x42, 0x43, 0x11, 0x08, 0x0B, 0x50, 0x00, 0x03, 0x18, 0x00, 0x03,
+    0x00, 0x0C, 0x0B, 0x00, 0xC0, 0x43, 0x4C, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x65 'e'
+    0x00, 0x01, 0x06, 0x09, 0x00, 0x05, 0x20, 0x01, 0x45, 0x01, 0x10, 0x11,
+    0xA2, 0x91, 0xA4, 0x05, 0x19, 0x21, 0x82, 0x09, 0x84, 0x51, 0x30, 0x01,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x0C, 0x2F, 0x00, 0x01, 0x80, 0x4F, 0x00, 0x30, 0x00, 0x8F,
+    0x02, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x20, 0x0C, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x67 'g'
+    0x00, 0x01, 0xC7, 0x00, 0x00, 0x27, 0x00, 0x04, 0x17, 0x00, 0x01, 0x97,
+    0x10, 0x1A, 0x47, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x0A, 0x00, 0x07,
+    0xA1, 0x40, 0x07, 0x00, 0x00, 0x57, 0x02, 0x01, 0x97, 0x18, 0x88, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x38, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x68 'h'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x83, 0x10, 0x18, 0x03, 0x51, 0x80, 0x03,
+    0x00, 0x00, 0x63, 0x00, 0x02, 0x03, 0x00, 0x88, 0x03, 0x4C, 0x10, 0x03,
+    0x00, 0x20, 0x7B, 0x01, 0x06, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x02, 0x0B, 0x00, 0xF0, 0x43, 0x00, 0x00, 0x63,
+    // 0x69 'i'
+    0x00, 0x00, 0x07, 0x01, 0x81, 0x97, 0x00, 0x88, 0x07, 0x02, 0x40, 0x07,
+    0x72, 0x00, 0x07, 0x80, 0x04, 0x17, 0x82, 0x40, 0x87, 0x80, 0x00, 0x47,
+    0x40, 0x00, 0x07,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x80, 0x10, 0x1F, 0x00, 0x81, 0x00, 0x1F,
+    0x02, 0xB0, 0x02, 0x1F, 0x02, 0x00, 0x08, 0x1F, 0x02, 0x00, 0xC0, 0x1F,
+    0x8A, 0x08, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x6B 'k'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x83, 0x10, 0x18, 0x03, 0x51, 0x80, 0x03,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x83, 0x01, 0x50, 0x03, 0x48, 0x20, 0x13,
+    0x00, 0x04, 0x8B, 0x01, 0x4A, 0x43, 0x01, 0x20, 0x03, 0x01, 0x04, 0x23,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x8B, 0x10, 0x18, 0x03, 0x51, 0x00, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x0C, 0x0B, 0x00, 0xC0, 0x43, 0x58, 0x00, 0x23,
+    // 0x6D 'm'
+    0x00, 0x01, 0x20, 0x19, 0x21, 0x81, 0x90, 0x01, 0x80, 0x05, 0x80, 0xC1,
+    0x62, 0x01, 0x20, 0x01, 0x40, 0x19, 0x01, 0x81, 0x98, 0x01, 0x00, 0x01,
+    0x80, 0xC1, 0x62, 0x01, 0x20, 0x01, 0x50, 0x19, 0x01, 0x01, 0x98, 0x01,
+    0x00, 0x01, 0x80, 0x81, 0x4C, 0x01, 0x00, 0x29, 0x00, 0x01,
+    // 0x6E 'n'
+    0x00, 0x01, 0x20, 0x19, 0x21, 0x81, 0x90, 0x01, 0x80, 0x05, 0x00, 0x41,
+    0xA2, 0x01, 0x20, 0x01, 0x00, 0x01, 0x00, 0xC1, 0x8C, 0x01, 0x00, 0x01,
+    0x00, 0x61, 0x06, 0x05, 0x00, 0x29, 0x00, 0x01,
+    // 0x6F 'o'
+    0x00, 0x01, 0x04, 0x01, 0x10, 0x01, 0x20, 0x01, 0x43, 0xE1, 0x08, 0x11,
+    0x80, 0x01, 0xA0, 0x01, 0x00, 0x25, 0x11, 0x81, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x70 'p'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x20, 0x18, 0x0F,
+    0xA1, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x04, 0x0F, 0x80, 0x90, 0x0F,
+    0x62, 0x00, 0x0F, 0x08, 0x10, 0x0F, 0x50, 0x00, 0x0F, 0x80, 0x44, 0x0F,
+    0x9E, 0x08, 0x0F, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x0F, 0x41, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x71 'q'
+    0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x41, 0xA0, 0x1F, 0x08, 0x10, 0x0F, 0x90, 0x20, 0x0F, 0x00, 0x40, 0xCF,
+    0x21, 0x28, 0x0F, 0x84, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x30, 0x0F,
+    0x82, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x00, 0x03, 0x20, 0x0F, 0x20, 0x83, 0x98, 0x03, 0x80, 0x07, 0x00, 0x23,
+    0xB9, 0x03, 0x04, 0x03, 0x48, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x60, 0x03,
+    // 0x73 's'
+    0x00, 0x01, 0x00, 0x29, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x11,
+    0x88, 0x81, 0xA0, 0x61, 0x20, 0x01, 0x00, 0x09, 0x90, 0x91, 0x60, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x60, 0xBF, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x80, 0x1C, 0x3F, 0x03, 0x00, 0x3F, 0x70, 0x00, 0xBF,
+    0x10, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x00, 0x01, 0x20, 0x69, 0xA2, 0x01, 0x80, 0x01, 0x80, 0x21, 0x83, 0x11,
+    0x70, 0x01, 0x00, 0x09, 0x00, 0x81, 0x02, 0x39, 0x30, 0x01, 0x80, 0x01,
+    0x80, 0xE1, 0x98, 0x01, 0x80, 0x09, 0x00, 0x01,
+    // 0x76 'v'
+    0x20, 0x01, 0x00, 0x01, 0x80, 0x01, 0x86, 0x01, 0x80, 0x05, 0x00, 0x01,
+    0x1C, 0x05, 0x00, 0x41, 0x00, 0x91, 0xA4, 0x21, 0x80, 0x01, 0x01, 0x01,
+    0x04, 0x01, 0x00, 0x01,
+    // 0x77 'w'
+    0x20, 0x01, 0x20, 0x01, 0x80, 0x01, 0x84, 0x01, 0x80, 0x05, 0x40, 0x01,
+    0x0C, 0x05, 0x00, 0x49, 0x01, 0x11, 0xBC, 0x01, 0x00, 0x01, 0x80, 0x01,
+    0x20, 0x01, 0x01, 0xC5, 0x00, 0x09, 0xC2, 0x01, 0x80, 0x41, 0x00, 0x01,
+    0x84, 0x01, 0x00, 0x01,
+    // 0x78 'x'
+    0x00, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x80, 0x25, 0x88, 0x49,
+    0x82, 0x11, 0x00, 0x01, 0x10, 0x11, 0x00, 0x05, 0x20, 0x01, 0x48, 0x21,
+    0x90, 0x11, 0x00, 0x15, 0x00, 0x01, 0xA0, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x67, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x17, 0x80, 0x00, 0x87, 0x86, 0x01, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x88, 0x07, 0xA6, 0x10, 0x07, 0x80, 0x40, 0x07, 0x01, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x01, 0x00, 0x11, 0x38, 0x21, 0x04, 0x45, 0x88, 0x81, 0x81, 0x21,
+    0x82, 0x45, 0x10, 0x81, 0x01, 0x01, 0x40, 0x01, 0x40, 0x41, 0x00, 0x45,
+    0x80, 0x11, 0x40, 0x01,
+    // 0x7B '{'
+    0x00, 0x00, 0x0F, 0x3F, 0x00, 0x14, 0x40, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0xC0, 0x12, 0x3F, 0x10, 0x08, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x07, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00,
+    0x06, 0x00, 0x30, 0x60, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00,
+    0x80, 0x00, 0x00,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0xF0, 0xBF,
+    0x80, 0x02, 0x01, 0x3F, 0x80, 0x84, 0x06, 0x3F, 0x94, 0x01, 0x80, 0x3F,
+    0x80, 0x32, 0x00, 0x3F, 0x01, 0x08, 0x00, 0x3F, 0x18, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x03, 0x23, 0x07, 0x0B, 0x13, 0x03, 0x4B, 0x03, 0x07, 0x07, 0x27, 0x03,
+    0x43, 0x03,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x01, 0x07, 0x00, 0x08, 0x07,
+    0x20, 0x80, 0x07, 0x00, 0x00, 0x47, 0x80, 0x1C, 0x07, 0x90, 0x00, 0x07,
+    0x40, 0x00, 0x07,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x01, 0x00, 0x20, 0x7F, 0x02, 0x21, 0x0C, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x04, 0x0C, 0x06, 0x7F, 0x04, 0x80, 0x00, 0x7F, 0x18, 0x18, 0x80, 0x7F,
+    0x80, 0x80, 0x20, 0x7F, 0x18, 0x01, 0x00, 0x7F, 0x84, 0x00, 0x00, 0x7F,
+    0x00, 0x81, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x50, 0x0F,
+    0x00, 0x54, 0x2F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x06, 0xAF,
+    0x00, 0x10, 0xAF, 0x03, 0x50, 0x8F, 0x48, 0x50, 0x8F, 0x50, 0x50, 0x8F,
+    0x10, 0x10, 0x0F, 0x10, 0x40, 0x0F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x8F,
+    0x24, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x27, 0x00, 0x47, 0x20, 0x07, 0x98, 0x27, 0x40, 0x27, 0x07, 0x07,
+    0x00, 0x07, 0x50, 0x07, 0x10, 0x07, 0x10, 0x27, 0x4E, 0x27, 0x00, 0x07,
+    0x01, 0x47, 0x10, 0x17, 0xA0, 0x07, 0x40, 0x07,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x3F, 0xA1, 0x18, 0xBF, 0x89, 0x08, 0x3F, 0x81, 0x08, 0x3F,
+    0x80, 0x4C, 0x3F, 0x80, 0x00, 0x3F, 0x86, 0x00, 0x3F, 0x80, 0x03, 0x3F,
+    0x00, 0x08, 0x3F, 0x04, 0x48, 0xFF, 0x80, 0x48, 0x3F, 0xA3, 0x48, 0x3F,
+    0x85, 0x50, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xA0, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x41, 0x17, 0x10, 0x10, 0x87,
+    0x24, 0x08, 0x07, 0x40, 0x00, 0x07, 0x18, 0x00, 0x07, 0xA0, 0x00, 0x47,
+    0x80, 0x48, 0x07, 0x21, 0x20, 0x27, 0x88, 0x8E, 0x47, 0x88, 0x40, 0x87,
+    0x50, 0x1C, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F, 0x09, 0xF9, 0x0F, 0x14, 0x02, 0x8F,
+    0x28, 0x00, 0x4F, 0x10, 0xF8, 0x8F, 0x42, 0x00, 0x2F, 0x24, 0x02, 0x4F,
+    0x01, 0x08, 0x0F, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x1F, 0x01, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x42, 0x04, 0x4F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x0C, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x0F,
+    // 0xAA 'ª'
+    0x00, 0x0F, 0x00, 0x07, 0x20, 0x47, 0x49, 0x47, 0x01, 0x07, 0xA2, 0x07,
+    0x28, 0x07, 0x00, 0x47, 0x09, 0x07, 0x40, 0x87, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x04, 0x1F, 0x01, 0x1F,
+    0x80, 0x5F, 0x20, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x20, 0x1F, 0x42, 0x1F,
+    0x00, 0x1F, 0x80, 0x1F, 0x40, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x04, 0x41, 0x30, 0x11, 0x08, 0x2D, 0x60, 0x01,
+    0x00, 0x01, 0x00, 0xA7, 0x06, 0x05, 0x28, 0x01, 0x40, 0x09, 0x10, 0x01,
+    0x04, 0x29, 0x08, 0x21, 0x00, 0x01,
+    // 0xB0 '°'
+    0x0F, 0x1F, 0x20, 0x1F, 0x00, 0x5F, 0x40, 0x1F, 0x11, 0x1F, 0x11, 0x1F,
+    0x00, 0x5F, 0x40, 0x1F, 0x20, 0x9F, 0x0E, 0x1F,
+    // 0xB1 '±'
+    0x07, 0x03, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x78, 0xF0, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x05, 0x00, 0x7F,
+    // 0xB2 '²'
+    0x00, 0x07, 0x00, 0x07, 0x10, 0x47, 0x08, 0x87, 0x10, 0x07, 0x00, 0x07,
+    0x20, 0x87, 0x09, 0x07, 0x00, 0x07, 0x44, 0x37, 0x10, 0x07,
+    // 0xB3 '³'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x51, 0x2F, 0x05, 0x07, 0x21, 0x47,
+    0x08, 0x17, 0x02, 0x27, 0x48, 0x87, 0x00, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x27, 0x00, 0x02, 0x07, 0x00, 0x60, 0x07, 0x18, 0x00, 0x27,
+    0x00, 0x04, 0x07, 0x80, 0x00, 0x07, 0x8C, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    0x00, 0x24, 0x07, 0x00, 0x48, 0x07, 0x06, 0x10, 0x07, 0x40, 0x04, 0x07,
+    0x80, 0x00, 0x07, 0x83, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x10, 0x07,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x02, 0x20, 0x03,
+    0x00, 0x00, 0x0B, 0x00, 0x08, 0x11, 0x20, 0x08, 0xC1, 0x00, 0x08, 0x01,
+    0x40, 0x00, 0x81, 0x40, 0x18, 0x09, 0x01, 0x03, 0x11, 0x10, 0x60, 0x01,
+    0x18, 0x06, 0x01, 0x00, 0xC0, 0x01, 0x18, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xB7 '·'
+    0x07, 0x47, 0x0F, 0x0F, 0x17, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x27, 0x51, 0x87, 0x40, 0x07, 0x00, 0x07,
+    0x06, 0x27, 0x40, 0x17,
+    // 0xBA 'º'
+    0x00, 0x0F, 0x07, 0x07, 0x00, 0x07, 0x00, 0x47, 0x10, 0x47, 0x21, 0x47,
+    0x82, 0x07, 0x18, 0x8F, 0x01, 0x17, 0x24, 0x07,
+    // 0xBB '»'
+    0x00, 0x1F, 0x00, 0x9F, 0x41, 0x1F, 0x82, 0x5F, 0x0C, 0x1F, 0x40, 0x1F,
+    0x20, 0x1F, 0x12, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x90, 0x5F, 0x00, 0x9F,
+    0x00, 0x1F, 0x00, 0x1F, 0x0C, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x18, 0x04, 0x03, 0x00, 0x64, 0x03,
+    0x04, 0x04, 0x03, 0x20, 0x04, 0x03, 0x01, 0x04, 0x1B, 0x30, 0x08, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x13, 0x00, 0x02, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x10, 0x03, 0x00, 0x24, 0x03, 0x00, 0x08, 0x03, 0x01, 0x00, 0x03,
+    0x00, 0x41, 0x43, 0x08, 0x82, 0x43, 0x00, 0x04, 0x43, 0x44, 0x09, 0x43,
+    0x48, 0x10, 0x43, 0x20, 0x20, 0x23, 0x00, 0x44, 0x03, 0x00, 0x00, 0x33,
+    0x00, 0x83, 0x43, 0x00, 0x60, 0x43, 0x00, 0x00, 0x03,
+    // 0xBD '½'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x18, 0x04, 0x03, 0x00, 0x64, 0x03,
+    0x04, 0x04, 0x03, 0x20, 0x04, 0x1B, 0x01, 0x04, 0x03, 0x30, 0x08, 0x03,
+    0x00, 0x01, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x10, 0x03,
+    0x00, 0x24, 0x03, 0x00, 0x80, 0x03, 0x01, 0x20, 0x03, 0x00, 0x40, 0x03,
+    0x08, 0x00, 0x33, 0x00, 0x00, 0x43, 0x44, 0x00, 0x83, 0x40, 0x10, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0xA0, 0x83, 0x00, 0xA1, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x28, 0x03,
+    // 0xBE '¾'
+    0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x14, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x20, 0x14, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x00, 0x1B, 0x21, 0x00, 0x03,
+    0x00, 0x40, 0x8B, 0x00, 0x01, 0x03, 0x00, 0x00, 0x43, 0x00, 0x08, 0x83,
+    0x00, 0x12, 0x03, 0x00, 0x04, 0x03, 0x00, 0x80, 0x03, 0x00, 0x20, 0x03,
+    0x04, 0x41, 0x43, 0x00, 0x02, 0x43, 0x22, 0x04, 0x43, 0x44, 0x09, 0x43,
+    0x40, 0x10, 0x43, 0x20, 0x20, 0x23, 0x00, 0x44, 0x03, 0x00, 0x00, 0x33,
+    0x00, 0x83, 0x43, 0x00, 0x60, 0x43, 0x00, 0x00, 0x03,
+    // 0xBF '¿'
+    0x00, 0x03, 0x8F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F, 0x02, 0x24, 0x0F,
+    0x20, 0x48, 0x1F, 0x00, 0x90, 0x0F, 0x80, 0x21, 0x0F, 0x90, 0x41, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x60, 0x3F, 0x00, 0x21, 0x20, 0x3F, 0x48, 0x04, 0x20, 0x3F,
+    0x00, 0x08, 0x20, 0xBF, 0x04, 0x00, 0xE0, 0x3F, 0x01, 0x00, 0x01, 0x3F,
+    0x00, 0x60, 0x00, 0x3F, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x60, 0x3F, 0x00, 0x21, 0x20, 0x3F, 0x08, 0x04, 0x20, 0x3F,
+    0x14, 0x08, 0x20, 0xBF, 0x04, 0x00, 0xE0, 0x3F, 0x21, 0x00, 0x01, 0x3F,
+    0x40, 0x60, 0x00, 0x3F, 0x00, 0x03, 0x00, 0x3F, 0x20, 0x00, 0x18, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0x08, 0x08, 0x60, 0x3F, 0x00, 0x21, 0x20, 0x3F, 0x04, 0x04, 0x20, 0x3F,
+    0x00, 0x08, 0x20, 0xBF, 0x00, 0x00, 0xE0, 0x3F, 0x01, 0x00, 0x01, 0x3F,
+    0x40, 0x60, 0x00, 0x3F, 0x20, 0x03, 0x00, 0x3F, 0x04, 0x00, 0x18, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x30, 0x10, 0xC0, 0x7F, 0x00, 0x42, 0x40, 0x7F, 0x80, 0x08, 0x40, 0x7F,
+    0x80, 0x10, 0x41, 0x7F, 0x00, 0x01, 0xC0, 0x7F, 0x0A, 0x00, 0x02, 0x7F,
+    0x08, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0x00, 0x7F, 0x20, 0x00, 0x30, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x04, 0x03,
+    0x00, 0x00, 0x00, 0x40, 0x21, 0x80, 0x90, 0x84, 0x80, 0x10, 0x10, 0x80,
+    0xA0, 0x20, 0x82, 0x00, 0x03, 0x80, 0x64, 0x00, 0x04, 0x91, 0x80, 0x00,
+    0x10, 0x0C, 0x00, 0xA0, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x60, 0x3F, 0x38, 0x21, 0x20, 0x3F, 0x40, 0x04, 0x20, 0x3F,
+    0x2A, 0x08, 0x20, 0xBF, 0x82, 0x00, 0xE0, 0x3F, 0xAB, 0x00, 0x01, 0x3F,
+    0x00, 0x60, 0x00, 0x3F, 0x28, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x22, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x84, 0x1F, 0x00, 0x24, 0x5F, 0x40, 0x04, 0x1F,
+    0x28, 0x04, 0x9F, 0x12, 0x10, 0x1F, 0x00, 0x80, 0x1F, 0x08, 0x00, 0x1F,
+    0x00, 0x06, 0x9F, 0x00, 0x00, 0x9F, 0x08, 0x00, 0x9F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x9F, 0x10, 0x01, 0x1F, 0x10, 0x24, 0x1F, 0x0C, 0x04, 0x5F,
+    0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x81, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x20, 0x3F, 0x20, 0x84, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0A, 0x7F, 0x00, 0x00, 0x08, 0xBF,
+    0x10, 0x00, 0x01, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x20, 0x3F,
+    0x90, 0x00, 0x00, 0x3F, 0x14, 0x02, 0x40, 0x3F, 0x02, 0x00, 0x80, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x40, 0x07, 0x01, 0x3F,
+    0x08, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x04, 0x20, 0x01, 0x3F,
+    0x10, 0x20, 0x00, 0x3F, 0x0C, 0x20, 0x48, 0x3F, 0x00, 0x00, 0x09, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x07, 0x01, 0x3F,
+    0x0C, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x04, 0x20, 0x01, 0x3F,
+    0x20, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x48, 0x3F, 0x08, 0x00, 0x09, 0x3F,
+    0x50, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x30, 0x3F, 0x00, 0x07, 0x01, 0x3F,
+    0x00, 0x20, 0x01, 0x3F, 0x20, 0x00, 0x01, 0x3F, 0x40, 0x20, 0x01, 0x3F,
+    0x10, 0x20, 0x00, 0x3F, 0x08, 0x20, 0x48, 0x3F, 0x04, 0x00, 0x09, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC0,
+    0x90, 0x1C, 0x04, 0x10, 0x80, 0x04, 0x80, 0x00, 0x04, 0x00, 0x80, 0x04,
+    0x20, 0x80, 0x00, 0x90, 0x81, 0x20, 0x10, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x20, 0x01, 0x80, 0x3F, 0x00, 0x38, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x04, 0x03, 0x00, 0xFF,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x38, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x14, 0x00, 0x18, 0x3F, 0x04, 0x03, 0x00, 0xFF,
+    0x20, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x08, 0x01, 0x80, 0x3F, 0x00, 0x38, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x03, 0x00, 0xFF,
+    0x00, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x20, 0x40, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x40, 0x06, 0x00, 0x90, 0xE0, 0x00, 0x10, 0x00, 0x00, 0xA0, 0x00, 0x60,
+    0x00, 0x0C, 0x03, 0x60, 0x80, 0x00, 0x90, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x2F, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x06, 0x0F,
+    0x50, 0x80, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x8F,
+    0x83, 0x00, 0x8F, 0x90, 0x00, 0x8F, 0x80, 0x00, 0x0F, 0x90, 0x60, 0x2F,
+    0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x04, 0x08, 0x0F, 0x00, 0x00, 0x8F,
+    0x20, 0x01, 0x0F, 0x10, 0x02, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x18, 0x3F, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x70, 0x00, 0x3F,
+    0x00, 0x00, 0x30, 0x3F, 0x00, 0x06, 0x01, 0xBF, 0x00, 0x04, 0x00, 0x3F,
+    0x01, 0x00, 0x80, 0x3F, 0x00, 0x40, 0x20, 0x3F, 0x80, 0x10, 0x08, 0x3F,
+    0x80, 0x00, 0x02, 0x3F, 0x40, 0x00, 0x80, 0x3F, 0x08, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x18, 0x00, 0xBF, 0x60, 0x00, 0x18, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x41, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x01, 0x1F,
+    0x48, 0x20, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F, 0x05, 0x20, 0x00, 0x5F,
+    0x10, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x30, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x04, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x02, 0x00, 0x1F,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x41, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x08, 0x20, 0x00, 0x1F, 0x11, 0x20, 0x00, 0x1F, 0x05, 0x20, 0x00, 0x5F,
+    0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x30, 0x9F, 0x08, 0x00, 0x00, 0x1F,
+    0x30, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x04, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x02, 0x00, 0x1F,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x41, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x04, 0x20, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x5F,
+    0x10, 0x00, 0x00, 0x1F, 0x48, 0x00, 0x30, 0x9F, 0x20, 0x00, 0x00, 0x1F,
+    0x14, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x04, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x02, 0x00, 0x1F,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x06, 0x04, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x82, 0x08, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x31, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x82, 0x40, 0x00, 0x3F, 0x02, 0x40, 0x00, 0xBF,
+    0x08, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x61, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x04, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x0C, 0x08, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x01, 0x04, 0x10, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x62, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x04, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0xA4, 0x80, 0x00, 0x7F, 0x04, 0x80, 0x01, 0x7F,
+    0x60, 0x00, 0x00, 0x7F, 0x90, 0x00, 0xC2, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x08, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x00, 0x0F, 0x10, 0x2F, 0x08, 0x0F, 0x44, 0x2F, 0x20, 0x4F, 0x00, 0x8F,
+    0x00, 0x8F, 0x00, 0x4F, 0x04, 0x2F, 0x08, 0x0F, 0x10, 0x2F, 0x00, 0x0F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x5F, 0x01, 0x81, 0x8F, 0x04, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x21, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0x48, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x90, 0x00, 0x0F,
+    0x90, 0x00, 0x2F, 0x00, 0x82, 0x0F, 0x09, 0x08, 0x4F, 0x01, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x58, 0x08, 0x0F, 0xA0, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0x40, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x24, 0x1F, 0x00, 0x06, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x08, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x04, 0x00, 0x04, 0x5F, 0x10, 0xC0, 0x10, 0x1F,
+    0x0C, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x01, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDA 'Ú'
+    0x00, 0x40, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x24, 0x1F, 0x00, 0x06, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x04, 0x00, 0x04, 0x5F, 0x20, 0xC0, 0x10, 0x1F,
+    0x00, 0x03, 0x00, 0x1F, 0x08, 0x00, 0x02, 0x1F, 0x30, 0x00, 0x08, 0x1F,
+    0x00, 0x01, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDB 'Û'
+    0x00, 0x40, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x24, 0x1F, 0x00, 0x06, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x04, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x04, 0x5F, 0x10, 0xC0, 0x10, 0x1F,
+    0x48, 0x03, 0x00, 0x1F, 0x20, 0x00, 0x02, 0x1F, 0x10, 0x00, 0x08, 0x1F,
+    0x00, 0x01, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDC 'Ü'
+    0x01, 0x00, 0x78, 0x7F, 0x00, 0x0C, 0x02, 0x7F, 0x00, 0x80, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x90, 0x7F, 0x00, 0x18, 0x00, 0x7F,
+    0x60, 0x80, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F, 0x12, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x11, 0x7F, 0x23, 0x00, 0x40, 0x7F,
+    0x90, 0x0C, 0x00, 0x7F, 0x10, 0x00, 0x08, 0x7F, 0x80, 0x00, 0x20, 0x7F,
+    0x00, 0x06, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x19, 0x1F,
+    0x01, 0x84, 0x7F, 0x1A, 0x00, 0x1F, 0x0A, 0x08, 0x1F, 0x28, 0x12, 0x1F,
+    0x00, 0xC0, 0x1F, 0x00, 0x04, 0x1F, 0x04, 0x08, 0x1F, 0x02, 0x10, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x18, 0x0F, 0x00, 0x03, 0x00, 0x4F, 0x00, 0x20, 0x01, 0x0F,
+    0x02, 0x00, 0x0C, 0x0F, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x18, 0x30, 0x0F,
+    0x03, 0x00, 0x08, 0x0F, 0x48, 0x00, 0x40, 0x0F, 0x10, 0x28, 0x20, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x01, 0x00, 0x20, 0x0F, 0x1C, 0x50, 0x48, 0x0F,
+    0x00, 0x88, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x3C, 0x01, 0xC0, 0x0F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x41, 0xE1, 0x00, 0x08, 0x11, 0x50, 0x90, 0x21, 0x88, 0x00, 0x41,
+    0x40, 0x21, 0x21, 0x00, 0x84, 0x05, 0x08, 0x40, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x82, 0x05, 0x00, 0xA0, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE1 'á'
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x20, 0xF0, 0x00, 0x04, 0x08, 0x00, 0x48, 0x10, 0x00, 0x00, 0x20,
+    0x00, 0x10, 0x90, 0x08, 0x42, 0x02, 0x02, 0x20, 0x00, 0x44, 0x40, 0x00,
+    0x40, 0x41, 0x02, 0x30, 0x50, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xE2 'â'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x41, 0xE1, 0x00, 0x08, 0x11, 0x00, 0x90, 0x21, 0x04, 0x00, 0x41,
+    0x48, 0x21, 0x21, 0x10, 0x84, 0x05, 0x00, 0x40, 0x01, 0x44, 0x80, 0x01,
+    0x10, 0x82, 0x05, 0x00, 0xA0, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x13, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x83, 0xC3, 0x30, 0x10, 0x23, 0x49, 0x20, 0x43, 0x00, 0x00, 0x83,
+    0x00, 0x42, 0x43, 0x01, 0x08, 0x0B, 0x08, 0x80, 0x03, 0x29, 0x00, 0x03,
+    0x01, 0x04, 0x0B, 0x01, 0x40, 0x43, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x27, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x01, 0x07, 0x87, 0x60, 0x20, 0x47, 0x92, 0x40, 0x87, 0x90, 0x01, 0x07,
+    0xA0, 0x84, 0x87, 0x02, 0x10, 0x17, 0x61, 0x00, 0x07, 0x92, 0x00, 0x07,
+    0x92, 0x08, 0x17, 0xA2, 0x80, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xE5 'å'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x41, 0xE1, 0x00, 0x08, 0x11, 0x18, 0x90, 0x21, 0x40, 0x00, 0x41,
+    0x2A, 0x21, 0x21, 0x80, 0x84, 0x05, 0x82, 0x40, 0x01, 0x00, 0x80, 0x01,
+    0x48, 0x82, 0x05, 0x00, 0xA0, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xE6 'æ'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x01, 0x20, 0x01, 0x41, 0xE1, 0x08, 0x11,
+    0x90, 0x21, 0x80, 0x41, 0x21, 0x01, 0x84, 0x09, 0x90, 0x05, 0x00, 0x01,
+    0x45, 0x01, 0x10, 0x11, 0xA2, 0x91, 0xA4, 0x05, 0x19, 0x21, 0x80, 0x09,
+    0x84, 0x51, 0x70, 0x01,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x07, 0x02, 0x08, 0x07, 0x00, 0x04, 0x0F, 0x20, 0x00, 0x0F,
+    0x03, 0xC1, 0x47, 0x08, 0x01, 0x17, 0x90, 0x00, 0x27, 0x80, 0x04, 0x07,
+    0x00, 0x20, 0x07, 0x90, 0x08, 0x07, 0x80, 0x30, 0x07, 0x60, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x45, 0x01, 0x50, 0x10, 0x11, 0x88, 0xA2, 0x91, 0x40, 0xA4, 0x05,
+    0x00, 0x19, 0x21, 0x08, 0x82, 0x09, 0x00, 0x84, 0x51, 0x00, 0x30, 0x01,
+    // 0xE9 'é'
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+    0x00, 0x22, 0x80, 0x00, 0x08, 0x08, 0x00, 0x51, 0x48, 0x00, 0x52, 0x02,
+    0x08, 0x0C, 0x90, 0x02, 0x41, 0x04, 0x44, 0x42, 0x28, 0x48, 0x18, 0x00,
+    0x30, 0x00, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x45, 0x01, 0x00, 0x10, 0x11, 0x04, 0xA2, 0x91, 0x48, 0xA4, 0x05,
+    0x10, 0x19, 0x21, 0x00, 0x82, 0x09, 0x44, 0x84, 0x51, 0x10, 0x30, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x07, 0x00, 0x18, 0x27, 0x00, 0x00, 0x17, 0x00, 0x80, 0x07,
+    0x61, 0x14, 0x07, 0x90, 0x40, 0x47, 0x92, 0x8A, 0x47, 0xA2, 0x90, 0x17,
+    0x00, 0x64, 0x87, 0x62, 0x08, 0x27, 0x92, 0x11, 0x47, 0x90, 0xC0, 0x07,
+    0xA0, 0x00, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x65, 0x00, 0x22, 0x01, 0x00, 0x90, 0x01,
+    0x88, 0x80, 0x01, 0x04, 0x01, 0x05, 0x10, 0x90, 0x21, 0x0C, 0x00, 0x11,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x00, 0x11, 0x00, 0x00, 0x48, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0x08, 0x48, 0x10, 0x02, 0x00, 0x08,
+    0x44, 0x00, 0x00, 0x48, 0x00, 0x00, 0x20, 0x00, 0x00,
+    // 0xEE 'î'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x65, 0x00, 0x22, 0x01, 0x00, 0x90, 0x01,
+    0x24, 0x80, 0x01, 0x48, 0x01, 0x05, 0x10, 0x90, 0x21, 0x08, 0x00, 0x11,
+    0x40, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x07, 0x01, 0x81, 0x97, 0x40, 0x88, 0x07, 0x92, 0x40, 0x07,
+    0x92, 0x00, 0x07, 0x60, 0x04, 0x17, 0x02, 0x40, 0x87, 0x40, 0x00, 0x47,
+    0x90, 0x00, 0x07, 0x90, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x06, 0xC3, 0x00, 0x10, 0x23, 0x20, 0x20, 0x23, 0x95, 0x00, 0x03,
+    0x81, 0x00, 0x0B, 0x42, 0x21, 0x03, 0x40, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x82, 0x01, 0x03, 0x00, 0x78, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x33, 0x00, 0x43, 0x03, 0x01, 0x20, 0x03,
+    0x01, 0x00, 0x0B, 0x30, 0x00, 0x83, 0x49, 0x44, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x83, 0x09, 0x18, 0x03, 0x28, 0x00, 0x03,
+    0x00, 0x00, 0xC3, 0x00, 0x0C, 0x0B, 0x00, 0x00, 0x53, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x43, 0xE1, 0x00, 0x08, 0x11, 0x50, 0x80, 0x01, 0x88, 0xA0, 0x01,
+    0x40, 0x00, 0x25, 0x00, 0x11, 0x81, 0x08, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x21, 0xF0, 0x00, 0x04, 0x08, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x12, 0x08, 0x08, 0xC0, 0x12, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x43, 0xE1, 0x04, 0x08, 0x11, 0x00, 0x80, 0x01, 0x00, 0xA0, 0x01,
+    0x48, 0x00, 0x25, 0x10, 0x11, 0x81, 0x00, 0x80, 0x01, 0x44, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x20, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x87, 0xC3, 0x10, 0x10, 0x23, 0x49, 0x00, 0x03, 0x11, 0x40, 0x03,
+    0x00, 0x00, 0x4B, 0x00, 0x23, 0x03, 0x09, 0x00, 0x03, 0x28, 0x00, 0x03,
+    0x40, 0x00, 0x03, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0x40, 0x07, 0x00, 0x80, 0x07,
+    0x01, 0x0F, 0x87, 0x20, 0x20, 0x47, 0x92, 0x00, 0x07, 0x92, 0x80, 0x07,
+    0xA0, 0x00, 0x97, 0x00, 0x46, 0x07, 0x62, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xF7 '÷'
+    0x06, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x60, 0x77, 0x80, 0x07,
+    0x80, 0x07, 0x00, 0x57, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x10, 0x00,
+    0x21, 0x50, 0x04, 0x20, 0x40, 0x40, 0x50, 0x08, 0x10, 0x12, 0x08, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x50, 0x00, 0x60, 0x00, 0x00, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x69, 0x00, 0xA2, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x21, 0x00, 0x83, 0x11, 0x00, 0x70, 0x01, 0x88, 0x00, 0x09,
+    0x04, 0x00, 0x81, 0x00, 0x02, 0x39, 0x0C, 0x30, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xE1, 0x00, 0x98, 0x01, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x34, 0x00, 0x51, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x40, 0x10, 0x00, 0x41, 0x88, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x40, 0x08, 0x01, 0x1C, 0x02, 0x18, 0x00, 0x44, 0x40, 0x00,
+    0x48, 0x40, 0x70, 0x20, 0x4C, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0xFB 'û'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x69, 0x00, 0xA2, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x21, 0x00, 0x83, 0x11, 0x00, 0x70, 0x01, 0x24, 0x00, 0x09,
+    0x48, 0x00, 0x81, 0x10, 0x02, 0x39, 0x08, 0x30, 0x01, 0x40, 0x80, 0x01,
+    0x10, 0x80, 0xE1, 0x00, 0x98, 0x01, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x07, 0x00, 0x81, 0xA7, 0x02, 0x88, 0x07, 0x02, 0x00, 0x07,
+    0x02, 0x00, 0x87, 0x42, 0x0C, 0x47, 0x91, 0xC0, 0x07, 0x90, 0x00, 0x27,
+    0x60, 0x02, 0x07, 0x00, 0x08, 0xE7, 0x40, 0xC0, 0x07, 0x92, 0x00, 0x07,
+    0x92, 0x03, 0x87, 0x62, 0x60, 0x07, 0x02, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x0C, 0x1F, 0x00, 0x01, 0x80, 0x1F, 0x10, 0x18, 0x00, 0x1F,
+    0x53, 0x00, 0x06, 0x9F, 0x00, 0x00, 0x48, 0x1F, 0x00, 0x22, 0x20, 0x7F,
+    0x01, 0x08, 0x00, 0x1F, 0x58, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x48, 0x1F,
+    0x01, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x00, 0x7C, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x5F,
+    0x02, 0x00, 0x02, 0x1F, 0x22, 0x18, 0x04, 0x1F, 0x12, 0x00, 0x00, 0x1F,
+    0x90, 0x00, 0x00, 0x1F, 0x80, 0x70, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x1F,
+    0x20, 0x02, 0x20, 0x1F, 0x12, 0x98, 0x40, 0x1F, 0x92, 0x01, 0x00, 0x1F,
+    0x80, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x80, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x04, 0x30, 0x00, 0x7F, 0x10, 0x90, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F,
+    0x04, 0x10, 0x40, 0x7F, 0x00, 0x70, 0x09, 0x7F, 0x80, 0x00, 0x90, 0x7F,
+    0x30, 0x00, 0x04, 0xFF, 0x01, 0x80, 0x12, 0xFF, 0x00, 0x0C, 0x02, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x105 'ą'
+    0x00, 0x00, 0x0F, 0x02, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x41, 0xE0, 0x0F, 0x08, 0x10, 0x0F, 0x90, 0x20, 0x0F, 0x00, 0x40, 0x0F,
+    0x21, 0x20, 0x0F, 0x84, 0x04, 0x2F, 0x40, 0x02, 0x0F, 0x80, 0x01, 0x5F,
+    0x82, 0x00, 0x0F, 0xA0, 0x20, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x02, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x41, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x0C, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x05, 0x20, 0x00, 0x5F,
+    0x21, 0x20, 0x00, 0x1F, 0x00, 0x28, 0x04, 0x9F, 0x08, 0x04, 0x01, 0x1F,
+    0x70, 0x80, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x1F,
+    // 0x107 'ć'
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+    0x00, 0x01, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00, 0x40, 0x02,
+    0x08, 0x00, 0x10, 0x02, 0x48, 0x04, 0x44, 0x40, 0x18, 0x48, 0x30, 0x00,
+    0x30, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x02, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x41, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x40, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x11, 0x20, 0x00, 0x5F,
+    0x05, 0x20, 0x00, 0x1F, 0x00, 0x28, 0x04, 0x9F, 0x40, 0x04, 0x01, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x40, 0x60, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x03, 0xC1, 0x90, 0x08, 0x01, 0x84, 0x90, 0x01, 0x20, 0x80, 0x05,
+    0x00, 0x00, 0x21, 0x00, 0x90, 0x09, 0x00, 0x80, 0x31, 0x80, 0x60, 0x01,
+    0xC0, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x0C, 0x1F, 0x00, 0xA1, 0x80, 0x1F, 0x00, 0x30, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x31, 0x1F, 0x41, 0x06, 0x01, 0x1F,
+    0x09, 0x20, 0x01, 0x1F, 0x05, 0x00, 0x00, 0x1F, 0x11, 0x20, 0x00, 0x5F,
+    0x10, 0x00, 0x00, 0x1F, 0x04, 0x10, 0x00, 0x1F, 0x08, 0x08, 0x10, 0x1F,
+    0x10, 0x00, 0x01, 0x1F, 0x20, 0x40, 0x02, 0x1F, 0x40, 0x20, 0x04, 0x1F,
+    0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x13, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x83, 0xC3, 0x00, 0x10, 0x23, 0x01, 0x20, 0x43, 0x00, 0x00, 0x83,
+    0x00, 0x42, 0x43, 0x11, 0x08, 0x0B, 0x50, 0x00, 0x03, 0x18, 0x00, 0x03,
+    0x00, 0x0C, 0x0B, 0x00, 0xC0, 0x43, 0x4C, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x18, 0x00, 0x03, 0x02, 0x00, 0x03, 0x08, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x06, 0x00, 0x7F, 0x00, 0xC0, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x18, 0x00, 0x7F, 0x03, 0x80, 0x80, 0x7F,
+    0x10, 0x00, 0x89, 0x7F, 0x00, 0x00, 0x90, 0x7F, 0x10, 0x00, 0x8C, 0xFF,
+    0x10, 0x00, 0x12, 0xFF, 0x10, 0x24, 0x02, 0x7F, 0x00, 0x04, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x0F, 0x06, 0x08, 0x0F, 0x00, 0x04, 0x0F, 0x20, 0x00, 0x0F,
+    0x45, 0x00, 0xAF, 0x10, 0x12, 0x0F, 0xA2, 0x91, 0x5F, 0xA4, 0x00, 0x0F,
+    0x19, 0x24, 0x0F, 0x82, 0x08, 0x0F, 0x84, 0x50, 0x0F, 0x30, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x07, 0x01, 0x3F,
+    0x40, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x10, 0x20, 0x01, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x48, 0x3F, 0x40, 0x00, 0x09, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x45, 0x01, 0x90, 0x10, 0x11, 0x84, 0xA2, 0x91, 0x20, 0xA4, 0x05,
+    0x00, 0x19, 0x21, 0x00, 0x82, 0x09, 0x00, 0x84, 0x51, 0x80, 0x30, 0x01,
+    0xC0, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x14, 0x00, 0x10, 0x3F, 0x04, 0x03, 0x01, 0x3F,
+    0x20, 0x20, 0x01, 0x3F, 0x40, 0x00, 0x01, 0x3F, 0x00, 0x40, 0x01, 0x3F,
+    0x20, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x2F, 0x00, 0x40, 0x60, 0x0F,
+    0x01, 0x44, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x30, 0x2F,
+    0x00, 0x03, 0x01, 0x0F, 0x09, 0x60, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x50, 0x00, 0x00, 0x0F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x87,
+    0x00, 0x30, 0x07, 0x06, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x60, 0x27, 0x04, 0x00, 0x27, 0x00, 0x00, 0x27, 0x08, 0x00, 0x27,
+    0x00, 0x00, 0x87, 0x30, 0x00, 0x0F, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x8B, 0x10, 0x18, 0x03, 0x51, 0x00, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x0C, 0x0B, 0x00, 0xC0, 0x43, 0x58, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x02, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x2E, 0x1F,
+    0x00, 0xC0, 0x1F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F,
+    0x01, 0x00, 0x9F, 0x11, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x21, 0x00, 0x9F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x05, 0x8B, 0x10, 0x00, 0x03,
+    0x51, 0x00, 0x03, 0x00, 0x00, 0x43, 0x00, 0x0C, 0x0B, 0x00, 0x80, 0x43,
+    0x58, 0x80, 0x23, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x0C, 0x1F, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x38, 0x00, 0x1F,
+    0x00, 0x00, 0x18, 0x1F, 0x00, 0x03, 0x00, 0xDF, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x80, 0x40, 0x1F, 0x00, 0x20, 0x10, 0x1F, 0x00, 0x08, 0x04, 0x1F,
+    0x14, 0x00, 0x01, 0x1F, 0x04, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x48, 0x00, 0x40, 0x1F, 0x00, 0x0C, 0x00, 0x5F, 0x00, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x0C, 0x00, 0x10, 0xC0, 0x00, 0x48, 0x00,
+    0x00, 0x40, 0x02, 0x00, 0x00, 0x20, 0x00, 0x51, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x02, 0x46, 0x00, 0x44, 0x00, 0x00,
+    0x48, 0x00, 0x30, 0x30, 0x03, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x0C, 0x1F, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x38, 0x00, 0x1F,
+    0x00, 0x00, 0x18, 0x1F, 0x00, 0x03, 0x00, 0xDF, 0x00, 0x02, 0x00, 0x1F,
+    0x50, 0x80, 0x40, 0x1F, 0x08, 0x20, 0x10, 0x1F, 0x24, 0x08, 0x04, 0x1F,
+    0x10, 0x00, 0x01, 0x1F, 0x10, 0x00, 0x40, 0x1F, 0x20, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x10, 0x0C, 0x00, 0x5F, 0x20, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x19, 0x00, 0x21, 0x81, 0x00, 0x90, 0x01,
+    0x00, 0x80, 0x05, 0x00, 0x00, 0x41, 0x10, 0xA2, 0x01, 0x84, 0x20, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0xC1, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x61, 0xC0, 0x06, 0x05, 0x00, 0x00, 0x29, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x0F, 0x00, 0x81, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x2F, 0x01, 0x02, 0x0F, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x18, 0x0F, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x8F,
+    0x00, 0x00, 0x8F, 0x0C, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F,
+    0x10, 0x00, 0x0F, 0x10, 0x02, 0x0F, 0x10, 0x44, 0x2F, 0x00, 0x03, 0x0F,
+    0x00, 0x00, 0x0F, 0x70, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x00, 0x01, 0x04, 0x01, 0x10, 0x05, 0x20, 0x01, 0x43, 0xE1, 0x08, 0x11,
+    0x80, 0x01, 0xA0, 0x01, 0x00, 0x21, 0x91, 0x89, 0x80, 0x09, 0x40, 0x05,
+    0x20, 0x01, 0x05, 0x01, 0x10, 0x11, 0xA2, 0x91, 0xA4, 0x05, 0x19, 0x21,
+    0x82, 0x09, 0x04, 0x31, 0x30, 0x01,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x0C, 0x1F, 0x00, 0xA1, 0x80, 0x1F, 0x00, 0x30, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x10, 0x00, 0x10, 0x1F, 0x40, 0x06, 0x80, 0x9F,
+    0x21, 0x00, 0x88, 0x1F, 0x11, 0x00, 0x02, 0x1F, 0x00, 0x01, 0x00, 0x1F,
+    0x20, 0x12, 0x10, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x82, 0x1F,
+    0x00, 0x41, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    // 0x159 'ř'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x83, 0x00, 0x98, 0x03,
+    0x00, 0x80, 0x07, 0x90, 0x00, 0x23, 0x84, 0xB9, 0x03, 0x20, 0x04, 0x03,
+    0x00, 0x48, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x80, 0x03,
+    0xC0, 0x60, 0x03, 0x00, 0x00, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x1E, 0x10, 0x5F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x80, 0x01, 0x1F, 0x00, 0x04, 0x21, 0x1F, 0x00, 0x02, 0x01, 0x1F,
+    0x15, 0x00, 0x0A, 0x1F, 0x05, 0x00, 0x00, 0x5F, 0x00, 0x20, 0x80, 0x9F,
+    0x48, 0x04, 0x41, 0x1F, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0xB0, 0x00, 0x1F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x44, 0x40, 0x00, 0x50, 0x30,
+    0x06, 0x10, 0x00, 0x10, 0x00, 0x04, 0x00, 0x48, 0x48, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x1E, 0x10, 0x5F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x40, 0x80, 0x01, 0x1F, 0x08, 0x04, 0x21, 0x1F, 0x04, 0x02, 0x01, 0x1F,
+    0x11, 0x00, 0x0A, 0x1F, 0x11, 0x00, 0x00, 0x5F, 0x20, 0x20, 0x80, 0x9F,
+    0x08, 0x04, 0x41, 0x1F, 0x10, 0x00, 0x1C, 0x1F, 0x20, 0xB0, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x161 'š'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x00, 0x00, 0x45, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x11, 0x88, 0x88, 0x81, 0x40, 0xA0, 0x61,
+    0x00, 0x20, 0x01, 0x24, 0x00, 0x09, 0x48, 0x90, 0x91, 0x00, 0x60, 0x01,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0xC4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x20, 0x06, 0x3F, 0x00, 0x20, 0x60, 0x3F,
+    0x10, 0x2C, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x0C, 0x3F,
+    0x10, 0x01, 0x80, 0x3F, 0x10, 0x18, 0x00, 0x3F, 0x20, 0x20, 0x00, 0x3F,
+    0x40, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x06, 0x0B, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x03, 0x08, 0x01, 0xC3, 0x00, 0x30, 0x03, 0x07, 0x00, 0x0B,
+    0x01, 0x00, 0x03, 0x19, 0x00, 0x03, 0x85, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x40, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x40, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x24, 0x1F, 0x00, 0x06, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x18, 0x00, 0x00, 0x1F, 0x40, 0x80, 0x00, 0x1F,
+    0x1A, 0x00, 0x02, 0x1F, 0x82, 0x00, 0x04, 0x5F, 0x82, 0xC0, 0x10, 0x1F,
+    0x10, 0x03, 0x00, 0x1F, 0x40, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x01, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x69, 0x00, 0xA2, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x21, 0x00, 0x83, 0x11, 0x24, 0x70, 0x01, 0x02, 0x00, 0x09,
+    0xA2, 0x00, 0x81, 0x80, 0x02, 0x39, 0xAA, 0x30, 0x01, 0x00, 0x80, 0x01,
+    0x38, 0x80, 0xE1, 0x00, 0x98, 0x01, 0x00, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0x170 'Ű'
+    0x00, 0x40, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x24, 0x1F, 0x00, 0x06, 0x00, 0x1F,
+    0x0C, 0x20, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x04, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x48, 0x00, 0x04, 0x5F, 0x00, 0xC0, 0x10, 0x1F,
+    0x28, 0x03, 0x00, 0x1F, 0x10, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x01, 0x80, 0x1F, 0x48, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x20, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x69, 0x00, 0xA2, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0x21, 0x04, 0x83, 0x11, 0x10, 0x70, 0x01, 0x04, 0x00, 0x09,
+    0x08, 0x00, 0x81, 0x10, 0x02, 0x39, 0x08, 0x30, 0x01, 0x00, 0x80, 0x01,
+    0x40, 0x80, 0xE1, 0x00, 0x98, 0x01, 0x60, 0x80, 0x09, 0x00, 0x00, 0x01,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x11, 0x04, 0x00,
+    0x00, 0x04, 0x30, 0x40, 0x08, 0x80, 0x00, 0x20, 0x00, 0x10, 0x44, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x60, 0x08, 0x1F, 0x00, 0x04, 0x10, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x01, 0x1F, 0x08, 0x22, 0x01, 0x1F,
+    0x14, 0x24, 0x21, 0x1F, 0x04, 0x00, 0x41, 0x1F, 0x20, 0x20, 0x81, 0x1F,
+    0x40, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x08, 0x00, 0x9F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x1F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1C, 0x10, 0x00, 0x02, 0x22,
+    0x00, 0x44, 0x40, 0x00, 0x40, 0x90, 0x00, 0x41, 0x22, 0x00, 0x08, 0x40,
+    0x08, 0x00, 0x80, 0x12, 0x20, 0x00, 0x40, 0x20, 0x20, 0x00, 0x00, 0x22,
+    0x30, 0x40, 0x08, 0x00, 0x20, 0x00,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0xC0, 0x10, 0x3F, 0x00, 0x08, 0x20, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x02, 0x3F, 0x00, 0x44, 0x02, 0x3F,
+    0x48, 0x48, 0x42, 0x3F, 0x08, 0x00, 0x82, 0x3F, 0x00, 0x41, 0x02, 0x3F,
+    0x60, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0xC0, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x70, 0x43, 0x00, 0x08, 0x8B,
+    0x01, 0x11, 0x03, 0x01, 0x02, 0x43, 0x01, 0x04, 0x8B, 0x48, 0x21, 0x03,
+    0x08, 0x02, 0x03, 0x00, 0x80, 0x03, 0x60, 0x80, 0x83, 0x00, 0x00, 0x8B,
+    0x01, 0x00, 0x23, 0x00, 0x80, 0x03,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x60, 0x08, 0x1F, 0x00, 0x04, 0x10, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x60, 0x20, 0x00, 0x1F, 0x08, 0x20, 0x01, 0x1F, 0x04, 0x22, 0x01, 0x1F,
+    0x00, 0x24, 0x21, 0x1F, 0x10, 0x00, 0x41, 0x1F, 0x04, 0x20, 0x81, 0x1F,
+    0x08, 0x00, 0x04, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x20, 0x08, 0x00, 0x9F,
+    0x40, 0x10, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x38, 0x21, 0x00, 0x04, 0x45,
+    0x00, 0x88, 0x81, 0x10, 0x81, 0x21, 0x80, 0x82, 0x45, 0x20, 0x10, 0x81,
+    0x00, 0x01, 0x01, 0x24, 0x40, 0x01, 0x40, 0x40, 0x41, 0x80, 0x00, 0x45,
+    0x80, 0x80, 0x11, 0x00, 0x40, 0x01,
+    // 0x3C0 'π'
+    0x00, 0x05, 0x00, 0x01, 0x40, 0x21, 0x10, 0x81, 0x02, 0x01, 0x90, 0x11,
+    0x80, 0x81, 0x8C, 0x01, 0x80, 0x39, 0x83, 0x01, 0x90, 0x01, 0x80, 0x01,
+    0x86, 0x05, 0x90, 0x01, 0x80, 0x29, 0x80, 0x01, 0xC0, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x30, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x6F, 0x00, 0x04, 0x0F,
+    0x00, 0xC0, 0x4F, 0x44, 0x02, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x8F,
+    0x81, 0x00, 0x0F, 0x80, 0x10, 0x0F, 0x10, 0x08, 0x8F, 0x01, 0x02, 0x2F,
+    0x40, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x10, 0x09, 0x0F,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x07, 0x7F, 0x10, 0xFF, 0x20, 0xFF, 0x46, 0x7F, 0x10, 0x7F, 0x40, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x00, 0xFF, 0x04, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F,
+    // 0x201A '‚'
+    0x01, 0x7F, 0x04, 0xFF, 0x10, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x30, 0x7F,
+    // 0x201B '‛'
+    0x30, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x42, 0x3F, 0x00, 0xBF,
+    // 0x201C '“'
+    0x07, 0x7F, 0x10, 0xFF, 0x20, 0xFF, 0x46, 0x7F, 0x10, 0x7F, 0x40, 0x7F,
+    0x08, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x08, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x02, 0x7F, 0x08, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x88, 0x7F,
+    0x01, 0x7F, 0x04, 0x7F, 0xB1, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x60, 0x7F,
+    // 0x201E '„'
+    0x01, 0x7F, 0x04, 0xFF, 0x10, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x31, 0x7F,
+    0x02, 0xFF, 0x38, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x70, 0x7F,
+    // 0x201F '‟'
+    0x30, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x42, 0x3F, 0x00, 0xBF,
+    0x44, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x62, 0x3F, 0x00, 0xBF,
+    // 0x2020 '†'
+    0x02, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x05, 0x01, 0x3F, 0x05, 0x10, 0x3F,
+    0x01, 0x80, 0x3F, 0x00, 0x06, 0x3F, 0x01, 0x00, 0x3F, 0x15, 0x00, 0x3F,
+    0x05, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x02, 0x01, 0x07, 0x04, 0x05, 0x17,
+    0x05, 0x05, 0xC7, 0x05, 0x3C, 0x07, 0x01, 0x80, 0x07, 0x00, 0x0C, 0x07,
+    0x01, 0xE5, 0x07, 0x15, 0x05, 0x07, 0x05, 0x01, 0x07, 0x04, 0x02, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2022 '•'
+    0x03, 0x03, 0x07, 0x83, 0x87, 0x03, 0x73,
+    // 0x2026 '…'
+    0x77, 0x07, 0x87, 0x97, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x87, 0x87,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x07, 0x87, 0x87, 0x67,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x04, 0x1F, 0x01, 0x1F,
+    0x80, 0x5F, 0x20, 0x1F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x00, 0x9F, 0x41, 0x1F, 0x82, 0x5F, 0x0C, 0x1F, 0x40, 0x1F,
+    0x20, 0x1F, 0x12, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x01, 0x8F, 0x48, 0x2F, 0x00, 0x2F,
+    0x20, 0x47, 0x01, 0x17, 0x00, 0x07, 0x40, 0x47, 0x33, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x07, 0x01, 0x07, 0x02, 0x07, 0x04, 0x07, 0x08, 0x07, 0x10, 0x07,
+    0x28, 0x0F, 0x48, 0x0F, 0x00, 0x27, 0x0C, 0x07, 0x00, 0xC7,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x18, 0x2F, 0x00, 0x2F, 0x02, 0x07,
+    0x01, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x60, 0x07,
+    // 0x2076 '⁶'
+    0x03, 0x67, 0x08, 0x07, 0x10, 0x07, 0x22, 0x2F, 0x0A, 0x0F, 0x50, 0x2F,
+    0x00, 0x87, 0x24, 0x17, 0x22, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x18, 0x17, 0x00, 0x4F, 0x10, 0x0F, 0x02, 0x27, 0x00, 0x07, 0x01, 0x07,
+    0x00, 0x07, 0x08, 0x07, 0x10, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x07, 0x00, 0x87, 0x18, 0x07, 0x02, 0x4F, 0x41, 0x0F, 0x00, 0x0F,
+    0x04, 0x27, 0x28, 0x07, 0x00, 0x07, 0x40, 0xC7, 0x30, 0x07,
+    // 0x2079 '⁹'
+    0x00, 0x17, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x2F, 0x0C, 0x07, 0x22, 0x47,
+    0x22, 0x87, 0x02, 0x27, 0x00, 0x47, 0x00, 0x07, 0x1C, 0x07,
+    // 0x2080 '₀'
+    0x00, 0x07, 0x04, 0x17, 0x10, 0x07, 0x00, 0x8F, 0x48, 0x2F, 0x00, 0x2F,
+    0x00, 0x07, 0x01, 0x17, 0x00, 0x07, 0x40, 0x47, 0x33, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x07, 0x00, 0x07, 0x10, 0x27, 0x11, 0x87, 0x40, 0x07, 0x00, 0x07,
+    0x06, 0x27, 0x60, 0x17,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x07, 0x10, 0x47, 0x00, 0x87, 0x50, 0x07, 0x00, 0x27,
+    0x00, 0xA7, 0x08, 0x27, 0x00, 0x27, 0x40, 0x37, 0x10, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x51, 0x2F, 0x01, 0x0F, 0x21, 0x47,
+    0x18, 0x17, 0x02, 0x27, 0x00, 0x87, 0x00, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x07, 0x02, 0x07, 0x04, 0x07, 0x08, 0x07, 0x10, 0x07,
+    0x20, 0x0F, 0x48, 0x0F, 0x00, 0x27, 0x0C, 0x07, 0x00, 0xC7,
+    // 0x2085 '₅'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x18, 0x0F, 0x02, 0x2F, 0x02, 0x07,
+    0x01, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x60, 0x07,
+    // 0x2086 '₆'
+    0x03, 0xE7, 0x00, 0x07, 0x10, 0x0F, 0x20, 0x2F, 0x0A, 0x0F, 0x50, 0x2F,
+    0x00, 0x87, 0x04, 0x17, 0x22, 0x27, 0x20, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x18, 0x17, 0x00, 0x4F, 0x10, 0x0F, 0x02, 0x17, 0x00, 0x07, 0x01, 0x07,
+    0x00, 0x07, 0x08, 0x07, 0x10, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x07, 0x00, 0x87, 0x09, 0x07, 0x02, 0x4F, 0x41, 0x0F, 0x00, 0x0F,
+    0x24, 0x2F, 0x28, 0x07, 0x00, 0x17, 0x44, 0xC7, 0x30, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x17, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x2F, 0x0C, 0x07, 0x02, 0xC7,
+    0x20, 0x97, 0x02, 0x27, 0x00, 0x47, 0x00, 0x87, 0x1C, 0x07,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0xC0, 0x0F, 0x00, 0x40, 0x0F,
+    0x01, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x08, 0x00, 0x0F, 0x10, 0x46, 0x0F,
+    0x23, 0x41, 0x0F, 0x01, 0x40, 0x0F, 0x49, 0x40, 0x8F, 0x41, 0x40, 0x8F,
+    0x11, 0x50, 0x8F, 0x11, 0x80, 0x2F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x40, 0x00, 0x0F, 0x18, 0x00, 0x0F,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x40, 0x7F, 0x20, 0x7F, 0x2C, 0x7F, 0x00, 0x7F, 0x0C, 0xFF,
+    0x20, 0x3F, 0x30, 0x3F, 0x10, 0xFF, 0x01, 0x7F, 0x48, 0x7F, 0x04, 0x3F,
+    0x0E, 0x3F, 0x60, 0x3F, 0x00, 0x3F, 0x10, 0xFF, 0x4E, 0x7F, 0x00, 0x7F,
+    0x20, 0xFF, 0x40, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x18, 0x04, 0x03, 0x00, 0x64, 0x03,
+    0x04, 0x04, 0x03, 0x20, 0x04, 0x03, 0x01, 0x04, 0x23, 0x30, 0x08, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x02, 0x23, 0x00, 0x04, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x08, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03,
+    0x08, 0x80, 0x13, 0x10, 0x00, 0x23, 0x00, 0x30, 0x23, 0x48, 0x10, 0x23,
+    0x10, 0x04, 0x03, 0x00, 0xA0, 0x43, 0x00, 0xA8, 0x03, 0x00, 0x80, 0x23,
+    0x00, 0x00, 0x43, 0x00, 0x30, 0x03,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x03, 0x00, 0x14, 0x03, 0x0C, 0x24, 0x03, 0x00, 0x04, 0x03,
+    0x20, 0x14, 0x03, 0x00, 0x34, 0x03, 0x01, 0x14, 0x03, 0x08, 0x14, 0x0B,
+    0x20, 0x14, 0x43, 0x00, 0x08, 0x8B, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x43,
+    0x00, 0x08, 0x03, 0x00, 0x02, 0x03, 0x00, 0x40, 0x03, 0x00, 0x90, 0x03,
+    0x00, 0x20, 0x03, 0x04, 0x00, 0x13, 0x01, 0x00, 0x23, 0x22, 0x30, 0x23,
+    0x00, 0x10, 0x23, 0x00, 0x04, 0x03, 0x00, 0xA0, 0x43, 0x00, 0xA8, 0x03,
+    0x00, 0x80, 0x23, 0x00, 0x00, 0x43, 0x00, 0x30, 0x03,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x18, 0x04, 0x03, 0x00, 0x64, 0x03,
+    0x04, 0x04, 0x03, 0x20, 0x04, 0x03, 0x01, 0x04, 0x23, 0x30, 0x08, 0x43,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x04, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x48, 0x03, 0x00, 0x10, 0x03, 0x02, 0x00, 0x03,
+    0x00, 0x80, 0xE3, 0x11, 0x01, 0x13, 0x00, 0x22, 0x03, 0x00, 0x41, 0x03,
+    0x10, 0x10, 0x23, 0x00, 0x80, 0x23, 0x00, 0x88, 0x83, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x215C '⅜'
+    0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x14, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x20, 0x14, 0x03, 0x02, 0x00, 0x1B, 0x0C, 0x00, 0x03, 0x21, 0x00, 0x83,
+    0x00, 0x41, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x10, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x80, 0x03, 0x01, 0x20, 0x03, 0x04, 0x40, 0x03,
+    0x08, 0x00, 0xE3, 0x02, 0x01, 0x13, 0x44, 0x22, 0x03, 0x40, 0x41, 0x03,
+    0x20, 0x10, 0x23, 0x00, 0x80, 0x23, 0x00, 0x88, 0x83, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x05, 0x00, 0x03,
+    0x21, 0x00, 0x03, 0x20, 0x04, 0x03, 0x20, 0xC0, 0x1B, 0x22, 0x08, 0x03,
+    0x20, 0x10, 0x8B, 0x20, 0x01, 0x03, 0x30, 0x00, 0x43, 0x00, 0x08, 0x83,
+    0x00, 0x12, 0x03, 0x00, 0x04, 0x03, 0x00, 0x80, 0x03, 0x00, 0x20, 0x03,
+    0x04, 0x00, 0x03, 0x00, 0x00, 0xE3, 0x22, 0x01, 0x13, 0x44, 0x22, 0x03,
+    0x40, 0x41, 0x03, 0x20, 0x10, 0x23, 0x00, 0x80, 0x23, 0x00, 0x88, 0x83,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x23, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x215E '⅞'
+    0x0C, 0x00, 0x03, 0x20, 0x20, 0x03, 0x28, 0x00, 0x03, 0x21, 0x08, 0x13,
+    0x22, 0x20, 0x23, 0x28, 0x80, 0x03, 0x21, 0x01, 0x13, 0x20, 0x02, 0x03,
+    0x28, 0x00, 0x83, 0x00, 0x10, 0x03, 0x00, 0x24, 0x03, 0x00, 0x08, 0x03,
+    0x01, 0x00, 0x03, 0x00, 0x40, 0x03, 0x08, 0x80, 0x03, 0x00, 0x00, 0xE3,
+    0x44, 0x01, 0x13, 0x08, 0x22, 0x03, 0x00, 0x41, 0x03, 0x00, 0x10, 0x23,
+    0x00, 0x80, 0x23, 0x00, 0x88, 0x83, 0x00, 0x80, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x09, 0x0F, 0x00, 0x0F,
+    0x20, 0x4F, 0x00, 0x0F, 0x08, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    // 0x2191 '↑'
+    0x04, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xBF,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+    0x09, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x20, 0x4F, 0x00, 0x0F, 0x09, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x08, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F,
+    0x7F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x40, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x08, 0x04, 0x3F, 0x12, 0x12, 0x3F, 0x24, 0x09, 0x3F,
+    0x48, 0x04, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x48, 0x04, 0xBF,
+    0x24, 0x09, 0x3F, 0x10, 0x12, 0x3F, 0x08, 0x04, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x10, 0x50, 0x0A, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x02, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x50, 0x0A, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F,
+    0x00, 0x40, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x40, 0x0B,
+    0x10, 0x23, 0x20, 0x13, 0x00, 0x03, 0x00, 0x03, 0x20, 0x13, 0x10, 0x23,
+    0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x83, 0x00, 0x08, 0x13, 0x00, 0x20, 0x0B, 0x20, 0x40, 0x03,
+    0x50, 0x8C, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x01, 0x00, 0x0B,
+    0x11, 0x00, 0x83, 0x04, 0x2C, 0x13, 0x40, 0x00, 0x23, 0x00, 0x00, 0x83,
+    0x10, 0x02, 0x03, 0x01, 0xC0, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x81, 0x9F, 0x04, 0x08, 0x1F, 0x10, 0x40, 0x1F, 0x41, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x81, 0x00, 0x1F, 0x80, 0x20, 0x1F, 0x20, 0x04, 0x1F,
+    0x04, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+    0x10, 0x00, 0x00, 0x10, 0x00, 0x06, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x10, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x06,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x10, 0x00, 0x00, 0x10, 0x28, 0x00, 0x10, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x04, 0x00, 0x20, 0x02, 0x00, 0x00, 0x60, 0x00, 0x02,
+    0x00, 0x00, 0x70,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x01, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x81, 0x00, 0x0C, 0x08, 0x00, 0x40, 0x40,
+    0x06, 0x02, 0x00, 0x20, 0x10, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x1E, 0x3F, 0x40, 0xBF, 0x80, 0x3F, 0x82, 0x3F, 0x20, 0x3F, 0x82, 0x3F,
+    0x0C, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x48, 0x3F, 0x10, 0x3F, 0x80, 0x3F,
+    0x00, 0x3F, 0x8C, 0x3F, 0x00, 0xBF, 0x22, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x08, 0x00, 0x00, 0x2F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x2260 '≠'
+    0x18, 0xC7, 0x01, 0x07, 0x01, 0x37, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x01, 0x07, 0x81, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x47,
+    // 0x2264 '≤'
+    0x06, 0x03, 0x01, 0x04, 0x08, 0x04, 0x00, 0x84, 0x12, 0x04, 0x04, 0x44,
+    0x21, 0x04, 0x08, 0x24, 0x40, 0x84, 0x10, 0x14, 0x00, 0x44, 0x20, 0x24,
+    // 0x2265 '≥'
+    0x00, 0x03, 0x80, 0x54, 0x90, 0x14, 0x00, 0x84, 0x08, 0x24, 0x01, 0x04,
+    0x00, 0x44, 0x00, 0x04, 0x00, 0x84, 0x08, 0x04, 0x01, 0x04, 0x04, 0x04,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly26BoldItalicColOffsets[] PROGMEM = {
+    0x0, 0x1A, 0x32, 0x46, 0x79, 0xB1, 0xF9, 0x138, 0x142, 0x172, 0x1A2, 0x1B6,
+    0x1CE, 0x1DC, 0x1E5, 0x1EA, 0x21A, 0x24A, 0x26E, 0x29B, 0x2C8, 0x2F8, 0x328, 0x358,
+    0x385, 0x3B5, 0x3E8, 0x3F6, 0x411, 0x429, 0x435, 0x44D, 0x468, 0x4C8, 0x507, 0x53A,
+    0x56D, 0x5A9, 0x5DF, 0x612, 0x648, 0x68D, 0x6B4, 0x6F8, 0x737, 0x767, 0x7B5, 0x7FA,
+    0x833, 0x866, 0x8BE, 0x8F4, 0x921, 0x957, 0x993, 0x9CF, 0xA20, 0xA62, 0xA98, 0xACB,
+    0xAFB, 0xB1C, 0xB50, 0xB6C, 0xB79, 0xB7F, 0xB9F, 0xBC9, 0xBE1, 0xC11, 0xC29, 0xC79,
+    0xCAF, 0xCDC, 0xCF7, 0xD33, 0xD5D, 0xD75, 0xDA3, 0xDC3, 0xDDF, 0xE12, 0xE3F, 0xE59,
+    0xE71, 0xE95, 0xEB5, 0xED1, 0xEF9, 0xF19, 0xF4F, 0xF6B, 0xF97, 0xFB2, 0xFE2, 0xFF0,
+    0x100B, 0x1043, 0x1079, 0x1099, 0x10CF, 0x10F6, 0x1132, 0x1148, 0x1166, 0x1184, 0x1198, 0x11BC,
+    0x11D2, 0x11E6, 0x1219, 0x124F, 0x1255, 0x1265, 0x1279, 0x1297, 0x12E8, 0x1336, 0x1387, 0x13A2,
+    0x13F6, 0x144A, 0x149E, 0x14F2, 0x1531, 0x1585, 0x15D6, 0x161A, 0x1662, 0x16AA, 0x16F2, 0x1728,
+    0x175C, 0x1790, 0x17C4, 0x17EE, 0x182A, 0x1886, 0x18D2, 0x191E, 0x196A, 0x19B6, 0x1A02, 0x1A1A,
+    0x1A59, 0x1AA9, 0x1AF9, 0x1B49, 0x1B99, 0x1BCC, 0x1C20, 0x1C50, 0x1C80, 0x1CB0, 0x1CE0, 0x1D10,
+    0x1D40, 0x1D68, 0x1D8C, 0x1DB0, 0x1DD7, 0x1DFE, 0x1E25, 0x1E3D, 0x1E5E, 0x1E7F, 0x1EA0, 0x1ECA,
+    0x1EFA, 0x1F24, 0x1F4E, 0x1F78, 0x1FA5, 0x1FD2, 0x1FEA, 0x200E, 0x203E, 0x206E, 0x209E, 0x20CE,
+    0x2112, 0x215A, 0x21AE, 0x21DE, 0x2222, 0x2249, 0x2291, 0x22BB, 0x230B, 0x2347, 0x238F, 0x23B3,
+    0x23FB, 0x2425, 0x2465, 0x248D, 0x24C0, 0x24E7, 0x2517, 0x2538, 0x2594, 0x25C4, 0x2620, 0x2650,
+    0x269E, 0x26C8, 0x2710, 0x273A, 0x2776, 0x27A0, 0x27E0, 0x280A, 0x2852, 0x2879, 0x28C9, 0x28F9,
+    0x2949, 0x2979, 0x29AF, 0x29F3, 0x2A1D, 0x2A61, 0x2A8B, 0x2ACF, 0x2AF9, 0x2B1B, 0x2B54, 0x2B61,
+    0x2B7B, 0x2B87, 0x2B95, 0x2BA1, 0x2BAD, 0x2BC5, 0x2BDD, 0x2BF3, 0x2C09, 0x2C2D, 0x2C57, 0x2C5E,
+    0x2C74, 0x2C86, 0x2C98, 0x2CAE, 0x2CC4, 0x2CDA, 0x2CF0, 0x2D04, 0x2D1A, 0x2D30, 0x2D46, 0x2D56,
+    0x2D6C, 0x2D80, 0x2D96, 0x2DAC, 0x2DC2, 0x2DD6, 0x2DEC, 0x2E02, 0x2E23, 0x2E44, 0x2E7A, 0x2E9B,
+    0x2EBC, 0x2EDD, 0x2F05, 0x2F53, 0x2FA4, 0x2FF5, 0x3046, 0x309A, 0x30E8, 0x3108, 0x312C, 0x314C,
+    0x3170, 0x3194, 0x31B8, 0x31DC, 0x320C, 0x3230, 0x3260, 0x3284, 0x32AE, 0x32E4, 0x3323, 0x3356,
+    0x338C, 0x33AC, 0x33E8, 0x3400, 0x3418, 0x3430, 0x3451, 0x3472, 0x3493, 0x34B4, 0x34D5, 0x34F6,
+    0x3517, 0x3538, 0x3559, 0x357A, 0x359B, 0x35BC, 0x35DD, 0x35FE, 0x361F, 0x3640, 0x3661, 0x3682,
+    0x36A3, 0x36C4, 0x36E5
+};
+
+
 const SimpleGFXfont Bookerly26BoldItalic PROGMEM = {Bookerly26BoldItalicBitmaps, Bookerly26BoldItalicBitmaps_lsb, Bookerly26BoldItalicBitmaps_msb, Bookerly26BoldItalicGlyphs,
-    315, 28};
+    315, 28,
+    nullptr, 0, FontStyle::REGULAR, Bookerly26BoldItalicGlyphIndexLatin1, Bookerly26BoldItalicGlyphRanges, 13,
+    Bookerly26BoldItalicBitmapsCol, Bookerly26BoldItalicBitmapsCol_lsb, Bookerly26BoldItalicBitmapsCol_msb, Bookerly26BoldItalicColOffsets};
@@ -5166,5 +5166,4680 @@ const SimpleGFXglyph Bookerly26ItalicGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly26ItalicGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly26ItalicGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly26ItalicBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x8F, 0xE0, 0x03, 0x9F,
+    0x80, 0x7F, 0xFF, 0x83, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0x80, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xC0, 0xFF,
+    0xF3, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0xCF, 0xFF, 0x03, 0xCF, 0xFF,
+    0xF3, 0xCC, 0xFF, 0xF3, 0xC0, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x4F, 0xFF,
+    0x03, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x87, 0xFF, 0xFC, 0x1F, 0xE6, 0x3F, 0xF8, 0x0F, 0xE0, 0x3F,
+    0xF1, 0x86, 0x01, 0xFF, 0xF3, 0xC0, 0x27, 0xFF, 0xF2, 0x03, 0xE7, 0xFF,
+    0xE0, 0x21, 0xC7, 0xFF, 0x01, 0xF0, 0x0F, 0xFF, 0x13, 0xF8, 0x0F, 0xFF,
+    0xF1, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC7, 0xCF, 0xFF,
+    0x9F, 0xCF, 0xCF, 0x9F, 0xCF, 0x8F, 0x9F, 0x9F, 0x1F, 0x8E, 0x1C, 0x7F,
+    0xC0, 0x78, 0xFF, 0xE1, 0xF1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFC, 0x7C, 0x7F, 0xF8, 0xE0, 0x1F, 0xE3, 0xC0, 0x1F,
+    0xC7, 0x8F, 0xDF, 0x0F, 0x9F, 0xDF, 0xBF, 0x3F, 0x9F, 0xFF, 0x3F, 0x1F,
+    0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x8F, 0x1F,
+    0xFF, 0x9F, 0x9F, 0xFC, 0x3F, 0x9F, 0xE0, 0x0F, 0x9F, 0xC0, 0x03, 0x9F,
+    0x8E, 0xC1, 0x9F, 0x3C, 0xF0, 0x9F, 0x3D, 0xFC, 0x3F, 0x31, 0xCE, 0x3F,
+    0x03, 0x8E, 0x1F, 0x87, 0x98, 0x1F, 0xFF, 0x81, 0x8F, 0xFF, 0x87, 0x8F,
+    0xFF, 0x3F, 0xCF, 0xFF, 0x3F, 0xCF, 0xFF, 0x3F, 0xEF, 0xFE, 0x7F, 0xFF,
+    0xFC, 0x7F, 0xFF,
+    // 0x27 '''
+    0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
+    0xFC, 0x3F, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0x7F, 0xF3, 0xFF, 0xFE, 0x3F,
+    0xE7, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0x1F, 0xFF, 0xF1, 0xFF,
+    0x8F, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0xE0, 0x38, 0x1F, 0xFF,
+    0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0x89, 0xFF, 0x89, 0xFF, 0xE3, 0xFF, 0x80, 0xFF, 0x00, 0x7F,
+    0xA6, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x80, 0x0F,
+    0x80, 0x0F, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFD, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x2D '-'
+    0x3F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xBF,
+    // 0x2E '.'
+    0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xF0, 0xFF, 0x1F, 0xE3, 0xFF, 0x9F, 0xC7, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x3F, 0x9F, 0xFC, 0x3F, 0x8F, 0xF0, 0x7F,
+    0x83, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xEF, 0xFF, 0x9F,
+    0xCF, 0xF8, 0x1F, 0xCF, 0x80, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x9F,
+    0x81, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xF3, 0xFE, 0x1F,
+    0xE3, 0xFC, 0x1F, 0xC7, 0xF8, 0x1F, 0xCF, 0xF1, 0x1F, 0x8F, 0xE3, 0x1F,
+    0x9F, 0xC7, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x0F, 0x1F, 0x84, 0x1F, 0x1F,
+    0xC0, 0x3F, 0x3F, 0xC0, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xF7, 0xFF, 0x9F,
+    0xE3, 0xFF, 0x9F, 0xC7, 0x9F, 0x9F, 0xCF, 0x9F, 0x1F, 0x9F, 0x9F, 0x1F,
+    0x9F, 0x1E, 0x3F, 0x9F, 0x0C, 0x3F, 0x8E, 0x00, 0x7F, 0x80, 0x40, 0xFF,
+    0xC0, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFF, 0x13, 0xFF, 0xFE, 0x33, 0xFF, 0xFC, 0xF3, 0xFF, 0xF9, 0xF3, 0xFF,
+    0xE3, 0xF2, 0x3F, 0xC7, 0xE0, 0x3F, 0x8E, 0x00, 0x3F, 0x80, 0x03, 0xFF,
+    0x00, 0x73, 0xFF, 0x07, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x3F,
+    0xC0, 0xFF, 0x3F, 0x00, 0xFE, 0x3F, 0x0C, 0x7E, 0x7F, 0x1C, 0x7C, 0x7F,
+    0x1E, 0x30, 0xFF, 0x1E, 0x00, 0xFF, 0x1F, 0x03, 0xFF, 0x1F, 0xCF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x3F, 0xFC, 0x0E, 0x1F,
+    0xF8, 0x3F, 0x9F, 0xF0, 0x3F, 0x9F, 0xE3, 0x3F, 0x9F, 0xE7, 0x3F, 0x9F,
+    0xC7, 0x3F, 0x1F, 0xCF, 0x1E, 0x3F, 0x8F, 0x00, 0x7F, 0x9F, 0x80, 0xFF,
+    0x9F, 0xE3, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0x3F, 0x83, 0xFC, 0x3F, 0x07, 0xF0, 0x3F, 0x1F, 0xE0, 0xFF,
+    0x1F, 0x83, 0xFF, 0x1F, 0x0F, 0xFF, 0x1E, 0x1F, 0xFF, 0x1C, 0x7F, 0xFF,
+    0x10, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x1F, 0xF0, 0xE7, 0x1F,
+    0xE0, 0x4F, 0x9F, 0xC0, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x9F, 0x1F, 0x9F,
+    0x9F, 0x0F, 0x1F, 0x9F, 0x02, 0x3F, 0x9E, 0x40, 0x3F, 0x80, 0x60, 0x7F,
+    0xC0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xF0, 0x1F, 0x9F,
+    0xE0, 0x0F, 0x9F, 0xC1, 0x0F, 0x1F, 0x8F, 0xCF, 0x3F, 0x9F, 0xCE, 0x3F,
+    0x9F, 0xCC, 0x7F, 0x9F, 0xC8, 0xFF, 0x9F, 0xC0, 0xFF, 0x87, 0x83, 0xFF,
+    0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xE3, 0xCF, 0xE3, 0x87, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xE0, 0xFF, 0xCF, 0xE1, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xE6, 0x7F,
+    0xC6, 0x3F, 0xCF, 0x3F, 0x8F, 0x1F, 0x9F, 0x9F, 0x9F, 0x8F, 0xFF, 0xFF,
+    // 0x3D '='
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x9F, 0x8F, 0x8F, 0x9F, 0xCF, 0x1F, 0xC7, 0x3F,
+    0xE6, 0x3F, 0xE2, 0x7F, 0xF0, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0x9F, 0x8F, 0xC3, 0x1F, 0x9F, 0x83, 0x1F, 0x1F, 0x13, 0xFF,
+    0x1E, 0x33, 0xFF, 0x9C, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xF9, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0x87,
+    0xF0, 0xFF, 0xE3, 0xE3, 0xFF, 0xF3, 0xE7, 0xFF, 0xF1, 0xCF, 0xC0, 0xF1,
+    0xCF, 0x00, 0x79, 0x9E, 0x1E, 0x79, 0x9C, 0x7E, 0x79, 0x9C, 0xFC, 0xF9,
+    0x3D, 0xF9, 0xF9, 0x3C, 0xF1, 0xF3, 0x3C, 0x00, 0x73, 0x3C, 0x00, 0x73,
+    0x3C, 0x7E, 0x67, 0x1F, 0xFE, 0x7F, 0x9F, 0xFC, 0xFF, 0x8F, 0xF8, 0xFF,
+    0xC7, 0xE1, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE1, 0x9F, 0xFF, 0x87, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFC, 0x27, 0xFF, 0xF0, 0xE7, 0xFF, 0xC3, 0xE7, 0xFF,
+    0x8F, 0xE7, 0xDF, 0x80, 0x27, 0xDF, 0x80, 0x00, 0x9F, 0xFC, 0x00, 0x1F,
+    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x3F, 0x9F,
+    0x9F, 0x3F, 0x9F, 0x9F, 0xBF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x1F, 0x3F,
+    0x8E, 0x0C, 0x3F, 0x80, 0x40, 0x7F, 0xC0, 0xC0, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xE0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x3F,
+    0x8F, 0xFE, 0x7F, 0x81, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x7F, 0x9F,
+    0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x3F,
+    0x9F, 0xFF, 0x3F, 0x9F, 0xFE, 0x3F, 0x8F, 0xFC, 0x7F, 0xC3, 0xF0, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x1F, 0x9F,
+    0x8F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9E, 0x1F, 0x9F, 0xFC, 0x3F, 0x83, 0xFD, 0xFF, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x1F, 0x9F,
+    0x8F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF,
+    0x9F, 0x9F, 0xFF, 0x87, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xE0, 0xFC, 0x3F,
+    0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xEF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x1F,
+    0x9F, 0xC0, 0x3F, 0x83, 0xC0, 0x3F, 0x83, 0xC1, 0xFF, 0xC7, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x1F, 0xDF,
+    0x8F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0xBF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0x9F, 0xDF, 0xFF, 0x9F, 0x9F, 0xFF, 0x9E, 0x1F, 0xBF, 0x80, 0x1F,
+    0x9C, 0x00, 0x1F, 0x80, 0x03, 0x9F, 0x80, 0x7F, 0x9F, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x7F, 0xDF,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x03,
+    0x9F, 0xE0, 0x07, 0x9C, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0xFF,
+    0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x1F, 0x9F,
+    0x8F, 0x0F, 0xFF, 0x9E, 0x03, 0xFF, 0xBC, 0x61, 0xFF, 0xF8, 0xF0, 0x7F,
+    0xF9, 0xF8, 0x3F, 0xB3, 0xFE, 0x1F, 0x87, 0xFF, 0x1F, 0x87, 0xFF, 0x9F,
+    0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0xDF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x7F, 0x9F,
+    0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x1F, 0xBE, 0x03, 0x9F, 0x80, 0x1F, 0xDF,
+    0x80, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xDF, 0xE1, 0xFF, 0x9F, 0x87, 0xFC, 0x1F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xFF, 0x9F, 0x9F, 0xFF, 0xDF,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0x1F,
+    0xBF, 0xC0, 0x1F, 0x98, 0x00, 0x9F, 0x80, 0x1F, 0x9F, 0x81, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x1F, 0xBF, 0xC0, 0x1F,
+    0x98, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0x81, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xE0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFE, 0x3F,
+    0x9F, 0xFC, 0x7F, 0x87, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x4F, 0x9F,
+    0x8F, 0xCF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0x9F, 0xFF,
+    0x9F, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
+    0xE0, 0xFE, 0x1F, 0xFF, 0xE3, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF,
+    0x8F, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0x83, 0xFF,
+    0x9F, 0xFF, 0x93, 0xFF, 0x9F, 0xFF, 0x31, 0xFF, 0x9F, 0xFE, 0x39, 0xFF,
+    0x9F, 0xFC, 0x78, 0xFF, 0x87, 0xF0, 0xF8, 0xFF, 0xC0, 0x01, 0xFC, 0xFF,
+    0xE0, 0x03, 0xFC, 0x7F, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xDF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0xCF, 0x9F,
+    0x8F, 0xCF, 0xFF, 0x9F, 0x83, 0xFF, 0x9F, 0x80, 0xFF, 0x9F, 0x18, 0x7F,
+    0x8E, 0x3C, 0x3F, 0x80, 0x7F, 0x1F, 0xC0, 0xFF, 0x9F, 0xF3, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xDF,
+    // 0x53 'S'
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xF1, 0xFC, 0x1F, 0xE0, 0x7F, 0x9F,
+    0xC0, 0x3F, 0x9F, 0x8E, 0x3F, 0x9F, 0x9F, 0x1F, 0x9F, 0x9F, 0x0F, 0x9F,
+    0x9F, 0x87, 0x1F, 0x9F, 0xC0, 0x3F, 0x9F, 0xE0, 0x7F, 0x83, 0xF0, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xC3, 0xFF, 0xFF, 0x83, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F,
+    0x9F, 0xF0, 0x1F, 0x9E, 0x00, 0x1F, 0x80, 0x01, 0x9F, 0x80, 0x3F, 0x9F,
+    0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xFF, 0xFD, 0xFF, 0x9F, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x1E, 0x1F,
+    0x81, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0xBF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F,
+    0x9F, 0xC0, 0xFF, 0x98, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0x81, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0x9F, 0xE0, 0x1F, 0xBF, 0xFE, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF,
+    0x9C, 0x3F, 0xFF, 0x90, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x9F, 0xFE, 0x1F, 0x9F, 0xFC, 0x3F, 0xBF, 0xE0, 0xFF,
+    0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0xBE, 0x0F, 0xFF,
+    0x98, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F,
+    0xBF, 0xFE, 0x1F, 0x9F, 0xFC, 0x1F, 0x8F, 0xF8, 0x9F, 0x83, 0xF3, 0xFF,
+    0x80, 0xC7, 0xFF, 0x98, 0x0F, 0xFF, 0xBE, 0x0F, 0xFF, 0xFF, 0x03, 0xDF,
+    0xFC, 0x40, 0x9F, 0xF8, 0xF0, 0x1F, 0x91, 0xFC, 0x1F, 0x83, 0xFF, 0x1F,
+    0x87, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xDF, 0x83, 0xFF, 0x9F,
+    0x80, 0x7F, 0x9F, 0x90, 0x18, 0x1F, 0x9E, 0x00, 0x1F, 0xBF, 0x80, 0x9F,
+    0xFF, 0x0F, 0x9F, 0xFE, 0x3F, 0xDF, 0xFC, 0x7F, 0xFF, 0x90, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xE3, 0xFC, 0x1F,
+    0x83, 0xF8, 0x9F, 0x8F, 0xE1, 0x9F, 0x9F, 0xC3, 0x9F, 0x9F, 0x87, 0x9F,
+    0x9F, 0x1F, 0x9F, 0x9E, 0x3F, 0x9F, 0x98, 0x7F, 0x9F, 0x90, 0xFF, 0x9F,
+    0x81, 0xFE, 0x1F, 0x87, 0xF8, 0x3F, 0x8F, 0xFD, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFC, 0x00, 0x7F,
+    0xFF, 0xC0, 0x0E, 0x7F, 0xFC, 0x01, 0xFF, 0x7F, 0x80, 0x1F, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xBF, 0xE0, 0x07, 0xFF,
+    0x3E, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xEF, 0xFF, 0x8F, 0xFC, 0x0F, 0xF0, 0x3F, 0x81, 0xFF, 0x07, 0xFF,
+    0x0F, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x0F, 0xFF, 0xEF,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x60 '`'
+    0xFF, 0x1F, 0x0F, 0xC7, 0xE3, 0xFF,
+    // 0x61 'a'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x03, 0xC3, 0xF3, 0x8F, 0xF3, 0x9F, 0xE7,
+    0x1F, 0xC7, 0x1F, 0x8F, 0x9E, 0x03, 0x80, 0x03, 0x80, 0x33, 0x83, 0xE3,
+    0xBF, 0xC7, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xDF, 0xFC, 0x07, 0x9F, 0x80, 0x07,
+    0x98, 0x00, 0xE7, 0x80, 0x03, 0xE7, 0x83, 0xCF, 0xE7, 0xFF, 0x9F, 0xE7,
+    0xFF, 0x3F, 0xC7, 0xFF, 0x3F, 0x8F, 0xFE, 0x1C, 0x1F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFC, 0x0F, 0xF0, 0x03, 0xE0, 0x03, 0xC7, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3,
+    0x1F, 0xF3, 0x1F, 0xE7, 0x1F, 0xCF, 0x9F, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xE7,
+    0xFF, 0x1F, 0xE7, 0xFF, 0x3F, 0xCF, 0xFE, 0x3F, 0x8F, 0xFE, 0x3F, 0x1F,
+    0xFF, 0x3C, 0x07, 0x9F, 0x00, 0x07, 0x9C, 0x00, 0x67, 0x80, 0x0F, 0xC7,
+    0x80, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFC, 0x0F, 0xF0, 0x03, 0xE0, 0x03, 0xC6, 0x73, 0x9E, 0x73, 0xBC, 0xF3,
+    0x3C, 0xF3, 0x39, 0xE7, 0x01, 0xE7, 0x83, 0xEF, 0xEF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFE, 0x7F, 0x80, 0xFF, 0xFE, 0x78, 0x01, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0xFF, 0x9E, 0x7F, 0xFF, 0xFF, 0x3E, 0x7F, 0xFF, 0xFF,
+    0x3E, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x8F,
+    0xFF, 0xF9, 0xCF, 0xE0, 0xE3, 0xCF, 0xC0, 0x43, 0xCF, 0x8E, 0x03, 0xCF,
+    0x9F, 0x23, 0xCF, 0xBF, 0x71, 0xCF, 0x3E, 0x71, 0x8F, 0x1C, 0xF8, 0x1F,
+    0x00, 0xFC, 0x3F, 0x81, 0xFC, 0x7F, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xDF, 0xF8, 0x07, 0x9F, 0x80, 0x0F,
+    0x90, 0x00, 0xFF, 0x80, 0x23, 0xFF, 0x83, 0xC7, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x07, 0xFE, 0x30, 0x07, 0xFE, 0x00, 0x07,
+    0xFF, 0x03, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xDF, 0xFE, 0x7C, 0x0F, 0xFE, 0x60, 0x0F, 0xFC, 0x00, 0xCF,
+    0x8C, 0x07, 0x9F, 0x0E, 0x7F, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFE, 0xFF, 0xE0, 0xFF, 0xFE, 0x7E, 0x01, 0xFF, 0xFE, 0x60, 0x07, 0xFF,
+    0xFC, 0x00, 0x7F, 0xFF, 0x0C, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0x07, 0x9F, 0xC0, 0x07, 0x9C, 0x00, 0x7F,
+    0x80, 0x04, 0xFF, 0x80, 0x9C, 0x3F, 0x8F, 0x38, 0x1F, 0xFF, 0x39, 0x8F,
+    0xFF, 0x71, 0xC7, 0xFE, 0x23, 0xE7, 0xFE, 0x07, 0xE7, 0xFF, 0x0F, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xC7, 0xDF, 0xFC, 0x07, 0x9F, 0x80, 0x07, 0x98, 0x00, 0xE7,
+    0x80, 0x1F, 0xCF, 0x81, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xBF, 0xFB, 0x9F, 0x03, 0x90, 0x03, 0x00, 0x1F, 0x80, 0xFF, 0xF3, 0xFF,
+    0xE7, 0xFF, 0xCF, 0xFF, 0x9F, 0xC3, 0x9C, 0x03, 0x00, 0x0F, 0x80, 0x7F,
+    0xF1, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF, 0x9F, 0xF7, 0x9F, 0x03, 0x00, 0x03,
+    0x00, 0x33, 0x83, 0xE7, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xBF, 0xFB, 0x9F, 0x03, 0x90, 0x03, 0x00, 0x1F, 0x80, 0xFF, 0xF3, 0xFF,
+    0xE7, 0xFF, 0xCF, 0xFF, 0x9F, 0xE7, 0x9E, 0x03, 0x00, 0x03, 0x00, 0x73,
+    0x87, 0xE7, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x6F 'o'
+    0xFC, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC7, 0xF3, 0x8F, 0xF3, 0x9F, 0xF3,
+    0x1F, 0xF3, 0x3F, 0xE3, 0x1F, 0xC7, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x7F,
+    0xFF, 0xFF,
+    // 0x70 'p'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xBF, 0xF8, 0x0F,
+    0x9F, 0x80, 0x0F, 0x90, 0x01, 0xCF, 0x00, 0x23, 0xCF, 0x80, 0xF3, 0xEF,
+    0xE3, 0xF3, 0xFF, 0xCF, 0xF3, 0xFF, 0x9F, 0xF3, 0xFF, 0x9F, 0xE7, 0xFF,
+    0x1F, 0x87, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFE, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xF3, 0xFF,
+    0x8F, 0xF3, 0xEF, 0x9F, 0xE7, 0xCF, 0x1F, 0xC7, 0xCF, 0x1F, 0x88, 0x0F,
+    0x9E, 0x00, 0x0F, 0x80, 0x01, 0xCF, 0x80, 0x3F, 0xCF, 0x83, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xBF, 0xFB, 0x9F, 0x83, 0x98, 0x03, 0x00, 0x1F, 0x00, 0xFF, 0xF1, 0xFF,
+    0xC7, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0xBF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xE7, 0xFF, 0xC3, 0xE3, 0xE3, 0xC1, 0xF3, 0x80, 0xF3, 0x98, 0x73,
+    0x3C, 0x33, 0x1E, 0x07, 0x1F, 0x0F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xC0, 0x7F, 0xF0, 0x00, 0x7F,
+    0xC0, 0x04, 0x7F, 0x00, 0xFE, 0x7F, 0x03, 0xFC, 0x7F, 0xF3, 0xFC, 0xFF,
+    0xF3, 0xF9, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xBF, 0xFF, 0x9F, 0x07, 0x98, 0x03, 0x00, 0x03, 0x01, 0xF3, 0xBF, 0xF3,
+    0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0x1F, 0xFC, 0x03, 0xC0, 0x03, 0x80, 0xF3,
+    0x8F, 0xE7, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x76 'v'
+    0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x03, 0xFF, 0x80, 0x03, 0xE0, 0x03,
+    0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0x1F, 0xBC, 0x3F, 0x00, 0x7F, 0x01, 0xFF,
+    0x8F, 0xFF,
+    // 0x77 'w'
+    0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x07, 0xFF, 0x80, 0x07, 0xE0, 0x03,
+    0xFF, 0x83, 0xFF, 0xC7, 0xFF, 0x1F, 0x9C, 0x3F, 0x00, 0xFF, 0x80, 0x07,
+    0xE0, 0x03, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0x0F, 0xBC, 0x3F, 0x00, 0x7F,
+    0x01, 0xFF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xDF, 0xF3, 0x9F, 0xF3, 0x9F, 0xE7, 0x0F, 0x8F,
+    0x83, 0x1F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xE3, 0x83, 0xC7, 0xF3,
+    0x9F, 0xF3, 0x1F, 0xF7, 0x1F, 0xF7, 0xBF, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0x9F, 0xFF, 0x8F, 0x9F, 0xFF, 0x9F, 0x0F, 0xFF, 0x3F, 0x80, 0xFE, 0x7F,
+    0xC0, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x0F, 0xFF, 0x98, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xF3, 0xEF, 0xE3, 0x87, 0xC7, 0x9F, 0x87, 0x1F, 0x23, 0x9C, 0x73,
+    0x98, 0xF3, 0x81, 0xF3, 0xC3, 0xF3, 0xC7, 0xE3, 0x0F, 0xC3, 0x9F, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF7, 0xC0, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x1E, 0x7F, 0xF0, 0x08, 0xFE, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x81, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
+    0xE0, 0x07, 0xFF, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xBF, 0xFC, 0x01, 0xFF,
+    0x3E, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0xF3, 0xFF, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xCF, 0x8F, 0x1F, 0x3F, 0x1F, 0x9F, 0x8F, 0xCF, 0xCF, 0xCF, 0x0F, 0x1F,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x1F,
+    0x9C, 0x00, 0x7F, 0x08, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+    0xFE, 0x3F, 0x18, 0x7F, 0xFC, 0xFF, 0x00, 0x7F, 0xFC, 0xF8, 0x07, 0xFF,
+    0xF8, 0x80, 0x9F, 0xFF, 0xF0, 0x0F, 0x9F, 0xFF, 0x00, 0xFF, 0x1F, 0xFF,
+    0x08, 0xFF, 0x3F, 0xFF, 0xF8, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xDF, 0x1F,
+    0xFF, 0x9C, 0x1F, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x9F, 0xF8, 0x07, 0x9F,
+    0xE0, 0x1F, 0x9F, 0xC3, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0xFF, 0x1F, 0x83, 0xFF, 0x3F, 0xC3, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xBF, 0x9F, 0x98, 0x3F, 0xC0, 0x1F, 0xC7, 0x1F,
+    0xCF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x1F, 0x8E, 0x3F, 0xC0, 0x1F,
+    0xC0, 0xCF, 0x9F, 0xFF, 0x3F, 0xFF, 0xBF, 0xFF,
+    // 0xA5 '¥'
+    0x3F, 0xFF, 0xFF, 0x3F, 0x6F, 0xBF, 0x0F, 0x67, 0xBF, 0x00, 0x67, 0x3F,
+    0x00, 0x24, 0x3F, 0x38, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0xFF, 0x07, 0x3F,
+    0xFE, 0x27, 0x3F, 0xF8, 0x67, 0xFF, 0x30, 0x67, 0xFF, 0x23, 0x6F, 0xFF,
+    0x07, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0x1F, 0xF8, 0x3F, 0x0F, 0xE0, 0x1F, 0x8F, 0xC7, 0x8F, 0xCF,
+    0x81, 0xC7, 0xCF, 0xB8, 0xE3, 0xCF, 0x3C, 0x71, 0xCF, 0x3E, 0x78, 0x1F,
+    0x3F, 0x3C, 0x1F, 0x0F, 0x80, 0x3F, 0x87, 0xC0, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0x8F, 0x3F, 0x9E, 0x03, 0x9F, 0x9C, 0x61, 0x9F,
+    0xB9, 0xF9, 0xDF, 0xBB, 0xF9, 0xDF, 0xBB, 0xF9, 0xCF, 0xB9, 0xF9, 0xDF,
+    0x98, 0xF9, 0xDF, 0x9F, 0xFB, 0x9F, 0xDF, 0xFF, 0x9F, 0xCF, 0xFF, 0x3F,
+    0xE7, 0xFE, 0x7F, 0xF0, 0xF0, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x0F, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xE7, 0xF0, 0x67, 0xC0, 0x27, 0x8F, 0x67, 0x9E, 0x67, 0xBC, 0xE7,
+    0x80, 0x27, 0x80, 0x27, 0x9E, 0x6F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x9F, 0xBF,
+    0xB9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x8F, 0x3F, 0x9F, 0xFF,
+    0xBF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE3, 0x8F, 0xCF, 0xE7, 0xDF, 0xF3, 0x90, 0x1B,
+    0xB0, 0x1B, 0xB6, 0xD9, 0xB0, 0x3B, 0x99, 0x9B, 0x9F, 0xD3, 0xCF, 0xF7,
+    0xE3, 0xC7, 0xF0, 0x1F, 0xFF, 0xFF,
+    // 0xB0 '°'
+    0xFF, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F,
+    0x9E, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0x80, 0x0C,
+    0x80, 0x0C, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xF9, 0xFC, 0xFD, 0xFC,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x8F, 0xC7, 0x8F, 0x8F, 0x0F, 0x9E, 0x4F,
+    0x9C, 0xCF, 0x98, 0xCF, 0x81, 0xCF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xCF, 0xE7, 0x9C, 0xE7, 0x99, 0xCF, 0xB8, 0x8F,
+    0x90, 0x1F, 0x86, 0x3F, 0xCF, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x1F,
+    0x80, 0x03, 0xFF, 0x80, 0xC3, 0xFF, 0x1F, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x07, 0xFF,
+    0x80, 0x03, 0xFF, 0x83, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xF8, 0x1F, 0xF9,
+    0xF0, 0x0F, 0xFB, 0xE0, 0x07, 0xE3, 0xC0, 0x07, 0x07, 0xC0, 0x00, 0x07,
+    0x80, 0x00, 0xE7, 0x80, 0x1F, 0x0F, 0x83, 0xE0, 0x3F, 0x9C, 0x01, 0xFF,
+    0x80, 0x3F, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0x9F, 0x0F, 0x1F, 0xBF,
+    // 0xB9 '¹'
+    0xFF, 0xEF, 0xFF, 0xEF, 0xDF, 0xCF, 0x98, 0x0F, 0x80, 0x0F, 0x81, 0xEF,
+    0xBF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xFD, 0xE7, 0xE0, 0x67, 0xC0, 0x27, 0x9F, 0x27, 0x9F, 0x27,
+    0xBE, 0x67, 0x80, 0xE7, 0x81, 0xEF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xBE, 0x3F, 0x9C, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF,
+    0xF3, 0xBF, 0xFF, 0x3F, 0x9E, 0x7F, 0x80, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0xE7, 0xFF, 0xDC, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x81, 0xE7, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xCF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFC, 0xFF,
+    0xF1, 0xF8, 0xFF, 0xC3, 0xF0, 0xFF, 0x8F, 0xE2, 0xFF, 0x1F, 0xC6, 0xFF,
+    0xBF, 0x8E, 0x1F, 0xFF, 0x10, 0x1F, 0xFF, 0x00, 0x7F, 0xFE, 0x06, 0xFF,
+    0xFF, 0xFE, 0xFF,
+    // 0xBD '½'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0xE7, 0xFF, 0xDC, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x81, 0xE7, 0xCF, 0x9F, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0x9F,
+    0xC3, 0xFF, 0x1F, 0x8F, 0x9F, 0x1F, 0x1F, 0x1E, 0x1F, 0xBF, 0x3C, 0x9F,
+    0xFE, 0x79, 0x9F, 0xFE, 0x71, 0x9F, 0xFE, 0x03, 0x9F, 0xFF, 0x07, 0xBF,
+    0xFF, 0x9F, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0xCC, 0xE7, 0xFF,
+    0x9C, 0xE7, 0xFF, 0x98, 0xCF, 0xFF, 0x90, 0x0F, 0xCF, 0x82, 0x1F, 0x8F,
+    0xCF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xF8, 0xFC, 0xFF, 0xE3, 0xF8, 0xFF, 0xC7, 0xF0, 0xFF, 0x0F, 0xE2, 0xFF,
+    0xBF, 0xC6, 0xFF, 0xFF, 0x8E, 0x1F, 0xFF, 0x10, 0x1F, 0xFF, 0x00, 0x7F,
+    0xFE, 0x06, 0xFF, 0xFF, 0xFE, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC7, 0x1F,
+    0xFC, 0x8F, 0x9F, 0xD8, 0x9F, 0x1F, 0x08, 0x3F, 0x1F, 0x1C, 0x7F, 0x3F,
+    0xBF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0x86, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xF0, 0x9F, 0xFF, 0x9F, 0xC3, 0x9F, 0xFF, 0x8F, 0x0F, 0x9F, 0xFF,
+    0x8E, 0x3F, 0x9F, 0x7F, 0xC6, 0x00, 0x9F, 0x7F, 0xE6, 0x00, 0x02, 0x7F,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0x86, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xF0, 0x9F, 0xFF, 0xFF, 0xC3, 0x9F, 0xFF, 0xF7, 0x0F, 0x9F, 0xFF,
+    0xE6, 0x3F, 0x9F, 0x7F, 0xC6, 0x00, 0x9F, 0x7F, 0xCE, 0x00, 0x02, 0x7F,
+    0x8F, 0xF0, 0x00, 0x7F, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0x86, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xF7, 0xF0, 0x9F, 0xFF, 0xE7, 0xC3, 0x9F, 0xFF, 0xC7, 0x0F, 0x9F, 0xFF,
+    0x8E, 0x3F, 0x9F, 0x7F, 0x1E, 0x00, 0x9F, 0x7F, 0x1E, 0x00, 0x02, 0x7F,
+    0x8F, 0xF0, 0x00, 0x7F, 0xC7, 0xFF, 0x80, 0x7F, 0xE7, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0x86, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xEF, 0xF0, 0x9F, 0xFF, 0x8F, 0xC3, 0x9F, 0xFF, 0x9F, 0x0F, 0x9F, 0xFF,
+    0x9E, 0x3F, 0x9F, 0x7F, 0x8E, 0x00, 0x9F, 0x7F, 0xC6, 0x00, 0x02, 0x7F,
+    0xCF, 0xF0, 0x00, 0x7F, 0x8F, 0xFF, 0x80, 0x7F, 0x9F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x0C, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF0, 0x3F, 0x9F, 0xE1, 0x3F, 0x0F, 0x87, 0x3F, 0x1E, 0x1F, 0x3F,
+    0xBC, 0x7F, 0x3E, 0xFC, 0x01, 0x3E, 0xFC, 0x00, 0x04, 0x8F, 0xE0, 0x00,
+    0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x4F, 0xFF, 0xE7, 0xE1, 0xCF, 0xFF, 0x83, 0x87, 0xCF, 0xFF,
+    0x99, 0x1F, 0xCF, 0xBF, 0x39, 0x00, 0x4F, 0xBF, 0x39, 0x00, 0x01, 0x3F,
+    0x83, 0xF8, 0x00, 0x3F, 0xC7, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xBF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x9F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xDF, 0xFE, 0x27, 0x9F, 0xF8, 0xE7, 0x9F,
+    0x91, 0xE4, 0x1F, 0x83, 0x80, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x0F, 0x9F,
+    0x80, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x1F, 0x9F, 0xBC, 0x1F, 0x9F, 0xFC, 0x7F, 0x83, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
+    0xE0, 0xFE, 0x1F, 0xFF, 0xE3, 0xFF, 0x1F, 0xBF, 0xC7, 0xFF, 0x1B, 0x3F,
+    0x8F, 0xFF, 0x92, 0x7F, 0x9F, 0xFF, 0x90, 0x7F, 0x9F, 0xFF, 0x98, 0xFF,
+    0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF,
+    0x8F, 0xFE, 0x7F, 0xFF, 0x81, 0xFE, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0x7F,
+    0xFE, 0x00, 0x1E, 0x7F, 0xFE, 0x00, 0x7E, 0x7F, 0xDE, 0x3E, 0x7E, 0x7F,
+    0x0E, 0x7E, 0x7E, 0x7F, 0x8E, 0x7E, 0x7E, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F,
+    0xE6, 0x7E, 0x78, 0x7F, 0xF6, 0x7F, 0xF0, 0xFF, 0xFE, 0x0F, 0xF7, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0x7F,
+    0xFE, 0x00, 0x1E, 0x7F, 0xFE, 0x00, 0x7E, 0x7F, 0xFE, 0x3E, 0x7E, 0x7F,
+    0xF6, 0x7E, 0x7E, 0x7F, 0xE6, 0x7E, 0x7E, 0x7F, 0xC6, 0x7E, 0x7E, 0x7F,
+    0xCE, 0x7E, 0x78, 0x7F, 0x8E, 0x7F, 0xF0, 0xFF, 0x8E, 0x0F, 0xF7, 0xFF,
+    0x9E, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0x7F,
+    0xFE, 0x00, 0x1E, 0x7F, 0xFE, 0x00, 0x7E, 0x7F, 0xF6, 0x3E, 0x7E, 0x7F,
+    0xE6, 0x7E, 0x7E, 0x7F, 0xCE, 0x7E, 0x7E, 0x7F, 0x9E, 0x7E, 0x7E, 0x7F,
+    0x1E, 0x7E, 0x78, 0x7F, 0x8E, 0x7F, 0xF0, 0xFF, 0xC6, 0x0F, 0xF7, 0xFF,
+    0xE6, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
+    0xFC, 0xFE, 0x00, 0xFC, 0xC0, 0x00, 0xFC, 0x00, 0x3C, 0xFC, 0x00, 0xFC,
+    0x8C, 0x7C, 0xFC, 0x1C, 0xFC, 0xFC, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xF0, 0x9C, 0xFF, 0xE1, 0x0C, 0x1F, 0xEF, 0x1C, 0x3F, 0xFF,
+    0xFC, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0x9E, 0x60, 0x00, 0x7F,
+    0x8E, 0x00, 0x1E, 0x7F, 0x8E, 0x01, 0xFF, 0x7F, 0xC6, 0x3F, 0xFF, 0xFF,
+    0xE6, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0x7F,
+    0xF6, 0x00, 0x1E, 0x7F, 0xE6, 0x01, 0xFF, 0x7F, 0xC6, 0x3F, 0xFF, 0xFF,
+    0xCE, 0x7F, 0xFF, 0xFF, 0x8E, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xF6, 0x7F, 0x00, 0x7F, 0xE6, 0x60, 0x00, 0x7F,
+    0xC6, 0x00, 0x1E, 0x7F, 0x8E, 0x01, 0xFF, 0x7F, 0x1E, 0x3F, 0xFF, 0xFF,
+    0x1E, 0x7F, 0xFF, 0xFF, 0x8E, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
+    0x9C, 0xFE, 0x00, 0x0C, 0xC0, 0x00, 0x1C, 0x00, 0x3C, 0xBC, 0x03, 0xFE,
+    0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0x8D, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9F, 0x9F, 0xDF, 0x9E, 0x1F,
+    0x9F, 0x80, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x9F, 0x9F,
+    0x8F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xFF, 0x3F,
+    0x9F, 0xFF, 0x3F, 0x9F, 0xFE, 0x3F, 0x8F, 0xFC, 0x7F, 0xC3, 0xF0, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xFF, 0x00, 0x7F, 0xFE, 0x60, 0x02, 0x7F,
+    0xFE, 0x00, 0x7E, 0x7F, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+    0xCF, 0xC0, 0xFF, 0xFF, 0x8F, 0xF0, 0x3F, 0xFF, 0x9F, 0xFC, 0x0F, 0xFF,
+    0x9F, 0xFF, 0x01, 0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0xC7, 0xFF, 0xF0, 0x7F,
+    0xCE, 0xFF, 0x00, 0x7F, 0x8E, 0x60, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x83, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFE, 0x7F,
+    0xFE, 0x3F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFE, 0x7F, 0x0E, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFC, 0x7F, 0xE6, 0x7F, 0xF8, 0xFF,
+    0xFE, 0x7F, 0xF1, 0xFF, 0xFE, 0x1F, 0xC1, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x83, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFE, 0x7F,
+    0xFE, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xF6, 0x7F, 0xFE, 0x7F,
+    0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFC, 0x7F, 0xCE, 0x7F, 0xF8, 0xFF,
+    0x8E, 0x7F, 0xF1, 0xFF, 0x1E, 0x1F, 0xC1, 0xFF, 0xBF, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x83, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFE, 0x7F,
+    0xF6, 0x3F, 0xFE, 0x7F, 0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFE, 0x7F,
+    0x8E, 0x7F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFC, 0x7F, 0x1E, 0x7F, 0xF8, 0xFF,
+    0x8E, 0x7F, 0xF1, 0xFF, 0xC6, 0x1F, 0xC1, 0xFF, 0xE7, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x83, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFE, 0x7F,
+    0xFE, 0x3F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFE, 0x7F, 0x9E, 0x7F, 0xFE, 0x7F,
+    0x9E, 0x7F, 0xFE, 0x7F, 0x8E, 0x7F, 0xFC, 0x7F, 0xC6, 0x7F, 0xF8, 0xFF,
+    0xC6, 0x7F, 0xF1, 0xFF, 0x8E, 0x1F, 0xC1, 0xFF, 0x9F, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFE, 0x3F, 0xFC, 0xFF,
+    0x9C, 0x7F, 0xFC, 0xFF, 0x0C, 0xFF, 0xFC, 0xFF, 0x1C, 0xFF, 0xFC, 0xFF,
+    0xBC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xF1, 0xFF,
+    0x9C, 0xFF, 0xE3, 0xFF, 0x1C, 0x3F, 0x83, 0xFF, 0x1E, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xBF, 0xFF, 0x1E, 0x3F, 0x8C, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF,
+    0xC0, 0xFF, 0x8C, 0x7F, 0x1E, 0x3F, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x01, 0x1F, 0xFC, 0x00, 0x3F,
+    0xF8, 0x00, 0x3F, 0xF0, 0xFC, 0x1F, 0xE3, 0xF9, 0x1F, 0xC7, 0xF3, 0x9F,
+    0x8F, 0xE7, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x3F, 0x9F,
+    0x9E, 0x7F, 0x1F, 0x9C, 0xFE, 0x3F, 0x99, 0xFC, 0x7F, 0x83, 0xF0, 0x7F,
+    0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x78, 0x7F, 0xFE, 0x07, 0xFC, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0x9E, 0xFF, 0xFE, 0x7F, 0x0F, 0xFF, 0xFE, 0x7F,
+    0x8F, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xF8, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF,
+    0xFE, 0x7F, 0x03, 0xFF, 0xFE, 0x60, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x78, 0x7F, 0xFE, 0x07, 0xFC, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFE, 0x7F, 0xF7, 0xFF, 0xFE, 0x7F,
+    0xE7, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xF8, 0xFF, 0xCF, 0xFF, 0xF1, 0xFF,
+    0x8E, 0x7F, 0x03, 0xFF, 0x1E, 0x60, 0x07, 0xFF, 0xBE, 0x00, 0x7F, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x78, 0x7F, 0xFE, 0x07, 0xFC, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xF6, 0x7F, 0xFE, 0x7F, 0xE6, 0xFF, 0xFE, 0x7F, 0xC7, 0xFF, 0xFE, 0x7F,
+    0x8F, 0xFF, 0xFC, 0x7F, 0x1F, 0xFF, 0xF8, 0xFF, 0x1F, 0xFF, 0xF1, 0xFF,
+    0x8E, 0x7F, 0x03, 0xFF, 0xC6, 0x60, 0x07, 0xFF, 0xE6, 0x00, 0x7F, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0xF8, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
+    0xFC, 0x00, 0xF0, 0xFF, 0xFC, 0x0F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0x9C, 0xFF, 0xFC, 0xFF, 0x0D, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0xBF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0x9C, 0xFE, 0x07, 0xFF, 0x1C, 0xC0, 0x0F, 0xFF, 0x1C, 0x00, 0xFF, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x01, 0x9F, 0x80, 0xFD, 0xDF,
+    0x93, 0xFD, 0xFF, 0x93, 0xF9, 0xFF, 0xB3, 0xF9, 0xFF, 0xF9, 0xF1, 0xFF,
+    0xF8, 0xE3, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x7F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
+    0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xEF, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF,
+    0xCF, 0xFF, 0xC7, 0xFF, 0x9F, 0xFF, 0xE7, 0xFF, 0x9F, 0xC7, 0xE7, 0xFF,
+    0x9F, 0x03, 0xE7, 0xFF, 0x9E, 0x31, 0xE7, 0xFF, 0x80, 0xF8, 0x0F, 0xFF,
+    0xC1, 0xFC, 0x1F, 0xFF, 0xE7, 0xFF, 0x7F, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xE7,
+    0xFF, 0x1F, 0xE7, 0x9F, 0x3F, 0xCF, 0x0E, 0x3F, 0x8F, 0x86, 0x3F, 0x1F,
+    0xE7, 0x3C, 0x07, 0xF3, 0x00, 0x07, 0xFF, 0x00, 0x67, 0xFF, 0x07, 0xC7,
+    0xFF, 0x7F, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xF3,
+    0xFF, 0x8F, 0xF3, 0xFF, 0x9F, 0xE7, 0xFF, 0x1F, 0xC7, 0xFB, 0x1F, 0x8F,
+    0xE3, 0x9E, 0x03, 0xC7, 0x80, 0x03, 0x8F, 0x80, 0x33, 0x9F, 0x83, 0xE3,
+    0xFF, 0xBF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xE7,
+    0xFB, 0x1F, 0xE7, 0xF3, 0x3F, 0xCF, 0xC6, 0x3F, 0x8F, 0x8E, 0x3F, 0x1F,
+    0x1F, 0x3C, 0x07, 0x1F, 0x00, 0x07, 0x87, 0x00, 0x67, 0xC3, 0x07, 0xC7,
+    0xFF, 0x7F, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xE7,
+    0xFF, 0x1F, 0xE7, 0xC7, 0x3F, 0xCF, 0x8E, 0x3F, 0x8F, 0x9E, 0x3F, 0x1F,
+    0x8F, 0x3C, 0x07, 0xC7, 0x00, 0x07, 0xE7, 0x00, 0x67, 0x8F, 0x07, 0xC7,
+    0xDF, 0x7F, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x0F, 0xCF,
+    0xDE, 0x3F, 0xCF, 0x8E, 0x7F, 0x9F, 0x8C, 0x7F, 0x1F, 0x9C, 0x7E, 0x3F,
+    0xFE, 0x78, 0x0F, 0xFE, 0x00, 0x0F, 0x8E, 0x00, 0xCF, 0x8E, 0x0F, 0x8F,
+    0x9E, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xF3,
+    0xFF, 0x8F, 0xF3, 0xE7, 0x9F, 0xE7, 0xC1, 0x1F, 0xC7, 0x99, 0x1F, 0x8F,
+    0xB9, 0x9E, 0x03, 0x99, 0x80, 0x03, 0x83, 0x80, 0x33, 0xC7, 0x83, 0xE3,
+    0xFF, 0xBF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x03, 0xC3, 0xF3, 0x8F, 0xF3, 0x9F, 0xE7,
+    0x9F, 0xCF, 0x1F, 0x1F, 0x1C, 0x07, 0x90, 0x03, 0x80, 0x63, 0xCE, 0x73,
+    0x9E, 0x73, 0xBC, 0xF3, 0x38, 0xF3, 0x31, 0xE7, 0x83, 0xCF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xF7, 0xE0, 0x03, 0x67, 0xC7, 0xF2, 0x4F,
+    0x9F, 0xF2, 0x0F, 0x9F, 0xF3, 0x3F, 0x1F, 0xF3, 0xFF, 0x1F, 0xE7, 0xFF,
+    0x1F, 0xCF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x8C, 0xE7,
+    0x9F, 0x3C, 0xE7, 0x0F, 0x79, 0xE7, 0x86, 0x79, 0xE7, 0xE6, 0x73, 0xCF,
+    0xF6, 0x03, 0xCF, 0xFF, 0x07, 0xDF, 0xFF, 0xDF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC6, 0x73,
+    0xFF, 0x9E, 0x73, 0xFF, 0xBC, 0xF3, 0xFB, 0x3C, 0xF3, 0xE3, 0x39, 0xE7,
+    0xC7, 0x01, 0xE7, 0x8F, 0x83, 0xEF, 0x9F, 0xEF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFB, 0x8C, 0xE7,
+    0xE3, 0x3C, 0xE7, 0xC7, 0x79, 0xE7, 0x8E, 0x79, 0xE7, 0x1E, 0x73, 0xCF,
+    0x0E, 0x03, 0xCF, 0x87, 0x07, 0xDF, 0xE3, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xDF, 0x19, 0xCF,
+    0x8E, 0x79, 0xCF, 0x8E, 0xF3, 0xCF, 0x9C, 0xF3, 0xCF, 0xFC, 0xE7, 0x9F,
+    0xFC, 0x07, 0x9F, 0x8E, 0x0F, 0xBF, 0x8F, 0xBF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xEF, 0xFF, 0x3E, 0x07, 0x9F, 0x30, 0x07, 0x0E, 0x00, 0x67,
+    0x86, 0x03, 0xCF, 0xE3, 0x3F, 0x9F, 0xF7, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xF7, 0xFF, 0x9F, 0x03, 0xFF, 0x98, 0x03, 0xFF, 0x00, 0x33,
+    0xFB, 0x01, 0xE7, 0xE3, 0x9F, 0xCF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xEF, 0xFB, 0x3E, 0x07, 0xE3, 0x30, 0x07, 0xC6, 0x00, 0x67,
+    0x8E, 0x03, 0xCF, 0x1F, 0x3F, 0x9F, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xDF, 0xDE, 0x7C, 0x0F, 0x8E, 0x60, 0x0F, 0x8C, 0x00, 0xCF,
+    0xBC, 0x07, 0x9F, 0xFE, 0x7F, 0x3F, 0xDF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x07,
+    0xFF, 0x8F, 0xE7, 0xFF, 0x3F, 0xE7, 0xBB, 0x3F, 0xE7, 0x12, 0x7F, 0xE7,
+    0x86, 0x7F, 0xC7, 0xC3, 0x3F, 0x8F, 0xC0, 0x08, 0x1F, 0x98, 0x00, 0x3F,
+    0xBE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0x7F, 0xF7, 0xFF, 0x3E, 0x07, 0xFF, 0x20, 0x07, 0xFE, 0x00, 0x3F,
+    0xFF, 0x01, 0xFF, 0xC7, 0xE7, 0xFF, 0x8F, 0xCF, 0xFF, 0x9F, 0x9F, 0xFF,
+    0x8F, 0x3F, 0xCF, 0xC7, 0x3C, 0x07, 0xC6, 0x00, 0x07, 0x8E, 0x00, 0xE7,
+    0xDF, 0x0F, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xE7,
+    0xFF, 0x1F, 0xE7, 0x9F, 0x3F, 0xE7, 0x0E, 0x3F, 0xE7, 0x86, 0x7F, 0xC7,
+    0xE6, 0x3F, 0x8F, 0xF3, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC7, 0xF3,
+    0xFF, 0x8F, 0xF3, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xF3, 0xFB, 0x3F, 0xE3,
+    0xE3, 0x1F, 0xC7, 0xC7, 0x80, 0x0F, 0x8F, 0x80, 0x1F, 0x9F, 0xC0, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xE7,
+    0xFB, 0x1F, 0xE7, 0xF3, 0x3F, 0xE7, 0xC6, 0x3F, 0xE7, 0x8E, 0x7F, 0xC7,
+    0x1E, 0x3F, 0x8F, 0x1F, 0x00, 0x1F, 0x87, 0x00, 0x3F, 0xC3, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x8F, 0xE7,
+    0xFF, 0x1F, 0xE7, 0xC7, 0x3F, 0xE7, 0x8E, 0x3F, 0xE7, 0x9E, 0x7F, 0xC7,
+    0x8E, 0x3F, 0x8F, 0xC7, 0x00, 0x1F, 0xE7, 0x00, 0x3F, 0x8F, 0x80, 0xFF,
+    0xDF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x1F, 0xCF,
+    0xDE, 0x3F, 0xCF, 0x8E, 0x7F, 0xCF, 0x8C, 0x7F, 0xCF, 0x9C, 0xFF, 0x8F,
+    0xFC, 0x7F, 0x1F, 0xFE, 0x00, 0x3F, 0x8E, 0x00, 0x7F, 0x8F, 0x01, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0xDF, 0x19, 0x8F,
+    0x19, 0x8F, 0x99, 0xDF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFD, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFB, 0xFF, 0xF3, 0xFC, 0x07, 0xF0, 0x07, 0xE0, 0x03, 0xC7, 0x33,
+    0x8F, 0x33, 0x9E, 0x73, 0x1C, 0xF3, 0x39, 0xE3, 0x13, 0xC7, 0x80, 0x0F,
+    0x80, 0x1F, 0x80, 0x7F, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0x7F, 0xFF, 0xFF, 0x3E, 0x0F, 0xFF, 0x30, 0x07, 0xFE, 0x00, 0x07,
+    0xFE, 0x03, 0xE7, 0x9F, 0x7F, 0xE7, 0x0F, 0xFF, 0xCF, 0x87, 0xFF, 0x9F,
+    0xC7, 0xFE, 0x3F, 0xF3, 0xF8, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x01, 0xE7,
+    0xFF, 0x1F, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0x07, 0xFF, 0x98, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x01, 0xF3, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xCF,
+    0xF3, 0xFF, 0x1F, 0xC7, 0xFC, 0x03, 0x8F, 0xC0, 0x03, 0x9F, 0x80, 0xF3,
+    0xFF, 0x8F, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0x7F, 0xFF, 0xFF, 0x3E, 0x0F, 0xFF, 0x30, 0x07, 0xFE, 0x00, 0x07,
+    0xFE, 0x03, 0xE7, 0xF3, 0x7F, 0xE7, 0xE7, 0xFF, 0xCF, 0x8F, 0xFF, 0x9F,
+    0x1F, 0xFE, 0x3F, 0x1F, 0xF8, 0x07, 0x07, 0x80, 0x07, 0xC3, 0x01, 0xE7,
+    0xFF, 0x1F, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFE, 0xFF, 0xFF, 0xFE, 0x7C, 0x1F, 0xFE, 0x60, 0x0F, 0xFC, 0x00, 0x0F,
+    0xFC, 0x07, 0xCF, 0x8E, 0xFF, 0xCF, 0x8F, 0xFF, 0x9F, 0x9F, 0xFF, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x0F, 0x8F, 0x00, 0x0F, 0x8E, 0x03, 0xCF,
+    0x9E, 0x3F, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xC0, 0x1F, 0xDF, 0xF8, 0x00, 0x9F, 0x9F, 0x80, 0x07, 0x9F,
+    0x90, 0x00, 0xE7, 0x9F, 0x80, 0x23, 0xE7, 0xFF, 0x83, 0xCF, 0xE7, 0xFF,
+    0xFF, 0x9F, 0xE7, 0xFF, 0xFF, 0x3F, 0xC7, 0xFF, 0xFE, 0x3F, 0x8F, 0xFF,
+    0xFE, 0x1C, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFC, 0x3F, 0xFC, 0xFF, 0x8E, 0x03, 0xF9, 0xFF, 0x8F, 0x00, 0x01, 0xFF,
+    0x9F, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
+    0x8F, 0xFC, 0x3F, 0xFF, 0x8E, 0x60, 0xFF, 0xFF, 0x9C, 0x03, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xE1, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+    0xFC, 0x27, 0xFF, 0xFF, 0xF0, 0xE7, 0xFF, 0xFF, 0xC3, 0xE7, 0xFF, 0xFF,
+    0x8F, 0xE7, 0xDF, 0xFF, 0x80, 0x27, 0xDF, 0xFF, 0x80, 0x00, 0x90, 0xFF,
+    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x0C, 0x7F, 0xFF, 0xFF, 0x1E, 0xFF,
+    0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    // 0x105 'ą'
+    0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xF3, 0xFF,
+    0x8F, 0xF3, 0xFF, 0x9F, 0xE7, 0xFF, 0x1F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x9E, 0x02, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x31, 0xCF, 0x83, 0xE3, 0xDF,
+    0xBF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0x83, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFC, 0x7F,
+    0xFE, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xF6, 0x7F, 0xFE, 0x7F,
+    0xE6, 0x7F, 0xFE, 0x7F, 0xC6, 0x7F, 0xFC, 0x7F, 0xCE, 0x7F, 0xFC, 0xFF,
+    0x8E, 0x3F, 0xF9, 0xFF, 0x0E, 0x07, 0xFB, 0xFF, 0x9E, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC7, 0xF3,
+    0xFF, 0x9F, 0xF3, 0xFF, 0x9F, 0xF3, 0xFB, 0x1F, 0xF3, 0xE3, 0x1F, 0xE7,
+    0xC7, 0x1F, 0xCF, 0x8F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xC1, 0xFC, 0x3F, 0xFF, 0xC7, 0xFE, 0x3F, 0xFF, 0x8F, 0xFE, 0x3F,
+    0xFF, 0x1F, 0xFF, 0x3F, 0x8F, 0x3F, 0xFF, 0x3F, 0x87, 0x3F, 0xFF, 0x3F,
+    0xE3, 0x3F, 0xFF, 0x3F, 0xF3, 0x3F, 0xFE, 0x3F, 0xE3, 0x3F, 0xFE, 0x7F,
+    0xC7, 0x1F, 0xFC, 0xFF, 0x8F, 0x03, 0xFD, 0xFF, 0x9F, 0x07, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC7, 0xF3,
+    0x8F, 0x9F, 0xF3, 0x83, 0x9F, 0xF3, 0xE3, 0x1F, 0xF3, 0xF3, 0x1F, 0xE7,
+    0xE3, 0x1F, 0xCF, 0xCF, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xBF, 0xFC, 0x3F, 0xFF, 0x3F, 0x80, 0x3F, 0xFF, 0x30, 0x00, 0x3F,
+    0xFF, 0x00, 0x0F, 0x3F, 0xFF, 0x00, 0xFF, 0x3F, 0x9F, 0x1F, 0xFF, 0x3F,
+    0x8F, 0x3F, 0xFF, 0x3F, 0xC3, 0x3F, 0xFF, 0x3F, 0xE3, 0x3F, 0xFE, 0x7F,
+    0xF3, 0x3F, 0xFE, 0x7F, 0xE7, 0x3F, 0xFC, 0x7F, 0xCF, 0x1F, 0xF8, 0xFF,
+    0x9F, 0x87, 0xE1, 0xFF, 0x9F, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xE1, 0xF9,
+    0xFF, 0xC7, 0xF9, 0xFF, 0xCF, 0xF3, 0xFF, 0x8F, 0xE3, 0xFF, 0x8F, 0xC7,
+    0xFF, 0xCF, 0x01, 0xE7, 0xC0, 0x01, 0xE7, 0x00, 0x19, 0xE0, 0x03, 0xF1,
+    0xE0, 0x3F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xFE, 0x1F, 0xFF, 0x9F, 0xC0, 0x1F, 0xFF, 0x98, 0x00, 0x1F, 0xFF,
+    0x80, 0x07, 0x9F, 0xFF, 0x80, 0x1F, 0x9F, 0xFF, 0x8F, 0x9F, 0x9F, 0xFF,
+    0x9F, 0x9F, 0x90, 0xFF, 0x9F, 0x9F, 0x80, 0xFF, 0x9F, 0x9F, 0x8C, 0x7F,
+    0x9F, 0x9E, 0x1E, 0xFF, 0x9F, 0xFC, 0x3E, 0xFF, 0x83, 0xFD, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC6, 0x73, 0x1F,
+    0x9E, 0x70, 0x1F, 0xBC, 0xF0, 0x8F, 0x3C, 0xF3, 0xDF, 0x39, 0xE7, 0xDF,
+    0x01, 0xE7, 0xFF, 0x83, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x3F, 0x80, 0x3F, 0xFF, 0x30, 0x00, 0x3F,
+    0xFF, 0x00, 0x0F, 0x3F, 0xFF, 0x00, 0x3F, 0x3F, 0x8F, 0x1F, 0x3F, 0x3F,
+    0x87, 0x3F, 0x3F, 0x3F, 0xE3, 0x3F, 0x3F, 0x3F, 0xF3, 0x3F, 0x3F, 0x3F,
+    0xE3, 0x3F, 0x3C, 0x3F, 0xC7, 0x3F, 0xF8, 0x7F, 0x8F, 0x07, 0xFB, 0xFF,
+    0x9F, 0x0F, 0xFF, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC6, 0x73,
+    0x8F, 0x9E, 0x73, 0x83, 0xBC, 0xF3, 0xE3, 0x3C, 0xF3, 0xF3, 0x39, 0xE7,
+    0xE3, 0x01, 0xE7, 0xCF, 0x83, 0xEF, 0x9F, 0xEF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0x7F,
+    0xF6, 0x00, 0x1E, 0x7F, 0xE6, 0x01, 0xFE, 0x7F, 0xC6, 0x3F, 0xFE, 0x7F,
+    0xCE, 0x7F, 0xFE, 0x7F, 0x8E, 0xFF, 0xFE, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE3, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0x7F, 0xF0, 0x1F, 0xF6, 0x7E, 0x00, 0x1F,
+    0xE6, 0x60, 0x03, 0x9F, 0xE6, 0x00, 0x7F, 0x3F, 0xC6, 0x07, 0xFE, 0x7F,
+    0xCE, 0x7F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x87,
+    0xE7, 0xF0, 0x07, 0xE6, 0x00, 0x07, 0xE0, 0x01, 0xE7, 0xE0, 0x1F, 0xE7,
+    0xE3, 0xFF, 0xE7, 0xE7, 0xFF, 0xE7, 0xEF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xC7, 0x81, 0xFF, 0x07, 0x87, 0xFE, 0x3F, 0xDF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xF1, 0xF7, 0xFF, 0x01, 0xE7, 0xE0, 0x01, 0xE6, 0x00, 0x39,
+    0xE0, 0x07, 0xF3, 0xE0, 0x7F, 0xE7, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xE7, 0xDF, 0xFF, 0xE7, 0x9F, 0xFF, 0xCE, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x98, 0x00, 0x1F, 0x80, 0x07, 0x9F, 0x80, 0x3F, 0x9F,
+    0x8F, 0x3F, 0x9F, 0x9E, 0x7F, 0x9F, 0xBE, 0x7F, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xC7, 0xDF, 0xE0, 0x07,
+    0x9F, 0x80, 0x07, 0x98, 0x00, 0xE7, 0x80, 0x0F, 0xCF, 0x81, 0x9F, 0x9F,
+    0x9F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xFF, 0x00, 0x7F, 0xFE, 0x60, 0x02, 0x7F,
+    0xFE, 0x00, 0x7E, 0x7F, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE7, 0xFC, 0x0F, 0xFF,
+    0xE7, 0xFF, 0x01, 0xFF, 0xCF, 0xFF, 0xE0, 0x7F, 0x8F, 0xFF, 0xF0, 0x7F,
+    0x8E, 0xFF, 0x00, 0x7F, 0x1E, 0x60, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xBF, 0xFB, 0xFF, 0x9F, 0x03, 0xFF, 0x90, 0x03, 0xFF, 0x00, 0x1F,
+    0xFF, 0x80, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFB, 0xCF, 0xFF,
+    0xE3, 0x9F, 0xE7, 0xC7, 0x9E, 0x03, 0x8F, 0x00, 0x03, 0x9F, 0x00, 0x73,
+    0xFF, 0x87, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0x7F, 0x80, 0x3F, 0xFF, 0x30, 0x01, 0x3F,
+    0xFF, 0x00, 0x3F, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x9F, 0xE0, 0x7F, 0xFF, 0x87, 0xF8, 0x1F, 0xFF, 0xC3, 0xFE, 0x07, 0xFF,
+    0xF3, 0xFF, 0x80, 0xFF, 0xE3, 0xFF, 0xF0, 0x3F, 0xC7, 0xFF, 0xF8, 0x3F,
+    0xCF, 0x7F, 0x80, 0x3F, 0x9F, 0x30, 0x01, 0xFF, 0xBF, 0x00, 0x1F, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xBF, 0xFB, 0xFF, 0x9F, 0x03, 0xFF, 0x90, 0x03, 0xFF, 0x00, 0x1F,
+    0xFF, 0x80, 0xFF, 0x8F, 0xF3, 0xFF, 0x83, 0xE7, 0xFF, 0xE3, 0xCF, 0xFF,
+    0xF3, 0x9F, 0xE7, 0xE3, 0x9E, 0x03, 0xC7, 0x00, 0x03, 0x9F, 0x00, 0x73,
+    0xBF, 0x87, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x1F, 0xC7, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0x8F, 0xFF, 0x9F,
+    0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x9F, 0xE0, 0x1F,
+    0x9C, 0x00, 0x1F, 0x80, 0x03, 0x9F, 0x80, 0x1F, 0x9F, 0x87, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x1F,
+    0x9F, 0xBC, 0x1F, 0x87, 0xFC, 0xFF, 0x83, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFC, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC7, 0xF3, 0x8F, 0xF3, 0x9F, 0xF3,
+    0x1F, 0xF3, 0x3F, 0xE3, 0x1F, 0xC7, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03,
+    0xC6, 0x73, 0x9E, 0x73, 0xBC, 0xF3, 0x3C, 0xF3, 0x39, 0xE7, 0x01, 0xE7,
+    0x83, 0xEF, 0xEF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xBF, 0xFC, 0x3F, 0xFF, 0x3F, 0x80, 0x3F, 0xFF, 0x30, 0x00, 0x3F,
+    0xFF, 0x00, 0x0F, 0x3F, 0x8F, 0x01, 0x9F, 0x3F, 0xC7, 0x1F, 0x9F, 0xFF,
+    0xE3, 0x3F, 0x07, 0xFF, 0xF3, 0x3F, 0x01, 0xFF, 0xE3, 0x3E, 0x30, 0xFF,
+    0xC7, 0x1C, 0x78, 0x7F, 0x8F, 0x00, 0xFE, 0x3F, 0x9F, 0x81, 0xFF, 0x3F,
+    0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xBF,
+    // 0x159 'ř'
+    0xFF, 0xBF, 0xFB, 0xFF, 0x9F, 0x83, 0xFF, 0x98, 0x03, 0xFF, 0x00, 0x1F,
+    0x8F, 0x00, 0xFF, 0xC3, 0xF1, 0xFF, 0xF3, 0xC7, 0xFF, 0xF3, 0x8F, 0xFF,
+    0xE7, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0x9F, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC7, 0xF0, 0x7F,
+    0xFF, 0x81, 0xFE, 0x7F, 0xFF, 0x00, 0xFE, 0x7F, 0xFE, 0x38, 0xFE, 0x7F,
+    0xFE, 0x7C, 0x7E, 0x7F, 0xE6, 0x7C, 0x3E, 0x7F, 0xE6, 0x7E, 0x1C, 0x7F,
+    0xCE, 0x7F, 0x00, 0xFF, 0x8E, 0x7F, 0x81, 0xFF, 0x8E, 0x0F, 0xC3, 0xFF,
+    0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0xE3, 0xE3, 0xFF, 0xC1, 0xF3,
+    0xFF, 0x80, 0xF3, 0xFF, 0x98, 0x73, 0xFB, 0x3C, 0x33, 0xE3, 0x1E, 0x07,
+    0xC7, 0x1F, 0x0F, 0x8F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE3, 0xF8, 0x3F,
+    0xFF, 0xC0, 0xFF, 0x3F, 0xFF, 0x80, 0x7F, 0x3F, 0x9F, 0x1C, 0x7F, 0x3F,
+    0x87, 0x3E, 0x3F, 0x3F, 0xC3, 0x3E, 0x1F, 0x3F, 0xF3, 0x3F, 0x0E, 0x3F,
+    0xE3, 0x3F, 0x80, 0x7F, 0xC7, 0x3F, 0xC0, 0xFF, 0xCF, 0x07, 0xE1, 0xFF,
+    0x9F, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0xE3, 0xE3, 0xFF, 0xC1, 0xF3,
+    0x8F, 0x80, 0xF3, 0x87, 0x98, 0x73, 0xE3, 0x3C, 0x33, 0xF3, 0x1E, 0x07,
+    0xE3, 0x1F, 0x0F, 0xC7, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xBF, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x3F, 0xFE, 0x3F, 0xFF, 0x3F, 0xE0, 0x3F, 0x9F, 0x3C, 0x00, 0x3F,
+    0x87, 0x00, 0x03, 0x3F, 0xC3, 0x00, 0x7F, 0x3F, 0xF3, 0x0F, 0xFF, 0xFF,
+    0xE3, 0x3F, 0xFF, 0xFF, 0xC7, 0x3F, 0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF,
+    0x9F, 0x3F, 0xFF, 0xFF, 0xBF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3C, 0x07, 0xFF, 0x00, 0x07,
+    0xFC, 0x00, 0x47, 0xF0, 0x0F, 0xE7, 0xF0, 0x3F, 0xC7, 0xFF, 0x3F, 0xCF,
+    0xE3, 0x3F, 0x9F, 0x07, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x3E, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0x00, 0x3C, 0x3F, 0xFF, 0x03, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x3F, 0xFF, 0x3F, 0xEF, 0x7F, 0xFF, 0x3F, 0x83, 0xFF, 0xFF, 0x3F,
+    0x91, 0xFF, 0xFE, 0x3F, 0x39, 0xFF, 0xFC, 0x7F, 0x39, 0xFF, 0xF8, 0xFF,
+    0x83, 0x3F, 0x81, 0xFF, 0xC7, 0x30, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0x07, 0xFF, 0x98, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x01, 0xF3, 0xFF, 0xBF, 0xF3, 0xC3, 0xFF, 0xE7, 0x81, 0xFF, 0xCF,
+    0xB9, 0xFF, 0x1F, 0xB9, 0xFC, 0x03, 0x83, 0xC0, 0x03, 0xC7, 0x80, 0xF3,
+    0xFF, 0x8F, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x3E, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0x00, 0x3C, 0x3F, 0xFF, 0x03, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xF3, 0x3F, 0xFF, 0x3F, 0xF3, 0x7F, 0xFF, 0x3F, 0xE7, 0xFF, 0xFF, 0x3F,
+    0xC7, 0xFF, 0xFE, 0x3F, 0x8F, 0xFF, 0xFC, 0x7F, 0x8F, 0xFF, 0xF8, 0xFF,
+    0xF3, 0x3F, 0x81, 0xFF, 0xF3, 0x30, 0x03, 0xFF, 0xE7, 0x00, 0x3F, 0xFF,
+    0xC7, 0x03, 0xFF, 0xFF, 0x8F, 0x3F, 0xFF, 0xFF, 0x8F, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0x07, 0xFF, 0x98, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x01, 0xF3, 0xF1, 0xBF, 0xF3, 0xE3, 0xFF, 0xE7, 0x87, 0xFF, 0xCF,
+    0x8F, 0xFF, 0x1F, 0xFB, 0xFC, 0x03, 0xF1, 0xC0, 0x03, 0xC3, 0x80, 0xF3,
+    0x87, 0x8F, 0xE7, 0x8F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x7F, 0xFE, 0xFC, 0x1F, 0xFC,
+    0xFC, 0x03, 0xFC, 0xFC, 0x80, 0xC0, 0x9C, 0xF0, 0x00, 0x0D, 0xFC, 0x04,
+    0x1F, 0xF8, 0x7C, 0xFF, 0xF1, 0xFE, 0xFF, 0xE3, 0xFF, 0x9C, 0x87, 0xFF,
+    0x0C, 0x1F, 0xFF, 0x1C, 0x3F, 0xFF, 0xBC, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0x8F, 0xF0, 0x7F, 0xFE, 0x0F, 0xE2, 0x7F, 0xFE, 0x3F, 0x86, 0x7F,
+    0xFE, 0x7F, 0x0E, 0x7F, 0xFE, 0x7E, 0x1E, 0x7F, 0xE6, 0x7C, 0x7E, 0x7F,
+    0xE6, 0x78, 0xFE, 0x7F, 0xCE, 0x61, 0xFE, 0x7F, 0x8E, 0x43, 0xFE, 0x7F,
+    0x8E, 0x07, 0xF8, 0x7F, 0x1E, 0x1F, 0xE0, 0xFF, 0xFE, 0x3F, 0xF7, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xE3, 0xFF, 0x87, 0xC7, 0xFF, 0x9F, 0x87,
+    0xFF, 0x1F, 0x23, 0xFF, 0x9C, 0x73, 0xFB, 0x98, 0xF3, 0xE3, 0x81, 0xF3,
+    0xC7, 0xC3, 0xF3, 0x8F, 0xC7, 0xE3, 0x9F, 0x0F, 0xC3, 0xFF, 0x9F, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0x8F, 0xF0, 0x7F, 0xFE, 0x0F, 0xE2, 0x7F, 0xFE, 0x3F, 0x86, 0x7F,
+    0xFE, 0x7F, 0x0E, 0x7F, 0xFE, 0x7E, 0x1E, 0x7F, 0xFE, 0x7C, 0x7E, 0x7F,
+    0x8E, 0x78, 0xFE, 0x7F, 0x8E, 0x61, 0xFE, 0x7F, 0x8E, 0x43, 0xFE, 0x7F,
+    0xFE, 0x07, 0xF8, 0x7F, 0xFE, 0x1F, 0xE0, 0xFF, 0xFE, 0x3F, 0xF7, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xBF, 0x8F, 0xFE, 0x1F, 0x1F, 0xFE, 0x7E, 0x1F,
+    0xFC, 0x7C, 0x8F, 0xFE, 0x71, 0xCF, 0x8E, 0x63, 0xCF, 0x0E, 0x07, 0xCF,
+    0x1F, 0x0F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFC, 0x3F, 0x0F, 0xFE, 0x7F, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xC7, 0xF8, 0x3F, 0xFF, 0x07, 0xF1, 0x3F, 0xFF, 0x1F, 0xC3, 0x3F,
+    0x9F, 0x3F, 0x87, 0x3F, 0x87, 0x3F, 0x0F, 0x3F, 0xC3, 0x3E, 0x3F, 0x3F,
+    0xE3, 0x3C, 0x7F, 0x3F, 0xF3, 0x30, 0xFF, 0x3F, 0xE7, 0x21, 0xFF, 0x3F,
+    0xCF, 0x03, 0xFC, 0x3F, 0x9F, 0x0F, 0xF0, 0x7F, 0xBF, 0x1F, 0xFB, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xE3, 0xFF, 0x87, 0xC7, 0xFF, 0x9F, 0x87,
+    0x8F, 0x1F, 0x23, 0x87, 0x9C, 0x73, 0xE3, 0x98, 0xF3, 0xF3, 0x81, 0xF3,
+    0xE3, 0xC3, 0xF3, 0xC7, 0xC7, 0xE3, 0x9F, 0x0F, 0xC3, 0xBF, 0x9F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0xEF, 0xF3, 0x8F, 0xE3, 0x9F, 0x83, 0x9C, 0x0F, 0x80, 0x7F,
+    0x83, 0xFF, 0x9F, 0xFF, 0x9F, 0x03, 0x90, 0x03, 0x80, 0x03, 0x87, 0xF3,
+    0x9F, 0xE7, 0x9F, 0xE7, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xC3, 0xFE, 0x3F, 0xCF, 0xFC, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x9F,
+    0x9F, 0x1F, 0x9F, 0x9E, 0x1F, 0x9F, 0x98, 0x8F, 0x9F, 0x81, 0x87, 0x1F,
+    0x83, 0xC0, 0x3F, 0xC7, 0xE0, 0x7F, 0xFF, 0xF9, 0xFF,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0xFC, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0x86, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xB8, 0xFF, 0x81, 0xFF, 0x03, 0xFF, 0x8F, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    // 0x201B '‛'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xFC, 0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0x86, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xB8, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    0xFE, 0xFF, 0xF8, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    0xFE, 0xFF, 0xFC, 0xFF, 0x80, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x201F '‟'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF,
+    0x81, 0xFF, 0x80, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0x7F, 0xFD, 0xF0, 0x7F,
+    0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0x8D, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xF8, 0xFF, 0xFE, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xFD, 0x8F,
+    0xFD, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0x80, 0xFC, 0xFF,
+    0x8D, 0xF8, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xE7, 0x83, 0x83, 0x83, 0x87, 0xFF,
+    // 0x2026 '…'
+    0xCF, 0x8F, 0x8F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0x8F,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x9F, 0xBF,
+    0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xBE, 0x3F, 0x9C, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x2070 '⁰'
+    0xFC, 0x1F, 0xE0, 0x0F, 0xC1, 0xC7, 0x8F, 0xE7, 0x9F, 0xE7, 0x9F, 0xCF,
+    0x9F, 0x0F, 0x80, 0x1F, 0x80, 0x7F, 0xF7, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x8F, 0x3F, 0xFF, 0xFF,
+    // 0x2075 '⁵'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xFB, 0xE7, 0x83, 0xEF, 0x83, 0xCF, 0x99, 0x8F,
+    0x98, 0x1F, 0x9C, 0x3F, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0xFF, 0xF8, 0x1F, 0xF0, 0x0F, 0xE1, 0xE7, 0xC9, 0xE7, 0x89, 0xEF,
+    0x99, 0x8F, 0x9C, 0x1F, 0xBE, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xFF, 0xFF, 0x87, 0xCF, 0x8F, 0x07, 0x9E, 0x1F, 0x9C, 0x7F, 0x91, 0xFF,
+    0x83, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0x9F, 0xFE, 0x0F, 0xC2, 0x4F, 0x80, 0xE7, 0x99, 0xE7, 0xB8, 0xEF,
+    0xB8, 0x0F, 0x82, 0x1F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xE1, 0xE7, 0xC0, 0xE7, 0x8C, 0xCF, 0x9E, 0xCF,
+    0xBE, 0x9F, 0x9C, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFC, 0x1F, 0xF0, 0x0F, 0xC1, 0xC7, 0x8F, 0xE7, 0x9F, 0xE7, 0x9F, 0xCF,
+    0x9F, 0x0F, 0x80, 0x1F, 0xC0, 0x7F, 0xF7, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xEF, 0xFF, 0xEF, 0xDF, 0xCF, 0x9C, 0x0F, 0x80, 0x0F, 0x81, 0xEF,
+    0xBF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xCF, 0xC7, 0x8F, 0x8F, 0x0F, 0x9E, 0x6F,
+    0x9C, 0x6F, 0x98, 0xEF, 0x81, 0xEF, 0xC3, 0xFF, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xCF, 0xE7, 0x9C, 0xE7, 0x9D, 0xCF, 0x98, 0x8F,
+    0x90, 0x1F, 0x82, 0x3F, 0xCF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x8F, 0x3F, 0xFF, 0xFF,
+    // 0x2085 '₅'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xFB, 0xE7, 0x83, 0xE7, 0x83, 0xCF, 0x99, 0x8F,
+    0x98, 0x1F, 0x9C, 0x3F, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0x2086 '₆'
+    0xFF, 0xFF, 0xF8, 0x1F, 0xF0, 0x0F, 0xE1, 0xE7, 0xC9, 0xE7, 0x89, 0xE7,
+    0x98, 0x8F, 0x9C, 0x1F, 0xBE, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xFF, 0xFF, 0x87, 0xCF, 0x8F, 0x07, 0x9E, 0x1F, 0x9C, 0x7F, 0x91, 0xFF,
+    0x83, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x9F, 0xFE, 0x0F, 0xC2, 0x47, 0x80, 0xE7, 0x99, 0xE7, 0xB8, 0xEF,
+    0xB8, 0x0F, 0x82, 0x1F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xE1, 0xE7, 0xC0, 0xE7, 0x8C, 0xCF, 0x9E, 0xCF,
+    0xBE, 0x9F, 0x9E, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x24, 0x3F, 0xE3, 0x27, 0x1F,
+    0xC7, 0x27, 0x9F, 0xCF, 0x27, 0x9F, 0x8F, 0x27, 0x9F, 0x9F, 0x2F, 0x9F,
+    0x9F, 0x7F, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF, 0x3F, 0x83, 0xFF, 0x3F,
+    0x83, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2122 '™'
+    0x8F, 0xFF, 0x9F, 0x3F, 0xB0, 0x3F, 0x80, 0x3F, 0x9F, 0xFF, 0xBF, 0xFF,
+    0x8F, 0xFF, 0xBF, 0x3F, 0xF8, 0x3F, 0x81, 0xFF, 0x8F, 0xFF, 0x80, 0xFF,
+    0xFC, 0xFF, 0xF3, 0xFF, 0xCF, 0x3F, 0x80, 0x3F, 0x9F, 0x3F, 0xBF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0xE7, 0xFF, 0xDC, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x81, 0xE7, 0xCF, 0x9F, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xDF,
+    0xE3, 0xFF, 0xDF, 0x8F, 0xBF, 0xDF, 0x1F, 0x3B, 0x9F, 0xBE, 0x73, 0x9F,
+    0xFE, 0x73, 0x1F, 0xFE, 0x20, 0x3F, 0xFF, 0x08, 0x7F, 0xFF, 0x9F, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xC7, 0x87, 0xFF,
+    0xCF, 0x27, 0xFF, 0x9E, 0x27, 0xFF, 0x9E, 0x67, 0xFF, 0x98, 0xE7, 0xCF,
+    0x81, 0xE7, 0x8F, 0xC3, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xDF, 0xE3, 0xFF, 0xDF, 0xC7, 0xBF, 0xDF,
+    0x0F, 0x3B, 0x9F, 0xBE, 0x73, 0x9F, 0xFE, 0x73, 0x1F, 0xFE, 0x20, 0x3F,
+    0xFF, 0x08, 0x7F, 0xFF, 0x9F, 0xFF,
+    // 0x215B '⅛'
+    0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0xE7, 0xFF, 0xDC, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x81, 0xE7, 0xCF, 0x9F, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xE3, 0xFC, 0x3F, 0x87, 0xCC, 0x1F, 0x1F, 0x01, 0x9F, 0xBF, 0x23, 0xDF,
+    0xFE, 0x73, 0x9F, 0xFE, 0x70, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x0E, 0x7F,
+    0xFF, 0x9F, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0xCC, 0xE7, 0xFF,
+    0x9C, 0xE7, 0xFF, 0x98, 0xCF, 0xFF, 0x90, 0x0F, 0x8F, 0x82, 0x1F, 0x1F,
+    0xCF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xC7, 0xFC, 0x3F, 0x8F, 0xCC, 0x1F, 0x1F, 0x01, 0x9F,
+    0xFF, 0x23, 0xDF, 0xFE, 0x73, 0x9F, 0xFE, 0x70, 0x1F, 0xFE, 0x00, 0x3F,
+    0xFF, 0x0E, 0x7F, 0xFF, 0x9F, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFB, 0xE7, 0xFF, 0xC1, 0xE7, 0xFF,
+    0x81, 0xC7, 0xFF, 0x99, 0xCF, 0xFF, 0x9C, 0x1F, 0x8F, 0x9C, 0x3F, 0x1F,
+    0x9F, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xC7, 0xFC, 0x3F, 0x8F, 0xCC, 0x1F, 0x1F, 0x01, 0x9F,
+    0xFF, 0x23, 0xDF, 0xFE, 0x73, 0x9F, 0xFE, 0x70, 0x1F, 0xFE, 0x00, 0x3F,
+    0xFF, 0x0E, 0x7F, 0xFF, 0x9F, 0xFF,
+    // 0x215E '⅞'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xE7, 0xFF, 0x8F, 0x87, 0xFF, 0x9E, 0x1F, 0xFF,
+    0x9C, 0x7F, 0x8F, 0x98, 0xFF, 0x0F, 0x83, 0xFE, 0x3F, 0x87, 0xFC, 0x7F,
+    0x8F, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+    0x8F, 0xFC, 0x3F, 0x1F, 0xCC, 0x1F, 0xBF, 0x01, 0x9F, 0xFF, 0x23, 0xDF,
+    0xFE, 0x73, 0x9F, 0xFE, 0x70, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x0E, 0x7F,
+    0xFF, 0x9F, 0xFF,
+    // 0x2190 '←'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xC0, 0x7F, 0x89, 0x1F, 0x99, 0x9F,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0x9F, 0x89, 0x1F,
+    0xC0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x89, 0x1F, 0xD9, 0xBF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xD9, 0x9F, 0x89, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xE3, 0xF1, 0xFF, 0xC7, 0xF8, 0xFF,
+    0xCF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xFC, 0xFF,
+    0xC7, 0xF8, 0xFF, 0xE3, 0xF1, 0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE6, 0x7F, 0xC6, 0x1F, 0x86, 0x1F,
+    0xA6, 0x5F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xE0, 0x01, 0xC0, 0x01, 0x9F, 0xFF,
+    0x9F, 0xFF, 0xC0, 0x01, 0xE0, 0x01, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x5F, 0x86, 0x1F, 0xC6, 0x1F,
+    0xE6, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x80, 0x07, 0x80, 0x03, 0xFF, 0xF9,
+    0xFF, 0xF9, 0x80, 0x03, 0x80, 0x07, 0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x86, 0x1F, 0x86, 0x1F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0x86, 0x1F, 0x86, 0x1F,
+    0xC6, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xEF, 0xC0, 0x07, 0xCF, 0x8F, 0xE7,
+    0x9F, 0x1F, 0xE7, 0x9F, 0x3F, 0xE7, 0x9F, 0x3F, 0xE7, 0x9F, 0x3F, 0xCF,
+    0x8F, 0x3F, 0x1F, 0xC3, 0x10, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0x81, 0x9F, 0xFC, 0x0F, 0x9F, 0xF0, 0x3F, 0x9F, 0xC1, 0xFF, 0x9F,
+    0x87, 0xFF, 0x9F, 0x81, 0xFF, 0x9F, 0xC0, 0x3F, 0x9F, 0xF0, 0x07, 0x9F,
+    0xFE, 0x00, 0x9F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0x220F '∏'
+    0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x9F, 0xFF, 0xF9, 0xBF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF1, 0x87, 0xFF, 0xE1, 0x83, 0xFF, 0x81,
+    0x81, 0xFF, 0x09, 0x90, 0x7C, 0x39, 0x98, 0x38, 0x79, 0x9E, 0x10, 0xF9,
+    0x9F, 0x03, 0xF9, 0x9F, 0x87, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF1,
+    0x9F, 0xFF, 0xF1, 0x83, 0xFF, 0xE1, 0x83, 0xFF, 0x81, 0xFF, 0xFF, 0xCF,
+    // 0x221A '√'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF,
+    0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF3, 0xFF, 0xC0, 0xFF, 0x8C, 0x7F, 0x9E, 0x7F, 0x3E, 0x7F, 0x9E, 0x7F,
+    0x8C, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0xC8, 0xFF, 0x9C, 0x7F, 0x9E, 0x7F,
+    0x1E, 0x7F, 0x9C, 0x7F, 0x80, 0xFF, 0xC1, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xE6, 0x1F, 0xE6, 0x1F, 0xE6, 0x3F, 0xE4, 0x7F,
+    0xE0, 0x7F, 0xE2, 0x7F, 0x86, 0x7F, 0x86, 0x7F, 0xE6, 0x7F, 0xE7, 0x7F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xF9, 0xFC, 0xF8, 0xFC, 0xF0, 0xFC, 0xF2, 0x7C, 0xE6, 0x3C,
+    0xE7, 0x3C, 0xCF, 0x1C, 0xCF, 0x9C, 0x9F, 0x8C, 0x9F, 0xCC, 0xFF, 0xFC,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0x9F, 0xCC, 0x8F, 0x8C, 0xCF, 0x9C, 0xC7, 0x9C, 0xE7, 0x3C,
+    0xE3, 0x3C, 0xF2, 0x7C, 0xF0, 0x7C, 0xF8, 0xFC, 0xF8, 0xFC, 0xFD, 0xFC,
+    // 0x2500 '─'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2502 '│'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x250C '┌'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2514 '└'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x251C '├'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x252C '┬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x253C '┼'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2550 '═'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2551 '║'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255A '╚'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x255D '╝'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x256C '╬'
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF, 0x3F, 0xFF, 0xEF,
+    0x3F, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F
+};
+
+
+const uint8_t Bookerly26ItalicBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x37, 0x00, 0x02, 0x0F, 0x01, 0x60, 0x07, 0x08, 0x0A, 0x37,
+    0x00, 0x40, 0x07, 0x08, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x22 '"'
+    0x03, 0x7F, 0x60, 0x7F, 0x84, 0x7F, 0x10, 0x7F, 0x00, 0x7F, 0x16, 0x7F,
+    0x00, 0x7F, 0x10, 0x7F, 0xC0, 0x7F,
+    // 0x23 '#'
+    0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x21, 0x7F, 0x00, 0x24, 0x7F,
+    0x01, 0x42, 0x7F, 0x18, 0x08, 0x7F, 0x82, 0xA0, 0x7F, 0x20, 0x20, 0x7F,
+    0x00, 0x26, 0x7F, 0x00, 0x40, 0x7F, 0x02, 0x0C, 0x7F, 0x20, 0xE0, 0x7F,
+    0x08, 0x20, 0x7F, 0xC0, 0x20, 0x7F, 0x00, 0x30, 0x7F, 0x08, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x10, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x01, 0xC0, 0x08, 0x3F, 0x00, 0x00, 0x22, 0x3F, 0x00, 0x00, 0x20, 0x7F,
+    0x08, 0x08, 0x85, 0x3F, 0x04, 0x20, 0x70, 0x3F, 0x10, 0x82, 0x00, 0x3F,
+    0x30, 0x70, 0x08, 0x3F, 0x00, 0x01, 0x48, 0x3F, 0x50, 0x08, 0x10, 0x3F,
+    0x01, 0x04, 0x00, 0x3F, 0x08, 0x80, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x3F,
+    // 0x25 '%'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x10, 0x20, 0x27, 0x20, 0x10, 0x07, 0x20, 0x51, 0x27, 0x0F, 0x00, 0x47,
+    0x40, 0x41, 0x07, 0x0D, 0x10, 0x07, 0x00, 0x04, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x07, 0x02, 0x84, 0x07, 0x08, 0x00, 0x07, 0x12, 0x04, 0x07,
+    0x48, 0x40, 0x57, 0x00, 0x80, 0x57, 0xA0, 0x00, 0x47, 0x00, 0x21, 0x07,
+    0x00, 0x9C, 0x07, 0x00, 0x01, 0x87, 0x00, 0x1C, 0x07,
+    // 0x26 '&'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x47, 0x00, 0x20, 0x27, 0x00, 0x10, 0x27,
+    0x00, 0x80, 0x87, 0x04, 0x40, 0x17, 0x10, 0x00, 0x17, 0x40, 0x00, 0x07,
+    0x00, 0x82, 0x07, 0x22, 0x00, 0xA7, 0x85, 0x04, 0x27, 0xA2, 0x22, 0x07,
+    0x00, 0x02, 0x07, 0x40, 0x00, 0x87, 0x00, 0x10, 0x07, 0x00, 0x8C, 0x07,
+    0x00, 0xA0, 0x07, 0x00, 0x00, 0x2F, 0x01, 0x00, 0x27, 0x02, 0x00, 0x17,
+    0x02, 0x00, 0x07,
+    // 0x27 '''
+    0x03, 0x7F, 0x60, 0x7F, 0x84, 0x7F, 0x10, 0x7F, 0x00, 0x7F,
+    // 0x28 '('
+    0x00, 0x0B, 0xA0, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x0C, 0xC0, 0x1F,
+    0x00, 0x60, 0x10, 0x1F, 0x09, 0x00, 0x02, 0x1F, 0x12, 0x00, 0x00, 0x1F,
+    0x24, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x20, 0x1F, 0x20, 0x00, 0xC8, 0x1F, 0x01, 0x3A, 0x10, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x00, 0x85, 0x00, 0x1F,
+    // 0x2A '*'
+    0x20, 0x7F, 0x45, 0x7F, 0x00, 0x7F, 0x28, 0x7F, 0x84, 0xFF, 0x90, 0x7F,
+    0xC1, 0x7F, 0x04, 0x7F, 0x0C, 0x7F,
+    // 0x2B '+'
+    0x06, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x80, 0x1F,
+    0x80, 0x1F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    // 0x2C ','
+    0x01, 0x7F, 0x02, 0x7F, 0x04, 0x7F, 0x20, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F,
+    // 0x2D '-'
+    0x3F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xDF,
+    // 0x2E '.'
+    0x37, 0x4F, 0x0F, 0x17, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x01, 0x27,
+    0x00, 0x00, 0x47, 0x00, 0x10, 0x07, 0x00, 0x20, 0x07, 0x00, 0x18, 0x07,
+    0x02, 0x20, 0x07, 0x04, 0x00, 0x07, 0x02, 0x00, 0x07, 0x44, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0xCF, 0x02, 0x00, 0x2F, 0x00, 0x12, 0x0F,
+    0x11, 0x80, 0x0F, 0x22, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x0F,
+    0x50, 0x00, 0x2F, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x8F,
+    0x43, 0x00, 0x0F, 0x00, 0x06, 0x0F, 0x10, 0x08, 0x0F, 0x07, 0x80, 0x0F,
+    // 0x31 '1'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x1F,
+    0x08, 0x0A, 0x1F, 0x08, 0x80, 0x1F, 0x0C, 0x01, 0x1F, 0x00, 0x28, 0x5F,
+    0x05, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    // 0x32 '2'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F, 0x04, 0x02, 0x1F,
+    0x02, 0x04, 0x9F, 0x24, 0x00, 0x1F, 0x40, 0x0A, 0x1F, 0x40, 0x10, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x08, 0x1F, 0x10, 0x80, 0x1F, 0x44, 0x00, 0x1F,
+    0x40, 0x00, 0x7F, 0x00, 0x80, 0x1F, 0x12, 0x00, 0x1F,
+    // 0x33 '3'
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x0F, 0x08, 0x10, 0x0F, 0x40, 0x40, 0x0F, 0x50, 0x00, 0x0F,
+    0x00, 0x80, 0x2F, 0x01, 0x10, 0x4F, 0x02, 0x40, 0x0F, 0x4C, 0x80, 0x8F,
+    0x01, 0x14, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x0C, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x44, 0x3F, 0x00, 0x84, 0x3F,
+    0x01, 0x14, 0x3F, 0x02, 0x14, 0x3F, 0x04, 0x94, 0x3F, 0x09, 0x14, 0x3F,
+    0x02, 0x16, 0xBF, 0x04, 0x30, 0x3F, 0x03, 0x00, 0x7F, 0x90, 0x06, 0x3F,
+    0x01, 0x54, 0x3F, 0x10, 0x14, 0x3F, 0x00, 0x1C, 0x3F,
+    // 0x35 '5'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x08, 0x00, 0x1F,
+    0x60, 0x00, 0x1F, 0x80, 0x00, 0x5F, 0xA0, 0x00, 0x5F, 0x82, 0x00, 0x1F,
+    0x82, 0x30, 0x9F, 0x81, 0x00, 0x1F, 0x80, 0x82, 0x1F, 0x80, 0x48, 0x1F,
+    0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x36 '6'
+    0x00, 0x0B, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x2F, 0x02, 0x2E, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x40, 0x1F, 0x12, 0x40, 0x5F, 0x24, 0x00, 0x0F,
+    0x08, 0x00, 0xAF, 0x40, 0x12, 0x0F, 0x40, 0x00, 0x4F, 0x00, 0x40, 0x8F,
+    0x00, 0x22, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x37 '7'
+    0x08, 0x00, 0x1F, 0x00, 0x02, 0x3F, 0x80, 0x00, 0x3F, 0xA0, 0x00, 0x9F,
+    0x80, 0x02, 0x1F, 0x80, 0x88, 0x1F, 0x80, 0x20, 0x1F, 0x84, 0x40, 0x1F,
+    0x81, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x84, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x05, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x09, 0x24, 0x8F,
+    0x20, 0x00, 0x1F, 0x02, 0x10, 0x5F, 0x11, 0x00, 0x4F, 0x40, 0x90, 0x0F,
+    0x00, 0x80, 0x2F, 0x01, 0x43, 0x2F, 0x12, 0x00, 0x0F, 0x48, 0x00, 0x0F,
+    0x00, 0x06, 0x0F, 0x36, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x5F, 0x01, 0x80, 0x1F, 0x00, 0x00, 0x5F,
+    0x10, 0x00, 0x0F, 0x25, 0x00, 0xAF, 0x08, 0x08, 0x2F, 0x50, 0x28, 0x4F,
+    0x00, 0x0A, 0x0F, 0x00, 0x0C, 0x8F, 0x10, 0x20, 0x0F, 0x40, 0x82, 0x0F,
+    0x00, 0x08, 0x0F, 0x20, 0x30, 0x0F, 0x08, 0x80, 0x0F,
+    // 0x3A ':'
+    0x00, 0x0D, 0x00, 0x13, 0x00, 0x03, 0x48, 0x05, 0x00, 0x01, 0x00, 0x01,
+    0x20, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x1F, 0x48, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x1F,
+    // 0x3C '<'
+    0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x8F, 0x00, 0x4F,
+    0x00, 0x4F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x1F, 0xA0, 0x1F, 0x00, 0x2F,
+    // 0x3D '='
+    0xC5, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x09,
+    // 0x3E '>'
+    0x00, 0x0F, 0xA0, 0x0F, 0x10, 0x4F, 0x10, 0x0F, 0x08, 0x0F, 0x08, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x02, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x04, 0x0F,
+    // 0x3F '?'
+    0x00, 0x08, 0x6F, 0x10, 0x00, 0x9F, 0x90, 0x40, 0x0F, 0x00, 0x28, 0xCF,
+    0x00, 0x08, 0x0F, 0x90, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x22, 0x00, 0x0F,
+    0x08, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x19, 0x01, 0x00, 0xC0, 0x01, 0x03, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x25, 0x00, 0x00, 0x11, 0x20, 0x04, 0x09, 0x08, 0x60, 0x83,
+    0x50, 0x80, 0x0B, 0x40, 0x02, 0x03, 0x02, 0x00, 0x83, 0x81, 0x00, 0x03,
+    0x25, 0x01, 0x09, 0xA4, 0x09, 0x03, 0x82, 0x20, 0x89, 0xA2, 0x08, 0x01,
+    0x20, 0xC0, 0x09, 0x02, 0x02, 0x81, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
+    0x4C, 0x30, 0x01, 0x20, 0x04, 0x01, 0x08, 0x20, 0x01, 0x01, 0x00, 0x01,
+    // 0x41 'A'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0xDF, 0x00, 0x32, 0x1F, 0x00, 0x44, 0x3F,
+    0x00, 0x14, 0x1F, 0x04, 0x04, 0x1F, 0x18, 0x04, 0x1F, 0x20, 0x04, 0x1F,
+    0x08, 0x04, 0x3F, 0x81, 0x34, 0x5F, 0x20, 0x02, 0xDF, 0x05, 0x00, 0x1F,
+    0x00, 0x28, 0x1F, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    // 0x42 'B'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x02, 0x8F,
+    0x00, 0x50, 0x0F, 0x0A, 0x00, 0x8F, 0x00, 0x14, 0x0F, 0x02, 0xA0, 0x4F,
+    0xB0, 0x20, 0x4F, 0x80, 0xA0, 0x4F, 0x80, 0x80, 0x2F, 0x00, 0x80, 0xAF,
+    0x01, 0x1C, 0x0F, 0x40, 0xC0, 0x0F, 0x00, 0x01, 0x0F, 0x0A, 0x0C, 0x0F,
+    // 0x43 'C'
+    0x00, 0xE5, 0x0F, 0x02, 0x00, 0x8F, 0x08, 0x10, 0x0F, 0x00, 0x02, 0x0F,
+    0x24, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x01, 0x4F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x02, 0x8F,
+    0x00, 0x50, 0x0F, 0x0A, 0x00, 0x8F, 0x00, 0x14, 0x4F, 0x01, 0x00, 0x4F,
+    0x88, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0xA0, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x10, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x04, 0x1F, 0x01, 0x20, 0x1F,
+    0x08, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x20, 0x1F, 0x00, 0x40, 0x7F, 0x18, 0x01, 0x1F, 0x04, 0x00, 0x1F,
+    0x10, 0x00, 0x1F,
+    // 0x46 'F'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x14, 0x5F, 0x01, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0xE5, 0x0F, 0x02, 0x00, 0x8F, 0x08, 0x10, 0x4F, 0x00, 0x00, 0x2F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x08, 0x2F,
+    0x10, 0x0C, 0x2F, 0x16, 0x00, 0x0F, 0x40, 0x05, 0x0F, 0x50, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x04, 0x5F, 0x01, 0x20, 0x5F,
+    0x08, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x00, 0x20, 0x3F,
+    0x00, 0x20, 0x5F, 0x00, 0x20, 0x5F, 0x00, 0x22, 0x9F, 0x60, 0x00, 0x1F,
+    0x25, 0x00, 0x1F, 0x00, 0x0A, 0x5F, 0x01, 0x40, 0x3F, 0x10, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x49 'I'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x04, 0x5F, 0x01, 0x40, 0x5F,
+    0x08, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x28, 0x00, 0x25, 0x00, 0x60, 0x00, 0x02, 0x00, 0x00, 0xA0, 0x00,
+    0x14, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0x4B 'K'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x02, 0x8F,
+    0x00, 0x50, 0x0F, 0x2A, 0x00, 0x8F, 0x00, 0x04, 0x4F, 0x01, 0x00, 0x0F,
+    0x08, 0x08, 0x0F, 0x01, 0x04, 0x0F, 0x00, 0xA1, 0x0F, 0x00, 0x08, 0x0F,
+    0x08, 0x00, 0x0F, 0x52, 0x02, 0x0F, 0x24, 0x01, 0x0F, 0x00, 0x00, 0x9F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x04, 0x1F, 0x01, 0x40, 0x1F,
+    0x08, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x01, 0x9F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x02, 0x1F, 0x00, 0x40, 0x1F, 0x23, 0x06, 0x1F, 0x20, 0x10, 0x1F,
+    0x02, 0x00, 0x1F, 0x0C, 0x00, 0x1F, 0x00, 0x58, 0x1F, 0x30, 0x01, 0x9F,
+    0x01, 0x40, 0x1F, 0x00, 0x09, 0x1F, 0x00, 0x06, 0x1F, 0x00, 0x88, 0x1F,
+    0x02, 0x00, 0x1F, 0x0C, 0x00, 0x1F, 0x12, 0x00, 0x1F, 0x04, 0x1C, 0x9F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1C, 0xE0, 0x5F, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x05, 0x0F,
+    0x20, 0x50, 0x0F, 0x2A, 0x02, 0xCF, 0x00, 0x50, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x18, 0x40, 0x0F, 0x02, 0x18, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x1F, 0x60, 0x50, 0x0F,
+    0x2A, 0x01, 0x8F, 0x00, 0x28, 0x0F, 0x05, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x00, 0x43, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x18, 0x0F, 0x01, 0x81, 0x0F,
+    0x24, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x10, 0x00, 0x5F, 0x10, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0xA0, 0x00, 0x8F, 0x80, 0x00, 0x0F,
+    0x10, 0x00, 0x4F, 0x40, 0x00, 0x0F, 0x02, 0x40, 0x0F, 0x20, 0x06, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x0A, 0x00, 0x9F, 0x00, 0x04, 0x5F, 0x01, 0x40, 0x1F,
+    0xA8, 0x00, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x40, 0x1F, 0x20, 0x00, 0x1F,
+    0x10, 0xA0, 0x1F, 0x4E, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x12, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x00, 0x43, 0x00, 0x7F, 0x02, 0x00, 0x80, 0x7F, 0x08, 0x38, 0x40, 0x7F,
+    0x01, 0x80, 0x20, 0x7F, 0x24, 0x00, 0x10, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x48, 0x7F, 0x10, 0x00, 0x44, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x20, 0x00, 0xA2, 0x7F, 0xA0, 0x00, 0xA2, 0x7F, 0x80, 0x01, 0x00, 0x7F,
+    0x10, 0x02, 0x40, 0x7F, 0x40, 0x00, 0x80, 0x7F, 0x03, 0xC1, 0x04, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x20, 0x02, 0x7F, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x02, 0x8F,
+    0x00, 0x50, 0x0F, 0x2A, 0x00, 0x8F, 0x00, 0x04, 0x4F, 0x02, 0xC0, 0x2F,
+    0xA0, 0x58, 0x0F, 0x80, 0x06, 0x0F, 0x80, 0x01, 0x0F, 0x00, 0x08, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x41, 0x2F, 0x20, 0x80, 0x8F, 0x12, 0x00, 0x0F,
+    0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x00, 0x01, 0xCF, 0x00, 0x00, 0x2F, 0x07, 0x04, 0x2F, 0x20, 0x80, 0x8F,
+    0x00, 0x40, 0x5F, 0x42, 0x20, 0x5F, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0xAF, 0xA0, 0x02, 0x0F, 0x1C, 0x20, 0x4F, 0x00, 0x18, 0x0F,
+    0x0C, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x54 'T'
+    0x5C, 0x00, 0x3F, 0x04, 0x00, 0x5F, 0x10, 0x00, 0x5F, 0x00, 0x01, 0x1F,
+    0x00, 0x10, 0x1F, 0x02, 0x80, 0x1F, 0x10, 0x05, 0x5F, 0x00, 0xA0, 0x1F,
+    0x04, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x0C, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x55 'U'
+    0x40, 0x0D, 0x0F, 0x01, 0x40, 0x0F, 0x08, 0x00, 0x2F, 0x00, 0x3A, 0x0F,
+    0x05, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x4F,
+    0x40, 0x50, 0x8F, 0x2A, 0x00, 0x0F, 0x00, 0x30, 0x0F, 0x05, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x56 'V'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x02, 0x40, 0x0F,
+    0x00, 0x0D, 0x0F, 0x0C, 0x00, 0x0F, 0x20, 0x64, 0x0F, 0x20, 0x01, 0x0F,
+    0x00, 0x04, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x04, 0x60, 0x0F, 0x30, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x57 'W'
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x0E, 0x70, 0x0F, 0x00, 0x00, 0x6F,
+    0x00, 0x00, 0x0F, 0x20, 0x07, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x80, 0x0F,
+    0x00, 0x60, 0x0F, 0x40, 0x01, 0x8F, 0x67, 0x00, 0x0F, 0x00, 0x0F, 0x0F,
+    0x00, 0x06, 0x6F, 0x00, 0x11, 0x0F, 0x00, 0x04, 0x0F, 0x21, 0x10, 0x0F,
+    0x2C, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0xDF, 0x08, 0x08, 0x1F, 0x02, 0x12, 0x1F,
+    0x01, 0x84, 0x1F, 0x28, 0x10, 0x1F, 0x23, 0x10, 0x1F, 0x01, 0x04, 0x5F,
+    0x00, 0x01, 0x5F, 0x04, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x40, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x06, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x3A, 0x1F, 0x02, 0x00, 0x1F, 0x40, 0x02, 0x9F,
+    0x00, 0x10, 0x5F, 0x01, 0x20, 0x5F, 0x04, 0x00, 0x1F, 0x01, 0x00, 0x1F,
+    0x12, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x2C, 0x04, 0x0F,
+    0x04, 0x08, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x24, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x10, 0x0F, 0x02, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x8F,
+    0x10, 0x01, 0x0F, 0x04, 0x00, 0x2F, 0x08, 0x01, 0x0F, 0x20, 0x00, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x05, 0x03, 0x3F,
+    0x00, 0x50, 0x28, 0x3F, 0x06, 0x03, 0x01, 0x3F, 0x20, 0x50, 0x00, 0x3F,
+    0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x8C, 0x00, 0x07, 0x60, 0x00, 0x07,
+    0x0C, 0x00, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x60, 0x07, 0x00, 0x0C, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07,
+    // 0x5D ']'
+    0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x28, 0x14, 0x3F,
+    0x02, 0x01, 0x00, 0x3F, 0x10, 0x28, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0xC7, 0x00, 0x17, 0x18, 0x07, 0x03, 0x07, 0x00, 0x07,
+    0x18, 0x07, 0x40, 0x07, 0x00, 0xC7, 0x06, 0x07, 0x00, 0x07, 0x00, 0x37,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x60 '`'
+    0x43, 0x13, 0x03, 0x03, 0x07, 0x03,
+    // 0x61 'a'
+    0x02, 0x89, 0x08, 0x01, 0x11, 0xA3, 0x20, 0x01, 0x00, 0x01, 0x00, 0x15,
+    0x00, 0x01, 0x00, 0x41, 0x80, 0x39, 0x54, 0x03, 0x00, 0xB1, 0x88, 0x01,
+    0xE0, 0x09, 0x00, 0x11,
+    // 0x62 'b'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x63, 0x60, 0x06, 0x03, 0x40, 0xA0, 0x0B,
+    0x08, 0x00, 0x03, 0x00, 0x00, 0x13, 0x06, 0x50, 0x17, 0x60, 0xA0, 0x03,
+    0x00, 0x00, 0x2B, 0x01, 0x40, 0x43, 0x00, 0x15, 0x03, 0x01, 0x00, 0x43,
+    0x00, 0x01, 0x03, 0x00, 0x38, 0x03,
+    // 0x63 'c'
+    0x01, 0x19, 0x00, 0x01, 0x01, 0xE1, 0x08, 0x13, 0x50, 0x01, 0xA0, 0x01,
+    0x00, 0x11, 0x20, 0x01, 0x00, 0x09, 0x60, 0x01,
+    // 0x64 'd'
+    0x00, 0x01, 0x13, 0x00, 0x08, 0x03, 0x00, 0x03, 0x47, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x21, 0x00, 0x73, 0x40, 0xA8, 0x07, 0x05, 0x01, 0x63, 0x00, 0x18, 0x03,
+    0x02, 0x80, 0x13, 0x68, 0x00, 0x23,
+    // 0x65 'e'
+    0x01, 0x19, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x52, 0x01, 0x22, 0x01,
+    0x05, 0x15, 0x28, 0x15, 0x00, 0x21, 0x00, 0x21, 0x20, 0x01,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x06, 0x5F, 0x01, 0x00, 0x20, 0x9F, 0x00, 0x0A, 0x02, 0x1F,
+    0x02, 0xC0, 0x28, 0x1F, 0x04, 0x05, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x1F,
+    0x48, 0x00, 0x00, 0x1F, 0xA2, 0x00, 0x00, 0x1F, 0x82, 0x00, 0x00, 0x1F,
+    0x02, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x67 'g'
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x27, 0x00, 0x00, 0x07, 0x00, 0x04, 0x97,
+    0x00, 0x00, 0x47, 0x00, 0xB8, 0x07, 0x20, 0x44, 0x07, 0x09, 0x20, 0x07,
+    0x01, 0x00, 0x07, 0xA1, 0x40, 0x17, 0x00, 0x00, 0x07, 0x04, 0x80, 0x87,
+    0x00, 0x04, 0x27, 0x80, 0x01, 0xC7, 0x90, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x68 'h'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x63, 0x60, 0x0A, 0x03, 0x40, 0x80, 0x2B,
+    0x14, 0x01, 0x83, 0x00, 0x22, 0x03, 0x06, 0x20, 0x03, 0x60, 0x50, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x00, 0x43, 0x00, 0x54, 0x07, 0x00, 0x00, 0x83,
+    0x01, 0x02, 0x03, 0x00, 0x60, 0x53, 0x00, 0x00, 0x43,
+    // 0x69 'i'
+    0x01, 0x80, 0x57, 0x00, 0x04, 0x07, 0x02, 0x30, 0x07, 0x00, 0x01, 0xC7,
+    0x80, 0x10, 0x57, 0x00, 0x40, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x06, 0x1F,
+    0x00, 0x80, 0x20, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x02, 0x28, 0x10, 0x1F,
+    0x20, 0x00, 0x40, 0x1F, 0x00, 0x14, 0x00, 0x1F, 0x01, 0x80, 0x00, 0x1F,
+    0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x6B 'k'
+    0x00, 0x00, 0x2B, 0x20, 0x02, 0x83, 0x40, 0x50, 0x03, 0x05, 0x00, 0x43,
+    0x00, 0x00, 0x03, 0x02, 0x10, 0x43, 0x68, 0x21, 0x13, 0x00, 0x00, 0x8B,
+    0x01, 0x40, 0x43, 0x00, 0x34, 0x23, 0x00, 0x00, 0x07, 0x00, 0x80, 0x13,
+    0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x00, 0x00, 0x53, 0x00, 0x06, 0x07, 0x40, 0xA0, 0x03, 0x0A, 0x02, 0xAB,
+    0x00, 0x30, 0x03, 0x05, 0x00, 0x03, 0x10, 0x00, 0x03,
+    // 0x6D 'm'
+    0x60, 0x09, 0x00, 0x41, 0x94, 0x05, 0x00, 0x01, 0x89, 0x81, 0x12, 0x01,
+    0x28, 0x01, 0x50, 0x01, 0x00, 0x11, 0xA1, 0x01, 0x00, 0x09, 0x80, 0x81,
+    0x3A, 0x01, 0x10, 0x01, 0x28, 0x01, 0x50, 0x15, 0xA1, 0x41, 0x04, 0x01,
+    0x00, 0x91, 0x4A, 0x15, 0x00, 0x09, 0x00, 0x01,
+    // 0x6E 'n'
+    0x60, 0x09, 0x00, 0x41, 0x94, 0x05, 0x00, 0x11, 0x89, 0x81, 0x12, 0x01,
+    0x28, 0x01, 0x50, 0x01, 0x00, 0x05, 0xA0, 0x81, 0x18, 0x01, 0x00, 0x51,
+    0x34, 0x01, 0x00, 0x09, 0x00, 0x01,
+    // 0x6F 'o'
+    0x01, 0x11, 0x08, 0x05, 0x01, 0xA1, 0x04, 0x01, 0x50, 0x0B, 0x00, 0x09,
+    0x00, 0x01, 0x20, 0x01, 0x20, 0x41, 0x81, 0x01, 0x40, 0x01, 0x01, 0x01,
+    0x00, 0x01,
+    // 0x70 'p'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x60, 0x0A, 0x0F,
+    0x00, 0xA0, 0x0F, 0x94, 0x05, 0x2F, 0x00, 0x64, 0x2F, 0x98, 0x00, 0x2F,
+    0x00, 0x0A, 0x0F, 0x28, 0x08, 0x0F, 0x50, 0x10, 0x0F, 0xA0, 0x24, 0x0F,
+    0x20, 0xC0, 0x0F, 0x0E, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x16, 0x00, 0x0F,
+    // 0x71 'q'
+    0x02, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x22, 0x0F, 0x00, 0x00, 0x0F,
+    0x50, 0x00, 0x2F, 0x80, 0x04, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x43, 0x0F,
+    0x80, 0x00, 0x0F, 0x54, 0x05, 0x8F, 0x00, 0xA0, 0x0F, 0x88, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x20, 0x0B, 0x00, 0xA3, 0x88, 0x03, 0x00, 0x13, 0x0C, 0x83, 0x10, 0x03,
+    0x28, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x20, 0x03,
+    // 0x73 's'
+    0x00, 0x19, 0x00, 0x25, 0x18, 0x11, 0x00, 0x03, 0x49, 0x0B, 0x04, 0x09,
+    0x20, 0x15, 0x00, 0x01, 0x00, 0x11, 0x10, 0x01, 0x00, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x50, 0xBF, 0x05, 0x00, 0x3F,
+    0x60, 0x14, 0x7F, 0x02, 0x80, 0x3F, 0x40, 0x00, 0xBF, 0x10, 0x04, 0x3F,
+    0x10, 0x01, 0x3F, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x20, 0x01, 0x00, 0x45, 0x8C, 0x01, 0x00, 0x03, 0x04, 0x01, 0x20, 0x05,
+    0x00, 0x11, 0x00, 0x29, 0x00, 0x21, 0x00, 0x05, 0x50, 0x03, 0x01, 0x81,
+    0x98, 0x15, 0x00, 0x09, 0x00, 0x01,
+    // 0x76 'v'
+    0x60, 0x01, 0x00, 0x01, 0xA0, 0x01, 0x0A, 0x01, 0x00, 0x39, 0x28, 0x01,
+    0x00, 0x25, 0x00, 0x49, 0x00, 0x11, 0x00, 0x01, 0x10, 0x01, 0x02, 0x01,
+    0x38, 0x01,
+    // 0x77 'w'
+    0x60, 0x01, 0x00, 0x01, 0xA0, 0x01, 0x0C, 0x01, 0x00, 0x45, 0x28, 0x01,
+    0x01, 0x81, 0x00, 0x21, 0x00, 0x11, 0x86, 0x41, 0x01, 0x81, 0x80, 0xC5,
+    0x28, 0x01, 0x00, 0xC1, 0x00, 0x21, 0x00, 0x01, 0xE6, 0x21, 0x00, 0x01,
+    0x00, 0x01, 0x70, 0x01,
+    // 0x78 'x'
+    0x00, 0x01, 0x00, 0x01, 0x40, 0x03, 0x00, 0x11, 0x20, 0x25, 0x00, 0x09,
+    0x86, 0xA1, 0x60, 0x01, 0x00, 0x31, 0x01, 0x01, 0x04, 0x01, 0x40, 0x11,
+    0x10, 0x05, 0x20, 0x15, 0x00, 0x11, 0x20, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x18, 0x00, 0xA7, 0x82, 0x82, 0x47,
+    0x60, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x12, 0x07, 0x00, 0x28, 0x07,
+    0x00, 0x80, 0x07, 0x9A, 0x40, 0x07, 0x01, 0x80, 0x07, 0x82, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x05, 0x28, 0x21, 0x08, 0x49, 0x80, 0x81, 0x01, 0x31, 0x80, 0x51,
+    0x10, 0x11, 0x18, 0x03, 0x00, 0x03, 0x48, 0x11, 0x10, 0x01, 0x00, 0x01,
+    // 0x7B '{'
+    0x00, 0x00, 0x05, 0x3F, 0x00, 0x18, 0x00, 0xBF, 0x00, 0x10, 0x06, 0x3F,
+    0x00, 0x20, 0x00, 0x7F, 0x18, 0x12, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x18, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F,
+    // 0x7C '|'
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xA0, 0x00, 0x14, 0x04, 0x01, 0x40, 0xA0,
+    0x28, 0x14, 0x00, 0x82, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0xBF, 0x80, 0x24, 0x02, 0x3F,
+    0x80, 0x01, 0x70, 0x3F, 0x24, 0x02, 0x00, 0x3F, 0x81, 0x90, 0x00, 0x3F,
+    0x54, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x27, 0x07, 0xA7, 0x27, 0x87, 0x87, 0x47, 0x47, 0x07, 0x47, 0x17, 0x07,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x6F, 0x00, 0x01, 0x1F, 0x00, 0x20, 0x1F,
+    0x51, 0x01, 0x4F, 0x00, 0x68, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0xA2 '¢'
+    0x00, 0x2A, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x01, 0x1A, 0x20, 0x7F,
+    0x02, 0x00, 0x0A, 0xFF, 0x00, 0x80, 0x00, 0x7F, 0x05, 0x0A, 0x14, 0x7F,
+    0x04, 0xC2, 0x80, 0x7F, 0x10, 0x28, 0x00, 0x7F, 0x01, 0x80, 0x00, 0x7F,
+    0x28, 0x00, 0x00, 0x7F, 0x04, 0x01, 0x00, 0x7F, 0x04, 0x81, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x40, 0x0F,
+    0x00, 0x44, 0x0F, 0x00, 0x50, 0x0F, 0x03, 0x00, 0x0F, 0x08, 0x04, 0x2F,
+    0x11, 0x40, 0x0F, 0x20, 0x00, 0x0F, 0x50, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x40, 0x8F, 0x00, 0x40, 0x0F, 0x08, 0x00, 0x4F, 0x44, 0x00, 0x0F,
+    0x20, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x37, 0x00, 0x17, 0x40, 0x47, 0xA4, 0x27, 0x40, 0x07, 0x04, 0x07,
+    0x00, 0x47, 0x10, 0x47, 0x40, 0x07, 0x40, 0x07, 0x11, 0x07, 0x00, 0x07,
+    0x00, 0x47, 0x40, 0x27, 0x20, 0x07, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x3F, 0x81, 0x88, 0x3F, 0x99, 0x40, 0xBF, 0x80, 0x40, 0xBF,
+    0xA0, 0x05, 0x3F, 0x8C, 0x00, 0x3F, 0xC1, 0x81, 0x3F, 0x00, 0x0C, 0xBF,
+    0x00, 0x20, 0x3F, 0x00, 0x40, 0x3F, 0x49, 0x40, 0x3F, 0xA1, 0x68, 0x3F,
+    0x89, 0x00, 0x3F, 0x90, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
+    0x40, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0xA7, 0x0C, 0x01, 0x07, 0x13, 0x00, 0xC7, 0x24, 0x00, 0x27,
+    0x12, 0x28, 0x07, 0x25, 0x00, 0x27, 0x02, 0x00, 0x17, 0x81, 0x40, 0x97,
+    0xA0, 0x20, 0x07, 0x88, 0x82, 0x07, 0x00, 0x21, 0x07, 0x10, 0x00, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x01, 0x08, 0x0F, 0x14, 0x00, 0x8F,
+    0x00, 0x01, 0x4F, 0x00, 0x80, 0x2F, 0x42, 0x04, 0x2F, 0x04, 0x60, 0x0F,
+    0x20, 0x00, 0x1F, 0x82, 0x04, 0x1F, 0x82, 0x00, 0x0F, 0xA1, 0x00, 0x1F,
+    0x00, 0x06, 0x4F, 0x40, 0x00, 0x4F, 0x50, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    // 0xAA 'ª'
+    0x00, 0x07, 0x18, 0x0F, 0x26, 0x0F, 0x51, 0x4F, 0x01, 0x0F, 0xA2, 0x0F,
+    0x28, 0x0F, 0x04, 0x07, 0x11, 0x07, 0x01, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x24, 0x9F, 0x01, 0x5F, 0x10, 0xDF,
+    0xAC, 0x1F, 0x50, 0x1F, 0x00, 0x9F, 0x0A, 0x1F, 0x40, 0x1F, 0x80, 0x1F,
+    0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x02, 0x09, 0x30, 0x05, 0x48, 0x2D, 0x47, 0xC1,
+    0x00, 0x03, 0x00, 0xA5, 0x06, 0x47, 0x09, 0xA1, 0x00, 0x41, 0x10, 0x15,
+    0x00, 0x61, 0x00, 0x31, 0x03, 0x81,
+    // 0xB0 '°'
+    0x0C, 0x3F, 0x21, 0x3F, 0x4C, 0xBF, 0x40, 0x3F, 0x20, 0x3F, 0x20, 0x3F,
+    0x50, 0x3F, 0x40, 0xBF, 0x21, 0x3F, 0x00, 0x3F,
+    // 0xB1 '±'
+    0x02, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00,
+    // 0xB2 '²'
+    0x00, 0x07, 0x00, 0x07, 0x10, 0x0F, 0x00, 0x8F, 0x40, 0x0F, 0x20, 0x0F,
+    0x82, 0x8F, 0xA4, 0x0F, 0x02, 0x07, 0x00, 0x27, 0x10, 0x07,
+    // 0xB3 '³'
+    0x00, 0x1F, 0x00, 0x0F, 0x12, 0x0F, 0x50, 0x27, 0x01, 0x2F, 0xA1, 0x17,
+    0xB8, 0x07, 0x06, 0x47, 0x08, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x47, 0x00, 0x28, 0x07, 0x05, 0x01, 0xC7,
+    0x20, 0x00, 0x07, 0x82, 0xC0, 0x07, 0x50, 0x02, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x14, 0x07, 0x00, 0x20, 0x07, 0x00, 0xD0, 0x07, 0x14, 0x1C, 0x07,
+    0x00, 0x00, 0x07, 0x86, 0x10, 0x07, 0x20, 0x04, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0x00, 0x20, 0x01,
+    0x10, 0x00, 0x0B, 0x20, 0x00, 0x05, 0x00, 0x01, 0x41, 0x40, 0x08, 0x01,
+    0x40, 0x02, 0x29, 0x00, 0x51, 0x11, 0x0A, 0x28, 0x61, 0x05, 0x05, 0x01,
+    0x00, 0xA0, 0x01, 0x14, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01,
+    // 0xB7 '·'
+    0x7F, 0x8F, 0x1F, 0xEF,
+    // 0xB9 '¹'
+    0x00, 0x0F, 0x20, 0x0F, 0x40, 0x4F, 0x4A, 0x0F, 0x00, 0x6F, 0x85, 0x2F,
+    0x20, 0x17,
+    // 0xBA 'º'
+    0x00, 0x0F, 0x05, 0x0F, 0x10, 0x8F, 0x05, 0x0F, 0x50, 0x0F, 0x00, 0x0F,
+    0xA2, 0x0F, 0x08, 0x87, 0x01, 0x17, 0x1C, 0x07,
+    // 0xBB '»'
+    0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x90, 0x1F, 0x4C, 0x1F, 0x21, 0x1F,
+    0x12, 0x9F, 0x41, 0x5F, 0xA2, 0x1F, 0x00, 0x9F, 0x01, 0x1F, 0x00, 0x1F,
+    0x0C, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x10, 0x07, 0x20, 0x18, 0x07, 0x10, 0x28, 0x07, 0x55, 0x08, 0x07,
+    0x00, 0x28, 0x07, 0x05, 0x08, 0x17, 0x00, 0x00, 0x47, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x09, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x48, 0x07, 0x00, 0xA0, 0x07, 0x02, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x02, 0x00, 0x87, 0x00, 0x00, 0x87, 0x48, 0x02, 0x87, 0x20, 0x02, 0x87,
+    0x00, 0x02, 0x27, 0x00, 0x14, 0x07, 0x01, 0x00, 0xC7, 0x01, 0x12, 0x87,
+    0x00, 0x80, 0x07,
+    // 0xBD '½'
+    0x00, 0x10, 0x07, 0x20, 0x18, 0x07, 0x10, 0x28, 0x07, 0x55, 0x08, 0x07,
+    0x00, 0x28, 0x17, 0x05, 0x08, 0x47, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x09, 0x07, 0x00, 0x04, 0x07, 0x00, 0x48, 0x07,
+    0x00, 0xA0, 0x07, 0x02, 0x00, 0x07, 0x00, 0x80, 0x07, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x48, 0x41, 0x07, 0x20, 0xA0, 0x07, 0x01, 0x40, 0x47,
+    0x00, 0x05, 0x47, 0x01, 0x08, 0x47, 0x00, 0x44, 0x47, 0x00, 0x08, 0x27,
+    0x00, 0x10, 0x07,
+    // 0xBE '¾'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x01, 0x10, 0x07, 0x43, 0x00, 0x07,
+    0x41, 0x20, 0x07, 0x20, 0xC0, 0x07, 0x10, 0x00, 0x07, 0x05, 0x00, 0x47,
+    0x18, 0x01, 0x27, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x50, 0x07, 0x01, 0x20, 0x07, 0x02, 0x00, 0x07,
+    0x09, 0x00, 0x07, 0x02, 0x00, 0x87, 0x00, 0x00, 0x87, 0x10, 0x02, 0x87,
+    0xA0, 0x02, 0x87, 0x00, 0x02, 0x27, 0x00, 0x14, 0x07, 0x01, 0x00, 0xC7,
+    0x01, 0x12, 0x87, 0x00, 0x80, 0x07,
+    // 0xBF '¿'
+    0x00, 0x02, 0x8F, 0x00, 0x08, 0x4F, 0x00, 0x03, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x9F, 0x60, 0x80, 0x0F, 0x00, 0x00, 0x8F, 0x90, 0x80, 0xCF,
+    0xA0, 0x00, 0x0F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x23, 0x7F,
+    0x00, 0x00, 0xC8, 0x7F, 0x00, 0x01, 0x10, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x40, 0x60, 0x10, 0x7F, 0x90, 0x80, 0x10, 0x7F,
+    0x00, 0x20, 0x10, 0xFF, 0x22, 0x04, 0xD1, 0x7F, 0x10, 0x80, 0x0B, 0x7F,
+    0x00, 0x14, 0x00, 0x7F, 0x00, 0x00, 0xA0, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x23, 0x7F,
+    0x00, 0x00, 0xC8, 0x7F, 0x00, 0x01, 0x10, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x00, 0x60, 0x10, 0x7F, 0x18, 0x80, 0x10, 0x7F,
+    0x08, 0x20, 0x10, 0xFF, 0x22, 0x04, 0xD1, 0x7F, 0x40, 0x80, 0x0B, 0x7F,
+    0x10, 0x14, 0x00, 0x7F, 0x10, 0x00, 0xA0, 0x7F, 0x60, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x23, 0x7F,
+    0x00, 0x00, 0xC8, 0x7F, 0x00, 0x01, 0x10, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x08, 0x10, 0x10, 0x7F, 0x10, 0x60, 0x10, 0x7F, 0x28, 0x80, 0x10, 0x7F,
+    0x40, 0x20, 0x10, 0xFF, 0x02, 0x04, 0xD1, 0x7F, 0x00, 0x80, 0x0B, 0x7F,
+    0x00, 0x14, 0x00, 0x7F, 0x20, 0x00, 0xA0, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x23, 0x7F,
+    0x00, 0x00, 0xC8, 0x7F, 0x00, 0x01, 0x10, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x20, 0x10, 0x10, 0x7F, 0x08, 0x60, 0x10, 0x7F, 0x80, 0x80, 0x10, 0x7F,
+    0x80, 0x20, 0x10, 0xFF, 0x02, 0x04, 0xD1, 0x7F, 0x00, 0x80, 0x0B, 0x7F,
+    0x08, 0x14, 0x00, 0x7F, 0x00, 0x00, 0xA0, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x01, 0x90, 0x00, 0x02, 0x21,
+    0x00, 0x00, 0xA0, 0x20, 0x20, 0x20, 0x00, 0xC0, 0x20, 0x91, 0x00, 0x20,
+    0x20, 0x40, 0x21, 0x04, 0x09, 0xA2, 0x21, 0x00, 0x16, 0x80, 0x28, 0x00,
+    0x90, 0x01, 0x40, 0x20, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x11, 0xBF,
+    0x00, 0x00, 0x64, 0x3F, 0x00, 0x00, 0x88, 0x7F, 0x00, 0x00, 0x28, 0x3F,
+    0x00, 0x08, 0x08, 0x3F, 0x20, 0x30, 0x08, 0x3F, 0x00, 0x40, 0x08, 0x3F,
+    0x88, 0x10, 0x08, 0x7F, 0x03, 0x02, 0x68, 0xBF, 0x28, 0x40, 0x05, 0xBF,
+    0x00, 0x0A, 0x00, 0x3F, 0x10, 0x00, 0x50, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x01, 0x5F, 0x00, 0x10, 0x3F, 0x00, 0x04, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x20, 0x1F, 0x02, 0x00, 0x1F, 0x40, 0x80, 0x5F,
+    0x0A, 0x05, 0x1F, 0x20, 0xA0, 0x1F, 0x0C, 0x01, 0x1F, 0x00, 0x08, 0x1F,
+    0x02, 0xA0, 0x1F, 0x10, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x20, 0x9F, 0x00, 0x60, 0x1F, 0x18, 0x01, 0x1F, 0x00, 0x00, 0x1F,
+    0x18, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x00, 0xE5, 0x00, 0x3F, 0x02, 0x00, 0x80, 0x3F, 0x08, 0x10, 0x00, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x24, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0C, 0x7F,
+    0x10, 0x00, 0x1B, 0x7F, 0x10, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x00, 0xA8, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x04, 0x80, 0x7F, 0x40, 0x20, 0x80, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x40, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x08, 0x00, 0x80, 0x7F, 0x10, 0x01, 0x01, 0xFF, 0x00, 0x60, 0x04, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x00, 0xA8, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x04, 0x80, 0x7F, 0x00, 0x20, 0x80, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x08, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x08, 0x00, 0x80, 0x7F, 0x40, 0x01, 0x01, 0xFF, 0x80, 0x60, 0x04, 0x7F,
+    0xC0, 0x10, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x00, 0xA8, 0x02, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x08, 0x04, 0x80, 0x7F, 0x10, 0x20, 0x80, 0x7F,
+    0x20, 0x00, 0x80, 0x7F, 0x48, 0x00, 0x80, 0x7F, 0x90, 0x00, 0x80, 0x7F,
+    0x20, 0x00, 0x80, 0x7F, 0x90, 0x01, 0x01, 0xFF, 0x48, 0x60, 0x04, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14,
+    0x00, 0x02, 0x80, 0x01, 0x50, 0x04, 0x00, 0x00, 0x20, 0x60, 0x09, 0x00,
+    0x80, 0x41, 0x00, 0x90, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0x02, 0x03, 0x80, 0xC0, 0x08, 0x80, 0x20, 0x00,
+    0x40, 0x80, 0x00,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x40, 0xA8, 0x02, 0x7F,
+    0x90, 0x00, 0x11, 0x7F, 0x00, 0x05, 0x01, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x00, 0xA8, 0x02, 0x7F,
+    0x18, 0x00, 0x11, 0x7F, 0x08, 0x05, 0x01, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x40, 0x80, 0x00, 0x7F, 0x10, 0x80, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x08, 0x01, 0x40, 0x7F, 0x10, 0xA8, 0x02, 0x7F,
+    0x28, 0x00, 0x11, 0x7F, 0x40, 0x05, 0x01, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14,
+    0x60, 0x02, 0x80, 0x01, 0x50, 0x04, 0x80, 0x00, 0x22, 0x20, 0x0A, 0x02,
+    0x00, 0x40, 0x00, 0x61, 0x00, 0x00, 0x81, 0x00, 0x00, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x60, 0x4F, 0x00, 0x22, 0x8F,
+    0x00, 0x10, 0x0F, 0x0A, 0x00, 0x8F, 0x00, 0x14, 0x4F, 0x00, 0xA0, 0x4F,
+    0x88, 0x20, 0x4F, 0x80, 0x20, 0x0F, 0x80, 0x20, 0x2F, 0xA0, 0x60, 0x2F,
+    0x00, 0x00, 0x0F, 0x10, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x14, 0x3F, 0x00, 0x81, 0x40, 0x3F, 0x00, 0xA8, 0x0B, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x61, 0x00, 0x3F, 0x10, 0x08, 0x60, 0x3F, 0x80, 0x00, 0x08, 0x3F,
+    0x90, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x30, 0x3F, 0x20, 0x00, 0x00, 0x7F,
+    0x49, 0x81, 0x40, 0x3F, 0x80, 0xA8, 0x06, 0x3F, 0x00, 0x00, 0xA0, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x60, 0x3F,
+    0x00, 0x06, 0x04, 0x3F, 0x00, 0x90, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x7F, 0x20, 0x40, 0x01, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x00, 0x3F, 0x22, 0x80, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x08, 0x40, 0x01, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x09, 0x00, 0x3F,
+    0x00, 0x80, 0x18, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD3 'Ó'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x60, 0x3F,
+    0x00, 0x06, 0x04, 0x3F, 0x00, 0x90, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x01, 0x3F, 0x18, 0x00, 0x00, 0x3F,
+    0x08, 0x80, 0x00, 0x3F, 0x22, 0x80, 0x02, 0x3F, 0x42, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x3F, 0x11, 0x00, 0x00, 0x3F, 0x20, 0x09, 0x00, 0x3F,
+    0x00, 0x80, 0x18, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD4 'Ô'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x60, 0x3F,
+    0x00, 0x06, 0x04, 0x3F, 0x00, 0x90, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x01, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x82, 0x80, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x08, 0x09, 0x00, 0x3F,
+    0x00, 0x80, 0x18, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD5 'Õ'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x60, 0x3F,
+    0x00, 0x06, 0x04, 0x3F, 0x00, 0x90, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x10, 0x40, 0x01, 0x7F, 0x08, 0x40, 0x01, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x80, 0x80, 0x00, 0x3F, 0x12, 0x80, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x20, 0x40, 0x01, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x40, 0x09, 0x00, 0x3F,
+    0x00, 0x80, 0x18, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x40, 0xC0, 0x7F,
+    0x00, 0x0C, 0x08, 0x7F, 0x01, 0x20, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x80, 0x02, 0xFF, 0x00, 0x80, 0x02, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0xE1, 0x00, 0x00, 0x7F, 0x05, 0x00, 0x04, 0x7F, 0x24, 0x00, 0x00, 0x7F,
+    0x90, 0x80, 0x02, 0x7F, 0x92, 0x00, 0x00, 0x7F, 0x20, 0x12, 0x00, 0x7F,
+    0x01, 0x00, 0x30, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x40, 0xDF, 0xA0, 0x1F, 0x50, 0x1F, 0x28, 0x1F, 0x10, 0x1F, 0x00, 0x1F,
+    0x04, 0x1F, 0x02, 0x1F, 0x00, 0x1F, 0x80, 0x1F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x43, 0x2F, 0x02, 0x00, 0x4F,
+    0x08, 0x18, 0x0F, 0x11, 0x84, 0x0F, 0x24, 0x08, 0x0F, 0x08, 0x10, 0x0F,
+    0x10, 0x00, 0x5F, 0x50, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x20, 0x20, 0x0F,
+    0xA0, 0x40, 0x8F, 0x80, 0x80, 0x0F, 0x15, 0x00, 0x4F, 0x42, 0x00, 0x0F,
+    0x02, 0x60, 0x0F, 0x20, 0x06, 0x0F, 0x40, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x01, 0x00, 0x34, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0xE8, 0x3F, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0xBF, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x19, 0x3F,
+    0x01, 0x01, 0x42, 0x3F, 0x00, 0xA8, 0x00, 0x3F, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDA 'Ú'
+    0x01, 0x00, 0x34, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0xE8, 0x3F, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x18, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x02, 0xBF, 0x20, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x19, 0x3F,
+    0x11, 0x01, 0x42, 0x3F, 0x10, 0xA8, 0x00, 0x3F, 0x20, 0x00, 0xC0, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDB 'Û'
+    0x01, 0x00, 0x34, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0xE8, 0x3F, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x19, 0x3F,
+    0x01, 0x01, 0x42, 0x3F, 0x00, 0xA8, 0x00, 0x3F, 0x08, 0x00, 0xC0, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDC 'Ü'
+    0x02, 0x00, 0x68, 0x7F, 0x00, 0x0A, 0x00, 0x7F, 0x00, 0x40, 0x01, 0x7F,
+    0x00, 0x01, 0xD0, 0x7F, 0x00, 0x28, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x20, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x32, 0x7F,
+    0x92, 0x02, 0x84, 0x7F, 0x91, 0x50, 0x00, 0x7F, 0x20, 0x01, 0x80, 0x7F,
+    0x00, 0x28, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x9F,
+    0x00, 0x50, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x11, 0x1F, 0x02, 0x85, 0x1F,
+    0x18, 0x05, 0x1F, 0x00, 0x04, 0x1F, 0x02, 0x00, 0x1F, 0x0A, 0x08, 0x1F,
+    0x00, 0x30, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x01, 0x40, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0x2F,
+    0x00, 0x00, 0x30, 0x0F, 0x00, 0x05, 0x01, 0x0F, 0x00, 0xA0, 0x14, 0x0F,
+    0x02, 0x00, 0x80, 0x0F, 0x00, 0x28, 0x20, 0x0F, 0x01, 0x00, 0x48, 0x0F,
+    0x48, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x0F, 0x20, 0x40, 0x04, 0x0F,
+    0x80, 0x00, 0x10, 0x0F, 0x81, 0x11, 0x00, 0x0F, 0x0C, 0x88, 0x40, 0x0F,
+    0x42, 0x00, 0x00, 0x0F, 0x24, 0x01, 0x40, 0x0F,
+    // 0xE0 'à'
+    0x00, 0x05, 0x13, 0x00, 0x10, 0x03, 0x00, 0x23, 0x47, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x40, 0x00, 0x2B, 0x90, 0x00, 0x03, 0x40, 0x00, 0x83,
+    0x25, 0x00, 0x73, 0x08, 0xA8, 0x07, 0x00, 0x01, 0x63, 0x01, 0x10, 0x03,
+    0x01, 0xC0, 0x13, 0x00, 0x00, 0x23,
+    // 0xE1 'á'
+    0x00, 0x02, 0x89, 0x00, 0x08, 0x01, 0x00, 0x11, 0xA3, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x41,
+    0x00, 0x80, 0x39, 0x20, 0x54, 0x03, 0x08, 0x00, 0xB1, 0x50, 0x88, 0x01,
+    0x00, 0xE0, 0x09, 0x00, 0x00, 0x11,
+    // 0xE2 'â'
+    0x00, 0x05, 0x13, 0x00, 0x10, 0x03, 0x00, 0x23, 0x47, 0x00, 0x40, 0x03,
+    0x08, 0x00, 0x03, 0x14, 0x00, 0x2B, 0x00, 0x00, 0x03, 0x40, 0x00, 0x83,
+    0xA1, 0x00, 0x73, 0x90, 0xA8, 0x07, 0x84, 0x01, 0x63, 0x01, 0x10, 0x03,
+    0x01, 0xC0, 0x13, 0x00, 0x00, 0x23,
+    // 0xE3 'ã'
+    0x00, 0x05, 0x13, 0x00, 0x10, 0x03, 0x00, 0x23, 0x47, 0x00, 0x40, 0x03,
+    0x10, 0x00, 0x03, 0x48, 0x00, 0x2B, 0x40, 0x00, 0x03, 0x10, 0x00, 0x83,
+    0x49, 0x00, 0x73, 0x00, 0xA8, 0x07, 0x28, 0x01, 0x63, 0x49, 0x10, 0x03,
+    0x41, 0xC0, 0x13, 0x00, 0x00, 0x23,
+    // 0xE4 'ä'
+    0x00, 0x0A, 0x27, 0x00, 0x20, 0x07, 0x00, 0x46, 0x8F, 0x00, 0x80, 0x07,
+    0x10, 0x00, 0x07, 0x10, 0x00, 0x57, 0x80, 0x00, 0x07, 0x00, 0x01, 0x07,
+    0x02, 0x00, 0xE7, 0x21, 0x50, 0x0F, 0x10, 0x02, 0xC7, 0x92, 0x20, 0x07,
+    0x63, 0x80, 0x27, 0x00, 0x00, 0x47,
+    // 0xE5 'å'
+    0x00, 0x02, 0x89, 0x00, 0x08, 0x01, 0x00, 0x11, 0xA3, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x15, 0x40, 0x00, 0x01, 0x18, 0x00, 0x41,
+    0x80, 0x80, 0x39, 0x80, 0x54, 0x03, 0x02, 0x00, 0xB1, 0x10, 0x88, 0x01,
+    0x00, 0xE0, 0x09, 0x00, 0x00, 0x11,
+    // 0xE6 'æ'
+    0x00, 0x89, 0x0C, 0x01, 0x01, 0xA3, 0x20, 0x01, 0x00, 0x15, 0x00, 0x05,
+    0xA0, 0x49, 0x00, 0xA1, 0x06, 0x01, 0x18, 0x05, 0x43, 0x61, 0x48, 0x83,
+    0x42, 0x01, 0xA2, 0x01, 0x01, 0x15, 0x20, 0x01, 0x82, 0x09, 0x44, 0x11,
+    0x30, 0x01,
+    // 0xE7 'ç'
+    0x01, 0x18, 0x07, 0x00, 0x00, 0x0F, 0x01, 0xE1, 0x9F, 0x08, 0x13, 0x6F,
+    0x50, 0x01, 0x07, 0xA0, 0x00, 0x27, 0x00, 0x10, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x08, 0x07, 0x60, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x02, 0x33, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x20, 0xA4, 0x03, 0x90, 0x44, 0x03, 0x00, 0x0A, 0x2B, 0x24, 0x50, 0x2B,
+    0x04, 0x00, 0x43, 0x00, 0x00, 0x43, 0x00, 0x40, 0x03,
+    // 0xE9 'é'
+    0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x52, 0x01, 0x00, 0x22, 0x01, 0x0A, 0x05, 0x15, 0x00, 0x28, 0x15,
+    0x20, 0x00, 0x21, 0x08, 0x00, 0x21, 0x40, 0x20, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x02, 0x33, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x07,
+    0x04, 0xA4, 0x03, 0x00, 0x44, 0x03, 0x50, 0x0A, 0x2B, 0xA0, 0x50, 0x2B,
+    0x80, 0x00, 0x43, 0x84, 0x00, 0x43, 0x20, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0xEB 'ë'
+    0x00, 0x04, 0x67, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x50, 0x00, 0x0F,
+    0x11, 0x48, 0x07, 0x80, 0x88, 0x07, 0x00, 0x14, 0x57, 0x00, 0xA0, 0x57,
+    0x20, 0x00, 0x87, 0x10, 0x00, 0x87, 0x90, 0x80, 0x07, 0x60, 0x00, 0x07,
+    // 0xEC 'ì'
+    0x00, 0xC0, 0x2B, 0x00, 0x02, 0x03, 0xA1, 0x18, 0x03, 0x90, 0x00, 0xE3,
+    0x08, 0x08, 0x2B, 0x20, 0x20, 0x13, 0x04, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x60, 0x15, 0x00, 0x01, 0x01, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x71,
+    0x0A, 0x04, 0x15, 0x10, 0x10, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01,
+    // 0xEE 'î'
+    0x00, 0xC0, 0x2B, 0x08, 0x02, 0x03, 0x01, 0x18, 0x03, 0x28, 0x00, 0xE3,
+    0x10, 0x08, 0x2B, 0xA0, 0x20, 0x13, 0x80, 0x00, 0x03, 0x84, 0x00, 0x03,
+    0x34, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xEF 'ï'
+    0x01, 0x80, 0x57, 0x70, 0x04, 0x07, 0x12, 0x30, 0x07, 0x80, 0x01, 0xC7,
+    0x20, 0x10, 0x57, 0x00, 0x40, 0x27, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x33, 0x00, 0x20, 0x0B, 0x00, 0x04, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x20, 0x17, 0x09, 0x00, 0x13, 0x20, 0x40, 0x03,
+    0x00, 0x40, 0x23, 0x01, 0x00, 0x93, 0x00, 0x88, 0x23, 0x68, 0x00, 0x03,
+    0x02, 0x03, 0x03, 0x00, 0x00, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0xC0, 0x13, 0x00, 0x00, 0x83, 0x01, 0x28, 0x0B, 0x00, 0x00, 0x23,
+    0x11, 0x13, 0x03, 0x48, 0x24, 0x03, 0x00, 0x50, 0x03, 0x10, 0xA0, 0x03,
+    0x08, 0x00, 0x0B, 0x01, 0x41, 0x03, 0x08, 0x30, 0x03, 0x48, 0x00, 0xA3,
+    0x40, 0x68, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x02, 0x23, 0x00, 0x10, 0x0B, 0x00, 0x03, 0x43, 0x00, 0x08, 0x03,
+    0x00, 0xA0, 0x17, 0x40, 0x00, 0x13, 0x90, 0x00, 0x03, 0x40, 0x40, 0x03,
+    0x24, 0x40, 0x83, 0x09, 0x02, 0x03, 0x00, 0x80, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xF3 'ó'
+    0x00, 0x01, 0x11, 0x00, 0x08, 0x05, 0x00, 0x01, 0xA1, 0x00, 0x04, 0x01,
+    0x00, 0x50, 0x0B, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x0E, 0x20, 0x01,
+    0x00, 0x20, 0x41, 0x20, 0x81, 0x01, 0x08, 0x40, 0x01, 0x50, 0x01, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xF4 'ô'
+    0x00, 0x02, 0x23, 0x00, 0x10, 0x0B, 0x00, 0x03, 0x43, 0x00, 0x08, 0x03,
+    0x08, 0xA0, 0x17, 0x14, 0x00, 0x13, 0x00, 0x00, 0x03, 0x40, 0x40, 0x03,
+    0xA0, 0x40, 0x83, 0x91, 0x02, 0x03, 0x8C, 0x80, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xF5 'õ'
+    0x00, 0x02, 0x23, 0x00, 0x10, 0x0B, 0x00, 0x03, 0x43, 0x00, 0x08, 0x03,
+    0x10, 0xA0, 0x17, 0x08, 0x00, 0x13, 0x40, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x48, 0x40, 0x83, 0x01, 0x02, 0x03, 0x28, 0x80, 0x03, 0x48, 0x02, 0x03,
+    0x50, 0x00, 0x03,
+    // 0xF6 'ö'
+    0x00, 0x04, 0x47, 0x00, 0x20, 0x17, 0x00, 0x06, 0x87, 0x00, 0x10, 0x07,
+    0x01, 0x40, 0x2F, 0x10, 0x00, 0x27, 0x80, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x81, 0x07, 0x22, 0x04, 0x07, 0x11, 0x00, 0x07, 0x90, 0x04, 0x07,
+    0x60, 0x00, 0x07,
+    // 0xF7 '÷'
+    0x06, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x17, 0x14, 0x07,
+    0x14, 0x07, 0x44, 0x77, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x08, 0x05, 0x01, 0x81, 0x04, 0x21,
+    0x51, 0x0B, 0x02, 0x89, 0x01, 0x01, 0x20, 0x01, 0x28, 0x41, 0x85, 0x01,
+    0x40, 0x21, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01,
+    // 0xF9 'ù'
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x8B, 0x01, 0x18, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x03, 0x00, 0x40, 0x0B, 0x80, 0x00, 0x23, 0x40, 0x00, 0x53,
+    0x04, 0x00, 0x43, 0x08, 0x00, 0x0B, 0x00, 0xA0, 0x07, 0x00, 0x03, 0x03,
+    0x01, 0x30, 0x2B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0xFA 'ú'
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x45, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x01, 0x00, 0x20, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x29,
+    0x10, 0x00, 0x21, 0x04, 0x00, 0x05, 0x48, 0x50, 0x03, 0x50, 0x01, 0x81,
+    0x00, 0x98, 0x15, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0xFB 'û'
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x8B, 0x01, 0x18, 0x03, 0x00, 0x00, 0x07,
+    0x04, 0x08, 0x03, 0x14, 0x40, 0x0B, 0x20, 0x00, 0x23, 0x00, 0x00, 0x53,
+    0x00, 0x00, 0x43, 0x90, 0x00, 0x0B, 0x08, 0xA0, 0x07, 0x20, 0x03, 0x03,
+    0x09, 0x30, 0x2B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0xFC 'ü'
+    0x00, 0x80, 0x07, 0x00, 0x01, 0x17, 0x02, 0x30, 0x07, 0x00, 0x00, 0x0F,
+    0x20, 0x10, 0x07, 0x10, 0x80, 0x17, 0x90, 0x00, 0x47, 0x60, 0x00, 0xA7,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x17, 0x51, 0x40, 0x0F, 0x90, 0x06, 0x07,
+    0x02, 0x60, 0x57, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x05, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x60, 0x0A, 0x02, 0x9F, 0x40, 0xA0, 0x00, 0x5F,
+    0x14, 0x00, 0x00, 0x1F, 0x00, 0xA0, 0x10, 0x1F, 0x06, 0x50, 0x10, 0x1F,
+    0x60, 0xA0, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x80, 0x1F,
+    0x00, 0x1C, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x38, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x00, 0x60, 0x02, 0x9F, 0x52, 0x0A, 0x09, 0x1F, 0x91, 0x80, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x48, 0x1F, 0x00, 0x00, 0xA0, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x12, 0x69, 0x00, 0x1F, 0x90, 0x06, 0x00, 0x1F,
+    0x02, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0xC0, 0x7F,
+    0x00, 0x32, 0x00, 0x7F, 0x00, 0x44, 0x20, 0x7F, 0x00, 0x14, 0x00, 0x7F,
+    0x04, 0x04, 0x00, 0x7F, 0x18, 0x04, 0x00, 0x7F, 0x20, 0x04, 0x00, 0x7F,
+    0x08, 0x04, 0x20, 0x7F, 0x81, 0x34, 0x46, 0x7F, 0x20, 0x02, 0xC8, 0x7F,
+    0x05, 0x00, 0x14, 0xFF, 0x00, 0x28, 0x08, 0x7F, 0x00, 0x01, 0x12, 0xFF,
+    0x00, 0x00, 0x42, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    // 0x105 'ą'
+    0x02, 0x88, 0x0F, 0x08, 0x00, 0x0F, 0x11, 0xA2, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x4F,
+    0x80, 0x39, 0x0F, 0x54, 0x00, 0x9F, 0x00, 0xB2, 0x4F, 0x88, 0x00, 0x0F,
+    0xE0, 0x08, 0x2F, 0x00, 0x10, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x03, 0x94, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x20, 0x40, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x0A, 0x00, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F,
+    // 0x107 'ć'
+    0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE1, 0x00, 0x08, 0x13,
+    0x00, 0x50, 0x01, 0x00, 0xA0, 0x01, 0x0A, 0x00, 0x11, 0x00, 0x20, 0x01,
+    0x20, 0x00, 0x09, 0x08, 0x60, 0x01, 0x40, 0x00, 0x01,
+    // 0x10C 'Č'
+    0x00, 0x01, 0xCA, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x10, 0x20, 0x1F,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x48, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x3F, 0x10, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x21, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x15, 0x00, 0x00, 0x1F,
+    0x28, 0x00, 0x02, 0x9F, 0x10, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE1, 0x00, 0x08, 0x13,
+    0x40, 0x50, 0x01, 0x40, 0xA0, 0x01, 0x12, 0x00, 0x11, 0x02, 0x20, 0x01,
+    0x00, 0x00, 0x09, 0x08, 0x60, 0x01, 0x10, 0x00, 0x01, 0x60, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x05, 0x1F, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0x14, 0x01, 0x1F,
+    0x00, 0x00, 0x28, 0x9F, 0x00, 0x02, 0x00, 0x9F, 0x01, 0x10, 0x00, 0x9F,
+    0x09, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x5F, 0x11, 0x40, 0x00, 0x5F,
+    0x10, 0x00, 0x00, 0x1F, 0x04, 0x20, 0x02, 0x1F, 0x08, 0x00, 0x08, 0x1F,
+    0x50, 0x00, 0x30, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x05, 0xA0, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x44, 0x00, 0x02, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x08, 0x40, 0x1C, 0x10, 0x2A, 0x01, 0x01, 0x40, 0x58, 0x00, 0x06, 0x00,
+    0x00, 0xA0, 0x04, 0x1A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x82, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x02, 0x80, 0x7F, 0x00, 0x50, 0x00, 0x7F, 0x2A, 0x00, 0x80, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x01, 0x20, 0x00, 0x7F, 0x08, 0x20, 0x06, 0x7F,
+    0x00, 0x20, 0x08, 0x7F, 0x00, 0x20, 0x10, 0xFF, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x20, 0x12, 0xFF, 0x00, 0x40, 0x62, 0x7F, 0x18, 0x01, 0x00, 0x7F,
+    0x04, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    // 0x119 'ę'
+    0x01, 0x18, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x4F,
+    0x52, 0x00, 0x1F, 0x22, 0x00, 0x8F, 0x05, 0x12, 0x5F, 0x28, 0x14, 0x2F,
+    0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x20, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0xA0, 0x3F, 0x00, 0x54, 0x01, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x02, 0x40, 0x3F, 0x00, 0x10, 0x40, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x20, 0x00, 0x40, 0x3F, 0x10, 0x00, 0x40, 0x3F,
+    0x14, 0x00, 0x40, 0x3F, 0x28, 0x00, 0x80, 0xFF, 0x10, 0x30, 0x02, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    // 0x11B 'ě'
+    0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x40, 0x52, 0x01, 0x40, 0x22, 0x01, 0x12, 0x05, 0x15, 0x02, 0x28, 0x15,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x21, 0x10, 0x20, 0x01, 0x60, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x01, 0x40, 0x7F, 0x00, 0xA8, 0x02, 0x7F,
+    0x18, 0x00, 0x10, 0x7F, 0x08, 0x05, 0x00, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x40, 0x80, 0x00, 0x7F, 0x10, 0x80, 0x00, 0x7F, 0x11, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x18, 0x1F, 0x09, 0x02, 0x80, 0x0F,
+    0x10, 0x28, 0x0A, 0xAF, 0x28, 0x00, 0xC0, 0x0F, 0x20, 0x14, 0x00, 0x0F,
+    0x48, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x70, 0x00, 0x00, 0x0F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0xA7,
+    0x00, 0x14, 0x07, 0x0A, 0x80, 0x27, 0x00, 0x01, 0x07, 0x00, 0x50, 0x07,
+    0x02, 0x00, 0x07, 0x08, 0x00, 0x07, 0x08, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x06, 0x00, 0x47, 0x22, 0x00, 0x87, 0x0C, 0x00, 0x67, 0x40, 0x00, 0x07,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x14, 0x00, 0x01, 0x81, 0x10, 0x28, 0x00, 0x02, 0x80, 0xAA,
+    0x00, 0x0C, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x00, 0x00, 0x84, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x10, 0x5F, 0x00, 0x20, 0x5F, 0x00, 0x22, 0x9F,
+    0x00, 0x40, 0x1F, 0x2A, 0x00, 0x9F, 0x00, 0x04, 0x1F, 0x01, 0x00, 0x1F,
+    0x08, 0x40, 0x1F, 0x20, 0x00, 0x1F, 0x20, 0x80, 0x1F, 0x40, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x01, 0x9F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x04, 0x53, 0x00, 0x02, 0x07,
+    0x40, 0xA0, 0x03, 0x0A, 0x02, 0xAB, 0x00, 0x00, 0x03, 0x05, 0x20, 0x03,
+    0x10, 0x80, 0x03, 0x00, 0xC0, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x14, 0x3F, 0x00, 0x81, 0x40, 0x3F, 0x00, 0xA8, 0x0B, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x61, 0x00, 0x3F, 0x08, 0x08, 0x60, 0x3F, 0x10, 0x00, 0x08, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x30, 0x3F, 0x40, 0x00, 0x00, 0x7F,
+    0x81, 0x81, 0x40, 0x3F, 0x20, 0xA8, 0x06, 0x3F, 0x00, 0x00, 0xA0, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x144 'ń'
+    0x00, 0x60, 0x09, 0x00, 0x00, 0x41, 0x00, 0x94, 0x05, 0x00, 0x00, 0x11,
+    0x00, 0x89, 0x81, 0x00, 0x12, 0x01, 0x00, 0x28, 0x01, 0x0A, 0x50, 0x01,
+    0x00, 0x00, 0x05, 0x20, 0xA0, 0x81, 0x08, 0x18, 0x01, 0x50, 0x00, 0x51,
+    0x00, 0x34, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x0A, 0x1F, 0x00, 0x40, 0xA0, 0x1F, 0x00, 0x54, 0x05, 0x9F,
+    0x00, 0x00, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x50, 0x30, 0x80, 0x1F, 0x48, 0x04, 0x30, 0x1F, 0x04, 0x00, 0x04, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0xC0, 0xA0, 0x1F, 0x00, 0x54, 0x03, 0x1F, 0x60, 0x00, 0x50, 0x1F,
+    0x00, 0x0A, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x60, 0x09, 0x00, 0x00, 0x41, 0x00, 0x94, 0x05, 0x00, 0x00, 0x11,
+    0x00, 0x89, 0x81, 0x00, 0x12, 0x01, 0x40, 0x28, 0x01, 0x12, 0x50, 0x01,
+    0x02, 0x00, 0x05, 0x00, 0xA0, 0x81, 0x00, 0x18, 0x01, 0x10, 0x00, 0x51,
+    0x20, 0x34, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x00, 0xC3, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x11, 0x83, 0x0F,
+    0x00, 0x00, 0x8F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x5F, 0x00, 0x00, 0x5F,
+    0x10, 0x00, 0x5F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F, 0x00, 0x28, 0x0F,
+    0x05, 0x00, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x00, 0x0F, 0x14, 0x20, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x21, 0x0F,
+    0x00, 0x02, 0x0F, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x01, 0x11, 0x08, 0x05, 0x01, 0xA1, 0x04, 0x01, 0x50, 0x0B, 0x00, 0x09,
+    0x00, 0x01, 0x20, 0x01, 0x20, 0x49, 0x81, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x03, 0x50, 0x01, 0x22, 0x01, 0x05, 0x15, 0x28, 0x11, 0x00, 0x21,
+    0x00, 0x21, 0x20, 0x01,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x05, 0x1F, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0x54, 0x01, 0x1F,
+    0x60, 0x00, 0x08, 0x9F, 0x00, 0x05, 0x80, 0x5F, 0x45, 0x40, 0xB0, 0x1F,
+    0x11, 0x00, 0x0C, 0x1F, 0x01, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x82, 0x5F, 0x20, 0x41, 0x01, 0x1F,
+    0x40, 0x24, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    // 0x159 'ř'
+    0x00, 0x20, 0x0B, 0x00, 0x00, 0xA3, 0x00, 0x88, 0x03, 0x00, 0x00, 0x13,
+    0x48, 0x0C, 0x83, 0x44, 0x10, 0x03, 0x12, 0x28, 0x03, 0x12, 0x10, 0x03,
+    0x24, 0x10, 0x03, 0x40, 0x10, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1C, 0x10, 0xBF,
+    0x00, 0x82, 0x02, 0x3F, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x08, 0x81, 0x7F,
+    0x08, 0x00, 0x01, 0x3F, 0x12, 0x00, 0x00, 0x3F, 0x22, 0x00, 0x02, 0xBF,
+    0x0A, 0x80, 0x08, 0x3F, 0x40, 0x70, 0x81, 0x3F, 0x80, 0x00, 0x60, 0x3F,
+    0x20, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x25, 0x00, 0x18, 0x11, 0x00, 0x00, 0x03,
+    0x00, 0x49, 0x0B, 0x00, 0x04, 0x09, 0x0E, 0x20, 0x15, 0x00, 0x00, 0x01,
+    0x24, 0x00, 0x11, 0x08, 0x10, 0x01, 0x50, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x0E, 0x08, 0x5F,
+    0x00, 0x41, 0x01, 0x1F, 0x00, 0x00, 0x80, 0xBF, 0x50, 0x84, 0x40, 0xBF,
+    0x48, 0x00, 0x00, 0x9F, 0x05, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x01, 0x5F,
+    0x01, 0x40, 0x04, 0x1F, 0x00, 0x38, 0x40, 0x9F, 0x40, 0x00, 0x30, 0x1F,
+    0x00, 0x18, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x161 'š'
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x25, 0x00, 0x18, 0x11, 0x00, 0x00, 0x03,
+    0x00, 0x49, 0x0B, 0x44, 0x04, 0x09, 0x32, 0x20, 0x15, 0x02, 0x00, 0x01,
+    0x04, 0x00, 0x11, 0x00, 0x10, 0x01, 0x50, 0x00, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0xB8, 0x00, 0x7F, 0x00, 0x08, 0x00, 0xBF, 0x00, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x50, 0x05, 0x00, 0x3F,
+    0x48, 0x20, 0x0A, 0xBF, 0x04, 0x01, 0x40, 0x3F, 0x10, 0x08, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x60, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x05, 0x0B, 0x00, 0x50, 0x03,
+    0x06, 0x01, 0x47, 0x00, 0x28, 0x03, 0x04, 0x00, 0x0B, 0x01, 0x00, 0x43,
+    0x09, 0x00, 0x13, 0x05, 0x40, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x80, 0x1A, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x5F,
+    0x00, 0x00, 0x74, 0x1F, 0x00, 0x0A, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0xB0, 0x00, 0x01, 0x5F, 0x02, 0x00, 0x00, 0x1F, 0x28, 0x00, 0x0C, 0x9F,
+    0x00, 0x80, 0xA1, 0x1F, 0x30, 0x54, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x1F,
+    0x00, 0x0A, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x45, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x01, 0x18, 0x20, 0x05, 0x02, 0x00, 0x11, 0x00, 0x00, 0x29,
+    0xA0, 0x00, 0x21, 0xA4, 0x00, 0x05, 0x02, 0x50, 0x03, 0x6C, 0x01, 0x81,
+    0x00, 0x98, 0x15, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x170 'Ű'
+    0x00, 0x80, 0x1A, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x10, 0x00, 0x5F,
+    0x00, 0x00, 0x74, 0x1F, 0x00, 0x0A, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x14, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x01, 0x5F, 0x08, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x0C, 0x9F,
+    0x00, 0x80, 0xA1, 0x1F, 0x14, 0x54, 0x00, 0x1F, 0x04, 0x00, 0x60, 0x1F,
+    0x20, 0x0A, 0x00, 0x1F, 0x08, 0x40, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    0x20, 0x80, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x45, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x03,
+    0x04, 0x04, 0x01, 0x08, 0x20, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x29,
+    0x40, 0x00, 0x21, 0x22, 0x00, 0x05, 0x10, 0x50, 0x03, 0x04, 0x01, 0x81,
+    0x48, 0x98, 0x15, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x178 'Ÿ'
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x90, 0x10, 0x00, 0x82, 0x00, 0x14,
+    0x80, 0x00, 0x82, 0x00, 0x09, 0x02, 0x00, 0x20, 0x00, 0x20, 0x08, 0x00,
+    0x00, 0x90, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0xB0, 0x10, 0x3F, 0x00, 0x10, 0x20, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x90, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x00, 0x40, 0x3F,
+    0x28, 0x08, 0x80, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x24, 0x02, 0x3F,
+    0x10, 0x40, 0x04, 0x3F, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x20, 0x04, 0x3F,
+    0x00, 0x80, 0x00, 0x3F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x05, 0x00, 0x28, 0x21, 0x00, 0x08, 0x49, 0x00, 0x80, 0x81,
+    0x00, 0x01, 0x31, 0x00, 0x80, 0x51, 0x06, 0x10, 0x11, 0x00, 0x18, 0x03,
+    0x24, 0x00, 0x03, 0x08, 0x48, 0x11, 0x50, 0x10, 0x01, 0x00, 0x00, 0x01,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0xB0, 0x10, 0x3F, 0x00, 0x10, 0x20, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x90, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x30, 0x00, 0x40, 0x3F,
+    0x48, 0x08, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x24, 0x02, 0x3F,
+    0x00, 0x40, 0x04, 0x3F, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x20, 0x04, 0x3F,
+    0x00, 0x80, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x17, 0x00, 0xA0, 0x87, 0x00, 0x21, 0x27, 0x02, 0x02, 0x07,
+    0x00, 0x04, 0xC7, 0x02, 0x01, 0x47, 0x40, 0x40, 0x47, 0x10, 0x60, 0x0F,
+    0x10, 0x00, 0x0F, 0x61, 0x20, 0x47, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x58, 0x08, 0x1F, 0x00, 0x08, 0x10, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x30, 0x00, 0x48, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x24, 0x00, 0x20, 0x1F,
+    0x00, 0x04, 0x40, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x24, 0x12, 0x01, 0x1F,
+    0x08, 0x20, 0x02, 0x1F, 0x10, 0x08, 0x00, 0x5F, 0x20, 0x10, 0x02, 0x1F,
+    0x00, 0x40, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x05, 0x00, 0x28, 0x21, 0x00, 0x08, 0x49, 0x00, 0x80, 0x81,
+    0x20, 0x01, 0x31, 0x44, 0x80, 0x51, 0x32, 0x10, 0x11, 0x02, 0x18, 0x03,
+    0x04, 0x00, 0x03, 0x00, 0x48, 0x11, 0x50, 0x10, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x3C0 'π'
+    0x00, 0x01, 0x20, 0x01, 0x10, 0x23, 0x10, 0xC1, 0x04, 0x01, 0x90, 0xC1,
+    0x82, 0x01, 0x80, 0x01, 0x81, 0x41, 0x84, 0x01, 0x81, 0x11, 0x90, 0x01,
+    0x80, 0x05, 0x80, 0x11, 0x00, 0x01, 0x80, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x04, 0x0F, 0x01, 0x40, 0x2F, 0x04, 0x05, 0x0F, 0x00, 0x50, 0x0F,
+    0x06, 0x03, 0x2F, 0x48, 0x00, 0x2F, 0x50, 0x00, 0x0F, 0x20, 0x40, 0x1F,
+    0x81, 0x00, 0x5F, 0xA2, 0x00, 0x4F, 0x00, 0x90, 0x0F, 0x18, 0x08, 0x8F,
+    0x00, 0x20, 0x0F, 0x28, 0x10, 0x8F, 0x10, 0x09, 0x0F,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x04, 0x7F, 0x10, 0x7F, 0x20, 0xFF, 0x47, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x02, 0x7F, 0x2D, 0x7F, 0x82, 0x7F, 0x00, 0x7F, 0x60, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x01, 0x7F, 0x60, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x18, 0x7F,
+    // 0x201B '‛'
+    0x70, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x201C '“'
+    0x04, 0x7F, 0x10, 0x7F, 0x20, 0xFF, 0x47, 0x7F, 0x00, 0x7F, 0x03, 0x7F,
+    0x08, 0x7F, 0x00, 0x7F, 0x08, 0x7F, 0x20, 0x7F, 0x40, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x01, 0x7F, 0x2C, 0x7F, 0x01, 0x7F, 0x00, 0x7F, 0x20, 0x7F,
+    0x00, 0xFF, 0x40, 0xFF, 0x01, 0x7F, 0x06, 0x7F, 0x58, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x01, 0x7F, 0x60, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x18, 0x7F,
+    0x00, 0xFF, 0x06, 0xFF, 0x00, 0x7F, 0x02, 0x7F, 0x40, 0x7F, 0x00, 0x7F,
+    // 0x201F '‟'
+    0x70, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x20, 0x7F, 0x00, 0x7F, 0x08, 0x7F,
+    0x00, 0x7F, 0x01, 0x7F, 0x46, 0x7F, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x02, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x00, 0x01, 0x3F, 0x05, 0x14, 0x3F,
+    0x00, 0x40, 0x3F, 0x30, 0x0A, 0x3F, 0x80, 0x80, 0x3F, 0xA5, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x01, 0x00, 0x3F, 0x02, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x01, 0x07, 0x02, 0x04, 0x07, 0x05, 0x00, 0x07, 0x00, 0x05, 0x8F,
+    0x05, 0x24, 0x0F, 0x00, 0x80, 0xC7, 0x30, 0x09, 0x07, 0x80, 0xE4, 0x07,
+    0xA5, 0x00, 0x07, 0x00, 0x05, 0x07, 0x01, 0x06, 0x07, 0x06, 0x00, 0x07,
+    // 0x2022 '•'
+    0x23, 0x47, 0x03, 0x07, 0x07, 0x33,
+    // 0x2026 '…'
+    0x07, 0x0F, 0x07, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x67, 0x0F, 0x87,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x17, 0x07,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x02, 0x1F, 0x01, 0x1F, 0x24, 0x9F, 0x01, 0x5F, 0x10, 0xDF,
+    0xA0, 0x1F, 0x40, 0x1F,
+    // 0x203A '›'
+    0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x90, 0x1F, 0x4C, 0x1F, 0x21, 0x1F,
+    0x12, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x05, 0x47, 0x00, 0x07, 0x21, 0xC7, 0x18, 0x2F, 0x00, 0x27, 0x80, 0x07,
+    0xA0, 0x07, 0x0C, 0x07, 0x00, 0x87, 0x16, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x0F, 0x14, 0x0F, 0x81, 0x47, 0xA8, 0x07, 0x00, 0x87,
+    // 0x2075 '⁵'
+    0x00, 0x17, 0x00, 0x07, 0x0C, 0x07, 0x20, 0x2F, 0x1A, 0x27, 0x22, 0x17,
+    0x24, 0x07, 0x20, 0x47, 0x20, 0x07, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x87, 0x00, 0x17, 0x00, 0xC7, 0x00, 0x27, 0x08, 0x07, 0x00, 0x2F,
+    0x01, 0x87, 0x84, 0x17, 0x83, 0x87, 0x80, 0x07, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x07, 0x21, 0x07, 0x24, 0x87, 0x29, 0x07,
+    0x24, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x87, 0x00, 0x07, 0x02, 0x6F, 0x00, 0x07, 0x00, 0x07, 0x81, 0x2F,
+    0x88, 0x57, 0x14, 0x07, 0x08, 0xC7, 0x00, 0x07,
+    // 0x2079 '⁹'
+    0x00, 0x07, 0x00, 0x0F, 0x0C, 0x07, 0x00, 0x27, 0x0C, 0x27, 0x82, 0x57,
+    0xA2, 0x87, 0x80, 0x27, 0x0C, 0x47, 0x00, 0x07, 0x08, 0x07,
+    // 0x2080 '₀'
+    0x05, 0x47, 0x10, 0x07, 0x21, 0xE7, 0x08, 0x0F, 0x00, 0x07, 0x80, 0x2F,
+    0xA0, 0x07, 0x0C, 0x07, 0x40, 0x87, 0x16, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x0F, 0x20, 0x0F, 0x40, 0x4F, 0x04, 0x0F, 0x00, 0x2F, 0x85, 0x0F,
+    0x20, 0x17,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x0F, 0x10, 0x4F, 0x00, 0x0F, 0x40, 0x0F, 0x01, 0x6F,
+    0x82, 0x2F, 0xA5, 0x2F, 0x02, 0x2F, 0x40, 0x17, 0x10, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x1F, 0x00, 0x0F, 0x22, 0x0F, 0x50, 0x07, 0x25, 0x0F, 0x81, 0x07,
+    0x98, 0x17, 0x01, 0x67, 0x18, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x00, 0x47, 0x00, 0x47, 0x01, 0x47, 0x00, 0x47, 0x00, 0x47,
+    0x00, 0x2F, 0x14, 0x0F, 0x01, 0x47, 0x28, 0x47, 0x00, 0x87,
+    // 0x2085 '₅'
+    0x00, 0x1F, 0x00, 0x0F, 0x0C, 0x0F, 0x20, 0x27, 0x1A, 0x27, 0x00, 0x17,
+    0x04, 0x07, 0x02, 0x47, 0x00, 0x07, 0x20, 0x07,
+    // 0x2086 '₆'
+    0x00, 0x87, 0x00, 0x17, 0x00, 0xCF, 0x02, 0x27, 0x08, 0x0F, 0x02, 0x27,
+    0x04, 0x87, 0x04, 0x17, 0x83, 0x87, 0x00, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x00, 0x07, 0x08, 0x0F, 0x00, 0x07, 0x21, 0x27, 0x24, 0x87, 0x21, 0x07,
+    0x34, 0x07, 0x00, 0x07, 0x10, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x87, 0x00, 0x07, 0x00, 0xE7, 0x00, 0x0F, 0x20, 0x07, 0x81, 0x2F,
+    0xA0, 0x47, 0x11, 0x07, 0x08, 0xC7, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x27, 0x4C, 0x2F, 0x02, 0x57,
+    0xA2, 0x97, 0xA2, 0x27, 0x0C, 0x47, 0x20, 0x07, 0x08, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x4A, 0x0F,
+    0x01, 0x00, 0x8F, 0x04, 0x00, 0x0F, 0x01, 0x00, 0x2F, 0x12, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x50, 0x28, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x00, 0xAF, 0x00, 0x00, 0xAF, 0x18, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x40, 0x7F, 0x00, 0xBF, 0x14, 0x3F, 0x02, 0xBF, 0x10, 0x3F, 0x00, 0x3F,
+    0x10, 0x7F, 0x20, 0xBF, 0x42, 0x3F, 0x14, 0xFF, 0x18, 0x3F, 0x60, 0x3F,
+    0x04, 0x3F, 0x1C, 0x7F, 0x68, 0xBF, 0x00, 0x3F, 0x1C, 0x3F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x10, 0x07, 0x20, 0x18, 0x07, 0x10, 0x28, 0x07, 0x55, 0x08, 0x07,
+    0x00, 0x28, 0x07, 0x05, 0x08, 0x47, 0x00, 0x00, 0x07, 0x00, 0x01, 0x27,
+    0x00, 0x04, 0x87, 0x00, 0x01, 0x07, 0x00, 0x14, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x80, 0x07, 0x08, 0x00, 0x27,
+    0x24, 0x00, 0x57, 0x48, 0xA0, 0x57, 0x80, 0x08, 0x17, 0x00, 0x48, 0x07,
+    0x01, 0x02, 0x87, 0x01, 0x20, 0x07, 0x01, 0x00, 0x87, 0x00, 0xE0, 0x07,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x07, 0x10, 0x08, 0x07, 0x00, 0x48, 0x07,
+    0x40, 0xA8, 0x07, 0x40, 0x08, 0x07, 0x02, 0x88, 0x07, 0x00, 0x08, 0x37,
+    0x40, 0x00, 0x87, 0x04, 0x10, 0x07, 0x10, 0x02, 0x47, 0x00, 0x09, 0x07,
+    0x00, 0x02, 0x07, 0x00, 0x28, 0x07, 0x00, 0x80, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x80, 0x07, 0x00, 0x00, 0x27, 0x12, 0x00, 0x57, 0x48, 0xA0, 0x57,
+    0x00, 0x08, 0x17, 0xA0, 0x48, 0x07, 0x01, 0x02, 0x87, 0x01, 0x20, 0x07,
+    0x01, 0x00, 0x87, 0x00, 0xE0, 0x07,
+    // 0x215B '⅛'
+    0x00, 0x10, 0x07, 0x20, 0x18, 0x07, 0x10, 0x28, 0x07, 0x55, 0x08, 0x07,
+    0x00, 0x28, 0x07, 0x05, 0x08, 0x57, 0x00, 0x00, 0x17, 0x00, 0x01, 0x27,
+    0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x10, 0x07, 0x01, 0x40, 0x07, 0x04, 0x00, 0x07, 0x09, 0x00, 0x87,
+    0x24, 0x00, 0x27, 0x00, 0x64, 0x87, 0x90, 0x08, 0x07, 0x40, 0x74, 0x57,
+    0x00, 0x00, 0x07, 0x01, 0x90, 0x27, 0x00, 0x08, 0x07, 0x00, 0x03, 0x07,
+    0x00, 0x80, 0x07,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x01, 0x10, 0x07, 0x43, 0x00, 0x07,
+    0x41, 0x20, 0x07, 0x20, 0xC0, 0x37, 0x10, 0x00, 0x07, 0x05, 0x00, 0x97,
+    0x18, 0x02, 0x47, 0x00, 0x00, 0x87, 0x00, 0x0A, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x04, 0x00, 0x07,
+    0x10, 0x00, 0x87, 0x24, 0x00, 0x27, 0x80, 0x64, 0x87, 0x00, 0x08, 0x07,
+    0x40, 0x74, 0x57, 0x00, 0x00, 0x07, 0x01, 0x90, 0x27, 0x00, 0x08, 0x07,
+    0x00, 0x03, 0x07, 0x00, 0x80, 0x07,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x0A, 0x10, 0x07, 0x60, 0x08, 0x07,
+    0x42, 0x00, 0x07, 0x41, 0x40, 0x37, 0x44, 0x10, 0x07, 0x40, 0x20, 0x17,
+    0x40, 0x02, 0x47, 0x60, 0x00, 0x87, 0x00, 0x02, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x40, 0x07, 0x05, 0x00, 0x07,
+    0x10, 0x00, 0x87, 0x24, 0x00, 0x27, 0x90, 0x64, 0x87, 0x00, 0x08, 0x07,
+    0x40, 0x74, 0x57, 0x00, 0x00, 0x07, 0x01, 0x90, 0x27, 0x00, 0x08, 0x07,
+    0x00, 0x03, 0x07, 0x00, 0x80, 0x07,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x07, 0x60, 0x38, 0x07, 0x40, 0x80, 0x07, 0x40, 0x30, 0x17,
+    0x40, 0x40, 0x07, 0x48, 0x00, 0x87, 0x40, 0x00, 0x07, 0x48, 0x04, 0x07,
+    0x40, 0x09, 0x07, 0x00, 0x04, 0x07, 0x00, 0x08, 0x07, 0x00, 0xA0, 0x07,
+    0x02, 0x00, 0x07, 0x04, 0x80, 0x07, 0x12, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x48, 0x00, 0x27, 0x20, 0x64, 0x87, 0x00, 0x08, 0x07, 0x00, 0x74, 0x57,
+    0x00, 0x00, 0x07, 0x01, 0x90, 0x27, 0x00, 0x08, 0x07, 0x00, 0x03, 0x07,
+    0x00, 0x80, 0x07,
+    // 0x2190 '←'
+    0x06, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x09, 0x4F, 0x12, 0x8F, 0x40, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x12, 0x8F,
+    0x09, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x00, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x40, 0x2F, 0x60, 0x6F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x60, 0x4F, 0x50, 0xAF,
+    0x20, 0x4F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x08, 0x3F, 0x08, 0x04, 0x3F,
+    0x50, 0x02, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x50, 0x02, 0xBF,
+    0x08, 0x04, 0x3F, 0x04, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x06, 0x0F, 0x09, 0x0F, 0x16, 0x8F, 0x20, 0x4F, 0x40, 0x0F, 0xA0, 0xDF,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x19, 0x8F,
+    // 0x21D1 '⇑'
+    0x04, 0x00, 0x08, 0x00, 0x14, 0x00, 0x27, 0xFF, 0x40, 0x01, 0xA0, 0x00,
+    0xA0, 0x00, 0x40, 0x01, 0x27, 0xFF, 0x14, 0x00, 0x08, 0x00, 0x04, 0x00,
+    // 0x21D2 '⇒'
+    0x19, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0xB0, 0xDF, 0x40, 0x0F,
+    0x20, 0x4F, 0x16, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x21D3 '⇓'
+    0x00, 0x20, 0x00, 0x10, 0x00, 0x28, 0xFF, 0xE4, 0x80, 0x02, 0x00, 0x05,
+    0x00, 0x05, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x28, 0x00, 0x10, 0x00, 0x20,
+    // 0x21D4 '⇔'
+    0x00, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x20, 0x4F, 0x50, 0xAF, 0x80, 0x1F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x1F, 0x50, 0xAF,
+    0x20, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x33, 0x00, 0x10, 0x0B, 0x20, 0x42, 0x43, 0x00, 0x10, 0x03,
+    0x40, 0x80, 0x13, 0x20, 0x00, 0x13, 0x21, 0x00, 0x2B, 0x01, 0x00, 0x4B,
+    0x10, 0x41, 0x93, 0x47, 0x14, 0x23, 0x00, 0x00, 0x03, 0x08, 0x06, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x01, 0x9F, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0xC0, 0x1F, 0x00, 0x18, 0x1F, 0x18, 0x00, 0x1F, 0x41, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x60, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x40, 0x1F, 0x00, 0x0C, 0x1F, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x3F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x40,
+    0x01, 0x00, 0x08, 0x10, 0x00, 0x28, 0x04, 0x44, 0x08, 0x02, 0x10, 0x08,
+    0x00, 0x82, 0x08, 0x00, 0x00, 0x08, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x42, 0x00, 0x00, 0x48,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x08, 0x18, 0x00, 0x02, 0x02, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x81, 0x00, 0x06, 0x0C, 0x00, 0x10, 0x60, 0x02, 0x01, 0x00,
+    0x18, 0x20, 0x00, 0x41, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x12, 0x7F, 0x01, 0x7F, 0x1C, 0xFF, 0xA0, 0x7F, 0x20, 0x7F, 0xA2, 0x7F,
+    0x54, 0x7F, 0x22, 0x7F, 0x02, 0x7F, 0x0D, 0x7F, 0x00, 0x7F, 0x80, 0x7F,
+    0x00, 0x7F, 0x90, 0xFF, 0x40, 0x7F, 0x14, 0x7F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x49, 0xFF, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    // 0x2260 '≠'
+    0x18, 0x8F, 0x00, 0x4F, 0x00, 0x2F, 0x00, 0x1F, 0x01, 0x0F, 0x04, 0x4F,
+    0x02, 0x4F, 0x20, 0x4F, 0x40, 0x4F, 0x40, 0x4F, 0x00, 0x4F, 0x01, 0x0F,
+    // 0x2264 '≤'
+    0x02, 0x03, 0x01, 0x00, 0x08, 0x00, 0x00, 0x80, 0x16, 0x00, 0x00, 0x00,
+    0x29, 0x00, 0x08, 0x80, 0x50, 0x80, 0x10, 0x40, 0x00, 0x40, 0x00, 0x20,
+    // 0x2265 '≥'
+    0x00, 0x03, 0x00, 0x10, 0x00, 0x10, 0x40, 0x10, 0x00, 0xA0, 0x20, 0x20,
+    0x11, 0x40, 0x11, 0x40, 0x0A, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint8_t Bookerly26ItalicBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x21 '!'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0xE0, 0x07, 0x18, 0x0C, 0x67,
+    0x40, 0x80, 0x07, 0x0C, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x22 '"'
+    0x00, 0x7F, 0x20, 0x7F, 0x06, 0x7F, 0xA0, 0x7F, 0x00, 0x7F, 0x0E, 0x7F,
+    0x01, 0x7F, 0x98, 0x7F, 0x00, 0x7F,
+    // 0x23 '#'
+    0x00, 0x10, 0x7F, 0x00, 0x20, 0x7F, 0x08, 0x20, 0x7F, 0x08, 0x2C, 0x7F,
+    0x08, 0xC3, 0x7F, 0x08, 0x00, 0x7F, 0x03, 0x20, 0x7F, 0xB8, 0x20, 0x7F,
+    0x08, 0x22, 0x7F, 0x08, 0x00, 0x7F, 0x0A, 0x08, 0x7F, 0x60, 0xA0, 0x7F,
+    0x88, 0x20, 0x7F, 0x08, 0x20, 0x7F, 0x08, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x00, 0x00, 0x48, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x0A, 0x49, 0x86, 0x3F, 0x04, 0x20, 0x50, 0x3F, 0x05, 0x80, 0x00, 0x3F,
+    0x10, 0x52, 0x28, 0x3F, 0x82, 0x01, 0xC0, 0x3F, 0xE0, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    // 0x25 '%'
+    0x00, 0x00, 0x07, 0x08, 0x20, 0x07, 0x00, 0x10, 0x07, 0x08, 0x00, 0x07,
+    0x40, 0x20, 0x37, 0x20, 0x10, 0x07, 0x20, 0x40, 0x27, 0x11, 0x22, 0x07,
+    0x00, 0x01, 0x07, 0x1E, 0x02, 0x07, 0x00, 0x20, 0x07, 0x00, 0x10, 0x07,
+    0x01, 0x00, 0x07, 0x02, 0x83, 0x87, 0x01, 0x10, 0x27, 0x10, 0x07, 0x87,
+    0x08, 0x50, 0x07, 0x90, 0x20, 0x07, 0x00, 0x80, 0x47, 0x00, 0x80, 0x27,
+    0x00, 0x1C, 0x47, 0x00, 0x41, 0x07, 0x00, 0x00, 0x07,
+    // 0x26 '&'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x20, 0x07, 0x00, 0x50, 0x27,
+    0x00, 0x20, 0x07, 0x03, 0x40, 0x07, 0x10, 0x10, 0x07, 0x00, 0x04, 0x07,
+    0x10, 0x22, 0x07, 0x82, 0x08, 0x27, 0x80, 0x00, 0x07, 0x8A, 0x20, 0x07,
+    0x80, 0x50, 0x27, 0x48, 0x04, 0x87, 0x00, 0x10, 0x17, 0x00, 0x08, 0x47,
+    0x00, 0x80, 0x07, 0x00, 0x00, 0x27, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x02, 0x80, 0x07,
+    // 0x27 '''
+    0x00, 0x7F, 0x20, 0x7F, 0x06, 0x7F, 0xA0, 0x7F, 0x00, 0x7F,
+    // 0x28 '('
+    0x00, 0x07, 0xC0, 0x1F, 0x00, 0x40, 0x08, 0x1F, 0x01, 0x0F, 0xC2, 0x1F,
+    0x00, 0x40, 0x08, 0x1F, 0x01, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x04, 0x1F, 0xA0, 0x00, 0x08, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x24, 0x00, 0x48, 0x1F, 0x11, 0xC6, 0x00, 0x1F,
+    0x04, 0x00, 0x40, 0x1F, 0x01, 0x86, 0x00, 0x1F,
+    // 0x2A '*'
+    0x00, 0x7F, 0x54, 0x7F, 0x40, 0x7F, 0x08, 0x7F, 0x67, 0x7F, 0x94, 0xFF,
+    0x51, 0x7F, 0x10, 0x7F, 0x18, 0x7F,
+    // 0x2B '+'
+    0x00, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x00, 0x1F,
+    0x00, 0x1F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x02, 0x0F,
+    // 0x2C ','
+    0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x30, 0x7F, 0x00, 0x7F, 0x08, 0x7F,
+    0x00, 0x7F,
+    // 0x2D '-'
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x5F,
+    // 0x2E '.'
+    0x07, 0x47, 0x07, 0x17, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x01, 0x27,
+    0x00, 0x04, 0x07, 0x00, 0x01, 0x07, 0x00, 0x24, 0x07, 0x00, 0x90, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x80, 0x07, 0x12, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x30 '0'
+    0x00, 0x00, 0x0F, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0x0F,
+    0x01, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    0x40, 0x00, 0xAF, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x4F, 0x10, 0x08, 0x8F,
+    0x44, 0xC1, 0x0F, 0x00, 0x04, 0x0F, 0x10, 0x10, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x31 '1'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F,
+    0x20, 0x06, 0x1F, 0x00, 0x40, 0x1F, 0x0C, 0x01, 0x9F, 0x40, 0x30, 0x5F,
+    0x06, 0x00, 0x5F, 0x60, 0x00, 0x1F,
+    // 0x32 '2'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x9F, 0x00, 0x01, 0x1F, 0x0C, 0x00, 0x1F,
+    0x00, 0x00, 0x9F, 0x20, 0x01, 0x9F, 0x00, 0x0A, 0x9F, 0x50, 0x10, 0x9F,
+    0x00, 0x20, 0x9F, 0x00, 0x40, 0x9F, 0x00, 0x90, 0x9F, 0x4A, 0x20, 0x9F,
+    0x00, 0x40, 0xDF, 0x20, 0x00, 0x1F, 0x0C, 0x00, 0x1F,
+    // 0x33 '3'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x08, 0x40, 0x0F, 0x00, 0x40, 0x8F, 0x40, 0x00, 0x2F,
+    0x00, 0x81, 0x0F, 0x00, 0x12, 0x4F, 0x10, 0x40, 0x0F, 0x4C, 0x80, 0x0F,
+    0x01, 0x16, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x34 '4'
+    0x00, 0x08, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x04, 0x3F,
+    0x00, 0x24, 0x3F, 0x00, 0x44, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x04, 0x3F,
+    0x10, 0x05, 0xBF, 0x20, 0x10, 0x3F, 0x41, 0x00, 0x7F, 0x10, 0x04, 0x3F,
+    0x01, 0x84, 0x3F, 0x18, 0x04, 0x3F, 0x00, 0x08, 0x3F,
+    // 0x35 '5'
+    0x00, 0x00, 0xDF, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x04, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x80, 0x01, 0x5F, 0xB0, 0x80, 0x1F, 0xA2, 0x00, 0x1F,
+    0xA0, 0x08, 0x1F, 0xA1, 0x01, 0x1F, 0xA0, 0x80, 0x1F, 0xA0, 0x30, 0x1F,
+    0xA0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    // 0x36 '6'
+    0x00, 0x04, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0x02, 0x31, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x40, 0x0F, 0x10, 0x40, 0x4F, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0xAF, 0x00, 0x00, 0x0F, 0x50, 0x80, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x1C, 0x0F, 0x20, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    // 0x37 '7'
+    0x00, 0x00, 0xDF, 0x44, 0x02, 0x1F, 0x88, 0x08, 0x1F, 0xA0, 0x00, 0x1F,
+    0xA0, 0x40, 0x1F, 0xA0, 0x80, 0x1F, 0xA0, 0x20, 0x1F, 0xA0, 0x00, 0x1F,
+    0xA9, 0x00, 0x1F, 0xB2, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x38 '8'
+    0x00, 0x03, 0x8F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x2F, 0x09, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x06, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x40, 0x80, 0x0F,
+    0x00, 0x80, 0xAF, 0x00, 0x45, 0x0F, 0x00, 0x20, 0x4F, 0x48, 0x90, 0x8F,
+    0x01, 0x00, 0x0F, 0x14, 0x00, 0x0F,
+    // 0x39 '9'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x08, 0x20, 0x4F,
+    0x10, 0x10, 0x0F, 0x26, 0x80, 0xAF, 0x40, 0x00, 0x0F, 0x40, 0x20, 0x4F,
+    0x00, 0x22, 0x0F, 0x00, 0x24, 0x0F, 0x00, 0x21, 0x0F, 0x48, 0x40, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x20, 0x0F, 0x07, 0x00, 0x0F,
+    // 0x3A ':'
+    0x00, 0x01, 0x00, 0x11, 0x00, 0x01, 0x00, 0x05, 0x08, 0x01, 0x00, 0x01,
+    0x00, 0x01,
+    // 0x3B ';'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x3C '<'
+    0x00, 0x0F, 0x00, 0x0F, 0x09, 0x0F, 0x00, 0x0F, 0x16, 0x8F, 0x00, 0x0F,
+    0x29, 0x4F, 0x00, 0x0F, 0x50, 0xAF, 0x00, 0x0F, 0x20, 0x5F, 0x00, 0x0F,
+    // 0x3D '='
+    0x01, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0xC5,
+    // 0x3E '>'
+    0x00, 0x0F, 0x20, 0x1F, 0x00, 0x5F, 0x50, 0x0F, 0x00, 0xAF, 0x28, 0x0F,
+    0x01, 0x4F, 0x14, 0x0F, 0x02, 0x8F, 0x00, 0x0F, 0x01, 0x0F, 0x02, 0x0F,
+    // 0x3F '?'
+    0x00, 0x00, 0x6F, 0x50, 0x20, 0x8F, 0x00, 0x40, 0x0F, 0x80, 0xA8, 0x0F,
+    0x81, 0x0C, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x22, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x40 '@'
+    0x00, 0x06, 0x01, 0x00, 0x40, 0x21, 0x01, 0x04, 0x01, 0x04, 0x40, 0x41,
+    0x09, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x20, 0x0B,
+    0x10, 0x80, 0x03, 0x40, 0x20, 0x03, 0x02, 0x80, 0x83, 0x21, 0x02, 0x03,
+    0x80, 0x04, 0x03, 0x81, 0x0A, 0x09, 0x82, 0xE0, 0x89, 0x82, 0x0E, 0x05,
+    0x80, 0x80, 0x19, 0xA0, 0x00, 0x81, 0x00, 0x00, 0x01, 0x50, 0x01, 0x01,
+    0x08, 0x12, 0x01, 0x00, 0x00, 0x01, 0x08, 0x30, 0x01, 0x00, 0x00, 0x01,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0xDF, 0x00, 0x12, 0x5F, 0x00, 0x40, 0x1F,
+    0x01, 0x10, 0x1F, 0x00, 0x50, 0x1F, 0x09, 0x10, 0x1F, 0x24, 0x10, 0x1F,
+    0x00, 0x10, 0x3F, 0x01, 0xD0, 0x1F, 0x60, 0x03, 0x5F, 0x03, 0x00, 0x1F,
+    0x00, 0x18, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x20, 0x01, 0x8F,
+    0x40, 0x30, 0x0F, 0x06, 0x00, 0x8F, 0x00, 0x18, 0x0F, 0x03, 0x80, 0x4F,
+    0x20, 0x80, 0x4F, 0x20, 0x00, 0x4F, 0x20, 0x20, 0x2F, 0x00, 0x80, 0x8F,
+    0x11, 0x12, 0x0F, 0x40, 0x80, 0x0F, 0x00, 0x21, 0x0F, 0x1C, 0x00, 0x0F,
+    // 0x43 'C'
+    0x00, 0x66, 0x0F, 0x02, 0x00, 0x8F, 0x00, 0x10, 0x0F, 0x11, 0x00, 0x2F,
+    0x04, 0x00, 0x0F, 0x08, 0x00, 0x8F, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x0F,
+    0x10, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x44, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x44 'D'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x20, 0x01, 0x8F,
+    0x40, 0x30, 0x0F, 0x06, 0x00, 0x8F, 0x00, 0x18, 0x4F, 0x01, 0x80, 0x4F,
+    0x10, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x20, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F, 0x40, 0x00, 0x0F, 0x04, 0x08, 0x0F,
+    0x20, 0x00, 0x0F, 0x10, 0x04, 0x0F, 0x06, 0xE0, 0x0F,
+    // 0x45 'E'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x08, 0x1F, 0x01, 0xA0, 0x1F,
+    0x10, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x21, 0x1F, 0x00, 0x00, 0x5F, 0x1C, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x1F,
+    // 0x46 'F'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x18, 0x5F, 0x01, 0x80, 0x5F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x18, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x60, 0x00, 0x1F,
+    // 0x47 'G'
+    0x00, 0x66, 0x0F, 0x02, 0x00, 0x8F, 0x00, 0x10, 0x4F, 0x11, 0x02, 0x0F,
+    0x04, 0x00, 0x0F, 0x08, 0x00, 0x8F, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x20, 0xAF,
+    0x00, 0x2C, 0x0F, 0x1C, 0x20, 0x0F, 0x40, 0x26, 0x0F, 0x18, 0x20, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x48 'H'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x08, 0x5F, 0x01, 0xA0, 0x3F,
+    0x10, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x20, 0x1F, 0x00, 0x20, 0x5F, 0x00, 0x21, 0x9F, 0x40, 0x10, 0x1F,
+    0x23, 0x00, 0x1F, 0x00, 0x0C, 0x5F, 0x01, 0x80, 0x7F, 0x18, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x49 'I'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x08, 0x5F, 0x01, 0x80, 0x3F,
+    0x10, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80,
+    0x20, 0x18, 0x08, 0x23, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0xC0, 0x00,
+    0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x4B 'K'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x8F,
+    0x20, 0x30, 0x0F, 0x26, 0x00, 0x8F, 0x00, 0x08, 0x4F, 0x01, 0xA0, 0x4F,
+    0x10, 0x00, 0x0F, 0x21, 0x04, 0x0F, 0x02, 0x80, 0x0F, 0x04, 0x08, 0x8F,
+    0x00, 0x04, 0x4F, 0x40, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x4F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4C 'L'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x08, 0x1F, 0x01, 0x80, 0x1F,
+    0x10, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x3F, 0x00, 0x05, 0x1F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F,
+    0x00, 0x06, 0x1F, 0x00, 0x20, 0x1F, 0x01, 0x04, 0x5F, 0x30, 0x20, 0x3F,
+    0x03, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x60, 0x1F, 0x70, 0x01, 0x1F,
+    0x00, 0xC0, 0x9F, 0x00, 0x09, 0x1F, 0x00, 0x24, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x04, 0x80, 0x1F, 0x12, 0x00, 0x5F, 0x40, 0x03, 0x9F,
+    0x0C, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x5F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x00, 0x30, 0x0F, 0x26, 0x03, 0x4F, 0x00, 0x60, 0x4F, 0x02, 0x00, 0x0F,
+    0x41, 0x00, 0x0F, 0x08, 0x40, 0x0F, 0x02, 0x10, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x20, 0x8F, 0x00, 0x04, 0x2F, 0x00, 0x02, 0x0F, 0x40, 0x30, 0x0F,
+    0x26, 0x01, 0x0F, 0x00, 0x30, 0x0F, 0x06, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4F 'O'
+    0x00, 0xC2, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x11, 0x01, 0x2F,
+    0x04, 0x00, 0x8F, 0x08, 0x00, 0x0F, 0x50, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0xAF, 0x00, 0x01, 0x0F,
+    0x00, 0x02, 0x0F, 0x48, 0x08, 0x8F, 0x03, 0xC1, 0x0F, 0x00, 0x04, 0x0F,
+    0x08, 0x10, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x50 'P'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x20, 0x01, 0x9F,
+    0x40, 0x30, 0x1F, 0x06, 0x00, 0x9F, 0x00, 0x08, 0x5F, 0x01, 0x80, 0x5F,
+    0x30, 0x00, 0x1F, 0x20, 0x10, 0x1F, 0x20, 0x10, 0x1F, 0x20, 0x00, 0x1F,
+    0x00, 0xA0, 0x1F, 0x4E, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x13, 0x00, 0x1F,
+    // 0x51 'Q'
+    0x00, 0xC2, 0x00, 0x7F, 0x02, 0x00, 0x80, 0x7F, 0x00, 0x38, 0x40, 0x7F,
+    0x11, 0x01, 0x20, 0x7F, 0x04, 0x00, 0x80, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x50, 0x00, 0x48, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x14, 0x7F,
+    0x20, 0x00, 0x20, 0x7F, 0x20, 0x00, 0x8A, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x02, 0x01, 0x7F, 0x48, 0x08, 0x04, 0x7F, 0x03, 0xC0, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0xFF, 0x08, 0x30, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x52 'R'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x20, 0x01, 0x8F,
+    0x40, 0x30, 0x0F, 0x26, 0x00, 0x8F, 0x00, 0x08, 0x4F, 0x03, 0x10, 0x6F,
+    0x30, 0x10, 0x0F, 0x20, 0x44, 0x0F, 0x20, 0x01, 0x0F, 0x00, 0xA0, 0x0F,
+    0x11, 0x02, 0x0F, 0x40, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x0C, 0x00, 0x4F,
+    0x00, 0x00, 0x2F,
+    // 0x53 'S'
+    0x00, 0x03, 0xCF, 0x00, 0x00, 0x0F, 0x0E, 0x03, 0x2F, 0x00, 0x80, 0x0F,
+    0x00, 0x40, 0x4F, 0x50, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x20, 0x90, 0x0F,
+    0x20, 0x08, 0xAF, 0x20, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x09, 0x0F,
+    0x48, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x54 'T'
+    0x3C, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x9F,
+    0x00, 0x08, 0x1F, 0x01, 0x80, 0x1F, 0x10, 0x06, 0x5F, 0x00, 0xC0, 0x5F,
+    0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x55 'U'
+    0x00, 0x02, 0x0F, 0x20, 0xC0, 0x4F, 0x18, 0x00, 0x0F, 0x00, 0x21, 0x0F,
+    0x06, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0xAF, 0x00, 0x01, 0x0F, 0x00, 0x02, 0x0F,
+    0x60, 0x30, 0x0F, 0x26, 0x02, 0x0F, 0x00, 0x20, 0x0F, 0x06, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x56 'V'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0x80, 0x0F,
+    0x00, 0x0E, 0x0F, 0x1C, 0x00, 0x0F, 0x20, 0x1C, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x11, 0x0F, 0x00, 0x44, 0x0F, 0x01, 0x10, 0x0F,
+    0x20, 0x40, 0x0F, 0x20, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x57 'W'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x6F,
+    0x00, 0x00, 0x0F, 0x20, 0x01, 0x0F, 0x20, 0x00, 0x4F, 0x40, 0x11, 0x0F,
+    0x00, 0x44, 0x0F, 0x01, 0x10, 0x0F, 0x04, 0x40, 0x0F, 0x11, 0x00, 0x0F,
+    0x41, 0x80, 0x0F, 0x40, 0x01, 0xEF, 0x1F, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x02, 0x4F, 0x00, 0x01, 0x0F, 0x00, 0x44, 0x0F, 0x41, 0x10, 0x0F,
+    0x24, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0xDF, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x1F,
+    0x01, 0x20, 0x1F, 0x20, 0x10, 0x1F, 0x01, 0x10, 0x1F, 0x00, 0x04, 0x1F,
+    0x02, 0x21, 0x5F, 0x04, 0x08, 0x1F, 0x22, 0x02, 0x1F, 0x04, 0x00, 0x9F,
+    0x08, 0x00, 0x5F, 0x10, 0x00, 0x5F, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x00, 0x00, 0x1F, 0x20, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x04, 0x00, 0x5F,
+    0x00, 0x80, 0x1F, 0x08, 0x26, 0x1F, 0x21, 0x00, 0x1F, 0x40, 0x43, 0x1F,
+    0x00, 0x90, 0x5F, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x29, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x10, 0x12, 0x0F, 0x00, 0x24, 0x0F, 0x00, 0x48, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x09, 0x00, 0x0F,
+    0x12, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x02, 0x0F, 0x60, 0x00, 0x0F,
+    // 0x5B '['
+    0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x03, 0x03, 0x3F,
+    0x00, 0x30, 0x31, 0x3F, 0x02, 0x02, 0x00, 0xBF, 0x60, 0x60, 0x00, 0x3F,
+    0x86, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F,
+    // 0x5C '\'
+    0x00, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x88, 0x00, 0x07, 0x21, 0x00, 0x07,
+    0x04, 0x20, 0x07, 0x01, 0x08, 0x07, 0x00, 0x21, 0x07, 0x00, 0x04, 0x27,
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x01, 0x80, 0xBF, 0x40, 0x18, 0x18, 0x3F,
+    0x81, 0x01, 0x80, 0x3F, 0xB0, 0x30, 0x00, 0x3F, 0x83, 0x00, 0x00, 0x3F,
+    0xB0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x17, 0x00, 0x47, 0x02, 0x17, 0x08, 0x47, 0x42, 0x07, 0x88, 0x07,
+    0x90, 0x07, 0x42, 0x07, 0x10, 0x87, 0x02, 0x17, 0x00, 0x87, 0x00, 0x17,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x60 '`'
+    0x03, 0x83, 0x83, 0x03, 0x17, 0x03,
+    // 0x61 'a'
+    0x01, 0x89, 0x00, 0x01, 0x11, 0xE1, 0x24, 0x01, 0x40, 0x01, 0x00, 0x11,
+    0xA0, 0x29, 0xA0, 0x51, 0x01, 0x3D, 0x5C, 0x01, 0x40, 0xC1, 0x0C, 0x15,
+    0x40, 0x29, 0x00, 0x01,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x20, 0x02, 0x03, 0x40, 0x60, 0x0B,
+    0x04, 0x01, 0x03, 0x00, 0x64, 0x13, 0x04, 0x10, 0x13, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x2B, 0x00, 0x40, 0x43, 0x01, 0x23, 0x03, 0x00, 0x00, 0x43,
+    0x00, 0x81, 0x03, 0x00, 0x00, 0x03,
+    // 0x63 'c'
+    0x03, 0x11, 0x08, 0x05, 0x01, 0xE1, 0x08, 0x01, 0x40, 0x01, 0x20, 0x01,
+    0xA0, 0x05, 0xA0, 0x01, 0x80, 0x21, 0x60, 0x01,
+    // 0x64 'd'
+    0x00, 0x03, 0x13, 0x00, 0x08, 0x03, 0x00, 0x23, 0xC3, 0x00, 0x48, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0x23, 0x01, 0x40, 0x53, 0x01, 0x40, 0xA3,
+    0x00, 0x02, 0x7B, 0x40, 0xB8, 0x03, 0x03, 0x01, 0x83, 0x00, 0x10, 0x2B,
+    0x03, 0x00, 0x53, 0x70, 0x00, 0x03,
+    // 0x65 'e'
+    0x03, 0x11, 0x08, 0x05, 0x00, 0x61, 0x08, 0x01, 0x40, 0x81, 0x02, 0x01,
+    0x81, 0x05, 0x80, 0x11, 0x82, 0x09, 0x04, 0x11, 0x10, 0x01,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x02, 0x1F, 0x01, 0x80, 0x60, 0x1F, 0x00, 0x86, 0x02, 0x1F,
+    0x00, 0xC0, 0x30, 0x1F, 0x0C, 0x06, 0x00, 0x1F, 0x20, 0x40, 0x00, 0x1F,
+    0x4E, 0x80, 0x00, 0x1F, 0x20, 0x80, 0x00, 0x1F, 0x80, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x67 'g'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x05, 0x17,
+    0x00, 0x02, 0x07, 0x10, 0x18, 0x07, 0x20, 0x04, 0x07, 0x41, 0x24, 0x07,
+    0x00, 0x10, 0x07, 0x00, 0x02, 0x17, 0x80, 0x08, 0x57, 0xA0, 0x00, 0x87,
+    0x81, 0x00, 0x07, 0x02, 0x03, 0x87, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x68 'h'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x20, 0x06, 0x03, 0x40, 0x40, 0x33,
+    0x0C, 0x01, 0x03, 0x00, 0x50, 0x03, 0x04, 0x28, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x00, 0xC3, 0x01, 0x4C, 0x03, 0x01, 0x00, 0xE3,
+    0x00, 0x04, 0x2B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x23,
+    // 0x69 'i'
+    0x00, 0x00, 0x27, 0x00, 0x82, 0x07, 0x00, 0x90, 0x07, 0x02, 0x01, 0x07,
+    0x12, 0x18, 0x47, 0x11, 0x80, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x02, 0x1F,
+    0x01, 0x00, 0x10, 0x1F, 0x00, 0x81, 0x82, 0x1F, 0x00, 0x98, 0x18, 0x1F,
+    0x02, 0x00, 0x80, 0x1F, 0x92, 0x18, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x6B 'k'
+    0x00, 0x00, 0x1B, 0x00, 0x01, 0x83, 0x40, 0x30, 0x0B, 0x03, 0x00, 0x83,
+    0x00, 0x08, 0x03, 0x03, 0x40, 0x43, 0x70, 0x85, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x0A, 0x03, 0x01, 0x54, 0x03, 0x01, 0x00, 0x03, 0x00, 0x90, 0x13,
+    0x00, 0x00, 0x03,
+    // 0x6C 'l'
+    0x00, 0x00, 0x3B, 0x20, 0x02, 0x03, 0x40, 0x60, 0x03, 0x06, 0x03, 0x0B,
+    0x00, 0x20, 0x03, 0x06, 0x00, 0x43, 0x60, 0x00, 0x03,
+    // 0x6D 'm'
+    0x40, 0x05, 0x20, 0xC1, 0x2C, 0x05, 0x80, 0x21, 0x09, 0x01, 0x00, 0x01,
+    0x08, 0x01, 0x10, 0x01, 0x00, 0x31, 0x23, 0x01, 0x80, 0x11, 0x00, 0x81,
+    0x0A, 0x01, 0x14, 0x01, 0x20, 0x01, 0x40, 0x09, 0x20, 0xC1, 0x9C, 0x01,
+    0x80, 0xC1, 0x4C, 0x11, 0x00, 0x21, 0x00, 0x01,
+    // 0x6E 'n'
+    0x40, 0x05, 0x20, 0xC1, 0x2C, 0x05, 0x80, 0x21, 0x09, 0x01, 0x00, 0x01,
+    0x08, 0x01, 0x10, 0x01, 0x00, 0x19, 0x21, 0x81, 0x98, 0x01, 0x80, 0x81,
+    0x78, 0x01, 0x00, 0x21, 0x00, 0x01,
+    // 0x6F 'o'
+    0x03, 0x11, 0x08, 0x01, 0x01, 0xE1, 0x00, 0x01, 0x50, 0x09, 0x00, 0x09,
+    0xA0, 0x01, 0x80, 0x05, 0xA0, 0x01, 0x0F, 0x01, 0x40, 0x21, 0x21, 0x81,
+    0x00, 0x01,
+    // 0x70 'p'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x06, 0x0F,
+    0x20, 0x60, 0x0F, 0x2C, 0x06, 0x2F, 0x80, 0x54, 0x2F, 0x19, 0x00, 0x1F,
+    0x14, 0x08, 0x0F, 0x20, 0x08, 0x0F, 0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0xA0, 0x48, 0x0F, 0x8E, 0x10, 0x0F, 0x00, 0x40, 0x0F, 0x37, 0x00, 0x0F,
+    // 0x71 'q'
+    0x01, 0x88, 0x0F, 0x08, 0x00, 0x0F, 0x01, 0xE0, 0x0F, 0x04, 0x00, 0x0F,
+    0x50, 0x00, 0x0F, 0x00, 0x10, 0x2F, 0xA0, 0x28, 0x0F, 0xA0, 0x57, 0x0F,
+    0x01, 0x00, 0x0F, 0x5C, 0x06, 0x0F, 0x40, 0xC0, 0x3F, 0x0C, 0x00, 0x0F,
+    0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x72 'r'
+    0x40, 0x07, 0x20, 0x63, 0x24, 0x03, 0x80, 0x23, 0x8C, 0x03, 0x02, 0x03,
+    0x28, 0x03, 0x10, 0x03, 0x80, 0x03, 0x80, 0x03, 0x40, 0x03,
+    // 0x73 's'
+    0x00, 0x19, 0x00, 0x25, 0x1C, 0x11, 0x00, 0x01, 0x59, 0x09, 0x24, 0x89,
+    0x80, 0x45, 0xA0, 0x01, 0x80, 0x11, 0x00, 0x01, 0x00, 0x01,
+    // 0x74 't'
+    0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x04, 0x30, 0xBF, 0x07, 0x00, 0x3F,
+    0x20, 0x1A, 0x3F, 0x83, 0x00, 0x3F, 0x74, 0x02, 0xBF, 0x04, 0x00, 0x3F,
+    0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x75 'u'
+    0x40, 0x01, 0x20, 0xC1, 0x24, 0x01, 0x80, 0x71, 0x86, 0x01, 0x40, 0x05,
+    0x00, 0x11, 0x00, 0x21, 0x00, 0xA1, 0x02, 0x05, 0x30, 0x01, 0x01, 0x01,
+    0x10, 0x11, 0x00, 0x21, 0x00, 0x01,
+    // 0x76 'v'
+    0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x8C, 0x01, 0x00, 0x3D, 0x18, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x81, 0x42, 0x01, 0x90, 0x81, 0x82, 0x01,
+    0x70, 0x01,
+    // 0x77 'w'
+    0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x88, 0x01, 0x00, 0x79, 0x18, 0x01,
+    0x00, 0x65, 0x00, 0x29, 0x00, 0x81, 0x22, 0x41, 0x81, 0x01, 0x00, 0xF9,
+    0x18, 0x01, 0x00, 0x25, 0x00, 0x29, 0x00, 0x91, 0x42, 0x01, 0x80, 0x81,
+    0x82, 0x01, 0x00, 0x01,
+    // 0x78 'x'
+    0x00, 0x01, 0x00, 0x11, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x90, 0x41,
+    0x04, 0xA1, 0x20, 0x41, 0x08, 0x21, 0x09, 0x05, 0x04, 0x41, 0x08, 0x01,
+    0x00, 0x05, 0xA0, 0x01, 0x80, 0x09, 0x40, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x57, 0x20, 0x00, 0x07, 0x90, 0x00, 0x87, 0x03, 0x00, 0x07,
+    0x20, 0x00, 0x87, 0x07, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x28, 0x07,
+    0x00, 0x90, 0x07, 0x26, 0x40, 0x07, 0x81, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x7A 'z'
+    0x00, 0x05, 0x10, 0x01, 0x08, 0x09, 0x00, 0x01, 0x80, 0x15, 0x02, 0x01,
+    0x04, 0x01, 0x58, 0x01, 0x00, 0x01, 0x08, 0x11, 0x90, 0x25, 0x20, 0x01,
+    // 0x7B '{'
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x08, 0x20, 0xBF, 0x00, 0x13, 0x06, 0x3F,
+    0x00, 0x20, 0x21, 0x3F, 0x08, 0x17, 0x01, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x3F,
+    // 0x7C '|'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x06, 0x00, 0xC0, 0xC0,
+    0x18, 0x18, 0x00, 0x83, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x81, 0x09, 0x80, 0x3F, 0xBC, 0x00, 0x00, 0x3F, 0x01, 0x04, 0x00, 0x3F,
+    0x38, 0x00, 0x00, 0x3F,
+    // 0x7E '~'
+    0x37, 0x07, 0xA7, 0x07, 0xA7, 0x07, 0x57, 0x07, 0x07, 0x07, 0x97, 0xA7,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0x1F, 0x00, 0x10, 0x0F,
+    0x43, 0x01, 0x8F, 0x94, 0x70, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA2 '¢'
+    0x00, 0x1B, 0x00, 0x7F, 0x00, 0x40, 0x40, 0x7F, 0x00, 0x1E, 0x00, 0x7F,
+    0x00, 0x40, 0x06, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x06, 0x18, 0x7F,
+    0x05, 0x43, 0x00, 0x7F, 0x08, 0x30, 0x00, 0x7F, 0x81, 0x00, 0xA0, 0x7F,
+    0x31, 0x00, 0x00, 0x7F, 0x04, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x8F,
+    0x00, 0x42, 0x2F, 0x00, 0x50, 0x2F, 0x01, 0x01, 0x2F, 0x00, 0x08, 0x2F,
+    0x11, 0xC0, 0x0F, 0x24, 0x40, 0x0F, 0x10, 0x40, 0x0F, 0x40, 0x40, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x00, 0x8F, 0x0C, 0x00, 0xCF, 0x04, 0x00, 0x0F,
+    0x18, 0x00, 0x0F,
+    // 0xA4 '¤'
+    0x00, 0x07, 0x00, 0x17, 0x40, 0x47, 0x24, 0x07, 0x00, 0x27, 0x20, 0x87,
+    0x00, 0x47, 0x40, 0x47, 0x40, 0x07, 0x40, 0xA7, 0x51, 0x07, 0x00, 0x07,
+    0x01, 0x07, 0x40, 0x07, 0x80, 0x07, 0x40, 0x07,
+    // 0xA5 '¥'
+    0xC0, 0x00, 0x3F, 0x80, 0x90, 0x7F, 0x90, 0x08, 0x3F, 0x83, 0x08, 0xBF,
+    0xA0, 0x4B, 0x3F, 0x84, 0x00, 0x3F, 0xC0, 0x81, 0x3F, 0x00, 0x88, 0xBF,
+    0x00, 0x08, 0xBF, 0x04, 0x08, 0x3F, 0xC9, 0x08, 0x3F, 0x80, 0x00, 0x3F,
+    0x88, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
+    0x80, 0x00, 0x3F,
+    // 0xA7 '§'
+    0x00, 0x00, 0xA7, 0x04, 0x40, 0x17, 0x13, 0x00, 0x47, 0x20, 0x40, 0x27,
+    0x52, 0x28, 0x27, 0x05, 0x04, 0x27, 0x82, 0x82, 0x17, 0x81, 0x00, 0x87,
+    0x80, 0x02, 0x27, 0x90, 0x0E, 0x47, 0x08, 0x21, 0x07, 0x20, 0x00, 0x07,
+    // 0xA9 '©'
+    0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F, 0x09, 0xF9, 0x0F, 0x14, 0x02, 0x8F,
+    0x28, 0x00, 0x4F, 0x10, 0x70, 0x8F, 0x40, 0x04, 0x2F, 0x20, 0x92, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x04, 0x1F, 0x02, 0x04, 0x0F,
+    0x20, 0x06, 0x0F, 0x40, 0x04, 0x4F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x0C, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0xF0, 0x0F,
+    // 0xAA 'ª'
+    0x00, 0x1F, 0x08, 0x0F, 0x26, 0x4F, 0x50, 0x0F, 0x21, 0x0F, 0x02, 0x0F,
+    0x38, 0x4F, 0x07, 0x4F, 0x21, 0x17, 0x00, 0x07,
+    // 0xAB '«'
+    0x00, 0x1F, 0x0A, 0x1F, 0x11, 0x1F, 0x04, 0x9F, 0x09, 0x5F, 0x00, 0x5F,
+    0x06, 0x1F, 0x01, 0x1F, 0x00, 0x9F, 0x08, 0x5F, 0x50, 0x9F, 0x20, 0x1F,
+    0x40, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x04, 0x41, 0x30, 0x11, 0x00, 0x0D, 0x67, 0xC1,
+    0x00, 0x01, 0x00, 0x27, 0x06, 0x45, 0x20, 0x21, 0x40, 0x09, 0x10, 0x01,
+    0x04, 0x29, 0x08, 0x21, 0x00, 0x01,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x01, 0x3F, 0x0C, 0xBF, 0x40, 0x3F, 0x21, 0x3F, 0x21, 0x3F,
+    0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x03,
+    // 0xB2 '²'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x47, 0x08, 0x07, 0x50, 0x27, 0x20, 0x27,
+    0x22, 0x27, 0x25, 0x27, 0x02, 0x27, 0x44, 0x07, 0x00, 0x07,
+    // 0xB3 '³'
+    0x00, 0x17, 0x00, 0x0F, 0x10, 0x0F, 0x41, 0x0F, 0x24, 0x27, 0x01, 0x57,
+    0x28, 0x07, 0x00, 0x47, 0x30, 0x07,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0xC7, 0x00, 0x18, 0x07, 0x03, 0x01, 0xE7,
+    0x60, 0x04, 0x07, 0x03, 0x20, 0x07, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x00, 0x07, 0x00, 0x50, 0x07, 0x0C, 0x18, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0xC0, 0x04, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x04, 0x20, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x15, 0x00, 0x08, 0xC1, 0x00, 0x08, 0x31,
+    0x40, 0x03, 0x09, 0x00, 0x60, 0x91, 0x0C, 0x18, 0x41, 0x03, 0x06, 0x01,
+    0x00, 0xC0, 0x01, 0x18, 0x00, 0x01, 0x20, 0x00, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xB7 '·'
+    0x6F, 0x9F, 0x0F, 0x4F,
+    // 0xB9 '¹'
+    0x00, 0x17, 0x00, 0x07, 0x00, 0x27, 0x46, 0x07, 0x00, 0x67, 0x06, 0x07,
+    0x40, 0x07,
+    // 0xBA 'º'
+    0x00, 0x07, 0x02, 0x0F, 0x10, 0x8F, 0x07, 0x4F, 0x40, 0x4F, 0x20, 0x4F,
+    0x00, 0x0F, 0x18, 0x0F, 0x40, 0x17, 0x00, 0x07,
+    // 0xBB '»'
+    0x00, 0x1F, 0x00, 0x9F, 0x41, 0x5F, 0x02, 0x1F, 0x0C, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x5F, 0x20, 0x1F, 0x4C, 0x1F, 0x20, 0x1F, 0x12, 0x1F,
+    0x00, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x08, 0x07, 0x00, 0x18, 0x07, 0x00, 0x08, 0x07, 0x03, 0x08, 0x07,
+    0x40, 0x28, 0x07, 0x06, 0x08, 0x07, 0x60, 0x00, 0x07, 0x00, 0x00, 0x97,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x08, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0xA0, 0x07, 0x00, 0x40, 0x07, 0x04, 0x02, 0x07,
+    0x02, 0x04, 0x07, 0x24, 0x08, 0x07, 0x40, 0x14, 0x07, 0xA0, 0x28, 0x07,
+    0x40, 0x50, 0xE7, 0x00, 0xAC, 0x07, 0x00, 0x00, 0x87, 0x01, 0x18, 0x07,
+    0x00, 0x01, 0x07,
+    // 0xBD '½'
+    0x00, 0x08, 0x07, 0x00, 0x18, 0x07, 0x00, 0x08, 0x07, 0x03, 0x08, 0x07,
+    0x40, 0x28, 0x07, 0x06, 0x08, 0x07, 0x60, 0x00, 0x97, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x08, 0x07, 0x00, 0x04, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0xA0, 0x07, 0x00, 0x40, 0x07, 0x04, 0x00, 0x07, 0x02, 0x00, 0x67,
+    0x24, 0x00, 0x87, 0x40, 0x40, 0x07, 0xA0, 0xA0, 0x07, 0x40, 0x40, 0x47,
+    0x01, 0x04, 0x47, 0x01, 0x0A, 0x47, 0x01, 0x64, 0x47, 0x00, 0x08, 0x47,
+    0x00, 0x60, 0x07,
+    // 0xBE '¾'
+    0x00, 0x18, 0x07, 0x00, 0x10, 0x07, 0x20, 0x10, 0x07, 0x13, 0x00, 0x07,
+    0x41, 0x08, 0x07, 0x24, 0x00, 0x07, 0x08, 0x10, 0x37, 0x45, 0x20, 0x47,
+    0x30, 0x00, 0x27, 0x00, 0x02, 0x47, 0x00, 0x04, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x20, 0x07, 0x00, 0x50, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x01, 0x02, 0x07, 0x10, 0x04, 0x07, 0x00, 0x08, 0x07, 0x90, 0x14, 0x07,
+    0x00, 0x28, 0x07, 0x00, 0x50, 0xE7, 0x00, 0xAC, 0x07, 0x00, 0x00, 0x87,
+    0x01, 0x18, 0x07, 0x00, 0x01, 0x07,
+    // 0xBF '¿'
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x13, 0x2F, 0x00, 0x20, 0x8F,
+    0x01, 0x40, 0x0F, 0x25, 0x00, 0x8F, 0x94, 0x00, 0x8F, 0x80, 0x80, 0xCF,
+    0x40, 0x00, 0x0F,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x49, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x40, 0x7F,
+    0x00, 0x01, 0x40, 0x7F, 0x40, 0x24, 0x40, 0x7F, 0x10, 0x90, 0x40, 0x7F,
+    0x40, 0x00, 0x40, 0xFF, 0x28, 0x07, 0x40, 0x7F, 0x11, 0x80, 0x0D, 0x7F,
+    0x00, 0x0C, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x49, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x40, 0x7F,
+    0x00, 0x01, 0x40, 0x7F, 0x00, 0x24, 0x40, 0x7F, 0x08, 0x90, 0x40, 0x7F,
+    0x08, 0x00, 0x40, 0xFF, 0x28, 0x07, 0x40, 0x7F, 0x01, 0x80, 0x0D, 0x7F,
+    0x10, 0x0C, 0x00, 0x7F, 0x80, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x49, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x40, 0x7F,
+    0x08, 0x01, 0x40, 0x7F, 0x10, 0x24, 0x40, 0x7F, 0x28, 0x90, 0x40, 0x7F,
+    0x40, 0x00, 0x40, 0xFF, 0x80, 0x07, 0x40, 0x7F, 0x81, 0x80, 0x0D, 0x7F,
+    0x00, 0x0C, 0x00, 0x7F, 0x20, 0x00, 0x60, 0x7F, 0x18, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x49, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x40, 0x7F,
+    0x10, 0x01, 0x40, 0x7F, 0x40, 0x24, 0x40, 0x7F, 0x00, 0x90, 0x40, 0x7F,
+    0x00, 0x00, 0x40, 0xFF, 0x00, 0x07, 0x40, 0x7F, 0x09, 0x80, 0x0D, 0x7F,
+    0x00, 0x0C, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F, 0x60, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x06, 0x00, 0x00, 0x92, 0x00, 0x02, 0x00,
+    0x00, 0x08, 0x80, 0x60, 0x02, 0x80, 0x90, 0x48, 0x80, 0x81, 0x20, 0x80,
+    0x40, 0x00, 0x81, 0x00, 0x0E, 0x80, 0x03, 0x00, 0x1A, 0x10, 0x18, 0x00,
+    0x80, 0x00, 0xC0, 0xA0, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x01, 0xBF,
+    0x00, 0x00, 0x24, 0xBF, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x02, 0x20, 0x3F,
+    0x00, 0x00, 0xA0, 0x3F, 0x18, 0x12, 0x20, 0x3F, 0x40, 0x48, 0x20, 0x3F,
+    0x22, 0x00, 0x20, 0x7F, 0x82, 0x03, 0xA0, 0x3F, 0x82, 0xC0, 0x06, 0xBF,
+    0x00, 0x06, 0x00, 0x3F, 0x38, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x01, 0x5F, 0x00, 0x02, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x30, 0x3F, 0x00, 0x50, 0x5F, 0x04, 0x10, 0x5F,
+    0x2A, 0x13, 0x1F, 0x24, 0x60, 0x1F, 0x0C, 0x01, 0x9F, 0x00, 0x10, 0x1F,
+    0x03, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x20, 0x9F, 0x00, 0x42, 0x1F, 0x00, 0x01, 0x9F, 0x04, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0xC7 'Ç'
+    0x00, 0x66, 0x00, 0x3F, 0x02, 0x00, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x11, 0x00, 0x20, 0x3F, 0x04, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x84, 0x7F,
+    0x50, 0x00, 0x09, 0x3F, 0x00, 0x00, 0x08, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x10, 0x01, 0x00, 0x3F, 0x02, 0x01, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x98, 0x02, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x06, 0x80, 0x7F, 0x20, 0x40, 0x80, 0x7F,
+    0x90, 0x00, 0x80, 0x7F, 0x40, 0x00, 0x80, 0x7F, 0x08, 0x00, 0x80, 0x7F,
+    0x08, 0x00, 0x84, 0x7F, 0x08, 0x00, 0x01, 0x7F, 0x00, 0x70, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x00, 0x7F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x98, 0x02, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x06, 0x80, 0x7F, 0x00, 0x40, 0x80, 0x7F,
+    0x08, 0x00, 0x80, 0x7F, 0x08, 0x00, 0x80, 0x7F, 0x28, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x84, 0x7F, 0x40, 0x00, 0x01, 0x7F, 0x10, 0x70, 0x08, 0x7F,
+    0x60, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x00, 0x7F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x98, 0x02, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x06, 0x80, 0x7F, 0x00, 0x40, 0x80, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0xA0, 0x00, 0x84, 0x7F, 0x10, 0x00, 0x01, 0x7F, 0x08, 0x70, 0x08, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x00, 0x7F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C,
+    0x01, 0x01, 0x80, 0x01, 0x30, 0x04, 0x00, 0x00, 0x40, 0x00, 0x0D, 0x00,
+    0x10, 0x81, 0x00, 0x80, 0x01, 0x00, 0xA0, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x90, 0xE0, 0x10, 0x80, 0x00, 0x00,
+    0x03, 0x00, 0x00,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x40, 0x98, 0x02, 0x7F,
+    0x10, 0x00, 0x21, 0x7F, 0x40, 0x06, 0x00, 0xFF, 0x28, 0x40, 0x00, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x98, 0x02, 0x7F,
+    0x08, 0x00, 0x21, 0x7F, 0x08, 0x06, 0x00, 0xFF, 0x28, 0x40, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x08, 0x80, 0xC0, 0x7F, 0x10, 0x98, 0x02, 0x7F,
+    0x28, 0x00, 0x21, 0x7F, 0x40, 0x06, 0x00, 0xFF, 0x80, 0x40, 0x00, 0x7F,
+    0x80, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x18, 0x00, 0x00, 0x7F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C,
+    0x61, 0x01, 0x80, 0x91, 0x30, 0x04, 0x80, 0x00, 0x42, 0x40, 0x0C, 0x01,
+    0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xA0, 0x00, 0x00,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x60, 0x4F, 0x20, 0x21, 0x8F,
+    0x40, 0x10, 0x0F, 0x06, 0x00, 0x8F, 0x00, 0x18, 0x4F, 0x01, 0x20, 0x4F,
+    0x10, 0x20, 0x4F, 0x20, 0x20, 0x0F, 0x20, 0x20, 0x2F, 0x20, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F, 0x40, 0x00, 0x0F, 0x04, 0x08, 0x0F,
+    0x20, 0x00, 0x0F, 0x10, 0x04, 0x0F, 0x06, 0xE0, 0x0F,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x98, 0x0D, 0x3F,
+    0x00, 0x01, 0x81, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x01, 0x04, 0x00, 0x3F,
+    0x20, 0x21, 0x00, 0x3F, 0x10, 0x08, 0x40, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x40, 0x00, 0x10, 0xBF, 0x28, 0x00, 0x08, 0x3F,
+    0x01, 0x00, 0xC0, 0x3F, 0x10, 0x98, 0x04, 0x3F, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xD2 'Ò'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x44, 0x04, 0xBF, 0x00, 0x10, 0x02, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x01, 0x40, 0x01, 0x3F, 0x60, 0x00, 0x01, 0x3F, 0x90, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x00, 0x3F, 0x28, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x01, 0x20, 0x22, 0x3F, 0x00, 0x0F, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x20, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD3 'Ó'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x44, 0x04, 0xBF, 0x00, 0x10, 0x02, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x01, 0x40, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x08, 0x80, 0x00, 0x3F, 0x28, 0x80, 0x02, 0xBF, 0x00, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x81, 0x20, 0x22, 0x3F, 0x40, 0x0F, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x20, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD4 'Ô'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x44, 0x04, 0xBF, 0x00, 0x10, 0x02, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x09, 0x40, 0x01, 0x3F, 0x10, 0x00, 0x01, 0x3F, 0x28, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x02, 0xBF, 0x80, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x01, 0x20, 0x22, 0x3F, 0x18, 0x0F, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x20, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD5 'Õ'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x44, 0x04, 0xBF, 0x00, 0x10, 0x02, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x01, 0x40, 0x01, 0x3F, 0x40, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x10, 0x80, 0x02, 0xBF, 0x08, 0x00, 0x04, 0x3F,
+    0x28, 0x00, 0x08, 0x3F, 0x01, 0x20, 0x22, 0x3F, 0x60, 0x0F, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x20, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD6 'Ö'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0xC0, 0x7F,
+    0x00, 0x88, 0x09, 0x7F, 0x00, 0x20, 0x04, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x62, 0x80, 0x02, 0x7F, 0x90, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x41, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x82, 0x40, 0x44, 0x7F, 0xA0, 0x1E, 0x08, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xD7 '×'
+    0x40, 0x1F, 0xA1, 0x1F, 0x52, 0x1F, 0x2C, 0x1F, 0x10, 0x1F, 0x10, 0x1F,
+    0x24, 0x1F, 0x42, 0x1F, 0x81, 0x1F, 0x00, 0xDF, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0xC2, 0xAF, 0x02, 0x00, 0x4F,
+    0x00, 0x18, 0x0F, 0x01, 0x00, 0x2F, 0x04, 0x00, 0x8F, 0x08, 0x00, 0x0F,
+    0x50, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0xAF, 0x00, 0x01, 0x0F, 0x04, 0x02, 0x0F, 0x40, 0x08, 0x8F,
+    0x03, 0xE1, 0x0F, 0x20, 0x04, 0x0F, 0x58, 0x10, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x83, 0x01, 0x3F, 0x00, 0x60, 0x00, 0x3F,
+    0x00, 0x00, 0x84, 0x3F, 0x00, 0x18, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x61, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x02, 0xBF, 0x28, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x01, 0x80, 0xC0, 0x3F, 0x00, 0x98, 0x08, 0x3F, 0x00, 0x00, 0x80, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x83, 0x01, 0x3F, 0x00, 0x60, 0x00, 0x3F,
+    0x00, 0x00, 0x84, 0x3F, 0x00, 0x18, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x02, 0xBF, 0x28, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x11, 0x80, 0xC0, 0x3F, 0x80, 0x98, 0x08, 0x3F, 0x40, 0x00, 0x80, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x83, 0x01, 0x3F, 0x00, 0x60, 0x00, 0x3F,
+    0x00, 0x00, 0x84, 0x3F, 0x00, 0x18, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x08, 0x80, 0x00, 0x3F, 0x11, 0x00, 0x00, 0x3F, 0x28, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x04, 0x3F, 0x80, 0x00, 0x08, 0x3F,
+    0x01, 0x80, 0xC0, 0x3F, 0x00, 0x98, 0x08, 0x3F, 0x18, 0x00, 0x80, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x10, 0x7F, 0x01, 0x06, 0x02, 0x7F, 0x00, 0xC0, 0x00, 0x7F,
+    0x00, 0x01, 0x08, 0x7F, 0x00, 0x30, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x61, 0x00, 0x00, 0x7F, 0x92, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x03, 0x01, 0x80, 0x7F, 0x81, 0x30, 0x10, 0x7F, 0xA0, 0x01, 0x00, 0x7F,
+    0x00, 0x30, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x5F, 0x00, 0x01, 0x9F,
+    0x20, 0x30, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x1C, 0x5F, 0x03, 0x00, 0x3F,
+    0x08, 0x00, 0x1F, 0x28, 0x04, 0x1F, 0x08, 0x00, 0x1F, 0x02, 0x0A, 0x1F,
+    0x01, 0x10, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x80, 0x1F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x03, 0x01, 0x0F, 0x00, 0x60, 0x18, 0x0F,
+    0x06, 0x01, 0x00, 0x0F, 0x10, 0x30, 0x10, 0x0F, 0x22, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x10, 0x0F,
+    0x20, 0x80, 0x10, 0x0F, 0x01, 0x40, 0x08, 0x0F, 0x0C, 0x00, 0x40, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x18, 0x00, 0x80, 0x0F,
+    // 0xE0 'à'
+    0x00, 0x03, 0x13, 0x00, 0x00, 0x03, 0x00, 0x23, 0xC3, 0x00, 0x48, 0x03,
+    0x00, 0x80, 0x03, 0x60, 0x00, 0x23, 0x91, 0x40, 0x53, 0x49, 0x40, 0xA3,
+    0x00, 0x02, 0x7B, 0x0C, 0xB8, 0x03, 0x00, 0x81, 0x83, 0x00, 0x18, 0x2B,
+    0x00, 0x80, 0x53, 0x00, 0x00, 0x03,
+    // 0xE1 'á'
+    0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x00, 0x11, 0xE1, 0x00, 0x24, 0x01,
+    0x00, 0x40, 0x01, 0x00, 0x00, 0x11, 0x00, 0xA0, 0x29, 0x04, 0xA0, 0x51,
+    0x10, 0x01, 0x3D, 0x20, 0x5C, 0x01, 0x00, 0x40, 0xC1, 0x40, 0x0C, 0x15,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x01,
+    // 0xE2 'â'
+    0x00, 0x03, 0x13, 0x00, 0x00, 0x03, 0x00, 0x23, 0xC3, 0x00, 0x48, 0x03,
+    0x04, 0x80, 0x03, 0x04, 0x00, 0x23, 0x21, 0x40, 0x53, 0x41, 0x40, 0xA3,
+    0xA0, 0x02, 0x7B, 0x80, 0xB8, 0x03, 0x00, 0x81, 0x83, 0x24, 0x18, 0x2B,
+    0x00, 0x80, 0x53, 0x00, 0x00, 0x03,
+    // 0xE3 'ã'
+    0x00, 0x03, 0x13, 0x00, 0x00, 0x03, 0x00, 0x23, 0xC3, 0x00, 0x48, 0x03,
+    0x00, 0x80, 0x03, 0x08, 0x00, 0x23, 0x51, 0x40, 0x53, 0x01, 0x40, 0xA3,
+    0x40, 0x02, 0x7B, 0x20, 0xB8, 0x03, 0x08, 0x81, 0x83, 0x40, 0x18, 0x2B,
+    0x20, 0x80, 0x53, 0x00, 0x00, 0x03,
+    // 0xE4 'ä'
+    0x00, 0x06, 0x27, 0x00, 0x00, 0x07, 0x00, 0x47, 0x87, 0x00, 0x90, 0x07,
+    0x21, 0x00, 0x07, 0x10, 0x00, 0x47, 0x12, 0x80, 0xA7, 0x62, 0x81, 0x47,
+    0x00, 0x04, 0xF7, 0x01, 0x70, 0x07, 0x11, 0x03, 0x07, 0x10, 0x30, 0x57,
+    0x61, 0x00, 0xA7, 0x00, 0x00, 0x07,
+    // 0xE5 'å'
+    0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x00, 0x11, 0xE1, 0x00, 0x24, 0x01,
+    0x00, 0x40, 0x01, 0x18, 0x00, 0x11, 0x02, 0xA0, 0x29, 0x00, 0xA0, 0x51,
+    0x04, 0x01, 0x3D, 0x20, 0x5C, 0x01, 0x00, 0x40, 0xC1, 0x38, 0x0C, 0x15,
+    0x00, 0x40, 0x29, 0x00, 0x00, 0x01,
+    // 0xE6 'æ'
+    0x01, 0x89, 0x04, 0x01, 0x11, 0xE1, 0x24, 0x01, 0x40, 0x05, 0x00, 0x01,
+    0x20, 0x01, 0xA0, 0xA1, 0xA2, 0x09, 0x08, 0x05, 0x43, 0x01, 0x00, 0x81,
+    0x40, 0x81, 0x02, 0x01, 0x85, 0x05, 0x88, 0x01, 0x00, 0x21, 0x40, 0x01,
+    0x00, 0x01,
+    // 0xE7 'ç'
+    0x03, 0x10, 0x07, 0x08, 0x04, 0x0F, 0x01, 0xE0, 0x9F, 0x08, 0x01, 0x27,
+    0x40, 0x01, 0x17, 0x20, 0x00, 0x07, 0xA0, 0x04, 0x07, 0xA0, 0x00, 0x07,
+    0x80, 0x20, 0x07, 0x60, 0x00, 0x07,
+    // 0xE8 'è'
+    0x00, 0x06, 0x23, 0x00, 0x10, 0x0B, 0x00, 0x00, 0xC3, 0x00, 0x10, 0x03,
+    0x20, 0x81, 0x03, 0x90, 0x04, 0x03, 0x49, 0x02, 0x0B, 0x01, 0x00, 0x23,
+    0x09, 0x04, 0x13, 0x00, 0x08, 0x23, 0x00, 0x20, 0x03,
+    // 0xE9 'é'
+    0x00, 0x03, 0x11, 0x00, 0x08, 0x05, 0x00, 0x00, 0x61, 0x00, 0x08, 0x01,
+    0x00, 0x40, 0x81, 0x00, 0x02, 0x01, 0x00, 0x81, 0x05, 0x10, 0x80, 0x11,
+    0x20, 0x82, 0x09, 0x00, 0x04, 0x11, 0x40, 0x10, 0x01,
+    // 0xEA 'ê'
+    0x00, 0x06, 0x23, 0x00, 0x10, 0x0B, 0x00, 0x00, 0xC3, 0x04, 0x10, 0x03,
+    0x14, 0x81, 0x03, 0x20, 0x04, 0x03, 0x51, 0x02, 0x0B, 0xA1, 0x00, 0x23,
+    0x91, 0x04, 0x13, 0x00, 0x08, 0x23, 0x04, 0x20, 0x03, 0x00, 0x00, 0x03,
+    // 0xEB 'ë'
+    0x00, 0x0C, 0x47, 0x00, 0x20, 0x17, 0x00, 0x01, 0x87, 0x20, 0x20, 0x07,
+    0x11, 0x02, 0x07, 0x10, 0x08, 0x07, 0x62, 0x04, 0x17, 0x02, 0x00, 0x47,
+    0x02, 0x08, 0x27, 0x10, 0x10, 0x47, 0x10, 0x40, 0x07, 0x60, 0x00, 0x07,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x13, 0x00, 0x41, 0x03, 0x20, 0x48, 0x03, 0x91, 0x00, 0x83,
+    0x49, 0x0C, 0x23, 0x04, 0xC0, 0x43, 0x08, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x00, 0x09, 0x00, 0x20, 0x81, 0x00, 0x24, 0x01, 0x00, 0x80, 0x41,
+    0x00, 0x86, 0x11, 0x10, 0x60, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x60, 0x00, 0x01,
+    // 0xEE 'î'
+    0x00, 0x00, 0x13, 0x04, 0x41, 0x03, 0x14, 0x48, 0x03, 0x29, 0x00, 0x83,
+    0x11, 0x0C, 0x23, 0xA0, 0xC0, 0x43, 0x90, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x27, 0x20, 0x82, 0x07, 0x10, 0x90, 0x07, 0x12, 0x01, 0x07,
+    0x42, 0x18, 0x47, 0x01, 0x80, 0x87, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x03, 0x00, 0x0C, 0x23, 0x00, 0x00, 0x03, 0x00, 0x47, 0xC3,
+    0x00, 0x10, 0x03, 0x00, 0x00, 0x13, 0x40, 0x40, 0x13, 0xA5, 0x00, 0x03,
+    0x01, 0x00, 0x2B, 0x04, 0x00, 0x13, 0x01, 0x96, 0x23, 0x60, 0x00, 0x43,
+    0x01, 0x02, 0x03, 0x00, 0x00, 0x03,
+    // 0xF1 'ñ'
+    0x00, 0x80, 0x0B, 0x00, 0x41, 0x83, 0x00, 0x58, 0x0B, 0x01, 0x00, 0x43,
+    0x00, 0x12, 0x03, 0x08, 0x00, 0x03, 0x10, 0x10, 0x03, 0x00, 0x20, 0x03,
+    0x40, 0x00, 0x33, 0x20, 0x43, 0x03, 0x29, 0x30, 0x03, 0x41, 0x01, 0x03,
+    0x20, 0xF0, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x06, 0x23, 0x00, 0x10, 0x03, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03,
+    0x00, 0xA0, 0x13, 0x60, 0x00, 0x13, 0x91, 0x40, 0x03, 0x49, 0x00, 0x0B,
+    0x01, 0x40, 0x03, 0x0C, 0x1E, 0x03, 0x00, 0x80, 0x43, 0x00, 0x43, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xF3 'ó'
+    0x00, 0x03, 0x11, 0x00, 0x08, 0x01, 0x00, 0x01, 0xE1, 0x00, 0x00, 0x01,
+    0x00, 0x50, 0x09, 0x00, 0x00, 0x09, 0x00, 0xA0, 0x01, 0x04, 0x80, 0x05,
+    0x10, 0xA0, 0x01, 0x20, 0x0F, 0x01, 0x00, 0x40, 0x21, 0x40, 0x21, 0x81,
+    0x00, 0x00, 0x01,
+    // 0xF4 'ô'
+    0x00, 0x06, 0x23, 0x00, 0x10, 0x03, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03,
+    0x04, 0xA0, 0x13, 0x04, 0x00, 0x13, 0x21, 0x40, 0x03, 0x41, 0x00, 0x0B,
+    0xA1, 0x40, 0x03, 0x80, 0x1E, 0x03, 0x08, 0x80, 0x43, 0x24, 0x43, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xF5 'õ'
+    0x00, 0x06, 0x23, 0x00, 0x10, 0x03, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03,
+    0x00, 0xA0, 0x13, 0x08, 0x00, 0x13, 0x51, 0x40, 0x03, 0x01, 0x00, 0x0B,
+    0x41, 0x40, 0x03, 0x20, 0x1E, 0x03, 0x08, 0x80, 0x43, 0x40, 0x43, 0x03,
+    0x20, 0x00, 0x03,
+    // 0xF6 'ö'
+    0x00, 0x0C, 0x47, 0x00, 0x20, 0x07, 0x00, 0x07, 0x87, 0x00, 0x00, 0x07,
+    0x21, 0x40, 0x27, 0x10, 0x00, 0x27, 0x12, 0x80, 0x07, 0x62, 0x00, 0x17,
+    0x02, 0x80, 0x07, 0x00, 0x3C, 0x07, 0x11, 0x00, 0x87, 0x10, 0x86, 0x07,
+    0x60, 0x00, 0x07,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x64, 0x27, 0x84, 0x07,
+    0x84, 0x07, 0x64, 0x27, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x02, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x05, 0x00, 0x01, 0x03, 0x01, 0x08, 0x01, 0x01, 0x81, 0x00, 0x81,
+    0x50, 0x49, 0x00, 0x89, 0xA1, 0x01, 0x80, 0x05, 0xA8, 0x01, 0x07, 0x01,
+    0x40, 0x21, 0x40, 0x81, 0x20, 0x01, 0x40, 0x01,
+    // 0xF9 'ù'
+    0x00, 0x80, 0x03, 0x00, 0x41, 0x83, 0x00, 0x48, 0x03, 0x01, 0x00, 0xE3,
+    0x01, 0x0C, 0x03, 0x60, 0x80, 0x0B, 0x90, 0x00, 0x23, 0x48, 0x00, 0x43,
+    0x20, 0x01, 0x43, 0x0C, 0x04, 0x0B, 0x00, 0x60, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x20, 0x23, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03,
+    // 0xFA 'ú'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0xC1, 0x00, 0x24, 0x01, 0x00, 0x80, 0x71,
+    0x00, 0x86, 0x01, 0x00, 0x40, 0x05, 0x00, 0x00, 0x11, 0x04, 0x00, 0x21,
+    0x00, 0x00, 0xA1, 0x20, 0x02, 0x05, 0x40, 0x30, 0x01, 0x40, 0x01, 0x01,
+    0x00, 0x10, 0x11, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01,
+    // 0xFB 'û'
+    0x00, 0x80, 0x03, 0x00, 0x41, 0x83, 0x00, 0x48, 0x03, 0x01, 0x00, 0xE3,
+    0x01, 0x0C, 0x03, 0x04, 0x80, 0x0B, 0x00, 0x00, 0x23, 0x40, 0x00, 0x43,
+    0x80, 0x01, 0x43, 0x80, 0x04, 0x0B, 0x88, 0x60, 0x03, 0x24, 0x02, 0x03,
+    0x00, 0x20, 0x23, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03,
+    // 0xFC 'ü'
+    0x01, 0x00, 0x07, 0x00, 0x83, 0x07, 0x00, 0x90, 0x07, 0x02, 0x01, 0xC7,
+    0x02, 0x18, 0x07, 0x11, 0x00, 0x17, 0x10, 0x00, 0x47, 0x60, 0x00, 0x87,
+    0x00, 0x02, 0x87, 0x00, 0x08, 0x17, 0x50, 0xC0, 0x07, 0x10, 0x04, 0x07,
+    0x00, 0x40, 0x47, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x03, 0x1F,
+    0x00, 0x00, 0x20, 0x1F, 0x20, 0x06, 0x03, 0x1F, 0x40, 0x60, 0x08, 0x5F,
+    0x0C, 0x01, 0x00, 0x5F, 0x00, 0xC4, 0x10, 0x1F, 0x04, 0x10, 0x10, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x28, 0x1F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x22, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x81, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x01, 0x5F, 0x00, 0x80, 0x00, 0x1F,
+    0x02, 0x40, 0x02, 0x1F, 0x50, 0x0C, 0x00, 0x1F, 0x10, 0x80, 0x02, 0x1F,
+    0x00, 0x1C, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xA0, 0x1F,
+    0x50, 0x02, 0x40, 0x1F, 0x10, 0x99, 0x00, 0x1F, 0x02, 0x04, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x00, 0xC0, 0x7F,
+    0x00, 0x12, 0x40, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x01, 0x10, 0x00, 0x7F,
+    0x00, 0x50, 0x00, 0x7F, 0x09, 0x10, 0x00, 0x7F, 0x24, 0x10, 0x00, 0x7F,
+    0x00, 0x10, 0x20, 0x7F, 0x01, 0xD0, 0x00, 0x7F, 0x60, 0x03, 0x48, 0x7F,
+    0x03, 0x00, 0x14, 0x7F, 0x00, 0x18, 0x02, 0xFF, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x41, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    // 0x105 'ą'
+    0x01, 0x88, 0x0F, 0x00, 0x00, 0x0F, 0x11, 0xE0, 0x0F, 0x24, 0x00, 0x0F,
+    0x40, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0xA0, 0x28, 0x0F, 0xA0, 0x50, 0x0F,
+    0x01, 0x3D, 0x0F, 0x5C, 0x00, 0x8F, 0x40, 0xC2, 0x1F, 0x0C, 0x14, 0x0F,
+    0x40, 0x28, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x01, 0x98, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x44, 0x00, 0xBF, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x20, 0x02, 0x3F,
+    0x01, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x28, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x40, 0x04, 0x3F, 0x90, 0x08, 0x04, 0x3F, 0x61, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x107 'ć'
+    0x00, 0x03, 0x11, 0x00, 0x08, 0x05, 0x00, 0x01, 0xE1, 0x00, 0x08, 0x01,
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x01, 0x00, 0xA0, 0x05, 0x10, 0xA0, 0x01,
+    0x20, 0x80, 0x21, 0x00, 0x60, 0x01, 0x40, 0x00, 0x01,
+    // 0x10C 'Č'
+    0x00, 0x00, 0xCC, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x22, 0x00, 0x5F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x01, 0x1F,
+    0x00, 0xA0, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F, 0x14, 0x00, 0x00, 0x1F,
+    0x28, 0x20, 0x02, 0x1F, 0x50, 0x04, 0x02, 0x1F, 0x00, 0x88, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x10D 'č'
+    0x00, 0x03, 0x11, 0x00, 0x08, 0x05, 0x00, 0x01, 0xE1, 0x00, 0x08, 0x01,
+    0x50, 0x40, 0x01, 0x44, 0x20, 0x01, 0x10, 0xA0, 0x05, 0x00, 0xA0, 0x01,
+    0x04, 0x80, 0x21, 0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x40, 0x03, 0x1F, 0x00, 0x80, 0x60, 0x1F, 0x00, 0x0C, 0x01, 0x1F,
+    0x00, 0x00, 0x30, 0x9F, 0x00, 0x03, 0x00, 0x9F, 0x60, 0x20, 0x00, 0x9F,
+    0x00, 0x40, 0x00, 0x1F, 0x04, 0x40, 0x00, 0x5F, 0x10, 0x40, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x00, 0x1F,
+    0x40, 0x08, 0x10, 0x1F, 0x20, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x08, 0x1F,
+    0x00, 0x0D, 0xC0, 0x1F,
+    // 0x10F 'ď'
+    0x00, 0x00, 0xC4, 0x00, 0x02, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x12, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x14, 0x00, 0x50, 0x28,
+    0x00, 0x00, 0x9E, 0x10, 0x2E, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x04, 0x0A,
+    0x00, 0xC0, 0x14, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x01, 0x80, 0x7F, 0x20, 0x30, 0x00, 0x7F, 0x26, 0x00, 0x80, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x01, 0xA0, 0x00, 0x7F, 0x10, 0x20, 0x00, 0x7F,
+    0x00, 0x20, 0x08, 0x7F, 0x00, 0x20, 0x10, 0x7F, 0x00, 0x20, 0x02, 0xFF,
+    0x00, 0x21, 0x00, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x1C, 0x02, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    // 0x119 'ę'
+    0x03, 0x10, 0x0F, 0x08, 0x04, 0x0F, 0x00, 0x60, 0x0F, 0x08, 0x00, 0xEF,
+    0x40, 0x82, 0x0F, 0x02, 0x01, 0x5F, 0x81, 0x00, 0x0F, 0x80, 0x10, 0x2F,
+    0x82, 0x08, 0x0F, 0x04, 0x10, 0x0F, 0x10, 0x00, 0x0F,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x40, 0x60, 0x3F, 0x00, 0x4C, 0x01, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x03, 0x40, 0x3F, 0x10, 0x20, 0x40, 0x3F,
+    0x40, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x14, 0x00, 0x42, 0x3F, 0x28, 0x00, 0x00, 0xBF, 0x50, 0x38, 0x04, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0xC0, 0x00, 0x3F,
+    // 0x11B 'ě'
+    0x00, 0x03, 0x11, 0x00, 0x08, 0x05, 0x00, 0x00, 0x61, 0x00, 0x08, 0x01,
+    0x50, 0x40, 0x81, 0x44, 0x02, 0x01, 0x10, 0x81, 0x05, 0x00, 0x80, 0x11,
+    0x04, 0x82, 0x09, 0x00, 0x04, 0x11, 0x00, 0x10, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x98, 0x02, 0x7F,
+    0x08, 0x00, 0x20, 0x7F, 0x08, 0x06, 0x00, 0x7F, 0x28, 0x40, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x14, 0x7F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0xEF, 0x00, 0x80, 0x08, 0x0F, 0x09, 0x01, 0x80, 0x0F,
+    0x10, 0x18, 0x0C, 0x2F, 0x08, 0x00, 0x80, 0x0F, 0x28, 0x18, 0x01, 0x0F,
+    0x01, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x67,
+    0x08, 0x0C, 0x07, 0x09, 0x80, 0x27, 0x00, 0x02, 0x07, 0x00, 0x60, 0x07,
+    0x04, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x62, 0x00, 0x8F, 0x08, 0x01, 0x47, 0x20, 0x00, 0x07,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x0E, 0x08, 0x00, 0x80, 0x10, 0x18, 0x00, 0x01, 0x80, 0xC2,
+    0x00, 0x08, 0x00, 0x01, 0x80, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x3F, 0x00, 0x18, 0x1F, 0x00, 0x08, 0x5F, 0x00, 0x21, 0x9F,
+    0x20, 0x00, 0x1F, 0x26, 0x00, 0x9F, 0x00, 0x08, 0x1F, 0x01, 0x00, 0x1F,
+    0x10, 0x40, 0x1F, 0x21, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x3F, 0x00, 0x05, 0x1F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x04, 0x3B, 0x20, 0x16, 0x03,
+    0x40, 0x60, 0x03, 0x06, 0x03, 0x0B, 0x00, 0x10, 0x03, 0x06, 0x20, 0x43,
+    0x60, 0x80, 0x03, 0x00, 0x00, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x98, 0x0D, 0x3F,
+    0x00, 0x01, 0x81, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x01, 0x04, 0x00, 0x3F,
+    0x00, 0x21, 0x00, 0x3F, 0x00, 0x08, 0x40, 0x3F, 0x10, 0x02, 0x00, 0x3F,
+    0x08, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x10, 0xBF, 0x40, 0x00, 0x08, 0x3F,
+    0x11, 0x00, 0xC0, 0x3F, 0xA0, 0x98, 0x04, 0x3F, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0x144 'ń'
+    0x00, 0x40, 0x05, 0x00, 0x20, 0xC1, 0x00, 0x2C, 0x05, 0x00, 0x80, 0x21,
+    0x00, 0x09, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x10, 0x01,
+    0x10, 0x00, 0x19, 0x20, 0x21, 0x81, 0x00, 0x98, 0x01, 0x40, 0x80, 0x81,
+    0x00, 0x78, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x4C, 0x06, 0x9F,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x82, 0x00, 0x1F,
+    0x40, 0x10, 0x80, 0x1F, 0x48, 0x04, 0x20, 0x1F, 0x24, 0x01, 0x00, 0x1F,
+    0x00, 0x00, 0x41, 0x1F, 0x10, 0x00, 0x08, 0x5F, 0x20, 0x00, 0x04, 0x1F,
+    0x00, 0x80, 0x60, 0x1F, 0x00, 0x4C, 0x02, 0x1F, 0x40, 0x00, 0x60, 0x1F,
+    0x00, 0x0C, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F,
+    // 0x148 'ň'
+    0x00, 0x40, 0x05, 0x00, 0x20, 0xC1, 0x00, 0x2C, 0x05, 0x00, 0x80, 0x21,
+    0x00, 0x09, 0x01, 0x50, 0x00, 0x01, 0x44, 0x08, 0x01, 0x10, 0x10, 0x01,
+    0x00, 0x00, 0x19, 0x04, 0x21, 0x81, 0x08, 0x98, 0x01, 0x00, 0x80, 0x81,
+    0x00, 0x78, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x00, 0x42, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x01, 0x01, 0x2F,
+    0x00, 0x00, 0x8F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x4F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x18, 0x0F,
+    0x03, 0x00, 0x0F, 0x00, 0x0C, 0x0F, 0x00, 0x80, 0x0F, 0x18, 0x20, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x42, 0x2F, 0x18, 0x03, 0x0F, 0x04, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    // 0x153 'œ'
+    0x03, 0x11, 0x08, 0x01, 0x01, 0xE1, 0x00, 0x01, 0x50, 0x09, 0x00, 0x09,
+    0xA0, 0x01, 0x80, 0x05, 0xA0, 0x09, 0x0F, 0x09, 0x40, 0x05, 0x20, 0x61,
+    0x08, 0x01, 0x40, 0x81, 0x02, 0x01, 0x81, 0x05, 0x80, 0x11, 0x82, 0x09,
+    0x04, 0x11, 0x10, 0x01,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x40, 0x03, 0x1F, 0x00, 0x80, 0x60, 0x1F, 0x00, 0x4C, 0x01, 0x1F,
+    0x00, 0x00, 0x10, 0x9F, 0x00, 0x06, 0x20, 0xDF, 0x00, 0x60, 0x20, 0x1F,
+    0x10, 0x40, 0x88, 0x1F, 0x00, 0x40, 0x02, 0x1F, 0x04, 0x01, 0x40, 0x1F,
+    0x08, 0x22, 0x04, 0x1F, 0x50, 0x80, 0x00, 0x5F, 0x20, 0x40, 0x00, 0x1F,
+    0x00, 0x18, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F,
+    // 0x159 'ř'
+    0x00, 0x40, 0x07, 0x00, 0x20, 0x63, 0x00, 0x24, 0x03, 0x00, 0x80, 0x23,
+    0x40, 0x8C, 0x03, 0x04, 0x02, 0x03, 0x00, 0x28, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x40, 0x03, 0x40, 0x00, 0x03,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x38, 0x0C, 0xBF,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x01, 0x01, 0x3F, 0x01, 0x40, 0x01, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x10, 0x82, 0x40, 0x3F, 0x08, 0x80, 0x22, 0xBF,
+    0x00, 0x80, 0x08, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x24, 0x3F,
+    0xA1, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x25, 0x00, 0x1C, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x59, 0x09, 0x00, 0x24, 0x89, 0x04, 0x80, 0x45, 0x10, 0xA0, 0x01,
+    0x20, 0x80, 0x11, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x160 'Š'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1C, 0x06, 0x5F,
+    0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x9F, 0x40, 0xA0, 0x00, 0x9F,
+    0x48, 0x00, 0x00, 0x9F, 0x24, 0x41, 0x20, 0x1F, 0x00, 0x40, 0x11, 0x5F,
+    0x10, 0x40, 0x04, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x12, 0x1F,
+    0x00, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x161 'š'
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x25, 0x00, 0x1C, 0x11, 0x00, 0x00, 0x01,
+    0x50, 0x59, 0x09, 0x40, 0x24, 0x89, 0x10, 0x80, 0x45, 0x00, 0xA0, 0x01,
+    0x04, 0x80, 0x11, 0x08, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x164 'Ť'
+    0x00, 0x78, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x40, 0x03, 0x00, 0x3F,
+    0x48, 0x20, 0x0C, 0xBF, 0x24, 0x01, 0x80, 0xBF, 0x00, 0x10, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x43, 0x0B, 0x00, 0x70, 0x03,
+    0x02, 0x01, 0xA3, 0x08, 0x30, 0x03, 0x07, 0x40, 0x2B, 0x00, 0x40, 0x03,
+    0x18, 0x40, 0x03, 0x80, 0x00, 0x03, 0x90, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x41, 0x80, 0x9F, 0x00, 0x30, 0x00, 0x1F,
+    0x00, 0x00, 0x42, 0x1F, 0x00, 0x0C, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x10, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x2A, 0x00, 0x01, 0x5F, 0x82, 0x00, 0x02, 0x1F, 0x82, 0x00, 0x04, 0x1F,
+    0x00, 0xC0, 0x60, 0x1F, 0x38, 0x4C, 0x04, 0x1F, 0x00, 0x00, 0x40, 0x1F,
+    0x00, 0x0C, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F,
+    // 0x16F 'ů'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0xC1, 0x00, 0x24, 0x01, 0x00, 0x80, 0x71,
+    0x00, 0x86, 0x01, 0x00, 0x40, 0x05, 0x00, 0x00, 0x11, 0x18, 0x00, 0x21,
+    0x04, 0x00, 0xA1, 0x04, 0x02, 0x05, 0x00, 0x30, 0x01, 0x28, 0x01, 0x01,
+    0x00, 0x10, 0x11, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x41, 0x80, 0x9F, 0x00, 0x30, 0x00, 0x1F,
+    0x00, 0x00, 0x42, 0x1F, 0x00, 0x0C, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x08, 0x40, 0x00, 0x1F, 0x04, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x01, 0x5F, 0x40, 0x00, 0x02, 0x1F, 0x10, 0x00, 0x04, 0x1F,
+    0x08, 0xC0, 0x60, 0x1F, 0x04, 0x4C, 0x04, 0x1F, 0x00, 0x00, 0x40, 0x1F,
+    0x20, 0x0C, 0x00, 0x1F, 0x40, 0x40, 0x00, 0x1F, 0x10, 0x40, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F,
+    // 0x171 'ű'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0xC1, 0x00, 0x24, 0x01, 0x00, 0x80, 0x71,
+    0x00, 0x86, 0x01, 0x0A, 0x40, 0x05, 0x00, 0x00, 0x11, 0x40, 0x00, 0x21,
+    0x40, 0x00, 0xA1, 0x04, 0x02, 0x05, 0x02, 0x30, 0x01, 0x24, 0x01, 0x01,
+    0x48, 0x10, 0x11, 0x50, 0x00, 0x21, 0x00, 0x00, 0x01,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x04, 0x00, 0x00, 0x41, 0x30, 0x01, 0x08, 0x00, 0x92, 0x02, 0x18,
+    0x80, 0x04, 0x82, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x61, 0x48, 0x00,
+    0x90, 0x80, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x70, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x40, 0x48, 0x3F,
+    0x00, 0x00, 0x90, 0x3F, 0x00, 0x01, 0x20, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x40, 0x24, 0x00, 0x3F,
+    0x10, 0x48, 0x04, 0x3F, 0x80, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x01, 0x80, 0x00, 0x3F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x05, 0x00, 0x10, 0x01, 0x00, 0x08, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x80, 0x15, 0x00, 0x02, 0x01, 0x04, 0x04, 0x01, 0x10, 0x58, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x08, 0x11, 0x40, 0x90, 0x25, 0x00, 0x20, 0x01,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x70, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x40, 0x48, 0x3F,
+    0x00, 0x00, 0x90, 0x3F, 0x00, 0x01, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x10, 0x24, 0x00, 0x3F,
+    0x00, 0x48, 0x04, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x01, 0x80, 0x00, 0x3F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x17, 0x00, 0x40, 0x07, 0x00, 0x20, 0x27, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x57, 0x00, 0x08, 0x07, 0x50, 0x10, 0x07, 0x91, 0x60, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x20, 0x47, 0x02, 0x40, 0x97, 0x00, 0x80, 0x07,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x38, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x20, 0x24, 0x1F,
+    0x60, 0x00, 0x48, 0x1F, 0x08, 0x00, 0x90, 0x1F, 0x24, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x12, 0x00, 0x1F,
+    0x00, 0x24, 0x02, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0xC0, 0x00, 0x1F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x05, 0x00, 0x10, 0x01, 0x00, 0x08, 0x09, 0x00, 0x00, 0x01,
+    0x70, 0x80, 0x15, 0x40, 0x02, 0x01, 0x10, 0x04, 0x01, 0x00, 0x58, 0x01,
+    0x04, 0x00, 0x01, 0x08, 0x08, 0x11, 0x40, 0x90, 0x25, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x3C0 'π'
+    0x00, 0x01, 0x10, 0x09, 0x50, 0x01, 0x00, 0x45, 0x02, 0x11, 0x10, 0x81,
+    0x04, 0x01, 0x00, 0x01, 0x00, 0xC5, 0x0C, 0x01, 0x01, 0xF1, 0x18, 0x01,
+    0x00, 0x11, 0x00, 0x19, 0xA0, 0x01, 0x00, 0x01,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x0C, 0x0F, 0x00, 0xC0, 0x2F, 0x04, 0x06, 0x0F, 0x10, 0x60, 0x0F,
+    0x24, 0x01, 0x0F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x20, 0x20, 0x4F, 0x20, 0x00, 0x4F, 0x04, 0x10, 0x0F, 0x18, 0x48, 0xAF,
+    0x40, 0x20, 0x0F, 0x28, 0x10, 0x8F, 0x00, 0x06, 0x0F,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x2018 '‘'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0x7F, 0x49, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x00, 0x7F, 0x45, 0x7F, 0x02, 0x7F, 0x84, 0x7F, 0x70, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x01, 0xFF, 0x04, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x50, 0x7F,
+    // 0x201B '‛'
+    0x38, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x42, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0x7F, 0x49, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    0x08, 0xFF, 0x20, 0xFF, 0x4E, 0x7F, 0x20, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x01, 0xFF, 0x44, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x70, 0x7F,
+    0x01, 0x7F, 0x04, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x50, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x01, 0xFF, 0x04, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x50, 0x7F,
+    0x01, 0x7F, 0x02, 0x7F, 0x01, 0x7F, 0x00, 0x7F, 0x48, 0x7F, 0x00, 0x7F,
+    // 0x201F '‟'
+    0x38, 0x7F, 0x02, 0x7F, 0x00, 0x7F, 0x42, 0xFF, 0x00, 0x7F, 0x30, 0x7F,
+    0x02, 0x7F, 0x01, 0x7F, 0x62, 0xFF, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x01, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x05, 0x00, 0xBF, 0x00, 0x0C, 0x3F,
+    0x01, 0xC0, 0x3F, 0x70, 0x0C, 0x3F, 0x01, 0x00, 0x3F, 0x30, 0x00, 0x3F,
+    0x05, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x07, 0x00, 0x3F,
+    // 0x2021 '‡'
+    0x00, 0x05, 0x07, 0x01, 0x05, 0x07, 0x05, 0x05, 0x07, 0x05, 0x00, 0x47,
+    0x00, 0x1C, 0x07, 0x01, 0x80, 0xF7, 0x70, 0x0C, 0x07, 0x01, 0x01, 0x07,
+    0x30, 0x05, 0x07, 0x05, 0x05, 0x07, 0x05, 0x00, 0x07, 0x07, 0x00, 0x07,
+    // 0x2022 '•'
+    0x1B, 0x47, 0x03, 0x07, 0x03, 0x03,
+    // 0x2026 '…'
+    0x37, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x07, 0x07,
+    0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x07, 0x17, 0x07,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x0A, 0x1F, 0x11, 0x1F, 0x04, 0x9F, 0x09, 0x5F, 0x00, 0x5F,
+    0x00, 0x1F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x00, 0x9F, 0x41, 0x5F, 0x02, 0x1F, 0x0C, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x03, 0x67, 0x10, 0x07, 0x22, 0x0F, 0x50, 0x0F, 0x00, 0x0F, 0x20, 0x07,
+    0x20, 0x97, 0x0C, 0x27, 0x40, 0x87, 0x08, 0x07,
+    // 0x2074 '⁴'
+    0x00, 0x07, 0x01, 0x47, 0x02, 0x47, 0x05, 0x47, 0x0A, 0x47, 0x14, 0x47,
+    0x28, 0x07, 0x5C, 0x07, 0x01, 0x47, 0x30, 0x47, 0x00, 0x07,
+    // 0x2075 '⁵'
+    0x00, 0x17, 0x00, 0x0F, 0x04, 0x0F, 0x60, 0x07, 0x18, 0x27, 0x22, 0x57,
+    0x24, 0x07, 0x20, 0x47, 0x20, 0x07, 0x40, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x07, 0x04, 0x07, 0x00, 0xC7, 0x02, 0x0F, 0x02, 0x0F, 0x52, 0x07,
+    0x00, 0x47, 0x20, 0x07, 0x01, 0xC7, 0x00, 0x07, 0x00, 0x07,
+    // 0x2077 '⁷'
+    0x00, 0x07, 0x48, 0x27, 0x10, 0x8F, 0x21, 0x27, 0x20, 0x87, 0x28, 0x07,
+    0x24, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x67, 0x01, 0x07, 0x24, 0xA7, 0x41, 0x0F, 0x20, 0x0F, 0x05, 0x07,
+    0x00, 0x57, 0x14, 0x07, 0x48, 0x07, 0x00, 0x07,
+    // 0x2079 '⁹'
+    0x00, 0x07, 0x00, 0x07, 0x1E, 0x0F, 0x01, 0x0F, 0x10, 0x27, 0x20, 0x17,
+    0x00, 0x07, 0x22, 0x07, 0x0C, 0x07, 0x01, 0x07, 0x00, 0x07,
+    // 0x2080 '₀'
+    0x03, 0x67, 0x00, 0x07, 0x22, 0x2F, 0x40, 0x0F, 0x00, 0x0F, 0x20, 0x27,
+    0x20, 0x97, 0x0C, 0x27, 0x00, 0x87, 0x08, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x17, 0x00, 0x07, 0x00, 0x27, 0x42, 0x07, 0x00, 0x27, 0x06, 0x07,
+    0x40, 0x07,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x07, 0x08, 0x07, 0x50, 0x27, 0x01, 0x07,
+    0x22, 0x87, 0x25, 0x07, 0x02, 0x07, 0x04, 0x07, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x17, 0x00, 0x0F, 0x20, 0x0F, 0x41, 0x0F, 0x20, 0x27, 0x21, 0x47,
+    0x08, 0x07, 0x05, 0x47, 0x30, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x47, 0x02, 0x47, 0x05, 0x47, 0x0A, 0x47, 0x14, 0x47,
+    0x28, 0x27, 0x5C, 0x07, 0x01, 0x47, 0x30, 0x47, 0x00, 0x07,
+    // 0x2085 '₅'
+    0x00, 0x17, 0x00, 0x0F, 0x04, 0x0F, 0x60, 0x0F, 0x18, 0x27, 0x00, 0x57,
+    0x04, 0x07, 0x02, 0x47, 0x00, 0x07, 0x40, 0x07,
+    // 0x2086 '₆'
+    0x00, 0x07, 0x04, 0x07, 0x00, 0xC7, 0x02, 0x0F, 0x02, 0x0F, 0x52, 0x0F,
+    0x05, 0x47, 0x20, 0x07, 0x01, 0xC7, 0x00, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x00, 0x07, 0x48, 0x27, 0x10, 0x8F, 0x21, 0x27, 0x20, 0x87, 0x28, 0x07,
+    0x34, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x67, 0x01, 0x07, 0x24, 0xAF, 0x41, 0x0F, 0x20, 0x0F, 0x05, 0x07,
+    0x00, 0x47, 0x11, 0x07, 0x48, 0x07, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x1F, 0x1E, 0x0F, 0x01, 0x0F, 0x50, 0x27, 0x20, 0x17,
+    0x00, 0x07, 0x20, 0x07, 0x0C, 0x07, 0x21, 0x07, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0xC8, 0x0F, 0x00, 0x6C, 0x0F,
+    0x01, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x01, 0x4A, 0x0F, 0x10, 0x48, 0x0F,
+    0x20, 0x48, 0x0F, 0x00, 0x48, 0x0F, 0x50, 0x48, 0x0F, 0x40, 0x40, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x8F, 0x18, 0x00, 0x4F,
+    0x44, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x50, 0x3F, 0x20, 0xFF, 0x0C, 0x7F, 0x03, 0xFF, 0x20, 0x3F, 0x00, 0x3F,
+    0x10, 0x3F, 0x40, 0xFF, 0x06, 0x7F, 0x36, 0x3F, 0x10, 0x3F, 0x60, 0x3F,
+    0x01, 0x3F, 0x0C, 0x3F, 0x20, 0xFF, 0x00, 0x7F, 0x20, 0xFF, 0x40, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x08, 0x07, 0x00, 0x18, 0x07, 0x00, 0x08, 0x07, 0x03, 0x08, 0x07,
+    0x40, 0x28, 0x07, 0x06, 0x08, 0x07, 0x60, 0x00, 0x97, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x08, 0x07, 0x00, 0x14, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x80, 0x07, 0x00, 0x40, 0x07, 0x04, 0x00, 0x07, 0x08, 0x00, 0x27,
+    0x04, 0x00, 0x07, 0x40, 0x00, 0x07, 0x80, 0x00, 0x47, 0x41, 0x08, 0x07,
+    0x01, 0x00, 0xA7, 0x01, 0x40, 0x07, 0x00, 0x04, 0x87, 0x00, 0x60, 0x07,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x20, 0x48, 0x07,
+    0x00, 0x88, 0x07, 0x41, 0x48, 0x07, 0x00, 0x88, 0x07, 0x04, 0x08, 0x37,
+    0x40, 0x08, 0x07, 0x04, 0x01, 0x27, 0x00, 0x02, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x07, 0x00, 0x28, 0x07, 0x00, 0x10, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x80, 0x07, 0x09, 0x00, 0x27, 0x10, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x90, 0x00, 0x47, 0x01, 0x08, 0x07, 0x01, 0x00, 0xA7, 0x01, 0x40, 0x07,
+    0x00, 0x04, 0x87, 0x00, 0x60, 0x07,
+    // 0x215B '⅛'
+    0x00, 0x08, 0x07, 0x00, 0x18, 0x07, 0x00, 0x08, 0x07, 0x03, 0x08, 0x07,
+    0x40, 0x28, 0x07, 0x06, 0x08, 0x17, 0x60, 0x00, 0x97, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x09, 0x07, 0x00, 0x10, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x80, 0x07, 0x01, 0x40, 0x07, 0x00, 0x80, 0x07, 0x08, 0x00, 0x07,
+    0x04, 0x02, 0x07, 0x48, 0x30, 0x87, 0x80, 0x8A, 0x47, 0x40, 0x54, 0x07,
+    0x01, 0x00, 0x47, 0x01, 0x81, 0xA7, 0x01, 0x6C, 0x07, 0x00, 0x01, 0x87,
+    0x00, 0x60, 0x07,
+    // 0x215C '⅜'
+    0x00, 0x18, 0x07, 0x00, 0x10, 0x07, 0x20, 0x10, 0x07, 0x13, 0x00, 0x07,
+    0x41, 0x08, 0x07, 0x24, 0x00, 0x07, 0x08, 0x10, 0x47, 0x45, 0x20, 0x87,
+    0x30, 0x00, 0x47, 0x00, 0x04, 0x07, 0x00, 0x0A, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x20, 0x07, 0x02, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x20, 0x02, 0x07, 0x00, 0x30, 0x87, 0xA0, 0x8A, 0x47,
+    0x00, 0x54, 0x07, 0x01, 0x00, 0x47, 0x01, 0x81, 0xA7, 0x01, 0x6C, 0x07,
+    0x00, 0x01, 0x87, 0x00, 0x60, 0x07,
+    // 0x215D '⅝'
+    0x00, 0x18, 0x07, 0x00, 0x10, 0x07, 0x04, 0x10, 0x07, 0x22, 0x08, 0x07,
+    0x4A, 0x28, 0x07, 0x40, 0x00, 0x07, 0x40, 0x00, 0x47, 0x42, 0x00, 0x07,
+    0x40, 0x00, 0x47, 0x00, 0x04, 0x07, 0x00, 0x02, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x20, 0x07, 0x02, 0x00, 0x07, 0x05, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x20, 0x02, 0x07, 0x10, 0x30, 0x87, 0xA0, 0x8A, 0x47,
+    0x00, 0x54, 0x07, 0x01, 0x00, 0x47, 0x01, 0x81, 0xA7, 0x01, 0x6C, 0x07,
+    0x00, 0x01, 0x87, 0x00, 0x60, 0x07,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x07, 0x20, 0x18, 0x07, 0x50, 0x00, 0x07, 0x41, 0x20, 0x07,
+    0x40, 0x00, 0x47, 0x41, 0x00, 0x97, 0x50, 0x00, 0x07, 0x48, 0x00, 0x87,
+    0x50, 0x08, 0x07, 0x00, 0x04, 0x07, 0x00, 0x40, 0x07, 0x00, 0xA0, 0x07,
+    0x00, 0x40, 0x07, 0x04, 0x00, 0x07, 0x02, 0x00, 0x07, 0x24, 0x00, 0x07,
+    0x40, 0x02, 0x07, 0xA0, 0x30, 0x87, 0x40, 0x8A, 0x47, 0x00, 0x54, 0x07,
+    0x01, 0x00, 0x47, 0x01, 0x81, 0xA7, 0x01, 0x6C, 0x07, 0x00, 0x01, 0x87,
+    0x00, 0x60, 0x07,
+    // 0x2190 '←'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x29, 0x0F, 0x52, 0xAF, 0x40, 0x2F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2192 '→'
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F, 0x52, 0xAF,
+    0x29, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x2194 '↔'
+    0x06, 0x0F, 0x09, 0x0F, 0x10, 0x8F, 0x29, 0x4F, 0x50, 0xAF, 0x20, 0x4F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x20, 0x6F, 0x50, 0xAF,
+    0x29, 0x4F, 0x10, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x3F, 0x0C, 0x0C, 0x3F, 0x14, 0x0A, 0x3F, 0x28, 0x05, 0x3F,
+    0x10, 0x02, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x02, 0x3F,
+    0x28, 0x05, 0x3F, 0x14, 0x0A, 0x3F, 0x0C, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D0 '⇐'
+    0x00, 0x0F, 0x00, 0x0F, 0x06, 0x0F, 0x00, 0x0F, 0x00, 0x2F, 0x30, 0xCF,
+    0x50, 0xAF, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x00, 0x0F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0x21D2 '⇒'
+    0x00, 0x0F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x50, 0xAF, 0x30, 0xCF, 0x00, 0x2F,
+    0x00, 0x0F, 0x06, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00,
+    // 0x21D4 '⇔'
+    0x06, 0x0F, 0x09, 0x0F, 0x16, 0x8F, 0x20, 0x4F, 0x50, 0xAF, 0x30, 0xCF,
+    0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x10, 0x8F, 0x30, 0xCF, 0x50, 0xAF,
+    0x20, 0x4F, 0x16, 0x8F, 0x09, 0x0F, 0x06, 0x0F,
+    // 0x2202 '∂'
+    0x00, 0x04, 0x23, 0x00, 0x10, 0x03, 0x10, 0x03, 0xC3, 0x10, 0x10, 0x03,
+    0x40, 0xA0, 0x13, 0x20, 0x00, 0x13, 0x20, 0x40, 0x0B, 0x00, 0x40, 0x03,
+    0x10, 0x40, 0x83, 0x04, 0x2C, 0x03, 0x20, 0x00, 0x83, 0x08, 0x04, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x9F, 0x00, 0x02, 0x1F, 0x00, 0x10, 0x9F,
+    0x00, 0x42, 0x1F, 0x02, 0x10, 0x1F, 0x08, 0x40, 0x1F, 0x02, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x20, 0x40, 0x1F, 0x0C, 0x08, 0x1F,
+    0x01, 0x01, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x20, 0x00, 0x00, 0x20, 0x00, 0x04, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF8, 0x20, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x40,
+    0x00, 0x00, 0x10, 0x00, 0x82, 0x00, 0x04, 0x44, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x04, 0x00, 0x10, 0x00, 0x00, 0x42, 0x00, 0x00, 0x30,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x18, 0x10, 0x00, 0x01, 0x03, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x41, 0x00, 0x02, 0x08, 0x00, 0x30, 0x40, 0x01, 0x02, 0x00,
+    0x08, 0x30, 0x00, 0xC1, 0x80, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x221E '∞'
+    0x0C, 0x7F, 0x01, 0x7F, 0x10, 0xFF, 0x20, 0x7F, 0x80, 0x7F, 0x20, 0xFF,
+    0x50, 0x7F, 0x22, 0x7F, 0x02, 0x7F, 0x05, 0x7F, 0x02, 0xFF, 0x20, 0x7F,
+    0xA0, 0x7F, 0x02, 0xFF, 0x40, 0x7F, 0x36, 0x7F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x3F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x4E, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    // 0x2260 '≠'
+    0x00, 0x0F, 0x01, 0x0F, 0x01, 0x6F, 0x01, 0x0F, 0x01, 0x0F, 0x00, 0x0F,
+    0x03, 0x0F, 0x05, 0x0F, 0x41, 0x0F, 0x61, 0x0F, 0x01, 0x0F, 0x18, 0x8F,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40,
+    0x08, 0x00, 0x00, 0xA0, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x50, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00,
+    0x14, 0x40, 0x01, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x05, 0x00, 0x02, 0x03,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xBF, 0xFF, 0xEF, 0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly26ItalicColOffsets[] PROGMEM = {
+    0x0, 0x1A, 0x32, 0x44, 0x74, 0xB0, 0xF5, 0x134, 0x13E, 0x16A, 0x196, 0x1A8,
+    0x1C0, 0x1CE, 0x1D6, 0x1DB, 0x208, 0x238, 0x256, 0x283, 0x2B0, 0x2DD, 0x307, 0x334,
+    0x35E, 0x388, 0x3B5, 0x3C3, 0x3DE, 0x3F6, 0x402, 0x41A, 0x435, 0x47D, 0x4B9, 0x4E9,
+    0x519, 0x552, 0x585, 0x5B5, 0x5E8, 0x62D, 0x651, 0x681, 0x6BD, 0x6EA, 0x738, 0x77A,
+    0x7B0, 0x7E0, 0x838, 0x86B, 0x895, 0x8C5, 0x8FE, 0x937, 0x988, 0x9C7, 0x9FD, 0xA2D,
+    0xA55, 0xA76, 0xAA2, 0xABA, 0xAC7, 0xACD, 0xAE9, 0xB13, 0xB27, 0xB51, 0xB67, 0xBB3,
+    0xBE9, 0xC16, 0xC2E, 0xC66, 0xC8D, 0xCA2, 0xCCE, 0xCEC, 0xD06, 0xD36, 0xD60, 0xD76,
+    0xD8C, 0xDAD, 0xDCB, 0xDE5, 0xE0D, 0xE2D, 0xE60, 0xE78, 0xEA0, 0xEB8, 0xEE0, 0xEEC,
+    0xF04, 0xF38, 0xF6B, 0xF8B, 0xFBE, 0xFE2, 0x101E, 0x1032, 0x104C, 0x106A, 0x107E, 0x1096,
+    0x10AC, 0x10BE, 0x10F1, 0x1124, 0x1128, 0x1136, 0x114A, 0x1164, 0x11AF, 0x11FA, 0x1248, 0x1263,
+    0x12B3, 0x1303, 0x1353, 0x13A3, 0x13DF, 0x142F, 0x147D, 0x14BD, 0x1501, 0x1545, 0x1589, 0x15BC,
+    0x15EC, 0x1620, 0x1654, 0x167B, 0x16B4, 0x170C, 0x1754, 0x179C, 0x17E4, 0x182C, 0x1874, 0x188A,
+    0x18C9, 0x1915, 0x1961, 0x19AD, 0x19F9, 0x1A29, 0x1A79, 0x1AA3, 0x1ACD, 0x1AF7, 0x1B21, 0x1B4B,
+    0x1B75, 0x1B9B, 0x1BB9, 0x1BDA, 0x1BFB, 0x1C1F, 0x1C43, 0x1C58, 0x1C73, 0x1C91, 0x1CAF, 0x1CD9,
+    0x1D06, 0x1D2D, 0x1D54, 0x1D7B, 0x1DA2, 0x1DC9, 0x1DE1, 0x1E01, 0x1E2E, 0x1E5B, 0x1E88, 0x1EB5,
+    0x1EF5, 0x1F39, 0x1F89, 0x1FB3, 0x1FF3, 0x2014, 0x2054, 0x207B, 0x20C7, 0x2100, 0x2144, 0x2165,
+    0x21A9, 0x21D0, 0x220C, 0x2230, 0x2260, 0x2284, 0x22B1, 0x22CF, 0x2327, 0x2354, 0x23AC, 0x23D9,
+    0x2421, 0x2449, 0x248D, 0x24B1, 0x24E9, 0x250D, 0x2549, 0x2570, 0x25B0, 0x25D4, 0x2620, 0x264D,
+    0x2699, 0x26C6, 0x26FC, 0x273C, 0x2760, 0x27A0, 0x27C4, 0x2804, 0x282B, 0x284B, 0x2884, 0x2891,
+    0x28AB, 0x28B7, 0x28C3, 0x28CF, 0x28D9, 0x28EF, 0x2905, 0x291D, 0x2931, 0x2952, 0x2976, 0x297C,
+    0x2992, 0x29A2, 0x29B2, 0x29C6, 0x29DC, 0x29F0, 0x2A06, 0x2A1A, 0x2A2E, 0x2A44, 0x2A58, 0x2A66,
+    0x2A7C, 0x2A8E, 0x2AA4, 0x2AB8, 0x2ACE, 0x2AE2, 0x2AF6, 0x2B0C, 0x2B2D, 0x2B4E, 0x2B84, 0x2BA5,
+    0x2BC6, 0x2BE7, 0x2C0B, 0x2C53, 0x2CA1, 0x2CEC, 0x2D3A, 0x2D88, 0x2DD3, 0x2DF3, 0x2E17, 0x2E37,
+    0x2E5B, 0x2E7B, 0x2E9F, 0x2EBF, 0x2ED7, 0x2EF7, 0x2F0F, 0x2F2F, 0x2F56, 0x2F89, 0x2FC5, 0x2FF5,
+    0x3028, 0x3048, 0x3080, 0x3098, 0x30B0, 0x30C8, 0x30E9, 0x310A, 0x312B, 0x314C, 0x316D, 0x318E,
+    0x31AF, 0x31D0, 0x31F1, 0x3212, 0x3233, 0x3254, 0x3275, 0x3296, 0x32B7, 0x32D8, 0x32F9, 0x331A,
+    0x333B, 0x335C, 0x337D
+};
+
+
 const SimpleGFXfont Bookerly26Italic PROGMEM = {Bookerly26ItalicBitmaps, Bookerly26ItalicBitmaps_lsb, Bookerly26ItalicBitmaps_msb, Bookerly26ItalicGlyphs,
-    315, 28};
+    315, 28,
+    nullptr, 0, FontStyle::REGULAR, Bookerly26ItalicGlyphIndexLatin1, Bookerly26ItalicGlyphRanges, 13,
+    Bookerly26ItalicBitmapsCol, Bookerly26ItalicBitmapsCol_lsb, Bookerly26ItalicBitmapsCol_msb, Bookerly26ItalicColOffsets};
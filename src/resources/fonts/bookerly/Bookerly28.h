@@ -5436,5 +5436,4902 @@ const SimpleGFXglyph Bookerly28Glyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly28GlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly28GlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly28BitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0x80, 0x1F, 0xE7, 0x00, 0x01, 0xC7, 0x00, 0x01, 0xC7, 0x3F, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xC1, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+    0x80, 0x7F, 0x80, 0x7F,
+    // 0x23 '#'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF9, 0xE7, 0xFF, 0xF9, 0xE4, 0x7F,
+    0xF9, 0xC0, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x27, 0xFF, 0x01, 0xE7, 0xFF,
+    0x39, 0xE7, 0xFF, 0xF9, 0xE0, 0x7F, 0xF9, 0x80, 0x7F, 0xF0, 0x03, 0xFF,
+    0x80, 0x67, 0xFF, 0x01, 0xE7, 0xFF, 0xF9, 0xE7, 0xFF, 0xF9, 0xEF, 0xFF,
+    0xFB, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0xFE, 0x07, 0x83, 0xFF,
+    0xFC, 0x03, 0xF1, 0xFF, 0xF8, 0xE3, 0xF9, 0xFF, 0xF9, 0xF1, 0xF9, 0xCF,
+    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xB1, 0xF8, 0xF9, 0xFF,
+    0xF9, 0xF8, 0xF1, 0xFF, 0xF8, 0xFC, 0x03, 0xFF, 0xF8, 0x3E, 0x07, 0xFF,
+    0xFC, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC7, 0xC7, 0xFF,
+    0xCF, 0xE3, 0xFF, 0xDF, 0xF3, 0xFF, 0xCF, 0xE7, 0xF3, 0xC7, 0xC7, 0xC3,
+    0xC0, 0x0F, 0x8F, 0xF0, 0x1E, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xF0, 0x1F,
+    0xE1, 0xE0, 0x0F, 0x87, 0xC3, 0xC7, 0x9F, 0xCF, 0xE7, 0xFF, 0x9F, 0xF7,
+    0xFF, 0x8F, 0xE7, 0xFF, 0xC7, 0xC7, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xFC, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC3, 0x07,
+    0xE0, 0x0F, 0xC7, 0xC0, 0x0F, 0xE7, 0x86, 0x07, 0xE7, 0x9F, 0xC1, 0xE7,
+    0x9F, 0xF0, 0xE7, 0x9F, 0x78, 0x67, 0x8C, 0x7C, 0x67, 0x80, 0xFE, 0x07,
+    0xC1, 0xCF, 0x07, 0xFF, 0xCF, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x07,
+    0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7,
+    // 0x27 '''
+    0xC1, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
+    0xF8, 0x3F, 0xC0, 0x7F, 0xE1, 0xFF, 0xF8, 0x3F, 0xC3, 0xFF, 0xFE, 0x1F,
+    0x8F, 0xFF, 0xFF, 0x1F, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF, 0x8F, 0xFF, 0xFF, 0x8F,
+    0xC7, 0xFF, 0xFE, 0x1F, 0xE1, 0xFF, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xCC, 0xFF, 0xC4, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF, 0x80, 0x3F,
+    0x82, 0x3F, 0xB3, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0x00, 0x07, 0x80, 0x0F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x2D '-'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xFF,
+    // 0x2E '.'
+    0xFF, 0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xC0, 0x78, 0x1F,
+    0x87, 0xFF, 0x0F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x8F, 0xFF, 0x8F, 0x83, 0xFE, 0x1F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF,
+    0xC7, 0xFF, 0xCF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    // 0x32 '2'
+    0xF3, 0xFF, 0x9F, 0xC1, 0xFF, 0x0F, 0xC1, 0xFE, 0x0F, 0x8F, 0xFC, 0x0F,
+    0x9F, 0xF8, 0x8F, 0x9F, 0xF0, 0x8F, 0x9F, 0xE1, 0x8F, 0x9F, 0xC3, 0x8F,
+    0x8F, 0x87, 0x8F, 0x80, 0x0F, 0x8F, 0x80, 0x3F, 0x8F, 0xC0, 0x7F, 0x8F,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0x8F, 0x9F, 0xC7,
+    0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x9F, 0x1F, 0x8F, 0x9F, 0x1F, 0x8F,
+    0x8C, 0x0F, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0xC0, 0x3F, 0xE1, 0xE0, 0x7F,
+    0xFF, 0xFB, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF1, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x08, 0xFF,
+    0xFE, 0x18, 0xFF, 0xF8, 0x38, 0xFF, 0xF0, 0xF8, 0xFF, 0xE1, 0xF8, 0xFF,
+    0x87, 0xF8, 0xFF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xE0, 0x3F, 0xCF, 0x80, 0x3F, 0xC7,
+    0x80, 0x3F, 0xCF, 0x9E, 0x3F, 0xCF, 0x9E, 0x3F, 0x8F, 0x9F, 0x1F, 0x8F,
+    0x9F, 0x0F, 0x1F, 0x9F, 0x00, 0x1F, 0x9F, 0x80, 0x3F, 0x9F, 0xC0, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x1E, 0x0F,
+    0xE1, 0x3F, 0x8F, 0xC3, 0x3F, 0xCF, 0xC7, 0x3F, 0xCF, 0x8F, 0x3F, 0xCF,
+    0x8F, 0x1F, 0xCF, 0x9F, 0x0F, 0x8F, 0x9F, 0x80, 0x1F, 0x9F, 0xC0, 0x1F,
+    0xBF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFC, 0x0F, 0x8F, 0xF0, 0x07, 0x8F, 0xC0, 0x1F, 0x8F, 0x01, 0xFF,
+    0x8E, 0x0F, 0xFF, 0x88, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFC, 0x7F, 0xF0, 0xF0, 0x1F, 0xC0, 0x60, 0x0F, 0x80, 0x03, 0x0F,
+    0x8E, 0x0F, 0xCF, 0x9F, 0x0F, 0xCF, 0x9F, 0x1F, 0xC7, 0x9F, 0x0F, 0xCF,
+    0x9F, 0x0F, 0xCF, 0x8E, 0x07, 0x8F, 0x80, 0x40, 0x1F, 0xC0, 0xE0, 0x1F,
+    0xE1, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xEF, 0xC0, 0x1F, 0xCF, 0xC0, 0x0F, 0xCF,
+    0x8F, 0x87, 0xCF, 0x9F, 0xC7, 0xCF, 0x9F, 0xE7, 0x8F, 0x9F, 0xE7, 0x1F,
+    0x9F, 0xE6, 0x1F, 0x8F, 0xE4, 0x3F, 0x83, 0xE0, 0x7F, 0xC0, 0x00, 0xFF,
+    0xE0, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0x8F, 0xE3, 0x0F, 0xE3, 0x0F, 0xE3, 0x9F, 0xE3,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFE, 0x1F, 0x0F, 0xE0, 0x3F,
+    0x0F, 0xE0, 0x7F, 0x1F, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xE2, 0x3F,
+    0xE6, 0x3F, 0xC7, 0x1F, 0xCF, 0x1F, 0x8F, 0x8F, 0x9F, 0xCF, 0x1F, 0xC7,
+    0xFF, 0xFF,
+    // 0x3D '='
+    0xFF, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+    0x39,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x9F, 0xC7, 0x8F, 0x8F, 0xCF, 0x8F, 0xC7, 0x9F,
+    0xE7, 0x1F, 0xE3, 0x3F, 0xF2, 0x3F, 0xF0, 0x7F, 0xF8, 0x7F, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0x3F '?'
+    0xCF, 0xFF, 0xFF, 0x8F, 0xE7, 0xFF, 0x8F, 0xC1, 0xC7, 0x8F, 0xC1, 0xC7,
+    0x8F, 0x87, 0xC7, 0x8F, 0x8F, 0xEF, 0xC7, 0x8F, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+    0xF8, 0x3F, 0x83, 0xFF, 0xF0, 0xFF, 0xE1, 0xFF, 0xE3, 0xFF, 0xF0, 0xFF,
+    0xE7, 0xFF, 0xF8, 0xFF, 0xC7, 0xFF, 0xFC, 0xFF, 0xCF, 0x1C, 0x3C, 0x7F,
+    0x8F, 0x18, 0x1E, 0x7F, 0x9E, 0x71, 0x1E, 0x7F, 0x9E, 0x73, 0x9E, 0x7F,
+    0x9E, 0x73, 0x9E, 0x7F, 0x9E, 0x73, 0x3E, 0x7F, 0x9E, 0x00, 0x3E, 0x7F,
+    0x9E, 0x00, 0x3E, 0x7F, 0x9F, 0x80, 0x1E, 0x7F, 0x8F, 0xFF, 0x9C, 0x7F,
+    0xCF, 0xFF, 0x9C, 0xFF, 0xC7, 0xFF, 0x18, 0xFF, 0xE3, 0xFF, 0x3F, 0xFF,
+    0xF0, 0xFC, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0xCF, 0xFE, 0x03, 0xCF, 0xF8, 0x03, 0xFF,
+    0xE0, 0x73, 0xFF, 0x83, 0xF3, 0xFF, 0x07, 0xF3, 0xFF, 0x00, 0xF3, 0xFF,
+    0xC0, 0x33, 0xEF, 0xF0, 0x03, 0xCF, 0xFE, 0x00, 0xCF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xEF,
+    // 0x42 'B'
+    0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF,
+    0x3F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x9F, 0x1F, 0x8F, 0x80, 0x0F, 0x8F,
+    0x80, 0x00, 0x1F, 0xE0, 0xC0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC3, 0xFE, 0x1F, 0x8F, 0xFF, 0x0F, 0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF,
+    0x0F, 0xFF, 0xCF, 0x81, 0xFF, 0x8F, 0x83, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x44 'D'
+    0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x9F, 0xFF, 0x8F,
+    0x8F, 0xFF, 0x9F, 0x87, 0xFF, 0x1F, 0xC3, 0xFE, 0x3F, 0xC0, 0x00, 0x3F,
+    0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0x45 'E'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0xCF, 0x03, 0xFF, 0x0F, 0x87, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F,
+    // 0x46 'F'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x8F, 0xCF, 0x1F, 0x8F, 0xCF,
+    0x1F, 0x8F, 0xCF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x03, 0x9F, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC3, 0xFE, 0x1F, 0x8F, 0xFF, 0x0F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xEF, 0xC7, 0x1F, 0xE7, 0xCF,
+    0x1F, 0xE7, 0xCF, 0x1F, 0xE7, 0xCF, 0x03, 0xE0, 0x0F, 0x83, 0xE0, 0x0F,
+    0x87, 0xE0, 0x1F, 0xFF, 0xE7, 0xFF,
+    // 0x48 'H'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xBF, 0x9F, 0xEF, 0x1F, 0x9F, 0xCF, 0x1F, 0x8F, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xCF,
+    0x3F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xBF, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFC, 0x7F, 0x1F, 0xFF, 0xF0, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x8F, 0xCF, 0x3F, 0x07, 0xCF,
+    0xFE, 0x03, 0xFF, 0xFC, 0x61, 0xFF, 0xF8, 0xF0, 0xFF, 0xB1, 0xF8, 0x7F,
+    0x23, 0xFC, 0x3F, 0x07, 0xFE, 0x1F, 0x07, 0xFF, 0x0F, 0x0F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x87, 0x3F, 0xFF, 0xC7, 0xBF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xBF, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x7F,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0x1F, 0xC0, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x03, 0xCF, 0x07, 0xFF, 0xCF, 0x01, 0xFF, 0xCF,
+    0x80, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xE0, 0x7F, 0xFF, 0x83, 0xFF, 0xEF, 0x03, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x0F, 0x3F, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF,
+    // 0x4E 'N'
+    0xBF, 0xFF, 0xEF, 0x3F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x83, 0xFF, 0xCF, 0xC1, 0xFF, 0xCF, 0xE0, 0xFF, 0xCF,
+    0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xBF, 0xF0, 0x7F, 0x3F, 0xF8, 0x3F, 0x1F, 0xFE, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+    0xC3, 0xFE, 0x1F, 0x8F, 0xFF, 0x0F, 0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x1F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xCF, 0x8F, 0xFF, 0x8F, 0x87, 0xFF, 0x1F, 0x81, 0xFC, 0x1F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFF, 0x9F, 0xFF,
+    // 0x50 'P'
+    0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xCF, 0xCF, 0x3F, 0xCF, 0xCF,
+    0x3F, 0xCF, 0xCF, 0x1F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFF, 0x8F, 0x1F, 0xFF,
+    0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFF, 0xC3, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF,
+    0x8F, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF,
+    0x1F, 0xFF, 0xC3, 0xFF, 0x1F, 0xFF, 0xC1, 0xFF, 0x1F, 0xFF, 0xC1, 0xFF,
+    0x1F, 0xFF, 0xC8, 0xFF, 0x8F, 0xFF, 0x8C, 0xFF, 0x87, 0xFF, 0x1C, 0x7F,
+    0xC1, 0xFC, 0x1C, 0x7F, 0xC0, 0x00, 0x3E, 0x7F, 0xE0, 0x00, 0x7E, 0x3F,
+    0xF8, 0x01, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0xCF, 0xCF, 0x3F, 0xCF, 0xCF,
+    0x1F, 0xC3, 0xFF, 0x1F, 0x81, 0xFF, 0x1F, 0x90, 0xFF, 0x86, 0x18, 0x3F,
+    0x80, 0x3C, 0x1F, 0xC0, 0x7E, 0x0F, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    // 0x53 'S'
+    0xFF, 0xFC, 0x1F, 0xE0, 0xFC, 0x0F, 0xC0, 0x7C, 0x0F, 0x80, 0x3F, 0x8F,
+    0x8E, 0x1F, 0xCF, 0x1F, 0x1F, 0xC7, 0x1F, 0x0F, 0xC7, 0x1F, 0x8F, 0xCF,
+    0x1F, 0x87, 0xCF, 0x1F, 0xC3, 0x8F, 0x83, 0xC0, 0x1F, 0x83, 0xE0, 0x3F,
+    0xC7, 0xF0, 0x7F,
+    // 0x54 'T'
+    0x83, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xEF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x1F, 0xFE, 0x0F, 0x3F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0x1F, 0xFF, 0x8F, 0x1F, 0xFE, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x10, 0x03, 0xFF, 0x3F, 0x00, 0xFF,
+    0xBF, 0xE0, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xC0, 0x3F, 0x3E, 0x01, 0xFF, 0x30, 0x0F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x3E, 0x00, 0x7F,
+    0x3F, 0xE0, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x1F,
+    0xFF, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0x81, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F, 0x3F, 0x80, 0x3F,
+    0x38, 0x01, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xEF, 0xBF, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0x8F,
+    0x07, 0xFE, 0x0F, 0x03, 0xFC, 0x0F, 0x01, 0xF8, 0x4F, 0x30, 0x61, 0xCF,
+    0x38, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x03, 0xFF,
+    0xF8, 0x60, 0xCF, 0x30, 0xF0, 0x4F, 0x03, 0xF8, 0x0F, 0x07, 0xFE, 0x0F,
+    0x0F, 0xFF, 0x0F, 0x1F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xEF, 0x10, 0x3F, 0xCF, 0x3C, 0x1F, 0xCF,
+    0xBE, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFE, 0x0F, 0xCF,
+    0x38, 0x3F, 0xCF, 0x10, 0x7F, 0xCF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x03, 0xFF, 0x0F, 0x03, 0xFC, 0x0F,
+    0x1F, 0xF8, 0x0F, 0x1F, 0xF0, 0xCF, 0x1F, 0xC1, 0xCF, 0x1F, 0x83, 0xCF,
+    0x1E, 0x0F, 0xCF, 0x1C, 0x1F, 0xCF, 0x10, 0x7F, 0xCF, 0x00, 0xFF, 0xCF,
+    0x03, 0xFF, 0xCF, 0x07, 0xFF, 0x0F, 0x8F, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F,
+    0x3F, 0xFF, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xBF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0x5D ']'
+    0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x03, 0xFF,
+    0x0F, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFC, 0x07, 0xFF, 0x87,
+    0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x60 '`'
+    0xFF, 0x87, 0x87, 0xE3, 0xF1, 0xF9, 0xFF,
+    // 0x61 'a'
+    0xFF, 0xC7, 0xC7, 0x83, 0x87, 0x01, 0x87, 0x31, 0x1E, 0x78, 0x3E, 0x79,
+    0x3E, 0x79, 0x1E, 0x79, 0x04, 0x63, 0x80, 0x01, 0x80, 0x01, 0xFF, 0xF1,
+    0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x9F, 0xF3, 0xFF, 0x3F, 0xF3,
+    0xFF, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3,
+    0xFE, 0x1F, 0xE3, 0xFF, 0x03, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xF0, 0xFF,
+    // 0x63 'c'
+    0xF8, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x87, 0xC1, 0x9F, 0xF1, 0x1F, 0xF1,
+    0x3F, 0xF9, 0x3F, 0xF9, 0x1F, 0xF9, 0x07, 0xF9, 0x87, 0xF9, 0xC7, 0xF3,
+    0xFF, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x0F, 0x83,
+    0xFF, 0x1F, 0xE3, 0xFE, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3, 0xFE, 0x7F, 0xF3,
+    0x9E, 0x3F, 0xF3, 0x9E, 0x3F, 0xE3, 0x80, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x8C, 0xE1, 0x9C, 0xF1, 0x3C, 0xF9,
+    0x3C, 0xF9, 0x3C, 0xF9, 0x1C, 0xF9, 0x84, 0xF9, 0x80, 0xF9, 0xC0, 0xF3,
+    0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFB, 0xFF, 0x3F, 0xF3, 0xFC, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x86, 0x3F, 0xF3, 0x1F, 0x3F, 0xF3,
+    0x3F, 0x3F, 0xF3, 0x3F, 0x3F, 0xFF, 0x1F, 0x3F, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0xC2, 0x07, 0xC0, 0x00, 0x07,
+    0x80, 0x00, 0xE7, 0x1E, 0x31, 0xE3, 0x3F, 0x39, 0xE3, 0x3F, 0x39, 0xE3,
+    0x3F, 0x39, 0xE3, 0x1F, 0x39, 0xE7, 0x8E, 0x39, 0xE7, 0x80, 0x79, 0xC7,
+    0x00, 0xF8, 0x8F, 0x31, 0xF8, 0x0F, 0x1F, 0xFC, 0x3F, 0x1F, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x9F, 0xF3, 0xFF, 0x3F, 0xF3,
+    0xFF, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFB,
+    0xFE, 0x0F, 0xF3, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFB, 0xFF, 0x3F, 0xF3, 0x8F, 0x00, 0x03,
+    0x0E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0xDF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x7F, 0xFF, 0xC7,
+    0xFF, 0x3F, 0xFF, 0x8F, 0x8F, 0x3F, 0xFF, 0x0F, 0x8E, 0x00, 0x00, 0x1F,
+    0x0E, 0x00, 0x00, 0x3F, 0x8E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0xF3, 0xFF, 0xF0, 0xF3,
+    0xFF, 0xE0, 0x7F, 0xFF, 0x64, 0x1F, 0xFF, 0x07, 0x0F, 0xFF, 0x0F, 0x87,
+    0xFF, 0x1F, 0xC3, 0xFF, 0x3F, 0xE3, 0xFF, 0x3F, 0xE3, 0xFF, 0x7F, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFB,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xFD, 0x9F, 0xF9, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0xCF, 0xF9, 0x9F, 0xF9, 0x9F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFD,
+    0x07, 0xF9, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0x8F, 0xF9, 0x9F, 0xFD,
+    0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFD, 0x0F, 0xF9, 0x80, 0x01, 0x80, 0x01,
+    0xE0, 0x01, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xFD, 0x9F, 0xF9, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0xCF, 0xF9, 0x9F, 0xF9, 0x9F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFD,
+    0x0F, 0xF9, 0x80, 0x01, 0x80, 0x01, 0xE0, 0x01, 0xFF, 0xF9, 0xFF, 0xF9,
+    0xFF, 0xFF,
+    // 0x6F 'o'
+    0xF8, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x87, 0xC1, 0x9F, 0xF1, 0x1F, 0xF9,
+    0x3F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF9, 0x1F, 0xF9, 0x8F, 0xF1, 0x80, 0x03,
+    0xC0, 0x07, 0xE0, 0x0F, 0xFC, 0x7F,
+    // 0x70 'p'
+    0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x8F, 0xF9, 0xE7, 0x9F, 0xF9, 0xE7,
+    0x1F, 0xF9, 0xF7, 0x1F, 0xF9, 0xFF, 0x1F, 0xF9, 0xFF, 0x1F, 0xF1, 0xFF,
+    0x07, 0xE3, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x87, 0xC1, 0xFF,
+    0x8F, 0xF1, 0xFF, 0x1F, 0xF9, 0xFF, 0x1F, 0xF9, 0xFF, 0x3F, 0xF9, 0xF7,
+    0x1F, 0xF1, 0xF7, 0x1F, 0xF3, 0xE7, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7,
+    // 0x72 'r'
+    0xFF, 0xFF, 0x9F, 0xFD, 0x9F, 0xF9, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0xE7, 0xF9, 0xCF, 0xF9, 0x9F, 0xF9, 0x1F, 0xFD, 0x1F, 0xFF, 0x0F, 0xFF,
+    0xBF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xFF, 0xC3, 0xC1, 0x80, 0xC1, 0x80, 0xF9, 0x38, 0x79, 0x3C, 0x78,
+    0x3C, 0x39, 0x1E, 0x39, 0x0E, 0x01, 0x87, 0x03, 0x8F, 0x87, 0xFF, 0xFF,
+    // 0x74 't'
+    0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xF9, 0xFF, 0x8F, 0xF9, 0xFF, 0x9F,
+    0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xFB, 0xFF, 0xBF,
+    // 0x75 'u'
+    0xBF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF, 0xF9, 0x9F, 0xF9, 0x9F, 0xF3,
+    0x80, 0x03, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9,
+    0xFF, 0xFF,
+    // 0x76 'v'
+    0xBF, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x90, 0x1F,
+    0xBC, 0x03, 0xBF, 0x81, 0xFF, 0xF1, 0xFF, 0xC1, 0xBE, 0x07, 0xB8, 0x1F,
+    0x80, 0x7F, 0x81, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0x77 'w'
+    0xBF, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0x90, 0x07,
+    0xBE, 0x01, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0x03, 0xF8, 0x1F, 0xC0, 0x7F,
+    0x81, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0xC1, 0xFF, 0xE1,
+    0xBF, 0x01, 0xB8, 0x0F, 0x80, 0x3F, 0x81, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF,
+    0xBF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFD, 0x9F, 0xF9, 0x9F, 0xF9, 0x8F, 0xF1, 0x87, 0xE1, 0x83, 0xC1,
+    0xB1, 0x89, 0xB8, 0x3F, 0xFC, 0x3F, 0xF8, 0x1D, 0xB1, 0x09, 0x83, 0xC1,
+    0x87, 0xE1, 0x8F, 0xF1, 0x9F, 0xF9, 0xBF, 0xF9, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xBF, 0xFF, 0xE7, 0x9F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x83, 0xFF, 0xE3,
+    0x80, 0x7F, 0xC7, 0x90, 0x1F, 0x87, 0xBC, 0x07, 0x0F, 0xBF, 0x80, 0x1F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xBE, 0x07, 0xFF, 0xB8, 0x1F, 0xFF,
+    0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xC7, 0xF1, 0x87, 0xE1, 0x8F, 0xC1, 0x9F, 0x81, 0x9E, 0x09,
+    0x9C, 0x39, 0x98, 0x79, 0x90, 0xF9, 0x83, 0xF9, 0x87, 0xF9, 0x8F, 0xE1,
+    0x9F, 0xC1, 0xFF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xF8, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x1F, 0x8F, 0x07, 0x07, 0x1F, 0x9F, 0xFF, 0xFF, 0x8F,
+    0x9F, 0xFF, 0xFF, 0xCF, 0xBF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCF, 0x9F, 0xFF, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xFF, 0x8F, 0x84, 0x06, 0x03, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
+    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xEF, 0x87, 0x8F, 0x1F, 0x1F, 0x9F, 0x8F, 0xCF, 0xC7, 0xC7, 0xC7, 0x8F,
+    0x9F, 0xFF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0x87, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF,
+    0xFC, 0xFF, 0xC7, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xFF,
+    0xFC, 0xFF, 0xE7, 0xFF, 0xFC, 0x7F, 0xE7, 0xFF, 0xFC, 0x1F, 0xC7, 0xFF,
+    0xFE, 0x1F, 0xCF, 0xFF, 0xFF, 0x7F, 0xDF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0x87, 0xFF, 0xCC, 0x0F,
+    0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xC0, 0x07, 0xCF, 0x83, 0xCF, 0xCF,
+    0x8F, 0xCF, 0xCF, 0x9F, 0xCF, 0xCF, 0x9F, 0xCF, 0xCF, 0x9F, 0x8F, 0xCF,
+    0x8F, 0xFF, 0xC7, 0x83, 0xFF, 0xCF, 0xC3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xBF, 0xEF, 0x3F, 0xE7, 0x98, 0xCF, 0xC0, 0x1F, 0xC0, 0x1F, 0xCF, 0x8F,
+    0x9F, 0xCF, 0x9F, 0xCF, 0x9F, 0xCF, 0x8F, 0x8F, 0xC7, 0x1F, 0xC0, 0x1F,
+    0x80, 0x0F, 0x1F, 0xC7, 0xBF, 0xEF, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x87, 0xBF, 0xFF,
+    0x81, 0x93, 0xFF, 0x80, 0x93, 0xEF, 0x90, 0x13, 0xCF, 0xBC, 0x03, 0xCF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x03, 0xCF,
+    0xBC, 0x13, 0xCF, 0x90, 0x13, 0xCF, 0x81, 0x93, 0xFF, 0x87, 0x9F, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFC, 0x1F, 0xEF, 0xF0, 0x07, 0xC3, 0xE0, 0xC3, 0xC3, 0xC0, 0xE3, 0xF3,
+    0x9C, 0x71, 0xF1, 0x9E, 0x38, 0xF9, 0x9F, 0x18, 0xFB, 0x9F, 0x1C, 0x73,
+    0x8F, 0x8E, 0x03, 0x87, 0xC7, 0x07, 0xC7, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0xFF, 0x9F, 0x9E, 0x03, 0xCF, 0x9C, 0x01, 0xCF,
+    0x38, 0xF9, 0xCF, 0x39, 0xFC, 0xEF, 0x3B, 0xFC, 0xE7, 0x3B, 0xFC, 0xE7,
+    0x39, 0xFC, 0xEF, 0x38, 0xFC, 0xCF, 0x9F, 0xFD, 0xCF, 0x9F, 0xFF, 0xCF,
+    0xCF, 0xFF, 0x9F, 0xC7, 0xFF, 0x3F, 0xE1, 0xFC, 0x7F, 0xF8, 0x00, 0xFF,
+    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xFF, 0xDC, 0x67, 0x88, 0x27, 0x1B, 0x27, 0x33, 0x27, 0x33, 0x67,
+    0x00, 0x67, 0x80, 0x27, 0xFF, 0x27, 0xFF, 0x7F,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x8F, 0x3F,
+    0x9F, 0x9F, 0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F,
+    0x8F, 0x3F, 0x9F, 0x9F, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE1, 0x87, 0xCF, 0xE7, 0x9F, 0xF3, 0xB7, 0xD9,
+    0x30, 0x19, 0x36, 0x5D, 0x36, 0x7D, 0x30, 0x39, 0xB9, 0x99, 0x9F, 0xDB,
+    0xCF, 0xF3, 0xC7, 0xC7, 0xF0, 0x0F, 0xFE, 0xFF,
+    // 0xB0 '°'
+    0xFF, 0xFF, 0xE0, 0xFF, 0x80, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F, 0x9F, 0x3F,
+    0x9E, 0x7F, 0x8C, 0x7F, 0x80, 0xFF, 0xE1, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFC, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0x80, 0x06, 0x7F, 0x80, 0x06, 0x7F,
+    0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFD, 0xFE, 0x7F,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xE7, 0xE7, 0xC3, 0xC3, 0x8F, 0x83, 0x9F, 0x03, 0x9E, 0x23,
+    0x9C, 0x63, 0x80, 0xE3, 0xC1, 0xE3, 0xE7, 0xE7, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xFF, 0xCF, 0xF3, 0xCF, 0xF3, 0x9C, 0xF3, 0x9C, 0xF3, 0x9C, 0xE3,
+    0x80, 0x67, 0x80, 0x07, 0xC6, 0x0F, 0xFF, 0xFF,
+    // 0xB5 'µ'
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0xBF, 0xC1, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xFB, 0xFF,
+    // 0xB6 '¶'
+    0xFE, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xFF, 0x8F, 0x0F, 0x0F, 0x9F,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xCF, 0xF3, 0xCF, 0xF3, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x67, 0x9E, 0x27, 0x3F, 0x27, 0x3F, 0x27,
+    0x3F, 0x27, 0x8E, 0x67, 0x80, 0x67, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0x9F, 0x9F, 0x8F, 0x3F, 0xC4, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0x8F, 0x3F, 0xC4, 0x3F, 0xE0, 0x7F,
+    0xF0, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xBC '¼'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xFB, 0xFF, 0xC0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xF3,
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xE1, 0xFE, 0x1F, 0x87, 0xFC, 0x1F, 0x9F, 0xF8, 0x1F,
+    0xFF, 0xE3, 0x9F, 0xFF, 0xC7, 0x9F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03,
+    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF,
+    // 0xBD '½'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xFB, 0xFF, 0xC0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFB, 0xFF, 0xFB, 0xF1,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0x8F, 0xC7, 0xC7, 0xBF, 0x87, 0x87,
+    0xFF, 0x9F, 0x07, 0xFF, 0x3E, 0x27, 0xFF, 0x3C, 0x67, 0xFF, 0x08, 0xE7,
+    0xFF, 0x81, 0xE7, 0xFF, 0xC3, 0xE7, 0xFF, 0xFF, 0xE7,
+    // 0xBE '¾'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xC7, 0xF9, 0xFF, 0xCE, 0x79, 0xFF,
+    0xCE, 0x71, 0xFF, 0xCC, 0x73, 0xFF, 0xC8, 0x63, 0xFF, 0xC0, 0x07, 0xFF,
+    0xE3, 0x07, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0x3F, 0x87, 0xFC, 0x1F,
+    0x9F, 0xF8, 0x1F, 0xFF, 0xF1, 0x9F, 0xFF, 0xC3, 0x9F, 0xFF, 0x87, 0x1F,
+    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC7, 0x0F,
+    0xFF, 0x87, 0x8F, 0x0F, 0x8F, 0xC7, 0x0E, 0x0F, 0xC7, 0x0C, 0x0F, 0xC7,
+    0x9F, 0x1F, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x81, 0x9F,
+    0x9F, 0xFC, 0x07, 0x9F, 0x8F, 0xF0, 0x07, 0xFF, 0x8F, 0xC0, 0xE7, 0xFF,
+    0xC7, 0x07, 0xE7, 0xFF, 0xE6, 0x0F, 0xE7, 0xFF, 0xE6, 0x01, 0xE7, 0xFF,
+    0xF7, 0x80, 0x67, 0xDF, 0xFF, 0xE0, 0x07, 0x9F, 0xFF, 0xFC, 0x01, 0x9F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x81, 0x9F,
+    0xFF, 0xFC, 0x07, 0x9F, 0xFF, 0xF0, 0x07, 0xFF, 0xE7, 0xC0, 0xE7, 0xFF,
+    0xE7, 0x07, 0xE7, 0xFF, 0xC6, 0x0F, 0xE7, 0xFF, 0x8E, 0x01, 0xE7, 0xFF,
+    0x8F, 0x80, 0x67, 0xDF, 0x9F, 0xE0, 0x07, 0x9F, 0xFF, 0xFC, 0x01, 0x9F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x81, 0x9F,
+    0xF3, 0xFC, 0x07, 0x9F, 0xE3, 0xF0, 0x07, 0xFF, 0x87, 0xC0, 0xE7, 0xFF,
+    0x8F, 0x07, 0xE7, 0xFF, 0x1E, 0x0F, 0xE7, 0xFF, 0x8E, 0x01, 0xE7, 0xFF,
+    0xC7, 0x80, 0x67, 0xDF, 0xE3, 0xE0, 0x07, 0x9F, 0xF7, 0xFC, 0x01, 0x9F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xEF, 0xFF, 0x81, 0x9F,
+    0x87, 0xFC, 0x07, 0x9F, 0x8F, 0xF0, 0x07, 0xFF, 0x9F, 0xC0, 0xE7, 0xFF,
+    0x8F, 0x07, 0xE7, 0xFF, 0xC6, 0x0F, 0xE7, 0xFF, 0xC6, 0x01, 0xE7, 0xFF,
+    0xC7, 0x80, 0x67, 0xDF, 0x87, 0xE0, 0x07, 0x9F, 0xDF, 0xFC, 0x01, 0x9F,
+    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0x9F, 0xFF, 0x03, 0x3F,
+    0x0F, 0xF8, 0x0F, 0x3F, 0x0F, 0xE0, 0x0F, 0xFF, 0x9F, 0x81, 0xCF, 0xFF,
+    0xFE, 0x0F, 0xCF, 0xFF, 0xFC, 0x1F, 0xCF, 0xFF, 0x9C, 0x03, 0xCF, 0xFF,
+    0x0F, 0x00, 0xCF, 0xBF, 0x0F, 0xC0, 0x0F, 0x3F, 0x9F, 0xF8, 0x03, 0x3F,
+    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xBF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xCF,
+    0xEF, 0xFE, 0x03, 0xCF, 0x83, 0xF8, 0x03, 0xFF, 0x81, 0xE0, 0x73, 0xFF,
+    0x39, 0x83, 0xF3, 0xFF, 0x39, 0x07, 0xF3, 0xFF, 0x81, 0x00, 0xF3, 0xFF,
+    0x83, 0xC0, 0x33, 0xEF, 0xE7, 0xF0, 0x03, 0xCF, 0xFF, 0xFE, 0x00, 0xCF,
+    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xEF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x4F, 0xFF, 0xC1, 0xCF,
+    0xFF, 0x03, 0xFF, 0xFE, 0x13, 0xFF, 0xB8, 0x73, 0xFF, 0x21, 0xF3, 0xEF,
+    0x03, 0xF3, 0xCF, 0x0F, 0xF3, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x07, 0x9F, 0x8F,
+    0x03, 0xFE, 0x0F, 0xFF, 0xFE, 0x1F,
+    // 0xC7 'Ç'
+    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFF, 0xC3, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF,
+    0x9F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x8D, 0xDF, 0x1F, 0xFF, 0xC9, 0x9F,
+    0x1F, 0xFF, 0xC0, 0x1F, 0x1F, 0xFF, 0xCC, 0x3F, 0x1F, 0xFF, 0xCE, 0x7F,
+    0x0F, 0xFF, 0xCF, 0xFF, 0x81, 0xFF, 0x8F, 0xFF, 0x83, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xFF, 0x9F, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F,
+    0x8E, 0x3F, 0x3F, 0x9F, 0xC6, 0x3F, 0x3F, 0x9F, 0xE6, 0x3F, 0x3F, 0x9F,
+    0xE6, 0x3F, 0x3F, 0x9F, 0xFE, 0x3F, 0x3F, 0x9F, 0xFE, 0x3F, 0x3F, 0x9F,
+    0xFE, 0x3F, 0x3F, 0x9F, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0x0F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x7F,
+    // 0xC9 'É'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xF6, 0x00, 0x00, 0x1F,
+    0xE6, 0x3F, 0x3F, 0x9F, 0xE6, 0x3F, 0x3F, 0x9F, 0xC6, 0x3F, 0x3F, 0x9F,
+    0x8E, 0x3F, 0x3F, 0x9F, 0x8E, 0x3F, 0x3F, 0x9F, 0x9E, 0x3F, 0x3F, 0x9F,
+    0xFE, 0x3F, 0x3F, 0x9F, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0x0F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x7F,
+    // 0xCA 'Ê'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F,
+    0x86, 0x3F, 0x3F, 0x9F, 0x8E, 0x3F, 0x3F, 0x9F, 0x1E, 0x3F, 0x3F, 0x9F,
+    0x8E, 0x3F, 0x3F, 0x9F, 0xC6, 0x3F, 0x3F, 0x9F, 0xE2, 0x3F, 0x3F, 0x9F,
+    0xF6, 0x3F, 0x3F, 0x9F, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0x0F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x7F,
+    // 0xCB 'Ë'
+    0xFE, 0xFF, 0xFF, 0xBF, 0xFC, 0x7F, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0x3F,
+    0x8C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F,
+    0x9C, 0x7E, 0x7F, 0x3F, 0xFC, 0x7E, 0x7F, 0x3F, 0xFC, 0x7E, 0x7F, 0x3F,
+    0x9C, 0x7E, 0x7F, 0x3F, 0x0C, 0x7E, 0x7F, 0x3F, 0x0C, 0x7E, 0x7F, 0x3F,
+    0x9C, 0x7E, 0x7F, 0x3F, 0xFC, 0x0F, 0xFC, 0x3F, 0xFE, 0x1F, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xF8, 0xFF,
+    // 0xCC 'Ì'
+    0x9F, 0x7F, 0xFF, 0xDF, 0x0E, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F, 0xE6, 0x00, 0x00, 0x1F,
+    0xF6, 0x3F, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xF6, 0x3F, 0xFF, 0x9F,
+    0xE6, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F,
+    0x8E, 0x3F, 0xFF, 0x9F, 0x0E, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x7F, 0xFF, 0xDF, 0xE2, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0x8E, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x1F,
+    0x8E, 0x00, 0x00, 0x1F, 0xC6, 0x3F, 0xFF, 0x9F, 0xE2, 0x7F, 0xFF, 0x9F,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0x9F, 0xFF, 0xFF, 0xFF, 0x8E, 0xFF, 0xFF, 0xBF, 0x0C, 0x7F, 0xFF, 0x3F,
+    0x9C, 0x7F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
+    0xDC, 0x00, 0x00, 0x3F, 0x8C, 0x7F, 0xFF, 0x3F, 0x0C, 0xFF, 0xFF, 0x3F,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0xBF, 0x9F, 0xEF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x3F, 0x9F, 0xCF,
+    0x3F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0x8F, 0x8F, 0xFF, 0x9F, 0x87, 0xFF, 0x1F, 0xC3, 0xFE, 0x3F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0x07, 0xFF, 0x9F,
+    0x87, 0x83, 0xFF, 0x9F, 0x8F, 0xC1, 0xFF, 0x9F, 0x9F, 0xF0, 0x7F, 0xFF,
+    0x8F, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
+    0xC7, 0xFF, 0xC3, 0xFF, 0x87, 0x7F, 0xE0, 0xFF, 0xDE, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0x1F, 0xFE, 0x1F,
+    0x9F, 0x3F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x8F,
+    0xC6, 0x7F, 0xFF, 0x8F, 0xE6, 0x7F, 0xFF, 0x8F, 0xE6, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x3F, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xFE, 0x3F,
+    0xFF, 0x03, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0x1F, 0xFE, 0x1F,
+    0xFF, 0x3F, 0xFF, 0x1F, 0xF6, 0x3F, 0xFF, 0x9F, 0xE6, 0x3F, 0xFF, 0x8F,
+    0xE6, 0x7F, 0xFF, 0x8F, 0xC6, 0x7F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0x9F,
+    0x8E, 0x3F, 0xFF, 0x9F, 0x9F, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xFE, 0x3F,
+    0xFF, 0x03, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0x1F, 0xFE, 0x1F,
+    0xF3, 0x3F, 0xFF, 0x1F, 0xC6, 0x3F, 0xFF, 0x9F, 0x86, 0x3F, 0xFF, 0x8F,
+    0x8E, 0x7F, 0xFF, 0x8F, 0x1E, 0x7F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0xE3, 0x1F, 0xFF, 0x1F, 0xF7, 0x0F, 0xFE, 0x3F,
+    0xFF, 0x03, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x3F, 0xCF, 0x1F, 0xFE, 0x1F,
+    0x87, 0x3F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFF, 0x9F, 0x9E, 0x3F, 0xFF, 0x8F,
+    0x8E, 0x7F, 0xFF, 0x8F, 0xC6, 0x7F, 0xFF, 0x8F, 0xC6, 0x3F, 0xFF, 0x9F,
+    0x86, 0x3F, 0xFF, 0x9F, 0x8F, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xFE, 0x3F,
+    0xFF, 0x03, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xF8, 0x7F, 0x8E, 0x3F, 0xFC, 0x3F,
+    0x0E, 0x7F, 0xFE, 0x3F, 0x0C, 0x7F, 0xFF, 0x3F, 0x9C, 0x7F, 0xFF, 0x1F,
+    0xFC, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x1F, 0x9C, 0x7F, 0xFF, 0x3F,
+    0x0C, 0x7F, 0xFF, 0x3F, 0x0E, 0x3F, 0xFE, 0x3F, 0x9E, 0x1F, 0xFC, 0x7F,
+    0xFE, 0x07, 0xF0, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0x1F, 0x1F, 0x8E, 0x3F, 0xC4, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF,
+    0xE0, 0xFF, 0xC4, 0x7F, 0x8E, 0x3F, 0x1F, 0x1F, 0xBF, 0xBF, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xCF, 0xF8, 0x00, 0x8F, 0xF0, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F, 0xC3, 0xFC, 0x1F, 0x8F, 0xF8, 0x0F, 0x9F, 0xF1, 0x8F,
+    0x1F, 0xE3, 0xCF, 0x1F, 0xC7, 0xC7, 0x3F, 0x8F, 0xC7, 0x3F, 0x1F, 0xC7,
+    0x1E, 0x3F, 0xCF, 0x1C, 0x7F, 0xCF, 0x08, 0xFF, 0x8F, 0x81, 0xFF, 0x1F,
+    0x81, 0xFC, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x18, 0x01, 0xFF,
+    0xBF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0x9E, 0x7F, 0xFF, 0x1F, 0x8F, 0x7F, 0xFF, 0x9F,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0x8F, 0xE7, 0xFF, 0xFF, 0x9F,
+    0xE7, 0xFF, 0xFF, 0x9F, 0xF7, 0xFF, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x1F,
+    0xFE, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0xFE, 0x7F, 0xFF, 0x1F, 0xFF, 0x7F, 0xFF, 0x9F,
+    0xE7, 0xFF, 0xFF, 0x9F, 0xE7, 0xFF, 0xFF, 0x8F, 0xC7, 0xFF, 0xFF, 0x9F,
+    0x8F, 0xFF, 0xFF, 0x9F, 0x8F, 0xFF, 0xFF, 0x9F, 0x9E, 0x3F, 0xFF, 0x1F,
+    0xFE, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0xF2, 0x7F, 0xFF, 0x1F, 0xE3, 0x7F, 0xFF, 0x9F,
+    0x87, 0xFF, 0xFF, 0x9F, 0x8F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0x9F,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0x9F, 0xE2, 0x3F, 0xFF, 0x1F,
+    0xF6, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0x9C, 0x7F, 0xF8, 0x3F, 0x0C, 0xFF, 0xFE, 0x3F, 0x0E, 0xFF, 0xFF, 0x3F,
+    0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x9F, 0xFF, 0xFF, 0x3F, 0x0F, 0xFF, 0xFF, 0x3F, 0x0C, 0x7F, 0xFE, 0x3F,
+    0x9C, 0x7F, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xBF, 0xFF, 0xEF, 0x3F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x33, 0xFC, 0xCF, 0x33, 0xFC, 0xCF,
+    0xF3, 0xFC, 0xFF, 0xF1, 0xFC, 0xFF, 0xF1, 0xF8, 0xFF, 0xF8, 0xF1, 0xFF,
+    0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xF8, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xC3, 0x3F, 0xCF, 0xE3, 0x3F, 0x03, 0xF3, 0x1E, 0x01, 0xF1,
+    0x0C, 0x71, 0xF3, 0x80, 0xF0, 0xF3, 0xC1, 0xF8, 0x03, 0xF7, 0xFC, 0x07,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xC1, 0xFF, 0xCF, 0xC3, 0x80, 0xFF,
+    0x87, 0xC3, 0x98, 0xFF, 0xC3, 0x8F, 0x3C, 0x7F, 0xE3, 0x9F, 0x3C, 0xFF,
+    0xF1, 0x9F, 0x3C, 0xFF, 0xF9, 0x8F, 0x3C, 0xFF, 0xFF, 0x82, 0x31, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xC7, 0x83, 0xFF, 0x87, 0x01, 0xFF, 0x87, 0x31,
+    0xFF, 0x1E, 0x78, 0xF3, 0x3E, 0x79, 0xC3, 0x3E, 0x79, 0x87, 0x1E, 0x79,
+    0x0F, 0x04, 0x63, 0x9F, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xC7, 0x83, 0xF9, 0x87, 0x01, 0xE3, 0x87, 0x31,
+    0xC3, 0x1E, 0x78, 0x8F, 0x3E, 0x79, 0x8F, 0x3E, 0x79, 0x87, 0x1E, 0x79,
+    0xC3, 0x04, 0x63, 0xE1, 0x80, 0x01, 0xFB, 0x80, 0x01, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0x8F, 0xFF, 0x8F, 0x07, 0x8F, 0x0E, 0x03, 0x8F, 0x0E, 0x63,
+    0x1E, 0x3C, 0xF1, 0x9E, 0x7C, 0xF3, 0xCE, 0x7C, 0xF3, 0xC6, 0x3C, 0xF3,
+    0xC6, 0x08, 0xC7, 0x8F, 0x00, 0x03, 0x9F, 0x00, 0x03, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0x1F, 0x9F, 0x1E, 0x0F, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0xC7,
+    0x9C, 0x79, 0xE3, 0xFC, 0xF9, 0xE7, 0xFC, 0xF9, 0xE7, 0x9C, 0x79, 0xE7,
+    0x0C, 0x11, 0x8F, 0x0E, 0x00, 0x07, 0x9E, 0x00, 0x07, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xC1, 0xFF, 0xFF, 0xC3, 0x80, 0xFF,
+    0xC1, 0xC3, 0x98, 0xFF, 0x80, 0x8F, 0x3C, 0x7F, 0x9C, 0x9F, 0x3C, 0xFF,
+    0x9C, 0x9F, 0x3C, 0xFF, 0x88, 0x8F, 0x3C, 0xFF, 0xC1, 0x82, 0x31, 0xFF,
+    0xE3, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xC7, 0xC7, 0x83, 0x87, 0x01, 0x87, 0x31, 0x1E, 0x78, 0x3E, 0x79,
+    0x3E, 0x79, 0x1E, 0x79, 0x04, 0x73, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x01,
+    0x8C, 0xF1, 0x1C, 0xF1, 0x3C, 0xF9, 0x3C, 0xF8, 0x1C, 0xF9, 0x0C, 0xF9,
+    0x80, 0xF9, 0xC0, 0xF1, 0xF1, 0xFF,
+    // 0xE7 'ç'
+    0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x87, 0xC1, 0xFF,
+    0x9F, 0xF1, 0xFF, 0x1F, 0xF1, 0xBB, 0x3F, 0xF9, 0x33, 0x3F, 0xF9, 0x03,
+    0x1F, 0xF9, 0x87, 0x07, 0xF9, 0xDF, 0x87, 0xF9, 0xFF, 0xC7, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xCF, 0xC6, 0x70, 0xFF, 0x87, 0xCE, 0x78, 0xFF, 0xC3, 0x9E, 0x7C, 0xFF,
+    0xF1, 0x9E, 0x7C, 0xFF, 0xF9, 0x9E, 0x7C, 0xFF, 0xFF, 0x8E, 0x7C, 0xFF,
+    0xFF, 0xC2, 0x7C, 0xFF, 0xFF, 0xC0, 0x7C, 0xFF, 0xFF, 0xE0, 0x79, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x8C, 0xE1,
+    0xFF, 0x9C, 0xF1, 0xFB, 0x3C, 0xF9, 0xE3, 0x3C, 0xF9, 0xC3, 0x3C, 0xF9,
+    0x07, 0x1C, 0xF9, 0x0F, 0x84, 0xF9, 0xBF, 0x80, 0xF9, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xF1, 0x8C, 0xE1,
+    0xE3, 0x9C, 0xF1, 0x87, 0x3C, 0xF9, 0x8F, 0x3C, 0xF9, 0x8F, 0x3C, 0xF9,
+    0x87, 0x1C, 0xF9, 0xE3, 0x84, 0xF9, 0xF3, 0x80, 0xF9, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x1F, 0x9F, 0x00, 0x0F, 0x0E, 0x33, 0x87,
+    0x1E, 0x73, 0xC7, 0xBC, 0xF3, 0xE7, 0xFC, 0xF3, 0xE7, 0xFC, 0xF3, 0xE7,
+    0x9C, 0x73, 0xE7, 0x0E, 0x13, 0xE7, 0x1E, 0x03, 0xE7, 0xBF, 0x03, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0x87, 0xCF, 0xFE, 0x87, 0xCF, 0xFC, 0xE3, 0xC0, 0x00,
+    0xF1, 0x80, 0x00, 0xF9, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFC,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFD, 0xFF, 0x9F, 0xF9, 0xF3, 0x80, 0x01,
+    0xE3, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xF9,
+    // 0xEE 'î'
+    0xFB, 0xFF, 0xFF, 0xF1, 0x9F, 0xFD, 0xC3, 0x9F, 0xF9, 0x87, 0x80, 0x01,
+    0x8F, 0x00, 0x01, 0x8F, 0x00, 0x01, 0xC7, 0xFF, 0xF9, 0xE3, 0xFF, 0xF9,
+    0xF3, 0xFF, 0xF9,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0E, 0x7F, 0xF7, 0x1E, 0x7F, 0xE7,
+    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0x1F, 0xFF, 0xE7,
+    0x0F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x87, 0xC1,
+    0x99, 0x8F, 0xF1, 0x83, 0x1F, 0xF9, 0xC7, 0x1F, 0xF8, 0xC7, 0x1F, 0xF8,
+    0xC3, 0x9F, 0xF9, 0x90, 0x9F, 0xF9, 0x98, 0x0F, 0xF1, 0xBE, 0x01, 0x83,
+    0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFB, 0xFF, 0x3F, 0xF3, 0xFF, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xCE, 0x00, 0x03, 0x87, 0x9F, 0xF3, 0x1F, 0x3F, 0xF3,
+    0x9F, 0x3F, 0xFF, 0x8E, 0x3F, 0xFF, 0xC6, 0x3F, 0xFF, 0xC6, 0x3F, 0xFB,
+    0x86, 0x1F, 0xF3, 0x8F, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xCF, 0xC3, 0xE0, 0xFF, 0x87, 0xCF, 0xF8, 0xFF, 0xC3, 0x8F, 0xFC, 0xFF,
+    0xE3, 0x9F, 0xFC, 0x7F, 0xF1, 0x9F, 0xFC, 0x7F, 0xF9, 0x8F, 0xFC, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xC7, 0xF8, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x87, 0xC1,
+    0xFF, 0x9F, 0xF1, 0xFF, 0x1F, 0xF9, 0xF3, 0x3F, 0xF8, 0xE3, 0x3F, 0xF8,
+    0x87, 0x1F, 0xF9, 0x0F, 0x1F, 0xF9, 0x9F, 0x8F, 0xF1, 0xFF, 0x80, 0x03,
+    0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x7F,
+    // 0xF4 'ô'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFB, 0x87, 0xC1,
+    0xE1, 0x9F, 0xF1, 0xC3, 0x1F, 0xF9, 0x87, 0x3F, 0xF8, 0x8F, 0x3F, 0xF8,
+    0x8F, 0x1F, 0xF9, 0xC3, 0x1F, 0xF9, 0xE3, 0x8F, 0xF1, 0xFB, 0x80, 0x03,
+    0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x7F,
+    // 0xF5 'õ'
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0x8F, 0x0F, 0x83,
+    0x8F, 0x3F, 0xE3, 0x1E, 0x3F, 0xF3, 0x9E, 0x7F, 0xF1, 0x8E, 0x7F, 0xF1,
+    0xC6, 0x3F, 0xF3, 0xC6, 0x3F, 0xF3, 0x8F, 0x1F, 0xE3, 0x9F, 0x00, 0x07,
+    0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x0F, 0x1E, 0x1F, 0x07,
+    0x0E, 0x7F, 0xC7, 0x1C, 0x7F, 0xE7, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
+    0xFC, 0x7F, 0xE7, 0x1C, 0x7F, 0xE7, 0x0E, 0x3F, 0xC7, 0x9E, 0x00, 0x0F,
+    0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xF1, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x98, 0xCF,
+    0x08, 0x87, 0x18, 0xC7, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xF8, 0x19, 0xE0, 0x01, 0xC0, 0x03, 0x87, 0xC1, 0x9F, 0x81,
+    0x1F, 0x19, 0x3E, 0x38, 0x3C, 0x78, 0x18, 0xF9, 0x11, 0xF9, 0x83, 0xF1,
+    0x81, 0xC3, 0x80, 0x07, 0x00, 0x0F, 0xBC, 0x7F, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x87, 0x80, 0x00, 0xFF,
+    0x87, 0xFF, 0xFC, 0xFF, 0xC3, 0xFF, 0xFC, 0x7F, 0xF1, 0xFF, 0xFC, 0xFF,
+    0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0xFB, 0xFF, 0xF8,
+    0xE3, 0xFF, 0xF9, 0xC7, 0xFF, 0xF9, 0x07, 0x9F, 0xF9, 0x8F, 0x9F, 0xF3,
+    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x00, 0x03,
+    0xFB, 0x00, 0x01, 0xF1, 0x00, 0x01, 0xC3, 0xFF, 0xF9, 0x87, 0xFF, 0xF8,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x87, 0x9F, 0xF9, 0xE3, 0x9F, 0xF3,
+    0xF3, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFE, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFC, 0x00, 0x0F,
+    0x9C, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0x1E, 0x7F, 0xE7, 0x0E, 0x7F, 0xCF,
+    0x1E, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xEF, 0x9F, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x9F, 0xF3, 0xCF, 0xFF, 0x3F, 0xF3, 0xCF, 0xFE, 0x3F, 0xF3, 0xEF,
+    0xFE, 0x3F, 0xF3, 0xFF, 0xFE, 0x3F, 0xF3, 0xFF, 0xFE, 0x3F, 0xE3, 0xFF,
+    0xFE, 0x1F, 0xC7, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFE, 0xFF, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x8F, 0xFE, 0x3F, 0xFF, 0x8F,
+    0x9E, 0x0F, 0xFF, 0x8F, 0x0E, 0x01, 0xFF, 0x1F, 0x0E, 0x40, 0x7E, 0x1F,
+    0x9E, 0xF0, 0x1C, 0x3F, 0xFE, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF,
+    0x9F, 0xFF, 0x03, 0xFF, 0x0E, 0xF8, 0x1F, 0xFF, 0x0E, 0xE0, 0x7F, 0xFF,
+    0x9E, 0x01, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xCF, 0xFF,
+    0xFE, 0x03, 0xCF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x73, 0xFF, 0xFF,
+    0x83, 0xF3, 0xFF, 0xFF, 0x07, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF,
+    0xC0, 0x33, 0xEF, 0xFF, 0xF0, 0x03, 0xCC, 0xFF, 0xFE, 0x00, 0xC8, 0x7F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x06, 0x3F, 0xFF, 0xFE, 0x07, 0x3F,
+    0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xCF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xC7, 0xFF, 0xC7, 0x83, 0xFF, 0x87, 0x01, 0xFF, 0x87, 0x31, 0xFF,
+    0x1E, 0x78, 0xFF, 0x3E, 0x79, 0xFF, 0x3E, 0x79, 0xFF, 0x1E, 0x79, 0xFF,
+    0x04, 0x63, 0xDF, 0x80, 0x03, 0x0F, 0x80, 0x00, 0x07, 0xFF, 0xF0, 0xC7,
+    0xFF, 0xF9, 0xE7, 0xFF, 0xF9, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0x1F, 0xFE, 0x1F,
+    0xFF, 0x3F, 0xFF, 0x1F, 0xF6, 0x3F, 0xFF, 0x1F, 0xE6, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x8F, 0xC6, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x9F,
+    0x0E, 0x1F, 0xFF, 0x9F, 0xFF, 0x03, 0xFF, 0x1F, 0xFF, 0x07, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x107 'ć'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x87, 0xC1,
+    0xFF, 0x9F, 0xF1, 0xFF, 0x1F, 0xF1, 0xE3, 0x3F, 0xF9, 0xC3, 0x3F, 0xF9,
+    0x07, 0x1F, 0xF9, 0x0F, 0x07, 0xF9, 0xBF, 0x87, 0xF9, 0xFF, 0xC7, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xBF, 0x87, 0xFC, 0x3F, 0x1F, 0x1F, 0xFE, 0x1F,
+    0x8F, 0x3F, 0xFF, 0x1F, 0xC6, 0x3F, 0xFF, 0x1F, 0xE2, 0x3F, 0xFF, 0x9F,
+    0xE2, 0x3F, 0xFF, 0x8F, 0xC6, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x9F,
+    0x1E, 0x1F, 0xFF, 0x9F, 0x3F, 0x03, 0xFF, 0x1F, 0xFF, 0x07, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x10D 'č'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xBF, 0xC0, 0x03, 0x0F, 0x87, 0xC1,
+    0x87, 0x9F, 0xF1, 0xC3, 0x1F, 0xF1, 0xF3, 0x3F, 0xF9, 0xE3, 0x3F, 0xF9,
+    0x87, 0x1F, 0xF9, 0x8F, 0x07, 0xF9, 0x3F, 0x87, 0xF9, 0xFF, 0xC7, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFF, 0x3F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x9F,
+    0xBE, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F,
+    0xC6, 0x7F, 0xFF, 0x9F, 0xE2, 0x7F, 0xFF, 0x9F, 0xE2, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x9F, 0x1F, 0x3F, 0xFF, 0x1F,
+    0x3F, 0x1F, 0xFF, 0x3F, 0xFF, 0x0F, 0xFE, 0x3F, 0xFF, 0x87, 0xFC, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x0F, 0x83,
+    0xFF, 0x1F, 0xE3, 0xFE, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3, 0xFE, 0x7F, 0xF3,
+    0x9E, 0x3F, 0xF3, 0x9E, 0x3F, 0xE3, 0x80, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xBF, 0xFF, 0xEF, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
+    0x1F, 0x9F, 0xCF, 0xFF, 0x1F, 0x9F, 0xCF, 0xFF, 0x1F, 0x9F, 0xCE, 0xFF,
+    0x1F, 0x9F, 0xC8, 0x7F, 0x1F, 0x9F, 0xC0, 0x3F, 0x1F, 0x9F, 0xC2, 0x3F,
+    0x1F, 0x9F, 0xC7, 0x3F, 0x03, 0xFF, 0x0F, 0x3F, 0x87, 0xFC, 0x0F, 0x7F,
+    0xFF, 0xFE, 0x3F, 0xFF,
+    // 0x119 'ę'
+    0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x8C, 0xE1, 0xFF,
+    0x9C, 0xF1, 0xFF, 0x3C, 0xF9, 0xFF, 0x3C, 0xF9, 0x9F, 0x3C, 0xF8, 0x0F,
+    0x1C, 0xF8, 0x07, 0x84, 0xF8, 0xE7, 0x80, 0xF9, 0xE7, 0xC0, 0xF3, 0xEF,
+    0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0x1E, 0x00, 0x00, 0x1F, 0x0E, 0x00, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F,
+    0xC6, 0x3F, 0x3F, 0x9F, 0xE2, 0x3F, 0x3F, 0x9F, 0xC2, 0x3F, 0x3F, 0x9F,
+    0x86, 0x3F, 0x3F, 0x9F, 0x8E, 0x3F, 0x3F, 0x9F, 0x1E, 0x3F, 0x3F, 0x9F,
+    0xBE, 0x3F, 0x3F, 0x9F, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0x0F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x7F,
+    // 0x11B 'ě'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xBF, 0xC0, 0x03, 0x0F, 0x8C, 0xE1,
+    0x87, 0x9C, 0xF1, 0xE3, 0x3C, 0xF9, 0xF3, 0x3C, 0xF9, 0xE3, 0x3C, 0xF9,
+    0x87, 0x1C, 0xF9, 0x8F, 0x84, 0xF9, 0x3F, 0x80, 0xF9, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x3F, 0xFF, 0x9F, 0xF6, 0x3F, 0xFF, 0x9F,
+    0xE6, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F,
+    0x8E, 0x3F, 0xFF, 0x9F, 0x0E, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0x3F, 0xFF, 0xE7, 0xE7, 0x3F, 0xFF, 0xE7,
+    0xE6, 0x00, 0x00, 0x07, 0xC6, 0x00, 0x00, 0x07, 0xC6, 0x00, 0x00, 0x07,
+    0x8F, 0xFF, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF7,
+    // 0x13D 'Ľ'
+    0xEF, 0xFF, 0xFB, 0xC7, 0xFF, 0xF3, 0xC7, 0xFF, 0xF3, 0xC0, 0x00, 0x03,
+    0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC7, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFB, 0xFF, 0xF3, 0x01, 0xFF, 0xF3,
+    0x87, 0xFF, 0xE3, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x9F,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xE1, 0xFF, 0xFB, 0x01, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xBF, 0xE7, 0xEF, 0x1F, 0xE7, 0xCF,
+    0x1F, 0xCF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x3F, 0xCF, 0x3F, 0x3F, 0xCF, 0xFE, 0x7F, 0xCF, 0xFE, 0x7F, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x7F,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFB, 0x9F, 0xF9, 0xF3, 0x9F, 0xF3, 0xF3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x9F, 0xF3,
+    0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xFB, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x07, 0xFF, 0x9F,
+    0xFF, 0x83, 0xFF, 0x9F, 0xFF, 0xC1, 0xFF, 0x9F, 0xE7, 0xF0, 0x7F, 0xFF,
+    0xE7, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0x07, 0xFF,
+    0x8F, 0xFF, 0xC3, 0xFF, 0x9F, 0x7F, 0xE0, 0xFF, 0xFE, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFD, 0xFF, 0x9F, 0xF9, 0xFF, 0x80, 0x01,
+    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xCF, 0xF9, 0xFF, 0x9F, 0xF9,
+    0xF3, 0x9F, 0xFF, 0xE3, 0x1F, 0xFF, 0x87, 0x1F, 0xFF, 0x0F, 0x1F, 0xFD,
+    0x9F, 0x0F, 0xF9, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xBF, 0x07, 0xFF, 0x9F,
+    0x1F, 0x83, 0xFF, 0x9F, 0x8F, 0xC1, 0xFF, 0x9F, 0xC7, 0xF0, 0x7F, 0xFF,
+    0xE3, 0xF8, 0x3F, 0xFF, 0xE3, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
+    0x8F, 0xFF, 0xC3, 0xFF, 0x1F, 0x7F, 0xE0, 0xFF, 0x3E, 0x7F, 0xF0, 0x7F,
+    0xFE, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFD, 0xFF, 0x9F, 0xF9, 0xFF, 0x80, 0x01,
+    0xFF, 0x00, 0x01, 0x9F, 0x00, 0x01, 0x8F, 0xCF, 0xF9, 0xC7, 0x9F, 0xF9,
+    0xE3, 0x9F, 0xFF, 0xF3, 0x1F, 0xFF, 0xC3, 0x1F, 0xFF, 0x87, 0x1F, 0xFD,
+    0x1F, 0x0F, 0xF9, 0x3F, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC3, 0xFE, 0x1F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0x8F,
+    0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x07, 0x9F, 0x8F, 0x03, 0xFE, 0x0F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xF8, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x87, 0xC1, 0x9F, 0xF1, 0x1F, 0xF8,
+    0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF9, 0x1F, 0xF1, 0x87, 0xE1, 0xC0, 0x03,
+    0xE0, 0x07, 0xC0, 0x03, 0x8C, 0xE1, 0x9C, 0xF1, 0x3C, 0xF9, 0x3C, 0xF9,
+    0x3C, 0xF9, 0x1C, 0xF9, 0x80, 0xF9, 0x80, 0xF9, 0xC0, 0xF3, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0x7F, 0xFF, 0xDF, 0xFF, 0x3F, 0xFF, 0x9F, 0xBF, 0x3F, 0xFF, 0x9F,
+    0x1E, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x1F, 0xC6, 0x00, 0x00, 0x1F,
+    0xE2, 0x7F, 0x9F, 0x9F, 0xE2, 0x7F, 0x9F, 0x9F, 0xC6, 0x3F, 0x87, 0xFF,
+    0x8E, 0x3F, 0x03, 0xFF, 0x1E, 0x3F, 0x21, 0xFF, 0x3F, 0x0C, 0x30, 0x7F,
+    0xFF, 0x00, 0x78, 0x3F, 0xFF, 0x80, 0xFC, 0x1F, 0xFF, 0xE1, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFD, 0x9F, 0x9F, 0xF9, 0x8F, 0x80, 0x01,
+    0xC7, 0x00, 0x01, 0xE3, 0x00, 0x01, 0xE3, 0xE7, 0xF9, 0xC3, 0xCF, 0xF9,
+    0x8F, 0x9F, 0xF9, 0x1F, 0x1F, 0xFD, 0xBF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFF, 0xBF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xC1, 0xF8, 0x1F, 0xFF, 0x80, 0xF8, 0x1F,
+    0xFF, 0x00, 0x7F, 0x1F, 0xF7, 0x1C, 0x3F, 0x9F, 0xE6, 0x3E, 0x3F, 0x8F,
+    0xE6, 0x3E, 0x1F, 0x8F, 0xC6, 0x3F, 0x1F, 0x9F, 0x8E, 0x3F, 0x0F, 0x9F,
+    0x8E, 0x3F, 0x87, 0x1F, 0x9F, 0x07, 0x80, 0x3F, 0xFF, 0x07, 0xC0, 0x7F,
+    0xFF, 0x8F, 0xE0, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xFF, 0x80, 0xC1, 0xFF, 0x80, 0xF9,
+    0xFF, 0x38, 0x79, 0xE3, 0x3C, 0x78, 0xC3, 0x3C, 0x39, 0x07, 0x1E, 0x39,
+    0x0F, 0x0E, 0x01, 0xBF, 0x87, 0x03, 0xFF, 0x8F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xC1, 0xF8, 0x1F, 0x3F, 0x80, 0xF8, 0x1F,
+    0x0F, 0x00, 0x7F, 0x1F, 0x87, 0x1C, 0x3F, 0x9F, 0xC6, 0x3E, 0x3F, 0x8F,
+    0xE2, 0x3E, 0x1F, 0x8F, 0xE2, 0x3F, 0x1F, 0x9F, 0xC6, 0x3F, 0x0F, 0x9F,
+    0x8E, 0x3F, 0x87, 0x1F, 0x1F, 0x07, 0x80, 0x3F, 0x3F, 0x07, 0xC0, 0x7F,
+    0xFF, 0x8F, 0xE0, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xC3, 0xC1, 0x0F, 0x80, 0xC1, 0x87, 0x80, 0xF9,
+    0xE3, 0x38, 0x79, 0xF3, 0x3C, 0x78, 0xE3, 0x3C, 0x39, 0x87, 0x1E, 0x39,
+    0x8F, 0x0E, 0x01, 0x3F, 0x87, 0x03, 0xFF, 0x8F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xBE, 0x3F, 0xFF, 0xFF, 0x1E, 0x3F, 0xFF, 0xDF, 0x8E, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0xE2, 0x00, 0x00, 0x1F, 0xE2, 0x00, 0x00, 0x1F,
+    0xC6, 0x00, 0x00, 0x1F, 0x8E, 0x3F, 0xFF, 0x9F, 0x1E, 0x3F, 0xFF, 0x9F,
+    0x3E, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x00, 0x03,
+    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0x9F, 0xF8, 0xC1, 0x9F, 0xF9,
+    0x81, 0x9F, 0xF9, 0x8F, 0x9F, 0xF9, 0xFF, 0xBF, 0xFB,
+    // 0x16E 'Ů'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x1F, 0xFE, 0x0F, 0xEF, 0x3F, 0xFF, 0x8F, 0x83, 0xBF, 0xFF, 0xCF,
+    0x81, 0xFF, 0xFF, 0xCF, 0x39, 0xFF, 0xFF, 0xC7, 0x39, 0xFF, 0xFF, 0xCF,
+    0x81, 0xFF, 0xFF, 0xCF, 0x83, 0xFF, 0xFF, 0xCF, 0xE7, 0x1F, 0xFF, 0x8F,
+    0xFF, 0x1F, 0xFE, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xE3, 0x80, 0x00, 0xFF,
+    0xC0, 0xFF, 0xFC, 0xFF, 0x98, 0xFF, 0xFC, 0x7F, 0x9C, 0xFF, 0xFC, 0xFF,
+    0x9C, 0xFF, 0xFC, 0xFF, 0x81, 0xCF, 0xFC, 0xFF, 0xC1, 0xCF, 0xF9, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFB, 0x1F, 0xFE, 0x0F, 0xF1, 0x3F, 0xFF, 0x8F, 0xE3, 0xBF, 0xFF, 0xCF,
+    0xC3, 0xFF, 0xFF, 0xCF, 0xC7, 0xFF, 0xFF, 0xC7, 0x8F, 0xFF, 0xFF, 0xCF,
+    0xDF, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF, 0xCF, 0xF3, 0x1F, 0xFF, 0x8F,
+    0xE3, 0x1F, 0xFE, 0x1F, 0xC7, 0x00, 0x00, 0x1F, 0x8F, 0x00, 0x00, 0x3F,
+    0xCF, 0x00, 0x01, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x01, 0xF3, 0x00, 0x01, 0xE3, 0xFF, 0xF9, 0x87, 0xFF, 0xF8,
+    0x8F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0xF3, 0x9F, 0xF9, 0xC3, 0x9F, 0xF3,
+    0x87, 0x80, 0x03, 0x8F, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFF, 0xDC, 0x0F, 0xFF, 0xFF, 0x8C, 0x03, 0xFF, 0xBF,
+    0x0C, 0x40, 0xFF, 0x3F, 0x8C, 0xF0, 0x7F, 0x3F, 0xFE, 0xF8, 0x00, 0x3F,
+    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0x8F, 0xF8, 0x3F, 0x3F,
+    0x0C, 0xE0, 0xFF, 0x3F, 0x8C, 0x41, 0xFF, 0x3F, 0xFC, 0x07, 0xFF, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x07, 0xFE, 0x1F,
+    0xFE, 0x07, 0xF8, 0x1F, 0xFE, 0x3F, 0xF0, 0x1F, 0xFE, 0x3F, 0xE1, 0x9F,
+    0xF6, 0x3F, 0x83, 0x9F, 0xE6, 0x3F, 0x07, 0x9F, 0xC6, 0x3C, 0x1F, 0x9F,
+    0x86, 0x38, 0x3F, 0x9F, 0x8E, 0x20, 0xFF, 0x9F, 0x0E, 0x01, 0xFF, 0x9F,
+    0xFE, 0x07, 0xFF, 0x9F, 0xFE, 0x0F, 0xFE, 0x1F, 0xFF, 0x1F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xF8, 0x7F,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF1, 0xFF, 0x87, 0xE1, 0xFF, 0x8F, 0xC1,
+    0xFF, 0x9F, 0x81, 0xFF, 0x9E, 0x09, 0xF3, 0x9C, 0x39, 0xC3, 0x98, 0x79,
+    0x87, 0x90, 0xF9, 0x0F, 0x83, 0xF9, 0x9F, 0x87, 0xF9, 0xFF, 0x8F, 0xE1,
+    0xFF, 0x9F, 0xC1, 0xFF, 0xFF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x07, 0xFE, 0x1F,
+    0xFE, 0x07, 0xF8, 0x1F, 0xFE, 0x3F, 0xF0, 0x1F, 0xFE, 0x3F, 0xE1, 0x9F,
+    0xCE, 0x3F, 0x83, 0x9F, 0x86, 0x3F, 0x07, 0x9F, 0x86, 0x3C, 0x1F, 0x9F,
+    0x8E, 0x38, 0x3F, 0x9F, 0xFE, 0x20, 0xFF, 0x9F, 0xFE, 0x01, 0xFF, 0x9F,
+    0xFE, 0x07, 0xFF, 0x9F, 0xFE, 0x0F, 0xFE, 0x1F, 0xFF, 0x1F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xF8, 0x7F,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xE3, 0xFF, 0x0F, 0xC3, 0xFF, 0x1F, 0x83,
+    0xFF, 0x3F, 0x03, 0xCF, 0x3C, 0x13, 0x87, 0x38, 0x73, 0x87, 0x30, 0xF3,
+    0x8F, 0x21, 0xF3, 0xFF, 0x07, 0xF3, 0xFF, 0x0F, 0xF3, 0xFF, 0x1F, 0xC3,
+    0xFF, 0x3F, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x07, 0xFE, 0x1F,
+    0xBE, 0x07, 0xF8, 0x1F, 0x1E, 0x3F, 0xF0, 0x1F, 0x8E, 0x3F, 0xE1, 0x9F,
+    0xC6, 0x3F, 0x83, 0x9F, 0xE2, 0x3F, 0x07, 0x9F, 0xE2, 0x3C, 0x1F, 0x9F,
+    0xC6, 0x38, 0x3F, 0x9F, 0x8E, 0x20, 0xFF, 0x9F, 0x1E, 0x01, 0xFF, 0x9F,
+    0x3E, 0x07, 0xFF, 0x9F, 0xFE, 0x0F, 0xFE, 0x1F, 0xFF, 0x1F, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xF8, 0x7F,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF1, 0xFF, 0x87, 0xE1, 0x1F, 0x8F, 0xC1,
+    0x8F, 0x9F, 0x81, 0xC3, 0x9E, 0x09, 0xE3, 0x9C, 0x39, 0xE3, 0x98, 0x79,
+    0xC3, 0x90, 0xF9, 0x8F, 0x83, 0xF9, 0x1F, 0x87, 0xF9, 0xFF, 0x8F, 0xE1,
+    0xFF, 0x9F, 0xC1, 0xFF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0x9F, 0xC1, 0x80, 0x01,
+    0x80, 0x01, 0x81, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x98, 0x07,
+    0x80, 0x01, 0x80, 0x01, 0x9F, 0xF1, 0x1F, 0xF9, 0x1F, 0xF9, 0x3F, 0xFB,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x1F, 0xFE, 0x1F, 0x1F, 0xFC, 0x0F, 0x1F, 0xFF, 0x0F, 0x1F, 0x1F, 0x8F,
+    0x1C, 0x1F, 0xC7, 0x10, 0x1F, 0xC7, 0x81, 0x8F, 0xC7, 0x83, 0x8F, 0xCF,
+    0x8F, 0xC3, 0x8F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F,
+    // 0x2018 '‘'
+    0xF9, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x1C, 0xFF, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x00, 0xFF, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x201B '‛'
+    0xCF, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xF9, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x3E, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x00, 0xFF, 0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBC, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x9C, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF,
+    // 0x201F '‟'
+    0xCF, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xBE, 0x7F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0x9C, 0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0xBC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0xFF,
+    0xFC, 0xFC, 0xFF, 0x9C, 0xCC, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0xBC, 0xDC, 0xE7, 0xFC, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xCF, 0x87, 0x03, 0x03, 0x07, 0x87, 0xFF,
+    // 0x2026 '…'
+    0xFF, 0x8F, 0x8F, 0x8F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+    0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0x8F, 0x3F,
+    0x9F, 0x9F, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0x9F, 0x9F, 0x8F, 0x3F, 0xC4, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0x8F, 0xE3, 0x9F, 0xF3,
+    0x9F, 0xF3, 0x9F, 0xE3, 0x8F, 0xC7, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x7F,
+    // 0x2074 '⁴'
+    0xFF, 0x9F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x9F, 0xE1, 0x9F, 0xC7, 0x9F,
+    0x80, 0x03, 0x80, 0x03, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0xDF,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0xE7, 0x03, 0xE7, 0x13, 0xE7, 0x31, 0xC7,
+    0x39, 0x8F, 0x38, 0x0F, 0x3C, 0x1F, 0xFF, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0xC3, 0xC1, 0xF3, 0xC8, 0xF3,
+    0x9C, 0xF3, 0x9C, 0x63, 0x9C, 0x07, 0xFE, 0x0F, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0x8F, 0xFF, 0x0F, 0xFF, 0x3F, 0xC7, 0x3E, 0x07, 0x38, 0x1F, 0x30, 0xFF,
+    0x03, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xFF, 0xE3, 0x87, 0xC1, 0x03, 0x80, 0x73, 0x9C, 0xF3, 0x9C, 0xF3,
+    0x9C, 0x73, 0x80, 0x03, 0xC3, 0x07, 0xFF, 0x8F,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xE0, 0xF3, 0xC0, 0x73, 0x8C, 0x73, 0x9E, 0x73, 0x9E, 0x63,
+    0x9E, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x7F,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x0F, 0x80, 0x07, 0x1F, 0xC7, 0x3F, 0xE7,
+    0x3F, 0xE7, 0x3F, 0xE7, 0x1F, 0x87, 0x80, 0x0F, 0xC0, 0x1F, 0xF0, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xCF, 0xF3, 0xCF, 0xF3, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xCF, 0xC7, 0x87, 0x87, 0x1F, 0x07, 0x3E, 0x07, 0x3E, 0x47,
+    0x38, 0xC7, 0x01, 0xC7, 0x83, 0xC7, 0xCF, 0xC7, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xFF, 0x9F, 0xE7, 0x9F, 0xE7, 0x3D, 0xE7, 0x39, 0xE7, 0x39, 0xC7,
+    0x00, 0xCF, 0x00, 0x0F, 0x86, 0x1F, 0xFF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xC3, 0x3F, 0x8F, 0x3F,
+    0x00, 0x07, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0xBF,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0xE7, 0x03, 0xE7, 0x11, 0xE7, 0x31, 0xC7,
+    0x38, 0x8F, 0x38, 0x0F, 0x3C, 0x1F, 0xFF, 0xFF,
+    // 0x2086 '₆'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x0F, 0xC1, 0x87, 0x81, 0xE7, 0x99, 0xE7,
+    0x39, 0xE7, 0x38, 0xC7, 0x38, 0x0F, 0xFE, 0x1F, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0x8F, 0xFF, 0x0F, 0xFF, 0x1F, 0xC7, 0x3E, 0x07, 0x38, 0x0F, 0x30, 0xFF,
+    0x03, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0xFF, 0xC7, 0x0F, 0x82, 0x07, 0x00, 0xE7, 0x39, 0xE7, 0x38, 0xE7,
+    0x38, 0xE7, 0x00, 0x07, 0x86, 0x0F, 0xFF, 0x1F,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xC1, 0xF7, 0x80, 0xE7, 0x18, 0xE7, 0x3C, 0xE7, 0x3C, 0x47,
+    0x3C, 0x0F, 0x04, 0x1F, 0x80, 0x3F, 0xE0, 0xFF,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0xFF, 0xF7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x01, 0xFF,
+    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE1, 0x24, 0x1F, 0xC7, 0x27, 0x0F,
+    0x8F, 0x27, 0x8F, 0x8F, 0x27, 0xCF, 0x9F, 0x27, 0xCF, 0x9F, 0x3F, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x83, 0xFF, 0xCF, 0x83, 0xFF, 0x9F,
+    0xCF, 0xFF, 0xBF,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x9F, 0xFF, 0x1F, 0xFF, 0x3F, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x3F, 0x3F,
+    0x3F, 0xBF, 0x1F, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xBE, 0x3F, 0x00, 0x3F,
+    0x07, 0x3F, 0x83, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0xE3, 0xFF, 0x8F, 0xBF,
+    0x00, 0x3F, 0x20, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xFB, 0xFF, 0xC0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFB, 0xFF, 0xFB, 0xF1,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0x8F, 0xE7, 0xBF, 0x9C, 0xE3,
+    0xFF, 0x1C, 0xE7, 0xFF, 0x38, 0xE7, 0xFF, 0x38, 0xE7, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x0F, 0xFF, 0xCE, 0x1F,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xF3, 0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xC3, 0xFF,
+    0xCF, 0x83, 0xFF, 0xCF, 0x13, 0xFF, 0xCE, 0x33, 0xFF, 0xC0, 0x73, 0xFF,
+    0xC0, 0xF3, 0xF3, 0xF3, 0xF3, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0x8F, 0xE7,
+    0x9F, 0x9C, 0xE3, 0xFF, 0x1C, 0xE7, 0xFF, 0x38, 0xE7, 0xFF, 0x38, 0xE7,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xCE, 0x1F,
+    // 0x215B '⅛'
+    0xEF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xFB, 0xFF, 0xC0, 0x03, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xF3,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0x9F, 0x87, 0xC3, 0x07, 0x9F, 0x80, 0x07,
+    0xFF, 0x90, 0xE7, 0xFF, 0x38, 0xF7, 0xFF, 0x38, 0xF7, 0xFF, 0x10, 0x67,
+    0xFF, 0x82, 0x07, 0xFF, 0xC6, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xC7, 0xF9, 0xFF, 0xCE, 0x79, 0xFF,
+    0xCE, 0x71, 0xFF, 0xCC, 0x73, 0xFF, 0xC8, 0x63, 0xFF, 0xC0, 0x07, 0xFB,
+    0xE3, 0x07, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0x9F, 0x8F, 0xC3, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x90, 0xE7, 0xFF, 0x38, 0xF7, 0xFF, 0x38, 0xF7,
+    0xFF, 0x10, 0x67, 0xFF, 0x82, 0x07, 0xFF, 0xC6, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xC0, 0xF9, 0xFF, 0xC0, 0xF9, 0xFF,
+    0xCC, 0xF1, 0xFF, 0xCC, 0xF3, 0xFF, 0xCC, 0x63, 0xFF, 0xCE, 0x07, 0xF3,
+    0xCF, 0x0F, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0x9F, 0x9F, 0xC3, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x90, 0xE7, 0xFF, 0x38, 0xF7, 0xFF, 0x38, 0xF7,
+    0xFF, 0x10, 0x67, 0xFF, 0x82, 0x07, 0xFF, 0xC6, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x215E '⅞'
+    0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xCF, 0xE3, 0xFF, 0xCF, 0x81, 0xFF,
+    0xCE, 0x07, 0xFF, 0xC8, 0x3F, 0xF3, 0xC0, 0xFF, 0xE1, 0xC3, 0xFF, 0x87,
+    0xC7, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0xC3, 0x07, 0xFF, 0x80, 0x07,
+    0xFF, 0x90, 0xE7, 0xFF, 0x38, 0xF7, 0xFF, 0x38, 0xF7, 0xFF, 0x10, 0x67,
+    0xFF, 0x82, 0x07, 0xFF, 0xC6, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x2190 '←'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC1, 0x3F, 0x89, 0x9F, 0x99, 0xDF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x8F, 0xFF, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0xDF, 0x89, 0x9F,
+    0xC1, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC1, 0x1F, 0x89, 0x8F,
+    0xD9, 0xDF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xD9, 0xDF,
+    0x89, 0x8F, 0xC1, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF9, 0xFF, 0xE3, 0xF8, 0xFF, 0xC7, 0xFC, 0xFF,
+    0x8F, 0xFE, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x8F, 0xFE, 0x7F,
+    0xC7, 0xFC, 0xFF, 0xE3, 0xF8, 0xFF, 0xF3, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE2, 0x7F, 0xC6, 0x3F, 0x86, 0x1F, 0x86, 0x4F,
+    0xA6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    // 0x21D1 '⇑'
+    0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x7F, 0x86, 0x4F, 0x86, 0x1F,
+    0xC6, 0x3F, 0xE2, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE7, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE2, 0x3F, 0xC6, 0x1F, 0x86, 0x0F,
+    0xA6, 0x4F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x4F,
+    0x86, 0x0F, 0xC6, 0x1F, 0xE2, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x03, 0xCF, 0x87, 0xE3,
+    0x9F, 0x9F, 0xF3, 0x9F, 0x3F, 0xF3, 0x3F, 0x3F, 0xF3, 0x3F, 0x3F, 0xE3,
+    0x1F, 0x3F, 0xC7, 0x8F, 0x3F, 0x0F, 0x81, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
+    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xC0, 0xCF, 0xFE, 0x03, 0xCF, 0xF8, 0x1F, 0xCF, 0xC0, 0x7F, 0xCF,
+    0x83, 0xFF, 0xCF, 0x07, 0xFF, 0xCF, 0x00, 0xFF, 0xCF, 0xC0, 0x1F, 0xCF,
+    0xF8, 0x03, 0xCF, 0xFE, 0x00, 0xCF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xEF,
+    // 0x220F '∏'
+    0xBF, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF,
+    0x03, 0xFF, 0xC0, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x0C, 0xFF,
+    0x10, 0x3C, 0x1C, 0xFF, 0x1C, 0x18, 0x7C, 0xFF, 0x1E, 0x00, 0xFC, 0xFF,
+    0x1F, 0x81, 0xFC, 0xFF, 0x1F, 0xC7, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0x03, 0xFF, 0xF0, 0x7F,
+    0x83, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF3, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x9E, 0x3F, 0x1F, 0x3F, 0x9E, 0x3F,
+    0x9E, 0x7F, 0xC4, 0xFF, 0xE1, 0xFF, 0xE0, 0xFF, 0xCC, 0x7F, 0x9E, 0x7F,
+    0x9F, 0x3F, 0x1F, 0x3F, 0x9E, 0x7F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xE7, 0x3F, 0xE7, 0x3F, 0xE7, 0x0F, 0xE7, 0x0F, 0xE6, 0x3F,
+    0xE0, 0x3F, 0xE1, 0x3F, 0xC7, 0x3F, 0x87, 0x3F, 0xA7, 0x3F, 0xE7, 0x3F,
+    0xE7, 0x3F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0xF0, 0x7E, 0x7F,
+    0xF0, 0x7E, 0x7F, 0xE2, 0x3E, 0x7F, 0xE7, 0x3E, 0x7F, 0xC7, 0x1E, 0x7F,
+    0xCF, 0x9E, 0x7F, 0x8F, 0x8E, 0x7F, 0x9F, 0xCE, 0x7F, 0x9F, 0xC6, 0x7F,
+    0xFF, 0xFE, 0x7F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xEE, 0x7F, 0x9F, 0xC6, 0x7F, 0x8F, 0xCE, 0x7F,
+    0xCF, 0x8E, 0x7F, 0xC7, 0x9E, 0x7F, 0xE7, 0x1E, 0x7F, 0xE3, 0x3E, 0x7F,
+    0xF2, 0x3E, 0x7F, 0xF0, 0x7E, 0x7F, 0xF8, 0x7E, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFC, 0xFE, 0x7F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x3F, 0x98, 0x23, 0x80, 0x01, 0x07, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x23,
+    0x00, 0x00, 0x03,
+    // 0x22 '"'
+    0x01, 0xBF, 0x40, 0x7F, 0x07, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x7E, 0x3F,
+    0x00, 0x3F, 0x3C, 0x3F,
+    // 0x23 '#'
+    0x00, 0x18, 0x3F, 0x00, 0x08, 0x3F, 0x08, 0x08, 0x3F, 0x08, 0x0D, 0x3F,
+    0x08, 0x40, 0x3F, 0x08, 0x06, 0x3F, 0x60, 0x28, 0x3F, 0x80, 0x08, 0x3F,
+    0x28, 0x08, 0x3F, 0x08, 0x02, 0x3F, 0x08, 0xA0, 0xBF, 0x00, 0x00, 0x3F,
+    0x80, 0xC8, 0x3F, 0x88, 0x08, 0x3F, 0xC8, 0x08, 0x3F, 0x08, 0x08, 0x3F,
+    0x0E, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x28, 0x07, 0x00, 0x90, 0x44, 0x07, 0x02, 0x00, 0x02, 0x07,
+    0x04, 0x00, 0x12, 0x07, 0x05, 0x00, 0x08, 0x07, 0x00, 0x10, 0x01, 0xC7,
+    0x72, 0x10, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x32, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x01, 0x80, 0x40, 0x07, 0x00, 0x02, 0x04, 0x07,
+    0x00, 0x41, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x01, 0x80, 0x01, 0x08, 0x00, 0x01, 0x00, 0x08, 0x01, 0x0C, 0x44, 0x01,
+    0x50, 0x00, 0x01, 0x50, 0x10, 0x01, 0x50, 0x04, 0x15, 0x0C, 0x60, 0x21,
+    0x00, 0x08, 0x89, 0x10, 0x21, 0x01, 0x03, 0x80, 0x81, 0x00, 0x13, 0x01,
+    0x00, 0x24, 0x01, 0x00, 0x80, 0x01, 0x00, 0x40, 0x01, 0x08, 0x80, 0x31,
+    0x20, 0x00, 0x09, 0x48, 0x0A, 0xE1, 0x10, 0x50, 0x15, 0x00, 0x10, 0x15,
+    0x00, 0x00, 0x05, 0x00, 0x40, 0x01, 0x00, 0x20, 0x09, 0x00, 0x00, 0x31,
+    0x00, 0x04, 0x81,
+    // 0x26 '&'
+    0x00, 0x02, 0x03, 0x00, 0x08, 0x23, 0x00, 0x00, 0x03, 0x07, 0x03, 0x03,
+    0x10, 0x00, 0x23, 0x00, 0x10, 0x03, 0x46, 0x84, 0x07, 0x00, 0x20, 0x17,
+    0x80, 0x10, 0x17, 0xA1, 0x00, 0x17, 0x00, 0x82, 0x43, 0x40, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43,
+    0x00, 0x06, 0x23, 0x00, 0x00, 0x27, 0x00, 0x20, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x03,
+    // 0x27 '''
+    0x01, 0xBF, 0x40, 0x7F, 0x07, 0xBF, 0x00, 0x3F,
+    // 0x28 '('
+    0x00, 0x17, 0x20, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x08, 0x60, 0x40, 0x0F, 0x11, 0x00, 0x0C, 0x0F, 0x20, 0x00, 0x02, 0x0F,
+    0x40, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x8F,
+    0x44, 0x00, 0x00, 0x0F, 0x23, 0x00, 0x04, 0x0F, 0x10, 0x20, 0x20, 0x8F,
+    0x04, 0x06, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x51, 0xA0, 0x0F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x10, 0x3F, 0x80, 0x7F,
+    0x03, 0x3F, 0x28, 0xBF, 0x02, 0x3F, 0x02, 0x3F,
+    // 0x2B '+'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x7D, 0xF7,
+    0x00, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x82, 0x3F, 0x08, 0x3F,
+    0x00, 0x3F,
+    // 0x2D '-'
+    0x6F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x4F,
+    // 0x2E '.'
+    0x07, 0x47, 0x8F, 0x8F, 0x27,
+    // 0x2F '/'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x33, 0x00, 0x00, 0x05, 0x00, 0x02, 0x11,
+    0x00, 0x18, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0C, 0x01, 0x0C, 0x00, 0x01,
+    0x20, 0x80, 0x01, 0x06, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x01, 0x7A, 0x07, 0x0C, 0x00, 0xC7, 0x10, 0x00, 0x07, 0x20, 0x7A, 0x17,
+    0x08, 0x00, 0x07, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x90, 0x00, 0x47, 0x00, 0x00, 0x97, 0x02, 0x03, 0x07,
+    0x00, 0x00, 0x27, 0x10, 0x00, 0x87, 0x08, 0x01, 0x07, 0x00, 0x00, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x4F, 0xFF, 0xCF, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    // 0x32 '2'
+    0x1E, 0x00, 0x7F, 0x00, 0x00, 0x8F, 0x46, 0x01, 0x0F, 0x50, 0x02, 0x0F,
+    0x00, 0x00, 0xCF, 0xA0, 0x08, 0x4F, 0xA0, 0x10, 0x4F, 0x80, 0x24, 0x4F,
+    0x90, 0x88, 0x4F, 0x06, 0x00, 0x4F, 0x00, 0x20, 0x4F, 0x00, 0x80, 0x4F,
+    0x0E, 0x00, 0x5F, 0x00, 0x00, 0x2F,
+    // 0x33 '3'
+    0x18, 0x00, 0x27, 0x00, 0x00, 0x27, 0x40, 0x00, 0x2F, 0x50, 0x30, 0x27,
+    0x00, 0x50, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x07, 0x81, 0x10, 0x17,
+    0x90, 0x00, 0x17, 0x00, 0x06, 0x27, 0x40, 0x00, 0x07, 0x1C, 0x00, 0x87,
+    0x00, 0x0A, 0x07,
+    // 0x34 '4'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0x40, 0x07, 0x00, 0x88, 0x07,
+    0x02, 0x20, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x22, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0xFF,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x63, 0x40, 0x2F, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x0F, 0x11, 0x00, 0x4F, 0x11, 0x20, 0x07, 0x11, 0x20, 0x97,
+    0x10, 0x01, 0x07, 0x10, 0x84, 0x07, 0x10, 0x00, 0x47, 0x10, 0x20, 0x87,
+    0x00, 0x0C, 0x07,
+    // 0x36 '6'
+    0x00, 0x32, 0x87, 0x02, 0x00, 0x47, 0x04, 0x00, 0x07, 0x00, 0x03, 0x17,
+    0x01, 0x00, 0x07, 0x24, 0x00, 0x4F, 0x48, 0x00, 0x0F, 0x40, 0x20, 0x0F,
+    0x00, 0x20, 0x0F, 0x80, 0x10, 0x07, 0xA0, 0x02, 0x17, 0x80, 0x40, 0x07,
+    0x20, 0x30, 0x47, 0x00, 0x02, 0x07,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x02, 0x00, 0x07, 0x10, 0x00, 0x67,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x57, 0x00, 0x00, 0x07,
+    0x02, 0x18, 0x07, 0x04, 0x60, 0x07, 0x10, 0x80, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x20, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x06, 0xC7, 0x18, 0x08, 0x27, 0x20, 0x90, 0x07, 0x00, 0x00, 0x07,
+    0x10, 0x08, 0x4F, 0x00, 0x00, 0x0F, 0xA0, 0x10, 0x27, 0xA0, 0x10, 0x0F,
+    0x80, 0x08, 0x07, 0x12, 0x44, 0x47, 0x40, 0x03, 0x17, 0x00, 0x10, 0x27,
+    0x0C, 0x08, 0x07, 0x00, 0x03, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x07, 0x08, 0x00, 0x37, 0x00, 0x10, 0x0F, 0x40, 0x00, 0x2F,
+    0x08, 0xC0, 0x0F, 0x10, 0x08, 0x47, 0x80, 0x20, 0x17, 0x80, 0x00, 0x17,
+    0x80, 0x00, 0x27, 0x00, 0x02, 0x07, 0x40, 0x20, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x0C, 0x18, 0x07, 0x00, 0x00, 0x07,
+    // 0x3A ':'
+    0x00, 0x01, 0x80, 0x11, 0x00, 0x23, 0x10, 0x23, 0xE0, 0x09,
+    // 0x3B ';'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x70, 0x10, 0x0F, 0x90, 0x00, 0x0F,
+    0x10, 0x20, 0x8F, 0x10, 0x02, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x3C '<'
+    0x00, 0x07, 0x05, 0x07, 0x08, 0x07, 0x08, 0x87, 0x10, 0x07, 0x10, 0x07,
+    0x20, 0x07, 0x20, 0x07, 0x40, 0x07, 0x50, 0x07, 0x80, 0x47, 0x20, 0x07,
+    0x00, 0x27,
+    // 0x3D '='
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01,
+    // 0x3E '>'
+    0x00, 0x07, 0xE0, 0x17, 0x80, 0x07, 0x10, 0x07, 0x40, 0x07, 0x28, 0x87,
+    0x24, 0x07, 0x15, 0x07, 0x03, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x01, 0x07,
+    // 0x3F '?'
+    0x50, 0x00, 0x03, 0x00, 0x24, 0x03, 0x90, 0x01, 0x23, 0x90, 0x00, 0x07,
+    0x10, 0x08, 0x03, 0x48, 0x48, 0x2B, 0x00, 0x00, 0x03, 0x20, 0x10, 0x03,
+    0x10, 0x20, 0x03, 0x07, 0xC0, 0x03,
+    // 0x40 '@'
+    0x00, 0x26, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x04, 0x60, 0x80, 0x3F, 0x09, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x24, 0x00, 0x04, 0x3F, 0x28, 0x01, 0x80, 0xBF, 0x00, 0x04, 0x00, 0xBF,
+    0x11, 0x20, 0x22, 0x3F, 0x51, 0x40, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x02, 0x04, 0x20, 0x3F, 0x02, 0x04, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x50, 0x81, 0x22, 0xBF, 0x10, 0x00, 0x80, 0x3F,
+    0x40, 0x00, 0xA0, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x02, 0x3F,
+    0x11, 0x86, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x78, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xCF, 0x00, 0x03, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x61, 0x8F, 0x00, 0x00, 0x2F, 0x04, 0x20, 0x1F,
+    0x30, 0x00, 0x0F, 0x06, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x82, 0x00, 0x0F,
+    0x60, 0x70, 0x1F, 0x04, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x60, 0x0F,
+    0x00, 0x0C, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x2F,
+    // 0x42 'B'
+    0x60, 0x00, 0x27, 0x80, 0x00, 0x27, 0xBF, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xBF, 0x9F, 0xC7, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x20, 0x00, 0x07, 0x90, 0x90, 0x07, 0x06, 0x00, 0x87,
+    0x00, 0x01, 0x07, 0x20, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0x07, 0x07,
+    // 0x43 'C'
+    0x01, 0x32, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x47, 0x21, 0x04, 0x27,
+    0x00, 0x01, 0x17, 0x40, 0x00, 0x97, 0x10, 0x00, 0x07, 0x00, 0x00, 0x4F,
+    0x20, 0x00, 0x4F, 0x80, 0x00, 0x47, 0x80, 0x00, 0x4F, 0xA0, 0x00, 0x4F,
+    0x0C, 0x00, 0x47, 0x80, 0x00, 0x07, 0x04, 0x00, 0x57, 0x00, 0x00, 0x47,
+    // 0x44 'D'
+    0x60, 0x00, 0x27, 0x80, 0x00, 0x27, 0xBF, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xBF, 0xFF, 0xC7, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x47, 0x80, 0x00, 0x07,
+    0x10, 0x00, 0x17, 0x40, 0x00, 0x07, 0x44, 0x02, 0x27, 0x01, 0x08, 0x07,
+    0x00, 0x00, 0x07, 0x08, 0x02, 0x07, 0x00, 0x68, 0x07,
+    // 0x45 'E'
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x3F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x9F, 0xCF, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x10, 0x00, 0x4F, 0x00, 0x41, 0x8F, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    // 0x46 'F'
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x3F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x8F, 0xCF, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x1F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x30, 0x0F, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0x32, 0x07, 0x04, 0x00, 0x07, 0x08, 0x00, 0x47, 0x01, 0x04, 0x27,
+    0x20, 0x01, 0x17, 0x08, 0x00, 0x97, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x18, 0x07, 0x80, 0x08, 0x0F,
+    0xA0, 0x00, 0x0F, 0x00, 0x00, 0x47, 0x08, 0x00, 0x07, 0x02, 0x00, 0x17,
+    0x04, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0x48 'H'
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x3F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x9F, 0xCF, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x3F, 0x8F, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0xA0, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x3F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x7F,
+    0xA0, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x3F, 0xFF, 0xF8, 0xBF,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xC8, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x80, 0x00, 0x27, 0x00, 0x00, 0x27, 0x3F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0x9F, 0xC7, 0x00, 0x80, 0x07, 0x01, 0x08, 0x27,
+    0x40, 0x44, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x07,
+    0x30, 0x00, 0x07, 0x04, 0x00, 0x27, 0x00, 0x01, 0x17, 0x00, 0x00, 0x8F,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x80, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x3F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x4F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0xCC, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x73, 0x8F, 0x00, 0x00, 0x2F, 0x03, 0x00, 0x1F,
+    0x20, 0x60, 0x0F, 0x0C, 0x0C, 0x0F, 0x01, 0x00, 0x8F, 0x00, 0x20, 0x2F,
+    0x00, 0x04, 0x2F, 0x00, 0x08, 0x0F, 0x00, 0x40, 0x0F, 0x06, 0x08, 0x0F,
+    0x30, 0xC0, 0x0F, 0x86, 0x00, 0x2F, 0x03, 0x00, 0x2F, 0x00, 0x06, 0x0F,
+    0x00, 0x00, 0x0F, 0x03, 0x38, 0x0F, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0xC0, 0x00, 0x27, 0x20, 0x00, 0x27, 0x3F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x22, 0x00, 0x07, 0x00, 0x80, 0x17,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x44, 0x07,
+    0x00, 0x21, 0x07, 0x00, 0x08, 0x87, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x01, 0x30, 0x07, 0x00, 0x01, 0x87, 0x10, 0x00, 0x07, 0x00, 0x98, 0x07,
+    0x44, 0x02, 0x17, 0x48, 0x00, 0x17, 0x90, 0x00, 0x47, 0x20, 0x00, 0x0F,
+    0x80, 0x00, 0x07, 0x20, 0x00, 0x27, 0x20, 0x00, 0x27, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x47, 0x80, 0x00, 0x17, 0x00, 0x00, 0x97, 0x00, 0x00, 0x27,
+    0x20, 0x20, 0x47, 0x10, 0x00, 0x07, 0x0C, 0x02, 0x07, 0x01, 0x98, 0x07,
+    // 0x50 'P'
+    0x60, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xBF, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x9F, 0xC7, 0xCF, 0xA0, 0x28, 0x0F, 0xA0, 0x28, 0x0F,
+    0xA0, 0x28, 0x1F, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x89, 0x90, 0x0F,
+    0x40, 0x20, 0x0F, 0x00, 0x40, 0x0F, 0x09, 0x80, 0x0F,
+    // 0x51 'Q'
+    0x01, 0x30, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x20, 0x98, 0x00, 0x3F, 0x06, 0x02, 0x00, 0x3F, 0x48, 0x00, 0x80, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x80, 0x00, 0x48, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x04, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x45, 0x3F, 0x90, 0x00, 0x04, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    0x40, 0x00, 0x00, 0x3F, 0x20, 0x20, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0x01, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x52 'R'
+    0x60, 0x00, 0x27, 0x80, 0x00, 0x27, 0xBF, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xBF, 0xCF, 0xC7, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x27,
+    0x80, 0x40, 0x37, 0xA0, 0x42, 0x07, 0x10, 0x90, 0x87, 0x00, 0x24, 0x07,
+    0x40, 0x00, 0x27, 0x20, 0x00, 0x07, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x01, 0xC7, 0x01, 0x00, 0x07, 0x00, 0x01, 0x07, 0x40, 0x00, 0x4F,
+    0x02, 0x00, 0x0F, 0x01, 0x00, 0x27, 0x80, 0x90, 0x27, 0x80, 0x80, 0x0F,
+    0x80, 0x48, 0x47, 0x00, 0x00, 0x87, 0x86, 0x00, 0x17, 0x00, 0x10, 0x27,
+    0x40, 0x00, 0x87,
+    // 0x54 'T'
+    0x84, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x2F, 0x20, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x55 'U'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x87,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x02, 0x17, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x47, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xF9, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x07,
+    0x01, 0x80, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x21, 0x81, 0x87,
+    0xC0, 0x30, 0x37, 0x00, 0x06, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x17,
+    0x40, 0x00, 0x07, 0x00, 0x81, 0x07, 0x24, 0x18, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x28, 0x06, 0x07, 0x22, 0x00, 0xC7,
+    0x00, 0x30, 0x17, 0x00, 0x03, 0x07, 0x00, 0x02, 0x07, 0x00, 0x18, 0x37,
+    0x00, 0x41, 0x87, 0x08, 0x04, 0x07, 0x40, 0x20, 0x07, 0x41, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x08, 0x00, 0x07, 0x03, 0x00, 0x87, 0x00, 0x40, 0x17,
+    0x00, 0x02, 0x07, 0x00, 0x00, 0x87, 0x40, 0x08, 0x07, 0x00, 0xA0, 0x07,
+    0x22, 0x04, 0x07, 0x00, 0x30, 0x07, 0x01, 0x80, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x01, 0x08, 0x2F, 0x30, 0x12, 0x1F,
+    0x04, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x01, 0x08, 0x0F, 0x02, 0x02, 0x1F,
+    0x44, 0xA0, 0x0F, 0x30, 0x08, 0x2F, 0x02, 0x00, 0x0F, 0x08, 0x02, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x06, 0x00, 0x0F, 0x01, 0x00, 0x2F, 0x10, 0x00, 0x0F, 0x04, 0x10, 0x0F,
+    0x80, 0x0F, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xCF,
+    0x00, 0x20, 0x0F, 0x10, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x3C, 0x00, 0x57, 0x00, 0x01, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x04, 0x47, 0x00, 0x10, 0x87, 0x00, 0x22, 0x07, 0x20, 0x80, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x40, 0x47, 0x11, 0x00, 0x47,
+    0x02, 0x00, 0x47, 0x08, 0x01, 0x87, 0x80, 0x00, 0x07, 0x00, 0x01, 0xA7,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F,
+    0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x60, 0x00, 0x01, 0x08, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0xC0, 0x01,
+    0x00, 0x30, 0x01, 0x01, 0x80, 0x01, 0x00, 0x21, 0x01, 0x00, 0x00, 0x61,
+    0x00, 0x03, 0x01, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05,
+    // 0x5D ']'
+    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0x00, 0x0F, 0x00, 0x6F, 0x00, 0x0F, 0x0C, 0x37, 0x20, 0x07, 0x06, 0x07,
+    0x80, 0x07, 0x8C, 0x07, 0x00, 0x07, 0x18, 0x67, 0x00, 0x07, 0x00, 0xCF,
+    0x00, 0x0F, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x60 '`'
+    0x30, 0x00, 0x04, 0x20, 0x02, 0x04, 0x00,
+    // 0x61 'a'
+    0x00, 0x10, 0x20, 0x82, 0x00, 0x00, 0x01, 0x39, 0x21, 0x40, 0xA1, 0x05,
+    0x80, 0x00, 0x80, 0x0A, 0x94, 0x60, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x20, 0x00, 0x01, 0x80, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x7F, 0x9F, 0xF3, 0x00, 0xA0, 0x03,
+    0x01, 0x00, 0x0B, 0x01, 0x40, 0x0B, 0x01, 0x40, 0x03, 0x01, 0x00, 0x11,
+    0x00, 0x20, 0x25, 0x01, 0x0B, 0x41, 0x00, 0x00, 0x09, 0x00, 0x40, 0x21,
+    0x00, 0x10, 0x81,
+    // 0x63 'c'
+    0x03, 0x70, 0x00, 0x04, 0x20, 0x00, 0x40, 0x42, 0x00, 0x10, 0x00, 0x01,
+    0xA0, 0x01, 0xA0, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x08, 0x40, 0x02,
+    0x00, 0x00,
+    // 0x64 'd'
+    0x00, 0x04, 0xC1, 0x00, 0x20, 0x09, 0x00, 0x00, 0x05, 0x00, 0x98, 0x81,
+    0x00, 0x00, 0x13, 0x00, 0x40, 0x03, 0x01, 0x00, 0x03, 0x01, 0x40, 0x03,
+    0x61, 0x00, 0x01, 0x21, 0x40, 0x11, 0x81, 0x00, 0x29, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x01,
+    // 0x65 'e'
+    0x0A, 0x60, 0x10, 0x04, 0x00, 0x02, 0x08, 0x22, 0x80, 0x00, 0xA0, 0x09,
+    0xA0, 0x01, 0xA0, 0x01, 0xA0, 0x01, 0x84, 0x00, 0x40, 0x08, 0x00, 0x02,
+    0x0F, 0x00,
+    // 0x66 'f'
+    0x00, 0xC0, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x05, 0x3F, 0xF3,
+    0x10, 0x00, 0x03, 0x40, 0x00, 0x03, 0x04, 0x00, 0x03, 0x21, 0x00, 0x03,
+    0xA1, 0x00, 0x0B, 0x21, 0x00, 0x0F, 0xA1, 0x40, 0x03, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x67 'g'
+    0x00, 0x00, 0x43, 0x00, 0x01, 0x13, 0x10, 0x06, 0x0B, 0x40, 0x80, 0x83,
+    0x0C, 0x30, 0x07, 0x01, 0x00, 0x13, 0xA0, 0x08, 0x03, 0x80, 0x08, 0x03,
+    0xA0, 0x08, 0x13, 0x80, 0x08, 0x17, 0x82, 0x48, 0x03, 0x80, 0x09, 0x0B,
+    0x20, 0x81, 0x83, 0xB0, 0x00, 0x03, 0xA0, 0x04, 0x23, 0x00, 0x01, 0x83,
+    // 0x68 'h'
+    0x60, 0x00, 0x07, 0x20, 0x00, 0x0B, 0xA0, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x40, 0x03, 0x01, 0x40, 0x03, 0x01, 0x40, 0x03, 0x01, 0x00, 0x0B,
+    0x01, 0x0F, 0xF3, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x69 'i'
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x0B, 0x20, 0x00, 0x0B, 0x81, 0x3F, 0xF3,
+    0x08, 0x00, 0x03, 0x80, 0x00, 0x03, 0x50, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x27,
+    0x00, 0x40, 0x00, 0x0F, 0x51, 0x00, 0x01, 0x97, 0x88, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x00, 0x47, 0x10, 0xFF, 0xFE, 0x87, 0x00, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x60, 0x00, 0x05, 0x20, 0x00, 0x09, 0xA0, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x41, 0x01, 0x24, 0x01, 0x01, 0x01, 0x11, 0x01, 0x00, 0x89,
+    0x01, 0x20, 0x41, 0x01, 0x00, 0x21, 0x01, 0x00, 0x03, 0x01, 0x40, 0x0B,
+    0x00, 0x00, 0x01,
+    // 0x6C 'l'
+    0x60, 0x00, 0x03, 0x20, 0x00, 0x03, 0xA0, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x0B,
+    // 0x6D 'm'
+    0x20, 0x01, 0x60, 0x05, 0x00, 0x05, 0x9F, 0xF9, 0x00, 0x01, 0x40, 0x01,
+    0x08, 0x01, 0x50, 0x05, 0x80, 0x01, 0x20, 0x01, 0xA0, 0x01, 0x80, 0x05,
+    0x87, 0xF9, 0x00, 0x01, 0x40, 0x01, 0x28, 0x01, 0x00, 0x01, 0x00, 0x05,
+    0x20, 0x01, 0xA0, 0x01, 0x80, 0x03, 0x90, 0x05, 0x80, 0x01, 0x40, 0x01,
+    0x30, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03,
+    // 0x6E 'n'
+    0x20, 0x01, 0x60, 0x05, 0x00, 0x05, 0x9F, 0xF9, 0x00, 0x01, 0x40, 0x01,
+    0x08, 0x01, 0x50, 0x05, 0x80, 0x01, 0x20, 0x01, 0xA0, 0x01, 0x80, 0x05,
+    0x98, 0x05, 0x80, 0x01, 0x00, 0x01, 0x2C, 0x01, 0x00, 0x01, 0x00, 0x05,
+    0x00, 0x01,
+    // 0x6F 'o'
+    0x02, 0x70, 0x10, 0x00, 0x00, 0x00, 0x4C, 0x42, 0x10, 0x00, 0x20, 0x01,
+    0xA0, 0x04, 0xA0, 0x04, 0x80, 0x05, 0x80, 0x00, 0x88, 0x02, 0x04, 0x20,
+    0x00, 0x04, 0x10, 0x10, 0x04, 0x40,
+    // 0x70 'p'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x47, 0xF1, 0xE7, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x03, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x90, 0x0A, 0x03,
+    0x00, 0x22, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x18, 0x40, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x71 'q'
+    0x02, 0x70, 0x03, 0x10, 0x04, 0x03, 0x00, 0x00, 0x03, 0x4C, 0x42, 0x03,
+    0x00, 0x08, 0x03, 0x20, 0x08, 0x03, 0x80, 0x00, 0x03, 0xA0, 0x00, 0x07,
+    0x80, 0x02, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x04, 0x17, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    // 0x72 'r'
+    0x20, 0x03, 0x60, 0x05, 0x00, 0x05, 0x9F, 0xF9, 0x00, 0x01, 0x40, 0x01,
+    0x24, 0x01, 0x40, 0x01, 0x10, 0x05, 0x00, 0x07, 0x90, 0x01, 0x80, 0x01,
+    0x20, 0x01,
+    // 0x73 's'
+    0x00, 0x1C, 0x02, 0x02, 0x00, 0x10, 0x00, 0x09, 0x24, 0x85, 0x80, 0x00,
+    0x82, 0x01, 0x82, 0x00, 0x01, 0x02, 0x88, 0x00, 0x20, 0x48, 0x00, 0x00,
+    // 0x74 't'
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x09, 0xFF, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x08, 0x01, 0x1F, 0x08, 0x00, 0x0F, 0x08, 0x00, 0x1F,
+    0x08, 0x00, 0x1F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0xAF,
+    // 0x75 'u'
+    0x20, 0x00, 0x20, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x10,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00,
+    0x9F, 0xE4, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06,
+    0x00, 0x00,
+    // 0x76 'v'
+    0x00, 0x00, 0x80, 0x00, 0x98, 0x00, 0x86, 0x00, 0x80, 0x00, 0xB8, 0x30,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xA4, 0x30,
+    0xA0, 0x00, 0x80, 0x00, 0x98, 0x00, 0x80, 0x00, 0xC0, 0x00,
+    // 0x77 'w'
+    0x00, 0x00, 0x80, 0x00, 0x98, 0x00, 0x81, 0x00, 0x80, 0x00, 0x98, 0x10,
+    0xA2, 0x02, 0x40, 0x10, 0x00, 0x30, 0x01, 0x86, 0x0C, 0x30, 0x40, 0x00,
+    0x80, 0x00, 0x40, 0x40, 0x18, 0x00, 0x03, 0x06, 0x00, 0x60, 0x00, 0x00,
+    0xC0, 0x42, 0xA2, 0x18, 0x80, 0x80, 0x80, 0x00, 0x98, 0x00, 0xA0, 0x00,
+    0x00, 0x00,
+    // 0x78 'x'
+    0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x90, 0x01, 0x80, 0x01, 0x82, 0x4D,
+    0xB1, 0x81, 0x00, 0x21, 0x02, 0x01, 0x00, 0x23, 0x88, 0x09, 0xA4, 0x41,
+    0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x05, 0x00, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x1B, 0x80, 0x00, 0x03, 0x98, 0x00, 0x03, 0x86, 0x00, 0x23,
+    0x80, 0x00, 0x27, 0xB8, 0x30, 0x4B, 0xA0, 0x0C, 0x83, 0x00, 0x00, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0xA4, 0x30, 0x03,
+    0xA0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x98, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0xC0, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x00, 0x40, 0x02, 0x84, 0x10, 0x80, 0x00, 0xA0, 0x88, 0xA0, 0x00,
+    0xA2, 0x20, 0xA0, 0x80, 0xB1, 0x00, 0x82, 0x00, 0x84, 0x08, 0x90, 0x20,
+    0x40, 0x00, 0x00, 0x10,
+    // 0x7B '{'
+    0x00, 0x04, 0x00, 0x0F, 0x03, 0x09, 0x04, 0x8F, 0x20, 0x30, 0x60, 0x0F,
+    0x00, 0x04, 0x00, 0x0F, 0x1B, 0x49, 0x14, 0x1F, 0xA0, 0x00, 0x00, 0x1F,
+    0xA0, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x7F, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x80, 0x0B, 0x9F, 0x40, 0x02, 0x00, 0x2F,
+    0x20, 0x40, 0x90, 0x4F, 0x04, 0x00, 0x01, 0x0F, 0x00, 0x02, 0x00, 0x0F,
+    // 0x7E '~'
+    0x27, 0x07, 0x87, 0xA7, 0xA7, 0x87, 0x17, 0x4F, 0x27, 0x0F, 0x07, 0x87,
+    0xA7, 0x07,
+    // 0xA1 '¡'
+    0x60, 0x00, 0x03, 0x11, 0xFE, 0x33, 0x92, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x40, 0x0F, 0xF3,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x0F,
+    0x00, 0x1A, 0x00, 0x0F, 0x00, 0x00, 0x48, 0x0F, 0x02, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x0F, 0x3C, 0xC0, 0x00, 0x1F, 0x80, 0x78, 0x03, 0xEF,
+    0x60, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x02, 0x00, 0x08, 0x0F,
+    0x02, 0x00, 0x28, 0x0F, 0x01, 0x40, 0x30, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x17, 0x00, 0x20, 0x07, 0x00, 0x40, 0x0F, 0x00, 0x05, 0x07,
+    0x02, 0xC0, 0x17, 0x18, 0x00, 0x57, 0x00, 0x04, 0x07, 0x02, 0x00, 0x07,
+    0x00, 0x40, 0x07, 0x80, 0x40, 0x07, 0xA0, 0x40, 0x0F, 0x80, 0x00, 0x0F,
+    0x10, 0x60, 0x47, 0x40, 0x00, 0x4F, 0x00, 0x00, 0x57, 0x00, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x00, 0x07, 0xA0, 0x2F, 0x02, 0x87, 0x00, 0x07, 0x25, 0x07, 0x40, 0x07,
+    0x50, 0x57, 0x40, 0x17, 0x50, 0x17, 0x10, 0x07, 0x0D, 0x87, 0x00, 0x27,
+    0x48, 0x97, 0x20, 0x27, 0xC0, 0x0F, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x28, 0x0F, 0x00, 0xA8, 0x2F, 0x00, 0x28, 0x0F, 0x40, 0x08, 0x0F,
+    0x00, 0x03, 0xCF, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x88, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0xA8, 0x2F, 0x02, 0x28, 0x0F, 0x04, 0x0C, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x05, 0x40, 0x29, 0x08, 0x00, 0x01, 0x20, 0x60, 0x21, 0x08, 0x82, 0x13,
+    0x12, 0x48, 0x01, 0x20, 0x00, 0x09, 0x21, 0x04, 0x0B, 0x00, 0x80, 0x81,
+    0x10, 0x12, 0x41, 0x40, 0x49, 0x09, 0x20, 0x20, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x01, 0x06, 0x07, 0x00, 0xF0, 0x87, 0x12, 0x00, 0x47,
+    0x08, 0x00, 0x27, 0x50, 0x00, 0x07, 0x40, 0x00, 0x47, 0x02, 0x02, 0x27,
+    0x01, 0x09, 0x07, 0x82, 0x05, 0x0F, 0x8A, 0x00, 0x07, 0x8A, 0x00, 0x07,
+    0x0B, 0x01, 0x2F, 0x00, 0x80, 0x07, 0x00, 0x04, 0x27, 0x40, 0x00, 0x47,
+    0x50, 0x00, 0x07, 0x08, 0x01, 0x27, 0x00, 0x06, 0x47, 0x08, 0x71, 0x07,
+    0x03, 0x02, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x03, 0x54, 0x07, 0x10, 0x57, 0x0A, 0x17, 0xC0, 0x57, 0xAD, 0x57,
+    0x00, 0x17, 0x40, 0x53, 0x01, 0x53, 0x00, 0x13,
+    // 0xAB '«'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x9F, 0x06, 0x5F, 0x50, 0x3F,
+    0x20, 0x5F, 0x40, 0x3F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x9F, 0x06, 0x5F,
+    0x50, 0x3F, 0x20, 0x5F, 0x40, 0x3F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x05, 0x81, 0x10, 0x05, 0x40, 0x01, 0x3F, 0xF1,
+    0x10, 0x13, 0x56, 0x55, 0xD0, 0xA5, 0x41, 0x21, 0x8E, 0x45, 0x20, 0x19,
+    0x40, 0x15, 0x04, 0x69, 0x18, 0x01, 0x02, 0xC1,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x20, 0x3F, 0x00, 0xBF, 0x12, 0x3F, 0x80, 0x7F, 0x81, 0x3F,
+    0xA0, 0x7F, 0x00, 0x3F, 0x00, 0xBF, 0x32, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x79, 0xF8, 0x7F, 0x80, 0x08, 0x7F, 0x80, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x01, 0x00, 0x7F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x24, 0x17, 0x00, 0x23, 0x10, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x12, 0x43, 0x40, 0x83, 0x01, 0x03, 0x04, 0x07, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x03, 0x28, 0x07, 0x49, 0x03, 0x50, 0x83, 0x02, 0x03, 0x24, 0x07,
+    0x00, 0x27, 0x00, 0x0B, 0x24, 0x13, 0x00, 0x43,
+    // 0xB5 'µ'
+    0x3F, 0xFF, 0xC7, 0x80, 0x00, 0x07, 0x00, 0x01, 0x03, 0xB0, 0x40, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0xE2, 0x03, 0x80, 0x0C, 0x03, 0x00, 0x06, 0x03,
+    0x7F, 0xC0, 0x03, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x06, 0x03,
+    // 0xB6 '¶'
+    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xB7 '·'
+    0x07, 0x17, 0x07, 0x07, 0x77,
+    // 0xB9 '¹'
+    0x30, 0x03, 0x20, 0x0F, 0x00, 0x07, 0x40, 0x17, 0x40, 0x07, 0x5F, 0xE7,
+    0x00, 0x07, 0x00, 0x03, 0x00, 0x03,
+    // 0xBA 'º'
+    0x0C, 0x03, 0x00, 0x8B, 0x40, 0x47, 0xA3, 0x57, 0x00, 0x17, 0x80, 0x97,
+    0xA0, 0x57, 0x8E, 0x53, 0x40, 0x93, 0x00, 0x13, 0x00, 0x03,
+    // 0xBB '»'
+    0x40, 0x3F, 0x00, 0x1F, 0x51, 0x3F, 0x00, 0x1F, 0x00, 0x9F, 0x10, 0x1F,
+    0x08, 0x1F, 0x40, 0x3F, 0x00, 0x1F, 0x51, 0x3F, 0x00, 0x1F, 0x00, 0x9F,
+    0x10, 0x1F, 0x08, 0x1F, 0x00, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x20, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x0F, 0xF2, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x11, 0x00, 0x04, 0x41,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x80, 0xC1, 0x20, 0x01, 0x01, 0x08, 0x00, 0x01, 0x50, 0x09, 0x01,
+    0x00, 0x12, 0x81, 0x00, 0x00, 0x81, 0x00, 0x08, 0xA5, 0x00, 0x80, 0x01,
+    0x00, 0xFF, 0xBD, 0x00, 0x00, 0x81, 0x00, 0x00, 0xE1,
+    // 0xBD '½'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x20, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x0F, 0xF2, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x11,
+    0x00, 0x00, 0x25, 0x00, 0x00, 0x19, 0x00, 0x00, 0x21, 0x00, 0x08, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x08, 0x01, 0x00, 0x20, 0x01, 0x00, 0x40, 0x01,
+    0x10, 0x00, 0x01, 0x44, 0x10, 0x09, 0x18, 0x00, 0x21, 0x20, 0x08, 0x01,
+    0x00, 0xA0, 0x01, 0x00, 0x20, 0x21, 0x00, 0x20, 0x41, 0x00, 0x0C, 0x81,
+    0x00, 0x01, 0x01, 0x00, 0x44, 0x01, 0x00, 0x00, 0x11,
+    // 0xBE '¾'
+    0x00, 0x00, 0x01, 0x08, 0x0A, 0x01, 0x29, 0x88, 0x01, 0x00, 0x0A, 0x01,
+    0x40, 0x80, 0x01, 0x42, 0x82, 0x01, 0x4C, 0x40, 0x01, 0x00, 0x04, 0x01,
+    0x24, 0x80, 0x01, 0x00, 0x60, 0x21, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x11,
+    0x00, 0x04, 0x41, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x80, 0x01, 0x20, 0x01, 0x21, 0x08, 0x02, 0x01,
+    0x50, 0x00, 0x01, 0x00, 0x12, 0x81, 0x00, 0x00, 0x81, 0x00, 0x07, 0x39,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x01,
+    // 0xBF '¿'
+    0x00, 0x07, 0x07, 0x00, 0x10, 0x47, 0x00, 0x22, 0x27, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x92, 0x80, 0x07, 0x82, 0x10, 0x07,
+    0x01, 0xE0, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x1F,
+    0x90, 0x00, 0x00, 0x5F, 0x80, 0x08, 0x40, 0x3F, 0x48, 0x60, 0x00, 0x1F,
+    0x08, 0x0C, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x05, 0x04, 0x00, 0x1F,
+    0x00, 0xC0, 0xE0, 0x3F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x08, 0x08, 0x40, 0x3F, 0x04, 0x60, 0x00, 0x1F,
+    0x20, 0x0C, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x09, 0x04, 0x00, 0x1F,
+    0x80, 0xC0, 0xE0, 0x3F, 0x90, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x00, 0xC3, 0x1F,
+    0x14, 0x00, 0x00, 0x5F, 0x20, 0x08, 0x40, 0x3F, 0x00, 0x60, 0x00, 0x1F,
+    0x80, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x04, 0x00, 0x1F,
+    0x08, 0xC0, 0xE0, 0x3F, 0x20, 0x08, 0x00, 0x1F, 0x0C, 0x00, 0x03, 0x1F,
+    0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0xC3, 0x1F,
+    0x48, 0x00, 0x00, 0x5F, 0x18, 0x08, 0x40, 0x3F, 0x80, 0x60, 0x00, 0x1F,
+    0x10, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x04, 0x00, 0x1F,
+    0x40, 0xC0, 0xE0, 0x3F, 0x00, 0x08, 0x00, 0x1F, 0x50, 0x00, 0x03, 0x1F,
+    0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x01, 0x86, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x80, 0x7F, 0x70, 0xC0, 0x00, 0x3F,
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x32, 0x08, 0x00, 0x3F,
+    0x01, 0x81, 0xC0, 0x7F, 0x00, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x06, 0x3F,
+    0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xCF,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x61, 0x8F,
+    0x08, 0x00, 0x00, 0x2F, 0x02, 0x04, 0x20, 0x1F, 0x08, 0x30, 0x00, 0x0F,
+    0x24, 0x06, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0x80, 0x82, 0x00, 0x0F,
+    0x42, 0x60, 0x70, 0x1F, 0x20, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x8F,
+    0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x04, 0x0F, 0x02, 0x34, 0x0F, 0x84, 0x44, 0x0F, 0x21, 0x04, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x0C, 0x40, 0xCF,
+    0x00, 0x02, 0x0F, 0x78, 0x02, 0x3F,
+    // 0xC7 'Ç'
+    0x01, 0x32, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x40, 0x0F,
+    0x21, 0x04, 0x20, 0x0F, 0x00, 0x01, 0x10, 0x0F, 0x40, 0x00, 0x90, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4C, 0x0F, 0x20, 0x00, 0x49, 0x5F,
+    0x80, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x4C, 0x0F, 0xA0, 0x00, 0x4B, 0x0F,
+    0x0C, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x50, 0x0F,
+    0x00, 0x00, 0x40, 0x0F,
+    // 0xC8 'È'
+    0x01, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x7F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x3F, 0x9F,
+    0x08, 0x40, 0x00, 0x1F, 0x28, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x04, 0x40, 0x00, 0x1F, 0x08, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x00, 0x83, 0x1F, 0x01, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F,
+    // 0xC9 'É'
+    0x01, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x7F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x3F, 0x9F,
+    0x14, 0x40, 0x00, 0x1F, 0x20, 0x40, 0x00, 0x1F, 0x08, 0x40, 0x00, 0x1F,
+    0x48, 0x40, 0x00, 0x1F, 0x80, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x9F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x00, 0x83, 0x1F, 0x01, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F,
+    // 0xCA 'Ê'
+    0x01, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x7F, 0xFF, 0x9F,
+    0x0C, 0x00, 0x00, 0x1F, 0x14, 0x00, 0x00, 0x1F, 0x04, 0x3F, 0x3F, 0x9F,
+    0x40, 0x40, 0x00, 0x1F, 0x80, 0x40, 0x00, 0x1F, 0x10, 0x40, 0x00, 0x1F,
+    0x40, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x00, 0x83, 0x1F, 0x01, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F,
+    // 0xCB 'Ë'
+    0x02, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x7E, 0x7F, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x50, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x10, 0x00, 0x01, 0x3F,
+    0x20, 0x40, 0x01, 0x3F, 0x00, 0x01, 0x06, 0x3F, 0x02, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0xBF,
+    // 0xCC 'Ì'
+    0x61, 0x40, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x5F, 0x48, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x14, 0x3F, 0xFF, 0x9F,
+    0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x7F,
+    // 0xCD 'Í'
+    0x01, 0x40, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x14, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x28, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x80, 0x00, 0x7F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    0x48, 0x40, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x90, 0x3F, 0xFF, 0x9F, 0x40, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x10, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x3F, 0x92, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    0x10, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x7F, 0xFF, 0x3F, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x81, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x20, 0x07, 0x60, 0x00, 0x27, 0x80, 0x00, 0x27, 0xBF, 0xDF, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xBF, 0x9F, 0xC7, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x20, 0x47,
+    0x80, 0x00, 0x07, 0x10, 0x00, 0x17, 0x40, 0x00, 0x07, 0x44, 0x02, 0x27,
+    0x01, 0x08, 0x07, 0x00, 0x00, 0x07, 0x08, 0x02, 0x07, 0x00, 0x68, 0x07,
+    // 0xD1 'Ñ'
+    0x01, 0x80, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x4F, 0x00, 0x7F, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x00, 0x00, 0x0F,
+    0x48, 0x44, 0x00, 0x0F, 0x18, 0x01, 0x00, 0x2F, 0x80, 0x10, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x88, 0x0F,
+    0x40, 0x00, 0x42, 0x0F, 0x00, 0x00, 0x11, 0x0F, 0x50, 0x40, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x02, 0x60, 0x0F, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x01, 0x30, 0x0F, 0x00, 0x88, 0x04, 0x2F, 0x00, 0x90, 0x00, 0x2F,
+    0x91, 0x20, 0x00, 0x8F, 0x80, 0x40, 0x00, 0x1F, 0x09, 0x00, 0x00, 0x0F,
+    0x08, 0x40, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x4F, 0x05, 0x00, 0x00, 0x1F,
+    0x09, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x18, 0x04, 0x0F, 0x00, 0x03, 0x30, 0x0F,
+    // 0xD3 'Ó'
+    0x00, 0x02, 0x60, 0x0F, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x01, 0x30, 0x0F, 0x00, 0x88, 0x04, 0x2F, 0x00, 0x90, 0x00, 0x2F,
+    0x01, 0x20, 0x00, 0x8F, 0x00, 0x40, 0x00, 0x1F, 0x15, 0x00, 0x00, 0x0F,
+    0x20, 0x40, 0x00, 0x4F, 0x08, 0x40, 0x00, 0x4F, 0x49, 0x00, 0x00, 0x1F,
+    0x81, 0x00, 0x00, 0x8F, 0x91, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x18, 0x04, 0x0F, 0x00, 0x03, 0x30, 0x0F,
+    // 0xD4 'Ô'
+    0x00, 0x02, 0x60, 0x0F, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x01, 0x30, 0x0F, 0x00, 0x88, 0x04, 0x2F, 0x0C, 0x90, 0x00, 0x2F,
+    0x15, 0x20, 0x00, 0x8F, 0x04, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x0F,
+    0x80, 0x40, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x18, 0x04, 0x0F, 0x00, 0x03, 0x30, 0x0F,
+    // 0xD5 'Õ'
+    0x00, 0x02, 0x60, 0x0F, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x01, 0x30, 0x0F, 0x00, 0x88, 0x04, 0x2F, 0x00, 0x90, 0x00, 0x2F,
+    0x09, 0x20, 0x00, 0x8F, 0x90, 0x40, 0x00, 0x1F, 0x81, 0x00, 0x00, 0x0F,
+    0x10, 0x40, 0x00, 0x4F, 0x08, 0x40, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x8F, 0x09, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x18, 0x04, 0x0F, 0x00, 0x03, 0x30, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x04, 0xC0, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x02, 0x60, 0x1F, 0x01, 0x10, 0x08, 0x5F, 0x01, 0x20, 0x00, 0x5F,
+    0x02, 0x40, 0x01, 0x1F, 0x10, 0x80, 0x00, 0x3F, 0x22, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x9F, 0x00, 0x80, 0x00, 0x9F, 0x52, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x01, 0x1F, 0x12, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x02, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x80, 0x81, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x30, 0x08, 0x1F, 0x00, 0x06, 0x60, 0x1F,
+    // 0xD7 '×'
+    0x40, 0x5F, 0x80, 0x3F, 0x80, 0x3F, 0x40, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x24, 0x9F, 0x40, 0x5F, 0x80, 0x3F, 0x80, 0x3F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x07, 0x01, 0x30, 0x07, 0x00, 0x01, 0x87, 0x10, 0x00, 0x07,
+    0x00, 0x98, 0x07, 0x44, 0x02, 0x17, 0x48, 0x00, 0x97, 0x90, 0x00, 0x47,
+    0x20, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x20, 0x00, 0x27, 0x20, 0x00, 0x27,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x47, 0x00, 0x00, 0x17, 0x08, 0x00, 0x97,
+    0x00, 0x00, 0x27, 0x00, 0x20, 0x47, 0x00, 0x00, 0x07, 0x0C, 0x02, 0x07,
+    0x81, 0x98, 0x07, 0x00, 0x00, 0x07,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x04, 0x2F, 0x90, 0x00, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x9F,
+    0x48, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x3F, 0xF2, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x00, 0x9F,
+    0x04, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x80, 0x80, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x3F, 0xF2, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x04, 0x2F, 0x14, 0x00, 0x00, 0x0F, 0x21, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x08, 0x80, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x2F,
+    0x0C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x3F, 0xF2, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x50, 0x00, 0x08, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x01, 0x3F,
+    0x70, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x30, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x50, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x7F, 0xE4, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0xC0, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x3F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x22, 0x00, 0x0F, 0x0A, 0x02, 0x2F, 0x0A, 0x02, 0x0F,
+    0x0A, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x01, 0x01, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x03, 0xFF, 0xF1,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0xA0, 0x78, 0x11, 0x20, 0x84, 0x03, 0xA1, 0x20, 0x01,
+    0x1E, 0x91, 0x03, 0x00, 0x00, 0x81, 0x40, 0x04, 0x45, 0x14, 0x02, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    // 0xE0 'à'
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x41, 0x7F, 0x30, 0x00, 0x00, 0x7F,
+    0x48, 0x00, 0x9C, 0xFF, 0x40, 0x10, 0xA0, 0x7F, 0x12, 0x50, 0x82, 0xFF,
+    0x08, 0x40, 0x00, 0x7F, 0x02, 0x40, 0x05, 0x7F, 0x00, 0x4A, 0x30, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x10, 0x00, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39,
+    0x00, 0x21, 0x40, 0x08, 0xA1, 0x05, 0x04, 0x80, 0x00, 0x40, 0x80, 0x0A,
+    0x80, 0x94, 0x60, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    // 0xE2 'â'
+    0x00, 0x00, 0x10, 0x00, 0x20, 0x82, 0x08, 0x00, 0x00, 0x02, 0x01, 0x39,
+    0x40, 0x21, 0x40, 0x08, 0xA1, 0x05, 0x80, 0x80, 0x00, 0x00, 0x80, 0x0A,
+    0x24, 0x94, 0x60, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x21, 0x00, 0x41, 0x05, 0x48, 0x00, 0x01, 0x98, 0x02, 0x73,
+    0x00, 0x42, 0x81, 0x11, 0x42, 0x0B, 0x49, 0x00, 0x01, 0x29, 0x00, 0x15,
+    0x49, 0x28, 0xC1, 0x89, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x3F, 0xF3,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x43, 0x00, 0x82, 0x0B, 0x80, 0x00, 0x03, 0x80, 0x04, 0xE7,
+    0xA0, 0x85, 0x03, 0x02, 0x84, 0x17, 0x02, 0x00, 0x03, 0x02, 0x00, 0x2B,
+    0x82, 0x51, 0x83, 0x82, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x00, 0x7F, 0xE7,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13,
+    // 0xE5 'å'
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x41, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x9C, 0xFF, 0x59, 0x10, 0xA0, 0x7F, 0x20, 0x50, 0x82, 0xFF,
+    0x22, 0x40, 0x00, 0x7F, 0x09, 0x40, 0x05, 0x7F, 0x40, 0x4A, 0x30, 0x7F,
+    0x28, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0x10, 0x20, 0x82, 0x00, 0x00, 0x01, 0x39, 0x21, 0x40, 0xA0, 0x05,
+    0x80, 0x80, 0x82, 0x00, 0x16, 0xCA, 0x00, 0x04, 0x20, 0x04, 0x46, 0x20,
+    0x02, 0x10, 0x00, 0x01, 0xA0, 0x01, 0xA0, 0x00, 0xA1, 0x01, 0x1D, 0x00,
+    0x01, 0x08, 0x00, 0x00, 0x11, 0x04,
+    // 0xE7 'ç'
+    0x03, 0x70, 0x01, 0x00, 0x04, 0x01, 0x20, 0x00, 0x01, 0x40, 0x42, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x01, 0x83, 0xA0, 0x01, 0x21, 0xA0, 0x01, 0x05,
+    0x80, 0x01, 0x09, 0x00, 0x00, 0x11, 0x00, 0x08, 0x01, 0x40, 0x02, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x05, 0x30, 0x7F, 0x00, 0x08, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x48, 0x04, 0x11, 0x7F, 0x40, 0x40, 0x00, 0x7F, 0x00, 0x50, 0x04, 0xFF,
+    0x10, 0x50, 0x00, 0xFF, 0x08, 0x50, 0x00, 0xFF, 0x02, 0x50, 0x00, 0xFF,
+    0x00, 0x42, 0x00, 0x7F, 0x00, 0x20, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x07, 0x80, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x0A, 0x60, 0x00, 0x10, 0x04, 0x00, 0x00, 0x02, 0x00, 0x08, 0x22,
+    0x00, 0x80, 0x00, 0x08, 0xA0, 0x09, 0x00, 0xA0, 0x01, 0x40, 0xA0, 0x01,
+    0x00, 0xA0, 0x01, 0x00, 0x84, 0x00, 0x20, 0x40, 0x08, 0x00, 0x00, 0x02,
+    0x00, 0x0F, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x0A, 0x60, 0x00, 0x10, 0x04, 0x04, 0x00, 0x02, 0x08, 0x08, 0x22,
+    0x20, 0x80, 0x00, 0x40, 0xA0, 0x09, 0x90, 0xA0, 0x01, 0x90, 0xA0, 0x01,
+    0x00, 0xA0, 0x01, 0x22, 0x84, 0x00, 0x0A, 0x40, 0x08, 0x00, 0x00, 0x02,
+    0x00, 0x0F, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x29, 0x83, 0x00, 0x40, 0x13, 0x80, 0x00, 0x0B, 0x80, 0x20, 0x8B,
+    0x92, 0x00, 0x03, 0x22, 0x80, 0x27, 0x02, 0x80, 0x07, 0x02, 0x80, 0x07,
+    0x82, 0x80, 0x07, 0x82, 0x10, 0x03, 0x91, 0x00, 0x23, 0x20, 0x00, 0x0B,
+    0x00, 0x3C, 0x03,
+    // 0xEC 'ì'
+    0x30, 0x00, 0x01, 0x00, 0x10, 0x02, 0x04, 0x00, 0x02, 0x20, 0x4F, 0xFC,
+    0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01,
+    // 0xED 'í'
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x05, 0x00, 0x00, 0x05, 0x04, 0x9F, 0xF9,
+    0x10, 0x00, 0x01, 0x04, 0x00, 0x01, 0x88, 0x00, 0x01, 0x90, 0x00, 0x01,
+    0x40, 0x00, 0x03,
+    // 0xEE 'î'
+    0x02, 0x00, 0x03, 0x10, 0x20, 0x05, 0x00, 0x00, 0x05, 0x08, 0x9F, 0xF9,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x44, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x02, 0x00, 0x03,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x0F, 0x80, 0x80, 0x17, 0x10, 0x00, 0x17,
+    0x42, 0x7F, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x10, 0x00, 0x0F, 0x40, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x06, 0x4C, 0x42,
+    0x22, 0x00, 0x00, 0x08, 0x00, 0x01, 0x44, 0x00, 0x04, 0x04, 0x00, 0x04,
+    0x02, 0xA0, 0x05, 0x18, 0x00, 0x00, 0x80, 0x00, 0x02, 0x02, 0x05, 0xA0,
+    0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
+    // 0xF1 'ñ'
+    0x00, 0x40, 0x03, 0x00, 0xC0, 0x0B, 0x00, 0x00, 0x0B, 0x01, 0x3F, 0xF3,
+    0x00, 0x00, 0x03, 0x40, 0x80, 0x03, 0x80, 0x10, 0x03, 0x00, 0xA0, 0x0B,
+    0x81, 0x00, 0x03, 0x40, 0x40, 0x03, 0x01, 0x40, 0x03, 0x29, 0x00, 0x0B,
+    0x81, 0x30, 0x0B, 0x11, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x58, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x01, 0x38, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x26, 0x21, 0x7F, 0x48, 0x08, 0x00, 0x7F, 0x40, 0x10, 0x00, 0xFF,
+    0x02, 0x50, 0x02, 0x7F, 0x08, 0x50, 0x02, 0x7F, 0x00, 0x40, 0x02, 0xFF,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x44, 0x01, 0x7F, 0x00, 0x02, 0x10, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x08, 0x08, 0x7F, 0x00, 0x02, 0x20, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x02, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x42,
+    0x00, 0x10, 0x00, 0x00, 0x20, 0x01, 0x08, 0xA0, 0x04, 0x20, 0xA0, 0x04,
+    0x40, 0x80, 0x05, 0x80, 0x80, 0x00, 0x00, 0x88, 0x02, 0x00, 0x04, 0x20,
+    0x00, 0x00, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x40,
+    // 0xF4 'ô'
+    0x00, 0x02, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4C, 0x42,
+    0x00, 0x10, 0x00, 0x24, 0x20, 0x01, 0x00, 0xA0, 0x04, 0x80, 0xA0, 0x04,
+    0x88, 0x80, 0x05, 0x00, 0x80, 0x00, 0x12, 0x88, 0x02, 0x0C, 0x04, 0x20,
+    0x00, 0x00, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x40,
+    // 0xF5 'õ'
+    0x00, 0x04, 0xE1, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x48, 0x98, 0x85,
+    0x88, 0x20, 0x01, 0x00, 0x40, 0x03, 0x91, 0x40, 0x09, 0x01, 0x40, 0x09,
+    0x29, 0x00, 0x0B, 0x09, 0x00, 0x01, 0x89, 0x10, 0x05, 0x30, 0x08, 0x41,
+    0x00, 0x00, 0x09, 0x00, 0x20, 0x21, 0x00, 0x08, 0x81,
+    // 0xF6 'ö'
+    0x00, 0x09, 0xC3, 0x00, 0x40, 0x03, 0x60, 0x00, 0x03, 0x11, 0x31, 0x0B,
+    0x80, 0x40, 0x03, 0x00, 0x80, 0x07, 0x02, 0x80, 0x13, 0x02, 0x80, 0x13,
+    0x62, 0x00, 0x17, 0x12, 0x00, 0x03, 0x82, 0x20, 0x0B, 0x80, 0x10, 0x83,
+    0x00, 0x00, 0x13, 0x00, 0x40, 0x43, 0x00, 0x11, 0x03,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x90, 0x0F,
+    0x80, 0x0F, 0x90, 0x47, 0x60, 0x37, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x02, 0x74, 0x10, 0x02, 0x00, 0x00, 0x40, 0x02, 0x10, 0x18,
+    0x00, 0x21, 0xA0, 0x44, 0xA0, 0x00, 0x80, 0x05, 0x80, 0x00, 0x80, 0x0A,
+    0x05, 0xE0, 0x00, 0x04, 0x10, 0x10, 0xC4, 0x40, 0x00, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x4F, 0xF0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x01, 0x7F, 0x00, 0x20, 0x08, 0x7F,
+    0x44, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x12, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x50, 0x00, 0x7F,
+    0x00, 0x4F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x40, 0x10, 0x00, 0x00, 0x09, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0xA0, 0x00,
+    0x40, 0x9F, 0xE4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0xFB 'û'
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x08, 0x40, 0x10, 0x00, 0x00, 0x09, 0x08, 0x00, 0x00,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x22, 0xA0, 0x00,
+    0x02, 0x9F, 0xE4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x02, 0x7F, 0x83, 0x00, 0x00, 0x03,
+    0x90, 0x00, 0x0B, 0x81, 0x00, 0x43, 0x90, 0x00, 0x27, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x10, 0x00, 0x2B, 0x82, 0x80, 0x03,
+    0x12, 0x7F, 0x93, 0x60, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x03,
+    // 0xFE 'þ'
+    0x60, 0x00, 0x00, 0x17, 0x20, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x17,
+    0x01, 0x40, 0x00, 0x07, 0x01, 0x40, 0x00, 0x07, 0x01, 0x00, 0x14, 0x07,
+    0x00, 0x10, 0x24, 0x07, 0x00, 0x07, 0x08, 0x07, 0x00, 0x80, 0x10, 0x07,
+    0x00, 0x00, 0x60, 0x07, 0x00, 0x06, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x6F, 0x02, 0x00, 0x00, 0x0F, 0x02, 0x60, 0x00, 0x0F,
+    0x42, 0x18, 0x00, 0x8F, 0x82, 0x00, 0x00, 0x9F, 0x82, 0xE0, 0xC1, 0x2F,
+    0xA2, 0x80, 0x32, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x60, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x30, 0x0F, 0x82, 0x90, 0xC0, 0x0F,
+    0xE2, 0x80, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x02, 0x60, 0x00, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x03, 0x00, 0x00, 0x0F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x61, 0x80, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x04, 0x20, 0x10, 0x3F, 0x30, 0x00, 0x00, 0x3F,
+    0x06, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x3F,
+    0x60, 0x70, 0x10, 0x3F, 0x04, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x80, 0x7F,
+    0x00, 0x60, 0x08, 0x7F, 0x00, 0x0C, 0x05, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    // 0x105 'ą'
+    0x00, 0x10, 0x07, 0x20, 0x82, 0x07, 0x00, 0x00, 0x07, 0x01, 0x39, 0x07,
+    0x21, 0x40, 0x07, 0xA1, 0x05, 0x07, 0x80, 0x00, 0x07, 0x80, 0x0A, 0x07,
+    0x94, 0x60, 0x47, 0x80, 0x02, 0x07, 0x00, 0x00, 0x0F, 0x1F, 0xF8, 0x87,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x04, 0x17,
+    // 0x106 'Ć'
+    0x00, 0x02, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x8F,
+    0x00, 0x42, 0x08, 0x4F, 0x00, 0x00, 0x02, 0x2F, 0x00, 0x80, 0x01, 0x2F,
+    0x00, 0x20, 0x00, 0x0F, 0x14, 0x00, 0x00, 0x9F, 0x00, 0x40, 0x00, 0x9F,
+    0x29, 0x00, 0x00, 0x8F, 0x41, 0x00, 0x00, 0x9F, 0x01, 0x40, 0x00, 0x9F,
+    0x00, 0x18, 0x00, 0x8F, 0x61, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x8F,
+    // 0x107 'ć'
+    0x00, 0x03, 0x70, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x40, 0x42,
+    0x00, 0x00, 0x10, 0x04, 0x00, 0x01, 0x00, 0xA0, 0x01, 0x20, 0xA0, 0x01,
+    0x08, 0x80, 0x01, 0x10, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x40, 0x02,
+    0x00, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x02, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x8F,
+    0x00, 0x42, 0x08, 0x4F, 0xC0, 0x00, 0x02, 0x2F, 0x80, 0x80, 0x01, 0x2F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x40, 0x00, 0x9F,
+    0x05, 0x00, 0x00, 0x8F, 0x05, 0x00, 0x00, 0x9F, 0x01, 0x40, 0x00, 0x9F,
+    0x00, 0x18, 0x00, 0x8F, 0x81, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x8F,
+    // 0x10D 'č'
+    0x00, 0x03, 0x70, 0x00, 0x00, 0x04, 0x60, 0x20, 0x00, 0x00, 0x40, 0x42,
+    0x08, 0x00, 0x10, 0x04, 0x00, 0x01, 0x10, 0xA0, 0x01, 0x20, 0xA0, 0x01,
+    0x08, 0x80, 0x01, 0x80, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x40, 0x02,
+    0x00, 0x00, 0x00,
+    // 0x10E 'Ď'
+    0x00, 0xC0, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x7F, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x01, 0x7F, 0xFF, 0x8F,
+    0x01, 0x40, 0x00, 0x0F, 0x21, 0x40, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x0F,
+    0x05, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x0F,
+    0x80, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x88, 0x04, 0x4F,
+    0x00, 0x02, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x04, 0x0F,
+    0x00, 0x00, 0xD0, 0x0F,
+    // 0x10F 'ď'
+    0x00, 0x04, 0xC1, 0x00, 0x20, 0x09, 0x00, 0x00, 0x05, 0x00, 0x98, 0x81,
+    0x00, 0x00, 0x13, 0x00, 0x40, 0x03, 0x01, 0x00, 0x03, 0x01, 0x40, 0x03,
+    0x61, 0x00, 0x01, 0x21, 0x40, 0x11, 0x81, 0x00, 0x29, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0x04, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x80, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x3F, 0xFF, 0xC0, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x9F, 0xC0, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x02, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x43, 0x3F,
+    0x10, 0x00, 0x41, 0x3F, 0x00, 0x41, 0x80, 0x7F, 0x84, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x20, 0x3F,
+    // 0x119 'ę'
+    0x0A, 0x60, 0x07, 0x10, 0x04, 0x07, 0x00, 0x02, 0x07, 0x08, 0x22, 0x07,
+    0x80, 0x00, 0x07, 0xA0, 0x09, 0x07, 0xA0, 0x01, 0xF7, 0xA0, 0x01, 0x0F,
+    0xA0, 0x00, 0x4F, 0x84, 0x01, 0x27, 0x40, 0x08, 0x0F, 0x00, 0x02, 0x0F,
+    0x0F, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x01, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x7F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x3F, 0x9F,
+    0x24, 0x40, 0x00, 0x1F, 0x04, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x80, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x9F,
+    0x80, 0x20, 0x00, 0x9F, 0x00, 0x00, 0x83, 0x1F, 0x01, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F,
+    // 0x11B 'ě'
+    0x00, 0x0A, 0x60, 0x00, 0x10, 0x04, 0xE0, 0x00, 0x02, 0x00, 0x08, 0x22,
+    0x08, 0x80, 0x00, 0x20, 0xA0, 0x09, 0x10, 0xA0, 0x01, 0x20, 0xA0, 0x01,
+    0x08, 0xA0, 0x01, 0x80, 0x84, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x02,
+    0x00, 0x0F, 0x00,
+    // 0x139 'Ĺ'
+    0x01, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x14, 0x7F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x28, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x9F,
+    // 0x13A 'ĺ'
+    0x00, 0xC0, 0x00, 0x07, 0x04, 0x40, 0x00, 0x07, 0x15, 0x40, 0x00, 0x17,
+    0x20, 0x00, 0x00, 0x07, 0x28, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17,
+    // 0x13D 'Ľ'
+    0x20, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x07, 0xFF, 0xF3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x30, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1A, 0x00, 0x03, 0x02, 0x00, 0x13,
+    0x88, 0x00, 0x03, 0x60, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x93,
+    // 0x13E 'ľ'
+    0x60, 0x00, 0x03, 0x20, 0x00, 0x03, 0xA0, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x20, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x20, 0x2F,
+    0x3F, 0xCF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0xCF,
+    0x00, 0x80, 0x0F, 0x01, 0x40, 0x0F, 0xC1, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x02, 0x4F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x60, 0x04, 0x03, 0x20, 0x0A, 0x03, 0xA0, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0xA0, 0x0B, 0x01, 0x40, 0x0B, 0x00, 0x00, 0x03,
+    // 0x143 'Ń'
+    0x01, 0x80, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x4F, 0x00, 0x7F, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x44, 0x00, 0x0F, 0x08, 0x01, 0x00, 0x2F, 0x04, 0x10, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x08, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x88, 0x0F,
+    0x80, 0x00, 0x42, 0x0F, 0x90, 0x00, 0x11, 0x0F, 0x00, 0x40, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x144 'ń'
+    0x00, 0x20, 0x01, 0x00, 0x60, 0x05, 0x00, 0x00, 0x05, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x08, 0x01, 0x00, 0x50, 0x05,
+    0x04, 0x80, 0x01, 0x10, 0x20, 0x01, 0x04, 0xA0, 0x01, 0x88, 0x80, 0x05,
+    0x90, 0x98, 0x05, 0x40, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0x147 'Ň'
+    0x01, 0x80, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x4F, 0x00, 0x7F, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xA1, 0x00, 0x00, 0x0F,
+    0x10, 0x44, 0x00, 0x0F, 0x48, 0x01, 0x00, 0x2F, 0x20, 0x10, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x24, 0x02, 0x00, 0x0F, 0x48, 0x00, 0x88, 0x0F,
+    0x10, 0x00, 0x42, 0x0F, 0xA0, 0x00, 0x11, 0x0F, 0x40, 0x40, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x148 'ň'
+    0x00, 0x20, 0x01, 0x00, 0x60, 0x05, 0x00, 0x00, 0x05, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x01, 0x80, 0x40, 0x01, 0x90, 0x08, 0x01, 0x40, 0x50, 0x05,
+    0x00, 0x80, 0x01, 0x10, 0x20, 0x01, 0x00, 0xA0, 0x01, 0x40, 0x80, 0x05,
+    0x10, 0x98, 0x05, 0x40, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x01, 0x34, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x08, 0x07,
+    0x24, 0x02, 0x07, 0x40, 0x00, 0x97, 0x50, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x47, 0x14, 0x40, 0xC7, 0x00, 0x02, 0x07,
+    0x78, 0x02, 0x27, 0x00, 0x00, 0x07,
+    // 0x153 'œ'
+    0x02, 0x70, 0x10, 0x04, 0x00, 0x02, 0x04, 0x40, 0x80, 0x09, 0x00, 0x00,
+    0xA0, 0x04, 0x80, 0x04, 0xA0, 0x01, 0x10, 0x00, 0x08, 0x00, 0x40, 0x84,
+    0x20, 0x04, 0x40, 0x00, 0x08, 0x22, 0x80, 0x00, 0xA0, 0x09, 0xA0, 0x01,
+    0xA0, 0x01, 0x80, 0x01, 0x88, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0xC0, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x4F, 0xC1, 0x7F, 0xFF, 0x8F,
+    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x7F, 0x9F, 0x8F,
+    0x21, 0x40, 0x00, 0x0F, 0x05, 0x40, 0x00, 0x4F, 0x05, 0x00, 0x80, 0x6F,
+    0x01, 0x40, 0x84, 0x0F, 0x00, 0x21, 0x21, 0x0F, 0x80, 0x00, 0x48, 0x0F,
+    0x00, 0x80, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x159 'ř'
+    0x00, 0x20, 0x03, 0x00, 0x60, 0x05, 0xA0, 0x00, 0x05, 0x80, 0x9F, 0xF9,
+    0x04, 0x00, 0x01, 0x10, 0x40, 0x01, 0x00, 0x24, 0x01, 0x24, 0x40, 0x01,
+    0x08, 0x10, 0x05, 0x00, 0x00, 0x07, 0x80, 0x90, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x20, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x03, 0x8F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x80, 0x00, 0x9F, 0x00, 0x04, 0x00, 0x1F, 0x14, 0x02, 0x00, 0x4F,
+    0x21, 0x01, 0x20, 0x4F, 0x09, 0x01, 0x00, 0x1F, 0x49, 0x00, 0x90, 0x8F,
+    0x80, 0x00, 0x01, 0x0F, 0x91, 0x0C, 0x00, 0x2F, 0x00, 0x00, 0x20, 0x4F,
+    0x00, 0x80, 0x01, 0x0F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x1C, 0x00, 0x02, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09,
+    0x04, 0x24, 0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0x01, 0x00, 0x82, 0x00,
+    0x10, 0x01, 0x02, 0x20, 0x88, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x03, 0x8F, 0x00, 0x02, 0x00, 0x0F, 0x20, 0x00, 0x02, 0x0F,
+    0x00, 0x80, 0x00, 0x9F, 0x00, 0x04, 0x00, 0x1F, 0x24, 0x02, 0x00, 0x4F,
+    0x05, 0x01, 0x20, 0x4F, 0x21, 0x01, 0x00, 0x1F, 0x49, 0x00, 0x90, 0x8F,
+    0x80, 0x00, 0x01, 0x0F, 0x81, 0x0C, 0x00, 0x2F, 0x00, 0x00, 0x20, 0x4F,
+    0x00, 0x80, 0x01, 0x0F,
+    // 0x161 'š'
+    0x00, 0x00, 0x1C, 0xE0, 0x02, 0x02, 0x00, 0x00, 0x10, 0x08, 0x00, 0x09,
+    0x24, 0x24, 0x85, 0x10, 0x80, 0x00, 0x20, 0x82, 0x01, 0x08, 0x82, 0x00,
+    0x80, 0x01, 0x02, 0x20, 0x88, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x01, 0x08, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x40, 0x00, 0x5F, 0x00, 0x40, 0x00, 0x5F,
+    0x08, 0x40, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x24, 0x00, 0x00, 0x1F, 0x48, 0x40, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x80, 0x40, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x165 'ť'
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x11, 0x00, 0x80, 0x00, 0x4C, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x58, 0x80, 0x00, 0x00, 0x00, 0x0A,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0x17, 0x08, 0x00, 0x00, 0x07, 0x02, 0x80, 0x00, 0x4F,
+    0x08, 0x00, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x42, 0x40, 0x00, 0x47, 0x20, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x1F, 0xF9, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x4F, 0xF0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x36, 0x20, 0x08, 0x7F,
+    0x40, 0x00, 0x04, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0x22, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x41, 0x00, 0x05, 0x7F, 0x20, 0x50, 0x00, 0x7F,
+    0x00, 0x4F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0x17, 0x08, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x47, 0x10, 0x00, 0x00, 0x17,
+    0x20, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x40, 0x1F, 0xF9, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x04, 0x40, 0x10, 0x22, 0x00, 0x09, 0x84, 0x00, 0x00,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x00, 0xA0, 0x00,
+    0x80, 0x9F, 0xE4, 0x90, 0x00, 0x01, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0x178 'Ÿ'
+    0x03, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x40, 0x18, 0x00, 0x3F, 0x90, 0x04, 0x00, 0xBF,
+    0x00, 0x40, 0x00, 0x3F, 0x80, 0x10, 0x40, 0x3F, 0x02, 0x00, 0x3F, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x7F, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x80, 0x40, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x03, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x00, 0xAF, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x21, 0x0F,
+    0x14, 0x00, 0x44, 0x0F, 0x00, 0x41, 0x00, 0x0F, 0x28, 0x40, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x40, 0x80, 0x8F, 0x00, 0x22, 0x00, 0x8F,
+    0x20, 0x04, 0x00, 0x8F, 0x00, 0x10, 0x03, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x4F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x84, 0x10, 0x00, 0x80, 0x00,
+    0x00, 0xA0, 0x88, 0x00, 0xA0, 0x00, 0x08, 0xA2, 0x20, 0x04, 0xA0, 0x80,
+    0x40, 0xB1, 0x00, 0x80, 0x82, 0x00, 0x20, 0x84, 0x08, 0x00, 0x90, 0x20,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x00, 0xAF, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x21, 0x0F,
+    0x40, 0x00, 0x44, 0x0F, 0x00, 0x41, 0x00, 0x0F, 0x08, 0x40, 0x00, 0x0F,
+    0x48, 0x40, 0x00, 0x0F, 0x00, 0x40, 0x80, 0x8F, 0x00, 0x22, 0x00, 0x8F,
+    0x00, 0x04, 0x00, 0x8F, 0x00, 0x10, 0x03, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x4F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x05, 0x01, 0x08, 0x21, 0x01, 0x00, 0x01,
+    0x01, 0x41, 0x11, 0x61, 0x40, 0x01, 0x01, 0x44, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x62, 0x01, 0x01, 0x04, 0x01, 0x01, 0x08, 0x11, 0x01, 0x20, 0x41,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x21,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x00, 0xAF, 0x00, 0x00, 0x02, 0x0F,
+    0xC0, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x21, 0x0F,
+    0x00, 0x00, 0x44, 0x0F, 0x00, 0x41, 0x00, 0x0F, 0x04, 0x40, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x40, 0x80, 0x8F, 0x00, 0x22, 0x00, 0x8F,
+    0x80, 0x04, 0x00, 0x8F, 0x00, 0x10, 0x03, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x4F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x40, 0x84, 0x10, 0x00, 0x80, 0x00,
+    0x08, 0xA0, 0x88, 0x20, 0xA0, 0x00, 0x10, 0xA2, 0x20, 0x10, 0xA0, 0x80,
+    0x00, 0xB1, 0x00, 0x00, 0x82, 0x00, 0x00, 0x84, 0x08, 0xC0, 0x90, 0x20,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x80, 0x02, 0x80, 0xD0, 0x98, 0x00,
+    0x80, 0x04, 0x81, 0xC0, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x99, 0xF4,
+    0x80, 0x00, 0x8F, 0xC0, 0x80, 0x08, 0x00, 0x00, 0x00, 0x02, 0x60, 0x04,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x0E, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x4C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x03, 0xE7, 0xA0, 0x02, 0x17, 0x80, 0x41, 0x87, 0x81, 0x00, 0x0F,
+    0xA2, 0x00, 0x07, 0x00, 0x90, 0x27, 0x81, 0x10, 0x27, 0x00, 0x08, 0x0F,
+    0x40, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x0C, 0xC7,
+    0x00, 0x00, 0x07,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x0F, 0x7F, 0x00, 0x7F, 0x40, 0x7F, 0x30, 0xFF, 0xC0, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x01, 0x7F, 0x04, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0x30, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x40, 0xFF, 0x14, 0xFF, 0x81, 0x7F, 0x06, 0x7F, 0x30, 0x7F,
+    // 0x201B '‛'
+    0x78, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x86, 0x7F, 0x01, 0xFF,
+    // 0x201C '“'
+    0x0F, 0x7F, 0x00, 0x7F, 0x40, 0x7F, 0x30, 0xFF, 0xC0, 0x7F, 0x00, 0x7F,
+    0x19, 0x7F, 0x40, 0x7F, 0x8C, 0x7F, 0xA1, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x01, 0x7F, 0x04, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0x30, 0x7F,
+    0x00, 0x7F, 0x20, 0x7F, 0x00, 0x7F, 0x02, 0x7F, 0x00, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x40, 0xFF, 0x14, 0xFF, 0x81, 0x7F, 0x06, 0x7F, 0x30, 0x7F,
+    0x00, 0xFF, 0x40, 0x7F, 0x80, 0xFF, 0x81, 0x7F, 0x0C, 0x7F,
+    // 0x201F '‟'
+    0x78, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x86, 0x7F, 0x01, 0xFF, 0x00, 0x7F,
+    0x4C, 0x7F, 0x81, 0x7F, 0x18, 0xFF, 0x42, 0x7F, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x01, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x94, 0x07, 0x5F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xB0, 0x03, 0xDF, 0x04, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x03, 0x01, 0x00, 0x83,
+    0x04, 0x00, 0x03, 0x9C, 0x4A, 0x63, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xB0, 0x5A, 0x63, 0x04, 0x00, 0x03, 0x01, 0x00, 0x83, 0x04, 0x04, 0x03,
+    0x04, 0x04, 0x03, 0x00, 0x00, 0x03,
+    // 0x2022 '•'
+    0x4B, 0x83, 0x83, 0x03, 0x87, 0x43, 0x03,
+    // 0x2026 '…'
+    0x27, 0x07, 0x8F, 0x87, 0x37, 0x07, 0x07, 0x07, 0x07, 0x07, 0x57, 0x8F,
+    0x8F, 0x57, 0x07, 0x07, 0x07, 0x07, 0x07, 0x67, 0x0F, 0x8F, 0x07, 0x27,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x00, 0x9F, 0x06, 0x5F, 0x50, 0x3F,
+    0x20, 0x5F, 0x40, 0x3F,
+    // 0x203A '›'
+    0x40, 0x3F, 0x00, 0x1F, 0x51, 0x3F, 0x00, 0x1F, 0x00, 0x9F, 0x10, 0x1F,
+    0x08, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x03, 0x04, 0x33, 0x20, 0x0B, 0x04, 0x03, 0x50, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x07, 0x48, 0x07, 0x40, 0x0B, 0x20, 0x03, 0x08, 0x43,
+    // 0x2074 '⁴'
+    0x00, 0x83, 0x00, 0x03, 0x02, 0x03, 0x09, 0x03, 0x00, 0x03, 0x24, 0x03,
+    0x40, 0x03, 0x00, 0x03, 0x7F, 0x9F, 0x00, 0x03, 0x00, 0x43,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x0F, 0xB0, 0x07, 0x80, 0x07, 0x9A, 0x27, 0xA2, 0x2F,
+    0xA9, 0x0F, 0xA4, 0x07, 0xA2, 0x07, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0xC3, 0x00, 0x13, 0x10, 0x03, 0x00, 0x07, 0x09, 0x13, 0x40, 0x03,
+    0x55, 0x03, 0x00, 0xE3, 0x00, 0x03, 0x60, 0x13, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x80, 0x07, 0x88, 0x07, 0xA0, 0x67, 0xA0, 0x07, 0xA0, 0x37, 0xB1, 0x87,
+    0xA6, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x23, 0x08, 0x8B, 0x01, 0x03, 0x10, 0x57, 0x04, 0x83, 0x20, 0x8B,
+    0x04, 0x03, 0x48, 0x03, 0x01, 0x03, 0x18, 0xE3,
+    // 0x2079 '⁹'
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x0B, 0x5E, 0x03, 0x00, 0x57, 0x00, 0x43,
+    0x10, 0x03, 0x08, 0x03, 0x20, 0x23, 0x08, 0x43,
+    // 0x2080 '₀'
+    0x00, 0x03, 0x08, 0x63, 0x40, 0x13, 0x08, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x20, 0x23, 0x90, 0x03, 0x00, 0x13, 0x40, 0x03, 0x00, 0x83,
+    // 0x2081 '₁'
+    0x30, 0x03, 0x00, 0x0F, 0x00, 0x07, 0x40, 0x17, 0x40, 0x07, 0x5F, 0xF7,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x08, 0x27, 0x08, 0x4F, 0x30, 0x0F, 0x00, 0x0F, 0x02, 0x4F,
+    0x20, 0x8F, 0x81, 0x0F, 0x02, 0x0F, 0x08, 0x07, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x03, 0x10, 0x1B, 0x92, 0x03, 0xA5, 0x03, 0x05, 0x03, 0x09, 0x0B,
+    0x81, 0x4B, 0x00, 0x13, 0x42, 0x23, 0x00, 0xC3,
+    // 0x2084 '₄'
+    0x01, 0x03, 0x00, 0x03, 0x04, 0x03, 0x12, 0x83, 0x00, 0x83, 0x48, 0x83,
+    0x80, 0x03, 0x00, 0x03, 0xFF, 0x3B, 0x00, 0x83, 0x00, 0x83,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x00, 0x1B, 0xB0, 0x03, 0x82, 0x03, 0x98, 0x03, 0xA2, 0x0B,
+    0xA0, 0x0B, 0xA4, 0x13, 0x22, 0x03, 0x00, 0x03,
+    // 0x2086 '₆'
+    0x01, 0x83, 0x00, 0x13, 0x00, 0x0B, 0x02, 0x0B, 0x40, 0x23, 0x88, 0x03,
+    0xA8, 0x03, 0x01, 0xCB, 0x00, 0x03, 0xC2, 0x23, 0x00, 0x03,
+    // 0x2087 '₇'
+    0x90, 0x03, 0x88, 0x03, 0x80, 0x73, 0xA0, 0x03, 0xA0, 0x2B, 0xA0, 0x83,
+    0xA2, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x2088 '₈'
+    0x00, 0x43, 0x11, 0x13, 0x06, 0x03, 0x20, 0xA3, 0x89, 0x13, 0x40, 0x13,
+    0x08, 0x03, 0x10, 0x23, 0x06, 0x03, 0x30, 0xC3,
+    // 0x2089 '₉'
+    0x00, 0x03, 0x20, 0x13, 0x00, 0x13, 0xB8, 0x03, 0x02, 0xA3, 0x00, 0x03,
+    0xA0, 0x03, 0x16, 0x03, 0x40, 0x43, 0x30, 0x83,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0x00, 0x10, 0x07, 0x00, 0xD0, 0x07, 0x00, 0x10, 0x07, 0x01, 0x05, 0x07,
+    0x00, 0x00, 0x47, 0x10, 0x00, 0x27, 0x23, 0x10, 0x07, 0x04, 0x10, 0x97,
+    0x08, 0x10, 0x07, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0x80, 0x50, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x1C, 0x00, 0x47, 0x00, 0x00, 0x17,
+    0x68, 0x00, 0x27,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x90, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7F, 0x3F, 0xFF,
+    0x00, 0xBF, 0x30, 0x3F, 0xE0, 0x3F, 0x00, 0x3F, 0xC6, 0xFF, 0x00, 0x7F,
+    0x06, 0x7F, 0x26, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x36, 0x3F, 0x88, 0xFF,
+    0x00, 0x7F, 0x23, 0x7F, 0x00, 0xFF, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x20, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x0F, 0xF2, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x11,
+    0x00, 0x00, 0x25, 0x00, 0x00, 0x19, 0x00, 0x00, 0x21, 0x00, 0x08, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x08, 0x01, 0x00, 0x20, 0x01, 0x00, 0x40, 0x01,
+    0x10, 0x00, 0x01, 0x44, 0x20, 0x09, 0x18, 0x00, 0x05, 0x20, 0x12, 0x01,
+    0x00, 0x01, 0x05, 0x00, 0x00, 0x05, 0x00, 0x21, 0x21, 0x00, 0x90, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x08, 0x01,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x20, 0x02, 0x01, 0x00, 0x02, 0x01,
+    0x40, 0x42, 0x01, 0x40, 0xA2, 0x01, 0x42, 0x42, 0x01, 0x00, 0x02, 0x01,
+    0x01, 0x00, 0x0B, 0x12, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x01, 0x21,
+    0x00, 0x00, 0x81, 0x00, 0x11, 0x01, 0x00, 0x64, 0x01, 0x00, 0x80, 0x01,
+    0x02, 0x40, 0x01, 0x09, 0x80, 0x01, 0x02, 0x20, 0x09, 0x00, 0x00, 0x05,
+    0x60, 0x12, 0x01, 0x00, 0x01, 0x05, 0x00, 0x00, 0x05, 0x00, 0x21, 0x21,
+    0x00, 0x90, 0x01, 0x00, 0x00, 0x11, 0x00, 0x08, 0x01,
+    // 0x215B '⅛'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x20, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x0F, 0xF2, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x81, 0x00, 0x01, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x03, 0x01, 0x00, 0x44, 0x01, 0x01, 0x80, 0x01, 0x02, 0x00, 0x01,
+    0x09, 0x00, 0x01, 0x22, 0x00, 0xF1, 0x00, 0x21, 0x01, 0x60, 0x00, 0x61,
+    0x00, 0xA0, 0x95, 0x00, 0x05, 0x15, 0x00, 0x00, 0x15, 0x00, 0x20, 0x91,
+    0x00, 0x02, 0x09, 0x00, 0x40, 0x01, 0x00, 0x00, 0x61,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x01, 0x08, 0x0A, 0x01, 0x29, 0x88, 0x01, 0x00, 0x0A, 0x01,
+    0x40, 0x80, 0x01, 0x42, 0x82, 0x01, 0x4C, 0x40, 0x01, 0x00, 0x04, 0x0D,
+    0x24, 0x80, 0x11, 0x00, 0x60, 0x05, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x88, 0x01, 0x02, 0x20, 0x01,
+    0x0C, 0x00, 0x01, 0x12, 0x00, 0x01, 0x44, 0x00, 0xF1, 0x00, 0x21, 0x01,
+    0x00, 0x00, 0x61, 0x00, 0xA0, 0x95, 0x00, 0x05, 0x15, 0x00, 0x00, 0x15,
+    0x00, 0x20, 0x91, 0x00, 0x02, 0x09, 0x00, 0x40, 0x01, 0x00, 0x00, 0x61,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x00, 0x0A, 0x01, 0x0D, 0x08, 0x01, 0x00, 0x08, 0x01,
+    0x0C, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x70, 0x01, 0x00, 0x04, 0x01,
+    0x11, 0x18, 0x21, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x11, 0x00, 0x04, 0x41,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x80, 0x01, 0x20, 0x00, 0x01, 0x08, 0x00, 0xF1, 0x50, 0x21, 0x01,
+    0x00, 0x00, 0x61, 0x00, 0xA0, 0x95, 0x00, 0x05, 0x15, 0x00, 0x00, 0x15,
+    0x00, 0x20, 0x91, 0x00, 0x02, 0x09, 0x00, 0x40, 0x01, 0x00, 0x00, 0x61,
+    // 0x215E '⅞'
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0E, 0x01, 0x00, 0xC2, 0x01,
+    0x01, 0x04, 0x01, 0x00, 0x40, 0x01, 0x08, 0x00, 0x21, 0x00, 0x00, 0x49,
+    0x00, 0x00, 0x31, 0x00, 0x04, 0x41, 0x00, 0x18, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x80, 0x01, 0x20, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x50, 0x00, 0xF1, 0x00, 0x21, 0x01, 0x00, 0x00, 0x61,
+    0x00, 0xA0, 0x95, 0x00, 0x05, 0x15, 0x00, 0x00, 0x15, 0x00, 0x20, 0x91,
+    0x00, 0x02, 0x09, 0x00, 0x40, 0x01, 0x00, 0x00, 0x61,
+    // 0x2190 '←'
+    0x01, 0x0F, 0x08, 0x8F, 0x10, 0x4F, 0x29, 0x2F, 0x50, 0x1F, 0x20, 0x4F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x20, 0x4F, 0x50, 0x1F,
+    0x29, 0x2F, 0x10, 0x4F, 0x08, 0x8F, 0x01, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x09, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x02, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x01, 0xAF, 0x00, 0x4F,
+    0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F,
+    0x00, 0x0F, 0x01, 0x8F, 0x00, 0x0F, 0x00, 0x0F, 0x04, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x14, 0x00, 0x1F, 0x20, 0x00, 0x9F,
+    0x40, 0x00, 0x5F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x5F,
+    0x20, 0x00, 0x9F, 0x14, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x01, 0x07, 0x00, 0x87, 0x14, 0x47, 0x25, 0x27, 0x45, 0x17, 0xA5, 0x47,
+    0x05, 0x37, 0x05, 0x07, 0x05, 0x07, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47,
+    0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x15, 0x47,
+    // 0x21D1 '⇑'
+    0x06, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x20, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+    0x24, 0x00, 0xFF, 0x14, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x06, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x05, 0x47, 0x05, 0x47,
+    0x05, 0x47, 0x05, 0x07, 0x05, 0x07, 0x05, 0x37, 0xA5, 0x47, 0x45, 0x17,
+    0x25, 0x27, 0x14, 0x47, 0x00, 0x87, 0x01, 0x07,
+    // 0x21D3 '⇓'
+    0x00, 0x10, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x04, 0x7F, 0x80, 0x02, 0x7F,
+    0x80, 0x01, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x01, 0x7F,
+    0x80, 0x22, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x7F,
+    // 0x21D4 '⇔'
+    0x02, 0x07, 0x01, 0x07, 0x02, 0x87, 0x00, 0x47, 0x05, 0x27, 0x85, 0x17,
+    0xA5, 0x37, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0xA5, 0x37,
+    0x95, 0x17, 0x05, 0x27, 0x00, 0x47, 0x02, 0x87, 0x01, 0x07, 0x02, 0x07,
+    // 0x2202 '∂'
+    0x00, 0x05, 0x21, 0x00, 0x10, 0x01, 0x00, 0x00, 0x05, 0x40, 0x4C, 0x11,
+    0x00, 0x90, 0x03, 0x80, 0x20, 0x09, 0x20, 0x40, 0x01, 0x21, 0x00, 0x11,
+    0x21, 0x40, 0x21, 0x80, 0x01, 0x81, 0x45, 0x24, 0x21, 0x20, 0x00, 0x41,
+    0x18, 0x04, 0x01, 0x01, 0xC0, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x61, 0xCF, 0x00, 0x00, 0x0F, 0x0C, 0x30, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x40, 0x0F,
+    0x0C, 0x08, 0x0F, 0x00, 0x81, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x01, 0x8F, 0x00, 0x00, 0x2F,
+    // 0x220F '∏'
+    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x3F, 0xFF, 0xFE, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x02, 0x7F, 0x20, 0x00, 0x04, 0x7F, 0x88, 0x00, 0x10, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0x30, 0x81, 0x14, 0xFF,
+    0x20, 0x00, 0x04, 0xFF, 0x24, 0x24, 0x44, 0xFF, 0x21, 0x01, 0x04, 0xFF,
+    0x20, 0x80, 0x04, 0xFF, 0x20, 0x24, 0x04, 0xFF, 0x20, 0x10, 0x04, 0xFF,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x18, 0x7F,
+    0x80, 0x00, 0x00, 0xFF, 0x18, 0x00, 0x1A, 0x7F,
+    // 0x221A '√'
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x03, 0x01, 0x9F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x60, 0x9F, 0x00, 0x01, 0x06, 0x1F, 0x00, 0x20, 0x30, 0x1F,
+    0x00, 0x80, 0x80, 0x1F, 0x10, 0x04, 0x00, 0x1F, 0xC0, 0x80, 0x00, 0x1F,
+    0x06, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x02, 0x3F, 0x20, 0x3F, 0x42, 0x7F, 0x81, 0x3F, 0x01, 0x7F, 0xA0, 0x3F,
+    0x10, 0x3F, 0x4C, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x00, 0x7F,
+    0x81, 0x3F, 0x01, 0x7F, 0x90, 0x7F, 0x40, 0xBF, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x03, 0xFF, 0xFF, 0x17, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x08, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x17, 0x00, 0x07, 0x00, 0x07, 0x02, 0x07,
+    0x04, 0x07, 0x02, 0x07, 0x24, 0x07, 0x00, 0x07, 0x60, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x08, 0xA0, 0x7F,
+    0x08, 0x90, 0x7F, 0x10, 0x50, 0x7F, 0x10, 0x48, 0x7F, 0x80, 0x28, 0x7F,
+    0x00, 0x10, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x7F, 0x60, 0x38, 0x7F, 0x90, 0x20, 0x7F, 0x40, 0x40, 0x7F,
+    0x08, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x04, 0xA0, 0x7F, 0x00, 0x00, 0x7F,
+    0x02, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x7F, 0xE0, 0x1B, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x23,
+    0x00, 0x00, 0x03,
+    // 0x22 '"'
+    0x3E, 0x3F, 0x40, 0x3F, 0x07, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x3F, 0xBF,
+    0x00, 0x3F, 0x3F, 0xBF,
+    // 0x23 '#'
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x02, 0x08, 0x3F, 0x02, 0x0B, 0x3F,
+    0x02, 0x20, 0x3F, 0x00, 0x04, 0x3F, 0x20, 0x48, 0x3F, 0x82, 0x08, 0x3F,
+    0xC2, 0x08, 0x3F, 0x02, 0x06, 0x3F, 0x02, 0x60, 0xBF, 0x08, 0x04, 0x3F,
+    0x40, 0x88, 0x3F, 0x8A, 0x08, 0x3F, 0x02, 0x08, 0x3F, 0x02, 0x10, 0x3F,
+    0x04, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x60, 0x44, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x04, 0x02, 0x07, 0x05, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x37,
+    0x0B, 0xF0, 0x00, 0x07, 0x00, 0x00, 0xF9, 0xF7, 0x4A, 0x01, 0x00, 0x07,
+    0x00, 0x04, 0x0A, 0x07, 0x01, 0x00, 0x60, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x00, 0x00, 0x01, 0x08, 0x10, 0x01, 0x00, 0x08, 0x01, 0x08, 0x20, 0x01,
+    0x10, 0x14, 0x01, 0x00, 0x04, 0x01, 0x10, 0x10, 0x05, 0x08, 0x20, 0x21,
+    0x20, 0x00, 0x01, 0x00, 0x21, 0x21, 0x00, 0x04, 0x81, 0x00, 0x02, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x90, 0x01, 0x02, 0x40, 0x01, 0x00, 0x08, 0x21,
+    0x02, 0x00, 0x01, 0x48, 0x0C, 0x21, 0x00, 0x10, 0x11, 0x00, 0x40, 0x01,
+    0x00, 0x50, 0x11, 0x00, 0x08, 0x21, 0x00, 0x20, 0x01, 0x00, 0x10, 0x21,
+    0x00, 0x03, 0x01,
+    // 0x26 '&'
+    0x00, 0x01, 0x83, 0x00, 0x08, 0x23, 0x00, 0x00, 0x03, 0x00, 0x04, 0x8B,
+    0x10, 0x00, 0x23, 0x00, 0x10, 0x03, 0x49, 0x80, 0x03, 0x00, 0x22, 0x13,
+    0x20, 0x01, 0x13, 0x20, 0x00, 0x93, 0x12, 0x82, 0x03, 0x40, 0x00, 0x23,
+    0x02, 0x00, 0x0B, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x30, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x1B,
+    // 0x27 '''
+    0x3E, 0x3F, 0x40, 0x3F, 0x07, 0xBF, 0x00, 0x3F,
+    // 0x28 '('
+    0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x80, 0x08, 0x0F, 0x02, 0x00, 0x02, 0x0F,
+    0x00, 0x40, 0x20, 0x8F, 0x10, 0x00, 0x04, 0x4F, 0x24, 0x00, 0x00, 0x2F,
+    0x40, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x2F, 0x02, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x10, 0x0F,
+    0x04, 0x06, 0x02, 0x0F, 0x01, 0x00, 0x08, 0x0F, 0x00, 0x31, 0xC0, 0x0F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0x3F, 0x08, 0xBF, 0x05, 0x3F, 0x02, 0x3F, 0x00, 0x7F,
+    0x19, 0x7F, 0x48, 0x3F, 0x00, 0x3F, 0x0C, 0x3F,
+    // 0x2B '+'
+    0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x80, 0x0F, 0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x02, 0x07,
+    // 0x2C ','
+    0x00, 0x3F, 0x01, 0x3F, 0x04, 0x3F, 0x00, 0x3F, 0x02, 0x3F, 0x08, 0x3F,
+    0x00, 0x3F,
+    // 0x2D '-'
+    0x6F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2E '.'
+    0x07, 0x47, 0x07, 0x07, 0x77,
+    // 0x2F '/'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x85, 0x00, 0x02, 0x11,
+    0x00, 0x08, 0x41, 0x00, 0x42, 0x01, 0x01, 0x08, 0x01, 0x04, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x10, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0xFC, 0x07, 0x04, 0x00, 0x87, 0x10, 0x00, 0x27, 0x21, 0x86, 0x07,
+    0x48, 0x00, 0x87, 0x10, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x44, 0x01, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x87, 0x04, 0x02, 0x07, 0x00, 0x00, 0x07,
+    // 0x31 '1'
+    0x10, 0x00, 0x0F, 0x08, 0x00, 0x2F, 0x28, 0x00, 0x2F, 0x08, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    // 0x32 '2'
+    0x0C, 0x00, 0x6F, 0x20, 0x00, 0x8F, 0x06, 0x01, 0x0F, 0x50, 0x02, 0x0F,
+    0x00, 0x04, 0x4F, 0x20, 0x09, 0x4F, 0x20, 0x12, 0x4F, 0x00, 0x24, 0x4F,
+    0x10, 0x08, 0x4F, 0x06, 0x10, 0x4F, 0x40, 0x00, 0x4F, 0x20, 0x80, 0x4F,
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x0F,
+    // 0x33 '3'
+    0x00, 0x00, 0x07, 0x24, 0x00, 0x27, 0x00, 0x00, 0x27, 0x50, 0x60, 0x2F,
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x20, 0x80, 0x47, 0x00, 0x00, 0x17,
+    0x12, 0x00, 0x07, 0x00, 0x46, 0x27, 0x00, 0x00, 0x07, 0x1E, 0x00, 0x87,
+    0x00, 0x04, 0x07,
+    // 0x34 '4'
+    0x00, 0x0A, 0x07, 0x00, 0x11, 0x07, 0x00, 0x01, 0x07, 0x00, 0x81, 0x07,
+    0x00, 0x21, 0x07, 0x04, 0x41, 0x07, 0x08, 0x01, 0x07, 0x02, 0x01, 0x07,
+    0x40, 0x01, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x7F, 0xF8, 0xF7,
+    0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x27, 0x1F, 0x40, 0x27, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x47, 0x00, 0x20, 0x17,
+    0x00, 0x10, 0x07, 0x00, 0x84, 0x27, 0x00, 0x00, 0x47, 0x00, 0x20, 0x07,
+    0x60, 0x00, 0x07,
+    // 0x36 '6'
+    0x00, 0x73, 0x07, 0x00, 0x00, 0x47, 0x04, 0x00, 0x07, 0x00, 0x21, 0x17,
+    0x00, 0x00, 0x07, 0x24, 0x00, 0x07, 0x08, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x10, 0x20, 0x07, 0x00, 0x90, 0x07, 0x20, 0x02, 0x07, 0x20, 0x00, 0x27,
+    0x00, 0x10, 0x07, 0x00, 0x00, 0x07,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x42, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x10, 0x03, 0x07, 0x10, 0x08, 0x0F, 0x10, 0x20, 0x67, 0x10, 0x82, 0x07,
+    0x10, 0x10, 0x07, 0x14, 0x40, 0x07, 0x10, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x70, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x02, 0x87, 0x09, 0x08, 0x27, 0x20, 0x90, 0x17, 0x40, 0x64, 0x87,
+    0x10, 0x00, 0x07, 0x00, 0x10, 0x07, 0x20, 0x80, 0x2F, 0x20, 0x90, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x40, 0x47, 0x40, 0x23, 0x07, 0x00, 0x10, 0x27,
+    0x1E, 0x08, 0x47, 0x00, 0x00, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x07, 0x08, 0x40, 0x17, 0x20, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x00, 0x48, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x87,
+    0x00, 0x01, 0x27, 0x00, 0x02, 0x07, 0x44, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x07, 0x04, 0x10, 0x07, 0x00, 0x00, 0x07,
+    // 0x3A ':'
+    0x00, 0x01, 0x10, 0x11, 0x00, 0x01, 0x10, 0x01, 0x60, 0x1D,
+    // 0x3B ';'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x60, 0x01, 0x0F, 0x90, 0x00, 0x0F,
+    0x10, 0x00, 0x8F, 0x80, 0x02, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x3C '<'
+    0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x08, 0x07, 0x02, 0x07, 0x14, 0x47,
+    0x01, 0x07, 0x28, 0x27, 0x00, 0x87, 0x50, 0x17, 0x00, 0x07, 0xA0, 0x0F,
+    0x00, 0x07,
+    // 0x3D '='
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xC7,
+    // 0x3E '>'
+    0x00, 0x07, 0x60, 0x37, 0x00, 0x0F, 0x10, 0x47, 0x00, 0x17, 0x28, 0x07,
+    0x00, 0x27, 0x14, 0x07, 0x01, 0x47, 0x08, 0x07, 0x00, 0x87, 0x04, 0x07,
+    0x02, 0x07,
+    // 0x3F '?'
+    0x10, 0x00, 0x03, 0x00, 0x18, 0x03, 0x10, 0x00, 0x23, 0x10, 0x00, 0x03,
+    0x10, 0x48, 0x03, 0x40, 0x40, 0x13, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03,
+    0x00, 0x20, 0x03, 0x03, 0x80, 0x03,
+    // 0x40 '@'
+    0x00, 0x1F, 0x80, 0x3F, 0x00, 0x80, 0x10, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x04, 0x40, 0x40, 0x3F, 0x09, 0x00, 0x10, 0x3F, 0x10, 0x00, 0x09, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x28, 0x00, 0x00, 0x3F, 0x00, 0xA0, 0x02, 0xBF,
+    0x50, 0x20, 0x20, 0x3F, 0x41, 0x0A, 0x80, 0x3F, 0x00, 0x88, 0x00, 0x3F,
+    0x00, 0x84, 0x20, 0x3F, 0x00, 0x04, 0x80, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x20, 0xBF, 0x50, 0x00, 0x02, 0xBF,
+    0x00, 0x00, 0x20, 0x3F, 0x20, 0x00, 0xA5, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x02, 0x40, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x02, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x21, 0x0F, 0x01, 0x00, 0x2F, 0x04, 0x30, 0x0F,
+    0x10, 0x80, 0x0F, 0x04, 0x00, 0x0F, 0x88, 0x00, 0x0F, 0x83, 0x00, 0x0F,
+    0x20, 0x40, 0x1F, 0x0C, 0x00, 0x2F, 0x01, 0x01, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x27, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xBF, 0x9F, 0xC7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x47, 0x06, 0x00, 0x17,
+    0x40, 0x47, 0x07, 0x01, 0x00, 0x27, 0x00, 0x10, 0x47, 0x00, 0x00, 0x07,
+    // 0x43 'C'
+    0x00, 0xFC, 0x07, 0x04, 0x00, 0x87, 0x00, 0x00, 0x47, 0x01, 0xFC, 0x27,
+    0x04, 0x01, 0x07, 0x40, 0x00, 0x97, 0x00, 0x00, 0x07, 0x80, 0x00, 0x47,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x02, 0x00, 0x47, 0x04, 0x00, 0x47, 0x00, 0x00, 0x67,
+    // 0x44 'D'
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x27, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xBF, 0xFF, 0xC7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x57,
+    0x10, 0x00, 0x07, 0x48, 0x00, 0x07, 0x04, 0x00, 0x07, 0x21, 0xF8, 0x47,
+    0x10, 0x00, 0x87, 0x00, 0x02, 0x07, 0x01, 0xF0, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0x9F, 0xCF, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x84, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x00, 0x01, 0xCF,
+    // 0x46 'F'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0x8F, 0xCF, 0xA0, 0x50, 0x0F, 0xA0, 0x50, 0x0F,
+    0xA0, 0x50, 0x3F, 0x80, 0x50, 0x0F, 0x80, 0x50, 0x0F, 0x80, 0x50, 0x0F,
+    0x84, 0x60, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0xFC, 0x07, 0x00, 0x00, 0x87, 0x08, 0x00, 0x47, 0x01, 0xFC, 0x27,
+    0x24, 0x01, 0x07, 0x40, 0x00, 0x97, 0x10, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x10, 0x0F, 0xA0, 0x08, 0x07,
+    0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x8C, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x78, 0x00, 0x07, 0x00, 0x08, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0x9F, 0xCF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x10, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0xA0, 0x00, 0x02, 0x3F, 0xA0, 0x00, 0x08, 0xBF,
+    0x80, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x02, 0x3F, 0x9F, 0xFF, 0xF0, 0x3F,
+    0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x27, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x9F, 0x9F, 0xC7, 0xA0, 0x10, 0x07, 0x80, 0x08, 0x27,
+    0x00, 0x44, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07, 0x48, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x80, 0x00, 0x27, 0x88, 0x00, 0x17, 0x90, 0x00, 0x07,
+    0xA0, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xA0, 0x3C, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x7C, 0x0F, 0x88, 0x00, 0x2F, 0x82, 0x00, 0x3F,
+    0x60, 0x40, 0x0F, 0x04, 0x08, 0x0F, 0x00, 0x81, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x4F, 0x00, 0xC2, 0x0F, 0x02, 0x10, 0x0F,
+    0x10, 0x80, 0x0F, 0x04, 0x00, 0x0F, 0x8C, 0x00, 0x2F, 0x80, 0x07, 0xCF,
+    0x80, 0x00, 0x0F, 0xA0, 0xF8, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x3F,
+    // 0x4E 'N'
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x27, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x04, 0x00, 0x07, 0x22, 0x00, 0x07, 0x10, 0x00, 0x37,
+    0x00, 0x40, 0x07, 0x02, 0x00, 0x07, 0x00, 0x08, 0x07, 0x00, 0x44, 0x07,
+    0x00, 0x00, 0x07, 0x40, 0x08, 0x87, 0x80, 0x04, 0x07, 0xA0, 0x00, 0x17,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x9F, 0xFF, 0xF7, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0xFC, 0x07, 0x04, 0x01, 0x07, 0x00, 0x00, 0x47, 0x20, 0xF8, 0x27,
+    0x04, 0x00, 0x07, 0x40, 0x00, 0x97, 0x00, 0x00, 0x47, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x10, 0x00, 0x17, 0x08, 0x00, 0x87, 0x42, 0x02, 0x27,
+    0x20, 0x20, 0x47, 0x10, 0x00, 0x87, 0x04, 0x02, 0x07, 0x00, 0x60, 0x07,
+    // 0x50 'P'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9F, 0xC7, 0xCF, 0x80, 0x20, 0x0F, 0x80, 0x20, 0x0F,
+    0x80, 0x20, 0x3F, 0xA0, 0x00, 0x0F, 0x80, 0x40, 0x0F, 0x00, 0x80, 0x0F,
+    0x40, 0x20, 0x0F, 0x00, 0x40, 0x0F, 0x19, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0xFC, 0x00, 0x3F, 0x04, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0xF8, 0x20, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x90, 0x3F,
+    0x10, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0xA0, 0x00, 0x04, 0x3F, 0xA0, 0x00, 0x02, 0x3F, 0xA0, 0x00, 0x08, 0x3F,
+    0x80, 0x00, 0x05, 0x3F, 0x10, 0x00, 0x10, 0x3F, 0x08, 0x00, 0x00, 0xBF,
+    0x02, 0x02, 0x22, 0x3F, 0x20, 0x20, 0x40, 0x3F, 0x10, 0x00, 0x80, 0x7F,
+    0x04, 0x02, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x52 'R'
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x27, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xBF, 0xCF, 0xC7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x27,
+    0xA0, 0x04, 0x07, 0xA0, 0x42, 0x07, 0x80, 0x00, 0x07, 0x09, 0x24, 0x47,
+    0x40, 0x02, 0x27, 0x20, 0x01, 0x17, 0x0F, 0x00, 0x87, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x03, 0xE7, 0x11, 0x00, 0x17, 0x00, 0x03, 0x07, 0x40, 0x00, 0x47,
+    0x10, 0x20, 0x07, 0x80, 0x00, 0x2F, 0xA0, 0x90, 0x2F, 0xA0, 0x00, 0x07,
+    0xA0, 0x48, 0x07, 0x80, 0x04, 0x07, 0x04, 0x20, 0x07, 0x00, 0x10, 0x07,
+    0x38, 0x08, 0x87,
+    // 0x54 'T'
+    0x04, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x8C, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x55 'U'
+    0x40, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x01, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x01, 0x17, 0x80, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x17, 0xA0, 0x01, 0x07,
+    0x80, 0x00, 0x27, 0x80, 0x00, 0x47, 0x9F, 0xFE, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x40, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x88, 0x00, 0x07,
+    0x81, 0x00, 0x07, 0x80, 0x20, 0x07, 0xAC, 0x04, 0x07, 0x80, 0x81, 0x07,
+    0x40, 0x10, 0x27, 0x00, 0x02, 0x07, 0x00, 0x00, 0x87, 0x00, 0x04, 0x17,
+    0x00, 0x20, 0x47, 0x81, 0x82, 0x07, 0x8C, 0x10, 0x07, 0x80, 0xC0, 0x07,
+    0x82, 0x00, 0x07, 0x90, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x98, 0x00, 0x07,
+    0x81, 0x00, 0x07, 0x80, 0x20, 0x07, 0xB8, 0x04, 0x07, 0x81, 0x00, 0x87,
+    0x80, 0x10, 0x17, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x00, 0x08, 0x27,
+    0x00, 0xC1, 0x07, 0x04, 0x08, 0x07, 0x20, 0x40, 0x07, 0x40, 0x00, 0x07,
+    0x40, 0x40, 0x07, 0x18, 0x08, 0x07, 0x01, 0x01, 0x07, 0x00, 0x20, 0x27,
+    0x00, 0x06, 0x07, 0x00, 0x00, 0x87, 0x00, 0x04, 0x07, 0x80, 0x60, 0x47,
+    0x86, 0x06, 0x07, 0x80, 0x20, 0x07, 0x81, 0x00, 0x07, 0x88, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x88, 0x01, 0x0F, 0x84, 0x00, 0x4F, 0x80, 0x00, 0xAF, 0x80, 0x92, 0x3F,
+    0x84, 0x04, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0x04, 0x81, 0x2F, 0x81, 0x08, 0x2F, 0x80, 0x04, 0x0F, 0x88, 0x00, 0x0F,
+    0x90, 0x00, 0x8F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x84, 0x00, 0x0F, 0x81, 0x00, 0x0F, 0xA0, 0x40, 0x2F, 0x80, 0x00, 0x0F,
+    0x41, 0x0F, 0xCF, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x01, 0x10, 0x0F,
+    0x84, 0x00, 0x0F, 0xA0, 0x80, 0x2F, 0x82, 0x00, 0x0F, 0x88, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x57, 0x80, 0x00, 0x07, 0x8C, 0x02, 0x07,
+    0x80, 0x04, 0x47, 0x80, 0x00, 0x07, 0x80, 0x22, 0x07, 0xA0, 0x04, 0x07,
+    0xA1, 0x00, 0x07, 0xA0, 0x20, 0x07, 0xA8, 0x00, 0x07, 0x91, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x88, 0x00, 0x87, 0x10, 0x00, 0x07, 0x00, 0x03, 0xC7,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x42, 0x00, 0x01, 0x10, 0x80, 0x01,
+    0x04, 0x20, 0x01, 0x00, 0x84, 0x01, 0x00, 0x21, 0x01, 0x00, 0x08, 0x41,
+    0x00, 0x01, 0x09, 0x00, 0x00, 0x41, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0x80, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x2F, 0x01, 0x0F, 0x04, 0x27, 0x00, 0x87, 0x84, 0x07,
+    0x90, 0x07, 0x88, 0x07, 0x41, 0x07, 0x08, 0x47, 0x02, 0x0F, 0x00, 0x4F,
+    0x00, 0x1F, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x00, 0x48, 0x40, 0x00, 0x02, 0x04, 0x00,
+    // 0x61 'a'
+    0x00, 0x38, 0x20, 0x00, 0x40, 0x00, 0x08, 0x08, 0xA1, 0x01, 0x81, 0x04,
+    0x80, 0x00, 0xA0, 0x02, 0x9A, 0x10, 0x00, 0x02, 0x40, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x20, 0x00, 0x01, 0x1F, 0xFF, 0xFD,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x09, 0x01, 0x40, 0x09, 0x01, 0x40, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x20, 0x05, 0x00, 0x0C, 0xC1, 0x00, 0x80, 0x01, 0x00, 0x00, 0x21,
+    0x00, 0x0F, 0x01,
+    // 0x63 'c'
+    0x07, 0x60, 0x10, 0x00, 0x20, 0x00, 0x48, 0x22, 0x00, 0x00, 0xA0, 0x08,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x00, 0x00,
+    // 0x64 'd'
+    0x00, 0x0C, 0xE1, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x90, 0x41,
+    0x00, 0x20, 0x11, 0x01, 0x40, 0x01, 0x01, 0x40, 0x01, 0x01, 0x00, 0x01,
+    0x61, 0x40, 0x01, 0x21, 0x40, 0x15, 0x1F, 0x3F, 0xE9, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x01,
+    // 0x65 'e'
+    0x06, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0xA0, 0x00, 0x08, 0x00, 0x40, 0x00, 0x20, 0x08,
+    0x00, 0x00,
+    // 0x66 'f'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x03, 0x3F, 0xF3,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x09, 0x00, 0x03, 0xA0, 0x00, 0x03,
+    0x80, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xA0, 0x40, 0x03, 0x90, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x67 'g'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x11, 0x24, 0x0B, 0x00, 0x80, 0xC3,
+    0x0C, 0x31, 0x03, 0x81, 0x08, 0x17, 0x80, 0x00, 0x17, 0x80, 0x00, 0x17,
+    0x80, 0x00, 0x17, 0xA0, 0x00, 0x13, 0x10, 0x40, 0x03, 0x00, 0x00, 0x2B,
+    0xA0, 0x01, 0x43, 0x8E, 0x00, 0x13, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03,
+    // 0x68 'h'
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x0B, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x40, 0x03, 0x01, 0x40, 0x03, 0x01, 0x40, 0x03, 0x01, 0x00, 0x03,
+    0x01, 0x10, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1F, 0xF3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    // 0x69 'i'
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x3F, 0xF3,
+    0x81, 0x00, 0x03, 0x01, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x2F,
+    0x00, 0x40, 0x00, 0x47, 0x50, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x07,
+    0x81, 0x00, 0x00, 0x47, 0x11, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x20, 0x00, 0x09, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x08, 0x09,
+    0x00, 0x10, 0x01, 0x00, 0x02, 0x21, 0x00, 0x48, 0x11, 0x00, 0x10, 0x09,
+    0x00, 0x20, 0x05, 0x00, 0x00, 0x01, 0x00, 0x40, 0x11, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x05,
+    // 0x6C 'l'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x0B, 0x20, 0x00, 0x0B, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x07,
+    // 0x6D 'm'
+    0x00, 0x01, 0x60, 0x01, 0x00, 0x05, 0x1F, 0xF9, 0x80, 0x01, 0xC0, 0x01,
+    0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0xA0, 0x01, 0xA0, 0x01, 0x80, 0x01,
+    0x88, 0x01, 0x00, 0x01, 0x00, 0x01, 0x2F, 0xF9, 0x50, 0x01, 0x00, 0x03,
+    0xA0, 0x01, 0xA0, 0x01, 0x80, 0x03, 0x90, 0x05, 0x00, 0x01, 0x40, 0x01,
+    0x10, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01,
+    // 0x6E 'n'
+    0x00, 0x01, 0x60, 0x01, 0x00, 0x05, 0x1F, 0xF9, 0x80, 0x01, 0xC0, 0x01,
+    0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0xA0, 0x01, 0xA0, 0x01, 0x80, 0x01,
+    0x90, 0x05, 0x00, 0x01, 0x40, 0x01, 0x1C, 0x01, 0x00, 0x01, 0x00, 0x05,
+    0x00, 0x01,
+    // 0x6F 'o'
+    0x06, 0x60, 0x10, 0x00, 0x00, 0x00, 0x48, 0x22, 0x00, 0x00, 0xA0, 0x00,
+    0x80, 0x05, 0x80, 0x05, 0xA0, 0x04, 0x80, 0x00, 0x00, 0x02, 0x07, 0xE0,
+    0x00, 0x00, 0x10, 0x10, 0x03, 0x80,
+    // 0x70 'p'
+    0x60, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x07, 0xF1, 0xE3, 0x50, 0x00, 0x13, 0x00, 0x00, 0x13,
+    0xA0, 0x00, 0x0B, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x80, 0x0A, 0x03,
+    0x88, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x08, 0x03, 0x08, 0x60, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x71 'q'
+    0x06, 0x60, 0x03, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x48, 0x22, 0x03,
+    0x10, 0x08, 0x03, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x0B,
+    0xA0, 0x0A, 0x03, 0xA0, 0x00, 0x13, 0x9F, 0xE7, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B,
+    // 0x72 'r'
+    0x00, 0x01, 0x60, 0x01, 0x00, 0x05, 0x1F, 0xF9, 0x80, 0x01, 0xC0, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x80, 0x03, 0x80, 0x01, 0x90, 0x01,
+    0x40, 0x01,
+    // 0x73 's'
+    0x00, 0x00, 0x20, 0x02, 0x41, 0x30, 0x18, 0x00, 0x84, 0x84, 0x80, 0x05,
+    0x82, 0x44, 0xA0, 0x00, 0x91, 0x12, 0x08, 0x00, 0x70, 0x48, 0x00, 0x00,
+    // 0x74 't'
+    0x06, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x79, 0xFF, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x75 'u'
+    0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x04, 0x80, 0x02, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x00,
+    0x1F, 0xE4, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06,
+    0x00, 0x00,
+    // 0x76 'v'
+    0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x80, 0x28, 0x20,
+    0x02, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x20, 0x41, 0x08, 0x04, 0x20,
+    0x20, 0x80, 0x02, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00,
+    // 0x77 'w'
+    0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x40, 0x28, 0x18,
+    0x01, 0x02, 0x00, 0x30, 0x00, 0x10, 0x00, 0x84, 0x04, 0x20, 0x20, 0x80,
+    0x02, 0x00, 0x40, 0x80, 0x08, 0x10, 0x01, 0x04, 0x00, 0x20, 0x00, 0x10,
+    0x40, 0xC2, 0x06, 0x10, 0x00, 0xC0, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x40, 0x00,
+    // 0x78 'x'
+    0x00, 0x03, 0x20, 0x05, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x0D,
+    0x00, 0x15, 0x40, 0x01, 0x02, 0x41, 0x04, 0x23, 0x08, 0x85, 0x24, 0x01,
+    0x08, 0x01, 0x10, 0x01, 0x20, 0x01, 0x00, 0x05, 0x00, 0x01,
+    // 0x79 'y'
+    0x40, 0x00, 0x1B, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x80, 0x23, 0x28, 0x20, 0x4B, 0x02, 0x08, 0x83, 0x40, 0x40, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x21, 0x03, 0x41, 0x08, 0x03, 0x04, 0x20, 0x03,
+    0x20, 0x80, 0x03, 0x02, 0x00, 0x03, 0x10, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x40, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x00, 0x38, 0x0A, 0x00, 0x10, 0x10, 0x00, 0x20, 0x08, 0x21, 0x10,
+    0x22, 0x00, 0x20, 0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x60, 0x02, 0x00, 0x00,
+    // 0x7B '{'
+    0x00, 0x04, 0x00, 0x0F, 0x0C, 0x01, 0x03, 0x0F, 0x20, 0x30, 0x60, 0x0F,
+    0x40, 0x06, 0x00, 0x0F, 0x10, 0xC8, 0x18, 0x8F, 0x20, 0x00, 0x00, 0x5F,
+    0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x0B, 0x81, 0x0C, 0x8F, 0x00, 0x02, 0x00, 0x2F,
+    0x00, 0x70, 0xF0, 0x4F, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x0F,
+    // 0x7E '~'
+    0x17, 0x4F, 0x17, 0xA7, 0xA7, 0x07, 0x17, 0x07, 0x2F, 0x2F, 0x0F, 0x07,
+    0x27, 0x07,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x03, 0x90, 0x01, 0xF7, 0x92, 0x00, 0x07, 0x93, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x30, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x01, 0x1E, 0x00, 0x0F, 0x00, 0x40, 0x48, 0x0F, 0x02, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x20, 0xEF, 0x7C, 0xC0, 0x00, 0x0F, 0x00, 0x7F, 0xE4, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x02, 0x20, 0x28, 0x0F,
+    0x00, 0x20, 0x20, 0x0F, 0x00, 0x80, 0x20, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x27, 0x00, 0x30, 0x0F, 0x00, 0x10, 0x4F, 0x00, 0x13, 0x07,
+    0x01, 0xC0, 0x17, 0x08, 0x00, 0x97, 0x20, 0x08, 0x07, 0x44, 0x10, 0x07,
+    0x10, 0x10, 0x07, 0x00, 0x10, 0x07, 0x20, 0x10, 0x07, 0x00, 0x50, 0x07,
+    0x10, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x04, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x40, 0x17, 0x80, 0x0F, 0x07, 0x07, 0x00, 0x07, 0x27, 0x07, 0x00, 0x17,
+    0x40, 0x17, 0x40, 0x17, 0x40, 0x17, 0x50, 0x57, 0x08, 0x87, 0x00, 0x27,
+    0x58, 0xD7, 0xA0, 0x2F, 0x40, 0x07, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x40, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x40, 0x0F,
+    0x02, 0x28, 0x0F, 0x00, 0x28, 0x0F, 0x28, 0x28, 0x2F, 0x42, 0x18, 0x0F,
+    0x00, 0x83, 0xCF, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x88, 0x0F,
+    0x42, 0x28, 0x0F, 0x28, 0xA8, 0x2F, 0x02, 0x28, 0x0F, 0x00, 0x20, 0x0F,
+    0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x03, 0x60, 0x11, 0x08, 0x08, 0x05, 0x01, 0x24, 0x21, 0x08, 0x10, 0x01,
+    0x42, 0x08, 0x0B, 0x20, 0x01, 0x03, 0x20, 0x24, 0x01, 0x00, 0x80, 0x81,
+    0x10, 0x10, 0x65, 0x40, 0x08, 0x09, 0x28, 0x00, 0x11, 0x00, 0x08, 0x41,
+    0x00, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x08, 0xF0, 0x07, 0x10, 0x02, 0x07,
+    0x28, 0x00, 0x07, 0x10, 0x00, 0x07, 0x41, 0x04, 0x17, 0x22, 0x02, 0x27,
+    0x85, 0x00, 0x27, 0x82, 0x01, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x82, 0x01, 0x07, 0x80, 0x01, 0x27, 0x20, 0x02, 0x27, 0x40, 0x00, 0x17,
+    0x10, 0x00, 0x07, 0x28, 0x00, 0x07, 0x12, 0x02, 0x07, 0x00, 0x71, 0x07,
+    0x01, 0x04, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x03, 0x00, 0x13, 0x10, 0x53, 0xA0, 0x13, 0xC8, 0x53, 0x8C, 0x13,
+    0x80, 0x13, 0x40, 0x53, 0x00, 0x53, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F, 0x50, 0x1F,
+    0x20, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F,
+    0x50, 0x1F, 0x20, 0x5F, 0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x06, 0x49, 0x10, 0x11, 0x40, 0x09, 0x08, 0x23,
+    0x80, 0x07, 0xC0, 0x81, 0xC0, 0x81, 0xC1, 0x05, 0x06, 0x47, 0x20, 0x01,
+    0x10, 0x05, 0x20, 0x29, 0x08, 0x11, 0x01, 0x01,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x01, 0x3F, 0x40, 0xBF, 0x00, 0x3F, 0x21, 0x3F, 0x20, 0x7F,
+    0x21, 0x3F, 0x12, 0x3F, 0x40, 0x3F, 0x12, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x08, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x02, 0x01, 0xFF,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x13, 0x04, 0x27, 0x50, 0x47, 0x00, 0x97, 0x01, 0x17,
+    0x02, 0x17, 0x40, 0x17, 0x00, 0x17, 0x18, 0x13, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x03, 0x20, 0x07, 0x00, 0x03, 0x42, 0x03, 0x02, 0x03, 0x20, 0x17,
+    0x18, 0x83, 0x42, 0x0B, 0x21, 0x13, 0x00, 0x03,
+    // 0xB5 'µ'
+    0x7F, 0xFF, 0xC3, 0x00, 0x00, 0x03, 0x80, 0x03, 0x03, 0x40, 0x22, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x20, 0x03, 0x00, 0x08, 0x03, 0x80, 0x04, 0x03,
+    0xFF, 0xC0, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x03,
+    // 0xB6 '¶'
+    0x01, 0x00, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x00, 0x08, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x80, 0x00, 0x04, 0x9F, 0xFF, 0xF8,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xB7 '·'
+    0x07, 0x17, 0x87, 0x87, 0x67,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x20, 0x0F, 0x00, 0x07, 0x0F, 0xF7, 0x40, 0x07, 0x5F, 0xE7,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x03, 0x20, 0x03, 0x40, 0x13, 0x21, 0x53, 0x80, 0x13, 0x80, 0x93,
+    0x80, 0x53, 0x10, 0x13, 0x40, 0x93, 0x21, 0x03, 0x00, 0x03,
+    // 0xBB '»'
+    0x00, 0x1F, 0x20, 0x1F, 0x50, 0x1F, 0x02, 0x5F, 0x00, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x50, 0x1F, 0x02, 0x5F, 0x00, 0x9F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0xBC '¼'
+    0x10, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x27, 0xF0, 0x01,
+    0x00, 0x00, 0x01, 0x0F, 0xF0, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x49, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0x01, 0x00, 0x24, 0x01, 0x00, 0x90, 0x01, 0x02, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x02, 0x01, 0x21, 0x08, 0x00, 0x21, 0x40, 0x01, 0xA1,
+    0x00, 0x10, 0x21, 0x00, 0x00, 0x21, 0x00, 0x0F, 0xB9, 0x00, 0x00, 0x05,
+    0x00, 0x7F, 0xB9, 0x00, 0x00, 0x21, 0x00, 0x00, 0x41,
+    // 0xBD '½'
+    0x10, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x27, 0xF0, 0x01,
+    0x00, 0x00, 0x01, 0x0F, 0xF0, 0x01, 0x00, 0x08, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x25, 0x00, 0x00, 0x91, 0x00, 0x02, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x12, 0x01, 0x00, 0x48, 0x01, 0x01, 0x20, 0x01, 0x04, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x04, 0x00, 0x11, 0x10, 0x00, 0x21, 0x40, 0x08, 0x41,
+    0x00, 0x20, 0x81, 0x00, 0x81, 0x01, 0x00, 0x82, 0x01, 0x00, 0x94, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x19,
+    // 0xBE '¾'
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x28, 0x02, 0x01, 0x00, 0x02, 0x01,
+    0x10, 0x8A, 0x01, 0x12, 0x80, 0x01, 0x04, 0x10, 0x01, 0x01, 0x00, 0x01,
+    0x04, 0x88, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x49, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x09, 0x01, 0x00, 0x24, 0x01, 0x00, 0x90, 0x01,
+    0x02, 0x00, 0x01, 0x08, 0x00, 0x01, 0x02, 0x00, 0x01, 0x08, 0x02, 0x21,
+    0x40, 0x00, 0xA1, 0x00, 0x02, 0x21, 0x00, 0x24, 0x21, 0x00, 0x08, 0xA1,
+    0x00, 0x00, 0x05, 0x00, 0x80, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x01,
+    // 0xBF '¿'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0x22, 0x27, 0x00, 0x00, 0x97,
+    0x00, 0x48, 0x47, 0x90, 0x00, 0x0F, 0x91, 0x80, 0x07, 0x92, 0x10, 0x07,
+    0x60, 0xE0, 0x0F, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x42, 0x1F,
+    0x00, 0x02, 0x00, 0x5F, 0x00, 0x08, 0x60, 0x1F, 0x40, 0x21, 0x00, 0x1F,
+    0x08, 0x08, 0x00, 0x1F, 0x01, 0x10, 0x00, 0x1F, 0x11, 0x06, 0x00, 0x1F,
+    0x08, 0x40, 0x80, 0x3F, 0x00, 0x18, 0x00, 0x5F, 0x00, 0x02, 0x02, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x42, 0x1F,
+    0x00, 0x02, 0x00, 0x5F, 0x00, 0x08, 0x60, 0x1F, 0x10, 0x21, 0x00, 0x1F,
+    0x00, 0x08, 0x00, 0x1F, 0x09, 0x10, 0x00, 0x1F, 0x41, 0x06, 0x00, 0x1F,
+    0x00, 0x40, 0x80, 0x3F, 0x00, 0x18, 0x00, 0x5F, 0x00, 0x02, 0x02, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x42, 0x1F,
+    0x04, 0x02, 0x00, 0x5F, 0x04, 0x08, 0x60, 0x1F, 0x48, 0x21, 0x00, 0x1F,
+    0x10, 0x08, 0x00, 0x1F, 0x81, 0x10, 0x00, 0x1F, 0x01, 0x06, 0x00, 0x1F,
+    0x08, 0x40, 0x80, 0x3F, 0x04, 0x18, 0x00, 0x5F, 0x08, 0x02, 0x02, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x42, 0x1F,
+    0x48, 0x02, 0x00, 0x5F, 0x10, 0x08, 0x60, 0x1F, 0x00, 0x21, 0x00, 0x1F,
+    0x10, 0x08, 0x00, 0x1F, 0x09, 0x10, 0x00, 0x1F, 0x21, 0x06, 0x00, 0x1F,
+    0x00, 0x40, 0x80, 0x3F, 0x08, 0x18, 0x00, 0x5F, 0x20, 0x02, 0x02, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x40, 0x00, 0x84, 0x3F,
+    0x80, 0x04, 0x00, 0xBF, 0x80, 0x10, 0xC0, 0x3F, 0x60, 0x42, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x02, 0x20, 0x00, 0x3F, 0x62, 0x0C, 0x00, 0x3F,
+    0x80, 0x81, 0x00, 0x7F, 0x80, 0x30, 0x00, 0xBF, 0x40, 0x04, 0x04, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x21, 0x0F,
+    0x10, 0x01, 0x00, 0x2F, 0x40, 0x04, 0x30, 0x0F, 0x18, 0x10, 0x80, 0x0F,
+    0x84, 0x04, 0x00, 0x0F, 0x84, 0x88, 0x00, 0x0F, 0x18, 0x83, 0x00, 0x0F,
+    0x40, 0x20, 0x40, 0x1F, 0x18, 0x0C, 0x00, 0x2F, 0x00, 0x01, 0x01, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x8F, 0x00, 0x22, 0x2F,
+    0x00, 0x84, 0x0F, 0x00, 0x24, 0x0F, 0x04, 0x04, 0x0F, 0x90, 0x04, 0x1F,
+    0x84, 0x04, 0x2F, 0x90, 0x04, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x88, 0x60, 0x4F,
+    0x84, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    // 0xC7 'Ç'
+    0x00, 0xFC, 0x00, 0x0F, 0x04, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x01, 0xFC, 0x20, 0x0F, 0x04, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x90, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x0F, 0xA0, 0x00, 0x04, 0x4F,
+    0xA0, 0x00, 0x0C, 0x0F, 0xA0, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x01, 0x8F,
+    0x90, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x40, 0x0F, 0x04, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x60, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x1F, 0x01, 0x3F, 0x3F, 0x9F,
+    0x41, 0x40, 0x00, 0x1F, 0x29, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F,
+    0x11, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x08, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x03, 0x9F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x09, 0x3F, 0x3F, 0x9F,
+    0x11, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F, 0x09, 0x40, 0x00, 0x1F,
+    0x41, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F, 0x41, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x08, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x03, 0x9F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F, 0x21, 0x3F, 0x3F, 0x9F,
+    0x49, 0x40, 0x00, 0x1F, 0x11, 0x40, 0x00, 0x1F, 0x81, 0x40, 0x00, 0x1F,
+    0x41, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F,
+    0x09, 0x00, 0x00, 0x1F, 0x01, 0x08, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x03, 0x9F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0xBF, 0x02, 0x80, 0x00, 0x3F,
+    0x12, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x3F, 0x92, 0x7E, 0x7F, 0x3F,
+    0x62, 0x80, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F,
+    0x42, 0x80, 0x00, 0x3F, 0x82, 0x80, 0x00, 0x3F, 0x92, 0x00, 0x00, 0x3F,
+    0x62, 0x00, 0x00, 0x3F, 0x02, 0x10, 0x02, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x07, 0x3F,
+    // 0xCC 'Ì'
+    0x60, 0x00, 0x00, 0x1F, 0x91, 0x40, 0x00, 0x5F, 0x41, 0x40, 0x00, 0x1F,
+    0x09, 0x00, 0x00, 0x1F, 0x21, 0x00, 0x00, 0x1F, 0x11, 0x3F, 0xFF, 0x9F,
+    0x09, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x29, 0x00, 0x00, 0x1F, 0x49, 0x3F, 0xFF, 0x9F,
+    0x01, 0x40, 0x00, 0x1F, 0x91, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x05, 0x40, 0x00, 0x5F,
+    0x09, 0x40, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x1F, 0x81, 0x00, 0x00, 0x1F,
+    0x11, 0x3F, 0xFF, 0x9F, 0x09, 0x40, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCF 'Ï'
+    0x60, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x82, 0x80, 0x00, 0xBF,
+    0x02, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x22, 0x7F, 0xFF, 0x3F, 0x12, 0x80, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x07, 0x40, 0x40, 0x07, 0x20, 0x40, 0x27, 0x20, 0x40, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xBF, 0x9F, 0xC7, 0x80, 0x40, 0x07,
+    0x80, 0x40, 0x07, 0xA0, 0x40, 0x07, 0xA0, 0x40, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x57, 0x10, 0x00, 0x07, 0x48, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x21, 0xF8, 0x47, 0x10, 0x00, 0x87, 0x00, 0x02, 0x07, 0x01, 0xF0, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x10, 0x08, 0x00, 0x0F,
+    0x48, 0x44, 0x00, 0x0F, 0x10, 0x20, 0x00, 0x6F, 0x00, 0x00, 0x80, 0x0F,
+    0x10, 0x04, 0x00, 0x0F, 0x08, 0x00, 0x10, 0x0F, 0x20, 0x00, 0x88, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x08, 0x80, 0x11, 0x0F, 0x21, 0x00, 0x08, 0x0F,
+    0x01, 0x40, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x3F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x41, 0xF0, 0x4F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x8F, 0x01, 0x40, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x11, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x10, 0x01, 0x0F,
+    0x00, 0x84, 0x04, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x01, 0x0F,
+    0x00, 0x08, 0x04, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    // 0xD3 'Ó'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x41, 0xF0, 0x4F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x8F, 0x09, 0x40, 0x00, 0x0F, 0x11, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x08, 0x00, 0x00, 0x5F, 0x41, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x10, 0x01, 0x0F,
+    0x00, 0x84, 0x04, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x01, 0x0F,
+    0x00, 0x08, 0x04, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    // 0xD4 'Ô'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x41, 0xF0, 0x4F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x80, 0x01, 0x2F,
+    0x04, 0x00, 0x00, 0x8F, 0x21, 0x40, 0x00, 0x0F, 0x49, 0x40, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x04, 0x20, 0x00, 0x2F, 0x08, 0x10, 0x01, 0x0F,
+    0x00, 0x84, 0x04, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x01, 0x0F,
+    0x00, 0x08, 0x04, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    // 0xD5 'Õ'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x41, 0xF0, 0x4F, 0x00, 0x08, 0x00, 0x0F, 0x30, 0x80, 0x01, 0x2F,
+    0x08, 0x00, 0x00, 0x8F, 0x11, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x5F, 0x08, 0x00, 0x00, 0x5F, 0x21, 0x40, 0x00, 0x0F,
+    0x41, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x10, 0x01, 0x0F,
+    0x00, 0x84, 0x04, 0x4F, 0x00, 0x40, 0x40, 0x8F, 0x00, 0x20, 0x01, 0x0F,
+    0x00, 0x08, 0x04, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x03, 0xF0, 0x1F, 0x00, 0x10, 0x04, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x83, 0xE0, 0x9F, 0x00, 0x10, 0x00, 0x1F, 0x11, 0x00, 0x02, 0x5F,
+    0x80, 0x00, 0x01, 0x1F, 0x92, 0x80, 0x00, 0x1F, 0x62, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x42, 0x80, 0x00, 0x1F,
+    0x82, 0x00, 0x00, 0x1F, 0x90, 0x40, 0x00, 0x5F, 0x60, 0x20, 0x02, 0x1F,
+    0x01, 0x08, 0x08, 0x9F, 0x00, 0x80, 0x81, 0x1F, 0x00, 0x40, 0x02, 0x1F,
+    0x00, 0x10, 0x08, 0x1F, 0x00, 0x01, 0x80, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x1F, 0xA0, 0xBF, 0x11, 0x1F, 0x0A, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x20, 0x9F, 0x40, 0x5F, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x07, 0x00, 0xFC, 0x27, 0x04, 0x01, 0x47, 0x00, 0x00, 0x07,
+    0x20, 0xF8, 0x27, 0x04, 0x02, 0x07, 0x40, 0x04, 0x97, 0x00, 0x08, 0x47,
+    0xA0, 0x10, 0x07, 0xA0, 0x20, 0x0F, 0x00, 0x40, 0x2F, 0x00, 0x80, 0x2F,
+    0xA1, 0x00, 0x07, 0x82, 0x00, 0x07, 0x94, 0x00, 0x17, 0x08, 0x00, 0x87,
+    0x42, 0x02, 0x27, 0x00, 0x20, 0x47, 0x40, 0x00, 0x87, 0x84, 0x02, 0x07,
+    0x00, 0x60, 0x07, 0x00, 0x00, 0x07,
+    // 0xD9 'Ù'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x02, 0x2F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x2F,
+    0x01, 0x40, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x8F,
+    0x01, 0x3F, 0xFC, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDA 'Ú'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x02, 0x2F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x2F,
+    0x01, 0x40, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x8F,
+    0x01, 0x3F, 0xFC, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDB 'Û'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x02, 0x2F, 0x05, 0x00, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F,
+    0x48, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F, 0x05, 0x40, 0x00, 0x2F,
+    0x09, 0x40, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x8F,
+    0x01, 0x3F, 0xFC, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xDC 'Ü'
+    0x01, 0x00, 0x00, 0x1F, 0x02, 0x80, 0x00, 0x1F, 0x02, 0x80, 0x00, 0x1F,
+    0x02, 0x00, 0x04, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x42, 0x80, 0x04, 0x5F, 0x82, 0x00, 0x00, 0x1F, 0x81, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x82, 0x80, 0x00, 0x5F,
+    0x42, 0x80, 0x04, 0x1F, 0x02, 0x00, 0x00, 0x9F, 0x02, 0x00, 0x01, 0x1F,
+    0x02, 0x7F, 0xF8, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x40, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xB3, 0xFC, 0xCF, 0x88, 0x02, 0x2F, 0x88, 0x02, 0x2F,
+    0x08, 0x02, 0x0F, 0x0A, 0x00, 0x0F, 0x08, 0x05, 0x0F, 0x01, 0x08, 0x0F,
+    0x04, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x07, 0xFF, 0xF1,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x48, 0x00, 0x01, 0x00, 0x00, 0x19,
+    0xA0, 0x00, 0x05, 0x80, 0x30, 0x11, 0x00, 0x84, 0x01, 0xA1, 0x22, 0x0B,
+    0x92, 0x80, 0x09, 0x00, 0x08, 0x01, 0x00, 0x04, 0x65, 0x08, 0x02, 0x01,
+    0x00, 0x01, 0x11, 0x00, 0x00, 0x01,
+    // 0xE0 'à'
+    0x00, 0x00, 0x1C, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x30, 0x20, 0x00, 0x7F,
+    0x48, 0x04, 0x04, 0x7F, 0x04, 0x50, 0x80, 0xFF, 0x10, 0x40, 0x82, 0x7F,
+    0x08, 0x40, 0x00, 0x7F, 0x06, 0x50, 0x01, 0x7F, 0x00, 0x4D, 0x08, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x08,
+    0x00, 0xA1, 0x01, 0x08, 0x81, 0x04, 0x24, 0x80, 0x00, 0x40, 0xA0, 0x02,
+    0x80, 0x9A, 0x10, 0x20, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0xE2 'â'
+    0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0x02, 0x40, 0x00, 0x10, 0x08, 0x08,
+    0x04, 0xA1, 0x01, 0x00, 0x81, 0x04, 0x10, 0x80, 0x00, 0x08, 0xA0, 0x02,
+    0x24, 0x9A, 0x10, 0x12, 0x00, 0x02, 0x04, 0x40, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x71, 0x00, 0x40, 0x01, 0x40, 0x80, 0x01, 0x10, 0x10, 0x11,
+    0x81, 0x42, 0x03, 0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x29, 0x40, 0x05,
+    0x09, 0x34, 0x21, 0x00, 0x00, 0x05, 0x60, 0x80, 0x01, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0xE4 'ä'
+    0x00, 0x00, 0xE3, 0x60, 0x80, 0x03, 0x91, 0x00, 0x03, 0x90, 0x20, 0x23,
+    0x22, 0x84, 0x07, 0x02, 0x04, 0x13, 0x02, 0x00, 0x03, 0x62, 0x80, 0x0B,
+    0x92, 0x68, 0x43, 0x90, 0x00, 0x0B, 0x21, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0xE5 'å'
+    0x00, 0x00, 0x1C, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x20, 0x04, 0x04, 0x7F, 0x59, 0x50, 0x80, 0xFF, 0x20, 0x40, 0x82, 0x7F,
+    0x22, 0x40, 0x00, 0x7F, 0x15, 0x50, 0x01, 0x7F, 0x00, 0x4D, 0x08, 0x7F,
+    0x1C, 0x00, 0x01, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0x38, 0x20, 0x00, 0x40, 0x00, 0x08, 0x08, 0xA1, 0x01, 0x80, 0x04,
+    0x80, 0x80, 0xA0, 0x80, 0x9A, 0x88, 0x00, 0x04, 0x20, 0x04, 0x06, 0xE2,
+    0x12, 0x00, 0xA0, 0x08, 0x80, 0x00, 0x80, 0x01, 0xA1, 0x00, 0x91, 0x00,
+    0x01, 0x00, 0x01, 0x0A, 0x0E, 0x00,
+    // 0xE7 'ç'
+    0x07, 0x60, 0x01, 0x10, 0x00, 0x01, 0x20, 0x00, 0x01, 0x48, 0x22, 0x01,
+    0x00, 0x00, 0x01, 0xA0, 0x08, 0x01, 0x80, 0x00, 0x81, 0x80, 0x00, 0x85,
+    0x80, 0x00, 0x09, 0x88, 0x00, 0x21, 0x00, 0x00, 0x01, 0x08, 0x08, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x03, 0x38, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x20, 0x40, 0x00, 0x7F,
+    0x02, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x50, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x10, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x06, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x10, 0x80, 0x00, 0x04, 0x80, 0x00,
+    0x88, 0xA0, 0x00, 0x90, 0x08, 0x00, 0x40, 0x40, 0x00, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x06, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x10, 0x80, 0x00, 0x10, 0x80, 0x00,
+    0x40, 0xA0, 0x00, 0x00, 0x08, 0x00, 0x08, 0x40, 0x00, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x19, 0xC3, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03, 0x90, 0x00, 0x0B,
+    0x80, 0x00, 0x03, 0x42, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03,
+    0x02, 0x80, 0x03, 0x90, 0x20, 0x03, 0x81, 0x00, 0x03, 0x40, 0x80, 0x23,
+    0x00, 0x00, 0x03,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x00, 0x48, 0x10, 0x00, 0x40, 0x00, 0x02, 0x00, 0x0F, 0xFC,
+    0x02, 0x40, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x05, 0x0C, 0x1F, 0xF9,
+    0x10, 0x80, 0x01, 0x40, 0x80, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07,
+    // 0xEE 'î'
+    0x04, 0x00, 0x01, 0x02, 0x20, 0x01, 0x20, 0x00, 0x05, 0x08, 0x1F, 0xF9,
+    0x10, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x07,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x90, 0x80, 0x07, 0x80, 0x00, 0x17,
+    0x00, 0x7F, 0xE7, 0x02, 0x00, 0x07, 0x02, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x07,
+    // 0xF0 'ð'
+    0x00, 0x06, 0x60, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x48, 0x22,
+    0x22, 0x10, 0x00, 0x18, 0x80, 0x00, 0x00, 0xA0, 0x05, 0x20, 0xA0, 0x05,
+    0x00, 0x20, 0x04, 0x49, 0x00, 0x00, 0x24, 0x40, 0x02, 0x40, 0x06, 0x60,
+    0x00, 0x80, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x3F, 0xF3,
+    0x01, 0x00, 0x03, 0x01, 0x80, 0x03, 0x08, 0x00, 0x03, 0x80, 0x80, 0x0B,
+    0x00, 0x00, 0x03, 0x41, 0x40, 0x03, 0x09, 0x40, 0x03, 0x29, 0x00, 0x03,
+    0x09, 0x20, 0x0B, 0x10, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x38, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x03, 0x30, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x30, 0x24, 0x11, 0x7F, 0x48, 0x00, 0x00, 0x7F, 0x04, 0x50, 0x00, 0x7F,
+    0x00, 0x40, 0x02, 0xFF, 0x08, 0x40, 0x02, 0xFF, 0x04, 0x50, 0x02, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x03, 0xF0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x08, 0x7F, 0x00, 0x01, 0xC0, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x06, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x08, 0x80, 0x05, 0x00, 0x80, 0x05,
+    0x40, 0xA0, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x03, 0x80,
+    // 0xF4 'ô'
+    0x00, 0x06, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0x22,
+    0x12, 0x00, 0x00, 0x24, 0xA0, 0x00, 0x08, 0x80, 0x05, 0x10, 0x80, 0x05,
+    0x00, 0xA0, 0x04, 0x04, 0x80, 0x00, 0x10, 0x00, 0x02, 0x04, 0x07, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x03, 0x80,
+    // 0xF5 'õ'
+    0x00, 0x0C, 0xC1, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x40, 0x90, 0x45,
+    0x00, 0x00, 0x01, 0x81, 0x40, 0x01, 0x01, 0x00, 0x0B, 0x41, 0x00, 0x0B,
+    0x29, 0x40, 0x09, 0x09, 0x00, 0x01, 0x00, 0x00, 0x05, 0x60, 0x0F, 0xC1,
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x21, 0x00, 0x07, 0x01,
+    // 0xF6 'ö'
+    0x00, 0x19, 0x83, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03, 0x81, 0x20, 0x8B,
+    0x90, 0x00, 0x03, 0x82, 0x80, 0x03, 0x02, 0x00, 0x17, 0x02, 0x00, 0x17,
+    0x02, 0x80, 0x13, 0x82, 0x00, 0x03, 0x90, 0x00, 0x0B, 0x00, 0x1F, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x43, 0x00, 0x0E, 0x03,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x95, 0x4F, 0x85, 0x0F, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x02, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x06, 0x64, 0x10, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x58,
+    0xA0, 0xA0, 0x81, 0x45, 0x82, 0x05, 0xA4, 0x04, 0x88, 0x00, 0x00, 0x0A,
+    0x06, 0x20, 0x40, 0x00, 0x90, 0x10, 0x43, 0x80, 0x00, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x48, 0x7F, 0xF8, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x0F, 0xF2, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0x00, 0x80, 0x02, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x20, 0x02, 0x10, 0x20, 0x00,
+    0x00, 0x1F, 0xE4, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0xFB 'û'
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0x04, 0x80, 0x02, 0x0A, 0xFF, 0xF0, 0x20, 0x00, 0x00, 0x08, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x02, 0x00, 0x20, 0x00,
+    0x08, 0x1F, 0xE4, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x01, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x13,
+    0x02, 0x00, 0x0B, 0x93, 0xFF, 0xC3, 0x80, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x80, 0x0B, 0x90, 0x80, 0x03,
+    0x80, 0x7F, 0x93, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x03,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x27,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x01, 0x40, 0x00, 0x17,
+    0x01, 0x40, 0x00, 0x07, 0x01, 0x40, 0x00, 0x07, 0x01, 0x00, 0x14, 0x07,
+    0x01, 0x00, 0x20, 0x07, 0x00, 0x07, 0x08, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x00, 0x20, 0x40, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x01, 0x00, 0x00, 0x6F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x60, 0x10, 0x00, 0x1F, 0x90, 0x02, 0x00, 0x8F, 0x90, 0xA0, 0x81, 0x2F,
+    0x20, 0x08, 0x22, 0x0F, 0x01, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x60, 0x00, 0x84, 0x0F, 0x91, 0x04, 0x20, 0x0F, 0x90, 0x10, 0x80, 0x0F,
+    0x60, 0x82, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x21, 0x00, 0x3F,
+    0x01, 0x00, 0x20, 0x3F, 0x04, 0x30, 0x00, 0x3F, 0x10, 0x80, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x88, 0x00, 0x00, 0x3F, 0x83, 0x00, 0x00, 0x3F,
+    0x20, 0x40, 0x10, 0x3F, 0x0C, 0x00, 0x23, 0x3F, 0x01, 0x01, 0x00, 0x3F,
+    0x00, 0x20, 0x08, 0x7F, 0x00, 0x04, 0x01, 0x3F, 0x00, 0x01, 0x08, 0x3F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0xBF, 0x00, 0x00, 0x10, 0x3F,
+    // 0x105 'ą'
+    0x00, 0x38, 0x07, 0x20, 0x00, 0x07, 0x40, 0x00, 0x07, 0x08, 0x08, 0x07,
+    0xA1, 0x01, 0x07, 0x81, 0x04, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x02, 0x07,
+    0x9A, 0x10, 0x27, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x00, 0x08, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x07,
+    // 0x106 'Ć'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x03, 0xF8, 0x4F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x80, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x8F, 0x01, 0x40, 0x00, 0x0F,
+    0x29, 0x40, 0x00, 0x1F, 0x09, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F,
+    0x91, 0x20, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x08, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0xCF,
+    // 0x107 'ć'
+    0x00, 0x07, 0x60, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x48, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0x08, 0x10, 0x80, 0x00, 0x24, 0x80, 0x00,
+    0x88, 0x80, 0x00, 0x90, 0x88, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x00, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x01, 0xF8, 0x0F, 0x00, 0x08, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x03, 0xF8, 0x4F, 0x40, 0x08, 0x02, 0x0F, 0x80, 0x80, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x8F, 0x05, 0x40, 0x00, 0x0F,
+    0x05, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F,
+    0x81, 0x20, 0x00, 0x0F, 0x80, 0x04, 0x00, 0x8F, 0x00, 0x08, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0xCF,
+    // 0x10D 'č'
+    0x00, 0x07, 0x60, 0x00, 0x10, 0x00, 0x40, 0x20, 0x00, 0x90, 0x48, 0x22,
+    0x48, 0x00, 0x00, 0x24, 0xA0, 0x08, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
+    0x48, 0x80, 0x00, 0x10, 0x88, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x00, 0x00, 0x00,
+    // 0x10E 'Ď'
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x0F,
+    0x41, 0x00, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x0F, 0x01, 0x7F, 0xFF, 0x8F,
+    0x01, 0x00, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0x05, 0x40, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x41, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xAF,
+    0x80, 0x20, 0x00, 0x0F, 0x00, 0x90, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F,
+    0x00, 0x43, 0xF0, 0x8F, 0x00, 0x20, 0x01, 0x0F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x03, 0xE0, 0x0F,
+    // 0x10F 'ď'
+    0x00, 0x0C, 0xE1, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x90, 0x41,
+    0x00, 0x20, 0x11, 0x01, 0x40, 0x01, 0x01, 0x40, 0x01, 0x01, 0x00, 0x01,
+    0x61, 0x40, 0x01, 0x21, 0x40, 0x15, 0x1F, 0x3F, 0xE9, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x60, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x20, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x9F, 0x9F, 0xC0, 0x3F,
+    0xA0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x01, 0x3F,
+    0xA0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x08, 0x7F, 0x80, 0x00, 0x05, 0x3F,
+    0x80, 0x00, 0x08, 0x3F, 0x84, 0x00, 0x80, 0x7F, 0x00, 0x02, 0x00, 0xBF,
+    0x00, 0x01, 0xC0, 0x3F,
+    // 0x119 'ę'
+    0x06, 0x70, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x67, 0x80, 0x01, 0x07,
+    0xA0, 0x00, 0x4F, 0x08, 0x01, 0x07, 0x40, 0x00, 0x0F, 0x20, 0x08, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0xA1, 0x00, 0x00, 0x1F, 0x91, 0x00, 0x00, 0x1F, 0x49, 0x3F, 0x3F, 0x9F,
+    0x21, 0x40, 0x00, 0x1F, 0x05, 0x40, 0x00, 0x1F, 0x25, 0x40, 0x00, 0x1F,
+    0x49, 0x40, 0x00, 0x1F, 0x11, 0x40, 0x00, 0x1F, 0xA1, 0x00, 0x00, 0x1F,
+    0x41, 0x00, 0x00, 0x1F, 0x01, 0x08, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x03, 0x9F,
+    // 0x11B 'ě'
+    0x00, 0x06, 0x70, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x90, 0x00, 0x02,
+    0x48, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
+    0x48, 0xA0, 0x00, 0x10, 0x08, 0x00, 0x80, 0x40, 0x00, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x00,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F, 0x01, 0x40, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x29, 0x00, 0x00, 0x1F, 0x49, 0x3F, 0xFF, 0x9F,
+    0x01, 0x40, 0x00, 0x1F, 0x91, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x03, 0x1F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x17, 0x10, 0x40, 0x00, 0x17,
+    0x01, 0x00, 0x00, 0x07, 0x29, 0x00, 0x00, 0x07, 0x09, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0F,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x03, 0x28, 0x00, 0x0B, 0x28, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x27, 0xFF, 0xF3, 0x28, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x82, 0x00, 0x03,
+    0x08, 0x00, 0x13, 0x00, 0x00, 0x43, 0x00, 0x00, 0x03, 0x00, 0x00, 0x63,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x0B, 0x20, 0x00, 0x0B, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x1E, 0x00, 0x07, 0x82, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0xA0, 0x08, 0x2F,
+    0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x9F, 0x1F, 0xCF,
+    0xA0, 0x80, 0x0F, 0x80, 0x40, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x07, 0x20, 0x02, 0x0B, 0x20, 0x00, 0x0B,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x80, 0x0B, 0x00, 0x40, 0x07, 0x00, 0x00, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F,
+    0x00, 0x44, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x6F, 0x10, 0x00, 0x80, 0x0F,
+    0x00, 0x04, 0x00, 0x0F, 0x08, 0x00, 0x10, 0x0F, 0x40, 0x00, 0x88, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x11, 0x0F, 0x01, 0x00, 0x08, 0x0F,
+    0x01, 0x40, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x3F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x144 'ń'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x01, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xF9,
+    0x00, 0x80, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x05,
+    0x0C, 0x00, 0x01, 0x10, 0xA0, 0x01, 0x40, 0xA0, 0x01, 0x80, 0x80, 0x01,
+    0x00, 0x90, 0x05, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x1C, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0x147 'Ň'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F,
+    0x80, 0x44, 0x00, 0x0F, 0x40, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x80, 0x0F,
+    0x04, 0x04, 0x00, 0x0F, 0x04, 0x00, 0x10, 0x0F, 0x08, 0x00, 0x88, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0xA0, 0x80, 0x11, 0x0F, 0xC1, 0x00, 0x08, 0x0F,
+    0x01, 0x40, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x3F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x148 'ň'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x01, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xF9,
+    0x00, 0x80, 0x01, 0x20, 0xC0, 0x01, 0x10, 0x00, 0x01, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x00, 0xA0, 0x01, 0x20, 0xA0, 0x01, 0x48, 0x80, 0x01,
+    0x80, 0x90, 0x05, 0xC0, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x1C, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x00, 0xF8, 0x07, 0x04, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0xF8, 0x07,
+    0x24, 0x00, 0x07, 0x08, 0x00, 0x87, 0x50, 0x00, 0x17, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x27,
+    0x9F, 0xFF, 0xC7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x9F, 0x9F, 0xC7,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x98, 0x60, 0x47, 0x84, 0x00, 0x07,
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x07,
+    // 0x153 'œ'
+    0x06, 0x60, 0x10, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x08, 0xA0, 0x01,
+    0x80, 0x05, 0xA0, 0x05, 0xA0, 0x00, 0x80, 0x08, 0x08, 0x12, 0x00, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x40, 0x02, 0x20, 0x08, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x4F, 0x40, 0x40, 0x00, 0x0F,
+    0x81, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x7F, 0x9F, 0x8F,
+    0x05, 0x00, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x4F, 0x01, 0x40, 0x08, 0x0F,
+    0x01, 0x40, 0x84, 0x0F, 0x81, 0x00, 0x00, 0x0F, 0x80, 0x12, 0x48, 0x8F,
+    0x00, 0x80, 0x04, 0x4F, 0x00, 0x40, 0x02, 0x2F, 0x00, 0x1E, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x159 'ř'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x01, 0x20, 0x00, 0x05, 0x00, 0x1F, 0xF9,
+    0x00, 0x80, 0x01, 0x10, 0xC0, 0x01, 0x10, 0x00, 0x01, 0x24, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x80, 0x80, 0x03, 0x40, 0x80, 0x01, 0x00, 0x90, 0x01,
+    0x00, 0x40, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x07, 0xCF, 0x00, 0x22, 0x00, 0x2F, 0x00, 0x00, 0x06, 0x0F,
+    0x00, 0x80, 0x00, 0x8F, 0x08, 0x20, 0x40, 0x0F, 0x11, 0x00, 0x00, 0x5F,
+    0x01, 0x41, 0x20, 0x5F, 0x09, 0x40, 0x00, 0x0F, 0x41, 0x40, 0x90, 0x0F,
+    0x01, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x40, 0x0F, 0x00, 0x00, 0x20, 0x0F,
+    0x00, 0x70, 0x11, 0x0F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x41, 0x30, 0x00, 0x18, 0x00,
+    0x00, 0x84, 0x84, 0x10, 0x80, 0x05, 0x04, 0x82, 0x44, 0x88, 0xA0, 0x00,
+    0x90, 0x91, 0x12, 0x40, 0x08, 0x00, 0x00, 0x70, 0x48, 0x00, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x07, 0xCF, 0x00, 0x22, 0x00, 0x2F, 0x80, 0x00, 0x06, 0x0F,
+    0x90, 0x80, 0x00, 0x8F, 0x48, 0x20, 0x40, 0x0F, 0x21, 0x00, 0x00, 0x5F,
+    0x05, 0x41, 0x20, 0x5F, 0x05, 0x40, 0x00, 0x0F, 0x09, 0x40, 0x90, 0x0F,
+    0x11, 0x00, 0x08, 0x0F, 0xA0, 0x08, 0x40, 0x0F, 0xC0, 0x00, 0x20, 0x0F,
+    0x00, 0x70, 0x11, 0x0F,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x40, 0x20, 0x02, 0x90, 0x41, 0x30, 0x48, 0x18, 0x00,
+    0x04, 0x84, 0x84, 0x00, 0x80, 0x05, 0x00, 0x82, 0x44, 0x48, 0xA0, 0x00,
+    0x10, 0x91, 0x12, 0x80, 0x08, 0x00, 0x00, 0x70, 0x48, 0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x00, 0x08, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F,
+    0x41, 0x00, 0x00, 0x1F, 0x81, 0x40, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x5F,
+    0x09, 0x40, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F,
+    0x21, 0x00, 0x00, 0x1F, 0x41, 0x40, 0x00, 0x1F, 0x81, 0x40, 0x00, 0x1F,
+    0x81, 0x40, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x20, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x01, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x165 'ť'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x9F, 0xF0, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
+    // 0x16E 'Ů'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0xA0, 0x01, 0x17, 0x10, 0x80, 0x00, 0x07, 0x40, 0x40, 0x00, 0x07,
+    0x18, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x0F, 0x84, 0x00, 0x00, 0x07,
+    0x18, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x18, 0xA0, 0x00, 0x17,
+    0x00, 0xA0, 0x01, 0x07, 0x00, 0x80, 0x00, 0x27, 0x00, 0x80, 0x00, 0x47,
+    0x00, 0x9F, 0xFE, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x14, 0x7F, 0xF8, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0xFF, 0x22, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x10, 0x01, 0x7F, 0x22, 0x10, 0x00, 0x7F,
+    0x00, 0x0F, 0xF2, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x04, 0xA0, 0x01, 0x17, 0x0A, 0x80, 0x00, 0x07, 0x10, 0x40, 0x00, 0x07,
+    0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x0A, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x17,
+    0x04, 0xA0, 0x01, 0x07, 0x00, 0x80, 0x00, 0x27, 0x00, 0x80, 0x00, 0x47,
+    0x10, 0x9F, 0xFE, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0x00, 0x80, 0x02, 0x0C, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x08, 0x20, 0x02, 0x20, 0x20, 0x00,
+    0x00, 0x1F, 0xE4, 0x10, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    // 0x178 'Ÿ'
+    0x01, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x22, 0x10, 0x00, 0x3F, 0x12, 0x04, 0x00, 0x3F,
+    0x82, 0x81, 0x00, 0xBF, 0x12, 0x00, 0x00, 0x3F, 0x01, 0x04, 0x3F, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x04, 0x40, 0x3F,
+    0x82, 0x10, 0x00, 0x3F, 0x12, 0x82, 0x00, 0xBF, 0x02, 0x08, 0x00, 0x3F,
+    0x02, 0x20, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x18, 0x04, 0x0F, 0x01, 0x00, 0x08, 0x8F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x44, 0x0F, 0x01, 0x40, 0x08, 0x0F, 0x29, 0x42, 0x00, 0x0F,
+    0x49, 0x40, 0x40, 0x0F, 0x01, 0x50, 0x00, 0x0F, 0x91, 0x22, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x10, 0x01, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x8F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x0A, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x00, 0x20, 0x08, 0x00, 0x21, 0x10, 0x08, 0x22, 0x00, 0x24, 0x20, 0x80,
+    0x40, 0x21, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x60, 0x02, 0x00, 0x00, 0x00,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x18, 0x04, 0x0F, 0x01, 0x00, 0x08, 0x8F, 0x01, 0x00, 0x00, 0x0F,
+    0x31, 0x00, 0x44, 0x0F, 0x09, 0x40, 0x08, 0x0F, 0x09, 0x42, 0x00, 0x0F,
+    0x41, 0x40, 0x40, 0x0F, 0x01, 0x50, 0x00, 0x0F, 0x01, 0x22, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x10, 0x01, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x8F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x01, 0x00, 0x70, 0x15, 0x00, 0x00, 0x21, 0x00, 0x20, 0x01,
+    0x00, 0x40, 0x11, 0x30, 0x42, 0x21, 0x08, 0x44, 0x01, 0x08, 0x41, 0x01,
+    0x40, 0x42, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0xC0, 0x05, 0x00, 0x00, 0x01,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0x0F,
+    0x41, 0x18, 0x04, 0x0F, 0x81, 0x00, 0x08, 0x8F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x44, 0x0F, 0x05, 0x40, 0x08, 0x0F, 0x05, 0x42, 0x00, 0x0F,
+    0x01, 0x40, 0x40, 0x0F, 0x01, 0x50, 0x00, 0x0F, 0x81, 0x22, 0x00, 0x0F,
+    0x81, 0x00, 0x00, 0x0F, 0x01, 0x10, 0x01, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x8F,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x0A, 0x00, 0x00, 0x10, 0x80, 0x10, 0x00,
+    0x00, 0x20, 0x08, 0x24, 0x21, 0x10, 0x10, 0x22, 0x00, 0x10, 0x20, 0x80,
+    0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x60, 0x02, 0x00, 0x00, 0x00,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x00,
+    0x00, 0x06, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x02, 0x0F, 0xC0, 0x00, 0x08, 0x80, 0x00, 0x80, 0x02, 0xC0, 0x04,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x48, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x80, 0x01, 0xE7, 0xA0, 0x02, 0x17, 0xA0, 0x00, 0x87, 0xA0, 0x20, 0x47,
+    0xA2, 0x00, 0x0F, 0x88, 0x80, 0x2F, 0x00, 0x10, 0x2F, 0x04, 0x40, 0x07,
+    0x50, 0x04, 0x07, 0x00, 0x20, 0x17, 0x00, 0x10, 0x27, 0x00, 0x04, 0x87,
+    0x00, 0x00, 0x07,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x06, 0x7F, 0x20, 0xFF, 0x40, 0xFF, 0xA2, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x41, 0xFF, 0x9C, 0x7F, 0x81, 0x7F, 0x04, 0x7F, 0x00, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x7F, 0x01, 0xFF, 0x1C, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x00, 0x7F,
+    // 0x201B '‛'
+    0x30, 0x7F, 0x82, 0x7F, 0x81, 0x7F, 0x22, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x06, 0x7F, 0x20, 0xFF, 0x40, 0xFF, 0xA2, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    0x09, 0x7F, 0x00, 0xFF, 0x0C, 0xFF, 0x81, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x41, 0xFF, 0x9C, 0x7F, 0x81, 0x7F, 0x04, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0x82, 0x7F, 0x48, 0x7F,
+    // 0x201E '„'
+    0x00, 0x7F, 0x01, 0xFF, 0x1C, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F, 0x62, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x48, 0x7F,
+    // 0x201F '‟'
+    0x30, 0x7F, 0x82, 0x7F, 0x81, 0x7F, 0x22, 0xFF, 0x00, 0x7F, 0x00, 0x7F,
+    0x48, 0x7F, 0x80, 0x7F, 0x98, 0x7F, 0x40, 0xFF, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x05, 0x00, 0x1F,
+    0x01, 0x00, 0x1F, 0x61, 0x00, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x41, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x05, 0x00, 0x1F, 0x04, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x83, 0x04, 0x00, 0x83, 0x05, 0x00, 0x03,
+    0x01, 0x00, 0x03, 0x61, 0x32, 0x1B, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x41, 0x22, 0x1B, 0x01, 0x00, 0x03, 0x05, 0x00, 0x03, 0x04, 0x00, 0x83,
+    0x04, 0x00, 0x83, 0x00, 0x00, 0x03,
+    // 0x2022 '•'
+    0x33, 0x03, 0x87, 0x07, 0x83, 0x4B, 0x03,
+    // 0x2026 '…'
+    0x07, 0x07, 0x07, 0x07, 0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x57, 0x07,
+    0x07, 0x57, 0x07, 0x07, 0x07, 0x07, 0x07, 0x37, 0x07, 0x07, 0x07, 0x07,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F, 0x50, 0x1F,
+    0x20, 0x5F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x20, 0x1F, 0x50, 0x1F, 0x02, 0x5F, 0x00, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F,
+    // 0x2070 '⁰'
+    0x00, 0x03, 0x0C, 0x23, 0x00, 0x0B, 0x07, 0xC7, 0x50, 0x13, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x17, 0x40, 0x23, 0x00, 0x0B, 0x00, 0x13, 0x07, 0x83,
+    // 0x2074 '⁴'
+    0x00, 0x23, 0x01, 0x03, 0x02, 0x03, 0x01, 0x03, 0x12, 0x03, 0x20, 0x03,
+    0x40, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x23,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x0F, 0x70, 0x07, 0x80, 0x07, 0xA8, 0x07, 0x8A, 0x2F,
+    0x80, 0x47, 0x84, 0x17, 0x82, 0x27, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x03, 0x04, 0x13, 0x00, 0x03, 0x01, 0x27, 0x0C, 0x03, 0x05, 0x03,
+    0x41, 0x03, 0x00, 0x87, 0x22, 0x03, 0x01, 0x13, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x70, 0x07, 0x80, 0x07, 0x80, 0x2F, 0x81, 0x07, 0x84, 0x27, 0x81, 0x07,
+    0xA4, 0x07, 0x88, 0x07, 0x80, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x03, 0x1C, 0x0B, 0x02, 0x07, 0x58, 0x07, 0x00, 0x03, 0x20, 0x0B,
+    0x00, 0x03, 0x48, 0x27, 0x00, 0x03, 0x00, 0x73,
+    // 0x2079 '⁹'
+    0x00, 0x03, 0x01, 0x0F, 0x00, 0x8B, 0x52, 0x03, 0x00, 0x07, 0x01, 0x07,
+    0x01, 0x43, 0x4E, 0x03, 0x20, 0x23, 0x18, 0x83,
+    // 0x2080 '₀'
+    0x00, 0x03, 0x18, 0x43, 0x00, 0x13, 0x0F, 0x8B, 0x80, 0x23, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x80, 0x4B, 0x00, 0x13, 0x00, 0x23, 0x0F, 0x03,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x20, 0x0F, 0x00, 0x07, 0x0F, 0xF7, 0x40, 0x07, 0x5F, 0xF7,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x2F, 0x08, 0x4F, 0xA0, 0x8F, 0x01, 0x2F, 0x00, 0x2F,
+    0x04, 0x2F, 0x80, 0x2F, 0x00, 0x2F, 0x30, 0x2F, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x03, 0x40, 0x1B, 0x00, 0x03, 0x80, 0x03, 0x04, 0x03, 0x00, 0x2B,
+    0xB1, 0x03, 0x84, 0x13, 0x48, 0x23, 0x00, 0x03,
+    // 0x2084 '₄'
+    0x00, 0x43, 0x02, 0x03, 0x04, 0x03, 0x02, 0x83, 0x24, 0x83, 0x40, 0x83,
+    0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x00, 0x43,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x00, 0x1B, 0x70, 0x03, 0x80, 0x03, 0xAA, 0x03, 0x8A, 0x2B,
+    0x81, 0x43, 0x84, 0x13, 0x82, 0x23, 0x00, 0x03,
+    // 0x2086 '₆'
+    0x00, 0x03, 0x08, 0x03, 0x00, 0x03, 0x02, 0x4B, 0x4A, 0x03, 0x02, 0x03,
+    0x80, 0x03, 0x01, 0x0B, 0x44, 0x03, 0x00, 0x23, 0x00, 0x03,
+    // 0x2087 '₇'
+    0x70, 0x03, 0x80, 0x03, 0xA0, 0x3B, 0x81, 0x03, 0x84, 0x33, 0x80, 0x03,
+    0xA0, 0x03, 0x88, 0x03, 0x80, 0x03, 0x00, 0x03,
+    // 0x2088 '₈'
+    0x00, 0x03, 0x38, 0x13, 0x04, 0x0B, 0xB0, 0x03, 0x80, 0x13, 0x41, 0x13,
+    0x00, 0x03, 0x90, 0x6B, 0x00, 0x03, 0x00, 0xE3,
+    // 0x2089 '₉'
+    0x00, 0x03, 0x22, 0x0B, 0x01, 0x13, 0xA4, 0x03, 0x02, 0x03, 0x02, 0x8B,
+    0x82, 0x83, 0x9A, 0x03, 0x40, 0x43, 0x11, 0x03,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x08, 0x07, 0x00, 0xD0, 0x07, 0x00, 0x10, 0x07, 0x00, 0x06, 0x07,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x12, 0x07, 0x00, 0x10, 0x97,
+    0x40, 0x10, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x30, 0x00, 0x47,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0xA0, 0x3F, 0x80, 0x7F, 0xBF, 0xFF, 0x80, 0x7F, 0x80, 0xFF,
+    0x80, 0x7F, 0xA0, 0x3F, 0x60, 0x3F, 0x00, 0x7F, 0x41, 0xFF, 0x80, 0x7F,
+    0x88, 0xFF, 0x64, 0x3F, 0x08, 0x3F, 0x04, 0x3F, 0x14, 0x3F, 0x00, 0x7F,
+    0x80, 0x7F, 0x9F, 0x7F, 0x00, 0x7F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x10, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x27, 0xF0, 0x01,
+    0x00, 0x00, 0x01, 0x0F, 0xF0, 0x01, 0x00, 0x08, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x25, 0x00, 0x00, 0x91, 0x00, 0x02, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x12, 0x01, 0x00, 0x48, 0x01, 0x01, 0x20, 0x01, 0x04, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x04, 0x00, 0x01, 0x10, 0x40, 0x11, 0x40, 0x03, 0x15,
+    0x00, 0xA1, 0x11, 0x00, 0x85, 0x01, 0x00, 0x81, 0x01, 0x00, 0x10, 0xC9,
+    0x00, 0x06, 0x11, 0x00, 0x31, 0x21,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01,
+    0x10, 0x50, 0x01, 0x10, 0xA0, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x01,
+    0x21, 0x00, 0x09, 0x0C, 0x00, 0x21, 0x00, 0x00, 0x09, 0x00, 0x01, 0x21,
+    0x00, 0x04, 0x81, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x90, 0x01,
+    0x02, 0x40, 0x01, 0x09, 0x00, 0x01, 0x20, 0x00, 0x01, 0x08, 0x40, 0x11,
+    0x60, 0x03, 0x15, 0x00, 0xA1, 0x11, 0x00, 0x85, 0x01, 0x00, 0x81, 0x01,
+    0x00, 0x10, 0xC9, 0x00, 0x06, 0x11, 0x00, 0x31, 0x21,
+    // 0x215B '⅛'
+    0x10, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x27, 0xF0, 0x01,
+    0x00, 0x00, 0x01, 0x0F, 0xF0, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x09, 0x00, 0x01, 0x21, 0x00, 0x04, 0x81,
+    0x00, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x90, 0x01, 0x02, 0x40, 0x01,
+    0x09, 0x00, 0x01, 0x20, 0x00, 0x61, 0x08, 0x24, 0x09, 0x60, 0x02, 0x61,
+    0x00, 0x28, 0x11, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01, 0x00, 0xA8, 0x91,
+    0x00, 0x00, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x28, 0x02, 0x01, 0x00, 0x02, 0x01,
+    0x10, 0x8A, 0x01, 0x12, 0x80, 0x01, 0x04, 0x10, 0x01, 0x01, 0x00, 0x05,
+    0x04, 0x88, 0x13, 0x00, 0x00, 0x41, 0x00, 0x00, 0x11, 0x00, 0x02, 0x41,
+    0x00, 0x09, 0x01, 0x00, 0x24, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x80, 0x01, 0x12, 0x00, 0x01, 0x40, 0x00, 0x61, 0x10, 0x24, 0x09,
+    0x00, 0x02, 0x61, 0x00, 0x28, 0x11, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0xA8, 0x91, 0x00, 0x00, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3D, 0x02, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x0A, 0x01, 0x00, 0x00, 0x01, 0x02, 0x10, 0x01, 0x00, 0x00, 0x09,
+    0x10, 0x10, 0x03, 0x00, 0x00, 0x49, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0x01, 0x00, 0x24, 0x01, 0x00, 0x90, 0x01, 0x02, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x02, 0x00, 0x01, 0x08, 0x00, 0x61, 0x40, 0x24, 0x09,
+    0x00, 0x02, 0x61, 0x00, 0x28, 0x11, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0xA8, 0x91, 0x00, 0x00, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0x215E '⅞'
+    0x3C, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x42, 0x01,
+    0x01, 0x08, 0x01, 0x04, 0x40, 0x09, 0x09, 0x00, 0x03, 0x00, 0x00, 0x49,
+    0x08, 0x01, 0x21, 0x00, 0x00, 0x01, 0x00, 0x09, 0x01, 0x00, 0x24, 0x01,
+    0x00, 0x90, 0x01, 0x02, 0x40, 0x01, 0x08, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x40, 0x00, 0x61, 0x00, 0x24, 0x09, 0x00, 0x02, 0x61,
+    0x00, 0x28, 0x11, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01, 0x00, 0xA8, 0x91,
+    0x00, 0x00, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0x2190 '←'
+    0x04, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x2C, 0x0F, 0x54, 0x0F, 0x64, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x28, 0x00, 0x1F,
+    0x50, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x64, 0x0F, 0x54, 0x0F,
+    0x2C, 0x0F, 0x10, 0x0F, 0x08, 0x0F, 0x04, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x01, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x0C, 0xAF, 0x14, 0x5F,
+    0x24, 0x2F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x24, 0x2F,
+    0x14, 0x1F, 0x0C, 0xAF, 0x00, 0x4F, 0x00, 0x8F, 0x05, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x14, 0x01, 0x1F, 0x28, 0x00, 0x1F,
+    0x50, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x50, 0x00, 0x1F,
+    0x28, 0x00, 0x1F, 0x14, 0x01, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x04, 0x07, 0x08, 0x07, 0x14, 0x07, 0x21, 0x07, 0x41, 0x07, 0x31, 0x07,
+    0x51, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    // 0x21D1 '⇑'
+    0x04, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x14, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x24, 0x00, 0x7F, 0x14, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x51, 0x07, 0x31, 0x07, 0x41, 0x07,
+    0x21, 0x07, 0x14, 0x07, 0x08, 0x07, 0x04, 0x07,
+    // 0x21D3 '⇓'
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x07, 0x01, 0x07, 0x02, 0x87, 0x04, 0x47, 0x01, 0x27, 0x11, 0x57,
+    0x11, 0x37, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x37,
+    0x11, 0x57, 0x01, 0x27, 0x04, 0x47, 0x02, 0x87, 0x01, 0x07, 0x00, 0x07,
+    // 0x2202 '∂'
+    0x00, 0x03, 0x31, 0x00, 0x00, 0x01, 0x00, 0x20, 0x05, 0x10, 0x48, 0x11,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x09, 0x80, 0x40, 0x01, 0x80, 0x40, 0x15,
+    0xA0, 0x40, 0x21, 0x10, 0x00, 0x81, 0x46, 0x3C, 0x21, 0x20, 0x00, 0x01,
+    0x08, 0x06, 0x01, 0x00, 0x00, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x21, 0x0F, 0x01, 0x04, 0x0F, 0x04, 0x20, 0x0F, 0x20, 0x80, 0x0F,
+    0x04, 0x00, 0x0F, 0x88, 0x00, 0x0F, 0x81, 0x00, 0x0F, 0x20, 0x60, 0x0F,
+    0x04, 0x0C, 0x0F, 0x01, 0x81, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x01, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x02, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x9F, 0xFF, 0xFC, 0x7F,
+    0x80, 0x00, 0x02, 0x7F, 0xA0, 0x00, 0x02, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x01, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x84, 0x00, 0x20, 0x7F, 0x82, 0x00, 0x44, 0x7F, 0xB0, 0x00, 0x10, 0x7F,
+    0xA8, 0x42, 0x20, 0x7F, 0xA0, 0x24, 0x00, 0x7F, 0xA1, 0x01, 0x00, 0x7F,
+    0xA0, 0x02, 0x00, 0x7F, 0xA0, 0x20, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x04, 0x7F, 0x84, 0x00, 0x08, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3C, 0x7F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x10, 0x08, 0x1F,
+    0x00, 0x01, 0x01, 0x1F, 0x00, 0x00, 0x30, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x20, 0xDF, 0x00, 0x03, 0x04, 0x1F, 0x00, 0x10, 0x20, 0x1F,
+    0x01, 0x81, 0x00, 0x1F, 0x08, 0x08, 0x00, 0x1F, 0x40, 0xC0, 0x00, 0x1F,
+    0x84, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x0C, 0x3F, 0x20, 0xBF, 0x4E, 0x3F, 0x01, 0x7F, 0xA0, 0x7F, 0x21, 0x7F,
+    0x00, 0x3F, 0x08, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x00, 0x3F,
+    0x20, 0x7F, 0xA0, 0x7F, 0x00, 0x3F, 0x40, 0xBF, 0x21, 0x3F, 0x00, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x0F, 0xFF, 0xFF, 0x17, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    0x90, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x17, 0x00, 0x07,
+    0x04, 0x07, 0x02, 0x07, 0x20, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x07,
+    0x18, 0xC7,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x08, 0x80, 0x7F,
+    0x02, 0x00, 0x7F, 0x15, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x28, 0xA0, 0x7F,
+    0x00, 0x00, 0x7F, 0x50, 0x50, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x28, 0x7F,
+    0x00, 0x01, 0xFF,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x7F, 0x60, 0x10, 0x7F, 0x00, 0x28, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x50, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0xA0, 0x7F, 0x10, 0x00, 0x7F,
+    0x01, 0x40, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x7F,
+    0x03, 0x01, 0xFF,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly28ColOffsets[] PROGMEM = {
+    0x0, 0x1C, 0x2B, 0x3B, 0x6E, 0xA6, 0xF1, 0x130, 0x138, 0x15C, 0x180, 0x194,
+    0x1AE, 0x1BC, 0x1C5, 0x1CA, 0x1EE, 0x21E, 0x23F, 0x269, 0x290, 0x2BD, 0x2E4, 0x30E,
+    0x338, 0x362, 0x38F, 0x399, 0x3AE, 0x3C8, 0x3D5, 0x3EF, 0x40D, 0x471, 0x4B0, 0x4E0,
+    0x510, 0x549, 0x579, 0x5A6, 0x5DC, 0x61E, 0x639, 0x669, 0x6A5, 0x6D5, 0x720, 0x762,
+    0x79E, 0x7CB, 0x823, 0x85C, 0x883, 0x8B9, 0x8FB, 0x93A, 0x997, 0x9D6, 0xA0F, 0xA3F,
+    0xA57, 0xA7B, 0xA93, 0xAAF, 0xABD, 0xAC4, 0xAE2, 0xB15, 0xB2F, 0xB62, 0xB7C, 0xBA6,
+    0xBD6, 0xC0C, 0xC27, 0xC4B, 0xC7E, 0xC99, 0xCD1, 0xCF7, 0xD15, 0xD48, 0xD78, 0xD92,
+    0xDAA, 0xDCB, 0xDF1, 0xE13, 0xE45, 0xE67, 0xE9A, 0xEB6, 0xEDA, 0xEE6, 0xF0A, 0xF18,
+    0xF27, 0xF5F, 0xF8F, 0xFAF, 0xFE8, 0x100F, 0x1051, 0x1065, 0x1083, 0x10A3, 0x10B7, 0x10DE,
+    0x10F4, 0x1108, 0x113B, 0x1168, 0x116D, 0x117F, 0x1195, 0x11B3, 0x1204, 0x1255, 0x12AC, 0x12CD,
+    0x1321, 0x1375, 0x13C9, 0x141D, 0x1471, 0x14C5, 0x1513, 0x1553, 0x1593, 0x15D3, 0x1613, 0x1653,
+    0x1677, 0x169B, 0x16C7, 0x16F3, 0x172F, 0x1787, 0x17D7, 0x1827, 0x1877, 0x18C7, 0x1917, 0x192F,
+    0x1971, 0x19C9, 0x1A21, 0x1A79, 0x1AD1, 0x1B01, 0x1B37, 0x1B73, 0x1BA0, 0x1BCD, 0x1BFA, 0x1C27,
+    0x1C63, 0x1C8D, 0x1CB4, 0x1CE8, 0x1D0F, 0x1D36, 0x1D5D, 0x1D78, 0x1D93, 0x1DAE, 0x1DCF, 0x1DFC,
+    0x1E35, 0x1E71, 0x1E9E, 0x1ECB, 0x1EF8, 0x1F25, 0x1F3F, 0x1F61, 0x1FAD, 0x1FE6, 0x201F, 0x2058,
+    0x209C, 0x20E0, 0x2134, 0x2161, 0x21A1, 0x21C8, 0x2208, 0x222F, 0x227B, 0x22B4, 0x22F4, 0x231B,
+    0x235B, 0x2382, 0x23C2, 0x23E6, 0x2416, 0x243A, 0x2470, 0x2491, 0x24E9, 0x2522, 0x257A, 0x25B3,
+    0x2601, 0x2631, 0x267D, 0x26A4, 0x26D8, 0x26FC, 0x2730, 0x2754, 0x279C, 0x27BD, 0x2815, 0x2861,
+    0x28B9, 0x28F2, 0x293E, 0x297E, 0x29A8, 0x29E8, 0x2A12, 0x2A52, 0x2A7C, 0x2AA0, 0x2ADF, 0x2AED,
+    0x2B09, 0x2B13, 0x2B1F, 0x2B2B, 0x2B35, 0x2B4B, 0x2B61, 0x2B77, 0x2B8D, 0x2BB7, 0x2BE1, 0x2BE8,
+    0x2C00, 0x2C10, 0x2C20, 0x2C38, 0x2C4E, 0x2C62, 0x2C78, 0x2C8C, 0x2CA0, 0x2CB4, 0x2CCC, 0x2CDE,
+    0x2CF4, 0x2D08, 0x2D1E, 0x2D32, 0x2D48, 0x2D5C, 0x2D70, 0x2D84, 0x2DA8, 0x2DCC, 0x2DFF, 0x2E23,
+    0x2E47, 0x2E6B, 0x2E97, 0x2EE5, 0x2F36, 0x2F87, 0x2FDB, 0x302F, 0x3080, 0x30A0, 0x30C4, 0x30E4,
+    0x3108, 0x312C, 0x3150, 0x3170, 0x3194, 0x31B4, 0x31D8, 0x31FC, 0x3226, 0x325C, 0x32B0, 0x32F4,
+    0x333C, 0x3360, 0x339C, 0x33B6, 0x33DD, 0x3404, 0x3428, 0x344C, 0x3470, 0x3494, 0x34B8, 0x34DC,
+    0x3500, 0x3524, 0x3548, 0x356C, 0x3590, 0x35B4, 0x35D8, 0x35FC, 0x3620, 0x3644, 0x3668, 0x368C,
+    0x36B0, 0x36D4, 0x36F8
+};
+
+
 const SimpleGFXfont Bookerly28 PROGMEM = {Bookerly28Bitmaps, Bookerly28Bitmaps_lsb, Bookerly28Bitmaps_msb, Bookerly28Glyphs,
-    315, 30};
+    315, 30,
+    nullptr, 0, FontStyle::REGULAR, Bookerly28GlyphIndexLatin1, Bookerly28GlyphRanges, 13,
+    Bookerly28BitmapsCol, Bookerly28BitmapsCol_lsb, Bookerly28BitmapsCol_msb, Bookerly28ColOffsets};
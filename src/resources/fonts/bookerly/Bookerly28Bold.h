@@ -5691,5 +5691,5142 @@ const SimpleGFXglyph Bookerly28BoldGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly28BoldGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly28BoldGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly28BoldBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xC7, 0x00, 0x00, 0x87, 0x00, 0x01, 0x83,
+    0x00, 0x01, 0x87, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xC0, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xE7, 0xFF,
+    0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xBF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xF1, 0xC6, 0x7F, 0xF1, 0xC0, 0x7F,
+    0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xC7, 0xFF,
+    0x11, 0xC6, 0x7F, 0xF1, 0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
+    0x00, 0x07, 0xFF, 0x00, 0xC7, 0xFF, 0x01, 0xC7, 0xFF, 0xF1, 0xEF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x0F, 0x83, 0xFF, 0xFC, 0x03, 0x81, 0xFF,
+    0xF8, 0x03, 0xE1, 0xFF, 0xF8, 0xC1, 0xF1, 0xFF, 0xF1, 0xE1, 0xE0, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0xF1, 0xFF,
+    0xF0, 0xF8, 0x61, 0xFF, 0xF8, 0x78, 0x03, 0xFF, 0xF8, 0x3C, 0x03, 0xFF,
+    0xFC, 0x3E, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+    // 0x25 '%'
+    0xF8, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xC1, 0x07, 0xFF,
+    0x8F, 0xE7, 0xFF, 0x8F, 0xE7, 0xFF, 0x8F, 0xC7, 0xE3, 0xC0, 0x07, 0x83,
+    0xC0, 0x0F, 0x03, 0xE0, 0x1C, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF,
+    0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x70, 0x1F,
+    0x81, 0xE0, 0x07, 0x87, 0xC0, 0x07, 0x8F, 0xC7, 0xC7, 0xFF, 0x8F, 0xE3,
+    0xFF, 0x8F, 0xE7, 0xFF, 0xC3, 0x87, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F,
+    0xFF, 0xF0, 0x3F,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F,
+    0xF0, 0x00, 0x07, 0xC0, 0x07, 0x87, 0xC0, 0x07, 0xC7, 0x80, 0x03, 0xE7,
+    0x8F, 0x81, 0xE7, 0x9F, 0xE0, 0xE3, 0x9E, 0x70, 0x67, 0x80, 0x78, 0x07,
+    0x80, 0x7C, 0x07, 0xC0, 0xCE, 0x07, 0xE3, 0xCF, 0x0F, 0xFF, 0xC0, 0x07,
+    0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0xC7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0xC0, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x3F, 0xC1, 0xFF, 0xF8, 0x1F,
+    0x87, 0xFF, 0xFE, 0x0F, 0x8F, 0xFF, 0xFF, 0x0F, 0xDF, 0xFF, 0xFF, 0x9F,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0xFF, 0x0F,
+    0x83, 0xFF, 0xFC, 0x1F, 0xC0, 0xFF, 0xF8, 0x3F, 0xE0, 0x0F, 0x80, 0x7F,
+    0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xCC, 0xFF, 0x84, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F,
+    0x00, 0x3F, 0x93, 0x3F, 0xF1, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    // 0x2B '+'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFE, 0x7F, 0xB8, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x03, 0xFF,
+    0x8F, 0xFF,
+    // 0x2D '-'
+    0xFF, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F,
+    // 0x2E '.'
+    0xDF, 0x0F, 0x07, 0x07, 0x0F, 0x9F,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0xFF,
+    0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC0, 0x00, 0x0F, 0x80, 0x78, 0x0F, 0x87, 0xFF, 0x0F, 0x8F, 0xFF, 0x8F,
+    0x8F, 0xFF, 0x8F, 0x8F, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x83, 0xFC, 0x0F,
+    0x80, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
+    0xFF, 0x0F, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xCF, 0xE3, 0xFF, 0xCF, 0xC3, 0xFF, 0x8F,
+    0xC3, 0xFF, 0x8F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xCF, 0xFF, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xDF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x0F, 0xC0, 0xFE, 0x0F, 0x80, 0xFC, 0x0F,
+    0x81, 0xF8, 0x0F, 0x8F, 0xF0, 0x0F, 0x8F, 0xE0, 0x0F, 0x8F, 0xC1, 0x0F,
+    0x8F, 0x83, 0x0F, 0x80, 0x07, 0x0F, 0x80, 0x0F, 0x0F, 0x80, 0x1F, 0x0F,
+    0xC0, 0x3F, 0x0F, 0xE0, 0x7F, 0x0F, 0xFF, 0xFF, 0x9F,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x9F, 0xC3, 0xFF, 0x8F, 0x83, 0xFF, 0x8F,
+    0x87, 0x8F, 0x87, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x0F, 0x0F,
+    0x8E, 0x0F, 0x0F, 0x80, 0x06, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xC0, 0xC0, 0x3F, 0xF3, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFC, 0x08, 0xFF, 0xF8, 0x38, 0xFF, 0xF0, 0x78, 0xFF,
+    0xC0, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF8, 0x3F, 0x8F, 0x80, 0x3F, 0x8F,
+    0x80, 0x3F, 0x87, 0x80, 0x1F, 0x8F, 0x82, 0x1F, 0x8F, 0x8E, 0x1F, 0x0F,
+    0x8E, 0x0F, 0x0F, 0x8F, 0x00, 0x1F, 0x8F, 0x00, 0x1F, 0x8F, 0x80, 0x3F,
+    0x8F, 0x80, 0x7F, 0x8F, 0xE1, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x0F, 0xE0, 0x1E, 0x0F, 0xC1, 0x1F, 0x8F, 0x83, 0x1F, 0x8F,
+    0x87, 0x1F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x00, 0x0F, 0x8F, 0x00, 0x0F,
+    0x9F, 0x80, 0x1F, 0x9F, 0xC0, 0x3F, 0xDF, 0xF0, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xBF,
+    0x87, 0xFC, 0x0F, 0x8F, 0xF0, 0x0F, 0x8F, 0xC0, 0x07, 0x8F, 0x80, 0x0F,
+    0x8E, 0x00, 0xFF, 0x8C, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x7F, 0xFF,
+    0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xF8, 0x3F, 0xE0, 0x60, 0x1F, 0xC0, 0x20, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x07, 0x8F, 0x8E, 0x0F, 0x8F, 0x9F, 0x0F, 0x87,
+    0x9F, 0x0F, 0x8F, 0x8E, 0x07, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xC0, 0x60, 0x1F, 0xE0, 0xE0, 0x3F, 0xFF, 0xF8, 0x7F,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xCF, 0xC0, 0x0F, 0xCF, 0xC0, 0x0F, 0x8F,
+    0x80, 0x07, 0x8F, 0x87, 0x87, 0x8F, 0x8F, 0xC7, 0x0F, 0x8F, 0xC6, 0x0F,
+    0x8F, 0xC4, 0x1F, 0x87, 0xC0, 0x1F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF,
+    // 0x3A ':'
+    0xDF, 0xFB, 0x87, 0xE1, 0x07, 0xE0, 0x07, 0xE0, 0x87, 0xE1, 0xDF, 0xF3,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0xF6, 0x0F, 0x07, 0xE0, 0x1F,
+    0x07, 0xE0, 0x3F, 0x87, 0xE0, 0x7F, 0x8F, 0xF1, 0xFF,
+    // 0x3C '<'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xF0, 0x7F, 0xE2, 0x3F,
+    0xE6, 0x3F, 0xC7, 0x1F, 0xC7, 0x1F, 0x8F, 0x8F, 0x8F, 0x8F, 0x1F, 0xC7,
+    0xDF, 0xDF,
+    // 0x3D '='
+    0x9C, 0xFF, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
+    0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
+    0x9C, 0x7F,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x0F, 0xC7, 0x8F, 0x8F, 0x87, 0x8F, 0xC7, 0x1F,
+    0xC3, 0x1F, 0xE2, 0x3F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7F, 0xF8, 0xFF,
+    0xFC, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xE7, 0xEF, 0x07, 0xC0, 0x87,
+    0x0F, 0xC1, 0x83, 0x8F, 0x81, 0x87, 0x87, 0x87, 0xC7, 0x87, 0x8F, 0xFF,
+    0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+    0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0x81, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE1, 0xFF, 0xF0, 0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 0xC7, 0xBC, 0x3C, 0x7F,
+    0x8F, 0x18, 0x1C, 0x7F, 0x8E, 0x10, 0x1C, 0x7F, 0x8E, 0x70, 0x1E, 0x3F,
+    0x8E, 0x73, 0x1E, 0x3F, 0x8C, 0x73, 0x1E, 0x3F, 0x8E, 0x00, 0x3E, 0x3F,
+    0x8E, 0x00, 0x3E, 0x7F, 0x8E, 0x00, 0x1C, 0x7F, 0x8F, 0x80, 0x1C, 0x7F,
+    0x87, 0xFF, 0x1C, 0x7F, 0x87, 0xFF, 0x18, 0xFF, 0xC3, 0xFF, 0x18, 0xFF,
+    0xE0, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
+    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xCF, 0xF8, 0x01, 0xCF,
+    0xC0, 0x11, 0xFF, 0x80, 0xF1, 0xFF, 0x03, 0xF1, 0xFF, 0x00, 0x71, 0xFF,
+    0x00, 0x01, 0xCF, 0x80, 0x01, 0xCF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
+    0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x1F, 0x1F, 0x8F, 0x0F, 0x0F, 0x8F,
+    0x80, 0x06, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xE0, 0xC0, 0x3F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F, 0x83, 0xF8, 0x0F, 0x87, 0xFE, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x1F, 0xFF, 0x0F, 0x1F, 0xFF, 0x87, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x07, 0xFF, 0x8F, 0x01, 0xFF, 0x0F, 0x81, 0xFF, 0x0F, 0x83, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F,
+    0x0F, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x83, 0xFE, 0x1F, 0x80, 0xF8, 0x1F,
+    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0x0F, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F,
+    0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x03, 0x9C, 0x0F, 0x03, 0xFC, 0x0F,
+    0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0xCF, 0x0F, 0x8F, 0xFF,
+    0x0F, 0x8F, 0xFF, 0x01, 0x8F, 0xFF, 0x03, 0xDF, 0xFF, 0x83, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F, 0x81, 0xFC, 0x0F, 0x87, 0xFE, 0x0F, 0x0F, 0xFF, 0x0F,
+    0x0F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xE7, 0x87, 0x1F, 0xE7, 0x8F,
+    0x1F, 0xE7, 0x8F, 0x0F, 0xE3, 0x0F, 0x01, 0xE0, 0x0F, 0x01, 0xE0, 0x0F,
+    0x83, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xEF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0xCF, 0xBF, 0x8F, 0xCF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xBF, 0x8F, 0xEF, 0x1F, 0x8F, 0xCF, 0x1F, 0x8F, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x0F, 0xFF, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0xCF, 0xBF, 0xFF, 0xCF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x3F, 0x1F, 0xFF, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x0F, 0x8F, 0x1E, 0x07, 0xCF, 0xFC, 0x03, 0xDF, 0xF8, 0x00, 0xFF,
+    0xB0, 0x40, 0x7F, 0x00, 0xE0, 0x3F, 0x01, 0xF8, 0x1F, 0x03, 0xFC, 0x0F,
+    0x07, 0xFE, 0x0F, 0x0F, 0xFF, 0x07, 0x1F, 0xFF, 0x87, 0x1F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xBF, 0xFF, 0xCF, 0x1F, 0xE0, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xCF,
+    0x00, 0x7F, 0xCF, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+    0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x3F, 0xF8, 0x01, 0xFF,
+    0xC0, 0x0F, 0xFF, 0x00, 0x7F, 0xEF, 0x03, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xF8, 0x0F,
+    0xBF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x8F,
+    0xC0, 0x3F, 0xCF, 0xE0, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x03, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0x9F, 0xE0, 0x1F, 0x1F, 0xF0, 0x0F,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
+    0xC0, 0x00, 0x1F, 0x83, 0xFC, 0x0F, 0x87, 0xFF, 0x0F, 0x0F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x87, 0x1F, 0xFF, 0x87, 0x1F, 0xFF, 0x87, 0x0F, 0xFF, 0x8F,
+    0x0F, 0xFF, 0x8F, 0x07, 0xFF, 0x0F, 0x81, 0xFC, 0x1F, 0x80, 0x00, 0x1F,
+    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xC7, 0x8F, 0x1F, 0xC7, 0xCF, 0x0F, 0xC7, 0xCF, 0x0F, 0x87, 0xFF,
+    0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF,
+    0xE0, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x83, 0xFC, 0x0F, 0xFF,
+    0x87, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0x83, 0xFF,
+    0x1F, 0xFF, 0x81, 0xFF, 0x1F, 0xFF, 0x81, 0xFF, 0x0F, 0xFF, 0x80, 0xFF,
+    0x0F, 0xFF, 0x88, 0x7F, 0x07, 0xFF, 0x08, 0x7F, 0x81, 0xFC, 0x1C, 0x7F,
+    0x80, 0x00, 0x1C, 0x3F, 0xC0, 0x00, 0x3C, 0x3F, 0xE0, 0x00, 0x7C, 0x3F,
+    0xF0, 0x01, 0xFE, 0x3F, 0xFE, 0x0F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xC7, 0x8F, 0x1F, 0x83, 0xCF, 0x1F, 0x81, 0xFF, 0x0F, 0x00, 0xFF,
+    0x00, 0x00, 0x3F, 0x80, 0x10, 0x1F, 0x80, 0x3C, 0x1F, 0xC0, 0x3E, 0x0F,
+    0xE0, 0xFF, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0x53 'S'
+    0xFF, 0xFE, 0x1F, 0xE0, 0x7C, 0x0F, 0xC0, 0x38, 0x0F, 0x80, 0x1E, 0x0F,
+    0x80, 0x1F, 0x8F, 0x0C, 0x0F, 0x87, 0x1E, 0x0F, 0x87, 0x1F, 0x07, 0x87,
+    0x1F, 0x07, 0x8F, 0x1F, 0x83, 0x0F, 0x03, 0x80, 0x0F, 0x01, 0xC0, 0x1F,
+    0x83, 0xE0, 0x3F, 0x8F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xCF, 0x0F, 0xFF, 0xCF, 0x0F, 0xFF, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x0F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x0F, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0x0F, 0x1F, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0x87, 0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
+    0x1C, 0x00, 0x1F, 0x1F, 0x80, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xE0, 0x0F, 0x9F, 0x00, 0x3F, 0x18, 0x00, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
+    0x1E, 0x00, 0x0F, 0x1F, 0xE0, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x0F,
+    0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x7F, 0xFF,
+    0x80, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x0F,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x0F, 0xBF, 0xE0, 0x0F, 0x1E, 0x00, 0x1F,
+    0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0x8F, 0x0F, 0xFF, 0x0F,
+    0x07, 0xFE, 0x0F, 0x03, 0xFC, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x60, 0x4F,
+    0x00, 0x01, 0xCF, 0x18, 0x03, 0xFF, 0xBC, 0x07, 0xFF, 0xFE, 0x03, 0xEF,
+    0xF8, 0x00, 0xCF, 0x10, 0x40, 0x0F, 0x00, 0xE0, 0x0F, 0x01, 0xF8, 0x0F,
+    0x03, 0xFC, 0x0F, 0x0F, 0xFE, 0x0F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xCF, 0x00, 0x3F, 0xCF, 0x00, 0x0F, 0x8F,
+    0x18, 0x00, 0x0F, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F,
+    0x9C, 0x00, 0x0F, 0x10, 0x3F, 0x8F, 0x00, 0x7F, 0xCF, 0x01, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0x01, 0xFE, 0x0F, 0x03, 0xF8, 0x0F,
+    0x0F, 0xF0, 0x0F, 0x0F, 0xC0, 0x0F, 0x0F, 0x80, 0x0F, 0x0F, 0x01, 0x8F,
+    0x1C, 0x03, 0x8F, 0x18, 0x0F, 0x8F, 0x00, 0x1F, 0x8F, 0x00, 0x7F, 0x8F,
+    0x00, 0xFF, 0x8F, 0x03, 0xFE, 0x0F, 0x87, 0xF8, 0x0F, 0x8F, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFB,
+    // 0x5D ']'
+    0x3F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x87, 0xFC, 0x07, 0xF0, 0x07, 0xC0, 0x3F,
+    0x01, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x07,
+    0xFF, 0x07, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x60 '`'
+    0xCF, 0x87, 0x87, 0xC3, 0xE1, 0xF9, 0xFF,
+    // 0x61 'a'
+    0xFF, 0xE1, 0xFF, 0xE3, 0x80, 0xFF, 0xC3, 0x80, 0xFF, 0xC3, 0x00, 0xFF,
+    0x87, 0x00, 0xFF, 0x8F, 0x18, 0xFF, 0x8F, 0x38, 0xFF, 0x8E, 0x38, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0xFF, 0x1F, 0xE3, 0xFE, 0x3F, 0xE1, 0xFE, 0x3F, 0xE3, 0xFE, 0x1F, 0xE3,
+    0xFE, 0x07, 0x83, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x0F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0x87, 0xF0, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0x7F,
+    0x87, 0xF8, 0xFF, 0x81, 0xF8, 0xFF, 0x81, 0xF8, 0xFF, 0xC3, 0xF8, 0xFF,
+    0xF7, 0xFB, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xFE, 0x1F, 0xC1, 0xFE, 0x3F, 0xE3, 0x9E, 0x3F, 0xE3,
+    0x9E, 0x3F, 0xE3, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF7,
+    // 0x65 'e'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0x82, 0x20, 0xFF, 0x8E, 0x30, 0xFF, 0x8E, 0x38, 0xFF, 0x8E, 0x38, 0x7F,
+    0x86, 0x38, 0xFF, 0x80, 0x38, 0xFF, 0xC0, 0x38, 0xFF, 0xC0, 0x38, 0xFF,
+    0xE0, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xF3, 0xFE, 0x3F, 0xF3, 0xF8, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x0E, 0x3F, 0xF3, 0x1E, 0x3F, 0xF3, 0x1E, 0x3F, 0xFF, 0x0F, 0x3F, 0xFF,
+    0x07, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0x61, 0x03, 0xE0, 0x00, 0x03,
+    0xC0, 0x00, 0x03, 0x80, 0x00, 0x61, 0x8F, 0x18, 0x71, 0x8F, 0x18, 0x71,
+    0x8F, 0x18, 0x71, 0x8F, 0x18, 0x63, 0x80, 0x18, 0x63, 0x80, 0x18, 0x43,
+    0x80, 0x38, 0x03, 0x80, 0x78, 0x07, 0x8F, 0xFC, 0x0F, 0x8F, 0xFE, 0x1F,
+    0xDF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xF3,
+    0xFF, 0x1F, 0xF3, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xF3, 0xFE, 0x0F, 0xF3,
+    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF3, 0xDE, 0x3F, 0xF3, 0x86, 0x00, 0x03,
+    0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x86, 0x00, 0x03, 0x8F, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x3F, 0xFF, 0x87,
+    0xFF, 0x3F, 0xFF, 0x87, 0x8E, 0x1F, 0xF8, 0x0F, 0x86, 0x00, 0x00, 0x0F,
+    0x06, 0x00, 0x00, 0x1F, 0x06, 0x00, 0x00, 0x3F, 0x8E, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0xF3,
+    0xFF, 0xF0, 0xF3, 0xFE, 0x60, 0x3F, 0xFE, 0x00, 0x0F, 0xFE, 0x04, 0x07,
+    0xFE, 0x0E, 0x03, 0xFE, 0x1F, 0x83, 0xFE, 0x3F, 0xC3, 0xFE, 0x3F, 0xE3,
+    0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0xCF, 0xFC, 0x8F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xC3, 0xF8, 0xC7, 0xFC, 0x8F, 0xFF, 0x8F, 0xFE, 0x87, 0xFC,
+    0x80, 0x00, 0x80, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xE3, 0xF8, 0xC7, 0xFC,
+    0x8F, 0xFF, 0x8F, 0xFE, 0x87, 0xFC, 0x80, 0x00, 0x80, 0x00, 0xC0, 0x00,
+    0xE0, 0x00, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0xCF, 0xFC, 0x8F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xC3, 0xF8, 0xC7, 0xFC, 0x8F, 0xFF, 0x8F, 0xFF, 0x87, 0xFC,
+    0x80, 0x00, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF8, 0x00, 0xFF, 0xFC,
+    0xFF, 0xFF,
+    // 0x6F 'o'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0x87, 0xF0, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF,
+    0x8F, 0xF8, 0xFF, 0x87, 0xF8, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0x70 'p'
+    0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF3, 0x87, 0xFF, 0xF3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC7, 0xF8, 0xF3,
+    0x8F, 0xF8, 0x73, 0x8F, 0xF8, 0xFF, 0x87, 0xF8, 0xFF, 0x83, 0xF0, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFC, 0x7F, 0xFF,
+    // 0x71 'q'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0x87, 0xF0, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFB,
+    0x8F, 0xF8, 0xF3, 0x80, 0x01, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
+    // 0x72 'r'
+    0xEF, 0xFF, 0xCF, 0xFC, 0x8F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xE3, 0xF8, 0xC7, 0xFC, 0x87, 0xFC, 0x87, 0xFF, 0x87, 0xFF,
+    0x8F, 0xFF,
+    // 0x73 's'
+    0xFF, 0xF1, 0xFF, 0xE0, 0xE0, 0xFF, 0xC0, 0x60, 0xFF, 0xC0, 0x38, 0xFF,
+    0x80, 0x3C, 0xFF, 0x8C, 0x1C, 0xFF, 0x9C, 0x1C, 0xFF, 0x8E, 0x0C, 0xFF,
+    0x8E, 0x00, 0xFF, 0x83, 0x00, 0xFF, 0xC3, 0x01, 0xFF, 0xC7, 0x83, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x0F,
+    0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x1F,
+    0xFF, 0xFF, 0x7F,
+    // 0x75 'u'
+    0x9F, 0xFF, 0x9F, 0xFF, 0x80, 0x0F, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xF1, 0x9F, 0xF1, 0x9F, 0xF1, 0x80, 0x03,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xF9, 0xFF, 0xF9,
+    0xFF, 0xFF,
+    // 0x76 'v'
+    0xFF, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x1F,
+    0x00, 0x07, 0x10, 0x01, 0x3E, 0x01, 0xFF, 0xC1, 0xFF, 0x81, 0xBC, 0x03,
+    0x10, 0x0F, 0x00, 0x3F, 0x00, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0x3F, 0xFF,
+    0xFF, 0xFF,
+    // 0x77 'w'
+    0xFF, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x0F,
+    0x00, 0x01, 0x1C, 0x01, 0xBF, 0xC1, 0xFF, 0x81, 0xF8, 0x03, 0xC0, 0x1F,
+    0x81, 0xFF, 0x80, 0x7F, 0x80, 0x0F, 0xE0, 0x01, 0xFE, 0x01, 0xFF, 0xC1,
+    0xBF, 0x01, 0x10, 0x03, 0x00, 0x1F, 0x00, 0x7F, 0x03, 0xFF, 0x1F, 0xFF,
+    0x3F, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFD, 0x3F, 0xF9, 0x1F, 0xF1, 0x0F, 0xE1, 0x07, 0xC1, 0x03, 0x81,
+    0x00, 0x09, 0x20, 0x1F, 0xF0, 0x3F, 0xF8, 0x19, 0xB0, 0x01, 0x01, 0x01,
+    0x03, 0x81, 0x0F, 0xC1, 0x1F, 0xF1, 0x3F, 0xF9, 0x3F, 0xF9, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xBF, 0xFF, 0xCF, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xC3, 0x03, 0xFF, 0xC3,
+    0x00, 0xFF, 0xC3, 0x00, 0x1F, 0x87, 0x00, 0x07, 0x87, 0x10, 0x00, 0x0F,
+    0x3E, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0xFF, 0xBC, 0x03, 0xFF,
+    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0x87, 0xF1, 0x03, 0xC1, 0x07, 0x81, 0x1F, 0x01, 0x1C, 0x01,
+    0x18, 0x01, 0x10, 0x31, 0x00, 0x71, 0x00, 0xF1, 0x03, 0xF1, 0x07, 0xC1,
+    0x0F, 0x81, 0xDF, 0xC7,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0x7F,
+    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x02, 0x00, 0x1F,
+    0x8F, 0x8F, 0x1F, 0x0F, 0x9F, 0xFF, 0xFF, 0x8F, 0x9F, 0xFF, 0xFF, 0x8F,
+    0x9F, 0xFF, 0xFF, 0x9F,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0x9F, 0xFF, 0xFF, 0x8F,
+    0x8F, 0xFF, 0xFF, 0x8F, 0x80, 0x02, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x70, 0xE0, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xC7, 0x87, 0x07, 0x1F, 0x1F, 0x0F, 0x8F, 0x87, 0xC7, 0xC7, 0x87, 0x07,
+    0x0F, 0xFF,
+    // 0xA1 '¡'
+    0xCF, 0xFF, 0xFB, 0x86, 0x00, 0x03, 0x86, 0x00, 0x03, 0x86, 0x00, 0x03,
+    0x8F, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0x87, 0xFF,
+    0xFC, 0x7F, 0xC7, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x80, 0x0F, 0xC7, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xFC, 0x3F, 0xC7, 0xFF,
+    0xFC, 0x1F, 0xC7, 0xFF, 0xFE, 0x1F, 0x8F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x8F, 0x87, 0xFF, 0x8F, 0x07,
+    0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x8F,
+    0x80, 0x0F, 0x8F, 0x87, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x9F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x83, 0x9F, 0x8F, 0x83, 0xFF, 0x8F, 0xC3, 0xFF, 0x8F,
+    0xE7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xDF, 0xF7, 0x8F, 0xE3, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xC1, 0x07,
+    0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC3, 0x87, 0xE0, 0x0F, 0xE0, 0x0F,
+    0xC0, 0x07, 0x8F, 0xE3, 0xCF, 0xE7, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x87, 0x9F, 0xFF,
+    0x81, 0x91, 0xFF, 0x80, 0x11, 0xCF, 0x80, 0x11, 0xCF, 0x90, 0x01, 0x8F,
+    0x9C, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F,
+    0x98, 0x01, 0x8F, 0x80, 0x11, 0xCF, 0x80, 0x91, 0xCF, 0x83, 0x91, 0xFF,
+    0x8F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFC, 0x1F, 0xC7, 0xF0, 0x07, 0x83, 0xE0, 0xC3, 0x83, 0xC0, 0x61, 0xE3,
+    0x8C, 0x31, 0xF1, 0x9E, 0x30, 0xF1, 0x9E, 0x18, 0xF3, 0x8F, 0x18, 0x73,
+    0x87, 0x0C, 0x03, 0x83, 0x86, 0x07, 0xC3, 0xC0, 0x0F, 0xEF, 0xE0, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0xFF, 0x9F, 0x9E, 0x03, 0xCF, 0x9C, 0x01, 0xCF,
+    0x38, 0x00, 0xCF, 0x39, 0xF8, 0xEF, 0x39, 0xF8, 0xE7, 0x39, 0xFC, 0xE7,
+    0x38, 0xFC, 0xEF, 0x38, 0x78, 0xCF, 0x9D, 0xF9, 0xCF, 0x9F, 0xFF, 0xCF,
+    0xCF, 0xFF, 0x9F, 0xC7, 0xFF, 0x3F, 0xE1, 0xFC, 0x7F, 0xF8, 0x00, 0xFF,
+    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xAA 'ª'
+    0xFC, 0xF7, 0x98, 0x63, 0x08, 0x23, 0x13, 0x23, 0x33, 0x23, 0x12, 0x63,
+    0x00, 0x63, 0x80, 0x23, 0xFE, 0x27, 0xFF, 0x6F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x86, 0x1F,
+    0x8F, 0x1F, 0xBF, 0x9F, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F,
+    0x86, 0x1F, 0x8F, 0x1F, 0x9F, 0x9F, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE1, 0x87, 0xCF, 0xE7, 0x9F, 0xF3, 0xB0, 0x19,
+    0x30, 0x19, 0x20, 0x1D, 0x26, 0x3D, 0x30, 0x19, 0xB1, 0x99, 0x9F, 0xDB,
+    0xCF, 0xF3, 0xC7, 0xC7, 0xF0, 0x0F, 0xFE, 0xFF,
+    // 0xB0 '°'
+    0xF1, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x84, 0x3F, 0x8E, 0x3F, 0x9F, 0x3F,
+    0x8E, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFB, 0xFF,
+    // 0xB1 '±'
+    0xFC, 0xFE, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0x7F, 0x80, 0x04, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x7F,
+    0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0x7F,
+    // 0xB2 '²'
+    0xF7, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0x83, 0x83, 0x8F, 0x03, 0x8E, 0x23,
+    0x80, 0x23, 0x80, 0x63, 0xC0, 0xE3, 0xE3, 0xE7, 0xFF, 0xEF,
+    // 0xB3 '³'
+    0xFF, 0xFF, 0xC7, 0xF3, 0x87, 0xE3, 0x8C, 0x63, 0x9C, 0xE3, 0x98, 0xE3,
+    0x80, 0x03, 0x80, 0x07, 0xC2, 0x0F, 0xE7, 0x1F,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x8F, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x9F, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF,
+    // 0xB6 '¶'
+    0xFC, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
+    0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xDF, 0x0F, 0x07, 0x07, 0x0F, 0x9F,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xEF, 0xF3, 0xC7, 0xF3, 0xC7, 0xE3, 0xC0, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0xDF, 0xE3, 0xFF, 0xE3, 0xFF, 0xF7,
+    // 0xBA 'º'
+    0xE1, 0xFF, 0x80, 0x73, 0x80, 0x63, 0x1E, 0x23, 0x3F, 0x23, 0x3F, 0x23,
+    0x1E, 0x23, 0x00, 0x63, 0x80, 0x67, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xBF, 0xDF, 0x9F, 0x1F, 0x8E, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F,
+    0xF0, 0xFF, 0xB9, 0xFF, 0x9F, 0x1F, 0x8E, 0x1F, 0x80, 0x3F, 0xC0, 0x7F,
+    0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xF3, 0xF3, 0xFF, 0xFB, 0xC1, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x07,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0x3F, 0xC0, 0xFE, 0x1F, 0x83, 0xFC, 0x1F,
+    0x87, 0xF0, 0x1F, 0xDF, 0xE1, 0x1F, 0xFF, 0xC3, 0x1F, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xBF,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xF3,
+    0xFF, 0xF3, 0xE3, 0xFF, 0xFB, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x81, 0xC7, 0xC7, 0x87, 0x87, 0xC7,
+    0x9F, 0x87, 0x87, 0xFF, 0x0F, 0x07, 0xFF, 0x1E, 0x07, 0xFF, 0x1C, 0x07,
+    0xFF, 0x00, 0x47, 0xFF, 0x80, 0xC7, 0xFF, 0x81, 0xC7, 0xFF, 0xE7, 0xC7,
+    0xFF, 0xFF, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xF3, 0xFF, 0xC7, 0xF1, 0xFF, 0xCE, 0x71, 0xFF,
+    0xCE, 0x71, 0xFF, 0xCC, 0x63, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+    0xC1, 0x07, 0xF3, 0xF7, 0x8F, 0xC1, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0x3F, 0xC0, 0xFE, 0x1F, 0x83, 0xFC, 0x1F,
+    0x8F, 0xF0, 0x1F, 0xFF, 0xE1, 0x1F, 0xFF, 0xC3, 0x1F, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xBF,
+    // 0xBF '¿'
+    0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC3, 0x07,
+    0xCF, 0xC3, 0x87, 0x87, 0x87, 0xC3, 0x86, 0x07, 0xC3, 0x86, 0x07, 0xC3,
+    0x86, 0x0F, 0xC3, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC7,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xCF, 0xFE, 0x00, 0xCF, 0x87, 0xF8, 0x01, 0xCF, 0xC7, 0xC0, 0x11, 0xFF,
+    0xC3, 0x80, 0xF1, 0xFF, 0xE3, 0x03, 0xF1, 0xFF, 0xF3, 0x00, 0x71, 0xFF,
+    0xF3, 0x00, 0x01, 0xCF, 0xFF, 0x80, 0x01, 0xCF, 0xFF, 0xF0, 0x00, 0x0F,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFE, 0x00, 0xCF, 0xFF, 0xF8, 0x01, 0xCF, 0xF3, 0xC0, 0x11, 0xFF,
+    0xE3, 0x80, 0xF1, 0xFF, 0xE3, 0x03, 0xF1, 0xFF, 0xC3, 0x00, 0x71, 0xFF,
+    0x87, 0x00, 0x01, 0xCF, 0x87, 0x80, 0x01, 0xCF, 0xCF, 0xF0, 0x00, 0x0F,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFB, 0xFF, 0xC0, 0x0F,
+    0xF3, 0xFE, 0x00, 0xCF, 0xE1, 0xF8, 0x01, 0xCF, 0xC3, 0xC0, 0x11, 0xFF,
+    0x87, 0x80, 0xF1, 0xFF, 0x8F, 0x03, 0xF1, 0xFF, 0x8F, 0x00, 0x71, 0xFF,
+    0xC7, 0x00, 0x01, 0xCF, 0xC3, 0x80, 0x01, 0xCF, 0xE3, 0xF0, 0x00, 0x0F,
+    0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x1F,
+    0x87, 0xFC, 0x01, 0x9F, 0x87, 0xF0, 0x03, 0x9F, 0x8F, 0x80, 0x23, 0xFF,
+    0x8F, 0x01, 0xE3, 0xFF, 0x86, 0x07, 0xE3, 0xFF, 0xC6, 0x00, 0xE3, 0xFF,
+    0xC6, 0x00, 0x03, 0x9F, 0x87, 0x00, 0x03, 0x9F, 0x8F, 0xE0, 0x00, 0x1F,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0x9F, 0xFF, 0x00, 0x3F,
+    0x0F, 0xF8, 0x03, 0x3F, 0x0F, 0xE0, 0x07, 0x3F, 0x0F, 0x00, 0x47, 0xFF,
+    0x9E, 0x03, 0xC7, 0xFF, 0xFC, 0x0F, 0xC7, 0xFF, 0x9C, 0x01, 0xC7, 0xFF,
+    0x0C, 0x00, 0x07, 0x3F, 0x0E, 0x00, 0x07, 0x3F, 0x0F, 0xC0, 0x00, 0x3F,
+    0x9F, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xFE, 0x00, 0xCF, 0xC3, 0xF8, 0x01, 0xCF, 0x81, 0xC0, 0x11, 0xFF,
+    0x99, 0x80, 0xF1, 0xFF, 0x39, 0x03, 0xF1, 0xFF, 0x19, 0x00, 0x71, 0xFF,
+    0x81, 0x00, 0x01, 0xCF, 0xC3, 0x80, 0x01, 0xCF, 0xFF, 0xF0, 0x00, 0x0F,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0xCF,
+    0xFF, 0x01, 0xCF, 0x1C, 0x01, 0xFF, 0x10, 0x11, 0xFF, 0x00, 0x71, 0xFF,
+    0x01, 0xF1, 0xCF, 0x07, 0xF1, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x8F, 0x8F,
+    0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F,
+    0x03, 0x9E, 0x0F, 0x03, 0xFC, 0x0F, 0x87, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
+    0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x83, 0xF8, 0x0F, 0xFF,
+    0x87, 0xFE, 0x0F, 0xFF, 0x0F, 0xFF, 0x0D, 0xDF, 0x1F, 0xFF, 0x08, 0x9F,
+    0x1F, 0xFF, 0x80, 0x1F, 0x1F, 0xFF, 0x88, 0x1F, 0x1F, 0xFF, 0x8C, 0x3F,
+    0x07, 0xFF, 0x8F, 0xFF, 0x01, 0xFF, 0x0F, 0xFF, 0x81, 0xFF, 0x0F, 0xFF,
+    0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F,
+    0x87, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0xC3, 0x0F, 0x8F, 0x8F,
+    0xE3, 0x0F, 0x8F, 0x8F, 0xF3, 0x0F, 0x8F, 0x8F, 0xFB, 0x0F, 0x8F, 0x8F,
+    0xFF, 0x0F, 0x8F, 0x8F, 0xFF, 0x0F, 0x8F, 0x8F, 0xFF, 0x03, 0x9C, 0x0F,
+    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFB, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0F, 0xE3, 0x0F, 0x8F, 0x8F,
+    0xE3, 0x0F, 0x8F, 0x8F, 0xC3, 0x0F, 0x8F, 0x8F, 0x87, 0x0F, 0x8F, 0x8F,
+    0x87, 0x0F, 0x8F, 0x8F, 0xFF, 0x0F, 0x8F, 0x8F, 0xFF, 0x03, 0x9C, 0x0F,
+    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x0F,
+    0xE3, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0x87, 0x0F, 0x8F, 0x8F,
+    0x8F, 0x0F, 0x8F, 0x8F, 0x87, 0x0F, 0x8F, 0x8F, 0xC3, 0x0F, 0x8F, 0x8F,
+    0xE3, 0x0F, 0x8F, 0x8F, 0xF3, 0x0F, 0x8F, 0x8F, 0xFF, 0x03, 0x9C, 0x0F,
+    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0x3F,
+    0xFC, 0x00, 0x00, 0x3F, 0x8C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0xFC, 0x3E, 0x3E, 0x3F,
+    0xFC, 0x3E, 0x3E, 0x3F, 0x8C, 0x3E, 0x3E, 0x3F, 0x0C, 0x3E, 0x3E, 0x3F,
+    0x0C, 0x3E, 0x3E, 0x3F, 0x0C, 0x3E, 0x3E, 0x3F, 0xFC, 0x0E, 0x70, 0x3F,
+    0xFC, 0x0F, 0xF0, 0x3F, 0xFE, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x87, 0x1F, 0xFF, 0xCF,
+    0x87, 0x0F, 0xFF, 0x8F, 0xC3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x00, 0x0F,
+    0xE3, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0x8F,
+    0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0xBF, 0xFF, 0xCF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFB, 0x0F, 0xFF, 0x8F, 0xF3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x00, 0x0F,
+    0xC3, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0x87, 0x1F, 0xFF, 0x8F,
+    0xC7, 0x1F, 0xFF, 0xCF, 0xFF, 0xBF, 0xFF, 0xCF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x9F, 0xFF, 0xCF, 0xF1, 0x1F, 0xFF, 0xCF,
+    0xE3, 0x0F, 0xFF, 0x8F, 0x87, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x0F,
+    0x8F, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F, 0xC3, 0x1F, 0xFF, 0x8F,
+    0xE3, 0x1F, 0xFF, 0xCF, 0xF3, 0xBF, 0xFF, 0xCF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x7F, 0xFF, 0x3F, 0x0C, 0x7F, 0xFF, 0x3F,
+    0x0C, 0x3F, 0xFE, 0x3F, 0x8C, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
+    0xFC, 0x00, 0x00, 0x3F, 0x8C, 0x00, 0x00, 0x3F, 0x0C, 0x7F, 0xFE, 0x3F,
+    0x0C, 0x7F, 0xFF, 0x3F, 0x8E, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xCF, 0x9F, 0x9F, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x8F, 0x0F, 0x9F, 0x8F,
+    0x0F, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x83, 0xFE, 0x1F, 0x80, 0xF8, 0x1F,
+    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0x0F, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x9F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
+    0xCE, 0x00, 0x00, 0x1F, 0x87, 0x01, 0xFF, 0x1F, 0x8F, 0x80, 0x7F, 0x9F,
+    0x8F, 0xC0, 0x3F, 0xFF, 0x8F, 0xF0, 0x0F, 0xFF, 0xC7, 0xF8, 0x07, 0xFF,
+    0xC7, 0xFE, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0xFF, 0x87, 0x3F, 0xC0, 0x3F,
+    0xDE, 0x3F, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x83, 0xFC, 0x0F,
+    0x87, 0x87, 0xFF, 0x0F, 0x87, 0x0F, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x87,
+    0xE3, 0x1F, 0xFF, 0x87, 0xE3, 0x1F, 0xFF, 0x87, 0xF3, 0x0F, 0xFF, 0x8F,
+    0xFB, 0x0F, 0xFF, 0x8F, 0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0x81, 0xFC, 0x1F,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x83, 0xFC, 0x0F,
+    0xFF, 0x87, 0xFF, 0x0F, 0xFB, 0x0F, 0xFF, 0x8F, 0xF3, 0x1F, 0xFF, 0x87,
+    0xE3, 0x1F, 0xFF, 0x87, 0xC3, 0x1F, 0xFF, 0x87, 0xC3, 0x0F, 0xFF, 0x8F,
+    0x87, 0x0F, 0xFF, 0x8F, 0x87, 0x07, 0xFF, 0x0F, 0xFF, 0x81, 0xFC, 0x1F,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFB, 0x83, 0xFC, 0x0F,
+    0xF1, 0x87, 0xFF, 0x0F, 0xE3, 0x0F, 0xFF, 0x8F, 0xC7, 0x1F, 0xFF, 0x87,
+    0x8F, 0x1F, 0xFF, 0x87, 0x8F, 0x1F, 0xFF, 0x87, 0x87, 0x0F, 0xFF, 0x8F,
+    0xC3, 0x0F, 0xFF, 0x8F, 0xE3, 0x07, 0xFF, 0x0F, 0xF3, 0x81, 0xFC, 0x1F,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0x07, 0xF8, 0x1F,
+    0x87, 0x0F, 0xFE, 0x1F, 0x8E, 0x1F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFF, 0x0F,
+    0x8E, 0x3F, 0xFF, 0x0F, 0xC6, 0x3F, 0xFF, 0x0F, 0xC6, 0x1F, 0xFF, 0x1F,
+    0x86, 0x1F, 0xFF, 0x1F, 0x86, 0x0F, 0xFE, 0x1F, 0xDF, 0x03, 0xF8, 0x3F,
+    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0x0E, 0x0F, 0xF0, 0x3F,
+    0x0E, 0x1F, 0xFC, 0x3F, 0x0C, 0x3F, 0xFE, 0x3F, 0x8C, 0x7F, 0xFE, 0x1F,
+    0xFC, 0x7F, 0xFE, 0x1F, 0xFC, 0x7F, 0xFE, 0x1F, 0x8C, 0x3F, 0xFE, 0x3F,
+    0x0C, 0x3F, 0xFE, 0x3F, 0x0C, 0x1F, 0xFC, 0x3F, 0x8E, 0x07, 0xF0, 0x7F,
+    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0xDF, 0xDF, 0x8F, 0x8F, 0x87, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x82, 0x0F, 0x87, 0x0F, 0xCF, 0x9F,
+    0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xE7, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC1, 0xFC, 0x07, 0xC3, 0xF8, 0x07,
+    0x87, 0xF1, 0xC7, 0x8F, 0xE3, 0xC3, 0x8F, 0xC7, 0xC3, 0x8F, 0x8F, 0xC3,
+    0x87, 0x1F, 0xC7, 0x86, 0x3F, 0xC7, 0x80, 0x7F, 0x87, 0xC0, 0x7E, 0x0F,
+    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x88, 0x00, 0xFF,
+    0x9F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xCF, 0x00, 0x00, 0x0F, 0x87, 0x1F, 0xFF, 0x0F,
+    0xC3, 0x1F, 0xFF, 0x87, 0xC3, 0xFF, 0xFF, 0x87, 0xE3, 0xFF, 0xFF, 0x87,
+    0xF3, 0xFF, 0xFF, 0x87, 0xFB, 0x9F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0x0F,
+    0xF3, 0x1F, 0xFF, 0x87, 0xE3, 0xFF, 0xFF, 0x87, 0xE3, 0xFF, 0xFF, 0x87,
+    0xC3, 0xFF, 0xFF, 0x87, 0x87, 0x9F, 0xFF, 0x8F, 0x87, 0x1F, 0xFF, 0x0F,
+    0xEF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFB, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x0F, 0xE3, 0x1F, 0xFF, 0x0F,
+    0xC3, 0x1F, 0xFF, 0x87, 0x87, 0xFF, 0xFF, 0x87, 0x8F, 0xFF, 0xFF, 0x87,
+    0x87, 0xFF, 0xFF, 0x87, 0xC7, 0x9F, 0xFF, 0x8F, 0xE3, 0x1F, 0xFF, 0x0F,
+    0xF3, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0x8C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0x0C, 0x7F, 0xFC, 0x3F,
+    0x0C, 0x7F, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0x8F, 0xFF, 0xFE, 0x1F, 0x0E, 0x7F, 0xFE, 0x3F, 0x0C, 0x7F, 0xFC, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0xDC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x11, 0xFC, 0xCF, 0x31, 0xFC, 0xCF, 0xB1, 0xF8, 0xEF, 0xF1, 0xF8, 0xFF,
+    0xF0, 0x60, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x87, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xC3, 0x1F, 0x83, 0x83, 0x1F, 0x01, 0xE3, 0x0E, 0x01, 0xF1,
+    0x00, 0x00, 0xF3, 0x00, 0x70, 0x23, 0x80, 0xF0, 0x03, 0xC1, 0xF8, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x1F,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0x80, 0xFF, 0xFF, 0xC3, 0x80, 0xFF,
+    0x8F, 0xC3, 0x00, 0xFF, 0x87, 0x87, 0x00, 0xFF, 0xC3, 0x8F, 0x18, 0xFF,
+    0xE1, 0x8F, 0x38, 0xFF, 0xF1, 0x8E, 0x38, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0x80, 0xFF, 0xFF, 0xC3, 0x80, 0xFF,
+    0xFF, 0xC3, 0x00, 0xFF, 0xFF, 0x87, 0x00, 0xFF, 0xF3, 0x8F, 0x18, 0xFF,
+    0xE1, 0x8F, 0x38, 0xFF, 0x83, 0x8E, 0x38, 0xFF, 0x87, 0x80, 0x01, 0xFF,
+    0xCF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xC3, 0xFF, 0xC7, 0x01, 0xFB, 0x87, 0x01, 0xE3, 0x86, 0x01,
+    0xC3, 0x0E, 0x01, 0x87, 0x1E, 0x31, 0x0F, 0x1E, 0x71, 0x0F, 0x1C, 0x71,
+    0x87, 0x00, 0x03, 0xC3, 0x00, 0x01, 0xE3, 0x80, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xC3, 0xFF, 0xC7, 0x01, 0xC7, 0x87, 0x01, 0x87, 0x86, 0x01,
+    0x8F, 0x0E, 0x01, 0x8F, 0x1E, 0x31, 0xC7, 0x1E, 0x71, 0xC7, 0x1C, 0x71,
+    0xE7, 0x00, 0x03, 0x87, 0x00, 0x01, 0x87, 0x80, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0x87, 0xDF, 0x8E, 0x03, 0x8F, 0x0E, 0x03, 0x87, 0x0C, 0x03,
+    0x8E, 0x1C, 0x03, 0x8E, 0x3C, 0x63, 0xFE, 0x3C, 0xE3, 0xDE, 0x38, 0xE3,
+    0x8E, 0x00, 0x07, 0x86, 0x00, 0x03, 0x8F, 0x00, 0x03, 0xDF, 0x00, 0x03,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF7,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0x80, 0xFF, 0xFF, 0xC3, 0x80, 0xFF,
+    0xC3, 0xC3, 0x00, 0xFF, 0x81, 0x87, 0x00, 0xFF, 0x98, 0x8F, 0x18, 0xFF,
+    0x9C, 0x8F, 0x38, 0xFF, 0x9C, 0x8E, 0x38, 0xFF, 0x81, 0x80, 0x01, 0xFF,
+    0xC3, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xE3, 0xFF, 0xE3, 0x80, 0xFF, 0xC1, 0x80, 0xFF, 0xC1, 0x00, 0xFF,
+    0x87, 0x00, 0x7F, 0x8F, 0x38, 0xFF, 0x8F, 0x38, 0xFF, 0x8E, 0x38, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC6, 0x20, 0xFF, 0x8E, 0x70, 0xFF, 0x8E, 0x78, 0xFF, 0x8E, 0x78, 0xFF,
+    0x86, 0x78, 0xFF, 0x80, 0x78, 0xFF, 0xC0, 0x78, 0xFF, 0xC0, 0x78, 0xFF,
+    0xE0, 0x79, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0x87, 0xF0, 0xDD, 0x8F, 0xF8, 0x89, 0x8F, 0xF8, 0x01,
+    0x87, 0xF8, 0xC3, 0x81, 0xF8, 0xC7, 0x81, 0xF8, 0xFF, 0xC3, 0xF8, 0xFF,
+    0xF7, 0xFB, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xCF, 0xC0, 0x00, 0xFF, 0x87, 0x82, 0x20, 0xFF, 0x83, 0x8E, 0x30, 0xFF,
+    0xC3, 0x8E, 0x38, 0xFF, 0xF1, 0x8E, 0x38, 0x7F, 0xFB, 0x86, 0x38, 0xFF,
+    0xFF, 0x80, 0x38, 0xFF, 0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0xC0, 0x38, 0xFF,
+    0xFF, 0xE0, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x82, 0x20, 0xFF, 0xFB, 0x8E, 0x30, 0xFF,
+    0xE1, 0x8E, 0x38, 0xFF, 0xC3, 0x8E, 0x38, 0x7F, 0x83, 0x86, 0x38, 0xFF,
+    0x87, 0x80, 0x38, 0xFF, 0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0xC0, 0x38, 0xFF,
+    0xFF, 0xE0, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xF3, 0x80, 0x01,
+    0xE3, 0x04, 0x41, 0x87, 0x1C, 0x61, 0x0F, 0x1C, 0x71, 0x1F, 0x1C, 0x70,
+    0x07, 0x0C, 0x71, 0xC3, 0x00, 0x71, 0xE3, 0x80, 0x71, 0xF3, 0x80, 0x71,
+    0xFF, 0xC0, 0x73, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0x8F, 0x80, 0x07, 0x8F, 0x00, 0x03,
+    0x8E, 0x08, 0x83, 0x8E, 0x38, 0xC3, 0xFE, 0x38, 0xE3, 0xFE, 0x38, 0xE1,
+    0x8E, 0x18, 0xE3, 0x8E, 0x00, 0xE3, 0x8F, 0x00, 0xE3, 0x8F, 0x00, 0xE3,
+    0xFF, 0x80, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xCF, 0xFC, 0x87, 0x8F, 0xFC, 0x83, 0x80, 0x00,
+    0xC3, 0x80, 0x00, 0xF1, 0x80, 0x00, 0xFB, 0x80, 0x00, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0x8F, 0xFC, 0xFB, 0x80, 0x00,
+    0xE1, 0x80, 0x00, 0xC1, 0x80, 0x00, 0x83, 0x80, 0x00, 0x87, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xFF, 0xF3, 0x9F, 0xF9, 0xE3, 0x1F, 0xF9, 0x87, 0x00, 0x01,
+    0x0F, 0x00, 0x01, 0x1F, 0x00, 0x01, 0x0F, 0x00, 0x01, 0x83, 0xFF, 0xF1,
+    0xE3, 0xFF, 0xF9, 0xF3, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0x8F, 0xFF, 0xFF, 0x8F, 0x3F, 0xF3, 0x8E, 0x3F, 0xF3, 0x8E, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFB, 0x80, 0x01,
+    0xC9, 0x00, 0x01, 0x83, 0x0F, 0xE1, 0x83, 0x1F, 0xF1, 0xC3, 0x1F, 0xF1,
+    0xC1, 0x1F, 0xF1, 0x80, 0x0F, 0xE1, 0x90, 0x00, 0x01, 0xBC, 0x00, 0x03,
+    0xFE, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x3F,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF9, 0xFF, 0x1F, 0xF9, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x87, 0x00, 0x01, 0x8F, 0x87, 0xF1,
+    0x8F, 0x8F, 0xF9, 0x87, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xE7, 0x0F, 0xF9,
+    0x87, 0x00, 0x01, 0x87, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xDF, 0xC0, 0x00, 0xFF, 0x87, 0xC0, 0x00, 0xFF, 0x87, 0x87, 0xF0, 0xFF,
+    0xC3, 0x8F, 0xF8, 0xFF, 0xE1, 0x8F, 0xF8, 0xFF, 0xF1, 0x8F, 0xF8, 0xFF,
+    0xFF, 0x87, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x87, 0xF0, 0xFF,
+    0xF1, 0x8F, 0xF8, 0xFF, 0xC1, 0x8F, 0xF8, 0xFF, 0x83, 0x8F, 0xF8, 0xFF,
+    0x87, 0x87, 0xF8, 0xFF, 0xCF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xFB, 0x80, 0x01,
+    0xE3, 0x80, 0x01, 0xC3, 0x0F, 0xE1, 0x87, 0x1F, 0xF1, 0x1F, 0x1F, 0xF1,
+    0x0F, 0x1F, 0xF1, 0x87, 0x0F, 0xF1, 0xC3, 0x00, 0x01, 0xF3, 0x80, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F,
+    // 0xF5 'õ'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03, 0xC7, 0x80, 0x01,
+    0x87, 0x80, 0x01, 0x8F, 0x0F, 0xE1, 0x8F, 0x1F, 0xF1, 0xC7, 0x1F, 0xF1,
+    0xE7, 0x1F, 0xF1, 0xC7, 0x0F, 0xF1, 0x87, 0x00, 0x01, 0x87, 0x80, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F,
+    // 0xF6 'ö'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x0F, 0xDF, 0x80, 0x07, 0x8F, 0x00, 0x03,
+    0x87, 0x00, 0x03, 0x8E, 0x1F, 0xC3, 0xDE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3,
+    0xCE, 0x3F, 0xE3, 0x8E, 0x1F, 0xE3, 0x86, 0x00, 0x03, 0x8F, 0x00, 0x07,
+    0xDF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x7F,
+    // 0xF7 '÷'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x88, 0xC7,
+    0x08, 0x87, 0x08, 0x87, 0x98, 0xCF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x01, 0xFF,
+    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x8F, 0x80, 0xFF, 0x8F, 0x18, 0xFF,
+    0x8E, 0x3C, 0xFF, 0x8C, 0x7C, 0xFF, 0x80, 0xF8, 0xFF, 0x80, 0x00, 0xFF,
+    0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xD8, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0x80, 0x00, 0xFF,
+    0x87, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0xF8, 0x7F, 0xC3, 0xFF, 0xF8, 0xFF,
+    0xF1, 0xCF, 0xF8, 0xFF, 0xFB, 0xCF, 0xF8, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFB, 0xFF, 0xF8, 0x7F, 0xE1, 0xFF, 0xF8, 0xFF,
+    0xC1, 0xCF, 0xF8, 0xFF, 0x83, 0xCF, 0xF8, 0xFF, 0x87, 0xC0, 0x01, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x01, 0xF3, 0x00, 0x01, 0xE3, 0x00, 0x01, 0x87, 0xFF, 0xF0,
+    0x0F, 0xFF, 0xF1, 0x1F, 0x9F, 0xF1, 0x0F, 0x9F, 0xF1, 0x83, 0x80, 0x03,
+    0xE3, 0x00, 0x01, 0xF3, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07,
+    0x8E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8F, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xE3, 0xFF, 0x3F, 0xE3, 0x8F, 0x3F, 0xE3, 0x8F, 0x00, 0x07,
+    0x8E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCF, 0x8F, 0xFF, 0xFF, 0xCF,
+    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xE3, 0xCF, 0xFE, 0x3F, 0xE1, 0xCF,
+    0xFE, 0x3F, 0xE3, 0xFF, 0xFE, 0x1F, 0xE3, 0xFF, 0xFE, 0x0F, 0xC3, 0xFF,
+    0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0x7F, 0xFF, 0x9F, 0xFE, 0x3F, 0xFF, 0x8F, 0xFE, 0x1F, 0xFF, 0x87,
+    0xFE, 0x07, 0xFF, 0x87, 0x8E, 0x01, 0xFF, 0x87, 0x86, 0x00, 0x3F, 0x0F,
+    0x8E, 0x00, 0x0F, 0x0F, 0x8E, 0x20, 0x00, 0x1F, 0xFE, 0x7C, 0x00, 0x3F,
+    0xDF, 0xFF, 0x80, 0x7F, 0x8F, 0xFF, 0x01, 0xFF, 0x87, 0x78, 0x07, 0xFF,
+    0x8E, 0x00, 0x1F, 0xFF, 0x8E, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFE, 0x00, 0xCF, 0xFF, 0xF8, 0x01, 0xCF, 0xFF, 0xC0, 0x11, 0xFF, 0xFF,
+    0x80, 0xF1, 0xFF, 0xFF, 0x03, 0xF1, 0xFF, 0xFF, 0x00, 0x71, 0xFF, 0xFF,
+    0x00, 0x01, 0xCF, 0xFF, 0x80, 0x01, 0xCC, 0x7F, 0xF0, 0x00, 0x08, 0x3F,
+    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x06, 0x3F,
+    0xFF, 0xFE, 0x0F, 0x3F, 0xFF, 0xFF, 0x8F, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xE1, 0xFF, 0xE3, 0x80, 0xFF, 0xC3, 0x80, 0xFF, 0xC3, 0x00, 0xFF,
+    0x87, 0x00, 0xFF, 0x8F, 0x18, 0xFF, 0x8F, 0x38, 0xFF, 0x8E, 0x38, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x00, 0x87, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0xFF, 0xF8, 0x73, 0xFF, 0xF8, 0xF3, 0xFF, 0xFD, 0xF7,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x83, 0xF8, 0x0F,
+    0xFF, 0x87, 0xFE, 0x0F, 0xF3, 0x0F, 0xFF, 0x0F, 0xF3, 0x1F, 0xFF, 0x0F,
+    0xE3, 0x1F, 0xFF, 0x87, 0xC3, 0x1F, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x8F,
+    0x87, 0x07, 0xFF, 0x8F, 0xCF, 0x01, 0xFF, 0x0F, 0xFF, 0x81, 0xFF, 0x0F,
+    0xFF, 0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFB, 0x87, 0xF0, 0xFF,
+    0xE1, 0x8F, 0xF8, 0xFF, 0x83, 0x8F, 0xF8, 0x7F, 0x87, 0x87, 0xF8, 0xFF,
+    0x8F, 0x81, 0xF8, 0xFF, 0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0xC3, 0xF8, 0xFF,
+    0xFF, 0xF7, 0xFB, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x1F, 0x8F, 0x83, 0xF8, 0x0F,
+    0x87, 0x87, 0xFE, 0x0F, 0xC3, 0x0F, 0xFF, 0x0F, 0xE1, 0x1F, 0xFF, 0x0F,
+    0xF1, 0x1F, 0xFF, 0x87, 0xE1, 0x1F, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x8F,
+    0x8F, 0x07, 0xFF, 0x8F, 0x9F, 0x01, 0xFF, 0x0F, 0xFF, 0x81, 0xFF, 0x0F,
+    0xFF, 0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xBF, 0xC0, 0x03, 0x0F, 0x80, 0x01,
+    0x07, 0x80, 0x01, 0xC3, 0x0F, 0xE1, 0xE3, 0x1F, 0xF1, 0xC3, 0x1F, 0xF0,
+    0x87, 0x0F, 0xF1, 0x0F, 0x03, 0xF1, 0x3F, 0x03, 0xF1, 0xFF, 0x87, 0xF1,
+    0xFF, 0xEF, 0xF7,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x0F,
+    0x87, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0xE1, 0x1F, 0xFF, 0x8F,
+    0xF1, 0x1F, 0xFF, 0x8F, 0xE1, 0x1F, 0xFF, 0x8F, 0xC3, 0x0F, 0xFF, 0x8F,
+    0x87, 0x0F, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0x0F, 0x9F, 0x83, 0xFE, 0x1F,
+    0xFF, 0x80, 0xF8, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xFE, 0x1F, 0xC1, 0xFE, 0x3F, 0xE3, 0x9E, 0x3F, 0xE3,
+    0x9E, 0x3F, 0xE3, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3,
+    0x01, 0xFF, 0xF7, 0x03, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0x8F, 0x8F, 0xFF,
+    0x0F, 0x8F, 0x8E, 0xFF, 0x0F, 0x8F, 0x88, 0x7F, 0x0F, 0x8F, 0x80, 0x3F,
+    0x0F, 0x8F, 0x80, 0x3F, 0x0F, 0x8F, 0x86, 0x3F, 0x03, 0x9C, 0x0F, 0x3F,
+    0x03, 0xFC, 0x0F, 0x7F, 0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0x82, 0x20, 0xFF, 0x8E, 0x30, 0xFF, 0x8E, 0x38, 0xFF, 0x8E, 0x38, 0x07,
+    0x86, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x38, 0x63, 0xC0, 0x38, 0xF3,
+    0xE0, 0x39, 0xF7, 0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F,
+    0xC3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x00, 0x0F, 0xF1, 0x0F, 0x8F, 0x8F,
+    0xE1, 0x0F, 0x8F, 0x8F, 0xC3, 0x0F, 0x8F, 0x8F, 0x87, 0x0F, 0x8F, 0x8F,
+    0x8F, 0x0F, 0x8F, 0x8F, 0x9F, 0x0F, 0x8F, 0x8F, 0xFF, 0x03, 0x9C, 0x0F,
+    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x83, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xBF, 0xC0, 0x03, 0x0F, 0x80, 0x01,
+    0x07, 0x04, 0x41, 0xC3, 0x1C, 0x61, 0xE3, 0x1C, 0x71, 0xC3, 0x1C, 0x70,
+    0x87, 0x0C, 0x71, 0x0F, 0x00, 0x71, 0x1F, 0x80, 0x71, 0xFF, 0x80, 0x71,
+    0xFF, 0xC0, 0x73, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFB, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x00, 0x0F,
+    0xC3, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0x87, 0x1F, 0xFF, 0x8F,
+    0xC7, 0x1F, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xBF, 0xFF, 0xF7, 0xF7, 0x3F, 0xFF, 0xE7, 0xE7, 0x1F, 0xFF, 0xC7,
+    0xE7, 0x00, 0x00, 0x07, 0xC6, 0x00, 0x00, 0x07, 0x86, 0x00, 0x00, 0x07,
+    0x86, 0x00, 0x00, 0x07, 0x0F, 0xFF, 0xFF, 0xE7, 0x9F, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF3, 0xC7, 0xFF, 0xF3, 0xC0, 0x00, 0x03,
+    0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0xC7, 0xFF, 0xE3, 0xC7, 0xFF, 0xE3, 0xEF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3,
+    0xC1, 0xFF, 0xE3, 0x01, 0xFF, 0xE3, 0x07, 0xFF, 0x03, 0x9F, 0xFE, 0x03,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F, 0xE7, 0xCF, 0x1F, 0xC7, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x8F, 0x1E, 0x3F, 0x8F, 0xBE, 0x7F, 0x8F,
+    0xFC, 0x7F, 0x8F, 0xFE, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFB, 0x9F, 0xF1, 0xF3, 0x8F, 0xE1, 0xE3,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0xFF, 0x1F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x7F, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0x8F, 0xFB, 0xC0, 0x3F, 0xCF,
+    0xF3, 0xE0, 0x1F, 0xFF, 0xE3, 0xF8, 0x07, 0xFF, 0xC3, 0xFC, 0x03, 0xFF,
+    0xC3, 0xFF, 0x00, 0xFF, 0x87, 0xFF, 0x80, 0x7F, 0x87, 0x9F, 0xE0, 0x1F,
+    0xFF, 0x1F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0x8F, 0xFC, 0xFF, 0x80, 0x00,
+    0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC3, 0xF8,
+    0xF3, 0xC7, 0xFC, 0xE1, 0x8F, 0xFF, 0x83, 0x8F, 0xFF, 0x87, 0x87, 0xFC,
+    0x8F, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
+    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0x8F, 0x00, 0x00, 0x0F, 0x87, 0x80, 0xFF, 0x8F, 0xC3, 0xC0, 0x3F, 0xCF,
+    0xE1, 0xE0, 0x1F, 0xFF, 0xF1, 0xF8, 0x07, 0xFF, 0xE1, 0xFC, 0x03, 0xFF,
+    0xC3, 0xFF, 0x00, 0xFF, 0x87, 0xFF, 0x80, 0x7F, 0x8F, 0x9F, 0xE0, 0x1F,
+    0x9F, 0x1F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF9, 0xFF, 0x1F, 0xF9, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x1F, 0x00, 0x01, 0x0F, 0x00, 0x01, 0x87, 0x87, 0xF1,
+    0xC3, 0x8F, 0xF9, 0xE3, 0x1F, 0xFF, 0xC3, 0x1F, 0xFF, 0x87, 0x0F, 0xF9,
+    0x1F, 0x00, 0x01, 0x3F, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
+    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
+    0xC0, 0x00, 0x1F, 0xC1, 0xFC, 0x1F, 0x87, 0xFF, 0x0F, 0x8F, 0xFF, 0x0F,
+    0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x0F, 0xFF, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F,
+    0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x8F, 0x07, 0x8F, 0x8F, 0x03, 0x9C, 0x0F,
+    0x03, 0xFC, 0x0F, 0xCF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0x87, 0xF0, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF,
+    0x8F, 0xF8, 0xFF, 0x87, 0xF8, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+    0xE0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x8E, 0x30, 0xFF,
+    0x8E, 0x38, 0xFF, 0x8E, 0x38, 0x7F, 0x8E, 0x38, 0xFF, 0x80, 0x38, 0xFF,
+    0x80, 0x38, 0xFF, 0xC0, 0x38, 0xFF, 0xE0, 0x39, 0xFF, 0xFC, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0xCF,
+    0xFF, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F,
+    0xC3, 0x00, 0x00, 0x0F, 0xE1, 0x00, 0x00, 0x0F, 0xF1, 0x1F, 0xC7, 0x8F,
+    0xE1, 0x1F, 0x83, 0xCF, 0xC3, 0x1F, 0x81, 0xFF, 0x87, 0x0F, 0x00, 0xFF,
+    0x8F, 0x00, 0x00, 0x3F, 0x9F, 0x80, 0x10, 0x1F, 0xFF, 0x80, 0x3C, 0x1F,
+    0xFF, 0xC0, 0x3E, 0x0F, 0xFF, 0xE0, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x159 'ř'
+    0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xF9, 0xFF, 0x1F, 0xF9, 0x1F, 0x00, 0x01,
+    0x0F, 0x00, 0x01, 0x87, 0x00, 0x01, 0xC3, 0x00, 0x01, 0xE3, 0xC7, 0xF1,
+    0xC3, 0x8F, 0xF9, 0x87, 0x0F, 0xF9, 0x1F, 0x0F, 0xFF, 0x3F, 0x0F, 0xFF,
+    0xFF, 0x1F, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x7C, 0x0F, 0xFF, 0xC0, 0x38, 0x0F,
+    0xFF, 0x80, 0x1E, 0x0F, 0xFF, 0x80, 0x1F, 0x8F, 0xF3, 0x0C, 0x0F, 0x87,
+    0xE3, 0x1E, 0x0F, 0x87, 0xE3, 0x1F, 0x07, 0x87, 0xC3, 0x1F, 0x07, 0x8F,
+    0x87, 0x1F, 0x83, 0x0F, 0x87, 0x03, 0x80, 0x0F, 0xCF, 0x01, 0xC0, 0x1F,
+    0xFF, 0x83, 0xE0, 0x3F, 0xFF, 0x8F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xC0, 0x60, 0xFF,
+    0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0x80, 0x3C, 0xFF, 0xF1, 0x8C, 0x1C, 0xFF,
+    0xC1, 0x9C, 0x1C, 0xFF, 0x83, 0x8E, 0x0C, 0xFF, 0x87, 0x8E, 0x00, 0xFF,
+    0xDF, 0x83, 0x00, 0xFF, 0xFF, 0xC3, 0x01, 0xFF, 0xFF, 0xC7, 0x83, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x7C, 0x0F, 0xDF, 0xC0, 0x38, 0x0F,
+    0x8F, 0x80, 0x1E, 0x0F, 0x87, 0x80, 0x1F, 0x8F, 0xE3, 0x0C, 0x0F, 0x87,
+    0xE1, 0x1E, 0x0F, 0x87, 0xF1, 0x1F, 0x07, 0x87, 0xE1, 0x1F, 0x07, 0x8F,
+    0xC7, 0x1F, 0x83, 0x0F, 0x8F, 0x03, 0x80, 0x0F, 0x9F, 0x01, 0xC0, 0x1F,
+    0xFF, 0x83, 0xE0, 0x3F, 0xFF, 0x8F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xE3, 0xBF, 0xC1, 0xC1, 0x1F, 0x80, 0xC1, 0x0F, 0x80, 0x71,
+    0x87, 0x00, 0x79, 0xE3, 0x18, 0x39, 0xE3, 0x38, 0x39, 0x83, 0x1C, 0x19,
+    0x0F, 0x1C, 0x01, 0x1F, 0x06, 0x01, 0x7F, 0x86, 0x03, 0xFF, 0x8F, 0x07,
+    0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x8F, 0x0F, 0xFF, 0xCF,
+    0x87, 0x0F, 0xFF, 0xCF, 0xC3, 0x0F, 0xFF, 0x8F, 0xE3, 0x00, 0x00, 0x0F,
+    0xF1, 0x00, 0x00, 0x0F, 0xE1, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F,
+    0x87, 0x0F, 0xFF, 0x8F, 0x8F, 0x0F, 0xFF, 0x8F, 0x9F, 0x0F, 0xFF, 0xCF,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x00, 0x07,
+    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00,
+    0xFF, 0x1F, 0xF1, 0x81, 0x1F, 0xF1, 0x81, 0x1F, 0xF1, 0x87, 0x1F, 0xF1,
+    0xFF, 0xFF, 0xF7,
+    // 0x16E 'Ů'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xC3, 0x1F, 0xFF, 0x0F,
+    0x81, 0x1F, 0xFF, 0x87, 0x19, 0xFF, 0xFF, 0x87, 0x39, 0xFF, 0xFF, 0x87,
+    0x81, 0xFF, 0xFF, 0x87, 0x81, 0x9F, 0xFF, 0x8F, 0xC7, 0x1F, 0xFF, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xE3, 0x80, 0x00, 0xFF,
+    0xC1, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xF8, 0x7F, 0x9C, 0xFF, 0xF8, 0xFF,
+    0x9C, 0xCF, 0xF8, 0xFF, 0x81, 0xCF, 0xF8, 0xFF, 0x81, 0xC0, 0x01, 0xFF,
+    0xC3, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0F, 0xE3, 0x1F, 0xFF, 0x0F,
+    0xC3, 0x1F, 0xFF, 0x87, 0x87, 0xFF, 0xFF, 0x87, 0x0F, 0xFF, 0xFF, 0x87,
+    0x8F, 0xFF, 0xFF, 0x87, 0xFB, 0x9F, 0xFF, 0x8F, 0xE1, 0x1F, 0xFF, 0x0F,
+    0xC3, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x1F, 0x07, 0x00, 0x00, 0x3F,
+    0x8F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xE1, 0x80, 0x00, 0xFF, 0x81, 0xFF, 0xF8, 0x7F, 0x87, 0xFF, 0xF8, 0xFF,
+    0x8F, 0xCF, 0xF8, 0xFF, 0xFB, 0xCF, 0xF8, 0xFF, 0xE1, 0xC0, 0x01, 0xFF,
+    0x81, 0x80, 0x00, 0xFF, 0x87, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x0C, 0x01, 0xFF, 0x3F,
+    0x0C, 0x00, 0xFF, 0x3F, 0x0C, 0x00, 0x3E, 0x3F, 0x8C, 0x60, 0x00, 0x3F,
+    0xFE, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0x8F, 0xFC, 0x00, 0x3F,
+    0x0E, 0x70, 0x00, 0x3F, 0x0C, 0x40, 0xFE, 0x3F, 0x8C, 0x01, 0xFF, 0x3F,
+    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0xFF, 0x01, 0xFE, 0x0F,
+    0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0x0F, 0xC0, 0x0F,
+    0xF3, 0x0F, 0x80, 0x0F, 0xE3, 0x0F, 0x01, 0x8F, 0xE3, 0x1C, 0x03, 0x8F,
+    0xC3, 0x18, 0x0F, 0x8F, 0x87, 0x00, 0x1F, 0x8F, 0x87, 0x00, 0x7F, 0x8F,
+    0xCF, 0x00, 0xFF, 0x8F, 0xFF, 0x03, 0xFE, 0x0F, 0xFF, 0x87, 0xF8, 0x0F,
+    0xFF, 0x8F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0xFF, 0xFF, 0x81, 0xE0, 0xFF,
+    0xFF, 0x83, 0xC0, 0xFF, 0xFF, 0x8F, 0x80, 0xFF, 0xFF, 0x8E, 0x00, 0xFF,
+    0xE1, 0x8C, 0x00, 0xFF, 0xC1, 0x88, 0x18, 0xFF, 0x83, 0x80, 0x38, 0xFF,
+    0x87, 0x80, 0x78, 0xFF, 0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0x83, 0xE0, 0xFF,
+    0xFF, 0x87, 0xC0, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x1F, 0xFE, 0x03, 0xFC, 0x1F,
+    0xFE, 0x07, 0xF0, 0x1F, 0xFE, 0x1F, 0xE0, 0x1F, 0xFE, 0x1F, 0x80, 0x1F,
+    0x8E, 0x1F, 0x00, 0x1F, 0x86, 0x1E, 0x03, 0x1F, 0x86, 0x38, 0x07, 0x1F,
+    0x86, 0x30, 0x1F, 0x1F, 0x8E, 0x00, 0x3F, 0x1F, 0xFE, 0x00, 0xFF, 0x1F,
+    0xFE, 0x01, 0xFF, 0x1F, 0xFE, 0x07, 0xFC, 0x1F, 0xFF, 0x0F, 0xF0, 0x1F,
+    0xFF, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE3, 0xFE, 0x07, 0x83, 0xFE, 0x0F, 0x03,
+    0xFE, 0x3E, 0x03, 0x8E, 0x38, 0x03, 0x0E, 0x30, 0x03, 0x0E, 0x20, 0x63,
+    0x0E, 0x00, 0xE3, 0xFE, 0x01, 0xE3, 0xFE, 0x07, 0xE3, 0xFE, 0x0F, 0x83,
+    0xFE, 0x1F, 0x03, 0xFF, 0xBF, 0x8F,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0xFF, 0x01, 0xFE, 0x0F,
+    0xDF, 0x03, 0xF8, 0x0F, 0x8F, 0x0F, 0xF0, 0x0F, 0x87, 0x0F, 0xC0, 0x0F,
+    0xE3, 0x0F, 0x80, 0x0F, 0xE1, 0x0F, 0x01, 0x8F, 0xF1, 0x1C, 0x03, 0x8F,
+    0xE1, 0x18, 0x0F, 0x8F, 0xC3, 0x00, 0x1F, 0x8F, 0x8F, 0x00, 0x7F, 0x8F,
+    0x9F, 0x00, 0xFF, 0x8F, 0xFF, 0x03, 0xFE, 0x0F, 0xFF, 0x87, 0xF8, 0x0F,
+    0xFF, 0x8F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF1, 0xBF, 0x03, 0xC1, 0x1F, 0x07, 0x81,
+    0x07, 0x1F, 0x01, 0xC3, 0x1C, 0x01, 0xE3, 0x18, 0x01, 0xC3, 0x10, 0x31,
+    0x87, 0x00, 0x71, 0x0F, 0x00, 0xF1, 0x1F, 0x03, 0xF1, 0x7F, 0x07, 0xC1,
+    0xFF, 0x0F, 0x81, 0xFF, 0xDF, 0xC7,
+    // 0x3C0 'π'
+    0xF3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFC, 0xFF,
+    0x87, 0xC0, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x7F, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x84, 0x01, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x87, 0xF8, 0xFF,
+    0x87, 0xF8, 0xFF, 0x87, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xF8, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x81, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFC, 0x1F, 0x1F, 0xBC, 0x0F, 0x1E, 0x1C, 0x0F,
+    0x18, 0x1F, 0x8F, 0x00, 0x0F, 0xC7, 0x00, 0x0F, 0xC7, 0x81, 0x87, 0x8F,
+    0x87, 0x80, 0x0F, 0xCF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFC, 0xFF,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F,
+    // 0x2018 '‘'
+    0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0xBE, 0xFF, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    // 0x201B '‛'
+    0x87, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0x7F, 0xBE, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xF0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0xBE, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x1C, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF, 0x9C, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x83, 0xFF, 0xEF, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF, 0x9C, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x81, 0xFF, 0xEF, 0xFF,
+    // 0x201F '‟'
+    0x87, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0x7F, 0xBE, 0x7F, 0xFF, 0xFF,
+    0x83, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x9C, 0x7F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0xF0, 0x3F, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x78, 0x7F, 0xF8, 0xF8, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0xFF, 0x00, 0x84, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x84, 0x87, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0x7F, 0xF8, 0xF8, 0x7F,
+    0xF8, 0x78, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xC7, 0x83, 0x81, 0x81, 0x83, 0x83, 0xFF,
+    // 0x2026 '…'
+    0x8F, 0x0F, 0x07, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x0F, 0x07,
+    0x0F, 0x0F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0F, 0x07, 0x0F, 0x8F,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x86, 0x1F,
+    0x8F, 0x1F, 0xBF, 0x9F, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xBF, 0xDF, 0x9F, 0x1F, 0x8E, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F,
+    0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x07, 0xC0, 0x03, 0x87, 0xC3, 0x8F, 0xE3,
+    0x8F, 0xE3, 0x8F, 0xE3, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0xF0, 0x3F,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF0, 0x9F, 0xE1, 0x9F,
+    0xC7, 0x9F, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xFF, 0x9F, 0xFF, 0x9F,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xC7, 0x11, 0xC7,
+    0x18, 0x07, 0x18, 0x0F, 0x1C, 0x1F, 0xBE, 0x3F,
+    // 0x2076 '⁶'
+    0xFE, 0x3F, 0xF8, 0x0F, 0xE0, 0x07, 0xE0, 0x03, 0xC0, 0xE3, 0x80, 0xE3,
+    0x88, 0xE3, 0x8C, 0x03, 0x9C, 0x07, 0x9E, 0x0F, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xFF, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x1F, 0x07, 0x1C, 0x07, 0x18, 0x07,
+    0x00, 0x7F, 0x01, 0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0x8F, 0xE3, 0x07, 0xC0, 0x03, 0x80, 0x23, 0x98, 0x73, 0x9C, 0x73,
+    0x98, 0x63, 0x80, 0x03, 0xC0, 0x07, 0xE3, 0x0F, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xF1, 0xFF, 0xC0, 0xF3, 0x80, 0x73, 0x80, 0x63, 0x8E, 0x63, 0x9E, 0x03,
+    0x8E, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xE0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x0F, 0x87, 0x1F, 0xC7,
+    0x1F, 0xC7, 0x1F, 0xC7, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0xE0, 0x7F,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xEF, 0xF3, 0xC7, 0xF3, 0xC7, 0xE3, 0xC0, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0xDF, 0xE3, 0xFF, 0xE3, 0xFF, 0xF7,
+    // 0x2082 '₂'
+    0xEF, 0xCF, 0x87, 0xC7, 0x87, 0x87, 0x07, 0x07, 0x1E, 0x07, 0x1C, 0x47,
+    0x00, 0x47, 0x00, 0xC7, 0x81, 0xC7, 0xC7, 0xC7, 0xFF, 0xDF,
+    // 0x2083 '₃'
+    0xFF, 0xFF, 0x8F, 0xE7, 0x8F, 0xE7, 0x18, 0xC7, 0x39, 0xC7, 0x38, 0xC7,
+    0x00, 0x07, 0x00, 0x0F, 0x84, 0x1F, 0xCE, 0x3F,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xE1, 0x3F, 0xC3, 0x3F,
+    0x87, 0x3F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0x3F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xE7, 0x01, 0xE7, 0x01, 0xE7, 0x01, 0xC7, 0x11, 0xC7,
+    0x18, 0x07, 0x18, 0x0F, 0x1C, 0x1F, 0xBE, 0x3F,
+    // 0x2086 '₆'
+    0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0x81, 0xC7, 0x09, 0xE7,
+    0x19, 0xC7, 0x18, 0x07, 0x38, 0x0F, 0xBC, 0x1F, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xFF, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x1F, 0x07, 0x1C, 0x07, 0x18, 0x07,
+    0x00, 0x7F, 0x01, 0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x1F, 0xC6, 0x0F, 0x80, 0x07, 0x00, 0x47, 0x30, 0xE7, 0x38, 0xE7,
+    0x30, 0x67, 0x00, 0x07, 0x82, 0x0F, 0xC6, 0x1F, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xE3, 0xFF, 0x81, 0xE7, 0x80, 0xE7, 0x00, 0xC7, 0x1C, 0x47, 0x1C, 0x07,
+    0x1C, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0xFF, 0xF7, 0xFF, 0xFF, 0x23, 0xFF, 0xFF, 0x23, 0xFF, 0xFC, 0x00, 0xFF,
+    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC1, 0x22, 0x0F,
+    0x87, 0x23, 0x0F, 0x8F, 0x23, 0x8F, 0x8F, 0x23, 0x8F, 0x8F, 0x27, 0x87,
+    0x9F, 0x7F, 0x8F, 0x8F, 0xFF, 0x8F, 0x81, 0xFF, 0x8F, 0x81, 0xFF, 0x8F,
+    0x83, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0xFF, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF, 0x3F, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F, 0x3F, 0x3F, 0x0F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x3F, 0x00, 0x3F, 0x07, 0x3F, 0x81, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xC3, 0xFF, 0x01, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0xBF, 0x3F, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFB,
+    0xFF, 0xF3, 0xE3, 0xFF, 0xFB, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x81, 0xCF, 0xE7, 0x87, 0x87, 0xE7,
+    0x9F, 0x8C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x18, 0xC7, 0xFF, 0x10, 0xC7,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x86, 0x1F, 0xFF, 0xFF, 0x7F,
+    // 0x2154 '⅔'
+    0xF7, 0xF7, 0xFF, 0xE3, 0xE3, 0xFF, 0xC1, 0xC3, 0xFF, 0xC3, 0x83, 0xFF,
+    0xCF, 0x83, 0xFF, 0xCE, 0x03, 0xFF, 0xC0, 0x23, 0xFF, 0xC0, 0x63, 0xFF,
+    0xC0, 0xE3, 0xE3, 0xE1, 0xE3, 0xC1, 0xFF, 0xF7, 0x03, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x07, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xCF, 0xE7, 0x83, 0x87, 0xE7,
+    0x8F, 0x8C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x18, 0xC7, 0xFF, 0x10, 0xC7,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x86, 0x1F, 0xFF, 0xFF, 0x7F,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFB, 0xFF, 0xE7, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF3, 0xFB,
+    0xFF, 0xF3, 0xE3, 0xFF, 0xFB, 0xC1, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xE7, 0x0F, 0x87, 0xC2, 0x07,
+    0x8F, 0x80, 0x07, 0xFF, 0x80, 0x67, 0xFF, 0x18, 0xE3, 0xFF, 0x38, 0xE7,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x0F, 0xFF, 0xEF, 0x1F,
+    // 0x215C '⅜'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xF3, 0xFF, 0xC7, 0xF1, 0xFF, 0xCE, 0x71, 0xFF,
+    0xCE, 0x71, 0xFF, 0xCC, 0x63, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xF3,
+    0xC1, 0x07, 0xC1, 0xF7, 0x8F, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xE7, 0x0F, 0x87, 0xC2, 0x07,
+    0xDF, 0x80, 0x07, 0xFF, 0x80, 0x67, 0xFF, 0x18, 0xE3, 0xFF, 0x38, 0xE7,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x0F, 0xFF, 0xEF, 0x1F,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xC0, 0xF1, 0xFF, 0xC0, 0xF1, 0xFF,
+    0xC0, 0x71, 0xFF, 0xC4, 0x63, 0xFF, 0xC4, 0x03, 0xFF, 0xC6, 0x03, 0xF3,
+    0xC6, 0x07, 0xC1, 0xCF, 0x1F, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xE7, 0x0F, 0x8F, 0xC2, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x67, 0xFF, 0x18, 0xE3, 0xFF, 0x38, 0xE7,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x0F, 0xFF, 0xEF, 0x1F,
+    // 0x215E '⅞'
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC7, 0xC3, 0xFF,
+    0xC7, 0x01, 0xFF, 0xC4, 0x03, 0xFF, 0xC0, 0x1F, 0xF3, 0xC0, 0xFF, 0xC1,
+    0xC1, 0xFF, 0x03, 0xC7, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF,
+    0xC0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xE7, 0x0F, 0xFF, 0xC2, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x67, 0xFF, 0x18, 0xE3, 0xFF, 0x38, 0xE7,
+    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x0F, 0xFF, 0xEF, 0x1F,
+    // 0x2190 '←'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x08, 0x8F,
+    0x98, 0x8F, 0xD8, 0xDF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0xC3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xD8, 0xDF, 0x98, 0x8F,
+    0x08, 0x8F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x88, 0x8F,
+    0xD8, 0x9F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xD8, 0x9F,
+    0x88, 0x8F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2195 '↕'
+    0xFB, 0xFB, 0xFF, 0xF1, 0xF1, 0xFF, 0xE1, 0xF0, 0xFF, 0xC3, 0xF8, 0x7F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0xC3, 0xF8, 0x7F, 0xE1, 0xF0, 0xFF, 0xF1, 0xF1, 0xFF, 0xFB, 0xFB, 0xFF,
+    // 0x21D0 '⇐'
+    0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x8F, 0xE1, 0x87, 0xC1, 0x83,
+    0x81, 0x81, 0x89, 0x88, 0xD9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xE1, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE1, 0xF8, 0x3F,
+    0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xD9, 0x8F, 0x89, 0x88, 0x81, 0x81,
+    0xC1, 0x83, 0xE1, 0x87, 0xF0, 0x8F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF,
+    0x83, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x87, 0xF1, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFC, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xE1, 0x1F, 0xC3, 0x0F, 0x83, 0x03,
+    0x83, 0x03, 0xD3, 0x37, 0xF3, 0x3F, 0xF3, 0x3F, 0xD3, 0x37, 0x83, 0x03,
+    0x83, 0x07, 0xC3, 0x0F, 0xE1, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xCF, 0xC0, 0x03,
+    0x8F, 0x80, 0x03, 0x9F, 0x0F, 0xE3, 0x1F, 0x1F, 0xE3, 0x1E, 0x3F, 0xE3,
+    0x1E, 0x3F, 0xC3, 0x0E, 0x3F, 0x07, 0x01, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F,
+    0xFF, 0x80, 0x0F, 0xFC, 0x01, 0x8F, 0xF0, 0x0F, 0x8F, 0xC0, 0x7F, 0x8F,
+    0x81, 0xFF, 0x8F, 0x03, 0xFF, 0x8F, 0x00, 0x7F, 0x8F, 0x00, 0x0F, 0x8F,
+    0xC0, 0x01, 0x8F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xCF,
+    // 0x220F '∏'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0xFF, 0x87, 0xFF, 0xE0, 0xFF,
+    0x03, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x7E, 0x00, 0xFF,
+    0x00, 0x1C, 0x08, 0xFF, 0x18, 0x08, 0x38, 0xFF, 0x1C, 0x00, 0x78, 0xFF,
+    0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x81, 0xF8, 0xFF, 0x1F, 0xE7, 0xF8, 0xFF,
+    0x1F, 0xFF, 0xF8, 0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0x03, 0xFF, 0xE0, 0xFF,
+    0x01, 0xFF, 0xC0, 0x7F, 0x83, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xE1, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0x0E, 0x3F, 0x1E, 0x3F, 0x1E, 0x3F,
+    0x8C, 0x7F, 0x80, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x8C, 0x3F,
+    0x1E, 0x3F, 0x1E, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xF3, 0x9F, 0xF3, 0x8F, 0xF3, 0x87, 0xF3, 0x83, 0xF3, 0x83, 0xF0, 0x0F,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xC1, 0x8F, 0x83, 0x8F, 0xC3, 0x8F, 0xF3, 0x8F,
+    0xF3, 0x8F,
+    // 0x2264 '≤'
+    0xFD, 0xFE, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF0, 0x7C, 0x7F,
+    0xF0, 0x7C, 0x7F, 0xE2, 0x3C, 0x7F, 0xE2, 0x3C, 0x7F, 0xC7, 0x1C, 0x7F,
+    0xC7, 0x1C, 0x7F, 0x8F, 0x8C, 0x7F, 0x8F, 0x84, 0x7F, 0x1F, 0xC4, 0x7F,
+    0xDF, 0xDC, 0x7F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0x3F, 0x8F, 0xE6, 0x3F, 0x8F, 0xC6, 0x3F, 0xC7, 0xC6, 0x3F,
+    0xC7, 0xCE, 0x3F, 0xE3, 0x8E, 0x3F, 0xE3, 0x9E, 0x3F, 0xF1, 0x1E, 0x3F,
+    0xF0, 0x1E, 0x3F, 0xF8, 0x3E, 0x3F, 0xF8, 0x3E, 0x3F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x3F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BoldBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x03, 0x40, 0x36, 0x23, 0x80, 0x00, 0x07, 0x00, 0x01, 0x43,
+    0x00, 0xFE, 0x47, 0x20, 0x00, 0x4B, 0x00, 0x00, 0x03,
+    // 0x22 '"'
+    0x3E, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x03, 0xDF, 0x00, 0x1F, 0x27, 0x1F,
+    0x40, 0x1F, 0x00, 0x5F, 0x00, 0x5F, 0x38, 0x1F,
+    // 0x23 '#'
+    0x00, 0x08, 0x3F, 0x06, 0x00, 0x3F, 0x0A, 0x02, 0x3F, 0x0A, 0x20, 0x3F,
+    0x09, 0x00, 0x3F, 0x30, 0x02, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x3A, 0x02, 0xBF, 0x0A, 0x00, 0x3F, 0x0A, 0x80, 0x3F, 0x20, 0x00, 0xBF,
+    0x80, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x2A, 0x00, 0x3F, 0x8A, 0x38, 0x3F,
+    0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x48, 0x07, 0x01, 0x08, 0x80, 0x07, 0x00, 0x00, 0x80, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0xA2, 0x08, 0x07, 0x00, 0x01, 0xE9, 0xCF,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x11, 0xF7, 0x49, 0xC8, 0x80, 0x07,
+    0x00, 0x08, 0x02, 0x07, 0x00, 0xC4, 0x02, 0x07, 0x04, 0x00, 0x04, 0x07,
+    0x00, 0x42, 0x00, 0x07, 0x01, 0x80, 0xA0, 0x07,
+    // 0x25 '%'
+    0x0A, 0xE0, 0x01, 0x10, 0x10, 0x01, 0x20, 0x08, 0x01, 0x41, 0x40, 0x01,
+    0x50, 0x20, 0x01, 0x40, 0x00, 0x01, 0x48, 0x20, 0x11, 0x40, 0x08, 0x01,
+    0x20, 0x01, 0x01, 0x10, 0x02, 0x01, 0x07, 0x80, 0x41, 0x00, 0x21, 0x01,
+    0x00, 0x86, 0x01, 0x03, 0x08, 0x01, 0x04, 0x01, 0x81, 0x00, 0x88, 0x11,
+    0x03, 0x00, 0x01, 0x84, 0x00, 0x01, 0x40, 0x40, 0x05, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x05, 0x00, 0x43, 0x81, 0x00, 0x00, 0x01, 0x00, 0x20, 0x11,
+    0x00, 0x04, 0x61,
+    // 0x26 '&'
+    0x00, 0x00, 0x03, 0x00, 0x0C, 0x63, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x19, 0x03, 0x0B, 0x00, 0x00, 0x03, 0x40, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x90, 0xC1, 0x27, 0x80, 0x20, 0x83, 0x91, 0x48, 0x27, 0x80, 0x04, 0x23,
+    0x00, 0x02, 0x03, 0x40, 0x01, 0x03, 0x28, 0x09, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x87, 0x00, 0x08, 0x07, 0x00, 0x08, 0x27,
+    0x00, 0x30, 0x23, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x03,
+    // 0x27 '''
+    0x3E, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x03, 0xDF, 0x00, 0x1F,
+    // 0x28 '('
+    0x00, 0x28, 0xA0, 0x0F, 0x01, 0x80, 0x0C, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x20, 0x80, 0x30, 0x4F, 0x42, 0x00, 0x00, 0x2F,
+    0x04, 0x00, 0x01, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x8F,
+    0x44, 0x00, 0x00, 0x1F, 0x01, 0x80, 0x08, 0x2F, 0x10, 0x2F, 0xA0, 0x4F,
+    0x00, 0x00, 0x01, 0x0F, 0x02, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x19, 0x80, 0x0F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x28, 0xBF, 0x08, 0x3F, 0x24, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x02, 0x3F, 0x03, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x04, 0x3F,
+    // 0x2B '+'
+    0x05, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F,
+    0x00, 0x07, 0x00, 0x07, 0x78, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x00, 0x3F, 0x01, 0x3F, 0x8C, 0x3F, 0x80, 0xBF, 0x01, 0x3F, 0x84, 0x3F,
+    0x60, 0x3F,
+    // 0x2D '-'
+    0x0F, 0x1F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xCF,
+    // 0x2E '.'
+    0x47, 0x07, 0x07, 0x07, 0x87, 0x17,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x06, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x41, 0x03, 0x00, 0x01,
+    0x00, 0x0C, 0x01, 0x00, 0x30, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x18, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x00, 0x07, 0x01, 0x02, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x7A, 0x07, 0x04, 0x00, 0x8F, 0x80, 0x00, 0x0F,
+    0x90, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0x88, 0x00, 0x07, 0x06, 0x01, 0x17,
+    0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x08, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x3F, 0x20, 0x00, 0x4F, 0x04, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x4F, 0xFF, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x1F,
+    // 0x32 '2'
+    0x04, 0x00, 0x4F, 0x11, 0x00, 0x8F, 0x21, 0x01, 0x0F, 0x01, 0x02, 0x0F,
+    0x05, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x90, 0x01, 0x0F, 0x90, 0x20, 0x0F,
+    0x80, 0x40, 0x0F, 0x85, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x00, 0xBF,
+    // 0x33 '3'
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x17, 0x02, 0x00, 0x07, 0x04, 0x60, 0x0F,
+    0x08, 0x40, 0x47, 0x00, 0x00, 0x4F, 0x90, 0x90, 0x0F, 0x80, 0x80, 0x07,
+    0x90, 0x10, 0x07, 0x8A, 0x02, 0x07, 0x00, 0x00, 0x07, 0x40, 0x80, 0x07,
+    0x01, 0x00, 0x47, 0x1E, 0x10, 0x87, 0x00, 0x04, 0x07,
+    // 0x34 '4'
+    0x00, 0x04, 0x07, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x08, 0x07, 0x04, 0x28, 0x07, 0x10, 0x88, 0x07,
+    0x20, 0x08, 0x07, 0x42, 0x08, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x00, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x09, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x18, 0xC0, 0x07, 0x00, 0x20, 0x0F,
+    0x00, 0x20, 0x47, 0x00, 0x00, 0x0F, 0x02, 0x20, 0x0F, 0x00, 0x00, 0x07,
+    0x01, 0x01, 0x17, 0x01, 0x0C, 0x17, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x07, 0x30, 0x33, 0x07,
+    // 0x36 '6'
+    0x00, 0x3E, 0x07, 0x01, 0x80, 0x87, 0x04, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x17, 0x20, 0x22, 0x07, 0x02, 0x00, 0x8F, 0x04, 0x00, 0x4F,
+    0x00, 0x20, 0x4F, 0x08, 0x00, 0x8F, 0x80, 0x05, 0x07, 0x80, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x00, 0x00, 0x47, 0x20, 0x16, 0x87,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0xA7,
+    0x00, 0x06, 0x07, 0x08, 0x18, 0x0F, 0x08, 0x20, 0x07, 0x08, 0x80, 0x27,
+    0x09, 0x02, 0x07, 0x0C, 0x08, 0x07, 0x08, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x03, 0x87, 0x09, 0x08, 0x27, 0x00, 0x80, 0x07, 0x00, 0x20, 0x17,
+    0x40, 0x02, 0x07, 0x0A, 0x08, 0x8F, 0x90, 0x10, 0x4F, 0x90, 0x10, 0x07,
+    0x90, 0x88, 0x4F, 0x81, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0xA0, 0x07, 0x20, 0x00, 0x07, 0x0C, 0x07, 0x07,
+    // 0x39 '9'
+    0x03, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x47, 0x40, 0x08, 0x0F,
+    0x40, 0x08, 0x4F, 0x08, 0x80, 0x0F, 0x80, 0x00, 0x87, 0x90, 0x20, 0x17,
+    0x80, 0x00, 0x17, 0x08, 0x04, 0x27, 0x03, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x20, 0x01, 0x07, 0x00, 0x06, 0x07, 0x03, 0x60, 0x07,
+    // 0x3A ':'
+    0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x50, 0x02,
+    // 0x3B ';'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x47, 0x08, 0x1C, 0x07, 0x00, 0x10, 0x17,
+    0x00, 0x00, 0x27, 0x88, 0x10, 0x07, 0x10, 0x04, 0x07,
+    // 0x3C '<'
+    0x04, 0x07, 0x01, 0x07, 0x08, 0x07, 0x00, 0x87, 0x10, 0x47, 0x00, 0x47,
+    0x25, 0x27, 0x00, 0x27, 0x40, 0x97, 0x40, 0x87, 0x80, 0x4F, 0x80, 0x4F,
+    0x40, 0x37,
+    // 0x3D '='
+    0x00, 0xFF, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F,
+    0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F,
+    0x90, 0x7F,
+    // 0x3E '>'
+    0x20, 0x07, 0x80, 0x2F, 0x00, 0x47, 0x00, 0x47, 0x00, 0x17, 0x00, 0x87,
+    0x00, 0x27, 0x00, 0x07, 0x10, 0x47, 0x00, 0x07, 0x08, 0x87, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x88, 0x24, 0x2B, 0x00, 0x00, 0x07,
+    0x08, 0x41, 0x43, 0x88, 0x40, 0x47, 0x08, 0x08, 0x43, 0x04, 0x88, 0x13,
+    0x02, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x03, 0x03, 0x80, 0x03,
+    // 0x40 '@'
+    0x00, 0x26, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x3F,
+    0x04, 0x00, 0x02, 0x3F, 0x08, 0x60, 0x80, 0x3F, 0x11, 0x00, 0x01, 0x3F,
+    0x20, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x04, 0xBF, 0x40, 0xE2, 0x00, 0x3F,
+    0x49, 0x00, 0x02, 0x3F, 0x01, 0x20, 0x00, 0x7F, 0x10, 0x4A, 0x02, 0x3F,
+    0x92, 0x80, 0x02, 0x3F, 0x80, 0x04, 0x82, 0x3F, 0x82, 0x31, 0x42, 0x3F,
+    0x90, 0x00, 0x02, 0x7F, 0x90, 0x00, 0x20, 0x3F, 0x00, 0xBF, 0x02, 0x3F,
+    0x40, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x21, 0x84, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x18, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x01, 0xCF, 0x0C, 0x00, 0x0F,
+    0x00, 0x10, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+    0x00, 0x20, 0x2F, 0x00, 0x02, 0x0F, 0x00, 0x00, 0xCF, 0x03, 0x00, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x80, 0x00, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x9F, 0x0F, 0x87,
+    0x80, 0x10, 0x47, 0x80, 0x10, 0x47, 0x90, 0x10, 0x07, 0x09, 0x10, 0x87,
+    0x80, 0x0C, 0x17, 0x00, 0x00, 0x17, 0x40, 0x00, 0x07, 0x30, 0x20, 0x07,
+    0x00, 0x10, 0x87, 0x00, 0x00, 0x07,
+    // 0x43 'C'
+    0x01, 0xCC, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x40, 0x00, 0x17, 0x06, 0x00, 0x17, 0x80, 0x01, 0x07, 0x10, 0x00, 0x0F,
+    0x10, 0x00, 0x8F, 0x00, 0x00, 0x87, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x8F,
+    0x14, 0x00, 0x87, 0x80, 0x00, 0x07, 0x82, 0x00, 0x07, 0x48, 0x00, 0x07,
+    0x00, 0x00, 0xC7,
+    // 0x44 'D'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x80, 0x00, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x47, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x97, 0x88, 0x00, 0x87, 0x00, 0x01, 0x07, 0x40, 0x88, 0x27,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x47, 0x10, 0x00, 0x87, 0x08, 0x00, 0x07,
+    0x01, 0x08, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x10, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x90, 0x0F, 0x00, 0x90, 0x0F,
+    0x00, 0x90, 0x0F, 0x10, 0x90, 0x8F, 0x02, 0xB0, 0x0F, 0x02, 0x00, 0x0F,
+    0xE8, 0x02, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x0F,
+    0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x40, 0x0F, 0xB8, 0x00, 0x0F,
+    // 0x47 'G'
+    0x01, 0xCC, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x27,
+    0x00, 0x20, 0x17, 0x40, 0x06, 0x17, 0x08, 0x00, 0x07, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x8F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x20, 0x0F,
+    0x00, 0x24, 0x0F, 0x00, 0x23, 0x07, 0x80, 0x20, 0x07, 0x02, 0x20, 0x17,
+    0x02, 0x20, 0x17, 0x78, 0x20, 0x27, 0x00, 0x28, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x90, 0x0F, 0x20, 0x80, 0x4F, 0x80, 0x80, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x80, 0x0F, 0x20, 0x80, 0x2F, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x0F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x4F, 0x20, 0x00, 0x4F, 0xE0, 0x00, 0x3F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x10, 0x00, 0x60, 0x7F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x28, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x47, 0x40, 0x02, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x87, 0x00, 0x00, 0x47, 0x00, 0x08, 0x27, 0x04, 0x04, 0x07,
+    0x08, 0x02, 0x07, 0x10, 0x01, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x4F,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x06, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x04, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x4F, 0x00, 0x66, 0x0F,
+    0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x1C, 0x0F, 0x06, 0x00, 0x4F,
+    0x00, 0xC0, 0x3F, 0x00, 0x18, 0x0F, 0x40, 0x03, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x80, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x40, 0x0F, 0x08, 0x00, 0x0F,
+    0x60, 0x20, 0x0F, 0x01, 0x00, 0x2F, 0x06, 0x00, 0x0F, 0x00, 0x0E, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x19, 0x8F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x17, 0x20, 0x00, 0x07, 0x10, 0x00, 0x47, 0x0F, 0xFF, 0x87,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0xFF, 0x87, 0x80, 0x80, 0x07,
+    0x20, 0x40, 0x47, 0x00, 0x10, 0x27, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x40, 0x87, 0xA0, 0x20, 0x07, 0x00, 0x08, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x01, 0xCE, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x40, 0x00, 0x17, 0x02, 0x06, 0x07, 0x80, 0x01, 0x07, 0x10, 0x00, 0x8F,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x47, 0x10, 0x00, 0x47, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x87, 0x00, 0x01, 0x17, 0x83, 0x86, 0x17, 0x40, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x87, 0x00, 0x03, 0x07, 0x02, 0xE8, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x90, 0x00, 0x4F, 0x80, 0x48, 0x3F, 0x80, 0x00, 0x0F,
+    0x05, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x09, 0x80, 0x0F,
+    // 0x51 'Q'
+    0x01, 0xCE, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F,
+    0x00, 0x00, 0x20, 0x1F, 0x40, 0x00, 0x10, 0x1F, 0x02, 0x06, 0x10, 0x1F,
+    0x80, 0x01, 0x00, 0x1F, 0x10, 0x00, 0x08, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x10, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x00, 0x01, 0x10, 0x1F, 0x83, 0x86, 0x10, 0x5F,
+    0x40, 0x00, 0x20, 0x5F, 0x00, 0x00, 0x42, 0x1F, 0x20, 0x00, 0x80, 0x1F,
+    0x00, 0x03, 0x02, 0x1F, 0x02, 0xE8, 0x02, 0x5F, 0x00, 0x00, 0x02, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x52 'R'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x80, 0x00, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x40, 0x07, 0x80, 0x00, 0x47, 0x90, 0x42, 0x37, 0x80, 0x00, 0x87,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x24, 0x17, 0x00, 0x00, 0x07,
+    0x01, 0x80, 0x0F, 0x00, 0x00, 0x87, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x02, 0x07, 0x10, 0x84, 0x17, 0x00, 0x00, 0x07, 0x40, 0x23, 0x07,
+    0x80, 0x10, 0x8F, 0x88, 0x00, 0x47, 0x11, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x84, 0x4F, 0x00, 0x83, 0x87, 0x88, 0x40, 0x17, 0x00, 0x00, 0x07,
+    0x82, 0x20, 0x27, 0x08, 0x18, 0x87, 0x00, 0x00, 0x07,
+    // 0x54 'T'
+    0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x1F, 0xFF, 0xCF,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x55 'U'
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x02, 0x07,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x87, 0x10, 0x06, 0x17,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0xC7, 0x00, 0x02, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x06, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x40, 0x67, 0x02, 0x00, 0x07, 0x10, 0x0C, 0x07,
+    0x00, 0x00, 0x07, 0x01, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x57 'W'
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x03, 0x00, 0x07, 0x00, 0x30, 0x07, 0x00, 0x06, 0x07, 0x00, 0x20, 0x07,
+    0x02, 0x00, 0x27, 0x28, 0x00, 0x07, 0x00, 0x20, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x01, 0x07, 0x18, 0x00, 0x27, 0x02, 0x00, 0x07,
+    0x00, 0x30, 0x07, 0x00, 0x06, 0x07, 0x20, 0x28, 0x07, 0x02, 0x80, 0x17,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x02, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x90, 0x4F,
+    0x10, 0x01, 0x0F, 0x28, 0x00, 0x0F, 0x82, 0x08, 0x0F, 0x00, 0x02, 0x2F,
+    0x40, 0x01, 0x0F, 0x28, 0x60, 0x4F, 0x01, 0x00, 0x0F, 0x02, 0x08, 0x0F,
+    0x00, 0x02, 0x0F, 0x08, 0x00, 0x0F, 0x10, 0x00, 0x8F, 0x20, 0x00, 0x0F,
+    0x80, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x20, 0x4F, 0x00, 0x10, 0x0F,
+    0x20, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x80, 0x0F,
+    0xA2, 0x10, 0x0F, 0x18, 0x20, 0x0F, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x2F,
+    0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x18, 0x00, 0x87, 0x00, 0x02, 0x07, 0x02, 0x04, 0x07,
+    0x08, 0x10, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x01, 0x02, 0x07,
+    0x12, 0x00, 0x07, 0x18, 0x08, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x01, 0x00, 0x07, 0x02, 0x03, 0x07, 0x88, 0x00, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x03, 0x87,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x5F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01,
+    0x00, 0xC0, 0x01, 0x30, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x01, 0x81,
+    0x00, 0x60, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0xC7, 0x00, 0x07, 0x18, 0x07, 0x40, 0x27,
+    0x03, 0x07, 0x08, 0x07, 0x06, 0x07, 0xC0, 0x47, 0x10, 0x07, 0x00, 0x07,
+    0x01, 0x87, 0x00, 0x07, 0x00, 0x0F,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x00, 0x00, 0x04, 0x20, 0x02, 0x08, 0x00,
+    // 0x61 'a'
+    0x08, 0x34, 0x7F, 0x00, 0x00, 0x7F, 0x22, 0x80, 0x7F, 0x02, 0x80, 0xFF,
+    0x0C, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x11, 0x04, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x02, 0x7F, 0x40, 0x01, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x0F, 0xF8, 0xFF, 0x00, 0x01, 0x7F, 0x00, 0x06, 0x7F,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0x10, 0x00, 0x01, 0x90, 0x00, 0x19,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x7F, 0x0F, 0xE3,
+    0x00, 0x20, 0x03, 0x00, 0x20, 0x01, 0x00, 0x20, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x17, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x11,
+    0x00, 0x60, 0x61, 0x00, 0x0E, 0x01,
+    // 0x63 'c'
+    0x06, 0x10, 0x7F, 0x08, 0x02, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x7F,
+    0x40, 0x20, 0x7F, 0x40, 0x10, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x7F,
+    0x0C, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0x02, 0x00, 0x7F, 0x22, 0x08, 0x7F,
+    0x10, 0x0A, 0x7F,
+    // 0x64 'd'
+    0x00, 0x18, 0x31, 0x00, 0x40, 0x09, 0x00, 0x80, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x83, 0x01, 0x20, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x05, 0x10, 0x00, 0x01, 0x80, 0x00, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05,
+    // 0x65 'e'
+    0x06, 0x10, 0x7F, 0x00, 0x02, 0x7F, 0x20, 0x01, 0x7F, 0x00, 0x01, 0x7F,
+    0x02, 0x60, 0x7F, 0x40, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x04, 0xFF, 0x40, 0x04, 0xFF, 0x40, 0x00, 0x7F, 0x20, 0x01, 0x7F,
+    0x00, 0x0A, 0x7F, 0x02, 0x00, 0x7F,
+    // 0x66 'f'
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03, 0x09, 0x00, 0x13,
+    0x80, 0x00, 0x13, 0x00, 0x00, 0x03, 0x10, 0x00, 0x0F, 0x81, 0x80, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    // 0x67 'g'
+    0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x18, 0x03, 0x05, 0x20, 0x20, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x91, 0x08, 0x04, 0x91, 0x10, 0x14, 0x91,
+    0x10, 0x14, 0x91, 0x08, 0x04, 0x83, 0x42, 0x04, 0x81, 0x00, 0x04, 0x61,
+    0x40, 0x40, 0x01, 0x18, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x01, 0xC1,
+    0x50, 0x00, 0x01,
+    // 0x68 'h'
+    0x20, 0x00, 0x07, 0x10, 0x00, 0x03, 0x1F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x01, 0x00, 0x03, 0x01, 0x20, 0x03, 0x00, 0x00, 0x07, 0x00, 0x0F, 0xF3,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x69 'i'
+    0x00, 0xC0, 0x03, 0x01, 0x00, 0x0B, 0x10, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x09, 0x00, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00, 0x03, 0x21, 0xFF, 0xE3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0F,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x87, 0x30, 0x1F, 0xF8, 0x07, 0x89, 0x00, 0x00, 0x17,
+    0x09, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x08, 0x00, 0x02, 0x07,
+    0x20, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x20, 0x00, 0x05, 0x10, 0x00, 0x01, 0x1F, 0xFF, 0xE1, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x41, 0x00, 0x40, 0x01, 0x00, 0x0C, 0x09,
+    0x00, 0x10, 0x05, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x05,
+    // 0x6C 'l'
+    0x60, 0x00, 0x0B, 0x10, 0x00, 0x03, 0x0F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x6D 'm'
+    0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x03, 0xF8, 0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x04, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x23, 0xF8, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x20, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    // 0x6E 'n'
+    0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x03, 0xF8, 0x08, 0x03, 0x08, 0x00, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
+    0x00, 0x03,
+    // 0x6F 'o'
+    0x06, 0x10, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x7F,
+    0x42, 0x20, 0x7F, 0x48, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x04, 0xFF, 0x04, 0x08, 0x7F, 0x41, 0xE1, 0x7F, 0x40, 0x01, 0x7F,
+    0x20, 0x00, 0x7F, 0x10, 0x04, 0x7F, 0x0A, 0x30, 0x7F,
+    // 0x70 'p'
+    0x30, 0x00, 0x05, 0x40, 0x00, 0x03, 0x07, 0xFF, 0xF3, 0x40, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x04, 0x83,
+    0x08, 0x00, 0x0B, 0x48, 0x00, 0x85, 0x00, 0x00, 0x81, 0x02, 0x10, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01,
+    0x04, 0x60, 0x01,
+    // 0x71 'q'
+    0x06, 0x10, 0x01, 0x10, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x02, 0x20, 0x81, 0x48, 0x08, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B,
+    0x00, 0x08, 0x0B, 0x00, 0x01, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09,
+    // 0x72 'r'
+    0x20, 0x01, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFC, 0x04, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00,
+    // 0x73 's'
+    0x04, 0x1D, 0x7F, 0x10, 0x01, 0x7F, 0x20, 0x00, 0x7F, 0x40, 0x08, 0xFF,
+    0x48, 0x04, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x04, 0xFF,
+    0x01, 0x00, 0x7F, 0x41, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x14, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x29, 0xFF, 0x4F,
+    0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xF1, 0xFE, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x4F,
+    // 0x75 'u'
+    0x20, 0x00, 0x00, 0x00, 0x90, 0x08, 0x00, 0x04, 0x00, 0x02, 0x80, 0x00,
+    0x9F, 0xC1, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xF0,
+    0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x3F, 0xF0, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x04,
+    // 0x76 'v'
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x38, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x06,
+    0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    // 0x77 'w'
+    0x40, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x10, 0x02, 0x04, 0x00, 0x80, 0x60, 0x00, 0xC0, 0x02, 0x02, 0x40, 0x40,
+    0x81, 0x00, 0x80, 0xC0, 0x80, 0x18, 0x20, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0xC1, 0x00, 0x04, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00,
+    // 0x78 'x'
+    0x00, 0x07, 0x20, 0x01, 0x00, 0x01, 0x00, 0x11, 0x00, 0x21, 0x02, 0x41,
+    0x00, 0x09, 0x30, 0x07, 0xC0, 0x01, 0x00, 0x11, 0xD0, 0x01, 0x22, 0x81,
+    0x00, 0x01, 0x08, 0x01, 0x10, 0x11, 0x20, 0x09, 0x40, 0x01, 0x00, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x0B, 0x20, 0x00, 0x27, 0x00, 0x00, 0x23, 0x04, 0x00, 0x03,
+    0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x8B, 0x30, 0x02, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x00, 0xC0, 0x83, 0xC0, 0x06, 0x03,
+    0x28, 0x18, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x00, 0x1C, 0x12, 0x04, 0x00, 0x08, 0x40, 0x11, 0x00, 0x00, 0x00,
+    0x04, 0x08, 0x08, 0x28, 0x00, 0x88, 0x00, 0x08, 0x02, 0x00, 0x00, 0x20,
+    0x10, 0x00, 0x40, 0x74,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x0F, 0x10, 0x80, 0x08, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x1F,
+    0x00, 0x88, 0x10, 0x1F, 0x90, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x7F, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x20, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x1F,
+    0x80, 0x30, 0xE0, 0x8F, 0x06, 0x00, 0x07, 0x1F, 0x40, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x0B, 0x58, 0xA4, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x06, 0x00, 0x0F,
+    // 0x7E '~'
+    0x23, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x03, 0x23, 0x03, 0x83,
+    0x13, 0x63,
+    // 0xA1 '¡'
+    0x48, 0x00, 0x09, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x09, 0x20, 0x01, 0x00, 0x00, 0x01,
+    // 0xA2 '¢'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x20, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x08, 0x0F, 0x02, 0x11, 0x00, 0x0F, 0x02, 0x00, 0x40, 0x0F,
+    0x00, 0x80, 0x05, 0xEF, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x8F, 0xE4, 0x0F, 0x00, 0x80, 0x20, 0x0F, 0x00, 0x60, 0x00, 0x0F,
+    0x02, 0x10, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x07, 0x00, 0x30, 0x17, 0x00, 0x10, 0x07, 0x00, 0x11, 0x0F,
+    0x00, 0x08, 0x0F, 0x08, 0x00, 0x17, 0x10, 0x00, 0x17, 0x00, 0x02, 0x07,
+    0x41, 0xC8, 0x07, 0x0C, 0x10, 0x07, 0x80, 0x10, 0x07, 0x80, 0x10, 0x0F,
+    0x80, 0x50, 0x0F, 0x06, 0x00, 0x0F, 0x42, 0x00, 0x8F, 0x40, 0x00, 0x97,
+    0x0C, 0x00, 0x47,
+    // 0xA4 '¤'
+    0x00, 0x01, 0x00, 0x01, 0x0A, 0xA1, 0x00, 0x01, 0x00, 0x01, 0x01, 0x09,
+    0x20, 0x01, 0x00, 0x21, 0x00, 0x01, 0x20, 0x09, 0x20, 0x01, 0x20, 0x09,
+    0x00, 0x01, 0x09, 0x21, 0x00, 0x01, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x60, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x04, 0x2C, 0x0F,
+    0x02, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x4F, 0x18, 0x08, 0x4F,
+    0x20, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x40, 0x0F, 0x60, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x4F, 0x01, 0x00, 0x3F, 0x04, 0x08, 0x0F,
+    0x08, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x06, 0x30, 0x29, 0x10, 0x08, 0x45, 0x21, 0xC4, 0x01, 0x00, 0x80, 0x23,
+    0x00, 0x10, 0x01, 0x00, 0x09, 0x01, 0x00, 0x20, 0x83, 0x00, 0x10, 0x11,
+    0x00, 0x02, 0x21, 0x04, 0x49, 0x01, 0x40, 0x03, 0x11, 0x28, 0x10, 0x01,
+    0x00, 0x07, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x01, 0x06, 0x07, 0x00, 0xF0, 0x87, 0x12, 0x00, 0x47,
+    0x08, 0x00, 0x27, 0x50, 0x70, 0x07, 0x41, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x04, 0x80, 0x07, 0x80, 0x00, 0x0F, 0x8A, 0x00, 0x07, 0x88, 0x04, 0x07,
+    0x08, 0x84, 0x2F, 0x00, 0x00, 0x07, 0x05, 0x02, 0x27, 0x40, 0x00, 0x47,
+    0x50, 0x00, 0x07, 0x08, 0x01, 0x27, 0x00, 0x06, 0x47, 0x08, 0x71, 0x07,
+    0x03, 0x02, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x20, 0x87, 0x14, 0x43, 0x08, 0x53, 0x80, 0x13, 0x08, 0x53, 0x1A, 0x13,
+    0x80, 0x53, 0x00, 0x53, 0x1F, 0x57, 0x01, 0x4B, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x0F, 0x09, 0x0F, 0x00, 0x8F, 0x20, 0x0F, 0x00, 0x0F, 0x0A, 0x2F,
+    0x80, 0x0F, 0x20, 0x6F, 0x01, 0x0F, 0x00, 0x0F, 0x20, 0x0F, 0x00, 0x0F,
+    0x0A, 0x0F, 0x80, 0x0F, 0x00, 0x6F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x05, 0x81, 0x10, 0x05, 0x48, 0x21, 0x30, 0x11,
+    0x10, 0x13, 0x40, 0x95, 0xC0, 0x25, 0x50, 0x21, 0x80, 0x55, 0x20, 0x19,
+    0x40, 0x15, 0x04, 0x69, 0x18, 0x01, 0x02, 0xC1,
+    // 0xB0 '°'
+    0x05, 0x1F, 0x00, 0x1F, 0x00, 0x5F, 0x04, 0x1F, 0x80, 0x3F, 0x91, 0x3F,
+    0x80, 0x3F, 0x0A, 0x1F, 0x00, 0x5F, 0x20, 0x9F, 0x0A, 0x1F,
+    // 0xB1 '±'
+    0x04, 0x02, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x04, 0x00, 0x3F, 0x80, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x7C, 0xF8, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0xB2 '²'
+    0x10, 0x03, 0x24, 0x03, 0x40, 0x43, 0x48, 0x03, 0x00, 0x03, 0x00, 0x23,
+    0x04, 0x03, 0x40, 0x03, 0x00, 0x03, 0x36, 0x07, 0x00, 0x0B,
+    // 0xB3 '³'
+    0x10, 0x0B, 0x08, 0x17, 0x09, 0x03, 0x00, 0x03, 0x00, 0x93, 0x10, 0x87,
+    0x08, 0x03, 0x40, 0x03, 0x01, 0x0B, 0x00, 0xB3,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x7D, 0x40, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x41, 0x4F, 0xE0, 0x01, 0x00, 0x00, 0x81, 0x00, 0x04, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x19, 0x01, 0x40, 0x02, 0x01, 0x40, 0x06, 0x01,
+    0x40, 0x01, 0x01, 0x00, 0x00, 0x81, 0x1F, 0xF0, 0x81, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
+    // 0xB6 '¶'
+    0x04, 0x40, 0x00, 0x10, 0x10, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x20, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    // 0xB7 '·'
+    0x47, 0x07, 0x07, 0x07, 0x87, 0x17,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x28, 0x0B, 0x20, 0x13, 0x00, 0x13, 0x40, 0x03, 0x40, 0x03,
+    0x00, 0x03, 0x1F, 0xF3, 0x00, 0x03, 0x00, 0x03,
+    // 0xBA 'º'
+    0x0F, 0x03, 0x00, 0x93, 0x80, 0x43, 0xB2, 0x53, 0x01, 0x13, 0x00, 0x13,
+    0x20, 0x53, 0x84, 0x53, 0x00, 0x83, 0x20, 0x13, 0x00, 0x03,
+    // 0xBB '»'
+    0x40, 0x4F, 0x90, 0x0F, 0x09, 0x2F, 0x04, 0x0F, 0x20, 0x4F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x6F, 0x80, 0x0F, 0x88, 0x0F, 0x02, 0x0F, 0x20, 0x4F,
+    0x00, 0x0F, 0x01, 0x0F, 0x08, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x01, 0x10, 0x0C, 0x01, 0x00, 0x0A, 0x01, 0x24, 0x02, 0x01,
+    0x20, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x3F, 0xF2, 0x01,
+    0x00, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x81, 0x00, 0x01, 0x09,
+    0x00, 0x00, 0x21, 0x00, 0x10, 0xC1, 0x00, 0x61, 0x01, 0x01, 0x84, 0x01,
+    0x02, 0x00, 0x01, 0x08, 0x40, 0x01, 0x21, 0x01, 0x01, 0x82, 0x04, 0x21,
+    0x00, 0x00, 0xA1, 0x60, 0x12, 0x21, 0x00, 0x00, 0x21, 0x00, 0x08, 0x81,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xB9, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0xA1,
+    // 0xBD '½'
+    0x00, 0x00, 0x01, 0x10, 0x0C, 0x01, 0x00, 0x0A, 0x01, 0x24, 0x02, 0x01,
+    0x20, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x3F, 0xF2, 0x05,
+    0x00, 0x02, 0x23, 0x00, 0x08, 0x43, 0x00, 0x00, 0x05, 0x00, 0x04, 0x11,
+    0x00, 0x08, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01,
+    0x00, 0x60, 0x01, 0x00, 0x80, 0x01, 0x80, 0x08, 0x01, 0x08, 0x00, 0x41,
+    0x30, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x21,
+    0x00, 0x00, 0x21, 0x00, 0x01, 0x21, 0x00, 0x00, 0x21, 0x00, 0x20, 0x21,
+    0x00, 0x00, 0x01,
+    // 0xBE '¾'
+    0x08, 0x0C, 0x01, 0x20, 0x0A, 0x01, 0x05, 0x88, 0x01, 0x08, 0x02, 0x01,
+    0x42, 0x00, 0x01, 0x42, 0x02, 0x01, 0x40, 0x40, 0x01, 0x00, 0x04, 0x05,
+    0x02, 0x00, 0x11, 0x14, 0xC0, 0x23, 0x00, 0x00, 0x03, 0x00, 0x02, 0x09,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x30, 0x01, 0x00, 0x40, 0x01, 0x40, 0x01, 0x01, 0x84, 0x04, 0x21,
+    0x10, 0x00, 0xA1, 0x60, 0x12, 0x21, 0x00, 0x00, 0x21, 0x00, 0x08, 0x81,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xB9, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0xA1,
+    // 0xBF '¿'
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x23, 0x83,
+    0x00, 0x00, 0x43, 0x40, 0x04, 0x03, 0x01, 0x80, 0x07, 0x00, 0x08, 0x03,
+    0x49, 0x08, 0x07, 0x30, 0x30, 0x03, 0x00, 0x00, 0x2B,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x28, 0x00, 0x01, 0xCF, 0x00, 0x0C, 0x00, 0x0F, 0x44, 0x00, 0x10, 0x0F,
+    0x24, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x12, 0x01, 0x00, 0x0F,
+    0x02, 0x00, 0x20, 0x2F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0xCF,
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x01, 0xCF, 0x00, 0x0C, 0x00, 0x0F, 0x0A, 0x00, 0x10, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x24, 0x01, 0x00, 0x0F,
+    0x04, 0x00, 0x20, 0x2F, 0x00, 0x00, 0x02, 0x0F, 0x10, 0x00, 0x00, 0xCF,
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x02, 0x00, 0x01, 0xCF, 0x00, 0x0C, 0x00, 0x0F, 0x24, 0x00, 0x10, 0x0F,
+    0x48, 0x00, 0x00, 0x0F, 0x10, 0x04, 0x00, 0x0F, 0x08, 0x01, 0x00, 0x0F,
+    0x44, 0x00, 0x20, 0x2F, 0x02, 0x00, 0x02, 0x0F, 0x02, 0x00, 0x00, 0xCF,
+    0x08, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x30, 0x1F, 0x10, 0x00, 0x80, 0x1F,
+    0x08, 0x00, 0x03, 0x9F, 0x08, 0x18, 0x00, 0x1F, 0x80, 0x00, 0x20, 0x1F,
+    0x90, 0x00, 0x00, 0x1F, 0x40, 0x08, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x40, 0x5F, 0x88, 0x00, 0x04, 0x1F, 0x40, 0x00, 0x01, 0x9F,
+    0x00, 0x06, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x70, 0x01, 0x00, 0x3F,
+    0x80, 0x00, 0x07, 0x3F, 0x80, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x70, 0x04, 0x00, 0x3F,
+    0x80, 0x00, 0x80, 0xBF, 0x80, 0x00, 0x08, 0x3F, 0x80, 0x00, 0x03, 0x3F,
+    0x30, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0xFF,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x10, 0x00, 0x01, 0xCF, 0x40, 0x0C, 0x00, 0x0F, 0x02, 0x00, 0x10, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x20, 0x04, 0x00, 0x0F, 0x38, 0x01, 0x00, 0x0F,
+    0x00, 0x00, 0x20, 0x2F, 0x40, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0xCF,
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x02, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x01, 0x4F,
+    0x41, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x08, 0x00, 0x4F, 0x0F, 0xF1, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x8F, 0x8F, 0x00, 0x10, 0x0F,
+    0x00, 0x90, 0x0F, 0x00, 0x90, 0x0F, 0x00, 0x90, 0x0F, 0x18, 0x90, 0x0F,
+    0x00, 0xB3, 0x0F, 0x00, 0x00, 0x0F, 0xB4, 0x00, 0x1F, 0x00, 0x01, 0x8F,
+    // 0xC7 'Ç'
+    0x01, 0xCC, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x40, 0x00, 0x10, 0x0F, 0x06, 0x00, 0x10, 0x0F,
+    0x80, 0x01, 0x00, 0x0F, 0x10, 0x00, 0x0D, 0x0F, 0x10, 0x00, 0x8C, 0x5F,
+    0x00, 0x00, 0x84, 0x0F, 0x00, 0x00, 0x88, 0x0F, 0x10, 0x00, 0x8A, 0x0F,
+    0x14, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x82, 0x00, 0x00, 0x0F,
+    0x48, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x10, 0x0F,
+    0x10, 0x00, 0x10, 0x0F, 0x02, 0x00, 0x90, 0x0F, 0x08, 0x00, 0x90, 0x0F,
+    0x00, 0x00, 0x90, 0x0F, 0x00, 0x10, 0x90, 0x8F, 0x00, 0x02, 0xB0, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0xE8, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x10, 0x0F,
+    0x20, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x90, 0x0F, 0x44, 0x00, 0x90, 0x0F,
+    0x48, 0x00, 0x90, 0x0F, 0x30, 0x10, 0x90, 0x8F, 0x00, 0x02, 0xB0, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0xE8, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x4F, 0x04, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x0F,
+    0x10, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x90, 0x0F, 0x00, 0x00, 0x90, 0x0F,
+    0x02, 0x00, 0x90, 0x0F, 0x00, 0x10, 0x90, 0x8F, 0x00, 0x02, 0xB0, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0xE8, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x90, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x80, 0x02, 0x40, 0x3F, 0x80, 0x02, 0x40, 0x3F,
+    0x80, 0x02, 0x40, 0x3F, 0x10, 0x42, 0x42, 0x3F, 0x60, 0x0A, 0xC0, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x03, 0xA0, 0x08, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x0F, 0x30, 0xA0, 0x00, 0x2F, 0x48, 0x00, 0x00, 0x4F,
+    0x44, 0x0F, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x4F,
+    0x00, 0x20, 0x00, 0x4F, 0x00, 0xE0, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x0C, 0x0F, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x40, 0x20, 0x00, 0x4F, 0x00, 0xE0, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x20, 0x0F, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x48, 0x00, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x4F,
+    0x12, 0x20, 0x00, 0x4F, 0x08, 0xE0, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x60, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x3F,
+    0x80, 0x3F, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x3F,
+    0x80, 0x80, 0x01, 0x3F, 0x83, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x60, 0x07, 0x20, 0x50, 0x27, 0x80, 0x50, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x50, 0x07, 0x80, 0x50, 0x47, 0x80, 0x50, 0x07, 0x80, 0x50, 0x07,
+    0x00, 0x00, 0x97, 0x88, 0x00, 0x87, 0x00, 0x01, 0x07, 0x40, 0x88, 0x27,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x47, 0x10, 0x00, 0x87, 0x08, 0x00, 0x07,
+    0x01, 0x08, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x8F,
+    0x00, 0x1F, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x38, 0x03, 0xFF, 0x0F, 0x01, 0x01, 0x00, 0x0F, 0x88, 0x40, 0x80, 0x8F,
+    0x80, 0x00, 0x20, 0x4F, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    0x20, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x81, 0x0F, 0x01, 0x40, 0x40, 0x0F,
+    0x50, 0x00, 0x10, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x01, 0xCE, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x17, 0x30, 0x02, 0x06, 0x07,
+    0x48, 0x80, 0x01, 0x07, 0x44, 0x10, 0x00, 0x8F, 0x00, 0x10, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x47, 0x10, 0x10, 0x00, 0x47, 0x02, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x01, 0x17, 0x00, 0x83, 0x86, 0x17,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x87,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x02, 0xE8, 0x07,
+    // 0xD3 'Ó'
+    0x00, 0x01, 0xCE, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x17, 0x00, 0x02, 0x06, 0x07,
+    0x00, 0x80, 0x01, 0x07, 0x08, 0x10, 0x00, 0x8F, 0x02, 0x10, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x47, 0x04, 0x10, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x87, 0x00, 0x00, 0x01, 0x17, 0x00, 0x83, 0x86, 0x17,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x87,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x02, 0xE8, 0x07,
+    // 0xD4 'Ô'
+    0x00, 0x01, 0xCE, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x17, 0x00, 0x02, 0x06, 0x07,
+    0x00, 0x80, 0x01, 0x07, 0x20, 0x10, 0x00, 0x8F, 0x44, 0x10, 0x00, 0x07,
+    0x08, 0x00, 0x00, 0x47, 0x00, 0x10, 0x00, 0x47, 0x48, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x87, 0x02, 0x00, 0x01, 0x17, 0x08, 0x83, 0x86, 0x17,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x87,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x02, 0xE8, 0x07,
+    // 0xD5 'Õ'
+    0x00, 0x03, 0x9C, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x2F, 0x38, 0x04, 0x0C, 0x0F,
+    0x01, 0x00, 0x02, 0x0F, 0x88, 0x20, 0x01, 0x1F, 0x80, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x40, 0x20, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x02, 0x2F, 0x51, 0x07, 0x0C, 0x2F,
+    0x00, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x01, 0x0F,
+    0x00, 0x00, 0x06, 0x0F, 0x00, 0x05, 0xD0, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x07, 0x38, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x61, 0x00, 0x00, 0x5F, 0x00, 0x08, 0x18, 0x1F,
+    0x82, 0x00, 0x04, 0x1F, 0x80, 0x40, 0x02, 0x3F, 0x80, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x40, 0x01, 0x1F, 0x90, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x02, 0x1F, 0x80, 0x00, 0x04, 0x5F, 0x92, 0x0E, 0x18, 0x5F,
+    0x01, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x02, 0x1F,
+    0x00, 0x00, 0x0C, 0x1F, 0x00, 0x0B, 0xA0, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x07, 0x30, 0x67, 0x48, 0x97, 0x05, 0x07, 0x02, 0x07, 0x10, 0x47,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x05, 0x07, 0x08, 0x87, 0x50, 0x57,
+    0x20, 0x27,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0B, 0x00, 0xE7, 0x17, 0x02, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x20, 0x00, 0x0B, 0x01, 0x00, 0x03, 0x40, 0x04, 0x03,
+    0x08, 0x09, 0x47, 0x08, 0x12, 0x03, 0x00, 0x24, 0x23, 0x08, 0x48, 0x23,
+    0x00, 0x90, 0x07, 0x01, 0x20, 0x43, 0x02, 0x40, 0x8B, 0x40, 0xC3, 0x0B,
+    0x20, 0x00, 0x13, 0x00, 0x00, 0x03, 0x20, 0x00, 0x43, 0x4C, 0x01, 0x83,
+    0x11, 0x74, 0x03, 0x00, 0x00, 0x03,
+    // 0xD9 'Ù'
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x48, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x8F,
+    0x40, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x12, 0x00, 0x00, 0x07, 0x0C, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x10, 0x06, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x02, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDA 'Ú'
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x02, 0x07, 0x04, 0x00, 0x00, 0x8F,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x04, 0xA0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x87,
+    0x20, 0x10, 0x06, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x02, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDB 'Û'
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x08, 0x00, 0x02, 0x07, 0x12, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x44, 0xA0, 0x00, 0x0F, 0x22, 0x00, 0x00, 0x87,
+    0x10, 0x10, 0x06, 0x17, 0x04, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x02, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDC 'Ü'
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x08, 0x1F, 0x80, 0x00, 0x02, 0x3F,
+    0x10, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x40, 0x00, 0x00, 0x1F, 0x82, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x1F,
+    0x00, 0x40, 0x18, 0x5F, 0x40, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x2A, 0x00, 0x0F, 0x2A, 0x00, 0x0F, 0x88, 0x00, 0x2F, 0x09, 0x00, 0x0F,
+    0x00, 0x61, 0x0F, 0x00, 0x01, 0x0F, 0x04, 0x02, 0x0F, 0x04, 0x00, 0x0F,
+    0x01, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x03, 0x00, 0x11, 0x08, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0xFF, 0xF9, 0x80, 0x00, 0x01,
+    0x90, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x23, 0x00, 0x01, 0x11,
+    0x88, 0x40, 0x03, 0x00, 0x10, 0x31, 0x01, 0x00, 0x01, 0x02, 0x04, 0x05,
+    0x08, 0x02, 0x01, 0x00, 0x01, 0xC1,
+    // 0xE0 'à'
+    0x00, 0x08, 0x34, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x22, 0x80, 0x7F,
+    0x08, 0x02, 0x80, 0xFF, 0x80, 0x0C, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF,
+    0x00, 0x11, 0x04, 0x7F, 0x0A, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x02, 0x7F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x08, 0x34, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x22, 0x80, 0x7F,
+    0x00, 0x02, 0x80, 0xFF, 0x00, 0x0C, 0x00, 0xFF, 0x02, 0x00, 0x00, 0xFF,
+    0x20, 0x11, 0x04, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x50, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    // 0xE2 'â'
+    0x00, 0x10, 0x68, 0x00, 0x00, 0x00, 0x04, 0x45, 0x00, 0x00, 0x05, 0x01,
+    0x20, 0x18, 0x01, 0x88, 0x00, 0x01, 0x00, 0x22, 0x08, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x20, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x1F, 0xF1, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C,
+    // 0xE3 'ã'
+    0x00, 0x10, 0x68, 0x00, 0x00, 0x00, 0x28, 0x45, 0x00, 0x44, 0x05, 0x01,
+    0x00, 0x18, 0x01, 0x10, 0x00, 0x01, 0x48, 0x22, 0x08, 0x04, 0x00, 0x00,
+    0x24, 0x00, 0x04, 0x44, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x1F, 0xF1, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C,
+    // 0xE4 'ä'
+    0x00, 0x20, 0xD1, 0x10, 0x00, 0x01, 0x08, 0x8A, 0x01, 0x80, 0x0A, 0x03,
+    0x88, 0x30, 0x03, 0x20, 0x00, 0x03, 0x00, 0x44, 0x11, 0x50, 0x00, 0x01,
+    0x08, 0x00, 0x09, 0x81, 0x00, 0x05, 0x89, 0x00, 0x03, 0x70, 0x00, 0x03,
+    0x00, 0x3F, 0xE3, 0x00, 0x00, 0x05, 0x00, 0x00, 0x19,
+    // 0xE5 'å'
+    0x00, 0x08, 0x34, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x22, 0x80, 0x7F,
+    0x02, 0x02, 0x80, 0xFF, 0x40, 0x0C, 0x00, 0xFF, 0x14, 0x00, 0x00, 0xFF,
+    0x81, 0x11, 0x04, 0x7F, 0xA4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x42, 0x40, 0x01, 0x7F, 0x18, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x06, 0x7F,
+    // 0xE6 'æ'
+    0x08, 0x36, 0x7F, 0x10, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x80, 0xFF,
+    0x0C, 0x00, 0x7F, 0x00, 0x24, 0xFF, 0x11, 0x00, 0xFF, 0x00, 0x04, 0x7F,
+    0x00, 0x21, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x04, 0x20, 0x7F, 0x40, 0x40, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x02, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x20, 0x80, 0x7F,
+    0x00, 0x8A, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xE7 'ç'
+    0x06, 0x10, 0x00, 0x08, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x40, 0x20, 0x02, 0x40, 0x10, 0xD1, 0x00, 0x08, 0xD9, 0x00, 0x00, 0x40,
+    0x0C, 0x00, 0xC0, 0x02, 0x00, 0x98, 0x02, 0x00, 0x00, 0x22, 0x08, 0x00,
+    0x10, 0x0A, 0x00,
+    // 0xE8 'è'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x20, 0x01, 0x7F,
+    0x50, 0x00, 0x01, 0x7F, 0x08, 0x02, 0x60, 0x7F, 0x40, 0x40, 0x00, 0xFF,
+    0x02, 0x10, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0x06, 0x00, 0x04, 0xFF,
+    0x00, 0x40, 0x04, 0xFF, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x20, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x02, 0x60, 0x7F, 0x00, 0x40, 0x00, 0xFF,
+    0x00, 0x10, 0x00, 0xFF, 0x42, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x04, 0xFF,
+    0x40, 0x40, 0x04, 0xFF, 0x20, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F,
+    0x00, 0x00, 0x0A, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    // 0xEA 'ê'
+    0x00, 0x0C, 0x20, 0x00, 0x00, 0x04, 0x04, 0x40, 0x02, 0x08, 0x00, 0x02,
+    0x20, 0x04, 0xC0, 0x44, 0x80, 0x01, 0x00, 0x20, 0x01, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x44, 0x80, 0x09, 0x20, 0x80, 0x00, 0x00, 0x40, 0x02,
+    0x00, 0x00, 0x14, 0x00, 0x04, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x18, 0x41, 0x00, 0x00, 0x09, 0x40, 0x80, 0x05, 0x88, 0x00, 0x05,
+    0x88, 0x09, 0x81, 0x01, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x13, 0x89, 0x00, 0x13, 0x89, 0x00, 0x01, 0x00, 0x80, 0x05,
+    0x00, 0x00, 0x29, 0x00, 0x08, 0x01,
+    // 0xEC 'ì'
+    0x00, 0x30, 0x00, 0x30, 0x40, 0x02, 0x08, 0x00, 0x04, 0x40, 0x00, 0x00,
+    0x02, 0x40, 0x00, 0x10, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    // 0xED 'í'
+    0x00, 0x30, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x40, 0x00, 0x80, 0x00, 0x00, 0x40, 0x7F, 0xF8,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x03,
+    // 0xEE 'î'
+    0x00, 0x60, 0x01, 0x08, 0x80, 0x05, 0x20, 0x00, 0x09, 0x44, 0x00, 0x01,
+    0x08, 0x80, 0x01, 0x90, 0x80, 0x01, 0x08, 0x00, 0x01, 0x04, 0xFF, 0xF1,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x07,
+    // 0xEF 'ï'
+    0x50, 0xC0, 0x03, 0x89, 0x00, 0x0B, 0x88, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x21, 0x00, 0x03, 0x01, 0x00, 0x03, 0x40, 0x00, 0x03, 0x89, 0xFF, 0xE3,
+    0x88, 0x00, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
+    // 0xF0 'ð'
+    0x00, 0x0C, 0x20, 0x00, 0x20, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02,
+    0x4A, 0x04, 0xC0, 0x00, 0x90, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x01, 0x10, 0x09, 0x50, 0x88, 0x00, 0x80, 0x03, 0xC2, 0x44, 0x00, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xC0, 0x08, 0x00, 0x17, 0xA0,
+    // 0xF1 'ñ'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x28, 0x00, 0x01, 0x44, 0xC0, 0x01, 0x08, 0x07, 0xF1,
+    0x10, 0x10, 0x07, 0x00, 0x10, 0x01, 0x04, 0x10, 0x03, 0x24, 0x00, 0x01,
+    0x44, 0x00, 0x01, 0x08, 0x80, 0x01, 0x30, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    // 0xF2 'ò'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x10, 0x00, 0x01, 0x7F, 0x40, 0x42, 0x20, 0x7F, 0x84, 0x48, 0x00, 0xFF,
+    0x00, 0x00, 0x04, 0xFF, 0x12, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x04, 0xFF,
+    0x00, 0x04, 0x08, 0x7F, 0x00, 0x41, 0xE1, 0x7F, 0x00, 0x40, 0x01, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x0A, 0x30, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x42, 0x20, 0x7F, 0x00, 0x48, 0x00, 0xFF,
+    0x08, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x04, 0xFF,
+    0x08, 0x04, 0x08, 0x7F, 0x60, 0x41, 0xE1, 0x7F, 0x00, 0x40, 0x01, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x0A, 0x30, 0x7F,
+    // 0xF4 'ô'
+    0x00, 0x0C, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x02,
+    0x10, 0x84, 0x40, 0x44, 0x90, 0x01, 0x80, 0x00, 0x09, 0x10, 0x00, 0x01,
+    0x80, 0x00, 0x09, 0x44, 0x08, 0x10, 0x00, 0x83, 0xC2, 0x10, 0x80, 0x02,
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x08, 0x00, 0x14, 0x60,
+    // 0xF5 'õ'
+    0x00, 0x0C, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+    0x44, 0x84, 0x40, 0x10, 0x90, 0x01, 0x00, 0x00, 0x09, 0x48, 0x00, 0x01,
+    0x24, 0x00, 0x09, 0x04, 0x08, 0x10, 0x00, 0x83, 0xC2, 0x00, 0x80, 0x02,
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x08, 0x00, 0x14, 0x60,
+    // 0xF6 'ö'
+    0x00, 0x18, 0x41, 0x00, 0x00, 0x09, 0x50, 0x00, 0x05, 0x08, 0x00, 0x05,
+    0x81, 0x08, 0x81, 0x09, 0x20, 0x03, 0x70, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x60, 0x00, 0x13, 0x08, 0x10, 0x21, 0x81, 0x07, 0x85, 0x01, 0x00, 0x05,
+    0x50, 0x80, 0x01, 0x00, 0x40, 0x11, 0x00, 0x28, 0xC1,
+    // 0xF7 '÷'
+    0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x25, 0x13, 0x95, 0x4B,
+    0x85, 0x43, 0x85, 0x43, 0x65, 0x33, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x06, 0x12, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F,
+    0x00, 0x01, 0x7F, 0x40, 0x00, 0x7F, 0x48, 0x00, 0xFF, 0x10, 0x00, 0xFF,
+    0x10, 0x04, 0xFF, 0x00, 0x04, 0xFF, 0x08, 0x88, 0x7F, 0x41, 0x11, 0x7F,
+    0x40, 0x01, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x7F, 0x5A, 0x30, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x48, 0x04, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x10, 0x40, 0x00, 0x7F,
+    0x08, 0x4F, 0xE0, 0xFF, 0x40, 0x00, 0x08, 0x7F, 0x02, 0x00, 0x00, 0xFF,
+    0x10, 0x00, 0x00, 0x7F, 0x06, 0x00, 0x01, 0x7F, 0x00, 0x4F, 0xF8, 0x7F,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x00, 0xFF,
+    0x00, 0x1F, 0xF8, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x48, 0x04, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x4F, 0xE0, 0xFF, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x7F, 0x40, 0x4F, 0xF8, 0x7F,
+    0x20, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x00, 0xFF,
+    0x00, 0x1F, 0xF8, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0xFB 'û'
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x08, 0x00, 0x00, 0x04,
+    0x04, 0x00, 0x02, 0x08, 0x80, 0x00, 0x20, 0x9F, 0xC1, 0x44, 0x00, 0x10,
+    0x08, 0x00, 0x01, 0x90, 0x00, 0x00, 0x08, 0x00, 0x02, 0x04, 0x9F, 0xF0,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    // 0xFC 'ü'
+    0x00, 0x40, 0x01, 0x00, 0x00, 0x01, 0x01, 0x20, 0x11, 0x00, 0x00, 0x09,
+    0x50, 0x00, 0x05, 0x89, 0x00, 0x01, 0x89, 0x3F, 0x83, 0x00, 0x00, 0x21,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x89, 0x3F, 0xE1,
+    0x88, 0x00, 0x07, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x7F, 0xE1,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xFF, 0xCF,
+    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x12, 0x0F, 0x00, 0x20, 0x00, 0x2F,
+    0x01, 0x20, 0x02, 0x17, 0x00, 0x00, 0x02, 0x07, 0x00, 0x08, 0x40, 0x07,
+    0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x11, 0x80, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x40, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x47,
+    0x20, 0x08, 0x00, 0x07, 0x08, 0x03, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x88, 0x00, 0x01, 0x17, 0x00, 0x60, 0x04, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x87, 0x08, 0x01, 0x81, 0x07, 0x81, 0x80, 0x0C, 0x07,
+    0x88, 0x50, 0x30, 0x07, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x80, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x00, 0x01, 0xC0, 0x1F, 0x0C, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x20, 0x1F, 0x00, 0x02, 0x01, 0x1F, 0x00, 0x00, 0xC0, 0x1F,
+    0x03, 0x00, 0x08, 0x1F, 0x00, 0x20, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x03, 0x09, 0x1F, 0x00, 0x00, 0x41, 0xDF, 0x00, 0x00, 0x40, 0x1F,
+    0x00, 0x00, 0x30, 0x1F,
+    // 0x105 'ą'
+    0x08, 0x34, 0x03, 0x00, 0x00, 0x03, 0x22, 0x80, 0x03, 0x02, 0x80, 0x83,
+    0x0C, 0x00, 0x83, 0x00, 0x00, 0x83, 0x11, 0x04, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x02, 0x33, 0x40, 0x01, 0x87, 0x40, 0x00, 0x07, 0x00, 0x00, 0x23,
+    0x0F, 0xF8, 0x13, 0x00, 0x01, 0x03, 0x00, 0x06, 0x0F,
+    // 0x106 'Ć'
+    0x00, 0x01, 0xCC, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x17, 0x00, 0x06, 0x00, 0x17,
+    0x00, 0x80, 0x01, 0x07, 0x02, 0x10, 0x00, 0x0F, 0x12, 0x10, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x87, 0x24, 0x00, 0x00, 0x8F, 0x40, 0x10, 0x00, 0x8F,
+    0x00, 0x14, 0x00, 0x87, 0x28, 0x80, 0x00, 0x07, 0x00, 0x82, 0x00, 0x07,
+    0x00, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    // 0x107 'ć'
+    0x00, 0x06, 0x10, 0x7F, 0x00, 0x08, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x40, 0x20, 0x7F, 0x00, 0x40, 0x10, 0xFF,
+    0x00, 0x00, 0x08, 0xFF, 0x02, 0x00, 0x00, 0x7F, 0x84, 0x0C, 0x00, 0xFF,
+    0x48, 0x02, 0x00, 0xFF, 0x20, 0x02, 0x00, 0x7F, 0x00, 0x22, 0x08, 0x7F,
+    0x00, 0x10, 0x0A, 0x7F,
+    // 0x10C 'Č'
+    0x00, 0x01, 0xCC, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x40, 0x00, 0x17, 0x40, 0x06, 0x00, 0x17,
+    0x40, 0x80, 0x01, 0x07, 0x00, 0x10, 0x00, 0x0F, 0x10, 0x10, 0x00, 0x8F,
+    0x02, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x10, 0x00, 0x8F,
+    0x48, 0x14, 0x00, 0x87, 0x10, 0x80, 0x00, 0x07, 0x60, 0x82, 0x00, 0x07,
+    0x00, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    // 0x10D 'č'
+    0x00, 0x0C, 0x20, 0x00, 0x10, 0x04, 0xE0, 0x00, 0x02, 0x80, 0x00, 0x02,
+    0x00, 0x80, 0x40, 0x40, 0x80, 0x21, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x04, 0x18, 0x01, 0x00, 0x04, 0x01, 0x20, 0x04, 0x00, 0x80, 0x44, 0x10,
+    0x00, 0x20, 0x14,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x27, 0x00, 0x80, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x07, 0x50, 0x80, 0x00, 0x07,
+    0x40, 0x80, 0x00, 0x07, 0x24, 0x80, 0x00, 0x07, 0x10, 0x80, 0x00, 0x07,
+    0x02, 0x80, 0x00, 0x47, 0x12, 0x80, 0x00, 0x07, 0x24, 0x80, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x97, 0x00, 0x88, 0x00, 0x87, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x40, 0x88, 0x27, 0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x10, 0x00, 0x87, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x08, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x18, 0x31, 0x00, 0x40, 0x09, 0x00, 0x80, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x83, 0x01, 0x20, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x05, 0x10, 0x00, 0x01, 0x80, 0x00, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x05, 0x02, 0x00, 0x01, 0x98, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x40, 0x1F,
+    0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F,
+    0x00, 0x10, 0x02, 0x9F, 0x00, 0x90, 0x00, 0x5F, 0x00, 0x90, 0x08, 0x1F,
+    0x00, 0x90, 0x00, 0x1F, 0x10, 0x90, 0x81, 0x1F, 0x02, 0xB0, 0x09, 0x1F,
+    0x02, 0x00, 0x01, 0x5F, 0xE8, 0x02, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x119 'ę'
+    0x06, 0x10, 0x03, 0x00, 0x02, 0x03, 0x20, 0x01, 0x03, 0x00, 0x01, 0x03,
+    0x02, 0x60, 0x03, 0x40, 0x00, 0x83, 0x10, 0x00, 0x93, 0x00, 0x00, 0x43,
+    0x00, 0x04, 0x07, 0x40, 0x04, 0x23, 0x40, 0x00, 0x03, 0x20, 0x01, 0x03,
+    0x00, 0x0A, 0x07, 0x02, 0x00, 0x03,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x12, 0x00, 0x10, 0x0F,
+    0x02, 0x00, 0x10, 0x0F, 0x02, 0x00, 0x90, 0x0F, 0x00, 0x00, 0x90, 0x0F,
+    0x10, 0x00, 0x90, 0x0F, 0x60, 0x10, 0x90, 0x8F, 0x00, 0x02, 0xB0, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0xE8, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x0C, 0x20, 0x00, 0x00, 0x04, 0xC0, 0x40, 0x02, 0x80, 0x00, 0x02,
+    0x00, 0x04, 0xC0, 0x40, 0x80, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x09, 0x90, 0x80, 0x09, 0x00, 0x80, 0x00, 0x80, 0x40, 0x02,
+    0x00, 0x00, 0x14, 0x00, 0x04, 0x00,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x0C, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x20, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x06, 0x0F,
+    0x00, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x13A 'ĺ'
+    0x00, 0xC0, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07, 0x14, 0x1F, 0xFF, 0xC7,
+    0x21, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x30, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x03, 0x28, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x08, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x44, 0x00, 0x03, 0x80, 0x00, 0x23, 0x0C, 0x01, 0x83, 0x00, 0x01, 0x03,
+    0x00, 0x01, 0x0B, 0x00, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x60, 0x00, 0x0B, 0x10, 0x00, 0x03, 0x0F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0xE2, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0xA0, 0x04, 0x2F, 0x00, 0x08, 0x4F,
+    0x00, 0x08, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x40, 0x0F, 0x80, 0x40, 0x0F,
+    0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x06, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x0F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x60, 0x06, 0x0B, 0x10, 0x0A, 0x03, 0x0F, 0xE1, 0xE3,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0xA0, 0x13, 0x01, 0x00, 0x03, 0x00, 0x40, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07, 0x00, 0x10, 0x00, 0x47,
+    0x00, 0x0F, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0xFF, 0x87, 0x00, 0x80, 0x80, 0x07, 0x08, 0x20, 0x40, 0x47,
+    0x02, 0x00, 0x10, 0x27, 0x10, 0x08, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x40, 0x00, 0x40, 0x87, 0x00, 0xA0, 0x20, 0x07,
+    0x00, 0x00, 0x08, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x144 'ń'
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0xF8,
+    0x06, 0x08, 0x03, 0x20, 0x08, 0x00, 0x40, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07, 0x00, 0x10, 0x00, 0x47,
+    0x00, 0x0F, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x40, 0x01, 0xFF, 0x87, 0x08, 0x80, 0x80, 0x07, 0x04, 0x20, 0x40, 0x47,
+    0x00, 0x00, 0x10, 0x27, 0x02, 0x08, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07,
+    0x20, 0x01, 0x00, 0x07, 0x08, 0x00, 0x40, 0x87, 0x10, 0xA0, 0x20, 0x07,
+    0x60, 0x00, 0x08, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x60, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0xC0, 0x01, 0x88, 0x07, 0xF1,
+    0x24, 0x10, 0x07, 0x00, 0x10, 0x01, 0x20, 0x10, 0x03, 0x88, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    // 0x152 'Œ'
+    0x01, 0xCA, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x00, 0x70, 0x07, 0x40, 0x00, 0x17, 0x40, 0x01, 0x17, 0x00, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0x90, 0x00, 0x4F, 0x10, 0x00, 0x4F, 0x10, 0x00, 0x0F,
+    0x0F, 0xFF, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x0F, 0x9F, 0x87, 0x00, 0x10, 0x07, 0x00, 0x90, 0x07,
+    0x00, 0x90, 0x07, 0x00, 0x90, 0x07, 0x00, 0x90, 0x87, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x07, 0x48, 0x02, 0x27, 0x00, 0x00, 0x07,
+    // 0x153 'œ'
+    0x06, 0x10, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x7F,
+    0x42, 0x20, 0x7F, 0x48, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x04, 0xFF, 0x04, 0x08, 0x7F, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x20, 0x01, 0x7F, 0x44, 0x40, 0x7F, 0x48, 0x08, 0x7F,
+    0x00, 0x00, 0xFF, 0x10, 0x00, 0x7F, 0x00, 0x04, 0xFF, 0x04, 0x04, 0xFF,
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x10, 0x08, 0x7F, 0x04, 0x80, 0x7F,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x27, 0x00, 0x80, 0x00, 0x47,
+    0x20, 0x00, 0x00, 0x47, 0x50, 0x00, 0x00, 0x07, 0x40, 0x80, 0x00, 0x07,
+    0x24, 0x80, 0x00, 0x07, 0x10, 0x80, 0x00, 0x07, 0x02, 0x80, 0x40, 0x07,
+    0x12, 0x80, 0x00, 0x47, 0x24, 0x90, 0x42, 0x37, 0x40, 0x80, 0x00, 0x87,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x24, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x20, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x07, 0xF9,
+    0x44, 0x08, 0x09, 0x80, 0x80, 0x01, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x01,
+    0x00, 0x70, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x10, 0x84, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x23, 0x07, 0x00, 0x80, 0x10, 0x8F, 0x0A, 0x88, 0x00, 0x47,
+    0x00, 0x11, 0x08, 0x07, 0x00, 0x00, 0x08, 0x07, 0x24, 0x00, 0x84, 0x4F,
+    0x04, 0x00, 0x83, 0x87, 0x00, 0x88, 0x40, 0x17, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x82, 0x20, 0x27, 0x00, 0x08, 0x18, 0x87, 0x00, 0x00, 0x00, 0x07,
+    // 0x15B 'ś'
+    0x00, 0x04, 0x1D, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x40, 0x08, 0xFF, 0x04, 0x48, 0x04, 0xFF, 0x12, 0x00, 0x00, 0xFF,
+    0x20, 0x10, 0x00, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x00, 0x7F,
+    0x10, 0x41, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x14, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x10, 0x84, 0x17, 0x60, 0x00, 0x00, 0x07,
+    0x08, 0x40, 0x23, 0x07, 0x04, 0x80, 0x10, 0x8F, 0x20, 0x88, 0x00, 0x47,
+    0x02, 0x11, 0x08, 0x07, 0x02, 0x00, 0x08, 0x07, 0x20, 0x00, 0x84, 0x4F,
+    0x44, 0x00, 0x83, 0x87, 0x08, 0x88, 0x40, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x40, 0x82, 0x20, 0x27, 0x00, 0x08, 0x18, 0x87, 0x00, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x08, 0x3A, 0x00, 0x20, 0x02, 0x90, 0x40, 0x00, 0x88, 0x80, 0x11,
+    0x04, 0x90, 0x09, 0x20, 0x00, 0x01, 0x20, 0x20, 0x01, 0x00, 0x00, 0x09,
+    0x80, 0x02, 0x00, 0x00, 0x82, 0x00, 0x40, 0x80, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x4F, 0x04, 0x1F, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x9F, 0xF4,
+    0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x01, 0x0F, 0x1F, 0xE0,
+    0x00, 0x00, 0x01, 0x1C, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0C, 0x20, 0x00,
+    0x20, 0x00, 0x04,
+    // 0x16E 'Ů'
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x18, 0x00, 0x02, 0x07, 0x42, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x47,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x87,
+    0x00, 0x10, 0x06, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x02, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x48, 0x04, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x40, 0x4F, 0xE0, 0xFF, 0x18, 0x00, 0x08, 0x7F, 0x85, 0x00, 0x00, 0xFF,
+    0x81, 0x00, 0x00, 0x7F, 0x11, 0x00, 0x01, 0x7F, 0x42, 0x4F, 0xF8, 0x7F,
+    0x18, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x00, 0xFF,
+    0x00, 0x1F, 0xF8, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x02, 0x07, 0x12, 0x00, 0x00, 0x8F,
+    0x24, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x47,
+    0x40, 0x00, 0x00, 0x07, 0x0E, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x87,
+    0x04, 0x10, 0x06, 0x17, 0x40, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x10, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x02, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x48, 0x04, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x04, 0x40, 0x00, 0x7F,
+    0x00, 0x4F, 0xE0, 0xFF, 0x42, 0x00, 0x08, 0x7F, 0x04, 0x00, 0x00, 0xFF,
+    0x50, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x01, 0x7F, 0x30, 0x4F, 0xF8, 0x7F,
+    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x00, 0xFF,
+    0x00, 0x1F, 0xF8, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0x178 'Ÿ'
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x60, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x81, 0x3F, 0x80, 0x00, 0x40, 0x3F, 0x80, 0x80, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x90, 0x02, 0x00, 0x3F,
+    0x82, 0x88, 0x40, 0x3F, 0x80, 0x60, 0x80, 0x3F, 0x90, 0x00, 0x01, 0x3F,
+    0x00, 0x08, 0x00, 0xBF, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x03, 0x80, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x87, 0x00, 0x00, 0x02, 0x07,
+    0x00, 0x02, 0x04, 0x07, 0x00, 0x08, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x0A, 0x00, 0x40, 0x07, 0x00, 0x01, 0x02, 0x07, 0x00, 0x12, 0x00, 0x07,
+    0x24, 0x18, 0x08, 0x07, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07,
+    0x10, 0x01, 0x00, 0x07, 0x00, 0x02, 0x03, 0x07, 0x00, 0x88, 0x00, 0x07,
+    0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x03, 0x87,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x0E, 0x09, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0x04, 0x20, 0x7F, 0x00, 0x08, 0x80, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x02, 0x02, 0x04, 0x7F, 0x40, 0x04, 0x14, 0x7F, 0x80, 0x00, 0x44, 0x7F,
+    0x40, 0x00, 0x04, 0x7F, 0x20, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x00, 0x20, 0x3A, 0x7F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x30, 0x01, 0x0F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x04, 0x08, 0x0F, 0x00, 0x10, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x80, 0x0F, 0x00, 0x02, 0x04, 0x0F, 0x80, 0x24, 0x00, 0x0F,
+    0x80, 0x30, 0x10, 0x0F, 0x30, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x00, 0x04, 0x06, 0x0F, 0x01, 0x10, 0x00, 0x0F,
+    0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x07, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x01, 0x00, 0x38, 0x25, 0x00, 0x08, 0x01, 0x00, 0x10, 0x81,
+    0x00, 0x22, 0x01, 0x80, 0x00, 0x01, 0x88, 0x08, 0x11, 0x08, 0x10, 0x51,
+    0x00, 0x01, 0x11, 0x60, 0x00, 0x11, 0x00, 0x04, 0x01, 0x00, 0x00, 0x41,
+    0x00, 0x20, 0x01, 0x00, 0x80, 0xE9,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x87, 0x00, 0x00, 0x02, 0x07,
+    0x40, 0x02, 0x04, 0x07, 0x08, 0x08, 0x10, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x40, 0x07, 0x02, 0x01, 0x02, 0x07, 0x02, 0x12, 0x00, 0x07,
+    0x00, 0x18, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x40, 0x07,
+    0x10, 0x01, 0x00, 0x07, 0x60, 0x02, 0x03, 0x07, 0x00, 0x88, 0x00, 0x07,
+    0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x03, 0x87,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x12, 0x00, 0x04, 0x00, 0x90, 0x08, 0x40,
+    0x80, 0x11, 0x00, 0x40, 0x00, 0x00, 0x20, 0x04, 0x08, 0x00, 0x08, 0x28,
+    0x44, 0x00, 0x88, 0x90, 0x00, 0x08, 0x00, 0x02, 0x00, 0x40, 0x00, 0x20,
+    0x00, 0x10, 0x00, 0x00, 0x40, 0x74,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x00, 0x04, 0x7F,
+    0x08, 0x50, 0x7F, 0x06, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x60, 0x7F, 0x08, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x0D, 0x84, 0x7F,
+    0x00, 0x01, 0x7F, 0x00, 0x00, 0x7F, 0x43, 0xE0, 0xFF, 0x48, 0x00, 0x7F,
+    0x40, 0x04, 0x7F, 0x00, 0x05, 0x7F, 0x50, 0x06, 0x7F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x0A, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x85, 0xFF, 0xF7,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x17, 0x00, 0x20, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x4F, 0x90, 0x10, 0x47, 0x00, 0x00, 0x47, 0x83, 0x00, 0x0F,
+    0x04, 0x03, 0x07, 0x60, 0x00, 0x17, 0x00, 0x20, 0x07, 0x00, 0x10, 0x47,
+    0x00, 0x04, 0x87,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F,
+    // 0x2014 '—'
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2018 '‘'
+    0x19, 0x7F, 0x20, 0xFF, 0x80, 0x7F, 0x94, 0x7F, 0xC0, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x21, 0xFF, 0x88, 0x7F, 0x80, 0xFF, 0x01, 0x7F, 0x2C, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x21, 0xBF, 0x88, 0x3F, 0x80, 0xBF, 0x01, 0x3F, 0x2C, 0x3F,
+    // 0x201B '‛'
+    0x4C, 0x7F, 0x01, 0x7F, 0x80, 0x7F, 0x94, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    // 0x201C '“'
+    0x19, 0x7F, 0x20, 0xFF, 0x80, 0x7F, 0x94, 0x7F, 0xC0, 0x7F, 0x06, 0x7F,
+    0x30, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0xB4, 0xFF, 0x40, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x21, 0xFF, 0x88, 0x7F, 0x80, 0xFF, 0x01, 0x7F, 0x2C, 0x7F,
+    0x00, 0xFF, 0x34, 0x7F, 0x00, 0xFF, 0x81, 0x7F, 0x82, 0x7F, 0x28, 0x7F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x21, 0xBF, 0x88, 0x3F, 0x80, 0xBF, 0x01, 0x3F, 0x2C, 0x3F,
+    0x00, 0xBF, 0x34, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x28, 0x3F,
+    // 0x201F '‟'
+    0x4C, 0x7F, 0x01, 0x7F, 0x80, 0x7F, 0x94, 0x7F, 0x00, 0x7F, 0x30, 0x7F,
+    0x86, 0x7F, 0x81, 0x7F, 0x00, 0xFF, 0x36, 0x7F, 0x00, 0xFF,
+    // 0x2020 '†'
+    0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x14, 0x87, 0x5F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x35, 0xF1, 0xDF, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x03, 0x08, 0x04, 0x03, 0x00, 0x84, 0x83, 0x00, 0x04, 0x03,
+    0x04, 0x00, 0x83, 0x35, 0xB4, 0x27, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x21, 0xB4, 0xB7, 0x04, 0x00, 0x83, 0x00, 0x04, 0x03, 0x00, 0x84, 0x83,
+    0x00, 0x04, 0x83, 0x00, 0x00, 0x03,
+    // 0x2022 '•'
+    0x2D, 0x03, 0x81, 0x81, 0x03, 0x05, 0x11,
+    // 0x2026 '…'
+    0x47, 0x8F, 0x07, 0x0F, 0x17, 0x07, 0x07, 0x07, 0x07, 0x57, 0x07, 0x07,
+    0x0F, 0x87, 0x47, 0x07, 0x07, 0x07, 0x07, 0x87, 0x0F, 0x07, 0x8F, 0x67,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x09, 0x0F, 0x00, 0x8F, 0x20, 0x0F, 0x00, 0x0F, 0x0A, 0x2F,
+    0x80, 0x0F, 0x20, 0x6F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x40, 0x4F, 0x90, 0x0F, 0x09, 0x2F, 0x04, 0x0F, 0x20, 0x4F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F,
+    // 0x2070 '⁰'
+    0x03, 0xC3, 0x10, 0x13, 0x00, 0x03, 0x40, 0x03, 0x4C, 0x43, 0x10, 0x13,
+    0x00, 0x03, 0x00, 0x27, 0x44, 0xC3, 0x40, 0x03, 0x00, 0x13, 0x04, 0x63,
+    // 0x2074 '⁴'
+    0x00, 0x43, 0x00, 0x83, 0x00, 0x13, 0x04, 0x13, 0x09, 0x13, 0x00, 0x13,
+    0x44, 0x13, 0x40, 0x03, 0x00, 0x03, 0x7F, 0x9F, 0x00, 0x13, 0x00, 0x43,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x04, 0x2F, 0x00, 0x07, 0x82, 0x07, 0x90, 0x27, 0x80, 0x0F,
+    0x88, 0x07, 0x80, 0x07, 0x84, 0x17, 0xA2, 0x87,
+    // 0x2076 '⁶'
+    0x02, 0x23, 0x08, 0x0B, 0x00, 0x07, 0x20, 0xC7, 0x00, 0x13, 0x08, 0x03,
+    0x00, 0x13, 0x04, 0x07, 0x00, 0x03, 0x00, 0x0B, 0x00, 0xE3,
+    // 0x2077 '⁷'
+    0x10, 0x07, 0x88, 0x07, 0x88, 0x37, 0x90, 0x0F, 0x80, 0x07, 0x80, 0x17,
+    0x80, 0xC7, 0x80, 0x07, 0x88, 0x07, 0x80, 0x07, 0x40, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x23, 0x20, 0x83, 0x00, 0x03, 0x40, 0x73, 0x00, 0x83, 0x00, 0x83,
+    0x14, 0x43, 0x40, 0x03, 0x40, 0x03, 0x30, 0x0B, 0x00, 0x03,
+    // 0x2079 '⁹'
+    0x10, 0x0B, 0x20, 0x87, 0x00, 0x13, 0x0C, 0x53, 0x00, 0x47, 0x11, 0x03,
+    0x09, 0x03, 0x00, 0x0B, 0x00, 0x13, 0x10, 0x03, 0x02, 0x03,
+    // 0x2080 '₀'
+    0x07, 0x83, 0x30, 0x23, 0x00, 0x03, 0x00, 0x03, 0x98, 0x03, 0x20, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x88, 0x83, 0x80, 0x03, 0x00, 0x23, 0x08, 0xC3,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x28, 0x0B, 0x00, 0x17, 0x08, 0x17, 0x40, 0x07, 0x40, 0x07,
+    0x40, 0x07, 0x1F, 0xF7, 0x00, 0x07, 0x00, 0x07,
+    // 0x2082 '₂'
+    0x20, 0x07, 0x08, 0x47, 0x80, 0x8F, 0x90, 0x0F, 0x20, 0x0F, 0x00, 0x4F,
+    0x08, 0x0F, 0x01, 0x0F, 0x02, 0x0F, 0x6C, 0x07, 0x00, 0x17,
+    // 0x2083 '₃'
+    0x20, 0x13, 0x40, 0x23, 0x92, 0x23, 0xA0, 0x03, 0x21, 0x23, 0x28, 0x03,
+    0x10, 0x03, 0x00, 0x03, 0x02, 0x13, 0x01, 0x63,
+    // 0x2084 '₄'
+    0x00, 0x83, 0x01, 0x03, 0x00, 0x23, 0x08, 0x23, 0x02, 0x23, 0x20, 0x23,
+    0x80, 0x23, 0x00, 0x03, 0x80, 0x03, 0xFF, 0x1B, 0x00, 0x23, 0x00, 0xA3,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x04, 0x2B, 0x02, 0x23, 0x82, 0x23, 0x90, 0x03, 0x81, 0x03,
+    0x88, 0x03, 0x80, 0x03, 0x84, 0x13, 0xA0, 0x83,
+    // 0x2086 '₆'
+    0x04, 0x03, 0x18, 0x03, 0x20, 0x0B, 0x41, 0x8B, 0x02, 0x23, 0x1A, 0x23,
+    0x89, 0x03, 0x00, 0x0B, 0x24, 0x0B, 0x80, 0x13, 0x01, 0xC3,
+    // 0x2087 '₇'
+    0x10, 0x03, 0x88, 0x03, 0x80, 0x33, 0x90, 0x03, 0x80, 0x03, 0x84, 0x13,
+    0x80, 0xC3, 0x82, 0x03, 0x88, 0x03, 0x00, 0x03, 0x60, 0x03,
+    // 0x2088 '₈'
+    0x00, 0x43, 0x45, 0x03, 0x00, 0x0B, 0x00, 0xE3, 0x21, 0x03, 0x01, 0x03,
+    0x20, 0x23, 0x80, 0x0B, 0x02, 0x03, 0x60, 0x13, 0x00, 0x03,
+    // 0x2089 '₉'
+    0x20, 0x13, 0x01, 0x0B, 0x80, 0x23, 0x98, 0x83, 0x00, 0x03, 0x00, 0x43,
+    0x92, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x03, 0x04, 0x03,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0x00, 0x1C, 0x07, 0x00, 0x00, 0x07, 0x00, 0x30, 0x07, 0x01, 0x01, 0x87,
+    0x08, 0x00, 0x47, 0x00, 0x00, 0x27, 0x20, 0x20, 0x17, 0x01, 0x02, 0x17,
+    0x04, 0x10, 0x07, 0x08, 0x10, 0x8F, 0x90, 0x10, 0x0F, 0x81, 0x00, 0x47,
+    0x90, 0x40, 0x4F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x80, 0x3F, 0x10, 0x3F, 0x20, 0xBF, 0x1F, 0x3F, 0x00, 0x3F,
+    0x1F, 0x3F, 0x20, 0xBF, 0x30, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x3F,
+    0x06, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x3F, 0x18, 0x3F, 0x01, 0x3F,
+    0x60, 0x7F, 0x01, 0xBF, 0x00, 0x3F, 0x0C, 0x3F, 0x00, 0xBF, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x01, 0x10, 0x0C, 0x01, 0x00, 0x0A, 0x01, 0x24, 0x02, 0x01,
+    0x20, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x3F, 0xF2, 0x0D,
+    0x00, 0x02, 0x33, 0x00, 0x08, 0x43, 0x00, 0x00, 0x05, 0x00, 0x04, 0x11,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01,
+    0x00, 0x60, 0x01, 0x00, 0x80, 0x01, 0x80, 0x30, 0x19, 0x08, 0x40, 0x05,
+    0x30, 0x01, 0x05, 0x00, 0x04, 0x05, 0x00, 0x25, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x80, 0x09, 0x00, 0x02, 0x09, 0x00, 0x00, 0x11, 0x00, 0x00, 0x41,
+    // 0x2154 '⅔'
+    0x04, 0x04, 0x01, 0x02, 0x10, 0x01, 0x20, 0x22, 0x01, 0x02, 0x02, 0x01,
+    0x48, 0x82, 0x01, 0x40, 0x02, 0x01, 0x4A, 0x02, 0x01, 0x00, 0x42, 0x05,
+    0x00, 0x80, 0x01, 0x02, 0x00, 0x43, 0x00, 0x04, 0x85, 0x00, 0x00, 0x11,
+    0x00, 0x08, 0x61, 0x00, 0x30, 0x81, 0x00, 0xC2, 0x01, 0x01, 0x00, 0x01,
+    0x04, 0x00, 0x01, 0x10, 0x80, 0x01, 0x01, 0x30, 0x19, 0x80, 0x40, 0x05,
+    0x40, 0x01, 0x05, 0x00, 0x04, 0x05, 0x00, 0x25, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x80, 0x09, 0x00, 0x02, 0x09, 0x00, 0x00, 0x11, 0x00, 0x00, 0x41,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x01, 0x10, 0x0C, 0x01, 0x00, 0x0A, 0x01, 0x24, 0x02, 0x01,
+    0x20, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x3F, 0xF2, 0x01,
+    0x00, 0x02, 0x03, 0x00, 0x08, 0x43, 0x00, 0x01, 0x81, 0x00, 0x02, 0x11,
+    0x00, 0x00, 0x41, 0x00, 0x21, 0x81, 0x00, 0x82, 0x01, 0x03, 0x08, 0x01,
+    0x0C, 0x00, 0x01, 0x10, 0x80, 0x01, 0x43, 0x00, 0x91, 0x84, 0x41, 0x09,
+    0x40, 0x00, 0x01, 0x00, 0x88, 0x05, 0x00, 0x00, 0x11, 0x00, 0x24, 0x95,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x28, 0x61,
+    // 0x215C '⅜'
+    0x08, 0x0C, 0x01, 0x20, 0x0A, 0x01, 0x05, 0x88, 0x01, 0x08, 0x02, 0x01,
+    0x42, 0x00, 0x01, 0x42, 0x02, 0x01, 0x40, 0x40, 0x01, 0x00, 0x04, 0x09,
+    0x02, 0x00, 0x01, 0x14, 0xC0, 0x81, 0x00, 0x01, 0x01, 0x00, 0x00, 0x21,
+    0x00, 0x10, 0xC1, 0x00, 0x43, 0x01, 0x01, 0x84, 0x01, 0x06, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x21, 0x00, 0x01, 0x82, 0x00, 0x91, 0x00, 0x41, 0x09,
+    0x40, 0x00, 0x01, 0x00, 0x88, 0x05, 0x00, 0x00, 0x11, 0x00, 0x24, 0x95,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x28, 0x61,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x01, 0x0A, 0x01, 0x20, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0x04, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x60, 0x01, 0x02, 0x00, 0x11,
+    0x01, 0x08, 0x23, 0x00, 0x70, 0x03, 0x00, 0x02, 0x09, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x30, 0x01,
+    0x10, 0x40, 0x01, 0x40, 0x00, 0x01, 0x84, 0x00, 0x91, 0x18, 0x41, 0x09,
+    0x60, 0x00, 0x01, 0x00, 0x88, 0x05, 0x00, 0x00, 0x11, 0x00, 0x24, 0x95,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x28, 0x61,
+    // 0x215E '⅞'
+    0x08, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x0C, 0x01, 0x08, 0x62, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x06, 0x01, 0x04, 0x00, 0x11, 0x00, 0x80, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x10, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x30, 0x01, 0x10, 0x40, 0x01,
+    0x40, 0x00, 0x01, 0x84, 0x00, 0x01, 0x18, 0x00, 0x91, 0x60, 0x41, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x88, 0x05, 0x00, 0x00, 0x11, 0x00, 0x24, 0x95,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x00, 0x28, 0x61,
+    // 0x2190 '←'
+    0x04, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x09, 0x87,
+    0x91, 0x57, 0x41, 0x27, 0x01, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x00, 0x07,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x11, 0x00, 0x1F,
+    0x24, 0x00, 0x1F, 0x40, 0x03, 0xDF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0xDF, 0x24, 0x00, 0x1F, 0x11, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x00, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x01, 0x07, 0x41, 0x27, 0x91, 0x47,
+    0x09, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x08, 0x07, 0x04, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x08, 0x9F, 0xF0, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x5F, 0x00, 0x08, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x03, 0x07, 0x08, 0x87, 0x10, 0x47, 0x20, 0x27, 0x49, 0x17, 0x91, 0x87,
+    0x41, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x41, 0x07,
+    0x91, 0x87, 0x49, 0x17, 0x20, 0x27, 0x10, 0x47, 0x00, 0x87, 0x03, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x02, 0x02, 0x1F, 0x02, 0x11, 0x1F, 0x00, 0x04, 0x9F,
+    0x08, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x08, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x02, 0x11, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x00, 0x80, 0x00, 0x20, 0x00, 0x10, 0x01, 0x08, 0x11, 0x44, 0x21, 0x42,
+    0x49, 0x51, 0x51, 0x40, 0x01, 0x42, 0x01, 0x50, 0x01, 0x50, 0x01, 0x50,
+    0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x40, 0x09, 0x40, 0x07, 0x20,
+    // 0x21D1 '⇑'
+    0x01, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x09, 0x00, 0x3F,
+    0x03, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x3F,
+    0x09, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x02, 0x00, 0x3F, 0x01, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x07, 0x20, 0x09, 0x40, 0x01, 0x40, 0x01, 0x50, 0x01, 0x50, 0x01, 0x50,
+    0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x42, 0x51, 0x40, 0x49, 0x51,
+    0x21, 0x42, 0x11, 0x44, 0x01, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x80,
+    // 0x21D3 '⇓'
+    0x00, 0x10, 0x3F, 0x00, 0x28, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x02, 0x3F,
+    0x03, 0xF1, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x07, 0xF1, 0x3F,
+    0x00, 0x02, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x28, 0x3F, 0x00, 0x10, 0x3F,
+    // 0x21D4 '⇔'
+    0x01, 0x81, 0x04, 0x41, 0x08, 0x21, 0x10, 0x11, 0x22, 0x89, 0x42, 0x81,
+    0x0A, 0x85, 0x4A, 0xA9, 0x0A, 0xA1, 0x0A, 0xA1, 0x4A, 0xA9, 0x0A, 0x85,
+    0x42, 0x85, 0x22, 0x89, 0x10, 0x11, 0x08, 0x21, 0x00, 0x41, 0x01, 0x81,
+    // 0x2202 '∂'
+    0x00, 0x00, 0xC1, 0x00, 0x0C, 0x09, 0x00, 0x00, 0x05, 0x30, 0x40, 0x01,
+    0x50, 0x03, 0x41, 0x80, 0x88, 0x13, 0x80, 0x00, 0x03, 0xA0, 0x20, 0x01,
+    0x00, 0x00, 0x25, 0x90, 0x21, 0x81, 0x05, 0x04, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x30, 0x03, 0x01, 0x04, 0x10, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0xC0, 0x8F, 0x00, 0x00, 0x0F, 0x18, 0x18, 0x0F, 0x40, 0xC0, 0x0F,
+    0x80, 0x00, 0x0F, 0x86, 0x00, 0x0F, 0x00, 0xC0, 0x0F, 0x00, 0x18, 0x0F,
+    0x60, 0x03, 0x0F, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x0C, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x10, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x10, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x20, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x01, 0x7F, 0x88, 0x00, 0x00, 0xFF,
+    0x02, 0x00, 0x20, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x08, 0xFF,
+    0x00, 0x02, 0x00, 0xFF, 0x18, 0x08, 0x20, 0xFF, 0x10, 0x00, 0x00, 0xFF,
+    0x11, 0x01, 0x00, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0x10, 0x14, 0x00, 0xFF,
+    0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x40, 0x7F, 0x82, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7A, 0x7F,
+    // 0x221A '√'
+    0x00, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x00, 0x18, 0x1F,
+    0x00, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x0C, 0x04, 0x1F,
+    0x00, 0x20, 0x30, 0x1F, 0x04, 0x01, 0x80, 0x1F, 0x10, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x0D, 0x1F, 0x00, 0x1F, 0x80, 0x5F, 0x82, 0x1F, 0x01, 0x1F, 0x80, 0x1F,
+    0x8A, 0x5F, 0x00, 0x9F, 0x21, 0x1F, 0x00, 0x9F, 0x00, 0x1F, 0x80, 0x5F,
+    0x80, 0x1F, 0x00, 0x1F, 0x8C, 0x5F, 0x80, 0x5F, 0x61, 0x1F, 0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0x8F,
+    0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x11, 0x12, 0x01, 0x12, 0x09, 0x12, 0x01, 0x12, 0x81, 0x11, 0x01,
+    0x10, 0x01, 0x10, 0x81, 0x02, 0x01, 0x42, 0x01, 0x52, 0x01, 0x12, 0x01,
+    0x12, 0x01,
+    // 0x2264 '≤'
+    0x00, 0x02, 0x7F, 0x01, 0x02, 0x7F, 0x08, 0x82, 0x7F, 0x08, 0x82, 0x7F,
+    0x10, 0x42, 0x7F, 0x10, 0x02, 0x7F, 0x20, 0x22, 0x7F, 0x20, 0x02, 0x7F,
+    0x40, 0x92, 0x7F, 0x40, 0x02, 0x7F, 0x80, 0x42, 0x7F, 0x00, 0x0A, 0x7F,
+    0x40, 0x12, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x01, 0x3F, 0x00, 0x0D, 0x3F, 0x48, 0x05, 0x3F, 0x48, 0x01, 0x3F,
+    0x24, 0x49, 0x3F, 0x24, 0x01, 0x3F, 0x12, 0x91, 0x3F, 0x02, 0x81, 0x3F,
+    0x08, 0x01, 0x3F, 0x00, 0x01, 0x3F, 0x04, 0x01, 0x3F, 0x00, 0x01, 0x3F,
+    0x00, 0x01, 0x3F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BoldBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x03, 0x40, 0x38, 0x2B, 0x80, 0x01, 0x43, 0x00, 0x00, 0x47,
+    0x00, 0xFE, 0x43, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0x22 '"'
+    0x3F, 0x9F, 0x00, 0x1F, 0x00, 0x5F, 0x03, 0x9F, 0x00, 0x1F, 0x18, 0x1F,
+    0x40, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x40, 0x1F,
+    // 0x23 '#'
+    0x00, 0x18, 0x3F, 0x00, 0x20, 0x3F, 0x0A, 0x21, 0x3F, 0x0A, 0x20, 0x3F,
+    0x09, 0x00, 0x3F, 0x10, 0x03, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0x20, 0x3F,
+    0x2A, 0x21, 0xBF, 0x0A, 0x20, 0x3F, 0x0B, 0x80, 0x3F, 0x10, 0x01, 0x3F,
+    0x80, 0x00, 0x3F, 0x01, 0x20, 0x3F, 0x3A, 0x20, 0x3F, 0x0A, 0x10, 0x3F,
+    0x0A, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x08, 0x07, 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x02, 0x07,
+    0x04, 0x00, 0x10, 0x07, 0x00, 0x22, 0x08, 0x07, 0x08, 0x00, 0x19, 0xC7,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x11, 0xF7, 0x78, 0x08, 0x08, 0x07,
+    0x09, 0x00, 0x12, 0x07, 0x00, 0x84, 0x00, 0x07, 0x04, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x08, 0x07, 0x00, 0x00, 0x40, 0x07,
+    // 0x25 '%'
+    0x06, 0xC0, 0x01, 0x10, 0x10, 0x01, 0x20, 0x08, 0x01, 0x06, 0xC0, 0x01,
+    0x50, 0x00, 0x01, 0x50, 0x00, 0x01, 0x40, 0x20, 0x15, 0x00, 0x08, 0x41,
+    0x20, 0x00, 0x05, 0x10, 0x22, 0x11, 0x00, 0x08, 0x41, 0x00, 0x01, 0x01,
+    0x00, 0x04, 0x01, 0x01, 0x00, 0x01, 0x04, 0x20, 0x01, 0x10, 0x88, 0x01,
+    0x42, 0x00, 0x09, 0x00, 0x00, 0x01, 0x50, 0x08, 0x21, 0x00, 0x50, 0x05,
+    0x00, 0x40, 0x01, 0x00, 0x04, 0x41, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11,
+    0x00, 0x0C, 0x41,
+    // 0x26 '&'
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x43, 0x00, 0x10, 0x13, 0x00, 0x20, 0x03,
+    0x09, 0xC3, 0x0B, 0x20, 0x08, 0x43, 0x00, 0x08, 0x23, 0x00, 0x00, 0x03,
+    0x10, 0x40, 0x03, 0x00, 0x00, 0x07, 0x01, 0x08, 0x03, 0x0C, 0x04, 0x23,
+    0x00, 0x82, 0x03, 0x01, 0x01, 0x0B, 0x1C, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0x27 '''
+    0x3F, 0x9F, 0x00, 0x1F, 0x00, 0x5F, 0x03, 0x9F, 0x00, 0x1F,
+    // 0x28 '('
+    0x00, 0x18, 0xC0, 0x0F, 0x00, 0x80, 0x08, 0x0F, 0x04, 0x00, 0x02, 0x0F,
+    0x08, 0x00, 0x00, 0x8F, 0x00, 0xC0, 0x10, 0x4F, 0x02, 0x00, 0x04, 0x2F,
+    0x00, 0x00, 0x01, 0x1F, 0x10, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x6F,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6F, 0x08, 0x00, 0x00, 0x9F,
+    0x44, 0x00, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x10, 0x30, 0x60, 0x0F,
+    0x08, 0x00, 0x01, 0x0F, 0x02, 0x00, 0x04, 0x0F, 0x00, 0x80, 0x10, 0x0F,
+    0x00, 0x06, 0x00, 0x0F,
+    // 0x2A '*'
+    0x00, 0x3F, 0x20, 0x3F, 0x48, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x00, 0x3F,
+    0x82, 0x3F, 0x00, 0x7F, 0x02, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x2B '+'
+    0x02, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F,
+    0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x00, 0x3F, 0x01, 0x3F, 0x44, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x84, 0x3F,
+    0x70, 0x3F,
+    // 0x2D '-'
+    0x0F, 0x8F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x6F,
+    // 0x2E '.'
+    0x27, 0x87, 0x0F, 0x0F, 0x87, 0x67,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x21, 0x00, 0x00, 0x81,
+    0x00, 0x02, 0x01, 0x00, 0x10, 0x11, 0x00, 0x40, 0x41, 0x01, 0x01, 0x01,
+    0x08, 0x08, 0x01, 0x20, 0x20, 0x01, 0x00, 0x80, 0x01, 0x02, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x00, 0x07, 0x03, 0x03, 0x07, 0x08, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x17, 0x41, 0x86, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x04, 0x03, 0x17,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x08, 0x01, 0x07,
+    0x00, 0xF0, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x0F, 0x24, 0x00, 0x4F,
+    0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x30, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x2F,
+    // 0x32 '2'
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x9F, 0x21, 0x01, 0x0F, 0x41, 0x02, 0x0F,
+    0x06, 0x04, 0x0F, 0x00, 0x08, 0x0F, 0x10, 0x11, 0x8F, 0x10, 0x20, 0x8F,
+    0x00, 0x40, 0x8F, 0x07, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x8F,
+    0x00, 0x00, 0x8F, 0x11, 0x80, 0x8F, 0x00, 0x00, 0x2F,
+    // 0x33 '3'
+    0x00, 0x00, 0x07, 0x14, 0x00, 0x47, 0x00, 0x00, 0x47, 0x44, 0x00, 0x47,
+    0x08, 0x40, 0x4F, 0x00, 0x00, 0x47, 0x10, 0x10, 0x07, 0x10, 0x90, 0x87,
+    0x11, 0x10, 0x07, 0x0E, 0x08, 0x17, 0x00, 0x00, 0x07, 0x40, 0xC0, 0x27,
+    0x01, 0x00, 0x47, 0x0C, 0x10, 0x07, 0x00, 0x00, 0x07,
+    // 0x34 '4'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x20, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x10, 0x07, 0x04, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x21, 0x00, 0x07, 0x43, 0xF8, 0xF7, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x7F, 0xF8, 0xF7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x57, 0x07, 0xC0, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x4F, 0x00, 0x20, 0x07, 0x0C, 0x20, 0x07, 0x00, 0x00, 0x87,
+    0x01, 0x10, 0x17, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x07, 0x30, 0x12, 0x07,
+    // 0x36 '6'
+    0x00, 0x00, 0x07, 0x00, 0x80, 0x87, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x10, 0x00, 0x17, 0x00, 0x21, 0x07, 0x02, 0x20, 0x07, 0x44, 0x20, 0x47,
+    0x00, 0x20, 0x47, 0x00, 0x10, 0x07, 0x00, 0x07, 0x07, 0x10, 0x80, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x20, 0x0F, 0x07,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x60, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x47,
+    0x08, 0x02, 0x07, 0x00, 0x08, 0x07, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x37,
+    0x01, 0x03, 0x07, 0x00, 0x08, 0x07, 0x08, 0x20, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x00, 0x90, 0x07, 0x00, 0x40, 0x17,
+    0x40, 0x02, 0x07, 0x0E, 0x08, 0x07, 0x11, 0x10, 0x47, 0x00, 0x10, 0x4F,
+    0x00, 0x80, 0x47, 0x01, 0x00, 0x07, 0x00, 0x03, 0x07, 0x40, 0x40, 0x17,
+    0x00, 0x80, 0x07, 0x01, 0x10, 0x07, 0x00, 0x07, 0x87,
+    // 0x39 '9'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x17, 0x20, 0x10, 0x07, 0x00, 0x00, 0x47,
+    0x40, 0x08, 0x47, 0x08, 0x00, 0x07, 0x00, 0x00, 0x87, 0x10, 0x21, 0x17,
+    0x00, 0x22, 0x07, 0x08, 0x24, 0x27, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x01, 0x07, 0x10, 0x04, 0x07, 0x07, 0x70, 0x07,
+    // 0x3A ':'
+    0x20, 0x04, 0x08, 0x10, 0x80, 0x01, 0x80, 0x01, 0x08, 0x10, 0x20, 0x0C,
+    // 0x3B ';'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x09, 0x07, 0x80, 0x10, 0x07,
+    0x80, 0x00, 0x07, 0x08, 0x10, 0x87, 0x50, 0x0E, 0x07,
+    // 0x3C '<'
+    0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x00, 0x87, 0x00, 0x07, 0x00, 0x47,
+    0x01, 0x07, 0x00, 0x27, 0x08, 0x87, 0x40, 0x07, 0x10, 0x47, 0x80, 0x0F,
+    0x20, 0x27,
+    // 0x3D '='
+    0x63, 0x7F, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF,
+    // 0x3E '>'
+    0x00, 0x07, 0x00, 0x27, 0x90, 0x0F, 0x00, 0x47, 0x48, 0x17, 0x00, 0x87,
+    0x24, 0x27, 0x01, 0x07, 0x02, 0x47, 0x00, 0x07, 0x00, 0x87, 0x00, 0x07,
+    0x01, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x03, 0x48, 0x00, 0x03, 0x08, 0x18, 0x13, 0x88, 0x01, 0x43,
+    0x80, 0x00, 0x47, 0x00, 0x46, 0x43, 0x08, 0x08, 0x03, 0x40, 0x00, 0x03,
+    0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x20, 0x03, 0x00, 0x00, 0x03,
+    // 0x40 '@'
+    0x00, 0x1F, 0x80, 0x3F, 0x00, 0x80, 0x10, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x08, 0x40, 0x40, 0x3F, 0x11, 0x00, 0x11, 0x3F,
+    0x02, 0x00, 0x08, 0x3F, 0x04, 0x00, 0x04, 0xBF, 0x00, 0x42, 0x40, 0x3F,
+    0x40, 0x00, 0x22, 0x3F, 0x01, 0x28, 0x02, 0x3F, 0x10, 0x0B, 0x00, 0x7F,
+    0x10, 0x80, 0x80, 0x7F, 0x12, 0x04, 0xA0, 0x7F, 0x10, 0x33, 0x40, 0x7F,
+    0x10, 0x00, 0x00, 0x3F, 0x11, 0x00, 0x22, 0x3F, 0x00, 0x7F, 0x02, 0x3F,
+    0x48, 0x00, 0x80, 0xBF, 0x40, 0x00, 0x84, 0x3F, 0x00, 0x00, 0x21, 0x3F,
+    0x01, 0x02, 0x00, 0x3F, 0x10, 0x00, 0x40, 0x3F, 0x08, 0x00, 0x80, 0x3F,
+    0x02, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x01, 0x0F, 0x04, 0x02, 0x0F,
+    0x20, 0x22, 0x0F, 0x01, 0x02, 0x0F, 0x84, 0x02, 0x0F, 0x01, 0x82, 0x0F,
+    0x00, 0x32, 0x2F, 0x40, 0x02, 0x0F, 0x08, 0x00, 0xCF, 0x01, 0x00, 0x0F,
+    0x00, 0x60, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x42 'B'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07, 0x9F, 0xFF, 0xC7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x9F, 0x0F, 0x87,
+    0x80, 0x80, 0x47, 0x80, 0x80, 0x47, 0x80, 0x80, 0x07, 0x80, 0x10, 0x07,
+    0x00, 0x09, 0x17, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x11, 0x20, 0x07,
+    0x00, 0x10, 0x87, 0x00, 0x00, 0x07,
+    // 0x43 'C'
+    0x00, 0xCE, 0x07, 0x04, 0x00, 0x87, 0x10, 0x00, 0x07, 0x20, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x04, 0x04, 0x17, 0x08, 0x01, 0x07, 0x90, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x18, 0x00, 0x07, 0x80, 0x00, 0x87, 0x02, 0x00, 0x97, 0x4C, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x44 'D'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07, 0x9F, 0xFF, 0xC7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x47, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x97, 0x04, 0x01, 0x07, 0x41, 0x04, 0x27,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0xF0, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F,
+    0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F, 0x80, 0x22, 0x0F, 0x80, 0x00, 0x0F,
+    0x6C, 0x02, 0x3F, 0x00, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x90, 0x40, 0x4F, 0x90, 0x40, 0x4F, 0x90, 0x40, 0x1F, 0x90, 0x00, 0x0F,
+    0x90, 0x00, 0x0F, 0x82, 0x00, 0x0F, 0x80, 0x20, 0x0F, 0x7C, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0xCE, 0x07, 0x04, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x20, 0x07, 0x42, 0x02, 0x17, 0x08, 0x01, 0x07, 0x80, 0x00, 0x87,
+    0x90, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x04, 0x87, 0x82, 0x00, 0x07, 0x82, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x10, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x10, 0x4F, 0xA0, 0x10, 0x0F, 0x40, 0x10, 0x3F, 0x00, 0x10, 0x0F,
+    0x00, 0x10, 0x0F, 0x40, 0x10, 0x1F, 0x80, 0x10, 0x0F, 0x80, 0x10, 0x4F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x9F, 0xFF, 0x8F, 0x80, 0x00, 0x4F, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x4F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x4F, 0xA0, 0x00, 0x0F, 0x40, 0x00, 0x3F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x04, 0x7F, 0x9F, 0xFF, 0xE0, 0x3F,
+    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x02, 0x3F,
+    0x80, 0x00, 0x30, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x80, 0x00, 0x07, 0x9F, 0xFF, 0xC7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x90, 0x47, 0xA1, 0x08, 0x07, 0x02, 0x00, 0x27, 0x04, 0x01, 0x07,
+    0x48, 0xA0, 0x87, 0xB1, 0x10, 0x47, 0x82, 0x00, 0x27, 0x84, 0x00, 0x17,
+    0x88, 0x00, 0x07, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x47,
+    0x40, 0x00, 0x17, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x1E, 0x0F,
+    0x98, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x1F, 0xCF, 0x84, 0x00, 0x0F,
+    0x80, 0x80, 0x3F, 0x80, 0x10, 0x0F, 0x20, 0x02, 0x0F, 0x06, 0x00, 0x4F,
+    0x00, 0x40, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0xC0, 0x4F, 0x04, 0x02, 0x0F,
+    0x20, 0x30, 0x0F, 0x81, 0x80, 0x1F, 0x84, 0x00, 0x0F, 0x80, 0x0F, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x9C, 0x00, 0x0F, 0x80, 0x07, 0x8F,
+    0x40, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x8F, 0xFF, 0x87,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x81, 0xFF, 0x87, 0x00, 0x00, 0x47,
+    0x20, 0x40, 0x07, 0x10, 0x00, 0x07, 0x00, 0x08, 0x07, 0x02, 0x00, 0x07,
+    0x00, 0x01, 0x07, 0x00, 0x40, 0x87, 0x20, 0x00, 0x27, 0x80, 0x08, 0x17,
+    0x9F, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0xCC, 0x07, 0x04, 0x00, 0x87, 0x10, 0x00, 0x47, 0x20, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x08, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x17, 0x02, 0x02, 0x07, 0x40, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x08, 0x02, 0x07, 0x01, 0xF0, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0x90, 0x08, 0x3F, 0x80, 0x08, 0x0F,
+    0x87, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x19, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0xCC, 0x00, 0x1F, 0x04, 0x00, 0x80, 0x1F, 0x10, 0x00, 0x40, 0x1F,
+    0x20, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x10, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x88, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x42, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x10, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x14, 0x1F, 0x02, 0x02, 0x00, 0x1F,
+    0x40, 0x00, 0x20, 0x5F, 0x00, 0x00, 0x42, 0x1F, 0x00, 0x00, 0x82, 0x1F,
+    0x08, 0x02, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x52 'R'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07, 0x9F, 0xFF, 0xC7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x08, 0x47, 0x80, 0x44, 0x07, 0x80, 0x42, 0x07, 0x80, 0x80, 0x07,
+    0x87, 0x00, 0x47, 0x00, 0x08, 0x27, 0x40, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x11, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x47, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x01, 0xE7, 0x10, 0x80, 0x17, 0x00, 0x04, 0x07, 0x40, 0x21, 0x07,
+    0x00, 0x00, 0x07, 0x82, 0x00, 0x4F, 0x01, 0x00, 0x4F, 0x00, 0x08, 0x4F,
+    0x00, 0x80, 0x47, 0x00, 0x00, 0x87, 0x8C, 0x40, 0x17, 0x82, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x70, 0x08, 0x87, 0x00, 0x00, 0x07,
+    // 0x54 'T'
+    0x00, 0x00, 0x0F, 0x82, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x82, 0x00, 0x0F,
+    0x90, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x4F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x90, 0x00, 0x4F, 0x90, 0x00, 0x4F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x82, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x55 'U'
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x01, 0x87,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x17, 0x9F, 0xFE, 0x07,
+    0x80, 0x00, 0x87, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x07, 0x80, 0x00, 0x87, 0x9F, 0xFE, 0x17,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x87, 0x9F, 0xFC, 0x07,
+    0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07, 0x82, 0x00, 0x07,
+    0x80, 0x80, 0x07, 0x80, 0x10, 0x07, 0x80, 0x04, 0x07, 0x90, 0x00, 0x87,
+    0x82, 0x00, 0x27, 0xA0, 0x40, 0x07, 0x00, 0x0C, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x10, 0x07, 0x20, 0xC0, 0x47, 0x86, 0x01, 0x07, 0x90, 0x08, 0x07,
+    0x80, 0x20, 0x07, 0x81, 0x00, 0x07, 0x84, 0x00, 0x07, 0x90, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07, 0x86, 0x00, 0x07,
+    0x80, 0xC0, 0x07, 0x80, 0x08, 0x07, 0x80, 0x01, 0x07, 0x90, 0x00, 0x27,
+    0x81, 0x00, 0x07, 0xA0, 0x10, 0x07, 0x00, 0x02, 0x07, 0x00, 0x10, 0x07,
+    0x01, 0x00, 0x47, 0x18, 0x02, 0x07, 0x00, 0x30, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x10, 0x07, 0x00, 0x02, 0x07, 0x08, 0x00, 0x47, 0x01, 0x00, 0x07,
+    0x00, 0x10, 0x07, 0x00, 0x02, 0x07, 0x40, 0x18, 0x07, 0x81, 0x80, 0x27,
+    0x98, 0x01, 0x07, 0x80, 0x08, 0x07, 0x80, 0xC0, 0x07, 0x86, 0x00, 0x07,
+    0x90, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x3F, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x4F, 0x90, 0x00, 0x8F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x81, 0x08, 0x0F, 0x80, 0x90, 0x8F,
+    0x90, 0x00, 0x0F, 0xA0, 0x04, 0x0F, 0x42, 0x08, 0x0F, 0x00, 0x00, 0x1F,
+    0x04, 0x01, 0x0F, 0xA8, 0x20, 0x4F, 0x81, 0x10, 0x0F, 0x82, 0x00, 0x0F,
+    0x84, 0x02, 0x0F, 0x80, 0x01, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x4F,
+    0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x82, 0x00, 0x0F, 0x80, 0x80, 0x2F, 0x80, 0x00, 0x0F, 0x90, 0x10, 0x4F,
+    0xA4, 0x00, 0x0F, 0x41, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x80, 0x0F,
+    0x22, 0x1F, 0x8F, 0x88, 0x00, 0x4F, 0x80, 0x80, 0x0F, 0x82, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x7C, 0x00, 0x97, 0x82, 0x00, 0x07, 0x80, 0x04, 0x07,
+    0x80, 0x00, 0x07, 0x90, 0x20, 0x07, 0x90, 0x40, 0x87, 0x90, 0x02, 0x07,
+    0x82, 0x04, 0x07, 0x80, 0x00, 0x07, 0x80, 0x20, 0x07, 0x80, 0x00, 0x07,
+    0x81, 0x00, 0x07, 0x80, 0x01, 0x07, 0x08, 0x04, 0x07, 0x50, 0x00, 0x17,
+    0x00, 0x00, 0x07,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x00, 0x80, 0x01, 0x10, 0x10, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x20, 0x21, 0x00, 0x08, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x05,
+    // 0x5D ']'
+    0xC0, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xDF,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x17, 0x00, 0x47, 0x02, 0x07, 0x08, 0x0F, 0x00, 0x47,
+    0x02, 0x07, 0x00, 0x07, 0x04, 0x07, 0x40, 0x87, 0x10, 0x17, 0x04, 0x07,
+    0x00, 0x87, 0x00, 0x27, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x30, 0x08, 0x00, 0x20, 0x12, 0x02, 0x00,
+    // 0x61 'a'
+    0x00, 0x16, 0x7F, 0x00, 0x41, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x80, 0x7F,
+    0x48, 0x18, 0x7F, 0x00, 0x24, 0x7F, 0x10, 0x04, 0x7F, 0x01, 0x01, 0x7F,
+    0x00, 0x02, 0x7F, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x05, 0x7F, 0x00, 0x02, 0x7F,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x1F, 0xFF, 0xFD,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xE1,
+    0x00, 0x20, 0x11, 0x01, 0x00, 0x13, 0x00, 0x00, 0x11, 0x00, 0x20, 0x01,
+    0x00, 0x18, 0x41, 0x00, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x80, 0x11,
+    0x00, 0x20, 0x41, 0x00, 0x00, 0x01,
+    // 0x63 'c'
+    0x02, 0x18, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F,
+    0x03, 0xE0, 0x7F, 0x48, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+    0x08, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x42, 0x00, 0x7F, 0x20, 0x01, 0x7F,
+    0x08, 0x04, 0x7F,
+    // 0x64 'd'
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    0x01, 0x0F, 0x81, 0x01, 0x20, 0x23, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x1E, 0x3F, 0xC1, 0x00, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x09,
+    // 0x65 'e'
+    0x02, 0x18, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F,
+    0x44, 0x50, 0x7F, 0x40, 0x48, 0x7F, 0x10, 0x40, 0x7F, 0x00, 0x40, 0xFF,
+    0x08, 0x44, 0x7F, 0x40, 0x44, 0x7F, 0x00, 0x40, 0x7F, 0x20, 0x41, 0x7F,
+    0x10, 0x42, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x66 'f'
+    0x00, 0xC0, 0x03, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x03, 0x06, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x8F, 0x3F, 0xF3,
+    0x91, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x80, 0xC0, 0x03,
+    0x80, 0x00, 0x03, 0x08, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x67 'g'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x08, 0x92, 0x05, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x18, 0x93, 0x00, 0x04, 0x83, 0x10, 0x84, 0x83,
+    0x10, 0x84, 0x83, 0x00, 0x04, 0x91, 0x42, 0x04, 0x81, 0x40, 0x24, 0x21,
+    0x40, 0x44, 0x05, 0x18, 0x84, 0x01, 0x10, 0x00, 0x01, 0x00, 0x01, 0xE1,
+    0x20, 0x00, 0x01,
+    // 0x68 'h'
+    0x60, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x20, 0x0F, 0x01, 0x00, 0x03, 0x00, 0x20, 0x0F, 0x00, 0x10, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x69 'i'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x21, 0x00, 0x03, 0x09, 0x00, 0x03,
+    0x89, 0x00, 0x03, 0x89, 0x00, 0x03, 0x08, 0x00, 0x03, 0x70, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x71, 0x20, 0x06, 0x07, 0x09, 0x00, 0x00, 0x17,
+    0x89, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x47, 0x00, 0x00, 0x03, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x60, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x0D, 0x01, 0x00, 0x41, 0x01, 0x40, 0x11, 0x01, 0x08, 0x09,
+    0x01, 0x11, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x40, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    // 0x6C 'l'
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x03, 0x10, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x6D 'm'
+    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x24, 0x04, 0x08, 0x03, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x03,
+    0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    // 0x6E 'n'
+    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x24, 0x04, 0x08, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00,
+    // 0x6F 'o'
+    0x02, 0x18, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F,
+    0x03, 0xE0, 0x7F, 0x48, 0x08, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x41, 0xE1, 0x7F, 0x00, 0x00, 0x7F,
+    0x20, 0x02, 0x7F, 0x10, 0x00, 0x7F, 0x06, 0x20, 0x7F,
+    // 0x70 'p'
+    0x30, 0x00, 0x01, 0x00, 0x00, 0x09, 0x48, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x04, 0x01,
+    0x40, 0x04, 0x89, 0x40, 0x04, 0x01, 0x08, 0x00, 0x01, 0x04, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x08, 0x01,
+    0x03, 0x80, 0x01,
+    // 0x71 'q'
+    0x02, 0x18, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x43, 0xE0, 0x01, 0x48, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x09, 0x0F, 0xF0, 0xF1, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05,
+    // 0x72 'r'
+    0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x00,
+    // 0x73 's'
+    0x00, 0x0E, 0x7F, 0x10, 0x01, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x40, 0x7F,
+    0x48, 0x00, 0x7F, 0x10, 0x20, 0x7F, 0x02, 0x00, 0x7F, 0x10, 0x10, 0x7F,
+    0x01, 0x00, 0x7F, 0x40, 0x01, 0x7F, 0x00, 0x80, 0x7F, 0x38, 0x44, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x19, 0xFF, 0x8F,
+    0x40, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x71, 0xFE, 0x1F,
+    0x08, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x0A, 0x00, 0x2F,
+    0x00, 0x00, 0x8F,
+    // 0x75 'u'
+    0x60, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x80, 0x04, 0x80, 0x02, 0x80, 0x00,
+    0x9F, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x1F, 0xF0,
+    0x80, 0x02, 0x80, 0x00, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    // 0x76 'v'
+    0x00, 0x00, 0xA0, 0x00, 0x90, 0x00, 0x84, 0x00, 0x81, 0x00, 0x80, 0x20,
+    0x80, 0x08, 0xA8, 0x02, 0x81, 0x00, 0x00, 0x20, 0x00, 0x40, 0x42, 0x04,
+    0xA8, 0x10, 0x80, 0x40, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x00,
+    // 0x77 'w'
+    0x00, 0x00, 0xA0, 0x00, 0x90, 0x00, 0x82, 0x00, 0x80, 0x40, 0x80, 0x10,
+    0x90, 0x02, 0xA2, 0x00, 0x40, 0x20, 0x00, 0x40, 0x06, 0x04, 0x20, 0x60,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x10, 0x10, 0x02, 0x01, 0x00, 0x00, 0x20,
+    0x40, 0x80, 0xAC, 0x04, 0x80, 0x20, 0x81, 0x80, 0x84, 0x00, 0x80, 0x00,
+    0x80, 0x00,
+    // 0x78 'x'
+    0x00, 0x03, 0x80, 0x01, 0x80, 0x09, 0x80, 0x11, 0x80, 0x21, 0x80, 0x41,
+    0x81, 0x01, 0x90, 0x01, 0x08, 0x01, 0x00, 0x05, 0x40, 0x09, 0xA2, 0x81,
+    0x84, 0x41, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0x00, 0x01,
+    // 0x79 'y'
+    0x40, 0x00, 0x33, 0xA0, 0x00, 0x23, 0x90, 0x00, 0x27, 0x84, 0x00, 0x07,
+    0x81, 0x00, 0x07, 0x80, 0x20, 0x43, 0x80, 0x08, 0x0B, 0xA8, 0x03, 0x03,
+    0x81, 0x00, 0x03, 0x00, 0x20, 0x43, 0x00, 0x40, 0x03, 0x42, 0x04, 0x03,
+    0xB8, 0x10, 0x03, 0x80, 0x40, 0x03, 0x81, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x00, 0x78, 0x02, 0x84, 0x20, 0x88, 0x40, 0x80, 0x00, 0x82, 0x00,
+    0x84, 0x18, 0x88, 0x08, 0x80, 0x88, 0x81, 0x08, 0x80, 0x00, 0x80, 0x20,
+    0x90, 0x40, 0x20, 0x38,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x08, 0x07, 0x8F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F,
+    0x00, 0x70, 0xE0, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x60, 0x00, 0x00, 0x6F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x06, 0x04, 0x07, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x1B, 0x88, 0x1C, 0x8F, 0x00, 0x01, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x7E '~'
+    0x2B, 0x03, 0x8B, 0x03, 0x03, 0x93, 0x03, 0x4B, 0x03, 0x23, 0x43, 0x8B,
+    0x93, 0x03,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x05, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0xE0, 0x05, 0x00, 0x00, 0x01,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x40, 0x0F, 0x00, 0x80, 0x10, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x02, 0x40, 0x40, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x7C, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0xF0, 0x20, 0x0F, 0x00, 0x80, 0x20, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x02, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x00, 0xC0, 0x00, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x50, 0x0F, 0x00, 0x50, 0x8F,
+    0x00, 0x48, 0x07, 0x04, 0x00, 0x17, 0x10, 0x00, 0x17, 0x00, 0x03, 0x07,
+    0x41, 0xC0, 0x07, 0x08, 0x50, 0x07, 0x10, 0x50, 0x07, 0x00, 0x50, 0x07,
+    0x10, 0x50, 0x07, 0x04, 0x60, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x18, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x20, 0x09, 0x40, 0x05, 0x4E, 0xE5, 0x20, 0x09, 0x00, 0x01, 0x22, 0x89,
+    0x20, 0x01, 0x00, 0x21, 0x00, 0x01, 0x24, 0x49, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x20, 0x0F,
+    0x02, 0x0A, 0x0F, 0x00, 0x8A, 0x0F, 0x00, 0x0A, 0x0F, 0x08, 0x0A, 0x4F,
+    0x22, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+    0x04, 0x1A, 0x4F, 0x10, 0x0A, 0x0F, 0x01, 0x0A, 0x3F, 0x04, 0x0A, 0x0F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x02, 0x20, 0x29, 0x00, 0x08, 0x45, 0x01, 0x04, 0x01, 0x00, 0x82, 0x01,
+    0x50, 0x40, 0x03, 0x00, 0x09, 0x03, 0x01, 0x20, 0x01, 0x10, 0x04, 0x01,
+    0x08, 0x82, 0x25, 0x04, 0x49, 0x01, 0x04, 0x03, 0x11, 0x10, 0x10, 0x21,
+    0x00, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x08, 0xF0, 0x07, 0x10, 0x02, 0x07,
+    0x28, 0x00, 0x07, 0x10, 0x00, 0x07, 0x41, 0x00, 0x17, 0x20, 0x00, 0x27,
+    0x84, 0xF1, 0x27, 0x80, 0x00, 0x07, 0x82, 0x04, 0x0F, 0x82, 0x00, 0x0F,
+    0x81, 0x00, 0x07, 0x80, 0x85, 0x27, 0x22, 0x06, 0x27, 0x40, 0x00, 0x17,
+    0x10, 0x00, 0x07, 0x28, 0x00, 0x07, 0x12, 0x02, 0x07, 0x00, 0x71, 0x07,
+    0x01, 0x04, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x03, 0x0B, 0x04, 0x17, 0x90, 0x57, 0xA8, 0x17, 0x08, 0x57, 0x29, 0x17,
+    0x80, 0x17, 0x00, 0x57, 0x01, 0x53, 0x00, 0x13, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x08, 0x2F,
+    0x10, 0x0F, 0x00, 0x6F, 0x08, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x08, 0x2F, 0x10, 0x0F, 0x20, 0x6F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x06, 0x49, 0x10, 0x11, 0x40, 0x09, 0x07, 0xC3,
+    0x80, 0x07, 0xD6, 0xC1, 0xD0, 0x41, 0xC0, 0x25, 0x08, 0x47, 0x20, 0x01,
+    0x10, 0x05, 0x20, 0x29, 0x08, 0x11, 0x01, 0x01,
+    // 0xB0 '°'
+    0x0E, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x0A, 0x1F, 0x11, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x0E, 0x1F, 0x40, 0x1F, 0x20, 0x1F, 0x04, 0x1F,
+    // 0xB1 '±'
+    0x03, 0x01, 0xBF, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F,
+    0x04, 0x02, 0x3F, 0x00, 0x0A, 0x3F, 0x80, 0x02, 0x3F, 0x80, 0x02, 0x3F,
+    0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F,
+    0x04, 0x02, 0x3F,
+    // 0xB2 '²'
+    0x08, 0x1B, 0x24, 0x27, 0x00, 0x07, 0x4C, 0x07, 0x10, 0x07, 0x10, 0x07,
+    0x0C, 0x47, 0x40, 0x87, 0x01, 0x07, 0x14, 0x03, 0x00, 0x13,
+    // 0xB3 '³'
+    0x00, 0x03, 0x08, 0x07, 0x48, 0x13, 0x12, 0x93, 0x00, 0x13, 0x04, 0x07,
+    0x08, 0x47, 0x40, 0x03, 0x01, 0x03, 0x18, 0xA3,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0xC1, 0x70, 0x10, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x40, 0x04, 0x01,
+    0x40, 0x01, 0x01, 0x00, 0x00, 0x01, 0x60, 0x08, 0x01, 0x00, 0x04, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x06, 0x01,
+    // 0xB6 '¶'
+    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x90, 0x00, 0x00, 0x80, 0x00, 0x04,
+    0x80, 0x00, 0x04, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0xB7 '·'
+    0x27, 0x87, 0x0F, 0x0F, 0x87, 0x67,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x0F, 0x28, 0x07, 0x08, 0x17, 0x00, 0x07, 0x40, 0x07,
+    0x00, 0x07, 0x20, 0x17, 0x00, 0x17, 0x00, 0x0B,
+    // 0xBA 'º'
+    0x1E, 0x03, 0x40, 0x87, 0x00, 0x17, 0xA0, 0x57, 0x00, 0x17, 0x00, 0x17,
+    0x21, 0x57, 0x84, 0x17, 0x00, 0x83, 0x21, 0x03, 0x00, 0x03,
+    // 0xBB '»'
+    0x40, 0x2F, 0x00, 0x8F, 0x01, 0x2F, 0x44, 0x0F, 0x20, 0x0F, 0x00, 0x8F,
+    0x01, 0x0F, 0x46, 0x0F, 0x00, 0x8F, 0x01, 0x0F, 0x46, 0x0F, 0x20, 0x0F,
+    0x00, 0x8F, 0x01, 0x0F, 0x06, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x01, 0x10, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x23, 0x00, 0x00, 0x03, 0x00, 0x01, 0x09,
+    0x00, 0x04, 0x21, 0x00, 0x00, 0x81, 0x00, 0x20, 0x01, 0x00, 0x80, 0x01,
+    0x02, 0x10, 0x01, 0x08, 0x40, 0xC1, 0x21, 0x01, 0x21, 0x00, 0x00, 0x21,
+    0x08, 0x08, 0xA1, 0x20, 0x12, 0xA1, 0x00, 0x04, 0xA1, 0x00, 0x0F, 0x99,
+    0x00, 0x00, 0x05, 0x00, 0x80, 0x05, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA1,
+    0x00, 0x00, 0x41,
+    // 0xBD '½'
+    0x00, 0x00, 0x01, 0x10, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0D,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x43, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x41, 0x00, 0x21, 0x01, 0x00, 0x84, 0x01, 0x02, 0x10, 0x01,
+    0x08, 0x40, 0x01, 0x20, 0x00, 0x01, 0x02, 0x28, 0x29, 0x08, 0x40, 0x01,
+    0x60, 0x00, 0x01, 0x00, 0x90, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x61,
+    0x00, 0x80, 0xA1, 0x00, 0x01, 0x21, 0x00, 0x42, 0x21, 0x00, 0x18, 0x29,
+    0x00, 0x00, 0x01,
+    // 0xBE '¾'
+    0x00, 0x00, 0x01, 0x04, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x02, 0x10, 0x01, 0x00, 0x60, 0x01, 0x00, 0x04, 0x01,
+    0x22, 0x00, 0x01, 0x08, 0x50, 0x23, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x21, 0x00, 0x10, 0x81, 0x00, 0x42, 0x01, 0x01, 0x08, 0x01,
+    0x04, 0x20, 0x01, 0x10, 0x00, 0xC1, 0x01, 0x01, 0x21, 0x04, 0x00, 0x21,
+    0x10, 0x08, 0xA1, 0x00, 0x12, 0xA1, 0x00, 0x04, 0xA1, 0x00, 0x0F, 0x99,
+    0x00, 0x00, 0x05, 0x00, 0x80, 0x05, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA1,
+    0x00, 0x00, 0x41,
+    // 0xBF '¿'
+    0x00, 0x07, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x13, 0x00, 0x20, 0x8B,
+    0x30, 0x04, 0x43, 0x40, 0x40, 0x07, 0x01, 0x80, 0x07, 0x00, 0x08, 0x03,
+    0x49, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x2B,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x01, 0x01, 0x0F, 0x00, 0x04, 0x02, 0x0F, 0x00, 0x20, 0x22, 0x0F,
+    0x24, 0x01, 0x02, 0x0F, 0x00, 0x84, 0x02, 0x0F, 0x00, 0x01, 0x82, 0x0F,
+    0x08, 0x00, 0x32, 0x2F, 0x00, 0x40, 0x02, 0x0F, 0x00, 0x08, 0x00, 0xCF,
+    0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x01, 0x0F, 0x00, 0x04, 0x02, 0x0F, 0x08, 0x20, 0x22, 0x0F,
+    0x10, 0x01, 0x02, 0x0F, 0x00, 0x84, 0x02, 0x0F, 0x24, 0x01, 0x82, 0x0F,
+    0x40, 0x00, 0x32, 0x2F, 0x00, 0x40, 0x02, 0x0F, 0x30, 0x08, 0x00, 0xCF,
+    0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x04, 0x00, 0x00, 0x0F,
+    0x08, 0x01, 0x01, 0x0F, 0x12, 0x04, 0x02, 0x0F, 0x24, 0x20, 0x22, 0x0F,
+    0x48, 0x01, 0x02, 0x0F, 0x10, 0x84, 0x02, 0x0F, 0x00, 0x01, 0x82, 0x0F,
+    0x00, 0x00, 0x32, 0x2F, 0x20, 0x40, 0x02, 0x0F, 0x10, 0x08, 0x00, 0xCF,
+    0x04, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x48, 0x02, 0x02, 0x1F, 0x08, 0x08, 0x04, 0x1F, 0x10, 0x40, 0x44, 0x1F,
+    0x10, 0x02, 0x04, 0x1F, 0x49, 0x08, 0x04, 0x1F, 0x00, 0x03, 0x04, 0x1F,
+    0x00, 0x00, 0x64, 0x5F, 0x08, 0x80, 0x04, 0x1F, 0x40, 0x10, 0x01, 0x9F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    0x80, 0x04, 0x04, 0x3F, 0x80, 0x10, 0x08, 0x3F, 0x80, 0x80, 0x88, 0x3F,
+    0x60, 0x04, 0x08, 0x3F, 0x02, 0x10, 0x08, 0x3F, 0x60, 0x06, 0x08, 0x3F,
+    0x80, 0x00, 0xC8, 0xBF, 0x81, 0x00, 0x08, 0x3F, 0x80, 0x20, 0x03, 0x3F,
+    0x60, 0x04, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x01, 0x0F, 0x00, 0x04, 0x02, 0x0F, 0x02, 0x20, 0x22, 0x0F,
+    0x20, 0x01, 0x02, 0x0F, 0x84, 0x84, 0x02, 0x0F, 0xA0, 0x01, 0x82, 0x0F,
+    0x02, 0x00, 0x32, 0x2F, 0x04, 0x40, 0x02, 0x0F, 0x00, 0x08, 0x00, 0xCF,
+    0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x41, 0x0F,
+    0x00, 0x02, 0x0F, 0xA2, 0x02, 0x0F, 0x88, 0x22, 0x0F, 0x80, 0x82, 0x0F,
+    0x82, 0x02, 0x0F, 0x88, 0x02, 0x0F, 0x8F, 0xF1, 0x8F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x8F, 0x8F, 0x8F, 0x90, 0x10, 0x0F,
+    0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F, 0x90, 0x10, 0x0F,
+    0x80, 0x21, 0x0F, 0x80, 0x00, 0x0F, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+    // 0xC7 'Ç'
+    0x00, 0xCE, 0x00, 0x0F, 0x04, 0x00, 0x80, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x04, 0x10, 0x0F,
+    0x08, 0x01, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x85, 0x4F,
+    0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x02, 0x4F,
+    0x18, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x90, 0x0F,
+    0x4C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x9F, 0xFF, 0xCF, 0x00, 0x80, 0x00, 0x0F, 0x48, 0x80, 0x00, 0x0F,
+    0x40, 0x80, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F, 0x24, 0x90, 0x10, 0x0F,
+    0x10, 0x90, 0x10, 0x0F, 0x00, 0x90, 0x10, 0x0F, 0x04, 0x90, 0x10, 0x0F,
+    0x00, 0x90, 0x10, 0x0F, 0x00, 0x90, 0x10, 0x0F, 0x00, 0x80, 0x22, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x6C, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x9F, 0xFF, 0xCF, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x10, 0x90, 0x10, 0x0F,
+    0x00, 0x90, 0x10, 0x0F, 0x04, 0x90, 0x10, 0x0F, 0x40, 0x90, 0x10, 0x0F,
+    0x48, 0x90, 0x10, 0x0F, 0x00, 0x90, 0x10, 0x0F, 0x00, 0x80, 0x22, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x6C, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x9F, 0xFF, 0xCF, 0x04, 0x80, 0x00, 0x0F, 0x0A, 0x80, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F, 0x08, 0x90, 0x10, 0x0F,
+    0x10, 0x90, 0x10, 0x0F, 0x08, 0x90, 0x10, 0x0F, 0x04, 0x90, 0x10, 0x0F,
+    0x00, 0x90, 0x10, 0x0F, 0x00, 0x90, 0x10, 0x0F, 0x00, 0x80, 0x22, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x6C, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0xBF, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x7F, 0xFF, 0x3F, 0x12, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x3F,
+    0x82, 0x00, 0x00, 0x3F, 0x92, 0x00, 0x00, 0x3F, 0x02, 0x40, 0x40, 0x3F,
+    0x02, 0x40, 0x40, 0x3F, 0x12, 0x40, 0x40, 0x3F, 0x82, 0x40, 0x40, 0x3F,
+    0x82, 0x40, 0x40, 0x3F, 0x92, 0x40, 0x40, 0x3F, 0x02, 0x00, 0x88, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x01, 0xB0, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x48, 0x80, 0x00, 0x0F,
+    0x40, 0x90, 0x00, 0x4F, 0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x10, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x4F,
+    0x00, 0xA0, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x3F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x04, 0x90, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x0F, 0x10, 0x80, 0x00, 0x0F,
+    0x24, 0x80, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x4F,
+    0x08, 0xA0, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x3F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x02, 0x80, 0x00, 0x0F,
+    0x00, 0x90, 0x00, 0x4F, 0x40, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x48, 0x80, 0x00, 0x0F, 0x24, 0x80, 0x00, 0x4F,
+    0x10, 0xA0, 0x00, 0x0F, 0x08, 0x40, 0x00, 0x3F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x80, 0x00, 0xBF, 0x82, 0x00, 0x00, 0x3F,
+    0x82, 0x40, 0x01, 0x3F, 0x12, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x12, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x01, 0x3F,
+    0x82, 0x80, 0x00, 0x3F, 0x11, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x07, 0x20, 0x40, 0x27, 0x00, 0x40, 0x07, 0x9F, 0x9F, 0xC7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x40, 0x07, 0x80, 0x40, 0x47, 0x80, 0x40, 0x07, 0x90, 0x40, 0x07,
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x97, 0x04, 0x01, 0x07, 0x41, 0x04, 0x27,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0xF0, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x1F, 0xFF, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x31, 0x03, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x40, 0x80, 0x0F,
+    0x10, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x04, 0x00, 0x0F,
+    0x20, 0x00, 0x02, 0x0F, 0x40, 0x00, 0x81, 0x0F, 0x08, 0x40, 0x00, 0x4F,
+    0x21, 0x00, 0x10, 0x2F, 0x01, 0x3F, 0xF0, 0x1F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0xCC, 0x07, 0x00, 0x04, 0x00, 0x87, 0x00, 0x10, 0x00, 0x47,
+    0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+    0x48, 0x08, 0x00, 0x07, 0x40, 0x90, 0x00, 0x07, 0x04, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x4F, 0x00, 0x10, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x17, 0x00, 0x02, 0x02, 0x07,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x08, 0x02, 0x07, 0x00, 0x01, 0xF0, 0x07,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0xCC, 0x07, 0x00, 0x04, 0x00, 0x87, 0x00, 0x10, 0x00, 0x47,
+    0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+    0x00, 0x08, 0x00, 0x07, 0x04, 0x90, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x4F, 0x24, 0x00, 0x00, 0x4F, 0x04, 0x10, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x07, 0x48, 0x80, 0x00, 0x17, 0x00, 0x02, 0x02, 0x07,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x08, 0x02, 0x07, 0x00, 0x01, 0xF0, 0x07,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0xCC, 0x07, 0x00, 0x04, 0x00, 0x87, 0x00, 0x10, 0x00, 0x47,
+    0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+    0x02, 0x08, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x48, 0x10, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x17, 0x08, 0x02, 0x02, 0x07,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x08, 0x02, 0x07, 0x00, 0x01, 0xF0, 0x07,
+    // 0xD5 'Õ'
+    0x00, 0x01, 0x98, 0x0F, 0x00, 0x08, 0x01, 0x0F, 0x00, 0x20, 0x00, 0x8F,
+    0x00, 0x40, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x04, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x20, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x00, 0x2F, 0x20, 0x04, 0x04, 0x0F,
+    0x00, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x10, 0x04, 0x0F, 0x00, 0x03, 0xE0, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x03, 0x30, 0x1F, 0x00, 0x10, 0x02, 0x1F, 0x00, 0x40, 0x01, 0x1F,
+    0x00, 0x80, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x08, 0x1F,
+    0x80, 0x20, 0x00, 0x1F, 0x82, 0x40, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x10, 0x40, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x82, 0x00, 0x00, 0x5F, 0x10, 0x08, 0x08, 0x1F,
+    0x01, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x20, 0x08, 0x1F, 0x00, 0x07, 0xC0, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x07, 0x20, 0x27, 0x40, 0x17, 0x00, 0x07, 0x02, 0x07, 0x10, 0x47,
+    0x00, 0x07, 0x10, 0x47, 0x20, 0x27, 0x45, 0x17, 0x08, 0x87, 0x10, 0x47,
+    0x00, 0x07,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x03, 0x00, 0x66, 0x13, 0x02, 0x00, 0x63, 0x08, 0x00, 0x03,
+    0x10, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x04, 0x83,
+    0x48, 0x08, 0x03, 0x00, 0x10, 0x07, 0x00, 0x20, 0x27, 0x00, 0x40, 0x27,
+    0x08, 0x80, 0x03, 0x01, 0x00, 0x03, 0x42, 0x00, 0x0B, 0x00, 0x81, 0x03,
+    0x20, 0x00, 0x13, 0x00, 0x00, 0x03, 0x20, 0x00, 0x43, 0x44, 0x01, 0x03,
+    0x40, 0xF8, 0x03, 0x00, 0x00, 0x03,
+    // 0xD9 'Ù'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x9F, 0xFE, 0x07, 0x00, 0x80, 0x00, 0x87,
+    0x04, 0xA0, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x20, 0x00, 0x07, 0x00, 0x80, 0x00, 0x87,
+    0x00, 0x9F, 0xFE, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x87, 0x00, 0x9F, 0xFC, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDA 'Ú'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x9F, 0xFE, 0x07, 0x00, 0x80, 0x00, 0x87,
+    0x00, 0xA0, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x04, 0x00, 0x00, 0x0F, 0x40, 0x20, 0x00, 0x07, 0x40, 0x80, 0x00, 0x87,
+    0x10, 0x9F, 0xFE, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x87, 0x00, 0x9F, 0xFC, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDB 'Û'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x04, 0x80, 0x00, 0x17, 0x0A, 0x9F, 0xFE, 0x07, 0x10, 0x80, 0x00, 0x87,
+    0x04, 0xA0, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x4F,
+    0x08, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x07, 0x00, 0x80, 0x00, 0x87,
+    0x00, 0x9F, 0xFE, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x87, 0x00, 0x9F, 0xFC, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDC 'Ü'
+    0x01, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x02, 0x00, 0x06, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x12, 0x00, 0x00, 0x5F, 0x82, 0x7F, 0xF8, 0x1F, 0x82, 0x00, 0x02, 0x1F,
+    0x92, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x50, 0x00, 0x00, 0x3F, 0x80, 0x80, 0x00, 0x1F, 0x82, 0x00, 0x02, 0x1F,
+    0x82, 0x7F, 0xF8, 0x5F, 0x22, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x02, 0x00, 0x02, 0x1F, 0x02, 0x7F, 0xF0, 0x1F, 0x02, 0x80, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xAA, 0x00, 0x0F, 0x8A, 0x00, 0x0F, 0x48, 0x04, 0x1F, 0x08, 0x00, 0x0F,
+    0x08, 0x91, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x02, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xF1, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xFD, 0x08, 0x00, 0x01,
+    0x80, 0x00, 0x05, 0x00, 0x44, 0x41, 0x00, 0x02, 0x01, 0x10, 0x00, 0x03,
+    0x8C, 0x60, 0x01, 0x80, 0x80, 0x51, 0x01, 0x08, 0x01, 0x02, 0x04, 0x01,
+    0x00, 0x02, 0x09, 0x00, 0x00, 0xE1,
+    // 0xE0 'à'
+    0x00, 0x00, 0x16, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x40, 0x00, 0x80, 0x7F, 0x00, 0x48, 0x18, 0x7F, 0x00, 0x00, 0x24, 0x7F,
+    0x02, 0x10, 0x04, 0x7F, 0x0A, 0x01, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x16, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x48, 0x18, 0x7F, 0x08, 0x00, 0x24, 0x7F,
+    0x00, 0x10, 0x04, 0x7F, 0x40, 0x01, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x10, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x82, 0x04, 0x40, 0x00, 0x10, 0x01, 0x00,
+    0x20, 0x90, 0x30, 0x08, 0x00, 0x48, 0x90, 0x20, 0x08, 0x90, 0x02, 0x02,
+    0x00, 0x00, 0x04, 0x20, 0x80, 0x02, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x82, 0x28, 0x40, 0x00, 0x40, 0x01, 0x00,
+    0x00, 0x90, 0x30, 0x10, 0x00, 0x48, 0x08, 0x20, 0x08, 0x20, 0x02, 0x02,
+    0x00, 0x00, 0x04, 0x40, 0x80, 0x02, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x59, 0x20, 0x01, 0x05, 0x00, 0x80, 0x01, 0x08, 0x02, 0x01,
+    0x01, 0x20, 0x61, 0x70, 0x00, 0x91, 0x00, 0x40, 0x11, 0x20, 0x04, 0x05,
+    0x00, 0x00, 0x09, 0x09, 0x00, 0x05, 0x00, 0x00, 0x01, 0x20, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x09,
+    // 0xE5 'å'
+    0x00, 0x00, 0x16, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x20, 0x00, 0x80, 0x7F, 0x40, 0x48, 0x18, 0x7F, 0x05, 0x00, 0x24, 0x7F,
+    0x21, 0x10, 0x04, 0x7F, 0x21, 0x01, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0x14, 0x7F, 0x10, 0x41, 0x7F, 0x22, 0x00, 0x7F, 0x02, 0x80, 0x7F,
+    0x48, 0x18, 0xFF, 0x00, 0x04, 0x7F, 0x10, 0x04, 0x7F, 0x01, 0x04, 0x7F,
+    0x00, 0x39, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x01, 0x7F,
+    0x00, 0x50, 0x7F, 0x40, 0x08, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x08, 0x04, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x81, 0x7F,
+    0x10, 0x82, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xE7 'ç'
+    0x02, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x03, 0xE0, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC0,
+    0x08, 0x00, 0x00, 0x02, 0x00, 0x38, 0x42, 0x00, 0x00, 0x20, 0x01, 0x00,
+    0x08, 0x04, 0x00,
+    // 0xE8 'è'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x01, 0x7F, 0x08, 0x44, 0x50, 0x7F, 0x44, 0x40, 0x48, 0x7F,
+    0x20, 0x10, 0x40, 0x7F, 0x00, 0x00, 0x40, 0xFF, 0x04, 0x08, 0x44, 0x7F,
+    0x00, 0x40, 0x44, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x20, 0x41, 0x7F,
+    0x00, 0x10, 0x42, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x44, 0x50, 0x7F, 0x04, 0x40, 0x48, 0x7F,
+    0x10, 0x10, 0x40, 0x7F, 0x00, 0x00, 0x40, 0xFF, 0x04, 0x08, 0x44, 0x7F,
+    0x48, 0x40, 0x44, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x20, 0x41, 0x7F,
+    0x00, 0x10, 0x42, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xEA 'ê'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x88, 0xA0, 0x40, 0x80, 0x90, 0x80, 0x20, 0x80, 0x80, 0x00, 0x81,
+    0x88, 0x10, 0x88, 0x04, 0x80, 0x88, 0x00, 0x00, 0x80, 0x0C, 0x40, 0x82,
+    0x00, 0x20, 0x84, 0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x08, 0x61, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x01, 0x11, 0x41, 0x01, 0x01, 0x21, 0x00, 0x41, 0x01, 0x00, 0x01, 0x03,
+    0x40, 0x21, 0x11, 0x01, 0x01, 0x11, 0x00, 0x01, 0x01, 0x00, 0x81, 0x05,
+    0x00, 0x41, 0x09, 0x00, 0x00, 0x01,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x02, 0x08, 0x40, 0x00, 0x44, 0x40, 0x00,
+    0x20, 0x40, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00,
+    0x10, 0x40, 0x00, 0x02, 0x40, 0x00, 0x04, 0x00, 0x00, 0x48, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xEE 'î'
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x05, 0x00, 0x80, 0x01, 0x40, 0x80, 0x01,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x00, 0x01, 0x44, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x0C, 0x00, 0x01,
+    // 0xEF 'ï'
+    0x50, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xF0 'ð'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x12, 0x87, 0xC0, 0x00, 0x90, 0x10, 0x04, 0x00, 0x08, 0x00, 0x00, 0x08,
+    0x00, 0x80, 0x08, 0x50, 0x80, 0x10, 0x08, 0x03, 0xC2, 0x40, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xC0,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x28, 0x00, 0x01, 0x40, 0xC0, 0x01, 0x00, 0x48, 0x09,
+    0x10, 0x10, 0x07, 0x48, 0x80, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x48, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xF2 'ò'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x01, 0x7F, 0x48, 0x03, 0xE0, 0x7F, 0x00, 0x48, 0x08, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x12, 0x00, 0x04, 0x7F, 0x0A, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x41, 0xE1, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x02, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x06, 0x20, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x03, 0xE0, 0x7F, 0x00, 0x48, 0x08, 0x7F,
+    0x0A, 0x00, 0x04, 0x7F, 0x22, 0x00, 0x04, 0x7F, 0x04, 0x00, 0x04, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x30, 0x41, 0xE1, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x02, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x06, 0x20, 0x7F,
+    // 0xF4 'ô'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x10, 0x07, 0xC0, 0x04, 0x90, 0x10, 0x08, 0x00, 0x08, 0x80, 0x00, 0x08,
+    0x80, 0x00, 0x08, 0x40, 0x00, 0x00, 0x20, 0x83, 0xC2, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x20, 0x00, 0x00, 0x0C, 0x40,
+    // 0xF5 'õ'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x40, 0x07, 0xC0, 0x10, 0x90, 0x10, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08,
+    0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x83, 0xC2, 0x48, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x20, 0x00, 0x00, 0x0C, 0x40,
+    // 0xF6 'ö'
+    0x00, 0x08, 0x61, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x08, 0x0F, 0x81, 0x01, 0x20, 0x21, 0x20, 0x00, 0x11, 0x00, 0x00, 0x11,
+    0x30, 0x00, 0x11, 0x00, 0x00, 0x01, 0x09, 0x07, 0x85, 0x00, 0x00, 0x01,
+    0x20, 0x80, 0x09, 0x00, 0x40, 0x01, 0x00, 0x18, 0x81,
+    // 0xF7 '÷'
+    0x02, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x15, 0x0B,
+    0x85, 0x43, 0x85, 0x43, 0x65, 0x33, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x02, 0x1A, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x01, 0x7F, 0x03, 0xC0, 0x7F, 0x40, 0x48, 0x7F, 0x10, 0x84, 0x7F,
+    0x11, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x0C, 0x00, 0x7F, 0x41, 0xF1, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x40, 0x00, 0x7F, 0x06, 0x20, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x10, 0x40, 0x00, 0x7F,
+    0x08, 0x4F, 0xE0, 0x7F, 0x44, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x30, 0x00, 0x7F, 0x04, 0x00, 0x01, 0x7F, 0x00, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x5F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x4F, 0xE0, 0x7F, 0x04, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x7F,
+    0x02, 0x30, 0x00, 0x7F, 0x04, 0x00, 0x01, 0x7F, 0x48, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x5F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xFB 'û'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x80, 0x04,
+    0x00, 0x80, 0x02, 0x08, 0x80, 0x00, 0x00, 0x9F, 0xC0, 0x40, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x80, 0x60, 0x00, 0x80, 0x00, 0x02, 0x44, 0x1F, 0xF0,
+    0x00, 0x80, 0x02, 0x0C, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xBF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x00, 0xC0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x3F, 0xE1, 0x01, 0x00, 0x09,
+    0x51, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01, 0x3F, 0x81, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0xC0, 0x01, 0x40, 0x00, 0x05, 0x00, 0x3F, 0xE1,
+    0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x7F, 0xE1,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xFE 'þ'
+    0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07, 0x01, 0x00, 0x12, 0x27,
+    0x01, 0x00, 0x10, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x04, 0x07, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x20, 0x07, 0x00, 0x0E, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x80, 0x00, 0x67, 0x01, 0x40, 0x00, 0x47, 0x01, 0x20, 0x00, 0x4F,
+    0x01, 0x08, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x0F, 0x09, 0x00, 0x40, 0x87,
+    0x01, 0x00, 0x10, 0x17, 0x51, 0x50, 0x06, 0x07, 0x01, 0x02, 0x00, 0x07,
+    0x20, 0x00, 0x40, 0x87, 0x00, 0x00, 0x80, 0x07, 0x08, 0x84, 0x08, 0x07,
+    0x01, 0x70, 0x20, 0x07, 0x71, 0x00, 0x80, 0x07, 0x01, 0x02, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x01, 0x01, 0x00, 0x1F, 0x04, 0x02, 0x00, 0x1F, 0x20, 0x22, 0x00, 0x1F,
+    0x01, 0x02, 0x00, 0x1F, 0x84, 0x02, 0x00, 0x1F, 0x01, 0x82, 0x00, 0x1F,
+    0x00, 0x32, 0x20, 0x1F, 0x40, 0x02, 0x03, 0x9F, 0x08, 0x00, 0xC0, 0x5F,
+    0x01, 0x00, 0x08, 0x1F, 0x00, 0x60, 0x02, 0x1F, 0x00, 0x08, 0x01, 0x1F,
+    0x00, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x105 'ą'
+    0x00, 0x16, 0x03, 0x00, 0x41, 0x03, 0x20, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x48, 0x18, 0x03, 0x00, 0x24, 0x03, 0x10, 0x04, 0x03, 0x01, 0x01, 0x03,
+    0x00, 0x02, 0x03, 0x40, 0x01, 0x03, 0x00, 0x00, 0x07, 0x20, 0x00, 0x23,
+    0x00, 0x00, 0x83, 0x00, 0x05, 0x03, 0x00, 0x02, 0x0B,
+    // 0x106 'Ć'
+    0x00, 0x00, 0xCE, 0x07, 0x00, 0x04, 0x00, 0x87, 0x00, 0x10, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x04, 0x17,
+    0x00, 0x08, 0x01, 0x07, 0x08, 0x90, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x0F, 0x24, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x18, 0x00, 0x07, 0x20, 0x80, 0x00, 0x87, 0x00, 0x02, 0x00, 0x97,
+    0x00, 0x4C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x107 'ć'
+    0x00, 0x02, 0x18, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x03, 0xE0, 0x7F, 0x04, 0x48, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x08, 0x00, 0x7F,
+    0x40, 0x02, 0x00, 0x7F, 0x00, 0x42, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F,
+    0x00, 0x08, 0x04, 0x7F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0xCE, 0x07, 0x00, 0x04, 0x00, 0x87, 0x00, 0x10, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x27, 0x20, 0x00, 0x00, 0x07, 0x40, 0x04, 0x04, 0x17,
+    0x40, 0x08, 0x01, 0x07, 0x20, 0x90, 0x00, 0x07, 0x12, 0x00, 0x00, 0x87,
+    0x02, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x40, 0x18, 0x00, 0x07, 0x00, 0x80, 0x00, 0x87, 0x00, 0x02, 0x00, 0x97,
+    0x00, 0x4C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x10D 'č'
+    0x00, 0x04, 0x30, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x90, 0x00, 0x02,
+    0x88, 0x07, 0xC0, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x10, 0x04, 0x00, 0x00, 0x84, 0x00, 0x00, 0x40, 0x02,
+    0x00, 0x10, 0x08,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x9F, 0xFF, 0xC7, 0x00, 0x80, 0x00, 0x07, 0x50, 0x80, 0x00, 0x07,
+    0x40, 0x80, 0x00, 0x07, 0x24, 0x80, 0x00, 0x07, 0x12, 0x80, 0x00, 0x07,
+    0x02, 0x80, 0x00, 0x47, 0x12, 0x80, 0x00, 0x07, 0x24, 0x90, 0x00, 0x07,
+    0x48, 0x80, 0x00, 0x17, 0x10, 0x00, 0x00, 0x97, 0x60, 0x04, 0x01, 0x07,
+    0x00, 0x41, 0x04, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0xF0, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    0x01, 0x0F, 0x81, 0x01, 0x20, 0x23, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x1E, 0x3F, 0xC1, 0x00, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x09, 0x80, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x20, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x9F, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x90, 0x10, 0x00, 0x1F,
+    0x90, 0x10, 0x01, 0x1F, 0x90, 0x10, 0x00, 0x1F, 0x90, 0x10, 0x08, 0x1F,
+    0x90, 0x10, 0x00, 0x1F, 0x90, 0x10, 0x01, 0x1F, 0x80, 0x22, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x6C, 0x02, 0x30, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x119 'ę'
+    0x02, 0x18, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03,
+    0x44, 0x50, 0x03, 0x40, 0x48, 0x03, 0x10, 0x40, 0x03, 0x00, 0x40, 0xC3,
+    0x08, 0x44, 0x07, 0x40, 0x44, 0x23, 0x00, 0x40, 0x93, 0x20, 0x41, 0x03,
+    0x10, 0x42, 0x03, 0x00, 0x00, 0x03,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x9F, 0xFF, 0xCF, 0x50, 0x80, 0x00, 0x0F, 0x08, 0x80, 0x00, 0x0F,
+    0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x02, 0x90, 0x10, 0x0F,
+    0x12, 0x90, 0x10, 0x0F, 0x20, 0x90, 0x10, 0x0F, 0x40, 0x90, 0x10, 0x0F,
+    0x10, 0x90, 0x10, 0x0F, 0x60, 0x90, 0x10, 0x0F, 0x00, 0x80, 0x22, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x6C, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x90, 0x00, 0x02,
+    0x88, 0x88, 0xA0, 0x04, 0x80, 0x90, 0x00, 0x20, 0x80, 0x20, 0x00, 0x81,
+    0x40, 0x10, 0x88, 0x90, 0x80, 0x88, 0x20, 0x00, 0x80, 0x00, 0x40, 0x82,
+    0x00, 0x20, 0x84, 0x00, 0x00, 0x00,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x80, 0x00, 0x0F,
+    0x04, 0x9F, 0xFF, 0xCF, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x24, 0x80, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x08, 0xA0, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x13A 'ĺ'
+    0x00, 0x40, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x07, 0x10, 0x20, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x49, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x03, 0x08, 0x00, 0x0B, 0x20, 0x00, 0x03, 0x27, 0xFF, 0xF3,
+    0x20, 0x00, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x28, 0x00, 0x03, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x3E, 0x00, 0x03, 0x80, 0x00, 0x03, 0x88, 0x00, 0x83, 0x60, 0x01, 0x03,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x03, 0x10, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x62, 0x00, 0x03, 0x82, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F, 0x20, 0x00, 0x2F, 0x80, 0x28, 0x0F,
+    0x9F, 0xCF, 0xCF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA1, 0x40, 0x0F, 0x40, 0x00, 0x0F,
+    0x02, 0x80, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x03, 0x20, 0x04, 0x07, 0x00, 0x0A, 0x03, 0x10, 0x12, 0x13,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0xA0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x8F, 0xFF, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x81, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x47, 0x04, 0x20, 0x40, 0x07,
+    0x00, 0x10, 0x00, 0x07, 0x10, 0x00, 0x08, 0x07, 0x24, 0x02, 0x00, 0x07,
+    0x04, 0x00, 0x01, 0x07, 0x40, 0x00, 0x40, 0x87, 0x48, 0x20, 0x00, 0x27,
+    0x00, 0x80, 0x08, 0x17, 0x00, 0x9F, 0xF8, 0x0F, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0xA0, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x24, 0x04,
+    0x0C, 0x08, 0x03, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x8F, 0xFF, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x50, 0x81, 0xFF, 0x87, 0x08, 0x00, 0x00, 0x47, 0x04, 0x20, 0x40, 0x07,
+    0x02, 0x10, 0x00, 0x07, 0x02, 0x00, 0x08, 0x07, 0x12, 0x02, 0x00, 0x07,
+    0x20, 0x00, 0x01, 0x07, 0x48, 0x00, 0x40, 0x87, 0x10, 0x20, 0x00, 0x27,
+    0x60, 0x80, 0x08, 0x17, 0x00, 0x9F, 0xF8, 0x0F, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0xA0, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0xA0, 0x00, 0x01, 0x10, 0xC0, 0x01, 0x08, 0x48, 0x09,
+    0x24, 0x10, 0x07, 0x00, 0x80, 0x01, 0x20, 0x00, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x152 'Œ'
+    0x00, 0xCC, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x70, 0x07, 0x02, 0x02, 0x07, 0x40, 0x00, 0x17, 0x00, 0x00, 0x87,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x47, 0x80, 0x00, 0x47, 0x80, 0x00, 0x47,
+    0x90, 0x00, 0x47, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x90, 0x10, 0x07, 0x90, 0x10, 0x07, 0x90, 0x10, 0x07,
+    0x90, 0x10, 0x07, 0x90, 0x10, 0x07, 0x88, 0x10, 0x07, 0x80, 0x62, 0x07,
+    0x80, 0x00, 0x07, 0x30, 0x02, 0x37, 0x00, 0x00, 0x07,
+    // 0x153 'œ'
+    0x02, 0x18, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F,
+    0x03, 0xE0, 0x7F, 0x48, 0x08, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x41, 0xE1, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x02, 0x7F, 0x20, 0x00, 0x7F, 0x06, 0x60, 0x7F, 0x40, 0x48, 0x7F,
+    0x00, 0x40, 0x7F, 0x10, 0x40, 0xFF, 0x00, 0x44, 0x7F, 0x06, 0x44, 0x7F,
+    0x40, 0x40, 0x7F, 0x00, 0x41, 0x7F, 0x10, 0x40, 0x7F, 0x03, 0x00, 0x7F,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x9F, 0xFF, 0xC7, 0x50, 0x80, 0x00, 0x07, 0x40, 0x80, 0x00, 0x07,
+    0x24, 0x80, 0x00, 0x07, 0x12, 0x80, 0x00, 0x07, 0x02, 0x80, 0x08, 0x47,
+    0x12, 0x80, 0x44, 0x07, 0x24, 0x80, 0x42, 0x07, 0x48, 0x80, 0x80, 0x07,
+    0x10, 0x87, 0x00, 0x47, 0x60, 0x00, 0x08, 0x27, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x40, 0x07, 0x00, 0x11, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0xA0, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x20, 0xC0, 0x01, 0x00, 0x00, 0x09,
+    0x04, 0x00, 0x01, 0x08, 0x80, 0x01, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x01,
+    0x00, 0xE0, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x01, 0xE7, 0x00, 0x10, 0x80, 0x17, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x21, 0x07, 0x00, 0x00, 0x00, 0x07, 0x08, 0x82, 0x00, 0x4F,
+    0x10, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x08, 0x4F, 0x24, 0x00, 0x80, 0x47,
+    0x40, 0x00, 0x00, 0x87, 0x00, 0x8C, 0x40, 0x17, 0x30, 0x82, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x08, 0x87, 0x00, 0x00, 0x00, 0x07,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x0E, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x00, 0x48, 0x00, 0x7F, 0x02, 0x10, 0x20, 0x7F,
+    0x22, 0x02, 0x00, 0x7F, 0x04, 0x10, 0x10, 0x7F, 0x08, 0x01, 0x00, 0x7F,
+    0x20, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x38, 0x44, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x01, 0xE7, 0x00, 0x10, 0x80, 0x17, 0x20, 0x00, 0x04, 0x07,
+    0x00, 0x40, 0x21, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00, 0x82, 0x00, 0x4F,
+    0x12, 0x01, 0x00, 0x4F, 0x02, 0x00, 0x08, 0x4F, 0x02, 0x00, 0x80, 0x47,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x8C, 0x40, 0x17, 0x00, 0x82, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x08, 0x87, 0x00, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x00, 0x1C, 0x40, 0x20, 0x02, 0x80, 0x40, 0x00, 0x80, 0x00, 0x80,
+    0x40, 0x90, 0x00, 0x00, 0x20, 0x40, 0x00, 0x04, 0x00, 0x44, 0x20, 0x20,
+    0x80, 0x02, 0x00, 0x20, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x70, 0x88,
+    0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x82, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x82, 0x00, 0x0F, 0x00, 0x90, 0x00, 0x0F, 0x50, 0x90, 0x00, 0x0F,
+    0x08, 0x90, 0x00, 0x0F, 0x04, 0x90, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x0F,
+    0x02, 0x80, 0x00, 0x0F, 0x12, 0x80, 0x00, 0x0F, 0x20, 0x80, 0x00, 0x0F,
+    0x48, 0x90, 0x00, 0x4F, 0x10, 0x90, 0x00, 0x4F, 0x60, 0x90, 0x00, 0x0F,
+    0x00, 0x90, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x82, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xF8,
+    0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0xE1,
+    0x00, 0x80, 0x00, 0x7E, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0xA0, 0x02,
+    0x00, 0x00, 0x08,
+    // 0x16E 'Ů'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x9F, 0xFE, 0x07, 0x00, 0x80, 0x00, 0x87,
+    0x00, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x0F, 0x84, 0x00, 0x00, 0x4F,
+    0x18, 0x00, 0x00, 0x0F, 0x02, 0x20, 0x00, 0x07, 0x20, 0x80, 0x00, 0x87,
+    0x00, 0x9F, 0xFE, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x87, 0x00, 0x9F, 0xFC, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x1C, 0x40, 0x00, 0x7F,
+    0x00, 0x4F, 0xE0, 0x7F, 0x19, 0x00, 0x00, 0xFF, 0x21, 0x00, 0x00, 0x7F,
+    0x21, 0x30, 0x00, 0x7F, 0x18, 0x00, 0x01, 0x7F, 0x42, 0x0F, 0xF8, 0x7F,
+    0x3C, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x5F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x08, 0x9F, 0xFE, 0x07, 0x10, 0x80, 0x00, 0x87,
+    0x24, 0xA0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x4F,
+    0x50, 0x00, 0x00, 0x0F, 0x04, 0x20, 0x00, 0x07, 0x12, 0x80, 0x00, 0x87,
+    0x24, 0x9F, 0xFE, 0x17, 0x40, 0x80, 0x00, 0x07, 0x88, 0x80, 0x00, 0x07,
+    0x10, 0x80, 0x00, 0x87, 0x00, 0x9F, 0xFC, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x10, 0x4F, 0xE0, 0x7F, 0x42, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x50, 0x30, 0x00, 0x7F, 0x04, 0x00, 0x01, 0x7F, 0x10, 0x0F, 0xF8, 0x7F,
+    0x02, 0x40, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x50, 0x40, 0x00, 0x7F,
+    0x00, 0x5F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x178 'Ÿ'
+    0x01, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x02, 0x40, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x02, 0x08, 0x00, 0x3F, 0x82, 0x02, 0x00, 0xBF,
+    0x82, 0x00, 0x00, 0x3F, 0x82, 0x40, 0x41, 0x3F, 0x12, 0x90, 0x00, 0x3F,
+    0x01, 0x04, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x02, 0x00, 0x3F,
+    0x80, 0x88, 0x7E, 0x3F, 0x82, 0x20, 0x01, 0x3F, 0x12, 0x02, 0x00, 0x3F,
+    0x02, 0x08, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x02, 0x40, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x7C, 0x00, 0x97, 0x00, 0x82, 0x00, 0x07,
+    0x00, 0x80, 0x04, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x90, 0x20, 0x07,
+    0x08, 0x90, 0x40, 0x87, 0x10, 0x90, 0x02, 0x07, 0x00, 0x82, 0x04, 0x07,
+    0x24, 0x80, 0x00, 0x07, 0x40, 0x80, 0x20, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x30, 0x81, 0x00, 0x07, 0x00, 0x80, 0x01, 0x07, 0x00, 0x08, 0x04, 0x07,
+    0x00, 0x50, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x3C, 0x01, 0x7F, 0x00, 0x42, 0x10, 0x7F,
+    0x00, 0x44, 0x20, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x41, 0x00, 0x7F,
+    0x12, 0x42, 0x0C, 0x7F, 0x02, 0x44, 0x04, 0x7F, 0x04, 0x40, 0x44, 0x7F,
+    0x48, 0x40, 0x84, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x10, 0x7F,
+    0x00, 0x48, 0x20, 0x7F, 0x00, 0x10, 0x1C, 0x7F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xF8, 0x01, 0x2F, 0x01, 0x04, 0x00, 0x0F,
+    0x01, 0x00, 0x08, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x20, 0x40, 0x0F,
+    0x41, 0x20, 0x81, 0x0F, 0x01, 0x20, 0x04, 0x0F, 0x01, 0x04, 0x08, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x71, 0x00, 0x40, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x02, 0x00, 0x0F, 0x01, 0x00, 0x02, 0x0F, 0x00, 0x10, 0x08, 0x0F,
+    0x00, 0xA0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x01, 0x00, 0xF0, 0x05, 0x01, 0x08, 0x41, 0x01, 0x10, 0x81,
+    0x01, 0x00, 0x01, 0x01, 0x04, 0x01, 0x81, 0x08, 0x31, 0x01, 0x10, 0x11,
+    0x81, 0x01, 0x11, 0x01, 0x02, 0x11, 0x01, 0x00, 0x01, 0x01, 0x00, 0x41,
+    0x01, 0x20, 0x81, 0x00, 0x40, 0x71,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x7C, 0x00, 0x97, 0x00, 0x82, 0x00, 0x07,
+    0x20, 0x80, 0x04, 0x07, 0x00, 0x80, 0x00, 0x07, 0x40, 0x90, 0x20, 0x07,
+    0x00, 0x90, 0x40, 0x87, 0x12, 0x90, 0x02, 0x07, 0x02, 0x82, 0x04, 0x07,
+    0x02, 0x80, 0x00, 0x07, 0x04, 0x80, 0x20, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x81, 0x00, 0x07, 0x00, 0x80, 0x01, 0x07, 0x00, 0x08, 0x04, 0x07,
+    0x00, 0x50, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x02, 0x40, 0x84, 0x20, 0x80, 0x88, 0x40,
+    0x88, 0x80, 0x00, 0x04, 0x82, 0x00, 0x00, 0x84, 0x18, 0x20, 0x88, 0x08,
+    0x40, 0x80, 0x88, 0x90, 0x81, 0x08, 0x20, 0x80, 0x00, 0x80, 0x80, 0x20,
+    0x00, 0x90, 0x40, 0x00, 0x20, 0x38,
+    // 0x3C0 'π'
+    0x0C, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x42, 0x00, 0x7F, 0x40, 0x02, 0x7F,
+    0x48, 0x30, 0x7F, 0x46, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x01, 0x7F,
+    0x47, 0x80, 0x7F, 0x48, 0x00, 0x7F, 0x48, 0x00, 0x7F, 0x4B, 0x86, 0x7F,
+    0x40, 0x01, 0x7F, 0x40, 0x00, 0x7F, 0x43, 0xE0, 0x7F, 0x48, 0x00, 0x7F,
+    0x48, 0x04, 0x7F, 0x08, 0x04, 0x7F, 0x60, 0x00, 0x7F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x06, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x06, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x02, 0x07, 0x00, 0x40, 0x07, 0x01, 0x03, 0x07,
+    0x04, 0x00, 0x47, 0x90, 0x10, 0x0F, 0x80, 0x00, 0x0F, 0x02, 0x00, 0x07,
+    0x00, 0x43, 0x07, 0x30, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x03, 0x07,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F,
+    // 0x2014 '—'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2018 '‘'
+    0x09, 0x7F, 0x20, 0xFF, 0x00, 0x7F, 0x9C, 0xFF, 0x41, 0x7F, 0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x41, 0xFF, 0x08, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x68, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x41, 0xBF, 0x08, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x68, 0x3F,
+    // 0x201B '‛'
+    0x48, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x1C, 0x7F, 0x41, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x09, 0x7F, 0x20, 0xFF, 0x00, 0x7F, 0x9C, 0xFF, 0x41, 0x7F, 0x00, 0x7F,
+    0x10, 0xFF, 0x40, 0x7F, 0x80, 0xFF, 0xA2, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x41, 0xFF, 0x08, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x68, 0x7F,
+    0x00, 0x7F, 0x22, 0x7F, 0x80, 0xFF, 0x81, 0x7F, 0x00, 0x7F, 0x10, 0x7F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x41, 0xBF, 0x08, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x68, 0x3F,
+    0x00, 0x3F, 0x22, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x10, 0x3F,
+    // 0x201F '‟'
+    0x48, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x1C, 0x7F, 0x41, 0xFF, 0x00, 0x7F,
+    0x04, 0x7F, 0x81, 0x7F, 0x80, 0xFF, 0x22, 0x7F, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x9C, 0x7F, 0x5F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xBD, 0x0F, 0xDF, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x03, 0x00, 0x84, 0x03, 0x00, 0x04, 0x83, 0x00, 0x00, 0x83,
+    0x04, 0x00, 0x03, 0xBD, 0x78, 0xE3, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xBD, 0x78, 0x73, 0x04, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x04, 0x83,
+    0x00, 0x84, 0x83, 0x00, 0x00, 0x03,
+    // 0x2022 '•'
+    0x29, 0x01, 0x03, 0x03, 0x01, 0x45, 0x01,
+    // 0x2026 '…'
+    0x57, 0x87, 0x0F, 0x07, 0x97, 0x07, 0x07, 0x07, 0x07, 0x27, 0x87, 0x0F,
+    0x07, 0x87, 0x27, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x87, 0x77,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x08, 0x2F,
+    0x10, 0x0F, 0x00, 0x6F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x40, 0x2F, 0x00, 0x8F, 0x01, 0x2F, 0x44, 0x0F, 0x20, 0x0F, 0x00, 0x8F,
+    0x01, 0x0F, 0x06, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x03, 0x00, 0x13, 0x20, 0x03, 0x00, 0x07, 0x48, 0x23, 0x10, 0x13,
+    0x10, 0x13, 0x00, 0x07, 0x47, 0xC7, 0x00, 0x03, 0x20, 0x13, 0x0C, 0x43,
+    // 0x2074 '⁴'
+    0x00, 0x03, 0x00, 0x83, 0x00, 0x03, 0x00, 0x03, 0x09, 0x03, 0x02, 0x03,
+    0x00, 0x03, 0x40, 0x03, 0x00, 0x03, 0x7F, 0x9F, 0x00, 0x03, 0x00, 0x43,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x0F, 0x82, 0x27, 0x82, 0x27, 0x90, 0x27, 0x88, 0x0F,
+    0x80, 0x8F, 0x80, 0x07, 0x80, 0x07, 0x41, 0xC7,
+    // 0x2076 '⁶'
+    0x01, 0xC3, 0x00, 0x03, 0x10, 0x03, 0x00, 0xC7, 0x01, 0x13, 0x4D, 0x13,
+    0x04, 0x13, 0x10, 0x07, 0x00, 0x03, 0x40, 0x03, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x00, 0x07, 0x88, 0x07, 0x88, 0x07, 0x80, 0x8F, 0x82, 0x07, 0x80, 0x1F,
+    0x90, 0x87, 0x82, 0x07, 0x88, 0x07, 0x90, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x73, 0x00, 0x83, 0x01, 0x07, 0x40, 0x53, 0x04, 0x83, 0x00, 0x83,
+    0x04, 0x13, 0x40, 0x07, 0x03, 0x03, 0x14, 0x83, 0x00, 0x03,
+    // 0x2079 '⁹'
+    0x0E, 0x03, 0x20, 0x07, 0x40, 0x03, 0x0C, 0x13, 0x10, 0x07, 0x01, 0x47,
+    0x01, 0x03, 0x40, 0x03, 0x00, 0x03, 0x10, 0x43, 0x00, 0x03,
+    // 0x2080 '₀'
+    0x00, 0x03, 0x10, 0x23, 0x40, 0x03, 0x00, 0x0B, 0x90, 0x43, 0x20, 0x23,
+    0x20, 0x23, 0x00, 0x03, 0x8F, 0x8B, 0x00, 0x03, 0x40, 0x23, 0x18, 0x83,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x0F, 0x28, 0x07, 0x08, 0x17, 0x00, 0x07, 0x40, 0x07,
+    0x40, 0x07, 0x20, 0x17, 0x00, 0x17, 0x00, 0x0B,
+    // 0x2082 '₂'
+    0x10, 0x37, 0x48, 0x0F, 0x00, 0x0F, 0x98, 0x0F, 0x20, 0x0F, 0x20, 0x0F,
+    0x18, 0x8F, 0x81, 0x0F, 0x02, 0x0F, 0x28, 0x0F, 0x00, 0x27,
+    // 0x2083 '₃'
+    0x00, 0x03, 0x40, 0x03, 0x10, 0x03, 0xA5, 0x23, 0x00, 0x23, 0x01, 0x03,
+    0x10, 0x8B, 0x80, 0x03, 0x02, 0x03, 0x31, 0x43,
+    // 0x2084 '₄'
+    0x00, 0x03, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x12, 0x03, 0x24, 0x03,
+    0x08, 0x03, 0x80, 0x03, 0x80, 0x03, 0xFF, 0x1B, 0x00, 0x03, 0x00, 0x83,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x00, 0x0B, 0x82, 0x03, 0x82, 0x03, 0x90, 0x23, 0x88, 0x03,
+    0x80, 0x8B, 0x80, 0x03, 0x80, 0x03, 0x41, 0xC3,
+    // 0x2086 '₆'
+    0x03, 0xC3, 0x08, 0x13, 0x00, 0x03, 0x01, 0x8B, 0x02, 0x23, 0x92, 0x03,
+    0x80, 0x23, 0x20, 0x0B, 0x04, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x2087 '₇'
+    0x00, 0x03, 0x88, 0x03, 0x80, 0x03, 0x80, 0x83, 0x82, 0x03, 0x84, 0x1B,
+    0x90, 0x83, 0x82, 0x03, 0x88, 0x03, 0x90, 0x03, 0x00, 0x03,
+    // 0x2088 '₈'
+    0x00, 0xE3, 0x01, 0x03, 0x02, 0x0B, 0x80, 0xA3, 0x09, 0x03, 0x01, 0x03,
+    0x08, 0x83, 0x80, 0x0B, 0x04, 0x03, 0x29, 0x03, 0x00, 0x03,
+    // 0x2089 '₉'
+    0x1C, 0x03, 0x40, 0x0B, 0x00, 0x03, 0x98, 0x23, 0x20, 0x83, 0x22, 0xCB,
+    0x82, 0x03, 0x80, 0x03, 0x00, 0x03, 0x20, 0x83, 0x00, 0x03,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x08, 0x07, 0x00, 0x14, 0x07, 0x00, 0x14, 0x07, 0x03, 0x01, 0x07,
+    0x00, 0x00, 0x47, 0x10, 0x00, 0x27, 0x00, 0x20, 0x07, 0x02, 0x14, 0x17,
+    0x40, 0x14, 0x07, 0x00, 0x14, 0x07, 0x10, 0x14, 0x07, 0x10, 0x18, 0x4F,
+    0x00, 0x80, 0x47, 0x10, 0x00, 0x07, 0x02, 0x00, 0x07, 0x02, 0x00, 0x17,
+    0x44, 0x00, 0xA7, 0x00, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x00, 0x3F, 0x90, 0x3F, 0x80, 0xBF, 0x9F, 0x3F, 0x80, 0x3F,
+    0x9F, 0x3F, 0x80, 0xBF, 0xB0, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0xBF,
+    0xBE, 0x3F, 0x80, 0x3F, 0x88, 0xFF, 0x42, 0x3F, 0x08, 0x3F, 0x09, 0x3F,
+    0x24, 0x3F, 0x8E, 0xBF, 0x80, 0x3F, 0xBC, 0x3F, 0x40, 0xBF, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x01, 0x10, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x11, 0x00, 0x04, 0x43, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x41, 0x00, 0x21, 0x01, 0x00, 0x84, 0x01, 0x02, 0x10, 0x01,
+    0x08, 0x40, 0x01, 0x20, 0x00, 0x01, 0x02, 0x30, 0x19, 0x08, 0x48, 0x01,
+    0x60, 0x11, 0x01, 0x00, 0x80, 0x01, 0x00, 0xA5, 0x21, 0x00, 0x88, 0x01,
+    0x00, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x81,
+    // 0x2154 '⅔'
+    0x08, 0x08, 0x01, 0x00, 0x10, 0x01, 0x22, 0x20, 0x01, 0x04, 0x40, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x10, 0x01, 0x0E, 0x10, 0x01, 0x00, 0x10, 0x01,
+    0x20, 0x10, 0x11, 0x12, 0x10, 0x03, 0x00, 0x08, 0x85, 0x00, 0x02, 0x11,
+    0x00, 0x00, 0x41, 0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x01, 0x08, 0x01,
+    0x04, 0x20, 0x01, 0x10, 0x80, 0x01, 0x40, 0x30, 0x19, 0x04, 0x48, 0x01,
+    0x50, 0x11, 0x01, 0x00, 0x80, 0x01, 0x00, 0xA5, 0x21, 0x00, 0x88, 0x01,
+    0x00, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x81,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x01, 0x10, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x11, 0x00, 0x04, 0x03, 0x00, 0x00, 0x85, 0x00, 0x02, 0x11,
+    0x00, 0x08, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x04, 0x20, 0x01, 0x10, 0x80, 0x01, 0x42, 0x18, 0x91, 0x00, 0x01, 0x09,
+    0x50, 0x00, 0x01, 0x00, 0x18, 0x81, 0x00, 0xA0, 0x15, 0x00, 0x84, 0x11,
+    0x00, 0x98, 0x61, 0x00, 0x02, 0x01, 0x00, 0x45, 0x01, 0x00, 0x10, 0xE1,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x01, 0x04, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x02, 0x01, 0x02, 0x10, 0x01, 0x00, 0x60, 0x01, 0x00, 0x04, 0x09,
+    0x22, 0x00, 0x23, 0x08, 0x50, 0x03, 0x00, 0x01, 0x09, 0x00, 0x04, 0x21,
+    0x00, 0x00, 0x81, 0x00, 0x02, 0x01, 0x00, 0x80, 0x01, 0x02, 0x10, 0x01,
+    0x08, 0x40, 0x01, 0x21, 0x00, 0x01, 0x00, 0x18, 0x91, 0x08, 0x01, 0x09,
+    0x20, 0x00, 0x01, 0x00, 0x18, 0x81, 0x00, 0xA0, 0x15, 0x00, 0x84, 0x11,
+    0x00, 0x98, 0x61, 0x00, 0x02, 0x01, 0x00, 0x45, 0x01, 0x00, 0x10, 0xE1,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x20, 0x02, 0x01, 0x00, 0x02, 0x01,
+    0x04, 0x82, 0x01, 0x08, 0x90, 0x01, 0x0A, 0x60, 0x01, 0x08, 0x04, 0x01,
+    0x09, 0x08, 0x23, 0x30, 0xE0, 0x81, 0x00, 0x00, 0x01, 0x00, 0x04, 0x21,
+    0x00, 0x10, 0x81, 0x00, 0x42, 0x01, 0x01, 0x08, 0x01, 0x04, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x04, 0x18, 0x91, 0x10, 0x01, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x18, 0x81, 0x00, 0xA0, 0x15, 0x00, 0x84, 0x11,
+    0x00, 0x98, 0x61, 0x00, 0x02, 0x01, 0x00, 0x45, 0x01, 0x00, 0x10, 0xE1,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08, 0x20, 0x01,
+    0x08, 0x82, 0x01, 0x0A, 0x04, 0x01, 0x0C, 0x20, 0x01, 0x00, 0x00, 0x23,
+    0x02, 0x00, 0x81, 0x00, 0x00, 0x09, 0x00, 0x04, 0x21, 0x00, 0x10, 0x81,
+    0x00, 0x42, 0x01, 0x01, 0x08, 0x01, 0x04, 0x20, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x04, 0x00, 0x01, 0x10, 0x18, 0x91, 0x00, 0x01, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x18, 0x81, 0x00, 0xA0, 0x15, 0x00, 0x84, 0x11,
+    0x00, 0x98, 0x61, 0x00, 0x02, 0x01, 0x00, 0x45, 0x01, 0x00, 0x10, 0xE1,
+    // 0x2190 '←'
+    0x02, 0x07, 0x00, 0x07, 0x10, 0x07, 0x20, 0x07, 0x40, 0x07, 0x81, 0x07,
+    0x01, 0x57, 0x21, 0x27, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x06, 0x00, 0x1F, 0x09, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x24, 0x00, 0x1F, 0x47, 0xFF, 0xDF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x47, 0xFF, 0xDF, 0x24, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x09, 0x00, 0x1F,
+    0x06, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x07, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x01, 0x07, 0x21, 0x27, 0x01, 0x47,
+    0x81, 0x07, 0x40, 0x07, 0x20, 0x07, 0x10, 0x07, 0x00, 0x07, 0x02, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x1F, 0x7F, 0xFC, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x7F, 0xFC, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x06, 0x07, 0x08, 0x07, 0x10, 0x07, 0x20, 0x07, 0x49, 0x07, 0x11, 0x07,
+    0x01, 0x47, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x47,
+    0x11, 0x07, 0x49, 0x07, 0x20, 0x07, 0x10, 0x07, 0x08, 0x07, 0x06, 0x07,
+    // 0x2195 '↕'
+    0x04, 0x04, 0x1F, 0x02, 0x02, 0x1F, 0x02, 0x01, 0x1F, 0x04, 0x04, 0x9F,
+    0x0F, 0xFC, 0x5F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x0F, 0xFC, 0x5F,
+    0x04, 0x04, 0x9F, 0x02, 0x01, 0x1F, 0x02, 0x02, 0x1F, 0x04, 0x04, 0x1F,
+    // 0x21D0 '⇐'
+    0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x09, 0x00, 0x10, 0x40, 0x20, 0x40,
+    0x48, 0x50, 0x50, 0x51, 0x20, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x06, 0x70,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x3F, 0x02, 0x80, 0x3F, 0x04, 0x80, 0x3F, 0x09, 0x00, 0x3F,
+    0x12, 0x07, 0xFF, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x10, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x12, 0x07, 0xFF,
+    0x09, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x06, 0x70, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x20, 0x50, 0x50, 0x51, 0x48, 0x50,
+    0x20, 0x40, 0x10, 0x40, 0x09, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x80,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x7C, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x78, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D4 '⇔'
+    0x03, 0x01, 0x04, 0x01, 0x08, 0x01, 0x12, 0x01, 0x20, 0x81, 0x40, 0x85,
+    0x18, 0xA5, 0x28, 0x89, 0x08, 0x81, 0x08, 0x81, 0x28, 0x89, 0x18, 0xA5,
+    0x40, 0x81, 0x20, 0x81, 0x12, 0x01, 0x08, 0x01, 0x04, 0x01, 0x03, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x30, 0x00, 0x01,
+    0x50, 0x03, 0xC1, 0x00, 0x80, 0x11, 0x80, 0x00, 0x11, 0xA1, 0x00, 0x01,
+    0x01, 0x00, 0x25, 0x91, 0x00, 0x81, 0x86, 0x1C, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x41, 0x10, 0x02, 0x01, 0x03, 0xE0, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x8F, 0x00, 0x04, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x40, 0x8F, 0x02, 0x02, 0x4F, 0x08, 0x10, 0x4F, 0x00, 0x80, 0x4F,
+    0x02, 0x00, 0x4F, 0x84, 0x00, 0x4F, 0x00, 0x80, 0x4F, 0x00, 0x10, 0x4F,
+    0x20, 0x02, 0x4F, 0x04, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x3F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x9F, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x9F, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x01, 0x7F, 0x08, 0x00, 0x10, 0x7F,
+    0x80, 0x00, 0x20, 0x7F, 0x81, 0x00, 0x00, 0x7F, 0x80, 0x01, 0x08, 0x7F,
+    0x80, 0x22, 0x10, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x82, 0x00, 0x00, 0x7F,
+    0x80, 0x01, 0x00, 0x7F, 0x80, 0x42, 0x00, 0x7F, 0x80, 0x10, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F, 0x84, 0x00, 0x10, 0x7F,
+    0x82, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x40, 0xFF, 0x00, 0x00, 0x3C, 0x7F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x0C, 0x1F,
+    0x00, 0x08, 0x00, 0x9F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x80, 0x5F, 0x00, 0x04, 0x06, 0x1F,
+    0x00, 0x60, 0x20, 0x1F, 0x02, 0x01, 0x00, 0x1F, 0x30, 0x08, 0x00, 0x1F,
+    0x80, 0x40, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x1E, 0x1F, 0x40, 0x1F, 0x00, 0x5F, 0x90, 0x1F, 0x01, 0x1F, 0x80, 0x1F,
+    0x02, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x4C, 0x1F, 0x12, 0x5F,
+    0x80, 0x1F, 0x00, 0x1F, 0x8C, 0x5F, 0x00, 0x1F, 0x21, 0x1F, 0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x80, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x0C, 0x61, 0x00, 0x11, 0x00, 0x19, 0x00, 0x01, 0x00, 0x05, 0x03, 0x01,
+    0x00, 0x11, 0x00, 0x91, 0x22, 0x11, 0x40, 0x11, 0x10, 0x11, 0x00, 0x11,
+    0x00, 0x11,
+    // 0x2264 '≤'
+    0x02, 0x01, 0xFF, 0x01, 0x02, 0x7F, 0x00, 0x02, 0x7F, 0x08, 0x82, 0x7F,
+    0x00, 0x02, 0x7F, 0x10, 0x02, 0x7F, 0x05, 0x02, 0x7F, 0x20, 0x02, 0x7F,
+    0x08, 0x82, 0x7F, 0x40, 0x02, 0x7F, 0x10, 0x4A, 0x7F, 0x80, 0x0A, 0x7F,
+    0x20, 0x22, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0xFF, 0x40, 0x09, 0x3F, 0x40, 0x21, 0x3F, 0x08, 0x01, 0x3F,
+    0x20, 0x01, 0x3F, 0x04, 0x01, 0x3F, 0x10, 0x01, 0x3F, 0x02, 0x81, 0x3F,
+    0x09, 0x21, 0x3F, 0x00, 0x01, 0x3F, 0x04, 0x41, 0x3F, 0x00, 0x01, 0x3F,
+    0x02, 0x81, 0x3F,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly28BoldColOffsets[] PROGMEM = {
+    0x0, 0x1C, 0x31, 0x45, 0x7B, 0xB3, 0xFE, 0x143, 0x14D, 0x171, 0x199, 0x1AF,
+    0x1C9, 0x1D7, 0x1E1, 0x1E7, 0x211, 0x244, 0x26B, 0x298, 0x2C5, 0x2F8, 0x322, 0x34F,
+    0x37C, 0x3A9, 0x3D6, 0x3E2, 0x3F7, 0x411, 0x42B, 0x445, 0x469, 0x4D1, 0x513, 0x549,
+    0x57C, 0x5BB, 0x5F1, 0x621, 0x65A, 0x6A2, 0x6C3, 0x6F7, 0x739, 0x76F, 0x7BD, 0x802,
+    0x83E, 0x871, 0x8C9, 0x908, 0x935, 0x971, 0x9B6, 0x9F8, 0xA55, 0xA97, 0xAD3, 0xB06,
+    0xB26, 0xB50, 0xB6C, 0xB8A, 0xB98, 0xB9F, 0xBCC, 0xC02, 0xC29, 0xC5C, 0xC86, 0xCB3,
+    0xCE6, 0xD1F, 0xD3D, 0xD65, 0xD9B, 0xDB9, 0xDF1, 0xE17, 0xE44, 0xE77, 0xEA7, 0xEC1,
+    0xEE8, 0xF0F, 0xF35, 0xF5B, 0xF8D, 0xFB1, 0xFEA, 0x1006, 0x102E, 0x1042, 0x106A, 0x1078,
+    0x108A, 0x10C6, 0x10F9, 0x1119, 0x1152, 0x1179, 0x11BB, 0x11D1, 0x11F1, 0x1211, 0x1227, 0x124E,
+    0x1264, 0x1278, 0x12AE, 0x12DE, 0x12E4, 0x12F8, 0x130E, 0x132C, 0x1383, 0x13DA, 0x1431, 0x1452,
+    0x14AA, 0x1502, 0x155A, 0x15B2, 0x160A, 0x1662, 0x16B6, 0x16FA, 0x1742, 0x178A, 0x17D2, 0x181A,
+    0x1846, 0x1872, 0x189E, 0x18CE, 0x190D, 0x1969, 0x19B9, 0x1A09, 0x1A59, 0x1AA9, 0x1AF9, 0x1B13,
+    0x1B55, 0x1BB1, 0x1C0D, 0x1C69, 0x1CC5, 0x1CFB, 0x1D31, 0x1D6D, 0x1DA9, 0x1DD6, 0x1E03, 0x1E30,
+    0x1E6C, 0x1EAE, 0x1ED5, 0x1F0D, 0x1F45, 0x1F6F, 0x1F99, 0x1FB7, 0x1FD5, 0x1FF3, 0x2014, 0x2041,
+    0x207A, 0x20B6, 0x20F2, 0x211F, 0x214C, 0x2179, 0x2193, 0x21C6, 0x2212, 0x225E, 0x2297, 0x22D0,
+    0x2314, 0x2360, 0x23B8, 0x23E5, 0x2429, 0x245D, 0x24A1, 0x24C8, 0x251C, 0x2558, 0x25A0, 0x25CA,
+    0x2612, 0x263C, 0x2684, 0x26AC, 0x26E2, 0x2709, 0x2742, 0x2763, 0x27BF, 0x27F8, 0x2854, 0x288D,
+    0x28DE, 0x2926, 0x297A, 0x29A1, 0x29DD, 0x2A11, 0x2A4D, 0x2A74, 0x2AC4, 0x2AEB, 0x2B47, 0x2B93,
+    0x2BEF, 0x2C3B, 0x2C8B, 0x2CCF, 0x2D07, 0x2D4B, 0x2D75, 0x2DB9, 0x2DE3, 0x2E1C, 0x2E5B, 0x2E69,
+    0x2E85, 0x2E91, 0x2E9D, 0x2EA9, 0x2EB5, 0x2ECB, 0x2EE3, 0x2EFB, 0x2F11, 0x2F3B, 0x2F65, 0x2F6C,
+    0x2F84, 0x2F96, 0x2FA6, 0x2FBE, 0x2FD6, 0x2FEA, 0x3000, 0x3016, 0x302C, 0x3042, 0x305A, 0x306E,
+    0x3084, 0x3098, 0x30B0, 0x30C4, 0x30DA, 0x30F0, 0x3106, 0x311C, 0x3140, 0x3164, 0x319A, 0x31BE,
+    0x31E2, 0x3206, 0x3236, 0x328A, 0x32DE, 0x3332, 0x3386, 0x33DA, 0x342E, 0x3452, 0x347C, 0x34A0,
+    0x34CA, 0x34EE, 0x3512, 0x3536, 0x3566, 0x358A, 0x35BA, 0x35DE, 0x360B, 0x3644, 0x36A0, 0x36E8,
+    0x3734, 0x3758, 0x3798, 0x37B2, 0x37D9, 0x3800, 0x3824, 0x3848, 0x386C, 0x3890, 0x38B4, 0x38D8,
+    0x38FC, 0x3920, 0x3944, 0x3968, 0x398C, 0x39B0, 0x39D4, 0x39F8, 0x3A1C, 0x3A40, 0x3A64, 0x3A88,
+    0x3AAC, 0x3AD0, 0x3AF4
+};
+
+
 const SimpleGFXfont Bookerly28Bold PROGMEM = {Bookerly28BoldBitmaps, Bookerly28BoldBitmaps_lsb, Bookerly28BoldBitmaps_msb, Bookerly28BoldGlyphs,
-    315, 30};
+    315, 30,
+    nullptr, 0, FontStyle::REGULAR, Bookerly28BoldGlyphIndexLatin1, Bookerly28BoldGlyphRanges, 13,
+    Bookerly28BoldBitmapsCol, Bookerly28BoldBitmapsCol_lsb, Bookerly28BoldBitmapsCol_msb, Bookerly28BoldColOffsets};
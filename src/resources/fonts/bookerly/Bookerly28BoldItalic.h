@@ -5856,5 +5856,5292 @@ const SimpleGFXglyph Bookerly28BoldItalicGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly28BoldItalicGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly28BoldItalicGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly28BoldItalicBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFE, 0x00, 0x87, 0xC0, 0x01, 0x87,
+    0x80, 0x03, 0xCF, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xFF, 0xBF, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x87, 0xFF, 0xFF, 0xBF,
+    0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xF1, 0xC6, 0x7F, 0xF1, 0xC0, 0x7F,
+    0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xC7, 0xFF,
+    0x01, 0xC6, 0x7F, 0xF1, 0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
+    0x00, 0x07, 0xFF, 0x00, 0xC7, 0xFF, 0x01, 0xC7, 0xFF, 0xF1, 0xE7, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFE, 0x0F, 0xC1, 0xCF, 0xFC, 0x07, 0xF0, 0x0F, 0xF8, 0x03, 0xE0, 0x1F,
+    0xF8, 0xC0, 0x00, 0xFF, 0xF9, 0xE0, 0x01, 0xFF, 0xF1, 0x00, 0xF1, 0xFF,
+    0xF0, 0x00, 0x61, 0xFF, 0x80, 0x78, 0x03, 0xFF, 0x80, 0xF8, 0x03, 0xFF,
+    0xF8, 0x3C, 0x0F, 0xFF, 0xF8, 0x3F, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x07, 0xFF,
+    0xC3, 0xE3, 0xF7, 0xCF, 0xE7, 0xE3, 0xCF, 0xC7, 0xC1, 0xC7, 0x07, 0x87,
+    0xC0, 0x0E, 0x0F, 0xC0, 0x1C, 0x3F, 0xE0, 0x78, 0x7F, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0x1F, 0xF8, 0x38, 0x07,
+    0xF0, 0x70, 0x07, 0xE1, 0xE0, 0x03, 0x83, 0xC3, 0xE3, 0x87, 0xC7, 0xE3,
+    0x9F, 0xCF, 0xC7, 0xFF, 0xC7, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07,
+    0xFF, 0xC3, 0x87, 0xFC, 0x0F, 0xC7, 0xE0, 0x07, 0xC7, 0xC0, 0x01, 0xE7,
+    0xC0, 0x00, 0xC7, 0x8F, 0x20, 0x07, 0x9E, 0x38, 0x07, 0x9E, 0x7E, 0x0F,
+    0x98, 0xEF, 0x0F, 0x80, 0xCF, 0x07, 0x81, 0x8C, 0x07, 0xC3, 0x80, 0x03,
+    0xFF, 0x80, 0xE3, 0xFF, 0x01, 0xE3, 0xFF, 0x1F, 0xE3, 0xFF, 0x1F, 0xF3,
+    0xFE, 0x3F, 0xF3, 0xFE, 0x3F, 0xF7, 0xFE, 0x7F, 0xFF,
+    // 0x27 '''
+    0xFF, 0xBF, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x0F, 0xF0, 0x7F, 0xFF, 0x0F,
+    0xE0, 0xFF, 0xFF, 0x8F, 0xC3, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x1F, 0xDF, 0xFF, 0xFE, 0x3F,
+    0x8F, 0xFF, 0xF8, 0x3F, 0x83, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xCC, 0xFF, 0x84, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F,
+    0x00, 0x3F, 0x93, 0x3F, 0xF1, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    // 0x2B '+'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF,
+    // 0x2C ','
+    0xFE, 0xFF, 0xFC, 0x7F, 0xB8, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x03, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2D '-'
+    0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F,
+    // 0x2E '.'
+    0xDF, 0x8F, 0x07, 0x0F, 0x1F,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF,
+    0x81, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F, 0xE0, 0x7F, 0x0F, 0xC3, 0xFF, 0x8F, 0x87, 0xFF, 0x8F,
+    0x8F, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F, 0x8F, 0xFE, 0x1F, 0x8F, 0xF8, 0x1F,
+    0x83, 0xC0, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xC0, 0x03, 0xFF,
+    0xF0, 0x1F, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xC7, 0xFF, 0x8F,
+    0xC7, 0xF8, 0x0F, 0xC7, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x0F, 0xCF, 0x81, 0xFF, 0xCF, 0xDF, 0xFF, 0xFF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xF3, 0xFE, 0x0F,
+    0xE1, 0xFC, 0x0F, 0xC1, 0xF8, 0x0F, 0x87, 0xF0, 0x8F, 0x8F, 0xE1, 0x8F,
+    0x8F, 0xC1, 0x8F, 0x8F, 0x83, 0x8F, 0x8F, 0x07, 0x8F, 0x8E, 0x0F, 0x8F,
+    0x80, 0x0F, 0x8F, 0x80, 0x1F, 0x8F, 0xC0, 0x7F, 0xBF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xF3, 0xFF, 0x8F,
+    0xE1, 0xFF, 0x8F, 0xC1, 0xCF, 0x8F, 0x87, 0x8F, 0x8F, 0x8F, 0x8F, 0x0F,
+    0x8F, 0x8F, 0x0F, 0x8F, 0x0E, 0x1F, 0x8E, 0x00, 0x1F, 0x8C, 0x00, 0x3F,
+    0x80, 0x00, 0x7F, 0x80, 0x60, 0xFF, 0xC0, 0xF3, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x10, 0xFF, 0xFC, 0x30, 0xFF,
+    0xF8, 0x70, 0x8F, 0xF0, 0xF0, 0x0F, 0xE1, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+    0x80, 0x00, 0xFF, 0x80, 0x10, 0xFF, 0x83, 0xF0, 0xFF, 0xBF, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFC, 0x3F, 0x8F,
+    0xE0, 0x3F, 0x8F, 0x80, 0x3F, 0x8F, 0x80, 0x3F, 0x0F, 0x82, 0x1E, 0x1F,
+    0x8E, 0x1C, 0x1F, 0x8E, 0x00, 0x3F, 0x8F, 0x00, 0x3F, 0x8F, 0x00, 0x7F,
+    0x8F, 0xC0, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
+    0xF8, 0x0F, 0x0F, 0xF0, 0x1F, 0x8F, 0xE0, 0x1F, 0x8F, 0xC1, 0x1F, 0x8F,
+    0xC3, 0x1F, 0x8F, 0x87, 0x0E, 0x0F, 0x87, 0x00, 0x1F, 0x8F, 0x00, 0x3F,
+    0x8F, 0x80, 0x7F, 0x9F, 0xC0, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xF1, 0xFF, 0x8F, 0x81, 0xFE, 0x0F, 0x81, 0xF8, 0x0F, 0x83, 0xF0, 0x0F,
+    0x8F, 0xE0, 0x3F, 0x8F, 0x80, 0xFF, 0x8F, 0x03, 0xFF, 0x8E, 0x07, 0xFF,
+    0x8C, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x0F,
+    0xF0, 0x60, 0x0F, 0xE0, 0x03, 0x8F, 0xC0, 0x07, 0x8F, 0x80, 0x0F, 0x8F,
+    0x8F, 0x0F, 0x8F, 0x8F, 0x0F, 0x8F, 0x9F, 0x07, 0x0F, 0x9E, 0x00, 0x1F,
+    0x8C, 0x00, 0x1F, 0x80, 0x60, 0x3F, 0x80, 0xF0, 0x7F, 0xC1, 0xFF, 0xFF,
+    0xF7, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xF0, 0x1F, 0x8F, 0xE0, 0x0F, 0x8F, 0xC0, 0x07, 0x0F, 0x80, 0x07, 0x0F,
+    0x87, 0xC6, 0x1F, 0x8F, 0xC4, 0x1F, 0x8F, 0xC0, 0x3F, 0x8F, 0xC0, 0x7F,
+    0x8F, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF,
+    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFB, 0xFF, 0xF1, 0xFF, 0xE0, 0x87, 0xE1, 0x87, 0xE3, 0x07, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x8F, 0xFF, 0xF7, 0x1F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xE0, 0x3F, 0x87, 0xE0, 0x7F, 0x87, 0xF1, 0xFF, 0x07, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xF0, 0x7F, 0xE2, 0x3F,
+    0xE6, 0x3F, 0xC7, 0x1F, 0xC7, 0x1F, 0x8F, 0x8F, 0x8F, 0x8F, 0x1F, 0xC7,
+    0xDF, 0xDF,
+    // 0x3D '='
+    0x9C, 0xFF, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
+    0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
+    0x9C, 0x7F,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x0F, 0xC7, 0x8F, 0x8F, 0x87, 0x8F, 0xC7, 0x1F,
+    0xC3, 0x1F, 0xE2, 0x3F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7F, 0xF8, 0xFF,
+    0xFC, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFB, 0xC7, 0xC7, 0xE1, 0x87, 0x87, 0xC0, 0x87, 0x87, 0x80, 0x87,
+    0x8F, 0x19, 0xDF, 0x86, 0x19, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x0F, 0xE0, 0xFF, 0xF8, 0x7F, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF8, 0x7F, 0xE1, 0xFC, 0xFC, 0x7F, 0xC3, 0xE0, 0x3C, 0x7F,
+    0xC7, 0x80, 0x1C, 0x7F, 0x87, 0x00, 0x1E, 0x7F, 0x8E, 0x0F, 0x1E, 0x7F,
+    0x8E, 0x3F, 0x3E, 0x7F, 0x8E, 0x7E, 0x3C, 0x7F, 0x8E, 0x78, 0xFC, 0x7F,
+    0x9E, 0x00, 0x3C, 0x7F, 0x9E, 0x00, 0x1C, 0xFF, 0x8E, 0x03, 0x18, 0xFF,
+    0x8E, 0x3F, 0x19, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x87, 0xFE, 0x3F, 0xFF,
+    0xC7, 0xFC, 0x3F, 0xFF, 0xC0, 0xC0, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0xCF,
+    0xFF, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x31, 0xFF, 0xE0, 0xF1, 0xFF,
+    0x81, 0xF1, 0xEF, 0x03, 0xF1, 0xCF, 0x00, 0x01, 0xCF, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0x8F, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    0x00, 0x1F, 0x8F, 0x03, 0x9F, 0x8F, 0x1F, 0x9F, 0x8F, 0x1F, 0x8F, 0x8F,
+    0x1F, 0x07, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x40, 0x3F,
+    0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC1, 0xFE, 0x0F, 0x83, 0xFF, 0x0F,
+    0x87, 0xFF, 0x0F, 0x0F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x0F, 0x1F, 0xFF, 0x1F, 0x0F, 0xFE, 0x1F, 0x01, 0xFC, 0x3F,
+    0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0x8F, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x1F, 0x8F, 0x03, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x0F, 0x0F, 0xFF, 0x1F, 0x0F, 0xFC, 0x1F, 0x83, 0xF8, 0x3F,
+    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFC, 0x1F, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0x8F, 0x03, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F,
+    0x1F, 0x8F, 0x8F, 0x1F, 0x8E, 0x0F, 0x1F, 0x9C, 0x0F, 0x03, 0xFC, 0x3F,
+    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0xCF, 0x01, 0x8F, 0xCF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x03, 0x9F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC1, 0xFE, 0x0F, 0x83, 0xFF, 0x0F,
+    0x87, 0xFF, 0x8F, 0x8F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x1F, 0xE7, 0x8F,
+    0x1F, 0xE7, 0x8F, 0x1F, 0xE4, 0x0F, 0x1F, 0xE0, 0x0F, 0x01, 0xE0, 0x1F,
+    0x01, 0xE0, 0x1F, 0x83, 0xE1, 0xFF, 0x87, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0xCF, 0x01, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF,
+    0xBF, 0x8F, 0xCF, 0xFF, 0x8F, 0xCF, 0xFF, 0x8F, 0x0F, 0x9F, 0x80, 0x0F,
+    0x1E, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xCF,
+    0x00, 0x7F, 0xCF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x0F, 0xCF, 0x01, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0x9F, 0xE0, 0x01, 0xFF,
+    0x1C, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+    0x00, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0xCF, 0x03, 0x87, 0xFF, 0x1F, 0x01, 0xFF, 0x1E, 0x00, 0x7F,
+    0xBC, 0x20, 0x3F, 0xF8, 0x70, 0x1F, 0xB0, 0xFC, 0x0F, 0x01, 0xFE, 0x0F,
+    0x03, 0xFF, 0x0F, 0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xCF, 0x1F, 0xFF, 0xDF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0x8F, 0x01, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x07, 0xCF,
+    0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0x81, 0xFF,
+    0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xCF, 0xF0, 0x7F, 0xCF, 0xC1, 0xFF, 0x8F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0xDF, 0xBF, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xCF,
+    0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF,
+    0x00, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC1, 0xFF, 0x0F, 0x83, 0xFF, 0x8F,
+    0x87, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x0F,
+    0x1F, 0xFF, 0x0F, 0x0F, 0xFC, 0x1F, 0x07, 0xF0, 0x1F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0x8F, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x07, 0xCF, 0x03, 0xC7, 0xCF, 0x1F, 0xC7, 0xFF, 0x1F, 0xC7, 0xFF,
+    0x0F, 0x8F, 0xFF, 0x04, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
+    0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+    0xC0, 0xFF, 0x07, 0xFF, 0x83, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x81, 0xFF,
+    0x0F, 0xFF, 0x81, 0xFF, 0x1F, 0xFF, 0x80, 0xFF, 0x1F, 0xFF, 0x88, 0xFF,
+    0x1F, 0xFF, 0x18, 0x7F, 0x0F, 0xFC, 0x18, 0x7F, 0x07, 0xF0, 0x3C, 0x7F,
+    0x80, 0x00, 0x3C, 0x3F, 0x80, 0x00, 0x7C, 0x3F, 0xC0, 0x00, 0xFC, 0x3F,
+    0xE0, 0x03, 0xFE, 0x3F, 0xF8, 0x0F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xCF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0xCF, 0x03, 0xC7, 0xFF, 0x1F, 0xC1, 0xFF, 0x1F, 0x80, 0x7F,
+    0x1F, 0x00, 0x3F, 0x06, 0x18, 0x1F, 0x80, 0x1E, 0x0F, 0x80, 0x3F, 0x0F,
+    0xC0, 0x7F, 0x8F, 0xE0, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x53 'S'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xF9, 0xF8, 0x0F,
+    0xE0, 0x7E, 0x0F, 0xC0, 0x3F, 0x8F, 0x80, 0x1F, 0x8F, 0x80, 0x0F, 0x8F,
+    0x0E, 0x0F, 0x8F, 0x1F, 0x07, 0x8F, 0x1F, 0x00, 0x0F, 0x1F, 0x80, 0x1F,
+    0x0F, 0xC0, 0x1F, 0x01, 0xE0, 0x3F, 0x83, 0xF0, 0xFF, 0x87, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xCF, 0x03, 0xFF, 0xCF,
+    0x0F, 0xFF, 0x8F, 0x1F, 0xF0, 0x0F, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x03, 0xCF, 0x00, 0x3F, 0xCF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xFF, 0xF8, 0x7F, 0x9F, 0x00, 0x3F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x3F, 0x0F, 0x03, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x8F, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x0F,
+    0xBF, 0xF0, 0x1F, 0x1E, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF,
+    0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F,
+    0x1F, 0xFC, 0x0F, 0xBF, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF,
+    0xFF, 0x03, 0xFF, 0xBC, 0x07, 0xFF, 0x10, 0x1F, 0xFF, 0x00, 0x7F, 0xFF,
+    0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1F, 0xC0, 0x0F, 0x1F, 0xF0, 0x1F,
+    0x3F, 0xC0, 0x7F, 0xFF, 0x01, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0xFF, 0xFE, 0x01, 0xFF,
+    0x98, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x0F, 0x1F, 0xFE, 0x0F, 0x1F, 0xFC, 0x0F, 0x07, 0xF8, 0x0F,
+    0x01, 0xF0, 0xCF, 0x00, 0x61, 0xFF, 0x00, 0x03, 0xFF, 0x10, 0x07, 0xEF,
+    0x3C, 0x01, 0xCF, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xB8, 0x70, 0x0F,
+    0x00, 0xFC, 0x0F, 0x01, 0xFF, 0x0F, 0x07, 0xFF, 0xCF, 0x0F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xCF, 0x01, 0xFF, 0xCF,
+    0x00, 0x3F, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F,
+    0x3F, 0x80, 0x0F, 0xFF, 0x03, 0xCF, 0xFE, 0x0F, 0xCF, 0xB8, 0x3F, 0xFF,
+    0x10, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xE3, 0xFC, 0x0F,
+    0x81, 0xF8, 0x0F, 0x03, 0xF0, 0x0F, 0x0F, 0xE0, 0x0F, 0x1F, 0x80, 0x8F,
+    0x1F, 0x03, 0x8F, 0x1E, 0x07, 0x8F, 0x1C, 0x0F, 0x8F, 0x10, 0x1F, 0x8F,
+    0x00, 0x3F, 0x8F, 0x00, 0xFE, 0x0F, 0x01, 0xF8, 0x0F, 0x03, 0xF8, 0x1F,
+    0x87, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0x3F,
+    0x80, 0x00, 0xFF, 0x3F, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+    0xC0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFB,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0x3F,
+    0x1F, 0xF0, 0x00, 0x3F, 0x1F, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x87, 0xFC, 0x07, 0xF0, 0x07, 0xC0, 0x3F,
+    0x01, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x07,
+    0xFF, 0x07, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x60 '`'
+    0xFF, 0xCF, 0x87, 0x83, 0xE1, 0xF1, 0xFF,
+    // 0x61 'a'
+    0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x01, 0x81, 0xF1,
+    0x07, 0xF1, 0x1F, 0xE3, 0x1F, 0x87, 0x1E, 0x0F, 0x80, 0x01, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0xF1, 0x0F, 0xE3, 0x7F, 0xE7, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x83, 0x9F, 0xF8, 0x03, 0x9F, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x63, 0x00, 0x03, 0xE3, 0x01, 0x8F, 0xE3,
+    0x9F, 0x1F, 0xE3, 0xFF, 0x3F, 0x83, 0xFE, 0x1C, 0x07, 0xFE, 0x00, 0x0F,
+    0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x81, 0xFF,
+    // 0x63 'c'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x01, 0x83, 0xE1,
+    0x8F, 0xF1, 0x1F, 0xF1, 0x1F, 0xE1, 0x0F, 0xE3, 0x0F, 0xC7, 0x8F, 0xEF,
+    0xFF, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x03, 0xE3, 0xFE, 0x0F, 0xE3, 0xFE, 0x3F, 0xC7,
+    0xFE, 0x3F, 0x0F, 0xDE, 0x3C, 0x1F, 0x9F, 0x00, 0x03, 0x9E, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x03, 0xE3, 0x00, 0x3F, 0xC7, 0x03, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0x86, 0x31,
+    0x9E, 0x71, 0x1C, 0x71, 0x18, 0x71, 0x00, 0xE3, 0x01, 0xC7, 0x83, 0xCF,
+    0xCF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x3F, 0xFC, 0x0F, 0xFF, 0x3F, 0x80, 0x1F,
+    0xFF, 0x30, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
+    0x0E, 0x3F, 0xFF, 0xFF, 0x1E, 0x3F, 0xFF, 0xFF, 0x1E, 0x3F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x07,
+    0xF0, 0xF8, 0xC3, 0xC0, 0x41, 0xE3, 0x80, 0x01, 0xE3, 0x80, 0x01, 0xE3,
+    0x0F, 0x01, 0xE3, 0x1F, 0x30, 0xE7, 0x3E, 0x38, 0xC7, 0x1C, 0x38, 0x07,
+    0x00, 0x78, 0x0F, 0x00, 0xFC, 0x0F, 0x01, 0xFE, 0x3F, 0x13, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x83, 0x9F, 0xF0, 0x03, 0x9F, 0x00, 0x03,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x01, 0x87, 0xFF,
+    0x8F, 0x9F, 0xFF, 0xFF, 0x1F, 0x03, 0xFE, 0x38, 0x03, 0xFE, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xFE, 0x00, 0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0xFF, 0xCF,
+    // 0x69 'i'
+    0xFF, 0x3F, 0xC3, 0xFF, 0x3C, 0x03, 0xFE, 0x20, 0x03, 0xEE, 0x00, 0x03,
+    0x86, 0x00, 0x63, 0x86, 0x03, 0xC7, 0x87, 0x3F, 0xC7, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xF8, 0x0F, 0xFF, 0x3F, 0x80, 0x1F,
+    0xFE, 0x38, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xC6, 0x00, 0x07, 0xFF,
+    0x86, 0x00, 0x7F, 0xFF, 0x86, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x83, 0x9F, 0xF0, 0x03, 0x9F, 0x00, 0x03,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x3F, 0x01, 0x9C, 0x0F,
+    0x9F, 0x1C, 0x07, 0xFF, 0x38, 0x83, 0xFE, 0x31, 0xC3, 0xFE, 0x01, 0xE3,
+    0xFE, 0x03, 0xE3, 0xFF, 0x07, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x9F, 0xF0, 0x03, 0x9F, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0xE3, 0x00, 0x0F, 0xC7, 0x00, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xF9, 0x9F, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x0F,
+    0x00, 0x7F, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xE1, 0x9E, 0x01, 0x00, 0x01,
+    0x00, 0x03, 0x00, 0x3F, 0x80, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF, 0x8F, 0x01,
+    0x08, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xF1, 0xCF, 0xE3, 0xFF, 0xE7,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xF9, 0x9F, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x07,
+    0x00, 0x7F, 0xE1, 0xFF, 0xC7, 0xFF, 0x8F, 0xF3, 0x9F, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0xF1, 0xFF, 0xE3, 0xFF, 0xF7,
+    // 0x6F 'o'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0x83, 0xF1,
+    0x8F, 0xF1, 0x1F, 0xF1, 0x1F, 0xE1, 0x1F, 0xC3, 0x00, 0x03, 0x00, 0x07,
+    0x80, 0x0F, 0xC0, 0x3F, 0xFB, 0xFF,
+    // 0x70 'p'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x87,
+    0x9F, 0xF0, 0x07, 0x9F, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE7,
+    0x00, 0x01, 0xE7, 0x00, 0xF1, 0xE7, 0xE3, 0xF1, 0xFF, 0xC7, 0xF1, 0xFF,
+    0x8F, 0xE1, 0xFF, 0x1F, 0x83, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF,
+    0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x01, 0xFF,
+    0xC0, 0x01, 0xFF, 0x83, 0xF1, 0xE7, 0x0F, 0xF1, 0xE7, 0x1F, 0xE3, 0xE7,
+    0x1F, 0x86, 0x07, 0x1E, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x07, 0xE7, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xFF, 0xFF, 0x9F, 0xF9, 0x9F, 0x81, 0x18, 0x01, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF,
+    0x0F, 0xFF, 0x9F, 0xFF,
+    // 0x73 's'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xC1, 0xE3, 0xC1, 0xC1, 0xE1, 0x80, 0xF1,
+    0x80, 0x71, 0x18, 0x31, 0x1C, 0x01, 0x1E, 0x03, 0x0E, 0x07, 0x0F, 0x8F,
+    0x9F, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xE0, 0x1F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x0F, 0x1F, 0x81, 0xFF, 0x1F,
+    0xB1, 0xFE, 0x3F, 0xF1, 0xFE, 0x3F, 0xF1, 0xFC, 0x7F, 0xFB, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xFF, 0xFF, 0x9F, 0xC3, 0x9E, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x31,
+    0x03, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x0F, 0xFC, 0x03, 0x80, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x07, 0xE3, 0x3F, 0xE3, 0xFF, 0xE7,
+    // 0x76 'v'
+    0xDF, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x01, 0x00, 0x01,
+    0xC0, 0x01, 0xFE, 0x03, 0xFF, 0xC7, 0xBF, 0x0F, 0x00, 0x1F, 0x00, 0x3F,
+    0x00, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x77 'w'
+    0xDF, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x07, 0xFF, 0x00, 0x03, 0x80, 0x01,
+    0xC0, 0x01, 0xFF, 0x03, 0xFF, 0x87, 0xBE, 0x0F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x01, 0xC0, 0x01, 0xFE, 0x01, 0xFF, 0x83, 0xBE, 0x07, 0x00, 0x1F,
+    0x00, 0x3F, 0x00, 0xFF, 0x87, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFF, 0xFF, 0xE1, 0xDF, 0xF1, 0x9F, 0xF1, 0x1F, 0xE1, 0x0F, 0xC3,
+    0x03, 0x87, 0x00, 0x0F, 0x80, 0x1F, 0xF0, 0x03, 0xE0, 0x01, 0xC3, 0x81,
+    0x87, 0xE1, 0x0F, 0xF1, 0x1F, 0xF1, 0x0F, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3,
+    0xDF, 0xFF, 0xC7, 0x9F, 0xFF, 0xC7, 0x1F, 0xFF, 0x87, 0x03, 0xFF, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0xFF,
+    0xFF, 0xC1, 0xFF, 0xBF, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xFF, 0xF1, 0xE7, 0xE1, 0x83, 0xC1, 0x03, 0x83, 0x0F, 0x03,
+    0x0E, 0x01, 0x0C, 0x31, 0x88, 0x71, 0x80, 0xF1, 0xC1, 0xE1, 0x07, 0xC1,
+    0x0F, 0xC3, 0x1F, 0xF7, 0xBF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF9, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x8F, 0xE0, 0x06, 0x7F, 0x8F,
+    0xC0, 0x0F, 0xFF, 0x9F, 0x83, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
+    0x80, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
+    0x8F, 0xFF, 0x00, 0x3F, 0x8F, 0xC2, 0x00, 0x7F, 0x8E, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x7F, 0xFF, 0x80, 0x18, 0xFF, 0xFF, 0xC0, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xC7, 0x87, 0x07, 0x1F, 0x1F, 0x0F, 0x8F, 0x87, 0xC7, 0xC7, 0x87, 0x07,
+    0x0F, 0xFF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x03,
+    0xFF, 0x80, 0x07, 0x8C, 0x00, 0x0F, 0x0C, 0x00, 0x7F, 0x0C, 0x3F, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0x1F, 0xFE, 0x1F, 0x80, 0x1F,
+    0xFC, 0x3F, 0x00, 0x1F, 0xFC, 0x70, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+    0xC0, 0x07, 0xC7, 0xFF, 0x80, 0x7F, 0xCF, 0xFF, 0x80, 0x7F, 0x8F, 0xFF,
+    0xFC, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xCF, 0x8F,
+    0xFF, 0x8C, 0x0F, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x9F,
+    0xE0, 0x03, 0x8F, 0xC0, 0x0F, 0x8F, 0xC1, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x9F, 0x8F, 0x8F, 0x8F, 0x9F, 0x8F, 0x83, 0xFF, 0x0F,
+    0x83, 0xFF, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xF7, 0xFF, 0xE3, 0xDF, 0xC7, 0x8C, 0x07, 0xC0, 0x0F, 0xE0, 0x07,
+    0xE3, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x8F, 0xC0, 0x0F,
+    0xE0, 0x07, 0xE0, 0x23, 0xC7, 0xF7, 0x8F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0x9F, 0xFF, 0xFF, 0x9F, 0x93, 0xEF, 0x87, 0x93, 0xCF, 0x80, 0x93, 0xCF,
+    0x80, 0x13, 0x0F, 0x80, 0x00, 0x0F, 0x88, 0x00, 0x0F, 0x9F, 0x00, 0x0F,
+    0xBF, 0x80, 0x8F, 0xFF, 0x03, 0xCF, 0xFC, 0x13, 0xDF, 0x98, 0x13, 0xFF,
+    0x80, 0x93, 0xFF, 0x81, 0x97, 0xFF, 0x83, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFC, 0x1F, 0x83, 0xF0, 0x07, 0x83,
+    0xE1, 0xC3, 0xE3, 0xC0, 0xE1, 0xF1, 0xC0, 0x71, 0xF3, 0x8C, 0x38, 0xF3,
+    0x9E, 0x1C, 0x03, 0x9F, 0x0E, 0x07, 0x8F, 0x87, 0x07, 0x83, 0xC0, 0x0F,
+    0x83, 0xE0, 0x3F, 0xC7, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0xFF, 0x9F, 0x9E, 0x03, 0xCF, 0x9C, 0x01, 0xCF,
+    0x38, 0x00, 0xCF, 0x39, 0xF8, 0xEF, 0x39, 0xF8, 0xE7, 0x39, 0xFC, 0xE7,
+    0x38, 0xFC, 0xEF, 0x38, 0x78, 0xCF, 0x9D, 0xF9, 0xCF, 0x9F, 0xFF, 0xCF,
+    0xCF, 0xFF, 0x9F, 0xC7, 0xFF, 0x3F, 0xE1, 0xFC, 0x7F, 0xF8, 0x00, 0xFF,
+    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xFF, 0xF0, 0x73, 0xC0, 0x23, 0x80, 0x23, 0x0E, 0x23, 0x1E, 0x63,
+    0x38, 0x63, 0x00, 0x23, 0x80, 0x27, 0x0E, 0x27, 0x3E, 0x7F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x3F, 0x86, 0x1F,
+    0x8F, 0x9F, 0x1F, 0xFF, 0xB9, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F,
+    0xC6, 0x1F, 0x8F, 0x1F, 0x1F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE1, 0x87, 0xCF, 0xE7, 0x9F, 0xF3, 0xB0, 0x19,
+    0x30, 0x19, 0x20, 0x1D, 0x26, 0x3D, 0x30, 0x19, 0xB1, 0x99, 0x9F, 0xDB,
+    0xCF, 0xF3, 0xC7, 0xC7, 0xF0, 0x0F, 0xFE, 0xFF,
+    // 0xB0 '°'
+    0xF1, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x84, 0x3F, 0x8E, 0x3F, 0x9F, 0x3F,
+    0x8E, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFB, 0xFF,
+    // 0xB1 '±'
+    0xFC, 0xFE, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0x7F, 0x80, 0x04, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x7F,
+    0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0x7F,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF7, 0xC3, 0xC3, 0xC3, 0xC7, 0x83, 0x8F, 0x03,
+    0x9E, 0x23, 0x9C, 0x63, 0x80, 0xE3, 0x80, 0xE7, 0xC3, 0xEF, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xF3, 0xFF, 0xF3, 0xE7, 0xF3, 0xC6, 0x73, 0x8C, 0xE3, 0x9C, 0xE3,
+    0x98, 0x07, 0x80, 0x0F, 0x82, 0x0F, 0xC7, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x07,
+    0xF0, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x00, 0x61, 0xFF,
+    0x0F, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x87, 0xFF,
+    0xF0, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x61, 0xFF,
+    0x0F, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE7, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0x1F, 0xFC,
+    0xF0, 0x0F, 0xFC, 0xE0, 0x07, 0xF8, 0xC0, 0x07, 0xE1, 0xC0, 0x04, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x73, 0x80, 0x0F, 0xC3, 0x81, 0xF8, 0x07,
+    0x9F, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xC7, 0x87, 0x87, 0x87, 0xDF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xCF, 0xE3, 0xCF, 0xC3, 0xC8, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x83, 0xF3, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xF9, 0xF3, 0xE0, 0x63, 0xC0, 0x23, 0x86, 0x23, 0x1F, 0x23,
+    0x3E, 0x23, 0x3C, 0x67, 0x00, 0x67, 0x80, 0xEF, 0xC3, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x1F, 0x9E, 0x1F, 0x84, 0x3F, 0x80, 0x7F,
+    0xC0, 0x7F, 0xE0, 0xFF, 0xF1, 0x9F, 0xFF, 0x1F, 0x9E, 0x1F, 0x84, 0x3F,
+    0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xF3, 0xFF, 0xE7, 0xC3, 0xFF,
+    0xC4, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xFF, 0xC1, 0xF3, 0xF3,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xBF, 0xF8, 0x7E, 0x1F, 0xE0, 0xFC, 0x1F,
+    0xC1, 0xF8, 0x1F, 0x87, 0xF1, 0x1F, 0x8F, 0xE3, 0x1F, 0xDF, 0xC7, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x9F, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xF3, 0xFF, 0xE7, 0xC3, 0xFF,
+    0xC4, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xE3, 0xC1, 0xF3, 0xC1,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xEF, 0xE0, 0xFF, 0xC7, 0x83, 0xC7, 0x87,
+    0x87, 0x87, 0x87, 0x8F, 0x8F, 0x07, 0xFF, 0x9E, 0x27, 0xFF, 0x1C, 0x67,
+    0xFF, 0x18, 0xE7, 0xFF, 0x80, 0xE7, 0xFF, 0x81, 0xE7, 0xFF, 0xC7, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xE7, 0xF1, 0xFF, 0xC6, 0x71, 0xFF,
+    0xC6, 0x73, 0xFF, 0xCE, 0x63, 0xFF, 0xCC, 0x03, 0xFF, 0xC0, 0x07, 0xE3,
+    0xC1, 0x0F, 0xC1, 0xE3, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xBF, 0xF0, 0x7E, 0x1F, 0xE0, 0xFC, 0x1F,
+    0x83, 0xF8, 0x1F, 0x87, 0xF1, 0x1F, 0x8F, 0xE3, 0x1F, 0xFF, 0xC7, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x9F, 0x1F,
+    0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFE, 0x60, 0x07,
+    0xFC, 0x43, 0x87, 0x8C, 0x47, 0x87, 0x0C, 0x0F, 0x87, 0x0C, 0x1F, 0x0F,
+    0x0E, 0x3F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFC, 0x01, 0xFF, 0xCF, 0xF0, 0x31, 0xFF, 0x87, 0xE0, 0xF1, 0xFF,
+    0xC7, 0x81, 0xF1, 0xEF, 0xC3, 0x03, 0xF1, 0xCF, 0xE3, 0x00, 0x01, 0xCF,
+    0xF3, 0x00, 0x00, 0x0F, 0xFB, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x31, 0xFF, 0xFF, 0xE0, 0xF1, 0xFF,
+    0xF1, 0x81, 0xF1, 0xEF, 0xF3, 0x03, 0xF1, 0xCF, 0xE3, 0x00, 0x01, 0xCF,
+    0xC3, 0x00, 0x00, 0x0F, 0xC7, 0x80, 0x00, 0x0F, 0x87, 0xFE, 0x00, 0x0F,
+    0xCF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFB, 0xFC, 0x01, 0xFF, 0xF1, 0xF0, 0x31, 0xFF, 0xF1, 0xE0, 0xF1, 0xFF,
+    0xE3, 0x81, 0xF1, 0xEF, 0xC7, 0x03, 0xF1, 0xCF, 0x8F, 0x00, 0x01, 0xCF,
+    0x8F, 0x00, 0x00, 0x0F, 0x87, 0x80, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x0F,
+    0xF3, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x01, 0x9F, 0xFF, 0xFE, 0x03, 0xFF,
+    0xFF, 0xF8, 0x03, 0xFF, 0xC7, 0xE0, 0x63, 0xFF, 0x87, 0xC1, 0xE3, 0xFF,
+    0x9F, 0x03, 0xE3, 0xDF, 0x8E, 0x07, 0xE3, 0x9F, 0x86, 0x00, 0x03, 0x9F,
+    0xC6, 0x00, 0x00, 0x1F, 0xC7, 0x00, 0x00, 0x1F, 0x87, 0xFC, 0x00, 0x1F,
+    0x8F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x9F,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x03, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
+    0xFF, 0xF0, 0x07, 0xFF, 0x8F, 0xC0, 0xC7, 0xFF, 0x0F, 0x83, 0xC7, 0xFF,
+    0x0E, 0x07, 0xC7, 0xBF, 0x9C, 0x0F, 0xC7, 0x3F, 0xFC, 0x00, 0x07, 0x3F,
+    0x8C, 0x00, 0x00, 0x3F, 0x0E, 0x00, 0x00, 0x3F, 0x0F, 0xF8, 0x00, 0x3F,
+    0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x31, 0xFF, 0xC3, 0xE0, 0xF1, 0xFF,
+    0x81, 0x81, 0xF1, 0xEF, 0x99, 0x03, 0xF1, 0xCF, 0x19, 0x00, 0x01, 0xCF,
+    0x19, 0x00, 0x00, 0x0F, 0x81, 0x80, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x4F,
+    0xFF, 0xE0, 0xCF, 0xFF, 0xC1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x03, 0xEF,
+    0xFC, 0x13, 0xCF, 0xB8, 0x73, 0xCF, 0x10, 0xF1, 0x0F, 0x01, 0xE0, 0x0F,
+    0x07, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0x8F,
+    0x03, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F,
+    0x1F, 0x8E, 0x0F, 0x1F, 0x9C, 0x0F, 0x03, 0xFC, 0x3F, 0x03, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
+    0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xDF,
+    0xC1, 0xFE, 0x0D, 0xDF, 0x83, 0xFF, 0x09, 0x9F, 0x87, 0xFF, 0x08, 0x1F,
+    0x0F, 0xFF, 0x88, 0x3F, 0x0F, 0xFF, 0x8C, 0x7F, 0x1F, 0xFF, 0x8F, 0xFF,
+    0x1F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x0F, 0xFE, 0x1F, 0xFF,
+    0x01, 0xFC, 0x3F, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xCF, 0x00, 0x0F, 0x8F,
+    0x87, 0x03, 0x8F, 0x8F, 0x87, 0x1F, 0x8F, 0x8F, 0xC3, 0x1F, 0x8F, 0x8F,
+    0xE3, 0x1F, 0x8F, 0x8F, 0xF3, 0x1F, 0x8E, 0x0F, 0xF3, 0x1F, 0x9C, 0x0F,
+    0xFF, 0x03, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x0F, 0x8F,
+    0xFF, 0x03, 0x8F, 0x8F, 0xF1, 0x1F, 0x8F, 0x8F, 0xF3, 0x1F, 0x8F, 0x8F,
+    0xE3, 0x1F, 0x8F, 0x8F, 0xC3, 0x1F, 0x8E, 0x0F, 0xC7, 0x1F, 0x9C, 0x0F,
+    0x87, 0x03, 0xFC, 0x3F, 0x8F, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x0F, 0x8F,
+    0xF1, 0x03, 0x8F, 0x8F, 0xE3, 0x1F, 0x8F, 0x8F, 0xC7, 0x1F, 0x8F, 0x8F,
+    0x87, 0x1F, 0x8F, 0x8F, 0x8F, 0x1F, 0x8E, 0x0F, 0x87, 0x1F, 0x9C, 0x0F,
+    0xC3, 0x03, 0xFC, 0x3F, 0xE3, 0x03, 0xFF, 0xFF, 0xFB, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xF0, 0x3F, 0xFE, 0x7F, 0x00, 0x3F, 0xFC, 0x60, 0x00, 0x3F,
+    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0x3F, 0x8C, 0x00, 0x3E, 0x3F,
+    0x0C, 0x0E, 0x3E, 0x3F, 0x0C, 0x7E, 0x3E, 0x3F, 0x1C, 0x7E, 0x3E, 0x3F,
+    0xFC, 0x7E, 0x3E, 0x3F, 0xDC, 0x7E, 0x38, 0x3F, 0x8C, 0x7E, 0x70, 0x3F,
+    0x0C, 0x0F, 0xF0, 0xFF, 0x0C, 0x0F, 0xFF, 0xFF, 0xBC, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0x87, 0x18, 0x00, 0x0F,
+    0x87, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x0F, 0xCF,
+    0xE3, 0x01, 0xFF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFB, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x0F, 0xE3, 0x00, 0x0F, 0xCF,
+    0xE3, 0x01, 0xFF, 0xFF, 0xC3, 0x1F, 0xFF, 0xFF, 0x87, 0x1F, 0xFF, 0xFF,
+    0x87, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFB, 0x9F, 0xC0, 0x0F, 0xF1, 0x18, 0x00, 0x0F,
+    0xE3, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x0F, 0xCF,
+    0x8F, 0x01, 0xFF, 0xFF, 0x87, 0x1F, 0xFF, 0xFF, 0xC3, 0x1F, 0xFF, 0xFF,
+    0xE1, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xCE, 0x7F, 0x00, 0x3F, 0x8C, 0x60, 0x00, 0x3F,
+    0x0C, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x3F, 0x3F,
+    0xFC, 0x07, 0xFF, 0xFF, 0x8C, 0x7F, 0xFF, 0xFF, 0x0C, 0x7F, 0xFF, 0xFF,
+    0x0C, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xDF, 0xCF, 0xFF, 0x9F, 0x8F, 0x8F, 0x9C, 0x0F,
+    0x9F, 0x80, 0x0F, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0x8F, 0x03, 0x9F, 0x8F, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x8F,
+    0x1F, 0x9F, 0x0F, 0x0F, 0xFF, 0x1F, 0x0F, 0xFC, 0x1F, 0x83, 0xF8, 0x3F,
+    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFC, 0x1F, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x3F, 0x80, 0x1F, 0xFE, 0x30, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0x9F, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xC7, 0x00, 0x1F, 0xFF, 0x8F, 0xC0, 0x07, 0xFF,
+    0x1F, 0xF8, 0x01, 0xFF, 0x8F, 0xFE, 0x00, 0x7F, 0x87, 0xFF, 0x80, 0x1F,
+    0xC7, 0xFF, 0xF0, 0x1F, 0xC7, 0x3F, 0x80, 0x1F, 0x8E, 0x38, 0x00, 0x1F,
+    0x9E, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xC1, 0xFF, 0x0F, 0xFF, 0x83, 0xFF, 0x8F, 0xCF, 0x87, 0xFF, 0x8F,
+    0x87, 0x0F, 0xFF, 0x8F, 0x87, 0x1F, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x0F,
+    0xE3, 0x1F, 0xFF, 0x0F, 0xF3, 0x0F, 0xFC, 0x1F, 0xFB, 0x07, 0xF0, 0x1F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xC1, 0xFF, 0x0F, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x8F,
+    0xFF, 0x0F, 0xFF, 0x8F, 0xF1, 0x1F, 0xFF, 0x8F, 0xF3, 0x1F, 0xFF, 0x0F,
+    0xE3, 0x1F, 0xFF, 0x0F, 0xC3, 0x0F, 0xFC, 0x1F, 0xC7, 0x07, 0xF0, 0x1F,
+    0x87, 0x80, 0x00, 0x3F, 0x8F, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xC1, 0xFF, 0x0F, 0xFB, 0x83, 0xFF, 0x8F, 0xF9, 0x87, 0xFF, 0x8F,
+    0xF1, 0x0F, 0xFF, 0x8F, 0xE3, 0x1F, 0xFF, 0x8F, 0xC7, 0x1F, 0xFF, 0x0F,
+    0x8F, 0x1F, 0xFF, 0x0F, 0x8F, 0x0F, 0xFC, 0x1F, 0x87, 0x07, 0xF0, 0x1F,
+    0xC3, 0x80, 0x00, 0x3F, 0xE3, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F,
+    0xFF, 0x83, 0xFE, 0x1F, 0xFF, 0x07, 0xFF, 0x1F, 0xC7, 0x0F, 0xFF, 0x1F,
+    0x86, 0x1F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFE, 0x1F,
+    0x8E, 0x3F, 0xFE, 0x1F, 0xC6, 0x1F, 0xF8, 0x3F, 0xC6, 0x0F, 0xE0, 0x3F,
+    0x87, 0x00, 0x00, 0x7F, 0x8F, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x07, 0xFC, 0x3F, 0xFE, 0x0F, 0xFE, 0x3F, 0x8E, 0x1F, 0xFE, 0x3F,
+    0x0C, 0x3F, 0xFE, 0x3F, 0x0C, 0x7F, 0xFE, 0x3F, 0x9C, 0x7F, 0xFC, 0x3F,
+    0xFC, 0x7F, 0xFC, 0x3F, 0xCC, 0x3F, 0xF0, 0x7F, 0x8C, 0x1F, 0xC0, 0x7F,
+    0x0E, 0x00, 0x00, 0xFF, 0x0E, 0x00, 0x01, 0xFF, 0xBF, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0xDF, 0xDF, 0x8F, 0x8F, 0x87, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x82, 0x0F, 0x87, 0x0F, 0xCF, 0x9F,
+    0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE3, 0xFF, 0x80, 0x47, 0xFE, 0x00, 0x0F,
+    0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x0C, 0x07, 0xE0, 0xF8, 0x87,
+    0xC3, 0xF1, 0xC7, 0xC7, 0xF3, 0xC7, 0x87, 0xE7, 0xC7, 0x8F, 0xC7, 0xC7,
+    0x8F, 0x8F, 0x87, 0x8F, 0x1F, 0x87, 0x86, 0x3F, 0x0F, 0x80, 0x7C, 0x0F,
+    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF,
+    0x8C, 0x0F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x9F, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0x0F,
+    0xFF, 0x03, 0xFF, 0x8F, 0xCF, 0x1F, 0xFF, 0x8F, 0x87, 0x1F, 0xFF, 0x8F,
+    0x87, 0xBF, 0xFF, 0x8F, 0xC3, 0xFF, 0xFF, 0x0F, 0xE3, 0xFF, 0xFE, 0x0F,
+    0xF3, 0xBF, 0xF0, 0x1F, 0xF3, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x9F, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0x0F,
+    0xFF, 0x03, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x8F,
+    0xF3, 0xBF, 0xFF, 0x8F, 0xF3, 0xFF, 0xFF, 0x0F, 0xE3, 0xFF, 0xFE, 0x0F,
+    0xC3, 0xBF, 0xF0, 0x1F, 0xC7, 0x1E, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x7F,
+    0x8F, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x9F, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0x0F,
+    0xFF, 0x03, 0xFF, 0x8F, 0xF9, 0x1F, 0xFF, 0x8F, 0xF1, 0x1F, 0xFF, 0x8F,
+    0xE3, 0xBF, 0xFF, 0x8F, 0xC7, 0xFF, 0xFF, 0x0F, 0x87, 0xFF, 0xFE, 0x0F,
+    0x8F, 0xBF, 0xF0, 0x1F, 0x87, 0x1E, 0x00, 0x3F, 0xC3, 0x00, 0x00, 0x7F,
+    0xE3, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFE, 0x7C, 0x00, 0xFF, 0xFC, 0x40, 0x00, 0x7F,
+    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x3F,
+    0xFC, 0x0F, 0xFE, 0x3F, 0x8C, 0x7F, 0xFE, 0x3F, 0x0C, 0x7F, 0xFE, 0x3F,
+    0x0E, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xDE, 0xFF, 0xC0, 0x7F, 0x8C, 0x78, 0x00, 0xFF, 0x0C, 0x00, 0x01, 0xFF,
+    0x0C, 0x00, 0x07, 0xFF, 0x9C, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x1C, 0xCF, 0x01, 0xFC, 0xFF, 0x11, 0xF8, 0xFF, 0x11, 0xF8, 0xFF,
+    0xB0, 0xF1, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xC7, 0xFF, 0x83, 0xFF, 0xC3, 0xFF,
+    0x8F, 0xFF, 0xC3, 0xFF, 0x1F, 0xC3, 0xE3, 0xFF, 0x1F, 0x01, 0xE3, 0xFF,
+    0x1E, 0x00, 0xE3, 0xFF, 0x00, 0x20, 0x03, 0xFF, 0x00, 0x78, 0x07, 0xFF,
+    0x80, 0xFC, 0x0F, 0xFF, 0xC3, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
+    0xCF, 0x83, 0xF8, 0xFF, 0x87, 0x8F, 0xF1, 0xFF, 0x83, 0x8F, 0xC3, 0xFF,
+    0xC3, 0x8F, 0x07, 0xFF, 0xF1, 0xC0, 0x00, 0xFF, 0xF9, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x78, 0xFF, 0xFF, 0x87, 0xF1, 0xFF,
+    0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
+    0xFF, 0x83, 0xF8, 0xFF, 0xFF, 0x8F, 0xF1, 0xFF, 0xFF, 0x8F, 0xC3, 0xFF,
+    0xFB, 0x8F, 0x07, 0xFF, 0xF1, 0xC0, 0x00, 0xFF, 0xC3, 0xC0, 0x00, 0xFF,
+    0x07, 0x80, 0x00, 0xFF, 0x07, 0x80, 0x78, 0xFF, 0x9F, 0x87, 0xF1, 0xFF,
+    0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC0, 0x01, 0xFB, 0x81, 0xF1, 0xF3, 0x07, 0xF1, 0xE3, 0x1F, 0xE3,
+    0xC7, 0x1F, 0x87, 0x0F, 0x1E, 0x0F, 0x1F, 0x80, 0x01, 0x0F, 0x80, 0x01,
+    0x83, 0x00, 0x01, 0xC3, 0x00, 0xF1, 0xFF, 0x0F, 0xE3, 0xFF, 0x7F, 0xE7,
+    0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x03, 0xE3, 0x8E, 0x0F, 0xE3, 0x0E, 0x3F, 0xC7,
+    0x1E, 0x3F, 0x0F, 0x1E, 0x3C, 0x1F, 0x8F, 0x00, 0x03, 0xC7, 0x00, 0x03,
+    0xCE, 0x00, 0x03, 0x0E, 0x01, 0xE3, 0x1E, 0x1F, 0xC7, 0xFE, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x03, 0xE3, 0x8E, 0x0F, 0xE3, 0x8E, 0x3F, 0xC7,
+    0x8E, 0x3F, 0x0F, 0x9E, 0x3C, 0x1F, 0xFF, 0x00, 0x03, 0xCF, 0x00, 0x03,
+    0x86, 0x00, 0x03, 0x8E, 0x01, 0xE3, 0x8E, 0x1F, 0xC7, 0xFE, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
+    0xFF, 0x83, 0xF8, 0xFF, 0xC1, 0x8F, 0xF1, 0xFF, 0x81, 0x8F, 0xC3, 0xFF,
+    0x98, 0x8F, 0x07, 0xFF, 0x1C, 0xC0, 0x00, 0xFF, 0x99, 0xC0, 0x00, 0xFF,
+    0x81, 0x80, 0x00, 0xFF, 0xC3, 0x80, 0x78, 0xFF, 0xFF, 0x87, 0xF1, 0xFF,
+    0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x01, 0x81, 0xF1,
+    0x07, 0xF1, 0x1F, 0xE3, 0x1F, 0x87, 0x1E, 0x0F, 0x18, 0x03, 0x80, 0x01,
+    0x80, 0x01, 0x81, 0x21, 0x8E, 0x31, 0x1E, 0x71, 0x1C, 0x71, 0x18, 0xE3,
+    0x00, 0xE3, 0x01, 0xC7, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFB, 0xE0, 0x01, 0xBB,
+    0xC0, 0x01, 0x33, 0x83, 0xE1, 0x03, 0x8F, 0xF1, 0x07, 0x1F, 0xF1, 0x9F,
+    0x1F, 0xE1, 0xFF, 0x0F, 0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0x8F, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xCF, 0xC3, 0x18, 0xFF,
+    0x87, 0xCF, 0x38, 0xFF, 0x83, 0x8E, 0x38, 0xFF, 0xC1, 0x8C, 0x38, 0xFF,
+    0xF1, 0x80, 0x71, 0xFF, 0xF9, 0x80, 0xE3, 0xFF, 0xFF, 0xC1, 0xE7, 0xFF,
+    0xFF, 0xE7, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC3, 0x18, 0xFF,
+    0xFF, 0xCF, 0x38, 0xFF, 0xFF, 0x8E, 0x38, 0xFF, 0xFB, 0x8C, 0x38, 0xFF,
+    0xE1, 0x80, 0x71, 0xFF, 0xC3, 0x80, 0xE3, 0xFF, 0x07, 0xC1, 0xE7, 0xFF,
+    0x8F, 0xE7, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+    0xFB, 0xC0, 0x01, 0xF3, 0x86, 0x31, 0xE3, 0x9E, 0x71, 0x87, 0x1C, 0x71,
+    0x0F, 0x18, 0x71, 0x1F, 0x00, 0xE3, 0x07, 0x01, 0xC7, 0x83, 0x83, 0xCF,
+    0xE3, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0x8F, 0x0C, 0x63, 0x8F, 0x3C, 0xE3, 0x8E, 0x38, 0xE3,
+    0x9E, 0x30, 0xE3, 0xFE, 0x01, 0xC7, 0x8E, 0x03, 0x8F, 0x8F, 0x07, 0x9F,
+    0x8F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xCF, 0xF0, 0xFF, 0xFF, 0xCF, 0x00, 0xFF, 0xCF, 0x88, 0x00, 0xFF,
+    0x87, 0x80, 0x00, 0xFF, 0x83, 0x80, 0x18, 0xFF, 0xE1, 0x80, 0xF1, 0xFF,
+    0xF1, 0xCF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xCF, 0xF0, 0xFF, 0xFF, 0xCF, 0x00, 0xFF, 0xFF, 0x88, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x18, 0xFF, 0xF1, 0x80, 0xF1, 0xFF,
+    0xE1, 0xCF, 0xF1, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0x9F, 0xE1, 0xFB, 0x9E, 0x01, 0xE3, 0x10, 0x01, 0xC3, 0x00, 0x01,
+    0x87, 0x00, 0x31, 0x0F, 0x01, 0xE3, 0x1F, 0x9F, 0xE3, 0x07, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0x3F, 0xC3, 0xCF, 0x3C, 0x03, 0x8E, 0x20, 0x03, 0x8E, 0x00, 0x03,
+    0x8E, 0x00, 0x63, 0xFE, 0x03, 0xC7, 0xFF, 0x3F, 0xC7, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC0, 0x01, 0xFF, 0x83, 0xF1, 0xD9, 0x87, 0xF1, 0x81, 0x0F, 0xF1,
+    0x83, 0x1F, 0xE1, 0x83, 0x1F, 0xC1, 0xC0, 0x06, 0x03, 0xC0, 0x00, 0x07,
+    0x98, 0x00, 0x0F, 0x9E, 0x00, 0x3F, 0xFF, 0xC1, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF3, 0xFF, 0x3E, 0x03, 0xFE, 0x20, 0x03,
+    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0x8E, 0x00, 0xFF, 0x0F, 0xC3, 0xFF,
+    0x1F, 0x8F, 0xFF, 0x1F, 0x1F, 0xE7, 0x8F, 0x3E, 0x03, 0xC6, 0x00, 0x03,
+    0xCE, 0x00, 0x03, 0x0E, 0x00, 0x03, 0x1F, 0x03, 0xE3, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xEF,
+    // 0xF2 'ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC1, 0xF8, 0xFF,
+    0xDF, 0xC7, 0xF8, 0xFF, 0x87, 0x8F, 0xF8, 0xFF, 0x83, 0x8F, 0xF0, 0xFF,
+    0xC3, 0x8F, 0xE1, 0xFF, 0xE1, 0x80, 0x01, 0xFF, 0xF9, 0x80, 0x03, 0xFF,
+    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC1, 0xF8, 0xFF,
+    0xFF, 0xC7, 0xF8, 0xFF, 0xFF, 0x8F, 0xF8, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF,
+    0xFF, 0x8F, 0xE1, 0xFF, 0xF1, 0x80, 0x01, 0xFF, 0xC3, 0x80, 0x03, 0xFF,
+    0x83, 0xC0, 0x07, 0xFF, 0x07, 0xE0, 0x1F, 0xFF, 0x8F, 0xFD, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC0, 0x01, 0xFB, 0x83, 0xF1, 0xF3, 0x8F, 0xF1, 0xE3, 0x1F, 0xF1,
+    0xC7, 0x1F, 0xE1, 0x0F, 0x1F, 0xC3, 0x1F, 0x00, 0x03, 0x0F, 0x00, 0x07,
+    0x03, 0x80, 0x0F, 0xC3, 0xC0, 0x3F, 0xFF, 0xFB, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x07, 0xE3, 0x8F, 0x1F, 0xE3, 0x0E, 0x3F, 0xE3,
+    0x1E, 0x3F, 0xC3, 0x1E, 0x3F, 0x87, 0x0E, 0x00, 0x07, 0xCE, 0x00, 0x0F,
+    0xCF, 0x00, 0x1F, 0x0F, 0x80, 0x7F, 0x1F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x07, 0xE3, 0x8F, 0x1F, 0xE3, 0x8E, 0x3F, 0xE3,
+    0x8E, 0x3F, 0xC3, 0x9E, 0x3F, 0x87, 0xFE, 0x00, 0x07, 0xCE, 0x00, 0x0F,
+    0x8F, 0x00, 0x1F, 0x8F, 0x80, 0x7F, 0x8F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x88, 0xC7,
+    0x08, 0x87, 0x08, 0x87, 0x98, 0xCF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xFE, 0x01, 0xFF,
+    0xF8, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC1, 0x88, 0xFF,
+    0xC7, 0x98, 0xFF, 0x8F, 0x38, 0xFF, 0x8E, 0x70, 0xFF, 0x8C, 0xE1, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF,
+    0x8D, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE1, 0xFF, 0xFF, 0xCF, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x18, 0xFF,
+    0xCF, 0x81, 0xF8, 0xFF, 0x87, 0xFF, 0xF1, 0xFF, 0x83, 0xFF, 0xE3, 0xFF,
+    0xC1, 0xFF, 0x87, 0xFF, 0xF1, 0xFE, 0x01, 0xFF, 0xF9, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x83, 0xF1, 0xFF,
+    0xFF, 0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE1, 0xFF, 0xFF, 0xCF, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x18, 0xFF,
+    0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFB, 0xFF, 0x87, 0xFF, 0xE1, 0xFE, 0x01, 0xFF, 0xC3, 0xC0, 0x00, 0xFF,
+    0x07, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xFF, 0xDF, 0x83, 0xF1, 0xFF,
+    0xFF, 0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xC3, 0xFF, 0x9E, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0xFB, 0x00, 0x31, 0xF3, 0x03, 0xF1, 0xE3, 0xFF, 0xE3,
+    0x87, 0xFF, 0xC7, 0x0F, 0xFF, 0x0F, 0x1F, 0xFC, 0x03, 0x07, 0x80, 0x01,
+    0x83, 0x00, 0x01, 0xE3, 0x00, 0x01, 0xFF, 0x07, 0xE3, 0xFF, 0x3F, 0xE3,
+    0xFF, 0xFF, 0xE7,
+    // 0xFC 'ü'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x87, 0xFF, 0x3C, 0x03, 0xFE, 0x00, 0x03,
+    0xFE, 0x00, 0x03, 0xCE, 0x00, 0x63, 0x8E, 0x07, 0xE3, 0x8F, 0xFF, 0xC7,
+    0x8F, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x07, 0x8F, 0x00, 0x03,
+    0x8E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x9E, 0x0F, 0xC7, 0xFE, 0x7F, 0xC7,
+    0xFF, 0xFF, 0xCF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0x9F, 0xF0, 0x00, 0x0F,
+    0x9E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xE3, 0xCF,
+    0x00, 0x03, 0xE3, 0xFF, 0x03, 0x8F, 0xE3, 0xFF, 0x9F, 0x1F, 0xC3, 0xFF,
+    0xFF, 0x3F, 0x83, 0xFF, 0xFE, 0x1C, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xBF, 0xFF, 0x8F, 0xFF, 0x3F, 0xFF, 0x8F,
+    0xFE, 0x3F, 0xFF, 0x0F, 0xFE, 0x07, 0xFE, 0x1F, 0x8E, 0x00, 0x00, 0x3F,
+    0x8E, 0x00, 0x00, 0x7F, 0x8F, 0x80, 0x00, 0xFF, 0x9F, 0xFC, 0x01, 0xFF,
+    0xFF, 0xFF, 0x83, 0xFF, 0xCF, 0x7E, 0x0F, 0xFF, 0x8E, 0x00, 0x1F, 0xFF,
+    0x8E, 0x00, 0x7F, 0xFF, 0x8E, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x31, 0xFF, 0xFF, 0xE0, 0xF1, 0xFF, 0xFF,
+    0x81, 0xF1, 0xEF, 0xFF, 0x03, 0xF1, 0xCF, 0xFF, 0x00, 0x01, 0xC8, 0x7F,
+    0x00, 0x00, 0x08, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0x3F,
+    0xFF, 0xF0, 0x0F, 0x3F, 0xFF, 0xFF, 0x8F, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x01, 0xFF,
+    0xC0, 0x01, 0xFF, 0x81, 0xF1, 0xFF, 0x07, 0xF1, 0xFF, 0x1F, 0xE3, 0xFF,
+    0x1F, 0x87, 0xFF, 0x1E, 0x0F, 0xFF, 0x80, 0x01, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x67, 0x00, 0xF1, 0xE7, 0x0F, 0xE3, 0xEF, 0x7F, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
+    0xFF, 0xC1, 0xFE, 0x0F, 0xFF, 0x83, 0xFF, 0x0F, 0xFF, 0x87, 0xFF, 0x0F,
+    0xFF, 0x0F, 0xFF, 0x8F, 0xF3, 0x0F, 0xFF, 0x8F, 0xF3, 0x1F, 0xFF, 0x8F,
+    0xE3, 0x1F, 0xFF, 0x0F, 0xC3, 0x1F, 0xFF, 0x1F, 0xC7, 0x0F, 0xFE, 0x1F,
+    0x87, 0x01, 0xFC, 0x3F, 0x8F, 0x81, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC1, 0xF0, 0xFF,
+    0xFF, 0xC7, 0xF8, 0xFF, 0xFF, 0x8F, 0xF8, 0xFF, 0xFB, 0x8F, 0xF0, 0xFF,
+    0xE1, 0x87, 0xF1, 0xFF, 0xC3, 0x87, 0xE3, 0xFF, 0x07, 0xC7, 0xF7, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
+    0xFF, 0xC1, 0xFE, 0x0F, 0xFF, 0x83, 0xFF, 0x0F, 0x8F, 0x87, 0xFF, 0x0F,
+    0x87, 0x0F, 0xFF, 0x8F, 0xC3, 0x0F, 0xFF, 0x8F, 0xE1, 0x1F, 0xFF, 0x8F,
+    0xF1, 0x1F, 0xFF, 0x0F, 0xE3, 0x1F, 0xFF, 0x1F, 0xC7, 0x0F, 0xFE, 0x1F,
+    0x8F, 0x01, 0xFC, 0x3F, 0x8F, 0x81, 0xFF, 0xFF, 0x9F, 0x87, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x9F, 0xC1, 0xF0, 0xFF,
+    0x87, 0xC7, 0xF8, 0xFF, 0xC1, 0x8F, 0xF8, 0xFF, 0xE1, 0x8F, 0xF0, 0xFF,
+    0xE1, 0x87, 0xF1, 0xFF, 0xC3, 0x87, 0xE3, 0xFF, 0x87, 0xC7, 0xF7, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x8F, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x98, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x1F, 0x8F,
+    0x8F, 0x03, 0xFF, 0x8F, 0x87, 0x1F, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x8F,
+    0xE1, 0x1F, 0xFF, 0x0F, 0xF1, 0x0F, 0xFF, 0x1F, 0xE3, 0x0F, 0xFC, 0x1F,
+    0xC7, 0x83, 0xF8, 0x3F, 0x8F, 0x80, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x7F,
+    0xBF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03,
+    0xFF, 0x80, 0x03, 0xFF, 0x03, 0xE3, 0xFE, 0x0F, 0xE3, 0xFE, 0x3F, 0xC7,
+    0xFE, 0x3F, 0x0F, 0xDE, 0x3C, 0x1F, 0x9F, 0x00, 0x03, 0x9E, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x03, 0xE3, 0x00, 0x3F, 0xC7, 0x03, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x0F, 0x8F, 0xFF,
+    0x03, 0x8F, 0x8C, 0xFF, 0x1F, 0x8F, 0x88, 0x3F, 0x1F, 0x8F, 0x80, 0x3F,
+    0x1F, 0x8F, 0x82, 0x3F, 0x1F, 0x8E, 0x07, 0x3F, 0x1F, 0x9C, 0x0F, 0x3F,
+    0x03, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01, 0xFF,
+    0xC0, 0x01, 0xCF, 0x86, 0x31, 0x07, 0x9E, 0x70, 0x07, 0x1C, 0x70, 0xE7,
+    0x18, 0x71, 0xE7, 0x00, 0xE3, 0xEF, 0x01, 0xC7, 0xFF, 0x83, 0xCF, 0xFF,
+    0xCF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x0F, 0x8F,
+    0x87, 0x03, 0x8F, 0x8F, 0xC3, 0x1F, 0x8F, 0x8F, 0xE1, 0x1F, 0x8F, 0x8F,
+    0xF1, 0x1F, 0x8F, 0x8F, 0xE3, 0x1F, 0x8E, 0x0F, 0xC7, 0x1F, 0x9C, 0x0F,
+    0x8F, 0x03, 0xFC, 0x3F, 0x8F, 0x03, 0xFF, 0xFF, 0x9F, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x9F, 0xC3, 0x18, 0xFF,
+    0x87, 0xCF, 0x38, 0xFF, 0xC1, 0x8E, 0x38, 0xFF, 0xE1, 0x8C, 0x38, 0xFF,
+    0xE1, 0x80, 0x71, 0xFF, 0xC3, 0x80, 0xE3, 0xFF, 0x87, 0xC1, 0xE7, 0xFF,
+    0x9F, 0xE7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFB, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x8F, 0xE3, 0x00, 0x0F, 0x8F,
+    0xE3, 0x01, 0xFF, 0x8F, 0xC3, 0x1F, 0xFF, 0x8F, 0x87, 0x1F, 0xFF, 0x8F,
+    0x87, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x3F, 0xE0, 0x07,
+    0xF3, 0x3E, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07, 0xE2, 0x00, 0x01, 0xC7,
+    0xC6, 0x00, 0x1F, 0x8F, 0xC6, 0x01, 0xFF, 0x9F, 0x87, 0x3F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03,
+    0xE7, 0xF0, 0x03, 0xC6, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x23,
+    0xC0, 0x03, 0xE3, 0xC0, 0x7F, 0xE3, 0xC7, 0xFF, 0xE3, 0xC7, 0xFF, 0xE3,
+    0xEF, 0xFF, 0xE3, 0xFF, 0xFF, 0x83, 0x81, 0xFF, 0x03, 0x03, 0xFF, 0x0F,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x9F, 0xF0, 0x03, 0x9F, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0xE3, 0x00, 0x0F, 0xC7, 0x00, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xE3, 0xCF, 0xFF, 0xE7, 0x8F, 0xFF, 0xE4, 0x0F,
+    0x9F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0F, 0x8F, 0x00, 0x3F, 0x8F, 0x1E, 0x3F, 0x8F, 0x1E, 0x7F, 0x8F,
+    0xBE, 0x7F, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0x83, 0x9F, 0xE0, 0x03,
+    0x9F, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0xE3, 0x00, 0x0F, 0xC7,
+    0x00, 0x9F, 0xCF, 0x9F, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFB, 0xE0, 0x03, 0xFF,
+    0xF3, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x00, 0x3F, 0xE3, 0xFF, 0xC0, 0x0F,
+    0xC3, 0xFF, 0xF8, 0x0F, 0x87, 0x9F, 0xC0, 0x0F, 0x87, 0x1C, 0x00, 0x0F,
+    0xCF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0xFF, 0xCF, 0x80, 0xFF,
+    0xFF, 0x88, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFB, 0xC7, 0xF9, 0xFF, 0xE1, 0xCF, 0x80, 0xFF, 0xC3, 0x80, 0x00, 0xFF,
+    0x07, 0x80, 0x00, 0xFF, 0x07, 0x80, 0x00, 0xFF, 0x9F, 0xC0, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0x8F, 0x80, 0x0F, 0xFF, 0x87, 0xE0, 0x03, 0xFF,
+    0xC3, 0xFC, 0x00, 0xFF, 0xF1, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x0F,
+    0xE3, 0xFF, 0xF8, 0x0F, 0xC7, 0x9F, 0xC0, 0x0F, 0x8F, 0x1C, 0x00, 0x0F,
+    0x9F, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0xFF, 0xCF, 0x80, 0xFF,
+    0xFF, 0x88, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0x9F, 0x80, 0x3F, 0xFF, 0x87, 0xF0, 0xFF, 0xFF, 0x81, 0xE3, 0xFF, 0xFF,
+    0xE1, 0xC7, 0xF9, 0xFF, 0xE1, 0xCF, 0x80, 0xFF, 0xC3, 0x80, 0x00, 0xFF,
+    0x87, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xFF, 0xBF, 0xC0, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xE0, 0x3C, 0x0F, 0xC1, 0xFF, 0x0F, 0x83, 0xFF, 0x0F,
+    0x87, 0xFF, 0x8F, 0x8F, 0xFF, 0x8F, 0x0F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x0F, 0x1F, 0xE0, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x0F, 0x8F, 0x01, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F,
+    0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0x8F, 0x1F, 0x8F, 0x0F, 0x1F, 0x9C, 0x0F,
+    0x03, 0xBC, 0x1F, 0x03, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xE0, 0x01, 0xC0, 0x01, 0x83, 0xF1,
+    0x8F, 0xF1, 0x1F, 0xF1, 0x1F, 0xE1, 0x1F, 0xC3, 0x00, 0x07, 0x80, 0x03,
+    0x80, 0x01, 0xC0, 0x01, 0xC3, 0x31, 0x8E, 0x31, 0x1E, 0x71, 0x1C, 0x71,
+    0x18, 0xE3, 0x00, 0xE3, 0x01, 0xC7, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xCF, 0xFC, 0x0F, 0xFF, 0x9F, 0xC0, 0x0F, 0xFF, 0x98, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x8F, 0x87, 0x00, 0x0F, 0xCF,
+    0xC3, 0x03, 0xC7, 0xFF, 0xE1, 0x1F, 0xC1, 0xFF, 0xF1, 0x1F, 0x80, 0x7F,
+    0xE3, 0x1F, 0x00, 0x3F, 0xC7, 0x06, 0x18, 0x1F, 0x8F, 0x80, 0x1E, 0x0F,
+    0x8F, 0x80, 0x3F, 0x0F, 0x9F, 0xC0, 0x7F, 0x8F, 0xFF, 0xE0, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0xC0, 0xFF, 0x8C, 0x00,
+    0xFF, 0x80, 0x00, 0x8F, 0x80, 0x01, 0x83, 0x80, 0x1F, 0xC1, 0xF8, 0x7F,
+    0xE1, 0xE1, 0xFF, 0xE1, 0xC3, 0xFF, 0xC3, 0x87, 0xFF, 0x87, 0x87, 0xFF,
+    0x9F, 0x87, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF9, 0xF8, 0x0F, 0xFF, 0xE0, 0x7E, 0x0F, 0xFF, 0xC0, 0x3F, 0x8F,
+    0xFF, 0x80, 0x1F, 0x8F, 0xFF, 0x80, 0x0F, 0x8F, 0xFB, 0x0E, 0x0F, 0x8F,
+    0xF3, 0x1F, 0x07, 0x8F, 0xE3, 0x1F, 0x00, 0x0F, 0xE3, 0x1F, 0x80, 0x1F,
+    0xC3, 0x0F, 0xC0, 0x1F, 0x87, 0x01, 0xE0, 0x3F, 0x87, 0x83, 0xF0, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xF1, 0xE0, 0xFF, 0xFF, 0xE0, 0xF0, 0xFF, 0xFF, 0xC0, 0x78, 0xFF,
+    0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0x8C, 0x18, 0xFF, 0xFF, 0x8E, 0x00, 0xFF,
+    0xF1, 0x8F, 0x01, 0xFF, 0xC1, 0x87, 0x03, 0xFF, 0x83, 0x87, 0xC7, 0xFF,
+    0x07, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF9, 0xF8, 0x0F, 0xFF, 0xE0, 0x7E, 0x0F, 0xFF, 0xC0, 0x3F, 0x8F,
+    0xDF, 0x80, 0x1F, 0x8F, 0x8F, 0x80, 0x0F, 0x8F, 0x83, 0x0E, 0x0F, 0x8F,
+    0xE1, 0x1F, 0x07, 0x8F, 0xF1, 0x1F, 0x00, 0x0F, 0xE1, 0x1F, 0x80, 0x1F,
+    0xC3, 0x0F, 0xC0, 0x1F, 0xC7, 0x01, 0xE0, 0x3F, 0x8F, 0x83, 0xF0, 0xFF,
+    0x9F, 0x87, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xF1, 0xE0, 0xFF, 0xFF, 0xE0, 0xF0, 0xFF, 0xDF, 0xC0, 0x78, 0xFF,
+    0x87, 0xC0, 0x38, 0xFF, 0x81, 0x8C, 0x18, 0xFF, 0xE1, 0x8E, 0x00, 0xFF,
+    0xF1, 0x8F, 0x01, 0xFF, 0xC3, 0x87, 0x03, 0xFF, 0xC7, 0x87, 0xC7, 0xFF,
+    0x8F, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xCF,
+    0xFF, 0x03, 0xFF, 0xCF, 0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0x1F, 0xF0, 0x0F,
+    0x9F, 0x1F, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F, 0xC3, 0x00, 0x00, 0x0F,
+    0xE1, 0x00, 0x03, 0xCF, 0xF1, 0x00, 0x3F, 0xCF, 0xE3, 0x07, 0xFF, 0xFF,
+    0xC3, 0x1F, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF,
+    0x9F, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9E, 0x01, 0xFF, 0x80, 0x01,
+    0xFE, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0xF1, 0xF8, 0x1F, 0xF1,
+    0xFB, 0x1F, 0xE3, 0xFF, 0x1F, 0xE3, 0xE1, 0x1F, 0xC7, 0x83, 0xBF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x9F, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0x0F,
+    0xFF, 0x03, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x8F, 0xE3, 0x1F, 0xFF, 0x8F,
+    0x81, 0xBF, 0xFF, 0x8F, 0x99, 0xFF, 0xFF, 0x0F, 0x19, 0xFF, 0xFE, 0x0F,
+    0x19, 0xBF, 0xF0, 0x1F, 0x81, 0x1E, 0x00, 0x3F, 0x83, 0x00, 0x00, 0x7F,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE1, 0xFF, 0xFF, 0xCF, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x18, 0xFF,
+    0xFF, 0x81, 0xF8, 0xFF, 0xC1, 0xFF, 0xF1, 0xFF, 0x80, 0xFF, 0xE3, 0xFF,
+    0x9C, 0xFF, 0x87, 0xFF, 0x1C, 0xFE, 0x01, 0xFF, 0x91, 0xC0, 0x00, 0xFF,
+    0x81, 0x80, 0x00, 0xFF, 0xC7, 0x80, 0x00, 0xFF, 0xFF, 0x83, 0xF1, 0xFF,
+    0xFF, 0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x9F, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0x0F,
+    0xFF, 0x03, 0xFF, 0x8F, 0xF1, 0x1F, 0xFF, 0x8F, 0xF3, 0x1F, 0xFF, 0x8F,
+    0xE3, 0xBF, 0xFF, 0x8F, 0xC7, 0xFF, 0xFF, 0x0F, 0x87, 0xFF, 0xFE, 0x0F,
+    0x8F, 0xBF, 0xF0, 0x1F, 0xDB, 0x1E, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x7F,
+    0xE3, 0x00, 0x01, 0xFF, 0xC3, 0x00, 0x0F, 0xFF, 0xC7, 0x01, 0xFF, 0xFF,
+    0x87, 0x1F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE1, 0xFF, 0xFF, 0xCF, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x18, 0xFF,
+    0xF1, 0x81, 0xF8, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF, 0xC3, 0xFF, 0xE3, 0xFF,
+    0x87, 0xFF, 0x87, 0xFF, 0xCF, 0xFE, 0x01, 0xFF, 0xF1, 0xC0, 0x00, 0xFF,
+    0xE1, 0x80, 0x00, 0xFF, 0xC3, 0x80, 0x00, 0xFF, 0x87, 0x83, 0xF1, 0xFF,
+    0xCF, 0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x178 'Ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x3F,
+    0xFC, 0x07, 0xFF, 0x3F, 0xFC, 0x00, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
+    0x8C, 0x00, 0x00, 0x3F, 0x0C, 0x70, 0x00, 0x3F, 0x0C, 0xFE, 0x00, 0x3F,
+    0x0F, 0xFC, 0x0F, 0x3F, 0xFF, 0xF8, 0x3F, 0x3F, 0xFE, 0xE0, 0xFF, 0xFF,
+    0x8C, 0x41, 0xFF, 0xFF, 0x0C, 0x03, 0xFF, 0xFF, 0x0C, 0x0F, 0xFF, 0xFF,
+    0x9C, 0x1F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xE3, 0xFC, 0x0F, 0xFF, 0x81, 0xF8, 0x0F, 0xFF, 0x03, 0xF0, 0x0F,
+    0xFF, 0x0F, 0xE0, 0x0F, 0xFF, 0x1F, 0x80, 0x8F, 0xFB, 0x1F, 0x03, 0x8F,
+    0xF3, 0x1E, 0x07, 0x8F, 0xE3, 0x1C, 0x0F, 0x8F, 0xE3, 0x10, 0x1F, 0x8F,
+    0xC3, 0x00, 0x3F, 0x8F, 0x87, 0x00, 0xFE, 0x0F, 0x87, 0x01, 0xF8, 0x0F,
+    0xCF, 0x03, 0xF8, 0x1F, 0xFF, 0x87, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF3, 0xF0, 0xFF,
+    0xFF, 0xC1, 0xE0, 0xFF, 0xFF, 0x81, 0xC1, 0xFF, 0xFF, 0x87, 0x81, 0xFF,
+    0xFF, 0x87, 0x00, 0xFF, 0xFF, 0x86, 0x18, 0xFF, 0xFB, 0xC4, 0x38, 0xFF,
+    0xE1, 0xC0, 0x78, 0xFF, 0xC3, 0xE0, 0xF0, 0xFF, 0x07, 0x83, 0xE0, 0xFF,
+    0x0F, 0x87, 0xE1, 0xFF, 0x9F, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xC7, 0xF8, 0x1F, 0xFF, 0x03, 0xF0, 0x1F, 0xFE, 0x07, 0xE0, 0x1F,
+    0xFE, 0x1F, 0xC0, 0x1F, 0xFE, 0x3F, 0x01, 0x1F, 0xFE, 0x3E, 0x07, 0x1F,
+    0xC6, 0x3C, 0x0F, 0x1F, 0x86, 0x38, 0x1F, 0x1F, 0x86, 0x20, 0x3F, 0x1F,
+    0x8E, 0x00, 0x7F, 0x1F, 0xFE, 0x01, 0xFC, 0x1F, 0xFE, 0x03, 0xF0, 0x1F,
+    0xFE, 0x07, 0xF0, 0x3F, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xCF, 0xC3, 0xFF, 0x07, 0x83,
+    0xFE, 0x07, 0x07, 0xFE, 0x1E, 0x07, 0xFE, 0x1C, 0x03, 0x8E, 0x18, 0x63,
+    0x0F, 0x10, 0xE3, 0x0F, 0x01, 0xE3, 0x0F, 0x83, 0xC3, 0xFE, 0x0F, 0x83,
+    0xFE, 0x1F, 0x87, 0xFE, 0x3F, 0xEF, 0xFF, 0x7F, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xE3, 0xFC, 0x0F, 0xFF, 0x81, 0xF8, 0x0F, 0xFF, 0x03, 0xF0, 0x0F,
+    0xFF, 0x0F, 0xE0, 0x0F, 0x8F, 0x1F, 0x80, 0x8F, 0x87, 0x1F, 0x03, 0x8F,
+    0xC3, 0x1E, 0x07, 0x8F, 0xF1, 0x1C, 0x0F, 0x8F, 0xE1, 0x10, 0x1F, 0x8F,
+    0xE3, 0x00, 0x3F, 0x8F, 0xC7, 0x00, 0xFE, 0x0F, 0x8F, 0x01, 0xF8, 0x0F,
+    0x9F, 0x03, 0xF8, 0x1F, 0xBF, 0x87, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF3, 0xF0, 0xFF,
+    0xFF, 0xC1, 0xE0, 0xFF, 0xFF, 0x81, 0xC1, 0xFF, 0x9F, 0x87, 0x81, 0xFF,
+    0x87, 0x87, 0x00, 0xFF, 0x81, 0x86, 0x18, 0xFF, 0xE1, 0xC4, 0x38, 0xFF,
+    0xE1, 0xC0, 0x78, 0xFF, 0xC3, 0xE0, 0xF0, 0xFF, 0x87, 0x83, 0xE0, 0xFF,
+    0x8F, 0x87, 0xE1, 0xFF, 0xBF, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFD, 0xFF, 0xF9, 0xC7, 0xE1, 0x8F, 0x81, 0x8E, 0x01, 0x00, 0x07,
+    0x00, 0x1F, 0x00, 0xFF, 0x07, 0xFF, 0x0F, 0x83, 0x0C, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0xF1, 0x0F, 0xF3, 0x0F, 0xE3, 0x1F, 0xFF, 0x1F, 0xFF,
+    0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+    0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x1F, 0x87, 0xFE, 0x0F, 0x0F, 0xFC, 0x0F,
+    0x1F, 0x1F, 0x8F, 0x1E, 0x0F, 0xCF, 0x1C, 0x0F, 0xCF, 0x18, 0x07, 0x8F,
+    0x00, 0x80, 0x0F, 0x81, 0xC0, 0x1F, 0x87, 0xE0, 0x1F, 0xCF, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F,
+    // 0x2018 '‘'
+    0xFC, 0xFF, 0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x0F, 0xFF, 0x3F, 0xFF,
+    0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03, 0xFF,
+    0x8F, 0xFF,
+    // 0x201A '‚'
+    0xFE, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x03, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x201B '‛'
+    0xFF, 0xFF, 0x83, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x98, 0x7F, 0xFE, 0x7F,
+    0xFF, 0xFF,
+    // 0x201C '“'
+    0xFC, 0xFF, 0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x0F, 0xFF, 0x3F, 0xFF,
+    0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x0F, 0xFF, 0x3F, 0xFF,
+    0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF,
+    0x8F, 0xFF, 0xFE, 0x7F, 0xF8, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x83, 0xFF,
+    0x8F, 0xFF,
+    // 0x201E '„'
+    0xFE, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x03, 0xFF, 0x87, 0xFF,
+    0xFE, 0x7F, 0xF8, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x8F, 0xFF,
+    // 0x201F '‟'
+    0xFF, 0xFF, 0x83, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x98, 0x7F, 0xFE, 0x7F,
+    0x87, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xBC, 0x7F, 0xFF, 0x7F,
+    // 0x2020 '†'
+    0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0x3F, 0xF8, 0xF8, 0x3F,
+    0xF8, 0x80, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xFF,
+    0x18, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFC, 0xFC, 0x7F, 0xF8, 0xFC, 0xFF,
+    0xF8, 0xFC, 0xC7, 0xF8, 0xFC, 0x07, 0xF8, 0x80, 0x07, 0x80, 0x00, 0x3F,
+    0x00, 0x04, 0xFF, 0x00, 0xFC, 0xFF, 0x18, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F,
+    0xF8, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xC3, 0x83, 0x81, 0x81, 0x83, 0x83, 0xFF,
+    // 0x2026 '…'
+    0xCF, 0x0F, 0x0F, 0x0F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07,
+    0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x0F, 0x0F, 0xBF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x3F, 0x86, 0x1F,
+    0x8F, 0x9F, 0x1F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x1F, 0x9E, 0x1F, 0x84, 0x3F, 0x80, 0x7F,
+    0xC0, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x07, 0xE0, 0x03, 0xC1, 0xE3, 0x8F, 0xF3,
+    0x9F, 0xE3, 0x9F, 0xC7, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x3F, 0xE0, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x9F, 0xF1, 0x9F,
+    0xE3, 0x83, 0xC6, 0x03, 0x80, 0x03, 0x80, 0x1F, 0x83, 0x9F, 0xFF, 0xBF,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xF3, 0xE7, 0x83, 0xC7, 0x03, 0xC7,
+    0x11, 0x8F, 0x10, 0x0F, 0x18, 0x1F, 0x1C, 0x3F, 0x1F, 0xFF, 0x3F, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0x0F, 0xF8, 0x07, 0xF0, 0x03, 0xE0, 0xE3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0x8C, 0xE3, 0x8C, 0x07, 0x9C, 0x07, 0x9E, 0x1F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xEF, 0xFF, 0x07, 0x87, 0x0F, 0x07, 0x1E, 0x07, 0x18, 0x3F, 0x10, 0x7F,
+    0x01, 0xFF, 0x03, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0x87, 0xFF, 0x07, 0xE0, 0x03, 0xC0, 0x63, 0x80, 0xF3, 0x9C, 0x73,
+    0x9C, 0x03, 0x80, 0x07, 0x81, 0x0F, 0xC3, 0x9F, 0xEF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xF7, 0xFF, 0xF3, 0xE0, 0xF3, 0xC0, 0x63, 0x80, 0x63, 0x8E, 0x67,
+    0x9E, 0x07, 0x9E, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0x83, 0xC7, 0x1F, 0xE7,
+    0x1F, 0xC7, 0x3F, 0x8F, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x7F, 0xC1, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xCF, 0xF3, 0xCF, 0xC3, 0xC8, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x83, 0xF3, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xEF, 0x87, 0x87, 0x87, 0x8F, 0x07, 0x1E, 0x07,
+    0x1C, 0x47, 0x38, 0xC7, 0x00, 0xC7, 0x01, 0xC7, 0x83, 0xEF, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xE7, 0xFF, 0xE7, 0xCF, 0xE7, 0x8C, 0xE7, 0x18, 0xC7, 0x38, 0xC7,
+    0x30, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x8F, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x07, 0x8C, 0x07, 0x00, 0x07, 0x00, 0x3F, 0x07, 0x3F, 0xFF, 0x7F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xF3, 0xE7, 0x83, 0xC7, 0x03, 0xC7,
+    0x11, 0x8F, 0x10, 0x0F, 0x18, 0x1F, 0x1C, 0x3F, 0x1F, 0xFF, 0x3F, 0xFF,
+    // 0x2086 '₆'
+    0xFE, 0x1F, 0xF0, 0x0F, 0xE0, 0x07, 0xC1, 0xC7, 0x81, 0xE7, 0x89, 0xE7,
+    0x19, 0xC7, 0x18, 0x0F, 0x38, 0x0F, 0x3C, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xEF, 0xFF, 0x87, 0xC7, 0x0F, 0x07, 0x1E, 0x07, 0x18, 0x3F, 0x10, 0x7F,
+    0x01, 0xFF, 0x03, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x0F, 0xFE, 0x0F, 0xC0, 0x07, 0x80, 0xE7, 0x01, 0xE7, 0x38, 0xE7,
+    0x38, 0x07, 0x00, 0x0F, 0x02, 0x1F, 0x87, 0x3F, 0xDF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xE1, 0xE7, 0x80, 0xE7, 0x80, 0xC7, 0x1C, 0xCF,
+    0x3C, 0x0F, 0x3C, 0x1F, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0xFF, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x23, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F,
+    0xE0, 0x26, 0x0F, 0xC3, 0x27, 0x0F, 0x87, 0x27, 0x8F, 0x8F, 0x27, 0x8F,
+    0x8F, 0x27, 0x8F, 0x8F, 0x2F, 0x8F, 0x8F, 0x7F, 0x8F, 0x8F, 0xFF, 0x1F,
+    0x83, 0xFF, 0x1F, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0xFF, 0xFF, 0x8F, 0xBF, 0x0F, 0x3F, 0x38, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x1F, 0xFF, 0x3F, 0xFF, 0x0F, 0xFF, 0x1F, 0x3F, 0xFC, 0x3F, 0xA0, 0x3F,
+    0x03, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xE3, 0xBF, 0x84, 0x3F,
+    0x80, 0x3F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xF3, 0xFF, 0xE7, 0xC3, 0xFF,
+    0xC4, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xF3, 0xC1, 0xF3, 0xE3,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xE7, 0xC1, 0xFF, 0xE7,
+    0x87, 0xCE, 0xE7, 0x8F, 0x8C, 0xE7, 0xDF, 0x9C, 0xE7, 0xFF, 0x18, 0xC7,
+    0xFF, 0x10, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x82, 0x3F, 0xFF, 0xCF, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xF7, 0xE3, 0xFF, 0xE3, 0xC3, 0xFF,
+    0xC3, 0x83, 0xFF, 0xC7, 0x93, 0xFF, 0xCF, 0x13, 0xFF, 0xCE, 0x33, 0xF7,
+    0xC0, 0x73, 0xE3, 0xC0, 0xF3, 0xC1, 0xE1, 0xF7, 0x07, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0xE7,
+    0xC1, 0xFF, 0xE7, 0x83, 0xCE, 0xE7, 0x87, 0x8C, 0xE7, 0x9F, 0x9C, 0xE7,
+    0xFF, 0x18, 0xC7, 0xFF, 0x10, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x82, 0x3F,
+    0xFF, 0xCF, 0xFF,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xEF, 0xF3, 0xFF, 0xE7, 0xC3, 0xFF,
+    0xC4, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xF3, 0xC1, 0xF3, 0xE3,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0x0F, 0xC1, 0xE6, 0x07,
+    0x83, 0xC0, 0x07, 0x8F, 0x80, 0xE7, 0xDF, 0x98, 0xE7, 0xFF, 0x38, 0xE7,
+    0xFF, 0x38, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x83, 0x1F, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xE7, 0xF1, 0xFF, 0xC6, 0x71, 0xFF,
+    0xC6, 0x73, 0xFF, 0xCE, 0x63, 0xFF, 0xCC, 0x03, 0xE3, 0xC0, 0x07, 0xC1,
+    0xC1, 0x0F, 0x83, 0xE3, 0xFE, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xFF, 0x0F, 0x83, 0xE6, 0x07,
+    0x87, 0xC0, 0x07, 0x8F, 0x80, 0xE7, 0xFF, 0x98, 0xE7, 0xFF, 0x38, 0xE7,
+    0xFF, 0x38, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x83, 0x1F, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xF8, 0xF1, 0xFF,
+    0xC0, 0xF1, 0xFF, 0xC0, 0xF3, 0xFF, 0xC4, 0x63, 0xFF, 0xCC, 0x07, 0xE3,
+    0xCC, 0x07, 0xC1, 0xCE, 0x0F, 0x87, 0xCF, 0xFE, 0x0F, 0xDF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF, 0x0F,
+    0x83, 0xE6, 0x07, 0x87, 0xC0, 0x07, 0x9F, 0x80, 0xE7, 0xFF, 0x98, 0xE7,
+    0xFF, 0x38, 0xE7, 0xFF, 0x38, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x83, 0x1F,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215E '⅞'
+    0xF3, 0xFF, 0xFF, 0xC3, 0xE1, 0xFF, 0xC3, 0xC1, 0xFF, 0xCF, 0x03, 0xFF,
+    0xCE, 0x0F, 0xF3, 0xCC, 0x3F, 0xC3, 0xC0, 0x7F, 0x83, 0xC1, 0xFF, 0x0F,
+    0xC3, 0xFC, 0x1F, 0xC7, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0x07, 0xE6, 0x07, 0x8F, 0xC0, 0x07,
+    0xFF, 0x80, 0xE7, 0xFF, 0x98, 0xE7, 0xFF, 0x38, 0xE7, 0xFF, 0x38, 0x07,
+    0xFF, 0x00, 0x0F, 0xFF, 0x83, 0x1F, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2190 '←'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x08, 0x8F,
+    0x98, 0x8F, 0xD8, 0xDF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0xC3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xD8, 0xDF, 0x98, 0x8F,
+    0x08, 0x8F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0x88, 0x8F,
+    0xD8, 0x9F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xD8, 0x9F,
+    0x88, 0x8F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2195 '↕'
+    0xFB, 0xFB, 0xFF, 0xF1, 0xF1, 0xFF, 0xE1, 0xF0, 0xFF, 0xC3, 0xF8, 0x7F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0xC3, 0xF8, 0x7F, 0xE1, 0xF0, 0xFF, 0xF1, 0xF1, 0xFF, 0xFB, 0xFB, 0xFF,
+    // 0x21D0 '⇐'
+    0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x8F, 0xE1, 0x87, 0xC1, 0x83,
+    0x81, 0x81, 0x89, 0x88, 0xD9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xE1, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE1, 0xF8, 0x3F,
+    0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F,
+    0xF9, 0x8F, 0xF9, 0x8F, 0xF9, 0x8F, 0xD9, 0x8F, 0x89, 0x88, 0x81, 0x81,
+    0xC1, 0x83, 0xE1, 0x87, 0xF0, 0x8F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFE, 0x7F,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF,
+    0x83, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x87, 0xF1, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFC, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xE1, 0x1F, 0xC3, 0x0F, 0x83, 0x03,
+    0x83, 0x03, 0xD3, 0x37, 0xF3, 0x3F, 0xF3, 0x3F, 0xD3, 0x37, 0x83, 0x03,
+    0x83, 0x07, 0xC3, 0x0F, 0xE1, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xCF, 0xC0, 0x03,
+    0x8F, 0x80, 0x03, 0x9F, 0x0F, 0xE3, 0x1F, 0x1F, 0xE3, 0x1E, 0x3F, 0xE3,
+    0x1E, 0x3F, 0xC3, 0x0E, 0x3F, 0x07, 0x01, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F,
+    0xFF, 0x80, 0x0F, 0xFC, 0x01, 0x8F, 0xF0, 0x0F, 0x8F, 0xC0, 0x7F, 0x8F,
+    0x81, 0xFF, 0x8F, 0x03, 0xFF, 0x8F, 0x00, 0x7F, 0x8F, 0x00, 0x0F, 0x8F,
+    0xC0, 0x01, 0x8F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xCF,
+    // 0x220F '∏'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0xFF, 0x87, 0xFF, 0xE0, 0xFF,
+    0x03, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x7E, 0x00, 0xFF,
+    0x00, 0x1C, 0x08, 0xFF, 0x18, 0x08, 0x38, 0xFF, 0x1C, 0x00, 0x78, 0xFF,
+    0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x81, 0xF8, 0xFF, 0x1F, 0xE7, 0xF8, 0xFF,
+    0x1F, 0xFF, 0xF8, 0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0x03, 0xFF, 0xE0, 0xFF,
+    0x01, 0xFF, 0xC0, 0x7F, 0x83, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xE1, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0x0E, 0x3F, 0x1E, 0x3F, 0x1E, 0x3F,
+    0x8C, 0x7F, 0x80, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x8C, 0x3F,
+    0x1E, 0x3F, 0x1E, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xF3, 0x9F, 0xF3, 0x8F, 0xF3, 0x87, 0xF3, 0x83, 0xF3, 0x83, 0xF0, 0x0F,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xC1, 0x8F, 0x83, 0x8F, 0xC3, 0x8F, 0xF3, 0x8F,
+    0xF3, 0x8F,
+    // 0x2264 '≤'
+    0xFD, 0xFE, 0x7F, 0xF8, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xF0, 0x7C, 0x7F,
+    0xF0, 0x7C, 0x7F, 0xE2, 0x3C, 0x7F, 0xE2, 0x3C, 0x7F, 0xC7, 0x1C, 0x7F,
+    0xC7, 0x1C, 0x7F, 0x8F, 0x8C, 0x7F, 0x8F, 0x84, 0x7F, 0x1F, 0xC4, 0x7F,
+    0xDF, 0xDC, 0x7F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0x3F, 0x8F, 0xE6, 0x3F, 0x8F, 0xC6, 0x3F, 0xC7, 0xC6, 0x3F,
+    0xC7, 0xCE, 0x3F, 0xE3, 0x8E, 0x3F, 0xE3, 0x9E, 0x3F, 0xF1, 0x1E, 0x3F,
+    0xF0, 0x1E, 0x3F, 0xF8, 0x3E, 0x3F, 0xF8, 0x3E, 0x3F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x3F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BoldItalicBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x33, 0x00, 0x03, 0x47, 0x02, 0xC0, 0x47, 0x10, 0x01, 0x43,
+    0x00, 0x0A, 0x03, 0x80, 0x80, 0x03, 0x06, 0x00, 0x03, 0x30, 0x00, 0x03,
+    0x80, 0x00, 0x03,
+    // 0x22 '"'
+    0x01, 0x9F, 0x30, 0x5F, 0x00, 0x1F, 0x01, 0x1F, 0x14, 0x1F, 0x41, 0x9F,
+    0x30, 0x5F, 0x00, 0x1F, 0x01, 0x1F, 0x14, 0x1F, 0x40, 0x1F,
+    // 0x23 '#'
+    0x00, 0x08, 0x3F, 0x06, 0x00, 0x3F, 0x0A, 0x02, 0x3F, 0x0A, 0x00, 0x3F,
+    0x08, 0x00, 0x3F, 0x20, 0x02, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x2A, 0x00, 0xBF, 0x0A, 0x00, 0x3F, 0x0A, 0x80, 0x3F, 0x20, 0x01, 0xBF,
+    0x80, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x0A, 0x00, 0x3F, 0x8A, 0x30, 0x3F,
+    0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x58, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+    0x00, 0x10, 0x42, 0x6F, 0x02, 0x04, 0x01, 0x07, 0x00, 0x00, 0x20, 0x37,
+    0x01, 0xC2, 0x80, 0x07, 0x08, 0x20, 0x20, 0x07, 0x03, 0x00, 0x88, 0x07,
+    0x18, 0x10, 0x80, 0x07, 0x41, 0x48, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x40, 0x60, 0x08, 0x07, 0x00, 0x20, 0x20, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x01, 0x00, 0x01, 0x04, 0x08, 0x01, 0x10, 0x00, 0x01, 0x20, 0xC4, 0x01,
+    0x00, 0x00, 0x05, 0x08, 0x04, 0x11, 0x40, 0x20, 0x01, 0x47, 0x88, 0x85,
+    0x00, 0x01, 0x11, 0x20, 0x20, 0x21, 0x00, 0xC8, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x24, 0x01, 0x00, 0x00, 0x01, 0x01, 0x11, 0x01, 0x00, 0x44, 0x01,
+    0x08, 0x10, 0x01, 0x21, 0x00, 0xC1, 0x44, 0x26, 0x11, 0x80, 0x00, 0x11,
+    0x10, 0x40, 0x05, 0x00, 0x47, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0xC1, 0x00, 0x00, 0x01,
+    // 0x26 '&'
+    0x00, 0x02, 0x41, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x20, 0x09,
+    0x00, 0x00, 0x41, 0x07, 0xC0, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x25,
+    0x40, 0x00, 0x81, 0x08, 0x30, 0x01, 0x91, 0x04, 0x09, 0x82, 0x02, 0x09,
+    0x90, 0xA9, 0x01, 0x81, 0x08, 0x09, 0x02, 0x00, 0x05, 0x28, 0x00, 0x25,
+    0x00, 0x00, 0xA1, 0x00, 0x00, 0x03, 0x00, 0x90, 0x03, 0x00, 0x20, 0x13,
+    0x00, 0x20, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x27 '''
+    0x01, 0x9F, 0x30, 0x5F, 0x00, 0x1F, 0x01, 0x1F, 0x14, 0x1F, 0x40, 0x1F,
+    // 0x28 '('
+    0x00, 0x0A, 0x14, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x80, 0x00, 0x47,
+    0x02, 0x03, 0x20, 0x07, 0x00, 0x00, 0x06, 0x07, 0x08, 0x40, 0x01, 0x8F,
+    0x10, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x20, 0x00, 0x02, 0x27,
+    0x08, 0x00, 0x04, 0x07, 0x04, 0x00, 0x00, 0x07, 0x01, 0x00, 0xC0, 0x07,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x07,
+    0x00, 0x99, 0x00, 0x07,
+    // 0x2A '*'
+    0x00, 0x3F, 0x28, 0xBF, 0x08, 0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x02, 0x3F, 0x03, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x04, 0x3F,
+    // 0x2B '+'
+    0x05, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F,
+    0x00, 0x07, 0x00, 0x07, 0x78, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x01, 0x7F, 0x02, 0x7F, 0x08, 0xFF, 0x01, 0x7F, 0x02, 0x7F, 0x04, 0x7F,
+    0x98, 0x7F, 0x00, 0x7F,
+    // 0x2D '-'
+    0xDF, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xEF,
+    // 0x2E '.'
+    0x17, 0x8F, 0x07, 0x07, 0x17,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x01, 0x00, 0x04, 0x21, 0x00, 0x00, 0x41, 0x00, 0x40, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x08, 0x01, 0x08, 0x00, 0x01, 0x10, 0x80, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x10, 0x07, 0x00, 0x80, 0x47, 0x02, 0x00, 0x07, 0x08, 0x00, 0x17,
+    0x00, 0x1E, 0x07, 0x20, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x80, 0x00, 0x97, 0x90, 0x01, 0x07, 0x80, 0x00, 0x07,
+    0x83, 0xC0, 0x47, 0x00, 0x00, 0x87, 0x00, 0x01, 0x07, 0x20, 0x00, 0x07,
+    0x18, 0x50, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x28, 0x0A, 0x0F, 0x08, 0xA0, 0x0F, 0x44, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x01, 0x4F, 0x80, 0x28, 0x4F, 0x85, 0x00, 0x1F, 0x40, 0x00, 0x0F,
+    // 0x32 '2'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x12, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x04, 0x08, 0x8F, 0x08, 0x01, 0x8F,
+    0x10, 0x02, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x8A, 0x08, 0x8F,
+    0x00, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x40, 0x2F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x33 '3'
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x18, 0x00, 0x4F,
+    0x20, 0x00, 0x4F, 0x00, 0x40, 0x07, 0x04, 0x40, 0x07, 0x08, 0x00, 0x07,
+    0x80, 0x80, 0x07, 0x80, 0x01, 0x07, 0x90, 0x02, 0x27, 0x8E, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x40, 0xA0, 0x87, 0x01, 0x02, 0x07, 0x0A, 0x00, 0x07,
+    // 0x34 '4'
+    0x00, 0x06, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x21, 0x0F, 0x00, 0x41, 0x0F,
+    0x00, 0x81, 0x0F, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0F, 0x04, 0x01, 0x0F,
+    0x08, 0x01, 0x8F, 0x10, 0x18, 0x0F, 0x21, 0x40, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x8F, 0x80, 0x59, 0x0F, 0x86, 0x01, 0x0F, 0x20, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x57, 0x00, 0x00, 0x47, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x07,
+    0x20, 0x40, 0x07, 0x00, 0x00, 0x87, 0x00, 0x00, 0x17, 0x0A, 0x00, 0x17,
+    0x00, 0x10, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x87,
+    0x00, 0x40, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0x36 '6'
+    0x00, 0x29, 0x07, 0x00, 0x80, 0x27, 0x01, 0x00, 0x07, 0x04, 0x00, 0x17,
+    0x08, 0x09, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x03, 0x00, 0x47,
+    0x05, 0x20, 0x87, 0x00, 0x1F, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x90, 0x40, 0x47, 0x90, 0x12, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07,
+    // 0x37 '7'
+    0x04, 0x00, 0xA7, 0x01, 0x03, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x20, 0x67, 0x00, 0x01, 0x87, 0x00, 0x82, 0x07, 0x00, 0x00, 0x07,
+    0x04, 0x10, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x50, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x47, 0x00, 0x08, 0x07, 0x06, 0x00, 0x07,
+    0x10, 0x20, 0x07, 0x20, 0x20, 0x87, 0x00, 0x08, 0x4F, 0x40, 0x00, 0x0F,
+    0x01, 0x10, 0x47, 0x80, 0x88, 0x07, 0x90, 0x04, 0x97, 0x91, 0x00, 0x17,
+    0x8E, 0x60, 0x27, 0x00, 0x10, 0x47, 0x00, 0x81, 0x07, 0x21, 0x00, 0x07,
+    0x14, 0x00, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x80, 0x4F,
+    0x00, 0x20, 0x47, 0x20, 0x00, 0x07, 0x00, 0x08, 0x07, 0x41, 0x00, 0x07,
+    0x08, 0x41, 0x07, 0x90, 0x20, 0x07, 0x80, 0x20, 0x07, 0x90, 0x20, 0x47,
+    0x88, 0x00, 0x07, 0x03, 0x00, 0x07, 0x00, 0x02, 0x07, 0x20, 0x08, 0x07,
+    0x00, 0x30, 0x07, 0x07, 0x00, 0x07,
+    // 0x3A ':'
+    0x00, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x08, 0x00,
+    0x88, 0x00, 0x60, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x80, 0x13, 0x0F, 0x08, 0x00, 0x0F,
+    0x88, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    // 0x3C '<'
+    0x04, 0x07, 0x01, 0x07, 0x08, 0x07, 0x00, 0x87, 0x10, 0x47, 0x00, 0x47,
+    0x25, 0x27, 0x00, 0x27, 0x40, 0x97, 0x40, 0x87, 0x80, 0x4F, 0x80, 0x4F,
+    0x40, 0x37,
+    // 0x3D '='
+    0x00, 0xFF, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F,
+    0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F, 0x94, 0x7F,
+    0x90, 0x7F,
+    // 0x3E '>'
+    0x20, 0x07, 0x80, 0x2F, 0x00, 0x47, 0x00, 0x47, 0x00, 0x17, 0x00, 0x87,
+    0x00, 0x27, 0x00, 0x07, 0x10, 0x47, 0x00, 0x07, 0x08, 0x87, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x3F '?'
+    0x10, 0x0A, 0x1B, 0x44, 0x11, 0x07, 0x00, 0x00, 0x47, 0x80, 0x40, 0x43,
+    0x88, 0x91, 0x13, 0x81, 0x02, 0x03, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03,
+    0x21, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x40 '@'
+    0x00, 0x03, 0xC0, 0x3F, 0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x04, 0x08, 0x20, 0x3F, 0x08, 0x40, 0x00, 0xBF,
+    0x10, 0x00, 0x04, 0xBF, 0x00, 0x04, 0x80, 0x3F, 0x04, 0x30, 0x22, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x02, 0x02, 0x7F, 0x41, 0x00, 0x22, 0x7F,
+    0x10, 0x40, 0x22, 0x7F, 0x02, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x80, 0x3F,
+    0x90, 0x50, 0x20, 0xBF, 0x90, 0x00, 0x00, 0xBF, 0x80, 0x0A, 0x80, 0x3F,
+    0x92, 0x60, 0x86, 0x3F, 0x01, 0x00, 0x20, 0x3F, 0x40, 0x01, 0x20, 0x3F,
+    0x44, 0x04, 0x40, 0x3F, 0x00, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x08, 0x02, 0x00, 0x3F, 0x05, 0xE8, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x2F, 0x02, 0x10, 0x0F, 0x00, 0x20, 0x0F, 0x20, 0x80, 0x0F,
+    0x40, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x80, 0x20, 0x4F, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0x02, 0x80, 0x0F, 0x00, 0x14, 0x0F, 0x00, 0x00, 0xCF,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    // 0x42 'B'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x05, 0x07,
+    0x10, 0x40, 0x07, 0x9A, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x03, 0x07,
+    0x00, 0x10, 0x07, 0x0A, 0x80, 0x07, 0x20, 0x90, 0x47, 0x00, 0x90, 0x17,
+    0x90, 0x81, 0x17, 0x0A, 0x00, 0x07, 0x00, 0x00, 0x27, 0x40, 0x80, 0x07,
+    0x20, 0x01, 0x87, 0x0C, 0x00, 0x07,
+    // 0x43 'C'
+    0x00, 0x00, 0x07, 0x00, 0xC1, 0x87, 0x00, 0x00, 0x47, 0x08, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x20, 0x44, 0x07, 0x03, 0x01, 0x07, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x87, 0x90, 0x00, 0x87,
+    0x00, 0x00, 0x97, 0x10, 0x00, 0x07, 0x8E, 0x00, 0x07, 0x02, 0x02, 0x47,
+    0x80, 0x01, 0x07, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x44 'D'
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x05, 0x07,
+    0x10, 0x50, 0x07, 0x9A, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x02, 0x87,
+    0x80, 0x50, 0x47, 0x06, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x97,
+    0x10, 0x00, 0x87, 0x90, 0x01, 0x07, 0x08, 0x00, 0x27, 0x80, 0x08, 0x27,
+    0x40, 0x80, 0x07, 0x00, 0x00, 0x87, 0x20, 0x00, 0x07, 0x18, 0x04, 0x07,
+    0x00, 0x90, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xCF,
+    0x00, 0x10, 0x0F, 0x06, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F,
+    0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x20, 0x0F, 0x02, 0x00, 0x6F,
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xCF,
+    0x00, 0x00, 0x4F, 0x05, 0x00, 0x2F, 0x10, 0x40, 0x0F, 0x00, 0x40, 0x0F,
+    0x10, 0x40, 0x0F, 0x10, 0x40, 0x0F, 0x12, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0xC8, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x20, 0x44, 0x17, 0x03, 0x01, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x4F, 0x90, 0x20, 0x07,
+    0x00, 0x20, 0x07, 0x00, 0x25, 0x07, 0x10, 0x20, 0x07, 0x90, 0x20, 0x07,
+    0x02, 0x20, 0x07, 0x82, 0x25, 0x07, 0x50, 0x28, 0x07, 0x00, 0x00, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x8F,
+    0x00, 0x18, 0x0F, 0x05, 0x80, 0x2F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x1F,
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x14, 0x0F,
+    0x02, 0x80, 0x0F, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x0A, 0x4F,
+    0x01, 0x40, 0x2F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x02, 0x8F,
+    0xA0, 0x50, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x00, 0x28, 0x4F, 0x05, 0x00, 0x2F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x80, 0xBF, 0xA0, 0x28, 0x01, 0x3F,
+    0x05, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x14, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x05, 0x07,
+    0xA0, 0x40, 0x07, 0x0A, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x02, 0x87,
+    0x00, 0x00, 0x07, 0x0A, 0x84, 0x07, 0x01, 0x02, 0x07, 0x22, 0x00, 0x07,
+    0xC4, 0x20, 0x47, 0x00, 0x08, 0x07, 0x21, 0x04, 0x17, 0x22, 0x00, 0x07,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xCF,
+    0x00, 0x28, 0x0F, 0x05, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x4F,
+    0xC0, 0x00, 0x8F, 0x00, 0x01, 0x0F, 0x00, 0x04, 0x1F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x8F,
+    0x00, 0x04, 0x0F, 0x40, 0x80, 0x0F, 0x26, 0x01, 0x0F, 0x10, 0x04, 0x0F,
+    0x00, 0x80, 0x0F, 0x06, 0x00, 0x0F, 0x00, 0x90, 0x0F, 0x00, 0x02, 0x8F,
+    0x00, 0x00, 0x4F, 0x1B, 0x00, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x08, 0x1F, 0x00, 0x20, 0x2F, 0x10, 0xC0, 0x4F, 0x61, 0x01, 0xCF,
+    0x84, 0xE0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x8F,
+    0x1E, 0x00, 0x0F, 0x20, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x05, 0x07,
+    0xA0, 0x50, 0x07, 0x0A, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x28, 0x07,
+    0x01, 0x00, 0x27, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x06, 0x01, 0x87, 0x00, 0x80, 0x67, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    0xA0, 0x50, 0x07, 0x06, 0x00, 0x07, 0x00, 0x01, 0x47, 0x00, 0x08, 0x07,
+    0x02, 0x80, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0x00, 0x07, 0x01, 0x81, 0x87, 0x04, 0x00, 0x47, 0x08, 0x00, 0x27,
+    0x10, 0x00, 0x17, 0x20, 0x34, 0x07, 0x41, 0x01, 0x07, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x0F, 0x10, 0x00, 0x07, 0x90, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x10, 0x01, 0x07, 0x00, 0x00, 0x07, 0x8C, 0x10, 0x07, 0x80, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x10, 0x06, 0x07, 0x0A, 0x70, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0x10, 0x40, 0x0F, 0x9A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xCF,
+    0x80, 0x40, 0x4F, 0x0A, 0x20, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x08, 0x0F, 0x8D, 0x00, 0x0F, 0x80, 0x10, 0x0F, 0x00, 0x20, 0x0F,
+    0x40, 0x40, 0x0F, 0x11, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x01, 0x80, 0x1F, 0x04, 0x00, 0x40, 0x1F,
+    0x08, 0x00, 0x20, 0x1F, 0x10, 0x00, 0x10, 0x1F, 0x20, 0x34, 0x00, 0x1F,
+    0x40, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x40, 0x1F, 0x90, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x80, 0x1F,
+    0x10, 0x01, 0x14, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x10, 0x24, 0x5F,
+    0x80, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x82, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x10, 0x06, 0x02, 0x1F, 0x0A, 0x60, 0x02, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    // 0x52 'R'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x05, 0x07,
+    0x10, 0x40, 0x07, 0x9A, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x02, 0x87,
+    0x80, 0x48, 0x07, 0x0A, 0x0C, 0x07, 0x20, 0x41, 0x07, 0x00, 0x40, 0x07,
+    0x90, 0x00, 0x27, 0x87, 0x04, 0x17, 0x80, 0x22, 0x07, 0x00, 0x01, 0x07,
+    0x40, 0x00, 0x8F, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x27, 0x00, 0x04, 0x17, 0x09, 0x00, 0x17,
+    0x20, 0x46, 0x07, 0x40, 0x20, 0x07, 0x00, 0x00, 0x4F, 0x8C, 0x10, 0x4F,
+    0x80, 0x08, 0x47, 0x01, 0x00, 0x87, 0x00, 0x03, 0x17, 0x00, 0x00, 0x17,
+    0x8C, 0x40, 0x07, 0x00, 0x20, 0x07, 0x82, 0x06, 0x07, 0x50, 0x00, 0x07,
+    // 0x54 'T'
+    0x00, 0x00, 0x0F, 0x22, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x4F,
+    0x00, 0x00, 0xCF, 0x10, 0x04, 0x0F, 0x11, 0x40, 0x0F, 0x18, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x06, 0x4F, 0x00, 0xA0, 0x1F, 0x14, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x12, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    // 0x55 'U'
+    0x60, 0x08, 0x07, 0x81, 0x40, 0x27, 0x14, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x60, 0x87, 0x0A, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x87, 0x00, 0x00, 0x97, 0x00, 0x01, 0x07,
+    0x20, 0x14, 0x07, 0x02, 0x80, 0x07, 0x10, 0x00, 0x87, 0x00, 0x03, 0x07,
+    0x00, 0x28, 0x07, 0x05, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x80, 0x07,
+    0x00, 0x16, 0x07, 0x00, 0x00, 0x57, 0x00, 0x00, 0x07, 0x04, 0x80, 0x07,
+    0x20, 0x04, 0x07, 0xC0, 0x04, 0x17, 0x00, 0x10, 0x07, 0x00, 0x61, 0x07,
+    0x01, 0x82, 0x07, 0x62, 0x00, 0x07, 0x08, 0x20, 0x07, 0x00, 0xC0, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x98, 0x07, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xC0, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x20, 0x70, 0x07, 0x00, 0x00, 0x67, 0x00, 0x00, 0x07, 0x3C, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x27, 0x00, 0x00, 0x87, 0x40, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x40, 0x00, 0x8F, 0x00, 0x01, 0x0F, 0x10, 0x02, 0x0F, 0x0C, 0x00, 0x0F,
+    0x03, 0x00, 0x0F, 0x00, 0xE2, 0x0F, 0x00, 0x00, 0x0F, 0x38, 0x04, 0x3F,
+    0x20, 0x01, 0x0F, 0x00, 0x00, 0x4F, 0x04, 0x40, 0x0F, 0x28, 0x80, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x4F, 0x08, 0x00, 0x1F,
+    0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x18, 0x00, 0x0F, 0x01, 0x00, 0x4F,
+    0x00, 0x00, 0xCF, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x40, 0x0F, 0x00, 0x86, 0x4F, 0x02, 0x00, 0x1F, 0x20, 0x20, 0x0F,
+    0x30, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x97, 0x00, 0x00, 0x07, 0x2C, 0x02, 0x07,
+    0x80, 0x00, 0x07, 0x02, 0x10, 0x07, 0x18, 0x20, 0x07, 0x10, 0x00, 0x07,
+    0x10, 0x82, 0x47, 0x10, 0x00, 0x47, 0x04, 0x10, 0x47, 0x00, 0x00, 0x47,
+    0x10, 0x00, 0x87, 0x00, 0x83, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x27,
+    0x80, 0x00, 0x87, 0x40, 0x00, 0x07,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x50, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0xA0, 0x01, 0x3F, 0x0A, 0x00, 0x10, 0x3F,
+    0x80, 0x00, 0x80, 0x3F, 0x00, 0x28, 0x00, 0x9F, 0x02, 0x80, 0x00, 0x1F,
+    0x30, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x06, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x80, 0x41, 0x00, 0x00, 0x01,
+    0x00, 0x0C, 0x05, 0x00, 0x01, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x40, 0x3F,
+    0x40, 0x14, 0x00, 0x3F, 0x01, 0x80, 0x01, 0x1F, 0x28, 0x00, 0x50, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x0A, 0x00, 0x00, 0x1F,
+    0xA0, 0x00, 0x00, 0x1F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0xC7, 0x00, 0x07, 0x18, 0x07, 0x40, 0x27,
+    0x03, 0x07, 0x08, 0x07, 0x06, 0x07, 0xC0, 0x47, 0x10, 0x07, 0x00, 0x07,
+    0x01, 0x87, 0x00, 0x07, 0x00, 0x0F,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x00, 0x48, 0x00, 0x00, 0x22, 0x08, 0x06,
+    // 0x61 'a'
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x10, 0x90, 0x24, 0x00, 0x00, 0x00, 0x08, 0x94, 0x02, 0x40, 0x01,
+    0x00, 0x00, 0x82, 0x92, 0x80, 0x10, 0x00, 0x24, 0x00, 0x00,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x40, 0x0A, 0x01, 0x01, 0x40, 0x01,
+    0x88, 0x00, 0x05, 0x00, 0x01, 0x01, 0x80, 0x04, 0x03, 0x04, 0x48, 0x13,
+    0x50, 0x80, 0x21, 0x01, 0x20, 0x01, 0x01, 0x05, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x01, 0x00, 0xC1, 0x00, 0x3C, 0x01,
+    // 0x63 'c'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x01,
+    0x88, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x24, 0x88, 0x00,
+    0x60, 0x00,
+    // 0x64 'd'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21, 0x01, 0x20, 0x49,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x01, 0x28, 0x05, 0x02, 0x00, 0x03,
+    0x90, 0x00, 0x01, 0x00, 0x02, 0x25, 0x80, 0xA0, 0x21, 0x0A, 0x00, 0x49,
+    0x00, 0x00, 0x01,
+    // 0x65 'e'
+    0x00, 0x00, 0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x03, 0x10, 0x40, 0x41,
+    0x90, 0x40, 0xA2, 0x00, 0x20, 0x10, 0x01, 0x00, 0x80, 0x24, 0x80, 0x18,
+    0x48, 0x00,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0xA0, 0x17,
+    0x01, 0x14, 0x00, 0x27, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x07,
+    0x00, 0x01, 0x40, 0x07, 0x00, 0x28, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x90, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x01, 0xB3, 0x00, 0x02, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x04, 0xC3,
+    0x1A, 0x1D, 0x23, 0x20, 0x80, 0x03, 0x40, 0x02, 0x07, 0x86, 0x02, 0x07,
+    0x01, 0x20, 0x03, 0x00, 0x29, 0x27, 0x21, 0x08, 0xA3, 0x26, 0x00, 0x0B,
+    0x00, 0x00, 0x0B, 0x80, 0x80, 0x03, 0x01, 0x01, 0x23, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    // 0x68 'h'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0xA1, 0x40, 0x14, 0x01, 0x01, 0x40, 0x01,
+    0x88, 0x00, 0x0D, 0x00, 0x00, 0x41, 0x80, 0x62, 0x01, 0x03, 0x00, 0x01,
+    0x60, 0x90, 0x01, 0x00, 0x00, 0x45, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x85, 0x00, 0x68, 0x21, 0x00, 0x00, 0x29,
+    // 0x69 'i'
+    0x00, 0x80, 0x59, 0x01, 0x04, 0x01, 0x00, 0x30, 0x03, 0x21, 0x00, 0x01,
+    0x40, 0x00, 0x65, 0x04, 0x08, 0x05, 0x80, 0x20, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x80, 0x0A, 0x07, 0x00, 0x00, 0xA0, 0x27,
+    0x00, 0x08, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x48, 0x00, 0x0C, 0x07,
+    0x04, 0x01, 0x40, 0x07, 0x80, 0x28, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07,
+    0x50, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0xA1, 0x40, 0x04, 0x01, 0x01, 0x40, 0x01,
+    0x88, 0x00, 0x11, 0x00, 0x02, 0x81, 0x80, 0xA0, 0x21, 0x00, 0x52, 0x11,
+    0x70, 0x80, 0x01, 0x01, 0x04, 0x45, 0x01, 0x00, 0x21, 0x00, 0x00, 0x03,
+    0x01, 0x04, 0x11, 0x01, 0x00, 0x01, 0x00, 0x60, 0x01,
+    // 0x6C 'l'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x40, 0x14, 0x01, 0x01, 0x00, 0x03,
+    0x88, 0x00, 0x01, 0x00, 0x00, 0x85, 0x80, 0x28, 0x25, 0x02, 0x00, 0x09,
+    0x10, 0x00, 0x01,
+    // 0x6D 'm'
+    0x00, 0x00, 0x00, 0x0C, 0x81, 0x40, 0x14, 0x00, 0x80, 0x02, 0x00, 0x18,
+    0x80, 0x00, 0x72, 0x00, 0x08, 0x02, 0x50, 0x30, 0x93, 0x00, 0x80, 0x00,
+    0x00, 0x06, 0x80, 0x20, 0x30, 0x00, 0x20, 0x00, 0x48, 0x0C, 0x00, 0x40,
+    0x0C, 0x01, 0x00, 0x01, 0x00, 0x30, 0x00, 0x80, 0x48, 0x00, 0x00, 0x08,
+    // 0x6E 'n'
+    0x00, 0x00, 0x40, 0x0C, 0x81, 0x40, 0x14, 0x00, 0x80, 0x02, 0x00, 0x14,
+    0x80, 0x40, 0x70, 0x00, 0x20, 0x00, 0x40, 0x10, 0x91, 0x00, 0x84, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0x30, 0x00, 0x00, 0x10,
+    // 0x6F 'o'
+    0x00, 0x00, 0x06, 0x08, 0x08, 0x00, 0x20, 0x02, 0x40, 0x40, 0x00, 0x01,
+    0x80, 0x01, 0x80, 0x08, 0x00, 0x02, 0x00, 0x22, 0x09, 0x04, 0x00, 0x08,
+    0x00, 0x00, 0x20, 0x40, 0x0B, 0x00,
+    // 0x70 'p'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x20, 0x00, 0xC7,
+    0x00, 0x14, 0x07, 0x81, 0x40, 0x07, 0x88, 0x00, 0x07, 0x80, 0x00, 0x87,
+    0x00, 0x22, 0x07, 0x81, 0x08, 0x0B, 0x24, 0x01, 0x03, 0x40, 0x00, 0x03,
+    0x00, 0x02, 0x03, 0x10, 0xC2, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x20, 0x03, 0x40, 0x00, 0x03, 0x08, 0x00, 0x03,
+    // 0x71 'q'
+    0x00, 0x00, 0x03, 0x01, 0x04, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x61, 0x03, 0x02, 0x00, 0x07, 0x08, 0x10, 0x17, 0x90, 0x20, 0x07,
+    0x00, 0x02, 0x87, 0x00, 0x08, 0x07, 0x94, 0x00, 0x07, 0x40, 0x00, 0x47,
+    0x00, 0x34, 0x07, 0x82, 0x00, 0x0B, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x72 'r'
+    0x00, 0x01, 0x00, 0x0B, 0x80, 0xA1, 0x0A, 0x01, 0x80, 0x01, 0x00, 0x09,
+    0x80, 0x21, 0x70, 0x01, 0x24, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x08, 0x01, 0x00, 0x01,
+    // 0x73 's'
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x16, 0x20, 0x01, 0x00, 0x00, 0x89,
+    0x80, 0x01, 0x80, 0x08, 0x20, 0x02, 0x02, 0x00, 0x00, 0x04, 0x00, 0xE0,
+    0x30, 0x00,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x08, 0x0F, 0x08, 0x80, 0x0F,
+    0x30, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x28, 0x0F, 0x81, 0x01, 0x2F,
+    0xA0, 0x01, 0x2F, 0x00, 0x02, 0x4F, 0x00, 0x00, 0x8F, 0x0E, 0x00, 0x0F,
+    // 0x75 'u'
+    0x00, 0x00, 0x00, 0x18, 0x83, 0x00, 0x88, 0x01, 0x00, 0x01, 0x00, 0xA0,
+    0x06, 0x00, 0x60, 0x04, 0x00, 0x08, 0x00, 0x00, 0x06, 0x06, 0x20, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x8C, 0x02, 0x00, 0x04, 0x00, 0x00,
+    // 0x76 'v'
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x60, 0x00, 0x06, 0x22, 0x00, 0x44, 0x01, 0x08, 0x9C, 0x00, 0x00, 0x40,
+    0x00, 0x80, 0x86, 0x00, 0x20, 0x00,
+    // 0x77 'w'
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x62, 0x80, 0x00,
+    0x00, 0x00, 0x03, 0x22, 0x00, 0x04, 0x80, 0x10, 0x98, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x40, 0x00, 0x02, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x88, 0x10,
+    0x00, 0x00, 0x80, 0x00, 0x74, 0x00,
+    // 0x78 'x'
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x10, 0x90, 0x20,
+    0x06, 0x88, 0x80, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x00, 0x20, 0xC1,
+    0x08, 0x10, 0x10, 0x08, 0x10, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    // 0x79 'y'
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x23,
+    0x40, 0x00, 0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x13,
+    0x00, 0x42, 0x03, 0x00, 0x00, 0x03, 0x60, 0x00, 0x03, 0x06, 0x11, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x84, 0x03, 0x9C, 0x10, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x03, 0x86, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x04, 0x00, 0x0A, 0x20, 0x10, 0x00, 0x20, 0x80, 0x04, 0x10, 0x00,
+    0x80, 0x20, 0x10, 0x10, 0x80, 0x00, 0x40, 0x01, 0x40, 0x00, 0x04, 0x00,
+    0x08, 0x22, 0x90, 0x10, 0x20, 0x00,
+    // 0x7B '{'
+    0x00, 0x00, 0x02, 0x4F, 0x00, 0x08, 0x08, 0x0F, 0x00, 0x01, 0x40, 0x1F,
+    0x00, 0x30, 0x02, 0x8F, 0x04, 0x00, 0x18, 0x1F, 0x20, 0x02, 0x40, 0x0F,
+    0x40, 0x10, 0x00, 0x2F, 0x0A, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0xA0, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x01, 0x40, 0x02, 0xBF, 0x28, 0x00, 0x50, 0x3F,
+    0x80, 0x0A, 0x00, 0x3F, 0x81, 0x40, 0x00, 0x3F, 0x98, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x22, 0x0F,
+    0x40, 0x00, 0x80, 0x2F, 0x80, 0x66, 0x00, 0x4F, 0x80, 0x00, 0x1D, 0x0F,
+    0x00, 0x00, 0x80, 0x0F, 0x00, 0x18, 0x00, 0x0F, 0x40, 0x87, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F,
+    // 0x7E '~'
+    0x23, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x03, 0x23, 0x03, 0x83,
+    0x13, 0x63,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x43, 0x00, 0x0A, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x00, 0x13, 0x88, 0x01, 0x43, 0x03, 0x30, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xA2 '¢'
+    0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x08, 0x0F, 0x01, 0x08, 0x81, 0x4F, 0x00, 0x20, 0x04, 0x0F,
+    0x00, 0x41, 0x40, 0x0F, 0x02, 0x14, 0x05, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+    0x10, 0x14, 0x08, 0x0F, 0x80, 0x40, 0x48, 0x0F, 0x80, 0x00, 0x10, 0x0F,
+    0xC0, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x87, 0x00, 0x10, 0x07, 0x00, 0x40, 0x0F,
+    0x00, 0x05, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x04, 0x01, 0x97,
+    0x00, 0x00, 0x17, 0x00, 0x40, 0x07, 0x44, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x90, 0x00, 0x07, 0x90, 0x00, 0x87, 0x82, 0x00, 0x07,
+    0x02, 0x00, 0xA7, 0x44, 0x00, 0x07, 0x18, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x00, 0x09, 0x00, 0x11, 0x10, 0x05, 0x0A, 0x01, 0x00, 0x01, 0x00, 0x09,
+    0x02, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x09, 0x00, 0x49, 0x23, 0x01,
+    0x20, 0x01, 0x20, 0x21, 0x0E, 0x15, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x20, 0x00, 0x0F, 0x10, 0xC0, 0x3F, 0x0C, 0xA0, 0x0F, 0x00, 0xA0, 0x4F,
+    0x00, 0x2B, 0x0F, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F, 0x01, 0x80, 0x0F,
+    0x20, 0x42, 0x8F, 0x01, 0x10, 0x4F, 0x02, 0x00, 0x1F, 0x08, 0x20, 0x0F,
+    0x10, 0xA0, 0x0F, 0x02, 0xAC, 0x0F, 0x00, 0x80, 0x0F, 0x08, 0x00, 0x0F,
+    0x10, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x06, 0x10, 0x41, 0x08, 0x08, 0x43,
+    0x10, 0x44, 0x13, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x40, 0x48, 0x81,
+    0x01, 0x04, 0x41, 0x10, 0x82, 0x05, 0x00, 0x00, 0x81, 0x04, 0x03, 0x01,
+    0x40, 0x00, 0x41, 0x30, 0x0F, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x01, 0x06, 0x07, 0x00, 0xF0, 0x87, 0x12, 0x00, 0x47,
+    0x08, 0x00, 0x27, 0x50, 0x70, 0x07, 0x41, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x04, 0x80, 0x07, 0x80, 0x00, 0x0F, 0x8A, 0x00, 0x07, 0x88, 0x04, 0x07,
+    0x08, 0x84, 0x2F, 0x00, 0x00, 0x07, 0x05, 0x02, 0x27, 0x40, 0x00, 0x47,
+    0x50, 0x00, 0x07, 0x08, 0x01, 0x27, 0x00, 0x06, 0x47, 0x08, 0x71, 0x07,
+    0x03, 0x02, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x0F, 0x18, 0x93, 0x20, 0x53, 0x04, 0x13, 0x00, 0x13, 0x02, 0x13,
+    0x20, 0x13, 0x30, 0x53, 0x80, 0x07, 0x98, 0x0B, 0x02, 0x83, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x0F, 0x05, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x20, 0x2F, 0x07, 0x0F,
+    0x08, 0x8F, 0x10, 0x0F, 0x65, 0x0F, 0x00, 0x8F, 0x10, 0x0F, 0x00, 0x2F,
+    0x46, 0x0F, 0x08, 0x0F, 0x10, 0x2F, 0x20, 0x0F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x05, 0x81, 0x10, 0x05, 0x48, 0x21, 0x30, 0x11,
+    0x10, 0x13, 0x40, 0x95, 0xC0, 0x25, 0x50, 0x21, 0x80, 0x55, 0x20, 0x19,
+    0x40, 0x15, 0x04, 0x69, 0x18, 0x01, 0x02, 0xC1,
+    // 0xB0 '°'
+    0x05, 0x1F, 0x00, 0x1F, 0x00, 0x5F, 0x04, 0x1F, 0x80, 0x3F, 0x91, 0x3F,
+    0x80, 0x3F, 0x0A, 0x1F, 0x00, 0x5F, 0x20, 0x9F, 0x0A, 0x1F,
+    // 0xB1 '±'
+    0x04, 0x02, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x04, 0x00, 0x3F, 0x80, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x7C, 0xF8, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x17, 0x10, 0x23, 0x00, 0x43, 0x48, 0x83, 0x50, 0x13,
+    0x10, 0x13, 0x10, 0x13, 0x08, 0x93, 0x40, 0x17, 0x02, 0x0B, 0x18, 0x03,
+    // 0xB3 '³'
+    0x00, 0x03, 0x00, 0x03, 0x20, 0x13, 0x0A, 0x93, 0x50, 0x97, 0x10, 0x83,
+    0x10, 0x43, 0x00, 0x0B, 0x02, 0x03, 0x24, 0x43,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x2B, 0x00, 0x02, 0x83, 0x00, 0x50, 0x07,
+    0x14, 0x00, 0x0B, 0x00, 0x02, 0x63, 0x80, 0x00, 0x03, 0x82, 0x71, 0x03,
+    0x28, 0x01, 0x03, 0x80, 0x10, 0x03, 0x00, 0x22, 0x03, 0x00, 0xC4, 0x03,
+    0x14, 0x08, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x82, 0x61, 0x03,
+    0x28, 0x00, 0x03, 0x80, 0x02, 0x03, 0x00, 0x1C, 0x03,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x01, 0xC0, 0x00,
+    0x08, 0x08, 0x04, 0x00, 0x00, 0x08, 0x20, 0x00, 0x32, 0x40, 0x0D, 0x00,
+    0x40, 0x00, 0x08, 0x00, 0x01, 0x10, 0x80, 0x28, 0x60, 0x85, 0x0A, 0x00,
+    0x91, 0x40, 0x00, 0x08, 0x05, 0x00, 0x00, 0xA0, 0x00, 0x14, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0xB7 '·'
+    0x2B, 0x07, 0x03, 0x0B, 0x53,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x03, 0x30, 0x03, 0x00, 0x43, 0x4A, 0x03, 0x00, 0x03,
+    0x00, 0x53, 0x0A, 0x13, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x0F, 0x09, 0x13, 0x20, 0x13, 0x40, 0x53, 0x0E, 0x13, 0x00, 0x13,
+    0x81, 0x53, 0x24, 0x57, 0x80, 0x03, 0x80, 0x03, 0x38, 0x03,
+    // 0xBB '»'
+    0x00, 0x0F, 0x00, 0x4F, 0x40, 0x8F, 0x90, 0x2F, 0x8A, 0x0F, 0x40, 0x4F,
+    0x20, 0x0F, 0x11, 0x0F, 0x08, 0x4F, 0x40, 0x0F, 0xA0, 0x2F, 0x88, 0x0F,
+    0x40, 0x4F, 0x20, 0x0F, 0x11, 0x0F, 0x0A, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x08, 0x0A, 0x01, 0x28, 0x52, 0x01,
+    0x0D, 0x02, 0x01, 0x00, 0x02, 0x01, 0x40, 0x52, 0x01, 0x44, 0x08, 0x15,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x45, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x81, 0x00, 0x20, 0x01, 0x00, 0x44, 0x01,
+    0x01, 0x10, 0x01, 0x02, 0x00, 0xC1, 0x08, 0x40, 0x01, 0x01, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x84, 0x01, 0x81, 0x10, 0x02, 0x89, 0x00, 0x00, 0x81,
+    0x00, 0x04, 0x01, 0x00, 0x80, 0x09, 0x00, 0x02, 0x81, 0x00, 0xD0, 0x81,
+    0x00, 0x00, 0x01,
+    // 0xBD '½'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x08, 0x0A, 0x01, 0x28, 0x52, 0x01,
+    0x0D, 0x02, 0x01, 0x00, 0x02, 0x0D, 0x40, 0x52, 0x01, 0x44, 0x08, 0x21,
+    0x20, 0x00, 0x01, 0x00, 0x01, 0x09, 0x00, 0x02, 0x21, 0x00, 0x00, 0x41,
+    0x00, 0x11, 0x01, 0x00, 0x22, 0x01, 0x00, 0x88, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x20, 0x01, 0x00, 0x80, 0x09, 0x00, 0x00, 0x21, 0x02, 0x00, 0x01,
+    0x88, 0x00, 0x81, 0x40, 0x10, 0x21, 0x20, 0x80, 0x61, 0x00, 0x22, 0x21,
+    0x00, 0x08, 0xA1, 0x00, 0x80, 0x21, 0x00, 0x00, 0x21, 0x00, 0x6C, 0x01,
+    // 0xBE '¾'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x08, 0x01, 0x04, 0x48, 0x01,
+    0x00, 0x02, 0x01, 0x42, 0x00, 0x01, 0x40, 0x64, 0x0D, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x14, 0x00, 0x81, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x08, 0x41, 0x00, 0x00, 0x01, 0x00, 0x22, 0x01, 0x00, 0x88, 0x01,
+    0x01, 0x10, 0x01, 0x04, 0x00, 0xC1, 0x00, 0x80, 0x01, 0x20, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x88, 0x01, 0x81, 0x40, 0x02, 0x89, 0x20, 0x00, 0x81,
+    0x00, 0x04, 0x01, 0x00, 0x80, 0x09, 0x00, 0x02, 0x81, 0x00, 0xD0, 0x81,
+    0x00, 0x00, 0x01,
+    // 0xBF '¿'
+    0x00, 0x03, 0x87, 0x00, 0x00, 0x07, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x04, 0x47, 0x40, 0xC8, 0x47, 0x88, 0x10, 0x0F, 0x00, 0x20, 0x87,
+    0x02, 0x00, 0xA7, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x2F,
+    0x00, 0x02, 0x10, 0x0F, 0x60, 0x00, 0x20, 0x0F, 0x00, 0x20, 0x80, 0x0F,
+    0x44, 0x40, 0x00, 0x0F, 0x04, 0x02, 0x00, 0x0F, 0x10, 0x80, 0x20, 0x4F,
+    0x02, 0x00, 0x00, 0x0F, 0x08, 0xA0, 0x00, 0x0F, 0x00, 0x02, 0x80, 0x0F,
+    0x00, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x2F,
+    0x00, 0x02, 0x10, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x04, 0x20, 0x80, 0x0F,
+    0x08, 0x40, 0x00, 0x0F, 0x10, 0x02, 0x00, 0x0F, 0x00, 0x80, 0x20, 0x4F,
+    0x24, 0x00, 0x00, 0x0F, 0x44, 0xA0, 0x00, 0x0F, 0x08, 0x02, 0x80, 0x0F,
+    0x70, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x2F,
+    0x00, 0x02, 0x10, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x10, 0x20, 0x80, 0x0F,
+    0x20, 0x40, 0x00, 0x0F, 0x40, 0x02, 0x00, 0x0F, 0x00, 0x80, 0x20, 0x4F,
+    0x08, 0x00, 0x00, 0x0F, 0x04, 0xA0, 0x00, 0x0F, 0x02, 0x02, 0x80, 0x0F,
+    0x12, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x20, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x04, 0x20, 0x1F, 0x48, 0x00, 0x40, 0x1F, 0x00, 0x41, 0x00, 0x1F,
+    0x90, 0x80, 0x00, 0x1F, 0x80, 0x04, 0x00, 0x1F, 0x41, 0x00, 0x40, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x01, 0x40, 0x00, 0x1F, 0x00, 0x05, 0x00, 0x1F,
+    0x00, 0x00, 0x28, 0x1F, 0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0xBF,
+    0x20, 0x08, 0x40, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x80, 0x82, 0x00, 0x3F,
+    0x91, 0x00, 0x00, 0x3F, 0xE0, 0x08, 0x00, 0x3F, 0x02, 0x00, 0x81, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x80, 0x0A, 0x00, 0x3F,
+    0x80, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x2F,
+    0x00, 0x02, 0x10, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x24, 0x20, 0x80, 0x0F,
+    0x40, 0x40, 0x00, 0x0F, 0xA0, 0x02, 0x00, 0x0F, 0x04, 0x80, 0x20, 0x4F,
+    0x28, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F, 0x40, 0x02, 0x80, 0x0F,
+    0x00, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x01, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x08, 0x4F,
+    0x00, 0x01, 0x0F, 0x00, 0x22, 0x0F, 0x00, 0x02, 0x0F, 0x01, 0x12, 0x0F,
+    0x00, 0x02, 0x0F, 0xA4, 0x42, 0x4F, 0x01, 0x01, 0x0F, 0x00, 0x00, 0x0F,
+    0x05, 0x80, 0x0F, 0x0C, 0x00, 0x0F, 0x00, 0x02, 0xCF, 0x00, 0x10, 0x0F,
+    0x06, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x8F,
+    0x10, 0x03, 0x0F, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xC1, 0x80, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x08, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x44, 0x00, 0x2F,
+    0x03, 0x01, 0x00, 0x5F, 0x40, 0x00, 0x09, 0x0F, 0x00, 0x00, 0x0C, 0x2F,
+    0x00, 0x00, 0x88, 0x0F, 0x80, 0x00, 0x82, 0x0F, 0x90, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x90, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F,
+    0x02, 0x02, 0x40, 0x0F, 0x80, 0x01, 0x00, 0x0F, 0x0C, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x05, 0x0F, 0x00, 0xA0, 0x40, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xCF, 0x00, 0x00, 0x10, 0x0F,
+    0x08, 0x06, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x4F,
+    0x00, 0x10, 0x00, 0x0F, 0x12, 0x10, 0x00, 0x0F, 0x02, 0x10, 0x20, 0x0F,
+    0x00, 0x02, 0x00, 0x6F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x05, 0x0F, 0x00, 0xA0, 0x40, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xCF, 0x00, 0x00, 0x10, 0x0F,
+    0x00, 0x06, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00, 0x4F,
+    0x10, 0x10, 0x00, 0x0F, 0x04, 0x10, 0x00, 0x0F, 0x04, 0x10, 0x20, 0x0F,
+    0x40, 0x02, 0x00, 0x6F, 0x08, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x05, 0x0F, 0x00, 0xA0, 0x40, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x02, 0xCF, 0x08, 0x00, 0x10, 0x0F,
+    0x00, 0x06, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x04, 0x00, 0x00, 0x4F,
+    0x40, 0x10, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x10, 0x20, 0x0F,
+    0x22, 0x02, 0x00, 0x6F, 0x02, 0x02, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x14, 0x3F, 0x02, 0x81, 0x00, 0x3F, 0x00, 0x28, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0x3F, 0x50, 0x00, 0x40, 0x3F,
+    0x00, 0x18, 0x01, 0x3F, 0x80, 0x00, 0x01, 0x3F, 0x10, 0x00, 0x01, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x50, 0x40, 0x00, 0x3F, 0x80, 0x40, 0x80, 0x3F,
+    0x80, 0x08, 0x01, 0xBF, 0x90, 0x08, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x02, 0x8F, 0x00, 0xA0, 0x50, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x4F, 0x20, 0x00, 0x28, 0x4F,
+    0x00, 0x05, 0x00, 0x2F, 0x08, 0x10, 0x00, 0x0F, 0x04, 0x20, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x02, 0x8F, 0x00, 0xA0, 0x50, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x06, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x28, 0x4F,
+    0x20, 0x05, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x30, 0x00, 0x00, 0x0F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x02, 0x8F, 0x02, 0xA0, 0x50, 0x0F, 0x08, 0x0A, 0x00, 0x0F,
+    0x12, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x01, 0x4F, 0x08, 0x00, 0x28, 0x4F,
+    0x00, 0x05, 0x00, 0x2F, 0x08, 0x10, 0x00, 0x0F, 0x44, 0x20, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x0A, 0x3F, 0x62, 0x81, 0x40, 0x3F, 0x80, 0x28, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x05, 0x3F, 0x20, 0x00, 0xA1, 0x3F,
+    0x00, 0x14, 0x00, 0xBF, 0x00, 0x40, 0x00, 0x3F, 0x80, 0x80, 0x00, 0x3F,
+    0x80, 0x80, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x37, 0x00, 0x70, 0x07, 0x00, 0x50, 0x07, 0x00, 0x55, 0x07,
+    0x10, 0x00, 0x07, 0x9A, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x02, 0x87,
+    0x80, 0x00, 0x47, 0x02, 0x50, 0x07, 0x00, 0x50, 0x07, 0x00, 0x50, 0x97,
+    0x10, 0x00, 0x87, 0x90, 0x01, 0x07, 0x08, 0x00, 0x27, 0x80, 0x08, 0x27,
+    0x40, 0x80, 0x07, 0x00, 0x00, 0x87, 0x20, 0x00, 0x07, 0x18, 0x04, 0x07,
+    0x00, 0x90, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x0A, 0x0F, 0x01, 0x40, 0xA0, 0x0F, 0x00, 0x14, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x50, 0x0F, 0x00, 0x02, 0x00, 0x4F,
+    0x10, 0x00, 0x80, 0x0F, 0x48, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x10, 0x0C, 0x03, 0x0F, 0x90, 0x01, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x10, 0x1F, 0x01, 0x40, 0xA0, 0x0F, 0x88, 0x0C, 0x00, 0x0F,
+    0x10, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x05, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x81, 0x87, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x17, 0x00, 0x20, 0x34, 0x07,
+    0x00, 0x41, 0x01, 0x07, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x80, 0x00, 0x0F,
+    0x08, 0x10, 0x00, 0x07, 0x04, 0x90, 0x00, 0x07, 0x24, 0x10, 0x00, 0x07,
+    0x00, 0x10, 0x01, 0x07, 0x02, 0x00, 0x00, 0x07, 0x0C, 0x8C, 0x10, 0x07,
+    0x00, 0x80, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x06, 0x07, 0x00, 0x0A, 0x70, 0x07,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x81, 0x87, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x17, 0x00, 0x20, 0x34, 0x07,
+    0x00, 0x41, 0x01, 0x07, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x10, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07, 0x12, 0x10, 0x00, 0x07,
+    0x00, 0x10, 0x01, 0x07, 0x04, 0x00, 0x00, 0x07, 0x44, 0x8C, 0x10, 0x07,
+    0x00, 0x80, 0x00, 0x47, 0x30, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x06, 0x07, 0x00, 0x0A, 0x70, 0x07,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x81, 0x87, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x17, 0x00, 0x20, 0x34, 0x07,
+    0x00, 0x41, 0x01, 0x07, 0x00, 0x00, 0x00, 0x8F, 0x08, 0x80, 0x00, 0x0F,
+    0x10, 0x10, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07, 0x04, 0x10, 0x00, 0x07,
+    0x08, 0x10, 0x01, 0x07, 0x08, 0x00, 0x00, 0x07, 0x44, 0x8C, 0x10, 0x07,
+    0x22, 0x80, 0x00, 0x47, 0x02, 0x00, 0x00, 0x07, 0x04, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x06, 0x07, 0x00, 0x0A, 0x70, 0x07,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x03, 0x0F, 0x00, 0x08, 0x00, 0x8F,
+    0x00, 0x10, 0x00, 0x4F, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x40, 0x68, 0x0F,
+    0x00, 0x82, 0x02, 0x0F, 0x00, 0x00, 0x01, 0x1F, 0x21, 0x00, 0x00, 0x1F,
+    0x08, 0x20, 0x00, 0x0F, 0x81, 0x20, 0x00, 0x0F, 0x80, 0x20, 0x00, 0x0F,
+    0x08, 0x20, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x18, 0x20, 0x0F,
+    0x41, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x02, 0x0F,
+    0x00, 0x20, 0x0C, 0x0F, 0x00, 0x14, 0xE0, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x06, 0x1F, 0x00, 0x10, 0x01, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x40, 0x00, 0x5F, 0x00, 0x80, 0xD0, 0x1F,
+    0x01, 0x04, 0x04, 0x1F, 0x00, 0x00, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x80, 0x40, 0x00, 0x1F, 0x82, 0x40, 0x00, 0x1F, 0xA0, 0x40, 0x00, 0x1F,
+    0x00, 0x40, 0x04, 0x1F, 0x60, 0x00, 0x00, 0x1F, 0x82, 0x30, 0x40, 0x1F,
+    0x82, 0x00, 0x01, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x04, 0x1F,
+    0x00, 0x40, 0x18, 0x1F, 0x00, 0x29, 0xC0, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x07, 0x30, 0x67, 0x48, 0x97, 0x05, 0x07, 0x02, 0x07, 0x10, 0x47,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x05, 0x07, 0x08, 0x87, 0x50, 0x57,
+    0x20, 0x27,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0xC0, 0xE3, 0x02, 0x00, 0x03,
+    0x04, 0x00, 0x13, 0x08, 0x00, 0x0B, 0x10, 0x0C, 0x03, 0x21, 0x00, 0x83,
+    0x02, 0x01, 0x47, 0x44, 0x12, 0x07, 0x08, 0x24, 0x03, 0x48, 0x40, 0x03,
+    0x08, 0x80, 0x03, 0x09, 0x00, 0x83, 0x08, 0x01, 0x03, 0x44, 0x86, 0x03,
+    0x40, 0xE0, 0x23, 0x00, 0x00, 0x03, 0x20, 0x00, 0x83, 0x00, 0x03, 0x03,
+    0x45, 0x38, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xD9 'Ù'
+    0x00, 0x60, 0x08, 0x07, 0x00, 0x81, 0x40, 0x27, 0x00, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x87,
+    0x00, 0x0A, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x07,
+    0x40, 0x80, 0x00, 0x87, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07,
+    0x12, 0x20, 0x14, 0x07, 0x02, 0x02, 0x80, 0x07, 0x00, 0x10, 0x00, 0x87,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDA 'Ú'
+    0x00, 0x60, 0x08, 0x07, 0x00, 0x81, 0x40, 0x27, 0x00, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x87,
+    0x00, 0x0A, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x80, 0x00, 0x87, 0x02, 0x00, 0x00, 0x97, 0x10, 0x00, 0x01, 0x07,
+    0x04, 0x20, 0x14, 0x07, 0x04, 0x02, 0x80, 0x07, 0x40, 0x10, 0x00, 0x87,
+    0x48, 0x00, 0x03, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDB 'Û'
+    0x00, 0x60, 0x08, 0x07, 0x00, 0x81, 0x40, 0x27, 0x00, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x87,
+    0x04, 0x0A, 0x00, 0x8F, 0x08, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x87, 0x04, 0x00, 0x00, 0x97, 0x40, 0x00, 0x01, 0x07,
+    0x00, 0x20, 0x14, 0x07, 0x40, 0x02, 0x80, 0x07, 0x22, 0x10, 0x00, 0x87,
+    0x02, 0x00, 0x03, 0x07, 0x08, 0x00, 0x28, 0x07, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDC 'Ü'
+    0x01, 0x80, 0x20, 0x1F, 0x02, 0x05, 0x00, 0x9F, 0x00, 0x50, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x82, 0x1F,
+    0x00, 0x28, 0x02, 0x3F, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x82, 0x00, 0x02, 0x1F, 0x10, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x04, 0x1F,
+    0x10, 0x80, 0x50, 0x1F, 0x80, 0x0A, 0x00, 0x1F, 0x80, 0x40, 0x02, 0x1F,
+    0x90, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0x14, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x30, 0x0F, 0x03, 0x04, 0x2F, 0x0A, 0x04, 0x0F, 0x08, 0x09, 0x0F,
+    0xC0, 0x11, 0x0F, 0x08, 0x40, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0xC0, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x14, 0x07, 0x00, 0x01, 0x40, 0x07,
+    0x00, 0x28, 0x00, 0x47, 0x03, 0x00, 0x02, 0x07, 0x00, 0x00, 0x28, 0x07,
+    0x20, 0x05, 0x00, 0x07, 0x00, 0x60, 0x04, 0x07, 0x06, 0x00, 0x40, 0x07,
+    0x90, 0x18, 0x00, 0x07, 0x80, 0x40, 0x02, 0x07, 0x20, 0x02, 0x10, 0x07,
+    0x01, 0x00, 0x90, 0x07, 0x94, 0x20, 0x60, 0x07, 0x00, 0x88, 0x00, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x44, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xE0 'à'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x82, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x08, 0x48, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x22, 0x00, 0x04, 0x7F, 0x10, 0x4A, 0x01, 0x7F, 0x06, 0x20, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x41, 0x49, 0x7F, 0x00, 0x40, 0x08, 0x7F,
+    0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x82, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x48, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x04, 0x7F, 0x10, 0x4A, 0x01, 0x7F, 0x22, 0x20, 0x00, 0xFF,
+    0x04, 0x00, 0x00, 0x7F, 0x00, 0x41, 0x49, 0x7F, 0x30, 0x40, 0x08, 0x7F,
+    0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90, 0x24,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x94, 0x02, 0x08, 0x40, 0x01,
+    0x84, 0x00, 0x00, 0x00, 0x82, 0x92, 0x08, 0x80, 0x10, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x01, 0x40, 0x00, 0x21, 0x11, 0x20, 0x49,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x11, 0x81, 0x28, 0x05, 0x40, 0x80, 0x03,
+    0x48, 0x00, 0x01, 0x01, 0x05, 0x25, 0x01, 0x00, 0x21, 0x00, 0x00, 0x49,
+    0x00, 0x00, 0x01,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xC3, 0x30, 0x00, 0x01, 0x48, 0x00, 0x21, 0x89, 0x20, 0x49,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x11, 0x01, 0x28, 0x05, 0x40, 0x80, 0x03,
+    0x00, 0x00, 0x01, 0x89, 0x05, 0x25, 0x01, 0x00, 0x21, 0x00, 0x00, 0x49,
+    0x00, 0x00, 0x01,
+    // 0xE5 'å'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x82, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x02, 0x48, 0x12, 0x7F, 0x41, 0x00, 0x00, 0x7F,
+    0x81, 0x00, 0x04, 0x7F, 0x05, 0x4A, 0x01, 0x7F, 0x8D, 0x20, 0x00, 0xFF,
+    0x02, 0x00, 0x00, 0x7F, 0x20, 0x41, 0x49, 0x7F, 0x00, 0x40, 0x08, 0x7F,
+    0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x10, 0x90, 0x24, 0x00, 0x48, 0x01, 0x10, 0x84, 0x04, 0x80, 0x00,
+    0x00, 0x00, 0x05, 0x01, 0x01, 0x41, 0x00, 0x40, 0x80, 0x82, 0x28, 0x82,
+    0x00, 0x24, 0x82, 0x00, 0x00, 0x10, 0x30, 0x00,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x4B,
+    0x00, 0x01, 0x31, 0x46, 0x01, 0x81, 0x88, 0x00, 0x01, 0x90, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x24, 0x01, 0x88, 0x00, 0x01,
+    0x60, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x88, 0x7F, 0x20, 0x20, 0x20, 0xFF,
+    0x00, 0x48, 0x20, 0x7F, 0x44, 0x51, 0x00, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x10, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x12, 0x7F, 0x00, 0x40, 0x0C, 0x7F,
+    0x00, 0x24, 0x00, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x88, 0x7F, 0x00, 0x20, 0x20, 0xFF,
+    0x00, 0x48, 0x20, 0x7F, 0x00, 0x51, 0x00, 0x7F, 0x02, 0x10, 0x08, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x42, 0x40, 0x12, 0x7F, 0x04, 0x40, 0x0C, 0x7F,
+    0x88, 0x24, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x7F,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x03, 0x10, 0x00, 0x40, 0x41, 0x20, 0x90, 0x40, 0x00, 0xA2, 0x00,
+    0x00, 0x20, 0x10, 0x80, 0x01, 0x00, 0x00, 0x80, 0x24, 0x80, 0x80, 0x18,
+    0x20, 0x48, 0x00, 0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x10, 0x05, 0x00, 0x00, 0x01,
+    0x30, 0x06, 0x21, 0x48, 0x80, 0x83, 0x89, 0x20, 0x81, 0x81, 0x44, 0x01,
+    0x00, 0x40, 0x21, 0x00, 0x02, 0x01, 0x01, 0x00, 0x49, 0x09, 0x00, 0x31,
+    0x80, 0x90, 0x01, 0x50, 0x00, 0x01,
+    // 0xEC 'ì'
+    0x00, 0x20, 0x16, 0x7F, 0x00, 0x41, 0x00, 0x7F, 0x48, 0x0C, 0x00, 0xFF,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x19, 0x7F, 0x22, 0x02, 0x01, 0x7F,
+    0x08, 0x08, 0x00, 0x7F, 0x06, 0x00, 0x00, 0x7F,
+    // 0xED 'í'
+    0x00, 0x20, 0x16, 0x7F, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x0C, 0x00, 0xFF,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x19, 0x7F, 0x00, 0x02, 0x01, 0x7F,
+    0x02, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0xEE 'î'
+    0x00, 0x40, 0x2C, 0x08, 0x82, 0x00, 0x00, 0x18, 0x01, 0x24, 0x80, 0x00,
+    0x48, 0x00, 0x32, 0x80, 0x04, 0x02, 0x10, 0x10, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    // 0xEF 'ï'
+    0x00, 0x80, 0x59, 0x31, 0x04, 0x01, 0x08, 0x30, 0x03, 0x89, 0x00, 0x01,
+    0x10, 0x00, 0x65, 0x00, 0x08, 0x05, 0x30, 0x20, 0x01, 0x48, 0x00, 0x01,
+    0x88, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0xC0, 0x00, 0x46, 0x11, 0x24, 0x00, 0x01, 0x02, 0x00, 0x00,
+    0x80, 0x90, 0x00, 0x40, 0x10, 0x20, 0x01, 0x06, 0x80, 0x40, 0x00, 0x00,
+    0x18, 0x00, 0x10, 0x23, 0x00, 0x40, 0x00, 0x40, 0x00,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x19, 0x01, 0x02, 0x81, 0x00, 0x28, 0x01,
+    0x01, 0x00, 0x05, 0x00, 0x00, 0x29, 0x41, 0x00, 0x81, 0x10, 0xE0, 0x01,
+    0x20, 0x40, 0x01, 0x00, 0x80, 0x21, 0x81, 0x22, 0x01, 0x41, 0x08, 0x03,
+    0x48, 0x00, 0x01, 0x00, 0x00, 0x01, 0x21, 0x06, 0x21, 0x00, 0x60, 0x01,
+    0x00, 0x00, 0x21,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x04, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x10, 0x01, 0x7F, 0x00, 0x20, 0x20, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x10, 0x40, 0x00, 0xFF, 0x48, 0x40, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x22, 0x00, 0x11, 0x7F, 0x00, 0x04, 0x82, 0x7F, 0x06, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x7F, 0x00, 0x05, 0x80, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x04, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x10, 0x01, 0x7F, 0x00, 0x20, 0x20, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x40, 0x00, 0xFF, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x04, 0x00, 0x11, 0x7F, 0x10, 0x04, 0x82, 0x7F, 0x22, 0x00, 0x04, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x7F, 0x40, 0x05, 0x80, 0x7F,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0x08, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x00, 0x80, 0x08,
+    0x44, 0x00, 0x02, 0x08, 0x00, 0x22, 0x80, 0x09, 0x04, 0x08, 0x00, 0x08,
+    0x04, 0x00, 0x00, 0x00, 0x20, 0x40, 0x0C, 0x0B, 0x00,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x01, 0x00, 0x0C, 0x11, 0x00, 0x10, 0x01, 0x00, 0x40, 0x05,
+    0x00, 0x80, 0x81, 0x00, 0x00, 0x03, 0x41, 0x00, 0x03, 0x11, 0x00, 0x11,
+    0x20, 0x00, 0x05, 0x00, 0x00, 0x45, 0x00, 0x12, 0x09, 0x48, 0x00, 0x11,
+    0x48, 0x00, 0x01, 0x00, 0x40, 0x81, 0x10, 0x16, 0x01, 0x00, 0x00, 0x01,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x01, 0x00, 0x0C, 0x11, 0x00, 0x10, 0x01, 0x00, 0x40, 0x05,
+    0x00, 0x80, 0x81, 0x00, 0x00, 0x03, 0x09, 0x00, 0x03, 0x09, 0x00, 0x11,
+    0x80, 0x00, 0x05, 0x70, 0x00, 0x45, 0x00, 0x12, 0x09, 0x70, 0x00, 0x11,
+    0x08, 0x00, 0x01, 0x88, 0x40, 0x81, 0x00, 0x16, 0x01, 0x00, 0x00, 0x01,
+    // 0xF7 '÷'
+    0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x25, 0x13, 0x95, 0x4B,
+    0x85, 0x43, 0x85, 0x43, 0x65, 0x33, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x7F,
+    0x04, 0x00, 0x7F, 0x10, 0x01, 0x7F, 0x20, 0xC0, 0x7F, 0x00, 0x14, 0xFF,
+    0x40, 0xA0, 0xFF, 0x41, 0x04, 0x7F, 0x12, 0x01, 0x7F, 0x00, 0x91, 0x7F,
+    0x01, 0x42, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x20, 0x7F,
+    0x15, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x41, 0x80, 0x7F,
+    0x00, 0x44, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x30, 0x03, 0x00, 0x7F, 0x00, 0x30, 0x02, 0x7F, 0x44, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x03, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x40, 0x7F, 0x00, 0x46, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x41, 0x80, 0x7F,
+    0x00, 0x44, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x00, 0x03, 0x00, 0x7F, 0x00, 0x30, 0x02, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x0E, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x03, 0x7F, 0x40, 0x10, 0x00, 0x7F,
+    0x04, 0x00, 0x00, 0x7F, 0x88, 0x40, 0x40, 0x7F, 0x40, 0x46, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x83, 0x00, 0x00, 0x88, 0x01,
+    0x00, 0x00, 0x01, 0x04, 0x00, 0xA0, 0x10, 0x06, 0x00, 0x20, 0x60, 0x04,
+    0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x80, 0x06, 0x06, 0x00, 0x20, 0x00,
+    0x40, 0x00, 0x00, 0x30, 0x80, 0x80, 0x00, 0x8C, 0x02, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x01, 0x06, 0x01, 0x01, 0x10, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x41, 0x08, 0x0C, 0x01, 0x88, 0xC0, 0x09,
+    0x80, 0x00, 0x11, 0x60, 0x00, 0x01, 0x00, 0x0C, 0x0D, 0x08, 0x40, 0x01,
+    0x08, 0x00, 0x01, 0x81, 0x01, 0x01, 0x71, 0x18, 0x05, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x01,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0A, 0x0F, 0x20, 0x00, 0xC0, 0x0F, 0x40, 0x14, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x8F, 0x98, 0x00, 0x04, 0x0F, 0x00, 0x01, 0x80, 0x2F,
+    0x80, 0x84, 0x02, 0x07, 0x06, 0x48, 0x10, 0x07, 0x10, 0x80, 0x00, 0x07,
+    0x01, 0x20, 0x40, 0x07, 0x01, 0x3D, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x3A, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x14, 0x00, 0x27, 0x08, 0x00, 0x84, 0x07,
+    0x08, 0x00, 0x00, 0x07, 0x80, 0xC0, 0x00, 0x07, 0x70, 0x0C, 0x22, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x70, 0x03, 0x08, 0x07, 0x09, 0x38, 0x20, 0x07,
+    0x88, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x07, 0x01, 0x0C, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x10, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x20, 0x3F,
+    0x02, 0x10, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x20, 0x80, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x01, 0x3F, 0x80, 0x20, 0x40, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0xA0, 0x00, 0x01, 0x3F, 0x02, 0x80, 0x01, 0x3F,
+    0x00, 0x14, 0x09, 0x3F, 0x00, 0x00, 0xC1, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x105 'ą'
+    0x00, 0x00, 0x07, 0x01, 0x04, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x61, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x90, 0x24, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x37, 0x94, 0x02, 0x07, 0x40, 0x01, 0x07,
+    0x00, 0x00, 0x27, 0x82, 0x90, 0x0F, 0x80, 0x12, 0x0F, 0x00, 0x24, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC1, 0x87, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x44, 0x07,
+    0x00, 0x03, 0x01, 0x07, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x02, 0x80, 0x00, 0x87, 0x02, 0x90, 0x00, 0x87,
+    0x10, 0x00, 0x00, 0x97, 0x04, 0x10, 0x00, 0x07, 0x04, 0x8E, 0x00, 0x07,
+    0x40, 0x02, 0x02, 0x47, 0x48, 0x80, 0x01, 0x07, 0x00, 0x0C, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x107 'ć'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x23, 0x00, 0xFF,
+    0x00, 0x44, 0x00, 0x7F, 0x00, 0x48, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x42, 0x40, 0x12, 0x7F, 0x04, 0x44, 0x00, 0x7F,
+    0x88, 0x30, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x7F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC1, 0x87, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x44, 0x07,
+    0x00, 0x03, 0x01, 0x07, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x8F, 0x40, 0x80, 0x00, 0x87, 0x02, 0x90, 0x00, 0x87,
+    0x02, 0x00, 0x00, 0x97, 0x12, 0x10, 0x00, 0x07, 0x24, 0x8E, 0x00, 0x07,
+    0x08, 0x02, 0x02, 0x47, 0x00, 0x80, 0x01, 0x07, 0x20, 0x0C, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x10D 'č'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x70, 0x23, 0x00, 0xFF,
+    0x84, 0x44, 0x00, 0x7F, 0x42, 0x48, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x12, 0x00, 0x00, 0x7F, 0x24, 0x40, 0x12, 0x7F, 0x40, 0x44, 0x00, 0x7F,
+    0x90, 0x30, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x05, 0x07, 0x00, 0x10, 0x50, 0x07, 0x00, 0x9A, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x02, 0x87, 0x20, 0x80, 0x50, 0x47,
+    0x00, 0x06, 0x00, 0x07, 0x44, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x97,
+    0x02, 0x10, 0x00, 0x87, 0x10, 0x90, 0x01, 0x07, 0x24, 0x08, 0x00, 0x27,
+    0x00, 0x80, 0x08, 0x27, 0x40, 0x40, 0x80, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x60, 0x20, 0x00, 0x07, 0x00, 0x18, 0x04, 0x07, 0x00, 0x00, 0x90, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21, 0x01, 0x20, 0x49,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x01, 0x28, 0x05, 0x02, 0x00, 0x03,
+    0x90, 0x00, 0x01, 0x00, 0x02, 0x25, 0x80, 0xA0, 0x21, 0x0A, 0x00, 0x49,
+    0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x05, 0x00, 0x3F, 0xA0, 0x40, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xC0, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x06, 0x00, 0x41, 0xBF, 0x00, 0x00, 0x44, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x10, 0x00, 0x06, 0x3F, 0x10, 0x00, 0x09, 0x3F, 0x10, 0x20, 0x01, 0x3F,
+    0x02, 0x00, 0x60, 0xBF, 0x02, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x08, 0x02, 0x07, 0x00, 0x00, 0x07,
+    0x03, 0x10, 0x47, 0x40, 0x41, 0x87, 0x90, 0x40, 0x07, 0xA2, 0x00, 0xA7,
+    0x20, 0x10, 0x0F, 0x01, 0x00, 0x17, 0x80, 0x24, 0x07, 0x80, 0x18, 0x07,
+    0x48, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x05, 0x0F, 0x00, 0xA0, 0x40, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xCF, 0x40, 0x00, 0x10, 0x0F,
+    0x08, 0x06, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x4F, 0x12, 0x00, 0x00, 0x4F,
+    0x02, 0x10, 0x00, 0x0F, 0x02, 0x10, 0x00, 0x0F, 0x24, 0x10, 0x20, 0x0F,
+    0x08, 0x02, 0x00, 0x6F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x88, 0x7F, 0x70, 0x20, 0x20, 0xFF,
+    0x84, 0x48, 0x20, 0x7F, 0x42, 0x51, 0x00, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x12, 0x00, 0x80, 0x7F, 0x24, 0x40, 0x12, 0x7F, 0x40, 0x40, 0x0C, 0x7F,
+    0x90, 0x24, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x05, 0x0F, 0x00, 0xA0, 0x40, 0x0F, 0x00, 0x0A, 0x00, 0x0F,
+    0x06, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x02, 0xCF, 0x00, 0x00, 0x28, 0x0F,
+    0x20, 0x05, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x20, 0x00, 0x4F,
+    0x00, 0xC0, 0x00, 0x8F, 0x30, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x80, 0x28, 0x03,
+    0x08, 0x02, 0x00, 0x07, 0x05, 0x10, 0x00, 0x03, 0x00, 0x00, 0x01, 0x0B,
+    0x05, 0x00, 0x50, 0x4B, 0x00, 0x04, 0x00, 0x13, 0x08, 0x20, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x43,
+    0x28, 0x10, 0x03, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xB3,
+    0x00, 0x0A, 0x03, 0x01, 0x40, 0x13, 0x00, 0x00, 0x13, 0x08, 0x00, 0x13,
+    0x30, 0x00, 0x23, 0x06, 0x00, 0x43, 0x20, 0x01, 0x07, 0x06, 0x01, 0x03,
+    0x88, 0x00, 0x03, 0x60, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x40, 0x14, 0x01, 0x01, 0x00, 0x03,
+    0x88, 0x00, 0x01, 0x00, 0x00, 0x85, 0x80, 0x28, 0x25, 0x02, 0x00, 0x09,
+    0x10, 0x00, 0x01, 0x0A, 0x00, 0x01, 0x20, 0x00, 0x01, 0x84, 0x00, 0x01,
+    0x98, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x2D, 0x0F,
+    0xA0, 0x40, 0x0F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xCF,
+    0x00, 0x28, 0x0F, 0x04, 0x00, 0x4F, 0x01, 0x00, 0x4F, 0x20, 0x00, 0x4F,
+    0xC0, 0x00, 0x8F, 0x00, 0x01, 0x0F, 0x00, 0x04, 0x1F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x142 'ł'
+    0x00, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0xC5, 0x40, 0x00, 0x01,
+    0x01, 0x00, 0x03, 0x88, 0x00, 0x01, 0x00, 0x00, 0x85, 0x80, 0x18, 0x25,
+    0x02, 0x80, 0x09, 0x10, 0xA0, 0x01, 0x00, 0xC0, 0x01,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x05, 0x07, 0x00, 0xA0, 0x50, 0x07, 0x00, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x01, 0x00, 0x27,
+    0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x0A, 0x06, 0x01, 0x87, 0x00, 0x00, 0x80, 0x67, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x08, 0x0F, 0x00, 0xA0, 0x50, 0x07, 0x08, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x47, 0x00, 0x00, 0x08, 0x07, 0x00, 0x02, 0x80, 0x07,
+    0x00, 0x10, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x06, 0x7F, 0x00, 0x40, 0xA0, 0x7F,
+    0x00, 0x0A, 0x00, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x0A, 0x7F,
+    0x00, 0x40, 0x20, 0x7F, 0x00, 0x38, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x02, 0x20, 0x08, 0x7F, 0x00, 0x48, 0x80, 0x7F, 0x22, 0x42, 0x00, 0xFF,
+    0x04, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x41, 0x88, 0x7F,
+    0x00, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x05, 0x07, 0x00, 0xA0, 0x50, 0x07, 0x00, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x01, 0x00, 0x27,
+    0x60, 0x00, 0x40, 0x07, 0x08, 0x00, 0x00, 0x07, 0x44, 0x00, 0x00, 0x07,
+    0x02, 0x06, 0x01, 0x87, 0x12, 0x00, 0x80, 0x67, 0x00, 0x00, 0x00, 0x0F,
+    0x24, 0x00, 0x08, 0x0F, 0x08, 0xA0, 0x50, 0x07, 0x40, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x47, 0x20, 0x00, 0x08, 0x07, 0x00, 0x02, 0x80, 0x07,
+    0x00, 0x10, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x06, 0x7F, 0x00, 0x40, 0xA0, 0x7F,
+    0x00, 0x0A, 0x00, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x0A, 0x7F,
+    0x70, 0x40, 0x20, 0x7F, 0x84, 0x38, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F,
+    0x10, 0x20, 0x08, 0x7F, 0x02, 0x48, 0x80, 0x7F, 0x24, 0x42, 0x00, 0xFF,
+    0x08, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xA0, 0x41, 0x88, 0x7F,
+    0x40, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x07, 0x00, 0x41, 0x87, 0x02, 0x00, 0x47, 0x08, 0x00, 0x27,
+    0x00, 0x00, 0x17, 0x20, 0x3E, 0x17, 0x01, 0x01, 0x07, 0x04, 0x00, 0x07,
+    0x08, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x07,
+    0x80, 0x01, 0x87, 0x80, 0x28, 0x07, 0x05, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x00, 0x18, 0x07, 0x05, 0x00, 0x47, 0x10, 0x00, 0x47,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x10, 0x01, 0x07, 0x10, 0x12, 0x07,
+    0x12, 0x00, 0x37, 0x02, 0x02, 0x87, 0x04, 0x00, 0x07, 0xD0, 0x00, 0x07,
+    // 0x153 'œ'
+    0x00, 0x00, 0x06, 0x0C, 0x00, 0x02, 0x20, 0x00, 0x40, 0x40, 0x00, 0x01,
+    0x80, 0x01, 0x80, 0x08, 0x00, 0x02, 0x00, 0x20, 0x89, 0x04, 0x80, 0x04,
+    0x00, 0x02, 0x00, 0x00, 0x43, 0x11, 0x11, 0x01, 0x02, 0x00, 0x80, 0x82,
+    0x18, 0x12, 0x00, 0x24, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x05, 0x07, 0x00, 0x10, 0x40, 0x07, 0x00, 0x9A, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x80, 0x02, 0x87, 0x08, 0x80, 0x48, 0x07,
+    0x00, 0x0A, 0x0C, 0x07, 0x12, 0x20, 0x41, 0x07, 0x02, 0x00, 0x40, 0x07,
+    0x02, 0x90, 0x00, 0x27, 0x24, 0x87, 0x04, 0x17, 0x08, 0x80, 0x22, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x40, 0x00, 0x8F, 0x00, 0x02, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x40, 0x50, 0x00, 0x05, 0x00,
+    0x00, 0x40, 0x00, 0x60, 0x00, 0x04, 0x80, 0x40, 0x10, 0x42, 0x38, 0x00,
+    0x00, 0x12, 0x00, 0x12, 0x20, 0x00, 0x24, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x90, 0x04, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x04, 0x17,
+    0x00, 0x09, 0x00, 0x17, 0x00, 0x20, 0x46, 0x07, 0x00, 0x40, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x8C, 0x10, 0x4F, 0x06, 0x80, 0x08, 0x47,
+    0x02, 0x01, 0x00, 0x87, 0x00, 0x00, 0x03, 0x17, 0x20, 0x00, 0x00, 0x17,
+    0x00, 0x8C, 0x40, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x82, 0x06, 0x07,
+    0x30, 0x50, 0x00, 0x07,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x0B, 0x10, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x44, 0xFF,
+    0x00, 0x40, 0x00, 0xFF, 0x00, 0x40, 0x04, 0x7F, 0x04, 0x10, 0x01, 0x7F,
+    0x10, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x70, 0x7F,
+    0x08, 0x18, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x04, 0x17,
+    0x00, 0x09, 0x00, 0x17, 0x00, 0x20, 0x46, 0x07, 0x00, 0x40, 0x20, 0x07,
+    0x40, 0x00, 0x00, 0x4F, 0x08, 0x8C, 0x10, 0x4F, 0x00, 0x80, 0x08, 0x47,
+    0x20, 0x01, 0x00, 0x87, 0x12, 0x00, 0x03, 0x17, 0x00, 0x00, 0x00, 0x17,
+    0x04, 0x8C, 0x40, 0x07, 0x48, 0x00, 0x20, 0x07, 0x10, 0x82, 0x06, 0x07,
+    0x00, 0x50, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x0B, 0x10, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x40, 0x00, 0x44, 0xFF,
+    0x08, 0x40, 0x00, 0xFF, 0x40, 0x40, 0x04, 0x7F, 0x20, 0x10, 0x01, 0x7F,
+    0x10, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x48, 0x00, 0x70, 0x7F,
+    0x10, 0x18, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x06, 0x00, 0x4F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x10, 0x04, 0x0F,
+    0x30, 0x11, 0x40, 0x0F, 0x00, 0x18, 0x00, 0x0F, 0x44, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x06, 0x4F, 0x02, 0x00, 0xA0, 0x1F, 0x12, 0x14, 0x00, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x40, 0x10, 0x00, 0x0F, 0x10, 0x12, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F,
+    0x00, 0xA0, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x88, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x80, 0x08, 0x10, 0x12,
+    0x0A, 0x00, 0x12, 0x00, 0x00, 0x24, 0x20, 0x00, 0x08, 0x02, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x16E 'Ů'
+    0x00, 0x60, 0x08, 0x07, 0x00, 0x81, 0x40, 0x27, 0x00, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x87,
+    0x00, 0x0A, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x00, 0x00, 0x07,
+    0x02, 0x80, 0x00, 0x87, 0x18, 0x00, 0x00, 0x97, 0x04, 0x00, 0x01, 0x07,
+    0x00, 0x20, 0x14, 0x07, 0x92, 0x02, 0x80, 0x07, 0x04, 0x10, 0x00, 0x87,
+    0x18, 0x00, 0x03, 0x07, 0x00, 0x00, 0x28, 0x07, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x41, 0x80, 0x7F,
+    0x00, 0x44, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x50, 0x7F,
+    0x1C, 0x03, 0x00, 0x7F, 0x20, 0x30, 0x02, 0x7F, 0x48, 0x00, 0x04, 0x7F,
+    0xA5, 0x00, 0x00, 0x7F, 0x05, 0x03, 0x03, 0x7F, 0x91, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1C, 0x40, 0x40, 0x7F, 0x00, 0x46, 0x01, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x60, 0x08, 0x07, 0x00, 0x81, 0x40, 0x27, 0x00, 0x14, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x60, 0x87,
+    0x04, 0x0A, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x07,
+    0x04, 0x80, 0x00, 0x87, 0x04, 0x00, 0x00, 0x97, 0x48, 0x00, 0x01, 0x07,
+    0x88, 0x20, 0x14, 0x07, 0x3E, 0x02, 0x80, 0x07, 0x02, 0x10, 0x00, 0x87,
+    0x10, 0x00, 0x03, 0x07, 0x00, 0x00, 0x28, 0x07, 0x40, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x50, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x41, 0x80, 0x7F,
+    0x00, 0x44, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x50, 0x7F,
+    0x00, 0x03, 0x00, 0x7F, 0x12, 0x30, 0x02, 0x7F, 0x44, 0x00, 0x04, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x52, 0x03, 0x03, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x44, 0x40, 0x40, 0x7F, 0x08, 0x46, 0x01, 0x7F,
+    0x50, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x178 'Ÿ'
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x3F,
+    0x00, 0x04, 0x01, 0x3F, 0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x50, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x81, 0x00, 0x3F,
+    0x80, 0x02, 0x19, 0x3F, 0x40, 0x08, 0x00, 0x7F, 0x20, 0x80, 0x80, 0x3F,
+    0x00, 0xC2, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x08, 0x00, 0x3F,
+    0xA0, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x2C, 0x02, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x02, 0x10, 0x07,
+    0x00, 0x18, 0x20, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x10, 0x82, 0x47,
+    0x0A, 0x10, 0x00, 0x47, 0x00, 0x04, 0x10, 0x47, 0x00, 0x00, 0x00, 0x47,
+    0x20, 0x10, 0x00, 0x87, 0x00, 0x00, 0x83, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x27, 0x00, 0x80, 0x00, 0x87, 0x00, 0x40, 0x00, 0x07,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x40, 0x10, 0x7F, 0x00, 0x08, 0x08, 0x7F, 0x02, 0x40, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0xFF, 0x22, 0x20, 0x00, 0x7F, 0x04, 0x02, 0x00, 0x7F,
+    0x08, 0x04, 0x11, 0x7F, 0x30, 0x48, 0x08, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x58, 0x04, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x20, 0x0F,
+    0x00, 0x30, 0x40, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x21, 0x04, 0x8F,
+    0x20, 0x20, 0x00, 0x8F, 0x00, 0x08, 0x20, 0x8F, 0x80, 0x00, 0x00, 0x8F,
+    0x88, 0x20, 0x01, 0x0F, 0x60, 0x01, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x08, 0x00, 0x4F, 0x01, 0x00, 0x01, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x15, 0x00, 0x40, 0x21, 0x00, 0x00, 0x41,
+    0x01, 0x00, 0x09, 0x00, 0x20, 0x01, 0x01, 0x00, 0x41, 0x30, 0x20, 0x21,
+    0x09, 0x00, 0x01, 0x88, 0x80, 0x03, 0x90, 0x80, 0x01, 0x60, 0x08, 0x01,
+    0x00, 0x10, 0x45, 0x01, 0x20, 0x21, 0x00, 0x40, 0x01,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x2C, 0x02, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x02, 0x10, 0x07,
+    0x60, 0x18, 0x20, 0x07, 0x08, 0x10, 0x00, 0x07, 0x44, 0x10, 0x82, 0x47,
+    0x02, 0x10, 0x00, 0x47, 0x12, 0x04, 0x10, 0x47, 0x00, 0x00, 0x00, 0x47,
+    0x24, 0x10, 0x00, 0x87, 0x08, 0x00, 0x83, 0x07, 0x40, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x27, 0x20, 0x80, 0x00, 0x87, 0x00, 0x40, 0x00, 0x07,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x70, 0x08, 0x00, 0x7F,
+    0x84, 0x40, 0x10, 0x7F, 0x02, 0x08, 0x08, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x02, 0x20, 0x00, 0xFF, 0x24, 0x20, 0x00, 0x7F, 0x40, 0x02, 0x00, 0x7F,
+    0x80, 0x04, 0x11, 0x7F, 0xA0, 0x48, 0x08, 0x7F, 0x40, 0x10, 0x00, 0x7F,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x00, 0x08, 0x48, 0x11, 0x00, 0x00, 0x90, 0x00, 0x04, 0x0C,
+    0x00, 0x00, 0x01, 0x80, 0x10, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x12, 0x80, 0x10, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x01, 0x07,
+    0x00, 0x08, 0x07, 0x02, 0x80, 0x07, 0x00, 0x00, 0x07, 0x10, 0x01, 0x47,
+    0x00, 0x28, 0x07, 0x43, 0x01, 0x17, 0x08, 0x02, 0x17, 0x00, 0x40, 0x07,
+    0x80, 0x80, 0x4F, 0x20, 0x10, 0x4F, 0x04, 0x08, 0x47, 0x98, 0x04, 0x07,
+    0x01, 0x03, 0x17, 0x00, 0x00, 0x07, 0x04, 0x20, 0x07, 0x08, 0x10, 0x47,
+    0x00, 0x02, 0x07,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F,
+    // 0x2014 '—'
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2018 '‘'
+    0x04, 0x7F, 0x10, 0xFF, 0x20, 0x7F, 0x00, 0x7F, 0x19, 0x7F, 0x20, 0x7F,
+    0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x81, 0x7F, 0x84, 0x7F,
+    0x78, 0x7F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x06, 0x3F, 0x30, 0x3F, 0x00, 0x3F, 0x82, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F,
+    // 0x201B '‛'
+    0x30, 0x3F, 0x84, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x18, 0x7F, 0x00, 0x3F,
+    0x00, 0x3F,
+    // 0x201C '“'
+    0x04, 0x7F, 0x10, 0xFF, 0x20, 0x7F, 0x00, 0x7F, 0x19, 0x7F, 0x20, 0x7F,
+    0x03, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x11, 0x7F, 0x20, 0x7F,
+    0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x3F, 0x00, 0x3F, 0x04, 0x3F, 0x10, 0x3F, 0x80, 0x3F, 0x82, 0x3F,
+    0x38, 0x3F, 0x01, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x84, 0x3F,
+    0x28, 0x3F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x06, 0x3F, 0x30, 0x3F, 0x00, 0x3F, 0x82, 0x3F, 0x00, 0x3F,
+    0x02, 0x3F, 0x4C, 0x3F, 0x80, 0xBF, 0x81, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x201F '‟'
+    0x30, 0x3F, 0x84, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x18, 0x7F, 0x00, 0x3F,
+    0x30, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x3F,
+    // 0x2020 '†'
+    0x06, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x01, 0x1F, 0x01, 0x0C, 0x1F,
+    0x00, 0xA0, 0x1F, 0x0C, 0x00, 0x1F, 0x00, 0x24, 0x1F, 0x84, 0x00, 0x1F,
+    0x31, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x01, 0x83, 0x00, 0x04, 0x03, 0x06, 0x04, 0x03, 0x00, 0x00, 0x8B,
+    0x04, 0x00, 0x47, 0x01, 0x1C, 0x07, 0x00, 0xC0, 0x07, 0x0C, 0x00, 0x3B,
+    0x00, 0x00, 0x03, 0x84, 0x00, 0x83, 0x31, 0x00, 0x03, 0x04, 0x04, 0x03,
+    0x04, 0x06, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03,
+    // 0x2022 '•'
+    0x01, 0x43, 0x01, 0x81, 0x83, 0x41, 0x31,
+    // 0x2026 '…'
+    0x67, 0x0F, 0x0F, 0x07, 0xE7, 0x07, 0x07, 0x07, 0x07, 0x27, 0x8F, 0x87,
+    0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x87, 0x0F, 0x17, 0x27,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x05, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x20, 0x2F, 0x07, 0x0F,
+    0x08, 0x8F, 0x10, 0x0F, 0x60, 0x0F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x00, 0x0F, 0x00, 0x4F, 0x40, 0x8F, 0x90, 0x2F, 0x8A, 0x0F, 0x40, 0x4F,
+    0x20, 0x0F, 0x11, 0x0F, 0x08, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x43, 0x06, 0x03, 0x10, 0x07, 0x20, 0x07, 0x00, 0x13, 0x08, 0x13,
+    0x10, 0x17, 0x10, 0x47, 0x01, 0x0B, 0x40, 0x13, 0x00, 0x23, 0x0E, 0x83,
+    // 0x2074 '⁴'
+    0x00, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x01, 0x03,
+    0x00, 0x0F, 0x27, 0x07, 0x00, 0x03, 0x00, 0x83, 0x08, 0x03, 0x00, 0x63,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x18, 0x27, 0xC0, 0x07, 0x82, 0x0F,
+    0xBA, 0x4F, 0x80, 0x17, 0x80, 0x07, 0x84, 0x47, 0x80, 0x07, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x01, 0xE3, 0x00, 0x03, 0x08, 0x03, 0x11, 0xB3, 0x04, 0x03, 0x08, 0x13,
+    0x04, 0xA7, 0x00, 0x03, 0x02, 0x03, 0x00, 0xC3, 0x40, 0x03, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x20, 0x17, 0x00, 0x0F, 0x90, 0x87, 0x82, 0x07, 0x84, 0x27, 0x80, 0x07,
+    0xA2, 0x07, 0x80, 0x07, 0x80, 0x07, 0xA0, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x43, 0x08, 0x87, 0x20, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x17,
+    0x04, 0x63, 0x00, 0x03, 0x42, 0x0B, 0x44, 0x03, 0x08, 0x03,
+    // 0x2079 '⁹'
+    0x00, 0x03, 0x00, 0x07, 0x01, 0x13, 0x20, 0x87, 0x00, 0x13, 0x10, 0x67,
+    0x00, 0x0B, 0x01, 0x0B, 0x00, 0x13, 0x00, 0x23, 0x00, 0x83, 0x0E, 0x03,
+    // 0x2080 '₀'
+    0x00, 0x87, 0x0C, 0x07, 0x00, 0x07, 0x40, 0x07, 0x02, 0x27, 0x10, 0x27,
+    0x00, 0x2F, 0x20, 0x8F, 0x02, 0x17, 0x80, 0x27, 0x00, 0x47, 0x1D, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x07, 0x10, 0x17, 0x00, 0x47, 0x0A, 0x07, 0x00, 0x07,
+    0x00, 0x47, 0x4A, 0x13, 0x20, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x27, 0x20, 0x0F, 0x00, 0x8F, 0x10, 0x0F, 0x80, 0x6F,
+    0x02, 0x2F, 0x24, 0xAF, 0x10, 0x2F, 0x00, 0x27, 0x00, 0x27, 0x30, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x03, 0x00, 0x03, 0x40, 0x03, 0x11, 0x23, 0x00, 0x2B, 0x20, 0x03,
+    0x20, 0x83, 0x00, 0x03, 0x00, 0x03, 0x08, 0x83,
+    // 0x2084 '₄'
+    0x00, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x01, 0x07, 0x02, 0x07,
+    0x04, 0x1F, 0x0E, 0x0F, 0x00, 0x07, 0x01, 0x27, 0x94, 0x07, 0x00, 0xC7,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x10, 0x23, 0xC0, 0x03, 0x82, 0x0B,
+    0x98, 0x0B, 0x80, 0x03, 0x80, 0x03, 0x84, 0x43, 0x80, 0x03, 0x00, 0x03,
+    // 0x2086 '₆'
+    0x02, 0xC7, 0x00, 0x07, 0x10, 0x07, 0x21, 0x67, 0x08, 0x07, 0x1A, 0x07,
+    0x09, 0x4F, 0x80, 0x0F, 0x20, 0x07, 0x01, 0xE7, 0x80, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x28, 0x13, 0x88, 0x43, 0x98, 0x83, 0x82, 0x03, 0x80, 0x23, 0x88, 0x03,
+    0xA2, 0x03, 0x80, 0x03, 0x88, 0x03, 0x00, 0x03, 0x00, 0x03,
+    // 0x2088 '₈'
+    0x00, 0x07, 0x11, 0x0F, 0x40, 0x0F, 0x00, 0xA7, 0x01, 0x07, 0x00, 0x2F,
+    0x08, 0x87, 0x20, 0x07, 0x84, 0x17, 0x00, 0x07, 0x10, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x0F, 0x22, 0x07, 0x41, 0x27, 0x80, 0xAF, 0xA0, 0xCF,
+    0x00, 0x07, 0x00, 0x17, 0x80, 0x07, 0x80, 0x07, 0x01, 0x07, 0x1C, 0x07,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x54, 0x07, 0x01, 0x10, 0x07,
+    0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x21, 0x14, 0x07, 0x01, 0x14, 0x07, 0x01, 0x04, 0x0F, 0x09, 0x04, 0x0F,
+    0x01, 0x04, 0x07, 0x81, 0x00, 0x07, 0x81, 0x00, 0x17, 0x80, 0x00, 0x17,
+    0x82, 0x00, 0x07, 0x00, 0x00, 0xC7, 0x4C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x00, 0x3F, 0xC0, 0x3F, 0x20, 0x3F, 0x0A, 0x3F, 0x00, 0x3F, 0x02, 0xBF,
+    0x30, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0x30, 0x3F, 0x01, 0x3F, 0xA0, 0x3F,
+    0x02, 0xFF, 0x0B, 0x3F, 0xC0, 0x3F, 0x00, 0x3F, 0x04, 0x7F, 0x04, 0x3F,
+    0x80, 0x3F, 0x0E, 0x3F, 0x00, 0x7F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x08, 0x0A, 0x01, 0x28, 0x52, 0x01,
+    0x0D, 0x02, 0x01, 0x00, 0x02, 0x01, 0x40, 0x52, 0x05, 0x44, 0x08, 0x23,
+    0x20, 0x00, 0x41, 0x00, 0x00, 0x01, 0x00, 0x02, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x81, 0x00, 0x22, 0x01, 0x00, 0x44, 0x01, 0x01, 0x10, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x40, 0x01, 0x01, 0x00, 0x11, 0x00, 0x10, 0x15,
+    0x84, 0x4A, 0x05, 0x00, 0x10, 0x05, 0x40, 0x85, 0x21, 0x00, 0x24, 0x09,
+    0x00, 0x00, 0x09, 0x00, 0x82, 0x01, 0x00, 0x00, 0x61, 0x00, 0x08, 0x01,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x04, 0x00, 0x01, 0x00, 0x22, 0x01,
+    0x20, 0x02, 0x01, 0x00, 0x92, 0x01, 0x41, 0x02, 0x01, 0x42, 0x42, 0x05,
+    0x40, 0x00, 0x11, 0x00, 0x00, 0x01, 0x20, 0x00, 0x05, 0x0C, 0x01, 0x11,
+    0x00, 0x00, 0x21, 0x00, 0x08, 0x81, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00, 0x40, 0x01, 0x08, 0x00, 0x11,
+    0x01, 0x10, 0x15, 0x44, 0x4A, 0x05, 0x00, 0x10, 0x05, 0x10, 0x85, 0x21,
+    0x00, 0x24, 0x09, 0x00, 0x00, 0x09, 0x00, 0x82, 0x01, 0x00, 0x00, 0x61,
+    0x00, 0x08, 0x01,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x08, 0x0A, 0x01, 0x28, 0x52, 0x01,
+    0x0D, 0x02, 0x01, 0x00, 0x02, 0x01, 0x40, 0x52, 0x09, 0x44, 0x08, 0x23,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x00, 0x04, 0x41,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x88, 0x01,
+    0x02, 0x20, 0x01, 0x04, 0x00, 0x61, 0x10, 0x80, 0x89, 0x22, 0x0D, 0x01,
+    0x80, 0x40, 0x61, 0x08, 0x00, 0x15, 0x60, 0x98, 0x15, 0x00, 0x20, 0xA1,
+    0x00, 0x28, 0x09, 0x00, 0x02, 0x09, 0x00, 0x05, 0x11, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x08, 0x01, 0x04, 0x48, 0x01,
+    0x00, 0x02, 0x01, 0x42, 0x00, 0x0D, 0x40, 0x64, 0x01, 0x40, 0x00, 0x21,
+    0x00, 0x00, 0x81, 0x14, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0x41,
+    0x00, 0x11, 0x01, 0x00, 0x22, 0x01, 0x00, 0x88, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x20, 0x01, 0x00, 0x80, 0x61, 0x00, 0x00, 0x89, 0x02, 0x0D, 0x01,
+    0x88, 0x40, 0x61, 0x40, 0x00, 0x15, 0x20, 0x98, 0x15, 0x00, 0x20, 0xA1,
+    0x00, 0x28, 0x09, 0x00, 0x02, 0x09, 0x00, 0x05, 0x11, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x03, 0x08, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x12, 0x01, 0x04, 0x00, 0x0D, 0x00, 0x04, 0x11,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x11, 0x30, 0x02, 0x01,
+    0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x10, 0x01, 0x04, 0x40, 0x01, 0x08, 0x00, 0x61, 0x21, 0x00, 0x89,
+    0x40, 0x0D, 0x01, 0x88, 0x40, 0x61, 0x10, 0x00, 0x15, 0x00, 0x98, 0x15,
+    0x00, 0x20, 0xA1, 0x00, 0x28, 0x09, 0x00, 0x02, 0x09, 0x00, 0x05, 0x11,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0x215E '⅞'
+    0x00, 0x04, 0x01, 0x22, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x86, 0x01,
+    0x00, 0x10, 0x15, 0x04, 0x60, 0x23, 0x08, 0x00, 0x05, 0x00, 0x01, 0x09,
+    0x04, 0x00, 0x21, 0x00, 0x04, 0x41, 0x00, 0x11, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x02, 0x20, 0x01, 0x00, 0x80, 0x01,
+    0x10, 0x00, 0x61, 0x02, 0x00, 0x89, 0x00, 0x0D, 0x01, 0x00, 0x40, 0x61,
+    0x60, 0x00, 0x15, 0x00, 0x98, 0x15, 0x00, 0x20, 0xA1, 0x00, 0x28, 0x09,
+    0x00, 0x02, 0x09, 0x00, 0x05, 0x11, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0x2190 '←'
+    0x04, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x09, 0x87,
+    0x91, 0x57, 0x41, 0x27, 0x01, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x00, 0x07,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x11, 0x00, 0x1F,
+    0x24, 0x00, 0x1F, 0x40, 0x03, 0xDF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0xDF, 0x24, 0x00, 0x1F, 0x11, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x00, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x01, 0x07, 0x41, 0x27, 0x91, 0x47,
+    0x09, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x08, 0x07, 0x04, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x1F,
+    0x00, 0x08, 0x9F, 0xF0, 0x00, 0x5F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x5F, 0x00, 0x08, 0x9F, 0x00, 0x01, 0x1F, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x03, 0x07, 0x08, 0x87, 0x10, 0x47, 0x20, 0x27, 0x49, 0x17, 0x91, 0x87,
+    0x41, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x41, 0x07,
+    0x91, 0x87, 0x49, 0x17, 0x20, 0x27, 0x10, 0x47, 0x00, 0x87, 0x03, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x02, 0x02, 0x1F, 0x02, 0x11, 0x1F, 0x00, 0x04, 0x9F,
+    0x08, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x08, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x02, 0x11, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x00, 0x80, 0x00, 0x20, 0x00, 0x10, 0x01, 0x08, 0x11, 0x44, 0x21, 0x42,
+    0x49, 0x51, 0x51, 0x40, 0x01, 0x42, 0x01, 0x50, 0x01, 0x50, 0x01, 0x50,
+    0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x40, 0x09, 0x40, 0x07, 0x20,
+    // 0x21D1 '⇑'
+    0x01, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x09, 0x00, 0x3F,
+    0x03, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x3F,
+    0x09, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x02, 0x00, 0x3F, 0x01, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x07, 0x20, 0x09, 0x40, 0x01, 0x40, 0x01, 0x50, 0x01, 0x50, 0x01, 0x50,
+    0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x42, 0x51, 0x40, 0x49, 0x51,
+    0x21, 0x42, 0x11, 0x44, 0x01, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x80,
+    // 0x21D3 '⇓'
+    0x00, 0x10, 0x3F, 0x00, 0x28, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x02, 0x3F,
+    0x03, 0xF1, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x07, 0xF1, 0x3F,
+    0x00, 0x02, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x28, 0x3F, 0x00, 0x10, 0x3F,
+    // 0x21D4 '⇔'
+    0x01, 0x81, 0x04, 0x41, 0x08, 0x21, 0x10, 0x11, 0x22, 0x89, 0x42, 0x81,
+    0x0A, 0x85, 0x4A, 0xA9, 0x0A, 0xA1, 0x0A, 0xA1, 0x4A, 0xA9, 0x0A, 0x85,
+    0x42, 0x85, 0x22, 0x89, 0x10, 0x11, 0x08, 0x21, 0x00, 0x41, 0x01, 0x81,
+    // 0x2202 '∂'
+    0x00, 0x00, 0xC1, 0x00, 0x0C, 0x09, 0x00, 0x00, 0x05, 0x30, 0x40, 0x01,
+    0x50, 0x03, 0x41, 0x80, 0x88, 0x13, 0x80, 0x00, 0x03, 0xA0, 0x20, 0x01,
+    0x00, 0x00, 0x25, 0x90, 0x21, 0x81, 0x05, 0x04, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x30, 0x03, 0x01, 0x04, 0x10, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0xC0, 0x8F, 0x00, 0x00, 0x0F, 0x18, 0x18, 0x0F, 0x40, 0xC0, 0x0F,
+    0x80, 0x00, 0x0F, 0x86, 0x00, 0x0F, 0x00, 0xC0, 0x0F, 0x00, 0x18, 0x0F,
+    0x60, 0x03, 0x0F, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x0C, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x10, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x10, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x20, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x01, 0x7F, 0x88, 0x00, 0x00, 0xFF,
+    0x02, 0x00, 0x20, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x08, 0xFF,
+    0x00, 0x02, 0x00, 0xFF, 0x18, 0x08, 0x20, 0xFF, 0x10, 0x00, 0x00, 0xFF,
+    0x11, 0x01, 0x00, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0x10, 0x14, 0x00, 0xFF,
+    0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x40, 0x7F, 0x82, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7A, 0x7F,
+    // 0x221A '√'
+    0x00, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x01, 0x80, 0x1F, 0x00, 0x00, 0x18, 0x1F,
+    0x00, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x0C, 0x04, 0x1F,
+    0x00, 0x20, 0x30, 0x1F, 0x04, 0x01, 0x80, 0x1F, 0x10, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x0D, 0x1F, 0x00, 0x1F, 0x80, 0x5F, 0x82, 0x1F, 0x01, 0x1F, 0x80, 0x1F,
+    0x8A, 0x5F, 0x00, 0x9F, 0x21, 0x1F, 0x00, 0x9F, 0x00, 0x1F, 0x80, 0x5F,
+    0x80, 0x1F, 0x00, 0x1F, 0x8C, 0x5F, 0x80, 0x5F, 0x61, 0x1F, 0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0x8F,
+    0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x11, 0x12, 0x01, 0x12, 0x09, 0x12, 0x01, 0x12, 0x81, 0x11, 0x01,
+    0x10, 0x01, 0x10, 0x81, 0x02, 0x01, 0x42, 0x01, 0x52, 0x01, 0x12, 0x01,
+    0x12, 0x01,
+    // 0x2264 '≤'
+    0x00, 0x02, 0x7F, 0x01, 0x02, 0x7F, 0x08, 0x82, 0x7F, 0x08, 0x82, 0x7F,
+    0x10, 0x42, 0x7F, 0x10, 0x02, 0x7F, 0x20, 0x22, 0x7F, 0x20, 0x02, 0x7F,
+    0x40, 0x92, 0x7F, 0x40, 0x02, 0x7F, 0x80, 0x42, 0x7F, 0x00, 0x0A, 0x7F,
+    0x40, 0x12, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x01, 0x3F, 0x00, 0x0D, 0x3F, 0x48, 0x05, 0x3F, 0x48, 0x01, 0x3F,
+    0x24, 0x49, 0x3F, 0x24, 0x01, 0x3F, 0x12, 0x91, 0x3F, 0x02, 0x81, 0x3F,
+    0x08, 0x01, 0x3F, 0x00, 0x01, 0x3F, 0x04, 0x01, 0x3F, 0x00, 0x01, 0x3F,
+    0x00, 0x01, 0x3F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28BoldItalicBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x03, 0x01, 0xC1, 0x43, 0x30, 0x00, 0x43,
+    0x00, 0x0C, 0x33, 0x80, 0xC0, 0x03, 0x04, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x22 '"'
+    0x00, 0x5F, 0x10, 0x5F, 0x40, 0x5F, 0x01, 0x9F, 0x18, 0x1F, 0x00, 0x5F,
+    0x10, 0x5F, 0x40, 0x5F, 0x01, 0x9F, 0x18, 0x1F, 0x00, 0x1F,
+    // 0x23 '#'
+    0x00, 0x18, 0x3F, 0x00, 0x20, 0x3F, 0x0A, 0x21, 0x3F, 0x0A, 0x20, 0x3F,
+    0x09, 0x00, 0x3F, 0x10, 0x03, 0x3F, 0x80, 0x00, 0x3F, 0x01, 0x20, 0x3F,
+    0x3A, 0x21, 0xBF, 0x0A, 0x20, 0x3F, 0x0B, 0x80, 0x3F, 0x10, 0x01, 0x3F,
+    0x80, 0x00, 0x3F, 0x01, 0x20, 0x3F, 0x1A, 0x20, 0x3F, 0x0A, 0x18, 0x3F,
+    0x0A, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x50, 0x07, 0x00, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x10, 0x22, 0x27, 0x02, 0x00, 0x01, 0x07, 0x04, 0x00, 0x10, 0x27,
+    0x01, 0x03, 0x81, 0x07, 0x00, 0x00, 0x38, 0x07, 0x0A, 0x80, 0x08, 0x07,
+    0x08, 0x10, 0x92, 0x07, 0x41, 0x80, 0x00, 0x07, 0x09, 0x04, 0x04, 0x07,
+    0x00, 0x42, 0x00, 0x07, 0x04, 0x00, 0xC0, 0x07, 0x02, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x00, 0xE0, 0x01, 0x04, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x01,
+    0x04, 0x04, 0x09, 0x00, 0x00, 0x11, 0x00, 0x20, 0x03, 0x08, 0x88, 0x01,
+    0x00, 0x01, 0x11, 0x20, 0x20, 0x01, 0x10, 0x80, 0x81, 0x00, 0x11, 0x01,
+    0x00, 0x24, 0x01, 0x00, 0x88, 0x01, 0x01, 0x00, 0xE1, 0x04, 0x44, 0x09,
+    0x08, 0x80, 0x01, 0x00, 0x00, 0xC5, 0x44, 0x24, 0x15, 0x08, 0x08, 0x15,
+    0x40, 0x00, 0x21, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x20, 0x21,
+    0x00, 0x10, 0x81, 0x00, 0x00, 0x01,
+    // 0x26 '&'
+    0x00, 0x01, 0x81, 0x00, 0x08, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x04, 0x41, 0x03, 0xC0, 0x01, 0x10, 0x08, 0x21, 0x20, 0x02, 0x01,
+    0x03, 0x00, 0x21, 0x00, 0x10, 0x61, 0x01, 0x44, 0x09, 0x00, 0x00, 0x01,
+    0x04, 0x10, 0x01, 0x01, 0x00, 0x09, 0x02, 0x42, 0x01, 0x2C, 0x08, 0x65,
+    0x00, 0x00, 0x01, 0x00, 0x82, 0x01, 0x00, 0x80, 0x11, 0x00, 0x20, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x09, 0x01, 0x80, 0x01,
+    // 0x27 '''
+    0x00, 0x5F, 0x10, 0x5F, 0x40, 0x5F, 0x01, 0x9F, 0x18, 0x1F, 0x00, 0x1F,
+    // 0x28 '('
+    0x00, 0x06, 0x18, 0x07, 0x00, 0x20, 0x01, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x03, 0xE0, 0x27, 0x04, 0x10, 0x02, 0x17, 0x08, 0x00, 0x00, 0x87,
+    0x11, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x04, 0x47, 0x04, 0x00, 0x10, 0x87, 0x01, 0x80, 0x41, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x08, 0x07, 0x02, 0x00, 0x40, 0x07,
+    0x00, 0x7E, 0x00, 0x07,
+    // 0x2A '*'
+    0x00, 0x3F, 0x20, 0x3F, 0x48, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x00, 0x3F,
+    0x82, 0x3F, 0x00, 0x7F, 0x02, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x2B '+'
+    0x02, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F,
+    0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x01, 0x7F, 0x02, 0xFF, 0x40, 0x7F, 0x81, 0x7F, 0x02, 0x7F, 0x04, 0x7F,
+    0x10, 0x7F, 0x00, 0x7F,
+    // 0x2D '-'
+    0x4F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x6F,
+    // 0x2E '.'
+    0x27, 0x07, 0x0F, 0x07, 0x87,
+    // 0x2F '/'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x09, 0x00, 0x04, 0x21, 0x00, 0x10, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x84, 0x01, 0x02, 0x00, 0x01, 0x00, 0x20, 0x01, 0x10, 0x80, 0x01,
+    0x40, 0x00, 0x01, 0x04, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x0F, 0x07, 0x00, 0x80, 0x47, 0x02, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x10, 0x1E, 0x07, 0x00, 0x80, 0x87, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x97, 0x10, 0x01, 0x07, 0x00, 0x04, 0x27,
+    0x04, 0x20, 0x47, 0x00, 0x00, 0x87, 0x40, 0x00, 0x07, 0x20, 0x04, 0x07,
+    0x08, 0x60, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x28, 0x00, 0x4F,
+    0x28, 0x06, 0x0F, 0x08, 0x60, 0x0F, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x01, 0xCF, 0x00, 0x30, 0x0F, 0x06, 0x00, 0x1F, 0x20, 0x00, 0x0F,
+    // 0x32 '2'
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x40, 0x08, 0x0F, 0x00, 0x10, 0x0F,
+    0x10, 0x22, 0x0F, 0x10, 0x40, 0x0F, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x10, 0x0F, 0x40, 0x20, 0x1F, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x33 '3'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x47, 0x0C, 0x00, 0x47,
+    0x02, 0x00, 0x47, 0x02, 0x00, 0x07, 0x40, 0x40, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x17, 0x10, 0x01, 0x07, 0x11, 0x06, 0x27, 0x02, 0x00, 0x07,
+    0x00, 0x40, 0x07, 0x40, 0x80, 0x07, 0x01, 0x0C, 0x07, 0x1C, 0x00, 0x07,
+    // 0x34 '4'
+    0x00, 0x06, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x01, 0x0F, 0x00, 0x19, 0x0F, 0x00, 0x29, 0x0F, 0x00, 0x49, 0x0F,
+    0x00, 0x89, 0x4F, 0x01, 0x08, 0x0F, 0x02, 0xC0, 0x0F, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x0F, 0x00, 0x69, 0x0F, 0x04, 0x09, 0x0F, 0x40, 0x09, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x57, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x03, 0x40, 0x07,
+    0x10, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x0C, 0x21, 0x07,
+    0x00, 0x02, 0x07, 0x01, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x80, 0x87,
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x36 '6'
+    0x00, 0x19, 0x87, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x10, 0x07, 0x00, 0x20, 0x07, 0x00, 0x20, 0x47, 0x22, 0x20, 0x47,
+    0x04, 0x20, 0x07, 0x40, 0x11, 0x17, 0x08, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x10, 0x40, 0x07, 0x00, 0x33, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x37 '7'
+    0x0E, 0x00, 0x77, 0x40, 0x01, 0x07, 0x00, 0x04, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x41, 0x07, 0x00, 0x80, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x00, 0x07, 0x08, 0x40, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x50, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x08, 0x07, 0x00, 0x10, 0x17,
+    0x00, 0x80, 0x07, 0x00, 0x64, 0x07, 0x00, 0x08, 0x47, 0x46, 0x00, 0x47,
+    0x00, 0x10, 0x47, 0x10, 0x80, 0x07, 0x00, 0x00, 0x97, 0x01, 0x00, 0x07,
+    0x02, 0x60, 0x27, 0x00, 0x10, 0x47, 0x40, 0x09, 0x87, 0x20, 0x00, 0x07,
+    0x08, 0x00, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x20, 0x47, 0x00, 0x00, 0x07, 0x00, 0x08, 0x87, 0x41, 0x00, 0x17,
+    0x08, 0x01, 0x07, 0x10, 0x22, 0x27, 0x10, 0x24, 0x07, 0x10, 0x20, 0x07,
+    0x00, 0x00, 0x87, 0x03, 0x01, 0x07, 0x40, 0x00, 0x07, 0x20, 0x08, 0x07,
+    0x10, 0x20, 0x07, 0x00, 0x00, 0x07,
+    // 0x3A ':'
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x10, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x5F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x2F,
+    0x00, 0x00, 0x4F, 0x48, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x88, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x3C '<'
+    0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x00, 0x87, 0x00, 0x07, 0x00, 0x47,
+    0x01, 0x07, 0x00, 0x27, 0x08, 0x87, 0x40, 0x07, 0x10, 0x47, 0x80, 0x0F,
+    0x20, 0x27,
+    // 0x3D '='
+    0x63, 0x7F, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF,
+    // 0x3E '>'
+    0x00, 0x07, 0x00, 0x27, 0x90, 0x0F, 0x00, 0x47, 0x48, 0x17, 0x00, 0x87,
+    0x24, 0x27, 0x01, 0x07, 0x02, 0x47, 0x00, 0x07, 0x00, 0x87, 0x00, 0x07,
+    0x01, 0x07,
+    // 0x3F '?'
+    0x00, 0x04, 0x3B, 0x00, 0x10, 0x43, 0x00, 0x01, 0x43, 0x08, 0x49, 0x43,
+    0x00, 0x80, 0x23, 0x09, 0x22, 0x03, 0x00, 0x40, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x40 '@'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x08, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x01, 0x00, 0x04, 0xBF, 0x02, 0x03, 0x00, 0x3F, 0x24, 0x10, 0x02, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x48, 0x02, 0x00, 0x3F, 0x41, 0x10, 0x20, 0x3F,
+    0x10, 0x40, 0x00, 0x3F, 0x10, 0x00, 0x42, 0x3F, 0x10, 0x04, 0x02, 0x3F,
+    0x00, 0x70, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x3F, 0x10, 0x0C, 0x84, 0x3F,
+    0x10, 0x40, 0x86, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x48, 0x01, 0x00, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x01, 0x30, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x02, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x4F, 0x00, 0x41, 0x0F,
+    0x00, 0x02, 0x0F, 0x02, 0x12, 0x0F, 0x08, 0x02, 0x0F, 0x00, 0x02, 0x0F,
+    0x42, 0x02, 0x1F, 0x84, 0x02, 0x0F, 0x80, 0x32, 0x0F, 0x00, 0x00, 0x0F,
+    0x60, 0x00, 0x0F, 0x01, 0x80, 0x0F, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x50, 0x03, 0x07,
+    0x00, 0x20, 0x07, 0x06, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x02, 0x47,
+    0x00, 0x00, 0x47, 0x0C, 0x00, 0x47, 0x20, 0x00, 0x47, 0x00, 0x10, 0x17,
+    0x80, 0x88, 0x07, 0x8E, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x80, 0x47,
+    0x21, 0x11, 0x07, 0x00, 0x00, 0x07,
+    // 0x43 'C'
+    0x00, 0x00, 0x07, 0x00, 0x41, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x10, 0x00, 0x17, 0x00, 0x7C, 0x07, 0x02, 0x01, 0x07, 0x44, 0x00, 0x07,
+    0x08, 0x00, 0x87, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x07, 0x90, 0x00, 0x27, 0x82, 0x02, 0x47,
+    0x02, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x44 'D'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x50, 0x03, 0x07,
+    0x00, 0x30, 0x07, 0x06, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0x07,
+    0x80, 0x60, 0x47, 0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x97, 0x90, 0x00, 0x07, 0x80, 0x02, 0x27, 0x04, 0x00, 0x07,
+    0x40, 0x80, 0x47, 0x00, 0x00, 0x87, 0x00, 0x01, 0x07, 0x08, 0x04, 0x07,
+    0x03, 0xE0, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x20, 0x20, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x10, 0x4F, 0x84, 0x10, 0x4F, 0x80, 0x10, 0x4F, 0x80, 0x10, 0x4F,
+    0x80, 0x10, 0x0F, 0x80, 0x11, 0x0F, 0x80, 0x20, 0x0F, 0x80, 0x00, 0x4F,
+    0x80, 0x00, 0x0F, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x20, 0x20, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x00, 0x0F, 0x86, 0x40, 0x3F, 0x80, 0x40, 0x0F, 0x80, 0x40, 0x0F,
+    0x80, 0x40, 0x0F, 0x80, 0x40, 0x0F, 0x9C, 0x60, 0x0F, 0x82, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x70, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0x00, 0x07, 0x00, 0xC1, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x10, 0x00, 0x07, 0x00, 0x7C, 0x17, 0x02, 0x01, 0x07, 0x44, 0x00, 0x87,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x90, 0x00, 0x47, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x07, 0x00, 0x00, 0x17, 0x9E, 0x00, 0x07,
+    0x82, 0x00, 0x27, 0x00, 0x06, 0x07, 0x58, 0x08, 0x07, 0x00, 0x00, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x20, 0x20, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x10, 0x0F, 0x86, 0x10, 0x0F, 0x80, 0x10, 0x0F, 0xA0, 0x10, 0x0F,
+    0x40, 0x10, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x10, 0xCF, 0x60, 0x1C, 0x0F,
+    0x81, 0x80, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x0C, 0x0F,
+    0x81, 0x80, 0x3F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    0x20, 0x30, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x01, 0xCF,
+    0x80, 0x30, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0xBF, 0x00, 0x01, 0x80, 0x3F, 0x20, 0x18, 0x00, 0x3F,
+    0x83, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x10, 0x3F, 0x80, 0x00, 0x80, 0x3F,
+    0x80, 0x18, 0x00, 0x3F, 0x83, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x03, 0x07,
+    0x20, 0x20, 0x07, 0x86, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0x47,
+    0x80, 0x00, 0x07, 0x8C, 0x00, 0x07, 0x80, 0x02, 0x07, 0xA0, 0x00, 0x87,
+    0x40, 0x40, 0x47, 0x00, 0x88, 0x07, 0x41, 0x00, 0x17, 0xA2, 0x00, 0x07,
+    0x80, 0x00, 0x87, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x27,
+    0xA0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x20, 0x20, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x30, 0x4F, 0x86, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0xA0, 0x00, 0x4F,
+    0x40, 0x00, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x0C, 0x0F, 0x00, 0x40, 0x0F, 0xA2, 0x01, 0xCF, 0x90, 0x08, 0x0F,
+    0x80, 0xC0, 0x0F, 0x84, 0x00, 0x0F, 0x80, 0xE0, 0x0F, 0x80, 0x03, 0x0F,
+    0x80, 0x00, 0x4F, 0x07, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x42, 0x0F,
+    0x01, 0x08, 0x0F, 0x04, 0x20, 0x2F, 0x00, 0x80, 0x0F, 0x20, 0x00, 0x4F,
+    0x07, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x8F,
+    0x80, 0x00, 0x4F, 0xA0, 0x00, 0x2F, 0x40, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x03, 0x07,
+    0x20, 0x30, 0x07, 0x86, 0x00, 0x07, 0x80, 0x01, 0xC7, 0x80, 0x30, 0x07,
+    0x81, 0x00, 0x07, 0x80, 0x00, 0x07, 0x40, 0x10, 0x07, 0x10, 0x04, 0x07,
+    0x02, 0x01, 0x07, 0x00, 0x80, 0x47, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x30, 0x07, 0x82, 0x00, 0x07, 0x80, 0x01, 0x87, 0x80, 0x10, 0x07,
+    0x83, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0x00, 0x07, 0x00, 0x81, 0x07, 0x00, 0x00, 0x47, 0x08, 0x00, 0x27,
+    0x10, 0x00, 0x07, 0x20, 0x3C, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x17, 0x00, 0x02, 0x07, 0x88, 0x08, 0x27, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x10, 0x04, 0x07, 0x06, 0x60, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x50, 0x03, 0x0F,
+    0x00, 0x20, 0x0F, 0x06, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x40, 0x0F, 0x0C, 0x20, 0x1F, 0x00, 0x08, 0x0F, 0x00, 0x08, 0x0F,
+    0x10, 0x00, 0x0F, 0x8B, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x40, 0x0F, 0x11, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x81, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F,
+    0x08, 0x00, 0x20, 0x1F, 0x10, 0x00, 0x10, 0x1F, 0x20, 0x3C, 0x08, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x02, 0x1F,
+    0x90, 0x00, 0x40, 0x1F, 0x80, 0x00, 0x19, 0x1F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x04, 0x9F, 0x00, 0x02, 0x04, 0x1F, 0x80, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x82, 0x5F, 0x00, 0x01, 0x02, 0x1F,
+    0x10, 0x04, 0x00, 0x1F, 0x06, 0x70, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x52 'R'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x10, 0x03, 0x07,
+    0x00, 0x20, 0x07, 0x06, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0x47,
+    0x80, 0x40, 0x07, 0x0C, 0x08, 0x07, 0x20, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x80, 0x80, 0x07, 0x89, 0x04, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x13, 0x00, 0x07, 0x00, 0x00, 0x37, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x27, 0x00, 0x04, 0x07, 0x06, 0x00, 0x17,
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x0C, 0x10, 0x47,
+    0x90, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x83, 0x17, 0x00, 0x00, 0x07,
+    0x90, 0x00, 0x27, 0x82, 0x00, 0x47, 0x00, 0x0F, 0x07, 0x58, 0x00, 0x07,
+    // 0x54 'T'
+    0x00, 0x00, 0x0F, 0x62, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x84, 0x00, 0x0F,
+    0x90, 0x00, 0x4F, 0x80, 0x0C, 0x0F, 0x80, 0xC0, 0x0F, 0x98, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x04, 0x0F, 0x80, 0xC0, 0x1F, 0x98, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x84, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x55 'U'
+    0x00, 0x07, 0x87, 0x00, 0xC0, 0x07, 0x8C, 0x00, 0x07, 0x80, 0x00, 0x17,
+    0x80, 0x00, 0x07, 0x80, 0x40, 0x87, 0x8C, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xA0, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x97, 0x00, 0x01, 0x17,
+    0x40, 0x0C, 0x07, 0x81, 0x80, 0x07, 0x90, 0x00, 0x87, 0x80, 0x02, 0x07,
+    0x80, 0x30, 0x07, 0x86, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07, 0x83, 0x00, 0x07,
+    0x80, 0x18, 0x07, 0x80, 0x00, 0x67, 0x80, 0x00, 0x07, 0x83, 0x80, 0x07,
+    0xA0, 0x02, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x21, 0x07,
+    0x00, 0x80, 0x07, 0x42, 0x08, 0x07, 0x88, 0x20, 0x07, 0x80, 0x80, 0x07,
+    0x80, 0x00, 0x07, 0x84, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x20, 0x00, 0x07, 0x80, 0x00, 0x07, 0x81, 0xE0, 0x07, 0x80, 0x00, 0xF7,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x3C, 0x07, 0xA0, 0x08, 0x27,
+    0x80, 0x20, 0x87, 0x00, 0x82, 0x07, 0x02, 0x08, 0x07, 0x08, 0x20, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x77, 0x00, 0x00, 0x07, 0x7C, 0x00, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x01, 0x02, 0x07,
+    0x24, 0x08, 0x07, 0x90, 0x20, 0x07, 0x80, 0x80, 0x07, 0x82, 0x00, 0x07,
+    0x88, 0x00, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x8F, 0x80, 0x01, 0x0F, 0x80, 0x02, 0x0F, 0x88, 0x00, 0x4F,
+    0x82, 0x00, 0x0F, 0x80, 0x82, 0x0F, 0x80, 0x04, 0x0F, 0xA8, 0x00, 0x1F,
+    0x82, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x60, 0x0F, 0x40, 0x88, 0x0F,
+    0xB1, 0x02, 0x0F, 0x82, 0x00, 0x8F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x82, 0x00, 0x0F,
+    0x80, 0x40, 0x4F, 0x80, 0x1C, 0x0F, 0x90, 0x00, 0x0F, 0xA2, 0x00, 0x0F,
+    0x80, 0x40, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x10, 0x1F, 0x44, 0x00, 0x0F,
+    0xA0, 0x80, 0x0F, 0x81, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x88, 0x00, 0x0F,
+    0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x01, 0x07, 0x1C, 0x02, 0x07,
+    0x02, 0x00, 0x07, 0x80, 0x00, 0x07, 0x90, 0x00, 0xC7, 0x80, 0x41, 0x47,
+    0x80, 0x80, 0x47, 0x80, 0x00, 0x47, 0x80, 0x10, 0x47, 0x88, 0x20, 0x47,
+    0x90, 0x40, 0x07, 0x80, 0x01, 0x07, 0x80, 0x04, 0x07, 0x84, 0x04, 0x27,
+    0x08, 0x03, 0x07, 0x50, 0x00, 0x07,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x30, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x60, 0x01, 0x1F, 0x06, 0x00, 0x18, 0x1F,
+    0x40, 0x01, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x1F, 0x03, 0x00, 0x00, 0x1F,
+    0x20, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x30, 0x00, 0x01, 0x04, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0x20, 0x10, 0x01, 0x04, 0x04, 0x01, 0x00, 0x80, 0x81, 0x00, 0x20, 0x11,
+    0x00, 0x04, 0x05, 0x00, 0x00, 0x81, 0x00, 0x00, 0x21, 0x00, 0x00, 0x05,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0xC0, 0x1F,
+    0xE0, 0x0C, 0x00, 0x1F, 0x20, 0x80, 0x02, 0x1F, 0x38, 0x00, 0x60, 0x1F,
+    0x00, 0x06, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x0C, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x1F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x17, 0x00, 0x47, 0x02, 0x07, 0x08, 0x0F, 0x00, 0x47,
+    0x02, 0x07, 0x00, 0x07, 0x04, 0x07, 0x40, 0x87, 0x10, 0x17, 0x04, 0x07,
+    0x00, 0x87, 0x00, 0x27, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x00, 0x00, 0x00, 0x40, 0x02, 0x08, 0x00,
+    // 0x61 'a'
+    0x00, 0x00, 0x03, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00,
+    0x88, 0x02, 0x80, 0x04, 0x00, 0x48, 0x01, 0x10, 0x1C, 0x02, 0x40, 0x00,
+    0x80, 0x00, 0x83, 0x02, 0x90, 0x10, 0x80, 0x00, 0x00, 0x00,
+    // 0x62 'b'
+    0x00, 0x00, 0x0D, 0x00, 0x00, 0x41, 0x40, 0x06, 0x01, 0x00, 0xC0, 0x05,
+    0x18, 0x00, 0x05, 0x80, 0x01, 0x81, 0x80, 0x64, 0x11, 0x86, 0x40, 0x11,
+    0x60, 0x80, 0x01, 0x00, 0x00, 0x45, 0x01, 0x23, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x81, 0x00, 0x7E, 0x01,
+    // 0x63 'c'
+    0x00, 0x00, 0x02, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x12, 0x10, 0x00, 0x80, 0x20, 0x00, 0x10,
+    0x00, 0x00,
+    // 0x64 'd'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xC1, 0x00, 0x04, 0x01, 0x01, 0x10, 0x05, 0x01, 0x00, 0x09,
+    0x00, 0x00, 0x91, 0x20, 0x02, 0x21, 0x00, 0x38, 0x05, 0x01, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x80, 0x04, 0x05, 0x80, 0xC0, 0x21, 0x8C, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x65 'e'
+    0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x30, 0x49, 0x40,
+    0x00, 0x00, 0xA2, 0x00, 0x24, 0x82, 0x01, 0x00, 0x80, 0x20, 0x00, 0x30,
+    0x30, 0x00,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x02, 0x07, 0x00, 0x00, 0x60, 0x07,
+    0x00, 0x0C, 0x00, 0x07, 0x01, 0x00, 0x00, 0x87, 0x08, 0x00, 0x0C, 0x07,
+    0x20, 0x01, 0x80, 0x07, 0x40, 0x30, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07,
+    0x91, 0x00, 0x00, 0x07, 0x21, 0x00, 0x00, 0x07, 0x01, 0x40, 0x00, 0x07,
+    0x90, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0xA3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC3,
+    0x0B, 0x05, 0x27, 0x20, 0xA0, 0x07, 0x40, 0x42, 0x07, 0x06, 0x02, 0x07,
+    0x90, 0x30, 0x07, 0x20, 0x09, 0x03, 0x01, 0x00, 0x23, 0x22, 0x40, 0x0B,
+    0x00, 0x04, 0x03, 0x80, 0x00, 0x13, 0x80, 0x01, 0x03, 0xAC, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x68 'h'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x61, 0x40, 0x0C, 0x01, 0x00, 0xC0, 0x01,
+    0x18, 0x00, 0x09, 0x80, 0x00, 0x81, 0x80, 0x60, 0x01, 0x82, 0x48, 0x01,
+    0x70, 0x00, 0x01, 0x00, 0x20, 0xC5, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x00, 0xF0, 0x21, 0x00, 0x00, 0x21,
+    // 0x69 'i'
+    0x00, 0x80, 0x3D, 0x00, 0x02, 0x01, 0x01, 0x10, 0x01, 0x11, 0x00, 0x01,
+    0x40, 0x00, 0x85, 0x00, 0x0C, 0x21, 0x00, 0xC0, 0x09, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x40, 0x06, 0x17, 0x00, 0x00, 0x60, 0x27,
+    0x01, 0x04, 0x00, 0x47, 0x01, 0x00, 0x01, 0x07, 0x08, 0x00, 0x08, 0x07,
+    0x00, 0x01, 0x80, 0x07, 0x01, 0x30, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x61, 0x40, 0x0C, 0x01, 0x00, 0xC0, 0x01,
+    0x18, 0x00, 0x19, 0x80, 0x02, 0x81, 0x80, 0xEA, 0x01, 0x82, 0x42, 0x11,
+    0x60, 0xA0, 0x01, 0x00, 0x05, 0x45, 0x01, 0x08, 0x21, 0x00, 0x02, 0x01,
+    0x01, 0x04, 0x11, 0x00, 0x08, 0x15, 0x00, 0x00, 0x01,
+    // 0x6C 'l'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x45, 0x40, 0x0C, 0x01, 0x00, 0x80, 0x01,
+    0x18, 0x00, 0x01, 0x80, 0x01, 0x05, 0x80, 0x30, 0x21, 0x83, 0x00, 0x01,
+    0x60, 0x00, 0x01,
+    // 0x6D 'm'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x8C, 0x00, 0x80, 0x02, 0x00, 0x10,
+    0x80, 0x80, 0x10, 0x00, 0x08, 0x00, 0x50, 0x10, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x04, 0x80, 0x40, 0x71, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0xC0,
+    0x94, 0x00, 0x00, 0x00, 0x00, 0x30, 0x81, 0x02, 0x30, 0x00, 0x00, 0x18,
+    // 0x6E 'n'
+    0x00, 0x00, 0x40, 0x04, 0x00, 0xC0, 0x8C, 0x00, 0x80, 0x02, 0x00, 0x18,
+    0x80, 0x80, 0x12, 0x00, 0x20, 0x00, 0x40, 0x0C, 0x00, 0x80, 0x9C, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x02, 0x02, 0x00, 0x00, 0x00, 0x08,
+    // 0x6F 'o'
+    0x00, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x02, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x08, 0x80, 0x08, 0x00, 0x12, 0x00, 0x20, 0x0F, 0x04, 0x80, 0x08,
+    0x00, 0x10, 0x20, 0x40, 0x04, 0x00,
+    // 0x70 'p'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43,
+    0x00, 0x0C, 0x03, 0x00, 0xC0, 0x03, 0x98, 0x00, 0x03, 0x80, 0x01, 0x03,
+    0x00, 0x32, 0x03, 0x81, 0x08, 0x1B, 0x04, 0x08, 0x03, 0x08, 0x00, 0x03,
+    0x10, 0x02, 0x03, 0x80, 0x40, 0x03, 0x0C, 0x04, 0x03, 0x00, 0x00, 0x03,
+    0x80, 0x20, 0x03, 0x40, 0x80, 0x03, 0x00, 0x00, 0x03,
+    // 0x71 'q'
+    0x00, 0x00, 0x03, 0x03, 0x04, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x60, 0x03, 0x00, 0x00, 0x13, 0x80, 0x02, 0x13, 0x80, 0x04, 0x03,
+    0x00, 0x49, 0x83, 0x01, 0x18, 0x03, 0x1C, 0x00, 0x03, 0x40, 0x00, 0x63,
+    0x80, 0x38, 0x03, 0x83, 0x00, 0x03, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x72 'r'
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x61, 0x86, 0x01, 0x80, 0x01, 0x00, 0x0D,
+    0x80, 0x41, 0x01, 0x01, 0x24, 0x01, 0x48, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x60, 0x01,
+    // 0x73 's'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x14, 0x20, 0x00, 0x10, 0x00, 0x08,
+    0x00, 0x08, 0x80, 0x08, 0x20, 0x02, 0x00, 0x00, 0x11, 0x00, 0x80, 0x70,
+    0x60, 0x00,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x18, 0x2F, 0x01, 0x80, 0x0F,
+    0x10, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x2F,
+    0x48, 0x01, 0x0F, 0x08, 0x00, 0x4F, 0x08, 0x02, 0x8F, 0x04, 0x00, 0x0F,
+    // 0x75 'u'
+    0x00, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x84, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x90, 0x02, 0x04, 0x60, 0x00,
+    0x80, 0x00, 0x80, 0xF0, 0x88, 0x10, 0xC0, 0x04, 0x00, 0x18,
+    // 0x76 'v'
+    0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x8C, 0x00, 0x00, 0x3E, 0x80, 0x00,
+    0x20, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x9C, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x77 'w'
+    0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x88, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0xE0, 0x00, 0x40, 0x41, 0x10, 0x98, 0x20, 0x00, 0x60,
+    0x80, 0x00, 0x20, 0x00, 0x01, 0xE2, 0x00, 0x44, 0x41, 0x08, 0x88, 0x00,
+    0x00, 0x40, 0x81, 0x00, 0x78, 0x00,
+    // 0x78 'x'
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x80, 0x10, 0x90, 0x20,
+    0x04, 0x08, 0x80, 0x10, 0x40, 0x20, 0x08, 0x04, 0x10, 0x00, 0x20, 0x40,
+    0x08, 0x10, 0x90, 0x08, 0x00, 0x02, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00,
+    // 0x79 'y'
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x43, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x20, 0x00, 0x23, 0x00, 0x00, 0x03, 0x80, 0x00, 0x4B, 0x8C, 0x00, 0x93,
+    0x00, 0x7E, 0x03, 0x80, 0x00, 0x03, 0x20, 0x00, 0x03, 0x01, 0xF1, 0x03,
+    0x00, 0x22, 0x03, 0x40, 0x80, 0x03, 0x9C, 0x10, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x04, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x00, 0x00, 0x0A, 0x18, 0x10, 0x00, 0x20, 0x84, 0x04, 0x10, 0x00,
+    0x90, 0x32, 0x90, 0x40, 0x00, 0x80, 0x41, 0x00, 0x02, 0x10, 0x80, 0x00,
+    0x00, 0x20, 0x80, 0x08, 0x40, 0x00,
+    // 0x7B '{'
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x18, 0x0F, 0x00, 0x01, 0xC0, 0x0F,
+    0x00, 0x10, 0x03, 0x9F, 0x0C, 0x00, 0x10, 0x1F, 0x00, 0x01, 0x80, 0x1F,
+    0x00, 0x10, 0x00, 0x2F, 0x0C, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0x0C, 0x00, 0x3F, 0x00, 0xC0, 0x03, 0x3F, 0x18, 0x00, 0x60, 0x3F,
+    0x00, 0x0C, 0x00, 0x3F, 0x01, 0x80, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x1E, 0x0F,
+    0x50, 0x00, 0x80, 0x0F, 0x10, 0x24, 0x00, 0x0F, 0x11, 0x00, 0x1E, 0x0F,
+    0x00, 0x00, 0x80, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x7E '~'
+    0x2B, 0x03, 0x8B, 0x03, 0x03, 0x93, 0x03, 0x4B, 0x03, 0x23, 0x43, 0x8B,
+    0x93, 0x03,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC7, 0x00, 0x06, 0x07,
+    0x00, 0x60, 0x03, 0x02, 0x00, 0x13, 0x80, 0x01, 0x83, 0x03, 0xC0, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x40, 0x10, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0xCF, 0x00, 0x20, 0x44, 0x0F,
+    0x02, 0x40, 0xC0, 0x2F, 0x02, 0x0C, 0x06, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+    0x30, 0x18, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x10, 0x0F,
+    0x00, 0x40, 0x80, 0x0F, 0x02, 0x00, 0x40, 0x0F, 0x01, 0x80, 0x00, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0x00, 0x43, 0x07, 0x00, 0x40, 0x07, 0x01, 0x00, 0x07, 0x04, 0x01, 0x07,
+    0x10, 0x04, 0x17, 0x20, 0x40, 0x07, 0x06, 0x40, 0x07, 0x00, 0x40, 0x07,
+    0x10, 0x40, 0x07, 0x00, 0x40, 0x07, 0x10, 0x60, 0x07, 0x00, 0x00, 0x97,
+    0x00, 0x00, 0x47, 0x04, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x00, 0x09, 0x00, 0x11, 0x00, 0x21, 0x02, 0x09, 0x00, 0x01, 0x00, 0x09,
+    0x00, 0x01, 0x20, 0x21, 0x08, 0x21, 0x08, 0x09, 0x00, 0x41, 0x23, 0x01,
+    0x00, 0x01, 0x00, 0x41, 0x08, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x60, 0x00, 0x0F, 0x00, 0x6C, 0x1F, 0x08, 0x20, 0x0F, 0x01, 0x20, 0x0F,
+    0x00, 0x28, 0x8F, 0x00, 0x00, 0x0F, 0x14, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x00, 0x43, 0x4F, 0x00, 0x10, 0x0F, 0x02, 0x00, 0x2F, 0x00, 0x20, 0x0F,
+    0x10, 0x20, 0x0F, 0x02, 0x28, 0x0F, 0x04, 0x40, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x41, 0x08, 0x08, 0x41,
+    0x12, 0x04, 0x11, 0x21, 0x02, 0x03, 0x00, 0x00, 0x01, 0x52, 0x40, 0x01,
+    0x01, 0x20, 0x61, 0x00, 0x90, 0x01, 0x00, 0x08, 0x89, 0x04, 0x03, 0x11,
+    0x44, 0x00, 0x41, 0x38, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x08, 0xF0, 0x07, 0x10, 0x02, 0x07,
+    0x28, 0x00, 0x07, 0x10, 0x00, 0x07, 0x41, 0x00, 0x17, 0x20, 0x00, 0x27,
+    0x84, 0xF1, 0x27, 0x80, 0x00, 0x07, 0x82, 0x04, 0x0F, 0x82, 0x00, 0x0F,
+    0x81, 0x00, 0x07, 0x80, 0x85, 0x27, 0x22, 0x06, 0x27, 0x40, 0x00, 0x17,
+    0x10, 0x00, 0x07, 0x28, 0x00, 0x07, 0x12, 0x02, 0x07, 0x00, 0x71, 0x07,
+    0x01, 0x04, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x03, 0x08, 0x87, 0x20, 0x57, 0x06, 0x17, 0x91, 0x57, 0x20, 0x17,
+    0x04, 0x97, 0xB0, 0x57, 0x00, 0x03, 0x91, 0x4B, 0xC0, 0x83, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x0F, 0x04, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x20, 0x0F, 0x41, 0x0F,
+    0x00, 0x0F, 0x80, 0x0F, 0x44, 0x0F, 0x00, 0x0F, 0x10, 0x4F, 0x20, 0x0F,
+    0x00, 0x0F, 0x00, 0x8F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x06, 0x49, 0x10, 0x11, 0x40, 0x09, 0x07, 0xC3,
+    0x80, 0x07, 0xD6, 0xC1, 0xD0, 0x41, 0xC0, 0x25, 0x08, 0x47, 0x20, 0x01,
+    0x10, 0x05, 0x20, 0x29, 0x08, 0x11, 0x01, 0x01,
+    // 0xB0 '°'
+    0x0E, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x0A, 0x1F, 0x11, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x0E, 0x1F, 0x40, 0x1F, 0x20, 0x1F, 0x04, 0x1F,
+    // 0xB1 '±'
+    0x03, 0x01, 0xBF, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F,
+    0x04, 0x02, 0x3F, 0x00, 0x0A, 0x3F, 0x80, 0x02, 0x3F, 0x80, 0x02, 0x3F,
+    0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F, 0x04, 0x02, 0x3F,
+    0x04, 0x02, 0x3F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x13, 0x08, 0x27, 0x24, 0x07, 0x08, 0x07, 0x50, 0x37,
+    0x00, 0x17, 0x00, 0x17, 0x08, 0x17, 0x41, 0x13, 0x00, 0x13, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x07, 0x00, 0x03, 0x08, 0x03, 0x08, 0x83, 0x52, 0x17, 0x00, 0x07,
+    0x04, 0x43, 0x00, 0x03, 0x41, 0x13, 0x20, 0x03,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x87, 0x00, 0x30, 0x03,
+    0x0C, 0x00, 0x0B, 0x00, 0x03, 0x83, 0x80, 0x00, 0x03, 0x83, 0x90, 0x03,
+    0x30, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03,
+    0x0C, 0x00, 0x03, 0x00, 0x02, 0x03, 0x80, 0x00, 0x03, 0x83, 0x90, 0x03,
+    0x30, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x18, 0x03,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x12, 0x00, 0x0B, 0x02,
+    0x40, 0x00, 0x1A, 0x00, 0x01, 0x80, 0x00, 0x30, 0x24, 0x06, 0x06, 0x08,
+    0x00, 0xC0, 0x20, 0x98, 0x06, 0x00, 0x80, 0xC0, 0x00, 0x98, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xB7 '·'
+    0x2B, 0x03, 0x03, 0x0B, 0x23,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x07, 0x30, 0x17, 0x00, 0x27, 0x06, 0x07, 0x40, 0x07,
+    0x00, 0x77, 0x0C, 0x07, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x03, 0x06, 0x07, 0x00, 0x17, 0x00, 0x57, 0x09, 0x17, 0x80, 0x17,
+    0x81, 0x57, 0x00, 0x13, 0x80, 0x83, 0x01, 0x13, 0x3C, 0x03,
+    // 0xBB '»'
+    0x00, 0x0F, 0x00, 0x6F, 0x00, 0x8F, 0x01, 0x2F, 0x0A, 0x0F, 0x40, 0x0F,
+    0x20, 0x8F, 0x11, 0x0F, 0x0A, 0x6F, 0x00, 0x8F, 0x21, 0x2F, 0x0A, 0x0F,
+    0x40, 0x0F, 0x20, 0x8F, 0x11, 0x0F, 0x0A, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x08, 0x30, 0x01,
+    0x2B, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x60, 0x01, 0x06, 0x08, 0x05,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x45, 0x00, 0x00, 0x09, 0x00, 0x02, 0x01,
+    0x00, 0x04, 0x41, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x10, 0x01, 0x02, 0x20, 0x41, 0x00, 0x01, 0x21, 0x11, 0x02, 0x21,
+    0x02, 0x04, 0x21, 0x00, 0x08, 0xA1, 0x10, 0x10, 0xA1, 0x20, 0x20, 0x81,
+    0x00, 0x4C, 0x01, 0x00, 0x00, 0x11, 0x00, 0x83, 0xA1, 0x00, 0x60, 0xA1,
+    0x00, 0x00, 0x01,
+    // 0xBD '½'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x08, 0x30, 0x01,
+    0x2B, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x60, 0x11, 0x06, 0x08, 0x23,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x21, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x20, 0x01, 0x00, 0x08, 0x01, 0x01, 0x10, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x80, 0x11, 0x01, 0x00, 0x21, 0x40, 0x28, 0x41,
+    0x08, 0x40, 0x01, 0x50, 0x10, 0x21, 0x00, 0x00, 0x41, 0x00, 0xA2, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0x09, 0x00, 0x28, 0x01,
+    // 0xBE '¾'
+    0x00, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x10, 0x0A, 0x01, 0x21, 0x0A, 0x01,
+    0x08, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x64, 0x01, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x23, 0x14, 0x00, 0x05, 0x00, 0x01, 0x01, 0x00, 0x02, 0x21,
+    0x00, 0x00, 0x01, 0x00, 0x11, 0x01, 0x00, 0x20, 0x01, 0x00, 0x08, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x41, 0x08, 0x81, 0x21, 0x01, 0x02, 0x21,
+    0x40, 0x04, 0x21, 0x08, 0x08, 0xA1, 0x50, 0x10, 0xA1, 0x00, 0x20, 0x81,
+    0x00, 0x4C, 0x01, 0x00, 0x00, 0x11, 0x00, 0x83, 0xA1, 0x00, 0x60, 0xA1,
+    0x00, 0x00, 0x01,
+    // 0xBF '¿'
+    0x00, 0x01, 0xC7, 0x00, 0x04, 0x17, 0x00, 0x08, 0x07, 0x01, 0x91, 0x8F,
+    0x02, 0xA4, 0x47, 0x40, 0x88, 0x47, 0x80, 0x10, 0x0F, 0x00, 0x20, 0x87,
+    0x90, 0x40, 0x67, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x41, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x02, 0x12, 0x0F, 0x20, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x42, 0x02, 0x1F, 0x24, 0x84, 0x02, 0x0F, 0x10, 0x80, 0x32, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x60, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x0F,
+    0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x41, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x02, 0x12, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x0A, 0x42, 0x02, 0x1F, 0x00, 0x84, 0x02, 0x0F, 0x00, 0x80, 0x32, 0x0F,
+    0x24, 0x00, 0x00, 0x0F, 0x00, 0x60, 0x00, 0x0F, 0x08, 0x01, 0x80, 0x0F,
+    0x30, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x41, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x04, 0x02, 0x12, 0x0F, 0x0A, 0x08, 0x02, 0x0F, 0x02, 0x00, 0x02, 0x0F,
+    0x00, 0x42, 0x02, 0x1F, 0x00, 0x84, 0x02, 0x0F, 0x00, 0x80, 0x32, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x40, 0x60, 0x00, 0x0F, 0x20, 0x01, 0x80, 0x0F,
+    0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x20, 0x9F, 0x00, 0x00, 0x82, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x04, 0x24, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x08, 0x00, 0x04, 0x1F,
+    0x00, 0x84, 0x04, 0x3F, 0x11, 0x08, 0x04, 0x1F, 0x49, 0x00, 0x64, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x1F, 0x08, 0x03, 0x00, 0x1F,
+    0x10, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x41, 0x3F, 0x00, 0x01, 0x04, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x00, 0x08, 0x48, 0x3F, 0x00, 0x20, 0x08, 0x3F, 0x80, 0x00, 0x08, 0x3F,
+    0x91, 0x08, 0x08, 0x7F, 0x62, 0x10, 0x08, 0x3F, 0x02, 0x00, 0xC8, 0x3F,
+    0x70, 0x00, 0x00, 0x3F, 0x81, 0x80, 0x00, 0x3F, 0x80, 0x06, 0x00, 0x3F,
+    0x90, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0xFF,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x41, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x02, 0x12, 0x0F, 0x00, 0x08, 0x02, 0x0F, 0x24, 0x00, 0x02, 0x0F,
+    0x40, 0x42, 0x02, 0x1F, 0x20, 0x84, 0x02, 0x0F, 0xA4, 0x80, 0x32, 0x0F,
+    0xA0, 0x00, 0x00, 0x0F, 0x02, 0x60, 0x00, 0x0F, 0x04, 0x01, 0x80, 0x0F,
+    0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x8F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x11, 0x3F, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x1F,
+    0x02, 0x20, 0x0F, 0x04, 0x00, 0x0F, 0xA1, 0x02, 0x8F, 0x82, 0x10, 0x0F,
+    0x80, 0x80, 0x0F, 0x8C, 0x00, 0x0F, 0x80, 0x03, 0x4F, 0x80, 0x10, 0x4F,
+    0x84, 0x10, 0x4F, 0x80, 0x10, 0x4F, 0x80, 0x10, 0x4F, 0x80, 0x10, 0x0F,
+    0x80, 0x11, 0x0F, 0x80, 0x20, 0x1F, 0x80, 0x00, 0xCF, 0x80, 0x00, 0x0F,
+    0x88, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x41, 0x00, 0x0F, 0x02, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x10, 0x00, 0x10, 0x0F, 0x00, 0x7C, 0x00, 0x2F,
+    0x02, 0x01, 0x02, 0x0F, 0x44, 0x00, 0x04, 0x0F, 0x08, 0x00, 0x84, 0x2F,
+    0x80, 0x00, 0x04, 0x0F, 0x90, 0x00, 0x02, 0x8F, 0x80, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x90, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x20, 0x0F,
+    0x82, 0x02, 0x40, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x20, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x4F, 0x30, 0x80, 0x10, 0x4F,
+    0x08, 0x84, 0x10, 0x4F, 0x40, 0x80, 0x10, 0x4F, 0x24, 0x80, 0x10, 0x4F,
+    0x00, 0x80, 0x10, 0x0F, 0x00, 0x80, 0x11, 0x0F, 0x08, 0x80, 0x20, 0x0F,
+    0x00, 0x80, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x84, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x20, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x4F, 0x00, 0x80, 0x10, 0x4F,
+    0x00, 0x84, 0x10, 0x4F, 0x0A, 0x80, 0x10, 0x4F, 0x00, 0x80, 0x10, 0x4F,
+    0x10, 0x80, 0x10, 0x0F, 0x24, 0x80, 0x11, 0x0F, 0x00, 0x80, 0x20, 0x0F,
+    0x40, 0x80, 0x00, 0x4F, 0x40, 0x80, 0x00, 0x0F, 0x00, 0x84, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x20, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x4F, 0x02, 0x80, 0x10, 0x4F,
+    0x02, 0x84, 0x10, 0x4F, 0x00, 0x80, 0x10, 0x4F, 0x00, 0x80, 0x10, 0x4F,
+    0x48, 0x80, 0x10, 0x0F, 0x00, 0x80, 0x11, 0x0F, 0x40, 0x80, 0x20, 0x0F,
+    0x20, 0x80, 0x00, 0x4F, 0x10, 0x80, 0x00, 0x0F, 0x04, 0x84, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x80, 0x80, 0x3F, 0x02, 0x18, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x0D, 0x3F, 0x52, 0x00, 0x41, 0x3F,
+    0x82, 0x10, 0x41, 0x3F, 0x82, 0x00, 0x41, 0x3F, 0x82, 0x00, 0x41, 0x3F,
+    0x02, 0x00, 0x40, 0x3F, 0x22, 0x00, 0x44, 0x3F, 0x02, 0x00, 0x80, 0x3F,
+    0x82, 0x00, 0x01, 0x3F, 0x92, 0x00, 0x00, 0x3F, 0x42, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x20, 0x30, 0x0F, 0x48, 0x86, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x04, 0x80, 0x01, 0xCF, 0x00, 0x80, 0x30, 0x0F,
+    0x10, 0x86, 0x00, 0x0F, 0x0A, 0x80, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x20, 0x30, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x01, 0xCF, 0x10, 0x80, 0x30, 0x0F,
+    0x00, 0x86, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F, 0x40, 0xA0, 0x00, 0x0F,
+    0x08, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x20, 0x30, 0x0F, 0x0A, 0x86, 0x00, 0x0F,
+    0x10, 0x80, 0x00, 0x0F, 0x24, 0x80, 0x01, 0xCF, 0x48, 0x80, 0x30, 0x0F,
+    0x00, 0x86, 0x00, 0x0F, 0x08, 0x80, 0x00, 0x0F, 0x04, 0xA0, 0x00, 0x0F,
+    0x02, 0x80, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x06, 0x3F, 0x30, 0x80, 0xC0, 0x3F, 0x02, 0x18, 0x00, 0x3F,
+    0x82, 0x00, 0x00, 0x3F, 0x92, 0x00, 0x07, 0x3F, 0x42, 0x00, 0xC0, 0x3F,
+    0x02, 0x18, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x82, 0x80, 0x00, 0x3F,
+    0x82, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x17, 0x00, 0x20, 0x07, 0x00, 0x40, 0x47, 0x50, 0x43, 0x07,
+    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0x07,
+    0x80, 0x10, 0x47, 0x04, 0x40, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x17,
+    0x00, 0x60, 0x97, 0x90, 0x00, 0x07, 0x80, 0x02, 0x27, 0x04, 0x00, 0x07,
+    0x40, 0x80, 0x47, 0x00, 0x00, 0x87, 0x00, 0x01, 0x07, 0x08, 0x04, 0x07,
+    0x03, 0xE0, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x06, 0x0F, 0x00, 0x40, 0x60, 0x0F, 0x01, 0x0C, 0x00, 0x0F,
+    0x01, 0x00, 0x03, 0x8F, 0x01, 0x00, 0x60, 0x0F, 0x01, 0x02, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x08, 0x80, 0x20, 0x0F, 0x00, 0x20, 0x08, 0x0F,
+    0x80, 0x04, 0x02, 0x0F, 0x10, 0x01, 0x00, 0x8F, 0x48, 0x00, 0x40, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x60, 0x0F, 0x01, 0x04, 0x00, 0x0F,
+    0x01, 0x00, 0x03, 0x0F, 0x01, 0x00, 0x20, 0x0F, 0x01, 0x06, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x07, 0x00, 0x20, 0x3C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x07, 0x30, 0x08, 0x00, 0x07,
+    0x08, 0x90, 0x00, 0x07, 0x40, 0x80, 0x00, 0x07, 0x24, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x02, 0x07, 0x04, 0x88, 0x08, 0x27,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x04, 0x07, 0x00, 0x06, 0x60, 0x07,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x07, 0x00, 0x20, 0x3C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x90, 0x00, 0x07, 0x0A, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x17, 0x24, 0x00, 0x02, 0x07, 0x00, 0x88, 0x08, 0x27,
+    0x00, 0x00, 0x00, 0x47, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x04, 0x07, 0x00, 0x06, 0x60, 0x07,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x81, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x08, 0x00, 0x27, 0x00, 0x10, 0x00, 0x07, 0x00, 0x20, 0x3C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x00, 0x07, 0x02, 0x08, 0x00, 0x07,
+    0x02, 0x90, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x02, 0x07, 0x40, 0x88, 0x08, 0x27,
+    0x20, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x04, 0x07, 0x00, 0x06, 0x60, 0x07,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x10, 0x00, 0x4F, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x40, 0x78, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x28, 0x10, 0x00, 0x0F,
+    0x09, 0x20, 0x00, 0x0F, 0x11, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x04, 0x0F, 0x01, 0x10, 0x10, 0x4F,
+    0x48, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x20, 0x08, 0x0F, 0x00, 0x0C, 0xC0, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x04, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x80, 0xF0, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x82, 0x40, 0x00, 0x1F, 0x82, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x08, 0x1F, 0x02, 0x20, 0x20, 0x9F,
+    0x80, 0x00, 0x01, 0x1F, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x04, 0x1F,
+    0x00, 0x40, 0x10, 0x1F, 0x00, 0x19, 0x80, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x07, 0x20, 0x27, 0x40, 0x17, 0x00, 0x07, 0x02, 0x07, 0x10, 0x47,
+    0x00, 0x07, 0x10, 0x47, 0x20, 0x27, 0x45, 0x17, 0x08, 0x87, 0x10, 0x47,
+    0x00, 0x07,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x17, 0x00, 0x40, 0xA3, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x13, 0x08, 0x00, 0x03, 0x10, 0x30, 0x03, 0x01, 0x04, 0x03,
+    0x00, 0x08, 0x03, 0x00, 0x00, 0x03, 0x48, 0x00, 0x03, 0x40, 0x08, 0x03,
+    0x00, 0x10, 0x43, 0x00, 0x20, 0x0B, 0x08, 0x40, 0x03, 0x44, 0x82, 0x13,
+    0x00, 0xE0, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x02, 0x03,
+    0x43, 0x30, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x40, 0x87,
+    0x00, 0x8C, 0x00, 0x07, 0x30, 0x80, 0x00, 0x07, 0x08, 0xA0, 0x00, 0x07,
+    0x40, 0x40, 0x00, 0x07, 0x04, 0x00, 0x00, 0x97, 0x00, 0x00, 0x01, 0x17,
+    0x00, 0x40, 0x0C, 0x07, 0x08, 0x81, 0x80, 0x07, 0x00, 0x90, 0x00, 0x87,
+    0x00, 0x80, 0x02, 0x07, 0x00, 0x80, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x40, 0x87,
+    0x00, 0x8C, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x08, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0x10, 0x00, 0x01, 0x17,
+    0x24, 0x40, 0x0C, 0x07, 0x00, 0x81, 0x80, 0x07, 0x40, 0x90, 0x00, 0x87,
+    0x40, 0x80, 0x02, 0x07, 0x00, 0x80, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x40, 0x87,
+    0x00, 0x8C, 0x00, 0x07, 0x02, 0x80, 0x00, 0x07, 0x02, 0xA0, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0x48, 0x00, 0x01, 0x17,
+    0x00, 0x40, 0x0C, 0x07, 0x40, 0x81, 0x80, 0x07, 0x20, 0x90, 0x00, 0x87,
+    0x10, 0x80, 0x02, 0x07, 0x04, 0x80, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x1E, 0x1F, 0x00, 0x03, 0x00, 0x1F, 0x02, 0x30, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x5F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x01, 0x02, 0x1F,
+    0x02, 0x30, 0x00, 0x1F, 0x52, 0x00, 0x00, 0x1F, 0x82, 0x80, 0x00, 0x1F,
+    0x81, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x5F, 0x00, 0x00, 0x04, 0x5F,
+    0x21, 0x00, 0x30, 0x1F, 0x02, 0x06, 0x00, 0x1F, 0x82, 0x40, 0x02, 0x1F,
+    0x92, 0x00, 0x08, 0x1F, 0x62, 0x00, 0xC0, 0x1F, 0x02, 0x18, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x02, 0x80, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x0F,
+    0x20, 0x20, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x8F,
+    0x80, 0x20, 0x0F, 0x82, 0x00, 0x0F, 0x8A, 0x04, 0x0F, 0xA8, 0x01, 0x0F,
+    0x49, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0xC0, 0x07,
+    0x00, 0x18, 0x00, 0x47, 0x01, 0x00, 0x03, 0x07, 0x08, 0x00, 0x30, 0x07,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x40, 0x20, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x20, 0x07, 0x80, 0x04, 0x00, 0x07, 0x20, 0x82, 0x10, 0x07,
+    0x01, 0x00, 0x10, 0x07, 0x9C, 0x10, 0x64, 0x07, 0x80, 0x80, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x04, 0x01, 0x20, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xE0 'à'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x30, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x30, 0x44, 0x01, 0x7F, 0x08, 0x40, 0x02, 0x7F, 0x04, 0x00, 0x24, 0x7F,
+    0x20, 0x00, 0x88, 0x7F, 0x00, 0x0E, 0x01, 0x7F, 0x06, 0x20, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x41, 0x81, 0x7F, 0x00, 0x48, 0x08, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x30, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x44, 0x01, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x00, 0x00, 0x24, 0x7F,
+    0x04, 0x00, 0x88, 0x7F, 0x00, 0x0E, 0x01, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x80, 0x40, 0x00, 0x7F, 0x88, 0x41, 0x81, 0x7F, 0x60, 0x48, 0x08, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x04, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x80, 0x04,
+    0x00, 0x00, 0x48, 0x80, 0x01, 0x10, 0x80, 0x1C, 0x02, 0x00, 0x40, 0x00,
+    0x04, 0x80, 0x00, 0x20, 0x83, 0x02, 0x00, 0x90, 0x10, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xC1, 0x00, 0x04, 0x01, 0x41, 0x10, 0x05, 0x91, 0x00, 0x09,
+    0x20, 0x00, 0x91, 0x00, 0x02, 0x21, 0x00, 0x38, 0x05, 0x08, 0x80, 0x01,
+    0x01, 0x00, 0x01, 0x81, 0x06, 0x05, 0x81, 0x20, 0x21, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xC1, 0x00, 0x04, 0x01, 0x41, 0x10, 0x05, 0x01, 0x00, 0x09,
+    0x00, 0x00, 0x91, 0x60, 0x02, 0x21, 0x00, 0x38, 0x05, 0x00, 0x80, 0x01,
+    0x09, 0x00, 0x01, 0x01, 0x06, 0x05, 0x11, 0x20, 0x21, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xE5 'å'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x30, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x44, 0x01, 0x7F, 0x22, 0x40, 0x02, 0x7F, 0x40, 0x00, 0x24, 0x7F,
+    0x05, 0x00, 0x88, 0x7F, 0xA1, 0x0E, 0x01, 0x7F, 0x04, 0x20, 0x00, 0x7F,
+    0x02, 0x40, 0x00, 0x7F, 0x24, 0x41, 0x81, 0x7F, 0x00, 0x48, 0x08, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0x00, 0x03, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00,
+    0x88, 0x02, 0x80, 0x04, 0x00, 0x48, 0x01, 0x10, 0x84, 0x04, 0x00, 0x02,
+    0x00, 0x00, 0x46, 0x10, 0x01, 0x40, 0x80, 0x00, 0xA0, 0x82, 0x20, 0x10,
+    0x01, 0x04, 0x82, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x08, 0x02, 0x05, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x81, 0x44, 0x10, 0x85, 0x00, 0x00, 0x89, 0x80, 0x00, 0x61,
+    0x00, 0x12, 0x01, 0x10, 0x00, 0x01, 0x80, 0x20, 0x01, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x98, 0x7F, 0x30, 0x24, 0xA0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x44, 0x51, 0x00, 0x7F, 0x22, 0x12, 0x41, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x06, 0x40, 0x10, 0x7F, 0x00, 0x00, 0x18, 0x7F,
+    0x00, 0x18, 0x00, 0x7F,
+    // 0xE9 'é'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x98, 0x7F, 0x00, 0x24, 0xA0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x51, 0x00, 0x7F, 0x04, 0x12, 0x41, 0x7F,
+    0x10, 0x00, 0x80, 0x7F, 0x00, 0x40, 0x10, 0x7F, 0x80, 0x00, 0x18, 0x7F,
+    0x00, 0x18, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x03, 0x30, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 0x40, 0xA2, 0x00,
+    0x80, 0x24, 0x82, 0x80, 0x01, 0x00, 0x08, 0x80, 0x20, 0x00, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x06, 0x61, 0x40, 0x92, 0x81, 0x00, 0x00, 0x01, 0x01, 0x44, 0x01,
+    0x60, 0x49, 0x05, 0x00, 0x02, 0x01, 0x41, 0x00, 0x41, 0x00, 0x00, 0x61,
+    0x00, 0x60, 0x01, 0x40, 0x00, 0x01,
+    // 0xEC 'ì'
+    0x00, 0x20, 0x0F, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x44, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x21, 0x7F, 0x02, 0x03, 0x08, 0x7F,
+    0x08, 0x30, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xED 'í'
+    0x00, 0x20, 0x0F, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x44, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x21, 0x7F, 0x0A, 0x03, 0x08, 0x7F,
+    0x02, 0x30, 0x02, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xEE 'î'
+    0x00, 0x40, 0x1E, 0x00, 0x01, 0x00, 0x10, 0x88, 0x00, 0x24, 0x80, 0x00,
+    0x48, 0x00, 0x42, 0x90, 0x06, 0x10, 0x00, 0x60, 0x04, 0x08, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x14, 0x00, 0x00,
+    // 0xEF 'ï'
+    0x00, 0x80, 0x3D, 0x30, 0x02, 0x01, 0x01, 0x10, 0x01, 0x01, 0x00, 0x01,
+    0x10, 0x00, 0x85, 0x00, 0x0C, 0x21, 0x00, 0xC0, 0x09, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0xC0, 0x00, 0x44, 0x00, 0x26, 0x08, 0x00, 0x1A, 0x90, 0x00,
+    0x00, 0x80, 0x10, 0x40, 0x80, 0x22, 0x01, 0x89, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x21, 0x00, 0x40, 0x00, 0x3E, 0x00,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x09, 0x00, 0x01, 0x81, 0x01, 0x18, 0x01,
+    0x01, 0x00, 0x05, 0x00, 0x00, 0x31, 0x41, 0x01, 0x01, 0x90, 0x24, 0x01,
+    0x20, 0x40, 0x01, 0x00, 0x80, 0x19, 0x00, 0x01, 0x01, 0x09, 0x38, 0x01,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x61, 0xA0, 0x04, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x11,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x04, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x20, 0x00, 0x04, 0x7F, 0x48, 0x40, 0x04, 0x7F, 0x04, 0x00, 0x09, 0x7F,
+    0x20, 0x00, 0x10, 0x7F, 0x10, 0x07, 0x82, 0x7F, 0x06, 0x40, 0x04, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x20, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x04, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x00, 0x09, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x07, 0x82, 0x7F, 0x20, 0x40, 0x04, 0x7F,
+    0x04, 0x00, 0x08, 0x7F, 0x88, 0x10, 0x20, 0x7F, 0x50, 0x02, 0x00, 0x7F,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x40, 0x04, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x80, 0x08,
+    0x00, 0x00, 0x12, 0x80, 0x00, 0x20, 0x80, 0x0F, 0x04, 0x00, 0x80, 0x08,
+    0x84, 0x00, 0x10, 0x20, 0x20, 0x40, 0x00, 0x04, 0x00,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x11, 0x00, 0x10, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x81, 0x00, 0x08, 0x01, 0x40, 0x00, 0x11, 0x91, 0x00, 0x11,
+    0x20, 0x00, 0x25, 0x00, 0x00, 0x41, 0x80, 0x1E, 0x09, 0x01, 0x00, 0x11,
+    0x00, 0x00, 0x21, 0x80, 0x40, 0x81, 0x80, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x11, 0x00, 0x10, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x81, 0x00, 0x08, 0x01, 0x40, 0x00, 0x11, 0x01, 0x00, 0x11,
+    0x00, 0x00, 0x25, 0x60, 0x00, 0x41, 0x00, 0x1E, 0x09, 0x31, 0x00, 0x11,
+    0x00, 0x00, 0x21, 0x00, 0x40, 0x81, 0x10, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0xF7 '÷'
+    0x02, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x15, 0x0B,
+    0x85, 0x43, 0x85, 0x43, 0x65, 0x33, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0xC0, 0x7F, 0x02, 0x54, 0x7F,
+    0x00, 0x24, 0x7F, 0x40, 0x04, 0x7F, 0x10, 0x09, 0x7F, 0x00, 0x10, 0x7F,
+    0x01, 0xC2, 0x7F, 0x40, 0x04, 0x7F, 0x00, 0x08, 0x7F, 0x20, 0x20, 0x7F,
+    0x52, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x4C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x30, 0x42, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x44, 0x00, 0x04, 0x7F,
+    0x22, 0x00, 0x48, 0x7F, 0x00, 0x01, 0x02, 0x7F, 0x06, 0x30, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x78, 0x7F, 0x00, 0x44, 0x08, 0x7F,
+    0x00, 0x60, 0x02, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x4C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x42, 0x01, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x04, 0x00, 0x48, 0x7F, 0x10, 0x01, 0x02, 0x7F, 0x00, 0x30, 0x00, 0x7F,
+    0x80, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x78, 0x7F, 0x20, 0x44, 0x08, 0x7F,
+    0x00, 0x60, 0x02, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x98, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x00, 0x84, 0x02, 0x00, 0x00, 0x04,
+    0x40, 0x00, 0x08, 0x90, 0x00, 0x90, 0x80, 0x02, 0x04, 0x08, 0x60, 0x00,
+    0x40, 0x80, 0x00, 0x10, 0x80, 0xF0, 0x00, 0x88, 0x10, 0x00, 0xC0, 0x04,
+    0x00, 0x00, 0x18,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x01, 0x30, 0x01,
+    0x00, 0x00, 0x01, 0x30, 0x01, 0x81, 0x01, 0x08, 0x05, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x21, 0x00, 0x04, 0x09, 0x40, 0xC0, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x01, 0xE1, 0x61, 0x10, 0x21, 0x01, 0x80, 0x09,
+    0x00, 0x00, 0x31,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x40, 0x07, 0x40, 0x0C, 0x00, 0x07,
+    0x01, 0x80, 0x00, 0xC7, 0x18, 0x00, 0x04, 0x07, 0x80, 0x01, 0x00, 0x27,
+    0x80, 0xE4, 0x10, 0x07, 0x84, 0x40, 0x10, 0x07, 0x60, 0x80, 0x20, 0x07,
+    0x00, 0x00, 0x44, 0x07, 0x01, 0x23, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x7C, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x97, 0x01, 0x18, 0x01, 0x27, 0x40, 0x00, 0xFC, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07, 0x60, 0x03, 0xE2, 0x07,
+    0x00, 0x00, 0x44, 0x07, 0x30, 0x81, 0x00, 0x07, 0x01, 0x38, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x10, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x40, 0x3F, 0x00, 0x41, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x02, 0x12, 0x00, 0x3F, 0x08, 0x02, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x42, 0x02, 0x10, 0x3F, 0x84, 0x02, 0x00, 0x3F, 0x80, 0x32, 0x04, 0x3F,
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x03, 0x3F, 0x01, 0x80, 0x00, 0x3F,
+    0x00, 0x0C, 0x00, 0x7F, 0x00, 0x00, 0x40, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x30, 0x3F,
+    // 0x105 'ą'
+    0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x60, 0x07, 0x02, 0x00, 0x07, 0x88, 0x02, 0x07, 0x80, 0x04, 0x07,
+    0x00, 0x48, 0x07, 0x01, 0x10, 0x07, 0x1C, 0x02, 0x8F, 0x40, 0x01, 0x07,
+    0x80, 0x00, 0x87, 0x83, 0x00, 0x0F, 0x90, 0x10, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x41, 0x07, 0x00, 0x02, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x7C, 0x07,
+    0x00, 0x02, 0x01, 0x07, 0x00, 0x44, 0x00, 0x07, 0x00, 0x08, 0x00, 0x87,
+    0x00, 0x80, 0x00, 0x07, 0x08, 0x90, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x97, 0x24, 0x00, 0x00, 0x07, 0x00, 0x90, 0x00, 0x27,
+    0x40, 0x82, 0x02, 0x47, 0x40, 0x02, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x107 'ć'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x22, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x04, 0x00, 0x09, 0x7F,
+    0x10, 0x08, 0x00, 0x7F, 0x00, 0x40, 0x10, 0x7F, 0x80, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x41, 0x07, 0x00, 0x02, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x7C, 0x07,
+    0x00, 0x02, 0x01, 0x07, 0x00, 0x44, 0x00, 0x07, 0x50, 0x08, 0x00, 0x87,
+    0x08, 0x80, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07, 0x02, 0x80, 0x00, 0x07,
+    0x02, 0x00, 0x00, 0x97, 0x10, 0x00, 0x00, 0x07, 0x20, 0x90, 0x00, 0x27,
+    0x40, 0x82, 0x02, 0x47, 0x10, 0x02, 0x00, 0x07, 0x20, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x10D 'č'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x22, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x02, 0x40, 0x00, 0x7F, 0x10, 0x00, 0x09, 0x7F,
+    0x12, 0x08, 0x00, 0x7F, 0x24, 0x40, 0x10, 0x7F, 0x48, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x50, 0x03, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x06, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x03, 0x07, 0x00, 0x80, 0x60, 0x47,
+    0x00, 0x04, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x17,
+    0x12, 0x00, 0x00, 0x97, 0x02, 0x90, 0x00, 0x07, 0x04, 0x80, 0x02, 0x27,
+    0x00, 0x04, 0x00, 0x07, 0x40, 0x40, 0x80, 0x47, 0x00, 0x00, 0x00, 0x87,
+    0x40, 0x00, 0x01, 0x07, 0x00, 0x08, 0x04, 0x07, 0x00, 0x03, 0xE0, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xC1, 0x00, 0x04, 0x01, 0x01, 0x10, 0x05, 0x01, 0x00, 0x09,
+    0x00, 0x00, 0x91, 0x20, 0x02, 0x21, 0x00, 0x38, 0x05, 0x01, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x80, 0x04, 0x05, 0x80, 0xC0, 0x21, 0x8C, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x40, 0x00, 0x01, 0x84, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x03, 0x00, 0x3F, 0x20, 0x20, 0x00, 0x3F, 0x86, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x03, 0x40, 0x3F, 0x80, 0x10, 0x40, 0x3F,
+    0x84, 0x10, 0x43, 0x3F, 0x80, 0x10, 0x44, 0x7F, 0x80, 0x10, 0x48, 0x3F,
+    0x80, 0x10, 0x05, 0x3F, 0x80, 0x11, 0x08, 0x3F, 0x80, 0x20, 0x00, 0x7F,
+    0x80, 0x00, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x84, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x07, 0x02, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x03, 0x30, 0x37, 0x49, 0x40, 0x8F, 0x00, 0x00, 0x07, 0xA2, 0x00, 0x07,
+    0x24, 0x80, 0x0F, 0x01, 0x00, 0x17, 0x80, 0x20, 0x07, 0x00, 0x30, 0x07,
+    0x30, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x20, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x4F, 0x50, 0x80, 0x10, 0x4F,
+    0x08, 0x84, 0x10, 0x4F, 0x00, 0x80, 0x10, 0x4F, 0x12, 0x80, 0x10, 0x4F,
+    0x02, 0x80, 0x10, 0x0F, 0x00, 0x80, 0x11, 0x0F, 0x20, 0x80, 0x20, 0x0F,
+    0x40, 0x80, 0x00, 0x4F, 0x10, 0x80, 0x00, 0x0F, 0x20, 0x84, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x98, 0x7F, 0x60, 0x24, 0xA0, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x02, 0x51, 0x00, 0x7F, 0x10, 0x12, 0x41, 0x7F,
+    0x12, 0x00, 0x80, 0x7F, 0x24, 0x40, 0x10, 0x7F, 0x48, 0x00, 0x18, 0x7F,
+    0x00, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x20, 0x20, 0x0F, 0x00, 0x86, 0x00, 0x0F,
+    0x04, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x4F, 0x10, 0x80, 0x30, 0x4F,
+    0x00, 0x86, 0x00, 0x4F, 0x04, 0x80, 0x00, 0x4F, 0x40, 0xA0, 0x00, 0x4F,
+    0x08, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x80, 0x18, 0x03,
+    0x0C, 0x01, 0x00, 0x03, 0x14, 0x30, 0x00, 0x03, 0x05, 0x00, 0x02, 0x0B,
+    0x21, 0x00, 0x60, 0x43, 0x01, 0x06, 0x00, 0x03, 0x48, 0xC0, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0xC3,
+    0x08, 0x08, 0x03, 0x21, 0x80, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0xD3,
+    0x20, 0x0C, 0x13, 0x21, 0x80, 0x13, 0x20, 0x00, 0x13, 0x28, 0x00, 0x13,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x43, 0x60, 0x00, 0x07, 0x84, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x45, 0x40, 0x0C, 0x01, 0x00, 0x80, 0x01,
+    0x18, 0x00, 0x01, 0x80, 0x01, 0x05, 0x80, 0x30, 0x21, 0x83, 0x00, 0x01,
+    0x60, 0x00, 0x01, 0x04, 0x00, 0x01, 0x60, 0x00, 0x01, 0x84, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x2F, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x0B, 0x0F,
+    0x20, 0x00, 0x0F, 0x86, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x4F,
+    0x80, 0x30, 0x4F, 0x87, 0x00, 0x4F, 0x81, 0x40, 0x4F, 0xA0, 0x00, 0x4F,
+    0x41, 0x80, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x45, 0x40, 0x10, 0x01,
+    0x00, 0x80, 0x01, 0x18, 0x00, 0x01, 0x80, 0x01, 0x05, 0x80, 0x10, 0x21,
+    0x83, 0x00, 0x01, 0x60, 0x80, 0x01, 0x00, 0x40, 0x01,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x20, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0xC7, 0x00, 0x80, 0x30, 0x07, 0x00, 0x81, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x40, 0x10, 0x07, 0x04, 0x10, 0x04, 0x07,
+    0x08, 0x02, 0x01, 0x07, 0x10, 0x00, 0x80, 0x47, 0x00, 0x00, 0x20, 0x07,
+    0x24, 0x00, 0x00, 0x07, 0x40, 0x20, 0x30, 0x07, 0x08, 0x82, 0x00, 0x07,
+    0x30, 0x80, 0x01, 0x87, 0x00, 0x80, 0x10, 0x07, 0x00, 0x83, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x02, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x46, 0x00, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    0x00, 0x40, 0x40, 0x7F, 0x00, 0x09, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x04, 0x20, 0x06, 0x7F, 0x10, 0x00, 0x40, 0x7F, 0x20, 0x4E, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x88, 0x00, 0x18, 0x7F, 0x60, 0x01, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x07, 0x00, 0x20, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0xC7, 0x00, 0x80, 0x30, 0x07, 0x00, 0x81, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x40, 0x10, 0x07, 0x40, 0x10, 0x04, 0x07,
+    0x20, 0x02, 0x01, 0x07, 0x02, 0x00, 0x80, 0x47, 0x12, 0x00, 0x20, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x08, 0x20, 0x30, 0x07, 0x40, 0x82, 0x00, 0x07,
+    0x00, 0x80, 0x01, 0x87, 0x40, 0x80, 0x10, 0x07, 0x00, 0x83, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x02, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x46, 0x00, 0x7F, 0x00, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    0x60, 0x40, 0x40, 0x7F, 0x00, 0x09, 0x00, 0x7F, 0x42, 0x10, 0x00, 0x7F,
+    0x10, 0x20, 0x06, 0x7F, 0x12, 0x00, 0x40, 0x7F, 0x24, 0x4E, 0x00, 0x7F,
+    0x48, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x18, 0x7F, 0x00, 0x01, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x07, 0x00, 0xC1, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27,
+    0x10, 0x00, 0x07, 0x00, 0x42, 0x17, 0x00, 0x00, 0x07, 0x44, 0x00, 0x87,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x87, 0x80, 0x18, 0x07, 0x83, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x01, 0xC7, 0x80, 0x10, 0x47, 0x86, 0x10, 0x47, 0x80, 0x10, 0x47,
+    0x80, 0x10, 0x47, 0x80, 0x10, 0x07, 0x80, 0x10, 0x07, 0x80, 0x02, 0x07,
+    0x9C, 0x40, 0x27, 0x80, 0x01, 0x07, 0x84, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0x153 'œ'
+    0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x08, 0x80, 0x08, 0x00, 0x12, 0x00, 0x20, 0x8F, 0x00, 0x00, 0x04,
+    0x40, 0x02, 0x20, 0x00, 0x04, 0x00, 0x11, 0x40, 0x80, 0x00, 0xA0, 0x82,
+    0x00, 0x10, 0x01, 0x04, 0x82, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x10, 0x03, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x06, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x50, 0x80, 0x03, 0x47, 0x08, 0x80, 0x40, 0x07,
+    0x00, 0x0C, 0x08, 0x07, 0x12, 0x20, 0x00, 0x07, 0x02, 0x00, 0x40, 0x07,
+    0x00, 0x80, 0x80, 0x07, 0x20, 0x89, 0x04, 0x07, 0x40, 0x00, 0x20, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x43, 0x00,
+    0x00, 0x40, 0x00, 0x70, 0x00, 0x06, 0x04, 0x40, 0x20, 0x02, 0x00, 0x80,
+    0x10, 0x12, 0x00, 0x12, 0x24, 0x00, 0x24, 0x40, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x06, 0x00, 0x17, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x0C, 0x10, 0x47, 0x04, 0x90, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x83, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x04, 0x90, 0x00, 0x27, 0x40, 0x82, 0x00, 0x47, 0x08, 0x00, 0x0F, 0x07,
+    0x00, 0x58, 0x00, 0x07,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x0A, 0x10, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x10, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x22, 0x08, 0x80, 0x7F, 0x04, 0x40, 0x38, 0x7F,
+    0x88, 0x30, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x7F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x06, 0x00, 0x17, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x47, 0x00, 0x0C, 0x10, 0x47, 0x44, 0x90, 0x00, 0x47,
+    0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x83, 0x17, 0x12, 0x00, 0x00, 0x07,
+    0x24, 0x90, 0x00, 0x27, 0x08, 0x82, 0x00, 0x47, 0x10, 0x00, 0x0F, 0x07,
+    0x00, 0x58, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x0A, 0x10, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x04, 0x7F,
+    0x08, 0x00, 0x04, 0x7F, 0x42, 0x40, 0x04, 0x7F, 0x00, 0x10, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x08, 0x80, 0x7F, 0x08, 0x40, 0x38, 0x7F,
+    0x10, 0x30, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x62, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    0x00, 0x84, 0x00, 0x0F, 0x00, 0x90, 0x00, 0x4F, 0x00, 0x80, 0x0C, 0x0F,
+    0x60, 0x80, 0xC0, 0x0F, 0x08, 0x98, 0x00, 0x0F, 0x04, 0x80, 0x00, 0x0F,
+    0x02, 0x80, 0x04, 0x0F, 0x02, 0x80, 0xC0, 0x1F, 0x10, 0x98, 0x00, 0x0F,
+    0x24, 0x80, 0x00, 0x0F, 0x08, 0x80, 0x00, 0x0F, 0x10, 0x80, 0x00, 0x0F,
+    0x20, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x84, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x82, 0x00, 0x18, 0x00,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+    0x04, 0x80, 0x10, 0x00, 0x80, 0x04, 0x10, 0x80, 0x28, 0x00, 0x40, 0x00,
+    0x08, 0x00, 0x00, 0x60, 0x00, 0x00,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x40, 0x87,
+    0x00, 0x8C, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x1C, 0xA0, 0x00, 0x07,
+    0x42, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0xA4, 0x00, 0x01, 0x17,
+    0xA0, 0x40, 0x0C, 0x07, 0x12, 0x81, 0x80, 0x07, 0x44, 0x90, 0x00, 0x87,
+    0x00, 0x80, 0x02, 0x07, 0x00, 0x80, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x4C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x42, 0x01, 0x7F, 0x20, 0x00, 0x02, 0x7F, 0x49, 0x00, 0x04, 0x7F,
+    0x21, 0x00, 0x48, 0x7F, 0xA1, 0x01, 0x02, 0x7F, 0x08, 0x30, 0x00, 0x7F,
+    0x02, 0x40, 0x00, 0x7F, 0x38, 0x40, 0x78, 0x7F, 0x00, 0x44, 0x08, 0x7F,
+    0x00, 0x60, 0x02, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x40, 0x87,
+    0x00, 0x8C, 0x00, 0x07, 0x0A, 0x80, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x04, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97, 0x48, 0x00, 0x01, 0x17,
+    0x00, 0x40, 0x0C, 0x07, 0x24, 0x81, 0x80, 0x07, 0x00, 0x90, 0x00, 0x87,
+    0x10, 0x80, 0x02, 0x07, 0x24, 0x80, 0x30, 0x07, 0x00, 0x86, 0x00, 0x07,
+    0x08, 0x80, 0x00, 0x07, 0x50, 0xA0, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x4C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x08, 0x42, 0x01, 0x7F, 0x12, 0x00, 0x02, 0x7F, 0x04, 0x00, 0x04, 0x7F,
+    0x08, 0x00, 0x48, 0x7F, 0x10, 0x01, 0x02, 0x7F, 0x08, 0x30, 0x00, 0x7F,
+    0x12, 0x40, 0x00, 0x7F, 0x04, 0x40, 0x78, 0x7F, 0x08, 0x44, 0x08, 0x7F,
+    0x10, 0x60, 0x02, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x02, 0x40, 0x00, 0x3F,
+    0x02, 0x08, 0x00, 0x3F, 0x02, 0x01, 0x01, 0x3F, 0x02, 0x00, 0x70, 0x3F,
+    0x72, 0x40, 0x00, 0x3F, 0x82, 0x88, 0x00, 0x3F, 0x82, 0x01, 0x00, 0x3F,
+    0x90, 0x02, 0x10, 0x3F, 0x00, 0x00, 0x40, 0x7F, 0x01, 0x10, 0x00, 0x3F,
+    0x02, 0x82, 0x00, 0x3F, 0x82, 0x04, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x3F,
+    0x22, 0x20, 0x00, 0x3F, 0x02, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x1C, 0x02, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x90, 0x00, 0xC7, 0x00, 0x80, 0x41, 0x47, 0x04, 0x80, 0x80, 0x47,
+    0x08, 0x80, 0x00, 0x47, 0x10, 0x80, 0x10, 0x47, 0x00, 0x88, 0x20, 0x47,
+    0x24, 0x90, 0x40, 0x07, 0x40, 0x80, 0x01, 0x07, 0x08, 0x80, 0x04, 0x07,
+    0x30, 0x84, 0x04, 0x27, 0x00, 0x08, 0x03, 0x07, 0x00, 0x50, 0x00, 0x07,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x0C, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x42, 0x02, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x48, 0x19, 0x7F, 0x00, 0x48, 0x20, 0x7F, 0x04, 0x00, 0x40, 0x7F,
+    0x10, 0x20, 0x80, 0x7F, 0x20, 0x01, 0x08, 0x7F, 0x80, 0x40, 0x00, 0x7F,
+    0x80, 0x00, 0x10, 0x7F, 0x60, 0x40, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x38, 0x04, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x20, 0x01, 0x8F, 0x01, 0x00, 0x82, 0x8F, 0x01, 0x01, 0x00, 0x8F,
+    0x29, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x20, 0x8F, 0x01, 0x10, 0x40, 0x8F,
+    0x01, 0x20, 0x80, 0x0F, 0x01, 0x00, 0x02, 0x0F, 0x01, 0x00, 0x08, 0x0F,
+    0x01, 0x08, 0x08, 0x4F, 0x00, 0x10, 0x06, 0x0F, 0x00, 0xA0, 0x00, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x30, 0x21, 0x00, 0x00, 0x41,
+    0x01, 0x08, 0x09, 0x00, 0x20, 0x01, 0x01, 0x20, 0x65, 0x71, 0x20, 0x81,
+    0x80, 0x01, 0x01, 0x80, 0x82, 0x01, 0x90, 0x04, 0x21, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x41, 0x01, 0x00, 0x11, 0x00, 0x80, 0x01,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x1C, 0x02, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x90, 0x00, 0xC7, 0x00, 0x80, 0x41, 0x47, 0x40, 0x80, 0x80, 0x47,
+    0x20, 0x80, 0x00, 0x47, 0x02, 0x80, 0x10, 0x47, 0x12, 0x88, 0x20, 0x47,
+    0x04, 0x90, 0x40, 0x07, 0x08, 0x80, 0x01, 0x07, 0x40, 0x80, 0x04, 0x07,
+    0x00, 0x84, 0x04, 0x27, 0x40, 0x08, 0x03, 0x07, 0x00, 0x50, 0x00, 0x07,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x0C, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x42, 0x02, 0x7F, 0x60, 0x08, 0x00, 0x7F,
+    0x00, 0x48, 0x19, 0x7F, 0x42, 0x48, 0x20, 0x7F, 0x10, 0x00, 0x40, 0x7F,
+    0x12, 0x20, 0x80, 0x7F, 0x24, 0x01, 0x08, 0x7F, 0x48, 0x40, 0x00, 0x7F,
+    0x10, 0x00, 0x10, 0x7F, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    // 0x3C0 'π'
+    0x00, 0x02, 0x00, 0x00, 0x08, 0x10, 0x00, 0x40, 0x11, 0x02, 0x9C, 0x08,
+    0x80, 0x20, 0x81, 0x00, 0x98, 0x00, 0x90, 0x60, 0x92, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x82, 0x02, 0x90, 0x00, 0x90, 0x14, 0x80, 0x00, 0x20, 0x00,
+    0x00, 0x00,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x18, 0x07, 0x01, 0x80, 0x07, 0x08, 0x00, 0x07, 0x10, 0x01, 0x87,
+    0x00, 0x30, 0x07, 0x42, 0x00, 0x87, 0x08, 0x00, 0x17, 0x90, 0x02, 0x07,
+    0x80, 0x80, 0x47, 0x20, 0x10, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x81, 0x03, 0x17, 0x02, 0x00, 0x07, 0x40, 0x00, 0x27, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F,
+    // 0x2014 '—'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2018 '‘'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0x7F, 0x00, 0xFF, 0x90, 0x7F, 0x80, 0x7F,
+    0x00, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x7F, 0x01, 0xFF, 0x04, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0x84, 0x7F,
+    0x70, 0x7F,
+    // 0x201A '‚'
+    0x01, 0xBF, 0x02, 0x3F, 0x30, 0xBF, 0x81, 0x3F, 0x80, 0x3F, 0x08, 0x3F,
+    0x00, 0x3F,
+    // 0x201B '‛'
+    0x00, 0x3F, 0x04, 0x3F, 0x81, 0x3F, 0x80, 0xBF, 0x24, 0x3F, 0x01, 0x3F,
+    0x00, 0x3F,
+    // 0x201C '“'
+    0x03, 0x7F, 0x00, 0xFF, 0x20, 0x7F, 0x00, 0xFF, 0x90, 0x7F, 0x80, 0x7F,
+    0x07, 0x7F, 0x10, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x90, 0x7F, 0x80, 0x7F,
+    0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x3F, 0x01, 0x3F, 0x00, 0x3F, 0x10, 0xBF, 0x01, 0x3F, 0x00, 0x3F,
+    0x70, 0x3F, 0x01, 0x3F, 0x04, 0x3F, 0x00, 0xBF, 0x81, 0x3F, 0x04, 0x3F,
+    0x70, 0x3F,
+    // 0x201E '„'
+    0x01, 0xBF, 0x02, 0x3F, 0x30, 0xBF, 0x81, 0x3F, 0x80, 0x3F, 0x08, 0x3F,
+    0x00, 0x3F, 0x04, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0x84, 0x3F, 0x70, 0x3F,
+    // 0x201F '‟'
+    0x00, 0x3F, 0x04, 0x3F, 0x81, 0x3F, 0x80, 0xBF, 0x24, 0x3F, 0x01, 0x3F,
+    0x78, 0x3F, 0x82, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x42, 0x3F, 0x00, 0xBF,
+    // 0x2020 '†'
+    0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x00, 0xDF, 0x05, 0x04, 0x1F,
+    0x05, 0x60, 0x1F, 0x7C, 0x00, 0x5F, 0x80, 0x38, 0x1F, 0x85, 0x00, 0x1F,
+    0xA5, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x02, 0x00, 0x83, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x23, 0x05, 0x00, 0x03, 0x05, 0x40, 0x03, 0x7C, 0x00, 0xC3,
+    0x80, 0x08, 0x03, 0x85, 0x00, 0x03, 0xA5, 0x00, 0x83, 0x04, 0x00, 0x83,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x2022 '•'
+    0x25, 0x41, 0x03, 0x03, 0x01, 0x45, 0x01,
+    // 0x2026 '…'
+    0x37, 0x87, 0x07, 0x07, 0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8F,
+    0x07, 0x97, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x8F, 0x07, 0x17, 0x47,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x04, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x20, 0x0F, 0x41, 0x0F,
+    0x00, 0x0F, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x00, 0x0F, 0x00, 0x6F, 0x00, 0x8F, 0x01, 0x2F, 0x0A, 0x0F, 0x40, 0x0F,
+    0x20, 0x8F, 0x11, 0x0F, 0x0A, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x03, 0x02, 0x0B, 0x00, 0x03, 0x00, 0x07, 0x02, 0x13, 0x40, 0x03,
+    0x00, 0x17, 0x00, 0x03, 0x0F, 0x0B, 0x40, 0x13, 0x00, 0x03, 0x1F, 0x03,
+    // 0x2074 '⁴'
+    0x00, 0x03, 0x00, 0x83, 0x01, 0x03, 0x02, 0x03, 0x04, 0x03, 0x08, 0x03,
+    0x10, 0x1F, 0x21, 0x07, 0x40, 0x07, 0x00, 0x83, 0x0C, 0x03, 0x00, 0x43,
+    // 0x2075 '⁵'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x07, 0x08, 0x07, 0x40, 0x27, 0x80, 0x0F,
+    0xAA, 0x47, 0xA8, 0x17, 0xA0, 0x07, 0xA0, 0x47, 0xA0, 0x07, 0xC0, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0xF3, 0x04, 0x03, 0x08, 0x07, 0x11, 0x13, 0x25, 0x03, 0x0D, 0x03,
+    0x40, 0x07, 0x10, 0x03, 0x02, 0x0B, 0x01, 0xE3, 0x40, 0x03, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x10, 0x07, 0x88, 0x4F, 0x90, 0x87, 0xA0, 0x0F, 0xA4, 0x07, 0xA0, 0x87,
+    0xA2, 0x07, 0x84, 0x07, 0x80, 0x07, 0xA0, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x4B, 0x00, 0x83, 0x03, 0x07, 0x00, 0x17, 0x48, 0x03, 0x00, 0x87,
+    0x00, 0x67, 0x18, 0x03, 0x42, 0x03, 0x04, 0x63, 0x10, 0x03,
+    // 0x2079 '⁹'
+    0x00, 0x0B, 0x00, 0x07, 0x11, 0x03, 0x20, 0x97, 0x40, 0x17, 0x10, 0x03,
+    0x01, 0x4B, 0x01, 0x03, 0x0E, 0x03, 0x40, 0x03, 0x20, 0x83, 0x00, 0x03,
+    // 0x2080 '₀'
+    0x00, 0x07, 0x04, 0x17, 0x00, 0x0F, 0x00, 0x07, 0x04, 0x27, 0x80, 0x07,
+    0x20, 0x2F, 0x00, 0x07, 0x1E, 0x17, 0x80, 0x27, 0x00, 0x07, 0x3E, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x07, 0x30, 0x07, 0x00, 0x27, 0x06, 0x07, 0x40, 0x07,
+    0x00, 0x77, 0x4C, 0x07, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x2F, 0x10, 0x4F, 0x48, 0x0F, 0x10, 0x0F, 0x80, 0x6F,
+    0x22, 0x2F, 0x04, 0x2F, 0x11, 0x2F, 0x82, 0x2F, 0x04, 0x17, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x0B, 0x00, 0x03, 0x10, 0x03, 0x11, 0x03, 0x85, 0x2B, 0x01, 0x0B,
+    0x08, 0x83, 0x00, 0x13, 0x86, 0x23, 0x40, 0x03,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x07, 0x02, 0x07, 0x04, 0x07, 0x08, 0x07, 0x10, 0x07,
+    0x20, 0x3F, 0x42, 0x0F, 0x80, 0x0F, 0x01, 0x07, 0x98, 0x07, 0x00, 0x87,
+    // 0x2085 '₅'
+    0x00, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x08, 0x03, 0x40, 0x23, 0x80, 0x0B,
+    0x88, 0x43, 0xA8, 0x03, 0xA0, 0x03, 0xA0, 0x43, 0xA0, 0x03, 0xC0, 0x03,
+    // 0x2086 '₆'
+    0x01, 0xE7, 0x08, 0x07, 0x10, 0x0F, 0x20, 0x27, 0x4A, 0x07, 0x12, 0x07,
+    0x80, 0x0F, 0xA0, 0x07, 0x04, 0x17, 0x03, 0xC7, 0x80, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x10, 0x03, 0x08, 0x03, 0x90, 0x83, 0xA0, 0x0B, 0xA4, 0x03, 0xA8, 0x83,
+    0xA2, 0x03, 0x84, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    // 0x2088 '₈'
+    0x00, 0x97, 0x01, 0x07, 0x06, 0x0F, 0x00, 0x07, 0x90, 0x07, 0x01, 0x0F,
+    0x00, 0xCF, 0x30, 0x07, 0x84, 0x07, 0x00, 0xC7, 0x20, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x17, 0x00, 0x0F, 0x02, 0x07, 0x41, 0x07, 0x00, 0x2F, 0xA0, 0x07,
+    0x02, 0x87, 0x02, 0x07, 0x9C, 0x27, 0x00, 0x47, 0x41, 0x07, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0xD0, 0x07, 0x00, 0x14, 0x07,
+    0x00, 0x00, 0x87, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x17,
+    0x01, 0x11, 0x07, 0x00, 0x10, 0x87, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x10, 0x07, 0x10, 0x80, 0x17, 0x10, 0x00, 0x87,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x48, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x3F, 0x40, 0x7F, 0xB0, 0xBF, 0x86, 0x3F, 0x80, 0x3F, 0x83, 0xBF,
+    0xA0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xA0, 0xBF, 0x03, 0x3F, 0x10, 0x3F,
+    0x84, 0x3F, 0x8C, 0x3F, 0x40, 0x3F, 0x01, 0x3F, 0x14, 0x7F, 0x4B, 0x3F,
+    0x00, 0x3F, 0x8F, 0x3F, 0x80, 0x3F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x08, 0x30, 0x01,
+    0x2B, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x60, 0x05, 0x06, 0x08, 0x01,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x04, 0x41,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x40, 0x01, 0x00, 0x10, 0x01,
+    0x02, 0x20, 0x01, 0x00, 0x00, 0x01, 0x11, 0x00, 0x11, 0x02, 0x00, 0x11,
+    0x00, 0x01, 0x01, 0x00, 0x10, 0x01, 0x20, 0x01, 0x01, 0x00, 0xA4, 0x09,
+    0x00, 0x88, 0x01, 0x00, 0x02, 0x11, 0x00, 0x05, 0x41, 0x00, 0x30, 0x01,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x20, 0x01,
+    0x24, 0x40, 0x01, 0x08, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x40, 0x09,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x03, 0x00, 0x08, 0x81, 0x00, 0x01, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x10, 0x01, 0x00, 0x04, 0x01,
+    0x00, 0x88, 0x01, 0x01, 0x00, 0x01, 0x04, 0x40, 0x01, 0x08, 0x80, 0x11,
+    0x20, 0x00, 0x11, 0x44, 0x01, 0x01, 0x08, 0x10, 0x01, 0x40, 0x01, 0x01,
+    0x00, 0xA4, 0x09, 0x00, 0x88, 0x01, 0x00, 0x02, 0x11, 0x00, 0x05, 0x41,
+    0x00, 0x30, 0x01,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x08, 0x30, 0x01,
+    0x2B, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x60, 0x0D, 0x06, 0x08, 0x01,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x89, 0x00, 0x00, 0x11, 0x00, 0x00, 0x41,
+    0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x00, 0x44, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x20, 0x01, 0x04, 0x40, 0x01, 0x00, 0x00, 0x81, 0x22, 0x19, 0x01,
+    0x04, 0x02, 0x61, 0x00, 0x00, 0x11, 0x20, 0x01, 0x11, 0x00, 0x84, 0x01,
+    0x00, 0x80, 0x09, 0x00, 0x82, 0x01, 0x00, 0x04, 0x01, 0x00, 0x48, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x215C '⅜'
+    0x00, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x10, 0x0A, 0x01, 0x21, 0x0A, 0x01,
+    0x08, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x64, 0x11, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x05, 0x14, 0x01, 0x01, 0x00, 0x02, 0x21, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x20, 0x01, 0x00, 0x08, 0x01, 0x01, 0x10, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x01, 0x00, 0x81, 0x40, 0x19, 0x01,
+    0x08, 0x02, 0x61, 0x50, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x84, 0x01,
+    0x00, 0x80, 0x09, 0x00, 0x82, 0x01, 0x00, 0x04, 0x01, 0x00, 0x48, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x07, 0x0A, 0x01,
+    0x21, 0x02, 0x01, 0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x00, 0x00, 0x11,
+    0x02, 0x08, 0x03, 0x01, 0x10, 0x01, 0x00, 0x01, 0x11, 0x20, 0x02, 0x21,
+    0x00, 0x00, 0x81, 0x00, 0x11, 0x01, 0x00, 0x20, 0x01, 0x00, 0x88, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x40, 0x01, 0x08, 0x80, 0x01, 0x00, 0x00, 0x81,
+    0x40, 0x19, 0x01, 0x08, 0x02, 0x61, 0x40, 0x00, 0x11, 0x00, 0x01, 0x11,
+    0x00, 0x84, 0x01, 0x00, 0x80, 0x09, 0x00, 0x82, 0x01, 0x00, 0x04, 0x01,
+    0x00, 0x48, 0x01, 0x00, 0x00, 0x01,
+    // 0x215E '⅞'
+    0x0C, 0x00, 0x01, 0x20, 0x12, 0x01, 0x04, 0x02, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x10, 0x05, 0x00, 0x40, 0x21, 0x08, 0x80, 0x05, 0x00, 0x00, 0x01,
+    0x04, 0x02, 0x21, 0x08, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x10, 0x01, 0x02, 0x00, 0x01, 0x08, 0x80, 0x01,
+    0x11, 0x00, 0x01, 0x40, 0x00, 0x81, 0x80, 0x19, 0x01, 0x10, 0x02, 0x61,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x84, 0x01, 0x00, 0x80, 0x09,
+    0x00, 0x82, 0x01, 0x00, 0x04, 0x01, 0x00, 0x48, 0x01, 0x00, 0x00, 0x01,
+    // 0x2190 '←'
+    0x02, 0x07, 0x00, 0x07, 0x10, 0x07, 0x20, 0x07, 0x40, 0x07, 0x81, 0x07,
+    0x01, 0x57, 0x21, 0x27, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x06, 0x00, 0x1F, 0x09, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x24, 0x00, 0x1F, 0x47, 0xFF, 0xDF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x47, 0xFF, 0xDF, 0x24, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x09, 0x00, 0x1F,
+    0x06, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x07, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x01, 0x07, 0x21, 0x27, 0x01, 0x47,
+    0x81, 0x07, 0x40, 0x07, 0x20, 0x07, 0x10, 0x07, 0x00, 0x07, 0x02, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x10, 0x1F,
+    0x00, 0x00, 0x1F, 0x7F, 0xFC, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x7F, 0xFC, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x06, 0x07, 0x08, 0x07, 0x10, 0x07, 0x20, 0x07, 0x49, 0x07, 0x11, 0x07,
+    0x01, 0x47, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x47,
+    0x11, 0x07, 0x49, 0x07, 0x20, 0x07, 0x10, 0x07, 0x08, 0x07, 0x06, 0x07,
+    // 0x2195 '↕'
+    0x04, 0x04, 0x1F, 0x02, 0x02, 0x1F, 0x02, 0x01, 0x1F, 0x04, 0x04, 0x9F,
+    0x0F, 0xFC, 0x5F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x0F, 0xFC, 0x5F,
+    0x04, 0x04, 0x9F, 0x02, 0x01, 0x1F, 0x02, 0x02, 0x1F, 0x04, 0x04, 0x1F,
+    // 0x21D0 '⇐'
+    0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x09, 0x00, 0x10, 0x40, 0x20, 0x40,
+    0x48, 0x50, 0x50, 0x51, 0x20, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x06, 0x70,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x3F, 0x02, 0x80, 0x3F, 0x04, 0x80, 0x3F, 0x09, 0x00, 0x3F,
+    0x12, 0x07, 0xFF, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x10, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x12, 0x07, 0xFF,
+    0x09, 0x00, 0x3F, 0x04, 0x80, 0x3F, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x06, 0x70, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x20, 0x50, 0x50, 0x51, 0x48, 0x50,
+    0x20, 0x40, 0x10, 0x40, 0x09, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x80,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x7C, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x78, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D4 '⇔'
+    0x03, 0x01, 0x04, 0x01, 0x08, 0x01, 0x12, 0x01, 0x20, 0x81, 0x40, 0x85,
+    0x18, 0xA5, 0x28, 0x89, 0x08, 0x81, 0x08, 0x81, 0x28, 0x89, 0x18, 0xA5,
+    0x40, 0x81, 0x20, 0x81, 0x12, 0x01, 0x08, 0x01, 0x04, 0x01, 0x03, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x30, 0x00, 0x01,
+    0x50, 0x03, 0xC1, 0x00, 0x80, 0x11, 0x80, 0x00, 0x11, 0xA1, 0x00, 0x01,
+    0x01, 0x00, 0x25, 0x91, 0x00, 0x81, 0x86, 0x1C, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x41, 0x10, 0x02, 0x01, 0x03, 0xE0, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x8F, 0x00, 0x04, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x40, 0x8F, 0x02, 0x02, 0x4F, 0x08, 0x10, 0x4F, 0x00, 0x80, 0x4F,
+    0x02, 0x00, 0x4F, 0x84, 0x00, 0x4F, 0x00, 0x80, 0x4F, 0x00, 0x10, 0x4F,
+    0x20, 0x02, 0x4F, 0x04, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x04, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x3F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x9F, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x9F, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x01, 0x7F, 0x08, 0x00, 0x10, 0x7F,
+    0x80, 0x00, 0x20, 0x7F, 0x81, 0x00, 0x00, 0x7F, 0x80, 0x01, 0x08, 0x7F,
+    0x80, 0x22, 0x10, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x82, 0x00, 0x00, 0x7F,
+    0x80, 0x01, 0x00, 0x7F, 0x80, 0x42, 0x00, 0x7F, 0x80, 0x10, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F, 0x84, 0x00, 0x10, 0x7F,
+    0x82, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x40, 0xFF, 0x00, 0x00, 0x3C, 0x7F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x0C, 0x1F,
+    0x00, 0x08, 0x00, 0x9F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x80, 0x5F, 0x00, 0x04, 0x06, 0x1F,
+    0x00, 0x60, 0x20, 0x1F, 0x02, 0x01, 0x00, 0x1F, 0x30, 0x08, 0x00, 0x1F,
+    0x80, 0x40, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x1E, 0x1F, 0x40, 0x1F, 0x00, 0x5F, 0x90, 0x1F, 0x01, 0x1F, 0x80, 0x1F,
+    0x02, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x4C, 0x1F, 0x12, 0x5F,
+    0x80, 0x1F, 0x00, 0x1F, 0x8C, 0x5F, 0x00, 0x1F, 0x21, 0x1F, 0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x80, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x0C, 0x61, 0x00, 0x11, 0x00, 0x19, 0x00, 0x01, 0x00, 0x05, 0x03, 0x01,
+    0x00, 0x11, 0x00, 0x91, 0x22, 0x11, 0x40, 0x11, 0x10, 0x11, 0x00, 0x11,
+    0x00, 0x11,
+    // 0x2264 '≤'
+    0x02, 0x01, 0xFF, 0x01, 0x02, 0x7F, 0x00, 0x02, 0x7F, 0x08, 0x82, 0x7F,
+    0x00, 0x02, 0x7F, 0x10, 0x02, 0x7F, 0x05, 0x02, 0x7F, 0x20, 0x02, 0x7F,
+    0x08, 0x82, 0x7F, 0x40, 0x02, 0x7F, 0x10, 0x4A, 0x7F, 0x80, 0x0A, 0x7F,
+    0x20, 0x22, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0xFF, 0x40, 0x09, 0x3F, 0x40, 0x21, 0x3F, 0x08, 0x01, 0x3F,
+    0x20, 0x01, 0x3F, 0x04, 0x01, 0x3F, 0x10, 0x01, 0x3F, 0x02, 0x81, 0x3F,
+    0x09, 0x21, 0x3F, 0x00, 0x01, 0x3F, 0x04, 0x41, 0x3F, 0x00, 0x01, 0x3F,
+    0x02, 0x81, 0x3F,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly28BoldItalicColOffsets[] PROGMEM = {
+    0x0, 0x1C, 0x37, 0x4D, 0x83, 0xC3, 0x111, 0x156, 0x162, 0x192, 0x1C6, 0x1DC,
+    0x1F6, 0x206, 0x20F, 0x214, 0x247, 0x27A, 0x29E, 0x2D1, 0x301, 0x334, 0x364, 0x397,
+    0x3C4, 0x3F7, 0x42D, 0x43D, 0x45B, 0x475, 0x48F, 0x4A9, 0x4C7, 0x52F, 0x571, 0x5A7,
+    0x5E0, 0x61F, 0x658, 0x68E, 0x6CA, 0x715, 0x73F, 0x787, 0x7CC, 0x7FF, 0x850, 0x89B,
+    0x8D7, 0x910, 0x970, 0x9AC, 0x9DC, 0xA15, 0xA57, 0xA99, 0xAED, 0xB35, 0xB71, 0xBA7,
+    0xBDB, 0xBFF, 0xC33, 0xC51, 0xC5F, 0xC66, 0xC88, 0xCB5, 0xCCF, 0xD02, 0xD1C, 0xD74,
+    0xDAD, 0xDDD, 0xDF8, 0xE38, 0xE65, 0xE80, 0xEB0, 0xED2, 0xEF0, 0xF29, 0xF59, 0xF75,
+    0xF8F, 0xFB3, 0xFD5, 0xFF3, 0x101D, 0x1041, 0x107A, 0x1098, 0x10C8, 0x10F0, 0x1124, 0x1132,
+    0x1150, 0x118C, 0x11C5, 0x11E9, 0x1222, 0x124C, 0x128E, 0x12A6, 0x12C8, 0x12E8, 0x12FE, 0x1325,
+    0x133D, 0x1351, 0x138A, 0x13C3, 0x13C8, 0x13DA, 0x13F0, 0x1412, 0x1469, 0x14BD, 0x1514, 0x1532,
+    0x158A, 0x15E2, 0x163A, 0x1692, 0x16EA, 0x1742, 0x179C, 0x17E8, 0x1834, 0x1880, 0x18CC, 0x1918,
+    0x1950, 0x1988, 0x19C0, 0x19F8, 0x1A37, 0x1A9B, 0x1AEB, 0x1B3B, 0x1B8B, 0x1BDB, 0x1C2B, 0x1C45,
+    0x1C8A, 0x1CE2, 0x1D3A, 0x1D92, 0x1DEA, 0x1E20, 0x1E80, 0x1EC4, 0x1F08, 0x1F3B, 0x1F6E, 0x1FA1,
+    0x1FE5, 0x2011, 0x2038, 0x206C, 0x20A4, 0x20CE, 0x20F8, 0x2118, 0x2144, 0x2162, 0x2183, 0x21B0,
+    0x21E3, 0x221F, 0x225B, 0x2288, 0x22B8, 0x22E8, 0x2302, 0x233B, 0x237F, 0x23C3, 0x23F6, 0x2429,
+    0x2471, 0x24BD, 0x2515, 0x2548, 0x2594, 0x25CC, 0x2618, 0x2654, 0x26A8, 0x26EA, 0x2736, 0x275D,
+    0x27A9, 0x27E5, 0x2829, 0x2855, 0x288B, 0x28B5, 0x28E8, 0x2909, 0x296D, 0x29B1, 0x2A15, 0x2A59,
+    0x2AAD, 0x2ADB, 0x2B2B, 0x2B58, 0x2B98, 0x2BD0, 0x2C14, 0x2C50, 0x2C9C, 0x2CC6, 0x2D1E, 0x2D62,
+    0x2DBA, 0x2DFE, 0x2E4E, 0x2E96, 0x2ED2, 0x2F1A, 0x2F47, 0x2F8F, 0x2FCB, 0x2FF1, 0x3030, 0x303E,
+    0x305A, 0x3068, 0x3076, 0x3084, 0x3092, 0x30AC, 0x30C6, 0x30DE, 0x30F6, 0x311D, 0x314A, 0x3151,
+    0x3169, 0x317D, 0x318F, 0x31A7, 0x31BF, 0x31D7, 0x31EF, 0x3205, 0x321B, 0x3233, 0x324B, 0x325D,
+    0x3275, 0x3289, 0x32A1, 0x32B9, 0x32D1, 0x32E7, 0x32FD, 0x3315, 0x3339, 0x335D, 0x3399, 0x33BD,
+    0x33E1, 0x3405, 0x3431, 0x3485, 0x34DC, 0x3533, 0x358A, 0x35E4, 0x3638, 0x365C, 0x3686, 0x36AA,
+    0x36D4, 0x36F8, 0x371C, 0x3740, 0x3770, 0x3794, 0x37C4, 0x37E8, 0x3815, 0x384E, 0x38AA, 0x38F2,
+    0x393E, 0x3962, 0x39A2, 0x39BC, 0x39E3, 0x3A0A, 0x3A2E, 0x3A52, 0x3A76, 0x3A9A, 0x3ABE, 0x3AE2,
+    0x3B06, 0x3B2A, 0x3B4E, 0x3B72, 0x3B96, 0x3BBA, 0x3BDE, 0x3C02, 0x3C26, 0x3C4A, 0x3C6E, 0x3C92,
+    0x3CB6, 0x3CDA, 0x3CFE
+};
+
+
 const SimpleGFXfont Bookerly28BoldItalic PROGMEM = {Bookerly28BoldItalicBitmaps, Bookerly28BoldItalicBitmaps_lsb, Bookerly28BoldItalicBitmaps_msb, Bookerly28BoldItalicGlyphs,
-    315, 30};
+    315, 30,
+    nullptr, 0, FontStyle::REGULAR, Bookerly28BoldItalicGlyphIndexLatin1, Bookerly28BoldItalicGlyphRanges, 13,
+    Bookerly28BoldItalicBitmapsCol, Bookerly28BoldItalicBitmapsCol_lsb, Bookerly28BoldItalicBitmapsCol_msb, Bookerly28BoldItalicColOffsets};
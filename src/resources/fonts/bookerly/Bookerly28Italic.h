@@ -5529,5 +5529,4947 @@ const SimpleGFXglyph Bookerly28ItalicGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly28ItalicGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly28ItalicGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly28ItalicBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xC0, 0xC7, 0xF0, 0x01, 0xC7,
+    0x80, 0x1F, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xFF, 0xFF, 0xE0, 0x7F, 0x80, 0x7F, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x7F, 0x80, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF9, 0xE7, 0xFF, 0xF9, 0xE4, 0x7F,
+    0xF9, 0xC0, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x27, 0xFF, 0x01, 0xE7, 0xFF,
+    0x39, 0xE7, 0xFF, 0xF9, 0xE0, 0x7F, 0xF9, 0x80, 0x7F, 0xF0, 0x03, 0xFF,
+    0x80, 0x67, 0xFF, 0x01, 0xE7, 0xFF, 0xF9, 0xE7, 0xFF, 0xF9, 0xEF, 0xFF,
+    0xFB, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xF1, 0xCF, 0xFC, 0x07, 0xF8, 0x0F,
+    0xF8, 0x03, 0xE0, 0x1F, 0xF9, 0xE0, 0x01, 0xFF, 0xF3, 0xE0, 0x39, 0xFF,
+    0xF0, 0x00, 0xF9, 0xFF, 0xE0, 0x18, 0xF1, 0xFF, 0x81, 0xF8, 0x03, 0xFF,
+    0x91, 0xFC, 0x03, 0xFF, 0xF8, 0x7E, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xE7, 0xFF,
+    0xC7, 0xF7, 0xFF, 0xCF, 0xE7, 0xE3, 0xDF, 0xE7, 0xC3, 0xCF, 0xCF, 0x8F,
+    0xC0, 0x0E, 0x1F, 0xC0, 0x3C, 0x7F, 0xF0, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x3F, 0xBF, 0xFC, 0x78, 0x0F,
+    0xF0, 0xF0, 0x07, 0xE3, 0xE3, 0xE7, 0x87, 0xCF, 0xF7, 0x8F, 0xCF, 0xE7,
+    0xFF, 0xDF, 0xE7, 0xFF, 0xCF, 0x8F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE3, 0x87,
+    0xFF, 0xCF, 0xC7, 0xFF, 0xDF, 0xE7, 0xF8, 0x0F, 0xE7, 0xE0, 0x03, 0xE7,
+    0xC0, 0x00, 0xE7, 0x8F, 0x70, 0x67, 0x9E, 0x7C, 0x07, 0x9C, 0xFE, 0x0F,
+    0x98, 0xE7, 0x0F, 0x81, 0xE7, 0x07, 0xC3, 0xC6, 0x07, 0xFF, 0xC0, 0x63,
+    0xFF, 0xC0, 0xE3, 0xFF, 0xCF, 0xF3, 0xFF, 0x9F, 0xF3, 0xFF, 0x9F, 0xF3,
+    0xFF, 0x1F, 0xFB, 0xFE, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF,
+    // 0x27 '''
+    0xFF, 0xFF, 0xE0, 0x7F, 0x80, 0x7F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xFE, 0x0F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFE, 0x1F, 0xF8, 0xFF, 0xFF, 0x8F,
+    0xF1, 0xFF, 0xFF, 0xCF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x3F, 0x9F, 0xFF, 0xFE, 0x7F,
+    0x8F, 0xFF, 0xF8, 0xFF, 0xC3, 0xFF, 0xE1, 0xFF, 0xE0, 0xFF, 0x83, 0xFF,
+    0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xCC, 0xFF, 0xC4, 0xFF, 0xE0, 0xFF, 0xF1, 0xFF, 0x80, 0x3F,
+    0x82, 0x3F, 0xF3, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0x00, 0x07, 0x80, 0x0F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFC, 0xFF, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF,
+    0xDF, 0xFF,
+    // 0x2D '-'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xFF,
+    // 0x2E '.'
+    0xFF, 0x8F, 0x8F, 0x8F, 0x9F,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+    0xF0, 0x3F, 0x8F, 0xE1, 0xFF, 0xCF, 0xC7, 0xFF, 0xCF, 0x8F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0x8F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFE, 0x3F,
+    0x8F, 0xF8, 0x3F, 0x83, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0xFF,
+    0xF8, 0x7F, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xEF, 0xFF, 0xCF,
+    0xCF, 0xFF, 0x0F, 0xCF, 0xF0, 0x0F, 0xCE, 0x00, 0x0F, 0x80, 0x00, 0xCF,
+    0x80, 0x1F, 0xCF, 0x83, 0xFF, 0xCF, 0xBF, 0xFF, 0xFF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFE, 0x0F,
+    0xE1, 0xFE, 0x0F, 0xC3, 0xFC, 0x0F, 0xC7, 0xF8, 0x8F, 0x8F, 0xF1, 0x8F,
+    0x9F, 0xE3, 0x8F, 0x9F, 0xC3, 0x8F, 0x9F, 0x87, 0x8F, 0x9F, 0x0F, 0x8F,
+    0x80, 0x1F, 0x8F, 0x80, 0x3F, 0x9F, 0xC0, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xE3, 0xFF, 0xCF, 0xC3, 0xCF, 0xCF, 0x8F, 0xCF, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x9F, 0x8F, 0x8F, 0x9F, 0x0F, 0x1F, 0x9F, 0x06, 0x1F, 0x9E, 0x00, 0x3F,
+    0x80, 0x40, 0x7F, 0x80, 0xE1, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF,
+    0xFF, 0x89, 0xFF, 0xFF, 0x19, 0xFF, 0xFE, 0x39, 0xFF, 0xFC, 0x79, 0xFF,
+    0xF8, 0xF9, 0xFF, 0xF1, 0xF8, 0x0F, 0xE3, 0xE0, 0x0F, 0xC6, 0x00, 0x0F,
+    0x80, 0x00, 0xFF, 0x80, 0x39, 0xFF, 0x83, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0xCF,
+    0xF0, 0x7F, 0xCF, 0x80, 0x7F, 0x8F, 0x82, 0x3F, 0x8F, 0x9E, 0x3F, 0x1F,
+    0x9E, 0x1E, 0x1F, 0x9F, 0x00, 0x3F, 0x9F, 0x00, 0x7F, 0x9F, 0x80, 0xFF,
+    0x9F, 0xF7, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
+    0xF8, 0x3F, 0x8F, 0xF0, 0x3F, 0xCF, 0xE1, 0x3F, 0xCF, 0xE3, 0x3F, 0xCF,
+    0xC7, 0x3F, 0xCF, 0xCF, 0x1F, 0x8F, 0x8F, 0x0E, 0x1F, 0x9F, 0x80, 0x3F,
+    0x9F, 0xC0, 0x7F, 0x9F, 0xE1, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x0F, 0x83, 0xFE, 0x07, 0x87, 0xF8, 0x1F,
+    0x9F, 0xF0, 0x7F, 0x9F, 0xC1, 0xFF, 0x9F, 0x87, 0xFF, 0x9F, 0x0F, 0xFF,
+    0x9C, 0x3F, 0xFF, 0x98, 0x7F, 0xFF, 0x90, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFE, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xF0, 0xE1, 0x0F,
+    0xE0, 0x67, 0xCF, 0xC0, 0x0F, 0xCF, 0x8E, 0x0F, 0xCF, 0x9F, 0x1F, 0xCF,
+    0x9F, 0x8F, 0xCF, 0x9F, 0x07, 0x8F, 0x9F, 0x00, 0x1F, 0x9E, 0x60, 0x3F,
+    0x80, 0x70, 0x7F, 0x80, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xF8, 0x1F, 0xCF,
+    0xE0, 0x0F, 0xCF, 0xC0, 0x0F, 0x8F, 0x87, 0xC7, 0x8F, 0x8F, 0xC7, 0x1F,
+    0x9F, 0xE6, 0x1F, 0x9F, 0xE4, 0x3F, 0x9F, 0xE0, 0x7F, 0x9F, 0xC0, 0xFF,
+    0x87, 0x81, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xF1, 0xCF, 0xF1, 0x87, 0xF3, 0x87, 0xFF,
+    0x8F, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xF0, 0x3F, 0xCF, 0xF0, 0xFF, 0x87, 0xFB, 0xFF, 0x87, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xE2, 0x3F,
+    0xE6, 0x3F, 0xC7, 0x1F, 0xCF, 0x1F, 0x8F, 0x8F, 0x9F, 0xCF, 0x1F, 0xC7,
+    0xFF, 0xFF,
+    // 0x3D '='
+    0xFF, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+    0x39,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x9F, 0xC7, 0x8F, 0x8F, 0xCF, 0x8F, 0xC7, 0x9F,
+    0xE7, 0x1F, 0xE3, 0x3F, 0xF2, 0x3F, 0xF0, 0x7F, 0xF8, 0x7F, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xE7, 0xCF, 0xF1, 0xC7, 0x8F, 0xE0, 0xC7, 0x8F, 0xC0, 0xCF,
+    0x8F, 0x8C, 0xFF, 0x8F, 0x1D, 0xFF, 0x86, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFE, 0x0F, 0xC1, 0xFF, 0xFC, 0x3F, 0xF0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF1, 0xFF, 0xFC, 0x7F, 0xE3, 0xF8, 0x7C, 0x7F, 0xE7, 0xC0, 0x1E, 0x7F,
+    0xC7, 0x80, 0x1E, 0x7F, 0xCF, 0x0F, 0x9E, 0x7F, 0x8E, 0x3F, 0x9E, 0x7F,
+    0x9E, 0x7F, 0x3E, 0x7F, 0x9E, 0x7E, 0x7E, 0x7F, 0x9E, 0x7C, 0xFE, 0x7F,
+    0x9E, 0x20, 0x1C, 0xFF, 0x9E, 0x00, 0x1C, 0xFF, 0x9E, 0x0F, 0x99, 0xFF,
+    0x9E, 0x7F, 0x9F, 0xFF, 0x8F, 0xFF, 0x3F, 0xFF, 0xCF, 0xFE, 0x3F, 0xFF,
+    0xC7, 0xFC, 0x7F, 0xFF, 0xE1, 0xE0, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xCF, 0xFF, 0xC1, 0xEF,
+    0xFF, 0x03, 0xFF, 0xFE, 0x13, 0xFF, 0xF8, 0x73, 0xFF, 0xE1, 0xF3, 0xFF,
+    0x87, 0xF3, 0xFF, 0x8F, 0xF3, 0xEF, 0x00, 0x33, 0xCF, 0x80, 0x00, 0x4F,
+    0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xF0, 0x0F, 0x9E, 0x00, 0x0F, 0x80, 0x01, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF,
+    0x1F, 0x0F, 0x9F, 0x9E, 0x06, 0x1F, 0x80, 0x40, 0x3F, 0xC0, 0xE0, 0x7F,
+    0xE1, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x7C, 0x1F,
+    0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0x8F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x9F, 0x1F, 0xFF, 0x3F, 0x81, 0xFF, 0x7F, 0x83, 0xFF, 0xFF,
+    0xDF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xF0, 0x0F, 0x9E, 0x00, 0x0F, 0x80, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0x9F, 0x1F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x8F, 0xFC, 0x3F,
+    0x87, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x0F, 0xCF,
+    0x03, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x0F, 0x1F, 0xFC, 0x1F, 0x07, 0xFE, 0xFF,
+    0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x0F, 0xCF,
+    0x03, 0x9F, 0xCF, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF,
+    0x1F, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xF0, 0x7C, 0x1F,
+    0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0x8F, 0x8F, 0xFF, 0x8F, 0x9F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xEF, 0xCF, 0x1F, 0xE7, 0xCF,
+    0x1F, 0xE7, 0x8F, 0x1F, 0xE0, 0x1F, 0x83, 0xE0, 0x1F, 0x83, 0xE0, 0xFF,
+    0x87, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0x9F, 0xFF, 0x1F, 0x9F, 0xFF, 0x3F, 0x9F, 0xFF, 0xBF, 0x9F, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0x0F,
+    0xBF, 0x80, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xBF, 0xF8, 0x03, 0xFF,
+    0x3F, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0x8F, 0xEF, 0x1F, 0x07, 0xFF, 0x3E, 0x01, 0xFF, 0xBC, 0x60, 0xFF,
+    0xF8, 0xF8, 0x3F, 0xF1, 0xFC, 0x1F, 0xB3, 0xFE, 0x0F, 0x07, 0xFF, 0x0F,
+    0x07, 0xFF, 0x8F, 0x0F, 0xFF, 0xCF, 0x1F, 0xFF, 0xEF, 0x3F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x7F,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x0F, 0xBF, 0x00, 0xCF, 0x30, 0x07, 0xCF,
+    0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xEF, 0xE0, 0xFF, 0xCF,
+    0x83, 0xFF, 0xCF, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x1F, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xE0, 0x0F, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xCF, 0x00, 0x7F, 0xEF,
+    0x81, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x0F,
+    0xBF, 0xE0, 0x0F, 0x3C, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x7E, 0x1F,
+    0xE1, 0xFF, 0x8F, 0xC7, 0xFF, 0xCF, 0x8F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0x8F, 0x1F, 0xFF, 0x8F,
+    0x1F, 0xFF, 0x1F, 0x1F, 0xFE, 0x3F, 0x8F, 0xF8, 0x3F, 0x81, 0x80, 0x7F,
+    0xC0, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xF0, 0x0F, 0x9E, 0x00, 0x0F, 0x80, 0x00, 0xCF, 0x00, 0x0F, 0xCF,
+    0x03, 0xCF, 0xCF, 0x3F, 0xCF, 0xFF, 0x3F, 0xCF, 0xFF, 0x3F, 0xCF, 0xFF,
+    0x1F, 0x8F, 0xFF, 0x9F, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xF0, 0x7E, 0x1F, 0xFF, 0xE1, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF,
+    0x8F, 0xFF, 0xC3, 0xFF, 0x9F, 0xFF, 0xC3, 0xFF, 0x9F, 0xFF, 0xC1, 0xFF,
+    0x1F, 0xFF, 0xC9, 0xFF, 0x1F, 0xFF, 0x88, 0xFF, 0x1F, 0xFF, 0x9C, 0xFF,
+    0x1F, 0xFF, 0x1C, 0x7F, 0x1F, 0xFE, 0x3C, 0x7F, 0x8F, 0xF8, 0x7E, 0x7F,
+    0x80, 0x00, 0xFE, 0x3F, 0xC0, 0x01, 0xFE, 0x3F, 0xF0, 0x07, 0xFE, 0x3F,
+    0xFE, 0x7F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xF0, 0x0F, 0x9E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x0F, 0xCF,
+    0x03, 0xCF, 0xFF, 0x3F, 0xC7, 0xFF, 0x3F, 0x81, 0xFF, 0x3F, 0x80, 0x7F,
+    0x1F, 0x1C, 0x3F, 0x8E, 0x3E, 0x1F, 0x80, 0x3F, 0x0F, 0xC0, 0x7F, 0x8F,
+    0xE1, 0xFF, 0xCF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    // 0x53 'S'
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x1F, 0xF9, 0xFC, 0x0F, 0xE0, 0x7F, 0x8F,
+    0xC0, 0x3F, 0xCF, 0x8C, 0x1F, 0xCF, 0x9E, 0x1F, 0xCF, 0x1F, 0x0F, 0xCF,
+    0x3F, 0x8F, 0xCF, 0x3F, 0xC7, 0x8F, 0x1F, 0xC0, 0x1F, 0x03, 0xE0, 0x3F,
+    0x83, 0xF0, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xE3, 0xFF, 0xFF, 0x83, 0xFF, 0xEF, 0x0F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF,
+    0x1F, 0xFC, 0x0F, 0x1F, 0xC0, 0x0F, 0x18, 0x00, 0x0F, 0x00, 0x03, 0xCF,
+    0x00, 0x7F, 0xCF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+    0x00, 0x7F, 0x8F, 0x0F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF, 0x3F, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xFE, 0x3F, 0xBF, 0xE0, 0x7F, 0x1C, 0x00, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0x1F, 0x1E, 0x00, 0x0F, 0x3F, 0xFE, 0x0F, 0xBF, 0xFE, 0x0F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xBC, 0x1F, 0xFF, 0x10, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xBF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x3F, 0xFE, 0x0F, 0x3F, 0xF8, 0x3F,
+    0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0F,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF,
+    0xFF, 0x83, 0xFF, 0xBC, 0x0F, 0xFF, 0x10, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0x8F, 0xBF, 0xFF, 0x0F, 0x1F, 0xFE, 0x0F, 0x1F, 0xFC, 0x4F,
+    0x07, 0xF0, 0xEF, 0x01, 0xE3, 0xFF, 0x00, 0x47, 0xFF, 0x38, 0x0F, 0xFF,
+    0xBF, 0x07, 0xEF, 0xFE, 0x01, 0xCF, 0xFC, 0x60, 0x4F, 0xF8, 0xF8, 0x0F,
+    0x31, 0xFE, 0x0F, 0x03, 0xFF, 0x8F, 0x07, 0xFF, 0xCF, 0x0F, 0xFF, 0xCF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xEF, 0x03, 0xFF, 0xCF,
+    0x00, 0xFF, 0xCF, 0x00, 0x1F, 0x0F, 0x18, 0x00, 0x0F, 0x3F, 0x00, 0x0F,
+    0xFF, 0xC1, 0xCF, 0xFF, 0x0F, 0xCF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0x30, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xE3, 0xFE, 0x0F,
+    0x83, 0xF8, 0x0F, 0x0F, 0xF0, 0xCF, 0x1F, 0xE1, 0xCF, 0x1F, 0xC3, 0xCF,
+    0x1F, 0x87, 0xCF, 0x1E, 0x1F, 0xCF, 0x1C, 0x3F, 0xCF, 0x18, 0x7F, 0xCF,
+    0x10, 0xFF, 0x8F, 0x01, 0xFE, 0x0F, 0x07, 0xFC, 0x1F, 0x0F, 0xFC, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xE0, 0x07, 0xBF, 0xFE, 0x00, 0x7F, 0xBF, 0xC0, 0x07, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
+    0x3F, 0x00, 0x1F, 0xFF, 0x30, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x03, 0xFF,
+    0x0F, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFC, 0x07, 0xFF, 0x87,
+    0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x60 '`'
+    0x9F, 0x8F, 0x87, 0xE3, 0xF1, 0xFF,
+    // 0x61 'a'
+    0xFF, 0x03, 0xF8, 0x01, 0xF0, 0x01, 0xE1, 0xF1, 0xC7, 0xF9, 0x8F, 0xF1,
+    0x9F, 0xF3, 0x1F, 0xE7, 0x1F, 0x8F, 0x9E, 0x01, 0x80, 0x01, 0x80, 0x39,
+    0x83, 0xF1, 0xBF, 0xE3, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xBF, 0xFE, 0x03, 0x9F, 0xC0, 0x03,
+    0x9C, 0x00, 0x33, 0x00, 0x01, 0xF3, 0x00, 0xC7, 0xF3, 0x0F, 0x8F, 0xF3,
+    0xFF, 0x1F, 0xF3, 0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0x87, 0xFE, 0x18, 0x0F,
+    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x01, 0xC3, 0xF1, 0x8F, 0xF9, 0x9F, 0xF9,
+    0x9F, 0xF9, 0x1F, 0xF3, 0x1F, 0xF3, 0x8F, 0xE7, 0x9F, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xE3,
+    0xFF, 0x8F, 0xF3, 0xFF, 0x1F, 0xE3, 0xFF, 0x3F, 0xE7, 0xFE, 0x3F, 0xCF,
+    0xFE, 0x3F, 0x1F, 0xBF, 0x3C, 0x03, 0x9F, 0x00, 0x03, 0x98, 0x00, 0x73,
+    0x00, 0x07, 0xE3, 0x00, 0xFF, 0xC7, 0x8F, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x01, 0xC3, 0x31, 0xCE, 0x79, 0x9E, 0x79,
+    0xBC, 0x79, 0x3C, 0xF1, 0x10, 0xF3, 0x81, 0xE7, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x3F, 0xF0, 0x1F, 0xFF, 0x3F, 0x00, 0x3F,
+    0xFF, 0x20, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xFF, 0x87, 0x3F, 0xFF, 0xFF, 0x9F, 0x3F, 0xFF, 0xFF,
+    0x9F, 0x3F, 0xFF, 0xFF, 0x1F, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x47,
+    0xFF, 0xFC, 0xE7, 0xF0, 0x71, 0xE3, 0xE0, 0x21, 0xE3, 0xC0, 0x01, 0xE3,
+    0x8F, 0x11, 0xE3, 0x9F, 0x39, 0xE7, 0x3F, 0x38, 0xE7, 0x3E, 0x7C, 0x47,
+    0x18, 0x7C, 0x0F, 0x00, 0xFE, 0x0F, 0x81, 0xFF, 0x3F, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xBF, 0xFC, 0x03, 0x9F, 0xC0, 0x03,
+    0x9C, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0xE3, 0xFF, 0x0F, 0xCF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x03, 0xFE, 0x30, 0x03,
+    0xFE, 0x00, 0x23, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0xFF, 0x38, 0x03, 0xFF, 0x00, 0x03,
+    0xCE, 0x00, 0xE3, 0x8F, 0x0F, 0xC7, 0x0F, 0xFF, 0xCF, 0x9F, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x3F, 0xC0, 0x7F, 0xFF, 0x38, 0x01, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0x8E, 0x00, 0xFF, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x03, 0x9F, 0xF0, 0x03, 0x9E, 0x00, 0x1F,
+    0x00, 0x00, 0xFF, 0x00, 0x0C, 0x3F, 0x03, 0x9C, 0x1F, 0xFF, 0x3C, 0x07,
+    0xFF, 0x39, 0xC7, 0xFE, 0x71, 0xE3, 0xFE, 0x03, 0xE3, 0xFE, 0x07, 0xF3,
+    0xFF, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0x03, 0x9F, 0xC0, 0x03, 0x9C, 0x00, 0x23,
+    0x00, 0x03, 0xE7, 0x00, 0x7F, 0xC7, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xBF, 0xFD, 0x9F, 0xC1, 0x98, 0x01, 0x00, 0x07, 0x00, 0x3F, 0x98, 0xFF,
+    0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFD, 0x9F, 0xC1, 0x1C, 0x01, 0x00, 0x07,
+    0x80, 0x3F, 0xF0, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x9F, 0xC1,
+    0x1C, 0x01, 0x00, 0x01, 0x80, 0xF1, 0xC7, 0xF3, 0xFF, 0xE7,
+    // 0x6E 'n'
+    0xBF, 0xFD, 0x9F, 0xC1, 0x98, 0x01, 0x00, 0x07, 0x00, 0x3F, 0x98, 0xFF,
+    0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x9F, 0xE1, 0x1E, 0x01, 0x00, 0x01,
+    0x00, 0x31, 0x83, 0xF3, 0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x6F 'o'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x01, 0xC1, 0xF1, 0x87, 0xF9, 0x8F, 0xF9,
+    0x9F, 0xF9, 0x1F, 0xF1, 0x1F, 0xE3, 0x1F, 0xC3, 0x80, 0x07, 0x80, 0x1F,
+    0xE0, 0x7F, 0xFF, 0xFF,
+    // 0x70 'p'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xBF, 0xFE, 0x07,
+    0x9F, 0xC0, 0x07, 0x9C, 0x00, 0x67, 0x00, 0x01, 0xF7, 0x00, 0x79, 0xF7,
+    0xB1, 0xF9, 0xFF, 0xE7, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0x9F, 0xF1, 0xFF,
+    0x9F, 0xE3, 0xFF, 0x1F, 0x87, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF,
+    0xC0, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFF, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xC1, 0xF1, 0xFF,
+    0x87, 0xF9, 0xF7, 0x9F, 0xF1, 0xF7, 0x1F, 0xF3, 0xE7, 0x1F, 0xE7, 0xC7,
+    0x1F, 0x88, 0x07, 0x9E, 0x00, 0x07, 0x80, 0x01, 0xE7, 0x80, 0x3F, 0xF7,
+    0x83, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xBF, 0xFF, 0x9F, 0xE1, 0x9C, 0x01, 0x00, 0x03, 0x00, 0x3F, 0x90, 0xFF,
+    0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xF3, 0xFF, 0xE1, 0xF3, 0xF1, 0xC1, 0xF9, 0x80, 0xF9, 0x98, 0x79,
+    0x9C, 0x39, 0x1E, 0x03, 0x1F, 0x03, 0x1F, 0x8F, 0x9F, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xF8, 0x1F, 0xF9, 0x00, 0x1F,
+    0xF0, 0x00, 0x1F, 0xC0, 0x1F, 0x9F, 0x81, 0xFF, 0x1F, 0xB9, 0xFF, 0x3F,
+    0xF9, 0xFE, 0x3F, 0xF9, 0xFE, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xFF, 0xFF, 0x9F, 0x83, 0x9C, 0x01, 0x00, 0x01, 0x00, 0xF9, 0x87, 0xF9,
+    0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFC, 0x01, 0xC0, 0x01,
+    0x80, 0x79, 0x87, 0xF3, 0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x76 'v'
+    0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x07, 0xFF, 0x80, 0x1F, 0xC0, 0x01,
+    0xFE, 0x01, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x0F, 0xBC, 0x3F, 0x00, 0x7F,
+    0x01, 0xFF, 0x8F, 0xFF,
+    // 0x77 'w'
+    0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x07, 0xFF, 0x80, 0x3F, 0xC0, 0x01,
+    0xFC, 0x01, 0xFF, 0xF3, 0xFF, 0xC7, 0xFF, 0x0F, 0x08, 0x3F, 0x00, 0xFF,
+    0x80, 0x01, 0xF0, 0x01, 0xFF, 0xE1, 0xFF, 0xE3, 0xFF, 0x87, 0xBE, 0x1F,
+    0x00, 0x3F, 0x00, 0xFF, 0x87, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFF, 0xFF, 0xF1, 0xDF, 0xF9, 0x9F, 0xF9, 0x9F, 0xF1, 0x1F, 0xE3,
+    0x07, 0x8F, 0x80, 0x1F, 0xE0, 0x3F, 0xF8, 0x07, 0xF1, 0x01, 0xE3, 0xE1,
+    0xC7, 0xF9, 0x9F, 0xF9, 0x1F, 0xF3, 0x1F, 0xF3, 0x9F, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE7,
+    0x9F, 0xFF, 0xE7, 0x9F, 0xFF, 0xC7, 0x0F, 0xFF, 0xCF, 0x01, 0xFF, 0x1F,
+    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFF, 0xC8, 0xFF, 0xFF, 0xF1, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xF9, 0xFF, 0xF1, 0x87, 0xE3, 0x8F, 0x83, 0x1F, 0x13, 0x9E, 0x31,
+    0x9C, 0x71, 0x88, 0xF9, 0xC1, 0xF9, 0xC3, 0xF1, 0x87, 0xE1, 0x0F, 0xE3,
+    0x9F, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x1F, 0xFF, 0xF9, 0xC0, 0x0F,
+    0xFF, 0xF0, 0x03, 0x8F, 0xFC, 0x04, 0x1F, 0xCF, 0xE0, 0x07, 0xFF, 0xDF,
+    0xC0, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE0, 0x1F, 0x9F, 0xFF, 0x00, 0x3F,
+    0x9F, 0x82, 0x01, 0xFF, 0x9E, 0x00, 0xFF, 0xFF, 0x80, 0x11, 0xFF, 0xFF,
+    0x80, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xEF, 0x87, 0x8F, 0x1F, 0x1F, 0x9F, 0x8F, 0xCF, 0xC7, 0xC7, 0xC7, 0x8F,
+    0x9F, 0xFF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x07, 0xFF, 0xF0, 0x07,
+    0xDF, 0x00, 0x1F, 0x0C, 0x01, 0xFF, 0x0C, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0x0F, 0x87, 0x9F, 0xFE, 0x3F, 0xC0, 0x1F, 0xFE, 0x7F, 0x80, 0x3F,
+    0xFC, 0x78, 0x07, 0xFF, 0xFC, 0x00, 0xE7, 0xFF, 0xE0, 0x0F, 0xC7, 0xFF,
+    0x80, 0x7F, 0xCF, 0xFF, 0x8C, 0x7F, 0x8F, 0xFF, 0xFC, 0x7F, 0x9F, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xDF, 0x8F,
+    0xFF, 0xCE, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xCF,
+    0xF0, 0x0F, 0xCF, 0xC0, 0xCF, 0xCF, 0xC7, 0xCF, 0xCF, 0x9F, 0xCF, 0xCF,
+    0x9F, 0xCF, 0xCF, 0x9F, 0xCF, 0x8F, 0x9F, 0xFF, 0x8F, 0x83, 0xFF, 0x9F,
+    0x83, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xBF, 0xCF, 0x1C, 0x1F, 0x80, 0x1F, 0xC0, 0x0F,
+    0xC7, 0x8F, 0xCF, 0xCF, 0x9F, 0xCF, 0x9F, 0x8F, 0x9F, 0x9F, 0x8E, 0x1F,
+    0xC0, 0x0F, 0xC0, 0xC7, 0x9F, 0xEF, 0x1F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xBF, 0xFF, 0x8F, 0x93, 0xEF, 0x81, 0x93, 0xCF,
+    0x80, 0x13, 0xCF, 0x90, 0x00, 0x0F, 0x9E, 0x00, 0x0F, 0xBF, 0xC0, 0x4F,
+    0xFF, 0x83, 0xCF, 0xFF, 0x13, 0xCF, 0xFC, 0x13, 0xFF, 0x98, 0x13, 0xFF,
+    0x91, 0x93, 0xFF, 0x83, 0x9F, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0xC7, 0xFC, 0x1F, 0x83, 0xF0, 0x0F, 0xC3, 0xE3, 0xC7, 0xF3,
+    0xC0, 0xE3, 0xF3, 0xCC, 0x71, 0xF3, 0x9E, 0x78, 0xF3, 0x9F, 0x3C, 0x63,
+    0x9F, 0x9E, 0x07, 0x9F, 0x8F, 0x8F, 0x83, 0xC0, 0x1F, 0xC7, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xC7, 0xFF, 0x3F, 0xCF, 0xFF, 0x9F, 0x9E, 0x03, 0xCF, 0x9C, 0x01, 0xCF,
+    0x38, 0xF9, 0xCF, 0x39, 0xFC, 0xEF, 0x3B, 0xFC, 0xE7, 0x3B, 0xFC, 0xE7,
+    0x39, 0xFC, 0xEF, 0x38, 0xFC, 0xCF, 0x9F, 0xFD, 0xCF, 0x9F, 0xFF, 0xCF,
+    0xCF, 0xFF, 0x9F, 0xC7, 0xFF, 0x3F, 0xE1, 0xFC, 0x7F, 0xF8, 0x00, 0xFF,
+    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xF7, 0xF0, 0x67, 0xC0, 0x27, 0x8F, 0x27, 0x9F, 0x67, 0x3E, 0x67,
+    0x38, 0x67, 0x80, 0x27, 0x07, 0x27, 0x3E, 0x7F, 0xFF, 0xFF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0xCF, 0x9F,
+    0x9F, 0xFF, 0xB8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC7, 0x1F, 0x8F, 0x9F,
+    0x9F, 0xFF, 0xBF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xF0, 0x1F, 0xE1, 0x87, 0xCF, 0xE7, 0x9F, 0xF3, 0xB7, 0xD9,
+    0x30, 0x19, 0x36, 0x5D, 0x36, 0x7D, 0x30, 0x39, 0xB9, 0x99, 0x9F, 0xDB,
+    0xCF, 0xF3, 0xC7, 0xC7, 0xF0, 0x0F, 0xFE, 0xFF,
+    // 0xB0 '°'
+    0xFF, 0xFF, 0xE0, 0xFF, 0x80, 0x7F, 0x9E, 0x7F, 0x9E, 0x7F, 0x9F, 0x3F,
+    0x9E, 0x7F, 0x8C, 0x7F, 0x80, 0xFF, 0xE1, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFC, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0x80, 0x06, 0x7F, 0x80, 0x06, 0x7F,
+    0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFD, 0xFE, 0x7F,
+    // 0xB2 '²'
+    0xFF, 0xF7, 0xFF, 0xE3, 0xE7, 0xC3, 0xC7, 0x83, 0x8F, 0x13, 0x9E, 0x33,
+    0x9C, 0x73, 0x88, 0xF3, 0x81, 0xF7, 0xC3, 0xFF, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xF7, 0xFF, 0xF3, 0xEF, 0xF3, 0xCE, 0xF3, 0x9C, 0xF3, 0x9C, 0xE7,
+    0x98, 0x07, 0x80, 0x0F, 0xC3, 0x1F, 0xFF, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0x07,
+    0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xF0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x01, 0xF9, 0xFF, 0x3F, 0xF9, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0x1F, 0xFC,
+    0xF0, 0x0F, 0xFC, 0xE0, 0x07, 0xF9, 0xC0, 0x07, 0xE1, 0x80, 0x04, 0x01,
+    0x80, 0x00, 0x13, 0x80, 0x03, 0xE3, 0x80, 0x7E, 0x07, 0x8F, 0xC0, 0x1F,
+    0x18, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xCF, 0x8F, 0x0F, 0x9F, 0xFF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xCF, 0xF3, 0xCF, 0x03, 0xC0, 0x03, 0x80, 0x33,
+    0x83, 0xF7, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xE0, 0x67, 0xC0, 0x27, 0x8F, 0x27, 0x9F, 0x27,
+    0x3F, 0x27, 0x3C, 0x67, 0x80, 0xE7, 0x81, 0xFF, 0xFF, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x1F, 0x9E, 0x3F, 0x84, 0x7F, 0xC0, 0xFF,
+    0xE1, 0xDF, 0xFB, 0x9F, 0xBF, 0x3F, 0x8E, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0x83, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xFF, 0xC3, 0xFB, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFE, 0x3F, 0xBF, 0xF8, 0x7E, 0x3F, 0xF1, 0xFC, 0x3F, 0xC3, 0xF8, 0x3F,
+    0x87, 0xF1, 0x3F, 0x9F, 0xE3, 0x3F, 0xFF, 0xC7, 0x07, 0xFF, 0x88, 0x07,
+    0xFF, 0x80, 0x1F, 0xFF, 0x03, 0x3F, 0xFF, 0xFF, 0x3F,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0x83, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xF3, 0xC3, 0xFB, 0xE3, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF1, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xE7, 0xC3, 0xEF, 0xC7, 0x87, 0xC7, 0x87,
+    0x9F, 0x8F, 0x27, 0xFF, 0x9E, 0x27, 0xFF, 0x3E, 0x67, 0xFF, 0x18, 0xE7,
+    0xFF, 0x81, 0xE7, 0xFF, 0x83, 0xEF, 0xFF, 0xC7, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7, 0xF9, 0xFF, 0xC6, 0x79, 0xFF,
+    0xCE, 0x73, 0xFF, 0xCE, 0x73, 0xFF, 0xCC, 0x07, 0xFF, 0xC0, 0x07, 0xF3,
+    0xC3, 0x9F, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFC, 0x7F, 0xBF, 0xF8, 0xFE, 0x3F, 0xE1, 0xFC, 0x3F,
+    0xC7, 0xF8, 0x3F, 0x8F, 0xF1, 0x3F, 0x9F, 0xE3, 0x3F, 0xFF, 0xC7, 0x07,
+    0xFF, 0x88, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x03, 0x3F, 0xFF, 0xFF, 0x3F,
+    // 0xBF '¿'
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE3, 0x87,
+    0xFE, 0xC7, 0xC7, 0xFC, 0xCF, 0xC7, 0x8C, 0x1F, 0x87, 0x0C, 0x3F, 0x8F,
+    0x1E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xE1, 0x9F, 0xFF, 0xFF, 0x83, 0xDF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xFC, 0x27, 0xFF, 0xFF, 0xF0, 0xE7, 0xFF, 0x8F, 0xC3, 0xE7, 0xFF,
+    0x8F, 0x0F, 0xE7, 0xFF, 0xC7, 0x1F, 0xE7, 0xDF, 0xE6, 0x00, 0x67, 0x9F,
+    0xE7, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xE1, 0x9F, 0xFF, 0xFF, 0x83, 0xDF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xFC, 0x27, 0xFF, 0xFF, 0xF0, 0xE7, 0xFF, 0xFF, 0xC3, 0xE7, 0xFF,
+    0xF7, 0x0F, 0xE7, 0xFF, 0xE7, 0x1F, 0xE7, 0xDF, 0xC6, 0x00, 0x67, 0x9F,
+    0xC7, 0x00, 0x00, 0x9F, 0x8F, 0xF8, 0x00, 0x1F, 0x8F, 0xFF, 0xC0, 0x1F,
+    0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xE1, 0x9F, 0xFF, 0xFF, 0x83, 0xDF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xFC, 0x27, 0xFF, 0xF3, 0xF0, 0xE7, 0xFF, 0xE3, 0xC3, 0xE7, 0xFF,
+    0xC7, 0x0F, 0xE7, 0xFF, 0x8F, 0x1F, 0xE7, 0xDF, 0x9E, 0x00, 0x67, 0x9F,
+    0x0F, 0x00, 0x00, 0x9F, 0x8F, 0xF8, 0x00, 0x1F, 0xC3, 0xFF, 0xC0, 0x1F,
+    0xE7, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xE1, 0x9F, 0xFF, 0xFF, 0x83, 0xDF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xFC, 0x27, 0xFF, 0xC7, 0xF0, 0xE7, 0xFF, 0x87, 0xC3, 0xE7, 0xFF,
+    0x9F, 0x0F, 0xE7, 0xFF, 0x9F, 0x1F, 0xE7, 0xDF, 0x86, 0x00, 0x67, 0x9F,
+    0xC7, 0x00, 0x00, 0x9F, 0xC7, 0xF8, 0x00, 0x1F, 0x8F, 0xFF, 0xC0, 0x1F,
+    0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF, 0x07, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x4F, 0xFF, 0x8F, 0xE1, 0xCF, 0xFF, 0x0F, 0x87, 0xCF, 0xFF,
+    0x0E, 0x1F, 0xCF, 0xFF, 0xFE, 0x3F, 0xCF, 0xBF, 0xFC, 0x00, 0xCF, 0x3F,
+    0xFE, 0x00, 0x01, 0x3F, 0x8F, 0xF0, 0x00, 0x3F, 0x0F, 0xFF, 0x80, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xF0, 0xCF, 0xFF, 0xFF, 0xC1, 0xEF, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFF, 0xFE, 0x13, 0xFF, 0xFF, 0xF8, 0x73, 0xFF, 0xC3, 0xE1, 0xF3, 0xFF,
+    0x81, 0x87, 0xF3, 0xFF, 0x99, 0x8F, 0xF3, 0xEF, 0x39, 0x00, 0x33, 0xCF,
+    0x99, 0x80, 0x00, 0x4F, 0x83, 0xFC, 0x00, 0x0F, 0xC7, 0xFF, 0xE0, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF8, 0xEF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x13, 0xEF, 0xFC, 0x73, 0xCF,
+    0xB8, 0xF3, 0xCF, 0x31, 0xF0, 0x0F, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x07, 0xCF, 0x00, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x0F, 0x1F, 0xFC, 0x1F,
+    0x03, 0xFE, 0xFF, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xF0, 0x7C, 0x1F, 0xFF, 0xE3, 0xFF, 0x0F, 0xDF, 0xC7, 0xFF, 0x8F, 0xDF,
+    0x8F, 0xFF, 0x89, 0x9F, 0x9F, 0xFF, 0xC8, 0x1F, 0x9F, 0xFF, 0xC8, 0x3F,
+    0x1F, 0xFF, 0xCC, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF,
+    0x1F, 0xFF, 0x9F, 0xFF, 0x1F, 0xFF, 0x3F, 0xFF, 0x81, 0xFF, 0x7F, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xFE, 0x7C, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0x9F, 0xFE, 0x00, 0x1F, 0x9F, 0xFE, 0x07, 0x3F, 0x9F,
+    0x8E, 0x3F, 0x3F, 0x9F, 0x8E, 0x3F, 0x3F, 0x9F, 0x86, 0x3F, 0x3F, 0x9F,
+    0xC6, 0x3F, 0x3F, 0x1F, 0xE6, 0x3F, 0x3E, 0x1F, 0xF6, 0x3F, 0xF8, 0x3F,
+    0xFE, 0x0F, 0xFD, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xFE, 0x7C, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0x9F, 0xFE, 0x00, 0x1F, 0x9F, 0xFE, 0x07, 0x3F, 0x9F,
+    0xFE, 0x3F, 0x3F, 0x9F, 0xF6, 0x3F, 0x3F, 0x9F, 0xE6, 0x3F, 0x3F, 0x9F,
+    0xE6, 0x3F, 0x3F, 0x1F, 0xC6, 0x3F, 0x3E, 0x1F, 0x8E, 0x3F, 0xF8, 0x3F,
+    0x8E, 0x0F, 0xFD, 0xFF, 0x9E, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xFE, 0x7C, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0x9F, 0xFE, 0x00, 0x1F, 0x9F, 0xF2, 0x07, 0x3F, 0x9F,
+    0xE2, 0x3F, 0x3F, 0x9F, 0xE6, 0x3F, 0x3F, 0x9F, 0xCE, 0x3F, 0x3F, 0x9F,
+    0x8E, 0x3F, 0x3F, 0x1F, 0x1E, 0x3F, 0x3E, 0x1F, 0x8E, 0x3F, 0xF8, 0x3F,
+    0xC6, 0x0F, 0xFD, 0xFF, 0xE2, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF, 0xC0, 0x3F, 0xFC, 0xF8, 0x00, 0x3F,
+    0xFC, 0x00, 0x03, 0x3F, 0xFC, 0x00, 0x3F, 0x3F, 0x8C, 0x0E, 0x7F, 0x3F,
+    0x8C, 0x7E, 0x7F, 0x3F, 0x0C, 0x7E, 0x7F, 0x3F, 0x9C, 0x7E, 0x7F, 0x3F,
+    0xFC, 0x7E, 0x7E, 0x3F, 0xFC, 0x7E, 0x7C, 0x3F, 0x8C, 0x7F, 0xF0, 0x7F,
+    0x0C, 0x1F, 0xFB, 0xFF, 0x0C, 0x1F, 0xFF, 0xFF, 0xBE, 0x7F, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xDE, 0x7C, 0x00, 0x1F,
+    0x8E, 0x00, 0x01, 0x9F, 0x8E, 0x00, 0x3F, 0x9F, 0xC6, 0x07, 0xFF, 0xFF,
+    0xE6, 0x3F, 0xFF, 0xFF, 0xF6, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xFE, 0x7C, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0x9F, 0xE6, 0x00, 0x3F, 0x9F, 0xE6, 0x07, 0xFF, 0xFF,
+    0xC6, 0x3F, 0xFF, 0xFF, 0xCE, 0x7F, 0xFF, 0xFF, 0x8E, 0x7F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xF2, 0x7C, 0x00, 0x1F,
+    0xE6, 0x00, 0x01, 0x9F, 0xC6, 0x00, 0x3F, 0x9F, 0x8E, 0x07, 0xFF, 0xFF,
+    0x1E, 0x3F, 0xFF, 0xFF, 0x8E, 0x7F, 0xFF, 0xFF, 0x86, 0x7F, 0xFF, 0xFF,
+    0xE3, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xDE, 0xFF, 0xC0, 0x3F, 0x8C, 0xF8, 0x00, 0x3F,
+    0x0C, 0x00, 0x03, 0x3F, 0x9C, 0x00, 0x7F, 0x3F, 0xFC, 0x0F, 0xFF, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0x9F, 0xCF, 0xFF, 0x9F, 0x0F,
+    0x9F, 0x80, 0x0F, 0x9E, 0x00, 0x0F, 0x80, 0x00, 0xCF, 0x00, 0x0F, 0xCF,
+    0x03, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF, 0x3F, 0x9F, 0xCF,
+    0x1F, 0xFF, 0x9F, 0x1F, 0xFF, 0x9F, 0x9F, 0xFF, 0x1F, 0x8F, 0xFC, 0x3F,
+    0x87, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xC0, 0x1F, 0xFE, 0x78, 0x00, 0x1F,
+    0xFE, 0x00, 0x07, 0x9F, 0xFE, 0x00, 0xFF, 0xDF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xC7, 0xE0, 0x3F, 0xFF, 0x8F, 0xFC, 0x0F, 0xFF,
+    0x9F, 0xFF, 0x03, 0xFF, 0x8F, 0xFF, 0xC0, 0x7F, 0xC7, 0xFF, 0xF0, 0x1F,
+    0xC7, 0xFF, 0xFC, 0x1F, 0xC7, 0x7F, 0xC0, 0x1F, 0x8E, 0x78, 0x00, 0x7F,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x9F,
+    0xFF, 0x1F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x9F, 0x8F, 0x3F, 0xFF, 0x9F,
+    0x8E, 0x3F, 0xFF, 0x9F, 0xC6, 0x3F, 0xFF, 0x1F, 0xC6, 0x3F, 0xFF, 0x1F,
+    0xE6, 0x3F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFC, 0x7F, 0xFF, 0x1F, 0xF0, 0x7F,
+    0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x9F,
+    0xFF, 0x1F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x9F,
+    0xF6, 0x3F, 0xFF, 0x9F, 0xE6, 0x3F, 0xFF, 0x1F, 0xC6, 0x3F, 0xFF, 0x1F,
+    0xC6, 0x3F, 0xFE, 0x3F, 0x8E, 0x3F, 0xFC, 0x7F, 0x8F, 0x1F, 0xF0, 0x7F,
+    0x9F, 0x03, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x9F,
+    0xFF, 0x1F, 0xFF, 0x9F, 0xF3, 0x3F, 0xFF, 0x9F, 0xE3, 0x3F, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0x8E, 0x3F, 0xFF, 0x1F, 0x9E, 0x3F, 0xFF, 0x1F,
+    0x1E, 0x3F, 0xFE, 0x3F, 0x8E, 0x3F, 0xFC, 0x7F, 0xC7, 0x1F, 0xF0, 0x7F,
+    0xE3, 0x03, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x9F,
+    0xFF, 0x1F, 0xFF, 0x9F, 0xEF, 0x3F, 0xFF, 0x9F, 0x87, 0x3F, 0xFF, 0x9F,
+    0x9E, 0x3F, 0xFF, 0x9F, 0x9E, 0x3F, 0xFF, 0x1F, 0x8E, 0x3F, 0xFF, 0x1F,
+    0xC6, 0x3F, 0xFE, 0x3F, 0xC6, 0x3F, 0xFC, 0x7F, 0x87, 0x1F, 0xF0, 0x7F,
+    0x8F, 0x03, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x7F, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xC1, 0xF8, 0x7F, 0xFF, 0x87, 0xFE, 0x3F, 0xFF, 0x1F, 0xFF, 0x3F,
+    0xFE, 0x3F, 0xFF, 0x3F, 0x8E, 0x7F, 0xFF, 0x3F, 0x0E, 0x7F, 0xFF, 0x3F,
+    0x0C, 0x7F, 0xFF, 0x3F, 0xBC, 0x7F, 0xFE, 0x3F, 0xFC, 0x7F, 0xFE, 0x3F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0x8C, 0x7F, 0xF8, 0xFF, 0x0E, 0x3F, 0xE0, 0xFF,
+    0x1E, 0x06, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0x1F, 0x1F, 0x8E, 0x3F, 0xC4, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF,
+    0xE0, 0xFF, 0xC4, 0x7F, 0x8E, 0x3F, 0x1F, 0x1F, 0xBF, 0xBF, 0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x80, 0x8F, 0xFC, 0x00, 0x1F,
+    0xF8, 0x00, 0x1F, 0xF0, 0x7C, 0x1F, 0xE1, 0xFC, 0x8F, 0xC7, 0xF9, 0xCF,
+    0x8F, 0xF3, 0xCF, 0x9F, 0xE7, 0xCF, 0x9F, 0xCF, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x3F, 0x8F, 0x1E, 0x7F, 0x9F, 0x1C, 0xFF, 0x1F, 0x18, 0xFE, 0x3F,
+    0x81, 0xF8, 0x3F, 0x81, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x07, 0xFF,
+    0x1C, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x7F, 0xFE, 0x30, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x1F, 0xFE, 0x1F, 0xFF, 0x9F,
+    0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x9F, 0x8F, 0xFF, 0xFF, 0x9F,
+    0x8F, 0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0x1F, 0xC7, 0xFF, 0xFE, 0x3F,
+    0xE7, 0xFF, 0xFC, 0x7F, 0xFF, 0x7F, 0xC0, 0xFF, 0xFE, 0x38, 0x01, 0xFF,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x7F, 0xFE, 0x30, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x1F, 0xFE, 0x1F, 0xFF, 0x9F,
+    0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xF7, 0xFF, 0xFF, 0x9F, 0xE7, 0xFF, 0xFF, 0x1F, 0xC7, 0xFF, 0xFE, 0x3F,
+    0xC7, 0xFF, 0xFC, 0x7F, 0x8F, 0x7F, 0xC0, 0xFF, 0x8E, 0x38, 0x01, 0xFF,
+    0x9E, 0x00, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x7F, 0xFE, 0x30, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x1F, 0xFE, 0x1F, 0xFF, 0x9F,
+    0xFE, 0x7F, 0xFF, 0x9F, 0xF2, 0x7F, 0xFF, 0x9F, 0xE3, 0xFF, 0xFF, 0x9F,
+    0xC7, 0xFF, 0xFF, 0x9F, 0x8F, 0xFF, 0xFF, 0x1F, 0x9F, 0xFF, 0xFE, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x7F, 0x8F, 0x7F, 0xC0, 0xFF, 0xC6, 0x38, 0x01, 0xFF,
+    0xE2, 0x00, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0xFF, 0xFC, 0x60, 0x00, 0x7F,
+    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFE, 0x3F, 0xFC, 0x3F, 0xFF, 0x3F,
+    0xFC, 0xFF, 0xFF, 0x3F, 0x8C, 0xFF, 0xFF, 0x3F, 0x0F, 0xFF, 0xFF, 0x3F,
+    0x0F, 0xFF, 0xFF, 0x3F, 0xBF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xF8, 0xFF, 0x8E, 0xFF, 0x81, 0xFF, 0x0C, 0x70, 0x03, 0xFF,
+    0x1C, 0x00, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F,
+    0xBF, 0xF0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x3C, 0xCF,
+    0x03, 0xFC, 0xFF, 0x33, 0xFC, 0xFF, 0x33, 0xFC, 0xFF, 0xB3, 0xF9, 0xFF,
+    0xF1, 0xF9, 0xFF, 0xF8, 0xE1, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x07, 0xFF,
+    0xFF, 0x3F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x00, 0x3F,
+    0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
+    0xE0, 0x3F, 0xE7, 0xFF, 0xC7, 0xFF, 0xE3, 0xFF, 0x9F, 0xFF, 0xE3, 0xFF,
+    0x1F, 0xFF, 0xF3, 0xFF, 0x3F, 0x83, 0xF3, 0xFF, 0x3F, 0x01, 0xF3, 0xFF,
+    0x1E, 0x30, 0xF3, 0xFF, 0x00, 0xF8, 0x07, 0xFF, 0x81, 0xFC, 0x0F, 0xFF,
+    0xC7, 0xFF, 0x1F, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xE1, 0xF1,
+    0xFF, 0xC7, 0xF9, 0xFF, 0x8F, 0xF1, 0x8F, 0x9F, 0xF3, 0x87, 0x1F, 0xE7,
+    0xC3, 0x1F, 0x8F, 0xF3, 0x9E, 0x01, 0xFB, 0x80, 0x01, 0xFF, 0x80, 0x39,
+    0xFF, 0x83, 0xF1, 0xFF, 0xBF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xE1, 0xF1,
+    0xFF, 0xC7, 0xF9, 0xFF, 0x8F, 0xF1, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xE7,
+    0xF3, 0x1F, 0x8F, 0xE3, 0x9E, 0x01, 0x87, 0x80, 0x01, 0x0F, 0x80, 0x39,
+    0x9F, 0x83, 0xF1, 0xFF, 0xBF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xE1, 0xF1,
+    0xFF, 0xC7, 0xF9, 0xF9, 0x8F, 0xF1, 0xF3, 0x9F, 0xF3, 0xC7, 0x1F, 0xE7,
+    0x8F, 0x1F, 0x8F, 0x9F, 0x9E, 0x01, 0x0F, 0x80, 0x01, 0x83, 0x80, 0x39,
+    0xE3, 0x83, 0xF1, 0xFF, 0xBF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xE3,
+    0xFF, 0x8F, 0xF3, 0xCF, 0x1F, 0xE3, 0x8F, 0x3F, 0xE7, 0x1E, 0x3F, 0xCF,
+    0x1E, 0x3F, 0x1F, 0x8F, 0x3C, 0x03, 0xC7, 0x00, 0x03, 0xC7, 0x00, 0x73,
+    0x8F, 0x07, 0xE3, 0x9F, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xC7,
+    0xFF, 0x1F, 0xE7, 0x9E, 0x3F, 0xC7, 0x0E, 0x7F, 0xCF, 0x1C, 0x7F, 0x9F,
+    0xFC, 0x7E, 0x3F, 0xFE, 0x78, 0x07, 0xDE, 0x00, 0x07, 0x0E, 0x00, 0xE7,
+    0x1E, 0x0F, 0xC7, 0x1E, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0xF8, 0xFF, 0xFF, 0xE3, 0xFC, 0xFF, 0xFF, 0xC7, 0xF8, 0xFF,
+    0xE1, 0xCF, 0xF9, 0xFF, 0xC0, 0x8F, 0xF3, 0xFF, 0x9C, 0x8F, 0xC7, 0xFF,
+    0x9C, 0xCF, 0x00, 0xFF, 0x98, 0xC0, 0x00, 0xFF, 0x81, 0xC0, 0x1C, 0xFF,
+    0xE3, 0xC1, 0xF8, 0xFF, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0x03, 0xF8, 0x01, 0xF0, 0x01, 0xE1, 0xF1, 0xC7, 0xF9, 0x8F, 0xF1,
+    0x9F, 0xE3, 0x1F, 0xC7, 0x1F, 0x0F, 0x1C, 0x03, 0x80, 0x01, 0x80, 0x31,
+    0xC6, 0x79, 0x9E, 0x79, 0x9E, 0x79, 0x3C, 0xF1, 0x38, 0xF3, 0x01, 0xE3,
+    0x83, 0xE7, 0xC7, 0xFF,
+    // 0xE7 'ç'
+    0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFB, 0xE0, 0x01, 0xBB, 0xC3, 0xF1, 0x33,
+    0x8F, 0xF9, 0x07, 0x9F, 0xF9, 0x8F, 0x9F, 0xF9, 0xDF, 0x1F, 0xF3, 0xFF,
+    0x1F, 0xF3, 0xFF, 0x8F, 0xE7, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0x31,
+    0xDF, 0xCE, 0x79, 0x8F, 0x9E, 0x79, 0x87, 0xBC, 0x79, 0xC3, 0x3C, 0xF1,
+    0xF3, 0x10, 0xF3, 0xFF, 0x81, 0xE7, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0x31,
+    0xFF, 0xCE, 0x79, 0xFF, 0x9E, 0x79, 0xFF, 0xBC, 0x79, 0xF3, 0x3C, 0xF1,
+    0xC3, 0x10, 0xF3, 0x87, 0x81, 0xE7, 0x0F, 0x83, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0x31,
+    0xF9, 0xCE, 0x79, 0xE3, 0x9E, 0x79, 0xC7, 0xBC, 0x79, 0x8F, 0x3C, 0xF1,
+    0x9F, 0x10, 0xF3, 0x07, 0x81, 0xE7, 0x83, 0x83, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x0C, 0xC7,
+    0x8F, 0x39, 0xE7, 0x0E, 0x79, 0xE7, 0x1E, 0xF1, 0xE7, 0xFC, 0xF3, 0xC7,
+    0xFC, 0x43, 0xCF, 0x9E, 0x07, 0x9F, 0x0E, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x81, 0xDF, 0x9C, 0x01, 0x8F, 0x80, 0x01,
+    0x87, 0x00, 0x71, 0xE3, 0x87, 0xE3, 0xF1, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x81, 0xFF, 0x9C, 0x01, 0xFF, 0x80, 0x01,
+    0xFB, 0x00, 0x71, 0xE3, 0x87, 0xE3, 0xC7, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xFF, 0xFB, 0x9F, 0x81, 0xF1, 0x9C, 0x01, 0xE3, 0x80, 0x01,
+    0xC7, 0x00, 0x71, 0x8F, 0x87, 0xE3, 0x9F, 0xFF, 0xE7, 0x87, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xFF, 0xDE, 0x7E, 0x07, 0x0E, 0x70, 0x07, 0x1E, 0x00, 0x07,
+    0x1C, 0x01, 0xC7, 0xFE, 0x1F, 0x8F, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x01,
+    0xFF, 0xC3, 0xF1, 0xFF, 0x8F, 0xF9, 0xFD, 0x9F, 0xF9, 0x99, 0x1F, 0xF9,
+    0x83, 0x3F, 0xF1, 0xC3, 0x1F, 0xF3, 0xE1, 0x9F, 0xC3, 0xC0, 0x00, 0x07,
+    0x9C, 0x00, 0x1F, 0x9F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0x7F, 0xFB, 0xFF, 0x3F, 0x83, 0xFF, 0x30, 0x03, 0xFE, 0x00, 0x0F,
+    0xFE, 0x00, 0x7F, 0xCF, 0x31, 0xFF, 0x8F, 0xC7, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x1F, 0x1F, 0xFF, 0x8F, 0x3F, 0xC3, 0xC6, 0x3C, 0x03, 0xC6, 0x00, 0x03,
+    0x8E, 0x00, 0x63, 0x9F, 0x07, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC1, 0xF1,
+    0xFF, 0x87, 0xF9, 0xFF, 0x8F, 0xF9, 0x8F, 0x9F, 0xF9, 0x87, 0x1F, 0xF1,
+    0xC3, 0x1F, 0xE3, 0xF3, 0x1F, 0xC3, 0xFB, 0x80, 0x07, 0xFF, 0x80, 0x1F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC1, 0xF1,
+    0xFF, 0x87, 0xF9, 0xFF, 0x8F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x1F, 0xF1,
+    0xF3, 0x1F, 0xE3, 0xE3, 0x1F, 0xC3, 0x87, 0x80, 0x07, 0x0F, 0x80, 0x1F,
+    0x9F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC1, 0xF1,
+    0xFF, 0x87, 0xF9, 0xF9, 0x8F, 0xF9, 0xF3, 0x9F, 0xF9, 0xC7, 0x1F, 0xF1,
+    0x8F, 0x1F, 0xE3, 0x9F, 0x1F, 0xC3, 0x0F, 0x80, 0x07, 0x83, 0x80, 0x1F,
+    0xE3, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xE3,
+    0xFF, 0x0F, 0xF3, 0xCF, 0x1F, 0xF3, 0x8F, 0x3F, 0xF3, 0x1E, 0x3F, 0xE3,
+    0x1E, 0x3F, 0xC7, 0x8E, 0x3F, 0x87, 0xC7, 0x00, 0x0F, 0xC7, 0x00, 0x3F,
+    0x8F, 0xC0, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x07, 0xC7,
+    0xFE, 0x1F, 0xE7, 0x9E, 0x3F, 0xE7, 0x0E, 0x7F, 0xE7, 0x1C, 0x7F, 0xC7,
+    0xFC, 0x7F, 0x8F, 0xFC, 0x7F, 0x0F, 0xDE, 0x00, 0x1F, 0x0E, 0x00, 0x7F,
+    0x1F, 0x81, 0xFF, 0x1F, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x98, 0xCF,
+    0x08, 0x87, 0x18, 0xC7, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xFD, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9, 0xFE, 0x03, 0xF8, 0x03, 0xE0, 0x01,
+    0xC1, 0x81, 0x87, 0x19, 0x8F, 0x39, 0x9E, 0x79, 0x1C, 0xF1, 0x19, 0xE3,
+    0x13, 0xC3, 0x80, 0x07, 0x80, 0x1F, 0xC0, 0x7F, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0x9C, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0xF9, 0xFF, 0x87, 0xF9, 0x8F, 0xFF, 0xF1, 0x87, 0xFF, 0xE3,
+    0xC3, 0xFF, 0xC7, 0xE3, 0xFF, 0x8F, 0xFB, 0xFC, 0x01, 0xFF, 0xC0, 0x01,
+    0xFF, 0x80, 0x79, 0xFF, 0x87, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0x9C, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0xF9, 0xFF, 0x87, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3,
+    0xF3, 0xFF, 0xC7, 0xE3, 0xFF, 0x8F, 0xC7, 0xFC, 0x01, 0x0F, 0xC0, 0x01,
+    0x9F, 0x80, 0x79, 0xFF, 0x87, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0x9C, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0xF9, 0xF9, 0x87, 0xF9, 0xF3, 0xFF, 0xF1, 0xE3, 0xFF, 0xE3,
+    0x87, 0xFF, 0xC7, 0x9F, 0xFF, 0x8F, 0x8F, 0xFC, 0x01, 0x83, 0xC0, 0x01,
+    0xE3, 0x80, 0x79, 0xFF, 0x87, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x0F, 0xFE, 0x70, 0x07, 0xFC, 0x00, 0x07,
+    0xFC, 0x03, 0xE7, 0x9E, 0x1F, 0xE7, 0x0F, 0xFF, 0xC7, 0x1F, 0xFF, 0x8F,
+    0xBF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x07, 0x8F, 0x00, 0x07,
+    0x0E, 0x01, 0xE7, 0x1E, 0x1F, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xBF, 0xFE, 0x00, 0x0F,
+    0x9F, 0xC0, 0x03, 0xEF, 0x9C, 0x00, 0x63, 0xEF, 0x00, 0x01, 0xF3, 0xEF,
+    0x00, 0xC7, 0xF3, 0xFF, 0x0F, 0x8F, 0xF3, 0xFF, 0xFF, 0x1F, 0xF3, 0xFF,
+    0xFF, 0x3F, 0xE7, 0xFF, 0xFE, 0x3F, 0x87, 0xFF, 0xFE, 0x08, 0x0F, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x9F, 0xFE, 0x7F, 0xFF, 0x1F,
+    0xFC, 0x3F, 0xFF, 0x3F, 0x9C, 0x07, 0xFC, 0x7F, 0x0E, 0x00, 0x00, 0xFF,
+    0x1F, 0xC0, 0x01, 0xFF, 0xBF, 0xFF, 0x23, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xFF, 0x8F, 0xFC, 0x3F, 0xFF, 0x0C, 0x00, 0xFF, 0xFF,
+    0x1C, 0x01, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xF0, 0xCF, 0xFF, 0xFF, 0xC1, 0xEF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFE, 0x13, 0xFF, 0xFF, 0xF8, 0x73, 0xFF, 0xFF, 0xE1, 0xF3, 0xFF, 0xFF,
+    0x87, 0xF3, 0xFF, 0xFF, 0x8F, 0xF3, 0xEF, 0xFF, 0x00, 0x33, 0xCE, 0xFF,
+    0x80, 0x00, 0x48, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0x3F,
+    0xFF, 0xFF, 0x07, 0x3F, 0xFF, 0xFF, 0xCF, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xE1, 0xF1, 0xFF,
+    0xC7, 0xF9, 0xFF, 0x8F, 0xF1, 0xFF, 0x9F, 0xF3, 0xFF, 0x1F, 0xE7, 0xFF,
+    0x1F, 0x8F, 0x8F, 0x9E, 0x01, 0x07, 0x80, 0x00, 0x07, 0x80, 0x38, 0xE7,
+    0x83, 0xF1, 0xE7, 0xBF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xC7, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0x1F,
+    0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x3F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFF, 0x9F,
+    0xF6, 0x3F, 0xFF, 0x9F, 0xE6, 0x3F, 0xFF, 0x1F, 0xE6, 0x3F, 0xFF, 0x1F,
+    0xC6, 0x3F, 0xFF, 0x3F, 0x8E, 0x3F, 0xFE, 0x7F, 0x8F, 0x03, 0xFE, 0xFF,
+    0x9F, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0xF1,
+    0xFF, 0x8F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xF3, 0x1F, 0xF3,
+    0xC3, 0x1F, 0xF3, 0x87, 0x8F, 0xE7, 0x0F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F,
+    0xFF, 0xF0, 0x7C, 0x1F, 0xFF, 0xE3, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0x8F,
+    0xFF, 0x8F, 0xFF, 0x8F, 0xDF, 0x9F, 0xFF, 0xCF, 0x87, 0x9F, 0xFF, 0xCF,
+    0xC3, 0x1F, 0xFF, 0xCF, 0xE1, 0x1F, 0xFF, 0x8F, 0xF1, 0x1F, 0xFF, 0x8F,
+    0xE3, 0x1F, 0xFF, 0x9F, 0xC7, 0x1F, 0xFF, 0x3F, 0xCF, 0x81, 0xFF, 0x7F,
+    0x9F, 0x83, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0xF1,
+    0xBF, 0x8F, 0xF9, 0x0F, 0x9F, 0xF9, 0x83, 0x9F, 0xF9, 0xE3, 0x1F, 0xF3,
+    0xE3, 0x1F, 0xF3, 0xC7, 0x8F, 0xE7, 0x8F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x9F, 0xF0, 0x0F, 0xFF, 0x9E, 0x00, 0x0F,
+    0xFF, 0x80, 0x00, 0xCF, 0xFF, 0x00, 0x1F, 0xCF, 0xFF, 0x03, 0xFF, 0xCF,
+    0x8F, 0x3F, 0xFF, 0xCF, 0x87, 0x3F, 0xFF, 0xCF, 0xC3, 0x3F, 0xFF, 0xCF,
+    0xF1, 0x1F, 0xFF, 0x9F, 0xF1, 0x1F, 0xFF, 0x9F, 0xE3, 0x9F, 0xFF, 0x1F,
+    0xC7, 0x8F, 0xFC, 0x3F, 0x8F, 0x87, 0xF0, 0x7F, 0x9F, 0xC0, 0x00, 0xFF,
+    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7F,
+    0xFF, 0xF8, 0x7C, 0x7F, 0xFF, 0xF1, 0xFE, 0x7F, 0xFF, 0xE3, 0xFC, 0x7F,
+    0xFF, 0xE7, 0xFC, 0xFF, 0xFF, 0xC7, 0xF9, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF,
+    0xF7, 0xE7, 0x80, 0x7F, 0xF3, 0xE0, 0x00, 0x7F, 0xF3, 0x00, 0x0E, 0x7F,
+    0xE0, 0x00, 0xFC, 0x7F, 0xE0, 0x1F, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xF0, 0x0F, 0xFF, 0x3E, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0xCF, 0xFF, 0x00, 0x0F, 0xCF, 0xFF, 0x03, 0x9F, 0xCF, 0xFF,
+    0x1F, 0x9F, 0xCC, 0x7F, 0x1F, 0x9F, 0xC8, 0x3F, 0x1F, 0x9F, 0xC0, 0x3F,
+    0x1F, 0x9F, 0x87, 0x3F, 0x1F, 0x9F, 0x0F, 0x3F, 0x1F, 0xFC, 0x1F, 0x7F,
+    0x07, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0x31, 0xDF,
+    0xCE, 0x79, 0x07, 0x9E, 0x78, 0x07, 0xBC, 0x78, 0xE7, 0x3C, 0xF1, 0xE7,
+    0x10, 0xF3, 0xEF, 0x81, 0xE7, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xF0, 0x0F, 0xFF, 0x3E, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0xCF, 0xFF, 0x00, 0x0F, 0xCF, 0xDF, 0x03, 0x9F, 0xCF,
+    0x87, 0x1F, 0x9F, 0xCF, 0xC3, 0x1F, 0x9F, 0xCF, 0xE1, 0x1F, 0x9F, 0xCF,
+    0xF1, 0x1F, 0x9F, 0x8F, 0xE3, 0x1F, 0x9F, 0x0F, 0xC7, 0x1F, 0xFC, 0x1F,
+    0xCF, 0x07, 0xFE, 0xFF, 0x9F, 0x07, 0xFF, 0xFF, 0xBF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xC3, 0x31,
+    0xBF, 0xCE, 0x79, 0x0F, 0x9E, 0x79, 0x83, 0xBC, 0x79, 0xE3, 0x3C, 0xF1,
+    0xE3, 0x10, 0xF3, 0xC7, 0x81, 0xE7, 0x8F, 0x83, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xE0, 0x1F, 0xFE, 0x7C, 0x00, 0x1F,
+    0xFE, 0x00, 0x01, 0x9F, 0xE6, 0x00, 0x3F, 0x9F, 0xE6, 0x07, 0xFF, 0x9F,
+    0xC6, 0x3F, 0xFF, 0x9F, 0xCE, 0x7F, 0xFF, 0x9F, 0x8E, 0x7F, 0xFF, 0x9F,
+    0x1F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xF8, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x07, 0xF7, 0x3F, 0x80, 0x07,
+    0xF7, 0x38, 0x00, 0x47, 0xE6, 0x00, 0x07, 0xCF, 0xC6, 0x00, 0xFF, 0x8F,
+    0xC6, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3,
+    0xEF, 0xFC, 0x03, 0xCF, 0x80, 0x03, 0xC0, 0x00, 0x33, 0xC0, 0x07, 0xF3,
+    0xC0, 0xFF, 0xF3, 0xC7, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3, 0xCF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xF9, 0xFF, 0xC3, 0x81, 0xFF, 0x03, 0x07, 0xFF, 0x1F,
+    0x9F, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xF3, 0xF8, 0x00, 0x7F,
+    0xF3, 0x80, 0x04, 0x7F, 0xE0, 0x00, 0x7C, 0xFF, 0xE0, 0x0F, 0xF8, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xF7, 0xCF, 0xFF, 0xE7, 0xCF, 0xFF, 0xE7, 0x0F,
+    0xBF, 0xC0, 0x0F, 0x3E, 0x00, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0x3F, 0xCF, 0x1F, 0x3F, 0xCF, 0x3E, 0x7F, 0xCF, 0x3E, 0x7F, 0xCF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x7F,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xE7, 0xFF, 0xF2, 0x03,
+    0x9F, 0xC0, 0x03, 0x9C, 0x00, 0x23, 0x00, 0x03, 0xE7, 0x00, 0x1F, 0xC7,
+    0x07, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xC0, 0x1F, 0xFE, 0x78, 0x00, 0x1F,
+    0xFE, 0x00, 0x07, 0x9F, 0xFE, 0x00, 0xFF, 0xDF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF7, 0xFC, 0x0F, 0xFF,
+    0xE7, 0xFF, 0x03, 0xFF, 0xE7, 0xFF, 0xC0, 0x7F, 0xC7, 0xFF, 0xF0, 0x1F,
+    0x8F, 0xFF, 0xFC, 0x1F, 0x8F, 0x7F, 0xC0, 0x1F, 0x1E, 0x78, 0x00, 0x7F,
+    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xBF, 0xFD, 0xFF, 0x9F, 0xC1, 0xFF, 0x98, 0x01, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x3F, 0xFF, 0x98, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xF3, 0x8F, 0xFF, 0xE3, 0x9F, 0xE1, 0x87, 0x1E, 0x01, 0x0F, 0x00, 0x01,
+    0x9F, 0x00, 0x31, 0xFF, 0x83, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xE0, 0x0F, 0xFF, 0x3C, 0x00, 0x0F,
+    0xFF, 0x00, 0x03, 0xCF, 0xFF, 0x00, 0x7F, 0xEF, 0xFF, 0x81, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0x8F, 0xF0, 0x1F, 0xFF, 0x87, 0xFE, 0x07, 0xFF,
+    0xE1, 0xFF, 0x81, 0xFF, 0xF1, 0xFF, 0xE0, 0x3F, 0xF3, 0xFF, 0xF8, 0x0F,
+    0xE7, 0xFF, 0xFE, 0x0F, 0xC7, 0xBF, 0xE0, 0x0F, 0x8F, 0x3C, 0x00, 0x3F,
+    0x9F, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xBF, 0xFD, 0xFF, 0x9F, 0xC1, 0xFF, 0x98, 0x01, 0xFF, 0x00, 0x07,
+    0xFF, 0x00, 0x3F, 0xBF, 0x98, 0xFF, 0x0F, 0xE3, 0xFF, 0x83, 0xC7, 0xFF,
+    0xE3, 0x8F, 0xFF, 0xE3, 0x9F, 0xE1, 0xC7, 0x1E, 0x01, 0x8F, 0x00, 0x01,
+    0x1F, 0x00, 0x31, 0x3F, 0x83, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x7E, 0x1F,
+    0xE1, 0xFF, 0x8F, 0xC7, 0xFF, 0x8F, 0xCF, 0xFF, 0xCF, 0x8F, 0xFF, 0xCF,
+    0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xCF, 0x1F, 0xFF, 0xCF, 0x1F, 0xFF, 0x0F,
+    0x1F, 0xE0, 0x0F, 0x1C, 0x00, 0x0F, 0x00, 0x01, 0xCF, 0x00, 0x1F, 0xCF,
+    0x03, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF, 0x1F, 0x9F, 0xCF,
+    0x1F, 0x9F, 0x8F, 0x1F, 0x9F, 0x0F, 0x1F, 0xFC, 0x1F, 0x03, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFE, 0x07, 0xF8, 0x03, 0xE0, 0x01, 0xC1, 0xF1, 0x87, 0xF9, 0x8F, 0xF9,
+    0x9F, 0xF9, 0x1F, 0xF1, 0x1F, 0xE3, 0x1F, 0xC3, 0x80, 0x03, 0x80, 0x01,
+    0xE0, 0x21, 0xC7, 0x39, 0x8E, 0x79, 0x9E, 0x79, 0x3C, 0xF9, 0x38, 0xF3,
+    0x01, 0xF3, 0x81, 0xE7, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x9F, 0xF0, 0x0F, 0xFF, 0x9E, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0xCF, 0x8F, 0x00, 0x0F, 0xCF, 0x87, 0x03, 0xCF, 0xFF,
+    0xC3, 0x3F, 0xC7, 0xFF, 0xF1, 0x3F, 0x81, 0xFF, 0xF1, 0x3F, 0x80, 0x7F,
+    0xE3, 0x1F, 0x1C, 0x3F, 0xC7, 0x8E, 0x3E, 0x1F, 0x8F, 0x80, 0x3F, 0x0F,
+    0x9F, 0xC0, 0x7F, 0x8F, 0xFF, 0xE1, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x159 'ř'
+    0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xE1, 0xFF, 0x9C, 0x01, 0xFF, 0x00, 0x03,
+    0x9F, 0x00, 0x3F, 0x07, 0x90, 0xFF, 0xC3, 0xE3, 0xFF, 0xF3, 0xC7, 0xFF,
+    0xE3, 0x8F, 0xFF, 0xC7, 0x0F, 0xFF, 0x8F, 0x0F, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF3, 0xF8, 0x1F,
+    0xFF, 0xC0, 0xFF, 0x1F, 0xFF, 0x80, 0x7F, 0x9F, 0xFF, 0x18, 0x3F, 0x9F,
+    0xFF, 0x3C, 0x3F, 0x9F, 0xF6, 0x3E, 0x1F, 0x9F, 0xE6, 0x7F, 0x1F, 0x9F,
+    0xE6, 0x7F, 0x8F, 0x1F, 0xC6, 0x3F, 0x80, 0x3F, 0x8E, 0x07, 0xC0, 0x7F,
+    0x8F, 0x07, 0xE1, 0xFF, 0x9F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xF3, 0xF1, 0xFF, 0xC1, 0xF9,
+    0xFF, 0x80, 0xF9, 0xFF, 0x98, 0x79, 0xFF, 0x9C, 0x39, 0xF3, 0x1E, 0x03,
+    0xC3, 0x1F, 0x03, 0x87, 0x1F, 0x8F, 0x0F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF9, 0xFC, 0x0F,
+    0xFF, 0xE0, 0x7F, 0x8F, 0xFF, 0xC0, 0x3F, 0xCF, 0xDF, 0x8C, 0x1F, 0xCF,
+    0x8F, 0x9E, 0x1F, 0xCF, 0xC3, 0x1F, 0x0F, 0xCF, 0xE1, 0x3F, 0x8F, 0xCF,
+    0xF1, 0x3F, 0xC7, 0x8F, 0xE3, 0x1F, 0xC0, 0x1F, 0xE7, 0x03, 0xE0, 0x3F,
+    0xCF, 0x83, 0xF0, 0xFF, 0x9F, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xF3, 0xF1, 0xFF, 0xC1, 0xF9,
+    0xBF, 0x80, 0xF9, 0x0F, 0x98, 0x79, 0x83, 0x9C, 0x39, 0xE3, 0x1E, 0x03,
+    0xE3, 0x1F, 0x03, 0xC7, 0x1F, 0x8F, 0x8F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xEF, 0xFF, 0x0F, 0xFF, 0xCF,
+    0xFF, 0x1F, 0xFF, 0xCF, 0xFF, 0x1F, 0xFC, 0x0F, 0xDF, 0x1F, 0xC0, 0x0F,
+    0x8F, 0x18, 0x00, 0x0F, 0xC3, 0x00, 0x03, 0xCF, 0xE1, 0x00, 0x7F, 0xCF,
+    0xF1, 0x0F, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xE7, 0x1F, 0xFF, 0xFF,
+    0xCF, 0x1F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0x9F, 0x03, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0x81, 0xFF, 0x90, 0x01,
+    0xFF, 0x00, 0x01, 0xFC, 0x01, 0xF9, 0xF8, 0x1F, 0xF1, 0xFB, 0x9F, 0xF3,
+    0xFF, 0x9F, 0xE3, 0xE1, 0x9F, 0xE7, 0x83, 0xBF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0xFF, 0x18, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x8F, 0xFF, 0x0F, 0xFF, 0xCF,
+    0xFF, 0x3F, 0xFF, 0xCF, 0xFF, 0x3F, 0xFF, 0xCF, 0xE3, 0xFF, 0xFF, 0xCF,
+    0x81, 0xFF, 0xFF, 0xCF, 0x99, 0xFF, 0xFF, 0x8F, 0x39, 0xFF, 0xFF, 0x1F,
+    0x39, 0xFF, 0xFE, 0x3F, 0x81, 0xBF, 0xE0, 0x7F, 0xC7, 0x1C, 0x00, 0xFF,
+    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xC1, 0xFF, 0xFF, 0xCE, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x7C, 0xFF, 0xFF, 0xC3, 0xFC, 0xFF,
+    0xE1, 0xFF, 0xF8, 0xFF, 0xC0, 0xFF, 0xF1, 0xFF, 0x9C, 0xFF, 0xE3, 0xFF,
+    0x9C, 0xFF, 0xC7, 0xFF, 0x9C, 0xFE, 0x00, 0xFF, 0x81, 0xE0, 0x00, 0xFF,
+    0xC3, 0xC0, 0x3C, 0xFF, 0xFF, 0xC3, 0xF9, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0xFF, 0x18, 0x00, 0x1F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x8F, 0xFF, 0x0F, 0xFF, 0xCF,
+    0xFF, 0x3F, 0xFF, 0xCF, 0xF1, 0x3F, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xCF,
+    0xE3, 0xFF, 0xFF, 0xCF, 0xC7, 0xFF, 0xFF, 0x8F, 0x87, 0xFF, 0xFF, 0x1F,
+    0x8F, 0xFF, 0xFE, 0x3F, 0xF9, 0xBF, 0xE0, 0x7F, 0xF3, 0x1C, 0x00, 0xFF,
+    0xE3, 0x00, 0x07, 0xFF, 0xE7, 0x00, 0xFF, 0xFF, 0xC7, 0x0F, 0xFF, 0xFF,
+    0x8F, 0x3F, 0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x83, 0xFF, 0x9C, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0xF9, 0xFB, 0x87, 0xF9, 0xE3, 0xFF, 0xF1, 0xC7, 0xFF, 0xE3,
+    0x87, 0xFF, 0xC7, 0x9F, 0xFF, 0x8F, 0xFB, 0xFC, 0x01, 0xE3, 0xC0, 0x01,
+    0xC7, 0x80, 0x79, 0x87, 0x87, 0xF3, 0x9F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xBF,
+    0xFC, 0x0F, 0xFF, 0x3F, 0xFC, 0x03, 0xFF, 0x3F, 0xFC, 0x00, 0x7C, 0x3F,
+    0xDC, 0x60, 0x00, 0x3F, 0x8C, 0xFC, 0x00, 0x3F, 0x0F, 0xFF, 0x07, 0x3F,
+    0x9F, 0xFC, 0x3F, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0x8C, 0xC3, 0xFF, 0xFF, 0x8C, 0x07, 0xFF, 0xFF, 0x0C, 0x1F, 0xFF, 0xFF,
+    0x9C, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xC7, 0xFC, 0x1F, 0xFF, 0x07, 0xF0, 0x1F, 0xFE, 0x1F, 0xE1, 0x9F,
+    0xFE, 0x3F, 0xC3, 0x9F, 0xFE, 0x3F, 0x87, 0x9F, 0xF6, 0x3F, 0x0F, 0x9F,
+    0xE6, 0x3C, 0x3F, 0x9F, 0xE6, 0x38, 0x7F, 0x9F, 0xC6, 0x30, 0xFF, 0x9F,
+    0x8E, 0x21, 0xFF, 0x1F, 0x8E, 0x03, 0xFC, 0x1F, 0x1E, 0x0F, 0xF8, 0x3F,
+    0xFE, 0x1F, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0x87, 0xE3, 0xFF, 0x8F, 0x83,
+    0xFF, 0x1F, 0x13, 0xFF, 0x9E, 0x31, 0xFF, 0x9C, 0x71, 0xF3, 0x88, 0xF9,
+    0xE3, 0xC1, 0xF9, 0x87, 0xC3, 0xF1, 0x0F, 0x87, 0xE1, 0x9F, 0x0F, 0xE3,
+    0xFF, 0x9F, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xC7, 0xFC, 0x1F, 0xFF, 0x07, 0xF0, 0x1F, 0xFE, 0x1F, 0xE1, 0x9F,
+    0xFE, 0x3F, 0xC3, 0x9F, 0xFE, 0x3F, 0x87, 0x9F, 0xFE, 0x3F, 0x0F, 0x9F,
+    0xCE, 0x3C, 0x3F, 0x9F, 0x86, 0x38, 0x7F, 0x9F, 0x86, 0x30, 0xFF, 0x9F,
+    0x8E, 0x21, 0xFF, 0x1F, 0xFE, 0x03, 0xFC, 0x1F, 0xFE, 0x0F, 0xF8, 0x3F,
+    0xFE, 0x1F, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0x0F, 0xC7, 0xFF, 0x1F, 0x07,
+    0xFE, 0x3E, 0x27, 0xFF, 0x3C, 0x63, 0xEF, 0x38, 0xE3, 0x87, 0x11, 0xF3,
+    0x87, 0x83, 0xF3, 0x8F, 0x87, 0xE3, 0xFF, 0x0F, 0xC3, 0xFE, 0x1F, 0xC7,
+    0xFF, 0x3F, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xE3, 0xFE, 0x0F, 0xFF, 0x83, 0xF8, 0x0F, 0xFF, 0x0F, 0xF0, 0xCF,
+    0xFF, 0x1F, 0xE1, 0xCF, 0x8F, 0x1F, 0xC3, 0xCF, 0x83, 0x1F, 0x87, 0xCF,
+    0xE1, 0x1E, 0x1F, 0xCF, 0xF1, 0x1C, 0x3F, 0xCF, 0xF3, 0x18, 0x7F, 0xCF,
+    0xE7, 0x10, 0xFF, 0x8F, 0xCF, 0x01, 0xFE, 0x0F, 0x8F, 0x07, 0xFC, 0x1F,
+    0x9F, 0x0F, 0xFC, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0x87, 0xE3, 0xFF, 0x8F, 0x83,
+    0xBF, 0x1F, 0x13, 0x0F, 0x9E, 0x31, 0x83, 0x9C, 0x71, 0xE3, 0x88, 0xF9,
+    0xE3, 0xC1, 0xF9, 0xC7, 0xC3, 0xF1, 0x8F, 0x87, 0xE1, 0x1F, 0x0F, 0xE3,
+    0x3F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xCF, 0xF1, 0x8F, 0xC1, 0x9E, 0x07, 0x90, 0x1F,
+    0x80, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0x9E, 0x01, 0x80, 0x01, 0x80, 0x71,
+    0x8F, 0xF9, 0x9F, 0xF3, 0x1F, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x07, 0xFF,
+    0xE0, 0xFF, 0xDF, 0xC7, 0xFE, 0x0F, 0x8F, 0xFE, 0x0F, 0x9F, 0xFF, 0xCF,
+    0x3F, 0xBF, 0xCF, 0x3F, 0x1F, 0xCF, 0x3C, 0x0F, 0xCF, 0x18, 0x8F, 0xCF,
+    0x81, 0xC7, 0x8F, 0x83, 0xC0, 0x1F, 0xC7, 0xE0, 0x3F, 0xEF, 0xF8, 0xFF,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F,
+    // 0x2018 '‘'
+    0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x1F, 0xFF, 0x7F, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF,
+    0xFF, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x201B '‛'
+    0xCF, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x1F, 0xFF, 0x7F, 0xFF,
+    0xF8, 0xFF, 0xE0, 0x7F, 0xC0, 0x7F, 0x86, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xFE, 0x7F, 0xF8, 0xFF, 0x80, 0xFF, 0x03, 0xFF, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xB0, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x8F, 0xFF,
+    // 0x201E '„'
+    0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xB8, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+    // 0x201F '‟'
+    0xCF, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x9C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xBE, 0x7F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFC, 0x3F,
+    0xFD, 0xC0, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x3C, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFC, 0xE7,
+    0xF8, 0xFC, 0x07, 0xFD, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x0C, 0xFF,
+    0x01, 0xFC, 0xFF, 0x3C, 0xFC, 0xFF, 0xF8, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xCF, 0x87, 0x03, 0x03, 0x07, 0x8F,
+    // 0x2026 '…'
+    0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+    0x0F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0x0F, 0x8F, 0xFF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC6, 0x3F, 0xCF, 0x9F,
+    0x9F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x1F, 0x9E, 0x3F, 0x84, 0x7F, 0xC0, 0xFF,
+    0xE1, 0xFF, 0xFB, 0xFF,
+    // 0x2070 '⁰'
+    0xFE, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC7, 0xF3, 0x8F, 0xF3, 0x9F, 0xE3,
+    0x9F, 0xC7, 0x8F, 0x0F, 0x80, 0x1F, 0xC0, 0x7F, 0xFF, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x9F, 0xF1, 0x9F,
+    0xE3, 0x97, 0xC6, 0x03, 0x80, 0x07, 0x80, 0x9F, 0x9F, 0x9F, 0xFF, 0xFF,
+    // 0x2075 '⁵'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC3, 0xE7, 0x03, 0xC7, 0x13, 0xCF,
+    0x38, 0x0F, 0x38, 0x1F, 0x3C, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x07, 0xF0, 0xE3, 0xE1, 0xF3, 0xCD, 0xF3,
+    0xCC, 0xE3, 0x9C, 0x07, 0x9E, 0x0F, 0x9F, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0x8F, 0xEF, 0x0F, 0x87, 0x3E, 0x0F, 0x3C, 0x3F, 0x38, 0xFF, 0x21, 0xFF,
+    0x07, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xDF, 0xFF, 0x07, 0xE3, 0x03, 0xC0, 0x73, 0x88, 0xF3, 0x9C, 0xF3,
+    0x9C, 0x67, 0x98, 0x07, 0x83, 0x0F, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF1, 0xF3, 0xE0, 0xF3, 0xC0, 0x63, 0x9E, 0x67,
+    0x9E, 0x47, 0x9E, 0x0F, 0x8E, 0x1F, 0xC0, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFC, 0x1F, 0xE0, 0x0F, 0xC0, 0x07, 0x87, 0xE7, 0x1F, 0xE7, 0x3F, 0xE7,
+    0x3F, 0x8F, 0x1E, 0x1F, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xCF, 0xF3, 0xCF, 0x03, 0xC0, 0x03, 0x80, 0x33,
+    0x83, 0xF3, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xEF, 0xFF, 0xC7, 0xCF, 0x87, 0x8F, 0x07, 0x1E, 0x27, 0x3E, 0x67,
+    0x3C, 0xE7, 0x11, 0xE7, 0x03, 0xEF, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xE7, 0xFF, 0xE7, 0xDF, 0xE7, 0x9C, 0xE7, 0x39, 0xE7, 0x39, 0xCF,
+    0x30, 0x0F, 0x00, 0x1F, 0x86, 0x3F, 0xFF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF1, 0x3F, 0xE3, 0x3F,
+    0xC7, 0x27, 0x8C, 0x07, 0x00, 0x0F, 0x01, 0x3F, 0x1F, 0x3F, 0xFF, 0xFF,
+    // 0x2085 '₅'
+    0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC3, 0xE7, 0x03, 0xE7, 0x13, 0xCF,
+    0x38, 0x0F, 0x38, 0x1F, 0x3C, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2086 '₆'
+    0xFF, 0xFF, 0xFC, 0x1F, 0xF0, 0x0F, 0xE1, 0xC7, 0xC3, 0xE7, 0x8B, 0xE7,
+    0x99, 0xC7, 0x38, 0x0F, 0x3C, 0x1F, 0x3E, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0x8F, 0xEF, 0x0F, 0x87, 0x3E, 0x0F, 0x3C, 0x3F, 0x38, 0xFF, 0x21, 0xFF,
+    0x07, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x9F, 0xFF, 0x0F, 0xC6, 0x07, 0x80, 0xE7, 0x91, 0xE7, 0x39, 0xE7,
+    0x38, 0xCF, 0x30, 0x0F, 0x06, 0x1F, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xE3, 0xE7, 0xC1, 0xE7, 0x80, 0xE7, 0x3C, 0xCF,
+    0x3C, 0x8F, 0x3C, 0x1F, 0x1C, 0x3F, 0x80, 0x7F, 0xC1, 0xFF, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x27, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF0, 0x04, 0x1F, 0xE1, 0x27, 0x0F,
+    0xE3, 0x27, 0x8F, 0xC7, 0x27, 0x8F, 0x8F, 0x27, 0xCF, 0x9F, 0x27, 0xCF,
+    0x9F, 0x27, 0xCF, 0x9F, 0x3F, 0xCF, 0x9F, 0xFF, 0x8F, 0x9F, 0xFF, 0x9F,
+    0x83, 0xFF, 0x9F, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x9F, 0xFF, 0x1F, 0xBF, 0x3C, 0x3F, 0x00, 0x3F, 0x07, 0xBF, 0x3F, 0xFF,
+    0x3F, 0xFF, 0x1F, 0xBF, 0xFF, 0x3F, 0xF8, 0x3F, 0x03, 0xBF, 0x0F, 0xFF,
+    0x80, 0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0xC7, 0xBF, 0x80, 0x3F, 0x00, 0x3F,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0x83, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xF3, 0xC3, 0xFB, 0xE3, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xF7, 0xC3, 0xFF, 0xE7, 0x87, 0x8C, 0xE7,
+    0x9F, 0x9C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x38, 0x8F, 0xFF, 0x00, 0x0F,
+    0xFF, 0x82, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xC3, 0xFF,
+    0xCF, 0x93, 0xFF, 0xCF, 0x33, 0xFF, 0xCE, 0x33, 0xFF, 0xCC, 0x73, 0xE3,
+    0xC0, 0xF3, 0xC3, 0xE1, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xF7, 0xE3, 0xFF, 0xE7,
+    0xC7, 0x8C, 0xE7, 0x8F, 0x9C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x38, 0x8F,
+    0xFF, 0x00, 0x0F, 0xFF, 0x82, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0x83, 0xFF,
+    0xC0, 0x03, 0xFF, 0xC0, 0x13, 0xF3, 0xC3, 0xFB, 0xE3, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0x8F, 0xE3, 0xFF, 0x07, 0x87, 0xC2, 0x67,
+    0x9F, 0x80, 0xF7, 0xFF, 0x99, 0xF7, 0xFF, 0x3C, 0xE7, 0xFF, 0x38, 0x07,
+    0xFF, 0x02, 0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7, 0xF9, 0xFF, 0xC6, 0x79, 0xFF,
+    0xCE, 0x73, 0xFF, 0xCE, 0x73, 0xFF, 0xCC, 0x07, 0xF3, 0xC0, 0x07, 0xE3,
+    0xC3, 0x9F, 0x87, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0x8F, 0xC3, 0xFF, 0x07,
+    0x8F, 0xC2, 0x67, 0x9F, 0x80, 0xF7, 0xFF, 0x99, 0xF7, 0xFF, 0x3C, 0xE7,
+    0xFF, 0x38, 0x07, 0xFF, 0x02, 0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xE1, 0xF3, 0xFF,
+    0xC0, 0xF3, 0xFF, 0xCC, 0xE3, 0xFF, 0xCC, 0x07, 0xF3, 0xCE, 0x0F, 0xE3,
+    0xCF, 0x1F, 0x87, 0xCF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0x8F, 0xC3, 0xFF, 0x07,
+    0x8F, 0xC2, 0x67, 0x9F, 0x80, 0xF7, 0xFF, 0x99, 0xF7, 0xFF, 0x3C, 0xE7,
+    0xFF, 0x38, 0x07, 0xFF, 0x02, 0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x215E '⅞'
+    0xE3, 0xFB, 0xFF, 0xC7, 0xE1, 0xFF, 0xCF, 0x83, 0xFF, 0xCF, 0x1F, 0xF3,
+    0xCC, 0x3F, 0xE3, 0xC8, 0xFF, 0x87, 0xC1, 0xFF, 0x0F, 0xC7, 0xFE, 0x3F,
+    0xCF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0x8F, 0x8F, 0xFF, 0x07, 0x9F, 0xC2, 0x67, 0xFF, 0x80, 0xF7,
+    0xFF, 0x99, 0xF7, 0xFF, 0x3C, 0xE7, 0xFF, 0x38, 0x07, 0xFF, 0x02, 0x0F,
+    0xFF, 0x87, 0x1F, 0xFF, 0xCF, 0xFF,
+    // 0x2190 '←'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC1, 0x3F, 0x89, 0x9F, 0x99, 0xDF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x8F, 0xFF, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0x99, 0xDF, 0x89, 0x9F,
+    0xC1, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC1, 0x1F, 0x89, 0x8F,
+    0xD9, 0xDF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xD9, 0xDF,
+    0x89, 0x8F, 0xC1, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xF9, 0xFF, 0xE3, 0xF8, 0xFF, 0xC7, 0xFC, 0xFF,
+    0x8F, 0xFE, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x8F, 0xFE, 0x7F,
+    0xC7, 0xFC, 0xFF, 0xE3, 0xF8, 0xFF, 0xF3, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xF9, 0xFF, 0xF0, 0xFF, 0xE2, 0x7F, 0xC6, 0x3F, 0x86, 0x1F, 0x86, 0x4F,
+    0xA6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    // 0x21D1 '⇑'
+    0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
+    0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F,
+    0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x7F, 0x86, 0x4F, 0x86, 0x1F,
+    0xC6, 0x3F, 0xE2, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE7, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE2, 0x3F, 0xC6, 0x1F, 0x86, 0x0F,
+    0xA6, 0x4F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xE6, 0x7F, 0xA6, 0x4F,
+    0x86, 0x0F, 0xC6, 0x1F, 0xE2, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x03, 0xCF, 0x87, 0xE3,
+    0x9F, 0x9F, 0xF3, 0x9F, 0x3F, 0xF3, 0x3F, 0x3F, 0xF3, 0x3F, 0x3F, 0xE3,
+    0x1F, 0x3F, 0xC7, 0x8F, 0x3F, 0x0F, 0x81, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
+    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xC0, 0xCF, 0xFE, 0x03, 0xCF, 0xF8, 0x1F, 0xCF, 0xC0, 0x7F, 0xCF,
+    0x83, 0xFF, 0xCF, 0x07, 0xFF, 0xCF, 0x00, 0xFF, 0xCF, 0xC0, 0x1F, 0xCF,
+    0xF8, 0x03, 0xCF, 0xFE, 0x00, 0xCF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xEF,
+    // 0x220F '∏'
+    0xBF, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF,
+    0x03, 0xFF, 0xC0, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x0C, 0xFF,
+    0x10, 0x3C, 0x1C, 0xFF, 0x1C, 0x18, 0x7C, 0xFF, 0x1E, 0x00, 0xFC, 0xFF,
+    0x1F, 0x81, 0xFC, 0xFF, 0x1F, 0xC7, 0xFC, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0x03, 0xFF, 0xF0, 0x7F,
+    0x83, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
+    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF3, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0x9E, 0x3F, 0x1F, 0x3F, 0x9E, 0x3F,
+    0x9E, 0x7F, 0xC4, 0xFF, 0xE1, 0xFF, 0xE0, 0xFF, 0xCC, 0x7F, 0x9E, 0x7F,
+    0x9F, 0x3F, 0x1F, 0x3F, 0x9E, 0x7F, 0x80, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xE7, 0x3F, 0xE7, 0x3F, 0xE7, 0x0F, 0xE7, 0x0F, 0xE6, 0x3F,
+    0xE0, 0x3F, 0xE1, 0x3F, 0xC7, 0x3F, 0x87, 0x3F, 0xA7, 0x3F, 0xE7, 0x3F,
+    0xE7, 0x3F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x7F, 0xF8, 0xFE, 0x7F, 0xF0, 0x7E, 0x7F,
+    0xF0, 0x7E, 0x7F, 0xE2, 0x3E, 0x7F, 0xE7, 0x3E, 0x7F, 0xC7, 0x1E, 0x7F,
+    0xCF, 0x9E, 0x7F, 0x8F, 0x8E, 0x7F, 0x9F, 0xCE, 0x7F, 0x9F, 0xC6, 0x7F,
+    0xFF, 0xFE, 0x7F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xEE, 0x7F, 0x9F, 0xC6, 0x7F, 0x8F, 0xCE, 0x7F,
+    0xCF, 0x8E, 0x7F, 0xC7, 0x9E, 0x7F, 0xE7, 0x1E, 0x7F, 0xE3, 0x3E, 0x7F,
+    0xF2, 0x3E, 0x7F, 0xF0, 0x7E, 0x7F, 0xF8, 0x7E, 0x7F, 0xFC, 0xFE, 0x7F,
+    0xFC, 0xFE, 0x7F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28ItalicBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x00, 0x59, 0x07, 0x14, 0x03, 0x0B,
+    0x00, 0x50, 0x03, 0x03, 0x00, 0x03, 0x88, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x22 '"'
+    0x00, 0xBF, 0x28, 0x3F, 0x01, 0x3F, 0x04, 0x3F, 0x40, 0x3F, 0x01, 0xBF,
+    0x10, 0x3F, 0x40, 0xBF, 0x18, 0x3F, 0x00, 0x3F,
+    // 0x23 '#'
+    0x00, 0x18, 0x3F, 0x00, 0x08, 0x3F, 0x08, 0x08, 0x3F, 0x08, 0x0D, 0x3F,
+    0x08, 0x40, 0x3F, 0x08, 0x06, 0x3F, 0x60, 0x28, 0x3F, 0x80, 0x08, 0x3F,
+    0x28, 0x08, 0x3F, 0x08, 0x02, 0x3F, 0x08, 0xA0, 0xBF, 0x00, 0x00, 0x3F,
+    0x80, 0xC8, 0x3F, 0x88, 0x08, 0x3F, 0xC8, 0x08, 0x3F, 0x08, 0x08, 0x3F,
+    0x0E, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x40, 0x07, 0x00, 0x10, 0x08, 0x1F, 0x00, 0x00, 0x01, 0x07,
+    0x04, 0x04, 0x20, 0x57, 0x00, 0x00, 0x01, 0x07, 0x02, 0x30, 0x60, 0x07,
+    0x08, 0x80, 0x00, 0x07, 0x30, 0x40, 0x8A, 0x07, 0x03, 0x00, 0x60, 0x07,
+    0xC0, 0x02, 0x00, 0x07, 0x00, 0x40, 0x08, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x02, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x00, 0x00, 0x01, 0x06, 0x00, 0x01, 0x08, 0x08, 0x01, 0x01, 0x24, 0x01,
+    0x20, 0x14, 0x0D, 0x10, 0x04, 0x01, 0x50, 0x00, 0x21, 0x40, 0x48, 0x89,
+    0x09, 0x00, 0x21, 0x00, 0x62, 0x41, 0x00, 0x09, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x80, 0x01, 0x01, 0x21, 0xA1, 0x04, 0x04, 0x09,
+    0x00, 0x10, 0xC1, 0x12, 0x20, 0x05, 0x00, 0x00, 0x15, 0x00, 0x40, 0x05,
+    0x60, 0x50, 0x21, 0x00, 0x50, 0xC1, 0x00, 0x00, 0x01, 0x00, 0x10, 0x81,
+    0x00, 0x00, 0x01,
+    // 0x26 '&'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x06, 0xC1,
+    0x00, 0x28, 0x21, 0x00, 0x50, 0x21, 0x02, 0x00, 0x05, 0x10, 0x04, 0x05,
+    0x04, 0x00, 0x01, 0x11, 0x40, 0x81, 0x21, 0x02, 0x09, 0x80, 0x80, 0x09,
+    0x81, 0x04, 0x01, 0x00, 0x00, 0x01, 0x44, 0x01, 0x01, 0x00, 0x04, 0x21,
+    0x00, 0x00, 0x11, 0x00, 0x58, 0x01, 0x00, 0x50, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x09, 0x01, 0x00, 0x01, 0x01, 0x40, 0x01,
+    // 0x27 '''
+    0x00, 0xBF, 0x28, 0x3F, 0x01, 0x3F, 0x04, 0x3F, 0x40, 0x3F,
+    // 0x28 '('
+    0x00, 0x02, 0x10, 0x07, 0x00, 0x30, 0x04, 0x07, 0x00, 0xC0, 0x80, 0x87,
+    0x01, 0x18, 0x08, 0x47, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x00, 0x47,
+    0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x57,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x01, 0x27, 0x20, 0x00, 0x02, 0x47,
+    0x40, 0x00, 0x04, 0x87, 0x20, 0x00, 0x01, 0x07, 0x01, 0x80, 0x84, 0x07,
+    0x08, 0x08, 0x08, 0x07, 0x03, 0x00, 0x60, 0x07, 0x00, 0x49, 0x00, 0x07,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0xBF, 0x00, 0xBF, 0x00, 0x3F, 0x10, 0x3F, 0x00, 0x7F,
+    0x01, 0x3F, 0x48, 0x3F, 0x00, 0x3F, 0x0A, 0x3F,
+    // 0x2B '+'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x7D, 0xF7,
+    0x00, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0x2C ','
+    0x01, 0x7F, 0x00, 0x7F, 0x04, 0x7F, 0x08, 0x7F, 0x80, 0x7F, 0x84, 0x7F,
+    0x50, 0x7F,
+    // 0x2D '-'
+    0x6F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x4F,
+    // 0x2E '.'
+    0x07, 0x4F, 0x8F, 0x87, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x00, 0x00, 0x4D,
+    0x00, 0x00, 0x11, 0x00, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01,
+    0x00, 0x80, 0x01, 0x01, 0x20, 0x01, 0x00, 0x40, 0x01, 0x10, 0x00, 0x01,
+    0x24, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x00, 0x07, 0x00, 0x60, 0x07, 0x01, 0x00, 0x07, 0x04, 0x00, 0x17,
+    0x00, 0x20, 0x87, 0x02, 0x00, 0x4F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x47, 0x80, 0x00, 0x57, 0x80, 0x00, 0x87, 0x80, 0x02, 0x27,
+    0x90, 0x0C, 0x07, 0x03, 0x20, 0x87, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x40, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x0F,
+    0x20, 0x01, 0x4F, 0x00, 0x10, 0x0F, 0x42, 0x80, 0x0F, 0x00, 0x02, 0x8F,
+    0x00, 0x50, 0x0F, 0x86, 0x00, 0x1F, 0x20, 0x00, 0x0F,
+    // 0x32 '2'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x08, 0x00, 0x0F,
+    0x00, 0x02, 0x0F, 0x24, 0x00, 0x4F, 0x40, 0x01, 0x4F, 0x50, 0x08, 0x4F,
+    0x00, 0x12, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x08, 0x4F, 0x90, 0x90, 0x4F,
+    0x0A, 0x20, 0x4F, 0x40, 0x40, 0x2F, 0x00, 0x00, 0x0F, 0x1A, 0x00, 0x0F,
+    // 0x33 '3'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x00, 0x20, 0x47, 0x08, 0x40, 0x07, 0x00, 0x40, 0x17,
+    0x00, 0x00, 0x87, 0x80, 0x90, 0x07, 0x81, 0x02, 0x07, 0x92, 0x00, 0x47,
+    0x08, 0x80, 0x87, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x34 '4'
+    0x00, 0x02, 0x0F, 0x00, 0x01, 0x0F, 0x00, 0x11, 0x0F, 0x00, 0x21, 0x0F,
+    0x00, 0x49, 0x0F, 0x00, 0x91, 0x0F, 0x01, 0x21, 0x0F, 0x02, 0x01, 0x0F,
+    0x04, 0x01, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x28, 0x0F, 0x0A, 0x80, 0x2F,
+    0x40, 0x00, 0x0F, 0x80, 0xA1, 0x0F, 0x8A, 0x01, 0x0F, 0x40, 0x06, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x07,
+    0x10, 0x40, 0x47, 0x40, 0x40, 0x07, 0x06, 0x00, 0x07, 0x11, 0x00, 0x87,
+    0x10, 0x00, 0x27, 0x10, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x01, 0x07,
+    0x10, 0x14, 0x07, 0x10, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0x36 '6'
+    0x00, 0x07, 0x07, 0x00, 0x60, 0x47, 0x00, 0x80, 0x07, 0x00, 0x09, 0x17,
+    0x04, 0x20, 0x47, 0x08, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x47, 0x48, 0x20, 0x87, 0x50, 0x9F, 0x07, 0x10, 0x00, 0x07,
+    0x80, 0x40, 0x87, 0xA0, 0x08, 0x07, 0xA0, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x0F, 0x02, 0x02, 0x07, 0x00, 0x04, 0x37,
+    0x10, 0x10, 0xC7, 0x10, 0x03, 0x07, 0x10, 0x04, 0x07, 0x11, 0x10, 0x07,
+    0x10, 0x20, 0x07, 0x14, 0x80, 0x07, 0x18, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x02, 0x47, 0x00, 0x04, 0x27, 0x00, 0x00, 0x07, 0x06, 0x11, 0x07,
+    0x00, 0xA0, 0x47, 0x00, 0x40, 0x0F, 0x09, 0x00, 0x0F, 0x10, 0x10, 0x07,
+    0x00, 0x80, 0x47, 0xA0, 0x88, 0x07, 0xA1, 0x60, 0x07, 0x82, 0x40, 0x27,
+    0x08, 0x80, 0x47, 0x01, 0x07, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0C, 0x00, 0x0F,
+    0x10, 0x10, 0x07, 0x21, 0x08, 0x07, 0x08, 0x48, 0x07, 0x00, 0x08, 0x87,
+    0x80, 0x20, 0x07, 0xA0, 0x08, 0x47, 0xA0, 0x20, 0x07, 0x90, 0x00, 0x07,
+    0x04, 0x82, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x40, 0x07,
+    // 0x3A ':'
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x18, 0x10, 0x40, 0x00, 0x08, 0x00,
+    0x50, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x01, 0x0F,
+    0x00, 0x10, 0x0F, 0x18, 0x10, 0x8F, 0x40, 0x0A, 0x0F, 0x08, 0x00, 0x0F,
+    0x50, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x3C '<'
+    0x00, 0x07, 0x05, 0x07, 0x08, 0x07, 0x08, 0x87, 0x10, 0x07, 0x10, 0x07,
+    0x20, 0x07, 0x20, 0x07, 0x40, 0x07, 0x50, 0x07, 0x80, 0x47, 0x20, 0x07,
+    0x00, 0x27,
+    // 0x3D '='
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01,
+    // 0x3E '>'
+    0x00, 0x07, 0xE0, 0x17, 0x80, 0x07, 0x10, 0x07, 0x40, 0x07, 0x28, 0x87,
+    0x24, 0x07, 0x15, 0x07, 0x03, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x01, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x03, 0x18, 0x09, 0x07, 0x08, 0x01, 0x03, 0x00, 0x08, 0x3B,
+    0x10, 0x14, 0x03, 0x00, 0xA4, 0x03, 0x42, 0x40, 0x03, 0x00, 0x80, 0x03,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x40 '@'
+    0x00, 0x03, 0x80, 0x3F, 0x00, 0x10, 0x18, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x18, 0x40, 0x3F, 0x04, 0x00, 0x01, 0x3F, 0x09, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0xBF, 0x14, 0x09, 0x40, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x20, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x11, 0x40, 0xA0, 0x3F,
+    0x50, 0x00, 0x80, 0x3F, 0x02, 0x01, 0x00, 0x3F, 0x02, 0x85, 0x82, 0xBF,
+    0x01, 0x20, 0x00, 0xBF, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x28, 0x21, 0x3F,
+    0x11, 0x00, 0xA0, 0x3F, 0x40, 0x00, 0xA0, 0x3F, 0x40, 0x01, 0x40, 0x3F,
+    0x00, 0x06, 0x00, 0x3F, 0x21, 0x28, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x02, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x18, 0xAF, 0x00, 0x20, 0x3F,
+    0x00, 0x04, 0x0F, 0x02, 0x14, 0x0F, 0x0C, 0x84, 0x0F, 0x13, 0x04, 0x0F,
+    0x04, 0x04, 0x0F, 0x8C, 0x04, 0x0F, 0x80, 0xB4, 0x0F, 0xA0, 0x03, 0x6F,
+    0x05, 0x00, 0x0F, 0x00, 0x28, 0x0F, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F,
+    // 0x42 'B'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x47,
+    0x60, 0x10, 0x07, 0x22, 0x80, 0x07, 0xB0, 0x03, 0x07, 0x00, 0x30, 0x07,
+    0x8A, 0xA0, 0x07, 0xA0, 0xA0, 0x07, 0x80, 0x20, 0x07, 0xA0, 0x00, 0x47,
+    0x20, 0x80, 0x97, 0x91, 0x07, 0x27, 0x00, 0x00, 0x07, 0x40, 0x20, 0x87,
+    0x1C, 0x0E, 0x07,
+    // 0x43 'C'
+    0x00, 0x3F, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x10, 0x40, 0x17,
+    0x22, 0x00, 0x97, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x10, 0x00, 0x4F,
+    0x80, 0x00, 0x0F, 0x20, 0x00, 0x47, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x47,
+    0x80, 0x00, 0x87, 0x10, 0x00, 0x27, 0x80, 0x01, 0x47, 0x04, 0x00, 0x07,
+    0x50, 0x00, 0x07,
+    // 0x44 'D'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x47,
+    0x60, 0x14, 0x07, 0x22, 0x80, 0x07, 0xB0, 0x02, 0x87, 0x00, 0x50, 0x07,
+    0x0A, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x47,
+    0x80, 0x00, 0x57, 0x20, 0x00, 0x87, 0x90, 0x01, 0x07, 0x00, 0x00, 0x47,
+    0x04, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x00, 0x0F,
+    0x0A, 0x40, 0x0F, 0x20, 0x40, 0x0F, 0x20, 0x40, 0x0F, 0x20, 0x00, 0x4F,
+    0x20, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x40, 0x3F, 0x1C, 0x00, 0x8F,
+    0x04, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x00, 0x2F,
+    0x0A, 0x50, 0x1F, 0x20, 0x50, 0x0F, 0x20, 0x50, 0x0F, 0x20, 0x50, 0x0F,
+    0x20, 0x50, 0x0F, 0x00, 0x60, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0x3F, 0x07, 0x00, 0x00, 0x47, 0x08, 0x00, 0x07, 0x10, 0x40, 0x07,
+    0x22, 0x00, 0x97, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x10, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x80, 0x18, 0x47, 0xA0, 0x00, 0x47,
+    0xA0, 0x08, 0xD7, 0x00, 0x02, 0x17, 0x82, 0x00, 0x07, 0x02, 0x02, 0x87,
+    0x4C, 0x08, 0x07, 0x00, 0x10, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x10, 0x2F,
+    0x06, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x4F,
+    0x40, 0x08, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x50, 0x2F,
+    0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x50, 0x2F,
+    0x06, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x08, 0xBF, 0x00, 0x00, 0xA0, 0x3F, 0x40, 0x08, 0x02, 0x3F,
+    0x21, 0x40, 0x18, 0x3F, 0x28, 0x01, 0x40, 0x3F, 0x00, 0x28, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x47,
+    0x40, 0x14, 0x07, 0x22, 0x80, 0x07, 0x30, 0x02, 0x87, 0x00, 0x30, 0x27,
+    0x02, 0x80, 0x27, 0x00, 0x04, 0x07, 0x00, 0x22, 0x07, 0x82, 0x80, 0x87,
+    0x04, 0x00, 0x07, 0x00, 0x02, 0x07, 0xD2, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x2F, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x50, 0x0F,
+    0x06, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x0F, 0x00, 0x20, 0x0F, 0x81, 0x81, 0xAF, 0x24, 0x10, 0x0F,
+    0x00, 0xC0, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x80, 0x0F, 0x00, 0x1A, 0x0F,
+    0x48, 0x00, 0x4F, 0x00, 0x90, 0x4F, 0x00, 0x08, 0x8F, 0x00, 0x20, 0x0F,
+    0x00, 0xC8, 0x0F, 0x01, 0x30, 0x0F, 0x04, 0x40, 0x0F, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0xCF, 0x04, 0xE0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x1C, 0xCF,
+    0x38, 0x00, 0x2F, 0x20, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x01, 0x47,
+    0x80, 0x28, 0x07, 0x21, 0x00, 0x47, 0x10, 0x0A, 0x27, 0x01, 0x40, 0x27,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x30, 0x07, 0x02, 0x0C, 0x07,
+    0x00, 0xC1, 0x07, 0x00, 0x10, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x0F,
+    0xC0, 0x28, 0x07, 0x25, 0x00, 0xA7, 0x00, 0x14, 0x07, 0x01, 0x00, 0x07,
+    0x28, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0xB2, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x10, 0xC3, 0x17,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xA0, 0x00, 0x87, 0x00, 0x01, 0x27, 0x08, 0x00, 0x07, 0x05, 0x90, 0x07,
+    0x20, 0x01, 0x07, 0x00, 0x0C, 0x07, 0x04, 0x20, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x60, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0xB0, 0x02, 0x8F, 0x00, 0x68, 0x2F,
+    0x8A, 0x08, 0x0F, 0xA0, 0x08, 0x0F, 0x80, 0x20, 0x0F, 0xA0, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x80, 0x80, 0x0F, 0x0E, 0x20, 0x0F, 0x40, 0x40, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0xB3, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x08, 0x00, 0x00, 0x1F,
+    0x10, 0xC2, 0x10, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x48, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x08, 0x1F, 0x80, 0x00, 0x11, 0x1F, 0x80, 0x00, 0x14, 0x1F,
+    0xA0, 0x00, 0x20, 0x1F, 0x00, 0x02, 0x02, 0x1F, 0x08, 0x0C, 0x42, 0x5F,
+    0x00, 0x20, 0x80, 0x1F, 0x00, 0x02, 0x00, 0x5F, 0x10, 0x0C, 0x01, 0x1F,
+    0x02, 0x60, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    // 0x52 'R'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x01, 0x47,
+    0x60, 0x10, 0x07, 0x02, 0x80, 0x07, 0x30, 0x02, 0x87, 0x00, 0x40, 0x27,
+    0x8A, 0x00, 0x37, 0xA0, 0x04, 0x07, 0x80, 0x01, 0x07, 0xA0, 0x00, 0x87,
+    0x20, 0x04, 0x27, 0x93, 0x21, 0x07, 0x00, 0x40, 0x17, 0x00, 0x00, 0x07,
+    0x0C, 0x00, 0x2F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x02, 0xC7, 0x00, 0x04, 0x17, 0x09, 0x05, 0x17, 0x20, 0x80, 0x07,
+    0x40, 0x40, 0x07, 0x1E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x90, 0x07,
+    0xA0, 0x08, 0x47, 0xA0, 0x44, 0x87, 0x80, 0x20, 0x27, 0x00, 0x10, 0x47,
+    0x00, 0x07, 0x87, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x54 'T'
+    0x2C, 0x00, 0x0F, 0x82, 0x00, 0x2F, 0x18, 0x00, 0x2F, 0x20, 0x00, 0x0F,
+    0x20, 0x05, 0x0F, 0x20, 0x50, 0x0F, 0x2A, 0x00, 0x4F, 0x00, 0x0A, 0x0F,
+    0x01, 0x40, 0x2F, 0x18, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F,
+    // 0x55 'U'
+    0x00, 0x03, 0x07, 0xA0, 0x50, 0x47, 0x0A, 0x00, 0x07, 0x00, 0x09, 0x17,
+    0x01, 0x40, 0x07, 0x08, 0x00, 0x47, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x00, 0x02, 0x27, 0xC0, 0x28, 0x47, 0x05, 0x00, 0x07, 0x00, 0x14, 0x07,
+    0x02, 0x80, 0x07, 0x08, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x34, 0x07,
+    0x00, 0x00, 0x57, 0x06, 0xC0, 0x07, 0x20, 0x06, 0x87, 0xC0, 0x01, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x01, 0x07, 0x00, 0x06, 0x07, 0x00, 0x08, 0x07,
+    0xA4, 0x00, 0x07, 0x10, 0x00, 0x07, 0x02, 0x00, 0x07, 0x0C, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x07, 0x00, 0x07, 0x00, 0x06, 0x77,
+    0x00, 0x00, 0x07, 0x30, 0x7E, 0x07, 0x20, 0x00, 0x17, 0x00, 0x00, 0x47,
+    0x00, 0x01, 0x87, 0x00, 0x06, 0x07, 0x00, 0x08, 0x07, 0x00, 0x20, 0x07,
+    0x10, 0x80, 0x07, 0x40, 0xC0, 0x07, 0x00, 0x03, 0x37, 0x30, 0x00, 0x07,
+    0x00, 0x63, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x30, 0x07,
+    0x00, 0x80, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x02, 0x0F, 0x10, 0x04, 0xAF,
+    0x04, 0x00, 0x2F, 0x01, 0x02, 0x0F, 0x20, 0x60, 0x0F, 0x20, 0x00, 0x0F,
+    0xC1, 0x0C, 0x0F, 0x00, 0x03, 0x0F, 0x02, 0x00, 0xCF, 0x40, 0x00, 0x0F,
+    0x12, 0x00, 0x0F, 0x24, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x30, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x80, 0x0F, 0x10, 0x01, 0x4F, 0x02, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    0xC0, 0x45, 0x0F, 0x00, 0x10, 0x2F, 0x00, 0x00, 0x3F, 0x44, 0x00, 0x0F,
+    0x29, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x28, 0x02, 0x07,
+    0x80, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x12, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x80, 0x07, 0x20, 0x10, 0x47, 0x20, 0x00, 0x47, 0x24, 0x80, 0x47,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x00, 0x37, 0x00, 0x00, 0x87,
+    0x20, 0x00, 0x07,
+    // 0x5B '['
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x02, 0x80, 0x3F,
+    0x00, 0x28, 0x0C, 0xBF, 0x03, 0x01, 0x40, 0xBF, 0x50, 0x14, 0x00, 0x1F,
+    0x01, 0x80, 0x00, 0x1F, 0x28, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x01, 0x61, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x61, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x0D, 0x00, 0x00, 0x63, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0xA0, 0x3F, 0x00, 0x0A, 0x01, 0x1F,
+    0x40, 0x40, 0x50, 0x1F, 0x54, 0x05, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x0A, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    // 0x5E '^'
+    0x00, 0x0F, 0x00, 0x6F, 0x00, 0x0F, 0x0C, 0x37, 0x20, 0x07, 0x06, 0x07,
+    0x80, 0x07, 0x8C, 0x07, 0x00, 0x07, 0x18, 0x67, 0x00, 0x07, 0x00, 0xCF,
+    0x00, 0x0F, 0x00, 0x07,
+    // 0x5F '_'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x60 '`'
+    0x11, 0x89, 0x05, 0x11, 0x01, 0x01,
+    // 0x61 'a'
+    0x01, 0x68, 0x00, 0x02, 0x10, 0x00, 0x21, 0x01, 0x48, 0x00, 0x10, 0x00,
+    0x80, 0x10, 0x00, 0x20, 0x20, 0x50, 0x90, 0x02, 0x08, 0x01, 0x40, 0xA8,
+    0x8A, 0x08, 0xE0, 0x10, 0x00, 0x18,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x20, 0x02, 0x81, 0x00, 0x10, 0x01,
+    0x85, 0x00, 0x91, 0x00, 0x32, 0x01, 0x80, 0x88, 0x03, 0x08, 0x40, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x25, 0x00, 0x00, 0x49, 0x00, 0x39, 0x11,
+    0x01, 0x00, 0x21, 0x00, 0x01, 0x01, 0x00, 0x3C, 0x01,
+    // 0x63 'c'
+    0x00, 0xD0, 0x0C, 0x02, 0x00, 0x00, 0x26, 0x09, 0x00, 0x01, 0x00, 0x00,
+    0xA0, 0x0A, 0x20, 0x0A, 0x00, 0x14, 0x80, 0x08, 0x00, 0x00,
+    // 0x64 'd'
+    0x00, 0x02, 0xD1, 0x00, 0x08, 0x05, 0x00, 0x10, 0x01, 0x00, 0x42, 0x03,
+    0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x01, 0x00, 0x21, 0x00, 0x00, 0x41,
+    0x00, 0x40, 0xA1, 0x21, 0x20, 0x05, 0x00, 0x10, 0x03, 0x8A, 0x01, 0x51,
+    0x00, 0x10, 0x11, 0x80, 0x80, 0x21, 0xE8, 0x00, 0x31,
+    // 0x65 'e'
+    0x00, 0xD0, 0x0C, 0x02, 0x00, 0x20, 0x03, 0x01, 0x50, 0x41, 0x20, 0x00,
+    0xA0, 0x08, 0x04, 0x08, 0x00, 0x00, 0x82, 0x14, 0x40, 0x10, 0x30, 0x00,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x14, 0x07, 0x00, 0x01, 0x00, 0x07,
+    0x00, 0x68, 0x03, 0x07, 0x01, 0x00, 0x50, 0x07, 0x18, 0x0A, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x0D, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x81, 0x00, 0x00, 0x07, 0x21, 0x80, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0x43, 0x00, 0x01, 0x13, 0x00, 0x00, 0x03, 0x00, 0x02, 0x63,
+    0x00, 0x01, 0x07, 0x00, 0x10, 0x13, 0x20, 0x22, 0x03, 0x49, 0x00, 0x03,
+    0x00, 0x20, 0x03, 0x80, 0xA9, 0x17, 0x20, 0x01, 0x03, 0x21, 0x44, 0x2B,
+    0x18, 0x80, 0x0B, 0x01, 0x02, 0x03, 0x80, 0x01, 0x23, 0x80, 0x00, 0x03,
+    0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x68 'h'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x20, 0x01, 0x01, 0x00, 0x50, 0x09,
+    0x86, 0x00, 0x01, 0x00, 0x29, 0x01, 0x80, 0x80, 0x01, 0x08, 0x48, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0xA0, 0x19, 0x01, 0x01, 0x41, 0x00, 0x34, 0x03,
+    0x00, 0x00, 0x21, 0x00, 0x06, 0x11, 0x00, 0x60, 0x09, 0x00, 0x00, 0x01,
+    // 0x69 'i'
+    0x00, 0x40, 0x19, 0x00, 0x00, 0x41, 0x01, 0x08, 0x03, 0x01, 0x60, 0x21,
+    0x70, 0x02, 0x11, 0x89, 0x28, 0x09, 0x00, 0x00, 0x21, 0x70, 0x00, 0x01,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x60, 0x47, 0x01, 0x0A, 0x03, 0x07,
+    0x00, 0x00, 0x18, 0x07, 0x00, 0x00, 0x80, 0x07, 0x89, 0x68, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x00, 0x00, 0x09, 0x00, 0x01, 0x41, 0x00, 0x14, 0x01, 0x82, 0x80, 0x51,
+    0x28, 0x04, 0x81, 0x00, 0x88, 0x01, 0x88, 0x02, 0x11, 0x40, 0x81, 0x01,
+    0x00, 0x05, 0x45, 0x00, 0x42, 0x21, 0x00, 0x50, 0x03, 0x00, 0x04, 0x03,
+    0x00, 0x90, 0x09, 0x00, 0x00, 0x09,
+    // 0x6C 'l'
+    0x00, 0x00, 0x2D, 0x60, 0x02, 0x81, 0x00, 0x10, 0x01, 0x85, 0x00, 0xA1,
+    0x20, 0x08, 0x05, 0x81, 0x40, 0x21, 0x14, 0x00, 0x31, 0x00, 0x00, 0x01,
+    // 0x6D 'm'
+    0x20, 0x04, 0x00, 0x50, 0x82, 0x00, 0x00, 0x14, 0x00, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x28, 0x00, 0x10, 0x04, 0x00, 0x50, 0x05, 0x00, 0x00, 0x14,
+    0x80, 0x00, 0x30, 0x00, 0x04, 0x00, 0x28, 0x00, 0x10, 0x00, 0x00, 0x50,
+    0x05, 0x01, 0x00, 0x00, 0x81, 0x8A, 0x40, 0x10, 0x00, 0x18,
+    // 0x6E 'n'
+    0x20, 0x04, 0x00, 0x50, 0x82, 0x00, 0x00, 0x14, 0x00, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x28, 0x00, 0x10, 0x00, 0x00, 0x2A, 0x02, 0x81, 0x18, 0x00,
+    0x00, 0x82, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00,
+    // 0x6F 'o'
+    0x02, 0x90, 0x08, 0x00, 0x10, 0x02, 0x20, 0x08, 0x00, 0x01, 0x00, 0x05,
+    0xA0, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x10,
+    0x30, 0xC0, 0x00, 0x00,
+    // 0x70 'p'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x00, 0x00, 0x37, 0x20, 0x02, 0x07,
+    0x00, 0x50, 0x07, 0x84, 0x01, 0x47, 0x00, 0x10, 0x17, 0x00, 0xC8, 0x07,
+    0x3A, 0x01, 0x03, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x10, 0x0A, 0x03,
+    0x80, 0x10, 0x03, 0x00, 0xC4, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    0x12, 0x80, 0x03,
+    // 0x71 'q'
+    0x01, 0x4C, 0x03, 0x04, 0x02, 0x03, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x07, 0x10, 0x02, 0x07, 0x20, 0x10, 0x07, 0x00, 0x20, 0x47,
+    0x20, 0x5A, 0x07, 0x10, 0x00, 0x07, 0x08, 0x05, 0x07, 0x40, 0xA0, 0x0B,
+    0x88, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x72 'r'
+    0x20, 0x03, 0x00, 0x31, 0x85, 0x01, 0x00, 0x09, 0x00, 0x01, 0x50, 0x01,
+    0x14, 0x01, 0x40, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x60, 0x01,
+    // 0x73 's'
+    0x00, 0x18, 0x00, 0x00, 0x10, 0x10, 0x20, 0x08, 0x00, 0x01, 0x04, 0x80,
+    0x82, 0x00, 0x00, 0x12, 0x01, 0x00, 0x10, 0xD8, 0x70, 0x00,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x0A, 0x0F, 0x03, 0x40, 0x0F,
+    0x18, 0x02, 0x9F, 0x40, 0x50, 0x0F, 0x02, 0x00, 0x0F, 0x28, 0x00, 0x2F,
+    0x08, 0x01, 0x4F, 0x08, 0x02, 0x8F, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x75 'u'
+    0x60, 0x00, 0x00, 0x24, 0x84, 0x00, 0x00, 0x11, 0x01, 0x81, 0x94, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x60, 0x01,
+    0x81, 0x48, 0x94, 0x02, 0x40, 0x04, 0x00, 0x00,
+    // 0x76 'v'
+    0x60, 0x00, 0x20, 0x00, 0xA0, 0x00, 0x04, 0x00, 0x80, 0xDE, 0x60, 0x00,
+    0x06, 0x72, 0x00, 0x14, 0x00, 0x48, 0x00, 0x10, 0xE4, 0x20, 0x00, 0x80,
+    0x03, 0x00, 0x38, 0x00,
+    // 0x77 'w'
+    0x60, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x10, 0x00, 0x81, 0x30, 0x60, 0x00,
+    0x05, 0x80, 0x00, 0x10, 0x00, 0x20, 0x00, 0x90, 0x28, 0x20, 0x00, 0x80,
+    0x00, 0x38, 0x14, 0x00, 0x00, 0x60, 0x00, 0x14, 0x00, 0x00, 0x83, 0x10,
+    0x00, 0x40, 0x01, 0x00, 0x4C, 0x00,
+    // 0x78 'x'
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x40, 0x08, 0x00, 0x00, 0x00, 0x20,
+    0x0C, 0x08, 0x40, 0x20, 0x00, 0x20, 0x04, 0x0C, 0x09, 0x02, 0x24, 0x30,
+    0x40, 0x08, 0x10, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00,
+    // 0x79 'y'
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x23, 0xA0, 0x00, 0x23, 0x00, 0x00, 0x53, 0x05, 0x00, 0x03,
+    0x00, 0x3C, 0x03, 0x18, 0x00, 0x03, 0x00, 0xCC, 0x03, 0x00, 0x12, 0x03,
+    0x00, 0x24, 0x03, 0x41, 0x90, 0x03, 0x20, 0x20, 0x03, 0x00, 0x00, 0x03,
+    0x86, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x0A, 0x18, 0x10, 0x40, 0x26, 0x80, 0x00, 0x00, 0x12, 0x80, 0x2A,
+    0x12, 0x40, 0x54, 0x08, 0x48, 0x09, 0x20, 0x00, 0x08, 0x00, 0x10, 0x02,
+    0x00, 0x00,
+    // 0x7B '{'
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x09, 0x60, 0x0F,
+    0x00, 0x00, 0x00, 0x1F, 0x04, 0xE6, 0x10, 0x5F, 0x10, 0x00, 0x00, 0x2F,
+    0x03, 0x20, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x7F, 0x00, 0x02, 0x80, 0xBF,
+    0x00, 0x50, 0x14, 0x3F, 0x0A, 0x02, 0x80, 0x3F, 0x40, 0x10, 0x00, 0x3F,
+    0x85, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x61, 0x2F, 0x00, 0x01, 0x00, 0x0F,
+    0x20, 0x22, 0x3D, 0x0F, 0x83, 0x00, 0x80, 0x0F, 0x00, 0x19, 0x00, 0x0F,
+    0x00, 0x04, 0x00, 0x0F, 0x18, 0x00, 0x00, 0x0F,
+    // 0x7E '~'
+    0x27, 0x47, 0x87, 0xA7, 0xA7, 0x87, 0x17, 0x4F, 0x27, 0x0F, 0x07, 0x87,
+    0xA7, 0x07,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x27, 0x00, 0x01, 0x07, 0x00, 0x04, 0x0B,
+    0x71, 0x40, 0x33, 0x10, 0x0D, 0x03, 0x80, 0xC0, 0x03, 0xC0, 0x00, 0x03,
+    // 0xA2 '¢'
+    0x00, 0x0B, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x00, 0x08, 0xC8, 0xAF, 0x01, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x80, 0x8F,
+    0x02, 0x0A, 0x04, 0x0F, 0x00, 0xC1, 0x80, 0x0F, 0x28, 0x08, 0x08, 0x0F,
+    0x80, 0x00, 0x08, 0x0F, 0xA8, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+    0x00, 0x40, 0x40, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x40, 0x87, 0x00, 0x50, 0x17, 0x00, 0x40, 0x87, 0x06, 0x00, 0x57,
+    0x10, 0x10, 0x57, 0x02, 0x40, 0x47, 0x40, 0x40, 0x47, 0x10, 0x40, 0x47,
+    0x00, 0x40, 0x4F, 0xA0, 0x40, 0x07, 0x80, 0x00, 0x47, 0x88, 0x00, 0x67,
+    0x00, 0x00, 0x07, 0x28, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x17, 0x05, 0xC7, 0x48, 0x07, 0x20, 0x87,
+    0x20, 0x17, 0x50, 0x07, 0x10, 0x17, 0x40, 0x07, 0x50, 0x87, 0x0A, 0x27,
+    0x00, 0x57, 0x01, 0x87, 0x40, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x20, 0x00, 0x0F, 0x20, 0x2C, 0x1F, 0x18, 0x28, 0x2F, 0x02, 0x28, 0x2F,
+    0x00, 0x28, 0x4F, 0x00, 0x1A, 0x0F, 0x20, 0x00, 0x0F, 0x00, 0x41, 0x4F,
+    0x00, 0x40, 0x2F, 0x01, 0x18, 0x1F, 0x00, 0x28, 0x0F, 0x00, 0x28, 0x0F,
+    0x30, 0x2C, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x29, 0x01, 0x20, 0x05, 0x00, 0x08, 0x01, 0x12, 0x04, 0x03,
+    0x00, 0x00, 0x03, 0x44, 0x08, 0x03, 0x40, 0x41, 0x09, 0x20, 0x00, 0xC5,
+    0x20, 0x81, 0x01, 0x10, 0x08, 0x89, 0x08, 0x02, 0x11, 0x44, 0x18, 0xC1,
+    0x10, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x01, 0x06, 0x07, 0x00, 0xF0, 0x87, 0x12, 0x00, 0x47,
+    0x08, 0x00, 0x27, 0x50, 0x00, 0x07, 0x40, 0x00, 0x47, 0x02, 0x02, 0x27,
+    0x01, 0x09, 0x07, 0x82, 0x05, 0x0F, 0x8A, 0x00, 0x07, 0x8A, 0x00, 0x07,
+    0x0B, 0x01, 0x2F, 0x00, 0x80, 0x07, 0x00, 0x04, 0x27, 0x40, 0x00, 0x47,
+    0x50, 0x00, 0x07, 0x08, 0x01, 0x27, 0x00, 0x06, 0x47, 0x08, 0x71, 0x07,
+    0x03, 0x02, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x0B, 0x18, 0x07, 0x20, 0x47, 0x49, 0x47, 0xA1, 0x47, 0x82, 0x07,
+    0x0C, 0x43, 0x00, 0x13, 0x04, 0x53, 0x60, 0x93, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x1F, 0x05, 0x1F, 0x00, 0x9F, 0x10, 0x5F, 0x05, 0x3F, 0x48, 0x9F,
+    0x02, 0x1F, 0x09, 0x1F, 0x10, 0x9F, 0x02, 0x5F, 0x09, 0x3F, 0x50, 0x3F,
+    0xA0, 0x1F, 0x00, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x00, 0x21, 0x05, 0x81, 0x10, 0x05, 0x40, 0x01, 0x3F, 0xF1,
+    0x10, 0x13, 0x56, 0x55, 0xD0, 0xA5, 0x41, 0x21, 0x8E, 0x45, 0x20, 0x19,
+    0x40, 0x15, 0x04, 0x69, 0x18, 0x01, 0x02, 0xC1,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x20, 0x3F, 0x00, 0xBF, 0x12, 0x3F, 0x80, 0x7F, 0x81, 0x3F,
+    0xA0, 0x7F, 0x00, 0x3F, 0x00, 0xBF, 0x32, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x79, 0xF8, 0x7F, 0x80, 0x08, 0x7F, 0x80, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x01, 0x00, 0x7F,
+    // 0xB2 '²'
+    0x00, 0x17, 0x00, 0x23, 0x20, 0x03, 0x00, 0x53, 0x00, 0x93, 0x00, 0x53,
+    0x00, 0x13, 0x0C, 0x13, 0x00, 0x17, 0x24, 0x03, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x07, 0x00, 0x03, 0x38, 0x03, 0x0A, 0x83, 0x50, 0x17, 0x00, 0x87,
+    0x00, 0x4B, 0x02, 0x03, 0x44, 0x43, 0x18, 0x03,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x67, 0x00, 0x0A, 0x03, 0x02, 0x80, 0x13,
+    0x50, 0x02, 0x03, 0x80, 0xE0, 0x03, 0x14, 0x01, 0x03, 0xC0, 0x01, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x10, 0x03, 0x00, 0x48, 0x03,
+    0x14, 0x00, 0x03, 0x00, 0x20, 0x03, 0x05, 0x08, 0x03, 0x60, 0x0A, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02,
+    0x10, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0D, 0x08,
+    0x00, 0x00, 0x40, 0x00, 0x0A, 0x30, 0x81, 0x42, 0x80, 0x88, 0x50, 0x00,
+    0x0A, 0x05, 0x00, 0x00, 0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0xB7 '·'
+    0x47, 0x87, 0x07, 0x97, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x0F, 0x00, 0x03, 0x20, 0x03, 0x01, 0x43, 0x58, 0x03, 0x40, 0xB3,
+    0x08, 0x07, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x0B, 0x02, 0x17, 0x00, 0x87, 0x00, 0x07, 0x18, 0x07, 0x80, 0x07,
+    0x81, 0x07, 0xA6, 0x13, 0x80, 0x93, 0x02, 0x13, 0x10, 0x03,
+    // 0xBB '»'
+    0x00, 0x1F, 0x00, 0x5F, 0x40, 0x9F, 0x91, 0x5F, 0x0E, 0x1F, 0x00, 0x9F,
+    0x01, 0x1F, 0x0E, 0x1F, 0x60, 0x3F, 0x12, 0x1F, 0x04, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x04, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01, 0x08, 0xA2, 0x01,
+    0x2C, 0x02, 0x01, 0x00, 0x52, 0x01, 0x4A, 0x08, 0x01, 0x20, 0x00, 0x11,
+    0x00, 0x00, 0x45, 0x00, 0x00, 0x11, 0x00, 0x01, 0x21, 0x00, 0x04, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x90, 0x01,
+    0x02, 0x40, 0x81, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x04, 0x01, 0x81,
+    0x40, 0x02, 0x01, 0x10, 0x04, 0x01, 0x00, 0x08, 0xA1, 0x00, 0x1A, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x40, 0x01,
+    // 0xBD '½'
+    0x00, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01, 0x08, 0xA2, 0x01,
+    0x2C, 0x02, 0x01, 0x00, 0x52, 0x0D, 0x4A, 0x08, 0x01, 0x20, 0x00, 0x41,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x21, 0x00, 0x04, 0x81, 0x00, 0x09, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x02, 0x40, 0x01,
+    0x04, 0x00, 0x11, 0x10, 0x00, 0x21, 0x04, 0x00, 0x01, 0x00, 0x40, 0x01,
+    0x40, 0x00, 0xA1, 0x00, 0xA0, 0x41, 0x00, 0x22, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x99, 0x01, 0x00, 0x00, 0x19, 0x00, 0x10, 0x01,
+    // 0xBE '¾'
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x08, 0x08, 0x01, 0x08, 0x08, 0x01,
+    0x00, 0x0A, 0x01, 0x42, 0x10, 0x01, 0x40, 0x64, 0x01, 0x48, 0x00, 0x11,
+    0x22, 0x90, 0x05, 0x18, 0x00, 0x41, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x81, 0x00, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01,
+    0x01, 0x00, 0x01, 0x02, 0x40, 0x81, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0xA1,
+    0x00, 0x1A, 0x01, 0x00, 0x80, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x40, 0x01,
+    // 0xBF '¿'
+    0x00, 0x01, 0x47, 0x00, 0x04, 0x07, 0x00, 0x00, 0x87, 0x00, 0x02, 0x07,
+    0x02, 0x00, 0x0F, 0x00, 0x48, 0x07, 0x10, 0x90, 0x07, 0x90, 0x20, 0x17,
+    0x93, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x31, 0x5F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x04, 0x28, 0x1F, 0x20, 0x19, 0x08, 0x1F, 0x90, 0x26, 0x08, 0x1F,
+    0x08, 0x08, 0x08, 0x1F, 0x49, 0x18, 0x08, 0x1F, 0x21, 0x01, 0x68, 0x1F,
+    0x05, 0x40, 0x06, 0xDF, 0x08, 0x0A, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x31, 0x5F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x04, 0x28, 0x1F, 0x00, 0x19, 0x08, 0x1F, 0x00, 0x26, 0x08, 0x1F,
+    0x14, 0x08, 0x08, 0x1F, 0x01, 0x18, 0x08, 0x1F, 0x01, 0x01, 0x68, 0x1F,
+    0x01, 0x40, 0x06, 0xDF, 0x40, 0x0A, 0x00, 0x1F, 0x90, 0x00, 0x50, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x31, 0x5F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x04, 0x28, 0x1F, 0x0C, 0x19, 0x08, 0x1F, 0x10, 0x26, 0x08, 0x1F,
+    0x20, 0x08, 0x08, 0x1F, 0x41, 0x18, 0x08, 0x1F, 0x91, 0x01, 0x68, 0x1F,
+    0x01, 0x40, 0x06, 0xDF, 0x48, 0x0A, 0x00, 0x1F, 0x20, 0x00, 0x50, 0x1F,
+    0x04, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x31, 0x5F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x04, 0x28, 0x1F, 0x00, 0x19, 0x08, 0x1F, 0x40, 0x26, 0x08, 0x1F,
+    0x10, 0x08, 0x08, 0x1F, 0x91, 0x18, 0x08, 0x1F, 0x41, 0x01, 0x68, 0x1F,
+    0x21, 0x40, 0x06, 0xDF, 0x08, 0x0A, 0x00, 0x1F, 0x48, 0x00, 0x50, 0x1F,
+    0x70, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0x62, 0xBF, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x10, 0x3F,
+    0x00, 0x08, 0x50, 0x3F, 0x10, 0x32, 0x10, 0x3F, 0x00, 0x4C, 0x10, 0x3F,
+    0x00, 0x10, 0x10, 0x3F, 0x42, 0x30, 0x10, 0x3F, 0x02, 0x02, 0xD0, 0x3F,
+    0x22, 0x80, 0x0D, 0xBF, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0xA0, 0x3F,
+    0x10, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x18, 0xAF, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x02, 0x14, 0x0F, 0x00, 0x0C, 0x84, 0x0F, 0x00, 0x13, 0x04, 0x0F,
+    0x42, 0x04, 0x04, 0x0F, 0x84, 0x8C, 0x04, 0x0F, 0x00, 0x80, 0xB4, 0x0F,
+    0x80, 0xA0, 0x03, 0x6F, 0x02, 0x05, 0x00, 0x0F, 0x2C, 0x00, 0x28, 0x0F,
+    0x00, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x09, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x24, 0x0F, 0x00, 0x84, 0x0F, 0x00, 0x04, 0x2F, 0x02, 0x44, 0x2F,
+    0x01, 0x04, 0x0F, 0x30, 0x05, 0x0F, 0x04, 0xA0, 0x0F, 0x0C, 0x00, 0x8F,
+    0x00, 0x14, 0x0F, 0x02, 0x80, 0x0F, 0x10, 0x00, 0x0F, 0x20, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x20, 0x00, 0x0F, 0x20, 0x01, 0x8F, 0x20, 0x40, 0x3F,
+    0x18, 0x00, 0x8F, 0x04, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
+    // 0xC7 'Ç'
+    0x00, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x0F,
+    0x10, 0x40, 0x10, 0x0F, 0x22, 0x00, 0x90, 0x0F, 0x00, 0x00, 0x02, 0x1F,
+    0x40, 0x00, 0x08, 0x0F, 0x10, 0x00, 0x48, 0x0F, 0x80, 0x00, 0x08, 0x4F,
+    0x20, 0x00, 0x41, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x40, 0x0F,
+    0x80, 0x00, 0x80, 0x0F, 0x10, 0x00, 0x20, 0x0F, 0x80, 0x01, 0x40, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x00, 0x45, 0x00, 0x1F,
+    0x00, 0x60, 0x05, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x14, 0x80, 0x1F,
+    0x40, 0x40, 0x80, 0x1F, 0x80, 0x40, 0x80, 0x1F, 0x00, 0x40, 0x00, 0x9F,
+    0x00, 0x40, 0x00, 0x1F, 0x14, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x38, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x01, 0xA0, 0x00, 0x1F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x00, 0x45, 0x00, 0x1F,
+    0x00, 0x60, 0x05, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x14, 0x80, 0x1F,
+    0x00, 0x40, 0x80, 0x1F, 0x0C, 0x40, 0x80, 0x1F, 0x10, 0x40, 0x00, 0x9F,
+    0x20, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F, 0x48, 0x00, 0x80, 0x7F,
+    0x90, 0x38, 0x01, 0x1F, 0xE0, 0x08, 0x00, 0x1F, 0x01, 0xA0, 0x00, 0x1F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x00, 0x45, 0x00, 0x1F,
+    0x00, 0x60, 0x05, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x14, 0x80, 0x1F,
+    0x04, 0x40, 0x80, 0x1F, 0x20, 0x40, 0x80, 0x1F, 0x48, 0x40, 0x00, 0x9F,
+    0x80, 0x40, 0x00, 0x1F, 0x10, 0x00, 0x03, 0x1F, 0x80, 0x00, 0x80, 0x7F,
+    0x04, 0x38, 0x01, 0x1F, 0x10, 0x08, 0x00, 0x1F, 0x01, 0xA0, 0x00, 0x1F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x05, 0x3F, 0x01, 0x00, 0x50, 0x3F, 0x00, 0x8A, 0x00, 0x3F,
+    0x00, 0xC0, 0x0A, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x29, 0x00, 0x3F,
+    0x80, 0x81, 0x00, 0x3F, 0x10, 0x81, 0x00, 0x3F, 0x40, 0x80, 0x01, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x50, 0x01, 0x00, 0xFF,
+    0x00, 0x70, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x23, 0x40, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x40, 0x45, 0x00, 0x1F,
+    0x80, 0x60, 0x05, 0x1F, 0x48, 0x00, 0xA0, 0x5F, 0x08, 0x0C, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x14, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x00, 0x45, 0x00, 0x1F,
+    0x08, 0x60, 0x05, 0x1F, 0x04, 0x00, 0xA0, 0x5F, 0x00, 0x0C, 0x00, 0x1F,
+    0x28, 0x40, 0x00, 0x1F, 0x48, 0x40, 0x00, 0x1F, 0x00, 0x80, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x0C, 0x80, 0x28, 0x1F, 0x04, 0x45, 0x00, 0x1F,
+    0x04, 0x60, 0x05, 0x1F, 0x08, 0x00, 0xA0, 0x5F, 0x10, 0x0C, 0x00, 0x1F,
+    0x00, 0x40, 0x00, 0x1F, 0x90, 0x40, 0x00, 0x1F, 0x08, 0x80, 0x00, 0x1F,
+    0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x05, 0x3F, 0x51, 0x00, 0x50, 0x3F, 0x80, 0x8A, 0x00, 0x3F,
+    0x10, 0xC0, 0x0A, 0x3F, 0x80, 0x01, 0x40, 0xBF, 0x00, 0x18, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x30, 0x80, 0x00, 0x3F, 0x81, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x47,
+    0x60, 0x04, 0x07, 0x22, 0x80, 0x07, 0xB0, 0x02, 0x87, 0x00, 0x00, 0x07,
+    0x0A, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x47,
+    0x80, 0x00, 0x57, 0x20, 0x00, 0x87, 0x90, 0x01, 0x07, 0x00, 0x00, 0x47,
+    0x04, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x02, 0x8F, 0x01, 0x00, 0x50, 0x0F, 0x00, 0x42, 0x00, 0x8F,
+    0x00, 0x20, 0x14, 0x4F, 0x00, 0x02, 0x80, 0x4F, 0x01, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x48, 0x00, 0x60, 0x0F, 0x10, 0x04, 0x18, 0x0F,
+    0x80, 0x01, 0x82, 0x0F, 0x10, 0x00, 0x20, 0x0F, 0x48, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x1F, 0x09, 0x80, 0x50, 0x0F, 0x00, 0x4A, 0x01, 0x4F,
+    0x60, 0x00, 0x28, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x50, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x01, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x21, 0x86, 0x2F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x0F, 0x41, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x05, 0x40, 0x01, 0x0F, 0x08, 0x00, 0x02, 0x4F, 0x00, 0x10, 0x00, 0x0F,
+    0x00, 0x0B, 0x20, 0x0F, 0x00, 0x40, 0x02, 0x0F, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x08, 0x40, 0x0F,
+    // 0xD3 'Ó'
+    0x00, 0x01, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x21, 0x86, 0x2F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x01, 0x0F, 0x40, 0x00, 0x02, 0x4F, 0x90, 0x10, 0x00, 0x0F,
+    0xE0, 0x0B, 0x20, 0x0F, 0x00, 0x40, 0x02, 0x0F, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x08, 0x40, 0x0F,
+    // 0xD4 'Ô'
+    0x00, 0x01, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x21, 0x86, 0x2F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x1F, 0x08, 0x20, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x0F,
+    0x11, 0x40, 0x01, 0x0F, 0x08, 0x00, 0x02, 0x4F, 0x04, 0x10, 0x00, 0x0F,
+    0x00, 0x0B, 0x20, 0x0F, 0x00, 0x40, 0x02, 0x0F, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x08, 0x40, 0x0F,
+    // 0xD5 'Õ'
+    0x00, 0x01, 0x64, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x21, 0x86, 0x2F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x1F, 0x38, 0x20, 0x00, 0x1F, 0x09, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x00, 0x0F,
+    0x21, 0x40, 0x01, 0x0F, 0x00, 0x00, 0x02, 0x4F, 0x40, 0x10, 0x00, 0x0F,
+    0x00, 0x0B, 0x20, 0x0F, 0x00, 0x40, 0x02, 0x0F, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x08, 0x40, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x02, 0xC8, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x43, 0x0C, 0x5F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x50, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x1F, 0x22, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x22, 0x80, 0x02, 0x1F, 0x10, 0x00, 0x04, 0x9F, 0x00, 0x20, 0x00, 0x1F,
+    0x10, 0x16, 0x40, 0x1F, 0x40, 0x80, 0x04, 0x1F, 0x00, 0x00, 0x30, 0x1F,
+    0x00, 0x10, 0x80, 0x1F,
+    // 0xD7 '×'
+    0x40, 0x5F, 0x80, 0x3F, 0x80, 0x3F, 0x40, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x24, 0x9F, 0x40, 0x5F, 0x80, 0x3F, 0x80, 0x3F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0xB6, 0x17, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x10, 0xC2, 0x17, 0x20, 0x04, 0x87, 0x00, 0x08, 0x47,
+    0x00, 0x10, 0x0F, 0x10, 0x24, 0x0F, 0x80, 0x08, 0x07, 0x00, 0x10, 0x07,
+    0x80, 0x20, 0x17, 0x80, 0x40, 0x17, 0xA0, 0x80, 0x87, 0x00, 0x01, 0x27,
+    0x08, 0x00, 0x07, 0x01, 0x90, 0x07, 0x00, 0x01, 0x07, 0x50, 0x0C, 0x07,
+    0x24, 0x20, 0x07, 0x40, 0x00, 0x07,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x06, 0x0F, 0x01, 0x40, 0xA0, 0x8F, 0x00, 0x14, 0x00, 0x0F,
+    0x00, 0x00, 0x12, 0x2F, 0x00, 0x02, 0x80, 0x0F, 0x00, 0x10, 0x00, 0x8F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x8F, 0x48, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x04, 0x00, 0x04, 0x4F, 0x09, 0x80, 0x50, 0x8F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x28, 0x0F, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x06, 0x0F, 0x01, 0x40, 0xA0, 0x8F, 0x00, 0x14, 0x00, 0x0F,
+    0x00, 0x00, 0x12, 0x2F, 0x00, 0x02, 0x80, 0x0F, 0x00, 0x10, 0x00, 0x8F,
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x14, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x04, 0x4F, 0x41, 0x80, 0x50, 0x8F, 0x90, 0x0A, 0x00, 0x0F,
+    0xE0, 0x00, 0x28, 0x0F, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x06, 0x0F, 0x01, 0x40, 0xA0, 0x8F, 0x00, 0x14, 0x00, 0x0F,
+    0x00, 0x00, 0x12, 0x2F, 0x00, 0x02, 0x80, 0x0F, 0x00, 0x10, 0x00, 0x8F,
+    0x00, 0x40, 0x00, 0x1F, 0x0C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x08, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x01, 0x0F,
+    0x10, 0x00, 0x04, 0x4F, 0x09, 0x80, 0x50, 0x8F, 0x04, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x28, 0x0F, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x0C, 0x1F, 0x02, 0x81, 0x41, 0x1F, 0x00, 0x28, 0x00, 0x1F,
+    0x00, 0x00, 0x24, 0x5F, 0x00, 0x05, 0x00, 0x1F, 0x00, 0x20, 0x01, 0x1F,
+    0x00, 0x80, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F,
+    0x20, 0x00, 0x08, 0x9F, 0x13, 0x00, 0xA1, 0x1F, 0x00, 0x14, 0x00, 0x1F,
+    0x10, 0x00, 0x50, 0x1F, 0x40, 0x0A, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x4F,
+    0x40, 0x14, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x04, 0xAF, 0x00, 0x62, 0x0F,
+    0x02, 0x02, 0x0F, 0x28, 0x00, 0x0F, 0x08, 0x01, 0x0F, 0x8A, 0x05, 0x0F,
+    0x02, 0x08, 0x0F, 0x01, 0xB0, 0x0F, 0x04, 0x04, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x20, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x14, 0x07, 0x00, 0x01, 0x40, 0x07,
+    0x00, 0x28, 0x01, 0x07, 0x03, 0x00, 0x50, 0x07, 0x08, 0x0A, 0x00, 0x07,
+    0x20, 0xA0, 0x24, 0x07, 0x4C, 0x00, 0x20, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x18, 0x02, 0x07, 0x80, 0x00, 0x0A, 0x07, 0x00, 0x82, 0x08, 0x07,
+    0x22, 0x01, 0x10, 0x07, 0x08, 0x84, 0x60, 0x07, 0x02, 0x02, 0x00, 0x07,
+    0x3C, 0x01, 0xC0, 0x07,
+    // 0xE0 'à'
+    0x00, 0x01, 0x68, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x21, 0x01,
+    0x00, 0x48, 0x00, 0x20, 0x10, 0x00, 0x10, 0x80, 0x10, 0x88, 0x00, 0x20,
+    0x20, 0x20, 0x50, 0x12, 0x90, 0x02, 0x00, 0x08, 0x01, 0x00, 0x40, 0xA8,
+    0x00, 0x8A, 0x08, 0x00, 0xE0, 0x10, 0x00, 0x00, 0x18,
+    // 0xE1 'á'
+    0x00, 0x01, 0x68, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x21, 0x01,
+    0x00, 0x48, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x20,
+    0x08, 0x20, 0x50, 0x20, 0x90, 0x02, 0x08, 0x08, 0x01, 0x90, 0x40, 0xA8,
+    0xA0, 0x8A, 0x08, 0x00, 0xE0, 0x10, 0x00, 0x00, 0x18,
+    // 0xE2 'â'
+    0x00, 0x01, 0x68, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x21, 0x01,
+    0x00, 0x48, 0x00, 0x08, 0x10, 0x00, 0x12, 0x80, 0x10, 0x04, 0x00, 0x20,
+    0x48, 0x20, 0x50, 0x90, 0x90, 0x02, 0x08, 0x08, 0x01, 0x02, 0x40, 0xA8,
+    0x02, 0x8A, 0x08, 0x00, 0xE0, 0x10, 0x00, 0x00, 0x18,
+    // 0xE3 'ã'
+    0x00, 0x02, 0xD1, 0x00, 0x00, 0x05, 0x00, 0x20, 0x01, 0x00, 0x42, 0x03,
+    0x00, 0x90, 0x01, 0x28, 0x20, 0x01, 0x09, 0x00, 0x21, 0x20, 0x00, 0x41,
+    0x10, 0x40, 0xA1, 0x09, 0x20, 0x05, 0x28, 0x10, 0x03, 0x00, 0x81, 0x51,
+    0x81, 0x14, 0x11, 0x41, 0xC0, 0x21, 0x00, 0x00, 0x31,
+    // 0xE4 'ä'
+    0x00, 0x05, 0xA3, 0x00, 0x00, 0x0B, 0x00, 0x40, 0x03, 0x00, 0x84, 0x07,
+    0x01, 0x20, 0x03, 0x90, 0x40, 0x03, 0x82, 0x00, 0x43, 0x80, 0x00, 0x83,
+    0x40, 0x81, 0x43, 0x02, 0x40, 0x0B, 0x40, 0x20, 0x07, 0x01, 0x02, 0xA3,
+    0x92, 0x28, 0x23, 0x03, 0x80, 0x43, 0x00, 0x00, 0x63,
+    // 0xE5 'å'
+    0x00, 0x00, 0xB4, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x10, 0x80, 0xFF, 0x00, 0x24, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x12, 0x40, 0x08, 0x7F, 0x41, 0x00, 0x10, 0x7F, 0x00, 0x10, 0x28, 0x7F,
+    0x22, 0x48, 0x01, 0x7F, 0x19, 0x04, 0x00, 0xFF, 0x00, 0x20, 0x54, 0x7F,
+    0x38, 0x45, 0x04, 0x7F, 0x00, 0x70, 0x08, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0xE6 'æ'
+    0x01, 0x68, 0x00, 0x02, 0x10, 0x00, 0x21, 0x01, 0x08, 0x08, 0x50, 0x08,
+    0x80, 0x14, 0x00, 0x40, 0x01, 0x80, 0x26, 0x04, 0x00, 0x02, 0x42, 0x50,
+    0x40, 0x49, 0x50, 0x00, 0x02, 0x80, 0x00, 0x82, 0x25, 0x00, 0x10, 0x00,
+    0x02, 0x10, 0x70, 0x00,
+    // 0xE7 'ç'
+    0x00, 0xD0, 0x01, 0x0C, 0x02, 0x01, 0x00, 0x00, 0x0B, 0x26, 0x09, 0x01,
+    0x00, 0x01, 0x05, 0x00, 0x00, 0x89, 0xA0, 0x0A, 0x41, 0x20, 0x0A, 0x01,
+    0x00, 0x14, 0x01, 0x80, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x20, 0x00, 0x03, 0x01,
+    0x00, 0x50, 0x41, 0x00, 0x20, 0x00, 0x00, 0xA0, 0x08, 0x04, 0x04, 0x08,
+    0x12, 0x00, 0x00, 0x04, 0x82, 0x14, 0x00, 0x40, 0x10, 0x00, 0x30, 0x00,
+    // 0xE9 'é'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x20, 0x00, 0x03, 0x01,
+    0x00, 0x50, 0x41, 0x00, 0x20, 0x00, 0x04, 0xA0, 0x08, 0x10, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x40, 0x82, 0x14, 0x80, 0x40, 0x10, 0x00, 0x30, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x20, 0x04, 0x03, 0x01,
+    0x08, 0x50, 0x41, 0x00, 0x20, 0x00, 0x24, 0xA0, 0x08, 0x40, 0x04, 0x08,
+    0x90, 0x00, 0x00, 0x00, 0x82, 0x14, 0x02, 0x40, 0x10, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x03, 0x43, 0x00, 0x30, 0x0B, 0x00, 0x00, 0x83, 0x20, 0x0C, 0x07,
+    0x81, 0x41, 0x07, 0x80, 0x80, 0x03, 0x82, 0x80, 0x23, 0x00, 0x10, 0x23,
+    0x00, 0x00, 0x03, 0x22, 0x08, 0x53, 0x01, 0x00, 0x43, 0x90, 0xC0, 0x03,
+    0xC0, 0x00, 0x03,
+    // 0xEC 'ì'
+    0x00, 0x20, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x84, 0x01, 0x88, 0xB0, 0x10,
+    0x00, 0x01, 0x08, 0x20, 0x94, 0x04, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+    // 0xED 'í'
+    0x00, 0x20, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x84, 0x01, 0x00, 0xB0, 0x10,
+    0x00, 0x01, 0x08, 0x00, 0x94, 0x04, 0x24, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x20, 0x00, 0x00,
+    // 0xEE 'î'
+    0x00, 0x20, 0x0C, 0x02, 0x00, 0x20, 0x00, 0x84, 0x01, 0x10, 0xB0, 0x10,
+    0x00, 0x01, 0x08, 0x10, 0x94, 0x04, 0x90, 0x00, 0x10, 0x88, 0x00, 0x00,
+    0x62, 0x00, 0x00, 0x14, 0x00, 0x00,
+    // 0xEF 'ï'
+    0x00, 0x80, 0x33, 0x40, 0x00, 0x83, 0x02, 0x10, 0x07, 0x92, 0xC0, 0x43,
+    0x00, 0x04, 0x23, 0x02, 0x50, 0x13, 0x00, 0x00, 0x43, 0x50, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x08, 0x00, 0x00, 0x20, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x06, 0x00, 0x05, 0x42, 0x00, 0x00,
+    0x18, 0x20, 0x02, 0x00, 0x00, 0x12, 0x22, 0x10, 0x60, 0x28, 0xC5, 0x00,
+    0x16, 0x00, 0x20, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00,
+    // 0xF1 'ñ'
+    0x00, 0x40, 0x09, 0x00, 0x00, 0xA1, 0x01, 0x04, 0x01, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x01, 0x68, 0x30, 0x01, 0x18, 0x08, 0x01, 0x20, 0x50, 0x01,
+    0x10, 0x20, 0x01, 0x48, 0x00, 0x55, 0x28, 0x05, 0x03, 0x00, 0x30, 0x01,
+    0x80, 0x01, 0x05, 0x40, 0x14, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0xF2 'ò'
+    0x00, 0x02, 0x90, 0x00, 0x08, 0x00, 0x00, 0x10, 0x02, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x05, 0x10, 0xA0, 0x00, 0x88, 0x00, 0x02,
+    0x20, 0x00, 0x02, 0x12, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x30, 0xC0, 0x00, 0x00, 0x00,
+    // 0xF3 'ó'
+    0x00, 0x02, 0x90, 0x00, 0x08, 0x00, 0x00, 0x10, 0x02, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02,
+    0x08, 0x00, 0x02, 0x20, 0x00, 0x40, 0x08, 0x0F, 0x00, 0x90, 0x00, 0x10,
+    0xA0, 0x30, 0xC0, 0x00, 0x00, 0x00,
+    // 0xF4 'ô'
+    0x00, 0x02, 0x90, 0x00, 0x08, 0x00, 0x00, 0x10, 0x02, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x12, 0xA0, 0x00, 0x04, 0x00, 0x02,
+    0x48, 0x00, 0x02, 0x90, 0x00, 0x40, 0x08, 0x0F, 0x00, 0x44, 0x00, 0x10,
+    0x12, 0x30, 0xC0, 0x00, 0x00, 0x00,
+    // 0xF5 'õ'
+    0x00, 0x05, 0x21, 0x00, 0x10, 0x01, 0x00, 0x20, 0x05, 0x00, 0x40, 0x11,
+    0x00, 0x00, 0x03, 0x28, 0x00, 0x0B, 0x09, 0x40, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x05, 0x08, 0x00, 0x81, 0x28, 0x1E, 0x01, 0x20, 0x00, 0x21,
+    0x80, 0x61, 0x81, 0x40, 0x00, 0x01,
+    // 0xF6 'ö'
+    0x00, 0x0A, 0x43, 0x00, 0x20, 0x03, 0x00, 0x40, 0x0B, 0x00, 0x80, 0x23,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x17, 0x82, 0x80, 0x03, 0x80, 0x00, 0x0B,
+    0x40, 0x00, 0x0B, 0x00, 0x01, 0x03, 0x40, 0x3C, 0x03, 0x00, 0x00, 0x43,
+    0x90, 0xC3, 0x03, 0x00, 0x00, 0x03,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x90, 0x0F,
+    0x80, 0x0F, 0x90, 0x47, 0x60, 0x37, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x05, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x90, 0x08, 0x00, 0x10, 0x02,
+    0x20, 0x00, 0x00, 0x01, 0x01, 0x45, 0xA2, 0x80, 0x00, 0x02, 0x00, 0x02,
+    0x0A, 0x40, 0x03, 0x00, 0x00, 0x10, 0x40, 0xC0, 0xA0, 0x00, 0xC0, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x24, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x01, 0x81, 0x00, 0x94, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x04,
+    0x00, 0x00, 0x08, 0x02, 0x00, 0x80, 0x0E, 0x04, 0x00, 0x00, 0x60, 0x01,
+    0x00, 0x81, 0x48, 0x00, 0x94, 0x02, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0xFA 'ú'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x24, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x01, 0x81, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x08, 0x00, 0x08, 0x04, 0x00, 0x80, 0x48, 0x04, 0x00, 0x00, 0x60, 0x01,
+    0xA0, 0x81, 0x48, 0x00, 0x94, 0x02, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0xFB 'û'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x24, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x01, 0x81, 0x00, 0x94, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x04,
+    0x00, 0x00, 0x08, 0x90, 0x00, 0x80, 0x90, 0x04, 0x00, 0x44, 0x60, 0x01,
+    0x32, 0x81, 0x48, 0x04, 0x94, 0x02, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x01, 0x80, 0x03, 0x00, 0x00, 0x93, 0x02, 0x10, 0x03, 0x00, 0x00, 0x47,
+    0x00, 0x06, 0x07, 0x52, 0x50, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x13,
+    0x00, 0x00, 0x23, 0x00, 0x02, 0x03, 0x20, 0x10, 0x03, 0x81, 0x80, 0x07,
+    0x82, 0x05, 0x23, 0x22, 0x50, 0x0B, 0x01, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x28, 0x0F, 0x20, 0x02, 0x00, 0xAF,
+    0x00, 0x50, 0x06, 0x2F, 0x85, 0x00, 0xC0, 0x2F, 0x00, 0x32, 0x00, 0x17,
+    0x80, 0x88, 0x02, 0x07, 0x28, 0x40, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x24, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x2A, 0x00, 0x07,
+    0x01, 0x00, 0x20, 0x07, 0x00, 0x01, 0x80, 0x07, 0x00, 0x3C, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x8F, 0x02, 0x80, 0x00, 0x8F,
+    0x00, 0x00, 0x01, 0x4F, 0x50, 0x14, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x0F,
+    0x90, 0x60, 0x00, 0x0F, 0x20, 0x03, 0x30, 0x0F, 0x00, 0x00, 0x48, 0x0F,
+    0x20, 0x00, 0x90, 0x0F, 0x81, 0x06, 0x40, 0x0F, 0x80, 0x80, 0x80, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x02, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x18, 0xA0, 0x3F, 0x00, 0x20, 0x30, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x02, 0x14, 0x00, 0x3F, 0x0C, 0x84, 0x00, 0x3F, 0x13, 0x04, 0x00, 0x3F,
+    0x04, 0x04, 0x00, 0x3F, 0x8C, 0x04, 0x00, 0x3F, 0x80, 0xB4, 0x02, 0xBF,
+    0xA0, 0x03, 0x64, 0x7F, 0x05, 0x00, 0x00, 0x7F, 0x00, 0x28, 0x05, 0x3F,
+    0x00, 0x01, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x3F,
+    // 0x105 'ą'
+    0x01, 0x68, 0x07, 0x00, 0x02, 0x07, 0x10, 0x00, 0x07, 0x21, 0x01, 0x07,
+    0x48, 0x00, 0x07, 0x10, 0x00, 0x07, 0x80, 0x10, 0x07, 0x00, 0x20, 0x07,
+    0x20, 0x50, 0x27, 0x90, 0x02, 0x07, 0x08, 0x00, 0x27, 0x40, 0xA9, 0x07,
+    0x8A, 0x08, 0x07, 0xE0, 0x10, 0x17, 0x00, 0x18, 0x07,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F,
+    0x00, 0x20, 0x80, 0x2F, 0x00, 0x44, 0x01, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x1F,
+    0x0C, 0x40, 0x00, 0x8F, 0x11, 0x00, 0x00, 0x0F, 0x21, 0x40, 0x00, 0x8F,
+    0x01, 0x00, 0x01, 0x0F, 0x08, 0x20, 0x00, 0x4F, 0x81, 0x00, 0x02, 0x8F,
+    0xA0, 0x08, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F,
+    // 0x107 'ć'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xA0, 0x0A, 0x10, 0x20, 0x0A,
+    0x00, 0x00, 0x14, 0x40, 0x80, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x10, 0x40, 0x17, 0x00, 0x22, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x0F, 0x40, 0x10, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x0F,
+    0x44, 0x20, 0x00, 0x47, 0x10, 0x80, 0x00, 0x07, 0x02, 0xA0, 0x00, 0x47,
+    0x00, 0x80, 0x00, 0x87, 0x00, 0x10, 0x00, 0x27, 0x40, 0x80, 0x01, 0x47,
+    0x10, 0x04, 0x00, 0x07, 0x60, 0x50, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x10D 'č'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x09,
+    0x20, 0x00, 0x01, 0x08, 0x00, 0x00, 0x04, 0xA0, 0x0A, 0x00, 0x20, 0x0A,
+    0x10, 0x00, 0x14, 0x20, 0x80, 0x08, 0x50, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x47, 0x00, 0x60, 0x14, 0x07, 0x00, 0x22, 0x80, 0x07,
+    0x00, 0xB0, 0x02, 0x87, 0x00, 0x00, 0x50, 0x07, 0x00, 0x0A, 0x00, 0x07,
+    0x40, 0xA0, 0x00, 0x07, 0x40, 0xA0, 0x00, 0x07, 0x02, 0xA0, 0x00, 0x47,
+    0x12, 0x80, 0x00, 0x57, 0x00, 0x20, 0x00, 0x87, 0x04, 0x90, 0x01, 0x07,
+    0x08, 0x00, 0x00, 0x47, 0x50, 0x04, 0x00, 0x07, 0x00, 0x00, 0x80, 0x07,
+    0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x5A, 0x3F, 0x00, 0x01, 0x00, 0xBF, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x08, 0x40, 0x7F, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x20, 0x04, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x08, 0x14, 0x3F,
+    0x04, 0x24, 0x00, 0xBF, 0x00, 0x02, 0x00, 0x7F, 0x11, 0x40, 0x2A, 0x3F,
+    0x00, 0x02, 0x02, 0x3F, 0x10, 0x10, 0x04, 0x3F, 0x1D, 0x00, 0x06, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x05, 0x00, 0x00, 0x3F, 0x21, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x40, 0x14, 0x00, 0x3F, 0x22, 0x80, 0x00, 0x3F,
+    0x30, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0A, 0x40, 0x00, 0x3F,
+    0x20, 0x40, 0x01, 0x3F, 0x20, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x48, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x88, 0x3F, 0x00, 0x40, 0x30, 0xBF,
+    0x1C, 0x00, 0x80, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
+    // 0x119 'ę'
+    0x00, 0xD0, 0x07, 0x0C, 0x02, 0x07, 0x00, 0x20, 0x07, 0x03, 0x01, 0x57,
+    0x50, 0x41, 0x87, 0x20, 0x00, 0x47, 0xA0, 0x08, 0x07, 0x04, 0x08, 0x07,
+    0x00, 0x00, 0x07, 0x82, 0x14, 0x07, 0x40, 0x10, 0x07, 0x30, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x4F, 0x00, 0x40, 0x14, 0x0F, 0x00, 0x22, 0x80, 0x0F,
+    0x00, 0x30, 0x02, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x0A, 0x40, 0x0F,
+    0x00, 0x20, 0x40, 0x0F, 0x04, 0x20, 0x40, 0x0F, 0x10, 0x20, 0x00, 0x4F,
+    0x02, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x40, 0x3F,
+    0x40, 0x1C, 0x00, 0x8F, 0x10, 0x04, 0x00, 0x0F, 0x60, 0xD0, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x00, 0xD0, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x20, 0x00, 0x03, 0x01,
+    0x20, 0x50, 0x41, 0x08, 0x20, 0x00, 0x04, 0xA0, 0x08, 0x00, 0x04, 0x08,
+    0x10, 0x00, 0x00, 0x20, 0x82, 0x14, 0x50, 0x40, 0x10, 0x20, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x9F, 0x00, 0x80, 0x28, 0x1F, 0x00, 0x45, 0x00, 0x1F,
+    0x08, 0x60, 0x05, 0x1F, 0x04, 0x00, 0xA0, 0x1F, 0x00, 0x0C, 0x00, 0x1F,
+    0x28, 0x40, 0x00, 0x1F, 0x48, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x10, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x9F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x5B, 0x00, 0xC0, 0x05, 0x03, 0x04, 0x00, 0x20, 0x03,
+    0x15, 0x0A, 0x01, 0x43, 0x00, 0x40, 0x10, 0x0B, 0x01, 0x02, 0x80, 0x43,
+    0x08, 0x28, 0x00, 0x63, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x50, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x53,
+    0x10, 0x05, 0x03, 0x08, 0xA0, 0x03, 0x0C, 0x00, 0xA3, 0x00, 0x14, 0x03,
+    0x01, 0x80, 0x03, 0x08, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x13, 0x08, 0x00, 0x23, 0x82, 0x00, 0x03, 0x0C, 0x00, 0x13,
+    0x40, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x05, 0xBF, 0x0C, 0x00, 0x50, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x10, 0xA0, 0x14, 0x3F, 0x04, 0x01, 0x00, 0xBF, 0x10, 0x28, 0x04, 0x3F,
+    0x02, 0x80, 0x06, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x58, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x21, 0x4F,
+    0x40, 0x2C, 0x0F, 0x22, 0x80, 0x0F, 0x30, 0x02, 0x8F, 0x00, 0x30, 0x0F,
+    0x06, 0x80, 0x0F, 0x20, 0x40, 0x0F, 0x20, 0x40, 0x0F, 0x00, 0x80, 0x4F,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x2D, 0x60, 0x16, 0x81,
+    0x00, 0x00, 0x01, 0x85, 0x00, 0xA1, 0x20, 0x08, 0x05, 0x81, 0x00, 0x21,
+    0x14, 0x80, 0x31, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x02, 0x8F, 0x01, 0x00, 0x50, 0x0F, 0x00, 0x42, 0x00, 0x8F,
+    0x00, 0x20, 0x14, 0x4F, 0x00, 0x02, 0x80, 0x4F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x04, 0x18, 0x0F,
+    0x04, 0x01, 0x82, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x28, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x02, 0x1F, 0x01, 0x80, 0x50, 0x0F, 0x10, 0x4A, 0x01, 0x4F,
+    0x00, 0x00, 0x28, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x50, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x144 'ń'
+    0x00, 0x20, 0x04, 0x00, 0x00, 0x50, 0x00, 0x82, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x10, 0x00, 0x20, 0x00, 0x2A, 0x08, 0x02, 0x81, 0x90, 0x18, 0x00,
+    0x80, 0x00, 0x82, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x47, 0x00, 0x80, 0x28, 0x07, 0x00, 0x21, 0x00, 0x47,
+    0x00, 0x10, 0x0A, 0x27, 0x00, 0x01, 0x40, 0x27, 0x00, 0x80, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x48, 0x00, 0x30, 0x07, 0x04, 0x02, 0x0C, 0x07,
+    0x20, 0x00, 0xC1, 0x07, 0x02, 0x00, 0x10, 0x07, 0x12, 0x00, 0x00, 0x07,
+    0x24, 0x00, 0x01, 0x0F, 0x00, 0xC0, 0x28, 0x07, 0x40, 0x25, 0x00, 0xA7,
+    0x20, 0x00, 0x14, 0x07, 0x00, 0x01, 0x00, 0x07, 0x00, 0x28, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x20, 0x04, 0x00, 0x00, 0x50, 0x00, 0x82, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x20, 0x18, 0x00, 0x08, 0x04, 0x00, 0x04, 0x28, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x2A, 0x20, 0x02, 0x81, 0x50, 0x18, 0x00,
+    0x20, 0x00, 0x82, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0x152 'Œ'
+    0x00, 0x32, 0x07, 0x03, 0x00, 0x07, 0x04, 0x00, 0x27, 0x00, 0xC3, 0x17,
+    0x00, 0x00, 0x87, 0x24, 0x00, 0x07, 0x48, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    0x10, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x20, 0x00, 0x07, 0x20, 0x01, 0x47,
+    0x20, 0x28, 0x07, 0x21, 0x00, 0x07, 0x10, 0x01, 0x07, 0x00, 0x10, 0x07,
+    0x0A, 0x40, 0x07, 0x20, 0x40, 0x07, 0x20, 0x40, 0x07, 0x20, 0x00, 0x47,
+    0x20, 0x00, 0x07, 0x20, 0x01, 0x07, 0x00, 0x00, 0x37, 0x18, 0x01, 0x87,
+    0x04, 0x00, 0x07, 0xD0, 0x00, 0x07,
+    // 0x153 'œ'
+    0x02, 0x90, 0x08, 0x00, 0x10, 0x02, 0x20, 0x08, 0x00, 0x01, 0x00, 0x05,
+    0xA0, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x00,
+    0x21, 0x60, 0x0D, 0x09, 0x01, 0x01, 0x20, 0x80, 0x22, 0x8A, 0x00, 0x02,
+    0x09, 0x14, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x01, 0x47, 0x00, 0x60, 0x10, 0x07, 0x00, 0x02, 0x80, 0x07,
+    0x00, 0x30, 0x02, 0x87, 0x40, 0x00, 0x40, 0x27, 0x40, 0x8A, 0x00, 0x37,
+    0x02, 0xA0, 0x04, 0x07, 0x12, 0x80, 0x01, 0x07, 0x00, 0xA0, 0x00, 0x87,
+    0x04, 0x20, 0x04, 0x27, 0x28, 0x93, 0x21, 0x07, 0x10, 0x00, 0x40, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x0C, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x20, 0x03, 0x00, 0x00, 0x31, 0x00, 0x85, 0x01, 0x00, 0x00, 0x09,
+    0x30, 0x00, 0x01, 0x08, 0x50, 0x01, 0x20, 0x14, 0x01, 0x10, 0x40, 0x01,
+    0x04, 0x10, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x20, 0x60, 0x01,
+    0xC0, 0x00, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x05, 0x8F, 0x00, 0x00, 0x08, 0x2F, 0x00, 0x12, 0x0A, 0x2F,
+    0x00, 0x41, 0x00, 0x0F, 0x00, 0x80, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x0C, 0x01, 0x20, 0x0F, 0x11, 0x40, 0x10, 0x8F,
+    0x21, 0x40, 0x89, 0x0F, 0x09, 0x00, 0x40, 0x4F, 0x08, 0x00, 0x20, 0x8F,
+    0x00, 0x00, 0x0F, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x20, 0x08,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x80, 0x04, 0x82, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x01, 0x00, 0x40, 0x10, 0xD8, 0x90, 0x70, 0x00, 0x80, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x04, 0x17, 0x00, 0x09, 0x05, 0x17,
+    0x00, 0x20, 0x80, 0x07, 0x00, 0x40, 0x40, 0x07, 0x40, 0x1E, 0x00, 0x0F,
+    0x08, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x90, 0x07, 0x10, 0xA0, 0x08, 0x47,
+    0x02, 0xA0, 0x44, 0x87, 0x02, 0x80, 0x20, 0x27, 0x24, 0x00, 0x10, 0x47,
+    0x48, 0x00, 0x07, 0x87, 0x10, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x20, 0x08,
+    0x20, 0x00, 0x01, 0x08, 0x04, 0x80, 0x04, 0x82, 0x00, 0x00, 0x00, 0x12,
+    0x10, 0x01, 0x00, 0x20, 0x10, 0xD8, 0x50, 0x70, 0x00, 0x20, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x00, 0x2C, 0x00, 0x0F, 0x00, 0x82, 0x00, 0x2F, 0x00, 0x18, 0x00, 0x2F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x20, 0x05, 0x0F, 0x40, 0x20, 0x50, 0x0F,
+    0x08, 0x2A, 0x00, 0x4F, 0x40, 0x00, 0x0A, 0x0F, 0x00, 0x01, 0x40, 0x2F,
+    0x02, 0x18, 0x00, 0x0F, 0x12, 0x20, 0x00, 0x0F, 0x24, 0x20, 0x00, 0x0F,
+    0x08, 0x20, 0x00, 0x0F, 0x40, 0x20, 0x00, 0x0F, 0x40, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x34, 0x00,
+    0x01, 0x80, 0x29, 0x04, 0x05, 0x00, 0x00, 0x20, 0x00, 0x02, 0x80, 0x02,
+    0x00, 0x80, 0x14, 0x30, 0x80, 0x28, 0x00, 0xA0, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x03, 0x07, 0x00, 0xA0, 0x50, 0x47, 0x00, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x09, 0x17, 0x00, 0x01, 0x40, 0x07, 0x00, 0x08, 0x00, 0x47,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x00, 0x47, 0xA0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x24, 0x00, 0x02, 0x27, 0x00, 0xC0, 0x28, 0x47, 0x64, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x14, 0x07, 0x00, 0x02, 0x80, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x12, 0x7F, 0x00, 0x42, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x4A, 0x00, 0x7F,
+    0x0C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x54, 0x00, 0x04, 0x7F,
+    0x22, 0x00, 0x40, 0x7F, 0x05, 0x02, 0x00, 0x7F, 0x40, 0x30, 0x00, 0xFF,
+    0x04, 0x40, 0xA4, 0x7F, 0x00, 0x4A, 0x01, 0x7F, 0x00, 0x20, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x03, 0x07, 0x00, 0xA0, 0x50, 0x47, 0x00, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x09, 0x17, 0x00, 0x01, 0x40, 0x07, 0x00, 0x08, 0x00, 0x47,
+    0x04, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x02, 0x27, 0x24, 0xC0, 0x28, 0x47, 0x02, 0x05, 0x00, 0x07,
+    0x10, 0x00, 0x14, 0x07, 0x24, 0x02, 0x80, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x08, 0x20, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x24, 0x00, 0x84, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x01, 0x81, 0x0A, 0x94, 0x00, 0x10, 0x00, 0x00, 0x44, 0x00, 0x04,
+    0x80, 0x00, 0x08, 0x10, 0x00, 0x80, 0x0A, 0x04, 0x00, 0x10, 0x60, 0x01,
+    0x04, 0x81, 0x48, 0x80, 0x94, 0x02, 0x10, 0x40, 0x04, 0x00, 0x00, 0x00,
+    // 0x178 'Ÿ'
+    0x01, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x00, 0xC0, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x06, 0x00, 0x3F, 0x00, 0x40, 0x05, 0x3F,
+    0x70, 0x08, 0x20, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x13, 0x01, 0x14, 0x3F,
+    0xA0, 0x00, 0x40, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x10, 0x00, 0x3F,
+    0x00, 0xA4, 0x00, 0x3F, 0x80, 0x80, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x40, 0x40, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x50, 0x04, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x10, 0x0F,
+    0x00, 0x00, 0x24, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x41, 0x00, 0x0F,
+    0x04, 0x40, 0x20, 0x8F, 0x20, 0x40, 0x00, 0x8F, 0x08, 0x49, 0x00, 0x8F,
+    0x08, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x08, 0x00, 0x6F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x0A, 0x00, 0x18, 0x10, 0x00, 0x40, 0x26, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x80, 0x2A, 0x04, 0x12, 0x40, 0x00, 0x54, 0x08,
+    0x20, 0x48, 0x09, 0x40, 0x20, 0x00, 0x90, 0x08, 0x00, 0x80, 0x10, 0x02,
+    0x00, 0x00, 0x00,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x50, 0x04, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x10, 0x0F,
+    0x00, 0x00, 0x24, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x41, 0x00, 0x0F,
+    0x28, 0x40, 0x20, 0x8F, 0x08, 0x40, 0x00, 0x8F, 0x00, 0x49, 0x00, 0x8F,
+    0x40, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x6F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x15, 0x00, 0x30, 0x21, 0x00, 0x80, 0x4D, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x25, 0x01, 0x00, 0x55, 0x20, 0x24, 0x81, 0x40, 0xA8, 0x11,
+    0x00, 0x90, 0x13, 0x10, 0x40, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x05,
+    0x00, 0x00, 0x01,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x28, 0x02, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x08, 0x08, 0x07,
+    0x20, 0x00, 0x12, 0x07, 0x08, 0x20, 0x00, 0x07, 0x00, 0x20, 0x80, 0x07,
+    0x00, 0x20, 0x10, 0x47, 0x02, 0x20, 0x00, 0x47, 0x12, 0x24, 0x80, 0x47,
+    0x24, 0x20, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x40, 0x04, 0x00, 0x37,
+    0x40, 0x00, 0x00, 0x87, 0x00, 0x20, 0x00, 0x07,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x0A, 0x00, 0x18, 0x10, 0x00, 0x40, 0x26, 0x00, 0x80, 0x00,
+    0x20, 0x00, 0x12, 0x08, 0x80, 0x2A, 0x04, 0x12, 0x40, 0x00, 0x54, 0x08,
+    0x10, 0x48, 0x09, 0x20, 0x20, 0x00, 0x50, 0x08, 0x00, 0x20, 0x10, 0x02,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x10, 0x04, 0x40, 0x19, 0x00, 0x62, 0x10, 0x0C, 0x94, 0x00,
+    0x80, 0x80, 0x90, 0x00, 0x80, 0x1C, 0x80, 0x80, 0x88, 0x01, 0x81, 0x78,
+    0x98, 0x08, 0x80, 0x0A, 0x00, 0x00, 0x20, 0x00, 0xC0, 0x00,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x05, 0x07, 0x00, 0xA0, 0x07, 0x06, 0x00, 0xA7, 0x10, 0x14, 0x07,
+    0x20, 0x80, 0x47, 0x4C, 0x00, 0x07, 0x00, 0x01, 0x87, 0xA0, 0x00, 0x47,
+    0x20, 0xE0, 0x0F, 0xA1, 0x00, 0x0F, 0xA0, 0x00, 0x07, 0x20, 0x88, 0x47,
+    0x89, 0x44, 0x07, 0x00, 0x00, 0x07, 0x48, 0x10, 0x07, 0x30, 0x0F, 0x87,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x03, 0x7F, 0x08, 0x7F, 0x00, 0x7F, 0x46, 0xFF, 0x30, 0x7F, 0x40, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x3F, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x02, 0x3F, 0x04, 0x3F,
+    0x20, 0x3F,
+    // 0x201A '‚'
+    0x01, 0xFF, 0x46, 0xFF, 0x01, 0x7F, 0x80, 0x7F, 0x08, 0x7F, 0x20, 0x7F,
+    // 0x201B '‛'
+    0x78, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x86, 0x7F, 0x01, 0xFF,
+    // 0x201C '“'
+    0x03, 0x7F, 0x08, 0x7F, 0x00, 0x7F, 0x46, 0xFF, 0x30, 0x7F, 0x40, 0x7F,
+    0x03, 0x7F, 0x00, 0xFF, 0x00, 0x7F, 0x07, 0x7F, 0xA0, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x00, 0x7F, 0x40, 0xFF, 0x80, 0x7F, 0x82, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F, 0x02, 0x7F, 0x70, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x7F,
+    // 0x201E '„'
+    0x01, 0xFF, 0x46, 0xFF, 0x01, 0x7F, 0x80, 0x7F, 0x08, 0x7F, 0x20, 0x7F,
+    0x01, 0x7F, 0x3C, 0x7F, 0x00, 0x7F, 0x84, 0x7F, 0x58, 0x7F,
+    // 0x201F '‟'
+    0x78, 0x7F, 0x00, 0x7F, 0x81, 0x7F, 0x86, 0x7F, 0x01, 0xFF, 0x00, 0x7F,
+    0x4C, 0x7F, 0x81, 0x7F, 0x18, 0xFF, 0x42, 0x7F, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x03, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x05, 0x00, 0x5F, 0x00, 0x05, 0x1F,
+    0x05, 0x50, 0x1F, 0x30, 0x01, 0x5F, 0x00, 0x58, 0x1F, 0x89, 0x00, 0x1F,
+    0x24, 0x00, 0x1F, 0x01, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x03, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x02, 0x03, 0x03, 0x00, 0x83, 0x04, 0x00, 0x03, 0x05, 0x02, 0x27,
+    0x00, 0x02, 0x87, 0x05, 0x80, 0x03, 0x30, 0x00, 0x83, 0x00, 0x1A, 0x03,
+    0x89, 0x00, 0x83, 0x24, 0x00, 0x83, 0x01, 0x04, 0x83, 0x04, 0x00, 0x03,
+    0x07, 0x00, 0x03,
+    // 0x2022 '•'
+    0x0B, 0x87, 0x83, 0x03, 0x83, 0x5B,
+    // 0x2026 '…'
+    0x37, 0x0F, 0x8F, 0x97, 0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8F,
+    0x07, 0x47, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x0F, 0x07, 0x87, 0x07,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x05, 0x1F, 0x00, 0x9F, 0x10, 0x5F, 0x05, 0x3F, 0x48, 0x9F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x00, 0x5F, 0x40, 0x9F, 0x91, 0x5F, 0x0E, 0x1F, 0x00, 0x9F,
+    0x01, 0x1F, 0x0E, 0x1F,
+    // 0x2070 '⁰'
+    0x02, 0xE3, 0x00, 0x07, 0x11, 0x27, 0x04, 0x13, 0x10, 0x03, 0x00, 0x07,
+    0x00, 0x03, 0x01, 0x0B, 0x40, 0x13, 0x00, 0xC3, 0x04, 0x03,
+    // 0x2074 '⁴'
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x23, 0x00, 0xA3, 0x01, 0x23, 0x02, 0x23,
+    0x00, 0x37, 0x02, 0x83, 0x00, 0x13, 0x02, 0xA3, 0x70, 0x03, 0x00, 0x03,
+    // 0x2075 '⁵'
+    0x00, 0x0F, 0x00, 0x0F, 0x0C, 0x07, 0x64, 0x0F, 0x80, 0x07, 0x8A, 0x07,
+    0xA8, 0x07, 0xA4, 0x27, 0xA0, 0xC7, 0xA0, 0x07, 0x80, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x03, 0x01, 0x0B, 0x08, 0x07, 0x10, 0x07, 0x21, 0x03, 0x0D, 0x07,
+    0x50, 0x03, 0x40, 0xC3, 0x22, 0x03, 0x00, 0x23, 0x60, 0x03, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x20, 0x2F, 0x80, 0x47, 0x80, 0x1F, 0x82, 0x07, 0x89, 0x07, 0x80, 0x07,
+    0x88, 0x07, 0x90, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x13, 0x00, 0x03, 0x05, 0x23, 0x20, 0x87, 0x0C, 0x0B, 0x20, 0x07,
+    0x00, 0x77, 0x09, 0x0B, 0x42, 0x13, 0x24, 0x03, 0x00, 0x03,
+    // 0x2079 '⁹'
+    0x00, 0x03, 0x00, 0x03, 0x04, 0x0B, 0x20, 0x87, 0x4A, 0x83, 0x51, 0x03,
+    0x20, 0x2B, 0x20, 0x43, 0x03, 0x03, 0x40, 0x43, 0x31, 0x83, 0x00, 0x03,
+    // 0x2080 '₀'
+    0x05, 0xC7, 0x00, 0x0F, 0x22, 0x0F, 0x40, 0x07, 0x20, 0x07, 0x80, 0x2F,
+    0x00, 0x0F, 0x22, 0x17, 0x00, 0x27, 0x01, 0x87, 0x08, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x07, 0x00, 0x07, 0x20, 0x07, 0x11, 0x47, 0x48, 0x07, 0x40, 0xB7,
+    0x0A, 0x0B, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x8F, 0x00, 0x2F, 0x02, 0xAF,
+    0x04, 0x2F, 0x11, 0x2F, 0x02, 0x2F, 0x08, 0x07, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x07, 0x00, 0x17, 0x70, 0x07, 0x10, 0x07, 0x21, 0x2F, 0x01, 0x2F,
+    0x00, 0x87, 0x86, 0x07, 0x88, 0x87, 0x30, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x00, 0x47, 0x00, 0x47, 0x01, 0x47, 0x02, 0x47, 0x04, 0x47,
+    0x08, 0x67, 0x15, 0x0F, 0x10, 0x2F, 0x05, 0x47, 0x50, 0x47, 0x00, 0x07,
+    // 0x2085 '₅'
+    0x00, 0x0F, 0x00, 0x17, 0x04, 0x07, 0x40, 0x07, 0x80, 0x27, 0x82, 0x0F,
+    0xA8, 0x17, 0xA4, 0x27, 0xA0, 0x87, 0xA0, 0x07, 0x80, 0x07,
+    // 0x2086 '₆'
+    0x00, 0x07, 0x06, 0x17, 0x00, 0x0F, 0x22, 0x0F, 0x02, 0x07, 0x42, 0x07,
+    0xA2, 0x07, 0xA1, 0x87, 0x04, 0x07, 0x00, 0x47, 0x80, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x28, 0x0F, 0x80, 0x47, 0xA0, 0x1F, 0xA2, 0x47, 0xA9, 0x07, 0xA0, 0x07,
+    0x80, 0x07, 0x90, 0x07, 0x00, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x07, 0x01, 0x07, 0x0A, 0x4F, 0x41, 0x07, 0x98, 0x17, 0xC1, 0x0F,
+    0x00, 0xEF, 0x12, 0x07, 0x04, 0x27, 0x48, 0x07, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x0F, 0x08, 0x17, 0x41, 0x0F, 0x14, 0x27, 0xA2, 0x0F,
+    0x00, 0x17, 0x00, 0x07, 0x82, 0x07, 0x80, 0x87, 0x63, 0x07, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AA '₪'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20AC '€'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x50, 0x07, 0x00, 0x14, 0x07,
+    0x01, 0x00, 0x07, 0x04, 0x00, 0x07, 0x00, 0x06, 0x07, 0x03, 0x10, 0x87,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x47, 0x80, 0x00, 0x17, 0x80, 0x00, 0x17,
+    0x9C, 0x00, 0x87, 0x04, 0x00, 0x07, 0x18, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20B9 '₹'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x20BD '₽'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2122 '™'
+    0x30, 0x7F, 0x30, 0xFF, 0x05, 0x7F, 0x20, 0x7F, 0x14, 0xBF, 0x00, 0x3F,
+    0x30, 0x3F, 0x10, 0x7F, 0x01, 0xFF, 0x4C, 0x7F, 0x26, 0x3F, 0x08, 0x3F,
+    0xC0, 0xBF, 0x05, 0x3F, 0x0A, 0x7F, 0x20, 0xFF, 0x86, 0x7F, 0x1C, 0xFF,
+    0x00, 0x7F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01, 0x08, 0xA2, 0x01,
+    0x2C, 0x02, 0x01, 0x00, 0x52, 0x01, 0x4A, 0x08, 0x11, 0x20, 0x00, 0x45,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x21, 0x00, 0x04, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x90, 0x01, 0x02, 0x40, 0x01,
+    0x00, 0x00, 0x09, 0x01, 0x00, 0x15, 0x04, 0x30, 0x05, 0x40, 0x10, 0x05,
+    0x10, 0x01, 0x11, 0x00, 0x24, 0x21, 0x00, 0x20, 0x89, 0x00, 0x28, 0x11,
+    0x00, 0x01, 0x01, 0x00, 0x78, 0x01,
+    // 0x2154 '⅔'
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x04, 0x22, 0x01, 0x04, 0x4A, 0x01,
+    0x00, 0x0A, 0x01, 0x50, 0xAA, 0x01, 0x41, 0x0A, 0x0D, 0x4C, 0x88, 0x01,
+    0x01, 0x0C, 0x21, 0x00, 0x00, 0x89, 0x00, 0x00, 0x21, 0x00, 0x02, 0x41,
+    0x00, 0x09, 0x01, 0x00, 0x00, 0x01, 0x00, 0x24, 0x01, 0x00, 0x90, 0x01,
+    0x01, 0x20, 0x01, 0x04, 0x00, 0x09, 0x01, 0x00, 0x15, 0x12, 0x30, 0x05,
+    0x40, 0x10, 0x05, 0x10, 0x01, 0x11, 0x60, 0x24, 0x21, 0x00, 0x20, 0x89,
+    0x00, 0x28, 0x11, 0x00, 0x01, 0x01, 0x00, 0x78, 0x01,
+    // 0x215B '⅛'
+    0x00, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x01, 0x08, 0xA2, 0x01,
+    0x2C, 0x02, 0x01, 0x00, 0x52, 0x01, 0x4A, 0x08, 0x11, 0x20, 0x00, 0x45,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x12, 0x01, 0x00, 0x48, 0x01, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x80, 0x01, 0x09, 0x00, 0xD1, 0x20, 0x01, 0x09, 0x48, 0x24, 0xE1,
+    0x10, 0x41, 0x15, 0x40, 0x81, 0x15, 0x00, 0x04, 0x11, 0x00, 0x00, 0x61,
+    0x00, 0x22, 0x01, 0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    // 0x215C '⅜'
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x08, 0x08, 0x01, 0x08, 0x08, 0x01,
+    0x00, 0x0A, 0x01, 0x42, 0x10, 0x01, 0x40, 0x64, 0x05, 0x48, 0x00, 0x21,
+    0x22, 0x90, 0x09, 0x18, 0x00, 0x11, 0x00, 0x02, 0x41, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x48, 0x01, 0x01, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x02, 0x00, 0xD1, 0x20, 0x01, 0x09,
+    0x08, 0x24, 0xE1, 0x60, 0x41, 0x15, 0x00, 0x81, 0x15, 0x00, 0x04, 0x11,
+    0x00, 0x00, 0x61, 0x00, 0x22, 0x01, 0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    // 0x215D '⅝'
+    0x00, 0x04, 0x01, 0x00, 0x08, 0x01, 0x02, 0x08, 0x01, 0x09, 0x02, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x04, 0x01, 0x02, 0xA4, 0x05, 0x00, 0x08, 0x21,
+    0x01, 0xB0, 0x49, 0x00, 0x00, 0x11, 0x20, 0x02, 0x41, 0x00, 0x04, 0x01,
+    0x00, 0x02, 0x01, 0x00, 0x20, 0x01, 0x00, 0x48, 0x01, 0x01, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x02, 0x00, 0xD1, 0x20, 0x01, 0x09,
+    0x08, 0x24, 0xE1, 0x60, 0x41, 0x15, 0x00, 0x81, 0x15, 0x00, 0x04, 0x11,
+    0x00, 0x00, 0x61, 0x00, 0x22, 0x01, 0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    // 0x215E '⅞'
+    0x24, 0x08, 0x01, 0x04, 0x20, 0x01, 0x00, 0x40, 0x01, 0x11, 0x10, 0x0D,
+    0x10, 0x00, 0x21, 0x14, 0x00, 0x09, 0x00, 0x00, 0x81, 0x04, 0x02, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x09, 0x01, 0x00, 0x24, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x01, 0x04, 0x80, 0x01, 0x12, 0x00, 0x01,
+    0x20, 0x00, 0xD1, 0x08, 0x01, 0x09, 0x60, 0x24, 0xE1, 0x00, 0x41, 0x15,
+    0x00, 0x81, 0x15, 0x00, 0x04, 0x11, 0x00, 0x00, 0x61, 0x00, 0x22, 0x01,
+    0x00, 0x04, 0x41, 0x00, 0x00, 0x01,
+    // 0x2190 '←'
+    0x01, 0x0F, 0x08, 0x8F, 0x10, 0x4F, 0x29, 0x2F, 0x50, 0x1F, 0x20, 0x4F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F,
+    0x10, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+    0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x20, 0x4F, 0x50, 0x1F,
+    0x29, 0x2F, 0x10, 0x4F, 0x08, 0x8F, 0x01, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x09, 0x1F, 0x00, 0x04, 0x1F,
+    0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F,
+    0x00, 0x04, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x02, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x01, 0xAF, 0x00, 0x4F,
+    0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x2F,
+    0x00, 0x0F, 0x01, 0x8F, 0x00, 0x0F, 0x00, 0x0F, 0x04, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x14, 0x00, 0x1F, 0x20, 0x00, 0x9F,
+    0x40, 0x00, 0x5F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x5F,
+    0x20, 0x00, 0x9F, 0x14, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x01, 0x07, 0x00, 0x87, 0x14, 0x47, 0x25, 0x27, 0x45, 0x17, 0xA5, 0x47,
+    0x05, 0x37, 0x05, 0x07, 0x05, 0x07, 0x05, 0x47, 0x05, 0x47, 0x05, 0x47,
+    0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x15, 0x47,
+    // 0x21D1 '⇑'
+    0x06, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x20, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+    0x24, 0x00, 0xFF, 0x14, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x06, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x15, 0x47, 0x05, 0x47, 0x05, 0x47,
+    0x05, 0x47, 0x05, 0x07, 0x05, 0x07, 0x05, 0x37, 0xA5, 0x47, 0x45, 0x17,
+    0x25, 0x27, 0x14, 0x47, 0x00, 0x87, 0x01, 0x07,
+    // 0x21D3 '⇓'
+    0x00, 0x10, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x04, 0x7F, 0x80, 0x02, 0x7F,
+    0x80, 0x01, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x01, 0x7F,
+    0x80, 0x22, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x10, 0x7F,
+    // 0x21D4 '⇔'
+    0x02, 0x07, 0x01, 0x07, 0x02, 0x87, 0x00, 0x47, 0x05, 0x27, 0x85, 0x17,
+    0xA5, 0x37, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0xA5, 0x37,
+    0x95, 0x17, 0x05, 0x27, 0x00, 0x47, 0x02, 0x87, 0x01, 0x07, 0x02, 0x07,
+    // 0x2202 '∂'
+    0x00, 0x05, 0x21, 0x00, 0x10, 0x01, 0x00, 0x00, 0x05, 0x40, 0x4C, 0x11,
+    0x00, 0x90, 0x03, 0x80, 0x20, 0x09, 0x20, 0x40, 0x01, 0x21, 0x00, 0x11,
+    0x21, 0x40, 0x21, 0x80, 0x01, 0x81, 0x45, 0x24, 0x21, 0x20, 0x00, 0x41,
+    0x18, 0x04, 0x01, 0x01, 0xC0, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x61, 0xCF, 0x00, 0x00, 0x0F, 0x0C, 0x30, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x40, 0x0F,
+    0x0C, 0x08, 0x0F, 0x00, 0x81, 0xCF, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x01, 0x8F, 0x00, 0x00, 0x2F,
+    // 0x220F '∏'
+    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x3F, 0xFF, 0xFE, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x02, 0x7F, 0x20, 0x00, 0x04, 0x7F, 0x88, 0x00, 0x10, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0x30, 0x81, 0x14, 0xFF,
+    0x20, 0x00, 0x04, 0xFF, 0x24, 0x24, 0x44, 0xFF, 0x21, 0x01, 0x04, 0xFF,
+    0x20, 0x80, 0x04, 0xFF, 0x20, 0x24, 0x04, 0xFF, 0x20, 0x10, 0x04, 0xFF,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x18, 0x7F,
+    0x80, 0x00, 0x00, 0xFF, 0x18, 0x00, 0x1A, 0x7F,
+    // 0x221A '√'
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x03, 0x01, 0x9F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x60, 0x9F, 0x00, 0x01, 0x06, 0x1F, 0x00, 0x20, 0x30, 0x1F,
+    0x00, 0x80, 0x80, 0x1F, 0x10, 0x04, 0x00, 0x1F, 0xC0, 0x80, 0x00, 0x1F,
+    0x06, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x02, 0x3F, 0x20, 0x3F, 0x42, 0x7F, 0x81, 0x3F, 0x01, 0x7F, 0xA0, 0x3F,
+    0x10, 0x3F, 0x4C, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x00, 0x7F,
+    0x81, 0x3F, 0x01, 0x7F, 0x90, 0x7F, 0x40, 0xBF, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x03, 0xFF, 0xFF, 0x17, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x08, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x17, 0x00, 0x07, 0x00, 0x07, 0x02, 0x07,
+    0x04, 0x07, 0x02, 0x07, 0x24, 0x07, 0x00, 0x07, 0x60, 0x07, 0x00, 0x07,
+    0x00, 0x07,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x08, 0xA0, 0x7F,
+    0x08, 0x90, 0x7F, 0x10, 0x50, 0x7F, 0x10, 0x48, 0x7F, 0x80, 0x28, 0x7F,
+    0x00, 0x10, 0x7F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x7F, 0x60, 0x38, 0x7F, 0x90, 0x20, 0x7F, 0x40, 0x40, 0x7F,
+    0x08, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x04, 0xA0, 0x7F, 0x00, 0x00, 0x7F,
+    0x02, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x2500 '─'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2502 '│'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x250C '┌'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2510 '┐'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2514 '└'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2518 '┘'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x251C '├'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2524 '┤'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x252C '┬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2534 '┴'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x253C '┼'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2550 '═'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2551 '║'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2554 '╔'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2557 '╗'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255A '╚'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x255D '╝'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2560 '╠'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2563 '╣'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2566 '╦'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x2569 '╩'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x256C '╬'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07
+};
+
+
+const uint8_t Bookerly28ItalicBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0x21 '!'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x39, 0x03, 0x0C, 0x02, 0x0B,
+    0x40, 0x60, 0x03, 0x82, 0x00, 0x03, 0x90, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x22 '"'
+    0x00, 0x3F, 0x18, 0x3F, 0x41, 0xBF, 0x08, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x30, 0x3F, 0x41, 0x3F, 0x10, 0x3F, 0x00, 0x3F,
+    // 0x23 '#'
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x02, 0x08, 0x3F, 0x02, 0x0B, 0x3F,
+    0x02, 0x20, 0x3F, 0x00, 0x04, 0x3F, 0x20, 0x48, 0x3F, 0x82, 0x08, 0x3F,
+    0xC2, 0x08, 0x3F, 0x02, 0x06, 0x3F, 0x02, 0x60, 0xBF, 0x08, 0x04, 0x3F,
+    0x40, 0x88, 0x3F, 0x8A, 0x08, 0x3F, 0x02, 0x08, 0x3F, 0x02, 0x10, 0x3F,
+    0x04, 0x00, 0x3F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x22, 0x07, 0x01, 0x10, 0x08, 0x37, 0x00, 0x00, 0x01, 0x07,
+    0x04, 0xC4, 0x10, 0x67, 0x00, 0x03, 0x00, 0x07, 0x08, 0x10, 0x40, 0x07,
+    0x0B, 0x81, 0x00, 0x07, 0x10, 0x60, 0x0A, 0x07, 0x02, 0x04, 0x60, 0x07,
+    0x68, 0x02, 0x04, 0x07, 0x00, 0x81, 0x00, 0x07, 0x04, 0x40, 0x00, 0x07,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x25 '%'
+    0x00, 0x00, 0x01, 0x02, 0x10, 0x01, 0x08, 0x08, 0x01, 0x02, 0x00, 0x01,
+    0x28, 0x00, 0x01, 0x10, 0x10, 0x11, 0x00, 0x00, 0x25, 0x10, 0x00, 0x01,
+    0x0F, 0x11, 0x21, 0x20, 0x42, 0x01, 0x0F, 0x01, 0x01, 0x00, 0x12, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x41, 0x00, 0x04, 0x01,
+    0x09, 0x00, 0xC1, 0x10, 0x04, 0x11, 0x40, 0x00, 0x01, 0x10, 0x10, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x41, 0x00, 0x00, 0x01, 0x00, 0x10, 0xC1,
+    0x00, 0x00, 0x01,
+    // 0x26 '&'
+    0x00, 0x00, 0x01, 0x00, 0x06, 0x21, 0x00, 0x00, 0x01, 0x00, 0x04, 0x49,
+    0x00, 0x20, 0x21, 0x00, 0x00, 0x01, 0x06, 0x10, 0x01, 0x10, 0x04, 0x01,
+    0x07, 0x01, 0x01, 0x50, 0x08, 0x81, 0x21, 0x02, 0x29, 0x22, 0x01, 0x01,
+    0x05, 0x10, 0x81, 0x00, 0x00, 0x89, 0x04, 0x29, 0x01, 0x00, 0x0C, 0x05,
+    0x00, 0x01, 0x11, 0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0xA0, 0x01, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01,
+    // 0x27 '''
+    0x00, 0x3F, 0x18, 0x3F, 0x41, 0xBF, 0x08, 0x3F, 0x00, 0x3F,
+    // 0x28 '('
+    0x00, 0x01, 0xE0, 0x07, 0x00, 0x10, 0x06, 0x07, 0x00, 0x40, 0x80, 0x07,
+    0x01, 0x10, 0x04, 0x47, 0x00, 0x40, 0x01, 0x07, 0x01, 0x00, 0x00, 0x47,
+    0x02, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x07, 0x28, 0x00, 0x00, 0x07,
+    0x50, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x04, 0x07, 0x24, 0x00, 0x10, 0x07, 0x11, 0x00, 0x44, 0x07,
+    0x00, 0x08, 0x00, 0x07, 0x01, 0x00, 0x40, 0x07, 0x00, 0x3E, 0x00, 0x07,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0x3F, 0x08, 0x3F, 0x05, 0x3F, 0x02, 0x3F, 0x00, 0x7F,
+    0x19, 0x7F, 0x08, 0x3F, 0x02, 0x3F, 0x04, 0x3F,
+    // 0x2B '+'
+    0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x80, 0x0F, 0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x02, 0x07,
+    // 0x2C ','
+    0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7F, 0x39, 0x7F, 0x02, 0x7F, 0x00, 0x7F,
+    0x20, 0x7F,
+    // 0x2D '-'
+    0x6F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2E '.'
+    0x07, 0x47, 0x07, 0x07, 0x67,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x49,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x41, 0x00, 0x09, 0x01, 0x00, 0x20, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x20, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x24, 0x00, 0x01, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x30 '0'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x47, 0x01, 0x00, 0x07, 0x04, 0x00, 0x17,
+    0x00, 0x40, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x57, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    0x10, 0x04, 0x47, 0x04, 0xE0, 0x07, 0x40, 0x02, 0x07, 0x20, 0x08, 0x07,
+    0x07, 0x80, 0x07,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x0F,
+    0x20, 0x00, 0xCF, 0x00, 0x08, 0x0F, 0x01, 0x80, 0x0F, 0x40, 0x03, 0x0F,
+    0x00, 0x60, 0x0F, 0x04, 0x00, 0x3F, 0x40, 0x00, 0x0F,
+    // 0x32 '2'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x04, 0x01, 0x0F,
+    0x02, 0x00, 0x0F, 0x24, 0x00, 0xCF, 0x08, 0x01, 0x4F, 0x50, 0x08, 0x4F,
+    0x00, 0x10, 0x4F, 0x00, 0x24, 0x4F, 0x00, 0x48, 0x4F, 0x00, 0x90, 0x4F,
+    0x0E, 0x20, 0x4F, 0x40, 0x40, 0x6F, 0x00, 0x80, 0x0F, 0x0C, 0x00, 0x0F,
+    // 0x33 '3'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x04, 0x30, 0x07, 0x40, 0x10, 0x47, 0x10, 0x50, 0x17,
+    0x00, 0x10, 0x17, 0x00, 0x90, 0x07, 0x00, 0x08, 0x27, 0x00, 0x40, 0x47,
+    0x08, 0xA0, 0x87, 0x40, 0x1A, 0x07, 0x22, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x34 '4'
+    0x00, 0x06, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x20, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x80, 0x0F, 0x01, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x00, 0x01, 0x8F, 0x00, 0x18, 0x0F, 0x09, 0x80, 0x3F,
+    0x40, 0x01, 0x0F, 0x00, 0xC0, 0x0F, 0x0C, 0x00, 0x0F, 0x00, 0x06, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x35 '5'
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x80, 0x07,
+    0x08, 0x00, 0x07, 0x40, 0x00, 0x47, 0x04, 0x40, 0x17, 0x01, 0x00, 0x87,
+    0x01, 0x21, 0x27, 0x00, 0x0C, 0x07, 0x00, 0x80, 0x07, 0x00, 0x41, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0x36 '6'
+    0x00, 0x00, 0x07, 0x00, 0x20, 0x47, 0x00, 0x80, 0x07, 0x02, 0x0F, 0x17,
+    0x04, 0x00, 0x47, 0x08, 0x00, 0x07, 0x12, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x20, 0x17, 0x50, 0x91, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0x20, 0x1E, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x37 '7'
+    0x00, 0x00, 0x07, 0x12, 0x00, 0x87, 0x00, 0x00, 0x0F, 0x08, 0x04, 0x27,
+    0x00, 0x00, 0x87, 0x00, 0x22, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x02, 0x00, 0x07, 0x04, 0x80, 0x07, 0x09, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0x38 '8'
+    0x00, 0x01, 0x87, 0x00, 0x04, 0x27, 0x00, 0x00, 0x17, 0x0F, 0x12, 0x87,
+    0x00, 0x80, 0x07, 0x00, 0x40, 0x07, 0x41, 0x10, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x20, 0x88, 0x17, 0x20, 0x63, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x80, 0x07, 0x41, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x39 '9'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x04, 0x20, 0x07,
+    0x10, 0x10, 0x07, 0x21, 0x00, 0x47, 0x48, 0x08, 0x17, 0x10, 0x28, 0x87,
+    0x00, 0x01, 0x27, 0x20, 0x0A, 0x47, 0x20, 0x0C, 0x07, 0x00, 0x20, 0x07,
+    0x08, 0x42, 0x07, 0x00, 0x04, 0x07, 0x20, 0x10, 0x07, 0x0F, 0x80, 0x07,
+    // 0x3A ':'
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x40, 0x0C, 0x08, 0x00,
+    0x50, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x2F,
+    0x00, 0x00, 0x4F, 0x30, 0x00, 0x0F, 0x40, 0x04, 0x0F, 0x08, 0x00, 0x0F,
+    0x50, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x3C '<'
+    0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x08, 0x07, 0x02, 0x07, 0x14, 0x47,
+    0x01, 0x07, 0x28, 0x27, 0x00, 0x87, 0x50, 0x17, 0x00, 0x07, 0xA0, 0x0F,
+    0x00, 0x07,
+    // 0x3D '='
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xC7,
+    // 0x3E '>'
+    0x00, 0x07, 0x60, 0x37, 0x00, 0x0F, 0x10, 0x47, 0x00, 0x17, 0x28, 0x07,
+    0x00, 0x27, 0x14, 0x07, 0x01, 0x47, 0x08, 0x07, 0x00, 0x87, 0x04, 0x07,
+    0x02, 0x07,
+    // 0x3F '?'
+    0x00, 0x00, 0x1B, 0x30, 0x08, 0x03, 0x40, 0x01, 0x03, 0x00, 0x0C, 0x33,
+    0x10, 0x11, 0x03, 0x00, 0xA2, 0x03, 0x48, 0x40, 0x03, 0x00, 0x80, 0x03,
+    0x11, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x40 '@'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x30, 0x10, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x00, 0x10, 0x20, 0x3F, 0x00, 0x40, 0x09, 0x3F, 0x01, 0x00, 0x04, 0x3F,
+    0x02, 0x00, 0x00, 0xBF, 0x14, 0x07, 0x82, 0x3F, 0x00, 0x20, 0x20, 0x3F,
+    0x28, 0x03, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x51, 0x40, 0x20, 0x3F,
+    0x40, 0x00, 0x80, 0x3F, 0x00, 0x81, 0x00, 0x3F, 0x00, 0x81, 0x00, 0xBF,
+    0x01, 0x50, 0x22, 0x3F, 0x01, 0x01, 0x80, 0x3F, 0x00, 0x30, 0x24, 0x3F,
+    0x01, 0x80, 0x20, 0x3F, 0x50, 0x00, 0x80, 0x3F, 0x00, 0x01, 0x40, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x02, 0x18, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x06, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x2F, 0x00, 0x22, 0x1F,
+    0x00, 0x84, 0x0F, 0x00, 0x24, 0x0F, 0x04, 0x84, 0x0F, 0x12, 0x04, 0x0F,
+    0x40, 0x04, 0x0F, 0x00, 0x04, 0x0F, 0x80, 0xC4, 0x2F, 0x60, 0x03, 0xAF,
+    0x03, 0x00, 0x0F, 0x00, 0x18, 0x0F, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x3F,
+    // 0x42 'B'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC7,
+    0x60, 0x08, 0x07, 0x21, 0x80, 0x07, 0x30, 0x02, 0x07, 0x80, 0x20, 0x07,
+    0x8C, 0x20, 0x07, 0x80, 0x20, 0x07, 0x80, 0x20, 0x07, 0x80, 0x00, 0x17,
+    0xA0, 0x90, 0x07, 0x01, 0x09, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x1E, 0x00, 0x07,
+    // 0x43 'C'
+    0x00, 0x7E, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27, 0x00, 0x82, 0x07,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x07, 0x40, 0x00, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x47, 0xA0, 0x00, 0x57,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x02, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x20, 0x00, 0x07,
+    // 0x44 'D'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC7,
+    0x60, 0x0C, 0x07, 0x21, 0x80, 0x07, 0x30, 0x03, 0x07, 0x80, 0x60, 0x07,
+    0x8C, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x17,
+    0xA0, 0x00, 0x47, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x02, 0x47,
+    0x40, 0x08, 0x07, 0x00, 0x80, 0x07, 0x00, 0x02, 0x07, 0x08, 0x18, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x45 'E'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x10, 0x0F,
+    0x8C, 0x40, 0x0F, 0xA0, 0x40, 0x0F, 0xA0, 0x40, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x4F, 0x80, 0x00, 0x8F, 0x80, 0x02, 0x2F, 0x98, 0x01, 0x0F,
+    0x80, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    // 0x46 'F'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x10, 0x2F,
+    0x8C, 0x40, 0x3F, 0xA0, 0x40, 0x0F, 0xA0, 0x40, 0x0F, 0xA0, 0x40, 0x0F,
+    0xA0, 0x40, 0x0F, 0x80, 0x60, 0x0F, 0x98, 0x00, 0x0F, 0x84, 0x00, 0x0F,
+    0x70, 0x00, 0x0F,
+    // 0x47 'G'
+    0x00, 0x7E, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x82, 0x07,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x07, 0x40, 0x00, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x10, 0x07, 0xA0, 0x08, 0x07,
+    0xA0, 0x08, 0x57, 0x80, 0x06, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x03, 0x07,
+    0x48, 0x08, 0x07, 0x00, 0x00, 0x07,
+    // 0x48 'H'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x00, 0x2F,
+    0x84, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xCF,
+    0x40, 0x18, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x60, 0x2F,
+    0x8C, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x49 'I'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x60, 0x2F,
+    0x84, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
+    0x00, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x61, 0x3F, 0x40, 0x04, 0x00, 0x3F,
+    0x80, 0xC0, 0x10, 0x3F, 0xB8, 0x01, 0x80, 0x3F, 0x80, 0x30, 0x00, 0x3F,
+    0x83, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC7,
+    0x40, 0x0C, 0x07, 0x81, 0x80, 0x07, 0xB0, 0x03, 0x07, 0x80, 0x20, 0x27,
+    0x84, 0x10, 0x17, 0xA0, 0x00, 0x07, 0x80, 0x62, 0x07, 0x42, 0x90, 0x07,
+    0x04, 0x00, 0x47, 0x08, 0x02, 0x27, 0x40, 0x01, 0x17, 0xA0, 0x00, 0x87,
+    0x88, 0x00, 0x47, 0x90, 0x00, 0x27, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4C 'L'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x60, 0x0F,
+    0x84, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x8F,
+    // 0x4D 'M'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x03, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x81, 0x2F, 0x8C, 0x18, 0x2F,
+    0x80, 0x80, 0x0F, 0x84, 0x00, 0x0F, 0x87, 0x00, 0x0F, 0x80, 0x1C, 0x0F,
+    0x38, 0x00, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x48, 0x0F, 0x01, 0x20, 0x0F, 0x04, 0x00, 0x0F, 0x11, 0x00, 0x2F,
+    0x44, 0x00, 0x0F, 0x8B, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x1F, 0x0F,
+    0xA0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0xC7,
+    0x00, 0x18, 0x07, 0x83, 0x00, 0x47, 0x90, 0x0C, 0x27, 0x81, 0x80, 0x17,
+    0x02, 0x00, 0x07, 0x20, 0x80, 0x07, 0x08, 0x20, 0x07, 0x00, 0x08, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x10, 0x47, 0x00, 0x04, 0x17, 0x00, 0x01, 0x07,
+    0x40, 0x18, 0x07, 0x83, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x81, 0x80, 0x07,
+    0xB0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4F 'O'
+    0x00, 0x73, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x27, 0x00, 0x81, 0x07,
+    0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x47, 0xA0, 0x00, 0x17,
+    0xA0, 0x00, 0x87, 0x80, 0x01, 0x07, 0x00, 0x04, 0x47, 0x46, 0x70, 0x87,
+    0x20, 0x00, 0x07, 0x10, 0x08, 0x07, 0x03, 0xC0, 0x07,
+    // 0x50 'P'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x60, 0x0C, 0x0F, 0x21, 0x80, 0x0F, 0x30, 0x03, 0x0F, 0x80, 0x60, 0x2F,
+    0x8C, 0x20, 0x3F, 0x80, 0x20, 0x0F, 0x80, 0x20, 0x0F, 0x80, 0x00, 0x0F,
+    0xA0, 0x50, 0x0F, 0x00, 0x80, 0x0F, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x51 'Q'
+    0x00, 0x72, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x81, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x40, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0A, 0x1F,
+    0xA0, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x51, 0x1F, 0xA0, 0x00, 0x00, 0x1F,
+    0xA0, 0x00, 0x20, 0x9F, 0x80, 0x00, 0x02, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x43, 0xE0, 0x00, 0x5F, 0x20, 0x02, 0x00, 0x5F, 0x00, 0x08, 0x01, 0x1F,
+    0x01, 0x80, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x9F,
+    // 0x52 'R'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC7,
+    0x60, 0x08, 0x07, 0x21, 0x80, 0x07, 0xB0, 0x03, 0x07, 0x80, 0x40, 0x27,
+    0x8C, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x40, 0x07, 0x80, 0x10, 0x87,
+    0xA0, 0x80, 0x07, 0x11, 0x01, 0x07, 0x00, 0x40, 0x97, 0x00, 0x80, 0x47,
+    0x1E, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x53 'S'
+    0x00, 0x01, 0xE7, 0x00, 0x00, 0x07, 0x06, 0x03, 0x17, 0x00, 0x80, 0x47,
+    0x00, 0x40, 0x07, 0x12, 0x20, 0x07, 0x01, 0x00, 0x07, 0xA0, 0x90, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x17, 0xA0, 0x20, 0x27, 0x9C, 0x10, 0x47,
+    0x00, 0x0F, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x54 'T'
+    0x1C, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x2F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x03, 0x0F, 0xA0, 0x30, 0x0F, 0xA6, 0x00, 0x4F, 0x80, 0x0C, 0x0F,
+    0x81, 0x80, 0x2F, 0x90, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x84, 0x00, 0x0F,
+    0x40, 0x00, 0x0F,
+    // 0x55 'U'
+    0x00, 0x00, 0x07, 0x00, 0x30, 0x47, 0xA6, 0x00, 0x07, 0x80, 0x0F, 0x17,
+    0x81, 0x80, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x07, 0x40, 0x18, 0x07, 0xA3, 0x01, 0x07, 0x80, 0x18, 0x07,
+    0x83, 0x00, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x56 'V'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x8E, 0x00, 0x07, 0x80, 0x38, 0x07,
+    0x80, 0x00, 0x67, 0xA1, 0xC0, 0x07, 0x80, 0x01, 0x87, 0x40, 0x01, 0x17,
+    0x00, 0x04, 0x47, 0x00, 0x11, 0x07, 0x00, 0x44, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x20, 0x07, 0xA0, 0x80, 0x07, 0x82, 0x00, 0x07, 0x88, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x57 'W'
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x07, 0x98, 0x00, 0x07, 0x80, 0x07, 0x87,
+    0x80, 0x00, 0x07, 0xAF, 0xFE, 0x07, 0x80, 0x01, 0x17, 0x80, 0x04, 0x47,
+    0x00, 0x11, 0x07, 0x00, 0x44, 0x07, 0x01, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x41, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x70, 0x00, 0x07,
+    0x00, 0x1F, 0x07, 0x00, 0x01, 0x17, 0x00, 0x04, 0x47, 0x00, 0x11, 0x07,
+    0x00, 0x04, 0x07, 0x02, 0x10, 0x07, 0xA8, 0x40, 0x07, 0x81, 0x00, 0x07,
+    0x84, 0x00, 0x07, 0x90, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0xAF,
+    0x80, 0x09, 0x1F, 0x80, 0x10, 0x0F, 0xB0, 0x20, 0x0F, 0x84, 0x00, 0x0F,
+    0x40, 0x08, 0x1F, 0x01, 0x02, 0x2F, 0x02, 0x10, 0x8F, 0x00, 0x04, 0x0F,
+    0x82, 0x01, 0x0F, 0xA4, 0x00, 0x4F, 0x88, 0x00, 0x0F, 0x90, 0x00, 0x2F,
+    0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x59 'Y'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x0F, 0x84, 0x00, 0x2F,
+    0x81, 0x00, 0x0F, 0x90, 0x20, 0xCF, 0xA6, 0x08, 0x0F, 0x80, 0x80, 0x0F,
+    0x00, 0x06, 0x0F, 0x00, 0x90, 0x2F, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F,
+    0x89, 0x00, 0x0F, 0xA2, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x90, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x07,
+    0x00, 0x04, 0x47, 0x80, 0x08, 0x07, 0x80, 0x12, 0x07, 0xA0, 0x04, 0x07,
+    0xA0, 0x08, 0x07, 0xA1, 0x00, 0x07, 0xA2, 0x00, 0x07, 0xA4, 0x80, 0x07,
+    0xA1, 0x00, 0x47, 0x82, 0x01, 0x07, 0x80, 0x00, 0x27, 0x80, 0x03, 0x07,
+    0x20, 0x00, 0x07,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x80, 0x1F,
+    0x00, 0x18, 0x08, 0x1F, 0x01, 0x01, 0x80, 0x1F, 0x30, 0x18, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x08, 0x00, 0x01, 0x21, 0x00, 0x01,
+    0x08, 0x20, 0x01, 0x01, 0x08, 0x01, 0x00, 0x21, 0x01, 0x00, 0x08, 0x21,
+    0x00, 0x01, 0x09, 0x00, 0x00, 0x21, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x06, 0x02, 0x1F,
+    0x40, 0xC0, 0x60, 0x1F, 0x4C, 0x06, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F,
+    0x0C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x2F, 0x01, 0x0F, 0x04, 0x27, 0x00, 0x87, 0x84, 0x07,
+    0x90, 0x07, 0x88, 0x07, 0x41, 0x07, 0x08, 0x47, 0x02, 0x0F, 0x00, 0x4F,
+    0x00, 0x1F, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F,
+    // 0x60 '`'
+    0x41, 0x01, 0x41, 0x11, 0x0B, 0x01,
+    // 0x61 'a'
+    0x00, 0xEC, 0x04, 0x02, 0x00, 0x00, 0x02, 0x08, 0x08, 0x00, 0x10, 0x0A,
+    0x00, 0x00, 0xA0, 0x00, 0xA0, 0x50, 0x01, 0x02, 0x48, 0x00, 0x40, 0xC0,
+    0x0C, 0x0A, 0x40, 0x14, 0x00, 0x00,
+    // 0x62 'b'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x40, 0x01, 0x81, 0x20, 0x30, 0x05,
+    0x23, 0x00, 0xC1, 0x80, 0x32, 0x01, 0x81, 0x28, 0x01, 0x90, 0x50, 0x01,
+    0x00, 0xA0, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x49, 0x01, 0x27, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x81, 0x81, 0x00, 0x00, 0x01,
+    // 0x63 'c'
+    0x01, 0xD8, 0x04, 0x00, 0x10, 0x00, 0x24, 0x08, 0x40, 0x00, 0x00, 0x00,
+    0x20, 0x02, 0xA0, 0x08, 0x80, 0x04, 0x10, 0x08, 0x60, 0x00,
+    // 0x64 'd'
+    0x00, 0x01, 0xD9, 0x00, 0x00, 0x05, 0x00, 0x10, 0x01, 0x00, 0x04, 0x11,
+    0x00, 0x10, 0x01, 0x00, 0x20, 0x15, 0x00, 0x00, 0x01, 0x01, 0x40, 0x01,
+    0x01, 0x40, 0xA1, 0x40, 0x02, 0x05, 0x20, 0x90, 0x01, 0x26, 0x01, 0x81,
+    0x80, 0x18, 0x15, 0x81, 0x00, 0x29, 0x70, 0x00, 0x01,
+    // 0x65 'e'
+    0x01, 0xD8, 0x04, 0x00, 0x10, 0x20, 0x24, 0x48, 0x11, 0x00, 0x20, 0x00,
+    0x02, 0x80, 0x80, 0x0A, 0xA9, 0x00, 0x02, 0x10, 0x44, 0x00, 0x00, 0x00,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x97, 0x00, 0xC0, 0x0C, 0x07, 0x00, 0x40, 0x80, 0x47,
+    0x00, 0x58, 0x02, 0x07, 0x03, 0x00, 0x60, 0x07, 0x08, 0x0C, 0x00, 0x07,
+    0x20, 0x40, 0x00, 0x07, 0x48, 0x40, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x20, 0x40, 0x00, 0x07, 0xA0, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x67 'g'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xA3,
+    0x00, 0x01, 0x03, 0x08, 0x8C, 0x17, 0x00, 0x42, 0x17, 0x0F, 0x02, 0x17,
+    0x10, 0x20, 0x17, 0x20, 0x80, 0x13, 0x80, 0x01, 0x03, 0x81, 0x00, 0xAB,
+    0x84, 0x80, 0x03, 0x81, 0x00, 0x13, 0x02, 0x00, 0xC3, 0x20, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x68 'h'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x19, 0x40, 0x03, 0x01, 0x20, 0x30, 0x0D,
+    0x22, 0x00, 0x41, 0x80, 0x38, 0x01, 0x81, 0x04, 0x01, 0x90, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC1, 0x01, 0x0C, 0x01,
+    0x01, 0x00, 0x51, 0x00, 0x04, 0x15, 0x00, 0x00, 0x29, 0x00, 0x00, 0x31,
+    // 0x69 'i'
+    0x00, 0x00, 0x01, 0x00, 0x40, 0xC1, 0x00, 0x44, 0x01, 0x00, 0x60, 0x31,
+    0x31, 0x03, 0x15, 0x00, 0x30, 0x29, 0x80, 0x00, 0x31, 0x60, 0x00, 0x01,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x97,
+    0x00, 0x00, 0x04, 0x27, 0x00, 0x40, 0x20, 0x07, 0x00, 0x46, 0x02, 0x07,
+    0x01, 0x00, 0x10, 0x07, 0x41, 0x01, 0x00, 0x07, 0x00, 0x70, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    // 0x6B 'k'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0xC1, 0x20, 0x0C, 0x01, 0x21, 0x80, 0x61,
+    0xB8, 0x06, 0x01, 0x80, 0xC2, 0x41, 0x8C, 0x02, 0x01, 0x00, 0x81, 0x89,
+    0x00, 0x44, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x70, 0x11, 0x01, 0x00, 0x01,
+    0x00, 0x90, 0x09, 0x00, 0x00, 0x01,
+    // 0x6C 'l'
+    0x00, 0x00, 0x19, 0x00, 0x01, 0x81, 0x20, 0x30, 0x01, 0x23, 0x00, 0xD1,
+    0xA0, 0x0C, 0x01, 0x81, 0x80, 0x29, 0x98, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x6D 'm'
+    0x40, 0x02, 0x20, 0x30, 0x26, 0x00, 0x80, 0x18, 0x80, 0x40, 0x61, 0x00,
+    0x14, 0x00, 0x28, 0x00, 0x50, 0x02, 0x00, 0x30, 0x83, 0x00, 0x80, 0x18,
+    0x00, 0x40, 0x09, 0x00, 0x14, 0x00, 0x28, 0x00, 0x50, 0x00, 0x00, 0x30,
+    0x83, 0x00, 0x80, 0x18, 0x01, 0x0A, 0x38, 0x00, 0x00, 0x18,
+    // 0x6E 'n'
+    0x40, 0x02, 0x20, 0x30, 0x26, 0x00, 0x80, 0x18, 0x80, 0x40, 0x61, 0x00,
+    0x14, 0x00, 0x28, 0x00, 0x50, 0x00, 0x00, 0x1A, 0x81, 0x80, 0x98, 0x00,
+    0x80, 0xCA, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6F 'o'
+    0x01, 0x98, 0x00, 0x00, 0x10, 0x02, 0x22, 0x08, 0x48, 0x00, 0x10, 0x04,
+    0x20, 0x00, 0xA0, 0x0A, 0xA0, 0x10, 0x80, 0x04, 0x0F, 0x08, 0x40, 0x00,
+    0x10, 0x80, 0x00, 0x00,
+    // 0x70 'p'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x40, 0x01, 0x03,
+    0x20, 0x30, 0x03, 0x22, 0x01, 0x93, 0x80, 0x12, 0x03, 0x80, 0x80, 0x03,
+    0x4A, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0A, 0x03,
+    0x00, 0x10, 0x03, 0x80, 0x40, 0x03, 0x80, 0x00, 0x03, 0x00, 0x20, 0x03,
+    0x33, 0x00, 0x03,
+    // 0x71 'q'
+    0x00, 0xC8, 0x03, 0x04, 0x02, 0x03, 0x10, 0x00, 0x03, 0x22, 0x08, 0x03,
+    0x48, 0x00, 0x0B, 0x00, 0x0A, 0x03, 0xA0, 0x00, 0x13, 0xA0, 0x00, 0x23,
+    0xA0, 0x56, 0x03, 0x01, 0x00, 0x03, 0x48, 0x06, 0x13, 0x40, 0xC0, 0x0B,
+    0x0C, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x72 'r'
+    0x40, 0x01, 0x20, 0x11, 0x23, 0x01, 0x80, 0x0D, 0x80, 0x41, 0x69, 0x01,
+    0x14, 0x01, 0x08, 0x01, 0x10, 0x01, 0x90, 0x01, 0x90, 0x01, 0x00, 0x01,
+    // 0x73 's'
+    0x00, 0x0C, 0x00, 0x02, 0x0C, 0x00, 0x20, 0x00, 0x40, 0x00, 0x04, 0x80,
+    0x22, 0x40, 0xA0, 0x10, 0x80, 0x04, 0x80, 0x50, 0x60, 0x00,
+    // 0x74 't'
+    0x00, 0x00, 0x0F, 0x06, 0x00, 0x0F, 0x02, 0x06, 0x2F, 0x02, 0xC0, 0x0F,
+    0x08, 0x03, 0x8F, 0x00, 0x60, 0x0F, 0x02, 0x00, 0x8F, 0x42, 0x00, 0x0F,
+    0x02, 0x01, 0x4F, 0x02, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x75 'u'
+    0x00, 0x00, 0x20, 0x64, 0x22, 0x00, 0x80, 0x10, 0x81, 0x00, 0x18, 0x00,
+    0x00, 0x0A, 0x00, 0x14, 0x00, 0x28, 0x00, 0x10, 0x02, 0x00, 0x20, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x76 'v'
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x88, 0x00, 0x00, 0xE0, 0x20, 0x00,
+    0x01, 0xF2, 0x00, 0x14, 0x00, 0x08, 0x00, 0x90, 0x42, 0x00, 0x80, 0x80,
+    0x82, 0x00, 0x70, 0x00,
+    // 0x77 'w'
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x98, 0x00, 0x01, 0xC0, 0x20, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x90, 0xB4, 0x00, 0x80, 0x00,
+    0x00, 0x3E, 0x0C, 0x00, 0x00, 0x12, 0x00, 0x14, 0x00, 0x48, 0x41, 0x00,
+    0x80, 0x40, 0x81, 0x00, 0x48, 0x00,
+    // 0x78 'x'
+    0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x40, 0x00, 0x00, 0x02, 0x80, 0x04,
+    0x88, 0x40, 0x41, 0x20, 0x10, 0x00, 0x04, 0x08, 0x08, 0x82, 0x04, 0x10,
+    0x08, 0x00, 0x00, 0x02, 0x80, 0x08, 0x80, 0x0C, 0x60, 0x00,
+    // 0x79 'y'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x20, 0x00, 0x2B, 0x90, 0x00, 0x13, 0x86, 0x00, 0x83,
+    0x40, 0x3C, 0x03, 0x08, 0x00, 0x03, 0x00, 0x34, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x90, 0x03, 0xBC, 0x00, 0x03, 0x80, 0x80, 0x03,
+    0x04, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x7A 'z'
+    0x00, 0x02, 0x00, 0x00, 0x40, 0x04, 0x10, 0x40, 0x80, 0x80, 0x01, 0x0A,
+    0x02, 0x08, 0x54, 0x00, 0x08, 0x00, 0x20, 0x08, 0x48, 0x10, 0x90, 0x10,
+    0x20, 0x00,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x08, 0x2F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x00, 0x04, 0x5F, 0x03, 0xE2, 0x20, 0x1F, 0x10, 0x08, 0x00, 0x2F,
+    0x03, 0xC0, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0C, 0x3F, 0x00, 0x01, 0x80, 0xBF,
+    0x00, 0x30, 0x18, 0x3F, 0x06, 0x03, 0x00, 0x3F, 0x40, 0x20, 0x00, 0x3F,
+    0x06, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x2F, 0x60, 0x00, 0x00, 0x4F,
+    0x20, 0x64, 0x3E, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x28, 0x00, 0x0F,
+    0x41, 0x06, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x7E '~'
+    0x17, 0x4F, 0x17, 0xA7, 0xA7, 0x07, 0x17, 0x07, 0x2F, 0x2F, 0x0F, 0x07,
+    0x27, 0x07,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x83, 0x00, 0x0C, 0x0B,
+    0x20, 0xC0, 0x23, 0x90, 0x0E, 0x03, 0x93, 0x00, 0x03, 0x60, 0x00, 0x03,
+    // 0xA2 '¢'
+    0x00, 0x07, 0x80, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x00, 0x10, 0x48, 0x6F, 0x01, 0x00, 0x26, 0x0F, 0x00, 0x00, 0x40, 0xCF,
+    0x02, 0x86, 0x00, 0x0F, 0x00, 0xC1, 0x00, 0x0F, 0x18, 0x10, 0x28, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x30, 0x80, 0x50, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xA3 '£'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x20, 0x47,
+    0x00, 0x11, 0x97, 0x00, 0x18, 0x07, 0x00, 0xC0, 0xD7, 0x02, 0x02, 0x17,
+    0x00, 0x10, 0x17, 0x23, 0x10, 0x07, 0x08, 0x10, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x10, 0x07, 0x20, 0x10, 0x47, 0x00, 0x00, 0x47, 0x0C, 0x00, 0x67,
+    0x00, 0x00, 0x07, 0x28, 0x00, 0x07,
+    // 0xA4 '¤'
+    0x00, 0x17, 0x00, 0x0F, 0x40, 0x17, 0xA3, 0xC7, 0x58, 0x07, 0x23, 0x97,
+    0x28, 0x57, 0x10, 0x07, 0x40, 0x17, 0x40, 0x57, 0x40, 0x07, 0x41, 0x27,
+    0x00, 0x57, 0x01, 0x2F, 0x40, 0x17, 0xA0, 0x07, 0xC0, 0x07, 0x00, 0x07,
+    // 0xA5 '¥'
+    0x40, 0x00, 0x0F, 0x20, 0x40, 0x0F, 0x10, 0x28, 0x0F, 0x02, 0x28, 0x2F,
+    0x00, 0x28, 0x0F, 0x08, 0x1A, 0x0F, 0x21, 0x00, 0x0F, 0x00, 0x01, 0x8F,
+    0x00, 0x40, 0x2F, 0x00, 0x08, 0x3F, 0x02, 0x28, 0x0F, 0x20, 0xA8, 0x0F,
+    0x20, 0x2C, 0x0F, 0x04, 0x20, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0xA7 '§'
+    0x00, 0x00, 0x29, 0x03, 0x20, 0x45, 0x08, 0x00, 0x21, 0x10, 0x20, 0x01,
+    0x21, 0x10, 0x09, 0x10, 0x88, 0x09, 0x40, 0x01, 0x09, 0x20, 0x00, 0x95,
+    0x20, 0x01, 0x01, 0x00, 0x40, 0x01, 0x0C, 0x22, 0x01, 0x00, 0x08, 0x81,
+    0x00, 0x00, 0x01,
+    // 0xA9 '©'
+    0x00, 0x00, 0x07, 0x03, 0x04, 0x07, 0x08, 0xF0, 0x07, 0x10, 0x02, 0x07,
+    0x28, 0x00, 0x07, 0x10, 0x00, 0x07, 0x41, 0x04, 0x17, 0x22, 0x02, 0x27,
+    0x85, 0x00, 0x27, 0x82, 0x01, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x82, 0x01, 0x07, 0x80, 0x01, 0x27, 0x20, 0x02, 0x27, 0x40, 0x00, 0x17,
+    0x10, 0x00, 0x07, 0x28, 0x00, 0x07, 0x12, 0x02, 0x07, 0x00, 0x71, 0x07,
+    0x01, 0x04, 0x07, 0x00, 0x00, 0x07,
+    // 0xAA 'ª'
+    0x00, 0x0B, 0x08, 0x13, 0x20, 0x53, 0x40, 0x53, 0x20, 0x13, 0x80, 0x93,
+    0x84, 0x93, 0x00, 0x13, 0x88, 0x53, 0xC0, 0x83, 0x00, 0x03,
+    // 0xAB '«'
+    0x00, 0x1F, 0x04, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x21, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x01, 0x1F, 0x00, 0x9F, 0x02, 0x5F, 0x08, 0x3F, 0x50, 0x7F,
+    0x20, 0x1F, 0x40, 0x1F,
+    // 0xAE '®'
+    0x00, 0x01, 0x08, 0x21, 0x06, 0x49, 0x10, 0x11, 0x40, 0x09, 0x08, 0x23,
+    0x80, 0x07, 0xC0, 0x81, 0xC0, 0x81, 0xC1, 0x05, 0x06, 0x47, 0x20, 0x01,
+    0x10, 0x05, 0x20, 0x29, 0x08, 0x11, 0x01, 0x01,
+    // 0xB0 '°'
+    0x00, 0x3F, 0x01, 0x3F, 0x40, 0xBF, 0x00, 0x3F, 0x21, 0x3F, 0x20, 0x7F,
+    0x21, 0x3F, 0x12, 0x3F, 0x40, 0x3F, 0x12, 0x3F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x08, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x02, 0x01, 0xFF,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x08, 0x57, 0x50, 0xA7, 0x01, 0x47,
+    0x02, 0x07, 0x14, 0x07, 0x40, 0x03, 0x24, 0x03, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x0B, 0x00, 0x03, 0x10, 0x03, 0x00, 0x03, 0x42, 0x07, 0x00, 0x03,
+    0x04, 0x4B, 0x02, 0x03, 0x04, 0xE3, 0x00, 0x03,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x27, 0x00, 0x06, 0x07, 0x01, 0x80, 0x1B,
+    0x30, 0x00, 0x03, 0x00, 0xE0, 0x03, 0x98, 0x08, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x0A, 0x03, 0x00, 0x14, 0x03, 0x00, 0xC0, 0x03,
+    0x0C, 0x02, 0x03, 0x00, 0x20, 0x03, 0x86, 0x00, 0x03, 0xC0, 0x02, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x40, 0x0B, 0x0A,
+    0x00, 0x00, 0x68, 0x00, 0x0C, 0x14, 0x01, 0x81, 0x88, 0x10, 0x30, 0x20,
+    0xA6, 0x06, 0x00, 0x80, 0xC0, 0x00, 0x98, 0x00, 0x00, 0xA0, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xB7 '·'
+    0x37, 0x07, 0x87, 0x07, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x07, 0x30, 0x07, 0x10, 0xC7, 0x18, 0x07, 0x40, 0xC7,
+    0x0C, 0x03, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x03, 0x00, 0x03, 0x10, 0x93, 0x00, 0x53, 0x10, 0x13, 0x20, 0x13,
+    0x80, 0x53, 0x82, 0x13, 0x00, 0x13, 0x42, 0x03, 0x00, 0x03,
+    // 0xBB '»'
+    0x00, 0x1F, 0x00, 0x5F, 0x00, 0xBF, 0x01, 0x5F, 0x4A, 0x1F, 0x20, 0x1F,
+    0x10, 0x3F, 0x04, 0x1F, 0x40, 0x1F, 0x10, 0x5F, 0x04, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x20, 0x60, 0x01,
+    0x2C, 0x00, 0x01, 0x00, 0x68, 0x01, 0x0C, 0x00, 0x0D, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x91, 0x00, 0x01, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x09, 0x01, 0x00, 0x10, 0x01, 0x00, 0x08, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x40, 0x41, 0x04, 0x81, 0x01, 0x00, 0x02, 0x01, 0x24, 0x05, 0x81,
+    0x48, 0x0A, 0x81, 0x00, 0x14, 0x81, 0x00, 0x28, 0xA1, 0x00, 0x56, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x8C, 0x81, 0x00, 0x00, 0xC1,
+    // 0xBD '½'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x20, 0x60, 0x01,
+    0x2C, 0x00, 0x01, 0x00, 0x68, 0x0D, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x91, 0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x08, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x48, 0x01, 0x00, 0x80, 0x01, 0x00, 0x40, 0x01,
+    0x04, 0x80, 0x01, 0x00, 0x00, 0x01, 0x24, 0x10, 0x01, 0x08, 0x08, 0x01,
+    0x40, 0x10, 0x81, 0x00, 0x21, 0x41, 0x00, 0x80, 0x01, 0x00, 0xA4, 0x01,
+    0x00, 0x18, 0x01, 0x00, 0x00, 0x11, 0x00, 0x38, 0x01,
+    // 0xBE '¾'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x18, 0x02, 0x01, 0x29, 0x02, 0x01,
+    0x00, 0x08, 0x01, 0x10, 0x00, 0x01, 0x10, 0x60, 0x01, 0x09, 0x08, 0x01,
+    0x20, 0x60, 0x25, 0x00, 0x00, 0x49, 0x00, 0x00, 0x01, 0x00, 0x02, 0x41,
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x00, 0x24, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x20, 0x01, 0x02, 0x00, 0x41, 0x00, 0x01, 0x01, 0x12, 0x02, 0x01,
+    0x00, 0x05, 0x81, 0x00, 0x0A, 0x81, 0x60, 0x14, 0x81, 0x00, 0x28, 0xA1,
+    0x00, 0x56, 0x01, 0x00, 0x00, 0x21, 0x00, 0x8C, 0x81, 0x00, 0x00, 0xC1,
+    // 0xBF '¿'
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x08, 0x87, 0x00, 0x10, 0x4F,
+    0x00, 0x20, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x80, 0x4F, 0x90, 0x00, 0x17,
+    0x81, 0x80, 0x07, 0x00, 0x00, 0x07,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x44, 0x3F, 0x00, 0x01, 0x08, 0x1F,
+    0x00, 0x00, 0x48, 0x1F, 0x00, 0x09, 0x08, 0x1F, 0x10, 0x24, 0x08, 0x1F,
+    0x00, 0x80, 0x08, 0x1F, 0x08, 0x00, 0x08, 0x1F, 0x01, 0x01, 0x88, 0x5F,
+    0x10, 0xC0, 0x07, 0x5F, 0x00, 0x06, 0x00, 0x1F, 0x00, 0x00, 0x30, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x44, 0x3F, 0x00, 0x01, 0x08, 0x1F,
+    0x00, 0x00, 0x48, 0x1F, 0x00, 0x09, 0x08, 0x1F, 0x00, 0x24, 0x08, 0x1F,
+    0x00, 0x80, 0x08, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x21, 0x01, 0x88, 0x5F,
+    0x08, 0xC0, 0x07, 0x5F, 0x40, 0x06, 0x00, 0x1F, 0x10, 0x00, 0x30, 0x1F,
+    0x60, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x44, 0x3F, 0x00, 0x01, 0x08, 0x1F,
+    0x00, 0x00, 0x48, 0x1F, 0x0C, 0x09, 0x08, 0x1F, 0x14, 0x24, 0x08, 0x1F,
+    0x20, 0x80, 0x08, 0x1F, 0x40, 0x00, 0x08, 0x1F, 0x01, 0x01, 0x88, 0x5F,
+    0x90, 0xC0, 0x07, 0x5F, 0x40, 0x06, 0x00, 0x1F, 0x24, 0x00, 0x30, 0x1F,
+    0x10, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x44, 0x3F, 0x00, 0x01, 0x08, 0x1F,
+    0x00, 0x00, 0x48, 0x1F, 0x28, 0x09, 0x08, 0x1F, 0x48, 0x24, 0x08, 0x1F,
+    0x00, 0x80, 0x08, 0x1F, 0x00, 0x00, 0x08, 0x1F, 0x49, 0x01, 0x88, 0x5F,
+    0x20, 0xC0, 0x07, 0x5F, 0x28, 0x06, 0x00, 0x1F, 0x40, 0x00, 0x30, 0x1F,
+    0x60, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x20, 0xBF, 0x00, 0x00, 0x88, 0x7F, 0x00, 0x02, 0x10, 0x3F,
+    0x00, 0x00, 0x90, 0x3F, 0x10, 0x12, 0x10, 0x3F, 0x80, 0x48, 0x10, 0x3F,
+    0x91, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x02, 0x03, 0x10, 0xBF,
+    0x01, 0x80, 0x0E, 0xBF, 0x00, 0x0C, 0x00, 0x3F, 0x80, 0x00, 0x60, 0x3F,
+    0x80, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x08, 0x2F, 0x00, 0x00, 0x22, 0x1F, 0x00, 0x00, 0x84, 0x0F,
+    0x00, 0x00, 0x24, 0x0F, 0x00, 0x04, 0x84, 0x0F, 0x24, 0x12, 0x04, 0x0F,
+    0x42, 0x40, 0x04, 0x0F, 0x24, 0x00, 0x04, 0x0F, 0x84, 0x80, 0xC4, 0x2F,
+    0x20, 0x60, 0x03, 0xAF, 0x00, 0x03, 0x00, 0x0F, 0x28, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x1F, 0x00, 0x12, 0x0F,
+    0x00, 0x24, 0x0F, 0x00, 0x04, 0x0F, 0x01, 0x24, 0x0F, 0x02, 0x04, 0x2F,
+    0x41, 0x04, 0x0F, 0x82, 0x07, 0x0F, 0x80, 0x60, 0x0F, 0x8C, 0x00, 0xCF,
+    0x80, 0x18, 0x0F, 0x83, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xA0, 0x00, 0x0F,
+    0xA0, 0x00, 0x0F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x8F, 0xA0, 0x02, 0x2F,
+    0x9C, 0x01, 0x0F, 0x80, 0x00, 0x0F, 0x60, 0x00, 0x0F,
+    // 0xC7 'Ç'
+    0x00, 0x7E, 0x00, 0x0F, 0x02, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x20, 0x0F,
+    0x00, 0x82, 0x00, 0x0F, 0x00, 0x00, 0x90, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x44, 0x0F, 0x00, 0x00, 0x04, 0x2F, 0x00, 0x00, 0x04, 0x4F,
+    0xA0, 0x00, 0x03, 0x0F, 0xA0, 0x00, 0x40, 0x0F, 0xA0, 0x00, 0x50, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F,
+    0x04, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x01, 0x00, 0x20, 0x1F, 0x01, 0x18, 0x80, 0x1F,
+    0x51, 0x40, 0x80, 0x1F, 0x01, 0x40, 0x80, 0x1F, 0x49, 0x40, 0x00, 0x1F,
+    0x21, 0x40, 0x00, 0x9F, 0x11, 0x00, 0x01, 0x1F, 0x09, 0x00, 0x04, 0x5F,
+    0x01, 0x30, 0x02, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x1F,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x01, 0x00, 0x20, 0x1F, 0x01, 0x18, 0x80, 0x1F,
+    0x01, 0x40, 0x80, 0x1F, 0x09, 0x40, 0x80, 0x1F, 0x11, 0x40, 0x00, 0x1F,
+    0x01, 0x40, 0x00, 0x9F, 0x09, 0x00, 0x01, 0x1F, 0x41, 0x00, 0x04, 0x5F,
+    0x11, 0x30, 0x02, 0x1F, 0x61, 0x00, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x1F,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x01, 0x00, 0x20, 0x1F, 0x0D, 0x18, 0x80, 0x1F,
+    0x15, 0x40, 0x80, 0x1F, 0x01, 0x40, 0x80, 0x1F, 0x01, 0x40, 0x00, 0x1F,
+    0x11, 0x40, 0x00, 0x9F, 0x81, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x04, 0x5F,
+    0x01, 0x30, 0x02, 0x1F, 0x15, 0x00, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0x1F,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x01, 0x00, 0x30, 0x3F, 0x02, 0x06, 0x00, 0x3F,
+    0x02, 0xC0, 0x0C, 0x3F, 0x02, 0x00, 0x40, 0x3F, 0x52, 0x31, 0x00, 0x3F,
+    0x02, 0x81, 0x00, 0x3F, 0x92, 0x81, 0x00, 0x3F, 0x62, 0x80, 0x00, 0x3F,
+    0x02, 0x80, 0x01, 0x3F, 0x02, 0x00, 0x02, 0x3F, 0x52, 0x00, 0x08, 0xBF,
+    0x82, 0x60, 0x04, 0x3F, 0x92, 0x00, 0x00, 0x3F, 0x41, 0x80, 0x00, 0x3F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x21, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x41, 0x00, 0xC0, 0x5F, 0x09, 0x08, 0x00, 0x1F,
+    0x01, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x11, 0x00, 0xC0, 0x5F, 0x01, 0x08, 0x00, 0x1F,
+    0x29, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x05, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x09, 0x00, 0xC0, 0x5F, 0x11, 0x08, 0x00, 0x1F,
+    0x81, 0x40, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x1F, 0x49, 0x80, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x21, 0x00, 0x30, 0x3F, 0x02, 0x06, 0x00, 0x3F,
+    0x92, 0xC0, 0x0C, 0x3F, 0x02, 0x01, 0x80, 0xBF, 0x02, 0x10, 0x00, 0x3F,
+    0x02, 0x80, 0x00, 0x3F, 0x62, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x3F,
+    0x90, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x40, 0x07, 0x00, 0x40, 0xC7,
+    0x60, 0x5C, 0x07, 0x21, 0x80, 0x07, 0x30, 0x03, 0x07, 0x80, 0x10, 0x07,
+    0x8C, 0x40, 0x07, 0x80, 0x40, 0x07, 0x80, 0x40, 0x07, 0x80, 0x40, 0x17,
+    0xA0, 0x00, 0x47, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x02, 0x47,
+    0x40, 0x08, 0x07, 0x00, 0x80, 0x07, 0x00, 0x02, 0x07, 0x08, 0x18, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x30, 0x0F, 0x01, 0x06, 0x00, 0x8F,
+    0x01, 0x20, 0x18, 0x4F, 0x01, 0x03, 0x00, 0x2F, 0x00, 0x04, 0x00, 0x0F,
+    0x00, 0x41, 0x00, 0x0F, 0x08, 0x10, 0x40, 0x0F, 0x10, 0x00, 0x10, 0x0F,
+    0x00, 0x00, 0x80, 0x0F, 0x10, 0x00, 0x20, 0x8F, 0x08, 0x00, 0x08, 0x2F,
+    0x20, 0x00, 0x02, 0x0F, 0x08, 0x80, 0x30, 0x0F, 0x01, 0x06, 0x01, 0x8F,
+    0x01, 0x00, 0x30, 0x0F, 0x01, 0x03, 0x00, 0x0F, 0x01, 0x60, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0xE6, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x02, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x09, 0x40, 0x00, 0x8F, 0x21, 0x40, 0x00, 0x2F,
+    0x11, 0x40, 0x01, 0x0F, 0x01, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x8F,
+    0x00, 0x8C, 0xE1, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x10, 0x0F,
+    0x00, 0x07, 0x80, 0x0F,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0xE6, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x02, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x8F, 0x21, 0x40, 0x00, 0x2F,
+    0x09, 0x40, 0x01, 0x0F, 0x41, 0x00, 0x02, 0x0F, 0x10, 0x00, 0x08, 0x8F,
+    0x60, 0x8C, 0xE1, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x10, 0x0F,
+    0x00, 0x07, 0x80, 0x0F,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0xE6, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x02, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x0C, 0x00, 0x00, 0x0F, 0x14, 0x00, 0x00, 0x0F,
+    0x21, 0x40, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x8F, 0x01, 0x40, 0x00, 0x2F,
+    0x81, 0x40, 0x01, 0x0F, 0x01, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x8F,
+    0x14, 0x8C, 0xE1, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x10, 0x0F,
+    0x00, 0x07, 0x80, 0x0F,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0xE6, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x02, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x48, 0x00, 0x00, 0x0F,
+    0x01, 0x40, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x8F, 0x01, 0x40, 0x00, 0x2F,
+    0x21, 0x40, 0x01, 0x0F, 0x21, 0x00, 0x02, 0x0F, 0x48, 0x00, 0x08, 0x8F,
+    0x10, 0x8C, 0xE1, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x10, 0x0F,
+    0x00, 0x07, 0x80, 0x0F,
+    // 0xD6 'Ö'
+    0x00, 0x01, 0xCC, 0x1F, 0x00, 0x08, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x02, 0x04, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x92, 0x80, 0x00, 0x1F, 0x42, 0x80, 0x01, 0x1F, 0x02, 0x80, 0x00, 0x5F,
+    0x02, 0x80, 0x02, 0x1F, 0x12, 0x00, 0x04, 0x1F, 0x80, 0x00, 0x11, 0x1F,
+    0x81, 0x19, 0xC2, 0x1F, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x40, 0x20, 0x1F,
+    0x00, 0x0F, 0x00, 0x1F,
+    // 0xD7 '×'
+    0x00, 0x1F, 0xA0, 0xBF, 0x11, 0x1F, 0x0A, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x11, 0x1F, 0x20, 0x9F, 0x40, 0x5F, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x77, 0x57, 0x02, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x00, 0x82, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x57, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x87, 0x81, 0x01, 0x07,
+    0x0A, 0x04, 0x47, 0x42, 0x70, 0x87, 0x00, 0x00, 0x07, 0x50, 0x08, 0x07,
+    0xA3, 0xC0, 0x07, 0x40, 0x00, 0x07,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x8F, 0x01, 0x4C, 0x00, 0x0F,
+    0x01, 0x00, 0x1E, 0x2F, 0x01, 0x03, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x01, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x30, 0x0F, 0x01, 0x46, 0x02, 0x0F,
+    0x01, 0x00, 0x30, 0x0F, 0x01, 0x06, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x8F, 0x01, 0x4C, 0x00, 0x0F,
+    0x01, 0x00, 0x1E, 0x2F, 0x01, 0x03, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x01, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x40, 0x80, 0x30, 0x0F, 0x11, 0x46, 0x02, 0x0F,
+    0x61, 0x00, 0x30, 0x0F, 0x01, 0x06, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x8F, 0x01, 0x4C, 0x00, 0x0F,
+    0x01, 0x00, 0x1E, 0x2F, 0x01, 0x03, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x0D, 0x00, 0x00, 0x0F, 0x14, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x30, 0x0F, 0x01, 0x46, 0x02, 0x0F,
+    0x15, 0x00, 0x30, 0x0F, 0x01, 0x06, 0x00, 0x0F, 0x01, 0x20, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x02, 0x98, 0x00, 0x1F,
+    0x02, 0x00, 0x3C, 0x5F, 0x02, 0x06, 0x00, 0x1F, 0x02, 0x40, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x52, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F,
+    0x90, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x60, 0x1F, 0x82, 0x8C, 0x04, 0x1F,
+    0x82, 0x00, 0x60, 0x1F, 0x02, 0x0C, 0x00, 0x1F, 0x02, 0x40, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCF,
+    0x40, 0x0C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x04, 0x2F, 0x80, 0x42, 0x2F,
+    0x80, 0x02, 0x0F, 0x88, 0x00, 0x0F, 0x88, 0x01, 0x0F, 0x48, 0x04, 0x0F,
+    0x0A, 0x00, 0x0F, 0x01, 0x12, 0x0F, 0x04, 0x04, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0xC0, 0x0F,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0xC0, 0x47,
+    0x00, 0x18, 0x02, 0x07, 0x01, 0x00, 0x60, 0x07, 0x08, 0x0C, 0x00, 0x07,
+    0x00, 0xC0, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0xA0, 0x00, 0x00, 0x07, 0x80, 0x44, 0x08, 0x07, 0x00, 0x82, 0x08, 0x07,
+    0x20, 0x41, 0x04, 0x07, 0x88, 0x04, 0x60, 0x07, 0x02, 0x02, 0x00, 0x07,
+    0x38, 0x00, 0xE0, 0x07,
+    // 0xE0 'à'
+    0x00, 0x00, 0xEC, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08,
+    0x00, 0x08, 0x00, 0x00, 0x10, 0x0A, 0x10, 0x00, 0x00, 0x08, 0xA0, 0x00,
+    0x24, 0xA0, 0x50, 0x00, 0x01, 0x02, 0x04, 0x48, 0x00, 0x00, 0x40, 0xC0,
+    0x00, 0x0C, 0x0A, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00,
+    // 0xE1 'á'
+    0x00, 0x00, 0xEC, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08,
+    0x00, 0x08, 0x00, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+    0x08, 0xA0, 0x50, 0x04, 0x01, 0x02, 0x48, 0x48, 0x00, 0x90, 0x40, 0xC0,
+    0x20, 0x0C, 0x0A, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00,
+    // 0xE2 'â'
+    0x00, 0x00, 0xEC, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08,
+    0x00, 0x08, 0x00, 0x02, 0x10, 0x0A, 0x00, 0x00, 0x00, 0x20, 0xA0, 0x00,
+    0x40, 0xA0, 0x50, 0x00, 0x01, 0x02, 0x80, 0x48, 0x00, 0x40, 0x40, 0xC0,
+    0x10, 0x0C, 0x0A, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00,
+    // 0xE3 'ã'
+    0x00, 0x01, 0xD9, 0x00, 0x08, 0x05, 0x00, 0x00, 0x01, 0x00, 0x04, 0x11,
+    0x00, 0x10, 0x01, 0x20, 0x20, 0x15, 0x00, 0x00, 0x01, 0xA1, 0x40, 0x01,
+    0x81, 0x40, 0xA1, 0x00, 0x02, 0x05, 0x28, 0x90, 0x01, 0x08, 0x81, 0x81,
+    0x00, 0x18, 0x15, 0x60, 0x80, 0x29, 0x00, 0x00, 0x01,
+    // 0xE4 'ä'
+    0x00, 0x03, 0xB3, 0x00, 0x10, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x08, 0x23,
+    0x00, 0x20, 0x03, 0x00, 0x40, 0x2B, 0x90, 0x00, 0x03, 0x82, 0x80, 0x03,
+    0x02, 0x81, 0x43, 0x00, 0x04, 0x0B, 0x21, 0x20, 0x03, 0x91, 0x03, 0x03,
+    0x80, 0x30, 0x2B, 0xA1, 0x00, 0x53, 0x00, 0x00, 0x03,
+    // 0xE5 'å'
+    0x00, 0x00, 0x76, 0x7F, 0x00, 0x02, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x01, 0x04, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x08, 0x05, 0x7F,
+    0x12, 0x00, 0x00, 0x7F, 0x01, 0x50, 0x00, 0x7F, 0x00, 0x50, 0x28, 0x7F,
+    0x22, 0x00, 0x81, 0x7F, 0x05, 0x24, 0x00, 0x7F, 0x40, 0x20, 0x60, 0x7F,
+    0x1C, 0x06, 0x05, 0x7F, 0x00, 0x20, 0x0A, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE6 'æ'
+    0x00, 0xEC, 0x04, 0x02, 0x00, 0x00, 0x02, 0x08, 0x08, 0x00, 0x50, 0x0A,
+    0x00, 0x14, 0xA0, 0x08, 0xA0, 0x90, 0xA2, 0x04, 0x10, 0x02, 0x43, 0x40,
+    0x09, 0x00, 0x40, 0x00, 0x20, 0x80, 0x80, 0x0A, 0x85, 0x00, 0x90, 0x14,
+    0x00, 0x18, 0x38, 0x00,
+    // 0xE7 'ç'
+    0x01, 0xD8, 0x01, 0x04, 0x00, 0x05, 0x10, 0x00, 0x41, 0x24, 0x08, 0x81,
+    0x40, 0x00, 0x81, 0x00, 0x00, 0x01, 0x20, 0x02, 0x21, 0xA0, 0x08, 0x01,
+    0x80, 0x04, 0x01, 0x10, 0x08, 0x01, 0x60, 0x00, 0x01,
+    // 0xE8 'è'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x20, 0x00, 0x24, 0x48,
+    0x20, 0x11, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x80, 0x24, 0x80, 0x0A,
+    0x00, 0xA9, 0x00, 0x00, 0x02, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
+    // 0xE9 'é'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x20, 0x00, 0x24, 0x48,
+    0x00, 0x11, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x0A,
+    0x24, 0xA9, 0x00, 0x48, 0x02, 0x10, 0x90, 0x44, 0x00, 0x20, 0x00, 0x00,
+    // 0xEA 'ê'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x20, 0x00, 0x24, 0x48,
+    0x02, 0x11, 0x00, 0x10, 0x20, 0x00, 0x20, 0x02, 0x80, 0x40, 0x80, 0x0A,
+    0x00, 0xA9, 0x00, 0x88, 0x02, 0x10, 0x40, 0x44, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xEB 'ë'
+    0x00, 0x07, 0x63, 0x00, 0x10, 0x03, 0x00, 0x40, 0x83, 0x00, 0x91, 0x23,
+    0x10, 0x44, 0x03, 0x90, 0x80, 0x03, 0x80, 0x0A, 0x03, 0x02, 0x00, 0x2B,
+    0x02, 0xA4, 0x03, 0x60, 0x08, 0x43, 0x91, 0x10, 0x03, 0x80, 0x00, 0x03,
+    0x60, 0x00, 0x03,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x20, 0x22, 0x00, 0x00, 0x30, 0x18,
+    0x40, 0x81, 0x8A, 0x00, 0x18, 0x14, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x00,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x00, 0x22, 0x00, 0x00, 0x30, 0x18,
+    0x04, 0x81, 0x8A, 0x10, 0x18, 0x14, 0x20, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0xEE 'î'
+    0x00, 0x00, 0x00, 0x04, 0x20, 0x60, 0x0A, 0x22, 0x00, 0x10, 0x30, 0x18,
+    0x00, 0x81, 0x8A, 0x10, 0x18, 0x14, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x03, 0x20, 0x81, 0x83, 0x90, 0x88, 0x03, 0x80, 0xC0, 0x63,
+    0xA2, 0x06, 0x2B, 0x00, 0x60, 0x53, 0x00, 0x00, 0x63, 0x40, 0x00, 0x03,
+    0x90, 0x00, 0x03, 0x80, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0xE2,
+    0x00, 0x04, 0x08, 0x00, 0x50, 0x00, 0x02, 0x00, 0x04, 0x42, 0xA0, 0x00,
+    0x18, 0x80, 0x0A, 0x04, 0xA0, 0x00, 0x02, 0x00, 0x24, 0x28, 0xC7, 0x08,
+    0x42, 0x00, 0x20, 0x60, 0xC1, 0x80, 0x00, 0x00, 0x00,
+    // 0xF1 'ñ'
+    0x00, 0x80, 0x05, 0x00, 0x40, 0x61, 0x00, 0x4C, 0x01, 0x01, 0x00, 0x31,
+    0x01, 0x00, 0x81, 0x20, 0xC2, 0x01, 0x10, 0x28, 0x01, 0xA0, 0x50, 0x01,
+    0x80, 0xA0, 0x01, 0x40, 0x00, 0x35, 0x29, 0x03, 0x01, 0x09, 0x30, 0x01,
+    0x01, 0x01, 0x95, 0x60, 0x98, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xF2 'ò'
+    0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x22, 0x08,
+    0x00, 0x48, 0x00, 0x00, 0x10, 0x04, 0x10, 0x20, 0x00, 0x08, 0xA0, 0x0A,
+    0x24, 0xA0, 0x10, 0x00, 0x80, 0x04, 0x04, 0x0F, 0x08, 0x00, 0x40, 0x00,
+    0x00, 0x10, 0x80, 0x00, 0x00, 0x00,
+    // 0xF3 'ó'
+    0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x22, 0x08,
+    0x00, 0x48, 0x00, 0x00, 0x10, 0x04, 0x00, 0x20, 0x00, 0x00, 0xA0, 0x0A,
+    0x08, 0xA0, 0x10, 0x04, 0x80, 0x04, 0x48, 0x0F, 0x08, 0x90, 0x40, 0x00,
+    0x20, 0x10, 0x80, 0x00, 0x00, 0x00,
+    // 0xF4 'ô'
+    0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x22, 0x08,
+    0x00, 0x48, 0x00, 0x02, 0x10, 0x04, 0x00, 0x20, 0x00, 0x20, 0xA0, 0x0A,
+    0x40, 0xA0, 0x10, 0x00, 0x80, 0x04, 0x80, 0x0F, 0x08, 0x44, 0x40, 0x00,
+    0x10, 0x10, 0x80, 0x00, 0x00, 0x00,
+    // 0xF5 'õ'
+    0x00, 0x03, 0x31, 0x00, 0x00, 0x01, 0x00, 0x20, 0x05, 0x00, 0x44, 0x11,
+    0x00, 0x90, 0x01, 0x20, 0x20, 0x09, 0x00, 0x40, 0x01, 0x81, 0x40, 0x15,
+    0x81, 0x40, 0x21, 0x01, 0x00, 0x09, 0x28, 0x1E, 0x11, 0x28, 0x80, 0x01,
+    0x00, 0x21, 0x01, 0x60, 0x00, 0x01,
+    // 0xF6 'ö'
+    0x00, 0x06, 0x63, 0x00, 0x00, 0x03, 0x00, 0x40, 0x0B, 0x00, 0x88, 0x23,
+    0x01, 0x20, 0x03, 0x00, 0x40, 0x13, 0x90, 0x80, 0x03, 0x82, 0x80, 0x2B,
+    0x02, 0x80, 0x43, 0x02, 0x00, 0x13, 0x20, 0x3C, 0x23, 0x91, 0x00, 0x03,
+    0x80, 0x42, 0x03, 0xA0, 0x00, 0x03,
+    // 0xF7 '÷'
+    0x00, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x95, 0x4F, 0x85, 0x0F, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x02, 0x07,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x02,
+    0x22, 0x58, 0x48, 0xA0, 0x10, 0x44, 0x20, 0x80, 0xA0, 0x0A, 0xA0, 0x10,
+    0x88, 0x04, 0x03, 0x08, 0x40, 0x00, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0x00, 0x22, 0x00, 0x00, 0x80, 0x10,
+    0x00, 0x81, 0x00, 0x00, 0x18, 0x00, 0x10, 0x00, 0x0A, 0x08, 0x00, 0x14,
+    0x04, 0x00, 0x28, 0x10, 0x00, 0x10, 0x04, 0x02, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0x00, 0x22, 0x00, 0x00, 0x80, 0x10,
+    0x00, 0x81, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x14,
+    0x08, 0x00, 0x28, 0x04, 0x00, 0x10, 0x08, 0x02, 0x00, 0x80, 0x20, 0x00,
+    0x20, 0x01, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0x00, 0x22, 0x00, 0x00, 0x80, 0x10,
+    0x00, 0x81, 0x00, 0x02, 0x18, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x00, 0x14,
+    0x48, 0x00, 0x28, 0x00, 0x00, 0x10, 0x10, 0x02, 0x00, 0x44, 0x20, 0x00,
+    0x10, 0x01, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x03, 0x00, 0x81, 0x93, 0x00, 0x88, 0x03, 0x02, 0x00, 0x43,
+    0x02, 0x04, 0x03, 0x40, 0x60, 0x03, 0x90, 0x00, 0x2B, 0x80, 0x00, 0x53,
+    0x40, 0x00, 0xA3, 0x00, 0x00, 0x43, 0x00, 0x08, 0x03, 0x10, 0x80, 0x03,
+    0x90, 0x06, 0x03, 0xA0, 0x60, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x18, 0x07, 0x40, 0x01, 0x00, 0xE7,
+    0x20, 0x30, 0x04, 0x07, 0x23, 0x00, 0x90, 0x07, 0x80, 0x32, 0x00, 0x17,
+    0x81, 0x28, 0x00, 0x07, 0xB0, 0x50, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x48, 0x07, 0x01, 0x36, 0x10, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x81, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0xAF,
+    0x02, 0x40, 0x00, 0x4F, 0x42, 0x18, 0x02, 0x0F, 0x91, 0x00, 0xF0, 0x0F,
+    0x80, 0x20, 0x00, 0x0F, 0x40, 0x00, 0xD0, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x80, 0x0F, 0x10, 0x02, 0x40, 0x0F, 0x92, 0xF0, 0x00, 0x0F,
+    0x82, 0x02, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x20, 0x3F, 0x00, 0x22, 0x10, 0x3F, 0x00, 0x84, 0x00, 0x3F,
+    0x00, 0x24, 0x00, 0x3F, 0x04, 0x84, 0x00, 0x3F, 0x12, 0x04, 0x00, 0x3F,
+    0x40, 0x04, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x80, 0xC4, 0x21, 0x3F,
+    0x60, 0x03, 0xA4, 0x3F, 0x03, 0x00, 0x08, 0x7F, 0x00, 0x18, 0x00, 0x3F,
+    0x00, 0x00, 0xC8, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x3F,
+    // 0x105 'ą'
+    0x00, 0xEC, 0x07, 0x04, 0x02, 0x07, 0x00, 0x00, 0x07, 0x02, 0x08, 0x07,
+    0x08, 0x00, 0x07, 0x10, 0x0A, 0x07, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x50, 0x77, 0x01, 0x02, 0x0F, 0x48, 0x00, 0x67, 0x40, 0xC1, 0x07,
+    0x0C, 0x0A, 0x0F, 0x40, 0x14, 0x07, 0x00, 0x00, 0x07,
+    // 0x106 'Ć'
+    0x00, 0x00, 0xFC, 0x0F, 0x00, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x01, 0x04, 0x0F, 0x00, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x09, 0x40, 0x00, 0x0F, 0x11, 0x40, 0x00, 0x8F, 0x01, 0x40, 0x00, 0xAF,
+    0x09, 0x00, 0x00, 0x0F, 0x41, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F,
+    0x20, 0x08, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x107 'ć'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x24, 0x08,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0xA0, 0x08,
+    0x24, 0x80, 0x04, 0x48, 0x10, 0x08, 0x90, 0x60, 0x00, 0x20, 0x00, 0x00,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x7E, 0x07, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x82, 0x07, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x47, 0x20, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x04, 0xA0, 0x00, 0x07, 0x12, 0xA0, 0x00, 0x47, 0x02, 0xA0, 0x00, 0x57,
+    0x10, 0x80, 0x00, 0x07, 0x20, 0x80, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x07, 0x40, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x10D 'č'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x24, 0x08,
+    0x40, 0x40, 0x00, 0x80, 0x00, 0x00, 0x44, 0x20, 0x02, 0x10, 0xA0, 0x08,
+    0x10, 0x80, 0x04, 0x20, 0x10, 0x08, 0x50, 0x60, 0x00, 0xA0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x60, 0x0C, 0x07, 0x00, 0x21, 0x80, 0x07,
+    0x00, 0x30, 0x03, 0x07, 0x00, 0x80, 0x60, 0x07, 0x00, 0x8C, 0x00, 0x07,
+    0x50, 0x80, 0x00, 0x07, 0x40, 0x80, 0x00, 0x07, 0x20, 0x80, 0x00, 0x17,
+    0x02, 0xA0, 0x00, 0x47, 0x02, 0xA0, 0x00, 0x07, 0x04, 0x00, 0x00, 0x27,
+    0x08, 0x00, 0x02, 0x47, 0x50, 0x40, 0x08, 0x07, 0x00, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x08, 0x18, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x3B, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x04, 0x02, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x28, 0x00, 0x3F, 0x00, 0x28, 0x14, 0x3F,
+    0x08, 0x00, 0x40, 0xBF, 0x04, 0x12, 0x00, 0x3F, 0x04, 0xC0, 0x30, 0x3F,
+    0x10, 0x03, 0x02, 0xBF, 0x10, 0x20, 0x05, 0x3F, 0x0E, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x3F,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0xC0, 0x3F, 0x40, 0x0C, 0x00, 0x3F, 0x81, 0x80, 0x00, 0x3F,
+    0xB0, 0x03, 0x00, 0x3F, 0x80, 0x10, 0x00, 0x3F, 0x8C, 0x40, 0x00, 0x3F,
+    0xA0, 0x40, 0x03, 0xBF, 0xA0, 0x40, 0x00, 0x7F, 0xA0, 0x00, 0x0A, 0x3F,
+    0xA0, 0x00, 0x40, 0x3F, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x02, 0x20, 0xBF,
+    0x98, 0x01, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    // 0x119 'ę'
+    0x01, 0xD8, 0x07, 0x04, 0x00, 0x07, 0x10, 0x20, 0x07, 0x24, 0x48, 0x27,
+    0x11, 0x00, 0x8F, 0x20, 0x00, 0x47, 0x02, 0x80, 0x07, 0x80, 0x08, 0x0F,
+    0xA9, 0x00, 0x17, 0x02, 0x10, 0x07, 0x44, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0xCF, 0x00, 0x40, 0x0C, 0x0F, 0x00, 0x81, 0x80, 0x0F,
+    0x00, 0xB0, 0x03, 0x0F, 0x00, 0x80, 0x10, 0x0F, 0x20, 0x8C, 0x40, 0x0F,
+    0x08, 0xA0, 0x40, 0x0F, 0x04, 0xA0, 0x40, 0x0F, 0x12, 0xA0, 0x00, 0x0F,
+    0x02, 0xA0, 0x00, 0x4F, 0x10, 0x80, 0x00, 0x8F, 0x20, 0x80, 0x02, 0x2F,
+    0x00, 0x98, 0x01, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x40, 0x60, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x11B 'ě'
+    0x00, 0x01, 0xD8, 0x00, 0x04, 0x00, 0x00, 0x10, 0x20, 0x00, 0x24, 0x48,
+    0x40, 0x11, 0x00, 0x80, 0x20, 0x00, 0x44, 0x02, 0x80, 0x10, 0x80, 0x0A,
+    0x10, 0xA9, 0x00, 0x20, 0x02, 0x10, 0x50, 0x44, 0x00, 0xA0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x9F, 0x00, 0x80, 0x18, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x01, 0x60, 0x06, 0x1F, 0x11, 0x00, 0xC0, 0x1F, 0x01, 0x08, 0x00, 0x1F,
+    0x29, 0x40, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x3F,
+    0x00, 0x00, 0x01, 0x1F,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x03, 0x03, 0x08, 0x40, 0x60, 0x03,
+    0x00, 0x46, 0x01, 0xA3, 0x01, 0x40, 0x18, 0x03, 0x21, 0x03, 0x00, 0x53,
+    0x09, 0x30, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x33,
+    0x10, 0x03, 0x03, 0x20, 0x60, 0x03, 0x2C, 0x00, 0xC3, 0x20, 0x18, 0x03,
+    0x21, 0x00, 0x03, 0x28, 0x00, 0x03, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x06, 0x00, 0x23, 0x42, 0x00, 0x87, 0x88, 0x00, 0x23,
+    0x60, 0x00, 0x03,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x30, 0x3F, 0x04, 0x06, 0x00, 0x3F,
+    0x04, 0x60, 0x1A, 0x3F, 0x14, 0x01, 0x80, 0x3F, 0x10, 0x30, 0x05, 0x3F,
+    0x13, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x11, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0xCF,
+    0x40, 0x2C, 0x0F, 0x81, 0x80, 0x0F, 0xB0, 0x03, 0x0F, 0x80, 0x20, 0x0F,
+    0x84, 0x80, 0x0F, 0xA0, 0x40, 0x0F, 0x81, 0x00, 0x0F, 0x81, 0x80, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x8F,
+    // 0x142 'ł'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x19, 0x00, 0x05, 0x81,
+    0x20, 0x20, 0x01, 0x23, 0x00, 0xD1, 0xA0, 0x0C, 0x01, 0x81, 0x80, 0x29,
+    0x98, 0x20, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x30, 0x0F, 0x01, 0x06, 0x00, 0x8F,
+    0x01, 0x20, 0x18, 0x4F, 0x01, 0x03, 0x00, 0x2F, 0x00, 0x04, 0x00, 0x0F,
+    0x00, 0x41, 0x00, 0x0F, 0x00, 0x10, 0x40, 0x0F, 0x08, 0x00, 0x10, 0x0F,
+    0x10, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x20, 0x8F, 0x28, 0x00, 0x08, 0x2F,
+    0x40, 0x00, 0x02, 0x0F, 0x00, 0x80, 0x30, 0x0F, 0x81, 0x06, 0x01, 0x8F,
+    0x01, 0x00, 0x30, 0x0F, 0x01, 0x03, 0x00, 0x0F, 0x01, 0x60, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x144 'ń'
+    0x00, 0x40, 0x02, 0x00, 0x20, 0x30, 0x00, 0x26, 0x00, 0x00, 0x80, 0x18,
+    0x00, 0x80, 0x40, 0x00, 0x61, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x50, 0x00, 0x04, 0x00, 0x1A, 0x48, 0x81, 0x80, 0x90, 0x98, 0x00,
+    0x20, 0x80, 0xCA, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x18, 0x07, 0x00, 0x83, 0x00, 0x47,
+    0x00, 0x90, 0x0C, 0x27, 0x00, 0x81, 0x80, 0x17, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x20, 0x80, 0x07, 0x40, 0x08, 0x20, 0x07, 0x40, 0x00, 0x08, 0x07,
+    0x02, 0x00, 0x40, 0x07, 0x02, 0x00, 0x10, 0x47, 0x00, 0x00, 0x04, 0x17,
+    0x00, 0x00, 0x01, 0x07, 0x08, 0x40, 0x18, 0x07, 0x50, 0x83, 0x00, 0xC7,
+    0x20, 0x80, 0x18, 0x07, 0x00, 0x81, 0x80, 0x07, 0x00, 0xB0, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x148 'ň'
+    0x00, 0x40, 0x02, 0x00, 0x20, 0x30, 0x00, 0x26, 0x00, 0x00, 0x80, 0x18,
+    0x00, 0x80, 0x40, 0x40, 0x61, 0x00, 0x80, 0x14, 0x00, 0x44, 0x28, 0x00,
+    0x10, 0x50, 0x00, 0x10, 0x00, 0x1A, 0x20, 0x81, 0x80, 0x50, 0x98, 0x00,
+    0xA0, 0x80, 0xCA, 0xC0, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x152 'Œ'
+    0x00, 0x73, 0x07, 0x01, 0x00, 0x47, 0x04, 0x00, 0x27, 0x00, 0x81, 0x07,
+    0x02, 0x00, 0x07, 0x20, 0x00, 0x47, 0x00, 0x00, 0x07, 0x50, 0x00, 0x07,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0xC7,
+    0xA0, 0x18, 0x07, 0xA3, 0x00, 0x07, 0x90, 0x02, 0x07, 0x80, 0x00, 0x07,
+    0x8C, 0x40, 0x07, 0xA0, 0x40, 0x07, 0xA0, 0x40, 0x07, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x47, 0xA0, 0x00, 0x07, 0x80, 0x02, 0x27, 0x9C, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x60, 0x00, 0x07,
+    // 0x153 'œ'
+    0x01, 0x98, 0x00, 0x00, 0x10, 0x02, 0x22, 0x08, 0x48, 0x00, 0x10, 0x04,
+    0x20, 0x00, 0xA0, 0x0A, 0xA0, 0x10, 0x80, 0x04, 0x0F, 0x04, 0x40, 0x02,
+    0x01, 0x50, 0x08, 0x40, 0x51, 0x00, 0x20, 0x80, 0x82, 0x02, 0x84, 0x00,
+    0x98, 0x04, 0x02, 0x00, 0x48, 0x00, 0x00, 0x00,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x60, 0x08, 0x07, 0x00, 0x21, 0x80, 0x07,
+    0x00, 0xB0, 0x03, 0x07, 0x50, 0x80, 0x40, 0x27, 0x40, 0x8C, 0x00, 0x07,
+    0x20, 0x80, 0x00, 0x07, 0x02, 0x80, 0x40, 0x07, 0x02, 0x80, 0x10, 0x87,
+    0x04, 0xA0, 0x80, 0x07, 0x28, 0x11, 0x01, 0x07, 0x50, 0x00, 0x40, 0x97,
+    0x00, 0x00, 0x80, 0x47, 0x00, 0x1E, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x159 'ř'
+    0x00, 0x40, 0x01, 0x00, 0x20, 0x11, 0x00, 0x23, 0x01, 0x00, 0x80, 0x0D,
+    0x20, 0x80, 0x41, 0x88, 0x69, 0x01, 0x20, 0x14, 0x01, 0x00, 0x08, 0x01,
+    0x04, 0x10, 0x01, 0x08, 0x90, 0x01, 0x10, 0x90, 0x01, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0C, 0x06, 0x2F,
+    0x00, 0x01, 0x00, 0x8F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x24, 0x40, 0x0F,
+    0x00, 0x02, 0x00, 0x0F, 0x09, 0x41, 0x20, 0x0F, 0x11, 0x00, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x2F, 0x09, 0x40, 0x40, 0x4F, 0x41, 0x38, 0x20, 0x8F,
+    0x00, 0x00, 0x1E, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x0C, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x04, 0x80, 0x00, 0x22, 0x40, 0x00, 0xA0, 0x10,
+    0x24, 0x80, 0x04, 0x48, 0x80, 0x50, 0x90, 0x60, 0x00, 0x20, 0x00, 0x00,
+    // 0x160 'Š'
+    0x00, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x03, 0x17,
+    0x00, 0x00, 0x80, 0x47, 0x00, 0x00, 0x40, 0x07, 0x20, 0x12, 0x20, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x04, 0xA0, 0x90, 0x07, 0x12, 0x80, 0x00, 0x07,
+    0x02, 0x80, 0x00, 0x17, 0x10, 0xA0, 0x20, 0x27, 0x00, 0x9C, 0x10, 0x47,
+    0x00, 0x00, 0x0F, 0x07, 0x00, 0x08, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x161 'š'
+    0x00, 0x00, 0x0C, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00,
+    0x40, 0x40, 0x00, 0x80, 0x04, 0x80, 0x44, 0x22, 0x40, 0x10, 0xA0, 0x10,
+    0x10, 0x80, 0x04, 0x20, 0x80, 0x50, 0x50, 0x60, 0x00, 0xA0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x164 'Ť'
+    0x00, 0x1C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x90, 0x00, 0x2F,
+    0x00, 0xA0, 0x00, 0x0F, 0x00, 0xA0, 0x03, 0x0F, 0x20, 0xA0, 0x30, 0x0F,
+    0x00, 0xA6, 0x00, 0x4F, 0x04, 0x80, 0x0C, 0x0F, 0x02, 0x81, 0x80, 0x2F,
+    0x02, 0x90, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x0F,
+    0x00, 0xA0, 0x00, 0x0F, 0x50, 0xA0, 0x00, 0x0F, 0x60, 0x80, 0x00, 0x0F,
+    0x00, 0x84, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x62, 0x00, 0x2C, 0x00,
+    0x00, 0x80, 0x38, 0x00, 0x06, 0x00, 0x00, 0x20, 0x08, 0x04, 0x20, 0x00,
+    0x00, 0x20, 0x14, 0x10, 0x20, 0x08, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x47, 0x00, 0xA6, 0x00, 0x07,
+    0x00, 0x80, 0x0F, 0x17, 0x00, 0x81, 0x80, 0x07, 0x00, 0x90, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x07,
+    0x42, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x17, 0x84, 0x00, 0x00, 0x87,
+    0x84, 0x00, 0x00, 0x07, 0x02, 0x40, 0x18, 0x07, 0x20, 0xA3, 0x01, 0x07,
+    0x00, 0x80, 0x18, 0x07, 0x00, 0x83, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x32, 0x7F, 0x00, 0x11, 0x00, 0x7F,
+    0x00, 0x40, 0x08, 0x7F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x0C, 0x00, 0x7F,
+    0x1E, 0x00, 0x05, 0x7F, 0x01, 0x00, 0x0A, 0x7F, 0x40, 0x00, 0x14, 0x7F,
+    0x22, 0x00, 0x08, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x40, 0x10, 0x00, 0x7F,
+    0x24, 0x00, 0xC0, 0x7F, 0x00, 0x0C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x47, 0x00, 0xA6, 0x00, 0x07,
+    0x00, 0x80, 0x0F, 0x17, 0x00, 0x81, 0x80, 0x07, 0x00, 0x90, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x0A, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x17, 0x48, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x06, 0x40, 0x18, 0x07, 0x00, 0xA3, 0x01, 0x07,
+    0x10, 0x80, 0x18, 0x07, 0x00, 0x83, 0x00, 0x07, 0x00, 0x90, 0x00, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x30, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0x00, 0x22, 0x00, 0x00, 0x80, 0x10,
+    0x00, 0x81, 0x00, 0x00, 0x18, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x00, 0x14,
+    0x08, 0x00, 0x28, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x10, 0x20, 0x00,
+    0x00, 0x01, 0x80, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F,
+    0x02, 0x10, 0x00, 0xBF, 0x02, 0x04, 0x00, 0x3F, 0x02, 0x40, 0x83, 0x3F,
+    0x22, 0x98, 0x20, 0x3F, 0x02, 0x02, 0x00, 0x3F, 0x90, 0x00, 0x18, 0x3F,
+    0x20, 0x02, 0x40, 0xBF, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x52, 0x24, 0x00, 0x3F, 0x02, 0x88, 0x00, 0x3F, 0x92, 0x00, 0x00, 0x3F,
+    0x62, 0x40, 0x00, 0x3F, 0x02, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x8F, 0x01, 0x00, 0x10, 0x0F,
+    0x01, 0x00, 0x24, 0x0F, 0x01, 0x40, 0x08, 0x0F, 0x09, 0x40, 0x10, 0x0F,
+    0x11, 0x42, 0x00, 0x0F, 0x01, 0x44, 0x00, 0x0F, 0x09, 0x49, 0x00, 0x0F,
+    0x41, 0x42, 0x00, 0x8F, 0x01, 0x04, 0x02, 0x0F, 0x81, 0x00, 0x00, 0x4F,
+    0x01, 0x00, 0x06, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x10, 0x40,
+    0x00, 0x80, 0x80, 0x00, 0x01, 0x0A, 0x00, 0x02, 0x08, 0x00, 0x54, 0x00,
+    0x04, 0x08, 0x00, 0x48, 0x20, 0x08, 0x90, 0x48, 0x10, 0x20, 0x90, 0x10,
+    0x00, 0x20, 0x00,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x8F, 0x01, 0x00, 0x10, 0x0F,
+    0x01, 0x00, 0x24, 0x0F, 0x01, 0x40, 0x08, 0x0F, 0x01, 0x40, 0x10, 0x0F,
+    0x21, 0x42, 0x00, 0x0F, 0x09, 0x44, 0x00, 0x0F, 0x09, 0x49, 0x00, 0x0F,
+    0x51, 0x42, 0x00, 0x8F, 0x01, 0x04, 0x02, 0x0F, 0x01, 0x00, 0x00, 0x4F,
+    0x01, 0x00, 0x06, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x80, 0x09, 0x00, 0x20, 0x81,
+    0x01, 0x01, 0x01, 0x00, 0x02, 0x15, 0x10, 0x04, 0x11, 0x48, 0xA8, 0x01,
+    0x08, 0x10, 0x01, 0x10, 0x40, 0x11, 0x00, 0x90, 0x21, 0x01, 0x20, 0x21,
+    0x00, 0x40, 0x01,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x04, 0x47, 0x00, 0x80, 0x08, 0x07,
+    0x00, 0x80, 0x12, 0x07, 0x00, 0xA0, 0x04, 0x07, 0x44, 0xA0, 0x08, 0x07,
+    0x02, 0xA1, 0x00, 0x07, 0x02, 0xA2, 0x00, 0x07, 0x00, 0xA4, 0x80, 0x07,
+    0x00, 0xA1, 0x00, 0x47, 0x00, 0x82, 0x01, 0x07, 0x50, 0x80, 0x00, 0x27,
+    0x60, 0x80, 0x03, 0x07, 0x00, 0x20, 0x00, 0x07,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x10, 0x40,
+    0x40, 0x80, 0x80, 0x80, 0x01, 0x0A, 0x44, 0x02, 0x08, 0x10, 0x54, 0x00,
+    0x10, 0x08, 0x00, 0x20, 0x20, 0x08, 0x50, 0x48, 0x10, 0xA0, 0x90, 0x10,
+    0xC0, 0x20, 0x00, 0x00, 0x00, 0x00,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x22, 0x01, 0x08, 0x0C, 0x20,
+    0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x88,
+    0x10, 0x00, 0x00, 0x08, 0x80, 0x04, 0xA0, 0x00, 0x00, 0x00,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x03, 0x07, 0x00, 0x60, 0x07, 0x02, 0x00, 0xC7, 0x00, 0x18, 0x07,
+    0x01, 0x00, 0x27, 0x08, 0x00, 0x17, 0x10, 0x01, 0x87, 0x20, 0x00, 0x07,
+    0x80, 0x40, 0x07, 0x80, 0x00, 0x07, 0x82, 0x10, 0x07, 0xA4, 0x00, 0x07,
+    0x18, 0x00, 0x17, 0x00, 0x20, 0x07, 0x08, 0x10, 0x07, 0x10, 0x07, 0x07,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F,
+    // 0x2018 '‘'
+    0x00, 0x7F, 0x08, 0xFF, 0x20, 0xFF, 0x46, 0x7F, 0xA0, 0x7F, 0x80, 0x7F,
+    // 0x2019 '’'
+    0x00, 0x3F, 0x00, 0xBF, 0x02, 0x3F, 0x40, 0x3F, 0x02, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F,
+    // 0x201A '‚'
+    0x00, 0xFF, 0x02, 0xFF, 0x01, 0x7F, 0x02, 0x7F, 0x08, 0x7F, 0x00, 0x7F,
+    // 0x201B '‛'
+    0x30, 0x7F, 0x82, 0x7F, 0x81, 0x7F, 0x22, 0xFF, 0x00, 0x7F,
+    // 0x201C '“'
+    0x00, 0x7F, 0x08, 0xFF, 0x20, 0xFF, 0x46, 0x7F, 0xA0, 0x7F, 0x80, 0x7F,
+    0x07, 0x7F, 0x10, 0xFF, 0x00, 0xFF, 0x09, 0x7F, 0x80, 0x7F, 0x00, 0x7F,
+    // 0x201D '”'
+    0x00, 0x7F, 0x01, 0xFF, 0x04, 0x7F, 0x01, 0x7F, 0x80, 0x7F, 0x88, 0x7F,
+    0x00, 0x7F, 0x00, 0xFF, 0x48, 0x7F, 0x80, 0x7F, 0x84, 0x7F, 0x70, 0x7F,
+    // 0x201E '„'
+    0x00, 0xFF, 0x02, 0xFF, 0x01, 0x7F, 0x02, 0x7F, 0x08, 0x7F, 0x00, 0x7F,
+    0x01, 0x7F, 0x44, 0xFF, 0x01, 0x7F, 0x04, 0x7F, 0x50, 0x7F,
+    // 0x201F '‟'
+    0x30, 0x7F, 0x82, 0x7F, 0x81, 0x7F, 0x22, 0xFF, 0x00, 0x7F, 0x00, 0x7F,
+    0x48, 0x7F, 0x80, 0x7F, 0x98, 0x7F, 0x40, 0xFF, 0x00, 0x7F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x05, 0x00, 0x1F, 0x05, 0x03, 0x1F,
+    0x00, 0x30, 0x1F, 0x0C, 0x01, 0x9F, 0x80, 0x60, 0x1F, 0x8C, 0x00, 0x1F,
+    0xC1, 0x00, 0x1F, 0x05, 0x00, 0x1F, 0x04, 0x00, 0x1F, 0x06, 0x00, 0x1F,
+    // 0x2021 '‡'
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x05, 0x02, 0x13,
+    0x05, 0x02, 0x83, 0x00, 0x40, 0x03, 0x0C, 0x00, 0x03, 0x80, 0x12, 0x03,
+    0x8C, 0x00, 0x03, 0xC1, 0x00, 0x03, 0x05, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x06, 0x00, 0x03,
+    // 0x2022 '•'
+    0x33, 0x03, 0x87, 0x07, 0x83, 0x53,
+    // 0x2026 '…'
+    0x07, 0x07, 0x07, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x47, 0x07,
+    0x87, 0x67, 0x07, 0x07, 0x07, 0x07, 0x07, 0x37, 0x07, 0x87, 0x17, 0x07,
+    // 0x2039 '‹'
+    0x00, 0x1F, 0x04, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x21, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x00, 0x1F, 0x00, 0x5F, 0x00, 0xBF, 0x01, 0x5F, 0x4A, 0x1F, 0x20, 0x1F,
+    0x10, 0x1F, 0x04, 0x1F,
+    // 0x2070 '⁰'
+    0x01, 0xF3, 0x08, 0x03, 0x11, 0xE7, 0x00, 0x03, 0x50, 0x03, 0x00, 0x17,
+    0x00, 0x23, 0x10, 0x83, 0x40, 0x03, 0x20, 0x83, 0x00, 0x03,
+    // 0x2074 '⁴'
+    0x00, 0x03, 0x00, 0xA3, 0x01, 0x23, 0x02, 0xA3, 0x05, 0x23, 0x0A, 0x23,
+    0x14, 0x2B, 0x29, 0x87, 0x40, 0x1B, 0x03, 0x23, 0x60, 0x23, 0x00, 0x03,
+    // 0x2075 '⁵'
+    0x00, 0x17, 0x00, 0x0F, 0x00, 0x07, 0x24, 0x0F, 0x80, 0x2F, 0xA8, 0x07,
+    0x81, 0x97, 0x84, 0x27, 0x82, 0x87, 0x80, 0x07, 0x00, 0x07,
+    // 0x2076 '⁶'
+    0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x01, 0x17, 0x04, 0x03, 0x00, 0x07,
+    0x11, 0x17, 0x40, 0xC3, 0x20, 0x03, 0x20, 0xC3, 0x40, 0x03, 0x00, 0x03,
+    // 0x2077 '⁷'
+    0x60, 0x17, 0x90, 0x47, 0x81, 0x17, 0x82, 0x47, 0x81, 0x07, 0x92, 0x07,
+    0x88, 0x07, 0x90, 0x07, 0xA0, 0x07, 0x00, 0x07,
+    // 0x2078 '⁸'
+    0x00, 0x23, 0x00, 0x83, 0x14, 0x27, 0x20, 0x87, 0x54, 0x0B, 0x20, 0x07,
+    0x20, 0x13, 0x01, 0x0B, 0x40, 0x93, 0x20, 0x03, 0x00, 0x03,
+    // 0x2079 '⁹'
+    0x00, 0x03, 0x00, 0x0F, 0x0E, 0x0B, 0x00, 0x07, 0x0E, 0x97, 0x41, 0x03,
+    0x21, 0x2B, 0x21, 0x43, 0x11, 0x03, 0x00, 0x43, 0x11, 0x03, 0x00, 0x03,
+    // 0x2080 '₀'
+    0x03, 0xE7, 0x10, 0x07, 0x23, 0xCF, 0x48, 0x07, 0xA0, 0x07, 0x80, 0x0F,
+    0x00, 0x47, 0x21, 0x07, 0x80, 0x07, 0x41, 0x07, 0x00, 0x07,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x07, 0x30, 0x07, 0x10, 0xC7, 0x08, 0x07, 0x40, 0xC7,
+    0x0C, 0x0F, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x10, 0xAF, 0xA1, 0x4F, 0x00, 0x8F,
+    0x00, 0x0F, 0x28, 0x0F, 0x80, 0x07, 0x48, 0x07, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x00, 0x1F, 0x00, 0x17, 0x20, 0x07, 0x01, 0x07, 0x84, 0x0F, 0x00, 0x27,
+    0x08, 0x87, 0x86, 0x07, 0x09, 0xC7, 0x00, 0x07,
+    // 0x2084 '₄'
+    0x00, 0x07, 0x01, 0x47, 0x02, 0x47, 0x05, 0x47, 0x0A, 0x47, 0x14, 0x47,
+    0x28, 0x5F, 0x53, 0x0F, 0x90, 0x37, 0x06, 0x47, 0xE0, 0x47, 0x00, 0x07,
+    // 0x2085 '₅'
+    0x00, 0x17, 0x00, 0x17, 0x00, 0x07, 0x20, 0x07, 0x80, 0x0F, 0xA8, 0x07,
+    0x81, 0x97, 0x84, 0x27, 0x82, 0xC7, 0x80, 0x07, 0x00, 0x07,
+    // 0x2086 '₆'
+    0x00, 0x07, 0x02, 0x07, 0x00, 0x07, 0x02, 0x2F, 0x08, 0x07, 0x50, 0x07,
+    0x22, 0x2F, 0x81, 0x87, 0x00, 0x07, 0x41, 0x87, 0xC0, 0x07, 0x00, 0x07,
+    // 0x2087 '₇'
+    0x60, 0x17, 0x90, 0x47, 0x81, 0x17, 0x82, 0x47, 0x81, 0x07, 0x92, 0x07,
+    0x80, 0x07, 0x90, 0x07, 0xA0, 0x07, 0x00, 0x07,
+    // 0x2088 '₈'
+    0x00, 0x67, 0x00, 0x07, 0x28, 0x4F, 0x41, 0x07, 0x28, 0x17, 0xC0, 0x0F,
+    0x40, 0x27, 0x02, 0x07, 0x81, 0x27, 0x40, 0x07, 0x00, 0x07,
+    // 0x2089 '₉'
+    0x00, 0x07, 0x00, 0x1F, 0x1C, 0x17, 0x00, 0x0F, 0x1C, 0x0F, 0x82, 0x07,
+    0x02, 0x57, 0x02, 0x87, 0xA2, 0x07, 0x00, 0x87, 0x22, 0x07, 0x00, 0x07,
+    // 0x20A9 '₩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x00, 0xD0, 0x07, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x08, 0x22, 0x07, 0x12, 0x10, 0x97,
+    0x04, 0x00, 0x07, 0x08, 0x00, 0x47, 0x50, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x57, 0x00, 0x00, 0x07,
+    0x1C, 0x00, 0x27, 0x04, 0x00, 0x07, 0x50, 0x00, 0x07,
+    // 0x20B4 '₴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x60, 0x3F, 0xA0, 0x7F, 0x83, 0x7F, 0xA0, 0x7F, 0x98, 0x7F, 0x80, 0x3F,
+    0x80, 0x3F, 0x80, 0x7F, 0x00, 0xFF, 0x04, 0x7F, 0xA4, 0x7F, 0x90, 0x3F,
+    0x40, 0x3F, 0x01, 0x3F, 0x08, 0x3F, 0x28, 0x7F, 0x1E, 0x7F, 0x9F, 0xFF,
+    0xC0, 0x3F, 0x00, 0x3F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x20, 0x60, 0x01,
+    0x2C, 0x00, 0x01, 0x00, 0x68, 0x0D, 0x0C, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x91, 0x00, 0x01, 0x01, 0x00, 0x00, 0x81, 0x00, 0x09, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x08, 0x01, 0x00, 0x80, 0x01, 0x00, 0x40, 0x01,
+    0x04, 0x80, 0x01, 0x00, 0x00, 0x01, 0x24, 0x00, 0x11, 0x48, 0x53, 0x11,
+    0x00, 0x01, 0x11, 0x00, 0x81, 0x01, 0x00, 0x80, 0x41, 0x00, 0xB8, 0x11,
+    0x00, 0x05, 0x21, 0x00, 0x30, 0x01,
+    // 0x2154 '⅔'
+    0x00, 0x08, 0x01, 0x00, 0x10, 0x01, 0x14, 0x00, 0x01, 0x20, 0x08, 0x01,
+    0x00, 0x08, 0x01, 0x10, 0x88, 0x01, 0x11, 0x48, 0x01, 0x00, 0x88, 0x11,
+    0x01, 0x0C, 0x25, 0x02, 0x00, 0x01, 0x00, 0x01, 0x21, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x12, 0x01, 0x00, 0x20, 0x01, 0x00, 0x10, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x09, 0x00, 0x01, 0x10, 0x00, 0x11,
+    0x00, 0x53, 0x11, 0x10, 0x01, 0x11, 0x00, 0x81, 0x01, 0x00, 0x80, 0x41,
+    0x00, 0xB8, 0x11, 0x00, 0x05, 0x21, 0x00, 0x30, 0x01,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x20, 0x60, 0x01,
+    0x2C, 0x00, 0x01, 0x00, 0x68, 0x0D, 0x0C, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x91, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01, 0x00, 0x09, 0x01,
+    0x00, 0x10, 0x01, 0x00, 0x08, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x80, 0x01, 0x08, 0x00, 0x51, 0x00, 0x00, 0x09, 0x48, 0x24, 0x81,
+    0x00, 0x41, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x80, 0x69,
+    0x00, 0xB0, 0x01, 0x00, 0x00, 0xE1, 0x00, 0x30, 0x01,
+    // 0x215C '⅜'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x18, 0x02, 0x01, 0x29, 0x02, 0x01,
+    0x00, 0x08, 0x01, 0x10, 0x00, 0x01, 0x10, 0x60, 0x05, 0x09, 0x08, 0x01,
+    0x20, 0x60, 0x49, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x04, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x40, 0x01, 0x00, 0x20, 0x01,
+    0x02, 0x40, 0x01, 0x00, 0x00, 0x01, 0x12, 0x00, 0x51, 0x24, 0x00, 0x09,
+    0x00, 0x24, 0x81, 0x60, 0x41, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11,
+    0x00, 0x80, 0x69, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xE1, 0x00, 0x30, 0x01,
+    // 0x215D '⅝'
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x18, 0x08, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x14, 0x01, 0x02, 0xE0, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0xA0, 0x49, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x04, 0x81,
+    0x00, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x40, 0x01, 0x00, 0x20, 0x01,
+    0x02, 0x40, 0x01, 0x00, 0x00, 0x01, 0x12, 0x00, 0x51, 0x24, 0x00, 0x09,
+    0x00, 0x24, 0x81, 0x60, 0x41, 0x01, 0x00, 0x20, 0x01, 0x00, 0x80, 0x11,
+    0x00, 0x80, 0x69, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xE1, 0x00, 0x30, 0x01,
+    // 0x215E '⅞'
+    0x14, 0x04, 0x01, 0x00, 0x02, 0x01, 0x00, 0x44, 0x01, 0x10, 0x00, 0x0D,
+    0x12, 0x40, 0x01, 0x14, 0x00, 0x49, 0x02, 0x00, 0x91, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x81, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x20, 0x01, 0x02, 0x40, 0x01, 0x04, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x24, 0x00, 0x51, 0x00, 0x00, 0x09, 0x60, 0x24, 0x81, 0x00, 0x41, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x80, 0x11, 0x00, 0x80, 0x69, 0x00, 0xB0, 0x01,
+    0x00, 0x00, 0xE1, 0x00, 0x30, 0x01,
+    // 0x2190 '←'
+    0x04, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x2C, 0x0F, 0x54, 0x0F, 0x64, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x28, 0x00, 0x1F,
+    0x50, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x50, 0x00, 0x1F,
+    0x20, 0x00, 0x1F, 0x10, 0x00, 0x1F, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2192 '→'
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F,
+    0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x64, 0x0F, 0x54, 0x0F,
+    0x2C, 0x0F, 0x10, 0x0F, 0x08, 0x0F, 0x04, 0x0F,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x2194 '↔'
+    0x00, 0x0F, 0x01, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x0C, 0xAF, 0x14, 0x5F,
+    0x24, 0x2F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x24, 0x2F,
+    0x14, 0x1F, 0x0C, 0xAF, 0x00, 0x4F, 0x00, 0x8F, 0x05, 0x0F, 0x00, 0x0F,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x1F, 0x00, 0x02, 0x1F, 0x14, 0x01, 0x1F, 0x28, 0x00, 0x1F,
+    0x50, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x50, 0x00, 0x1F,
+    0x28, 0x00, 0x1F, 0x14, 0x01, 0x1F, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D0 '⇐'
+    0x04, 0x07, 0x08, 0x07, 0x14, 0x07, 0x21, 0x07, 0x41, 0x07, 0x31, 0x07,
+    0x51, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    // 0x21D1 '⇑'
+    0x04, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x14, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x24, 0x00, 0x7F, 0x14, 0x00, 0x7F, 0x0A, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    // 0x21D2 '⇒'
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07,
+    0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x51, 0x07, 0x31, 0x07, 0x41, 0x07,
+    0x21, 0x07, 0x14, 0x07, 0x08, 0x07, 0x04, 0x07,
+    // 0x21D3 '⇓'
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x7F,
+    // 0x21D4 '⇔'
+    0x00, 0x07, 0x01, 0x07, 0x02, 0x87, 0x04, 0x47, 0x01, 0x27, 0x11, 0x57,
+    0x11, 0x37, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x37,
+    0x11, 0x57, 0x01, 0x27, 0x04, 0x47, 0x02, 0x87, 0x01, 0x07, 0x00, 0x07,
+    // 0x2202 '∂'
+    0x00, 0x03, 0x31, 0x00, 0x00, 0x01, 0x00, 0x20, 0x05, 0x10, 0x48, 0x11,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x09, 0x80, 0x40, 0x01, 0x80, 0x40, 0x15,
+    0xA0, 0x40, 0x21, 0x10, 0x00, 0x81, 0x46, 0x3C, 0x21, 0x20, 0x00, 0x01,
+    0x08, 0x06, 0x01, 0x00, 0x00, 0x01,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x4F, 0x00, 0x01, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x21, 0x0F, 0x01, 0x04, 0x0F, 0x04, 0x20, 0x0F, 0x20, 0x80, 0x0F,
+    0x04, 0x00, 0x0F, 0x88, 0x00, 0x0F, 0x81, 0x00, 0x0F, 0x20, 0x60, 0x0F,
+    0x04, 0x0C, 0x0F, 0x01, 0x81, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x00, 0x00, 0x01, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x02, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x9F, 0xFF, 0xFC, 0x7F,
+    0x80, 0x00, 0x02, 0x7F, 0xA0, 0x00, 0x02, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x01, 0x7F, 0xA0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0x02, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x84, 0x00, 0x20, 0x7F, 0x82, 0x00, 0x44, 0x7F, 0xB0, 0x00, 0x10, 0x7F,
+    0xA8, 0x42, 0x20, 0x7F, 0xA0, 0x24, 0x00, 0x7F, 0xA1, 0x01, 0x00, 0x7F,
+    0xA0, 0x02, 0x00, 0x7F, 0xA0, 0x20, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x04, 0x7F, 0x84, 0x00, 0x08, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3C, 0x7F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x10, 0x08, 0x1F,
+    0x00, 0x01, 0x01, 0x1F, 0x00, 0x00, 0x30, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x20, 0xDF, 0x00, 0x03, 0x04, 0x1F, 0x00, 0x10, 0x20, 0x1F,
+    0x01, 0x81, 0x00, 0x1F, 0x08, 0x08, 0x00, 0x1F, 0x40, 0xC0, 0x00, 0x1F,
+    0x84, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x221E '∞'
+    0x0C, 0x3F, 0x20, 0xBF, 0x4E, 0x3F, 0x01, 0x7F, 0xA0, 0x7F, 0x21, 0x7F,
+    0x00, 0x3F, 0x08, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x00, 0xBF, 0x00, 0x3F,
+    0x20, 0x7F, 0xA0, 0x7F, 0x00, 0x3F, 0x40, 0xBF, 0x21, 0x3F, 0x00, 0x3F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x0F, 0xFF, 0xFF, 0x17, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    0x90, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x07,
+    // 0x2260 '≠'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x17, 0x00, 0x07,
+    0x04, 0x07, 0x02, 0x07, 0x20, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x07,
+    0x18, 0xC7,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x08, 0x80, 0x7F,
+    0x02, 0x00, 0x7F, 0x15, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x28, 0xA0, 0x7F,
+    0x00, 0x00, 0x7F, 0x50, 0x50, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x28, 0x7F,
+    0x00, 0x01, 0xFF,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x7F, 0x60, 0x10, 0x7F, 0x00, 0x28, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x50, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0xA0, 0x7F, 0x10, 0x00, 0x7F,
+    0x01, 0x40, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x7F,
+    0x03, 0x01, 0xFF,
+    // 0x2500 '─'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x251C '├'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x40, 0x00, 0x17,
+    0x40, 0x00, 0x17, 0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly28ItalicColOffsets[] PROGMEM = {
+    0x0, 0x1C, 0x34, 0x48, 0x7B, 0xBF, 0x10A, 0x14F, 0x159, 0x189, 0x1B9, 0x1CD,
+    0x1E7, 0x1F5, 0x1FE, 0x203, 0x233, 0x266, 0x287, 0x2B7, 0x2E7, 0x31A, 0x347, 0x37A,
+    0x3A7, 0x3D7, 0x407, 0x415, 0x433, 0x44D, 0x45A, 0x474, 0x492, 0x4FA, 0x539, 0x56C,
+    0x59F, 0x5DE, 0x614, 0x647, 0x67D, 0x6C8, 0x6EF, 0x733, 0x775, 0x7A5, 0x7F6, 0x83E,
+    0x877, 0x8AD, 0x909, 0x942, 0x96F, 0x9A2, 0x9E1, 0xA1D, 0xA74, 0xAB9, 0xAF2, 0xB25,
+    0xB51, 0xB75, 0xBA1, 0xBBD, 0xBCB, 0xBD1, 0xBEF, 0xC1C, 0xC32, 0xC5F, 0xC77, 0xCC7,
+    0xD00, 0xD30, 0xD48, 0xD80, 0xDAA, 0xDC2, 0xDF0, 0xE10, 0xE2C, 0xE5F, 0xE8C, 0xEA4,
+    0xEBA, 0xEDE, 0xEFE, 0xF1A, 0xF44, 0xF66, 0xF9C, 0xFB6, 0xFE2, 0x1002, 0x102E, 0x103C,
+    0x1054, 0x108C, 0x10C2, 0x10E6, 0x111F, 0x1146, 0x1188, 0x119E, 0x11BA, 0x11DA, 0x11EE, 0x1215,
+    0x122B, 0x123F, 0x1275, 0x12AB, 0x12B0, 0x12C0, 0x12D6, 0x12F2, 0x1343, 0x1394, 0x13E8, 0x1406,
+    0x145A, 0x14AE, 0x1502, 0x1556, 0x15AA, 0x15FE, 0x164F, 0x1693, 0x16DB, 0x1723, 0x176B, 0x17B3,
+    0x17E7, 0x181F, 0x1857, 0x188F, 0x18CE, 0x192E, 0x197A, 0x19C6, 0x1A12, 0x1A5E, 0x1AAA, 0x1AC2,
+    0x1B04, 0x1B58, 0x1BAC, 0x1C00, 0x1C54, 0x1C87, 0x1CDF, 0x1D0C, 0x1D39, 0x1D66, 0x1D93, 0x1DC0,
+    0x1DFC, 0x1E24, 0x1E45, 0x1E69, 0x1E8D, 0x1EB4, 0x1EDB, 0x1EF3, 0x1F11, 0x1F2F, 0x1F50, 0x1F7D,
+    0x1FAD, 0x1FD7, 0x2001, 0x202B, 0x2055, 0x207F, 0x2099, 0x20BD, 0x20ED, 0x211D, 0x214D, 0x217D,
+    0x21C5, 0x220D, 0x2261, 0x228E, 0x22D2, 0x22F6, 0x233E, 0x2368, 0x23BC, 0x240C, 0x2454, 0x2478,
+    0x24C4, 0x24EE, 0x252E, 0x2556, 0x2589, 0x25BD, 0x25ED, 0x260E, 0x266E, 0x269E, 0x26FE, 0x272E,
+    0x277C, 0x27A8, 0x27F4, 0x281B, 0x2857, 0x287B, 0x28BB, 0x28E5, 0x2929, 0x2950, 0x29A4, 0x29E4,
+    0x2A38, 0x2A68, 0x2AB4, 0x2AF8, 0x2B1F, 0x2B63, 0x2B8A, 0x2BCE, 0x2BF8, 0x2C1A, 0x2C56, 0x2C64,
+    0x2C80, 0x2C8C, 0x2C9A, 0x2CA6, 0x2CB0, 0x2CC8, 0x2CE0, 0x2CF6, 0x2D0C, 0x2D30, 0x2D57, 0x2D5D,
+    0x2D75, 0x2D87, 0x2D97, 0x2DAD, 0x2DC5, 0x2DDB, 0x2DF3, 0x2E07, 0x2E1D, 0x2E35, 0x2E4B, 0x2E5B,
+    0x2E71, 0x2E85, 0x2E9D, 0x2EB3, 0x2ECB, 0x2EDF, 0x2EF5, 0x2F0D, 0x2F31, 0x2F55, 0x2F8E, 0x2FB2,
+    0x2FD6, 0x2FFA, 0x3022, 0x3070, 0x30C1, 0x3112, 0x3166, 0x31BA, 0x3208, 0x3228, 0x324C, 0x326C,
+    0x3290, 0x32B4, 0x32D8, 0x32F8, 0x331C, 0x333C, 0x3360, 0x3384, 0x33AE, 0x33E4, 0x3438, 0x347C,
+    0x34C4, 0x34E8, 0x3524, 0x353E, 0x3565, 0x358C, 0x35B0, 0x35D4, 0x35F8, 0x361C, 0x3640, 0x3664,
+    0x3688, 0x36AC, 0x36D0, 0x36F4, 0x3718, 0x373C, 0x3760, 0x3784, 0x37A8, 0x37CC, 0x37F0, 0x3814,
+    0x3838, 0x385C, 0x3880
+};
+
+
 const SimpleGFXfont Bookerly28Italic PROGMEM = {Bookerly28ItalicBitmaps, Bookerly28ItalicBitmaps_lsb, Bookerly28ItalicBitmaps_msb, Bookerly28ItalicGlyphs,
-    315, 30};
+    315, 30,
+    nullptr, 0, FontStyle::REGULAR, Bookerly28ItalicGlyphIndexLatin1, Bookerly28ItalicGlyphRanges, 13,
+    Bookerly28ItalicBitmapsCol, Bookerly28ItalicBitmapsCol_lsb, Bookerly28ItalicBitmapsCol_msb, Bookerly28ItalicColOffsets};
@@ -5862,5 +5862,5352 @@ const SimpleGFXglyph Bookerly30Glyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly30GlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly30GlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly30BitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xC0, 0x1F, 0xFB, 0x80, 0x00, 0x71, 0x00, 0x00, 0x70, 0x01, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFB,
+    // 0x22 '"'
+    0xC7, 0xFF, 0x80, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3F, 0x80, 0x7F, 0xBF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xF9, 0xF3, 0xFF, 0xF9, 0xF3, 0x3F,
+    0xF9, 0xE0, 0x3F, 0xF9, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x73, 0xFF,
+    0x01, 0xF3, 0xFF, 0xF9, 0xF3, 0xBF, 0xF9, 0xF0, 0x3F, 0xF9, 0x00, 0x3F,
+    0xF0, 0x03, 0xFF, 0x80, 0x73, 0xFF, 0x01, 0xF3, 0xFF, 0x79, 0xF3, 0xFF,
+    0xF9, 0xF7, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x07, 0x81, 0xFF,
+    0xFC, 0x03, 0xF0, 0xFF, 0xF8, 0x43, 0xF8, 0xFF, 0xF9, 0xF1, 0xFC, 0xFF,
+    0xF1, 0xF1, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3C, 0xFF,
+    0xF1, 0xF8, 0xFC, 0xFF, 0xF1, 0xFC, 0x78, 0xFF, 0xF8, 0x7C, 0x01, 0xFF,
+    0xF8, 0x3E, 0x03, 0xFF, 0xFC, 0x3F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xC1, 0x83, 0xFF,
+    0x8F, 0xE3, 0xFF, 0x9F, 0xF3, 0xFF, 0x9F, 0xF3, 0xFD, 0x8F, 0xE3, 0xF1,
+    0xC0, 0x07, 0xC1, 0xC0, 0x0F, 0x87, 0xF0, 0x1E, 0x1F, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xF8, 0x78, 0x0F, 0xE1, 0xE0, 0x07, 0x87, 0xC0, 0x03, 0x0F, 0xCF, 0xF3,
+    0xBF, 0xCF, 0xF1, 0xFF, 0xCF, 0xF3, 0xFF, 0xCF, 0xF3, 0xFF, 0xC3, 0xC3,
+    0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x07,
+    0xE0, 0x07, 0xE3, 0xC0, 0x0F, 0xE3, 0x80, 0x07, 0xF3, 0x9F, 0x83, 0xF3,
+    0x1F, 0xE0, 0xF1, 0x3F, 0xF0, 0x73, 0x1E, 0x7C, 0x73, 0x0C, 0x7E, 0x33,
+    0x80, 0xFF, 0x03, 0xC1, 0xCF, 0x03, 0xFF, 0xCF, 0x87, 0xFF, 0xC0, 0x07,
+    0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0xE3, 0xFF, 0xCF, 0xE3, 0xFF, 0xCF, 0xF3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0xC7, 0xFF, 0x80, 0x3F, 0x80, 0x7F, 0xFF, 0xFF,
+    // 0x28 '('
+    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xF8, 0x0F, 0x80, 0x7F, 0xE0, 0xFF, 0xF8, 0x3F, 0xC3, 0xFF, 0xFE, 0x0F,
+    0x8F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0xC7, 0xBF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE7, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x87, 0xFF, 0xFF, 0x8F, 0xC3, 0xFF, 0xFE, 0x1F, 0xE0, 0x7F, 0xF8, 0x3F,
+    0xF0, 0x07, 0x80, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xCC, 0xFF, 0x8C, 0x7F, 0xC0, 0xFF, 0xE1, 0xFF, 0x80, 0x3F,
+    0x00, 0x3F, 0x93, 0x3F, 0xF3, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+    // 0x2B '+'
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0x00, 0x07,
+    0x00, 0x07, 0x80, 0x07, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x01, 0xFF, 0x03, 0xFF,
+    0xDF, 0xFF,
+    // 0x2D '-'
+    0x3F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF,
+    // 0x2E '.'
+    0xFF, 0x8F, 0x0F, 0x0F, 0x8F, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x03,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0x01, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
+    0x83, 0xFF, 0x07, 0x8F, 0xFF, 0xC7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE3,
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x8F, 0xFF, 0x87,
+    0x83, 0xFE, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF7, 0xC7, 0xFF, 0xE7, 0xC7, 0xFF, 0xE7,
+    0xC7, 0xFF, 0xE7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    // 0x32 '2'
+    0xF3, 0xFF, 0xCF, 0xC1, 0xFF, 0x87, 0xC1, 0xFF, 0x07, 0x87, 0xFE, 0x07,
+    0x9F, 0xFC, 0x07, 0x1F, 0xF8, 0x47, 0x1F, 0xF0, 0xC7, 0x1F, 0xE1, 0xC7,
+    0x1F, 0xC3, 0xC7, 0x0F, 0x07, 0xC7, 0x80, 0x0F, 0xC7, 0x80, 0x1F, 0xC7,
+    0xC0, 0x7F, 0xC7, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xE7, 0xC7, 0xFF, 0xE7, 0x8F, 0xDF, 0xE3,
+    0x9F, 0xCF, 0xE3, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xC7, 0x1F, 0x0F, 0xC7,
+    0x1F, 0x0F, 0x87, 0x0C, 0x07, 0x0F, 0x80, 0x40, 0x0F, 0x80, 0xC0, 0x1F,
+    0xE1, 0xE0, 0x3F, 0xFF, 0xF9, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFE, 0x0C, 0xFF, 0xFC, 0x3C, 0xFF, 0xF8, 0x7C, 0xFF, 0xE0, 0xFC, 0xFF,
+    0xC3, 0xFC, 0xFF, 0x87, 0xF8, 0xFF, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE7, 0xFE, 0x3F, 0xE7, 0x80, 0x3F, 0xE3,
+    0x00, 0x3F, 0xE7, 0x02, 0x3F, 0xE7, 0x1E, 0x1F, 0xC7, 0x1E, 0x1F, 0xC7,
+    0x1F, 0x1F, 0x87, 0x1F, 0x0F, 0x0F, 0x1F, 0x80, 0x1F, 0x1F, 0x80, 0x1F,
+    0x1F, 0xC0, 0x7F, 0x9F, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07,
+    0xE0, 0x1F, 0x87, 0xC3, 0x1F, 0xC7, 0xC7, 0x3F, 0xE7, 0x8F, 0x1F, 0xE3,
+    0x8F, 0x1F, 0xE7, 0x1F, 0x1F, 0xE7, 0x1F, 0x87, 0x87, 0x1F, 0x80, 0x0F,
+    0x3F, 0xC0, 0x0F, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0x07,
+    0x1F, 0xFC, 0x07, 0x1F, 0xF0, 0x07, 0x1F, 0xC0, 0x3F, 0x1F, 0x03, 0xFF,
+    0x1C, 0x0F, 0xFF, 0x18, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFC, 0x3F, 0xF1, 0xF8, 0x1F, 0xC0, 0x70, 0x0F, 0x80, 0x20, 0x07,
+    0x8C, 0x07, 0xC7, 0x1E, 0x0F, 0xE7, 0x1F, 0x0F, 0xE3, 0x1F, 0x8F, 0xE3,
+    0x1F, 0x0F, 0xE7, 0x1F, 0x07, 0xE7, 0x8C, 0x03, 0xC7, 0x80, 0x60, 0x0F,
+    0xC0, 0xF0, 0x0F, 0xE1, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF7, 0xE0, 0x1F, 0xE7, 0xC0, 0x0F, 0xE3,
+    0x87, 0x07, 0xE3, 0x1F, 0xC7, 0xE7, 0x1F, 0xE7, 0xC7, 0x1F, 0xE3, 0x87,
+    0x1F, 0xE3, 0x8F, 0x1F, 0xE3, 0x0F, 0x8F, 0xE4, 0x1F, 0x83, 0xE0, 0x3F,
+    0xC0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0x8F, 0xF1, 0x0F, 0xE1, 0x0F, 0xE1, 0x0F, 0xF1, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x9F, 0xFF, 0x8F, 0x0F, 0xF0, 0x0F,
+    0x0F, 0xE0, 0x3F, 0x0F, 0xE0, 0x7F, 0x9F, 0xFB, 0xFF,
+    // 0x3C '<'
+    0xFC, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F, 0xF0, 0x7F, 0xF2, 0x3F, 0xE3, 0x3F,
+    0xE7, 0x1F, 0xC7, 0x9F, 0xCF, 0x8F, 0x8F, 0xCF, 0x9F, 0xC7, 0x1F, 0xE7,
+    0xFF, 0xEF,
+    // 0x3D '='
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x3D,
+    // 0x3E '>'
+    0x9F, 0xEF, 0x1F, 0xE7, 0x8F, 0xC7, 0x8F, 0xCF, 0xC7, 0x8F, 0xC7, 0x9F,
+    0xE3, 0x1F, 0xE3, 0x3F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7F, 0xFC, 0xFF,
+    0xFC, 0xFF,
+    // 0x3F '?'
+    0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x0F, 0xC0, 0xE3, 0x0F, 0xC0, 0xE1,
+    0x0F, 0xC3, 0xE3, 0x8F, 0x87, 0xE3, 0x8F, 0x87, 0xFF, 0xC7, 0x8F, 0xFF,
+    0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+    0xF8, 0x0F, 0x81, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 0xE1, 0xFF, 0xF8, 0x7F,
+    0xE3, 0xFF, 0xFC, 0x7F, 0xC7, 0xFF, 0xFE, 0x3F, 0xCF, 0xFE, 0x3E, 0x3F,
+    0x8F, 0x1C, 0x1F, 0x3F, 0x9F, 0x18, 0x0F, 0x3F, 0x9E, 0x79, 0x8F, 0x1F,
+    0x9E, 0x7B, 0xCF, 0x1F, 0x9E, 0x73, 0xCF, 0x1F, 0x1E, 0x73, 0x9F, 0x1F,
+    0x9E, 0x00, 0x3F, 0x3F, 0x9E, 0x00, 0x1F, 0x3F, 0x9F, 0x80, 0x0F, 0x3F,
+    0x9F, 0xFF, 0x8F, 0x3F, 0x8F, 0xFF, 0x8E, 0x3F, 0xC7, 0xFF, 0x8E, 0x7F,
+    0xC7, 0xFF, 0x9E, 0x7F, 0xE1, 0xFF, 0x1F, 0xFF, 0xF0, 0x10, 0x3F, 0xFF,
+    0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x13, 0xFF, 0xC0, 0x73, 0xFE, 0x00, 0xF3,
+    0xF8, 0x18, 0xFF, 0xC0, 0x78, 0xFF, 0x83, 0xF8, 0xFF, 0x83, 0xF8, 0xFF,
+    0x80, 0x78, 0xFF, 0xE0, 0x08, 0xFB, 0xF8, 0x00, 0xF3, 0xFF, 0x00, 0x33,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x42 'B'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x9F, 0xCF, 0xF3, 0x9F, 0xCF, 0xF3,
+    0x9F, 0xCF, 0xF3, 0x9F, 0xCF, 0xF3, 0x8F, 0xC7, 0xF3, 0x87, 0x87, 0xE3,
+    0xC0, 0x07, 0xC3, 0xC0, 0x00, 0x07, 0xE0, 0x60, 0x07, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFC, 0x7F,
+    // 0x43 'C'
+    0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
+    0xE1, 0xFF, 0x07, 0xC3, 0xFF, 0x83, 0xC7, 0xFF, 0xC3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x9F, 0xFF, 0xE3, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xF3,
+    0x8F, 0xFF, 0xE3, 0x83, 0xFF, 0xE3, 0x80, 0xFF, 0xE3, 0x81, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7,
+    // 0x44 'D'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3,
+    0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x87, 0xFF, 0xE7, 0xC7, 0xFF, 0xC7, 0xC1, 0xFF, 0x0F,
+    0xE0, 0x38, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xC7, 0x03, 0xFF, 0x87, 0x07, 0xFE, 0x07,
+    0xFF, 0xFE, 0x1F,
+    // 0x46 'F'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xCF, 0xE7, 0x1F, 0xCF, 0xE7,
+    0x1F, 0xCF, 0xE7, 0x1F, 0xCF, 0xF7, 0x1F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x1F, 0x8F, 0xFF, 0x03, 0xCF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
+    0xE0, 0xFF, 0x07, 0xC3, 0xFF, 0xC3, 0xC7, 0xFF, 0xC3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF1, 0x9F, 0xF3, 0xF1,
+    0x9F, 0xF3, 0xF3, 0x8F, 0xF3, 0xF3, 0x8F, 0xF1, 0xE3, 0x81, 0xF0, 0x03,
+    0x81, 0xF0, 0x03, 0xC1, 0xF0, 0x07, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x48 'H'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0x8F, 0xE7, 0x3F, 0x8F, 0xE7,
+    0x3F, 0x8F, 0xE7, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0x3F, 0x8F, 0xF7, 0x3F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    // 0x49 'I'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x3F, 0xFF, 0xFF, 0x1F, 0x3F, 0xFF, 0xFF, 0x1F, 0x3F, 0xFF, 0xFC, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xE7, 0x3F, 0x07, 0xE7,
+    0x3E, 0x03, 0xE7, 0xFE, 0x01, 0xFF, 0xFC, 0x60, 0xFF, 0xF8, 0xF0, 0x7F,
+    0x31, 0xF8, 0x3F, 0x23, 0xFC, 0x1F, 0x07, 0xFE, 0x0F, 0x0F, 0xFF, 0x07,
+    0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xC3, 0x3F, 0xFF, 0xE3, 0x3F, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xF7,
+    // 0x4C 'L'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07,
+    0xFF, 0xFE, 0x1F,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xF0, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0xFF, 0xE7, 0x03, 0xFF, 0xE7,
+    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFF,
+    0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF7, 0x07, 0xFF, 0xE7,
+    0x00, 0x03, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3F, 0xFC, 0x07,
+    0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7,
+    // 0x4E 'N'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x83, 0xFF, 0xE7, 0xC0, 0xFF, 0xE7,
+    0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0xFF, 0xBF, 0xF0, 0x3F, 0x3F, 0xFC, 0x1F,
+    0x3F, 0xFE, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
+    0xE0, 0xFE, 0x07, 0xC3, 0xFF, 0x83, 0xC7, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1,
+    0x9F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x87, 0xFF, 0xC7,
+    0xC1, 0xFF, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
+    0xFE, 0x01, 0xFF,
+    // 0x50 'P'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x9F, 0xE3, 0xF3, 0x9F, 0xF3, 0xF3,
+    0x9F, 0xF3, 0xF3, 0x9F, 0xE3, 0xFF, 0x8F, 0xE3, 0xFF, 0x8F, 0xC7, 0xFF,
+    0x87, 0x87, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0xFE, 0x07, 0xFF, 0xC3, 0xFF, 0x87, 0xFF,
+    0xC7, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xF1, 0xFF,
+    0x9F, 0xFF, 0xF1, 0xFF, 0x9F, 0xFF, 0xF0, 0xFF, 0x9F, 0xFF, 0xF0, 0x7F,
+    0x8F, 0xFF, 0xF2, 0x7F, 0x8F, 0xFF, 0xE2, 0x3F, 0x87, 0xFF, 0xE3, 0x1F,
+    0xC3, 0xFF, 0xC7, 0x1F, 0xC1, 0xFF, 0x07, 0x1F, 0xE0, 0x00, 0x0F, 0x8F,
+    0xF0, 0x00, 0x1F, 0x8F, 0xF8, 0x00, 0x7F, 0x8F, 0xFE, 0x01, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xBF,
+    // 0x52 'R'
+    0xDF, 0xFF, 0xFB, 0x9F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x9F, 0xE7, 0xF3, 0x9F, 0xE7, 0xF3,
+    0x9F, 0xE3, 0xF3, 0x9F, 0xE0, 0xFF, 0x8F, 0xC0, 0x7F, 0x8F, 0xC8, 0x3F,
+    0x83, 0x0E, 0x0F, 0xC0, 0x1F, 0x07, 0xE0, 0x3F, 0x83, 0xF0, 0x7F, 0xC3,
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
+    // 0x53 'S'
+    0xFF, 0xFF, 0x07, 0xF0, 0x7E, 0x03, 0xE0, 0x3E, 0x03, 0xC0, 0x1F, 0xC3,
+    0x86, 0x0F, 0xF3, 0x8F, 0x0F, 0xF1, 0x9F, 0x87, 0xF1, 0x9F, 0xC7, 0xF1,
+    0x9F, 0xC3, 0xF3, 0x9F, 0xE1, 0xE3, 0x8F, 0xE0, 0xC3, 0x81, 0xF0, 0x07,
+    0xC1, 0xF8, 0x0F, 0xC7, 0xFC, 0x1F,
+    // 0x54 'T'
+    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xF7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0x87,
+    0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7,
+    0x3F, 0xFF, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F,
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x56 'V'
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x3C, 0x00, 0xFF,
+    0x3F, 0x80, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x07,
+    0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0x3E, 0x01, 0xFF, 0x30, 0x07, 0xFF,
+    0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x38, 0x00, 0xFF,
+    0x3F, 0x80, 0x0F, 0x3F, 0xF8, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07,
+    0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
+    0x81, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07,
+    0x3F, 0xF0, 0x07, 0x3F, 0x00, 0x3F, 0x30, 0x03, 0xFF, 0x00, 0x1F, 0xFF,
+    0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7,
+    0x0F, 0xFF, 0x07, 0x07, 0xFE, 0x07, 0x01, 0xFC, 0x27, 0x00, 0xF0, 0xE7,
+    0x30, 0x21, 0xFF, 0x38, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFC, 0x01, 0xF7, 0xF8, 0x60, 0x67, 0x30, 0xF0, 0x27, 0x03, 0xFC, 0x07,
+    0x07, 0xFE, 0x07, 0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xF7,
+    // 0x59 'Y'
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xF7, 0x00, 0x7F, 0xE7, 0x38, 0x1F, 0xE7,
+    0x3C, 0x0F, 0xE7, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x07,
+    0xFE, 0x0F, 0xE7, 0x38, 0x3F, 0xE7, 0x20, 0x7F, 0xE7, 0x01, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xC7, 0x03, 0xFF, 0x87, 0x03, 0xFE, 0x07, 0x1F, 0xFC, 0x07,
+    0x1F, 0xF0, 0x27, 0x1F, 0xE0, 0xE7, 0x1F, 0xC1, 0xE7, 0x1F, 0x07, 0xE7,
+    0x1E, 0x0F, 0xE7, 0x18, 0x1F, 0xE7, 0x10, 0x7F, 0xE7, 0x00, 0xFF, 0xC7,
+    0x03, 0xFF, 0xC7, 0x07, 0xFF, 0x07, 0x1F, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x3F, 0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xFF, 0xE7, 0xBF, 0xFF, 0xFF, 0xEF,
+    // 0x5C '\'
+    0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xFF,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0xEF, 0x3F, 0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x83, 0xFE, 0x03, 0xF8, 0x1F, 0xC0, 0x7F,
+    0x83, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xFF, 0x03,
+    0xFF, 0xC3, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x60 '`'
+    0xFF, 0x8F, 0x07, 0x87, 0xE3, 0xF1, 0xF9,
+    // 0x61 'a'
+    0xFF, 0xE7, 0xFF, 0xE7, 0x81, 0xFF, 0xC7, 0x80, 0xFF, 0x87, 0x00, 0xFF,
+    0x9F, 0x3C, 0x7F, 0x1F, 0x3C, 0xFF, 0x3E, 0x3C, 0xFF, 0x3E, 0x3C, 0xFF,
+    0x1E, 0x39, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF,
+    0xFF, 0x1F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF,
+    0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    // 0x63 'c'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xC0, 0xFF,
+    0x8F, 0xF0, 0xFF, 0x9F, 0xF8, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0xFC, 0x7F,
+    0x1F, 0xFC, 0x7F, 0x1F, 0xFC, 0xFF, 0x07, 0xFC, 0xFF, 0x83, 0xF8, 0xFF,
+    0xC7, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x81, 0x80, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF,
+    0xFF, 0x1F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFC, 0xFF, 0xDF, 0x1F, 0xFC, 0xFF,
+    0x9F, 0x1F, 0xF8, 0xFF, 0x9F, 0x1F, 0xF9, 0xFF, 0x80, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFC, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x60, 0xFF,
+    0x9C, 0x70, 0xFF, 0x1C, 0x78, 0xFF, 0x3C, 0x7C, 0xFF, 0x3C, 0x7C, 0x7F,
+    0x1C, 0x7C, 0xFF, 0x1C, 0x7C, 0xFF, 0x80, 0x7C, 0xFF, 0x80, 0x78, 0xFF,
+    0xC0, 0x79, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0x9F, 0xFC, 0xFF, 0x1F, 0xFC,
+    0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x8F, 0x9F, 0xFC,
+    0x9F, 0x9F, 0xFC, 0x9F, 0x9F, 0xFC, 0x9F, 0x9F, 0xFF, 0x9F, 0x9F, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xE0, 0xE1, 0x03, 0xC0, 0x40, 0x01,
+    0x80, 0x00, 0x71, 0x8E, 0x18, 0xF1, 0x1F, 0x18, 0xF9, 0x3F, 0x18, 0xF9,
+    0x3F, 0x98, 0xF9, 0x1F, 0x18, 0xF9, 0x1F, 0x18, 0xF1, 0x84, 0x38, 0xF3,
+    0x80, 0x3C, 0xE3, 0x00, 0x7C, 0x43, 0x11, 0xFC, 0x07, 0x1F, 0xFE, 0x0F,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x8F, 0xFC,
+    0xFF, 0x9F, 0xFE, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFF, 0x1F, 0xFC, 0xFF, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0x9F, 0xFC, 0x87, 0x8F, 0xFC,
+    0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x87, 0x80, 0x00, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x9F, 0xFF, 0xF1,
+    0xFF, 0x9F, 0xFF, 0xF1, 0xCF, 0x9F, 0xFF, 0xC3, 0x87, 0x00, 0x00, 0x03,
+    0x87, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFC, 0x7C, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xFF, 0xB0, 0x0F, 0xFF, 0xFF, 0xB3, 0x07, 0xFF, 0xFF, 0x83, 0x83, 0xFF,
+    0xFF, 0x87, 0xE1, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x9F, 0xF0, 0xFF,
+    0xFF, 0x9F, 0xF8, 0x7F, 0xFF, 0xBF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xFE, 0xDF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0x9F, 0xFE, 0x9F, 0xFC, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x00, 0xCF, 0xFC, 0x9F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF,
+    0x1F, 0xFC, 0x03, 0xFC, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xCF, 0xFC,
+    0x9F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFC, 0x07, 0xFC,
+    0x80, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0x9F, 0xFE, 0x9F, 0xFC, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x00, 0xCF, 0xFC, 0x9F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF,
+    0x1F, 0xFC, 0x0F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0xE0, 0x00, 0xFF, 0xFC,
+    0xFF, 0xFC, 0xFF, 0xFE,
+    // 0x6F 'o'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x81, 0x80, 0xFF,
+    0x8F, 0xF0, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0xFC, 0x7F, 0x1F, 0xFC, 0x7F,
+    0x1F, 0xFC, 0x7F, 0x1F, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x87, 0xF0, 0xFF,
+    0x80, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
+    // 0x70 'p'
+    0xDF, 0xFF, 0xFD, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0xCF, 0xF8, 0xF9, 0x8F, 0xFC, 0xF9,
+    0x9F, 0xFC, 0xF9, 0x1F, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F, 0xF8, 0xFF,
+    0x0F, 0xF8, 0xFF, 0x07, 0xE1, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x81, 0x80, 0xFF,
+    0x8F, 0xF0, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF,
+    0x1F, 0xFC, 0xF9, 0x1F, 0xF8, 0xF9, 0x1F, 0xF1, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xF9,
+    // 0x72 'r'
+    0xFF, 0xFF, 0x9F, 0xFC, 0x9F, 0xFC, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0xC7, 0xFC, 0x8F, 0xFC, 0x9F, 0xFC, 0x1F, 0xFF, 0x0F, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xFF, 0xC0, 0xE0, 0xFF, 0x80, 0x78, 0xFF,
+    0x18, 0x7C, 0xFF, 0x3C, 0x3C, 0x7F, 0x3C, 0x3C, 0x7F, 0x3E, 0x3C, 0xFF,
+    0x1E, 0x1C, 0xFF, 0x07, 0x00, 0xFF, 0x87, 0x01, 0xFF, 0xDF, 0xC3, 0xFF,
+    // 0x74 't'
+    0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x87, 0xF9, 0xFF, 0xC7,
+    0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0xDF,
+    // 0x75 'u'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x9F, 0xF8, 0xFF,
+    0x9F, 0xF1, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x76 'v'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x98, 0x07, 0xFF, 0xBF, 0x00, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0xFF, 0xBE, 0x03, 0xFF,
+    0x98, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x77 'w'
+    0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x9C, 0x01, 0xFF, 0xBF, 0x80, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x0F, 0xFF,
+    0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xC0, 0xFF,
+    0xBE, 0x03, 0xFF, 0x90, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFE, 0x9F, 0xFC, 0x9F, 0xFC, 0x8F, 0xF8, 0x87, 0xF0, 0x83, 0xE0,
+    0x81, 0xC4, 0xB0, 0x0E, 0xFC, 0x3F, 0xFC, 0x1F, 0xF8, 0x0E, 0xB1, 0x84,
+    0x83, 0xC0, 0x87, 0xF0, 0x8F, 0xF8, 0x9F, 0xFC, 0xBF, 0xFC, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xBF, 0xFF, 0xF3, 0x9F, 0xFF, 0xF1, 0x8F, 0xFF, 0xF1, 0x83, 0xFF, 0xF1,
+    0x80, 0x7F, 0xF1, 0x80, 0x1F, 0xE1, 0x98, 0x07, 0xC3, 0xBF, 0x00, 0x07,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xBE, 0x03, 0xFF,
+    0x98, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0xFF, 0x83, 0xF0, 0xFF, 0x8F, 0xE0, 0xFF,
+    0x9F, 0xC0, 0xFF, 0x9F, 0x04, 0xFF, 0x9E, 0x0C, 0xFF, 0x9C, 0x3C, 0xFF,
+    0x98, 0x7C, 0xFF, 0x80, 0xFC, 0xFF, 0x83, 0xFC, 0xFF, 0x87, 0xF8, 0xFF,
+    0x8F, 0xE0, 0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0x10, 0x60, 0x1F,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x02, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x3F, 0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xFF, 0xE7, 0x1F, 0x07, 0x07, 0xC7, 0x80, 0x02, 0x00, 0x0F,
+    0xC0, 0x00, 0x00, 0x0F, 0xE0, 0xF8, 0x78, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xFF, 0xC7, 0x87, 0x9F, 0x1F, 0x9F, 0x8F, 0x8F, 0xC7, 0xE7, 0xE7, 0xC7,
+    0x8F, 0x8F, 0xFF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xE1, 0x0E, 0x00, 0x01, 0x0C, 0x00, 0x01,
+    0x9F, 0xE0, 0x03,
+    // 0xA2 '¢'
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFE, 0x1F, 0x87, 0xFF, 0xFC, 0x7F, 0xC3, 0xFF, 0xFC, 0xFF, 0xE3, 0xFF,
+    0xFC, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xF3, 0xFF,
+    0xFC, 0xFF, 0xF3, 0xFF, 0xFC, 0x7F, 0xE3, 0xFF, 0xFC, 0x1F, 0xE3, 0xFF,
+    0xFE, 0x1F, 0xE7, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xCF, 0xE7, 0xFF, 0xCF, 0xE3, 0xFF, 0xCF, 0x07,
+    0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0xE7, 0xC0, 0x0F, 0xE7,
+    0x87, 0xCF, 0xE7, 0x1F, 0xCF, 0xE7, 0x1F, 0xCF, 0xE7, 0x1F, 0xCF, 0xE7,
+    0x1F, 0xCF, 0xE7, 0x0F, 0xFF, 0xC3, 0x83, 0xFF, 0xC7, 0xC3, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xFF, 0x9F, 0xF1, 0xCF, 0xF3, 0xC0, 0x07, 0xE0, 0x07, 0xE3, 0xC7,
+    0xC7, 0xE7, 0xCF, 0xE3, 0xCF, 0xE3, 0xCF, 0xE7, 0xC7, 0xE7, 0xE1, 0x87,
+    0xE0, 0x07, 0xC0, 0x23, 0x8F, 0xF3, 0x9F, 0xFB, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x03, 0x9B, 0xFF, 0x00, 0x99, 0xF7, 0x10, 0x19, 0xE7, 0x38, 0x19, 0xE7,
+    0xFE, 0x01, 0xE7, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x07,
+    0xFF, 0x09, 0xE7, 0xBC, 0x19, 0xE7, 0x30, 0x19, 0xE7, 0x01, 0x99, 0xFF,
+    0x07, 0x9F, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFC, 0x1F, 0xF7, 0xF0, 0x07, 0xE1, 0xE0, 0x83, 0xE1, 0xC0, 0xE1, 0xF0,
+    0x8C, 0x71, 0xF8, 0x9E, 0x38, 0xFC, 0x1E, 0x3C, 0x7C, 0x1F, 0x1C, 0x79,
+    0x1F, 0x8E, 0x39, 0x87, 0x8F, 0x03, 0x87, 0xC3, 0x83, 0xCF, 0xE0, 0x0F,
+    0xFF, 0xF8, 0x1F,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x8F, 0xE7, 0xFF, 0xC7, 0xCF, 0xC3, 0xE7, 0xCF, 0x00, 0xF3,
+    0x9E, 0x00, 0x73, 0x9C, 0xFE, 0x73, 0x9C, 0xFE, 0x39, 0x9D, 0xFF, 0x39,
+    0x9D, 0xFF, 0x39, 0x9C, 0x7E, 0x3B, 0x9C, 0x3E, 0x73, 0x9F, 0xFE, 0xF3,
+    0xCF, 0xFF, 0xE3, 0xC7, 0xFF, 0xE7, 0xE3, 0xFF, 0xCF, 0xF1, 0xFF, 0x0F,
+    0xF8, 0x18, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xFF, 0xEE, 0x39, 0xC4, 0x19, 0x8C, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x80, 0x39, 0x80, 0x19, 0xC0, 0x19, 0xFF, 0x93, 0xFF, 0xBF,
+    // 0xAB '«'
+    0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC2, 0x3F, 0xC7, 0x1F, 0x8F, 0x8F,
+    0xBF, 0xCF, 0xFD, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC2, 0x1F,
+    0x8F, 0x9F, 0x9F, 0xCF, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE7, 0xF1, 0xFF,
+    0xCF, 0xF9, 0xFF, 0x9F, 0xFC, 0xFF, 0x90, 0x06, 0xFF, 0xB0, 0x06, 0xFF,
+    0xB3, 0x66, 0x7F, 0xB2, 0x1E, 0x7F, 0x98, 0x0E, 0xFF, 0x9D, 0xC4, 0xFF,
+    0xDF, 0xEC, 0xFF, 0xCF, 0xF9, 0xFF, 0xE3, 0xE3, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFE, 0x3F, 0xFF,
+    // 0xB0 '°'
+    0xE1, 0xFF, 0x80, 0x7F, 0x8C, 0x7F, 0x1E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x1E, 0x3F, 0x80, 0x7F, 0x80, 0xFF, 0xE1, 0xFF,
+    // 0xB1 '±'
+    0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F,
+    0xFC, 0xFF, 0x3F, 0x00, 0x07, 0x3F, 0x00, 0x07, 0x3F, 0x80, 0x07, 0x3F,
+    0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F,
+    0xFC, 0xFF, 0x3F,
+    // 0xB2 '²'
+    0xC7, 0xE3, 0x87, 0xC3, 0x87, 0xC3, 0x1F, 0x83, 0x3F, 0x03, 0x1E, 0x23,
+    0x08, 0x63, 0x80, 0xE3, 0x81, 0xE3, 0xFF, 0xE3,
+    // 0xB3 '³'
+    0xCF, 0xF3, 0x8F, 0xF3, 0x9C, 0xF3, 0x1C, 0xF3, 0x3C, 0xF3, 0x18, 0xE3,
+    0x80, 0x07, 0x82, 0x07, 0xC7, 0x0F, 0xFF, 0xFF,
+    // 0xB5 'µ'
+    0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0xF3,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+    0x80, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xFF, 0x8F, 0x87, 0x87, 0x8F, 0xFF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xCF, 0xF3, 0x8F, 0xF3, 0x8F, 0xF3, 0x80, 0x03, 0x00, 0x03,
+    0xBF, 0xF3, 0xFF, 0xF3, 0xFF, 0xF3,
+    // 0xBA 'º'
+    0xFF, 0xFF, 0xE0, 0x7F, 0xC0, 0x39, 0x86, 0x19, 0x9F, 0x99, 0x9F, 0x99,
+    0x9F, 0x99, 0x8F, 0x99, 0x80, 0x19, 0xC0, 0x33, 0xE0, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x8F, 0x9F, 0xC6, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0xFF, 0xFD, 0xFF, 0xBF, 0xCF, 0x9F, 0x8F, 0xCF, 0x1F, 0xC2, 0x3F,
+    0xE0, 0x7F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF,
+    0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xF9, 0xF9, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0x1F, 0x83, 0xFE, 0x1F,
+    0x0F, 0xFC, 0x1F, 0xBF, 0xF0, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xC7, 0x9F,
+    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF,
+    0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFD,
+    0xFF, 0xF9, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xC7, 0xE3,
+    0x9F, 0xC7, 0xE3, 0xFF, 0x8F, 0xC3, 0xFF, 0x9F, 0x83, 0xFF, 0x1F, 0x13,
+    0xFF, 0x1E, 0x33, 0xFF, 0x80, 0x73, 0xFF, 0x80, 0xF3, 0xFF, 0xC1, 0xF3,
+    0xFF, 0xFF, 0xF3,
+    // 0xBE '¾'
+    0xE7, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF, 0xCE, 0x79, 0xFF, 0x9E, 0x79, 0xFF,
+    0x9C, 0x79, 0xFF, 0x9C, 0x71, 0xFF, 0x80, 0x03, 0xFF, 0xC1, 0x03, 0xFF,
+    0xE3, 0x8F, 0xF9, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0x9F, 0x83, 0xFE, 0x1F,
+    0x0F, 0xFC, 0x1F, 0xBF, 0xF8, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xC3, 0x9F,
+    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE3, 0x87,
+    0xFF, 0xC3, 0xC7, 0x9F, 0xC7, 0xE3, 0x0F, 0x87, 0xE3, 0x0E, 0x07, 0xE3,
+    0x0E, 0x0F, 0xE3, 0xFF, 0xDF, 0xE3, 0xFF, 0xFF, 0xE7,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x27,
+    0xDF, 0xFF, 0x80, 0xE7, 0x0F, 0xFC, 0x01, 0xE7, 0x87, 0xF0, 0x31, 0xFF,
+    0xC7, 0x80, 0xF1, 0xFF, 0xC7, 0x07, 0xF1, 0xFF, 0xE3, 0x07, 0xF1, 0xFF,
+    0xF3, 0x00, 0xF1, 0xFF, 0xFF, 0xC0, 0x11, 0xF7, 0xFF, 0xF0, 0x01, 0xE7,
+    0xFF, 0xFE, 0x00, 0x67, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x27,
+    0xFF, 0xFF, 0x80, 0xE7, 0xFF, 0xFC, 0x01, 0xE7, 0xF3, 0xF0, 0x31, 0xFF,
+    0xE3, 0x80, 0xF1, 0xFF, 0xE7, 0x07, 0xF1, 0xFF, 0xC7, 0x07, 0xF1, 0xFF,
+    0x87, 0x00, 0xF1, 0xFF, 0x8F, 0xC0, 0x11, 0xF7, 0x8F, 0xF0, 0x01, 0xE7,
+    0xFF, 0xFE, 0x00, 0x67, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x27,
+    0xFB, 0xFF, 0x80, 0xE7, 0xE3, 0xFC, 0x01, 0xE7, 0xC3, 0xF0, 0x31, 0xFF,
+    0x87, 0x80, 0xF1, 0xFF, 0x8F, 0x07, 0xF1, 0xFF, 0x8F, 0x07, 0xF1, 0xFF,
+    0x8F, 0x00, 0xF1, 0xFF, 0xC7, 0xC0, 0x11, 0xF7, 0xE3, 0xF0, 0x01, 0xE7,
+    0xF3, 0xFE, 0x00, 0x67, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x27,
+    0xC7, 0xFF, 0x80, 0xE7, 0x87, 0xFC, 0x01, 0xE7, 0x8F, 0xF0, 0x31, 0xFF,
+    0x8F, 0x80, 0xF1, 0xFF, 0x8F, 0x07, 0xF1, 0xFF, 0xC7, 0x07, 0xF1, 0xFF,
+    0xE7, 0x00, 0xF1, 0xFF, 0xC7, 0xC0, 0x11, 0xF7, 0x87, 0xF0, 0x01, 0xE7,
+    0xDF, 0xFE, 0x00, 0x67, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xDF, 0xFF, 0xC0, 0x4F,
+    0x8F, 0xFF, 0x01, 0xCF, 0x8F, 0xF8, 0x03, 0xCF, 0x8F, 0xE0, 0x63, 0xFF,
+    0xFF, 0x01, 0xE3, 0xFF, 0xFE, 0x0F, 0xE3, 0xFF, 0xFE, 0x0F, 0xE3, 0xFF,
+    0x8E, 0x01, 0xE3, 0xFF, 0x8F, 0x80, 0x23, 0xEF, 0x8F, 0xE0, 0x03, 0xCF,
+    0x8F, 0xFC, 0x00, 0xCF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x13,
+    0xFF, 0xFF, 0xC0, 0x73, 0xC3, 0xFE, 0x00, 0xF3, 0x81, 0xF8, 0x18, 0xFF,
+    0x98, 0xC0, 0x78, 0xFF, 0x3C, 0x83, 0xF8, 0xFF, 0x1C, 0x83, 0xF8, 0xFF,
+    0x81, 0x80, 0x78, 0xFF, 0x81, 0xE0, 0x08, 0xFB, 0xE7, 0xF8, 0x00, 0xF3,
+    0xFF, 0xFF, 0x00, 0x33, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x03,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x27, 0xFF, 0xE0, 0xE7,
+    0xFF, 0x81, 0xF7, 0xFF, 0x03, 0xFF, 0xFC, 0x13, 0xFF, 0x30, 0x73, 0xFF,
+    0x01, 0xF3, 0xF7, 0x07, 0xF3, 0xE7, 0x1F, 0xF3, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xC7, 0x03, 0xFF, 0x87, 0x07, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
+    // 0xC7 'Ç'
+    0xFF, 0xC1, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0x07, 0xFF, 0xC3, 0xFF, 0x83, 0xFF,
+    0xC7, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xE3, 0x33,
+    0x9F, 0xFF, 0xE2, 0x23, 0x9F, 0xFF, 0xE1, 0x07, 0x9F, 0xFF, 0xF3, 0x0F,
+    0x8F, 0xFF, 0xE3, 0x9F, 0x83, 0xFF, 0xE3, 0xFF, 0x80, 0xFF, 0xE3, 0xFF,
+    0x81, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0x9F, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x07,
+    0x87, 0x1F, 0x8F, 0xE7, 0xC7, 0x1F, 0x8F, 0xE7, 0xE7, 0x1F, 0x8F, 0xE7,
+    0xE3, 0x1F, 0x8F, 0xE7, 0xF3, 0x1F, 0x8F, 0xE7, 0xFF, 0x1F, 0x8F, 0xE7,
+    0xFF, 0x1F, 0x8F, 0xE7, 0xFF, 0x1F, 0x8F, 0xC7, 0xFF, 0x03, 0xFF, 0x87,
+    0xFF, 0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
+    // 0xC9 'É'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xF3, 0x1F, 0x8F, 0xE7, 0xE3, 0x1F, 0x8F, 0xE7, 0xE7, 0x1F, 0x8F, 0xE7,
+    0xC7, 0x1F, 0x8F, 0xE7, 0x87, 0x1F, 0x8F, 0xE7, 0x8F, 0x1F, 0x8F, 0xE7,
+    0x9F, 0x1F, 0x8F, 0xE7, 0xFF, 0x1F, 0x8F, 0xC7, 0xFF, 0x03, 0xFF, 0x87,
+    0xFF, 0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
+    // 0xCA 'Ê'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07,
+    0xC7, 0x1F, 0x8F, 0xE7, 0x8F, 0x1F, 0x8F, 0xE7, 0x9F, 0x1F, 0x8F, 0xE7,
+    0x8F, 0x1F, 0x8F, 0xE7, 0x87, 0x1F, 0x8F, 0xE7, 0xC3, 0x1F, 0x8F, 0xE7,
+    0xE3, 0x1F, 0x8F, 0xE7, 0xFB, 0x1F, 0x8F, 0xC7, 0xFF, 0x03, 0xFF, 0x87,
+    0xFF, 0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
+    // 0xCB 'Ë'
+    0xFE, 0x7F, 0xFF, 0xEF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0xCF,
+    0x8E, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F,
+    0x8E, 0x3F, 0x1F, 0xCF, 0xFE, 0x3F, 0x1F, 0xCF, 0xFE, 0x3F, 0x1F, 0xCF,
+    0xFE, 0x3F, 0x1F, 0xCF, 0x8E, 0x3F, 0x1F, 0xCF, 0x8E, 0x3F, 0x1F, 0xCF,
+    0x8E, 0x3F, 0x1F, 0xCF, 0x9E, 0x3F, 0x1F, 0x8F, 0xFE, 0x07, 0xFF, 0x0F,
+    0xFE, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F,
+    // 0xCC 'Ì'
+    0x9F, 0x3F, 0xFF, 0xF7, 0x0F, 0x3F, 0xFF, 0xE7, 0x87, 0x3F, 0xFF, 0xE7,
+    0xC7, 0x00, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07,
+    0xF3, 0x1F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xF3, 0x3F, 0xFF, 0xE7,
+    0xE3, 0x00, 0x00, 0x07, 0xE7, 0x00, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x07,
+    0x87, 0x1F, 0xFF, 0xE7, 0x8F, 0x3F, 0xFF, 0xE7, 0x8F, 0x3F, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x3F, 0xFF, 0xF7, 0xE3, 0x3F, 0xFF, 0xE7,
+    0xC3, 0x3F, 0xFF, 0xE7, 0x87, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x07,
+    0x8F, 0x00, 0x00, 0x07, 0x87, 0x1F, 0xFF, 0xE7, 0xC7, 0x3F, 0xFF, 0xE7,
+    0xE3, 0x3F, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xDF, 0xFF, 0xFF, 0xFF, 0x8E, 0x7F, 0xFF, 0xEF, 0x8E, 0x7F, 0xFF, 0xCF,
+    0x8E, 0x7F, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
+    0xFE, 0x00, 0x00, 0x0F, 0x8E, 0x3F, 0xFF, 0xCF, 0x8E, 0x7F, 0xFF, 0xCF,
+    0x8E, 0x7F, 0xFF, 0xCF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xE7, 0xFB, 0x9F, 0xE7, 0xF3, 0x9F, 0xE7, 0xF3,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x9F, 0xE7, 0xF3,
+    0x9F, 0xE7, 0xF3, 0x9F, 0xE7, 0xF3, 0x9F, 0xE7, 0xF3, 0x8F, 0xE7, 0xF3,
+    0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x87, 0xFF, 0xE7, 0xC7, 0xFF, 0xC7,
+    0xC1, 0xFF, 0x0F, 0xE0, 0x38, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xC7, 0x83, 0xFF, 0xE7, 0x87, 0xC0, 0xFF, 0xE7, 0x8F, 0xF0, 0x7F, 0xFF,
+    0x8F, 0xF8, 0x3F, 0xFF, 0x8F, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
+    0xE7, 0xFF, 0x81, 0xFF, 0xC7, 0xFF, 0xE0, 0xFF, 0x87, 0xBF, 0xF0, 0x3F,
+    0xCF, 0x3F, 0xFC, 0x1F, 0xFF, 0x3F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC1, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0x07,
+    0x9F, 0x8F, 0xFF, 0xC7, 0x0F, 0x1F, 0xFF, 0xC7, 0x87, 0x1F, 0xFF, 0xE3,
+    0xC7, 0x3F, 0xFF, 0xE3, 0xC7, 0x3F, 0xFF, 0xE3, 0xE3, 0x3F, 0xFF, 0xE3,
+    0xF3, 0x3F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC1, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0x07,
+    0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0x1F, 0xFF, 0xC7, 0xF3, 0x1F, 0xFF, 0xE3,
+    0xE3, 0x3F, 0xFF, 0xE3, 0xE7, 0x3F, 0xFF, 0xE3, 0xC7, 0x3F, 0xFF, 0xE3,
+    0x87, 0x3F, 0xFF, 0xE7, 0x8F, 0x1F, 0xFF, 0xC7, 0x8F, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC1, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0x07,
+    0xF3, 0x8F, 0xFF, 0xC7, 0xE3, 0x1F, 0xFF, 0xC7, 0xC3, 0x1F, 0xFF, 0xE3,
+    0x87, 0x3F, 0xFF, 0xE3, 0x8F, 0x3F, 0xFF, 0xE3, 0x8F, 0x3F, 0xFF, 0xE3,
+    0x87, 0x3F, 0xFF, 0xE7, 0xC7, 0x1F, 0xFF, 0xC7, 0xE3, 0x1F, 0xFF, 0xC7,
+    0xF3, 0x0F, 0xFF, 0x8F, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC1, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0x07,
+    0xC7, 0x8F, 0xFF, 0xC7, 0x87, 0x1F, 0xFF, 0xC7, 0x8F, 0x1F, 0xFF, 0xE3,
+    0x8F, 0x3F, 0xFF, 0xE3, 0x87, 0x3F, 0xFF, 0xE3, 0xC7, 0x3F, 0xFF, 0xE3,
+    0xE7, 0x3F, 0xFF, 0xE7, 0x87, 0x1F, 0xFF, 0xC7, 0x87, 0x1F, 0xFF, 0xC7,
+    0xDF, 0x0F, 0xFF, 0x8F, 0xFF, 0x83, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x83, 0xF8, 0x1F, 0xDF, 0x0F, 0xFE, 0x0F,
+    0x8F, 0x1F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0xC7,
+    0xFE, 0x7F, 0xFF, 0xC7, 0xFE, 0x7F, 0xFF, 0xC7, 0xFE, 0x7F, 0xFF, 0xC7,
+    0x8E, 0x7F, 0xFF, 0xCF, 0x8E, 0x3F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0x8F,
+    0x8E, 0x1F, 0xFF, 0x1F, 0xFF, 0x07, 0xFC, 0x1F, 0xFF, 0x80, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
+    // 0xD7 '×'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x8F, 0x8F, 0xC7, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0x7F, 0xF0, 0x3F, 0xE2, 0x1F, 0xC7, 0x0F, 0x8F, 0xCF, 0xDF, 0xEF,
+    0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF3, 0xFC, 0x00, 0x23, 0xF8, 0x00, 0x07,
+    0xF0, 0x00, 0x0F, 0xE0, 0xFE, 0x07, 0xC3, 0xFE, 0x03, 0xC7, 0xFC, 0x63,
+    0x8F, 0xF8, 0xE3, 0x8F, 0xF1, 0xF1, 0x9F, 0xE3, 0xF1, 0x9F, 0xC7, 0xF1,
+    0x9F, 0x8F, 0xF1, 0x9F, 0x1F, 0xF3, 0x8E, 0x3F, 0xE3, 0x8C, 0x7F, 0xE3,
+    0x80, 0xFF, 0xC7, 0xC0, 0xFF, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
+    0x88, 0x00, 0x3F, 0x9E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x07, 0xDF, 0x3F, 0xFF, 0x87, 0x0F, 0x3F, 0xFF, 0xC7,
+    0x87, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xE7, 0xC7, 0xFF, 0xFF, 0xE3,
+    0xE3, 0xFF, 0xFF, 0xE7, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0x3F, 0xFF, 0xC7, 0xFF, 0x3F, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0x87, 0xFF, 0x3F, 0xFF, 0xC7,
+    0xF3, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xE3,
+    0xC7, 0xFF, 0xFF, 0xE7, 0x87, 0xFF, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xC7,
+    0x8F, 0x3F, 0xFF, 0xC7, 0xFF, 0x3F, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x07, 0xFB, 0x3F, 0xFF, 0x87, 0xF3, 0x3F, 0xFF, 0xC7,
+    0xC3, 0xFF, 0xFF, 0xC7, 0x87, 0xFF, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xE7, 0xC7, 0xFF, 0xFF, 0xC7,
+    0xE3, 0x3F, 0xFF, 0xC7, 0xF3, 0x3F, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x0F, 0x8E, 0x7F, 0xFF, 0x0F, 0x8E, 0x7F, 0xFF, 0x8F,
+    0x8F, 0xFF, 0xFF, 0x8F, 0xDF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0xFF, 0xFF, 0xCF, 0x8F, 0xFF, 0xFF, 0x8F,
+    0x8E, 0x7F, 0xFF, 0x8F, 0x8E, 0x7F, 0xFE, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0x3F, 0xFF, 0xF7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x33, 0xFE, 0x67, 0x33, 0xFE, 0x67,
+    0x73, 0xFE, 0x67, 0xF3, 0xFE, 0x7F, 0xF1, 0xFC, 0x7F, 0xF1, 0xFC, 0xFF,
+    0xF8, 0xF8, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF1, 0xFF,
+    0x9F, 0xFF, 0xF0, 0xFF, 0x9F, 0xC3, 0xF8, 0xFF, 0x9F, 0x81, 0xFC, 0xFF,
+    0x8F, 0x00, 0xFC, 0x7F, 0x84, 0x38, 0x7C, 0xFF, 0x80, 0x7C, 0x3C, 0xFF,
+    0xC0, 0xFE, 0x00, 0xFF, 0xF3, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xC0, 0xFF, 0xDF, 0xE3, 0xC0, 0x7F,
+    0x8F, 0xC3, 0x80, 0x7F, 0x87, 0xCF, 0x9E, 0x3F, 0xC3, 0x8F, 0x9E, 0x7F,
+    0xE3, 0x9F, 0x1E, 0x7F, 0xF1, 0x9F, 0x1E, 0x7F, 0xFF, 0x8F, 0x1C, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xC0, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F,
+    0xFF, 0xC3, 0x80, 0x7F, 0xFF, 0xCF, 0x9E, 0x3F, 0xF9, 0x8F, 0x9E, 0x7F,
+    0xF1, 0x9F, 0x1E, 0x7F, 0xC3, 0x9F, 0x1E, 0x7F, 0x87, 0x8F, 0x1C, 0xFF,
+    0x8F, 0x80, 0x00, 0xFF, 0xDF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0x81, 0xFF, 0xFB, 0xC7, 0x80, 0xFF,
+    0xE3, 0x87, 0x00, 0xFF, 0xC3, 0x9F, 0x3C, 0x7F, 0x07, 0x1F, 0x3C, 0xFF,
+    0x1F, 0x3E, 0x3C, 0xFF, 0x0F, 0x3E, 0x3C, 0xFF, 0x87, 0x1E, 0x39, 0xFF,
+    0xC3, 0x00, 0x01, 0xFF, 0xE3, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0x81, 0xFF, 0xC7, 0xC7, 0x80, 0xFF,
+    0x87, 0x87, 0x00, 0xFF, 0x8F, 0x9F, 0x3C, 0x7F, 0x8F, 0x1F, 0x3C, 0xFF,
+    0xC7, 0x3E, 0x3C, 0xFF, 0xC7, 0x3E, 0x3C, 0xFF, 0xE3, 0x1E, 0x39, 0xFF,
+    0xC7, 0x00, 0x01, 0xFF, 0x87, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xCF, 0x03, 0x8F, 0x8F, 0x01, 0x8F, 0x0E, 0x01,
+    0x8F, 0x3E, 0x78, 0xFE, 0x3E, 0x79, 0xFE, 0x7C, 0x79, 0xFE, 0x7C, 0x79,
+    0x8E, 0x3C, 0x73, 0x8E, 0x00, 0x03, 0x8F, 0x00, 0x01, 0x8F, 0x80, 0x01,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xC0, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F,
+    0xC3, 0xC3, 0x80, 0x7F, 0x81, 0xCF, 0x9E, 0x3F, 0x18, 0x8F, 0x9E, 0x7F,
+    0x3C, 0x9F, 0x1E, 0x7F, 0x1C, 0x9F, 0x1E, 0x7F, 0x81, 0x8F, 0x1C, 0xFF,
+    0x81, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xE7, 0xFF, 0xE7, 0x81, 0xFF, 0xC7, 0x80, 0xFF, 0x87, 0x00, 0xFF,
+    0x9F, 0x3C, 0x7F, 0x1E, 0x3C, 0x7F, 0x3E, 0x7C, 0xFF, 0x3E, 0x7C, 0xFF,
+    0x1E, 0x78, 0xFF, 0x80, 0x19, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
+    0xC0, 0x40, 0xFF, 0x8E, 0x70, 0xFF, 0x1C, 0x78, 0xFF, 0x3C, 0x7C, 0xFF,
+    0x3C, 0xFC, 0x7F, 0x1C, 0xFC, 0xFF, 0x0C, 0xFC, 0xFF, 0x80, 0xFC, 0xFF,
+    0x80, 0xF8, 0xFF, 0xE0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xFC, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xC0, 0xFF,
+    0x8F, 0xF0, 0xFF, 0x9F, 0xF8, 0xDE, 0x1F, 0xF8, 0x8C, 0x1F, 0xFC, 0x00,
+    0x1F, 0xFC, 0x41, 0x1F, 0xFC, 0xC3, 0x07, 0xFC, 0xFF, 0x83, 0xF8, 0xFF,
+    0xC7, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0x8F, 0xC0, 0x30, 0x7F, 0x07, 0xCE, 0x38, 0x7F, 0x87, 0x8E, 0x3C, 0x7F,
+    0xC3, 0x9E, 0x3E, 0x7F, 0xF1, 0x9E, 0x3E, 0x3F, 0xF9, 0x8E, 0x3E, 0x7F,
+    0xFF, 0x8E, 0x3E, 0x7F, 0xFF, 0xC0, 0x3E, 0x7F, 0xFF, 0xC0, 0x3C, 0x7F,
+    0xFF, 0xE0, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x30, 0x7F, 0xFF, 0xCE, 0x38, 0x7F, 0xFF, 0x8E, 0x3C, 0x7F,
+    0xF9, 0x9E, 0x3E, 0x7F, 0xE1, 0x9E, 0x3E, 0x3F, 0xC3, 0x8E, 0x3E, 0x7F,
+    0x87, 0x8E, 0x3E, 0x7F, 0x8F, 0xC0, 0x3E, 0x7F, 0xFF, 0xC0, 0x3C, 0x7F,
+    0xFF, 0xE0, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xF3, 0x80, 0x60, 0xFF, 0xE3, 0x9C, 0x70, 0xFF, 0x87, 0x1C, 0x78, 0xFF,
+    0x0F, 0x3C, 0x7C, 0xFF, 0x1F, 0x3C, 0x7C, 0x7F, 0x0F, 0x1C, 0x7C, 0xFF,
+    0x87, 0x1C, 0x7C, 0xFF, 0xC3, 0x80, 0x7C, 0xFF, 0xF3, 0x80, 0x78, 0xFF,
+    0xFF, 0xC0, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x07, 0x8F, 0x80, 0x03, 0x8F, 0x00, 0xC1,
+    0x8F, 0x38, 0xE1, 0x8E, 0x38, 0xF1, 0xFE, 0x78, 0xF9, 0xFE, 0x78, 0xF8,
+    0xFE, 0x38, 0xF9, 0x8E, 0x38, 0xF9, 0x8F, 0x00, 0xF9, 0x8F, 0x00, 0xF1,
+    0xFF, 0x80, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xCF, 0xFF, 0x7F, 0x87, 0xCF, 0xFE, 0x7F,
+    0xC3, 0xC7, 0xFE, 0x7F, 0xE3, 0x80, 0x00, 0x7F, 0xF1, 0x80, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F,
+    0xFF, 0xC7, 0xFE, 0x7F, 0xF1, 0x80, 0x00, 0x7F, 0xC3, 0x80, 0x00, 0x7F,
+    0x83, 0xC0, 0x00, 0x7F, 0x87, 0xFF, 0xFE, 0x7F, 0x9F, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFB, 0xFF, 0xFF, 0xF3, 0x9F, 0xFE, 0xC3, 0x9F, 0xFC, 0x87, 0x8F, 0xFC,
+    0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x8F, 0x80, 0x00, 0xC3, 0xFF, 0xFC,
+    0xE3, 0xFF, 0xFC, 0xFB, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0x3F, 0xFD, 0x8F, 0x3F, 0xF9,
+    0xDF, 0x1F, 0xF9, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x8F, 0x00, 0x01,
+    0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xF9, 0x8F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xE0, 0xC0, 0x7F, 0xDC, 0xC7, 0xF8, 0x7F, 0x89, 0xCF, 0xFC, 0x7F,
+    0xC1, 0x8F, 0xFE, 0x3F, 0xE3, 0x8F, 0xFE, 0x3F, 0xE3, 0x8F, 0xFE, 0x3F,
+    0xC0, 0xCF, 0xFE, 0x7F, 0xC8, 0x47, 0xFC, 0x7F, 0x9C, 0x03, 0xF8, 0x7F,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0x9F, 0xFC, 0xFF, 0x8F, 0xFC,
+    0xFF, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x87, 0xC0, 0x00, 0x87, 0xCF, 0xFC,
+    0x8F, 0x9F, 0xFC, 0x8F, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF,
+    0xE3, 0x1F, 0xFC, 0x87, 0x0F, 0xFC, 0xCF, 0x80, 0x00, 0xFF, 0x80, 0x00,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE,
+    // 0xF2 'ò'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xC0, 0xC0, 0x7F, 0x8F, 0xC7, 0xF8, 0x7F, 0x87, 0x8F, 0xFC, 0x7F,
+    0xC3, 0x8F, 0xFE, 0x3F, 0xE3, 0x8F, 0xFE, 0x3F, 0xF1, 0x8F, 0xFE, 0x3F,
+    0xF9, 0x8F, 0xFE, 0x7F, 0xFF, 0x8F, 0xFE, 0x7F, 0xFF, 0xC3, 0xF8, 0x7F,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFE, 0x1F, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xC0, 0xC0, 0x7F, 0xFF, 0xC7, 0xF8, 0x7F, 0xFF, 0x8F, 0xFC, 0x7F,
+    0xFF, 0x8F, 0xFE, 0x3F, 0xF1, 0x8F, 0xFE, 0x3F, 0xE3, 0x8F, 0xFE, 0x3F,
+    0x83, 0x8F, 0xFE, 0x7F, 0x87, 0x8F, 0xFE, 0x7F, 0x8F, 0xC3, 0xF8, 0x7F,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFE, 0x1F, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFB, 0x81, 0x80, 0xFF, 0xF3, 0x8F, 0xF0, 0xFF, 0xC3, 0x1F, 0xF8, 0xFF,
+    0x87, 0x1F, 0xFC, 0x7F, 0x0F, 0x1F, 0xFC, 0x7F, 0x1F, 0x1F, 0xFC, 0x7F,
+    0x0F, 0x1F, 0xFC, 0xFF, 0xC3, 0x1F, 0xFC, 0xFF, 0xE3, 0x87, 0xF0, 0xFF,
+    0xFB, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xFC, 0x3F, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xC7, 0x81, 0x80, 0xFF, 0x87, 0x8F, 0xF0, 0xFF, 0x8F, 0x1F, 0xF8, 0xFF,
+    0x8F, 0x1F, 0xFC, 0x7F, 0x8F, 0x1F, 0xFC, 0x7F, 0xC7, 0x1F, 0xFC, 0x7F,
+    0xE3, 0x1F, 0xFC, 0xFF, 0xC7, 0x1F, 0xFC, 0xFF, 0x87, 0x87, 0xF0, 0xFF,
+    0xCF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xFC, 0x3F, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0x8F, 0x03, 0x01,
+    0x8F, 0x1F, 0xE1, 0x8E, 0x3F, 0xF1, 0xDE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8,
+    0xFE, 0x3F, 0xF8, 0x8E, 0x3F, 0xF9, 0x8E, 0x3F, 0xF9, 0x8F, 0x0F, 0xE1,
+    0x8F, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8, 0x7F,
+    // 0xF7 '÷'
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0x9C, 0xEF, 0x0C, 0xC7,
+    0x0C, 0xC3, 0x1C, 0xC7, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x0C, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+    0x83, 0xC0, 0xFF, 0x8F, 0xC0, 0xFF, 0x1F, 0x88, 0xFF, 0x1F, 0x1C, 0x7F,
+    0x3E, 0x3C, 0x7F, 0x1C, 0x7C, 0x7F, 0x18, 0xFC, 0xFF, 0x11, 0xFC, 0xFF,
+    0x83, 0xF8, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFF,
+    0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x7F,
+    0x07, 0xFF, 0xFC, 0x7F, 0x87, 0xFF, 0xFE, 0x3F, 0xC3, 0xFF, 0xFE, 0x3F,
+    0xF1, 0xFF, 0xFE, 0x7F, 0xF9, 0xFF, 0xFE, 0x7F, 0xFF, 0xCF, 0xFC, 0x7F,
+    0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xF9, 0xFF, 0xFE, 0x3F,
+    0xE1, 0xFF, 0xFE, 0x7F, 0xC3, 0xFF, 0xFE, 0x7F, 0x87, 0xCF, 0xFC, 0x7F,
+    0x8F, 0xCF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0xFF,
+    0xE3, 0xFF, 0xF8, 0xFF, 0x87, 0xFF, 0xFC, 0x7F, 0x0F, 0xFF, 0xFC, 0x7F,
+    0x1F, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF, 0x87, 0x9F, 0xF8, 0xFF,
+    0xE3, 0x9F, 0xF1, 0xFF, 0xF3, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFC 'ü'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x00, 0x07,
+    0x8E, 0x00, 0x03, 0x8E, 0x00, 0x01, 0x8F, 0xFF, 0xF1, 0x8F, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xDF, 0xFF, 0xF9, 0x8F, 0x3F, 0xF1,
+    0x8F, 0x3F, 0xE3, 0x8E, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF9, 0x9F, 0xFF, 0xFF, 0xF9,
+    0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0xC7, 0xF8, 0xF1, 0xFF, 0x8F, 0xFC, 0xF9, 0xFF, 0x9F, 0xFC, 0xF9,
+    0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0x7F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0x1F, 0xFF, 0xE3,
+    0xDF, 0x07, 0xFF, 0xE3, 0x8F, 0x00, 0xFF, 0xE3, 0x8F, 0x00, 0x3F, 0xC3,
+    0x8F, 0x30, 0x0F, 0x87, 0xFF, 0x7E, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0x8F, 0xFF, 0x81, 0xFF, 0x8F, 0x7C, 0x07, 0xFF,
+    0x8F, 0x30, 0x3F, 0xFF, 0x8F, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x13, 0xFF,
+    0xFF, 0xC0, 0x73, 0xFF, 0xFE, 0x00, 0xF3, 0xFF, 0xF8, 0x18, 0xFF, 0xFF,
+    0xC0, 0x78, 0xFF, 0xFF, 0x83, 0xF8, 0xFF, 0xFF, 0x83, 0xF8, 0xFF, 0xFF,
+    0x80, 0x78, 0xFF, 0xFF, 0xE0, 0x08, 0xFB, 0xFF, 0xF8, 0x00, 0xF3, 0x1F,
+    0xFF, 0x00, 0x32, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x8F,
+    0xFF, 0xFF, 0x01, 0xCF, 0xFF, 0xFF, 0xE3, 0xCF, 0xFF, 0xFF, 0xF3, 0xCF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xE7, 0xFF, 0xE7, 0x81, 0xFF, 0xC7, 0x80, 0xFF, 0x87, 0x00, 0xFF,
+    0x9F, 0x3C, 0x7F, 0x1F, 0x3C, 0xFF, 0x3E, 0x3C, 0xFF, 0x3E, 0x3C, 0xFF,
+    0x1E, 0x39, 0xFF, 0x00, 0x01, 0xC7, 0x80, 0x00, 0x83, 0xC0, 0x00, 0x03,
+    0xFF, 0xF8, 0x73, 0xFF, 0xFC, 0xF3, 0xFF, 0xFC, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC3, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0x07,
+    0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x1F, 0xFF, 0xC7, 0xF3, 0x1F, 0xFF, 0xC7,
+    0xE3, 0x3F, 0xFF, 0xC7, 0xC7, 0x3F, 0xFF, 0xC3, 0xC7, 0x3F, 0xFF, 0xE7,
+    0x8F, 0x1F, 0xFF, 0xC7, 0x8F, 0x07, 0xFF, 0xC7, 0xFF, 0x01, 0xFF, 0xC7,
+    0xFF, 0x03, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    // 0x107 'ć'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xE1, 0xE0, 0x7F, 0xFF, 0xC7, 0xF8, 0x7F, 0xFF, 0xCF, 0xFC, 0x7F,
+    0xF9, 0x8F, 0xFC, 0x7F, 0xE1, 0x8F, 0xFE, 0x3F, 0xC3, 0x8F, 0xFE, 0x3F,
+    0x87, 0x8F, 0xFE, 0x7F, 0x8F, 0x83, 0xFE, 0x7F, 0xDF, 0xC1, 0xFC, 0x7F,
+    0xFF, 0xE3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC3, 0xFE, 0x0F, 0x1F, 0x87, 0xFF, 0x07,
+    0x8F, 0x8F, 0xFF, 0x87, 0xC7, 0x1F, 0xFF, 0xC7, 0xC3, 0x1F, 0xFF, 0xC7,
+    0xE3, 0x3F, 0xFF, 0xC7, 0xE3, 0x3F, 0xFF, 0xC3, 0xC3, 0x3F, 0xFF, 0xE7,
+    0x8F, 0x1F, 0xFF, 0xC7, 0x1F, 0x07, 0xFF, 0xC7, 0x3F, 0x01, 0xFF, 0xC7,
+    0xFF, 0x03, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    // 0x10D 'č'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0x8F, 0xE1, 0xE0, 0x7F, 0x87, 0xC7, 0xF8, 0x7F, 0xC3, 0xCF, 0xFC, 0x7F,
+    0xF1, 0x8F, 0xFC, 0x7F, 0xF1, 0x8F, 0xFE, 0x3F, 0xE1, 0x8F, 0xFE, 0x3F,
+    0xC7, 0x8F, 0xFE, 0x7F, 0x8F, 0x83, 0xFE, 0x7F, 0x9F, 0xC1, 0xFC, 0x7F,
+    0xFF, 0xE3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xBF, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x07,
+    0xC7, 0x3F, 0xFF, 0xE7, 0xC3, 0x3F, 0xFF, 0xE7, 0xE3, 0x3F, 0xFF, 0xE7,
+    0xE3, 0x3F, 0xFF, 0xE7, 0xC7, 0x1F, 0xFF, 0xE7, 0x8F, 0x1F, 0xFF, 0xC7,
+    0x1F, 0x1F, 0xFF, 0xC7, 0x3F, 0x0F, 0xFF, 0xCF, 0xFF, 0x8F, 0xFF, 0x8F,
+    0xFF, 0x83, 0xFE, 0x1F, 0xFF, 0xC0, 0x70, 0x1F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0x81, 0x80, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF,
+    0xFF, 0x1F, 0xFC, 0x7F, 0xFF, 0x1F, 0xFC, 0xFF, 0xDF, 0x1F, 0xFC, 0xFF,
+    0x9F, 0x1F, 0xF8, 0xFF, 0x9F, 0x1F, 0xF9, 0xFF, 0x80, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0x1F, 0x8F, 0xE7, 0xFF, 0x1F, 0x8F, 0xE7, 0xFF, 0x1F, 0x8F, 0xE7, 0xFF,
+    0x1F, 0x8F, 0xE6, 0x3F, 0x1F, 0x8F, 0xE4, 0x1F, 0x1F, 0x8F, 0xE0, 0x1F,
+    0x1F, 0x8F, 0xE1, 0x1F, 0x1F, 0x8F, 0xC3, 0x9F, 0x03, 0xFF, 0x87, 0x9F,
+    0x07, 0xFE, 0x07, 0xBF, 0xFF, 0xFE, 0x1F, 0xFF,
+    // 0x119 'ę'
+    0xFC, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x60, 0xFF,
+    0x9C, 0x70, 0xFF, 0x1C, 0x78, 0xFF, 0x3C, 0x7C, 0xFF, 0x3C, 0x7C, 0x07,
+    0x1C, 0x7C, 0x03, 0x1C, 0x7C, 0x03, 0x80, 0x7C, 0x73, 0x80, 0x78, 0xF3,
+    0xC0, 0x79, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xBF, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x07,
+    0xC7, 0x1F, 0x8F, 0xE7, 0xE3, 0x1F, 0x8F, 0xE7, 0xE3, 0x1F, 0x8F, 0xE7,
+    0xC3, 0x1F, 0x8F, 0xE7, 0x87, 0x1F, 0x8F, 0xE7, 0x8F, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x1F, 0x8F, 0xE7, 0xBF, 0x1F, 0x8F, 0xC7, 0xFF, 0x03, 0xFF, 0x87,
+    0xFF, 0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
+    // 0x11B 'ě'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 0xFF,
+    0x8F, 0xC0, 0x30, 0x7F, 0x87, 0xCE, 0x38, 0x7F, 0xE3, 0x8E, 0x3C, 0x7F,
+    0xF1, 0x9E, 0x3E, 0x7F, 0xF1, 0x9E, 0x3E, 0x3F, 0xE1, 0x8E, 0x3E, 0x7F,
+    0x87, 0x8E, 0x3E, 0x7F, 0x8F, 0xC0, 0x3E, 0x7F, 0xBF, 0xC0, 0x3C, 0x7F,
+    0xFF, 0xE0, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xF3, 0x3F, 0xFF, 0xE7,
+    0xE3, 0x00, 0x00, 0x07, 0xE7, 0x00, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x07,
+    0x87, 0x1F, 0xFF, 0xE7, 0x8F, 0x3F, 0xFF, 0xE7, 0x8F, 0x3F, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xF3, 0xBF, 0xFF, 0xF9, 0xE3, 0x3F, 0xFF, 0xF9,
+    0xE7, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x01,
+    0x87, 0xFF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xF9, 0xDF, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xE7, 0xFF, 0xFE, 0xE7, 0xFF, 0xFC, 0xE7, 0xFF, 0xFC, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE3, 0xFF, 0xFC, 0xE7, 0xFF, 0xFC,
+    0xE7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xF0, 0xFF, 0xFC,
+    0x80, 0xFF, 0xFC, 0x83, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC3,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xFE, 0xDF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
+    0xFF, 0xFF, 0xFC, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x3F, 0xE3, 0xF7, 0x3F, 0xE7, 0xE7,
+    0x3F, 0xC7, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x1F, 0xE7, 0x3F, 0x3F, 0xE7, 0x3F, 0x3F, 0xE7, 0xFE, 0x7F, 0xE7,
+    0xFE, 0x7F, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0xDF, 0xFC, 0xFC, 0x9F, 0xF8, 0xFC,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xC7, 0xF8,
+    0xFF, 0xCF, 0xFC, 0xFF, 0x9F, 0xFC, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x83, 0xFF, 0xE7, 0xFF, 0xC0, 0xFF, 0xE7, 0xF3, 0xF0, 0x7F, 0xFF,
+    0xE3, 0xF8, 0x3F, 0xFF, 0xE7, 0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
+    0x87, 0xFF, 0x81, 0xFF, 0x8F, 0xFF, 0xE0, 0xFF, 0x8F, 0xBF, 0xF0, 0x3F,
+    0xFF, 0x3F, 0xFC, 0x1F, 0xFF, 0x3F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F,
+    0xFF, 0xC7, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE7, 0xFE, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F,
+    0xF9, 0x8F, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF, 0xFF, 0xC3, 0x8F, 0xFF, 0xFF,
+    0x87, 0x8F, 0xFE, 0x7F, 0x8F, 0x87, 0xFE, 0x7F, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x147 'Ň'
+    0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xBF, 0x00, 0x00, 0x07,
+    0x1F, 0x83, 0xFF, 0xE7, 0x8F, 0xC0, 0xFF, 0xE7, 0xC7, 0xF0, 0x7F, 0xFF,
+    0xE3, 0xF8, 0x3F, 0xFF, 0xE3, 0xFE, 0x0F, 0xFF, 0xE3, 0xFF, 0x07, 0xFF,
+    0xC7, 0xFF, 0x81, 0xFF, 0x8F, 0xFF, 0xE0, 0xFF, 0x1F, 0xBF, 0xF0, 0x3F,
+    0x3F, 0x3F, 0xFC, 0x1F, 0xFF, 0x3F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x7F, 0xFF, 0xCF, 0xFE, 0x7F,
+    0xFF, 0xC7, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x9F, 0x80, 0x00, 0x7F,
+    0x8F, 0xE0, 0x00, 0x7F, 0x87, 0xE7, 0xFE, 0x7F, 0xE3, 0xCF, 0xFE, 0x7F,
+    0xF1, 0x8F, 0xFF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF, 0xFF,
+    0x87, 0x8F, 0xFE, 0x7F, 0x8F, 0x87, 0xFE, 0x7F, 0xBF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+    // 0x152 'Œ'
+    0xFF, 0x87, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC1, 0xFE, 0x0F, 0x87, 0xFF, 0x0F, 0x8F, 0xFF, 0x87, 0x9F, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7,
+    0x3F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7,
+    0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xC7,
+    0x03, 0xFF, 0x87, 0x03, 0xFE, 0x07, 0xFF, 0xFE, 0x0F,
+    // 0x153 'œ'
+    0xFC, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x81, 0x80, 0xFF,
+    0x8F, 0xF0, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0xFC, 0x7F, 0x1F, 0xFC, 0x7F,
+    0x1F, 0xFC, 0x7F, 0x1F, 0xFC, 0xFF, 0x8F, 0xF8, 0xFF, 0x83, 0xE1, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x84, 0x60, 0xFF,
+    0x9C, 0x78, 0xFF, 0x1C, 0x78, 0xFF, 0x3C, 0x7C, 0xFF, 0x1C, 0x7C, 0x7F,
+    0x1C, 0x7C, 0xFF, 0x0C, 0x7C, 0xFF, 0x80, 0x7C, 0xFF, 0xC0, 0x78, 0xFF,
+    0xE0, 0x79, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xBF, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0xE7, 0xBF, 0x3F, 0xFF, 0xE7,
+    0x1F, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x07,
+    0xE3, 0x3F, 0xCF, 0xE7, 0xE3, 0x3F, 0xCF, 0xE7, 0xE3, 0x3F, 0xC7, 0xE7,
+    0xC7, 0x3F, 0xC1, 0xFF, 0x8F, 0x1F, 0x80, 0xFF, 0x1F, 0x1F, 0x90, 0x7F,
+    0x3F, 0x06, 0x1C, 0x1F, 0xFF, 0x80, 0x3E, 0x0F, 0xFF, 0xC0, 0x7F, 0x07,
+    0xFF, 0xE0, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF7,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0x9F, 0xCF, 0xFE, 0x7F,
+    0x8F, 0xC7, 0xFC, 0x7F, 0xC3, 0x80, 0x00, 0x7F, 0xE1, 0x80, 0x00, 0x7F,
+    0xF1, 0xF0, 0x00, 0x7F, 0xE1, 0xE3, 0xFE, 0x7F, 0xC3, 0xC7, 0xFE, 0x7F,
+    0x87, 0xCF, 0xFE, 0x7F, 0x9F, 0x8F, 0xFF, 0xFF, 0xBF, 0x87, 0xFF, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xFC, 0x07, 0xFF, 0xC0, 0x7C, 0x07,
+    0xFF, 0x80, 0x3F, 0x87, 0xFF, 0x0C, 0x1F, 0xE7, 0xF3, 0x1E, 0x1F, 0xE3,
+    0xE3, 0x3F, 0x0F, 0xE3, 0xE7, 0x3F, 0x8F, 0xE3, 0xC7, 0x3F, 0x87, 0xE7,
+    0x87, 0x3F, 0xC3, 0xC7, 0x8F, 0x1F, 0xC1, 0x87, 0x9F, 0x03, 0xE0, 0x0F,
+    0xFF, 0x83, 0xF0, 0x1F, 0xFF, 0x8F, 0xF8, 0x3F,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x7F, 0xFF, 0xE0, 0x70, 0x7F,
+    0xFF, 0xC0, 0x3C, 0x7F, 0xFF, 0x8C, 0x3E, 0x7F, 0xF9, 0x9E, 0x1E, 0x3F,
+    0xE1, 0x9E, 0x1E, 0x3F, 0xC3, 0x9F, 0x1E, 0x7F, 0x87, 0x8F, 0x0E, 0x7F,
+    0x8F, 0x83, 0x80, 0x7F, 0xFF, 0xC3, 0x80, 0xFF, 0xFF, 0xEF, 0xE1, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xFC, 0x07, 0xBF, 0xC0, 0x7C, 0x07,
+    0x0F, 0x80, 0x3F, 0x87, 0x87, 0x0C, 0x1F, 0xE7, 0xC7, 0x1E, 0x1F, 0xE3,
+    0xE3, 0x3F, 0x0F, 0xE3, 0xE3, 0x3F, 0x8F, 0xE3, 0xC3, 0x3F, 0x87, 0xE7,
+    0x87, 0x3F, 0xC3, 0xC7, 0x8F, 0x1F, 0xC1, 0x87, 0x1F, 0x03, 0xE0, 0x0F,
+    0xBF, 0x83, 0xF0, 0x1F, 0xFF, 0x8F, 0xF8, 0x3F,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF0, 0xF0, 0x7F, 0x8F, 0xE0, 0x70, 0x7F,
+    0x87, 0xC0, 0x3C, 0x7F, 0xE3, 0x8C, 0x3E, 0x7F, 0xF1, 0x9E, 0x1E, 0x3F,
+    0xF1, 0x9E, 0x1E, 0x3F, 0xE1, 0x9F, 0x1E, 0x7F, 0xC7, 0x8F, 0x0E, 0x7F,
+    0x8F, 0x83, 0x80, 0x7F, 0xBF, 0xC3, 0x80, 0xFF, 0xFF, 0xEF, 0xE1, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xF7, 0x8F, 0x1F, 0xFF, 0xE7,
+    0x87, 0x1F, 0xFF, 0xE7, 0xC3, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07,
+    0xE3, 0x00, 0x00, 0x07, 0xC3, 0x00, 0x00, 0x07, 0x8F, 0x1F, 0xFF, 0xE7,
+    0x1F, 0x1F, 0xFF, 0xE7, 0x3F, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0x9F, 0xF8, 0x7F, 0xFF, 0x9F, 0xFC, 0x7F, 0x01, 0x9F, 0xFC, 0xFF,
+    0x03, 0x9F, 0xFC, 0xFF, 0x9F, 0x9F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x9F, 0xFF, 0xC3, 0xC3, 0x9F, 0xFF, 0xE3,
+    0x81, 0xFF, 0xFF, 0xE3, 0x98, 0xFF, 0xFF, 0xF3, 0x3C, 0xFF, 0xFF, 0xF1,
+    0x1C, 0xFF, 0xFF, 0xF3, 0x81, 0xFF, 0xFF, 0xF3, 0x81, 0xFF, 0xFF, 0xE3,
+    0xE7, 0x9F, 0xFF, 0xE3, 0xFF, 0x9F, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xE7, 0x80, 0x00, 0x7F,
+    0x81, 0xFF, 0xFC, 0x7F, 0x80, 0xFF, 0xFE, 0x3F, 0x3C, 0xFF, 0xFE, 0x3F,
+    0x3C, 0xFF, 0xFE, 0x7F, 0x18, 0xFF, 0xFE, 0x7F, 0x81, 0xCF, 0xFC, 0x7F,
+    0xC3, 0xCF, 0xF8, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xF9, 0x9F, 0xFF, 0xC3, 0xF1, 0x9F, 0xFF, 0xE3,
+    0xE3, 0xFF, 0xFF, 0xE3, 0xC3, 0xFF, 0xFF, 0xF3, 0x87, 0xFF, 0xFF, 0xF1,
+    0x8F, 0xFF, 0xFF, 0xF3, 0xDF, 0xFF, 0xFF, 0xF3, 0xF9, 0xFF, 0xFF, 0xE3,
+    0xF1, 0x9F, 0xFF, 0xE3, 0xE3, 0x9F, 0xFF, 0x87, 0xC3, 0x80, 0x00, 0x07,
+    0x87, 0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
+    0xF1, 0xFF, 0xFC, 0x7F, 0xC1, 0xFF, 0xFE, 0x3F, 0x83, 0xFF, 0xFE, 0x3F,
+    0x8F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xF1, 0xCF, 0xFC, 0x7F,
+    0xC1, 0xCF, 0xF8, 0xFF, 0x83, 0x80, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x7F,
+    0xDF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x178 'Ÿ'
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x8E, 0x03, 0xFF, 0xEF,
+    0x8E, 0x00, 0xFF, 0xCF, 0x8E, 0x70, 0x3F, 0xCF, 0x9E, 0x78, 0x1F, 0xCF,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xDF, 0xFF, 0x00, 0x0F,
+    0x8F, 0xFC, 0x1F, 0xCF, 0x8E, 0x70, 0x7F, 0xCF, 0x8E, 0x40, 0xFF, 0xCF,
+    0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x03, 0xFF, 0x87, 0xFF, 0x03, 0xFE, 0x07,
+    0xFF, 0x1F, 0xFC, 0x07, 0xFF, 0x1F, 0xF0, 0x27, 0xF3, 0x1F, 0xE0, 0xE7,
+    0xF3, 0x1F, 0xC1, 0xE7, 0xE7, 0x1F, 0x07, 0xE7, 0xC7, 0x1E, 0x0F, 0xE7,
+    0x87, 0x18, 0x1F, 0xE7, 0x8F, 0x10, 0x7F, 0xE7, 0x8F, 0x00, 0xFF, 0xC7,
+    0xFF, 0x03, 0xFF, 0xC7, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x1F, 0xFE, 0x07,
+    0xFF, 0xFF, 0xFE, 0x1F,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x7F, 0xFF, 0xC1, 0xF8, 0x7F,
+    0xFF, 0xC7, 0xF0, 0x7F, 0xFF, 0xCF, 0xE0, 0x7F, 0xFF, 0xCF, 0x82, 0x7F,
+    0xF9, 0xCF, 0x06, 0x7F, 0xF1, 0xCE, 0x1E, 0x7F, 0xC3, 0xCC, 0x3E, 0x7F,
+    0x87, 0xC0, 0x7E, 0x7F, 0x8F, 0xC1, 0xFE, 0x7F, 0xDF, 0xC3, 0xFC, 0x7F,
+    0xFF, 0xC7, 0xF0, 0x7F, 0xFF, 0xCF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFE, 0x07, 0xFF, 0x0F, 0xFE, 0x07, 0xFC, 0x0F,
+    0xFE, 0x3F, 0xF8, 0x0F, 0xFE, 0x3F, 0xE0, 0x4F, 0xFE, 0x3F, 0xC1, 0xCF,
+    0x0E, 0x3F, 0x83, 0xCF, 0x0E, 0x3E, 0x0F, 0xCF, 0x0E, 0x3C, 0x1F, 0xCF,
+    0x9E, 0x30, 0x3F, 0xCF, 0xFE, 0x20, 0xFF, 0xCF, 0xFE, 0x01, 0xFF, 0x8F,
+    0xFE, 0x07, 0xFF, 0x8F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x3F, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xFC, 0x3F,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0x07, 0xE1, 0xFF, 0x1F, 0xC1,
+    0xFF, 0x3F, 0x81, 0xFF, 0x3E, 0x09, 0x8F, 0x3C, 0x19, 0x0F, 0x38, 0x79,
+    0x0F, 0x30, 0xF9, 0x9F, 0x01, 0xF9, 0xFF, 0x07, 0xF9, 0xFF, 0x0F, 0xF1,
+    0xFF, 0x1F, 0xC1, 0xFF, 0x3F, 0xC1, 0xFF, 0xFF, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x03, 0xFF, 0x87, 0xBF, 0x03, 0xFE, 0x07,
+    0x1F, 0x1F, 0xFC, 0x07, 0x8F, 0x1F, 0xF0, 0x27, 0xC7, 0x1F, 0xE0, 0xE7,
+    0xE3, 0x1F, 0xC1, 0xE7, 0xE3, 0x1F, 0x07, 0xE7, 0xE3, 0x1E, 0x0F, 0xE7,
+    0xC7, 0x18, 0x1F, 0xE7, 0x8F, 0x10, 0x7F, 0xE7, 0x1F, 0x00, 0xFF, 0xC7,
+    0x3F, 0x03, 0xFF, 0xC7, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x1F, 0xFE, 0x07,
+    0xFF, 0xFF, 0xFE, 0x1F,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0x7F, 0xFF, 0xC1, 0xF8, 0x7F,
+    0x9F, 0xC7, 0xF0, 0x7F, 0x87, 0xCF, 0xE0, 0x7F, 0xC3, 0xCF, 0x82, 0x7F,
+    0xE1, 0xCF, 0x06, 0x7F, 0xF1, 0xCE, 0x1E, 0x7F, 0xE1, 0xCC, 0x3E, 0x7F,
+    0xC3, 0xC0, 0x7E, 0x7F, 0x8F, 0xC1, 0xFE, 0x7F, 0x9F, 0xC3, 0xFC, 0x7F,
+    0xFF, 0xC7, 0xF0, 0x7F, 0xFF, 0xCF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xF0, 0xFF, 0x9C, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x03, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x80, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x9F, 0xF8, 0xFF,
+    0x1F, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFE, 0x00, 0x03,
+    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC7, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0x07, 0x9F, 0xFF, 0x03, 0x9F, 0xDF, 0xC3,
+    0x9F, 0x8F, 0xE3, 0x8E, 0x0F, 0xF1, 0x88, 0x07, 0xF1, 0x80, 0xC7, 0xF1,
+    0x81, 0xE3, 0xF3, 0xC7, 0xE1, 0xE3, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x7F,
+    // 0x2013 '–'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F,
+    // 0x2014 '—'
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    // 0x2018 '‘'
+    0xFC, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x9F, 0x7F, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xFF, 0x3F, 0x8C, 0x3F, 0x80, 0x7F, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xFF, 0x7F, 0x88, 0x7F, 0x00, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201B '‛'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xFC, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x9F, 0x7F, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x9F, 0x7F, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xFF, 0x3F, 0x8C, 0x3F, 0x80, 0x7F, 0x81, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x8C, 0x3F, 0x80, 0x7F, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xFF, 0x7F, 0x88, 0x7F, 0x00, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x88, 0x7F, 0x00, 0xFF, 0x81, 0xFF, 0xC7, 0xFF,
+    // 0x201F '‟'
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xC7, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xFE, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFC, 0x7F, 0xFF,
+    // 0x2021 '‡'
+    0xFC, 0x7E, 0x3F, 0xFC, 0x7E, 0x3F, 0xFC, 0x7E, 0x3F, 0xFC, 0x7F, 0x3F,
+    0xFE, 0x7F, 0x3F, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01,
+    0xFE, 0x7F, 0x3F, 0xFC, 0x7F, 0x3F, 0xFC, 0x7E, 0x3F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x3F,
+    // 0x2022 '•'
+    0xCF, 0x83, 0x03, 0x03, 0x03, 0x83, 0xCF,
+    // 0x2026 '…'
+    0xFF, 0x8F, 0x0F, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x0F, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0F, 0x0F,
+    0x8F, 0xFF,
+    // 0x2039 '‹'
+    0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC2, 0x3F, 0xC7, 0x1F, 0x8F, 0x8F,
+    0xBF, 0xCF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0x9F, 0xCF, 0x8F, 0x9F, 0xC6, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x2070 '⁰'
+    0xF0, 0x1F, 0xC0, 0x07, 0x80, 0x03, 0x8F, 0xE3, 0x1F, 0xF3, 0x1F, 0xF3,
+    0x1F, 0xF3, 0x1F, 0xE3, 0x87, 0x87, 0x80, 0x07, 0xE0, 0x1F, 0xFF, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0x9F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x9F, 0xE1, 0x9F, 0xC3, 0x9F,
+    0x87, 0x8F, 0x00, 0x03, 0x00, 0x03, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xE1, 0xF3, 0x81, 0xF3, 0x81, 0xF3, 0x99, 0xF3,
+    0x98, 0xE3, 0x9C, 0x07, 0x9C, 0x0F, 0xBE, 0x1F,
+    // 0x2076 '⁶'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x83, 0xC1, 0xE3, 0x89, 0xF3,
+    0x99, 0xF3, 0x18, 0xF3, 0x3C, 0x03, 0x3C, 0x07, 0xFF, 0x0F,
+    // 0x2077 '⁷'
+    0xEF, 0xFF, 0x87, 0xFF, 0x9F, 0xF7, 0x9F, 0x83, 0x9E, 0x03, 0x98, 0x1F,
+    0x90, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x9F, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xFF, 0xE7, 0x87, 0xC3, 0x03, 0x80, 0x23, 0x18, 0x73, 0x3C, 0xF3,
+    0x3C, 0x73, 0x18, 0x73, 0x82, 0x03, 0xC3, 0x07, 0xFF, 0x9F,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xC1, 0xFB, 0x80, 0xF3, 0x80, 0x73, 0x1E, 0x73, 0x3E, 0x63,
+    0x1E, 0x47, 0x9E, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xF0, 0xFF,
+    // 0x2080 '₀'
+    0xF0, 0x1F, 0xC0, 0x07, 0x80, 0x03, 0x8F, 0xE3, 0x9F, 0xF3, 0x1F, 0xF3,
+    0x1F, 0xF3, 0x1F, 0xE3, 0x87, 0x83, 0x80, 0x07, 0xE0, 0x1F, 0xFF, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xCF, 0xF3, 0xCF, 0xF3, 0x8F, 0xF3, 0x80, 0x03, 0x00, 0x03,
+    0xBF, 0xF3, 0xFF, 0xF3, 0xFF, 0xF3,
+    // 0x2082 '₂'
+    0xE7, 0xE3, 0xC7, 0xE3, 0x87, 0xC3, 0x9F, 0x83, 0x1F, 0x13, 0x1E, 0x33,
+    0x08, 0x73, 0x80, 0xF3, 0xC1, 0xF3, 0xFF, 0xF3,
+    // 0x2083 '₃'
+    0xCF, 0xF3, 0x8F, 0xF3, 0x9C, 0xF3, 0x1C, 0xF3, 0x3C, 0xF3, 0x18, 0xE3,
+    0x80, 0x07, 0x82, 0x07, 0xC7, 0x0F, 0xFF, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0x9F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x9F, 0xE1, 0x9F, 0xC3, 0x9F,
+    0x87, 0x8F, 0x80, 0x03, 0x00, 0x03, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xE1, 0xF3, 0x81, 0xF3, 0x81, 0xF3, 0x99, 0xF3,
+    0x98, 0xE3, 0x9C, 0x07, 0x9C, 0x07, 0x9E, 0x1F,
+    // 0x2086 '₆'
+    0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x83, 0xC1, 0xF3, 0x89, 0xF3,
+    0x98, 0xF3, 0x18, 0xF3, 0x3C, 0x03, 0xBE, 0x07, 0xFF, 0x0F,
+    // 0x2087 '₇'
+    0xEF, 0xFF, 0x87, 0xFF, 0x8F, 0xF7, 0x9F, 0x83, 0x9E, 0x03, 0x98, 0x1F,
+    0x90, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x9F, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0xFF, 0xE7, 0x87, 0xC3, 0x03, 0x80, 0x23, 0x98, 0x73, 0x3C, 0xF3,
+    0x3C, 0x73, 0x18, 0x73, 0x80, 0x03, 0xC3, 0x07, 0xFF, 0x9F,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xE1, 0xFB, 0x80, 0xFB, 0x80, 0x73, 0x1E, 0x73, 0x1E, 0x23,
+    0x1E, 0x63, 0x9E, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xF0, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x20, 0x0F, 0xC3, 0x33, 0x0F,
+    0x87, 0x33, 0x87, 0x8F, 0x23, 0xC7, 0x1F, 0x23, 0xC7, 0x1F, 0x27, 0xE3,
+    0x1F, 0x3F, 0xE3, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x03, 0xFF, 0xC7,
+    0x83, 0xFF, 0xC7, 0x87, 0xFF, 0xDF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0x1F, 0xFF, 0x1F, 0xFF, 0x3F, 0xBF, 0x3F, 0xBF, 0x00, 0x3F, 0x00, 0x3F,
+    0x3F, 0xBF, 0x3F, 0xFF, 0x1F, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0x3C, 0x3F,
+    0x00, 0x3F, 0x0F, 0xBF, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0xFF, 0xE1, 0xFF,
+    0x87, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x7F, 0x3F, 0xFF, 0xBF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF,
+    0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFD,
+    0xFF, 0xF9, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xCF, 0xF3,
+    0x9F, 0x8F, 0xF3, 0xFF, 0x9C, 0xF1, 0xFF, 0x9C, 0xF3, 0xFF, 0x1C, 0xF3,
+    0xFF, 0x98, 0xE3, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x07, 0xFF, 0xCF, 0x0F,
+    // 0x2154 '⅔'
+    0xE3, 0xF3, 0xFF, 0xC3, 0xE1, 0xFF, 0xC3, 0xC1, 0xFF, 0x8F, 0xC1, 0xFF,
+    0x9F, 0x91, 0xFF, 0x9F, 0x11, 0xFF, 0x80, 0x31, 0xFF, 0xC0, 0x71, 0xFD,
+    0xC1, 0xF1, 0xF0, 0xFF, 0xF3, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xCF, 0xF3,
+    0x8F, 0x8F, 0xF3, 0xBF, 0x9C, 0xF1, 0xFF, 0x9C, 0xF3, 0xFF, 0x1C, 0xF3,
+    0xFF, 0x98, 0xE3, 0xFF, 0x80, 0x07, 0xFF, 0x82, 0x07, 0xFF, 0xCF, 0x0F,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF,
+    0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFD,
+    0xFF, 0xF9, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xE7, 0x87,
+    0x9F, 0xC1, 0x03, 0xBF, 0x80, 0x33, 0xFF, 0x98, 0x73, 0xFF, 0x3C, 0xF9,
+    0xFF, 0x1C, 0x73, 0xFF, 0x98, 0x33, 0xFF, 0x80, 0x03, 0xFF, 0xC3, 0x07,
+    0xFF, 0xFF, 0xDF,
+    // 0x215C '⅜'
+    0xE7, 0xF9, 0xFF, 0xC7, 0xF9, 0xFF, 0xCE, 0x79, 0xFF, 0x9E, 0x79, 0xFF,
+    0x9C, 0x79, 0xFF, 0x9C, 0x71, 0xFF, 0x80, 0x03, 0xFF, 0xC1, 0x03, 0xF9,
+    0xE3, 0x8F, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F, 0xE7, 0x87,
+    0xBF, 0xC1, 0x03, 0xFF, 0x80, 0x33, 0xFF, 0x98, 0x73, 0xFF, 0x3C, 0xF9,
+    0xFF, 0x1C, 0x73, 0xFF, 0x98, 0x33, 0xFF, 0x80, 0x03, 0xFF, 0xC3, 0x07,
+    0xFF, 0xFF, 0xDF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF0, 0xF9, 0xFF, 0x80, 0xF9, 0xFF,
+    0x80, 0xF9, 0xFF, 0x8C, 0xF9, 0xFF, 0x8C, 0x71, 0xFF, 0x8C, 0x03, 0xFF,
+    0x8E, 0x07, 0xF8, 0xDF, 0x0F, 0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x0F, 0xE7, 0x87, 0xBF, 0xC1, 0x03, 0xFF, 0x80, 0x33, 0xFF, 0x98, 0x73,
+    0xFF, 0x3C, 0xF9, 0xFF, 0x1C, 0x73, 0xFF, 0x98, 0x33, 0xFF, 0x80, 0x03,
+    0xFF, 0xC3, 0x07, 0xFF, 0xFF, 0xDF,
+    // 0x215E '⅞'
+    0xF7, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0x8F, 0xC1, 0xFF,
+    0x8F, 0x01, 0xFF, 0x8C, 0x0F, 0xFD, 0x88, 0x7F, 0xF8, 0x81, 0xFF, 0xE1,
+    0x83, 0xFF, 0x87, 0xCF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xE7, 0x87,
+    0xFF, 0xC1, 0x03, 0xFF, 0x80, 0x33, 0xFF, 0x98, 0x73, 0xFF, 0x3C, 0xF9,
+    0xFF, 0x1C, 0x73, 0xFF, 0x98, 0x33, 0xFF, 0x80, 0x03, 0xFF, 0xC3, 0x07,
+    0xFF, 0xFF, 0xDF,
+    // 0x2190 '←'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC4, 0x9F, 0x8C, 0xCF,
+    0xDC, 0xCF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x2191 '↑'
+    0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x8F, 0xFF, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xDC, 0xCF,
+    0x8C, 0xCF, 0xC4, 0x9F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xFD, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xCC, 0x8F, 0x9C, 0xCF,
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+    0x9C, 0xCF, 0xCC, 0x8F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFD, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFE, 0xFF, 0xF9, 0xFC, 0x7F, 0xF1, 0xFE, 0x3F, 0xE7, 0xFF, 0x3F,
+    0xCF, 0xFF, 0x9F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xCF, 0xFF, 0x9F,
+    0xE7, 0xFF, 0x3F, 0xF1, 0xFE, 0x3F, 0xF9, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF,
+    // 0x21D0 '⇐'
+    0xFD, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE2, 0x3F, 0xC3, 0x1F, 0x83, 0x0F,
+    0x13, 0x27, 0xF3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F,
+    0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xF7, 0x3F,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xF7, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F,
+    0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xE3, 0x3F, 0xF3, 0x3F, 0x13, 0x27,
+    0x83, 0x0F, 0xC3, 0x1F, 0xE2, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF, 0xFD, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF3, 0xFF,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F,
+    0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFC, 0xFF, 0xF8, 0x7F, 0xF2, 0x3F, 0xE3, 0x1F, 0x83, 0x0F, 0x03, 0x07,
+    0xB3, 0x2F, 0xF3, 0x3F, 0xF3, 0x3F, 0xF3, 0x3F, 0xF3, 0x3F, 0xB3, 0x2F,
+    0x03, 0x07, 0x83, 0x0F, 0xE3, 0x1F, 0xF2, 0x3F, 0xF8, 0x7F, 0xFC, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xCF, 0xE0, 0xF0, 0xFF, 0xCF, 0xC7, 0xFC, 0xFF, 0x9F, 0x8F, 0xFC, 0xFF,
+    0x9F, 0x9F, 0xFC, 0xFF, 0x9F, 0x9F, 0xFC, 0xFF, 0x9F, 0x9F, 0xF9, 0xFF,
+    0x8F, 0x9F, 0xE1, 0xFF, 0x87, 0x9F, 0x83, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x03,
+    0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xF3, 0xFE, 0x03, 0xF3, 0xF8, 0x1F, 0xF3,
+    0xC0, 0x7F, 0xF3, 0x83, 0xFF, 0xF3, 0x81, 0xFF, 0xF3, 0x80, 0x3F, 0xF3,
+    0xE0, 0x0F, 0xF3, 0xFC, 0x01, 0xF3, 0xFF, 0x80, 0x33, 0xFF, 0xE0, 0x03,
+    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF3,
+    // 0x220F '∏'
+    0x3F, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFF, 0x3F,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F,
+    0x1F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F,
+    0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0x7F, 0x0F, 0xFF, 0xF8, 0x3F,
+    0x07, 0xFF, 0xF0, 0x3F, 0x01, 0xFF, 0xC0, 0x3F, 0x00, 0xFF, 0x86, 0x3F,
+    0x10, 0x7F, 0x0E, 0x3F, 0x18, 0x1C, 0x1E, 0x3F, 0x1C, 0x08, 0x7E, 0x3F,
+    0x1F, 0x00, 0xFE, 0x3F, 0x1F, 0x81, 0xFE, 0x3F, 0x1F, 0xE7, 0xFE, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x03, 0xFF, 0xF8, 0x3F, 0x03, 0xFF, 0xE0, 0x3F, 0xE7, 0xFF, 0xE0, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xFB, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x9F, 0x3F, 0x9F, 0x3F, 0x9F, 0x3F,
+    0x9F, 0x3F, 0x8E, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xCE, 0x3F,
+    0x9F, 0x3F, 0x9F, 0x3F, 0x9F, 0x3F, 0x8E, 0x3F, 0x80, 0x3F, 0xC0, 0xFF,
+    0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x1F, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xE7, 0x1F, 0xE7, 0x1F, 0xE7, 0x07, 0xE7, 0x07, 0xE7, 0x1F, 0xE4, 0x1F,
+    0xE0, 0x1F, 0xE1, 0x1F, 0xC7, 0x1F, 0x87, 0x1F, 0xA7, 0x1F, 0xE7, 0x1F,
+    0xE7, 0xBF,
+    // 0x2264 '≤'
+    0xFC, 0xFF, 0x3F, 0xF8, 0xFF, 0x3F, 0xF8, 0x7F, 0x3F, 0xF0, 0x7F, 0x3F,
+    0xF2, 0x3F, 0x3F, 0xE3, 0x3F, 0x3F, 0xE7, 0x1F, 0x3F, 0xC7, 0x9F, 0x3F,
+    0xCF, 0x8F, 0x3F, 0x8F, 0xC7, 0x3F, 0x9F, 0xC7, 0x3F, 0x1F, 0xE7, 0x3F,
+    0xFF, 0xFF, 0x3F,
+    // 0x2265 '≥'
+    0x9F, 0xEF, 0x3F, 0x1F, 0xE7, 0x3F, 0x8F, 0xC7, 0x3F, 0x8F, 0xC7, 0x3F,
+    0xC7, 0x8F, 0x3F, 0xE7, 0x8F, 0x3F, 0xE3, 0x1F, 0x3F, 0xF3, 0x1F, 0x3F,
+    0xF1, 0x3F, 0x3F, 0xF8, 0x3F, 0x3F, 0xF8, 0x7F, 0x3F, 0xFC, 0x7F, 0x3F,
+    0xFC, 0xFF, 0x3F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x19, 0xFF, 0x10,
+    0x00, 0x00, 0x0A,
+    // 0x22 '"'
+    0x07, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0x60, 0x3F, 0x00, 0x3F, 0x3C, 0x3F,
+    0x00, 0x3F, 0x80, 0x7F, 0xBC, 0x3F,
+    // 0x23 '#'
+    0x00, 0x0C, 0x1F, 0x00, 0x10, 0x1F, 0x06, 0x10, 0x1F, 0x02, 0x11, 0x5F,
+    0x02, 0x00, 0x3F, 0x01, 0x81, 0x5F, 0x08, 0x00, 0x1F, 0x01, 0x10, 0x1F,
+    0x92, 0x10, 0x1F, 0x82, 0x10, 0x9F, 0x02, 0x10, 0x3F, 0x02, 0x40, 0x9F,
+    0x00, 0x04, 0x1F, 0xC0, 0xD0, 0x1F, 0x8A, 0x10, 0x1F, 0x42, 0x10, 0x1F,
+    0x02, 0x10, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x24 '$'
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x60, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x10, 0x03, 0x00, 0x40, 0x04, 0x03, 0x08, 0x10, 0x04, 0x03,
+    0x00, 0x09, 0xE0, 0xC7, 0x70, 0x00, 0x00, 0x03, 0x80, 0x78, 0x3C, 0x03,
+    0x08, 0x00, 0x04, 0x03, 0x00, 0x00, 0x80, 0x03, 0x08, 0x42, 0x30, 0x03,
+    0x04, 0x00, 0x02, 0x03, 0x02, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x25 '%'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0xA0, 0x00,
+    0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x04, 0x50, 0x14, 0x08,
+    0x44, 0x40, 0x00, 0x00, 0x08, 0x88, 0x18, 0x01, 0x20, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00,
+    0x08, 0x00, 0x00, 0x12, 0x00, 0x00, 0x44, 0x00, 0x20, 0x00, 0x08, 0x12,
+    0x60, 0x50, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE4,
+    0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x80,
+    // 0x26 '&'
+    0x00, 0x01, 0xC1, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x22, 0x05,
+    0x08, 0x88, 0x25, 0x00, 0x00, 0x01, 0x44, 0x00, 0x03, 0x90, 0xC2, 0x03,
+    0x00, 0x10, 0x09, 0xA0, 0x80, 0x0B, 0x80, 0x44, 0x43, 0x0E, 0x82, 0x21,
+    0x00, 0x11, 0x01, 0x40, 0x08, 0x01, 0x00, 0x08, 0x09, 0x00, 0x02, 0x09,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x85, 0x00, 0x08, 0x11, 0x00, 0x20, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,
+    // 0x27 '''
+    0x07, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0x60, 0x3F,
+    // 0x28 '('
+    0x00, 0x18, 0x20, 0x03, 0x00, 0xC0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x08, 0x2F, 0xA0, 0x03, 0x01, 0x80, 0x0C, 0x23, 0x26, 0x00, 0x01, 0x03,
+    0x48, 0x00, 0x00, 0x8B, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x13, 0x90, 0x00, 0x00, 0x23,
+    0x08, 0x00, 0x00, 0x83, 0x02, 0x00, 0x01, 0x03, 0x00, 0x00, 0x0C, 0x43,
+    0x08, 0x17, 0xA0, 0x83, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x03,
+    0x00, 0x10, 0xC0, 0x03,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0x3F, 0x08, 0xBF, 0x29, 0x3F, 0x02, 0x3F, 0xB3, 0xFF,
+    0x8E, 0x3F, 0x89, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x0C, 0x3F,
+    // 0x2B '+'
+    0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x07, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03,
+    // 0x2C ','
+    0x00, 0x3F, 0x01, 0x7F, 0x06, 0x7F, 0x80, 0x3F, 0x01, 0x3F, 0x04, 0x3F,
+    0x50, 0x3F,
+    // 0x2D '-'
+    0x7F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x9F, 0x1F,
+    // 0x2E '.'
+    0x07, 0x47, 0x0F, 0x0F, 0x87, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x30, 0x00, 0x30, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x18, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x80, 0x00, 0x00,
+    // 0x30 '0'
+    0x01, 0x39, 0x03, 0x0C, 0x00, 0x03, 0x10, 0x00, 0x03, 0x20, 0xFC, 0x03,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x27, 0xA0, 0x00, 0x03,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x23, 0x88, 0x00, 0x4B,
+    0x06, 0x02, 0x03, 0x40, 0x00, 0x13, 0x00, 0x00, 0x43, 0x0C, 0x00, 0x83,
+    0x00, 0xF8, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x07, 0x08, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x27, 0x47, 0xFF, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x32 '2'
+    0x06, 0x00, 0x07, 0x00, 0x00, 0x47, 0x40, 0x00, 0x87, 0x00, 0x01, 0x07,
+    0x80, 0x02, 0x07, 0x20, 0x04, 0x87, 0x80, 0x09, 0x07, 0xA0, 0x12, 0x07,
+    0x80, 0x00, 0x07, 0x10, 0x08, 0x07, 0x80, 0x10, 0x07, 0x40, 0x00, 0x07,
+    0x20, 0xC0, 0x07, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x37,
+    // 0x33 '3'
+    0x00, 0x00, 0x13, 0x04, 0x00, 0x13, 0x44, 0x00, 0x17, 0x00, 0x00, 0x03,
+    0x80, 0x40, 0x03, 0x20, 0x50, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03,
+    0x81, 0x10, 0x0B, 0x1E, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x80, 0x23,
+    0x3C, 0x10, 0x03, 0x00, 0x01, 0x03,
+    // 0x34 '4'
+    0x00, 0x07, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x03, 0x02, 0x24, 0x03, 0x08, 0x84, 0x03, 0x10, 0x04, 0x03,
+    0x42, 0x04, 0x03, 0x07, 0xF8, 0xFB, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x7F, 0xFC, 0xFF, 0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x00, 0x04, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x35 '5'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x06, 0x40, 0x17, 0x80, 0x00, 0x03,
+    0x00, 0x20, 0x07, 0x12, 0x20, 0x07, 0x01, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x10, 0x43, 0x00, 0x09, 0x83, 0x00, 0x80, 0x13, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x83, 0x80, 0x06, 0x03,
+    // 0x36 '6'
+    0x00, 0x0E, 0x83, 0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x08, 0x00, 0x03,
+    0x11, 0x80, 0x43, 0x22, 0x80, 0x27, 0x44, 0x20, 0x07, 0x08, 0x00, 0x03,
+    0x10, 0xA0, 0x07, 0x00, 0x10, 0x23, 0xA0, 0x80, 0x03, 0x80, 0x40, 0x0B,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x63, 0x00, 0x03, 0x03,
+    // 0x37 '7'
+    0xE0, 0x00, 0x03, 0x02, 0x00, 0x03, 0x10, 0x00, 0x03, 0x10, 0x00, 0x4B,
+    0x10, 0x06, 0x07, 0x10, 0x10, 0x07, 0x10, 0x40, 0x83, 0x10, 0x86, 0x03,
+    0x10, 0x18, 0x03, 0x18, 0x40, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x01, 0x83, 0x17, 0x00, 0x13, 0x00, 0x80, 0x0B, 0x00, 0x02, 0x0B,
+    0x0C, 0x20, 0x23, 0x00, 0x08, 0x27, 0xA0, 0x80, 0x03, 0x80, 0x10, 0x03,
+    0x80, 0x08, 0x07, 0x80, 0x00, 0x23, 0x98, 0x64, 0x0B, 0x00, 0x00, 0x0B,
+    0x40, 0x10, 0x03, 0x0C, 0x08, 0x03, 0x00, 0x03, 0x83,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x13, 0x20, 0x10, 0x07, 0x40, 0x00, 0x13,
+    0x0F, 0x08, 0x03, 0x10, 0x00, 0x27, 0xA0, 0x24, 0x03, 0xA0, 0x00, 0x03,
+    0xA0, 0x10, 0x83, 0x80, 0x11, 0x03, 0x80, 0x04, 0x23, 0x06, 0x20, 0x43,
+    0x40, 0x00, 0x03, 0x20, 0x03, 0x03, 0x04, 0x10, 0x03, 0x00, 0x00, 0x03,
+    // 0x3A ':'
+    0x00, 0x00, 0x80, 0x08, 0x80, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xCF, 0x80, 0x10, 0x07,
+    0x00, 0x00, 0x27, 0x80, 0x00, 0x87, 0x00, 0x0A, 0x07,
+    // 0x3C '<'
+    0x04, 0x03, 0x00, 0x03, 0x08, 0x83, 0x02, 0x03, 0x10, 0x43, 0x01, 0x23,
+    0x20, 0x23, 0x00, 0x93, 0x40, 0x03, 0x10, 0x4B, 0x80, 0x23, 0x20, 0x27,
+    0x00, 0x03,
+    // 0x3D '='
+    0xA0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x05,
+    // 0x3E '>'
+    0x00, 0x0B, 0x80, 0x27, 0x00, 0x23, 0x00, 0x0B, 0x00, 0x43, 0x00, 0x13,
+    0x04, 0x03, 0x00, 0x23, 0x02, 0x03, 0x08, 0x43, 0x00, 0x03, 0x04, 0x83,
+    0x00, 0x03,
+    // 0x3F '?'
+    0x30, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x15, 0x80, 0x00, 0x21,
+    0x80, 0x03, 0x23, 0x90, 0x00, 0x05, 0x08, 0x40, 0x01, 0x44, 0x80, 0x01,
+    0x21, 0x00, 0x01, 0x18, 0x20, 0x01, 0x00, 0x40, 0x01,
+    // 0x40 '@'
+    0x00, 0x10, 0x40, 0x1F, 0x00, 0xC0, 0x18, 0x1F, 0x02, 0x00, 0x04, 0x1F,
+    0x00, 0x2F, 0xC0, 0x1F, 0x08, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x02, 0x1F, 0x08, 0x60, 0xC1, 0x1F,
+    0x10, 0x80, 0x11, 0x1F, 0x11, 0x24, 0x10, 0x3F, 0x01, 0x42, 0x00, 0x1F,
+    0x80, 0x8A, 0x00, 0x9F, 0xA2, 0x82, 0x50, 0x9F, 0x22, 0x00, 0x40, 0x9F,
+    0xA0, 0x13, 0x20, 0xBF, 0x81, 0x00, 0x00, 0x3F, 0x80, 0xE0, 0x00, 0x1F,
+    0x10, 0x00, 0x51, 0x1F, 0x40, 0x00, 0x11, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x24, 0x00, 0x12, 0x1F, 0x02, 0x01, 0x20, 0x1F, 0x10, 0x94, 0x00, 0x1F,
+    0x04, 0x00, 0x80, 0x1F, 0x03, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC3,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x33, 0x00, 0x60, 0x03, 0x00, 0x00, 0x07,
+    0x0C, 0x34, 0x03, 0x00, 0x04, 0x03, 0x06, 0x04, 0x03, 0x06, 0x04, 0x03,
+    0x00, 0xC4, 0x03, 0x30, 0x0C, 0x0F, 0x02, 0x00, 0x0B, 0x00, 0x00, 0x23,
+    0x00, 0x30, 0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0x42 'B'
+    0x60, 0x00, 0x0D, 0x10, 0x00, 0x09, 0x50, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x11, 0x00, 0x08, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x11, 0x40, 0x48, 0x15,
+    0x42, 0x04, 0x01, 0x20, 0x02, 0x01, 0x00, 0x90, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x00, 0x41,
+    // 0x43 'C'
+    0x00, 0x41, 0x01, 0x03, 0x00, 0x41, 0x04, 0x00, 0x11, 0x10, 0x38, 0x09,
+    0x01, 0x01, 0x81, 0x20, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x13, 0x10, 0x00, 0x03, 0x10, 0x00, 0x01, 0x10, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x40, 0x00, 0x11, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x21,
+    // 0x44 'D'
+    0x60, 0x00, 0x0D, 0x10, 0x00, 0x09, 0x50, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x11, 0x10, 0x00, 0x05,
+    0x40, 0x00, 0x01, 0x00, 0x00, 0x21, 0x04, 0x00, 0x09, 0x00, 0x00, 0x09,
+    0x00, 0xBA, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x41, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x50, 0x27, 0x00, 0x40, 0x27,
+    0x00, 0x40, 0x27, 0x00, 0x40, 0x27, 0x00, 0x40, 0x27, 0x00, 0x40, 0x27,
+    0x00, 0x00, 0x27, 0x30, 0x00, 0x07, 0x00, 0x60, 0xC7, 0x84, 0x00, 0x07,
+    0x00, 0x00, 0xD7,
+    // 0x46 'F'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x40, 0x27, 0x00, 0x40, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x40, 0x17, 0x00, 0x40, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x60, 0x07, 0x84, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0x41, 0x01, 0x01, 0x00, 0x41, 0x04, 0x00, 0x11, 0x00, 0x38, 0x09,
+    0x10, 0x01, 0x81, 0x04, 0x00, 0x41, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x50, 0x00, 0x03, 0x00, 0x00, 0x13, 0x10, 0x00, 0x01, 0x10, 0x08, 0x01,
+    0x10, 0x02, 0x03, 0x00, 0x02, 0x13, 0x10, 0x00, 0x01, 0x04, 0x01, 0xE1,
+    0x41, 0x00, 0x05, 0x64, 0x00, 0x05, 0x00, 0x01, 0xF9, 0x00, 0x0C, 0x01,
+    // 0x48 'H'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x50, 0x27, 0x00, 0x40, 0x07,
+    0x80, 0x40, 0x17, 0x00, 0x40, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x40, 0x07, 0x40, 0x40, 0x1F, 0x20, 0x40, 0x17,
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F,
+    // 0x49 'I'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x01, 0x2F, 0x20, 0x00, 0x06, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x4B 'K'
+    0x40, 0x00, 0x1B, 0x20, 0x00, 0x13, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x40, 0x23, 0x00, 0x00, 0x03,
+    0xC0, 0x04, 0x13, 0x02, 0x42, 0x03, 0x04, 0x81, 0x03, 0x00, 0x00, 0x83,
+    0xC0, 0x00, 0x43, 0x00, 0x00, 0x23, 0x04, 0x00, 0x13, 0x08, 0x00, 0x83,
+    0x00, 0x00, 0x43, 0x20, 0x00, 0x03, 0x00, 0x00, 0x23, 0x40, 0x00, 0x17,
+    0x00, 0x00, 0x03,
+    // 0x4C 'L'
+    0x40, 0x00, 0x1F, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x40, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x01, 0xD7,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x07, 0x00, 0x33, 0x07,
+    0x2C, 0x00, 0x07, 0x00, 0x01, 0x87, 0x09, 0xC0, 0x07, 0x02, 0x00, 0x07,
+    0x80, 0x40, 0x1F, 0x50, 0x00, 0x07, 0x06, 0x00, 0x07, 0x00, 0xC0, 0xC7,
+    0x00, 0x10, 0x07, 0x00, 0x02, 0x07, 0x00, 0x18, 0x67, 0x00, 0xC3, 0x07,
+    0x06, 0x00, 0x07, 0x30, 0x00, 0x07, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x17,
+    0x00, 0x63, 0x07, 0x00, 0x00, 0x07, 0x26, 0x00, 0x07, 0x00, 0x1C, 0xC7,
+    0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17,
+    // 0x4E 'N'
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x13, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x10, 0x80, 0x1B, 0x04, 0x20, 0x03, 0x02, 0x10, 0x03, 0x00, 0x84, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x80, 0x00, 0x03, 0x00, 0x04, 0x23,
+    0x20, 0x00, 0x0B, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0x42, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x10, 0x00, 0x09,
+    0x20, 0x80, 0x01, 0x04, 0x00, 0x01, 0x40, 0x00, 0x21, 0x40, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x10, 0x00, 0x03, 0x10, 0x00, 0x01, 0x48, 0x00, 0x05, 0x04, 0x00, 0x05,
+    0x03, 0x00, 0x09, 0x20, 0x44, 0x01, 0x10, 0x00, 0x21, 0x04, 0x00, 0x01,
+    0x00, 0x85, 0x01,
+    // 0x50 'P'
+    0x60, 0x00, 0x0F, 0x50, 0x00, 0x0B, 0x50, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x13, 0x00, 0x10, 0x03,
+    0x00, 0x14, 0x03, 0x10, 0x04, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x04, 0xC8, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x18, 0x80, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0x42, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x08, 0x0F, 0x24, 0x00, 0x04, 0x0F,
+    0x48, 0x00, 0x24, 0x0F, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x10, 0x0F,
+    0x10, 0x00, 0x01, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x02, 0x4F, 0x00, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x0F, 0x23, 0x00, 0x00, 0x1F, 0x00, 0x44, 0x10, 0x1F,
+    0x10, 0x00, 0x00, 0x0F, 0x04, 0x00, 0xC0, 0x4F, 0x00, 0x85, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x2F,
+    // 0x52 'R'
+    0x60, 0x00, 0x0D, 0x50, 0x00, 0x09, 0x50, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01,
+    0x00, 0x04, 0x09, 0x10, 0x00, 0x01, 0x00, 0x00, 0x81, 0x40, 0x08, 0x21,
+    0x03, 0x02, 0x01, 0x00, 0x10, 0x01, 0x20, 0x20, 0x01, 0x04, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    // 0x53 'S'
+    0x00, 0x00, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01,
+    0x0F, 0x10, 0x13, 0x50, 0x08, 0x01, 0x10, 0x08, 0x01, 0x10, 0x44, 0x01,
+    0x10, 0x04, 0x03, 0x10, 0x20, 0x11, 0x18, 0x10, 0xE5, 0x41, 0x00, 0x01,
+    0x40, 0x08, 0x09, 0x04, 0x06, 0x41,
+    // 0x54 'T'
+    0x64, 0x00, 0x07, 0x02, 0x00, 0x07, 0x14, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x38, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x04, 0x00, 0x07, 0xE0, 0x00, 0x07,
+    // 0x55 'U'
+    0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x1F, 0xFE, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x20, 0x01, 0x03, 0x00, 0x00, 0x43,
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x20, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x56 'V'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x03, 0x00, 0x60, 0x03, 0x30, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x00, 0x00, 0x63, 0x80, 0x04, 0x0B, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x63, 0x00, 0x03, 0x03, 0x04, 0x00, 0x03,
+    0x00, 0x60, 0x03, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x57 'W'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x0C, 0x03, 0x28, 0x01, 0x83,
+    0x00, 0x80, 0x23, 0x80, 0x0C, 0x03, 0x00, 0x00, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x18, 0x23, 0x00, 0x41, 0x03, 0x08, 0x0C, 0x03, 0x60, 0x60, 0x03,
+    0x01, 0x00, 0x03, 0x00, 0x80, 0x03, 0x10, 0x10, 0x03, 0x06, 0x02, 0x03,
+    0x00, 0x80, 0x43, 0x00, 0x04, 0x03, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+    0x00, 0x10, 0x13, 0x01, 0x40, 0x83, 0x04, 0x06, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x80, 0x03, 0x04, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x17, 0x20, 0x00, 0x07, 0x20, 0x00, 0x47,
+    0x10, 0x00, 0x07, 0x04, 0x01, 0x07, 0x02, 0x04, 0x47, 0x00, 0x80, 0x97,
+    0x08, 0x12, 0x1F, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xC0, 0x90, 0x07, 0x10, 0x00, 0x47, 0x22, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x87, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x17,
+    // 0x59 'Y'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x20, 0x80, 0x07, 0x08, 0x00, 0x07,
+    0x40, 0x08, 0x27, 0x00, 0x00, 0x07, 0x00, 0x20, 0x07, 0x00, 0x40, 0x07,
+    0xC0, 0x10, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x1F,
+    0x0C, 0x00, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x18, 0x00, 0x23, 0x80, 0x00, 0x83, 0x04, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x20, 0x00, 0x23, 0x00, 0x10, 0xA3, 0x00, 0x42, 0x23, 0x00, 0x84, 0x23,
+    0x02, 0x10, 0x23, 0x00, 0x00, 0x23, 0x08, 0x00, 0x23, 0x20, 0x00, 0x03,
+    0x02, 0x00, 0x03, 0x08, 0x00, 0x03, 0x90, 0x02, 0x03, 0x40, 0x01, 0x53,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xFF, 0xEF,
+    0x20, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
+    // 0x5C '\'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x02,
+    // 0x5D ']'
+    0x40, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x5E '^'
+    0x00, 0x01, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x01, 0x0C, 0x31, 0x00, 0x01,
+    0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x30, 0x81, 0x00, 0x19, 0x01, 0x83,
+    0x00, 0x03, 0x00, 0x0F, 0x00, 0x01,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x60 '`'
+    0x00, 0x50, 0x00, 0x04, 0x20, 0x12, 0x06,
+    // 0x61 'a'
+    0x00, 0x24, 0x7F, 0x20, 0x00, 0x7F, 0x44, 0x80, 0x7F, 0x04, 0x80, 0xFF,
+    0x90, 0x04, 0x7F, 0x81, 0x40, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0x7F,
+    0xA1, 0x05, 0x7F, 0x0E, 0x38, 0x7F, 0x00, 0x01, 0x7F, 0x40, 0x00, 0xFF,
+    0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x7F,
+    // 0x62 'b'
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x7F,
+    0x1F, 0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x7F, 0x87, 0xFC, 0xFF, 0x00, 0x40, 0x00, 0xFF, 0x00, 0x10, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x90, 0x04, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x0B, 0xA0, 0x7F,
+    // 0x63 'c'
+    0x05, 0xE0, 0x7F, 0x10, 0x04, 0x7F, 0x00, 0x02, 0x7F, 0x43, 0xE0, 0x7F,
+    0x10, 0x08, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x7F, 0x90, 0x00, 0xFF, 0x04, 0x04, 0x7F, 0x00, 0x00, 0x7F,
+    0x28, 0x05, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x64 'd'
+    0x00, 0x05, 0xE0, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x05, 0x81, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x50, 0x80, 0x01, 0x7F, 0x0F, 0x1F, 0xF2, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    // 0x65 'e'
+    0x05, 0xE0, 0x7F, 0x00, 0x04, 0x7F, 0x20, 0x00, 0x7F, 0x4A, 0xB0, 0x7F,
+    0x90, 0x00, 0x7F, 0x20, 0x04, 0xFF, 0xA0, 0x04, 0xFF, 0x20, 0x00, 0x7F,
+    0x00, 0x00, 0xFF, 0x90, 0x00, 0xFF, 0x86, 0x04, 0x7F, 0x00, 0x01, 0x7F,
+    0x00, 0x04, 0x7F, 0x07, 0x00, 0x7F,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x80, 0x04, 0x48, 0x80, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x00, 0x90, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x08, 0x00, 0x00, 0x40, 0x20,
+    0x00, 0x00, 0x82, 0x83, 0x20, 0x00, 0xA0, 0x80, 0x08, 0x20, 0x20, 0x00,
+    0x20, 0xA0, 0x08, 0x80, 0x20, 0x08, 0x00, 0x00, 0x02, 0x84, 0x00, 0x02,
+    0x80, 0x44, 0x80, 0x20, 0x84, 0x40, 0x80, 0x00, 0x08, 0xA0, 0x02, 0x00,
+    0xA0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    // 0x68 'h'
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x00, 0x8B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x17, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x69 'i'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x02, 0x08, 0x8F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x38, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    // 0x6B 'k'
+    0x00, 0x00, 0x01, 0x7F, 0x10, 0x00, 0x02, 0x7F, 0x50, 0x00, 0x02, 0x7F,
+    0x0F, 0xFF, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x7F, 0xFE, 0xFC, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x04, 0x23, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0xB2, 0x88, 0x7F, 0x00, 0xA0, 0x04, 0x7F,
+    0x00, 0x88, 0x22, 0x7F, 0x00, 0x80, 0x11, 0x7F, 0x00, 0x80, 0x00, 0xFF,
+    0x00, 0xA0, 0x04, 0x7F, 0x00, 0xA0, 0x00, 0xFF, 0x00, 0x40, 0x01, 0x7F,
+    // 0x6C 'l'
+    0x20, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0x6D 'm'
+    0x20, 0x00, 0x40, 0x02, 0x00, 0x02, 0x8F, 0xFC, 0x00, 0x00, 0x80, 0x00,
+    0x28, 0x04, 0x40, 0x00, 0x10, 0x01, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x8B, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x07, 0xFC, 0x40, 0x00,
+    0x10, 0x01, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x10, 0x00, 0x8F, 0xFC,
+    0x80, 0x00, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6E 'n'
+    0x20, 0x00, 0x40, 0x02, 0x00, 0x02, 0x8F, 0xFC, 0x00, 0x00, 0x80, 0x00,
+    0x20, 0x04, 0x40, 0x00, 0x10, 0x01, 0x00, 0x00, 0xA0, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x80, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02,
+    // 0x6F 'o'
+    0x05, 0xE0, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x05, 0xA0, 0x7F,
+    0x10, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x02, 0x7F,
+    0x00, 0x02, 0x7F, 0xA0, 0x00, 0xFF, 0x90, 0x04, 0x7F, 0x80, 0x00, 0x7F,
+    0x42, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x04, 0x20, 0x7F,
+    // 0x70 'p'
+    0x60, 0x00, 0x05, 0x00, 0x00, 0x07, 0x90, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x08, 0x00, 0x0B, 0x40, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x81, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x90, 0x09, 0x01, 0x0C, 0x20, 0x01, 0x00, 0x02, 0x01, 0x00, 0x04, 0x01,
+    0x18, 0x20, 0x01, 0x00, 0x00, 0x01,
+    // 0x71 'q'
+    0x05, 0xE0, 0x01, 0x10, 0x04, 0x01, 0x00, 0x00, 0x01, 0x05, 0x80, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0xA0, 0x04, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x03, 0x80, 0x04, 0x03, 0x80, 0x00, 0x03, 0x1F, 0xF3, 0xFB,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x7F, 0xFF, 0xF3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01,
+    // 0x72 'r'
+    0x20, 0x01, 0x40, 0x00, 0x00, 0x02, 0x8F, 0xF8, 0x00, 0x00, 0x80, 0x00,
+    0x24, 0x04, 0x28, 0x00, 0x50, 0x00, 0x90, 0x00, 0x90, 0x03, 0x00, 0x00,
+    0x90, 0x00, 0x60, 0x00,
+    // 0x73 's'
+    0x00, 0x00, 0x7F, 0x1C, 0x01, 0x7F, 0x41, 0x10, 0x7F, 0x08, 0x04, 0xFF,
+    0x20, 0x00, 0xFF, 0xA0, 0x02, 0x7F, 0x00, 0x02, 0x7F, 0x20, 0x22, 0xFF,
+    0xA1, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x7F, 0x50, 0x68, 0x7F,
+    // 0x74 't'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x47, 0x08, 0x00, 0x07,
+    0x08, 0x00, 0x0F, 0x08, 0x00, 0x07, 0x08, 0x00, 0x47, 0x04, 0x00, 0x77,
+    // 0x75 'u'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x06, 0x7F,
+    0x00, 0x01, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x08, 0xFF, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x40, 0x04, 0x7F, 0x20, 0x04, 0x7F,
+    0x80, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x02, 0x7F,
+    // 0x76 'v'
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x86, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0x82, 0x0C, 0x7F, 0x80, 0x00, 0x7F,
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x61, 0x7F, 0x80, 0x00, 0x7F,
+    0x8C, 0x10, 0x7F, 0x80, 0xC0, 0x7F, 0x82, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0xA0, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    // 0x77 'w'
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0xC0, 0x7F, 0x90, 0x18, 0x7F, 0x84, 0x01, 0x7F, 0x80, 0x20, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x86, 0x7F, 0x04, 0x20, 0x7F,
+    0x20, 0x00, 0x7F, 0x82, 0x00, 0x7F, 0x40, 0x80, 0x7F, 0x18, 0x18, 0x7F,
+    0x03, 0x03, 0x7F, 0x00, 0x60, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x7F,
+    0xA3, 0x06, 0x7F, 0xB8, 0x30, 0x7F, 0x80, 0x00, 0x7F, 0x82, 0x00, 0x7F,
+    0x90, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x78 'x'
+    0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x90, 0x04, 0x88, 0x00, 0x80, 0x20,
+    0x91, 0x4A, 0x80, 0x02, 0x04, 0x20, 0x00, 0x00, 0x44, 0x02, 0xA0, 0x46,
+    0xA0, 0x00, 0x88, 0x10, 0x90, 0x08, 0xA0, 0x00, 0xA0, 0x02, 0x40, 0x01,
+    // 0x79 'y'
+    0x00, 0x00, 0x06, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x86, 0x00, 0x00,
+    0x80, 0x00, 0x12, 0x90, 0x00, 0x00, 0x82, 0x0C, 0x44, 0x80, 0x00, 0x80,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00,
+    0x8C, 0x30, 0x00, 0x80, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xA0, 0x00, 0x00, 0x80, 0x00, 0x00,
+    // 0x7A 'z'
+    0x00, 0x00, 0x7F, 0x64, 0x01, 0x7F, 0x84, 0x08, 0x7F, 0x98, 0x00, 0x7F,
+    0x80, 0x40, 0x7F, 0xA0, 0x08, 0x7F, 0xA1, 0x00, 0x7F, 0xA0, 0x20, 0x7F,
+    0xA8, 0x80, 0x7F, 0xA0, 0x00, 0x7F, 0x82, 0x04, 0x7F, 0x84, 0x04, 0x7F,
+    0x90, 0x10, 0x7F, 0x40, 0x22, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x7B '{'
+    0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x20, 0x98, 0x68, 0x23,
+    0x40, 0x02, 0x00, 0x03, 0x8A, 0x00, 0x02, 0x83, 0xA0, 0x70, 0x70, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xDF,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x11, 0x48, 0x94, 0x4B, 0x00, 0x00, 0x00, 0x0B,
+    0x40, 0x00, 0x00, 0x03, 0x0E, 0x88, 0x0B, 0xA3, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x03,
+    // 0x7E '~'
+    0x13, 0x43, 0x03, 0x93, 0x03, 0x83, 0x13, 0x0B, 0x03, 0x23, 0x23, 0x23,
+    0x8B, 0x03, 0x03,
+    // 0xA1 '¡'
+    0x20, 0x00, 0x00, 0x10, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02,
+    0x40, 0x67, 0xF8,
+    // 0xA2 '¢'
+    0x00, 0x28, 0x60, 0x07, 0x00, 0x40, 0x10, 0x07, 0x01, 0x00, 0x08, 0x07,
+    0x00, 0x00, 0xC4, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x04, 0x3F, 0x13, 0x0F, 0x80, 0x00, 0x00, 0x07, 0x08, 0x1F, 0x90, 0x07,
+    0x04, 0x00, 0x10, 0x07, 0x00, 0x80, 0x00, 0x07, 0x02, 0x20, 0x14, 0x07,
+    0x02, 0x00, 0x00, 0x07, 0x01, 0x40, 0x38, 0x07,
+    // 0xA3 '£'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x27, 0x00, 0x00, 0x27, 0x00, 0x01, 0x47,
+    0x00, 0xC8, 0x0B, 0x08, 0x00, 0x2B, 0x20, 0x02, 0xA3, 0x41, 0x80, 0x23,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x80, 0x00, 0x27, 0x80, 0x00, 0x27,
+    0xA0, 0x00, 0x27, 0x00, 0x20, 0x03, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1B,
+    0x18, 0x00, 0x03,
+    // 0xA4 '¤'
+    0x20, 0x05, 0x10, 0x01, 0x43, 0xD1, 0x00, 0x01, 0x10, 0x01, 0x00, 0x41,
+    0x08, 0x05, 0x28, 0x11, 0x00, 0x01, 0x28, 0x15, 0x00, 0x21, 0x01, 0xC1,
+    0x00, 0x01, 0x24, 0x61, 0x50, 0x03, 0x00, 0x0B, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x02, 0x0E, 0x07, 0x01, 0x02, 0x07, 0x10, 0x02, 0x07, 0x00, 0x12, 0x07,
+    0x00, 0x0A, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x01, 0x8A, 0x07, 0xC6, 0x02, 0x07, 0x28, 0x82, 0x17, 0x02, 0x0A, 0x07,
+    0x04, 0x24, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    // 0xA7 '§'
+    0x01, 0xC0, 0x14, 0x08, 0x00, 0x20, 0x20, 0xA4, 0x20, 0x00, 0x80, 0x08,
+    0x44, 0x09, 0x05, 0x20, 0x00, 0x05, 0x00, 0x24, 0x05, 0x00, 0x02, 0x01,
+    0x00, 0x90, 0x08, 0x80, 0x09, 0x02, 0x00, 0x22, 0x80, 0x38, 0x10, 0x08,
+    0x00, 0x0C, 0x40,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x01, 0x82, 0x01, 0x04, 0x10, 0x01, 0x01, 0x80, 0x21,
+    0x00, 0x00, 0x41, 0x20, 0x00, 0x09, 0x00, 0x5A, 0x15, 0x41, 0x01, 0x05,
+    0x42, 0x44, 0x89, 0x20, 0x82, 0x43, 0x20, 0x01, 0x09, 0x05, 0x01, 0x01,
+    0x05, 0x01, 0x09, 0x25, 0x00, 0x0B, 0x00, 0x01, 0x01, 0x10, 0x00, 0x81,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x49, 0x03, 0x00, 0x01,
+    0x04, 0x1A, 0x21, 0x03, 0x00, 0x01, 0x00, 0x44, 0x01,
+    // 0xAA 'ª'
+    0x00, 0x01, 0x32, 0x43, 0x40, 0x2B, 0x5C, 0x8B, 0x00, 0x4B, 0x06, 0x6B,
+    0x18, 0x8B, 0x40, 0x2B, 0x1F, 0x09, 0x00, 0x21, 0x00, 0x01,
+    // 0xAB '«'
+    0x04, 0x0F, 0x08, 0x8F, 0x00, 0x4F, 0x02, 0x0F, 0x48, 0x8F, 0x00, 0x4F,
+    0x20, 0x1F, 0x04, 0x0F, 0x08, 0x0F, 0x10, 0x8F, 0x00, 0x4F, 0x20, 0x0F,
+    0x48, 0x9F, 0x20, 0x1F, 0x40, 0x1F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x12, 0x20, 0x7F, 0x28, 0x08, 0x7F,
+    0x10, 0x01, 0x7F, 0x0C, 0x1A, 0x7F, 0x00, 0x02, 0x7F, 0x28, 0x00, 0xFF,
+    0x08, 0x40, 0x7F, 0x20, 0x00, 0x7F, 0x08, 0x10, 0xFF, 0x65, 0x00, 0x7F,
+    0x50, 0x08, 0x7F, 0x28, 0x00, 0x7F, 0x16, 0x20, 0x7F, 0x00, 0x00, 0x7F,
+    0x02, 0x20, 0x7F,
+    // 0xB0 '°'
+    0x33, 0x3F, 0x00, 0x3F, 0x0E, 0x7F, 0x01, 0x3F, 0x81, 0x7F, 0xA1, 0x7F,
+    0xA1, 0x3F, 0x92, 0x3F, 0x00, 0xBF, 0x3C, 0x3F,
+    // 0xB1 '±'
+    0x01, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x04, 0x3F, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0xB2 '²'
+    0x08, 0x03, 0x00, 0x03, 0x10, 0x43, 0x00, 0x93, 0xA1, 0x03, 0x82, 0x43,
+    0x0C, 0x83, 0x01, 0x03, 0x00, 0x07, 0x18, 0x03,
+    // 0xB3 '³'
+    0x20, 0x0D, 0x00, 0x09, 0x82, 0x0B, 0x00, 0x01, 0xA4, 0x01, 0x00, 0x15,
+    0x90, 0x25, 0x04, 0x01, 0x31, 0x01, 0x00, 0x01,
+    // 0xB5 'µ'
+    0x40, 0x00, 0x3F, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x30, 0x21, 0x31,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x09, 0x01, 0x7F, 0xA0, 0x01, 0x80, 0x04, 0x01,
+    0x00, 0x03, 0x01, 0x3F, 0xE0, 0x01, 0x00, 0x04, 0x81, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xB6 '¶'
+    0x07, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x07, 0x0F, 0x0F, 0x8F, 0x0F, 0x07,
+    // 0xB9 '¹'
+    0x20, 0x03, 0x00, 0x03, 0x00, 0x0B, 0x4F, 0xF3, 0x00, 0x03, 0x00, 0x03,
+    0x3F, 0xF3, 0x00, 0x03, 0x00, 0x07,
+    // 0xBA 'º'
+    0x00, 0x01, 0x00, 0xC1, 0x20, 0x23, 0x06, 0x0B, 0x00, 0x0B, 0x20, 0x4B,
+    0x00, 0x4B, 0x00, 0x8B, 0x07, 0x0B, 0x20, 0x03, 0x0B, 0x81,
+    // 0xBB '»'
+    0x40, 0x0F, 0x00, 0x1F, 0x50, 0x9F, 0x00, 0x2F, 0x00, 0x4F, 0x10, 0x0F,
+    0x08, 0x0F, 0x04, 0x0F, 0x40, 0x0F, 0x10, 0x5F, 0x48, 0x8F, 0x02, 0x2F,
+    0x10, 0x4F, 0x08, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x10, 0x00, 0x00, 0x28, 0x02, 0x00, 0x08, 0x02, 0x00, 0x07, 0xFA, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x04, 0x0D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x02, 0x60, 0x00, 0x00, 0x80, 0x00, 0x22, 0x00, 0x00, 0x80, 0x00,
+    0x03, 0x20, 0x00, 0x04, 0xC0, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x10, 0x04, 0x10, 0x60, 0x01, 0x50, 0x00, 0x10, 0x50, 0x00, 0x40, 0x50,
+    0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x10,
+    // 0xBD '½'
+    0x10, 0x00, 0x00, 0x28, 0x02, 0x00, 0x08, 0x02, 0x00, 0x07, 0xFA, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x02, 0x04,
+    0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x20,
+    0x00, 0x04, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x44, 0x00, 0x01, 0x00, 0x00,
+    0x06, 0x40, 0x00, 0x08, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x20, 0x44, 0x20, 0x00, 0x18, 0x40, 0x00, 0xA0, 0x90, 0x00, 0x00, 0x10,
+    0x00, 0x22, 0x50, 0x00, 0x94, 0x90, 0x00, 0x01, 0x10, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x10,
+    // 0xBE '¾'
+    0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x40, 0x08, 0x00, 0x50, 0x0A, 0x00, 0x08, 0x50, 0x00, 0x03, 0x00, 0x02,
+    0x18, 0x88, 0x0D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x02, 0x60, 0x00, 0x00, 0x80, 0x00, 0x22, 0x00, 0x00, 0x80, 0x00,
+    0x03, 0x20, 0x00, 0x04, 0xC0, 0x00, 0x11, 0x00, 0xA0, 0x00, 0x00, 0x10,
+    0x10, 0x02, 0x10, 0x60, 0x08, 0xD0, 0x00, 0x02, 0x50, 0x00, 0x20, 0x50,
+    0x00, 0x08, 0x12, 0x00, 0x80, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    // 0xBF '¿'
+    0x00, 0x03, 0x01, 0x00, 0x08, 0x61, 0x00, 0x10, 0x11, 0x00, 0x20, 0x89,
+    0x00, 0x20, 0x05, 0x70, 0x00, 0x21, 0x80, 0x40, 0x01, 0x02, 0x00, 0x03,
+    0x02, 0x08, 0x03, 0x00, 0x50, 0x21, 0x00, 0x00, 0x35,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x67,
+    0x40, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x68, 0x07,
+    0x40, 0x00, 0x08, 0x07, 0x00, 0x0C, 0x08, 0x07, 0x10, 0x0C, 0x08, 0x07,
+    0x04, 0x01, 0x88, 0x07, 0x00, 0x60, 0x18, 0x1F, 0x00, 0x04, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x0C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x67,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x0C, 0x18, 0x68, 0x07,
+    0x04, 0x00, 0x08, 0x07, 0x04, 0x0C, 0x08, 0x07, 0x00, 0x0C, 0x08, 0x07,
+    0x08, 0x01, 0x88, 0x07, 0x88, 0x60, 0x18, 0x1F, 0x80, 0x04, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x0C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x67,
+    0x08, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x68, 0x07,
+    0x40, 0x00, 0x08, 0x07, 0x80, 0x0C, 0x08, 0x07, 0x80, 0x0C, 0x08, 0x07,
+    0x48, 0x01, 0x88, 0x07, 0x24, 0x60, 0x18, 0x1F, 0x10, 0x04, 0x00, 0x17,
+    0x04, 0x00, 0x00, 0x47, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x0C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x67,
+    0x48, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x18, 0x68, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x08, 0x0C, 0x08, 0x07, 0x20, 0x0C, 0x08, 0x07,
+    0x24, 0x01, 0x88, 0x07, 0x44, 0x60, 0x18, 0x1F, 0x08, 0x04, 0x00, 0x17,
+    0x10, 0x00, 0x00, 0x47, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x0C, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x20, 0xCF,
+    0x00, 0x01, 0x80, 0x0F, 0x88, 0x00, 0x00, 0x1F, 0x00, 0x30, 0xD0, 0x0F,
+    0x20, 0x00, 0x10, 0x0F, 0x00, 0x18, 0x10, 0x0F, 0x00, 0x18, 0x10, 0x0F,
+    0x50, 0x03, 0x10, 0x0F, 0x88, 0xC0, 0x30, 0x3F, 0x88, 0x08, 0x00, 0x2F,
+    0x50, 0x00, 0x00, 0x8F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x33,
+    0x00, 0x00, 0x60, 0x03, 0x06, 0x00, 0x00, 0x07, 0x40, 0x0C, 0x34, 0x03,
+    0xA4, 0x00, 0x04, 0x03, 0x21, 0x06, 0x04, 0x03, 0x05, 0x06, 0x04, 0x03,
+    0x19, 0x00, 0xC4, 0x03, 0x00, 0x30, 0x0C, 0x0F, 0x00, 0x02, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x06, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x00, 0x04, 0x67, 0x00, 0x01, 0x87,
+    0x00, 0x00, 0x17, 0x01, 0x02, 0x07, 0x02, 0x0A, 0x07, 0x00, 0x8A, 0x07,
+    0x02, 0x0A, 0x1F, 0x04, 0x0A, 0x17, 0x10, 0x0A, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x27, 0x00, 0x40, 0x27,
+    0x00, 0x40, 0x27, 0x00, 0x40, 0x27, 0x00, 0x40, 0x27, 0x00, 0x00, 0x27,
+    0x30, 0x00, 0x07, 0x00, 0x60, 0xC7, 0x84, 0x00, 0x07, 0x00, 0x00, 0xD7,
+    // 0xC7 'Ç'
+    0x00, 0x41, 0x00, 0x03, 0x03, 0x00, 0x40, 0x03, 0x04, 0x00, 0x10, 0x03,
+    0x10, 0x38, 0x08, 0x03, 0x01, 0x01, 0x80, 0x03, 0x20, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x87, 0x00, 0x00, 0x13, 0x0F,
+    0x10, 0x00, 0x02, 0x77, 0x10, 0x00, 0x01, 0x03, 0x10, 0x00, 0x12, 0x0B,
+    0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x03, 0x40, 0x00, 0x10, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x20, 0x03,
+    // 0xC8 'È'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x50, 0x27, 0x00, 0x00, 0x40, 0x27, 0x24, 0x00, 0x40, 0x27,
+    0x10, 0x00, 0x40, 0x27, 0x04, 0x00, 0x40, 0x27, 0x00, 0x00, 0x40, 0x27,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0x60, 0xC7,
+    0x00, 0x84, 0x00, 0x07, 0x00, 0x00, 0x00, 0xD7,
+    // 0xC9 'É'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x50, 0x27, 0x10, 0x00, 0x40, 0x27, 0x24, 0x00, 0x40, 0x27,
+    0x00, 0x00, 0x40, 0x27, 0x40, 0x00, 0x40, 0x27, 0x80, 0x00, 0x40, 0x27,
+    0x30, 0x00, 0x00, 0x27, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0x60, 0xC7,
+    0x00, 0x84, 0x00, 0x07, 0x00, 0x00, 0x00, 0xD7,
+    // 0xCA 'Ê'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x24, 0x00, 0x50, 0x27, 0x08, 0x00, 0x40, 0x27, 0x90, 0x00, 0x40, 0x27,
+    0x90, 0x00, 0x40, 0x27, 0x08, 0x00, 0x40, 0x27, 0x00, 0x00, 0x40, 0x27,
+    0x00, 0x00, 0x00, 0x27, 0x08, 0x30, 0x00, 0x07, 0x00, 0x00, 0x60, 0xC7,
+    0x00, 0x84, 0x00, 0x07, 0x00, 0x00, 0x00, 0xD7,
+    // 0xCB 'Ë'
+    0x00, 0x80, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0xA0, 0x4F, 0x00, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x80, 0x4F,
+    0x00, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x80, 0x4F, 0x88, 0x00, 0x80, 0x4F,
+    0x80, 0x00, 0x00, 0x4F, 0x30, 0x60, 0x00, 0x0F, 0x00, 0x00, 0xC1, 0x8F,
+    0x01, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xAF,
+    // 0xCC 'Ì'
+    0x30, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x40, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x04, 0x1F, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xCD 'Í'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x0C, 0x20, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x48, 0x1F, 0xFF, 0xE7, 0x80, 0x00, 0x00, 0x07, 0x40, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17,
+    0x20, 0x20, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x90, 0x00, 0x00, 0x07, 0x40, 0x1F, 0xFF, 0xE7, 0x24, 0x00, 0x00, 0x07,
+    0x10, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xCF 'Ï'
+    0x50, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x3F, 0x88, 0x40, 0x00, 0x2F,
+    0x00, 0x40, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x50, 0x3F, 0xFF, 0xCF, 0x88, 0x00, 0x00, 0x0F,
+    0x88, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x01, 0x60, 0x20, 0x0D, 0x10, 0x20, 0x09, 0x50, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x20, 0x11,
+    0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x10, 0x20, 0x01, 0x00, 0x20, 0x11,
+    0x10, 0x00, 0x05, 0x40, 0x00, 0x01, 0x00, 0x00, 0x21, 0x04, 0x00, 0x09,
+    0x00, 0x00, 0x09, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x41,
+    0x00, 0x81, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23,
+    0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10, 0x80, 0x1B,
+    0x00, 0x04, 0x20, 0x03, 0x08, 0x02, 0x10, 0x03, 0x20, 0x00, 0x84, 0x03,
+    0x24, 0x00, 0x00, 0x03, 0x64, 0x00, 0x10, 0x03, 0x00, 0x80, 0x00, 0x03,
+    0x40, 0x00, 0x04, 0x23, 0x00, 0x20, 0x00, 0x0B, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x13, 0x00, 0x41, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+    0x30, 0x80, 0x00, 0x43, 0x00, 0x80, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x03,
+    0x04, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x03, 0x00, 0x90, 0x00, 0x0B,
+    0x00, 0x08, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x13, 0x00, 0x40, 0x88, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01, 0x0A, 0x03,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x13, 0x00, 0x41, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x43, 0x00, 0x80, 0x00, 0x27, 0x0C, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03,
+    0x08, 0x20, 0x00, 0x07, 0x80, 0x20, 0x00, 0x03, 0x40, 0x90, 0x00, 0x0B,
+    0x00, 0x08, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x13, 0x00, 0x40, 0x88, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01, 0x0A, 0x03,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x13, 0x00, 0x41, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x43, 0x00, 0x80, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x91, 0x00, 0x00, 0x03,
+    0x40, 0x20, 0x00, 0x07, 0x24, 0x20, 0x00, 0x03, 0x10, 0x90, 0x00, 0x0B,
+    0x04, 0x08, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x13, 0x00, 0x40, 0x88, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01, 0x0A, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x13, 0x00, 0x41, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+    0x40, 0x80, 0x00, 0x43, 0x00, 0x80, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x21, 0x00, 0x00, 0x03,
+    0x24, 0x20, 0x00, 0x07, 0x04, 0x20, 0x00, 0x03, 0x08, 0x90, 0x00, 0x0B,
+    0x10, 0x08, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x13, 0x00, 0x40, 0x88, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01, 0x0A, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x01, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x47,
+    0x00, 0x40, 0x00, 0x27, 0x00, 0x82, 0x00, 0x07, 0x50, 0x10, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x87, 0x89, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07,
+    0x50, 0x40, 0x00, 0x0F, 0x88, 0x40, 0x00, 0x07, 0x89, 0x20, 0x00, 0x17,
+    0x40, 0x10, 0x00, 0x17, 0x00, 0x0C, 0x00, 0x27, 0x00, 0x81, 0x10, 0x07,
+    0x00, 0x40, 0x00, 0x87, 0x00, 0x10, 0x00, 0x07, 0x00, 0x02, 0x14, 0x07,
+    // 0xD7 '×'
+    0x00, 0x07, 0x10, 0x27, 0x08, 0x4F, 0x04, 0x97, 0x01, 0x27, 0x00, 0x07,
+    0x00, 0x07, 0x08, 0x07, 0x10, 0x07, 0x00, 0x07, 0x40, 0x4F, 0x40, 0x37,
+    0x00, 0x07,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x01, 0x00, 0x42, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01,
+    0x10, 0x00, 0x09, 0x20, 0x82, 0x01, 0x04, 0x00, 0x01, 0x40, 0x00, 0x21,
+    0x40, 0x00, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x10, 0x00, 0x03, 0x10, 0x00, 0x01, 0x08, 0x00, 0x05,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x09, 0x20, 0x64, 0x01, 0x00, 0x00, 0x21,
+    0x0C, 0x00, 0x01, 0x10, 0x85, 0x01, 0x20, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x1F, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x20, 0x01, 0x03, 0x40, 0x00, 0x00, 0x43, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x14, 0x00, 0x00, 0x27, 0x0C, 0xC0, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x20, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xDA 'Ú'
+    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x1F, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x20, 0x01, 0x03, 0x00, 0x00, 0x00, 0x43, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x27, 0x08, 0xC0, 0x00, 0x03,
+    0x90, 0x00, 0x00, 0x0B, 0x00, 0x20, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xDB 'Û'
+    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x1F, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x20, 0x01, 0x03, 0x08, 0x00, 0x00, 0x43, 0x10, 0x40, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x27, 0x04, 0xC0, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x20, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x01, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x3F, 0xFD, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x20, 0x40, 0x02, 0x07, 0x00, 0x00, 0x00, 0x87, 0x88, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x4F, 0x89, 0x80, 0x00, 0x07,
+    0x88, 0x00, 0x00, 0x17, 0x50, 0x40, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x0A, 0x00, 0x07, 0x42, 0x00, 0x17,
+    0xC2, 0x00, 0x87, 0x0A, 0x02, 0x87, 0x08, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x08, 0x88, 0x07, 0x04, 0x01, 0x07, 0x00, 0x00, 0x07, 0x01, 0x0C, 0x07,
+    0x00, 0x60, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x01, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x09, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x22, 0x00, 0xFF, 0x80, 0x01, 0x00, 0xFF,
+    0x80, 0x00, 0x80, 0x7F, 0x0D, 0x40, 0x02, 0xFF, 0x00, 0x80, 0x00, 0x7F,
+    0x20, 0x02, 0x01, 0x7F, 0x12, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x84, 0x7F,
+    0x00, 0x00, 0x10, 0x7F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x12, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x22, 0x40, 0x3F,
+    0x88, 0x02, 0x40, 0x7F, 0x80, 0x48, 0x02, 0x3F, 0x04, 0x40, 0xA0, 0x7F,
+    0x12, 0x10, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x3F, 0x06, 0x50, 0x82, 0xBF,
+    0x00, 0x07, 0x1C, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x12, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x22, 0x40, 0x3F,
+    0x00, 0x02, 0x40, 0x7F, 0x00, 0x48, 0x02, 0x3F, 0x00, 0x40, 0xA0, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x3F, 0x04, 0x50, 0x82, 0xBF,
+    0x08, 0x07, 0x1C, 0x3F, 0x70, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x24, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x44, 0x80, 0x7F,
+    0x02, 0x04, 0x80, 0xFF, 0x44, 0x90, 0x04, 0x7F, 0x00, 0x81, 0x40, 0xFF,
+    0x90, 0x20, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x80, 0xA1, 0x05, 0x7F,
+    0x04, 0x0E, 0x38, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x04, 0x40, 0x00, 0xFF,
+    0x00, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x24, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x20, 0x44, 0x80, 0x7F,
+    0x44, 0x04, 0x80, 0xFF, 0x10, 0x90, 0x04, 0x7F, 0x00, 0x81, 0x40, 0xFF,
+    0x40, 0x20, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x00, 0xA1, 0x05, 0x7F,
+    0x64, 0x0E, 0x38, 0x7F, 0x48, 0x00, 0x01, 0x7F, 0x30, 0x40, 0x00, 0xFF,
+    0x00, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x48, 0x20, 0x40, 0x00, 0x00, 0x89, 0x00, 0x88, 0x09, 0x01,
+    0x01, 0x20, 0x08, 0x21, 0x02, 0x81, 0x00, 0x40, 0x01, 0x00, 0x40, 0x00,
+    0x51, 0x42, 0x0A, 0x88, 0x1C, 0x70, 0x80, 0x00, 0x02, 0x20, 0x80, 0x01,
+    0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    // 0xE5 'å'
+    0x00, 0x00, 0x12, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x22, 0x40, 0x3F,
+    0x22, 0x02, 0x40, 0x7F, 0x01, 0x48, 0x02, 0x3F, 0x05, 0x40, 0xA0, 0x7F,
+    0x80, 0x10, 0x00, 0x7F, 0x81, 0x10, 0x00, 0x3F, 0x99, 0x50, 0x82, 0xBF,
+    0x40, 0x07, 0x1C, 0x3F, 0x18, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F,
+    // 0xE6 'æ'
+    0x00, 0x04, 0x7F, 0x20, 0x00, 0x7F, 0x44, 0x80, 0x7F, 0x04, 0x80, 0xFF,
+    0x90, 0x04, 0x7F, 0x80, 0x00, 0x7F, 0x21, 0x40, 0xFF, 0x20, 0x00, 0x7F,
+    0xA0, 0x01, 0x7F, 0x8E, 0x58, 0x7F, 0x40, 0x02, 0x7F, 0x00, 0x02, 0x7F,
+    0x40, 0xD0, 0x7F, 0x02, 0x80, 0x7F, 0x20, 0x04, 0xFF, 0xA0, 0x04, 0xFF,
+    0x22, 0x80, 0x7F, 0x22, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x04, 0x7F,
+    0x00, 0x01, 0x7F, 0x30, 0x06, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xE7 'ç'
+    0x05, 0xE0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x02, 0x00, 0x43, 0xE0, 0x00,
+    0x10, 0x08, 0x00, 0x80, 0x00, 0xB2, 0x80, 0x00, 0x81, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x40, 0x90, 0x00, 0xA4, 0x04, 0x04, 0x10, 0x00, 0x00, 0x00,
+    0x28, 0x05, 0x00, 0x00, 0x00, 0x00,
+    // 0xE8 'è'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x25, 0x58, 0x3F, 0x00, 0x48, 0x00, 0x3F, 0x44, 0x10, 0x02, 0x7F,
+    0x00, 0x50, 0x02, 0x7F, 0x12, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x48, 0x00, 0x7F, 0x00, 0x43, 0x02, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x03, 0x80, 0x3F,
+    // 0xE9 'é'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x25, 0x58, 0x3F, 0x00, 0x48, 0x00, 0x3F, 0x00, 0x10, 0x02, 0x7F,
+    0x08, 0x50, 0x02, 0x7F, 0x12, 0x10, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x7F,
+    0x80, 0x48, 0x00, 0x7F, 0x10, 0x43, 0x02, 0x3F, 0x20, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x03, 0x80, 0x3F,
+    // 0xEA 'ê'
+    0x00, 0x05, 0xE0, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x04, 0x20, 0x00, 0x7F,
+    0x02, 0x4A, 0xB0, 0x7F, 0x20, 0x90, 0x00, 0x7F, 0x44, 0x20, 0x04, 0xFF,
+    0x80, 0xA0, 0x04, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x90, 0x00, 0x00, 0xFF,
+    0x40, 0x90, 0x00, 0xFF, 0x00, 0x86, 0x04, 0x7F, 0x08, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x07, 0x00, 0x7F,
+    // 0xEB 'ë'
+    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x95, 0x60,
+    0x89, 0x20, 0x00, 0x50, 0x40, 0x09, 0x01, 0x40, 0x09, 0x00, 0x40, 0x00,
+    0x20, 0x00, 0x01, 0x01, 0x20, 0x01, 0x89, 0x0C, 0x08, 0x00, 0x00, 0x02,
+    0x20, 0x00, 0x08, 0x00, 0x0E, 0x00,
+    // 0xEC 'ì'
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x80, 0x00, 0x01, 0x7F,
+    0x40, 0x47, 0xFE, 0x7F, 0x02, 0x00, 0x00, 0x7F, 0x08, 0x40, 0x00, 0x7F,
+    0x06, 0x40, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x06, 0x47, 0xFE, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x02, 0x40, 0x00, 0x7F,
+    0x40, 0x40, 0x02, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF,
+    // 0xEE 'î'
+    0x04, 0x00, 0x00, 0x12, 0x20, 0x02, 0x24, 0x00, 0x02, 0x88, 0x8F, 0xFC,
+    0x80, 0x00, 0x00, 0x10, 0x80, 0x00, 0x88, 0x80, 0x04, 0x40, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x08, 0x00, 0x01,
+    // 0xEF 'ï'
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x40, 0x05, 0x00, 0x00, 0x05,
+    0x51, 0x1F, 0xF9, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x50, 0x00, 0x03,
+    // 0xF0 'ð'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x22, 0xD0, 0x3F, 0x41, 0x00, 0x00, 0x3F, 0x54, 0x40, 0x00, 0x7F,
+    0x08, 0x10, 0x00, 0x3F, 0x20, 0x50, 0x01, 0x3F, 0x02, 0x10, 0x01, 0x3F,
+    0x20, 0x40, 0x00, 0x7F, 0x54, 0xA0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x21, 0x01, 0x10, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x03, 0x60, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x20, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x02, 0x00, 0x8F, 0xFC,
+    0x00, 0x00, 0x00, 0x28, 0x80, 0x00, 0x04, 0x20, 0x04, 0x00, 0x40, 0x00,
+    0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x04, 0x20, 0x00,
+    0x20, 0x00, 0x00, 0x40, 0x88, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    // 0xF2 'ò'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x20, 0x02, 0xD0, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x88, 0x00, 0x00, 0x7F,
+    0x40, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x01, 0x3F, 0x08, 0x00, 0x01, 0x3F,
+    0x00, 0x50, 0x00, 0x7F, 0x00, 0x48, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x21, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x02, 0x10, 0x3F,
+    // 0xF3 'ó'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x02, 0xD0, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x06, 0x40, 0x00, 0x3F, 0x08, 0x00, 0x01, 0x3F, 0x22, 0x00, 0x01, 0x3F,
+    0x40, 0x50, 0x00, 0x7F, 0x80, 0x48, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x21, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x02, 0x10, 0x3F,
+    // 0xF4 'ô'
+    0x00, 0x05, 0xE0, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x05, 0xA0, 0x7F, 0x12, 0x10, 0x00, 0x7F, 0x24, 0x00, 0x00, 0xFF,
+    0x88, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x10, 0x00, 0x02, 0x7F,
+    0x08, 0xA0, 0x00, 0xFF, 0x40, 0x90, 0x04, 0x7F, 0x12, 0x80, 0x00, 0x7F,
+    0x08, 0x42, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x04, 0x20, 0x7F,
+    // 0xF5 'õ'
+    0x00, 0x05, 0xE0, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x08, 0x05, 0xA0, 0x7F, 0x44, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x00, 0xFF,
+    0x00, 0x80, 0x00, 0x7F, 0x08, 0x00, 0x02, 0x7F, 0x20, 0x00, 0x02, 0x7F,
+    0x00, 0xA0, 0x00, 0xFF, 0x04, 0x90, 0x04, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x42, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x04, 0x20, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x0B, 0xC0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0x40,
+    0x88, 0x20, 0x00, 0x00, 0x00, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x21, 0x40, 0x01, 0x01, 0x20, 0x08, 0x89, 0x00, 0x00,
+    0x50, 0x84, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x40,
+    // 0xF7 '÷'
+    0x01, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x0B, 0x84, 0x27,
+    0x14, 0x03, 0x14, 0x23, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+    0x00, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x05, 0xE2, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x03, 0xC0, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F,
+    0x20, 0x02, 0x7F, 0x00, 0x02, 0x7F, 0xA0, 0x00, 0xFF, 0x90, 0x04, 0x7F,
+    0x80, 0x08, 0x7F, 0x42, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F,
+    0x85, 0x20, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x7F, 0x44, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x12, 0x00, 0x00, 0x7F, 0x06, 0x20, 0x02, 0x3F, 0x00, 0x10, 0x02, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x02, 0x3F, 0x08, 0x00, 0x00, 0x3F,
+    0x12, 0x00, 0x00, 0x7F, 0x44, 0x20, 0x02, 0x3F, 0x88, 0x10, 0x02, 0x3F,
+    0x50, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x06, 0x7F, 0x04, 0x00, 0x01, 0x7F, 0x0A, 0x80, 0x00, 0x7F,
+    0x20, 0x00, 0x08, 0xFF, 0x44, 0x00, 0x04, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x40, 0x04, 0x7F, 0x44, 0x20, 0x04, 0x7F,
+    0x20, 0x80, 0x00, 0x7F, 0x08, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x80, 0x00, 0xFF, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x80, 0x00, 0x11, 0x40, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x08, 0x00, 0x40, 0x08,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+    // 0xFE 'þ'
+    0x20, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x03,
+    0x1F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x7F, 0xC7, 0xFC, 0xF3, 0x00, 0x10, 0x04, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x80, 0x01, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01,
+    0x00, 0x40, 0x00, 0x01, 0x00, 0x10, 0x18, 0x01, 0x00, 0x07, 0xC0, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11,
+    0x11, 0x0C, 0x00, 0x01, 0x01, 0x00, 0x00, 0x25, 0x89, 0x20, 0x00, 0x01,
+    0x01, 0x04, 0x18, 0x89, 0x21, 0x00, 0x01, 0x01, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x00, 0x00, 0x81, 0x50, 0x00, 0xC0, 0x01, 0x89, 0x00, 0x00, 0x01,
+    0x01, 0x18, 0x60, 0x01, 0x21, 0x01, 0x80, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x40, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x30, 0x07,
+    0x00, 0x60, 0x00, 0x07, 0x00, 0x00, 0x04, 0x07, 0x0C, 0x34, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x00, 0x07, 0x06, 0x04, 0x00, 0x07,
+    0x00, 0xC4, 0x00, 0x07, 0x30, 0x0C, 0x0C, 0x07, 0x02, 0x00, 0x08, 0x47,
+    0x00, 0x00, 0x20, 0x07, 0x00, 0x30, 0x02, 0x07, 0x00, 0x06, 0x01, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x105 'ą'
+    0x00, 0x24, 0x01, 0x20, 0x00, 0x01, 0x44, 0x80, 0x01, 0x04, 0x80, 0x81,
+    0x90, 0x04, 0x01, 0x81, 0x40, 0x81, 0x20, 0x00, 0x81, 0x20, 0x00, 0x01,
+    0xA1, 0x05, 0x01, 0x0E, 0x38, 0x21, 0x00, 0x00, 0x85, 0x40, 0x00, 0x01,
+    0x0F, 0xFC, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x09, 0x00, 0x02, 0x09,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x82, 0x03, 0x00, 0x06, 0x00, 0x83, 0x00, 0x08, 0x00, 0x23,
+    0x00, 0x20, 0x70, 0x13, 0x00, 0x02, 0x03, 0x03, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x03, 0x0C, 0x80, 0x00, 0x03, 0x14, 0x00, 0x00, 0x27,
+    0x00, 0x20, 0x00, 0x07, 0x20, 0x20, 0x00, 0x03, 0x48, 0x20, 0x00, 0x27,
+    0x08, 0x00, 0x00, 0x07, 0x80, 0x04, 0x00, 0x03, 0x60, 0x80, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x43,
+    // 0x107 'ć'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x21, 0xF0, 0x3F, 0x00, 0x08, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x7F,
+    0x0A, 0x40, 0x00, 0x7F, 0x02, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x48, 0x00, 0x7F, 0x00, 0x02, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x14, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x82, 0x03, 0x00, 0x06, 0x00, 0x83, 0x00, 0x08, 0x00, 0x23,
+    0x00, 0x20, 0x70, 0x13, 0x40, 0x02, 0x03, 0x03, 0x20, 0x40, 0x00, 0x03,
+    0x90, 0x80, 0x00, 0x03, 0x48, 0x80, 0x00, 0x03, 0x04, 0x00, 0x00, 0x27,
+    0x10, 0x20, 0x00, 0x07, 0x00, 0x20, 0x00, 0x03, 0x00, 0x20, 0x00, 0x27,
+    0x48, 0x00, 0x00, 0x07, 0x10, 0x04, 0x00, 0x03, 0x20, 0x80, 0x00, 0x23,
+    0x40, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x43,
+    // 0x10D 'č'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x60, 0x00, 0x01, 0x3F,
+    0x10, 0x21, 0xF0, 0x3F, 0x40, 0x08, 0x04, 0x3F, 0x00, 0x40, 0x00, 0x7F,
+    0x10, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x02, 0x3F, 0x22, 0x00, 0x00, 0x3F,
+    0x44, 0x48, 0x00, 0x7F, 0x10, 0x02, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x14, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x10E 'Ď'
+    0x00, 0xC0, 0x00, 0x1B, 0x00, 0x20, 0x00, 0x13, 0x00, 0xA0, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x03, 0x04, 0x00, 0x00, 0x23, 0x48, 0x20, 0x00, 0x0B,
+    0x10, 0x80, 0x00, 0x03, 0x20, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x74, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x83, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x10F 'ď'
+    0x00, 0x05, 0xE0, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x05, 0x81, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x50, 0x80, 0x01, 0x7F, 0x0F, 0x1F, 0xF2, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x03, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0x40, 0x00, 0x18, 0x0F, 0x20, 0x00, 0x10, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x50, 0x20, 0x0F, 0x00, 0x40, 0x20, 0x0F, 0x00, 0x40, 0x20, 0x0F,
+    0x00, 0x40, 0x21, 0x8F, 0x00, 0x40, 0x20, 0x2F, 0x00, 0x40, 0x24, 0x0F,
+    0x00, 0x00, 0x20, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x00, 0x60, 0xC0, 0x0F,
+    0x84, 0x00, 0x00, 0x6F, 0x00, 0x00, 0xD0, 0x0F,
+    // 0x119 'ę'
+    0x05, 0xE0, 0x01, 0x00, 0x04, 0x01, 0x20, 0x00, 0x01, 0x4A, 0xB0, 0x01,
+    0x90, 0x00, 0x01, 0x20, 0x04, 0x81, 0xA0, 0x04, 0x91, 0x20, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x90, 0x00, 0x51, 0x86, 0x04, 0x83, 0x00, 0x00, 0x09,
+    0x00, 0x04, 0x0D, 0x07, 0x00, 0x01,
+    // 0x11A 'Ě'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07,
+    0xA0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    0x24, 0x00, 0x50, 0x27, 0x00, 0x00, 0x40, 0x27, 0x00, 0x00, 0x40, 0x27,
+    0x04, 0x00, 0x40, 0x27, 0x08, 0x00, 0x40, 0x27, 0x90, 0x00, 0x40, 0x27,
+    0x80, 0x00, 0x00, 0x27, 0x80, 0x30, 0x00, 0x07, 0x00, 0x00, 0x60, 0xC7,
+    0x00, 0x84, 0x00, 0x07, 0x00, 0x00, 0x00, 0xD7,
+    // 0x11B 'ě'
+    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x20, 0x10, 0x00, 0x3F,
+    0x10, 0x25, 0x58, 0x3F, 0x00, 0x48, 0x00, 0x3F, 0x22, 0x10, 0x02, 0x7F,
+    0x00, 0x50, 0x02, 0x7F, 0x08, 0x10, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x48, 0x00, 0x7F, 0x10, 0x43, 0x02, 0x3F, 0x20, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x03, 0x80, 0x3F,
+    // 0x139 'Ĺ'
+    0x00, 0x40, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x17, 0x04, 0x20, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x27, 0x80, 0x00, 0x00, 0x27, 0x40, 0x40, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x01, 0xD7,
+    // 0x13A 'ĺ'
+    0x00, 0x40, 0x00, 0x01, 0x08, 0xA0, 0x00, 0x01, 0x00, 0xA0, 0x00, 0x01,
+    0x04, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x08, 0xFF, 0xFF, 0xF1, 0x08, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x13D 'Ľ'
+    0x08, 0x00, 0x03, 0x04, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+    0x08, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x32, 0x00, 0x04,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x3A,
+    // 0x13E 'ľ'
+    0x20, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x04, 0x1F, 0x20, 0x00, 0x17,
+    0x20, 0x08, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x27, 0x00, 0x00, 0x27, 0x41, 0x40, 0x27, 0x00, 0x40, 0x27,
+    0x00, 0x80, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x07, 0x00, 0x02, 0x07, 0x00, 0x01, 0xD7,
+    // 0x142 'ł'
+    0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x50, 0x00, 0x80, 0x50, 0x04, 0x00,
+    0x1F, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF8,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x80, 0x1B,
+    0x04, 0x04, 0x20, 0x03, 0x04, 0x02, 0x10, 0x03, 0x20, 0x00, 0x84, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x08, 0x00, 0x10, 0x03, 0x90, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x04, 0x23, 0x00, 0x20, 0x00, 0x0B, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0x144 'ń'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x47, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x10, 0x02, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x08, 0x00, 0xFF,
+    0x08, 0x00, 0x00, 0x7F, 0x12, 0x50, 0x00, 0x7F, 0x44, 0x10, 0x00, 0x7F,
+    0x88, 0x00, 0x00, 0x7F, 0x50, 0x44, 0x00, 0x7F, 0x20, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x80, 0x1B,
+    0x20, 0x04, 0x20, 0x03, 0x00, 0x02, 0x10, 0x03, 0x20, 0x00, 0x84, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x04, 0x23, 0x00, 0x20, 0x00, 0x0B, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0x148 'ň'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x47, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x10, 0x10, 0x02, 0x7F, 0x04, 0x20, 0x00, 0x7F, 0x22, 0x08, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x50, 0x00, 0x7F, 0x20, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x44, 0x00, 0x7F, 0x20, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0x152 'Œ'
+    0x00, 0x84, 0x03, 0x06, 0x01, 0x83, 0x08, 0x00, 0x03, 0x00, 0x30, 0x23,
+    0x20, 0x02, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x43, 0x90, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x80, 0x00, 0x27, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x3F, 0x8F, 0xE3, 0x00, 0x40, 0x23, 0x00, 0x40, 0x23, 0x00, 0x40, 0x23,
+    0x00, 0x40, 0x23, 0x00, 0x40, 0x23, 0x00, 0x40, 0x23, 0x20, 0x00, 0x03,
+    0x00, 0x60, 0xC3, 0x00, 0x01, 0x03, 0x00, 0x00, 0x2B,
+    // 0x153 'œ'
+    0x05, 0xE0, 0x7F, 0x00, 0x04, 0x7F, 0x20, 0x00, 0x7F, 0x05, 0xA1, 0x7F,
+    0x10, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x90, 0x04, 0x7F, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x0C, 0x01, 0x7F,
+    0x90, 0x08, 0x7F, 0x80, 0x04, 0xFF, 0x20, 0x04, 0xFF, 0x00, 0x00, 0x7F,
+    0xA0, 0x00, 0xFF, 0x10, 0x04, 0xFF, 0x00, 0x04, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x158 'Ř'
+    0x00, 0xC0, 0x00, 0x1B, 0x00, 0xA0, 0x00, 0x13, 0x00, 0xA0, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03,
+    0x24, 0x00, 0x28, 0x03, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x08, 0x13,
+    0x04, 0x20, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x80, 0x10, 0x43,
+    0x00, 0x06, 0x04, 0x03, 0x00, 0x00, 0x20, 0x03, 0x00, 0x40, 0x40, 0x03,
+    0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    // 0x159 'ř'
+    0x00, 0x10, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x01, 0x7F,
+    0x08, 0x47, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x12, 0x40, 0x00, 0x7F,
+    0x08, 0x12, 0x02, 0x7F, 0x00, 0x14, 0x00, 0x7F, 0x24, 0x28, 0x00, 0x7F,
+    0x40, 0x48, 0x00, 0x7F, 0x10, 0x48, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x48, 0x00, 0x7F, 0x00, 0x30, 0x00, 0x7F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x02, 0x03, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x1E, 0x20, 0x27, 0x04, 0xA0, 0x10, 0x03,
+    0x10, 0x20, 0x10, 0x03, 0x24, 0x20, 0x88, 0x03, 0x00, 0x20, 0x08, 0x07,
+    0x40, 0x20, 0x40, 0x23, 0x80, 0x30, 0x21, 0xCB, 0x30, 0x82, 0x00, 0x03,
+    0x00, 0x80, 0x10, 0x13, 0x00, 0x08, 0x0C, 0x83,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0E, 0x00, 0xBF, 0x00, 0x20, 0x88, 0x3F,
+    0x00, 0x04, 0x02, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x08, 0x50, 0x01, 0x3F,
+    0x12, 0x00, 0x01, 0x3F, 0x44, 0x10, 0x11, 0x7F, 0x80, 0x50, 0x82, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x20, 0x40, 0x01, 0x3F, 0x00, 0x28, 0x34, 0x3F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x02, 0x03, 0xA0, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x40, 0x1E, 0x20, 0x27, 0x24, 0xA0, 0x10, 0x03,
+    0x00, 0x20, 0x10, 0x03, 0x00, 0x20, 0x88, 0x03, 0x04, 0x20, 0x08, 0x07,
+    0x08, 0x20, 0x40, 0x23, 0x90, 0x30, 0x21, 0xCB, 0x80, 0x82, 0x00, 0x03,
+    0x80, 0x80, 0x10, 0x13, 0x00, 0x08, 0x0C, 0x83,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x0E, 0x00, 0xBF, 0x10, 0x20, 0x88, 0x3F,
+    0x00, 0x04, 0x02, 0x7F, 0x22, 0x10, 0x00, 0x7F, 0x10, 0x50, 0x01, 0x3F,
+    0x08, 0x00, 0x01, 0x3F, 0x20, 0x10, 0x11, 0x7F, 0x40, 0x50, 0x82, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x20, 0x40, 0x01, 0x3F, 0x00, 0x28, 0x34, 0x3F,
+    // 0x164 'Ť'
+    0x00, 0x64, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x14, 0x00, 0x07,
+    0x40, 0x20, 0x00, 0x07, 0x20, 0x00, 0x00, 0x17, 0x90, 0x00, 0x00, 0x17,
+    0x08, 0x00, 0x00, 0x07, 0x04, 0x20, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xFF, 0xE7, 0x48, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x07,
+    0x00, 0x38, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x04, 0x00, 0x07,
+    0x00, 0xE0, 0x00, 0x07,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x80, 0x04, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x02, 0x80, 0x00, 0xFF,
+    0x80, 0x80, 0x00, 0x7F, 0xF0, 0x80, 0x04, 0x7F, 0x00, 0x40, 0x07, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x10, 0x00, 0x81, 0x00, 0x00, 0x00, 0x21, 0x04, 0x20, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x03, 0xBC, 0x00, 0x00, 0x03, 0x21, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x13, 0x00, 0x60, 0x00, 0x01,
+    0x24, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x04, 0x40, 0x00, 0x3F,
+    0x02, 0x00, 0x04, 0x7F, 0x98, 0x00, 0x02, 0x3F, 0xA5, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x7F, 0x31, 0x20, 0x02, 0x3F, 0x00, 0x10, 0x02, 0x3F,
+    0x24, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    // 0x170 'Ű'
+    0x00, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x10, 0x00, 0x81, 0x04, 0x00, 0x00, 0x21, 0x0A, 0x20, 0x00, 0x01,
+    0x12, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x48, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x13, 0x00, 0x60, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x05, 0x20, 0x00, 0x00, 0x09,
+    0x48, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x03, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00, 0x3F,
+    0x08, 0x00, 0x04, 0x7F, 0x20, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x48, 0x00, 0x00, 0x7F, 0x20, 0x20, 0x02, 0x3F, 0x00, 0x10, 0x02, 0x3F,
+    0x02, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x48, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x0F,
+    0x88, 0x41, 0x00, 0x0F, 0x80, 0x10, 0x00, 0x0F, 0x30, 0x80, 0x10, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x70, 0x00, 0x80, 0x0F,
+    0x01, 0x80, 0x20, 0x0F, 0x88, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x04, 0x00, 0x3F, 0x00, 0x18, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x18, 0x00, 0x23, 0x00, 0x80, 0x00, 0x83, 0x00, 0x04, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x23, 0x00, 0x00, 0x10, 0xA3,
+    0x14, 0x00, 0x42, 0x23, 0x04, 0x00, 0x84, 0x23, 0x20, 0x02, 0x10, 0x23,
+    0x08, 0x00, 0x00, 0x23, 0x08, 0x08, 0x00, 0x23, 0x90, 0x20, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x90, 0x02, 0x03,
+    0x00, 0x40, 0x01, 0x53,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x32, 0x00, 0xBF, 0x00, 0x42, 0x04, 0x3F,
+    0x00, 0x4C, 0x00, 0x3F, 0x00, 0x40, 0x20, 0x3F, 0x00, 0x50, 0x04, 0x3F,
+    0x00, 0x50, 0x80, 0x3F, 0x10, 0x50, 0x10, 0x3F, 0x00, 0x54, 0x40, 0x3F,
+    0x04, 0x50, 0x00, 0x3F, 0x08, 0x41, 0x02, 0x3F, 0x70, 0x42, 0x02, 0x3F,
+    0x00, 0x48, 0x08, 0x3F, 0x00, 0x20, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x17B 'Ż'
+    0x00, 0x30, 0x00, 0x47, 0x01, 0x00, 0x01, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x40, 0x00, 0x47, 0x00, 0x00, 0x21, 0x47,
+    0x10, 0x00, 0x84, 0x47, 0x00, 0x01, 0x08, 0x47, 0x00, 0x04, 0x20, 0x47,
+    0x90, 0x00, 0x00, 0x47, 0x00, 0x10, 0x00, 0x47, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x01, 0x20, 0x04, 0x07,
+    0x00, 0x80, 0x02, 0xA7,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x00, 0x00, 0xC8, 0x02, 0x01, 0x08, 0x10, 0x01, 0x30, 0x00,
+    0x01, 0x00, 0x80, 0x21, 0x40, 0x10, 0x81, 0x42, 0x00, 0x89, 0x40, 0x40,
+    0x01, 0x51, 0x00, 0x31, 0x40, 0x00, 0x01, 0x04, 0x08, 0x01, 0x08, 0x08,
+    0x01, 0x20, 0x20, 0x00, 0x80, 0x44, 0x00, 0x00, 0x00,
+    // 0x17D 'Ž'
+    0x00, 0x18, 0x00, 0x23, 0x00, 0x80, 0x00, 0x83, 0x00, 0x04, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x23, 0x40, 0x00, 0x10, 0xA3,
+    0x24, 0x00, 0x42, 0x23, 0x00, 0x00, 0x84, 0x23, 0x00, 0x02, 0x10, 0x23,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x08, 0x00, 0x23, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x90, 0x02, 0x03,
+    0x00, 0x40, 0x01, 0x53,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x32, 0x00, 0xBF, 0x00, 0x42, 0x04, 0x3F,
+    0x10, 0x4C, 0x00, 0x3F, 0x00, 0x40, 0x20, 0x3F, 0x24, 0x50, 0x04, 0x3F,
+    0x02, 0x50, 0x80, 0x3F, 0x08, 0x50, 0x10, 0x3F, 0x10, 0x54, 0x40, 0x3F,
+    0x00, 0x50, 0x00, 0x3F, 0x08, 0x41, 0x02, 0x3F, 0x20, 0x42, 0x02, 0x3F,
+    0x40, 0x48, 0x08, 0x3F, 0x00, 0x20, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x90, 0x00, 0x7F,
+    0x90, 0x14, 0x7F, 0x9D, 0x80, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x72, 0x7F,
+    0x90, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0x90, 0x00, 0x7F,
+    0x87, 0x0E, 0x7F, 0x80, 0x00, 0x7F, 0x8F, 0xE0, 0x7F, 0x90, 0x08, 0x7F,
+    0x10, 0x04, 0x7F, 0x10, 0x05, 0x7F, 0xA0, 0x05, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xF1,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x21, 0x00, 0x01, 0x44, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x00, 0x00, 0x05, 0x10, 0x00, 0x05, 0x10, 0x10, 0x01,
+    0x10, 0x80, 0x03, 0x03, 0x08, 0x01, 0x14, 0x48, 0x09, 0x40, 0xA0, 0x01,
+    0x00, 0x24, 0x03, 0x08, 0x00, 0x01, 0x30, 0x10, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x41,
+    // 0x2013 '–'
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF,
+    // 0x2014 '—'
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    // 0x2018 '‘'
+    0x04, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x08, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x2019 '’'
+    0x00, 0x3F, 0x40, 0x3F, 0x0E, 0x3F, 0x00, 0xBF, 0x01, 0x3F, 0x14, 0x3F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x41, 0xBF, 0x8A, 0x3F, 0x00, 0xBF, 0x82, 0x3F, 0x70, 0x3F,
+    // 0x201B '‛'
+    0x00, 0x3F, 0x03, 0x3F, 0x00, 0xBF, 0x12, 0x3F, 0x40, 0xFF, 0x00, 0x3F,
+    // 0x201C '“'
+    0x04, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x08, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x04, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x08, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x201D '”'
+    0x00, 0x3F, 0x40, 0x3F, 0x0E, 0x3F, 0x00, 0xBF, 0x01, 0x3F, 0x14, 0x3F,
+    0x00, 0x3F, 0x40, 0x3F, 0x0E, 0x3F, 0x00, 0xBF, 0x01, 0x3F, 0x14, 0x3F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x41, 0xBF, 0x8A, 0x3F, 0x00, 0xBF, 0x82, 0x3F, 0x70, 0x3F,
+    0x00, 0x3F, 0x41, 0xBF, 0x8A, 0x3F, 0x00, 0xBF, 0x82, 0x3F, 0x70, 0x3F,
+    // 0x201F '‟'
+    0x00, 0x3F, 0x03, 0x3F, 0x00, 0xBF, 0x12, 0x3F, 0x40, 0xFF, 0x00, 0x3F,
+    0x00, 0x3F, 0x03, 0x3F, 0x00, 0xBF, 0x12, 0x3F, 0x40, 0xFF, 0x00, 0x3F,
+    // 0x2020 '†'
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x80, 0x0F,
+    0x02, 0x00, 0x0F, 0x06, 0xFE, 0x1F, 0x00, 0x00, 0x0F, 0x0E, 0x9E, 0x1F,
+    0x02, 0x00, 0x0F, 0x00, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x0F,
+    // 0x2021 '‡'
+    0x02, 0x01, 0x20, 0x00, 0x01, 0x20, 0x02, 0x00, 0x00, 0x00, 0x81, 0x00,
+    0x02, 0x00, 0x40, 0x06, 0xC1, 0x21, 0x00, 0x00, 0x00, 0x0E, 0xC3, 0x21,
+    0x02, 0x00, 0x40, 0x00, 0x81, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x20,
+    0x02, 0x01, 0x20,
+    // 0x2022 '•'
+    0x09, 0x05, 0x01, 0x03, 0x01, 0x05, 0x09,
+    // 0x2026 '…'
+    0x07, 0x07, 0x0F, 0x0F, 0x97, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x0F, 0x0F, 0x97, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F,
+    0x97, 0x07,
+    // 0x2039 '‹'
+    0x04, 0x0F, 0x08, 0x8F, 0x00, 0x4F, 0x02, 0x0F, 0x48, 0x8F, 0x00, 0x4F,
+    0x20, 0x1F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x40, 0x0F, 0x00, 0x1F, 0x50, 0x9F, 0x00, 0x2F, 0x00, 0x4F, 0x10, 0x0F,
+    0x08, 0x0F, 0x04, 0x0F,
+    // 0x2070 '⁰'
+    0x04, 0x31, 0x00, 0x09, 0x03, 0x81, 0x10, 0x11, 0x20, 0x01, 0x80, 0x03,
+    0x80, 0x01, 0x00, 0x11, 0x07, 0x85, 0x00, 0x01, 0x20, 0x31, 0x07, 0x81,
+    // 0x2074 '⁴'
+    0x00, 0xC1, 0x00, 0x01, 0x02, 0x01, 0x08, 0x81, 0x02, 0x01, 0x20, 0x01,
+    0x0F, 0x8D, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x61,
+    // 0x2075 '⁵'
+    0x00, 0x01, 0x00, 0x0D, 0x66, 0x09, 0x80, 0x03, 0x98, 0x01, 0xA1, 0x11,
+    0xA5, 0x05, 0xA4, 0xC1, 0xA2, 0x09, 0xA0, 0xE1,
+    // 0x2076 '⁶'
+    0x00, 0x01, 0x00, 0x11, 0x10, 0x01, 0x21, 0xA5, 0x01, 0x01, 0x44, 0x03,
+    0x85, 0x01, 0x00, 0x11, 0x80, 0x65, 0x00, 0x01, 0x41, 0xA1,
+    // 0x2077 '⁷'
+    0x68, 0x01, 0x80, 0x01, 0x90, 0x15, 0xA0, 0x41, 0xA1, 0x05, 0xA0, 0x01,
+    0xB1, 0x81, 0x82, 0x01, 0x80, 0x01, 0x10, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x01, 0x00, 0x89, 0x41, 0x01, 0x00, 0x31, 0x00, 0x09, 0x84, 0x03,
+    0xA4, 0x09, 0x28, 0x51, 0x02, 0x01, 0x40, 0x09, 0x00, 0x11,
+    // 0x2079 '⁹'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x01, 0x94, 0x8B, 0x22, 0x01, 0xA0, 0x51,
+    0x81, 0x45, 0x91, 0x09, 0x00, 0x11, 0x00, 0x01, 0x1E, 0x81,
+    // 0x2080 '₀'
+    0x04, 0x31, 0x00, 0x09, 0x03, 0x85, 0x10, 0x11, 0x80, 0x03, 0x00, 0x0B,
+    0x00, 0x03, 0x00, 0x01, 0x0F, 0x81, 0x00, 0x09, 0x30, 0x31, 0x07, 0x81,
+    // 0x2081 '₁'
+    0x20, 0x03, 0x00, 0x03, 0x40, 0x0B, 0x5F, 0xF3, 0x00, 0x03, 0x00, 0x03,
+    0x3F, 0xF3, 0x00, 0x03, 0x00, 0x07,
+    // 0x2082 '₂'
+    0x28, 0x03, 0x44, 0x23, 0x10, 0x43, 0xA0, 0x93, 0x00, 0x13, 0x02, 0x53,
+    0x0C, 0x93, 0x01, 0x13, 0x40, 0x13, 0x18, 0x13,
+    // 0x2083 '₃'
+    0x30, 0x05, 0x40, 0x0B, 0x00, 0x8B, 0x00, 0x03, 0x24, 0x01, 0x00, 0x81,
+    0x80, 0x25, 0x00, 0x09, 0x11, 0x01, 0x00, 0x01,
+    // 0x2084 '₄'
+    0x00, 0xC1, 0x00, 0x01, 0x02, 0x01, 0x00, 0x81, 0x02, 0x01, 0x20, 0x01,
+    0x0F, 0x8D, 0x80, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x61,
+    // 0x2085 '₅'
+    0x00, 0x01, 0x00, 0x01, 0x66, 0x0B, 0x80, 0x0B, 0x98, 0x03, 0x81, 0x11,
+    0x85, 0x15, 0x84, 0x45, 0x82, 0x01, 0x00, 0xB1,
+    // 0x2086 '₆'
+    0x00, 0x01, 0x00, 0x11, 0x10, 0x05, 0x21, 0xA1, 0x05, 0x11, 0x45, 0x0B,
+    0x14, 0x0B, 0x20, 0x11, 0x20, 0x65, 0x82, 0x01, 0x41, 0x81,
+    // 0x2087 '₇'
+    0x68, 0x01, 0x80, 0x01, 0x80, 0x15, 0x80, 0x03, 0x81, 0x05, 0x80, 0x01,
+    0x81, 0x81, 0x82, 0x01, 0x88, 0x01, 0x10, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x01, 0x00, 0x89, 0x42, 0x01, 0x00, 0x21, 0x80, 0x0B, 0x24, 0x03,
+    0x24, 0x83, 0x18, 0x41, 0x01, 0x05, 0x40, 0x09, 0x00, 0x11,
+    // 0x2089 '₉'
+    0x00, 0x01, 0x23, 0x01, 0x00, 0x8B, 0x10, 0x0B, 0x20, 0x41, 0x01, 0x01,
+    0x21, 0x61, 0x91, 0x09, 0x00, 0x11, 0x00, 0x01, 0x1E, 0x81,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0x00, 0x08, 0x03, 0x00, 0x10, 0x03, 0x00, 0x90, 0x03, 0x00, 0xA5, 0x03,
+    0x06, 0x00, 0x43, 0x08, 0x00, 0x23, 0x00, 0x26, 0x13, 0x02, 0x90, 0x0B,
+    0x08, 0x90, 0x03, 0x10, 0x80, 0x03, 0x00, 0x80, 0x07, 0x80, 0x84, 0x23,
+    0xA0, 0x00, 0x03, 0xA0, 0x00, 0x07, 0xA0, 0x00, 0x23, 0x1C, 0x00, 0x03,
+    0x80, 0x00, 0x23, 0x70, 0x00, 0x33,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0x60, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x40, 0x9F, 0x00, 0x1F, 0x3F, 0x9F,
+    0x40, 0x9F, 0x40, 0x5F, 0x10, 0x1F, 0xA0, 0x1F, 0x00, 0x1F, 0x1C, 0x9F,
+    0x00, 0x1F, 0x1C, 0x9F, 0x80, 0x1F, 0x19, 0x1F, 0x04, 0x9F, 0x03, 0x1F,
+    0xC0, 0x5F, 0x06, 0x9F, 0x20, 0x1F, 0xC1, 0x1F, 0x00, 0x1F,
+    // 0x2153 '⅓'
+    0x10, 0x00, 0x00, 0x28, 0x02, 0x00, 0x08, 0x02, 0x00, 0x07, 0xFA, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x02, 0x04,
+    0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x20,
+    0x00, 0x04, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x44, 0x00, 0x01, 0x00, 0x00,
+    0x06, 0x40, 0x00, 0x08, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x48, 0x02, 0x00, 0x00, 0x88, 0x00, 0x82, 0x0A, 0x00, 0x04, 0x00,
+    0x00, 0xA0, 0x80, 0x00, 0x00, 0x64, 0x00, 0x44, 0x08, 0x00, 0x08, 0x80,
+    // 0x2154 '⅔'
+    0x04, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x08, 0x02, 0x00, 0x00, 0x4A, 0x00,
+    0x50, 0x92, 0x00, 0x51, 0x02, 0x00, 0x42, 0x42, 0x00, 0x40, 0x02, 0x00,
+    0x01, 0x02, 0x00, 0x0C, 0x02, 0x21, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x84, 0x00, 0x00,
+    0x80, 0x48, 0x02, 0x00, 0x00, 0x88, 0x00, 0x82, 0x0A, 0x00, 0x04, 0x00,
+    0x00, 0xA0, 0x80, 0x00, 0x00, 0x64, 0x00, 0x44, 0x08, 0x00, 0x08, 0x80,
+    // 0x215B '⅛'
+    0x10, 0x00, 0x00, 0x28, 0x02, 0x00, 0x08, 0x02, 0x00, 0x07, 0xFA, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10,
+    0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x24, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x84, 0x0C, 0x80,
+    0x90, 0x40, 0x04, 0x00, 0x10, 0x10, 0x00, 0xA4, 0x02, 0x00, 0x20, 0x88,
+    0x00, 0x04, 0x82, 0x00, 0x98, 0x10, 0x00, 0x01, 0x04, 0x00, 0x20, 0x88,
+    0x00, 0x00, 0x50,
+    // 0x215C '⅜'
+    0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x40, 0x08, 0x00, 0x50, 0x0A, 0x00, 0x08, 0x50, 0x02, 0x03, 0x00, 0x05,
+    0x18, 0x88, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x98, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x20, 0x00,
+    0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x10, 0x0C, 0x80,
+    0x20, 0x40, 0x04, 0x00, 0x10, 0x10, 0x00, 0xA4, 0x02, 0x00, 0x20, 0x88,
+    0x00, 0x04, 0x82, 0x00, 0x98, 0x10, 0x00, 0x01, 0x04, 0x00, 0x20, 0x88,
+    0x00, 0x00, 0x50,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x10, 0x08, 0x00, 0x10, 0x80, 0x00, 0x10, 0x60, 0x02,
+    0x10, 0x04, 0x08, 0x50, 0x60, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x02, 0x40, 0x00, 0x01, 0x80, 0x00, 0x02, 0x00, 0x00, 0x88, 0x00,
+    0x02, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x11, 0x00, 0x00, 0x40, 0x00, 0x20,
+    0x00, 0x0C, 0x80, 0x40, 0x40, 0x04, 0x00, 0x10, 0x10, 0x00, 0xA4, 0x02,
+    0x00, 0x20, 0x88, 0x00, 0x04, 0x82, 0x00, 0x98, 0x10, 0x00, 0x01, 0x04,
+    0x00, 0x20, 0x88, 0x00, 0x00, 0x50,
+    // 0x215E '⅞'
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x00, 0x10, 0x60, 0x00,
+    0x11, 0x82, 0x00, 0x12, 0x00, 0x00, 0x18, 0xC0, 0x08, 0x03, 0x00, 0x31,
+    0x00, 0x00, 0x44, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x22, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x0C, 0x80,
+    0x00, 0x40, 0x04, 0x00, 0x10, 0x10, 0x00, 0xA4, 0x02, 0x00, 0x20, 0x88,
+    0x00, 0x04, 0x82, 0x00, 0x98, 0x10, 0x00, 0x01, 0x04, 0x00, 0x20, 0x88,
+    0x00, 0x00, 0x50,
+    // 0x2190 '←'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x47, 0x05, 0x27, 0x04, 0x97, 0x04, 0x47,
+    0x64, 0x07, 0x04, 0x07, 0x04, 0x07, 0x05, 0x07, 0x01, 0x07, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x05, 0x07,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x28, 0x00, 0x0F,
+    0x50, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    0x28, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x05, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x07, 0x05, 0x07, 0x04, 0x07, 0x04, 0x07, 0x64, 0x07,
+    0x04, 0x47, 0x04, 0x97, 0x05, 0x27, 0x00, 0x47, 0x00, 0x07, 0x00, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x02, 0x0F, 0x00, 0x09, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x09, 0x0F, 0x00, 0x06, 0x0F,
+    // 0x2194 '↔'
+    0x05, 0x07, 0x08, 0x07, 0x10, 0x07, 0x21, 0x07, 0x4C, 0x07, 0x14, 0x07,
+    0x24, 0x17, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x24, 0x37,
+    0x14, 0x07, 0x4C, 0x07, 0x25, 0x07, 0x10, 0x07, 0x08, 0x07, 0x07, 0x07,
+    // 0x2195 '↕'
+    0x06, 0x00, 0x07, 0x08, 0x00, 0x07, 0x10, 0x02, 0x07, 0x04, 0x01, 0x27,
+    0x08, 0x00, 0x17, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x17,
+    0x04, 0x01, 0x27, 0x10, 0x02, 0x07, 0x08, 0x00, 0x07, 0x06, 0x00, 0x07,
+    // 0x21D0 '⇐'
+    0x00, 0x03, 0x04, 0x03, 0x02, 0x43, 0x04, 0x23, 0x05, 0x13, 0x15, 0x4B,
+    0x15, 0x6B, 0x55, 0x53, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x03, 0x05, 0x03, 0x15, 0x03,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x3F,
+    0x02, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x15, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x55, 0x53, 0x15, 0x6B,
+    0x15, 0x4B, 0x05, 0x13, 0x04, 0x23, 0x02, 0x43, 0x04, 0x03, 0x00, 0x03,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x24, 0x3F, 0x00, 0x12, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x12, 0x3F, 0x00, 0x24, 0x3F,
+    0x00, 0x08, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D4 '⇔'
+    0x04, 0x03, 0x08, 0x03, 0x13, 0x03, 0x25, 0x23, 0x05, 0x13, 0x05, 0x6B,
+    0x35, 0x0B, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x35, 0x0B,
+    0x05, 0x6B, 0x05, 0x13, 0x25, 0x23, 0x13, 0x03, 0x08, 0x03, 0x04, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x01, 0x30, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0xD0, 0x7F, 0x50, 0x04, 0x04, 0xFF, 0x50, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0xA0, 0x04, 0x7F, 0x00, 0xA0, 0x09, 0x7F,
+    0x00, 0xA0, 0x02, 0x7F, 0x40, 0x10, 0xC4, 0x7F, 0x02, 0x04, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x80, 0x7F, 0x01, 0xF8, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x03,
+    0x00, 0x18, 0x03, 0x00, 0x01, 0x93, 0x03, 0x00, 0x13, 0x08, 0x30, 0x03,
+    0x01, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x40, 0x80, 0x03,
+    0x00, 0x18, 0x13, 0x06, 0x03, 0x13, 0x00, 0xC0, 0x73, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0x40, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x04, 0x7F,
+    0x04, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x01, 0x00, 0x44, 0x7F,
+    0x10, 0x41, 0x00, 0x7F, 0x04, 0x00, 0x20, 0x7F, 0x00, 0x10, 0x40, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x24, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x20, 0x00, 0x02, 0x7F,
+    0x08, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x64, 0x00, 0x16, 0x3F,
+    // 0x221A '√'
+    0x00, 0x08, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x60, 0x07, 0x00, 0x08, 0x08, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x06, 0x07,
+    0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x50, 0x07, 0x00, 0x03, 0x02, 0x07,
+    0x00, 0x08, 0x18, 0x07, 0x01, 0x00, 0xC0, 0x07, 0x0C, 0x02, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x18, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x0A, 0x1F, 0x00, 0x9F, 0x06, 0x5F, 0x11, 0x1F, 0x80, 0x3F, 0xA0, 0x3F,
+    0x11, 0x1F, 0x0A, 0x1F, 0x04, 0x9F, 0x00, 0x1F, 0x24, 0x1F, 0x42, 0x1F,
+    0x01, 0x1F, 0xA0, 0x3F, 0xA0, 0x3F, 0x80, 0x1F, 0x40, 0x1F, 0x20, 0x9F,
+    0x0C, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x71, 0x18, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0xC1, 0x10, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x50, 0x00, 0x00, 0x01,
+    // 0x2260 '≠'
+    0x14, 0x03, 0x04, 0x03, 0x04, 0x3B, 0x04, 0x0B, 0x04, 0x13, 0x04, 0x03,
+    0x00, 0x83, 0x02, 0x03, 0x04, 0x03, 0x84, 0x03, 0x64, 0x03, 0x04, 0x03,
+    0x00, 0xA3,
+    // 0x2264 '≤'
+    0x05, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x80, 0x3F, 0x0A, 0x40, 0x3F,
+    0x11, 0x40, 0x3F, 0x15, 0x20, 0x3F, 0x20, 0x80, 0x3F, 0x28, 0x90, 0x3F,
+    0x40, 0x40, 0x3F, 0x50, 0x40, 0x3F, 0x90, 0x20, 0x3F, 0x20, 0x04, 0x3F,
+    0x00, 0x10, 0x3F,
+    // 0x2265 '≥'
+    0x00, 0x08, 0x3F, 0x00, 0x04, 0x3F, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x3F, 0x24, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x12, 0x00, 0x3F,
+    0x0B, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x3F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x3F, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x81, 0x9E, 0x00, 0x00,
+    0x00, 0x00, 0x04,
+    // 0x22 '"'
+    0x38, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x7F, 0x00, 0x3F, 0x40, 0x3F,
+    // 0x23 '#'
+    0x00, 0x00, 0x1F, 0x00, 0x04, 0x1F, 0x06, 0x04, 0x1F, 0x02, 0x04, 0xDF,
+    0x02, 0x10, 0x1F, 0x00, 0x81, 0x9F, 0x18, 0x04, 0x1F, 0x81, 0x84, 0x1F,
+    0x9A, 0x04, 0x1F, 0x02, 0x04, 0x5F, 0x02, 0x00, 0x1F, 0x02, 0xC0, 0xDF,
+    0x08, 0x04, 0x1F, 0x40, 0x84, 0x1F, 0x8A, 0x04, 0x1F, 0x82, 0x04, 0x1F,
+    0x02, 0x08, 0x1F, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x24 '$'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x01, 0x08, 0x40, 0x03,
+    0x00, 0x04, 0x01, 0x03, 0x00, 0xA0, 0x04, 0x03, 0x00, 0x02, 0x00, 0x03,
+    0x0A, 0x08, 0x1C, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x78, 0xC0, 0x03,
+    0x0A, 0x04, 0x00, 0x03, 0x08, 0x00, 0x81, 0x03, 0x00, 0x82, 0x30, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x02, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x25 '%'
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x08, 0x00, 0x06, 0x64, 0x00,
+    0x50, 0x10, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x02, 0x50, 0x14, 0x08,
+    0x07, 0xC0, 0x22, 0x20, 0x00, 0x08, 0x08, 0x21, 0x20, 0x00, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x90, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x84, 0x10, 0x12, 0x10, 0x00, 0x40, 0x23, 0xE0, 0x90, 0x00, 0x00,
+    0x40, 0x10, 0x0A, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+    // 0x26 '&'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x10, 0x09, 0x00, 0x03, 0x81,
+    0x18, 0xC8, 0x05, 0x00, 0x00, 0x11, 0x44, 0x00, 0x01, 0x00, 0x40, 0x01,
+    0xA0, 0x11, 0x0B, 0x80, 0x08, 0x89, 0xA1, 0x00, 0x01, 0x92, 0x80, 0x01,
+    0x00, 0x00, 0x11, 0x02, 0x00, 0x85, 0x00, 0x00, 0x09, 0x00, 0x02, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x11, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x27 '''
+    0x38, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F,
+    // 0x28 '('
+    0x00, 0x07, 0xC0, 0x03, 0x00, 0x40, 0x08, 0x03, 0x02, 0x00, 0x01, 0x03,
+    0x00, 0x30, 0x60, 0x03, 0x11, 0x00, 0x04, 0x03, 0x24, 0x00, 0x01, 0x13,
+    0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x23,
+    0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x80, 0x04, 0x43,
+    0x08, 0x18, 0x60, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x80, 0x10, 0x03,
+    0x00, 0x0F, 0x00, 0x03,
+    // 0x2A '*'
+    0x00, 0x3F, 0x22, 0x3F, 0x40, 0xBF, 0x2D, 0x3F, 0x12, 0x3F, 0x73, 0xFF,
+    0x8E, 0x3F, 0x28, 0xFF, 0x00, 0x3F, 0x02, 0x3F, 0x00, 0x3F,
+    // 0x2B '+'
+    0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x7C, 0xFB, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x03, 0x03,
+    // 0x2C ','
+    0x00, 0x3F, 0x00, 0x3F, 0x02, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0x84, 0x3F,
+    0x20, 0x3F,
+    // 0x2D '-'
+    0xDF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0xBF, 0x1F,
+    // 0x2E '.'
+    0x07, 0x47, 0x87, 0x87, 0x07, 0x07,
+    // 0x2F '/'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x01, 0x04,
+    0x00, 0x04, 0x20, 0x00, 0x10, 0x80, 0x00, 0x82, 0x00, 0x02, 0x10, 0x00,
+    0x08, 0x40, 0x00, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x30 '0'
+    0x00, 0xFE, 0x03, 0x04, 0x00, 0x43, 0x10, 0x00, 0x03, 0x20, 0xFC, 0x03,
+    0x44, 0x00, 0x8B, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xA0, 0x00, 0x07,
+    0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x4B,
+    0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x04, 0x01, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x0F, 0x28, 0x00, 0x17, 0x08, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x47, 0xFF, 0xC7, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x7F, 0xFF, 0xE7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x32 '2'
+    0x0C, 0x00, 0x37, 0x20, 0x00, 0x47, 0x00, 0x00, 0x87, 0x08, 0x01, 0x07,
+    0x00, 0x02, 0x47, 0xA0, 0x04, 0x87, 0xA0, 0x09, 0x07, 0xA0, 0x12, 0x07,
+    0x80, 0x00, 0x07, 0x90, 0x88, 0x07, 0x00, 0x10, 0x07, 0x40, 0x20, 0x07,
+    0x20, 0x80, 0x07, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    // 0x33 '3'
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x07, 0xA0, 0x50, 0x03, 0xA0, 0x10, 0x23, 0xA0, 0x90, 0x03,
+    0x80, 0x10, 0x4B, 0x92, 0x08, 0x83, 0x00, 0x00, 0x13, 0x40, 0x20, 0x23,
+    0x1E, 0x10, 0x43, 0x00, 0x06, 0x03,
+    // 0x34 '4'
+    0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x04, 0x03,
+    0x01, 0x10, 0x03, 0x02, 0x00, 0x03, 0x00, 0x80, 0x03, 0x11, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0xFF, 0xFC, 0xFB, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x35 '5'
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x01, 0xC0, 0x13, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x03, 0x9C, 0x00, 0x03, 0x81, 0x20, 0x23, 0x81, 0x00, 0x03,
+    0x80, 0x00, 0x4B, 0x80, 0x00, 0x83, 0x80, 0x00, 0x03, 0x80, 0x40, 0x23,
+    0x80, 0x20, 0x83, 0x60, 0x00, 0x03,
+    // 0x36 '6'
+    0x00, 0x3F, 0x03, 0x01, 0x00, 0x03, 0x04, 0x00, 0x13, 0x08, 0x1E, 0x0B,
+    0x11, 0xA0, 0x43, 0x20, 0xA0, 0x23, 0x00, 0x00, 0x03, 0x00, 0x20, 0x07,
+    0x10, 0xA0, 0x03, 0x80, 0x80, 0x03, 0xA0, 0x08, 0x43, 0xA0, 0x40, 0x03,
+    0x80, 0x00, 0x13, 0x00, 0x10, 0x43, 0x00, 0x00, 0x03,
+    // 0x37 '7'
+    0x62, 0x00, 0x03, 0x82, 0x00, 0x03, 0x98, 0x00, 0x03, 0x80, 0x00, 0xCB,
+    0x80, 0x02, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0xC3, 0x80, 0x84, 0x03,
+    0x82, 0x10, 0x03, 0x80, 0x40, 0x03, 0x80, 0x00, 0x03, 0x82, 0x00, 0x03,
+    0x88, 0x00, 0x03, 0x10, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x03, 0xC3, 0x0E, 0x00, 0x03, 0x20, 0x80, 0x03, 0x40, 0x43, 0x8B,
+    0x02, 0x20, 0x23, 0x81, 0x00, 0x03, 0xA0, 0x90, 0x07, 0xA0, 0x10, 0x07,
+    0xA0, 0x80, 0x03, 0x80, 0x00, 0x03, 0x12, 0x64, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x1E, 0x00, 0x23, 0x00, 0x00, 0x03,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x08, 0xC0, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x17,
+    0x08, 0x88, 0x07, 0x80, 0x00, 0x03, 0xA0, 0x00, 0x03, 0xA0, 0x04, 0x4B,
+    0xA0, 0x14, 0x03, 0x80, 0x14, 0x13, 0x00, 0x02, 0x23, 0x04, 0x00, 0x43,
+    0x00, 0x00, 0x83, 0x00, 0x02, 0x03, 0x0C, 0x18, 0x03, 0x00, 0x00, 0x03,
+    // 0x3A ':'
+    0x00, 0x00, 0x10, 0x08, 0x80, 0x10, 0x00, 0x10, 0x90, 0x00, 0x00, 0x00,
+    // 0x3B ';'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x60, 0x00, 0x47, 0x80, 0x00, 0x17,
+    0x00, 0x10, 0x07, 0x80, 0x10, 0x87, 0x60, 0x04, 0x07,
+    // 0x3C '<'
+    0x01, 0x03, 0x00, 0x03, 0x00, 0x83, 0x02, 0x03, 0x00, 0x43, 0x04, 0x03,
+    0x00, 0x23, 0x08, 0x03, 0x00, 0x03, 0x10, 0x03, 0x00, 0x23, 0xA0, 0x03,
+    0x00, 0x13,
+    // 0x3D '='
+    0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0xC2,
+    // 0x3E '>'
+    0x60, 0x13, 0x80, 0x03, 0x10, 0x23, 0x40, 0x03, 0x08, 0x43, 0x20, 0x03,
+    0x04, 0x83, 0x10, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x03, 0x03,
+    // 0x3F '?'
+    0x60, 0x00, 0x01, 0x00, 0x00, 0x01, 0x90, 0x21, 0x15, 0x90, 0x00, 0x03,
+    0x90, 0x04, 0x01, 0x10, 0x40, 0x05, 0x00, 0x48, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x10, 0x01, 0x08, 0x20, 0x01, 0x03, 0x80, 0x01,
+    // 0x40 '@'
+    0x00, 0x0F, 0x80, 0x1F, 0x00, 0x40, 0x10, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x04, 0x30, 0x40, 0x1F, 0x08, 0x80, 0x11, 0x1F, 0x10, 0x00, 0x04, 0x9F,
+    0x04, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x5F, 0x00, 0x01, 0xC1, 0x1F,
+    0x50, 0x80, 0x00, 0x1F, 0x00, 0x24, 0x10, 0x1F, 0x01, 0x02, 0x40, 0x3F,
+    0x00, 0x80, 0x00, 0xBF, 0x20, 0x88, 0x10, 0xBF, 0xA0, 0x08, 0x40, 0xBF,
+    0x20, 0x13, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x60, 0x10, 0x1F,
+    0x00, 0x00, 0x50, 0x1F, 0x40, 0x00, 0x51, 0x5F, 0x08, 0x00, 0x50, 0x1F,
+    0x20, 0x00, 0x00, 0x9F, 0x02, 0x00, 0x20, 0x1F, 0x00, 0xEC, 0x00, 0x1F,
+    0x04, 0x00, 0x80, 0x1F, 0x01, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x43,
+    0x00, 0x02, 0x03, 0x00, 0x08, 0x23, 0x00, 0x20, 0x83, 0x01, 0x01, 0x0F,
+    0x04, 0x25, 0x03, 0x20, 0x85, 0x03, 0x44, 0x05, 0x03, 0x04, 0x05, 0x03,
+    0x00, 0x85, 0x03, 0x10, 0x15, 0x07, 0x06, 0x01, 0x0B, 0x00, 0x80, 0x43,
+    0x00, 0x10, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0x83, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    // 0x42 'B'
+    0x20, 0x00, 0x05, 0x40, 0x00, 0x09, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x08, 0x01, 0x48, 0x48, 0x15,
+    0x02, 0x00, 0x25, 0x20, 0x23, 0x81, 0x10, 0x90, 0x09, 0x00, 0x08, 0x11,
+    0x00, 0x03, 0x81,
+    // 0x43 'C'
+    0x00, 0x3E, 0x01, 0x01, 0x00, 0x41, 0x04, 0x00, 0x01, 0x00, 0x38, 0x01,
+    0x00, 0x00, 0x81, 0x24, 0x00, 0x45, 0x08, 0x00, 0x21, 0x40, 0x00, 0x01,
+    0x10, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x11, 0x0C, 0x00, 0x11, 0x41, 0x00, 0x11, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x09,
+    // 0x44 'D'
+    0x20, 0x00, 0x05, 0x40, 0x00, 0x09, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x15,
+    0x40, 0x00, 0x05, 0x48, 0x00, 0x01, 0x00, 0x00, 0x09, 0x22, 0x00, 0x81,
+    0x00, 0xC6, 0x11, 0x00, 0x00, 0x21, 0x04, 0x00, 0x01, 0x01, 0x82, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x50, 0x07, 0x20, 0x50, 0x07,
+    0x20, 0x50, 0x07, 0x20, 0x50, 0x07, 0x20, 0x50, 0x07, 0x20, 0x50, 0x07,
+    0x20, 0x10, 0x07, 0x20, 0x10, 0x27, 0x04, 0x00, 0x47, 0x80, 0x00, 0x07,
+    0x00, 0x01, 0xE7,
+    // 0x46 'F'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x0F, 0x20, 0x00, 0x07, 0x20, 0x40, 0x07,
+    0x20, 0x40, 0x07, 0x04, 0x30, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0x3E, 0x01, 0x01, 0x00, 0x41, 0x04, 0x00, 0x01, 0x00, 0x38, 0x01,
+    0x11, 0x00, 0x81, 0x24, 0x00, 0x05, 0x08, 0x00, 0x21, 0x40, 0x00, 0x01,
+    0x50, 0x00, 0x11, 0x10, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x02, 0x11, 0x06, 0x01, 0xE1,
+    0x40, 0x00, 0x05, 0x26, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01,
+    // 0x48 'H'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x50, 0x07, 0x00, 0x50, 0x07,
+    0xC0, 0x50, 0x17, 0x00, 0x50, 0x07, 0x00, 0x50, 0x07, 0x00, 0x50, 0x07,
+    0x00, 0x50, 0x07, 0x00, 0x50, 0x07, 0xC0, 0x50, 0x0F, 0x00, 0x50, 0x17,
+    0x20, 0x50, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F,
+    // 0x49 'I'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x4B 'K'
+    0xC0, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x50, 0x03, 0x00, 0x88, 0x03,
+    0xC1, 0x04, 0x13, 0x00, 0x62, 0x03, 0x00, 0x91, 0x03, 0x00, 0x08, 0x83,
+    0xC0, 0x04, 0x43, 0x00, 0x02, 0x23, 0x00, 0x01, 0x13, 0x00, 0x00, 0x8B,
+    0x10, 0x00, 0x43, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x13,
+    0x00, 0x00, 0x0B,
+    // 0x4C 'L'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0xE7,
+    // 0x4D 'M'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x07, 0x00, 0x0F, 0x07,
+    0x3C, 0x00, 0x07, 0x00, 0x01, 0xE7, 0x0E, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x80, 0x80, 0x07, 0x30, 0x10, 0x07, 0x02, 0x02, 0x07, 0x00, 0x40, 0x87,
+    0x00, 0x08, 0x07, 0x00, 0x02, 0x07, 0x00, 0x08, 0x47, 0x00, 0x42, 0x07,
+    0x02, 0x08, 0x07, 0x10, 0x40, 0x07, 0x82, 0x00, 0x0F, 0x08, 0x00, 0x17,
+    0x00, 0x7C, 0x07, 0x00, 0x00, 0x07, 0x3E, 0x00, 0x07, 0x00, 0x03, 0xC7,
+    0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F,
+    // 0x4E 'N'
+    0xC0, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x87, 0xFF, 0xE3, 0x00, 0x00, 0x03, 0x21, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x04, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x42, 0x03, 0x00, 0x10, 0x03, 0x40, 0x08, 0x43, 0x00, 0x00, 0x23,
+    0x00, 0x01, 0x03, 0x3F, 0xFF, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0x3C, 0x01, 0x02, 0x00, 0x41, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x04, 0x00, 0x45, 0x08, 0x00, 0x01, 0x40, 0x00, 0x11,
+    0x10, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 0x40, 0x00, 0x05, 0x40, 0x00, 0x01,
+    0x02, 0x00, 0x89, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x21, 0x04, 0x00, 0x41,
+    0x01, 0x86, 0x01,
+    // 0x50 'P'
+    0x20, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x14, 0x03, 0x10, 0x04, 0x03, 0x00, 0x20, 0x03,
+    0x40, 0x48, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x08, 0xC0, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x01, 0x08, 0x0F, 0x24, 0x00, 0x40, 0x0F,
+    0x08, 0x00, 0x04, 0x0F, 0x40, 0x00, 0x10, 0x0F, 0x10, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x11, 0x0F, 0x48, 0x00, 0x04, 0x2F,
+    0x04, 0x00, 0x00, 0x0F, 0x22, 0x00, 0x88, 0x8F, 0x00, 0x7C, 0x10, 0x1F,
+    0x00, 0x00, 0x20, 0x0F, 0x04, 0x00, 0x80, 0x4F, 0x01, 0x86, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x4F,
+    // 0x52 'R'
+    0x20, 0x00, 0x05, 0x40, 0x00, 0x09, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01,
+    0x00, 0x04, 0x09, 0x00, 0x01, 0x01, 0x10, 0x20, 0x81, 0x40, 0x04, 0x01,
+    0x44, 0x80, 0x11, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x0C, 0x80, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05,
+    // 0x53 'S'
+    0x00, 0x00, 0xF9, 0x0C, 0x81, 0x05, 0x00, 0x01, 0x81, 0x00, 0x00, 0x21,
+    0x49, 0x10, 0x01, 0x50, 0x80, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x01, 0x00, 0x02, 0x11, 0x10, 0x11, 0x25, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x38, 0x02, 0x61,
+    // 0x54 'T'
+    0xE4, 0x00, 0x07, 0x00, 0x00, 0x07, 0x18, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x3F, 0xFF, 0xE7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xE7, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x17, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x55 'U'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1F, 0xFF, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x3F, 0xFF, 0x0B, 0x00, 0x00, 0x43,
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x13, 0x00, 0x00, 0x23, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x56 'V'
+    0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x02, 0x00, 0x03, 0x00, 0x40, 0x03, 0x30, 0x08, 0x03, 0x02, 0x01, 0x03,
+    0x00, 0x40, 0x43, 0x00, 0x0C, 0x0B, 0x00, 0x01, 0x83, 0x00, 0x00, 0x83,
+    0x00, 0x04, 0x0B, 0x00, 0x20, 0x43, 0x01, 0x02, 0x03, 0x0C, 0x08, 0x03,
+    0x00, 0x40, 0x03, 0x02, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x57 'W'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x02, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x08, 0x03, 0x04, 0x01, 0x03,
+    0x00, 0x40, 0x33, 0xC0, 0x04, 0x03, 0x00, 0x00, 0x83, 0x00, 0x01, 0x03,
+    0x00, 0x08, 0x33, 0x00, 0xC1, 0x83, 0x04, 0x08, 0x03, 0x20, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x30, 0x18, 0x03, 0x02, 0x03, 0x03,
+    0x00, 0x40, 0x63, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x83, 0x00, 0x00, 0x83,
+    0xC0, 0x08, 0x1B, 0x00, 0xC0, 0xC3, 0x0C, 0x04, 0x03, 0x00, 0x20, 0x03,
+    0x01, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x10, 0x00, 0x87, 0x00, 0x01, 0x07, 0x02, 0x00, 0x47, 0x20, 0x08, 0x17,
+    0x08, 0x52, 0x07, 0xC4, 0x04, 0x07, 0x00, 0x08, 0x07, 0x00, 0x04, 0x07,
+    0x02, 0x00, 0x0F, 0x00, 0x90, 0x97, 0x01, 0x08, 0x47, 0x20, 0x00, 0x07,
+    0x00, 0x01, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0xC0, 0x00, 0x07, 0x00, 0x00, 0x0F,
+    // 0x59 'Y'
+    0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x20, 0x80, 0x17, 0x00, 0x20, 0x07,
+    0x42, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x20, 0x07, 0x00, 0x40, 0x07,
+    0x01, 0x10, 0x07, 0x04, 0x00, 0x07, 0x10, 0x80, 0x07, 0x02, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x2B, 0x80, 0x00, 0x03, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x08, 0x43, 0x20, 0x10, 0x03, 0x20, 0x02, 0x03, 0x20, 0x80, 0x03,
+    0x20, 0x10, 0x03, 0x24, 0x20, 0x03, 0x28, 0x00, 0x03, 0x21, 0x00, 0x23,
+    0x00, 0x00, 0x23, 0x08, 0x00, 0x83, 0x80, 0x00, 0x03, 0x00, 0x01, 0x63,
+    // 0x5B '['
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xBF, 0xFF, 0xFF, 0xEF,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x17,
+    // 0x5C '\'
+    0xC0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x84, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x08, 0x20, 0x00, 0x01, 0x08, 0x00, 0x00, 0x42, 0x00, 0x00, 0x10, 0x40,
+    0x00, 0x02, 0x10, 0x00, 0x00, 0x84, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x17, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0xBF, 0xFF, 0xFF, 0xEF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x5E '^'
+    0x00, 0x01, 0x00, 0x09, 0x00, 0x41, 0x01, 0x05, 0x04, 0x21, 0x20, 0x81,
+    0x04, 0x01, 0x08, 0x01, 0x02, 0x01, 0x10, 0xC1, 0x04, 0x11, 0x00, 0x81,
+    0x00, 0x21, 0x00, 0x05, 0x00, 0x01,
+    // 0x5F '_'
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF,
+    // 0x60 '`'
+    0x00, 0x50, 0x88, 0x40, 0x00, 0x02, 0x06,
+    // 0x61 'a'
+    0x00, 0x18, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x98, 0x7F,
+    0x00, 0x00, 0xFF, 0xA0, 0x40, 0x7F, 0x01, 0x40, 0x7F, 0x01, 0x40, 0x7F,
+    0xA1, 0x44, 0x7F, 0x8E, 0x3A, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x62 'b'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x7F, 0xC7, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0xFF, 0x00, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x04, 0x7F, 0x00, 0x80, 0x09, 0x7F, 0x00, 0x03, 0xE0, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x07, 0xC0, 0x7F,
+    // 0x63 'c'
+    0x03, 0xF0, 0x7F, 0x00, 0x04, 0x7F, 0x20, 0x02, 0x7F, 0x04, 0x21, 0x7F,
+    0x10, 0x08, 0x7F, 0x00, 0x00, 0x7F, 0xA0, 0x04, 0x7F, 0x20, 0x00, 0xFF,
+    0x20, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x04, 0x04, 0x7F,
+    0x28, 0x04, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x64 'd'
+    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x46, 0x61, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x80, 0x04, 0x7F,
+    0x00, 0xA0, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x40, 0xA0, 0x04, 0x7F, 0x40, 0x80, 0x00, 0x7F, 0x0F, 0x1F, 0xF2, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x65 'e'
+    0x03, 0xF0, 0x7F, 0x10, 0x04, 0x7F, 0x20, 0x00, 0x7F, 0x4E, 0x91, 0x7F,
+    0x02, 0x88, 0x7F, 0xA2, 0x84, 0x7F, 0x82, 0x80, 0x7F, 0x02, 0x80, 0xFF,
+    0x22, 0x80, 0x7F, 0x82, 0x80, 0x7F, 0x06, 0x80, 0x7F, 0x40, 0x85, 0x7F,
+    0x20, 0x84, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x66 'f'
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xFC, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1A, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x82, 0x11, 0x20, 0x08, 0xA0, 0xA4, 0x00, 0x00, 0xA4, 0x00,
+    0x00, 0x24, 0x00, 0xA0, 0xA4, 0x00, 0x80, 0x24, 0x0A, 0x0A, 0x04, 0x00,
+    0x00, 0x40, 0x10, 0xA0, 0x80, 0x24, 0xAE, 0x00, 0x08, 0xA0, 0x00, 0x10,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x68 'h'
+    0x20, 0x00, 0x00, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x69 'i'
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x48, 0x10, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x48, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x04,
+    0x00, 0x80, 0x00, 0x08, 0x00, 0x80, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00,
+    // 0x6B 'k'
+    0x20, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0x7F,
+    0x0F, 0xFF, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x48, 0x10, 0x7F, 0x00, 0x00, 0x88, 0x7F, 0x00, 0x24, 0x44, 0x7F,
+    0x00, 0x08, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x20, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    // 0x6C 'l'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0x6D 'm'
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x10, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFC, 0x00, 0x00,
+    0x00, 0x03, 0x80, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6E 'n'
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x10, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x27, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xA0, 0x00, 0x20, 0x00,
+    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x6F 'o'
+    0x03, 0xF0, 0x7F, 0x00, 0x04, 0x7F, 0x20, 0x02, 0x7F, 0x46, 0x61, 0x7F,
+    0x10, 0x08, 0x7F, 0x80, 0x04, 0x7F, 0xA0, 0x00, 0xFF, 0x20, 0x02, 0xFF,
+    0x20, 0x02, 0xFF, 0xA0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x08, 0x09, 0x7F,
+    0x43, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x08, 0x7F, 0x03, 0xC0, 0x7F,
+    // 0x70 'p'
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x04, 0x03, 0x50, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x04, 0x01,
+    0x90, 0x01, 0x01, 0x88, 0x10, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x30, 0x01, 0x00, 0x00, 0x01,
+    // 0x71 'q'
+    0x03, 0xF0, 0x01, 0x00, 0x04, 0x01, 0x20, 0x00, 0x01, 0x46, 0x61, 0x01,
+    0x00, 0x08, 0x01, 0x80, 0x04, 0x01, 0xA0, 0x00, 0x01, 0x20, 0x00, 0x01,
+    0x20, 0x00, 0x07, 0xA0, 0x05, 0x03, 0x80, 0x08, 0x03, 0x9F, 0xF3, 0xFB,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x07,
+    // 0x72 'r'
+    0x00, 0x00, 0x40, 0x02, 0x00, 0x02, 0x10, 0x04, 0x80, 0x00, 0x80, 0x00,
+    0x07, 0xFC, 0x28, 0x00, 0x50, 0x00, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00,
+    0x90, 0x00, 0x00, 0x00,
+    // 0x73 's'
+    0x00, 0x00, 0x7F, 0x1E, 0x01, 0x7F, 0x01, 0x10, 0x7F, 0x08, 0x84, 0x7F,
+    0xA4, 0x00, 0x7F, 0x80, 0x42, 0xFF, 0x02, 0x02, 0xFF, 0x00, 0x02, 0x7F,
+    0xA1, 0x00, 0x7F, 0x88, 0x01, 0x7F, 0x00, 0x82, 0x7F, 0x20, 0x2C, 0x7F,
+    // 0x74 't'
+    0x04, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    // 0x75 'u'
+    0x60, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x04, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x05, 0x7F,
+    0x00, 0x08, 0x7F, 0x80, 0x02, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x76 'v'
+    0x40, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x04, 0x00, 0x7F,
+    0x00, 0x80, 0x7F, 0x10, 0x20, 0x7F, 0x26, 0x08, 0x7F, 0x00, 0x81, 0x7F,
+    0x00, 0x10, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x21, 0x7F, 0x01, 0x04, 0x7F,
+    0x24, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x02, 0x00, 0x7F, 0x08, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x77 'w'
+    0x40, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x02, 0x00, 0x7F,
+    0x00, 0x80, 0x7F, 0x10, 0x10, 0x7F, 0x22, 0x02, 0x7F, 0x00, 0x60, 0x7F,
+    0x00, 0x08, 0x7F, 0x00, 0x30, 0x7F, 0x01, 0x84, 0x7F, 0x0C, 0x30, 0x7F,
+    0x60, 0x80, 0x7F, 0x02, 0x00, 0x7F, 0x40, 0xC0, 0x7F, 0x08, 0x10, 0x7F,
+    0x01, 0x02, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x08, 0x7F, 0x40, 0x20, 0x7F,
+    0x01, 0x04, 0x7F, 0x28, 0x20, 0x7F, 0x00, 0x80, 0x7F, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x78 'x'
+    0x00, 0x01, 0x20, 0x02, 0x00, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00,
+    0x30, 0x0A, 0x08, 0x91, 0x00, 0x00, 0x02, 0x20, 0x04, 0x00, 0x00, 0x42,
+    0x20, 0x20, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00,
+    // 0x79 'y'
+    0x40, 0x00, 0x0C, 0x20, 0x00, 0x08, 0x10, 0x00, 0x08, 0x04, 0x00, 0x00,
+    0x00, 0x80, 0x02, 0x10, 0x20, 0x02, 0x26, 0x08, 0x04, 0x00, 0x81, 0x80,
+    0x00, 0x10, 0x10, 0x00, 0x08, 0x40, 0x00, 0x21, 0x00, 0x01, 0x04, 0x00,
+    0x24, 0x20, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x7A 'z'
+    0x00, 0x00, 0x7F, 0x18, 0x05, 0x7F, 0x04, 0x08, 0x7F, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x20, 0x88, 0x7F, 0x21, 0x10, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x80, 0x7F, 0x31, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x7F,
+    0x10, 0x10, 0x7F, 0x60, 0x03, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x7B '{'
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x20, 0xE8, 0x18, 0x23,
+    0x40, 0x02, 0x00, 0x03, 0x0E, 0x05, 0x03, 0x8B, 0xA0, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1B,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x80, 0xC8, 0x98, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x1F, 0x00, 0x87, 0xC3, 0x00, 0x05, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x7E '~'
+    0x03, 0x03, 0x0B, 0x03, 0x83, 0x03, 0x13, 0x43, 0x03, 0x03, 0x03, 0x23,
+    0x03, 0x13, 0x03,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x00, 0x90, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x82, 0x00, 0x02,
+    0x60, 0x1F, 0xFC,
+    // 0xA2 '¢'
+    0x00, 0x18, 0x40, 0x07, 0x00, 0x40, 0x10, 0x07, 0x00, 0x00, 0x08, 0x07,
+    0x00, 0x20, 0x40, 0x07, 0x02, 0x00, 0x24, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0xF3, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x08, 0xE0, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x10, 0x07, 0x02, 0x20, 0x14, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x80, 0x10, 0x07,
+    // 0xA3 '£'
+    0x00, 0x00, 0x13, 0x00, 0x30, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC3,
+    0x00, 0x08, 0x0B, 0x04, 0x00, 0x2B, 0x00, 0x03, 0x03, 0x01, 0xC0, 0x03,
+    0x08, 0x00, 0x03, 0x80, 0x00, 0x03, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03,
+    0xA0, 0x00, 0x03, 0x90, 0x00, 0x27, 0x00, 0x00, 0x23, 0x04, 0x00, 0x33,
+    0x00, 0x00, 0x03,
+    // 0xA4 '¤'
+    0x00, 0x01, 0x00, 0x0B, 0x00, 0x01, 0x20, 0x01, 0x10, 0x09, 0x04, 0x01,
+    0x28, 0x01, 0x20, 0x15, 0x00, 0x15, 0x20, 0x11, 0x20, 0x01, 0x02, 0x49,
+    0x00, 0x09, 0x2C, 0x45, 0x50, 0x01, 0x40, 0x01, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x40, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x88, 0x00, 0x07,
+    0x80, 0x04, 0x07, 0x81, 0x02, 0x0F, 0xA0, 0x02, 0x17, 0x84, 0x02, 0x07,
+    0x01, 0x0A, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x82, 0x07, 0x42, 0x02, 0x07, 0x88, 0x82, 0x17, 0x82, 0x02, 0x07,
+    0x80, 0x20, 0x07, 0x90, 0x00, 0x07, 0x80, 0x00, 0x07, 0x40, 0x00, 0x07,
+    // 0xA7 '§'
+    0x03, 0xE0, 0x08, 0x08, 0x08, 0x02, 0x01, 0x64, 0x00, 0x00, 0x12, 0x09,
+    0x50, 0x08, 0x05, 0x20, 0x00, 0x01, 0xA1, 0x00, 0x81, 0xA0, 0x02, 0x04,
+    0x80, 0x10, 0x00, 0x08, 0x40, 0x00, 0x00, 0x24, 0x04, 0x30, 0x10, 0x00,
+    0x00, 0x04, 0x60,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x00, 0x83, 0x01, 0x00, 0x10, 0x41, 0x09, 0x01, 0x21,
+    0x10, 0x00, 0x41, 0x00, 0x00, 0x29, 0x00, 0x3C, 0x11, 0x10, 0x01, 0x05,
+    0x40, 0x7C, 0x89, 0x20, 0x00, 0x09, 0x21, 0x01, 0x43, 0x20, 0x00, 0x43,
+    0x20, 0x00, 0x43, 0x21, 0x81, 0x41, 0x00, 0x41, 0x09, 0x40, 0x01, 0x01,
+    0x10, 0x00, 0x15, 0x28, 0x00, 0x01, 0x04, 0x00, 0x01, 0x02, 0x00, 0x91,
+    0x04, 0x66, 0x01, 0x01, 0x00, 0x81, 0x00, 0x38, 0x01,
+    // 0xAA 'ª'
+    0x00, 0x01, 0x10, 0x43, 0x08, 0x23, 0x51, 0x03, 0x24, 0x43, 0x26, 0x63,
+    0x19, 0x83, 0x40, 0x23, 0x3F, 0x03, 0x00, 0x29, 0x00, 0x41,
+    // 0xAB '«'
+    0x05, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x20, 0x0F, 0x08, 0x8F, 0x10, 0x5F,
+    0x00, 0x3F, 0x02, 0x0F, 0x00, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x25, 0x2F,
+    0x40, 0x0F, 0x20, 0x1F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x04, 0x10, 0x7F, 0x03, 0xE4, 0x7F, 0x08, 0x0A, 0x7F,
+    0x10, 0x04, 0x7F, 0x40, 0x02, 0x7F, 0x28, 0x08, 0x7F, 0x08, 0x08, 0x7F,
+    0x0C, 0x18, 0xFF, 0x09, 0x20, 0xFF, 0x20, 0xD0, 0x7F, 0x62, 0x2A, 0x7F,
+    0x00, 0x11, 0x7F, 0x20, 0x00, 0x7F, 0x14, 0x10, 0x7F, 0x08, 0x08, 0x7F,
+    0x01, 0xC0, 0x7F,
+    // 0xB0 '°'
+    0x12, 0x3F, 0x40, 0xBF, 0x12, 0x3F, 0xA1, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
+    0xA1, 0x7F, 0x1E, 0x3F, 0x40, 0x3F, 0x1E, 0x3F,
+    // 0xB1 '±'
+    0x01, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x7C, 0xF8, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x03, 0x00, 0xFF,
+    // 0xB2 '²'
+    0x28, 0x17, 0x40, 0x23, 0x18, 0x03, 0xA0, 0x13, 0x80, 0x33, 0xA0, 0x53,
+    0x94, 0x93, 0x01, 0x13, 0x42, 0x17, 0x00, 0x17,
+    // 0xB3 '³'
+    0x30, 0x0D, 0x00, 0x09, 0x02, 0x09, 0xA0, 0x01, 0x80, 0x01, 0xA0, 0x15,
+    0x10, 0x61, 0x04, 0x09, 0x38, 0x11, 0x00, 0x01,
+    // 0xB5 'µ'
+    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xBF, 0xE0, 0x0D,
+    0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x60, 0x01, 0x00, 0x04, 0x01,
+    0x80, 0x02, 0x01, 0xBF, 0xE0, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x20, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x40, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF,
+    0x20, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x07, 0x47, 0x0F, 0x0F, 0x07, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x10, 0x0B, 0x50, 0x0B, 0x50, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x40, 0x03, 0x00, 0x03, 0x00, 0x0F,
+    // 0xBA 'º'
+    0x00, 0x01, 0x10, 0x81, 0x20, 0x03, 0x49, 0x03, 0x00, 0x03, 0x20, 0x43,
+    0x00, 0x43, 0x10, 0x03, 0x47, 0x23, 0x20, 0x49, 0x1B, 0x01,
+    // 0xBB '»'
+    0x00, 0x0F, 0x20, 0x1F, 0x50, 0x0F, 0x01, 0x2F, 0x00, 0x4F, 0x00, 0x0F,
+    0x00, 0x0F, 0x02, 0x0F, 0x40, 0x3F, 0x00, 0x5F, 0x00, 0x8F, 0x24, 0x0F,
+    0x10, 0x0F, 0x08, 0x8F, 0x01, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x02, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x06, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10,
+    0x00, 0x02, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x01, 0x20, 0x00, 0x04, 0x80, 0x00, 0x10, 0x00, 0x80, 0x44, 0x01, 0x00,
+    0x90, 0x00, 0x00, 0x40, 0x09, 0x40, 0x00, 0x12, 0x40, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x9C, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x40,
+    // 0xBD '½'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x02, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x06, 0x09, 0x00, 0x00, 0x22, 0x00, 0x00, 0x08, 0x00, 0x01, 0x20,
+    0x00, 0x04, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x02, 0x40, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x88, 0x20, 0x14,
+    0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x10, 0x00, 0xA0, 0x20,
+    0x00, 0xA0, 0x40, 0x00, 0x1C, 0x80, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x04,
+    // 0xBE '¾'
+    0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x40, 0x0A, 0x00, 0x48, 0x70, 0x00, 0x02, 0x04, 0x00,
+    0x1C, 0x00, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10,
+    0x00, 0x02, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x01, 0x20, 0x00, 0x04, 0x80, 0x00, 0x10, 0x00, 0x20, 0x44, 0x01, 0x00,
+    0x90, 0x02, 0x00, 0x40, 0x00, 0x40, 0x00, 0x12, 0x40, 0x00, 0x24, 0x40,
+    0x00, 0x0F, 0x9C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    // 0xBF '¿'
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x41, 0x00, 0x10, 0x11, 0x00, 0x00, 0x09,
+    0x00, 0x24, 0x01, 0x60, 0x00, 0x01, 0x80, 0x40, 0x01, 0x00, 0x08, 0x01,
+    0x90, 0x00, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x11,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x47,
+    0x20, 0x00, 0x41, 0x07, 0x80, 0x02, 0x02, 0x1F, 0x08, 0x08, 0x4A, 0x07,
+    0x00, 0x41, 0x0A, 0x07, 0x20, 0x88, 0x0A, 0x07, 0x14, 0x08, 0x0A, 0x07,
+    0x04, 0x01, 0x0A, 0x07, 0x00, 0x20, 0x2A, 0x0F, 0x00, 0x0C, 0x02, 0x17,
+    0x00, 0x01, 0x00, 0x87, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x47,
+    0x00, 0x00, 0x41, 0x07, 0x00, 0x02, 0x02, 0x1F, 0x0C, 0x08, 0x4A, 0x07,
+    0x14, 0x41, 0x0A, 0x07, 0x00, 0x88, 0x0A, 0x07, 0x00, 0x08, 0x0A, 0x07,
+    0x48, 0x01, 0x0A, 0x07, 0x00, 0x20, 0x2A, 0x0F, 0x10, 0x0C, 0x02, 0x17,
+    0x00, 0x01, 0x00, 0x87, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x47,
+    0x00, 0x00, 0x41, 0x07, 0x10, 0x02, 0x02, 0x1F, 0x24, 0x08, 0x4A, 0x07,
+    0x48, 0x41, 0x0A, 0x07, 0x10, 0x88, 0x0A, 0x07, 0x10, 0x08, 0x0A, 0x07,
+    0x40, 0x01, 0x0A, 0x07, 0x20, 0x20, 0x2A, 0x0F, 0x10, 0x0C, 0x02, 0x17,
+    0x0C, 0x01, 0x00, 0x87, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x47,
+    0x08, 0x00, 0x41, 0x07, 0x00, 0x02, 0x02, 0x1F, 0x10, 0x08, 0x4A, 0x07,
+    0x10, 0x41, 0x0A, 0x07, 0x40, 0x88, 0x0A, 0x07, 0x20, 0x08, 0x0A, 0x07,
+    0x00, 0x01, 0x0A, 0x07, 0x00, 0x20, 0x2A, 0x0F, 0x08, 0x0C, 0x02, 0x17,
+    0x20, 0x01, 0x00, 0x87, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x20, 0x00, 0x20, 0x8F,
+    0x00, 0x00, 0x82, 0x0F, 0x00, 0x04, 0x04, 0x3F, 0x00, 0x10, 0x94, 0x0F,
+    0x00, 0x82, 0x14, 0x0F, 0x01, 0x10, 0x14, 0x0F, 0x00, 0x10, 0x14, 0x0F,
+    0x50, 0x02, 0x14, 0x0F, 0x00, 0x40, 0x54, 0x1F, 0x00, 0x18, 0x04, 0x2F,
+    0x50, 0x02, 0x01, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x23,
+    0x00, 0x00, 0x20, 0x83, 0x24, 0x01, 0x01, 0x0F, 0x40, 0x04, 0x25, 0x03,
+    0x25, 0x20, 0x85, 0x03, 0x81, 0x44, 0x05, 0x03, 0xA1, 0x04, 0x05, 0x03,
+    0x18, 0x00, 0x85, 0x03, 0x42, 0x10, 0x15, 0x07, 0x18, 0x06, 0x01, 0x0B,
+    0x00, 0x00, 0x80, 0x43, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x04, 0x47, 0x00, 0x11, 0x07,
+    0x00, 0x42, 0x0F, 0x00, 0x00, 0x07, 0x02, 0x28, 0x07, 0x08, 0x88, 0x07,
+    0x22, 0x08, 0x0F, 0x00, 0x08, 0x17, 0x00, 0x08, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x50, 0x07, 0x20, 0x50, 0x07,
+    0x20, 0x50, 0x07, 0x20, 0x50, 0x07, 0x20, 0x50, 0x07, 0x20, 0x10, 0x07,
+    0x20, 0x10, 0x27, 0x04, 0x00, 0x47, 0x80, 0x00, 0x07, 0x00, 0x01, 0xE7,
+    // 0xC7 'Ç'
+    0x00, 0x3E, 0x00, 0x03, 0x01, 0x00, 0x40, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0x24, 0x00, 0x44, 0x03,
+    0x08, 0x00, 0x20, 0x03, 0x40, 0x00, 0x00, 0x03, 0x10, 0x00, 0x10, 0x4F,
+    0x00, 0x00, 0x11, 0x57, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x10, 0x63, 0x0C, 0x00, 0x10, 0x03, 0x41, 0x00, 0x10, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x03,
+    // 0xC8 'È'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x48, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07,
+    0x14, 0x20, 0x50, 0x07, 0x04, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07,
+    0x00, 0x20, 0x10, 0x07, 0x00, 0x20, 0x10, 0x27, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0xE7,
+    // 0xC9 'É'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x04, 0x20, 0x50, 0x07, 0x14, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07,
+    0x00, 0x20, 0x50, 0x07, 0x48, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07,
+    0x60, 0x20, 0x10, 0x07, 0x00, 0x20, 0x10, 0x27, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0xE7,
+    // 0xCA 'Ê'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x20, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07,
+    0x10, 0x20, 0x50, 0x07, 0x48, 0x20, 0x50, 0x07, 0x24, 0x20, 0x50, 0x07,
+    0x10, 0x20, 0x10, 0x07, 0x04, 0x20, 0x10, 0x27, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0xE7,
+    // 0xCB 'Ë'
+    0x01, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x70, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0xA0, 0x0F, 0x00, 0x40, 0xA0, 0x0F, 0x00, 0x40, 0xA0, 0x0F,
+    0x00, 0x40, 0xA0, 0x0F, 0x00, 0x40, 0xA0, 0x0F, 0x00, 0x40, 0xA0, 0x0F,
+    0x00, 0x40, 0x20, 0x0F, 0x60, 0x40, 0x20, 0x4F, 0x00, 0x08, 0x00, 0x8F,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xCF,
+    // 0xCC 'Ì'
+    0x60, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x17, 0x48, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07, 0x14, 0x00, 0x00, 0x07,
+    0x04, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xCD 'Í'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x0C, 0x00, 0x00, 0x07,
+    0x14, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x48, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x50, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x08, 0xC0, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x17,
+    0x24, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x48, 0x20, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x10, 0x40, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x07,
+    // 0xCF 'Ï'
+    0x20, 0x00, 0x00, 0x0F, 0x01, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x50, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x0F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x01, 0x20, 0x08, 0x05, 0x40, 0x08, 0x09, 0x40, 0x08, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x10, 0x08, 0x01,
+    0x10, 0x00, 0x15, 0x40, 0x00, 0x05, 0x48, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x22, 0x00, 0x81, 0x00, 0xC6, 0x11, 0x00, 0x00, 0x21, 0x04, 0x00, 0x01,
+    0x01, 0x82, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x87, 0xFF, 0xE3,
+    0x28, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x03, 0x10, 0x00, 0x80, 0x03,
+    0x10, 0x04, 0x00, 0x03, 0x40, 0x00, 0x10, 0x03, 0x20, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x42, 0x03, 0x20, 0x00, 0x10, 0x03, 0x00, 0x40, 0x08, 0x43,
+    0x30, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x03, 0x00, 0x3F, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x78, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x02, 0x03, 0x00, 0x08, 0x00, 0x8B,
+    0x60, 0x10, 0x00, 0x03, 0x80, 0x80, 0x00, 0x23, 0x08, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07, 0x14, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x23, 0x00, 0x80, 0x00, 0x0B,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x04, 0x01, 0x13, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x83, 0x00, 0x03, 0x0C, 0x03,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x78, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x02, 0x03, 0x00, 0x08, 0x00, 0x8B,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23, 0x0C, 0x20, 0x00, 0x07,
+    0x14, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x48, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x23, 0x50, 0x80, 0x00, 0x0B,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x04, 0x01, 0x13, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x83, 0x00, 0x03, 0x0C, 0x03,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x78, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x02, 0x03, 0x00, 0x08, 0x00, 0x8B,
+    0x08, 0x10, 0x00, 0x03, 0x10, 0x80, 0x00, 0x23, 0x24, 0x20, 0x00, 0x07,
+    0x48, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x48, 0x00, 0x00, 0x03, 0x20, 0x20, 0x00, 0x23, 0x10, 0x80, 0x00, 0x0B,
+    0x0C, 0x80, 0x00, 0x03, 0x00, 0x04, 0x01, 0x13, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x83, 0x00, 0x03, 0x0C, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x78, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x02, 0x03, 0x00, 0x08, 0x00, 0x8B,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23, 0x10, 0x20, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x40, 0x20, 0x00, 0x23, 0x08, 0x80, 0x00, 0x0B,
+    0x20, 0x80, 0x00, 0x03, 0x00, 0x04, 0x01, 0x13, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x83, 0x00, 0x03, 0x0C, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0xF0, 0x07, 0x00, 0x08, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x04, 0x07, 0x20, 0x10, 0x01, 0x17,
+    0x00, 0x20, 0x00, 0x07, 0x01, 0x00, 0x00, 0x47, 0x00, 0x40, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x50, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x47, 0x01, 0x00, 0x00, 0x17,
+    0x51, 0x00, 0x00, 0x07, 0x00, 0x08, 0x02, 0x27, 0x00, 0x01, 0xF0, 0x07,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x10, 0x01, 0x07, 0x00, 0x06, 0x18, 0x07,
+    // 0xD7 '×'
+    0x00, 0x07, 0x40, 0x27, 0x40, 0x47, 0x20, 0x87, 0x13, 0x07, 0x08, 0x07,
+    0x00, 0x87, 0x08, 0x47, 0x11, 0x27, 0x00, 0x97, 0x40, 0x07, 0x00, 0x17,
+    0x00, 0x07,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x01, 0x00, 0x3C, 0x09, 0x02, 0x00, 0x51, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x08, 0x02, 0x01,
+    0x40, 0x04, 0x11, 0x10, 0x08, 0x03, 0x00, 0x10, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x80, 0x01, 0x11, 0x00, 0x11, 0x02, 0x00, 0x05,
+    0x44, 0x00, 0x01, 0x01, 0x00, 0x89, 0x00, 0x7C, 0x01, 0x20, 0x00, 0x21,
+    0x44, 0x00, 0x41, 0x01, 0x86, 0x01, 0x00, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x3F, 0xFF, 0x0B, 0x20, 0x00, 0x00, 0x43, 0x80, 0x40, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x3F, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x43, 0x00, 0x40, 0x00, 0x03,
+    0x0C, 0x00, 0x00, 0x23, 0x14, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x03, 0x48, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x10, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x3F, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x43, 0x00, 0x40, 0x00, 0x03,
+    0x24, 0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x3F, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x7F, 0xFE, 0x17, 0x00, 0x00, 0x00, 0x87, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x17, 0x50, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x40, 0x00, 0x17,
+    0x80, 0x00, 0x97, 0x08, 0x00, 0x87, 0x0A, 0x02, 0x87, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x00, 0x02, 0x07, 0x01, 0x08, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x01, 0xFF, 0xFC, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x03, 0xFF, 0xFE, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x10, 0x02, 0xFF, 0x0B, 0x40, 0x02, 0x7F, 0x40, 0x80, 0x00, 0x7F,
+    0x20, 0x00, 0x19, 0x7F, 0x0C, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x4C, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x04, 0x50, 0x20, 0x3F,
+    0x10, 0x00, 0xA0, 0x3F, 0x08, 0x00, 0xA0, 0x3F, 0x00, 0x50, 0xA2, 0x3F,
+    0x00, 0x47, 0x1D, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x4C, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x06, 0x50, 0x20, 0x3F,
+    0x00, 0x00, 0xA0, 0x3F, 0x20, 0x00, 0xA0, 0x3F, 0x00, 0x50, 0xA2, 0x3F,
+    0x00, 0x47, 0x1D, 0x3F, 0x20, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x18, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x98, 0x7F, 0x04, 0x00, 0x00, 0xFF, 0x88, 0xA0, 0x40, 0x7F,
+    0x80, 0x01, 0x40, 0x7F, 0x10, 0x01, 0x40, 0x7F, 0x08, 0xA1, 0x44, 0x7F,
+    0x04, 0x8E, 0x3A, 0x7F, 0x10, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x18, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x98, 0x7F, 0x10, 0x00, 0x00, 0xFF, 0x10, 0xA0, 0x40, 0x7F,
+    0x08, 0x01, 0x40, 0x7F, 0x20, 0x01, 0x40, 0x7F, 0x04, 0xA1, 0x44, 0x7F,
+    0x20, 0x8E, 0x3A, 0x7F, 0x48, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
+    0x00, 0x00, 0x01, 0x01, 0x40, 0x80, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80,
+    0x51, 0x42, 0x88, 0x01, 0x1C, 0x74, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    // 0xE5 'å'
+    0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x4C, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xA5, 0x50, 0x20, 0x3F,
+    0x80, 0x00, 0xA0, 0x3F, 0xA1, 0x00, 0xA0, 0x3F, 0x18, 0x50, 0xA2, 0x3F,
+    0x42, 0x47, 0x1D, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xE6 'æ'
+    0x00, 0x18, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x98, 0x7F,
+    0x00, 0x00, 0xFF, 0xA1, 0x40, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0xA0, 0x05, 0x7F, 0x0E, 0x60, 0x7F, 0x40, 0x00, 0x7F, 0x20, 0x02, 0x7F,
+    0x06, 0xB1, 0x7F, 0x10, 0x88, 0x7F, 0xA2, 0x84, 0x7F, 0x82, 0x80, 0x7F,
+    0x02, 0x00, 0xFF, 0x22, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x40, 0x05, 0x7F, 0x10, 0x06, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xE7 'ç'
+    0x03, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x20, 0x02, 0x00, 0x04, 0x21, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x00, 0x21, 0xA0, 0x04, 0x51, 0x20, 0x00, 0xC9,
+    0x20, 0x00, 0x80, 0x80, 0x00, 0x24, 0x80, 0x00, 0x00, 0x04, 0x04, 0x00,
+    0x28, 0x04, 0x00, 0x00, 0x00, 0x00,
+    // 0xE8 'è'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x50, 0x27, 0x48, 0xBF, 0x88, 0x01, 0x44, 0x3F, 0x40, 0x51, 0x42, 0x3F,
+    0x20, 0x41, 0x40, 0x3F, 0x02, 0x01, 0x40, 0x7F, 0x00, 0x11, 0x40, 0x3F,
+    0x00, 0x41, 0x40, 0x3F, 0x00, 0x03, 0x40, 0x3F, 0x00, 0x20, 0x42, 0xBF,
+    0x00, 0x10, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xE9 'é'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x27, 0x48, 0xBF, 0x00, 0x01, 0x44, 0x3F, 0x00, 0x51, 0x42, 0x3F,
+    0x00, 0x41, 0x40, 0x3F, 0x12, 0x01, 0x40, 0x7F, 0x04, 0x11, 0x40, 0x3F,
+    0x00, 0x41, 0x40, 0x3F, 0x10, 0x03, 0x40, 0x3F, 0x00, 0x20, 0x42, 0xBF,
+    0x00, 0x10, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEA 'ê'
+    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x08, 0x4E, 0x91, 0x7F, 0x00, 0x02, 0x88, 0x7F, 0x40, 0xA2, 0x84, 0x7F,
+    0x80, 0x82, 0x80, 0x7F, 0x00, 0x02, 0x80, 0xFF, 0x90, 0x22, 0x80, 0x7F,
+    0x40, 0x82, 0x80, 0x7F, 0x20, 0x06, 0x80, 0x7F, 0x08, 0x40, 0x85, 0x7F,
+    0x00, 0x20, 0x84, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xEB 'ë'
+    0x00, 0x07, 0xE0, 0x00, 0x20, 0x08, 0x50, 0x40, 0x00, 0x00, 0x9D, 0x22,
+    0x00, 0x05, 0x10, 0x51, 0x45, 0x08, 0x01, 0x05, 0x00, 0x00, 0x05, 0x01,
+    0x00, 0x45, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x81, 0x0A,
+    0x00, 0x41, 0x08, 0x00, 0x00, 0x00,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x04, 0x08, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x08, 0x40, 0x00, 0x7F,
+    0x00, 0x3F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x08, 0x40, 0x00, 0x7F, 0x20, 0x40, 0x00, 0x7F,
+    0x44, 0x3F, 0xFE, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xEE 'î'
+    0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x02, 0x08, 0x10, 0x00,
+    0x90, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0x04, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x04, 0x00, 0x00,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x05,
+    0x20, 0x20, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x50, 0xFF, 0xF9,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
+    // 0xF0 'ð'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x03, 0x30, 0xBF, 0x01, 0x00, 0x04, 0x3F, 0x54, 0x00, 0x02, 0x3F,
+    0x0A, 0x50, 0x00, 0x7F, 0x00, 0x50, 0x01, 0x7F, 0x00, 0x50, 0x01, 0x7F,
+    0x21, 0x00, 0x00, 0x3F, 0x14, 0xA8, 0x02, 0x3F, 0x02, 0x24, 0x04, 0xBF,
+    0x00, 0x01, 0xF0, 0x3F, 0x00, 0x40, 0x02, 0x3F, 0x00, 0x10, 0x04, 0x3F,
+    0x00, 0x00, 0x80, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+    0x00, 0x80, 0x00, 0x10, 0x80, 0x00, 0x40, 0x27, 0xFC, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x03, 0x40, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x20, 0x00,
+    0x04, 0x00, 0x02, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    // 0xF2 'ò'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x23, 0x30, 0xBF, 0x00, 0x08, 0x04, 0x3F, 0x08, 0x40, 0x02, 0x3F,
+    0x04, 0x50, 0x00, 0x7F, 0x00, 0x10, 0x01, 0x7F, 0x08, 0x10, 0x01, 0x7F,
+    0x06, 0x50, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x04, 0x04, 0xBF,
+    0x00, 0x21, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x04, 0x3F,
+    0x00, 0x01, 0xE0, 0x3F,
+    // 0xF3 'ó'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x23, 0x30, 0xBF, 0x00, 0x08, 0x04, 0x3F, 0x00, 0x40, 0x02, 0x3F,
+    0x00, 0x50, 0x00, 0x7F, 0x08, 0x10, 0x01, 0x7F, 0x00, 0x10, 0x01, 0x7F,
+    0x44, 0x50, 0x00, 0x3F, 0x08, 0x40, 0x00, 0x3F, 0x50, 0x04, 0x04, 0xBF,
+    0x00, 0x21, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x04, 0x3F,
+    0x00, 0x01, 0xE0, 0x3F,
+    // 0xF4 'ô'
+    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x20, 0x02, 0x7F,
+    0x04, 0x46, 0x61, 0x7F, 0x00, 0x10, 0x08, 0x7F, 0x24, 0x80, 0x04, 0x7F,
+    0x08, 0xA0, 0x00, 0xFF, 0x90, 0x20, 0x02, 0xFF, 0x00, 0x20, 0x02, 0xFF,
+    0x80, 0xA0, 0x00, 0x7F, 0x04, 0x80, 0x00, 0x7F, 0x10, 0x08, 0x09, 0x7F,
+    0x04, 0x43, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x00, 0x03, 0xC0, 0x7F,
+    // 0xF5 'õ'
+    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x20, 0x02, 0x7F,
+    0x28, 0x46, 0x61, 0x7F, 0x40, 0x10, 0x08, 0x7F, 0x10, 0x80, 0x04, 0x7F,
+    0x10, 0xA0, 0x00, 0xFF, 0x40, 0x20, 0x02, 0xFF, 0x20, 0x20, 0x02, 0xFF,
+    0x04, 0xA0, 0x00, 0x7F, 0x20, 0x80, 0x00, 0x7F, 0x00, 0x08, 0x09, 0x7F,
+    0x30, 0x43, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x08, 0x7F,
+    0x00, 0x03, 0xC0, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x07, 0xE0, 0x00, 0x00, 0x08, 0x00, 0x40, 0x04, 0x00, 0x8C, 0xC2,
+    0x00, 0x20, 0x10, 0x01, 0x00, 0x08, 0x21, 0x40, 0x01, 0x00, 0x40, 0x05,
+    0x00, 0x40, 0x05, 0x71, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x12,
+    0x50, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x07, 0x80,
+    // 0xF7 '÷'
+    0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x60, 0x13, 0x90, 0x23,
+    0x10, 0x07, 0x80, 0x23, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x03, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x7F, 0x03, 0xF2, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x44, 0x21, 0x7F, 0x10, 0x20, 0x7F, 0x80, 0x44, 0x7F, 0xA0, 0x80, 0xFF,
+    0x01, 0x02, 0xFF, 0x22, 0x02, 0xFF, 0xA4, 0x00, 0x7F, 0x88, 0x00, 0x7F,
+    0x00, 0x01, 0x7F, 0x43, 0x60, 0x7F, 0x40, 0x00, 0x7F, 0x90, 0x08, 0x7F,
+    0x03, 0xC0, 0x7F, 0x00, 0x00, 0x7F,
+    // 0xF9 'ù'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x50, 0x40, 0x00, 0x3F,
+    0x88, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x02, 0xBF,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xFA 'ú'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x12, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x08, 0x10, 0x02, 0xBF,
+    0x50, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xFB 'û'
+    0x00, 0x60, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x04, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x08, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x20, 0x05, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x08, 0x80, 0x02, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xFC 'ü'
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x51, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x0A,
+    0x00, 0x00, 0x10, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03,
+    0x1F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x08, 0x04, 0x0B, 0x00, 0x50, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x01, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x90, 0x01, 0x01, 0x00, 0x88, 0x00, 0x01, 0x00, 0x01, 0x82, 0x01,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x10, 0x10, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x80, 0x00, 0x19, 0x00, 0x40, 0x00, 0x11, 0x00, 0x20, 0x00, 0x11,
+    0x20, 0x08, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x20, 0x40, 0x05,
+    0x00, 0x4C, 0x10, 0x09, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x20, 0x21,
+    0x00, 0x00, 0x10, 0x81, 0x50, 0x00, 0x42, 0x01, 0x00, 0x02, 0x08, 0x01,
+    0x00, 0x48, 0x40, 0x01, 0x70, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x40, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x08, 0x20, 0x07,
+    0x00, 0x20, 0x80, 0x07, 0x01, 0x01, 0x0C, 0x07, 0x04, 0x25, 0x00, 0x07,
+    0x20, 0x85, 0x00, 0x07, 0x44, 0x05, 0x00, 0x07, 0x04, 0x05, 0x00, 0x07,
+    0x00, 0x85, 0x00, 0x07, 0x10, 0x15, 0x04, 0x07, 0x06, 0x01, 0x08, 0xE7,
+    0x00, 0x80, 0x40, 0x17, 0x00, 0x10, 0x02, 0x07, 0x00, 0x02, 0x01, 0x47,
+    0x00, 0x00, 0x82, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x105 'ą'
+    0x00, 0x18, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x01, 0x00, 0x98, 0x01,
+    0x00, 0x00, 0x81, 0xA0, 0x40, 0x01, 0x01, 0x40, 0x01, 0x01, 0x40, 0x01,
+    0xA1, 0x44, 0x01, 0x8E, 0x3A, 0x29, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x09, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x7C, 0x03, 0x00, 0x02, 0x00, 0x83, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x48, 0x00, 0x8B,
+    0x00, 0x10, 0x00, 0x43, 0x00, 0x80, 0x00, 0x03, 0x04, 0x20, 0x00, 0x23,
+    0x04, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x27, 0x08, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x23, 0x00, 0x18, 0x00, 0x23, 0x00, 0x82, 0x00, 0x23,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    // 0x107 'ć'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x00, 0x02, 0x10, 0xBF, 0x00, 0x08, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x02, 0x50, 0x02, 0x3F, 0x12, 0x10, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x20, 0x02, 0x02, 0x3F,
+    0x00, 0x14, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x7C, 0x03, 0x00, 0x02, 0x00, 0x83, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x01, 0x03, 0xA0, 0x48, 0x00, 0x8B,
+    0x10, 0x10, 0x00, 0x43, 0x08, 0x80, 0x00, 0x03, 0x24, 0x20, 0x00, 0x23,
+    0x10, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x03,
+    0x40, 0x20, 0x00, 0x23, 0x80, 0x18, 0x00, 0x23, 0x80, 0x82, 0x00, 0x23,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    // 0x10D 'č'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x10, 0x02, 0x10, 0xBF, 0x40, 0x08, 0x04, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x50, 0x02, 0x3F, 0x08, 0x10, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x3F, 0x10, 0x40, 0x00, 0x3F, 0x20, 0x02, 0x02, 0x3F,
+    0x00, 0x14, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x10E 'Ď'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x13, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x24, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x40, 0x20, 0x00, 0x2B,
+    0x80, 0x80, 0x00, 0x0B, 0x80, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x44, 0x01, 0x03, 0x00, 0x01, 0x8C, 0x23, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x08, 0x00, 0x03, 0x00, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x10F 'ď'
+    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x46, 0x61, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x80, 0x04, 0x7F,
+    0x00, 0xA0, 0x00, 0xFF, 0x00, 0x20, 0x00, 0x7F, 0x20, 0x20, 0x00, 0x7F,
+    0x40, 0xA0, 0x04, 0x7F, 0x40, 0x80, 0x00, 0x7F, 0x0F, 0x1F, 0xF2, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x58, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0xC0, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x50, 0x00, 0x0F, 0x20, 0x50, 0x00, 0x0F, 0x20, 0x50, 0x00, 0x0F,
+    0x20, 0x50, 0x01, 0xCF, 0x20, 0x50, 0x00, 0x2F, 0x20, 0x50, 0x04, 0x0F,
+    0x20, 0x10, 0x02, 0x8F, 0x20, 0x10, 0x24, 0x0F, 0x04, 0x00, 0x40, 0x0F,
+    0x80, 0x00, 0x00, 0x4F, 0x00, 0x01, 0xE0, 0x0F,
+    // 0x119 'ę'
+    0x03, 0xF0, 0x01, 0x10, 0x04, 0x01, 0x20, 0x00, 0x01, 0x4E, 0x91, 0x01,
+    0x02, 0x88, 0x01, 0xA2, 0x84, 0x01, 0x82, 0x80, 0x01, 0x02, 0x80, 0xC1,
+    0x22, 0x80, 0x01, 0x82, 0x80, 0x71, 0x06, 0x80, 0x81, 0x40, 0x84, 0x09,
+    0x20, 0x84, 0x0D, 0x00, 0x00, 0x01,
+    // 0x11A 'Ě'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07,
+    0x20, 0x20, 0x50, 0x07, 0x00, 0x20, 0x50, 0x07, 0x10, 0x20, 0x50, 0x07,
+    0x24, 0x20, 0x50, 0x07, 0x48, 0x20, 0x50, 0x07, 0x10, 0x20, 0x50, 0x07,
+    0xA0, 0x20, 0x10, 0x07, 0x40, 0x20, 0x10, 0x27, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0xE7,
+    // 0x11B 'ě'
+    0x00, 0x01, 0xF8, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x40, 0x10, 0x00, 0x3F,
+    0x10, 0x27, 0x48, 0xBF, 0x40, 0x01, 0x44, 0x3F, 0x00, 0x51, 0x42, 0x3F,
+    0x00, 0x41, 0x40, 0x3F, 0x08, 0x01, 0x40, 0x7F, 0x02, 0x11, 0x40, 0x3F,
+    0x40, 0x41, 0x40, 0x3F, 0x10, 0x03, 0x40, 0x3F, 0x00, 0x20, 0x42, 0xBF,
+    0x00, 0x10, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x139 'Ĺ'
+    0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00, 0x07,
+    0x14, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x48, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x50, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xE7,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x05, 0x14, 0x80, 0x00, 0x01,
+    0x00, 0x3F, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x48, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x13D 'Ľ'
+    0x18, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x02, 0x00, 0x00, 0x48, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0xC0, 0x14, 0x0F, 0x00, 0x00, 0x17,
+    0x00, 0x28, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x20, 0xA0, 0x07, 0x00, 0x00, 0x07, 0x40, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x80, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x01, 0xE7,
+    // 0x142 'ł'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0x40, 0x05, 0x00,
+    0x1F, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    // 0x143 'Ń'
+    0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x87, 0xFF, 0xE3,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x03, 0x0C, 0x00, 0x80, 0x03,
+    0x14, 0x04, 0x00, 0x03, 0x00, 0x00, 0x10, 0x03, 0x20, 0x00, 0x80, 0x03,
+    0x48, 0x00, 0x42, 0x03, 0x00, 0x00, 0x10, 0x03, 0x10, 0x40, 0x08, 0x43,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x03, 0x00, 0x3F, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x13, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x40, 0x00, 0x7F, 0x12, 0x50, 0x00, 0x7F, 0x04, 0x10, 0x00, 0x7F,
+    0x08, 0x00, 0x01, 0x7F, 0x50, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0x147 'Ň'
+    0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x87, 0xFF, 0xE3,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03,
+    0x00, 0x04, 0x00, 0x03, 0x10, 0x00, 0x10, 0x03, 0x00, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x10, 0x03, 0x80, 0x40, 0x08, 0x43,
+    0x80, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x03, 0x00, 0x3F, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x60, 0x40, 0x00, 0x7F,
+    0x10, 0x13, 0xFE, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x50, 0x00, 0x7F, 0x02, 0x10, 0x00, 0x7F,
+    0x40, 0x00, 0x01, 0x7F, 0x10, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    // 0x152 'Œ'
+    0x00, 0x78, 0x03, 0x02, 0x01, 0x03, 0x08, 0x00, 0x43, 0x00, 0x30, 0x23,
+    0x22, 0x00, 0x13, 0x48, 0x00, 0x83, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x03,
+    0xA0, 0x00, 0x23, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x3F, 0xFF, 0xE3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x3F, 0x8F, 0xE3, 0x20, 0x50, 0x03, 0x20, 0x50, 0x03, 0x20, 0x50, 0x03,
+    0x20, 0x50, 0x03, 0x20, 0x50, 0x03, 0x20, 0x50, 0x03, 0x20, 0x10, 0x23,
+    0x04, 0x00, 0x43, 0x04, 0x01, 0x03, 0x00, 0x01, 0x33,
+    // 0x153 'œ'
+    0x03, 0xF0, 0x7F, 0x10, 0x04, 0x7F, 0x20, 0x00, 0x7F, 0x46, 0x61, 0x7F,
+    0x10, 0x08, 0x7F, 0x80, 0x04, 0x7F, 0xA0, 0x00, 0xFF, 0x20, 0x02, 0xFF,
+    0x20, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x10, 0x04, 0x7F, 0x04, 0x10, 0x7F,
+    0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x0A, 0x91, 0x7F,
+    0x02, 0x80, 0x7F, 0xA2, 0x84, 0x7F, 0x02, 0x80, 0x7F, 0x22, 0x80, 0xFF,
+    0xA2, 0x80, 0x7F, 0x92, 0x80, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x85, 0x7F,
+    0x10, 0x86, 0x7F,
+    // 0x158 'Ř'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x13, 0x40, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x20, 0x03, 0x10, 0x00, 0x20, 0x03, 0x00, 0x00, 0x08, 0x13,
+    0x00, 0x00, 0x02, 0x03, 0x00, 0x20, 0x41, 0x03, 0x80, 0x80, 0x08, 0x03,
+    0x80, 0x89, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B,
+    0x00, 0x19, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B,
+    // 0x159 'ř'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F, 0x20, 0x00, 0x01, 0x7F,
+    0x00, 0x08, 0x02, 0x7F, 0x04, 0x40, 0x00, 0x7F, 0x12, 0x40, 0x00, 0x7F,
+    0x08, 0x03, 0xFE, 0x7F, 0x10, 0x14, 0x00, 0x7F, 0x24, 0x28, 0x00, 0x7F,
+    0x48, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x40, 0x08, 0x00, 0x7F,
+    0x00, 0x48, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x01, 0xF3, 0x00, 0x19, 0x02, 0x0B, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x92, 0x20, 0x03, 0x04, 0xA1, 0x00, 0x07,
+    0x14, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x03,
+    0x48, 0x00, 0x04, 0x23, 0x00, 0x20, 0x22, 0x4B, 0x60, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x70, 0x04, 0xC3,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0xBF, 0x00, 0x00, 0x88, 0x3F,
+    0x00, 0x04, 0x42, 0x3F, 0x00, 0x52, 0x00, 0x3F, 0x00, 0x40, 0x21, 0x7F,
+    0x12, 0x01, 0x01, 0x7F, 0x04, 0x00, 0x01, 0x3F, 0x00, 0x50, 0x80, 0x3F,
+    0x10, 0x44, 0x00, 0xBF, 0x00, 0x00, 0x41, 0x3F, 0x00, 0x10, 0x16, 0x3F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x01, 0xF3, 0x00, 0x19, 0x02, 0x0B, 0x00, 0x00, 0x03, 0x03,
+    0x90, 0x00, 0x00, 0x43, 0x48, 0x92, 0x20, 0x03, 0x20, 0xA1, 0x00, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x10, 0x00, 0x00, 0x07, 0x24, 0x00, 0x08, 0x03,
+    0x48, 0x00, 0x04, 0x23, 0x10, 0x20, 0x22, 0x4B, 0xA0, 0x80, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x00, 0x70, 0x04, 0xC3,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0x00, 0xBF, 0x10, 0x00, 0x88, 0x3F,
+    0x40, 0x04, 0x42, 0x3F, 0x00, 0x52, 0x00, 0x3F, 0x00, 0x40, 0x21, 0x7F,
+    0x08, 0x01, 0x01, 0x7F, 0x02, 0x00, 0x01, 0x3F, 0x00, 0x50, 0x80, 0x3F,
+    0x10, 0x44, 0x00, 0xBF, 0x00, 0x00, 0x41, 0x3F, 0x00, 0x10, 0x16, 0x3F,
+    // 0x164 'Ť'
+    0x00, 0xE4, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0xA0, 0x20, 0x00, 0x07, 0x10, 0x20, 0x00, 0x17,
+    0x48, 0x20, 0x00, 0x07, 0x24, 0x3F, 0xFF, 0xE7, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x04, 0x1F, 0xFF, 0xE7, 0x40, 0x20, 0x00, 0x07,
+    0x80, 0x20, 0x00, 0x07, 0x80, 0x20, 0x00, 0x17, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x165 'ť'
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x7F,
+    0x84, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x1F, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x21, 0x24, 0x20, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x11, 0x25, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x03,
+    0xA1, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x11,
+    0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x18, 0x40, 0x00, 0x3F,
+    0x42, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00, 0x7F, 0x81, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x3F, 0xA5, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x02, 0xBF,
+    0x24, 0x00, 0x04, 0x3F, 0x00, 0x40, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x1F, 0xFF, 0x85, 0x04, 0x00, 0x00, 0x21, 0x0A, 0x20, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x11, 0x24, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x24, 0x00, 0x00, 0x09,
+    0x48, 0x00, 0x00, 0x11, 0x40, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x02, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x22, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x10, 0x02, 0xBF,
+    0x22, 0x00, 0x04, 0x3F, 0x04, 0x40, 0x01, 0x3F, 0x40, 0x40, 0x00, 0x3F,
+    0x20, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x178 'Ÿ'
+    0x01, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x41, 0x00, 0x2F, 0x00, 0x00, 0x40, 0x0F, 0x60, 0x84, 0x00, 0x0F,
+    0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x20, 0x00, 0x80, 0x0F,
+    0x00, 0x02, 0x20, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x21, 0x00, 0x0F,
+    0x00, 0x04, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x2B, 0x00, 0x80, 0x00, 0x03, 0x00, 0x04, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x08, 0x43, 0x0C, 0x20, 0x10, 0x03,
+    0x04, 0x20, 0x02, 0x03, 0x00, 0x20, 0x80, 0x03, 0x20, 0x20, 0x10, 0x03,
+    0x48, 0x24, 0x20, 0x03, 0x00, 0x28, 0x00, 0x03, 0x10, 0x21, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x08, 0x00, 0x83, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x63,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x02, 0xBF, 0x00, 0x02, 0x04, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x44, 0x3F,
+    0x06, 0x10, 0x88, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x20, 0x10, 0x40, 0x3F,
+    0x00, 0x18, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x02, 0x3F,
+    0x00, 0x08, 0x08, 0x3F, 0x00, 0x30, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x07, 0x00, 0x08, 0x02, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x10, 0x87, 0x00, 0x40, 0x20, 0x07,
+    0x90, 0x40, 0x04, 0x07, 0x00, 0x41, 0x00, 0x07, 0x00, 0x40, 0x20, 0x07,
+    0x00, 0x48, 0x40, 0x07, 0x00, 0x50, 0x00, 0x07, 0x00, 0x42, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x10, 0x01, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xC7,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x0A, 0x00, 0x08, 0x10, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x00, 0x42, 0x20, 0x80, 0x40, 0x00,
+    0x80, 0x41, 0x00, 0x60, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x20, 0x20, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x00,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x2B, 0x00, 0x80, 0x00, 0x03, 0x40, 0x04, 0x01, 0x03,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x20, 0x08, 0x43, 0x00, 0x20, 0x10, 0x03,
+    0x04, 0x20, 0x02, 0x03, 0x10, 0x20, 0x80, 0x03, 0x00, 0x20, 0x10, 0x03,
+    0x00, 0x24, 0x20, 0x03, 0x00, 0x28, 0x00, 0x03, 0x80, 0x21, 0x00, 0x23,
+    0x80, 0x00, 0x00, 0x23, 0x00, 0x08, 0x00, 0x83, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x63,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x02, 0xBF, 0x00, 0x02, 0x04, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x24, 0x10, 0x44, 0x3F,
+    0x12, 0x10, 0x88, 0x3F, 0x08, 0x10, 0x00, 0x3F, 0x10, 0x10, 0x40, 0x3F,
+    0x04, 0x18, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x02, 0x3F,
+    0x00, 0x08, 0x08, 0x3F, 0x00, 0x30, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x0C, 0x7F, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x7C, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x1F, 0x0C, 0x7F, 0x00, 0x01, 0x7F, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x01, 0x7F, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xF1,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x21, 0xFF, 0xFD, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x20, 0x21,
+    0x00, 0x00, 0x11, 0x11, 0x00, 0x03, 0x14, 0x48, 0x0B, 0x40, 0x20, 0x03,
+    0x42, 0x04, 0x01, 0x08, 0x02, 0x01, 0x00, 0x00, 0x85, 0x00, 0x08, 0x01,
+    0x00, 0x04, 0x11, 0x00, 0x00, 0x81,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    // 0x2018 '‘'
+    0x03, 0x3F, 0x10, 0x7F, 0x00, 0x7F, 0x0E, 0x7F, 0x20, 0xBF, 0x00, 0x3F,
+    // 0x2019 '’'
+    0x00, 0x3F, 0x00, 0xFF, 0x12, 0x7F, 0x00, 0xBF, 0x00, 0x3F, 0x38, 0x3F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x00, 0xBF, 0x16, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x38, 0x3F,
+    // 0x201B '‛'
+    0x38, 0x3F, 0x02, 0x3F, 0x00, 0xBF, 0x1E, 0x7F, 0x00, 0xFF, 0x00, 0x3F,
+    // 0x201C '“'
+    0x03, 0x3F, 0x10, 0x7F, 0x00, 0x7F, 0x0E, 0x7F, 0x20, 0xBF, 0x00, 0x3F,
+    0x03, 0x3F, 0x10, 0x7F, 0x00, 0x7F, 0x0E, 0x7F, 0x20, 0xBF, 0x00, 0x3F,
+    // 0x201D '”'
+    0x00, 0x3F, 0x00, 0xFF, 0x12, 0x7F, 0x00, 0xBF, 0x00, 0x3F, 0x38, 0x3F,
+    0x00, 0x3F, 0x00, 0xFF, 0x12, 0x7F, 0x00, 0xBF, 0x00, 0x3F, 0x38, 0x3F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x00, 0xBF, 0x16, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x38, 0x3F,
+    0x00, 0x3F, 0x00, 0xBF, 0x16, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x38, 0x3F,
+    // 0x201F '‟'
+    0x38, 0x3F, 0x02, 0x3F, 0x00, 0xBF, 0x1E, 0x7F, 0x00, 0xFF, 0x00, 0x3F,
+    0x38, 0x3F, 0x02, 0x3F, 0x00, 0xBF, 0x1E, 0x7F, 0x00, 0xFF, 0x00, 0x3F,
+    // 0x2020 '†'
+    0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x02, 0x80, 0x0F,
+    0x00, 0x80, 0x0F, 0x06, 0xFE, 0x1F, 0x00, 0x00, 0x0F, 0x0E, 0xFE, 0x1F,
+    0x00, 0x80, 0x0F, 0x02, 0x80, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x0F,
+    // 0x2021 '‡'
+    0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00,
+    0x00, 0x80, 0x40, 0x06, 0xC1, 0x20, 0x00, 0x00, 0x01, 0x0E, 0xC3, 0x20,
+    0x00, 0x80, 0x40, 0x02, 0x80, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0x00,
+    // 0x2022 '•'
+    0x31, 0x05, 0x81, 0x81, 0x81, 0x05, 0x31,
+    // 0x2026 '…'
+    0x07, 0x07, 0x87, 0x87, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x87, 0x87, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+    0x17, 0x07,
+    // 0x2039 '‹'
+    0x05, 0x0F, 0x08, 0x0F, 0x10, 0x0F, 0x20, 0x0F, 0x08, 0x8F, 0x10, 0x5F,
+    0x00, 0x3F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x00, 0x0F, 0x20, 0x1F, 0x50, 0x0F, 0x01, 0x2F, 0x00, 0x4F, 0x00, 0x0F,
+    0x00, 0x0F, 0x02, 0x0F,
+    // 0x2070 '⁰'
+    0x0C, 0x21, 0x20, 0x09, 0x43, 0x85, 0x10, 0x11, 0xA0, 0x01, 0xA0, 0x01,
+    0xA0, 0x01, 0x80, 0x11, 0x08, 0x41, 0x40, 0x09, 0x00, 0x21, 0x00, 0x01,
+    // 0x2074 '⁴'
+    0x00, 0x61, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x12, 0x01, 0x24, 0x01,
+    0x08, 0x11, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x2075 '⁵'
+    0x00, 0x01, 0x00, 0x0D, 0x1E, 0x09, 0x00, 0x01, 0x18, 0x01, 0x20, 0x01,
+    0x25, 0x05, 0x20, 0xC1, 0x22, 0x01, 0x41, 0xE1,
+    // 0x2076 '⁶'
+    0x00, 0x01, 0x04, 0x11, 0x00, 0x01, 0x01, 0x65, 0x00, 0x11, 0x44, 0x01,
+    0x04, 0x01, 0xA4, 0x01, 0x80, 0x65, 0x82, 0x01, 0x00, 0xB1,
+    // 0x2077 '⁷'
+    0x10, 0x01, 0x00, 0x01, 0x00, 0x09, 0x20, 0x41, 0x21, 0x05, 0x24, 0x21,
+    0x21, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x01, 0x18, 0x09, 0x00, 0x05, 0x00, 0x51, 0xA0, 0x89, 0x80, 0x09,
+    0x80, 0x89, 0xA0, 0x01, 0x00, 0x05, 0x04, 0x09, 0x00, 0x61,
+    // 0x2079 '⁹'
+    0x00, 0x01, 0x22, 0x05, 0x40, 0x09, 0x1C, 0x89, 0xA0, 0x01, 0x80, 0x11,
+    0xA1, 0x21, 0x01, 0x09, 0x00, 0x11, 0x00, 0x21, 0x0F, 0x01,
+    // 0x2080 '₀'
+    0x0C, 0x21, 0x20, 0x09, 0x43, 0x85, 0x10, 0x11, 0x00, 0x01, 0xA0, 0x09,
+    0xA0, 0x01, 0x80, 0x11, 0x08, 0x45, 0x40, 0x09, 0x10, 0x21, 0x00, 0x01,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x10, 0x0B, 0x10, 0x0B, 0x50, 0x03, 0x00, 0x03, 0x80, 0x03,
+    0x40, 0x03, 0x00, 0x03, 0x00, 0x0F,
+    // 0x2082 '₂'
+    0x08, 0x17, 0x00, 0x03, 0x18, 0x03, 0x20, 0x13, 0xA0, 0x23, 0xA0, 0x43,
+    0x94, 0x83, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07,
+    // 0x2083 '₃'
+    0x30, 0x0D, 0x40, 0x09, 0x02, 0x09, 0xA0, 0x01, 0x80, 0x01, 0xA0, 0x11,
+    0x00, 0x61, 0x00, 0x09, 0x38, 0x11, 0x00, 0x01,
+    // 0x2084 '₄'
+    0x00, 0x61, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x12, 0x01, 0x24, 0x01,
+    0x08, 0x11, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x2085 '₅'
+    0x00, 0x01, 0x00, 0x09, 0x1E, 0x09, 0x00, 0x09, 0x18, 0x01, 0x00, 0x01,
+    0x05, 0x15, 0x00, 0x41, 0x02, 0x09, 0x61, 0xA1,
+    // 0x2086 '₆'
+    0x00, 0x01, 0x04, 0x11, 0x00, 0x01, 0x01, 0x61, 0x04, 0x01, 0x44, 0x09,
+    0x05, 0x09, 0xA4, 0x01, 0x80, 0x65, 0x00, 0x01, 0x00, 0x91,
+    // 0x2087 '₇'
+    0x10, 0x01, 0x00, 0x01, 0x10, 0x09, 0x00, 0x41, 0x01, 0x05, 0x04, 0x21,
+    0x01, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x01, 0x18, 0x09, 0x00, 0x05, 0x00, 0x51, 0x20, 0x89, 0x80, 0x09,
+    0x80, 0x89, 0x80, 0x01, 0x03, 0x05, 0x04, 0x09, 0x00, 0x61,
+    // 0x2089 '₉'
+    0x00, 0x01, 0x02, 0x05, 0x40, 0x01, 0x1C, 0x09, 0xA0, 0x01, 0xA1, 0x51,
+    0xA1, 0x05, 0x01, 0x09, 0x00, 0x11, 0x00, 0x21, 0x0F, 0x01,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x03, 0x00, 0x84, 0x03, 0x00, 0x84, 0x03, 0x00, 0xA6, 0x03,
+    0x02, 0x00, 0x03, 0x08, 0x00, 0x23, 0x00, 0x16, 0x13, 0x00, 0x84, 0x83,
+    0x48, 0x84, 0x43, 0x10, 0x94, 0x03, 0x80, 0x94, 0x23, 0x80, 0x90, 0x07,
+    0xA0, 0x00, 0x07, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x9C, 0x00, 0x23,
+    0x00, 0x00, 0x2B, 0x78, 0x00, 0x23,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0xE0, 0x1F, 0x20, 0x1F, 0x40, 0x5F, 0x40, 0x1F, 0x00, 0x1F, 0x3F, 0x9F,
+    0x40, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x43, 0x9F,
+    0x00, 0x1F, 0x10, 0x1F, 0x44, 0x1F, 0x09, 0x1F, 0x00, 0x1F, 0x12, 0x1F,
+    0x48, 0x5F, 0x07, 0x9F, 0x20, 0x1F, 0x80, 0x9F, 0x00, 0x5F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x02, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x06, 0x09, 0x00, 0x00, 0x22, 0x00, 0x00, 0x08, 0x00, 0x01, 0x20,
+    0x00, 0x04, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x02, 0x40, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x88, 0x00, 0x08,
+    0x20, 0x40, 0x08, 0x00, 0x02, 0x0A, 0x00, 0x22, 0x08, 0x00, 0xA0, 0x00,
+    0x00, 0x20, 0x10, 0x00, 0x00, 0x60, 0x00, 0x44, 0x08, 0x00, 0x30, 0x90,
+    // 0x2154 '⅔'
+    0x14, 0x08, 0x00, 0x20, 0x12, 0x00, 0x0C, 0x22, 0x00, 0x50, 0x0A, 0x00,
+    0x40, 0x0A, 0x00, 0x40, 0x2A, 0x00, 0x4E, 0x4A, 0x00, 0x00, 0x8A, 0x02,
+    0x20, 0x0A, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x40, 0x00, 0x09, 0x00, 0x00, 0x24, 0x00, 0x00, 0x80, 0x00,
+    0x02, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x10, 0x40, 0x08, 0x40, 0x02, 0x0A, 0x00, 0x22, 0x08, 0x00, 0xA0, 0x00,
+    0x00, 0x20, 0x10, 0x00, 0x00, 0x60, 0x00, 0x44, 0x08, 0x00, 0x30, 0x90,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x02, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x06, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x09, 0x00, 0x00, 0x24, 0x00, 0x00, 0x90, 0x00,
+    0x02, 0x00, 0x00, 0x08, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x02, 0x04, 0x40, 0x10, 0x40, 0x00, 0x24, 0x88, 0x00, 0x80, 0x02,
+    0x00, 0xA0, 0x88, 0x00, 0x00, 0x40, 0x00, 0x03, 0x04, 0x00, 0x24, 0x88,
+    0x00, 0x00, 0x20,
+    // 0x215C '⅜'
+    0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x40, 0x0A, 0x00, 0x48, 0x70, 0x00, 0x02, 0x04, 0x04,
+    0x1C, 0x00, 0x11, 0x00, 0x00, 0x04, 0x00, 0x00, 0x90, 0x00, 0x02, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x48, 0x00, 0x01, 0x20, 0x00,
+    0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x44, 0x00, 0x00, 0x90, 0x18, 0x00,
+    0x00, 0x02, 0x04, 0x00, 0x10, 0x40, 0x00, 0x24, 0x88, 0x00, 0x80, 0x02,
+    0x00, 0xA0, 0x88, 0x00, 0x00, 0x40, 0x00, 0x03, 0x04, 0x00, 0x24, 0x88,
+    0x00, 0x00, 0x20,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x4C, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x82, 0x00, 0x52, 0x60, 0x00,
+    0x50, 0x00, 0x01, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10,
+    0x00, 0x02, 0x40, 0x00, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x04, 0x80, 0x00, 0x10, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0x90, 0x18, 0x00, 0x40, 0x02, 0x04, 0x00, 0x10, 0x40, 0x00, 0x24, 0x88,
+    0x00, 0x80, 0x02, 0x00, 0xA0, 0x88, 0x00, 0x00, 0x40, 0x00, 0x03, 0x04,
+    0x00, 0x24, 0x88, 0x00, 0x00, 0x20,
+    // 0x215E '⅞'
+    0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x04, 0x00, 0x50, 0x20, 0x00,
+    0x50, 0x82, 0x00, 0x52, 0x10, 0x02, 0x50, 0x80, 0x01, 0x42, 0x00, 0x10,
+    0x44, 0x00, 0x40, 0x00, 0x01, 0x10, 0x00, 0x00, 0x40, 0x00, 0x09, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x80, 0x00, 0x02, 0x20, 0x00, 0x00, 0x80, 0x00,
+    0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x18, 0x00,
+    0x00, 0x02, 0x04, 0x00, 0x10, 0x40, 0x00, 0x24, 0x88, 0x00, 0x80, 0x02,
+    0x00, 0xA0, 0x88, 0x00, 0x00, 0x40, 0x00, 0x03, 0x04, 0x00, 0x24, 0x88,
+    0x00, 0x00, 0x20,
+    // 0x2190 '←'
+    0x02, 0x07, 0x00, 0x07, 0x00, 0x07, 0x05, 0x07, 0x09, 0x07, 0x11, 0x07,
+    0x21, 0x37, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x02, 0x07,
+    // 0x2191 '↑'
+    0x04, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x28, 0x00, 0x0F,
+    0x50, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x50, 0x00, 0x0F,
+    0x28, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x02, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x05, 0x07, 0x05, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x21, 0x37,
+    0x11, 0x07, 0x09, 0x07, 0x05, 0x07, 0x00, 0x07, 0x00, 0x07, 0x02, 0x07,
+    // 0x2193 '↓'
+    0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x0F,
+    0x00, 0x02, 0x0F, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2194 '↔'
+    0x00, 0x07, 0x00, 0x87, 0x00, 0x47, 0x05, 0x27, 0x01, 0x17, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x17, 0x05, 0x27, 0x00, 0x47, 0x00, 0x87, 0x02, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x87, 0x02, 0x00, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x00, 0x47, 0x00, 0x00, 0x87, 0x00, 0x01, 0x07,
+    // 0x21D0 '⇐'
+    0x02, 0x03, 0x04, 0x03, 0x02, 0x03, 0x05, 0x03, 0x04, 0x03, 0x14, 0x43,
+    0xA4, 0x4B, 0x04, 0x43, 0x14, 0x43, 0x14, 0x43, 0x14, 0x43, 0x14, 0x43,
+    0x14, 0x43, 0x14, 0x43, 0x14, 0x43, 0x14, 0x03, 0x14, 0x03, 0x08, 0xC3,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x02, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x3F, 0xA0, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x02, 0x00, 0x3F,
+    0x02, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D2 '⇒'
+    0x08, 0xC3, 0x14, 0x03, 0x14, 0x03, 0x14, 0x43, 0x14, 0x43, 0x14, 0x43,
+    0x14, 0x43, 0x14, 0x43, 0x14, 0x43, 0x14, 0x43, 0x04, 0x43, 0xA4, 0x4B,
+    0x14, 0x43, 0x04, 0x03, 0x05, 0x03, 0x02, 0x03, 0x04, 0x03, 0x02, 0x03,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x21D4 '⇔'
+    0x01, 0x03, 0x00, 0x83, 0x01, 0x43, 0x04, 0x23, 0x44, 0x13, 0x94, 0x6B,
+    0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+    0x94, 0x6B, 0x44, 0x13, 0x04, 0x23, 0x01, 0x43, 0x00, 0x83, 0x01, 0x03,
+    // 0x2202 '∂'
+    0x00, 0x00, 0xF8, 0x7F, 0x00, 0x04, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x20, 0x01, 0x08, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x10, 0x20, 0x12, 0x7F, 0x48, 0x00, 0x44, 0x7F, 0x03, 0x8C, 0x08, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x08, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x43, 0x00, 0x02, 0x03,
+    0x00, 0x08, 0x33, 0x00, 0x41, 0x03, 0x01, 0x04, 0x03, 0x00, 0x20, 0x03,
+    0x21, 0x80, 0x03, 0x44, 0x00, 0x03, 0x06, 0x00, 0x03, 0x40, 0xC0, 0x03,
+    0x10, 0x10, 0x03, 0x02, 0x02, 0x03, 0x00, 0x40, 0x43, 0x00, 0x18, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x0F,
+    // 0x220F '∏'
+    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x01, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x22, 0x7F, 0x01, 0x00, 0x40, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x24, 0x22, 0x20, 0x7F, 0x22, 0x10, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x42, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x0C, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x17, 0x3F,
+    // 0x221A '√'
+    0x00, 0x0A, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x08, 0x0C, 0x07,
+    0x00, 0x03, 0x00, 0x87, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0x02, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x30, 0x27, 0x00, 0x01, 0x03, 0x07,
+    0x00, 0x18, 0x10, 0x07, 0x00, 0x80, 0x80, 0x07, 0x04, 0x04, 0x00, 0x07,
+    0x60, 0x20, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x04, 0x1F, 0x20, 0x9F, 0x46, 0x5F, 0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F,
+    0x00, 0x1F, 0x40, 0x1F, 0x24, 0x1F, 0x11, 0x1F, 0x04, 0x9F, 0x00, 0x5F,
+    0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x11, 0x1F, 0x40, 0x5F, 0x20, 0x1F,
+    0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x09,
+    0x40, 0x00, 0x00, 0xE1, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x01,
+    // 0x2260 '≠'
+    0x10, 0xA3, 0x00, 0xA3, 0x00, 0xBB, 0x00, 0x8B, 0x00, 0x03, 0x02, 0x23,
+    0x00, 0xA3, 0x02, 0xA3, 0x00, 0xA3, 0x00, 0xA3, 0x40, 0xA3, 0x00, 0xA3,
+    0x18, 0x43,
+    // 0x2264 '≤'
+    0x01, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x0A, 0x00, 0x3F,
+    0x01, 0x40, 0x3F, 0x14, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x28, 0x00, 0x3F,
+    0x00, 0x40, 0x3F, 0x50, 0x08, 0x3F, 0x00, 0x20, 0x3F, 0xA0, 0x00, 0x3F,
+    0x00, 0x00, 0xFF,
+    // 0x2265 '≥'
+    0x60, 0x10, 0x3F, 0x80, 0x00, 0x3F, 0x10, 0x20, 0x3F, 0x40, 0x08, 0x3F,
+    0x08, 0x40, 0x3F, 0x00, 0x10, 0x3F, 0x04, 0x80, 0x3F, 0x00, 0x20, 0x3F,
+    0x0A, 0x00, 0x3F, 0x00, 0x40, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x80, 0x3F,
+    0x03, 0x00, 0xFF,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly30ColOffsets[] PROGMEM = {
+    0x0, 0x1E, 0x2D, 0x3F, 0x78, 0xB4, 0x105, 0x14A, 0x152, 0x17A, 0x1A2, 0x1B8,
+    0x1D2, 0x1E0, 0x1EA, 0x1F0, 0x217, 0x24A, 0x26E, 0x29B, 0x2C5, 0x2F8, 0x322, 0x34F,
+    0x379, 0x3A6, 0x3D6, 0x3E2, 0x3F7, 0x411, 0x41E, 0x438, 0x459, 0x4C5, 0x50A, 0x53D,
+    0x570, 0x5AF, 0x5E2, 0x612, 0x64E, 0x693, 0x6B1, 0x6E5, 0x724, 0x757, 0x7A8, 0x7ED,
+    0x82C, 0x85F, 0x8BB, 0x8F7, 0x921, 0x95A, 0x99F, 0x9E1, 0xA44, 0xA86, 0xAC5, 0xAF5,
+    0xB0D, 0xB34, 0xB50, 0xB6E, 0xB7D, 0xB84, 0xBB4, 0xBFC, 0xC26, 0xC6E, 0xC98, 0xCC5,
+    0xCFB, 0xD37, 0xD55, 0xD79, 0xDC1, 0xDDF, 0xE1B, 0xE43, 0xE73, 0xEA9, 0xEDC, 0xEF8,
+    0xF1C, 0xF40, 0xF7C, 0xFB2, 0x1003, 0x1027, 0x105D, 0x108A, 0x10AE, 0x10BE, 0x10E6, 0x10F5,
+    0x1104, 0x113C, 0x116F, 0x1191, 0x11CD, 0x11F4, 0x1239, 0x124F, 0x126D, 0x12A0, 0x12B4, 0x12DB,
+    0x12EF, 0x1303, 0x133C, 0x137C, 0x1382, 0x1394, 0x13AA, 0x13CA, 0x1421, 0x1478, 0x14D2, 0x14F3,
+    0x154F, 0x15AB, 0x1607, 0x1663, 0x16BF, 0x171B, 0x176F, 0x17B3, 0x17F7, 0x183B, 0x187F, 0x18C3,
+    0x18EB, 0x1913, 0x193F, 0x196B, 0x19AD, 0x1A09, 0x1A5D, 0x1AB1, 0x1B05, 0x1B59, 0x1BAD, 0x1BC7,
+    0x1C0C, 0x1C68, 0x1CC4, 0x1D20, 0x1D7C, 0x1DAF, 0x1DFB, 0x1E3B, 0x1E7B, 0x1EBB, 0x1EFB, 0x1F2B,
+    0x1F6B, 0x1FB0, 0x1FDA, 0x2012, 0x204A, 0x2082, 0x20AC, 0x20D4, 0x20FC, 0x211A, 0x213B, 0x217B,
+    0x21B7, 0x21F7, 0x2237, 0x2277, 0x22B7, 0x22E7, 0x2301, 0x2337, 0x2387, 0x23D7, 0x2427, 0x2463,
+    0x24AB, 0x24F3, 0x254F, 0x257F, 0x25C3, 0x25FB, 0x263F, 0x2677, 0x26CB, 0x271B, 0x275F, 0x2789,
+    0x27CD, 0x2805, 0x2849, 0x2871, 0x28A4, 0x28C8, 0x2901, 0x2925, 0x2981, 0x29D1, 0x2A2D, 0x2A7D,
+    0x2ACE, 0x2B19, 0x2B69, 0x2BA1, 0x2BD9, 0x2C09, 0x2C41, 0x2C71, 0x2CBD, 0x2CED, 0x2D49, 0x2D99,
+    0x2DF5, 0x2E45, 0x2E99, 0x2ED9, 0x2F15, 0x2F55, 0x2F82, 0x2FC2, 0x2FFE, 0x303A, 0x307C, 0x308B,
+    0x30A9, 0x30B5, 0x30C1, 0x30CD, 0x30D9, 0x30F1, 0x3109, 0x3121, 0x3139, 0x3160, 0x3187, 0x318E,
+    0x31A8, 0x31B8, 0x31C8, 0x31E0, 0x31F8, 0x320C, 0x3222, 0x3236, 0x324C, 0x3262, 0x327A, 0x328C,
+    0x32A0, 0x32B4, 0x32CC, 0x32E0, 0x32F6, 0x330A, 0x3320, 0x3336, 0x335D, 0x3384, 0x33BA, 0x33E1,
+    0x3408, 0x342F, 0x345D, 0x34B1, 0x3505, 0x355C, 0x35B3, 0x360D, 0x3664, 0x3688, 0x36AC, 0x36D0,
+    0x36F4, 0x3718, 0x373C, 0x3760, 0x378A, 0x37AE, 0x37D8, 0x37FC, 0x3838, 0x3871, 0x38CD, 0x3915,
+    0x3961, 0x3987, 0x39C7, 0x39E1, 0x3A08, 0x3A2F, 0x3A56, 0x3A7D, 0x3AA4, 0x3ACB, 0x3AF2, 0x3B19,
+    0x3B40, 0x3B67, 0x3B8E, 0x3BB5, 0x3BDC, 0x3C03, 0x3C2A, 0x3C51, 0x3C78, 0x3C9F, 0x3CC6, 0x3CED,
+    0x3D14, 0x3D3B, 0x3D62
+};
+
+
 const SimpleGFXfont Bookerly30 PROGMEM = {Bookerly30Bitmaps, Bookerly30Bitmaps_lsb, Bookerly30Bitmaps_msb, Bookerly30Glyphs,
-    315, 32};
+    315, 32,
+    nullptr, 0, FontStyle::REGULAR, Bookerly30GlyphIndexLatin1, Bookerly30GlyphRanges, 13,
+    Bookerly30BitmapsCol, Bookerly30BitmapsCol_lsb, Bookerly30BitmapsCol_msb, Bookerly30ColOffsets};
@@ -6066,5 +6066,5646 @@ const SimpleGFXglyph Bookerly30BoldGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly30BoldGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly30BoldGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly30BoldBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xC0, 0x07, 0xF3, 0x80, 0x00, 0x61, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
+    0x83, 0xFF, 0xE1, 0xFF, 0xFF, 0xF3,
+    // 0x22 '"'
+    0xC0, 0xFF, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xF8, 0xF1, 0x9F, 0xF8, 0xF0, 0x1F,
+    0xF8, 0x80, 0x1F, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xFF, 0x80, 0x11, 0xFF,
+    0x80, 0xF1, 0xFF, 0x98, 0xF1, 0x1F, 0xF8, 0xF0, 0x1F, 0xF8, 0x00, 0x1F,
+    0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xFF, 0x80, 0xF1, 0xFF,
+    0xF8, 0xF3, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x0F, 0x81, 0xFF, 0xFC, 0x03, 0x81, 0xFF,
+    0xF8, 0x03, 0xE0, 0xFF, 0xF8, 0x01, 0xF8, 0xFF, 0xF1, 0xE1, 0xF8, 0xFF,
+    0xF1, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7F,
+    0xF1, 0xF8, 0x78, 0xFF, 0xF0, 0xF8, 0x30, 0xFF, 0xF0, 0x3C, 0x01, 0xFF,
+    0xF8, 0x3C, 0x01, 0xFF, 0xFC, 0x3E, 0x03, 0xFF, 0xFE, 0xFF, 0x8F, 0xFF,
+    // 0x25 '%'
+    0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+    0xC0, 0x03, 0xFF, 0xFF, 0xC7, 0xF1, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF,
+    0xC7, 0xF1, 0xFD, 0xFF, 0xC3, 0xC3, 0xF0, 0xFF, 0xC0, 0x03, 0xC0, 0xFF,
+    0xE0, 0x07, 0x81, 0xFF, 0xF0, 0x0E, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3C, 0x07, 0xFF, 0xC0, 0x70, 0x03, 0xFF,
+    0x81, 0xE0, 0x01, 0xFF, 0x87, 0xE1, 0xE1, 0xFF, 0xDF, 0xE7, 0xF8, 0xFF,
+    0xFF, 0xE7, 0xF8, 0xFF, 0xFF, 0xE3, 0xF1, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x26 '&'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07,
+    0xF8, 0xC0, 0x03, 0xE0, 0x03, 0x83, 0x80, 0x07, 0xE3, 0x80, 0x03, 0xE3,
+    0x04, 0x01, 0xE3, 0x1F, 0xC0, 0xF1, 0x1F, 0x60, 0x71, 0x1E, 0x38, 0x23,
+    0x00, 0x7C, 0x03, 0x80, 0x7E, 0x03, 0x80, 0xC7, 0x03, 0xE3, 0xC7, 0x07,
+    0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC7, 0xE3,
+    0xFF, 0xC7, 0xE1, 0xFF, 0xCF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0xC0, 0xFF, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x9F, 0xFF,
+    // 0x28 '('
+    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0xFF, 0xF8, 0x0F,
+    0x83, 0xFF, 0xFE, 0x0F, 0x0F, 0xFF, 0xFF, 0x87, 0x9F, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF, 0x87,
+    0x07, 0xFF, 0xFF, 0x07, 0x81, 0xFF, 0xFC, 0x0F, 0xC0, 0x3F, 0xE0, 0x1F,
+    0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xC2, 0x3F, 0xE0, 0x3F, 0xF0, 0xFF, 0xC0, 0x1F,
+    0x80, 0x1F, 0x81, 0x1F, 0xD9, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x80, 0xFF,
+    0x83, 0xFF, 0xFF, 0xFF,
+    // 0x2D '-'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xFF,
+    // 0x2E '.'
+    0xFF, 0x87, 0x83, 0x83, 0x87, 0x87, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x81,
+    0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
+    0xFC, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
+    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x83, 0xFF, 0x07, 0x0F, 0xFF, 0x87,
+    0x0F, 0xFF, 0xC3, 0x0F, 0xFF, 0xC3, 0x0F, 0xFF, 0xC7, 0x07, 0xFF, 0x87,
+    0x81, 0xFC, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+    0xF0, 0x00, 0x7F, 0xFE, 0x03, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC3, 0xFF, 0xE7, 0xC3, 0xFF, 0xC7,
+    0xC3, 0xFF, 0xC7, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x87, 0xC0, 0xFF, 0x07, 0x80, 0xFE, 0x07,
+    0x80, 0xFC, 0x07, 0x07, 0xF8, 0x07, 0x0F, 0xF0, 0x07, 0x0F, 0xE0, 0x87,
+    0x0F, 0xC1, 0x87, 0x0F, 0x83, 0x87, 0x00, 0x03, 0x87, 0x80, 0x07, 0x87,
+    0x80, 0x0F, 0x87, 0xC0, 0x3F, 0x87, 0xE0, 0x7F, 0x87, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xCF, 0xC3, 0xFF, 0xC7, 0x83, 0xFF, 0xC7,
+    0x87, 0x8F, 0xC3, 0x0F, 0x8F, 0xC3, 0x0F, 0x8F, 0xC7, 0x1F, 0x8F, 0x87,
+    0x1F, 0x0F, 0x87, 0x0E, 0x0F, 0x07, 0x00, 0x02, 0x07, 0x80, 0x00, 0x0F,
+    0x80, 0x40, 0x1F, 0xC0, 0xC0, 0x1F, 0xE1, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFC, 0x18, 0x7F, 0xF0, 0x38, 0x7F,
+    0xE0, 0xF8, 0x7F, 0x81, 0xF8, 0x7F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x3F, 0xC7, 0x80, 0x1F, 0xC7,
+    0x00, 0x1F, 0xC3, 0x00, 0x1F, 0xC3, 0x00, 0x1F, 0xC7, 0x0E, 0x1F, 0x87,
+    0x0E, 0x0F, 0x87, 0x0E, 0x0F, 0x07, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x0F,
+    0x0F, 0x80, 0x1F, 0x0F, 0xC0, 0x3F, 0x0F, 0xE0, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+    0xF0, 0x00, 0x07, 0xE0, 0x08, 0x07, 0xC0, 0x1F, 0x87, 0x81, 0x1F, 0xC7,
+    0x83, 0x1F, 0xC3, 0x87, 0x1F, 0xC7, 0x0F, 0x0F, 0x87, 0x0F, 0x00, 0x07,
+    0x1F, 0x80, 0x07, 0x1F, 0x80, 0x0F, 0x9F, 0xC0, 0x1F, 0xDF, 0xF0, 0x7F,
+    // 0x37 '7'
+    0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0x07,
+    0x0F, 0xF8, 0x07, 0x0F, 0xE0, 0x03, 0x0F, 0xC0, 0x03, 0x0F, 0x00, 0x1F,
+    0x0E, 0x01, 0xFF, 0x08, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF,
+    0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0x1F, 0xE0, 0x70, 0x0F, 0xC0, 0x20, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x03, 0x87, 0x0E, 0x07, 0xC7, 0x1F, 0x0F, 0xC3,
+    0x1F, 0x0F, 0xC3, 0x1F, 0x07, 0xC7, 0x0E, 0x03, 0x87, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x60, 0x0F, 0xC0, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xEF, 0xC0, 0x0F, 0xE7, 0xC0, 0x07, 0xC7,
+    0x80, 0x07, 0xC3, 0x80, 0x07, 0xC7, 0x0F, 0xC3, 0x87, 0x0F, 0xC3, 0x87,
+    0x0F, 0xE3, 0x07, 0x0F, 0xE2, 0x0F, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x0F, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0xFF, 0x87, 0xF0, 0xFF, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F,
+    0x07, 0xF0, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x87, 0xF3, 0x87, 0x87, 0xF0, 0x07,
+    0x07, 0xF0, 0x0F, 0x07, 0xF0, 0x1F, 0x87, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x3F,
+    0xE2, 0x1F, 0xC3, 0x1F, 0xC7, 0x0F, 0x87, 0x8F, 0x8F, 0x87, 0x0F, 0xC7,
+    0x1F, 0xC3, 0xDF, 0xEF,
+    // 0x3D '='
+    0xFF, 0xFF, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F,
+    0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F,
+    0x8C, 0x7F, 0x8C, 0x7F,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xE7, 0x0F, 0xC3, 0x8F, 0xC7, 0x87, 0x87, 0xC7, 0x8F,
+    0xC3, 0x8F, 0xE3, 0x1F, 0xE1, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF8, 0x7F,
+    0xF8, 0x7F, 0xFC, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0F, 0xC0, 0xC3,
+    0x0F, 0xC0, 0xC1, 0x0F, 0xC0, 0xC1, 0x0F, 0x83, 0xC3, 0x87, 0x87, 0xE3,
+    0x83, 0x87, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x7F,
+    0xE1, 0xFF, 0xF8, 0x7F, 0xC3, 0xFF, 0xFC, 0x3F, 0xC7, 0xFF, 0xFE, 0x3F,
+    0x87, 0x9C, 0x1E, 0x1F, 0x8F, 0x18, 0x0E, 0x1F, 0x8E, 0x18, 0x0F, 0x1F,
+    0x0E, 0x79, 0x0F, 0x1F, 0x0E, 0x71, 0x8F, 0x1F, 0x1E, 0x73, 0x9F, 0x1F,
+    0x1E, 0x00, 0x1F, 0x1F, 0x0E, 0x00, 0x1F, 0x1F, 0x0E, 0x00, 0x0F, 0x1F,
+    0x0F, 0x00, 0x0E, 0x3F, 0x8F, 0xFF, 0x8E, 0x3F, 0x87, 0xFF, 0x8E, 0x3F,
+    0x83, 0xFF, 0x8C, 0x7F, 0xC1, 0xFF, 0x1C, 0xFF, 0xE0, 0x38, 0x1F, 0xFF,
+    0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x63,
+    0xF8, 0x00, 0xF3, 0xC0, 0x18, 0xFF, 0x80, 0xF8, 0xFF, 0x81, 0xF8, 0xFF,
+    0x80, 0x38, 0xFF, 0x80, 0x00, 0xF3, 0xC0, 0x00, 0x73, 0xF8, 0x00, 0x03,
+    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3,
+    // 0x42 'B'
+    0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x8F, 0x87, 0xE3,
+    0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3, 0x87, 0x07, 0xC3,
+    0x80, 0x01, 0x83, 0xC0, 0x00, 0x07, 0xC0, 0x20, 0x07, 0xE0, 0x60, 0x0F,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xC0, 0x78, 0x03, 0x83, 0xFF, 0x03, 0x87, 0xFF, 0x83,
+    0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0xC1, 0x0F, 0xFF, 0xC1,
+    0x8F, 0xFF, 0xC3, 0x83, 0xFF, 0xC3, 0x80, 0xFF, 0xC3, 0x80, 0xFF, 0xC3,
+    0xC1, 0xFF, 0xC7, 0xFF, 0xFF, 0xCF,
+    // 0x44 'D'
+    0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3,
+    0x87, 0xFF, 0xC3, 0x87, 0xFF, 0xC7, 0x83, 0xFF, 0x87, 0xC0, 0xFE, 0x07,
+    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7,
+    0x1F, 0x8F, 0xC7, 0x0F, 0x8F, 0x87, 0x03, 0x8E, 0x07, 0x01, 0xFC, 0x07,
+    0x03, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x46 'F'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x87, 0xC7, 0x1F, 0x87, 0xC7, 0x1F, 0x87, 0xE7, 0x1F, 0x87, 0xFF,
+    0x0F, 0x87, 0xFF, 0x01, 0x87, 0xFF, 0x01, 0xDF, 0xFF, 0x03, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xE0, 0x00, 0x07, 0xC0, 0x7C, 0x03, 0xC1, 0xFF, 0x03, 0x87, 0xFF, 0xC3,
+    0x87, 0xFF, 0xC3, 0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0xE1, 0x8F, 0xF3, 0xE1,
+    0x8F, 0xF1, 0xE3, 0x8F, 0xF1, 0xE3, 0x8F, 0xF1, 0xC3, 0x80, 0xF0, 0x03,
+    0x80, 0xF0, 0x03, 0x80, 0xF0, 0x07, 0xC3, 0xF0, 0x07, 0xFF, 0xF3, 0xFF,
+    // 0x48 'H'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x8F, 0xC7, 0x3F, 0x8F, 0xC7, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xBF, 0x8F, 0xF7, 0x1F, 0x8F, 0xE7, 0x1F, 0x8F, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xE7,
+    // 0x49 'I'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x1F, 0xFF, 0xFE, 0x1F, 0x1F, 0xFF, 0xFC, 0x1F, 0x1F, 0xFF, 0xE0, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x07, 0xC7, 0x3E, 0x03, 0xC7, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0xFF,
+    0xB0, 0x60, 0x3F, 0x20, 0xF0, 0x1F, 0x01, 0xF8, 0x0F, 0x03, 0xFC, 0x07,
+    0x07, 0xFE, 0x07, 0x0F, 0xFF, 0x03, 0x1F, 0xFF, 0x83, 0x1F, 0xFF, 0xC3,
+    0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF,
+    // 0x4C 'L'
+    0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xBF, 0xFF, 0xC7, 0x1F, 0xFC, 0x07,
+    0x18, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x3F, 0xC7,
+    0x01, 0xFF, 0xE7, 0x00, 0x1F, 0xEF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x1F,
+    0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xE7,
+    0x00, 0x07, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1C, 0x00, 0x07, 0x1F, 0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE7,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0xFF, 0xC7,
+    0x80, 0x7F, 0xC7, 0xC0, 0x1F, 0xE7, 0xF0, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0x1F, 0xE0, 0x1F,
+    0x1F, 0xF0, 0x07, 0x1F, 0xF8, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+    0xE0, 0x00, 0x07, 0xC0, 0x38, 0x03, 0x83, 0xFF, 0x03, 0x87, 0xFF, 0xC3,
+    0x8F, 0xFF, 0xE1, 0x8F, 0xFF, 0xE1, 0x8F, 0xFF, 0xE1, 0x8F, 0xFF, 0xE1,
+    0x8F, 0xFF, 0xE3, 0x87, 0xFF, 0xC3, 0x83, 0xFF, 0x83, 0x80, 0xFF, 0x07,
+    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
+    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x50 'P'
+    0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x8F, 0xE3, 0xE3, 0x8F, 0xE3, 0xE3, 0x87, 0xE3, 0xF7, 0x87, 0xC3, 0xFF,
+    0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+    0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x38, 0x03, 0xFF,
+    0x83, 0xFF, 0x03, 0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0xC1, 0xFF,
+    0x8F, 0xFF, 0xE0, 0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0x8F, 0xFF, 0xE0, 0x3F,
+    0x8F, 0xFF, 0xE0, 0x3F, 0x87, 0xFF, 0xC2, 0x1F, 0x83, 0xFF, 0x82, 0x1F,
+    0x80, 0xFE, 0x07, 0x0F, 0xC0, 0x00, 0x07, 0x0F, 0xC0, 0x00, 0x0F, 0x0F,
+    0xE0, 0x00, 0x1F, 0x87, 0xF0, 0x00, 0x3F, 0x87, 0xFC, 0x00, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xBF,
+    // 0x52 'R'
+    0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xF3, 0x8F, 0xFF, 0xE3, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x8F, 0xE3, 0xE3, 0x8F, 0xE0, 0xF3, 0x8F, 0xC0, 0x7F, 0x87, 0xC0, 0x3F,
+    0x80, 0x00, 0x1F, 0x80, 0x0C, 0x07, 0xC0, 0x0E, 0x07, 0xE0, 0x1F, 0x03,
+    0xF0, 0x3F, 0x83, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xF7,
+    // 0x53 'S'
+    0xFF, 0xFF, 0x9F, 0xF0, 0x3E, 0x03, 0xE0, 0x1E, 0x03, 0xC0, 0x0E, 0x03,
+    0x80, 0x07, 0xC3, 0x80, 0x07, 0xE1, 0x8F, 0x03, 0xE1, 0x8F, 0x83, 0xE1,
+    0x0F, 0x81, 0xE1, 0x8F, 0xC1, 0xE3, 0x8F, 0xC0, 0x03, 0x81, 0xE0, 0x03,
+    0x80, 0xE0, 0x07, 0x81, 0xF0, 0x0F, 0xC7, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xE7,
+    0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0xFF, 0x07, 0x1F, 0xFF, 0x87, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0x87,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF,
+    0x10, 0x00, 0x3F, 0x1E, 0x00, 0x07, 0x3F, 0xC0, 0x07, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x07, 0x3F, 0x00, 0x1F, 0x1C, 0x00, 0x7F,
+    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x07, 0x1F, 0x00, 0x07, 0x3F, 0xF0, 0x07, 0xFF, 0xFC, 0x07,
+    0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFC, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x07,
+    0x3F, 0xC0, 0x07, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xE7, 0x3F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0x87,
+    0x07, 0xFF, 0x07, 0x03, 0xFE, 0x07, 0x01, 0xF8, 0x07, 0x00, 0x70, 0x07,
+    0x00, 0x20, 0x47, 0x10, 0x01, 0xE7, 0x38, 0x03, 0xFF, 0xFE, 0x03, 0xFF,
+    0xFE, 0x01, 0xE7, 0xB8, 0x00, 0x67, 0x10, 0x40, 0x07, 0x00, 0xF0, 0x07,
+    0x01, 0xF8, 0x07, 0x03, 0xFC, 0x07, 0x07, 0xFF, 0x07, 0x1F, 0xFF, 0x87,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xE7,
+    // 0x59 'Y'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xF7, 0x00, 0x3F, 0xE7, 0x00, 0x1F, 0xC7,
+    0x10, 0x00, 0x07, 0x3C, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07,
+    0xFF, 0x00, 0x07, 0x1C, 0x0F, 0xC7, 0x10, 0x1F, 0xC7, 0x00, 0x7F, 0xC7,
+    0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x87, 0x01, 0xFF, 0x07, 0x01, 0xFC, 0x07,
+    0x07, 0xF8, 0x07, 0x1F, 0xE0, 0x07, 0x1F, 0xC0, 0x07, 0x1F, 0x00, 0xC7,
+    0x1E, 0x01, 0xC7, 0x1C, 0x03, 0xC7, 0x10, 0x0F, 0xC7, 0x00, 0x1F, 0xC7,
+    0x00, 0x7F, 0xC7, 0x00, 0xFF, 0x87, 0x03, 0xFE, 0x07, 0x07, 0xFC, 0x07,
+    0x8F, 0xFC, 0x07, 0xFF, 0xFE, 0x7F,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xFF, 0xC7,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFD,
+    // 0x5D ']'
+    0x9F, 0xFF, 0xFF, 0xCF, 0x1F, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xF9, 0xFF, 0xE1, 0xFF, 0x01, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x3F,
+    0x81, 0xFF, 0x87, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x01,
+    0xFF, 0x81, 0xFF, 0xF1, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x60 '`'
+    0xFF, 0xC7, 0x83, 0xC3, 0xE1, 0xF0, 0xF9,
+    // 0x61 'a'
+    0xFF, 0xE1, 0xFF, 0xE3, 0xC0, 0x7F, 0xC1, 0x80, 0x7F, 0xC1, 0x80, 0x7F,
+    0x81, 0x00, 0x3F, 0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F,
+    0x87, 0x1C, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x87, 0xF8, 0xFF,
+    0xFF, 0x8F, 0xF8, 0x7F, 0xFF, 0x0F, 0xF8, 0x7F, 0xFF, 0x0F, 0xF8, 0xFF,
+    0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x83, 0xF0, 0x7F, 0x8F, 0xF8, 0x7F, 0x8F, 0xFC, 0x3F,
+    0x8F, 0xFC, 0x3F, 0x81, 0xFC, 0x7F, 0x81, 0xFC, 0x7F, 0xC1, 0xFC, 0x7F,
+    0xC1, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x07, 0xE0, 0x7F,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xCF, 0x1F, 0xF8, 0xFF,
+    0x8F, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x65 'e'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x86, 0x38, 0x7F, 0x8E, 0x3C, 0x7F, 0x8E, 0x3C, 0x3F,
+    0x8E, 0x3C, 0x3F, 0x86, 0x3C, 0x7F, 0x80, 0x3C, 0x7F, 0xC0, 0x3C, 0x7F,
+    0xC0, 0x3C, 0x7F, 0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF, 0x9F, 0xFC, 0xFE, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x87, 0x1F, 0xF8, 0x8F, 0x1F, 0xFC, 0x0F, 0x1F, 0xFC, 0x8F, 0x1F, 0xFF,
+    0x87, 0xBF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF0, 0x70, 0x81, 0xFF,
+    0xE0, 0x20, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x30, 0xFF,
+    0x87, 0x0C, 0x38, 0xFF, 0x8F, 0x8C, 0x38, 0xFF, 0x8F, 0x8C, 0x38, 0xFF,
+    0x8F, 0x8C, 0x38, 0xFF, 0x87, 0x0C, 0x38, 0xFF, 0x80, 0x0C, 0x30, 0xFF,
+    0x80, 0x1C, 0x01, 0xFF, 0x80, 0x3C, 0x01, 0xFF, 0x80, 0x7C, 0x03, 0xFF,
+    0x8F, 0xFE, 0x07, 0xFF, 0x8F, 0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x8F, 0xFF, 0xF8, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xFF, 0x8F, 0xFC, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFC,
+    0xFF, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x69 'i'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF, 0x1F, 0xFC, 0x87, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x87, 0x00, 0x00,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x9F, 0xFF, 0xF1,
+    0xFF, 0x9F, 0xFF, 0xE1, 0xCF, 0x0F, 0xFF, 0x81, 0x87, 0x00, 0x00, 0x03,
+    0x83, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x1F,
+    0xCF, 0x00, 0x01, 0xFF,
+    // 0x6B 'k'
+    0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0xFF, 0x8F, 0xFF, 0xF8, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF8, 0xFF, 0xFF, 0xFC, 0x7C, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x30, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0x03, 0x01, 0xFF, 0xFF, 0x07, 0x80, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF,
+    0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0xBF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xCF, 0xFF, 0xFE, 0xCF, 0xFF, 0xFC, 0x8F, 0xFF, 0xF8, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0x8F, 0xFE, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x7F,
+    0xC7, 0xFE, 0x7F, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFE, 0x7F,
+    0x83, 0xFE, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC7, 0xFE, 0x7F, 0x87, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x87, 0xFE, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0x8F, 0xFE, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x7F,
+    0xC7, 0xFE, 0x7F, 0xC7, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFE, 0x7F,
+    0x87, 0xFE, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x7F,
+    // 0x6F 'o'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x83, 0xF0, 0x7F, 0x8F, 0xFC, 0x7F, 0x8F, 0xFC, 0x3F,
+    0x8F, 0xFC, 0x7F, 0x87, 0xFC, 0x7F, 0x83, 0xF8, 0x7F, 0x80, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x70 'p'
+    0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x87, 0xFF, 0xF8, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0xC7, 0xFC, 0x78, 0x87, 0xFC, 0x3C, 0x87, 0xFC, 0x7F, 0x87, 0xFC, 0x7F,
+    0x81, 0xF0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
+    0xE0, 0x03, 0xFF, 0xFC, 0x1F, 0xFF,
+    // 0x71 'q'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x83, 0xF0, 0x7F, 0x87, 0xF8, 0x7F, 0x8F, 0xFC, 0x7F,
+    0x8F, 0xFC, 0x7C, 0x8F, 0xF8, 0xF8, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFC,
+    // 0x72 'r'
+    0xEF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0x8F, 0xFE, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x7F,
+    0xC3, 0xFC, 0x7F, 0xC7, 0xFE, 0x7F, 0x87, 0xFE, 0x7F, 0x87, 0xFF, 0xFF,
+    0x83, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xF8, 0xFF, 0xF0, 0xF0, 0x7F, 0xC0, 0x60, 0x7F, 0xC0, 0x38, 0x7F,
+    0x80, 0x1C, 0x7F, 0x8C, 0x1E, 0x7F, 0x8C, 0x1E, 0x3F, 0x8E, 0x0E, 0x7F,
+    0x8E, 0x04, 0x7F, 0x87, 0x00, 0x7F, 0x81, 0x00, 0xFF, 0xC3, 0x80, 0xFF,
+    0xC7, 0xC3, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0x80, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0xF1, 0xFF, 0x07, 0xF1, 0xFF, 0x8F, 0xF1, 0xFF, 0x8F, 0xF1, 0xFF, 0x8F,
+    0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x75 'u'
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x7F,
+    0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0x9F, 0xF8, 0xFF, 0x9F, 0xF0, 0xFF,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x76 'v'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF,
+    0x1C, 0x00, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF,
+    0x3C, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x77 'w'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0x10, 0x00, 0xFF,
+    0x3F, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+    0xC0, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x07, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF,
+    0x1C, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFE, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0,
+    0x01, 0x80, 0x00, 0x04, 0x30, 0x1F, 0xF8, 0x1F, 0xF8, 0x0C, 0x20, 0x00,
+    0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC,
+    0xFF, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xE1, 0x0F, 0xFF, 0xE1, 0x03, 0xFF, 0xE1,
+    0x00, 0xFF, 0xE1, 0x00, 0x3F, 0xE1, 0x00, 0x07, 0xC3, 0x00, 0x01, 0x83,
+    0x1C, 0x00, 0x07, 0x3F, 0x80, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F,
+    0x3C, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x03, 0xC0, 0xFF,
+    0x0F, 0x80, 0xFF, 0x1E, 0x00, 0xFF, 0x1C, 0x00, 0xFF, 0x18, 0x08, 0xFF,
+    0x00, 0x38, 0xFF, 0x00, 0x78, 0xFF, 0x00, 0xF8, 0xFF, 0x03, 0xF0, 0xFF,
+    0x07, 0xC0, 0xFF, 0x0F, 0xC0, 0xFF, 0xDF, 0xC3, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x03, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xFF, 0xC7, 0x04, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xE7, 0x83, 0x83, 0x0F, 0x1F, 0x0F, 0x8F, 0x87, 0xC7, 0xC3, 0xC3, 0xC3,
+    0x07, 0x8F, 0xDF,
+    // 0xA1 '¡'
+    0xC7, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x86, 0x00, 0x00, 0x86, 0x00, 0x00,
+    0x86, 0x00, 0x01, 0xFF, 0xFC, 0x03,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+    0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x1F, 0x83, 0xFF,
+    0xFC, 0x7F, 0xC3, 0xFF, 0xFC, 0x7F, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x7F, 0xE3, 0xFF, 0xFC, 0x7F, 0xE3, 0xFF,
+    0xFC, 0x1F, 0xE3, 0xFF, 0xFC, 0x0F, 0xC3, 0xFF, 0xFE, 0x1F, 0xC7, 0xFF,
+    0xFF, 0x3F, 0xCF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xCF, 0xC3, 0xFF, 0xCF, 0xC3,
+    0xFF, 0xC8, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    0x80, 0x01, 0xC7, 0x80, 0xCF, 0xC7, 0x0F, 0xCF, 0xC7, 0x1F, 0xCF, 0xC7,
+    0x1F, 0xCF, 0xC7, 0x0F, 0xCF, 0xC7, 0x03, 0xDF, 0xC3, 0x81, 0xFF, 0x87,
+    0x83, 0xFF, 0x87, 0xC7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xFF, 0x8F, 0xF3, 0x84, 0x21, 0xC0, 0x03, 0xE0, 0x07, 0xE0, 0x07,
+    0xC3, 0xC3, 0xC7, 0xE3, 0xC7, 0xE3, 0xC7, 0xC3, 0xC3, 0x87, 0xE0, 0x07,
+    0xE0, 0x07, 0xC0, 0x03, 0x8F, 0xE1, 0xCF, 0xF3, 0xFF, 0xFF,
+    // 0xA5 '¥'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0x9F, 0xFF,
+    0x01, 0x89, 0xFF, 0x00, 0x09, 0xE7, 0x00, 0x09, 0xE7, 0x00, 0x09, 0xC7,
+    0x18, 0x00, 0x07, 0xBE, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x07,
+    0xBE, 0x00, 0x07, 0x18, 0x09, 0xC7, 0x00, 0x09, 0xC7, 0x00, 0x89, 0xE7,
+    0x03, 0x89, 0xFF, 0x0F, 0x9F, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFC, 0x1F, 0xE3, 0xF0, 0x07, 0xC1, 0xE0, 0x03, 0xC1, 0xC0, 0x61, 0xE0,
+    0x88, 0x30, 0xF0, 0x9E, 0x30, 0xF8, 0x1E, 0x18, 0x78, 0x1F, 0x1C, 0x78,
+    0x0F, 0x0C, 0x31, 0x87, 0x86, 0x01, 0x83, 0xC3, 0x03, 0x87, 0xC0, 0x07,
+    0xEF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x8F, 0xE7, 0xFF, 0xC7, 0xCF, 0x81, 0xE7, 0xCE, 0x00, 0xF3,
+    0x9E, 0x00, 0x73, 0x9C, 0x7C, 0x73, 0x9C, 0xFE, 0x39, 0x98, 0xFE, 0x39,
+    0x98, 0xFE, 0x39, 0x9C, 0x7E, 0x3B, 0x9C, 0x3E, 0x73, 0x9C, 0xFE, 0x73,
+    0xCF, 0xFF, 0xE3, 0xC7, 0xFF, 0xE7, 0xE3, 0xFF, 0xCF, 0xF1, 0xFF, 0x0F,
+    0xF8, 0x18, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0x7D, 0xCC, 0x19, 0x8C, 0x19, 0x88, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x80, 0x39, 0x80, 0x19, 0xC0, 0x19, 0xFF, 0x91, 0xFF, 0xBF,
+    // 0xAB '«'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x82, 0x1F,
+    0x87, 0x0F, 0x9F, 0x8F, 0xB9, 0xDF, 0xF0, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F,
+    0xC0, 0x1F, 0x86, 0x0F, 0x8F, 0x8F, 0x9F, 0xCF, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE7, 0xF1, 0xFF,
+    0xCF, 0xF9, 0xFF, 0x93, 0xE4, 0xFF, 0x90, 0x06, 0xFF, 0xB0, 0x06, 0xFF,
+    0xB3, 0x26, 0x7F, 0xB2, 0x1E, 0x7F, 0x98, 0x0E, 0xFF, 0x98, 0xE4, 0xFF,
+    0xDF, 0xE4, 0xFF, 0xCF, 0xF9, 0xFF, 0xE3, 0xE3, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFE, 0x3F, 0xFF,
+    // 0xB0 '°'
+    0xFB, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0x0E, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x0E, 0x1F, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    0xF8, 0xFE, 0x3F, 0xF8, 0x7E, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x02, 0x3F,
+    0x00, 0x02, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xC7, 0xE3, 0x83, 0xC3, 0x87, 0x83, 0x1F, 0x03, 0x1E, 0x03,
+    0x1C, 0x23, 0x00, 0x63, 0x80, 0xE3, 0x81, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xFF, 0xCF, 0xF3, 0x87, 0xF3, 0x9C, 0xF3, 0x1C, 0xE3, 0x18, 0xE3,
+    0x18, 0x43, 0x00, 0x03, 0x80, 0x07, 0x86, 0x0F, 0xFF, 0x1F,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x71, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xE0, 0x7F, 0xC0, 0x00, 0xFF,
+    0x80, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x8F, 0xF0, 0x3F,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
+    0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xFF, 0x87, 0x07, 0x07, 0x07, 0x8F, 0xFF,
+    // 0xB9 '¹'
+    0xCF, 0xF3, 0xCF, 0xF3, 0x8F, 0xE3, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x80, 0x03, 0xFF, 0xE3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xF0, 0xFF, 0xC0, 0x39, 0x80, 0x19, 0x84, 0x19, 0x9F, 0x99, 0x9F, 0x99,
+    0x9F, 0x99, 0x8F, 0x19, 0x80, 0x39, 0xC0, 0x33, 0xE0, 0xFF,
+    // 0xBB '»'
+    0xBF, 0xDF, 0x9F, 0x8F, 0x87, 0x0F, 0x82, 0x1F, 0xC0, 0x3F, 0xE0, 0x3F,
+    0xF0, 0x7F, 0xF8, 0xFF, 0x9F, 0xCF, 0x8F, 0x8F, 0x87, 0x0F, 0xC0, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF9, 0xFF,
+    // 0xBC '¼'
+    0xF3, 0xFC, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+    0xF0, 0x3F, 0x8F, 0xFF, 0xC0, 0xFF, 0x07, 0xFF, 0x83, 0xFE, 0x07, 0xFF,
+    0xC7, 0xF8, 0x47, 0xFF, 0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0xE1, 0xC7, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    // 0xBD '½'
+    0xF3, 0xFC, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF, 0xFF, 0xF8, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xC0, 0xF3, 0xFB, 0xFF, 0x81, 0xE1, 0xF1, 0xFF, 0xC7, 0xC1, 0xE1, 0xFF,
+    0xDF, 0xC1, 0xC1, 0xFF, 0xFF, 0xC7, 0x81, 0xFF, 0xFF, 0x8F, 0x01, 0xFF,
+    0xFF, 0x86, 0x11, 0xFF, 0xFF, 0xC0, 0x31, 0xFF, 0xFF, 0xC0, 0x71, 0xFF,
+    0xFF, 0xE0, 0xF1, 0xFF, 0xFF, 0xF3, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFC, 0xFF, 0xFF, 0xE1, 0xF8, 0xFF, 0xFF,
+    0xC7, 0x38, 0xFF, 0xFF, 0xC7, 0x38, 0xFF, 0xFF, 0xC6, 0x38, 0xFF, 0xFF,
+    0xC4, 0x30, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFE, 0xFF,
+    0xE1, 0x83, 0xF8, 0xFF, 0xFF, 0xC7, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0x8F, 0xFF, 0x80, 0xFF, 0x07, 0xFF,
+    0x83, 0xFE, 0x07, 0xFF, 0xCF, 0xF8, 0x47, 0xFF, 0xFF, 0xF0, 0xC7, 0xFF,
+    0xFF, 0xE1, 0xC7, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03,
+    0xFF, 0xC1, 0xC3, 0x87, 0xC3, 0xE1, 0x87, 0xC3, 0xE1, 0x86, 0x03, 0xE1,
+    0x86, 0x07, 0xE1, 0x87, 0x07, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF3,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0x80, 0x03, 0x87, 0xFE, 0x00, 0x63, 0x83, 0xF8, 0x00, 0xF3,
+    0xC3, 0xC0, 0x18, 0xFF, 0xE3, 0x80, 0xF8, 0xFF, 0xE1, 0x81, 0xF8, 0xFF,
+    0xF1, 0x80, 0x38, 0xFF, 0xF9, 0x80, 0x00, 0xF3, 0xFF, 0xC0, 0x00, 0x73,
+    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x63, 0xFB, 0xF8, 0x00, 0xF3,
+    0xF1, 0xC0, 0x18, 0xFF, 0xE1, 0x80, 0xF8, 0xFF, 0xE3, 0x81, 0xF8, 0xFF,
+    0xC3, 0x80, 0x38, 0xFF, 0x83, 0x80, 0x00, 0xF3, 0x87, 0xC0, 0x00, 0x73,
+    0xCF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
+    0xF3, 0xFF, 0x00, 0x07, 0xE3, 0xFC, 0x00, 0xC7, 0xC3, 0xF0, 0x01, 0xE7,
+    0x87, 0x80, 0x31, 0xFF, 0x0F, 0x01, 0xF1, 0xFF, 0x1F, 0x03, 0xF1, 0xFF,
+    0x0F, 0x00, 0x71, 0xFF, 0x87, 0x00, 0x01, 0xE7, 0xC3, 0x80, 0x00, 0xE7,
+    0xE3, 0xF0, 0x00, 0x07, 0xF7, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
+    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
+    0xC7, 0xFF, 0x00, 0x07, 0x87, 0xFC, 0x00, 0xC7, 0x87, 0xF0, 0x01, 0xE7,
+    0x8F, 0x80, 0x31, 0xFF, 0x8F, 0x01, 0xF1, 0xFF, 0xC7, 0x03, 0xF1, 0xFF,
+    0xC3, 0x00, 0x71, 0xFF, 0xC3, 0x00, 0x01, 0xE7, 0x87, 0x80, 0x00, 0xE7,
+    0x87, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
+    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xDF, 0xFF, 0xC0, 0x0F,
+    0x8F, 0xFE, 0x00, 0x0F, 0x07, 0xF8, 0x01, 0x8F, 0x07, 0xE0, 0x03, 0xCF,
+    0x8F, 0x00, 0x63, 0xFF, 0xFE, 0x03, 0xE3, 0xFF, 0xFE, 0x07, 0xE3, 0xFF,
+    0x8E, 0x00, 0xE3, 0xFF, 0x06, 0x00, 0x03, 0xCF, 0x07, 0x00, 0x01, 0xCF,
+    0x0F, 0xE0, 0x00, 0x0F, 0x8F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0x80, 0x03, 0xE3, 0xFE, 0x00, 0x63, 0x81, 0xF8, 0x00, 0xF3,
+    0x80, 0xC0, 0x18, 0xFF, 0x1C, 0x80, 0xF8, 0xFF, 0x1C, 0x81, 0xF8, 0xFF,
+    0x88, 0x80, 0x38, 0xFF, 0x81, 0x80, 0x00, 0xF3, 0xC3, 0xC0, 0x00, 0x73,
+    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x07,
+    0xFF, 0x80, 0xE7, 0x3E, 0x01, 0xE7, 0x18, 0x01, 0xFF, 0x00, 0x31, 0xFF,
+    0x00, 0xF1, 0xF7, 0x01, 0xF1, 0xE7, 0x07, 0xF1, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7,
+    0x0F, 0x8F, 0xC7, 0x07, 0x8F, 0x87, 0x03, 0x9E, 0x07, 0x03, 0xFC, 0x07,
+    0x8F, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+    0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x78, 0x03, 0xFF,
+    0x83, 0xFF, 0x03, 0xFF, 0x87, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0xC3, 0x33,
+    0x8F, 0xFF, 0xC2, 0x23, 0x8F, 0xFF, 0xC0, 0x03, 0x0F, 0xFF, 0xC1, 0x07,
+    0x8F, 0xFF, 0xC3, 0x0F, 0x83, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0xC3, 0xFF,
+    0x80, 0xFF, 0xC3, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x80, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x03, 0x87, 0x80, 0x00, 0x03,
+    0xC3, 0x80, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x03, 0xE3, 0x8F, 0xC7, 0xE3,
+    0xF1, 0x8F, 0xC7, 0xE3, 0xF1, 0x8F, 0xC7, 0xE3, 0xFB, 0x8F, 0xC7, 0xE3,
+    0xFF, 0x8F, 0xC7, 0xE3, 0xFF, 0x87, 0xC7, 0xC3, 0xFF, 0x81, 0xC7, 0x03,
+    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xF9, 0x80, 0x00, 0x03, 0xF1, 0x80, 0x00, 0x03, 0xE1, 0x8F, 0xC7, 0xE3,
+    0xE3, 0x8F, 0xC7, 0xE3, 0xC3, 0x8F, 0xC7, 0xE3, 0x83, 0x8F, 0xC7, 0xE3,
+    0x87, 0x8F, 0xC7, 0xE3, 0xFF, 0x87, 0xC7, 0xC3, 0xFF, 0x81, 0xC7, 0x03,
+    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07,
+    0xC7, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07, 0x1F, 0x1F, 0x8F, 0xC7,
+    0x1F, 0x1F, 0x8F, 0xC7, 0x0F, 0x1F, 0x8F, 0xC7, 0x87, 0x1F, 0x8F, 0xC7,
+    0xC3, 0x1F, 0x8F, 0xC7, 0xE3, 0x0F, 0x8F, 0x87, 0xFF, 0x03, 0x8E, 0x07,
+    0xFF, 0x01, 0xFC, 0x07, 0xFF, 0x03, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFE, 0x3F, 0xFF, 0xCF, 0xFE, 0x3F, 0xFF, 0xCF, 0xFE, 0x3F, 0xFF, 0x8F,
+    0x8E, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x0F,
+    0x0E, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0x1F, 0x8F,
+    0xFE, 0x3F, 0x1F, 0x8F, 0x8E, 0x3F, 0x1F, 0x8F, 0x06, 0x3F, 0x1F, 0x8F,
+    0x06, 0x3F, 0x1F, 0x8F, 0x8E, 0x1F, 0x1F, 0x0F, 0xFE, 0x07, 0x1C, 0x0F,
+    0xFE, 0x03, 0xF8, 0x0F, 0xFE, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0x8F, 0xFF, 0xF3, 0x87, 0x8F, 0xFF, 0xF3, 0x83, 0x8F, 0xFF, 0xE3,
+    0xC3, 0x80, 0x00, 0x03, 0xE3, 0x80, 0x00, 0x03, 0xE1, 0x80, 0x00, 0x03,
+    0xF1, 0x80, 0x00, 0x03, 0xF9, 0x80, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x9F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF7,
+    // 0xCD 'Í'
+    0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xF3, 0xFB, 0x8F, 0xFF, 0xE3,
+    0xF1, 0x80, 0x00, 0x03, 0xF1, 0x80, 0x00, 0x03, 0xE3, 0x80, 0x00, 0x03,
+    0xC3, 0x80, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x03, 0x87, 0x8F, 0xFF, 0xE3,
+    0xC7, 0x9F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF7,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xE7, 0xE3, 0x1F, 0xFF, 0xE7,
+    0xC3, 0x1F, 0xFF, 0xC7, 0x87, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07,
+    0x1F, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x07,
+    0xC3, 0x1F, 0xFF, 0xC7, 0xE3, 0x3F, 0xFF, 0xC7, 0xF7, 0xFF, 0xFF, 0xEF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x3F, 0xFF, 0xCF, 0x06, 0x3F, 0xFF, 0xCF,
+    0x06, 0x3F, 0xFF, 0x8F, 0x8E, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
+    0xFE, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x0F,
+    0x06, 0x3F, 0xFF, 0x8F, 0x0E, 0x7F, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF, 0xDF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0x8F, 0xC7, 0xF3, 0x8F, 0xC7, 0xF3, 0x8F, 0xC7, 0xE3,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3,
+    0x8F, 0xE7, 0xE3, 0x87, 0xFF, 0xC3, 0x87, 0xFF, 0xC7, 0x83, 0xFF, 0x87,
+    0xC0, 0xFE, 0x07, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
+    0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x07, 0xC7, 0x00, 0xFF, 0xC7, 0x87, 0x80, 0x7F, 0xC7,
+    0x8F, 0xC0, 0x1F, 0xE7, 0x8F, 0xF0, 0x0F, 0xFF, 0x87, 0xF8, 0x03, 0xFF,
+    0xC7, 0xFE, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0xFF, 0x87, 0xFF, 0x80, 0x3F,
+    0x87, 0x1F, 0xE0, 0x1F, 0xCF, 0x1F, 0xF0, 0x07, 0xFF, 0x1F, 0xF8, 0x03,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x38, 0x03,
+    0xC7, 0x83, 0xFF, 0x03, 0x87, 0x87, 0xFF, 0xC3, 0xC3, 0x8F, 0xFF, 0xE1,
+    0xC3, 0x8F, 0xFF, 0xE1, 0xE3, 0x8F, 0xFF, 0xE1, 0xF1, 0x8F, 0xFF, 0xE1,
+    0xF1, 0x8F, 0xFF, 0xE3, 0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0x83, 0xFF, 0x83,
+    0xFF, 0x80, 0xFF, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x38, 0x03,
+    0xFF, 0x83, 0xFF, 0x03, 0xFF, 0x87, 0xFF, 0xC3, 0xF9, 0x8F, 0xFF, 0xE1,
+    0xF1, 0x8F, 0xFF, 0xE1, 0xE1, 0x8F, 0xFF, 0xE1, 0xE3, 0x8F, 0xFF, 0xE1,
+    0xC3, 0x8F, 0xFF, 0xE3, 0x83, 0x87, 0xFF, 0xC3, 0x87, 0x83, 0xFF, 0x83,
+    0xFF, 0x80, 0xFF, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x70, 0x07,
+    0xF3, 0x07, 0xFE, 0x07, 0xE3, 0x0F, 0xFF, 0x87, 0x87, 0x1F, 0xFF, 0xC3,
+    0x0F, 0x1F, 0xFF, 0xC3, 0x1F, 0x1F, 0xFF, 0xC3, 0x1F, 0x1F, 0xFF, 0xC3,
+    0x0F, 0x1F, 0xFF, 0xC7, 0x87, 0x0F, 0xFF, 0x87, 0xC3, 0x07, 0xFF, 0x07,
+    0xE3, 0x01, 0xFE, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x70, 0x07,
+    0xC7, 0x07, 0xFE, 0x07, 0x87, 0x0F, 0xFF, 0x87, 0x8F, 0x1F, 0xFF, 0xC3,
+    0x8F, 0x1F, 0xFF, 0xC3, 0x87, 0x1F, 0xFF, 0xC3, 0xC7, 0x1F, 0xFF, 0xC3,
+    0xC3, 0x1F, 0xFF, 0xC7, 0x87, 0x0F, 0xFF, 0x87, 0x87, 0x07, 0xFF, 0x07,
+    0xCF, 0x01, 0xFE, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0x8F, 0x00, 0xE0, 0x0F,
+    0x06, 0x0F, 0xFC, 0x0F, 0x06, 0x1F, 0xFF, 0x0F, 0x0E, 0x3F, 0xFF, 0x87,
+    0x8E, 0x3F, 0xFF, 0x87, 0xFE, 0x3F, 0xFF, 0x87, 0xFE, 0x3F, 0xFF, 0x87,
+    0x8E, 0x3F, 0xFF, 0x8F, 0x06, 0x1F, 0xFF, 0x0F, 0x06, 0x0F, 0xFE, 0x0F,
+    0x8E, 0x03, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xDF, 0xDF, 0x8F, 0x8F, 0x87, 0x07, 0xC2, 0x0F, 0xE0, 0x1F, 0xF0, 0x3F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x83, 0x0F, 0x87, 0x87, 0xCF, 0xCF,
+    0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF3, 0xFC, 0x00, 0x23, 0xF8, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x30, 0x03, 0x83, 0xFC, 0x03,
+    0x87, 0xF8, 0xC3, 0x8F, 0xF1, 0xE1, 0x8F, 0xE3, 0xE1, 0x8F, 0xC7, 0xE1,
+    0x0F, 0x8F, 0xE1, 0x8F, 0x1F, 0xE3, 0x86, 0x1F, 0xC3, 0x80, 0x3F, 0xC3,
+    0x80, 0x7F, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
+    0x80, 0x00, 0x3F, 0x8C, 0x00, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x03, 0x87, 0x8F, 0xFF, 0x83,
+    0x83, 0x8F, 0xFF, 0xC3, 0xC3, 0x9F, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xE1,
+    0xE1, 0xFF, 0xFF, 0xE1, 0xF1, 0xFF, 0xFF, 0xE1, 0xF9, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0x83,
+    0xFB, 0x8F, 0xFF, 0xC3, 0xF1, 0x9F, 0xFF, 0xE1, 0xE1, 0xFF, 0xFF, 0xE1,
+    0xE3, 0xFF, 0xFF, 0xE1, 0xC3, 0xFF, 0xFF, 0xE1, 0x83, 0x8F, 0xFF, 0xE3,
+    0x87, 0x8F, 0xFF, 0xC3, 0xCF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x07, 0xE3, 0x1F, 0xFF, 0x07,
+    0xC3, 0x1F, 0xFF, 0x87, 0x87, 0x3F, 0xFF, 0xC3, 0x0F, 0xFF, 0xFF, 0xC3,
+    0x1F, 0xFF, 0xFF, 0xC3, 0x0F, 0xFF, 0xFF, 0xC3, 0x87, 0x1F, 0xFF, 0xC7,
+    0xC3, 0x1F, 0xFF, 0x87, 0xE3, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F,
+    0xDE, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x0F, 0x06, 0x3F, 0xFE, 0x0F,
+    0x06, 0x3F, 0xFF, 0x0F, 0x8E, 0x7F, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0x87, 0x8F, 0xFF, 0xFF, 0x87, 0x06, 0x3F, 0xFF, 0x8F,
+    0x06, 0x3F, 0xFF, 0x0F, 0x0E, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0x3F, 0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x31, 0xFC, 0x67, 0x31, 0xFC, 0x67, 0xF1, 0xFC, 0x7F, 0xF0, 0xF8, 0x7F,
+    0xF0, 0x20, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x01, 0xFF,
+    0xFE, 0x03, 0xFF, 0xFF, 0x9F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xF1, 0xFF,
+    0x8F, 0xE3, 0xE0, 0xFF, 0x0F, 0xC1, 0xE0, 0xFF, 0x0F, 0x80, 0xF8, 0xFF,
+    0x0F, 0x00, 0x7C, 0x7F, 0x80, 0x10, 0x3C, 0xFF, 0x80, 0x38, 0x18, 0xFF,
+    0x80, 0x7C, 0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
+    0xFF, 0xFF, 0x87, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF1, 0xE0, 0x3F, 0xFF, 0xE0, 0xC0, 0x3F,
+    0xC7, 0xE0, 0xC0, 0x3F, 0x83, 0xC0, 0x80, 0x1F, 0x83, 0xC7, 0x8E, 0x3F,
+    0xE1, 0xC7, 0x8E, 0x3F, 0xF0, 0xC7, 0x8E, 0x3F, 0xF9, 0xC3, 0x8E, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x7F,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF1, 0xE0, 0x3F, 0xFF, 0xE0, 0xC0, 0x3F,
+    0xFF, 0xE0, 0xC0, 0x3F, 0xFF, 0xC0, 0x80, 0x1F, 0xFD, 0xC7, 0x8E, 0x3F,
+    0xF0, 0xC7, 0x8E, 0x3F, 0xC1, 0xC7, 0x8E, 0x3F, 0x83, 0xC3, 0x8E, 0x7F,
+    0x87, 0xC0, 0x00, 0x7F, 0xCF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x7F,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0xC0, 0x7F, 0xFF, 0xC1, 0x80, 0x7F,
+    0xF9, 0xC1, 0x80, 0x7F, 0xE1, 0x81, 0x00, 0x3F, 0x83, 0x8F, 0x1C, 0x7F,
+    0x87, 0x8F, 0x1C, 0x7F, 0x8F, 0x8F, 0x1C, 0x7F, 0x87, 0x87, 0x1C, 0xFF,
+    0xC3, 0x80, 0x00, 0xFF, 0xE1, 0x80, 0x00, 0x7F, 0xF1, 0xC0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFC, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC7, 0x80, 0xFF, 0xCF, 0x83, 0x00, 0xFF,
+    0x87, 0x83, 0x00, 0xFF, 0x0F, 0x02, 0x00, 0x7F, 0x1F, 0x1E, 0x38, 0xFF,
+    0x8F, 0x1E, 0x38, 0xFF, 0x87, 0x1E, 0x38, 0xFF, 0xC7, 0x0E, 0x39, 0xFF,
+    0xC7, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0x87, 0xFF, 0x8F, 0x01, 0x8F, 0x06, 0x01, 0x0F, 0x06, 0x01,
+    0x0E, 0x04, 0x00, 0x0E, 0x3C, 0x71, 0xFE, 0x3C, 0x71, 0xFE, 0x3C, 0x71,
+    0x8E, 0x1C, 0x73, 0x0E, 0x00, 0x03, 0x0E, 0x00, 0x01, 0x0F, 0x00, 0x01,
+    0x9F, 0x80, 0x01, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF1, 0xE0, 0x3F, 0xFF, 0xE0, 0xC0, 0x3F,
+    0xE1, 0xE0, 0xC0, 0x3F, 0xC0, 0xC0, 0x80, 0x1F, 0x80, 0xC7, 0x8E, 0x3F,
+    0x9C, 0x47, 0x8E, 0x3F, 0x9E, 0x47, 0x8E, 0x3F, 0x8C, 0xC3, 0x8E, 0x7F,
+    0xC0, 0xC0, 0x00, 0x7F, 0xC1, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFE, 0x7F,
+    // 0xE6 'æ'
+    0xFF, 0xE1, 0xFF, 0xE3, 0xC0, 0xFF, 0xC1, 0x80, 0x7F, 0xC1, 0x80, 0x7F,
+    0x81, 0x80, 0x3F, 0x8F, 0x1C, 0x3F, 0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F,
+    0x87, 0x1C, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+    0xC0, 0x00, 0x7F, 0xC2, 0x30, 0x7F, 0x8E, 0x38, 0x7F, 0x8E, 0x3C, 0x7F,
+    0x8E, 0x3C, 0x3F, 0x8E, 0x3C, 0x7F, 0x80, 0x3C, 0x7F, 0x80, 0x7C, 0x7F,
+    0xC0, 0x7C, 0x7F, 0xE0, 0x78, 0xFF, 0xF0, 0x7F, 0xFF,
+    // 0xE7 'ç'
+    0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x83, 0xF0, 0x6F, 0x7F,
+    0x8F, 0xF8, 0x46, 0x7F, 0x8F, 0xFC, 0x00, 0x7F, 0x8F, 0xFC, 0x00, 0xFF,
+    0x81, 0xFC, 0x61, 0xFF, 0x81, 0xFC, 0x73, 0xFF, 0xC1, 0xFC, 0x7F, 0xFF,
+    0xC1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xEF, 0xE0, 0x00, 0x3F, 0x87, 0xE0, 0x00, 0x3F, 0x83, 0xC3, 0x1C, 0x3F,
+    0xC1, 0xC7, 0x1E, 0x3F, 0xE1, 0xC7, 0x1E, 0x1F, 0xF8, 0xC7, 0x1E, 0x1F,
+    0xFF, 0xC3, 0x1E, 0x3F, 0xFF, 0xC0, 0x1E, 0x3F, 0xFF, 0xE0, 0x1E, 0x3F,
+    0xFF, 0xE0, 0x1E, 0x3F, 0xFF, 0xF8, 0x1C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC3, 0x1C, 0x3F,
+    0xF9, 0xC7, 0x1E, 0x3F, 0xE0, 0xC7, 0x1E, 0x1F, 0x81, 0xC7, 0x1E, 0x1F,
+    0x83, 0xC3, 0x1E, 0x3F, 0xC7, 0xC0, 0x1E, 0x3F, 0xFF, 0xE0, 0x1E, 0x3F,
+    0xFF, 0xE0, 0x1E, 0x3F, 0xFF, 0xF8, 0x1C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xF9, 0xC0, 0x00, 0x7F, 0xF1, 0xC0, 0x00, 0x7F, 0xC1, 0x86, 0x38, 0x7F,
+    0x83, 0x8E, 0x3C, 0x7F, 0x8F, 0x8E, 0x3C, 0x3F, 0x8F, 0x8E, 0x3C, 0x3F,
+    0x83, 0x86, 0x3C, 0x7F, 0xC1, 0x80, 0x3C, 0x7F, 0xF1, 0xC0, 0x3C, 0x7F,
+    0xFB, 0xC0, 0x3C, 0x7F, 0xFF, 0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0x8F, 0x80, 0x03, 0x0F, 0x00, 0x01,
+    0x0F, 0x00, 0x01, 0x0E, 0x18, 0xE1, 0x9E, 0x38, 0xF1, 0xFE, 0x38, 0xF0,
+    0xDE, 0x38, 0xF0, 0x0E, 0x18, 0xF1, 0x0E, 0x00, 0xF1, 0x0F, 0x00, 0xF1,
+    0x8F, 0x00, 0xF1, 0xFF, 0xC0, 0xE3, 0xFF, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE7, 0xFF, 0x3F, 0x87, 0xC7, 0xFF, 0x3F,
+    0x83, 0xC0, 0x00, 0x3F, 0xC1, 0xC0, 0x00, 0x3F, 0xF1, 0xC0, 0x00, 0x3F,
+    0xF8, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xC7, 0xFF, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xF1, 0xC0, 0x00, 0x3F, 0xE0, 0xC0, 0x00, 0x3F,
+    0x81, 0xC0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F, 0xC7, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xCF, 0xFE, 0x7F, 0xE1, 0x8F, 0xFE, 0x7F,
+    0xC3, 0x80, 0x00, 0x7F, 0x87, 0x80, 0x00, 0x7F, 0x8F, 0x80, 0x00, 0x7F,
+    0x87, 0x80, 0x00, 0x7F, 0x83, 0x80, 0x00, 0x7F, 0xC1, 0xFF, 0xFC, 0x7F,
+    0xF1, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0x8F, 0xFF, 0xFF, 0x0F, 0x3F, 0xF9, 0x0E, 0x3F, 0xF9, 0x0E, 0x00, 0x01,
+    0x9E, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x9E, 0x00, 0x01, 0x0E, 0x00, 0x01,
+    0x0F, 0xFF, 0xF1, 0x0F, 0xFF, 0xF9, 0x9F, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xED, 0xC0, 0x00, 0x7F, 0xC1, 0x83, 0xF0, 0x7F,
+    0x81, 0x8F, 0xFC, 0x7F, 0xC3, 0x8F, 0xFC, 0x3F, 0xC1, 0x8F, 0xFC, 0x7F,
+    0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xF8, 0x7F, 0x98, 0x00, 0x00, 0x7F,
+    0xDC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x0F, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x1F, 0x8F, 0xFC, 0x8F, 0x8F, 0xFD, 0x87, 0x0F, 0xFF, 0xC7, 0x0F, 0xFC,
+    0xC7, 0x0F, 0xFC, 0x87, 0x00, 0x00, 0x8F, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    // 0xF2 'ò'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xC7, 0xE0, 0x00, 0x3F, 0x83, 0xC1, 0xF8, 0x3F,
+    0xC3, 0xC7, 0xFE, 0x3F, 0xE1, 0xC7, 0xFE, 0x1F, 0xF0, 0xC7, 0xFE, 0x3F,
+    0xF9, 0xC3, 0xFE, 0x3F, 0xFF, 0xC1, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC1, 0xF8, 0x3F,
+    0xFD, 0xC7, 0xFE, 0x3F, 0xF0, 0xC7, 0xFE, 0x1F, 0xC1, 0xC7, 0xFE, 0x3F,
+    0x83, 0xC3, 0xFE, 0x3F, 0x87, 0xC1, 0xFC, 0x3F, 0xCF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFD, 0xC0, 0x00, 0x7F, 0xF1, 0xC0, 0x00, 0x7F, 0xE1, 0x83, 0xF0, 0x7F,
+    0x83, 0x8F, 0xFC, 0x7F, 0x87, 0x8F, 0xFC, 0x3F, 0x8F, 0x8F, 0xFC, 0x7F,
+    0x87, 0x87, 0xFC, 0x7F, 0xC3, 0x83, 0xF8, 0x7F, 0xE1, 0x80, 0x00, 0x7F,
+    0xF1, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xC7, 0x80, 0x00, 0xFF, 0x87, 0x80, 0x00, 0xFF, 0x0F, 0x07, 0xE0, 0xFF,
+    0x1F, 0x1F, 0xF8, 0xFF, 0x8F, 0x1F, 0xF8, 0x7F, 0x87, 0x1F, 0xF8, 0xFF,
+    0xC7, 0x0F, 0xF8, 0xFF, 0xC7, 0x07, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0xFF,
+    0x8F, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
+    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0x0F, 0x00, 0x01,
+    0x0F, 0x00, 0x01, 0x0E, 0x0F, 0xC1, 0x8E, 0x3F, 0xF1, 0xFE, 0x3F, 0xF0,
+    0xFE, 0x3F, 0xF1, 0x8E, 0x1F, 0xF1, 0x0E, 0x0F, 0xE1, 0x0E, 0x00, 0x01,
+    0x0F, 0x00, 0x03, 0xDF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x98, 0xE7,
+    0x08, 0xC3, 0x08, 0xC3, 0x08, 0xC3, 0x98, 0xEF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x06, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
+    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x87, 0xC0, 0x7F, 0x8F, 0x8C, 0x7F,
+    0x8F, 0x1C, 0x3F, 0x8E, 0x3C, 0x7F, 0x8C, 0x7C, 0x7F, 0x80, 0xF8, 0x7F,
+    0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF,
+    0x88, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x3F,
+    0xC7, 0xC0, 0x00, 0x3F, 0x83, 0xEF, 0xF8, 0x1F, 0xC1, 0xFF, 0xFE, 0x1F,
+    0xE1, 0xFF, 0xFE, 0x3F, 0xF8, 0xE7, 0xFE, 0x3F, 0xFD, 0xE7, 0xFC, 0x3F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xFA 'ú'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xEF, 0xF8, 0x1F, 0xF9, 0xFF, 0xFE, 0x1F,
+    0xE0, 0xFF, 0xFE, 0x3F, 0xC1, 0xE7, 0xFE, 0x3F, 0x83, 0xE7, 0xFC, 0x3F,
+    0xC7, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0xFB 'û'
+    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xF9, 0x80, 0x00, 0x7F,
+    0xF1, 0x80, 0x00, 0x7F, 0xC1, 0xDF, 0xF0, 0x3F, 0x83, 0xFF, 0xFC, 0x3F,
+    0x8F, 0xFF, 0xFC, 0x7F, 0x8F, 0xCF, 0xFC, 0x7F, 0x87, 0xCF, 0xF8, 0x7F,
+    0xC1, 0x80, 0x00, 0xFF, 0xE1, 0x80, 0x00, 0x7F, 0xFB, 0x80, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    // 0xFC 'ü'
+    0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x00, 0x03,
+    0x9E, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x0F, 0x7F, 0xC0,
+    0x9F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F, 0xF1, 0x0F, 0x3F, 0xE1,
+    0x0E, 0x00, 0x03, 0x0E, 0x00, 0x01, 0x8E, 0x00, 0x01, 0xFE, 0x00, 0x01,
+    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9,
+    // 0xFE 'þ'
+    0xCF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF9, 0x8F, 0xFF, 0xFF, 0xF1,
+    0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 0xF1,
+    0xFF, 0x0F, 0xF8, 0x79, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF,
+    0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x3F, 0xFF, 0xC3, 0xFE, 0x1F, 0xFF, 0xC3,
+    0xFE, 0x07, 0xFF, 0xC3, 0x8E, 0x01, 0xFF, 0xC3, 0x0E, 0x00, 0x7F, 0xC3,
+    0x0E, 0x00, 0x0F, 0x87, 0x0E, 0x00, 0x03, 0x07, 0xFE, 0x38, 0x00, 0x0F,
+    0xFE, 0x7F, 0x00, 0x1F, 0x9F, 0xFF, 0xC0, 0x3F, 0x0F, 0xFF, 0x00, 0xFF,
+    0x0E, 0x78, 0x03, 0xFF, 0x0E, 0x00, 0x0F, 0xFF, 0x9E, 0x00, 0x7F, 0xFF,
+    0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x63, 0xFF, 0xF8, 0x00, 0xF3, 0xFF,
+    0xC0, 0x18, 0xFF, 0xFF, 0x80, 0xF8, 0xFF, 0xFF, 0x81, 0xF8, 0xFF, 0xFF,
+    0x80, 0x38, 0xFF, 0xFF, 0x80, 0x00, 0xF3, 0xFF, 0xC0, 0x00, 0x73, 0x1F,
+    0xF8, 0x00, 0x02, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07,
+    0xFF, 0xF8, 0x01, 0xC7, 0xFF, 0xFF, 0x01, 0xCF, 0xFF, 0xFF, 0xC3, 0xCF,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xE1, 0xFF, 0xE3, 0xC0, 0x7F, 0xC1, 0x80, 0x7F, 0xC1, 0x80, 0x7F,
+    0x81, 0x00, 0x3F, 0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F,
+    0x87, 0x1C, 0xFF, 0x80, 0x00, 0xE3, 0x80, 0x00, 0x41, 0xC0, 0x00, 0x01,
+    0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x39, 0xFF, 0xFC, 0x79, 0xFF, 0xFC, 0xF9,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x78, 0x03,
+    0xFF, 0x83, 0xFF, 0x03, 0xFF, 0x87, 0xFF, 0x83, 0xF1, 0x8F, 0xFF, 0xC3,
+    0xF1, 0x8F, 0xFF, 0xC3, 0xE3, 0x8F, 0xFF, 0xC1, 0xC3, 0x0F, 0xFF, 0xC1,
+    0xC3, 0x8F, 0xFF, 0xC3, 0x87, 0x83, 0xFF, 0xC3, 0xC7, 0x80, 0xFF, 0xC3,
+    0xFF, 0x80, 0xFF, 0xC3, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF,
+    // 0x107 'ć'
+    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC1, 0xF8, 0x3F,
+    0xF9, 0xC7, 0xFC, 0x3F, 0xE0, 0xC7, 0xFE, 0x1F, 0x81, 0xC7, 0xFE, 0x1F,
+    0x83, 0xC0, 0xFE, 0x3F, 0xC7, 0xC0, 0xFE, 0x3F, 0xFF, 0xE0, 0xFE, 0x3F,
+    0xFF, 0xE0, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0x1F, 0x80, 0xF0, 0x07,
+    0x0F, 0x07, 0xFE, 0x07, 0x87, 0x0F, 0xFF, 0x07, 0xC3, 0x1F, 0xFF, 0x87,
+    0xE3, 0x1F, 0xFF, 0x87, 0xE3, 0x1F, 0xFF, 0x83, 0xC2, 0x1F, 0xFF, 0x83,
+    0x87, 0x1F, 0xFF, 0x87, 0x0F, 0x07, 0xFF, 0x87, 0x1F, 0x01, 0xFF, 0x87,
+    0xBF, 0x01, 0xFF, 0x87, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F,
+    // 0x10D 'č'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 0xFF,
+    0x8F, 0xC0, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x7F, 0xC3, 0x83, 0xF0, 0x7F,
+    0xE1, 0x8F, 0xF8, 0x7F, 0xE1, 0x8F, 0xFC, 0x3F, 0xC1, 0x8F, 0xFC, 0x3F,
+    0x83, 0x81, 0xFC, 0x7F, 0x0F, 0x81, 0xFC, 0x7F, 0x1F, 0xC1, 0xFC, 0x7F,
+    0xFF, 0xC1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07,
+    0x87, 0x00, 0x00, 0x07, 0xC3, 0x00, 0x00, 0x07, 0xE3, 0x1F, 0xFF, 0xC7,
+    0xE3, 0x1F, 0xFF, 0xC7, 0xC3, 0x1F, 0xFF, 0xC7, 0x87, 0x1F, 0xFF, 0xC7,
+    0x0F, 0x0F, 0xFF, 0x87, 0x1F, 0x0F, 0xFF, 0x8F, 0x3F, 0x07, 0xFF, 0x0F,
+    0xFF, 0x81, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x07, 0xE0, 0x7F,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xCF, 0x1F, 0xF8, 0xFF,
+    0x8F, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0xFF, 0xFC, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x1F, 0x8F, 0xC7, 0xFF,
+    0x1F, 0x8F, 0xC6, 0x3F, 0x1F, 0x8F, 0xC4, 0x1F, 0x1F, 0x8F, 0xC0, 0x1F,
+    0x1F, 0x8F, 0xC0, 0x0F, 0x0F, 0x8F, 0x83, 0x8F, 0x03, 0x8E, 0x07, 0x9F,
+    0x01, 0xFC, 0x07, 0x9F, 0x03, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x86, 0x38, 0x7F, 0x8E, 0x3C, 0x7F, 0x8E, 0x3C, 0x23,
+    0x8E, 0x3C, 0x01, 0x86, 0x3C, 0x01, 0x80, 0x3C, 0x01, 0xC0, 0x3C, 0x39,
+    0xC0, 0x3C, 0x79, 0xF0, 0x38, 0xF9, 0xFF, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xBF, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07,
+    0xC7, 0x00, 0x00, 0x07, 0xC3, 0x00, 0x00, 0x07, 0xE3, 0x1F, 0x8F, 0xC7,
+    0xC3, 0x1F, 0x8F, 0xC7, 0x87, 0x1F, 0x8F, 0xC7, 0x0F, 0x1F, 0x8F, 0xC7,
+    0x1F, 0x1F, 0x8F, 0xC7, 0x3F, 0x0F, 0x8F, 0x87, 0xFF, 0x03, 0x8E, 0x07,
+    0xFF, 0x01, 0xFC, 0x07, 0xFF, 0x03, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
+    0x8F, 0xC0, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x7F, 0x83, 0x86, 0x38, 0x7F,
+    0xE1, 0x8E, 0x3C, 0x7F, 0xF1, 0x8E, 0x3C, 0x3F, 0xC1, 0x8E, 0x3C, 0x3F,
+    0x83, 0x86, 0x3C, 0x7F, 0x0F, 0x80, 0x3C, 0x7F, 0x1F, 0xC0, 0x3C, 0x7F,
+    0xFF, 0xC0, 0x3C, 0x7F, 0xFF, 0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xF3, 0xFB, 0x8F, 0xFF, 0xE3,
+    0xF1, 0x80, 0x00, 0x03, 0xF1, 0x80, 0x00, 0x03, 0xE3, 0x80, 0x00, 0x03,
+    0xC3, 0x80, 0x00, 0x03, 0x83, 0x80, 0x00, 0x03, 0x87, 0x8F, 0xFF, 0xE3,
+    0xC7, 0x9F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0x9F, 0xFF, 0xFD, 0xFF, 0x9F, 0xFF, 0xF9, 0xE3, 0x1F, 0xFF, 0xF1,
+    0xE3, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x0F, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xF9,
+    // 0x13D 'Ľ'
+    0xE3, 0xFF, 0xFC, 0xE3, 0xFF, 0xFC, 0xE3, 0xFF, 0xF8, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xE3, 0xFF, 0xF8, 0xE7, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
+    0xC0, 0xFF, 0xF8, 0x80, 0xFF, 0xF0, 0x83, 0xFF, 0xC0, 0xCF, 0xFF, 0x80,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xCF, 0xFF, 0xFE, 0xCF, 0xFF, 0xFC, 0x8F, 0xFF, 0xF8, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x80, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x1F, 0xE3, 0xE7, 0x1F, 0xE7, 0xE7,
+    0x1F, 0xC7, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x3F, 0xC7, 0x3E, 0x3F, 0xC7,
+    0xFE, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFE, 0xCF, 0xFC, 0xFC, 0x8F, 0xF8, 0xF8,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0xFF, 0x9F, 0xFC, 0xFF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xF3, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE3, 0xFF, 0xC0, 0x3F, 0xE3,
+    0xF9, 0xE0, 0x0F, 0xF3, 0xF1, 0xF8, 0x07, 0xFF, 0xE1, 0xFC, 0x01, 0xFF,
+    0xE3, 0xFF, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xC0, 0x1F,
+    0x87, 0x8F, 0xF0, 0x0F, 0xFF, 0x8F, 0xF8, 0x03, 0xFF, 0x8F, 0xFC, 0x01,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xC7, 0xFF, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0x3F,
+    0xF1, 0xE3, 0xFF, 0x7F, 0xE0, 0xC3, 0xFF, 0xFF, 0x81, 0xC3, 0xFF, 0x3F,
+    0x83, 0xC3, 0xFF, 0x3F, 0xC7, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xBF, 0x00, 0x00, 0x07, 0x0F, 0x00, 0xFF, 0xC7, 0x07, 0x80, 0x7F, 0xC7,
+    0xC7, 0xC0, 0x1F, 0xE7, 0xC3, 0xF0, 0x0F, 0xFF, 0xE3, 0xF8, 0x03, 0xFF,
+    0xC3, 0xFE, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0xFF, 0x0F, 0xFF, 0x80, 0x3F,
+    0x1F, 0x1F, 0xE0, 0x1F, 0x3F, 0x1F, 0xF0, 0x07, 0xFF, 0x1F, 0xF8, 0x03,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFE, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x9F, 0x80, 0x00, 0x7F,
+    0x8F, 0x80, 0x00, 0x7F, 0x87, 0xE0, 0x00, 0x7F, 0xC3, 0xC7, 0xFE, 0x7F,
+    0xE1, 0xC7, 0xFE, 0xFF, 0xE1, 0x87, 0xFF, 0xFF, 0xC1, 0x87, 0xFE, 0x7F,
+    0x87, 0x87, 0xFE, 0x7F, 0x0F, 0x80, 0x00, 0x7F, 0x9F, 0x80, 0x00, 0x7F,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    // 0x152 'Œ'
+    0xFF, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+    0xC0, 0x00, 0x0F, 0x80, 0xFC, 0x0F, 0x83, 0xFF, 0x07, 0x87, 0xFF, 0x87,
+    0x0F, 0xFF, 0x87, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xC7,
+    0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x0F, 0x8F, 0xC7,
+    0x03, 0x8F, 0x87, 0x03, 0x9E, 0x07, 0x03, 0xFC, 0x07, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x83, 0xF0, 0x7F, 0x8F, 0xFC, 0x7F, 0x8F, 0xFC, 0x3F,
+    0x8F, 0xFC, 0x7F, 0x87, 0xFC, 0x7F, 0x83, 0xF8, 0x7F, 0x80, 0x00, 0x7F,
+    0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0x86, 0x38, 0x7F, 0x8E, 0x3C, 0x7F, 0x8E, 0x3C, 0x3F, 0x8E, 0x3C, 0x3F,
+    0x86, 0x3C, 0x7F, 0x80, 0x3C, 0x7F, 0xC0, 0x3C, 0x7F, 0xC0, 0x3C, 0x7F,
+    0xF0, 0x38, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0x1F, 0xFF, 0xC7,
+    0x1F, 0x00, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x07,
+    0xC3, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07, 0xE3, 0x1F, 0xC7, 0xC7,
+    0xC3, 0x1F, 0xC1, 0xE7, 0x87, 0x1F, 0x80, 0xFF, 0x0F, 0x0F, 0x80, 0x7F,
+    0x1F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x18, 0x0F, 0xFF, 0x80, 0x1C, 0x0F,
+    0xFF, 0xC0, 0x3E, 0x07, 0xFF, 0xE0, 0x7F, 0x07, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xEF,
+    // 0x159 'ř'
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFE, 0x7F,
+    0x9F, 0x80, 0x00, 0x7F, 0x0F, 0x80, 0x00, 0x7F, 0x87, 0x80, 0x00, 0x7F,
+    0xC3, 0x80, 0x00, 0x7F, 0xE1, 0xE0, 0x00, 0x7F, 0xE1, 0xC3, 0xFC, 0x7F,
+    0xC3, 0xC7, 0xFE, 0x7F, 0x87, 0x87, 0xFE, 0x7F, 0x1F, 0x87, 0xFF, 0xFF,
+    0xBF, 0x83, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xE0, 0x1E, 0x03,
+    0xFF, 0xC0, 0x0E, 0x03, 0xFF, 0x80, 0x07, 0xC3, 0xF9, 0x80, 0x07, 0xE1,
+    0xF1, 0x8F, 0x03, 0xE1, 0xE1, 0x8F, 0x83, 0xE1, 0xE3, 0x0F, 0x81, 0xE1,
+    0xC3, 0x8F, 0xC1, 0xE3, 0x83, 0x8F, 0xC0, 0x03, 0x87, 0x81, 0xE0, 0x03,
+    0xEF, 0x80, 0xE0, 0x07, 0xFF, 0x81, 0xF0, 0x0F, 0xFF, 0xC7, 0xF8, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x78, 0x3F, 0xFF, 0xE0, 0x30, 0x3F,
+    0xFF, 0xE0, 0x1C, 0x3F, 0xFF, 0xC0, 0x0E, 0x3F, 0xF9, 0xC6, 0x0F, 0x3F,
+    0xE0, 0xC6, 0x0F, 0x1F, 0xC1, 0xC7, 0x07, 0x3F, 0x83, 0xC7, 0x02, 0x3F,
+    0xC7, 0xC3, 0x80, 0x3F, 0xFF, 0xC0, 0x80, 0x7F, 0xFF, 0xE1, 0xC0, 0x7F,
+    0xFF, 0xE3, 0xE1, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x7C, 0x07, 0xBF, 0xC0, 0x3C, 0x07,
+    0x1F, 0x80, 0x1C, 0x07, 0x0F, 0x00, 0x0F, 0x87, 0x87, 0x00, 0x0F, 0xC3,
+    0xC3, 0x1E, 0x07, 0xC3, 0xE3, 0x1F, 0x07, 0xC3, 0xE2, 0x1F, 0x03, 0xC3,
+    0xC3, 0x1F, 0x83, 0xC7, 0x87, 0x1F, 0x80, 0x07, 0x1F, 0x03, 0xC0, 0x07,
+    0x3F, 0x01, 0xC0, 0x0F, 0xFF, 0x03, 0xE0, 0x1F, 0xFF, 0x8F, 0xF0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0x7F, 0x8F, 0xC0, 0x60, 0x7F,
+    0x07, 0xC0, 0x38, 0x7F, 0x83, 0x80, 0x1C, 0x7F, 0xE1, 0x8C, 0x1E, 0x7F,
+    0xF1, 0x8C, 0x1E, 0x3F, 0xC1, 0x8E, 0x0E, 0x7F, 0x83, 0x8E, 0x04, 0x7F,
+    0x0F, 0x87, 0x00, 0x7F, 0x1F, 0x81, 0x00, 0xFF, 0xBF, 0xC3, 0x80, 0xFF,
+    0xFF, 0xC7, 0xC3, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xBF, 0x1F, 0xFF, 0xE7,
+    0x0F, 0x1F, 0xFF, 0xE7, 0x87, 0x1F, 0xFF, 0xC7, 0xC3, 0x00, 0x00, 0x07,
+    0xE3, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07, 0xC3, 0x00, 0x00, 0x07,
+    0x87, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0xFF, 0xC7, 0x1F, 0x1F, 0xFF, 0xC7,
+    0x3F, 0x1F, 0xFF, 0xE7, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x1F, 0xF0, 0x7F,
+    0xFF, 0x1F, 0xF8, 0xFF, 0x01, 0x1F, 0xF8, 0xFF, 0x01, 0x1F, 0xF8, 0xFF,
+    0x07, 0x9F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xE3, 0x8F, 0xFF, 0x83,
+    0x81, 0x8F, 0xFF, 0xC3, 0x80, 0x9F, 0xFF, 0xE1, 0x1C, 0xFF, 0xFF, 0xE1,
+    0x1C, 0xFF, 0xFF, 0xE1, 0x80, 0xFF, 0xFF, 0xE1, 0x81, 0x8F, 0xFF, 0xE3,
+    0xC3, 0x8F, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xE1, 0xC0, 0x00, 0x3F, 0xC0, 0xEF, 0xF8, 0x1F, 0x8C, 0xFF, 0xFE, 0x1F,
+    0x9E, 0x7F, 0xFE, 0x3F, 0x9C, 0x67, 0xFE, 0x3F, 0x80, 0xE7, 0xFC, 0x3F,
+    0xC1, 0xC0, 0x00, 0x7F, 0xE3, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x170 'Ű'
+    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xF1, 0x8F, 0xFF, 0x83,
+    0xE1, 0x8F, 0xFF, 0xC3, 0xC3, 0x9F, 0xFF, 0xE1, 0x87, 0xFF, 0xFF, 0xE1,
+    0x07, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF, 0xFF, 0xE1, 0xF9, 0x8F, 0xFF, 0xE3,
+    0xF1, 0x8F, 0xFF, 0xC3, 0xE3, 0x80, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x07,
+    0x07, 0x80, 0x00, 0x07, 0x8F, 0x80, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x7F,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xF9, 0xC0, 0x00, 0x3F, 0xE0, 0xEF, 0xF8, 0x1F, 0x81, 0xFF, 0xFE, 0x1F,
+    0x83, 0xFF, 0xFE, 0x3F, 0xCF, 0xE7, 0xFE, 0x3F, 0xF9, 0xE7, 0xFC, 0x3F,
+    0xE0, 0xC0, 0x00, 0x7F, 0x81, 0xC0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F,
+    0xCF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x178 'Ÿ'
+    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x8E, 0x01, 0xFF, 0xEF,
+    0x06, 0x00, 0x7F, 0xCF, 0x06, 0x00, 0x3F, 0x8F, 0x0E, 0x20, 0x00, 0x0F,
+    0x8E, 0x78, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xDF, 0xFF, 0x80, 0x0F,
+    0x8F, 0xFE, 0x00, 0x0F, 0x06, 0x38, 0x1F, 0x8F, 0x06, 0x20, 0x3F, 0x8F,
+    0x8E, 0x00, 0xFF, 0x8F, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x83,
+    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x83, 0xFC, 0x03, 0xFF, 0x8F, 0xF0, 0x03,
+    0xFB, 0x8F, 0xE0, 0x03, 0xF1, 0x8F, 0x80, 0x63, 0xE1, 0x8F, 0x00, 0xE3,
+    0xE3, 0x8E, 0x01, 0xE3, 0xC3, 0x88, 0x07, 0xE3, 0x83, 0x80, 0x0F, 0xE3,
+    0x87, 0x80, 0x3F, 0xE3, 0xCF, 0x80, 0x7F, 0xC3, 0xFF, 0x81, 0xFF, 0x03,
+    0xFF, 0x83, 0xFE, 0x03, 0xFF, 0xC7, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x3F,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFC, 0x3F, 0xFF, 0xC0, 0xF8, 0x3F,
+    0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0xC3, 0xE0, 0x3F, 0xFF, 0xC7, 0x80, 0x3F,
+    0xF9, 0xC7, 0x00, 0x3F, 0xE0, 0xC6, 0x02, 0x3F, 0x81, 0xC0, 0x0E, 0x3F,
+    0x83, 0xC0, 0x1E, 0x3F, 0xC7, 0xC0, 0x3E, 0x3F, 0xFF, 0xC0, 0xFC, 0x3F,
+    0xFF, 0xC1, 0xF0, 0x3F, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xF7, 0xF0, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x01, 0xFF, 0x07,
+    0xFF, 0x01, 0xFC, 0x07, 0xFF, 0x07, 0xF8, 0x07, 0xFF, 0x1F, 0xE0, 0x07,
+    0xEF, 0x1F, 0xC0, 0x07, 0x87, 0x1F, 0x00, 0xC7, 0x83, 0x1E, 0x01, 0xC7,
+    0x83, 0x1C, 0x03, 0xC7, 0x87, 0x10, 0x0F, 0xC7, 0xCF, 0x00, 0x1F, 0xC7,
+    0xFF, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0xFF, 0x87, 0xFF, 0x03, 0xFE, 0x07,
+    0xFF, 0x07, 0xFC, 0x07, 0xFF, 0x8F, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x7F,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x80, 0xFF, 0xCF, 0x1E, 0x00, 0xFF,
+    0x87, 0x1C, 0x00, 0xFF, 0x87, 0x18, 0x08, 0xFF, 0x87, 0x00, 0x38, 0xFF,
+    0x87, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+    0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xDF, 0xC3, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x01, 0xFF, 0x07,
+    0xFF, 0x01, 0xFC, 0x07, 0x1F, 0x07, 0xF8, 0x07, 0x0F, 0x1F, 0xE0, 0x07,
+    0x87, 0x1F, 0xC0, 0x07, 0xC3, 0x1F, 0x00, 0xC7, 0xE3, 0x1E, 0x01, 0xC7,
+    0xE3, 0x1C, 0x03, 0xC7, 0xC3, 0x10, 0x0F, 0xC7, 0x87, 0x00, 0x1F, 0xC7,
+    0x1F, 0x00, 0x7F, 0xC7, 0x3F, 0x00, 0xFF, 0x87, 0xFF, 0x03, 0xFE, 0x07,
+    0xFF, 0x07, 0xFC, 0x07, 0xFF, 0x8F, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x7F,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF8, 0x7F, 0xFF, 0x81, 0xF0, 0x7F,
+    0x8F, 0x81, 0xE0, 0x7F, 0x07, 0x87, 0xC0, 0x7F, 0x83, 0x8F, 0x00, 0x7F,
+    0xE1, 0x8E, 0x00, 0x7F, 0xF1, 0x8C, 0x04, 0x7F, 0xC1, 0x80, 0x1C, 0x7F,
+    0x83, 0x80, 0x3C, 0x7F, 0x0F, 0x80, 0x7C, 0x7F, 0x1F, 0x81, 0xF8, 0x7F,
+    0xFF, 0x83, 0xE0, 0x7F, 0xFF, 0x87, 0xE0, 0x7F, 0xFF, 0xEF, 0xE1, 0xFF,
+    // 0x3C0 'π'
+    0xFB, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x87, 0xFF, 0x7F,
+    0x87, 0xF0, 0x7F, 0x86, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x01, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0x87, 0xFC, 0x7F, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFE, 0x00, 0x03,
+    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x8F, 0xCF, 0x03,
+    0x8F, 0x0F, 0x03, 0x8C, 0x07, 0xE1, 0x80, 0x07, 0xF1, 0x80, 0x03, 0xE1,
+    0x80, 0xC3, 0xE1, 0xC1, 0xC0, 0x03, 0xC7, 0xE0, 0x03, 0xFF, 0xF0, 0x07,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x1F,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F,
+    // 0x2014 '—'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2018 '‘'
+    0xF8, 0x7F, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x8F, 0x7F, 0xFF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0xFF, 0xDF, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x81, 0xFF,
+    0xFF, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF,
+    // 0x201B '‛'
+    0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xDE, 0x3F, 0xFF, 0xFF,
+    // 0x201C '“'
+    0xF8, 0x7F, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x8F, 0x7F, 0xFF, 0xFF,
+    0xF8, 0x7F, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x8F, 0x7F, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0xFF, 0xDF, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x81, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x81, 0xFF,
+    0xFF, 0xFF,
+    // 0x201E '„'
+    0xFF, 0xFF, 0xBE, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF, 0xBE, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF,
+    // 0x201F '‟'
+    0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xDE, 0x3F, 0xFF, 0xFF,
+    0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xDE, 0x3F, 0xFF, 0xFF,
+    // 0x2020 '†'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFC, 0x7F, 0xFF, 0x8C, 0x7F, 0x9F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x9C, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x1F, 0xFC, 0x3E, 0x1F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x3F, 0x9C, 0x7E, 0x39, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x9C, 0x7E, 0x39, 0xFC, 0x7E, 0x3F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x3E, 0x1F, 0xFC, 0x3E, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xE3, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC3,
+    // 0x2026 '…'
+    0xCF, 0x87, 0x83, 0x83, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x87,
+    0x83, 0x83, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x87, 0x83, 0x83,
+    0x87, 0xCF,
+    // 0x2039 '‹'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x82, 0x1F,
+    0x87, 0x0F, 0x9F, 0x8F, 0xBF, 0xDF,
+    // 0x203A '›'
+    0xBF, 0xDF, 0x9F, 0x8F, 0x87, 0x0F, 0x82, 0x1F, 0xC0, 0x3F, 0xE0, 0x3F,
+    0xF0, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x83, 0x83, 0x0F, 0xE3,
+    0x1F, 0xE3, 0x1F, 0xE3, 0x0F, 0xC3, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x0F,
+    0xF0, 0x3F,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF0, 0x9F, 0xE1, 0x9F,
+    0xC3, 0x9F, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0xFF, 0x9F,
+    0xFF, 0x9F,
+    // 0x2075 '⁵'
+    0xFF, 0xFF, 0xFF, 0xF3, 0x81, 0xF3, 0x81, 0xF3, 0x80, 0xE3, 0x88, 0xE3,
+    0x98, 0x43, 0x98, 0x03, 0x9C, 0x07, 0x9E, 0x0F, 0xFF, 0xBF,
+    // 0x2076 '⁶'
+    0xFF, 0x3F, 0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0xE3, 0x81, 0xF3,
+    0x88, 0xF3, 0x18, 0x63, 0x18, 0x03, 0x1C, 0x07, 0xBE, 0x0F, 0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xFF, 0xFF, 0x87, 0xFF, 0x83, 0xFF, 0x87, 0xC3, 0x9F, 0x03, 0x9C, 0x03,
+    0x98, 0x0F, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0xCF, 0xC3, 0x07, 0x80, 0x03, 0x80, 0x03, 0x10, 0x73, 0x18, 0xF3,
+    0x18, 0x73, 0x00, 0x23, 0x80, 0x03, 0x82, 0x07, 0xE7, 0x0F,
+    // 0x2079 '⁹'
+    0xF3, 0xFF, 0xC0, 0xF3, 0x80, 0x73, 0x80, 0x63, 0x1C, 0x63, 0x1E, 0x43,
+    0x1E, 0x03, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x7F, 0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x83, 0x83, 0x0F, 0xE3,
+    0x1F, 0xF3, 0x1F, 0xE3, 0x0F, 0xC3, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x0F,
+    0xF0, 0x3F,
+    // 0x2081 '₁'
+    0xCF, 0xFB, 0xCF, 0xF3, 0xCF, 0xF3, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+    0x80, 0x03, 0xFF, 0xE3, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xC7, 0xE3, 0x83, 0xC3, 0x83, 0x83, 0x0F, 0x03, 0x1E, 0x03,
+    0x1C, 0x23, 0x80, 0x63, 0x80, 0xE3, 0x81, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xFF, 0xC7, 0xF3, 0x87, 0xF3, 0x8C, 0x73, 0x1C, 0xE3, 0x1C, 0xE3,
+    0x18, 0x43, 0x80, 0x03, 0x80, 0x07, 0x82, 0x0F, 0xFF, 0x1F,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x0F, 0xF0, 0x8F, 0xE1, 0x8F,
+    0xC3, 0x8F, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0xFF, 0x8F,
+    0xFF, 0x9F,
+    // 0x2085 '₅'
+    0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0xF3, 0x80, 0xF3, 0x80, 0xF3, 0x88, 0xE3,
+    0x88, 0x63, 0x8C, 0x03, 0x8C, 0x07, 0x8E, 0x0F, 0xFF, 0xBF,
+    // 0x2086 '₆'
+    0xFF, 0x3F, 0xF8, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0xE3, 0x80, 0xF3,
+    0x88, 0xF3, 0x18, 0x63, 0x1C, 0x03, 0x1C, 0x07, 0x9E, 0x0F, 0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xFF, 0xFF, 0x87, 0xFF, 0x83, 0xFF, 0x87, 0xC3, 0x8F, 0x03, 0x8C, 0x03,
+    0x88, 0x0F, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0xCF, 0xC3, 0x07, 0x80, 0x03, 0x80, 0x03, 0x18, 0x73, 0x1C, 0x73,
+    0x1C, 0x73, 0x00, 0x23, 0x80, 0x03, 0x83, 0x07, 0xE7, 0x8F,
+    // 0x2089 '₉'
+    0xF3, 0xFF, 0xC0, 0xF3, 0x80, 0x73, 0x80, 0x73, 0x0C, 0x63, 0x1E, 0x03,
+    0x1E, 0x03, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x7F, 0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0xFF, 0xF3, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0x33, 0xFF, 0xFE, 0x00, 0xFF,
+    0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0x30, 0x07,
+    0x83, 0x33, 0x07, 0x87, 0x33, 0x87, 0x8F, 0x33, 0xC7, 0x0F, 0x33, 0xC3,
+    0x1F, 0x37, 0xC3, 0x1F, 0x7F, 0xC7, 0x1F, 0xFF, 0xC7, 0x01, 0xFF, 0xC7,
+    0x81, 0xFF, 0xC7, 0x83, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0xFF, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x3F, 0xBF, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0xBF, 0x0F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x07, 0xBF, 0x01, 0xFF, 0xE0, 0xFF,
+    0xF8, 0xFF, 0xC3, 0xFF, 0x0F, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x3E, 0x3F,
+    0xFF, 0xBF,
+    // 0x2153 '⅓'
+    0xF3, 0xFC, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF, 0xFF, 0xF8, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFB, 0xFF, 0x81, 0xE3, 0xF9, 0xFF, 0xC7, 0xC3, 0xF9, 0xFF,
+    0xDF, 0xC6, 0x38, 0xFF, 0xFF, 0xCE, 0x79, 0xFF, 0xFF, 0x8E, 0x71, 0xFF,
+    0xFF, 0x80, 0x21, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xE1, 0x07, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0xFF, 0xFF, 0xE1, 0xF0, 0xFF, 0xFF,
+    0xE1, 0xE0, 0xFF, 0xFF, 0xC7, 0xC0, 0xFF, 0xFF, 0xC7, 0x80, 0xFF, 0xFF,
+    0xC7, 0x08, 0xFF, 0xFF, 0xC0, 0x18, 0xFF, 0xFF, 0xE0, 0x38, 0xFC, 0xFF,
+    0xE0, 0x78, 0xF8, 0x7F, 0xF9, 0xF8, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFB, 0xFF, 0x81, 0xE3, 0xF9, 0xFF,
+    0xC7, 0xC3, 0xF9, 0xFF, 0xCF, 0xC6, 0x38, 0xFF, 0xFF, 0xCE, 0x79, 0xFF,
+    0xFF, 0x8E, 0x71, 0xFF, 0xFF, 0x80, 0x21, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE1, 0x07, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    // 0x215B '⅛'
+    0xF3, 0xFC, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0xFF, 0xE3, 0xF8, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+    0xC0, 0x7F, 0xC7, 0xFF, 0x81, 0xE1, 0x83, 0xFF, 0xC7, 0xC0, 0x01, 0xFF,
+    0xCF, 0xC0, 0x01, 0xFF, 0xFF, 0xCC, 0x39, 0xFF, 0xFF, 0x8E, 0x38, 0xFF,
+    0xFF, 0x8C, 0x39, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xE1, 0x83, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFC, 0xFF, 0xFF, 0xE1, 0xF8, 0xFF, 0xFF,
+    0xC7, 0x38, 0xFF, 0xFF, 0xC7, 0x38, 0xFF, 0xFF, 0xC6, 0x38, 0xFF, 0xFF,
+    0xC4, 0x30, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xF8, 0xFF,
+    0xE1, 0x83, 0xF0, 0x7F, 0xFF, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xC7, 0xFF, 0x83, 0xE1, 0x83, 0xFF,
+    0xCF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCC, 0x39, 0xFF,
+    0xFF, 0x8E, 0x38, 0xFF, 0xFF, 0x8C, 0x39, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE1, 0x83, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x78, 0xFF, 0xFF,
+    0xC0, 0x78, 0xFF, 0xFF, 0xC0, 0x38, 0xFF, 0xFF, 0xC6, 0x38, 0xFF, 0xFF,
+    0xC6, 0x30, 0xFF, 0xFF, 0xC6, 0x01, 0xFE, 0xFF, 0xC7, 0x01, 0xF8, 0xFF,
+    0xC7, 0x83, 0xE0, 0x7F, 0xFF, 0xEF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xC7, 0xFF, 0x83, 0xE1, 0x83, 0xFF,
+    0xCF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCC, 0x39, 0xFF,
+    0xFF, 0x8E, 0x38, 0xFF, 0xFF, 0x8C, 0x39, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE1, 0x83, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF,
+    // 0x215E '⅞'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xC3, 0xF0, 0xFF, 0xFF, 0xC7, 0xC0, 0xFF, 0xFF, 0xC7, 0x00, 0xFF, 0xFF,
+    0xC6, 0x03, 0xFE, 0xFF, 0xC0, 0x1F, 0xF8, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F,
+    0xC1, 0xFF, 0xC0, 0xFF, 0xE3, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+    0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xC7, 0xFF, 0xCF, 0xE1, 0x83, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCC, 0x39, 0xFF,
+    0xFF, 0x8E, 0x38, 0xFF, 0xFF, 0x8C, 0x39, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE1, 0x83, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF,
+    // 0x2190 '←'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xC0, 0x07,
+    0x84, 0x43, 0xCC, 0x67, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xEC, 0x7F,
+    0xCC, 0x63, 0x84, 0x43, 0xC0, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x8F,
+    0x88, 0x87, 0xD8, 0xCF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xD8, 0xCF, 0x88, 0x87, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFC, 0xFF, 0xF0, 0xF8, 0x7F, 0xF0, 0xFC, 0x3F,
+    0xE3, 0xFE, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xC0, 0x00, 0x0F, 0xE3, 0xFE, 0x1F, 0xF0, 0xF8, 0x3F, 0xF0, 0xF8, 0x7F,
+    0xF9, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xF0, 0x87, 0xFF, 0xE0, 0xC3, 0xFF, 0xC0, 0xC1, 0xFF, 0x80, 0xC8, 0xFF,
+    0x88, 0xCC, 0xFF, 0xD8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xC7, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xD8, 0xCF, 0xFF, 0x88, 0xCC, 0xFF,
+    0x80, 0xC8, 0xFF, 0xC0, 0xC1, 0xFF, 0xE0, 0xC3, 0xFF, 0xF0, 0x87, 0xFF,
+    0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xF1, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE1, 0x8F, 0xC1, 0x87,
+    0x81, 0x81, 0x91, 0x93, 0xD1, 0x9F, 0xF1, 0x9F, 0xF1, 0x9F, 0xD1, 0x9B,
+    0x81, 0x91, 0x81, 0x83, 0xC1, 0x87, 0xE1, 0x8F, 0xF0, 0x1F, 0xF8, 0x3F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+    0xEF, 0xE0, 0x00, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0x8F, 0x81, 0xF0, 0xFF,
+    0x8F, 0x87, 0xF8, 0xFF, 0x9F, 0x8F, 0xF8, 0xFF, 0x1F, 0x1F, 0xF0, 0xFF,
+    0x0F, 0x1F, 0xE0, 0xFF, 0x87, 0x8F, 0x81, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+    0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03,
+    0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x63, 0xFC, 0x01, 0xE3, 0xE0, 0x0F, 0xE3,
+    0xC0, 0x7F, 0xE3, 0x81, 0xFF, 0xE3, 0x80, 0xFF, 0xE3, 0x80, 0x1F, 0xE3,
+    0x80, 0x03, 0xE3, 0xE0, 0x00, 0x63, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE3,
+    // 0x220F '∏'
+    0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xDF, 0xFF, 0xFC, 0x7F, 0x07, 0xFF, 0xF8, 0x3F, 0x03, 0xFF, 0xE0, 0x3F,
+    0x01, 0xFF, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0x3F, 0x00, 0x3E, 0x04, 0x3F,
+    0x10, 0x0C, 0x0C, 0x3F, 0x18, 0x00, 0x1C, 0x3F, 0x1E, 0x00, 0x7C, 0x3F,
+    0x1F, 0x00, 0xFC, 0x3F, 0x1F, 0xC1, 0xFC, 0x3F, 0x1F, 0xF3, 0xFC, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F, 0x07, 0xFF, 0xF8, 0x3F,
+    0x01, 0xFF, 0xC0, 0x3F, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+    0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF0, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0x04, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x0E, 0x3F, 0x84, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF, 0xC0, 0x7F, 0x84, 0x3F,
+    0x8E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x7F,
+    0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE1,
+    0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xF1, 0x8F, 0xF1, 0x8F, 0xF1, 0x83, 0xF1, 0x81, 0xF1, 0x03,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC1, 0x8F, 0x81, 0x8F, 0xC1, 0x8F,
+    0xF1, 0x8F, 0xF1, 0x8F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xF8, 0x7E, 0x3F, 0xF0, 0x7E, 0x3F,
+    0xF0, 0x3E, 0x3F, 0xE0, 0x3E, 0x3F, 0xE2, 0x1E, 0x3F, 0xC3, 0x1E, 0x3F,
+    0xC7, 0x0E, 0x3F, 0x87, 0x8E, 0x3F, 0x8F, 0x86, 0x3F, 0x0F, 0xC6, 0x3F,
+    0x1F, 0xC2, 0x3F, 0xDF, 0xEE, 0x3F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xF7, 0x1F, 0x8F, 0xE3, 0x1F, 0x87, 0xE3, 0x1F,
+    0xC7, 0xC7, 0x1F, 0xC3, 0xC7, 0x1F, 0xE3, 0x8F, 0x1F, 0xE1, 0x8F, 0x1F,
+    0xF1, 0x1F, 0x1F, 0xF0, 0x1F, 0x1F, 0xF8, 0x3F, 0x1F, 0xF8, 0x3F, 0x1F,
+    0xFC, 0x7F, 0x1F, 0xFC, 0x7F, 0x1F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BoldBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x60, 0x76, 0x06, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x93, 0x80, 0x10, 0x00, 0x00, 0x00,
+    // 0x22 '"'
+    0x78, 0xDF, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x9C, 0x1F, 0x00, 0x1F,
+    0x43, 0x9F, 0x80, 0x1F, 0x00, 0x5F, 0x01, 0xDF, 0x40, 0x1F,
+    // 0x23 '#'
+    0x00, 0x0C, 0x0F, 0x01, 0x02, 0x0F, 0x00, 0x02, 0x2F, 0x00, 0x00, 0x1F,
+    0x00, 0xA0, 0x1F, 0x0C, 0x00, 0x0F, 0x20, 0x01, 0x0F, 0x00, 0x52, 0x0F,
+    0x00, 0x02, 0x0F, 0x50, 0x03, 0x9F, 0x00, 0x10, 0x1F, 0x00, 0x80, 0x1F,
+    0x08, 0x00, 0xCF, 0x00, 0x02, 0x0F, 0x00, 0xC2, 0x0F, 0x04, 0x02, 0x0F,
+    0x40, 0x0E, 0x0F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x0F,
+    // 0x24 '$'
+    0x00, 0x00, 0x18, 0x03, 0x00, 0x18, 0x02, 0x03, 0x02, 0x00, 0x01, 0x03,
+    0x04, 0x02, 0x21, 0x03, 0x08, 0x80, 0x08, 0x03, 0x09, 0x01, 0x04, 0xBF,
+    0x71, 0x90, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x44, 0x7B,
+    0xF0, 0x08, 0x00, 0x03, 0x08, 0x00, 0x59, 0x03, 0x00, 0x84, 0x01, 0x03,
+    0x00, 0x02, 0x00, 0x03, 0x04, 0x41, 0x00, 0x03, 0x00, 0x80, 0x80, 0x03,
+    // 0x25 '%'
+    0x05, 0xD0, 0x00, 0x7F, 0x08, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0xC2, 0x00, 0x7F, 0x08, 0x10, 0x00, 0x7F, 0x08, 0x0A, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x07, 0xC2, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x82, 0x7F, 0x00, 0x01, 0x0C, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x00, 0x10, 0x40, 0x7F, 0x00, 0x60, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x02, 0x10, 0x00, 0x7F, 0x00, 0x26, 0x08, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x0C, 0x03, 0xE1, 0x7F, 0x30, 0x24, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x20, 0x01, 0x7F, 0x00, 0x01, 0xE0, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x08, 0x04, 0x7F, 0x00, 0x01, 0xF0, 0x7F,
+    // 0x26 '&'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    0x08, 0x80, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x21, 0x00, 0x04, 0x13,
+    0x04, 0x00, 0x03, 0x80, 0x60, 0x91, 0x00, 0x00, 0x51, 0x01, 0x00, 0x03,
+    0x8C, 0x00, 0x01, 0x80, 0x00, 0x01, 0x40, 0x01, 0x01, 0x38, 0x08, 0x81,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x43, 0x00, 0x0F, 0x23,
+    0x00, 0x00, 0x01, 0x00, 0x38, 0x13, 0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0x27 '''
+    0x78, 0xDF, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x9C, 0x1F,
+    // 0x28 '('
+    0x00, 0x27, 0xA0, 0x03, 0x01, 0x80, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x43, 0x20, 0x1C, 0xC0, 0x03, 0x40, 0x00, 0x00, 0x03,
+    0x84, 0x00, 0x01, 0x0B, 0x08, 0x00, 0x00, 0x83, 0x80, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x13, 0x90, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x0B, 0x43, 0x00, 0x02, 0x03, 0x20, 0x20, 0x08, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x01, 0x83, 0x03, 0x00, 0x06, 0x03,
+    0x00, 0x20, 0x30, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x2A '*'
+    0x00, 0x0F, 0x00, 0x4F, 0x00, 0x0F, 0x24, 0x0F, 0x10, 0x8F, 0x49, 0x2F,
+    0x00, 0x0F, 0x01, 0x0F, 0x41, 0x6F, 0x09, 0x0F, 0x09, 0x0F,
+    // 0x2B '+'
+    0x03, 0x03, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0xFC, 0x7B,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83,
+    0x00, 0x83, 0x00, 0x83,
+    // 0x2C ','
+    0x00, 0x1F, 0x00, 0x3F, 0x60, 0x1F, 0x00, 0x5F, 0x00, 0x9F, 0x00, 0x1F,
+    0x44, 0x1F, 0x30, 0x1F,
+    // 0x2D '-'
+    0x5F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x6F,
+    // 0x2E '.'
+    0x33, 0x43, 0x03, 0x83, 0x07, 0x0B, 0x03,
+    // 0x2F '/'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x01, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0x30 '0'
+    0x00, 0x00, 0x03, 0x03, 0x02, 0x83, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0B, 0x40, 0x78, 0x0B, 0x06, 0x01, 0x83, 0x08, 0x00, 0x07,
+    0x90, 0x00, 0x03, 0x80, 0x00, 0x03, 0x90, 0x00, 0x07, 0x80, 0x00, 0x03,
+    0x81, 0x05, 0x0B, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x08, 0x00, 0x03, 0x02, 0xF2, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x27, 0x20, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x44, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x7F, 0xFF, 0xC7, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x3F,
+    // 0x32 '2'
+    0x04, 0x00, 0x27, 0x11, 0x00, 0x47, 0x01, 0x00, 0x87, 0x41, 0x01, 0x07,
+    0x01, 0x02, 0x07, 0x08, 0x04, 0x07, 0x90, 0x08, 0x47, 0x80, 0x10, 0x47,
+    0x80, 0x21, 0x47, 0x88, 0x82, 0x47, 0x02, 0x00, 0x47, 0x80, 0x00, 0x47,
+    0x00, 0x00, 0x47, 0x00, 0x20, 0x47, 0x10, 0x00, 0x47, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x07,
+    // 0x33 '3'
+    0x00, 0x00, 0x03, 0x1C, 0x00, 0x33, 0x00, 0x00, 0x23, 0x42, 0x00, 0x27,
+    0x00, 0x18, 0x23, 0x00, 0x48, 0x03, 0x80, 0x00, 0x07, 0x90, 0x80, 0x07,
+    0x90, 0x00, 0x03, 0x81, 0x08, 0x03, 0x84, 0x03, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x13, 0x40, 0x20, 0x03, 0x0C, 0x00, 0x43, 0x00, 0x06, 0x03,
+    // 0x34 '4'
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x03, 0x00, 0x10, 0x03, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x08, 0x40, 0x03,
+    0x20, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x35 '5'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x03, 0x20, 0x23, 0xC0, 0x00, 0x27,
+    0x00, 0x20, 0x23, 0x00, 0x20, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x03, 0x00, 0x09, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x13,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x43, 0x10, 0x01, 0x83,
+    // 0x36 '6'
+    0x00, 0x0C, 0x03, 0x00, 0x40, 0xC3, 0x00, 0x00, 0x23, 0x08, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x20, 0x09, 0x03, 0x01, 0x00, 0x87, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x03, 0x88, 0x10, 0x07, 0x80, 0x08, 0x43, 0x90, 0x82, 0x03,
+    0x90, 0x80, 0x03, 0x80, 0x40, 0x13, 0x80, 0x20, 0x23, 0x60, 0x15, 0x43,
+    // 0x37 '7'
+    0x32, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x0C, 0x01, 0x8B,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x00, 0x80, 0x53,
+    0x02, 0x03, 0x03, 0x04, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x01, 0x00, 0x03, 0x80, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x00, 0x83, 0x0A, 0x00, 0x23, 0x00, 0x08, 0x13, 0x00, 0x10, 0x03,
+    0x40, 0x20, 0x03, 0x00, 0x06, 0x83, 0x01, 0x00, 0x07, 0x90, 0x00, 0x23,
+    0x80, 0x08, 0x23, 0x90, 0x80, 0x07, 0x82, 0x04, 0x03, 0x80, 0x01, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x80, 0x03, 0x01, 0x00, 0x03, 0x0C, 0x00, 0x83,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x18, 0x00, 0x2B, 0x00, 0x10, 0x23, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x80, 0x84, 0x47, 0x80, 0x00, 0x47, 0x90, 0x04, 0x83,
+    0x90, 0x04, 0x03, 0x80, 0x02, 0x03, 0x04, 0x20, 0x13, 0x00, 0xC0, 0x03,
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x83, 0x10, 0x00, 0x03, 0x02, 0x18, 0x03,
+    // 0x3A ':'
+    0x30, 0x06, 0x7F, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0xFF, 0x48, 0x01, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x3B ';'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x17, 0x40, 0x00, 0xC7, 0x80, 0x00, 0x0B,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03,
+    // 0x3C '<'
+    0x02, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x00, 0x03, 0x00, 0x4B, 0x00, 0x03,
+    0x80, 0x23, 0x40, 0x13,
+    // 0x3D '='
+    0x63, 0xBF, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F,
+    0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F,
+    0x90, 0x3F, 0x82, 0x3F,
+    // 0x3E '>'
+    0x00, 0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x40, 0x03, 0x40, 0x03,
+    0x20, 0x83, 0x00, 0x03, 0x11, 0x03, 0x01, 0x03, 0x08, 0x03, 0x00, 0x03,
+    0x00, 0x83, 0x00, 0x03,
+    // 0x3F '?'
+    0x00, 0x00, 0x01, 0x58, 0x00, 0x01, 0x08, 0x18, 0x19, 0x08, 0x21, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x41, 0x01, 0x88, 0x40, 0x03, 0x88, 0x00, 0x39,
+    0x40, 0x88, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x01,
+    // 0x40 '@'
+    0x00, 0x10, 0x40, 0x1F, 0x00, 0xC0, 0x18, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x08, 0x07, 0x40, 0x1F, 0x00, 0x80, 0x00, 0x9F,
+    0x21, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x44, 0x00, 0xC2, 0x1F,
+    0x48, 0x82, 0x20, 0x1F, 0x01, 0x10, 0x00, 0x3F, 0x81, 0x30, 0x01, 0x3F,
+    0x00, 0x49, 0x00, 0x1F, 0x82, 0x00, 0x40, 0x1F, 0x92, 0x0A, 0x10, 0x1F,
+    0x92, 0x02, 0xA0, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x81, 0x00, 0x01, 0x1F,
+    0x00, 0x40, 0x10, 0x3F, 0x80, 0x00, 0x80, 0x1F, 0x08, 0x00, 0x12, 0x5F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x01, 0x11, 0x9F, 0x20, 0xBA, 0x20, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x80, 0x1F, 0x01, 0x03, 0x00, 0x1F,
+    0x00, 0x30, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x18, 0x03, 0x00, 0x00, 0x13, 0x01, 0x00, 0x03,
+    0x0C, 0x08, 0x8F, 0x00, 0x04, 0x83, 0x01, 0x84, 0x83, 0x03, 0x04, 0x83,
+    0x80, 0x64, 0x83, 0x80, 0x08, 0x83, 0x00, 0x00, 0x13, 0x0C, 0x00, 0x33,
+    0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x17,
+    // 0x42 'B'
+    0x00, 0x00, 0x09, 0x40, 0x00, 0x11, 0x48, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0F, 0x8F, 0xE1,
+    0x00, 0x40, 0x01, 0x00, 0x48, 0x01, 0x08, 0x40, 0x01, 0x04, 0x04, 0x01,
+    0x40, 0x01, 0xC5, 0x40, 0x00, 0x05, 0x00, 0x20, 0x09, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x03, 0x81,
+    // 0x43 'C'
+    0x00, 0xBE, 0x01, 0x00, 0x00, 0x61, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x7A, 0x01, 0x02, 0x00, 0x81, 0x00, 0x00, 0x41,
+    0x08, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x21, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x03, 0x8A, 0x00, 0x21, 0x00, 0x00, 0x21, 0x41, 0x00, 0x01,
+    0x42, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x44 'D'
+    0x00, 0x00, 0x09, 0x40, 0x00, 0x11, 0x08, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x21,
+    0x08, 0x00, 0x05, 0x44, 0x00, 0x05, 0x02, 0x00, 0x01, 0x01, 0x83, 0x01,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x11, 0x10, 0x00, 0x21, 0x04, 0x00, 0x81,
+    0x02, 0x05, 0x01, 0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x27, 0x10, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xC7,
+    0x10, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x10, 0x00, 0x47, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x84, 0x02, 0x0F, 0x00, 0x00, 0x87,
+    // 0x46 'F'
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x27, 0x10, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xC7, 0xC7,
+    0x10, 0x00, 0x27, 0x10, 0x00, 0x07, 0x10, 0x00, 0x17, 0x10, 0x00, 0x07,
+    0x18, 0x40, 0x07, 0x00, 0x40, 0x07, 0x00, 0x50, 0x07, 0x78, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0xBE, 0x01, 0x00, 0x00, 0x61, 0x00, 0x00, 0x01, 0x10, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x20, 0x7C, 0x01, 0x40, 0x00, 0x01, 0x44, 0x00, 0x41,
+    0x08, 0x00, 0x23, 0x88, 0x00, 0x03, 0x80, 0x00, 0x21, 0x80, 0x0E, 0x01,
+    0x80, 0x00, 0x03, 0x80, 0x02, 0x23, 0x88, 0x01, 0xC1, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    // 0x48 'H'
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x27, 0x10, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xC7,
+    0x20, 0x00, 0x27, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x17, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x40, 0x00, 0x3F,
+    // 0x49 'I'
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7,
+    0x20, 0x00, 0x27, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x0F,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xE8, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x30, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
+    // 0x4B 'K'
+    0x80, 0x00, 0x13, 0x00, 0x00, 0x23, 0x10, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x80, 0x23, 0x81, 0x04, 0x03, 0x02, 0x01, 0x03, 0x04, 0x40, 0x83,
+    0xC8, 0x20, 0x03, 0x30, 0x00, 0x23, 0x02, 0x00, 0x13, 0x04, 0x02, 0x03,
+    0x08, 0x01, 0x03, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x03,
+    // 0x4C 'L'
+    0x80, 0x00, 0x17, 0x00, 0x00, 0x27, 0x10, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x03, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x01, 0xC7,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x0C, 0xC7,
+    0x1B, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x06, 0x38, 0x07,
+    0x03, 0x00, 0x27, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x07, 0x10, 0x01, 0x07,
+    0x04, 0x00, 0x27, 0x00, 0x60, 0x17, 0x00, 0x18, 0x07, 0x00, 0xC0, 0x07,
+    0x02, 0x02, 0x07, 0x40, 0x10, 0x07, 0x80, 0xC0, 0x1F, 0x06, 0x00, 0x07,
+    0x00, 0xC7, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x0C, 0xE0, 0x07, 0x00, 0x01, 0x87, 0x40, 0x00, 0x27, 0x00, 0x00, 0x3F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x23,
+    0x80, 0x40, 0x03, 0x20, 0x00, 0x23, 0x10, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x02, 0x02, 0x03, 0x00, 0x80, 0x83, 0x00, 0x00, 0x43, 0x80, 0x00, 0x13,
+    0x20, 0x00, 0x0B, 0x1F, 0xF8, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x1F, 0xFF, 0xFB, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0xBD, 0x01, 0x00, 0x00, 0x41, 0x08, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x20, 0x00, 0x01, 0x00, 0x3A, 0x05, 0x02, 0x00, 0x01, 0x40, 0x00, 0x03,
+    0x08, 0x00, 0x21, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x88, 0x00, 0x03, 0x80, 0x00, 0x01, 0x04, 0x00, 0x05, 0x41, 0x81, 0x85,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x10, 0x00, 0x21, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x01, 0x00, 0x00, 0x01,
+    // 0x50 'P'
+    0x00, 0x00, 0x0B, 0x40, 0x00, 0x13, 0x08, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x12, 0x03,
+    0x00, 0x02, 0x13, 0x00, 0x12, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x08, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0xBE, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x20, 0x00, 0x00, 0x07, 0x00, 0x3A, 0x00, 0x07,
+    0x02, 0x00, 0x00, 0x07, 0x40, 0x00, 0x42, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x87, 0x80, 0x00, 0x00, 0x07,
+    0x88, 0x00, 0x02, 0x27, 0x80, 0x00, 0x20, 0x27, 0x04, 0x00, 0x04, 0x17,
+    0x41, 0x80, 0x04, 0x17, 0x40, 0x00, 0x08, 0x87, 0x00, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x20, 0x87, 0x00, 0x00, 0x00, 0x87, 0x01, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27,
+    // 0x52 'R'
+    0x00, 0x00, 0x09, 0x40, 0x00, 0x11, 0x48, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x11, 0x00, 0x20, 0x11, 0x08, 0x20, 0x81, 0x08, 0x40, 0x21,
+    0x02, 0x80, 0x11, 0x00, 0x0A, 0x01, 0x00, 0x10, 0x05, 0x20, 0x20, 0x01,
+    0x18, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x53 'S'
+    0x00, 0x00, 0x99, 0x00, 0x41, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x23, 0x04, 0x00, 0x01, 0x08, 0x00, 0x11, 0x80, 0x80, 0x11,
+    0x10, 0x00, 0x11, 0x80, 0x40, 0x03, 0x80, 0x00, 0x01, 0x03, 0x20, 0x01,
+    0x00, 0x10, 0x01, 0x41, 0x00, 0x01, 0x04, 0x04, 0x01, 0x00, 0x00, 0x01,
+    // 0x54 'T'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x18, 0x00, 0x07, 0x10, 0x00, 0x17, 0x10, 0x00, 0x27, 0x10, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x00, 0x27, 0x10, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x08, 0x00, 0x07,
+    // 0x55 'U'
+    0xA0, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1F, 0xFF, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x47, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x47, 0x20, 0x00, 0x83,
+    0x00, 0x01, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x03, 0x83, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x56 'V'
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x30, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x63, 0x00, 0x80, 0x03, 0xC0, 0x10, 0x03, 0x00, 0x06, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x0B, 0xA0, 0x40, 0x23, 0x26, 0x00, 0x03,
+    0x10, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x03,
+    0x18, 0x00, 0x03, 0x20, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x57 'W'
+    0x40, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x10, 0x00, 0x03, 0x02, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x08, 0x03, 0x00, 0x01, 0x03, 0x00, 0x00, 0x23,
+    0x14, 0x00, 0x0B, 0x21, 0x40, 0x03, 0xC0, 0x14, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x10, 0x0B, 0x03, 0x00, 0x63, 0x20, 0x03, 0x03, 0x00, 0x08, 0x03,
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x06, 0x00, 0x03, 0x00, 0x20, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x03,
+    0xA0, 0x50, 0x03, 0x25, 0x00, 0x03, 0x10, 0x00, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x80, 0x03, 0x04, 0x00, 0x03, 0x10, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x60, 0x00, 0x27, 0x00, 0x00, 0x27, 0x10, 0x00, 0x47,
+    0x00, 0x00, 0x87, 0x04, 0x02, 0x07, 0x01, 0x00, 0x07, 0x00, 0x08, 0x27,
+    0x00, 0x40, 0x07, 0x30, 0x01, 0x0F, 0x24, 0x00, 0x07, 0xC2, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x80, 0x00, 0x27, 0x00, 0x40, 0x27, 0x00, 0x10, 0x07,
+    0x02, 0x04, 0x07, 0x04, 0x00, 0x07, 0x00, 0x01, 0x07, 0x10, 0x00, 0x47,
+    0x20, 0x00, 0x27, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x17,
+    // 0x59 'Y'
+    0x80, 0x00, 0x07, 0x20, 0x00, 0x07, 0x10, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x01, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x20, 0x08, 0x07, 0x20, 0x00, 0x07, 0x80, 0x80, 0x07, 0x00, 0x40, 0x07,
+    0x41, 0x80, 0x07, 0x86, 0x0F, 0xC7, 0x38, 0x00, 0x27, 0x00, 0x80, 0x07,
+    0x01, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x80, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x03, 0x40, 0x00, 0x43, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03,
+    0x0C, 0x08, 0x03, 0x10, 0x00, 0x03, 0x10, 0x00, 0x43, 0x10, 0x00, 0x83,
+    0x11, 0x02, 0x03, 0x14, 0x00, 0x03, 0x18, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x88, 0x00, 0x03,
+    0x80, 0x00, 0x0B, 0x00, 0x00, 0x43,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x27,
+    // 0x5C '\'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x30, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x61, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xF7,
+    // 0x5E '^'
+    0x00, 0x01, 0x00, 0x31, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x04, 0x01, 0x01, 0x81, 0x60, 0x31, 0x00, 0x01, 0x03, 0x01,
+    0x00, 0x01, 0x00, 0x19, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F,
+    // 0x60 '`'
+    0x00, 0x08, 0x00, 0x42, 0x00, 0x09, 0x03,
+    // 0x61 'a'
+    0x00, 0x0F, 0x3F, 0x12, 0x00, 0x3F, 0x00, 0x40, 0x3F, 0x02, 0x00, 0x7F,
+    0x04, 0x00, 0x3F, 0x48, 0x90, 0x7F, 0x00, 0x02, 0x3F, 0x00, 0x20, 0xBF,
+    0x04, 0x24, 0x3F, 0x00, 0x01, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x07, 0xFC, 0x7F, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x3F,
+    // 0x62 'b'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x47, 0xFF, 0xFB, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x47, 0xF8, 0xFF,
+    0x00, 0x90, 0x04, 0x7F, 0x00, 0x80, 0x04, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x05, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x20, 0x18, 0x7F,
+    0x00, 0x04, 0xC0, 0x7F,
+    // 0x63 'c'
+    0x01, 0x14, 0x3F, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x10, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x04, 0x3F,
+    0x08, 0x00, 0x3F, 0x04, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x04, 0x3F,
+    0x20, 0x00, 0xBF, 0x1C, 0x05, 0x3F,
+    // 0x64 'd'
+    0x00, 0x02, 0x10, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x80, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x4F, 0x0F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    // 0x65 'e'
+    0x01, 0x0C, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x42, 0x10, 0x3F, 0x48, 0x00, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F,
+    0x00, 0x04, 0x3F, 0x10, 0x01, 0x3F, 0x03, 0x00, 0x3F,
+    // 0x66 'f'
+    0x00, 0x40, 0x00, 0x00, 0x10, 0x02, 0x00, 0x90, 0x04, 0x02, 0x1F, 0xF8,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x10, 0x00, 0x80, 0x10, 0x04, 0x10, 0x10, 0x00, 0x80, 0x10, 0x00,
+    0x88, 0xA0, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x18, 0x7F, 0x00, 0x00, 0x42, 0x7F, 0x04, 0x01, 0x80, 0x7F,
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x28, 0x7F,
+    0x0F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x10, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x08, 0x90, 0x49, 0x7F, 0x40, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x11, 0x7F, 0x40, 0x22, 0x00, 0x7F, 0x10, 0xC0, 0x02, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x08, 0x01, 0x90, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x68 'h'
+    0x30, 0x00, 0x01, 0x40, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x02,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03,
+    // 0x69 'i'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x04, 0x00, 0x80, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x10,
+    0x00, 0x80, 0x00, 0x00, 0x18, 0x00, 0x03, 0xC2, 0x44, 0x80, 0x00, 0x02,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20,
+    0x78, 0x00, 0x01, 0x00,
+    // 0x6B 'k'
+    0x30, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x48, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x40, 0x02, 0x7F, 0x00, 0x30, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x01, 0x02, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x10, 0x10, 0xFF, 0x00, 0x20, 0x08, 0xFF, 0x00, 0xC0, 0x04, 0x7F,
+    0x00, 0x00, 0x03, 0x7F,
+    // 0x6C 'l'
+    0x20, 0x00, 0x02, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+    // 0x6D 'm'
+    0x30, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x08, 0x02, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x02, 0x7F, 0x48, 0x01, 0x7F, 0x40, 0x00, 0x7F, 0x08, 0x00, 0xFF,
+    0x02, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x24, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x6E 'n'
+    0x30, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x08, 0x02, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x7F,
+    0x20, 0x02, 0x7F, 0x48, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x7F,
+    0x04, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x03, 0xFC, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x01, 0xFF,
+    // 0x6F 'o'
+    0x01, 0x14, 0x3F, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x40, 0x10, 0x7F, 0x08, 0x04, 0x7F, 0x00, 0x02, 0x3F,
+    0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x0C, 0x3F, 0x40, 0x00, 0xBF,
+    0x40, 0x00, 0x3F, 0x20, 0x01, 0x3F, 0x10, 0x02, 0x3F, 0x0C, 0x18, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x70 'p'
+    0x10, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x04, 0x00, 0x41,
+    0x08, 0x02, 0x45, 0x40, 0x02, 0x05, 0x00, 0x00, 0x40, 0x00, 0x04, 0x40,
+    0x01, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x05, 0x90, 0x00,
+    // 0x71 'q'
+    0x01, 0x0C, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03,
+    0x00, 0x04, 0x81, 0x08, 0x04, 0x81, 0x07, 0xF8, 0x79, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x06,
+    // 0x72 'r'
+    0x20, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x08, 0x02, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x02, 0x7F, 0x44, 0x02, 0x7F, 0x40, 0x01, 0xFF, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x78, 0x00, 0x7F,
+    // 0x73 's'
+    0x00, 0x08, 0x3F, 0x10, 0x90, 0xBF, 0x00, 0x40, 0x3F, 0x40, 0x0C, 0x7F,
+    0x40, 0x02, 0x7F, 0x00, 0x02, 0x7F, 0x00, 0x10, 0x3F, 0x00, 0x12, 0x7F,
+    0x11, 0x06, 0x3F, 0x05, 0x00, 0x3F, 0x40, 0x80, 0xBF, 0x42, 0x01, 0x3F,
+    0x04, 0x26, 0x3F,
+    // 0x74 't'
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x09, 0x00, 0x07, 0x19, 0x00, 0x47,
+    0x40, 0x00, 0x17, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x07,
+    0x09, 0x01, 0x87, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x87,
+    0x08, 0x00, 0x97, 0x00, 0x00, 0x47,
+    // 0x75 'u'
+    0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x9F, 0xF8, 0x7F, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xBF, 0xE0, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x00, 0x02, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x02, 0x7F,
+    // 0x76 'v'
+    0x40, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x01, 0x80, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x03, 0x7F,
+    0x06, 0x00, 0x7F, 0x40, 0xC0, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0xC0, 0x7F,
+    0x20, 0x00, 0x7F, 0x28, 0x00, 0x7F, 0x00, 0x20, 0x7F, 0x01, 0x80, 0x7F,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    // 0x77 'w'
+    0x40, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0xC0, 0x7F, 0x00, 0x18, 0x7F, 0x00, 0x00, 0x7F, 0x14, 0x00, 0x7F,
+    0x21, 0x40, 0x7F, 0x00, 0x10, 0x7F, 0x01, 0x00, 0x7F, 0x08, 0x02, 0x7F,
+    0x60, 0x40, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x04, 0x7F,
+    0x30, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x50, 0x7F, 0x40, 0x60, 0x7F,
+    0x05, 0x00, 0x7F, 0x10, 0x0C, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x7F,
+    0x0C, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
+    // 0x78 'x'
+    0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x02, 0x20,
+    0x01, 0x04, 0x00, 0x00, 0x10, 0x10, 0x04, 0x20, 0x00, 0x0A, 0x00, 0x04,
+    0x02, 0x00, 0x04, 0x20, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    // 0x79 'y'
+    0x40, 0x00, 0x10, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x10, 0x00, 0x60, 0x02, 0x00, 0x00, 0x22, 0x10, 0x00, 0x44,
+    0x06, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0xC0, 0x80,
+    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x80, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    // 0x7A 'z'
+    0x00, 0x00, 0x7F, 0x44, 0x00, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x7F, 0x10, 0x00, 0x7F, 0x12, 0x08, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x7F, 0x00, 0x80, 0x7F, 0x01, 0x00, 0x7F, 0x02, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x1A, 0x7F,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x0E, 0x00, 0x83, 0x83,
+    0x20, 0x30, 0x70, 0x23, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03,
+    0x81, 0x81, 0x0C, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x80, 0x00, 0x00, 0x23, 0x40, 0x00, 0x00, 0x33,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x7D '}'
+    0x60, 0x00, 0x00, 0x13, 0x80, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x84, 0x81, 0x0D, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x30, 0x60, 0x23, 0x0E, 0x00, 0x83, 0x83,
+    0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x7E '~'
+    0x3B, 0x03, 0x83, 0x93, 0x93, 0x83, 0x8B, 0x43, 0x07, 0x07, 0x07, 0x43,
+    0x83, 0x8B, 0x43,
+    // 0xA1 '¡'
+    0x70, 0x00, 0x03, 0x01, 0x00, 0x61, 0x04, 0x00, 0x01, 0x05, 0x00, 0x01,
+    0x48, 0x80, 0x01, 0x30, 0x0C, 0x30,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0xC0, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x04, 0x00, 0xC3, 0xEF, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x7F, 0xBC, 0xE0, 0x02, 0x07, 0x04, 0x80, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xA3 '£'
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x47,
+    0x00, 0x09, 0x03, 0x05, 0x00, 0x0B, 0x10, 0x00, 0x0B, 0x20, 0x00, 0x03,
+    0x40, 0x05, 0x03, 0x82, 0xC0, 0x03, 0x08, 0x00, 0x03, 0x80, 0x40, 0x07,
+    0x80, 0x40, 0x07, 0x80, 0x40, 0x07, 0x06, 0x70, 0x43, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x4B, 0x14, 0x00, 0x73,
+    // 0xA4 '¤'
+    0x20, 0x09, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x21, 0x01,
+    0x24, 0x01, 0x00, 0x25, 0x00, 0x05, 0x04, 0x01, 0x22, 0x05, 0x20, 0x09,
+    0x20, 0x01, 0x40, 0x21, 0x09, 0x11, 0x40, 0x05, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x40, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07, 0x08, 0x74, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x40, 0x17, 0x00, 0x00, 0x27, 0x10, 0x10, 0x27,
+    0x20, 0x01, 0x07, 0x80, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x00, 0x07,
+    0x23, 0x01, 0xC7, 0x0C, 0x10, 0x27, 0x00, 0x00, 0x07, 0x01, 0x40, 0x3F,
+    0x06, 0x40, 0x07, 0x08, 0x74, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xA7 '§'
+    0x05, 0x70, 0x10, 0x08, 0x08, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x58, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x20, 0x81, 0x00, 0x14, 0x40,
+    0x00, 0x82, 0x20, 0x8C, 0x08, 0x00, 0x04, 0x44, 0x84, 0x04, 0x00, 0x08,
+    0x28, 0x10, 0x30, 0x00, 0x03, 0x80,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x01, 0x82, 0x01, 0x04, 0x10, 0x01, 0x01, 0x80, 0x21,
+    0x00, 0x00, 0x41, 0x20, 0x00, 0x09, 0x00, 0x00, 0x15, 0x40, 0x00, 0x85,
+    0x42, 0x00, 0x09, 0x20, 0x44, 0x43, 0x24, 0x00, 0x49, 0x00, 0x00, 0x41,
+    0x01, 0x01, 0x49, 0x24, 0xC1, 0x0B, 0x00, 0x40, 0x41, 0x10, 0x81, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x49, 0x03, 0x00, 0x01,
+    0x04, 0x1A, 0x21, 0x03, 0x00, 0x01, 0x00, 0x44, 0x01,
+    // 0xAA 'ª'
+    0x01, 0x40, 0x02, 0x00, 0x4C, 0x08, 0x10, 0x08, 0xA4, 0x08, 0xA6, 0x28,
+    0x80, 0x08, 0x00, 0x08, 0x20, 0x08, 0x00, 0x80, 0x00, 0xA0,
+    // 0xAB '«'
+    0x00, 0x0F, 0x09, 0x0F, 0x00, 0x8F, 0x00, 0x0F, 0x20, 0x0F, 0x06, 0x1F,
+    0x00, 0x9F, 0x90, 0x4F, 0x01, 0x1F, 0x00, 0x8F, 0x00, 0x0F, 0x20, 0x0F,
+    0x00, 0x2F, 0x44, 0x0F, 0x90, 0x8F, 0x20, 0x5F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x12, 0x20, 0x7F, 0x28, 0x08, 0x7F,
+    0x10, 0x01, 0x7F, 0x00, 0x02, 0x7F, 0x08, 0x02, 0x7F, 0x28, 0x00, 0xFF,
+    0x08, 0x40, 0x7F, 0x2A, 0x10, 0x7F, 0x08, 0x88, 0xFF, 0x62, 0x28, 0x7F,
+    0x50, 0x00, 0x7F, 0x28, 0x00, 0x7F, 0x16, 0x20, 0x7F, 0x00, 0x00, 0x7F,
+    0x02, 0x20, 0x7F,
+    // 0xB0 '°'
+    0x0A, 0x1F, 0x00, 0x9F, 0x40, 0x5F, 0x8C, 0x3F, 0x00, 0x1F, 0x80, 0x3F,
+    0x80, 0x3F, 0x91, 0x1F, 0x84, 0x1F, 0x40, 0x1F, 0x20, 0x9F, 0x0C, 0x1F,
+    // 0xB1 '±'
+    0x03, 0x00, 0xDF, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    0x00, 0x81, 0x1F, 0x7C, 0x7D, 0x1F, 0x00, 0x05, 0x1F, 0x00, 0x05, 0x1F,
+    0x00, 0x05, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    // 0xB2 '²'
+    0x18, 0x1B, 0x04, 0x27, 0x40, 0x03, 0x84, 0x03, 0x10, 0x83, 0x81, 0x23,
+    0x94, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x38, 0x03, 0x00, 0x13,
+    // 0xB3 '³'
+    0x00, 0x09, 0x48, 0x11, 0x00, 0x11, 0x92, 0x93, 0x20, 0x81, 0xA0, 0x01,
+    0x98, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x09, 0x10, 0x41,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x14, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x3F, 0xE8, 0x00, 0x40, 0x00, 0x00,
+    0x40, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x4F, 0xF4, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
+    // 0xB6 '¶'
+    0x00, 0x40, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xF8, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x33, 0x0B, 0x03, 0x83, 0x03, 0x4B, 0x03,
+    // 0xB9 '¹'
+    0x20, 0x03, 0x00, 0x03, 0x00, 0x03, 0x4F, 0xE3, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x13, 0x00, 0x0B,
+    // 0xBA 'º'
+    0x06, 0x80, 0x00, 0x42, 0x00, 0x00, 0x05, 0x08, 0x80, 0x88, 0xA0, 0x08,
+    0x80, 0x08, 0x89, 0x08, 0x00, 0x28, 0x00, 0x02, 0x09, 0x80,
+    // 0xBB '»'
+    0x20, 0x0F, 0x90, 0x0F, 0x00, 0x9F, 0x06, 0x0F, 0x20, 0x2F, 0x00, 0x0F,
+    0x00, 0x8F, 0x09, 0x0F, 0x00, 0x0F, 0x90, 0x8F, 0x01, 0x0F, 0x42, 0x2F,
+    0x00, 0x0F, 0x00, 0x0F, 0x08, 0x8F, 0x07, 0x0F,
+    // 0xBC '¼'
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x01, 0x3F, 0x00, 0x01, 0x04, 0x3F,
+    0x00, 0x02, 0x08, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x02, 0x08, 0x3F, 0x00, 0x04, 0x20, 0x3F, 0x00, 0x00, 0xC0, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x10, 0x40, 0x48, 0x3F, 0x41, 0x00, 0x00, 0x3F, 0x42, 0x02, 0x00, 0x3F,
+    0x00, 0x04, 0x60, 0x3F, 0x20, 0x01, 0x20, 0x3F, 0x00, 0x20, 0x20, 0x3F,
+    0x00, 0x03, 0xC7, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x3F, 0xCE, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    // 0xBD '½'
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x04, 0x3F, 0x00, 0x01, 0x08, 0xBF,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x82, 0x3F, 0x00, 0x01, 0x08, 0x3F,
+    0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F, 0x10, 0x40, 0x00, 0x3F,
+    0x60, 0x80, 0x08, 0x3F, 0x40, 0x00, 0x10, 0x3F, 0x00, 0x22, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x40, 0x3F, 0x00, 0x00, 0x90, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x02, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xBE '¾'
+    0x00, 0x02, 0x00, 0x3F, 0x02, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0x3F, 0x28, 0x04, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x24, 0x21, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x80, 0x02, 0x3F,
+    0x11, 0x00, 0x04, 0xBF, 0x04, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x41, 0x3F,
+    0x00, 0x00, 0x86, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x08, 0x20, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x3F, 0x03, 0x08, 0x00, 0x3F,
+    0x0C, 0x20, 0x20, 0x3F, 0x10, 0x40, 0x48, 0x3F, 0x40, 0x00, 0x00, 0x3F,
+    0x04, 0x02, 0x00, 0x3F, 0x10, 0x04, 0x60, 0x3F, 0x00, 0x01, 0x20, 0x3F,
+    0x00, 0x20, 0x20, 0x3F, 0x00, 0x03, 0xC7, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0xCE, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x08, 0x3F,
+    // 0xBF '¿'
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x08, 0x00, 0x22, 0x04, 0x40, 0x00, 0x04, 0x00, 0x00,
+    0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x03,
+    0x30, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x03, 0x40, 0x0C, 0x08, 0x8F,
+    0x00, 0x00, 0x04, 0x83, 0x20, 0x01, 0x84, 0x83, 0x10, 0x03, 0x04, 0x83,
+    0x02, 0x80, 0x64, 0x83, 0x08, 0x80, 0x08, 0x83, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x0C, 0x00, 0x33, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x03, 0x02, 0x0C, 0x08, 0x8F,
+    0x0A, 0x00, 0x04, 0x83, 0x00, 0x01, 0x84, 0x83, 0x02, 0x03, 0x04, 0x83,
+    0x20, 0x80, 0x64, 0x83, 0x04, 0x80, 0x08, 0x83, 0x44, 0x00, 0x00, 0x13,
+    0x18, 0x0C, 0x00, 0x33, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x07,
+    0x0C, 0x00, 0x00, 0x27, 0x10, 0x02, 0x00, 0x07, 0x24, 0x18, 0x11, 0x1F,
+    0x88, 0x00, 0x09, 0x07, 0x90, 0x03, 0x09, 0x07, 0x00, 0x06, 0x09, 0x07,
+    0x11, 0x00, 0xC9, 0x07, 0x09, 0x00, 0x11, 0x07, 0x44, 0x00, 0x00, 0x27,
+    0x24, 0x18, 0x00, 0x67, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x07,
+    0x28, 0x00, 0x00, 0x27, 0x44, 0x02, 0x00, 0x07, 0x00, 0x18, 0x11, 0x1F,
+    0x90, 0x00, 0x09, 0x07, 0x08, 0x03, 0x09, 0x07, 0x40, 0x06, 0x09, 0x07,
+    0x01, 0x00, 0xC9, 0x07, 0x21, 0x00, 0x11, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x40, 0x18, 0x00, 0x67, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x60, 0x0F,
+    0x88, 0x00, 0x00, 0x4F, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x30, 0x22, 0x3F,
+    0x80, 0x00, 0x12, 0x0F, 0x20, 0x06, 0x12, 0x0F, 0x00, 0x0C, 0x12, 0x0F,
+    0x52, 0x01, 0x92, 0x0F, 0x02, 0x00, 0x22, 0x0F, 0x80, 0x00, 0x00, 0x4F,
+    0x08, 0x30, 0x00, 0xCF, 0x20, 0x06, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x5F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x38, 0x01, 0x00, 0x03, 0x00, 0x0C, 0x08, 0x8F,
+    0x18, 0x00, 0x04, 0x83, 0x05, 0x01, 0x84, 0x83, 0x01, 0x03, 0x04, 0x83,
+    0x8C, 0x80, 0x64, 0x83, 0x00, 0x80, 0x08, 0x83, 0x24, 0x00, 0x00, 0x13,
+    0x00, 0x0C, 0x00, 0x33, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x07, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x80, 0x27, 0x41, 0x00, 0x07, 0x00, 0x10, 0x07, 0x20, 0x28, 0x07,
+    0x00, 0x88, 0x17, 0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x0F, 0xF1, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x04, 0x00, 0x47, 0x00, 0x11, 0x07, 0x00, 0x00, 0x07,
+    0x88, 0x02, 0x17, 0x00, 0x00, 0x07,
+    // 0xC7 'Ç'
+    0x00, 0xBE, 0x00, 0x03, 0x00, 0x00, 0x60, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x00, 0x7A, 0x00, 0x03,
+    0x02, 0x00, 0x80, 0x03, 0x00, 0x00, 0x40, 0x87, 0x08, 0x00, 0x03, 0x4B,
+    0x80, 0x00, 0x02, 0x37, 0x80, 0x00, 0x20, 0x03, 0x00, 0x00, 0x01, 0x0B,
+    0x80, 0x00, 0x02, 0x03, 0x8A, 0x00, 0x20, 0x03, 0x00, 0x00, 0x20, 0x03,
+    0x41, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xC8 'È'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x08, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x44, 0x00, 0x00, 0x03, 0x20, 0x0F, 0xC7, 0xE3, 0x02, 0x08, 0x00, 0x03,
+    0x10, 0x08, 0x00, 0x03, 0x08, 0x08, 0x00, 0x03, 0x02, 0x08, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x42, 0x01, 0x07, 0x00, 0x00, 0x00, 0x43,
+    // 0xC9 'É'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x08, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x0A, 0x00, 0x00, 0x03, 0x02, 0x0F, 0xC7, 0xE3, 0x10, 0x08, 0x00, 0x03,
+    0x20, 0x08, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x40, 0x08, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x23, 0x10, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x42, 0x01, 0x07, 0x00, 0x00, 0x00, 0x43,
+    // 0xCA 'Ê'
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x27,
+    0x0C, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x44, 0x00, 0x00, 0x07, 0x08, 0x1F, 0x8F, 0xC7, 0x90, 0x10, 0x00, 0x07,
+    0x10, 0x10, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x40, 0x10, 0x00, 0x07,
+    0x20, 0x10, 0x00, 0x47, 0x10, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x84, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x87,
+    // 0xCB 'Ë'
+    0x01, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x20, 0x00, 0x4F,
+    0x50, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x1F, 0x8F, 0x00, 0x20, 0x00, 0x0F,
+    0x20, 0x20, 0x00, 0x0F, 0x88, 0x20, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x80, 0x20, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x0F, 0x20, 0x04, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x08, 0x04, 0x1F, 0x00, 0x00, 0x01, 0x0F,
+    // 0xCC 'Ì'
+    0x10, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x40, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x0A, 0x0F, 0xFF, 0xE3, 0x00, 0x10, 0x00, 0x13,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x60, 0x00, 0x07,
+    // 0xCD 'Í'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x44, 0x0F, 0xFF, 0xE3, 0x04, 0x10, 0x00, 0x13,
+    0x20, 0x10, 0x00, 0x03, 0x00, 0x60, 0x00, 0x07,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x80, 0x00, 0x17, 0x10, 0x00, 0x00, 0x27,
+    0x24, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x80, 0x1F, 0xFF, 0xC7,
+    0x44, 0x20, 0x00, 0x27, 0x24, 0x20, 0x00, 0x07, 0x1C, 0xC0, 0x00, 0x0F,
+    // 0xCF 'Ï'
+    0x20, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x4F,
+    0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xFF, 0x8F,
+    0x80, 0x40, 0x00, 0x4F, 0x08, 0x40, 0x00, 0x0F, 0x51, 0x80, 0x00, 0x1F,
+    // 0xD0 'Ð'
+    0x00, 0x10, 0x01, 0x00, 0x08, 0x09, 0x40, 0x08, 0x11, 0x08, 0x28, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x20, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+    0x08, 0x30, 0x21, 0x08, 0x00, 0x05, 0x44, 0x00, 0x05, 0x02, 0x00, 0x01,
+    0x01, 0x83, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x11, 0x10, 0x00, 0x21,
+    0x04, 0x00, 0x81, 0x02, 0x05, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x03, 0x40, 0x01, 0x00, 0x23, 0x04, 0x80, 0x40, 0x03,
+    0x80, 0x20, 0x00, 0x23, 0x00, 0x10, 0x00, 0x03, 0x48, 0x04, 0x00, 0x03,
+    0x04, 0x02, 0x02, 0x03, 0x00, 0x00, 0x80, 0x83, 0x04, 0x00, 0x00, 0x43,
+    0x00, 0x80, 0x00, 0x13, 0x60, 0x20, 0x00, 0x0B, 0x00, 0x1F, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x20, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x3A, 0x05,
+    0x20, 0x02, 0x00, 0x01, 0x04, 0x40, 0x00, 0x03, 0x44, 0x08, 0x00, 0x21,
+    0x20, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x01, 0x10, 0x80, 0x00, 0x01,
+    0x08, 0x88, 0x00, 0x03, 0x04, 0x80, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x41, 0x81, 0x85, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x3A, 0x05,
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x40, 0x00, 0x03, 0x0A, 0x08, 0x00, 0x21,
+    0x02, 0x80, 0x00, 0x01, 0x10, 0x80, 0x00, 0x01, 0x20, 0x80, 0x00, 0x01,
+    0x00, 0x88, 0x00, 0x03, 0x40, 0x80, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05,
+    0x10, 0x41, 0x81, 0x85, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD4 'Ô'
+    0x00, 0x01, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x83, 0x00, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x40, 0x00, 0x03, 0x0C, 0x00, 0x74, 0x0B,
+    0x10, 0x04, 0x00, 0x03, 0x20, 0x80, 0x00, 0x07, 0x04, 0x10, 0x00, 0x43,
+    0x09, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x03,
+    0x01, 0x10, 0x00, 0x07, 0x45, 0x00, 0x00, 0x03, 0x20, 0x08, 0x00, 0x0B,
+    0x10, 0x83, 0x03, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x04, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x01, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x83, 0x00, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x40, 0x00, 0x03, 0x10, 0x00, 0x74, 0x0B,
+    0x40, 0x04, 0x00, 0x03, 0x04, 0x80, 0x00, 0x07, 0x80, 0x10, 0x00, 0x43,
+    0x01, 0x00, 0x00, 0x03, 0x49, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x03,
+    0x01, 0x10, 0x00, 0x07, 0x05, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0B,
+    0x60, 0x83, 0x03, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x04, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x02, 0xF4, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x80, 0x00, 0x07, 0x50, 0x00, 0xE8, 0x17,
+    0x00, 0x08, 0x00, 0x07, 0x81, 0x00, 0x00, 0x0F, 0x08, 0x20, 0x00, 0x87,
+    0x22, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x22, 0x00, 0x00, 0x07,
+    0x8A, 0x20, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x07, 0x80, 0x10, 0x00, 0x17,
+    0x81, 0x06, 0x06, 0x17, 0x20, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x87, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x08, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xD7 '×'
+    0x10, 0x13, 0x08, 0x0B, 0x84, 0x03, 0x42, 0x03, 0x20, 0x03, 0x10, 0x03,
+    0x08, 0x43, 0x10, 0x23, 0x20, 0x13, 0x45, 0x0B, 0x08, 0x83, 0x50, 0x43,
+    0x20, 0x03,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x01, 0x00, 0xBE, 0x0B, 0x00, 0x00, 0x73, 0x08, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x32, 0x05, 0x02, 0x02, 0x01,
+    0x40, 0x04, 0x83, 0x08, 0x09, 0x21, 0x80, 0x12, 0x01, 0x80, 0x24, 0x01,
+    0x00, 0x48, 0x01, 0x88, 0x90, 0x03, 0x81, 0x00, 0x01, 0x06, 0x00, 0x45,
+    0x40, 0x81, 0x85, 0x40, 0x00, 0x09, 0x00, 0x00, 0x01, 0x20, 0x00, 0x21,
+    0x48, 0x00, 0x01, 0x80, 0x02, 0x01, 0x40, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0x50, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC1,
+    0x04, 0x00, 0x00, 0x23, 0x00, 0x60, 0x00, 0x01, 0x22, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x04, 0x40, 0x00, 0x23,
+    0x00, 0x10, 0x00, 0x41, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0xC1,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0xDA 'Ú'
+    0x00, 0x50, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC1,
+    0x06, 0x00, 0x00, 0x23, 0x0A, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x40, 0x00, 0x23,
+    0x44, 0x10, 0x00, 0x41, 0x18, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0xC1,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0xDB 'Û'
+    0x00, 0xA0, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x10, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x00, 0x47, 0x88, 0xC0, 0x00, 0x03, 0x90, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x03, 0x08, 0x80, 0x00, 0x47,
+    0x04, 0x20, 0x00, 0x83, 0x04, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x83,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x01, 0x40, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x3F, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x50, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0x07,
+    0x00, 0x00, 0x00, 0x8F, 0x01, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x8F,
+    0x80, 0x40, 0x01, 0x07, 0x08, 0x00, 0x02, 0x17, 0x20, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0xA0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x02, 0x27,
+    0x22, 0x00, 0x27, 0x02, 0x02, 0x07, 0x80, 0x00, 0x97, 0x08, 0x00, 0x07,
+    0x00, 0xA8, 0x87, 0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x02, 0x07,
+    0x02, 0x00, 0x07, 0x00, 0x90, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x41, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x90, 0x08, 0x01, 0x7F, 0x00, 0x41, 0x10, 0x7F, 0x10, 0x80, 0x00, 0xFF,
+    0x08, 0x00, 0x04, 0x7F, 0x86, 0x10, 0x44, 0xFF, 0x00, 0x00, 0x18, 0x7F,
+    0x00, 0x84, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x0E, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0xCC, 0x7F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x20, 0x01, 0x00, 0x3F, 0x40, 0x02, 0x00, 0x1F, 0x02, 0x24, 0x48, 0x3F,
+    0x20, 0x00, 0x01, 0x1F, 0x08, 0x00, 0x10, 0x5F, 0x01, 0x02, 0x12, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x1F, 0x04, 0x24, 0x48, 0x3F,
+    0x08, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x10, 0x5F, 0x02, 0x02, 0x12, 0x1F,
+    0x04, 0x00, 0x00, 0x9F, 0x18, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x0F, 0x3F, 0x00, 0x12, 0x00, 0x3F, 0x02, 0x00, 0x40, 0x3F,
+    0x08, 0x02, 0x00, 0x7F, 0x10, 0x04, 0x00, 0x3F, 0x00, 0x48, 0x90, 0x7F,
+    0x08, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x20, 0xBF, 0x88, 0x04, 0x24, 0x3F,
+    0x42, 0x00, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x7F, 0x00, 0x00, 0x02, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x1E, 0x7F, 0x00, 0x24, 0x00, 0x7F, 0x78, 0x00, 0x80, 0x7F,
+    0x00, 0x04, 0x00, 0xFF, 0x08, 0x08, 0x00, 0x7F, 0x10, 0x91, 0x20, 0xFF,
+    0x90, 0x00, 0x04, 0x7F, 0x08, 0x00, 0x41, 0x7F, 0x20, 0x08, 0x48, 0x7F,
+    0x40, 0x00, 0x02, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x40, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x05, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x3C, 0x20, 0x48, 0x00, 0x80, 0x01, 0x00, 0x80, 0x08, 0x01,
+    0x00, 0x10, 0x00, 0x11, 0x22, 0x41, 0x20, 0x00, 0x08, 0x00, 0x00, 0x82,
+    0x00, 0x10, 0x90, 0x80, 0x00, 0x04, 0x01, 0x00, 0x00, 0x80, 0x00, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+    // 0xE5 'å'
+    0x00, 0x00, 0x07, 0x9F, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F,
+    0x0C, 0x01, 0x00, 0x3F, 0x01, 0x02, 0x00, 0x1F, 0x04, 0xA4, 0x48, 0x3F,
+    0x00, 0x00, 0x01, 0x1F, 0x02, 0x00, 0x10, 0x5F, 0x1C, 0x82, 0x12, 0x1F,
+    0x41, 0x00, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0xE6 'æ'
+    0x00, 0x0F, 0x3F, 0x02, 0x20, 0xBF, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+    0x04, 0x80, 0x3F, 0x48, 0x90, 0x3F, 0x00, 0x22, 0x7F, 0x00, 0x00, 0x3F,
+    0x0D, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x01, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x40, 0x18, 0x3F, 0x49, 0x04, 0x7F, 0x01, 0x44, 0x7F,
+    0x00, 0x40, 0x3F, 0x08, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x00, 0x40, 0x3F,
+    0x00, 0x44, 0xBF, 0x20, 0x40, 0xBF, 0x07, 0x86, 0x3F,
+    // 0xE7 'ç'
+    0x01, 0x14, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x59, 0xFF,
+    0x08, 0x00, 0x48, 0x7F, 0x00, 0x04, 0x04, 0xFF, 0x08, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x04, 0x00, 0x7F,
+    0x20, 0x00, 0x80, 0x7F, 0x1C, 0x05, 0x00, 0x7F,
+    // 0xE8 'è'
+    0x00, 0x00, 0x86, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x30, 0x10, 0x00, 0x1F, 0x00, 0x21, 0x08, 0x1F, 0x00, 0x24, 0x00, 0x3F,
+    0x20, 0x00, 0x02, 0x3F, 0x01, 0x00, 0x00, 0x1F, 0x09, 0x00, 0x00, 0x1F,
+    0x02, 0x02, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x9F, 0x00, 0x01, 0x80, 0x1F,
+    // 0xE9 'é'
+    0x00, 0x00, 0x86, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x21, 0x08, 0x1F, 0x00, 0x24, 0x00, 0x3F,
+    0x09, 0x00, 0x02, 0x3F, 0x11, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x04, 0x02, 0x00, 0x3F, 0x48, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x9F, 0x00, 0x01, 0x80, 0x1F,
+    // 0xEA 'ê'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x06, 0x20, 0x00, 0x3F, 0x10, 0x42, 0x10, 0x3F, 0x20, 0x48, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x88, 0x00, 0x00, 0x3F,
+    0x40, 0x04, 0x00, 0x7F, 0x02, 0x40, 0x00, 0x7F, 0x12, 0x40, 0x00, 0x3F,
+    0x02, 0x00, 0x04, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x03, 0x00, 0x3F,
+    // 0xEB 'ë'
+    0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x80, 0x00,
+    0x01, 0x08, 0x40, 0x81, 0x20, 0x01, 0x70, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x10, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x80, 0x00, 0x10, 0x00, 0x40, 0x04, 0x00, 0x0C, 0x00,
+    // 0xEC 'ì'
+    0x00, 0x18, 0x00, 0x3F, 0x18, 0x00, 0x00, 0x3F, 0x04, 0x04, 0x01, 0x3F,
+    0x40, 0x20, 0x00, 0x3F, 0x02, 0x20, 0x00, 0x3F, 0x11, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xED 'í'
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x01, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x01, 0x20, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x42, 0x00, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEE 'î'
+    0x00, 0x30, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x02, 0x7F,
+    0x22, 0x40, 0x00, 0x7F, 0x04, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x12, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    // 0xEF 'ï'
+    0x00, 0xC0, 0x01, 0x80, 0x00, 0x01, 0x00, 0x20, 0x09, 0x81, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x30, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x01,
+    // 0xF0 'ð'
+    0x00, 0x01, 0x14, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x35, 0x40, 0x00, 0x3F, 0x41, 0x40, 0x10, 0x7F,
+    0x40, 0x08, 0x04, 0x7F, 0x02, 0x00, 0x02, 0x3F, 0x01, 0x00, 0x02, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x48, 0x06, 0x08, 0x3F, 0x14, 0x00, 0x00, 0xBF,
+    0x40, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x04, 0x28, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x04, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00,
+    0x10, 0x40, 0x04, 0x90, 0x90, 0x01, 0x40, 0x80, 0x00, 0x00, 0x10, 0x00,
+    0x20, 0x08, 0x04, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x8A, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x08, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x08, 0x3F,
+    0x42, 0x04, 0x02, 0x3F, 0x00, 0x00, 0x01, 0x1F, 0x09, 0x00, 0x01, 0x3F,
+    0x03, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x9F, 0x00, 0x08, 0x01, 0x1F,
+    0x00, 0x06, 0x0C, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x8A, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x08, 0x3F,
+    0x04, 0x04, 0x02, 0x3F, 0x19, 0x00, 0x01, 0x1F, 0x21, 0x00, 0x01, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x06, 0x1F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x9F, 0x00, 0x08, 0x01, 0x1F,
+    0x00, 0x06, 0x0C, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xF4 'ô'
+    0x00, 0x01, 0x14, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x10, 0x40, 0x10, 0x7F,
+    0x00, 0x08, 0x04, 0x7F, 0x00, 0x00, 0x02, 0x3F, 0x80, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x42, 0x00, 0x0C, 0x3F, 0x10, 0x40, 0x00, 0xBF,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x20, 0x01, 0x3F, 0x00, 0x10, 0x02, 0x3F,
+    0x00, 0x0C, 0x18, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xF5 'õ'
+    0x00, 0x02, 0x28, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x60, 0x40, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x18, 0x80, 0x20, 0xFF,
+    0x10, 0x10, 0x08, 0xFF, 0x80, 0x00, 0x04, 0x7F, 0x08, 0x00, 0x04, 0xFF,
+    0x20, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x18, 0x7F, 0x00, 0x80, 0x01, 0x7F,
+    0x10, 0x80, 0x00, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x00, 0x20, 0x04, 0x7F,
+    0x00, 0x18, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x04, 0x50, 0x00, 0x00, 0x08, 0x60, 0x40, 0x00, 0x00, 0x80, 0x00,
+    0x81, 0x00, 0x00, 0x81, 0x00, 0x41, 0x90, 0x20, 0x11, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x09, 0x90, 0x00, 0x01, 0x80, 0x00, 0x30, 0x01, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x40, 0x80, 0x04, 0x00, 0x40, 0x08, 0x00, 0x30, 0x60,
+    0x00, 0x00, 0x00,
+    // 0xF7 '÷'
+    0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x70, 0x3B,
+    0x80, 0x07, 0x00, 0x47, 0x80, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x3F, 0x01, 0x15, 0x3F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0xBF,
+    0x20, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x04, 0x00, 0x7F, 0x00, 0x08, 0x7F,
+    0x10, 0x10, 0x3F, 0x00, 0x20, 0x7F, 0x08, 0x42, 0x7F, 0x04, 0x80, 0x3F,
+    0x40, 0xE0, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x02, 0x3F,
+    0x0C, 0x18, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xF9 'ù'
+    0x00, 0x08, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x27, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x20, 0x20, 0x00, 0x1F,
+    0x40, 0x20, 0x00, 0x3F, 0x04, 0x2F, 0xF8, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x3F, 0x09, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    // 0xFA 'ú'
+    0x00, 0x08, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x27, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x2F, 0xF8, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x48, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    // 0xFB 'û'
+    0x00, 0x10, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x4F, 0xFC, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x02, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x7F, 0x02, 0x5F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x7F, 0x88, 0x00, 0x00, 0x3F, 0x44, 0x40, 0x00, 0x3F,
+    0x22, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x02, 0x40, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    // 0xFC 'ü'
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x01, 0x3F, 0xF0, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x00, 0x01, 0x81, 0x7F, 0xC0,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x80, 0x00, 0x04, 0x80, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04,
+    // 0xFE 'þ'
+    0x30, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B, 0x48, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x48, 0x00, 0x83, 0x00, 0x10, 0x04, 0x8B,
+    0x00, 0x80, 0x04, 0x0B, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x08, 0x81,
+    0x00, 0x02, 0x70, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x0B, 0x20, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x80, 0x00, 0x21, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x90, 0x03, 0x00, 0x21, 0x80, 0x00, 0xC0, 0x05,
+    0x00, 0x00, 0x00, 0x45, 0x10, 0x20, 0x00, 0x89, 0x60, 0x0C, 0x00, 0x01,
+    0x00, 0x81, 0x00, 0x01, 0x70, 0x00, 0x20, 0x01, 0x80, 0x01, 0x81, 0x01,
+    0x00, 0x40, 0x00, 0x01, 0x80, 0x40, 0x00, 0x01, 0x70, 0x00, 0x40, 0x01,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x01, 0x00, 0x00, 0x07, 0x0C, 0x08, 0x8C, 0x07,
+    0x00, 0x04, 0x80, 0x07, 0x01, 0x84, 0x80, 0x07, 0x03, 0x04, 0x80, 0x07,
+    0x80, 0x64, 0x80, 0x07, 0x80, 0x08, 0x80, 0x07, 0x00, 0x00, 0x10, 0x67,
+    0x0C, 0x00, 0x30, 0x07, 0x01, 0x80, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x01, 0x47, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x14, 0x07,
+    // 0x105 'ą'
+    0x00, 0x0F, 0x00, 0x12, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x40,
+    0x04, 0x00, 0x00, 0x48, 0x90, 0x40, 0x00, 0x02, 0x00, 0x00, 0x20, 0x80,
+    0x04, 0x24, 0x00, 0x00, 0x01, 0x08, 0x40, 0x00, 0x42, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x11, 0x07, 0xFC, 0x01, 0x00, 0x02, 0x81, 0x00, 0x01, 0x02,
+    // 0x106 'Ć'
+    0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x7A, 0x01,
+    0x00, 0x02, 0x00, 0x81, 0x04, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x03,
+    0x10, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x21, 0x20, 0x00, 0x00, 0x01,
+    0x44, 0x80, 0x00, 0x03, 0x04, 0x8A, 0x00, 0x21, 0x20, 0x00, 0x00, 0x21,
+    0x00, 0x41, 0x00, 0x01, 0x00, 0x42, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x107 'ć'
+    0x00, 0x00, 0x8A, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x3F,
+    0x09, 0x04, 0x00, 0x3F, 0x10, 0x00, 0x02, 0x1F, 0x02, 0x04, 0x00, 0x1F,
+    0x44, 0x02, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x02, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x0E, 0x02, 0x9F,
+    // 0x10C 'Č'
+    0x00, 0x01, 0x7C, 0x03, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03, 0x20, 0x00, 0xF4, 0x03,
+    0x00, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x83, 0x04, 0x10, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03,
+    0x09, 0x00, 0x00, 0x07, 0x91, 0x14, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43,
+    0x80, 0x82, 0x00, 0x03, 0x00, 0x84, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x10D 'č'
+    0x00, 0x01, 0x14, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x20, 0x10, 0x00, 0x3F,
+    0x90, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x10, 0x7F,
+    0x02, 0x08, 0x00, 0x7F, 0x02, 0x00, 0x04, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x40, 0x04, 0x00, 0x7F, 0x10, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x04, 0x3F,
+    0x40, 0x20, 0x00, 0xBF, 0x00, 0x1C, 0x05, 0x3F,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x80, 0x00, 0x23, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x43,
+    0x90, 0x10, 0x00, 0x0B, 0x20, 0x88, 0x00, 0x0B, 0x40, 0x04, 0x00, 0x03,
+    0x00, 0x03, 0x06, 0x03, 0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x08, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x10F 'ď'
+    0x00, 0x02, 0x10, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x80, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x4F, 0x0F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x39, 0x00, 0x02, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0x80, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x10, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x1F, 0x8F, 0xC0, 0x0F, 0x10, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x01, 0x4F, 0x10, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x04, 0x1F,
+    0x10, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x8F, 0x02, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x0F, 0x84, 0x02, 0x08, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+    // 0x119 'ę'
+    0x01, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x42, 0x10, 0x00, 0x48, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x40, 0x00, 0x21, 0x40, 0x00, 0x01,
+    0x00, 0x04, 0x01, 0x10, 0x01, 0x04, 0x03, 0x00, 0x00,
+    // 0x11A 'Ě'
+    0x00, 0x80, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x27,
+    0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x44, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x8F, 0xC7, 0x10, 0x10, 0x00, 0x07,
+    0x00, 0x10, 0x00, 0x07, 0x04, 0x10, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07,
+    0x00, 0x10, 0x00, 0x47, 0x80, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x84, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x87,
+    // 0x11B 'ě'
+    0x00, 0x01, 0x0C, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x3F,
+    0x80, 0x20, 0x00, 0x3F, 0x08, 0x42, 0x10, 0x3F, 0x04, 0x48, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x12, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x04, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x20, 0x40, 0x00, 0x3F,
+    0x40, 0x00, 0x04, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x03, 0x00, 0x3F,
+    // 0x139 'Ĺ'
+    0x00, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x02, 0x08, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x04, 0x0F, 0xFF, 0xE3, 0x44, 0x10, 0x00, 0x03,
+    0x10, 0x10, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE3,
+    // 0x13A 'ĺ'
+    0x00, 0x40, 0x00, 0x05, 0x08, 0x80, 0x00, 0x01, 0x04, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+    0x20, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x10, 0x00, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
+    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x38,
+    // 0x13E 'ľ'
+    0x20, 0x00, 0x02, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x80, 0x04, 0x17, 0x00, 0x04, 0x27,
+    0x10, 0x04, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0x1F, 0xC7, 0x20, 0x20, 0x07, 0x20, 0x40, 0x07,
+    0xC0, 0x40, 0x07, 0x00, 0x00, 0x07, 0x01, 0x80, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x03, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xC7,
+    // 0x142 'ł'
+    0x00, 0x00, 0x00, 0x20, 0x01, 0x02, 0x40, 0x04, 0x80, 0x40, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x04, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x11, 0x00, 0x40, 0x20, 0x01,
+    0x0A, 0x10, 0x00, 0x11, 0x02, 0x08, 0x00, 0x01, 0x10, 0x02, 0x00, 0x01,
+    0x20, 0x01, 0x01, 0x01, 0x00, 0x00, 0x40, 0x41, 0x40, 0x00, 0x00, 0x21,
+    0x00, 0x40, 0x00, 0x09, 0x10, 0x10, 0x00, 0x05, 0x00, 0x0F, 0xFC, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x144 'ń'
+    0x00, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x04, 0x01, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x10, 0x01, 0x3F,
+    0x01, 0x24, 0x00, 0x7F, 0x20, 0x20, 0x00, 0x3F, 0x40, 0x04, 0x00, 0x3F,
+    0x40, 0x02, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0xFF,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03, 0x80, 0x01, 0x00, 0x23, 0x00, 0x80, 0x40, 0x03,
+    0x44, 0x20, 0x00, 0x23, 0x00, 0x10, 0x00, 0x03, 0x10, 0x04, 0x00, 0x03,
+    0x00, 0x02, 0x02, 0x03, 0x04, 0x00, 0x80, 0x83, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x80, 0x00, 0x13, 0x80, 0x20, 0x00, 0x0B, 0x00, 0x1F, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x20, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x148 'ň'
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x08, 0x02, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x90, 0x00, 0x00, 0x7F, 0x80, 0x20, 0x00, 0x7F, 0x40, 0x20, 0x02, 0x7F,
+    0x12, 0x48, 0x00, 0xFF, 0x02, 0x40, 0x00, 0x7F, 0x20, 0x08, 0x00, 0x7F,
+    0x04, 0x04, 0x02, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0xFF,
+    // 0x152 'Œ'
+    0x01, 0x7A, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x13, 0x00, 0x86, 0x03, 0x00, 0x01, 0x03, 0x80, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x90, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x1F, 0xFF, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x10, 0x00, 0x03, 0x10, 0x00, 0x03, 0x00, 0x00, 0x43,
+    0x08, 0x00, 0xC3, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x78, 0x00, 0x1B,
+    0x00, 0x00, 0x03,
+    // 0x153 'œ'
+    0x01, 0x14, 0x3F, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x10, 0x7F, 0x08, 0x04, 0x7F, 0x00, 0x02, 0x3F,
+    0x00, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x01, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x42, 0x10, 0x3F,
+    0x48, 0x00, 0x3F, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x04, 0x3F,
+    0x10, 0x01, 0x3F, 0x03, 0x00, 0x3F,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x80, 0x00, 0x23, 0x00, 0x90, 0x00, 0x23,
+    0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x23,
+    0x20, 0x00, 0x40, 0x23, 0x08, 0x10, 0x41, 0x03, 0x90, 0x10, 0x80, 0x43,
+    0x20, 0x05, 0x00, 0x23, 0x40, 0x00, 0x14, 0x03, 0x00, 0x00, 0x20, 0x0B,
+    0x00, 0x40, 0x40, 0x03, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x159 'ř'
+    0x00, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x02, 0x7F,
+    0x20, 0x40, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x22, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F, 0x12, 0x00, 0x02, 0x7F,
+    0x42, 0x44, 0x02, 0x7F, 0x88, 0x40, 0x01, 0xFF, 0x10, 0x04, 0x00, 0x7F,
+    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x78, 0x00, 0x7F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x41, 0x05, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x23, 0x04, 0x04, 0x00, 0x01,
+    0x02, 0x08, 0x00, 0x11, 0x00, 0x80, 0x80, 0x11, 0x22, 0x10, 0x00, 0x11,
+    0x00, 0x80, 0x40, 0x03, 0x04, 0x80, 0x00, 0x01, 0x40, 0x03, 0x20, 0x01,
+    0x28, 0x00, 0x10, 0x01, 0x00, 0x41, 0x00, 0x01, 0x00, 0x04, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x08, 0x48, 0x5F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x20, 0x06, 0x3F, 0x00, 0x20, 0x01, 0x3F, 0x04, 0x00, 0x01, 0x3F,
+    0x01, 0x00, 0x08, 0x1F, 0x42, 0x00, 0x09, 0x3F, 0x00, 0x08, 0x83, 0x1F,
+    0x48, 0x02, 0x80, 0x1F, 0x00, 0x20, 0x40, 0x5F, 0x00, 0x21, 0x00, 0x9F,
+    0x00, 0x02, 0x13, 0x1F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x82, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x90, 0x00, 0x01, 0x03, 0x88, 0x00, 0x00, 0x47, 0x44, 0x08, 0x00, 0x03,
+    0x20, 0x10, 0x00, 0x23, 0x01, 0x01, 0x00, 0x23, 0x20, 0x20, 0x00, 0x23,
+    0x41, 0x00, 0x80, 0x07, 0x81, 0x00, 0x00, 0x03, 0x10, 0x06, 0x40, 0x03,
+    0xA0, 0x00, 0x20, 0x03, 0x40, 0x82, 0x00, 0x03, 0x00, 0x08, 0x08, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x161 'š'
+    0x00, 0x00, 0x08, 0x3F, 0x40, 0x10, 0x90, 0xBF, 0x80, 0x00, 0x40, 0x3F,
+    0x08, 0x40, 0x0C, 0x7F, 0x04, 0x40, 0x02, 0x7F, 0x20, 0x00, 0x02, 0x7F,
+    0x12, 0x00, 0x10, 0x3F, 0x02, 0x00, 0x12, 0x7F, 0x44, 0x11, 0x06, 0x3F,
+    0x08, 0x05, 0x00, 0x3F, 0x20, 0x40, 0x80, 0xBF, 0x00, 0x42, 0x01, 0x3F,
+    0x00, 0x04, 0x26, 0x3F,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x07, 0xE0, 0x10, 0x00, 0x17,
+    0x80, 0x10, 0x00, 0x27, 0x80, 0x10, 0x00, 0x27, 0x40, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x10, 0x00, 0x27,
+    0x80, 0x10, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x90, 0x00, 0x7F,
+    0x01, 0x90, 0x04, 0x7F, 0x04, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x90, 0x18, 0x7F,
+    0x00, 0x10, 0x00, 0xFF, 0x82, 0x10, 0x00, 0xFF, 0x80, 0x10, 0x08, 0x7F,
+    0x10, 0x80, 0x09, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x50, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0xC1,
+    0x00, 0x00, 0x00, 0x23, 0x18, 0x60, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x23,
+    0x24, 0x10, 0x00, 0x41, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0xC1,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x08, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x27, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x21, 0x20, 0x00, 0x3F, 0x40, 0x2F, 0xF8, 0x1F, 0x44, 0x80, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x1F, 0x4C, 0x20, 0x00, 0x1F,
+    0x01, 0x00, 0x00, 0x9F, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    // 0x170 'Ű'
+    0x00, 0x50, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0xC1,
+    0x10, 0x00, 0x00, 0x23, 0x00, 0x60, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x04, 0x40, 0x00, 0x23,
+    0x00, 0x10, 0x00, 0x41, 0x22, 0x00, 0x00, 0x85, 0x44, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x11, 0x10, 0x00, 0x01, 0xC1,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x08, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x27, 0xFE, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x0D, 0x20, 0x00, 0x3F, 0x20, 0x2F, 0xF8, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x1F, 0x03, 0x20, 0x00, 0x1F,
+    0x30, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x00, 0x3F,
+    0x18, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    // 0x178 'Ÿ'
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x0F, 0x50, 0x02, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x20, 0x0F, 0x08, 0x40, 0x10, 0x0F,
+    0x20, 0x40, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x0F, 0x50, 0x00, 0x80, 0x0F,
+    0x88, 0x83, 0x00, 0x0F, 0x01, 0x0C, 0x1F, 0x8F, 0x00, 0x70, 0x00, 0x4F,
+    0x80, 0x01, 0x00, 0x0F, 0x20, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F,
+    0x01, 0x00, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x06, 0x04, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x06, 0x08, 0x00, 0x21, 0x0A, 0x08, 0x00, 0x41, 0x00, 0x08, 0x81, 0x01,
+    0x02, 0x0A, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
+    0x44, 0x00, 0x20, 0x01, 0x18, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x44, 0x00, 0x01, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x21,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x11, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x0D, 0x04, 0x82, 0x1F, 0x11, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x08, 0x1F,
+    0x04, 0x00, 0x20, 0x1F, 0x48, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x80, 0x1F,
+    0x00, 0x01, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x10, 0x06, 0x9F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x43, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x02, 0x03, 0x00, 0x0C, 0x08, 0x03, 0x00, 0x10, 0x00, 0x03,
+    0x20, 0x10, 0x00, 0x43, 0x40, 0x10, 0x00, 0x83, 0x00, 0x11, 0x02, 0x03,
+    0x80, 0x14, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x40, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x88, 0x00, 0x03, 0x00, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x43,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x44, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x78, 0x10, 0x00, 0x7F,
+    0x00, 0x12, 0x08, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x20, 0x7F,
+    0x40, 0x00, 0x80, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x40, 0x1A, 0x7F,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x43, 0x00, 0x00, 0x01, 0x03,
+    0x40, 0x00, 0x02, 0x03, 0x90, 0x0C, 0x08, 0x03, 0x88, 0x10, 0x00, 0x03,
+    0x40, 0x10, 0x00, 0x43, 0x20, 0x10, 0x00, 0x83, 0x00, 0x11, 0x02, 0x03,
+    0x20, 0x14, 0x00, 0x03, 0x44, 0x18, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x40, 0x03, 0xA0, 0x01, 0x00, 0x03, 0x40, 0x02, 0x00, 0x03,
+    0x00, 0x88, 0x00, 0x03, 0x00, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x43,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x22, 0x00, 0x3F, 0x40, 0x00, 0x08, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x40, 0x3F, 0x04, 0x08, 0x00, 0x3F,
+    0x20, 0x09, 0x04, 0x3F, 0x12, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x10, 0x3F,
+    0x40, 0x00, 0x40, 0x3F, 0x08, 0x00, 0x80, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x40, 0x02, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x0D, 0x3F,
+    // 0x3C0 'π'
+    0x0A, 0x00, 0x3F, 0x60, 0x00, 0x3F, 0x01, 0x00, 0x3F, 0x04, 0x01, 0xBF,
+    0x00, 0x14, 0x3F, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF,
+    0x00, 0x0D, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x03, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x41, 0xF0, 0x7F,
+    0x40, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x10, 0x02, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x02, 0xFF, 0xE1,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x20, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x06, 0x00, 0x01, 0x00, 0x00, 0x71, 0x80, 0x00, 0x01, 0x90, 0x71, 0x01,
+    0x90, 0x88, 0x43, 0x80, 0x08, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x40, 0x82, 0x01, 0x40, 0x01, 0x41, 0x28, 0x00, 0x05, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x09, 0x00, 0x06, 0x01,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    // 0x2018 '‘'
+    0x0C, 0x9F, 0x30, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x5F, 0x40, 0x1F,
+    // 0x2019 '’'
+    0x00, 0x1F, 0x00, 0x5F, 0x42, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F,
+    0x10, 0x1F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x00, 0x3F, 0x14, 0x7F, 0x00, 0x3F, 0x01, 0x3F, 0x86, 0x3F,
+    0x10, 0x3F,
+    // 0x201B '‛'
+    0x26, 0x1F, 0x01, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x50, 0x1F, 0x00, 0x5F,
+    // 0x201C '“'
+    0x0C, 0x9F, 0x30, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x5F, 0x40, 0x1F,
+    0x0C, 0x9F, 0x30, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x5F, 0x40, 0x1F,
+    // 0x201D '”'
+    0x00, 0x1F, 0x00, 0x5F, 0x42, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F,
+    0x10, 0x1F, 0x00, 0x5F, 0x42, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x1F,
+    0x10, 0x1F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x00, 0x3F, 0x14, 0x7F, 0x00, 0x3F, 0x01, 0x3F, 0x86, 0x3F,
+    0x10, 0x3F, 0x00, 0x3F, 0x14, 0x7F, 0x00, 0x3F, 0x01, 0x3F, 0x86, 0x3F,
+    0x10, 0x3F,
+    // 0x201F '‟'
+    0x26, 0x1F, 0x01, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x50, 0x1F, 0x00, 0x5F,
+    0x26, 0x1F, 0x01, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x50, 0x1F, 0x00, 0x5F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x02, 0x00, 0x0F, 0x68, 0x03, 0x9F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x10, 0x00, 0x7F, 0x02, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x04, 0x40, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x20,
+    0x02, 0x01, 0x00, 0x58, 0x18, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x18, 0x08, 0x02, 0x01, 0x00, 0x00, 0x40, 0x20,
+    0x04, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,
+    // 0x2022 '•'
+    0x38, 0x02, 0x00, 0x01, 0x00, 0x42, 0x18,
+    // 0x2026 '…'
+    0x1B, 0x07, 0x03, 0x83, 0x03, 0x7B, 0x03, 0x03, 0x03, 0x03, 0x1B, 0x07,
+    0x03, 0x83, 0x03, 0x7B, 0x03, 0x03, 0x03, 0x03, 0x1B, 0x07, 0x03, 0x83,
+    0x03, 0x1B,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x09, 0x0F, 0x00, 0x8F, 0x00, 0x0F, 0x20, 0x0F, 0x06, 0x1F,
+    0x00, 0x9F, 0x90, 0x4F, 0x00, 0x1F,
+    // 0x203A '›'
+    0x20, 0x0F, 0x90, 0x0F, 0x00, 0x9F, 0x06, 0x0F, 0x20, 0x2F, 0x00, 0x0F,
+    0x00, 0x8F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2070 '⁰'
+    0x03, 0x81, 0x00, 0x01, 0x20, 0x01, 0x40, 0x05, 0x83, 0x81, 0x00, 0x11,
+    0x80, 0x01, 0x80, 0x11, 0x18, 0x61, 0x80, 0x01, 0x40, 0x09, 0x20, 0x01,
+    0x07, 0x81,
+    // 0x2074 '⁴'
+    0x00, 0x01, 0x00, 0x81, 0x00, 0x11, 0x04, 0x11, 0x08, 0x11, 0x02, 0x11,
+    0x40, 0x11, 0x00, 0x11, 0x80, 0x03, 0x00, 0x03, 0x80, 0x01, 0x00, 0x11,
+    0x00, 0x71,
+    // 0x2075 '⁵'
+    0x00, 0x01, 0x00, 0x15, 0x31, 0x11, 0x81, 0x13, 0x80, 0x03, 0x80, 0x11,
+    0x94, 0x01, 0x90, 0x01, 0x90, 0x01, 0x92, 0x01, 0x40, 0xA1,
+    // 0x2076 '⁶'
+    0x01, 0x21, 0x08, 0x09, 0x10, 0x05, 0x20, 0x01, 0x40, 0x21, 0x0D, 0x13,
+    0x84, 0x13, 0x14, 0x61, 0x80, 0x05, 0x00, 0x01, 0x61, 0x11, 0x00, 0x01,
+    // 0x2077 '⁷'
+    0x00, 0x01, 0x84, 0x01, 0x80, 0x01, 0x90, 0x65, 0x91, 0x83, 0x90, 0x03,
+    0x98, 0x09, 0x90, 0x81, 0x82, 0x01, 0x84, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x41, 0x00, 0x81, 0x00, 0x05, 0x00, 0x21, 0x10, 0x81, 0x80, 0x83,
+    0x80, 0x01, 0x08, 0x71, 0x82, 0x05, 0x40, 0x01, 0x30, 0x11,
+    // 0x2079 '⁹'
+    0x12, 0x09, 0x01, 0x05, 0x00, 0x81, 0x80, 0x03, 0x10, 0x41, 0x80, 0x41,
+    0x80, 0x41, 0x88, 0x01, 0x00, 0x01, 0x40, 0x21, 0x10, 0xC1, 0x00, 0x01,
+    // 0x2080 '₀'
+    0x03, 0xC1, 0x00, 0x11, 0x20, 0x01, 0x40, 0x05, 0x03, 0xA1, 0x10, 0x13,
+    0x00, 0x13, 0x00, 0x03, 0x08, 0x01, 0x00, 0x01, 0x40, 0x01, 0x00, 0x11,
+    0x07, 0x81,
+    // 0x2081 '₁'
+    0x30, 0x0B, 0x00, 0x03, 0x48, 0x13, 0x4F, 0xE3, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x13, 0x00, 0x0B,
+    // 0x2082 '₂'
+    0x18, 0x1B, 0x04, 0x27, 0x40, 0x03, 0x00, 0x43, 0x00, 0x83, 0x01, 0x23,
+    0x16, 0x03, 0x80, 0x03, 0x00, 0x83, 0x01, 0x03, 0x38, 0x03, 0x00, 0x1B,
+    // 0x2083 '₃'
+    0x00, 0x09, 0x40, 0x11, 0x08, 0x13, 0x82, 0x13, 0x00, 0x83, 0x24, 0x91,
+    0x18, 0x01, 0x80, 0x01, 0x00, 0x01, 0x01, 0x09, 0x10, 0x41,
+    // 0x2084 '₄'
+    0x00, 0x01, 0x00, 0x81, 0x00, 0x11, 0x04, 0x01, 0x00, 0x81, 0x12, 0x01,
+    0x40, 0x01, 0x00, 0x13, 0x80, 0x03, 0x00, 0x03, 0x80, 0x11, 0x00, 0x01,
+    0x00, 0x71,
+    // 0x2085 '₅'
+    0x00, 0x01, 0x00, 0x15, 0x30, 0x13, 0x80, 0x13, 0x81, 0x13, 0x80, 0x11,
+    0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x82, 0x01, 0x40, 0xA1,
+    // 0x2086 '₆'
+    0x01, 0x21, 0x08, 0x09, 0x00, 0x05, 0x00, 0x01, 0x40, 0x23, 0x0C, 0x13,
+    0x85, 0x13, 0x10, 0x61, 0x04, 0x01, 0x20, 0x05, 0x41, 0x09, 0x00, 0x01,
+    // 0x2087 '₇'
+    0x00, 0x01, 0x04, 0x01, 0x84, 0x01, 0x80, 0x61, 0x80, 0x83, 0x80, 0x03,
+    0x80, 0x09, 0x90, 0xC1, 0x82, 0x01, 0x84, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x41, 0x04, 0x85, 0x02, 0x01, 0x00, 0x21, 0x18, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x08, 0x71, 0x00, 0x05, 0x01, 0x01, 0x30, 0x91,
+    // 0x2089 '₉'
+    0x12, 0x09, 0x20, 0x01, 0x40, 0x83, 0x80, 0x13, 0x00, 0x51, 0x00, 0x01,
+    0x11, 0x41, 0x88, 0x01, 0x00, 0x01, 0x00, 0x21, 0x00, 0xC1, 0x00, 0x01,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0x00, 0x04, 0x03, 0x00, 0xA0, 0x03, 0x00, 0x30, 0x03, 0x00, 0x01, 0x83,
+    0x04, 0x00, 0x23, 0x10, 0x00, 0x13, 0x20, 0x00, 0x03, 0x01, 0x30, 0x03,
+    0x44, 0x30, 0x83, 0x08, 0x30, 0x43, 0x80, 0x30, 0x47, 0x80, 0x30, 0x03,
+    0x90, 0x34, 0x03, 0x80, 0x00, 0x07, 0x90, 0x00, 0x07, 0x02, 0x00, 0x03,
+    0x80, 0x00, 0x43, 0x04, 0x00, 0x53, 0x60, 0x00, 0x03,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0x00, 0x1F, 0x90, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x3F, 0x9F, 0x00, 0x9F, 0x00, 0x1F, 0x80, 0x1F, 0x00, 0x5F,
+    0xC0, 0x1F, 0x0C, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x1F, 0x20, 0x9F,
+    0x08, 0x1F, 0x02, 0x1F, 0x88, 0x9F, 0x00, 0x1F, 0x00, 0x1F, 0x46, 0x1F,
+    0x00, 0xDF,
+    // 0x2153 '⅓'
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x06, 0x3F, 0x00, 0x01, 0x08, 0xBF,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x82, 0x3F, 0x00, 0x01, 0x0C, 0x3F,
+    0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x04, 0x10, 0x00, 0x3F, 0x18, 0x40, 0x00, 0x3F,
+    0x60, 0x88, 0x02, 0x3F, 0x40, 0x20, 0x00, 0x3F, 0x48, 0x00, 0x81, 0x3F,
+    0x00, 0x40, 0x08, 0x3F, 0x00, 0x40, 0x49, 0x3F, 0x00, 0x02, 0x49, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x04, 0x3F, 0x00, 0x00, 0x50, 0x3F,
+    // 0x2154 '⅔'
+    0x06, 0x06, 0x00, 0x3F, 0x10, 0x08, 0x00, 0x3F, 0x01, 0x11, 0x00, 0x3F,
+    0x21, 0x01, 0x00, 0x3F, 0x24, 0x01, 0x00, 0x3F, 0x20, 0x49, 0x00, 0x3F,
+    0x21, 0x11, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x01, 0x3F,
+    0x10, 0x01, 0x08, 0x3F, 0x0F, 0x00, 0x10, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x06, 0x00, 0x3F, 0x00, 0x08, 0x40, 0x3F,
+    0x00, 0x01, 0x80, 0x3F, 0x00, 0x06, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x88, 0x02, 0x3F, 0x43, 0x20, 0x00, 0x3F,
+    0x44, 0x00, 0x81, 0x3F, 0x20, 0x40, 0x08, 0x3F, 0x00, 0x40, 0x49, 0x3F,
+    0x00, 0x02, 0x49, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x04, 0x3F, 0x00, 0x00, 0x50, 0x3F,
+    // 0x215B '⅛'
+    0x08, 0x00, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x20, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x08, 0x3F,
+    0x00, 0x02, 0x10, 0x3F, 0x00, 0x00, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x08, 0x40, 0x3F, 0x00, 0x21, 0x00, 0x3F,
+    0x00, 0x06, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x1C, 0x3F, 0x02, 0x02, 0x42, 0x3F, 0x44, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x01, 0x3F, 0x00, 0x44, 0x01, 0x3F, 0x00, 0x02, 0x44, 0x3F,
+    0x00, 0x10, 0x01, 0x3F, 0x00, 0x4C, 0x08, 0x3F, 0x00, 0x00, 0x82, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x68, 0x3F,
+    // 0x215C '⅜'
+    0x00, 0x02, 0x00, 0x3F, 0x02, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0x3F, 0x28, 0x04, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x24, 0x21, 0x00, 0x3F, 0x00, 0x01, 0x01, 0x3F, 0x20, 0x80, 0x00, 0xBF,
+    0x11, 0x00, 0x10, 0xBF, 0x04, 0x10, 0x20, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x10, 0x80, 0x3F,
+    0x00, 0x42, 0x00, 0x3F, 0x01, 0x0C, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x1C, 0x3F, 0x46, 0x02, 0x42, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x01, 0x3F, 0x00, 0x44, 0x01, 0x3F,
+    0x00, 0x02, 0x44, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x4C, 0x08, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x68, 0x3F,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x2C, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3F, 0x04, 0x40, 0x00, 0x3F,
+    0x04, 0x21, 0x00, 0x3F, 0x05, 0x01, 0x03, 0x3F, 0x04, 0x02, 0x04, 0xBF,
+    0x04, 0x84, 0x00, 0x3F, 0x10, 0x28, 0x41, 0x3F, 0x00, 0x00, 0x84, 0x3F,
+    0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x20, 0x80, 0x3F,
+    0x00, 0x80, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x0C, 0x20, 0x00, 0x3F,
+    0x30, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x1C, 0x3F, 0x00, 0x02, 0x42, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x44, 0x01, 0x3F,
+    0x00, 0x02, 0x44, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x4C, 0x08, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x68, 0x3F,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x00, 0x3F, 0x21, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x06, 0x19, 0x00, 0x3F, 0x04, 0x40, 0x00, 0x3F, 0x04, 0x80, 0x00, 0x3F,
+    0x06, 0x0A, 0x03, 0x3F, 0x04, 0x00, 0x04, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x41, 0x3F, 0x20, 0x01, 0x04, 0x3F, 0x00, 0x02, 0x18, 0x3F,
+    0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x80, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x08, 0x20, 0x00, 0x3F, 0x30, 0xC0, 0x00, 0x3F,
+    0x41, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1C, 0x3F, 0x10, 0x02, 0x42, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x44, 0x01, 0x3F,
+    0x00, 0x02, 0x44, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x4C, 0x08, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x68, 0x3F,
+    // 0x2190 '←'
+    0x00, 0x01, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x04, 0x01,
+    0x40, 0x21, 0x48, 0x05, 0x30, 0x19, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x01,
+    // 0x2191 '↑'
+    0x04, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x3F, 0xEF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x00, 0x01, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x20, 0x19,
+    0x48, 0x01, 0x40, 0x21, 0x24, 0x41, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+    0x02, 0x01, 0x00, 0x01,
+    // 0x2193 '↓'
+    0x00, 0x04, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x11, 0x0F, 0x00, 0x08, 0x8F,
+    0x00, 0x04, 0x4F, 0xFF, 0xE2, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x7F, 0x82, 0x2F, 0x00, 0x04, 0x4F, 0x00, 0x08, 0x8F, 0x00, 0x11, 0x0F,
+    0x00, 0x0A, 0x0F, 0x00, 0x04, 0x0F,
+    // 0x2194 '↔'
+    0x02, 0x07, 0x00, 0x87, 0x00, 0x47, 0x00, 0x27, 0x00, 0x17, 0x00, 0x8F,
+    0x90, 0x07, 0x40, 0x27, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x40, 0x27, 0x90, 0x07, 0x00, 0x0F, 0x00, 0x17, 0x00, 0x27, 0x00, 0x47,
+    0x00, 0x87, 0x02, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x07, 0x00, 0x04, 0x87, 0x10, 0x04, 0x47,
+    0x22, 0x00, 0x07, 0x44, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x44, 0x00, 0x07, 0x22, 0x00, 0x07, 0x11, 0x00, 0x47, 0x00, 0x04, 0x87,
+    0x00, 0x03, 0x07, 0x00, 0x00, 0x07,
+    // 0x21D0 '⇐'
+    0x00, 0x80, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x7F,
+    0x01, 0x04, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x41, 0x7F, 0x04, 0x48, 0xFF,
+    0x00, 0x44, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x40, 0x7F, 0x06, 0x30, 0x7F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x0F, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D2 '⇒'
+    0x06, 0x30, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x40, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x44, 0x7F,
+    0x04, 0x48, 0xFF, 0x00, 0x41, 0x7F, 0x00, 0x42, 0x7F, 0x01, 0x04, 0x7F,
+    0x00, 0x08, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x80, 0x7F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x1F, 0x00, 0x18, 0x1F, 0x00, 0x24, 0x1F, 0x00, 0x22, 0x1F,
+    0x00, 0x11, 0x1F, 0x3E, 0x08, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x01, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x3E, 0x08, 0x9F, 0x00, 0x11, 0x1F, 0x00, 0x22, 0x1F, 0x00, 0x24, 0x1F,
+    0x00, 0x18, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D4 '⇔'
+    0x01, 0x01, 0x00, 0x41, 0x00, 0x21, 0x00, 0x11, 0x02, 0x89, 0x40, 0x85,
+    0x80, 0x81, 0x98, 0x93, 0x48, 0x8D, 0x08, 0x81, 0x08, 0x81, 0x48, 0x89,
+    0x88, 0x91, 0x80, 0x83, 0x00, 0x85, 0x02, 0x89, 0x00, 0x11, 0x00, 0x21,
+    0x00, 0x41, 0x01, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x10, 0x01, 0x7F, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x01, 0x00, 0xFF,
+    0x10, 0x08, 0x04, 0xFF, 0x90, 0x90, 0x00, 0x7F, 0x10, 0x10, 0x00, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x88, 0x80, 0xC2, 0x7F, 0x02, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x05, 0xE4, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x63, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x00, 0xD3, 0x06, 0x00, 0x13, 0x00, 0x18, 0x13,
+    0x40, 0xC0, 0x13, 0x00, 0x00, 0x13, 0x01, 0x80, 0x13, 0x80, 0x30, 0x13,
+    0x80, 0x06, 0x13, 0x30, 0x00, 0xD3, 0x06, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x0F,
+    // 0x220F '∏'
+    0x80, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x10, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFC, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x40, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x08, 0x3F, 0x84, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x80, 0x7F, 0x00, 0x20, 0x04, 0x7F,
+    0x10, 0x12, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x18, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x0C, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x20, 0x3F, 0x3C, 0x00, 0x02, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x221A '√'
+    0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x07,
+    0x00, 0x01, 0x80, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x06, 0x07,
+    0x00, 0x08, 0x00, 0x87, 0x00, 0x02, 0x80, 0x0F, 0x00, 0x00, 0x28, 0x07,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x40, 0x17,
+    0x00, 0x08, 0x00, 0x07, 0x00, 0x60, 0x10, 0x07, 0x01, 0x00, 0xC0, 0x07,
+    0x20, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x16, 0x1F, 0x40, 0x1F, 0x00, 0x3F, 0x04, 0x3F, 0x91, 0x3F, 0x91, 0x3F,
+    0x10, 0x3F, 0x04, 0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x42, 0x1F,
+    0x91, 0x1F, 0x81, 0x3F, 0x11, 0x3F, 0x8E, 0x1F, 0x80, 0x1F, 0x40, 0x9F,
+    0x0E, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x87, 0xFF, 0xFF, 0xA0, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    // 0x2260 '≠'
+    0x0C, 0x70, 0x12, 0x40, 0x12, 0x44, 0x12, 0x42, 0x12, 0x42, 0x12, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x00, 0x40, 0x40, 0x40, 0x02, 0x40, 0x52, 0x40,
+    0x12, 0x40, 0x10, 0x40,
+    // 0x2264 '≤'
+    0x02, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x48, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x20, 0x3F, 0x40, 0x10, 0x3F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0xFF, 0x70, 0x14, 0x1F, 0x00, 0x00, 0x1F, 0x48, 0x24, 0x1F,
+    0x00, 0x20, 0x1F, 0x04, 0x48, 0x1F, 0x00, 0x48, 0x1F, 0x02, 0x10, 0x1F,
+    0x00, 0x90, 0x1F, 0x01, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x80, 0x1F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BoldBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x20, 0x78, 0x0C, 0x00, 0x00, 0x10, 0x80, 0x00, 0x01, 0x80, 0x00, 0x81,
+    0x1C, 0x00, 0x10, 0x00, 0x00, 0x0C,
+    // 0x22 '"'
+    0x3F, 0x1F, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x5F, 0x60, 0x1F, 0x00, 0x1F,
+    0x43, 0xDF, 0x00, 0x1F, 0x80, 0x5F, 0x81, 0x9F, 0x00, 0x1F,
+    // 0x23 '#'
+    0x00, 0x06, 0x0F, 0x00, 0x02, 0x0F, 0x04, 0x02, 0x6F, 0x04, 0x00, 0x0F,
+    0x04, 0x60, 0x0F, 0x04, 0x00, 0x2F, 0x60, 0x00, 0x0F, 0x00, 0x62, 0x0F,
+    0x00, 0x02, 0x0F, 0x64, 0x02, 0x8F, 0x04, 0x00, 0x0F, 0x04, 0x80, 0x0F,
+    0x18, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x00, 0x82, 0x0F, 0x0C, 0x02, 0x0F,
+    0x04, 0x0C, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x24 '$'
+    0x00, 0x00, 0x3C, 0x03, 0x01, 0x10, 0x42, 0x03, 0x02, 0x04, 0x00, 0x03,
+    0x04, 0x00, 0x11, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x08, 0x00, 0x04, 0x03,
+    0x00, 0x70, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x83,
+    0x00, 0x00, 0x00, 0x03, 0x09, 0x00, 0x49, 0x03, 0x08, 0xC0, 0x00, 0x03,
+    0x00, 0x02, 0x02, 0x03, 0x00, 0x41, 0x04, 0x03, 0x01, 0x00, 0x70, 0x03,
+    // 0x25 '%'
+    0x03, 0xE0, 0x00, 0x7F, 0x08, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x21, 0xC0, 0x00, 0x7F, 0x08, 0x02, 0x00, 0x7F, 0x00, 0x0A, 0x00, 0x7F,
+    0x08, 0x02, 0x02, 0x7F, 0x04, 0x20, 0x09, 0x7F, 0x20, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x08, 0x11, 0x08, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x21, 0x00, 0x7F, 0x00, 0x84, 0x00, 0x7F,
+    0x02, 0x10, 0x00, 0x7F, 0x08, 0x02, 0x08, 0x7F, 0x20, 0x88, 0x00, 0x7F,
+    0x02, 0x10, 0x00, 0x7F, 0x48, 0x02, 0x10, 0x7F, 0x20, 0x00, 0x01, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x04, 0x08, 0x7F, 0x00, 0x01, 0xE0, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x03, 0xE0, 0x7F,
+    // 0x26 '&'
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x21, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x07, 0x00, 0x05, 0x00, 0x04, 0x41, 0x40, 0x08, 0x01, 0x00, 0x04, 0x11,
+    0x8B, 0x00, 0x11, 0x80, 0x20, 0x03, 0x00, 0x90, 0x03, 0x01, 0x40, 0x11,
+    0x8C, 0x00, 0x01, 0x00, 0x80, 0x01, 0x41, 0x08, 0x05, 0x1C, 0x08, 0x81,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x08, 0x01,
+    0x00, 0x08, 0x03, 0x00, 0x30, 0x11, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01,
+    // 0x27 '''
+    0x3F, 0x1F, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x5F, 0x60, 0x1F,
+    // 0x28 '('
+    0x00, 0x1F, 0xC0, 0x03, 0x00, 0x80, 0x04, 0x03, 0x00, 0x00, 0x01, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x00, 0x20, 0x20, 0x23, 0x01, 0x00, 0x04, 0x13,
+    0x04, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x33, 0x90, 0x00, 0x00, 0x43,
+    0x80, 0x00, 0x00, 0x0B, 0x42, 0x00, 0x02, 0x03, 0x20, 0x40, 0x18, 0x23,
+    0x10, 0x00, 0x00, 0x43, 0x04, 0x00, 0x01, 0x03, 0x01, 0x00, 0x04, 0x03,
+    0x00, 0x60, 0x20, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x2A '*'
+    0x00, 0x0F, 0x00, 0x0F, 0x04, 0x0F, 0x06, 0x4F, 0x00, 0x0F, 0x39, 0xEF,
+    0x00, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x01, 0x0F, 0x01, 0x0F,
+    // 0x2B '+'
+    0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x83,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03,
+    // 0x2C ','
+    0x00, 0x1F, 0x00, 0x9F, 0x02, 0x3F, 0x00, 0x5F, 0x00, 0x9F, 0x01, 0x1F,
+    0x44, 0x1F, 0x00, 0x1F,
+    // 0x2D '-'
+    0x5F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    // 0x2E '.'
+    0x03, 0x43, 0x07, 0x07, 0x03, 0x4B, 0x03,
+    // 0x2F '/'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x20, 0x10, 0x00, 0x80, 0x40,
+    0x02, 0x02, 0x00, 0x10, 0x08, 0x00, 0x40, 0x20, 0x00, 0x81, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0x90, 0x00, 0x00, 0x80, 0x00, 0x00,
+    // 0x30 '0'
+    0x00, 0x00, 0x03, 0x01, 0x03, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03, 0x40, 0x78, 0x0B, 0x04, 0x00, 0x83, 0x80, 0x00, 0x43,
+    0x90, 0x00, 0x07, 0x90, 0x00, 0x07, 0x90, 0x00, 0x03, 0x88, 0x00, 0x03,
+    0x02, 0x03, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x20, 0x00, 0x03,
+    0x08, 0x00, 0x83, 0x01, 0xFC, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x07, 0x08, 0x00, 0x1F, 0x24, 0x00, 0x07, 0x24, 0x00, 0x27,
+    0x04, 0x00, 0x07, 0x07, 0xFF, 0xC7, 0x40, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17,
+    // 0x32 '2'
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x4F, 0x01, 0x00, 0x87, 0x41, 0x01, 0x07,
+    0x01, 0x02, 0x07, 0x88, 0x04, 0x07, 0x90, 0x08, 0x47, 0x90, 0x10, 0x47,
+    0x90, 0x20, 0x47, 0x80, 0x00, 0x47, 0x82, 0x04, 0x47, 0x00, 0x08, 0x47,
+    0x00, 0x10, 0x47, 0x00, 0x00, 0x47, 0x10, 0x80, 0x47, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07,
+    // 0x33 '3'
+    0x00, 0x00, 0x03, 0x18, 0x00, 0x33, 0x00, 0x00, 0x23, 0x40, 0x00, 0x23,
+    0x00, 0x50, 0x27, 0x80, 0x40, 0x07, 0x90, 0x00, 0x03, 0x80, 0x00, 0x43,
+    0x80, 0x00, 0x03, 0x81, 0x00, 0x83, 0x84, 0x05, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x20, 0x23, 0x1E, 0x10, 0x03, 0x00, 0x00, 0x03,
+    // 0x34 '4'
+    0x00, 0x00, 0x03, 0x00, 0x09, 0x03, 0x00, 0x10, 0x83, 0x00, 0x00, 0x83,
+    0x00, 0x80, 0x83, 0x00, 0x08, 0x83, 0x00, 0x00, 0x83, 0x08, 0x40, 0x83,
+    0x00, 0x00, 0x83, 0x40, 0x00, 0x83, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x7B, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03,
+    // 0x35 '5'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x2B, 0x00, 0xC0, 0x23, 0x40, 0x20, 0x23,
+    0x80, 0x20, 0x27, 0x80, 0x20, 0x07, 0x80, 0x00, 0x03, 0x80, 0x00, 0x43,
+    0x81, 0x10, 0x03, 0x81, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x80, 0x80, 0x13,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x43, 0x90, 0x11, 0x03,
+    // 0x36 '6'
+    0x00, 0x00, 0x03, 0x00, 0xC0, 0x83, 0x02, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x0B, 0x00, 0x17, 0x03, 0x01, 0x00, 0x03, 0x42, 0x00, 0x03,
+    0x04, 0x00, 0x07, 0x08, 0x00, 0x03, 0x80, 0x00, 0x43, 0x90, 0x82, 0x03,
+    0x80, 0x00, 0x0B, 0x80, 0x40, 0x13, 0x00, 0x20, 0x23, 0x20, 0x0D, 0x83,
+    // 0x37 '7'
+    0x72, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x88, 0x00, 0x8B,
+    0x80, 0x04, 0x03, 0x80, 0x10, 0x07, 0x80, 0x00, 0x07, 0x80, 0x80, 0x63,
+    0x80, 0x02, 0x03, 0x84, 0x08, 0x03, 0x80, 0x20, 0x03, 0x80, 0x80, 0x03,
+    0x80, 0x00, 0x03, 0x04, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x00, 0x03, 0x04, 0x04, 0x23, 0x00, 0x88, 0x13, 0x00, 0x50, 0x0B,
+    0x40, 0x20, 0x03, 0x00, 0x04, 0x03, 0x81, 0x08, 0x03, 0x80, 0x00, 0x27,
+    0x80, 0x80, 0x27, 0x80, 0x80, 0x03, 0x80, 0x04, 0x43, 0x00, 0x01, 0x03,
+    0x00, 0x60, 0x0B, 0x40, 0x80, 0x03, 0x21, 0x00, 0x03, 0x00, 0x04, 0xC3,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x08, 0x20, 0x03, 0x20, 0x10, 0x03, 0x00, 0x08, 0x23,
+    0x00, 0x00, 0x07, 0x07, 0x80, 0x03, 0x80, 0x04, 0x43, 0x90, 0x24, 0x03,
+    0x90, 0x04, 0x0B, 0x80, 0x04, 0x03, 0x80, 0x00, 0x03, 0x00, 0xC0, 0x23,
+    0x40, 0x00, 0x43, 0x00, 0x00, 0x03, 0x10, 0x02, 0x03, 0x06, 0x10, 0x03,
+    // 0x3A ':'
+    0x00, 0x00, 0x7F, 0x08, 0x08, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x00, 0x7F, 0x40, 0x09, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x3B ';'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x48, 0x0C, 0x43, 0x00, 0x00, 0x0B,
+    0x80, 0x00, 0x13, 0x80, 0x00, 0x23, 0x08, 0x08, 0x83, 0x00, 0x00, 0x03,
+    // 0x3C '<'
+    0x00, 0x03, 0x04, 0x03, 0x00, 0x83, 0x08, 0x03, 0x00, 0x43, 0x12, 0x03,
+    0x01, 0x23, 0x24, 0x03, 0x00, 0x93, 0x48, 0x03, 0x00, 0x4B, 0x90, 0x03,
+    0x80, 0x27, 0x20, 0x13,
+    // 0x3D '='
+    0x00, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F,
+    0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F,
+    0x10, 0x3F, 0x12, 0x3F,
+    // 0x3E '>'
+    0x00, 0x03, 0x40, 0x0B, 0x90, 0x27, 0x00, 0x03, 0x48, 0x4B, 0x00, 0x03,
+    0x24, 0x13, 0x00, 0x03, 0x12, 0x23, 0x01, 0x03, 0x08, 0x43, 0x00, 0x03,
+    0x04, 0x83, 0x00, 0x03,
+    // 0x3F '?'
+    0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x21, 0x21,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x03, 0x80, 0x44, 0x01, 0x08, 0x00, 0x1D,
+    0x44, 0x08, 0x01, 0x01, 0x00, 0x01, 0x00, 0x10, 0x01, 0x08, 0x20, 0x01,
+    0x00, 0x00, 0x01,
+    // 0x40 '@'
+    0x00, 0x0F, 0x80, 0x1F, 0x00, 0x40, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x08, 0x18, 0xC0, 0x1F, 0x10, 0x80, 0x10, 0x9F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F,
+    0x48, 0x02, 0x20, 0x3F, 0x00, 0x04, 0x11, 0x3F, 0x01, 0x20, 0x00, 0x3F,
+    0x90, 0x00, 0x80, 0x1F, 0x90, 0x0A, 0x40, 0x1F, 0x80, 0x08, 0x00, 0x1F,
+    0x80, 0x33, 0xA0, 0x1F, 0x90, 0x00, 0x20, 0x3F, 0x91, 0x00, 0x10, 0x3F,
+    0x80, 0xC0, 0x11, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x10, 0x5F,
+    0x44, 0x00, 0x12, 0x1F, 0x02, 0x00, 0x03, 0x1F, 0x00, 0xC6, 0x20, 0x1F,
+    0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x03, 0x02, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x02, 0x03, 0x00, 0x08, 0x03, 0x00, 0x40, 0x33, 0x01, 0x00, 0x93,
+    0x04, 0x08, 0x0F, 0x20, 0x24, 0x03, 0x41, 0x04, 0x03, 0x02, 0x04, 0x03,
+    0x00, 0x44, 0x03, 0x00, 0x08, 0x03, 0x20, 0x00, 0x83, 0x04, 0x00, 0x33,
+    0x00, 0x80, 0x03, 0x00, 0x20, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x00, 0x00, 0x07,
+    // 0x42 'B'
+    0x50, 0x00, 0x09, 0x40, 0x00, 0x01, 0x40, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x48, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x21,
+    0x40, 0x02, 0x45, 0x00, 0x00, 0x01, 0x20, 0x00, 0x09, 0x10, 0x90, 0x01,
+    0x00, 0x08, 0x21, 0x00, 0x00, 0x01,
+    // 0x43 'C'
+    0x00, 0x7F, 0x01, 0x02, 0x00, 0x41, 0x00, 0x00, 0x11, 0x10, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x86, 0x05, 0x40, 0x00, 0x81, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x23, 0x80, 0x00, 0x23,
+    0x00, 0x00, 0x21, 0x0C, 0x00, 0x21, 0x00, 0x00, 0x21, 0x41, 0x00, 0x05,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x31,
+    // 0x44 'D'
+    0x50, 0x00, 0x09, 0x40, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0F, 0xFF, 0xE1,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x25, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01, 0x01, 0x01, 0x09,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x81,
+    0x01, 0x06, 0x01, 0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0xA0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x10, 0x00, 0x47, 0x00, 0x11, 0x07, 0x02, 0x02, 0x07,
+    0x84, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    // 0x46 'F'
+    0xA0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xC7, 0xC7,
+    0x00, 0x48, 0x27, 0x00, 0x48, 0x27, 0x00, 0x48, 0x1F, 0x00, 0x48, 0x07,
+    0x10, 0x48, 0x07, 0x02, 0x48, 0x07, 0x02, 0x20, 0x07, 0xFC, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0x7F, 0x01, 0x02, 0x00, 0x41, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x20, 0x82, 0x05, 0x02, 0x00, 0x81, 0x40, 0x00, 0x01,
+    0x08, 0x00, 0x21, 0x00, 0x00, 0x21, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03,
+    0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x41, 0x00, 0x01, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x48 'H'
+    0xA0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x8F, 0xC7,
+    0x20, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x20, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x20, 0x00, 0x27, 0xC0, 0x00, 0x1F,
+    // 0x49 'I'
+    0xA0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7,
+    0x20, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x17,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x20, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x18, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x1F, 0xFF, 0xC0, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x4B 'K'
+    0xA0, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1F, 0x9F, 0xC3,
+    0x20, 0x88, 0x23, 0x81, 0x04, 0x23, 0x02, 0x00, 0x03, 0x04, 0x40, 0x03,
+    0x48, 0x80, 0x43, 0x11, 0x00, 0x23, 0x02, 0x00, 0x13, 0x04, 0x02, 0x0B,
+    0x08, 0x01, 0x03, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13,
+    // 0x4C 'L'
+    0xA0, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xC7,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    // 0x4D 'M'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00, 0x27, 0x20, 0x03, 0xC7,
+    0x07, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0xC0, 0x27,
+    0x02, 0x00, 0x07, 0x00, 0x60, 0x17, 0x80, 0x04, 0x07, 0x30, 0x01, 0x87,
+    0x02, 0x00, 0x27, 0x00, 0x20, 0x07, 0x00, 0x08, 0x07, 0x00, 0x40, 0x27,
+    0x06, 0x03, 0x07, 0x20, 0x18, 0x07, 0x80, 0x80, 0x07, 0x04, 0x00, 0x07,
+    0x00, 0xF8, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x03, 0xE0, 0x07, 0x20, 0x00, 0x47, 0x00, 0x00, 0x27, 0x00, 0x00, 0x1F,
+    // 0x4E 'N'
+    0x00, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x23, 0x1F, 0xFF, 0xC3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x23,
+    0x00, 0x00, 0x23, 0x20, 0x20, 0x03, 0x00, 0x00, 0x03, 0x04, 0x04, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x80, 0x03, 0x00, 0x40, 0x43, 0xA0, 0x00, 0x03,
+    0x20, 0x08, 0x0B, 0x00, 0x04, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0x7E, 0x01, 0x02, 0x00, 0x41, 0x00, 0x00, 0x11, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0xC6, 0x05, 0x40, 0x00, 0x81, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x21, 0x04, 0x00, 0x45, 0x41, 0x00, 0x81,
+    0x00, 0x00, 0x09, 0x20, 0x00, 0x01, 0x10, 0x00, 0x21, 0x08, 0x00, 0x41,
+    0x03, 0x03, 0x01, 0x00, 0x00, 0x01,
+    // 0x50 'P'
+    0x50, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x0F, 0xF3, 0xE3,
+    0x00, 0x10, 0x13, 0x00, 0x10, 0x13, 0x08, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x03, 0x84, 0x03, 0x40, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x10, 0x03,
+    0x08, 0x40, 0x03, 0x00, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0x7F, 0x00, 0x07, 0x02, 0x00, 0x40, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0xC6, 0x04, 0x07,
+    0x40, 0x00, 0x80, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x20, 0x27, 0x04, 0x00, 0x45, 0x07,
+    0x41, 0x01, 0x00, 0x17, 0x00, 0x00, 0x08, 0x87, 0x20, 0x00, 0x00, 0x87,
+    0x10, 0x00, 0x20, 0x0F, 0x08, 0x00, 0x40, 0x0F, 0x03, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x47,
+    // 0x52 'R'
+    0x50, 0x00, 0x09, 0x40, 0x00, 0x01, 0x40, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0F, 0xE3, 0xE1,
+    0x00, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x20, 0x81, 0x08, 0x00, 0x01,
+    0x03, 0x80, 0x01, 0x40, 0x02, 0x09, 0x00, 0x11, 0x01, 0x00, 0x20, 0x81,
+    0x08, 0x40, 0x41, 0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x09,
+    // 0x53 'S'
+    0x00, 0x00, 0x61, 0x08, 0x41, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x81,
+    0x40, 0x08, 0x21, 0x06, 0x00, 0x03, 0x00, 0x04, 0x13, 0x00, 0x00, 0x13,
+    0x90, 0x02, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC1, 0x02, 0x00, 0x05,
+    0x01, 0x10, 0x01, 0x40, 0x00, 0x01, 0x38, 0x04, 0x21, 0x00, 0x00, 0x01,
+    // 0x54 'T'
+    0x00, 0x00, 0x07, 0x82, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0xF0, 0x00, 0x07,
+    // 0x55 'U'
+    0x40, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1F, 0xFF, 0x83,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x83, 0x20, 0x00, 0x43, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x1F, 0xFF, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x03, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    // 0x56 'V'
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03,
+    0x08, 0x00, 0x43, 0x21, 0x80, 0x0B, 0xC0, 0x30, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x18, 0x0B, 0x80, 0xC0, 0x23, 0x22, 0x00, 0x83,
+    0x10, 0x04, 0x03, 0x00, 0x10, 0x03, 0x00, 0x80, 0x03, 0x02, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x20, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x57 'W'
+    0x00, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03,
+    0x00, 0x80, 0x03, 0x00, 0x10, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0x43,
+    0x0C, 0x00, 0x0B, 0x20, 0xC0, 0x03, 0xC0, 0x0C, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x30, 0x0B, 0x01, 0x00, 0x43, 0x10, 0x02, 0x03, 0x80, 0x10, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x10, 0x03, 0x80, 0x02, 0x03, 0x30, 0x00, 0x43,
+    0x02, 0x00, 0x0B, 0x00, 0x60, 0x03, 0x00, 0x04, 0x03, 0x00, 0x02, 0x03,
+    0x80, 0x30, 0x03, 0x23, 0x00, 0x23, 0x10, 0x01, 0x03, 0x00, 0x18, 0x03,
+    0x00, 0xC0, 0x03, 0x06, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0xC0, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x47,
+    0x08, 0x00, 0x87, 0x04, 0x00, 0x07, 0x00, 0x04, 0x07, 0x00, 0x88, 0x27,
+    0x00, 0x40, 0xA7, 0x20, 0x00, 0x0F, 0x04, 0x04, 0x07, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x1F, 0x44, 0x00, 0x87, 0x20, 0x20, 0x27, 0x00, 0x00, 0x07,
+    0x02, 0x04, 0x07, 0x04, 0x02, 0x07, 0x08, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x20, 0x00, 0x27, 0x80, 0x00, 0x27, 0x00, 0x00, 0x1F,
+    // 0x59 'Y'
+    0x40, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x0F, 0x00, 0x40, 0x07, 0x00, 0x00, 0x27,
+    0x28, 0x0F, 0xC7, 0x02, 0x00, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x80, 0x07, 0xA2, 0x00, 0x07, 0x28, 0x20, 0x27, 0x00, 0x80, 0x27,
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x03, 0x3C, 0x00, 0x4B, 0x02, 0x00, 0x03, 0x02, 0x02, 0x03,
+    0x08, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x43, 0x00, 0x80, 0x03,
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x03, 0x08, 0x00, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x43, 0x00, 0x01, 0x03, 0x88, 0x00, 0x03,
+    0x10, 0x00, 0x0B, 0x00, 0x01, 0x83,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x9F, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x2F,
+    // 0x5C '\'
+    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x20, 0x00, 0x08, 0x08, 0x00, 0x02, 0x01, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x10, 0x10, 0x00, 0x04, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02,
+    // 0x5D ']'
+    0x60, 0x00, 0x00, 0x37, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x9F, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x13, 0x00, 0x83, 0x02, 0x03, 0x10, 0x09, 0x40, 0x41,
+    0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x20, 0x21, 0x08, 0x05, 0x01, 0x03,
+    0x00, 0x43, 0x00, 0x0B, 0x00, 0x01,
+    // 0x5F '_'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F,
+    // 0x60 '`'
+    0x00, 0x08, 0x04, 0x00, 0x00, 0x09, 0x06,
+    // 0x61 'a'
+    0x00, 0x1E, 0x3F, 0x10, 0x00, 0xBF, 0x22, 0x40, 0x3F, 0x02, 0x00, 0x3F,
+    0x46, 0x80, 0x7F, 0x40, 0x80, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x20, 0xBF,
+    0x08, 0x20, 0x3F, 0x00, 0x01, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xBF, 0x00, 0x02, 0x3F,
+    // 0x62 'b'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x48, 0x00, 0x06, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x48, 0x00, 0x7F,
+    0x00, 0x10, 0x04, 0xFF, 0x00, 0x90, 0x04, 0xFF, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x06, 0x60, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x80, 0x02, 0x7F, 0x00, 0x40, 0x04, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x00, 0x03, 0x00, 0x7F,
+    // 0x63 'c'
+    0x03, 0x18, 0x3F, 0x08, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x44, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x06, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x22, 0x04, 0x3F, 0x00, 0x02, 0x3F,
+    // 0x64 'd'
+    0x00, 0x06, 0x18, 0x7F, 0x00, 0x10, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x88, 0x10, 0xFF,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x09, 0x7F, 0x4F, 0x0F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    // 0x65 'e'
+    0x03, 0x08, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x00, 0xBF,
+    0x02, 0x30, 0x3F, 0x49, 0x00, 0x3F, 0x01, 0x00, 0x3F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0xBF, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x66 'f'
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x1F, 0xF8,
+    0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x80, 0x04, 0x00, 0x80, 0x00, 0x90, 0x80, 0x00, 0x00, 0x80, 0x00,
+    0x08, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x0C, 0x89, 0x00, 0x7F,
+    0x00, 0x10, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x08, 0x7F,
+    0x08, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x10, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x08, 0x90, 0x41, 0x7F, 0x40, 0x10, 0x41, 0x7F,
+    0x40, 0x00, 0x30, 0x7F, 0x40, 0x02, 0x00, 0x7F, 0x18, 0x82, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x90, 0x7F, 0x70, 0x00, 0x00, 0x7F,
+    // 0x68 'h'
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x02,
+    0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x69 'i'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x80, 0x00,
+    0x04, 0x80, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x90, 0x00, 0x42, 0x40, 0x80, 0x00, 0x00,
+    0x04, 0x80, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20,
+    0x30, 0xFF, 0xFE, 0x00,
+    // 0x6B 'k'
+    0x30, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x04, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x7F, 0xFE, 0x04, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x80, 0x04, 0x7F,
+    0x00, 0x80, 0x02, 0x7F, 0x00, 0x80, 0x41, 0x7F, 0x00, 0x80, 0x20, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0xA0, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x6C 'l'
+    0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    // 0x6D 'm'
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x48, 0x00, 0x7F, 0x08, 0x01, 0xFF,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x7F, 0x48, 0x00, 0x7F,
+    0x48, 0x00, 0x7F, 0x08, 0x00, 0x7F, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x6E 'n'
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x08, 0x01, 0x7F, 0x48, 0x00, 0x7F, 0x08, 0x01, 0xFF,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x7F, 0x0F, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF,
+    // 0x6F 'o'
+    0x03, 0x18, 0x3F, 0x08, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x44, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x7F,
+    0x00, 0x02, 0x3F, 0x08, 0x00, 0x3F, 0x04, 0x04, 0x3F, 0x40, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x10, 0x00, 0x3F, 0x04, 0x10, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x70 'p'
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x00, 0x05, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x27, 0xFC, 0x79,
+    0x08, 0x02, 0x05, 0x48, 0x02, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x08, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x04, 0x00, 0x03, 0xE0, 0x00,
+    // 0x71 'q'
+    0x03, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x00, 0x04, 0x05, 0x07, 0xF8, 0xF9, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x03,
+    // 0x72 'r'
+    0x10, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F,
+    0x20, 0x02, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x30, 0x00, 0x7F,
+    // 0x73 's'
+    0x00, 0x07, 0x3F, 0x00, 0x00, 0xBF, 0x20, 0x10, 0x3F, 0x00, 0x04, 0x3F,
+    0x40, 0x22, 0x3F, 0x00, 0x00, 0x3F, 0x12, 0x00, 0x7F, 0x10, 0x10, 0x3F,
+    0x11, 0x0A, 0x3F, 0x08, 0x00, 0x3F, 0x42, 0x80, 0x3F, 0x00, 0x01, 0x3F,
+    0x38, 0x24, 0x3F,
+    // 0x74 't'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x09, 0xFF, 0x87,
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F,
+    0x08, 0x00, 0x8F, 0x08, 0x00, 0x07, 0x08, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x02, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x75 'u'
+    0x60, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x80, 0x02, 0x7F,
+    0x80, 0x01, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x10, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x09, 0x7F,
+    0x80, 0x02, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x7F,
+    // 0x76 'v'
+    0x00, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x84, 0x00, 0x7F,
+    0x81, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x08, 0x7F, 0x90, 0x02, 0x7F,
+    0xA2, 0x00, 0x7F, 0xC0, 0x40, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x40, 0x7F,
+    0x82, 0x02, 0x7F, 0xB8, 0x08, 0x7F, 0x80, 0x00, 0x7F, 0x81, 0x00, 0x7F,
+    0x84, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x77 'w'
+    0x00, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0x82, 0x00, 0x7F,
+    0x80, 0x80, 0x7F, 0x80, 0x10, 0x7F, 0x80, 0x02, 0x7F, 0x8C, 0x00, 0x7F,
+    0x80, 0xC0, 0x7F, 0x00, 0x10, 0x7F, 0x00, 0x80, 0x7F, 0x04, 0x04, 0x7F,
+    0x20, 0x60, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x08, 0x7F,
+    0x10, 0x01, 0x7F, 0x03, 0x00, 0x7F, 0x00, 0x30, 0x7F, 0x00, 0x20, 0x7F,
+    0xA3, 0x01, 0x7F, 0x90, 0x08, 0x7F, 0x80, 0x60, 0x7F, 0x81, 0x00, 0x7F,
+    0x88, 0x00, 0x7F, 0xA0, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    // 0x78 'x'
+    0x00, 0x01, 0x80, 0x00, 0x80, 0x04, 0x90, 0x08, 0x80, 0x10, 0x80, 0x20,
+    0x80, 0x04, 0x80, 0x08, 0x80, 0x00, 0x04, 0x20, 0x00, 0x02, 0x90, 0x04,
+    0x82, 0x00, 0x84, 0x20, 0x88, 0x10, 0x80, 0x08, 0xA0, 0x04, 0x80, 0x00,
+    0x00, 0x00,
+    // 0x79 'y'
+    0x00, 0x00, 0x0C, 0xA0, 0x00, 0x12, 0x90, 0x00, 0x10, 0x84, 0x00, 0x10,
+    0x81, 0x00, 0x10, 0x80, 0x40, 0x02, 0x80, 0x08, 0x20, 0x90, 0x02, 0x44,
+    0xA2, 0x00, 0x00, 0xC0, 0x40, 0x00, 0x00, 0x10, 0x20, 0x00, 0x40, 0x80,
+    0x82, 0x02, 0x00, 0xB0, 0x08, 0x00, 0x80, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x7A 'z'
+    0x00, 0x00, 0x7F, 0x38, 0x09, 0x7F, 0x80, 0x10, 0x7F, 0x84, 0x00, 0x7F,
+    0x90, 0x00, 0x7F, 0x81, 0x00, 0x7F, 0x82, 0x08, 0x7F, 0x80, 0x10, 0x7F,
+    0x90, 0x00, 0x7F, 0x80, 0x80, 0x7F, 0x81, 0x00, 0x7F, 0x80, 0x08, 0x7F,
+    0x80, 0x20, 0x7F, 0x90, 0x00, 0x7F, 0x20, 0x3C, 0x7F,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x20, 0x30, 0x70, 0x23, 0x40, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x0B,
+    0x8F, 0x84, 0x0F, 0xC3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x80, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x8B, 0x84, 0x0E, 0x8B, 0x80, 0x02, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x30, 0x60, 0x23, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x7E '~'
+    0x1B, 0x47, 0x07, 0x93, 0x83, 0x93, 0x03, 0x43, 0x03, 0x27, 0x27, 0x07,
+    0x83, 0x03, 0x23,
+    // 0xA1 '¡'
+    0x38, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x49, 0x80, 0x00, 0x00, 0x03, 0xFC,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x30, 0x20, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x20, 0x40, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x00, 0x80, 0x23, 0xEF, 0x80, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x77, 0xBC, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x20, 0x00, 0x07, 0x02, 0x10, 0x24, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0xC0, 0x30, 0x07,
+    // 0xA3 '£'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x07, 0x07, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x43,
+    0x40, 0x06, 0x03, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x90, 0x00, 0x03, 0x84, 0x20, 0x07, 0x02, 0x00, 0x43,
+    0x40, 0x00, 0x4B, 0x30, 0x00, 0x03,
+    // 0xA4 '¤'
+    0x00, 0x01, 0x50, 0x01, 0x0B, 0xC3, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01,
+    0x24, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x25, 0x20, 0x41, 0x00, 0x09,
+    0x00, 0x01, 0x00, 0x21, 0x00, 0x13, 0x10, 0x05, 0x00, 0x01,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x88, 0x60, 0x07,
+    0x82, 0x50, 0x07, 0x80, 0xD0, 0x17, 0x80, 0x10, 0x07, 0x90, 0x10, 0x27,
+    0xA4, 0x01, 0xC7, 0x41, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x41, 0x01, 0xC7, 0x84, 0x10, 0x27, 0x80, 0x10, 0x27, 0x81, 0x50, 0x1F,
+    0x84, 0x50, 0x07, 0x80, 0x60, 0x07, 0x80, 0x00, 0x07, 0xA0, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xA7 '§'
+    0x03, 0x60, 0x14, 0x08, 0x08, 0x02, 0x01, 0xC0, 0x00, 0x00, 0x80, 0x11,
+    0x54, 0x41, 0x09, 0x00, 0x08, 0x01, 0x81, 0x20, 0x81, 0x80, 0x00, 0x01,
+    0x90, 0x82, 0x08, 0x08, 0x08, 0x02, 0x04, 0x04, 0x84, 0x40, 0x20, 0x08,
+    0x10, 0x00, 0x20, 0x00, 0x00, 0x00,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x00, 0x83, 0x01, 0x00, 0x10, 0x41, 0x09, 0x01, 0x21,
+    0x10, 0x00, 0x41, 0x00, 0x00, 0x29, 0x00, 0x42, 0x11, 0x11, 0x00, 0x05,
+    0x40, 0x00, 0x09, 0x20, 0x00, 0x09, 0x20, 0x00, 0x43, 0x25, 0x00, 0x43,
+    0x25, 0x01, 0x43, 0x20, 0x81, 0x41, 0x00, 0x40, 0x09, 0x43, 0x01, 0x81,
+    0x10, 0x00, 0x15, 0x28, 0x00, 0x01, 0x04, 0x00, 0x01, 0x02, 0x00, 0x91,
+    0x04, 0x66, 0x01, 0x01, 0x00, 0x81, 0x00, 0x38, 0x01,
+    // 0xAA 'ª'
+    0x00, 0x82, 0x02, 0x20, 0x40, 0x00, 0x15, 0x80, 0x24, 0x00, 0x26, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    // 0xAB '«'
+    0x00, 0x0F, 0x01, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x20, 0x2F, 0x44, 0x0F,
+    0x08, 0x9F, 0x00, 0x4F, 0x46, 0x2F, 0x08, 0x0F, 0x10, 0x0F, 0x00, 0x0F,
+    0x00, 0x2F, 0x41, 0x1F, 0x10, 0x0F, 0x20, 0x1F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x04, 0x10, 0x7F, 0x03, 0xE4, 0x7F, 0x08, 0x0A, 0x7F,
+    0x10, 0x04, 0x7F, 0x4C, 0x1A, 0x7F, 0x28, 0x08, 0x7F, 0x08, 0x08, 0x7F,
+    0x0C, 0x58, 0xFF, 0x09, 0x00, 0xFF, 0x20, 0xC0, 0x7F, 0x67, 0x0A, 0x7F,
+    0x00, 0x19, 0x7F, 0x20, 0x00, 0x7F, 0x14, 0x10, 0x7F, 0x08, 0x08, 0x7F,
+    0x01, 0xC0, 0x7F,
+    // 0xB0 '°'
+    0x04, 0x1F, 0x20, 0x9F, 0x40, 0x5F, 0x0C, 0x1F, 0x91, 0x3F, 0x80, 0x3F,
+    0x80, 0x3F, 0x91, 0x3F, 0x04, 0x1F, 0x40, 0x5F, 0x20, 0x1F, 0x00, 0x1F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    0x04, 0x01, 0x1F, 0x04, 0x81, 0x1F, 0x80, 0x05, 0x1F, 0x80, 0x05, 0x1F,
+    0x80, 0x05, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x07, 0x44, 0x03, 0x00, 0x03, 0x80, 0x83, 0x81, 0x23,
+    0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x40, 0x07, 0x1C, 0x07, 0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x01, 0x00, 0x01, 0x08, 0x01, 0x02, 0x01, 0xA0, 0x11, 0xA4, 0x01,
+    0x80, 0xA1, 0x80, 0x05, 0x02, 0x01, 0x41, 0x01, 0x00, 0xE1,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x0F, 0xE0, 0x0E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x00, 0x01, 0x00,
+    0x40, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    // 0xB6 '¶'
+    0x03, 0x80, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x20, 0x08, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x03, 0x0B, 0x83, 0x83, 0x83, 0x43, 0x03,
+    // 0xB9 '¹'
+    0x30, 0x0F, 0x00, 0x03, 0x40, 0x13, 0x4F, 0xE3, 0x00, 0x03, 0x80, 0x03,
+    0x00, 0x03, 0x00, 0x13, 0x00, 0x03, 0x00, 0x03,
+    // 0xBA 'º'
+    0x0F, 0x00, 0x20, 0x46, 0x40, 0x20, 0x0B, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x19, 0x00,
+    // 0xBB '»'
+    0x40, 0x2F, 0x00, 0x4F, 0x08, 0x9F, 0x44, 0x0F, 0x20, 0x0F, 0x00, 0x4F,
+    0x00, 0x8F, 0x01, 0x0F, 0x20, 0x1F, 0x10, 0x0F, 0x00, 0x1F, 0x02, 0x2F,
+    0x20, 0x0F, 0x10, 0x0F, 0x08, 0x0F, 0x06, 0x0F,
+    // 0xBC '¼'
+    0x0C, 0x03, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F,
+    0x00, 0x00, 0x08, 0xBF, 0x00, 0x00, 0x20, 0xBF, 0x00, 0x00, 0x82, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x04, 0x20, 0x3F, 0x00, 0x10, 0x80, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x04, 0x10, 0x00, 0x3F,
+    0x00, 0x40, 0x40, 0x3F, 0x01, 0x00, 0x08, 0x3F, 0x40, 0x00, 0x08, 0x3F,
+    0x08, 0x04, 0x28, 0x3F, 0x00, 0x01, 0x28, 0x3F, 0x00, 0x02, 0x28, 0x3F,
+    0x00, 0x03, 0xC6, 0x3F, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x28, 0x3F, 0x00, 0x00, 0x30, 0x3F,
+    // 0xBD '½'
+    0x0C, 0x03, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x05, 0x08, 0xBF,
+    0x00, 0x00, 0x20, 0xBF, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x08, 0x3F,
+    0x00, 0x04, 0x20, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F,
+    0x20, 0x0C, 0x04, 0x3F, 0x42, 0x02, 0x00, 0x3F, 0x08, 0x22, 0x00, 0x3F,
+    0x20, 0x02, 0x00, 0x3F, 0x00, 0x08, 0x40, 0x3F, 0x00, 0x40, 0x90, 0x3F,
+    0x00, 0x48, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xBE '¾'
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x01, 0x00, 0x3F, 0x02, 0x04, 0x00, 0x3F,
+    0x20, 0x04, 0x00, 0x3F, 0x28, 0x04, 0x00, 0x3F, 0x29, 0x00, 0x00, 0x3F,
+    0x22, 0x09, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x01, 0x3F,
+    0x10, 0x00, 0x04, 0x3F, 0x00, 0x38, 0x10, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x84, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x02, 0x00, 0x3F, 0x01, 0x08, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0x3F, 0x10, 0x00, 0x40, 0x3F, 0x41, 0x00, 0x08, 0x3F,
+    0x44, 0x00, 0x08, 0x3F, 0x10, 0x04, 0x28, 0x3F, 0x00, 0x01, 0x28, 0x3F,
+    0x00, 0x02, 0x28, 0x3F, 0x00, 0x03, 0xC6, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x28, 0x3F,
+    0x00, 0x00, 0x30, 0x3F,
+    // 0xBF '¿'
+    0x00, 0x03, 0x80, 0x00, 0x08, 0x00, 0x00, 0x10, 0x08, 0x00, 0x01, 0x84,
+    0x00, 0x22, 0x00, 0x48, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00,
+    0x01, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x0C,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x40, 0x33, 0x40, 0x01, 0x00, 0x93, 0x44, 0x04, 0x08, 0x0F,
+    0x00, 0x20, 0x24, 0x03, 0x00, 0x41, 0x04, 0x03, 0x12, 0x02, 0x04, 0x03,
+    0x02, 0x00, 0x44, 0x03, 0x02, 0x00, 0x08, 0x03, 0x00, 0x20, 0x00, 0x83,
+    0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x40, 0x33, 0x00, 0x01, 0x00, 0x93, 0x04, 0x04, 0x08, 0x0F,
+    0x0A, 0x20, 0x24, 0x03, 0x12, 0x41, 0x04, 0x03, 0x00, 0x02, 0x04, 0x03,
+    0x20, 0x00, 0x44, 0x03, 0x44, 0x00, 0x08, 0x03, 0x40, 0x20, 0x00, 0x83,
+    0x30, 0x04, 0x00, 0x33, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x0C, 0x00, 0x80, 0x67, 0x10, 0x02, 0x01, 0x27, 0x24, 0x08, 0x10, 0x1F,
+    0x08, 0x40, 0x48, 0x07, 0x90, 0x82, 0x08, 0x07, 0x00, 0x04, 0x08, 0x07,
+    0x10, 0x00, 0x88, 0x07, 0x08, 0x00, 0x10, 0x07, 0x04, 0x40, 0x01, 0x07,
+    0x04, 0x08, 0x00, 0x67, 0x08, 0x01, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x28, 0x00, 0x80, 0x67, 0x40, 0x02, 0x01, 0x27, 0x08, 0x08, 0x10, 0x1F,
+    0x10, 0x40, 0x48, 0x07, 0x00, 0x82, 0x08, 0x07, 0x00, 0x04, 0x08, 0x07,
+    0x24, 0x00, 0x88, 0x07, 0x24, 0x00, 0x10, 0x07, 0x00, 0x40, 0x01, 0x07,
+    0x48, 0x08, 0x00, 0x67, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x40, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x20, 0x00, 0x20, 0x0F,
+    0x00, 0x01, 0x00, 0xCF, 0x88, 0x04, 0x02, 0x4F, 0x88, 0x10, 0x20, 0x3F,
+    0x00, 0x80, 0x90, 0x0F, 0x01, 0x04, 0x10, 0x0F, 0x00, 0x08, 0x10, 0x0F,
+    0x50, 0x01, 0x10, 0x0F, 0x88, 0x00, 0x20, 0x0F, 0x88, 0x80, 0x02, 0x0F,
+    0x80, 0x10, 0x00, 0xCF, 0x70, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x40, 0x33, 0x1C, 0x01, 0x00, 0x93, 0x40, 0x04, 0x08, 0x0F,
+    0x19, 0x20, 0x24, 0x03, 0xA1, 0x41, 0x04, 0x03, 0xA1, 0x02, 0x04, 0x03,
+    0x15, 0x00, 0x44, 0x03, 0x00, 0x00, 0x08, 0x03, 0x24, 0x20, 0x00, 0x83,
+    0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x00, 0x08, 0x07, 0x00, 0x20, 0x67,
+    0x00, 0x01, 0x07, 0xC1, 0x00, 0x1F, 0x24, 0x10, 0x07, 0x30, 0x08, 0x07,
+    0x00, 0x08, 0x0F, 0x02, 0x08, 0x07, 0x08, 0x08, 0x27, 0x0F, 0xF1, 0xC7,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x07, 0x08, 0x00, 0x47, 0x00, 0x61, 0x07, 0x00, 0x02, 0x07,
+    0x70, 0x00, 0x1F, 0x00, 0x00, 0x07,
+    // 0xC7 'Ç'
+    0x00, 0x7F, 0x00, 0x03, 0x02, 0x00, 0x40, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x10, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x86, 0x04, 0x03,
+    0x40, 0x00, 0x80, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x17, 0x00, 0x00, 0x23, 0x07, 0x80, 0x00, 0x22, 0x0B,
+    0x00, 0x00, 0x20, 0x93, 0x0C, 0x00, 0x20, 0x03, 0x00, 0x00, 0x20, 0x03,
+    0x41, 0x00, 0x04, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x30, 0x03,
+    // 0xC8 'È'
+    0x00, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x20, 0x0F, 0xC7, 0xE3, 0x00, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x23, 0x00, 0x00, 0x08, 0x83,
+    0x00, 0x01, 0x01, 0x03, 0x00, 0x42, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    // 0xC9 'É'
+    0x00, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x0F, 0xC7, 0xE3, 0x12, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x23, 0x00, 0x00, 0x08, 0x83,
+    0x00, 0x01, 0x01, 0x03, 0x00, 0x42, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    // 0xCA 'Ê'
+    0x00, 0xA0, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x1F, 0x8F, 0xC7, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x14, 0x10, 0x00, 0x47, 0x00, 0x00, 0x11, 0x07,
+    0x00, 0x02, 0x02, 0x07, 0x00, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    // 0xCB 'Ë'
+    0x01, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x50, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x50, 0x3F, 0x1F, 0x8F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x88, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x8F, 0x00, 0x00, 0x22, 0x0F,
+    0x00, 0x04, 0x04, 0x0F, 0x01, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xCC 'Ì'
+    0x00, 0x50, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x0F, 0xFF, 0xE3, 0x00, 0x10, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B,
+    // 0xCD 'Í'
+    0x00, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x04, 0x0F, 0xFF, 0xE3, 0x00, 0x10, 0x00, 0x13,
+    0x28, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x0C, 0xA0, 0x00, 0x17, 0x10, 0x00, 0x00, 0x07,
+    0x24, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x08, 0x1F, 0xFF, 0xC7,
+    0x04, 0x20, 0x00, 0x27, 0x04, 0x00, 0x00, 0x27, 0x08, 0x00, 0x00, 0x17,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x2F, 0x88, 0x00, 0x00, 0x0F,
+    0x88, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x70, 0x00, 0x00, 0x0F, 0x88, 0x3F, 0xFF, 0x8F,
+    0x88, 0x40, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x2F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x01, 0x50, 0x28, 0x09, 0x40, 0x28, 0x01, 0x00, 0x28, 0x11,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x0F, 0xE7, 0xE1, 0x00, 0x28, 0x01, 0x00, 0x28, 0x01, 0x00, 0x28, 0x01,
+    0x00, 0x18, 0x01, 0x08, 0x00, 0x25, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01,
+    0x01, 0x01, 0x09, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x00, 0x81, 0x01, 0x06, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x1F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x20, 0x03, 0x00, 0x00, 0x00, 0x03, 0x48, 0x04, 0x04, 0x03,
+    0x00, 0x00, 0x02, 0x03, 0x24, 0x00, 0x80, 0x03, 0x40, 0x00, 0x40, 0x43,
+    0x00, 0xA0, 0x00, 0x03, 0x30, 0x20, 0x08, 0x0B, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x7E, 0x01, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC6, 0x05,
+    0x28, 0x40, 0x00, 0x81, 0x00, 0x40, 0x00, 0x01, 0x04, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x04, 0x00, 0x45,
+    0x00, 0x41, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x21, 0x00, 0x08, 0x00, 0x41, 0x00, 0x03, 0x03, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x7E, 0x01, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC6, 0x05,
+    0x00, 0x40, 0x00, 0x81, 0x00, 0x40, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x21, 0x40, 0x04, 0x00, 0x45,
+    0x00, 0x41, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x20, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x21, 0x00, 0x08, 0x00, 0x41, 0x00, 0x03, 0x03, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0xFC, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x8C, 0x0B,
+    0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x00, 0x03, 0x40, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x43, 0x20, 0x08, 0x00, 0x8B,
+    0x14, 0x82, 0x01, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x10, 0x00, 0x83, 0x00, 0x06, 0x06, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0xFC, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x8C, 0x0B,
+    0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x24, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x8B,
+    0x30, 0x82, 0x01, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x10, 0x00, 0x83, 0x00, 0x06, 0x06, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x01, 0xF8, 0x07, 0x00, 0x08, 0x01, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x50, 0x03, 0x18, 0x17,
+    0x89, 0x00, 0x02, 0x07, 0x89, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F,
+    0x70, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x87, 0x88, 0x10, 0x01, 0x17,
+    0x01, 0x04, 0x02, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x80, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x87, 0x00, 0x20, 0x01, 0x07, 0x00, 0x0C, 0x0C, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xD7 '×'
+    0x20, 0x23, 0x40, 0x43, 0x00, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x08, 0x03, 0x10, 0x03, 0x20, 0x03, 0x44, 0x03, 0x08, 0x03, 0x10, 0x03,
+    0x00, 0x03,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x01, 0x00, 0x7F, 0x09, 0x02, 0x00, 0x51, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0xCE, 0x05, 0x40, 0x02, 0x01,
+    0x40, 0x04, 0x01, 0x00, 0x08, 0x03, 0x00, 0x10, 0x03, 0x00, 0x20, 0x03,
+    0x80, 0x40, 0x03, 0x00, 0x80, 0x01, 0x01, 0x20, 0x21, 0x06, 0x40, 0x05,
+    0x40, 0x80, 0x81, 0x00, 0x00, 0x09, 0x20, 0x00, 0x01, 0x20, 0x00, 0x21,
+    0x48, 0x00, 0x41, 0x12, 0x03, 0x01, 0x20, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0x20, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x41,
+    0x44, 0x10, 0x00, 0x21, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x12, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x06, 0x50, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x00, 0x01,
+    // 0xDA 'Ú'
+    0x00, 0x20, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41,
+    0x04, 0x10, 0x00, 0x21, 0x0A, 0x60, 0x00, 0x03, 0x12, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x44, 0x50, 0x00, 0x01,
+    0x40, 0x10, 0x00, 0x01, 0x30, 0x0F, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x00, 0x01,
+    // 0xDB 'Û'
+    0x00, 0x40, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1F, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x83,
+    0x04, 0x20, 0x00, 0x43, 0x08, 0xC0, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07, 0x08, 0xA0, 0x00, 0x03,
+    0x04, 0x20, 0x00, 0x03, 0x04, 0x1F, 0xFF, 0x0B, 0x08, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x3F, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x27,
+    0x20, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x88, 0x00, 0x01, 0x07,
+    0x88, 0x40, 0x00, 0x87, 0x01, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x0F, 0x89, 0x40, 0x00, 0x07,
+    0x88, 0x40, 0x00, 0x07, 0x80, 0x3F, 0xFE, 0x17, 0x70, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x01, 0x80, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0x80, 0x00, 0x17, 0x20, 0x00, 0x07, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x31, 0xFE, 0x67,
+    0x02, 0x02, 0x07, 0x02, 0x02, 0x07, 0x00, 0x00, 0x87, 0x09, 0x04, 0x87,
+    0x08, 0xD8, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x02, 0x07,
+    0x00, 0x04, 0x07, 0x00, 0x60, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F,
+    0x04, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x42, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x0E, 0x7F,
+    0x10, 0x1C, 0x11, 0x7F, 0x90, 0x00, 0x10, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x00, 0xFF, 0x06, 0x20, 0x40, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x40, 0x80, 0x00, 0x7F, 0x20, 0x02, 0x00, 0x7F, 0x00, 0x01, 0x02, 0x7F,
+    0x00, 0x00, 0x48, 0x7F,
+    // 0xE0 'à'
+    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x08, 0x00, 0x5F, 0x00, 0x11, 0x20, 0x1F,
+    0x28, 0x01, 0x00, 0x1F, 0x44, 0x23, 0x40, 0x3F, 0x40, 0x20, 0x40, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x09, 0x00, 0x10, 0x5F, 0x04, 0x04, 0x10, 0x1F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x01, 0x1F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x08, 0x00, 0x5F, 0x00, 0x11, 0x20, 0x1F,
+    0x00, 0x01, 0x00, 0x1F, 0x00, 0x23, 0x40, 0x3F, 0x02, 0x20, 0x40, 0x1F,
+    0x09, 0x00, 0x01, 0x1F, 0x20, 0x00, 0x10, 0x5F, 0x00, 0x04, 0x10, 0x1F,
+    0x40, 0x00, 0x00, 0x9F, 0x30, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x01, 0x1F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x1E, 0x3F, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x22, 0x40, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x10, 0x46, 0x80, 0x7F, 0x40, 0x40, 0x80, 0x3F,
+    0x08, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x20, 0xBF, 0x08, 0x08, 0x20, 0x3F,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xBF,
+    0x00, 0x00, 0x02, 0x3F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x3C, 0x7F, 0x00, 0x20, 0x01, 0x7F, 0x30, 0x44, 0x80, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x80, 0x8D, 0x00, 0xFF, 0x80, 0x81, 0x00, 0x7F,
+    0x10, 0x00, 0x04, 0x7F, 0x48, 0x00, 0x41, 0x7F, 0x20, 0x10, 0x40, 0x7F,
+    0x00, 0x00, 0x02, 0x7F, 0x80, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x7F,
+    0x00, 0x00, 0x04, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x78, 0x00, 0x40, 0x02, 0x00, 0x89, 0x00, 0x80, 0x08, 0x00,
+    0x01, 0x1A, 0x01, 0x91, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x82,
+    0x10, 0x20, 0x80, 0x80, 0x00, 0x04, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x08,
+    // 0xE5 'å'
+    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x08, 0x00, 0x5F, 0x00, 0x11, 0x20, 0x1F,
+    0x1E, 0x01, 0x00, 0x1F, 0x01, 0x23, 0x40, 0x3F, 0x4C, 0x20, 0x40, 0x1F,
+    0x02, 0x80, 0x01, 0x1F, 0x00, 0x80, 0x10, 0x5F, 0x10, 0x04, 0x10, 0x1F,
+    0x01, 0x00, 0x00, 0x9F, 0x22, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x5F,
+    0x00, 0x00, 0x01, 0x1F,
+    // 0xE6 'æ'
+    0x00, 0x1E, 0x3F, 0x10, 0x20, 0x3F, 0x22, 0x40, 0x3F, 0x00, 0x00, 0x3F,
+    0x46, 0x00, 0x7F, 0x40, 0x80, 0x7F, 0x00, 0x22, 0x3F, 0x00, 0x20, 0x3F,
+    0x08, 0x20, 0x3F, 0x00, 0x04, 0xBF, 0x40, 0x01, 0x3F, 0x20, 0x00, 0x3F,
+    0x20, 0x00, 0xBF, 0x05, 0x08, 0x3F, 0x41, 0x04, 0x3F, 0x01, 0x40, 0x3F,
+    0x00, 0x40, 0x7F, 0x00, 0x40, 0x3F, 0x06, 0x40, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0xBF, 0x00, 0x04, 0x3F, 0x0F, 0x80, 0x3F,
+    // 0xE7 'ç'
+    0x03, 0x18, 0x00, 0x7F, 0x08, 0x02, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x44, 0x00, 0x10, 0xFF,
+    0x00, 0x00, 0x28, 0x7F, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x00, 0x60, 0x7F,
+    0x06, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x22, 0x04, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    // 0xE8 'è'
+    0x00, 0x01, 0x84, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x10, 0x10, 0x00, 0x5F, 0x40, 0x01, 0x18, 0x1F, 0x00, 0x24, 0x80, 0x1F,
+    0x22, 0x00, 0x80, 0x1F, 0x10, 0x00, 0x80, 0x3F, 0x01, 0x00, 0x80, 0x3F,
+    0x00, 0x00, 0x80, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xE9 'é'
+    0x00, 0x01, 0x84, 0x1F, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x01, 0x18, 0x1F, 0x00, 0x24, 0x80, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x11, 0x00, 0x80, 0x3F, 0x42, 0x00, 0x80, 0x3F,
+    0x04, 0x00, 0x80, 0x1F, 0x08, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xEA 'ê'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x06, 0x20, 0x00, 0xBF, 0x00, 0x02, 0x30, 0x3F, 0x22, 0x49, 0x00, 0x3F,
+    0x04, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x44, 0x01, 0x00, 0x3F, 0x22, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEB 'ë'
+    0x00, 0x0C, 0x20, 0x00, 0x20, 0x00, 0x70, 0x00, 0x00, 0x80, 0x80, 0x02,
+    0x00, 0x08, 0xC0, 0x81, 0x24, 0x00, 0x60, 0x04, 0x00, 0x00, 0x04, 0x01,
+    0x20, 0x04, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x10, 0x80, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x00, 0x3F,
+    0x40, 0x20, 0x00, 0x3F, 0x22, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xED 'í'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x08, 0x20, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F,
+    0x42, 0x00, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEE 'î'
+    0x00, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x10, 0x40, 0x00, 0x7F,
+    0x20, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x44, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x02, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xEF 'ï'
+    0x10, 0x00, 0x01, 0x80, 0x00, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x01,
+    0x61, 0x00, 0x01, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x09, 0x80, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0xF0 'ð'
+    0x00, 0x03, 0x18, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x3F, 0x08, 0x44, 0x08, 0x3F,
+    0x42, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x7F, 0x20, 0x00, 0x02, 0x3F,
+    0x20, 0xC8, 0x00, 0x3F, 0x08, 0x04, 0x00, 0x3F, 0x04, 0x00, 0x00, 0xBF,
+    0x22, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x0C, 0x30, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x10, 0x10, 0x02, 0x48, 0x90, 0x00, 0x00, 0x10, 0x03,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    // 0xF2 'ò'
+    0x00, 0x01, 0x8C, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x08, 0x00, 0x00, 0x1F, 0x04, 0x22, 0x04, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x3F, 0x09, 0x00, 0x01, 0x1F,
+    0x06, 0x04, 0x00, 0x1F, 0x00, 0x02, 0x02, 0x1F, 0x00, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x02, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xF3 'ó'
+    0x00, 0x01, 0x8C, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x22, 0x04, 0x1F,
+    0x02, 0x00, 0x00, 0x1F, 0x09, 0x00, 0x01, 0x3F, 0x20, 0x00, 0x01, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x40, 0x02, 0x02, 0x1F, 0x30, 0x20, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x02, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xF4 'ô'
+    0x00, 0x03, 0x18, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x02, 0x20, 0x00, 0xBF, 0x08, 0x00, 0x00, 0x3F, 0x10, 0x44, 0x08, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x04, 0x04, 0x3F, 0x10, 0x40, 0x00, 0xBF,
+    0x0A, 0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x04, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xF5 'õ'
+    0x00, 0x06, 0x30, 0x7F, 0x00, 0x10, 0x04, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x28, 0x40, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x88, 0x10, 0x7F,
+    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0xFF, 0x48, 0x00, 0x04, 0x7F,
+    0x20, 0x10, 0x00, 0x7F, 0x00, 0x08, 0x08, 0x7F, 0x80, 0x80, 0x01, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x08, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x0C, 0x60, 0x00, 0x20, 0x08, 0x00, 0x40, 0x00, 0x80, 0x80, 0x02,
+    0x80, 0x00, 0x00, 0x81, 0x10, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x08, 0x10, 0x20, 0x00, 0x80, 0x10, 0x10, 0x01, 0x00, 0x02,
+    0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x40,
+    0x00, 0x00, 0x00,
+    // 0xF7 '÷'
+    0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x64, 0x1B,
+    0x84, 0x07, 0x04, 0x07, 0x84, 0x07, 0x64, 0x13, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x3F, 0x03, 0x19, 0x3F, 0x08, 0x00, 0x3F, 0x10, 0x00, 0x3F,
+    0x20, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x3F, 0x00, 0x40, 0x3F,
+    0x10, 0x82, 0x7F, 0x01, 0x02, 0x3F, 0x02, 0x02, 0x3F, 0x04, 0x04, 0x3F,
+    0x40, 0xE0, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F,
+    0x54, 0x10, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xF9 'ù'
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F, 0x10, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x04, 0x10, 0x04, 0x3F, 0x22, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x02, 0x5F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    // 0xFA 'ú'
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x10, 0x04, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x11, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F,
+    0x08, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    // 0xFB 'û'
+    0x00, 0x30, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F,
+    0x00, 0x40, 0x01, 0x3F, 0x00, 0x40, 0x00, 0xBF, 0x06, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x22, 0x20, 0x08, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x04, 0xBF,
+    0x22, 0x40, 0x01, 0x3F, 0x10, 0x40, 0x00, 0x3F, 0x04, 0x40, 0x00, 0x3F,
+    0x00, 0x40, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xBF,
+    // 0xFC 'ü'
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x04,
+    0x61, 0x00, 0x02, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x80, 0x21,
+    0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x12,
+    0x81, 0x00, 0x04, 0x81, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    // 0xFE 'þ'
+    0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x7F, 0xCF, 0xF8, 0xF3, 0x00, 0x10, 0x04, 0x0B,
+    0x00, 0x90, 0x04, 0x83, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x04, 0x10, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x07, 0xC0, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x19, 0x01, 0x40, 0x00, 0x25, 0x01, 0x20, 0x00, 0x21,
+    0x01, 0x08, 0x00, 0x21, 0x11, 0x02, 0x00, 0x21, 0x81, 0x00, 0x80, 0x05,
+    0x01, 0x00, 0x10, 0x41, 0x91, 0x20, 0x04, 0x89, 0x01, 0x44, 0x00, 0x01,
+    0x01, 0x80, 0x80, 0x01, 0x60, 0x00, 0x20, 0x41, 0x80, 0x00, 0x81, 0x01,
+    0x01, 0x04, 0x04, 0x01, 0x81, 0x60, 0x10, 0x01, 0x61, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x00, 0x01, 0x01, 0x08, 0x00, 0x01, 0x01, 0x20, 0x00, 0x01,
+    0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x80, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x40, 0x30, 0x07, 0x01, 0x00, 0x90, 0x07, 0x04, 0x08, 0x0C, 0x07,
+    0x20, 0x24, 0x00, 0x07, 0x41, 0x04, 0x00, 0x07, 0x02, 0x04, 0x00, 0x07,
+    0x00, 0x44, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07, 0x20, 0x00, 0x80, 0xE7,
+    0x04, 0x00, 0x30, 0x07, 0x00, 0x80, 0x02, 0x07, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x82, 0x07, 0x00, 0x00, 0x20, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x04, 0x07,
+    // 0x105 'ą'
+    0x00, 0x1E, 0x00, 0x10, 0x00, 0x80, 0x22, 0x40, 0x00, 0x02, 0x00, 0x00,
+    0x46, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x80,
+    0x08, 0x20, 0x00, 0x00, 0x01, 0x1C, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x02, 0x80, 0x00, 0x03, 0x02,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x7F, 0x01, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x86, 0x05,
+    0x00, 0x40, 0x00, 0x81, 0x00, 0x00, 0x00, 0x41, 0x08, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x20, 0x80, 0x00, 0x23,
+    0x04, 0x00, 0x00, 0x21, 0x00, 0x0C, 0x00, 0x21, 0x28, 0x00, 0x00, 0x21,
+    0x00, 0x41, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31,
+    // 0x107 'ć'
+    0x00, 0x01, 0x8C, 0x1F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x22, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x00, 0x3F, 0x42, 0x00, 0x00, 0x3F,
+    0x44, 0x03, 0x00, 0x1F, 0x08, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x11, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0xFE, 0x03, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x0C, 0x0B,
+    0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x47,
+    0x08, 0x00, 0x00, 0x43, 0x90, 0x18, 0x00, 0x43, 0x20, 0x00, 0x00, 0x43,
+    0x40, 0x82, 0x00, 0x0B, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63,
+    // 0x10D 'č'
+    0x00, 0x03, 0x18, 0x3F, 0x00, 0x08, 0x02, 0x3F, 0x40, 0x10, 0x00, 0x3F,
+    0x10, 0x20, 0x00, 0xBF, 0x88, 0x00, 0x00, 0x3F, 0x00, 0x44, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x12, 0x00, 0x00, 0x7F, 0x22, 0x00, 0x00, 0x7F,
+    0x44, 0x06, 0x00, 0x3F, 0x90, 0x40, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x00, 0x22, 0x04, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x10E 'Ď'
+    0x00, 0xA0, 0x00, 0x13, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x04, 0x1F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x90, 0x10, 0x00, 0x4B, 0x20, 0x80, 0x00, 0x03, 0xC0, 0x80, 0x00, 0x03,
+    0x00, 0x02, 0x02, 0x13, 0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x01, 0x03, 0x00, 0x02, 0x0C, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x10F 'ď'
+    0x00, 0x06, 0x18, 0x7F, 0x00, 0x10, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x88, 0x10, 0xFF,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x09, 0x7F, 0x4F, 0x0F, 0xF2, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x79, 0x00, 0x03, 0x7F,
+    0x01, 0x00, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0xA0, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x1F, 0x8F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x0F,
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x40, 0x1F, 0x00, 0x11, 0x00, 0x0F,
+    0x02, 0x02, 0x00, 0x0F, 0x84, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0x119 'ę'
+    0x03, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80,
+    0x02, 0x30, 0x00, 0x49, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5C,
+    0x01, 0x00, 0x42, 0x01, 0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x00, 0x40,
+    0x20, 0x00, 0x80, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00,
+    // 0x11A 'Ě'
+    0x00, 0xA0, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x40, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x20, 0x1F, 0x8F, 0xC7, 0x10, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x10, 0x00, 0x47, 0x00, 0x00, 0x11, 0x07,
+    0x00, 0x02, 0x02, 0x07, 0x00, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    // 0x11B 'ě'
+    0x00, 0x03, 0x08, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x10, 0x20, 0x00, 0xBF, 0x88, 0x02, 0x30, 0x3F, 0x44, 0x49, 0x00, 0x3F,
+    0x02, 0x01, 0x00, 0x3F, 0x02, 0x01, 0x00, 0x7F, 0x22, 0x01, 0x00, 0x7F,
+    0x44, 0x01, 0x00, 0x3F, 0x80, 0x40, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x139 'Ĺ'
+    0x00, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x03, 0x44, 0x0F, 0xFF, 0xE3, 0x40, 0x10, 0x00, 0x03,
+    0x38, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    // 0x13A 'ĺ'
+    0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x14, 0x80, 0x00, 0x09,
+    0x04, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x01, 0x08, 0xFF, 0xFF, 0xF9, 0x80, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x13D 'Ľ'
+    0x14, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x20, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    // 0x13E 'ľ'
+    0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0xA0, 0x14, 0x17, 0x00, 0x00, 0x07,
+    0x00, 0x20, 0x27, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x1F, 0x1F, 0xC7, 0x20, 0x00, 0x07, 0x01, 0x40, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    // 0x142 'ł'
+    0x00, 0x00, 0x00, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xCF, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x0F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x11, 0x00, 0x00, 0x00, 0x11,
+    0x02, 0x10, 0x10, 0x01, 0x02, 0x00, 0x00, 0x01, 0x12, 0x02, 0x02, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x40, 0x01, 0x44, 0x00, 0x20, 0x21,
+    0x40, 0x50, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x20, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F,
+    0x08, 0x04, 0x00, 0xBF, 0x01, 0x24, 0x00, 0x3F, 0x42, 0x04, 0x00, 0xFF,
+    0x44, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0xA0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x1F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x90, 0x01, 0x00, 0x23, 0x88, 0x00, 0x00, 0x23,
+    0x00, 0x20, 0x20, 0x03, 0x20, 0x00, 0x00, 0x03, 0x10, 0x04, 0x04, 0x03,
+    0x20, 0x00, 0x02, 0x03, 0x40, 0x00, 0x80, 0x03, 0x80, 0x00, 0x40, 0x43,
+    0x00, 0xA0, 0x00, 0x03, 0x80, 0x20, 0x08, 0x0B, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    0x12, 0x08, 0x01, 0x7F, 0x12, 0x48, 0x00, 0x7F, 0x22, 0x08, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFF,
+    // 0x152 'Œ'
+    0x00, 0xFC, 0x03, 0x04, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x13, 0x41, 0x02, 0x03, 0x04, 0x00, 0x0B, 0x08, 0x00, 0x03,
+    0x90, 0x00, 0x43, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x1F, 0x8F, 0xC3, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x0C, 0x00, 0x43, 0x00, 0x60, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x03,
+    // 0x153 'œ'
+    0x03, 0x18, 0x3F, 0x08, 0x02, 0x3F, 0x10, 0x00, 0x3F, 0x20, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x44, 0x08, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x7F,
+    0x00, 0x02, 0x3F, 0x08, 0x00, 0x3F, 0x04, 0x04, 0x3F, 0x40, 0x00, 0xBF,
+    0x00, 0x01, 0x3F, 0x00, 0x01, 0x3F, 0x20, 0x00, 0x3F, 0x02, 0x30, 0x3F,
+    0x49, 0x00, 0x3F, 0x01, 0x00, 0x3F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x00, 0xBF,
+    0x00, 0x05, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x158 'Ř'
+    0x00, 0xA0, 0x00, 0x13, 0x00, 0x80, 0x00, 0x03, 0x00, 0x80, 0x00, 0x23,
+    0xA0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x1F, 0xC7, 0xC3, 0x10, 0x00, 0x00, 0x23,
+    0x20, 0x00, 0x02, 0x03, 0x08, 0x00, 0x41, 0x03, 0x90, 0x10, 0x00, 0x03,
+    0x20, 0x07, 0x00, 0x03, 0xC0, 0x80, 0x04, 0x13, 0x00, 0x00, 0x22, 0x03,
+    0x00, 0x00, 0x41, 0x03, 0x00, 0x10, 0x80, 0x83, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    // 0x159 'ř'
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F,
+    0x20, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x12, 0x10, 0x00, 0x7F, 0x12, 0x20, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x08, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+    0x40, 0x04, 0x00, 0x7F, 0x00, 0x30, 0x00, 0x7F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x08, 0x41, 0x05, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x40, 0x08, 0x21, 0x06, 0x06, 0x00, 0x03,
+    0x02, 0x00, 0x04, 0x13, 0x12, 0x00, 0x00, 0x13, 0x00, 0x90, 0x02, 0x13,
+    0x00, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0xC1, 0x40, 0x02, 0x00, 0x05,
+    0x10, 0x01, 0x10, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x38, 0x04, 0x21,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x10, 0x08, 0x1F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x20, 0x11, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x11, 0x09, 0x00, 0x3F, 0x02, 0x08, 0x08, 0x1F, 0x00, 0x08, 0x85, 0x1F,
+    0x08, 0x04, 0x00, 0x1F, 0x00, 0x21, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x1C, 0x12, 0x1F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0xC3, 0x00, 0x10, 0x82, 0x0B, 0x40, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x03, 0x80, 0x80, 0x10, 0x43, 0x40, 0x0C, 0x00, 0x07,
+    0x20, 0x00, 0x08, 0x27, 0x00, 0x00, 0x00, 0x27, 0x01, 0x20, 0x04, 0x27,
+    0x04, 0x00, 0x00, 0x03, 0x08, 0x00, 0x01, 0x83, 0x00, 0x04, 0x00, 0x0B,
+    0x80, 0x02, 0x20, 0x03, 0x00, 0x80, 0x00, 0x03, 0x00, 0x70, 0x08, 0x43,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x161 'š'
+    0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x20, 0x10, 0x3F,
+    0x88, 0x00, 0x04, 0x3F, 0x44, 0x40, 0x22, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x02, 0x12, 0x00, 0x7F, 0x22, 0x10, 0x10, 0x3F, 0x44, 0x11, 0x0A, 0x3F,
+    0x80, 0x08, 0x00, 0x3F, 0xA0, 0x42, 0x80, 0x3F, 0x40, 0x00, 0x01, 0x3F,
+    0x00, 0x38, 0x24, 0x3F,
+    // 0x164 'Ť'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x82, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x40, 0x00, 0x00, 0x17,
+    0x90, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x80, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x00, 0xF0, 0x00, 0x07,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x9F, 0xF8, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x08, 0xFF,
+    0x00, 0x80, 0x00, 0x7F, 0x82, 0x80, 0x00, 0x7F, 0x82, 0x80, 0x00, 0x7F,
+    0x98, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x20, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x41,
+    0x40, 0x10, 0x00, 0x21, 0x19, 0x60, 0x00, 0x03, 0xA1, 0x00, 0x00, 0x03,
+    0xA1, 0x00, 0x00, 0x03, 0x19, 0x00, 0x00, 0x03, 0x00, 0x50, 0x00, 0x01,
+    0x24, 0x10, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x10, 0x04, 0x3F, 0x50, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x00, 0x1F, 0x02, 0x80, 0x00, 0x1F, 0x4C, 0x00, 0x02, 0x5F,
+    0x00, 0x20, 0x00, 0x9F, 0x1C, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    // 0x170 'Ű'
+    0x00, 0x20, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x41,
+    0x12, 0x10, 0x00, 0x21, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x88, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x03, 0x06, 0x50, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0x85, 0x04, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x81,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x20, 0x00, 0x1F,
+    0x04, 0x20, 0x00, 0x1F, 0x00, 0x10, 0x04, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x44, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F, 0x06, 0x00, 0x02, 0x5F,
+    0x10, 0x20, 0x00, 0x9F, 0x00, 0x20, 0x00, 0x1F, 0x44, 0x20, 0x00, 0x1F,
+    0x10, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    // 0x178 'Ÿ'
+    0x00, 0x80, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x02, 0x00, 0x1F,
+    0x88, 0x00, 0x80, 0x0F, 0x88, 0x00, 0x00, 0x4F, 0x80, 0x50, 0x1F, 0x8F,
+    0x70, 0x04, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x0F,
+    0x00, 0x01, 0x00, 0x0F, 0x89, 0x44, 0x00, 0x0F, 0x88, 0x50, 0x40, 0x4F,
+    0x00, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F,
+    0x00, 0x20, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x25, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x08, 0x01,
+    0x04, 0x00, 0x00, 0x21, 0x0A, 0x00, 0x40, 0x01, 0x12, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x44, 0x00, 0x10, 0x01,
+    0x40, 0x00, 0x00, 0x01, 0x30, 0x00, 0x80, 0x21, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x44, 0x00, 0x01, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00, 0xC1,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x0E, 0x02, 0x5F, 0x00, 0x20, 0x04, 0x1F,
+    0x00, 0x21, 0x00, 0x1F, 0x00, 0x24, 0x00, 0x1F, 0x00, 0x20, 0x40, 0x1F,
+    0x04, 0x20, 0x82, 0x1F, 0x11, 0x20, 0x04, 0x1F, 0x42, 0x24, 0x00, 0x1F,
+    0x04, 0x20, 0x20, 0x1F, 0x08, 0x20, 0x40, 0x1F, 0x00, 0x20, 0x02, 0x1F,
+    0x00, 0x20, 0x08, 0x1F, 0x00, 0x24, 0x00, 0x1F, 0x00, 0x08, 0x0F, 0x1F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x3C, 0x00, 0x4B, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x02, 0x02, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x10, 0x00, 0x00, 0x43, 0x40, 0x00, 0x80, 0x03, 0x04, 0x01, 0x02, 0x03,
+    0x04, 0x00, 0x04, 0x03, 0x00, 0x08, 0x00, 0x03, 0x30, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x88, 0x00, 0x03, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x83,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x38, 0x09, 0x7F, 0x00, 0x80, 0x10, 0x7F,
+    0x00, 0x84, 0x00, 0x7F, 0x00, 0x90, 0x00, 0x7F, 0x30, 0x81, 0x00, 0x7F,
+    0x00, 0x82, 0x08, 0x7F, 0x00, 0x80, 0x10, 0x7F, 0x00, 0x90, 0x00, 0x7F,
+    0x48, 0x80, 0x80, 0x7F, 0x00, 0x81, 0x00, 0x7F, 0x00, 0x80, 0x08, 0x7F,
+    0x00, 0x80, 0x20, 0x7F, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x20, 0x3C, 0x7F,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x3C, 0x00, 0x4B, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x02, 0x02, 0x03, 0x80, 0x08, 0x00, 0x03, 0x80, 0x00, 0x10, 0x03,
+    0x40, 0x00, 0x00, 0x43, 0x20, 0x00, 0x80, 0x03, 0x00, 0x01, 0x02, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x04, 0x08, 0x00, 0x03, 0x08, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0x00, 0x43, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x88, 0x00, 0x03, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x83,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x1C, 0x04, 0xBF, 0x00, 0x40, 0x08, 0x3F,
+    0x10, 0x42, 0x00, 0x3F, 0x88, 0x48, 0x00, 0x3F, 0x44, 0x40, 0x80, 0x3F,
+    0x02, 0x41, 0x04, 0x3F, 0x02, 0x40, 0x08, 0x3F, 0x22, 0x48, 0x00, 0x3F,
+    0x44, 0x40, 0x40, 0x3F, 0x80, 0x40, 0x80, 0x3F, 0xA0, 0x40, 0x04, 0x3F,
+    0x00, 0x40, 0x10, 0x3F, 0x00, 0x48, 0x00, 0x3F, 0x00, 0x10, 0x1E, 0x3F,
+    // 0x3C0 'π'
+    0x04, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0xBF,
+    0x40, 0x0C, 0x3F, 0x41, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0xBF,
+    0x40, 0x0E, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
+    0x47, 0x01, 0x3F, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x41, 0xF0, 0x3F,
+    0x40, 0x04, 0x3F, 0x08, 0x00, 0x3F, 0x08, 0x00, 0xBF, 0x10, 0x03, 0x3F,
+    0x00, 0x00, 0x3F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x01, 0xFF, 0xE1,
+    0x08, 0x00, 0x01, 0x10, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x04, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00, 0x05, 0x10, 0x30, 0x01,
+    0x10, 0x80, 0xC1, 0x02, 0x08, 0x03, 0x08, 0x00, 0x03, 0x00, 0x04, 0x13,
+    0x40, 0x00, 0x03, 0x02, 0x21, 0xC1, 0x28, 0x00, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x02, 0x21,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    // 0x2018 '‘'
+    0x04, 0x9F, 0x10, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x1F,
+    // 0x2019 '’'
+    0x00, 0x1F, 0x20, 0xDF, 0x4E, 0x1F, 0x00, 0x5F, 0x00, 0x9F, 0x42, 0x1F,
+    0x00, 0x1F,
+    // 0x201A '‚'
+    0x00, 0x3F, 0x41, 0x3F, 0x9C, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x04, 0x3F,
+    0x00, 0x3F,
+    // 0x201B '‛'
+    0x24, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F,
+    // 0x201C '“'
+    0x04, 0x9F, 0x10, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x1F,
+    0x04, 0x9F, 0x10, 0x1F, 0x40, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x1F,
+    // 0x201D '”'
+    0x00, 0x1F, 0x20, 0xDF, 0x4E, 0x1F, 0x00, 0x5F, 0x00, 0x9F, 0x42, 0x1F,
+    0x00, 0x1F, 0x20, 0xDF, 0x4E, 0x1F, 0x00, 0x5F, 0x00, 0x9F, 0x42, 0x1F,
+    0x00, 0x1F,
+    // 0x201E '„'
+    0x00, 0x3F, 0x41, 0x3F, 0x9C, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x04, 0x3F,
+    0x00, 0x3F, 0x41, 0x3F, 0x9C, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x04, 0x3F,
+    0x00, 0x3F,
+    // 0x201F '‟'
+    0x24, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F,
+    0x24, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F,
+    // 0x2020 '†'
+    0x00, 0x00, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x0F, 0x72, 0x00, 0x6F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x62, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x0F, 0x00, 0x40, 0x0F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0x01, 0x00, 0x62, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x62, 0x01, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00,
+    // 0x2022 '•'
+    0x1C, 0x42, 0x00, 0x00, 0x00, 0x42, 0x3C,
+    // 0x2026 '…'
+    0x33, 0x03, 0x07, 0x07, 0x03, 0x33, 0x03, 0x03, 0x03, 0x03, 0x33, 0x03,
+    0x07, 0x07, 0x03, 0x33, 0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0x07, 0x07,
+    0x03, 0x33,
+    // 0x2039 '‹'
+    0x00, 0x0F, 0x01, 0x0F, 0x00, 0x8F, 0x00, 0x4F, 0x20, 0x2F, 0x44, 0x0F,
+    0x08, 0x9F, 0x00, 0x4F, 0x40, 0x2F,
+    // 0x203A '›'
+    0x40, 0x2F, 0x00, 0x4F, 0x08, 0x9F, 0x44, 0x0F, 0x20, 0x0F, 0x00, 0x4F,
+    0x00, 0x8F, 0x01, 0x0F, 0x00, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x01, 0x10, 0x11, 0x20, 0x01, 0x40, 0x05, 0x04, 0x41, 0x90, 0x11,
+    0x80, 0x11, 0x80, 0x11, 0x90, 0x21, 0x00, 0x05, 0x40, 0x09, 0x20, 0x11,
+    0x0F, 0xC1,
+    // 0x2074 '⁴'
+    0x00, 0x01, 0x00, 0x81, 0x00, 0x01, 0x00, 0x01, 0x08, 0x01, 0x02, 0x01,
+    0x04, 0x01, 0x07, 0x9D, 0x00, 0x01, 0x80, 0x01, 0x7F, 0x9D, 0x00, 0x01,
+    0x00, 0x61,
+    // 0x2075 '⁵'
+    0x00, 0x01, 0x00, 0x05, 0x70, 0x01, 0x00, 0x01, 0x01, 0x11, 0x10, 0x11,
+    0x04, 0xA1, 0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41,
+    // 0x2076 '⁶'
+    0x00, 0xC1, 0x00, 0x01, 0x10, 0x01, 0x20, 0x01, 0x01, 0x01, 0x0C, 0x01,
+    0x05, 0x01, 0x84, 0x81, 0x84, 0x05, 0xA0, 0x01, 0x41, 0x11, 0x00, 0x01,
+    // 0x2077 '⁷'
+    0x00, 0x01, 0x00, 0x01, 0x04, 0x01, 0x18, 0x25, 0x00, 0x81, 0x02, 0x01,
+    0x00, 0x11, 0x10, 0x81, 0x02, 0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x31, 0x24, 0x81, 0x43, 0x05, 0x00, 0x21, 0x88, 0x81, 0xA4, 0x01,
+    0xA4, 0x01, 0x98, 0x51, 0x02, 0x05, 0x41, 0x01, 0x18, 0x91,
+    // 0x2079 '⁹'
+    0x0C, 0x01, 0x01, 0x05, 0x00, 0x81, 0x00, 0x11, 0x82, 0x01, 0x80, 0x21,
+    0x80, 0x45, 0x0E, 0x01, 0x00, 0x01, 0x00, 0x21, 0x10, 0x81, 0x00, 0x01,
+    // 0x2080 '₀'
+    0x00, 0x01, 0x10, 0x11, 0x20, 0x01, 0x40, 0x05, 0x04, 0x61, 0x90, 0x11,
+    0x80, 0x01, 0x80, 0x11, 0x80, 0x21, 0x00, 0x05, 0x40, 0x01, 0x20, 0x11,
+    0x0F, 0xC1,
+    // 0x2081 '₁'
+    0x30, 0x07, 0x00, 0x03, 0x00, 0x03, 0x4F, 0xE3, 0x00, 0x03, 0x80, 0x03,
+    0x00, 0x03, 0x00, 0x13, 0x00, 0x03, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x03, 0x00, 0x07, 0x44, 0x03, 0x04, 0x43, 0x90, 0x83, 0x81, 0x23,
+    0x82, 0x03, 0x00, 0x03, 0x00, 0x03, 0x40, 0x03, 0x1C, 0x07, 0x00, 0x03,
+    // 0x2083 '₃'
+    0x00, 0x01, 0x08, 0x01, 0x08, 0x01, 0x12, 0x81, 0x80, 0x11, 0xA0, 0x11,
+    0x80, 0xA1, 0x00, 0x05, 0x02, 0x01, 0x45, 0x01, 0x00, 0xE1,
+    // 0x2084 '₄'
+    0x00, 0x01, 0x00, 0x81, 0x00, 0x01, 0x00, 0x11, 0x08, 0x11, 0x12, 0x11,
+    0x04, 0x11, 0x07, 0x9D, 0x00, 0x01, 0x80, 0x01, 0x7F, 0x9D, 0x00, 0x11,
+    0x00, 0x61,
+    // 0x2085 '₅'
+    0x00, 0x01, 0x00, 0x05, 0x71, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x11,
+    0x14, 0x81, 0x10, 0x05, 0x10, 0x01, 0x10, 0x01, 0x00, 0x41,
+    // 0x2086 '₆'
+    0x00, 0xC1, 0x00, 0x01, 0x10, 0x01, 0x20, 0x01, 0x01, 0x01, 0x0D, 0x01,
+    0x05, 0x01, 0x84, 0x81, 0x80, 0x01, 0xA0, 0x01, 0x61, 0x01, 0x00, 0x01,
+    // 0x2087 '₇'
+    0x00, 0x01, 0x00, 0x01, 0x04, 0x01, 0x08, 0x21, 0x10, 0x81, 0x12, 0x01,
+    0x10, 0x11, 0x10, 0x81, 0x02, 0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x31, 0x24, 0x81, 0x43, 0x01, 0x00, 0x21, 0x80, 0x01, 0xA0, 0x81,
+    0xA0, 0x01, 0x98, 0x51, 0x00, 0x05, 0x40, 0x01, 0x18, 0x11,
+    // 0x2089 '₉'
+    0x0C, 0x01, 0x20, 0x01, 0x40, 0x81, 0x00, 0x01, 0x92, 0x11, 0x80, 0x61,
+    0x81, 0x45, 0x0E, 0x01, 0x00, 0x01, 0x00, 0x21, 0x10, 0x81, 0x00, 0x01,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x0C, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x01, 0x01, 0x03,
+    0x04, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x02, 0x0B,
+    0x44, 0x00, 0x83, 0x08, 0x00, 0x43, 0x00, 0x00, 0x03, 0x90, 0x00, 0x07,
+    0x80, 0x08, 0x07, 0x80, 0x80, 0x03, 0x80, 0x00, 0x03, 0x82, 0x00, 0x03,
+    0x02, 0x00, 0x0B, 0x04, 0x00, 0x53, 0x00, 0x00, 0x03,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x00, 0x1F, 0x90, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x3F, 0x9F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x9F, 0x00, 0x1F, 0x00, 0x1F, 0x90, 0x1F, 0x00, 0x1F,
+    0x00, 0x9F, 0x3C, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x82, 0x1F, 0x10, 0x1F,
+    0x00, 0x1F, 0x20, 0x1F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x41, 0x1F,
+    0x00, 0x5F,
+    // 0x2153 '⅓'
+    0x0C, 0x03, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x05, 0x02, 0x3F, 0x00, 0x05, 0x08, 0xBF,
+    0x00, 0x00, 0x20, 0xBF, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x08, 0x3F,
+    0x00, 0x04, 0x20, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x08, 0x40, 0x00, 0x3F,
+    0x20, 0x00, 0x04, 0x3F, 0x42, 0x04, 0x00, 0x3F, 0x08, 0x04, 0x00, 0x3F,
+    0x20, 0x09, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x08, 0x3F,
+    0x00, 0x4C, 0x50, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x00, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F, 0x20, 0x49, 0x00, 0x3F,
+    0x20, 0x11, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F, 0x00, 0x01, 0x03, 0x3F,
+    0x10, 0x01, 0x00, 0xBF, 0x06, 0x01, 0x10, 0x3F, 0x00, 0x00, 0x41, 0x3F,
+    0x00, 0x00, 0x04, 0x3F, 0x00, 0x02, 0x10, 0x3F, 0x00, 0x08, 0x40, 0x3F,
+    0x00, 0x21, 0x00, 0x3F, 0x00, 0x84, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x08, 0x20, 0x00, 0x3F, 0x20, 0x80, 0x04, 0x3F, 0x42, 0x04, 0x00, 0x3F,
+    0x00, 0x04, 0x00, 0x3F, 0x30, 0x09, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x08, 0x3F, 0x00, 0x4C, 0x50, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x02, 0x80, 0x3F, 0x00, 0x00, 0x20, 0x3F,
+    // 0x215B '⅛'
+    0x0C, 0x03, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x13, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x3F, 0x20, 0x01, 0x00, 0x3F,
+    0x00, 0x01, 0x00, 0x3F, 0x00, 0x05, 0x02, 0x3F, 0x00, 0x05, 0x00, 0xBF,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x01, 0x04, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x00, 0x08, 0x40, 0x3F, 0x00, 0x21, 0x00, 0x3F,
+    0x00, 0x84, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x08, 0x20, 0x00, 0x3F,
+    0x20, 0x80, 0x38, 0x3F, 0x02, 0x12, 0x40, 0x3F, 0x00, 0x20, 0x80, 0x3F,
+    0x30, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x50, 0x45, 0x3F,
+    0x00, 0x52, 0x00, 0x3F, 0x00, 0x0C, 0x18, 0x3F, 0x00, 0x00, 0x82, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x28, 0x3F,
+    // 0x215C '⅜'
+    0x00, 0x00, 0x00, 0x3F, 0x10, 0x01, 0x00, 0x3F, 0x02, 0x04, 0x00, 0x3F,
+    0x20, 0x04, 0x00, 0x3F, 0x28, 0x04, 0x00, 0x3F, 0x29, 0x00, 0x00, 0x3F,
+    0x22, 0x09, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x04, 0x3F,
+    0x10, 0x00, 0x00, 0xBF, 0x00, 0x38, 0x20, 0x3F, 0x00, 0x00, 0x82, 0x3F,
+    0x00, 0x00, 0x08, 0x3F, 0x00, 0x04, 0x20, 0x3F, 0x00, 0x10, 0x80, 0x3F,
+    0x00, 0x42, 0x00, 0x3F, 0x01, 0x08, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x3F,
+    0x10, 0x40, 0x00, 0x3F, 0x41, 0x00, 0x38, 0x3F, 0x44, 0x12, 0x40, 0x3F,
+    0x00, 0x20, 0x80, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x50, 0x45, 0x3F, 0x00, 0x52, 0x00, 0x3F, 0x00, 0x0C, 0x18, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x28, 0x3F,
+    // 0x215D '⅝'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x3F, 0x1C, 0x04, 0x00, 0x3F,
+    0x20, 0x04, 0x00, 0x3F, 0x20, 0x44, 0x00, 0x3F, 0x20, 0x40, 0x00, 0x3F,
+    0x20, 0x09, 0x00, 0x3F, 0x21, 0x00, 0x01, 0x3F, 0x20, 0x02, 0x04, 0x3F,
+    0x20, 0x04, 0x10, 0x3F, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x00, 0x84, 0x3F,
+    0x00, 0x02, 0x10, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x02, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x3F, 0x04, 0x20, 0x00, 0x3F,
+    0x10, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x38, 0x3F, 0x44, 0x12, 0x40, 0x3F,
+    0x10, 0x20, 0x80, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x50, 0x45, 0x3F, 0x00, 0x52, 0x00, 0x3F, 0x00, 0x0C, 0x18, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x28, 0x3F,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x21, 0x00, 0x00, 0x3F,
+    0x24, 0x09, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x80, 0x00, 0x3F,
+    0x20, 0x0C, 0x01, 0x3F, 0x24, 0x20, 0x04, 0x3F, 0x20, 0x80, 0x10, 0x3F,
+    0x20, 0x00, 0x01, 0x3F, 0x04, 0x00, 0x04, 0x3F, 0x00, 0x02, 0x10, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x02, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x10, 0x80, 0x00, 0x3F,
+    0x40, 0x00, 0x00, 0x3F, 0x44, 0x00, 0x38, 0x3F, 0x10, 0x12, 0x40, 0x3F,
+    0x00, 0x20, 0x80, 0x3F, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x50, 0x45, 0x3F, 0x00, 0x52, 0x00, 0x3F, 0x00, 0x0C, 0x18, 0x3F,
+    0x00, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x28, 0x3F,
+    // 0x2190 '←'
+    0x00, 0x01, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x04, 0x41,
+    0x40, 0x21, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x07, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x07, 0xFF, 0xEF, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01,
+    0x00, 0x05, 0x40, 0x21, 0x24, 0x41, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+    0x02, 0x01, 0x00, 0x01,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0xFF, 0xFE, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2194 '↔'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x08, 0x07,
+    0x10, 0x4F, 0x00, 0x37, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x37, 0x10, 0x4F, 0x08, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x07, 0x04, 0x03, 0x07, 0x08, 0x04, 0x87, 0x01, 0x00, 0x47,
+    0x00, 0x00, 0x27, 0x07, 0xFF, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x07, 0xFF, 0x17, 0x00, 0x00, 0x27, 0x01, 0x04, 0x47, 0x08, 0x04, 0x87,
+    0x04, 0x03, 0x07, 0x00, 0x00, 0x07,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x7F,
+    0x01, 0x40, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x0D, 0x00, 0x7F,
+    0x11, 0x00, 0x7F, 0x21, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x08, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F,
+    0x01, 0x00, 0x1F, 0x01, 0xFF, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x90, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x01, 0xFF, 0xFF, 0x01, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x7F, 0x01, 0x08, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x21, 0x00, 0x7F, 0x11, 0x00, 0x7F,
+    0x0D, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x40, 0x7F,
+    0x00, 0x80, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0xBF, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xBF, 0xF8, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D4 '⇔'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x03, 0x0A, 0x01, 0x2A, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x2A, 0x05,
+    0x1A, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x04, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x10, 0x10, 0x01, 0x7F, 0x08, 0x20, 0x00, 0x7F, 0x40, 0x42, 0x08, 0x7F,
+    0x10, 0x08, 0x04, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x80, 0x80, 0x08, 0x7F,
+    0x90, 0x80, 0x11, 0x7F, 0x08, 0x10, 0x42, 0x7F, 0x03, 0x8C, 0x00, 0x7F,
+    0x40, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x80, 0x7F,
+    0x03, 0xF8, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x23, 0x00, 0x01, 0x03, 0x00, 0x04, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x80, 0x93, 0x02, 0x02, 0x13, 0x10, 0x10, 0x13,
+    0x00, 0x80, 0x13, 0x02, 0x00, 0x13, 0x01, 0x00, 0x13, 0x00, 0x20, 0x13,
+    0x00, 0x04, 0x13, 0x10, 0x00, 0x93, 0x02, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x1F, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x20, 0x00, 0x02, 0xBF, 0x88, 0x00, 0x00, 0x7F, 0x84, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x12, 0x10, 0x7F, 0x04, 0x00, 0x20, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x20, 0x3F, 0x80, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x23, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x08, 0x00, 0xC7, 0x00, 0x01, 0x80, 0x07, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0xC0, 0x27,
+    0x00, 0x04, 0x01, 0x07, 0x00, 0x20, 0x18, 0x07, 0x03, 0x00, 0x80, 0x07,
+    0x10, 0x04, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x0F, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x8A, 0x3F, 0x80, 0x3F, 0x80, 0x3F,
+    0x90, 0x1F, 0x00, 0x5F, 0x20, 0x9F, 0x00, 0x1F, 0x20, 0x1F, 0x4A, 0x1F,
+    0x11, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x8E, 0x3F, 0x00, 0x1F, 0x00, 0x9F,
+    0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x0C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x90, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x2260 '≠'
+    0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x42, 0x02, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x00, 0x40, 0x02, 0x40, 0x12, 0x40,
+    0x02, 0x40, 0x02, 0x40,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x08, 0x00, 0x3F,
+    0x00, 0x40, 0x3F, 0x12, 0x00, 0x3F, 0x01, 0x20, 0x3F, 0x24, 0x00, 0x3F,
+    0x00, 0x90, 0x3F, 0x48, 0x00, 0x3F, 0x00, 0x48, 0x3F, 0x90, 0x00, 0x3F,
+    0x80, 0x24, 0x3F, 0x20, 0x10, 0x3F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x1F, 0x30, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x48, 0x04, 0x1F,
+    0x00, 0x20, 0x1F, 0x24, 0x08, 0x1F, 0x00, 0x40, 0x1F, 0x12, 0x10, 0x1F,
+    0x00, 0x80, 0x1F, 0x09, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x40, 0x1F,
+    0x00, 0x00, 0x1F, 0x02, 0x80, 0x1F,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly30BoldColOffsets[] PROGMEM = {
+    0x0, 0x1E, 0x30, 0x46, 0x7F, 0xBB, 0x127, 0x16F, 0x179, 0x1A1, 0x1CD, 0x1E3,
+    0x1FF, 0x20F, 0x219, 0x220, 0x24D, 0x283, 0x2AD, 0x2E0, 0x310, 0x349, 0x376, 0x3A6,
+    0x3D6, 0x406, 0x436, 0x44B, 0x463, 0x47F, 0x49B, 0x4B7, 0x4DE, 0x54E, 0x593, 0x5C9,
+    0x5FF, 0x641, 0x677, 0x6A7, 0x6E3, 0x72B, 0x74C, 0x784, 0x7C6, 0x7FC, 0x850, 0x89B,
+    0x8DD, 0x913, 0x96F, 0x9AE, 0x9DE, 0xA1D, 0xA65, 0xAAD, 0xB10, 0xB55, 0xB97, 0xBCD,
+    0xBED, 0xC1A, 0xC3A, 0xC58, 0xC67, 0xC6E, 0xC9E, 0xCEA, 0xD14, 0xD5C, 0xD89, 0xDB9,
+    0xE01, 0xE3D, 0xE5E, 0xE86, 0xED2, 0xEF0, 0xF4A, 0xF86, 0xFB9, 0xFEF, 0x1022, 0x104C,
+    0x1073, 0x109D, 0x10D9, 0x1115, 0x1166, 0x118C, 0x11C8, 0x11F5, 0x1221, 0x1235, 0x1261, 0x1270,
+    0x1282, 0x12C2, 0x12F8, 0x131A, 0x1359, 0x1383, 0x13C8, 0x13DE, 0x1400, 0x1433, 0x144B, 0x1475,
+    0x148D, 0x14A3, 0x14DF, 0x1523, 0x152A, 0x153E, 0x1554, 0x1574, 0x15EC, 0x1664, 0x16E0, 0x1704,
+    0x1760, 0x17BC, 0x1818, 0x1874, 0x18D0, 0x192C, 0x1986, 0x19CE, 0x1A16, 0x1A5E, 0x1AA6, 0x1AEE,
+    0x1B1A, 0x1B46, 0x1B76, 0x1BA6, 0x1BEB, 0x1C4F, 0x1CA7, 0x1CFF, 0x1D57, 0x1DAF, 0x1E07, 0x1E21,
+    0x1E66, 0x1EC6, 0x1F26, 0x1F86, 0x1FE6, 0x201C, 0x2068, 0x20A8, 0x20E8, 0x2128, 0x2168, 0x2198,
+    0x21D8, 0x221D, 0x2255, 0x2291, 0x22CD, 0x2309, 0x2336, 0x2362, 0x238E, 0x23BA, 0x23DB, 0x241B,
+    0x2457, 0x249B, 0x24DF, 0x2523, 0x2567, 0x259A, 0x25B6, 0x25EC, 0x263C, 0x268C, 0x26DC, 0x2718,
+    0x2760, 0x27B0, 0x280C, 0x283C, 0x2884, 0x28BC, 0x2904, 0x293C, 0x2994, 0x29E8, 0x2A30, 0x2A5D,
+    0x2AA5, 0x2AE1, 0x2B29, 0x2B51, 0x2B87, 0x2BB1, 0x2BED, 0x2C11, 0x2C75, 0x2CC5, 0x2D29, 0x2D79,
+    0x2DD0, 0x2E1E, 0x2E72, 0x2EAA, 0x2EEA, 0x2F1E, 0x2F5E, 0x2F92, 0x2FE6, 0x301E, 0x307E, 0x30CE,
+    0x312E, 0x317E, 0x31D6, 0x321E, 0x325A, 0x32A2, 0x32DE, 0x3326, 0x3362, 0x33A1, 0x33E3, 0x33F2,
+    0x3410, 0x341C, 0x342A, 0x3438, 0x3444, 0x345C, 0x3476, 0x3490, 0x34A8, 0x34D2, 0x34FF, 0x3506,
+    0x3520, 0x3532, 0x3544, 0x355E, 0x3578, 0x358E, 0x35A6, 0x35BE, 0x35D4, 0x35EC, 0x3606, 0x361A,
+    0x3632, 0x3648, 0x3662, 0x3678, 0x3690, 0x36A8, 0x36BE, 0x36D6, 0x36FD, 0x3724, 0x375D, 0x3784,
+    0x37AB, 0x37D2, 0x3804, 0x3878, 0x38F0, 0x3964, 0x39DC, 0x3A54, 0x3ACC, 0x3AF4, 0x3B1E, 0x3B46,
+    0x3B70, 0x3B98, 0x3BC2, 0x3BFE, 0x3C34, 0x3C70, 0x3CA6, 0x3CCE, 0x3D0E, 0x3D4A, 0x3DAA, 0x3DF6,
+    0x3E46, 0x3E6C, 0x3EB0, 0x3ECC, 0x3EF6, 0x3F20, 0x3F47, 0x3F6E, 0x3F95, 0x3FBC, 0x3FE3, 0x400A,
+    0x4031, 0x4058, 0x407F, 0x40A6, 0x40CD, 0x40F4, 0x411B, 0x4142, 0x4169, 0x4190, 0x41B7, 0x41DE,
+    0x4205, 0x422C, 0x4253
+};
+
+
 const SimpleGFXfont Bookerly30Bold PROGMEM = {Bookerly30BoldBitmaps, Bookerly30BoldBitmaps_lsb, Bookerly30BoldBitmaps_msb, Bookerly30BoldGlyphs,
-    315, 32};
+    315, 32,
+    nullptr, 0, FontStyle::REGULAR, Bookerly30BoldGlyphIndexLatin1, Bookerly30BoldGlyphRanges, 13,
+    Bookerly30BoldBitmapsCol, Bookerly30BoldBitmapsCol_lsb, Bookerly30BoldBitmapsCol_msb, Bookerly30BoldColOffsets};
@@ -6240,5 +6240,5835 @@ const SimpleGFXglyph Bookerly30BoldItalicGlyphs[] PROGMEM = {
 };
 
 
+const uint16_t Bookerly30BoldItalicGlyphIndexLatin1[256] PROGMEM = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0, 0x1, 0x2, 0x3,
+    0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFFFF, 0x64,
+    0xFFFF, 0x65, 0x66, 0x67, 0xFFFF, 0xFFFF, 0x68, 0xFFFF, 0x69, 0x6A, 0x6B, 0x6C,
+    0xFFFF, 0x6D, 0x6E, 0x6F, 0xFFFF, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x90, 0x91, 0x92, 0x93, 0xFFFF, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xFFFF, 0xB3, 0xB4
+};
+
+
+const SimpleGFXrange Bookerly30BoldItalicGlyphRanges[] PROGMEM = {
+    {0x104, 4, 181},
+    {0x10C, 4, 185},
+    {0x118, 4, 189},
+    {0x141, 4, 197},
+    {0x158, 4, 205},
+    {0x16E, 4, 213},
+    {0x178, 7, 217},
+    {0x2018, 11, 228},
+    {0x2074, 6, 243},
+    {0x2080, 10, 249},
+    {0x215B, 4, 268},
+    {0x2190, 6, 272},
+    {0x21D0, 5, 278}
+};
+
+
+const uint8_t Bookerly30BoldItalicBitmapsCol[] PROGMEM = {
+    // 0x20 ' '
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21 '!'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE1, 0xFF, 0xC0, 0x60, 0xF0, 0x00, 0x61,
+    0xC0, 0x00, 0xE3, 0x80, 0x07, 0xFF, 0x80, 0x7F, 0xFF, 0x03, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x22 '"'
+    0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x03, 0xFF, 0x3F, 0xFF,
+    0xF0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    // 0x23 '#'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFC, 0xF1, 0xDF, 0xF8, 0xF0, 0x1F,
+    0xF8, 0x80, 0x1F, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xFF, 0x80, 0x11, 0xFF,
+    0x80, 0xF1, 0xFF, 0x98, 0xF1, 0x1F, 0xF8, 0xF0, 0x1F, 0xF8, 0x00, 0x1F,
+    0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xFF, 0x80, 0xF1, 0xFF,
+    0xF8, 0xF3, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x24 '$'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFF, 0x0F, 0x80, 0xF3, 0xFC, 0x07, 0xF0, 0x83, 0xF8, 0x03, 0xF8, 0x07,
+    0xF8, 0x01, 0xC0, 0x1F, 0xF1, 0xC0, 0x00, 0xFF, 0xF1, 0xC0, 0x18, 0xFF,
+    0xF0, 0x00, 0x78, 0xFF, 0xE0, 0x00, 0x30, 0xFF, 0x00, 0xF8, 0x01, 0xFF,
+    0x00, 0xFC, 0x03, 0xFF, 0xF0, 0x3E, 0x07, 0xFF, 0xF8, 0x1F, 0x9F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x25 '%'
+    0xFF, 0xBF, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x03, 0xFF,
+    0xC1, 0xE3, 0xFF, 0x87, 0xE3, 0xF9, 0x8F, 0xE3, 0xE0, 0x8F, 0xC7, 0xC1,
+    0x80, 0x07, 0x83, 0x80, 0x0E, 0x0F, 0xC0, 0x1C, 0x1F, 0xE0, 0x78, 0x7F,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xFC, 0x3C, 0x07, 0xF0, 0x70, 0x03, 0xE0, 0xE0, 0x01, 0x83, 0xE0, 0xF1,
+    0x07, 0xC7, 0xF1, 0x8F, 0xC7, 0xF1, 0x9F, 0xC7, 0xC3, 0xFF, 0xC0, 0x03,
+    0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F,
+    // 0x26 '&'
+    0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x03,
+    0xFF, 0xC0, 0x03, 0xFF, 0xC7, 0xE3, 0xF0, 0x0F, 0xE3, 0xE0, 0x03, 0xE3,
+    0xC0, 0x00, 0xE3, 0x83, 0x00, 0x63, 0x0F, 0x30, 0x03, 0x1E, 0x3C, 0x03,
+    0x1C, 0x7E, 0x07, 0x18, 0x67, 0x07, 0x00, 0xC7, 0x03, 0x81, 0xCE, 0x03,
+    0x83, 0x88, 0x01, 0xFF, 0x80, 0x61, 0xFF, 0x80, 0xF1, 0xFF, 0x07, 0xF1,
+    0xFF, 0x1F, 0xF0, 0xFF, 0x1F, 0xF9, 0xFE, 0x1F, 0xF9, 0xFE, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x27 '''
+    0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x03, 0xFF, 0x3F, 0xFF,
+    // 0x28 '('
+    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x07, 0xF8, 0x07, 0xF0, 0x3F, 0xFF, 0x07,
+    0xE0, 0xFF, 0xFF, 0xC3, 0xE1, 0xFF, 0xFF, 0xE7, 0xC3, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x29 ')'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x9F, 0xFF, 0xFC, 0x1F, 0x07, 0xFF, 0xF8, 0x3F, 0x81, 0xFF, 0xE0, 0x7F,
+    0xC0, 0x1E, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
+    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    // 0x2A '*'
+    0xFF, 0xFF, 0xE6, 0x7F, 0xC6, 0x3F, 0xC0, 0x3F, 0xF0, 0x7F, 0xC0, 0x1F,
+    0x80, 0x1F, 0x81, 0x1F, 0xD9, 0xBF, 0xF8, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2B '+'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF,
+    // 0x2C ','
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x3F, 0xFC, 0x3F, 0x80, 0x7F, 0x80, 0xFF,
+    0x81, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    // 0x2D '-'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xBF,
+    // 0x2E '.'
+    0xFF, 0x87, 0x83, 0x87, 0x87, 0xFF,
+    // 0x2F '/'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x81,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0x81, 0xFF, 0xFE, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0x81, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x30 '0'
+    0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+    0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x07, 0xC1, 0xFF, 0xC7, 0x83, 0xFF, 0xC7,
+    0x87, 0xFF, 0xC7, 0x0F, 0xFF, 0x87, 0x0F, 0xFF, 0x87, 0x0F, 0xFE, 0x0F,
+    0x0F, 0xF8, 0x1F, 0x03, 0x80, 0x1F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF,
+    0xC0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x31 '1'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xE7, 0xFF, 0xE3,
+    0xE3, 0xFF, 0x83, 0xE3, 0xF0, 0x03, 0xC3, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    0xC0, 0x00, 0x03, 0x80, 0x00, 0x63, 0x80, 0x0F, 0xE3, 0x80, 0xFF, 0xF3,
+    0xDF, 0xFF, 0xFF,
+    // 0x32 '2'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF3, 0xFF, 0x07,
+    0xE1, 0xFE, 0x07, 0xC1, 0xFC, 0x07, 0x83, 0xF8, 0x07, 0x87, 0xF0, 0x07,
+    0x0F, 0xE0, 0x87, 0x0F, 0xC1, 0x87, 0x1F, 0x83, 0x87, 0x0F, 0x03, 0x87,
+    0x04, 0x07, 0x87, 0x00, 0x0F, 0x87, 0x80, 0x1F, 0x87, 0x80, 0x3F, 0xDF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x33 '3'
+    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7,
+    0xE3, 0xFF, 0xC7, 0xC1, 0xCF, 0xC7, 0x83, 0xC7, 0xC7, 0x87, 0x8F, 0x87,
+    0x0F, 0x8F, 0x87, 0x0F, 0x8F, 0x0F, 0x1F, 0x07, 0x0F, 0x0E, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x60, 0x7F, 0xC0, 0xF9, 0xFF,
+    0xE3, 0xFF, 0xFF,
+    // 0x34 '4'
+    0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x18, 0xFF, 0xFC, 0x38, 0xFF,
+    0xF8, 0x78, 0xF7, 0xF0, 0xF8, 0x07, 0xE1, 0xE0, 0x07, 0xC0, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x00, 0x18, 0xFF, 0x01, 0xF8, 0xFF,
+    0xBF, 0xF8, 0xFF, 0xFF, 0xFB, 0xFF,
+    // 0x35 '5'
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFE, 0x3F, 0xC7,
+    0xF0, 0x3F, 0xC7, 0x80, 0x3F, 0x87, 0x00, 0x3F, 0x87, 0x00, 0x1F, 0x87,
+    0x0E, 0x1F, 0x0F, 0x0E, 0x0C, 0x0F, 0x0F, 0x00, 0x1F, 0x0F, 0x00, 0x3F,
+    0x0F, 0x80, 0x3F, 0x0F, 0xC0, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x36 '6'
+    0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF0, 0x1F, 0x87, 0xE0, 0x1F, 0xC7, 0xE0, 0x1F, 0xC7,
+    0xC1, 0x1F, 0xC7, 0x83, 0x1F, 0x87, 0x87, 0x00, 0x07, 0x8F, 0x00, 0x0F,
+    0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x3F, 0x1F, 0xE0, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x37 '7'
+    0xFF, 0xFF, 0xEF, 0xC1, 0xFF, 0x07, 0x00, 0xFC, 0x07, 0x01, 0xF8, 0x03,
+    0x07, 0xF0, 0x0F, 0x0F, 0xC0, 0x3F, 0x0F, 0x80, 0xFF, 0x0F, 0x03, 0xFF,
+    0x0E, 0x07, 0xFF, 0x08, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF,
+    0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x38 '8'
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xF0, 0xE0, 0x07,
+    0xE0, 0x61, 0x87, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0xC7, 0x86, 0x0F, 0xC7,
+    0x0F, 0x0F, 0xC7, 0x1F, 0x07, 0xC7, 0x1F, 0x03, 0x07, 0x1E, 0x00, 0x0F,
+    0x08, 0x20, 0x0F, 0x80, 0x70, 0x1F, 0x80, 0x78, 0x7F, 0xC0, 0xFF, 0xFF,
+    0xE3, 0xFF, 0xFF,
+    // 0x39 '9'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xF0, 0x1F, 0xC7, 0xE0, 0x0F, 0xC7, 0xC0, 0x07, 0x87, 0x80, 0x07, 0x87,
+    0x83, 0x83, 0x0F, 0x0F, 0xC3, 0x0F, 0x0F, 0xC2, 0x1F, 0x1F, 0xE0, 0x1F,
+    0x0F, 0xE0, 0x3F, 0x07, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF,
+    0xC0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0xFF, 0xFF,
+    // 0x3A ':'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x7F, 0xCF, 0xF0, 0xFF,
+    0x87, 0xF0, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x3B ';'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x87,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x1F, 0xCF, 0xF0, 0x3F, 0x87, 0xF0, 0x7F,
+    0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x3C '<'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x3F,
+    0xE2, 0x1F, 0xC3, 0x1F, 0xC7, 0x0F, 0x87, 0x8F, 0x8F, 0x87, 0x0F, 0xC7,
+    0x1F, 0xC3, 0xDF, 0xEF,
+    // 0x3D '='
+    0xFF, 0xFF, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F,
+    0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F, 0x8C, 0x7F,
+    0x8C, 0x7F, 0x8C, 0x7F,
+    // 0x3E '>'
+    0xFF, 0xFF, 0x9F, 0xE7, 0x0F, 0xC3, 0x8F, 0xC7, 0x87, 0x87, 0xC7, 0x8F,
+    0xC3, 0x8F, 0xE3, 0x1F, 0xE1, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF8, 0x7F,
+    0xF8, 0x7F, 0xFC, 0xFF,
+    // 0x3F '?'
+    0xFF, 0xFF, 0xF3, 0xC7, 0xF0, 0xC3, 0x87, 0xE0, 0xC1, 0x0F, 0xC0, 0xC3,
+    0x0F, 0x88, 0xC7, 0x0F, 0x18, 0xFF, 0x00, 0x39, 0xFF, 0x80, 0x7F, 0xFF,
+    0x80, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    // 0x40 '@'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
+    0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x03, 0xC0, 0x7F, 0xF8, 0x3F, 0xF8, 0x3F,
+    0xF0, 0x7F, 0xFC, 0x3F, 0xE1, 0xFF, 0xFE, 0x3F, 0xE3, 0xF8, 0x3E, 0x1F,
+    0xC3, 0xC0, 0x0E, 0x1F, 0xC7, 0x80, 0x0F, 0x1F, 0x8F, 0x00, 0x0F, 0x1F,
+    0x8E, 0x0F, 0x8F, 0x1F, 0x8E, 0x3F, 0x1F, 0x1F, 0x1E, 0x7F, 0x3F, 0x1F,
+    0x1E, 0x7C, 0x7F, 0x3F, 0x1E, 0x20, 0x1E, 0x3F, 0x1F, 0x00, 0x0E, 0x3F,
+    0x1E, 0x00, 0x0E, 0x7F, 0x1E, 0x0F, 0x8C, 0x7F, 0x0E, 0x7F, 0x8F, 0xFF,
+    0x8F, 0xFF, 0x1F, 0xFF, 0x87, 0xFE, 0x1F, 0xFF, 0x83, 0xF8, 0x3F, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF,
+    // 0x41 'A'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x33,
+    0xFF, 0xC0, 0xF3, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x18, 0xFF,
+    0xE0, 0x78, 0xFF, 0xC1, 0xF8, 0xFB, 0x80, 0xF8, 0xF3, 0x80, 0x00, 0xE3,
+    0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x03,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x42 'B'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xCF, 0xFF, 0x83, 0xCF, 0xF0, 0x03, 0x8E, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x07, 0xE3, 0x87, 0xC7, 0xE3,
+    0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xC3, 0x8F, 0x81, 0x87, 0x80, 0x00, 0x07,
+    0x80, 0x00, 0x0F, 0xC0, 0x20, 0x0F, 0xE0, 0x70, 0x3F, 0xFB, 0xFF, 0xFF,
+    // 0x43 'C'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x7F, 0x03, 0xC1, 0xFF, 0x83,
+    0xC3, 0xFF, 0xC3, 0x87, 0xFF, 0xC3, 0x87, 0xFF, 0xC3, 0x8F, 0xFF, 0xC3,
+    0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0x87, 0x8F, 0xFF, 0x87,
+    0x80, 0xFF, 0x0F, 0x80, 0xFF, 0xBF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x44 'D'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xCF, 0xFF, 0x83, 0xCF, 0xF0, 0x03, 0x8E, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x3F, 0xE3, 0x83, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0xC3, 0x87, 0xFF, 0x87,
+    0x87, 0xFF, 0x07, 0x81, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x45 'E'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x0F, 0xC7, 0x07, 0x8F, 0xC7,
+    0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0x87, 0x1F, 0x8F, 0x07,
+    0x1F, 0x9C, 0x07, 0x03, 0xFE, 0x1F, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF,
+    // 0x46 'F'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x0F, 0xC7, 0x07, 0xCF, 0xEF,
+    0x1F, 0xCF, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF, 0x1F, 0x8F, 0xFF,
+    0x03, 0xDF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+    // 0x47 'G'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x3F, 0x03, 0xC1, 0xFF, 0xC3,
+    0xC3, 0xFF, 0xC3, 0x87, 0xFF, 0xE3, 0x87, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xF1, 0xE3, 0x8F, 0xF1, 0xE3, 0x8F, 0xF1, 0x03, 0x8F, 0xF0, 0x03,
+    0x84, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x3F, 0xC1, 0xF1, 0xFF,
+    0xFF, 0xF7, 0xFF,
+    // 0x48 'H'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0xC7, 0x00, 0x0F, 0xE7, 0x07, 0x8F, 0xFF,
+    0x1F, 0x8F, 0xFF, 0x3F, 0x8F, 0xF7, 0x3F, 0x8F, 0xE7, 0xFF, 0x8F, 0xC7,
+    0xFF, 0x8F, 0x87, 0xBF, 0x80, 0x07, 0x1F, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0xC7, 0x00, 0x1F, 0xE7, 0x03, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x49 'I'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0xC7, 0x00, 0x3F, 0xE7, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4A 'J'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0x3F,
+    0x3F, 0xF0, 0x00, 0x7F, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x4B 'K'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x07, 0xE7, 0x0F, 0x01, 0xFF,
+    0x1E, 0x00, 0xFF, 0x3C, 0x00, 0x3F, 0x7C, 0x20, 0x1F, 0xF8, 0x78, 0x0F,
+    0xB0, 0xFC, 0x07, 0x01, 0xFE, 0x07, 0x03, 0xFF, 0x87, 0x07, 0xFF, 0xC7,
+    0x0F, 0xFF, 0xC7, 0x1F, 0xFF, 0xEF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x4C 'L'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x3F, 0xC7, 0x07, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x3F, 0xFF, 0x87, 0xFF, 0xFE, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x4D 'M'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x87,
+    0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x07, 0x3E, 0x00, 0x07, 0x10, 0x01, 0xE7,
+    0x00, 0x0F, 0xEF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0x81, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0xE7,
+    0xC0, 0xFF, 0xC7, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x07, 0xC7, 0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x4E 'N'
+    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x07,
+    0x3F, 0xE0, 0x07, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0xC7,
+    0x00, 0x3F, 0xE7, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF,
+    0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x07,
+    0xFF, 0xF8, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x1F,
+    0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x4F 'O'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x07,
+    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x3F, 0x03, 0xC1, 0xFF, 0xC3,
+    0x83, 0xFF, 0xE3, 0x87, 0xFF, 0xE3, 0x87, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xC3, 0x8F, 0xFF, 0x83, 0x87, 0xFF, 0x07, 0x83, 0xFC, 0x07,
+    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
+    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x50 'P'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xCF, 0xFF, 0x83, 0xCF, 0xF0, 0x03, 0x8E, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x23, 0xE3, 0x87, 0xF3, 0xF7,
+    0x8F, 0xE3, 0xFF, 0x8F, 0xE3, 0xFF, 0x87, 0xC3, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0x51 'Q'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
+    0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x3F, 0x81, 0xFF, 0xC1, 0xFF, 0xC0, 0xFF, 0x83, 0xFF, 0xE0, 0xFF,
+    0x87, 0xFF, 0xE0, 0x7F, 0x87, 0xFF, 0xE0, 0x3F, 0x8F, 0xFF, 0xE2, 0x3F,
+    0x8F, 0xFF, 0xC2, 0x1F, 0x8F, 0xFF, 0x86, 0x1F, 0x87, 0xFF, 0x07, 0x1F,
+    0x83, 0xFC, 0x0F, 0x0F, 0x80, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x1F, 0x0F,
+    0xC0, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0xFF, 0x87, 0xF8, 0x03, 0xFF, 0x87,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x52 'R'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3,
+    0xCF, 0xFF, 0x83, 0xCF, 0xF0, 0x03, 0x8E, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x23, 0xF3, 0x87, 0xE0, 0xFF,
+    0x8F, 0xE0, 0x3F, 0x8F, 0xC0, 0x1F, 0x8F, 0x80, 0x07, 0x82, 0x06, 0x07,
+    0x80, 0x0F, 0x03, 0xC0, 0x1F, 0x83, 0xC0, 0x3F, 0xC3, 0xE0, 0x7F, 0xE3,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0x53 'S'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x03,
+    0xF0, 0x3E, 0x03, 0xE0, 0x1F, 0xC3, 0xC0, 0x0F, 0xE3, 0x80, 0x07, 0xE3,
+    0x86, 0x07, 0xE3, 0x8F, 0x03, 0xE3, 0x8F, 0x81, 0xC3, 0x8F, 0xC0, 0x03,
+    0x8F, 0xC0, 0x07, 0x81, 0xE0, 0x0F, 0x80, 0xF0, 0x1F, 0x81, 0xFC, 0x7F,
+    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x54 'T'
+    0xC1, 0xFF, 0xFF, 0x01, 0xFF, 0xE7, 0x01, 0xFF, 0xE7, 0x0F, 0xFF, 0xC7,
+    0x1F, 0xFE, 0x07, 0x1F, 0xC0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x7F, 0xE7, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x55 'U'
+    0xFF, 0xFE, 0xFF, 0x1F, 0xC0, 0x1F, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0xFF, 0x87, 0x0F, 0xFF, 0xC7,
+    0x1F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0x0F, 0xBF, 0xF8, 0x0F, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x56 'V'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x1F, 0x80, 0x07, 0x3F, 0xFE, 0x07, 0x7F, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F,
+    0xFF, 0xC0, 0x7F, 0xFF, 0x01, 0xFF, 0x3C, 0x07, 0xFF, 0x10, 0x1F, 0xFF,
+    0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0x57 'W'
+    0xBF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1F, 0xFC, 0x07,
+    0x3F, 0xF0, 0x1F, 0x3F, 0xC0, 0x7F, 0xFF, 0x01, 0xFF, 0xFC, 0x07, 0xFF,
+    0xF0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x3F,
+    0xFF, 0x80, 0xFF, 0xBE, 0x03, 0xFF, 0x10, 0x0F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0x58 'X'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x87, 0x1F, 0xFF, 0x07, 0x1F, 0xFE, 0x07, 0x0F, 0xFC, 0x07,
+    0x03, 0xF8, 0x67, 0x00, 0xF0, 0xEF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF,
+    0x38, 0x01, 0xE7, 0x3E, 0x00, 0x67, 0xFE, 0x00, 0x07, 0xF8, 0x20, 0x07,
+    0xB0, 0x78, 0x07, 0x00, 0xFE, 0x07, 0x01, 0xFF, 0x87, 0x03, 0xFF, 0xC7,
+    0x0F, 0xFF, 0xE7, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x59 'Y'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7, 0x03, 0xFF, 0xE7,
+    0x00, 0x7F, 0xC7, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x3E, 0x00, 0x07, 0x3F, 0x80, 0x07, 0xFF, 0x03, 0xC7, 0xFE, 0x0F, 0xE7,
+    0xB8, 0x3F, 0xFF, 0x10, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF,
+    // 0x5A 'Z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xE3, 0xFE, 0x07,
+    0x01, 0xFC, 0x07, 0x01, 0xF8, 0x07, 0x07, 0xE0, 0x07, 0x1F, 0xC0, 0x47,
+    0x1F, 0x80, 0xC7, 0x1F, 0x03, 0xC7, 0x1C, 0x07, 0xC7, 0x18, 0x0F, 0xC7,
+    0x10, 0x1F, 0xC7, 0x00, 0x3F, 0x87, 0x00, 0xFE, 0x07, 0x01, 0xFC, 0x07,
+    0x03, 0xFC, 0x0F, 0x07, 0xFE, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5B '['
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x07,
+    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xC7,
+    0xE0, 0x00, 0x1F, 0xC7, 0x00, 0x01, 0xFF, 0xCF, 0x00, 0x1F, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x5C '\'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x1F,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFD,
+    // 0x5D ']'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
+    0xDF, 0xFE, 0x00, 0x07, 0x1F, 0xC0, 0x00, 0x1F, 0x1C, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x5E '^'
+    0xFF, 0xF9, 0xFF, 0xE1, 0xFF, 0x01, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x3F,
+    0x81, 0xFF, 0x87, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x01,
+    0xFF, 0x81, 0xFF, 0xF1, 0xFF, 0xFF,
+    // 0x5F '_'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x60 '`'
+    0xEF, 0xFF, 0x87, 0xFF, 0x83, 0xFF, 0xC1, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF,
+    // 0x61 'a'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0x78, 0x7F, 0xC1, 0xFC, 0x7F, 0x87, 0xF8, 0xFF,
+    0x8F, 0xF1, 0xFF, 0x8F, 0xC3, 0xFF, 0x8F, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
+    0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x78, 0x7F, 0x87, 0xF8, 0xFF,
+    0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x62 'b'
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xCF, 0xFE, 0x00, 0xFF,
+    0x8F, 0xC0, 0x00, 0xFF, 0x88, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0xF8, 0xFF, 0x80, 0x61, 0xF8, 0xFF, 0x83, 0xC7, 0xF8, 0xFF,
+    0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x0F, 0xC1, 0xFF, 0xFF, 0x04, 0x01, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF,
+    // 0x63 'c'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0x70, 0x7F, 0xC3, 0xFC, 0x7F, 0x87, 0xFC, 0x7F,
+    0x8F, 0xF8, 0x7F, 0x8F, 0xF8, 0xFF, 0x87, 0xF0, 0xFF, 0x83, 0xF1, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x64 'd'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0xF0, 0xFF,
+    0xFF, 0x83, 0xF8, 0xFF, 0xFF, 0x0F, 0xF1, 0xFF, 0xFF, 0x1F, 0xE3, 0xFF,
+    0xFF, 0x1F, 0x87, 0xFF, 0xCF, 0x1E, 0x01, 0xFF, 0x8F, 0x80, 0x00, 0xFF,
+    0x8E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF0, 0xFF,
+    0x80, 0x1F, 0xF1, 0xFF, 0x81, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x65 'e'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC1, 0x8C, 0x7F, 0xC7, 0x9C, 0x7F, 0x8F, 0x1C, 0x7F,
+    0x8E, 0x3C, 0x7F, 0x8C, 0x38, 0xFF, 0x80, 0x70, 0xFF, 0x80, 0xF1, 0xFF,
+    0xC1, 0xF3, 0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x66 'f'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xC1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x9F, 0xFF, 0x03, 0xFF, 0x9F, 0xE0, 0x03,
+    0xFF, 0x9C, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
+    0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+    0x81, 0x1F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0x9F, 0x1F, 0xFF, 0xFF,
+    0x0F, 0x1F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x67 'g'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x7E, 0x30, 0xFF,
+    0xF0, 0x30, 0x78, 0xFF, 0xE0, 0x10, 0x78, 0xFF, 0xC0, 0x00, 0x78, 0xFF,
+    0x83, 0x80, 0x78, 0xFF, 0x8F, 0x8C, 0x38, 0xFF, 0x8F, 0x8C, 0x38, 0xFF,
+    0x9F, 0x1E, 0x10, 0xFF, 0x84, 0x1E, 0x01, 0xFF, 0x80, 0x3F, 0x01, 0xFF,
+    0x80, 0x3F, 0x03, 0xFF, 0x80, 0x7F, 0x8F, 0xFF, 0x89, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x68 'h'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xCF, 0xFC, 0x00, 0xFF,
+    0x8F, 0xC0, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF,
+    0x80, 0x00, 0x7F, 0xFF, 0x80, 0x21, 0xFF, 0xFF, 0x81, 0xC7, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0x8F, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x78, 0xFF,
+    0xFF, 0x83, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x69 'i'
+    0xFF, 0x3F, 0xE3, 0xFF, 0x3E, 0x01, 0xFE, 0x30, 0x01, 0xFE, 0x00, 0x01,
+    0x86, 0x00, 0x01, 0x06, 0x00, 0xE1, 0x06, 0x0F, 0xE3, 0x07, 0xFF, 0xE7,
+    0x8F, 0xFF, 0xFF,
+    // 0x6A 'j'
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0x3F, 0xE0, 0x0F,
+    0xFF, 0x3C, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xCE, 0x00, 0x01, 0xFF,
+    0x86, 0x00, 0x0F, 0xFF, 0x06, 0x01, 0xFF, 0xFF, 0x07, 0x3F, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6B 'k'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xCF, 0xFE, 0x00, 0xFF,
+    0x8F, 0xC0, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
+    0x80, 0x01, 0x1F, 0xFF, 0x80, 0x67, 0x07, 0xFF, 0x83, 0xCF, 0x03, 0xFF,
+    0xFF, 0x9E, 0x01, 0xFF, 0xFF, 0x1C, 0x60, 0xFF, 0xFF, 0x18, 0x70, 0xFF,
+    0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0x83, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6C 'l'
+    0xFF, 0xFF, 0xE0, 0xFF, 0xCF, 0xFC, 0x00, 0xFF, 0x8F, 0xC0, 0x00, 0xFF,
+    0x88, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF1, 0xFF,
+    0x80, 0x1F, 0xF1, 0xFF, 0x83, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6D 'm'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0xCF, 0xE0, 0x7F, 0x8C, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xE3, 0xFE, 0x7F, 0xC7, 0xE0, 0x7F, 0x86, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xE0, 0x7F, 0x86, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x0C, 0x7F, 0xC0, 0xF8, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x6E 'n'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x7F, 0xCF, 0xE0, 0x7F, 0x8C, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x7F, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xF0, 0xFF, 0x8F, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x78, 0x7F,
+    0xE7, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF,
+    // 0x6F 'o'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0xF8, 0x7F, 0xC3, 0xFC, 0x7F, 0x87, 0xFC, 0x7F,
+    0x8F, 0xFC, 0x7F, 0x8F, 0xF8, 0x7F, 0x87, 0xE0, 0xFF, 0x80, 0x00, 0xFF,
+    0x80, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF,
+    // 0x70 'p'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0,
+    0xCF, 0xFE, 0x00, 0xCF, 0xC0, 0x00, 0x88, 0x00, 0x00, 0x80, 0x00, 0x08,
+    0x80, 0x00, 0x78, 0x80, 0x1C, 0x78, 0xC0, 0xFC, 0x7F, 0xE1, 0xFC, 0x7F,
+    0xC7, 0xF8, 0x7F, 0xC7, 0xF0, 0x7F, 0x87, 0xC0, 0xFF, 0x80, 0x01, 0xFF,
+    0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x71 'q'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0x78, 0x7C, 0xC3, 0xFC, 0x7C, 0x87, 0xF8, 0xF8,
+    0x8F, 0xF1, 0xF0, 0x8F, 0xC3, 0x00, 0x8F, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x80, 0x7F, 0xFF, 0x87, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x72 'r'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x7F, 0xCF, 0xE0, 0x7F, 0x8E, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    // 0x73 's'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xF1, 0xE0, 0x7F,
+    0xE0, 0x78, 0x7F, 0xC0, 0x3C, 0x7F, 0xC0, 0x3C, 0x7F, 0x8C, 0x1C, 0x7F,
+    0x8E, 0x00, 0x7F, 0x8E, 0x00, 0x7F, 0x8F, 0x00, 0xFF, 0x87, 0x81, 0xFF,
+    0x87, 0xE7, 0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x74 't'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xF8, 0x1F, 0xF9, 0x00, 0x0F,
+    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x01, 0x0F, 0x00, 0x3F, 0x8F,
+    0x01, 0xFF, 0x0F, 0xF1, 0xFF, 0x1F, 0xF1, 0xFE, 0x3F, 0xF1, 0xFE, 0x7F,
+    0xFB, 0xFF, 0xFF,
+    // 0x75 'u'
+    0xFF, 0xFF, 0xFF, 0x9F, 0xF1, 0xFF, 0x9F, 0x00, 0xFF, 0x10, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0xFF, 0x87, 0xF1, 0xFF,
+    0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0xFF,
+    0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x10, 0xFF, 0x03, 0xF1, 0xFF,
+    0x3F, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0x76 'v'
+    0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x80, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xDF, 0x03, 0xFF, 0x80, 0x07, 0xFF,
+    0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x77 'w'
+    0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
+    0x80, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x7F,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0x8F, 0x07, 0xFF, 0x80, 0x0F, 0xFF,
+    0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x7F,
+    0xFF, 0xE0, 0xFF, 0xDF, 0x81, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFF,
+    0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x78 'x'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xEF, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F,
+    0xCF, 0xF8, 0x7F, 0x87, 0xF0, 0xFF, 0x81, 0xE1, 0xFF, 0x80, 0x03, 0xFF,
+    0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xE1, 0xE0, 0x7F, 0xC3, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0x87, 0xFC, 0x7F,
+    0x87, 0xFC, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x79 'y'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xEF, 0xFF, 0xF0, 0xFF,
+    0xCF, 0xFF, 0xF0, 0xFF, 0x8F, 0xFF, 0xF1, 0xFF, 0x83, 0xFF, 0xE3, 0xFF,
+    0x80, 0x1F, 0x83, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xDF, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x7A 'z'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFB, 0xF8, 0x7F, 0xC1, 0xF0, 0x7F,
+    0x81, 0xE0, 0xFF, 0x83, 0xC0, 0xFF, 0x87, 0x80, 0xFF, 0x87, 0x08, 0x7F,
+    0x86, 0x18, 0x7F, 0xC0, 0x3C, 0x7F, 0xC0, 0x7C, 0x7F, 0xE0, 0xF8, 0x7F,
+    0x81, 0xE0, 0x7F, 0x87, 0xF0, 0xFF, 0x8F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x7B '{'
+    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xF9, 0xF8, 0x0F, 0xFF, 0xF0, 0xC0, 0x07,
+    0xFF, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xC7, 0xE0, 0x02, 0x1F, 0xC7,
+    0xC0, 0x07, 0xFF, 0xC7, 0x80, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x7C '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x7D '}'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x07,
+    0x9F, 0xFF, 0x80, 0x0F, 0x1F, 0xE3, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3C, 0xFF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFF,
+    // 0x7E '~'
+    0xE7, 0x83, 0x83, 0x0F, 0x1F, 0x0F, 0x8F, 0x87, 0xC7, 0xC3, 0xC3, 0xC3,
+    0x07, 0x8F, 0xDF,
+    // 0xA1 '¡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x01,
+    0xFF, 0xE0, 0x01, 0x8E, 0x00, 0x03, 0x06, 0x00, 0x0F, 0x04, 0x03, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xA2 '¢'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
+    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xF7, 0xFF, 0x07, 0xC1, 0x03,
+    0xFF, 0x0F, 0xE0, 0x03, 0xFE, 0x1F, 0x00, 0x0F, 0xFE, 0x20, 0x01, 0xFF,
+    0xFC, 0x00, 0x31, 0xFF, 0xC0, 0x07, 0xF1, 0xFF, 0x80, 0x3F, 0xE3, 0xFF,
+    0x82, 0x3F, 0xC3, 0xFF, 0xBE, 0x1F, 0xC7, 0xFF, 0xFE, 0x1F, 0xCF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xA3 '£'
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 0xCF, 0xC7,
+    0xFF, 0xCF, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+    0xF0, 0x00, 0xC7, 0xE0, 0x07, 0xC7, 0xC0, 0x4F, 0xC7, 0x83, 0xCF, 0xC7,
+    0x8F, 0xCF, 0xC7, 0x1F, 0xCF, 0xC7, 0x1F, 0xCF, 0xC7, 0x0F, 0xDF, 0x87,
+    0x03, 0xFF, 0x87, 0x83, 0xFF, 0x9F, 0x83, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    // 0xA4 '¤'
+    0xFF, 0xF7, 0xFF, 0xF1, 0xDF, 0xE3, 0x8E, 0x07, 0x80, 0x07, 0xC0, 0x07,
+    0xE1, 0xC3, 0xC3, 0xE3, 0xC7, 0xE3, 0xC7, 0xE3, 0xC7, 0xC7, 0xC7, 0x87,
+    0xC0, 0x07, 0xE0, 0x03, 0xC0, 0x21, 0xC7, 0xF3, 0x8F, 0xFF, 0xDF, 0xFF,
+    0xFF, 0xFF,
+    // 0xA5 '¥'
+    0x9F, 0xFF, 0xFF, 0x1F, 0x9B, 0xF7, 0x07, 0x91, 0xE7, 0x01, 0x99, 0xE7,
+    0x00, 0x19, 0xC7, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x07,
+    0x1F, 0x80, 0x07, 0xBF, 0x81, 0xC7, 0xFE, 0x01, 0xE7, 0xFC, 0x11, 0xFF,
+    0x10, 0x11, 0xFF, 0x00, 0x91, 0xFF, 0x01, 0x93, 0xFF, 0x03, 0x9F, 0xFF,
+    0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xA7 '§'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFC, 0x0F, 0xC1, 0xF0, 0x07, 0xC1,
+    0xE1, 0xC3, 0xF0, 0xC0, 0xE1, 0xF8, 0xC0, 0x70, 0xF8, 0x88, 0x38, 0x78,
+    0x9E, 0x1C, 0x31, 0x1F, 0x1C, 0x01, 0x1F, 0x8F, 0x03, 0x0F, 0x83, 0x87,
+    0x83, 0xC0, 0x0F, 0x83, 0xE0, 0x1F, 0xCF, 0xFF, 0xFF,
+    // 0xA9 '©'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0xFE, 0x1F,
+    0xE3, 0xFF, 0x8F, 0xE7, 0xFF, 0xC7, 0xCF, 0x81, 0xE7, 0xCE, 0x00, 0xF3,
+    0x9E, 0x00, 0x73, 0x9C, 0x7C, 0x73, 0x9C, 0xFE, 0x39, 0x98, 0xFE, 0x39,
+    0x98, 0xFE, 0x39, 0x9C, 0x7E, 0x3B, 0x9C, 0x3E, 0x73, 0x9C, 0xFE, 0x73,
+    0xCF, 0xFF, 0xE3, 0xC7, 0xFF, 0xE7, 0xE3, 0xFF, 0xCF, 0xF1, 0xFF, 0x0F,
+    0xF8, 0x18, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
+    // 0xAA 'ª'
+    0xFF, 0xFD, 0xF8, 0x39, 0xE0, 0x19, 0xC0, 0x19, 0x87, 0x19, 0x8F, 0x19,
+    0x9E, 0x39, 0x98, 0x19, 0x80, 0x19, 0x80, 0x11, 0x8F, 0x13, 0xBF, 0x3F,
+    0xFF, 0xFF,
+    // 0xAB '«'
+    0xF8, 0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x87, 0x0F,
+    0x8F, 0xDF, 0x9F, 0xFF, 0xF8, 0xFF, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1F,
+    0xC2, 0x0F, 0x87, 0x8F, 0x8F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xAE '®'
+    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xE7, 0xF1, 0xFF,
+    0xCF, 0xF9, 0xFF, 0x93, 0xE4, 0xFF, 0x90, 0x06, 0xFF, 0xB0, 0x06, 0xFF,
+    0xB3, 0x26, 0x7F, 0xB2, 0x1E, 0x7F, 0x98, 0x0E, 0xFF, 0x98, 0xE4, 0xFF,
+    0xDF, 0xE4, 0xFF, 0xCF, 0xF9, 0xFF, 0xE3, 0xE3, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFE, 0x3F, 0xFF,
+    // 0xB0 '°'
+    0xFB, 0xFF, 0xC0, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0x0E, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x0E, 0x1F, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF,
+    // 0xB1 '±'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    0xF8, 0xFE, 0x3F, 0xF8, 0x7E, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x02, 0x3F,
+    0x00, 0x02, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    0xF8, 0xFE, 0x3F, 0xF8, 0xFE, 0x3F,
+    // 0xB2 '²'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xC3, 0xC7, 0xC3, 0x87, 0x83, 0x8F, 0x03,
+    0x1E, 0x23, 0x1C, 0x23, 0x18, 0x63, 0x00, 0xE3, 0x81, 0xE3, 0xC3, 0xFF,
+    0xFF, 0xFF,
+    // 0xB3 '³'
+    0xFF, 0xF3, 0xFF, 0xF3, 0xCF, 0xF3, 0x86, 0x73, 0x8C, 0xE3, 0x1C, 0xE3,
+    0x18, 0x43, 0x10, 0x07, 0x00, 0x0F, 0x83, 0x1F, 0xC7, 0xFF,
+    // 0xB5 'µ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+    0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x81, 0xF8, 0x7F, 0xFF,
+    0x9F, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
+    0x80, 0x00, 0x7F, 0xFF, 0x80, 0x38, 0x7F, 0xFF, 0x87, 0xFC, 0x7F, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xB6 '¶'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
+    0xFE, 0x1F, 0xFE, 0x7F, 0xF0, 0x07, 0xFE, 0x7F, 0xE0, 0x07, 0xFC, 0x7F,
+    0xC0, 0x03, 0xF8, 0xFF, 0xC0, 0x03, 0x80, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x08, 0xFF, 0x00, 0x01, 0xF1, 0xFF, 0x00, 0x1F, 0x83, 0xFF,
+    0x03, 0xF0, 0x07, 0xFF, 0x1E, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0xB7 '·'
+    0xCF, 0x87, 0x07, 0x07, 0x8F, 0xFF,
+    // 0xB9 '¹'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xDF, 0xF3, 0x8F, 0xE3, 0x8E, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x00, 0xF3, 0x8F, 0xF3, 0xFF, 0xFF,
+    // 0xBA 'º'
+    0xFF, 0xFD, 0xFF, 0xF9, 0xF0, 0x39, 0xE0, 0x19, 0xC0, 0x19, 0x87, 0x99,
+    0x9F, 0x99, 0x9F, 0x19, 0x98, 0x31, 0x80, 0x33, 0x80, 0xFF, 0xE3, 0xFF,
+    // 0xBB '»'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x8F, 0x9F, 0x0F, 0x86, 0x1F, 0x80, 0x3F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xFB, 0xCF, 0xBF, 0x8F, 0x8F, 0x0F,
+    0x82, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+    // 0xBC '¼'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xEF, 0xF9, 0xFF, 0xC7, 0xF1, 0xFF,
+    0xC6, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xFB,
+    0xC7, 0xFB, 0xF1, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF,
+    0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0x1F,
+    0xF0, 0x7E, 0x1F, 0xC1, 0xFC, 0x1F, 0x83, 0xF8, 0x1F, 0x07, 0xF0, 0x9F,
+    0x9F, 0xE3, 0x8B, 0xFF, 0xC7, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x9F, 0xFF, 0x8F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xBD '½'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xEF, 0xF9, 0xFF, 0xC7, 0xF1, 0xFF,
+    0xC6, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xF9, 0x80, 0x71, 0xF1,
+    0xC7, 0xFB, 0xC0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xE3,
+    0xC1, 0xEF, 0xE3, 0x03, 0xC7, 0xC3, 0x0F, 0x87, 0x83, 0x9F, 0x8F, 0x03,
+    0xFF, 0x9E, 0x23, 0xFF, 0x1C, 0x23, 0xFF, 0x08, 0x63, 0xFF, 0x80, 0xE3,
+    0xFF, 0x81, 0xE3, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xBE '¾'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7, 0xF9, 0xFF, 0xC6, 0x79, 0xFF,
+    0xC6, 0x71, 0xFF, 0x8E, 0x71, 0xFF, 0x8C, 0x23, 0xFF, 0x88, 0x03, 0xF9,
+    0x80, 0x07, 0xF1, 0xC1, 0x0F, 0xC0, 0xE3, 0xFF, 0x83, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0x1F,
+    0xE0, 0xFE, 0x1F, 0xC1, 0xFC, 0x1F, 0x03, 0xF8, 0x1F, 0x0F, 0xF0, 0x9F,
+    0x9F, 0xE3, 0x8B, 0xFF, 0xC7, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x9F, 0xFF, 0x8F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xBF '¿'
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0x70, 0x03,
+    0xFE, 0x61, 0xC3, 0xCC, 0x63, 0xC3, 0x04, 0x07, 0xC3, 0x04, 0x0F, 0xC3,
+    0x0E, 0x1F, 0x87, 0x9F, 0x7F, 0xFF,
+    // 0xC0 'À'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x87, 0xF8, 0x18, 0xFF,
+    0x87, 0xE0, 0x78, 0xFF, 0xC3, 0xC1, 0xF8, 0xFB, 0xE3, 0x80, 0xF8, 0xF3,
+    0xE1, 0x80, 0x00, 0xE3, 0xF1, 0x80, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x03,
+    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC1 'Á'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x18, 0xFF,
+    0xF9, 0xE0, 0x78, 0xFF, 0xF1, 0xC1, 0xF8, 0xFB, 0xF1, 0x80, 0xF8, 0xF3,
+    0xE3, 0x80, 0x00, 0xE3, 0xC3, 0x80, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x03,
+    0x87, 0xFE, 0x00, 0x03, 0x87, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC2 'Â'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x67, 0xFF, 0xFF, 0x81, 0xE7,
+    0xFF, 0xFE, 0x01, 0xFF, 0xF3, 0xF8, 0x01, 0xFF, 0xE3, 0xF0, 0x31, 0xFF,
+    0xE3, 0xC0, 0xF1, 0xFF, 0xC7, 0x83, 0xF1, 0xF7, 0x8F, 0x01, 0xF1, 0xE7,
+    0x1F, 0x00, 0x01, 0xC7, 0x0F, 0x00, 0x00, 0x07, 0x07, 0x80, 0x00, 0x07,
+    0x83, 0xFC, 0x00, 0x07, 0xE3, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC3 'Ã'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFC, 0x07,
+    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x67, 0xFF, 0xFF, 0x81, 0xE7,
+    0xFF, 0xFE, 0x01, 0xFF, 0xE7, 0xF8, 0x01, 0xFF, 0xC7, 0xF0, 0x31, 0xFF,
+    0x87, 0xC0, 0xF1, 0xFF, 0x8F, 0x83, 0xF1, 0xF7, 0x8F, 0x01, 0xF1, 0xE7,
+    0x87, 0x00, 0x01, 0xC7, 0xC7, 0x00, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x07,
+    0x87, 0xFC, 0x00, 0x07, 0x8F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC4 'Ä'
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xCF, 0xFF, 0xFF, 0x03, 0xCF,
+    0xFF, 0xFC, 0x03, 0xFF, 0xCF, 0xF0, 0x03, 0xFF, 0x87, 0xE0, 0x63, 0xFF,
+    0x07, 0x81, 0xE3, 0xFF, 0x0F, 0x07, 0xE3, 0xEF, 0x9E, 0x03, 0xE3, 0xCF,
+    0xFE, 0x00, 0x03, 0x8F, 0xCE, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F,
+    0x07, 0xF8, 0x00, 0x0F, 0x0F, 0xFF, 0xC0, 0x0F, 0x9F, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC5 'Å'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF7, 0xF8, 0x18, 0xFF,
+    0xC1, 0xE0, 0x78, 0xFF, 0x80, 0xC1, 0xF8, 0xFB, 0x98, 0x80, 0xF8, 0xF3,
+    0x1C, 0x80, 0x00, 0xE3, 0x98, 0x80, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x03,
+    0xC3, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC6 'Æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x07,
+    0xFF, 0xF0, 0x67, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFE, 0x01, 0xE7, 0xFC, 0x11, 0xE7, 0x38, 0x71, 0xC7, 0x30, 0xF1, 0x07,
+    0x01, 0xE0, 0x07, 0x07, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x0F, 0xC7, 0x00, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0xC7,
+    0x1F, 0x8F, 0xC7, 0x1F, 0x8F, 0x07, 0x1F, 0x8E, 0x07, 0x0F, 0xBC, 0x0F,
+    0x03, 0xFE, 0x7F, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC7 'Ç'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+    0xE0, 0x7F, 0x03, 0xF3, 0xC1, 0xFF, 0x83, 0x33, 0xC3, 0xFF, 0xC2, 0x23,
+    0x87, 0xFF, 0xC2, 0x07, 0x87, 0xFF, 0xC3, 0x0F, 0x8F, 0xFF, 0xC3, 0x1F,
+    0x8F, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0x87, 0xFF,
+    0x8F, 0xFF, 0x87, 0xFF, 0x80, 0xFF, 0x0F, 0xFF, 0x80, 0xFF, 0xBF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xC8 'È'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0x80, 0x01, 0xE3, 0xC7, 0x80, 0x07, 0xE3, 0x87, 0x83, 0xC7, 0xE3,
+    0xC3, 0x8F, 0xC7, 0xE3, 0xC3, 0x8F, 0xC7, 0xE3, 0xE1, 0x8F, 0xC7, 0xC3,
+    0xF1, 0x8F, 0xC7, 0x83, 0xF9, 0x8F, 0xCE, 0x03, 0xFF, 0x81, 0xFF, 0x0F,
+    0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xC9 'É'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0x80, 0x01, 0xE3, 0xFF, 0x80, 0x07, 0xE3, 0xFF, 0x83, 0xC7, 0xE3,
+    0xF9, 0x8F, 0xC7, 0xE3, 0xF1, 0x8F, 0xC7, 0xE3, 0xE3, 0x8F, 0xC7, 0xC3,
+    0xE3, 0x8F, 0xC7, 0x83, 0xC3, 0x8F, 0xCE, 0x03, 0x87, 0x81, 0xFF, 0x0F,
+    0x87, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xCA 'Ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x3F, 0xE0, 0x07,
+    0xFF, 0x1C, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
+    0xF3, 0x00, 0x03, 0xC7, 0xF3, 0x00, 0x0F, 0xC7, 0xE3, 0x07, 0x8F, 0xC7,
+    0xC7, 0x1F, 0x8F, 0xC7, 0x87, 0x1F, 0x8F, 0xC7, 0x0F, 0x1F, 0x8F, 0x87,
+    0x0F, 0x1F, 0x8F, 0x07, 0x07, 0x1F, 0x9C, 0x07, 0x83, 0x03, 0xFE, 0x1F,
+    0xC3, 0x03, 0xFF, 0xFF, 0xF7, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+    // 0xCB 'Ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFE, 0x7F, 0xC0, 0x0F,
+    0xFE, 0x38, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
+    0xCE, 0x00, 0x07, 0x8F, 0x86, 0x00, 0x1F, 0x8F, 0x06, 0x0F, 0x1F, 0x8F,
+    0x0E, 0x3F, 0x1F, 0x8F, 0x9E, 0x3F, 0x1F, 0x8F, 0xFE, 0x3F, 0x1F, 0x0F,
+    0xCE, 0x3F, 0x1E, 0x0F, 0x86, 0x3F, 0x38, 0x0F, 0x06, 0x07, 0xFC, 0x3F,
+    0x0E, 0x07, 0xFF, 0xFF, 0x9E, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    // 0xCC 'Ì'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xC7, 0x8F, 0x00, 0x03, 0x87, 0x80, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x03,
+    0xC3, 0x80, 0x00, 0xE3, 0xE1, 0x80, 0x1F, 0xF3, 0xF1, 0x83, 0xFF, 0xFF,
+    0xF9, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCD 'Í'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xFF, 0x8F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xF9, 0x80, 0x00, 0x03,
+    0xF1, 0x80, 0x00, 0xE3, 0xE1, 0x80, 0x1F, 0xF3, 0xE3, 0x83, 0xFF, 0xFF,
+    0xC3, 0x8F, 0xFF, 0xFF, 0x87, 0x8F, 0xFF, 0xFF, 0x87, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xCE 'Î'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0x3F, 0xE0, 0x07,
+    0xF3, 0x1E, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x07,
+    0x87, 0x00, 0x01, 0xC7, 0x0F, 0x00, 0x3F, 0xE7, 0x1F, 0x07, 0xFF, 0xFF,
+    0x0F, 0x1F, 0xFF, 0xFF, 0x83, 0x1F, 0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF,
+    0xF7, 0xFF, 0xFF, 0xFF,
+    // 0xCF 'Ï'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFE, 0x7F, 0xC0, 0x0F,
+    0x8E, 0x3C, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x0F,
+    0x8E, 0x00, 0x03, 0x8F, 0xFE, 0x00, 0x7F, 0xCF, 0xCE, 0x0F, 0xFF, 0xFF,
+    0x86, 0x3F, 0xFF, 0xFF, 0x06, 0x3F, 0xFF, 0xFF, 0x0E, 0x7F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF,
+    // 0xD0 'Ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF, 0xC7, 0xE3,
+    0xCF, 0xC7, 0x83, 0xCF, 0xC0, 0x03, 0x8E, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x07, 0xE3, 0x83, 0xC7, 0xE3,
+    0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xC3, 0x8F, 0xFF, 0xC3, 0x87, 0xFF, 0x87,
+    0x87, 0xFF, 0x07, 0x81, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD1 'Ñ'
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x3F, 0xE0, 0x07, 0xFF, 0x1E, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xC7, 0xFF, 0x00, 0x3F, 0xE7,
+    0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0x00, 0x1F, 0xFF, 0x87, 0xC0, 0x07, 0xFF,
+    0x8F, 0xF0, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0x8F, 0xFF, 0x00, 0x1F,
+    0x87, 0xFF, 0xE0, 0x07, 0xC7, 0xFF, 0xF8, 0x07, 0xC7, 0x3F, 0xE0, 0x07,
+    0x87, 0x1C, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xD2 'Ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03,
+    0xFF, 0xE0, 0x3F, 0x03, 0xFF, 0xC1, 0xFF, 0xC3, 0xFF, 0x83, 0xFF, 0xE3,
+    0xC7, 0x87, 0xFF, 0xE3, 0x87, 0x87, 0xFF, 0xE3, 0xC3, 0x8F, 0xFF, 0xE3,
+    0xE3, 0x8F, 0xFF, 0xC3, 0xE1, 0x8F, 0xFF, 0x83, 0xF1, 0x87, 0xFF, 0x07,
+    0xF9, 0x83, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD3 'Ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03,
+    0xFF, 0xE0, 0x3F, 0x03, 0xFF, 0xC1, 0xFF, 0xC3, 0xFF, 0x83, 0xFF, 0xE3,
+    0xFF, 0x87, 0xFF, 0xE3, 0xFB, 0x87, 0xFF, 0xE3, 0xF1, 0x8F, 0xFF, 0xE3,
+    0xF1, 0x8F, 0xFF, 0xC3, 0xE3, 0x8F, 0xFF, 0x83, 0xE3, 0x87, 0xFF, 0x07,
+    0xC3, 0x83, 0xFC, 0x07, 0x87, 0x80, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x1F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD4 'Ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07,
+    0xFF, 0xC0, 0x7E, 0x07, 0xFF, 0x83, 0xFF, 0x87, 0xF3, 0x07, 0xFF, 0xC7,
+    0xF3, 0x0F, 0xFF, 0xC7, 0xE3, 0x0F, 0xFF, 0xC7, 0xC7, 0x1F, 0xFF, 0xC7,
+    0x87, 0x1F, 0xFF, 0x87, 0x0F, 0x1F, 0xFF, 0x07, 0x0F, 0x0F, 0xFE, 0x0F,
+    0x07, 0x07, 0xF8, 0x0F, 0x83, 0x00, 0x00, 0x1F, 0xC3, 0x80, 0x00, 0x3F,
+    0xF7, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD5 'Õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07,
+    0xFF, 0xC0, 0x7E, 0x07, 0xFF, 0x83, 0xFF, 0x87, 0xEF, 0x07, 0xFF, 0xC7,
+    0xC7, 0x0F, 0xFF, 0xC7, 0x87, 0x0F, 0xFF, 0xC7, 0x8F, 0x1F, 0xFF, 0xC7,
+    0x8F, 0x1F, 0xFF, 0x87, 0x87, 0x1F, 0xFF, 0x07, 0xC7, 0x0F, 0xFE, 0x0F,
+    0xC7, 0x07, 0xF8, 0x0F, 0x87, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x3F,
+    0xDF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD6 'Ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F,
+    0xFF, 0x80, 0xFC, 0x0F, 0xFF, 0x07, 0xFF, 0x0F, 0xCE, 0x0F, 0xFF, 0x8F,
+    0x86, 0x1F, 0xFF, 0x8F, 0x06, 0x1F, 0xFF, 0x8F, 0x0E, 0x3F, 0xFF, 0x8F,
+    0x9E, 0x3F, 0xFF, 0x0F, 0xFE, 0x3F, 0xFE, 0x0F, 0xCE, 0x1F, 0xFC, 0x1F,
+    0x86, 0x0F, 0xF0, 0x1F, 0x06, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x7F,
+    0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xD7 '×'
+    0xDF, 0xDF, 0x8F, 0x8F, 0x87, 0x07, 0xC2, 0x0F, 0xE0, 0x1F, 0xF0, 0x3F,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x83, 0x0F, 0x87, 0x87, 0xCF, 0xCF,
+    0xFF, 0xFF,
+    // 0xD8 'Ø'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0x80, 0x23, 0xFE, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x7C, 0x03,
+    0xC1, 0xF8, 0xC3, 0x83, 0xF0, 0xE3, 0x87, 0xE1, 0xE3, 0x87, 0xE3, 0xE3,
+    0x8F, 0xC7, 0xE3, 0x8F, 0x8F, 0xC3, 0x8F, 0x1F, 0x83, 0x86, 0x3F, 0x07,
+    0x80, 0x7C, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
+    0xC0, 0x00, 0xFF, 0x88, 0x03, 0xFF, 0x1F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xD9 'Ù'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x8F, 0xE0, 0x0F, 0xFF, 0x8C, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x03, 0x83,
+    0xFF, 0x80, 0x7F, 0xC3, 0xFF, 0x87, 0xFF, 0xE3, 0xCF, 0x8F, 0xFF, 0xE3,
+    0x87, 0x9F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3,
+    0xE3, 0xFF, 0xFF, 0x87, 0xF1, 0xDF, 0xFC, 0x07, 0xF9, 0x8F, 0x80, 0x0F,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xDA 'Ú'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x8F, 0xE0, 0x0F, 0xFF, 0x8C, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x03, 0x83,
+    0xFF, 0x80, 0x7F, 0xC3, 0xFF, 0x87, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xFF, 0x9F, 0xFF, 0xE3, 0xF9, 0xFF, 0xFF, 0xC3, 0xF1, 0xFF, 0xFF, 0xC3,
+    0xE1, 0xFF, 0xFF, 0x87, 0xE3, 0xDF, 0xFC, 0x07, 0xC3, 0x8F, 0x80, 0x0F,
+    0x87, 0x80, 0x00, 0x1F, 0x87, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0xDB 'Û'
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0xC0, 0x1F, 0xFF, 0x18, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x07,
+    0xFF, 0x00, 0xFF, 0x87, 0xFB, 0x0F, 0xFF, 0xC7, 0xF3, 0x1F, 0xFF, 0xC7,
+    0xE3, 0x3F, 0xFF, 0xC7, 0xC3, 0xFF, 0xFF, 0x87, 0x87, 0xFF, 0xFF, 0x87,
+    0x0F, 0xFF, 0xFF, 0x0F, 0x1F, 0xBF, 0xF8, 0x0F, 0x0F, 0x1F, 0x00, 0x1F,
+    0x87, 0x00, 0x00, 0x3F, 0xC3, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
+    // 0xDC 'Ü'
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x3F, 0x80, 0x3F, 0xFE, 0x30, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0E, 0x0F,
+    0xFE, 0x01, 0xFF, 0x0F, 0xFE, 0x1F, 0xFF, 0x8F, 0x8E, 0x3F, 0xFF, 0x8F,
+    0x06, 0x7F, 0xFF, 0x8F, 0x0F, 0xFF, 0xFF, 0x0F, 0x8F, 0xFF, 0xFF, 0x0F,
+    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x7F, 0xF0, 0x1F, 0x86, 0x3E, 0x00, 0x3F,
+    0x06, 0x00, 0x00, 0x7F, 0x0E, 0x00, 0x01, 0xFF, 0x9E, 0x00, 0x07, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0xDE 'Þ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0x07, 0x3F, 0xE0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x67, 0x00, 0x3C, 0x67, 0x01, 0xFC, 0x7F,
+    0x11, 0xFC, 0x7F, 0x31, 0xF8, 0xFF, 0x30, 0xF0, 0xFF, 0xF0, 0x00, 0xFF,
+    0xF8, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x1F, 0xFF,
+    // 0xDF 'ß'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xF9, 0xFF, 0xC0, 0x7F, 0xF0, 0xFF,
+    0x83, 0xFF, 0xE0, 0xFF, 0x8F, 0xF3, 0xF0, 0xFF, 0x8F, 0xC1, 0xF8, 0xFF,
+    0x9F, 0x80, 0x78, 0xFF, 0x0F, 0x00, 0x38, 0xFF, 0x80, 0x18, 0x00, 0xFF,
+    0x80, 0x3C, 0x01, 0xFF, 0x80, 0x7E, 0x03, 0xFF, 0xC1, 0xFF, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE0 'à'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x3C, 0x3F,
+    0xFF, 0xE0, 0xFE, 0x3F, 0xC7, 0xC3, 0xFC, 0x7F, 0x83, 0xC7, 0xF8, 0xFF,
+    0xC1, 0xC7, 0xE1, 0xFF, 0xE1, 0xC7, 0x80, 0x7F, 0xF0, 0xE0, 0x00, 0x3F,
+    0xFD, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x3C, 0x3F,
+    0xFF, 0xC3, 0xFC, 0x7F, 0xFF, 0xDF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE1 'á'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x3C, 0x3F,
+    0xFF, 0xE0, 0xFE, 0x3F, 0xFF, 0xC3, 0xFC, 0x7F, 0xFF, 0xC7, 0xF8, 0xFF,
+    0xFF, 0xC7, 0xE1, 0xFF, 0xF9, 0xC7, 0x80, 0x7F, 0xF0, 0xE0, 0x00, 0x3F,
+    0xC1, 0xE0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F, 0x87, 0xC0, 0x3C, 0x3F,
+    0xCF, 0xC3, 0xFC, 0x7F, 0xFF, 0xDF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE2 'â'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x78, 0x7F,
+    0xF9, 0xC1, 0xFC, 0x7F, 0xF1, 0x87, 0xF8, 0xFF, 0xE1, 0x8F, 0xF1, 0xFF,
+    0xC3, 0x8F, 0xC3, 0xFF, 0x8F, 0x8F, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x7F,
+    0x07, 0xC0, 0x00, 0x7F, 0x81, 0x80, 0x00, 0x7F, 0xE1, 0x80, 0x78, 0x7F,
+    0xFF, 0x87, 0xF8, 0xFF, 0xFF, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE3 'ã'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0xF0, 0xFF,
+    0xC7, 0x83, 0xF8, 0xFF, 0x87, 0x0F, 0xF1, 0xFF, 0x8F, 0x1F, 0xE3, 0xFF,
+    0x1F, 0x1F, 0x87, 0xFF, 0x8F, 0x1E, 0x01, 0xFF, 0x87, 0x80, 0x00, 0xFF,
+    0xC7, 0x80, 0x00, 0xFF, 0xC7, 0x00, 0x00, 0xFF, 0x87, 0x00, 0xF0, 0xFF,
+    0x8F, 0x0F, 0xF1, 0xFF, 0xFF, 0x7F, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE4 'ä'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x01,
+    0xFF, 0x80, 0x01, 0xFF, 0x01, 0xE1, 0x8F, 0x07, 0xF1, 0x0E, 0x1F, 0xE3,
+    0x0E, 0x3F, 0xC7, 0x0E, 0x3F, 0x0F, 0xFE, 0x3C, 0x03, 0xFF, 0x00, 0x01,
+    0x8F, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x0E, 0x01, 0xE1, 0x1E, 0x1F, 0xE3,
+    0xFE, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    // 0xE5 'å'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x3F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x3C, 0x3F,
+    0xFF, 0xE0, 0xFE, 0x3F, 0xF1, 0xC3, 0xFC, 0x7F, 0xC0, 0xC7, 0xF8, 0xFF,
+    0x80, 0xC7, 0xE1, 0xFF, 0x9C, 0x47, 0x80, 0x7F, 0x9C, 0x60, 0x00, 0x3F,
+    0x88, 0xE0, 0x00, 0x3F, 0x81, 0xC0, 0x00, 0x3F, 0xC3, 0xC0, 0x3C, 0x3F,
+    0xFF, 0xC3, 0xFC, 0x7F, 0xFF, 0xDF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE6 'æ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0x78, 0x7F, 0xC1, 0xFC, 0x7F, 0x87, 0xF8, 0xFF,
+    0x8F, 0xF1, 0xFF, 0x8F, 0xC3, 0xFF, 0x8F, 0x03, 0xFF, 0x84, 0x00, 0xFF,
+    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x88, 0x7F, 0xC7, 0x9C, 0x7F,
+    0x8F, 0x1C, 0x7F, 0x8F, 0x1C, 0x7F, 0x8C, 0x38, 0x7F, 0x80, 0x78, 0xFF,
+    0x80, 0x71, 0xFF, 0xC0, 0xF3, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0xE7 'ç'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x7F,
+    0xF0, 0x00, 0x7E, 0x7F, 0xE0, 0x00, 0x64, 0x7F, 0xC0, 0x70, 0x40, 0xFF,
+    0xC3, 0xFC, 0x40, 0xFF, 0x87, 0xFC, 0x63, 0xFF, 0x8F, 0xF8, 0x7F, 0xFF,
+    0x8F, 0xF8, 0xFF, 0xFF, 0x87, 0xF0, 0xFF, 0xFF, 0x83, 0xF1, 0xFF, 0xFF,
+    0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xE8 'è'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0xC6, 0x3F,
+    0xC7, 0xE3, 0xCE, 0x3F, 0x83, 0xC7, 0x8E, 0x3F, 0xC1, 0xC7, 0x1E, 0x3F,
+    0xE0, 0xC6, 0x1C, 0x7F, 0xF8, 0xC0, 0x38, 0x7F, 0xFD, 0xC0, 0x78, 0xFF,
+    0xFF, 0xE0, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    // 0xE9 'é'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0xC6, 0x3F,
+    0xFF, 0xE3, 0xCE, 0x3F, 0xFF, 0xC7, 0x8E, 0x3F, 0xFF, 0xC7, 0x1E, 0x3F,
+    0xF8, 0xC6, 0x1C, 0x7F, 0xE0, 0xC0, 0x38, 0x7F, 0xC1, 0xC0, 0x78, 0xFF,
+    0x83, 0xE0, 0xF9, 0xFF, 0x87, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0xEA 'ê'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xF9, 0xC1, 0x8C, 0x7F,
+    0xF1, 0xC7, 0x9C, 0x7F, 0xE3, 0x8F, 0x1C, 0x7F, 0x87, 0x8E, 0x3C, 0x7F,
+    0x8F, 0x8C, 0x38, 0xFF, 0x0F, 0x80, 0x70, 0xFF, 0x03, 0x80, 0xF1, 0xFF,
+    0xC1, 0xC1, 0xF3, 0xFF, 0xE1, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEB 'ë'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01,
+    0xFF, 0x80, 0x01, 0x8F, 0x06, 0x31, 0x0F, 0x1E, 0x71, 0x0E, 0x3C, 0x71,
+    0x1E, 0x38, 0xF1, 0xFE, 0x30, 0xE3, 0xFE, 0x01, 0xC3, 0x8E, 0x03, 0xC7,
+    0x0F, 0x07, 0xCF, 0x0F, 0x9F, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0xEC 'ì'
+    0xFF, 0xE7, 0xFC, 0x7F, 0xFF, 0xE7, 0xC0, 0x3F, 0xC7, 0xC6, 0x00, 0x3F,
+    0x83, 0xC0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F, 0xE1, 0xC0, 0x1C, 0x3F,
+    0xF0, 0xC1, 0xFC, 0x7F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xED 'í'
+    0xFF, 0xE7, 0xFC, 0x7F, 0xFF, 0xE7, 0xC0, 0x3F, 0xFF, 0xC6, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0xC0, 0x1C, 0x3F,
+    0xF0, 0xC1, 0xFC, 0x7F, 0xE1, 0xFF, 0xFC, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xEE 'î'
+    0xFF, 0xCF, 0xF8, 0xFF, 0xFD, 0xCF, 0x80, 0x7F, 0xF1, 0x8C, 0x00, 0x7F,
+    0xE1, 0x80, 0x00, 0x7F, 0xC3, 0x80, 0x00, 0x7F, 0x87, 0x80, 0x38, 0x7F,
+    0x8F, 0x83, 0xF8, 0xFF, 0x07, 0xFF, 0xF9, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    // 0xEF 'ï'
+    0xFF, 0x3F, 0xE3, 0xDF, 0x3E, 0x01, 0x8E, 0x30, 0x01, 0x0E, 0x00, 0x01,
+    0x0E, 0x00, 0x01, 0x9E, 0x00, 0xE1, 0xFE, 0x0F, 0xE3, 0x8F, 0xFF, 0xE7,
+    0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF0 'ð'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x78, 0x7F,
+    0xFD, 0xC3, 0xFC, 0x7F, 0xC8, 0xC7, 0xFC, 0x7F, 0x81, 0x87, 0xFC, 0x7F,
+    0x81, 0x8F, 0xF8, 0x7F, 0xC1, 0x87, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x01, 0xFF, 0x8C, 0x00, 0x07, 0xFF, 0x9E, 0x00, 0x0F, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF,
+    // 0xF1 'ñ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0xFF, 0xFF, 0x9F, 0xC0, 0xFF,
+    0xFF, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xC7, 0x00, 0x1F, 0xFF, 0x87, 0x00, 0xFF, 0xFF, 0x8F, 0xE3, 0xFF, 0xFF,
+    0x1F, 0xC7, 0xFF, 0xFF, 0x8F, 0x8F, 0xE1, 0xFF, 0x87, 0x1E, 0x00, 0xFF,
+    0xC7, 0x00, 0x00, 0xFF, 0xC7, 0x00, 0x00, 0xFF, 0x87, 0x00, 0x00, 0xFF,
+    0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    // 0xF2 'ò'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x7C, 0x3F,
+    0xFF, 0xE1, 0xFE, 0x3F, 0xC7, 0xC3, 0xFE, 0x3F, 0x83, 0xC7, 0xFE, 0x3F,
+    0xC1, 0xC7, 0xFC, 0x3F, 0xE1, 0xC3, 0xF0, 0x7F, 0xF0, 0xC0, 0x00, 0x7F,
+    0xFC, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
+    0xFF, 0xFE, 0xFF, 0xFF,
+    // 0xF3 'ó'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x7C, 0x3F,
+    0xFF, 0xE1, 0xFE, 0x3F, 0xFF, 0xC3, 0xFE, 0x3F, 0xFF, 0xC7, 0xFE, 0x3F,
+    0xFF, 0xC7, 0xFC, 0x3F, 0xF9, 0xC3, 0xF0, 0x7F, 0xF0, 0xC0, 0x00, 0x7F,
+    0xC1, 0xC0, 0x00, 0xFF, 0x83, 0xE0, 0x03, 0xFF, 0x87, 0xF0, 0x07, 0xFF,
+    0xCF, 0xFE, 0xFF, 0xFF,
+    // 0xF4 'ô'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0xF8, 0x7F,
+    0xF9, 0xC3, 0xFC, 0x7F, 0xF1, 0x87, 0xFC, 0x7F, 0xE1, 0x8F, 0xFC, 0x7F,
+    0xC3, 0x8F, 0xF8, 0x7F, 0x87, 0x87, 0xE0, 0xFF, 0x0F, 0x80, 0x00, 0xFF,
+    0x07, 0x80, 0x01, 0xFF, 0x81, 0xC0, 0x07, 0xFF, 0xE1, 0xE0, 0x0F, 0xFF,
+    0xFB, 0xFD, 0xFF, 0xFF,
+    // 0xF5 'õ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x81, 0xF0, 0xFF,
+    0xC7, 0x87, 0xF8, 0xFF, 0x87, 0x0F, 0xF8, 0xFF, 0x8F, 0x1F, 0xF8, 0xFF,
+    0x1F, 0x1F, 0xF0, 0xFF, 0x8F, 0x0F, 0xC1, 0xFF, 0x87, 0x00, 0x01, 0xFF,
+    0xC7, 0x00, 0x03, 0xFF, 0xC7, 0x80, 0x0F, 0xFF, 0x87, 0xC0, 0x1F, 0xFF,
+    0x8F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF6 'ö'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01,
+    0xFF, 0x80, 0x01, 0xFF, 0x03, 0xE1, 0x8F, 0x0F, 0xF1, 0x0E, 0x1F, 0xF1,
+    0x0E, 0x3F, 0xF1, 0x0E, 0x3F, 0xE1, 0xBE, 0x1F, 0x83, 0xFE, 0x00, 0x03,
+    0x8E, 0x00, 0x07, 0x0F, 0x00, 0x1F, 0x0F, 0x80, 0x3F, 0x1F, 0xF7, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    // 0xF7 '÷'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x98, 0xE7,
+    0x08, 0xC3, 0x08, 0xC3, 0x08, 0xC3, 0x98, 0xEF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF,
+    // 0xF8 'ø'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x7F, 0xFE, 0x00, 0xFF,
+    0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0xC4, 0x7F,
+    0xC3, 0x8C, 0x7F, 0x87, 0x9C, 0x7F, 0x8F, 0x3C, 0x7F, 0x8E, 0x78, 0x7F,
+    0x8C, 0xE0, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0xFF,
+    0xC0, 0x0F, 0xFF, 0x8D, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0xF9 'ù'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x7F, 0xFF, 0xE7, 0xC0, 0x3F,
+    0xFF, 0xC4, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x3E, 0x3F, 0xC7, 0xE1, 0xFC, 0x7F, 0x83, 0xFF, 0xF8, 0xFF,
+    0xC1, 0xFF, 0xF1, 0xFF, 0xE0, 0xFF, 0xC3, 0xFF, 0xF8, 0xFE, 0x00, 0x3F,
+    0xFD, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x04, 0x3F,
+    0xFF, 0xC0, 0xFC, 0x7F, 0xFF, 0xCF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0xFA 'ú'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x7F, 0xFF, 0xE7, 0xC0, 0x3F,
+    0xFF, 0xC4, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x3E, 0x3F, 0xFF, 0xE1, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xC3, 0xFF, 0xE0, 0xFE, 0x00, 0x3F,
+    0xC1, 0xE0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F, 0x87, 0xC0, 0x04, 0x3F,
+    0xCF, 0xC0, 0xFC, 0x7F, 0xFF, 0xCF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0xFB 'û'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0xCF, 0x80, 0x7F,
+    0xFF, 0x88, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xF9, 0x80, 0x7C, 0x7F, 0xF1, 0xC3, 0xF8, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF,
+    0x87, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x0F, 0xFC, 0x00, 0x7F,
+    0x03, 0xC0, 0x00, 0x7F, 0xC1, 0x80, 0x00, 0x7F, 0xE1, 0x80, 0x08, 0x7F,
+    0xFF, 0x81, 0xF8, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
+    // 0xFC 'ü'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE3, 0xFF, 0x3E, 0x01, 0xFE, 0x20, 0x01,
+    0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x8E, 0x01, 0xF1, 0x0F, 0x0F, 0xE3,
+    0x0F, 0xFF, 0xC7, 0x1F, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x01,
+    0x8F, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x0E, 0x00, 0x21, 0x9E, 0x07, 0xE3,
+    0xFE, 0x7F, 0xE3, 0xFF, 0xFF, 0xE7,
+    // 0xFE 'þ'
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xCF, 0xFC, 0x00, 0x01,
+    0x8F, 0xC0, 0x00, 0x01, 0x88, 0x00, 0x00, 0xF1, 0x80, 0x00, 0x00, 0xF1,
+    0x80, 0x00, 0xF8, 0xFB, 0x80, 0x63, 0xF8, 0xFF, 0x83, 0xC7, 0xF8, 0xFF,
+    0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x0F, 0xC1, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF,
+    // 0xFF 'ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0xFF, 0xC3,
+    0xFF, 0x3F, 0xFF, 0xC3, 0xFE, 0x3F, 0xFF, 0xC7, 0xFE, 0x0F, 0xFF, 0x8F,
+    0x8E, 0x00, 0x7E, 0x0F, 0x0E, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x3F,
+    0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
+    0x8F, 0x7C, 0x07, 0xFF, 0x0E, 0x00, 0x1F, 0xFF, 0x0E, 0x00, 0x3F, 0xFF,
+    0x1E, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x104 'Ą'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
+    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x33, 0xFF, 0xFF, 0xC0, 0xF3, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x18, 0xFF, 0xFF,
+    0xE0, 0x78, 0xFF, 0xFF, 0xC1, 0xF8, 0xFB, 0xFF, 0x80, 0xF8, 0xF3, 0x9F,
+    0x80, 0x00, 0xE2, 0x0F, 0x80, 0x00, 0x02, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
+    0xFE, 0x00, 0x01, 0xCF, 0xFF, 0xF0, 0x01, 0xCF, 0xFF, 0xFF, 0x83, 0xDF,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x105 'ą'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0x78, 0x7F, 0xC1, 0xFC, 0x7F, 0x87, 0xF8, 0xFF,
+    0x8F, 0xF1, 0xFF, 0x8F, 0xC3, 0xFF, 0x8F, 0x01, 0xF3, 0xC0, 0x00, 0x41,
+    0xC0, 0x00, 0x01, 0x80, 0x00, 0x19, 0x80, 0x78, 0x79, 0x87, 0xF8, 0xF9,
+    0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x106 'Ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03,
+    0xFF, 0xE0, 0x7F, 0x03, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xC3, 0xFF, 0xC3,
+    0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0xC3, 0xF9, 0x8F, 0xFF, 0xC3,
+    0xF1, 0x8F, 0xFF, 0xC3, 0xE3, 0x8F, 0xFF, 0xC3, 0xE3, 0x8F, 0xFF, 0x87,
+    0xC3, 0x8F, 0xFF, 0x87, 0x87, 0x80, 0xFF, 0x0F, 0x87, 0x80, 0xFF, 0xBF,
+    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x107 'ć'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x38, 0x3F,
+    0xFF, 0xE1, 0xFE, 0x3F, 0xFF, 0xC3, 0xFE, 0x3F, 0xFF, 0xC7, 0xFC, 0x3F,
+    0xF8, 0xC7, 0xFC, 0x7F, 0xE0, 0xC3, 0xF8, 0x7F, 0xC1, 0xC1, 0xF8, 0xFF,
+    0x83, 0xE3, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x10C 'Č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03,
+    0xFF, 0xE0, 0x7F, 0x03, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xC3, 0xFF, 0xC3,
+    0x8F, 0x87, 0xFF, 0xC3, 0x83, 0x87, 0xFF, 0xC3, 0xC1, 0x8F, 0xFF, 0xC3,
+    0xE1, 0x8F, 0xFF, 0xC3, 0xF1, 0x8F, 0xFF, 0xC3, 0xE1, 0x8F, 0xFF, 0x87,
+    0xC3, 0x8F, 0xFF, 0x87, 0xC7, 0x80, 0xFF, 0x0F, 0x8F, 0x80, 0xFF, 0xBF,
+    0x9F, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10D 'č'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xE0, 0x38, 0x3F,
+    0x87, 0xE1, 0xFE, 0x3F, 0x81, 0xC3, 0xFE, 0x3F, 0xE0, 0xC7, 0xFC, 0x3F,
+    0xF0, 0xC7, 0xFC, 0x7F, 0xE1, 0xC3, 0xF8, 0x7F, 0xC3, 0xC1, 0xF8, 0xFF,
+    0xC7, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10E 'Ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF, 0x83, 0xFF, 0xCF, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xFF, 0x80, 0x01, 0xE3, 0xCF, 0x80, 0x3F, 0xE3, 0x87, 0x83, 0xFF, 0xE3,
+    0x83, 0x8F, 0xFF, 0xE3, 0xE1, 0x8F, 0xFF, 0xC3, 0xF1, 0x8F, 0xFF, 0xC3,
+    0xF1, 0x87, 0xFF, 0x87, 0xE3, 0x87, 0xFF, 0x07, 0xC7, 0x81, 0xFC, 0x0F,
+    0x8F, 0xC0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x1F, 0x9F, 0xE0, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x10F 'ď'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0xF0, 0xFF,
+    0xFF, 0x83, 0xF8, 0xFF, 0xFF, 0x0F, 0xF1, 0xFF, 0xFF, 0x1F, 0xE3, 0xFF,
+    0xFF, 0x1F, 0x87, 0xFF, 0xCF, 0x1E, 0x01, 0xFF, 0x8F, 0x80, 0x00, 0xFF,
+    0x8E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF0, 0xFF,
+    0x80, 0x1F, 0xF1, 0xFF, 0x81, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x118 'Ę'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x3F, 0xE0, 0x07, 0xFF,
+    0x1C, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF,
+    0x00, 0x03, 0xC7, 0xFF, 0x00, 0x0F, 0xC7, 0xFF, 0x07, 0x8F, 0xC6, 0x3F,
+    0x1F, 0x8F, 0xC4, 0x1F, 0x1F, 0x8F, 0xC0, 0x1F, 0x1F, 0x8F, 0x81, 0x9F,
+    0x1F, 0x8F, 0x03, 0x9F, 0x1F, 0x9C, 0x07, 0x9F, 0x03, 0xFE, 0x1F, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+    // 0x119 'ę'
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC1, 0x8C, 0x61, 0xC7, 0x9C, 0x01, 0x8F, 0x1C, 0x01,
+    0x8E, 0x3C, 0x39, 0x8C, 0x38, 0x79, 0x80, 0x70, 0xFB, 0x80, 0xF1, 0xFF,
+    0xC1, 0xF3, 0xFF, 0xE7, 0xFF, 0xFF,
+    // 0x11A 'Ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
+    0xDF, 0x80, 0x01, 0xE3, 0x87, 0x80, 0x07, 0xE3, 0x83, 0x83, 0xC7, 0xE3,
+    0xC1, 0x8F, 0xC7, 0xE3, 0xF1, 0x8F, 0xC7, 0xE3, 0xF1, 0x8F, 0xC7, 0xC3,
+    0xE1, 0x8F, 0xC7, 0x83, 0xC3, 0x8F, 0xCE, 0x03, 0xC7, 0x81, 0xFF, 0x0F,
+    0x8F, 0x81, 0xFF, 0xFF, 0x9F, 0x81, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    // 0x11B 'ě'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xE0, 0xC6, 0x3F,
+    0x87, 0xE3, 0xCE, 0x3F, 0x81, 0xC7, 0x8E, 0x3F, 0xE0, 0xC7, 0x1E, 0x3F,
+    0xF0, 0xC6, 0x1C, 0x7F, 0xE1, 0xC0, 0x38, 0x7F, 0xC3, 0xC0, 0x78, 0xFF,
+    0xC7, 0xE0, 0xF9, 0xFF, 0x8F, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x139 'Ĺ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xF9, 0x80, 0x00, 0x03,
+    0xF1, 0x80, 0x01, 0xE3, 0xE1, 0x80, 0x1F, 0xE3, 0xE3, 0x83, 0xFF, 0xE3,
+    0xC3, 0x8F, 0xFF, 0xE3, 0x87, 0x9F, 0xFF, 0xE3, 0x87, 0x9F, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x13A 'ĺ'
+    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x9F, 0xF8, 0x01, 0xFF, 0x1F, 0x80, 0x01,
+    0xF3, 0x10, 0x00, 0x01, 0xE3, 0x00, 0x00, 0x01, 0xE3, 0x00, 0x03, 0xE3,
+    0xC3, 0x00, 0x3F, 0xE3, 0xC7, 0x07, 0xFF, 0xE7, 0x87, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    // 0x13D 'Ľ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xE0, 0xE7, 0xFC, 0x00, 0xE3, 0x80, 0x00, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x78, 0xE0, 0x07, 0xF8, 0xE0, 0xFF, 0xF8,
+    0xE3, 0xFF, 0xF8, 0xE7, 0xFF, 0xF8, 0xE7, 0xFF, 0xF0, 0xFD, 0xFF, 0xC0,
+    0xC0, 0xFF, 0x80, 0x81, 0xFF, 0x83, 0x87, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x13E 'ľ'
+    0xFF, 0xFF, 0xE0, 0xFF, 0xCF, 0xFC, 0x00, 0xFF, 0x8F, 0xC0, 0x00, 0xFF,
+    0x88, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF1, 0xFF,
+    0x80, 0x1F, 0xF1, 0xFF, 0x83, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x141 'Ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF3, 0xE7, 0xFF, 0xE3, 0xC7,
+    0xFF, 0xE7, 0x07, 0x3F, 0xC0, 0x07, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0xC7, 0x00, 0x1F, 0xC7, 0x07, 0x3F, 0xC7,
+    0x1E, 0x3F, 0xC7, 0x3E, 0x7F, 0xC7, 0x3F, 0xFF, 0x87, 0xFF, 0xFE, 0x07,
+    0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
+    // 0x142 'ł'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xFF,
+    0xCF, 0xF8, 0x00, 0xFF, 0x8F, 0xC0, 0x00, 0xFF, 0x88, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF1, 0xFF, 0x80, 0x0F, 0xF1, 0xFF,
+    0x83, 0xCF, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    // 0x143 'Ń'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03, 0xFF, 0x8F, 0x00, 0x03,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xE3, 0xFF, 0x80, 0x1F, 0xF3,
+    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+    0xF9, 0xF8, 0x00, 0xFF, 0xF1, 0xFE, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x0F,
+    0xE3, 0xFF, 0xF0, 0x03, 0xC3, 0xFF, 0xFC, 0x03, 0xC3, 0x9F, 0xF0, 0x03,
+    0x87, 0x8E, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x144 'ń'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7, 0xF0, 0x3F,
+    0xFF, 0xC6, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xE3, 0xF8, 0x7F, 0xF0, 0xC7, 0x80, 0x3F,
+    0xC1, 0xC0, 0x00, 0x3F, 0x83, 0xC0, 0x00, 0x3F, 0x87, 0xC0, 0x00, 0x3F,
+    0xCF, 0xC0, 0x3C, 0x3F, 0xFF, 0xF3, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x147 'Ň'
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x9F, 0xF0, 0x03, 0xFF, 0x8F, 0x00, 0x03,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xE3, 0xFF, 0x80, 0x1F, 0xF3,
+    0xFF, 0x80, 0x7F, 0xFF, 0xCF, 0x80, 0x0F, 0xFF, 0x87, 0xE0, 0x03, 0xFF,
+    0xC3, 0xF8, 0x00, 0xFF, 0xE1, 0xFE, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x0F,
+    0xF1, 0xFF, 0xF0, 0x03, 0xE3, 0xFF, 0xFC, 0x03, 0xC7, 0x9F, 0xF0, 0x03,
+    0x8F, 0x8E, 0x00, 0x03, 0x8F, 0x80, 0x00, 0x0F, 0x9F, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x148 'ň'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0xE7, 0xF0, 0x3F,
+    0xFF, 0xC6, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xC0, 0x07, 0xFF, 0x87, 0xC0, 0x3F, 0xFF, 0x81, 0xF8, 0xFF, 0xFF,
+    0xE0, 0xF1, 0xFF, 0xFF, 0xF0, 0xE3, 0xF8, 0x7F, 0xF0, 0xC7, 0x80, 0x3F,
+    0xE3, 0xC0, 0x00, 0x3F, 0xC7, 0xC0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x3F,
+    0x9F, 0xC0, 0x3C, 0x3F, 0xFF, 0xF3, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x152 'Œ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x7F, 0x83, 0xC1, 0xFF, 0xC3,
+    0xC3, 0xFF, 0xC3, 0x87, 0xFF, 0xE3, 0x87, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3,
+    0x8F, 0xFF, 0xE3, 0x8F, 0xFF, 0x83, 0x8F, 0xF0, 0x03, 0x8F, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x01, 0xE3, 0x80, 0x07, 0xE3,
+    0x87, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xE3,
+    0x8F, 0xC7, 0x83, 0x8F, 0xCE, 0x03, 0x81, 0xFE, 0x0F, 0x81, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    // 0x153 'œ'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x7F, 0xC0, 0xF8, 0x7F, 0xC3, 0xFC, 0x7F, 0x87, 0xFC, 0x7F,
+    0x8F, 0xFC, 0x7F, 0x8F, 0xF8, 0x7F, 0x87, 0xE0, 0xFF, 0x80, 0x01, 0xFF,
+    0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE1, 0x88, 0x7F,
+    0xC7, 0x9C, 0x7F, 0x8F, 0x1C, 0x7F, 0x8E, 0x3C, 0x7F, 0x8C, 0x38, 0x7F,
+    0x80, 0x78, 0xFF, 0x80, 0x71, 0xFF, 0xC0, 0xF3, 0xFF, 0xE3, 0xFF, 0xFF,
+    // 0x158 'Ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xCF, 0xFF, 0x83, 0xFF, 0xCF, 0xF0, 0x03,
+    0xFF, 0x8E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x03,
+    0x87, 0x80, 0x01, 0xE3, 0x83, 0x80, 0x23, 0xF3, 0xC1, 0x87, 0xE0, 0xFF,
+    0xF1, 0x8F, 0xE0, 0x3F, 0xF1, 0x8F, 0xC0, 0x1F, 0xE1, 0x8F, 0x80, 0x07,
+    0xC3, 0x82, 0x06, 0x07, 0x87, 0x80, 0x0F, 0x03, 0x8F, 0xC0, 0x1F, 0x83,
+    0x9F, 0xC0, 0x3F, 0xC3, 0xFF, 0xE0, 0x7F, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x159 'ř'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xBF, 0xFF, 0xE7, 0xF0, 0x3F,
+    0xFF, 0xC7, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x7F,
+    0x87, 0xC0, 0x03, 0xFF, 0x81, 0xC0, 0x1F, 0xFF, 0xE0, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xF0, 0xFF, 0xFF, 0xE1, 0xE1, 0xFF, 0xFF, 0xC3, 0xC3, 0xFF, 0xFF,
+    0x87, 0xC3, 0xFF, 0xFF, 0x8F, 0xC1, 0xFF, 0xFF, 0x9F, 0xE7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15A 'Ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x07,
+    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xE0, 0x1F, 0xC3,
+    0xFF, 0xC0, 0x0F, 0xE3, 0xFF, 0x80, 0x07, 0xE3, 0xFF, 0x86, 0x07, 0xE3,
+    0xF9, 0x8F, 0x03, 0xE3, 0xF1, 0x8F, 0x81, 0xC3, 0xE1, 0x8F, 0xC0, 0x03,
+    0xE3, 0x8F, 0xC0, 0x07, 0xC3, 0x81, 0xE0, 0x0F, 0x83, 0x80, 0xF0, 0x1F,
+    0x87, 0x81, 0xFC, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x15B 'ś'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF8, 0xF0, 0x3F, 0xFF, 0xF0, 0x3C, 0x3F, 0xFF, 0xE0, 0x1E, 0x3F,
+    0xFF, 0xE0, 0x1E, 0x3F, 0xFF, 0xC6, 0x0E, 0x3F, 0xFF, 0xC7, 0x00, 0x3F,
+    0xF9, 0xC7, 0x00, 0x3F, 0xF0, 0xC7, 0x80, 0x7F, 0xC1, 0xC3, 0xC0, 0xFF,
+    0x83, 0xC3, 0xF3, 0xFF, 0x87, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
+    // 0x160 'Š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x07,
+    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xE0, 0x1F, 0xC3,
+    0xFF, 0xC0, 0x0F, 0xE3, 0x8F, 0x80, 0x07, 0xE3, 0x87, 0x86, 0x07, 0xE3,
+    0xC1, 0x8F, 0x03, 0xE3, 0xE1, 0x8F, 0x81, 0xC3, 0xF1, 0x8F, 0xC0, 0x03,
+    0xE1, 0x8F, 0xC0, 0x07, 0xE3, 0x81, 0xE0, 0x0F, 0xC7, 0x80, 0xF0, 0x1F,
+    0x8F, 0x81, 0xFC, 0x7F, 0x9F, 0xC3, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x161 'š'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xF8, 0xF0, 0x3F, 0xFF, 0xF0, 0x3C, 0x3F, 0xFF, 0xE0, 0x1E, 0x3F,
+    0x87, 0xE0, 0x1E, 0x3F, 0x81, 0xC6, 0x0E, 0x3F, 0xC0, 0xC7, 0x00, 0x3F,
+    0xF0, 0xC7, 0x00, 0x3F, 0xF0, 0xC7, 0x80, 0x7F, 0xE1, 0xC3, 0xC0, 0xFF,
+    0xC7, 0xC3, 0xF3, 0xFF, 0x8F, 0xF7, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x164 'Ť'
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF3, 0xFF, 0x80, 0xFF, 0xF3,
+    0xFF, 0x87, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0x03, 0xFF, 0x8F, 0xE0, 0x03,
+    0x8F, 0x8E, 0x00, 0x03, 0x87, 0x80, 0x00, 0x03, 0xC1, 0x80, 0x00, 0x03,
+    0xE1, 0x80, 0x01, 0xE3, 0xF1, 0x80, 0x3F, 0xF3, 0xE1, 0x87, 0xFF, 0xFF,
+    0xC3, 0x8F, 0xFF, 0xFF, 0xC7, 0x8F, 0xFF, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF,
+    0x9F, 0x80, 0xFF, 0xFF, 0xBF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x165 'ť'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x9F, 0x81, 0xFF,
+    0xFF, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xF8, 0x00, 0x10, 0xFF, 0xF0, 0x03, 0xF8, 0xFF, 0xF0, 0x1F, 0xF0, 0xFF,
+    0xFF, 0x1F, 0xF1, 0xFF, 0xFB, 0x1F, 0xE3, 0xFF, 0xC1, 0x1F, 0xE7, 0xFF,
+    0x03, 0xBF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    // 0x16E 'Ů'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x8F, 0xE0, 0x0F, 0xFF, 0x8C, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x03, 0x83,
+    0xFF, 0x80, 0x7F, 0xC3, 0xFF, 0x87, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xE3,
+    0xC3, 0x9F, 0xFF, 0xE3, 0x81, 0xFF, 0xFF, 0xC3, 0x98, 0xFF, 0xFF, 0xC3,
+    0x1C, 0xFF, 0xFF, 0x87, 0x18, 0xDF, 0xFC, 0x07, 0x81, 0x8F, 0x80, 0x0F,
+    0x81, 0x80, 0x00, 0x1F, 0xE7, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x16F 'ů'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x7F, 0xFF, 0xE7, 0xC0, 0x3F,
+    0xFF, 0xC4, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x3E, 0x3F, 0xE1, 0xE1, 0xFC, 0x7F, 0xC0, 0xFF, 0xF8, 0xFF,
+    0x8C, 0x7F, 0xF1, 0xFF, 0x9C, 0x7F, 0xC3, 0xFF, 0x9C, 0xFE, 0x00, 0x3F,
+    0x80, 0xE0, 0x00, 0x3F, 0x81, 0xC0, 0x00, 0x3F, 0xE3, 0xC0, 0x04, 0x3F,
+    0xFF, 0xC0, 0xFC, 0x7F, 0xFF, 0xCF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF,
+    // 0x170 'Ű'
+    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x8F, 0xE0, 0x0F, 0xFF, 0x8C, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x03, 0x83,
+    0xFF, 0x80, 0x7F, 0xC3, 0xF9, 0x87, 0xFF, 0xE3, 0xF1, 0x8F, 0xFF, 0xE3,
+    0xF1, 0x9F, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3,
+    0x87, 0xFF, 0xFF, 0x87, 0x87, 0xDF, 0xFC, 0x07, 0xC9, 0x8F, 0x80, 0x0F,
+    0xF1, 0x80, 0x00, 0x1F, 0xF1, 0x80, 0x00, 0x7F, 0xE3, 0x80, 0x01, 0xFF,
+    0xC3, 0x80, 0x3F, 0xFF, 0x87, 0x87, 0xFF, 0xFF, 0x87, 0x8F, 0xFF, 0xFF,
+    0xCF, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x171 'ű'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0xCF, 0x80, 0x7F,
+    0xFF, 0x88, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F,
+    0xF9, 0x80, 0x7C, 0x7F, 0xE1, 0xC3, 0xF8, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF,
+    0x87, 0xFF, 0xE3, 0xFF, 0x0F, 0xFF, 0x87, 0xFF, 0x9B, 0xFC, 0x00, 0x7F,
+    0xF1, 0xC0, 0x00, 0x7F, 0xC3, 0x80, 0x00, 0x7F, 0x87, 0x80, 0x08, 0x7F,
+    0x07, 0x81, 0xF8, 0xFF, 0x9F, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
+    // 0x178 'Ÿ'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xCF,
+    0xFE, 0x07, 0xFF, 0xCF, 0xFE, 0x00, 0xFF, 0x8F, 0xFE, 0x00, 0x1C, 0x0F,
+    0xFE, 0x00, 0x00, 0x0F, 0x8E, 0x20, 0x00, 0x0F, 0x06, 0x7C, 0x00, 0x0F,
+    0x0E, 0x7F, 0x00, 0x0F, 0x8F, 0xFE, 0x07, 0x8F, 0xFF, 0xFC, 0x1F, 0xCF,
+    0xFF, 0x70, 0x7F, 0xFF, 0x8E, 0x20, 0xFF, 0xFF, 0x06, 0x01, 0xFF, 0xFF,
+    0x0E, 0x07, 0xFF, 0xFF, 0x8E, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    // 0x179 'Ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xF1, 0xFF, 0x03, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x80, 0xFC, 0x03,
+    0xFF, 0x83, 0xF0, 0x03, 0xFF, 0x8F, 0xE0, 0x23, 0xFF, 0x8F, 0xC0, 0x63,
+    0xF9, 0x8F, 0x81, 0xE3, 0xF1, 0x8E, 0x03, 0xE3, 0xE1, 0x8C, 0x07, 0xE3,
+    0xE3, 0x88, 0x0F, 0xE3, 0xC3, 0x80, 0x1F, 0xC3, 0xC3, 0x80, 0x7F, 0x03,
+    0x87, 0x80, 0xFE, 0x03, 0xCF, 0x81, 0xFE, 0x07, 0xFF, 0x83, 0xFF, 0x3F,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17A 'ź'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0xFC, 0x3F,
+    0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xC0, 0xF0, 0x7F, 0xFF, 0xC1, 0xE0, 0x7F,
+    0xFF, 0xC3, 0xC0, 0x7F, 0xFF, 0xC3, 0x84, 0x3F, 0xFF, 0xC3, 0x0C, 0x3F,
+    0xF8, 0xE0, 0x1E, 0x3F, 0xE0, 0xE0, 0x3E, 0x3F, 0xC1, 0xF0, 0x7C, 0x3F,
+    0x83, 0xC0, 0xF0, 0x3F, 0x87, 0xC3, 0xF8, 0x7F, 0xCF, 0xC7, 0xFF, 0xFF,
+    0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x17B 'Ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFF, 0xE3, 0xFE, 0x07, 0xFF, 0x01, 0xFC, 0x07, 0xFF, 0x01, 0xF8, 0x07,
+    0xFF, 0x07, 0xE0, 0x07, 0xFF, 0x1F, 0xC0, 0x47, 0xFF, 0x1F, 0x80, 0xC7,
+    0xFF, 0x1F, 0x03, 0xC7, 0xC7, 0x1C, 0x07, 0xC7, 0x83, 0x18, 0x0F, 0xC7,
+    0x87, 0x10, 0x1F, 0xC7, 0x87, 0x00, 0x3F, 0x87, 0xFF, 0x00, 0xFE, 0x07,
+    0xFF, 0x01, 0xFC, 0x07, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x07, 0xFE, 0x7F,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17C 'ż'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF7, 0xF0, 0xFF,
+    0xFF, 0x83, 0xE0, 0xFF, 0xFF, 0x03, 0xC1, 0xFF, 0xFF, 0x07, 0x81, 0xFF,
+    0xFF, 0x0F, 0x01, 0xFF, 0xFF, 0x0E, 0x10, 0xFF, 0x87, 0x0C, 0x30, 0xFF,
+    0x87, 0x80, 0x78, 0xFF, 0x87, 0x80, 0xF8, 0xFF, 0x8F, 0xC1, 0xF0, 0xFF,
+    0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0xE1, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xBF, 0xFF, 0xFF,
+    // 0x17D 'Ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x83,
+    0xFF, 0xF1, 0xFF, 0x03, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x80, 0xFC, 0x03,
+    0xFF, 0x83, 0xF0, 0x03, 0x8F, 0x8F, 0xE0, 0x23, 0x87, 0x8F, 0xC0, 0x63,
+    0xC3, 0x8F, 0x81, 0xE3, 0xE1, 0x8E, 0x03, 0xE3, 0xF1, 0x8C, 0x07, 0xE3,
+    0xF1, 0x88, 0x0F, 0xE3, 0xE3, 0x80, 0x1F, 0xC3, 0xC7, 0x80, 0x7F, 0x03,
+    0x8F, 0x80, 0xFE, 0x03, 0x9F, 0x81, 0xFE, 0x07, 0x9F, 0x83, 0xFF, 0x3F,
+    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x17E 'ž'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0xFC, 0x3F,
+    0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xC0, 0xF0, 0x7F, 0xDF, 0xC1, 0xE0, 0x7F,
+    0x87, 0xC3, 0xC0, 0x7F, 0x81, 0xC3, 0x84, 0x3F, 0xE0, 0xC3, 0x0C, 0x3F,
+    0xF0, 0xE0, 0x1E, 0x3F, 0xE1, 0xE0, 0x3E, 0x3F, 0xC3, 0xF0, 0x7C, 0x3F,
+    0x87, 0xC0, 0xF0, 0x3F, 0x8F, 0xC3, 0xF8, 0x7F, 0x9F, 0xC7, 0xFF, 0xFF,
+    0xFF, 0xEF, 0xFF, 0xFF,
+    // 0x3C0 'π'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xE3, 0xF8, 0x7F, 0xC7, 0xE0, 0x7F,
+    0xC7, 0x80, 0x7F, 0x86, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF,
+    0x80, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x87, 0xC0, 0x7F, 0x84, 0x00, 0x7F,
+    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xFC, 0x7F, 0x87, 0xF8, 0xFF,
+    0x87, 0xF8, 0xFF, 0x87, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x1E9E 'ẞ'
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07,
+    0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF7, 0xC1, 0xFF, 0x83, 0x87, 0xFF, 0x03,
+    0x8F, 0xCF, 0x03, 0x8F, 0x87, 0xE3, 0x8F, 0x07, 0xE3, 0x8E, 0x03, 0xE3,
+    0x88, 0x01, 0xE3, 0x80, 0x40, 0x03, 0x80, 0xE0, 0x07, 0xC1, 0xF0, 0x07,
+    0xE7, 0xF8, 0x1F, 0xFF, 0xFC, 0x7F,
+    // 0x2013 '–'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F,
+    // 0x2014 '—'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    // 0x2018 '‘'
+    0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x8F, 0xFF,
+    0xBF, 0xFF,
+    // 0x2019 '’'
+    0xFF, 0x3F, 0xFE, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x80, 0xFF, 0x83, 0xFF,
+    0xFF, 0xFF,
+    // 0x201A '‚'
+    0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x07, 0xFF,
+    0xDF, 0xFF,
+    // 0x201B '‛'
+    0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x1F,
+    0xFF, 0xBF,
+    // 0x201C '“'
+    0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x8F, 0xFF,
+    0xBF, 0xFF, 0xF8, 0x3F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x87, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x201D '”'
+    0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x07, 0xFF,
+    0xFF, 0x7F, 0xFE, 0x7F, 0xB0, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x03, 0xFF,
+    0x8F, 0xFF,
+    // 0x201E '„'
+    0xFF, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x07, 0xFF,
+    0xDF, 0x7F, 0xFC, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0x07, 0xFF,
+    0xDF, 0xFF,
+    // 0x201F '‟'
+    0xFF, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x1F,
+    0xFF, 0xBF, 0x81, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xFF, 0x1F,
+    0xFF, 0xBF,
+    // 0x2020 '†'
+    0xFE, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7E, 0x0F,
+    0xFC, 0x70, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x1F, 0xFF,
+    0x80, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2021 '‡'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFE, 0x7E, 0x3F, 0xFC, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x39, 0xFC, 0x7F, 0x00, 0xFC, 0x60, 0x00, 0xFC, 0x00, 0x01,
+    0x80, 0x00, 0x3F, 0x80, 0x07, 0x3F, 0x80, 0x7E, 0x3F, 0x9C, 0x7E, 0x3F,
+    0xFC, 0x7E, 0x3F, 0xFC, 0x7E, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2022 '•'
+    0xE3, 0xC1, 0x81, 0x81, 0x81, 0x81, 0xC7,
+    // 0x2026 '…'
+    0xEF, 0x87, 0x83, 0x87, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x87,
+    0x83, 0x87, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x87, 0x83, 0x87,
+    0x87, 0xFF,
+    // 0x2039 '‹'
+    0xF8, 0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x87, 0x0F,
+    0x8F, 0xDF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x203A '›'
+    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x8F, 0x9F, 0x0F, 0x86, 0x1F, 0x80, 0x3F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xFB, 0xFF,
+    // 0x2070 '⁰'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0xC3, 0x87, 0xF3,
+    0x1F, 0xE3, 0x1F, 0xE3, 0x1F, 0x07, 0x00, 0x07, 0x80, 0x1F, 0x80, 0x3F,
+    0xE1, 0xFF,
+    // 0x2074 '⁴'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF1, 0x9F,
+    0xE3, 0x9B, 0xC7, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x1F, 0x0F, 0x9F,
+    0xFF, 0xBF,
+    // 0x2075 '⁵'
+    0xFF, 0xF3, 0xFF, 0xF3, 0xF9, 0xF3, 0xC1, 0xF3, 0x81, 0xE3, 0x81, 0xE3,
+    0x98, 0x07, 0x98, 0x07, 0x9C, 0x0F, 0x9E, 0x3F, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2076 '⁶'
+    0xFF, 0x1F, 0xF8, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xC1, 0xF3, 0x81, 0xF3,
+    0x88, 0xE3, 0x98, 0x03, 0x1C, 0x07, 0x1C, 0x0F, 0x1F, 0x3F, 0xBF, 0xFF,
+    0xFF, 0xFF,
+    // 0x2077 '⁷'
+    0xFF, 0xFF, 0x87, 0xE3, 0x87, 0x83, 0x9F, 0x03, 0x9C, 0x0F, 0x98, 0x3F,
+    0x90, 0x7F, 0x81, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2078 '⁸'
+    0xFF, 0x87, 0xFF, 0x07, 0xC2, 0x03, 0x80, 0x23, 0x80, 0xF3, 0x18, 0xF3,
+    0x3C, 0x63, 0x18, 0x03, 0x00, 0x07, 0x83, 0x0F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x2079 '⁹'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xE1, 0xF3, 0xC0, 0x73, 0x80, 0x63, 0x8C, 0x63,
+    0x1E, 0x47, 0x1E, 0x07, 0x1E, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0xFF,
+    0xFF, 0xFF,
+    // 0x2080 '₀'
+    0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0xE3, 0x87, 0xF3,
+    0x9F, 0xF3, 0x1F, 0xE3, 0x1F, 0x07, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x3F,
+    0xE1, 0xFF,
+    // 0x2081 '₁'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xDF, 0xF3, 0xCF, 0xE3, 0x8E, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x00, 0xF3, 0x8F, 0xF3, 0xFF, 0xFF,
+    // 0x2082 '₂'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xE3, 0xC7, 0xC3, 0x87, 0x83, 0x8F, 0x03,
+    0x9E, 0x23, 0x1C, 0x23, 0x18, 0x63, 0x80, 0xE3, 0x81, 0xE3, 0xC3, 0xFF,
+    0xFF, 0xFF,
+    // 0x2083 '₃'
+    0xFF, 0xF3, 0xFF, 0xF3, 0xCF, 0xF3, 0x86, 0x73, 0x8C, 0x73, 0x9C, 0xE3,
+    0x18, 0x43, 0x18, 0x07, 0x80, 0x0F, 0x83, 0x1F, 0xC7, 0xFF,
+    // 0x2084 '₄'
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF0, 0x9F,
+    0xE3, 0x9B, 0xC7, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x1F, 0x8F, 0x9F,
+    0xFF, 0xBF,
+    // 0x2085 '₅'
+    0xFF, 0xF3, 0xFF, 0xF3, 0xF9, 0xF3, 0xC1, 0xF3, 0x81, 0xE3, 0x81, 0xE3,
+    0x98, 0x07, 0x98, 0x07, 0x9C, 0x0F, 0x9E, 0x3F, 0x9F, 0xFF, 0xBF, 0xFF,
+    // 0x2086 '₆'
+    0xFF, 0x1F, 0xF8, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0xF3, 0xC1, 0xF3,
+    0x88, 0xF3, 0x98, 0x03, 0x1C, 0x07, 0x1C, 0x0F, 0x1F, 0x3F, 0xBF, 0xFF,
+    0xFF, 0xFF,
+    // 0x2087 '₇'
+    0xFF, 0xFF, 0x87, 0xE3, 0x87, 0x83, 0x9F, 0x03, 0x9E, 0x0F, 0x98, 0x3F,
+    0x90, 0x7F, 0x81, 0xFF, 0x83, 0xFF, 0x87, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+    // 0x2088 '₈'
+    0xFF, 0x87, 0xFF, 0x03, 0xC2, 0x03, 0xC0, 0x23, 0x80, 0x73, 0x98, 0xF3,
+    0x1C, 0x63, 0x18, 0x03, 0x00, 0x07, 0x83, 0x0F, 0x87, 0xFF, 0xFF, 0xFF,
+    // 0x2089 '₉'
+    0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF3, 0xC0, 0x73, 0x80, 0x63, 0x8C, 0x63,
+    0x1E, 0x47, 0x1E, 0x07, 0x1E, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0x7F,
+    0xFF, 0xFF,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0x33, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+    0xE0, 0x02, 0x07, 0xC1, 0x33, 0x87, 0x83, 0x23, 0x87, 0x87, 0x23, 0xC7,
+    0x8F, 0x23, 0xC7, 0x0F, 0x23, 0xC7, 0x1F, 0x3F, 0xC7, 0x1F, 0x7F, 0xC7,
+    0x1F, 0xFF, 0x8F, 0x03, 0xFF, 0x8F, 0x03, 0xFF, 0xBF, 0x83, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0x8F, 0xFF, 0x0F, 0xBF, 0x3E, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xBF,
+    0x3F, 0xFF, 0x2F, 0xFF, 0x0F, 0xBF, 0x1F, 0xBF, 0xFC, 0x3F, 0x00, 0x3F,
+    0x03, 0xBF, 0x03, 0xFF, 0x00, 0xFF, 0xF8, 0xFF, 0xF3, 0xBF, 0xC7, 0x3F,
+    0x00, 0x3F, 0x00, 0x3F, 0x3F, 0xBF, 0x7F, 0xFF,
+    // 0x2153 '⅓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xEF, 0xF9, 0xFF, 0xC7, 0xF1, 0xFF,
+    0xC6, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFB, 0x80, 0x71, 0xF1,
+    0xC7, 0xFB, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0xF3,
+    0xC1, 0xFF, 0xF3, 0x83, 0xCF, 0xF3, 0x07, 0x86, 0x73, 0x9F, 0x8C, 0x73,
+    0xFF, 0x9C, 0xE3, 0xFF, 0x1C, 0x43, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0F,
+    0xFF, 0x83, 0x1F, 0xFF, 0xC7, 0xFF,
+    // 0x2154 '⅔'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xF7, 0xE1, 0xFF, 0xE3, 0xE1, 0xFF,
+    0xC3, 0xC1, 0xFF, 0xC7, 0x81, 0xFF, 0x8F, 0x11, 0xFF, 0x8E, 0x31, 0xFF,
+    0x8C, 0x31, 0xF9, 0x80, 0x71, 0xE0, 0xC0, 0xF3, 0xC1, 0xE1, 0xFF, 0x83,
+    0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xF0, 0x7F, 0xF3, 0xE0, 0xFF, 0xF3, 0x81, 0xCF, 0xF3, 0x07, 0x86, 0x73,
+    0x8F, 0x8C, 0x73, 0x9F, 0x9C, 0xE3, 0xFF, 0x1C, 0x43, 0xFF, 0x00, 0x07,
+    0xFF, 0x80, 0x0F, 0xFF, 0x83, 0x1F, 0xFF, 0xC7, 0xFF,
+    // 0x215B '⅛'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xEF, 0xF9, 0xFF, 0xC7, 0xF1, 0xFF,
+    0xC6, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x71, 0xF1,
+    0xC7, 0xFB, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0x87,
+    0xC0, 0xFF, 0x03, 0x83, 0xC2, 0x03, 0x07, 0xC0, 0x33, 0x8F, 0x80, 0x73,
+    0xBF, 0x98, 0xF3, 0xFF, 0x1C, 0x63, 0xFF, 0x18, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x83, 0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215C '⅜'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7, 0xF9, 0xFF, 0xC6, 0x79, 0xFF,
+    0xC6, 0x71, 0xFF, 0x8E, 0x71, 0xFF, 0x8C, 0x23, 0xF9, 0x88, 0x03, 0xF1,
+    0x80, 0x07, 0xC0, 0xC1, 0x0F, 0x83, 0xE3, 0xFF, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 0x87,
+    0xC1, 0xFF, 0x03, 0x03, 0xC2, 0x03, 0x0F, 0xC0, 0x33, 0x9F, 0x80, 0x73,
+    0xFF, 0x98, 0xF3, 0xFF, 0x1C, 0x63, 0xFF, 0x18, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x83, 0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215D '⅝'
+    0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFC, 0xF9, 0xFF, 0xE0, 0xF9, 0xFF,
+    0x80, 0xF1, 0xFF, 0x80, 0xF1, 0xFF, 0x8C, 0x03, 0xF9, 0x8C, 0x03, 0xE0,
+    0x8E, 0x07, 0xC1, 0x8F, 0x1F, 0x83, 0x8F, 0xFF, 0x07, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x87, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xFF, 0x87,
+    0x81, 0xFF, 0x03, 0x07, 0xC2, 0x03, 0x8F, 0xC0, 0x33, 0x9F, 0x80, 0x73,
+    0xFF, 0x98, 0xF3, 0xFF, 0x1C, 0x63, 0xFF, 0x18, 0x03, 0xFF, 0x80, 0x07,
+    0xFF, 0x83, 0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x215E '⅞'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xF8, 0xFF, 0xFF, 0xC1, 0xE0, 0xFF, 0xFF,
+    0xC7, 0xC0, 0xFF, 0xFF, 0xC7, 0x03, 0xFD, 0xFF, 0xC6, 0x0F, 0xF8, 0xFF,
+    0xC4, 0x1F, 0xE0, 0xFF, 0xC0, 0x7F, 0xC1, 0xFF, 0xC0, 0xFF, 0x83, 0xFF,
+    0xC3, 0xFE, 0x0F, 0xFF, 0xE7, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xC3, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x87, 0xE1, 0x01, 0xFF,
+    0xCF, 0xE0, 0x19, 0xFF, 0xFF, 0xC0, 0x39, 0xFF, 0xFF, 0xCC, 0x79, 0xFF,
+    0xFF, 0x8E, 0x31, 0xFF, 0xFF, 0x8C, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
+    0xFF, 0xC1, 0x87, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2190 '←'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xC0, 0x07,
+    0x84, 0x43, 0xCC, 0x67, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2191 '↑'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x80, 0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2192 '→'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xEC, 0x7F,
+    0xCC, 0x63, 0x84, 0x43, 0xC0, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2193 '↓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2194 '↔'
+    0xFF, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x8F,
+    0x88, 0x87, 0xD8, 0xCF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xD8, 0xCF, 0x88, 0x87, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0xFF, 0xFF, 0xFF,
+    // 0x2195 '↕'
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFC, 0xFF, 0xF0, 0xF8, 0x7F, 0xF0, 0xFC, 0x3F,
+    0xE3, 0xFE, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xC0, 0x00, 0x0F, 0xE3, 0xFE, 0x1F, 0xF0, 0xF8, 0x3F, 0xF0, 0xF8, 0x7F,
+    0xF9, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D0 '⇐'
+    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF,
+    0xF0, 0x87, 0xFF, 0xE0, 0xC3, 0xFF, 0xC0, 0xC1, 0xFF, 0x80, 0xC8, 0xFF,
+    0x88, 0xCC, 0xFF, 0xD8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D1 '⇑'
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D2 '⇒'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xC7, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xF8, 0xCF, 0xFF, 0xD8, 0xCF, 0xFF, 0x88, 0xCC, 0xFF,
+    0x80, 0xC8, 0xFF, 0xC0, 0xC1, 0xFF, 0xE0, 0xC3, 0xFF, 0xF0, 0x87, 0xFF,
+    0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D3 '⇓'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xF1, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x21D4 '⇔'
+    0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE1, 0x8F, 0xC1, 0x87,
+    0x81, 0x81, 0x91, 0x93, 0xD1, 0x9F, 0xF1, 0x9F, 0xF1, 0x9F, 0xD1, 0x9B,
+    0x81, 0x91, 0x81, 0x83, 0xC1, 0x87, 0xE1, 0x8F, 0xF0, 0x1F, 0xF8, 0x3F,
+    0xFC, 0x7F, 0xFF, 0xFF,
+    // 0x2202 '∂'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+    0xEF, 0xE0, 0x00, 0xFF, 0xC7, 0xC0, 0x00, 0xFF, 0x8F, 0x81, 0xF0, 0xFF,
+    0x8F, 0x87, 0xF8, 0xFF, 0x9F, 0x8F, 0xF8, 0xFF, 0x1F, 0x1F, 0xF0, 0xFF,
+    0x0F, 0x1F, 0xE0, 0xFF, 0x87, 0x8F, 0x81, 0xFF, 0x80, 0x00, 0x03, 0xFF,
+    0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFF,
+    // 0x2206 '∆'
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x03,
+    0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x63, 0xFC, 0x01, 0xE3, 0xE0, 0x0F, 0xE3,
+    0xC0, 0x7F, 0xE3, 0x81, 0xFF, 0xE3, 0x80, 0xFF, 0xE3, 0x80, 0x1F, 0xE3,
+    0x80, 0x03, 0xE3, 0xE0, 0x00, 0x63, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE3,
+    // 0x220F '∏'
+    0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F,
+    0x1F, 0xFF, 0xFE, 0x3F, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2211 '∑'
+    0xDF, 0xFF, 0xFC, 0x7F, 0x07, 0xFF, 0xF8, 0x3F, 0x03, 0xFF, 0xE0, 0x3F,
+    0x01, 0xFF, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0x3F, 0x00, 0x3E, 0x04, 0x3F,
+    0x10, 0x0C, 0x0C, 0x3F, 0x18, 0x00, 0x1C, 0x3F, 0x1E, 0x00, 0x7C, 0x3F,
+    0x1F, 0x00, 0xFC, 0x3F, 0x1F, 0xC1, 0xFC, 0x3F, 0x1F, 0xF3, 0xFC, 0x3F,
+    0x1F, 0xFF, 0xFC, 0x3F, 0x1F, 0xFF, 0xFC, 0x3F, 0x07, 0xFF, 0xF8, 0x3F,
+    0x01, 0xFF, 0xC0, 0x3F, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221A '√'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
+    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+    0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x221E '∞'
+    0xF0, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0x04, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x0E, 0x3F, 0x84, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF, 0xC0, 0x7F, 0x84, 0x3F,
+    0x8E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x7F,
+    0xFF, 0xFF,
+    // 0x222B '∫'
+    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1,
+    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE1,
+    0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 0x2260 '≠'
+    0xFF, 0xFF, 0xF1, 0x8F, 0xF1, 0x8F, 0xF1, 0x83, 0xF1, 0x81, 0xF1, 0x03,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xC1, 0x8F, 0x81, 0x8F, 0xC1, 0x8F,
+    0xF1, 0x8F, 0xF1, 0x8F,
+    // 0x2264 '≤'
+    0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x3F, 0xF8, 0x7E, 0x3F, 0xF0, 0x7E, 0x3F,
+    0xF0, 0x3E, 0x3F, 0xE0, 0x3E, 0x3F, 0xE2, 0x1E, 0x3F, 0xC3, 0x1E, 0x3F,
+    0xC7, 0x0E, 0x3F, 0x87, 0x8E, 0x3F, 0x8F, 0x86, 0x3F, 0x0F, 0xC6, 0x3F,
+    0x1F, 0xC2, 0x3F, 0xDF, 0xEE, 0x3F,
+    // 0x2265 '≥'
+    0xFF, 0xFF, 0xFF, 0xCF, 0xF7, 0x1F, 0x8F, 0xE3, 0x1F, 0x87, 0xE3, 0x1F,
+    0xC7, 0xC7, 0x1F, 0xC3, 0xC7, 0x1F, 0xE3, 0x8F, 0x1F, 0xE1, 0x8F, 0x1F,
+    0xF1, 0x1F, 0x1F, 0xF0, 0x1F, 0x1F, 0xF8, 0x3F, 0x1F, 0xF8, 0x3F, 0x1F,
+    0xFC, 0x7F, 0x1F, 0xFC, 0x7F, 0x1F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9,
+    0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BoldItalicBitmapsCol_lsb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0xD8, 0x40, 0x14, 0x00, 0x00,
+    0x40, 0x01, 0x92, 0x00, 0x10, 0x00, 0x80, 0x40, 0x00, 0x08, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x22 '"'
+    0x00, 0xDF, 0x28, 0x1F, 0x40, 0x5F, 0x80, 0xDF, 0x02, 0x1F, 0x60, 0x1F,
+    0x13, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x03, 0x1F, 0x20, 0x1F, 0x00, 0x1F,
+    // 0x23 '#'
+    0x00, 0x0C, 0x0F, 0x01, 0x02, 0x0F, 0x04, 0x02, 0x6F, 0x00, 0x00, 0x1F,
+    0x00, 0x20, 0x1F, 0x04, 0x00, 0x2F, 0x20, 0x01, 0x0F, 0x00, 0x12, 0x0F,
+    0x00, 0x02, 0x0F, 0x10, 0x03, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x80, 0x1F,
+    0x18, 0x00, 0x8F, 0x00, 0x02, 0x0F, 0x00, 0xC2, 0x0F, 0x0C, 0x02, 0x0F,
+    0x40, 0x0E, 0x0F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x0F,
+    // 0x24 '$'
+    0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x80, 0x03,
+    0x00, 0x60, 0x20, 0x13, 0x00, 0x00, 0x08, 0xC3, 0x00, 0x00, 0x08, 0x07,
+    0x00, 0x82, 0x60, 0x43, 0x01, 0x20, 0x00, 0x03, 0x0A, 0x00, 0x54, 0x03,
+    0x02, 0x00, 0x81, 0x03, 0x20, 0x28, 0x10, 0x03, 0x00, 0x80, 0x00, 0x03,
+    0x90, 0x00, 0x02, 0x03, 0x80, 0x60, 0x04, 0x03, 0x00, 0x00, 0x90, 0x03,
+    0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x25 '%'
+    0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x20, 0x04, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x08, 0x50, 0x04, 0x00, 0x50, 0x44, 0x21,
+    0x4B, 0x08, 0x84, 0x00, 0x00, 0x08, 0x20, 0x02, 0x20, 0x09, 0x08, 0x40,
+    0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x88, 0x00, 0x01, 0x00, 0xF0,
+    0x04, 0x26, 0x04, 0x08, 0x00, 0x00, 0x21, 0x00, 0x00, 0x02, 0x22, 0x92,
+    0x80, 0x24, 0x08, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80,
+    0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80,
+    // 0x26 '&'
+    0x00, 0x01, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x40, 0x01, 0xC8, 0x20, 0x00, 0x00, 0x12, 0x20, 0x04, 0x02,
+    0x40, 0x01, 0x02, 0x02, 0x00, 0x40, 0x10, 0x18, 0x00, 0x81, 0x04, 0x04,
+    0x20, 0x01, 0x00, 0x10, 0x00, 0x00, 0x81, 0x08, 0x04, 0x80, 0x49, 0x02,
+    0x00, 0x4C, 0x02, 0x00, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x01,
+    0x00, 0x80, 0x00, 0x00, 0x20, 0x09, 0x01, 0x00, 0x02, 0x02, 0x40, 0x04,
+    0x00, 0x80, 0x00,
+    // 0x27 '''
+    0x00, 0xDF, 0x28, 0x1F, 0x40, 0x5F, 0x80, 0xDF, 0x02, 0x1F, 0x60, 0x1F,
+    // 0x28 '('
+    0x00, 0x05, 0x94, 0x03, 0x00, 0x30, 0x01, 0x83, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x00, 0x13, 0x04, 0x04, 0x08, 0x03, 0x00, 0x20, 0x00, 0x87,
+    0x00, 0x80, 0x00, 0x47, 0x22, 0x00, 0x00, 0x13, 0x40, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03,
+    0x90, 0x00, 0x00, 0x03, 0x88, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x5E, 0x81, 0x03, 0x10, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x60, 0x03, 0x00, 0x36, 0x00, 0x03,
+    // 0x2A '*'
+    0x00, 0x0F, 0x10, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x10, 0x0F, 0x49, 0x0F,
+    0x00, 0x0F, 0x01, 0x0F, 0x51, 0x2F, 0x09, 0x0F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0x2B '+'
+    0x03, 0x03, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0xFC, 0x7B,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83,
+    0x00, 0x83, 0x00, 0x83,
+    // 0x2C ','
+    0x00, 0x3F, 0x00, 0xFF, 0x01, 0x7F, 0x22, 0x3F, 0x40, 0x3F, 0x00, 0xBF,
+    0x81, 0x3F, 0x04, 0x3F, 0x30, 0x3F,
+    // 0x2D '-'
+    0x3F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x2F,
+    // 0x2E '.'
+    0x1B, 0x07, 0x03, 0x87, 0x0B, 0x33,
+    // 0x2F '/'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0xC0,
+    0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x08, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x30 '0'
+    0x00, 0x18, 0x83, 0x00, 0x40, 0x23, 0x00, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x20, 0x60, 0x03, 0x01, 0x00, 0x47, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x90, 0x00, 0x83, 0x90, 0x00, 0x03,
+    0x80, 0x00, 0x13, 0x83, 0xA0, 0x03, 0x80, 0x00, 0x43, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x13,
+    0x00, 0x00, 0xA3, 0x00, 0x14, 0x03, 0x01, 0x40, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x53, 0x00, 0x08, 0x03, 0x02, 0x80, 0x03,
+    0x10, 0x00, 0x03,
+    // 0x32 '2'
+    0x00, 0x00, 0x2F, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x0A, 0x01, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x44, 0x00, 0x47, 0x08, 0x08, 0x07,
+    0x00, 0x11, 0x07, 0x80, 0x00, 0x07, 0x90, 0x02, 0x07, 0x80, 0x80, 0x07,
+    0x84, 0x08, 0x07, 0x00, 0x10, 0x07, 0x00, 0x20, 0x07, 0x00, 0x00, 0x57,
+    0x01, 0x80, 0x07, 0x0C, 0x00, 0x07,
+    // 0x33 '3'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x23, 0x08, 0x00, 0x27,
+    0x22, 0x00, 0x07, 0x02, 0x18, 0x03, 0x44, 0x40, 0x43, 0x08, 0x08, 0x03,
+    0x00, 0x08, 0x0B, 0x80, 0x88, 0x0B, 0x90, 0x09, 0x03, 0x81, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x20, 0x03, 0x00, 0x80, 0x03, 0x41, 0x09, 0x03,
+    0x16, 0x00, 0x03,
+    // 0x34 '4'
+    0x00, 0x02, 0x07, 0x00, 0x08, 0x07, 0x00, 0x10, 0x87, 0x00, 0x20, 0x87,
+    0x00, 0x40, 0x87, 0x00, 0x80, 0x87, 0x01, 0x10, 0x87, 0x02, 0x20, 0x87,
+    0x04, 0x40, 0x97, 0x08, 0x80, 0xC7, 0x11, 0x28, 0x07, 0x20, 0x80, 0x07,
+    0x00, 0x00, 0x17, 0x80, 0x00, 0x07, 0x80, 0x58, 0x87, 0x85, 0x00, 0x87,
+    0xA0, 0x00, 0x87, 0x00, 0x00, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x80, 0x07,
+    0x10, 0x00, 0x43, 0x40, 0x00, 0x03, 0x00, 0x20, 0x0B, 0x02, 0x00, 0x83,
+    0x08, 0x00, 0x03, 0x11, 0x0C, 0x13, 0x11, 0x00, 0x03, 0x10, 0x00, 0x23,
+    0x10, 0x80, 0x03, 0x10, 0x21, 0x03, 0x10, 0x0C, 0x03, 0x10, 0x00, 0x03,
+    0x40, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x36 '6'
+    0x00, 0x17, 0x43, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03,
+    0x00, 0x08, 0x03, 0x08, 0x00, 0x03, 0x10, 0x00, 0x07, 0x20, 0x20, 0x07,
+    0x00, 0x00, 0x03, 0x00, 0x10, 0x43, 0x00, 0x09, 0x03, 0x88, 0x80, 0x03,
+    0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x80, 0x31, 0x83, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0x37 '7'
+    0x0E, 0x00, 0x2B, 0x61, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x04, 0x03,
+    0x00, 0x10, 0x1B, 0x00, 0x00, 0x63, 0x00, 0x41, 0x83, 0x00, 0x02, 0x03,
+    0x02, 0x08, 0x03, 0x00, 0x10, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x09, 0x90, 0x03,
+    0x20, 0x63, 0x83, 0x00, 0x00, 0x07, 0x40, 0x08, 0x27, 0x01, 0x00, 0x27,
+    0x10, 0x08, 0x03, 0x90, 0x00, 0x43, 0x80, 0x02, 0x03, 0x91, 0x00, 0x03,
+    0x88, 0x20, 0x03, 0x80, 0x50, 0x03, 0x00, 0x0C, 0xC3, 0x40, 0x00, 0x03,
+    0x08, 0x00, 0x03,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x07,
+    0x04, 0x20, 0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x04, 0x0B,
+    0x83, 0xC0, 0x8B, 0x00, 0x25, 0x13, 0x80, 0x06, 0x13, 0x90, 0x20, 0x23,
+    0x80, 0x20, 0x03, 0x80, 0x20, 0x03, 0x80, 0x00, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x04, 0x80, 0x03,
+    // 0x3A ':'
+    0x00, 0x03, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x38, 0x10, 0xFF,
+    0x00, 0x01, 0x7F, 0x00, 0x06, 0x7F, 0x08, 0x00, 0x7F, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x3B ';'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x04, 0x47,
+    0x00, 0x08, 0x07, 0x00, 0x00, 0x17, 0x38, 0x10, 0x27, 0x00, 0x00, 0x87,
+    0x00, 0x06, 0x07, 0x08, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x3C '<'
+    0x02, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x00, 0x03, 0x00, 0x4B, 0x00, 0x03,
+    0x80, 0x23, 0x40, 0x13,
+    // 0x3D '='
+    0x63, 0xBF, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F,
+    0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F,
+    0x90, 0x3F, 0x82, 0x3F,
+    // 0x3E '>'
+    0x00, 0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x40, 0x03, 0x40, 0x03,
+    0x20, 0x83, 0x00, 0x03, 0x11, 0x03, 0x01, 0x03, 0x08, 0x03, 0x00, 0x03,
+    0x00, 0x83, 0x00, 0x03,
+    // 0x3F '?'
+    0x00, 0x06, 0x11, 0x48, 0x11, 0x03, 0x00, 0x20, 0x01, 0x08, 0x40, 0x01,
+    0x80, 0x84, 0x0D, 0x81, 0x15, 0x01, 0x0A, 0x20, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x80, 0x01, 0x32, 0x00, 0x01,
+    // 0x40 '@'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x0C, 0x1F, 0x00, 0x40, 0x02, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x02, 0x0B, 0xC0, 0x1F, 0x00, 0x20, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x02, 0x3F, 0x22, 0x0A, 0x61, 0x1F,
+    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0x3F, 0x48, 0x07, 0x00, 0x3F,
+    0x01, 0x00, 0x90, 0x3F, 0x90, 0x00, 0x00, 0x3F, 0x12, 0x41, 0x21, 0x1F,
+    0x92, 0x42, 0x41, 0x3F, 0x80, 0x48, 0x21, 0x1F, 0x81, 0x00, 0x10, 0x5F,
+    0x90, 0x02, 0x02, 0x5F, 0x90, 0x08, 0x00, 0x9F, 0x10, 0x00, 0x11, 0x1F,
+    0x80, 0x00, 0x90, 0x1F, 0x08, 0x01, 0x00, 0x1F, 0x04, 0x00, 0x20, 0x1F,
+    0x00, 0xE0, 0x40, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x08, 0x00, 0x00, 0x1F,
+    0x02, 0xC0, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x02, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x33,
+    0x00, 0x40, 0x8B, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x10, 0x80, 0x03, 0x43, 0x00, 0x0F, 0x02, 0x80, 0x03, 0x00, 0x08, 0x83,
+    0x80, 0x00, 0x03, 0x50, 0x00, 0x03, 0x02, 0x80, 0x03, 0x00, 0x14, 0x03,
+    0x00, 0x00, 0xA3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    // 0x42 'B'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x28, 0x00, 0xA1, 0x40, 0x14, 0x01, 0x42, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x41, 0x00, 0x04, 0x11, 0x80, 0x80, 0x11, 0x94, 0x00, 0x11,
+    0x80, 0x08, 0x01, 0x90, 0x04, 0x05, 0x08, 0x01, 0xC5, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x80, 0x61, 0x0A, 0x01, 0x01,
+    // 0x43 'C'
+    0x00, 0x00, 0x01, 0x00, 0x50, 0x81, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x05, 0x10, 0x00, 0x05, 0x00, 0xC1, 0x81, 0x21, 0x00, 0x01,
+    0x40, 0x00, 0x03, 0x40, 0x00, 0x23, 0x00, 0x00, 0x03, 0x08, 0x00, 0x01,
+    0x80, 0x00, 0x21, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x0F, 0x00, 0x81,
+    0x00, 0x00, 0x11, 0x41, 0x00, 0xA1, 0x40, 0x00, 0x01, 0x30, 0x00, 0x01,
+    // 0x44 'D'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x28, 0x00, 0xA1, 0x48, 0x14, 0x01, 0x02, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x05, 0x01, 0x80, 0xA0, 0x01, 0x8A, 0x00, 0x01,
+    0x80, 0x00, 0x21, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01, 0x00, 0x00, 0x41,
+    0x04, 0x00, 0x89, 0x00, 0x00, 0x01, 0x00, 0x60, 0x11, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x08, 0x01, 0x01, 0x04, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x28, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x0A, 0x27, 0x01, 0x00, 0x27, 0x14, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x10, 0x07, 0x02, 0x02, 0x37, 0x02, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0x30, 0x00, 0x07,
+    // 0x46 'F'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x28, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x02, 0x27, 0x00, 0xC8, 0x07, 0x14, 0x48, 0x07,
+    0x00, 0x48, 0x07, 0x00, 0x08, 0x07, 0x00, 0x08, 0x07, 0x00, 0x08, 0x07,
+    0x02, 0x70, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xA8, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0x00, 0x01, 0x00, 0x50, 0xC1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x08, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x81, 0x81, 0x21, 0x00, 0x41,
+    0x00, 0x00, 0x21, 0x40, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x04, 0x03,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x21, 0x80, 0x03, 0x45, 0x80, 0x00, 0x01,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x09, 0x40, 0x00, 0xA1, 0x44, 0x00, 0x01,
+    0x20, 0x04, 0x01,
+    // 0x48 'H'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x28, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x04, 0x07, 0x00, 0x80, 0x07, 0x14, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x87, 0xE0, 0x04, 0x07, 0x21, 0x00, 0x07, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x02, 0x87, 0x00, 0x50, 0x27, 0x0A, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x49 'I'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x08, 0x07, 0x22, 0x80, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x05, 0x07, 0x00, 0xA0, 0x2F, 0x0C, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x02, 0x1F, 0x00, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0xA0, 0x5F,
+    0x20, 0x14, 0x00, 0x9F, 0x21, 0x40, 0x01, 0x1F, 0x08, 0x00, 0x06, 0x1F,
+    0x00, 0x00, 0x20, 0x1F, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x50, 0x00, 0x1F,
+    0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x43, 0x20, 0x28, 0x03, 0x25, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x0A, 0x03, 0x01, 0x08, 0x13, 0x18, 0x00, 0x03,
+    0x20, 0x01, 0x03, 0x20, 0x00, 0x03, 0x44, 0x00, 0x23, 0x08, 0x88, 0x03,
+    0xD1, 0x02, 0x0B, 0x20, 0x00, 0x03, 0x00, 0x00, 0x87, 0x00, 0x00, 0x47,
+    0x08, 0x00, 0x03, 0x10, 0x00, 0x0B, 0x20, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x80, 0x00, 0x03,
+    // 0x4C 'L'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x28, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x06, 0x27, 0x00, 0xA0, 0x27, 0x14, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07,
+    // 0x4D 'M'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0xC7,
+    0x00, 0x02, 0x07, 0x00, 0x40, 0x07, 0xA2, 0x00, 0x67, 0x38, 0x01, 0x27,
+    0x00, 0x20, 0x0F, 0x00, 0x80, 0x07, 0x05, 0x00, 0x07, 0x00, 0x16, 0x07,
+    0x00, 0x00, 0x67, 0x80, 0x00, 0x07, 0x0C, 0x80, 0x27, 0x00, 0x10, 0xC7,
+    0x00, 0x01, 0x07, 0x01, 0x04, 0x07, 0x04, 0x00, 0x07, 0x18, 0x00, 0x27,
+    0x21, 0x00, 0x27, 0x06, 0xCC, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x03, 0xC7, 0xA7, 0x20, 0x00, 0x07, 0x20, 0x00, 0x17,
+    0x40, 0x00, 0x07,
+    // 0x4E 'N'
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x43,
+    0x20, 0x28, 0x03, 0x22, 0x00, 0x03, 0x10, 0x00, 0x43, 0x00, 0x04, 0x03,
+    0x00, 0xA0, 0x03, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x40, 0x00, 0x03,
+    0x18, 0x02, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x13, 0x00, 0x30, 0x07,
+    0x00, 0x0C, 0x07, 0x20, 0x28, 0x03, 0x25, 0x00, 0x03, 0x00, 0x00, 0x53,
+    0x00, 0x0A, 0x03, 0x00, 0xA0, 0x03, 0x14, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0x81, 0x01, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x10, 0x00, 0x05, 0x20, 0x20, 0x01, 0x01, 0x00, 0x01,
+    0x04, 0x00, 0x23, 0x40, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21,
+    0x80, 0x00, 0x05, 0x88, 0x00, 0x41, 0x88, 0x01, 0x01, 0x06, 0x06, 0x01,
+    0x40, 0x00, 0x11, 0x40, 0x00, 0x21, 0x20, 0x00, 0x41, 0x00, 0x00, 0x81,
+    0x0C, 0x02, 0x01, 0x00, 0xC0, 0x01,
+    // 0x50 'P'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x28, 0x00, 0xA3, 0x48, 0x14, 0x03, 0x02, 0x80, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x03, 0x13, 0x80, 0xA2, 0x03, 0x84, 0x12, 0x03,
+    0x90, 0x10, 0x03, 0x80, 0x00, 0x03, 0x80, 0x04, 0x03, 0x04, 0x84, 0x03,
+    0x40, 0x08, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x80, 0x07, 0x01, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+    0x20, 0x20, 0x80, 0x07, 0x01, 0x00, 0x21, 0x07, 0x04, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x26, 0x07,
+    0x80, 0x00, 0x20, 0x07, 0x88, 0x00, 0x01, 0x07, 0x88, 0x00, 0x89, 0x17,
+    0x06, 0x06, 0x08, 0x17, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x20, 0x87,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x87, 0x04, 0x06, 0x00, 0x07,
+    0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    // 0x52 'R'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0xA1, 0x00, 0x14, 0x01, 0x02, 0x80, 0x01, 0x48, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x01, 0x01, 0x80, 0xA0, 0x09, 0x84, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0x90, 0x20, 0x11, 0x08, 0x04, 0x01, 0x02, 0x82, 0x05,
+    0x40, 0x00, 0x81, 0x40, 0x10, 0x01, 0x00, 0x20, 0x03, 0x00, 0x80, 0x11,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x09,
+    // 0x53 'S'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x49, 0x00, 0x02, 0x01, 0x03, 0x00, 0x01,
+    0x18, 0x62, 0x01, 0x20, 0x10, 0x01, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03,
+    0x08, 0x04, 0x03, 0x00, 0x00, 0x01, 0x90, 0x01, 0x01, 0x90, 0x40, 0x01,
+    0x80, 0x00, 0x01, 0x01, 0x10, 0x09, 0x00, 0x08, 0x11, 0x00, 0x05, 0x41,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x54 'T'
+    0x52, 0x00, 0x07, 0x80, 0x00, 0x17, 0x02, 0x00, 0x27, 0x18, 0x00, 0x27,
+    0x00, 0x02, 0x87, 0x00, 0x10, 0x07, 0x05, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x0A, 0x07, 0x01, 0x40, 0x17, 0x18, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xA8, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x55 'U'
+    0x00, 0x02, 0x83, 0x80, 0x50, 0x23, 0x2A, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x17, 0x83, 0x01, 0x80, 0x47, 0x08, 0x00, 0x47,
+    0x20, 0x00, 0x47, 0x20, 0x00, 0x43, 0x80, 0x00, 0x43, 0x00, 0x00, 0x0B,
+    0x00, 0x01, 0x0B, 0x80, 0x08, 0x13, 0x01, 0x40, 0x03, 0x08, 0x00, 0x43,
+    0x00, 0x01, 0x83, 0x00, 0x08, 0x03, 0x01, 0x40, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x56 'V'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x0A, 0x00, 0x03,
+    0x00, 0x68, 0x03, 0x00, 0x01, 0x43, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x20, 0x98, 0x03, 0x20, 0x00, 0x03, 0x40, 0x04, 0x13, 0x00, 0x18, 0x23,
+    0x00, 0x60, 0x03, 0x00, 0x80, 0x03, 0x02, 0x08, 0x03, 0x08, 0x10, 0x03,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x57 'W'
+    0xE0, 0x00, 0x03, 0x20, 0x00, 0x03, 0x0C, 0xC0, 0x03, 0x00, 0x03, 0x23,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x20, 0x06, 0x0B,
+    0x20, 0x00, 0x23, 0x80, 0x20, 0x03, 0x00, 0x80, 0x03, 0x06, 0x00, 0x03,
+    0x18, 0x00, 0x03, 0x60, 0x20, 0x03, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x03, 0x00, 0x7A, 0x03, 0x00, 0x0C, 0x13, 0x00, 0x30, 0x43,
+    0x00, 0x81, 0x03, 0xC2, 0x06, 0x03, 0x00, 0x18, 0x03, 0x00, 0x20, 0x03,
+    0x00, 0x80, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
+    0x40, 0x00, 0x47, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x08, 0x00, 0x27,
+    0x02, 0x08, 0x67, 0x00, 0x90, 0x0F, 0x00, 0x02, 0x07, 0x00, 0x00, 0x0F,
+    0x2C, 0x00, 0x17, 0x83, 0x00, 0x27, 0x02, 0x00, 0x07, 0x00, 0x70, 0x07,
+    0xC0, 0x84, 0x07, 0x11, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x27, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x40, 0x00, 0x07,
+    // 0x59 'Y'
+    0x40, 0x00, 0x07, 0x80, 0x00, 0x07, 0x10, 0x00, 0x17, 0x06, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x00, 0x02, 0x87, 0x00, 0x00, 0x07, 0x24, 0x00, 0x07,
+    0x20, 0x80, 0x07, 0x80, 0x00, 0x47, 0x00, 0x82, 0x07, 0x02, 0x10, 0x17,
+    0xC4, 0x20, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x20, 0x00, 0x07,
+    0x40, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x83, 0x20, 0x00, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x08, 0x03, 0x00, 0x00, 0x43, 0x00, 0x20, 0xA3,
+    0x00, 0x00, 0x23, 0x01, 0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03,
+    0x08, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x13, 0x88, 0x02, 0x43, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x14, 0x0F,
+    0x00, 0x01, 0x80, 0x0F, 0x00, 0x28, 0x00, 0x0F, 0x02, 0x80, 0x02, 0x0F,
+    0x30, 0x00, 0x10, 0x0F, 0x00, 0x05, 0x00, 0x27, 0x00, 0x50, 0x00, 0x07,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    // 0x5C '\'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0xC0, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x01,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x28, 0x0F,
+    0x40, 0x02, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x57, 0x05, 0x00, 0x05, 0x07,
+    0x00, 0x00, 0x60, 0x07, 0x00, 0x0A, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x07,
+    0x0C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07,
+    // 0x5E '^'
+    0x00, 0x01, 0x00, 0x31, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x04, 0x01, 0x01, 0x81, 0x60, 0x31, 0x00, 0x01, 0x03, 0x01,
+    0x00, 0x01, 0x00, 0x19, 0x00, 0x07,
+    // 0x5F '_'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F,
+    // 0x60 '`'
+    0x28, 0x7F, 0x04, 0x7F, 0x40, 0x7F, 0x00, 0x7F, 0x11, 0x7F, 0x04, 0x7F,
+    0x00, 0x7F,
+    // 0x61 'a'
+    0x00, 0x00, 0x3F, 0x00, 0x40, 0x3F, 0x06, 0x00, 0xBF, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x7F, 0x20, 0x40, 0x3F, 0x40, 0x04, 0xBF, 0x40, 0x00, 0x3F,
+    0x08, 0x10, 0x3F, 0x00, 0x24, 0x3F, 0x49, 0x00, 0x3F, 0x44, 0x00, 0x3F,
+    0x20, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x41, 0x40, 0xBF, 0x04, 0x00, 0x3F,
+    0x20, 0x01, 0x3F, 0x00, 0x04, 0x3F,
+    // 0x62 'b'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x02, 0x80, 0x7F,
+    0x00, 0x50, 0x01, 0x7F, 0x42, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x10, 0x80, 0x7F, 0x00, 0xC0, 0x04, 0xFF, 0x02, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x04, 0x82, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x00, 0x12, 0x80, 0x7F,
+    // 0x63 'c'
+    0x00, 0x00, 0x3F, 0x01, 0x83, 0x3F, 0x04, 0x00, 0xBF, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x01, 0x40, 0x7F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x3F,
+    0x08, 0x00, 0xBF, 0x08, 0x00, 0xBF, 0x08, 0x01, 0x3F, 0x40, 0x02, 0x3F,
+    0x44, 0x04, 0x3F, 0x10, 0x00, 0x3F,
+    // 0x64 'd'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x0C, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x40, 0x80, 0x7F,
+    0x00, 0x80, 0x09, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x7F,
+    0x00, 0x00, 0x48, 0x7F, 0x30, 0x92, 0x00, 0x7F, 0x00, 0x88, 0x00, 0x7F,
+    0x42, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x81, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x01, 0x00, 0x02, 0x7F, 0x30, 0x00, 0x08, 0x7F,
+    // 0x65 'e'
+    0x00, 0x00, 0x3F, 0x01, 0x82, 0x3F, 0x04, 0x00, 0xBF, 0x08, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x00, 0x04, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x20, 0x3F,
+    0x11, 0x24, 0xBF, 0x02, 0x40, 0xBF, 0x00, 0x01, 0x3F, 0x40, 0x90, 0x3F,
+    0x41, 0x00, 0x3F, 0x04, 0x00, 0x3F,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x28, 0x04,
+    0x00, 0x85, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x40,
+    0x10, 0x00, 0x14, 0x00, 0x00, 0x02, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x05, 0x80, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x01, 0x7F, 0x03, 0x05, 0x40, 0x7F,
+    0x10, 0x08, 0x00, 0x7F, 0x20, 0x30, 0x84, 0x7F, 0x00, 0x00, 0x84, 0x7F,
+    0x02, 0x80, 0x04, 0x7F, 0x40, 0x44, 0x00, 0x7F, 0x00, 0x12, 0x01, 0x7F,
+    0x10, 0x12, 0x28, 0x7F, 0x04, 0x00, 0x00, 0x7F, 0x00, 0x21, 0x00, 0x7F,
+    0x40, 0x40, 0x84, 0x7F, 0x00, 0x80, 0x48, 0x7F, 0x18, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x68 'h'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x28, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x50, 0x00, 0x7F, 0x44, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x14, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x32, 0x00, 0x7F, 0x04, 0x24, 0x00, 0x7F,
+    0x20, 0x40, 0x08, 0x7F, 0x00, 0x80, 0xC0, 0x7F, 0x00, 0x8A, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xC8, 0x7F,
+    0x00, 0x38, 0x00, 0x7F, 0x00, 0x00, 0x12, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x69 'i'
+    0x00, 0x00, 0x2E, 0x01, 0x02, 0x00, 0x00, 0x18, 0x01, 0x01, 0x00, 0x01,
+    0x48, 0x00, 0x30, 0x00, 0x02, 0x00, 0x01, 0x28, 0x00, 0x80, 0x00, 0x18,
+    0xE0, 0x00, 0x00,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x03, 0x01, 0x00, 0x00, 0x30, 0x09,
+    0x01, 0x05, 0x00, 0x11, 0x01, 0x20, 0x00, 0x01, 0x18, 0x00, 0x03, 0x01,
+    0x80, 0x00, 0x28, 0x01, 0x80, 0x05, 0x00, 0x01, 0x09, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01,
+    // 0x6B 'k'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x28, 0x7F, 0x00, 0x03, 0x00, 0x7F,
+    0x00, 0x50, 0x00, 0x7F, 0x45, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x30, 0x7F,
+    0x00, 0x10, 0x30, 0x7F, 0x00, 0xE4, 0x08, 0x7F, 0x02, 0x01, 0x02, 0x7F,
+    0x20, 0x10, 0x01, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x1C, 0x08, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x04, 0x7F, 0x00, 0x84, 0x04, 0x7F,
+    0x00, 0x30, 0x00, 0x7F,
+    // 0x6C 'l'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x05, 0x00, 0x7F, 0x00, 0x50, 0x00, 0xFF,
+    0x42, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x05, 0x01, 0x7F,
+    0x00, 0x50, 0x12, 0x7F, 0x06, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x6D 'm'
+    0x00, 0x00, 0x3F, 0x20, 0x02, 0xBF, 0x40, 0x30, 0x3F, 0x05, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x00, 0x02, 0x3F, 0x00, 0x20, 0x3F, 0x78, 0x00, 0x3F,
+    0x12, 0x00, 0x3F, 0x24, 0x02, 0xBF, 0x08, 0x28, 0x3F, 0x02, 0x80, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x02, 0x3F, 0x40, 0x28, 0x3F, 0x18, 0x80, 0x3F,
+    0x10, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x28, 0xBF, 0x02, 0x80, 0x3F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x24, 0xBF, 0x42, 0x84, 0xBF,
+    0x00, 0x08, 0x3F, 0x00, 0x06, 0x3F,
+    // 0x6E 'n'
+    0x00, 0x00, 0x3F, 0x20, 0x02, 0xBF, 0x40, 0x30, 0x3F, 0x05, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x00, 0x01, 0xBF, 0x00, 0x08, 0x3F, 0x08, 0xC0, 0x3F,
+    0x01, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x15, 0xBF, 0x08, 0x40, 0x3F,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x3F, 0x00, 0x40, 0x3F,
+    0x04, 0x08, 0x3F, 0x00, 0x06, 0x3F,
+    // 0x6F 'o'
+    0x00, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x21, 0xCC, 0x7F, 0x44, 0x00, 0x7F, 0x08, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0xBF, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x10, 0x00, 0x3F, 0x05, 0x80, 0x3F,
+    // 0x70 'p'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x29,
+    0x00, 0x03, 0x01, 0x40, 0x50, 0x01, 0x4A, 0x00, 0x01, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x85, 0x00, 0x00, 0x01, 0x48, 0x82, 0x42, 0x00, 0x00, 0x40,
+    0x04, 0x00, 0x00, 0x40, 0x08, 0x80, 0x40, 0x60, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x40, 0x00, 0x0E, 0x00, 0x00,
+    // 0x71 'q'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x40, 0x20, 0x40, 0x03, 0x42, 0x04, 0x85, 0x40, 0x00, 0x01,
+    0x08, 0x10, 0x11, 0x00, 0x25, 0x01, 0x49, 0x84, 0x01, 0x04, 0x00, 0x01,
+    0x20, 0x00, 0x21, 0x00, 0x0A, 0x01, 0x41, 0x40, 0x02, 0x04, 0x00, 0x00,
+    0x20, 0x00, 0x00,
+    // 0x72 'r'
+    0x00, 0x00, 0x7F, 0x20, 0x01, 0x7F, 0x40, 0x08, 0x7F, 0x02, 0x80, 0x7F,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x7F, 0x0C, 0x60, 0x7F,
+    0x09, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x44, 0x00, 0x7F,
+    0x04, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x73 's'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x10, 0xBF, 0x07, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x20, 0x00, 0x7F, 0x40, 0x22, 0x7F, 0x0C, 0x02, 0x3F,
+    0x02, 0x04, 0x3F, 0x00, 0x00, 0x3F, 0x08, 0x81, 0x3F, 0x00, 0x02, 0x3F,
+    0x04, 0x24, 0x3F, 0x20, 0x00, 0x3F,
+    // 0x74 't'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x0A, 0x17, 0x09, 0x40, 0x07,
+    0x18, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x05, 0x07, 0x00, 0xA0, 0x87,
+    0x90, 0x00, 0x87, 0x00, 0x01, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0xC7,
+    0x0C, 0x00, 0x07,
+    // 0x75 'u'
+    0x00, 0x00, 0x7F, 0x00, 0x14, 0x7F, 0x81, 0x01, 0x7F, 0x94, 0x00, 0x7F,
+    0x00, 0x00, 0xFF, 0x00, 0x20, 0x7F, 0x01, 0x81, 0x7F, 0x70, 0x08, 0x7F,
+    0x00, 0x02, 0x7F, 0x00, 0x24, 0x7F, 0x00, 0x08, 0x7F, 0x0A, 0x00, 0x7F,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x58, 0x7F, 0x0A, 0x09, 0x7F,
+    0xA0, 0x12, 0x7F, 0x00, 0x10, 0x7F,
+    // 0x76 'v'
+    0x20, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x42, 0x00, 0x3F,
+    0x00, 0x67, 0xBF, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x02, 0x00, 0xBF,
+    0x00, 0x08, 0x3F, 0x00, 0x02, 0x3F, 0x60, 0x04, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x42, 0x00, 0x3F, 0x18, 0x00, 0x3F,
+    // 0x77 'w'
+    0x20, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x42, 0x00, 0x3F,
+    0x00, 0xDC, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0B, 0x00, 0xBF,
+    0x00, 0x09, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0x84, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0xBF, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x3F, 0x01, 0x90, 0x3F,
+    0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x4A, 0x04, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x40, 0x3F, 0x02, 0x00, 0x3F, 0x18, 0x00, 0x3F,
+    // 0x78 'x'
+    0x00, 0x01, 0x3F, 0x00, 0x04, 0x3F, 0x08, 0x04, 0x7F, 0x00, 0x04, 0x7F,
+    0x48, 0x04, 0x3F, 0x40, 0x08, 0xBF, 0x00, 0x01, 0x3F, 0x00, 0x84, 0x3F,
+    0x40, 0x00, 0x3F, 0x08, 0x06, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x00, 0x3F,
+    0x00, 0x30, 0x7F, 0x04, 0x00, 0x3F, 0x48, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x08, 0x04, 0x3F, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    // 0x79 'y'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x09, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x42, 0x00, 0x02, 0x7F,
+    0x00, 0x58, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x00, 0x0C, 0x40, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x60, 0x42, 0x00, 0x7F, 0x40, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x42, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x7F,
+    // 0x7A 'z'
+    0x00, 0x01, 0x3F, 0x00, 0x00, 0xBF, 0x0A, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x01, 0x3F, 0x00, 0x40, 0x3F, 0x08, 0x88, 0xBF, 0x49, 0x10, 0xBF,
+    0x02, 0x00, 0x3F, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x7F, 0x20, 0x08, 0x3F,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x06, 0x3F, 0x10, 0x00, 0x3F,
+    // 0x7B '{'
+    0x00, 0x00, 0x01, 0x23, 0x00, 0x04, 0x0C, 0x03, 0x00, 0x00, 0xE0, 0x0B,
+    0x00, 0x10, 0x00, 0x03, 0x03, 0x80, 0x02, 0x03, 0x20, 0x06, 0x30, 0x03,
+    0x40, 0x08, 0x00, 0x0B, 0x01, 0x90, 0x00, 0x33, 0x08, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x03,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x10, 0x1F,
+    0x00, 0x05, 0x00, 0x1F, 0x00, 0xA0, 0x00, 0x9F, 0x14, 0x00, 0x14, 0x1F,
+    0x00, 0x02, 0x80, 0x1F, 0x00, 0x28, 0x00, 0x1F, 0x05, 0x00, 0x00, 0x1F,
+    0xA0, 0x00, 0x00, 0x1F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x06, 0x83,
+    0x40, 0x00, 0x40, 0x03, 0x80, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0xC3,
+    0x1A, 0x00, 0x18, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x80, 0x03,
+    0x44, 0x02, 0x00, 0x03,
+    // 0x7E '~'
+    0x3B, 0x03, 0x83, 0x93, 0x93, 0x83, 0x8B, 0x43, 0x07, 0x07, 0x07, 0x43,
+    0x83, 0x8B, 0x43,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x41, 0x00, 0x03, 0x01,
+    0x00, 0x28, 0x01, 0x00, 0x80, 0x05, 0x02, 0x00, 0x21, 0x02, 0x1B, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x10, 0x04, 0x03,
+    0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x8C, 0x01, 0x43,
+    0x01, 0x00, 0x10, 0x03, 0x01, 0x01, 0x00, 0x2B, 0x00, 0x28, 0x01, 0x03,
+    0x00, 0x00, 0xA2, 0x03, 0x50, 0x0C, 0x10, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x0A, 0x00, 0x00, 0x03, 0x00, 0x00, 0x48, 0x03, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0xE0, 0x00, 0x03,
+    // 0xA3 '£'
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x28, 0x47,
+    0x00, 0x49, 0x83, 0x00, 0x08, 0x0B, 0x00, 0x40, 0x03, 0x06, 0x00, 0x4B,
+    0x08, 0x00, 0x03, 0x20, 0x00, 0x0B, 0x41, 0x48, 0x03, 0x00, 0x08, 0x03,
+    0x90, 0x48, 0x03, 0x90, 0x48, 0x47, 0x80, 0x48, 0x43, 0x80, 0x40, 0x03,
+    0x82, 0x00, 0x43, 0x82, 0x00, 0x13, 0x40, 0x00, 0x03, 0x20, 0x00, 0x03,
+    // 0xA4 '¤'
+    0x00, 0x05, 0x00, 0x01, 0x10, 0x11, 0x02, 0xE5, 0x04, 0x09, 0x00, 0x05,
+    0x01, 0xC1, 0x04, 0x05, 0x20, 0x05, 0x08, 0x05, 0x08, 0x25, 0x04, 0x41,
+    0x20, 0x01, 0x00, 0x05, 0x00, 0x41, 0x4F, 0x09, 0x00, 0x01, 0x50, 0x01,
+    0x00, 0x01,
+    // 0xA5 '¥'
+    0x00, 0x00, 0x07, 0x00, 0x0A, 0x17, 0x00, 0x02, 0x07, 0x03, 0x0A, 0x27,
+    0x00, 0x0A, 0x27, 0x00, 0x11, 0x07, 0x10, 0x00, 0x07, 0x06, 0x00, 0x07,
+    0x00, 0x80, 0x07, 0x80, 0x01, 0x07, 0x00, 0x02, 0x27, 0x40, 0x02, 0x17,
+    0x20, 0x02, 0x07, 0x00, 0x82, 0x07, 0x02, 0x00, 0x07, 0x00, 0x40, 0x07,
+    0x08, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07, 0x60, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xA7 '§'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x11, 0x40, 0x10, 0x20, 0x00, 0x01, 0x40, 0x81, 0x00, 0x18, 0x40, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x10, 0x02, 0x10, 0x89, 0x00, 0x08, 0x00, 0x44,
+    0x84, 0x20, 0x08, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x01, 0x82, 0x01, 0x04, 0x10, 0x01, 0x01, 0x80, 0x21,
+    0x00, 0x00, 0x41, 0x20, 0x00, 0x09, 0x00, 0x00, 0x15, 0x40, 0x00, 0x85,
+    0x42, 0x00, 0x09, 0x20, 0x44, 0x43, 0x24, 0x00, 0x49, 0x00, 0x00, 0x41,
+    0x01, 0x01, 0x49, 0x24, 0xC1, 0x0B, 0x00, 0x40, 0x41, 0x10, 0x81, 0x01,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x49, 0x03, 0x00, 0x01,
+    0x04, 0x1A, 0x21, 0x03, 0x00, 0x01, 0x00, 0x44, 0x01,
+    // 0xAA 'ª'
+    0x00, 0x00, 0x02, 0x40, 0x10, 0x00, 0x00, 0x08, 0x48, 0x08, 0x00, 0x88,
+    0x81, 0x48, 0x00, 0x08, 0x00, 0x08, 0x02, 0x02, 0x18, 0x84, 0x01, 0x00,
+    0x00, 0x00,
+    // 0xAB '«'
+    0x03, 0x0F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F,
+    0x80, 0x3F, 0x03, 0x0F, 0x60, 0x8F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x1F,
+    0x40, 0x0F, 0x00, 0x5F, 0x90, 0x2F, 0x20, 0x0F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x12, 0x20, 0x7F, 0x28, 0x08, 0x7F,
+    0x10, 0x01, 0x7F, 0x00, 0x02, 0x7F, 0x08, 0x02, 0x7F, 0x28, 0x00, 0xFF,
+    0x08, 0x40, 0x7F, 0x2A, 0x10, 0x7F, 0x08, 0x88, 0xFF, 0x62, 0x28, 0x7F,
+    0x50, 0x00, 0x7F, 0x28, 0x00, 0x7F, 0x16, 0x20, 0x7F, 0x00, 0x00, 0x7F,
+    0x02, 0x20, 0x7F,
+    // 0xB0 '°'
+    0x0A, 0x1F, 0x00, 0x9F, 0x40, 0x5F, 0x8C, 0x3F, 0x00, 0x1F, 0x80, 0x3F,
+    0x80, 0x3F, 0x91, 0x1F, 0x84, 0x1F, 0x40, 0x1F, 0x00, 0x9F, 0x0C, 0x1F,
+    // 0xB1 '±'
+    0x03, 0x00, 0xDF, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    0x00, 0x81, 0x1F, 0x7C, 0x7D, 0x1F, 0x00, 0x05, 0x1F, 0x00, 0x05, 0x1F,
+    0x00, 0x05, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    0x00, 0x81, 0x1F, 0x00, 0x81, 0x1F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x13, 0x10, 0x03, 0x20, 0x43, 0x48, 0x03, 0x10, 0x13,
+    0x01, 0x13, 0xA2, 0x13, 0x8C, 0x93, 0x00, 0x17, 0x00, 0x13, 0x44, 0x13,
+    0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x09, 0x00, 0x01, 0x10, 0x03, 0x02, 0x01, 0x12, 0x81, 0x00, 0x01,
+    0xA0, 0x01, 0x90, 0x01, 0x02, 0x09, 0x05, 0x21, 0x30, 0x01,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0A, 0x7F, 0x00, 0x00, 0xA0, 0x7F,
+    0x00, 0x12, 0x00, 0x7F, 0x04, 0x80, 0x01, 0x7F, 0x20, 0x00, 0xF4, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x40, 0x38, 0x00, 0x7F, 0x05, 0x00, 0x40, 0x7F,
+    0x40, 0x04, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x19, 0x00, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x14, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x80, 0x7F,
+    0x40, 0x00, 0x40, 0x7F, 0x00, 0xB0, 0x40, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x40, 0x04, 0x80, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x03, 0xBF, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x7F,
+    0x02, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x04, 0x02, 0x3F,
+    0x20, 0x00, 0x08, 0xBF, 0x40, 0x00, 0xA1, 0x3F, 0x00, 0x04, 0x01, 0x3F,
+    0x00, 0x00, 0x24, 0x3F, 0x00, 0x03, 0x08, 0x3F, 0x80, 0x50, 0xA2, 0x3F,
+    0x8A, 0x14, 0x04, 0x3F, 0xA2, 0x80, 0x30, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x00, 0xA0, 0x00, 0x3F, 0x14, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x7F, 0x8F, 0x8F, 0x07, 0x87, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x0B, 0x20, 0x13, 0x00, 0x33, 0x43, 0x03, 0x00, 0x03,
+    0x80, 0x03, 0x80, 0x93, 0xA8, 0x0B, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x40, 0x20, 0x28, 0x02, 0x88, 0x40, 0x08,
+    0x10, 0x08, 0xA1, 0x28, 0x9A, 0x22, 0x00, 0x0A, 0x00, 0x80, 0x0A, 0x00,
+    // 0xBB '»'
+    0x00, 0x0F, 0x00, 0x3F, 0x00, 0x4F, 0x20, 0x9F, 0x81, 0x0F, 0x00, 0x2F,
+    0x00, 0x0F, 0x00, 0x8F, 0x01, 0x2F, 0x02, 0x5F, 0x20, 0x8F, 0x91, 0x0F,
+    0x02, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x8F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x1A, 0x00,
+    0x02, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x41, 0x42, 0x02,
+    0x54, 0x06, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x84,
+    0x00, 0x00, 0x10, 0x00, 0x04, 0x20, 0x00, 0x00, 0x80, 0x00, 0x11, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x02, 0x10, 0x60, 0x04, 0x40, 0x00,
+    0x10, 0x00, 0x10, 0x21, 0x00, 0x10, 0x84, 0x00, 0x10, 0x80, 0x00, 0x10,
+    0x10, 0x02, 0x0C, 0x40, 0x05, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x80, 0x14,
+    0x00, 0x02, 0x90, 0x00, 0x28, 0x10, 0x00, 0x00, 0x40,
+    // 0xBD '½'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x1A, 0x00,
+    0x02, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x06, 0x41, 0x42, 0x11,
+    0x54, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x01, 0x08, 0x00, 0x00, 0x10,
+    0x00, 0x04, 0x40, 0x00, 0x00, 0x80, 0x00, 0x22, 0x00, 0x00, 0x44, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0x20, 0x00, 0x08, 0x40, 0x00, 0x10, 0x00, 0x04,
+    0x42, 0x08, 0x20, 0x00, 0x24, 0x00, 0x08, 0x08, 0x00, 0x60, 0x10, 0x80,
+    0x00, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    // 0xBE '¾'
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x00,
+    0x01, 0x40, 0x00, 0x00, 0x02, 0x00, 0x50, 0x12, 0x00, 0x48, 0x00, 0x06,
+    0x01, 0x00, 0x11, 0x02, 0x10, 0x00, 0x18, 0x00, 0x42, 0x00, 0x01, 0x08,
+    0x00, 0x00, 0x10, 0x00, 0x04, 0x40, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00,
+    0x00, 0x44, 0x00, 0x01, 0x00, 0x00, 0x02, 0x20, 0x60, 0x08, 0x40, 0x00,
+    0x10, 0x00, 0x10, 0x42, 0x00, 0x10, 0x00, 0x00, 0x10, 0x08, 0x00, 0x10,
+    0x60, 0x02, 0x0C, 0x00, 0x05, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x80, 0x14,
+    0x00, 0x02, 0x90, 0x00, 0x28, 0x10, 0x00, 0x00, 0x40,
+    // 0xBF '¿'
+    0x00, 0x00, 0x51, 0x00, 0x00, 0x09, 0x00, 0x04, 0x01, 0x00, 0x08, 0xC1,
+    0x00, 0x00, 0x23, 0x70, 0x20, 0x03, 0x02, 0x40, 0x21, 0x02, 0x00, 0x45,
+    0x0A, 0x00, 0x01, 0xF1, 0x40, 0x11,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x40, 0x8B,
+    0x00, 0x00, 0x80, 0x03, 0x10, 0x00, 0x00, 0x03, 0x08, 0x08, 0x00, 0x03,
+    0x04, 0x10, 0x80, 0x03, 0x04, 0x43, 0x00, 0x0F, 0x20, 0x02, 0x80, 0x03,
+    0x00, 0x00, 0x08, 0x83, 0x08, 0x80, 0x00, 0x03, 0x06, 0x50, 0x00, 0x03,
+    0x00, 0x02, 0x80, 0x03, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x40, 0x8B,
+    0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x10, 0x80, 0x03, 0x00, 0x43, 0x00, 0x0F, 0x10, 0x02, 0x80, 0x03,
+    0x02, 0x00, 0x08, 0x83, 0x00, 0x80, 0x00, 0x03, 0x04, 0x50, 0x00, 0x03,
+    0x40, 0x02, 0x80, 0x03, 0x20, 0x00, 0x14, 0x03, 0x00, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x81, 0x17,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07,
+    0x24, 0x21, 0x00, 0x07, 0x40, 0x86, 0x00, 0x1F, 0x88, 0x05, 0x00, 0x07,
+    0x90, 0x00, 0x11, 0x07, 0x11, 0x00, 0x00, 0x07, 0x08, 0xA0, 0x00, 0x07,
+    0x04, 0x05, 0x00, 0x07, 0x24, 0x00, 0x28, 0x07, 0x08, 0x00, 0x01, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x81, 0x17,
+    0x00, 0x01, 0x00, 0x07, 0x30, 0x00, 0x00, 0x07, 0x44, 0x10, 0x00, 0x07,
+    0x00, 0x21, 0x00, 0x07, 0x80, 0x86, 0x00, 0x1F, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x11, 0x07, 0x25, 0x00, 0x00, 0x07, 0x24, 0xA0, 0x00, 0x07,
+    0x40, 0x05, 0x00, 0x07, 0x08, 0x00, 0x28, 0x07, 0x20, 0x00, 0x01, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x01, 0x02, 0x2F,
+    0x00, 0x02, 0x00, 0x0F, 0x70, 0x00, 0x00, 0x0F, 0x80, 0x20, 0x00, 0x0F,
+    0x00, 0x42, 0x00, 0x0F, 0x01, 0x0C, 0x00, 0x3F, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0x22, 0x0F, 0x52, 0x00, 0x00, 0x0F, 0x81, 0x40, 0x00, 0x0F,
+    0x00, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0x50, 0x0F, 0x00, 0x00, 0x02, 0x8F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x40, 0x8B,
+    0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x14, 0x08, 0x00, 0x03,
+    0x02, 0x10, 0x80, 0x03, 0x08, 0x43, 0x00, 0x0F, 0x81, 0x02, 0x80, 0x03,
+    0x05, 0x00, 0x08, 0x83, 0x84, 0x80, 0x00, 0x03, 0x00, 0x50, 0x00, 0x03,
+    0x40, 0x02, 0x80, 0x03, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x4F, 0x00, 0x01, 0x07, 0x00, 0x40, 0x07, 0x00, 0x80, 0x07,
+    0x00, 0x10, 0x07, 0x02, 0x00, 0x27, 0x00, 0x40, 0x07, 0x31, 0x01, 0x47,
+    0x00, 0x08, 0x07, 0x05, 0x00, 0x07, 0x04, 0x00, 0x07, 0x00, 0x01, 0x47,
+    0x00, 0x08, 0x27, 0x02, 0x80, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x12, 0x07, 0x0C, 0x20, 0x1F,
+    0x00, 0x01, 0x47, 0x00, 0x00, 0x07, 0xB8, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x80, 0x03, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x04, 0x03, 0x10, 0x00, 0x04, 0x07,
+    0x00, 0xC1, 0x80, 0x0B, 0x21, 0x00, 0x01, 0x13, 0x40, 0x00, 0x02, 0x63,
+    0x40, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x08, 0x00, 0x00, 0x43,
+    0x80, 0x00, 0x20, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03,
+    0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x10, 0x03, 0x41, 0x00, 0xA0, 0x03,
+    0x40, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x14, 0x03,
+    0x00, 0x12, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x05, 0x13, 0x40, 0x00, 0x80, 0x13, 0x04, 0x0A, 0x00, 0x03,
+    0x44, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x08, 0x03, 0x00, 0x01, 0x01, 0x1B,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x14, 0x03,
+    0x00, 0x12, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x05, 0x13, 0x00, 0x00, 0x80, 0x13, 0x06, 0x0A, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x00, 0x83, 0x04, 0x00, 0x08, 0x03, 0x44, 0x01, 0x01, 0x1B,
+    0x48, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x47, 0x00, 0x20, 0x28, 0x07,
+    0x00, 0x25, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x04, 0x00, 0x0A, 0x27, 0x10, 0x01, 0x00, 0x27, 0x00, 0x14, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x80, 0x00, 0x10, 0x07, 0x40, 0x02, 0x02, 0x37,
+    0x00, 0x02, 0x00, 0x07, 0x04, 0x04, 0x00, 0x07, 0x00, 0x30, 0x00, 0x07,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x8F, 0x00, 0x40, 0x50, 0x0F,
+    0x00, 0x4A, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x14, 0x4F, 0x00, 0x02, 0x00, 0x4F, 0x00, 0x28, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x70, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x04, 0x04, 0x6F,
+    0x00, 0x04, 0x00, 0x0F, 0x70, 0x08, 0x00, 0x0F, 0x00, 0x60, 0x00, 0x0F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x04, 0x03,
+    0x20, 0x11, 0x40, 0x03, 0x00, 0x08, 0x00, 0x03, 0x44, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x02, 0x83, 0x10, 0x00, 0x50, 0x17, 0x02, 0x06, 0x00, 0x03,
+    0x0A, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x04, 0x03,
+    0x00, 0x11, 0x40, 0x03, 0x04, 0x08, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x02, 0x83, 0x10, 0x00, 0x50, 0x17, 0x20, 0x06, 0x00, 0x03,
+    0x04, 0x10, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x48, 0x60, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x03,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x47, 0x0C, 0x20, 0x08, 0x07,
+    0x00, 0x22, 0x80, 0x07, 0x00, 0x10, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x05, 0x07, 0x90, 0x00, 0xA0, 0x2F, 0x10, 0x0C, 0x00, 0x07,
+    0x88, 0x20, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x20, 0xC0, 0x00, 0x07,
+    0x1C, 0x00, 0x00, 0x07,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x8F, 0x30, 0x40, 0x10, 0x0F,
+    0x08, 0x45, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x0A, 0x0F, 0x00, 0x01, 0x40, 0x5F, 0x00, 0x18, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x81, 0x80, 0x00, 0x0F,
+    0x10, 0x00, 0x00, 0x0F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x20, 0x11, 0x00, 0x08, 0x01,
+    0x28, 0x08, 0xA1, 0x48, 0x04, 0x01, 0x02, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x05, 0x01, 0x80, 0xA8, 0x01, 0x8A, 0x08, 0x01,
+    0x80, 0x08, 0x21, 0x80, 0x08, 0x05, 0x80, 0x30, 0x01, 0x00, 0x00, 0x41,
+    0x04, 0x00, 0x89, 0x00, 0x00, 0x01, 0x00, 0x60, 0x11, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x08, 0x01, 0x01, 0x04, 0x08, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x43, 0x00, 0x20, 0x28, 0x03, 0x00, 0x22, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x43, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0xA0, 0x03,
+    0x00, 0x01, 0x80, 0x03, 0x30, 0x80, 0x00, 0x03, 0x04, 0x40, 0x00, 0x03,
+    0x08, 0x18, 0x02, 0x03, 0x80, 0x00, 0x00, 0xC3, 0x08, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x30, 0x07, 0x04, 0x00, 0x0C, 0x07, 0x24, 0x20, 0x28, 0x03,
+    0x40, 0x25, 0x00, 0x03, 0x00, 0x00, 0x00, 0x53, 0x20, 0x00, 0x0A, 0x03,
+    0x00, 0x00, 0xA0, 0x03, 0x00, 0x14, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x81, 0x00, 0x01, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x20, 0x20, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x23,
+    0x48, 0x40, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x21,
+    0x20, 0x80, 0x00, 0x05, 0x00, 0x88, 0x00, 0x41, 0x08, 0x88, 0x01, 0x01,
+    0x04, 0x06, 0x06, 0x01, 0x00, 0x40, 0x00, 0x11, 0x00, 0x40, 0x00, 0x21,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x00, 0x00, 0x81, 0x00, 0x0C, 0x02, 0x01,
+    0x00, 0x00, 0xC0, 0x01,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x81, 0x00, 0x01, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x20, 0x20, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x23,
+    0x00, 0x40, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21,
+    0x02, 0x80, 0x00, 0x05, 0x12, 0x88, 0x00, 0x41, 0x20, 0x88, 0x01, 0x01,
+    0x04, 0x06, 0x06, 0x01, 0x44, 0x40, 0x00, 0x11, 0x00, 0x40, 0x00, 0x21,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x00, 0x00, 0x81, 0x00, 0x0C, 0x02, 0x01,
+    0x00, 0x00, 0xC0, 0x01,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x02, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x0B,
+    0x00, 0x40, 0x40, 0x03, 0x00, 0x02, 0x00, 0x03, 0x04, 0x08, 0x00, 0x47,
+    0x10, 0x80, 0x00, 0x07, 0x20, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x43,
+    0x81, 0x00, 0x00, 0x0B, 0x81, 0x10, 0x00, 0x83, 0x01, 0x10, 0x02, 0x03,
+    0x80, 0x0C, 0x0C, 0x03, 0x04, 0x80, 0x00, 0x23, 0x00, 0x80, 0x00, 0x43,
+    0x04, 0x40, 0x00, 0x83, 0x00, 0x00, 0x01, 0x03, 0x00, 0x18, 0x04, 0x03,
+    0x00, 0x01, 0x80, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x02, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x0B,
+    0x00, 0x40, 0x40, 0x03, 0x00, 0x02, 0x00, 0x03, 0x08, 0x08, 0x00, 0x47,
+    0x40, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x43,
+    0x81, 0x00, 0x00, 0x0B, 0x41, 0x10, 0x00, 0x83, 0x25, 0x10, 0x02, 0x03,
+    0x04, 0x0C, 0x0C, 0x03, 0x00, 0x80, 0x00, 0x23, 0x08, 0x80, 0x00, 0x43,
+    0x40, 0x40, 0x00, 0x83, 0x00, 0x00, 0x01, 0x03, 0x00, 0x18, 0x04, 0x03,
+    0x00, 0x01, 0x80, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x82, 0x07, 0x00, 0x04, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x40, 0x00, 0x17,
+    0x00, 0x80, 0x80, 0x07, 0x00, 0x04, 0x00, 0x07, 0x00, 0x10, 0x00, 0x8F,
+    0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x87,
+    0x72, 0x00, 0x00, 0x17, 0x02, 0x20, 0x01, 0x07, 0x72, 0x20, 0x04, 0x07,
+    0x00, 0x18, 0x18, 0x07, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x87,
+    0x40, 0x80, 0x01, 0x07, 0x00, 0x00, 0x02, 0x07, 0x00, 0x30, 0x08, 0x07,
+    0x00, 0x03, 0x00, 0x07,
+    // 0xD7 '×'
+    0x10, 0x13, 0x08, 0x0B, 0x84, 0x03, 0x42, 0x03, 0x20, 0x03, 0x10, 0x03,
+    0x08, 0x43, 0x10, 0x23, 0x20, 0x13, 0x45, 0x0B, 0x08, 0x83, 0x50, 0x43,
+    0x20, 0x03,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x20, 0x91, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x10, 0x0E, 0x05, 0x20, 0xC0, 0x41,
+    0x02, 0x00, 0xA1, 0x04, 0x00, 0x23, 0x40, 0x00, 0x03, 0x00, 0x20, 0x01,
+    0x00, 0x40, 0x21, 0x80, 0x90, 0x05, 0x89, 0x20, 0x41, 0x8A, 0x40, 0x81,
+    0x04, 0x80, 0x01, 0x40, 0x90, 0x11, 0x40, 0x00, 0x21, 0x20, 0x00, 0x41,
+    0x00, 0x00, 0x81, 0x0C, 0x02, 0x01, 0x00, 0xC0, 0x01, 0x40, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x40, 0x28, 0x11, 0x00, 0x15, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC1,
+    0x00, 0x00, 0xC0, 0x23, 0x00, 0x04, 0x00, 0x23, 0x28, 0x10, 0x00, 0x23,
+    0x00, 0x10, 0x00, 0x21, 0x40, 0x40, 0x00, 0x21, 0x20, 0x00, 0x00, 0x05,
+    0x12, 0x00, 0x00, 0x85, 0x02, 0x40, 0x04, 0x09, 0x0A, 0x00, 0xA0, 0x01,
+    0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0xA0, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x40, 0x28, 0x11, 0x00, 0x15, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC1,
+    0x00, 0x00, 0xC0, 0x23, 0x00, 0x04, 0x00, 0x23, 0x00, 0x10, 0x00, 0x23,
+    0x00, 0x10, 0x00, 0x21, 0x08, 0x40, 0x00, 0x21, 0x02, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x85, 0x20, 0x40, 0x04, 0x09, 0x04, 0x00, 0xA0, 0x01,
+    0x04, 0x04, 0x00, 0x21, 0x48, 0x00, 0x00, 0xC1, 0x30, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0xA0, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x02, 0x83, 0x00, 0x80, 0x50, 0x23, 0x00, 0x2A, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x17, 0x83,
+    0x00, 0x01, 0x80, 0x47, 0x08, 0x08, 0x00, 0x47, 0x00, 0x20, 0x00, 0x47,
+    0x00, 0x20, 0x00, 0x43, 0x00, 0x80, 0x00, 0x43, 0x48, 0x00, 0x00, 0x0B,
+    0x90, 0x00, 0x01, 0x0B, 0x10, 0x80, 0x08, 0x13, 0x88, 0x01, 0x40, 0x03,
+    0x04, 0x08, 0x00, 0x43, 0x20, 0x00, 0x01, 0x83, 0x18, 0x00, 0x08, 0x03,
+    0x00, 0x01, 0x40, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x05, 0x07, 0x01, 0x00, 0xA0, 0x47, 0x00, 0x54, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2F, 0x07,
+    0x00, 0x03, 0x00, 0x8F, 0x30, 0x10, 0x00, 0x8F, 0x08, 0x40, 0x00, 0x8F,
+    0x00, 0x40, 0x00, 0x87, 0x89, 0x00, 0x00, 0x87, 0x80, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x02, 0x17, 0x31, 0x00, 0x10, 0x27, 0x00, 0x02, 0x80, 0x07,
+    0x00, 0x10, 0x00, 0x87, 0x88, 0x00, 0x03, 0x07, 0x90, 0x00, 0x10, 0x07,
+    0x00, 0x02, 0x80, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x47, 0x20, 0x28, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x67, 0x00, 0x0A, 0x27, 0x00, 0xA2, 0x0F, 0x12, 0x00, 0x87,
+    0x22, 0x04, 0x07, 0x20, 0x00, 0x87, 0x89, 0x10, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x07, 0x04, 0x00, 0x07, 0x02, 0x08, 0x07, 0x01, 0x00, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00,
+    0x08, 0x00, 0x50, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0xC0, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0x90, 0x40, 0x04, 0x00, 0x01, 0x00, 0x40, 0x00, 0x82, 0x18, 0x10, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x40, 0x01, 0x02, 0x00, 0x21, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x00, 0x00,
+    // 0xE0 'à'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x03, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x20, 0x1F,
+    0x00, 0x20, 0x02, 0x5F, 0x00, 0x20, 0x00, 0x1F, 0x04, 0x04, 0x08, 0x1F,
+    0x40, 0x00, 0x12, 0x1F, 0x11, 0x24, 0x80, 0x1F, 0x00, 0x22, 0x00, 0x1F,
+    0x03, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0xA0, 0x5F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x03, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x20, 0x1F,
+    0x00, 0x20, 0x02, 0x5F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x04, 0x08, 0x1F,
+    0x00, 0x00, 0x12, 0x1F, 0x03, 0x24, 0x80, 0x1F, 0x11, 0x22, 0x00, 0x1F,
+    0x22, 0x10, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x20, 0xA0, 0x5F,
+    0x50, 0x02, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x06, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x40, 0x3F,
+    0x04, 0x40, 0x04, 0xBF, 0x08, 0x40, 0x00, 0x3F, 0x20, 0x08, 0x10, 0x3F,
+    0x40, 0x00, 0x24, 0x3F, 0x88, 0x49, 0x00, 0x3F, 0x10, 0x44, 0x00, 0x3F,
+    0x04, 0x20, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x3F, 0x12, 0x41, 0x40, 0xBF,
+    0x04, 0x04, 0x00, 0x3F, 0x00, 0x20, 0x01, 0x3F, 0x00, 0x00, 0x04, 0x3F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x0C, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x40, 0x80, 0x7F,
+    0x00, 0x80, 0x09, 0x7F, 0x40, 0x80, 0x00, 0x7F, 0x90, 0x10, 0x20, 0x7F,
+    0x00, 0x00, 0x48, 0x7F, 0x80, 0x92, 0x00, 0x7F, 0x00, 0x88, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x7F, 0x80, 0x82, 0x81, 0x7F,
+    0x10, 0x08, 0x00, 0x7F, 0x00, 0x40, 0x02, 0x7F, 0x00, 0x00, 0x08, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x01, 0x00, 0x81, 0x00, 0x11, 0x00, 0x12, 0x01, 0x00, 0x00,
+    0x00, 0x20, 0x40, 0x80, 0x00, 0x90, 0x41, 0x24, 0x00, 0x01, 0x10, 0x00,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x05, 0x02, 0x10, 0x10, 0x00,
+    0x00, 0x80, 0x04, 0x00, 0x00, 0x10,
+    // 0xE5 'å'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x03, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x20, 0x1F,
+    0x00, 0x20, 0x02, 0x5F, 0x1C, 0x20, 0x00, 0x1F, 0x20, 0x04, 0x08, 0x1F,
+    0x00, 0x80, 0x12, 0x1F, 0x00, 0x24, 0x80, 0x1F, 0x02, 0x22, 0x00, 0x1F,
+    0x08, 0x10, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x1F, 0x06, 0x20, 0xA0, 0x5F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x1F,
+    // 0xE6 'æ'
+    0x00, 0x00, 0x3F, 0x00, 0x40, 0x3F, 0x02, 0x00, 0xBF, 0x00, 0x00, 0x3F,
+    0x10, 0x00, 0x7F, 0x00, 0x40, 0x3F, 0x40, 0x04, 0xBF, 0x40, 0x00, 0x3F,
+    0x08, 0x11, 0x3F, 0x00, 0x20, 0x3F, 0x01, 0x86, 0x3F, 0x44, 0x01, 0x3F,
+    0x40, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0xC4, 0x7F, 0x04, 0x10, 0x7F,
+    0x08, 0x80, 0x3F, 0x51, 0x04, 0x3F, 0x10, 0x04, 0x3F, 0x00, 0x48, 0x3F,
+    0x00, 0x00, 0x3F, 0x40, 0x0E, 0x3F, 0x38, 0x00, 0x3F,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x00, 0x7F, 0x01, 0x83, 0x00, 0x7F, 0x04, 0x00, 0x81, 0xFF,
+    0x00, 0x00, 0x10, 0x7F, 0x10, 0x00, 0x22, 0xFF, 0x01, 0x40, 0x40, 0x7F,
+    0x00, 0x04, 0x40, 0x7F, 0x00, 0x04, 0x02, 0x7F, 0x08, 0x00, 0x80, 0x7F,
+    0x08, 0x00, 0x80, 0x7F, 0x08, 0x01, 0x00, 0x7F, 0x40, 0x02, 0x00, 0x7F,
+    0x44, 0x04, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    // 0xE8 'è'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x02, 0x3F,
+    0x40, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x10, 0x1F, 0x22, 0x08, 0x92, 0x5F,
+    0x00, 0x01, 0x20, 0x5F, 0x08, 0x00, 0x00, 0x9F, 0x01, 0x20, 0x48, 0x1F,
+    0x00, 0x20, 0x80, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    // 0xE9 'é'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x08, 0x92, 0x5F,
+    0x04, 0x01, 0x20, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x02, 0x20, 0x48, 0x1F,
+    0x84, 0x20, 0x80, 0x1F, 0x08, 0x02, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x82, 0x3F, 0x00, 0x04, 0x00, 0xBF,
+    0x00, 0x08, 0x00, 0x3F, 0x02, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x7F,
+    0x10, 0x00, 0x80, 0x7F, 0x22, 0x00, 0x20, 0x3F, 0x04, 0x11, 0x24, 0xBF,
+    0x88, 0x02, 0x40, 0xBF, 0x10, 0x00, 0x01, 0x3F, 0x00, 0x40, 0x90, 0x3F,
+    0x40, 0x41, 0x00, 0x3F, 0x02, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0x10, 0x02, 0x00, 0x20, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x11, 0x80, 0x02, 0x01, 0x00, 0x00, 0x80,
+    0x10, 0x44, 0x92, 0x00, 0x09, 0x02, 0x20, 0x00, 0x04, 0x01, 0x02, 0x40,
+    0x81, 0x04, 0x00, 0x00, 0x10, 0x00, 0xA0, 0x00, 0x00,
+    // 0xEC 'ì'
+    0x00, 0x00, 0x05, 0xDF, 0x00, 0x20, 0x40, 0x1F, 0x00, 0x03, 0x00, 0x3F,
+    0x40, 0x20, 0x00, 0x3F, 0x02, 0x00, 0x06, 0x1F, 0x20, 0x00, 0x40, 0x1F,
+    0x08, 0x25, 0x00, 0x1F, 0x01, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xED 'í'
+    0x00, 0x00, 0x05, 0xDF, 0x00, 0x20, 0x40, 0x1F, 0x00, 0x03, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x1F, 0x04, 0x00, 0x40, 0x1F,
+    0x09, 0x25, 0x00, 0x1F, 0x20, 0x00, 0x03, 0x1F, 0x42, 0x00, 0x00, 0x1F,
+    0x84, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xEE 'î'
+    0x00, 0x00, 0x0B, 0xBF, 0x06, 0x40, 0x80, 0x3F, 0x00, 0x06, 0x00, 0x7F,
+    0x12, 0x40, 0x00, 0x7F, 0x04, 0x00, 0x0C, 0x3F, 0x08, 0x00, 0x80, 0x3F,
+    0x90, 0x4A, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x3F,
+    // 0xEF 'ï'
+    0x00, 0x00, 0x2E, 0x51, 0x02, 0x00, 0x80, 0x18, 0x01, 0x81, 0x00, 0x01,
+    0x90, 0x00, 0x30, 0xC0, 0x02, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x04, 0x01, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x01, 0x0C, 0x7F,
+    0x00, 0x02, 0x00, 0x7F, 0x11, 0x40, 0x00, 0x7F, 0x49, 0x00, 0x04, 0x3F,
+    0x02, 0x48, 0x08, 0xBF, 0x01, 0x08, 0x00, 0xBF, 0x20, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x44, 0x00, 0x04, 0x3F, 0x10, 0x00, 0x20, 0x3F,
+    0x00, 0x24, 0x80, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x05, 0x7F, 0x00, 0x80, 0x60, 0x7F,
+    0x00, 0x0A, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x03, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x40, 0x11, 0x80, 0x7F, 0x90, 0x02, 0x00, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x88, 0x00, 0x2B, 0x7F, 0x00, 0x10, 0x80, 0x7F,
+    0x00, 0x08, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x20, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x08, 0x10, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0xE6, 0x3F,
+    0x00, 0x22, 0x00, 0x3F, 0x28, 0x04, 0x01, 0x1F, 0x44, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x04, 0x5F, 0x11, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x06, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x00, 0x02, 0xC0, 0x1F,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0xE6, 0x3F,
+    0x00, 0x22, 0x00, 0x3F, 0x00, 0x04, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x04, 0x5F, 0x03, 0x00, 0x18, 0x1F, 0x01, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x1F, 0x00, 0x08, 0x00, 0x1F,
+    0x50, 0x02, 0xC0, 0x1F,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x21, 0xCC, 0x7F,
+    0x06, 0x44, 0x00, 0x7F, 0x08, 0x08, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x08, 0xBF, 0x80, 0x00, 0x30, 0x3F, 0x10, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x3F, 0x42, 0x00, 0x04, 0x3F, 0x32, 0x10, 0x00, 0x3F,
+    0x00, 0x05, 0x80, 0x3F,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x10, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x43, 0x98, 0xFF,
+    0x10, 0x88, 0x00, 0xFF, 0x40, 0x10, 0x04, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x11, 0x7F, 0x90, 0x00, 0x60, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x08, 0x7F, 0x88, 0x20, 0x00, 0x7F,
+    0x10, 0x0B, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x31, 0x21, 0x10, 0x01, 0x00, 0x20, 0x08,
+    0x80, 0x00, 0x00, 0x80, 0x00, 0x22, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x16, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xF7 '÷'
+    0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x70, 0x3B,
+    0x80, 0x07, 0x00, 0x47, 0x80, 0x03, 0x00, 0x0B, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xBF,
+    0x00, 0x00, 0x3F, 0x08, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x20, 0xAC, 0x7F,
+    0x44, 0x02, 0x7F, 0x08, 0x82, 0x3F, 0x01, 0x00, 0x3F, 0x02, 0x40, 0xBF,
+    0x08, 0x80, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F,
+    0x20, 0x00, 0x3F, 0x05, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x1F, 0x00, 0x20, 0x40, 0x5F,
+    0x00, 0x25, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x1F,
+    0x10, 0x00, 0x60, 0x5F, 0x40, 0x1C, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x22, 0x00, 0x09, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x08, 0x02, 0x80, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x16, 0x1F,
+    0x00, 0x02, 0x82, 0x5F, 0x00, 0x28, 0x04, 0x9F, 0x00, 0x00, 0x04, 0x1F,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x1F, 0x00, 0x20, 0x40, 0x5F,
+    0x00, 0x25, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x60, 0x5F, 0x00, 0x1C, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x09, 0x1F, 0x04, 0x00, 0x02, 0x1F, 0x00, 0x02, 0x80, 0x1F,
+    0x02, 0x10, 0x00, 0x1F, 0x84, 0x00, 0x00, 0x1F, 0x08, 0x20, 0x16, 0x1F,
+    0x20, 0x02, 0x82, 0x5F, 0x00, 0x28, 0x04, 0x9F, 0x00, 0x00, 0x04, 0x1F,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0A, 0x3F, 0x00, 0x40, 0x80, 0xBF,
+    0x00, 0x4A, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x10, 0x3F,
+    0x00, 0x00, 0xC0, 0xBF, 0x10, 0x38, 0x04, 0x3F, 0x22, 0x00, 0x01, 0x3F,
+    0x04, 0x00, 0x12, 0x3F, 0x80, 0x00, 0x04, 0x3F, 0x10, 0x05, 0x00, 0x3F,
+    0x00, 0x20, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x02, 0x40, 0x2C, 0x3F,
+    0x00, 0x05, 0x04, 0xBF, 0x00, 0x50, 0x09, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x02, 0x02, 0x01, 0x28, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x40, 0x03, 0x02, 0x80, 0xE0, 0x10,
+    0x00, 0x00, 0x04, 0x10, 0x00, 0x48, 0x00, 0x00, 0x10, 0x20, 0x14, 0x00,
+    0x80, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0xB0, 0xA0, 0x14, 0x12,
+    0x01, 0x40, 0x24, 0x00, 0x00, 0x20,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x28, 0x03, 0x00, 0x05, 0x00, 0x03,
+    0x00, 0x40, 0x00, 0x13, 0x4A, 0x00, 0x01, 0x8B, 0x00, 0x00, 0x20, 0x03,
+    0x00, 0x11, 0x80, 0x0F, 0x00, 0x42, 0x04, 0x81, 0x08, 0x08, 0x00, 0x01,
+    0x00, 0x10, 0x10, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x80, 0x00, 0x01,
+    0x00, 0x1E, 0x80, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x01, 0x08, 0x00, 0x09,
+    0x10, 0x01, 0x63, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01,
+    0x80, 0x08, 0x00, 0x01, 0x40, 0x00, 0x31, 0x01, 0x00, 0x00, 0x02, 0x01,
+    0x01, 0x81, 0x08, 0x01, 0x81, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x10, 0x01, 0x00, 0x01, 0x01, 0x08, 0x00, 0x01, 0x00, 0x60, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x40, 0x88, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x10, 0x80, 0x00, 0x07, 0x43, 0x00, 0x0C, 0x07, 0x02, 0x80, 0x00, 0x87,
+    0x00, 0x08, 0x80, 0x17, 0x80, 0x00, 0x02, 0x07, 0x50, 0x00, 0x00, 0x4F,
+    0x02, 0x80, 0x00, 0x0F, 0x00, 0x14, 0x00, 0x07, 0x00, 0x00, 0xA0, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x105 'ą'
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x40, 0x20, 0x40, 0x00, 0x40, 0x04, 0x80, 0x40, 0x00, 0x00,
+    0x08, 0x10, 0x00, 0x00, 0x24, 0x00, 0x49, 0x01, 0x1E, 0x44, 0x00, 0x20,
+    0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x41, 0x40, 0x00, 0x04, 0x00, 0x00,
+    0x20, 0x01, 0x00, 0x00, 0x04, 0x00,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x81, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x05, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x00, 0xC1, 0x81, 0x00, 0x21, 0x00, 0x01, 0x00, 0x40, 0x00, 0x03,
+    0x00, 0x40, 0x00, 0x23, 0x04, 0x00, 0x00, 0x03, 0x08, 0x08, 0x00, 0x01,
+    0x02, 0x80, 0x00, 0x21, 0x12, 0x80, 0x00, 0x01, 0x20, 0x80, 0x00, 0x01,
+    0x04, 0x0F, 0x00, 0x81, 0x04, 0x00, 0x00, 0x11, 0x48, 0x41, 0x00, 0xA1,
+    0x10, 0x40, 0x00, 0x01, 0x00, 0x30, 0x00, 0x01,
+    // 0x107 'ć'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x9F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0xA0, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x04, 0x00, 0x5F,
+    0x04, 0x04, 0x00, 0x5F, 0x00, 0x04, 0x00, 0x9F, 0x02, 0x20, 0x01, 0x1F,
+    0x84, 0x22, 0x02, 0x1F, 0x08, 0x08, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x81, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x05, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x00, 0xC1, 0x81, 0x00, 0x21, 0x00, 0x01, 0x20, 0x40, 0x00, 0x03,
+    0x48, 0x40, 0x00, 0x23, 0x40, 0x00, 0x00, 0x03, 0x20, 0x08, 0x00, 0x01,
+    0x00, 0x80, 0x00, 0x21, 0x00, 0x80, 0x00, 0x01, 0x12, 0x80, 0x00, 0x01,
+    0x04, 0x0F, 0x00, 0x81, 0x48, 0x00, 0x00, 0x11, 0x00, 0x41, 0x00, 0xA1,
+    0x00, 0x40, 0x00, 0x01, 0x40, 0x30, 0x00, 0x01,
+    // 0x10D 'č'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x9F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0xA0, 0x3F,
+    0x4C, 0x00, 0x02, 0x3F, 0x42, 0x00, 0x02, 0x1F, 0x31, 0x04, 0x00, 0x5F,
+    0x09, 0x04, 0x00, 0x5F, 0x01, 0x04, 0x00, 0x9F, 0x02, 0x20, 0x01, 0x1F,
+    0x40, 0x22, 0x02, 0x1F, 0x10, 0x08, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0xA1, 0x00, 0x48, 0x14, 0x01,
+    0x00, 0x02, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x05, 0x01, 0x60, 0x80, 0xA0, 0x01, 0x08, 0x8A, 0x00, 0x01,
+    0x00, 0x80, 0x00, 0x21, 0x20, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x41, 0x02, 0x04, 0x00, 0x89, 0x04, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x60, 0x11, 0x00, 0x00, 0x00, 0x01, 0x60, 0x10, 0x00, 0x01,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x0C, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x40, 0x80, 0x7F,
+    0x00, 0x80, 0x09, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x7F,
+    0x00, 0x00, 0x48, 0x7F, 0x30, 0x92, 0x00, 0x7F, 0x00, 0x88, 0x00, 0x7F,
+    0x42, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x02, 0x81, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x01, 0x00, 0x02, 0x7F, 0x30, 0x00, 0x08, 0x7F,
+    0x05, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x03, 0x00, 0x00, 0x7F,
+    0x0C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x40, 0x0F, 0x20, 0x28, 0x00, 0x0F,
+    0x25, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x00, 0x0A, 0x20, 0x0F, 0x01, 0x00, 0x20, 0x0F, 0x14, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x02, 0x9F,
+    0x00, 0x01, 0x04, 0x1F, 0x00, 0x10, 0x00, 0x2F, 0x02, 0x02, 0x30, 0x4F,
+    0x02, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x00, 0x0F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x00, 0x01, 0x82, 0x00, 0x04, 0x00, 0x80, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x0C, 0x00, 0x04, 0x62, 0x00, 0x80, 0x40, 0x00, 0x20, 0x21,
+    0x11, 0x24, 0x01, 0x02, 0x40, 0x80, 0x00, 0x01, 0x00, 0x40, 0x90, 0x00,
+    0x41, 0x00, 0x00, 0x04, 0x00, 0x00,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x14, 0x03,
+    0x00, 0x12, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x05, 0x13, 0x40, 0x00, 0x80, 0x13, 0x44, 0x0A, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x83, 0x20, 0x00, 0x08, 0x03, 0x48, 0x01, 0x01, 0x1B,
+    0x10, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x40, 0x18, 0x00, 0x03,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x02, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x3F,
+    0x4C, 0x00, 0x40, 0x3F, 0x42, 0x00, 0x10, 0x1F, 0x31, 0x08, 0x92, 0x5F,
+    0x09, 0x01, 0x20, 0x5F, 0x01, 0x00, 0x00, 0x9F, 0x02, 0x20, 0x48, 0x1F,
+    0x40, 0x20, 0x80, 0x1F, 0x10, 0x02, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x10, 0x14, 0x03,
+    0x00, 0x12, 0x80, 0x03, 0x04, 0x08, 0x00, 0x03, 0x08, 0x00, 0x00, 0x23,
+    0x02, 0x00, 0x03, 0x13, 0x10, 0x00, 0x50, 0x13, 0x20, 0x0A, 0x00, 0x03,
+    0x04, 0x10, 0x00, 0x03, 0x04, 0x10, 0x00, 0x03, 0x48, 0x00, 0x00, 0x03,
+    0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x83,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0xA0, 0x01,
+    0x00, 0x84, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x04, 0x00, 0x0A, 0x02,
+    0x20, 0x00, 0xA0, 0x24, 0x00, 0x0C, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x04, 0x05, 0x00, 0x04, 0xA0, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0xC4, 0x00, 0x14, 0x04, 0x02, 0x80, 0x00,
+    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x40, 0x00, 0x01, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x20, 0x50, 0x00, 0x00,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x05, 0x00, 0x7F, 0x00, 0x50, 0x00, 0xFF,
+    0x42, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x05, 0x01, 0x7F,
+    0x00, 0x50, 0x12, 0x7F, 0x06, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x07, 0x00, 0x00, 0x27, 0x00, 0x04, 0x07,
+    0x00, 0x05, 0x47, 0x20, 0x00, 0x07, 0x25, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x06, 0x27, 0x00, 0x00, 0x27, 0x15, 0x00, 0x07,
+    0x21, 0x00, 0x07, 0x20, 0x00, 0x07, 0x01, 0x80, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07,
+    // 0x142 'ł'
+    0x00, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x00, 0x50, 0x00, 0xFF, 0x42, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x05, 0x01, 0x7F, 0x00, 0x48, 0x12, 0x7F,
+    0x06, 0x40, 0x00, 0x7F, 0x00, 0x50, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xA1, 0x00, 0x10, 0x14, 0x01, 0x00, 0x11, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x21, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x50, 0x01,
+    0x00, 0x00, 0xC0, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    0x06, 0x0C, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x61, 0x10, 0x00, 0x00, 0x09,
+    0x02, 0x00, 0x18, 0x03, 0x00, 0x00, 0x06, 0x03, 0x40, 0x10, 0x14, 0x01,
+    0x00, 0x12, 0x80, 0x01, 0x78, 0x00, 0x00, 0x29, 0x00, 0x00, 0x05, 0x01,
+    0x00, 0x00, 0x50, 0x01, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x01, 0x5F, 0x00, 0x20, 0x18, 0x1F,
+    0x00, 0x02, 0x80, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    0x00, 0x00, 0x04, 0x1F, 0x00, 0x04, 0x60, 0x1F, 0x00, 0x00, 0x80, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x01, 0x00, 0x0A, 0xDF, 0x10, 0x04, 0x20, 0x1F,
+    0x22, 0x02, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x70, 0x00, 0x20, 0x1F, 0x00, 0x02, 0x04, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xA1, 0x00, 0x10, 0x14, 0x01, 0x00, 0x11, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x21, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x50, 0x01,
+    0x00, 0x00, 0xC0, 0x01, 0x40, 0x40, 0x00, 0x01, 0x08, 0x20, 0x00, 0x01,
+    0x40, 0x0C, 0x01, 0x01, 0x20, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09,
+    0x10, 0x00, 0x18, 0x03, 0x02, 0x00, 0x06, 0x03, 0x04, 0x10, 0x14, 0x01,
+    0x48, 0x12, 0x80, 0x01, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x05, 0x01,
+    0x00, 0x00, 0x50, 0x01, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x01, 0x5F, 0x00, 0x20, 0x18, 0x1F,
+    0x00, 0x02, 0x80, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xDF,
+    0x20, 0x00, 0x04, 0x1F, 0x48, 0x04, 0x60, 0x1F, 0x00, 0x00, 0x80, 0x1F,
+    0x21, 0x02, 0x00, 0x1F, 0x09, 0x00, 0x0A, 0xDF, 0x10, 0x04, 0x20, 0x1F,
+    0x22, 0x02, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x1F,
+    0x20, 0x00, 0x20, 0x1F, 0x40, 0x02, 0x04, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0x81, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x10, 0x1E, 0x05, 0x00, 0xC0, 0x81, 0x21, 0x00, 0x01,
+    0x02, 0x00, 0x03, 0x04, 0x00, 0x03, 0x08, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x81, 0x00, 0x14, 0x01, 0x01, 0x40, 0x01,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x04, 0x11, 0x00, 0x80, 0x11,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x81, 0x00, 0x08, 0x01, 0x0F, 0x00, 0x19, 0x01, 0x00, 0x81,
+    0x02, 0x00, 0x01, 0x08, 0x00, 0x01,
+    // 0x153 'œ'
+    0x00, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x21, 0xCC, 0x7F, 0x44, 0x00, 0x7F, 0x48, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x08, 0x3F, 0x00, 0x31, 0x3F, 0x40, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x20, 0x00, 0xBF, 0x10, 0x00, 0x3F, 0x23, 0x40, 0x7F,
+    0x04, 0x90, 0x7F, 0x08, 0x80, 0x3F, 0x50, 0x24, 0x3F, 0x10, 0x04, 0x3F,
+    0x00, 0x48, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x0A, 0x3F, 0x38, 0x00, 0x3F,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0xA1, 0x00, 0x00, 0x14, 0x01,
+    0x00, 0x02, 0x80, 0x01, 0x00, 0x48, 0x00, 0x01, 0x40, 0x00, 0x00, 0x21,
+    0x40, 0x00, 0x01, 0x01, 0x44, 0x80, 0xA0, 0x09, 0x02, 0x84, 0x00, 0x01,
+    0x10, 0x80, 0x00, 0x01, 0x00, 0x90, 0x20, 0x11, 0x10, 0x08, 0x04, 0x01,
+    0x20, 0x02, 0x82, 0x05, 0x00, 0x40, 0x00, 0x81, 0x10, 0x40, 0x10, 0x01,
+    0x00, 0x00, 0x20, 0x03, 0x40, 0x00, 0x80, 0x11, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x09,
+    // 0x159 'ř'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x20, 0x04, 0x3F,
+    0x00, 0x01, 0x40, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x7F,
+    0x44, 0x00, 0x02, 0x3F, 0x42, 0x06, 0x30, 0x3F, 0x31, 0x04, 0xC0, 0x3F,
+    0x09, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x22, 0x00, 0x3F,
+    0x08, 0x02, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x18, 0x62, 0x01, 0x00, 0x20, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x03, 0x00, 0x08, 0x04, 0x03,
+    0x08, 0x00, 0x00, 0x01, 0x02, 0x90, 0x01, 0x01, 0x00, 0x90, 0x40, 0x01,
+    0x00, 0x80, 0x00, 0x01, 0x00, 0x01, 0x10, 0x09, 0x00, 0x00, 0x08, 0x11,
+    0x00, 0x00, 0x05, 0x41, 0x30, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x5F,
+    0x00, 0x03, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x3F,
+    0x00, 0x20, 0x11, 0x3F, 0x00, 0x06, 0x01, 0x1F, 0x00, 0x01, 0x02, 0x1F,
+    0x03, 0x00, 0x00, 0x1F, 0x11, 0x04, 0x40, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    0x80, 0x02, 0x12, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x50, 0x00, 0x00, 0x1F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x18, 0x62, 0x01, 0x00, 0x20, 0x10, 0x01,
+    0x20, 0x00, 0x00, 0x03, 0x40, 0x00, 0x08, 0x03, 0x04, 0x08, 0x04, 0x03,
+    0x20, 0x00, 0x00, 0x01, 0x10, 0x90, 0x01, 0x01, 0x00, 0x90, 0x40, 0x01,
+    0x02, 0x80, 0x00, 0x01, 0x24, 0x01, 0x10, 0x09, 0x40, 0x00, 0x08, 0x11,
+    0x00, 0x00, 0x05, 0x41, 0x00, 0x08, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x08, 0x5F,
+    0x00, 0x03, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x3F,
+    0x40, 0x20, 0x11, 0x3F, 0x00, 0x06, 0x01, 0x1F, 0x00, 0x01, 0x02, 0x1F,
+    0x09, 0x00, 0x00, 0x1F, 0x10, 0x04, 0x40, 0x9F, 0x20, 0x00, 0x01, 0x1F,
+    0x44, 0x02, 0x12, 0x1F, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x40, 0x00, 0x00, 0x1F,
+    // 0x164 'Ť'
+    0x00, 0x29, 0x00, 0x03, 0x00, 0x40, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x13,
+    0x00, 0x0C, 0x00, 0x13, 0x00, 0x00, 0x01, 0x43, 0x20, 0x00, 0x08, 0x03,
+    0x48, 0x02, 0x80, 0x03, 0x04, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x23,
+    0x10, 0x00, 0x05, 0x03, 0x00, 0x00, 0xA0, 0x0B, 0x02, 0x0C, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xA1, 0x7F,
+    0x00, 0x94, 0x00, 0x7F, 0x01, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x08, 0x00, 0x50, 0x7F, 0x00, 0x0A, 0x08, 0x7F, 0x09, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x10, 0x7F, 0x02, 0x00, 0x02, 0x7F, 0x62, 0x00, 0x0C, 0x7F,
+    0x04, 0xC0, 0x00, 0x7F, 0x88, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x40, 0x28, 0x11, 0x00, 0x15, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC1,
+    0x00, 0x00, 0xC0, 0x23, 0x00, 0x04, 0x00, 0x23, 0x00, 0x10, 0x00, 0x23,
+    0x02, 0x10, 0x00, 0x21, 0x01, 0x40, 0x00, 0x21, 0x15, 0x00, 0x00, 0x05,
+    0x05, 0x00, 0x00, 0x85, 0x20, 0x40, 0x04, 0x09, 0x99, 0x00, 0xA0, 0x01,
+    0x40, 0x04, 0x00, 0x21, 0x24, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0xA0, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x1F, 0x00, 0x20, 0x40, 0x5F,
+    0x00, 0x25, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x00, 0x60, 0x5F, 0x02, 0x1C, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x5C, 0x00, 0x09, 0x1F, 0x00, 0x00, 0x02, 0x1F, 0x02, 0x82, 0x80, 0x1F,
+    0x14, 0x10, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x38, 0x20, 0x16, 0x1F,
+    0x00, 0x02, 0x82, 0x5F, 0x00, 0x28, 0x04, 0x9F, 0x00, 0x00, 0x04, 0x1F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x40, 0x28, 0x11, 0x00, 0x15, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC1,
+    0x00, 0x00, 0xC0, 0x23, 0x00, 0x04, 0x00, 0x23, 0x00, 0x10, 0x00, 0x23,
+    0x10, 0x10, 0x00, 0x21, 0x00, 0x40, 0x00, 0x21, 0x04, 0x00, 0x00, 0x05,
+    0x40, 0x00, 0x00, 0x85, 0x80, 0x40, 0x04, 0x09, 0x70, 0x00, 0xA0, 0x01,
+    0x08, 0x04, 0x00, 0x21, 0x10, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0xA0, 0x01, 0x40, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x20, 0x10, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0A, 0x3F, 0x00, 0x40, 0x80, 0xBF,
+    0x00, 0x4A, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x3F,
+    0x0A, 0x00, 0xC0, 0xBF, 0x02, 0x38, 0x04, 0x3F, 0x20, 0x00, 0x01, 0x3F,
+    0x80, 0x00, 0x12, 0x3F, 0x08, 0x00, 0x04, 0x3F, 0x62, 0x05, 0x00, 0x3F,
+    0x10, 0x20, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F, 0x44, 0x40, 0x2C, 0x3F,
+    0x80, 0x05, 0x04, 0xBF, 0x10, 0x50, 0x09, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    // 0x178 'Ÿ'
+    0x00, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x2F,
+    0x00, 0x0C, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x05, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x48, 0x48, 0x00, 0x0F, 0x00, 0x41, 0x00, 0x0F,
+    0x89, 0x00, 0x00, 0x8F, 0x80, 0x01, 0x04, 0x0F, 0x00, 0x04, 0x20, 0x2F,
+    0x31, 0x88, 0x40, 0x0F, 0x08, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x88, 0x04, 0x00, 0x0F, 0x80, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x10, 0x51, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x81, 0x01, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x01,
+    0x02, 0x04, 0x10, 0x01, 0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x40, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x09, 0x00, 0x44, 0x01, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x05, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x20, 0x1F,
+    0x00, 0x04, 0x44, 0x5F, 0x00, 0x24, 0x88, 0x5F, 0x00, 0x01, 0x00, 0x1F,
+    0x04, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x42, 0x10, 0x04, 0x1F,
+    0x84, 0x00, 0x00, 0x1F, 0x08, 0x02, 0x00, 0x1F, 0x00, 0x04, 0x03, 0x1F,
+    0x00, 0x08, 0x00, 0x1F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x83,
+    0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x20, 0xA3, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x01, 0x02, 0x03, 0x44, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x84, 0x08, 0x20, 0x03, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x80, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x13, 0x00, 0x88, 0x02, 0x43,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x14, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x11, 0x11, 0x7F, 0x10, 0x92, 0x21, 0x7F, 0x00, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0x00, 0x40, 0x10, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x10, 0x0C, 0x7F,
+    0x00, 0x20, 0x00, 0x7F,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x21, 0x10, 0x00, 0x10, 0x51, 0x04, 0x00, 0x00, 0x11,
+    0x42, 0x00, 0x81, 0x01, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x01,
+    0x10, 0x04, 0x10, 0x01, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01,
+    0x48, 0x00, 0x00, 0x03, 0x10, 0x02, 0x00, 0x09, 0x00, 0x44, 0x01, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x05, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x20, 0x1F,
+    0x44, 0x04, 0x44, 0x5F, 0x42, 0x24, 0x88, 0x5F, 0x31, 0x01, 0x00, 0x1F,
+    0x09, 0x00, 0x02, 0x3F, 0x01, 0x00, 0x02, 0x3F, 0x00, 0x10, 0x04, 0x1F,
+    0x08, 0x00, 0x00, 0x1F, 0x10, 0x02, 0x00, 0x1F, 0x00, 0x04, 0x03, 0x1F,
+    0x00, 0x08, 0x00, 0x1F,
+    // 0x3C0 'π'
+    0x00, 0x00, 0xBF, 0x00, 0x02, 0x3F, 0x10, 0x00, 0x7F, 0x04, 0x00, 0x3F,
+    0x40, 0x00, 0xBF, 0x0B, 0x01, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x30, 0x3F,
+    0x01, 0x80, 0x3F, 0x08, 0x06, 0x3F, 0x08, 0x40, 0xBF, 0x09, 0x00, 0x3F,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x01, 0x84, 0xBF, 0x08, 0x00, 0xBF,
+    0x48, 0x00, 0x3F, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41,
+    0x00, 0x05, 0x01, 0x00, 0xA0, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x15,
+    0x10, 0x02, 0x81, 0x20, 0x50, 0x11, 0x43, 0x00, 0x81, 0x40, 0x00, 0x01,
+    0x00, 0x10, 0x21, 0x80, 0x00, 0x13, 0x81, 0x04, 0x03, 0x92, 0x00, 0x11,
+    0x00, 0x02, 0x21, 0x00, 0xA0, 0xC5, 0x01, 0x00, 0x01, 0x00, 0x10, 0x01,
+    0x04, 0x08, 0x11, 0x08, 0x00, 0x41,
+    // 0x2013 '–'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F,
+    // 0x2014 '—'
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    // 0x2018 '‘'
+    0x01, 0x9F, 0x0C, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x44, 0x5F, 0x10, 0x1F,
+    0x60, 0x1F,
+    // 0x2019 '’'
+    0x00, 0x5F, 0x02, 0x1F, 0x04, 0x5F, 0x00, 0x9F, 0x00, 0x1F, 0x04, 0x1F,
+    0x30, 0x1F,
+    // 0x201A '‚'
+    0x01, 0xBF, 0x02, 0x7F, 0x08, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x84, 0x3F,
+    0x50, 0x3F,
+    // 0x201B '‛'
+    0x18, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F, 0x14, 0x3F, 0x61, 0x1F,
+    0x00, 0x1F,
+    // 0x201C '“'
+    0x01, 0x9F, 0x0C, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x44, 0x5F, 0x10, 0x1F,
+    0x60, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x03, 0x1F, 0x00, 0x1F,
+    0x20, 0x1F, 0x00, 0x1F,
+    // 0x201D '”'
+    0x01, 0xBF, 0x02, 0x7F, 0x88, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x84, 0x3F,
+    0x60, 0x3F, 0x02, 0x7F, 0x60, 0x3F, 0x80, 0xBF, 0x01, 0x3F, 0x80, 0x3F,
+    0x60, 0x3F,
+    // 0x201E '„'
+    0x01, 0xBF, 0x02, 0x7F, 0x08, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x84, 0x3F,
+    0x51, 0xBF, 0x02, 0x7F, 0x08, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x84, 0x3F,
+    0x50, 0x3F,
+    // 0x201F '‟'
+    0x18, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F, 0x14, 0x3F, 0x61, 0x1F,
+    0x18, 0x1F, 0x00, 0x1F, 0x00, 0x9F, 0x00, 0x5F, 0x14, 0x3F, 0x61, 0x1F,
+    0x00, 0x1F,
+    // 0x2020 '†'
+    0x02, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x9F,
+    0x00, 0x90, 0x0F, 0x00, 0x40, 0x1F, 0x00, 0x01, 0x2F, 0x00, 0x10, 0x0F,
+    0x00, 0x80, 0x0F, 0x50, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x40, 0x0F,
+    0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x20, 0x02, 0xC1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0x02, 0x01, 0x20, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x40, 0x00, 0x71, 0x00, 0x00, 0x80, 0x00, 0x50, 0x01, 0x20,
+    0x02, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    // 0x2022 '•'
+    0x36, 0x40, 0x00, 0x01, 0x00, 0x40, 0x2C,
+    // 0x2026 '…'
+    0x2B, 0x07, 0x03, 0x87, 0x03, 0x23, 0x03, 0x03, 0x03, 0x03, 0x2B, 0x07,
+    0x03, 0x87, 0x03, 0x23, 0x03, 0x03, 0x03, 0x03, 0x2B, 0x07, 0x03, 0x87,
+    0x03, 0x23,
+    // 0x2039 '‹'
+    0x03, 0x0F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F,
+    0x80, 0x3F, 0x00, 0x0F, 0x60, 0x0F,
+    // 0x203A '›'
+    0x00, 0x0F, 0x00, 0x3F, 0x00, 0x4F, 0x20, 0x9F, 0x81, 0x0F, 0x00, 0x2F,
+    0x00, 0x0F, 0x00, 0x8F, 0x01, 0x0F, 0x02, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x01, 0x06, 0x01, 0x10, 0x01, 0x00, 0x01, 0x02, 0xC1, 0x00, 0x11,
+    0x10, 0x01, 0x20, 0x25, 0x80, 0x05, 0x00, 0x01, 0x80, 0x11, 0x00, 0x41,
+    0x01, 0x01,
+    // 0x2074 '⁴'
+    0x00, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x01, 0x03,
+    0x12, 0x0B, 0x24, 0x03, 0x44, 0x03, 0x80, 0x17, 0x81, 0x03, 0x28, 0x03,
+    0x00, 0x03,
+    // 0x2075 '⁵'
+    0x00, 0x05, 0x00, 0x01, 0x00, 0x03, 0x40, 0x11, 0x80, 0x11, 0x89, 0x25,
+    0x80, 0x05, 0x84, 0x09, 0x80, 0x11, 0x83, 0x61, 0x80, 0x01, 0x40, 0x01,
+    // 0x2076 '⁶'
+    0x01, 0x51, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x21, 0x01, 0x0D, 0x01,
+    0x04, 0x01, 0x94, 0xA5, 0x04, 0x01, 0xA2, 0x09, 0x81, 0x21, 0xA0, 0x01,
+    0x00, 0x01,
+    // 0x2077 '⁷'
+    0x18, 0x01, 0x44, 0x11, 0x80, 0x03, 0x90, 0x01, 0x80, 0x19, 0x84, 0x21,
+    0x80, 0x01, 0x81, 0x01, 0x84, 0x01, 0x80, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x01, 0x00, 0x85, 0x04, 0x01, 0x00, 0x31, 0x00, 0x81, 0x04, 0x01,
+    0xA4, 0x81, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x61, 0x10, 0x01,
+    // 0x2079 '⁹'
+    0x00, 0x09, 0x00, 0x01, 0x0B, 0x01, 0x00, 0x11, 0x00, 0x01, 0x9C, 0x01,
+    0x20, 0x65, 0x81, 0x49, 0x80, 0x01, 0x80, 0x01, 0x00, 0x41, 0x21, 0x81,
+    0x08, 0x01,
+    // 0x2080 '₀'
+    0x00, 0x01, 0x06, 0x01, 0x10, 0x01, 0x00, 0x01, 0x42, 0xE3, 0x00, 0x03,
+    0x90, 0x11, 0x00, 0x21, 0x10, 0x45, 0x00, 0x01, 0x00, 0x01, 0x40, 0x41,
+    0x01, 0x01,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x0B, 0x30, 0x03, 0x50, 0x03, 0x52, 0x83, 0x00, 0x03,
+    0x80, 0x03, 0x81, 0x93, 0x28, 0x0B, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x03, 0x00, 0x07, 0x18, 0x23, 0x20, 0x03, 0x00, 0x03, 0x10, 0x93,
+    0x81, 0x23, 0x00, 0x03, 0x14, 0x83, 0x80, 0x03, 0x00, 0x03, 0x44, 0x0B,
+    0x00, 0x03,
+    // 0x2083 '₃'
+    0x00, 0x0D, 0x00, 0x03, 0x10, 0x03, 0x02, 0x03, 0x10, 0x11, 0x80, 0x91,
+    0x00, 0x01, 0x18, 0x01, 0x80, 0x09, 0x01, 0x31, 0x10, 0x01,
+    // 0x2084 '₄'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11,
+    0x02, 0x19, 0x04, 0x01, 0x0C, 0x01, 0x80, 0x05, 0x01, 0x11, 0xA8, 0x11,
+    0x00, 0x21,
+    // 0x2085 '₅'
+    0x00, 0x05, 0x00, 0x03, 0x02, 0x03, 0x40, 0x03, 0x80, 0x01, 0x89, 0x05,
+    0x80, 0x05, 0x80, 0x09, 0x80, 0x11, 0x81, 0x61, 0x80, 0x01, 0x00, 0x01,
+    // 0x2086 '₆'
+    0x01, 0x71, 0x00, 0x01, 0x08, 0x05, 0x00, 0x01, 0x20, 0x03, 0x4D, 0x03,
+    0x05, 0x11, 0x10, 0xA5, 0x04, 0x05, 0x20, 0x09, 0x01, 0x21, 0x20, 0x01,
+    0x00, 0x01,
+    // 0x2087 '₇'
+    0x18, 0x01, 0x04, 0x11, 0x80, 0x03, 0x90, 0x83, 0x82, 0x09, 0x80, 0x21,
+    0x88, 0x01, 0x81, 0x01, 0x84, 0x01, 0x80, 0x01, 0x10, 0x01, 0x00, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x01, 0x00, 0x81, 0x00, 0x01, 0x40, 0x21, 0x00, 0x01, 0x84, 0x01,
+    0x00, 0x01, 0x00, 0x05, 0x01, 0x01, 0x02, 0x89, 0x04, 0x21, 0x10, 0x01,
+    // 0x2089 '₉'
+    0x00, 0x09, 0x00, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x40, 0x01, 0x9C, 0x45,
+    0x21, 0x45, 0x01, 0x49, 0x00, 0x01, 0x80, 0x11, 0x40, 0x01, 0x21, 0x01,
+    0x00, 0x01,
+    // 0x20A9 '₩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AA '₪'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20AC '€'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0xD0, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x20, 0x03, 0x02, 0x00, 0x03, 0x04, 0x00, 0x13, 0x10, 0x00, 0x0B,
+    0x00, 0x03, 0x0B, 0x03, 0x10, 0x83, 0x00, 0x00, 0x07, 0x08, 0x00, 0x47,
+    0x81, 0x00, 0x07, 0x11, 0x04, 0x03, 0x91, 0x10, 0x03, 0x91, 0x00, 0x4B,
+    0x90, 0x00, 0x43, 0x82, 0x00, 0x83, 0x02, 0x00, 0xA3, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03,
+    // 0x20B4 '₴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20B9 '₹'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x20BD '₽'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2122 '™'
+    0x90, 0x5F, 0x10, 0x9F, 0x02, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x0A, 0x9F,
+    0x00, 0x1F, 0x20, 0x1F, 0x10, 0x5F, 0xC0, 0x9F, 0x06, 0x1F, 0xD0, 0x1F,
+    0x0A, 0x1F, 0x0A, 0x1F, 0x80, 0x9F, 0x09, 0x1F, 0x12, 0x1F, 0x40, 0x1F,
+    0x80, 0x1F, 0x00, 0x1F, 0x38, 0x9F, 0x40, 0x1F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x1A, 0x00,
+    0x02, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x41, 0x42, 0x08,
+    0x54, 0x06, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x84, 0x00, 0x00, 0x10,
+    0x00, 0x04, 0x20, 0x00, 0x00, 0x80, 0x00, 0x11, 0x00, 0x00, 0x44, 0x00,
+    0x00, 0x80, 0x00, 0x02, 0x10, 0x00, 0x04, 0x40, 0x00, 0x10, 0x00, 0x0C,
+    0x21, 0x00, 0x02, 0x84, 0x08, 0x02, 0x80, 0x0A, 0x82, 0x10, 0x10, 0x12,
+    0x40, 0x80, 0x90, 0x00, 0x04, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x82, 0x08,
+    0x00, 0x40, 0xA0, 0x00, 0x00, 0x00,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x22, 0x00,
+    0x24, 0x02, 0x00, 0x40, 0x1A, 0x00, 0x00, 0x8A, 0x00, 0x51, 0x2A, 0x00,
+    0x46, 0x4A, 0x02, 0x00, 0x8A, 0x00, 0x01, 0x0A, 0x21, 0x20, 0x08, 0x04,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x0C, 0x11, 0x00, 0x02, 0x00, 0x08, 0x02, 0x84, 0x0A, 0x82,
+    0x90, 0x10, 0x12, 0x40, 0x80, 0x90, 0x00, 0x04, 0xC4, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x08, 0x00, 0x40, 0xA0, 0x00, 0x00, 0x00,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x1A, 0x00,
+    0x02, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x06, 0x41, 0x42, 0x00,
+    0x54, 0x06, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x08,
+    0x00, 0x08, 0x84, 0x42, 0x02, 0x00, 0x88, 0x40, 0x12, 0x00, 0x00, 0x0A,
+    0x20, 0x80, 0x82, 0x00, 0x00, 0x40, 0x00, 0x20, 0x04, 0x00, 0x81, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
+    // 0x215C '⅜'
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x00,
+    0x01, 0x40, 0x00, 0x00, 0x02, 0x00, 0x50, 0x12, 0x06, 0x48, 0x00, 0x11,
+    0x01, 0x00, 0x00, 0x02, 0x10, 0x42, 0x18, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x04, 0x40, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x44, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x40, 0x00, 0x10, 0x00, 0x08,
+    0x42, 0x08, 0x84, 0x00, 0x02, 0x00, 0x08, 0x40, 0x12, 0x60, 0x00, 0x0A,
+    0x00, 0x80, 0x82, 0x00, 0x00, 0x40, 0x00, 0x20, 0x04, 0x00, 0x81, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
+    // 0x215D '⅝'
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x21, 0x08, 0x00,
+    0x00, 0x08, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
+    0x02, 0x00, 0x21, 0x01, 0xB0, 0x04, 0x00, 0x01, 0x00, 0x60, 0x02, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x11, 0x00, 0x08,
+    0x00, 0x08, 0x84, 0x84, 0x02, 0x00, 0x90, 0x40, 0x12, 0x40, 0x00, 0x0A,
+    0x00, 0x80, 0x82, 0x00, 0x00, 0x40, 0x00, 0x20, 0x04, 0x00, 0x81, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
+    // 0x215E '⅞'
+    0x06, 0x00, 0x00, 0x7F, 0x10, 0x0C, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x04, 0x40, 0x00, 0x7F, 0x00, 0x06, 0x03, 0x7F, 0x01, 0x08, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x21, 0x7F, 0x00, 0x00, 0x84, 0x7F,
+    0x02, 0x00, 0x08, 0x7F, 0x24, 0x02, 0x20, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F,
+    0x01, 0x10, 0x00, 0x7F, 0x04, 0x20, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x21, 0x00, 0x04, 0x7F, 0x00, 0x04, 0x42, 0x7F, 0x44, 0x01, 0x00, 0x7F,
+    0x10, 0x20, 0x09, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x40, 0x41, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x10, 0x02, 0x7F, 0x00, 0x40, 0x80, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x2190 '←'
+    0x00, 0x01, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x04, 0x01,
+    0x40, 0x21, 0x48, 0x05, 0x30, 0x19, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x01,
+    // 0x2191 '↑'
+    0x04, 0x00, 0x0F, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x00, 0x3F, 0xEF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x08, 0x00, 0x0F, 0x04, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x00, 0x01, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x20, 0x19,
+    0x48, 0x01, 0x40, 0x21, 0x24, 0x41, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+    0x02, 0x01, 0x00, 0x01,
+    // 0x2193 '↓'
+    0x00, 0x04, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x11, 0x0F, 0x00, 0x08, 0x8F,
+    0x00, 0x04, 0x4F, 0xFF, 0xE2, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x7F, 0x82, 0x2F, 0x00, 0x04, 0x4F, 0x00, 0x08, 0x8F, 0x00, 0x11, 0x0F,
+    0x00, 0x0A, 0x0F, 0x00, 0x04, 0x0F,
+    // 0x2194 '↔'
+    0x02, 0x07, 0x00, 0x87, 0x00, 0x47, 0x00, 0x27, 0x00, 0x17, 0x00, 0x8F,
+    0x90, 0x07, 0x40, 0x27, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x40, 0x27, 0x90, 0x07, 0x00, 0x0F, 0x00, 0x17, 0x00, 0x27, 0x00, 0x47,
+    0x00, 0x87, 0x02, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x07, 0x00, 0x04, 0x87, 0x10, 0x04, 0x47,
+    0x22, 0x00, 0x07, 0x44, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x44, 0x00, 0x07, 0x22, 0x00, 0x07, 0x11, 0x00, 0x47, 0x00, 0x04, 0x87,
+    0x00, 0x03, 0x07, 0x00, 0x00, 0x07,
+    // 0x21D0 '⇐'
+    0x00, 0x80, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x7F,
+    0x01, 0x04, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x41, 0x7F, 0x04, 0x48, 0xFF,
+    0x00, 0x44, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x40, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x40, 0x7F, 0x06, 0x30, 0x7F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x0F, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D2 '⇒'
+    0x06, 0x30, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x48, 0x7F,
+    0x00, 0x40, 0x7F, 0x00, 0x40, 0x7F, 0x00, 0x42, 0x7F, 0x00, 0x44, 0x7F,
+    0x04, 0x48, 0xFF, 0x00, 0x41, 0x7F, 0x00, 0x42, 0x7F, 0x01, 0x04, 0x7F,
+    0x00, 0x08, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x80, 0x7F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x1F, 0x00, 0x18, 0x1F, 0x00, 0x24, 0x1F, 0x00, 0x22, 0x1F,
+    0x00, 0x11, 0x1F, 0x3E, 0x08, 0x9F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x01, 0x1F, 0x00, 0x01, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x3E, 0x08, 0x9F, 0x00, 0x11, 0x1F, 0x00, 0x22, 0x1F, 0x00, 0x24, 0x1F,
+    0x00, 0x18, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D4 '⇔'
+    0x01, 0x01, 0x00, 0x41, 0x00, 0x21, 0x00, 0x11, 0x02, 0x89, 0x40, 0x85,
+    0x80, 0x81, 0x98, 0x93, 0x48, 0x8D, 0x08, 0x81, 0x08, 0x81, 0x48, 0x89,
+    0x88, 0x91, 0x80, 0x83, 0x00, 0x85, 0x02, 0x89, 0x00, 0x11, 0x00, 0x21,
+    0x00, 0x41, 0x01, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x04, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x08, 0x10, 0x01, 0x7F, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x01, 0x00, 0xFF,
+    0x10, 0x08, 0x04, 0xFF, 0x90, 0x90, 0x00, 0x7F, 0x10, 0x10, 0x00, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x88, 0x80, 0xC2, 0x7F, 0x02, 0x04, 0x00, 0x7F,
+    0x00, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x40, 0x7F,
+    0x05, 0xE4, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x63, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x00, 0xD3, 0x06, 0x00, 0x13, 0x00, 0x18, 0x13,
+    0x40, 0xC0, 0x13, 0x00, 0x00, 0x13, 0x01, 0x80, 0x13, 0x80, 0x30, 0x13,
+    0x80, 0x06, 0x13, 0x30, 0x00, 0xD3, 0x06, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x0F,
+    // 0x220F '∏'
+    0x80, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x10, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x10, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFC, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x40, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x08, 0x3F, 0x84, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x80, 0x7F, 0x00, 0x20, 0x04, 0x7F,
+    0x10, 0x12, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x40, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x18, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x0C, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x20, 0x3F, 0x3C, 0x00, 0x02, 0xBF,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x221A '√'
+    0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x07,
+    0x00, 0x01, 0x80, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x06, 0x07,
+    0x00, 0x08, 0x00, 0x87, 0x00, 0x02, 0x80, 0x0F, 0x00, 0x00, 0x28, 0x07,
+    0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x40, 0x17,
+    0x00, 0x08, 0x00, 0x07, 0x00, 0x60, 0x10, 0x07, 0x01, 0x00, 0xC0, 0x07,
+    0x20, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x10, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x16, 0x1F, 0x40, 0x1F, 0x00, 0x3F, 0x04, 0x3F, 0x91, 0x3F, 0x91, 0x3F,
+    0x10, 0x3F, 0x04, 0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x42, 0x1F,
+    0x91, 0x1F, 0x81, 0x3F, 0x11, 0x3F, 0x8E, 0x1F, 0x80, 0x1F, 0x40, 0x9F,
+    0x0E, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x87, 0xFF, 0xFF, 0xA0, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    // 0x2260 '≠'
+    0x0C, 0x70, 0x12, 0x40, 0x12, 0x44, 0x12, 0x42, 0x12, 0x42, 0x12, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x00, 0x40, 0x40, 0x40, 0x02, 0x40, 0x52, 0x40,
+    0x12, 0x40, 0x10, 0x40,
+    // 0x2264 '≤'
+    0x02, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    0x00, 0x10, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x48, 0x3F, 0x00, 0x00, 0x3F,
+    0x80, 0x20, 0x3F, 0x40, 0x10, 0x3F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0xFF, 0x70, 0x14, 0x1F, 0x00, 0x00, 0x1F, 0x48, 0x24, 0x1F,
+    0x00, 0x20, 0x1F, 0x04, 0x48, 0x1F, 0x00, 0x48, 0x1F, 0x02, 0x10, 0x1F,
+    0x00, 0x90, 0x1F, 0x01, 0x20, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x1F,
+    0x00, 0x40, 0x1F, 0x00, 0x80, 0x1F,
+    // 0x2500 '─'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2502 '│'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x250C '┌'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2510 '┐'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2514 '└'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2518 '┘'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x251C '├'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2524 '┤'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x252C '┬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2534 '┴'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x253C '┼'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2550 '═'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2551 '║'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2554 '╔'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2557 '╗'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255A '╚'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x255D '╝'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2560 '╠'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2563 '╣'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2566 '╦'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x2569 '╩'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01,
+    // 0x256C '╬'
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x01
+};
+
+
+const uint8_t Bookerly30BoldItalicBitmapsCol_msb[] PROGMEM = {
+    // 0x20 ' '
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x21 '!'
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x38, 0x01, 0x0C, 0x00, 0x00,
+    0x00, 0x01, 0x10, 0x00, 0x18, 0x00, 0x00, 0x80, 0x00, 0x8C, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x22 '"'
+    0x00, 0x1F, 0x18, 0x1F, 0x40, 0x5F, 0x00, 0x9F, 0x84, 0x1F, 0xC0, 0x1F,
+    0x0F, 0x1F, 0x40, 0x1F, 0x00, 0x5F, 0x82, 0x1F, 0xB0, 0x1F, 0x00, 0x1F,
+    // 0x23 '#'
+    0x00, 0x06, 0x0F, 0x00, 0x02, 0x0F, 0x00, 0x02, 0x2F, 0x04, 0x00, 0x0F,
+    0x04, 0x60, 0x0F, 0x04, 0x00, 0x2F, 0x60, 0x00, 0x0F, 0x00, 0x22, 0x0F,
+    0x00, 0x02, 0x0F, 0x24, 0x02, 0x8F, 0x04, 0x00, 0x0F, 0x04, 0x80, 0x0F,
+    0x08, 0x00, 0xCF, 0x00, 0x02, 0x0F, 0x00, 0x82, 0x0F, 0x0C, 0x02, 0x0F,
+    0x04, 0x0C, 0x0F, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x24 '$'
+    0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0xF0, 0x61, 0x0F, 0x02, 0x00, 0x08, 0x47, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x82, 0x20, 0x63, 0x08, 0x20, 0x00, 0x03, 0x0A, 0x20, 0x64, 0x03,
+    0x03, 0x00, 0x81, 0x03, 0x10, 0x38, 0x41, 0x03, 0x81, 0x00, 0x00, 0x03,
+    0x91, 0x00, 0x00, 0x03, 0x08, 0x40, 0x00, 0x03, 0x00, 0x20, 0x60, 0x03,
+    0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x25 '%'
+    0x00, 0x40, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x02, 0x10, 0x00, 0x48, 0x10, 0x00, 0x50, 0x04, 0x11, 0x50, 0x00, 0x20,
+    0x4F, 0x08, 0x04, 0x40, 0x01, 0x00, 0x20, 0x22, 0x20, 0x19, 0x80, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x22, 0x00, 0x00, 0x08, 0x00, 0x01, 0x10, 0x00,
+    0x00, 0x02, 0x00, 0x08, 0x08, 0x00, 0x01, 0x10, 0x02, 0x40, 0x03, 0x02,
+    0x80, 0x20, 0x0A, 0x10, 0x08, 0x02, 0x60, 0x08, 0x20, 0x00, 0x07, 0x84,
+    0x00, 0x20, 0x08, 0x00, 0x00, 0x10, 0x00, 0x08, 0xC0,
+    // 0x26 '&'
+    0x00, 0x00, 0xC0, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x23, 0xC0, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x04, 0x10,
+    0x00, 0x01, 0x10, 0x04, 0x00, 0x10, 0x90, 0x08, 0x20, 0x81, 0x40, 0x04,
+    0x22, 0x01, 0x00, 0x04, 0x98, 0x80, 0x81, 0x08, 0x84, 0x00, 0x01, 0x00,
+    0x44, 0x44, 0x22, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0x80, 0x09, 0x00, 0x20, 0x00, 0x01, 0x20, 0x02, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00,
+    // 0x27 '''
+    0x00, 0x1F, 0x18, 0x1F, 0x40, 0x5F, 0x00, 0x9F, 0x84, 0x1F, 0xC0, 0x1F,
+    // 0x28 '('
+    0x00, 0x03, 0x98, 0x03, 0x00, 0x10, 0x01, 0x03, 0x00, 0x80, 0x00, 0x43,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x04, 0x0B, 0x08, 0x00, 0x00, 0x83,
+    0x10, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03,
+    // 0x29 ')'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x02, 0x03, 0x88, 0x00, 0x04, 0x03, 0x02, 0x00, 0x10, 0x03,
+    0x00, 0x61, 0x81, 0x03, 0x10, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x03,
+    0x01, 0x00, 0x40, 0x03, 0x00, 0x08, 0x00, 0x03,
+    // 0x2A '*'
+    0x00, 0x0F, 0x10, 0x0F, 0x00, 0x0F, 0x26, 0x4F, 0x00, 0x8F, 0x39, 0xEF,
+    0x00, 0x0F, 0x08, 0x0F, 0x00, 0x4F, 0x01, 0x0F, 0x01, 0x0F, 0x00, 0x0F,
+    // 0x2B '+'
+    0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x83,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03,
+    // 0x2C ','
+    0x00, 0x3F, 0x00, 0xBF, 0x01, 0x7F, 0x02, 0x7F, 0x40, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F, 0x04, 0x3F, 0x00, 0x3F,
+    // 0x2D '-'
+    0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x4F,
+    // 0x2E '.'
+    0x03, 0x43, 0x07, 0x03, 0x0B, 0x03,
+    // 0x2F '/'
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x08, 0x20, 0x00, 0x00, 0x80,
+    0x00, 0x40, 0x00, 0x01, 0x04, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00,
+    0x20, 0x80, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x90, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x30 '0'
+    0x00, 0x07, 0x03, 0x00, 0xC0, 0x23, 0x02, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x40, 0x83, 0x00, 0x00, 0x03, 0x44, 0x00, 0x03,
+    0x08, 0x00, 0x03, 0x80, 0x00, 0x43, 0x90, 0x00, 0x0B, 0x90, 0x01, 0x03,
+    0x80, 0x04, 0x03, 0x84, 0x60, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x02, 0x03, 0x10, 0x10, 0x03, 0x00, 0x00, 0x03,
+    // 0x31 '1'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x13,
+    0x04, 0x00, 0x63, 0x04, 0x0C, 0x03, 0x24, 0xC0, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x40, 0x01, 0x93, 0x00, 0x10, 0x13, 0x43, 0x00, 0x07,
+    0x20, 0x00, 0x03,
+    // 0x32 '2'
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x47, 0x00, 0x00, 0x87, 0x08, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x44, 0x00, 0x47, 0x08, 0x08, 0xC7,
+    0x80, 0x11, 0x47, 0x90, 0x20, 0x47, 0x80, 0x40, 0x47, 0x90, 0x84, 0x47,
+    0x8A, 0x08, 0x47, 0x80, 0x10, 0x47, 0x00, 0x20, 0x4F, 0x40, 0x40, 0x27,
+    0x21, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x33 '3'
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x03, 0x02, 0x10, 0x03, 0x44, 0x08, 0x03, 0x08, 0x40, 0x43,
+    0x80, 0x00, 0x0B, 0x90, 0x00, 0x83, 0x80, 0x08, 0x03, 0x91, 0x00, 0x13,
+    0x8C, 0x00, 0x03, 0x00, 0x60, 0x03, 0x00, 0x80, 0x03, 0x01, 0x06, 0x03,
+    0x14, 0x00, 0x03,
+    // 0x34 '4'
+    0x00, 0x07, 0x07, 0x00, 0x08, 0x07, 0x00, 0x10, 0x07, 0x00, 0x20, 0x07,
+    0x00, 0x40, 0x07, 0x00, 0x88, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x04, 0x00, 0x0F, 0x08, 0x00, 0xC7, 0x10, 0x18, 0x07, 0x23, 0x80, 0x07,
+    0x40, 0x00, 0x1F, 0x00, 0x00, 0x87, 0x80, 0x60, 0x07, 0x86, 0x00, 0x07,
+    0x40, 0x00, 0x07, 0x00, 0x04, 0x07,
+    // 0x35 '5'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03,
+    0x08, 0x00, 0x03, 0x40, 0x00, 0x43, 0x80, 0x00, 0x0B, 0x82, 0x20, 0x0B,
+    0x80, 0x00, 0x03, 0x91, 0x02, 0x13, 0x90, 0x00, 0x03, 0x90, 0x00, 0x03,
+    0x90, 0x00, 0x43, 0x90, 0x21, 0x03, 0x90, 0x00, 0x03, 0x90, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x36 '6'
+    0x00, 0x0F, 0x83, 0x00, 0x40, 0x23, 0x01, 0x00, 0x03, 0x02, 0x00, 0x0B,
+    0x00, 0x0F, 0x03, 0x08, 0x00, 0x43, 0x10, 0x00, 0x03, 0x01, 0x20, 0x03,
+    0x02, 0x00, 0x03, 0x44, 0x00, 0x43, 0x00, 0x0F, 0x0B, 0x00, 0x80, 0x03,
+    0x80, 0x00, 0x03, 0x90, 0x40, 0x03, 0x80, 0x11, 0x03, 0x80, 0x00, 0x03,
+    0xA0, 0x00, 0x03, 0x40, 0x00, 0x03,
+    // 0x37 '7'
+    0x00, 0x00, 0x13, 0x20, 0x00, 0x83, 0x81, 0x02, 0x03, 0x82, 0x04, 0x07,
+    0x88, 0x00, 0x13, 0x80, 0x20, 0x43, 0x80, 0x41, 0x03, 0x80, 0x00, 0x03,
+    0x80, 0x08, 0x03, 0x84, 0x00, 0x03, 0x88, 0x40, 0x03, 0x80, 0x80, 0x03,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x38 '8'
+    0x00, 0x02, 0x23, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x09, 0x10, 0x03,
+    0x00, 0x02, 0x03, 0x00, 0x04, 0x03, 0x40, 0x08, 0x23, 0x09, 0x00, 0x23,
+    0x90, 0x00, 0x03, 0x80, 0x80, 0x03, 0x80, 0x00, 0x8B, 0x81, 0x00, 0x03,
+    0x84, 0x00, 0x13, 0x00, 0x00, 0x23, 0x00, 0x84, 0x83, 0x01, 0x00, 0x03,
+    0x1C, 0x00, 0x03,
+    // 0x39 '9'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x0C, 0x20, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x40, 0x00, 0x0B,
+    0x04, 0x44, 0x83, 0x80, 0x24, 0x13, 0x90, 0x24, 0x03, 0x80, 0x00, 0x23,
+    0x90, 0x00, 0x03, 0x88, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x02, 0x03,
+    0x00, 0x04, 0x03, 0x10, 0x10, 0x03, 0x03, 0x00, 0x03,
+    // 0x3A ':'
+    0x00, 0x00, 0x7F, 0x00, 0x08, 0x7F, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x7F,
+    0x00, 0x01, 0x7F, 0x80, 0x00, 0x7F, 0x88, 0x00, 0x7F, 0x10, 0x00, 0x7F,
+    0x00, 0x00, 0x7F,
+    // 0x3B ';'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x4F,
+    0x00, 0x08, 0x07, 0x00, 0x00, 0x07, 0x30, 0x00, 0x07, 0x00, 0x00, 0x87,
+    0x80, 0x00, 0x07, 0x88, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x3C '<'
+    0x00, 0x03, 0x04, 0x03, 0x00, 0x83, 0x08, 0x03, 0x00, 0x43, 0x12, 0x03,
+    0x01, 0x23, 0x24, 0x03, 0x00, 0x93, 0x48, 0x03, 0x00, 0x4B, 0x90, 0x03,
+    0x80, 0x27, 0x20, 0x13,
+    // 0x3D '='
+    0x00, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F,
+    0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F,
+    0x10, 0x3F, 0x12, 0x3F,
+    // 0x3E '>'
+    0x00, 0x03, 0x40, 0x0B, 0x90, 0x27, 0x00, 0x03, 0x48, 0x4B, 0x00, 0x03,
+    0x24, 0x13, 0x00, 0x03, 0x12, 0x23, 0x01, 0x03, 0x08, 0x43, 0x00, 0x03,
+    0x04, 0x83, 0x00, 0x03,
+    // 0x3F '?'
+    0x00, 0x00, 0x0D, 0x08, 0x01, 0x21, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+    0x80, 0x04, 0x29, 0x80, 0x05, 0x01, 0x8E, 0x06, 0x01, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x12, 0x00, 0x01,
+    // 0x40 '@'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x18, 0x08, 0x1F, 0x00, 0x40, 0x02, 0x1F,
+    0x01, 0x00, 0x00, 0x1F, 0x02, 0x0C, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x5F,
+    0x00, 0x80, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x00, 0x06, 0x41, 0x3F,
+    0x04, 0x20, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0x00, 0x3F,
+    0x01, 0x10, 0x10, 0x3F, 0x10, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x3F,
+    0x80, 0x02, 0x00, 0x1F, 0x80, 0x58, 0x21, 0x1F, 0x80, 0x00, 0x10, 0x5F,
+    0x80, 0x03, 0x80, 0x1F, 0x80, 0x10, 0x00, 0x9F, 0x90, 0x80, 0x10, 0x1F,
+    0x00, 0x00, 0x80, 0x1F, 0x08, 0x01, 0x00, 0x1F, 0x44, 0x04, 0x00, 0x1F,
+    0x00, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x02, 0x00, 0x1F,
+    0x01, 0xF0, 0x00, 0x1F,
+    // 0x41 'A'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x02, 0x0C, 0x03, 0x00, 0x24, 0x03,
+    0x10, 0x84, 0x03, 0x02, 0x04, 0x07, 0x03, 0x04, 0x03, 0x00, 0x08, 0x13,
+    0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x01, 0x80, 0x03, 0x00, 0x0C, 0x03,
+    0x00, 0x00, 0x63, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x42 'B'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11,
+    0x20, 0x00, 0x61, 0x00, 0x0C, 0x01, 0x41, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x61, 0x00, 0x06, 0x11, 0x00, 0xC8, 0x11, 0x18, 0x08, 0x11,
+    0x10, 0x08, 0x01, 0x10, 0x00, 0x25, 0x00, 0x02, 0x41, 0x02, 0x00, 0x01,
+    0x40, 0x00, 0x01, 0x00, 0x10, 0x11, 0x00, 0x88, 0x41, 0x04, 0x00, 0x01,
+    // 0x43 'C'
+    0x00, 0x00, 0x01, 0x00, 0x30, 0xC1, 0x00, 0x00, 0x11, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x80, 0x81, 0x20, 0x00, 0x41,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x21, 0x08, 0x00, 0x21, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x05, 0x00, 0x00, 0x41, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x11, 0x41, 0x00, 0x41, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x44 'D'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11,
+    0x20, 0x00, 0x61, 0x00, 0x0C, 0x01, 0x41, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x06, 0x01, 0x00, 0xC0, 0x01, 0x0C, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x05, 0x08, 0x00, 0x41,
+    0x00, 0x00, 0x89, 0x42, 0x02, 0x01, 0x00, 0x60, 0x01, 0x20, 0x00, 0x21,
+    0x10, 0x00, 0x41, 0x08, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x00, 0x00, 0x01,
+    // 0x45 'E'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x0C, 0x27, 0x01, 0x80, 0x27, 0x18, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47, 0x00, 0x00, 0x07,
+    0x00, 0x02, 0x07, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07, 0x04, 0x00, 0x07,
+    0xC0, 0x00, 0x07,
+    // 0x46 'F'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x04, 0x27, 0x00, 0xC0, 0x27, 0x18, 0x00, 0x17,
+    0x00, 0x00, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x07, 0x00, 0x40, 0x07,
+    0x1C, 0x20, 0x07, 0x02, 0x00, 0x07, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x07,
+    // 0x47 'G'
+    0x00, 0x00, 0x01, 0x00, 0x30, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0xC0, 0x81, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x40, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x05,
+    0x0B, 0x00, 0x01, 0x00, 0x00, 0x09, 0x41, 0x00, 0xC1, 0x06, 0x02, 0x01,
+    0x00, 0x08, 0x01,
+    // 0x48 'H'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x06, 0x27, 0x00, 0x80, 0x0F, 0x18, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x47, 0x40, 0x0C, 0x07, 0x20, 0x80, 0x07, 0x18, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x27, 0x00, 0x60, 0x07, 0x0C, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x49 'I'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x21, 0x80, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x06, 0x27, 0x00, 0xC0, 0x0F, 0x08, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x4A 'J'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x1F, 0x00, 0x00, 0x60, 0x5F,
+    0x80, 0x0C, 0x00, 0x9F, 0x20, 0xC0, 0x01, 0x1F, 0x18, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x30, 0x1F, 0x00, 0x03, 0x00, 0x1F, 0x00, 0x60, 0x00, 0x1F,
+    0x0C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0x4B 'K'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0xC3, 0x80, 0x18, 0x03, 0x23, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x43, 0x00, 0x0C, 0x23, 0x01, 0x88, 0x1B, 0x10, 0x82, 0x03,
+    0x21, 0x01, 0x03, 0x02, 0x00, 0x43, 0x80, 0x50, 0x23, 0x00, 0x80, 0x03,
+    0x41, 0x02, 0x0B, 0x20, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x4C 'L'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x04, 0x27, 0x00, 0xC0, 0x27, 0x18, 0x00, 0x07,
+    0x20, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x47, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x4D 'M'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x47,
+    0x00, 0x06, 0x07, 0x00, 0x20, 0x07, 0x81, 0x00, 0x67, 0x28, 0x02, 0x07,
+    0x00, 0x30, 0x17, 0x01, 0x00, 0x07, 0x06, 0x00, 0x07, 0x00, 0x18, 0x07,
+    0x00, 0x00, 0x47, 0x80, 0x00, 0x27, 0x03, 0x80, 0x07, 0x00, 0x10, 0x87,
+    0x00, 0x40, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x07, 0x08, 0x40, 0x07,
+    0x21, 0x00, 0x27, 0x84, 0x3C, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x03, 0xF8, 0x27, 0x20, 0x00, 0x27, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07,
+    // 0x4E 'N'
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0xC3,
+    0x80, 0x18, 0x03, 0x21, 0x00, 0x03, 0x10, 0x00, 0x43, 0x00, 0x06, 0x23,
+    0x00, 0xC0, 0x0B, 0x01, 0x00, 0x03, 0x80, 0x20, 0x03, 0x00, 0x08, 0x03,
+    0x08, 0x02, 0x03, 0x02, 0x00, 0x83, 0x00, 0x80, 0x03, 0x00, 0x10, 0x03,
+    0x00, 0x04, 0x03, 0x80, 0x18, 0x03, 0x23, 0x00, 0x03, 0x00, 0x00, 0x63,
+    0x00, 0x0C, 0x03, 0x00, 0xC0, 0x03, 0x18, 0x00, 0x03, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x4F 'O'
+    0x00, 0x00, 0x01, 0x00, 0x60, 0xC1, 0x01, 0x00, 0x01, 0x04, 0x00, 0x09,
+    0x08, 0x00, 0x01, 0x10, 0x00, 0x05, 0x00, 0x40, 0x81, 0x00, 0x00, 0x01,
+    0x44, 0x00, 0x01, 0x40, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x45, 0x08, 0x00, 0x01, 0x04, 0x02, 0x09,
+    0x40, 0x00, 0x11, 0x00, 0x00, 0x21, 0x20, 0x00, 0x41, 0x10, 0x00, 0x01,
+    0x04, 0x04, 0x01, 0x00, 0x00, 0x01,
+    // 0x50 'P'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13,
+    0x20, 0x00, 0x63, 0x00, 0x0C, 0x03, 0x41, 0x80, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x23, 0x00, 0x02, 0x13, 0x00, 0xD0, 0x13, 0x08, 0x00, 0x0B,
+    0x10, 0x10, 0x03, 0x00, 0x00, 0x03, 0x08, 0x04, 0x03, 0x07, 0x80, 0x03,
+    0x40, 0x08, 0x03, 0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0x10, 0x40, 0x03,
+    0x00, 0x00, 0x03,
+    // 0x51 'Q'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0xC0, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x04, 0x00, 0x08, 0x07, 0x08, 0x00, 0x04, 0x07, 0x10, 0x00, 0x00, 0x07,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x21, 0x07, 0x44, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x02, 0x47, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x00, 0x24, 0x27, 0x00, 0x00, 0x41, 0x07, 0x08, 0x00, 0x88, 0x07,
+    0x04, 0x02, 0x00, 0x17, 0x40, 0x00, 0x10, 0x07, 0x00, 0x00, 0x20, 0x87,
+    0x20, 0x00, 0x40, 0x87, 0x10, 0x00, 0x00, 0x0F, 0x04, 0x04, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07,
+    // 0x52 'R'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11,
+    0x20, 0x00, 0x61, 0x00, 0x0C, 0x01, 0x41, 0x80, 0x01, 0x48, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x02, 0x11, 0x00, 0xC0, 0x0D, 0x08, 0x01, 0x01,
+    0x10, 0x00, 0x41, 0x10, 0x20, 0x01, 0x00, 0x44, 0x09, 0x05, 0x88, 0x01,
+    0x40, 0x00, 0x81, 0x00, 0x00, 0x41, 0x20, 0x00, 0x21, 0x10, 0x80, 0x11,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
+    // 0x53 'S'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x01, 0x00, 0x02, 0x05,
+    0x08, 0x41, 0x81, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01, 0x40, 0x08, 0x01,
+    0x09, 0x00, 0x01, 0x00, 0x80, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x05,
+    0x00, 0x20, 0x01, 0x0E, 0x10, 0x01, 0x01, 0x08, 0x01, 0x40, 0x03, 0x81,
+    0x0C, 0x00, 0x01, 0x00, 0x00, 0x01,
+    // 0x54 'T'
+    0x32, 0x00, 0x07, 0x80, 0x00, 0x17, 0x02, 0x00, 0x07, 0x10, 0x00, 0x27,
+    0x00, 0x01, 0x87, 0x00, 0x30, 0x07, 0x03, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x0C, 0x27, 0x01, 0x80, 0x1F, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x02, 0x00, 0x07, 0xB0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0x55 'U'
+    0x00, 0x01, 0x03, 0xA0, 0x30, 0x23, 0x26, 0x00, 0x03, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x00, 0x18, 0x83, 0x01, 0x00, 0x43, 0x10, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x03, 0x40, 0x04, 0x13, 0x20, 0xC0, 0x03, 0x18, 0x00, 0x43,
+    0x00, 0x01, 0x03, 0x00, 0x0C, 0x03, 0x01, 0x80, 0x03, 0x10, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x56 'V'
+    0x00, 0x00, 0x03, 0xA0, 0x00, 0x03, 0x20, 0x00, 0x03, 0x0C, 0x00, 0x03,
+    0x00, 0x70, 0x03, 0x00, 0x01, 0x83, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03,
+    0x20, 0x78, 0x03, 0x00, 0x01, 0x03, 0x80, 0x00, 0x13, 0x00, 0x08, 0x03,
+    0x00, 0x20, 0x83, 0x00, 0x82, 0x03, 0x82, 0x08, 0x03, 0x28, 0x00, 0x03,
+    0x00, 0x40, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x03, 0xC0, 0x00, 0x03,
+    // 0x57 'W'
+    0x40, 0x00, 0x03, 0x20, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x00, 0x03, 0xC3,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x20, 0x02, 0x0B,
+    0x00, 0x08, 0x23, 0xC0, 0x20, 0x83, 0x00, 0x82, 0x03, 0x02, 0x08, 0x03,
+    0x08, 0x20, 0x03, 0x20, 0x40, 0x03, 0x80, 0x00, 0xFB, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x06, 0x03, 0x00, 0x04, 0x13, 0x00, 0x10, 0x43,
+    0x00, 0x01, 0x03, 0x40, 0x04, 0x03, 0x28, 0x10, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+    // 0x58 'X'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x47, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x22, 0x07, 0x00, 0x04, 0x07,
+    0x04, 0x02, 0x17, 0xC1, 0x00, 0x87, 0x00, 0x00, 0x07, 0x04, 0x50, 0x07,
+    0x48, 0x84, 0x07, 0x31, 0x01, 0x07, 0x02, 0x00, 0x47, 0x04, 0x00, 0x27,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07,
+    // 0x59 'Y'
+    0x00, 0x00, 0x07, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x17, 0x04, 0x00, 0x07,
+    0x00, 0x80, 0x27, 0x00, 0x11, 0x87, 0x00, 0x00, 0x07, 0x2C, 0x00, 0x07,
+    0x01, 0x80, 0x07, 0xC0, 0x40, 0x47, 0x00, 0x84, 0x27, 0x00, 0x10, 0x1F,
+    0x44, 0x00, 0x07, 0x20, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x07, 0x10, 0x00, 0x07, 0x20, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x07,
+    // 0x5A 'Z'
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x83, 0x1C, 0x00, 0x03,
+    0x82, 0x00, 0x03, 0x02, 0x00, 0x03, 0x08, 0x10, 0x43, 0x00, 0x20, 0xA3,
+    0x00, 0x01, 0x23, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x04, 0x10, 0x03,
+    0x08, 0x20, 0x03, 0x00, 0x40, 0x43, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x13, 0x88, 0x01, 0x83, 0x90, 0x00, 0x03, 0x00, 0x00, 0x03,
+    // 0x5B '['
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x0C, 0x0F,
+    0x00, 0x00, 0x80, 0x0F, 0x00, 0x18, 0x00, 0x0F, 0x01, 0x80, 0x03, 0x0F,
+    0x10, 0x00, 0x20, 0x0F, 0x80, 0x06, 0x00, 0x37, 0x80, 0x60, 0x00, 0x07,
+    0x84, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07,
+    // 0x5C '\'
+    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x40, 0x20, 0x00, 0x18, 0x0C, 0x00, 0x02, 0x01, 0x00, 0x00, 0x40, 0x20,
+    0x00, 0x08, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x02,
+    // 0x5D ']'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x18, 0x0F,
+    0x20, 0x01, 0x00, 0x0F, 0x80, 0x30, 0x00, 0x67, 0x83, 0x00, 0x06, 0x07,
+    0x80, 0x00, 0x40, 0x07, 0x80, 0x0C, 0x00, 0x07, 0x80, 0xC0, 0x00, 0x07,
+    0x88, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x5E '^'
+    0x00, 0x07, 0x00, 0x13, 0x00, 0x83, 0x02, 0x03, 0x10, 0x09, 0x40, 0x41,
+    0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x20, 0x21, 0x08, 0x05, 0x01, 0x03,
+    0x00, 0x43, 0x00, 0x0B, 0x00, 0x01,
+    // 0x5F '_'
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F,
+    // 0x60 '`'
+    0x10, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x20, 0x7F, 0x01, 0x7F, 0x04, 0x7F,
+    0x00, 0x7F,
+    // 0x61 'a'
+    0x00, 0x00, 0x3F, 0x00, 0xC1, 0x3F, 0x02, 0x00, 0xBF, 0x08, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x20, 0x84, 0x3F, 0x02, 0x00, 0xBF, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x24, 0x3F, 0x40, 0x87, 0x3F, 0x04, 0x00, 0x3F,
+    0x20, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x41, 0x84, 0xBF, 0x08, 0x00, 0x3F,
+    0x40, 0x08, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x62 'b'
+    0x00, 0x00, 0x03, 0x7F, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x01, 0x80, 0x7F,
+    0x40, 0x30, 0x01, 0x7F, 0x46, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x38, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x82, 0x04, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x90, 0x20, 0x7F, 0x00, 0x0B, 0x82, 0x7F,
+    0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x33, 0x00, 0x7F,
+    // 0x63 'c'
+    0x00, 0x00, 0x3F, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x21, 0x88, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x04, 0xBF, 0x00, 0x00, 0x3F, 0x08, 0x09, 0x3F, 0x44, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x64 'd'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x41, 0x08, 0x7F,
+    0x00, 0x04, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x48, 0x7F, 0x30, 0x81, 0x0E, 0x7F, 0x40, 0x08, 0x00, 0x7F,
+    0x41, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x09, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x02, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x65 'e'
+    0x00, 0x00, 0x3F, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x22, 0x10, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x3F,
+    0x11, 0x00, 0xBF, 0x02, 0x40, 0x3F, 0x00, 0x09, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x0C, 0x3F, 0x18, 0x00, 0x3F,
+    // 0x66 'f'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x04,
+    0x00, 0x03, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x02, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x18, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x06, 0x80, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x90, 0xA0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x67 'g'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x07, 0x81, 0x48, 0x7F,
+    0x00, 0x08, 0x00, 0x7F, 0x00, 0x20, 0x84, 0x7F, 0x00, 0x00, 0x84, 0x7F,
+    0x44, 0x00, 0x04, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x10, 0x12, 0x01, 0x7F,
+    0x00, 0x80, 0x29, 0x7F, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x40, 0x40, 0x84, 0x7F, 0x40, 0x80, 0x40, 0x7F, 0x56, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x7F,
+    // 0x68 'h'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x18, 0x7F, 0x00, 0x03, 0x00, 0x7F,
+    0x40, 0x30, 0x00, 0x7F, 0x42, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x18, 0x7F,
+    0x00, 0x00, 0x80, 0x7F, 0x00, 0x52, 0x00, 0x7F, 0x06, 0x20, 0x00, 0x7F,
+    0x00, 0x40, 0x06, 0x7F, 0x00, 0x10, 0x40, 0x7F, 0x00, 0x96, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x81, 0x7F,
+    0x00, 0x7C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x69 'i'
+    0x00, 0x80, 0x1C, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00,
+    0x48, 0x00, 0x30, 0x80, 0x03, 0x12, 0x01, 0x30, 0x00, 0x88, 0x00, 0x18,
+    0x70, 0x00, 0x00,
+    // 0x6A 'j'
+    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x10, 0x01,
+    0x00, 0x03, 0x00, 0x01, 0x01, 0x20, 0x00, 0x41, 0x30, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x01, 0x08, 0xC0, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x6B 'k'
+    0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x18, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x40, 0x30, 0x00, 0x7F, 0x43, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x12, 0x20, 0x7F, 0x00, 0x80, 0x08, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x00, 0x82, 0x10, 0x7F, 0x00, 0x04, 0x88, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x04, 0x7F, 0x00, 0x04, 0x05, 0x7F,
+    0x00, 0x00, 0x00, 0x7F,
+    // 0x6C 'l'
+    0x00, 0x00, 0x11, 0x7F, 0x00, 0x03, 0x00, 0x7F, 0x40, 0x30, 0x00, 0x7F,
+    0x46, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x38, 0x7F, 0x00, 0x06, 0x08, 0x7F,
+    0x00, 0x60, 0x02, 0x7F, 0x04, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x6D 'm'
+    0x00, 0x00, 0x3F, 0x20, 0x01, 0xBF, 0x00, 0x10, 0x3F, 0x43, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x00, 0x03, 0x3F, 0x00, 0x30, 0x3F, 0x38, 0x80, 0x3F,
+    0x02, 0x00, 0x3F, 0x04, 0x01, 0xBF, 0x08, 0x18, 0x3F, 0x49, 0x80, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x03, 0x3F, 0x40, 0x30, 0x3F, 0x38, 0x80, 0x3F,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x18, 0xBF, 0x49, 0x80, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x30, 0xBF, 0x03, 0x04, 0x3F,
+    0x00, 0x01, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x6E 'n'
+    0x00, 0x00, 0x3F, 0x20, 0x01, 0xBF, 0x00, 0x10, 0x3F, 0x43, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x10, 0x3F, 0x48, 0x80, 0x3F,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x0D, 0x3F, 0x40, 0xC0, 0x3F,
+    0x04, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x1C, 0x3F, 0x40, 0x84, 0xBF,
+    0x18, 0x00, 0x3F, 0x00, 0x06, 0x3F,
+    // 0x6F 'o'
+    0x00, 0x00, 0x3F, 0x01, 0x82, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x21, 0x04, 0x3F, 0x04, 0x00, 0x3F, 0x48, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x08, 0x10, 0x3F, 0x00, 0x01, 0x3F,
+    0x40, 0x02, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x10, 0x3F, 0x02, 0x00, 0x3F,
+    // 0x70 'p'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x19,
+    0x00, 0x01, 0x01, 0x00, 0x30, 0x01, 0x46, 0x00, 0x01, 0x00, 0x00, 0x31,
+    0x00, 0x00, 0x85, 0x00, 0x20, 0x05, 0x38, 0x02, 0x00, 0x12, 0x00, 0x00,
+    0x20, 0x04, 0x00, 0x08, 0x08, 0x80, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x20, 0x60, 0x00, 0x00, 0x00, 0x00,
+    // 0x71 'q'
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x02, 0x00, 0x80, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x03, 0x00, 0x00, 0x81, 0x40, 0x00, 0x05,
+    0x00, 0x00, 0x09, 0x00, 0x24, 0x81, 0x40, 0x84, 0x01, 0x04, 0x00, 0x01,
+    0x20, 0x00, 0x39, 0x40, 0x0C, 0x05, 0x41, 0x80, 0x00, 0x08, 0x00, 0x00,
+    0x40, 0x00, 0x00,
+    // 0x72 'r'
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0xFF, 0x00, 0x18, 0x7F, 0x41, 0x80, 0x7F,
+    0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x08, 0x7F, 0x4C, 0x40, 0x7F,
+    0x09, 0x00, 0x7F, 0x02, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x40, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x04, 0x00, 0x7F, 0x30, 0x00, 0x7F,
+    // 0x73 's'
+    0x00, 0x00, 0x3F, 0x00, 0x09, 0x3F, 0x00, 0x00, 0x3F, 0x0E, 0x10, 0x3F,
+    0x10, 0x80, 0x3F, 0x20, 0x40, 0x3F, 0x00, 0x02, 0x3F, 0x40, 0x02, 0x3F,
+    0x00, 0x0C, 0x3F, 0x01, 0x00, 0xBF, 0x00, 0x81, 0x3F, 0x00, 0x42, 0x3F,
+    0x40, 0x18, 0x3F, 0x10, 0x00, 0x3F,
+    // 0x74 't'
+    0x00, 0x00, 0x07, 0x04, 0x00, 0x07, 0x00, 0x06, 0x07, 0x00, 0xC0, 0x07,
+    0x08, 0x00, 0x07, 0x40, 0x00, 0x07, 0x00, 0x06, 0x87, 0x80, 0xC0, 0x07,
+    0x90, 0x00, 0x97, 0x08, 0x00, 0x07, 0x08, 0x00, 0x07, 0x08, 0x01, 0x87,
+    0x04, 0x00, 0x07,
+    // 0x75 'u'
+    0x00, 0x00, 0x7F, 0x00, 0x0E, 0x7F, 0x00, 0x81, 0x7F, 0x8C, 0x00, 0x7F,
+    0x00, 0x00, 0x7F, 0x00, 0x38, 0x7F, 0x01, 0x01, 0x7F, 0x78, 0x08, 0x7F,
+    0x00, 0x10, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x7F, 0x06, 0x01, 0x7F,
+    0x40, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x68, 0x7F, 0x0C, 0x08, 0x7F,
+    0xC0, 0x02, 0x7F, 0x00, 0x04, 0x7F,
+    // 0x76 'v'
+    0x10, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x44, 0x00, 0x3F,
+    0x00, 0x78, 0x3F, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x0E, 0x00, 0xBF,
+    0x00, 0x08, 0x3F, 0x00, 0x22, 0x3F, 0x20, 0x84, 0x3F, 0x40, 0x08, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x40, 0x3F, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x77 'w'
+    0x10, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x44, 0x00, 0x3F,
+    0x00, 0xE0, 0x3F, 0x40, 0x00, 0x3F, 0x20, 0x00, 0x3F, 0x07, 0x00, 0xBF,
+    0x00, 0x09, 0x3F, 0x00, 0x22, 0x3F, 0x50, 0x80, 0x3F, 0x00, 0x10, 0x3F,
+    0x00, 0x1F, 0x3F, 0x40, 0x00, 0x3F, 0x18, 0x00, 0x3F, 0x00, 0x70, 0xBF,
+    0x00, 0x11, 0x3F, 0x20, 0x42, 0x3F, 0x4E, 0x00, 0x3F, 0x00, 0x10, 0x3F,
+    0x00, 0x40, 0x3F, 0x43, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x78 'x'
+    0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x10, 0x04, 0x3F, 0x08, 0x00, 0x3F,
+    0x00, 0x04, 0x3F, 0x48, 0x08, 0x3F, 0x02, 0x00, 0x3F, 0x00, 0xC4, 0x3F,
+    0x00, 0x08, 0x3F, 0x18, 0x04, 0x3F, 0x00, 0x00, 0xBF, 0x08, 0x80, 0x3F,
+    0x00, 0x10, 0x3F, 0x04, 0x04, 0x3F, 0x48, 0x00, 0x3F, 0x08, 0x00, 0xBF,
+    0x08, 0x00, 0x3F, 0x48, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x79 'y'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x7F, 0x10, 0x00, 0x08, 0x7F,
+    0x00, 0x00, 0x09, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x44, 0x00, 0x00, 0x7F,
+    0x00, 0x60, 0x44, 0x7F, 0x40, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x10, 0x7F,
+    0x0E, 0x00, 0x20, 0x7F, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x20, 0xC2, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x03, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x7A 'z'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x04, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x40, 0x01, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x08, 0x3F, 0x48, 0x14, 0xBF,
+    0x40, 0x24, 0x3F, 0x04, 0x40, 0x3F, 0x20, 0x80, 0x3F, 0x01, 0x00, 0x3F,
+    0x02, 0x10, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    // 0x7B '{'
+    0x00, 0x00, 0x00, 0xC3, 0x00, 0x04, 0x04, 0x03, 0x00, 0x08, 0x20, 0x0B,
+    0x00, 0x00, 0x00, 0x03, 0x07, 0x80, 0x04, 0x03, 0x00, 0x04, 0x20, 0x03,
+    0x00, 0x08, 0x00, 0x0B, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x40, 0x00, 0x00, 0x03,
+    // 0x7C '|'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x30, 0x3F,
+    0x00, 0x03, 0x00, 0x3F, 0x00, 0x60, 0x00, 0xDF, 0x0C, 0x00, 0x18, 0x1F,
+    0x80, 0x03, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x1F, 0x06, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x00, 0x1F,
+    // 0x7D '}'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x8B,
+    0x40, 0x00, 0x40, 0x03, 0x80, 0x1C, 0x00, 0x23, 0x00, 0x80, 0x00, 0x83,
+    0x16, 0x00, 0x20, 0x03, 0x80, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x03,
+    0x06, 0x00, 0x00, 0x03,
+    // 0x7E '~'
+    0x1B, 0x47, 0x07, 0x93, 0x83, 0x93, 0x03, 0x43, 0x03, 0x27, 0x27, 0x07,
+    0x83, 0x03, 0x23,
+    // 0xA1 '¡'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x21, 0x00, 0x01, 0x01,
+    0x00, 0x18, 0x03, 0x41, 0x80, 0x05, 0x88, 0x00, 0x31, 0x0A, 0x1C, 0x01,
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x01,
+    // 0xA2 '¢'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x10, 0x03, 0x00, 0x10, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x0B, 0x00, 0x88, 0x20, 0xC7,
+    0x00, 0x10, 0x10, 0x07, 0x01, 0x20, 0x80, 0x33, 0x00, 0x18, 0x00, 0x03,
+    0x02, 0x00, 0xC2, 0x03, 0x30, 0x08, 0x02, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x0C, 0x00, 0x24, 0x03, 0x40, 0x20, 0x08, 0x03, 0x01, 0x00, 0x30, 0x03,
+    0x00, 0xC0, 0x00, 0x03,
+    // 0xA3 '£'
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x47, 0x00, 0x00, 0x47, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x83, 0x00, 0x08, 0x03, 0x00, 0xC0, 0x03, 0x02, 0x00, 0x43,
+    0x08, 0x01, 0x0B, 0x00, 0x08, 0x0B, 0x01, 0x80, 0x03, 0x04, 0x00, 0x03,
+    0x10, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x90, 0x20, 0x43,
+    0x80, 0x00, 0x4B, 0x00, 0x00, 0x63, 0x40, 0x00, 0x03, 0x18, 0x00, 0x03,
+    // 0xA4 '¤'
+    0x00, 0x09, 0x00, 0x03, 0x00, 0x11, 0x01, 0xE1, 0x44, 0x09, 0x20, 0x01,
+    0x00, 0x05, 0x24, 0x05, 0x20, 0x05, 0x08, 0x05, 0x08, 0x21, 0x00, 0x41,
+    0x20, 0x01, 0x00, 0x05, 0x20, 0x53, 0x08, 0x09, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01,
+    // 0xA5 '¥'
+    0x60, 0x00, 0x07, 0x80, 0x64, 0x0F, 0x88, 0x0A, 0x07, 0x82, 0x02, 0x07,
+    0x80, 0x02, 0x27, 0x80, 0x19, 0x07, 0x90, 0x00, 0x07, 0x82, 0x00, 0x07,
+    0xA0, 0x40, 0x07, 0x40, 0x00, 0x27, 0x01, 0x0A, 0x07, 0x00, 0x0A, 0x07,
+    0xA8, 0x0A, 0x07, 0x80, 0x0A, 0x07, 0x82, 0x0C, 0x07, 0x84, 0x60, 0x07,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    0x00, 0x00, 0x07,
+    // 0xA7 '§'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x08, 0x00, 0x00,
+    0x12, 0x00, 0x01, 0x21, 0x00, 0x01, 0x00, 0x81, 0x01, 0x14, 0x40, 0x81,
+    0x00, 0x20, 0x48, 0x80, 0x02, 0x02, 0x80, 0x00, 0x00, 0x80, 0x44, 0x40,
+    0x04, 0x20, 0x00, 0x04, 0x10, 0x20, 0x30, 0x00, 0x00,
+    // 0xA9 '©'
+    0x00, 0x00, 0x01, 0x00, 0x83, 0x01, 0x00, 0x10, 0x41, 0x09, 0x01, 0x21,
+    0x10, 0x00, 0x41, 0x00, 0x00, 0x29, 0x00, 0x42, 0x11, 0x11, 0x00, 0x05,
+    0x40, 0x00, 0x09, 0x20, 0x00, 0x09, 0x20, 0x00, 0x43, 0x25, 0x00, 0x43,
+    0x25, 0x01, 0x43, 0x20, 0x81, 0x41, 0x00, 0x40, 0x09, 0x43, 0x01, 0x81,
+    0x10, 0x00, 0x15, 0x28, 0x00, 0x01, 0x04, 0x00, 0x01, 0x02, 0x00, 0x91,
+    0x04, 0x66, 0x01, 0x01, 0x00, 0x81, 0x00, 0x38, 0x01,
+    // 0xAA 'ª'
+    0x00, 0x02, 0x06, 0x40, 0x10, 0x00, 0x00, 0x00, 0x48, 0x80, 0x10, 0xA0,
+    0x01, 0x40, 0x04, 0x20, 0x40, 0x00, 0x03, 0x8A, 0x10, 0xAC, 0x40, 0x40,
+    0x00, 0x00,
+    // 0xAB '«'
+    0x07, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x02, 0x1F, 0x40, 0x8F,
+    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x4F, 0x10, 0x2F, 0x20, 0x0F,
+    0x05, 0x0F, 0x08, 0x5F, 0x10, 0x0F, 0x20, 0x0F, 0x00, 0x0F,
+    // 0xAE '®'
+    0x00, 0x00, 0x7F, 0x04, 0x10, 0x7F, 0x03, 0xE4, 0x7F, 0x08, 0x0A, 0x7F,
+    0x10, 0x04, 0x7F, 0x4C, 0x1A, 0x7F, 0x28, 0x08, 0x7F, 0x08, 0x08, 0x7F,
+    0x0C, 0x58, 0xFF, 0x09, 0x00, 0xFF, 0x20, 0xC0, 0x7F, 0x67, 0x0A, 0x7F,
+    0x00, 0x19, 0x7F, 0x20, 0x00, 0x7F, 0x14, 0x10, 0x7F, 0x08, 0x08, 0x7F,
+    0x01, 0xC0, 0x7F,
+    // 0xB0 '°'
+    0x04, 0x1F, 0x20, 0x9F, 0x40, 0x5F, 0x0C, 0x1F, 0x91, 0x3F, 0x80, 0x3F,
+    0x80, 0x3F, 0x91, 0x3F, 0x04, 0x1F, 0x40, 0x5F, 0x20, 0x1F, 0x00, 0x1F,
+    // 0xB1 '±'
+    0x00, 0x00, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    0x04, 0x01, 0x1F, 0x04, 0x81, 0x1F, 0x80, 0x05, 0x1F, 0x80, 0x05, 0x1F,
+    0x80, 0x05, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    0x04, 0x01, 0x1F, 0x04, 0x01, 0x1F,
+    // 0xB2 '²'
+    0x00, 0x03, 0x00, 0x17, 0x00, 0x23, 0x20, 0x03, 0x48, 0x03, 0x10, 0x13,
+    0x81, 0x13, 0xA2, 0x53, 0x84, 0x93, 0x80, 0x17, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x03,
+    // 0xB3 '³'
+    0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x48, 0x81, 0x12, 0x11, 0x80, 0x01,
+    0xA4, 0xA5, 0x88, 0x01, 0x82, 0x01, 0x04, 0x21, 0x38, 0x01,
+    // 0xB5 'µ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x06, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x0E, 0x00, 0x7F, 0x03, 0x80, 0x00, 0x7F, 0x20, 0x00, 0xF8, 0x7F,
+    0x40, 0x00, 0x80, 0x7F, 0x40, 0x38, 0x00, 0x7F, 0x06, 0x04, 0x00, 0x7F,
+    0x60, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x80, 0x7F, 0x00, 0x09, 0x00, 0x7F,
+    0x00, 0x62, 0x00, 0x7F, 0x0C, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x40, 0x00, 0x00, 0x7F, 0x00, 0xC4, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x00, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xB6 '¶'
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x01, 0xE0, 0x00, 0x3F, 0x08, 0x08, 0x00, 0x3F, 0x10, 0x00, 0x02, 0x3F,
+    0x20, 0x04, 0x00, 0x3F, 0x00, 0x04, 0x61, 0x3F, 0x00, 0x04, 0x01, 0x3F,
+    0x00, 0x00, 0x35, 0x3F, 0x80, 0x02, 0x08, 0x3F, 0x80, 0x60, 0x60, 0x3F,
+    0x8C, 0x0C, 0x00, 0x3F, 0xA1, 0x80, 0x20, 0x3F, 0x10, 0x06, 0x00, 0x3F,
+    0x00, 0xC0, 0x00, 0x3F, 0x18, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
+    // 0xB7 '·'
+    0x37, 0x0F, 0x8F, 0x0F, 0x17, 0x07,
+    // 0xB9 '¹'
+    0x00, 0x03, 0x00, 0x0B, 0x20, 0x03, 0x50, 0x13, 0x51, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x81, 0x03, 0x30, 0x0F, 0x00, 0x03,
+    // 0xBA 'º'
+    0x00, 0x02, 0x00, 0x00, 0x08, 0x40, 0x00, 0x20, 0x03, 0x80, 0x48, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x06, 0x0A, 0x00, 0x48, 0x40, 0x00, 0x1C, 0x00,
+    // 0xBB '»'
+    0x00, 0x0F, 0x00, 0x2F, 0x00, 0x4F, 0x20, 0x9F, 0x09, 0x0F, 0x00, 0x0F,
+    0x00, 0x4F, 0x00, 0x8F, 0x01, 0x0F, 0x04, 0x1F, 0x40, 0x0F, 0x10, 0x1F,
+    0x04, 0x2F, 0x40, 0x0F, 0x20, 0x0F, 0x10, 0x0F, 0x09, 0x0F, 0x00, 0x0F,
+    // 0xBC '¼'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x28, 0x0A, 0x00,
+    0x09, 0x82, 0x00, 0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x41, 0x8A, 0x04,
+    0x18, 0x04, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x10, 0x00,
+    0x00, 0x44, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x80,
+    0x00, 0x81, 0x00, 0x20, 0x02, 0x00, 0x04, 0x04, 0x80, 0x88, 0x09, 0x00,
+    0x00, 0x10, 0x14, 0x00, 0x20, 0x80, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x83, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    // 0xBD '½'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x28, 0x0A, 0x00,
+    0x09, 0x82, 0x00, 0x00, 0x02, 0x00, 0x40, 0x02, 0x06, 0x41, 0x8A, 0x00,
+    0x18, 0x04, 0x21, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14,
+    0x02, 0x10, 0x00, 0x84, 0x20, 0x00, 0x80, 0x48, 0x00, 0x60, 0x10, 0x90,
+    0x00, 0x01, 0x10, 0x00, 0x82, 0x50, 0x00, 0x94, 0x90, 0x00, 0x00, 0x10,
+    0x00, 0x40, 0x14, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+    // 0xBE '¾'
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x09, 0x08, 0x00, 0x40, 0x02, 0x00, 0x52, 0x50, 0x00, 0x44, 0x00, 0x06,
+    0x41, 0x00, 0x00, 0x02, 0x90, 0x21, 0x1C, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x80,
+    0x10, 0x01, 0x00, 0x02, 0x02, 0x00, 0x84, 0x04, 0x80, 0x80, 0x09, 0x00,
+    0x60, 0x10, 0x14, 0x00, 0x20, 0x80, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x83, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    // 0xBF '¿'
+    0x00, 0x00, 0xE1, 0x00, 0x02, 0x09, 0x00, 0x04, 0x05, 0x00, 0x88, 0xC1,
+    0x00, 0x10, 0x21, 0x32, 0x00, 0x21, 0x8A, 0x40, 0x21, 0x0A, 0x00, 0x05,
+    0x00, 0x00, 0x41, 0x60, 0x80, 0x01,
+    // 0xC0 'À'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x0C, 0x03, 0x48, 0x00, 0x24, 0x03,
+    0x00, 0x10, 0x84, 0x03, 0x04, 0x02, 0x04, 0x07, 0x00, 0x03, 0x04, 0x03,
+    0x12, 0x00, 0x08, 0x13, 0x08, 0x00, 0x00, 0x03, 0x04, 0x30, 0x00, 0x03,
+    0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x63,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xC1 'Á'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x0C, 0x03, 0x00, 0x00, 0x24, 0x03,
+    0x06, 0x10, 0x84, 0x03, 0x08, 0x02, 0x04, 0x07, 0x02, 0x03, 0x04, 0x03,
+    0x00, 0x00, 0x08, 0x13, 0x20, 0x00, 0x00, 0x03, 0x04, 0x30, 0x00, 0x03,
+    0x40, 0x01, 0x80, 0x03, 0x68, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x63,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xC2 'Â'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x00, 0x07, 0x08, 0x04, 0x18, 0x07, 0x10, 0x00, 0x48, 0x07,
+    0x04, 0x21, 0x08, 0x07, 0x00, 0x04, 0x08, 0x0F, 0x00, 0x06, 0x08, 0x07,
+    0x80, 0x00, 0x10, 0x27, 0x10, 0x00, 0x00, 0x07, 0x88, 0x60, 0x00, 0x07,
+    0x44, 0x03, 0x00, 0x07, 0x04, 0x00, 0x18, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xC3 'Ã'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x01, 0x00, 0x07, 0x18, 0x04, 0x18, 0x07, 0x00, 0x00, 0x48, 0x07,
+    0x08, 0x21, 0x08, 0x07, 0x10, 0x04, 0x08, 0x0F, 0x00, 0x06, 0x08, 0x07,
+    0x40, 0x00, 0x10, 0x27, 0x20, 0x00, 0x00, 0x07, 0x20, 0x60, 0x00, 0x07,
+    0x40, 0x03, 0x00, 0x07, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0xC4 'Ä'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x02, 0x00, 0x0F, 0x30, 0x08, 0x30, 0x0F, 0x08, 0x00, 0x90, 0x0F,
+    0x88, 0x42, 0x10, 0x0F, 0x80, 0x08, 0x10, 0x1F, 0x60, 0x0C, 0x10, 0x0F,
+    0x00, 0x00, 0x20, 0x4F, 0x10, 0x00, 0x00, 0x0F, 0x08, 0xC0, 0x00, 0x0F,
+    0x88, 0x06, 0x00, 0x0F, 0x80, 0x00, 0x30, 0x0F, 0x60, 0x00, 0x01, 0x8F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    // 0xC5 'Å'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x0C, 0x03, 0x08, 0x00, 0x24, 0x03,
+    0x02, 0x10, 0x84, 0x03, 0x09, 0x02, 0x04, 0x07, 0x05, 0x03, 0x04, 0x03,
+    0xA1, 0x00, 0x08, 0x13, 0x05, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x03,
+    0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x63,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xC6 'Æ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x04, 0x27,
+    0x00, 0x08, 0x0F, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x01, 0x18, 0x17, 0x02, 0x28, 0x07, 0x00, 0x08, 0x27, 0x01, 0x08, 0xC7,
+    0x02, 0x18, 0x07, 0x00, 0x80, 0x07, 0x0C, 0x00, 0x07, 0x00, 0x01, 0x87,
+    0x00, 0x00, 0x27, 0x03, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x87, 0x00, 0x10, 0x07, 0x10, 0x42, 0x17,
+    0x00, 0x01, 0x87, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x07, 0x00, 0x00, 0x07,
+    // 0xC7 'Ç'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0xC0, 0x03, 0x00, 0x00, 0x10, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x03,
+    0x00, 0x80, 0x80, 0x0B, 0x20, 0x00, 0x40, 0x43, 0x00, 0x00, 0x01, 0x47,
+    0x40, 0x00, 0x21, 0x03, 0x08, 0x00, 0x20, 0x03, 0x00, 0x00, 0x20, 0xE3,
+    0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x40, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x10, 0x03, 0x41, 0x00, 0x40, 0x03,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0xC8 'È'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x00, 0x11, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x06, 0x13, 0x08, 0x00, 0xC0, 0x13, 0x00, 0x0C, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03,
+    // 0xC9 'É'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x00, 0x11, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x06, 0x13, 0x00, 0x00, 0xC0, 0x13, 0x00, 0x0C, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x01, 0x03, 0x40, 0x00, 0x00, 0x13,
+    0x48, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03,
+    // 0xCA 'Ê'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x80, 0x18, 0x07,
+    0x00, 0x23, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47,
+    0x0C, 0x00, 0x0C, 0x27, 0x00, 0x01, 0x80, 0x27, 0x00, 0x18, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x47,
+    0x10, 0x00, 0x00, 0x07, 0x88, 0x00, 0x02, 0x07, 0x44, 0x00, 0x00, 0x27,
+    0x20, 0x00, 0x00, 0x07, 0x08, 0x04, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x07,
+    // 0xCB 'Ë'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x8F, 0x01, 0x00, 0x30, 0x0F,
+    0x00, 0x46, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x30, 0x00, 0x18, 0x4F, 0x08, 0x03, 0x00, 0x4F, 0x88, 0x30, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x8F,
+    0x30, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x04, 0x0F, 0x88, 0x00, 0x00, 0x4F,
+    0x80, 0x00, 0x00, 0x0F, 0x60, 0x08, 0x00, 0x0F, 0x01, 0x80, 0x00, 0x0F,
+    // 0xCC 'Ì'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x28, 0x10, 0xC0, 0x03, 0x00, 0x08, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x03, 0x13, 0x12, 0x00, 0x60, 0x07, 0x02, 0x04, 0x00, 0x03,
+    0x02, 0x10, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xCD 'Í'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x00, 0x10, 0xC0, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x03, 0x13, 0x12, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x03,
+    0x04, 0x10, 0x00, 0x03, 0x40, 0x10, 0x00, 0x03, 0x48, 0x60, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xCE 'Î'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xC7, 0x04, 0x80, 0x18, 0x07,
+    0x00, 0x21, 0x80, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x08, 0x00, 0x06, 0x27, 0x90, 0x00, 0xC0, 0x0F, 0x00, 0x08, 0x00, 0x07,
+    0x80, 0x20, 0x00, 0x07, 0x44, 0x20, 0x00, 0x07, 0x20, 0xC0, 0x00, 0x07,
+    0x08, 0x00, 0x00, 0x07,
+    // 0xCF 'Ï'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x8F, 0x01, 0x00, 0x30, 0x0F,
+    0x00, 0x43, 0x00, 0x0F, 0x88, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
+    0x10, 0x00, 0x0C, 0x4F, 0x00, 0x01, 0x80, 0x1F, 0x30, 0x10, 0x00, 0x0F,
+    0x08, 0x40, 0x00, 0x0F, 0x88, 0x40, 0x00, 0x0F, 0x81, 0x80, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x0F,
+    // 0xD0 'Ð'
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x18, 0x01, 0x00, 0x28, 0x11,
+    0x20, 0x28, 0x61, 0x00, 0x24, 0x01, 0x41, 0x80, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x00, 0x06, 0x01, 0x00, 0xE8, 0x01, 0x0C, 0x28, 0x01,
+    0x00, 0x28, 0x01, 0x00, 0x28, 0x25, 0x00, 0x00, 0x05, 0x08, 0x00, 0x41,
+    0x00, 0x00, 0x89, 0x42, 0x02, 0x01, 0x00, 0x60, 0x01, 0x20, 0x00, 0x21,
+    0x10, 0x00, 0x41, 0x08, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x00, 0x00, 0x01,
+    // 0xD1 'Ñ'
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0xC3, 0x00, 0x80, 0x18, 0x03, 0x00, 0x21, 0x00, 0x03,
+    0x00, 0x10, 0x00, 0x43, 0x00, 0x00, 0x06, 0x23, 0x00, 0x00, 0xC0, 0x0B,
+    0x00, 0x01, 0x00, 0x03, 0x18, 0x80, 0x20, 0x03, 0x40, 0x00, 0x08, 0x03,
+    0x00, 0x08, 0x02, 0x03, 0x10, 0x02, 0x00, 0x83, 0x00, 0x00, 0x80, 0x03,
+    0x40, 0x00, 0x10, 0x03, 0x20, 0x00, 0x04, 0x03, 0x20, 0x80, 0x18, 0x03,
+    0x40, 0x23, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x0C, 0x03,
+    0x00, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xD2 'Ò'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0xC1, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x04, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
+    0x08, 0x40, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x45, 0x08, 0x08, 0x00, 0x01,
+    0x06, 0x04, 0x02, 0x09, 0x00, 0x40, 0x00, 0x11, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x10, 0x00, 0x01, 0x00, 0x04, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD3 'Ó'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0xC1, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x04, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
+    0x00, 0x40, 0x00, 0x01, 0x04, 0x08, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x45, 0x00, 0x08, 0x00, 0x01,
+    0x04, 0x04, 0x02, 0x09, 0x40, 0x40, 0x00, 0x11, 0x48, 0x00, 0x00, 0x21,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x10, 0x00, 0x01, 0x00, 0x04, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x01,
+    // 0xD4 'Ô'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC1, 0x83, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x13, 0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x0B,
+    0x00, 0x00, 0x81, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x88, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x8B, 0x10, 0x10, 0x00, 0x03,
+    0x88, 0x08, 0x04, 0x13, 0x44, 0x80, 0x00, 0x23, 0x20, 0x00, 0x00, 0x43,
+    0x08, 0x40, 0x00, 0x83, 0x00, 0x20, 0x00, 0x03, 0x00, 0x08, 0x08, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD5 'Õ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC1, 0x83, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x13, 0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x0B,
+    0x00, 0x00, 0x81, 0x03, 0x00, 0x00, 0x00, 0x03, 0x10, 0x88, 0x00, 0x03,
+    0x00, 0x80, 0x00, 0x03, 0x08, 0x10, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x8B, 0x20, 0x10, 0x00, 0x03,
+    0x20, 0x08, 0x04, 0x13, 0x40, 0x80, 0x00, 0x23, 0x00, 0x00, 0x00, 0x43,
+    0x20, 0x40, 0x00, 0x83, 0x00, 0x20, 0x00, 0x03, 0x00, 0x08, 0x08, 0x03,
+    0x00, 0x00, 0x00, 0x03,
+    // 0xD6 'Ö'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x83, 0x07, 0x00, 0x04, 0x00, 0x07,
+    0x00, 0x10, 0x00, 0x27, 0x00, 0x20, 0x00, 0x07, 0x00, 0x40, 0x00, 0x17,
+    0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x00, 0x07, 0x31, 0x10, 0x00, 0x07,
+    0x09, 0x00, 0x00, 0x07, 0x88, 0x20, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x60, 0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x17, 0x30, 0x20, 0x00, 0x07,
+    0x08, 0x10, 0x08, 0x27, 0x89, 0x00, 0x00, 0x47, 0x80, 0x00, 0x00, 0x87,
+    0x60, 0x80, 0x01, 0x07, 0x00, 0x40, 0x00, 0x07, 0x00, 0x10, 0x10, 0x07,
+    0x00, 0x00, 0x00, 0x07,
+    // 0xD7 '×'
+    0x20, 0x23, 0x40, 0x43, 0x00, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x08, 0x03, 0x10, 0x03, 0x20, 0x03, 0x44, 0x03, 0x08, 0x03, 0x10, 0x03,
+    0x00, 0x03,
+    // 0xD8 'Ø'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x60, 0xD1, 0x01, 0x00, 0x01,
+    0x04, 0x00, 0x09, 0x08, 0x00, 0x01, 0x10, 0x0E, 0x05, 0x00, 0x82, 0x41,
+    0x02, 0x04, 0x21, 0x44, 0x09, 0x01, 0x40, 0x12, 0x01, 0x08, 0x04, 0x01,
+    0x00, 0x08, 0x01, 0x00, 0x10, 0x05, 0x00, 0x20, 0x45, 0x08, 0x40, 0x81,
+    0x04, 0x82, 0x09, 0x40, 0xF0, 0x11, 0x00, 0x00, 0x21, 0x20, 0x00, 0x41,
+    0x00, 0x00, 0x01, 0x04, 0x04, 0x01, 0x80, 0x00, 0x01, 0x40, 0x00, 0x01,
+    // 0xD9 'Ù'
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x50, 0x18, 0x11, 0x00, 0x13, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x41,
+    0x00, 0x00, 0x80, 0x21, 0x00, 0x08, 0x00, 0x01, 0x20, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x05,
+    0x10, 0x00, 0x00, 0x01, 0x02, 0x20, 0x02, 0x09, 0x02, 0x10, 0x60, 0x01,
+    0x00, 0x0C, 0x00, 0x21, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0xC0, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0xDA 'Ú'
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x50, 0x18, 0x11, 0x00, 0x13, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x41,
+    0x00, 0x00, 0x80, 0x21, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x05,
+    0x12, 0x00, 0x00, 0x01, 0x00, 0x20, 0x02, 0x09, 0x04, 0x10, 0x60, 0x01,
+    0x40, 0x0C, 0x00, 0x21, 0x48, 0x00, 0x00, 0x81, 0x00, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0xC0, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0xDB 'Û'
+    0x00, 0x00, 0x01, 0x03, 0x00, 0xA0, 0x30, 0x23, 0x00, 0x26, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x83,
+    0x00, 0x01, 0x00, 0x43, 0x04, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x43, 0x48, 0x00, 0x00, 0x0B,
+    0x90, 0x00, 0x00, 0x03, 0x00, 0x40, 0x04, 0x13, 0x80, 0x20, 0xC0, 0x03,
+    0x00, 0x18, 0x00, 0x43, 0x20, 0x00, 0x01, 0x03, 0x0C, 0x00, 0x0C, 0x03,
+    0x00, 0x01, 0x80, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x03,
+    // 0xDC 'Ü'
+    0x00, 0x00, 0x02, 0x07, 0x01, 0x40, 0x60, 0x47, 0x00, 0x4C, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x31, 0x07,
+    0x00, 0x02, 0x00, 0x87, 0x00, 0x20, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x88, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x87, 0x10, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x08, 0x27, 0x08, 0x41, 0x80, 0x07,
+    0x88, 0x30, 0x00, 0x87, 0x80, 0x00, 0x02, 0x07, 0x00, 0x00, 0x18, 0x07,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    // 0xDE 'Þ'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x18, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x67, 0x00, 0x0E, 0x07, 0x00, 0xC2, 0x0F, 0x12, 0x00, 0x87,
+    0x22, 0x00, 0x87, 0x00, 0x00, 0x07, 0xC9, 0x00, 0x07, 0x08, 0x01, 0x07,
+    0x00, 0x02, 0x07, 0x04, 0x00, 0x07, 0x02, 0x08, 0x07, 0x00, 0xE0, 0x07,
+    // 0xDF 'ß'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x30, 0x04,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x60, 0x00, 0x20, 0x02, 0x00, 0x02, 0x00,
+    0x08, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x44, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x08, 0x00, 0x10, 0x20, 0x00, 0x00,
+    0x00, 0x40, 0x84, 0x00, 0x90, 0x00, 0x40, 0x00, 0x0E, 0x00, 0x11, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x20, 0x00, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // 0xE0 'à'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x01, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x42, 0x1F,
+    0x00, 0x01, 0x00, 0x5F, 0x00, 0x20, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x1F,
+    0x02, 0x00, 0x12, 0x1F, 0x10, 0x20, 0x43, 0x9F, 0x08, 0x02, 0x00, 0x1F,
+    0x02, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0xC2, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xE1 'á'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x01, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x42, 0x1F,
+    0x00, 0x01, 0x00, 0x5F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x12, 0x1F, 0x06, 0x20, 0x43, 0x9F, 0x01, 0x02, 0x00, 0x1F,
+    0x22, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0xC2, 0x5F,
+    0x10, 0x04, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xE2 'â'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC1, 0x3F, 0x00, 0x02, 0x00, 0xBF,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x20, 0x84, 0x3F,
+    0x04, 0x02, 0x00, 0xBF, 0x08, 0x40, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x24, 0x3F, 0x00, 0x40, 0x87, 0x3F, 0x90, 0x04, 0x00, 0x3F,
+    0x80, 0x20, 0x00, 0x3F, 0x42, 0x40, 0x00, 0x3F, 0x12, 0x41, 0x84, 0xBF,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x40, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xE3 'ã'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x41, 0x08, 0x7F,
+    0x28, 0x04, 0x01, 0x7F, 0x40, 0x80, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x48, 0x7F, 0x00, 0x81, 0x0E, 0x7F, 0x40, 0x08, 0x00, 0x7F,
+    0x20, 0x40, 0x00, 0x7F, 0x20, 0x80, 0x00, 0x7F, 0x08, 0x83, 0x09, 0x7F,
+    0x10, 0x10, 0x00, 0x7F, 0x00, 0x80, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE4 'ä'
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x08, 0x02, 0x00, 0x20, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x82, 0x10, 0x50, 0x08, 0x02, 0x81, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x00, 0x90, 0x01, 0x02, 0x1C, 0x00, 0x10, 0x00,
+    0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x01, 0x06, 0x12, 0x80, 0x20, 0x00,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+    // 0xE5 'å'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x01, 0x00, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0x42, 0x1F,
+    0x00, 0x01, 0x00, 0x5F, 0x0E, 0x20, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x4C, 0x00, 0x12, 0x1F, 0x02, 0xA0, 0x43, 0x9F, 0x02, 0x82, 0x00, 0x1F,
+    0x14, 0x10, 0x00, 0x1F, 0x40, 0x20, 0x00, 0x1F, 0x24, 0x20, 0xC2, 0x5F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x20, 0x04, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xE6 'æ'
+    0x00, 0x00, 0x3F, 0x00, 0xC1, 0x3F, 0x02, 0x00, 0xBF, 0x08, 0x00, 0x3F,
+    0x10, 0x00, 0x3F, 0x20, 0x84, 0x3F, 0x02, 0x00, 0xBF, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x20, 0x3F, 0x00, 0x84, 0x3F, 0x48, 0x01, 0x3F,
+    0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x21, 0x54, 0x3F, 0x00, 0x00, 0x3F,
+    0x40, 0x80, 0x3F, 0x50, 0x20, 0x3F, 0x12, 0x04, 0xBF, 0x00, 0x00, 0x3F,
+    0x00, 0x80, 0x3F, 0x01, 0x0C, 0x3F, 0x1C, 0x00, 0x3F,
+    // 0xE7 'ç'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x82, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
+    0x08, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x0A, 0xFF, 0x21, 0x88, 0x20, 0x7F,
+    0x00, 0x00, 0x21, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x80, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x08, 0x09, 0x00, 0x7F, 0x44, 0x02, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xE8 'è'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x11, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x10, 0x1F, 0x22, 0x08, 0x80, 0x5F,
+    0x11, 0x01, 0x20, 0x1F, 0x00, 0x00, 0x04, 0x9F, 0x02, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x06, 0x1F, 0x00, 0x0C, 0x00, 0x1F,
+    // 0xE9 'é'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x11, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x10, 0x1F, 0x00, 0x08, 0x80, 0x5F,
+    0x05, 0x01, 0x20, 0x1F, 0x11, 0x00, 0x04, 0x9F, 0x02, 0x20, 0x00, 0x1F,
+    0x04, 0x00, 0x06, 0x1F, 0x08, 0x0C, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    // 0xEA 'ê'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x22, 0x10, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x20, 0x3F, 0x40, 0x11, 0x00, 0xBF,
+    0x00, 0x02, 0x40, 0x3F, 0x90, 0x00, 0x09, 0x3F, 0x84, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x0C, 0x3F, 0x12, 0x18, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    // 0xEB 'ë'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x88, 0x40, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80,
+    0x80, 0x44, 0x02, 0x00, 0x09, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+    0x80, 0x00, 0x30, 0x00, 0x60, 0x00, 0x20, 0x00, 0x00,
+    // 0xEC 'ì'
+    0x00, 0x10, 0x03, 0x9F, 0x00, 0x00, 0x20, 0x1F, 0x28, 0x21, 0x00, 0x1F,
+    0x44, 0x20, 0x00, 0x1F, 0x40, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x62, 0x5F,
+    0x08, 0x26, 0x00, 0x1F, 0x05, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xED 'í'
+    0x00, 0x10, 0x03, 0x9F, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x21, 0x00, 0x1F,
+    0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x02, 0x00, 0x62, 0x5F,
+    0x09, 0x26, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F, 0x40, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    // 0xEE 'î'
+    0x00, 0x20, 0x07, 0x3F, 0x02, 0x00, 0x40, 0x3F, 0x08, 0x42, 0x00, 0x3F,
+    0x12, 0x40, 0x00, 0x3F, 0x04, 0x00, 0x0C, 0x3F, 0x08, 0x00, 0xC4, 0xBF,
+    0x10, 0x4C, 0x00, 0x3F, 0x88, 0x00, 0x06, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x20, 0x00, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x3F,
+    // 0xEF 'ï'
+    0x00, 0x80, 0x1C, 0x20, 0x01, 0x00, 0x01, 0x08, 0x00, 0x81, 0x00, 0x00,
+    0x90, 0x00, 0x30, 0x60, 0x03, 0x12, 0x01, 0x30, 0x00, 0x50, 0x00, 0x18,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0xF0 'ð'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x01, 0x3F,
+    0x00, 0x08, 0x00, 0xBF, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x21, 0x84, 0x3F,
+    0x02, 0x00, 0x00, 0x3F, 0x15, 0x00, 0x00, 0x3F, 0x48, 0x48, 0x00, 0x3F,
+    0x02, 0x40, 0x00, 0xBF, 0x00, 0x48, 0x10, 0x3F, 0x00, 0x43, 0xC1, 0x3F,
+    0x00, 0x00, 0x02, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x30, 0x3F,
+    0x00, 0x1F, 0x00, 0x3F,
+    // 0xF1 'ñ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x03, 0x7F, 0x00, 0x00, 0x20, 0x7F,
+    0x00, 0x86, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x28, 0x00, 0x20, 0x7F, 0x40, 0x91, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x80, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x1A, 0x7F, 0x40, 0x81, 0x80, 0x7F,
+    0x20, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x38, 0x7F,
+    0x10, 0x81, 0x09, 0x7F, 0x00, 0x30, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x7F,
+    // 0xF2 'ò'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x82, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x28, 0x24, 0x01, 0x1F, 0x44, 0x00, 0x00, 0x1F,
+    0x02, 0x00, 0x00, 0x5F, 0x10, 0x04, 0x08, 0x1F, 0x08, 0x00, 0x00, 0x9F,
+    0x03, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x08, 0x1F,
+    0x00, 0x01, 0x00, 0x1F,
+    // 0xF3 'ó'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x82, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x24, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x5F, 0x06, 0x04, 0x08, 0x1F, 0x01, 0x00, 0x00, 0x9F,
+    0x20, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x08, 0x08, 0x1F,
+    0x10, 0x01, 0x00, 0x1F,
+    // 0xF4 'ô'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x82, 0x3F, 0x00, 0x04, 0x00, 0x3F,
+    0x00, 0x08, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x21, 0x04, 0x3F,
+    0x06, 0x04, 0x00, 0x3F, 0x08, 0x48, 0x02, 0x3F, 0x02, 0x00, 0x00, 0x3F,
+    0x04, 0x00, 0x00, 0xBF, 0x08, 0x08, 0x10, 0x3F, 0x90, 0x00, 0x01, 0x3F,
+    0x88, 0x40, 0x02, 0x3F, 0x42, 0x00, 0x00, 0x3F, 0x12, 0x10, 0x10, 0x3F,
+    0x04, 0x02, 0x00, 0x3F,
+    // 0xF5 'õ'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x04, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x10, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x42, 0x08, 0x7F,
+    0x38, 0x08, 0x00, 0x7F, 0x40, 0x90, 0x04, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x01, 0x7F, 0x10, 0x10, 0x20, 0x7F, 0x40, 0x00, 0x02, 0x7F,
+    0x20, 0x80, 0x04, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x08, 0x20, 0x20, 0x7F,
+    0x10, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0xF6 'ö'
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0x10, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x70, 0x10, 0x00, 0x81, 0x20, 0x08,
+    0x80, 0x00, 0x00, 0x90, 0x00, 0x02, 0x40, 0x20, 0x40, 0x00, 0x00, 0x04,
+    0x41, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x08, 0x00,
+    0x00, 0x00, 0x00,
+    // 0xF7 '÷'
+    0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x64, 0x1B,
+    0x84, 0x07, 0x04, 0x07, 0x84, 0x07, 0x64, 0x13, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03,
+    // 0xF8 'ø'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x01, 0x80, 0x3F,
+    0x04, 0x00, 0x3F, 0x08, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x21, 0x28, 0x3F,
+    0x04, 0x42, 0x3F, 0x48, 0x02, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF,
+    0x00, 0x10, 0x3F, 0x00, 0x81, 0x3F, 0x40, 0x02, 0x3F, 0x00, 0x00, 0x3F,
+    0x20, 0x10, 0x3F, 0x42, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0xF9 'ù'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x20, 0x5F,
+    0x00, 0x23, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x1F,
+    0x00, 0x00, 0x40, 0x5F, 0x00, 0x1E, 0x02, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x22, 0x00, 0x08, 0x1F, 0x11, 0x00, 0x20, 0x1F, 0x00, 0x01, 0x80, 0x5F,
+    0x02, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x20, 0x1A, 0x1F,
+    0x00, 0x03, 0x02, 0x1F, 0x00, 0x30, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    // 0xFA 'ú'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x20, 0x5F,
+    0x00, 0x23, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x1F,
+    0x00, 0x00, 0x40, 0x5F, 0x00, 0x1E, 0x02, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x00, 0x00, 0x08, 0x1F, 0x05, 0x00, 0x20, 0x1F, 0x11, 0x01, 0x80, 0x5F,
+    0x02, 0x10, 0x00, 0x1F, 0x04, 0x20, 0x00, 0x1F, 0x08, 0x20, 0x1A, 0x1F,
+    0x30, 0x03, 0x02, 0x1F, 0x00, 0x30, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    // 0xFB 'û'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x40, 0xBF,
+    0x00, 0x46, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1C, 0x3F,
+    0x00, 0x00, 0x80, 0xBF, 0x00, 0x3C, 0x04, 0x3F, 0x00, 0x00, 0x08, 0x3F,
+    0x40, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x90, 0x03, 0x00, 0xBF,
+    0x84, 0x20, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x3F, 0x12, 0x40, 0x34, 0x3F,
+    0x00, 0x06, 0x04, 0x3F, 0x00, 0x60, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0xFC 'ü'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x02, 0x01, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0x02, 0x02, 0x80, 0xF0, 0x10,
+    0x00, 0x00, 0x20, 0x80, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x02,
+    0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x01, 0x00, 0xD0, 0x20, 0x18, 0x10,
+    0x01, 0x80, 0x04, 0x00, 0x00, 0x08,
+    // 0xFE 'þ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x18, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x40, 0x20, 0x00, 0x13, 0x46, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x38, 0x0B,
+    0x00, 0x11, 0x00, 0x05, 0x00, 0x80, 0x04, 0x01, 0x0C, 0x08, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x90, 0x20, 0x01, 0x00, 0x0F, 0x02, 0x01,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x01,
+    0x00, 0x3F, 0x00, 0x01,
+    // 0xFF 'ÿ'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x01, 0x01, 0x10, 0x00, 0x01,
+    0x50, 0x01, 0x81, 0x11, 0x81, 0x00, 0x00, 0x21, 0x00, 0x80, 0x00, 0x41,
+    0x90, 0x38, 0x00, 0x81, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x83, 0x08, 0x01, 0x81, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01,
+    0x80, 0x01, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x104 'Ą'
+    0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x0C, 0x07,
+    0x00, 0x80, 0x00, 0x07, 0x02, 0x0C, 0x00, 0x07, 0x00, 0x24, 0x00, 0x07,
+    0x10, 0x84, 0x00, 0x07, 0x02, 0x04, 0x04, 0x07, 0x03, 0x04, 0x00, 0x67,
+    0x00, 0x08, 0x11, 0x17, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0xC7,
+    0x01, 0x80, 0x00, 0x07, 0x00, 0x0C, 0x02, 0x07, 0x00, 0x00, 0x60, 0x07,
+    0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x105 'ą'
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x02, 0x00, 0x80, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x20, 0x84, 0x00, 0x02, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x86, 0x0C, 0x04, 0x00, 0x20,
+    0x20, 0x00, 0x00, 0x40, 0x00, 0x20, 0x41, 0x84, 0x00, 0x08, 0x00, 0x02,
+    0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
+    // 0x106 'Ć'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x30, 0xC1, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x80, 0x81, 0x00, 0x20, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x40, 0x00, 0x21, 0x00, 0x08, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21,
+    0x02, 0x00, 0x00, 0x21, 0x10, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41,
+    0x04, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x11, 0x48, 0x41, 0x00, 0x41,
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x107 'ć'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x10, 0xC4, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x5F,
+    0x05, 0x00, 0x00, 0x1F, 0x11, 0x04, 0x04, 0x9F, 0x02, 0x22, 0x01, 0x1F,
+    0x04, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    // 0x10C 'Č'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x30, 0xC1, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x80, 0x81, 0x00, 0x20, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0x40, 0x00, 0x21, 0x44, 0x08, 0x00, 0x21, 0x22, 0x00, 0x00, 0x21,
+    0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x41,
+    0x24, 0x00, 0x00, 0x09, 0x08, 0x00, 0x00, 0x11, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x10D 'č'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x20, 0x10, 0xC4, 0x1F,
+    0x48, 0x00, 0x00, 0x1F, 0x42, 0x20, 0x00, 0x1F, 0x11, 0x00, 0x02, 0x5F,
+    0x09, 0x00, 0x00, 0x1F, 0x10, 0x04, 0x04, 0x9F, 0x20, 0x22, 0x01, 0x1F,
+    0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x10E 'Ď'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x61, 0x00, 0x00, 0x0C, 0x01,
+    0x00, 0x41, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x06, 0x01, 0x30, 0x00, 0xC0, 0x01, 0x08, 0x0C, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x08, 0x00, 0x41, 0x00, 0x00, 0x00, 0x89, 0x00, 0x42, 0x02, 0x01,
+    0x40, 0x00, 0x60, 0x01, 0x10, 0x20, 0x00, 0x21, 0x60, 0x10, 0x00, 0x41,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x02, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x10F 'ď'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x82, 0x7F, 0x00, 0x04, 0x01, 0x7F,
+    0x00, 0x10, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x41, 0x08, 0x7F,
+    0x00, 0x04, 0x01, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x48, 0x7F, 0x30, 0x81, 0x0E, 0x7F, 0x40, 0x08, 0x00, 0x7F,
+    0x41, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x09, 0x7F,
+    0x00, 0x20, 0x00, 0x7F, 0x02, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F,
+    // 0x118 'Ę'
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x18, 0x00, 0x0F,
+    0x23, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x0F,
+    0x00, 0x0C, 0x20, 0x0F, 0x01, 0x80, 0x20, 0x0F, 0x18, 0x00, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x0F, 0x00, 0x00, 0x42, 0x0F,
+    0x00, 0x00, 0x04, 0x0F, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x00, 0x20, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
+    // 0x119 'ę'
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x22, 0x10, 0x02, 0x00, 0x00, 0x40, 0x40, 0x20, 0x38,
+    0x11, 0x00, 0x40, 0x02, 0x40, 0x80, 0x00, 0x09, 0x04, 0x40, 0x00, 0x00,
+    0x00, 0x0C, 0x00, 0x18, 0x00, 0x00,
+    // 0x11A 'Ě'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x00, 0x11, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x20, 0x00, 0x06, 0x13, 0x48, 0x00, 0xC0, 0x13, 0x44, 0x0C, 0x00, 0x03,
+    0x22, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x12, 0x00, 0x00, 0x03, 0x24, 0x00, 0x01, 0x03, 0x08, 0x00, 0x00, 0x13,
+    0x10, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03,
+    // 0x11B 'ě'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x04, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x20, 0x11, 0x08, 0x1F,
+    0x48, 0x00, 0x00, 0x1F, 0x42, 0x20, 0x10, 0x1F, 0x11, 0x08, 0x80, 0x5F,
+    0x09, 0x01, 0x20, 0x1F, 0x10, 0x00, 0x04, 0x9F, 0x20, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x06, 0x1F, 0x10, 0x0C, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x139 'Ĺ'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x00, 0x40, 0x0C, 0x03,
+    0x00, 0x11, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x02, 0x00, 0x02, 0x13, 0x12, 0x00, 0x60, 0x13, 0x00, 0x0C, 0x00, 0x03,
+    0x04, 0x10, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x48, 0x60, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03,
+    // 0x13A 'ĺ'
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x60, 0x00,
+    0x00, 0x8C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x04, 0x00, 0x0C, 0x10,
+    0x24, 0x00, 0xC0, 0x04, 0x00, 0x08, 0x00, 0x18, 0x40, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    // 0x13D 'Ľ'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x18, 0x10, 0x03, 0x00, 0x04, 0x60, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x84, 0x00, 0x18, 0x04, 0x03, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x08, 0x02, 0x00, 0x20,
+    0x20, 0x00, 0x01, 0x02, 0x00, 0x04, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00,
+    // 0x13E 'ľ'
+    0x00, 0x00, 0x11, 0x7F, 0x00, 0x03, 0x00, 0x7F, 0x40, 0x30, 0x00, 0x7F,
+    0x46, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x38, 0x7F, 0x00, 0x06, 0x08, 0x7F,
+    0x00, 0x60, 0x02, 0x7F, 0x04, 0x00, 0x0C, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x05, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x00, 0x7F,
+    0x08, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x141 'Ł'
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x14, 0x27,
+    0x00, 0x00, 0xC7, 0x80, 0x20, 0x07, 0x23, 0x00, 0x07, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x47, 0x00, 0x04, 0x27, 0x00, 0x20, 0x27, 0x18, 0x00, 0x07,
+    0x21, 0x40, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x47, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x27, 0x00, 0x00, 0x07,
+    // 0x142 'ł'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x05, 0x11, 0x7F,
+    0x00, 0x01, 0x00, 0x7F, 0x40, 0x30, 0x00, 0x7F, 0x46, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x38, 0x7F, 0x00, 0x06, 0x08, 0x7F, 0x00, 0x40, 0x02, 0x7F,
+    0x04, 0x00, 0x0C, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F,
+    // 0x143 'Ń'
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x40, 0x0C, 0x01, 0x00, 0x10, 0x80, 0x01,
+    0x00, 0x08, 0x00, 0x21, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x60, 0x05,
+    0x00, 0x00, 0x80, 0x01, 0x00, 0x40, 0x10, 0x01, 0x00, 0x00, 0x04, 0x01,
+    0x06, 0x04, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x41, 0x02, 0x00, 0x40, 0x01,
+    0x00, 0x00, 0x08, 0x01, 0x20, 0x00, 0x02, 0x01, 0x04, 0x40, 0x0C, 0x01,
+    0x00, 0x11, 0x80, 0x01, 0x30, 0x00, 0x00, 0x31, 0x00, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0x60, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x144 'ń'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0xDF, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x21, 0x80, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x08, 0x1F, 0x00, 0x24, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x04, 0x00, 0x06, 0x9F, 0x01, 0x20, 0x60, 0x1F,
+    0x22, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x1F,
+    0x30, 0x20, 0x42, 0x5F, 0x00, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    // 0x147 'Ň'
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x40, 0x0C, 0x01, 0x00, 0x10, 0x80, 0x01,
+    0x00, 0x08, 0x00, 0x21, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x60, 0x05,
+    0x00, 0x00, 0x80, 0x01, 0x10, 0x40, 0x10, 0x01, 0x08, 0x00, 0x04, 0x01,
+    0x00, 0x04, 0x01, 0x01, 0x00, 0x01, 0x00, 0x41, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x40, 0x0C, 0x01,
+    0x40, 0x11, 0x80, 0x01, 0x10, 0x00, 0x00, 0x31, 0x60, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0x60, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x148 'ň'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x00, 0xDF, 0x00, 0x00, 0x08, 0x1F,
+    0x00, 0x21, 0x80, 0x1F, 0x00, 0x20, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x08, 0x1F, 0x48, 0x24, 0x40, 0x1F, 0x02, 0x00, 0x00, 0x1F,
+    0x01, 0x02, 0x00, 0x1F, 0x09, 0x00, 0x06, 0x9F, 0x01, 0x20, 0x60, 0x1F,
+    0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x1F,
+    0x20, 0x20, 0x42, 0x5F, 0x00, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x1F,
+    // 0x152 'Œ'
+    0x00, 0x00, 0x01, 0x00, 0x20, 0xC1, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x1E, 0x05, 0x00, 0x80, 0x01, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x21, 0x40, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x00, 0x0C, 0x01, 0x00, 0xC0, 0x01,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x61, 0x00, 0x06, 0x11, 0x00, 0xC0, 0x11,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x0E, 0x01, 0x11, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x70, 0x00, 0x01,
+    // 0x153 'œ'
+    0x00, 0x00, 0x3F, 0x01, 0x82, 0x3F, 0x04, 0x00, 0x3F, 0x08, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x21, 0x04, 0x3F, 0x04, 0x00, 0x3F, 0x48, 0x02, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x08, 0x11, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x02, 0x54, 0x3F,
+    0x00, 0x00, 0x3F, 0x40, 0x80, 0x3F, 0x51, 0x00, 0x3F, 0x12, 0x04, 0xBF,
+    0x00, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x01, 0x08, 0x3F, 0x1C, 0x00, 0x3F,
+    // 0x158 'Ř'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x61, 0x00, 0x00, 0x0C, 0x01,
+    0x00, 0x41, 0x80, 0x01, 0x00, 0x48, 0x00, 0x01, 0x20, 0x00, 0x00, 0x21,
+    0x48, 0x00, 0x02, 0x11, 0x44, 0x00, 0xC0, 0x0D, 0x22, 0x08, 0x01, 0x01,
+    0x00, 0x10, 0x00, 0x41, 0x00, 0x10, 0x20, 0x01, 0x12, 0x00, 0x44, 0x09,
+    0x24, 0x05, 0x88, 0x01, 0x48, 0x40, 0x00, 0x81, 0x10, 0x00, 0x00, 0x41,
+    0x00, 0x20, 0x00, 0x21, 0x00, 0x10, 0x80, 0x11, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01,
+    // 0x159 'ř'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x3F,
+    0x00, 0x20, 0xC0, 0x3F, 0x00, 0x20, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x04, 0x3F, 0x42, 0x26, 0x20, 0x3F, 0x11, 0x04, 0x80, 0x3F,
+    0x09, 0x01, 0x00, 0x3F, 0x10, 0x02, 0x00, 0x3F, 0x20, 0x20, 0x00, 0x3F,
+    0x48, 0x00, 0x00, 0x3F, 0x10, 0x02, 0x00, 0x3F, 0x20, 0x18, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x15A 'Ś'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x02, 0x05, 0x00, 0x08, 0x41, 0x81, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x08, 0x01, 0x00, 0x09, 0x00, 0x01,
+    0x00, 0x00, 0x80, 0x01, 0x02, 0x10, 0x00, 0x01, 0x12, 0x10, 0x00, 0x05,
+    0x00, 0x00, 0x20, 0x01, 0x00, 0x0E, 0x10, 0x01, 0x44, 0x01, 0x08, 0x01,
+    0x00, 0x40, 0x03, 0x81, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x15B 'ś'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x07, 0x08, 0x1F, 0x00, 0x08, 0x40, 0x1F, 0x00, 0x10, 0x20, 0x1F,
+    0x00, 0x00, 0x01, 0x1F, 0x00, 0x20, 0x01, 0x1F, 0x00, 0x00, 0x06, 0x1F,
+    0x06, 0x00, 0x80, 0x5F, 0x01, 0x00, 0x40, 0x9F, 0x20, 0x00, 0x21, 0x1F,
+    0x00, 0x20, 0x0C, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x1F,
+    // 0x160 'Š'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x02, 0x05, 0x00, 0x08, 0x41, 0x81, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x08, 0x01, 0x00, 0x09, 0x00, 0x01,
+    0x22, 0x00, 0x80, 0x01, 0x10, 0x10, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05,
+    0x12, 0x00, 0x20, 0x01, 0x04, 0x0E, 0x10, 0x01, 0x00, 0x01, 0x08, 0x01,
+    0x00, 0x40, 0x03, 0x81, 0x00, 0x0C, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01,
+    // 0x161 'š'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x9F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x07, 0x08, 0x1F, 0x00, 0x08, 0x40, 0x1F, 0x00, 0x10, 0x20, 0x1F,
+    0x48, 0x00, 0x01, 0x1F, 0x02, 0x20, 0x01, 0x1F, 0x21, 0x00, 0x06, 0x1F,
+    0x09, 0x00, 0x80, 0x5F, 0x01, 0x00, 0x40, 0x9F, 0x02, 0x00, 0x21, 0x1F,
+    0x00, 0x20, 0x0C, 0x1F, 0x00, 0x08, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x1F,
+    // 0x164 'Ť'
+    0x00, 0x19, 0x00, 0x03, 0x00, 0x40, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x08, 0x00, 0x13, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x18, 0x03,
+    0x40, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x22, 0x00, 0x00, 0x23,
+    0x10, 0x00, 0x06, 0x13, 0x00, 0x00, 0xC0, 0x0F, 0x12, 0x08, 0x00, 0x03,
+    0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x58, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x165 'ť'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x60, 0x7F,
+    0x00, 0x0C, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x04, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x68, 0x7F, 0x08, 0x0C, 0x00, 0x7F, 0x09, 0x00, 0x09, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x04, 0x80, 0x00, 0x7F, 0x22, 0x80, 0x18, 0x7F,
+    0x04, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
+    // 0x16E 'Ů'
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x50, 0x18, 0x11, 0x00, 0x13, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x41,
+    0x00, 0x00, 0x80, 0x21, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x05,
+    0xA1, 0x00, 0x00, 0x01, 0xA5, 0x20, 0x02, 0x09, 0x18, 0x10, 0x60, 0x01,
+    0x42, 0x0C, 0x00, 0x21, 0x18, 0x00, 0x00, 0x81, 0x00, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0xC0, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x16F 'ů'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x20, 0x5F,
+    0x00, 0x23, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x1F,
+    0x00, 0x00, 0x40, 0x5F, 0x12, 0x1E, 0x02, 0x1F, 0x00, 0x00, 0x04, 0x1F,
+    0x50, 0x80, 0x08, 0x1F, 0x02, 0x80, 0x20, 0x1F, 0x02, 0x01, 0x80, 0x5F,
+    0x1C, 0x10, 0x00, 0x1F, 0x40, 0x20, 0x00, 0x1F, 0x1C, 0x20, 0x1A, 0x1F,
+    0x00, 0x03, 0x02, 0x1F, 0x00, 0x30, 0x00, 0x9F, 0x00, 0x00, 0x01, 0x1F,
+    // 0x170 'Ű'
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x50, 0x18, 0x11, 0x00, 0x13, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x41,
+    0x00, 0x00, 0x80, 0x21, 0x06, 0x08, 0x00, 0x01, 0x08, 0x10, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x05,
+    0x40, 0x00, 0x00, 0x01, 0x08, 0x20, 0x02, 0x09, 0x36, 0x10, 0x60, 0x01,
+    0x08, 0x0C, 0x00, 0x21, 0x02, 0x00, 0x00, 0x81, 0x00, 0x00, 0x06, 0x01,
+    0x04, 0x00, 0xC0, 0x01, 0x40, 0x08, 0x00, 0x01, 0x08, 0x10, 0x00, 0x01,
+    0x30, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01,
+    // 0x171 'ű'
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x40, 0xBF,
+    0x00, 0x46, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1C, 0x3F,
+    0x02, 0x00, 0x80, 0xBF, 0x12, 0x3C, 0x04, 0x3F, 0x20, 0x00, 0x08, 0x3F,
+    0x00, 0x00, 0x10, 0x3F, 0x80, 0x00, 0x40, 0x3F, 0x64, 0x03, 0x00, 0xBF,
+    0x00, 0x20, 0x00, 0x3F, 0x20, 0x40, 0x00, 0x3F, 0x40, 0x40, 0x34, 0x3F,
+    0x88, 0x06, 0x04, 0x3F, 0x00, 0x60, 0x01, 0x3F, 0x00, 0x00, 0x02, 0x3F,
+    // 0x178 'Ÿ'
+    0x00, 0x00, 0x00, 0x0F, 0x01, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x08, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x23, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x40, 0x58, 0x00, 0x0F, 0x88, 0x03, 0x00, 0x0F,
+    0x81, 0x80, 0x80, 0x8F, 0x10, 0x01, 0x08, 0x4F, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x88, 0x00, 0x0F, 0x00, 0x40, 0x00, 0x0F, 0x88, 0x02, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x00, 0x0F, 0x00, 0x20, 0x00, 0x0F,
+    0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F,
+    // 0x179 'Ź'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x0E, 0x00, 0x01, 0x00, 0x41, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x04, 0x08, 0x21, 0x00, 0x00, 0x10, 0x51, 0x00, 0x00, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x12, 0x02, 0x08, 0x01,
+    0x00, 0x04, 0x10, 0x01, 0x20, 0x00, 0x20, 0x21, 0x04, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x00, 0x01, 0x30, 0x02, 0x00, 0x09, 0x00, 0x44, 0x00, 0xC1,
+    0x00, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x17A 'ź'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x9F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x04, 0x04, 0x1F, 0x00, 0x24, 0x0A, 0x5F, 0x00, 0x20, 0x12, 0x1F,
+    0x05, 0x02, 0x20, 0x1F, 0x11, 0x10, 0x40, 0x1F, 0x02, 0x00, 0x80, 0x1F,
+    0x04, 0x01, 0x08, 0x1F, 0x08, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F,
+    // 0x17B 'Ż'
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x83,
+    0x00, 0x1C, 0x00, 0x03, 0x00, 0x82, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x08, 0x10, 0x43, 0x00, 0x00, 0x20, 0xA3, 0x00, 0x00, 0x01, 0x23,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x04, 0x04, 0x10, 0x03,
+    0x00, 0x08, 0x20, 0x03, 0x08, 0x00, 0x40, 0x43, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x13, 0x00, 0x88, 0x01, 0x83,
+    0x00, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    // 0x17C 'ż'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F, 0x00, 0x80, 0x02, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x00, 0x10, 0x10, 0x7F, 0x00, 0x90, 0x29, 0x7F, 0x40, 0x80, 0x48, 0x7F,
+    0x00, 0x08, 0x80, 0x7F, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0x04, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x40, 0x00, 0x7F,
+    // 0x17D 'Ž'
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x0E, 0x00, 0x01, 0x00, 0x41, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x04, 0x08, 0x21, 0x50, 0x00, 0x10, 0x51, 0x00, 0x00, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x02, 0x08, 0x01,
+    0x00, 0x04, 0x10, 0x01, 0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00, 0x81,
+    0x40, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x09, 0x60, 0x44, 0x00, 0xC1,
+    0x00, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    // 0x17E 'ž'
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x02, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x9F, 0x20, 0x02, 0x00, 0x1F,
+    0x40, 0x04, 0x04, 0x1F, 0x42, 0x24, 0x0A, 0x5F, 0x11, 0x20, 0x12, 0x1F,
+    0x09, 0x02, 0x20, 0x1F, 0x10, 0x10, 0x40, 0x1F, 0x20, 0x00, 0x80, 0x1F,
+    0x48, 0x01, 0x08, 0x1F, 0x10, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x1F,
+    0x00, 0x10, 0x00, 0x1F,
+    // 0x3C0 'π'
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x10, 0x04, 0x3F, 0x00, 0x10, 0x3F,
+    0x00, 0x40, 0xBF, 0x49, 0x01, 0x3F, 0x40, 0x04, 0x3F, 0x40, 0x20, 0x3F,
+    0x41, 0x00, 0x3F, 0x48, 0x00, 0x3F, 0x48, 0x20, 0xBF, 0x4B, 0x00, 0x3F,
+    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x41, 0x00, 0xBF, 0x48, 0x04, 0x3F,
+    0x48, 0x01, 0x3F, 0x08, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+    // 0x1E9E 'ẞ'
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x21,
+    0x00, 0x03, 0x01, 0x00, 0x60, 0x01, 0x02, 0x00, 0x01, 0x08, 0x00, 0x19,
+    0x10, 0x03, 0x01, 0x20, 0x60, 0x09, 0x02, 0x00, 0x05, 0x40, 0x00, 0x01,
+    0x00, 0x30, 0xE1, 0x10, 0x08, 0x11, 0x10, 0x00, 0x11, 0x10, 0x00, 0x11,
+    0x04, 0x02, 0x01, 0x00, 0xA0, 0xC5, 0x41, 0x00, 0x01, 0x02, 0x00, 0x09,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x81,
+    // 0x2013 '–'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F,
+    // 0x2014 '—'
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    // 0x2018 '‘'
+    0x00, 0x1F, 0x04, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x47, 0x1F, 0x10, 0x1F,
+    0x40, 0x1F,
+    // 0x2019 '’'
+    0x00, 0xDF, 0x00, 0x1F, 0x5C, 0x5F, 0x00, 0x9F, 0x01, 0x1F, 0x04, 0x1F,
+    0x00, 0x1F,
+    // 0x201A '‚'
+    0x00, 0xBF, 0x02, 0x3F, 0x38, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x20, 0x3F,
+    // 0x201B '‛'
+    0x00, 0x1F, 0x42, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1C, 0x1F, 0x00, 0x3F,
+    0x00, 0x5F,
+    // 0x201C '“'
+    0x00, 0x1F, 0x04, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x47, 0x1F, 0x10, 0x1F,
+    0x40, 0x1F, 0x04, 0x5F, 0x00, 0x1F, 0x20, 0x1F, 0x43, 0x5F, 0x08, 0x1F,
+    0x20, 0x1F, 0x00, 0x1F,
+    // 0x201D '”'
+    0x00, 0xBF, 0x02, 0x3F, 0x38, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x00, 0xBF, 0x00, 0x3F, 0x48, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x84, 0x3F,
+    0x70, 0x3F,
+    // 0x201E '„'
+    0x00, 0xBF, 0x02, 0x3F, 0x38, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x20, 0xBF, 0x02, 0x3F, 0x38, 0x3F, 0x80, 0x3F, 0x02, 0x3F, 0x80, 0x3F,
+    0x20, 0x3F,
+    // 0x201F '‟'
+    0x00, 0x1F, 0x42, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1C, 0x1F, 0x00, 0x3F,
+    0x00, 0x5F, 0x42, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1C, 0x1F, 0x00, 0x3F,
+    0x00, 0x5F,
+    // 0x2020 '†'
+    0x01, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x01, 0x9F,
+    0x02, 0x88, 0x0F, 0x02, 0x40, 0x1F, 0x00, 0x01, 0xCF, 0x00, 0x60, 0x0F,
+    0x06, 0x80, 0x0F, 0x62, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2021 '‡'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x04, 0x02, 0x00, 0x21, 0x02, 0x90, 0x01, 0x02, 0x00, 0x06,
+    0x00, 0x03, 0x40, 0x00, 0x78, 0x00, 0x06, 0x81, 0x00, 0x62, 0x01, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    // 0x2022 '•'
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28,
+    // 0x2026 '…'
+    0x13, 0x43, 0x07, 0x03, 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x43,
+    0x07, 0x03, 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x43, 0x07, 0x03,
+    0x0B, 0x03,
+    // 0x2039 '‹'
+    0x07, 0x0F, 0x08, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x02, 0x1F, 0x40, 0x8F,
+    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F,
+    // 0x203A '›'
+    0x00, 0x0F, 0x00, 0x2F, 0x00, 0x4F, 0x20, 0x9F, 0x09, 0x0F, 0x00, 0x0F,
+    0x00, 0x4F, 0x00, 0x8F, 0x01, 0x0F, 0x04, 0x0F,
+    // 0x2070 '⁰'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x05, 0x20, 0x01, 0x43, 0x21, 0x08, 0x01,
+    0x80, 0x11, 0xA0, 0x05, 0x80, 0x81, 0x80, 0x09, 0x00, 0x01, 0x40, 0x41,
+    0x1E, 0x01,
+    // 0x2074 '⁴'
+    0x00, 0x03, 0x00, 0x83, 0x01, 0x03, 0x02, 0x03, 0x04, 0x83, 0x08, 0x03,
+    0x10, 0x07, 0x20, 0x83, 0x4C, 0x03, 0x00, 0x1B, 0x81, 0x83, 0xB0, 0x03,
+    0x00, 0x43,
+    // 0x2075 '⁵'
+    0x00, 0x05, 0x00, 0x01, 0x06, 0x01, 0x20, 0x01, 0x00, 0x11, 0x08, 0x05,
+    0x00, 0xC1, 0x04, 0x09, 0x00, 0x11, 0x01, 0x41, 0x00, 0x01, 0x00, 0x01,
+    // 0x2076 '⁶'
+    0x00, 0xE1, 0x04, 0x01, 0x00, 0x05, 0x00, 0xE1, 0x20, 0x01, 0x4C, 0x01,
+    0x05, 0x11, 0x04, 0xE5, 0x80, 0x01, 0xA2, 0x01, 0xA0, 0xC1, 0x00, 0x01,
+    0x00, 0x01,
+    // 0x2077 '⁷'
+    0x00, 0x01, 0x40, 0x11, 0x00, 0x41, 0x00, 0x01, 0x02, 0x11, 0x04, 0x01,
+    0x00, 0x81, 0x00, 0x01, 0x04, 0x01, 0x08, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x2078 '⁸'
+    0x00, 0x49, 0x00, 0x81, 0x25, 0x01, 0x40, 0x51, 0x00, 0x01, 0x84, 0x01,
+    0x80, 0x91, 0xA0, 0x05, 0x80, 0x01, 0x00, 0x01, 0x40, 0x01, 0x00, 0x01,
+    // 0x2079 '⁹'
+    0x00, 0x01, 0x00, 0x01, 0x1A, 0x01, 0x00, 0x81, 0x00, 0x11, 0x12, 0x05,
+    0xA0, 0x21, 0xA1, 0x49, 0x80, 0x01, 0x00, 0x01, 0x00, 0x41, 0x21, 0x01,
+    0x00, 0x01,
+    // 0x2080 '₀'
+    0x00, 0x01, 0x02, 0x09, 0x00, 0x05, 0x20, 0x01, 0x03, 0x01, 0x08, 0x01,
+    0x00, 0x01, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x09, 0x00, 0x11, 0x00, 0x41,
+    0x1E, 0x01,
+    // 0x2081 '₁'
+    0x00, 0x03, 0x00, 0x0B, 0x20, 0x03, 0x10, 0x13, 0x51, 0x83, 0x00, 0x03,
+    0x00, 0x03, 0x81, 0x03, 0x30, 0x0F, 0x00, 0x03,
+    // 0x2082 '₂'
+    0x00, 0x03, 0x00, 0x17, 0x00, 0x03, 0x20, 0x03, 0x40, 0x03, 0x10, 0x93,
+    0x01, 0x13, 0x82, 0x53, 0x84, 0x93, 0x00, 0x13, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x03,
+    // 0x2083 '₃'
+    0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x48, 0x81, 0x12, 0x81, 0x00, 0x11,
+    0x84, 0xA5, 0x80, 0x01, 0x00, 0x01, 0x00, 0x21, 0x38, 0x01,
+    // 0x2084 '₄'
+    0x00, 0x01, 0x00, 0x81, 0x01, 0x01, 0x02, 0x01, 0x04, 0x81, 0x09, 0x01,
+    0x10, 0x05, 0x20, 0x81, 0x4C, 0x01, 0x00, 0x09, 0x81, 0x81, 0x30, 0x01,
+    0x00, 0x41,
+    // 0x2085 '₅'
+    0x00, 0x05, 0x00, 0x01, 0x06, 0x01, 0x20, 0x01, 0x00, 0x11, 0x08, 0x05,
+    0x00, 0xC1, 0x04, 0x09, 0x00, 0x11, 0x01, 0x41, 0x00, 0x01, 0x40, 0x01,
+    // 0x2086 '₆'
+    0x00, 0xE1, 0x04, 0x01, 0x08, 0x05, 0x00, 0xE1, 0x21, 0x01, 0x0C, 0x01,
+    0x05, 0x01, 0x04, 0xE5, 0x80, 0x01, 0xA2, 0x01, 0xA0, 0xC1, 0x00, 0x01,
+    0x00, 0x01,
+    // 0x2087 '₇'
+    0x00, 0x01, 0x40, 0x11, 0x00, 0x41, 0x00, 0x81, 0x00, 0x01, 0x04, 0x01,
+    0x08, 0x81, 0x00, 0x01, 0x04, 0x01, 0x08, 0x01, 0x00, 0x01, 0x00, 0x01,
+    // 0x2088 '₈'
+    0x00, 0x49, 0x00, 0x85, 0x21, 0x01, 0x00, 0x51, 0x00, 0x81, 0x04, 0x01,
+    0xA0, 0x11, 0xA0, 0x05, 0x81, 0x01, 0x00, 0x81, 0x40, 0x01, 0x00, 0x01,
+    // 0x2089 '₉'
+    0x00, 0x01, 0x00, 0x01, 0x1B, 0x01, 0x00, 0x81, 0x40, 0x11, 0x12, 0x05,
+    0xA1, 0x21, 0xA1, 0x49, 0x80, 0x01, 0x00, 0x01, 0x40, 0x01, 0x21, 0x81,
+    0x00, 0x01,
+    // 0x20A9 '₩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AA '₪'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20AC '€'
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x40, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x20, 0x83, 0x00, 0x00, 0x23, 0x04, 0x00, 0x13, 0x00, 0x00, 0x03,
+    0x00, 0x31, 0x0B, 0x02, 0x00, 0x03, 0x44, 0x10, 0x43, 0x08, 0x10, 0x03,
+    0x00, 0x10, 0x03, 0x90, 0x14, 0x03, 0x80, 0x00, 0x03, 0x80, 0x80, 0x0B,
+    0x80, 0x00, 0x43, 0x80, 0x00, 0x13, 0x80, 0x00, 0x43, 0x04, 0x00, 0x03,
+    0x40, 0x00, 0x03,
+    // 0x20B4 '₴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20B9 '₹'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x20BD '₽'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2122 '™'
+    0x50, 0x1F, 0x10, 0x1F, 0x01, 0x1F, 0x30, 0x1F, 0x00, 0x1F, 0x0C, 0x1F,
+    0x00, 0x1F, 0x10, 0x1F, 0x10, 0x5F, 0xE0, 0x1F, 0x02, 0x1F, 0xF0, 0x1F,
+    0x0C, 0x5F, 0x0C, 0x1F, 0x80, 0x1F, 0x01, 0x1F, 0x00, 0x5F, 0x08, 0x9F,
+    0x80, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x1F,
+    // 0x2153 '⅓'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x28, 0x0A, 0x00,
+    0x09, 0x82, 0x00, 0x00, 0x02, 0x00, 0x40, 0x02, 0x04, 0x41, 0x8A, 0x08,
+    0x18, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x80, 0x0C,
+    0x20, 0x00, 0x00, 0x04, 0x20, 0x00, 0x88, 0x48, 0x80, 0x00, 0x12, 0x80,
+    0x00, 0x00, 0x10, 0x00, 0x80, 0xA4, 0x00, 0x98, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x40, 0xA0, 0x00, 0x38, 0x00,
+    // 0x2154 '⅔'
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x08, 0x12, 0x00, 0x00, 0x02, 0x00,
+    0x24, 0x02, 0x00, 0x08, 0x1A, 0x00, 0x40, 0x8A, 0x00, 0x51, 0x0A, 0x00,
+    0x42, 0x4A, 0x02, 0x40, 0x8A, 0x11, 0x01, 0x08, 0x20, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x08, 0x00, 0x02, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x20, 0x00,
+    0x08, 0x00, 0x0C, 0x11, 0x00, 0x00, 0x42, 0x20, 0x00, 0x80, 0x48, 0x80,
+    0x10, 0x12, 0x80, 0x60, 0x00, 0x10, 0x00, 0x80, 0xA4, 0x00, 0x98, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x40, 0xA0, 0x00, 0x38, 0x00,
+    // 0x215B '⅛'
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x28, 0x0A, 0x00,
+    0x09, 0x82, 0x00, 0x00, 0x02, 0x00, 0x40, 0x02, 0x00, 0x41, 0x8A, 0x08,
+    0x18, 0x04, 0x11, 0x00, 0x00, 0x02, 0x00, 0x00, 0x84, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x80, 0x48,
+    0x21, 0x00, 0x84, 0x40, 0x21, 0x00, 0x88, 0x00, 0x40, 0x10, 0x00, 0x88,
+    0x40, 0x04, 0x00, 0x00, 0xA0, 0x10, 0x00, 0xA0, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x215C '⅜'
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x09, 0x08, 0x00, 0x40, 0x02, 0x00, 0x52, 0x50, 0x06, 0x44, 0x00, 0x00,
+    0x41, 0x00, 0x21, 0x02, 0x90, 0x40, 0x1C, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x48,
+    0x02, 0x00, 0x84, 0x84, 0x21, 0x00, 0x80, 0x00, 0x40, 0x60, 0x00, 0x88,
+    0x00, 0x04, 0x00, 0x00, 0xA0, 0x10, 0x00, 0xA0, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x215D '⅝'
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x40, 0x08, 0x00, 0x44, 0x02, 0x00, 0x40, 0x60, 0x02, 0x42, 0x04, 0x11,
+    0x40, 0x08, 0x20, 0x40, 0xA0, 0x04, 0x40, 0x00, 0x08, 0x00, 0x02, 0x20,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x11, 0x00, 0x48,
+    0x42, 0x00, 0x84, 0x80, 0x21, 0x00, 0x10, 0x00, 0x40, 0x60, 0x00, 0x88,
+    0x00, 0x04, 0x00, 0x00, 0xA0, 0x10, 0x00, 0xA0, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x215E '⅞'
+    0x00, 0x00, 0x00, 0x7F, 0x10, 0x04, 0x00, 0x7F, 0x22, 0x10, 0x00, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x20, 0x84, 0x02, 0x7F, 0x21, 0x00, 0x00, 0x7F,
+    0x20, 0x20, 0x10, 0x7F, 0x20, 0x00, 0x20, 0x7F, 0x21, 0x00, 0x04, 0x7F,
+    0x20, 0x01, 0x00, 0x7F, 0x00, 0x02, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x11, 0x00, 0x7F, 0x00, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x01, 0x10, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x01, 0x00, 0x24, 0x7F, 0x42, 0x00, 0x42, 0x7F, 0x40, 0x10, 0x80, 0x7F,
+    0x10, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x44, 0x7F, 0x00, 0x02, 0x00, 0x7F,
+    0x00, 0x50, 0x08, 0x7F, 0x00, 0x50, 0x02, 0x7F, 0x00, 0x00, 0x80, 0x7F,
+    0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    // 0x2190 '←'
+    0x00, 0x01, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x04, 0x41,
+    0x40, 0x21, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x2191 '↑'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x0F,
+    0x04, 0x00, 0x0F, 0x07, 0xFF, 0xEF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x07, 0xFF, 0xEF, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2192 '→'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01,
+    0x00, 0x05, 0x40, 0x21, 0x24, 0x41, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+    0x02, 0x01, 0x00, 0x01,
+    // 0x2193 '↓'
+    0x00, 0x00, 0x0F, 0x00, 0x0A, 0x0F, 0x00, 0x10, 0x0F, 0x00, 0x08, 0x0F,
+    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0xFF, 0xFE, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x00, 0x10, 0x0F,
+    0x00, 0x08, 0x0F, 0x00, 0x00, 0x0F,
+    // 0x2194 '↔'
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x08, 0x07,
+    0x10, 0x4F, 0x00, 0x37, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x37, 0x10, 0x4F, 0x08, 0x87, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07,
+    // 0x2195 '↕'
+    0x00, 0x00, 0x07, 0x04, 0x03, 0x07, 0x08, 0x04, 0x87, 0x01, 0x00, 0x47,
+    0x00, 0x00, 0x27, 0x07, 0xFF, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x07, 0xFF, 0x17, 0x00, 0x00, 0x27, 0x01, 0x04, 0x47, 0x08, 0x04, 0x87,
+    0x04, 0x03, 0x07, 0x00, 0x00, 0x07,
+    // 0x21D0 '⇐'
+    0x00, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x7F,
+    0x01, 0x40, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x0D, 0x00, 0x7F,
+    0x11, 0x00, 0x7F, 0x21, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x08, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D1 '⇑'
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x1F,
+    0x01, 0x00, 0x1F, 0x01, 0xFF, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
+    0x90, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    0x01, 0xFF, 0xFF, 0x01, 0x00, 0x1F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D2 '⇒'
+    0x00, 0x00, 0x7F, 0x01, 0x08, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F,
+    0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x21, 0x00, 0x7F, 0x11, 0x00, 0x7F,
+    0x0D, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x01, 0x40, 0x7F,
+    0x00, 0x80, 0x7F, 0x02, 0x00, 0x7F, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+    // 0x21D3 '⇓'
+    0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0xBF, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F,
+    0xBF, 0xF8, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x1F,
+    0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F,
+    // 0x21D4 '⇔'
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x03, 0x0A, 0x01, 0x2A, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x2A, 0x05,
+    0x1A, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    // 0x2202 '∂'
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0x04, 0x7F, 0x00, 0x08, 0x00, 0x7F,
+    0x10, 0x10, 0x01, 0x7F, 0x08, 0x20, 0x00, 0x7F, 0x40, 0x42, 0x08, 0x7F,
+    0x10, 0x08, 0x04, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x80, 0x80, 0x08, 0x7F,
+    0x90, 0x80, 0x11, 0x7F, 0x08, 0x10, 0x42, 0x7F, 0x03, 0x8C, 0x00, 0x7F,
+    0x40, 0x00, 0x08, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x80, 0x7F,
+    0x03, 0xF8, 0x00, 0x7F,
+    // 0x2206 '∆'
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x23, 0x00, 0x01, 0x03, 0x00, 0x04, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x80, 0x93, 0x02, 0x02, 0x13, 0x10, 0x10, 0x13,
+    0x00, 0x80, 0x13, 0x02, 0x00, 0x13, 0x01, 0x00, 0x13, 0x00, 0x20, 0x13,
+    0x00, 0x04, 0x13, 0x10, 0x00, 0x93, 0x02, 0x00, 0x03, 0x00, 0x80, 0x03,
+    0x00, 0x10, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x1F,
+    // 0x220F '∏'
+    0xA0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x1F, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x7F,
+    0x20, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x3F,
+    // 0x2211 '∑'
+    0x20, 0x00, 0x02, 0xBF, 0x88, 0x00, 0x00, 0x7F, 0x84, 0x00, 0x10, 0x7F,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x7F,
+    0x00, 0x12, 0x10, 0x7F, 0x04, 0x00, 0x20, 0x7F, 0x01, 0x00, 0x00, 0x7F,
+    0x00, 0x80, 0x00, 0x7F, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x0C, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0x00, 0x00, 0x7F,
+    0x02, 0x00, 0x20, 0x3F, 0x80, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x23, 0x3F,
+    0x00, 0x00, 0x00, 0x3F,
+    // 0x221A '√'
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x04, 0x07,
+    0x00, 0x08, 0x00, 0xC7, 0x00, 0x01, 0x80, 0x07, 0x00, 0x00, 0x18, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0xC0, 0x27,
+    0x00, 0x04, 0x01, 0x07, 0x00, 0x20, 0x18, 0x07, 0x03, 0x00, 0x80, 0x07,
+    0x10, 0x04, 0x00, 0x07, 0x00, 0x20, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07,
+    0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+    // 0x221E '∞'
+    0x0F, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x8A, 0x3F, 0x80, 0x3F, 0x80, 0x3F,
+    0x90, 0x1F, 0x00, 0x5F, 0x20, 0x9F, 0x00, 0x1F, 0x20, 0x1F, 0x4A, 0x1F,
+    0x11, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x8E, 0x3F, 0x00, 0x1F, 0x00, 0x9F,
+    0x00, 0x1F,
+    // 0x222B '∫'
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x0C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x90, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x2260 '≠'
+    0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x42, 0x02, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x00, 0x40, 0x02, 0x40, 0x12, 0x40,
+    0x02, 0x40, 0x02, 0x40,
+    // 0x2264 '≤'
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x3F, 0x00, 0x80, 0x3F, 0x08, 0x00, 0x3F,
+    0x00, 0x40, 0x3F, 0x12, 0x00, 0x3F, 0x01, 0x20, 0x3F, 0x24, 0x00, 0x3F,
+    0x00, 0x90, 0x3F, 0x48, 0x00, 0x3F, 0x00, 0x48, 0x3F, 0x90, 0x00, 0x3F,
+    0x80, 0x24, 0x3F, 0x20, 0x10, 0x3F,
+    // 0x2265 '≥'
+    0x00, 0x00, 0x1F, 0x30, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x48, 0x04, 0x1F,
+    0x00, 0x20, 0x1F, 0x24, 0x08, 0x1F, 0x00, 0x40, 0x1F, 0x12, 0x10, 0x1F,
+    0x00, 0x80, 0x1F, 0x09, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x04, 0x40, 0x1F,
+    0x00, 0x00, 0x1F, 0x02, 0x80, 0x1F,
+    // 0x2500 '─'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2502 '│'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x250C '┌'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2510 '┐'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2514 '└'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2518 '┘'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x251C '├'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2524 '┤'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x252C '┬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2534 '┴'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x253C '┼'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2550 '═'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2551 '║'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2554 '╔'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2557 '╗'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255A '╚'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x255D '╝'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2560 '╠'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2563 '╣'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2566 '╦'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x2569 '╩'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF,
+    // 0x256C '╬'
+    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05,
+    0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x05, 0x80, 0x00, 0x01,
+    0x7F, 0xFF, 0xFF
+};
+
+
+const uint32_t Bookerly30BoldItalicColOffsets[] PROGMEM = {
+    0x0, 0x1E, 0x3C, 0x54, 0x8D, 0xD1, 0x122, 0x16D, 0x179, 0x1AD, 0x1E5, 0x1FD,
+    0x219, 0x22B, 0x235, 0x23B, 0x271, 0x2AA, 0x2D1, 0x307, 0x33A, 0x370, 0x3A6, 0x3DC,
+    0x40F, 0x442, 0x47B, 0x496, 0x4BA, 0x4D6, 0x4F2, 0x50E, 0x52C, 0x59C, 0x5E4, 0x620,
+    0x65C, 0x6A4, 0x6E3, 0x71F, 0x75E, 0x7B2, 0x7E2, 0x832, 0x87D, 0x8B6, 0x90D, 0x95B,
+    0x99D, 0x9DC, 0xA44, 0xA86, 0xABC, 0xAF8, 0xB3D, 0xB82, 0xBDC, 0xC27, 0xC66, 0xCA2,
+    0xCDA, 0xD01, 0xD39, 0xD57, 0xD66, 0xD74, 0xDAA, 0xDEA, 0xE14, 0xE5C, 0xE86, 0xEE2,
+    0xF36, 0xF7E, 0xF99, 0xFDD, 0x101D, 0x1041, 0x108F, 0x10C5, 0x10F5, 0x1131, 0x1164, 0x1191,
+    0x11BB, 0x11E2, 0x1218, 0x1248, 0x128D, 0x12C6, 0x131A, 0x134A, 0x137E, 0x13A6, 0x13DA, 0x13E9,
+    0x1407, 0x1447, 0x1483, 0x14A9, 0x14E8, 0x1515, 0x155A, 0x1574, 0x1596, 0x15C9, 0x15E1, 0x160B,
+    0x1625, 0x163B, 0x168F, 0x16DF, 0x16E5, 0x16F9, 0x1711, 0x1735, 0x1792, 0x17EF, 0x184C, 0x186A,
+    0x18CA, 0x192A, 0x198A, 0x19EA, 0x1A4A, 0x1AAA, 0x1B0A, 0x1B5A, 0x1BAE, 0x1C02, 0x1C56, 0x1CAA,
+    0x1CEA, 0x1D2A, 0x1D6A, 0x1DAA, 0x1DF2, 0x1E5A, 0x1EB2, 0x1F0A, 0x1F62, 0x1FBA, 0x2012, 0x202C,
+    0x2074, 0x20D0, 0x212C, 0x2188, 0x21E4, 0x2220, 0x2284, 0x22CC, 0x2314, 0x235C, 0x23A4, 0x23DA,
+    0x2422, 0x2467, 0x249F, 0x24D7, 0x2513, 0x254F, 0x257C, 0x25A0, 0x25D0, 0x25FC, 0x2620, 0x2660,
+    0x26A8, 0x26E8, 0x2728, 0x2768, 0x27AC, 0x27DF, 0x27FB, 0x2837, 0x287F, 0x28C7, 0x290F, 0x2945,
+    0x2991, 0x29E5, 0x2A45, 0x2A7B, 0x2ACB, 0x2B07, 0x2B57, 0x2B97, 0x2BF7, 0x2C53, 0x2CA7, 0x2CD1,
+    0x2D25, 0x2D65, 0x2DB1, 0x2DDD, 0x2E19, 0x2E51, 0x2E8A, 0x2EBA, 0x2F22, 0x2F6A, 0x2FD2, 0x301A,
+    0x3074, 0x30BC, 0x3114, 0x3154, 0x319C, 0x31D8, 0x3220, 0x3260, 0x32B0, 0x32EC, 0x3348, 0x3390,
+    0x33EC, 0x3434, 0x3488, 0x34D8, 0x3518, 0x3568, 0x35A8, 0x35F8, 0x3638, 0x3674, 0x36B6, 0x36C5,
+    0x36E3, 0x36F1, 0x36FF, 0x370D, 0x371B, 0x3737, 0x3751, 0x376B, 0x3785, 0x37AF, 0x37DF, 0x37E6,
+    0x3800, 0x3812, 0x3826, 0x3840, 0x385A, 0x3872, 0x388C, 0x38A4, 0x38BC, 0x38D6, 0x38F0, 0x3904,
+    0x391E, 0x3934, 0x394E, 0x3966, 0x3980, 0x3998, 0x39B0, 0x39CA, 0x39F1, 0x3A18, 0x3A57, 0x3A7E,
+    0x3AA5, 0x3ACC, 0x3AF8, 0x3B52, 0x3BAF, 0x3C0C, 0x3C69, 0x3CC6, 0x3D3E, 0x3D66, 0x3D90, 0x3DB8,
+    0x3DE2, 0x3E0A, 0x3E34, 0x3E70, 0x3EA6, 0x3EE2, 0x3F18, 0x3F40, 0x3F80, 0x3FBC, 0x401C, 0x4068,
+    0x40B8, 0x40DE, 0x4122, 0x413E, 0x4168, 0x4192, 0x41B9, 0x41E0, 0x4207, 0x422E, 0x4255, 0x427C,
+    0x42A3, 0x42CA, 0x42F1, 0x4318, 0x433F, 0x4366, 0x438D, 0x43B4, 0x43DB, 0x4402, 0x4429, 0x4450,
+    0x4477, 0x449E, 0x44C5
+};
+
+
 const SimpleGFXfont Bookerly30BoldItalic PROGMEM = {Bookerly30BoldItalicBitmaps, Bookerly30BoldItalicBitmaps_lsb, Bookerly30BoldItalicBitmaps_msb, Bookerly30BoldItalicGlyphs,
-    315, 32};
+    315, 32,
+    nullptr, 0, FontStyle::REGULAR, Bookerly30BoldItalicGlyphIndexLatin1, Bookerly30BoldItalicGlyphRanges, 13,
+    Bookerly30BoldItalicBitmapsCol, Bookerly30BoldItalicBitmapsCol_lsb, Bookerly30BoldItalicBitmapsCol_msb, Bookerly30BoldItalicColOffsets};
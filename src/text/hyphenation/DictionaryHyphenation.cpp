@@ -0,0 +1,264 @@
+#include "DictionaryHyphenation.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "Liang/hyphenation.h"
+
+// File layout (little endian), see scripts/generate_hyphenation_trie.py:
+//   magic "HYPD", u8 version, u8 min word, u8 min left, u8 min right,
+//   u32 trie size, u32 exceptions size, trie, exceptions
+static const char DICTIONARY_MAGIC[4] = {'H', 'Y', 'P', 'D'};
+static constexpr uint8_t DICTIONARY_VERSION = 1;
+static constexpr size_t BLOCK_BYTES = DictionaryHyphenation::BLOCK_SIZE + HYPHENATION_TRIE_MAX_NODE_SIZE;
+static constexpr uint32_t BLOCK_NONE = 0xFFFFFFFF;
+static constexpr int MAX_POSITIONS = 32;
+
+static uint32_t getU32_hd(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t fnv1a32_hd(uint32_t h, const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static inline uint8_t asciiLower(uint8_t c) {
+  return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + 32) : c;
+}
+
+// Orders a dictionary word against the text word (ASCII letters compared lower-case)
+static int compareException(const uint8_t* entry, size_t entryLength, const std::string& word) {
+  const size_t n = std::min(entryLength, word.length());
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t c = asciiLower((uint8_t)word[i]);
+    if (entry[i] != c) {
+      return entry[i] < c ? -1 : 1;
+    }
+  }
+  if (entryLength == word.length()) {
+    return 0;
+  }
+  return entryLength < word.length() ? -1 : 1;
+}
+
+DictionaryHyphenation::DictionaryHyphenation() {
+  for (int i = 0; i < BLOCK_COUNT; i++) {
+    blockStart_[i] = BLOCK_NONE;
+    blockUsed_[i] = 0;
+  }
+}
+
+DictionaryHyphenation::~DictionaryHyphenation() {
+  if (file_) {
+    file_.close();
+  }
+  free(trie_);
+  free(blocks_);
+  free(exceptionData_);
+}
+
+DictionaryHyphenation* DictionaryHyphenation::open(const char* path, size_t residentMax) {
+  if (!path || !SD.exists(path)) {
+    return nullptr;
+  }
+  DictionaryHyphenation* dictionary = new DictionaryHyphenation();
+  if (!dictionary->load(path, residentMax)) {
+    delete dictionary;
+    return nullptr;
+  }
+  return dictionary;
+}
+
+bool DictionaryHyphenation::load(const char* path, size_t residentMax) {
+  file_ = SD.open(path);
+  if (!file_) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (file_.read(header, sizeof(header)) != sizeof(header) || memcmp(header, DICTIONARY_MAGIC, 4) != 0 ||
+      header[4] != DICTIONARY_VERSION) {
+    Serial.printf("Hyphenation dictionary %s: bad header\n", path);
+    return false;
+  }
+  minWord_ = header[5];
+  minLeft_ = header[6];
+  minRight_ = header[7];
+  const uint32_t trieSize = getU32_hd(header + 8);
+  const uint32_t exceptionSize = getU32_hd(header + 12);
+  if (trieSize <= HYPHENATION_TRIE_HEADER_SIZE || (uint64_t)HEADER_SIZE + trieSize + exceptionSize != file_.size() ||
+      exceptionSize > EXCEPTIONS_MAX) {
+    Serial.printf("Hyphenation dictionary %s: bad sizes\n", path);
+    return false;
+  }
+
+  uint8_t trieHeader[HYPHENATION_TRIE_HEADER_SIZE];
+  if (file_.read(trieHeader, sizeof(trieHeader)) != sizeof(trieHeader) || memcmp(trieHeader, "HYP", 3) != 0 ||
+      trieHeader[3] != HYPHENATION_TRIE_VERSION) {
+    Serial.printf("Hyphenation dictionary %s: unsupported trie\n", path);
+    return false;
+  }
+  if (!loadExceptions(HEADER_SIZE + trieSize, exceptionSize)) {
+    Serial.printf("Hyphenation dictionary %s: bad exceptions\n", path);
+    return false;
+  }
+
+  uint32_t id = fnv1a32_hd(2166136261u, header, sizeof(header));
+  patterns_.size = trieSize;
+  trieOffset_ = HEADER_SIZE;
+  if (trieSize <= residentMax) {
+    // Zero padding lets the matcher read a whole node even at the end
+    trie_ = (uint8_t*)malloc(trieSize + HYPHENATION_TRIE_MAX_NODE_SIZE);
+    if (!trie_) {
+      Serial.printf("Hyphenation dictionary %s: out of memory\n", path);
+      return false;
+    }
+    memset(trie_ + trieSize, 0, HYPHENATION_TRIE_MAX_NODE_SIZE);
+    file_.seek(trieOffset_);
+    if (file_.read(trie_, trieSize) != trieSize) {
+      return false;
+    }
+    file_.close();
+    id = fnv1a32_hd(id, trie_, trieSize);
+    patterns_.trie = trie_;
+  } else {
+    blocks_ = (uint8_t*)malloc(BLOCK_BYTES * BLOCK_COUNT);
+    if (!blocks_) {
+      Serial.printf("Hyphenation dictionary %s: out of memory\n", path);
+      return false;
+    }
+    patterns_.read = &DictionaryHyphenation::readNode;
+    patterns_.context = this;
+    // Checksum the trie in one sequential pass (the blocks are still unused)
+    file_.seek(trieOffset_);
+    for (uint32_t done = 0; done < trieSize;) {
+      const size_t n = std::min((size_t)(trieSize - done), BLOCK_BYTES * BLOCK_COUNT);
+      if (file_.read(blocks_, n) != n) {
+        Serial.printf("Hyphenation dictionary %s: read failed\n", path);
+        return false;
+      }
+      id = fnv1a32_hd(id, blocks_, n);
+      done += n;
+    }
+  }
+  rulesId_ = fnv1a32_hd(id, exceptionData_, exceptionSize);
+
+  Serial.printf("Hyphenation dictionary %s: %u trie bytes (%s), %u exceptions\n", path, (unsigned)trieSize,
+                trie_ ? "in RAM" : "on SD", (unsigned)exceptions_.size());
+  return true;
+}
+
+bool DictionaryHyphenation::loadExceptions(uint32_t offset, uint32_t size) {
+  if (size == 0) {
+    return true;
+  }
+  exceptionData_ = (uint8_t*)malloc(size);
+  if (!exceptionData_) {
+    return false;
+  }
+  file_.seek(offset);
+  if (file_.read(exceptionData_, size) != size) {
+    return false;
+  }
+
+  // Each entry: u8 length, word, u8 count, u8 positions[count]
+  size_t pos = 0;
+  while (pos < size) {
+    const size_t length = exceptionData_[pos];
+    if (pos + 1 + length + 1 > size) {
+      return false;
+    }
+    const size_t count = exceptionData_[pos + 1 + length];
+    if (pos + 2 + length + count > size) {
+      return false;
+    }
+    exceptions_.push_back((uint32_t)pos);
+    pos += 2 + length + count;
+  }
+  return true;
+}
+
+const uint8_t* DictionaryHyphenation::readNode(void* context, uint32_t offset) {
+  DictionaryHyphenation* self = static_cast<DictionaryHyphenation*>(context);
+  const uint32_t start = offset & ~(uint32_t)(BLOCK_SIZE - 1);
+  self->blockClock_++;
+
+  int slot = 0;
+  for (int i = 0; i < BLOCK_COUNT; i++) {
+    if (self->blockStart_[i] == start) {
+      self->blockUsed_[i] = self->blockClock_;
+      return self->blocks_ + i * BLOCK_BYTES + (offset - start);
+    }
+    if (self->blockUsed_[i] < self->blockUsed_[slot]) {
+      slot = i;
+    }
+  }
+
+  // Read the block and the overlap, so a node starting near its end is whole
+  uint8_t* block = self->blocks_ + slot * BLOCK_BYTES;
+  const size_t length = std::min(BLOCK_BYTES, (size_t)(self->patterns_.size - start));
+  self->file_.seek(self->trieOffset_ + start);
+  if (self->file_.read(block, length) != length) {
+    self->blockStart_[slot] = BLOCK_NONE;
+    return nullptr;
+  }
+  memset(block + length, 0, BLOCK_BYTES - length);
+  self->blockStart_[slot] = start;
+  self->blockUsed_[slot] = self->blockClock_;
+  self->blockReads_++;
+  return block + (offset - start);
+}
+
+bool DictionaryHyphenation::findException(const std::string& word, size_t minLeft, size_t minRight,
+                                          std::vector<size_t>& out) const {
+  size_t lo = 0;
+  size_t hi = exceptions_.size();
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    const uint8_t* entry = exceptionData_ + exceptions_[mid];
+    const int order = compareException(entry + 1, entry[0], word);
+    if (order == 0) {
+      const uint8_t* positions = entry + 2 + entry[0];
+      for (size_t i = 0; i < entry[1 + entry[0]]; i++) {
+        if (positions[i] >= minLeft && positions[i] + minRight <= word.length()) {
+          out.push_back(positions[i]);
+        }
+      }
+      return true;
+    }
+    if (order < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return false;
+}
+
+std::vector<size_t> DictionaryHyphenation::hyphenate(const std::string& word, size_t minWordLength, size_t minLeft,
+                                                     size_t minRight) {
+  minWordLength = std::max(minWordLength, (size_t)minWord_);
+  minLeft = std::max(minLeft, (size_t)minLeft_);
+  minRight = std::max(minRight, (size_t)minRight_);
+
+  std::vector<size_t> positions;
+  if (word.length() < minWordLength) {
+    return positions;
+  }
+  if (findException(word, minLeft, minRight, positions)) {
+    return positions;
+  }
+
+  size_t out_positions[MAX_POSITIONS];
+  const int count = liang_hyphenate(word.c_str(), minLeft, minRight, '.', out_positions, MAX_POSITIONS, patterns_);
+  if (count > 0) {
+    positions.assign(out_positions, out_positions + std::min(count, MAX_POSITIONS));
+  }
+  return positions;
+}
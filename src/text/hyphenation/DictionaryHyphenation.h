@@ -0,0 +1,86 @@
+#ifndef DICTIONARY_HYPHENATION_H
+#define DICTIONARY_HYPHENATION_H
+
+#include <SD.h>
+
+#include "HyphenationStrategy.h"
+#include "Liang/liang_hyphenation_patterns.h"
+
+/**
+ * DictionaryHyphenation - Liang hyphenation with patterns loaded from SD.
+ *
+ * A dictionary file (`<language tag>.hyph`, written by
+ * scripts/generate_hyphenation_trie.py) holds the packed pattern trie, an
+ * exceptions list and the language's minima. Small tries are read into RAM
+ * once; larger ones stay on SD and the nodes the matcher visits are read
+ * through a few cached blocks, so only the active language costs memory and
+ * a large dictionary costs a fixed few KB.
+ */
+class DictionaryHyphenation : public HyphenationStrategy {
+ public:
+  static constexpr size_t RESIDENT_TRIE_MAX = 32 * 1024;
+
+  // Loads the dictionary at `path`; nullptr if it is missing or not valid.
+  // Tries up to `residentMax` bytes are read into RAM, larger ones streamed.
+  static DictionaryHyphenation* open(const char* path, size_t residentMax = RESIDENT_TRIE_MAX);
+  ~DictionaryHyphenation() override;
+
+  // The minima used are the larger of the arguments and the dictionary's own
+  std::vector<size_t> hyphenate(const std::string& word, size_t minWordLength = 6, size_t minLeft = 3,
+                                size_t minRight = 3) override;
+
+  Language getLanguage() const override {
+    return Language::DICTIONARY;
+  }
+  // FNV-1a of the whole file, so an updated dictionary gets a new id
+  uint32_t getRulesId() const override {
+    return rulesId_;
+  }
+
+  // True if the whole trie is in RAM, false if nodes are read from SD
+  bool isResident() const {
+    return trie_ != nullptr;
+  }
+  // Blocks read from SD since the dictionary was opened
+  uint32_t getBlockReads() const {
+    return blockReads_;
+  }
+  size_t getExceptionCount() const {
+    return exceptions_.size();
+  }
+
+  static constexpr size_t HEADER_SIZE = 16;
+  static constexpr size_t EXCEPTIONS_MAX = 16 * 1024;
+  static constexpr size_t BLOCK_SIZE = 512;
+  static constexpr int BLOCK_COUNT = 8;
+
+ private:
+  DictionaryHyphenation();
+  bool load(const char* path, size_t residentMax);
+  bool loadExceptions(uint32_t offset, uint32_t size);
+  static const uint8_t* readNode(void* context, uint32_t offset);
+  bool findException(const std::string& word, size_t minLeft, size_t minRight, std::vector<size_t>& out) const;
+
+  // Byte offsets into exceptionData_ of each entry, in the file's sorted order
+  std::vector<uint32_t> exceptions_;
+  uint8_t* exceptionData_ = nullptr;
+
+  HyphenationPatterns patterns_ = {};
+  uint8_t* trie_ = nullptr;  // Resident trie, padded so any node can be read whole
+
+  // Streamed trie: blocks of BLOCK_SIZE bytes (plus one node of overlap), least recently used replaced
+  File file_;
+  uint32_t trieOffset_ = 0;
+  uint8_t* blocks_ = nullptr;
+  uint32_t blockStart_[BLOCK_COUNT];
+  uint32_t blockUsed_[BLOCK_COUNT];
+  uint32_t blockClock_ = 0;
+  uint32_t blockReads_ = 0;
+
+  uint32_t rulesId_ = 0;
+  uint8_t minWord_ = 0;
+  uint8_t minLeft_ = 0;
+  uint8_t minRight_ = 0;
+};
+
+#endif  // DICTIONARY_HYPHENATION_H
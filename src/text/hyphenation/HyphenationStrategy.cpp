@@ -1,8 +1,15 @@
 #include "HyphenationStrategy.h"
 
+#include <cstring>
+
+#include "DictionaryHyphenation.h"
 #include "EnglishHyphenation.h"
 #include "GermanHyphenation.h"
 
+HyphenationStrategy::HyphenationStrategy() {
+  memset(hyphenBuckets_, HYPHEN_CACHE_NONE, sizeof(hyphenBuckets_));
+}
+
 // Implementation of the base class method
 std::vector<int> HyphenationStrategy::findHyphenPositions(const std::string& word, size_t minWordLength, size_t minLeft,
                                                           size_t minRight) {
@@ -30,6 +37,92 @@ std::vector<int> HyphenationStrategy::findHyphenPositions(const std::string& wor
   return positions;
 }
 
+HyphenationStrategy::HyphenPositions HyphenationStrategy::findHyphenPositionsCached(const char* word,
+                                                                                    size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)word[i]) * 16777619u;
+  }
+
+  uint8_t* bucket = &hyphenBuckets_[hash & (HYPHEN_CACHE_BUCKETS - 1)];
+  for (uint8_t i = *bucket; i != HYPHEN_CACHE_NONE; i = hyphenCache_[i].nextInBucket) {
+    HyphenCacheEntry& entry = hyphenCache_[i];
+    if (entry.hash == hash && entry.length == length && memcmp(entry.bytes, word, length) == 0) {
+      hyphenCacheHits_++;
+      if (i != lruNewest_) {
+        unlinkLru(i);
+        pushLruFront(i);
+      }
+      return {entry.positions, entry.count};
+    }
+  }
+  hyphenCacheMisses_++;
+
+  const std::vector<int> positions = findHyphenPositions(std::string(word, length));
+  if (length > (size_t)HYPHEN_CACHE_MAX_BYTES || positions.size() > (size_t)HYPHEN_CACHE_MAX_POSITIONS) {
+    uncachedPositions_.assign(positions.begin(), positions.end());
+    return {uncachedPositions_.data(), uncachedPositions_.size()};
+  }
+
+  // Take a free entry, or recycle the least recently used one
+  uint8_t index;
+  if (hyphenCacheUsed_ < HYPHEN_CACHE_SIZE) {
+    index = hyphenCacheUsed_++;
+  } else {
+    index = lruOldest_;
+    unlinkLru(index);
+    removeFromBucket(index);
+    hyphenCacheEvictions_++;
+  }
+
+  HyphenCacheEntry& entry = hyphenCache_[index];
+  entry.hash = hash;
+  entry.length = (uint8_t)length;
+  entry.count = (uint8_t)positions.size();
+  memcpy(entry.bytes, word, length);
+  for (size_t i = 0; i < positions.size(); i++) {
+    entry.positions[i] = (int16_t)positions[i];
+  }
+  entry.nextInBucket = *bucket;
+  *bucket = index;
+  pushLruFront(index);
+  return {entry.positions, entry.count};
+}
+
+void HyphenationStrategy::unlinkLru(uint8_t index) {
+  HyphenCacheEntry& entry = hyphenCache_[index];
+  if (entry.newer != HYPHEN_CACHE_NONE) {
+    hyphenCache_[entry.newer].older = entry.older;
+  } else {
+    lruNewest_ = entry.older;
+  }
+  if (entry.older != HYPHEN_CACHE_NONE) {
+    hyphenCache_[entry.older].newer = entry.newer;
+  } else {
+    lruOldest_ = entry.newer;
+  }
+}
+
+void HyphenationStrategy::pushLruFront(uint8_t index) {
+  HyphenCacheEntry& entry = hyphenCache_[index];
+  entry.newer = HYPHEN_CACHE_NONE;
+  entry.older = lruNewest_;
+  if (lruNewest_ != HYPHEN_CACHE_NONE) {
+    hyphenCache_[lruNewest_].newer = index;
+  } else {
+    lruOldest_ = index;
+  }
+  lruNewest_ = index;
+}
+
+void HyphenationStrategy::removeFromBucket(uint8_t index) {
+  uint8_t* link = &hyphenBuckets_[hyphenCache_[index].hash & (HYPHEN_CACHE_BUCKETS - 1)];
+  while (*link != index) {
+    link = &hyphenCache_[*link].nextInBucket;
+  }
+  *link = hyphenCache_[index].nextInBucket;
+}
+
 /**
  * Factory function implementation
  */
@@ -46,3 +139,32 @@ HyphenationStrategy* createHyphenationStrategy(Language language) {
       return new NoHyphenation();
   }
 }
+
+HyphenationStrategy* createHyphenationStrategyForTag(const char* languageTag, Language fallback, const char* dir) {
+  // Lower-case the tag, '_' as '-'; anything else that is not a tag character is not looked up
+  static constexpr size_t MAX_TAG_LENGTH = 15;
+  char tag[MAX_TAG_LENGTH + 1];
+  size_t length = 0;
+  bool valid = languageTag && dir;
+  for (const char* p = languageTag; valid && *p; p++) {
+    char c = *p;
+    if (c >= 'A' && c <= 'Z') {
+      c += 32;
+    } else if (c == '_') {
+      c = '-';
+    }
+    valid = length < MAX_TAG_LENGTH && ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-');
+    tag[length++] = c;
+  }
+
+  while (valid && length > 0) {
+    tag[length] = '\0';
+    const std::string path = std::string(dir) + "/" + tag + ".hyph";
+    if (DictionaryHyphenation* dictionary = DictionaryHyphenation::open(path.c_str())) {
+      return dictionary;
+    }
+    const char* dash = strchr(tag, '-');
+    length = dash ? (size_t)(dash - tag) : 0;  // Then the primary language subtag
+  }
+  return createHyphenationStrategy(fallback);
+}
@@ -1,6 +1,8 @@
 #ifndef HYPHENATION_STRATEGY_H
 #define HYPHENATION_STRATEGY_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -8,10 +10,11 @@
  * Supported languages for hyphenation
  */
 enum class Language {
-  NONE,     // No hyphenation at all
-  BASIC,    // Only split on existing hyphens in text
-  ENGLISH,  // English hyphenation (not yet implemented)
-  GERMAN,   // German hyphenation
+  NONE,        // No hyphenation at all
+  BASIC,       // Only split on existing hyphens in text
+  ENGLISH,     // English hyphenation (not yet implemented)
+  GERMAN,      // German hyphenation
+  DICTIONARY,  // Patterns loaded from a dictionary file on SD (DictionaryHyphenation)
   // Add more languages here as needed
 };
 
@@ -22,6 +25,7 @@ enum class Language {
  */
 class HyphenationStrategy {
  public:
+  HyphenationStrategy();
   virtual ~HyphenationStrategy() = default;
 
   /**
@@ -53,10 +57,85 @@ class HyphenationStrategy {
   std::vector<int> findHyphenPositions(const std::string& word, size_t minWordLength = 6, size_t minLeft = 3,
                                        size_t minRight = 3);
 
+  // View of hyphen positions in the findHyphenPositions() encoding
+  struct HyphenPositions {
+    const int16_t* positions;
+    size_t count;
+  };
+
+  /**
+   * findHyphenPositions() with the default minima, memoized in a small LRU
+   * cache of recent words. Layout asks for the same words again and again
+   * (forward layout, backward page search, re-layout), so a hit returns the
+   * stored positions without converting the word or allocating.
+   *
+   * The view stays valid until the next call. Words longer than
+   * HYPHEN_CACHE_MAX_BYTES (or with too many positions) are not cached.
+   */
+  HyphenPositions findHyphenPositionsCached(const char* word, size_t length);
+
+  // Hyphen cache statistics (lookups answered from the cache vs computed)
+  uint32_t getHyphenCacheHits() const {
+    return hyphenCacheHits_;
+  }
+  uint32_t getHyphenCacheMisses() const {
+    return hyphenCacheMisses_;
+  }
+  uint32_t getHyphenCacheEvictions() const {
+    return hyphenCacheEvictions_;
+  }
+  void resetHyphenCacheStats() {
+    hyphenCacheHits_ = 0;
+    hyphenCacheMisses_ = 0;
+    hyphenCacheEvictions_ = 0;
+  }
+
   /**
    * Get the language this strategy handles
    */
   virtual Language getLanguage() const = 0;
+
+  /**
+   * Identifies the rules beyond getLanguage(), for caches of layout results:
+   * 0 for built-in patterns, a checksum of the file for a dictionary
+   */
+  virtual uint32_t getRulesId() const {
+    return 0;
+  }
+
+  static constexpr int HYPHEN_CACHE_SIZE = 64;
+  static constexpr int HYPHEN_CACHE_MAX_BYTES = 31;
+  static constexpr int HYPHEN_CACHE_MAX_POSITIONS = 12;
+
+ private:
+  static constexpr int HYPHEN_CACHE_BUCKETS = 64;  // Power of two
+  static constexpr uint8_t HYPHEN_CACHE_NONE = 0xFF;
+
+  // Fixed-size entries linked into a hash bucket chain and the LRU list
+  struct HyphenCacheEntry {
+    uint32_t hash;
+    uint8_t length;
+    uint8_t count;
+    uint8_t nextInBucket;
+    uint8_t newer;
+    uint8_t older;
+    char bytes[HYPHEN_CACHE_MAX_BYTES];
+    int16_t positions[HYPHEN_CACHE_MAX_POSITIONS];
+  };
+
+  void unlinkLru(uint8_t index);
+  void pushLruFront(uint8_t index);
+  void removeFromBucket(uint8_t index);
+
+  HyphenCacheEntry hyphenCache_[HYPHEN_CACHE_SIZE];
+  uint8_t hyphenBuckets_[HYPHEN_CACHE_BUCKETS];
+  uint8_t hyphenCacheUsed_ = 0;
+  uint8_t lruNewest_ = HYPHEN_CACHE_NONE;
+  uint8_t lruOldest_ = HYPHEN_CACHE_NONE;
+  std::vector<int16_t> uncachedPositions_;  // Result for words the cache does not hold
+  uint32_t hyphenCacheHits_ = 0;
+  uint32_t hyphenCacheMisses_ = 0;
+  uint32_t hyphenCacheEvictions_ = 0;
 };
 
 /**
@@ -102,4 +181,19 @@ class ExistingHyphensOnly : public HyphenationStrategy {
  */
 HyphenationStrategy* createHyphenationStrategy(Language language);
 
+#ifdef TEST_BUILD
+#define HYPHENATION_DICTIONARY_DIR "test/output/hyphenation"
+#else
+#define HYPHENATION_DICTIONARY_DIR "/microreader/hyphenation"
+#endif
+
+/**
+ * Strategy for a BCP 47 language tag (e.g. an EPUB's dc:language). Loads
+ * `<dir>/<tag>.hyph` if present, trying the full tag ("en-gb") and then the
+ * primary language ("en"); otherwise falls back to the built-in strategy for
+ * `fallback`.
+ */
+HyphenationStrategy* createHyphenationStrategyForTag(const char* languageTag, Language fallback,
+                                                     const char* dir = HYPHENATION_DICTIONARY_DIR);
+
 #endif
@@ -12,48 +12,53 @@
 #define MAX_HYPHEN_POSITIONS 32
 #endif
 
-// Compare a pattern byte array `pat` of length `patlen` with a segment `seg` of
-// length `seglen`. Returns <0 if pat < seg, 0 if equal, >0 if pat > seg.
-static int compare_pattern_segment(const std::uint8_t* pat, int patlen, const char* seg, int seglen) {
-  int len = patlen < seglen ? patlen : seglen;
-  for (int i = 0; i < len; ++i) {
-    unsigned char a = (unsigned char)pat[i];
-    unsigned char b = (unsigned char)seg[i];
-    if (a != b)
-      return (int)a - (int)b;
+static constexpr std::uint8_t TRIE_HAS_PATTERN = 0x80;
+static constexpr std::uint8_t TRIE_CHILD_COUNT_MASK = 0x3F;
+
+// Node at `offset`, or nullptr past the end of the trie
+static const std::uint8_t* trie_node(const HyphenationPatterns& pats, std::uint32_t offset) {
+  if (offset < HYPHENATION_TRIE_HEADER_SIZE || offset >= pats.size)
+    return nullptr;
+  return pats.trie ? pats.trie + offset : pats.read(pats.context, offset);
+}
+
+// Offset of the child of a trie node for byte `c`, or 0
+static std::uint32_t trie_child(const std::uint8_t* node, std::uint8_t c) {
+  const int count = node[0] & TRIE_CHILD_COUNT_MASK;
+  const std::uint8_t* labels = node + 1;
+  if (node[0] & TRIE_HAS_PATTERN)
+    labels += 1 + ((labels[0] & 0x0F) + 1) / 2;
+  for (int k = 0; k < count; ++k) {
+    if (labels[k] < c)
+      continue;
+    if (labels[k] > c)
+      break;
+    const std::uint8_t* offset = labels + count + 3 * k;
+    return offset[0] | (offset[1] << 8) | ((std::uint32_t)offset[2] << 16);
   }
-  if (patlen < seglen)
-    return -1;  // pat shorter
-  if (patlen > seglen)
-    return 1;  // seg shorter
-  return 0;    // equal
+  return 0;
 }
 
-// Binary-search for a pattern equal to the segment `seg` of length `seglen`.
-// Returns index in `patterns` or -1 if not found.
-static int find_pattern_index(const char* seg, int seglen, const HyphenationPatterns& pats) {
-  if (pats.count == 0)
-    return -1;
-  int lo = 0;
-  int hi = (int)pats.count - 1;
-  while (lo <= hi) {
-    int mid = (lo + hi) >> 1;
-    int cmp = compare_pattern_segment(pats.patterns[mid].letters, pats.patterns[mid].letters_len, seg, seglen);
-    if (cmp == 0)
-      return mid;
-    if (cmp < 0)
-      lo = mid + 1;
-    else
-      hi = mid - 1;
+// Raise H[start..limit) to the values of the pattern ending at `node`
+static void apply_pattern(const std::uint8_t* node, std::uint8_t* H, int start, int limit) {
+  const std::uint8_t info = node[1];
+  const std::uint8_t* digits = node + 2;
+  const int first = start + (info >> 4);
+  int count = info & 0x0F;
+  if (first + count > limit)
+    count = limit - first;  // Only a damaged trie has patterns longer than the word
+  for (int l = 0; l < count; ++l) {
+    const std::uint8_t v = (digits[l >> 1] >> ((l & 1) * 4)) & 0x0F;
+    if (H[first + l] < v)
+      H[first + l] = v;
   }
-  return -1;
 }
 
 // Hyphenate into an output integer buffer. Returns number of positions written.
 // This function avoids heap allocations by using fixed-size local arrays.
 int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
                     int max_positions, const HyphenationPatterns& pats) {
-  if (!word)
+  if (!word || pats.size <= HYPHENATION_TRIE_HEADER_SIZE)
     return 0;
   int word_len = (int)std::strlen(word);
   if (word_len <= 0)
@@ -73,19 +78,14 @@ int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boun
   uint8_t H[MAX_WORD_LEN + 3];
   std::memset(H, 0, sizeof(H));
 
-  // Scan all substrings of ext and apply matching patterns
+  // Walk the trie once from each start position, applying each pattern that
+  // ends on the way (it matches ext[i..j])
   for (int i = 0; i < M; ++i) {
-    for (int j = i + 1; j <= M; ++j) {
-      int len = j - i;
-      int idx = find_pattern_index(ext + i, len, pats);
-      if (idx >= 0) {
-        const uint8_t* vals = pats.patterns[idx].values;
-        int vlen = pats.patterns[idx].values_len;
-        for (int l = 0; l < vlen && (i + l) < (int)sizeof(H); ++l) {
-          if (H[i + l] < vals[l])
-            H[i + l] = vals[l];
-        }
-      }
+    const std::uint8_t* node = trie_node(pats, HYPHENATION_TRIE_HEADER_SIZE);
+    for (int j = i; j < M && node; ++j) {
+      node = trie_node(pats, trie_child(node, (std::uint8_t)ext[j]));
+      if (node && (node[0] & TRIE_HAS_PATTERN))
+        apply_pattern(node, H, i, M + 1);
     }
   }
 
@@ -4,16 +4,22 @@
 #include <cstddef>
 #include <cstdint>
 
-struct PatternC {
-  const std::uint8_t* letters;
-  const std::uint8_t* values;
-  std::uint8_t letters_len;
-  std::uint8_t values_len;
-};
+// Packed pattern trie generated by scripts/generate_hyphenation_trie.py (the
+// node layout is documented there). The blob starts with "HYP" and a format
+// version byte; the root node follows.
+static constexpr std::uint8_t HYPHENATION_TRIE_VERSION = 1;
+static constexpr size_t HYPHENATION_TRIE_HEADER_SIZE = 4;
+static constexpr size_t HYPHENATION_TRIE_MAX_NODE_SIZE = 1 + 9 + 63 * 4;  // Flags, values, 63 children
+
+// Returns a pointer to at least HYPHENATION_TRIE_MAX_NODE_SIZE bytes of the
+// trie starting at `offset` (valid until the next call), or nullptr
+typedef const std::uint8_t* (*HyphenationTrieReadFn)(void* context, std::uint32_t offset);
 
 struct HyphenationPatterns {
-  const PatternC* patterns;
-  size_t count;
+  const std::uint8_t* trie;  // Whole trie in memory, or nullptr to read nodes through `read`
+  size_t size;
+  HyphenationTrieReadFn read;  // Left null for the built-in tables
+  void* context;
 };
 
 #endif  // HYPHENATION_PATTERNS_H
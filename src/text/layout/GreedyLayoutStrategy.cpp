@@ -16,8 +16,8 @@ GreedyLayoutStrategy::GreedyLayoutStrategy() {}
 
 GreedyLayoutStrategy::~GreedyLayoutStrategy() {}
 
-LayoutStrategy::PageLayout GreedyLayoutStrategy::layoutText(WordProvider& provider, TextRenderer& renderer,
-                                                            const LayoutConfig& config) {
+void GreedyLayoutStrategy::layoutPage(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                                      PageLayout& page) {
   const int16_t maxWidth = config.pageWidth - config.marginLeft - config.marginRight;
   const int16_t x = config.marginLeft;
   int16_t y = config.marginTop;
@@ -28,7 +28,7 @@ LayoutStrategy::PageLayout GreedyLayoutStrategy::layoutText(WordProvider& provid
   renderer.setFontStyle(FontStyle::REGULAR);
   renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
 
-  PageLayout result;
+  page.clear();
   int startIndex = provider.getCurrentIndex();
 
   while (y < maxY) {
@@ -69,7 +69,12 @@ LayoutStrategy::PageLayout GreedyLayoutStrategy::layoutText(WordProvider& provid
       }
     }
 
-    result.lines.push_back(line);
+    page.beginLine(line.alignment);
+    for (const Word& word : line.words) {
+      PageWord& placed = page.addWord(word.text.c_str(), word.text.length(), word.width, word.style, word.wasSplit);
+      placed.x = word.x;
+      placed.y = word.y;
+    }
     y += lineHeight;
     if (isParagraphEnd && !line.words.empty()) {
       const int16_t ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
@@ -82,11 +87,9 @@ LayoutStrategy::PageLayout GreedyLayoutStrategy::layoutText(WordProvider& provid
     }
   }
 
-  result.endPosition = provider.getCurrentIndex();
+  page.endPosition = provider.getCurrentIndex();
   // reset the provider to the start index
   provider.setPosition(startIndex);
-
-  return result;
 }
 
 void GreedyLayoutStrategy::renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) {
@@ -94,16 +97,17 @@ void GreedyLayoutStrategy::renderPage(const PageLayout& layout, TextRenderer& re
   const int16_t lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
   for (const auto& line : layout.lines) {
     // Skip/stop any lines that would draw into the reserved footer band.
-    if (line.words.empty()) {
+    if (line.wordCount == 0) {
       continue;
     }
-    if ((int32_t)line.words.front().y + (int32_t)lineHeight > (int32_t)maxY) {
+    const PageWord* words = layout.lineWords(line);
+    if ((int32_t)words[0].y + (int32_t)lineHeight > (int32_t)maxY) {
       break;
     }
-    for (const auto& word : line.words) {
-      renderer.setFontStyle(word.style);
-      renderer.setCursor(word.x, word.y);
-      renderer.print(word.text);
+    for (uint16_t i = 0; i < line.wordCount; i++) {
+      renderer.setFontStyle(words[i].style);
+      renderer.setCursor(words[i].x, words[i].y);
+      renderer.print(layout.wordText(words[i]));
     }
   }
 }
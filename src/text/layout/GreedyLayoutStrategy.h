@@ -15,7 +15,8 @@ class GreedyLayoutStrategy : public LayoutStrategy {
   }
 
   // Main interface implementation
-  PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config) override;
+  void layoutPage(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                  PageLayout& page) override;
   void renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) override;
 
  public:
@@ -1,7 +1,9 @@
 #include "KnuthPlassLayoutStrategy.h"
 
+#include "../../content/css/CssStyle.h"
 #include "../../content/providers/WordProvider.h"
 #include "../../rendering/TextRenderer.h"
+#include "../hyphenation/HyphenationStrategy.h"
 #include "WString.h"
 #ifdef ARDUINO
 #include <Arduino.h>
@@ -17,347 +19,731 @@ extern unsigned long millis();
 
 #define DEBUG_LAYOUT
 
+static int16_t measureText_kp(TextRenderer& renderer, const char* text, FontStyle style) {
+  int16_t bx = 0, by = 0;
+  uint16_t bw = 0, bh = 0;
+  renderer.setFontStyle(style);
+  renderer.getTextBounds(text, 0, 0, &bx, &by, &bw, &bh);
+  return static_cast<int16_t>(bw);
+}
+
+static inline bool isSpace_kp(const char* text) {
+  return text[0] == ' ';
+}
+
+// TeX's badness: about 100 * (t / s)^3, INF_BAD when the line cannot adjust enough
+static int32_t badness_kp(int32_t t, int32_t s, int32_t infBad) {
+  if (t == 0) {
+    return 0;
+  }
+  if (s <= 0) {
+    return infBad;
+  }
+  const int32_t r = (t <= 7230584) ? (t * 297) / s : t / std::max(s / 297, (int32_t)1);
+  if (r > 1290) {
+    return infBad;
+  }
+  return (r * r * r + 0x20000) / 0x40000;
+}
+
 KnuthPlassLayoutStrategy::KnuthPlassLayoutStrategy() {}
 
 KnuthPlassLayoutStrategy::~KnuthPlassLayoutStrategy() {}
 
-LayoutStrategy::PageLayout KnuthPlassLayoutStrategy::layoutText(WordProvider& provider, TextRenderer& renderer,
-                                                                const LayoutConfig& config) {
+void KnuthPlassLayoutStrategy::layoutPage(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                                          PageLayout& page) {
   const int16_t maxWidth = config.pageWidth - config.marginLeft - config.marginRight;
   int16_t y = config.marginTop;
   const int16_t maxY = config.pageHeight - config.marginBottom;
   const int16_t lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
+  const int16_t ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
 
   // Measure space width using renderer
   renderer.setFontStyle(FontStyle::REGULAR);
   renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
 
-  PageLayout result;
-  std::vector<ParagraphLayoutInfo> paragraphs;
-  std::vector<LayoutStrategy::Word> words;
+  page.clear();
+  const int startIndex = provider.getCurrentIndex();
+  if (!provider.hasNextWord()) {
+    page.endPosition = startIndex;
+    return;
+  }
 
-  int startIndex = provider.getCurrentIndex();
-  while (y < maxY) {
-    // Hard stop: don't start a new line if it would cross into reserved bottom area
-    if ((int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
-      break;
-    }
-    int16_t yStart = y;
-    int16_t lineCount = 0;
-    bool isParagraphEnd = false;
-    TextAlignment paragraphAlignment = config.alignment;  // Will be set by first line
+  // Continue the line breaks of the paragraph the page starts in
+  size_t lineIndex = 0;
+  const bool inSync = seekLine(provider, renderer, maxWidth, config.alignment, startIndex, lineIndex);
+  int firstChunkLines = inSync ? 0 : (int)(lines_.size() - lineIndex);
 
-    // Collect words for the paragraph
-    while (y < maxY && !isParagraphEnd) {
+  int endPosition = -1;
+  while (endPosition < 0) {
+    for (; lineIndex < lines_.size(); lineIndex++) {
+      const ParagraphLine& paragraphLine = lines_[lineIndex];
+      // Hard stop: don't start a new line if it would cross into reserved bottom area
       if ((int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
+        endPosition = paragraphLine.start;
         break;
       }
-      Line lineResult = getNextLine(provider, renderer, maxWidth, isParagraphEnd, config.alignment);
+      emitLine(paragraphLine, renderer, page);
+      positionLine(page, page.lines.back(), config.marginLeft, y, maxWidth, paragraphLine.last);
       y += lineHeight;
+      const bool nonEmpty = page.lines.back().wordCount > 0;
 
-      // Capture alignment from first line of paragraph
-      if (lineCount == 0 && !lineResult.words.empty()) {
-        paragraphAlignment = lineResult.alignment;
-      }
-
-      // Only count lines that have actual content
-      if (!lineResult.words.empty()) {
-        lineCount++;
-      }
-
-      // iterate line by line until paragraph end
-      for (size_t i = 0; i < lineResult.words.size(); i++) {
-        words.push_back(lineResult.words[i]);
+      if (paragraphLine.last && chunkEndsParagraph_ && nonEmpty) {
+        if ((int32_t)y + (int32_t)ps <= (int32_t)maxY) {
+          y += ps;
+        } else {
+          endPosition = chunkNext_;
+          break;
+        }
       }
     }
+    if (endPosition >= 0) {
+      break;
+    }
 
-    if (isParagraphEnd && lineCount > 0) {
-      const int16_t ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
-      if ((int32_t)y + (int32_t)ps <= (int32_t)maxY) {
-        y += ps;
-      } else {
-        break;
-      }
+    // Next paragraph (or the next chunk of this one)
+    provider.setPosition(chunkNext_);
+    if (!provider.hasNextWord() || (int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
+      endPosition = chunkNext_;
+      break;
     }
+    const bool nextInSync = chunkInSync_ || chunkEndsParagraph_;
+    breakParagraph(provider, renderer, maxWidth, config.alignment);
+    chunkInSync_ = nextInSync;
+    lineIndex = 0;
+  }
 
-    if (!words.empty()) {
-      // Calculate line breaks using Knuth-Plass algorithm
-      std::vector<size_t> breaks = calculateBreaks(words, maxWidth);
+  if (!inSync) {
+    lineCountMismatch_ = true;
+    expectedLineCount_ = (int)page.lines.size();
+    actualLineCount_ = (int)page.lines.size() - std::min(firstChunkLines, (int)page.lines.size());
+  }
 
-      if (lineCount != breaks.size() + 1) {
-        lineCountMismatch_ = true;
-        expectedLineCount_ = lineCount;
-        actualLineCount_ = breaks.size() + 1;
-      }
+  page.endPosition = endPosition;
+  // reset the provider to the start index
+  provider.setPosition(startIndex);
+}
 
-      // Convert breaks into lines and calculate positions
-      int16_t currentY = yStart;
+void KnuthPlassLayoutStrategy::renderPage(const PageLayout& layout, TextRenderer& renderer,
+                                          const LayoutConfig& config) {
+  const int16_t maxY = config.pageHeight - config.marginBottom;
+  const int16_t lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
+  for (const auto& line : layout.lines) {
+    const PageWord* words = layout.lineWords(line);
+    if (line.wordCount > 0 && (int32_t)words[0].y + (int32_t)lineHeight > (int32_t)maxY) {
+      break;
+    }
+    for (uint16_t i = 0; i < line.wordCount; i++) {
+      renderer.setFontStyle(words[i].style);
+      renderer.setCursor(words[i].x, words[i].y);
+      renderer.print(layout.wordText(words[i]));
+    }
+  }
+}
 
-      size_t lineStart = 0;
-      for (size_t breakIdx = 0; breakIdx <= breaks.size(); breakIdx++) {
-        size_t lineEnd = (breakIdx < breaks.size()) ? breaks[breakIdx] : words.size();
-        if (lineStart >= lineEnd)
-          break;
+int KnuthPlassLayoutStrategy::getPreviousPageStart(WordProvider& provider, TextRenderer& renderer,
+                                                   const LayoutConfig& config, int currentStartPosition) {
+  const int savedPosition = provider.getCurrentIndex();
 
-        // Hard stop: don't emit a line that would draw into reserved bottom area.
-        if ((int32_t)currentY + (int32_t)lineHeight > (int32_t)maxY) {
-          break;
-        }
+  const int16_t maxWidth = config.pageWidth - config.marginLeft - config.marginRight;
+  renderer.setFontStyle(FontStyle::REGULAR);
+  renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
 
-        std::vector<Word> lineWords;
-        for (size_t i = lineStart; i < lineEnd; i++) {
-          lineWords.push_back(words[i]);
-        }
+  const int16_t maxY = config.pageHeight - config.marginBottom;
+  const int16_t availableHeight = config.pageHeight - config.marginTop - config.marginBottom;
+  const int lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
+  const int ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
+  const int maxLines = (availableHeight + lineHeight - 1) / lineHeight;
+
+  // Go backwards more than one page to a paragraph start (the greedy lines are
+  // only used to find it), as the base class does
+  provider.setPosition(currentStartPosition);
+  int linesBack = 0;
+  while (provider.getCurrentIndex() > 0) {
+    linesBack++;
+    bool isParagraphEnd;
+    getPrevLine(provider, renderer, maxWidth, isParagraphEnd, config.alignment);
+    if (isParagraphEnd && linesBack >= (maxLines * 5) / 4) {
+      break;
+    }
+  }
 
-        // Calculate indentation from leading spaces for first line
-        int16_t indent = 0;
-        // if (breakIdx == 0) {
-        //   for (const auto& w : lineWords) {
-        //     if (w.text == " ") {
-        //       indent += w.width;
-        //     } else {
-        //       break;
-        //     }
-        //   }
-        // }
-        const int16_t x = config.marginLeft + indent;
-        int16_t effectiveMaxWidth = maxWidth - indent;
-
-        // Trim leading and trailing spaces
-        while (!lineWords.empty() && lineWords.front().text == " ") {
-          lineWords.erase(lineWords.begin());
-        }
-        while (!lineWords.empty() && lineWords.back().text == " ") {
-          lineWords.erase(lineWords.end() - 1);
-        }
+  // Break the paragraphs from there up to the current page, as layoutText() does
+  struct LineStart {
+    int start;
+    bool spaced;  // Followed by paragraph spacing
+  };
+  std::vector<LineStart> starts;
+  while (provider.getCurrentIndex() < currentStartPosition && provider.hasNextWord()) {
+    breakParagraph(provider, renderer, maxWidth, config.alignment);
+    chunkInSync_ = true;
+    for (const ParagraphLine& line : lines_) {
+      if (line.start >= currentStartPosition) {
+        break;
+      }
+      const bool empty = line.firstToken >= tokens_.size();
+      starts.push_back({line.start, line.last && chunkEndsParagraph_ && !empty});
+    }
+    provider.setPosition(chunkNext_);
+  }
+  provider.setPosition(savedPosition);
 
-        // Calculate positions for words in this line
-        bool isLastLine = (breakIdx == breaks.size()) && isParagraphEnd;
-        size_t numWords = lineWords.size();
-        size_t numSpaceWords = 0;
-        for (const auto& w : lineWords) {
-          if (w.text == " ")
-            numSpaceWords++;
-        }
+  if (starts.empty()) {
+    return 0;
+  }
 
-        if (isLastLine || numSpaceWords == 0) {
-          // Last line: use alignment, no justification
-          int16_t lineWidth = 0;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWidth += lineWords[i].width;
-          }
-
-          int16_t xPos = x;
-          if (paragraphAlignment == ALIGN_CENTER) {
-            xPos = x + (effectiveMaxWidth - lineWidth) / 2;
-          } else if (paragraphAlignment == ALIGN_RIGHT) {
-            xPos = x + effectiveMaxWidth - lineWidth;
-          }
-
-          int16_t currentX = xPos;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWords[i].x = currentX;
-            lineWords[i].y = currentY;
-            currentX += lineWords[i].width;
-          }
-        } else {
-          // Non-last line: justify by distributing space evenly among space words
-          int16_t totalWordWidth = 0;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            totalWordWidth += lineWords[i].width;
-          }
-
-          // Calculate space to distribute among space words
-          int16_t totalSpaceWidth = maxWidth - totalWordWidth;
-          int32_t extraPerSpaceFixed = ((int32_t)totalSpaceWidth << 8) / (int32_t)numSpaceWords;
-
-          if (extraPerSpaceFixed > (16 * (int32_t)spaceWidth_ << 8)) {
-            // Limit maximum space stretch to avoid extreme gaps
-            extraPerSpaceFixed = std::max(extraPerSpaceFixed / 4, (int32_t)spaceWidth_ << 8);
-          }
-
-          // Increase widths of space words
-          int32_t accumulatedExtraFixed = 0;
-          for (auto& w : lineWords) {
-            if (w.text == " ") {
-              accumulatedExtraFixed += extraPerSpaceFixed;
-              int16_t extra = (int16_t)(accumulatedExtraFixed >> 8);
-              w.width += extra;
-              accumulatedExtraFixed -= ((int32_t)extra << 8);
-            }
-          }
-
-          // Now place words
-          int16_t currentX = x;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWords[i].x = currentX;
-            lineWords[i].y = currentY;
-            currentX += lineWords[i].width;
-          }
+  // The earliest line whose page ends exactly at the current page start
+  const int current = (int)starts.size();
+  for (int first = std::max(0, current - maxLines); first < current; first++) {
+    int32_t y = config.marginTop;
+    int end = first;
+    while (end < current && y + lineHeight <= maxY) {
+      y += lineHeight;
+      if (starts[end].spaced) {
+        if (y + ps > maxY) {
+          end++;
+          break;
         }
-
-        Line lineStruct;
-        lineStruct.words = lineWords;
-        lineStruct.alignment = paragraphAlignment;
-        result.lines.push_back(lineStruct);
-        lineStart = lineEnd;
-        currentY += lineHeight;
+        y += ps;
       }
-
-      words.clear();
+      end++;
+    }
+    if (end == current) {
+      return starts[first].start;
     }
   }
+  // Not even one line fits a page
+  return starts[std::max(0, current - maxLines)].start;
+}
 
-  result.endPosition = provider.getCurrentIndex();
-  // reset the provider to the start index
-  provider.setPosition(startIndex);
+LayoutStrategy::Line KnuthPlassLayoutStrategy::test_getNextLayoutLine(WordProvider& provider, TextRenderer& renderer,
+                                                                      const LayoutConfig& config,
+                                                                      bool& isParagraphEnd) {
+  const int16_t maxWidth = config.pageWidth - config.marginLeft - config.marginRight;
+  renderer.setFontStyle(FontStyle::REGULAR);
+  renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
 
-  return result;
+  size_t lineIndex = 0;
+  seekLine(provider, renderer, maxWidth, config.alignment, provider.getCurrentIndex(), lineIndex);
+  if (lineIndex >= lines_.size()) {
+    isParagraphEnd = chunkEndsParagraph_;
+    provider.setPosition(chunkNext_);
+    return Line{{}, paragraphAlignment_};
+  }
+  const ParagraphLine& paragraphLine = lines_[lineIndex];
+  isParagraphEnd = paragraphLine.last && chunkEndsParagraph_;
+  PageLayout page;
+  emitLine(paragraphLine, renderer, page);
+  Line line{{}, paragraphAlignment_};
+  for (const PageWord& word : page.words) {
+    line.words.push_back(Word(String(page.wordText(word)), word.width, 0, 0, word.wasSplit, word.style));
+  }
+  provider.setPosition(lineIndex + 1 < lines_.size() ? lines_[lineIndex + 1].start : chunkNext_);
+  return line;
 }
 
-void KnuthPlassLayoutStrategy::renderPage(const PageLayout& layout, TextRenderer& renderer,
-                                          const LayoutConfig& config) {
-  const int16_t maxY = config.pageHeight - config.marginBottom;
-  const int16_t lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
-  for (const auto& line : layout.lines) {
-    if (!line.words.empty()) {
-      if ((int32_t)line.words.front().y + (int32_t)lineHeight > (int32_t)maxY) {
-        break;
-      }
+int KnuthPlassLayoutStrategy::findParagraphStart(WordProvider& provider, int position) {
+  provider.setPosition(position);
+  for (int i = 0; i < PARAGRAPH_SCAN_TOKENS; i++) {
+    if (!provider.hasPrevWord()) {
+      return provider.getCurrentIndex();
+    }
+    const int after = provider.getCurrentIndex();
+    StyledWord word = provider.getPrevWord();
+    if (word.text == String("\n")) {
+      return after;
     }
-    for (const auto& word : line.words) {
-      renderer.setFontStyle(word.style);
-      renderer.setCursor(word.x, word.y);
-      renderer.print(word.text);
+    if (provider.getCurrentIndex() >= after) {
+      break;
     }
   }
+  // Too far back (or no progress): break from `position` itself
+  return position;
 }
 
-std::vector<size_t> KnuthPlassLayoutStrategy::calculateBreaks(const std::vector<Word>& words, int16_t maxWidth) {
-  std::vector<size_t> breaks;
+KnuthPlassLayoutStrategy::ChunkKey KnuthPlassLayoutStrategy::chunkKey(WordProvider& provider, TextRenderer& renderer,
+                                                                     int16_t maxWidth, TextAlignment defaultAlignment) {
+  renderer.setFontStyle(FontStyle::REGULAR);
+  return {&provider, provider.getCurrentChapter(), renderer.getFont(), maxWidth, defaultAlignment};
+}
 
-  if (words.empty()) {
-    return breaks;
+bool KnuthPlassLayoutStrategy::seekLine(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth,
+                                        TextAlignment defaultAlignment, int start, size_t& lineIndex) {
+  lineIndex = 0;
+  if (chunkValid_ && chunkKey(provider, renderer, maxWidth, defaultAlignment) == chunkKey_) {
+    // Usually the page before ended in the current chunk, or right after it
+    for (size_t i = 0; i < lines_.size(); i++) {
+      if (lines_[i].start == start) {
+        lineIndex = i;
+        provider.setPosition(chunkNext_);
+        return chunkInSync_;
+      }
+    }
+    if (start == chunkNext_) {
+      const bool inSync = chunkInSync_ || chunkEndsParagraph_;
+      provider.setPosition(start);
+      breakParagraph(provider, renderer, maxWidth, defaultAlignment);
+      chunkInSync_ = inSync;
+      return inSync;
+    }
   }
 
-  size_t n = words.size();
+  const int origin = findParagraphStart(provider, start);
+  provider.setPosition(origin);
+  if (origin < start) {
+    while (provider.hasNextWord()) {
+      breakParagraph(provider, renderer, maxWidth, defaultAlignment);
+      chunkInSync_ = true;
+      for (size_t i = 0; i < lines_.size(); i++) {
+        if (lines_[i].start == start) {
+          lineIndex = i;
+          return true;
+        }
+      }
+      if (chunkEndsParagraph_ || chunkNext_ > start) {
+        break;
+      }
+      provider.setPosition(chunkNext_);
+    }
+    provider.setPosition(start);
+  }
+  breakParagraph(provider, renderer, maxWidth, defaultAlignment);
+  chunkInSync_ = origin >= start;
+  return chunkInSync_;
+}
 
-  // Dynamic programming array: minimum demerits to reach each word
-  std::vector<int32_t> minDemerits(n + 1, INFINITY_PENALTY);
-  std::vector<int> prevBreak(n + 1, -1);
+void KnuthPlassLayoutStrategy::breakParagraph(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth,
+                                              TextAlignment defaultAlignment) {
+  tokens_.clear();
+  tokenText_.clear();
+  hyphens_.clear();
+  lines_.clear();
+  chunkKey_ = chunkKey(provider, renderer, maxWidth, defaultAlignment);
+  chunkValid_ = true;
+  chunkInSync_ = false;
+  chunkBreakCount_++;
+  chunkStart_ = provider.getCurrentIndex();
+  chunkEndsParagraph_ = false;
+  paragraphAlignment_ = defaultAlignment;
+
+  bool alignmentCaptured = false;
+  while (provider.hasNextWord() && (int)tokens_.size() < MAX_PARAGRAPH_TOKENS) {
+    const int start = provider.getCurrentIndex();
+    StyledWord styledWord = provider.getNextWord();
+
+    // Capture the paragraph's alignment (CSS overrides the default)
+    if (!alignmentCaptured) {
+      alignmentCaptured = true;
+      switch (provider.getParagraphAlignment()) {
+        case TextAlign::Center:
+          paragraphAlignment_ = ALIGN_CENTER;
+          break;
+        case TextAlign::Right:
+          paragraphAlignment_ = ALIGN_RIGHT;
+          break;
+        case TextAlign::Left:
+          paragraphAlignment_ = ALIGN_LEFT;
+          break;
+        default:
+          break;
+      }
+    }
 
-  // Base case: starting position has 0 demerits
-  minDemerits[0] = 0;
+    if (styledWord.text == String("\n")) {
+      chunkEndsParagraph_ = true;
+      break;
+    }
+    if (styledWord.text.isEmpty()) {
+      continue;
+    }
+    const int16_t width = measureText_kp(renderer, styledWord.text.c_str(), styledWord.style);
+    const uint32_t offset = (uint32_t)tokenText_.size();
+    tokenText_.insert(tokenText_.end(), styledWord.text.c_str(), styledWord.text.c_str() + styledWord.text.length());
+    tokenText_.push_back('\0');
+
+    // Existing hyphens are always break points (the patterns only add points to words without them)
+    const uint32_t hyphenOffset = (uint32_t)hyphens_.size();
+    if (hyphenationStrategy_) {
+      for (unsigned int i = 0; i < styledWord.text.length(); i++) {
+        if (styledWord.text[i] == '-' && hyphens_.size() - hyphenOffset < UINT8_MAX) {
+          hyphens_.push_back((int16_t)i);
+        }
+      }
+    }
+    tokens_.push_back({offset, (uint16_t)styledWord.text.length(), styledWord.style, width, start, hyphenOffset,
+                       (uint8_t)(hyphens_.size() - hyphenOffset)});
+  }
+  chunkNext_ = provider.getCurrentIndex();
+  const bool chunkComplete = chunkEndsParagraph_ || !provider.hasNextWord();
+
+  // Like TeX: without hyphenation if every line is good enough, then with it,
+  // then accept loose lines (and overfull ones, for words too long for a line)
+  buildItems(renderer, false);
+  bool found = findBreaks(maxWidth, PRETOLERANCE, false);
+  if (!found && hyphenationStrategy_) {
+    findHyphenationPoints();
+    buildItems(renderer, true);
+    found = findBreaks(maxWidth, TOLERANCE, false);
+    if (!found) {
+      findBreaks(maxWidth, INF_BAD, true);
+    }
+  } else if (!found) {
+    findBreaks(maxWidth, INF_BAD, true);
+  }
+  buildLines(provider);
 
-  // For each possible starting position
-  for (size_t i = 0; i < n; i++) {
-    if (minDemerits[i] >= INFINITY_PENALTY) {
-      continue;  // This position is unreachable
+  // A chunk cut short of the paragraph end keeps all but its last line; the
+  // next chunk starts there, so no line straddles two chunks
+  if (chunkComplete) {
+    if (!lines_.empty()) {
+      lines_.back().last = true;
     }
+  } else if (lines_.size() > 1) {
+    chunkNext_ = lines_.back().start;
+    lines_.pop_back();
+  }
+  provider.setPosition(chunkNext_);
+}
 
-    // Try to fit words [i, j) on one line
-    int16_t lineWidth = 0;
-    for (size_t j = i; j < n; j++) {
-      lineWidth += words[j].width;
+void KnuthPlassLayoutStrategy::findHyphenationPoints() {
+  for (Token& token : tokens_) {
+    if (token.hyphenCount > 0 || isSpace_kp(tokenText(token))) {
+      continue;
+    }
+    const HyphenationStrategy::HyphenPositions positions =
+        hyphenationStrategy_->findHyphenPositionsCached(tokenText(token), token.length);
+    token.hyphenOffset = (uint32_t)hyphens_.size();
+    token.hyphenCount = (uint8_t)std::min(positions.count, (size_t)UINT8_MAX);
+    hyphens_.insert(hyphens_.end(), positions.positions, positions.positions + token.hyphenCount);
+  }
+}
 
-      // Check if line is too wide
-      if (lineWidth > maxWidth) {
-        // Special case: if this is the first word on the line and it's too wide,
-        // we must still place it on its own line to make progress
-        if (j == i) {
-          // Force this oversized word onto its own line with a high but not infinite penalty
-          // Use a large fixed penalty (100) rather than INFINITY_PENALTY to allow progress
-          int32_t demerits = 100;
+void KnuthPlassLayoutStrategy::buildItems(TextRenderer& renderer, bool hyphenate) {
+  items_.clear();
+  for (size_t t = 0; t < tokens_.size(); t++) {
+    const Token& token = tokens_[t];
+    if (isSpace_kp(tokenText(token))) {
+      // Leading spaces can't stretch a line, and a space only breaks after a word
+      if (!items_.empty() && items_.back().type != ITEM_GLUE) {
+        items_.push_back({ITEM_GLUE, false, token.width, (int16_t)(token.width / 2), (int16_t)(token.width / 3),
+                          (uint16_t)t, 0});
+      }
+      continue;
+    }
 
-          // Add a constant penalty per line to favor fewer lines
-          demerits += 50;
+    // The word as boxes, split at its hyphenation points: existing hyphens
+    // always, points found by the patterns only in the hyphenation pass
+    const int16_t* positions = hyphens_.data() + token.hyphenOffset;
+    const int length = (int)token.length;
+    int previousCut = 0;
+    int16_t previousWidth = 0;
+    for (size_t i = 0; i < token.hyphenCount; i++) {
+      const int position = positions[i];
+      const bool algorithmic = position < 0;
+      const int cut = algorithmic ? -(position + 1) : position + 1;
+      if ((algorithmic && !hyphenate) || cut <= previousCut || cut >= length) {
+        continue;
+      }
+      const int16_t prefixWidth = measurePart(renderer, tokenText(token), cut, token.style, false);
+      const int16_t hyphenWidth = algorithmic ? measureText_kp(renderer, "-", token.style) : 0;
+      items_.push_back({ITEM_BOX, false, (int16_t)std::max(0, prefixWidth - previousWidth), 0, 0, (uint16_t)t,
+                        (uint16_t)previousCut});
+      items_.push_back({ITEM_PENALTY, algorithmic, hyphenWidth, 0, 0, (uint16_t)t, (uint16_t)cut});
+      previousCut = cut;
+      previousWidth = prefixWidth;
+    }
+    items_.push_back({ITEM_BOX, false, (int16_t)std::max(0, token.width - previousWidth), 0, 0, (uint16_t)t,
+                      (uint16_t)previousCut});
+  }
+  while (!items_.empty() && items_.back().type == ITEM_GLUE) {
+    items_.pop_back();
+  }
+}
 
-          int32_t totalDemerits = minDemerits[i] + demerits;
-          if (totalDemerits < minDemerits[j + 1]) {
-            minDemerits[j + 1] = totalDemerits;
-            prevBreak[j + 1] = i;
-          }
-        }
-        break;  // Can't fit any more words on this line
+bool KnuthPlassLayoutStrategy::findBreaks(int16_t lineWidth, int32_t threshold, bool emergency) {
+  nodes_.clear();
+  active_.clear();
+  breaks_.clear();
+  nodes_.push_back({0, FIT_DECENT, false, 0, 0, 0, 0, -1});
+  active_.push_back(0);
+
+  // Totals of the items before the one looked at
+  int32_t width = 0;
+  int32_t stretch = 0;
+  int32_t shrink = 0;
+  for (size_t i = 0; i < items_.size(); i++) {
+    const Item& item = items_[i];
+    if (item.type == ITEM_BOX) {
+      width += item.width;
+      continue;
+    }
+    // Glue is a legal break after a box; every penalty is one
+    if (item.type == ITEM_PENALTY || items_[i - 1].type == ITEM_BOX) {
+      if (!tryBreak(i, width, stretch, shrink, lineWidth, threshold, emergency)) {
+        return false;
       }
+    }
+    if (item.type == ITEM_GLUE) {
+      width += item.width;
+      stretch += item.stretch;
+      shrink += item.shrink;
+    }
+  }
+  // The paragraph end: a forced break after glue that fills the last line
+  if (!tryBreak(items_.size(), width, stretch, shrink, lineWidth, threshold, emergency)) {
+    return false;
+  }
 
-      // Calculate badness and demerits for this line
-      bool isLastLine = (j == n - 1);
-      int32_t badness = calculateBadness(lineWidth, maxWidth);
-      int32_t demerits = calculateDemerits(badness, isLastLine);
+  int32_t best = -1;
+  for (int32_t node : active_) {
+    if (best < 0 || nodes_[node].demerits < nodes_[best].demerits) {
+      best = node;
+    }
+  }
+  for (int32_t node = best >= 0 ? nodes_[best].previous : -1; node > 0; node = nodes_[node].previous) {
+    breaks_.push_back(nodes_[node].item);
+  }
+  std::reverse(breaks_.begin(), breaks_.end());
+  return best >= 0;
+}
 
-      // Add a constant penalty per line to favor fewer lines
-      // This makes layouts with fewer lines always preferable
-      demerits += 50;
+bool KnuthPlassLayoutStrategy::tryBreak(size_t position, int32_t width, int32_t stretch, int32_t shrink,
+                                        int16_t lineWidth, int32_t threshold, bool emergency) {
+  const bool end = position == items_.size();
+  const Item* item = end ? nullptr : &items_[position];
+  const bool hyphenated = item && item->type == ITEM_PENALTY;
+  const int32_t breakWidth = hyphenated ? item->width : 0;
+
+  int64_t best[4];
+  int32_t bestPrevious[4] = {-1, -1, -1, -1};
+  int32_t rescue = -1;
+  for (size_t k = 0; k < active_.size();) {
+    const int32_t index = active_[k];
+    const BreakNode& from = nodes_[index];
+    const int32_t length = width - from.width + breakWidth;
+
+    int32_t bad;
+    uint8_t fitness;
+    if (length < lineWidth) {
+      // The last line is filled, not stretched
+      bad = end ? 0 : badness_kp(lineWidth - length, stretch - from.stretch, INF_BAD);
+      fitness = bad > 99 ? FIT_VERY_LOOSE : bad > 12 ? FIT_LOOSE : FIT_DECENT;
+    } else if (length > lineWidth && (end || length - lineWidth > shrink - from.shrink)) {
+      bad = INF_BAD + 1;  // Overfull (the last line is set at its natural width, so it can't shrink)
+      fitness = FIT_TIGHT;
+    } else {
+      bad = badness_kp(length - lineWidth, shrink - from.shrink, INF_BAD);
+      fitness = bad > 12 ? FIT_TIGHT : FIT_DECENT;
+    }
 
-      // Update minimum demerits to reach position j+1
-      int32_t totalDemerits = minDemerits[i] + demerits;
-      if (totalDemerits < minDemerits[j + 1]) {
-        minDemerits[j + 1] = totalDemerits;
-        prevBreak[j + 1] = i;
+    if (bad <= threshold) {
+      int64_t demerits = LINE_PENALTY + bad;
+      demerits *= demerits;
+      if (hyphenated) {
+        demerits += (int64_t)HYPHEN_PENALTY * HYPHEN_PENALTY;
+        if (from.hyphenated) {
+          demerits += DOUBLE_HYPHEN_DEMERITS;
+        }
+      }
+      if (std::abs((int)fitness - (int)from.fitness) > 1) {
+        demerits += FITNESS_DEMERITS;
+      }
+      demerits += from.demerits;
+      if (bestPrevious[fitness] < 0 || demerits < best[fitness]) {
+        best[fitness] = demerits;
+        bestPrevious[fitness] = index;
       }
+    }
 
-      // If this word was split (hyphenated), we must break the line here
-      if (words[j].wasSplit) {
-        break;
+    // No later break can follow an overfull line's start, nor one before a forced break
+    if (bad > INF_BAD || end) {
+      if (bad > INF_BAD &&
+          (rescue < 0 || from.item > nodes_[rescue].item ||
+           (from.item == nodes_[rescue].item && from.demerits < nodes_[rescue].demerits))) {
+        rescue = index;
       }
+      active_[k] = active_.back();
+      active_.pop_back();
+    } else {
+      k++;
     }
   }
 
-  // Reconstruct breaks by backtracking
-  int pos = n;
-  while (pos > 0 && prevBreak[pos] >= 0) {
-    breaks.push_back(pos);
-    pos = prevBreak[pos];
+  // Totals after the break: glue at the break and right after it is dropped
+  int32_t afterWidth = width;
+  int32_t afterStretch = stretch;
+  int32_t afterShrink = shrink;
+  if (!end) {
+    for (size_t j = hyphenated ? position + 1 : position; j < items_.size() && items_[j].type != ITEM_BOX; j++) {
+      if (items_[j].type == ITEM_GLUE) {
+        afterWidth += items_[j].width;
+        afterStretch += items_[j].stretch;
+        afterShrink += items_[j].shrink;
+      }
+    }
   }
 
-  // Reverse to get breaks in forward order
-  std::reverse(breaks.begin(), breaks.end());
-
-  // Remove the last break (end of text)
-  if (!breaks.empty() && breaks.back() == n) {
-    breaks.pop_back();
+  bool created = false;
+  for (uint8_t fitness = 0; fitness < 4; fitness++) {
+    if (bestPrevious[fitness] >= 0) {
+      nodes_.push_back({(uint16_t)position, fitness, hyphenated, afterWidth, afterStretch, afterShrink, best[fitness],
+                        bestPrevious[fitness]});
+      active_.push_back((int32_t)nodes_.size() - 1);
+      created = true;
+    }
   }
 
-  return breaks;
+  if (!created && active_.empty()) {
+    if (!emergency || rescue < 0) {
+      return false;
+    }
+    // Last resort: an overfull line from the latest break, so a word too long
+    // for any line gets one of its own
+    const BreakNode& from = nodes_[rescue];
+    const int64_t demerits = from.demerits + (int64_t)INF_BAD * INF_BAD;
+    nodes_.push_back({(uint16_t)position, FIT_TIGHT, hyphenated, afterWidth, afterStretch, afterShrink, demerits,
+                      rescue});
+    active_.push_back((int32_t)nodes_.size() - 1);
+  }
+  return true;
 }
 
-int32_t KnuthPlassLayoutStrategy::calculateBadness(int16_t actualWidth, int16_t targetWidth) {
-  if (actualWidth > targetWidth) {
-    // Line is too wide - very bad
-    return INFINITY_PENALTY;
-  }
+void KnuthPlassLayoutStrategy::buildLines(WordProvider& provider) {
+  const size_t lineCount = breaks_.size() + 1;
+  for (size_t k = 0; k < lineCount; k++) {
+    ParagraphLine line = {chunkStart_, (uint16_t)tokens_.size(), 0, (uint16_t)tokens_.size(), 0, false, false};
+
+    // First box of the line
+    size_t first = 0;
+    if (k > 0) {
+      first = breaks_[k - 1];
+      while (first < items_.size() && items_[first].type != ITEM_BOX) {
+        first++;
+      }
+    }
+    if (first < items_.size()) {
+      line.firstToken = items_[first].token;
+      line.firstCut = items_[first].cut;
+    }
+    if (k > 0) {
+      const Token& token = tokens_[line.firstToken];
+      if (line.firstCut == 0) {
+        line.start = token.start;
+      } else {
+        provider.setPosition(token.start);
+        provider.consumeChars(line.firstCut);
+        line.start = provider.getCurrentIndex();
+      }
+    }
 
-  if (actualWidth == targetWidth) {
-    // Perfect fit
-    return 0;
+    // Where it ends: at glue (excluded), at a hyphenation point, or the chunk end
+    if (k < breaks_.size()) {
+      const Item& item = items_[breaks_[k]];
+      line.endToken = item.token;
+      line.endCut = item.type == ITEM_PENALTY ? item.cut : 0;
+      line.hyphenated = item.type == ITEM_PENALTY && item.insertsHyphen;
+    }
+    lines_.push_back(line);
   }
+}
 
-  // Calculate adjustment ratio (how much space needs to be stretched)
-  // Scaling by 100 for integer precision
-  int32_t diff = (int32_t)(targetWidth - actualWidth);
-  int32_t ratio = (diff * 100) / targetWidth;
+int16_t KnuthPlassLayoutStrategy::measurePart(TextRenderer& renderer, const char* text, size_t length,
+                                              FontStyle style, bool addHyphen) {
+  scratch_.assign(text, text + length);
+  if (addHyphen) {
+    scratch_.push_back('-');
+  }
+  scratch_.push_back('\0');
+  return measureText_kp(renderer, scratch_.data(), style);
+}
 
-  // Badness is cube of ratio (Knuth-Plass formula)
-  // This penalizes very loose lines more heavily
-  int32_t badness = (ratio * ratio * ratio) / 100;
+void KnuthPlassLayoutStrategy::emitLine(const ParagraphLine& paragraphLine, TextRenderer& renderer, PageLayout& page) {
+  page.beginLine(paragraphAlignment_);
+  const size_t last = std::min((size_t)paragraphLine.endToken + (paragraphLine.endCut > 0 ? 1 : 0), tokens_.size());
+  for (size_t t = paragraphLine.firstToken; t < last; t++) {
+    const Token& token = tokens_[t];
+    const char* text = tokenText(token);
+    const int from = (t == paragraphLine.firstToken) ? paragraphLine.firstCut : 0;
+    const bool cutEnd = t == paragraphLine.endToken && paragraphLine.endCut > 0;
+    const int to = cutEnd ? paragraphLine.endCut : (int)token.length;
+    // Leading spaces are dropped
+    if (from >= to || (page.lines.back().wordCount == 0 && isSpace_kp(text))) {
+      continue;
+    }
+    if (from == 0 && !cutEnd) {
+      page.addWord(text, token.length, token.width, token.style, false);
+      continue;
+    }
+    const bool addHyphen = cutEnd && paragraphLine.hyphenated;
+    const int16_t width = measurePart(renderer, text + from, to - from, token.style, addHyphen);
+    page.addWord(scratch_.data(), scratch_.size() - 1, width, token.style, cutEnd);
+  }
 
-  return badness;
+  // Trim trailing spaces
+  while (page.lines.back().wordCount > 0 && isSpace_kp(page.wordText(page.words.back()))) {
+    page.popWord();
+  }
 }
 
-int32_t KnuthPlassLayoutStrategy::calculateDemerits(int32_t badness, bool isLastLine) {
-  if (badness >= INFINITY_PENALTY) {
-    return INFINITY_PENALTY;
+void KnuthPlassLayoutStrategy::positionLine(PageLayout& page, const PageLine& line, int16_t x, int16_t y,
+                                            int16_t maxWidth, bool isLastLine) {
+  PageWord* const lineWords = page.lineWords(line);
+  PageWord* const lineEnd = lineWords + line.wordCount;
+  size_t numSpaceWords = 0;
+  int16_t lineWidth = 0;
+  for (const PageWord* w = lineWords; w != lineEnd; w++) {
+    lineWidth += w->width;
+    if (isSpace_kp(page.wordText(*w))) {
+      numSpaceWords++;
+    }
   }
 
-  // Last line is allowed to be loose without penalty
-  if (isLastLine) {
-    return 0;
+  if (isLastLine || numSpaceWords == 0) {
+    // Last line: use alignment, no justification
+    int16_t xPos = x;
+    if (line.alignment == ALIGN_CENTER) {
+      xPos = x + (maxWidth - lineWidth) / 2;
+    } else if (line.alignment == ALIGN_RIGHT) {
+      xPos = x + maxWidth - lineWidth;
+    }
+    for (PageWord* w = lineWords; w != lineEnd; w++) {
+      w->x = xPos;
+      w->y = y;
+      xPos += w->width;
+    }
+    return;
   }
 
-  // Demerits is square of (1 + badness)
-  int32_t val = (1 + badness);
-  int32_t demerits = val * val;
+  // Justify by distributing the difference evenly among space words, in 1/256
+  // pixels: positive stretches the spaces, negative shrinks them
+  const int32_t totalSpaceWidth = (int32_t)maxWidth - lineWidth;
+  int32_t extraPerSpaceFixed = totalSpaceWidth * 256 / (int32_t)numSpaceWords;
+  if (extraPerSpaceFixed > 16 * (int32_t)spaceWidth_ * 256) {
+    // Limit maximum space stretch to avoid extreme gaps
+    extraPerSpaceFixed = std::max(extraPerSpaceFixed / 4, (int32_t)spaceWidth_ * 256);
+  }
+  // A space shrinks to one pixel at most: an overfull line (a word too long
+  // for it) overhangs the margin instead of overlapping its words
+  extraPerSpaceFixed = std::max(extraPerSpaceFixed, (1 - (int32_t)spaceWidth_) * 256);
+
+  int32_t accumulatedExtraFixed = 0;
+  for (PageWord* w = lineWords; w != lineEnd; w++) {
+    if (isSpace_kp(page.wordText(*w))) {
+      accumulatedExtraFixed += extraPerSpaceFixed;
+      // Whole pixels, rounded down (so a shrunk line never ends past the
+      // margin); the remainder, 0 to 255, carries to the next space
+      const int32_t whole = accumulatedExtraFixed >= 0 ? accumulatedExtraFixed / 256
+                                                       : -((255 - accumulatedExtraFixed) / 256);
+      const int16_t extra = (int16_t)whole;
+      w->width += extra;
+      accumulatedExtraFixed -= (int32_t)extra * 256;
+    }
+  }
 
-  return demerits;
+  int16_t currentX = x;
+  for (PageWord* w = lineWords; w != lineEnd; w++) {
+    w->x = currentX;
+    w->y = y;
+    currentX += w->width;
+  }
 }
@@ -5,12 +5,32 @@
 
 #include "LayoutStrategy.h"
 
+/**
+ * Optimal-fit line breaking (Knuth & Plass) over whole paragraphs.
+ *
+ * Each paragraph becomes a list of boxes (words and word fragments), glue
+ * (spaces, which may stretch and shrink) and penalties (hyphenation points).
+ * The breaks with the least total demerits are found in one pass over the
+ * list, keeping only the breaks that can still start a line that fits
+ * (the active nodes). Like TeX, a first pass tries without hyphenation, a
+ * second adds every hyphenation point, and a final pass accepts any spacing.
+ *
+ * Line breaks depend only on where the paragraph starts: a page that starts
+ * inside a paragraph breaks the paragraph from its beginning and continues
+ * from its own first line, so page ends and backward navigation agree with
+ * the lines the previous page showed. The last broken chunk is kept, so the
+ * next page (which starts on one of its lines or right after it) continues
+ * from it without breaking the paragraph again.
+ */
 class KnuthPlassLayoutStrategy : public LayoutStrategy {
  public:
   KnuthPlassLayoutStrategy();
   ~KnuthPlassLayoutStrategy();
 
-  // Test support: check if line count mismatch occurred
+  // Test support: a mismatch means the page did not start on one of its
+  // paragraph's line breaks, so its first lines were broken from the page
+  // start instead (expected = lines on the page, actual = lines that follow
+  // the paragraph's breaks)
   bool hasLineCountMismatch() const {
     return lineCountMismatch_;
   }
@@ -20,6 +40,10 @@ class KnuthPlassLayoutStrategy : public LayoutStrategy {
   int getActualLineCount() const {
     return actualLineCount_;
   }
+  // Chunks broken so far (pages continuing the last chunk break none)
+  uint32_t getChunkBreakCount() const {
+    return chunkBreakCount_;
+  }
   void resetLineCountMismatch() {
     lineCountMismatch_ = false;
     expectedLineCount_ = 0;
@@ -30,38 +54,149 @@ class KnuthPlassLayoutStrategy : public LayoutStrategy {
     return KNUTH_PLASS;
   }
 
+  void invalidateCaches() override {
+    chunkValid_ = false;
+  }
+
   // Main interface implementation
-  PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config) override;
+  void layoutPage(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                  PageLayout& page) override;
   void renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) override;
+  int getPreviousPageStart(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                           int currentEndPosition) override;
+  Line test_getNextLayoutLine(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                              bool& isParagraphEnd) override;
 
  private:
-  // spaceWidth_ is defined in base class
+  // Knuth-Plass parameters (TeX's defaults)
+  static constexpr int32_t INF_BAD = 10000;               // Badness of a line that cannot stretch enough
+  static constexpr int32_t LINE_PENALTY = 10;             // Added to every line's badness
+  static constexpr int32_t HYPHEN_PENALTY = 50;           // Breaking at a hyphenation point
+  static constexpr int32_t DOUBLE_HYPHEN_DEMERITS = 10000;  // Two hyphenated lines in a row
+  static constexpr int32_t FITNESS_DEMERITS = 10000;      // Adjacent lines of very different tightness
+  static constexpr int32_t PRETOLERANCE = 100;            // Highest badness in the pass without hyphenation
+  static constexpr int32_t TOLERANCE = 200;               // Highest badness in the pass with hyphenation
+
+  // Tokens broken at once; longer paragraphs are broken in chunks
+  static constexpr int MAX_PARAGRAPH_TOKENS = 400;
+  // Tokens scanned back for the start of the page's paragraph
+  static constexpr int PARAGRAPH_SCAN_TOKENS = 4000;
 
-  struct ParagraphLayoutInfo {
-    std::vector<Word> words;
-    std::vector<size_t> breaks;
-    bool paragraphEnd;
-    int16_t yStart;
+  enum ItemType : uint8_t { ITEM_BOX, ITEM_GLUE, ITEM_PENALTY };
+  enum Fitness : uint8_t { FIT_VERY_LOOSE, FIT_LOOSE, FIT_DECENT, FIT_TIGHT };
+
+  // A provider token of the paragraph, its text `length` bytes (NUL terminated)
+  // at `textOffset` in tokenText_, its hyphenation points `hyphenCount`
+  // positions (in the findHyphenPositions() encoding) at `hyphenOffset` in hyphens_
+  struct Token {
+    uint32_t textOffset;
+    uint16_t length;
+    FontStyle style;
+    int16_t width;
+    int start;  // Provider index of the token
+    uint32_t hyphenOffset;
+    uint8_t hyphenCount;
+  };
+
+  // Box (word or fragment), glue (space) or penalty (hyphenation point)
+  struct Item {
+    ItemType type;
+    bool insertsHyphen;  // Penalty: a hyphen is added when breaking here
+    int16_t width;       // Penalty: width added to the line when breaking here
+    int16_t stretch;
+    int16_t shrink;
+    uint16_t token;  // Token the item belongs to
+    uint16_t cut;    // Box: byte offset of the fragment in the token; penalty: bytes before the break
   };
 
-  // Knuth-Plass parameters
-  static constexpr int32_t INFINITY_PENALTY = 1000000;
-  static constexpr int32_t HYPHEN_PENALTY = 50;
-  static constexpr int32_t FITNESS_DEMERITS = 100;
-
-  // Node for dynamic programming
-  struct Node {
-    size_t position;         // Word index
-    size_t line;             // Line number
-    int32_t totalDemerits;   // Total demerits up to this point
-    int16_t totalWidth;      // Width accumulated up to this position
-    int prevBreak;           // Previous break point index (-1 if none)
+  // A feasible break, linked to the break before it on its best path
+  struct BreakNode {
+    uint16_t item;  // Item index of the break (items_.size() for the paragraph end)
+    uint8_t fitness;
+    bool hyphenated;
+    int32_t width;  // Totals of the items up to the line after the break
+    int32_t stretch;
+    int32_t shrink;
+    int64_t demerits;
+    int32_t previous;  // Node index, -1 for the paragraph start
   };
 
-  // Helper methods
-  std::vector<size_t> calculateBreaks(const std::vector<Word>& words, int16_t maxWidth);
-  int32_t calculateBadness(int16_t actualWidth, int16_t targetWidth);
-  int32_t calculateDemerits(int32_t badness, bool isLastLine);
+  // What a chunk's breaks depend on besides its text position. Objects are
+  // told apart by address only while both are alive; replacing the provider
+  // or hyphenation strategy goes through invalidateCaches().
+  struct ChunkKey {
+    const WordProvider* provider;
+    int chapter;
+    const SimpleGFXfont* font;  // Regular variant
+    int16_t maxWidth;
+    TextAlignment alignment;
+
+    bool operator==(const ChunkKey& other) const {
+      return provider == other.provider && chapter == other.chapter && font == other.font &&
+             maxWidth == other.maxWidth && alignment == other.alignment;
+    }
+  };
+
+  // A line of the broken chunk: tokens from (firstToken, firstCut) up to (endToken, endCut)
+  struct ParagraphLine {
+    int start;  // Provider index of the line start
+    uint16_t firstToken;
+    uint16_t firstCut;
+    uint16_t endToken;
+    uint16_t endCut;
+    bool hyphenated;  // Ends in an inserted hyphen
+    bool last;        // Last line of the paragraph (not justified)
+  };
+
+  // Breaks the paragraph (or the next chunk of it) at the provider position into lines_
+  void breakParagraph(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth,
+                      TextAlignment defaultAlignment);
+  // Adds the patterns' hyphenation points of the words without existing hyphens
+  void findHyphenationPoints();
+  void buildItems(TextRenderer& renderer, bool hyphenate);
+  bool findBreaks(int16_t lineWidth, int32_t threshold, bool emergency);
+  bool tryBreak(size_t position, int32_t width, int32_t stretch, int32_t shrink, int16_t lineWidth, int32_t threshold,
+                bool emergency);
+  void buildLines(WordProvider& provider);
+
+  // Start of the paragraph holding `position`, or `position` if it is too far back
+  int findParagraphStart(WordProvider& provider, int position);
+  ChunkKey chunkKey(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth, TextAlignment defaultAlignment);
+  // Breaks lines_ so that one starts at `start` (returned in lineIndex), reusing the
+  // current chunk if it has that line or ends there; false if the paragraph's
+  // breaks miss `start` and the lines were broken from `start` instead
+  bool seekLine(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth, TextAlignment defaultAlignment,
+                int start, size_t& lineIndex);
+  // Appends the line's words to `page` as a new line (trimmed of spaces)
+  void emitLine(const ParagraphLine& paragraphLine, TextRenderer& renderer, PageLayout& page);
+  void positionLine(PageLayout& page, const PageLine& line, int16_t x, int16_t y, int16_t maxWidth, bool isLastLine);
+  const char* tokenText(const Token& token) const {
+    return tokenText_.data() + token.textOffset;
+  }
+  // Measures `length` bytes of `text` (copied to scratch_ to terminate them)
+  int16_t measurePart(TextRenderer& renderer, const char* text, size_t length, FontStyle style, bool addHyphen);
+
+  // Current chunk. Every buffer keeps its capacity between paragraphs and
+  // pages, so once they have grown only breaking a chunk allocates: for
+  // provider words too long for String's inline storage and for hyphenation
+  // cache misses.
+  std::vector<Token> tokens_;
+  std::vector<char> tokenText_;
+  std::vector<int16_t> hyphens_;
+  std::vector<char> scratch_;
+  std::vector<Item> items_;
+  std::vector<BreakNode> nodes_;
+  std::vector<int32_t> active_;
+  std::vector<uint16_t> breaks_;
+  std::vector<ParagraphLine> lines_;
+  int chunkStart_ = 0;
+  int chunkNext_ = 0;  // Provider index where the next chunk (or paragraph) starts
+  bool chunkEndsParagraph_ = false;
+  bool chunkValid_ = false;   // lines_ hold a chunk broken for chunkKey_ (see invalidateCaches())
+  bool chunkInSync_ = false;  // The chunk follows its paragraph's breaks (see seekLine())
+  ChunkKey chunkKey_ = {};
+  uint32_t chunkBreakCount_ = 0;
+  TextAlignment paragraphAlignment_ = ALIGN_LEFT;
 
   // Line count mismatch tracking for testing
   bool lineCountMismatch_ = false;
@@ -20,10 +20,49 @@ LayoutStrategy::~LayoutStrategy() {
 }
 
 void LayoutStrategy::setLanguage(Language language) {
+  setHyphenationStrategy(createHyphenationStrategy(language));
+}
+
+void LayoutStrategy::setHyphenationStrategy(HyphenationStrategy* strategy) {
   if (hyphenationStrategy_) {
     delete hyphenationStrategy_;
   }
-  hyphenationStrategy_ = createHyphenationStrategy(language);
+  hyphenationStrategy_ = strategy;
+  invalidateCaches();
+}
+
+void LayoutStrategy::PageLayout::clear() {
+  lines.clear();
+  words.clear();
+  text.clear();
+  endPosition = 0;
+}
+
+void LayoutStrategy::PageLayout::beginLine(TextAlignment alignment) {
+  lines.push_back({static_cast<uint16_t>(words.size()), 0, alignment});
+}
+
+LayoutStrategy::PageWord& LayoutStrategy::PageLayout::addWord(const char* wordText, size_t length, int16_t width,
+                                                              FontStyle style, bool wasSplit) {
+  const uint32_t offset = static_cast<uint32_t>(text.size());
+  text.insert(text.end(), wordText, wordText + length);
+  text.push_back('\0');
+  words.push_back({offset, static_cast<uint16_t>(length), width, 0, 0, wasSplit, style});
+  lines.back().wordCount++;
+  return words.back();
+}
+
+void LayoutStrategy::PageLayout::popWord() {
+  text.resize(words.back().textOffset);
+  words.pop_back();
+  lines.back().wordCount--;
+}
+
+LayoutStrategy::PageLayout LayoutStrategy::layoutText(WordProvider& provider, TextRenderer& renderer,
+                                                      const LayoutConfig& config) {
+  PageLayout page;
+  layoutPage(provider, renderer, config, page);
+  return page;
 }
 
 LayoutStrategy::Line LayoutStrategy::getNextLine(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth,
@@ -296,15 +335,14 @@ int LayoutStrategy::getPreviousPageStart(WordProvider& provider, TextRenderer& r
 LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitForward(const Word& word, int16_t availableWidth,
                                                                        TextRenderer& renderer) {
   // Find the last (rightmost) hyphen position where the first part fits
-  std::vector<int> hyphenPositions;
+  HyphenationStrategy::HyphenPositions hyphenPositions = {nullptr, 0};
   if (hyphenationStrategy_) {
-    std::string stdWord = word.text.c_str();
-    hyphenPositions = hyphenationStrategy_->findHyphenPositions(stdWord);
+    hyphenPositions = hyphenationStrategy_->findHyphenPositionsCached(word.text.c_str(), word.text.length());
   }
   HyphenSplit result = {-1, false, false};
 
-  for (int i = 0; i < hyphenPositions.size(); i++) {
-    int pos = hyphenPositions[i];
+  for (size_t i = 0; i < hyphenPositions.count; i++) {
+    int pos = hyphenPositions.positions[i];
     bool isAlgorithmic = pos < 0;
     int actualPos = isAlgorithmic ? -(pos + 1) : pos;
 
@@ -336,15 +374,14 @@ LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitForward(const Wor
 LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitBackward(const Word& word, int16_t availableWidth,
                                                                         TextRenderer& renderer) {
   // Find the earliest (leftmost) hyphen position where the second part fits
-  std::vector<int> hyphenPositions;
+  HyphenationStrategy::HyphenPositions hyphenPositions = {nullptr, 0};
   if (hyphenationStrategy_) {
-    std::string stdWord = word.text.c_str();
-    hyphenPositions = hyphenationStrategy_->findHyphenPositions(stdWord);
+    hyphenPositions = hyphenationStrategy_->findHyphenPositionsCached(word.text.c_str(), word.text.length());
   }
   HyphenSplit result = {-1, false, false};
 
-  for (int i = hyphenPositions.size() - 1; i >= 0; i--) {
-    int pos = hyphenPositions[i];
+  for (int i = (int)hyphenPositions.count - 1; i >= 0; i--) {
+    int pos = hyphenPositions.positions[i];
     bool isAlgorithmic = pos < 0;
     int actualPos = isAlgorithmic ? -(pos + 1) : pos;
 
@@ -376,6 +413,12 @@ LayoutStrategy::Line LayoutStrategy::test_getNextLineDefault(WordProvider& provi
   return getNextLine(provider, renderer, maxWidth, isParagraphEnd, ALIGN_LEFT);
 }
 
+LayoutStrategy::Line LayoutStrategy::test_getNextLayoutLine(WordProvider& provider, TextRenderer& renderer,
+                                                            const LayoutConfig& config, bool& isParagraphEnd) {
+  return getNextLine(provider, renderer, config.pageWidth - config.marginLeft - config.marginRight, isParagraphEnd,
+                     config.alignment);
+}
+
 int LayoutStrategy::test_getPreviousPageStart(WordProvider& provider, TextRenderer& renderer,
                                               const LayoutConfig& config, int currentStartPosition) {
   return getPreviousPageStart(provider, renderer, config, currentStartPosition);
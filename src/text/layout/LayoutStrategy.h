@@ -58,7 +58,8 @@ class LayoutStrategy {
     int16_t pageWidth;
     int16_t pageHeight;
     TextAlignment alignment;
-    Language language;  // Language for hyphenation
+    Language language;              // Language for hyphenation
+    uint32_t hyphenationRules = 0;  // HyphenationStrategy::getRulesId() of the rules used
   };
 
   // Paragraph result: multiple lines of words and the provider end position for each line
@@ -67,9 +68,52 @@ class LayoutStrategy {
     std::vector<int> lineEndPositions;  // provider index after each line
   };
 
+  // A word placed on a page. Its text is `length` bytes (NUL terminated) at
+  // `textOffset` in the page's text slab.
+  struct PageWord {
+    uint32_t textOffset;
+    uint16_t length;
+    int16_t width;
+    int16_t x;
+    int16_t y;
+    bool wasSplit;
+    FontStyle style;
+  };
+
+  // Words [firstWord, firstWord + wordCount) of the page
+  struct PageLine {
+    uint16_t firstWord;
+    uint16_t wordCount;
+    TextAlignment alignment;
+  };
+
+  // A laid out page, flat: one line array, one word array and one text slab
+  // the words point into. clear() keeps the capacity, so a page reused for
+  // every layout (as TextViewerScreen's page slots are) stops allocating once
+  // it has held a full page.
   struct PageLayout {
-    std::vector<Line> lines;
-    int endPosition;  // provider index at end of page
+    std::vector<PageLine> lines;
+    std::vector<PageWord> words;
+    std::vector<char> text;
+    int endPosition = 0;  // provider index at end of page
+
+    void clear();
+    // Starts a new (empty) line; words added next belong to it
+    void beginLine(TextAlignment alignment);
+    // Adds a word (x and y still 0) to the last line
+    PageWord& addWord(const char* wordText, size_t length, int16_t width, FontStyle style, bool wasSplit);
+    // Removes the last line's last word
+    void popWord();
+
+    const char* wordText(const PageWord& word) const {
+      return text.data() + word.textOffset;
+    }
+    PageWord* lineWords(const PageLine& line) {
+      return words.data() + line.firstWord;
+    }
+    const PageWord* lineWords(const PageLine& line) const {
+      return words.data() + line.firstWord;
+    }
   };
 
   LayoutStrategy();
@@ -79,9 +123,25 @@ class LayoutStrategy {
   // Set the language for hyphenation (updates hyphenation strategy)
   void setLanguage(Language language);
 
-  // Main layout method: takes words from a provider and computes layout
-  // Returns page layout with lines and end position
-  virtual PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config) = 0;
+  // Use `strategy` for hyphenation (e.g. a loaded dictionary); takes ownership
+  void setHyphenationStrategy(HyphenationStrategy* strategy);
+
+  // Forget layout state kept between calls (call when the provider is replaced
+  // or its text changes: a new object may reuse the old one's address)
+  virtual void invalidateCaches() {}
+
+  // Hyphenation strategy for the current language (for its cache statistics)
+  const HyphenationStrategy* getHyphenationStrategy() const {
+    return hyphenationStrategy_;
+  }
+
+  // Main layout method: takes words from a provider and lays out one page
+  // into `page` (cleared first, its storage reused) with its end position
+  virtual void layoutPage(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                          PageLayout& page) = 0;
+
+  // layoutPage() into a new page
+  PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config);
 
   // Render a previously computed page layout
   virtual void renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) = 0;
@@ -108,6 +168,9 @@ class LayoutStrategy {
   int test_getPreviousPageStart(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
                                 int currentStartPosition);
   Line test_getNextLineDefault(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth, bool& isParagraphEnd);
+  // Next line as this strategy's layoutText() breaks it; the provider moves to the line after
+  virtual Line test_getNextLayoutLine(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                                      bool& isParagraphEnd);
 
  protected:
   struct HyphenSplit {
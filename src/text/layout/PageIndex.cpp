@@ -0,0 +1,275 @@
+#include "PageIndex.h"
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include <algorithm>
+#include <cstring>
+
+// File layout (little endian):
+//   magic "PIDX", u8 version, u8 flags, u16 reserved,
+//   u32 key, u32 source size, u32 count, i32 starts[count]
+static const char PAGE_INDEX_MAGIC[4] = {'P', 'I', 'D', 'X'};
+static constexpr uint8_t PAGE_INDEX_VERSION = 1;
+static constexpr uint8_t PAGE_INDEX_FLAG_COMPLETE = 0x01;
+static constexpr size_t PAGE_INDEX_HEADER_SIZE = 20;
+// Sanity cap so a corrupt count can't make us allocate the whole heap
+static constexpr uint32_t PAGE_INDEX_MAX_PAGES = 16384;
+
+static void putU32_pi(uint8_t* p, uint32_t v) {
+  p[0] = (uint8_t)(v & 0xFF);
+  p[1] = (uint8_t)((v >> 8) & 0xFF);
+  p[2] = (uint8_t)((v >> 16) & 0xFF);
+  p[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t getU32_pi(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t fnv1a32Mix_pi(uint32_t h, uint32_t v) {
+  for (int i = 0; i < 4; ++i) {
+    h ^= (v >> (i * 8)) & 0xFF;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static uint32_t fnv1a32Str_pi(uint32_t h, const char* s) {
+  if (!s) {
+    return h;
+  }
+  while (*s) {
+    h ^= (uint8_t)(*s++);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+PageIndex::PageIndex() {
+  starts_.push_back(0);
+}
+
+uint32_t PageIndex::computeKey(const LayoutStrategy::LayoutConfig& config, const FontFamily* family,
+                               LayoutStrategy::Type strategyType) {
+  uint32_t h = 2166136261u;
+  h = fnv1a32Mix_pi(h, (uint32_t)strategyType);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.marginLeft);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.marginRight);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.marginTop);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.marginBottom);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.lineHeight);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.paragraphSpacing);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.minSpaceWidth);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.pageWidth);
+  h = fnv1a32Mix_pi(h, (uint16_t)config.pageHeight);
+  h = fnv1a32Mix_pi(h, (uint32_t)config.alignment);
+  h = fnv1a32Mix_pi(h, (uint32_t)config.language);
+  h = fnv1a32Mix_pi(h, config.hyphenationRules);
+  if (family) {
+    h = fnv1a32Str_pi(h, family->familyName);
+    if (family->regular) {
+      h = fnv1a32Str_pi(h, family->regular->name);
+      h = fnv1a32Mix_pi(h, family->regular->size);
+      h = fnv1a32Mix_pi(h, family->regular->yAdvance);
+      h = fnv1a32Mix_pi(h, family->regular->glyphCount);
+    }
+  }
+  return h;
+}
+
+bool PageIndex::matches(const String& sourcePath, uint32_t key) const {
+  return key_ == key && sourcePath_ == sourcePath;
+}
+
+void PageIndex::clear() {
+  starts_.clear();
+  starts_.push_back(0);
+  complete_ = false;
+  dirty_ = false;
+}
+
+void PageIndex::open(const String& sourcePath, uint32_t key) {
+  clear();
+  sourcePath_ = sourcePath;
+  key_ = key;
+  sourceSize_ = 0;
+  path_ = String("");
+
+  if (sourcePath_.isEmpty()) {
+    return;
+  }
+  path_ = sourcePath_ + String(".pidx");
+
+  File src = SD.open(sourcePath_.c_str());
+  // "file#N" names chapter N inside a multi-chapter file; validate against the file itself
+  const int hash = sourcePath_.lastIndexOf('#');
+  if (!src && hash > 0) {
+    src = SD.open(sourcePath_.substring(0, hash).c_str());
+  }
+  if (!src) {
+    // Without a stable source size the index can't be validated; keep it in RAM only
+    path_ = String("");
+    return;
+  }
+  sourceSize_ = (uint32_t)src.size();
+  src.close();
+
+  if (load()) {
+    Serial.printf("  PageIndex: loaded %u page starts%s from %s\n", (unsigned)starts_.size(),
+                  complete_ ? " (complete)" : "", path_.c_str());
+  }
+}
+
+bool PageIndex::load() {
+  if (!SD.exists(path_.c_str())) {
+    return false;
+  }
+  File f = SD.open(path_.c_str());
+  if (!f) {
+    return false;
+  }
+
+  uint8_t header[PAGE_INDEX_HEADER_SIZE];
+  if (f.read(header, sizeof(header)) != sizeof(header) || memcmp(header, PAGE_INDEX_MAGIC, 4) != 0 ||
+      header[4] != PAGE_INDEX_VERSION) {
+    f.close();
+    return false;
+  }
+  const uint8_t flags = header[5];
+  const uint32_t key = getU32_pi(header + 8);
+  const uint32_t sourceSize = getU32_pi(header + 12);
+  const uint32_t count = getU32_pi(header + 16);
+  if (key != key_ || sourceSize != sourceSize_ || count == 0 || count > PAGE_INDEX_MAX_PAGES) {
+    // Built for another layout (or the chapter was re-converted); start over
+    f.close();
+    return false;
+  }
+
+  std::vector<int32_t> starts(count);
+  const size_t bytes = (size_t)count * 4;
+  uint8_t* raw = (uint8_t*)malloc(bytes);
+  if (!raw) {
+    f.close();
+    return false;
+  }
+  const bool ok = f.read(raw, bytes) == bytes;
+  f.close();
+  if (ok) {
+    for (uint32_t i = 0; i < count; ++i) {
+      starts[i] = (int32_t)getU32_pi(raw + i * 4);
+    }
+  }
+  free(raw);
+
+  // Entries must start at 0 and be strictly increasing to be usable for lookups
+  if (!ok || starts[0] != 0) {
+    return false;
+  }
+  for (uint32_t i = 1; i < count; ++i) {
+    if (starts[i] <= starts[i - 1]) {
+      return false;
+    }
+  }
+
+  starts_.swap(starts);
+  complete_ = (flags & PAGE_INDEX_FLAG_COMPLETE) != 0;
+  dirty_ = false;
+  return true;
+}
+
+void PageIndex::save() {
+  if (!dirty_ || path_.isEmpty()) {
+    return;
+  }
+
+  const size_t bytes = PAGE_INDEX_HEADER_SIZE + starts_.size() * 4;
+  uint8_t* raw = (uint8_t*)malloc(bytes);
+  if (!raw) {
+    return;
+  }
+  memcpy(raw, PAGE_INDEX_MAGIC, 4);
+  raw[4] = PAGE_INDEX_VERSION;
+  raw[5] = complete_ ? PAGE_INDEX_FLAG_COMPLETE : 0;
+  raw[6] = 0;
+  raw[7] = 0;
+  putU32_pi(raw + 8, key_);
+  putU32_pi(raw + 12, sourceSize_);
+  putU32_pi(raw + 16, (uint32_t)starts_.size());
+  for (size_t i = 0; i < starts_.size(); ++i) {
+    putU32_pi(raw + PAGE_INDEX_HEADER_SIZE + i * 4, (uint32_t)starts_[i]);
+  }
+
+  if (SD.exists(path_.c_str())) {
+    SD.remove(path_.c_str());
+  }
+  File f = SD.open(path_.c_str(), FILE_WRITE);
+  if (f) {
+    if (f.write(raw, bytes) == bytes) {
+      dirty_ = false;
+    }
+    f.close();
+  }
+  free(raw);
+
+  if (dirty_) {
+    Serial.printf("  PageIndex: failed to write %s\n", path_.c_str());
+  }
+}
+
+int PageIndex::findStart(int start) const {
+  auto it = std::lower_bound(starts_.begin(), starts_.end(), (int32_t)start);
+  if (it == starts_.end() || *it != start) {
+    return -1;
+  }
+  return (int)(it - starts_.begin());
+}
+
+void PageIndex::recordPage(int start, int end, bool reachedEnd) {
+  const int i = findStart(start);
+  if (i < 0) {
+    // Not reached by forward layout from the chapter start; its breaks may differ
+    return;
+  }
+
+  const size_t next = (size_t)i + 1;
+  if (next < starts_.size()) {
+    if (!reachedEnd && starts_[next] == end) {
+      return;
+    }
+    // The stored tail disagrees with what the layout just produced; drop it
+    starts_.resize(next);
+    complete_ = false;
+    dirty_ = true;
+  }
+
+  if (reachedEnd) {
+    if (!complete_) {
+      complete_ = true;
+      dirty_ = true;
+    }
+    return;
+  }
+
+  if (end > start && starts_.size() < PAGE_INDEX_MAX_PAGES) {
+    starts_.push_back(end);
+    dirty_ = true;
+  }
+}
+
+bool PageIndex::findPreviousStart(int start, int& outPrevStart) const {
+  const int i = findStart(start);
+  if (i <= 0) {
+    return false;
+  }
+  outPrevStart = starts_[i - 1];
+  return true;
+}
+
+bool PageIndex::getLastPageStart(int& outStart) const {
+  if (!complete_) {
+    return false;
+  }
+  outStart = starts_.back();
+  return true;
+}
@@ -0,0 +1,77 @@
+#ifndef PAGE_INDEX_H
+#define PAGE_INDEX_H
+
+#include <WString.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "LayoutStrategy.h"
+
+/**
+ * PageIndex - persistent list of page start offsets for one chapter.
+ *
+ * Pages are recorded as they are laid out forward from the chapter start, so
+ * every entry is a real page break for the layout the index was built with.
+ * A backward page turn then becomes a lookup of the previous entry instead of
+ * a backward re-layout via LayoutStrategy::getPreviousPageStart().
+ *
+ * The index is stored next to the chapter's plain-text file as `<file>.pidx`
+ * and is keyed by a hash of the layout config and font, so changing any
+ * layout-affecting setting simply starts a fresh index.
+ */
+class PageIndex {
+ public:
+  PageIndex();
+
+  // Hash of everything that influences where pages break.
+  static uint32_t computeKey(const LayoutStrategy::LayoutConfig& config, const FontFamily* family,
+                             LayoutStrategy::Type strategyType);
+
+  // Returns true if the index currently represents `sourcePath` with `key`.
+  bool matches(const String& sourcePath, uint32_t key) const;
+
+  // Switch to the index for `sourcePath` (empty = in-memory only). Loads the
+  // stored index if it exists and was built with the same key and source size;
+  // otherwise starts an empty index containing only the chapter start.
+  void open(const String& sourcePath, uint32_t key);
+
+  // Write the index back to SD if it changed since it was loaded.
+  void save();
+
+  // Drop the current index without saving.
+  void clear();
+
+  // Record a page laid out forward from `start` to `end`. Only pages whose
+  // start is already a known break extend the index. `reachedEnd` marks the
+  // page as the last page of the chapter.
+  void recordPage(int start, int end, bool reachedEnd);
+
+  // Start of the page preceding the page that starts at `start`.
+  bool findPreviousStart(int start, int& outPrevStart) const;
+
+  // Start of the last page of the chapter (only known once the index is complete).
+  bool getLastPageStart(int& outStart) const;
+
+  size_t getPageCount() const {
+    return starts_.size();
+  }
+  bool isComplete() const {
+    return complete_;
+  }
+
+ private:
+  // Index of `start` in starts_, or -1 if it is not a known page break
+  int findStart(int start) const;
+  bool load();
+
+  String path_;
+  String sourcePath_;
+  uint32_t key_ = 0;
+  uint32_t sourceSize_ = 0;
+  std::vector<int32_t> starts_;
+  bool complete_ = false;
+  bool dirty_ = false;
+};
+
+#endif
@@ -55,7 +55,8 @@ void FileBrowserScreen::activate() {
 
 void FileBrowserScreen::show() {
   renderSdBrowser();
-  display.displayBuffer(EInkDisplay::FAST_REFRESH);
+  // Selection moves only change a few rows; the display sends just those
+  display.displayBuffer(EInkDisplay::PARTIAL_REFRESH);
 }
 
 void FileBrowserScreen::renderSdBrowser() {
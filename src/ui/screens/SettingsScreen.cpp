@@ -43,7 +43,8 @@ void SettingsScreen::activate() {
 
 void SettingsScreen::show() {
   renderSettings();
-  display.displayBuffer(EInkDisplay::FAST_REFRESH);
+  // Selection moves only change a few rows; the display sends just those
+  display.displayBuffer(EInkDisplay::PARTIAL_REFRESH);
 }
 
 void SettingsScreen::renderSettings() {
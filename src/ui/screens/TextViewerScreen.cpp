@@ -7,6 +7,7 @@
 #include <resources/fonts/other/MenuFontSmall.h>
 
 #include <cstring>
+#include <utility>
 
 #include "../../content/providers/EpubWordProvider.h"
 #include "../../content/providers/FileWordProvider.h"
@@ -173,6 +174,15 @@ TextViewerScreen::~TextViewerScreen() {
 }
 
 void TextViewerScreen::closeDocument() {
+  pageIndex.save();
+  pageIndex.clear();
+  invalidatePageCache();
+  // Give the page arenas' memory back too
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    pageCache[i].layout = LayoutStrategy::PageLayout();
+  }
+  currentPage = LayoutStrategy::PageLayout();
+  scratchPage = LayoutStrategy::PageLayout();
   delete provider;
   provider = nullptr;
   loadedText = String("");
@@ -254,6 +264,11 @@ void TextViewerScreen::loadSettingsFromFile() {
     layoutConfig.alignment = static_cast<LayoutStrategy::TextAlignment>(alignment);
   }
 
+  // Number of partial page turns before a full refresh clears the ghosting
+  int fullRefreshEvery = kDefaultFullRefreshEvery;
+  s.getInt(String("settings.fullRefreshEvery"), fullRefreshEvery);
+  display.setPartialRefreshBudget(fullRefreshEvery > 0 ? (uint16_t)fullRefreshEvery : 0);
+
   int showChapterNumbersInt = 1;
   if (s.getInt(String("settings.showChapterNumbers"), showChapterNumbersInt)) {
     showChapterNumbers = (showChapterNumbersInt != 0);
@@ -462,23 +477,61 @@ void TextViewerScreen::showPage() {
   Serial.print("Page start: ");
   Serial.println(provider->getCurrentIndex());
 
+  syncPageIndex();
+
+  // Cached layouts are only valid for the layout settings and chapter they were built with
+  {
+    const uint32_t key = PageIndex::computeKey(layoutConfig, getCurrentFontFamily(), layoutStrategy->getType());
+    const String path = provider->getChapterFilePath();
+    const int chapter = provider->getCurrentChapter();
+    if (key != pageCacheKey || chapter != pageCacheChapter || path != pageCachePath) {
+      invalidatePageCache();
+      pageCacheKey = key;
+      pageCacheChapter = chapter;
+      pageCachePath = path;
+    }
+  }
+
   unsigned long layoutStart = millis();
-  LayoutStrategy::PageLayout layout = layoutStrategy->layoutText(*provider, textRenderer, layoutConfig);
+  if (takeCachedPage(provider->getCurrentIndex(), currentPage)) {
+    pageCacheHits++;
+  } else {
+    pageCacheMisses++;
+    layoutStrategy->layoutPage(*provider, textRenderer, layoutConfig, currentPage);
+  }
   unsigned long layoutEnd = millis();
 
   Serial.print("Layout time: ");
   Serial.print(layoutEnd - layoutStart);
   Serial.println(" ms");
+  Serial.printf("Page cache: hits=%u, misses=%u\n", (unsigned)pageCacheHits, (unsigned)pageCacheMisses);
+  Serial.printf("Width cache: hits=%u, misses=%u\n", (unsigned)textRenderer.getWidthCacheHits(),
+                (unsigned)textRenderer.getWidthCacheMisses());
+  if (const HyphenationStrategy* hyphenation = layoutStrategy->getHyphenationStrategy()) {
+    Serial.printf("Hyphen cache: hits=%u, misses=%u, evictions=%u\n", (unsigned)hyphenation->getHyphenCacheHits(),
+                  (unsigned)hyphenation->getHyphenCacheMisses(), (unsigned)hyphenation->getHyphenCacheEvictions());
+  }
 
   pageStartIndex = provider->getCurrentIndex();
-  pageEndIndex = layout.endPosition;
+  pageEndIndex = currentPage.endPosition;
+  pageIndex.recordPage(pageStartIndex, pageEndIndex, provider->getChapterPercentage(pageEndIndex) >= 10000);
+
+  // Page turns use differential refresh; once the display's ghosting budget is
+  // spent it becomes a full refresh, shown without the grayscale overlay
+  const EInkDisplay::RefreshMode refreshMode = display.resolveRefreshMode(EInkDisplay::PARTIAL_REFRESH);
+  const bool doCondition = (refreshMode == EInkDisplay::FULL_REFRESH);
+  const bool renderGray = !doCondition && display.supportsGrayscale() && display.prepareGrayscalePlanes();
 
   unsigned long renderStart = millis();
 
-  // Render to BW buffer
+  // Render to BW buffer, and to the grayscale planes in the same pass
   textRenderer.setFrameBuffer(display.getFrameBuffer());
   textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
-  layoutStrategy->renderPage(layout, textRenderer, layoutConfig);
+  if (renderGray) {
+    textRenderer.setGrayscalePlanes(display.getGrayscaleLsbPlane(), display.getGrayscaleMsbPlane());
+  }
+  layoutStrategy->renderPage(currentPage, textRenderer, layoutConfig);
+  textRenderer.setGrayscalePlanes(nullptr, nullptr);
 
   unsigned long renderEnd = millis();
 
@@ -543,36 +596,108 @@ void TextViewerScreen::showPage() {
   }
 
   // display bw parts
-  const bool doCondition = (kConditionEvery > 0) && (pageRenderCounter > 0) && ((pageRenderCounter % kConditionEvery) == 0);
-  display.displayBuffer(doCondition ? EInkDisplay::FULL_REFRESH : EInkDisplay::FAST_REFRESH);
+  display.displayBuffer(refreshMode);
 
-  if (!doCondition && display.supportsGrayscale()) {
-    // grayscale rendering
-    {
-      textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
-      textRenderer.setFontFamily(getCurrentFontFamily());
-      textRenderer.setFontStyle(FontStyle::REGULAR);
-
-      // Render and copy to LSB buffer
-      display.clearScreen(0xFF);
-      textRenderer.setFrameBuffer(display.getFrameBuffer());
-      textRenderer.setBitmapType(TextRenderer::BITMAP_GRAY_LSB);
-      layoutStrategy->renderPage(layout, textRenderer, layoutConfig);
-      display.copyGrayscaleLsbBuffers(display.getFrameBuffer());
-
-      // Render and copy to MSB buffer
-      display.clearScreen(0xFF);
-      textRenderer.setFrameBuffer(display.getFrameBuffer());
-      textRenderer.setBitmapType(TextRenderer::BITMAP_GRAY_MSB);
-      layoutStrategy->renderPage(layout, textRenderer, layoutConfig);
-      display.copyGrayscaleMsbBuffers(display.getFrameBuffer());
-
-      // display grayscale part
-      display.displayGrayBuffer();
+  if (renderGray) {
+    // display grayscale part from the planes rendered above
+    display.copyGrayscalePlanes();
+    display.displayGrayBuffer();
+  }
+
+  storeCachedPage(pageStartIndex, currentPage);
+  prelayoutNeighbourPages();
+}
+
+void TextViewerScreen::invalidatePageCache() {
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    pageCache[i].valid = false;
+    pageCache[i].layout.clear();
+  }
+  pageCacheNext = 0;
+  pageCacheChapter = -1;
+  pageCachePath = String("");
+  // The provider may be replaced next (possibly at the same address)
+  layoutStrategy->invalidateCaches();
+}
+
+bool TextViewerScreen::hasCachedPage(int startIndex) const {
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    if (pageCache[i].valid && pageCache[i].startIndex == startIndex) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TextViewerScreen::takeCachedPage(int startIndex, LayoutStrategy::PageLayout& outLayout) {
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    if (pageCache[i].valid && pageCache[i].startIndex == startIndex) {
+      // Swap, so the slot keeps outLayout's buffers for its next page
+      std::swap(outLayout, pageCache[i].layout);
+      pageCache[i].valid = false;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TextViewerScreen::storeCachedPage(int startIndex, LayoutStrategy::PageLayout& layout) {
+  // Prefer an empty slot so the ring keeps current/next/previous together
+  int slot = -1;
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    if (!pageCache[i].valid || pageCache[i].startIndex == startIndex) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < 0) {
+    slot = pageCacheNext;
+    pageCacheNext = (pageCacheNext + 1) % kPageCacheSize;
+  }
+  pageCache[slot].valid = true;
+  pageCache[slot].startIndex = startIndex;
+  std::swap(pageCache[slot].layout, layout);
+}
+
+void TextViewerScreen::prelayoutNeighbourPages() {
+  if (!provider) {
+    return;
+  }
+
+  unsigned long start = millis();
+  textRenderer.setFontFamily(getCurrentFontFamily());
+  textRenderer.setFontStyle(FontStyle::REGULAR);
+
+  // Keep the current page and its neighbours (after a turn the old current
+  // page is one of them); pages around the old position are stale
+  int prevStart = 0;
+  const bool prevKnown = pageIndex.findPreviousStart(pageStartIndex, prevStart);
+  for (int i = 0; i < kPageCacheSize; ++i) {
+    const int cachedStart = pageCache[i].startIndex;
+    if (pageCache[i].valid && cachedStart != pageStartIndex && cachedStart != pageEndIndex &&
+        !(prevKnown && cachedStart == prevStart)) {
+      pageCache[i].valid = false;
     }
   }
 
-  pageRenderCounter++;
+  // Next page (within the current chapter)
+  if (provider->getChapterPercentage(pageEndIndex) < 10000 && !hasCachedPage(pageEndIndex)) {
+    provider->setPosition(pageEndIndex);
+    layoutStrategy->layoutPage(*provider, textRenderer, layoutConfig, scratchPage);
+    pageIndex.recordPage(pageEndIndex, scratchPage.endPosition,
+                         provider->getChapterPercentage(scratchPage.endPosition) >= 10000);
+    storeCachedPage(pageEndIndex, scratchPage);
+  }
+
+  // Previous page, only when its start is known without a backward layout
+  if (prevKnown && !hasCachedPage(prevStart)) {
+    provider->setPosition(prevStart);
+    layoutStrategy->layoutPage(*provider, textRenderer, layoutConfig, scratchPage);
+    storeCachedPage(prevStart, scratchPage);
+  }
+
+  provider->setPosition(pageStartIndex);
+  Serial.printf("Speculative layout took %lu ms\n", millis() - start);
 }
 
 void TextViewerScreen::nextPage() {
@@ -624,7 +749,7 @@ void TextViewerScreen::prevPage() {
   textRenderer.setFontFamily(getCurrentFontFamily());
 
   // Find where the previous page starts
-  pageStartIndex = layoutStrategy->getPreviousPageStart(*provider, textRenderer, layoutConfig, pageStartIndex);
+  pageStartIndex = findPreviousPageStart(pageStartIndex);
 
   // Set currentIndex to the start of the previous page
   provider->setPosition(pageStartIndex);
@@ -658,12 +783,46 @@ void TextViewerScreen::jumpToNextChapter() {
     pageStartIndex = provider->getCurrentIndex();
   }
 
-  // Find where the previous page starts
-  pageStartIndex = layoutStrategy->getPreviousPageStart(*provider, textRenderer, layoutConfig, pageStartIndex);
+  // Find where the last page starts
+  textRenderer.setFontFamily(getCurrentFontFamily());
+  pageStartIndex = findPreviousPageStart(pageStartIndex);
   provider->setPosition(pageStartIndex);
   showPage();
 }
 
+void TextViewerScreen::syncPageIndex() {
+  if (!provider) {
+    return;
+  }
+  const String sourcePath = provider->getChapterFilePath();
+  const uint32_t key = PageIndex::computeKey(layoutConfig, getCurrentFontFamily(), layoutStrategy->getType());
+  if (pageIndex.matches(sourcePath, key)) {
+    return;
+  }
+  pageIndex.save();
+  pageIndex.open(sourcePath, key);
+}
+
+int TextViewerScreen::findPreviousPageStart(int startIndex) {
+  syncPageIndex();
+
+  int prevStart = 0;
+  // At the end of the chapter the last page start is known once the chapter was paged through
+  if (!provider->hasNextWord() && pageIndex.getLastPageStart(prevStart) && prevStart < startIndex) {
+    Serial.printf("Previous page start from index: %d\n", prevStart);
+    return prevStart;
+  }
+  if (pageIndex.findPreviousStart(startIndex, prevStart)) {
+    Serial.printf("Previous page start from index: %d\n", prevStart);
+    return prevStart;
+  }
+
+  unsigned long start = millis();
+  prevStart = layoutStrategy->getPreviousPageStart(*provider, textRenderer, layoutConfig, startIndex);
+  Serial.printf("Previous page start by backward layout: %d (%lu ms)\n", prevStart, millis() - start);
+  return prevStart;
+}
+
 void TextViewerScreen::jumpToPreviousChapter() {
   if (!provider)
     return;
@@ -694,7 +853,7 @@ void TextViewerScreen::loadTextFromString(const String& content) {
   // stable storage for its internal copy/operations.
   delete provider;
   loadedText = content;
-  pageRenderCounter = 0;
+  invalidatePageCache();
   if (loadedText.length() > 0) {
     provider = new StringWordProvider(loadedText);
   } else {
@@ -722,7 +881,7 @@ void TextViewerScreen::openFile(const String& sdPath) {
   provider = nullptr;
   noDocumentMessage = String("");
   currentFilePath = sdPath;
-  pageRenderCounter = 0;
+  invalidatePageCache();
 
   // Load the saved position from SD if present
   loadPositionFromFile();
@@ -782,13 +941,23 @@ void TextViewerScreen::openFile(const String& sdPath) {
 
   // Set the hyphenation language based on the file type
   if (isEpub) {
-    // For EPUB files, get language from the EPUB metadata
+    // For EPUB files, get language from the EPUB metadata: a dictionary on SD
+    // for its language tag if there is one, else the built-in patterns
     EpubWordProvider* epubProvider = static_cast<EpubWordProvider*>(provider);
-    Language epubLanguage = epubProvider->getLanguage();
-    layoutStrategy->setLanguage(epubLanguage);
-    Serial.printf("Set hyphenation language to %d for EPUB\n", static_cast<int>(epubLanguage));
+    String languageTag = epubProvider->getLanguageTag();
+    HyphenationStrategy* hyphenation =
+        createHyphenationStrategyForTag(languageTag.c_str(), epubProvider->getLanguage());
+    layoutConfig.language = hyphenation->getLanguage();
+    // Every dictionary reports Language::DICTIONARY; its rules id keeps page
+    // indexes apart between dictionaries and versions of one
+    layoutConfig.hyphenationRules = hyphenation->getRulesId();
+    layoutStrategy->setHyphenationStrategy(hyphenation);
+    Serial.printf("Set hyphenation language to %d for EPUB (%s)\n", static_cast<int>(layoutConfig.language),
+                  languageTag.c_str());
   } else {
     // For non-EPUB files, use default English hyphenation
+    layoutConfig.language = Language::ENGLISH;
+    layoutConfig.hyphenationRules = 0;
     layoutStrategy->setLanguage(Language::ENGLISH);
   }
 
@@ -813,6 +982,7 @@ void TextViewerScreen::openFile(const String& sdPath) {
 void TextViewerScreen::savePositionToFile() {
   if (currentFilePath.length() == 0 || !provider)
     return;
+  pageIndex.save();
   // Build pos file name by appending ".pos" to path
   String posPath = currentFilePath + String(".pos");
   int idx = provider->getCurrentIndex();
@@ -6,6 +6,7 @@
 #include "../../core/SDCardManager.h"
 #include "../../rendering/TextRenderer.h"
 #include "../../text/layout/LayoutStrategy.h"
+#include "../../text/layout/PageIndex.h"
 #include "../UIManager.h"
 #include "Screen.h"
 
@@ -53,13 +54,38 @@ class TextViewerScreen : public Screen {
   SDCardManager& sdManager;
   UIManager& uiManager;
 
-  uint32_t pageRenderCounter = 0;
-  static constexpr uint32_t kConditionEvery = 8;
+  // Default ghosting budget (partial page turns per full refresh), see settings.fullRefreshEvery
+  static constexpr int kDefaultFullRefreshEvery = 8;
 
   WordProvider* provider = nullptr;
   // Keep the loaded text alive for the lifetime of the provider
   String loadedText;
   LayoutStrategy::LayoutConfig layoutConfig;
+  // Page starts of the current chapter for the current layout (see PageIndex)
+  PageIndex pageIndex;
+
+  // Small ring of already laid out pages (current, next, previous). The
+  // neighbours are laid out speculatively after each render so a page turn
+  // only has to rasterize and refresh. Pages move between the slots,
+  // currentPage and scratchPage by swapping, so their buffers are reused as
+  // arenas and paging stops allocating once each has held a full page.
+  struct CachedPage {
+    bool valid = false;
+    int startIndex = 0;
+    LayoutStrategy::PageLayout layout;
+  };
+  static constexpr int kPageCacheSize = 3;
+  CachedPage pageCache[kPageCacheSize];
+  int pageCacheNext = 0;
+  // Page being shown, and the one the neighbours are laid out into
+  LayoutStrategy::PageLayout currentPage;
+  LayoutStrategy::PageLayout scratchPage;
+  // Layout key and chapter file the cached pages were built for
+  uint32_t pageCacheKey = 0;
+  String pageCachePath;
+  int pageCacheChapter = -1;
+  uint32_t pageCacheHits = 0;
+  uint32_t pageCacheMisses = 0;
   // Path of the currently opened SD file (empty when viewing from memory)
   String currentFilePath;
   // Path loaded from settings but not yet opened. begin() will set this and
@@ -77,6 +103,20 @@ class TextViewerScreen : public Screen {
   // Persist/load viewer settings (last opened file path + layout config)
   void saveSettingsToFile();
   void loadSettingsFromFile();
+  // Point `pageIndex` at the current chapter and layout, saving the previous one
+  void syncPageIndex();
+  // Start of the page before `startIndex`, from the page index when possible
+  int findPreviousPageStart(int startIndex);
+  // Drop all cached page layouts (settings, chapter or document changed)
+  void invalidatePageCache();
+  // Take the cached layout starting at `startIndex` out of the ring (swapped
+  // with outLayout)
+  bool takeCachedPage(int startIndex, LayoutStrategy::PageLayout& outLayout);
+  // Store `layout` in the ring; `layout` gets the replaced slot's buffers
+  void storeCachedPage(int startIndex, LayoutStrategy::PageLayout& layout);
+  bool hasCachedPage(int startIndex) const;
+  // Lay out the pages around the current one ahead of the next page turn
+  void prelayoutNeighbourPages();
   // Display an error message on screen
   void showErrorMessage(const char* msg);
 };
@@ -0,0 +1,106 @@
+/**
+ * test_zip.h - Minimal ZIP writer for EPUB tests
+ *
+ * Builds archives in memory so EPUB tests can create their own fixtures.
+ * Entries are stored (uncompressed) unless `deflate` is set. CRCs are left at
+ * zero; epub_parser does not check them.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "lib/miniz.h"
+
+namespace TestZip {
+
+struct Entry {
+  std::string name;
+  std::string data;
+  bool deflate = false;
+};
+
+// Raw DEFLATE stream for `data`, as stored in a ZIP entry
+inline std::string deflateRaw(const std::string& data) {
+  size_t outLen = 0;
+  void* out = tdefl_compress_mem_to_heap(data.data(), data.size(), &outLen, TDEFL_DEFAULT_MAX_PROBES);
+  std::string result(static_cast<const char*>(out), outLen);
+  mz_free(out);
+  return result;
+}
+
+inline void putU16(std::string& out, uint16_t v) {
+  out += (char)(v & 0xFF);
+  out += (char)((v >> 8) & 0xFF);
+}
+
+inline void putU32(std::string& out, uint32_t v) {
+  putU16(out, (uint16_t)(v & 0xFFFF));
+  putU16(out, (uint16_t)(v >> 16));
+}
+
+// Central directory records carry a 4 byte extra field so readers must skip it
+inline std::string buildStoredZip(const std::vector<Entry>& entries) {
+  std::string zip;
+  std::string central;
+  for (const Entry& e : entries) {
+    const uint32_t offset = (uint32_t)zip.size();
+    const std::string payload = e.deflate ? deflateRaw(e.data) : e.data;
+    const uint16_t method = e.deflate ? 8 : 0;
+    putU32(zip, 0x04034b50);
+    putU16(zip, 20);  // version needed
+    putU16(zip, 0);   // flags
+    putU16(zip, method);
+    putU32(zip, 0);  // mod time + date
+    putU32(zip, 0);  // crc32
+    putU32(zip, (uint32_t)payload.size());
+    putU32(zip, (uint32_t)e.data.size());
+    putU16(zip, (uint16_t)e.name.size());
+    putU16(zip, 0);  // extra length
+    zip += e.name;
+    zip += payload;
+
+    putU32(central, 0x02014b50);
+    putU16(central, 20);  // version made by
+    putU16(central, 20);  // version needed
+    putU16(central, 0);   // flags
+    putU16(central, method);
+    putU32(central, 0);  // mod time + date
+    putU32(central, 0);  // crc32
+    putU32(central, (uint32_t)payload.size());
+    putU32(central, (uint32_t)e.data.size());
+    putU16(central, (uint16_t)e.name.size());
+    putU16(central, 4);  // extra length
+    putU16(central, 0);  // comment length
+    putU16(central, 0);  // disk start
+    putU16(central, 0);  // internal attributes
+    putU32(central, 0);  // external attributes
+    putU32(central, offset);
+    central += e.name;
+    central += std::string("\xAA\xBB\xCC\xDD", 4);
+  }
+
+  const uint32_t centralOffset = (uint32_t)zip.size();
+  zip += central;
+  putU32(zip, 0x06054b50);
+  putU16(zip, 0);
+  putU16(zip, 0);
+  putU16(zip, (uint16_t)entries.size());
+  putU16(zip, (uint16_t)entries.size());
+  putU32(zip, (uint32_t)central.size());
+  putU32(zip, centralOffset);
+  putU16(zip, 0);
+  return zip;
+}
+
+inline bool writeStoredZip(const std::string& path, const std::vector<Entry>& entries) {
+  std::ofstream out(path, std::ios::binary);
+  const std::string zip = buildStoredZip(entries);
+  out.write(zip.data(), (std::streamsize)zip.size());
+  return out.good();
+}
+
+}  // namespace TestZip
@@ -7,6 +7,7 @@ using std::min;
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <string>
 
@@ -112,7 +113,13 @@ struct MockSD {
       f.isOpen = true;
       f.isWriteMode = true;
     } else {
-      // Read mode - load existing file
+      // Read mode - load existing file. Directories open as an empty handle
+      // (reading one as a stream would report a bogus size)
+      std::error_code ec;
+      if (std::filesystem::is_directory(path, ec)) {
+        f.isOpen = true;
+        return f;
+      }
       std::ifstream in(path, std::ios::binary);
       if (in.is_open()) {
         f.isOpen = true;
@@ -140,6 +147,9 @@ struct MockSD {
   bool remove(const char* path) {
     return std::remove(path) == 0;
   }
+  bool rename(const char* from, const char* to) {
+    return std::rename(from, to) == 0;
+  }
 };
 
 extern MockSD SD;
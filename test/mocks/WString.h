@@ -101,6 +101,13 @@ class String {
     return *this;
   }
 
+  bool concat(const char* str, unsigned int length) {
+    if (!str)
+      return false;
+    s_.append(str, length);
+    return true;
+  }
+
   void reserve(size_t size) {
     s_.reserve(size);
   }
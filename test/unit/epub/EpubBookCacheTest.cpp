@@ -0,0 +1,136 @@
+/**
+ * EpubBookCacheTest.cpp - EPUB Book Metadata Cache Test
+ *
+ * Opens a generated EPUB twice. The first open parses container.xml,
+ * content.opf, toc.ncx and the CSS and writes the binary book cache; the
+ * second open must restore the same spine, sizes, TOC, language, cover and
+ * CSS class table from the cache without parsing. A cache written for a
+ * different EPUB file size must be ignored.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "content/epub/EpubReader.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+std::vector<TestZip::Entry> buildBook(const std::string& padding) {
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"META-INF/container.xml",
+                     "<?xml version=\"1.0\"?><container><rootfiles>"
+                     "<rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+                     "</rootfiles></container>"});
+  entries.push_back({"OEBPS/content.opf",
+                     "<?xml version=\"1.0\"?><package><metadata>"
+                     "<dc:language>de</dc:language><meta name=\"cover\" content=\"cover-img\"/></metadata>"
+                     "<manifest>"
+                     "<item id=\"ncx\" href=\"toc.ncx\" media-type=\"application/x-dtbncx+xml\"/>"
+                     "<item id=\"css\" href=\"style.css\" media-type=\"text/css\"/>"
+                     "<item id=\"cover-img\" href=\"images/cover.jpg\" media-type=\"image/jpeg\"/>"
+                     "<item id=\"c1\" href=\"one.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "<item id=\"c2\" href=\"two.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "</manifest><spine toc=\"ncx\"><itemref idref=\"c1\"/><itemref idref=\"c2\"/></spine>"
+                     "</package>" +
+                         padding});
+  entries.push_back({"OEBPS/toc.ncx",
+                     "<?xml version=\"1.0\"?><ncx><navMap>"
+                     "<navPoint><navLabel><text>First</text></navLabel><content src=\"one.xhtml\"/></navPoint>"
+                     "<navPoint><navLabel><text>Second</text></navLabel><content src=\"two.xhtml#part\"/></navPoint>"
+                     "</navMap></ncx>"});
+  entries.push_back({"OEBPS/style.css",
+                     ".center { text-align: center; }\n"
+                     "p.lead { font-weight: bold; font-style: italic; text-indent: 2em; }\n"});
+  entries.push_back({"OEBPS/images/cover.jpg", "jpeg"});
+  entries.push_back({"OEBPS/one.xhtml", "<html><body><p>One</p></body></html>"});
+  entries.push_back({"OEBPS/two.xhtml", "<html><body><p>Two two</p></body></html>"});
+  return entries;
+}
+
+// Everything EpubReader exposes about the book structure, flattened for comparison
+std::string describe(EpubReader& reader) {
+  std::string d = "opf=" + std::string(reader.getContentOpfPath().c_str());
+  d += " lang=" + std::string(reader.getLanguage().c_str());
+  d += " total=" + std::to_string(reader.getTotalBookSize());
+  for (int i = 0; i < reader.getSpineCount(); ++i) {
+    const SpineItem* item = reader.getSpineItem(i);
+    d += " spine[" + std::string(item->idref.c_str()) + "," + std::string(item->href.c_str()) + "," +
+         std::to_string(reader.getSpineItemSize(i)) + "," + std::to_string(reader.getSpineItemOffset(i)) + "]";
+  }
+  for (int i = 0; i < reader.getTocCount(); ++i) {
+    const TocItem* item = reader.getTocItem(i);
+    d += " toc[" + std::string(item->title.c_str()) + "," + std::string(item->href.c_str()) + "," +
+         std::string(item->anchor.c_str()) + "]";
+  }
+  const CssParser* css = reader.getCssParser();
+  if (css) {
+    for (const auto& rule : css->getStyles()) {
+      const CssStyle& s = rule.second;
+      d += " css[" + std::string(rule.first.c_str()) + "," + std::to_string(s.hasTextAlign) +
+           std::to_string((int)s.textAlign) + "," + std::to_string(s.hasFontWeight) +
+           std::to_string((int)s.fontWeight) + "," + std::to_string(s.hasFontStyle) +
+           std::to_string((int)s.fontStyle) + "," + std::to_string(s.hasTextIndent) + std::to_string(s.textIndent) +
+           "]";
+    }
+  }
+  return d;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EPUB Book Cache Test");
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/book_cache_test.epub";
+  const std::string extractDir = TestConfig::TEST_OUTPUT_DIR + "/epub_book_cache_test";
+  std::filesystem::remove_all(extractDir);
+  TestZip::writeStoredZip(path, buildBook(""));
+
+  std::string parsed;
+  {
+    EpubReader reader(path.c_str());
+    runner.expectTrue(reader.isValid(), "First open succeeds");
+    runner.expectTrue(!reader.isLoadedFromCache(), "First open parses the EPUB");
+    runner.expectTrue(std::filesystem::exists(extractDir + "/book_meta.bin"), "First open writes the book cache");
+    runner.expectTrue(reader.getSpineCount() == 2 && reader.getTocCount() == 2, "Spine and TOC are parsed");
+    runner.expectEqual("de", reader.getLanguage().c_str(), "Language is parsed");
+    parsed = describe(reader);
+  }
+
+  {
+    EpubReader reader(path.c_str());
+    runner.expectTrue(reader.isValid(), "Second open succeeds");
+    runner.expectTrue(reader.isLoadedFromCache(), "Second open restores the book from the cache");
+    runner.expectEqual(parsed, describe(reader), "Cached structure matches the parsed one");
+    runner.expectTrue(reader.getCssParser() && reader.getCssParser()->getStyleForClass("lead") != nullptr,
+                      "CSS class table is restored");
+    runner.expectTrue(reader.getCoverImagePath().length() > 0, "Cover href is restored");
+  }
+
+  // Same extract directory, different EPUB size: the cache must not be trusted.
+  // Keep the extract meta in place so only the book cache's own check applies.
+  TestZip::writeStoredZip(path, buildBook("<!-- padding -->"));
+  {
+    const std::string metaPath = extractDir + "/epub_meta.txt";
+    std::ofstream meta(metaPath);
+    meta << "version=7\nfilesize=" << std::filesystem::file_size(path) << "\n";
+  }
+  {
+    EpubReader reader(path.c_str());
+    runner.expectTrue(reader.isValid(), "Open after the EPUB changed succeeds");
+    runner.expectTrue(!reader.isLoadedFromCache(), "Cache for another file size is ignored");
+    runner.expectEqual(parsed, describe(reader), "Reparsed structure is unchanged");
+  }
+
+  std::filesystem::remove_all(extractDir);
+  std::filesystem::remove(path);
+  return runner.allPassed() ? 0 : 1;
+}
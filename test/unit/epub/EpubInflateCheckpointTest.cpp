@@ -0,0 +1,214 @@
+/**
+ * EpubInflateCheckpointTest.cpp - Seekable Inflate Stream Test
+ *
+ * Streams a DEFLATE entry once while recording inflate checkpoints, then
+ * seeks a fresh stream backwards and forwards and checks every read against
+ * the original data. Corrupting the start of the compressed data afterwards
+ * proves that seeks resume from a checkpoint instead of inflating from byte
+ * 0. Also covers stored entries, small entries and stale checkpoint files.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "content/epub/epub_parser.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+// Varied text so the compressor emits many blocks and back references
+std::string buildText(size_t size) {
+  static const char* words[] = {"river", "lantern", "quietly", "the", "of", "marble", "seventeen", "and",
+                                "harbour", "<p>", "</p>", "winter", "glass", "a", "copper", "north"};
+  std::string text;
+  uint32_t seed = 12345;
+  while (text.size() < size) {
+    seed = seed * 1103515245u + 12345u;
+    text += words[(seed >> 16) % 16];
+    text += (seed & 0x100) ? " " : "\n";
+    if ((seed & 0xF00) == 0) {
+      text += std::to_string(seed);
+    }
+  }
+  text.resize(size);
+  return text;
+}
+
+std::string readAll(epub_stream_context* ctx) {
+  std::string out;
+  char buf[1000];
+  int n;
+  while ((n = epub_read_chunk(ctx, buf, sizeof(buf))) > 0) {
+    out.append(buf, (size_t)n);
+  }
+  return out;
+}
+
+std::string readSome(epub_stream_context* ctx, size_t len) {
+  std::string out(len, '\0');
+  size_t got = 0;
+  while (got < len) {
+    const int n = epub_read_chunk(ctx, &out[got], len - got);
+    if (n <= 0) {
+      break;
+    }
+    got += (size_t)n;
+  }
+  out.resize(got);
+  return out;
+}
+
+// Seek to each offset in turn and compare the next bytes with the original
+bool seeksMatch(epub_stream_context* ctx, const std::string& text, const std::vector<size_t>& offsets) {
+  bool ok = true;
+  for (size_t offset : offsets) {
+    const size_t len = offset + 700 <= text.size() ? 700 : text.size() - offset;
+    if (epub_seek_stream(ctx, offset) != 0 || epub_stream_tell(ctx) != offset ||
+        readSome(ctx, len) != text.substr(offset, len)) {
+      std::cout << "  seek to " << offset << " failed\n";
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EPUB Inflate Checkpoint Test");
+
+  const std::string big = buildText(300000);
+  const std::string small = buildText(5000);
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"OEBPS/big.xhtml", big, true});
+  entries.push_back({"OEBPS/small.xhtml", small, true});
+  entries.push_back({"OEBPS/stored.xhtml", big});
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/inflate_checkpoint_test.epub";
+  const std::string cpPath = TestConfig::TEST_OUTPUT_DIR + "/inflate_checkpoint_test.icp";
+  const std::string smallCpPath = TestConfig::TEST_OUTPUT_DIR + "/inflate_checkpoint_small.icp";
+  std::remove(cpPath.c_str());
+  std::remove(smallCpPath.c_str());
+  TestZip::writeStoredZip(path, entries);
+
+  epub_reader* reader = nullptr;
+  epub_error err = epub_open(path.c_str(), &reader);
+  runner.expectTrue(err == EPUB_OK && reader != nullptr, "Archive opens", epub_get_error_string(err));
+  if (!reader) {
+    return 1;
+  }
+  uint32_t bigIndex = 0;
+  uint32_t smallIndex = 0;
+  uint32_t storedIndex = 0;
+  epub_locate_file(reader, "OEBPS/big.xhtml", &bigIndex);
+  epub_locate_file(reader, "OEBPS/small.xhtml", &smallIndex);
+  epub_locate_file(reader, "OEBPS/stored.xhtml", &storedIndex);
+  epub_file_info info;
+  epub_get_file_info(reader, bigIndex, &info);
+  runner.expectTrue(info.compression == 8 && info.compressed_size < info.uncompressed_size, "Entry is deflated");
+
+  // First pass records checkpoints every 32KB and still returns the exact data
+  const std::vector<size_t> offsets = {250000, 1000, 131072, 299500, 0, 65536, 65535, 200000, 33000, 299999};
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, bigIndex, 4096);
+    runner.expectTrue(epub_stream_set_checkpoints(ctx, cpPath.c_str(), 32 * 1024) == EPUB_OK,
+                      "Checkpoint recording starts");
+    runner.expectTrue(readAll(ctx) == big, "Recording pass returns the original data");
+    epub_end_streaming(ctx);
+  }
+  const size_t recordSize = 16 + sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE;
+  const size_t cpSize = std::filesystem::exists(cpPath) ? std::filesystem::file_size(cpPath) : 0;
+  runner.expectTrue(cpSize > 32 && (cpSize - 32) % recordSize == 0 && (cpSize - 32) / recordSize == 9,
+                    "One checkpoint per 32KB of output", std::to_string(cpSize));
+
+  // A second stream uses the checkpoints for seeks in any direction
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, bigIndex, 4096);
+    runner.expectTrue(epub_stream_set_checkpoints(ctx, cpPath.c_str(), 0) == EPUB_OK, "Checkpoint file is accepted");
+    runner.expectTrue(seeksMatch(ctx, big, offsets), "Seeks with checkpoints return the right bytes");
+    epub_end_streaming(ctx);
+  }
+  // Without checkpoints seeking still works by inflating from the start
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, bigIndex, 4096);
+    runner.expectTrue(seeksMatch(ctx, big, offsets), "Seeks without checkpoints return the right bytes");
+    epub_end_streaming(ctx);
+  }
+  // Stored entries seek directly
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, storedIndex, 4096);
+    runner.expectTrue(seeksMatch(ctx, big, offsets), "Seeks in a stored entry return the right bytes");
+    runner.expectTrue(epub_stream_set_checkpoints(ctx, cpPath.c_str(), 0) == EPUB_ERROR_INVALID_PARAM,
+                      "Stored entries take no checkpoints");
+    epub_end_streaming(ctx);
+  }
+  // Entries shorter than one interval record nothing
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, smallIndex, 4096);
+    runner.expectTrue(epub_stream_set_checkpoints(ctx, smallCpPath.c_str(), 0) == EPUB_OK &&
+                          readAll(ctx) == small && !std::filesystem::exists(smallCpPath),
+                      "Small entry streams without a checkpoint file");
+    epub_end_streaming(ctx);
+  }
+  // A checkpoint file for another entry is not used; recording one for this entry replaces it
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, smallIndex, 4096);
+    runner.expectTrue(epub_stream_set_checkpoints(ctx, cpPath.c_str(), 1024) == EPUB_OK && readAll(ctx) == small,
+                      "Stale checkpoint file is re-recorded");
+    epub_end_streaming(ctx);
+    std::remove(cpPath.c_str());
+  }
+  // Re-record the big entry, then abandon a recording halfway: it must not be used
+  {
+    epub_stream_context* ctx = epub_start_streaming(reader, bigIndex, 4096);
+    epub_stream_set_checkpoints(ctx, cpPath.c_str(), 32 * 1024);
+    readAll(ctx);
+    epub_end_streaming(ctx);
+    const std::string partial = TestConfig::TEST_OUTPUT_DIR + "/inflate_checkpoint_partial.icp";
+    ctx = epub_start_streaming(reader, bigIndex, 4096);
+    epub_stream_set_checkpoints(ctx, partial.c_str(), 32 * 1024);
+    readSome(ctx, 100000);
+    epub_end_streaming(ctx);
+    ctx = epub_start_streaming(reader, bigIndex, 4096);
+    epub_stream_set_checkpoints(ctx, partial.c_str(), 0);
+    runner.expectTrue(seeksMatch(ctx, big, {150000, 10}), "Incomplete recording is ignored");
+    epub_end_streaming(ctx);
+    std::remove(partial.c_str());
+  }
+  const uint32_t dataOffset = (uint32_t)info.file_offset + 30 + (uint32_t)std::string("OEBPS/big.xhtml").size();
+  epub_close(reader);
+
+  // Corrupt the first compressed bytes: only checkpoint seeks past them can still succeed
+  {
+    std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+    f.seekp(dataOffset);
+    const std::string junk(64, '\xFF');
+    f.write(junk.data(), (std::streamsize)junk.size());
+  }
+  err = epub_open(path.c_str(), &reader);
+  if (reader) {
+    epub_stream_context* ctx = epub_start_streaming(reader, bigIndex, 4096);
+    epub_stream_set_checkpoints(ctx, cpPath.c_str(), 0);
+    runner.expectTrue(seeksMatch(ctx, big, {280000, 100000, 40000}),
+                      "Seeks resume from checkpoints without touching the start of the stream");
+    epub_end_streaming(ctx);
+
+    ctx = epub_start_streaming(reader, bigIndex, 4096);
+    runner.expectTrue(epub_seek_stream(ctx, 100000) != 0, "Without checkpoints the corrupted start is reached");
+    epub_end_streaming(ctx);
+    epub_close(reader);
+  }
+
+  std::remove(cpPath.c_str());
+  std::remove(path.c_str());
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/**
+ * EpubStoredEntryTest.cpp - Zero-Copy Stored Entry Test
+ *
+ * Builds a stored (uncompressed) EPUB and checks that epub_get_stored_range()
+ * points at the entry's bytes, that SimpleXmlParser::openRange() parses those
+ * bytes in place exactly like the same document parsed from memory (text
+ * nodes are read by seeking back, which stream mode cannot do), and that the
+ * parser never reads into the ZIP entry that follows.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "content/epub/EpubReader.h"
+#include "content/epub/epub_parser.h"
+#include "content/xml/SimpleXmlParser.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+// Every node as one line: type, name, positions and text content
+std::string dumpNodes(SimpleXmlParser& parser) {
+  std::string out;
+  while (parser.read()) {
+    out += std::to_string((int)parser.getNodeType()) + " " + parser.getName().c_str() + " " +
+           std::to_string(parser.getElementStartPos()) + "-" + std::to_string(parser.getElementEndPos());
+    if (parser.getNodeType() == SimpleXmlParser::Element) {
+      out += std::string(" class=") + parser.getAttribute("class").c_str();
+    }
+    if (parser.getNodeType() == SimpleXmlParser::Text) {
+      out += " '";
+      while (parser.hasMoreTextChars()) {
+        out += parser.readTextNodeCharForward();
+      }
+      out += "'";
+    }
+    out += "\n";
+  }
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EPUB Stored Entry Test");
+
+  // Larger than several parser buffers so reads cross buffer boundaries
+  std::string chapter = "<?xml version=\"1.0\"?><html><body>";
+  for (int i = 0; i < 300; ++i) {
+    chapter += "<p class=\"c" + std::to_string(i % 5) + "\">Paragraph " + std::to_string(i) +
+               " with <b>bold</b> and <!-- note --> <i>italic</i> text.</p>\n";
+  }
+  chapter += "</body></html>";
+
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"OEBPS/chapter.xhtml", chapter});
+  entries.push_back({"OEBPS/next.xhtml", "<p>LEAK</p>"});
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/stored_entry_test.epub";
+  TestZip::writeStoredZip(path, entries);
+
+  epub_reader* reader = nullptr;
+  epub_error err = epub_open(path.c_str(), &reader);
+  runner.expectTrue(err == EPUB_OK && reader != nullptr, "Archive opens", epub_get_error_string(err));
+  if (!reader) {
+    return 1;
+  }
+
+  uint32_t index = 0;
+  uint32_t offset = 0;
+  uint32_t size = 0;
+  epub_locate_file(reader, "OEBPS/chapter.xhtml", &index);
+  err = epub_get_stored_range(reader, index, &offset, &size);
+  runner.expectTrue(err == EPUB_OK, "Stored range is found", epub_get_error_string(err));
+  runner.expectTrue(epub_get_stored_range(reader, 999, &offset, &size) == EPUB_ERROR_INVALID_PARAM,
+                    "Out-of-range index is rejected");
+  err = epub_get_stored_range(reader, index, &offset, &size);
+  epub_close(reader);
+
+  {
+    std::ifstream in(path, std::ios::binary);
+    const std::string zip((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    runner.expectTrue(size == chapter.size() && offset + size <= zip.size() && zip.substr(offset, size) == chapter,
+                      "Range covers exactly the entry's data");
+  }
+
+  SimpleXmlParser memoryParser;
+  runner.expectTrue(memoryParser.openFromMemory(chapter.data(), chapter.size()), "Parser opens from memory");
+  const std::string expected = dumpNodes(memoryParser);
+  memoryParser.close();
+
+  SimpleXmlParser rangeParser;
+  runner.expectTrue(rangeParser.openRange(path.c_str(), offset, size), "Parser opens on the stored range");
+  runner.expectEqual(std::to_string(chapter.size()), std::to_string(rangeParser.getFileSize()),
+                     "File size is the range length");
+  const std::string actual = dumpNodes(rangeParser);
+  rangeParser.close();
+  runner.expectTrue(!expected.empty() && actual == expected,
+                    "Parsing in place matches parsing from memory (nodes, positions, text)");
+  runner.expectTrue(actual.find("LEAK") == std::string::npos, "Parser stops at the end of the range");
+  runner.expectTrue(!rangeParser.openRange(path.c_str(), offset, 1 << 30), "Range past the end of file is rejected");
+
+  // Through EpubReader: stored entries report a range, missing ones do not
+  {
+    EpubReader epub(path.c_str());
+    uint32_t readerOffset = 0;
+    uint32_t readerSize = 0;
+    runner.expectTrue(epub.getStoredEntryRange("OEBPS/chapter.xhtml", readerOffset, readerSize) &&
+                          readerOffset == offset && readerSize == size,
+                      "EpubReader reports the same stored range");
+    runner.expectTrue(!epub.getStoredEntryRange("OEBPS/missing.xhtml", readerOffset, readerSize),
+                      "Missing entry has no stored range");
+  }
+
+  std::filesystem::remove_all(TestConfig::TEST_OUTPUT_DIR + "/epub_stored_entry_test");
+  std::remove(path.c_str());
+  return runner.allPassed() ? 0 : 1;
+}
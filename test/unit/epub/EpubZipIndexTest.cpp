@@ -0,0 +1,107 @@
+/**
+ * EpubZipIndexTest.cpp - ZIP Central Directory Index Test
+ *
+ * Builds a stored (uncompressed) ZIP with many entries and checks that
+ * epub_locate_file() finds every entry through the filename hash index,
+ * rejects names that are not in the archive, keeps the first entry when a
+ * name is duplicated, and that the entries still extract correctly.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "content/epub/epub_parser.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+int collect(const void* data, size_t size, void* userData) {
+  static_cast<std::string*>(userData)->append(static_cast<const char*>(data), size);
+  return 1;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("EPUB ZIP Index Test");
+
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"META-INF/container.xml", "<container/>"});
+  for (int i = 0; i < 1500; ++i) {
+    const std::string n = std::to_string(i);
+    entries.push_back({"OEBPS/images/img" + n + ".jpg", "image " + n});
+  }
+  entries.push_back({"OEBPS/text/chapter.xhtml", "first"});
+  entries.push_back({"OEBPS/text/chapter.xhtml", "second"});  // duplicate name
+  entries.push_back({std::string(300, 'x'), "long name"});
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/zip_index_test.epub";
+  TestZip::writeStoredZip(path, entries);
+
+  epub_reader* reader = nullptr;
+  epub_error err = epub_open(path.c_str(), &reader);
+  runner.expectTrue(err == EPUB_OK && reader != nullptr, "Archive opens", epub_get_error_string(err));
+  if (!reader) {
+    return 1;
+  }
+  runner.expectTrue(epub_get_file_count(reader) == entries.size(), "Entry count matches");
+
+  // Every unique name resolves to its own entry; the duplicate resolves to the first copy
+  bool allFound = true;
+  bool namesMatch = true;
+  for (uint32_t i = 0; i < entries.size(); ++i) {
+    const bool isSecondCopy = i > 0 && entries[i].name == entries[i - 1].name;
+    uint32_t index = UINT32_MAX;
+    if (epub_locate_file(reader, entries[i].name.c_str(), &index) != EPUB_OK ||
+        index != (isSecondCopy ? i - 1 : i)) {
+      allFound = false;
+      std::cout << "  lookup failed for entry " << i << "\n";
+    }
+    epub_file_info info;
+    if (epub_get_file_info(reader, i, &info) != EPUB_OK ||
+        std::string(info.filename) != entries[i].name.substr(0, sizeof(info.filename) - 1)) {
+      namesMatch = false;
+    }
+  }
+  runner.expectTrue(allFound, "Every entry is found through the index (first copy wins for duplicates)");
+  runner.expectTrue(namesMatch, "File info reports the stored names");
+
+  // Names that are not in the archive, including prefixes and extensions of real names
+  const char* missing[] = {"", "OEBPS/images/img", "OEBPS/images/img1500.jpg", "OEBPS/images/img12.jpgx",
+                           "mimetyp", "META-INF/container.xml/"};
+  bool noneFound = true;
+  for (const char* name : missing) {
+    uint32_t index = 0;
+    if (epub_locate_file(reader, name, &index) != EPUB_ERROR_FILE_NOT_IN_ARCHIVE) {
+      noneFound = false;
+      std::cout << "  unexpectedly found '" << name << "'\n";
+    }
+  }
+  runner.expectTrue(noneFound, "Names not in the archive are rejected");
+
+  // The located entries still point at the right data
+  uint32_t index = 0;
+  std::string content;
+  if (epub_locate_file(reader, "OEBPS/images/img777.jpg", &index) == EPUB_OK) {
+    epub_extract_streaming(reader, index, collect, &content, 0);
+  }
+  runner.expectEqual("image 777", content, "Located entry extracts its own data");
+
+  content.clear();
+  if (epub_locate_file(reader, "OEBPS/text/chapter.xhtml", &index) == EPUB_OK) {
+    epub_extract_streaming(reader, index, collect, &content, 0);
+  }
+  runner.expectEqual("first", content, "Duplicate name extracts the first entry");
+
+  epub_close(reader);
+  std::remove(path.c_str());
+  return runner.allPassed() ? 0 : 1;
+}
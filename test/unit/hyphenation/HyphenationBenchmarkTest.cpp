@@ -0,0 +1,176 @@
+/**
+ * HyphenationBenchmarkTest.cpp - Packed Trie Hyphenation Benchmark
+ *
+ * Loads the source patterns (the .pat.txt files under resources/hyphenation)
+ * into a sorted list and hyphenates every word of the _hyphenation_tests.txt
+ * word lists under test/resources twice: with the reference matcher that
+ * binary-searches every substring of the word (the previous implementation),
+ * and with liang_hyphenate() on the generated packed trie. Checks both give the same positions and prints the
+ * throughput of each.
+ *
+ * Usage: HyphenationBenchmarkTest [repetitions]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "test_utils.h"
+#include "text/hyphenation/Liang/hyph-de.h"
+#include "text/hyphenation/Liang/hyph-en-us.h"
+#include "text/hyphenation/Liang/hyphenation.h"
+
+namespace {
+
+struct Pattern {
+  std::string letters;
+  std::vector<uint8_t> values;  // letters.size() + 1 entries
+};
+
+// Liang/TeX pattern file: digits between UTF-8 letters, '%' comments
+std::vector<Pattern> loadPatterns(const std::string& path) {
+  std::vector<Pattern> patterns;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    line = line.substr(0, line.find('%'));
+    if (line.empty()) {
+      continue;
+    }
+    Pattern p;
+    p.values.push_back(0);
+    for (char c : line) {
+      if (c >= '0' && c <= '9') {
+        p.values.back() = (uint8_t)(c - '0');
+      } else if (c != ' ' && c != '\r' && c != '\t') {
+        p.letters += c;
+        p.values.push_back(0);
+      }
+    }
+    patterns.push_back(p);
+  }
+  std::sort(patterns.begin(), patterns.end(),
+            [](const Pattern& a, const Pattern& b) { return a.letters < b.letters; });
+  return patterns;
+}
+
+std::vector<std::string> loadWords(const std::string& path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line[0] != '#') {
+      words.push_back(line.substr(0, line.find('|')));
+    }
+  }
+  return words;
+}
+
+// Reference: binary search for every substring of ".word."
+std::vector<size_t> referenceHyphenate(const std::string& word, const std::vector<Pattern>& patterns) {
+  const std::string ext = "." + word + ".";
+  std::vector<uint8_t> h(ext.size() + 1, 0);
+  for (size_t i = 0; i < ext.size(); ++i) {
+    for (size_t j = i + 1; j <= ext.size(); ++j) {
+      const std::string segment = ext.substr(i, j - i);
+      auto it = std::lower_bound(patterns.begin(), patterns.end(), segment,
+                                 [](const Pattern& p, const std::string& s) { return p.letters < s; });
+      if (it != patterns.end() && it->letters == segment) {
+        for (size_t l = 0; l < it->values.size(); ++l) {
+          h[i + l] = std::max(h[i + l], it->values[l]);
+        }
+      }
+    }
+  }
+  std::vector<size_t> positions;
+  for (size_t k = 1; k < word.size(); ++k) {
+    if (h[k + 1] & 1) {
+      positions.push_back(k);
+    }
+  }
+  return positions;
+}
+
+std::vector<size_t> trieHyphenate(const std::string& word, const HyphenationPatterns& trie) {
+  size_t out[64];
+  const int count = liang_hyphenate(word.c_str(), 0, 0, '.', out, 64, trie);
+  return std::vector<size_t>(out, out + std::min(count, 64));
+}
+
+template <typename F>
+double wordsPerSecond(const std::vector<std::string>& words, int repetitions, F hyphenate) {
+  size_t sink = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; ++r) {
+    for (const auto& word : words) {
+      sink += hyphenate(word).size();
+    }
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (sink == 0) {
+    std::cout << "  (no hyphens found)" << std::endl;
+  }
+  return words.size() * repetitions / (seconds > 0 ? seconds : 1e-9);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  TestUtils::TestRunner runner("Hyphenation Benchmark Test");
+  const int repetitions = argc > 1 ? std::max(1, std::atoi(argv[1])) : 3;
+
+  struct Language {
+    const char* name;
+    const char* patternFile;
+    const char* wordFile;
+    const HyphenationPatterns& trie;
+  };
+  const Language languages[] = {
+      {"english", "resources/hyphenation/hyph-en-us.pat.txt", "test/resources/english_hyphenation_tests.txt",
+       en_us_patterns},
+      {"german", "resources/hyphenation/hyph-de.pat.txt", "test/resources/german_hyphenation_tests.txt",
+       de_patterns},
+  };
+
+  for (const Language& lang : languages) {
+    const std::string name = lang.name;
+    const std::vector<Pattern> patterns = loadPatterns(lang.patternFile);
+    const std::vector<std::string> words = loadWords(lang.wordFile);
+    if (!runner.expectTrue(!patterns.empty() && !words.empty(), name + " patterns and words load")) {
+      continue;
+    }
+    runner.expectTrue(lang.trie.size > HYPHENATION_TRIE_HEADER_SIZE && memcmp(lang.trie.trie, "HYP", 3) == 0 &&
+                          lang.trie.trie[3] == HYPHENATION_TRIE_VERSION,
+                      name + " trie has the format header");
+
+    size_t mismatches = 0;
+    for (const auto& word : words) {
+      if (trieHyphenate(word, lang.trie) != referenceHyphenate(word, patterns)) {
+        if (mismatches++ < 5) {
+          std::cout << "  mismatch: " << word << std::endl;
+        }
+      }
+    }
+    runner.expectTrue(mismatches == 0, name + " trie matches the reference on every word",
+                      std::to_string(mismatches) + " mismatches");
+
+    const double reference = wordsPerSecond(words, repetitions, [&](const std::string& w) {
+      return referenceHyphenate(w, patterns);
+    });
+    const double trie = wordsPerSecond(words, repetitions, [&](const std::string& w) {
+      return trieHyphenate(w, lang.trie);
+    });
+    std::cout << "  " << name << ": " << patterns.size() << " patterns, trie " << lang.trie.size << " bytes, "
+              << words.size() << " words x" << repetitions << std::endl;
+    std::cout << "    substring binary search: " << (long)reference << " words/s" << std::endl;
+    std::cout << "    packed trie:             " << (long)trie << " words/s (" << (trie / reference) << "x)"
+              << std::endl;
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/**
+ * HyphenationCacheTest.cpp - Hyphen Position Cache Test
+ *
+ * Checks findHyphenPositionsCached() returns exactly what
+ * findHyphenPositions() returns for every German and English test word (on
+ * the first lookup and on hits), that hits do not allocate, that the least
+ * recently used word is the one evicted, that words too long for the cache
+ * still get correct positions, and the hit/miss/eviction counters.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "test_utils.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+
+// Count heap allocations so the test can check cache hits make none
+static std::atomic<size_t> allocationCount(0);
+
+void* operator new(size_t size) {
+  allocationCount++;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+std::vector<std::string> loadWords(const std::string& path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line[0] != '#') {
+      words.push_back(line.substr(0, line.find('|')));
+    }
+  }
+  return words;
+}
+
+bool sameAsUncached(HyphenationStrategy& strategy, const std::string& word) {
+  const std::vector<int> expected = strategy.findHyphenPositions(word);
+  const HyphenationStrategy::HyphenPositions cached = strategy.findHyphenPositionsCached(word.data(), word.size());
+  if (cached.count != expected.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < cached.count; i++) {
+    if (cached.positions[i] != expected[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isHit(HyphenationStrategy& strategy, const std::string& word) {
+  const uint32_t hits = strategy.getHyphenCacheHits();
+  strategy.findHyphenPositionsCached(word.data(), word.size());
+  return strategy.getHyphenCacheHits() == hits + 1;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation Cache Test");
+
+  struct Case {
+    Language language;
+    const char* wordFile;
+    const char* name;
+  };
+  const Case cases[] = {
+      {Language::GERMAN, "test/resources/german_hyphenation_tests.txt", "german"},
+      {Language::ENGLISH, "test/resources/english_hyphenation_tests.txt", "english"},
+  };
+
+  for (const Case& c : cases) {
+    HyphenationStrategy* strategy = createHyphenationStrategy(c.language);
+    const std::string name = c.name;
+    std::vector<std::string> words = loadWords(c.wordFile);
+    words.push_back("Rechtsschutzversicherungsgesellschaften");  // Longer than the cache holds
+    words.push_back("well-known");                               // Existing hyphen
+    if (!runner.expectTrue(words.size() > 100, name + " words load")) {
+      delete strategy;
+      continue;
+    }
+
+    // Every word twice: once missing the cache, once hitting it (or bypassing it)
+    size_t mismatches = 0;
+    for (const auto& word : words) {
+      for (int pass = 0; pass < 2; pass++) {
+        if (!sameAsUncached(*strategy, word)) {
+          mismatches++;
+        }
+      }
+    }
+    runner.expectTrue(mismatches == 0, name + " cached positions match findHyphenPositions",
+                      std::to_string(mismatches) + " mismatches");
+    runner.expectTrue(strategy->getHyphenCacheHits() > 0 && strategy->getHyphenCacheEvictions() > 0,
+                      name + " cache hits and evicts");
+
+    // Hits on the most recently used words make no allocation
+    const size_t recent = HyphenationStrategy::HYPHEN_CACHE_SIZE / 2;
+    std::vector<std::string> cachedWords;
+    for (size_t i = words.size() - 3; cachedWords.size() < recent; i--) {
+      if (words[i].size() <= (size_t)HyphenationStrategy::HYPHEN_CACHE_MAX_BYTES) {
+        cachedWords.push_back(words[i]);
+      }
+    }
+    for (const auto& word : cachedWords) {
+      strategy->findHyphenPositionsCached(word.data(), word.size());
+    }
+    strategy->resetHyphenCacheStats();
+    const size_t allocationsBefore = allocationCount.load();
+    for (int r = 0; r < 10; r++) {
+      for (const auto& word : cachedWords) {
+        strategy->findHyphenPositionsCached(word.data(), word.size());
+      }
+    }
+    const bool allocated = allocationCount.load() != allocationsBefore;
+    runner.expectTrue(!allocated, name + " cache hits do not allocate");
+    runner.expectEqual(std::to_string(10 * recent), std::to_string(strategy->getHyphenCacheHits()),
+                       name + " repeated words all hit");
+    runner.expectEqual("0", std::to_string(strategy->getHyphenCacheMisses()), name + " repeated words never miss");
+    delete strategy;
+  }
+
+  // LRU order: fill the cache, touch the oldest word, add one more
+  {
+    HyphenationStrategy* strategy = createHyphenationStrategy(Language::ENGLISH);
+    std::vector<std::string> words;
+    for (int i = 0; i < HyphenationStrategy::HYPHEN_CACHE_SIZE; i++) {
+      words.push_back("word" + std::to_string(i));
+      strategy->findHyphenPositionsCached(words.back().data(), words.back().size());
+    }
+    runner.expectEqual("0", std::to_string(strategy->getHyphenCacheEvictions()), "Cache holds its capacity");
+    runner.expectTrue(isHit(*strategy, words[0]), "Oldest word is still cached");
+    const std::string extra = "overflowing";
+    strategy->findHyphenPositionsCached(extra.data(), extra.size());
+    runner.expectEqual("1", std::to_string(strategy->getHyphenCacheEvictions()), "One more word evicts one");
+    runner.expectTrue(isHit(*strategy, words[0]), "Recently used word survives the eviction");
+    runner.expectTrue(isHit(*strategy, extra), "New word is cached");
+    runner.expectTrue(!isHit(*strategy, words[1]), "Least recently used word was evicted");
+    delete strategy;
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+/**
+ * HyphenationDictionaryTest.cpp - SD Hyphenation Dictionary Test
+ *
+ * Writes dictionary files (as scripts/generate_hyphenation_trie.py does) from
+ * the built-in German and English tries, loads them through
+ * DictionaryHyphenation and checks every test word hyphenates exactly as with
+ * the built-in strategy, with the trie streamed from SD through the block
+ * cache and with it loaded into RAM. Also checks exceptions override the
+ * patterns, the dictionary's minima, language tag lookup and fallback, and
+ * that damaged files are rejected.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "test_utils.h"
+#include "text/hyphenation/DictionaryHyphenation.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+#include "text/hyphenation/Liang/hyph-de.h"
+#include "text/hyphenation/Liang/hyph-en-us.h"
+
+namespace {
+
+const std::string DIR = "test/output/hyphenation_dictionary";
+
+struct Exception {
+  std::string word;  // Lower-case, as in a .hyp.txt file
+  std::vector<uint8_t> positions;
+};
+
+void putU32(std::string& out, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    out += (char)((v >> (8 * i)) & 0xFF);
+  }
+}
+
+std::string buildDictionary(const HyphenationPatterns& patterns, std::vector<Exception> exceptions, uint8_t minWord,
+                            uint8_t minLeft, uint8_t minRight) {
+  std::sort(exceptions.begin(), exceptions.end(),
+            [](const Exception& a, const Exception& b) { return a.word < b.word; });
+  std::string table;
+  for (const Exception& e : exceptions) {
+    table += (char)e.word.size();
+    table += e.word;
+    table += (char)e.positions.size();
+    table.append(e.positions.begin(), e.positions.end());
+  }
+  std::string file = "HYPD";
+  file += (char)1;
+  file += (char)minWord;
+  file += (char)minLeft;
+  file += (char)minRight;
+  putU32(file, (uint32_t)patterns.size);
+  putU32(file, (uint32_t)table.size());
+  file.append((const char*)patterns.trie, patterns.size);
+  return file + table;
+}
+
+void writeFile(const std::string& name, const std::string& content) {
+  std::ofstream out(DIR + "/" + name, std::ios::binary);
+  out.write(content.data(), content.size());
+}
+
+std::vector<std::string> loadWords(const std::string& path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line[0] != '#') {
+      words.push_back(line.substr(0, line.find('|')));
+    }
+  }
+  return words;
+}
+
+std::string join(const std::vector<size_t>& positions) {
+  std::string s;
+  for (size_t p : positions) {
+    s += (s.empty() ? "" : ",") + std::to_string(p);
+  }
+  return s;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation Dictionary Test");
+  std::filesystem::remove_all(DIR);
+  std::filesystem::create_directories(DIR);
+
+  writeFile("de.hyph", buildDictionary(de_patterns, {}, 0, 0, 0));
+  writeFile("en-us.hyph", buildDictionary(en_us_patterns, {{"table", {2}}, {"present", {}}}, 0, 0, 0));
+
+  // Every word as with the built-in strategy
+  struct Case {
+    const char* file;
+    Language builtIn;
+    const char* wordFile;
+    size_t residentMax;
+    const char* name;
+  };
+  const Case cases[] = {
+      {"de.hyph", Language::GERMAN, "test/resources/german_hyphenation_tests.txt",
+       DictionaryHyphenation::RESIDENT_TRIE_MAX, "german streamed"},
+      {"en-us.hyph", Language::ENGLISH, "test/resources/english_hyphenation_tests.txt",
+       DictionaryHyphenation::RESIDENT_TRIE_MAX, "english streamed"},
+      {"en-us.hyph", Language::ENGLISH, "test/resources/english_hyphenation_tests.txt", 64 * 1024,
+       "english in RAM"},
+  };
+  for (const Case& c : cases) {
+    const std::string name = c.name;
+    DictionaryHyphenation* dictionary = DictionaryHyphenation::open((DIR + "/" + c.file).c_str(), c.residentMax);
+    if (!runner.expectTrue(dictionary != nullptr, name + " dictionary loads")) {
+      continue;
+    }
+    HyphenationStrategy* strategy = dictionary;
+    HyphenationStrategy* builtIn = createHyphenationStrategy(c.builtIn);
+    const bool resident = c.residentMax > DictionaryHyphenation::RESIDENT_TRIE_MAX;
+    runner.expectTrue(dictionary->isResident() == resident, name + " trie location");
+
+    const std::vector<std::string> words = loadWords(c.wordFile);
+    size_t mismatches = 0;
+    for (const auto& word : words) {
+      if (word == "table" || word == "present") {
+        continue;
+      }
+      if (strategy->findHyphenPositions(word) != builtIn->findHyphenPositions(word)) {
+        if (mismatches++ < 5) {
+          std::cout << "  mismatch: " << word << std::endl;
+        }
+      }
+    }
+    runner.expectTrue(words.size() > 100 && mismatches == 0, name + " matches the built-in patterns",
+                      std::to_string(mismatches) + " mismatches");
+    if (!resident) {
+      std::cout << "  " << name << ": " << words.size() << " words, " << dictionary->getBlockReads()
+                << " block reads" << std::endl;
+      runner.expectTrue(dictionary->getBlockReads() > 0, name + " reads trie blocks on demand");
+    }
+    delete strategy;
+    delete builtIn;
+  }
+
+  // Rules ids (part of the page index key): the same wherever the trie is
+  // held, different for other or updated dictionaries
+  {
+    writeFile("updated.hyph", buildDictionary(en_us_patterns, {{"table", {2}}}, 0, 0, 0));
+    DictionaryHyphenation* streamed = DictionaryHyphenation::open((DIR + "/en-us.hyph").c_str());
+    DictionaryHyphenation* resident = DictionaryHyphenation::open((DIR + "/en-us.hyph").c_str(), 64 * 1024);
+    DictionaryHyphenation* german = DictionaryHyphenation::open((DIR + "/de.hyph").c_str());
+    DictionaryHyphenation* updated = DictionaryHyphenation::open((DIR + "/updated.hyph").c_str());
+    if (runner.expectTrue(streamed && resident && german && updated, "Dictionaries for rules ids load")) {
+      runner.expectTrue(streamed->getRulesId() == resident->getRulesId(),
+                        "Rules id does not depend on the trie location");
+      runner.expectTrue(streamed->getRulesId() != german->getRulesId(), "Other dictionaries have other rules ids");
+      runner.expectTrue(streamed->getRulesId() != updated->getRulesId(), "Changed exceptions change the rules id");
+      HyphenationStrategy* builtIn = createHyphenationStrategy(Language::ENGLISH);
+      runner.expectTrue(builtIn->getRulesId() == 0 && streamed->getRulesId() != 0,
+                        "Built-in patterns have rules id 0");
+      delete builtIn;
+    }
+    delete streamed;
+    delete resident;
+    delete german;
+    delete updated;
+  }
+
+  // Exceptions replace the patterns (tags are matched case-insensitively, '_' as '-')
+  {
+    HyphenationStrategy* strategy = createHyphenationStrategyForTag("EN_us", Language::NONE, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::DICTIONARY, "Tag finds its dictionary");
+    HyphenationStrategy* builtIn = createHyphenationStrategy(Language::ENGLISH);
+    runner.expectEqual("2", join(strategy->hyphenate("table", 1, 1, 1)), "Exception positions");
+    runner.expectEqual("2", join(strategy->hyphenate("Table", 1, 1, 1)), "Exceptions match capitalized words");
+    runner.expectEqual("", join(strategy->hyphenate("present", 1, 1, 1)), "Exception with no positions");
+    runner.expectEqual("", join(strategy->hyphenate("table", 1, 3, 1)), "Exceptions respect the minima");
+    runner.expectEqual(join(builtIn->hyphenate("presentation", 1, 1, 1)),
+                       join(strategy->hyphenate("presentation", 1, 1, 1)), "Other words use the patterns");
+    delete strategy;
+    delete builtIn;
+  }
+
+  // The dictionary's own minima are applied
+  {
+    writeFile("xx.hyph", buildDictionary(en_us_patterns, {}, 12, 4, 4));
+    HyphenationStrategy* strategy = createHyphenationStrategyForTag("xx", Language::NONE, DIR.c_str());
+    runner.expectEqual("", join(strategy->hyphenate("hyphenation", 1, 1, 1)), "Dictionary minimum word length");
+    for (size_t p : strategy->hyphenate("hyphenations", 1, 1, 1)) {
+      runner.expectTrue(p >= 4 && p <= 8, "Dictionary fragment minima", std::to_string(p));
+    }
+    delete strategy;
+  }
+
+  // Tag fallback
+  {
+    HyphenationStrategy* strategy = createHyphenationStrategyForTag("de-AT-1996", Language::NONE, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::DICTIONARY, "Region falls back to the primary language");
+    delete strategy;
+    strategy = createHyphenationStrategyForTag("en", Language::NONE, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::NONE, "Primary language does not match a regional file");
+    delete strategy;
+    strategy = createHyphenationStrategyForTag("fr", Language::GERMAN, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::GERMAN, "Missing dictionary uses the built-in strategy");
+    delete strategy;
+    strategy = createHyphenationStrategyForTag("../de", Language::BASIC, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::BASIC, "Tags with path characters are not looked up");
+    delete strategy;
+    strategy = createHyphenationStrategyForTag("", Language::ENGLISH, DIR.c_str());
+    runner.expectTrue(strategy->getLanguage() == Language::ENGLISH, "Empty tag uses the built-in strategy");
+    delete strategy;
+  }
+
+  // Damaged files
+  {
+    const std::string good = buildDictionary(en_us_patterns, {{"table", {2}}}, 0, 0, 0);
+    struct Damaged {
+      const char* file;
+      std::string content;
+      const char* name;
+    };
+    std::string badMagic = good;
+    badMagic[0] = 'X';
+    std::string badVersion = good;
+    badVersion[4] = 2;
+    std::string badTrie = good;
+    badTrie[DictionaryHyphenation::HEADER_SIZE + 3] = 9;
+    std::string badException = good;
+    badException[badException.size() - 2] = 20;  // Position count runs past the end
+    const Damaged damaged[] = {
+        {"d1.hyph", good.substr(0, good.size() - 1), "Truncated file"},
+        {"d2.hyph", badMagic, "Wrong magic"},
+        {"d3.hyph", badVersion, "Unknown version"},
+        {"d4.hyph", badTrie, "Unknown trie version"},
+        {"d5.hyph", badException, "Damaged exceptions"},
+        {"d6.hyph", good.substr(0, 10), "Short header"},
+    };
+    for (const Damaged& d : damaged) {
+      writeFile(d.file, d.content);
+      DictionaryHyphenation* dictionary = DictionaryHyphenation::open((DIR + "/" + d.file).c_str());
+      runner.expectTrue(dictionary == nullptr, std::string(d.name) + " is rejected");
+      delete dictionary;
+    }
+  }
+
+  std::filesystem::remove_all(DIR);
+  return runner.allPassed() ? 0 : 1;
+}
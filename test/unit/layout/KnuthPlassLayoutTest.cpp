@@ -0,0 +1,397 @@
+/**
+ * KnuthPlassLayoutTest.cpp - Knuth-Plass Paragraph Layout Test
+ *
+ * Lays out German text (short function words mixed with words from the
+ * hyphenation test list, in paragraphs of varied length, one long enough to
+ * be broken in chunks, plus an empty paragraph, a compound with hyphens and a
+ * word wider than a line) page by page with the Knuth-Plass strategy. Checks
+ * the pages hold the whole text once, lines stay within the margins,
+ * hyphenation points are used, backward navigation finds the page that ends
+ * at each page start (also for pages starting on any line), and that only
+ * pages starting off a line break report a mismatch, that paging forward
+ * breaks each chunk and hyphenates each word only once, and that a provider
+ * replaced at the same address is not laid out from the kept chunk. Laying
+ * a page out again into the same PageLayout must not allocate when it
+ * continues the last broken chunk, or when its words are short and their
+ * hyphenation cached.
+ * Prints page fill against the greedy strategy.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "content/providers/StringWordProvider.h"
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+#include "text/layout/GreedyLayoutStrategy.h"
+#include "text/layout/KnuthPlassLayoutStrategy.h"
+
+// Count heap allocations so the test can check steady state layout makes none
+static std::atomic<size_t> allocationCount(0);
+
+void* operator new(size_t size) {
+  allocationCount++;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+std::vector<std::string> loadWords(const std::string& path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line[0] != '#') {
+      words.push_back(line.substr(0, line.find('|')));
+    }
+  }
+  return words;
+}
+
+// Mostly short function words, as in prose, with the (long) test words between them
+const char* const SHORT_WORDS[] = {"der", "die", "und", "in",  "zu",  "den", "das", "nicht", "von", "sie",
+                                   "ist", "des", "sich", "mit", "dem", "dass", "er", "es",   "ein", "ich",
+                                   "auf", "so",  "eine", "auch", "als", "an",  "nach", "wie", "im",  "für"};
+
+std::string buildText(const std::vector<std::string>& words) {
+  uint32_t seed = 12345;
+  auto next = [&seed](uint32_t n) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) % n;
+  };
+  std::string text;
+  size_t w = 0;
+  for (int paragraph = 0; paragraph < 40; paragraph++) {
+    const size_t count = paragraph == 7 ? 320 : 3 + next(150);
+    for (size_t i = 0; i < count; i++) {
+      text += (i ? " " : "");
+      text += next(4) == 0 ? words[w++ % words.size()] : SHORT_WORDS[next(30)];
+      if (paragraph == 3 && i == 10) {
+        text += " Telefon-Hotline-Nummer";
+      }
+      if (paragraph == 5 && i == 2) {
+        text += " Donaudampfschifffahrtsgesellschaftskapitaenswitwenrentenversicherung";
+      }
+    }
+    text += paragraph == 12 ? "\n\n" : "\n";
+  }
+  return text;
+}
+
+// Letters of the text (no spaces, line ends or hyphens, which layout may add)
+std::string letters(const std::string& text) {
+  std::string out;
+  for (char c : text) {
+    if (c != ' ' && c != '\n' && c != '-') {
+      out += c;
+    }
+  }
+  return out;
+}
+
+size_t countWords(const std::string& text) {
+  size_t count = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] != ' ' && text[i] != '\n' && (i == 0 || text[i - 1] == ' ' || text[i - 1] == '\n')) {
+      count++;
+    }
+  }
+  return count;
+}
+
+LayoutStrategy::LayoutConfig makeConfig() {
+  LayoutStrategy::LayoutConfig config;
+  config.marginLeft = TestConfig::DEFAULT_MARGIN_LEFT;
+  config.marginRight = TestConfig::DEFAULT_MARGIN_RIGHT;
+  config.marginTop = TestConfig::DEFAULT_MARGIN_TOP;
+  config.marginBottom = TestConfig::DEFAULT_MARGIN_BOTTOM;
+  config.lineHeight = TestConfig::DEFAULT_LINE_HEIGHT;
+  config.paragraphSpacing = 8;
+  config.minSpaceWidth = TestConfig::DEFAULT_MIN_SPACE_WIDTH;
+  config.pageWidth = TestConfig::DISPLAY_WIDTH;
+  config.pageHeight = TestConfig::DISPLAY_HEIGHT;
+  config.alignment = LayoutStrategy::ALIGN_LEFT;
+  config.language = Language::GERMAN;
+  return config;
+}
+
+struct Pages {
+  std::vector<int> starts;
+  size_t lines = 0;
+  size_t hyphenated = 0;
+  std::string letters;
+};
+
+Pages layoutAll(LayoutStrategy& layout, StringWordProvider& provider, TextRenderer& renderer,
+                const LayoutStrategy::LayoutConfig& config) {
+  Pages pages;
+  int start = 0;
+  while (pages.starts.size() < 1000) {
+    provider.setPosition(start);
+    if (!provider.hasNextWord()) {
+      break;
+    }
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    pages.starts.push_back(start);
+    for (const auto& line : page.lines) {
+      const LayoutStrategy::PageWord* words = page.lineWords(line);
+      pages.lines++;
+      if (line.wordCount > 0 && words[line.wordCount - 1].wasSplit) {
+        pages.hyphenated++;
+      }
+      for (uint16_t i = 0; i < line.wordCount; i++) {
+        pages.letters += letters(page.wordText(words[i]));
+      }
+    }
+    if (page.endPosition <= start) {
+      break;
+    }
+    start = page.endPosition;
+  }
+  return pages;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Knuth-Plass Layout Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+  renderer.setFrameBuffer(display.getFrameBuffer());
+
+  const std::vector<std::string> words = loadWords("test/resources/german_hyphenation_tests.txt");
+  if (!runner.expectTrue(words.size() > 1000, "Word list loads")) {
+    return 1;
+  }
+  const std::string text = buildText(words);
+  StringWordProvider provider(String(text.c_str()));
+  const LayoutStrategy::LayoutConfig config = makeConfig();
+  const int16_t right = config.pageWidth - config.marginRight;
+
+  KnuthPlassLayoutStrategy layout;
+  layout.setLanguage(config.language);
+
+  // Forward through the text: every page continues the chunk the page before
+  // ended in, so each chunk is broken (and its words hyphenated) only once
+  HyphenationStrategy* hyphenation = const_cast<HyphenationStrategy*>(layout.getHyphenationStrategy());
+  hyphenation->resetHyphenCacheStats();
+  const uint32_t breaksBefore = layout.getChunkBreakCount();
+  Pages pages = layoutAll(layout, provider, renderer, config);
+  runner.expectTrue(pages.starts.size() > 10, "Text fills several pages", std::to_string(pages.starts.size()));
+  runner.expectTrue(pages.letters == letters(text), "Pages hold the whole text once");
+  const uint32_t chunkBreaks = layout.getChunkBreakCount() - breaksBefore;
+  const uint32_t lookups = hyphenation->getHyphenCacheHits() + hyphenation->getHyphenCacheMisses();
+  std::cout << "  " << chunkBreaks << " chunks broken, " << lookups << " hyphenation lookups for "
+            << countWords(text) << " words" << std::endl;
+  // 41 paragraphs (one of them empty), the long one in up to three chunks
+  runner.expectTrue(chunkBreaks <= 41 + 2, "Pages continue the last broken chunk", std::to_string(chunkBreaks));
+  runner.expectTrue(lookups <= countWords(text), "Each word is hyphenated once", std::to_string(lookups));
+
+  size_t hyphenated = 0;
+  size_t overflowing = 0;
+  size_t mismatches = 0;
+  for (size_t p = 0; p < pages.starts.size(); p++) {
+    provider.setPosition(pages.starts[p]);
+    layout.resetLineCountMismatch();
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    mismatches += layout.hasLineCountMismatch() ? 1 : 0;
+    for (const auto& line : page.lines) {
+      if (line.wordCount == 0) {
+        continue;
+      }
+      const auto& last = page.lineWords(line)[line.wordCount - 1];
+      if (last.wasSplit) {
+        hyphenated++;
+      }
+      // Only a word wider than the line may overflow it
+      if (last.x + last.width > right && line.wordCount > 1) {
+        overflowing++;
+      }
+    }
+  }
+  runner.expectTrue(overflowing == 0, "Lines stay within the margins", std::to_string(overflowing) + " lines");
+  runner.expectTrue(hyphenated > 0, "Hyphenation points are used");
+  runner.expectTrue(mismatches == 0, "Page starts are line breaks");
+
+  // Backward navigation: the previous page ends exactly where the page starts.
+  // With paragraph spacing two starts can end a page at the same place (one
+  // leaves room it can't use), so only its end is checked; without spacing
+  // the start itself must match.
+  auto pageEnd = [&](const LayoutStrategy::LayoutConfig& c, int start) {
+    provider.setPosition(start);
+    return layout.layoutText(provider, renderer, c).endPosition;
+  };
+  size_t wrong = 0;
+  size_t exact = 0;
+  for (size_t p = 1; p < pages.starts.size(); p++) {
+    const int previous = layout.getPreviousPageStart(provider, renderer, config, pages.starts[p]);
+    exact += previous == pages.starts[p - 1] ? 1 : 0;
+    if (pageEnd(config, previous) != pages.starts[p] && wrong++ < 5) {
+      std::cout << "  page " << p << ": previous start " << previous << " does not end at " << pages.starts[p]
+                << std::endl;
+    }
+  }
+  runner.expectTrue(wrong == 0, "Previous pages end at the page start", std::to_string(wrong) + " wrong");
+  std::cout << "  " << exact << " of " << pages.starts.size() - 1 << " previous page starts exact" << std::endl;
+
+  LayoutStrategy::LayoutConfig unspaced = config;
+  unspaced.paragraphSpacing = 0;
+  Pages unspacedPages = layoutAll(layout, provider, renderer, unspaced);
+  wrong = 0;
+  for (size_t p = 1; p < unspacedPages.starts.size(); p++) {
+    if (layout.getPreviousPageStart(provider, renderer, unspaced, unspacedPages.starts[p]) !=
+        unspacedPages.starts[p - 1]) {
+      wrong++;
+    }
+  }
+  runner.expectTrue(wrong == 0, "Previous page starts match without paragraph spacing",
+                    std::to_string(wrong) + " wrong");
+
+  // Pages starting on any line (as after incremental paging): in sync with
+  // the paragraph breaks, and once a page fits before them it ends there
+  // (without paragraph spacing, so every line can end a page)
+  {
+    int start = 0;
+    size_t lines = 0;
+    size_t inconsistent = 0;
+    while (lines < 180) {
+      provider.setPosition(start);
+      if (!provider.hasNextWord()) {
+        break;
+      }
+      layout.resetLineCountMismatch();
+      provider.setPosition(start);
+      layout.layoutText(provider, renderer, unspaced);
+      if (layout.hasLineCountMismatch()) {
+        inconsistent++;
+      } else if (lines >= 30 &&
+                 pageEnd(unspaced, layout.getPreviousPageStart(provider, renderer, unspaced, start)) != start) {
+        inconsistent++;
+      }
+      provider.setPosition(start);
+      bool paragraphEnd = false;
+      layout.test_getNextLayoutLine(provider, renderer, unspaced, paragraphEnd);
+      if (provider.getCurrentIndex() <= start) {
+        break;
+      }
+      start = provider.getCurrentIndex();
+      lines++;
+    }
+    runner.expectTrue(lines == 180 && inconsistent == 0, "Pages from every line are consistent",
+                      std::to_string(inconsistent) + " of " + std::to_string(lines));
+  }
+
+  // A page starting inside a line is broken from there and reported
+  {
+    provider.setPosition(pages.starts[1] + 3);
+    layout.resetLineCountMismatch();
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    runner.expectTrue(layout.hasLineCountMismatch() && !page.lines.empty(), "Start off a line break is reported");
+  }
+
+  // Another document in a provider at the old one's address: invalidateCaches()
+  // keeps the kept chunk from being taken for the new text
+  {
+    alignas(StringWordProvider) unsigned char storage[sizeof(StringWordProvider)];
+    const String first("Erstes Dokument mit ein paar Worten");
+    const String second("Zweites Buch hat andere Worte");
+    KnuthPlassLayoutStrategy swapLayout;
+    swapLayout.setLanguage(config.language);
+    StringWordProvider* document = new (storage) StringWordProvider(first);
+    LayoutStrategy::PageLayout page = swapLayout.layoutText(*document, renderer, config);
+    document->~StringWordProvider();
+    document = new (storage) StringWordProvider(second);
+    swapLayout.invalidateCaches();
+    page = swapLayout.layoutText(*document, renderer, config);
+    runner.expectTrue(!page.words.empty() && std::string(page.wordText(page.words[0])) == "Zweites",
+                      "A replaced provider is laid out from its own text");
+    document->~StringWordProvider();
+  }
+
+  // Steady state: a page laid out again into the same PageLayout reuses its
+  // buffers. A page continuing the last broken chunk makes no allocation at
+  // all; breaking a chunk again allocates only for provider words too long
+  // for String's inline storage and hyphenation cache misses, so a text of
+  // short words (all in the cache) is laid out without allocating either.
+  {
+    // Paragraphs longer than a page, so some pages lie within one chunk
+    std::string longText;
+    for (size_t i = 0; i < 2400; i++) {
+      longText += (i % 3 == 0) ? words[(i * 13) % words.size()] : SHORT_WORDS[(i * 7) % 30];
+      longText += (i % 800 == 799) ? "\n" : " ";
+    }
+    StringWordProvider longProvider(String(longText.c_str()));
+    const Pages longPages = layoutAll(layout, longProvider, renderer, config);
+    LayoutStrategy::PageLayout page;
+    size_t continued = 0;
+    size_t allocating = 0;
+    for (size_t p = 0; p < longPages.starts.size(); p++) {
+      longProvider.setPosition(longPages.starts[p]);
+      layout.layoutPage(longProvider, renderer, config, page);
+      const uint32_t breaksBefore = layout.getChunkBreakCount();
+      const size_t allocationsBefore = allocationCount.load();
+      longProvider.setPosition(longPages.starts[p]);
+      layout.layoutPage(longProvider, renderer, config, page);
+      if (layout.getChunkBreakCount() == breaksBefore) {
+        continued++;
+        allocating += allocationCount.load() > allocationsBefore ? 1 : 0;
+      }
+    }
+    runner.expectTrue(continued > 0 && allocating == 0, "Relayout from the last chunk does not allocate",
+                      std::to_string(allocating) + " of " + std::to_string(continued) + " pages allocate");
+
+    std::string shortText;
+    for (int i = 0; i < 600; i++) {
+      shortText += SHORT_WORDS[(i * 7) % 30];
+      shortText += (i % 80 == 79) ? "\n" : " ";
+    }
+    StringWordProvider shortProvider(String(shortText.c_str()));
+    for (int pass = 0; pass < 2; pass++) {
+      shortProvider.setPosition(0);
+      layout.layoutPage(shortProvider, renderer, config, page);
+    }
+    const uint32_t breaksBefore = layout.getChunkBreakCount();
+    const size_t allocationsBefore = allocationCount.load();
+    shortProvider.setPosition(0);
+    layout.layoutPage(shortProvider, renderer, config, page);
+    const size_t allocations = allocationCount.load() - allocationsBefore;
+    runner.expectTrue(layout.getChunkBreakCount() > breaksBefore && allocations == 0 && !page.lines.empty(),
+                      "Breaking short words again does not allocate", std::to_string(allocations) + " allocations");
+  }
+
+  // Page fill against the greedy strategy
+  GreedyLayoutStrategy greedy;
+  greedy.setLanguage(config.language);
+  Pages greedyPages = layoutAll(greedy, provider, renderer, config);
+  std::cout << "  Knuth-Plass: " << pages.starts.size() << " pages, " << pages.lines << " lines, " << hyphenated
+            << " hyphenated" << std::endl;
+  std::cout << "  Greedy:      " << greedyPages.starts.size() << " pages, " << greedyPages.lines << " lines, "
+            << greedyPages.hyphenated << " hyphenated" << std::endl;
+
+  renderer.setFrameBuffer(nullptr);
+  return runner.allPassed() ? 0 : 1;
+}
@@ -180,11 +180,10 @@ void runTestConfiguration(const PageTestConfig& testConfig, TestUtils::TestRunne
     }
 
     if (testConfig.incrementalMode) {
-      // Move one word forward from the start of the current page
+      // Move one line forward (as the strategy breaks lines) from the start of the current page
       provider.setPosition(pageStart);
       bool dummy;
-      layout.test_getNextLineDefault(
-          provider, renderer, layoutConfig.pageWidth - layoutConfig.marginLeft - layoutConfig.marginRight, dummy);
+      layout.test_getNextLayoutLine(provider, renderer, layoutConfig, dummy);
       int nextPos = provider.getCurrentIndex();
 
       // If we can't move forward, we're done
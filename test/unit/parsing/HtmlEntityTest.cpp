@@ -0,0 +1,106 @@
+/**
+ * HtmlEntityTest.cpp - HTML Character Reference Decoding Test
+ *
+ * Looks up every name in the generated perfect-hash table through
+ * decodeHtmlEntity() and checks it finds its own record, then spot-checks
+ * named values (UTF-8, multi-codepoint, ASCII folds), near-miss names, and
+ * decimal/hex numeric references including trimming, controls and invalid
+ * codepoints.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "content/xml/HtmlEntities.h"
+#include "content/xml/HtmlEntityTable.h"
+#include "test_utils.h"
+
+namespace {
+
+// Decoded text, or "<raw>" if the reference is not decoded
+std::string decode(const std::string& entity) {
+  char scratch[HTML_ENTITY_SCRATCH_SIZE];
+  size_t length = 0;
+  const char* decoded = decodeHtmlEntity(entity.data(), entity.size(), scratch, length);
+  return decoded ? std::string(decoded, length) : "<raw>";
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Html Entity Test");
+
+  // Every table name resolves to its own record
+  size_t names = 0;
+  size_t found = 0;
+  for (size_t i = 0; i < HTML_ENTITY_SLOTS; i++) {
+    const HtmlEntityRecord& record = HTML_ENTITY_RECORDS[i];
+    if (record.nameLength == 0) {
+      continue;
+    }
+    names++;
+    const std::string entity = "&" + std::string(HTML_ENTITY_NAMES + record.name, record.nameLength) + ";";
+    char scratch[HTML_ENTITY_SCRATCH_SIZE];
+    size_t length = 0;
+    const char* decoded = decodeHtmlEntity(entity.data(), entity.size(), scratch, length);
+    if (decoded && length == record.valueLength && memcmp(decoded, HTML_ENTITY_VALUES + record.value, length) == 0) {
+      found++;
+    }
+  }
+  runner.expectEqual("2125", std::to_string(names), "Table holds the HTML5 ';' names");
+  runner.expectEqual(std::to_string(names), std::to_string(found), "Every name finds its own record");
+
+  // Named values
+  runner.expectEqual("&", decode("&amp;"), "&amp;");
+  runner.expectEqual("<", decode("&lt;"), "&lt;");
+  runner.expectEqual("\xC2\xA0", decode("&nbsp;"), "&nbsp; stays a UTF-8 nbsp");
+  runner.expectEqual("\xC3\xA9", decode("&eacute;"), "&eacute; is UTF-8");
+  runner.expectEqual("\xC3\x89", decode("&Eacute;"), "Names are case-sensitive");
+  runner.expectEqual("\xE2\x82\xAC", decode("&euro;"), "&euro; is UTF-8");
+  runner.expectEqual("\xE2\x89\x82\xCC\xB8", decode("&NotEqualTilde;"), "Two-codepoint value");
+  runner.expectEqual("\xE2\x88\xB3", decode("&CounterClockwiseContourIntegral;"), "Longest name");
+  runner.expectEqual("-", decode("&mdash;"), "&mdash; folds to '-'");
+  runner.expectEqual("'", decode("&rsquo;"), "&rsquo; folds to '\\''");
+  runner.expectEqual("\"", decode("&laquo;"), "&laquo; folds to '\"'");
+  runner.expectEqual("...", decode("&hellip;"), "&hellip; folds to '...'");
+  runner.expectEqual(" ", decode("&thinsp;"), "&thinsp; folds to a space");
+  runner.expectEqual("", decode("&shy;"), "&shy; decodes to nothing");
+  runner.expectEqual("(c)", decode("&copy;"), "&copy; folds to (c)");
+  runner.expectEqual("(tm)", decode("&trade;"), "&trade; folds to (tm)");
+
+  // Not references
+  runner.expectEqual("<raw>", decode("&bogus;"), "Unknown name");
+  runner.expectEqual("<raw>", decode("&AMP;x"), "Text after ';'");
+  runner.expectEqual("<raw>", decode("&amp"), "Missing ';'");
+  runner.expectEqual("<raw>", decode("&ampx;"), "Name with a known prefix");
+  runner.expectEqual("<raw>", decode("&am;"), "Prefix of a name");
+  runner.expectEqual("<raw>", decode("&;"), "Empty name");
+  runner.expectEqual("<raw>", decode("&CounterClockwiseContourIntegralX;"), "Name longer than any in the table");
+
+  // Numeric references
+  runner.expectEqual("A", decode("&#65;"), "Decimal ASCII");
+  runner.expectEqual("A", decode("&#x41;"), "Hex ASCII");
+  runner.expectEqual("A", decode("&# 65 ;"), "Digits are trimmed");
+  runner.expectEqual("\xC3\xA9", decode("&#233;"), "Decimal 2-byte UTF-8");
+  runner.expectEqual("\xC3\xA9", decode("&#XE9;"), "Upper-case X");
+  runner.expectEqual("\xE2\x82\xAC", decode("&#x20AC;"), "3-byte UTF-8");
+  runner.expectEqual("\xF0\x9F\x98\x80", decode("&#x1F600;"), "4-byte UTF-8");
+  runner.expectEqual("\xC2\xA0", decode("&#160;"), "Numeric nbsp");
+  runner.expectEqual("\n", decode("&#10;"), "Line feed is kept");
+  runner.expectEqual("", decode("&#13;"), "Carriage return is dropped");
+  runner.expectEqual("", decode("&#27;"), "Control characters are dropped");
+  runner.expectEqual("", decode("&#x85;"), "C1 controls are dropped");
+  runner.expectEqual("...", decode("&#8230;"), "Numeric references get the same folds");
+  runner.expectEqual("-", decode("&#x2014;"), "Numeric em dash folds");
+  runner.expectEqual("", decode("&#xFEFF;"), "Byte order mark is dropped");
+  runner.expectEqual("<raw>", decode("&#;"), "No digits");
+  runner.expectEqual("<raw>", decode("&#x;"), "No hex digits");
+  runner.expectEqual("<raw>", decode("&#12a;"), "Hex digit in a decimal reference");
+  runner.expectEqual("<raw>", decode("&#0;"), "NUL");
+  runner.expectEqual("<raw>", decode("&#xD800;"), "Surrogate");
+  runner.expectEqual("<raw>", decode("&#x110000;"), "Beyond U+10FFFF");
+  runner.expectEqual("<raw>", decode("&#99999999999999999999;"), "Overflowing digits");
+
+  return runner.allPassed() ? 0 : 1;
+}
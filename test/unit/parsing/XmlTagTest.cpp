@@ -0,0 +1,93 @@
+/**
+ * XmlTagTest.cpp - Interned Tag and Attribute View Test
+ *
+ * Checks the perfect-hash tag table (every known name maps to its ID and back,
+ * anything else is Unknown), that SimpleXmlParser reports tag IDs for start
+ * and end elements, and that findAttribute() returns views with the right
+ * length into the parser's buffer that stay valid until the next node.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "content/xml/SimpleXmlParser.h"
+#include "content/xml/XmlTags.h"
+#include "test_utils.h"
+
+int main() {
+  TestUtils::TestRunner runner("Xml Tag Test");
+
+  // Every tag round-trips through its name
+  bool roundTrip = true;
+  for (uint8_t id = 1; id < (uint8_t)XmlTag::Count; ++id) {
+    const char* name = xmlTagName((XmlTag)id);
+    if (lookupXmlTag(name, strlen(name)) != (XmlTag)id) {
+      std::cout << "  " << name << " does not map to " << (int)id << "\n";
+      roundTrip = false;
+    }
+  }
+  runner.expectTrue(roundTrip, "Every tag name maps to its ID");
+  runner.expectEqual("", xmlTagName(XmlTag::Unknown), "Unknown has no name");
+
+  // Near misses, prefixes, other case and longer names are not interned
+  const char* misses[] = {"", "a", "pp", "h7", "h", "bold", "spa", "spans", "P", "DIV", "table", "blockquotes",
+                          "img", "sup", "headers", "svg", "body", "html", "ul", "td"};
+  bool allUnknown = true;
+  for (const char* name : misses) {
+    if (lookupXmlTag(name, strlen(name)) != XmlTag::Unknown) {
+      std::cout << "  '" << name << "' was interned\n";
+      allUnknown = false;
+    }
+  }
+  runner.expectTrue(allUnknown, "Unknown names map to Unknown");
+  runner.expectTrue(lookupXmlTag("divx", 3) == XmlTag::Div, "Lookup uses the given length, not a terminator");
+
+  // Tag sets
+  const uint32_t set = xmlTagBit(XmlTag::Head) | xmlTagBit(XmlTag::Script);
+  runner.expectTrue((set & xmlTagBit(XmlTag::Script)) != 0 && (set & xmlTagBit(XmlTag::Style)) == 0 &&
+                        xmlTagBit(XmlTag::Unknown) == 0,
+                    "Tag bits form sets");
+
+  // Parser: tag IDs on start/end elements, names still available, attribute views
+  const std::string xml =
+      "<?xml version=\"1.0\"?><html><body><p class=\"lead first\" style='text-align: center'>Hi<br/></p>"
+      "<svg:rect width=\"10\"/><H1 ID=\"x\" empty=\"\">T</H1></body></html>";
+  SimpleXmlParser parser;
+  runner.expectTrue(parser.openFromMemory(xml.data(), xml.size()), "Parser opens from memory");
+  std::string tags;
+  bool viewsOk = true;
+  while (parser.read()) {
+    const SimpleXmlParser::NodeType type = parser.getNodeType();
+    if (type != SimpleXmlParser::Element && type != SimpleXmlParser::EndElement) {
+      continue;
+    }
+    tags += std::string(type == SimpleXmlParser::EndElement ? "/" : "") + parser.getName().c_str() + "=" +
+            std::to_string((int)parser.getTag()) + " ";
+    if (type != SimpleXmlParser::Element) {
+      continue;
+    }
+    if (parser.getTag() == XmlTag::P) {
+      size_t len = 0;
+      const char* cls = parser.findAttribute("class", &len);
+      viewsOk = viewsOk && cls && len == 10 && std::string(cls, len) == "lead first" && cls[len] == '\0';
+      const char* style = parser.findAttribute("style", &len);
+      viewsOk = viewsOk && style && std::string(style, len) == "text-align: center";
+      viewsOk = viewsOk && parser.findAttribute("id") == nullptr && parser.getAttribute("class") == "lead first";
+    } else if (parser.getName() == "H1") {
+      size_t len = 99;
+      const char* id = parser.findAttribute("id", &len);
+      viewsOk = viewsOk && id && std::string(id, len) == "x";
+      const char* empty = parser.findAttribute("empty", &len);
+      viewsOk = viewsOk && empty && len == 0;
+    } else if (parser.getName() == "svg:rect") {
+      viewsOk = viewsOk && parser.isEmptyElement() && parser.getAttribute("width") == "10";
+    }
+  }
+  parser.close();
+  runner.expectEqual("html=0 body=0 p=1 br=25 /p=1 svg:rect=0 H1=0 /H1=0 /body=0 /html=0 ", tags,
+                     "Start and end elements carry tag IDs");
+  runner.expectTrue(viewsOk, "Attribute views have the right value and length");
+
+  return runner.allPassed() ? 0 : 1;
+}
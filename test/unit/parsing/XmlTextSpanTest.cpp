@@ -0,0 +1,175 @@
+/**
+ * XmlTextSpanTest.cpp - Bulk Text Span Test
+ *
+ * Reads long text nodes (many parser buffers each) with readTextSpan() from
+ * memory, from a file and from a stream, and checks the spans join up to
+ * exactly what the char-by-char API returns. Then converts a stored and a
+ * deflated chapter whose text puts entities, CR/LF, tabs and nbsp across
+ * span boundaries and checks the one-pass decoder's output.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "content/providers/EpubWordProvider.h"
+#include "content/xml/SimpleXmlParser.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+struct MemoryStream {
+  const std::string* data;
+  size_t pos;
+};
+
+int readStream(char* buffer, size_t maxSize, void* userData) {
+  MemoryStream* s = (MemoryStream*)userData;
+  // Odd chunk sizes so stream buffers and text nodes never line up
+  size_t n = std::min(maxSize, (size_t)1237);
+  n = std::min(n, s->data->size() - s->pos);
+  memcpy(buffer, s->data->data() + s->pos, n);
+  s->pos += n;
+  return (int)n;
+}
+
+// Text of every text node, read either in spans or a char at a time
+std::string readTexts(SimpleXmlParser& parser, bool spans, size_t* spanCount = nullptr) {
+  std::string out;
+  while (parser.read()) {
+    if (parser.getNodeType() != SimpleXmlParser::Text) {
+      continue;
+    }
+    if (spans) {
+      size_t length = 0;
+      while (const char* span = parser.readTextSpan(length)) {
+        out.append(span, length);
+        if (spanCount) {
+          ++*spanCount;
+        }
+      }
+    } else {
+      while (parser.hasMoreTextChars()) {
+        out += parser.readTextNodeCharForward();
+      }
+    }
+    out += "|";
+  }
+  return out;
+}
+
+std::string repeat(const std::string& s, int n) {
+  std::string out;
+  for (int i = 0; i < n; ++i) {
+    out += s;
+  }
+  return out;
+}
+
+std::string readFile(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Xml Text Span Test");
+
+  std::string xml = "<?xml version=\"1.0\"?><html><body>";
+  for (int i = 0; i < 6; ++i) {
+    xml += "<p>" + repeat("Text node " + std::to_string(i) + " &amp; more words\r\n\t", 400 + i * 97) + "</p>";
+    xml += "<p>short</p>  \n  <p>x<b>y</b>z</p>";
+  }
+  xml += "</body></html>";
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string xmlPath = TestConfig::TEST_OUTPUT_DIR + "/text_span_test.xhtml";
+  {
+    std::ofstream f(xmlPath, std::ios::binary);
+    f << xml;
+  }
+
+  SimpleXmlParser parser;
+  parser.openFromMemory(xml.data(), xml.size());
+  const std::string expected = readTexts(parser, false);
+  parser.close();
+
+  parser.openFromMemory(xml.data(), xml.size());
+  size_t memorySpans = 0;
+  runner.expectTrue(readTexts(parser, true, &memorySpans) == expected, "Memory spans match char-by-char reading");
+  parser.close();
+  runner.expectTrue(memorySpans == 30, "Memory mode returns each text node as one span",
+                    std::to_string(memorySpans));
+
+  parser.open(xmlPath.c_str());
+  size_t fileSpans = 0;
+  runner.expectTrue(readTexts(parser, true, &fileSpans) == expected, "File spans match char-by-char reading");
+  parser.close();
+  runner.expectTrue(fileSpans > 30, "File mode splits long nodes at buffer boundaries", std::to_string(fileSpans));
+
+  MemoryStream stream = {&xml, 0};
+  parser.openFromStream(readStream, &stream);
+  runner.expectTrue(readTexts(parser, true) == expected, "Stream spans match char-by-char reading");
+  parser.close();
+
+  // Spans and single chars can be mixed; the position follows both
+  parser.openFromMemory(xml.data(), xml.size());
+  while (parser.read() && parser.getNodeType() != SimpleXmlParser::Text) {
+  }
+  const char first = parser.readTextNodeCharForward();
+  size_t length = 0;
+  const char* span = parser.readTextSpan(length);
+  runner.expectTrue(first == 'T' && span && std::string(span, 9) == "ext node " &&
+                        parser.getFilePosition() == parser.textNodeEndPos_ && !parser.hasMoreTextChars() &&
+                        parser.readTextSpan(length) == nullptr && length == 0,
+                    "Span continues after a char read and ends the node");
+  parser.close();
+
+  // Conversion: the same chapter stored and deflated, i.e. file mode and stream mode
+  const std::string unit = "w&amp;x&nbsp;\t\r\ny&#8230; \xC2\xA9\xC2\xA0z&unknown; ";
+  const std::string chapter =
+      "<html><body><p>  " + repeat(unit, 1500) + "</p><p>&nbsp;</p><p>end&amp</p></body></html>";
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"META-INF/container.xml",
+                     "<?xml version=\"1.0\"?><container><rootfiles>"
+                     "<rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+                     "</rootfiles></container>"});
+  entries.push_back({"OEBPS/content.opf",
+                     "<?xml version=\"1.0\"?><package><metadata></metadata><manifest>"
+                     "<item id=\"c1\" href=\"stored.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "<item id=\"c2\" href=\"deflated.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "</manifest><spine><itemref idref=\"c1\"/><itemref idref=\"c2\"/></spine></package>"});
+  entries.push_back({"OEBPS/stored.xhtml", chapter});
+  entries.push_back({"OEBPS/deflated.xhtml", chapter, true});
+  const std::string epubPath = TestConfig::TEST_OUTPUT_DIR + "/text_span_test.epub";
+  TestZip::writeStoredZip(epubPath, entries);
+
+  const std::string expectedText = repeat("w&x y... \xC2\xA9 z&unknown; ", 1500) + "\n\n";
+  {
+    EpubWordProvider provider(epubPath.c_str());
+    provider.setPrefetchEnabled(false);
+    for (int c = 0; c < 2; ++c) {
+      provider.setChapter(c);
+      const std::string text = readFile(provider.getChapterFilePath().c_str());
+      const std::string name = c == 0 ? "Stored" : "Deflated";
+      runner.expectTrue(text.compare(0, expectedText.size(), expectedText) == 0,
+                        name + " chapter decodes entities, whitespace and nbsp across spans");
+      runner.expectTrue(text.size() >= expectedText.size() && text.substr(expectedText.size()).find("end&amp") == 0,
+                        name + " chapter keeps an unterminated entity at the end of a node");
+    }
+  }
+
+  std::filesystem::remove_all(TestConfig::TEST_OUTPUT_DIR + "/epub_text_span_test");
+  std::remove(epubPath.c_str());
+  std::remove(xmlPath.c_str());
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+/**
+ * GlyphBlitTest.cpp - Glyph Blitter Equivalence Test
+ *
+ * Renders the same text with the byte-oriented glyph blitter and with the
+ * per-pixel drawPixel reference path, and checks that both produce identical
+ * framebuffers for all four orientations and all three bitmap planes,
+ * including glyphs clipped at every page edge. Runs once with a family that
+ * has pre-rotated (column-major) bitmaps and once with one that does not.
+ * Also checks that the single-pass three-plane grayscale mode writes the same
+ * BW, LSB and MSB planes as three separate single-plane passes.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+struct DrawCall {
+  int16_t x;
+  int16_t y;
+  FontStyle style;
+  const char* text;
+};
+
+static const char* orientationName(TextRenderer::Orientation o) {
+  switch (o) {
+    case TextRenderer::Portrait:
+      return "Portrait";
+    case TextRenderer::LandscapeClockwise:
+      return "LandscapeClockwise";
+    case TextRenderer::PortraitInverted:
+      return "PortraitInverted";
+    case TextRenderer::LandscapeCounterClockwise:
+      return "LandscapeCounterClockwise";
+  }
+  return "?";
+}
+
+static const char* bitmapTypeName(TextRenderer::BitmapType t) {
+  switch (t) {
+    case TextRenderer::BITMAP_BW:
+      return "BW";
+    case TextRenderer::BITMAP_GRAY_LSB:
+      return "GRAY_LSB";
+    case TextRenderer::BITMAP_GRAY_MSB:
+      return "GRAY_MSB";
+  }
+  return "?";
+}
+
+static std::vector<DrawCall> buildDrawCalls(int16_t pageW, int16_t pageH) {
+  std::vector<DrawCall> calls;
+  // Regular text well inside the page, at odd offsets to exercise bit shifts
+  calls.push_back({13, 41, FontStyle::REGULAR, "The quick brown fox jumps over the lazy dog."});
+  calls.push_back({7, 97, FontStyle::BOLD, "Sphinx of black quartz, judge my vow!"});
+  calls.push_back({21, 150, FontStyle::ITALIC, "\xC3\x84rger \xC3\xBC" "ber Stra\xC3\x9F" "en, caf\xC3\xA9 & na\xC3\xAFve"});
+  calls.push_back({3, 203, FontStyle::BOLD_ITALIC, "0123456789 @#%&*()[]{} \xE2\x80\x9Cquotes\xE2\x80\x9D"});
+  // Clipped at the left, top, right and bottom edges
+  calls.push_back({-9, 260, FontStyle::REGULAR, "Wmg clipped left"});
+  calls.push_back({40, 8, FontStyle::REGULAR, "Tgjy clipped top"});
+  calls.push_back({(int16_t)(pageW - 60), 320, FontStyle::BOLD, "clipped right WWW"});
+  calls.push_back({60, (int16_t)(pageH + 6), FontStyle::REGULAR, "gjpqy clipped bottom"});
+  // Entirely off the page
+  calls.push_back({(int16_t)(pageW + 20), 380, FontStyle::REGULAR, "offpage"});
+  return calls;
+}
+
+static void renderCalls(TextRenderer& renderer, uint8_t* buffer, const std::vector<DrawCall>& calls) {
+  memset(buffer, 0xFF, EInkDisplay::BUFFER_SIZE);
+  renderer.setFrameBuffer(buffer);
+  for (const DrawCall& c : calls) {
+    renderer.setFontStyle(c.style);
+    renderer.setCursor(c.x, c.y);
+    renderer.print(c.text);
+  }
+}
+
+static int countDifferentBytes(const uint8_t* a, const uint8_t* b) {
+  int diff = 0;
+  for (uint32_t i = 0; i < EInkDisplay::BUFFER_SIZE; ++i) {
+    if (a[i] != b[i]) {
+      diff++;
+    }
+  }
+  return diff;
+}
+
+static int countBlackPixels(const uint8_t* buf) {
+  int count = 0;
+  for (uint32_t i = 0; i < EInkDisplay::BUFFER_SIZE; ++i) {
+    uint8_t v = (uint8_t)~buf[i];
+    while (v) {
+      count += v & 1;
+      v >>= 1;
+    }
+  }
+  return count;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Glyph Blit Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  TextRenderer renderer(display);
+
+  std::vector<uint8_t> reference(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> blitted(EInkDisplay::BUFFER_SIZE);
+
+  const TextRenderer::Orientation orientations[] = {TextRenderer::Portrait, TextRenderer::LandscapeClockwise,
+                                                    TextRenderer::PortraitInverted,
+                                                    TextRenderer::LandscapeCounterClockwise};
+  const TextRenderer::BitmapType bitmapTypes[] = {TextRenderer::BITMAP_BW, TextRenderer::BITMAP_GRAY_LSB,
+                                                  TextRenderer::BITMAP_GRAY_MSB};
+
+  FontFamily* families[] = {&bookerly26Family, &notoSans26Family};
+  runner.expectTrue(bookerly26Family.regular->bitmapColumns != nullptr, "Bookerly has pre-rotated bitmaps");
+  runner.expectTrue(notoSans26Family.regular->bitmapColumns == nullptr, "NotoSans has no pre-rotated bitmaps");
+
+  for (FontFamily* family : families) {
+    renderer.setFontFamily(family);
+    for (TextRenderer::Orientation o : orientations) {
+      const bool landscape =
+          (o == TextRenderer::LandscapeClockwise || o == TextRenderer::LandscapeCounterClockwise);
+      const int16_t pageW = landscape ? EInkDisplay::DISPLAY_WIDTH : EInkDisplay::DISPLAY_HEIGHT;
+      const int16_t pageH = landscape ? EInkDisplay::DISPLAY_HEIGHT : EInkDisplay::DISPLAY_WIDTH;
+      const std::vector<DrawCall> calls = buildDrawCalls(pageW, pageH);
+      renderer.setOrientation(o);
+
+      for (TextRenderer::BitmapType t : bitmapTypes) {
+        renderer.setBitmapType(t);
+
+        renderer.setFastBlit(false);
+        renderCalls(renderer, reference.data(), calls);
+        renderer.setFastBlit(true);
+        renderCalls(renderer, blitted.data(), calls);
+
+        const std::string name =
+            std::string(family->familyName) + " / " + orientationName(o) + " / " + bitmapTypeName(t);
+        const int diff = countDifferentBytes(reference.data(), blitted.data());
+        runner.expectTrue(diff == 0, name + ": identical framebuffers",
+                          std::to_string(diff) + " bytes differ from the per-pixel reference");
+        if (t == TextRenderer::BITMAP_BW) {
+          runner.expectTrue(countBlackPixels(reference.data()) > 0, name + ": text was drawn");
+        }
+      }
+    }
+  }
+
+  // Three-plane mode vs. one pass per plane
+  std::vector<uint8_t> singlePlanes[3];
+  std::vector<uint8_t> bwPlane(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> lsbPlane(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> msbPlane(EInkDisplay::BUFFER_SIZE);
+  for (FontFamily* family : families) {
+    renderer.setFontFamily(family);
+    for (TextRenderer::Orientation o : orientations) {
+      const bool landscape =
+          (o == TextRenderer::LandscapeClockwise || o == TextRenderer::LandscapeCounterClockwise);
+      const int16_t pageW = landscape ? EInkDisplay::DISPLAY_WIDTH : EInkDisplay::DISPLAY_HEIGHT;
+      const int16_t pageH = landscape ? EInkDisplay::DISPLAY_HEIGHT : EInkDisplay::DISPLAY_WIDTH;
+      const std::vector<DrawCall> calls = buildDrawCalls(pageW, pageH);
+      renderer.setOrientation(o);
+
+      for (int i = 0; i < 3; ++i) {
+        singlePlanes[i].resize(EInkDisplay::BUFFER_SIZE);
+        renderer.setBitmapType(bitmapTypes[i]);
+        renderCalls(renderer, singlePlanes[i].data(), calls);
+      }
+
+      for (bool fast : {true, false}) {
+        renderer.setFastBlit(fast);
+        renderer.setBitmapType(TextRenderer::BITMAP_GRAY_MSB);  // ignored in three-plane mode
+        memset(lsbPlane.data(), 0xFF, EInkDisplay::BUFFER_SIZE);
+        memset(msbPlane.data(), 0xFF, EInkDisplay::BUFFER_SIZE);
+        renderer.setGrayscalePlanes(lsbPlane.data(), msbPlane.data());
+        renderCalls(renderer, bwPlane.data(), calls);
+        renderer.setGrayscalePlanes(nullptr, nullptr);
+
+        const std::string name = std::string(family->familyName) + " / " + orientationName(o) + " / three-plane" +
+                                 (fast ? "" : " (per-pixel)");
+        const uint8_t* planes[3] = {bwPlane.data(), lsbPlane.data(), msbPlane.data()};
+        int diff = 0;
+        for (int i = 0; i < 3; ++i) {
+          diff += countDifferentBytes(singlePlanes[i].data(), planes[i]);
+        }
+        runner.expectTrue(diff == 0, name + ": planes match single-plane passes",
+                          std::to_string(diff) + " bytes differ");
+      }
+      renderer.setFastBlit(true);
+    }
+  }
+
+  renderer.setOrientation(TextRenderer::Portrait);
+  renderer.setBitmapType(TextRenderer::BITMAP_BW);
+  renderer.setFrameBuffer(nullptr);
+
+  return runner.allPassed() ? 0 : 1;
+}
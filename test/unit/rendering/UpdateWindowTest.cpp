@@ -0,0 +1,104 @@
+/**
+ * UpdateWindowTest.cpp - Display Update Window Test
+ *
+ * Checks EInkDisplay::computeUpdateWindow(): after drawing into the back
+ * buffer, the reported window must be byte aligned, contain every byte that
+ * differs from the displayed frame, and be tight around those bytes.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+struct DiffBounds {
+  int minCol = EInkDisplay::DISPLAY_WIDTH_BYTES;
+  int maxCol = -1;
+  int minRow = EInkDisplay::DISPLAY_HEIGHT;
+  int maxRow = -1;
+};
+
+// Bounds of the bytes that differ between the back buffer and a snapshot of the displayed frame
+static DiffBounds diffBounds(const uint8_t* back, const uint8_t* shown) {
+  DiffBounds b;
+  for (int row = 0; row < EInkDisplay::DISPLAY_HEIGHT; ++row) {
+    for (int col = 0; col < EInkDisplay::DISPLAY_WIDTH_BYTES; ++col) {
+      const int i = row * EInkDisplay::DISPLAY_WIDTH_BYTES + col;
+      if (back[i] != shown[i]) {
+        b.minCol = col < b.minCol ? col : b.minCol;
+        b.maxCol = col > b.maxCol ? col : b.maxCol;
+        b.minRow = row < b.minRow ? row : b.minRow;
+        b.maxRow = row > b.maxRow ? row : b.maxRow;
+      }
+    }
+  }
+  return b;
+}
+
+static void expectWindowMatches(TestUtils::TestRunner& runner, EInkDisplay& display, const uint8_t* shown,
+                                const std::string& name) {
+  const DiffBounds b = diffBounds(display.getFrameBuffer(), shown);
+  uint16_t x = 0, y = 0, w = 0, h = 0;
+  const bool changed = display.computeUpdateWindow(x, y, w, h);
+  runner.expectTrue(changed == (b.maxRow >= 0), name + ": change detected");
+  if (!changed || b.maxRow < 0) {
+    return;
+  }
+  runner.expectTrue(x % 8 == 0 && w % 8 == 0, name + ": window is byte aligned");
+  const int ex = b.minCol * 8;
+  const int ey = b.minRow;
+  const int ew = (b.maxCol - b.minCol + 1) * 8;
+  const int eh = b.maxRow - b.minRow + 1;
+  runner.expectTrue(x == ex && y == ey && w == ew && h == eh, name + ": window is tight around the changes",
+                    "expected " + std::to_string(ex) + "," + std::to_string(ey) + " " + std::to_string(ew) + "x" +
+                        std::to_string(eh) + ", got " + std::to_string(x) + "," + std::to_string(y) + " " +
+                        std::to_string(w) + "x" + std::to_string(h));
+}
+
+int main() {
+  TestUtils::TestRunner runner("Update Window Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+  renderer.setFrameBuffer(display.getFrameBuffer());
+
+  // begin() leaves both buffers white, which is what the panel shows
+  std::vector<uint8_t> shown(display.getFrameBuffer(), display.getFrameBuffer() + EInkDisplay::BUFFER_SIZE);
+
+  uint16_t x = 0, y = 0, w = 0, h = 0;
+  runner.expectTrue(!display.computeUpdateWindow(x, y, w, h), "Blank back buffer: nothing to update");
+
+  // A short word in portrait: a narrow vertical strip of panel rows
+  renderer.setOrientation(TextRenderer::Portrait);
+  renderer.setCursor(100, 300);
+  renderer.print("Menu");
+  expectWindowMatches(runner, display, shown.data(), "Portrait word");
+
+  // A second word elsewhere extends the window to cover both
+  renderer.setOrientation(TextRenderer::LandscapeCounterClockwise);
+  renderer.setCursor(613, 455);
+  renderer.print("item");
+  expectWindowMatches(runner, display, shown.data(), "Two words");
+
+  // Clearing back to white leaves nothing to send
+  display.clearScreen(0xFF);
+  runner.expectTrue(!display.computeUpdateWindow(x, y, w, h), "Cleared back buffer: nothing to update");
+
+  // A single pixel at the far corner
+  renderer.drawPixel(799, 479, true);
+  expectWindowMatches(runner, display, shown.data(), "Corner pixel");
+  display.computeUpdateWindow(x, y, w, h);
+  runner.expectTrue(x == 792 && y == 479 && w == 8 && h == 1, "Corner pixel: one byte window");
+
+  renderer.setFrameBuffer(nullptr);
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/**
+ * BookContainerTest.cpp - Whole-Book Container Test
+ *
+ * Builds a small EPUB and reads it twice through EpubWordProvider: once from
+ * the per-chapter TXT files and once from the single-file book container.
+ * Every chapter must produce the same words and styles in both modes, reading
+ * backwards must match reading forwards, and the book percentage must come
+ * from exact text offsets. Also checks the container's paragraph table and
+ * that a container built for another source size is rejected.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "content/epub/BookContainer.h"
+#include "content/providers/EpubWordProvider.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+std::vector<TestZip::Entry> buildBook() {
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"META-INF/container.xml",
+                     "<?xml version=\"1.0\"?><container><rootfiles>"
+                     "<rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+                     "</rootfiles></container>"});
+  entries.push_back({"OEBPS/content.opf",
+                     "<?xml version=\"1.0\"?><package><metadata><dc:language>en</dc:language></metadata>"
+                     "<manifest>"
+                     "<item id=\"css\" href=\"style.css\" media-type=\"text/css\"/>"
+                     "<item id=\"c1\" href=\"one.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "<item id=\"c2\" href=\"two.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "<item id=\"c3\" href=\"three.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "</manifest><spine><itemref idref=\"c1\"/><itemref idref=\"c2\"/><itemref idref=\"c3\"/></spine>"
+                     "</package>"});
+  entries.push_back({"OEBPS/style.css", ".center { text-align: center; }\n"});
+  entries.push_back({"OEBPS/one.xhtml",
+                     "<html><body><h1 class=\"center\">Chapter One</h1>"
+                     "<p>The <b>first</b> chapter has <i>two</i> paragraphs.</p>"
+                     "<p>Second paragraph of the first chapter.</p></body></html>"});
+  entries.push_back({"OEBPS/two.xhtml",
+                     "<html><body><p class=\"center\">Centered</p>"
+                     "<p>Some <b><i>bold italic</i></b> words<br/>after a break.</p></body></html>"});
+  std::string longChapter = "<html><body>";
+  for (int i = 0; i < 40; ++i) {
+    longChapter += "<p>Paragraph " + std::to_string(i) + " of the <em>long</em> third chapter.</p>";
+  }
+  longChapter += "</body></html>";
+  entries.push_back({"OEBPS/three.xhtml", longChapter});
+  return entries;
+}
+
+// Words of the current chapter as "text/style" pairs, read forwards from the start
+std::vector<std::string> readForward(WordProvider& provider) {
+  std::vector<std::string> words;
+  provider.reset();
+  while (provider.hasNextWord()) {
+    StyledWord w = provider.getNextWord();
+    words.push_back(std::string(w.text.c_str()) + "/" + std::to_string((int)w.style));
+  }
+  return words;
+}
+
+// Words of the current chapter read backwards from the end, returned in reading order
+std::vector<std::string> readBackward(WordProvider& provider) {
+  std::vector<std::string> words;
+  provider.setPosition(1 << 30);
+  while (provider.hasPrevWord()) {
+    StyledWord w = provider.getPrevWord();
+    if (w.text.length() == 0)
+      break;
+    words.insert(words.begin(), std::string(w.text.c_str()) + "/" + std::to_string((int)w.style));
+  }
+  return words;
+}
+
+std::string join(const std::vector<std::string>& words) {
+  std::string s;
+  for (const std::string& w : words) {
+    s += w + "|";
+  }
+  return s;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Book Container Test");
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/book_container_test.epub";
+  const std::string extractDir = TestConfig::TEST_OUTPUT_DIR + "/epub_book_container_test";
+  const std::string containerPath = extractDir + "/book.bin";
+  TestZip::writeStoredZip(path, buildBook());
+
+  // Reference: per-chapter TXT files
+  std::vector<std::string> expected;
+  std::vector<size_t> chapterSizes;
+  {
+    EpubWordProvider provider(path.c_str());
+    provider.setPrefetchEnabled(false);
+    runner.expectTrue(provider.isValid(), "EPUB opens");
+    for (int c = 0; c < provider.getChapterCount(); ++c) {
+      provider.setChapter(c);
+      expected.push_back(join(readForward(provider)));
+      chapterSizes.push_back(std::filesystem::file_size(provider.getChapterFilePath().c_str()));
+    }
+    runner.expectTrue(!provider.isUsingBookContainer(), "Container is off by default");
+  }
+
+  {
+    EpubWordProvider provider(path.c_str());
+    provider.setUseBookContainer(true);
+    runner.expectTrue(provider.setChapter(0), "First chapter opens in container mode");
+    runner.expectTrue(provider.isUsingBookContainer(), "Book container is built and used");
+    runner.expectTrue(std::filesystem::exists(containerPath), "Container file is written to the extract dir");
+    runner.expectTrue(!std::filesystem::exists(extractDir + "/OEBPS/one.txt"),
+                      "Per-chapter TXT files are removed once stitched into the container");
+
+    bool same = true;
+    bool backwardSame = true;
+    for (int c = 0; c < provider.getChapterCount(); ++c) {
+      provider.setChapter(c);
+      const std::string forward = join(readForward(provider));
+      if (forward != expected[c]) {
+        same = false;
+        std::cout << "  chapter " << c << " differs:\n    " << forward << "\n    " << expected[c] << "\n";
+      }
+      if (join(readBackward(provider)) != forward) {
+        backwardSame = false;
+        std::cout << "  chapter " << c << " backward read differs\n";
+      }
+    }
+    runner.expectTrue(same, "Every chapter reads the same words and styles from the container");
+    runner.expectTrue(backwardSame, "Backward reading inside a container chapter matches forward reading");
+
+    // Book percentage from exact text offsets: the start of the last chapter is
+    // preceded by exactly the text of the earlier chapters
+    size_t total = 0;
+    for (size_t s : chapterSizes) {
+      total += s;
+    }
+    provider.setChapter(2);
+    provider.setPosition(0);
+    const uint32_t expectedPct = (uint32_t)((uint64_t)(chapterSizes[0] + chapterSizes[1]) * 10000 / total);
+    runner.expectEqual(std::to_string(expectedPct), std::to_string(provider.getPercentage()),
+                       "Book percentage uses exact text offsets");
+    runner.expectEqual(std::to_string(0), std::to_string(provider.getChapterPercentage()),
+                       "Chapter percentage is relative to the chapter");
+    runner.expectTrue(provider.getChapterFilePath() == String((containerPath + "#2").c_str()),
+                      "Chapters have distinct file keys inside the container");
+  }
+
+  // Direct reader checks against a container built for a known source size
+  {
+    const std::string chapterA = TestConfig::TEST_OUTPUT_DIR + "/container_a.txt";
+    const std::string chapterB = TestConfig::TEST_OUTPUT_DIR + "/container_b.txt";
+    const std::string manual = TestConfig::TEST_OUTPUT_DIR + "/container_test.bin";
+    {
+      std::ofstream a(chapterA, std::ios::binary);
+      a << "one\ntwo\n\nthree";
+      std::ofstream b(chapterB, std::ios::binary);
+      b << "four\n";
+    }
+    BookContainer::Writer writer(manual.c_str(), 1234);
+    writer.appendChapterFile(chapterA.c_str());
+    writer.appendChapterFile("");
+    writer.appendChapterFile(chapterB.c_str());
+    runner.expectTrue(writer.finish(), "Writer finishes");
+
+    BookContainer container;
+    runner.expectTrue(!container.open(manual.c_str(), 999), "Container for another source size is rejected");
+    runner.expectTrue(container.open(manual.c_str(), 1234), "Container opens for its source size");
+    runner.expectTrue(container.getChapterCount() == 3 && container.getTextSize() == 19,
+                      "Chapter count and text size");
+    runner.expectTrue(container.getChapterOffset(2) == 14 && container.getChapterLength(1) == 0,
+                      "Chapter offsets include empty chapters");
+    std::vector<uint32_t> starts;
+    container.readChapterParagraphs(0, starts);
+    std::string list;
+    for (uint32_t s : starts) {
+      list += std::to_string(s) + ",";
+    }
+    runner.expectEqual("0,4,8,9,", list, "Paragraph starts are chapter relative");
+    container.readChapterParagraphs(1, starts);
+    runner.expectTrue(starts.empty(), "Empty chapter has no paragraphs");
+    container.close();
+
+    std::filesystem::remove(chapterA);
+    std::filesystem::remove(chapterB);
+    std::filesystem::remove(manual);
+  }
+
+  std::filesystem::remove_all(extractDir);
+  std::filesystem::remove(path);
+  return runner.allPassed() ? 0 : 1;
+}
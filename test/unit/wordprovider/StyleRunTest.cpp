@@ -0,0 +1,290 @@
+/**
+ * StyleRunTest.cpp - Style Run Table Test
+ *
+ * Converts a small EPUB twice: once to text with inline ESC tokens and once
+ * to plain text with a sidecar style-run table. Reading forwards, reading
+ * backwards and seeking to every word must give the same words, styles and
+ * paragraph alignments in both formats. Also checks the run table itself,
+ * streamed to a file and looked up through the reader's window.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "content/providers/EpubWordProvider.h"
+#include "content/providers/StyleRuns.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "test_zip.h"
+
+namespace {
+
+std::vector<TestZip::Entry> buildBook() {
+  std::vector<TestZip::Entry> entries;
+  entries.push_back({"mimetype", "application/epub+zip"});
+  entries.push_back({"META-INF/container.xml",
+                     "<?xml version=\"1.0\"?><container><rootfiles>"
+                     "<rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+                     "</rootfiles></container>"});
+  entries.push_back({"OEBPS/content.opf",
+                     "<?xml version=\"1.0\"?><package><metadata><dc:language>en</dc:language></metadata>"
+                     "<manifest>"
+                     "<item id=\"css\" href=\"style.css\" media-type=\"text/css\"/>"
+                     "<item id=\"c1\" href=\"one.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "<item id=\"c2\" href=\"two.xhtml\" media-type=\"application/xhtml+xml\"/>"
+                     "</manifest><spine><itemref idref=\"c1\"/><itemref idref=\"c2\"/></spine>"
+                     "</package>"});
+  entries.push_back({"OEBPS/style.css",
+                     ".center { text-align: center; }\n"
+                     ".right { text-align: right; }\n"
+                     ".lead { text-indent: 24px; font-weight: bold; }\n"});
+  entries.push_back({"OEBPS/one.xhtml",
+                     "<html><body><h1 class=\"center\">Chapter <i>One</i></h1>"
+                     "<p class=\"lead\">A bold lead with <i>italic</i> inside.</p>"
+                     "<p>Mid<b>word</b>style and <b><i>bold italic</i></b> text.</p>"
+                     "<p class=\"right\">Right <em>aligned</em><br/>after a break.</p></body></html>"});
+  std::string two = "<html><body>";
+  for (int i = 0; i < 60; ++i) {
+    two += "<p" + std::string(i % 3 == 0 ? " class=\"center\"" : "") + ">Paragraph " + std::to_string(i) +
+           " has <strong>strong</strong> and <em>emphasised</em> words.</p>";
+  }
+  two += "</body></html>";
+  entries.push_back({"OEBPS/two.xhtml", two});
+  return entries;
+}
+
+struct ReadWord {
+  std::string text;
+  int style;
+  int align;
+  int start;
+  int end;
+};
+
+std::string describe(const ReadWord& w) {
+  return w.text + "/" + std::to_string(w.style) + "/" + std::to_string(w.align);
+}
+
+std::vector<ReadWord> readForward(WordProvider& provider) {
+  std::vector<ReadWord> words;
+  provider.reset();
+  while (provider.hasNextWord()) {
+    const int start = provider.getCurrentIndex();
+    StyledWord w = provider.getNextWord();
+    if (w.text.length() == 0)
+      continue;
+    // Layout reads the alignment right after the first word of a line; record it for every word
+    words.push_back({w.text.c_str(), (int)w.style, (int)provider.getParagraphAlignment(), start,
+                     provider.getCurrentIndex()});
+  }
+  return words;
+}
+
+std::string readBackward(WordProvider& provider) {
+  std::vector<std::string> words;
+  provider.setPosition(1 << 30);
+  while (provider.hasPrevWord()) {
+    StyledWord w = provider.getPrevWord();
+    if (w.text.length() == 0)
+      break;
+    words.insert(words.begin(), std::string(w.text.c_str()) + "/" + std::to_string((int)w.style));
+  }
+  std::string s;
+  for (const std::string& w : words) {
+    s += w + "|";
+  }
+  return s;
+}
+
+std::string forwardText(const std::vector<ReadWord>& words) {
+  std::string s;
+  for (const ReadWord& w : words) {
+    s += w.text + "/" + std::to_string(w.style) + "|";
+  }
+  return s;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Style Run Test");
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/style_run_test.epub";
+  const std::string extractDir = TestConfig::TEST_OUTPUT_DIR + "/epub_style_run_test";
+  TestZip::writeStoredZip(path, buildBook());
+
+  // Token format reference
+  std::vector<std::vector<ReadWord>> expected;
+  std::vector<std::string> expectedBackward;
+  {
+    EpubWordProvider provider(path.c_str());
+    provider.setPrefetchEnabled(false);
+    runner.expectTrue(provider.isValid(), "EPUB opens");
+    for (int c = 0; c < provider.getChapterCount(); ++c) {
+      provider.setChapter(c);
+      expected.push_back(readForward(provider));
+      expectedBackward.push_back(readBackward(provider));
+    }
+  }
+
+  EpubWordProvider provider(path.c_str());
+  provider.setPrefetchEnabled(false);
+  provider.setUseStyleRuns(true);
+
+  bool forwardSame = true;
+  bool backwardSame = true;
+  bool seekForwardSame = true;
+  bool seekBackwardSame = true;
+  bool plainText = true;
+  bool sawStyles = false;
+  for (int c = 0; c < provider.getChapterCount(); ++c) {
+    runner.expectTrue(provider.setChapter(c), "Chapter " + std::to_string(c) + " opens in style-run mode");
+    const std::string txtPath = provider.getChapterFilePath().c_str();
+    {
+      std::ifstream in(txtPath, std::ios::binary);
+      const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      if (content.empty() || content.find('\x1B') != std::string::npos) {
+        plainText = false;
+      }
+    }
+    StyleRunReader runs;
+    const uint32_t textSize = (uint32_t)std::filesystem::file_size(txtPath);
+    if (!runs.open((txtPath + ".runs").c_str(), textSize) || runs.size() < 3) {
+      plainText = false;
+    }
+
+    const std::vector<ReadWord> words = readForward(provider);
+    if (forwardText(words) != forwardText(expected[c]) || words.size() != expected[c].size()) {
+      forwardSame = false;
+      std::cout << "  chapter " << c << " forward:\n    " << forwardText(words) << "\n    "
+                << forwardText(expected[c]) << "\n";
+      continue;
+    }
+    for (size_t i = 0; i < words.size(); ++i) {
+      if (describe(words[i]) != describe(expected[c][i])) {
+        forwardSame = false;
+        std::cout << "  chapter " << c << " word " << i << ": " << describe(words[i]) << " vs "
+                  << describe(expected[c][i]) << "\n";
+      }
+      sawStyles = sawStyles || words[i].style != 0;
+    }
+    if (readBackward(provider) != expectedBackward[c]) {
+      backwardSame = false;
+      std::cout << "  chapter " << c << " backward read differs\n";
+    }
+
+    // Random access: seek to each word start / end and read one word
+    for (size_t i = 0; i < words.size(); i += 3) {
+      provider.setPosition(words[i].start);
+      StyledWord next = provider.getNextWord();
+      const std::string got = std::string(next.text.c_str()) + "/" + std::to_string((int)next.style) + "/" +
+                              std::to_string((int)provider.getParagraphAlignment());
+      if (got != describe(words[i])) {
+        seekForwardSame = false;
+        std::cout << "  seek forward to word " << i << ": " << got << " vs " << describe(words[i]) << "\n";
+      }
+      provider.setPosition(words[i].end);
+      StyledWord prev = provider.getPrevWord();
+      if (std::string(prev.text.c_str()) != words[i].text || (int)prev.style != words[i].style) {
+        seekBackwardSame = false;
+        std::cout << "  seek backward to word " << i << ": " << prev.text.c_str() << "\n";
+      }
+    }
+  }
+  runner.expectTrue(plainText, "Chapters are written as plain text with a matching run table");
+  runner.expectTrue(forwardSame, "Forward reading matches the token format (words, styles, alignment)");
+  runner.expectTrue(sawStyles, "Styled words are present");
+  runner.expectTrue(backwardSame, "Backward reading matches the token format");
+  runner.expectTrue(seekForwardSame, "Seeking to any word start restores its style and alignment");
+  runner.expectTrue(seekBackwardSame, "Reading backwards from any word end restores its style");
+
+  // Encoder: runs start at token positions, repeated tokens collapse, indent length is recorded
+  {
+    const std::string tokens = std::string("\x1B") + "C\x1BH---\x1Bh" + "Title\x1B" + "c\n" + "a\x1B" + "Bb\x1B" +
+                               "b\x1B" + "Xc\x1Bx";
+    StyleRunEncoder encoder;
+    std::vector<char> plain;
+    // Feed one byte at a time so tokens are split between chunks
+    for (char ch : tokens) {
+      encoder.feed(&ch, 1, plain);
+    }
+    runner.expectEqual("---Title\nabc", std::string(plain.begin(), plain.end()), "Encoder strips tokens");
+    std::string list;
+    for (const StyleRun& r : encoder.getRuns()) {
+      list += std::to_string(r.offset) + ":" + std::to_string((int)r.style) + std::to_string((int)r.align) +
+              std::to_string(r.indent) + " ";
+    }
+    runner.expectEqual("0:433 3:030 8:000 10:100 11:300 12:000 ", list, "Encoder runs");
+  }
+
+  // Streamed table: the file holds the same runs as the in-memory encoder, and
+  // windowed lookups agree with a linear scan
+  {
+    std::string tokens;
+    const char* const commands = "BbIiXxCcRrLlJj";
+    for (int i = 0; i < 3000; ++i) {
+      tokens += std::string("word") + std::to_string(i) + " ";
+      if (i % 3 == 0) {
+        tokens += std::string("\x1B") + commands[(i / 3) % 14];
+      }
+      if (i % 97 == 0) {
+        tokens += std::string("\x1BH") + std::string(i % 2 ? 4 : 300, '-') + "\x1Bh";
+      }
+    }
+    StyleRunEncoder reference;
+    std::vector<char> plain;
+    reference.feed(tokens.data(), tokens.size(), plain);
+
+    const std::string runsPath = TestConfig::TEST_OUTPUT_DIR + "/style_run_stream_test.runs";
+    File runsOut = SD.open(runsPath.c_str(), FILE_WRITE);
+    StyleRunEncoder encoder(runsOut);
+    std::vector<char> streamedPlain;
+    for (size_t pos = 0; pos < tokens.size(); pos += 777) {
+      encoder.feed(tokens.data() + pos, std::min<size_t>(777, tokens.size() - pos), streamedPlain);
+    }
+    const bool finished = encoder.finish();
+    runsOut.close();
+    runner.expectTrue(finished && streamedPlain == plain, "Streaming encoder writes its table");
+
+    const std::vector<StyleRun>& expectedRuns = reference.getRuns();
+    StyleRunReader reader;
+    bool same = reader.open(runsPath.c_str(), (uint32_t)plain.size()) && reader.size() == expectedRuns.size();
+    for (size_t i = 0; same && i < expectedRuns.size(); ++i) {
+      const StyleRun run = reader.at(i);
+      same = run.offset == expectedRuns[i].offset && run.style == expectedRuns[i].style &&
+             run.align == expectedRuns[i].align && run.indent == expectedRuns[i].indent;
+    }
+    runner.expectTrue(same && expectedRuns.size() > 1000, "Streamed runs match the in-memory runs",
+                      std::to_string(expectedRuns.size()) + " runs");
+
+    bool found = same;
+    for (uint32_t offset = 0; found && offset < plain.size(); offset += (offset % 7 == 0) ? 1 : 37) {
+      size_t expected = 0;
+      while (expected + 1 < expectedRuns.size() && expectedRuns[expected + 1].offset <= offset) {
+        expected++;
+      }
+      const size_t run = reader.find(offset);
+      found = run == expected && reader.end(run) == (expected + 1 < expectedRuns.size()
+                                                         ? expectedRuns[expected + 1].offset
+                                                         : (uint32_t)plain.size());
+    }
+    // Backwards too, crossing the window the other way
+    for (uint32_t offset = (uint32_t)plain.size(); found && offset > 0;) {
+      offset -= std::min<uint32_t>(offset, 53);
+      found = reader.at(reader.find(offset)).offset <= offset && offset < reader.end(reader.find(offset));
+    }
+    runner.expectTrue(found, "Windowed lookups find the run of every offset");
+    runner.expectTrue(!reader.open(runsPath.c_str(), (uint32_t)plain.size() + 1), "Table for another text is rejected");
+    std::filesystem::remove(runsPath);
+  }
+
+  std::filesystem::remove_all(extractDir);
+  std::filesystem::remove(path);
+  return runner.allPassed() ? 0 : 1;
+}
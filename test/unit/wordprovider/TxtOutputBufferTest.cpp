@@ -0,0 +1,131 @@
+/**
+ * TxtOutputBufferTest.cpp - Conversion Output Ring Buffer Test
+ *
+ * Appends text in chunks of many sizes (single chars, C strings, runs longer
+ * than the ring) and checks that the file only ever grows by whole 512-byte
+ * sectors until the final flush, that no more than the ring's capacity is
+ * held back, and that the file ends up with exactly the appended bytes. In
+ * style-run mode the file must hold the encoder's token-free text.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "content/providers/StyleRuns.h"
+#include "content/providers/TxtOutputBuffer.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+namespace {
+
+std::string readFile(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+// Deterministic text with ESC tokens every so often
+std::string buildText(size_t size) {
+  std::string text;
+  uint32_t seed = 99;
+  while (text.size() < size) {
+    seed = seed * 1103515245u + 12345u;
+    const uint32_t r = (seed >> 16) & 0xFF;
+    if (r < 8) {
+      text += '\x1B';
+      text += "BbIiCc"[r % 6];
+    } else {
+      text += (char)('a' + r % 26);
+      if (r % 7 == 0) {
+        text += ' ';
+      }
+    }
+  }
+  return text;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Txt Output Buffer Test");
+
+  std::filesystem::create_directories(TestConfig::TEST_OUTPUT_DIR);
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/txt_output_buffer_test.txt";
+  const std::string text = buildText(50000);
+
+  {
+    File out = SD.open(path.c_str(), FILE_WRITE);
+    TxtOutputBuffer buffer(out);
+    runner.expectTrue(buffer.isValid(), "Ring is allocated");
+
+    bool sectorWrites = true;
+    bool boundedBacklog = true;
+    size_t pos = 0;
+    size_t step = 0;
+    while (pos < text.size()) {
+      // Cycle through single chars, C strings, Strings and runs longer than the ring
+      const size_t sizes[] = {1, 7, 300, 511, 512, 513, 5000, 9000};
+      size_t n = sizes[step % 8];
+      if (n > text.size() - pos) {
+        n = text.size() - pos;
+      }
+      const std::string piece = text.substr(pos, n);
+      if (n == 1) {
+        buffer += piece[0];
+      } else if (step % 3 == 0) {
+        buffer += piece.c_str();
+      } else if (step % 3 == 1) {
+        buffer += String(piece.c_str());
+      } else {
+        buffer.append(piece.data(), piece.size());
+      }
+      pos += n;
+      step++;
+      if (out.size() % TxtOutputBuffer::SECTOR_SIZE != 0) {
+        sectorWrites = false;
+      }
+      if (buffer.size() - out.size() > TxtOutputBuffer::CAPACITY) {
+        boundedBacklog = false;
+      }
+    }
+    runner.expectTrue(sectorWrites, "File grows by whole sectors only");
+    runner.expectTrue(boundedBacklog, "At most one ring of text is held back");
+    runner.expectTrue(out.size() > 0, "Full rings are written before the flush");
+    buffer.flush();
+    runner.expectEqual(std::to_string(text.size()), std::to_string(buffer.bytesWritten()),
+                       "Flush writes the remainder");
+    out.close();
+  }
+  runner.expectTrue(readFile(path) == text, "File holds exactly the appended text");
+
+  // Style-run mode writes the encoder's plain text and records the same runs
+  {
+    StyleRunEncoder reference;
+    std::vector<char> expectedPlain;
+    reference.feed(text.data(), text.size(), expectedPlain);
+
+    StyleRunEncoder encoder;
+    File out = SD.open(path.c_str(), FILE_WRITE);
+    {
+      TxtOutputBuffer buffer(out, &encoder);
+      for (size_t pos = 0; pos < text.size(); pos += 333) {
+        buffer.append(text.data() + pos, std::min<size_t>(333, text.size() - pos));
+      }
+      buffer.flush();
+      runner.expectEqual(std::to_string(expectedPlain.size()), std::to_string(buffer.bytesWritten()),
+                         "Style-run mode counts plain bytes");
+    }
+    out.close();
+    runner.expectTrue(readFile(path) == std::string(expectedPlain.begin(), expectedPlain.end()),
+                      "Style-run mode writes token-free text");
+    runner.expectTrue(encoder.getRuns().size() == reference.getRuns().size() &&
+                          encoder.getTextSize() == reference.getTextSize(),
+                      "Style-run mode records the same runs");
+  }
+
+  std::filesystem::remove(path);
+  return runner.allPassed() ? 0 : 1;
+}